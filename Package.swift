@@ -17,12 +17,14 @@ let portableTargetNames: Set<String> = [
 	"SwiftTextMarkdown",
 	"SwiftTextAttributedString",
 	"SwiftTextPDFWriter",
+	"SwiftTextPDFReader",
 	"SwiftTextOpenType",
 	"SwiftTextCSS",
 	"SwiftTextCoreTests",
 	"SwiftTextMarkdownTests",
 	"SwiftTextAttributedStringTests",
 	"SwiftTextPDFWriterTests",
+	"SwiftTextPDFReaderTests",
 	"SwiftTextOpenTypeTests",
 	"SwiftTextCSSTests"
 ]
@@ -65,12 +67,12 @@ let macOSProducts: [Product] = [
 let macOSTargets: [Target] = [
 	.target(
 		name: "SwiftTextOCR",
-		dependencies: ["SwiftTextMarkdown"],
+		dependencies: ["SwiftTextMarkdown", "SwiftTextCore"],
 		path: "Sources/SwiftTextOCR"
 	),
 	.target(
 		name: "SwiftTextPDF",
-		dependencies: ["SwiftTextOCR"],
+		dependencies: ["SwiftTextOCR", "SwiftTextPDFReader"],
 		path: "Sources/SwiftTextPDF"
 	),
 	.testTarget(
@@ -145,6 +147,8 @@ let htmlTargets: [Target] = [
 			// transitively enables it for plain `swift build`.
 			.product(name: "HTMLParser", package: "XMLKit", condition: .when(traits: ["HTML"])),
 			"SwiftTextMarkdown",
+			// ResourceLimits/ResourceBudget, which bound DOM construction.
+			"SwiftTextCore",
 			// The HTML→Markdown path builds a swift-markdown AST from the DOM and
 			// renders it with MarkupFormatter, so it needs the Markdown module
 			// directly (not just transitively via SwiftTextMarkdown). swift-markdown
@@ -156,7 +160,9 @@ let htmlTargets: [Target] = [
 	.target(
 		name: "SwiftTextMarkdown",
 		dependencies: [
-			.product(name: "Markdown", package: "swift-markdown")
+			.product(name: "Markdown", package: "swift-markdown"),
+			// DocumentEvent, which the Markdown/HTML event writers consume.
+			"SwiftTextCore"
 		],
 		path: "Sources/SwiftTextMarkdown"
 	),
@@ -175,7 +181,7 @@ let htmlTargets: [Target] = [
 	),
 	.testTarget(
 		name: "SwiftTextMarkdownTests",
-		dependencies: ["SwiftTextMarkdown"],
+		dependencies: ["SwiftTextMarkdown", "SwiftTextCore"],
 		path: "Tests/SwiftTextMarkdownTests"
 	),
 	.testTarget(
@@ -232,6 +238,12 @@ let packageProducts: [Product] = [
 		name: "SwiftTextPDFWriter",
 		targets: ["SwiftTextPDFWriter"]
 	),
+	// Foundation-only PDF text extraction (xref, filters, fonts, text operators),
+	// the portable counterpart of the PDFKit-backed SwiftTextPDF.
+	.library(
+		name: "SwiftTextPDFReader",
+		targets: ["SwiftTextPDFReader"]
+	),
 	// Pure-Swift OpenType/TrueType reader (font metrics + embeddable bytes),
 	// the replacement for fontconfig/HarfBuzz. Foundation-only, always available.
 	.library(
@@ -305,7 +317,9 @@ let packageTargets: [Target] = [
 	.target(
 		name: "SwiftTextIWA",
 		dependencies: [
-			.product(name: "ZIPFoundation", package: "ZIPFoundation", condition: .when(traits: ["PAGES"]))
+			.product(name: "ZIPFoundation", package: "ZIPFoundation", condition: .when(traits: ["PAGES"])),
+			// ResourceLimits/ResourceBudget, which bound decompression and decoding.
+			"SwiftTextCore"
 		],
 		path: "Sources/SwiftTextIWA"
 	),
@@ -329,19 +343,19 @@ let packageTargets: [Target] = [
 	// IWA core and the shared TST table decoder; no Pages dependency.
 	.target(
 		name: "SwiftTextNumbers",
-		dependencies: ["SwiftTextIWA"],
+		dependencies: ["SwiftTextIWA", "SwiftTextCore"],
 		path: "Sources/SwiftTextNumbers"
 	),
 	// Apple Keynote reader: deck slide text (title/body/notes) to Markdown/JSON/text.
 	// Navigates the slide graph structurally via the IWA core; no Pages dependency.
 	.target(
 		name: "SwiftTextKeynote",
-		dependencies: ["SwiftTextIWA"],
+		dependencies: ["SwiftTextIWA", "SwiftTextCore"],
 		path: "Sources/SwiftTextKeynote"
 	),
 	.testTarget(
 		name: "SwiftTextDOCXTests",
-		dependencies: ["SwiftTextDOCX"],
+		dependencies: ["SwiftTextDOCX", "SwiftTextCore"],
 		path: "Tests/SwiftTextDOCXTests",
 		resources: [
 			.process("Resources")
@@ -349,12 +363,12 @@ let packageTargets: [Target] = [
 	),
 	.testTarget(
 		name: "SwiftTextEPUBTests",
-		dependencies: ["SwiftTextEPUB", "SwiftTextMarkdown"],
+		dependencies: ["SwiftTextEPUB", "SwiftTextMarkdown", "SwiftTextCore"],
 		path: "Tests/SwiftTextEPUBTests"
 	),
 	.testTarget(
 		name: "SwiftTextPagesTests",
-		dependencies: ["SwiftTextPages", "SwiftTextIWA"],
+		dependencies: ["SwiftTextPages", "SwiftTextIWA", "SwiftTextCore"],
 		path: "Tests/SwiftTextPagesTests",
 		resources: [
 			.process("Resources")
@@ -370,7 +384,7 @@ let packageTargets: [Target] = [
 	),
 	.testTarget(
 		name: "SwiftTextKeynoteTests",
-		dependencies: ["SwiftTextKeynote", "SwiftTextIWA"],
+		dependencies: ["SwiftTextKeynote", "SwiftTextIWA", "SwiftTextCore"],
 		path: "Tests/SwiftTextKeynoteTests",
 		resources: [
 			.process("Resources")
@@ -391,6 +405,16 @@ let packageTargets: [Target] = [
 		dependencies: ["SwiftTextPDFWriter"],
 		path: "Tests/SwiftTextPDFWriterTests"
 	),
+	.target(
+		name: "SwiftTextPDFReader",
+		dependencies: ["SwiftTextCore"],
+		path: "Sources/SwiftTextPDFReader"
+	),
+	.testTarget(
+		name: "SwiftTextPDFReaderTests",
+		dependencies: ["SwiftTextPDFReader", "SwiftTextPDFWriter", "SwiftTextCore"],
+		path: "Tests/SwiftTextPDFReaderTests"
+	),
 	.target(
 		name: "SwiftTextOpenType",
 		path: "Sources/SwiftTextOpenType"
@@ -411,19 +435,24 @@ let packageTargets: [Target] = [
 	),
 	// The rendering engine. Depends on SwiftTextHTML (the libxml2-backed DOM,
 	// like SwiftTextCLI) plus the cross-platform CSS/OpenType/PDF foundations.
+	// Markdown documents can skip the HTML round trip: the renderer builds its
+	// styled tree straight from the swift-markdown AST.
 	.target(
 		name: "SwiftTextRender",
 		dependencies: [
 			"SwiftTextHTML",
+			"SwiftTextMarkdown",
 			"SwiftTextCSS",
 			"SwiftTextOpenType",
-			"SwiftTextPDFWriter"
+			"SwiftTextPDFWriter",
+			"SwiftTextCore",
+			.product(name: "Markdown", package: "swift-markdown")
 		],
 		path: "Sources/SwiftTextRender"
 	),
 	.testTarget(
 		name: "SwiftTextRenderTests",
-		dependencies: ["SwiftTextRender", "SwiftTextHTML", "SwiftTextCSS"],
+		dependencies: ["SwiftTextRender", "SwiftTextHTML", "SwiftTextCSS", "SwiftTextCore"],
 		path: "Tests/SwiftTextRenderTests"
 	)
 ] + htmlTargets + macOSTargets + cliTargets
@@ -6,10 +6,12 @@
 // psobot/keynote-parser (MIT), see Docs/IWA-PROTOBUF-SCHEMAS.md — and emits Swift
 // structs/enums backed by SwiftText's own `ProtobufReader`/`ProtobufWriter`
 // (no swift-protobuf runtime dependency). Each generated message:
+//   • declares its field table as a static `IWASchema` (number, proto type, label),
 //   • has typed properties (optional scalars, arrays for `repeated`, nested
-//     generated structs for message fields, `Int32` for enum fields),
-//   • decodes from a `ProtobufMessage`,
-//   • encodes back via `ProtobufWriter`,
+//     generated classes for message fields, `Int32` for enum fields), each a
+//     one-line view over a slot of the schema-ordered storage,
+//   • decodes and encodes through the shared table-driven `IWACodec`
+//     (Sources/SwiftTextPages/IWAMessage.swift) — no per-message wire code,
 //   • preserves any unknown / un-modeled fields verbatim (lossless round-trip).
 //
 // Usage:  swift Scripts/GenerateIWAModels.swift <protos-dir> Sources/SwiftTextPages/Generated/IWA
@@ -164,7 +166,10 @@ private let scalarSwift: [String: String] = [
     "fixed32": "UInt32", "fixed64": "UInt64", "sfixed32": "Int32", "sfixed64": "Int64",
     "bool": "Bool", "string": "String", "bytes": "[UInt8]",
 ]
-enum Wire { case varint, zigzag, fixed32, fixed64, lengthString, lengthBytes, message, enumVarint, unresolved }
+
+/// A resolved field type: a scalar with its `IWAField.Kind` name (the proto scalar
+/// type; `int32` for enums), a generated message, or a type we don't model.
+enum FieldType { case scalar(swift: String, kind: String), message(String), unresolved }
 
 private func swiftTypeName(_ fqn: String) -> String { fqn.replacingOccurrences(of: ".", with: "_") }
 
@@ -211,25 +216,14 @@ for file in protoFiles {
 
 let messageFQNs = Set(allMessages.map(\.fqn))
 
-// Resolve a field's type token (in a message's scope) to (swiftType, wire, isRepeatedElementScalar).
-func resolve(_ type: String, scopeFQN: String) -> (swift: String, wire: Wire) {
-    if let s = scalarSwift[type] {
-        switch type {
-        case "double": return (s, .fixed64)
-        case "float": return (s, .fixed32)
-        case "fixed64", "sfixed64": return (s, .fixed64)
-        case "fixed32", "sfixed32": return (s, .fixed32)
-        case "sint32", "sint64": return (s, .zigzag)
-        case "string": return (s, .lengthString)
-        case "bytes": return (s, .lengthBytes)
-        default: return (s, .varint)                       // int32/64, uint32/64, bool
-        }
-    }
+// Resolve a field's type token (in a message's scope) to its Swift type and schema kind.
+func resolve(_ type: String, scopeFQN: String) -> FieldType {
+    if let s = scalarSwift[type] { return .scalar(swift: s, kind: type) }
     // Resolve message/enum reference: absolute (leading dot) first, then walk scope outward.
     let normalized = type.hasPrefix(".") ? String(type.dropFirst()) : type
-    func lookup(_ candidate: String) -> (String, Wire)? {
-        if messageFQNs.contains(candidate) { return (swiftTypeName(candidate), .message) }
-        if enumFQNs.contains(candidate) { return ("Int32", .enumVarint) }
+    func lookup(_ candidate: String) -> FieldType? {
+        if messageFQNs.contains(candidate) { return .message(swiftTypeName(candidate)) }
+        if enumFQNs.contains(candidate) { return .scalar(swift: "Int32", kind: "int32") }
         return nil
     }
     if let hit = lookup(normalized) { return hit }
@@ -240,172 +234,72 @@ func resolve(_ type: String, scopeFQN: String) -> (swift: String, wire: Wire) {
             scope.removeLast()
         }
     }
-    return ("", .unresolved)                               // type from an un-vendored archive (or an
+    return .unresolved                                      // type from an un-vendored archive (or an
                                                             // enum we don't have) → not modeled as a typed
                                                             // field; preserved verbatim via unknownFields so
                                                             // any wire type round-trips losslessly.
 }
 
-// Emit support runtime once.
-let support = """
-// Generated by Scripts/GenerateIWAModels.swift — do not edit.
-import Foundation
-
-/// Common interface for every generated iWork archive model: decode from a
-/// `ProtobufMessage`, re-encode, and expose the fields it didn't model. Enables the
-/// reflective `IWACatalog` (used to derive type-number bindings by best-fit).
-protocol IWAMessage {
-    init(_ message: ProtobufMessage)
-    func encoded() -> [UInt8]
-    var unknownFields: [ProtobufField] { get }
-}
-
-/// Wire helpers shared by the generated iWork archive models.
-enum IWAWire {
-    static func u32(_ b: [UInt8]) -> UInt32 {
-        b.count >= 4 ? UInt32(b[0]) | UInt32(b[1]) << 8 | UInt32(b[2]) << 16 | UInt32(b[3]) << 24 : 0
-    }
-    static func u64(_ b: [UInt8]) -> UInt64 {
-        guard b.count >= 8 else { return 0 }
-        var v: UInt64 = 0; for k in 0..<8 { v |= UInt64(b[k]) << (8 * k) }; return v
-    }
-    static func unzigzag32(_ v: UInt64) -> Int32 {
-        let u = UInt32(truncatingIfNeeded: v); return Int32(bitPattern: (u >> 1) ^ (~(u & 1) &+ 1))
-    }
-    static func unzigzag64(_ v: UInt64) -> Int64 {
-        Int64(bitPattern: (v >> 1) ^ (~(v & 1) &+ 1))
-    }
-    static func zigzag32(_ n: Int32) -> UInt64 {
-        UInt64(UInt32(bitPattern: (n << 1) ^ (n >> 31)))
-    }
-    static func zigzag64(_ n: Int64) -> UInt64 {
-        UInt64(bitPattern: (n << 1) ^ (n >> 63))
-    }
-    static func unpackVarints(_ b: [UInt8]) -> [UInt64] {
-        var out = [UInt64](); var pos = 0
-        while pos < b.count {
-            var shift: UInt64 = 0, value: UInt64 = 0
-            while pos < b.count { let byte = b[pos]; pos += 1; value |= UInt64(byte & 0x7F) << shift; if byte & 0x80 == 0 { break }; shift += 7 }
-            out.append(value)
+/// Lays `entries` out comma-terminated, as many per line as fit in `limit` columns.
+func wrapped(_ entries: [String], indent: String, limit: Int = 120) -> [String] {
+    var lines = [String](), current = ""
+    for entry in entries {
+        let piece = entry + ","
+        if !current.isEmpty && indent.count + current.count + 1 + piece.count > limit {
+            lines.append(indent + current)
+            current = piece
+        } else {
+            current = current.isEmpty ? piece : current + " " + piece
         }
-        return out
     }
+    if !current.isEmpty { lines.append(indent + current) }
+    return lines
 }
-"""
-try support.write(to: outDir.appendingPathComponent("IWAWire.swift"), atomically: true, encoding: .utf8)
 
-// Per-message emission. Locals are underscore-prefixed (`_pb`,`_f`,`_v`,`_w`,`_x`,`_u`)
-// so they can never collide with a generated property name (proto field → camelCase,
-// which never starts with an underscore). Messages are reference types so self- and
-// mutually-recursive schemas (e.g. number-format conditions) have finite size.
+// Per-message emission: a field table plus one accessor per modeled field. Slot `i` of
+// `_values` is the schema's `i`-th field; all wire work happens in `IWACodec`. Messages
+// are reference types so self- and mutually-recursive schemas (e.g. number-format
+// conditions) have finite size.
 func emitMessage(_ msg: ProtoMessage) -> String {
     let typeName = swiftTypeName(msg.fqn)
-    var props = [String]()
-    var decodeCases = [String]()
-    var encodeLines = [String]()
+    var entries = [String]()
+    var accessors = [String]()
 
     for f in msg.fields {
-        let (swift, wire) = resolve(f.type, scopeFQN: msg.fqn)
-        if wire == .unresolved { continue }   // leave to unknownFields — lossless, any wire type
         let prop = camel(f.name)
         let repeated = f.label == "repeated"
-
-        props.append(repeated ? "    var \(prop): [\(swift)] = []" : "    var \(prop): \(swift)?")
-
-        let read: String
-        switch wire {
-        case .varint:       read = swift == "Bool" ? "if case .varint(let _u) = _f.value { _v = _u != 0 }" : "if case .varint(let _u) = _f.value { _v = \(swift)(truncatingIfNeeded: _u) }"
-        case .enumVarint:   read = "if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }"
-        case .zigzag:       read = "if case .varint(let _u) = _f.value { _v = IWAWire.unzigzag\(swift == "Int32" ? "32" : "64")(_u) }"
-        case .fixed32:      read = swift == "Float" ? "if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }" : (swift == "Int32" ? "if case .fixed32(let _b) = _f.value { _v = Int32(bitPattern: IWAWire.u32(_b)) }" : "if case .fixed32(let _b) = _f.value { _v = IWAWire.u32(_b) }")
-        case .fixed64:      read = swift == "Double" ? "if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }" : (swift == "Int64" ? "if case .fixed64(let _b) = _f.value { _v = Int64(bitPattern: IWAWire.u64(_b)) }" : "if case .fixed64(let _b) = _f.value { _v = IWAWire.u64(_b) }")
-        case .lengthString: read = "if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }"
-        case .lengthBytes:  read = "if case .lengthDelimited(let _b) = _f.value { _v = _b }"
-        case .message:      read = "if case .lengthDelimited(let _b) = _f.value { _v = \(swift)(ProtobufMessage(_b)) }"
-        case .unresolved:   read = ""   // unreachable (skipped above), present for exhaustiveness
-        }
-
-        if repeated && (wire == .varint || wire == .enumVarint || wire == .zigzag) {
-            decodeCases.append("""
-                    case \(f.number):
-                        if case .varint(let _u) = _f.value { \(prop).append(\(scalarFromVarint(swift, wire))) }
-                        else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { \(prop).append(\(scalarFromVarint(swift, wire))) } }
-            """)
-        } else if repeated {
-            decodeCases.append("""
-                    case \(f.number):
-                        var _v: \(swift)?
-                        \(read)
-                        if let _v { \(prop).append(_v) }
-            """)
-        } else {
-            decodeCases.append("""
-                    case \(f.number):
-                        var _v: \(swift)?
-                        \(read)
-                        if let _v { \(prop) = _v }
-            """)
-        }
-
-        if repeated && f.packed && (wire == .varint || wire == .enumVarint || wire == .zigzag) {
-            let mapped: String
-            switch wire {
-            case .zigzag: mapped = swift == "Int32" ? "IWAWire.zigzag32($0)" : "IWAWire.zigzag64($0)"
-            default:      mapped = swift == "Bool" ? "($0 ? 1 : 0)" : "UInt64(truncatingIfNeeded: $0)"
+        let slot = entries.count
+        switch resolve(f.type, scopeFQN: msg.fqn) {
+        case .unresolved:
+            continue                                        // leave to unknownFields — lossless, any wire type
+        case .message(let swift):
+            entries.append(".\(repeated ? "repeated" : "optional")(\(f.number), \(swift).self)")
+            accessors.append(repeated
+                ? "    var \(prop): [\(swift)] { get { self[messages: \(slot)] } set { self[messages: \(slot)] = newValue } }"
+                : "    var \(prop): \(swift)? { get { self[message: \(slot)] } set { self[message: \(slot)] = newValue } }")
+            if repeated {
+                accessors.append("    func append(\(prop) value: \(swift)) { append(value, toMessages: \(slot)) }")
             }
-            encodeLines.append("        if !\(prop).isEmpty { _w.packedVarintField(\(f.number), \(prop).map { \(mapped) }) }")
-        } else {
-            let writeOne = encodeStatement(field: f.number, wire: wire, swift: swift, valueExpr: "_x")
-            encodeLines.append(repeated ? "        for _x in \(prop) { \(writeOne) }" : "        if let _x = \(prop) { \(writeOne) }")
-        }
-    }
-
-    let cases = decodeCases.joined(separator: "\n")
-    let encode = encodeLines.joined(separator: "\n")
-    return """
-    /// Generated wire model for `\(msg.fqn)`.
-    final class \(typeName): IWAMessage {
-    \(props.joined(separator: "\n"))
-        /// Fields not modeled above, preserved verbatim for lossless round-trip.
-        var unknownFields: [ProtobufField] = []
-
-        init() {}
-        init(_ _pb: ProtobufMessage) {
-            for _f in _pb.fields {
-                switch _f.number {
-    \(cases.isEmpty ? "" : cases + "\n")                default: unknownFields.append(_f)
-                }
+        case .scalar(let swift, let kind):
+            if repeated {
+                entries.append(".repeated(\(f.number), .\(kind)\(f.packed ? ", packed: true" : ""))")
+                accessors.append("    var \(prop): [\(swift)] { get { self[all: \(slot)] } set { self[all: \(slot)] = newValue } }")
+                accessors.append("    func append(\(prop) value: \(swift)) { append(value, toAll: \(slot)) }")
+            } else {
+                entries.append(".optional(\(f.number), .\(kind))")
+                accessors.append("    var \(prop): \(swift)? { get { self[\(slot)] } set { self[\(slot)] = newValue } }")
             }
         }
-        func encoded() -> [UInt8] {
-            var _w = ProtobufWriter()
-    \(encode)
-            for _f in unknownFields { _w.append(_f) }
-            return _w.bytes
-        }
     }
-    """
-}
 
-func scalarFromVarint(_ swift: String, _ wire: Wire) -> String {
-    switch wire {
-    case .zigzag: return swift == "Int32" ? "IWAWire.unzigzag32(_u)" : "IWAWire.unzigzag64(_u)"
-    default: return swift == "Bool" ? "(_u != 0)" : "\(swift)(truncatingIfNeeded: _u)"
-    }
-}
-
-func encodeStatement(field: Int, wire: Wire, swift: String, valueExpr x: String) -> String {
-    switch wire {
-    case .varint:       return swift == "Bool" ? "_w.varintField(\(field), \(x) ? 1 : 0)" : "_w.varintField(\(field), UInt64(truncatingIfNeeded: \(x)))"
-    case .enumVarint:   return "_w.varintField(\(field), UInt64(truncatingIfNeeded: \(x)))"
-    case .zigzag:       return swift == "Int32" ? "_w.varintField(\(field), IWAWire.zigzag32(\(x)))" : "_w.varintField(\(field), IWAWire.zigzag64(\(x)))"
-    case .fixed32:      return swift == "Float" ? "_w.fixed32Field(\(field), \(x).bitPattern)" : (swift == "Int32" ? "_w.fixed32Field(\(field), UInt32(bitPattern: \(x)))" : "_w.fixed32Field(\(field), \(x))")
-    case .fixed64:      return swift == "Double" ? "_w.fixed64Field(\(field), \(x).bitPattern)" : (swift == "Int64" ? "_w.fixed64Field(\(field), UInt64(bitPattern: \(x)))" : "_w.fixed64Field(\(field), \(x))")
-    case .lengthString: return "_w.stringField(\(field), \(x))"
-    case .lengthBytes:  return "_w.bytesField(\(field), \(x))"
-    case .message:      return "_w.bytesField(\(field), \(x).encoded())"
-    case .unresolved:   return ""   // unreachable (skipped above)
-    }
+    let schema = entries.isEmpty
+        ? "    static let schema = IWASchema(\"\(msg.fqn)\", [])"
+        : "    static let schema = IWASchema(\"\(msg.fqn)\", [\n" + wrapped(entries, indent: "        ").joined(separator: "\n") + "\n    ])"
+    var out = "/// Generated wire model for `\(msg.fqn)`.\nfinal class \(typeName): IWAMessage {\n\(schema)\n"
+    out += "    var _values = [IWAValue](repeating: .absent, count: \(entries.count))\n"
+    out += "    var unknownFields: [ProtobufField] = []\n    init() {}\n"
+    if !accessors.isEmpty { out += "\n" + accessors.joined(separator: "\n") + "\n" }
+    return out + "}"
 }
 
 func identifier(_ s: String) -> String { String(s.map { $0.isLetter || $0.isNumber ? $0 : "_" }) }
@@ -417,20 +311,21 @@ for file in perFile where !file.messages.isEmpty {
     var out = "// Generated by Scripts/GenerateIWAModels.swift from \(file.name).proto — do not edit.\n\nimport Foundation\nimport SwiftTextIWA\n\n"
     out += file.messages.map(emitMessage).joined(separator: "\n\n")
     out += "\n\n/// Registers this file's archives into the reflective catalog.\n"
-    out += "func \(reg)(_ into: inout [(name: String, decode: (ProtobufMessage) -> IWAMessage)]) {\n"
-    for m in file.messages { out += "    into.append((\"\(m.fqn)\", { \(swiftTypeName(m.fqn))($0) as IWAMessage }))\n" }
-    out += "}\n"
+    out += "func \(reg)(_ into: inout [any IWAMessage.Type]) {\n    into += [\n"
+    out += wrapped(file.messages.map { swiftTypeName($0.fqn) + ".self" }, indent: "        ").joined(separator: "\n")
+    out += "\n    ]\n}\n"
     try out.write(to: outDir.appendingPathComponent("\(file.name).gen.swift"), atomically: true, encoding: .utf8)
     emittedFiles += 1
 }
 
 // Reflective catalog: every generated archive model, for best-fit type-number binding.
 var catalog = "// Generated by Scripts/GenerateIWAModels.swift — do not edit.\n\nimport Foundation\nimport SwiftTextIWA\n\n"
-catalog += "/// Every generated iWork archive model, by proto full name + a decode factory.\n"
-catalog += "/// Lets a binder match an unknown object's type number to its best-fit message.\n"
+catalog += "/// Every generated iWork archive model. Each carries its proto full name and\n"
+catalog += "/// field table (`schema`), which a binder matches against an unknown object's\n"
+catalog += "/// wire fields to find its type number's best-fit message.\n"
 catalog += "enum IWACatalog {\n"
-catalog += "    static func all() -> [(name: String, decode: (ProtobufMessage) -> IWAMessage)] {\n"
-catalog += "        var a = [(name: String, decode: (ProtobufMessage) -> IWAMessage)]()\n"
+catalog += "    static func all() -> [any IWAMessage.Type] {\n"
+catalog += "        var a = [any IWAMessage.Type]()\n"
 for reg in registrars { catalog += "        \(reg)(&a)\n" }
 catalog += "        return a\n    }\n}\n"
 try catalog.write(to: outDir.appendingPathComponent("IWACatalog.gen.swift"), atomically: true, encoding: .utf8)
@@ -439,8 +334,8 @@ try catalog.write(to: outDir.appendingPathComponent("IWACatalog.gen.swift"), ato
 // emit; types pointing into un-vendored archives are left out → raw passthrough).
 let mappingURL = inDir.appendingPathComponent("mapping.py")
 if let mapping = try? String(contentsOf: mappingURL, encoding: .utf8) {
-    var cases = [String]()
-    var decodeCases = [String]()
+    var modelCases = [String]()
+    var modeled = [Int]()
     var nameCases = [String]()
     var seen = 0
     for line in mapping.split(separator: "\n") {
@@ -453,37 +348,39 @@ if let mapping = try? String(contentsOf: mappingURL, encoding: .utf8) {
         seen += 1
         nameCases.append("        case \(number): return \"\(fqn)\"")
         if messageFQNs.contains(fqn) {
-            cases.append("        case \(number): return \(swiftTypeName(fqn))(m).encoded()")
-            decodeCases.append("        case \(number): return \(swiftTypeName(fqn))(m)")
+            modelCases.append("        case \(number): return \(swiftTypeName(fqn)).self")
+            modeled.append(number)
         }
     }
     let registry = """
     // Generated by Scripts/GenerateIWAModels.swift from mapping.py — do not edit.
     import Foundation
+    import SwiftTextIWA
 
     /// Maps IWA persistence type numbers to the generated wire models, so any object
     /// can be decoded into its typed form and re-encoded. Types whose message lives in
     /// an un-vendored archive (TSCE/TSCK/charts/Keynote) are absent — callers treat a
     /// `nil` result as "pass the original bytes through unchanged".
     enum IWATypeRegistry {
-        /// Round-trips a known object payload through its typed model (decode → encode).
-        /// Returns nil for types this build does not model.
-        static func reencode(type: UInt64, payload: [UInt8]) -> [UInt8]? {
-            let m = ProtobufMessage(payload)
+        /// The generated model for an IWA type number. Returns nil for types this build
+        /// does not model.
+        static func model(for type: UInt64) -> (any IWAMessage.Type)? {
             switch type {
-    \(cases.joined(separator: "\n"))
+    \(modelCases.joined(separator: "\n"))
             default: return nil
             }
         }
 
+        /// Round-trips a known object payload through its typed model (decode → encode).
+        /// Returns nil for types this build does not model.
+        static func reencode(type: UInt64, payload: [UInt8]) -> [UInt8]? {
+            decode(type: type, payload: payload)?.encoded()
+        }
+
         /// Decodes a known object payload into its typed model. Returns nil for types
         /// this build does not model (the caller keeps the raw bytes).
-        static func decode(type: UInt64, payload: [UInt8]) -> IWAMessage? {
-            let m = ProtobufMessage(payload)
-            switch type {
-    \(decodeCases.joined(separator: "\n"))
-            default: return nil
-            }
+        static func decode(type: UInt64, payload: [UInt8]) -> (any IWAMessage)? {
+            model(for: type).map { IWACodec.decode(ProtobufMessage(payload), as: $0) }
         }
 
         /// The fully-qualified persistence name (e.g. "TST.TableModelArchive") for an
@@ -497,11 +394,12 @@ if let mapping = try? String(contentsOf: mappingURL, encoding: .utf8) {
         }
 
         /// The set of IWA type numbers this build can decode into a typed model.
-        static let modeledTypes: Set<UInt64> = [\(cases.map { $0.split(separator: " ").compactMap { Int($0.replacingOccurrences(of: ":", with: "")) }.first }.compactMap { $0 }.map(String.init).joined(separator: ", "))]
+        static let modeledTypes: Set<UInt64> = [\(modeled.map(String.init).joined(separator: ", "))]
     }
+
     """
     try registry.write(to: outDir.appendingPathComponent("IWATypeRegistry.swift"), atomically: true, encoding: .utf8)
-    print("Type registry: \(cases.count) modeled of \(seen) total type numbers")
+    print("Type registry: \(modelCases.count) modeled of \(seen) total type numbers")
 }
 
 print("Generated \(allMessages.count) messages (\(enumFQNs.count) enums) into \(emittedFiles) files at \(outDir.path)")
@@ -74,13 +74,15 @@ func idSet(_ dir: String) -> Set<UInt64> {
 let blankIDs = idSet(blankDir)
 
 // 2. capture delta records, grouped by file (relative path under the package)
-struct Captured { var file: String; var id: UInt64; var type: UInt64; var base64: String }
+struct Captured { var file: String; var id: UInt64; var type: UInt64; var range: Range<Int> }
 var captured = [Captured]()
+var blob = [UInt8]()
 func capture(_ sub: String) {
     let base = tableDir + "/" + sub
     for f in (try? fm.contentsOfDirectory(atPath: base).sorted()) ?? [] where f.hasSuffix(".iwa") {
         for r in parseRecords(defile(read(base + "/" + f))) where !blankIDs.contains(r.id) {
-            captured.append(Captured(file: sub + "/" + f, id: r.id, type: r.type, base64: Data(r.bytes).base64EncodedString()))
+            captured.append(Captured(file: sub + "/" + f, id: r.id, type: r.type, range: blob.count..<blob.count + r.bytes.count))
+            blob.append(contentsOf: r.bytes)
         }
     }
 }
@@ -88,34 +90,27 @@ capture("Index"); capture("Index/Tables")
 
 // 3. the table document's Metadata.iwa (PackageMetadata + the shared-object map),
 //    used wholesale for table documents (component layout matches after injection).
-let metadataBase64 = Data(read(tableDir + "/Index/Metadata.iwa")).base64EncodedString()
-
-func chunked(_ s: String, _ n: Int = 120) -> String {
-    var out = ""; var i = s.startIndex
-    while i < s.endIndex { let j = s.index(i, offsetBy: n, limitedBy: s.endIndex) ?? s.endIndex; out += "\t\t\"" + s[i..<j] + "\" +\n"; i = j }
-    return out + "\t\t\"\""
-}
+let metadata = read(tableDir + "/Index/Metadata.iwa")
+let metadataRange = blob.count..<blob.count + metadata.count
+blob.append(contentsOf: metadata)
 
 // 4. emit Swift
 print("// swift-format-ignore-file")
 print("// Generated by Scripts/GeneratePagesTableTemplate.swift — do not edit by hand.")
 print("// The native-table object set captured from a single-table .pages, minus the")
 print("// blank template's objects. Records are verbatim (length-prefixed ArchiveInfo +")
-print("// payload) so MessageInfo.object_references survive injection.")
-print("import Foundation\n")
+print("// payload) so MessageInfo.object_references survive injection; each is a range")
+print("// of `bytes`.\n")
 print("enum PagesTableTemplate {")
-print("\tstruct Record { let file: String; let id: UInt64; let type: UInt64; let base64: String }")
+print("\tstruct Record { let file: String; let id: UInt64; let type: UInt64; let range: Range<Int> }")
 print("\t/// Every object present in the captured table document but not the blank template.")
 print("\tstatic let records: [Record] = [")
 for c in captured {
-    print("\t\tRecord(file: \"\(c.file)\", id: \(c.id), type: \(c.type), base64:")
-    print(chunked(c.base64))
-    print("\t\t),")
+    print("\t\tRecord(file: \"\(c.file)\", id: \(c.id), type: \(c.type), range: \(c.range.lowerBound)..<\(c.range.upperBound)),")
 }
 print("\t]")
 print("\t/// The table document's `Index/Metadata.iwa` (PackageMetadata), used for table docs.")
-print("\tstatic let metadataBase64: String =")
-print(chunked(metadataBase64))
+print("\tstatic let metadataRange = \(metadataRange.lowerBound)..<\(metadataRange.upperBound)")
 print("")
 // dimension-object ids (stable for the captured table)
 print("\t// Identifiers of the regenerated, dimension-dependent objects (captured table).")
@@ -131,4 +126,11 @@ print("\tstatic let bodyStorageID: UInt64 = 1732539")
 let maxID = captured.map { $0.id }.max() ?? 0
 print("\t/// Highest captured object id (for the package id high-water mark).")
 print("\tstatic let maxObjectID: UInt64 = \(maxID)")
+print("")
+print("\t/// The captured records followed by the metadata file.")
+print("\tstatic let bytes: [UInt8] = [")
+for start in stride(from: 0, to: blob.count, by: 16) {
+    print("\t\t" + blob[start..<min(start + 16, blob.count)].map { "0x" + String(format: "%02X", $0) }.joined(separator: ", ") + ",")
+}
+print("\t]")
 print("}")
@@ -4,9 +4,10 @@ import Foundation
 // Generates a committed Swift "code version" of a Pages template package.
 //
 // Reads a .pages document (a Zip) and emits a Swift source file that embeds every
-// package entry as base64 — so `SwiftTextPages` can write documents from scratch
-// with nothing bundled at runtime. Reusable for other themes: point it at a
-// different template and give it another name.
+// package entry in one byte array with a path → range index — so `SwiftTextPages`
+// can write documents from scratch with nothing bundled or decoded at runtime.
+// Reusable for other themes: point it at a different template and give it
+// another name.
 //
 //   swift Scripts/GeneratePagesTemplate.swift <input.pages> <TemplateName> <output.swift>
 //
@@ -46,37 +47,42 @@ let listing = String(decoding: run("/usr/bin/unzip", ["-Z1", inputPath]), as: UT
 let paths = listing.split(separator: "\n").map(String.init).filter { !$0.isEmpty && !$0.hasSuffix("/") }
 guard !paths.isEmpty else { fail("no entries found in \(inputPath)") }
 
-// Emit Swift. Each entry's base64 is chunked across lines to keep the source
-// readable and the parser happy with very long literals.
+// Concatenate the entries into one blob, remembering each one's byte range.
+var blob = [UInt8]()
+var ranges = [(path: String, range: Range<Int>)]()
+for path in paths {
+	let bytes = [UInt8](run("/usr/bin/unzip", ["-p", inputPath, path]))
+	ranges.append((path, blob.count..<blob.count + bytes.count))
+	blob.append(contentsOf: bytes)
+}
+
+let bytesName = "\(templateName)TemplateBytes"
 var out = """
 // Generated by Scripts/GeneratePagesTemplate.swift — DO NOT EDIT.
 // Source template: \(URL(fileURLWithPath: inputPath).lastPathComponent)
 //
-// Embeds every package entry of a blank Pages document as base64 so the writer can
-// assemble a valid .pages from scratch with no bundled resource.
+// Embeds every package entry of a blank Pages document in one byte array, indexed
+// by path, so the writer can assemble a valid .pages from scratch with no bundled
+// resource and nothing to decode at runtime.
 
 extension PagesTemplate {
 \t/// The built-in "\(templateName)" Pages template, captured from a default document.
 \tstatic let \(templateName) = PagesTemplate(entries: [
 
 """
-
-for path in paths {
-	let bytes = run("/usr/bin/unzip", ["-p", inputPath, path])
-	let base64 = bytes.base64EncodedString()
-	// Split into ~120-char chunks concatenated with + so no single literal is huge.
-	var chunks = [String]()
-	var index = base64.startIndex
-	while index < base64.endIndex {
-		let end = base64.index(index, offsetBy: 16_000, limitedBy: base64.endIndex) ?? base64.endIndex
-		chunks.append(String(base64[index..<end]))
-		index = end
-	}
-	let literal = chunks.map { "\"\($0)\"" }.joined(separator: "\n\t\t\t+ ")
-	out += "\t\tEntry(path: \"\(path)\", base64: \(literal)),\n"
+for entry in ranges {
+	out += "\t\tEntry(path: \"\(entry.path)\", range: \(entry.range.lowerBound)..<\(entry.range.upperBound)),\n"
 }
+out += "\t], bytes: \(bytesName))\n}\n\n"
 
-out += "\t])\n}\n"
+// The bytes as a typed array literal, 16 per line; the compiler lays it out as
+// constant data.
+out += "private let \(bytesName): [UInt8] = [\n"
+for start in stride(from: 0, to: blob.count, by: 16) {
+	let line = blob[start..<min(start + 16, blob.count)].map { "0x" + String(format: "%02X", $0) }
+	out += "\t" + line.joined(separator: ", ") + ",\n"
+}
+out += "]\n"
 
 do {
 	try FileManager.default.createDirectory(
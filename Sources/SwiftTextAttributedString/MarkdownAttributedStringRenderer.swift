@@ -23,6 +23,12 @@ import SwiftTextMarkdown
 /// the package's HTML/DOCX/Pages paths), so it covers the full GFM superset:
 /// tables with alignment, strikethrough, task lists, and — via the custom scope
 /// — `[^id]` footnotes, GitHub/DocC alerts, and image sources.
+///
+/// The AST is first flattened into plain text and a table of runs, each a
+/// length and an index into the distinct attribute sets seen; adjacent runs
+/// with the same attributes are merged as they are recorded. The
+/// `AttributedString` is then built from the whole text in one go, with one
+/// attribute assignment per run, rather than grown by many small appends.
 @available(macOS 12, iOS 15, tvOS 15, watchOS 8, *)
 public enum MarkdownAttributedStringRenderer {
 
@@ -40,26 +46,37 @@ public enum MarkdownAttributedStringRenderer {
 	/// Converts Markdown to an `AttributedString`, expanding `[^id]` footnote
 	/// references and appending a definitions block for `[^id]: …` definitions.
 	public static func convert(_ markdown: String, options: Options = []) -> AttributedString {
+		build(markdown, options: options).result
+	}
+
+	/// Renders Markdown for display one top-level block at a time: the text and
+	/// runs of the whole document are laid down now, and each block's
+	/// `AttributedString` is built only when it is accessed.
+	public static func convertLazily(_ markdown: String, options: Options = []) -> LazyBlocks {
+		LazyBlocks(build(markdown, options: options))
+	}
+
+	private static func build(_ markdown: String, options: Options) -> Builder {
 		let (cleaned, definitions) = MarkdownFootnoteParser.extractDefinitions(from: markdown)
 
 		let parseOptions: ParseOptions = options.contains(.preserveSmartPunctuation) ? [] : [.disableSmartOpts]
 
 		guard !definitions.isEmpty else {
 			let builder = Builder(options: options, resolver: nil)
-			builder.emitBlocks(Document(parsing: cleaned, options: parseOptions).children, EmitContext())
-			return builder.result
+			builder.emitTopLevelBlocks(Document(parsing: cleaned, options: parseOptions).children)
+			return builder
 		}
 
 		let resolver = MarkdownFootnoteResolver(definitionIDs: definitions.map(\.id))
 		let builder = Builder(options: options, resolver: resolver)
 
 		// Body first so footnote numbers are assigned in source order.
-		builder.emitBlocks(Document(parsing: cleaned, options: parseOptions).children, EmitContext())
+		builder.emitTopLevelBlocks(Document(parsing: cleaned, options: parseOptions).children)
 		// Then the trailing definitions block (resolves references nested in
 		// definition bodies too).
 		builder.emitFootnoteDefinitions(definitions)
 
-		return builder.result
+		return builder
 	}
 
 	/// Renders an already-parsed `Document` (no footnote extraction — use
@@ -69,6 +86,30 @@ public enum MarkdownAttributedStringRenderer {
 		builder.emitBlocks(document.children, EmitContext())
 		return builder.result
 	}
+
+	/// A rendered document whose top-level blocks — and each footnote
+	/// definition — are materialized as `AttributedString`s on access, for
+	/// virtualized lists that show one block per row.
+	///
+	/// Identities and footnote numbers are assigned across the whole document
+	/// up front, so the blocks joined in order equal ``convert(_:options:)``'s
+	/// result. Every access builds a new string; keep the ones on display.
+	public struct LazyBlocks: RandomAccessCollection {
+		private let builder: Builder
+		private let ranges: [Range<Int>]
+
+		fileprivate init(_ builder: Builder) {
+			self.builder = builder
+			self.ranges = builder.blockRunRanges()
+		}
+
+		public var startIndex: Int { ranges.startIndex }
+		public var endIndex: Int { ranges.endIndex }
+
+		public subscript(position: Int) -> AttributedString {
+			builder.materialize(ranges[position])
+		}
+	}
 }
 
 // MARK: - Convenience initializers
@@ -111,11 +152,40 @@ private struct InlineStyleAccumulator {
 	var link: URL?
 }
 
+/// Everything that decides a run's attributes. Each distinct value becomes one
+/// `AttributeContainer` (and native intent) however many runs share it.
+private struct RunAttributes: Hashable {
+	var block: [MarkdownBlock.Component]?
+	var style: MarkdownInlineStyle
+	var link: URL?
+	var alert: MarkdownAlert?
+	var footnoteDefinition: Int?
+	var checkbox: MarkdownCheckbox?
+	var footnoteReference: Int?
+	var imageSource: String?
+}
+
+/// A stretch of the builder's text that shares one attribute set.
+private struct TextRun {
+	let utf8Start: Int
+	var utf8Count: Int
+	var scalarCount: Int
+	let attributes: Int
+}
+
 // MARK: - Builder
 
 @available(macOS 12, iOS 15, tvOS 15, watchOS 8, *)
 private final class Builder {
-	private(set) var result = AttributedString()
+	/// The document's text, with runs as byte ranges into it.
+	private var text = ""
+	private var runs: [TextRun] = []
+	/// Attribute sets by index, and the index of each set.
+	private var containers: [AttributeContainer] = []
+	private var containerIndices: [RunAttributes: Int] = [:]
+	/// The first run of each top-level block. Runs never merge across one, so
+	/// a block can be materialized on its own.
+	private var blockStarts: [Int] = []
 	private var nextIdentity = 1
 	private let options: MarkdownAttributedStringRenderer.Options
 	private let resolver: MarkdownFootnoteResolver?
@@ -138,6 +208,17 @@ private final class Builder {
 
 	// MARK: Block emission
 
+	func emitTopLevelBlocks(_ children: some Sequence<Markup>) {
+		for child in children {
+			beginTopLevelBlock()
+			emitBlock(child, EmitContext())
+		}
+	}
+
+	private func beginTopLevelBlock() {
+		if blockStarts.last != runs.count { blockStarts.append(runs.count) }
+	}
+
 	func emitBlocks(_ children: some Sequence<Markup>, _ context: EmitContext) {
 		for child in children { emitBlock(child, context) }
 	}
@@ -254,43 +335,18 @@ private final class Builder {
 
 	// MARK: Footnote definitions
 
-	/// Emits the trailing footnote-definitions block. Each referenced definition
-	/// is rendered **during** the scan, so a reference nested inside a definition
-	/// body is recorded and its own definition picked up by a later pass (a
-	/// definition queued without walking its body would orphan such references).
-	/// Fragments are built in isolation — keeping block identities globally
-	/// unique via the shared counter — then appended in footnote-number order.
+	/// Emits the trailing footnote-definitions block. Definitions come in
+	/// footnote-number order and each is walked once; walking a body records
+	/// the references nested in it, which queues their definitions for later
+	/// in the same pass.
 	func emitFootnoteDefinitions(_ definitions: [MarkdownFootnoteParser.Definition]) {
 		guard let resolver else { return }
-		var fragmentsByNumber: [Int: AttributedString] = [:]
-		var renderedIDs = Set<String>()
-		var renderedNew = true
-		while renderedNew {
-			renderedNew = false
-			for definition in definitions where !renderedIDs.contains(definition.id) {
-				guard let number = resolver.number(forID: definition.id) else { continue }
-				fragmentsByNumber[number] = footnoteDefinitionFragment(definition.body, number: number)
-				renderedIDs.insert(definition.id)
-				renderedNew = true
-			}
-		}
-		for (_, fragment) in fragmentsByNumber.sorted(by: { $0.key < $1.key }) {
-			result.append(fragment)
+		resolver.forEachReferencedDefinition(in: definitions) { number, definition in
+			beginTopLevelBlock()
+			emitFootnoteDefinition(definition.body, number: number)
 		}
 	}
 
-	/// Renders one definition body into an isolated fragment so it can be
-	/// reordered, while still advancing the shared identity counter and recording
-	/// any references nested in the body via the resolver.
-	private func footnoteDefinitionFragment(_ body: String, number: Int) -> AttributedString {
-		let saved = result
-		result = AttributedString()
-		emitFootnoteDefinition(body, number: number)
-		let fragment = result
-		result = saved
-		return fragment
-	}
-
 	private func emitFootnoteDefinition(_ body: String, number: Int) {
 		var context = EmitContext()
 		context.footnoteDefinition = number
@@ -405,27 +461,84 @@ private final class Builder {
 		imageSource: String? = nil
 	) {
 		guard !text.isEmpty else { return }
+		let attributes = RunAttributes(
+			block: block, style: style, link: link, alert: context.alert,
+			footnoteDefinition: context.footnoteDefinition, checkbox: context.checkbox,
+			footnoteReference: footnoteReference, imageSource: imageSource)
+		let index = containerIndex(for: attributes)
+
+		let utf8Count = text.utf8.count
+		let scalarCount = text.unicodeScalars.count
+		if let last = runs.indices.last, runs[last].attributes == index, last >= blockStarts.last ?? 0 {
+			runs[last].utf8Count += utf8Count
+			runs[last].scalarCount += scalarCount
+		} else {
+			runs.append(TextRun(utf8Start: self.text.utf8.count, utf8Count: utf8Count, scalarCount: scalarCount, attributes: index))
+		}
+		self.text += text
+	}
+
+	private func containerIndex(for attributes: RunAttributes) -> Int {
+		if let index = containerIndices[attributes] { return index }
 		var container = AttributeContainer()
 
 		// Portable custom attributes — set on every platform.
-		if let block { container[SwiftTextMarkdownAttributes.Block.self] = MarkdownBlock(components: block) }
-		if !style.isEmpty { container[SwiftTextMarkdownAttributes.InlineStyle.self] = style }
-		if let link { container.link = link }
-		if let alert = context.alert { container[SwiftTextMarkdownAttributes.Alert.self] = alert }
-		if let definition = context.footnoteDefinition {
+		if let block = attributes.block { container[SwiftTextMarkdownAttributes.Block.self] = MarkdownBlock(components: block) }
+		if !attributes.style.isEmpty { container[SwiftTextMarkdownAttributes.InlineStyle.self] = attributes.style }
+		if let link = attributes.link { container.link = link }
+		if let alert = attributes.alert { container[SwiftTextMarkdownAttributes.Alert.self] = alert }
+		if let definition = attributes.footnoteDefinition {
 			container[SwiftTextMarkdownAttributes.FootnoteDefinition.self] = definition
 		}
-		if let checkbox = context.checkbox { container[SwiftTextMarkdownAttributes.Checkbox.self] = checkbox }
-		if let footnoteReference { container[SwiftTextMarkdownAttributes.FootnoteReference.self] = footnoteReference }
-		if let imageSource { container[SwiftTextMarkdownAttributes.ImageSource.self] = imageSource }
+		if let checkbox = attributes.checkbox { container[SwiftTextMarkdownAttributes.Checkbox.self] = checkbox }
+		if let reference = attributes.footnoteReference {
+			container[SwiftTextMarkdownAttributes.FootnoteReference.self] = reference
+		}
+		if let imageSource = attributes.imageSource { container[SwiftTextMarkdownAttributes.ImageSource.self] = imageSource }
 
 		// Native Foundation intents — Apple platforms only (absent on Linux/Windows).
 		#if canImport(Darwin)
-		if let block { container.presentationIntent = Builder.nativePresentationIntent(block) }
-		if let native = Builder.nativeInlinePresentationIntent(style) { container.inlinePresentationIntent = native }
+		if let block = attributes.block { container.presentationIntent = Builder.nativePresentationIntent(block) }
+		if let native = Builder.nativeInlinePresentationIntent(attributes.style) { container.inlinePresentationIntent = native }
 		#endif
 
-		result.append(AttributedString(text, attributes: container))
+		containers.append(container)
+		containerIndices[attributes] = containers.count - 1
+		return containers.count - 1
+	}
+
+	// MARK: Materialization
+
+	/// The whole document.
+	var result: AttributedString {
+		materialize(runs.indices)
+	}
+
+	/// The runs of each non-empty top-level block, in order.
+	func blockRunRanges() -> [Range<Int>] {
+		var ranges: [Range<Int>] = []
+		for (index, start) in blockStarts.enumerated() {
+			let end = index + 1 < blockStarts.count ? blockStarts[index + 1] : runs.count
+			if start < end { ranges.append(start ..< end) }
+		}
+		return ranges
+	}
+
+	/// An `AttributedString` of `runs[range]`: their text in one piece, then
+	/// one attribute assignment per run.
+	func materialize(_ range: Range<Int>) -> AttributedString {
+		guard let first = range.first, let last = range.last else { return AttributedString() }
+		let utf8 = text.utf8
+		let lower = utf8.index(utf8.startIndex, offsetBy: runs[first].utf8Start)
+		let upper = utf8.index(utf8.startIndex, offsetBy: runs[last].utf8Start + runs[last].utf8Count)
+		var result = AttributedString(String(text[lower ..< upper]))
+		var cursor = result.startIndex
+		for run in runs[range] {
+			let end = result.unicodeScalars.index(cursor, offsetBy: run.scalarCount)
+			result[cursor ..< end].setAttributes(containers[run.attributes])
+			cursor = end
+		}
+		return result
 	}
 
 	/// Foundation uses U+2E3B (THREE-EM DASH) as a thematic-break placeholder.
@@ -363,9 +363,38 @@ struct PDF: AsyncParsableCommand {
 /// Converts a Markdown string to a self-contained HTML document
 /// styled for print output and with CSS `@page` size directives.
 func markdownToHTML(_ markdown: String, paper: PaperSize, landscape: Bool, pageBreakBefore: HeadingBreakLevel? = nil, extraCSS: String? = nil) -> String {
+	var html = ""
+	writeMarkdownHTML(markdown, paper: paper, landscape: landscape, pageBreakBefore: pageBreakBefore, extraCSS: extraCSS, to: &html)
+	return html
+}
+
+/// Writes the document ``markdownToHTML(_:paper:landscape:pageBreakBefore:extraCSS:)``
+/// returns into `output`, streaming the converted body between the head and
+/// the closing tags.
+func writeMarkdownHTML<Output: TextOutputStream>(_ markdown: String, paper: PaperSize, landscape: Bool, pageBreakBefore: HeadingBreakLevel? = nil, extraCSS: String? = nil, to output: inout Output) {
+	let css = markdownPrintCSS(paper: paper, landscape: landscape, pageBreakBefore: pageBreakBefore, extraCSS: extraCSS)
+	output.write("""
+	<!DOCTYPE html>
+	<html lang="en">
+	<head>
+	<meta charset="utf-8">
+	<meta name="viewport" content="width=device-width, initial-scale=1">
+	<style>
+	\(css)
+	</style>
+	</head>
+	<body>
+
+	""")
+	MarkdownToHTML.write(markdown, to: &output)
+	output.write("\n</body>\n</html>")
+}
+
+/// The print stylesheet of ``markdownToHTML(_:paper:landscape:pageBreakBefore:extraCSS:)``,
+/// also handed to the swift engine when it renders Markdown without HTML.
+func markdownPrintCSS(paper: PaperSize, landscape: Bool, pageBreakBefore: HeadingBreakLevel? = nil, extraCSS: String? = nil) -> String {
 	let orientation = landscape ? "landscape" : "portrait"
 	let pageCSS = "\(paper.cssName) \(orientation)"
-	let body = MarkdownToHTML.convert(markdown)
 	// Optional forced page break before a given heading level (e.g. h2 so each
 	// chapter starts on a new page). Placed after the base heading rules so it
 	// wins on source order; the leading break is ignored by the print engine
@@ -376,12 +405,6 @@ func markdownToHTML(_ markdown: String, paper: PaperSize, landscape: Bool, pageB
 		"""
 	} ?? ""
 	return """
-	<!DOCTYPE html>
-	<html lang="en">
-	<head>
-	<meta charset="utf-8">
-	<meta name="viewport" content="width=device-width, initial-scale=1">
-	<style>
 	@page { size: \(pageCSS); margin: 2cm; }
 	*, *::before, *::after { box-sizing: border-box; }
 	body {
@@ -513,12 +536,6 @@ func markdownToHTML(_ markdown: String, paper: PaperSize, landscape: Bool, pageB
 	.footnote-definition p { margin: 0.4em 0; }
 	\(headingBreakCSS)
 	\(extraCSS.map { "\n/* User stylesheet */\n" + $0 } ?? "")
-	</style>
-	</head>
-	<body>
-	\(body)
-	</body>
-	</html>
 	"""
 }
 
@@ -122,12 +122,18 @@ struct Render: AsyncParsableCommand {
 
 		switch chosenFormat {
 		case .html:
-			let html = markdownToHTML(markdownText, paper: paper, landscape: landscape, pageBreakBefore: pageBreakBefore, extraCSS: userCSS)
-			try writeString(html, to: outputURL)
+			var file = try FileOutputStream(url: outputURL)
+			writeMarkdownHTML(markdownText, paper: paper, landscape: landscape, pageBreakBefore: pageBreakBefore, extraCSS: userCSS, to: &file)
+			try file.close()
 			print(outputURL.path)
 		case .pdf:
-			let html = markdownToHTML(markdownText, paper: paper, landscape: landscape, pageBreakBefore: pageBreakBefore, extraCSS: userCSS)
-			try await renderPDF(html: html, baseURL: baseURL, outputURL: outputURL)
+			if engine == .swift {
+				let css = markdownPrintCSS(paper: paper, landscape: landscape, pageBreakBefore: pageBreakBefore, extraCSS: userCSS)
+				try await renderPDFSwift(markdown: markdownText, css: css, outputURL: outputURL)
+			} else {
+				let html = markdownToHTML(markdownText, paper: paper, landscape: landscape, pageBreakBefore: pageBreakBefore, extraCSS: userCSS)
+				try await renderPDF(html: html, baseURL: baseURL, outputURL: outputURL)
+			}
 			print(outputURL.path)
 		case .docx:
 			try MarkdownToDocx.convert(markdownText, to: outputURL, pageSetup: docxPageSetup(), baseURL: baseURL)
@@ -258,12 +264,6 @@ struct Render: AsyncParsableCommand {
 		return lines.joined()
 	}
 
-	private func writeString(_ s: String, to url: URL) throws {
-		let dir = url.deletingLastPathComponent()
-		try FileManager.default.createDirectory(at: dir, withIntermediateDirectories: true)
-		try s.write(to: url, atomically: true, encoding: .utf8)
-	}
-
 	private func docxPageSetup() -> DocxPageSetup {
 		switch (paper, landscape) {
 		case (.a4, false):     return .a4
@@ -286,10 +286,6 @@ struct Render: AsyncParsableCommand {
 	@MainActor
 	@available(macOS 12.0, *)
 	private func renderPDF(html: String, baseURL: URL?, outputURL: URL) async throws {
-		if engine == .swift {
-			try await renderPDFSwift(html: html, outputURL: outputURL)
-			return
-		}
 		#if os(macOS)
 		// If we have a baseURL (file input), write HTML next to source so local images can load.
 		// Otherwise, render from an HTML string.
@@ -317,16 +313,18 @@ struct Render: AsyncParsableCommand {
 		#endif
 	}
 
-	/// Renders the print HTML to a PDF via the cross-platform SwiftTextRender engine.
+	/// Renders Markdown to a PDF via the cross-platform SwiftTextRender engine,
+	/// styled with the print stylesheet `css`. The engine builds its tree from
+	/// the Markdown AST, so no HTML is produced in between.
 	@available(macOS 12.0, *)
-	private func renderPDFSwift(html: String, outputURL: URL) async throws {
+	private func renderPDFSwift(markdown: String, css: String, outputURL: URL) async throws {
 		let size = paper.pointSize
 		let widthPoints = landscape ? size.height : size.width
 		let heightPoints = landscape ? size.width : size.height
 		var options = RenderOptions()
 		options.pageWidthPx = widthPoints / 0.75 // points → CSS pixels
 		options.pageHeightPx = heightPoints / 0.75
-		let data = try await HTMLRenderer.renderPDF(html: html, options: options)
+		let data = try await HTMLRenderer.renderPDF(markdown: markdown, css: [css], options: options)
 		try writeData(data, to: outputURL)
 	}
 
@@ -336,3 +334,50 @@ struct Render: AsyncParsableCommand {
 		try data.write(to: url)
 	}
 }
+
+// MARK: - Streaming output
+
+/// A `TextOutputStream` that writes UTF-8 to a file in 64 KiB chunks, so HTML
+/// output goes to disk while it is rendered. `TextOutputStream.write` can't
+/// throw; the first I/O error is kept and rethrown by ``close()``.
+struct FileOutputStream: TextOutputStream {
+	private static let chunkSize = 1 << 16
+
+	private let handle: FileHandle
+	private var buffer: [UInt8] = []
+	private var error: Error?
+
+	init(url: URL) throws {
+		let dir = url.deletingLastPathComponent()
+		try FileManager.default.createDirectory(at: dir, withIntermediateDirectories: true)
+		guard FileManager.default.createFile(atPath: url.path, contents: nil) else {
+			throw CocoaError(.fileWriteUnknown, userInfo: [NSFilePathErrorKey: url.path])
+		}
+		handle = try FileHandle(forWritingTo: url)
+		buffer.reserveCapacity(Self.chunkSize)
+	}
+
+	mutating func write(_ string: String) {
+		buffer.append(contentsOf: string.utf8)
+		if buffer.count >= Self.chunkSize { flush() }
+	}
+
+	/// Writes the remaining bytes and closes the file.
+	mutating func close() throws {
+		flush()
+		try handle.close()
+		if let error { throw error }
+	}
+
+	private mutating func flush() {
+		guard !buffer.isEmpty else { return }
+		if error == nil {
+			do {
+				try handle.write(contentsOf: buffer)
+			} catch {
+				self.error = error
+			}
+		}
+		buffer.removeAll(keepingCapacity: true)
+	}
+}
@@ -790,6 +790,9 @@ struct Keynote: AsyncParsableCommand {
 	@Flag(name: .long, help: "Output JSON (slides of title/body/notes) for programmatic use.")
 	var json: Bool = false
 
+	@Flag(name: .long, help: "Extract only slide titles, skipping body text and presenter notes.")
+	var titlesOnly: Bool = false
+
 	@Option(name: .shortAndLong, help: "Write output to a file instead of stdout.")
 	var outputPath: String?
 
@@ -802,7 +805,7 @@ struct Keynote: AsyncParsableCommand {
 			throw ValidationError("Choose at most one of --markdown / --json.")
 		}
 
-		let keynote = try KeynoteFile(url: fileURL)
+		let keynote = try KeynoteFile(url: fileURL, titlesOnly: titlesOnly)
 		let output = markdown ? keynote.markdown() : json ? try keynote.json() : keynote.plainText()
 		if !output.isEmpty {
 			try writeOutputIfNeeded(output)
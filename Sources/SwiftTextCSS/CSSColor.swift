@@ -10,7 +10,7 @@ import Foundation
 ///
 /// Alpha is clamped to 0…1, but red/green/blue may fall outside it (e.g.
 /// `rgb(-10%, 120%, 0%)` yields `(-0.1, 1.2, 0, 1)`), matching CSS Color 3.
-public struct RGBA: Equatable, Sendable {
+public struct RGBA: Hashable, Sendable {
 	public var red: Double
 	public var green: Double
 	public var blue: Double
@@ -8,7 +8,7 @@
 import Foundation
 
 /// A CSS length, with absolute units already resolved to CSS pixels.
-public enum Length: Equatable, Sendable {
+public enum Length: Hashable, Sendable {
 	case px(Double)
 	case percent(Double)
 	case auto
@@ -42,7 +42,9 @@ public struct Edges<Value: Equatable & Sendable>: Equatable, Sendable {
 	}
 }
 
-public enum Display: Equatable, Sendable {
+extension Edges: Hashable where Value: Hashable {}
+
+public enum Display: Hashable, Sendable {
 	case none, inline, block, inlineBlock, listItem
 	case table, tableRow, tableCell, tableRowGroup, tableHeaderGroup, tableFooterGroup
 	case tableColumn, tableColumnGroup, tableCaption
@@ -77,7 +79,7 @@ public enum VerticalAlign: String, Equatable, Sendable {
 	case textBottom = "text-bottom"
 }
 
-public enum WhiteSpace: Equatable, Sendable {
+public enum WhiteSpace: Hashable, Sendable {
 	case normal, pre, nowrap, preWrap, preLine
 
 	/// Whether runs of whitespace collapse to a single space.
@@ -126,7 +128,7 @@ public enum BorderStyle: String, Equatable, Sendable {
 }
 
 /// Line height: a multiplier of font-size, an absolute length, or `normal`.
-public enum LineHeight: Equatable, Sendable {
+public enum LineHeight: Hashable, Sendable {
 	case normal
 	case number(Double)
 	case length(Double)
@@ -142,7 +144,7 @@ public enum LineHeight: Equatable, Sendable {
 }
 
 /// The fully resolved style of one element.
-public struct ComputedStyle: Equatable, Sendable {
+public struct ComputedStyle: Hashable, Sendable {
 	// Inherited properties.
 	public var color: RGBA
 	public var fontFamily: [String]
@@ -0,0 +1,104 @@
+//  DocumentEvent.swift
+//  SwiftTextCore
+//
+//  A flat, streamable vocabulary for document content. Readers emit events as
+//  they decode (a paragraph at a time) and writers consume them as they arrive,
+//  so a conversion never needs the whole source model, an AST, and the output
+//  in memory at once.
+
+import Foundation
+
+/// One step of a document, in reading order.
+///
+/// Events form a shallow grammar:
+///
+/// - **Blocks** — paragraph, heading, list item, code block, table, block-level
+///   image, horizontal rule — appear at the top level or inside a block quote.
+///   Each `begin…` is matched by its `end…`.
+/// - **Inline content** — ``text(_:_:)``, ``lineBreak``, ``image(source:alt:)``
+///   and ``footnoteReference(_:)`` — appears inside a paragraph, heading, list
+///   item or table cell. A code block contains only unstyled text and line breaks.
+/// - **List items are flat**: nesting is the item's `level`, the way DOCX and
+///   Pages store lists. Ordered numbering restarts after any non-list block.
+/// - **Footnote definitions** (``footnote(number:text:)``) may come at any point
+///   between blocks, before or after their references; readers usually send them
+///   last.
+public enum DocumentEvent: Sendable, Equatable {
+	case beginParagraph
+	case endParagraph
+	/// A heading; `level` is 1–6.
+	case beginHeading(level: Int)
+	case endHeading
+	/// A list item at nesting depth `level` (0-based).
+	case beginListItem(level: Int, ordered: Bool)
+	case endListItem
+	case beginCodeBlock(language: String?)
+	case endCodeBlock
+	case beginBlockQuote
+	case endBlockQuote
+	/// A table; its first row is usually the header.
+	case beginTable(alignments: [DocumentColumnAlignment])
+	case endTable
+	case beginTableRow(header: Bool)
+	case endTableRow
+	case beginTableCell
+	case endTableCell
+	/// A run of text sharing one style.
+	case text(String, DocumentTextStyle)
+	/// A hard line break within the current block.
+	case lineBreak
+	/// An image, either inline or as a block of its own.
+	case image(source: String, alt: String)
+	/// A reference to footnote `number`.
+	case footnoteReference(Int)
+	/// The text of footnote `number`.
+	case footnote(number: Int, text: String)
+	case horizontalRule
+}
+
+/// Inline styling carried by a ``DocumentEvent/text(_:_:)`` run.
+public struct DocumentTextStyle: Sendable, Hashable {
+	public var bold: Bool
+	public var italic: Bool
+	public var underline: Bool
+	public var strikethrough: Bool
+	public var code: Bool
+	/// The destination when the run is (part of) a hyperlink.
+	public var link: String?
+
+	public init(bold: Bool = false, italic: Bool = false, underline: Bool = false,
+	            strikethrough: Bool = false, code: Bool = false, link: String? = nil) {
+		self.bold = bold
+		self.italic = italic
+		self.underline = underline
+		self.strikethrough = strikethrough
+		self.code = code
+		self.link = link
+	}
+
+	public static let plain = DocumentTextStyle()
+
+	public var isPlain: Bool {
+		self == .plain
+	}
+}
+
+/// Horizontal alignment of a table column.
+public enum DocumentColumnAlignment: Sendable, Equatable {
+	case left
+	case center
+	case right
+}
+
+/// Receives a producer's events; producers take one as `(DocumentEvent) throws -> Void`.
+public typealias DocumentEventHandler = (DocumentEvent) throws -> Void
+
+/// A writer that builds its output from a stream of ``DocumentEvent``s.
+///
+/// Feed events with ``consume(_:)`` and call ``finish()`` once after the last
+/// one; writers flush open blocks and trailing material (footnote definitions)
+/// there. Throwing from ``consume(_:)`` stops the producer that is driving it.
+public protocol DocumentEventConsumer {
+	mutating func consume(_ event: DocumentEvent) throws
+	mutating func finish() throws
+}
@@ -0,0 +1,141 @@
+import Foundation
+
+/// Upper bounds on the memory and work a single conversion may consume.
+///
+/// The readers (Pages, Numbers, Keynote, DOCX, HTML) and the PDF renderer all
+/// take untrusted input: a Snappy header can claim gigabytes, a Zip entry can be a
+/// deflate bomb, an HTML upload can hold a ten-million-row table. Passing limits
+/// makes such inputs fail fast with a ``ResourceLimitError`` instead of taking the
+/// worker down. Every bound is optional — `nil` means unbounded — and the default
+/// is ``unlimited``, so callers that don't opt in see no change.
+public struct ResourceLimits: Sendable, Equatable {
+	/// A countable resource a budget meters.
+	public enum Resource: Int, Sendable, CaseIterable, CustomStringConvertible {
+		/// Bytes produced by decompression (Snappy blocks, Zip entries).
+		case decompressedBytes
+		/// Archived objects decoded from a document (IWA records).
+		case objects
+		/// Parsed markup nodes (HTML DOM elements/text, DOCX XML elements).
+		case domNodes
+		/// Laid-out boxes (block boxes and line boxes).
+		case boxes
+		/// Output pages.
+		case pages
+
+		public var description: String {
+			switch self {
+			case .decompressedBytes: return "decompressed bytes"
+			case .objects: return "objects"
+			case .domNodes: return "DOM nodes"
+			case .boxes: return "layout boxes"
+			case .pages: return "pages"
+			}
+		}
+	}
+
+	public var maxDecompressedBytes: Int?
+	public var maxObjects: Int?
+	public var maxDOMNodes: Int?
+	public var maxBoxes: Int?
+	public var maxPages: Int?
+	/// The wall-clock instant after which work is abandoned.
+	public var deadline: Date?
+
+	public init(maxDecompressedBytes: Int? = nil, maxObjects: Int? = nil, maxDOMNodes: Int? = nil,
+	            maxBoxes: Int? = nil, maxPages: Int? = nil, deadline: Date? = nil) {
+		self.maxDecompressedBytes = maxDecompressedBytes
+		self.maxObjects = maxObjects
+		self.maxDOMNodes = maxDOMNodes
+		self.maxBoxes = maxBoxes
+		self.maxPages = maxPages
+		self.deadline = deadline
+	}
+
+	/// No bounds at all — the behavior of every reader before limits existed.
+	public static let unlimited = ResourceLimits()
+
+	/// The bound for one resource, or `nil` when it is unbounded.
+	public subscript(resource: Resource) -> Int? {
+		switch resource {
+		case .decompressedBytes: return maxDecompressedBytes
+		case .objects: return maxObjects
+		case .domNodes: return maxDOMNodes
+		case .boxes: return maxBoxes
+		case .pages: return maxPages
+		}
+	}
+}
+
+/// A conversion was stopped because it exceeded its ``ResourceLimits``.
+public enum ResourceLimitError: Error, Equatable, LocalizedError {
+	case limitExceeded(ResourceLimits.Resource, limit: Int)
+	case deadlineExceeded
+
+	public var errorDescription: String? {
+		switch self {
+		case .limitExceeded(let resource, let limit):
+			return "Input exceeds the limit of \(limit) \(resource)"
+		case .deadlineExceeded:
+			return "Processing exceeded its deadline"
+		}
+	}
+}
+
+/// The running tally of one conversion against its ``ResourceLimits``.
+///
+/// Create one budget per document and hand it to every stage that processes it, so
+/// the bounds apply to the conversion as a whole (all `.iwa` files of a package, the
+/// DOM *and* the box tree of a render). Charging an unbounded resource returns
+/// without touching any shared state, which keeps the checks cheap enough for the
+/// decoders' inner loops. A budget may be charged from several threads.
+public final class ResourceBudget: @unchecked Sendable {
+	public let limits: ResourceLimits
+	private let lock = NSLock()
+	private var used = [Int](repeating: 0, count: ResourceLimits.Resource.allCases.count)
+
+	public init(_ limits: ResourceLimits) {
+		self.limits = limits
+	}
+
+	/// Records `amount` units of `resource`.
+	/// - Throws: ``ResourceLimitError/limitExceeded(_:limit:)`` once the total passes the bound.
+	public func charge(_ resource: ResourceLimits.Resource, _ amount: Int = 1) throws {
+		guard let limit = limits[resource] else { return }
+		lock.lock()
+		defer { lock.unlock() }
+		used[resource.rawValue] += amount
+		if used[resource.rawValue] > limit {
+			throw ResourceLimitError.limitExceeded(resource, limit: limit)
+		}
+	}
+
+	/// Units of `resource` charged so far. Only bounded resources are tallied.
+	public func usage(of resource: ResourceLimits.Resource) -> Int {
+		lock.lock()
+		defer { lock.unlock() }
+		return used[resource.rawValue]
+	}
+
+	/// Units of `resource` still available (`Int.max` when unbounded), so a decoder
+	/// can cap an allocation before it makes it.
+	public func remaining(_ resource: ResourceLimits.Resource) -> Int {
+		guard let limit = limits[resource] else { return .max }
+		return max(0, limit - usage(of: resource))
+	}
+
+	/// Throws once the deadline has passed. Reads the clock on every call, so hot
+	/// loops should call it every few hundred iterations rather than on each one.
+	/// - Throws: ``ResourceLimitError/deadlineExceeded``.
+	public func checkDeadline() throws {
+		guard let deadline = limits.deadline else { return }
+		if Date() >= deadline { throw ResourceLimitError.deadlineExceeded }
+	}
+
+	/// The periodic check long-running loops make: throws `CancellationError` when
+	/// the current task has been cancelled, then checks the deadline. Outside a
+	/// task the cancellation half is a no-op, so synchronous callers are unaffected.
+	public func checkpoint() throws {
+		try Task.checkCancellation()
+		try checkDeadline()
+	}
+}
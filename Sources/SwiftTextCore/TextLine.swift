@@ -1,6 +1,6 @@
 //
 //  TextLine.swift
-//  SwiftTextPDF
+//  SwiftTextCore
 //
 //  Created by Oliver Drobnik on 05.12.24.
 //
@@ -12,6 +12,11 @@ public struct TextLine {
 	/// The text fragments that make up the line.
 	public var fragments: [TextFragment]
 
+	/// Creates a line from fragments already ordered left to right.
+	public init(fragments: [TextFragment]) {
+		self.fragments = fragments
+	}
+
 	/// The combined text of the line, constructed by joining all fragments with tabs.
 	public var combinedText: String {
 		fragments.map { $0.string }.joined(separator: "\t")
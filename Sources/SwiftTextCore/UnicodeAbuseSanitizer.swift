@@ -34,25 +34,136 @@ public enum UnicodeAbuseSanitizer {
 	static let maximumAllowedVariationSelectors = 1
 	static let maximumAllowedTagScalars = 8
 
+	/// Sanitizes `text` cluster by cluster and NFC-normalizes the result.
+	///
+	/// Only spans containing non-ASCII bytes can hold anything to strip or
+	/// normalize, so a vectorized scan over the UTF-8 finds those spans and the
+	/// ASCII between them is copied verbatim. Each span also takes the ASCII
+	/// character on either side of its non-ASCII run — the base a combining mark
+	/// attaches to, or what follows a prepended mark — so it starts and ends on
+	/// grapheme cluster boundaries and sanitizes exactly as the whole text would.
 	public static func sanitize(_ text: String) -> UnicodeSanitizationResult {
 		guard !text.isEmpty else {
 			return UnicodeSanitizationResult(text: text, report: UnicodeAbuseReport())
 		}
 
+		var contiguous = text
+		contiguous.makeContiguousUTF8()
+		return contiguous.utf8.withContiguousStorageIfAvailable { bytes in
+			sanitize(contiguous, bytes: bytes)
+		}!
+	}
+
+	private static func sanitize(_ text: String, bytes: UnsafeBufferPointer<UInt8>) -> UnicodeSanitizationResult {
 		var report = UnicodeAbuseReport()
+		var output: [UInt8] = []
+		var copied = 0 // bytes of `text` already written to `output`
+
+		var runStart = firstNonASCII(in: bytes, from: 0)
+		while runStart < bytes.count {
+			// Back up over the character a combining mark would attach to, and
+			// over the CR of a CR LF pair.
+			var spanStart = runStart
+			if spanStart > copied {
+				spanStart -= 1
+				if bytes[spanStart] == 0x0A, spanStart > copied, bytes[spanStart - 1] == 0x0D { spanStart -= 1 }
+			}
+			// Take each non-ASCII run and the character after it, merging runs
+			// that are at most one ASCII character apart.
+			var spanEnd = runStart
+			while true {
+				while spanEnd < bytes.count, bytes[spanEnd] >= 0x80 { spanEnd += 1 }
+				if spanEnd < bytes.count {
+					spanEnd += 1
+					if bytes[spanEnd - 1] == 0x0D, spanEnd < bytes.count, bytes[spanEnd] == 0x0A { spanEnd += 1 }
+				}
+				runStart = firstNonASCII(in: bytes, from: spanEnd)
+				guard runStart < bytes.count, runStart <= spanEnd + 1 else { break }
+				spanEnd = runStart
+			}
+
+			if output.isEmpty { output.reserveCapacity(bytes.count) }
+			let ascii = UnsafeBufferPointer(rebasing: bytes[copied ..< spanStart])
+			recordASCII(ascii, report: &report)
+			output.append(contentsOf: ascii)
+			let span = String(decoding: UnsafeBufferPointer(rebasing: bytes[spanStart ..< spanEnd]), as: UTF8.self)
+			output.append(contentsOf: sanitizeSpan(span, report: &report).utf8)
+			copied = spanEnd
+		}
+
+		let ascii = UnsafeBufferPointer(rebasing: bytes[copied...])
+		recordASCII(ascii, report: &report)
+		// Plain ASCII throughout: nothing to strip or normalize.
+		guard copied > 0 else {
+			return UnicodeSanitizationResult(text: text, report: report)
+		}
+		output.append(contentsOf: ascii)
+		return UnicodeSanitizationResult(text: String(decoding: output, as: UTF8.self), report: report)
+	}
+
+	/// The offset of the first byte at or after `start` with its high bit set,
+	/// or `bytes.count`. Sixteen bytes are tested at a time.
+	private static func firstNonASCII(in bytes: UnsafeBufferPointer<UInt8>, from start: Int) -> Int {
+		var index = start
+		if let base = bytes.baseAddress {
+			let raw = UnsafeRawPointer(base)
+			while index + 16 <= bytes.count {
+				let chunk = raw.loadUnaligned(fromByteOffset: index, as: SIMD16<UInt8>.self)
+				if any(chunk .>= 0x80) { break }
+				index += 16
+			}
+		}
+		while index < bytes.count, bytes[index] < 0x80 { index += 1 }
+		return index
+	}
+
+	/// Records the clusters of an ASCII stretch: one scalar each, except CR LF,
+	/// which is a single two-scalar cluster.
+	private static func recordASCII(_ ascii: UnsafeBufferPointer<UInt8>, report: inout UnicodeAbuseReport) {
+		guard !ascii.isEmpty else { return }
+		report.maxClusterSize = max(report.maxClusterSize, 1)
+		guard report.maxClusterSize < 2 else { return }
+		for index in ascii.indices.dropLast() where ascii[index] == 0x0D && ascii[index + 1] == 0x0A {
+			report.maxClusterSize = 2
+			return
+		}
+	}
+
+	/// The per-cluster sanitizer, for a span that starts and ends on cluster
+	/// boundaries. A lone scalar that needs no stripping is kept as is; only
+	/// a result with scalars from U+0300 up, where NFC can differ from the
+	/// input, is normalized.
+	private static func sanitizeSpan(_ span: String, report: inout UnicodeAbuseReport) -> String {
 		var sanitized = String.UnicodeScalarView()
+		var scalars: [UnicodeScalar] = []
+		var needsNormalization = false
 
-		for character in text {
-			let scalars = Array(String(character).unicodeScalars)
+		for character in span {
+			scalars.removeAll(keepingCapacity: true)
+			scalars.append(contentsOf: character.unicodeScalars)
 			report.maxClusterSize = max(report.maxClusterSize, scalars.count)
-			report.zwjChainLength = max(report.zwjChainLength, zwjChainLength(in: scalars))
 
+			if scalars.count == 1, !needsSanitizing(scalars[0]) {
+				needsNormalization = needsNormalization || scalars[0].value >= 0x300
+				sanitized.append(scalars[0])
+				continue
+			}
+
+			report.zwjChainLength = max(report.zwjChainLength, zwjChainLength(in: scalars))
 			let sanitizedCluster = sanitizeCluster(scalars, report: &report)
+			needsNormalization = needsNormalization || sanitizedCluster.contains { $0.value >= 0x300 }
 			sanitized.append(contentsOf: sanitizedCluster)
 		}
 
-		let normalized = String(sanitized).precomposedStringWithCanonicalMapping
-		return UnicodeSanitizationResult(text: normalized, report: report)
+		let result = String(sanitized)
+		return needsNormalization ? result.precomposedStringWithCanonicalMapping : result
+	}
+
+	/// Whether a cluster of just `scalar` needs `sanitizeCluster`: it may be
+	/// dropped or limited, or (a joiner) counts toward ``UnicodeAbuseReport/zwjChainLength``.
+	private static func needsSanitizing(_ scalar: UnicodeScalar) -> Bool {
+		scalar == zeroWidthJoiner || isBidiOverride(scalar) || isTagScalar(scalar)
+			|| isVariationSelector(scalar) || isCombiningMark(scalar)
 	}
 
 	private static func sanitizeCluster(_ scalars: [UnicodeScalar], report: inout UnicodeAbuseReport) -> [UnicodeScalar] {
@@ -0,0 +1,71 @@
+import Foundation
+import SwiftTextCore
+
+extension DocxDocument {
+	/// Sends the document to `emit` as ``DocumentEvent``s: one block per non-empty
+	/// paragraph, then the footnote definitions. Heading levels and list kinds
+	/// come from the same style and numbering definitions ``markdownParagraphs()``
+	/// uses; list numbering is left to the consumer.
+	public func events(_ emit: DocumentEventHandler) rethrows {
+		for paragraph in paragraphs {
+			try paragraph.emitEvents(styles: styles, listDefinitions: numbering, emit)
+		}
+		for footnote in footnotes {
+			try emit(.footnote(number: footnote.number, text: footnote.text))
+		}
+	}
+}
+
+extension DocxDocument.Paragraph {
+	/// Emits this paragraph as a heading, list item or plain paragraph. Tabs are
+	/// expanded and the paragraph's outer whitespace trimmed, as in rendered
+	/// Markdown; a paragraph with no visible text emits nothing.
+	func emitEvents(styles: DocxDocument.StyleCatalog, listDefinitions: DocxDocument.NumberingCatalog,
+	                _ emit: DocumentEventHandler) rethrows {
+		var pieces = [(text: String, run: DocxDocument.Run)]()
+		for run in runs {
+			pieces.append((run.text.replacingOccurrences(of: "\t", with: "    "), run))
+		}
+		if let first = pieces.firstIndex(where: { $0.run.footnoteNumber != nil || !$0.text.allSatisfy(\.isWhitespace) }) {
+			pieces.removeFirst(first)
+			if pieces[0].run.footnoteNumber == nil {
+				pieces[0].text = String(pieces[0].text.drop(while: \.isWhitespace))
+			}
+		} else {
+			return
+		}
+		if let last = pieces.lastIndex(where: { $0.run.footnoteNumber != nil || !$0.text.allSatisfy(\.isWhitespace) }) {
+			pieces.removeLast(pieces.count - 1 - last)
+			if pieces[last].run.footnoteNumber == nil {
+				var text = pieces[last].text
+				while text.last?.isWhitespace == true { text.removeLast() }
+				pieces[last].text = text
+			}
+		}
+
+		let end: DocumentEvent
+		if let level = styles.style(for: styleIdentifier)?.headingLevel() {
+			try emit(.beginHeading(level: max(1, min(level, 6))))
+			end = .endHeading
+		} else if let reference = numbering, let definition = listDefinitions.level(for: reference) {
+			try emit(.beginListItem(level: reference.level, ordered: !definition.format.isBullet))
+			end = .endListItem
+		} else {
+			try emit(.beginParagraph)
+			end = .endParagraph
+		}
+		for piece in pieces {
+			if let number = piece.run.footnoteNumber {
+				try emit(.footnoteReference(number))
+				continue
+			}
+			let style = DocumentTextStyle(bold: piece.run.bold, italic: piece.run.italic, strikethrough: piece.run.strike)
+			// `w:br` arrives as a newline inside the run text.
+			for (index, line) in piece.text.split(separator: "\n", omittingEmptySubsequences: false).enumerated() {
+				if index > 0 { try emit(.lineBreak) }
+				if !line.isEmpty { try emit(.text(String(line), style)) }
+			}
+		}
+		try emit(end)
+	}
+}
@@ -1,4 +1,5 @@
 import Foundation
+import SwiftTextCore
 import ZIPFoundation
 
 /// A parsed DOCX file with convenience helpers for plain text or Markdown output.
@@ -10,11 +11,32 @@ public final class DocxFile {
 	public let document: DocxDocument
 
 	/// Creates a DocxFile by reading and parsing the DOCX at the given URL.
-	/// - Parameter url: The file URL pointing to the DOCX archive.
-	/// - Throws: A ``DocxFileError`` describing the failure reason.
-	public init(url: URL) throws {
+	/// - Parameters:
+	///   - url: The file URL pointing to the DOCX archive.
+	///   - limits: Bounds on inflated XML size, element count, and time for
+	///     untrusted input. Unlimited by default.
+	/// - Throws: A ``DocxFileError`` describing the failure reason, or a
+	///   `ResourceLimitError` when the document exceeds `limits`.
+	public init(url: URL, limits: ResourceLimits = .unlimited) throws {
 		self.url = url
-		self.document = try DocxParser().readDocument(from: url)
+		self.document = try DocxParser().readDocument(from: url, limits: limits)
+	}
+
+	/// Reads and parses the DOCX on the calling task, for use from async code.
+	/// Cancellation is polled while inflating entries and every 1024 XML elements.
+	/// - Throws: Everything ``init(url:limits:)`` throws, or `CancellationError`.
+	public static func open(url: URL, limits: ResourceLimits = .unlimited) async throws -> DocxFile {
+		try Task.checkCancellation()
+		return try DocxFile(url: url, limits: limits)
+	}
+
+	/// Streams the DOCX at `url` to `emit` paragraph by paragraph as it is
+	/// parsed, without keeping the document model. Feed a
+	/// `DocumentEventConsumer` such as `MarkdownEventWriter` to convert large
+	/// files in bounded memory.
+	/// - Throws: Everything ``init(url:limits:)`` throws, or whatever `emit` throws.
+	public static func events(url: URL, limits: ResourceLimits = .unlimited, _ emit: DocumentEventHandler) throws {
+		try DocxParser().readEvents(from: url, limits: limits, emit: emit)
 	}
 
 	/// Returns the plain text for each paragraph with formatting removed.
@@ -1,4 +1,5 @@
 import Foundation
+import SwiftTextCore
 import ZIPFoundation
 #if canImport(FoundationXML)
 // On Linux, XMLParser/XMLParserDelegate live in FoundationXML, not Foundation.
@@ -6,7 +7,41 @@ import FoundationXML
 #endif
 
 final class DocxParser {
-	func readDocument(from url: URL) throws -> DocxDocument {
+	/// The running tally for the document being read; replaced per `readDocument` call.
+	private var budget = ResourceBudget(.unlimited)
+
+	func readDocument(from url: URL, limits: ResourceLimits = .unlimited) throws -> DocxDocument {
+		let parts = try readParts(from: url, limits: limits)
+		return try parseDocumentXML(
+			from: parts.document,
+			stylesData: parts.styles,
+			numberingData: parts.numbering,
+			footnotesData: parts.footnotes,
+			emit: nil
+		)
+	}
+
+	/// Streams the document body as events, one paragraph at a time, without
+	/// collecting the paragraphs into a ``DocxDocument``. Footnote definitions
+	/// follow the body.
+	func readEvents(from url: URL, limits: ResourceLimits = .unlimited, emit: DocumentEventHandler) throws {
+		let parts = try readParts(from: url, limits: limits)
+		try withoutActuallyEscaping(emit) { emit in
+			let document = try parseDocumentXML(
+				from: parts.document,
+				stylesData: parts.styles,
+				numberingData: parts.numbering,
+				footnotesData: parts.footnotes,
+				emit: emit
+			)
+			for footnote in document.footnotes {
+				try emit(.footnote(number: footnote.number, text: footnote.text))
+			}
+		}
+	}
+
+	private func readParts(from url: URL, limits: ResourceLimits) throws -> (document: Data, styles: Data?, numbering: Data?, footnotes: Data?) {
+		budget = ResourceBudget(limits)
 		guard FileManager.default.fileExists(atPath: url.path) else {
 			throw DocxFileError.fileNotFound(url)
 		}
@@ -19,19 +54,19 @@ final class DocxParser {
 		guard let documentEntry = archive["word/document.xml"] else {
 			throw DocxFileError.missingDocumentXML
 		}
-		let documentData = try data(for: documentEntry, in: archive)
-		let stylesData = try dataIfAvailable(named: "word/styles.xml", in: archive)
-		let numberingData = try dataIfAvailable(named: "word/numbering.xml", in: archive)
-		let footnotesData = try dataIfAvailable(named: "word/footnotes.xml", in: archive)
-		return try parseDocumentXML(
-			from: documentData,
-			stylesData: stylesData,
-			numberingData: numberingData,
-			footnotesData: footnotesData
+		return (
+			try data(for: documentEntry, in: archive),
+			try dataIfAvailable(named: "word/styles.xml", in: archive),
+			try dataIfAvailable(named: "word/numbering.xml", in: archive),
+			try dataIfAvailable(named: "word/footnotes.xml", in: archive)
 		)
 	}
 
-	private func parseDocumentXML(from data: Data, stylesData: Data?, numberingData: Data?, footnotesData: Data?) throws -> DocxDocument {
+	/// Parses `document.xml` against its styles, numbering and footnotes. With an
+	/// `emit` handler each paragraph is sent as events once it closes and the
+	/// returned document carries only the footnotes.
+	private func parseDocumentXML(from data: Data, stylesData: Data?, numberingData: Data?, footnotesData: Data?,
+	                              emit: DocumentEventHandler?) throws -> DocxDocument {
 		let styleCatalog: DocxDocument.StyleCatalog
 		if let stylesData {
 			styleCatalog = try parseStylesXML(from: stylesData)
@@ -51,12 +86,17 @@ final class DocxParser {
 			footnotesByID = [:]
 		}
 
-		let extractor = DocumentExtractor(footnotesByID: footnotesByID)
+		let extractor = DocumentExtractor(footnotesByID: footnotesByID, budget: budget)
+		if let emit {
+			extractor.stream(to: emit, styles: styleCatalog, numbering: numberingCatalog)
+		}
 		let parser = XMLParser(data: data)
 		parser.delegate = extractor
 		guard parser.parse() else {
+			if let abortError = extractor.abortError { throw abortError }
 			throw DocxFileError.documentXMLParsingFailed(parser.parserError)
 		}
+		if let abortError = extractor.abortError { throw abortError }
 		var document = extractor.document
 		document.styles = styleCatalog
 		document.numbering = numberingCatalog
@@ -93,9 +133,15 @@ final class DocxParser {
 		return extractor.catalog
 	}
 
+	/// Inflates one archive entry, charging its bytes to the budget as they arrive
+	/// so a deflate bomb is cut off at the limit rather than after inflating.
 	private func data(for entry: Entry, in archive: Archive) throws -> Data {
 		var data = Data()
-		_ = try archive.extract(entry) { data.append($0) }
+		_ = try archive.extract(entry) { chunk in
+			try Task.checkCancellation()
+			try budget.charge(.decompressedBytes, chunk.count)
+			data.append(chunk)
+		}
 		return data
 	}
 
@@ -114,6 +160,12 @@ private final class DocumentExtractor: NSObject, XMLParserDelegate {
 	}
 
 	private(set) var document = DocxDocument()
+	/// The limit or cancellation that stopped parsing, if any. `XMLParserDelegate`
+	/// callbacks can't throw, so the extractor aborts the parse and the caller
+	/// rethrows this.
+	private(set) var abortError: Error?
+	private let budget: ResourceBudget
+	private var elementCount = 0
 	private let footnotesByID: [String: String]
 	private var footnoteNumberByID: [String: Int] = [:]
 	private var footnoteCounter = 0
@@ -128,9 +180,20 @@ private final class DocumentExtractor: NSObject, XMLParserDelegate {
 	private var formatTargetStack = [FormatTarget]()
 	private var pendingNumberingLevel: Int?
 	private var pendingNumberingId: Int?
+	/// Set in streaming mode: finished paragraphs go here instead of `document`.
+	private var emit: DocumentEventHandler?
+	private var styles = DocxDocument.StyleCatalog()
+	private var numbering = DocxDocument.NumberingCatalog()
 
-	init(footnotesByID: [String: String]) {
+	init(footnotesByID: [String: String], budget: ResourceBudget) {
 		self.footnotesByID = footnotesByID
+		self.budget = budget
+	}
+
+	func stream(to emit: @escaping DocumentEventHandler, styles: DocxDocument.StyleCatalog, numbering: DocxDocument.NumberingCatalog) {
+		self.emit = emit
+		self.styles = styles
+		self.numbering = numbering
 	}
 
 	private var currentState: DocxDocument.FormatState {
@@ -138,6 +201,17 @@ private final class DocumentExtractor: NSObject, XMLParserDelegate {
 	}
 
 	func parser(_ parser: XMLParser, didStartElement elementName: String, namespaceURI: String?, qualifiedName qName: String?, attributes attributeDict: [String: String] = [:]) {
+		guard abortError == nil else { return }
+		do {
+			try budget.charge(.domNodes)
+			elementCount += 1
+			// Polling the task and clock per element would dominate; every 1024 is plenty.
+			if elementCount & 0x3FF == 0 { try budget.checkpoint() }
+		} catch {
+			abortError = error
+			parser.abortParsing()
+			return
+		}
 		switch elementName {
 		case "w:p", "p", "wp:p":
 			beginParagraph()
@@ -238,6 +312,11 @@ private final class DocumentExtractor: NSObject, XMLParserDelegate {
 	}
 
 	func parser(_ parser: XMLParser, didEndElement elementName: String, namespaceURI: String?, qualifiedName qName: String?) {
+		guard abortError == nil else { return }
+		defer {
+			// A throwing event handler stops the parse like a limit does.
+			if abortError != nil { parser.abortParsing() }
+		}
 		switch elementName {
 		case "w:t", "t":
 			insideTextTag = false
@@ -294,7 +373,13 @@ private final class DocumentExtractor: NSObject, XMLParserDelegate {
 		guard let paragraph = currentParagraph else {
 			return
 		}
-		if !paragraph.isEmpty {
+		if let emit {
+			do {
+				if abortError == nil { try paragraph.emitEvents(styles: styles, listDefinitions: numbering, emit) }
+			} catch {
+				abortError = error
+			}
+		} else if !paragraph.isEmpty {
 			document.paragraphs.append(paragraph)
 		}
 		currentParagraph = nil
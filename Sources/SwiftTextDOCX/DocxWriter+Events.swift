@@ -0,0 +1,186 @@
+import Foundation
+import SwiftTextCore
+
+/// Lets a reader feed ``DocxWriter`` directly: each finished block is appended to
+/// ``DocxWriter/blocks`` (or the open block quote) and footnote definitions to
+/// ``DocxWriter/footnotes``. The archive itself is still produced by
+/// ``DocxWriter/write(to:)`` after ``finish()``, since `document.xml` and its
+/// relationship parts are zipped together.
+extension DocxWriter: DocumentEventConsumer {
+	public func consume(_ event: DocumentEvent) throws {
+		eventAssembly.consume(event, into: self)
+	}
+
+	public func finish() throws {
+		eventAssembly.finish(into: self)
+		footnotes.sort { $0.id < $1.id }
+	}
+}
+
+/// The partially built block state behind ``DocxWriter``'s event consumption.
+struct DocxEventAssembly {
+	private enum Container {
+		case paragraph
+		case heading(Int)
+		case listItem(level: Int, ordered: Bool)
+		case codeBlock(language: String?)
+		case tableCell
+	}
+
+	private struct TableState {
+		var alignments: [DocxWriter.ColumnAlignment]
+		var headers: [[DocxWriter.Run]] = []
+		var rows: [[[DocxWriter.Run]]] = []
+		var row: [[DocxWriter.Run]] = []
+		var headerRow = false
+	}
+
+	private var container: Container?
+	private var implicitParagraph = false
+	private var runs: [DocxWriter.Run] = []
+	private var code = ""
+	/// Blocks of the open block quotes, outermost first.
+	private var quotes: [[DocxWriter.Block]] = []
+	private var table: TableState?
+
+	mutating func consume(_ event: DocumentEvent, into writer: DocxWriter) {
+		switch event {
+		case .beginParagraph:
+			beginBlock(.paragraph, into: writer)
+		case .beginHeading(let level):
+			beginBlock(.heading(max(1, min(level, 6))), into: writer)
+		case .beginListItem(let level, let ordered):
+			beginBlock(.listItem(level: max(level, 0), ordered: ordered), into: writer)
+		case .beginCodeBlock(let language):
+			beginBlock(.codeBlock(language: language), into: writer)
+		case .endParagraph, .endHeading, .endListItem, .endCodeBlock:
+			endBlock(into: writer)
+		case .beginBlockQuote:
+			closeImplicitParagraph(into: writer)
+			quotes.append([])
+		case .endBlockQuote:
+			closeImplicitParagraph(into: writer)
+			if let blocks = quotes.popLast() {
+				append(.blockquote(blocks: blocks), to: writer)
+			}
+		case .beginTable(let alignments):
+			closeImplicitParagraph(into: writer)
+			table = TableState(alignments: alignments.map {
+				switch $0 {
+				case .left: return .left
+				case .center: return .center
+				case .right: return .right
+				}
+			})
+		case .endTable:
+			if let table {
+				append(.table(headers: table.headers, rows: table.rows, alignments: table.alignments), to: writer)
+			}
+			table = nil
+		case .beginTableRow(let header):
+			table?.row = []
+			table?.headerRow = header
+		case .endTableRow:
+			guard var state = table else { break }
+			// DocxWriter tables have exactly one header row; extra ones become body rows.
+			if state.headerRow, state.headers.isEmpty, state.rows.isEmpty {
+				state.headers = state.row
+			} else {
+				state.rows.append(state.row)
+			}
+			table = state
+		case .beginTableCell:
+			runs = []
+			container = .tableCell
+		case .endTableCell:
+			table?.row.append(runs)
+			runs = []
+			container = nil
+		case .text(let string, let style):
+			if case .codeBlock? = container {
+				code += string
+				return
+			}
+			openImplicitParagraph()
+			runs.append(DocxWriter.Run(
+				text: string,
+				bold: style.bold,
+				italic: style.italic,
+				strike: style.strikethrough,
+				code: style.code,
+				link: style.link
+			))
+		case .lineBreak:
+			if case .codeBlock? = container {
+				code += "\n"
+			} else {
+				openImplicitParagraph()
+				runs.append(DocxWriter.Run(text: "\n"))
+			}
+		case .image(let source, let alt):
+			if container == nil {
+				append(.image(source: source, alt: alt), to: writer)
+			} else {
+				// Inline images stay placeholders, as in MarkdownDocxBuilder.
+				runs.append(DocxWriter.Run(text: alt.isEmpty ? "[image]" : alt, italic: true))
+			}
+		case .footnoteReference(let number):
+			openImplicitParagraph()
+			runs.append(DocxWriter.Run(text: "", footnoteRef: number))
+		case .footnote(let number, let text):
+			writer.footnotes.append(DocxWriter.Footnote(id: number, blocks: [.paragraph(runs: [DocxWriter.Run(text: text)])]))
+		case .horizontalRule:
+			closeImplicitParagraph(into: writer)
+			append(.horizontalRule, to: writer)
+		}
+	}
+
+	mutating func finish(into writer: DocxWriter) {
+		closeImplicitParagraph(into: writer)
+		if container != nil, table == nil { endBlock(into: writer) }
+		if table != nil { consume(.endTable, into: writer) }
+		while !quotes.isEmpty { consume(.endBlockQuote, into: writer) }
+		self = DocxEventAssembly()
+	}
+
+	private mutating func beginBlock(_ kind: Container, into writer: DocxWriter) {
+		closeImplicitParagraph(into: writer)
+		container = kind
+		runs = []
+		code = ""
+	}
+
+	private mutating func endBlock(into writer: DocxWriter) {
+		switch container {
+		case .paragraph?: append(.paragraph(runs: runs), to: writer)
+		case .heading(let level)?: append(.heading(level: level, runs: runs), to: writer)
+		case .listItem(let level, let ordered)?: append(.listItem(ordered: ordered, level: level, runs: runs), to: writer)
+		case .codeBlock(let language)?: append(.codeBlock(language: language, text: code), to: writer)
+		case .tableCell?, nil: break
+		}
+		container = nil
+		runs = []
+		code = ""
+	}
+
+	/// Inline content outside any block gets a paragraph of its own.
+	private mutating func openImplicitParagraph() {
+		guard container == nil else { return }
+		container = .paragraph
+		implicitParagraph = true
+	}
+
+	private mutating func closeImplicitParagraph(into writer: DocxWriter) {
+		guard implicitParagraph else { return }
+		implicitParagraph = false
+		endBlock(into: writer)
+	}
+
+	private mutating func append(_ block: DocxWriter.Block, to writer: DocxWriter) {
+		if quotes.isEmpty {
+			writer.blocks.append(block)
+		} else {
+			quotes[quotes.count - 1].append(block)
+		}
+	}
+}
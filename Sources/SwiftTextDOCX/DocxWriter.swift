@@ -146,6 +146,9 @@ public final class DocxWriter {
 	/// Maps each concrete numId to its abstract numbering id (0=bullet, 1=decimal).
 	private var numInstances: [(numId: Int, abstractNumId: Int)] = []
 
+	/// Blocks under construction while the writer consumes a `DocumentEvent` stream.
+	var eventAssembly = DocxEventAssembly()
+
 	private enum ListType: Equatable {
 		case ordered
 		case unordered
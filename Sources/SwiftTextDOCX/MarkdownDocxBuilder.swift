@@ -29,28 +29,13 @@ enum MarkdownDocxBuilder {
 		// numbers in source order of first reference.
 		let bodyBlocks = blocks(from: cleaned, resolver: resolver)
 
-		// Render each referenced definition's body into footnote blocks. A
-		// definition can be referenced only from inside another definition that
-		// appears earlier in source, so re-scan until a pass renders nothing new.
-		var blocksByNumber: [Int: [DocxWriter.Block]] = [:]
-		var renderedIDs = Set<String>()
-		var renderedNew = true
-		while renderedNew {
-			renderedNew = false
-			for definition in definitions where !renderedIDs.contains(definition.id) {
-				guard let number = resolver.number(forID: definition.id) else {
-					// Definition not referenced (yet) — skip it.
-					continue
-				}
-				blocksByNumber[number] = blocks(from: definition.body, resolver: resolver)
-				renderedIDs.insert(definition.id)
-				renderedNew = true
-			}
+		// Render each referenced definition's body into footnote blocks, once
+		// and in number order — including definitions only referenced from
+		// another definition's body.
+		var footnotes: [DocxWriter.Footnote] = []
+		resolver.forEachReferencedDefinition(in: definitions) { number, definition in
+			footnotes.append(DocxWriter.Footnote(id: number, blocks: blocks(from: definition.body, resolver: resolver)))
 		}
-
-		let footnotes = blocksByNumber
-			.sorted { $0.key < $1.key }
-			.map { DocxWriter.Footnote(id: $0.key, blocks: $0.value) }
 		return Build(blocks: bodyBlocks, footnotes: footnotes)
 	}
 
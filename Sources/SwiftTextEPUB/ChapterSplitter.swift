@@ -61,6 +61,19 @@ enum ChapterSplitter {
 		return chapters
 	}
 
+	/// A table of contents needs at least one entry. If the manuscript has no
+	/// heading at the split level, present its whole content as a single
+	/// titled chapter (an empty document still yields a one-chapter shell).
+	static func ensuringTableOfContentsEntry(_ chapters: [EpubChapter], title: String) -> [EpubChapter] {
+		guard !chapters.contains(where: { !$0.isFrontmatter }) else { return chapters }
+		if chapters.isEmpty {
+			return [EpubChapter(id: "ch001", title: title, bodyXHTML: "", isFrontmatter: false)]
+		}
+		return chapters.map {
+			EpubChapter(id: $0.id, title: title, bodyXHTML: $0.bodyXHTML, isFrontmatter: false)
+		}
+	}
+
 	/// A chapter's title is its run of leading consecutive headings, joined with
 	/// ": " — so a `## 1` immediately followed by `### The Birthday…` reads as
 	/// "1: The Birthday…" in the table of contents while both headings still
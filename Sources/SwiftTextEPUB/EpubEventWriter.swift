@@ -0,0 +1,136 @@
+//  EpubEventWriter.swift
+//  SwiftTextEPUB
+//
+//  Builds an EPUB from a DocumentEvent stream, so any reader that emits events
+//  (DOCX, Pages, Keynote, HTML) can produce an EPUB without a Markdown round
+//  trip. Chapters split at the same heading level as MarkdownToEpub; each is
+//  serialized to XHTML as its events arrive.
+
+import Foundation
+import SwiftTextCore
+import SwiftTextMarkdown
+
+/// Writes an EPUB 3 publication from a stream of ``DocumentEvent``s.
+///
+/// Usage:
+/// ```swift
+/// let writer = EpubEventWriter(metadata: EpubMetadata(title: "Report"))
+/// try DocxFile.events(url: docxURL) { try writer.consume($0) }
+/// try writer.finish()
+/// try writer.write(to: epubURL)
+/// ```
+///
+/// Footnote definitions are gathered into a closing "Notes" chapter that the
+/// in-text references link to.
+public final class EpubEventWriter: DocumentEventConsumer {
+	private let metadata: EpubMetadata
+	private let options: EpubOptions
+	private var chapters: [EpubChapter] = []
+	private var chapter: HTMLEventWriter<String>?
+	private var chapterIsFrontmatter = false
+	/// Text of the chapter's leading headings, which become its title.
+	private var titleParts: [String] = []
+	private var collectingTitle = false
+	private var headingText: String?
+	private var quoteDepth = 0
+	private var notes: [Int: String] = [:]
+	/// The container file list (pre-zip) once finished. Internal so tests can
+	/// compare it with `MarkdownToEpub.makeFiles` without unzipping.
+	private(set) var files: [EpubFile]?
+
+	public init(metadata: EpubMetadata, options: EpubOptions = EpubOptions()) {
+		self.metadata = metadata
+		self.options = options
+	}
+
+	public func consume(_ event: DocumentEvent) throws {
+		switch event {
+		case .footnote(let number, let text):
+			notes[number] = text
+			return
+		case .beginHeading(let level) where quoteDepth == 0 && level == max(1, min(options.chapterLevel, 6)):
+			endChapter()
+			beginChapter(frontmatter: false)
+		case .beginBlockQuote:
+			quoteDepth += 1
+		case .endBlockQuote:
+			quoteDepth = max(quoteDepth - 1, 0)
+		default:
+			break
+		}
+		if chapter == nil { beginChapter(frontmatter: true) }
+		trackTitle(event)
+		try chapter?.consume(event)
+	}
+
+	public func finish() throws {
+		endChapter()
+		var chapters = ChapterSplitter.ensuringTableOfContentsEntry(chapters, title: metadata.title)
+		if !notes.isEmpty {
+			var writer = HTMLEventWriter<String>(options: [.xhtml])
+			for (number, text) in notes {
+				try writer.consume(.footnote(number: number, text: text))
+			}
+			try writer.finish()
+			chapters.append(EpubChapter(id: "notes", title: "Notes", bodyXHTML: writer.output, isFrontmatter: false))
+		}
+		let cover = metadata.coverImage.flatMap { CoverImage(data: $0, originalFilename: metadata.coverImageFilename) }
+		files = EpubPackageBuilder.build(metadata: metadata, chapters: chapters, cover: cover, userCSS: options.userCSS)
+	}
+
+	/// Writes the EPUB to `url`, finishing the stream first if needed.
+	public func write(to url: URL) throws {
+		if files == nil { try finish() }
+		try EpubArchiveWriter.write(files ?? [], to: url, modificationDate: metadata.modified)
+	}
+
+	/// The EPUB's bytes, finishing the stream first if needed.
+	public func makeData() throws -> Data {
+		if files == nil { try finish() }
+		return try EpubArchiveWriter.makeData(files ?? [], modificationDate: metadata.modified)
+	}
+
+	private func beginChapter(frontmatter: Bool) {
+		var writer = HTMLEventWriter<String>(options: [.xhtml])
+		writer.footnoteLinkPrefix = "notes.xhtml"
+		chapter = writer
+		chapterIsFrontmatter = frontmatter
+		titleParts = []
+		collectingTitle = true
+	}
+
+	private func endChapter() {
+		guard var writer = chapter else { return }
+		try? writer.finish()
+		let title = titleParts.joined(separator: ": ")
+		chapters.append(EpubChapter(
+			id: String(format: "ch%03d", chapters.count + 1),
+			title: title.isEmpty ? metadata.title : title,
+			bodyXHTML: writer.output,
+			isFrontmatter: chapterIsFrontmatter
+		))
+		chapter = nil
+	}
+
+	/// Follows the chapter's leading run of headings, as `ChapterSplitter` titles it.
+	private func trackTitle(_ event: DocumentEvent) {
+		guard collectingTitle else { return }
+		switch event {
+		case .beginHeading:
+			headingText = ""
+		case .endHeading:
+			let text = (headingText ?? "").trimmingCharacters(in: .whitespacesAndNewlines)
+			if !text.isEmpty { titleParts.append(text) }
+			headingText = nil
+		case .text(let text, _) where headingText != nil:
+			headingText? += text
+		case .lineBreak where headingText != nil:
+			headingText? += " "
+		case .image, .footnoteReference:
+			if headingText == nil { collectingTitle = false }
+		default:
+			// Any other content ends the leading run of headings.
+			collectingTitle = false
+		}
+	}
+}
@@ -53,20 +53,10 @@ public enum MarkdownToEpub {
 		// source already carries real typographic characters, so re-substituting
 		// would double-transform them.
 		let document = Document(parsing: markdown, options: [.disableSmartOpts])
-		var chapters = ChapterSplitter.split(document: document, chapterLevel: options.chapterLevel, titleFallback: metadata.title)
-
-		// A table of contents needs at least one entry. If the manuscript has no
-		// heading at the split level, present its whole content as a single
-		// titled chapter (an empty document still yields a one-chapter shell).
-		if !chapters.contains(where: { !$0.isFrontmatter }) {
-			if chapters.isEmpty {
-				chapters = [EpubChapter(id: "ch001", title: metadata.title, bodyXHTML: "", isFrontmatter: false)]
-			} else {
-				chapters = chapters.map {
-					EpubChapter(id: $0.id, title: metadata.title, bodyXHTML: $0.bodyXHTML, isFrontmatter: false)
-				}
-			}
-		}
+		let chapters = ChapterSplitter.ensuringTableOfContentsEntry(
+			ChapterSplitter.split(document: document, chapterLevel: options.chapterLevel, titleFallback: metadata.title),
+			title: metadata.title
+		)
 
 		let cover = metadata.coverImage.flatMap { CoverImage(data: $0, originalFilename: metadata.coverImageFilename) }
 		return EpubPackageBuilder.build(metadata: metadata, chapters: chapters, cover: cover, userCSS: options.userCSS)
@@ -0,0 +1,484 @@
+import Foundation
+import HTMLParser
+import SwiftTextCore
+
+extension DomBuilder {
+	/// Streams `html` to `emit` as ``DocumentEvent``s straight from the parser's
+	/// SAX events, without building a DOM. Covers the structure the event
+	/// vocabulary carries — headings, paragraphs, lists, `pre` code, block quotes,
+	/// tables, images and inline emphasis/links; `head`, `script` and `style`
+	/// content is skipped. Whitespace outside `pre` collapses as a browser would.
+	/// - Parameter budget: Meters elements and text nodes as ``init(html:baseURL:encoding:budget:backend:)`` does.
+	/// - Parameter backend: The parser that tokenizes `html`.
+	public static func events(
+		html: Data, baseURL: URL?, encoding: String.Encoding? = nil, budget: ResourceBudget? = nil,
+		backend: HTMLParsingBackend = .libxml2,
+		_ emit: DocumentEventHandler
+	) async throws {
+		var mapper = HTMLEventMapper(baseURL: baseURL, budget: budget ?? ResourceBudget(.unlimited))
+		var parserError: HTMLParserError?
+		switch backend {
+		case .libxml2:
+			let parser = makeParser(html, encoding: encoding)
+			for await event in parser.parseEvents() {
+				try mapper.apply(event, emit)
+			}
+			parserError = parser.error as? HTMLParserError
+		case .native:
+			for token in HTMLTokenizer(utf8: utf8Input(html, encoding: encoding)) {
+				try mapper.apply(token, emit)
+			}
+		}
+		try mapper.finish(emit)
+		if !mapper.sawElement {
+			let parseError = mapper.parseError ?? parserError
+			throw DomBuilderError.parsingFailed(parseError ?? HTMLParserFallbackError.parseFailed)
+		}
+	}
+}
+
+/// Maps HTML parser events to document events. Blocks nest only as deep as the
+/// event grammar allows: a `p` or `div` inside a list item or table cell joins
+/// its content instead of opening a block of its own.
+struct HTMLEventMapper {
+	private enum Block {
+		case paragraph(implicit: Bool)
+		case heading
+		case listItem
+		case codeBlock
+		case tableCell
+	}
+
+	private static let headingLevels = ["h1": 1, "h2": 2, "h3": 3, "h4": 4, "h5": 5, "h6": 6]
+	private static let blockBoundaries: Set<String> = [
+		"div", "section", "article", "header", "footer", "main", "aside", "nav",
+		"figure", "figcaption", "address", "center", "dl", "dt", "dd", "form", "fieldset",
+		"body", "html",
+	]
+	private static let skipped: Set<String> = ["head", "script", "style", "template", "noscript", "title"]
+
+	private let baseURL: URL?
+	private let budget: ResourceBudget
+	private var nodeCount = 0
+	private(set) var sawElement = false
+	private(set) var parseError: HTMLParserError?
+
+	private var elements: [String] = []
+	/// Inline style in effect, one entry per open inline element (plus the base).
+	private var styles: [(element: Int, style: DocumentTextStyle)] = [(-1, .plain)]
+	private var block: Block?
+	/// The element depth that opened `block`, or `nil` for an implicit one.
+	private var blockOwner: Int?
+	private var lists: [Bool] = []
+	private var quoteDepth = 0
+	private var skipDepth: Int?
+	/// Collapsed whitespace waiting for the next content, with the style it had.
+	private var pendingSpace: DocumentTextStyle?
+	private var atBlockStart = true
+
+	/// `pre` seen but not yet opened: the language may still come from `<code class>`.
+	private var pendingCodeLanguage: String??
+	private var pendingCodeNewline = false
+
+	private var tableDepth = 0
+	private var inTableHead = false
+	/// The first row of the outermost table is held back until its cells reveal the
+	/// column alignments `beginTable` needs.
+	private var tableBuffer: [DocumentEvent]?
+	private var tableAlignments: [DocumentColumnAlignment] = []
+	private var tableRows = 0
+	private var rowIsHeader = false
+	private var rowHasCells = false
+
+	init(baseURL: URL?, budget: ResourceBudget) {
+		self.baseURL = baseURL
+		self.budget = budget
+	}
+
+	mutating func apply(_ event: HTMLParserEvent, _ emit: DocumentEventHandler) throws {
+		if case let .parseError(error) = event {
+			parseError = error
+		} else if let token = HTMLToken(event) {
+			try apply(token, emit)
+		}
+	}
+
+	mutating func apply(_ token: HTMLToken, _ emit: DocumentEventHandler) throws {
+		switch token {
+		case .comment, .rawText:
+			return
+		case let .startElement(name, attributes):
+			try chargeNode()
+			sawElement = true
+			try startElement(name.lowercased(), attributes: attributes, emit)
+		case let .endElement(name):
+			try endElement(name.lowercased(), emit)
+		case let .characters(string):
+			try chargeNode()
+			try characters(string, emit)
+		}
+	}
+
+	mutating func finish(_ emit: DocumentEventHandler) throws {
+		while !elements.isEmpty {
+			try endElement(elements[elements.count - 1], emit)
+		}
+		try closeBlock(emit)
+		while quoteDepth > 0 {
+			quoteDepth -= 1
+			try send(.endBlockQuote, emit)
+		}
+	}
+
+	private mutating func chargeNode() throws {
+		try budget.charge(.domNodes)
+		nodeCount += 1
+		if nodeCount & 0x3FF == 0 { try budget.checkpoint() }
+	}
+
+	// MARK: - Elements
+
+	private mutating func startElement(_ name: String, attributes: [String: String], _ emit: DocumentEventHandler) throws {
+		elements.append(name)
+		let depth = elements.count - 1
+		guard skipDepth == nil else { return }
+		if Self.skipped.contains(name) {
+			skipDepth = depth
+			return
+		}
+		var style = styles[styles.count - 1].style
+
+		switch name {
+		case "p", _ where Self.blockBoundaries.contains(name):
+			if isNestedInContainer {
+				separateInline()
+			} else {
+				try closeBlock(emit)
+				if name == "p" { try openBlock(.paragraph(implicit: false), owner: depth, emit) }
+			}
+		case _ where Self.headingLevels[name] != nil:
+			try closeBlock(emit)
+			try openBlock(.heading, owner: depth, emit, event: .beginHeading(level: Self.headingLevels[name]!))
+		case "ul", "ol":
+			// A nested list leaves its parent item open; its first item closes it.
+			if case .listItem? = block {} else { try closeBlock(emit) }
+			lists.append(name == "ol")
+		case "li":
+			try closeBlock(emit)
+			let level = max(lists.count - 1, 0)
+			try openBlock(.listItem, owner: depth, emit, event: .beginListItem(level: level, ordered: lists.last ?? false))
+		case "pre":
+			try closeBlock(emit)
+			pendingCodeLanguage = .some(nil)
+			blockOwner = depth
+		case "code" where pendingCodeLanguage != nil:
+			if let classes = attributes["class"]?.split(separator: " "),
+			   let language = classes.first(where: { $0.hasPrefix("language-") }) {
+				pendingCodeLanguage = .some(String(language.dropFirst("language-".count)))
+			}
+		case "blockquote":
+			try closeBlock(emit)
+			quoteDepth += 1
+			try send(.beginBlockQuote, emit)
+		case "table":
+			try closeBlock(emit)
+			tableDepth += 1
+			if tableDepth == 1 {
+				tableBuffer = []
+				tableAlignments = []
+				tableRows = 0
+			}
+		case "thead":
+			inTableHead = true
+		case "tr" where tableDepth == 1:
+			rowIsHeader = inTableHead
+			rowHasCells = false
+			try send(.beginTableRow(header: rowIsHeader), emit)
+		case "td", "th":
+			guard tableDepth == 1 else { separateInline(); break }
+			if tableRows == 0 && !rowHasCells && name == "th" && !rowIsHeader {
+				// A leading `th` row is the header even without a `thead`.
+				rowIsHeader = true
+				if let index = tableBuffer?.lastIndex(of: .beginTableRow(header: false)) {
+					tableBuffer?[index] = .beginTableRow(header: true)
+				}
+			}
+			if tableRows == 0 {
+				tableAlignments.append(Self.alignment(from: attributes))
+			}
+			rowHasCells = true
+			try closeBlock(emit)
+			try openBlock(.tableCell, owner: depth, emit, event: .beginTableCell)
+		case "b", "strong":
+			style.bold = true
+		case "i", "em", "cite", "var", "dfn":
+			style.italic = true
+		case "u", "ins":
+			style.underline = true
+		case "s", "del", "strike":
+			style.strikethrough = true
+		case "code", "tt", "kbd", "samp":
+			style.code = true
+		case "a":
+			if let href = attributes["href"], !href.hasPrefix("javascript:") {
+				style.link = URL(string: href, relativeTo: baseURL)?.absoluteString ?? href
+			}
+		case "img":
+			guard let src = attributes["src"], !src.isEmpty, !inTableRowOutsideCell, !inCode else { break }
+			let image = DocumentEvent.image(
+				source: URL(string: src, relativeTo: baseURL)?.absoluteString ?? src,
+				alt: attributes["alt"] ?? ""
+			)
+			if block != nil {
+				try emitPendingSpace(emit)
+				atBlockStart = false
+			}
+			try send(image, emit)
+		case "br":
+			if pendingCodeLanguage != nil {
+				try openPendingCode(emit)
+				pendingCodeNewline = true
+			} else if inCode {
+				try send(.lineBreak, emit)
+			} else if block != nil {
+				try send(.lineBreak, emit)
+				pendingSpace = nil
+				atBlockStart = true
+			}
+		case "hr":
+			try closeBlock(emit)
+			try send(.horizontalRule, emit)
+		default:
+			break
+		}
+
+		if style != styles[styles.count - 1].style {
+			styles.append((depth, style))
+		}
+	}
+
+	private mutating func endElement(_ name: String, _ emit: DocumentEventHandler) throws {
+		// Tolerate mismatched end tags: close back to the nearest matching open element.
+		guard let index = elements.lastIndex(of: name) else { return }
+		while elements.count > index + 1 {
+			try endElement(elements[elements.count - 1], emit)
+		}
+		let depth = elements.count - 1
+		elements.removeLast()
+		if let skip = skipDepth {
+			if skip == depth { skipDepth = nil }
+			return
+		}
+		while let last = styles.last, last.element >= depth {
+			styles.removeLast()
+		}
+
+		switch name {
+		case "pre":
+			// An empty `pre` never opened its code block.
+			pendingCodeLanguage = nil
+			if case .codeBlock? = block {
+				try send(.endCodeBlock, emit)
+				block = nil
+				blockOwner = nil
+			}
+			pendingCodeNewline = false
+		case "ul", "ol":
+			if !lists.isEmpty { lists.removeLast() }
+		case "blockquote":
+			try closeBlock(emit)
+			if quoteDepth > 0 {
+				quoteDepth -= 1
+				try send(.endBlockQuote, emit)
+			}
+		case "thead":
+			inTableHead = false
+		case "tr" where tableDepth == 1:
+			if case .tableCell? = block { try closeBlock(emit) }
+			try send(.endTableRow, emit)
+			tableRows += 1
+			if tableRows == 1 { try flushTableBuffer(emit) }
+		case "table":
+			if tableDepth == 1 {
+				if case .tableCell? = block { try closeBlock(emit) }
+				try flushTableBuffer(emit)
+				try send(.endTable, emit)
+			}
+			tableDepth = max(tableDepth - 1, 0)
+		default:
+			if blockOwner == depth, block != nil {
+				try closeBlock(emit)
+			}
+		}
+	}
+
+	// MARK: - Text
+
+	private mutating func characters(_ string: String, _ emit: DocumentEventHandler) throws {
+		guard skipDepth == nil else { return }
+		if pendingCodeLanguage != nil || inCode {
+			try preformatted(string, emit)
+			return
+		}
+		let collapsed = Self.collapsingWhitespace(string)
+		guard !collapsed.isEmpty else { return }
+		if collapsed == " " {
+			recordSpace()
+			return
+		}
+		if inTableRowOutsideCell { return }
+		if block == nil {
+			try openBlock(.paragraph(implicit: true), owner: nil, emit)
+		}
+		var text = Substring(collapsed)
+		if text.first == " " {
+			text = text.dropFirst()
+			recordSpace()
+		}
+		var trailingSpace = false
+		if text.last == " " {
+			text = text.dropLast()
+			trailingSpace = true
+		}
+		try emitPendingSpace(emit)
+		try send(.text(String(text), currentStyle), emit)
+		atBlockStart = false
+		if trailingSpace { recordSpace() }
+	}
+
+	/// Text inside `pre`: kept verbatim, with newlines as line breaks. The newline
+	/// right after `<pre>` and the one before `</pre>` are dropped, as in HTML.
+	private mutating func preformatted(_ string: String, _ emit: DocumentEventHandler) throws {
+		var string = Substring(string)
+		if pendingCodeLanguage != nil {
+			if string.first == "\n" { string = string.dropFirst() }
+			guard !string.isEmpty else { return }
+			try openPendingCode(emit)
+		}
+		for (index, line) in string.split(separator: "\n", omittingEmptySubsequences: false).enumerated() {
+			if index > 0 {
+				if pendingCodeNewline { try send(.lineBreak, emit) }
+				pendingCodeNewline = true
+			}
+			if !line.isEmpty {
+				if pendingCodeNewline {
+					try send(.lineBreak, emit)
+					pendingCodeNewline = false
+				}
+				try send(.text(String(line), .plain), emit)
+			}
+		}
+	}
+
+	private static func collapsingWhitespace(_ string: String) -> String {
+		var result = ""
+		result.reserveCapacity(string.utf8.count)
+		var lastWasSpace = false
+		for scalar in string.unicodeScalars {
+			// U+00A0 is a non-collapsing space; keep it.
+			if scalar.properties.isWhitespace && scalar != "\u{00A0}" {
+				if !lastWasSpace { result.unicodeScalars.append(" ") }
+				lastWasSpace = true
+			} else {
+				result.unicodeScalars.append(scalar)
+				lastWasSpace = false
+			}
+		}
+		return result
+	}
+
+	/// Notes collapsed whitespace; it is written only if more content follows in
+	/// the block, in the style of the text it followed.
+	private mutating func recordSpace() {
+		guard block != nil, !atBlockStart, pendingSpace == nil else { return }
+		pendingSpace = currentStyle
+	}
+
+	private mutating func emitPendingSpace(_ emit: DocumentEventHandler) throws {
+		guard let style = pendingSpace else { return }
+		pendingSpace = nil
+		try send(.text(" ", style), emit)
+	}
+
+	/// A block boundary inside a list item or cell: keep words apart.
+	private mutating func separateInline() {
+		recordSpace()
+	}
+
+	// MARK: - Blocks
+
+	private var isNestedInContainer: Bool {
+		switch block {
+		case .listItem?, .tableCell?: return true
+		default: return false
+		}
+	}
+
+	private var inCode: Bool {
+		if case .codeBlock? = block { return true }
+		return false
+	}
+
+	private var currentStyle: DocumentTextStyle {
+		styles[styles.count - 1].style
+	}
+
+	private var inTableRowOutsideCell: Bool {
+		guard tableDepth > 0 else { return false }
+		if case .tableCell? = block { return false }
+		return true
+	}
+
+	private mutating func openBlock(_ kind: Block, owner: Int?, _ emit: DocumentEventHandler, event: DocumentEvent = .beginParagraph) throws {
+		block = kind
+		blockOwner = owner
+		atBlockStart = true
+		pendingSpace = nil
+		try send(event, emit)
+	}
+
+	private mutating func closeBlock(_ emit: DocumentEventHandler) throws {
+		guard let open = block else { return }
+		block = nil
+		blockOwner = nil
+		pendingSpace = nil
+		switch open {
+		case .paragraph: try send(.endParagraph, emit)
+		case .heading: try send(.endHeading, emit)
+		case .listItem: try send(.endListItem, emit)
+		case .codeBlock: try send(.endCodeBlock, emit)
+		case .tableCell: try send(.endTableCell, emit)
+		}
+	}
+
+	private mutating func openPendingCode(_ emit: DocumentEventHandler) throws {
+		guard let language = pendingCodeLanguage else { return }
+		pendingCodeLanguage = nil
+		// `blockOwner` already names the `pre` element.
+		block = .codeBlock
+		pendingCodeNewline = false
+		try send(.beginCodeBlock(language: language), emit)
+	}
+
+	private mutating func flushTableBuffer(_ emit: DocumentEventHandler) throws {
+		guard let buffered = tableBuffer else { return }
+		tableBuffer = nil
+		try emit(.beginTable(alignments: tableAlignments))
+		for event in buffered { try emit(event) }
+	}
+
+	private static func alignment(from attributes: [String: String]) -> DocumentColumnAlignment {
+		let declared = (attributes["align"] ?? attributes["style"] ?? "").lowercased()
+		if declared.contains("center") { return .center }
+		if declared.contains("right") { return .right }
+		return .left
+	}
+
+	private mutating func send(_ event: DocumentEvent, _ emit: DocumentEventHandler) throws {
+		if tableBuffer != nil {
+			tableBuffer?.append(event)
+		} else {
+			try emit(event)
+		}
+	}
+}
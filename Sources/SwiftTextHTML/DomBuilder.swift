@@ -1,5 +1,15 @@
 import Foundation
 import HTMLParser
+import SwiftTextCore
+
+/// Which parser turns HTML bytes into the events a ``DomBuilder`` consumes.
+public enum HTMLParsingBackend: Sendable {
+	/// libxml2, through XMLKit's `HTMLParser`.
+	case libxml2
+	/// The native Swift tokenizer: no C boundary or bridging per element, with
+	/// the implied-element and auto-closing rules DOM construction relies on.
+	case native
+}
 
 public final class DomBuilder {
 	// MARK: - Public Properties
@@ -10,10 +20,21 @@ public final class DomBuilder {
 
 	private let baseURL: URL?
 	private let encoding: String.Encoding?
-
-	public init(html: Data, baseURL: URL?, encoding: String.Encoding? = nil) async throws {
+	private let budget: ResourceBudget?
+	private let backend: HTMLParsingBackend
+
+	/// Parses `html` into a DOM.
+	/// - Parameter budget: Meters DOM nodes (and the deadline) against the caller's
+	///   ``ResourceLimits``; parsing stops with a `ResourceLimitError` once exceeded.
+	/// - Parameter backend: The parser that tokenizes `html`.
+	public init(
+		html: Data, baseURL: URL?, encoding: String.Encoding? = nil, budget: ResourceBudget? = nil,
+		backend: HTMLParsingBackend = .libxml2
+	) async throws {
 		self.baseURL = baseURL
 		self.encoding = encoding
+		self.budget = budget
+		self.backend = backend
 
 		try await parseHTML(html)
 	}
@@ -21,32 +42,26 @@ public final class DomBuilder {
 	// MARK: - Async Parsing
 
 	private func parseHTML(_ html: Data) async throws {
-		let options: HTMLParserOptions = [.noWarning, .noError, .noNet, .recover]
-
-		// If the caller provides an explicit encoding hint, honor it and parse the original bytes.
-		// Otherwise we normalize common bogus legacy charset declarations when the bytes are valid UTF-8.
-		let dataToParse: Data
-		let encodingToUse: String.Encoding
-		if let encoding {
-			dataToParse = html
-			encodingToUse = encoding
-		} else {
-			dataToParse = normalizeCharsetIfNeeded(html)
-			encodingToUse = .utf8
-		}
-
-		let parser = HTMLParser(data: dataToParse, encoding: encodingToUse, options: options)
-
-		let state = DOMBuilderState(baseURL: baseURL)
-
-		for await event in parser.parseEvents() {
-			await state.apply(event)
+		let state = DOMBuilderState(baseURL: baseURL, budget: budget)
+		var parserError: HTMLParserError?
+
+		switch backend {
+		case .libxml2:
+			let parser = Self.makeParser(html, encoding: encoding)
+			for await event in parser.parseEvents() {
+				try await state.apply(event)
+			}
+			parserError = parser.error as? HTMLParserError
+		case .native:
+			for token in HTMLTokenizer(utf8: Self.utf8Input(html, encoding: encoding)) {
+				try await state.apply(token)
+			}
 		}
 
 		root = await state.rootElement()
 
 		if root == nil {
-			if let parseError = await state.recordedParseError() ?? (parser.error as? HTMLParserError) {
+			if let parseError = await state.recordedParseError() ?? parserError {
 				throw DomBuilderError.parsingFailed(parseError)
 			}
 
@@ -54,29 +69,67 @@ public final class DomBuilder {
 		}
 	}
 
+	static func makeParser(_ html: Data, encoding: String.Encoding?) -> HTMLParser {
+		let options: HTMLParserOptions = [.noWarning, .noError, .noNet, .recover]
+
+		// If the caller provides an explicit encoding hint, honor it and parse the original bytes.
+		if let encoding {
+			return HTMLParser(data: html, encoding: encoding, options: options)
+		}
+		let (data, sniffed) = normalizeCharsetIfNeeded(html)
+		return HTMLParser(data: data, encoding: sniffed, options: options)
+	}
+
 	/// Some HTML (notably email bodies) declares `charset=iso-8859-1` (or similar)
 	/// while the actual bytes are valid UTF-8. libxml/HTMLParser will honor the declared
 	/// charset and produce mojibake (e.g. "fÃ¼r" instead of "für").
 	///
 	/// If the HTML bytes are valid UTF-8, we rewrite common legacy charset declarations
-	/// to `utf-8` before parsing so that entities/text decode correctly.
-	private func normalizeCharsetIfNeeded(_ html: Data) -> Data {
-		guard let utf8 = String(data: html, encoding: .utf8) else {
-			return html
-		}
+	/// to `utf-8` before parsing so that entities/text decode correctly; the rest of
+	/// the document is copied once, untouched. Bytes that aren't UTF-8 are returned
+	/// as they are, with the encoding their byte-order mark or declaration names, so
+	/// the parser decodes them as it goes.
+	private static func normalizeCharsetIfNeeded(_ html: Data) -> (Data, String.Encoding) {
+		html.withUnsafeBytes { bytes -> (Data, String.Encoding) in
+			if let bom = HTMLCharsetSniffer.byteOrderMark(in: bytes), bom != .utf8 {
+				return (html, bom)
+			}
+			let declarations = HTMLCharsetSniffer.declarations(in: bytes)
+			guard HTMLCharsetSniffer.isValidUTF8(bytes) else {
+				let declared = declarations.lazy.compactMap { stringEncoding(for: $0.label) }.first
+				return (html, declared ?? .utf8)
+			}
 
-		// Only rewrite if the document explicitly claims a legacy single-byte charset.
-		let pattern = "(?i)charset\\s*=\\s*(iso-8859-1|windows-1252|latin1)"
-		guard utf8.range(of: pattern, options: .regularExpression) != nil else {
-			return html
+			// Only rewrite if the document explicitly claims a legacy single-byte charset.
+			let legacy = declarations.filter { Self.legacyLabels.contains($0.label.lowercased()) }
+			guard !legacy.isEmpty else { return (html, .utf8) }
+
+			var rewritten = Data()
+			rewritten.reserveCapacity(html.count)
+			var copied = 0
+			for declaration in legacy {
+				rewritten.append(contentsOf: UnsafeRawBufferPointer(rebasing: bytes[copied ..< declaration.labelRange.lowerBound]))
+				rewritten.append(contentsOf: "utf-8".utf8)
+				copied = declaration.labelRange.upperBound
+			}
+			rewritten.append(contentsOf: UnsafeRawBufferPointer(rebasing: bytes[copied...]))
+			return (rewritten, .utf8)
 		}
+	}
 
-		let rewritten = utf8.replacingOccurrences(
-			of: pattern,
-			with: "charset=utf-8",
-			options: .regularExpression
-		)
-		return Data(rewritten.utf8)
+	private static let legacyLabels: Set<String> = ["iso-8859-1", "windows-1252", "latin1"]
+
+	/// `html` as UTF-8 for ``HTMLTokenizer``: returned as is when it already is,
+	/// otherwise decoded once from `encoding` or the sniffed charset.
+	static func utf8Input(_ html: Data, encoding: String.Encoding?) -> Data {
+		let source = encoding ?? html.withUnsafeBytes { bytes -> String.Encoding in
+			if let bom = HTMLCharsetSniffer.byteOrderMark(in: bytes) { return bom }
+			if HTMLCharsetSniffer.isValidUTF8(bytes) { return .utf8 }
+			// Undeclared stray bytes are left for the tokenizer to replace.
+			return HTMLCharsetSniffer.declarations(in: bytes).lazy.compactMap { stringEncoding(for: $0.label) }.first ?? .utf8
+		}
+		guard source != .utf8, let decoded = String(data: html, encoding: source) else { return html }
+		return Data(decoded.utf8)
 	}
 }
 
@@ -86,19 +139,22 @@ public enum DomBuilderError: Error {
 	case parsingFailed(Error)
 }
 
-private enum HTMLParserFallbackError: Error {
+enum HTMLParserFallbackError: Error {
 	case parseFailed
 }
 
 private actor DOMBuilderState {
 	private let baseURL: URL?
+	private let budget: ResourceBudget
 	private let root: DOMElement
 	private var currentElement: DOMElement
 	private var elementStack: [DOMElement] = []
 	private var parseError: HTMLParserError?
+	private var nodeCount = 0
 
-	init(baseURL: URL?) {
+	init(baseURL: URL?, budget: ResourceBudget?) {
 		self.baseURL = baseURL
+		self.budget = budget ?? ResourceBudget(.unlimited)
 
 		let documentRoot = DOMElement(name: "document", attributes: [:])
 		documentRoot.isTransparentWrapper = true
@@ -106,25 +162,32 @@ private actor DOMBuilderState {
 		self.currentElement = documentRoot
 	}
 
-	func apply(_ event: HTMLParserEvent) {
-		switch event {
-		case .startDocument, .endDocument, .comment, .processingInstruction:
+	func apply(_ event: HTMLParserEvent) throws {
+		if case let .parseError(error) = event {
+			parseError = error
+		} else if let token = HTMLToken(event) {
+			try apply(token)
+		}
+	}
+
+	func apply(_ token: HTMLToken) throws {
+		switch token {
+		case .comment:
 			return
 
 		case let .startElement(name, attributes):
+			try chargeNode()
 			handleStartElement(name, attributes: attributes)
 
 		case let .endElement(name):
 			handleEndElement(name)
 
 		case let .characters(string):
+			try chargeNode()
 			handleCharacters(string)
 
-		case let .cdata(data):
-			handleCDATA(data)
-
-		case let .parseError(error):
-			parseError = error
+		case let .rawText(string):
+			handleRawText(string)
 		}
 	}
 
@@ -132,6 +195,14 @@ private actor DOMBuilderState {
 		root
 	}
 
+	/// Counts one element or text event against the budget; cancellation and the
+	/// deadline are consulted every 1024 nodes so the checks stay off the hot path.
+	private func chargeNode() throws {
+		try budget.charge(.domNodes)
+		nodeCount += 1
+		if nodeCount & 0x3FF == 0 { try budget.checkpoint() }
+	}
+
 	func recordedParseError() -> HTMLParserError? {
 		parseError
 	}
@@ -185,9 +256,8 @@ private extension DOMBuilderState {
 	/// as a DOMRawText child so the CSS/JS is available from the tree without
 	/// re-parsing, yet stays distinct from rendered text. CDATA outside a
 	/// raw-text element is ignored, as before.
-	func handleCDATA(_ data: Data) {
-		guard isRawTextElement(currentElement.name),
-		      let string = String(data: data, encoding: .utf8) else { return }
+	func handleRawText(_ string: String) {
+		guard isRawTextElement(currentElement.name) else { return }
 		appendRawText(string)
 	}
 
@@ -0,0 +1,128 @@
+import Foundation
+
+/// Works out how to hand HTML bytes to the parser without decoding them first.
+///
+/// The byte-order mark and any `charset=` declaration are looked for only in
+/// the document's head, and UTF-8 validity is checked in place, so a document
+/// is never turned into a `String` and back just to choose an encoding. Bytes
+/// in a legacy encoding go to the parser as they are, with that encoding, and
+/// libxml converts them to UTF-8 incrementally as it reads.
+enum HTMLCharsetSniffer {
+	/// How far into the document to look for a `charset=` declaration when no
+	/// `<body` comes sooner. Email bodies put long `<style>` blocks ahead of
+	/// their `<meta>`, so this is well past the 1024 bytes browsers prescan.
+	static let prescanLimit = 64 * 1024
+
+	/// A `charset=` declaration: the label and the bytes it occupies, without
+	/// any quotes.
+	struct Declaration {
+		let label: String
+		let labelRange: Range<Int>
+	}
+
+	/// The encoding a byte-order mark at the start of `bytes` announces.
+	static func byteOrderMark(in bytes: UnsafeRawBufferPointer) -> String.Encoding? {
+		if bytes.count >= 3, bytes[0] == 0xEF, bytes[1] == 0xBB, bytes[2] == 0xBF { return .utf8 }
+		if bytes.count >= 2, bytes[0] == 0xFF, bytes[1] == 0xFE { return .utf16LittleEndian }
+		if bytes.count >= 2, bytes[0] == 0xFE, bytes[1] == 0xFF { return .utf16BigEndian }
+		return nil
+	}
+
+	/// Whether `bytes` is well-formed UTF-8: no overlong forms, surrogates, or
+	/// scalars past U+10FFFF. ASCII is skipped sixteen bytes at a time.
+	static func isValidUTF8(_ bytes: UnsafeRawBufferPointer) -> Bool {
+		let count = bytes.count
+		var index = 0
+		while index < count {
+			while index + 16 <= count {
+				let chunk = bytes.loadUnaligned(fromByteOffset: index, as: SIMD16<UInt8>.self)
+				if any(chunk .>= 0x80) { break }
+				index += 16
+			}
+			guard index < count else { return true }
+
+			let lead = bytes[index]
+			if lead < 0x80 {
+				index += 1
+				continue
+			}
+			// The lead byte fixes the length and narrows the second byte's range.
+			let length: Int
+			var lower: UInt8 = 0x80
+			var upper: UInt8 = 0xBF
+			switch lead {
+			case 0xC2 ... 0xDF: length = 2
+			case 0xE0: length = 3; lower = 0xA0
+			case 0xE1 ... 0xEC, 0xEE, 0xEF: length = 3
+			case 0xED: length = 3; upper = 0x9F
+			case 0xF0: length = 4; lower = 0x90
+			case 0xF1 ... 0xF3: length = 4
+			case 0xF4: length = 4; upper = 0x8F
+			default: return false
+			}
+			guard index + length <= count, (lower ... upper).contains(bytes[index + 1]) else { return false }
+			for offset in 2 ..< length where bytes[index + offset] & 0xC0 != 0x80 {
+				return false
+			}
+			index += length
+		}
+		return true
+	}
+
+	/// Every `charset=` declaration before `<body` (or ``prescanLimit``), matched
+	/// case-insensitively with optional whitespace around `=` and optional quotes
+	/// around the label.
+	static func declarations(in bytes: UnsafeRawBufferPointer) -> [Declaration] {
+		let end = min(bytes.count, prescanLimit)
+		var found: [Declaration] = []
+		var index = 0
+		while index + 7 <= end {
+			if matches("<body", in: bytes, at: index) { break }
+			guard matches("charset", in: bytes, at: index) else {
+				index += 1
+				continue
+			}
+			index += 7
+			index = skipSpaces(in: bytes, from: index, to: end)
+			guard index < end, bytes[index] == UInt8(ascii: "=") else { continue }
+			index = skipSpaces(in: bytes, from: index + 1, to: end)
+			if index < end, bytes[index] == UInt8(ascii: "\"") || bytes[index] == UInt8(ascii: "'") { index += 1 }
+			let labelStart = index
+			while index < end, isLabelByte(bytes[index]) { index += 1 }
+			guard index > labelStart else { continue }
+			let label = String(decoding: UnsafeRawBufferPointer(rebasing: bytes[labelStart ..< index]), as: UTF8.self)
+			found.append(Declaration(label: label, labelRange: labelStart ..< index))
+		}
+		return found
+	}
+
+	/// Whether the ASCII `word` occurs at `index`, ignoring case.
+	private static func matches(_ word: StaticString, in bytes: UnsafeRawBufferPointer, at index: Int) -> Bool {
+		guard index + word.utf8CodeUnitCount <= bytes.count else { return false }
+		let pointer = word.utf8Start
+		for offset in 0 ..< word.utf8CodeUnitCount where bytes[index + offset] | 0x20 != pointer[offset] {
+			return false
+		}
+		return true
+	}
+
+	private static func skipSpaces(in bytes: UnsafeRawBufferPointer, from start: Int, to end: Int) -> Int {
+		var index = start
+		while index < end, bytes[index] == 0x20 || bytes[index] == 0x09 || bytes[index] == 0x0A || bytes[index] == 0x0D {
+			index += 1
+		}
+		return index
+	}
+
+	/// Letters, digits and the `-`, `_`, `.`, `:` found in charset names.
+	private static func isLabelByte(_ byte: UInt8) -> Bool {
+		switch byte {
+		case UInt8(ascii: "a") ... UInt8(ascii: "z"), UInt8(ascii: "A") ... UInt8(ascii: "Z"),
+		     UInt8(ascii: "0") ... UInt8(ascii: "9"),
+		     UInt8(ascii: "-"), UInt8(ascii: "_"), UInt8(ascii: "."), UInt8(ascii: ":"):
+			return true
+		default:
+			return false
+		}
+	}
+}
@@ -8,9 +8,11 @@ public final class HTMLDocument {
 	public let root: DOMElement
 	public let baseURL: URL?
 
-	public init(data: Data, baseURL: URL? = nil, encoding: String.Encoding? = nil) async throws {
+	public init(
+		data: Data, baseURL: URL? = nil, encoding: String.Encoding? = nil, backend: HTMLParsingBackend = .libxml2
+	) async throws {
 		self.baseURL = baseURL
-		let builder = try await DomBuilder(html: data, baseURL: baseURL, encoding: encoding)
+		let builder = try await DomBuilder(html: data, baseURL: baseURL, encoding: encoding, backend: backend)
 		guard let root = builder.root else {
 			throw HTMLDocumentError.missingRoot
 		}
@@ -0,0 +1,589 @@
+import Foundation
+
+/// What a parser backend hands to ``DomBuilder``: the subset of
+/// `HTMLParserEvent` the DOM and the document-event mapper act on.
+enum HTMLToken {
+	case startElement(String, attributes: [String: String])
+	case endElement(String)
+	case characters(String)
+	/// The unparsed body of a `<script>` or `<style>` element.
+	case rawText(String)
+	case comment(String)
+
+	/// The token libxml2's `event` stands for, or `nil` for document
+	/// boundaries, processing instructions and errors.
+	init?(_ event: HTMLParserEvent) {
+		switch event {
+		case let .startElement(name, attributes):
+			self = .startElement(name, attributes: attributes)
+		case let .endElement(name):
+			self = .endElement(name)
+		case let .characters(string):
+			self = .characters(string)
+		case let .cdata(data):
+			self = .rawText(String(decoding: data, as: UTF8.self))
+		case let .comment(comment):
+			self = .comment(comment)
+		case .startDocument, .endDocument, .processingInstruction, .parseError:
+			return nil
+		}
+	}
+}
+
+/// A native HTML tokenizer with the tree-construction subset ``DomBuilder``
+/// relies on, reading UTF-8 bytes directly.
+///
+/// Text runs are scanned sixteen bytes at a time for `<` and `&`, and tag and
+/// attribute names are lowercased and interned, so a document's thousands of
+/// `<p>` and `class` spellings share one `String` each. Like libxml2 in recover
+/// mode it implies `html`, `head` and `body`, closes `p`, `li`, `dt`/`dd`,
+/// table parts and `option` when a sibling opens, ends void and `/>` elements
+/// at once, closes everything still open at the end, and decodes the HTML 4
+/// named character references. Also like libxml2, it opens at most
+/// ``maximumDepth`` elements at a time, so hostile nesting can't reach the
+/// recursive style, box and layout passes.
+final class HTMLTokenizer: Sequence, IteratorProtocol {
+	/// libxml2's `xmlParserMaxDepth` without `HTML_PARSE_HUGE`. Elements opened
+	/// past it are dropped, and their content goes to the deepest open element.
+	static let maximumDepth = 256
+
+	private let storage: UnsafeMutableRawBufferPointer
+	private let count: Int
+	private var index = 0
+
+	private var pending: [HTMLToken] = []
+	private var pendingIndex = 0
+	private var finished = false
+
+	private var open: [String] = []
+	/// Elements dropped past ``maximumDepth``, innermost last; they emit no tokens.
+	private var overflow: [String] = []
+	private var sawHead = false
+	private var sawBody = false
+	/// `</html>` was seen: later content goes at the top level, unwrapped.
+	private var closedRoot = false
+
+	private var names = NameTable()
+	private var scratch: [UInt8] = []
+
+	/// Tokenize `utf8`, which may start with a byte-order mark.
+	init(utf8: Data) {
+		count = utf8.count
+		storage = .allocate(byteCount: max(count, 1), alignment: 16)
+		utf8.withUnsafeBytes { storage.copyMemory(from: $0) }
+		if count >= 3, storage[0] == 0xEF, storage[1] == 0xBB, storage[2] == 0xBF {
+			index = 3
+		}
+	}
+
+	deinit {
+		storage.deallocate()
+	}
+
+	func next() -> HTMLToken? {
+		while pendingIndex == pending.count {
+			if finished { return nil }
+			pending.removeAll(keepingCapacity: true)
+			pendingIndex = 0
+			advance()
+		}
+		defer { pendingIndex += 1 }
+		return pending[pendingIndex]
+	}
+
+	private var bytes: UnsafeRawBufferPointer {
+		UnsafeRawBufferPointer(rebasing: storage[0 ..< count])
+	}
+
+	private func advance() {
+		guard index < count else {
+			while !open.isEmpty { popElement() }
+			finished = true
+			return
+		}
+		if bytes[index] == UInt8(ascii: "<"), startsMarkup(at: index) {
+			readMarkup()
+		} else {
+			readText()
+		}
+	}
+
+	// MARK: - Text
+
+	private func readText() {
+		scratch.removeAll(keepingCapacity: true)
+		var runStart = index
+		while index < count {
+			index = Self.firstIndex(of: UInt8(ascii: "<"), or: UInt8(ascii: "&"), in: bytes, from: index, to: count)
+			guard index < count else { break }
+			if bytes[index] == UInt8(ascii: "<") {
+				if startsMarkup(at: index) { break }
+				index += 1
+				continue
+			}
+			scratch.append(contentsOf: bytes[runStart ..< index])
+			index = decodeReference(at: index, inAttribute: false, into: &scratch)
+			runStart = index
+		}
+		let text: String
+		if scratch.isEmpty {
+			text = String(decoding: UnsafeRawBufferPointer(rebasing: bytes[runStart ..< index]), as: UTF8.self)
+		} else {
+			scratch.append(contentsOf: bytes[runStart ..< index])
+			text = String(decoding: scratch, as: UTF8.self)
+		}
+		insertText(text)
+	}
+
+	private func insertText(_ text: String) {
+		let isBlank = text.utf8.allSatisfy(Self.isSpace)
+		if !closedRoot {
+			if isBlank {
+				// libxml2 drops whitespace outside the body.
+				guard sawBody, open.last != "html", open.last != "head" else { return }
+			} else {
+				openBodyIfNeeded()
+			}
+		} else if isBlank && open.isEmpty {
+			return
+		}
+		pending.append(.characters(text))
+	}
+
+	// MARK: - Markup
+
+	/// Whether the `<` at `position` opens a tag, end tag, comment or
+	/// declaration rather than standing for itself.
+	private func startsMarkup(at position: Int) -> Bool {
+		guard position + 1 < count else { return false }
+		let next = bytes[position + 1]
+		return Self.isLetter(next) || next == UInt8(ascii: "/") || next == UInt8(ascii: "!") || next == UInt8(ascii: "?")
+	}
+
+	private func readMarkup() {
+		let next = bytes[index + 1]
+		if next == UInt8(ascii: "!") {
+			if matches("<!--", at: index) {
+				readComment()
+			} else {
+				skipPast(UInt8(ascii: ">"))
+			}
+		} else if next == UInt8(ascii: "?") {
+			skipPast(UInt8(ascii: ">"))
+		} else if next == UInt8(ascii: "/") {
+			readEndTag()
+		} else {
+			readStartTag()
+		}
+	}
+
+	private func readComment() {
+		let start = index + 4
+		var end = start
+		while true {
+			end = Self.firstIndex(of: UInt8(ascii: "-"), or: UInt8(ascii: "-"), in: bytes, from: end, to: count)
+			if end >= count || matches("-->", at: end) { break }
+			end += 1
+		}
+		pending.append(.comment(String(decoding: UnsafeRawBufferPointer(rebasing: bytes[start ..< min(end, count)]), as: UTF8.self)))
+		index = min(end + 3, count)
+	}
+
+	private func readStartTag() {
+		index += 1
+		let name = readName()
+		var attributes: [String: String] = [:]
+		var selfClosing = false
+		while index < count {
+			skipSpaces()
+			guard index < count else { break }
+			let byte = bytes[index]
+			if byte == UInt8(ascii: ">") {
+				index += 1
+				break
+			}
+			if byte == UInt8(ascii: "/") {
+				index += 1
+				selfClosing = index < count && bytes[index] == UInt8(ascii: ">")
+				continue
+			}
+			let attribute = readName()
+			skipSpaces()
+			var value = ""
+			if index < count, bytes[index] == UInt8(ascii: "=") {
+				index += 1
+				skipSpaces()
+				value = readAttributeValue()
+			}
+			if attributes[attribute] == nil { attributes[attribute] = value }
+		}
+		insertStart(name, attributes: attributes, selfClosing: selfClosing)
+	}
+
+	private func readEndTag() {
+		index += 2
+		guard index < count, Self.isLetter(bytes[index]) else {
+			skipPast(UInt8(ascii: ">"))
+			return
+		}
+		let name = readName()
+		skipPast(UInt8(ascii: ">"))
+		insertEnd(name)
+	}
+
+	/// A lowercased, interned tag or attribute name.
+	private func readName() -> String {
+		let start = index
+		index += 1
+		while index < count {
+			let byte = bytes[index]
+			if Self.isSpace(byte) || byte == UInt8(ascii: "/") || byte == UInt8(ascii: ">") || byte == UInt8(ascii: "=") { break }
+			index += 1
+		}
+		return names.name(UnsafeRawBufferPointer(rebasing: bytes[start ..< index]))
+	}
+
+	private func readAttributeValue() -> String {
+		guard index < count else { return "" }
+		let quote = bytes[index]
+		let start: Int
+		let end: Int
+		if quote == UInt8(ascii: "\"") || quote == UInt8(ascii: "'") {
+			start = index + 1
+			end = Self.firstIndex(of: quote, or: quote, in: bytes, from: start, to: count)
+			index = min(end + 1, count)
+		} else {
+			start = index
+			while index < count, !Self.isSpace(bytes[index]), bytes[index] != UInt8(ascii: ">") { index += 1 }
+			end = index
+		}
+		return decodingReferences(start ..< end, inAttribute: true)
+	}
+
+	/// The text in `range` with character references decoded.
+	private func decodingReferences(_ range: Range<Int>, inAttribute: Bool) -> String {
+		var position = Self.firstIndex(of: UInt8(ascii: "&"), or: UInt8(ascii: "&"), in: bytes, from: range.lowerBound, to: range.upperBound)
+		guard position < range.upperBound else {
+			return String(decoding: UnsafeRawBufferPointer(rebasing: bytes[range]), as: UTF8.self)
+		}
+		scratch.removeAll(keepingCapacity: true)
+		scratch.append(contentsOf: bytes[range.lowerBound ..< position])
+		while position < range.upperBound {
+			if bytes[position] == UInt8(ascii: "&") {
+				position = decodeReference(at: position, inAttribute: inAttribute, limit: range.upperBound, into: &scratch)
+			} else {
+				scratch.append(bytes[position])
+				position += 1
+			}
+		}
+		return String(decoding: scratch, as: UTF8.self)
+	}
+
+	/// Decode the reference at the `&` at `position` into `output`, returning
+	/// the index after it. An unknown reference is kept as written. In
+	/// attribute values a named reference needs its `;`, so `?a=1&copy=2`
+	/// survives in a URL.
+	private func decodeReference(at position: Int, inAttribute: Bool, limit: Int? = nil, into output: inout [UInt8]) -> Int {
+		let end = limit ?? count
+		var cursor = position + 1
+		var scalar: Unicode.Scalar?
+		if cursor < end, bytes[cursor] == UInt8(ascii: "#") {
+			cursor += 1
+			let hex = cursor < end && bytes[cursor] | 0x20 == UInt8(ascii: "x")
+			if hex { cursor += 1 }
+			let digitsStart = cursor
+			var value: UInt32 = 0
+			while cursor < end, let digit = Self.digitValue(bytes[cursor], hex: hex) {
+				value = min(value &* (hex ? 16 : 10) &+ digit, 0x110000)
+				cursor += 1
+			}
+			guard cursor > digitsStart else {
+				output.append(UInt8(ascii: "&"))
+				return position + 1
+			}
+			// NUL and values past U+10FFFF or in the surrogate range read as U+FFFD.
+			scalar = value == 0 ? "\u{FFFD}" : Unicode.Scalar(value) ?? "\u{FFFD}"
+		} else {
+			let nameStart = cursor
+			while cursor < end, cursor - nameStart < 32, Self.isLetter(bytes[cursor]) || Self.isDigit(bytes[cursor]) { cursor += 1 }
+			let terminated = cursor < end && bytes[cursor] == UInt8(ascii: ";")
+			if cursor > nameStart, terminated || !inAttribute,
+			   let value = HTMLEntities.named[String(decoding: UnsafeRawBufferPointer(rebasing: bytes[nameStart ..< cursor]), as: UTF8.self)] {
+				scalar = Unicode.Scalar(value)
+			}
+			guard scalar != nil else {
+				output.append(UInt8(ascii: "&"))
+				return position + 1
+			}
+		}
+		if cursor < end, bytes[cursor] == UInt8(ascii: ";") { cursor += 1 }
+		UTF8.encode(scalar!) { output.append($0) }
+		return cursor
+	}
+
+	// MARK: - Tree construction
+
+	private func insertStart(_ name: String, attributes: [String: String], selfClosing: Bool) {
+		if !closedRoot {
+			switch name {
+			case "html":
+				if open.isEmpty { pushElement(name, attributes: attributes) }
+				return
+			case "head":
+				openRootIfNeeded()
+				if !sawHead, !sawBody, open.last == "html" {
+					sawHead = true
+					pushElement(name, attributes: attributes)
+				}
+				return
+			case "body":
+				if !sawBody { openBody(attributes: attributes) }
+				return
+			case _ where Self.headElements.contains(name) && !sawBody:
+				openRootIfNeeded()
+				if !sawHead, open.last == "html" {
+					sawHead = true
+					pushElement("head", attributes: [:])
+				}
+			default:
+				openBodyIfNeeded()
+			}
+		}
+
+		closeImpliedElements(before: name)
+		pushElement(name, attributes: attributes)
+
+		if Self.voidElements.contains(name) || selfClosing {
+			popElement()
+		} else if name == "script" || name == "style" {
+			let end = rawTextEnd(for: name)
+			if end > index {
+				pending.append(.rawText(String(decoding: UnsafeRawBufferPointer(rebasing: bytes[index ..< end]), as: UTF8.self)))
+			}
+			index = end
+		} else if name == "title" || name == "textarea" {
+			let end = rawTextEnd(for: name)
+			if end > index { pending.append(.characters(decodingReferences(index ..< end, inAttribute: false))) }
+			index = end
+		}
+	}
+
+	private func insertEnd(_ name: String) {
+		switch name {
+		case "br":
+			// `</br>` is read as `<br>`, as browsers do.
+			insertStart(name, attributes: [:], selfClosing: true)
+			return
+		case "head":
+			if open.last == "head" { popElement() }
+			return
+		default:
+			break
+		}
+		if let position = overflow.lastIndex(of: name) {
+			overflow.removeSubrange(position...)
+			return
+		}
+		guard let position = open.lastIndex(of: name) else { return }
+		while open.count > position { popElement() }
+		if name == "html" { closedRoot = true }
+	}
+
+	/// Close whatever the HTML content model says `name` can't be nested in.
+	private func closeImpliedElements(before name: String) {
+		if Self.closesParagraph.contains(name) {
+			closeIfOpen(["p"], boundary: Self.buttonScope)
+		}
+		switch name {
+		case "li":
+			closeIfOpen(["li"], boundary: Self.listScope)
+		case "dt", "dd":
+			closeIfOpen(["dt", "dd"], boundary: Self.scope.union(["dl"]))
+		case "tr":
+			closeIfOpen(["tr"], boundary: Self.tableScope)
+		case "td", "th":
+			closeIfOpen(["td", "th"], boundary: Self.tableScope.union(["tr"]))
+		case "thead", "tbody", "tfoot":
+			closeIfOpen(["thead", "tbody", "tfoot"], boundary: ["table", "html"])
+		case "option":
+			if innermost == "option" { popElement() }
+		case "optgroup":
+			if innermost == "option" { popElement() }
+			if innermost == "optgroup" { popElement() }
+		case "h1", "h2", "h3", "h4", "h5", "h6":
+			if let last = innermost, Self.headings.contains(last) { popElement() }
+		default:
+			break
+		}
+	}
+
+	/// Pop back through the nearest open element in `targets`, unless an
+	/// element in `boundary` comes first.
+	private func closeIfOpen(_ targets: Set<String>, boundary: Set<String>) {
+		for position in open.indices.reversed() {
+			let element = open[position]
+			if targets.contains(element) {
+				while open.count > position { popElement() }
+				return
+			}
+			if boundary.contains(element) { return }
+		}
+	}
+
+	private func openRootIfNeeded() {
+		if open.isEmpty { pushElement("html", attributes: [:]) }
+	}
+
+	private func openBodyIfNeeded() {
+		if !sawBody { openBody(attributes: [:]) }
+	}
+
+	private func openBody(attributes: [String: String]) {
+		openRootIfNeeded()
+		if open.last == "head" { popElement() }
+		sawBody = true
+		pushElement("body", attributes: attributes)
+	}
+
+	/// The element ``popElement()`` would close, dropped or not.
+	private var innermost: String? {
+		overflow.last ?? open.last
+	}
+
+	private func pushElement(_ name: String, attributes: [String: String]) {
+		guard open.count < Self.maximumDepth else {
+			overflow.append(name)
+			return
+		}
+		open.append(name)
+		pending.append(.startElement(name, attributes: attributes))
+	}
+
+	private func popElement() {
+		if overflow.popLast() != nil { return }
+		pending.append(.endElement(open.removeLast()))
+	}
+
+	/// Where the body of the raw-text element `name` ends: at its end tag, or
+	/// the end of the document.
+	private func rawTextEnd(for name: String) -> Int {
+		var position = index
+		while true {
+			position = Self.firstIndex(of: UInt8(ascii: "<"), or: UInt8(ascii: "<"), in: bytes, from: position, to: count)
+			guard position < count else { return count }
+			if matches("</", at: position), matchesIgnoringCase(name, at: position + 2) {
+				let after = position + 2 + name.utf8.count
+				if after >= count || Self.isSpace(bytes[after]) || bytes[after] == UInt8(ascii: ">") || bytes[after] == UInt8(ascii: "/") {
+					return position
+				}
+			}
+			position += 1
+		}
+	}
+
+	// MARK: - Scanning
+
+	private func skipSpaces() {
+		while index < count, Self.isSpace(bytes[index]) { index += 1 }
+	}
+
+	private func skipPast(_ byte: UInt8) {
+		index = min(Self.firstIndex(of: byte, or: byte, in: bytes, from: index, to: count) + 1, count)
+	}
+
+	private func matches(_ literal: StaticString, at position: Int) -> Bool {
+		let length = literal.utf8CodeUnitCount
+		guard position + length <= count else { return false }
+		return memcmp(storage.baseAddress! + position, literal.utf8Start, length) == 0
+	}
+
+	private func matchesIgnoringCase(_ name: String, at position: Int) -> Bool {
+		var position = position
+		for byte in name.utf8 {
+			guard position < count, Self.lowercased(bytes[position]) == byte else { return false }
+			position += 1
+		}
+		return true
+	}
+
+	/// The first offset in `start ..< end` holding `first` or `second`, or
+	/// `end`. Sixteen bytes are compared at a time.
+	private static func firstIndex(of first: UInt8, or second: UInt8, in bytes: UnsafeRawBufferPointer, from start: Int, to end: Int) -> Int {
+		var index = start
+		let firstMask = SIMD16<UInt8>(repeating: first)
+		let secondMask = SIMD16<UInt8>(repeating: second)
+		while index + 16 <= end {
+			let chunk = bytes.loadUnaligned(fromByteOffset: index, as: SIMD16<UInt8>.self)
+			if any((chunk .== firstMask) .| (chunk .== secondMask)) { break }
+			index += 16
+		}
+		while index < end, bytes[index] != first, bytes[index] != second { index += 1 }
+		return index
+	}
+
+	private static func isSpace(_ byte: UInt8) -> Bool {
+		byte == 0x20 || byte == 0x09 || byte == 0x0A || byte == 0x0C || byte == 0x0D
+	}
+
+	private static func isLetter(_ byte: UInt8) -> Bool {
+		(UInt8(ascii: "a") ... UInt8(ascii: "z")).contains(byte | 0x20)
+	}
+
+	private static func isDigit(_ byte: UInt8) -> Bool {
+		(UInt8(ascii: "0") ... UInt8(ascii: "9")).contains(byte)
+	}
+
+	private static func lowercased(_ byte: UInt8) -> UInt8 {
+		(UInt8(ascii: "A") ... UInt8(ascii: "Z")).contains(byte) ? byte | 0x20 : byte
+	}
+
+	private static func digitValue(_ byte: UInt8, hex: Bool) -> UInt32? {
+		if isDigit(byte) { return UInt32(byte - UInt8(ascii: "0")) }
+		guard hex else { return nil }
+		let lower = byte | 0x20
+		guard (UInt8(ascii: "a") ... UInt8(ascii: "f")).contains(lower) else { return nil }
+		return UInt32(lower - UInt8(ascii: "a") + 10)
+	}
+
+	// MARK: - Content model
+
+	private static let voidElements: Set<String> = [
+		"area", "base", "br", "col", "embed", "hr", "img", "input", "keygen",
+		"link", "meta", "param", "source", "track", "wbr",
+	]
+	private static let headElements: Set<String> = ["base", "link", "meta", "script", "style", "title", "noscript"]
+	private static let headings: Set<String> = ["h1", "h2", "h3", "h4", "h5", "h6"]
+	private static let closesParagraph: Set<String> = [
+		"address", "article", "aside", "blockquote", "center", "details", "dir", "div", "dl",
+		"fieldset", "figcaption", "figure", "footer", "form", "h1", "h2", "h3", "h4", "h5", "h6",
+		"header", "hr", "main", "menu", "nav", "ol", "p", "pre", "section", "table", "ul",
+		"li", "dd", "dt",
+	]
+	private static let scope: Set<String> = ["html", "table", "td", "th", "caption", "object", "marquee", "applet", "template"]
+	private static let buttonScope = scope.union(["button"])
+	private static let listScope = scope.union(["ul", "ol"])
+	private static let tableScope: Set<String> = ["table", "html", "template"]
+}
+
+/// Interned lowercase names, looked up by a hash of the raw bytes so a name
+/// seen before costs no allocation.
+private struct NameTable {
+	private var names: [UInt64: String] = [:]
+
+	mutating func name(_ bytes: UnsafeRawBufferPointer) -> String {
+		var hash: UInt64 = 0xCBF2_9CE4_8422_2325
+		for byte in bytes {
+			hash = (hash ^ UInt64(Self.lowercased(byte))) &* 0x100_0000_01B3
+		}
+		if let interned = names[hash], interned.utf8.elementsEqual(bytes.lazy.map(Self.lowercased)) {
+			return interned
+		}
+		let name = String(decoding: bytes.lazy.map(Self.lowercased), as: UTF8.self)
+		if names[hash] == nil { names[hash] = name }
+		return name
+	}
+
+	private static func lowercased(_ byte: UInt8) -> UInt8 {
+		(UInt8(ascii: "A") ... UInt8(ascii: "Z")).contains(byte) ? byte | 0x20 : byte
+	}
+}
@@ -36,6 +36,14 @@ public enum MarkdownToHTML {
 		MarkdownFootnoteRenderer.convert(markdown, options: options)
 	}
 
+	/// Streams the fragment ``convert(_:options:)`` returns into `output`, e.g. a
+	/// file-backed stream, without building the whole HTML string first.
+	public static func write<Output: TextOutputStream>(
+		_ markdown: String, options: Options = [], to output: inout Output
+	) {
+		MarkdownFootnoteRenderer.write(markdown, options: options, to: &output)
+	}
+
 	/// Default stylesheet for Markdown HTML output.
 	///
 	/// Provides sensible styling for all supported elements: body, headings, paragraphs,
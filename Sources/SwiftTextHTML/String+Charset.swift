@@ -13,28 +13,9 @@ import CoreFoundation
 public func stringEncoding(for rawCharset: String) -> String.Encoding? {
 	if rawCharset.isEmpty { return nil }
 
-	var label = rawCharset
-		.trimmingCharacters(in: .whitespacesAndNewlines)
-		.trimmingCharacters(in: CharacterSet(charactersIn: "\"'"))
-		.lowercased()
-
-	label = label.replacingOccurrences(of: "_", with: "-")
-	label = label.replacingOccurrences(of: "\\s+", with: " ", options: .regularExpression)
-	label = label.replacingOccurrences(of: "-+", with: "-", options: .regularExpression)
+	var label = normalizedCharsetLabel(rawCharset)
 	if label.hasSuffix("$esc") { label = String(label.dropLast(4)) }
-
-	let aliasToIANA: [String: String] = [
-		"utf8": "utf-8",
-		"latin1": "iso-8859-1",
-		"latin-1": "iso-8859-1",
-		"cp1252": "windows-1252",
-		"win-1252": "windows-1252",
-		"shift-jis": "shift_jis",
-		"sjis": "shift_jis",
-		"cp932": "shift_jis",
-		"_iso-2022-jp": "iso-2022-jp"
-	]
-	if let mapped = aliasToIANA[label] { label = mapped }
+	if let mapped = charsetAliasToIANA[label] { label = mapped }
 
 	switch label {
 	case "binary", "x-binary":
@@ -51,19 +32,65 @@ public func stringEncoding(for rawCharset: String) -> String.Encoding? {
 	}
 	#endif
 
-	let additional: [String: String.Encoding] = [
-		"utf-8": .utf8,
-		"us-ascii": .ascii,
-		"iso-8859-1": .isoLatin1,
-		"iso-8859-2": .isoLatin2,
-		"windows-1250": .windowsCP1250,
-		"windows-1251": .windowsCP1251,
-		"windows-1252": .windowsCP1252,
-		"windows-1253": .windowsCP1253,
-		"windows-1254": .windowsCP1254,
-		"shift_jis": .shiftJIS,
-		"euc-jp": .japaneseEUC,
-		"iso-2022-jp": .iso2022JP
-	]
-	return additional[label]
+	return additionalCharsetEncodings[label]
 }
+
+/// Lowercases `raw`, trims whitespace and quotes, turns `_` into `-`, and
+/// collapses runs of whitespace to one space and runs of `-` to one `-`, in a
+/// single pass over the scalars.
+private func normalizedCharsetLabel(_ raw: String) -> String {
+	let scalars = raw.unicodeScalars
+	func isTrimmed(_ scalar: Unicode.Scalar) -> Bool {
+		scalar.properties.isWhitespace || scalar == "\"" || scalar == "'"
+	}
+	guard let first = scalars.firstIndex(where: { !isTrimmed($0) }),
+	      let last = scalars.lastIndex(where: { !isTrimmed($0) }) else { return "" }
+
+	var label = String.UnicodeScalarView()
+	var previous: Unicode.Scalar?
+	for scalar in scalars[first ... last] {
+		var scalar = scalar
+		if scalar == "_" {
+			scalar = "-"
+		} else if scalar.properties.isWhitespace {
+			scalar = " "
+		} else if ("A" ... "Z").contains(scalar) {
+			scalar = Unicode.Scalar(UInt8(scalar.value) + 0x20)
+		} else if !scalar.isASCII {
+			label.append(contentsOf: String(scalar).lowercased().unicodeScalars)
+			previous = scalar
+			continue
+		}
+		if (scalar == " " || scalar == "-"), previous == scalar { continue }
+		label.append(scalar)
+		previous = scalar
+	}
+	return String(label)
+}
+
+private let charsetAliasToIANA: [String: String] = [
+	"utf8": "utf-8",
+	"latin1": "iso-8859-1",
+	"latin-1": "iso-8859-1",
+	"cp1252": "windows-1252",
+	"win-1252": "windows-1252",
+	"shift-jis": "shift_jis",
+	"sjis": "shift_jis",
+	"cp932": "shift_jis",
+	"_iso-2022-jp": "iso-2022-jp"
+]
+
+private let additionalCharsetEncodings: [String: String.Encoding] = [
+	"utf-8": .utf8,
+	"us-ascii": .ascii,
+	"iso-8859-1": .isoLatin1,
+	"iso-8859-2": .isoLatin2,
+	"windows-1250": .windowsCP1250,
+	"windows-1251": .windowsCP1251,
+	"windows-1252": .windowsCP1252,
+	"windows-1253": .windowsCP1253,
+	"windows-1254": .windowsCP1254,
+	"shift_jis": .shiftJIS,
+	"euc-jp": .japaneseEUC,
+	"iso-2022-jp": .iso2022JP
+]
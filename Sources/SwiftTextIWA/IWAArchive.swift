@@ -1,4 +1,5 @@
 import Foundation
+import SwiftTextCore
 
 /// One archived object inside an `.iwa` file: a typed Protocol Buffers payload
 /// addressed by a document-unique identifier.
@@ -33,9 +34,11 @@ public enum IWAArchive {
 	}
 
 	/// Decodes every object stored in a single `.iwa` file.
-	public static func objects(from data: Data) throws -> [IWAObject] {
-		let stream = try decompress(data)
-		return parse(stream)
+	/// - Parameter budget: Meters decompressed bytes and decoded objects against
+	///   the caller's ``ResourceLimits``; `nil` decodes without bounds.
+	public static func objects(from data: Data, budget: ResourceBudget? = nil) throws -> [IWAObject] {
+		let stream = try decompress(data, budget: budget)
+		return try parse(stream, budget: budget)
 	}
 
 	/// Maximum uncompressed bytes per Snappy block. iWork's writer slices the
@@ -220,7 +223,11 @@ public enum IWAArchive {
 
 	/// De-chunks an `.iwa` file and concatenates the decompressed Snappy blocks.
 	/// The inverse of ``encode(stream:)``.
-	public static func decompress(_ data: Data) throws -> [UInt8] {
+	///
+	/// Each block is capped at the budget's remaining decompressed-byte allowance
+	/// *before* it is inflated, so a chunk whose length header lies is rejected
+	/// without allocating what it claims.
+	public static func decompress(_ data: Data, budget: ResourceBudget? = nil) throws -> [UInt8] {
 		let bytes = [UInt8](data)
 		var pos = 0
 		var stream = [UInt8]()
@@ -232,13 +239,22 @@ public enum IWAArchive {
 			guard pos + length <= bytes.count else { throw Error.truncatedChunkBody }
 			let block = Array(bytes[pos..<pos + length])
 			pos += length
-			stream.append(contentsOf: try Snappy.decompress(block))
+			let decompressed: [UInt8]
+			do {
+				decompressed = try Snappy.decompress(block, limit: budget?.remaining(.decompressedBytes) ?? .max)
+			} catch ResourceLimitError.limitExceeded(.decompressedBytes, _) {
+				// The cutoff is what this block had left; report the configured bound.
+				throw ResourceLimitError.limitExceeded(.decompressedBytes, limit: budget?.limits.maxDecompressedBytes ?? .max)
+			}
+			try budget?.charge(.decompressedBytes, decompressed.count)
+			try budget?.checkpoint()
+			stream.append(contentsOf: decompressed)
 		}
 		return stream
 	}
 
 	/// Walks the decompressed record stream into `IWAObject`s.
-	private static func parse(_ stream: [UInt8]) -> [IWAObject] {
+	private static func parse(_ stream: [UInt8], budget: ResourceBudget?) throws -> [IWAObject] {
 		var objects = [IWAObject]()
 		var pos = 0
 
@@ -271,6 +287,7 @@ public enum IWAArchive {
 				let type = messageInfo.varint(1) ?? 0
 				let length = messageInfo.varint(3) ?? 0
 				guard length <= UInt64(stream.count - pos) else { return objects }
+				try budget?.charge(.objects)
 				let payloadEnd = pos + Int(length)
 				objects.append(IWAObject(identifier: identifier, type: type, payload: Array(stream[pos..<payloadEnd])))
 				pos = payloadEnd
@@ -1,4 +1,5 @@
 import Foundation
+import SwiftTextCore
 import ZIPFoundation
 
 /// An error reading an iWork document container.
@@ -47,30 +48,60 @@ public enum IWAContainer {
 	/// Three layouts are supported: a flat Zip archive; a package directory with
 	/// loose folders (`<bundle>/Index/…`); and a package directory whose index is
 	/// itself zipped (`<bundle>/Index.zip`), which iWork uses for some saves.
+	/// The bytes of every entry are charged to `budget` as decompressed bytes while
+	/// they are read, so an oversized (or deflate-bomb) entry stops extraction early.
 	/// - Throws: ``IWAContainerError/unreadableArchive(_:_:)`` when a Zip-backed
-	///   document cannot be opened.
-	public static func entries(at url: URL, prefix: String, suffix: String = "") throws -> [Entry] {
+	///   document cannot be opened, or a ``ResourceLimitError`` from `budget`.
+	public static func entries(at url: URL, prefix: String, suffix: String = "", budget: ResourceBudget? = nil) throws -> [Entry] {
 		guard isDirectory(url) else {
-			return try archiveEntries(at: url, prefix: prefix, suffix: suffix)
+			return try archiveEntries(at: url, budget: budget) { $0.hasPrefix(prefix) && $0.hasSuffix(suffix) }
 		}
 
 		// Loose folder on disk (e.g. <bundle>/Index/Document.iwa).
-		let loose = directoryEntries(at: url, prefix: prefix, suffix: suffix)
-		if !loose.isEmpty {
-			return loose
-		}
+		let loose = try directoryEntries(at: url, prefix: prefix, suffix: suffix, budget: budget)
+		if !loose.isEmpty { return loose }
 
 		// Otherwise the folder may be stored as a sibling Zip (e.g. Index.zip,
 		// whose entries are still pathed "Index/…").
 		let zipName = prefix.hasSuffix("/") ? String(prefix.dropLast()) + ".zip" : prefix + ".zip"
 		let nestedZip = url.appendingPathComponent(zipName)
 		if FileManager.default.fileExists(atPath: nestedZip.path) {
-			return try archiveEntries(at: nestedZip, prefix: prefix, suffix: suffix)
+			return try archiveEntries(at: nestedZip, budget: budget) { $0.hasPrefix(prefix) && $0.hasSuffix(suffix) }
 		}
 
 		return []
 	}
 
+	/// Loads only the entries at the given archive-relative paths (e.g.
+	/// `Index/Slide-4711.iwa`), so a reader can fetch the components it needs
+	/// without inflating the rest of the document. Layouts and budget charging are
+	/// as for ``entries(at:prefix:suffix:budget:)``; missing paths are skipped.
+	public static func entries(at url: URL, paths: Set<String>, budget: ResourceBudget? = nil) throws -> [Entry] {
+		guard !paths.isEmpty else { return [] }
+		guard isDirectory(url) else {
+			return try archiveEntries(at: url, budget: budget) { paths.contains($0) }
+		}
+
+		var entries = [Entry]()
+		var missing = Set<String>()
+		for path in paths.sorted() {
+			guard let data = try looseData(at: url.appendingPathComponent(path), budget: budget) else {
+				missing.insert(path)
+				continue
+			}
+			entries.append(Entry(path: path, data: data))
+		}
+
+		// Paths not stored loose may sit in their folder's sibling Zip (Index.zip).
+		let folders = Set(missing.compactMap { $0.split(separator: "/").first.map(String.init) })
+		for folder in folders.sorted() {
+			let nestedZip = url.appendingPathComponent(folder + ".zip")
+			guard FileManager.default.fileExists(atPath: nestedZip.path) else { continue }
+			entries += try archiveEntries(at: nestedZip, budget: budget) { missing.contains($0) }
+		}
+		return entries
+	}
+
 	/// Returns the bytes of a single entry at an exact archive-relative path
 	/// (e.g. `index.xml`), or `nil` if it isn't present.
 	public static func data(at url: URL, named name: String) -> Data? {
@@ -87,24 +118,31 @@ public enum IWAContainer {
 		return data
 	}
 
-	private static func directoryEntries(at url: URL, prefix: String, suffix: String) -> [Entry] {
+	private static func directoryEntries(at url: URL, prefix: String, suffix: String, budget: ResourceBudget?) throws -> [Entry] {
 		let root = url.appendingPathComponent(prefix, isDirectory: true)
 		let fileManager = FileManager.default
-		guard let enumerator = fileManager.enumerator(at: root, includingPropertiesForKeys: [.isRegularFileKey]) else {
+		guard let enumerator = fileManager.enumerator(at: root, includingPropertiesForKeys: [.isRegularFileKey, .fileSizeKey]) else {
 			return []
 		}
 		var entries = [Entry]()
-		for case let fileURL as URL in enumerator {
-			let isRegularFile = (try? fileURL.resourceValues(forKeys: [.isRegularFileKey]))?.isRegularFile ?? false
-			guard isRegularFile, fileURL.lastPathComponent.hasSuffix(suffix) else { continue }
-			guard let data = try? Data(contentsOf: fileURL) else { continue }
+		for case let fileURL as URL in enumerator where fileURL.lastPathComponent.hasSuffix(suffix) {
+			guard let data = try looseData(at: fileURL, budget: budget) else { continue }
 			entries.append(Entry(path: prefix + fileURL.lastPathComponent, data: data))
 		}
 		// Stable order so multi-file documents parse deterministically.
 		return entries.sorted { $0.path < $1.path }
 	}
 
-	private static func archiveEntries(at url: URL, prefix: String, suffix: String) throws -> [Entry] {
+	/// A loose file's bytes, or `nil` if it isn't a readable regular file. Like a
+	/// Zip entry's chunks, its size is charged to `budget` before it is read.
+	private static func looseData(at fileURL: URL, budget: ResourceBudget?) throws -> Data? {
+		guard let values = try? fileURL.resourceValues(forKeys: [.isRegularFileKey, .fileSizeKey]),
+		      values.isRegularFile == true else { return nil }
+		try budget?.charge(.decompressedBytes, values.fileSize ?? 0)
+		return try? Data(contentsOf: fileURL)
+	}
+
+	private static func archiveEntries(at url: URL, budget: ResourceBudget?, matching matches: (String) -> Bool) throws -> [Entry] {
 		let archive: Archive
 		do {
 			archive = try Archive(url: url, accessMode: .read)
@@ -113,9 +151,12 @@ public enum IWAContainer {
 		}
 		var entries = [Entry]()
 		for entry in archive {
-			guard entry.path.hasPrefix(prefix), entry.path.hasSuffix(suffix), !entry.path.hasSuffix("/") else { continue }
+			guard matches(entry.path), !entry.path.hasSuffix("/") else { continue }
 			var data = Data()
-			_ = try archive.extract(entry) { data.append($0) }
+			_ = try archive.extract(entry) { chunk in
+				try budget?.charge(.decompressedBytes, chunk.count)
+				data.append(chunk)
+			}
 			entries.append(Entry(path: entry.path, data: data))
 		}
 		return entries
@@ -1,4 +1,5 @@
 import Foundation
+import SwiftTextCore
 
 /// Codec for the Snappy block format used inside iWork `.iwa` chunks.
 ///
@@ -24,10 +25,19 @@ public enum Snappy {
 		case invalidOffset
 	}
 
+	/// The most output one input byte can produce: a 3-byte copy element emits
+	/// at most 64 bytes. Bounds the up-front allocation, since the length header is
+	/// untrusted and may claim far more than the block could ever expand to.
+	private static let maxExpansion = 22
+
 	/// Decompresses a single raw Snappy block.
-	/// - Parameter input: The compressed block bytes (no stream framing).
+	/// - Parameters:
+	///   - input: The compressed block bytes (no stream framing).
+	///   - limit: The most bytes the block may decompress to.
 	/// - Returns: The decompressed bytes.
-	public static func decompress(_ input: [UInt8]) throws -> [UInt8] {
+	/// - Throws: ``ResourceLimitError/limitExceeded(_:limit:)`` when the declared or
+	///   actual output passes `limit`.
+	public static func decompress(_ input: [UInt8], limit: Int = .max) throws -> [UInt8] {
 		var pos = 0
 
 		func readVarint() throws -> Int {
@@ -55,8 +65,11 @@ public enum Snappy {
 		}
 
 		let expectedLength = try readVarint()
+		guard expectedLength <= limit else {
+			throw ResourceLimitError.limitExceeded(.decompressedBytes, limit: limit)
+		}
 		var output = [UInt8]()
-		output.reserveCapacity(expectedLength)
+		output.reserveCapacity(max(0, min(expectedLength, input.count * maxExpansion)))
 
 		while pos < input.count {
 			let tag = input[pos]
@@ -73,6 +86,9 @@ public enum Snappy {
 				}
 				length += 1
 				guard pos + length <= input.count else { throw Error.truncated }
+				guard output.count + length <= limit else {
+					throw ResourceLimitError.limitExceeded(.decompressedBytes, limit: limit)
+				}
 				output.append(contentsOf: input[pos..<pos + length])
 				pos += length
 			} else {
@@ -95,6 +111,9 @@ public enum Snappy {
 				}
 
 				guard offset > 0, offset <= output.count else { throw Error.invalidOffset }
+				guard output.count + length <= limit else {
+					throw ResourceLimitError.limitExceeded(.decompressedBytes, limit: limit)
+				}
 				// Offsets may overlap the region being written (run-length style),
 				// so the copy must proceed one byte at a time.
 				var sourceIndex = output.count - offset
@@ -123,11 +142,20 @@ public enum Snappy {
 		// Snappy compresses in fragments of at most 64 KiB; each is an independent
 		// scan with its own hash table (iWork already chunks at 64 KiB, so usually
 		// one fragment per call, but the general loop matches `Compress` exactly).
+		//
+		// Cancellation is polled once per fragment. A cancelled task's caller is
+		// about to discard the result, so the remaining input is emitted as plain
+		// literals: still a valid block, produced at copy speed, though no longer
+		// byte-identical to Apple's encoder.
 		let kBlockSize = 1 << 16
 		var start = 0
 		while start < input.count {
 			let end = min(start + kBlockSize, input.count)
-			compressFragment(input, start, end, into: &output)
+			if Task.isCancelled {
+				emitLiteral(input, from: start, to: end, into: &output)
+			} else {
+				compressFragment(input, start, end, into: &output)
+			}
 			start = end
 		}
 		return output
@@ -201,7 +201,10 @@ public enum TSTTableReader {
 		var columnHasNumber = Array(repeating: false, count: columns)
 		var columnHasText = Array(repeating: false, count: columns)
 		var columnExplicitlyAligned = Array(repeating: false, count: columns)
-		for (tileBase, rowInfo) in tileRows {
+		for (rowNumber, (tileBase, rowInfo)) in tileRows.enumerated() {
+			// A cancelled read is discarded anyway; stop decoding a large sheet at the
+			// next tile's worth of rows. The reader then throws `CancellationError`.
+			if rowNumber & 0xFF == 0xFF && Task.isCancelled { return nil }
 			guard let localRow = rowInfo.varint(Const.tileRowIndexField).map(Int.init) else { continue }
 			let rowIndex = tileBase + localRow
 			guard rowIndex < rows else { continue }
@@ -0,0 +1,38 @@
+import Foundation
+import SwiftTextCore
+
+extension KeynoteDocument {
+	/// Sends the deck to `emit` as ``DocumentEvent``s in the shape of
+	/// `KeynoteFile.markdown()`: each slide a level-2 heading (its title, or
+	/// `Slide N`), its body lines as bullet items, and its notes as a block quote.
+	public func events(_ emit: DocumentEventHandler) rethrows {
+		for (index, slide) in slides.enumerated() {
+			try slide.emitEvents(number: index + 1, emit)
+		}
+	}
+}
+
+extension KeynoteDocument.Slide {
+	/// Emits this slide; `number` (1-based) names an untitled slide.
+	func emitEvents(number: Int, _ emit: DocumentEventHandler) rethrows {
+		try emit(.beginHeading(level: 2))
+		try emit(.text(title ?? "Slide \(number)", .plain))
+		try emit(.endHeading)
+		for entry in body {
+			for line in entry.split(whereSeparator: \.isNewline) where !line.trimmingCharacters(in: .whitespaces).isEmpty {
+				try emit(.beginListItem(level: 0, ordered: false))
+				try emit(.text(String(line), .plain))
+				try emit(.endListItem)
+			}
+		}
+		guard let notes, !notes.isEmpty else { return }
+		try emit(.beginBlockQuote)
+		try emit(.beginParagraph)
+		for (index, line) in notes.split(whereSeparator: \.isNewline).enumerated() {
+			if index > 0 { try emit(.lineBreak) }
+			try emit(.text(String(line), .plain))
+		}
+		try emit(.endParagraph)
+		try emit(.endBlockQuote)
+	}
+}
@@ -1,4 +1,5 @@
 import Foundation
+import SwiftTextCore
 
 /// A read-only handle on an Apple Keynote (`.key`) presentation, mirroring `PagesFile`
 /// and `NumbersFile`: construct with a URL, then ask for the rendering you want. Output
@@ -8,9 +9,26 @@ public final class KeynoteFile {
 	public let url: URL
 	public let document: KeynoteDocument
 
-	public init(url: URL) throws {
+	/// Reads the deck at `url`, optionally bounded by `limits` for untrusted input.
+	/// With `titlesOnly`, each slide carries just its title; body and notes text is
+	/// never decoded, which keeps outlining a large deck cheap.
+	public init(url: URL, limits: ResourceLimits = .unlimited, titlesOnly: Bool = false) throws {
 		self.url = url
-		self.document = try KeynoteParser().readDocument(from: url)
+		self.document = try KeynoteParser(titlesOnly: titlesOnly).readDocument(from: url, limits: limits)
+	}
+
+	/// Async variant of ``init(url:limits:titlesOnly:)`` that throws `CancellationError` once the
+	/// calling task is cancelled, checked between decompressed archive blocks.
+	public static func open(url: URL, limits: ResourceLimits = .unlimited, titlesOnly: Bool = false) async throws -> KeynoteFile {
+		try Task.checkCancellation()
+		return try KeynoteFile(url: url, limits: limits, titlesOnly: titlesOnly)
+	}
+
+	/// Streams the deck at `url` to `emit` one slide at a time, without building a
+	/// ``KeynoteDocument``.
+	public static func events(url: URL, limits: ResourceLimits = .unlimited, titlesOnly: Bool = false,
+	                          _ emit: DocumentEventHandler) throws {
+		try KeynoteParser(titlesOnly: titlesOnly).readEvents(from: url, limits: limits, emit: emit)
 	}
 
 	/// Markdown: each slide as a `##` heading (its title, or `Slide N`), its body as
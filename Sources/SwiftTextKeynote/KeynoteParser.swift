@@ -1,4 +1,5 @@
 import Foundation
+import SwiftTextCore
 import SwiftTextIWA
 
 public enum KeynoteParserError: Error, CustomStringConvertible {
@@ -38,51 +39,184 @@ public struct KeynoteParser {
 		static let documentShowField = 2        // KN.DocumentArchive → show
 		static let referenceIdentifierField = 1
 		static let storageTextField = 3
+		static let packageMetadataType: UInt64 = 11006
+		static let packageComponentsField = 3   // TSP.PackageMetadata → components
+		static let componentIdentifierField = 1 // TSP.ComponentInfo → root object id
+		static let componentPreferredLocatorField = 2
+		static let componentLocatorField = 3
+		static let documentPath = "Index/Document.iwa"
+		static let metadataPath = "Index/Metadata.iwa"
 	}
 
-	public init() {}
+	/// Resolve only each slide's title; body and notes storages are never read.
+	/// For outlines and tables of contents of large decks.
+	public var titlesOnly: Bool
 
-	public func readDocument(from url: URL) throws -> KeynoteDocument {
+	public init(titlesOnly: Bool = false) {
+		self.titlesOnly = titlesOnly
+	}
+
+	public func readDocument(from url: URL, limits: ResourceLimits = .unlimited) throws -> KeynoteDocument {
+		var slides = [KeynoteDocument.Slide]()
+		try forEachSlide(from: url, limits: limits) { slides.append($0) }
+		return KeynoteDocument(slides: slides)
+	}
+
+	/// Streams the deck to `emit` slide by slide (see ``KeynoteDocument/events(_:)``)
+	/// instead of collecting a ``KeynoteDocument``.
+	public func readEvents(from url: URL, limits: ResourceLimits = .unlimited, emit: DocumentEventHandler) throws {
+		var number = 0
+		try forEachSlide(from: url, limits: limits) { slide in
+			number += 1
+			try slide.emitEvents(number: number, emit)
+		}
+	}
+
+	// MARK: - Loading
+
+	/// Hands `body` each deck slide in order.
+	///
+	/// Only `Document.iwa` and `Metadata.iwa` are decoded up front. The package
+	/// metadata names the component file that holds each slide, so the deck's slide
+	/// components are inflated on demand and the theme's template slides, stylesheet
+	/// and calculation engine are never touched. Slides are decoded and resolved
+	/// concurrently a batch at a time and delivered in deck order. Documents without
+	/// a usable component table are read whole, as before.
+	private func forEachSlide(from url: URL, limits: ResourceLimits, _ body: (KeynoteDocument.Slide) throws -> Void) throws {
 		guard FileManager.default.fileExists(atPath: url.path) else {
 			throw KeynoteParserError.fileNotFound(url)
 		}
-		let entries = try IWAContainer.entries(at: url, prefix: "Index/", suffix: ".iwa")
+		let budget = ResourceBudget(limits)
+		let index = try IWAContainer.entries(at: url, paths: [Const.documentPath, Const.metadataPath], budget: budget)
+		guard let documentEntry = index.first(where: { $0.path == Const.documentPath }),
+		      let metadataEntry = index.first(where: { $0.path == Const.metadataPath }) else {
+			return try Self.forEachSlide(in: loadObjectStore(from: url, budget: budget), titlesOnly: titlesOnly, body)
+		}
+		let documentStore = try Self.objectStore(from: [documentEntry], budget: budget)
+		let components = Self.componentPaths(in: try Self.objectStore(from: [metadataEntry], budget: budget))
+		let known = Set(documentStore.objects.map(\.identifier)).union(components.keys)
+
+		// Each deck node's first reference into another component is its slide.
+		var slideIDs = [UInt64]()
+		for node in Self.deckSlideNodes(in: documentStore) {
+			guard let slideID = IWAReferenceScanner.referencedObjectIDs(in: node.payload, known: known)
+				.first(where: { components[$0] != nil }) else {
+				return try Self.forEachSlide(in: loadObjectStore(from: url, budget: budget), titlesOnly: titlesOnly, body)
+			}
+			slideIDs.append(slideID)
+		}
+
+		let batchSize = max(ProcessInfo.processInfo.activeProcessorCount * 4, 8)
+		var start = 0
+		while start < slideIDs.count {
+			let batch = Array(slideIDs[start..<min(start + batchSize, slideIDs.count)])
+			let paths = Set(batch.compactMap { components[$0] })
+			var dataByPath = [String: Data]()
+			for entry in try IWAContainer.entries(at: url, paths: paths, budget: budget) {
+				dataByPath[entry.path] = entry.data
+			}
+			for slide in try resolveSlides(batch, components: components, dataByPath: dataByPath, budget: budget) {
+				if let slide { try body(slide) }
+			}
+			start += batch.count
+		}
+		try budget.checkpoint()
+	}
+
+	/// Decodes each slide's component and resolves its text, concurrently; the
+	/// result is in `slideIDs` order, `nil` where a component is missing or unreadable.
+	private func resolveSlides(_ slideIDs: [UInt64], components: [UInt64: String], dataByPath: [String: Data],
+	                           budget: ResourceBudget) throws -> [KeynoteDocument.Slide?] {
+		var results = [KeynoteDocument.Slide?](repeating: nil, count: slideIDs.count)
+		var firstError: Error?
+		let lock = NSLock()
+		let titlesOnly = titlesOnly
+		DispatchQueue.concurrentPerform(iterations: slideIDs.count) { index in
+			lock.lock()
+			let failed = firstError != nil
+			lock.unlock()
+			guard !failed else { return }
+			let slideID = slideIDs[index]
+			guard let path = components[slideID], let data = dataByPath[path] else { return }
+			do {
+				try budget.checkpoint()
+				let store = try Self.objectStore(from: [IWAContainer.Entry(path: path, data: data)], budget: budget)
+				let slide = SlideResolver(store: store).slide(slideID, titlesOnly: titlesOnly)
+				lock.lock()
+				results[index] = slide
+				lock.unlock()
+			} catch {
+				lock.lock()
+				if firstError == nil { firstError = error }
+				lock.unlock()
+			}
+		}
+		if let firstError { throw firstError }
+		return results
+	}
+
+	private func loadObjectStore(from url: URL, budget: ResourceBudget) throws -> IWAObjectStore {
+		let entries = try IWAContainer.entries(at: url, prefix: "Index/", suffix: ".iwa", budget: budget)
 		guard !entries.isEmpty else { throw KeynoteParserError.notAKeynoteDocument(url) }
+		let store = try Self.objectStore(from: entries, budget: budget)
+		try budget.checkpoint()
+		return store
+	}
 
+	/// Decodes `entries` into one store, skipping any that aren't valid IWA.
+	private static func objectStore(from entries: [IWAContainer.Entry], budget: ResourceBudget) throws -> IWAObjectStore {
 		var store = IWAObjectStore()
 		for entry in entries {
-			guard let objects = try? IWAArchive.objects(from: entry.data) else { continue }
+			let objects: [IWAObject]
+			do {
+				objects = try IWAArchive.objects(from: entry.data, budget: budget)
+			} catch let error where error is ResourceLimitError || error is CancellationError {
+				throw error
+			} catch {
+				continue
+			}
 			for object in objects { store.add(object) }
 		}
-		return Self.buildDocument(from: store)
+		return store
 	}
 
-	static func buildDocument(from store: IWAObjectStore) -> KeynoteDocument {
-		let allIDs = Set(store.objects.map(\.identifier))
-		func refs(_ id: UInt64) -> [UInt64] {
-			guard let object = store.object(id) else { return [] }
-			return IWAReferenceScanner.referencedObjectIDs(in: object.payload, known: allIDs)
-		}
-		func storageText(_ id: UInt64) -> String? {
-			guard let object = store.object(id), object.type == Const.storageType else { return nil }
-			let text = ProtobufMessage(object.payload).allBytes(Const.storageTextField)
-				.map { String(decoding: $0, as: UTF8.self) }.joined()
-			// Drop placeholders that are empty or only object-replacement chars (U+FFFC),
-			// e.g. an unfilled image slot.
-			let meaningful = text.unicodeScalars.contains { $0 != "\u{FFFC}" && !$0.properties.isWhitespace }
-			return meaningful ? text : nil
-		}
-		/// The first `StorageArchive` reachable one hop below `id` (a placeholder/shape
-		/// wraps its storage), or the object itself when it is already a storage.
-		func textBelow(_ id: UInt64) -> String? {
-			if let direct = storageText(id) { return direct }
-			for child in refs(id) where store.object(child)?.type == Const.storageType {
-				if let text = storageText(child) { return text }
+	/// The package's component table (`TSP.PackageMetadata.components`): each
+	/// component's root object id mapped to the `.iwa` entry that stores it. A
+	/// slide's component is named after it (`Slide-4711`), except that one
+	/// component per preferred locator may drop the suffix (`Slide`).
+	static func componentPaths(in metadata: IWAObjectStore) -> [UInt64: String] {
+		var paths = [UInt64: String]()
+		for object in metadata.objects(ofType: Const.packageMetadataType) {
+			for component in ProtobufMessage(object.payload).messages(Const.packageComponentsField) {
+				guard let identifier = component.varint(Const.componentIdentifierField),
+				      let locator = component.bytes(Const.componentLocatorField) ?? component.bytes(Const.componentPreferredLocatorField)
+				else { continue }
+				paths[identifier] = "Index/" + String(decoding: locator, as: UTF8.self) + ".iwa"
 			}
-			return nil
 		}
+		return paths
+	}
+
+	static func buildDocument(from store: IWAObjectStore) -> KeynoteDocument {
+		var slides = [KeynoteDocument.Slide]()
+		forEachSlide(in: store) { slides.append($0) }
+		return KeynoteDocument(slides: slides)
+	}
+
+	/// Hands `body` each deck slide, in order, from a store holding the whole document.
+	static func forEachSlide(in store: IWAObjectStore, titlesOnly: Bool = false,
+	                         _ body: (KeynoteDocument.Slide) throws -> Void) rethrows {
+		let resolver = SlideResolver(store: store)
+		for node in deckSlideNodes(in: store) {
+			guard let slideID = resolver.refs(node.identifier).first(where: { store.object($0)?.type == Const.slideArchiveType }),
+			      let slide = resolver.slide(slideID, titlesOnly: titlesOnly) else { continue }
+			try body(slide)
+		}
+	}
 
-		// Layout slide nodes hang off the theme; the deck's nodes are the rest.
+	/// Deck slides: slide nodes the theme does not own, in document (discovery) order.
+	/// Layout slide nodes hang off the theme; the deck's nodes are the rest.
+	private static func deckSlideNodes(in store: IWAObjectStore) -> [IWAObject] {
 		var layoutNodes = Set<UInt64>()
 		if let doc = store.objects(ofType: Const.documentArchiveType).first,
 		   let showID = ProtobufMessage(doc.payload).message(Const.documentShowField)?.varint(Const.referenceIdentifierField),
@@ -93,29 +227,61 @@ public struct KeynoteParser {
 				$0.varint(Const.referenceIdentifierField)
 			})
 		}
+		return store.objects(ofType: Const.slideNodeType).filter { !layoutNodes.contains($0.identifier) }
+	}
 
-		// Deck slides: slide nodes the theme does not own, in document (discovery) order.
-		var slides = [KeynoteDocument.Slide]()
-		for node in store.objects(ofType: Const.slideNodeType) where !layoutNodes.contains(node.identifier) {
-			guard let slideID = refs(node.identifier).first(where: { store.object($0)?.type == Const.slideArchiveType }) else { continue }
+	/// Resolves a `KN.SlideArchive`'s text from a store that holds the slide's objects.
+	private struct SlideResolver {
+		let store: IWAObjectStore
+		let known: Set<UInt64>
 
+		init(store: IWAObjectStore) {
+			self.store = store
+			self.known = Set(store.objects.map(\.identifier))
+		}
+
+		func refs(_ id: UInt64) -> [UInt64] {
+			guard let object = store.object(id) else { return [] }
+			return IWAReferenceScanner.referencedObjectIDs(in: object.payload, known: known)
+		}
+
+		func slide(_ slideID: UInt64, titlesOnly: Bool) -> KeynoteDocument.Slide? {
+			guard store.object(slideID)?.type == Const.slideArchiveType else { return nil }
 			var texts = [String](), notes: String?
 			for ref in refs(slideID) {
 				switch store.object(ref)?.type {
 				case Const.placeholderType, Const.shapeInfoType:
-					if let text = textBelow(ref) { texts.append(text) }
-				case Const.noteType:
+					guard let text = textBelow(ref) else { continue }
+					texts.append(text)
+					if titlesOnly { return .init(title: text, body: [], notes: nil) }
+				case Const.noteType where !titlesOnly:
 					notes = notes ?? textBelow(ref)
 				default:
 					break
 				}
 			}
 			// The first text shape is the title; the rest are body.
-			let title = texts.first
-			let body = Array(texts.dropFirst())
-			slides.append(.init(title: title, body: body, notes: notes))
+			return .init(title: texts.first, body: Array(texts.dropFirst()), notes: notes)
 		}
 
-		return KeynoteDocument(slides: slides)
+		private func storageText(_ id: UInt64) -> String? {
+			guard let object = store.object(id), object.type == Const.storageType else { return nil }
+			let text = ProtobufMessage(object.payload).allBytes(Const.storageTextField)
+				.map { String(decoding: $0, as: UTF8.self) }.joined()
+			// Drop placeholders that are empty or only object-replacement chars (U+FFFC),
+			// e.g. an unfilled image slot.
+			let meaningful = text.unicodeScalars.contains { $0 != "\u{FFFC}" && !$0.properties.isWhitespace }
+			return meaningful ? text : nil
+		}
+
+		/// The first `StorageArchive` reachable one hop below `id` (a placeholder/shape
+		/// wraps its storage), or the object itself when it is already a storage.
+		private func textBelow(_ id: UInt64) -> String? {
+			if let direct = storageText(id) { return direct }
+			for child in refs(id) where store.object(child)?.type == Const.storageType {
+				if let text = storageText(child) { return text }
+			}
+			return nil
+		}
 	}
 }
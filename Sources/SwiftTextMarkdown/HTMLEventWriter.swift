@@ -0,0 +1,322 @@
+//  HTMLEventWriter.swift
+//  SwiftTextMarkdown
+//
+//  Serializes a DocumentEvent stream as an HTML fragment in the same shape
+//  SwiftMarkdownHTMLRenderer gives a parsed Markdown document, so a reader's
+//  output can go to HTML (or EPUB XHTML) without building an AST first.
+
+import Foundation
+import SwiftTextCore
+
+/// Writes a ``DocumentEvent`` stream as an HTML fragment into a `TextOutputStream`.
+///
+/// Flat list items are regrouped into nested `<ul>`/`<ol>` elements by level,
+/// and footnote references become the `<sup><a href="#fn-N">` anchors of
+/// ``MarkdownFootnoteRenderer``, with the definitions written by ``finish()``.
+public struct HTMLEventWriter<Output: TextOutputStream>: DocumentEventConsumer {
+	public private(set) var output: Output
+
+	/// Prepended to footnote links (`<prefix>#fn-N`), for definitions that live
+	/// in another document — EPUB collects them in a notes chapter.
+	public var footnoteLinkPrefix = ""
+
+	private enum Container: Equatable {
+		case paragraph
+		case heading(Int)
+		case listItem
+		case codeBlock
+		case tableCell(tag: String)
+	}
+
+	private enum TableSection {
+		case none
+		case head
+		case body
+	}
+
+	private struct TableState {
+		var alignments: [DocumentColumnAlignment]
+		var section = TableSection.none
+		var headerRow = false
+		var column = 0
+	}
+
+	private let options: SwiftMarkdownHTMLRenderer.Options
+	private var container: Container?
+	private var implicitParagraph = false
+	private var wroteBlock = false
+	private var quoteDepth = 0
+	/// The open lists, outermost first; `true` for `<ol>`. Each has an open `<li>`.
+	private var openLists: [Bool] = []
+	private var activeStyle = DocumentTextStyle.plain
+	private var table: TableState?
+	private var footnotes: [Int: String] = [:]
+	private var referenceCounts: [Int: Int] = [:]
+
+	/// - Parameter options: Only ``SwiftMarkdownHTMLRenderer/Options/xhtml`` applies;
+	///   event streams carry no raw HTML.
+	public init(output: Output, options: SwiftMarkdownHTMLRenderer.Options = []) {
+		self.output = output
+		self.options = options
+	}
+
+	private var voidClose: String {
+		options.contains(.xhtml) ? " />" : ">"
+	}
+
+	public mutating func consume(_ event: DocumentEvent) throws {
+		switch event {
+		case .beginParagraph:
+			beginBlock()
+			output.write("<p>")
+			container = .paragraph
+		case .endParagraph:
+			endInline()
+			output.write("</p>")
+			container = nil
+		case .beginHeading(let level):
+			beginBlock()
+			let level = max(1, min(level, 6))
+			output.write("<h\(level)>")
+			container = .heading(level)
+		case .endHeading:
+			endInline()
+			if case .heading(let level) = container { output.write("</h\(level)>") }
+			container = nil
+		case .beginListItem(let level, let ordered):
+			beginListItem(level: max(level, 0), ordered: ordered)
+			container = .listItem
+		case .endListItem:
+			// The `<li>` stays open so deeper items can nest inside it.
+			endInline()
+			container = nil
+		case .beginCodeBlock(let language):
+			beginBlock()
+			if let language, !language.isEmpty {
+				output.write("<pre><code class=\"language-\(htmlEscaped(language, escapingQuotes: true))\">")
+			} else {
+				output.write("<pre><code>")
+			}
+			container = .codeBlock
+		case .endCodeBlock:
+			output.write("</code></pre>")
+			container = nil
+		case .beginBlockQuote:
+			beginBlock()
+			output.write("<blockquote>")
+			quoteDepth += 1
+		case .endBlockQuote:
+			closeImplicitParagraph()
+			closeLists()
+			if quoteDepth > 0 {
+				output.write("</blockquote>")
+				quoteDepth -= 1
+			}
+		case .beginTable(let alignments):
+			beginBlock()
+			output.write("<table>\n")
+			table = TableState(alignments: alignments)
+		case .endTable:
+			guard let state = table else { break }
+			switch state.section {
+			case .none: output.write("<tbody>\n")
+			case .head: output.write("</thead>\n<tbody>\n")
+			case .body: break
+			}
+			output.write("</tbody></table>")
+			table = nil
+		case .beginTableRow(let header):
+			beginTableRow(header: header)
+		case .endTableRow:
+			output.write(table?.section == .body ? "</tr>\n" : "</tr>")
+		case .beginTableCell:
+			guard var state = table else { break }
+			let tag = state.headerRow ? "th" : "td"
+			output.write("<\(tag)\(Self.cellStyle(column: state.column, alignments: state.alignments))>")
+			state.column += 1
+			table = state
+			container = .tableCell(tag: tag)
+		case .endTableCell:
+			endInline()
+			if case .tableCell(let tag) = container { output.write("</\(tag)>") }
+			container = nil
+		case .text(let string, let style):
+			if container == .codeBlock {
+				output.write(htmlEscaped(string, escapingQuotes: false))
+				return
+			}
+			openInlineContainer()
+			setStyle(style)
+			output.write(htmlEscaped(string, escapingQuotes: false))
+		case .lineBreak:
+			output.write(container == .codeBlock ? "\n" : "<br\(voidClose)")
+		case .image(let source, let alt):
+			let image = "<img src=\"\(htmlEscaped(source, escapingQuotes: true))\" alt=\"\(htmlEscaped(alt, escapingQuotes: true))\"\(voidClose)"
+			if container == nil {
+				beginBlock()
+				output.write("<p>" + image + "</p>")
+			} else {
+				output.write(image)
+			}
+		case .footnoteReference(let number):
+			openInlineContainer()
+			let occurrence = (referenceCounts[number] ?? 0) + 1
+			referenceCounts[number] = occurrence
+			let anchor = occurrence == 1 ? "ref-\(number)" : "ref-\(number)-\(occurrence)"
+			output.write("<sup><a href=\"\(footnoteLinkPrefix)#fn-\(number)\" id=\"\(anchor)\">[\(number)]</a></sup>")
+		case .footnote(let number, let text):
+			footnotes[number] = text
+		case .horizontalRule:
+			beginBlock()
+			output.write("<hr\(voidClose)")
+		}
+	}
+
+	public mutating func finish() throws {
+		closeImplicitParagraph()
+		switch container {
+		case .paragraph?: try consume(.endParagraph)
+		case .heading?: try consume(.endHeading)
+		case .listItem?: try consume(.endListItem)
+		case .codeBlock?: try consume(.endCodeBlock)
+		case .tableCell?: try consume(.endTableCell)
+		case nil: break
+		}
+		if table != nil { try consume(.endTable) }
+		closeLists()
+		while quoteDepth > 0 { try consume(.endBlockQuote) }
+		guard !footnotes.isEmpty else { return }
+		let definitions = footnotes.keys.sorted().map { number in
+			"<div class=\"footnote-definition\" id=\"fn-\(number)\"><strong>[\(number)]:</strong> "
+				+ htmlEscaped(footnotes[number]!, escapingQuotes: false) + "</div>"
+		}
+		output.write((wroteBlock ? "\n" : "") + definitions.joined(separator: "\n"))
+		footnotes.removeAll()
+	}
+
+	// MARK: - Blocks
+
+	/// Closes whatever a new non-list block can't nest in, then separates it
+	/// from the previous top-level block the way the AST renderer does.
+	private mutating func beginBlock() {
+		closeImplicitParagraph()
+		closeLists()
+		separateTopLevelBlock()
+	}
+
+	private mutating func separateTopLevelBlock() {
+		if quoteDepth == 0, openLists.isEmpty, table == nil {
+			if wroteBlock { output.write("\n") }
+			wroteBlock = true
+		}
+	}
+
+	private mutating func beginListItem(level: Int, ordered: Bool) {
+		closeImplicitParagraph()
+		while openLists.count > level + 1 {
+			output.write(openLists.removeLast() ? "</li></ol>" : "</li></ul>")
+		}
+		if openLists.count == level + 1 {
+			if openLists[level] == ordered {
+				output.write("</li><li>")
+				return
+			} else {
+				output.write(openLists.removeLast() ? "</li></ol>" : "</li></ul>")
+			}
+		}
+		if openLists.isEmpty { separateTopLevelBlock() }
+		// A level skipped by the source still needs a list and item to nest in.
+		while openLists.count < level + 1 {
+			let intermediate = openLists.count < level
+			output.write(ordered && !intermediate ? "<ol><li>" : "<ul><li>")
+			openLists.append(ordered && !intermediate)
+		}
+	}
+
+	private mutating func closeLists() {
+		while let ordered = openLists.popLast() {
+			output.write(ordered ? "</li></ol>" : "</li></ul>")
+		}
+	}
+
+	private mutating func beginTableRow(header: Bool) {
+		guard var state = table else { return }
+		if header, state.section == .none {
+			output.write("<thead>")
+			state.section = .head
+		} else if !header, state.section != .body {
+			output.write(state.section == .head ? "</thead>\n<tbody>\n" : "<tbody>\n")
+			state.section = .body
+		}
+		state.headerRow = header
+		state.column = 0
+		table = state
+		output.write("<tr>")
+	}
+
+	private static func cellStyle(column: Int, alignments: [DocumentColumnAlignment]) -> String {
+		guard column < alignments.count else { return "" }
+		switch alignments[column] {
+		case .left: return ""
+		case .center: return " style=\"text-align: center;\""
+		case .right: return " style=\"text-align: right;\""
+		}
+	}
+
+	// MARK: - Inline
+
+	/// Inline content outside any block gets a paragraph of its own.
+	private mutating func openInlineContainer() {
+		guard container == nil else { return }
+		try? consume(.beginParagraph)
+		implicitParagraph = true
+	}
+
+	private mutating func closeImplicitParagraph() {
+		guard implicitParagraph else { return }
+		implicitParagraph = false
+		try? consume(.endParagraph)
+	}
+
+	private mutating func endInline() {
+		setStyle(.plain)
+	}
+
+	/// Moves from the active inline style to `style`, closing and reopening tags
+	/// so they always nest: `<a>`, `<del>`, `<strong>`, `<em>`, `<u>`, `<code>`.
+	private mutating func setStyle(_ style: DocumentTextStyle) {
+		guard style != activeStyle else { return }
+		output.write(Self.closingTags(activeStyle))
+		output.write(openingTags(style))
+		activeStyle = style
+	}
+
+	private func openingTags(_ style: DocumentTextStyle) -> String {
+		var tags = ""
+		if let link = style.link { tags += "<a href=\"\(htmlEscaped(link, escapingQuotes: true))\">" }
+		if style.strikethrough { tags += "<del>" }
+		if style.bold { tags += "<strong>" }
+		if style.italic { tags += "<em>" }
+		if style.underline { tags += "<u>" }
+		if style.code { tags += "<code>" }
+		return tags
+	}
+
+	private static func closingTags(_ style: DocumentTextStyle) -> String {
+		var tags = ""
+		if style.code { tags += "</code>" }
+		if style.underline { tags += "</u>" }
+		if style.italic { tags += "</em>" }
+		if style.bold { tags += "</strong>" }
+		if style.strikethrough { tags += "</del>" }
+		if style.link != nil { tags += "</a>" }
+		return tags
+	}
+}
+
+extension HTMLEventWriter where Output == String {
+	/// A writer that accumulates the HTML in ``output``.
+	public init(options: SwiftMarkdownHTMLRenderer.Options = []) {
+		self.init(output: "", options: options)
+	}
+}
@@ -0,0 +1,89 @@
+import Markdown
+
+/// A callout written as a block quote: GitHub's `> [!NOTE]` form or a DocC-style
+/// `> Note:` tag.
+///
+/// swift-markdown's `Aside` node only understands the DocC form, so both are
+/// recognised here from the quote's first `Text` node. Renderers emit an alert
+/// as `<aside class="markdown-alert markdown-alert-<kind>">` headed by a
+/// `<p class="markdown-alert-title">`, followed by ``leadingParagraph()`` and
+/// ``remainingBlocks``. (The attributed-string renderer's callout kind is the
+/// separate `MarkdownAlert` enum.)
+public struct MarkdownAlertBlock {
+	/// The lowercased marker, e.g. `note` or `warning`.
+	public let kind: String
+	/// The display title, e.g. `Note`.
+	public let title: String
+	/// The ARIA role: `note`, or `alert` for warnings and cautions.
+	public let role: String
+	/// `]` for `[!NOTE]`, `:` for DocC `Note:`.
+	private let markerTerminator: Character
+	private let quote: BlockQuote
+
+	/// Recognises `quote` as an alert, or returns `nil` for a plain block quote.
+	public init?(_ quote: BlockQuote) {
+		guard let token = Self.bracketedToken(in: quote) ?? Self.doccToken(in: quote) else { return nil }
+		switch token.token.uppercased() {
+		case "NOTE": (title, role) = ("Note", "note")
+		case "TIP": (title, role) = ("Tip", "note")
+		case "IMPORTANT": (title, role) = ("Important", "note")
+		case "WARNING": (title, role) = ("Warning", "alert")
+		case "CAUTION": (title, role) = ("Caution", "alert")
+		case "EXPERIMENT": (title, role) = ("Experiment", "note")
+		default: return nil
+		}
+		self.kind = token.token.lowercased()
+		self.markerTerminator = token.terminator
+		self.quote = quote
+	}
+
+	/// The first paragraph with the marker removed: the text left over from the
+	/// marker's `Text` node, if any, and the inline nodes that follow it. When
+	/// the marker stands on its own line, the soft break after it is dropped too.
+	/// `nil` when nothing of the paragraph remains.
+	public func leadingParagraph() -> (text: String?, inlines: [Markup])? {
+		guard let paragraph = quote.child(at: 0) as? Paragraph else { return nil }
+		var inlines = Array(paragraph.children)
+		guard let firstText = inlines.first as? Text else {
+			return inlines.isEmpty ? nil : (nil, inlines)
+		}
+		var stripped = firstText.string
+		if let closing = stripped.firstIndex(of: markerTerminator) {
+			stripped.removeSubrange(stripped.startIndex...closing)
+			if stripped.hasPrefix(" ") { stripped.removeFirst() }
+		}
+		inlines.removeFirst()
+		guard stripped.isEmpty else { return (stripped, inlines) }
+		if let next = inlines.first, next is SoftBreak { inlines.removeFirst() }
+		return inlines.isEmpty ? nil : (nil, inlines)
+	}
+
+	/// The quote's blocks after the marker paragraph.
+	public var remainingBlocks: [Markup] {
+		Array(quote.children.dropFirst())
+	}
+
+	// MARK: - Marker detection
+
+	/// GitHub's `[!NOTE]` syntax — bracket-bang at the start of the quote.
+	private static func bracketedToken(in quote: BlockQuote) -> (token: String, terminator: Character)? {
+		guard let raw = firstText(of: quote), raw.hasPrefix("[!"),
+		      let closing = raw.firstIndex(of: "]") else { return nil }
+		return (String(raw[raw.index(raw.startIndex, offsetBy: 2)..<closing]), "]")
+	}
+
+	/// DocC's `Note:` / `Tip:` plain-text tag.
+	private static func doccToken(in quote: BlockQuote) -> (token: String, terminator: Character)? {
+		guard let raw = firstText(of: quote), let colon = raw.firstIndex(of: ":") else { return nil }
+		let token = String(raw[..<colon])
+		// DocC tags are single-word identifiers without whitespace.
+		guard !token.isEmpty, !token.contains(where: { $0.isWhitespace }) else { return nil }
+		return (token, ":")
+	}
+
+	private static func firstText(of quote: BlockQuote) -> String? {
+		guard let paragraph = quote.child(at: 0) as? Paragraph,
+		      let text = paragraph.child(at: 0) as? Text else { return nil }
+		return text.string
+	}
+}
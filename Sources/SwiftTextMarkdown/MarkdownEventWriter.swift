@@ -0,0 +1,324 @@
+//  MarkdownEventWriter.swift
+//  SwiftTextMarkdown
+//
+//  Serializes a DocumentEvent stream as Markdown while it arrives. The shape
+//  follows the hand-rolled Markdown of the DOCX and Pages readers: blank lines
+//  between blocks, tight lists, emphasis markers hugging the text, GFM tables
+//  and footnote definitions after the body.
+
+import Foundation
+import SwiftTextCore
+
+/// Writes a ``DocumentEvent`` stream as Markdown into a `TextOutputStream`.
+///
+/// Only the pending inline run, the current table cell and the footnote
+/// definitions are buffered; everything else goes to `output` as soon as its
+/// event arrives.
+public struct MarkdownEventWriter<Output: TextOutputStream>: DocumentEventConsumer {
+	public private(set) var output: Output
+
+	private enum Container {
+		case paragraph
+		case heading
+		case listItem
+		case codeBlock
+		case tableCell
+	}
+
+	private struct TableState {
+		var alignments: [DocumentColumnAlignment]
+		var columns = 0
+		var rows = 0
+		var cells: [String] = []
+		var cell = ""
+	}
+
+	private var container: Container?
+	/// Inline content that arrived outside any block opened a paragraph of its own.
+	private var implicitParagraph = false
+	private var wroteBlock = false
+	private var previousWasListItem = false
+	private var quoteDepth = 0
+	private var atLineStart = true
+	private var counters: [Int: Int] = [:]
+	private var run = ""
+	private var runStyle = DocumentTextStyle.plain
+	private var linkURL: String?
+	private var table: TableState?
+	private var footnotes: [Int: String] = [:]
+
+	public init(output: Output) {
+		self.output = output
+	}
+
+	public mutating func consume(_ event: DocumentEvent) throws {
+		switch event {
+		case .beginParagraph:
+			beginBlock(.paragraph)
+		case .beginHeading(let level):
+			beginBlock(.heading)
+			write(String(repeating: "#", count: max(1, min(level, 6))) + " ")
+		case .beginListItem(let level, let ordered):
+			beginBlock(.listItem, listItem: true)
+			for deeper in counters.keys where deeper > level { counters[deeper] = nil }
+			let marker: String
+			if ordered {
+				counters[level, default: 0] += 1
+				marker = "\(counters[level]!). "
+			} else {
+				marker = "- "
+			}
+			write(String(repeating: "  ", count: max(level, 0)) + marker)
+		case .endParagraph, .endHeading, .endListItem:
+			endInline()
+			container = nil
+		case .beginCodeBlock(let language):
+			beginBlock(.codeBlock)
+			write("```" + (language ?? "") + "\n")
+		case .endCodeBlock:
+			write("\n```")
+			container = nil
+		case .beginBlockQuote:
+			closeImplicitParagraph()
+			quoteDepth += 1
+			previousWasListItem = false
+		case .endBlockQuote:
+			closeImplicitParagraph()
+			quoteDepth = max(quoteDepth - 1, 0)
+			previousWasListItem = false
+		case .beginTable(let alignments):
+			closeImplicitParagraph()
+			table = TableState(alignments: alignments)
+		case .endTable:
+			table = nil
+		case .beginTableRow:
+			table?.cells.removeAll(keepingCapacity: true)
+		case .endTableRow:
+			writeTableRow()
+		case .beginTableCell:
+			table?.cell = ""
+			container = .tableCell
+		case .endTableCell:
+			endInline()
+			if let cell = table?.cell {
+				table?.cells.append(Self.tableCell(cell))
+			}
+			container = nil
+		case .text(let string, let style):
+			appendText(string, style: style)
+		case .lineBreak:
+			if container == .codeBlock {
+				write("\n")
+			} else {
+				flushRun()
+				emit("\n")
+			}
+		case .image(let source, let alt):
+			if container == nil {
+				beginBlock(nil)
+				write("![\(alt)](\(source))")
+			} else {
+				flushRun()
+				emit("![\(alt)](\(source))")
+			}
+		case .footnoteReference(let number):
+			if container == nil { beginBlock(.paragraph, implicit: true) }
+			flushRun()
+			emit("[^\(number)]")
+		case .footnote(let number, let text):
+			footnotes[number] = text
+		case .horizontalRule:
+			beginBlock(nil)
+			write("---")
+		}
+	}
+
+	public mutating func finish() throws {
+		closeImplicitParagraph()
+		if container == .codeBlock {
+			write("\n```")
+		} else if container != nil {
+			endInline()
+		}
+		container = nil
+		quoteDepth = 0
+		guard !footnotes.isEmpty else { return }
+		let definitions = footnotes.keys.sorted()
+			.map { "[^\($0)]: \(footnotes[$0]!)" }
+			.joined(separator: "\n")
+		write((wroteBlock ? "\n\n" : "") + definitions)
+		footnotes.removeAll()
+	}
+
+	// MARK: - Blocks
+
+	private mutating func beginBlock(_ kind: Container?, listItem: Bool = false, implicit: Bool = false) {
+		closeImplicitParagraph()
+		if wroteBlock {
+			write(listItem && previousWasListItem ? "\n" : "\n\n")
+		}
+		wroteBlock = true
+		previousWasListItem = listItem
+		if !listItem { counters.removeAll() }
+		container = kind
+		implicitParagraph = implicit
+	}
+
+	private mutating func closeImplicitParagraph() {
+		guard implicitParagraph else { return }
+		endInline()
+		container = nil
+		implicitParagraph = false
+	}
+
+	private mutating func writeTableRow() {
+		guard var table else { return }
+		if table.rows == 0 {
+			table.columns = max(table.cells.count, table.alignments.count)
+			guard table.columns > 0 else { return }
+			beginBlock(nil)
+			write(Self.tableRow(table.cells, columns: table.columns))
+			let delimiters = (0..<table.columns).map { column -> String in
+				switch column < table.alignments.count ? table.alignments[column] : .left {
+				case .left: return "---"
+				case .center: return ":-:"
+				case .right: return "--:"
+				}
+			}
+			write("\n| " + delimiters.joined(separator: " | ") + " |")
+		} else {
+			write("\n" + Self.tableRow(table.cells, columns: table.columns))
+		}
+		table.rows += 1
+		self.table = table
+	}
+
+	private static func tableRow(_ cells: [String], columns: Int) -> String {
+		let padded = (0..<columns).map { $0 < cells.count ? cells[$0] : "" }
+		return "| " + padded.joined(separator: " | ") + " |"
+	}
+
+	private static func tableCell(_ value: String) -> String {
+		value.replacingOccurrences(of: "\n", with: " ")
+			.replacingOccurrences(of: "|", with: "\\|")
+			.trimmingCharacters(in: .whitespaces)
+	}
+
+	// MARK: - Inline
+
+	private mutating func appendText(_ string: String, style: DocumentTextStyle) {
+		if container == .codeBlock {
+			write(string)
+			return
+		}
+		if container == nil { beginBlock(.paragraph, implicit: true) }
+		if style.link != linkURL {
+			flushRun()
+			closeLink()
+			if let link = style.link {
+				emit("[")
+				linkURL = link
+			}
+		}
+		var emphasis = style
+		emphasis.link = nil
+		if emphasis != runStyle {
+			flushRun()
+			runStyle = emphasis
+		}
+		run += string
+	}
+
+	private mutating func endInline() {
+		flushRun()
+		closeLink()
+		runStyle = .plain
+	}
+
+	private mutating func flushRun() {
+		guard !run.isEmpty else { return }
+		// A link already marks its text up semantically; skip a redundant underline.
+		emit(Self.markedUp(run, style: runStyle, underline: runStyle.underline && linkURL == nil))
+		run = ""
+	}
+
+	private mutating func closeLink() {
+		guard let url = linkURL else { return }
+		emit("](\(url))")
+		linkURL = nil
+	}
+
+	/// Wraps the non-whitespace core of `text` in the style's markers, leaving
+	/// leading and trailing whitespace outside them.
+	static func markedUp(_ text: String, style: DocumentTextStyle, underline: Bool) -> String {
+		guard style.bold || style.italic || style.strikethrough || style.code || underline else { return text }
+		let scalars = text.unicodeScalars
+		guard let first = scalars.firstIndex(where: { !$0.properties.isWhitespace }),
+		      let last = scalars.lastIndex(where: { !$0.properties.isWhitespace }) else { return text }
+		var core = String(scalars[first...last])
+		if style.code {
+			core = "`\(core)`"
+		}
+		if style.bold && style.italic {
+			core = "***\(core)***"
+		} else if style.bold {
+			core = "**\(core)**"
+		} else if style.italic {
+			core = "*\(core)*"
+		}
+		if style.strikethrough {
+			core = "~~\(core)~~"
+		}
+		if underline {
+			core = "<u>\(core)</u>"
+		}
+		return String(scalars[..<first]) + core + String(scalars[scalars.index(after: last)...])
+	}
+
+	// MARK: - Output
+
+	/// Inline output goes to the open table cell, if any, else straight out.
+	private mutating func emit(_ string: String) {
+		if container == .tableCell {
+			table?.cell += string
+		} else {
+			write(string)
+		}
+	}
+
+	/// Writes `string`, prefixing each line with `> ` markers inside block quotes.
+	private mutating func write(_ string: String) {
+		guard !string.isEmpty else { return }
+		guard quoteDepth > 0 else {
+			output.write(string)
+			atLineStart = string.hasSuffix("\n")
+			return
+		}
+		let prefix = String(repeating: "> ", count: quoteDepth)
+		let lines = string.split(separator: "\n", omittingEmptySubsequences: false)
+		for (index, line) in lines.enumerated() {
+			if index > 0 {
+				output.write("\n")
+				atLineStart = true
+			}
+			if line.isEmpty {
+				// A blank line inside the quote keeps its markers so the quote continues.
+				if index > 0, index < lines.count - 1 {
+					output.write(String(repeating: ">", count: quoteDepth))
+					atLineStart = false
+				}
+				continue
+			}
+			if atLineStart { output.write(prefix) }
+			output.write(String(line))
+			atLineStart = false
+		}
+	}
+}
+
+extension MarkdownEventWriter where Output == String {
+	/// A writer that accumulates the Markdown in ``output``.
+	public init() {
+		self.init(output: "")
+	}
+}
@@ -5,8 +5,8 @@ import Markdown
 /// swift-markdown doesn't parse natively.
 ///
 /// Two renderers build on this:
-/// - ``MarkdownFootnoteRenderer`` (Markdown → HTML), which rewrites references
-///   into sentinel strings and expands them after HTML rendering.
+/// - ``MarkdownFootnoteRenderer`` (Markdown → HTML), which writes reference
+///   anchors while ``SwiftMarkdownHTMLRenderer`` visits each `Text` node.
 /// - The Markdown → DOCX writer, which walks the AST and splits each `Text`
 ///   node into ``MarkdownFootnoteParser/Segment`` values to emit native Word
 ///   `w:footnoteReference` runs.
@@ -74,6 +74,23 @@ public final class MarkdownFootnoteResolver {
 	public func number(forID id: String) -> Int? {
 		state.number(forID: id)
 	}
+
+	/// Calls `body` once for each referenced definition, in footnote-number
+	/// order. Resolve the body before calling this, then resolve each
+	/// definition's body inside `body`: references found there number further
+	/// definitions, which are visited later in the same pass. That walks the
+	/// reference graph breadth-first from the document body, so every
+	/// definition is parsed and rendered exactly once however long the chains
+	/// between definitions get, and unreferenced definitions are skipped.
+	public func forEachReferencedDefinition(
+		in definitions: [MarkdownFootnoteParser.Definition],
+		_ body: (_ number: Int, _ definition: MarkdownFootnoteParser.Definition) -> Void
+	) {
+		let definitionsByID = Dictionary(definitions.map { ($0.id, $0) }, uniquingKeysWith: { first, _ in first })
+		state.forEachReferencedID { number, id in
+			if let definition = definitionsByID[id] { body(number, definition) }
+		}
+	}
 }
 
 // MARK: - Definition extraction
@@ -93,9 +110,12 @@ struct FootnoteDefinition {
 func extractFootnoteDefinitions(
 	from source: String
 ) -> (cleaned: String, definitions: [FootnoteDefinition]) {
-	let normalized = source
-		.replacingOccurrences(of: "\r\n", with: "\n")
-		.replacingOccurrences(of: "\r", with: "\n")
+	// `"\r\n"` is one Character, so look for the carriage return byte.
+	let normalized = source.utf8.contains(UInt8(ascii: "\r"))
+		? source
+			.replacingOccurrences(of: "\r\n", with: "\n")
+			.replacingOccurrences(of: "\r", with: "\n")
+		: source
 	let lines = normalized.components(separatedBy: "\n")
 
 	var keptLines: [String] = []
@@ -126,15 +146,16 @@ func extractFootnoteDefinitions(
 			let next = lines[j]
 			if next.trimmingCharacters(in: .whitespaces).isEmpty {
 				// Look ahead: if the next non-blank line is also indented, the
-				// blank line is part of the definition (paragraph break inside);
-				// otherwise it terminates the definition.
+				// blank lines are part of the definition (paragraph break inside);
+				// otherwise they terminate it. The whole blank run is consumed at
+				// once so each line is only looked at once.
 				var lookahead = j + 1
 				while lookahead < lines.count && lines[lookahead].trimmingCharacters(in: .whitespaces).isEmpty {
 					lookahead += 1
 				}
 				if lookahead < lines.count, stripContinuationIndent(lines[lookahead]) != nil {
-					bodyLines.append("")
-					j += 1
+					bodyLines.append(contentsOf: repeatElement("", count: lookahead - j))
+					j = lookahead
 					continue
 				}
 				break
@@ -200,8 +221,8 @@ enum FootnoteScanEvent {
 /// when `record` returns a number (i.e. the id has a matching definition);
 /// otherwise the original `[^id]` text is preserved as literal output.
 ///
-/// Both the HTML rewriter (sentinel strings) and the DOCX resolver (segments)
-/// build their output from these events so the scan rules stay in one place.
+/// Both the HTML renderer (anchors) and the DOCX resolver (segments) build
+/// their output from these events so the scan rules stay in one place.
 func scanFootnoteReferences(in input: String, record: (String) -> Int?) -> [FootnoteScanEvent] {
 	guard input.contains("[^") else { return [.literal(input)] }
 
@@ -244,24 +265,13 @@ func scanFootnoteReferences(in input: String, record: (String) -> Int?) -> [Foot
 	return events
 }
 
-// MARK: - Sentinels
-
-// Private Use Area characters — CommonMark-inert, not touched by the renderer's
-// HTML escape (which only rewrites `& < > "`), and vanishingly unlikely to
-// appear in user content.
-let footnoteSentinelOpen: Character = "\u{E000}"
-let footnoteSentinelClose: Character = "\u{E001}"
-
-func footnoteReferenceSentinel(number: Int) -> String {
-	"\(footnoteSentinelOpen)fnref:\(number)\(footnoteSentinelClose)"
-}
-
 // MARK: - State
 
 final class FootnoteState {
 	private let validIDs: Set<String>
 	private var numberByID: [String: Int] = [:]
-	private var nextNumber = 1
+	/// Referenced ids in number order: footnote `N` is `referencedIDs[N - 1]`.
+	private(set) var referencedIDs: [String] = []
 	private var totalReferenceCountByNumber: [Int: Int] = [:]
 	private var emittedReferenceCountByNumber: [Int: Int] = [:]
 
@@ -278,20 +288,29 @@ final class FootnoteState {
 		if let existing = numberByID[id] {
 			number = existing
 		} else {
-			number = nextNumber
+			referencedIDs.append(id)
+			number = referencedIDs.count
 			numberByID[id] = number
-			nextNumber += 1
 		}
 		totalReferenceCountByNumber[number, default: 0] += 1
 		return number
 	}
 
 	/// Looks up an already-assigned number without recording a new reference.
-	/// Used after rewriting to fetch numbers for the definitions block.
 	func number(forID id: String) -> Int? {
 		numberByID[id]
 	}
 
+	/// Calls `body` with each referenced id in number order, including ids that
+	/// `body` itself gets numbered while it runs.
+	func forEachReferencedID(_ body: (_ number: Int, _ id: String) -> Void) {
+		var number = 1
+		while number <= referencedIDs.count {
+			body(number, referencedIDs[number - 1])
+			number += 1
+		}
+	}
+
 	/// Returns the next per-occurrence anchor id for a reference. The first
 	/// reference to footnote `N` gets `ref-N`; subsequent references get
 	/// `ref-N-2`, `ref-N-3`, … so each anchor in the HTML is unique.
@@ -301,34 +320,3 @@ final class FootnoteState {
 		return occurrence == 1 ? "ref-\(number)" : "ref-\(number)-\(occurrence)"
 	}
 }
-
-// MARK: - AST rewriter
-
-struct FootnoteReferenceRewriter: MarkupRewriter {
-	let state: FootnoteState
-
-	mutating func visitText(_ text: Text) -> Markup? {
-		let original = text.string
-		guard original.contains("[^") else { return text }
-		let rewritten = replaceReferences(in: original)
-		guard rewritten != original else { return text }
-		return Text(rewritten)
-	}
-
-	private func replaceReferences(in input: String) -> String {
-		// The scan rules (bounds, valid-id shape, skip-unmatched) live in
-		// `scanFootnoteReferences`; here we just turn the events into the
-		// sentinel string the HTML pass later expands.
-		var result = ""
-		result.reserveCapacity(input.count)
-		for event in scanFootnoteReferences(in: input, record: state.recordReference) {
-			switch event {
-			case .literal(let string):
-				result += string
-			case .reference(let number):
-				result += footnoteReferenceSentinel(number: number)
-			}
-		}
-		return result
-	}
-}
@@ -23,7 +23,9 @@ import Markdown
 ///   legacy parser's policy of literal source fidelity — and, unlike
 ///   reversing the substitution after the fact, this also leaves any
 ///   typographic characters already present in the source untouched.
-/// - Output is the inline HTML fragment — no `<html>`/`<body>` wrapper.
+/// - Output is the inline HTML fragment — no `<html>`/`<body>` wrapper. It is
+///   written to a `TextOutputStream` while the AST is walked; ``convert(_:options:)``
+///   collects it into a `String`.
 public enum SwiftMarkdownHTMLRenderer {
 
 	/// Rendering options.
@@ -56,30 +58,72 @@ public enum SwiftMarkdownHTMLRenderer {
 	/// ``convert(_:)``. Use this entry point when you need to rewrite the AST
 	/// (e.g. with a `MarkupRewriter`) before rendering.
 	public static func convert(document: Document, options: Options = []) -> String {
-		var renderer = HTMLRenderer(options: options)
+		var html = ""
+		write(document: document, options: options, to: &html)
+		return html
+	}
+
+	/// Streams the HTML fragment for `document` into `output` as the tree is
+	/// visited, so a large document is never held as one rendered string.
+	/// The bytes written are exactly what ``convert(document:options:)`` returns.
+	public static func write<Output: TextOutputStream>(
+		document: Document, options: Options = [], to output: inout Output
+	) {
+		write(document: document, options: options, footnotes: nil, to: &output)
+	}
+
+	/// Footnote-aware variant used by ``MarkdownFootnoteRenderer``: `[^id]`
+	/// references in `Text` nodes that match a definition in `footnotes` are
+	/// written as `<sup><a …>` anchors while the tree is visited.
+	static func write<Output: TextOutputStream>(
+		document: Document, options: Options, footnotes: FootnoteState?, to output: inout Output
+	) {
+		var renderer = HTMLRenderer(output: output, options: options, footnotes: footnotes)
 		renderer.visit(document)
-		return renderer.flush()
+		output = renderer.output
 	}
 }
 
-private struct HTMLRenderer: MarkupVisitor {
+private struct HTMLRenderer<Output: TextOutputStream>: MarkupVisitor {
 	typealias Result = Void
 
 	let options: SwiftMarkdownHTMLRenderer.Options
+	let footnotes: FootnoteState?
 
-	init(options: SwiftMarkdownHTMLRenderer.Options) {
+	init(output: Output, options: SwiftMarkdownHTMLRenderer.Options, footnotes: FootnoteState?) {
+		self.output = output
 		self.options = options
+		self.footnotes = footnotes
 	}
 
-	private var output: String = ""
+	private(set) var output: Output
+	/// Newlines that ended the last write. They are only passed on once more
+	/// markup follows, so the fragment never ends in a newline.
+	private var pendingNewlines = 0
 	private var alignmentStack: [[Table.ColumnAlignment?]] = []
 
 	/// The close for a void element: `" />"` in XHTML mode, `">"` otherwise.
 	private var voidClose: String { options.contains(.xhtml) ? " />" : ">" }
 
-	mutating func flush() -> String {
-		while output.hasSuffix("\n") { output.removeLast() }
-		return output
+	private mutating func write(_ string: String) {
+		let utf8 = string.utf8
+		var end = utf8.endIndex
+		var trailing = 0
+		while end > utf8.startIndex {
+			let last = utf8.index(before: end)
+			guard utf8[last] == UInt8(ascii: "\n") else { break }
+			end = last
+			trailing += 1
+		}
+		guard end > utf8.startIndex else {
+			pendingNewlines += trailing
+			return
+		}
+		if pendingNewlines > 0 {
+			output.write(String(repeating: "\n", count: pendingNewlines))
+		}
+		output.write(trailing == 0 ? string : String(Substring(string.unicodeScalars[..<end])))
+		pendingNewlines = trailing
 	}
 
 	mutating func defaultVisit(_ markup: Markup) {
@@ -91,81 +135,83 @@ private struct HTMLRenderer: MarkupVisitor {
 		// multi-block fixture round-trips byte-identically.
 		let blocks = Array(document.children)
 		for (index, block) in blocks.enumerated() {
-			if index > 0 { output += "\n" }
+			if index > 0 { write("\n") }
 			visit(block)
 		}
 	}
 
 	mutating func visitParagraph(_ paragraph: Paragraph) {
-		output += "<p>"
+		write("<p>")
 		for child in paragraph.children { visit(child) }
-		output += "</p>"
+		write("</p>")
 	}
 
 	mutating func visitHeading(_ heading: Heading) {
 		let level = max(1, min(heading.level, 6))
-		output += "<h\(level)>"
+		write("<h\(level)>")
 		for child in heading.children { visit(child) }
-		output += "</h\(level)>"
+		write("</h\(level)>")
 	}
 
 	mutating func visitText(_ text: Text) {
 		// Body text uses the same escape policy as the legacy parser (only
 		// `&<>`). The full `&<>"` policy is reserved for attribute values.
-		output += escapeHTMLNotQuote(text.string)
+		writeText(text.string)
 	}
 
 	mutating func visitEmphasis(_ emphasis: Emphasis) {
-		output += "<em>"
+		write("<em>")
 		for child in emphasis.children { visit(child) }
-		output += "</em>"
+		write("</em>")
 	}
 
 	mutating func visitStrong(_ strong: Strong) {
-		output += "<strong>"
+		write("<strong>")
 		for child in strong.children { visit(child) }
-		output += "</strong>"
+		write("</strong>")
 	}
 
 	mutating func visitStrikethrough(_ strikethrough: Strikethrough) {
-		output += "<del>"
+		write("<del>")
 		for child in strikethrough.children { visit(child) }
-		output += "</del>"
+		write("</del>")
 	}
 
 	mutating func visitInlineCode(_ inlineCode: InlineCode) {
 		// Inline code is not subject to smart-punct (cmark already excludes it)
 		// and is escaped without `"` — matches the legacy parser.
-		output += "<code>" + escapeHTMLNotQuote(inlineCode.code) + "</code>"
+		write("<code>")
+		write(escapeHTMLNotQuote(inlineCode.code))
+		write("</code>")
 	}
 
 	mutating func visitInlineHTML(_ inlineHTML: InlineHTML) {
 		if options.contains(.passThroughRawHTML) {
-			output += inlineHTML.rawHTML
+			write(inlineHTML.rawHTML)
 			return
 		}
 		// Legacy parser escapes raw HTML markers literally during inlineFormat
 		// (the `&<>` substitution runs before regex matching). Match that so an
 		// input like `<div>` becomes `&lt;div&gt;` rather than disappearing.
-		output += escapeHTMLNotQuote(inlineHTML.rawHTML)
+		write(escapeHTMLNotQuote(inlineHTML.rawHTML))
 	}
 
 	mutating func visitHTMLBlock(_ htmlBlock: HTMLBlock) {
 		var raw = htmlBlock.rawHTML
 		while raw.hasSuffix("\n") { raw.removeLast() }
 		if options.contains(.passThroughRawHTML) {
-			output += raw
+			write(raw)
 			return
 		}
 		// Same policy as inline HTML — escape and emit literal characters.
-		output += escapeHTMLNotQuote(raw)
+		write(escapeHTMLNotQuote(raw))
 	}
 
 	mutating func visitLink(_ link: Link) {
 		let href = link.destination ?? ""
-		output += "<a href=\"\(escapeAttribute(href))\">"
+		write("<a href=\"\(escapeAttribute(href))\">")
 		for child in link.children { visit(child) }
-		output += "</a>"
+		write("</a>")
 	}
 
 	mutating func visitImage(_ image: Image) {
@@ -174,7 +220,7 @@ private struct HTMLRenderer: MarkupVisitor {
 		// (e.g. `![*diagram*](img.png)` or `![link [label]](...)`) is
 		// preserved rather than silently dropped.
 		let alt = swiftMarkdownPlainText(of: image)
-		output += "<img src=\"\(escapeAttribute(src))\" alt=\"\(escapeAttribute(alt))\"\(voidClose)"
+		write("<img src=\"\(escapeAttribute(src))\" alt=\"\(escapeAttribute(alt))\"\(voidClose)")
 	}
 
 	mutating func visitCodeBlock(_ codeBlock: CodeBlock) {
@@ -182,28 +228,29 @@ private struct HTMLRenderer: MarkupVisitor {
 		if code.hasSuffix("\n") { code.removeLast() }
 		// Code blocks escape only `&<>` (not `"`) — matches the legacy parser's
 		// simpler escape policy. Smart-punct is also irrelevant inside code.
-		let escaped = escapeHTMLNotQuote(code)
 		if let language = codeBlock.language, !language.isEmpty {
-			output += "<pre><code class=\"language-\(escapeAttribute(language))\">\(escaped)</code></pre>"
+			write("<pre><code class=\"language-\(escapeAttribute(language))\">")
 		} else {
-			output += "<pre><code>\(escaped)</code></pre>"
+			write("<pre><code>")
 		}
+		write(escapeHTMLNotQuote(code))
+		write("</code></pre>")
 	}
 
 	mutating func visitThematicBreak(_ thematicBreak: ThematicBreak) {
-		output += "<hr\(voidClose)"
+		write("<hr\(voidClose)")
 	}
 
 	mutating func visitUnorderedList(_ unorderedList: UnorderedList) {
-		output += "<ul>"
+		write("<ul>")
 		for child in unorderedList.children { visit(child) }
-		output += "</ul>"
+		write("</ul>")
 	}
 
 	mutating func visitOrderedList(_ orderedList: OrderedList) {
-		output += "<ol>"
+		write("<ol>")
 		for child in orderedList.children { visit(child) }
-		output += "</ol>"
+		write("</ol>")
 	}
 
 	mutating func visitListItem(_ listItem: ListItem) {
@@ -212,14 +259,14 @@ private struct HTMLRenderer: MarkupVisitor {
 			let input = options.contains(.xhtml)
 				? #"<input type="checkbox" disabled="disabled" checked="checked" />"#
 				: #"<input type="checkbox" disabled checked>"#
-			output += #"<li class="task-list-item">"# + input + " "
+			write(#"<li class="task-list-item">"# + input + " ")
 		case .unchecked:
 			let input = options.contains(.xhtml)
 				? #"<input type="checkbox" disabled="disabled" />"#
 				: #"<input type="checkbox" disabled>"#
-			output += #"<li class="task-list-item">"# + input + " "
+			write(#"<li class="task-list-item">"# + input + " ")
 		case .none:
-			output += "<li>"
+			write("<li>")
 		}
 		// If the only child is a single paragraph, unwrap it so output matches
 		// the existing renderer's `<li>foo</li>` shape rather than `<li><p>foo</p></li>`.
@@ -229,25 +276,25 @@ private struct HTMLRenderer: MarkupVisitor {
 		} else {
 			for child in blocks { visit(child) }
 		}
-		output += "</li>"
+		write("</li>")
 	}
 
 	mutating func visitBlockQuote(_ blockQuote: BlockQuote) {
-		if let alert = githubAlert(in: blockQuote) {
-			emitGitHubAlert(alert)
+		if let alert = MarkdownAlertBlock(blockQuote) {
+			emitAlert(alert)
 			return
 		}
-		output += "<blockquote>"
+		write("<blockquote>")
 		for child in blockQuote.children { visit(child) }
-		output += "</blockquote>"
+		write("</blockquote>")
 	}
 
 	mutating func visitSoftBreak(_ softBreak: SoftBreak) {
-		output += "\n"
+		write("\n")
 	}
 
 	mutating func visitLineBreak(_ lineBreak: LineBreak) {
-		output += "<br\(voidClose)"
+		write("<br\(voidClose)")
 	}
 
 	// MARK: - Tables
@@ -255,30 +302,30 @@ private struct HTMLRenderer: MarkupVisitor {
 	mutating func visitTable(_ table: Table) {
 		alignmentStack.append(table.columnAlignments)
 		defer { alignmentStack.removeLast() }
-		output += "<table>\n"
+		write("<table>\n")
 		visit(table.head)
-		output += "\n"
+		write("\n")
 		visit(table.body)
-		output += "</table>"
+		write("</table>")
 	}
 
 	mutating func visitTableHead(_ tableHead: Table.Head) {
-		output += "<thead><tr>"
+		write("<thead><tr>")
 		emitCells(tableHead, tag: "th")
-		output += "</tr></thead>"
+		write("</tr></thead>")
 	}
 
 	mutating func visitTableBody(_ tableBody: Table.Body) {
-		output += "<tbody>\n"
+		write("<tbody>\n")
 		let rows = Array(tableBody.children)
 		for row in rows {
 			if let row = row as? Table.Row {
-				output += "<tr>"
+				write("<tr>")
 				emitCells(row, tag: "td")
-				output += "</tr>\n"
+				write("</tr>\n")
 			}
 		}
-		output += "</tbody>"
+		write("</tbody>")
 	}
 
 	private mutating func emitCells(_ container: Markup, tag: String) {
@@ -287,9 +334,9 @@ private struct HTMLRenderer: MarkupVisitor {
 		for child in container.children {
 			guard let cell = child as? Table.Cell else { continue }
 			let style = cellStyle(for: index, alignments: alignments)
-			output += "<\(tag)\(style)>"
+			write("<\(tag)\(style)>")
 			for inline in cell.children { visit(inline) }
-			output += "</\(tag)>"
+			write("</\(tag)>")
 			index += 1
 		}
 	}
@@ -305,108 +352,20 @@ private struct HTMLRenderer: MarkupVisitor {
 
 	// MARK: - GitHub alerts
 
-	private struct GitHubAlert {
-		var kind: String
-		var title: String
-		var role: String
-		var markerTerminator: Character  // `]` for `[!NOTE]`, `:` for DocC `Note:`
-		var body: BlockQuote
-	}
-
-	private func githubAlert(in quote: BlockQuote) -> GitHubAlert? {
-		// GitHub's `[!NOTE]` syntax — bracket-bang on its own line.
-		if let bracketed = bracketedAlertToken(in: quote) {
-			return alert(forToken: bracketed, terminator: "]", in: quote)
+	private mutating func emitAlert(_ alert: MarkdownAlertBlock) {
+		write("<aside class=\"markdown-alert markdown-alert-\(alert.kind)\" data-alert=\"\(alert.kind)\" role=\"\(alert.role)\">")
+		write("<p class=\"markdown-alert-title\">\(alert.title)</p>")
+
+		// The [!TYPE] marker at the start of the first paragraph is not content;
+		// `MarkdownAlertBlock` hands back what is left of that paragraph.
+		if let lead = alert.leadingParagraph() {
+			write("<p>")
+			if let text = lead.text { writeText(text) }
+			for inline in lead.inlines { visit(inline) }
+			write("</p>")
 		}
-		// DocC-style `Note:` / `Tip:` plain-text tag. swift-markdown's `Aside`
-		// node would resolve this for us, but we want to emit it through the
-		// same `<aside class="markdown-alert-...">` shape as GitHub alerts so
-		// styling stays consistent.
-		if let docc = doccAsideToken(in: quote) {
-			return alert(forToken: docc, terminator: ":", in: quote)
-		}
-		return nil
-	}
-
-	private func bracketedAlertToken(in quote: BlockQuote) -> String? {
-		guard let firstParagraph = quote.child(at: 0) as? Paragraph else { return nil }
-		guard let firstText = firstParagraph.child(at: 0) as? Text else { return nil }
-		let raw = firstText.string
-		guard raw.hasPrefix("[!") else { return nil }
-		guard let closing = raw.firstIndex(of: "]") else { return nil }
-		return String(raw[raw.index(raw.startIndex, offsetBy: 2)..<closing])
-	}
-
-	private func doccAsideToken(in quote: BlockQuote) -> String? {
-		guard let firstParagraph = quote.child(at: 0) as? Paragraph else { return nil }
-		guard let firstText = firstParagraph.child(at: 0) as? Text else { return nil }
-		guard let colon = firstText.string.firstIndex(of: ":") else { return nil }
-		let token = String(firstText.string[..<colon])
-		// DocC tags are single-word identifiers without whitespace.
-		guard !token.isEmpty, !token.contains(where: { $0.isWhitespace }) else { return nil }
-		return token
-	}
-
-	private func alert(forToken token: String, terminator: Character, in quote: BlockQuote) -> GitHubAlert? {
-		let role: String
-		let title: String
-		switch token.uppercased() {
-		case "NOTE": (title, role) = ("Note", "note")
-		case "TIP": (title, role) = ("Tip", "note")
-		case "IMPORTANT": (title, role) = ("Important", "note")
-		case "WARNING": (title, role) = ("Warning", "alert")
-		case "CAUTION": (title, role) = ("Caution", "alert")
-		case "EXPERIMENT": (title, role) = ("Experiment", "note")
-		default: return nil
-		}
-		return GitHubAlert(kind: token.lowercased(), title: title, role: role, markerTerminator: terminator, body: quote)
-	}
-
-	private mutating func emitGitHubAlert(_ alert: GitHubAlert) {
-		output += "<aside class=\"markdown-alert markdown-alert-\(alert.kind)\" data-alert=\"\(alert.kind)\" role=\"\(alert.role)\">"
-		output += "<p class=\"markdown-alert-title\">\(alert.title)</p>"
-
-		// Render the blockquote children, but skip the [!TYPE] marker that lives at
-		// the start of the first paragraph. If the marker line stands alone (e.g.
-		// "> [!NOTE]\n> body"), drop the trailing soft-break that would otherwise
-		// inject a leading newline into the body paragraph.
-		let children = Array(alert.body.children)
-		for (index, child) in children.enumerated() {
-			if index == 0, let paragraph = child as? Paragraph {
-				var inlineChildren = Array(paragraph.children)
-				guard !inlineChildren.isEmpty else { continue }
-				if let firstText = inlineChildren.first as? Text {
-					var stripped = firstText.string
-					if let closing = stripped.firstIndex(of: alert.markerTerminator) {
-						stripped.removeSubrange(stripped.startIndex...closing)
-						if stripped.hasPrefix(" ") { stripped.removeFirst() }
-					}
-					if stripped.isEmpty {
-						inlineChildren.removeFirst()
-						// Marker had its own line — eat the soft-break that followed.
-						if let next = inlineChildren.first, next is SoftBreak {
-							inlineChildren.removeFirst()
-						}
-						if inlineChildren.isEmpty { continue }
-						output += "<p>"
-						for tail in inlineChildren { visit(tail) }
-						output += "</p>"
-					} else {
-						output += "<p>"
-						output += escapeHTMLNotQuote(stripped)
-						for tail in inlineChildren.dropFirst() { visit(tail) }
-						output += "</p>"
-					}
-				} else {
-					output += "<p>"
-					for inline in inlineChildren { visit(inline) }
-					output += "</p>"
-				}
-			} else {
-				visit(child)
-			}
-		}
-		output += "</aside>"
+		for child in alert.remainingBlocks { visit(child) }
+		write("</aside>")
 	}
 
 	// MARK: - Escaping
@@ -414,38 +373,75 @@ private struct HTMLRenderer: MarkupVisitor {
 	/// Escapes `&<>"` — used for attribute values where the surrounding double
 	/// quote marks must be preserved.
 	private func escapeHTML(_ string: String) -> String {
-		var result = ""
-		result.reserveCapacity(string.count)
-		for character in string {
-			switch character {
-			case "&": result += "&amp;"
-			case "<": result += "&lt;"
-			case ">": result += "&gt;"
-			case "\"": result += "&quot;"
-			default: result.append(character)
-			}
-		}
-		return result
+		htmlEscaped(string, escapingQuotes: true)
 	}
 
 	/// Escapes `&<>` only — matches the legacy parser's policy for code blocks
 	/// and inline raw HTML, where `"` is left literal.
 	private func escapeHTMLNotQuote(_ string: String) -> String {
-		var result = ""
-		result.reserveCapacity(string.count)
-		for character in string {
-			switch character {
-			case "&": result += "&amp;"
-			case "<": result += "&lt;"
-			case ">": result += "&gt;"
-			default: result.append(character)
-			}
-		}
-		return result
+		htmlEscaped(string, escapingQuotes: false)
 	}
 
 	private func escapeAttribute(_ string: String) -> String {
 		escapeHTML(string)
 	}
 
+	/// Writes body text, turning `[^id]` references into footnote anchors when
+	/// rendering with footnotes. Anchor ids are handed out in write order, so the
+	/// first reference to footnote `N` in the output is `ref-N`.
+	private mutating func writeText(_ string: String) {
+		guard let footnotes, string.contains("[^") else {
+			write(escapeHTMLNotQuote(string))
+			return
+		}
+		for event in scanFootnoteReferences(in: string, record: footnotes.recordReference) {
+			switch event {
+			case .literal(let literal):
+				write(escapeHTMLNotQuote(literal))
+			case .reference(let number):
+				let anchorID = footnotes.nextReferenceAnchorID(forNumber: number)
+				write("<sup><a href=\"#fn-\(number)\" id=\"\(anchorID)\">[\(number)]</a></sup>")
+			}
+		}
+	}
+}
+
+/// Escapes `&<>` (and `"` when `escapingQuotes` is set) for HTML output. Shared
+/// by the AST renderer and ``HTMLEventWriter`` so both apply the same policy.
+///
+/// Works on UTF-8 bytes: the characters to escape are all ASCII, so they can
+/// never be part of a multi-byte scalar. Text without any of them — most of a
+/// document — is returned as is, and otherwise the runs between escapes are
+/// copied in bulk.
+func htmlEscaped(_ string: String, escapingQuotes: Bool) -> String {
+	let utf8 = string.utf8
+	let quote: UInt8 = escapingQuotes ? UInt8(ascii: "\"") : UInt8(ascii: "&")
+	func needsEscape(_ byte: UInt8) -> Bool {
+		byte == UInt8(ascii: "&") || byte == UInt8(ascii: "<") || byte == UInt8(ascii: ">") || byte == quote
+	}
+	guard var index = utf8.firstIndex(where: needsEscape) else { return string }
+
+	var result = ""
+	result.reserveCapacity(utf8.count + 16)
+	let scalars = string.unicodeScalars
+	var runStart = utf8.startIndex
+	while index < utf8.endIndex {
+		let replacement: String
+		switch utf8[index] {
+		case UInt8(ascii: "&"): replacement = "&amp;"
+		case UInt8(ascii: "<"): replacement = "&lt;"
+		case UInt8(ascii: ">"): replacement = "&gt;"
+		case UInt8(ascii: "\"") where escapingQuotes: replacement = "&quot;"
+		default:
+			index = utf8.index(after: index)
+			continue
+		}
+		// An ASCII byte always starts a scalar, so the run ends on a scalar boundary.
+		result += Substring(scalars[runStart..<index])
+		result += replacement
+		index = utf8.index(after: index)
+		runStart = index
+	}
+	result += Substring(scalars[runStart...])
+	return result
 }
@@ -1,3 +1,4 @@
+import SwiftTextCore
 import SwiftTextIWA
 import Foundation
 
@@ -9,9 +10,17 @@ public final class NumbersFile {
 	public let url: URL
 	public let document: NumbersDocument
 
-	public init(url: URL) throws {
+	/// Reads the spreadsheet at `url`, optionally bounded by `limits` for untrusted input.
+	public init(url: URL, limits: ResourceLimits = .unlimited) throws {
 		self.url = url
-		self.document = try NumbersParser().readDocument(from: url)
+		self.document = try NumbersParser().readDocument(from: url, limits: limits)
+	}
+
+	/// Async variant of ``init(url:limits:)``; cancelling the calling task stops table
+	/// decoding at the next tile of rows and throws `CancellationError`.
+	public static func open(url: URL, limits: ResourceLimits = .unlimited) async throws -> NumbersFile {
+		try Task.checkCancellation()
+		return try NumbersFile(url: url, limits: limits)
 	}
 
 	/// GitHub-flavored Markdown: one pipe table per spreadsheet table, each preceded by
@@ -1,3 +1,4 @@
+import SwiftTextCore
 import SwiftTextIWA
 import Foundation
 
@@ -40,12 +41,13 @@ public struct NumbersParser {
 
 	public init() {}
 
-	public func readDocument(from url: URL) throws -> NumbersDocument {
+	public func readDocument(from url: URL, limits: ResourceLimits = .unlimited) throws -> NumbersDocument {
 		guard FileManager.default.fileExists(atPath: url.path) else {
 			throw NumbersParserError.fileNotFound(url)
 		}
+		let budget = ResourceBudget(limits)
 		// Modern (iWork '13+) documents store content as Index/*.iwa objects.
-		let entries = try IWAContainer.entries(at: url, prefix: "Index/", suffix: ".iwa")
+		let entries = try IWAContainer.entries(at: url, prefix: "Index/", suffix: ".iwa", budget: budget)
 		guard !entries.isEmpty else {
 			// Legacy (iWork '09) documents store a single uncompressed index.xml instead,
 			// mirroring how PagesParser falls back to PagesLegacyParser. Tables are decoded
@@ -62,10 +64,20 @@ public struct NumbersParser {
 		for entry in entries {
 			// Skip any entry that isn't a standard Snappy/Protobuf IWA file (e.g. the
 			// collaboration/undo log), matching how the Pages reader loads its store.
-			guard let objects = try? IWAArchive.objects(from: entry.data) else { continue }
+			let objects: [IWAObject]
+			do {
+				objects = try IWAArchive.objects(from: entry.data, budget: budget)
+			} catch let error where error is ResourceLimitError || error is CancellationError {
+				throw error
+			} catch {
+				continue
+			}
 			for object in objects { store.add(object) }
 		}
-		return Self.buildDocument(from: store)
+		let document = Self.buildDocument(from: store)
+		// Table decoding bails out early on cancellation; don't hand back the partial result.
+		try Task.checkCancellation()
+		return document
 	}
 
 	static func buildDocument(from store: IWAObjectStore) -> NumbersDocument {
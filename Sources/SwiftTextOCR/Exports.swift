@@ -0,0 +1,3 @@
+// TextLine/TextFragment live in SwiftTextCore so the cross-platform PDF reader can
+// produce them too; re-export so `import SwiftTextOCR` keeps providing them.
+@_exported import SwiftTextCore
@@ -7,6 +7,7 @@
 
 import PDFKit
 import SwiftTextOCR
+import SwiftTextPDFReader
 #if canImport(Vision)
 import Vision
 #endif
@@ -17,14 +18,27 @@ public extension PDFDocument {
 	 
 	 - Returns: An array of `TextLine` objects representing recognized text lines from the entire document.
 	 - Discussion:
-	   This method processes each page, first attempting to extract text using the PDFKit text selection mechanism. If no selectable text is found, it falls back to OCR using Apple's Vision framework.
+	   This method processes each page, first attempting to extract text using the PDFKit text selection mechanism. If no selectable text is found, the page is read with `PDFTextReader`, which copes with some fonts PDFKit can't map; only then does it fall back to OCR using Apple's Vision framework.
 	 */
 	func textLines() -> [TextLine] {
 		var allLines = [TextLine]()
+		// Parsed on first need, so documents PDFKit reads fully never pay for it.
+		var portableReader: PDFTextReader??
 
 		for pageIndex in 0..<self.pageCount {
 			guard let page = self.page(at: pageIndex) else { continue }
-			allLines.append(contentsOf: page.textLines())
+			if let selectionLines = page.textLinesFromSelections(), !selectionLines.isEmpty {
+				allLines.append(contentsOf: selectionLines)
+				continue
+			}
+			if portableReader == nil {
+				portableReader = .some(dataRepresentation().flatMap { try? PDFTextReader(data: $0) })
+			}
+			if let reader = portableReader ?? nil, let lines = try? reader.textLines(page: pageIndex), !lines.isEmpty {
+				allLines.append(contentsOf: lines)
+				continue
+			}
+			allLines.append(contentsOf: page.textLinesFromOCR() ?? [])
 		}
 
 		return allLines
@@ -0,0 +1,308 @@
+//  Inflate.swift
+//  SwiftTextPDFReader
+//
+//  A dependency-free DEFLATE (RFC 1951) decoder with the zlib (RFC 1950)
+//  wrapper, the counterpart of SwiftTextPDFWriter's `Deflate`. Handles stored,
+//  fixed-Huffman and dynamic-Huffman blocks. Codes up to nine bits — nearly
+//  every literal in a content stream — decode with one table lookup; longer
+//  codes fall back to the canonical bit-by-bit walk.
+//
+//  PDF producers are sloppy about stream ends (missing Adler-32, truncated
+//  final blocks), so running out of input returns what was decoded so far
+//  rather than failing, as every mainstream viewer does.
+
+import Foundation
+
+enum Inflate {
+	enum Error: Swift.Error {
+		case invalidBlockType
+		case invalidStoredLength
+		case invalidCode
+		case invalidDistance
+		/// The output grew past the caller's `limit`.
+		case outputLimitExceeded
+	}
+
+	/// Decode a zlib stream. Streams without a valid zlib header are decoded as
+	/// raw DEFLATE, which some producers emit under `/FlateDecode`.
+	static func zlib(_ input: [UInt8], limit: Int = .max) throws -> [UInt8] {
+		if input.count >= 2, input[0] & 0x0F == 8, (Int(input[0]) << 8 | Int(input[1])) % 31 == 0 {
+			return try raw(input, from: 2, limit: limit)
+		}
+		return try raw(input, from: 0, limit: limit)
+	}
+
+	/// Decode a raw DEFLATE stream starting at byte `start`, throwing
+	/// ``Error/outputLimitExceeded`` as soon as the output passes `limit` bytes,
+	/// so a flate bomb is stopped before it is allocated.
+	static func raw(_ input: [UInt8], from start: Int = 0, limit: Int = .max) throws -> [UInt8] {
+		var reader = BitReader(input, position: start)
+		var output = [UInt8]()
+		output.reserveCapacity(min(input.count.multipliedReportingOverflow(by: 4).partialValue, limit))
+
+		var isFinal = false
+		while !isFinal {
+			guard let header = reader.bits(3) else { break }
+			isFinal = header & 1 == 1
+			switch header >> 1 {
+			case 0:
+				guard try storedBlock(&reader, into: &output, limit: limit) else { return output }
+			case 1:
+				guard try huffmanBlock(&reader, literals: fixedLiterals, distances: fixedDistances,
+				                       into: &output, limit: limit) else { return output }
+			case 2:
+				guard let (literals, distances) = try dynamicTables(&reader) else { return output }
+				guard try huffmanBlock(&reader, literals: literals, distances: distances,
+				                       into: &output, limit: limit) else { return output }
+			default:
+				throw Error.invalidBlockType
+			}
+		}
+		return output
+	}
+
+	// MARK: - Blocks
+
+	/// Returns `false` when the input ends inside the block.
+	private static func storedBlock(_ reader: inout BitReader, into output: inout [UInt8], limit: Int) throws -> Bool {
+		reader.alignToByte()
+		guard let length = reader.bits(16), let complement = reader.bits(16) else { return false }
+		guard length == ~complement & 0xFFFF else { throw Error.invalidStoredLength }
+		guard output.count + length <= limit else { throw Error.outputLimitExceeded }
+		return reader.copyBytes(length, into: &output)
+	}
+
+	/// Returns `false` when the input ends inside the block.
+	private static func huffmanBlock(_ reader: inout BitReader, literals: Huffman, distances: Huffman,
+	                                 into output: inout [UInt8], limit: Int) throws -> Bool {
+		while true {
+			guard let symbol = try literals.decode(&reader) else { return false }
+			if symbol < 256 {
+				guard output.count < limit else { throw Error.outputLimitExceeded }
+				output.append(UInt8(symbol))
+				continue
+			}
+			if symbol == 256 { return true }
+
+			let lengthIndex = symbol - 257
+			guard lengthIndex < lengthBase.count else { throw Error.invalidCode }
+			guard let lengthExtra = reader.bits(lengthExtraBits[lengthIndex]) else { return false }
+			let length = lengthBase[lengthIndex] + lengthExtra
+
+			guard let distanceSymbol = try distances.decode(&reader) else { return false }
+			guard distanceSymbol < distanceBase.count else { throw Error.invalidCode }
+			guard let distanceExtra = reader.bits(distanceExtraBits[distanceSymbol]) else { return false }
+			let distance = distanceBase[distanceSymbol] + distanceExtra
+			guard distance <= output.count else { throw Error.invalidDistance }
+			guard output.count + length <= limit else { throw Error.outputLimitExceeded }
+
+			// Overlapping copies (distance < length) are how runs are encoded, so
+			// copy byte by byte from the growing output.
+			var from = output.count - distance
+			for _ in 0 ..< length {
+				output.append(output[from])
+				from += 1
+			}
+		}
+	}
+
+	private static func dynamicTables(_ reader: inout BitReader) throws -> (Huffman, Huffman)? {
+		guard let hlit = reader.bits(5), let hdist = reader.bits(5), let hclen = reader.bits(4) else { return nil }
+		let literalCount = hlit + 257, distanceCount = hdist + 1
+
+		var codeLengthLengths = [UInt8](repeating: 0, count: 19)
+		for index in 0 ..< hclen + 4 {
+			guard let length = reader.bits(3) else { return nil }
+			codeLengthLengths[codeLengthOrder[index]] = UInt8(length)
+		}
+		let codeLengthCode = try Huffman(lengths: codeLengthLengths)
+
+		var lengths = [UInt8]()
+		lengths.reserveCapacity(literalCount + distanceCount)
+		while lengths.count < literalCount + distanceCount {
+			guard let symbol = try codeLengthCode.decode(&reader) else { return nil }
+			switch symbol {
+			case 0 ..< 16:
+				lengths.append(UInt8(symbol))
+			case 16:
+				guard let previous = lengths.last else { throw Error.invalidCode }
+				guard let repeatCount = reader.bits(2) else { return nil }
+				lengths.append(contentsOf: repeatElement(previous, count: 3 + repeatCount))
+			case 17:
+				guard let repeatCount = reader.bits(3) else { return nil }
+				lengths.append(contentsOf: repeatElement(0, count: 3 + repeatCount))
+			default:
+				guard let repeatCount = reader.bits(7) else { return nil }
+				lengths.append(contentsOf: repeatElement(0, count: 11 + repeatCount))
+			}
+		}
+		guard lengths.count == literalCount + distanceCount else { throw Error.invalidCode }
+		return (try Huffman(lengths: Array(lengths[..<literalCount])),
+		        try Huffman(lengths: Array(lengths[literalCount...])))
+	}
+
+	// MARK: - Tables
+
+	private static let lengthBase = [3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+	                                 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258]
+	private static let lengthExtraBits = [0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+	                                      3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0]
+	private static let distanceBase = [1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+	                                   257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145,
+	                                   8193, 12289, 16385, 24577]
+	private static let distanceExtraBits = [0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+	                                        7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13]
+	private static let codeLengthOrder = [16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15]
+
+	private static let fixedLiterals: Huffman = {
+		var lengths = [UInt8](repeating: 8, count: 288)
+		for index in 144 ..< 256 { lengths[index] = 9 }
+		for index in 256 ..< 280 { lengths[index] = 7 }
+		// swiftlint:disable:next force_try
+		return try! Huffman(lengths: lengths)
+	}()
+
+	private static let fixedDistances: Huffman = {
+		// swiftlint:disable:next force_try
+		try! Huffman(lengths: [UInt8](repeating: 5, count: 30))
+	}()
+}
+
+// MARK: - Huffman decoding
+
+/// A canonical Huffman code. `fast` maps the next nine (bit-reversed) input bits
+/// straight to `symbol << 4 | length`; zero marks a longer code.
+private struct Huffman {
+	private static let fastBits = 9
+
+	private var counts = [Int](repeating: 0, count: 16)
+	private var symbols: [Int]
+	private var fast = [UInt16](repeating: 0, count: 1 << fastBits)
+
+	init(lengths: [UInt8]) throws {
+		for length in lengths { counts[Int(length)] += 1 }
+		counts[0] = 0
+
+		var offsets = [Int](repeating: 0, count: 16)
+		for length in 1 ..< 16 { offsets[length] = offsets[length - 1] + counts[length - 1] }
+		symbols = [Int](repeating: 0, count: lengths.count)
+		var nextCode = [Int](repeating: 0, count: 16)
+		var code = 0
+		for length in 1 ..< 16 {
+			code = (code + counts[length - 1]) << 1
+			nextCode[length] = code
+		}
+
+		var placement = offsets
+		for (symbol, length) in lengths.enumerated() where length > 0 {
+			let bitLength = Int(length)
+			symbols[placement[bitLength]] = symbol
+			placement[bitLength] += 1
+
+			let assigned = nextCode[bitLength]
+			nextCode[bitLength] += 1
+			guard bitLength <= Self.fastBits else { continue }
+			// The stream stores codes most-significant bit first, inside an
+			// LSB-first bit stream, so the lookup index is the reversed code.
+			var reversed = 0
+			for bit in 0 ..< bitLength where assigned & (1 << bit) != 0 {
+				reversed |= 1 << (bitLength - 1 - bit)
+			}
+			let entry = UInt16(symbol << 4 | bitLength)
+			var fill = reversed
+			while fill < 1 << Self.fastBits {
+				fast[fill] = entry
+				fill += 1 << bitLength
+			}
+		}
+	}
+
+	/// The next symbol, or `nil` when the input is exhausted.
+	func decode(_ reader: inout BitReader) throws -> Int? {
+		let available = reader.peek(15)
+		if available.count > 0 {
+			let entry = Int(fast[Int(available.bits) & ((1 << Self.fastBits) - 1)])
+			let length = entry & 0xF
+			if length > 0 && length <= available.count {
+				reader.consume(length)
+				return entry >> 4
+			}
+		}
+
+		// Canonical decode, one bit at a time (puff's algorithm).
+		var code = 0, first = 0, index = 0
+		for length in 1 ..< 16 {
+			guard length <= available.count else { return nil }
+			code |= Int(available.bits >> (length - 1)) & 1
+			let count = counts[length]
+			if code - count < first {
+				reader.consume(length)
+				return symbols[index + code - first]
+			}
+			index += count
+			first = (first + count) << 1
+			code <<= 1
+		}
+		throw Inflate.Error.invalidCode
+	}
+}
+
+/// An LSB-first bit reader over a byte array.
+private struct BitReader {
+	private let input: [UInt8]
+	private var position: Int
+	private var buffer: UInt64 = 0
+	private var count = 0
+
+	init(_ input: [UInt8], position: Int) {
+		self.input = input
+		self.position = position
+	}
+
+	private mutating func refill() {
+		while count <= 56 && position < input.count {
+			buffer |= UInt64(input[position]) << UInt64(count)
+			position += 1
+			count += 8
+		}
+	}
+
+	/// Up to `n` upcoming bits without consuming them, and how many were available.
+	mutating func peek(_ n: Int) -> (bits: UInt64, count: Int) {
+		if count < n { refill() }
+		return (buffer, min(n, count))
+	}
+
+	mutating func consume(_ n: Int) {
+		buffer >>= UInt64(n)
+		count -= n
+	}
+
+	/// Read `n` bits (n ≤ 32), or `nil` at end of input.
+	mutating func bits(_ n: Int) -> Int? {
+		guard n > 0 else { return 0 }
+		if count < n { refill() }
+		guard count >= n else { return nil }
+		let value = Int(buffer & ((1 << UInt64(n)) - 1))
+		consume(n)
+		return value
+	}
+
+	mutating func alignToByte() {
+		consume(count & 7)
+	}
+
+	/// Copy `length` whole bytes (after ``alignToByte()``); `false` if truncated.
+	mutating func copyBytes(_ length: Int, into output: inout [UInt8]) -> Bool {
+		var remaining = length
+		while remaining > 0 && count >= 8 {
+			output.append(UInt8(buffer & 0xFF))
+			consume(8)
+			remaining -= 1
+		}
+		let available = min(remaining, input.count - position)
+		output.append(contentsOf: input[position ..< position + available])
+		position += available
+		return available == remaining
+	}
+}
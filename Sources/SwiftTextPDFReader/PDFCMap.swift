@@ -0,0 +1,151 @@
+//  PDFCMap.swift
+//  SwiftTextPDFReader
+//
+//  Parser for the CMap subset that PDFs embed: `ToUnicode` maps (bfchar/bfrange)
+//  and the code → CID maps of composite fonts (cidchar/cidrange), together with
+//  the codespace ranges that say how many bytes each character code takes.
+
+import Foundation
+
+struct PDFCMap: Sendable {
+	struct CodespaceRange: Sendable {
+		let length: Int
+		let low: UInt32
+		let high: UInt32
+	}
+
+	struct CIDRange: Sendable {
+		let low: UInt32
+		let high: UInt32
+		let firstCID: Int
+	}
+
+	/// bfrange entries wider than this are clipped; real fonts never need more.
+	private static let maximumRangeSize: UInt32 = 0x10000
+
+	private(set) var codespaces: [CodespaceRange] = []
+	private(set) var unicode: [UInt32: String] = [:]
+	private(set) var cidRanges: [CIDRange] = []
+	private(set) var cids: [UInt32: Int] = [:]
+	/// The `usecmap` parent, if any (only predefined names are honoured).
+	private(set) var parentName: String?
+
+	init() {}
+
+	init(_ data: [UInt8]) {
+		var lexer = PDFLexer(data)
+		var operands = [PDFPrimitive]()
+		while true {
+			let token = lexer.nextToken()
+			switch token {
+			case .end:
+				return
+			case .keyword(let keyword):
+				apply(keyword, operands: operands)
+				operands.removeAll(keepingCapacity: true)
+			default:
+				if let value = lexer.object(startingWith: token, references: false) { operands.append(value) }
+			}
+		}
+	}
+
+	private mutating func apply(_ keyword: String, operands: [PDFPrimitive]) {
+		switch keyword {
+		case "endcodespacerange":
+			for pair in stride(from: 0, to: operands.count - 1, by: 2) {
+				guard let low = operands[pair].bytes, let high = operands[pair + 1].bytes, !low.isEmpty else { continue }
+				codespaces.append(CodespaceRange(length: low.count, low: Self.code(low), high: Self.code(high)))
+			}
+		case "endbfchar":
+			for pair in stride(from: 0, to: operands.count - 1, by: 2) {
+				guard let source = operands[pair].bytes else { continue }
+				let target: String?
+				switch operands[pair + 1] {
+				case .string(let bytes): target = Self.utf16(bytes)
+				case .name(let glyph): target = PDFEncodings.unicode(forGlyphName: glyph)
+				default: target = nil
+				}
+				if let target { unicode[Self.code(source)] = target }
+			}
+		case "endbfrange":
+			for triple in stride(from: 0, to: operands.count - 2, by: 3) {
+				guard let lowBytes = operands[triple].bytes, let highBytes = operands[triple + 1].bytes else { continue }
+				let low = Self.code(lowBytes)
+				let high = min(Self.code(highBytes), low &+ Self.maximumRangeSize - 1)
+				guard high >= low else { continue }
+				switch operands[triple + 2] {
+				case .string(let bytes):
+					// The destination's last UTF-16 unit increments across the range.
+					var units = Self.units(bytes)
+					guard !units.isEmpty else { continue }
+					let base = units[units.count - 1]
+					for offset in 0 ... high - low {
+						units[units.count - 1] = base &+ UInt16(truncatingIfNeeded: offset)
+						unicode[low + offset] = String(decoding: units, as: UTF16.self)
+					}
+				case .array(let targets):
+					for (offset, target) in targets.prefix(Int(high - low) + 1).enumerated() {
+						if let bytes = target.bytes { unicode[low + UInt32(offset)] = Self.utf16(bytes) }
+					}
+				default:
+					continue
+				}
+			}
+		case "endcidrange":
+			for triple in stride(from: 0, to: operands.count - 2, by: 3) {
+				guard let low = operands[triple].bytes, let high = operands[triple + 1].bytes,
+				      let cid = operands[triple + 2].integer else { continue }
+				cidRanges.append(CIDRange(low: Self.code(low), high: Self.code(high), firstCID: cid))
+			}
+		case "endcidchar":
+			for pair in stride(from: 0, to: operands.count - 1, by: 2) {
+				guard let source = operands[pair].bytes, let cid = operands[pair + 1].integer else { continue }
+				cids[Self.code(source)] = cid
+			}
+		case "usecmap":
+			parentName = operands.last?.name
+		default:
+			break
+		}
+	}
+
+	// MARK: - Lookup
+
+	/// The number of bytes of the code starting at `offset`, per the codespace ranges.
+	func codeLength(in bytes: [UInt8], at offset: Int) -> Int {
+		guard !codespaces.isEmpty else { return 2 }
+		var value: UInt32 = 0
+		for length in 1 ... 4 where offset + length <= bytes.count {
+			value = value << 8 | UInt32(bytes[offset + length - 1])
+			if codespaces.contains(where: { $0.length == length && value >= $0.low && value <= $0.high }) {
+				return length
+			}
+		}
+		// No range matched: consume as many bytes as the shortest range takes.
+		return min(codespaces.map(\.length).min() ?? 1, bytes.count - offset)
+	}
+
+	func cid(for code: UInt32) -> Int? {
+		if let cid = cids[code] { return cid }
+		for range in cidRanges where code >= range.low && code <= range.high {
+			return range.firstCID + Int(code - range.low)
+		}
+		return nil
+	}
+
+	// MARK: - Helpers
+
+	static func code(_ bytes: [UInt8]) -> UInt32 {
+		bytes.prefix(4).reduce(0) { $0 << 8 | UInt32($1) }
+	}
+
+	private static func units(_ bytes: [UInt8]) -> [UInt16] {
+		stride(from: 0, to: bytes.count - 1, by: 2).map { UInt16(bytes[$0]) << 8 | UInt16(bytes[$0 + 1]) }
+	}
+
+	/// ToUnicode destinations are UTF-16BE; a lone byte is taken as Latin-1.
+	private static func utf16(_ bytes: [UInt8]) -> String {
+		if bytes.count == 1 { return String(Character(Unicode.Scalar(bytes[0]))) }
+		return String(decoding: units(bytes), as: UTF16.self)
+	}
+}
@@ -0,0 +1,327 @@
+//  PDFContentInterpreter.swift
+//  SwiftTextPDFReader
+//
+//  Runs a page's content stream far enough to know where text lands: the
+//  graphics state stack and CTM, the text object operators (ISO 32000-1 §9.4)
+//  and Form XObjects. Every other operator — paths, colour, images, shading —
+//  is parsed and ignored.
+
+import Foundation
+import SwiftTextCore
+
+final class PDFContentInterpreter {
+	private struct GraphicsState {
+		var ctm: PDFMatrix
+		var font: PDFFont?
+		var fontSize = 0.0
+		var characterSpacing = 0.0
+		var wordSpacing = 0.0
+		var horizontalScale = 1.0
+		var leading = 0.0
+		var rise = 0.0
+	}
+
+	/// Forms nested deeper than this are skipped; real documents use two or three levels.
+	private static let maximumFormDepth = 8
+	/// Operators run between deadline and cancellation checks.
+	private static let checkpointInterval = 1024
+
+	private let store: PDFObjectStore
+	private let fonts: PDFFontCache
+	private var state: GraphicsState
+	private var stateStack: [GraphicsState] = []
+	private var textMatrix = PDFMatrix.identity
+	private var lineMatrix = PDFMatrix.identity
+	private var resources: PDFDictionaryValue
+	private var fontsByName: [String: PDFFont] = [:]
+	private var activeForms: [Int] = []
+	/// Decoded form content by object number, so a form drawn again isn't
+	/// inflated again.
+	private var formContents: [Int: [UInt8]] = [:]
+	private var operatorCount = 0
+	private var collector = PDFTextCollector()
+
+	/// - Parameter displayMatrix: Maps default user space to the page's top-left
+	///   origin display space, including `/Rotate`.
+	init(store: PDFObjectStore, fonts: PDFFontCache, resources: PDFDictionaryValue, displayMatrix: PDFMatrix) {
+		self.store = store
+		self.fonts = fonts
+		self.resources = resources
+		self.state = GraphicsState(ctm: displayMatrix)
+	}
+
+	/// Interpret `content` and return the text it shows as fragments.
+	/// - Throws: `ResourceLimitError` or `CancellationError` from the store's budget.
+	func fragments(of content: [UInt8]) throws -> [TextFragment] {
+		try run(content)
+		collector.flush()
+		return collector.fragments
+	}
+
+	// MARK: - Operators
+
+	private func run(_ content: [UInt8]) throws {
+		var lexer = PDFLexer(content)
+		var operands = [PDFPrimitive]()
+		while true {
+			let token = lexer.nextToken()
+			switch token {
+			case .end:
+				return
+			case .keyword(let op):
+				operatorCount += 1
+				if operatorCount % Self.checkpointInterval == 0 { try store.budget.checkpoint() }
+				try perform(op, operands)
+				operands.removeAll(keepingCapacity: true)
+			default:
+				if let value = lexer.object(startingWith: token, references: false) { operands.append(value) }
+			}
+		}
+	}
+
+	private func perform(_ op: String, _ operands: [PDFPrimitive]) throws {
+		func number(_ index: Int) -> Double {
+			index < operands.count ? operands[index].number ?? 0 : 0
+		}
+
+		switch op {
+		case "q":
+			stateStack.append(state)
+		case "Q":
+			if let saved = stateStack.popLast() { state = saved }
+		case "cm":
+			if let matrix = PDFMatrix(operands) { state.ctm = matrix.concatenating(state.ctm) }
+		case "BT":
+			textMatrix = .identity
+			lineMatrix = .identity
+		case "ET":
+			break
+		case "Tf":
+			if operands.count >= 2, let name = operands[0].name {
+				state.font = font(named: name)
+				state.fontSize = number(1)
+			}
+		case "Tc": state.characterSpacing = number(0)
+		case "Tw": state.wordSpacing = number(0)
+		case "Tz": state.horizontalScale = number(0) / 100
+		case "TL": state.leading = number(0)
+		case "Ts": state.rise = number(0)
+		case "Td":
+			moveLine(number(0), number(1))
+		case "TD":
+			state.leading = -number(1)
+			moveLine(number(0), number(1))
+		case "Tm":
+			if let matrix = PDFMatrix(operands) {
+				textMatrix = matrix
+				lineMatrix = matrix
+			}
+		case "T*":
+			moveLine(0, -state.leading)
+		case "Tj":
+			if let bytes = operands.first?.bytes { show(bytes) }
+		case "'":
+			moveLine(0, -state.leading)
+			if let bytes = operands.first?.bytes { show(bytes) }
+		case "\"":
+			state.wordSpacing = number(0)
+			state.characterSpacing = number(1)
+			moveLine(0, -state.leading)
+			if operands.count >= 3, let bytes = operands[2].bytes { show(bytes) }
+		case "TJ":
+			for item in operands.first?.array ?? [] {
+				if let bytes = item.bytes {
+					show(bytes)
+				} else if let adjustment = item.number {
+					advance(-adjustment / 1000 * state.fontSize * state.horizontalScale)
+				}
+			}
+		case "Do":
+			if let name = operands.first?.name { try drawXObject(named: name) }
+		default:
+			break
+		}
+	}
+
+	private func moveLine(_ x: Double, _ y: Double) {
+		lineMatrix = PDFMatrix.translation(x, y).concatenating(lineMatrix)
+		textMatrix = lineMatrix
+	}
+
+	private func advance(_ distance: Double) {
+		textMatrix = PDFMatrix.translation(distance, 0).concatenating(textMatrix)
+	}
+
+	// MARK: - Text
+
+	private func font(named name: String) -> PDFFont? {
+		if let cached = fontsByName[name] { return cached }
+		guard let fontResources = store.value("Font", in: resources)?.dictionary,
+		      let entry = fontResources[name],
+		      let font = fonts.font(for: entry) else { return nil }
+		fontsByName[name] = font
+		return font
+	}
+
+	private func show(_ bytes: [UInt8]) {
+		guard let font = state.font else { return }
+		let size = state.fontSize
+		let scale = state.horizontalScale
+		for glyph in font.glyphs(bytes) {
+			// Text rendering matrix: font size, horizontal scale and rise, then Tm, then CTM.
+			let rendering = PDFMatrix(size * scale, 0, 0, size, 0, state.rise)
+				.concatenating(textMatrix)
+				.concatenating(state.ctm)
+			let width = glyph.width / 1000
+			let corners = (rendering.apply(0, font.descent / 1000), rendering.apply(width, font.descent / 1000),
+			               rendering.apply(0, font.ascent / 1000), rendering.apply(width, font.ascent / 1000))
+			let bounds = (minX: min(corners.0.x, corners.1.x, corners.2.x, corners.3.x),
+			              minY: min(corners.0.y, corners.1.y, corners.2.y, corners.3.y),
+			              maxX: max(corners.0.x, corners.1.x, corners.2.x, corners.3.x),
+			              maxY: max(corners.0.y, corners.1.y, corners.2.y, corners.3.y))
+			collector.add(glyph.text,
+			              origin: rendering.apply(0, 0),
+			              end: rendering.apply(width, 0),
+			              bounds: bounds,
+			              size: (rendering.c * rendering.c + rendering.d * rendering.d).squareRoot())
+			var distance = glyph.width / 1000 * size + state.characterSpacing
+			if glyph.isWordSpace { distance += state.wordSpacing }
+			advance(distance * scale)
+		}
+	}
+
+	// MARK: - XObjects
+
+	/// Run a Form XObject's content. Every drawing counts its content against
+	/// the decompressed-bytes budget, so a form drawn many times over through
+	/// nested forms is bounded like the equivalent inline content would be.
+	private func drawXObject(named name: String) throws {
+		guard activeForms.count < Self.maximumFormDepth,
+		      let xObjects = store.value("XObject", in: resources)?.dictionary,
+		      let reference = xObjects[name] else { return }
+		let number = reference.referenceNumber
+		if let number, activeForms.contains(number) { return }
+		guard let stream = store.resolve(reference).stream,
+		      store.value("Subtype", in: stream.dictionary)?.name == "Form" else { return }
+		try store.budget.checkpoint()
+		let content: [UInt8]
+		if let number, let cached = formContents[number] {
+			try store.budget.charge(.decompressedBytes, cached.count)
+			content = cached
+		} else {
+			do {
+				content = try store.decodedData(stream)
+			} catch let error as ResourceLimitError {
+				throw error
+			} catch {
+				return
+			}
+			if let number { formContents[number] = content }
+		}
+
+		let savedState = state
+		let savedStackDepth = stateStack.count
+		let savedResources = resources
+		let savedFonts = fontsByName
+		let savedText = (textMatrix, lineMatrix)
+		if let matrix = store.value("Matrix", in: stream.dictionary)?.array.flatMap({ PDFMatrix($0) }) {
+			state.ctm = matrix.concatenating(state.ctm)
+		}
+		if let formResources = store.value("Resources", in: stream.dictionary)?.dictionary {
+			resources = formResources
+			fontsByName = [:]
+		}
+		activeForms.append(number ?? -1)
+		defer { activeForms.removeLast() }
+		try run(content)
+
+		state = savedState
+		stateStack.removeSubrange(min(savedStackDepth, stateStack.count)...)
+		resources = savedResources
+		fontsByName = savedFonts
+		(textMatrix, lineMatrix) = savedText
+	}
+}
+
+/// Joins glyphs into whitespace-separated fragments as they are shown, the
+/// same granularity PDFKit selections produce: glyphs on one baseline merge,
+/// a gap wider than a space becomes a space, and a column-sized gap or a
+/// jump backwards starts a new fragment.
+struct PDFTextCollector {
+	private struct Pending {
+		var text: String
+		var minX, minY, maxX, maxY: Double
+		/// Unit vector along the baseline, in display space.
+		var direction: (x: Double, y: Double)
+		/// Offset of the baseline perpendicular to `direction`.
+		var baseline: Double
+		/// Position along `direction` where the last glyph ended.
+		var end: Double
+		var size: Double
+		var pendingSpace: Bool
+	}
+
+	private(set) var fragments: [TextFragment] = []
+	private var current: Pending?
+
+	mutating func add(_ text: String, origin: (x: Double, y: Double), end: (x: Double, y: Double),
+	                  bounds: (minX: Double, minY: Double, maxX: Double, maxY: Double), size: Double) {
+		var dx = end.x - origin.x, dy = end.y - origin.y
+		let length = (dx * dx + dy * dy).squareRoot()
+		if length > 0 {
+			dx /= length
+			dy /= length
+		} else if let current {
+			(dx, dy) = current.direction
+		} else {
+			(dx, dy) = (1, 0)
+		}
+		let along = origin.x * dx + origin.y * dy
+		let across = origin.y * dx - origin.x * dy
+		let isWhitespace = text.unicodeScalars.allSatisfy { $0.properties.isWhitespace }
+
+		if var pending = current {
+			let sameDirection = pending.direction.x * dx + pending.direction.y * dy > 0.99
+			let tolerance = max(pending.size, size) * 0.5
+			let gap = along - pending.end
+			let continues = sameDirection && abs(across - pending.baseline) <= tolerance
+				&& gap > -max(pending.size, size) * 0.5 && gap <= max(size * 0.8, 4)
+			if continues {
+				if isWhitespace {
+					pending.pendingSpace = pending.pendingSpace || !text.isEmpty
+					pending.end = along + length
+					current = pending
+					return
+				}
+				if pending.pendingSpace || gap > size * 0.15 {
+					pending.text.append(" ")
+				}
+				pending.pendingSpace = false
+				pending.text.append(text)
+				pending.end = along + length
+				pending.size = max(pending.size, size)
+				pending.minX = min(pending.minX, bounds.minX)
+				pending.minY = min(pending.minY, bounds.minY)
+				pending.maxX = max(pending.maxX, bounds.maxX)
+				pending.maxY = max(pending.maxY, bounds.maxY)
+				current = pending
+				return
+			}
+		}
+
+		guard !isWhitespace else { return }
+		flush()
+		current = Pending(text: text, minX: bounds.minX, minY: bounds.minY, maxX: bounds.maxX, maxY: bounds.maxY,
+		                  direction: (dx, dy), baseline: across, end: along + length, size: size,
+		                  pendingSpace: false)
+	}
+
+	mutating func flush() {
+		guard let pending = current else { return }
+		current = nil
+		let string = pending.text.trimmingCharacters(in: .whitespacesAndNewlines)
+		guard !string.isEmpty else { return }
+		let bounds = CGRect(x: pending.minX, y: pending.minY, width: pending.maxX - pending.minX, height: pending.maxY - pending.minY)
+		fragments.append(TextFragment(bounds: bounds, string: string))
+	}
+}
@@ -0,0 +1,219 @@
+//  PDFEncodings.swift
+//  SwiftTextPDFReader
+//
+//  The predefined simple-font encodings (ISO 32000-1 Annex D) as code → Unicode
+//  tables, the glyph names needed to apply `/Differences`, and base-14 advance
+//  widths for fonts that omit `/Widths`.
+
+import Foundation
+
+enum PDFEncodings {
+	/// A 256-entry code → Unicode scalar table; 0 marks an unmapped code.
+	typealias Table = [UInt32]
+
+	static func table(named name: String) -> Table? {
+		switch name {
+		case "WinAnsiEncoding": return winAnsi
+		case "MacRomanEncoding": return macRoman
+		case "StandardEncoding": return standard
+		case "PDFDocEncoding": return winAnsi
+		default: return nil
+		}
+	}
+
+	/// Printable ASCII plus Latin-1, shared by every table below.
+	private static let latin: Table = (0 ..< 256).map { $0 >= 0x20 && $0 != 0x7F && ($0 < 0x80 || $0 >= 0xA0) ? UInt32($0) : 0 }
+
+	static let winAnsi: Table = {
+		var table = latin
+		let high: [UInt32] = [
+			0x20AC, 0, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021, 0x02C6, 0x2030, 0x0160, 0x2039, 0x0152, 0, 0x017D, 0,
+			0, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014, 0x02DC, 0x2122, 0x0161, 0x203A, 0x0153, 0, 0x017E, 0x0178
+		]
+		for (offset, scalar) in high.enumerated() { table[0x80 + offset] = scalar }
+		table[0xA0] = 0x20 // WinAnsi's non-breaking space extracts as a space
+		table[0xAD] = 0x2D
+		return table
+	}()
+
+	static let macRoman: Table = {
+		var table = latin
+		let high: [UInt32] = [
+			0xC4, 0xC5, 0xC7, 0xC9, 0xD1, 0xD6, 0xDC, 0xE1, 0xE0, 0xE2, 0xE4, 0xE3, 0xE5, 0xE7, 0xE9, 0xE8,
+			0xEA, 0xEB, 0xED, 0xEC, 0xEE, 0xEF, 0xF1, 0xF3, 0xF2, 0xF4, 0xF6, 0xF5, 0xFA, 0xF9, 0xFB, 0xFC,
+			0x2020, 0xB0, 0xA2, 0xA3, 0xA7, 0x2022, 0xB6, 0xDF, 0xAE, 0xA9, 0x2122, 0xB4, 0xA8, 0x2260, 0xC6, 0xD8,
+			0x221E, 0xB1, 0x2264, 0x2265, 0xA5, 0xB5, 0x2202, 0x2211, 0x220F, 0x03C0, 0x222B, 0xAA, 0xBA, 0x03A9, 0xE6, 0xF8,
+			0xBF, 0xA1, 0xAC, 0x221A, 0x0192, 0x2248, 0x2206, 0xAB, 0xBB, 0x2026, 0x20, 0xC0, 0xC3, 0xD5, 0x0152, 0x0153,
+			0x2013, 0x2014, 0x201C, 0x201D, 0x2018, 0x2019, 0xF7, 0x25CA, 0xFF, 0x0178, 0x2044, 0xA4, 0x2039, 0x203A, 0xFB01, 0xFB02,
+			0x2021, 0xB7, 0x201A, 0x201E, 0x2030, 0xC2, 0xCA, 0xC1, 0xCB, 0xC8, 0xCD, 0xCE, 0xCF, 0xCC, 0xD3, 0xD4,
+			0, 0xD2, 0xDA, 0xDB, 0xD9, 0x0131, 0x02C6, 0x02DC, 0xAF, 0x02D8, 0x02D9, 0x02DA, 0xB8, 0x02DD, 0x02DB, 0x02C7
+		]
+		for (offset, scalar) in high.enumerated() { table[0x80 + offset] = scalar }
+		return table
+	}()
+
+	/// Adobe StandardEncoding: ASCII with curly quotes, and a sparse upper half.
+	static let standard: Table = {
+		var table = [UInt32](repeating: 0, count: 256)
+		for code in 0x20 ..< 0x7F { table[code] = UInt32(code) }
+		table[0x27] = 0x2019
+		table[0x60] = 0x2018
+		let high: [(Int, UInt32)] = [
+			(0xA1, 0xA1), (0xA2, 0xA2), (0xA3, 0xA3), (0xA4, 0x2044), (0xA5, 0xA5), (0xA6, 0x0192), (0xA7, 0xA7),
+			(0xA8, 0xA4), (0xA9, 0x27), (0xAA, 0x201C), (0xAB, 0xAB), (0xAC, 0x2039), (0xAD, 0x203A), (0xAE, 0xFB01),
+			(0xAF, 0xFB02), (0xB1, 0x2013), (0xB2, 0x2020), (0xB3, 0x2021), (0xB4, 0xB7), (0xB6, 0xB6), (0xB7, 0x2022),
+			(0xB8, 0x201A), (0xB9, 0x201E), (0xBA, 0x201D), (0xBB, 0xBB), (0xBC, 0x2026), (0xBD, 0x2030), (0xBF, 0xBF),
+			(0xC1, 0x60), (0xC2, 0xB4), (0xC3, 0x02C6), (0xC4, 0x02DC), (0xC5, 0xAF), (0xC6, 0x02D8), (0xC7, 0x02D9),
+			(0xC8, 0xA8), (0xCA, 0x02DA), (0xCB, 0xB8), (0xCD, 0x02DD), (0xCE, 0x02DB), (0xCF, 0x02C7), (0xD0, 0x2014),
+			(0xE1, 0xC6), (0xE3, 0xAA), (0xE8, 0x0141), (0xE9, 0xD8), (0xEA, 0x0152), (0xEB, 0xBA), (0xF1, 0xE6),
+			(0xF5, 0x0131), (0xF8, 0x0142), (0xF9, 0xF8), (0xFA, 0x0153), (0xFB, 0xDF)
+		]
+		for (code, scalar) in high { table[code] = scalar }
+		return table
+	}()
+
+	// MARK: - Glyph names
+
+	/// The Unicode value of a glyph name from a `/Differences` array: Adobe
+	/// Glyph List names for the Latin repertoire, `uniXXXX`/`uXXXX[XX]`, and
+	/// the `name.suffix` / `a_b` ligature conventions.
+	static func unicode(forGlyphName name: String) -> String? {
+		if let scalar = glyphNames[name] { return String(Character(Unicode.Scalar(scalar)!)) }
+		if let dot = name.firstIndex(of: "."), dot != name.startIndex {
+			return unicode(forGlyphName: String(name[..<dot]))
+		}
+		if name.contains("_") {
+			let parts = name.split(separator: "_").map { unicode(forGlyphName: String($0)) }
+			return parts.contains(where: { $0 == nil }) ? nil : parts.compactMap { $0 }.joined()
+		}
+		if name.hasPrefix("uni"), name.count >= 7, (name.count - 3) % 4 == 0 {
+			var index = name.index(name.startIndex, offsetBy: 3)
+			var units = [UInt16]()
+			while index < name.endIndex {
+				let next = name.index(index, offsetBy: 4)
+				guard let unit = UInt16(name[index ..< next], radix: 16) else { return nil }
+				units.append(unit)
+				index = next
+			}
+			return String(decoding: units, as: UTF16.self)
+		}
+		if name.hasPrefix("u"), (5 ... 7).contains(name.count),
+		   let value = UInt32(name.dropFirst(), radix: 16), let scalar = Unicode.Scalar(value) {
+			return String(Character(scalar))
+		}
+		if name.count == 1, let scalar = name.unicodeScalars.first, scalar.isASCII {
+			return name
+		}
+		return nil
+	}
+
+	private static let glyphNames: [String: UInt32] = {
+		var names: [String: UInt32] = [:]
+		let ascii = [
+			"space", "exclam", "quotedbl", "numbersign", "dollar", "percent", "ampersand", "quotesingle",
+			"parenleft", "parenright", "asterisk", "plus", "comma", "hyphen", "period", "slash",
+			"zero", "one", "two", "three", "four", "five", "six", "seven", "eight", "nine",
+			"colon", "semicolon", "less", "equal", "greater", "question", "at"
+		]
+		for (offset, name) in ascii.enumerated() { names[name] = UInt32(0x20 + offset) }
+		for (offset, name) in ["bracketleft", "backslash", "bracketright", "asciicircum", "underscore", "grave"].enumerated() {
+			names[name] = UInt32(0x5B + offset)
+		}
+		for (offset, name) in ["braceleft", "bar", "braceright", "asciitilde"].enumerated() {
+			names[name] = UInt32(0x7B + offset)
+		}
+		let latin1 = [
+			"nbspace", "exclamdown", "cent", "sterling", "currency", "yen", "brokenbar", "section",
+			"dieresis", "copyright", "ordfeminine", "guillemotleft", "logicalnot", "sfthyphen", "registered", "macron",
+			"degree", "plusminus", "twosuperior", "threesuperior", "acute", "mu", "paragraph", "periodcentered",
+			"cedilla", "onesuperior", "ordmasculine", "guillemotright", "onequarter", "onehalf", "threequarters", "questiondown",
+			"Agrave", "Aacute", "Acircumflex", "Atilde", "Adieresis", "Aring", "AE", "Ccedilla",
+			"Egrave", "Eacute", "Ecircumflex", "Edieresis", "Igrave", "Iacute", "Icircumflex", "Idieresis",
+			"Eth", "Ntilde", "Ograve", "Oacute", "Ocircumflex", "Otilde", "Odieresis", "multiply",
+			"Oslash", "Ugrave", "Uacute", "Ucircumflex", "Udieresis", "Yacute", "Thorn", "germandbls",
+			"agrave", "aacute", "acircumflex", "atilde", "adieresis", "aring", "ae", "ccedilla",
+			"egrave", "eacute", "ecircumflex", "edieresis", "igrave", "iacute", "icircumflex", "idieresis",
+			"eth", "ntilde", "ograve", "oacute", "ocircumflex", "otilde", "odieresis", "divide",
+			"oslash", "ugrave", "uacute", "ucircumflex", "udieresis", "yacute", "thorn", "ydieresis"
+		]
+		for (offset, name) in latin1.enumerated() { names[name] = UInt32(0xA0 + offset) }
+		let others: [String: UInt32] = [
+			"Euro": 0x20AC, "quotesinglbase": 0x201A, "florin": 0x0192, "quotedblbase": 0x201E,
+			"ellipsis": 0x2026, "dagger": 0x2020, "daggerdbl": 0x2021, "circumflex": 0x02C6,
+			"perthousand": 0x2030, "Scaron": 0x0160, "guilsinglleft": 0x2039, "OE": 0x0152,
+			"Zcaron": 0x017D, "quoteleft": 0x2018, "quoteright": 0x2019, "quotedblleft": 0x201C,
+			"quotedblright": 0x201D, "bullet": 0x2022, "endash": 0x2013, "emdash": 0x2014,
+			"tilde": 0x02DC, "trademark": 0x2122, "scaron": 0x0161, "guilsinglright": 0x203A,
+			"oe": 0x0153, "zcaron": 0x017E, "Ydieresis": 0x0178, "fi": 0xFB01, "fl": 0xFB02,
+			"ff": 0xFB00, "ffi": 0xFB03, "ffl": 0xFB04, "dotlessi": 0x0131, "Lslash": 0x0141,
+			"lslash": 0x0142, "fraction": 0x2044, "minus": 0x2212, "breve": 0x02D8, "caron": 0x02C7,
+			"dotaccent": 0x02D9, "hungarumlaut": 0x02DD, "ogonek": 0x02DB, "ring": 0x02DA,
+			"space.alt": 0x20, "nonbreakingspace": 0xA0, "middot": 0xB7, "Delta": 0x2206,
+			"Omega": 0x03A9, "pi": 0x03C0, "mu1": 0xB5, "notequal": 0x2260, "lessequal": 0x2264,
+			"greaterequal": 0x2265, "infinity": 0x221E, "partialdiff": 0x2202, "summation": 0x2211,
+			"product": 0x220F, "integral": 0x222B, "radical": 0x221A, "approxequal": 0x2248, "lozenge": 0x25CA
+		]
+		names.merge(others) { _, new in new }
+		for code in 0x41 ... 0x5A { names[String(UnicodeScalar(UInt8(code)))] = UInt32(code) }
+		for code in 0x61 ... 0x7A { names[String(UnicodeScalar(UInt8(code)))] = UInt32(code) }
+		return names
+	}()
+
+	// MARK: - Base-14 metrics
+
+	/// Advance widths (1/1000 em) of the base-14 families for printable ASCII,
+	/// used when a simple font omits `/Widths`. Obliques share their upright
+	/// face's widths; Courier is monospaced.
+	static func standardWidth(baseFont: String, unicode: UInt32) -> Double? {
+		let name = baseFont.contains("+") ? String(baseFont.split(separator: "+", maxSplits: 1)[1]) : baseFont
+		let bold = name.contains("Bold")
+		let table: [UInt16]
+		if name.hasPrefix("Courier") {
+			return 600
+		} else if name.hasPrefix("Helvetica") || name.hasPrefix("Arial") {
+			table = bold ? helveticaBold : helvetica
+		} else if name.hasPrefix("Times") {
+			table = bold ? timesBold : times
+		} else {
+			return nil
+		}
+		guard unicode >= 0x20 && unicode < 0x7F else { return Double(table[0x41 - 0x20]) }
+		return Double(table[Int(unicode) - 0x20])
+	}
+
+	private static let helvetica: [UInt16] = [
+		278, 278, 355, 556, 556, 889, 667, 191, 333, 333, 389, 584, 278, 333, 278, 278,
+		556, 556, 556, 556, 556, 556, 556, 556, 556, 556, 278, 278, 584, 584, 584, 556,
+		1015, 667, 667, 722, 722, 667, 611, 778, 722, 278, 500, 667, 556, 833, 722, 778,
+		667, 778, 722, 667, 611, 722, 667, 944, 667, 667, 611, 278, 278, 278, 469, 556,
+		333, 556, 556, 500, 556, 556, 278, 556, 556, 222, 222, 500, 222, 833, 556, 556,
+		556, 556, 333, 500, 278, 556, 500, 722, 500, 500, 500, 334, 260, 334, 584
+	]
+
+	private static let helveticaBold: [UInt16] = [
+		278, 333, 474, 556, 556, 889, 722, 238, 333, 333, 389, 584, 278, 333, 278, 278,
+		556, 556, 556, 556, 556, 556, 556, 556, 556, 556, 333, 333, 584, 584, 584, 611,
+		975, 722, 722, 722, 722, 667, 611, 778, 722, 278, 556, 722, 611, 833, 722, 778,
+		667, 778, 722, 667, 611, 722, 667, 944, 667, 667, 611, 333, 278, 333, 584, 556,
+		333, 556, 611, 556, 611, 556, 333, 611, 611, 278, 278, 556, 278, 889, 611, 611,
+		611, 611, 389, 556, 333, 611, 556, 778, 556, 556, 500, 389, 280, 389, 584
+	]
+
+	private static let times: [UInt16] = [
+		250, 333, 408, 500, 500, 833, 778, 180, 333, 333, 500, 564, 250, 333, 250, 278,
+		500, 500, 500, 500, 500, 500, 500, 500, 500, 500, 278, 278, 564, 564, 564, 444,
+		921, 722, 667, 667, 722, 611, 556, 722, 722, 333, 389, 722, 611, 889, 722, 722,
+		556, 722, 667, 556, 611, 722, 722, 944, 722, 722, 611, 333, 278, 333, 469, 500,
+		333, 444, 500, 444, 500, 444, 333, 500, 500, 278, 278, 500, 278, 778, 500, 500,
+		500, 500, 333, 389, 278, 500, 500, 722, 500, 500, 444, 480, 200, 480, 541
+	]
+
+	private static let timesBold: [UInt16] = [
+		250, 333, 555, 500, 500, 1000, 833, 278, 333, 333, 500, 570, 250, 333, 250, 278,
+		500, 500, 500, 500, 500, 500, 500, 500, 500, 500, 333, 333, 570, 570, 570, 500,
+		930, 722, 667, 722, 722, 667, 611, 778, 778, 389, 500, 778, 667, 944, 722, 778,
+		611, 778, 722, 556, 667, 722, 722, 1000, 722, 722, 667, 333, 278, 333, 581, 500,
+		333, 500, 556, 444, 556, 444, 333, 500, 556, 278, 333, 556, 278, 833, 556, 500,
+		556, 556, 444, 389, 333, 556, 500, 722, 500, 500, 444, 394, 220, 394, 520
+	]
+}
@@ -0,0 +1,265 @@
+//  PDFFilters.swift
+//  SwiftTextPDFReader
+//
+//  Stream decoding (ISO 32000-1 §7.4). Text extraction only ever needs the
+//  general-purpose filters — content streams, object streams, xref streams and
+//  CMaps — so image codecs (DCT, JPX, JBIG2, CCITT) are reported as
+//  unsupported rather than decoded.
+
+import Foundation
+
+enum PDFFilters {
+	enum Error: Swift.Error {
+		case unsupportedFilter(String)
+		/// Decoding produced more than the caller's `limit` bytes.
+		case outputLimitExceeded
+	}
+
+	/// Apply a stream's `/Filter` chain (with its `/DecodeParms`) to its bytes.
+	/// Flate, LZW and RunLength output is capped at `limit` while it decodes; the
+	/// ASCII filters, which at most quadruple their input, are checked after each stage.
+	static func decode(_ stream: PDFStreamValue, limit: Int = .max,
+	                   resolve: (PDFPrimitive) -> PDFPrimitive) throws -> [UInt8] {
+		var data = Array(stream.encoded)
+		let filterValue = stream.dictionary["Filter"].map(resolve)
+		let filters: [String]
+		if let array = filterValue?.array {
+			filters = array.compactMap { resolve($0).name }
+		} else if let name = filterValue?.name {
+			filters = [name]
+		} else {
+			return data
+		}
+		let parmsValue = stream.dictionary["DecodeParms"].map(resolve)
+		let parms: [PDFDictionaryValue?]
+		if let array = parmsValue?.array {
+			parms = array.map { resolve($0).dictionary }
+		} else {
+			parms = [parmsValue?.dictionary]
+		}
+
+		for (index, filter) in filters.enumerated() {
+			let parameters = index < parms.count ? parms[index] : nil
+			switch filter {
+			case "FlateDecode", "Fl":
+				do {
+					data = try Inflate.zlib(data, limit: limit)
+				} catch Inflate.Error.outputLimitExceeded {
+					throw Error.outputLimitExceeded
+				}
+				data = applyPredictor(data, parameters: parameters)
+			case "LZWDecode", "LZW":
+				let early = parameters?["EarlyChange"]?.integer ?? 1
+				data = try lzw(data, earlyChange: early != 0, limit: limit)
+				data = applyPredictor(data, parameters: parameters)
+			case "ASCIIHexDecode", "AHx":
+				data = asciiHex(data)
+			case "ASCII85Decode", "A85":
+				data = ascii85(data)
+			case "RunLengthDecode", "RL":
+				data = try runLength(data, limit: limit)
+			default:
+				throw Error.unsupportedFilter(filter)
+			}
+			guard data.count <= limit else { throw Error.outputLimitExceeded }
+		}
+		return data
+	}
+
+	// MARK: - Predictors
+
+	/// Undo a PNG (10–15) or TIFF (2) predictor, as used by xref streams.
+	static func applyPredictor(_ data: [UInt8], parameters: PDFDictionaryValue?) -> [UInt8] {
+		guard let parameters, let predictor = parameters["Predictor"]?.integer, predictor > 1 else { return data }
+		let colors = max(1, parameters["Colors"]?.integer ?? 1)
+		let bitsPerComponent = max(1, parameters["BitsPerComponent"]?.integer ?? 8)
+		let columns = max(1, parameters["Columns"]?.integer ?? 1)
+		// Hostile parameters mustn't overflow, and no row is longer than the input.
+		let (pixelBits, pixelOverflow) = colors.multipliedReportingOverflow(by: bitsPerComponent)
+		let (rowBits, rowOverflow) = columns.multipliedReportingOverflow(by: pixelBits)
+		guard !pixelOverflow, !rowOverflow else { return data }
+		let rowLength = min(rowBits / 8 + (rowBits % 8 == 0 ? 0 : 1), max(1, data.count))
+		let bytesPerPixel = min(max(1, pixelBits / 8), rowLength)
+
+		if predictor == 2 {
+			guard bitsPerComponent == 8 else { return data }
+			var output = data
+			var rowStart = 0
+			while rowStart < output.count {
+				let rowEnd = min(rowStart + rowLength, output.count)
+				var index = rowStart + bytesPerPixel
+				while index < rowEnd {
+					output[index] = output[index] &+ output[index - bytesPerPixel]
+					index += 1
+				}
+				rowStart = rowEnd
+			}
+			return output
+		}
+
+		var output = [UInt8]()
+		output.reserveCapacity(data.count)
+		var previous = [UInt8](repeating: 0, count: rowLength)
+		var row = [UInt8](repeating: 0, count: rowLength)
+		var position = 0
+		while position < data.count {
+			let type = data[position]
+			position += 1
+			let available = min(rowLength, data.count - position)
+			for index in 0 ..< rowLength { row[index] = index < available ? data[position + index] : 0 }
+			position += available
+			for index in 0 ..< rowLength {
+				let left = index >= bytesPerPixel ? row[index - bytesPerPixel] : 0
+				let up = previous[index]
+				let upLeft = index >= bytesPerPixel ? previous[index - bytesPerPixel] : 0
+				switch type {
+				case 1: row[index] = row[index] &+ left
+				case 2: row[index] = row[index] &+ up
+				case 3: row[index] = row[index] &+ UInt8((Int(left) + Int(up)) / 2)
+				case 4:
+					let estimate = Int(left) + Int(up) - Int(upLeft)
+					let distanceLeft = abs(estimate - Int(left))
+					let distanceUp = abs(estimate - Int(up))
+					let distanceUpLeft = abs(estimate - Int(upLeft))
+					let predicted: UInt8
+					if distanceLeft <= distanceUp && distanceLeft <= distanceUpLeft {
+						predicted = left
+					} else if distanceUp <= distanceUpLeft {
+						predicted = up
+					} else {
+						predicted = upLeft
+					}
+					row[index] = row[index] &+ predicted
+				default:
+					break
+				}
+			}
+			output.append(contentsOf: row)
+			swap(&previous, &row)
+		}
+		return output
+	}
+
+	// MARK: - Simple filters
+
+	static func asciiHex(_ data: [UInt8]) -> [UInt8] {
+		var output = [UInt8]()
+		output.reserveCapacity(data.count / 2)
+		var pending: UInt8?
+		for byte in data {
+			if byte == 0x3E { break } // > ends the data
+			guard let nibble = PDFLexer.hexValue(byte) else { continue }
+			if let high = pending {
+				output.append(high << 4 | nibble)
+				pending = nil
+			} else {
+				pending = nibble
+			}
+		}
+		if let high = pending { output.append(high << 4) }
+		return output
+	}
+
+	static func ascii85(_ data: [UInt8]) -> [UInt8] {
+		var output = [UInt8]()
+		output.reserveCapacity(data.count * 4 / 5)
+		var group = [UInt32]()
+		var index = 0
+		if data.starts(with: [0x3C, 0x7E]) { index = 2 } // optional <~ prefix
+		func flush(_ count: Int) {
+			var value: UInt32 = 0
+			for digit in group + Array(repeating: 84, count: 5 - group.count) {
+				value = value &* 85 &+ digit
+			}
+			let bytes = [UInt8(value >> 24), UInt8(value >> 16 & 0xFF), UInt8(value >> 8 & 0xFF), UInt8(value & 0xFF)]
+			output.append(contentsOf: bytes[0 ..< count])
+			group.removeAll(keepingCapacity: true)
+		}
+		while index < data.count {
+			let byte = data[index]
+			index += 1
+			if byte == 0x7E { break } // ~> ends the data
+			if byte == 0x7A && group.isEmpty { // z = four zero bytes
+				output.append(contentsOf: [0, 0, 0, 0])
+				continue
+			}
+			guard byte >= 0x21 && byte <= 0x75 else { continue }
+			group.append(UInt32(byte - 0x21))
+			if group.count == 5 { flush(4) }
+		}
+		if group.count > 1 { flush(group.count - 1) }
+		return output
+	}
+
+	static func runLength(_ data: [UInt8], limit: Int = .max) throws -> [UInt8] {
+		var output = [UInt8]()
+		var index = 0
+		while index < data.count {
+			let length = Int(data[index])
+			index += 1
+			if length == 128 { break }
+			if length < 128 {
+				let count = min(length + 1, data.count - index)
+				output.append(contentsOf: data[index ..< index + count])
+				index += count
+			} else if index < data.count {
+				output.append(contentsOf: repeatElement(data[index], count: 257 - length))
+				index += 1
+			}
+			guard output.count <= limit else { throw Error.outputLimitExceeded }
+		}
+		return output
+	}
+
+	static func lzw(_ data: [UInt8], earlyChange: Bool, limit: Int = .max) throws -> [UInt8] {
+		var output = [UInt8]()
+		var table = [[UInt8]]()
+		func resetTable() {
+			table = (0 ..< 256).map { [UInt8($0)] }
+			table.append([]) // 256: clear
+			table.append([]) // 257: end of data
+		}
+		resetTable()
+		var codeLength = 9
+		var buffer = 0, bitCount = 0
+		var previous: [UInt8]?
+		var index = 0
+		while true {
+			while bitCount < codeLength && index < data.count {
+				buffer = buffer << 8 | Int(data[index])
+				index += 1
+				bitCount += 8
+			}
+			guard bitCount >= codeLength else { break }
+			let code = (buffer >> (bitCount - codeLength)) & ((1 << codeLength) - 1)
+			bitCount -= codeLength
+			buffer &= (1 << bitCount) - 1
+
+			if code == 256 {
+				resetTable()
+				codeLength = 9
+				previous = nil
+				continue
+			}
+			if code == 257 { break }
+
+			let entry: [UInt8]
+			if code < table.count {
+				entry = table[code]
+				if let previous { table.append(previous + [entry[0]]) }
+			} else if let previous {
+				entry = previous + [previous[0]]
+				table.append(entry)
+			} else {
+				break
+			}
+			output.append(contentsOf: entry)
+			guard output.count <= limit else { throw Error.outputLimitExceeded }
+			previous = entry
+
+			let threshold = table.count + (earlyChange ? 1 : 0)
+			if threshold >= 1 << codeLength && codeLength < 12 { codeLength += 1 }
+		}
+		return output
+	}
+}
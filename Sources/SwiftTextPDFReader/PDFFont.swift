@@ -0,0 +1,231 @@
+//  PDFFont.swift
+//  SwiftTextPDFReader
+//
+//  A font as far as text extraction needs one: how to split a shown string into
+//  character codes, what Unicode text each code stands for, and how far each
+//  glyph advances the text position.
+
+import Foundation
+
+struct PDFFont: Sendable {
+	/// One decoded character code of a shown string.
+	struct Glyph {
+		/// The Unicode text; empty when the font gives no way to recover it.
+		var text: String
+		/// Horizontal advance in thousandths of text space units.
+		var width: Double
+		/// A single-byte code 32, which word spacing (`Tw`) applies to.
+		var isWordSpace: Bool
+	}
+
+	private enum Codes: Sendable {
+		/// One byte per code, mapped through a 256-entry encoding.
+		case simple(encoding: [String?], widths: [Double])
+		/// Multi-byte codes split by a CMap and mapped to CIDs for widths.
+		case composite(cmap: PDFCMap?, identity: Bool, unicodeCodes: Bool, widths: [Int: Double], defaultWidth: Double)
+	}
+
+	private let codes: Codes
+	private let toUnicode: PDFCMap?
+
+	/// Ascent and descent in thousandths of text space units.
+	let ascent: Double
+	let descent: Double
+
+	init(_ dictionary: PDFDictionaryValue, store: PDFObjectStore) {
+		let subtype = store.value("Subtype", in: dictionary)?.name ?? "Type1"
+		let baseFont = store.value("BaseFont", in: dictionary)?.name ?? ""
+
+		if let stream = store.value("ToUnicode", in: dictionary)?.stream, let data = try? store.decodedData(stream) {
+			toUnicode = PDFCMap(data)
+		} else {
+			toUnicode = nil
+		}
+
+		var descriptor = store.value("FontDescriptor", in: dictionary)?.dictionary
+		if subtype == "Type0" {
+			let descendant = (store.value("DescendantFonts", in: dictionary)?.array?.first).flatMap { store.resolve($0).dictionary }
+			if let descendant {
+				descriptor = store.value("FontDescriptor", in: descendant)?.dictionary
+			}
+			codes = Self.compositeCodes(dictionary, descendant: descendant, store: store)
+		} else {
+			codes = Self.simpleCodes(dictionary, subtype: subtype, baseFont: baseFont, descriptor: descriptor, store: store)
+		}
+
+		// Type 3 descriptors are in glyph space, and many producers write 0 for
+		// both metrics; either way typical Latin proportions are the better guess.
+		let usesDescriptor = subtype != "Type3"
+		let ascent = descriptor.flatMap { store.value("Ascent", in: $0)?.number } ?? 0
+		let descent = descriptor.flatMap { store.value("Descent", in: $0)?.number } ?? 0
+		self.ascent = usesDescriptor && ascent > 0 ? ascent : 750
+		self.descent = usesDescriptor && descent < 0 ? descent : -250
+	}
+
+	// MARK: - Decoding
+
+	func glyphs(_ bytes: [UInt8]) -> [Glyph] {
+		var glyphs = [Glyph]()
+		switch codes {
+		case .simple(let encoding, let widths):
+			glyphs.reserveCapacity(bytes.count)
+			for byte in bytes {
+				let code = UInt32(byte)
+				let text = toUnicode?.unicode[code] ?? encoding[Int(byte)] ?? ""
+				glyphs.append(Glyph(text: text, width: widths[Int(byte)], isWordSpace: byte == 0x20))
+			}
+		case .composite(let cmap, let identity, let unicodeCodes, let widths, let defaultWidth):
+			glyphs.reserveCapacity(bytes.count / 2)
+			var offset = 0
+			while offset < bytes.count {
+				let length = max(1, cmap?.codeLength(in: bytes, at: offset) ?? min(2, bytes.count - offset))
+				let code = PDFCMap.code(Array(bytes[offset ..< min(offset + length, bytes.count)]))
+				offset += length
+				let cid = identity ? Int(code) : (cmap?.cid(for: code) ?? Int(code))
+				var text = toUnicode?.unicode[code] ?? ""
+				if text.isEmpty, unicodeCodes, let scalar = Unicode.Scalar(code) {
+					text = String(Character(scalar))
+				}
+				glyphs.append(Glyph(text: text, width: widths[cid] ?? defaultWidth, isWordSpace: length == 1 && code == 0x20))
+			}
+		}
+		return glyphs
+	}
+
+	// MARK: - Simple fonts
+
+	private static func simpleCodes(_ dictionary: PDFDictionaryValue, subtype: String, baseFont: String,
+	                                descriptor: PDFDictionaryValue?, store: PDFObjectStore) -> Codes {
+		var table = subtype == "TrueType" ? PDFEncodings.winAnsi : PDFEncodings.standard
+		var differences: [PDFPrimitive] = []
+		switch store.value("Encoding", in: dictionary) {
+		case .name(let name)?:
+			table = PDFEncodings.table(named: name) ?? table
+		case .dictionary(let encoding)?:
+			if let base = store.value("BaseEncoding", in: encoding)?.name {
+				table = PDFEncodings.table(named: base) ?? table
+			}
+			differences = store.value("Differences", in: encoding)?.array ?? []
+		default:
+			break
+		}
+
+		var encoding: [String?] = table.map { $0 == 0 ? nil : String(Character(Unicode.Scalar($0)!)) }
+		var code = 0
+		for entry in differences {
+			switch store.resolve(entry) {
+			case .integer(let start):
+				code = start
+			case .name(let glyph):
+				if (0 ..< 256).contains(code) { encoding[code] = PDFEncodings.unicode(forGlyphName: glyph) }
+				code += 1
+			default:
+				break
+			}
+		}
+
+		let missing = descriptor.flatMap { store.value("MissingWidth", in: $0)?.number }
+		var scale = 1.0
+		if subtype == "Type3", let matrix = store.value("FontMatrix", in: dictionary)?.array?.compactMap({ store.resolve($0).number }),
+		   matrix.count == 6 {
+			scale = matrix[0] * 1000
+		}
+		var widths = [Double](repeating: 0, count: 256)
+		let firstChar = store.value("FirstChar", in: dictionary)?.integer ?? 0
+		let declared = store.value("Widths", in: dictionary)?.array?.map { store.resolve($0).number ?? 0 } ?? []
+		for code in 0 ..< 256 {
+			let index = code - firstChar
+			if index >= 0 && index < declared.count {
+				widths[code] = declared[index] * scale
+			} else if let missing, !declared.isEmpty {
+				widths[code] = missing
+			} else {
+				let scalar = encoding[code]?.unicodeScalars.first?.value ?? UInt32(code)
+				widths[code] = PDFEncodings.standardWidth(baseFont: baseFont, unicode: scalar) ?? missing ?? 500
+			}
+		}
+		return .simple(encoding: encoding, widths: widths)
+	}
+
+	// MARK: - Composite fonts
+
+	private static func compositeCodes(_ dictionary: PDFDictionaryValue, descendant: PDFDictionaryValue?,
+	                                   store: PDFObjectStore) -> Codes {
+		var cmap: PDFCMap?
+		var identity = false
+		var unicodeCodes = false
+		switch store.value("Encoding", in: dictionary) {
+		case .name(let name)?:
+			identity = name.hasPrefix("Identity")
+			// Predefined Unicode CMaps (UniJIS-UCS2-H, UniGB-UTF16-H, …) use the
+			// Unicode value itself as the character code.
+			unicodeCodes = name.hasPrefix("Uni") && (name.contains("UCS2") || name.contains("UTF16"))
+		case .stream(let stream)?:
+			if let data = try? store.decodedData(stream) {
+				let parsed = PDFCMap(data)
+				cmap = parsed
+				identity = parsed.cidRanges.isEmpty && parsed.cids.isEmpty
+			}
+		default:
+			identity = true
+		}
+
+		var widths = [Int: Double]()
+		var defaultWidth = 1000.0
+		if let descendant {
+			defaultWidth = store.value("DW", in: descendant)?.number ?? 1000
+			let entries = (store.value("W", in: descendant)?.array ?? []).map { store.resolve($0) }
+			var index = 0
+			while index < entries.count {
+				guard let first = entries[index].integer else { index += 1; continue }
+				if index + 1 < entries.count, let list = entries[index + 1].array {
+					for (offset, width) in list.enumerated() {
+						let (cid, overflow) = first.addingReportingOverflow(offset)
+						guard !overflow else { break }
+						if let width = store.resolve(width).number { widths[cid] = width }
+					}
+					index += 2
+				} else if index + 2 < entries.count, let last = entries[index + 1].integer, let width = entries[index + 2].number {
+					let (span, overflow) = last.subtractingReportingOverflow(first)
+					if !overflow && span >= 0 && span < 0x10000 {
+						for cid in first ... last { widths[cid] = width }
+					}
+					index += 3
+				} else {
+					break
+				}
+			}
+		}
+		return .composite(cmap: cmap, identity: identity, unicodeCodes: unicodeCodes, widths: widths, defaultWidth: defaultWidth)
+	}
+}
+
+/// Fonts parsed once per document and shared by every page that uses them.
+final class PDFFontCache: @unchecked Sendable {
+	private let store: PDFObjectStore
+	private let lock = NSLock()
+	private var fonts: [Int: PDFFont] = [:]
+
+	init(store: PDFObjectStore) {
+		self.store = store
+	}
+
+	/// The font for a `/Font` resource entry, parsing it on first use.
+	func font(for value: PDFPrimitive) -> PDFFont? {
+		guard let number = value.referenceNumber else {
+			return store.resolve(value).dictionary.map { PDFFont($0, store: store) }
+		}
+		lock.lock()
+		let cached = fonts[number]
+		lock.unlock()
+		if let cached { return cached }
+		guard let dictionary = store.resolve(value).dictionary else { return nil }
+		// Parsing happens outside the lock; two pages racing on the same font
+		// both parse it and the second result simply wins.
+		let font = PDFFont(dictionary, store: store)
+		lock.lock()
+		fonts[number] = font
+		lock.unlock()
+		return font
+	}
+}
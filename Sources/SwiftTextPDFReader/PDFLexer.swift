@@ -0,0 +1,342 @@
+//  PDFLexer.swift
+//  SwiftTextPDFReader
+//
+//  Tokenizer and object parser for PDF syntax (ISO 32000-1 §7.2–7.3). The same
+//  scanner reads the file body, object streams, content streams and CMaps: the
+//  only difference is whether `n g R` is recognized as a reference.
+
+import Foundation
+
+struct PDFLexer {
+	enum Token {
+		case value(PDFPrimitive)
+		case keyword(String)
+		case arrayStart, arrayEnd, dictionaryStart, dictionaryEnd
+		case end
+	}
+
+	/// Arrays and dictionaries nested deeper than this parse as `nil`, so a run
+	/// of `[` in hostile input can't exhaust the stack.
+	static let maximumNesting = 256
+
+	let bytes: [UInt8]
+	var position: Int
+	let end: Int
+
+	init(_ bytes: [UInt8], from start: Int = 0, to end: Int? = nil) {
+		self.bytes = bytes
+		self.position = start
+		self.end = min(end ?? bytes.count, bytes.count)
+	}
+
+	var isAtEnd: Bool { position >= end }
+
+	// MARK: - Character classes
+
+	@inline(__always)
+	static func isWhitespace(_ byte: UInt8) -> Bool {
+		byte == 0x20 || byte == 0x0A || byte == 0x0D || byte == 0x09 || byte == 0x0C || byte == 0x00
+	}
+
+	@inline(__always)
+	static func isDelimiter(_ byte: UInt8) -> Bool {
+		switch byte {
+		case 0x28, 0x29, 0x3C, 0x3E, 0x5B, 0x5D, 0x7B, 0x7D, 0x2F, 0x25: return true // ( ) < > [ ] { } / %
+		default: return false
+		}
+	}
+
+	@inline(__always)
+	static func isRegular(_ byte: UInt8) -> Bool {
+		!isWhitespace(byte) && !isDelimiter(byte)
+	}
+
+	mutating func skipWhitespaceAndComments() {
+		while position < end {
+			let byte = bytes[position]
+			if Self.isWhitespace(byte) {
+				position += 1
+			} else if byte == 0x25 { // % comment runs to end of line
+				while position < end && bytes[position] != 0x0A && bytes[position] != 0x0D { position += 1 }
+			} else {
+				return
+			}
+		}
+	}
+
+	// MARK: - Tokens
+
+	mutating func nextToken() -> Token {
+		skipWhitespaceAndComments()
+		// PostScript braces and stray ')' carry no text.
+		while position < end, bytes[position] == 0x7B || bytes[position] == 0x7D || bytes[position] == 0x29 {
+			position += 1
+			skipWhitespaceAndComments()
+		}
+		guard position < end else { return .end }
+		let byte = bytes[position]
+		switch byte {
+		case 0x2F: // /
+			position += 1
+			return .value(.name(readName()))
+		case 0x28: // (
+			position += 1
+			return .value(.string(readLiteralString()))
+		case 0x3C: // <
+			if position + 1 < end && bytes[position + 1] == 0x3C {
+				position += 2
+				return .dictionaryStart
+			}
+			position += 1
+			return .value(.string(readHexString()))
+		case 0x3E: // >
+			position += (position + 1 < end && bytes[position + 1] == 0x3E) ? 2 : 1
+			return .dictionaryEnd
+		case 0x5B:
+			position += 1
+			return .arrayStart
+		case 0x5D:
+			position += 1
+			return .arrayEnd
+		case 0x2B, 0x2D, 0x2E, 0x30 ... 0x39: // + - . digits
+			if let number = readNumber() { return .value(number) }
+			return .keyword(readKeyword())
+		default:
+			let keyword = readKeyword()
+			switch keyword {
+			case "true": return .value(.bool(true))
+			case "false": return .value(.bool(false))
+			case "null": return .value(.null)
+			case "ID":
+				skipInlineImageData()
+				return .keyword("EI")
+			default: return .keyword(keyword)
+			}
+		}
+	}
+
+	private mutating func readKeyword() -> String {
+		let start = position
+		while position < end && Self.isRegular(bytes[position]) { position += 1 }
+		if position == start { position += 1 } // a lone unexpected delimiter
+		return String(decoding: bytes[start ..< position], as: UTF8.self)
+	}
+
+	private mutating func readName() -> String {
+		var name = [UInt8]()
+		while position < end {
+			let byte = bytes[position]
+			guard Self.isRegular(byte) else { break }
+			if byte == 0x23, position + 2 < end, let high = Self.hexValue(bytes[position + 1]), let low = Self.hexValue(bytes[position + 2]) {
+				name.append(high << 4 | low)
+				position += 3
+			} else {
+				name.append(byte)
+				position += 1
+			}
+		}
+		return String(decoding: name, as: UTF8.self)
+	}
+
+	private mutating func readNumber() -> PDFPrimitive? {
+		let start = position
+		var negative = false
+		if bytes[position] == 0x2B || bytes[position] == 0x2D {
+			negative = bytes[position] == 0x2D
+			position += 1
+			// Producers occasionally write "--5"; tolerate repeated signs.
+			while position < end && (bytes[position] == 0x2D || bytes[position] == 0x2B) { position += 1 }
+		}
+		// An integer too large for `Int` is no number at all (it lexes as a
+		// keyword), so a hostile `/Length` or offset can't wrap into range.
+		var integer = 0
+		var overflowed = false
+		var magnitude = 0.0
+		var digits = 0
+		while position < end, bytes[position] >= 0x30, bytes[position] <= 0x39 {
+			let digit = Int(bytes[position] - 0x30)
+			let (shifted, multiplyOverflow) = integer.multipliedReportingOverflow(by: 10)
+			let (sum, addOverflow) = shifted.addingReportingOverflow(digit)
+			overflowed = overflowed || multiplyOverflow || addOverflow
+			integer = sum
+			magnitude = magnitude * 10 + Double(digit)
+			position += 1
+			digits += 1
+		}
+		guard position < end, bytes[position] == 0x2E else {
+			if digits == 0 || overflowed {
+				position = start
+				return nil
+			}
+			return .integer(negative ? -integer : integer)
+		}
+		position += 1
+		var fraction = 0.0, scale = 0.1
+		while position < end, bytes[position] >= 0x30, bytes[position] <= 0x39 {
+			fraction += Double(bytes[position] - 0x30) * scale
+			scale *= 0.1
+			position += 1
+			digits += 1
+		}
+		guard digits > 0 else {
+			position = start
+			return nil
+		}
+		let value = magnitude + fraction
+		return .real(negative ? -value : value)
+	}
+
+	private mutating func readLiteralString() -> [UInt8] {
+		var result = [UInt8]()
+		var depth = 1
+		while position < end {
+			let byte = bytes[position]
+			position += 1
+			switch byte {
+			case 0x28:
+				depth += 1
+				result.append(byte)
+			case 0x29:
+				depth -= 1
+				if depth == 0 { return result }
+				result.append(byte)
+			case 0x5C: // backslash escape
+				guard position < end else { return result }
+				let escaped = bytes[position]
+				position += 1
+				switch escaped {
+				case 0x6E: result.append(0x0A) // \n
+				case 0x72: result.append(0x0D) // \r
+				case 0x74: result.append(0x09) // \t
+				case 0x62: result.append(0x08) // \b
+				case 0x66: result.append(0x0C) // \f
+				case 0x0D: // line continuation
+					if position < end && bytes[position] == 0x0A { position += 1 }
+				case 0x0A:
+					break
+				case 0x30 ... 0x37: // up to three octal digits
+					var value = Int(escaped - 0x30)
+					var count = 1
+					while count < 3, position < end, bytes[position] >= 0x30, bytes[position] <= 0x37 {
+						value = value * 8 + Int(bytes[position] - 0x30)
+						position += 1
+						count += 1
+					}
+					result.append(UInt8(value & 0xFF))
+				default:
+					result.append(escaped) // \( \) \\ and unknown escapes
+				}
+			default:
+				result.append(byte)
+			}
+		}
+		return result
+	}
+
+	private mutating func readHexString() -> [UInt8] {
+		var result = [UInt8]()
+		var pending: UInt8?
+		while position < end {
+			let byte = bytes[position]
+			position += 1
+			if byte == 0x3E { break }
+			guard let nibble = Self.hexValue(byte) else { continue }
+			if let high = pending {
+				result.append(high << 4 | nibble)
+				pending = nil
+			} else {
+				pending = nibble
+			}
+		}
+		if let high = pending { result.append(high << 4) }
+		return result
+	}
+
+	/// After an inline image's `ID`, skip its binary data through the closing `EI`.
+	private mutating func skipInlineImageData() {
+		position += 1 // the single whitespace byte after ID
+		while position + 1 < end {
+			if bytes[position] == 0x45 && bytes[position + 1] == 0x49, // "EI"
+			   position == 0 || Self.isWhitespace(bytes[position - 1]),
+			   position + 2 >= end || !Self.isRegular(bytes[position + 2]) {
+				position += 2
+				return
+			}
+			position += 1
+		}
+		position = end
+	}
+
+	@inline(__always)
+	static func hexValue(_ byte: UInt8) -> UInt8? {
+		switch byte {
+		case 0x30 ... 0x39: return byte - 0x30
+		case 0x41 ... 0x46: return byte - 0x41 + 10
+		case 0x61 ... 0x66: return byte - 0x61 + 10
+		default: return nil
+		}
+	}
+
+	// MARK: - Objects
+
+	/// Parse one complete object. With `references`, `n g R` becomes a
+	/// ``PDFPrimitive/reference(number:generation:)``; content streams have none.
+	mutating func readObject(references: Bool = true) -> PDFPrimitive? {
+		object(startingWith: nextToken(), references: references)
+	}
+
+	mutating func object(startingWith token: Token, references: Bool = true, depth: Int = 0) -> PDFPrimitive? {
+		switch token {
+		case .value(.integer(let number)) where references:
+			let saved = position
+			if case .value(.integer(let generation)) = nextToken(), case .keyword("R") = nextToken() {
+				return .reference(number: number, generation: generation)
+			}
+			position = saved
+			return .integer(number)
+		case .value(let value):
+			return value
+		case .arrayStart:
+			guard depth < Self.maximumNesting else { return nil }
+			var items = [PDFPrimitive]()
+			while true {
+				let next = nextToken()
+				switch next {
+				case .arrayEnd, .end: return .array(items)
+				case .keyword: continue // stray operator inside an array
+				default:
+					if let item = object(startingWith: next, references: references, depth: depth + 1) { items.append(item) }
+				}
+			}
+		case .dictionaryStart:
+			guard depth < Self.maximumNesting else { return nil }
+			var entries = [String: PDFPrimitive]()
+			while true {
+				let next = nextToken()
+				switch next {
+				case .dictionaryEnd, .end:
+					return .dictionary(PDFDictionaryValue(entries))
+				case .value(.name(let key)):
+					let valueToken = nextToken()
+					if case .dictionaryEnd = valueToken { return .dictionary(PDFDictionaryValue(entries)) }
+					if let value = object(startingWith: valueToken, references: references, depth: depth + 1) {
+						if case .null = value { continue }
+						entries[key] = value
+					}
+				default:
+					continue
+				}
+			}
+		default:
+			return nil
+		}
+	}
+
+	/// Whether the bytes at `offset` spell `keyword` followed by a non-regular byte.
+	func matches(_ keyword: String, at offset: Int) -> Bool {
+		let utf8 = Array(keyword.utf8)
+		guard offset >= 0, offset + utf8.count <= end else { return false }
+		for (index, byte) in utf8.enumerated() where bytes[offset + index] != byte { return false }
+		return offset + utf8.count == end || !Self.isRegular(bytes[offset + utf8.count])
+	}
+}
@@ -0,0 +1,435 @@
+//  PDFObjectStore.swift
+//  SwiftTextPDFReader
+//
+//  The file layer: locates objects through the cross-reference data — classic
+//  `xref` tables, PDF 1.5 cross-reference streams and hybrid files, following
+//  `/Prev` through incremental updates — and resolves indirect references,
+//  including objects packed into object streams (`/Type /ObjStm`).
+//
+//  Damaged files are common, so when the xref is missing or points at the
+//  wrong bytes the store rebuilds it by scanning for `n g obj` headers, the
+//  same recovery every viewer performs.
+
+import Foundation
+import SwiftTextCore
+
+final class PDFObjectStore: @unchecked Sendable {
+	private enum Location {
+		case offset(Int)
+		case compressed(stream: Int, index: Int)
+	}
+
+	let bytes: [UInt8]
+	/// Every stream decoded through the store is charged here.
+	let budget: ResourceBudget
+	private(set) var trailer = PDFDictionaryValue()
+	private var locations: [Int: Location] = [:]
+
+	private enum RebuildState {
+		case notStarted, running, finished
+	}
+
+	// Resolved objects and decoded object streams are cached for the pages
+	// extracted concurrently; the lock guards both caches, the objects each
+	// thread is resolving, and the rebuild state other threads wait on.
+	private let lock = NSCondition()
+	private var objectCache: [Int: PDFPrimitive] = [:]
+	private var objectStreamCache: [Int: [Int: PDFPrimitive]] = [:]
+	/// Object numbers being resolved, per thread. A number that comes back in
+	/// on the same thread is a cycle — an object stream holding itself, or a
+	/// `/Length` pointing at its own stream — and resolves to `nil`.
+	private var resolving: [ObjectIdentifier: Set<Int>] = [:]
+	private var rebuildState = RebuildState.notStarted
+
+	init(_ bytes: [UInt8], budget: ResourceBudget) throws {
+		self.bytes = bytes
+		self.budget = budget
+		guard Self.headerOffset(in: bytes) != nil else { throw PDFReaderError.notAPDF }
+		if !loadCrossReferences() || trailer["Root"] == nil {
+			rebuildCrossReferences()
+		}
+		guard trailer["Root"] != nil else { throw PDFReaderError.malformed("no document catalog") }
+		if trailer["Encrypt"] != nil { throw PDFReaderError.encrypted }
+	}
+
+	/// `%PDF-` must appear within the first KiB (some files carry a preamble).
+	private static func headerOffset(in bytes: [UInt8]) -> Int? {
+		let signature: [UInt8] = [0x25, 0x50, 0x44, 0x46, 0x2D]
+		let limit = min(bytes.count, 1024) - signature.count
+		guard limit >= 0 else { return nil }
+		for offset in 0 ... limit where bytes[offset] == 0x25 && Array(bytes[offset ..< offset + 5]) == signature {
+			return offset
+		}
+		return nil
+	}
+
+	// MARK: - Resolution
+
+	/// Follow references until a direct object is reached.
+	func resolve(_ value: PDFPrimitive) -> PDFPrimitive {
+		var current = value
+		var hops = 0
+		while case .reference(let number, _) = current, hops < 32 {
+			current = object(number) ?? .null
+			hops += 1
+		}
+		return current
+	}
+
+	func resolve(_ value: PDFPrimitive?) -> PDFPrimitive? {
+		value.map { resolve($0) }
+	}
+
+	/// A dictionary entry, with references resolved.
+	func value(_ key: String, in dictionary: PDFDictionaryValue) -> PDFPrimitive? {
+		dictionary[key].map { resolve($0) }
+	}
+
+	/// The object with the given number, or `nil` when it doesn't exist or
+	/// its definition refers back to itself.
+	func object(_ number: Int) -> PDFPrimitive? {
+		let thread = ObjectIdentifier(Thread.current)
+		lock.lock()
+		while rebuildState == .running { lock.wait() }
+		if let cached = objectCache[number] {
+			lock.unlock()
+			return cached
+		}
+		guard resolving[thread, default: []].insert(number).inserted else {
+			lock.unlock()
+			return nil
+		}
+		let location = locations[number]
+		let rebuilt = rebuildState == .finished
+		lock.unlock()
+
+		var resolved: PDFPrimitive?
+		switch location {
+		case .offset(let offset):
+			resolved = parseIndirectObject(at: offset, expecting: number)
+		case .compressed(let stream, let index):
+			resolved = compressedObject(number, in: stream, index: index)
+		case nil:
+			resolved = nil
+		}
+
+		lock.lock()
+		resolving[thread]?.remove(number)
+		if resolving[thread]?.isEmpty == true { resolving[thread] = nil }
+		if let resolved { objectCache[number] = resolved }
+		lock.unlock()
+
+		// A wrong xref offset triggers the one rebuild; retry against the new table.
+		if resolved == nil, case .offset = location, !rebuilt {
+			rebuildCrossReferences()
+			return object(number)
+		}
+		return resolved
+	}
+
+	/// Decode a stream's payload through its filters and charge it to `budget`,
+	/// stopping as soon as the output passes what the budget has left.
+	/// - Throws: `ResourceLimitError` past the budget; a `PDFFilters.Error` otherwise.
+	func decodedData(_ stream: PDFStreamValue) throws -> [UInt8] {
+		let data: [UInt8]
+		do {
+			data = try PDFFilters.decode(stream, limit: budget.remaining(.decompressedBytes)) { resolve($0) }
+		} catch PDFFilters.Error.outputLimitExceeded {
+			// Use up the allowance, so callers that swallow decode errors (fonts,
+			// object streams) still leave the next charge to throw.
+			let remaining = budget.remaining(.decompressedBytes)
+			try budget.charge(.decompressedBytes, remaining == .max ? remaining : remaining + 1)
+			throw ResourceLimitError.limitExceeded(.decompressedBytes, limit: budget.limits.maxDecompressedBytes ?? .max)
+		}
+		try budget.charge(.decompressedBytes, data.count)
+		return data
+	}
+
+	// MARK: - Parsing objects
+
+	/// Parse `n g obj … endobj` at `offset`; with `expecting`, only if it is that object.
+	private func parseIndirectObject(at offset: Int, expecting number: Int?) -> PDFPrimitive? {
+		guard offset >= 0 && offset < bytes.count else { return nil }
+		var lexer = PDFLexer(bytes, from: offset)
+		guard case .value(.integer(let parsedNumber)) = lexer.nextToken(),
+		      case .value(.integer) = lexer.nextToken(),
+		      case .keyword("obj") = lexer.nextToken() else { return nil }
+		if let number, parsedNumber != number { return nil }
+		guard let value = lexer.readObject() else { return nil }
+		guard case .dictionary(let dictionary) = value else { return value }
+		return streamFollowing(dictionary, lexer: &lexer) ?? value
+	}
+
+	/// If `stream` follows the dictionary just parsed, the stream object.
+	private func streamFollowing(_ dictionary: PDFDictionaryValue, lexer: inout PDFLexer) -> PDFPrimitive? {
+		let saved = lexer.position
+		guard case .keyword("stream") = lexer.nextToken() else {
+			lexer.position = saved
+			return nil
+		}
+		// The keyword is followed by CRLF or LF (a lone CR is tolerated).
+		var start = lexer.position
+		if start < bytes.count && bytes[start] == 0x0D { start += 1 }
+		if start < bytes.count && bytes[start] == 0x0A { start += 1 }
+
+		// Trust /Length only when `endstream` really follows it; otherwise scan.
+		var length = -1
+		if let declared = dictionary["Length"] {
+			if case .integer(let direct) = declared {
+				length = direct
+			} else if case .reference(let number, _) = declared, let value = object(number)?.integer {
+				length = value
+			}
+		}
+		if length >= 0, length <= bytes.count - start {
+			var check = PDFLexer(bytes, from: start + length)
+			check.skipWhitespaceAndComments()
+			if !check.matches("endstream", at: check.position) { length = -1 }
+		} else {
+			length = -1
+		}
+		if length < 0 {
+			let end = Self.find(Array("endstream".utf8), in: bytes, from: start) ?? bytes.count
+			var trimmed = end
+			if trimmed > start && bytes[trimmed - 1] == 0x0A { trimmed -= 1 }
+			if trimmed > start && bytes[trimmed - 1] == 0x0D { trimmed -= 1 }
+			length = trimmed - start
+		}
+		return .stream(PDFStreamValue(dictionary: dictionary, encoded: bytes[start ..< start + length]))
+	}
+
+	private func compressedObject(_ number: Int, in streamNumber: Int, index: Int) -> PDFPrimitive? {
+		lock.lock()
+		let cached = objectStreamCache[streamNumber]
+		lock.unlock()
+		if let cached { return cached[number] }
+
+		var objects: [Int: PDFPrimitive] = [:]
+		if let stream = object(streamNumber)?.stream,
+		   let count = stream.dictionary["N"]?.integer, count >= 0,
+		   let first = resolve(stream.dictionary["First"] ?? .null).integer,
+		   let data = try? decodedData(stream), (0 ..< data.count).contains(first) {
+			var header = PDFLexer(data, to: first)
+			var entries = [(number: Int, offset: Int)]()
+			for _ in 0 ..< count {
+				guard case .value(.integer(let objectNumber)) = header.nextToken(),
+				      case .value(.integer(let offset)) = header.nextToken() else { break }
+				entries.append((objectNumber, offset))
+			}
+			for entry in entries {
+				// `first` is in range, so only a hostile offset can overflow.
+				guard entry.offset >= 0, entry.offset < data.count - first else { continue }
+				var lexer = PDFLexer(data, from: first + entry.offset)
+				if let value = lexer.readObject() { objects[entry.number] = value }
+			}
+		}
+		lock.lock()
+		objectStreamCache[streamNumber] = objects
+		lock.unlock()
+		return objects[number]
+	}
+
+	// MARK: - Cross-reference data
+
+	/// Load the xref chain from `startxref`. Returns `false` if it's unusable.
+	private func loadCrossReferences() -> Bool {
+		guard let startxref = Self.findLast(Array("startxref".utf8), in: bytes) else { return false }
+		var lexer = PDFLexer(bytes, from: startxref + 9)
+		guard case .value(.integer(var offset)) = lexer.nextToken() else { return false }
+
+		var visited = Set<Int>()
+		var isNewest = true
+		while !visited.contains(offset) {
+			visited.insert(offset)
+			let section: PDFDictionaryValue?
+			if PDFLexer(bytes).matches("xref", at: offset) {
+				section = readXrefTable(at: offset)
+				// Hybrid files list their compressed objects in an extra xref stream.
+				if let section, let streamOffset = section["XRefStm"]?.integer {
+					_ = readXrefStream(at: streamOffset)
+				}
+			} else {
+				section = readXrefStream(at: offset)
+			}
+			guard let section else { return !isNewest }
+			if isNewest {
+				trailer = section
+				isNewest = false
+			}
+			guard let previous = section["Prev"]?.integer else { break }
+			offset = previous
+		}
+		return !locations.isEmpty
+	}
+
+	/// Parse a classic table and return its trailer. Entries already known
+	/// from a newer section win.
+	private func readXrefTable(at offset: Int) -> PDFDictionaryValue? {
+		var lexer = PDFLexer(bytes, from: offset + 4)
+		while true {
+			let token = lexer.nextToken()
+			switch token {
+			case .keyword("trailer"):
+				return lexer.readObject()?.dictionary
+			case .value(.integer(let first)):
+				guard case .value(.integer(let count)) = lexer.nextToken(),
+				      let numbers = Self.subsection(first: first, count: count) else { return nil }
+				for number in numbers {
+					guard case .value(.integer(let entryOffset)) = lexer.nextToken(),
+					      case .value(.integer) = lexer.nextToken(),
+					      case .keyword(let kind) = lexer.nextToken() else { return nil }
+					if kind == "n" && locations[number] == nil && entryOffset > 0 {
+						locations[number] = .offset(entryOffset)
+					}
+				}
+			default:
+				return nil
+			}
+		}
+	}
+
+	/// Parse a cross-reference stream and return its dictionary (the trailer).
+	private func readXrefStream(at offset: Int) -> PDFDictionaryValue? {
+		guard let stream = parseIndirectObject(at: offset, expecting: nil)?.stream,
+		      stream.dictionary["Type"]?.name == "XRef",
+		      let widths = stream.dictionary["W"]?.array?.compactMap(\.integer), widths.count == 3,
+		      widths.allSatisfy({ (0 ... 8).contains($0) }),
+		      let data = try? decodedData(stream) else { return nil }
+
+		let size = stream.dictionary["Size"]?.integer ?? 0
+		let index = stream.dictionary["Index"]?.array?.compactMap(\.integer) ?? [0, size]
+		let entryLength = widths.reduce(0, +)
+		guard entryLength > 0 else { return nil }
+
+		func field(_ position: Int, _ width: Int) -> Int {
+			var value = 0
+			for byte in data[position ..< position + width] { value = value << 8 | Int(byte) }
+			return value
+		}
+
+		var position = 0
+		var pair = 0
+		while pair + 1 < index.count {
+			guard let numbers = Self.subsection(first: index[pair], count: index[pair + 1]) else { break }
+			for number in numbers {
+				guard position + entryLength <= data.count else { break }
+				// A zero-width type field defaults to type 1.
+				let type = widths[0] == 0 ? 1 : field(position, widths[0])
+				let second = field(position + widths[0], widths[1])
+				let third = field(position + widths[0] + widths[1], widths[2])
+				position += entryLength
+				guard locations[number] == nil else { continue }
+				switch type {
+				case 1: locations[number] = .offset(second)
+				case 2: locations[number] = .compressed(stream: second, index: third)
+				default: break
+				}
+			}
+			pair += 2
+		}
+		return stream.dictionary
+	}
+
+	/// The object numbers of an xref subsection, or `nil` if hostile values
+	/// would make the range negative or overflow.
+	private static func subsection(first: Int, count: Int) -> Range<Int>? {
+		guard first >= 0, count >= 0 else { return nil }
+		let (end, overflow) = first.addingReportingOverflow(count)
+		return overflow ? nil : first ..< end
+	}
+
+	/// Rebuild the xref by scanning the whole file for `n g obj` headers; later
+	/// definitions win, as they would after an incremental update. Runs at most
+	/// once per file: the scan holds the lock, and threads that arrive meanwhile
+	/// wait for the finished table. The catalog search afterwards runs unlocked,
+	/// since resolving a candidate may itself need ``object(_:)``.
+	private func rebuildCrossReferences() {
+		lock.lock()
+		while rebuildState == .running { lock.wait() }
+		guard rebuildState == .notStarted else {
+			lock.unlock()
+			return
+		}
+		rebuildState = .running
+		var found: [Int: Location] = [:]
+		let keyword = Array("obj".utf8)
+		var index = 0
+		while let hit = Self.find(keyword, in: bytes, from: index) {
+			index = hit + 3
+			guard hit + 3 >= bytes.count || !PDFLexer.isRegular(bytes[hit + 3]) else { continue }
+			// Walk back over "<number> <generation> ".
+			var cursor = hit - 1
+			func skipBack(_ predicate: (UInt8) -> Bool) -> Int {
+				var count = 0
+				while cursor >= 0 && predicate(bytes[cursor]) { cursor -= 1; count += 1 }
+				return count
+			}
+			let isDigit: (UInt8) -> Bool = { $0 >= 0x30 && $0 <= 0x39 }
+			guard skipBack(PDFLexer.isWhitespace) > 0, skipBack(isDigit) > 0,
+			      skipBack(PDFLexer.isWhitespace) > 0 else { continue }
+			let numberEnd = cursor + 1
+			guard skipBack(isDigit) > 0 else { continue }
+			let start = cursor + 1
+			guard let number = Int(String(decoding: bytes[start ..< numberEnd], as: UTF8.self)) else { continue }
+			found[number] = .offset(start)
+		}
+		// Keep object-stream members from the original xref; they have no header.
+		for (number, location) in locations where found[number] == nil {
+			if case .compressed = location { found[number] = location }
+		}
+		locations = found
+		objectCache.removeAll()
+		objectStreamCache.removeAll()
+		rebuildState = .finished
+		lock.broadcast()
+		lock.unlock()
+
+		// Only an unusable trailer is replaced: prefer the last `trailer`
+		// dictionary's /Root, otherwise find the catalog directly.
+		guard trailer["Root"] == nil else { return }
+		if let trailerOffset = Self.findLast(Array("trailer".utf8), in: bytes) {
+			var lexer = PDFLexer(bytes, from: trailerOffset + 7)
+			if let dictionary = lexer.readObject()?.dictionary, dictionary["Root"] != nil {
+				trailer = dictionary
+				return
+			}
+		}
+		for (number, location) in found {
+			guard case .offset(let offset) = location,
+			      let dictionary = parseIndirectObject(at: offset, expecting: number)?.dictionary,
+			      dictionary["Type"]?.name == "Catalog" else { continue }
+			trailer.entries["Root"] = .reference(number: number, generation: 0)
+			break
+		}
+	}
+
+	// MARK: - Byte search
+
+	static func find(_ needle: [UInt8], in haystack: [UInt8], from start: Int) -> Int? {
+		guard let first = needle.first, needle.count <= haystack.count else { return nil }
+		var index = max(0, start)
+		let last = haystack.count - needle.count
+		while index <= last {
+			if haystack[index] == first {
+				var matched = true
+				for offset in 1 ..< needle.count where haystack[index + offset] != needle[offset] {
+					matched = false
+					break
+				}
+				if matched { return index }
+			}
+			index += 1
+		}
+		return nil
+	}
+
+	static func findLast(_ needle: [UInt8], in haystack: [UInt8]) -> Int? {
+		guard needle.count <= haystack.count else { return nil }
+		var index = haystack.count - needle.count
+		while index >= 0 {
+			if haystack[index ..< index + needle.count].elementsEqual(needle) { return index }
+			index -= 1
+		}
+		return nil
+	}
+}
@@ -0,0 +1,130 @@
+//  PDFPrimitive.swift
+//  SwiftTextPDFReader
+//
+//  The parsed PDF object model: the eight basic object types plus indirect
+//  references. Read-only and value-typed, unlike SwiftTextPDFWriter's
+//  reference-typed builder objects, so parsed pages can be shared across the
+//  threads that extract them.
+
+import Foundation
+
+/// A parsed PDF object.
+enum PDFPrimitive: Sendable {
+	case null
+	case bool(Bool)
+	case integer(Int)
+	case real(Double)
+	case name(String)
+	case string([UInt8])
+	case array([PDFPrimitive])
+	case dictionary(PDFDictionaryValue)
+	case reference(number: Int, generation: Int)
+	case stream(PDFStreamValue)
+
+	var number: Double? {
+		switch self {
+		case .integer(let value): return Double(value)
+		case .real(let value): return value
+		default: return nil
+		}
+	}
+
+	var integer: Int? {
+		switch self {
+		case .integer(let value): return value
+		case .real(let value) where value.isFinite && abs(value) < 1e15: return Int(value)
+		default: return nil
+		}
+	}
+
+	var name: String? {
+		if case .name(let value) = self { return value }
+		return nil
+	}
+
+	var bytes: [UInt8]? {
+		if case .string(let value) = self { return value }
+		return nil
+	}
+
+	var array: [PDFPrimitive]? {
+		if case .array(let value) = self { return value }
+		return nil
+	}
+
+	/// The dictionary of a dictionary *or* a stream.
+	var dictionary: PDFDictionaryValue? {
+		switch self {
+		case .dictionary(let value): return value
+		case .stream(let stream): return stream.dictionary
+		default: return nil
+		}
+	}
+
+	var stream: PDFStreamValue? {
+		if case .stream(let value) = self { return value }
+		return nil
+	}
+
+	var referenceNumber: Int? {
+		if case .reference(let number, _) = self { return number }
+		return nil
+	}
+}
+
+/// A PDF dictionary. Keys are names without the leading slash.
+struct PDFDictionaryValue: Sendable {
+	var entries: [String: PDFPrimitive]
+
+	init(_ entries: [String: PDFPrimitive] = [:]) {
+		self.entries = entries
+	}
+
+	subscript(key: String) -> PDFPrimitive? {
+		entries[key]
+	}
+}
+
+/// A stream object: its dictionary and the still-encoded payload bytes.
+struct PDFStreamValue: Sendable {
+	let dictionary: PDFDictionaryValue
+	let encoded: ArraySlice<UInt8>
+}
+
+/// A 2-D affine transform `[a b c d e f]`, applied to row vectors as PDF does.
+struct PDFMatrix: Sendable {
+	var a = 1.0, b = 0.0, c = 0.0, d = 1.0, e = 0.0, f = 0.0
+
+	static let identity = PDFMatrix()
+
+	init() {}
+
+	init(_ a: Double, _ b: Double, _ c: Double, _ d: Double, _ e: Double, _ f: Double) {
+		(self.a, self.b, self.c, self.d, self.e, self.f) = (a, b, c, d, e, f)
+	}
+
+	/// Six numbers from a PDF array or operand list, or `nil` if malformed.
+	init?(_ values: [PDFPrimitive]) {
+		let numbers = values.compactMap(\.number)
+		guard numbers.count == 6 else { return nil }
+		self.init(numbers[0], numbers[1], numbers[2], numbers[3], numbers[4], numbers[5])
+	}
+
+	/// `self × other`: apply `self` first, then `other`.
+	func concatenating(_ other: PDFMatrix) -> PDFMatrix {
+		PDFMatrix(a * other.a + b * other.c,
+		          a * other.b + b * other.d,
+		          c * other.a + d * other.c,
+		          c * other.b + d * other.d,
+		          e * other.a + f * other.c + other.e,
+		          e * other.b + f * other.d + other.f)
+	}
+
+	func apply(_ x: Double, _ y: Double) -> (x: Double, y: Double) {
+		(a * x + c * y + e, b * x + d * y + f)
+	}
+
+	static func translation(_ x: Double, _ y: Double) -> PDFMatrix {
+		PDFMatrix(1, 0, 0, 1, x, y)
+	}
+}
@@ -0,0 +1,224 @@
+//  PDFTextReader.swift
+//  SwiftTextPDFReader
+//
+//  The public face of the reader: opens a PDF, walks its page tree, and turns
+//  each page's content into the same `TextLine`s the PDFKit/Vision pipeline
+//  produces, so `TextLineSemanticComposer` and `[TextLine].string()` work on
+//  either source unchanged.
+
+import Foundation
+import SwiftTextCore
+
+/// Extracts positioned text lines from a PDF without PDFKit.
+///
+/// Coordinates follow the PDFKit pipeline's convention: points, origin at the
+/// top-left of the page's crop box, after applying `/Rotate`. Pages share one
+/// object store and font cache, and ``pageTextLines()`` extracts them
+/// concurrently.
+public final class PDFTextReader: @unchecked Sendable {
+	private struct Page {
+		let resources: PDFDictionaryValue
+		let contents: PDFPrimitive?
+		let box: (llx: Double, lly: Double, urx: Double, ury: Double)
+		let rotation: Int
+	}
+
+	/// Page trees deeper than this are treated as malformed.
+	private static let maximumTreeDepth = 64
+
+	private let store: PDFObjectStore
+	private let fonts: PDFFontCache
+	private let pages: [Page]
+	private let budget: ResourceBudget
+
+	/// Parses the document structure. Page content is only read when its text is requested.
+	/// - Parameters:
+	///   - data: The PDF file's bytes.
+	///   - limits: Bounds for untrusted input: `maxPages`, `maxDecompressedBytes`
+	///     (every decoded stream, and a form's content again each time it is
+	///     drawn) and `deadline`. Unlimited by default.
+	/// - Throws: A ``PDFReaderError``, or a `ResourceLimitError` when the document exceeds `limits`.
+	public init(data: Data, limits: ResourceLimits = .unlimited) throws {
+		budget = ResourceBudget(limits)
+		store = try PDFObjectStore([UInt8](data), budget: budget)
+		fonts = PDFFontCache(store: store)
+		guard let catalog = store.value("Root", in: store.trailer)?.dictionary,
+		      let root = store.value("Pages", in: catalog) else {
+			throw PDFReaderError.malformed("no page tree")
+		}
+		var pages = [Page]()
+		var visited = Set<Int>()
+		try Self.collectPages(root, reference: catalog["Pages"]?.referenceNumber,
+		                      inherited: [:], depth: 0, store: store, visited: &visited, into: &pages, budget: budget)
+		self.pages = pages
+	}
+
+	/// Reads and parses the PDF at `url`.
+	/// - Throws: The file system error when it can't be read, or anything ``init(data:limits:)`` throws.
+	public convenience init(url: URL, limits: ResourceLimits = .unlimited) throws {
+		try self.init(data: Data(contentsOf: url, options: .mappedIfSafe), limits: limits)
+	}
+
+	/// The number of pages in the document.
+	public var pageCount: Int {
+		pages.count
+	}
+
+	/// The displayed size of a page in points, with `/Rotate` applied.
+	public func pageSize(at index: Int) throws -> CGSize {
+		guard pages.indices.contains(index) else { throw PDFReaderError.pageOutOfRange(index) }
+		let page = pages[index]
+		let width = page.box.urx - page.box.llx
+		let height = page.box.ury - page.box.lly
+		return page.rotation % 180 == 0 ? CGSize(width: width, height: height) : CGSize(width: height, height: width)
+	}
+
+	// MARK: - Text
+
+	/// The text lines of one page, top to bottom.
+	public func textLines(page index: Int) throws -> [TextLine] {
+		guard pages.indices.contains(index) else { throw PDFReaderError.pageOutOfRange(index) }
+		try budget.checkpoint()
+		let page = pages[index]
+		let content = try contentBytes(of: page)
+		guard !content.isEmpty else { return [] }
+		let interpreter = PDFContentInterpreter(store: store, fonts: fonts, resources: page.resources,
+		                                        displayMatrix: displayMatrix(for: page))
+		return try interpreter.fragments(of: content).assembledLines(splitVerticalFragments: true)
+	}
+
+	/// The text lines of every page, extracted concurrently and returned in page order.
+	public func pageTextLines() throws -> [[TextLine]] {
+		var results = [[TextLine]](repeating: [], count: pages.count)
+		var firstError: Error?
+		let lock = NSLock()
+		DispatchQueue.concurrentPerform(iterations: pages.count) { index in
+			lock.lock()
+			let failed = firstError != nil
+			lock.unlock()
+			guard !failed else { return }
+			do {
+				let lines = try textLines(page: index)
+				lock.lock()
+				results[index] = lines
+				lock.unlock()
+			} catch {
+				lock.lock()
+				if firstError == nil { firstError = error }
+				lock.unlock()
+			}
+		}
+		if let firstError { throw firstError }
+		return results
+	}
+
+	/// All text lines of the document in page order; page breaks show up as a
+	/// decrease in `yPosition`, as with `PDFDocument.textLines()`.
+	public func textLines() throws -> [TextLine] {
+		try pageTextLines().flatMap { $0 }
+	}
+
+	/// The document's text with vertical spacing and page breaks preserved.
+	public func extractText() throws -> String {
+		try textLines().string()
+	}
+
+	// MARK: - Pages
+
+	private static func collectPages(_ node: PDFPrimitive, reference: Int?, inherited: [String: PDFPrimitive], depth: Int,
+	                                 store: PDFObjectStore, visited: inout Set<Int>, into pages: inout [Page],
+	                                 budget: ResourceBudget) throws {
+		guard depth < maximumTreeDepth, let dictionary = node.dictionary else { return }
+		if let reference {
+			guard visited.insert(reference).inserted else { return }
+		}
+		var inherited = inherited
+		for key in ["Resources", "MediaBox", "CropBox", "Rotate"] {
+			if let value = store.value(key, in: dictionary) { inherited[key] = value }
+		}
+
+		if let kids = store.value("Kids", in: dictionary)?.array, store.value("Type", in: dictionary)?.name != "Page" {
+			for kid in kids {
+				try collectPages(store.resolve(kid), reference: kid.referenceNumber, inherited: inherited, depth: depth + 1,
+				                 store: store, visited: &visited, into: &pages, budget: budget)
+			}
+			return
+		}
+
+		try budget.charge(.pages)
+		let mediaBox = box(inherited["MediaBox"], store: store) ?? (0, 0, 612, 792)
+		var visible = mediaBox
+		if let crop = box(inherited["CropBox"], store: store) {
+			// The visible region is the crop box clipped to the media box.
+			visible = (max(crop.llx, mediaBox.llx), max(crop.lly, mediaBox.lly), min(crop.urx, mediaBox.urx), min(crop.ury, mediaBox.ury))
+			if visible.urx <= visible.llx || visible.ury <= visible.lly { visible = mediaBox }
+		}
+		let rotation = ((inherited["Rotate"]?.integer ?? 0) % 360 + 360) % 360
+		pages.append(Page(resources: inherited["Resources"]?.dictionary ?? PDFDictionaryValue(),
+		                  contents: dictionary["Contents"],
+		                  box: visible,
+		                  rotation: rotation - rotation % 90))
+	}
+
+	private static func box(_ value: PDFPrimitive?, store: PDFObjectStore) -> (llx: Double, lly: Double, urx: Double, ury: Double)? {
+		guard let numbers = value?.array?.compactMap({ store.resolve($0).number }), numbers.count == 4 else { return nil }
+		// Boxes may list their corners in any order.
+		return (min(numbers[0], numbers[2]), min(numbers[1], numbers[3]), max(numbers[0], numbers[2]), max(numbers[1], numbers[3]))
+	}
+
+	/// Default user space → top-left display space, for each `/Rotate`.
+	private func displayMatrix(for page: Page) -> PDFMatrix {
+		let (llx, lly, urx, ury) = page.box
+		switch page.rotation {
+		case 90: return PDFMatrix(0, 1, 1, 0, -lly, -llx)
+		case 180: return PDFMatrix(-1, 0, 0, 1, urx, -lly)
+		case 270: return PDFMatrix(0, -1, -1, 0, ury, urx)
+		default: return PDFMatrix(1, 0, 0, -1, -llx, ury)
+		}
+	}
+
+	/// The decoded content, with the streams of a `/Contents` array joined.
+	private func contentBytes(of page: Page) throws -> [UInt8] {
+		guard let contents = page.contents else { return [] }
+		let streams: [PDFPrimitive]
+		switch store.resolve(contents) {
+		case .array(let parts): streams = parts.map { store.resolve($0) }
+		case let single: streams = [single]
+		}
+		var content = [UInt8]()
+		for case .stream(let stream) in streams {
+			let data: [UInt8]
+			do {
+				data = try store.decodedData(stream)
+			} catch let error as ResourceLimitError {
+				throw error
+			} catch {
+				continue // A stream with an undecodable filter loses its text, not the page's.
+			}
+			if !content.isEmpty { content.append(0x0A) }
+			content.append(contentsOf: data)
+		}
+		return content
+	}
+}
+
+/// Errors that can occur while opening a PDF with ``PDFTextReader``.
+public enum PDFReaderError: Error, LocalizedError {
+	case notAPDF
+	case encrypted
+	case malformed(String)
+	case pageOutOfRange(Int)
+
+	public var errorDescription: String? {
+		switch self {
+		case .notAPDF:
+			return "The data is not a PDF file"
+		case .encrypted:
+			return "Encrypted PDFs are not supported"
+		case .malformed(let reason):
+			return "The PDF is damaged: \(reason)"
+		case .pageOutOfRange(let index):
+			return "Page index \(index) is out of range"
+		}
+	}
+}
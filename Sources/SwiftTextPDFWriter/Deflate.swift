@@ -55,6 +55,7 @@ enum Deflate {
 	private static let hashMask = hashSize - 1
 	private static let maxChain = 128
 	private static let niceLength = 128 // stop searching once a match this long is found
+	private static let cancellationInterval = 1 << 16 // input bytes between Task.isCancelled polls
 
 	private static func hash(_ a: UInt8, _ b: UInt8, _ c: UInt8) -> Int {
 		((Int(a) << 10) ^ (Int(b) << 5) ^ Int(c)) & hashMask
@@ -82,11 +83,22 @@ enum Deflate {
 		}
 
 		var pos = 0
+		var nextCancellationCheck = cancellationInterval
+		var cancelled = false
 		while pos < n {
+			// Poll for cancellation every 64 KiB of input. Once cancelled, the
+			// match search is skipped and the rest goes out as literals: the stream
+			// stays valid for a caller that ignores cancellation, but a discarded
+			// result no longer costs the hash-chain walk.
+			if pos >= nextCancellationCheck {
+				nextCancellationCheck = pos + cancellationInterval
+				cancelled = cancelled || Task.isCancelled
+			}
+
 			var bestLen = minMatch - 1
 			var bestDist = 0
 
-			if pos + minMatch <= n {
+			if !cancelled && pos + minMatch <= n {
 				let maxLen = min(maxMatch, n - pos)
 				let h = hash(data[pos], data[pos + 1], data[pos + 2])
 				var candidate = Int(head[h])
@@ -121,7 +133,7 @@ enum Deflate {
 				}
 			} else {
 				writeSymbol(Int(data[pos]), into: &writer) // literal
-				if pos + minMatch <= n { insert(pos) }
+				if !cancelled && pos + minMatch <= n { insert(pos) }
 				pos += 1
 			}
 		}
@@ -24,7 +24,6 @@ public final class PDF {
 	/// The document catalog.
 	public let catalog: PDFDictionary
 
-	private var currentPosition = 0
 	/// Byte offset of the cross-reference table after ``write(version:identifier:)``.
 	public private(set) var xrefPosition = 0
 
@@ -92,68 +91,63 @@ public final class PDF {
 	///     implemented.
 	@discardableResult
 	public func write(version: String = "1.7", identifier: Data? = nil) -> Data {
-		var output = Data()
-		// Reset position state so re-serializing the same document (a second
-		// write()/write(to:)) records correct offsets rather than accumulating.
-		currentPosition = 0
-		xrefPosition = 0
-
-		func writeLine(_ content: Data) {
-			currentPosition += content.count + 1
-			output.append(content)
-			output.append(0x0A) // newline
-		}
-		func writeLine(_ string: String) {
-			writeLine(Data(string.utf8))
-		}
-
 		// Add the info dictionary if it carries metadata (only once).
 		if !info.isEmpty && info.number == nil {
 			addObject(info)
 		}
 
+		// Every object appends into this one buffer, so its running length is
+		// the byte offset the cross-reference table needs.
+		var output = Data()
+		output.reserveCapacity(objects.count * 128 + 256)
+
+		func writeLine(_ string: String) {
+			output.append(contentsOf: string.utf8)
+			output.append(0x0A) // newline
+		}
+
 		// Header. The binary comment marks the file as containing binary data.
 		writeLine("%PDF-\(version)")
-		writeLine(Data([0x25, 0xF0, 0x9F, 0x96, 0xA4]))
+		output.append(contentsOf: [0x25, 0xF0, 0x9F, 0x96, 0xA4, 0x0A])
 
 		// Body: every in-use object, recording its offset.
 		for object in objects where !object.isFree {
-			object.offset = currentPosition
-			writeLine(object.indirect)
+			object.offset = output.count
+			object.appendIndirect(to: &output)
+			output.append(0x0A)
 		}
 
 		// Cross-reference table.
-		xrefPosition = currentPosition
+		xrefPosition = output.count
 		writeLine("xref")
 		writeLine("0 \(objects.count)")
 		for object in objects {
-			let offset = String(format: "%010d", object.offset)
-			let generation = String(format: "%05d", object.generation)
-			let marker = object.isFree ? "f" : "n"
 			// Each entry is exactly 20 bytes including the trailing newline.
-			writeLine("\(offset) \(generation) \(marker) ")
+			appendPadded(object.offset, width: 10, to: &output)
+			output.append(0x20)
+			appendPadded(object.generation, width: 5, to: &output)
+			output.append(contentsOf: object.isFree ? " f \n".utf8 : " n \n".utf8)
 		}
 
 		// Trailer.
 		writeLine("trailer")
 		writeLine("<<")
 		writeLine("/Size \(objects.count)")
-		var rootLine = Data("/Root ".utf8)
-		rootLine.append(catalog.reference)
-		writeLine(rootLine)
+		output.append(contentsOf: "/Root ".utf8)
+		output.append(catalog.reference)
+		output.append(0x0A)
 		if !info.isEmpty {
-			var infoLine = Data("/Info ".utf8)
-			infoLine.append(info.reference)
-			writeLine(infoLine)
+			output.append(contentsOf: "/Info ".utf8)
+			output.append(info.reference)
+			output.append(0x0A)
 		}
 		if let identifier {
 			let literal = PDFString.literal(from: identifier)
-			var idLine = Data("/ID [".utf8)
-			idLine.append(literal)
-			idLine.append(0x20)
-			idLine.append(literal)
-			idLine.append(contentsOf: "]".utf8)
-			writeLine(idLine)
+			output.append(contentsOf: "/ID [".utf8)
+			output.append(literal)
+			output.append(0x20)
+			output.append(literal)
+			output.append(contentsOf: "]\n".utf8)
 		}
 		writeLine(">>")
 
@@ -164,6 +158,15 @@ public final class PDF {
 		return output
 	}
 
+	/// Append `value` in decimal, left-padded with zeros to `width` digits.
+	private func appendPadded(_ value: Int, width: Int, to output: inout Data) {
+		let digits = String(value).utf8
+		if digits.count < width {
+			output.append(contentsOf: repeatElement(UInt8(ascii: "0"), count: width - digits.count))
+		}
+		output.append(contentsOf: digits)
+	}
+
 	/// Serialize the document and write it to a file URL.
 	public func write(to url: URL, version: String = "1.7", identifier: Data? = nil) throws {
 		try write(version: version, identifier: identifier).write(to: url)
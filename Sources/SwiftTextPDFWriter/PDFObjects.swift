@@ -3,15 +3,17 @@
 //
 //  The core PDF object model ported from pydyf: indirect objects, dictionaries,
 //  arrays and strings. These are reference types because their object number
-//  and byte offset are assigned lazily while the document is written.
+//  and byte offset are assigned lazily while the document is written. Objects
+//  serialize by appending to a caller's buffer, so a nested dictionary is
+//  written straight into the document rather than built up on its own.
 
 import Foundation
 
 /// Base class for indirect PDF objects.
 ///
-/// Concrete subclasses override ``data`` to provide their serialized body. The
-/// object number, generation and file offset are filled in by ``PDF`` during
-/// writing.
+/// Concrete subclasses override ``appendPDFData(to:)`` to provide their
+/// serialized body. The object number, generation and file offset are filled
+/// in by ``PDF`` during writing.
 public class PDFObject: PDFValue {
 	/// Number of the object, assigned when added to a ``PDF``.
 	public var number: Int?
@@ -24,19 +26,32 @@ public class PDFObject: PDFValue {
 
 	public init() {}
 
-	/// The serialized body of the object. Abstract; overridden by subclasses.
+	/// The serialized body of the object.
 	public var data: Data {
-		fatalError("PDFObject.data must be overridden")
+		var output = Data()
+		appendPDFData(to: &output)
+		return output
 	}
 
 	public var pdfData: Data { data }
 
+	/// Append the serialized body to `output`. Abstract; overridden by subclasses.
+	public func appendPDFData(to output: inout Data) {
+		fatalError("PDFObject.appendPDFData(to:) must be overridden")
+	}
+
 	/// The indirect representation: `"<n> <g> obj"`, body, `"endobj"`.
 	public var indirect: Data {
-		var result = Data("\(number ?? 0) \(generation) obj\n".utf8)
-		result.append(data)
-		result.append(contentsOf: "\nendobj".utf8)
-		return result
+		var output = Data()
+		appendIndirect(to: &output)
+		return output
+	}
+
+	/// Append the indirect representation to `output`.
+	public func appendIndirect(to output: inout Data) {
+		output.append(contentsOf: "\(number ?? 0) \(generation) obj\n".utf8)
+		appendPDFData(to: &output)
+		output.append(contentsOf: "\nendobj".utf8)
 	}
 
 	/// The reference used to point at this object: `"<n> <g> R"`.
@@ -60,7 +75,9 @@ public final class PDFRawObject: PDFObject {
 		super.init()
 	}
 
-	public override var data: Data { raw }
+	public override func appendPDFData(to output: inout Data) {
+		output.append(raw)
+	}
 }
 
 /// A PDF dictionary that preserves key insertion order so output is
@@ -93,14 +110,15 @@ public final class PDFDictionary: PDFObject {
 
 	public var isEmpty: Bool { keys.isEmpty }
 
-	public override var data: Data {
-		var result = Data("<<".utf8)
+	public override func appendPDFData(to output: inout Data) {
+		output.append(contentsOf: "<<".utf8)
 		for key in keys {
-			result.append(contentsOf: "/\(key) ".utf8)
-			result.append(storage[key]!.pdfData)
+			output.append(0x2F) // /
+			output.append(contentsOf: key.utf8)
+			output.append(0x20) // space
+			storage[key]!.appendPDFData(to: &output)
 		}
-		result.append(contentsOf: ">>".utf8)
-		return result
+		output.append(contentsOf: ">>".utf8)
 	}
 }
 
@@ -113,16 +131,15 @@ public final class PDFArray: PDFObject {
 		super.init()
 	}
 
-	public override var data: Data {
-		var result = Data([0x5B]) // [
+	public override func appendPDFData(to output: inout Data) {
+		output.append(0x5B) // [
 		for (index, element) in elements.enumerated() {
 			if index > 0 {
-				result.append(0x20) // space
+				output.append(0x20) // space
 			}
-			result.append(element.pdfData)
+			element.appendPDFData(to: &output)
 		}
-		result.append(0x5D) // ]
-		return result
+		output.append(0x5D) // ]
 	}
 }
 
@@ -139,30 +156,37 @@ public final class PDFString: PDFObject {
 		super.init()
 	}
 
-	public override var data: Data {
-		if let ascii = string.data(using: .ascii) {
-			return PDFString.literal(from: ascii)
+	public override func appendPDFData(to output: inout Data) {
+		let utf8 = string.utf8
+		if utf8.allSatisfy({ $0 < 0x80 }) {
+			PDFString.appendLiteral(utf8, to: &output)
+			return
 		}
-		var bytes: [UInt8] = [0xFE, 0xFF]
+		var bytes = Data([0xFE, 0xFF])
 		for unit in string.utf16 {
 			bytes.append(UInt8(unit >> 8))
 			bytes.append(UInt8(unit & 0xFF))
 		}
-		let hex = bytes.map { String(format: "%02x", $0) }.joined()
-		return Data("<\(hex)>".utf8)
+		appendHexString(bytes, to: &output)
 	}
 
 	/// Wrap arbitrary bytes as an escaped PDF literal string.
 	static func literal(from bytes: Data) -> Data {
-		var result = Data([0x28]) // (
-		result.reserveCapacity(bytes.count + 2)
+		var result = Data()
+		appendLiteral(bytes, to: &result)
+		return result
+	}
+
+	/// Append `bytes` to `output` as an escaped PDF literal string.
+	static func appendLiteral<Bytes: Collection>(_ bytes: Bytes, to output: inout Data) where Bytes.Element == UInt8 {
+		output.reserveCapacity(output.count + bytes.count + 2)
+		output.append(0x28) // (
 		for byte in bytes {
 			if byte == 0x5C || byte == 0x28 || byte == 0x29 { // \ ( )
-				result.append(0x5C)
+				output.append(0x5C)
 			}
-			result.append(byte)
+			output.append(byte)
 		}
-		result.append(0x29) // )
-		return result
+		output.append(0x29) // )
 	}
 }
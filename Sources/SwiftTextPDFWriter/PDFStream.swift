@@ -43,38 +43,56 @@ public final class PDFStream: PDFObject {
 		extraStorage[key] = value
 	}
 
-	public override var data: Data {
+	public override func appendPDFData(to output: inout Data) {
 		var content = Data()
 		for (index, item) in stream.enumerated() {
 			if index > 0 {
 				content.append(0x0A) // newline
 			}
-			content.append(item.pdfData)
-		}
-
-		let extra = PDFDictionary()
-		for key in extraKeys {
-			extra[key] = extraStorage[key]
+			item.appendPDFData(to: &content)
 		}
 
 		// Deflate the payload when asked — but never on a stream that already
 		// declares a filter (its bytes are pre-encoded, e.g. DCTDecode/FlateDecode
 		// image data), and only if it genuinely shrinks the output.
 		var body = content
+		var addsFilter = false
 		if compressed && extraStorage["Filter"] == nil {
 			let deflated = Deflate.zlib(content)
 			if deflated.count < content.count {
 				body = deflated
-				extra["Filter"] = "/FlateDecode"
+				addsFilter = true
 			}
 		}
-		extra["Length"] = body.count
 
-		var result = extra.data
-		result.append(contentsOf: "\nstream\n".utf8)
-		result.append(body)
-		result.append(contentsOf: "\nendstream".utf8)
-		return result
+		// The leading dictionary goes straight into `output`: the caller's keys
+		// in order, then `/Filter` and `/Length` unless already present. A
+		// caller-supplied `/Length` is replaced in place by the real one.
+		output.append(contentsOf: "<<".utf8)
+		func appendKey(_ key: String) {
+			output.append(0x2F) // /
+			output.append(contentsOf: key.utf8)
+			output.append(0x20) // space
+		}
+		for key in extraKeys {
+			appendKey(key)
+			if key == "Length" {
+				body.count.appendPDFData(to: &output)
+			} else {
+				extraStorage[key]!.appendPDFData(to: &output)
+			}
+		}
+		if addsFilter {
+			appendKey("Filter")
+			output.append(contentsOf: "/FlateDecode".utf8)
+		}
+		if extraStorage["Length"] == nil {
+			appendKey("Length")
+			body.count.appendPDFData(to: &output)
+		}
+		output.append(contentsOf: ">>\nstream\n".utf8)
+		output.append(body)
+		output.append(contentsOf: "\nendstream".utf8)
 	}
 
 	// MARK: - Token helpers
@@ -190,9 +208,9 @@ public final class PDFStream: PDFObject {
 	/// Show a hex-encoded byte string with `Tj`. Used for embedded fonts whose
 	/// codes are raw 2-byte glyph identifiers (Identity-H).
 	public func showHexString(_ bytes: Data) {
-		var token = Data([0x3C]) // <
-		token.append(Data(bytes.map { String(format: "%02x", $0) }.joined().utf8))
-		token.append(contentsOf: "> Tj".utf8)
+		var token = Data()
+		appendHexString(bytes, to: &token)
+		token.append(contentsOf: " Tj".utf8)
 		emit(token)
 	}
 	/// Show pre-built positioned glyph runs (`TJ`). `text` is the already
@@ -204,6 +222,10 @@ public final class PDFStream: PDFObject {
 		token.append(contentsOf: "] TJ".utf8)
 		emit(token)
 	}
+	/// Show a ``PDFTextArray`` with `TJ`.
+	public func showText(_ array: PDFTextArray) {
+		showText(array.data)
+	}
 
 	// MARK: - XObjects, shadings and marked content
 
@@ -216,3 +238,49 @@ public final class PDFStream: PDFObject {
 	/// End a marked-content sequence (`EMC`).
 	public func endMarkedContent() { emit("EMC") }
 }
+
+/// The contents of a `TJ` array: strings interleaved with position adjustments,
+/// so one text object can show several runs on a line without a `Td` each.
+public struct PDFTextArray {
+	public private(set) var data = Data()
+
+	public init() {}
+
+	public var isEmpty: Bool { data.isEmpty }
+
+	/// Append pre-encoded bytes (e.g. WinAnsi) as an escaped literal string.
+	public mutating func appendLiteral(_ bytes: Data) {
+		separate()
+		data.append(PDFString.literal(from: bytes))
+	}
+
+	/// Append bytes as a hex string (e.g. Identity-H glyph identifiers).
+	public mutating func appendHex(_ bytes: Data) {
+		separate()
+		appendHexString(bytes, to: &data)
+	}
+
+	/// Move the next string by `amount` thousandths of a text space unit;
+	/// positive values move it left (against the writing direction).
+	public mutating func appendAdjustment(_ amount: Double) {
+		separate()
+		data.append(contentsOf: formatPDFReal(amount).utf8)
+	}
+
+	private mutating func separate() {
+		if !data.isEmpty { data.append(0x20) }
+	}
+}
+
+private let hexDigits = Array("0123456789abcdef".utf8)
+
+/// Append `<hex>` for `bytes`, two lowercase digits per byte.
+func appendHexString(_ bytes: Data, to output: inout Data) {
+	output.reserveCapacity(output.count + bytes.count * 2 + 2)
+	output.append(0x3C) // <
+	for byte in bytes {
+		output.append(hexDigits[Int(byte >> 4)])
+		output.append(hexDigits[Int(byte & 0x0F)])
+	}
+	output.append(0x3E) // >
+}
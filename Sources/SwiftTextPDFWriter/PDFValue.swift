@@ -19,6 +19,16 @@ import Foundation
 public protocol PDFValue {
 	/// The raw bytes representing this value inside a PDF file.
 	var pdfData: Data { get }
+
+	/// Append ``pdfData`` to `output`. Nested values write into the caller's
+	/// buffer this way instead of each allocating their own.
+	func appendPDFData(to output: inout Data)
+}
+
+extension PDFValue {
+	public func appendPDFData(to output: inout Data) {
+		output.append(pdfData)
+	}
 }
 
 /// Format a real number the way pydyf does: integers print without a decimal
@@ -44,14 +54,26 @@ public func formatPDFReal(_ value: Double) -> String {
 
 extension Int: PDFValue {
 	public var pdfData: Data { Data(String(self).utf8) }
+
+	public func appendPDFData(to output: inout Data) {
+		output.append(contentsOf: String(self).utf8)
+	}
 }
 
 extension Double: PDFValue {
 	public var pdfData: Data { Data(formatPDFReal(self).utf8) }
+
+	public func appendPDFData(to output: inout Data) {
+		output.append(contentsOf: formatPDFReal(self).utf8)
+	}
 }
 
 extension Float: PDFValue {
 	public var pdfData: Data { Data(formatPDFReal(Double(self)).utf8) }
+
+	public func appendPDFData(to output: inout Data) {
+		output.append(contentsOf: formatPDFReal(Double(self)).utf8)
+	}
 }
 
 extension Data: PDFValue {
@@ -60,6 +82,10 @@ extension Data: PDFValue {
 
 extension String: PDFValue {
 	public var pdfData: Data { Data(utf8) }
+
+	public func appendPDFData(to output: inout Data) {
+		output.append(contentsOf: utf8)
+	}
 }
 
 /// A PDF name object such as `/Type` or `/Helvetica`.
@@ -74,4 +100,9 @@ public struct PDFName: PDFValue {
 	}
 
 	public var pdfData: Data { Data("/\(name)".utf8) }
+
+	public func appendPDFData(to output: inout Data) {
+		output.append(0x2F) // /
+		output.append(contentsOf: name.utf8)
+	}
 }
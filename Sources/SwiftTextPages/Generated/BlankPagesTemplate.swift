@@ -1,29 +1,5520 @@
 // Generated by Scripts/GeneratePagesTemplate.swift — DO NOT EDIT.
 // Source template: Empty.pages
 //
-// Embeds every package entry of a blank Pages document as base64 so the writer can
-// assemble a valid .pages from scratch with no bundled resource.
+// Embeds every package entry of a blank Pages document in one byte array, indexed
+// by path, so the writer can assemble a valid .pages from scratch with no bundled
+// resource and nothing to decode at runtime.
 
 extension PagesTemplate {
 	/// The built-in "blank" Pages template, captured from a default document.
 	static let blank = PagesTemplate(entries: [
-		Entry(path: "Index/Document.iwa", base64: "AJseAMhwaFYIARJSCJBOEgMBAAUY8AwiBwoDCgEuGAEiCQEJ8HUvEAEYASILCgUKAw8BERADGAAqJIHgaYLgaYPgaZ/gaYTgaZjXaYXgaYzeabbdaZbdabvfaYbgaRIECIXgaRoECLbdaSIECLvfaTIECJjXaToECIbgaXrSCwqTCyIPZW5fQVRAcmc9YXR6enp6OgQIgeBpSg9lNhcA2FABYAB4AYABAYoB2woKBzUwMjYuNjASCWdyZWdvcmlhbhoEbGF0biIHSmFudWFyeSIIRmVicnUBClwFTWFyY2giBUFwcmlsIgNNYXkiBEp1bmUBBmhseSIGQXVndXN0IglTZXB0ZW1iZXIiB09jdG8BCQwITm92CRMMCERlYwUKBCoHDWIAKhViACoJYgAqCWIAKgFiACoFYgEGCGx5Kg1iACoZYgAqEWIAKhViACoVYkwyA0phbjIDRmViMgNNYXIyA0FwcgEKFHkyA0p1bgEFaGwyA0F1ZzIDU2VwMgNPY3QyA05vdjIDRGVjOgE8ADoBPAA6ATwAOgE8AQoEeToBPAEFBGw6ATwAOgE8ADoBPAA6ATwAOgE8LEIGU3VuZGF5QgZNbwUIEAdUdWVzAREQCVdlZG4JCxAIVGh1cgUVDAZGcmkBHSQIU2F0dXJkYXlKDUAASg1AAEoRQABKGUAAShVAAEoNQABKFUCgUgNTdW5SA01vblIDVHVlUgNXZWRSA1RodVIDRnJpUgNTYXRaA1N1bloBIwBaASMAWgEjAFoBIwBaASMAWgEjTGICQU1qAlBNcgFKcgFGcgFNcgFBBQYASgUSYEFyAVNyAU9yAU5yAUR6AUp6AUZ6AU16AUEFBgBKBRJwQXoBU3oBT3oBTnoBRIIBAVOCAQFNggEBVIIBAVcNCABGARgIigEBAQQgTYoBAVSKAQFXDQgARgEYTJIBCzFzdCBxdWFydGVykgELMm5kHQ4EM3IuDgAINHRoERwAmjI4AACaMjgABJoBLjgABJoBLjgAEKIBAlExAQUAMgEFADMBBQQ0qgEUAQUAMgEFADMBBfBSNLIBAkJDsgECQUS6AQ1CZWZvcmUgQ2hyaXN0ugELQW5ubyBEb21pbmnCAQhkZC5NTS55ecoBB2RkLk1NLnnSAQlkLiBNTU1NIHnaAQ9FRUVFLCAVEijiAQVISDptbeoBCAUIFDpzc/IBChELECB6+gENGQ3wW3p6eoICASyKAgEukgIBLJoCAS6iAgErqgIBLbICAUW6AgElwgID4oCwygIEK+KIntICA05hTtoCCSMsIyMwLiMjI+ICAyNFMOoCCCMsIyMwwqAl8gIMwqTCoCMsASFMMDD6AgNFVVKCAwkKA0FVRBICQSQFDERCUkwSAlIkggMKCgNDQUQSA0MBGSwLCgNDTlkSBENOwqUFGxxFVVISA+KCrAU0GEdCUBICwqMFGRhIS0QSA0hLCUEISUxTASYAqgUaBElOBTMEuYIBThhKUFkSBEpQDU4IS1JXASgAqQUoGE1YThIDTVgJQhhOWkQSA05aCQ0IUEhQAScAsQUnBFRXARoAVAkaGFVTRBIDVVMJDQhWTkQBJwCrBWkgWEFGEgRGQ0ZBBTUYWENEEgNFQwkoVFhDRxIDQ2cuggMOCgNYT0YSB0bigK8FKywLCgNYUEYSBENGUEYF4/DeWFhYEgLCpJABARoCZW4iBAiC4GkqBAif4GkyBAiE4GlAAEoVQXBwbGljYXRpb24vQmxhbmsvSVNPYgQIg+BpcAB4AIABAKIBBAiM3mn1AezRFET9AfZ4UkSFAozFYkKNAozFYkKVAozFYkKdAozFYkKlAne7DUKtAigUKkK1AgAAgD+4AgDAAgDQAgDaAh5IUF9Db2xvcl9MYXNlckpldF9Qcm9fTTQ3OGZfOWbiAgZpc28tYTTwAgH6AgQIlt1piAMAEAiD4GkSCgjeARIDAQAFGAAQCITgaRIKCNkEEsXacBEIDwioAQhYCFQIHggfCD4gAJMCCJjXaRKMAgiRzf70AgL7Fyr2AfTXadvXadzXad3Xad7Xad/XaeDXaeHXaeLXaePXaeTXaeXXaebXaefXaejXaenXaerXaevXaezXae3Xae7Xae/XafDXafHXafLXafPXaZnXaZrXaZvXaZzXaZ3XaZ7XaZ/XaaDXaaHXaa/cabDcabHcabLcabPcaYrgadPXadTXadXXadbXadfXadjXadnXadrXaaPXaanXaa7Xaa/XabDXabHXabfXab3XacDXacLXacPXacTXaancaarcaavcaazcaa3caa7caZ/ZabjZadHZaerZaYPaaZzaacjaafTaaaDbaczbafjbaaTcaaXcaabcaZXgaTIGCQkJCQkICvgXGgVCbGFuayIECIXgaVIdCAEdgfp/PyUAAIA/LXX4fz81AACAP2ABbQAAgD9SHQgBHR0GVj8lHAZWPy0cBlY/NQAAgD9gAW0AAIA/Uh0IAR2zghI/JbKCEj8tsYISPzUAAIA/YAFtAACAP1IdCAEdTKC9PiVKoL0+LUygvT41AACAP2ABbQAAgD9SHQgBHQAAAAAlAAAAAC0AAAAANQAAgD9gAW0AAIA/Uh0IAR0AAAAAJQAAAAAtAAAAADUAAAAAYAFtAACAP1IdCAEd5tisPiV9+kE/Lf//fz81AACAP2ABbQAAgD9SHQgBHX2CJzol0DMiPy3//38/NQAAgDK6AEDjkrc0JXbH7D4ttag6PzUAADY+ADAsNpQ6JQg9mj4tAQAARh8AMEpp5j4lJY99Py13iWpGHwAwRYu0PSXVpGc/LX/ZT0YfADAAAAAAJeXUKz8tX6EOWh8AHETB2D4tx7TLRjYBMOvdCD8lmfV6Py0GYp1GHwAwy8PBPiVTJ1k/LUgnWUYfADR/jec9JeCZMT8tlhXhOkL4ADD196U7JT+y4j4tPaHjRh8AIScgJflIcT8t4V+tRl0ABR8cFy1aPy1QhkhGHwAk6bZ+PyV3PC4/LSECQnwAIJ0Ecz8l/EXkPlYfAAVdHJW3Fj8tkowNRjYBMP//fz8l2gbIPi3HcZxGfAA0x59uPyXEEAo+LYKwPj1CfAA0L041PyULCbs9LVK4zjJCHwAFfBwzYRU/LQ3wSkZ8AAUfHIc6hT4tWb8hRh8AMGNUVD8lb6/EPS3Eye1GmwAwj5AXPyWCDlw9Lbh3pjIfAEiiBugNCmgSZggAEikKHQgBHebYXvQCABUhU0FaAD8NK2bhAgAVAa8FKwW5ICAAKgUV5MuWQDJqAGbDAkJqACwgjYY0Jerx9z4tnKI23wCSagBmsQJCagBmngKSagAwQXB7PyW96WI/LZgrSTJpAUJqACEjDCWN5BNGqwKSagBmjQJCagBmegKSagAw0eR/PyXH0RU/LSdTSzJ7AkJqACz3RRc/JaKXXj0tVHQ2aAJeagAYElQaUhACGkF6HPg1rD4l8flBIREAgAFoAACxTxwiCg0AAJZDFQEFGDICCAlAAUoBMTC1tLQ+JZGQED8tsK8vATG1YR1WQmYCflYAMOnoaD4lo6IiPy2YlxdeVgBCUgJeVgAACA2sEOfm5j4lAacMLb28vDIZAh2sQhMCXlYAMQIBUSAl8/LyPi29vDxeVgBCmAR+VgAwp6YmPyWBgIA+LdXUVF5WADCfHUw/Jco1Jj4t4i73ASV+VgAwlpUVPyWJiIg+Ldva2gExNa4EGjSFeoFfMo0HFSEQFQAAtEIBIAhAIAWhuhA/MAE4AI42AAA0ATYMoEAgBLI2AAlsCEEgCrI2AAVsBAAABTYAQAmiADuS2AAYXXAqPyAPLSH9KDABOAJSBQ15Gfy9mj0AATYFPQVzAT0M+NUoPo49AAAApcwQACAcLQAJPRgBSgUV1NAxnj0AFDOzFkEgHi49ADQAAIA+IgQI29dpIgQI3AUGAN0FBgDeBQYA3wUGBODXDh0MAOEFBgDiBQYA4wUGAOQFBgDlBQYE5tcOOwwY59dpOgQI6AUGAOkFBgDqBQYA6wUGAOwFBhjt12lCBAjuBQYA7wUGAPAFBgDxBQYA8gUGWPPXaUoECPTXafIG9gEKBAiZ12kKBAiaBQYAmwUGAJwFBgCdBQYAngUGAJ8FBgCgBQYAoQW4BK/cAdYAsAUGALEFBgCyBQYEs9wB0ACKEu0MANMFuADUBQYA1QUGANYFBgDXBQYA2AUGANkFBgDaBb4AowUGAKkFBgCuBQYArwUGALAFBgCxBQYAtwUGAL0FBgDABQYAwgUGAMMFBgDEBeIEqdwhBgCqBQYAqwUGAKwFBgCtBQYortxpwgckCgQIyNoB+QD0BQYEoNsBDADMBQYA+AUGEKTcacIMAScEn9kBGwC4BQYA0QUGAOoFBgCDBTkonNppkg0SCgQIpdwBJwSm3A6tEwyV4GkYIQQQEhIIgxAWDBRwICoGrtdpsNxpCgxTdGFuZGFyZCBUT0MQABoOCgQB7gQSBCFOCBgBFQFxEBIPCPguCTkQBioDi+AO/BMQi+BpiwMBBjAS2wII5zASAwIEABjiGloUECMQARgAFmUUACIZCwAhGQsAGxkLABoZCwAZGQsAGBkLABcZCwAgGQsAHxkLAB4ZCwAdGQsAHBkLABEZCwAQGQsADxkLAA4ZCwANGQsAFhkLABUZCwAUGQsAExkLABIBC/BVKlGH2WmJ2WmK2WmL2WmI2WnG12nH12nF12mb2WmM2WmN2WmO2WmP2WmQ2WmR2WmS2WmT2WmU2WmV2WmW2WmX2WmY2WmZ2Wma2Wmc2Wmd2Wme2WkSJwglXRQAABhEKhtqXwAQCgQIx9chtwTG1yGfAMZlFwDGZbEEiNlhsQSJ2WGxBIrZQY0Ei9lhdUiH2WlSBAjF12laBAib2WlgAGoEATIAcgUGAHoFBgSCAQUHAIoJBwCSDgYQ8HnZaZoBBAiN2WmiAQQIjtlpqgEECI/ZabIBBAiQ2Wm6AQQIltlpwgEECJfZacoBBAiY2WnSAQQImdlp2gEECJrZaeIBBAiR2WnqAQQIktlp8gEECJPZafoBBAiU2WmCAgQIldlpigIECJzZaZICBAid2WmaAgQIntlpCu7iAA3iABVhOjbPAgCMRc8QjOBplwMBBgQS4f7PAv7PAv7PAv7PAlnPUFeg2Wmi2Wmj2Wmk2Wmh2WnI12nJ11nV6LTZaaXZaabZaafZaajZaanZaarZaavZaazZaa3Zaa7Zaa/ZabDZabHZabLZabPZabXZabbZabfZaRItiTJF1QAhgmUAVdsAyEXbAMld2wChRdsAokXbAKNF2wCkRdsAoF3bGLTZaWABagQBOAByBQYAegUGQdsEyddF2wTJ10XbAKVJ2wCmSdsAp0nbAKhJ2wCpSdsAr0nbBLDZRdsAsUnbBLLZRdsAs0nbBKrZRdsAq0nbCKzZaUHbBK3ZRdsArknbJLXZaZICBAi22WlB2wC3pcBpveriAAAVwQ822wIAjUXbAI1F2wSN4P7bAv7bAv7bAv7bAjbbAjC52Wm72Wm82Wm92Wm6QtsC2M3Zab7Zab/ZacDZacHZacLZacPZacTZacXZacbZacfZacjZacnZacrZacvZaczZac7Zac/ZadA+2wKCZQBq2wIAukXbALtF2wC8RdsAvUXbALld2xDN2WlgAo7bAgC+SdsAv0nbAMBJ2wDBSdsAwknbAMhJ2wDJSdsAyknbAMtJ2wDMSdsAw0nbAMRJ2wDFSdsAxknbAMdJ2wDOSdsAz0nbANBy2wKi4gAAFQ7kCDbbAgCORdsAjkXbAI7+2wL+2wL+2wL+2wI62wIw0tlp1Nlp1dlp1tlp00LbAtjm2WnX2WnY2WnZ2Wna2Wnb2Wnc2Wnd2Wne2Wnf2Wng2Wnh2Wni2Wnj2Wnk2Wnl2Wnn2Wno2WnpPtsCgmUAatsCANNF2wDURdsA1UXbANZF2wDSXdsQ5tlpYAOO2wIA10nbANhJ2wDZSdsA2knbANtJ2wDhSdsA4knbAONJ2wDkSdsA5UnbANxJ2wDdSdsA3knbAN9J2wDgSdsA50nbAOhJ2wDpctsCouIAABUOuQs22wIAj0XbEI/gaZEDAQYEEt7+kQj+kQj+kQj+kQgmkQg0VOvZae3Zae7Zae/ZaewSYAsAyh5jC+j/2Wnw2Wnx2Wny2Wnz2Wn02Wn12Wn22Wn32Wn42Wn52Wn62Wn72Wn82Wn92Wn+2WmA2mmB2mmC2mkSKiqOCAAedmIAVdUWZgsAyiqLCADsRdUA7UXVAO5F1QDvRdUA613VGP/ZaWAEagQBOAByBQYAegUGDosIAMoWiwgAyhaLCADwSdUA8UnVAPJJ1QDzSdUA9EnVAPpJ1QD7SdUA/EnVAP1J1QD+SdUA9UnVAPZJ1QD3SdUA+EnVAPlJ1QSA2hKLCASB2hKLCACCEkUOFosI6uIAABUOiA421QIAkEXVAJBF1QSQ4P7VAv7VAv7VAv7VAjbVAkiE2mmG2mmH2mmI2mmF2mnM12nLUdXYmNppidppitppi9ppjNppjdppjtppj9ppkNppkdppktppk9pplNppldppltppl9ppmdppmtppmz7VAgCEcmIAVdUAzBJgCwDLRdUAzBI7DgSF2g47DgSG2g47DgSH2g47DgSI2g47DgSE2iY7DhiY2mlgBWoEATgAcgUGAHoFBkHVAMtJ1QDLSdUEidoSOw4EitoSOw4Ei9oSOw4EjNoSOw4EjdoSOw4Ik9ppDjsOBJTaEmALCJXaaQ47DgSW2hJgCwiX2mkOOw4EjtoSYAsMj9pp8g5zDgDaEmALBJHaEmALHJLaaYoCBAiZSdUAmknVAJtd1eriAASSAQ6jERQSiwEInCcWDBHwhpICKn6d2mme2mmf2mmg2mmh2mmi2mmj2mmk2mml2mmm2mmn2mmp2mmq2mmr2mms2mmt2mmu2mmv2mmw2mmx2mmy2mmz2mm02mm12mm22mm32mm42mm52mm62mm72mm82mm92mm+2mm/2mnA2mnB2mnC2mnD2mnE2mnF2mnG2mnH2mkKBAid2g71DwSe2g71DwCfBQYEoNoODBMEodoO+hIAogUGAKMFBgCkBQYApQUGAKYFBgCnJd4AqQUGAKoFBgCrBQYArAUGAK0FBgCuBQYArwUGALAFBgCxBQYAsgUGALMFBgC0BQYAtQUGALYFBgC3BQYAuAUGALkFBgC6BQYAuwUGALwFBgC9BQYAvgUGAL8FBgDABQYAwQUGAMIFBgDDBQYAxAUGAMUFBmDG2mk6EADZ3sEN/U4imPQveWrHBiaC8QQGQcYM2mmSAQ5DEz6mAfCaydppytppy9ppzNppzdppztppz9pp0Npp0dpp0tpp09pp1dpp1tpp19pp2Npp2dpp2tpp29pp3Npp3dpp3tpp39pp4Npp4dpp4tpp49pp5Npp5dpp5tpp59pp6Npp6dpp6tpp69pp7Npp7dpp7tpp79pp8Npp8dpp8tpp89ppCgQIydppEgQIytppGgQIy9ppGgQIzNppIgQIzdohpgDOJY4AzwUGANAFBgDRBQYA0gUGANMF+ADVBQYA1gUGANcFBgDYBQYA2QUGANoFBgDbBQYA3AUGAN0FBgDeBQYA3wUGAOAFBgDhBQYA4gUGAOMFBgDkBQYA5QUGAOYFBgDnBQYA6AUGAOkFBgDqBQYA6wUGAOwFBgDtBQYA7gUGAO8FBgDwBQYA8QUGAPIhpjwg1wUcfNlDTLfrl3Hj9H2ALaYA8yWmBKDbQqYB8IH12mn22mn32mn42mn52mn62mn72mn82mn92mn+2mn/2mmB22mC22mD22mE22mF22mG22mH22mI22mJ22mK22mL22mM22mN22mO22mP22mQ22mR22mS22mT22mU22mV22mW22mX22mY22mZ22ma22mb22mc22md22me22mf22kKBAj1JaYA9mVGAPcFBgD4ZUwA+SWIAPoFBgD7BQYA/AUGAP0FBgD+BQYA/wX4BIHboTAAggUGAIMFBgCEBQYAhQUGAIYFBgCHBQYAiAUGAIkFBgCKBQYAiwUGAIwFBgCNBQYAjgUGAI8FBgCQBQYAkQUGAJIFBgCTBQYAlAUGAJUFBgCWBQYAlwUGAJgFBgCZBQYAmgUGAJsFBgCcBQYAnQUGUJ7baToQQ17VtEioRE6TQRS3TBIShC2mBJ/bYUwAzEamAfCaodtpottpo9tppNtppdtppttpp9tpqNtpqdtpqttpq9tprdtprttpr9tpsNtpsdtpsttps9tptNtptdtptttpt9tpuNtpudtputtpu9tpvNtpvdtpvttpv9tpwNtpwdtpwttpw9tpxNtpxdtpxttpx9tpyNtpydtpyttpy9tpCgQIodtpEgQIottpGgQIo9tpGgQIpNtpIgQIpdthTASm2wEGAKcFBgCoBQYAqQUGAKoFBgCrBfgArQUGAK4FBgCvBQYAsAUGALEFBgCyBQYAswUGALQFBgC1BQYAtgUGALcFBgC4BQYAuQUGALoFBgC7BQYAvAUGAL0FBgC+BQYAvwUGAMAFBgDBBQYAwgUGAMMFBgDEBQYAxQUGAMYFBgDHBQYAyAUGAMkFBgDKIaY8psjpvqwwSjC40rTPweB10y2mAMslpgT420JMA/CBzdtpzttpz9tp0Ntp0dtp0ttp09tp1Ntp1dtp1ttp19tp2dtp2ttp29tp3Ntp3dtp3ttp39tp4Ntp4dtp4ttp49tp5Ntp5dtp5ttp59tp6Ntp6dtp6ttp69tp7Ntp7dtp7ttp79tp8Ntp8dtp8ttp89tp9Ntp9dtp9ttp99tpCgQIzSWmBM7bwZgAzwUGBNDbwZgA0SWIANIFBgDTBQYA1AUGANUFBgDWBQYA1wX4ANkFBgDaBQYA2wUGANwFBgDdBQYA3gUGAN8FBgDgBQYA4QUGAOIFBgDjBQYA5AUGAOUFBgDmBQYA5wUGAOgFBgDpBQYA6gUGAOsFBgDsBQYA7QUGAO4FBgDvBQYA8AUGAPEFBgDyBQYA8wUGAPQFBgD1BQYA9iGmPKXyHVJOMERmvbMryRZj8TktpgT322FMBKTcQqYB8IH522n622n722n822n922n+22n/22mA3GmB3GmC3GmD3GmF3GmG3GmH3GmI3GmJ3GmK3GmL3GmM3GmN3GmO3GmP3GmQ3GmR3GmS3GmT3GmU3GmV3GmW3GmX3GmY3GmZ3Gma3Gmb3Gmc3Gmd3Gme3Gmf3Gmg3Gmh3Gmi3Gmj3GkKBAj5JaYA+iWgAPsFBgD8JaYA/SWIAP4FBgD/BQYAgBJKGwCBBQYAggUGBIPcgewAhQUGAIYFBgCHBQYAiAUGAIkFBgCKBQYAiwUGAIwFBgCNBQYAjgUGAI8FBgCQBQYAkQUGAJIFBgCTBQYAlAUGAJUFBgCWBQYAlwUGAJgFBgCZBQYAmgUGAJsFBgCcBQYAnQUGAJ4FBgCfBQYAoAUGAKEFBlCi3Gk6EKzs1Vo+g00dlCVNj32Q6IEtphij3GkVCIzeDrkMBJ9OFuIJEAYqA7vfDiALDLvfaR4BBRASGAjRDwkcRGEqDLfXaZnXaf/facjdaQgAEhIXLwwqCgoIBQw0t9dpMggKBggAEAAYADoRFhSZ12lQAWIRDgz/32lyFSQEigERFxDI3WnCARUYHOIBBAoCCAApARcMEiMImw2cADkWYBsO8hqAASoMnN5pgt9pwN9pid1piAEBkAEAmAEAoAEAqAEAsAEBDpYZBJzeElsLBILfElsLGMDfadIBBUIO7Sko4AEA6gEECIndaSQBJRASHgifTwnjTCQqEo7fadTfad3daa7fab/eaZLeIQ4AjiUUANQFBgTd3Q6ACgSu3wEGBL/eAQYMkt5pGAEjBBISNSwMQSoGwCUsBAgBOiYBAMBmJgE5Gj0NABgBd/5aAFpaAAHL/rQAVrQAIR/+WgBWWgAhc/5aAFZaAASS3v5oAVZoAQAkQYM2ZQI8/dxpjd1pi91p3d5puN1pgUVZAP0Swh4Ejd1BcQCLRWUA3UVfALgFDAyB32kYASP+/QBa/QAEjd3+WgBeWgABy/6xAVaxASEf/loAVloAIXP+WgBWWgAEgd/+aAFWaAEAJIHhNmUCPIrdaaHeaczeaZXfadjeaYxFZQCKRV8AoYXWAMxFXwCVhcoA2AUMAIxBZQCK/gsCYgsCAKH+YgNaYgMAGAXL/rEBVrEBIR/+WgBWWgAhc/5aAFZaAACM/mUCWmUCABXhNEASDwigThIDAQEAGAoqA9/fae3/DN/faRABBRASCgjnF+lPEAAQCLbdAREAmgExAAASyTAAlgURBOsSCSIQAhAAGQgOYjcIEwicDSQEeiIStTcQIhgBCAEOsDcMIAEoAQ5hJzBAAUgAUAFYAGABaAFwFkM36fhIogEBLKoBAmVusgEAugEPZW5fQSqHNwDK7fWw0gEYMjAyNi0wNi0xNVQxODoyMzozOSswMjAw8AEA+AEAgAIAiAIKkAIAwAIA"),
-		Entry(path: "Index/ViewState.iwa", base64: "ANACAKUHcBUIn+BpEg8I0gESAwEABRgGKgOt4GkKBAit4GkYAQUQEhIIo08JHBgMKgau4GmvBR8kruBpEgQIr+BpEAULCAoIkw0lZHQIARAAGAEgASpjCl8IARJCGgQIABAAIAAqBQgcMAE4AUISCQANAQARDQgEAEoFFBCgTh5+QAEUMJAIxIZAUAFYAGAAaAAJQgAiBUBYUDVYA5ABAJgBAKIBABAAMABA8KOzDEIBigwSPAiVDYUw3gEiBwoDCgEnGAEiCQEJDCAQARgNFHgXGAEqErDgabHgabLgabPgaangaargaRIKDc3MzL4VAZGwMAA6Cg0AABVEFZqZUkRIAFAAWABgAWgAcAB9AACgP4IBCg0AgD1EFQAAvEKKAQ3wPOCARBUAIIxEkgElVFBNYWNJbnNwZWN0b3JTZWdtZW50SWRlbnRpZmllckZvcm1hdJgBAKABAa0BAAAAP7UBBjQAuAEBwAEAygEMCgQIsCVi4LHgadABAdgBAeABAPgBAIgCAJACAJoCBAip4GmwAgC4AgHAAgDKAgQIquBp0AIA4AIA7QIAAAAA9QUGBPoCAUoAsgVKALMhpgCwAeMECNst5wQAEAFgDBIKCJQtMmwkCAASCAj/////DxAAGAAgAEgBUP////8PWAhiFRgAEAFRABIyRgAEs+ABERFGDBgIABIlpw1CDABYCGIFEAARAbYYEgsIkxgSA0FncMcBCh0IAR13vp89JZHt/D4tbed7PzUAAIA/YAFtAQcIEAAdAQcgJQAAgEAtAAAACR0APQEUAEUBFABNAQocVQAAAEFYAGJ2SwAAagEfNAisnD4l/tRYPy30/dQ+LmoAAHIBHzAj23k/Jc3MTD4t8KeGMh8AAHoBHzCR7Xw/JWDlUD8tf2o8Mh8ABBAIRTwICIICCdkMVAgBEgEyZlEAEdgIAAAqASlmWwAkNc3MTD89AAAAvw=="),
-		Entry(path: "Index/CalculationEngine-1732610.iwa", base64: "ABkCAKoH8HEuCILgaRIoCKAfEgMBAAUYgQMiCgoECgICBhABGAAqD4fgaavgaazgaYjgaYngaRLDAgqAAQoJEJoFGAAgACgAEg8KDQgAEAEwAUoFSICAgAgaACIAKiwiFAj//wEQ/////wcY//8BIP////8HKhQI//9CFgAAMrIuAJBCAEoACoABChgQra3Y6wUYtJW3ogUgpIufsAwolu76pgUSABoA/oMAhoMAHBotCg0IARIJNQkQChwIAhJilQDwSSgBMgQIh+BpMgQIq+BpGgQIrOBpIAMwiJfbmtSOq+XYAToASS5z6EUv8MdBUg1FdXJvcGUvVmllbm5hagByBAiI4Gl6BAiJ4GkWAUaQEhAIqB8SAwMCChiiASoDkeBpCgUImgUQABABGMgBIgwKCggAEAFyIAAQACoAMgwKAC0VFAA6ADosElKGAQAaUhYAAEKyLgBwSgIKAFIAYgUI0gMQAGoGCgQIkeBpcgB6AIIBABABDAwSCgipTWkcEggBEAAYACIdqwARIRwEEgsV3BCXAQoUCCHmFMXW8qZUECHkJOzire9UEAIYByL+2QDK2QAEagANzAAVIb8MEg8Iow3MMAYqA7TgaQoECLTgaRABBQwSCgikDRx0GQoXEOe32ToYyuelsgMgq8nnyQEorO2nyw0QCIjgASoE3jFpewANLcUEEgQhuEAQCIngaRIKCKsfEgMBAAUYAA=="),
-		Entry(path: "Index/AnnotationAuthorStorage-1732609.iwa", base64: "ABMAABFAEAiB4GkSCgjVARIDAQAFGAA="),
-		Entry(path: "Index/DocumentStylesheet.iwa", base64: "AOQ1AICABOiPDAiF4GkSiAwIkQMSAwEABRj8mQEiNQoDCgEHEAMYASIqqdxpqtxpq9xprNxprdxprtxplOBplOBpqUIYAAQiFwE3AAgFNxAMpdxppgUD9G0GpdxpKqkLqNxpp9xp1Ndp09dpodppndppntppqdppqtpps9pptNpptdppttppt9ppuNppudpputppu9ppvNppq9ppvdppvtppv9ppwNppwdppwtppw9ppxNppxdppxtpprNpprdpprtppr9ppsNppsdppstppx9ppotppo9pppNpppdppptppp9ppn9ppoNppzdppydppytpp1dpp1tpp39pp4Npp4dpp4tpp49pp5Npp5dpp5tpp59pp6Npp19pp6dpp6tpp69pp7Npp7dpp7tpp79pp8Npp8dpp8tpp2Npp2dpp2tpp29pp3Npp3dpp3tpp89ppztppz9pp0Npp0dpp0tpp09ppy9ppzNpp+dpp9dpp9tppgdtpgttpi9tpjNtpjdtpjttpj9tpkNtpkdtpkttpk9tplNtpg9tpldtplttpl9tpmNtpmdtpmttpm9tpnNtpndtpnttphNtphdtphttph9tpiNtpidtpittpn9tp+tpp+9pp/Npp/dpp/tpp/9pp99pp+Npppdtpodtpottprdtprttpt9tpuNtpudtputtpu9tpvNtpvdtpvttpv9tpwNtpr9tpwdtpwttpw9tpxNtpxdtpxttpx9tpyNtpydtpyttpsNtpsdtpsttps9tptNtptdtptttpy9tppttpp9tpqNtpqdtpqttpq9tpo9tppNtp0dtpzdtpzttp2dtp2ttp49tp5Ntp5dtp5ttp59tp6Ntp6dtp6ttp69tp7Ntp29tp7dtp7ttp79tp8Ntp8dtp8ttp89tp9Ntp9dtp9ttp3Ntp3dtp3ttp39tp4Ntp4dtp4ttp99tp0ttp09tp1Ntp1dtp1ttp19tpz9tp0Ntp/dtp+dtp+ttphdxphtxpj9xpkNxpkdxpktxpk9xplNxpldxpltxpl9xpmNxph9xpmdxpmtxpm9xpnNxpndxpntxpn9xpoNxpodxpotxpiNxpidxpitxpi9xpjNxpjdxpjtxpo9xp/ttp/9tpgNxpgdxpgtxpg9xp+9tp/Ntpudxp9Ndpk+Bp6Ndp6ddp6tdp69dp7Ndp7ddp29dp3Ndp3ddp3tdp39dp4Ndp7tdp79dp8Ndp8ddp8tdp89dpotdp4ddp4tdp49dp5Ndp5ddp5tdp9ddpluBpl+BpmOBpmeBpmuBpm+BpnOBpneBp9tdpleBph9lpoNlpudlp0tlp69lphNppiNlpjNlpjdlpjtlpj9lpkNlpi9lpitlpidlpkdlpktlpk9lplNlpldlpndlpnNlpntlpodlppdlpptlpp9lpqNlpqdlppNlpo9lpotlpqtlpq9lprNlprdlprtlpttlptdlpt9lputlpvtlpv9lpwNlpwdlpwtlpvdlpvNlpu9lpw9lpxNlpxdlpxtlpx9lpz9lpztlp0Nlp09lp19lp2Nlp2dlp2tlp29lp1tlp1dlp1Nlp3Nlp3dlp3tlp39lp4Nlp6Nlp59lp6dlp7Nlp8Nlp8dlp8tlp89lp9Nlp79lp7tlp7dlp9dlp9tlp99lp+Nlp+dlpgdppgNppgtpphdppidppitppi9ppjNppjdppiNpph9pphtppjtppj9ppkNppkdppktppmtppmdppm9ppltlpl9lpmNlpmdlpmtlpr9lpsNlpsdlpstlps9lpyNlpydlpytlpy9lpzNlp4dlp4tlp49lp5Nlp5dlp+tlp+9lp/Nlp/dlp/tlpk9pplNppldppltppl9ppm9lptNlpzdlp5tlp/9lpmNppmddpo9dpmtdpsNxprtdpr9dpsNdpsddpm9dpsdxpt9dpvddpwNdpnNdpstxpwtdpw9dpxNdpxddpxtdpx9dpyNdpyddpytdpnddps9xpy9dpzNdpntdpn9dpqddpoNdpoddp59dpr9xpptxppdxplOBpqdxpqtxpq9xprNxprdxprtxpCgQImddpCgQImtdpCgQIm9dpCgQInNdpCgQInddpCgQIntdpCgQIn9dpCgQIoNdpCgQIoddpCgQIotdpCgQIo9dpCgQIqddpCgQIrtdpCgQIr9dpCgQIsNdpCgQIsddpCgQIt9dpCgQIvddpCgQIwNdpCgQIwtdpCgQIw9dpCgQIxNdpCgQIxddpCgQIxtdpCgQIx9dpCgQIyNdpCgQIyddpCgQIytdpCgQIy9dpCgQIzNdpCgQI09dpCgQI1NcBwATV1wEGANYFBgDXBQYA2AUGANkFBgDaBQYA2wUGANwFBgDdBQYA3gUGAN8FBgDgBQYA4QUGAOIFBgDjBQYA5AUGAOUFBgDmBQYA5wUGAOgFBgDpBQYA6gUGAOsFBgDsBQYA7QUGAO4FBgDvBQYA8AUGAPEFBgDyBQYA8wUGAPQFBgD1BQYA9gUGBIfZAcwAiAUGAIkFBgCKBQYAiwUGAIwFBgCNBQYAjgUGAI8FBgCQBQYAkQUGAJIFBgCTBQYAlAUGAJUFBgCWBQYAlwUGAJgFBgCZBQYAmgUGAJsFBgCcBQYAnQUGAJ4FBgCgBQYAoQUGAKIFBgCjBQYApAUGAKUFBgCmBQYApwUGAKgFBgCpBQYAqgUGAKsFBgCsBQYArQUGAK4FBgCvBQYAsAUGALEFBgCyBQYAswUGALQFBgC1BQYAtgUGALcFBgC5BQYAugUGALsFBgC8BQYAvQUGAL4FBgC/BQYAwAUGAMEFBgDCBQYAwwUGAMQFBgDFBQYAxgUGAMcFBgDIBQYAyQUGAMoFBgDLBQYAzAUGAM0FBgDOBQYAzwUGANAFBgDSBQYA0wUGANQFBgDVBQYA1gUGANcFBgDYBQYA2QUGANoFBgDbBQYA3AUGAN0FBgDeBQYA3wUGAOAFBgDhBQYA4gUGAOMFBgDkBQYA5QUGAOYFBgDnBQYA6AUGAOkFBgDrBQYA7AUGAO0FBgDuBQYA7wUGAPAFBgDxBQYA8gUGAPMFBgD0BQYA9QUGAPYFBgD3BQYA+AUGAPkFBgD6BQYA+wUGAPwFBgD9BQYA/gUGAP8FBgSA2kG+AIEFBgCCBQYAhAUGAIUFBgCGBQYAhwUGAIgFBgCJBQYAigUGAIsFBgCMBQYAjQUGAI4FBgCPBQYAkAUGAJEFBgCSBQYAkwUGAJQFBgCVBQYAlgUGAJcFBgCYBQYAmQUGAJoFBgCbBQYAnQUGAJ4FBgCfBQYAoAUGAKEFBgCiBQYAowUGAKQFBgClBQYApgUGAKcFBgCpBQYAqgUGAKsFBgCsBQYArQUGAK4FBgCvBQYAsAUGALEFBgCyBQYAswUGALQFBgC1BQYAtgUGALcFBgC4BQYAuQUGALoFBgC7BQYAvAUGAL0FBgC+BQYAvwUGAMAFBgDBBQYAwgUGAMMFBgDEBQYAxQUGAMYFBgDHBQYAyQUGAMoFBgDLBQYAzAUGAM0FBgDOBQYAzwUGANAFBgDRBQYA0gUGANMFBgDVBQYA1gUGANcFBgDYBQYA2QUGANoFBgDbBQYA3AUGAN0FBgDeBQYA3wUGAOAFBgDhBQYA4gUGAOMFBgDkBQYA5QUGAOYFBgDnBQYA6AUGAOkFBgDqBQYA6wUGAOwFBgDtBQYA7gUGAO8FBgDwBQYA8QUGAPIFBgDzBQYA9QUGAPYFBgD3BQYA+AUGAPkFBgD6BQYA+wUGAPwFBgD9BQYA/gUGAP8FBgSB20HcAIIFBgCDBQYAhAUGAIUFBgCGBQYAhwUGAIgFBgCJBQYAigUGAIsFBgCMBQYAjQUGAI4FBgCPBQYAkAUGAJEFBgCSBQYAkwUGAJQFBgCVBQYAlgUGAJcFBgCYBQYAmQUGAJoFBgCbBQYAnAUGAJ0FBgCeBQYAnwUGAKEFBgCiBQYAowUGAKQFBgClBQYApgUGAKcFBgCoBQYAqQUGAKoFBgCrBQYArQUGAK4FBgCvBQYAsAUGALEFBgCyBQYAswUGALQFBgC1BQYAtgUGALcFBgC4BQYAuQUGALoFBgC7BQYAvAUGAL0FBgC+BQYAvwUGAMAFBgDBBQYAwgUGAMMFBgDEBQYAxQUGAMYFBgDHBQYAyAUGAMkFBgDKBQYAywUGAM0FBgDOBQYAzwUGANAFBgDRBQYA0gUGANMFBgDUBQYA1QUGANYFBgDXBQYA2QUGANoFBgDbBQYA3AUGAN0FBgDeBQYA3wUGAOAFBgDhBQYA4gUGAOMFBgDkBQYA5QUGAOYFBgDnBQYA6AUGAOkFBgDqBQYA6wUGAOwFBgDtBQYA7gUGAO8FBgDwBQYA8QUGAPIFBgDzBQYA9AUGAPUFBgD2BQYA9wUGAPkFBgD6BQYA+wUGAPwFBgD9BQYA/gUGAP8FBgSA3EHcAIEFBgCCBQYAgwUGAIUFBgCGBQYAhwUGAIgFBgCJBQYAigUGAIsFBgCMBQYAjQUGAI4FBgCPBQYAkAUGAJEFBgCSBQYAkwUGAJQFBgCVBQYAlgUGAJcFBgCYBQYAmQUGAJoFBgCbBQYAnAUGAJ0FBgCeBQYAnwUGAKAFBgChBQYAogUGAKMFBgClBQYApgUGAKcFBgCoBQYAqQUGAKoFBgCrBQYArAUGAK0FBgCuBQYArwUGALAFBgCxBQYAsgUGALMFBgC5BQYE/98hMgST4AEGAJQFBgCVBQYAlgUGAJcFBgCYBQYAmQUGAJoFBgCbBQYAnAUGkJ3gaRIsCiRjYXB0aW9ucy0wLXNoYXBlc3R5bGUtT2JqZWN0IEMJHQQSBAG+DBIqCiJyLgAYVGl0bGUSBAHwNBIhChljaGFyYWN0ZXItCVRIaHlwZXJsaW5rEgQI1NdpEhwKFD4jADRudWxsEgQI09dpEh4KFgEeTHQtMC1jYXRlZ29yeWF4aXNfMBIE4S0MEhUKDRUgFGhhcnQSBOFcDBIWCg4FDygtMC1sZWdlbmQSBOFuDBIgChgRGCRwYXJhZ3JhcGhTAesFUQSp2m4iAAgxEgThcBHUAVw6RAAAMQGWBLPaciMAAUYAtHYjAAgyEgThl25pAAgzEgThtG4jAAg0EgTh0W4jAAg1EgTh7m4jAAg2EgQOCwhuIwAINxIEDigIbiMACDgSBA5FCG4jAAg5EgQOYghqogEhFwCrcjoBADIhgAC9diMAIYAAvnYjAAFpAL92IwAhgADAdiMAIYAAwXYjACGAAMJ2IwAhgADDdiMAIYAAxHYjACGAAMV2IwAhgADGcgADAfQArHIiAAHzAK1yIgAB8gCuciIAAfEAr3IiAAHwALByIgAB7wCxciIAAe4YstppEh8KF5EQLHJlZmVyZW5jZUxpbokPGMfaaRIYChARIRBzZXJpZYl6AKJSGgBBWwCjUhoAQVIApFIaACFVAKVSGgAhTQCmUhoAIUUYp9ppEhsKExGcEHZhbHVltRkAn14dAAGiBKDavVYAMUZWBQTN2r1WBDEtBWIEEgQOtgu5VgAxuVYAyi5oAQAxPhIFYZEA1XIiAAGTANYumwJCRAClVgDfdiMAAUYA4HYjACGEAOF2IwAhjQDidiMAIZYA43YjACGfAOR2IwBB5QDldiMAQeYA5nYjAEHnAOd2IwBB6ADocoABIRcA13JFAKVWAOl2IwAhgADqdiMAAWkA63YjACGAAOx2IwAhgADtdiMAIYAA7nYjACGAAO92IwAhgADwdiMAIYAA8XYjACGAAPJygAEB9ADYciIAAfMA2XIiAAHyANpyIgAB8QDbciIAAfAA3HIiAAHvAN1yIgAB7gTe2r1WADFKVgUA8y7UBAAxLlYFAM5SGgBBWwDPUhoAQVIA0FIaACFVANFSGgAhTQDSUhoAIUUA0y45BQAxOlYFAMteHQABogDMLlYFADJGVgUA+S5WBQAytVYE9dq9VgAyuVYA9i5oAQAyTlYFBIHbKiwJQiIAAZMEgtsqcQlGIgChmwCLdiMAAUYAjHYjACGEAI12IwAhjQCOdiMAIZYAj3YjACGfAJB2IwBB5QCRdiMAQeYAknYjAEHnAJN2IwBB6ACUcoABIRcAg3JFAKVWAJV2IwAhgACWdiMAAWkAl3YjACGAAJh2IwAhgACZdiMAIYAAmnYjACGAAJt2IwAhgACcdiMAIYAAnXYjACGAAJ5ygAEB9ACEciIAAfMAhXIiAAHyAIZyIgAB8QCHciIAAfAAiHIiAAHvAIlyIgAB7gSK271WADJKVgUEn9sqrAoAMi5WBQD6Lu4EFRpBWwD7UhoAQVIA/FIaACFVAP1SGgAhTQD+UhoAIUUA/y45BQAyOlYFAPdeHQABogD4LlYFADNGVgUEpdsqrAoAM7VWBKHbvVYAM7lWAKIuaAEAM05WBQCtciIAAZMAri6bAkJEAKVWALd2IwABRgC4diMAIYQAuXYjACGNALp2IwAhlgC7diMAIZ8AvHYjAEHlAL12IwBB5gC+diMAQecAv3YjAEHoAMBygAEhFwCvckUApVYAwXYjACGAAMJ2IwABaQDDdiMAIYAAxHYjACGAAMV2IwAhgADGdiMAIYAAx3YjACGAAMh2IwAhgADJdiMAIYAAynKAAQH0ALByIgAB8wCxciIAAfIAsnIiAAHxALNyIgAB8AC0ciIAAe8AtXIiAAHuALYuVgUAM0pWBQDLLlYFADMuVgUAplIaAEFbAKdSGgBBUgCoUhoAIVUAqVIaACFNAKpSGgAhRQSr2yoCEAAzOlYFAKNeHQABogSk2yoCEAA0RlYFANEuVgUANLVWAM0uVgUANLlWAM4uaAEANE5WBQDZciIAAZMA2i6bAkJEAKVWAON2IwABRgDkdiMAIYQA5XYjACGNAOZ2IwAhlgDndiMAIZ8A6HYjAEHlAOl2IwBB5gDqdiMAQecA63YjAEHoAOxygAEhFwDbckUApVYA7XYjACGAAO52IwABaQDvdiMAIYAA8HYjACGAAPF2IwAhgADydiMAIYAA83YjACGAAPR2IwAhgAD1diMAIYAA9nKAAQH0ANxyIgAB8wDdciIAAfIA3nIiAAHxAN9yIgAB8ADgciIAAe8A4XIiAAHuAOIuVgUANEpWBQD3LtQEADQuVgUA0lIaAEFbANNSGgBBUgDUUhoAIVUA1VIaACFNANZSGgAhRQDXLjkFADQ6VgUAz14dAAGiANAuVgUANUZWBQD9LlYFADW1VgD5LlYFADW5VgD6LmgBADVOVgUEhdwqAhBCIgABkwSG3CoCEEYiAA4CEACPdiMAAUYAkHYjACGEAJF2IwAhjQCSdiMAIZYAk3YjACGfAJR2IwBB5QCVdiMAQeYAlnYjAEHnAJd2IwBB6ACYcoABIRcAh3JFAKVWAJl2IwAhgACadiMAAWkAm3YjACGAAJx2IwAhgACddiMAIYAAnnYjACGAAJ92IwAhgACgdiMAIYAAoXYjACGAAKJygAEB9ACIciIAAfMAiXIiAAHyAIpyIgAB8QCLciIAAfAAjHIiAAHvAI1yIgAB7gSO3CoCEAA1SlYFBKPcKgIQADUuVgUA/i7uBBUaQVsA/1IaAEFSAIBSTgAhVQCBUhoAIU0AglIaACFFBIPcKqwKADU6VgUA+y5WBS4dAAGiBPzbFiIgEG9sdW1uGkIgFGRlZmF1bA6VGlC53GkSJgoeZHJhd2luZ2xpbmUtMC0dDhLbHwQSBA7hKhwSHQoVZXF1YQ7mIBgtMC1pbWFnFR8Yk+BpEhoKEgUUPhwABOjXHRwAMTY4AADpLhwAADI2HAAA6i4cAAAzNhwAAOsuHAAANDYcAADsLhwAADU2HAAY7ddpEhkKEQ3oJqghBBIEDlksFRsAMTYbAADcHTYAMjYbAADdHRsAMzYbAADeHRsANDYbAADfHRsANTYbAADgCb4MbW92aSFKBQgxhQDuLhwAADE2HAAA7y4cAAAyNhwAAPAuHAAAMzYcAADxLhwAADQ2HAAA8i4cAAA1NhwABPPXZU4iwCFCWgIAogk9JWQyFCMEEgQOoS1BLwkcOm0BAOIuOAA6bgEA4y4cADpvAQDkLhwAOnABAOUuHAA6cQFI5tdpEikKIXN0aWNreUNvbW1lbjKZIhZ0I+WlAPWWKwBh5ASW4JJWAGH1AJeWKwCBBgCYlisAoVQAmZYrAKE7AJqSKwDpJ5YrAAHXAJyWKwABgQ5CJQgiCho+gwFFH1H8APYWyyQYc3ZnaW1wbxI8JAUgJZ8EEgQOtiVBUwx0YWJsQW8FCBE8BIfZHRwAMTYcAACgLhwAADI2HAAAuS4cAAAzNhwAANIuHAAANDYcAADrLhwAADU2HAAEhNqlSQWgKENlbGwtMC1ib2R5EasYiNlpEiUKHS4fAABjGrYlKExldmVsMVJvdxIEDkAwcicAADIJJwCNek4AADMJJwCOeicAADQJJwCPeicAADUJJwiQ2Wkhzi7DACBmb290ZXJSb3cR5wCLRksAGGhlYWRlckPFpxEnAIpGSwAJJx1LAIlGJAAQbGFiZWwuLwEAkW4kAC0sAJJuJAAtKQCTbiQALSYAlG4kAC0jBJXZEgUoLiMBFHBpdm90QkEKFHVtbWFyeSkJDo0nFNlpEicKH24sACl4BJzZEogoQikAAEguWQEJXQ7MJwDZOogCADEyiAIAoT6hASboIi5ZAQCleicALVwApnonAC1fAKd6JwAtYgCoeicALWUAqT6JAQAxRogCAKRGSwBJYSl/UYgAo0ZLAAknXYgAokYkAEKIAgCqbiQALSwAq24kAC0pAKxuJAAtJgCtbiQALSMArj6IAgAxZogCALY+iAJGLABJiAC1PogCDSlWiAIAtz6IAgAyMogCALo+oQEmGiAuiAIAvnonAC1cAL96JwAtXwDAeicALWIAwXonAC1lAMI+iQEAMkaIAgC9RksASWE2iAIAvEZLAAknXYgAu0YkAEKIAgDDbiQALSwAxG4kAC0pAMVuJAAtJgDGbiQALSMAxz6IAgAyZogCAM8+iAJGLABJiADOPogCDSlWiAIA0D6IAgAzMogCANM+oQEmTB0uiAIA13onAC1cANh6JwAtXwDZeicALWIA2nonAC1lANs+iQEAM0aIAgDWRksASWE2iAIA1UZLAAknXYgA1EYkAEKIAgDcbiQALSwA3W4kAC0pAN5uJAAtJgDfbiQALSMA4D6IAgAzZogCAOg+iAJGLABJiADnPogCDSlWiAIA6T6IAgA0MogCAOw+oQEmfhouiAIA8HonAC1cAPF6JwAtXwDyeicALWIA83onAC1lAPQ+iQEANEaIAgDvRksASWE2iAIA7kZLAAknXYgA7UYkAEKIAgD1biQALSwA9m4kAC0pAPduJAAtJgD4biQALSMA+T6IAgA0ZogCBIHaOiAKRiwASYgEgNo6IAoNKVaIAgCCPqgMADUyiAIEhdo6gQwmsBcuiAIAiXonAC1cAIp6JwAtXwCLeicALWIAjHonAC1lBI3aOqgMADVGiAIAiEZLAElhNogCAIdGSwAJJ12IAIZGJABCiAIAjm4kAC0sAI9uJAAtKQCQbiQALSYAkW4kAC0jBJLaOqgMADVmiAIAmj6IAkYsAEmIAJk+iAINKVaIAgSb2hKhFCLWDAhUZXgOnxFCOwEEltl6KAAtPwCXfigALUMAmH4oAC1HAJl+KAAtSwCaTigAADFGyAAAr34oAA3IALB+KAANyACxfigADcgAsn4oAA3IALNOKAAAMkbIAADIfigADcgAyX4oAA3IAMp+KAANyADLfigADcgAzE4oAAAzRsgAAOF+KAANyADifigADcgA434oAA3IAOR+KAANyADlTigAADRGyAAA+n4oAA3IAPt+KAANyAD8figADcgA/X4oAA3IAP5OKAAANUbIAACTThAELigADcgAlH4oAA3IAJV+KAANyACWfigADcgAlxZxKYWwCE5hbQ6MFBKoFB5LEASb2RI7JBkgGv8WESAAtD4gABoDFxEgAM0+IAAaBxcRIADmPiAAGgsXESAA/z4gABoPFxEgAJjt+K1nCGlzdBJiFQwtTm9uDmcVGJnXaRIjChsNHwBwHgI6CSQeuDoAoxYcGAUlBDEtGUQQQnVsbGUOdhoAmha2Og0hHHRvY2VudHJ5BUUEEgQOsTsMEigKIAkeKs00BSAALcEnDGluZyAO3BoErtcdKiqhLzYqAA6OGwCvLioAKnUqNioADroXALAuKgAqSSU2KgAO4hYAsT0MADJC5wAcIEJpZxIECJsd6wAyQusABLHcFkcJIW4EMjA+UAEODxQF6AC3HZQEMjY+JwAAQxZdPAW+GL3XaRIuCiYJUQA5PioAITwUZXIgJiBGEpEVDBIECMAWVxcFMAAzHcQASQ7eGwwSBAicHb8AM0K/AASy3BZTCgG/ADNCqgEBZRBub3RlIOG0JBIECMLXaRIkChwJLkKuAQBMDrUVDBIECMMWZRkJJkKqAQUmDCBEYXIO/TwExNcdf0KrAQBUDgsYFkw9JUUAxS4uACrMISnZCS5lBgUuAMYuLgBCcwEuLgBBXwDHLi4AADc+dwEuLgBBYwDILi4AADhuLgBBZwDJLi4AQtMBLlwADiMaBMrXErIiJT8AND3RGExldHRlcmUOxz0AnT3UADRC1AEAsz3UADRCkwIubwAOZxoAyx2dADRCAgIuLgAOxx8AzB2dADUdnQxOdW1iDZ0EntcSlCMFwAA2HSMUSGFydmFyAb8En9cW6glBdUKZAQxTdWJ0Gj4/BKnXFuIWASgANx1KHERhc2gSBAigXY4AOB0fAE5Fsgxha2luYb8AoTksCGJveD7IHADnjekIb2MthcIALUlMJl8fIK/caSAAKgwKBBJpHwAEDm5AGDABOuABCgSSwUAElODFLRxkcm9wLWNhcEJfAAEgCBcKDwEgGR8OlSQIqdxpRhkAoTIAqk4ZAEHCAKtOGQBBrQCsThkAQZgArU4ZAEGDGK7caUJtCgQmu0GBkirxQDo2BpG/jSYYptxpEi8KJ4owAC3oDKXcaRYSV0EMEAjpDxYLUwz/ASoDDjNCEM4BCiwSkppBBCoEDk9TSFAOWpsBCgASVgodCAEdAAAAACUBBQAtAQUcNQAAgD9gAW0BBwAVAQUIGAAgARoYgEAyJwgCFQEjABgJLwU0TgUAAB0BNwQiNIJdACiAnUMdAACgQCABLQEyeDAAOAAqADIAOgBQDloqCAAQACIECgIIATIUDQAAgEABjQBAAVsEQCUBDww4AFIEIUUIWAA2AQcMEjAI5i0WLPICIggKBAoCCysYAQ0KEC8YASIKBRQALg7+UyAqA5nXaQo+Cg46t0KavgEtRQw5WrsBAaZoHQAAQEEqE0hlbHZldGljYU5ldWUtTGlnaHQ6dl8BKEABUABYAGAAaAB1IVcAfQEFKIABAaABAbABAcUBIRQQyAEB3QEBGAzgAQH1BRIs+AEAgAIAiAIBmAL/EQFIAaACAbACAcACAMgCANgCAfICH3p9AUT4AgBicAgCGgEsJQAAEEIoAT0BZRhAAUgAUABdAQskagBwAHgAigEKDQEOJfcAlQWAAJ0FjwClBQYArQUGHMoBANABAdgBAY4kD+ABAPgBAcICBA5DCTzIAgHYAgHgAgDoAgDwAgARARQMEgsI5y2pFJECCiMKBBJyCQAVhb8AMDKgBARuZS1pCARYAD4CABBlAAAAgAEFBQp6BQAAbQHDAG0B6AxtAACQAQUA2AEFFBBDbQAANAEFAFgBBQB8AQUMkENyDEFuQfsMAAAYAf4OAL4OAAAWEg1FeeIM/QEqAw4bRhDMAQoqEopORS0y/uAD/uAD/uADceAEpdxl4ASl3C7gAwDrmuADCD0KDG3gqUOebAUtRAg5WrV93wANMt8D/tkD/tkD/tkD/tkDOtkDABASoEcICgjlbdkULwonCgRMDrpHZtVHLWYUAVoCWAEQEsJHGUAIJAoijRhS8kcJOwAREtdHDAsIoifpDRD0AgoeEloESAkyEILxBMsCZd4AGsn6EIkuOT8lAQUALQEFcvoGAAGlA376BhgoADAUOBNNgXAAZaG/DHIAggGKawAAADJlB5ZrAKmODKIBALL+YgBeYgAkwAEB0AEA2AEA6MVzWJACAKACArACFLgCE8gCAOACAYjxBAEREkZJCAsIni2GEI8cChUSNmpJNX0E7xslfRQSrgQKB0Qamyk8hgEKC0ZpbGwgQ2VudGVyEuHsAADJcB6ZCAiAPxoBFqWUCIA/HSFYDgIIBD8iUhYAEC3NzMw+EjMIGUcAgAExIAAAOAFAAUoWCgE3LCBBFQAAcEEdAADwQRLDCCQSigEKD0RpcmVjDvgpFGFsIEtlee6NAA2NDAAAQD9mjQAAUgGNNAK/gL4VKLkRvx1HZEi/CY0MhQEKCiUWAFIORwjuiAANiAjNzEyGFQEEyEJF5TF4GAAAEoQBCgkFiAhMZWb+hwAJhwTMPWYPAS2cBMjCOocAKBq3BAoLTWVkaXVtCYkBlwxUb3AgEmUJYh4BENPRUj8VAQUyMwIBEToWAEEzhpcAAEBBMwTIQj0eDIsBChAlHkm8ECBIaWdoYo4AHGjFdD8VtDx4No4AShYADC1mZmZqNAItJQBIISUAtAGOBMhC/jQC/jQCSTQAIA2IYUkuFgEITG93YhUBYcwAFQEFMqMBARE6FgAOmwyeFQEIwh0AMRUgIrEECgpTb2Z0TSv+bgTabgQAMEE7AEgurQEhJf5uBE5uBACAniUBLo0A/m4ESm4EioMF/m4E/m4EXm4EACr+NAL+NAL+NAL+NAL+NAL+NAL+NAL+NALKNAIAMv7TCP7TCP7TCP7TCP7TCP7TCP7TCP7TCL7TCBA61AQKDRrTCBY+CP6cBkqcBgiamZmG9QkIQMEVDsASKgoLAKr+CgtSCgt21gg8WjYKFA0BAfBBFZEAIEId9CKXCzgUDTFcxj4VJigUvx1rtTcWIAsMHc3MTA4GFAQAAMW8DEVkZ2V6KgsI5g5mHlMIBPh/Dg4MEj8MShYAlioLAEgOKgsAoCE1GjsVEpMKBYhyKgtKcQAEIhROFgCahwAOBQouhwAAVQ47CQhaAGIWdA4Ohw4SHAoOPgl22RWWdA4IaAByDqYUIIA/hQEAACBBjQEGXEKQAQCgAQ2oAQzwAQ34AQCFAgAAwEDVBwF9DiEOABAST1cICgigGiEODH0KFhI6c1ciIQ4QYQoAEBESCwoAKsLCAJabFgAxErtXACsiLBYAyoJMEggKIBJiClgJuYYqEiTH/38/Jf//fz8tAQUuaBD+AxaCAxZmewAOAxYAbA4DFgAu/gMWUgMWCLgCARL/FQAAIv8VADESFVn+fAEtfAAx/nwB/nwB/nwB/nwBvnwBDm5aOXwAy4b4AgAhFr0TDoYmIsoaEjgeBF8xovkCgQVWggT++QKC+QJmewD++QLK+QIOyFv+fQExfaL6AmYCAf59Af59Af59AbZ9AQi12mn+fQE1fQAyRncEBPBB/h0Y/h0Ysh0Y/vMFuvMFALb+fQE9fQAzRn0BAED+fQH+fQH+fQH+fQFyfQEAt/59AT19ADT+fQH+fQH+fQH+fQG+fQEAuP59AT19ADVGfQEAIP76Av76Av76Av76AnL6AgC5/n0BPX0ANkZ9AVZ3BAQJ+hpbDgwtA/h//ucLtucLZnsA/u4Iyu4IALr+fQE9fQA3Rn0B/voC/voC/voC/voCdvoCALv+fQE9fQA4Rn0BVvoC/msK/msK/msK/msKHmsKALz+fQE9fQA5Rn0BBABC/msK/msK/msK/msKbmsKDvNnJmUN8toRSucLVvkCAAW18wAB/vMFvvMFZnsA/vMFyvMFDkxpOXzyXhAAMkpeEP7zBf7zBf7zBf7zBXbzBQ6mav59ATF9Sl4Q/n0B/n0B/n0B/n0Bdn0BDgBs/n0BMX1KdwT+XhD+XhD+XhD+XhB2XhAOWm3+fQExfUpeEP76Av76Av76Av76Anb6Ag60bv59ATF9Sl4Q/n0B/n0B/n0B/n0Bdn0BDg5w/n0BMX3+XhD+XhD+XhD+XhDCXhAOaHH+fQExff5eEP5eEP5eEP5eEMJeEA7Ccv59ATF9Sl4QVugLZkcd/kwZgkwZZnsA/ugLyugLDhx0/n0BMX1KXhD+9AX+9AX+9AX+9AV29AUOdnX+fQExfUpeEP59Af59Af59Af59AXZ9AQ7Rdjl98l4QSmoKVnYE/lcT/lcT/lcT/lcTHlcTDit4/nwBLXxKaQpWfAFmXxH+8gWC8gVmewD+8gXK8gUOhXn+fAEtfEpoClZ8Af74Av74Av74Av74AlH4AK8yTxbydASiZwpmbwj++AKC+AJmewD++ALK+AIOOXz++AJN+KJmCmb5A/58AYJ8AWZ7AP58Acp8AQ6Tff58AS18SmUK/nQE/nQE/nQE/nQEdnQEDu1+/nwBLXxKZApWfAFmfQL++AL++AL++AKu+AIEEQgOSIAICwimGiotEIMBCh8SXnaAFh0cEILxBF4KiistBOA/LsZDlu0tGBIAGA8gDxESw4AICwikDZUQiBkKGBJC6oAVjijhGAo2CiAKDggBEio6QgwKDggCBRAAwA7GQxAAABAAGgEeIEBAFc3MTL8qBA6oZAAS2jgACBoAIooBAQCAygEBxoQullkBADIWnUMcA6wnOiXRMyIO3DgAgDIuIgA6fiEAAEJ+IQAASn4hAABSfiEAAFp+IQAAYn4hAABqfiEAAHJ+IQAAen4hAASCAX4iAACKgiIARJABAZgBEKABBKgBBbABALgBAiJ6RTTQAQPYAQ7gAQboAQjyAYbQRgQAAg7QRgyAPyAKDnExFD8wATgA+qI3AAQAAB03BIICnm4AMjcAAIqiNwAMQEAgBRWlAJKONwAA9A4yOgVuCM3MDAXccJoCAKICAKoCALoCAMICAMoCANICANoCAOICAOoCaZQw4ZISPyUkghI/LW6CEjLkAg51NABALpUElsAxAPINWWYiDBI5PMZZAAD6DVlmlgNCWQCW7gMEggMpC3ZZADILAZZZAACKDVkUs4ISPyWyIWQAsf5kASlkAJINWXayADJkAZayAACaklkAygsBAKINWf4WAkIWAgCqDVlyCwE2yAKWCwEEsgOJumb6CAC6DSJmewAAwg0iAIEihCIAdTqEIgDKDSJmZgAA0oIiAJDaAwDgAwHoAwDwAwGABACIBACQBACYBACgBACoBAG1BP//f3+9BQYAxQUGAM0FBgDVBQYE2gRJ/KqjApY/AQDiDVlmHQHargMA6pJZAMqjAgDyDVn+CwFCCwEA+g1ZdgsByrIABIIFKb1yWQDO/AIEjQUOpjgMkAUVnQUJEKAFGaoFiu8GyYEaLU4APuFdALINohx5dE0+JVT5NEZKCQ5JRMr7AKC4BQjABQbQBQXYBQjgBQjoBQTwBQj4BQiABgiIBgSQBgCYBgCgBgCCCCkicncEztxHHMAJCcgJCqoKiSRmgQEkuAoFwAoFygoA4hoFDGYrAGEQygoBAPoNhGZkBByICwCYCwCtC4EIBLoLKRH+hwBChwAsyAsI4AsB7QuamRk+DlU6AJASekgEo9oOTk5ymgwazyQEgvH+mgz+mgz+mgz+mgyumgw0y8PBPiVTJ1k/LUgnWT4urzoamgxmIQAamgxmIQAamgxmIQAamgxmIQAamgxmIQAamgxmIQAamgxmIQAamgxmIQAamgxmIQAemgxmIgAAihqaDGYiAB6aDAAH/poM/poM/poM/poM/poM/poM/poM/poMFpoMZikCodzKjwsemgx2WQDKNQb+mgyCmgx2sgDKCwEemgx2WQDKCwH+mgyCmgxysgDOngmmmgxmewD+mgz+mgz+mgzumgwamgxmHQHargMemgx2WQDKowL+mgyCmgz+sgBCsgAemgxyWQDO/AL+mgxCmgwMXm3kPhKsUgwt8/9/MkoJ/poM/poM/poMEpoMZoEBQpoMZisAYRDKtwLWmgz+hwBChwBWmgwOw5l6"
-			+ "NBka7C/+mgz+mgz+mgz+mgy2mgxmPhEamgxmIQAamgxmIQAamgxmIQAamgxmIQAamgxmIQAamgxmIQAamgxmIQAamgxmIQAamgxmIQAemgxmIgAemgxmIgD+mgz+mgz+mgz+mgz+mgz+mgz+mgz+mgw6mgxmKQKh3MqPCx6aDHZZAMo1Bv6aDIKaDHayAMoLAR6aDHZZAMoLAf6aDIKaDHKyAM6eCaaaDGZ7AP6aDP6aDP6aDO6aDBqaDGYdAdquAx6aDHZZAMqjAv6aDIKaDP6yAEKyAB6aDHJZAM78Av6aDEKaDDDmtUU/JeW1RT8t5LVFPpof/jQZ/jQZ7jQZFjQZZoEBQpoMZisAYRDKtwLWmgz+hwBChwBWmgwOQ6Z6mgwanzD+mgz+mgz+mgz+mgy2mgwcyWB5PyWZCDsOhBw2bFUamgxmIQAamgxmIQAamgxmIQAamgxmIQAamgxmIQAamgxmIQAamgxmIQAamgxmIQAamgxmIQAemgxmIgAemgxmIgD+mgz+mgz+mgz+mgz+mgz+mgz+mgz+mgw6mgxmKQKh3MqPCx6aDHZZAMo1Bv6aDIKaDHayAMoLAR6aDHZZAMoLAf6aDIKaDHKyAM6eCaaaDGZ7AP6aDP6aDP6aDO6aDBqaDGYdAdquAx6aDHZZAMqjAv6aDIKaDP6yAEKyAB6aDHJZAM78Av6aDEKaDA4dJgwlAgBARkoJ/jQZ/jQZ/jQZEjQZZoEBQpoMZisAYRDKtwLWmgz+hwBChwBWmgwApobOJRq9O/6aDP6aDP6aDP6aDLaaDCCz8H8/JfDAFj4O8C8yBmIamgxmIQAamgxmIQAamgxmIQAamgxmIQAamgxmIQAamgxmIQAamgxmIQAamgxmIQAamgxmIQAemgxmIgAemgxmIgASmgwEGqBWziUAC/5oMv5oMv5oMv5oMv5oMv5oMv5oMsJoMmYpAqHcyo8LHpoMdlkAyjUG/poMgpoMdrIAygsBHpoMdlkAygsB/poMgpoMcrIAzp4JppoMZnsA/poM/poM/poM7poMGpoMZh0B2q4DHpoMdlkAyqMC/poMgpoM/rIAQrIAHpoMclkAzvwCHpoMABweaDIAHfpoMhKaDATzyUpKCf6aDP6aDO6aDAASHmgyZoEBQpoMZisAYRDKtwLWmgz+hwBChwBWmgwOQ796NBka20b+mgz+mgz+mgz+mgy2mgwwY1RUPyVvr8Q9LcTJ7TIeKRqaDGYhABqaDGYhABqaDGYhABqaDGYhABqaDGYhABqaDGYhABqaDDDV1FQ/JcHAwD0t7ezsMucAGpoMZkIAGpoMZiEAHpoMZiIAHpoMZiIAEpoMABBamgz+Aj/+Aj/+Aj/+Aj/+Aj/+Aj/+Aj/GAj9mKQKh3MqPCx6aDHZZAMo1Bv6aDIKaDHayAMoLAR6aDHZZAMoLAf6aDIKaDHKyAM6eCaaaDGZ7AP6aDP6aDP6aDO6aDBqaDGYdAdquAx6aDHZZAMqjAv6aDIKaDP6yAEKyAB6aDHJZAM78Ah6aDP4CPyICPxKaDBxXI+09LepYD/7OJf7OJf7OJSLOJSKaDGaBAUKaDGYrAGEQyrcC1poM/ocAQocAVpoMDsDLJgKJEOwCChsSTurLIp9LAMYOZkcEgD8aMksO9Yj+/4gy/4gMOBNADxI+jhI+kAh6AIr+m4hem4gOhY4UgD+qAQC6DWJyg0HOqgcEyAEOc48A8BLOjjiIAgCYAgCoAgO4AhPAAhQi+ogOIc2GfgEmg0D+fgF+fgEIFkAXwn4BzhwBAJ0SCZA9fnJJAs4BQxTIAQHgAQA2fgEYAbgCFsACGDV+AM0SMBxO/osmxKsW6c5V//7+i/7+i/7+i/7+i/7+i0r+iwDJJYZO/osAMRa6ujV9/v6L/v6L/v6L/v6L/v6L/v6L/v6L/v6L/v6L/v6L/v6L/v6L/v6L/v6L/v6L/v6L/v6L/v6L/v6L/v6L/v6L/v6L/v6L/v6L/v6L/v6L/v6L/v6L/v6L/v6L/v6L/v6L/v6L/v6L/v6L/v6L/v6L/v6L/v6L/v6L/v6L/v6L/v6L/v6L/v6L/v6L/v6L/v6L/v6L/v6L/v6L/v6L/v6L/v6L/v6L2v6LCMraaVb+ix4b3iIhDv7+i47+iw5j3tbeYCr1pRYGiRpXEP7+i/7+i/7+i/7+i6b+iw693/58AS18GlQT/nwB/nwB/nwB/nwBpnwBDhbhOXyuoHtC+AL+/ov+/ov+/ov+/ovG/osOcOL+fQExfaL6AmYSF/5UZYJUZWZ7AP5MaMpMaA7K4/59ATF9GrRLLncEAPD+h4f+h4f+h4f+h4dyh4cOJOX+fQExfRqXQC59AVZOaGZ/Av76Av76Av76Arb6AgDjMj5u9vQFGno1/n0Bxn0BAIAcAICABCgBAIACAIgCAZgC/xEBcAGgAgGwAgHAAgDIAgDYAgHyAh8KHQgBHQAAAAAlAQUALQEFHDUAAIA/YAFtAQdE+AIAYmwIAhoBLiUAABBCKAE9ASIYQAFIAFAAXQELJGoAcAB4AIoBCg0BDgAVAQUElQEBOgSdAQEMAKUFBgCtBQYcygEA0AEB2AEBjtAP4AEA+AEBuAIByAIB2AIA4AIA6AIA8AIAMQjk2mkSKwjmDxIDAQAFGMsCIggKBAoCCysYAQ0KEC8YASIKBRTwRi4QAxgBCiESGWNoYXJ0LTEtcGFyYWdyYXBoU3R5bGVfMTUqBAiF4GlQOVq1AQgAEAAdAAAgQSoNSGVsdmV0aWNhTmV1ZTodcgIBKEABUABYAGAAaAB1AdEAfQEFJIABAaABAbABAcUF6wzIAQHdBeIM4AEB9QUSAPj+fQH+fQHefQEA5f59AT19BDYqQn0BAEBSfQEQCfp/PyVBNBAtA/h/Py5/Av59AYJ9AWZ7AP76Asr6AgDm/n0BPX0AN0Z9AQAgUn0BQdBW/AP+fQGCfQFmewD+fQHKfQEA5/59AT19ADhGfQFW+gJmAgH+fQH+fQH+fQG2fQEA6P59AT19ADlGfQEIAEIq/vQF/vQF/vQF/vQFavQFANcyfQEEygLtZwArYnEHCCASGFpxBwAyRnwBVvkCAAW18wAB/vMFvvMFZnsA/nYEynYEAOkyfAHy7QgEMjBGfQH+8wX+8wX+8wX+8wV28wUA6v59AT19ADH+fQH+fQH+fQH+fQG+fQEA6/59AT19SncEAPD+7Qj+7Qj+7Qj+7Qhy7QgA7P59AT19ADP++gL++gL++gL++gK++gIA7f59AT19ADT+fQH+fQH+fQH+fQG+fQEA7v59AT19/l4Q/l4Q/l4Q/l4Qwl4QAO/+fQE9ff5eEP5eEP5eEP5eEMJeEADw/n0BPX1KXhBW6Askx/9/PyX//38/LQEF/tsRstsRZnsA/ugLyugLAPH+fQE9fUpeEP7oC/7oC/7oC/7oC3boCwDy/n0BPX1KXhD+fQH+fQH+fQH+fQF2fQEA2DJ9AfJeEEpqClZ2BP5XE/5XE/5XE/5XEx5XEwDZ/nwBOXxKaQpWfAFmXxH+0xSC0xRmewD+8gXK8gUA2v58ATl8SmgKVnwB/vgC/vgC/vgC/vgCUfgA2/58ATl8omcKZm8I/vgCgvgCZnsA/vgCyvgCANz+fAE5fKJmCmb5A/58AYJ8AWZ7AP58Acp8AQDd/nwBOXxKZQr+dAT+dAT+dAT+dAR2dAQA3v58ATl8SmQKVnwBZn0C/vgC/vgC/vgCrvgCJBEI89ppEgsIpicWMyIUgwEKHxIXHqIaNHJlZmVyZW5jZUxpbmVfGiQZFILxBF4KVnr8IhwVAADgPxgAIA4WIxSAQDInCAES3yIAGBYvHxI0H04FACASABgPIA8RCM4FlQCkDZUUiBkKGBIQEZUUc2VyaWVzHY4o4RgKNgogCg4IARIqSiMMCg4IAgUQBMBABXsIEAAaAR40QEAVzcxMvyoEbGluZRLaOAAIGgAiigEBAIDKAQEAKv5YAFpYAAAyFq0kHObYrD4lffpBRlMQADp+IQAAQn4hAABKfiEAAFJ+IQAAWn4hAABifiEAAGp+IQAAcn4hAAB6fiEABIIBfiIAAIqCIgBEkAEBmAEQoAEEqAEFsAEAuAECIg0lONABA9gBDuABBugBCPIBNIZnAwgCQx0O/yMEIAoOgCYUPzABOAD6ojcABAAAHTcEggKebgAyNwAAiqI3AAxAQCAFFaUAko43AAT0QhKXCxQgCi3NzAwF3HCaAgCiAgCqAgC6AgDCAgDKAgDSAgDaAgDiAgDqAmk8NOGSEj8lJIISPy1ughI/LjcTEBUAAEBALpUEAAKFGn6VBADyDVlmIgwAFSGCxlkAAPoNWWaWA0JZAJZHBQSCAykLdlkAMgsBllkAAIoNWRSzghI/JbIhZACx/mQBKWQAkg1ZdrIAMmQBlrIAAJqSWQDKCwEAog1Z/hYCQhYCAKoNWXILATbIApYLAQSyA4m6ZvoIALoNImZ7AADCDSIAgSKEIgB1OoQiAMoNImZmAADSgiIAkNoDAOADAegDAPADAYAEAIgEAJAEAJgEAKAEAKgEAbUE//9/f70FBgDFBQYAzQUGANUFBgTaBEn8LF6FEj8lPIASPy3UhpEHAAISmCtCBwSWPwEA4g1ZZh0B2q4DAOqSWQDKowIA8g1Z/gsBQgsBAPoNWXYLAcqyAASCBSm9clkAzvwCBI0FoaMMkAUVnQUJEKAFGaoFiu8GyYEcQCABLQAAgD7hXQCyDaIcpp8JPyVetFRGSgnBVMr7AKC4BQjABQTQBQXYBQjgBQjoBQTwBQj4BQiABgiIBgSQBgCYBgCgBgCCCCkicncEAADKKQUcwAkJyAkKqgqJJEKBAQAAHtYuJLgKBcAKBcoKAOIaBQxCKwAiAS9hEDIKAZZwBwD6DYRmZAQciAsAmAsArQuBCAS6CykRqocAlvADWMgLCOALAO0LmpkZPojxBAGQ8QQBEQjPhpoMGs8kBILx/poM/poM/poM/poMrpoMIAOsJzol0TMiP2FqMrYJGpoMZiEAGpoMZiEAGpoMZiEAGpoMZiEAGpoMZiEAAGJpN2YhABqaDGYhABqaDGYhABqaDGYhAB6aDGYiAACKGpoMZiIAHpoMAAf+mgz+mgz+mgz+mgz+mgz+mgz+mgz+mgwWmgxmKQKh3MpmBh6aDHZZADI1BpauBf6aDIKaDHayAMoLAR6aDHZZAMoLAf6aDIKaDHKyAM6eCaaaDGZ7AP6aDP6aDP6aDO6aDBqaDGYdAdquAx6aDHZZAMqjAv6aDIKaDP6yAEKyAB6aDHJZAM78Av6aDEKaDBx5dE0+JVT5NEZKCf6aDP6aDP6aDBKaDEKBAWaaDEIrAP6aDNaaDKqHAJbsBlaaDADQhpoMGuwv/poM/poM/poM/poMtpoMMOOStzQldsfsPi21qDpOmgxmIQAamgxmIQAamgxmIQAamgxmIQAamgxmIQAamgxmIQAamgxmIQAamgxmIQAamgxmIQAemgxmIgAemgxmIgD+mgz+mgz+mgz+mgz+mgz+mgz+mgz+mgw6mgxmKQLa7Agemgx2WQDK7Aj+mgyCmgx2sgDqmgx2WQDKCwH+mgyCmgxysgDOngmmmgxmewD+mgz+mgz+mgzumgwamgxmHQHargMemgx2WQDKowL+mgyCmgz+sgBCsgAemgxyWQDO/AL+mgxCmgwwce3pNCUN3RY/LejbbTJKCf6aDP6aDP6aDBKaDEKBAWaaDEIrAP6aDNaaDKqHAO6aDADRhpoMGp8w/poM/poM/poM/poMtpoMMCw2lDolCD2aPi0BAAAyUAMaNBlmIQAamgxmIQAamgxmIQAamgxmIQAamgxmIQAamgxmIQAamgxmIQAamgxmIQAamgxmIQAemgxmIgAemgxmIgD+mgz+mgz+mgz+mgz+mgz+mgz+mgz+mgw6mgxmKQLa7Agemgx2WQDK7Aj+mgyCmgx2sgDqmgx2WQDKCwH+mgyCmgxysgDOngmmmgxmewD+mgz+mgz+mgzumgwamgxmHQHargMemgx2WQDKowL+mgyCmgz+sgBCsgAemgxyWQDO/AL+mgxCmgwwCn/POiUL79c+LTQzMzJKCf6aDP6aDP6aDBKaDEKBAWaaDEIrAP6aDNaaDKqHAO6aDADShpoMGr07/poM/poM/poM/poMtpoMNMUk6DMlVqVSPi1yNcU+LoQvGpoMZiEAGpoMZiEAGpoMZiEAGpoMZiEAGpoMZiEAGpoMZiEAGpoMZiEAGpoMZiEAGpoMZiEAHpoMZiIAHpoMZiIAEpoMBBqgVs4lAAv+aDL+aDL+aDL+aDL+aDL+aDL+aDLCaDJmKQLa7Agemgx2WQDK7Aj+mgyCmgx2sgDqmgx2WQDKCwH+mgyCmgxysgAAQMqyAKaaDGZ7AP6aDP6aDP6aDO6aDBqaDGYdAdquAx6aDHZZAMrxAf6aDIKaDP6yAEKyAB6aDHJZAM78Ah6aDAAcHmgyAB36aDIwe1cwNCXyAqA+LezNFf6aDP6aDP6aDCKaDAASHmgyQoEBZpoMQisA/poM1poMqocA7poMANOGmgwa20b+mgz+mgz+mgz+mgy6mgwsero6JUdjvj0tJJ1bUpoMYiEAHpoMYiEAHpoMYiEAHpoMYiEAHpoMYiEAHpoMYiEAHpoMYiEAHpoMYiEAHpoMYiEAIpoMYiIAIpoMYiIAEpoMABBamgz+Aj/+Aj/+Aj/+Aj/+Aj/+Aj/+Aj/GAj9mKQLa7AgimgxiggIBWcrsCP6aDIaaDHKyAO6aDHJZAMoLAf6aDIaaDG6yAM6eCaqaDGJ7AP6aDP6aDP6aDP6aDA6aDGIdAWFVyqMCIpoMclkAyqMC/poMhpoM/rIAPrIAIpoMblkAzvwCHpoM/gI/IgI/MK8wNDslc/c3Pi34NNQySgn+NBn+NBnuNBkmmgw+gQFqmgw+KwD+mgzamgymhwDumgwAyxKaDACiGpxLFOwCChsSEx6cSxx2YWx1ZWF4aS6fSwDGDvY/BIA/GjJLEIkuOT8lAQUALQEFLhoY2jwEDDgTQA8STm8S3EMMegCKARYQQAFfYmkAziFBDpVvFIA/qgEAug1icoNBzgcFBMgBDgZvBPABDt5vRIgCAJgCAKgCA7gCE8ACFOACAQ6EQAgRCMySfgEAMRbbYASC8f5+AYJ+AQgWQBfCfgHOHAEAnRIccD1+/uABQuABFMgBAeABADZ+ARgBuAIWwAIYNX4A+TJ+ART0AgoeEhZJ/CQyLWNhdGVnb3J5Ov8CCMsCDQ57RAAaipYCzhgBGCgAMBQ4E01BjABlAWgIcgCCTZ/+IQFCIQEWnHIMogEAsv5iAF5iACTAAQHQAQDYAQDoEgRyMJACAKACArACFLgCE8gO6HJtBAD1JYYAno2CFI8cChUSDTWGDs5yVf4E7xslfXQSrgQKB0RlZmF1bHQShgEKC0ZpbGwgQ2VudGVyEhQmfnNx0wiAPxoBFgCAiZQSYE0SZHEAIlIWABQtzczMPjIBGwAAFsVzETEgAAA4AUABShYKARwsIEEVAABwQR0AAPBBEvtQTBKKAQoPRGlyZWN0aW9uYWwgS2V57o0ADY0MAABAP2aNAABSAY00Ar+AvhUouRG/HUdkSL8JjQyFAQoKJRYQUmlnaHTuiAANiAjNzEyGFQEEyEIOLAghMRpFdRAShAEKCQWICExlZv6HAAmHBMw9Zg8BLZwEyMI6hwAoGrcECgtNZWRpdW0JiQGXEFRvcCBMch4BENPRUj8VAQVRAgCAQTMBEToWAEEzhpcAAEBBMwDIFgRPKaYMiwEKECUeSbwQIEhpZ2hirAEcaMV0PxW0PHg2jgBKFgAMLWZmZmo0Ai0lAEghJQC0AY4EyEIJjv40Av40AgAgDYhhSS4WAQhMb3diFQGhJBJqCDKjAUoWABKqUII6AikVCMIdADEVICKxBAoKU29mdE0r/m4E2m4EADBBOwBILq0BISX+bgRObgQAgJ4lAS6NAP46Ako6AoqDBf5uBP5uBF5uBAAq/jQC/jQC/jQC/jQC/jQC/jQC/jQC/jQCyjQCADL+0wj+0wj+0wj+0wj+0wj+0wj+0wj+0wi+0wgQOtQECg0a0wgWPgj+nAZKnAYImpmZhvUJBEDBDoJTLgoLAKr+CgtSCgt21gg8WjYKFA0BAfBBFZEAIEId9CKXCzgUDTFcxj4VJigUvx1rtTcWIAsQHc3MTEAm9ggMRWRnZXoqCwjmDmYeaQgA+BqjfQQiFE4WAJYqCwBIDioLAKAhNS4qCwWIcioL/ocAPocADgUKLocAAFUOOwkIWgBiFt8ODocOJSYOPgkyDYESdAkuI1mWgxIIaAByDjeAIIA/hQEAACBBjQEGXEKQAQCgAQ2oAQzwAQ34AQCFAgAAwEDVBwF9DiURIBAI9tppEgoIoBohDhB9ChYSDhIYDiAtMi1sZWdlbmQiIQ4QYQoAEBESCwrGel0O2BIAAII+WgwxCIHbLpWBrsZpADI+lYEag18AUCqUgVbeYGbXZP7eYILeYGZ7AP7WY8rWYwCC/nwBOXwaVBP+fAH+fAH+fAH+fAGmfAEAizJ8Aa6ge0L4AgAxovkCgQVWggT++QKC+QJmewD++QLK+QIAjP59AT19ovoCZgIB/n0B/n0B/n0Btn0BAI3+fQE9fRq0Sy53BADw/qB7/qB7/qB7/qB7cqB7AI7+fQE9fRqXQC59AVZwB/76Av76Av76Av76AlH6AI/+fQE9fQA0FqYJ/n0B/n0B/n0B/n0Bpn0BAJD+fQE9fRpdKi59Af6sdf6sdf6sdf6sdXasdQCR/n0BPX2iOXFmg4v+cQeCcQdmewD+7gjK7ggAkv59AT19Sjpx/voC/voC/voC/voCdvoCAJP+fQE9ff47cf47cf47cf47ccI7cQCU/n0BPX1KPHH+/ov+/ov+/ov+/ot2/osAgzJ9AfLaEUrnC1ZqCmZYaf7zBYLzBWZ7AP7zBcrzBQCVMnwB8l4Q/v6L/v6L/v6L/v6Lxv6LAJb+fQE9fUpeEP5wB/5wB/5wB/5wB3ZwBwCX/n0BPX1KdwT+XhD+XhD+XhD+XhB2XhAAmP59AT19Sl4Q/voC/voC/voC/voCdvoCAJn+fQE9fUpeEP59Af59Af59Af59AXZ9AQCa/n0BPX3+XhD+XhD+XhD+XhDCXhAAm/59AT19/l4Q/l4Q/l4Q/l4Qwl4QAJz+fQE9fUpeEFboC2ZHHf7oC4LoC2Z7AP7oC8roCwCd/n0BPX1KXhD+9AX+9AX+9AX+9AV29AUAnv59AT19Sl4Q/n0B/n0B/n0B/n0Bdn0BAIQyfQHyXhBKagpWdgT+yBr+yBr+yBr+yBoeyBoAhf58ATl8SmkKVnwBZl8R/vIFgvIFZnsA/vIFyvIFAIb+fAE5fEpoClZ8Af74Av74Av74Av74AlH4AIf+fAE5fKJnCmZvCP74AoL4AmZ7AP74Asr4AgCI/nwBOXyiZgpm+QP+fAGCfAFmewD+fAHKfAEAif58ATl8SmUK/nQE/nQE/nQE/nQEdnQEAIr+fAE5fEpkClZ8AWZ9Av74Av74Av74Aq74AgwRCJ/bXv6LADL+/ovm/osA+hLgOx7+iwTpGCb+iwAyRv6LAML+/ov+/ov+/ov+/oum/oswy8PBPiVTJ1k/LUgnWTKyQxqWWWYhABr8TGYhABr8TGYhABr8TGYhABr8TGYhABr8TGYhABr8TGYhABr8TGYhABr8TGYhAB78TGYiAB78TGYiAB78TP7+i+r+ixbYhA5ZiwQAABY1jP7+i/7+i/7+i/7+i/7+i+b+i2YpAto0Mx78THZZAABAxo0z/vxMgvxMdrIAyj80HmR/dlkAygsB/vxMgvxMcrIAzgBKpvxMZnsA/vxM/vxMpvxMqqGOlok2Hv6LZh0B2q4DHvxMdlkAyqMCHvxM/gsBQgsBHv6L/rIAQrIAHvxMclkAzvwC/vxMQvxMDF5t5D4SEkYMLfP/fzJKCQ5JRMqtAf7+i/7+ix7+iwAAQt+Lco0BzpgC1t+L/ocAQocAVkV/APuGewwasCQEgvH+ewz+ewz+ewz+ewyuewwwII2GNCXq8fc+LZyi7TIxAxp7DGYhABp7DGYhABp7DGYhABp7DGYhABp7DGYhABp7DGYhABp7DGYhABp7DGYhABp7DGYhAB57DGYiAB57DGYiAB57DP7fi+rfi/57DP57DP57DP57DP57DP57DC57DGYpAtrNCB57DHZZAMogB/57DIJ7DHayAOp7DHZZAMoLAf57DIJ7DHKyAM5/CaZ7DGZ7AP57DP57DP57DO57DBp7DGYdAdquAx57DHZZAMqjAv57DIJ7DP6yAEKyAB57DHJZAM78Av57DEJ7DDDJHr40JSgsLz8tf+MnPkFX/nsM/nsM/nsMNnsMco0BzpgC1nsM/ocAQocAVnsMAPyGewwari/+ewz+ewz+ewz+ewy2eww0f43nPSXgmTE/LZYV4ToucloaewxmIQAaewxmIQAaewxmIQAaewxmIQAaewxmIQAaewxmIQAaewxmIQAaewxmIQAaewxmIQAeewxmIgAeewxmIgD+ewz+ewz+ewz+ewz+ewz+ewz+ewz+eww6ewxmKQLazQgeewx2WQDKzQj+ewyCewx2sgDqewx2WQDKCwH+ewyCewxysgDOfwmmewxmewD+ewz+ewz+ewzuewwaewxmHQHargMeewx2WQDKowL+ewyCewz+sgBCsgAeewxyWQDO/AL+ewxCeww0MycVPiUTzWQ/LY/8EDsuSgn+9hj+9hj+9hhC9hhyjQHOmALWewz+hwBChwBWewwA/YZ7DBpCMP57DP57DP57DP57DLZ7DDBFi7Q9JdWkZz8tf9lPMqwPGnsMZiEAGnsMZiEAGnsMZiEAGnsMZiEAGnsMZiEAGnsMZiEAGnsMZiEAGnsMZiEAGnsMZiEAHnsMZiIAHnsMZiIA/nsM/nsM/nsM/nsM/nsM/nsM/nsM/nsMOnsMZikC2s0IHnsMdlkAys0I/nsMgnsMdrIA6nsMdlkAygsB/nsMgnsMcrIAzn8JpnsMZnsA/nsM/nsM/nsM7nsMGnsMZh0B2q4DHnsMdlkAyqMC/nsMgnsM/rIAQrIAHnsMclkAzvwC/nsMQnsMDPuGxz0WcSUIMbRlMkoJ/nsM/nsM/nsMQnsMco0BzpgC1nsM/ocAQocAVnsMAP6GewwaQTv+ewz+ewz+ewz+ewy2ewww9felOyU/suI+LT2h4072GGYhABp7DGYhABp7DGYhABp7DGYhABp7DGYhABp7DGYhABp7DGYhABp7DGYhABp7DGYhAB57DGYiAB57DGYiABJ7DP6Ci/aCi/5xJf5xJf5xJf5xJf5xJf5xJS5xJWYpAtrNCB57DHZZAMrNCP57DIJ7DHayAOp7DHZZAMoLAf57DIJ7DHKyAM5/CaZ7DGZ7AP57DP57DP57DO57DBp7DGYdAdquAx57DHZZAMqjAv57DIJ7DP6yAEKyAB57DHJZAM78Ah57DP6CiyKCizAC8PA7JVOMJD8tzDkl/vYY/vYY/vYYIvYYBBKqSuwxco0BzpgC1nsM/ocAQocAVnsMAP+GewwaQEb+ewz+ewz+ewz+ewy2ewww8+OpNCWT2ig/LZuCHTKsDxr2GGYhABp7DGYhABp7DGYhABp7DGYhABp7DGYhABp7DGYhABp7DGYhABp7DGYhABp7DGYhAB57DGYiAB57DGYiABJ7DP5ji/Zji/57DP57DP57DP57DP57DP57DC57DGYpAtrNCB57DHZZAMrNCP57DIJ7DHayAOp7DHZZAMoLAf57DIJ7DHKyAM5/CaZ7DGZ7AP57DP57DP57DO57DBp7DGYdAdquAx57DHZZAMqjAv57DIJ7DP6yAEKyAB57DHJZAM78Ah57DP5jiyJjizCeZ900JcYNXD8tQ0VNMkoJ/vYY/vYY7vYYUnsMco0BzpgC1nsM/ocAQocAVnsMAPcSewxORIsAMv5Ei/5Ei/5Ei/5Ei/5Ei4pEiwD4kn4BADEWf3D+RIv+RIv+RIv+RIv+RItCRIsApRJzTlH8APQqRIsAM/5Ei/5Ei/5Ei/5Ei/5Ei6pEiwChJYZORIsEMy0SLH1V/v5Ei/5Ei/5Ei85EiwBfGwCAgAQoAEA/MhQNAAAAABUBBRQdAACAPyUBClg4AUABUhYKFA0Cv4C+FSi5Eb8dR2RIvwUcPBKFAQoKRmlsbCBSaWdodBI2QQAIAAAlAUYAGgEWCIA/FQEMEVcIgD8iUhYAEC3NzEw+ZogAAEoBiAwAAMhCEaQFYxgAABKEAQoJBYgITGVm/ocACYcEzD2GhwAAwjqHACgatwQKC01lZGl1bQmJAZcQVG9wIExyHgEQ09FSPxUBBTIeAQEROhYABC3NjpcACEBBFSEjAB0hvSmmDIsBChAlHihDZW50ZXIgSGlnaGKsARxoxXQ/FbQ8eDaOAEoWAAwtZmZmajQCLawASCElALQBjgTIQgmO/jQC/jQCACANiAyKAQoPLhYBCExvd2IVAUG8lsECCAAAAJ4VAQTCHSGoJRUgIrEECgpTb2Z0TSsMhgEKCx2c7pgADZgIzczMhlkDADBBOwBILq0BISU4RGlyZWN0aW9uYWwgS2V57o0ADY0hT4JfA/46ApI6AooVAf5uBP5uBF5uBAAq/jQC/jQC/jQC/jQC/jQC/jQC/jQC/jQCyjQCLDKuBAoHRGVmYXVsdP5lBN5lBAAggWUYcEEdAADwQYX9/mUEYmUE/tMI/tMI/tMI/tMI7tMIGtMIEDrUBAoNGtMIFj4I/jcCSjcCCJqZmYacBhRAwRUAAEAuNwIIqgEK/pwGSpwGdtYIPFo2ChQNAQHwQRWRACBCHfRVxDgUDTFcxj4VJigUvx1rtTcWIAsQHc3MTEBJ5A72CAxFZGdleioLCOYOZh5pCAT4fw6BCxIqC0oWAJYqCwBIDioLAKAhNS4qCwWIcioLSnEABCIUThYAmocADgUKLocAAFUOAggcWgBiVgodCAEmqgoOPgkEADUBHAhgAW0BBxJ0CQgYACABGhSAQDInCAEScwsAGBbZCiVaTgUAEGgAcgB9AUAYhQEAACBBjQEGXEKQAQCgAQ2oAQzwAQ34AQCFAgAAwEDVBw4nC9CI8QQBEAii22kSCgigJxIDAQAFGH0KFhIOY2hhcnQtMy1sZWdlbmQqBAiF4GmC8QRhCgAQERKuCwAqwsIAAAKSwgAkMQit22kSKwjmDwmOLMoCIggKBAoCCysYAQ0KEC8YASIKBRQgLhADGAEKIBIYEa88cGFyYWdyYXBoU3R5bGVfMAm5HFA5WrUBCAAQDt0NREBBKg1IZWx2ZXRpY2FOZXVlOiGJJMf/fz8l//9/Py0BBS6JAShAAVAAWABgAGgAdSExAH0BBSiAAQGgAQGwAQHFASFsEMgBAd0BARgM4AEB9QUSLPgBAIACAIgCAZgC/xEBSAGgAgGwAgHAAgDIAgDYAgHyAh9FBGZ7AET4AgBibAgCGgEuJQAAEEIoAT0BZRhAAUgAUABdAQsgagBwAHgAigEKJr8OAJUFgACdBY8ApQUGAK0FBhzKAQDQAQHYAQGObA/gAQD4AQG4AgHIAgHYAgDgAgDoAgDwAgAxCK7+fAE5fAAx/nwB/nwB/nwB/nwBvnwBALcyfAEAy4b4AgghEhla+AIAMaL5AkFHhUlCggT++QKC+QJmewD++QLK+QIAuP59AT19ovoCZgIB/n0B/n0B/n0Btn0BALn+fQE9fQAyRncEAPBS8wX+fQH+fQH+fQH+fQExfQC6/n0BPX0AM0Z9AVZwB/59Af59Af59Af59ATF9ALv+fQE9fQA0/n0B/n0B/n0B/n0Bvn0BALz+fQE9fQA1Rn0BACD+dwT+dwT+dwT+dwRydwQAvf59AT19ADZGfQFWdwQECfoaWw4MLQP4f/7nC7bnC2Z7AP7uCMruCAC+/n0BPX0AN0Z9Af76Av76Av76Av76Anb6AgC//n0BPX0AOEZ9AVb6Av5xB/5xB/5xB/5xB/FxAMD+fQE9fQA5Rn0BBABCTl4Q/n0B/n0B/n0B/n0BMX0ArzJ9AfLaEUrnC1b5AgAFtfMAAf7zBb7zBWZ7AP7zBcrzBQDBMnwB8l4QADJKXhD+8wX+8wX+8wX+8wV28wUAwv59AT19Sl4Q/n0B/n0B/n0B/n0Bdn0BAMP+fQE9fUp3BP5eEP5eEP5eEP5eEHZeEADE/n0BPX1KXhD++gL++gL++gL++gJ2+gIAxf59AT19Sl4Q/n0B/n0B/n0B/n0Bdn0BAMb+fQE9ff5eEP5eEP5eEP5eEMJeEADH/n0BPX3+XhD+XhD+XhD+XhDCXhAAyP59AT19Sl4QVugLZkcd/kwZgkwZZnsA/ugLyugLAMn+fQE9fUpeEP70Bf70Bf70Bf70BXb0BQDK/n0BPX1KXhD+fQH+fQH+fQH+fQF2fQEAsDJ9AfJeEEpqClZ2BP7aEf7aEf7aEf7aER7aEQCx/nwBOXxKaQpWfAFmXxH+8gWC8gVmewD+8gXK8gUAsv58ATl8SmgKVnwB/vgC/vgC/vgC/vgCUfgAs/58ATl8omcKZm8I/vgCgvgCZnsA/vgCyvgCALT+fAE5fKJmCmb5A/58AYJ8AWZ7AP58Acp8AQC1/nwBOXxKZQr+dAT+dAT+dAT+dAR2dAQAtv58ATl8SmQKVnwBZn0C/vgC/vgC/vgCrvgCIBEIy9tpEgsIphoqLRSDAQofEhcehCkscmVmZXJlbmNlTGluInssEILxBF4KiistAODK7S0gEgAYDyAPEQimBZUApA2VFIgZChgSEBGVFHNlcmllcx4JLTSC8QThGAo2CiAKDggBEio3LAwKDggCBRAEwEASpi0IEAAaAR40QEAVzcxMvyoEbGluZRLaOAAIGgAiigEBAIDKAQHGhC6WRi8AMhaaLSDJYHk/JZkIOz9CHCsAOn4hAABCfiEAAEp+IQAAUn4hAABafiEAAGJ+IQAAan4hAAByfiEAAHp+IQAEggF+IgAAioIiAESQAQGYARCgAQSoAQWwAQC4AQIidy840AED2AEO4AEG6AEI8gE0ElAvZpsKEBUAAAJDEr0wBCAKIdMUPzABOAD6ojcABAAAHTcEggKebgAyNwAAiqI3AAxAQCAFFaUAko43AAD0Dr86BW4IzcwMBdxwmgIAogIAqgIAugIAwgIAygIA0gIA2gIA4gIA6gJplDDhkhI/JSSCEj8tboISMhIlDnU0AEAugjKWwDEA8g1ZcocBNu0DllkAAPoNWWaWA9o0MwSCAykLdlkAMgsBlkcEAIoNWRSzghI/JbIhZACx/mQBKWQAkg1ZdrIAylEFAJqSWQDKCwEAog1Z/hYCQhYCAKoNWXILATbIApa9AQSyA4m6ZvoIALoNImZ7AADCDSIAgSKEIgB1OoQiAMoNImZmAADSgiIAkNoDAOADAegDAPADAYAEAIgEAJAEAJgEAKAEAKgEAbUE//9/f70FBgDFBQYAzQUGANUFBgTaBEn8qqMClj8BAOINWWYdAdquAwDqklkAyqMCAPINWf4LAUILAQD6DVl2CwHKsgAEggUpvXJZAM78AgSNBQ7XNgyQBRWdBQkQoAUZqgWK7wbJgQhAIAEO50AAPuFdALINogFPDCUCAEBGSgkObgrK+wCguAUIwAUE0AUF2AUI4AUI6AUE8AUI+AUIgAYIiAYEkAYAmAYAoAYAgggpInJ3BAAAyikFHMAJCcgJCqoKiSRmgQEkuAoFwAoFygoA4hoFDGYrAGEQygoBAPoNhGZkBByICwCYCwCtC4EIBLoLKRH+hwBChwAsyAsI4AsB7QuamRk+DlU6GJDxBAERCKeGmgwazyT+mgz+mgz+mgz+mgy2mgxlUAiN5BNGUAMamgxmIQAamgxmIQAamgxmIQAamgxmIQAamgxmIQAamgxmIQAamgxmIQAamgxmIQAamgxmIQAemgxmIgAAihqaDGYiAB6aDAAH"
-			+ "/poM/poM/poM/poM/poM/poM/poM/poMFpoMZikCodzKZgYemgx2WQDKNQb+mgyCmgx2sgDKCwEemgx2WQDKCwH+mgyCmgxysgDOngmmmgxmewD+mgz+mgz+mgzumgwamgxmHQHargMemgx2WQDKowL+mgyCmgz+sgBCsgAemgxyWQDO/AL+mgxWmgwIpIMpFtBFLvlD/poM/poM/poMEpoMZoEBQpoMZisAYRDKtwLWmgz+hwBChwBWmgwAqIaaDBrsL/6aDP6aDP6aDP6aDMqaDAy28qc+DrwWMtJILpoMUiEALpoMUiEALpoMUiEALpoMUiEALpoMUiEALpoMUiEALpoMUiEALpoMUiEALpoMUiEAMpoMUiIAMpoMUiIA/poM/poM/poM/poM/poM/poM/poM/poMTpoMUikCodzKjwsymgxiWQDKNQb+mgyWmgxisgDKCwEymgxiWQDKCwH+mgyWmgxesgDOngm6mgxSewD+mgz+mgz+mgz+mgwemgxSHQHargMymgxiWQDKowL+mgyWmgz+sgAusgAymgxeWQDO/AL+mgxWmgwMK8LsPhJqUv6aDP6aDP6aDFaaDFKBAVaaDFIrAGEQyrcC6poM/ocALocAVpoMAKmGmgwanzD+mgz+mgz+mgz+mgy2mgw0x59uPyXEEAo+LYKwPj0uUAMamgxmIQAamgxmIQAamgxmIQAamgxmIQAamgxmIQAamgxmIQAamgxmIQAamgxmIQAamgxmIQAemgxmIgAemgxmIgD+mgz+mgz+mgz+mgz+mgz+mgz+mgz+mgw6mgxmKQKh3MqPCx6aDHZZAMo1Bv6aDIKaDHayAMoLAR6aDHZZAMoLAf6aDIKaDHKyAM6eCaaaDGZ7AP6aDP6aDP6aDO6aDBqaDGYdAdquAx6aDHZZAMqjAv6aDIKaDP6yAEKyAB6aDHJZAM78Av6aDFaaDBx2HhQ+LS2TTDJKCf40Gf40Gf40GRI0GWaBAUKaDGYrAGEQyrcC1poM/ocAQocAVpoMAKqGmgwavTv+mgz+mgz+mgz+mgy2mgw0L041PyULCbs9LVK4zjJKmgxmIQAamgxmIQAamgxmIQAamgxmIQAamgxmIQAamgxmIQAamgxmIQAamgxmIQAamgxmIQAemgxmIgAemgxmIgASmgwEGqBWziUAC/5oMv5oMv5oMv5oMv5oMv5oMv5oMsJoMmYpAqHcyo8LHpoMdlkAyjUG/poMgpoMdrIAygsBHpoMdlkAygsB/poMgpoMcrIAzp4JppoMZnsA/poM/poM/poM7poMGpoMZh0B2q4DHpoMdlkAyqMC/poMgpoM/rIAQrIAHpoMclkAzvwCHpoMABweaDIAHfpoMjRigWg/JXva7z0taowEMy5KCf6aDP6aDO6aDAASHmgyZoEBQpoMZisAYRDKtwLWmgz+hwBChwBWmgwAq4aaDBrbRv6aDP6aDP6aDP6aDLaaDCBknwk/JYIScD1eziVmIQAamgxmIQAamgxmIQAamgxmIQAamgxmIQAamgxmIQAamgxmIQAamgxmIQAamgxmIQAemgxmIgAemgxmIgASmgwAEFqaDP4CP/4CP/4CP/4CP/4CP/4CP/4CP8YCP2YpAqHcyo8LHpoMdlkAyjUG/poMgpoMdrIAygsBHpoMdlkAygsB/poMgpoMcrIAzp4JppoMZnsA/poM/poM/poM7poMGpoMZh0B2q4DHpoMdlkAyqMC/poMgpoM/rIAQrIAHpoMclkAzvwCHpoM/gI/IgI/HJfSPD8lhLGkRkoJ/poM/poM/poMEpoMZoEBQpoMZisAYRDKtwLWmgz+hwBChwBWmgwAoxKaDACiGpxLFOwCChsSEx6cSxx2YWx1ZWF4aS6fSwDGDg1HBIA/GjJLEIkuOT8lAQUALQEFOtAOzt8GDDgTQA8SO3gSZXoMegCKARYQQAFfYmkAziFBDoJ4FIA/qgEAug1icoNBzssABMgBDnB5APASy3hEiAIAmAIAqAIDuAITwAIU4AIBDoRACBEIpJJ+ASaDQP5+AX5+AQgWQBfCfgHOHAEAnRIGej1+/uABQuABFMgBAeABADZ+ARgBuAIWwAIYNX4A0TJ+ART0AgoeEhZJ/CQ0LWNhdGVnb3J5Ov8CBMsCEnKGABqKlgLOGAEYKAAwFDgTTUGMAGUOaTYIcgCCTZ/+IQFCIQEWiXsMogEAsv5iAF5iACTAAQHQAQDYAQDoEm58MJACAKACArACFLgCE8gO1XttBADNJYYAno2CFI8cChUSDTWGDuZ9FsZsEILxBO8bJX0AEv4rg/4rg/4rg/4rg/4rg/4rg/4rg/4rg74rg/7+i/7+i/7+i/7+i/7+i/7+i/7+i/7+i/7+i/7+i/7+i/7+i/7+i/7+i/7+i/7+i/7+i/7+i/7+i/7+i/7+i/7+i/7+i/7+i/7+i/7+i/7+i/7+i/7+i/7+i/7+i/7+i/7+i/7+i/7+i/7+i/7+i/7+i/7+i/7+i/7+i/7+i/7+i/7+i/7+i/7+i/r+iwDOXv6LADT+/ovO/osA2eLeYAA0/v6L/v6L/v6L/v6L7v6LEv6LANr+fAE5fBpUE/56jf56jf56jf56jaZ6jQDjMnwBrqB7QvgC/v6L/v6L/v6L/v6Lxv6LAOT+fQE9faL6Ag6GFP57jf57jf57jf57jQ57jQDl/n0BPX0atEsudwQA8P6Hh/6Hh/6Hh/6Hh3KHhwDm/n0BPX0al0AufQFWTmj++gL++gL++gL++gJR+gDn/n0BPX0ANBbHF/59Af59Af59Af59AaZ9AQDo/n0BPX0aXSoufQH+rHX+rHX+rHX+rHV2rHUA6f59AT19ojlxZoOL/sVsgsVsZnsA/r1vyr1vAOr+fQE9fUo6cf76Av76Av76Av76Anb6AgDr/n0BPX3+O3H+O3H+O3H+O3HCO3EA7P59AT19Sjxx/v6L/v6L/v6L/v6Ldv6LANsyfQGuoHtC4g5K5wtWagpmWGn+8wWC8wVmewD+8wXK8wUA7TJ8AfJeEP7+i/7+i/7+i/7+i8b+iwDu/n0BPX1KXhD+cAf+cAf+cAf+cAd2cAcA7/59AT19SncE/l4Q/l4Q/l4Q/l4Qdl4QAPD+fQE9fUpeEP76Av76Av76Av76Anb6AgDx/n0BPX1KXhD+fQH+fQH+fQH+fQF2fQEA8v59AT19/l4Q/l4Q/l4Q/l4Qwl4QAPP+fQE9ff5eEP5eEP5eEP5eEMJeEAD0/n0BPX1KXhBW6AtmmYL+6AuC6AtmewD+6AvK6AsA9f59AT19Sl4Q/vQF/vQF/vQF/vQFdvQFAPb+fQE9fUpeEP59Af59Af59Af59AXZ9AQDcMn0B8l4QSmoKVnYE/sga/sga/sga/sgaHsgaAN3+fAE5fEppClZ8AWZfEf7yBYLyBWZ7AP7yBcryBQDe/nwBOXxKaApWfAH++AL++AL++AL++AJR+ADf/nwBOXyiZwpmbwj++AKC+AJmewD++ALK+AIA4P58ATl8omYKZvkD/nwBgnwBZnsA/nwBynwBAOH+fAE5fEplCv50BP50BP50BP50BHZ0BADi/nwBOXxKZApWfAFmfQL++AL++AL++AKu+AIIEQj3Eks7Tv6LADT+/ovm/osA0gWVTv6LADT+/ov+/ov+/ov+/ovy/oswnx1MPyXKNSY+LeIu9zKAaRowZmYhABr8TGYhABr8TGYhABr8TGYhABr8TGYhABr8TGYhABr8TGYhABr8TGYhABr8TGYhAB78TGYiAB78TGYiAB78TP7+i/7+i/7+i/7+i/7+i/7+i/7+i/7+ixr+i2YpAg4+RsrxSx78THZZAMqXRv78TIL8THayAMoLAR78THZZAMoLAf78TIL8THKyAM4ASqb8TGZ7AP78TP78TP78TO78TBr8TGYdAdquAx78THZZAMqjAv78TIL8TP6yAEKyAB78THJZAM78Av78TEL8TDDSUH8/JebmTz4t0pcaPsZK/v6L/v6L7v6LFv6LQoEBAAAexcVC/ExCKwAAgBErYRAytwIOCEwAAILwxdb8TKqHAJbujxL8TAAAPv6LANOGmgwazyT+lln+lln+lln+llm2llkwVK0DPyVLl4E+LagNETJQAxqaDGYhABqaDGYhABqaDGYhABqaDGYhABqaDGYhABqaDGYhABqaDGYhABqaDGYhABqaDGYhAB6aDGYiAB6aDGYiAB6aDP7+i/7+i/7+i/7+i/7+i/7+i/7+i/7+ixr+i2YpAqHcyo8LHpoMdlkAMjUGlq4F/poMgpoMdrIAygsBHpoMdlkAygsB/poMgpoMcrIAzp4JppoMZnsA/poM/poM/poM7poMGpoMZh0B2q4DHpoMdlkAyqMC/poMgpoM/rIAQrIAHpoMclkAzvwC/poMQpoMMNUnMj8lTFWvPi3bQEQySgn+lln+llnullkimJhCgQFmmgxCKwD+mgzWmgyqhwCW7AZWmgwA1IaaDBrsL/6aDP6aDP6aDP6aDLaaDDCFE3A/JduPvj4t8/snMlADGpoMZiEAGpoMZiEAGpoMZiEAGpoMZiEAGpoMZiEAGpoMZiEAGpoMZiEAGpoMZiEAGpoMZiEAHpoMZiIAHpoMZiIA/poM/poM/poM/poM/poM/poM/poM/poMOpoMZikC2uwIHpoMdlkAyuwI/poMgpoMdrIA6poMdlkAygsB/poMgpoMcrIAzp4JppoMZnsA/poM/poM/poM7poMGpoMZh0B2q4DHpoMdlkAyqMC/poMgpoM/rIAQrIAHpoMclkAzvwC/poMQpoMDp5gICWWM8s+LVAgMzJKCf6aDP6aDP6aDBKaDEKBAWaaDEIrAP6aDNaaDKqHAO6aDADVhpoMGp8w/poM/poM/poM/poMtpoMMM/WHT8lkFPgPi2dHUwyUAMamgxmIQAamgxmIQAamgxmIQAamgxmIQAamgxmIQAamgxmIQAamgxmIQAamgxmIQAamgxmIQAemgxmIgAemgxmIgD+mgz+mgz+mgz+mgz+mgz+mgz+mgz+mgw6mgxmKQLa7Agemgx2WQDK7Aj+mgyCmgx2sgDqmgx2WQDKCwH+mgyCmgxysgDOngmmmgxmewD+mgz+mgz+mgzumgwamgxmHQHargMemgx2WQDKowL+mgyCmgz+sgBCsgAemgxyWQDO/AL+mgxCmgwsYW5FPyVLTAw/LdBQNkTd/poM/poM/poMEpoMQoEBZpoMQisA/poM1poMqocA7poMANaGmgwavTv+mgz+mgz+mgz+mgy2mgwwAnsZPyUfiMg9LYCCvU5oMmYhABqaDGYhABqaDGYhABqaDGYhABqaDGYhABqaDGYhABqaDGYhABqaDGYhABqaDGYhAB6aDGYiAB6aDGYiABKaDP7+i/7+i/7+i/7+i/7+i/7+i/7+i/7+iyb+i2YpAtrsCB6aDHZZAMrsCP6aDIKaDHayAOqaDHZZAMoLAdKaDAC1IACAgAQYAAAAABgAJQEHYgUAdKoDVgodCAEdAnsZPyUfiMg9LYCCvT41AACAP2ABbQEHSBUAAEBAGAAgAC0AAIBAMicIARUBUn5ZAAiyAx8FWRAF+n8/JQFIEC0B+H8/LlkAALoNImZ7AADCDSIAgRVEAHU6RAAAyg0iZmYAANKCIgCQ2gMA4AMB6AMA8AMBgAQAiAQAkAQAmAQAoAQAqAQBtQT//39/vQUGAMUFBgDNBQYA1QUGBNoEKT8ws4ISPyWyghI/LbGCEjLmANo/AQDiDVlmHQEAFSFVxpgBAOqSWQDK8QEA8g1Z/gsBQgsBAPoNWXYLAcqyAASCBSm9clkAzvwCBI0FIZwMkAUcnQUJFKAFHaoFNGUOYTpljAAtAQouDgMQFQAA9EIBIAhAIAFhahQ+MAE4ALINojA1rkw/Jb62BT4tl7r8Pp4DAADK+wCguAUIwAUE0AUF2AUI4AUI6AUE8AUI+AUIgAYIiAYEkAYAmAYAoAYAgggpIgGtYrcAAADKhgIcwAkJyAkSqgqJJEKBAQAAkX0ouAoFwAoFygoA4goJikIrAC6oBDYFAgACkqgEAPoNhGZkBByICwCYCwCtC4EIBLoLwocAli8F8E/ICwjgCwDtC5qZGT6I8QQBkPEEAREI19tpEgsIpCcSAwEABRiIGQoYEhBjaGFydC00LXNlcmllc181KgQIheBpgvEE4RgKNgogCg4IARIKDSGyJQAMCg4IAgUQBMBABRAQEAAaCg2h0zAVzcxMvyoEbGluZRI21jgACBoAIikPAW5iIAIAgMogAgAq/lgAWlgAADJJcTAHzj8/Ja3NFj8tZ1hpMq8FADp+IQAAQn4hAABKfiEAAFJ+IQAAWn4hAABifiEAAGp+IQAAcn4hAAB6fiEABIIBfiIAAIqCIgBMkAEBmAEQoAEHqAEFsAEAuAECxQGhOkDIAQHQAQPYAQ7gAQboAQjyAYo9BQgCQx0BOwQgCqFaAD+hPQD6ojcABAAAHTcEggKebgAyNwAAiqI3AAxAQCAFFaUAko43AMkZAaUIzcwMBdxwmgIAogIAqgIAugIAwgIAygIA0gIA2gIA4gIA6gJpPBThkhI/JSQOkwgAbn6TCJYqBQDyDVmq7QOWWQAA+g1ZZpYD2uwIAIIa3Qp2WQDKPwcAig1ZquwIlgsBAJINWXayAMpRBQCaklkAygsBAKINWf4WAkIWAgCqDVlyCwHOngmmmgxmewD+mgz+mgz+mgzumgwamgxmHQHargMemgx2WQDKowL+mgyCmgz+sgBCsgAemgxyWQDO/AIemgwAFR6aDAAZ+poMICxtUj8lxHElPw60DDJKCQ5uCsqtAf6aDP6aDDaaDEKBAWaaDEIrAP6aDNaaDKqHAO6aDADPEpoMAKIamgwY7AIKGxITYxqaDCx2YWx1ZWF4aXNfMCoenQwAxuEABIA/GjAMEIkuOT8lAQUALQEFOgcPzt8GEDgTQA9dwYMSsxIMegCKARYFCQFfYmkAzrkOAJ0SoQoMqgEAug1iAXX++wwy+wx0yAEA4AEB8AEA+AEBiAIAmAIAqAIDuAITwAIU4AIBDhwOCBEI0JJ+AQAx/n4Bon4BCBZAF8J+Ac7nAQCdPn4B/uABQuABFMgBAeABADZ+ARgBuAIWwAIYNX4A/TJ+ART0AgoeEhZJ/CQ1LWNhdGVnb3J5Ov8CCMsCDQ6eDAAaipYCzhgBGCgAMBQ4E01BjABlAWgIcgCCTZ/+IQFCIQEAlSWDDKIBALL+YgBeYgAAwA7+DWAA2AEA6AEAgAIAkAIAoAICsAIUuAITyAIANYYA+SWGAJ6NghSPHAoVEg01hoGKVf4E7xslfXgSrgQKB0RlZmF1bHQShgEKC0ZpbGwgQ2VudGVyEhQNIT3BtAAAcdMIgD8aARYAgMHKBIA/El4OEskWACJSFgAULc3MzD4yARsAABVHAIABMSAAADgBQAFKFgoBHCwgQRUAAHBBHQAA8EGFNkwSigEKD0RpcmVjdGlvbmFsIEtlee6NAA2NDAAAQD9mjQAAUgGNNAK/gL4VKLkRvx1HZEi/CY0MhQEKCiUWEFJpZ2h07ogADYgIzcxMhhUBBMhCMngBGAAAEoQBCgkFiAhMZWb+hwAJhwTMPWYPAS2cBMjCOocAKBq3BAoLTWVkaXVtCYkBlxBUb3AgTHIeARDT0VI/FQEFMjMCARE6FgBBM4aXAABAQTMAyBIbFslpEBKLAQoQJR5JvBAgSGlnaGKsARxoxXQ/FbQ8eDaOAEoWAAwtZmZmajQCLSUASCElALQBjgTIQv40Av40Akk0ACANiGFJLhYBCExvd2IVAaEkEqYMMqMBShYAEqgRgjoCKRUIwh0AMRUgIrEECgpTb2Z0TSv+bgTabgQAMEE7AEgurQEhJf5uBE5uBACAniUBLo0A/m4ESm4EioMF/m4E/m4EXm4EACr+NAL+NAL+NAL+NAL+NAL+NAL+NAL+NALKNAIAMv7TCP7TCP7TCP7TCP7TCP7TCP7TCP7TCL7TCBA61AQKDRrTCBY+CP6cBkqcBgiamZmG9QkEQMEOGiEuCgsAqv4KC1IKC3bWCDxaNgoUDQEB8EEVkQAgQh30IpcLOBQNMVzGPhUmKBS/HWu1NxYgCxAdzcxMQCb2CAxFZGdleioLCOYOZh5pCAD4GggjBCIUThYAlioLAEgOKgsAoCE1HgwKDpMKBYhyKgv+hwA+hwAOBQouhwAAVQ47CQhaAGIW3w4OSg0lJg4+CT7lIM7fDhBoAHIAfQFjGIUBAAAgQY0BBlxCkAEAoAENqAEM8AEN+AEAhQIAAMBA1QcBfQ4lESAQCPrbaRIKCKAaIQ4QfQoWEg4SGA4gLTUtbGVnZW5kIiEOEGEKABAREgsKxngeDtgShmclJDEIhdxpEisI5g8Wyx8sygIiCAoECgILKxgBDQoQLxgBIgoFFCAuEAMYAQogEhgRrzRwYXJhZ3JhcGhTdHlsZR5WExxQOVq1AQgAEA6xDkRAQSoNSGVsdmV0aWNhTmV1ZToO1SUkx/9/PyX//38/LQEFLmcTKEABUABYAGAAaAB1ITEAfQEFIIABAaABAbABASKFHQTdAQEYDOABAfUS9Q8A+BKQDxSIAgGYAv8RAUQBoAIBsAIBwAIAyAIA2AIB8gIWFx5mewBE+AIAYmwIAhoBLiUAABBCKAE9AWUUQAFIAFAAEkUSHGoAcAB4AIoBDqcgGkwPFnUQDv4RCAAApQWVAK0FBhzKAQDQAQHYAQGOBA/gEjMTULgCAcgCAdgCAOACAOgCAPACADEIhv58ATl8GlQT/nwB/nwB/nwB/nwBpnwBAI8yfAEAy4b4AgghEhla+AIAMRpPFoZ9AUFSVoIE/vkCgvkCZnsA/vkCyvkCAJD+fQE9faL6AmYCAf59Af59Af59AbZ9AQCR/n0BPX0AMsmsLvoCAPBS8wX+fQH+fQH+fQH+fQExfQCS/n0BPX0AM0Z9AVZwB/59Af59Af59Af59ATF9AJP+fQE9fQA0/n0B/n0B/n0B/n0Bvn0BAJT+fQE9fRpdKi53BAAg/ncE/ncE/ncE/ncEcncEAJX+fQE9fQA2nvoCAAkiHzEAAzofMf5xB4JxB2Z7AP7uCMruCACW/n0BPX0AN0Z9Af76Av76Av76Av76Anb6AgCX/n0BPX0AOEZ9Af5xB/5xB/5xB/5xB3ZxBwCY/n0BPX0AOUZ9AQQAQk5eEP7uCP7uCP7uCP7uCB7uCACHMn0B8toRSucLVvkCZvA2/vMFgvMFZnsA/vMFyvMFAJkyfAHyXhAAMkpeEP7zBf7zBf7zBf7zBXbzBQCa/n0BPX1KXhD+fQH+fQH+fQH+fQF2fQEAm/59AT19SncE/l4Q/l4Q/l4Q/l4Qdl4QAJz+fQE9fUpeEP76Av76Av76Av76Anb6AgCd/n0BPX1KXhD+fQH+fQH+fQH+fQF2fQEAnv59AT19/l4Q/l4Q/l4Q/l4Qwl4QAJ/+fQE9ff5eEP5eEP5eEP5eEMJeEACg/n0BPX1KXhBW6AtmRx3+6AuC6AtmewD+6AvK6AsAof59AT19Sl4Q/vQF/vQF/vQF/vQFdvQFAKL+fQE9fUpeEP59Af59Af59Af59AXZ9AQCIMn0B8l4QSmoKVnYE/toR/toR/toR/toRHtoRAIn+fAE5fEppClZ8AWZfEf7yBYLyBWZ7AP7yBcryBQCK/nwBOXxKaApWfAH++AL++AL++AL++AJR+ACL/nwBOXyiZwpmbwj++AKC+AJmewD++ALK+AIAjP58ATl8omYKZvkD/nwBgnwBZnsA/nwBynwBAI3+fAE5fEplCv50BP50BP50BP50BHZ0BACO/nwBOXxKZApWfAFmfQL++AL++AL++AKu+AIMEQij3A5nTACmGiotFIMBCh8SFx6EKSxyZWZlcmVuY2VMaW4ieywMgvEEXhqRTWY0BxAVAADgP8ahUCQSABgPIA8RCP7bAZUe/EwI6RgKIvxMADUe/EwashkMgvEEwv78TP78TP78TP78TKb8TDBiRaQ+JWYcsT4tZAW+MkxQGvxMZiEAGvxMZiEAGvxMZiEAGvxMZiEAGvxMZiEAGvxMZiEAGvxMZiEAGvxMZiEAGvxMZiEAHvxMZiIAAIoa/ExmIgAe/EwABP78TP78TP78TP78TP78TP78TP78TP78TBb8TGYpAhKoPMZHBR78THZZAABAxlkA/vxMgvxMdrIAygsBHvxMdlkAygsB/vxMgvxMcrIAzgBKpvxMZnsA/vxM/vxM/vxM7vxMGvxMZh0B2q4DHvxMdlkAyqMC/vxMgvxM/rIAQrIAAIIa9FhyWQDO/AL+/ExC/Ewwbsv8PiXkRgg/LeU1EjJfNw5JRMqtAf78TP78TBL8TAwKqgoAQndZco0BzpgC1ndZ/ocAQocAAMhSd1kA/4Z7DBqwJP57DP57DP57DP57DLZ7DDCEHfI+JcjBAD8tDGEJMjEDGnsMZiEAGnsMZiEAGnsMZiEAGnsMZiEAGnsMZiEAGnsMZiEAGnsMZiEAGnsMZiEAGnsMZiEAHnsMZiIAHnsMZiIAHnsM/ndZ/ndZ/ndZ/ndZ/ndZ/ndZ/ndZ/ndZGndZZikC2s0IHnsMdlkAyiAH/nsMgnsMdrIA6nsMdlkAygsB/nsMgnsMcrIAzn8JpnsMZnsA/nsM/nsM/nsM7nsMGnsMZh0B2q4DHnsMdlkAyqMC/nsMgnsM/rIAQrIAHnsMclkAzvwC/nsMQnsMML8sJj8lWr4wPy0/lDwySgn+ewz+ewz+ewxCewxyjQHOmALWewz+hwBChwBWewwAgBKLGXL2GBquL/57DP57DP57DP57DLZ7DDC5Myc/JX+tKz8thWcvMjEDGnsMZiEAGnsMZiEAGnsMZiEAGnsMZiEAGnsMZiEAGnsMZiEAGnsMZiEAGnsMZiEAGnsMZiEAHnsMZiIAHnsMZiIA/nsM/nsM/nsM/nsM/nsM/nsM/nsM/nsMOnsMZikC2s0IHnsMdlkAys0I/nsMgnsMdrIA6nsMdlkAygsB/nsMgnsMcrIAzn8JpnsMZnsA/nsM/nsM/nsM7nsMGnsMZh0B2q4DHnsMdlkAyqMC/nsMgnsM/rIAQrIAHnsMclkAzvwC/nsMQnsMMAACWD8lOMpdPy24mmIySgn+ewz+ewz+ewxCewxyjQHOmALWewz+hwBChwBWewwAgYZ7DBpCMP57DP57DP57DP57DLZ7DDS14Og9Jb3u6D0tMa3xPS6GUxp7DGYhABp7DGYhABp7DGYhABp7DGYhABp7DGYhABp7DGYhABp7DGYhABp7DGYhABp7DGYhAB57DGYiAB57DGYiAP57DP57DP57DP57DP57DP57DP57DP57DDp7DGYpAtrNCB57DHZZAMrNCP57DIJ7DHayAOp7DHZZAMoLAf57DIJ7DHKyAM5/CaZ7DGZ7AP57DP57DP57DO57DBp7DGYdAdquAx57DHZZAMqjAv57DIJ7DP6yAEKyAACCGnElclkAzvwC/nsMQnsMMC/knD4lo+2cPi2z0aIyuy7+ewz+ewz+ewxCewxyjQHOmALWewz+hwBChwBWewwAgoZ7DBpBO/57DP57DP57DP57DLZ7DDCLYQ0/JSnLEz8tS7gfMqwPGnsMZiEAGnsMZiEAGnsMZiEAGnsMZiEAGnsMZiEAGnsMZiEAGnsMZiEAGnsMZiEAGnsMZiEAHnsMZiIAHnsMZiIAEnsMABpa6H4AC/7ofv7ofv7ofv7ofv7ofv7ofv7ofsLofmYpAtrNCB57DHZZAMrNCP57DIJ7DHayAOp7DHZZAMoLAQCiGo9+cvA4NrIAlhtmAKoNWXKyAM5/CaZ7DGZ7AP57DP57DP57DO57DBp7DGYdAdquAx57DHZZAMqjAv57DIJ7DP6yAEKyAB57DHJZAM78Ah57DP6CiyKCizDKszo/JaUrQz8tfutSMkoJ/nsM/nsM7nsMABJO7DFyjQHOmALWewz+hwBChwBWewwAg4Z7DBpARv57DP57DP57DP57DLZ7DDCmwkg+JRLNSD4tSsFIMqwPGnsMZiEAGnsMZiEAGnsMZiEAGnsMZiEAGnsMZiEAGnsMZiEAGnsMZiEAGnsMZiEAGnsMZiEAHnsMZiIAHnsMZiIAEnsM/mOL/mOL/mOL/mOL/mOL/mOL/mOL/mOLJmOLZikC2s0IHnsMdlkAys0I/nsMgnsMdrIA6nsMdlkAygsB/nsMgnsMcrIAzn8JpnsMZnsA/nsM/nsM/nsM7nsMGnsMZh0B2q4DHnsMdlkAyqMC/nsMgnsM/rIAQrIAHnsMclkAzvwCHnsM/mOLImOLMGnCyj4l78zKPi0JwcoySgn+ewz+ewz+ewxCewxyjQHOmALWewz+hwBChwBWewwA+xJnPk5EiwA1/kSL/kSL/kSL/kSL/kSLikSLAPySfgEm6D/+wox+wowEFkD+RIv+RIv+RIumRIsMEAi53A6dewDoGg97SEoKIgoETm9uZRIUY29sdW1uLXMO6noELWQWrokakmoUCVoiCAEQHnqgMCgAOgQKAggBSgBaAGAOAXoFARABEQj01w45TgDpDVs8mgEKkwEKJhIeZHJhd2luZw7wmggtMC0dDhJVew1jFAdaZwoAEorHfM7fQxJifDwiACoAMgA6AFAHWgARCJPgAawEyBcWFnwkhAEKHRIVZXF1YQ4NihgtMC1pbWFnMqAACARaYY54Tza/CpaIFhJTCBgaACIAEQjoJUIRlhS2AQoaEhIFi1aTAASVAf6UAHaUAIaQmQSAnQ7+mQCgGjufDD8wADgFyADpMsgAALsdyAAxTlsBAJr+yAD+yABSyAAABQ6ajAw/EQjqMs0ALpUBADJOzQD+lQHulQEplRYnihwgQSAULTMzMxK3mkFdAOtiyAAAM+bIAM6PA0nx4l0CAOxiyAAANHLIADDzrXM/JfPndz8t82p2/koWDkoWnsgABABwDn2JDABAIAQykAEA7TLIAADMfSUANU7IAAyrAQpshsuizpABUEIUEg1Gb3JtYWwgU2hhZG93HZqZGQ7kCgSAP96mARgWCNvXaRIQ1Q004AEqA7fXaQq7AQoZEhHNCxBzaGFwZcVwzQUMClqbAf4GBn4GBtJ3As06EApaHhAAEpWMAIAO1KEEgEDBWQ6YhCCAQFIECLfXaTYBBQQSMCJuggDZgnZ/VCoDmddpCisKBEJvZHkSHXRleHQtMjAmeYIlHwAtAR0AIBoSCQBQKn6CADD+FHj+FHi2FHgUcAgEGgEs/n6CQn6CKAH4AQHCAgQImddpOoKCCBYI3H6HAgAxeocCMCYE3Twl5jUuPy0R2FX+NgSBNkE0AD/+hwJ2hwIIFgjdMvcAAOptfgDFeX4AMk73AAClYX4AYIVlMGMubj8l5hsJPi36SVMyPDEOPogIQBgBvpeqJDoIEgZDaGFsazL+AQGSAQEA3n4BAQAzegEBcm8g/gEB/gEBigEBAN8yAQFKgAUANE4BAb2AMF78/z4lQKQRPy2fvBH++QL++QKi+QIA4H73AAA1evcAqvgBDgEIIAAAGAIlbxKDOg72hMELGiCKAQ8JBf7vAorvAgwQCO7XDtYNHjkMAHgOOAwMbW92aQ44DAUILmsNCAFaWP43DF43DAgQCO9eiQAAMf6JAA2JAAEOfBMeiw45ZjoKAAgRCPAyXgkArxJeCSULBC0yRooACAJajv6DDGKDDIpDCQQAVA4hCgyAQCAGDrmLErELCBAI8TJKAQB/OdMAM07AAABf/tMBXtMBCCIFDQ5hmQgRCPIyUQEAij1RADRGkQAQAVpqCmjFSXJQA9KuChgQEglIZWFkDkUKAHNlXQgRCPMynAAAjh2cADVOnAAAbv5KC6ZKCxz2KBw/Ngii1y4WCgDbmhYKACgmNpsAFyKKjFKhESoTClZxYWaGAf5xYYJxYWZ7AA5pZAB1chMKGAUVmpmZP3CalowAQUqWjC4YCgABIpqMCBYI4TIoBiDYASoDw9dpCqdFOhKYDAQtMEYpBhAOWoYBChZnjWbWAAASisUSzicSResixRIcDloqCAAQASISihNWkwwoOABSBAjD12lYADYBByqXDADgmoECJCsKBUxhYmVsEhwSmAwEMzI+mAwFHhq9DQg5WrwqFY8AFDIVjwAtFvqSEhyP/vxj/vxjYvxjAHAOHI8OngwAOCocjwAB/hyPEhyPXoYCAOJChgIAxDqGAkqfDD6GAgh3GiIOL5s2Bab+hgL+hgI2hgIAxEmGAMQyBwUA6pqGAgg1CgpFaBggRGFyaxIhSYsAM1KLAgUjupACZsoD/hsF+hsF/pACypACAOOCkAJKOA5dkDCAMME+JYmHWT8tfpxbMjId/pAC/pACSpACCBYI5ELvAD4FBkomDh3vZiUP/u8A/u8ANu8AxQUIFgjlQu8APm4EShQOHe8c6bZ+PyV3PC6BbjZflv7vAP7vADbvAIVuCBYI5kLvAD7eAUoMDh3vMHnJfz8ln3KFPi323iEyAQ/+7wD+7wA27wAl3gg2CPUyXQUA15pdBUApEiFzdGlja3lDb21tZW50LUJ8FE4Dkf5lCv5lCrplChJ4FP72llb2li7aByb6lgw2CJbgLnEJ/o4BPY4aCkYu8wsAUP4GFv4GFv4GFv4GFhIGFg63q16OAQCX/o4BXo4BGh07Lo4BAGD+jgH+jgH+jgH+jgGCjgEAmP6OAV6OARowMC6OAQBw/o4B/o4B/o4B/o4Bgo4BAJn+jgFejgFKgnYAgP6OAf6OAf6OAf6OAYKOAQCa/o4BXo4BShh1AJD+jgH+jgH+jgH+jgGCjgEAm/6OAVqOAU75iQCw/o4B/o4B/o4B/o4Bgo4BAJz+jgFejgFKxgcAwP6OAf6OAf6OAf6OAYKOAQCd/o4BXo4BSqoEAOD+jgH+jgH+jgH+jgF6jgEIFgj2Mu0ONIACKgP112kK4wEKIhIaPuENEuAWLhIcCA5auibYFhI8swCADuQPjlIUDjfFJrDKNtgWlqsbFtgWhpcjFtYmBABAEsTBAIASpscalyMIDloWDo6lGgwXAAAS+BYA9Q5yFBgVCJXgaRIPIoYkAF4W5hcALg44thxzdmdpbXBvcg7yDiUREmojGjwUEAxaCgoAImwXAAyubBcMEQiH2Q5bKgTzLhZbKgSYQQ66Gwx0YWJsDlMYBQguewEYP1r3QAgBEhZVGBD29XU/JQEFAC0BBS6xUgCoEiCmIIICxR8IDxqKAobtGwwzM7M+xmN0htkQ1lgAABqCFBnWWAAEID/+DQH+DQH+DQH+DQEuDQEAH/4NAf4NAf4NAf4NAS4NAQAv/g0B/g0B/g0B/g0BLg0B/jQE/jQE/jQE/jQEMjQEAAH+GgL+GgL+GgL+GgIuGgIAEP4NAf4NAf4NAf4NAS4NAQAC/g0B/g0B/g0B/g0BLg0BAAT+DQH+DQH+DQH+DQEuDQEAIP4NAf4NAf4NAf4NAS4NAQAI/g0B/g0B/g0B/g0BLg0BABP+DQH+DQH+DQH+DQEuDQEALP4NAf4NAf4NAf4NAS4NAQAD/g0B/g0B/g0B/g0BLg0BAAz+DQH+DQH+DQH+DQEuDQEQMIgCAZAOzrUOxbUAqBLItQTKAjZHtgDQDku1HAHgAgHoAgDyGqfRZqokDpQxyjlFAPqGWQDWmA8enUZqsgDWWQAenUb+WQBCWQAeANL+WQBCWQAeBIVqWQAONMbGrBGKnUbWZAEAqhoYU2qyANZZAACyhlkA1gsBALqGWQDWsgAAwv5ZAF5ZAADK/lkAXlkAANL+WQBeWQAA2v5ZAF5ZAADi/lkAXlkAAOr+WQBeWQAA8oZZAAAA0tswAPr+WQBeWQAEggSCgRXWsgAAiv5ZAF5ZAACS/lkAXlkAAJqOWQDOTQcAov5ZAF5ZAACq/lkAXlkAALL+WQBeWQAAuv5ZAF5ZAADChlkA1ukFAMr+WQBeWQAA0v5ZAF5ZAB4B5f6mB0KmBx4B5f5ZAEJZAB4ETWpZAAEb"
-			+ "LgoJlkFFHgRNAT4AJQEFDkY3AAAuPxvaWQAeAeUBVP5ZADJZAB4ETf5ZAEJZAACKGlNm/lkAQlkAAJKOWQDO/x0Amv5ZAF5ZAACijlkADko6Jso+lm8CAKqOWQDOCwEedeZyvQHOWQAAuo6yAM4LAQDCjlkAzrIAAMr+WQBeWQAA0o5ZAM4LAQDaklkAyuJRAOKOWQDOZAEIEQigYqogADF6qiAQ+Pd3PyUBBQgt9/Y2TEf+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiASqiAwiokJPyWFhAQ/Lf/+/jIIRBI0Vy7jFZYlMh6qIACTDlzzAQUALQEFPuMVylkAJqogXvgyDjwWylkAJqog/lkAOlkAHqogIQH+CwEyCwEeqiD+vQFCvQEeqiD+sgBCsgAAqhowHf5ZAEJZAACyDVnaCwEAxhgAgIAEEAAlAAAAUgUAMLoDVgodCAEdk5ISPyUBBQAtAQUcNQAAgD9gAW0BB0QVAAAAPxgAIAAtAACAQDInCAEBEgQAGFJPABloAML+WQBeWQAAyv5ZAF5ZAADS/lkAXlkAANr+WQBeWQAA4v5ZAF5ZAADq/lkAXlkAAPINWTSKiQk/JYWEBD8t//7+Pj5vAgBAxm8CAPr+WQBeWQAEggRpIf6yAEKyAACK/lkAXlkAAJL+WQBeWQAAmo5ZAABAyiwEAKL+WQBeWQAAqv5ZAF5ZAACy/lkAXlkAALr+WQBeWQAAwg1Zod/+6QUy6QUAyv5ZAF5ZAADS/lkAXlkAANr+WQBeWQAA4v5ZAF5ZAADqDVn1xgAtAQo+NwUAAC43BQACkqYHAPL+WQBeWQAA+v5ZAF5ZAASCBamQIQESbgj+CwExCwCK/lkAXlkAAJINWXJ6AwCAyjcFAJr+WQBeWQAAog1Z/mQBQmQBAKoNWf4LAUILAQCy/lkAXlkAALoNWf4LAUILAQDCDVlyWAjOFgIAyg1ZDrwLACUBBQ64Cz7SC85ZAADSFVkaSwz+egNxegDaFVkAgGayAM4VCgDiDVn+bwJCbwJ0EQi52WkSCwjzLhIDAQAFGJhBChoSEnRhYmxlLTItBQhMU3R5bGUqBAiF4GlQP1r3QAgBEh8Sag0Q+Pd3PyUBBQwt9/Z2MpgBPKgBAbABAYICxR8IDxqKAgqC6QQMMzOzPi70BZaaDQAS/lgAWlgAABr+WABaWAAEID/+DQH+DQH+DQH+DQEuDQEAH/4NAf4NAf4NAf4NAS4NAQAv/g0B/g0B/g0B/g0BLg0B/jQE/jQE/jQE/jQEMjQEAAH+GgL+GgL+GgL+GgIuGgIAEP4NAf4NAf4NAf4NAS4NAQAC/g0B/g0B/g0B/g0BLg0BAAT+DQH+DQH+DQH+DQEuDQEAIP4NAf4NAf4NAf4NAS4NAQAI/g0B/g0B/g0B/g0BLg0BABP+DQH+DQH+DQH+DQEuDQEALP4NAf4NAf4NAf4NAS4NAQAD/g0B/g0B/g0B/g0BLg0BAAz+DQH+DQH+DQH+DQEuDQHAMIgCAZACAZgCAaACAagCAbACAcoCDUhlbHZldGljYU5ldWXQAgHYAgHgAgHoAgDyAhY/D/4QEkIQEgT6AglZcgURzuIdAIIacxsOZBJiaRLOWQAAiv5ZAF5ZAACSDVn+CwFCCwEAmg1Z/r0BQr0BAKINWf6yAEKyAACq/lkAXlkAALINWf4LAUILAf6qIP6qIP6qIP6qIP6qIP6qIP6qIP6qIP6qIP6qIP6qIP6qIP6qIP6qIP6qIP6qIP6qIP6qIP6qIP6qIP6qIP6qIP6qIP6qIP6qIP6qIP6qIP6qIP6qIP6qIP6qIP6qIP6qIP6qIP6qIP6qIP6qIP6qIP6qIP6qIP6qIP6qIP6qIP6qIP6qIP6qIP6qIP6qIP6qIP6qIP6qIP6qIN6qIADSYqogADP+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiD+qiA6qiAA62KqIAA0/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qog/qogOqogBITaXv5hADV6qiAw9fR0PyX6+Xk/Lfn4eP7+Yf7+Yf7+Yf7+Yf7+Yf7+Yf7+Yf7+Yf7+Yf7+Yf7+Yf7+Yf7+Yf7+Yf7+Yf7+Yf7+Yf7+Yf7+Yf7+Yf7+Yf7+Yf7+Yf7+Yf7+Yf7+Yf7+Yf7+Yf7+Yf7+Yf7+Yf7+Yf7+Yf7+Yf7+Yf7+Yf7+Yf7+Yf7+Yf7+Yf7+Yf7+Yf7+Yf7+Yf7+Yf7+Yf7+Yf7+Yf7+Yf7+Yf7+Yf7+Yf7+Yf7+Yf7+Yf7+Yf7+Yf7+Yf7+Yf7+Yf7+Yf7+Yf7+Yf7+Yf7+Yf7+YR7+Yc60ex7+YRC9vLw+JQEFAC0BBTqTeACAyp9yHv5hAU/+WQAyWQCS/mHOCwGS/mHOWQCS/mHOZAGS/mHOWQD+/mH2/mHOZAGSqILOCwGSqILOWQCSqILOCwGSqILOWQCSqILOCwGSqILOWQD+qIL+qIL+qIL+qIL+qIL+qIL+qIL+qIL+qIL+qIL+qIL+qIL+qIL+qIJ6qILO0wOSqILOWQCSqILOWQCSqILOWQCSqILOWQD+qIL+qIL+qIL+qIL+qIL+qIL+qIL+qIL+qIL+qIL+qIL+qIL+qIL+qIL+qIL+qILOqIJ26A3KF4X+qIKCqIJysgD+qIL+qIIyqIIgEAiI2WkSCgj0GqiCED8KHRIVEp+CKENlbGwtMC1ib2R5LqqCLARaHAoAGAFAAEoUDQ7vjwAVAQUO4nEAQA7icQxAEAiMMlAAEGYKJRIdLlAAQGNhdGVnb3J5TGV2ZWwxUm93GgKDDARaOwoW/4IQOwdUPyUBBQAtAQUuMBAEGABmdwAAjap3AAAyTncAEJgxSz8lAQUALQEFnncAAI6qdwAAM053ABD2W0I/JQEFAC0BBZ53AACPqncAADROdwAQU4Y5PyUBBQAtAQWedwAAkKp3AAA1TncAELGwMD8lAQUALQEFnncAAIsydwAQRAoiEhouUwIgZm9vdGVyUm93sqgCAIoyVQBCqAIsaGVhZGVyQ29sdW1uNlgAUagQ3dxcPyUBBQAtAQUyzABqHwMAiTJ3AABjPswACXdCzAARdDC9Vj4/JcLxQD8tvyZAonQAAJF2dAAQbGFiZWz+kAM+kAMAkp50AP6NA32NAJOedAD+igN9igCUnnQA/ocDfYcAlZ50AP6EA32EAJ0ydAAQawoqEiIuhAMUcGl2b3RCwSwUdW1tYXJ5aTlC3AUQ9vV1PyUBBQAtAQWeNAMAnDJ8ABBoCicSH258AE55BBBYvmQ/JQEFAC0BBZ55AACeMnkAEG0KLBIkQnkAAEguKQQJ/UL3AMHJWtMGaisEAKEyfgA6mgcAMcaaBwClMlAAOvIEADGKmgcQj8J1PyUBBQAtAQUyRQFqmgcApqp3AFINBBAfhWs/JQEFAC0BBZ53AACnqncAUhAEEK5HYT8lAQUALQEFnncAAKiqdwBSEwQQPQpXPyUBBQAtAQWedwAAqap3AFIWBBDNzEw/JQEFAC0BBZ53AACkMncAOs4GADFemgfRzhDt7Gw/JQEFDC3r6mo2dABqFwMAozJ0AABHNmEKADHtQomANrkHerkKAKIyWABCzAB6mgcS/48Io6IiRk2PbswAAKp2dAB6mgdhhsaQAwCrnnQA/o0DfY0ArJ50AP6KA32KAK2edAD+hwN9hwCunnQA/oQDfYQAtjJ0ADqaBwAxnpoHDnCQVnWQbsACALUyfAA6mgdGfABOmgcQX5xmPyUBBQwtW61logUEALcyeQA6mgcNeY6aB2pDA2qDBAC6Mn4AOpoHADLGmgcAvjJQADqaBwAy/poHYpoHAL+qdwD+DQSdDQDAqncA/hAEnRAAwap3AP4TBJ0TAMKqdwD+FgSdFgC9MncAOs4GADL+mgdWmgcAvDJ0ADqaBwAy7ULKmgcAuzJYAELMAHqaBxzBwMA+JdnYWBKoDzKAIm7jAwDDdnQA/poHUpoHAMSedAD+jQN9jQDFnnQA/ooDfYoAxp50AP6HA32HAMeedAD+hAN9hADPMnQAOpoHADL+mgd2mgcAzjJ8ADqaB0Z8AP6aB/maANAyeQA6mgcNef6aB2aaBwDTMn4AOpoHADPGmgcA1zJQADqaBwAz/poHYpoHANiqdwD+DQSdDQDZqncA/hAEnRAA2qp3AP4TBJ0TANuqdwD+FgSdFgDWMncAOs4GADP+mgdWmgcA1TJ0ADqaBwAz7ULKmgcA1DJYAELMAHqaBxIYjAyVlBQ+QiiebpoHANx2dAD+mgdSmgcA3Z50AP6NA32NAN6edAD+igN9igDfnnQA/ocDfYcA4J50AP6EA32EAOgydAA6mgcAM/6aB3aaBwDnMnwAOpoHRnwA/poH+ZoA6TJ5ADqaBw15/poHZpoHAOwyfgA6mgcANMaaBwDwMlAAOpoHADT+mgdimgcA8ap3AP4NBJ0NAPKqdwD+EASdEADzqncA/hMEnRMA9Kp3AP4WBJ0WAO8ydwA6zgYANP6aB1aaBwDuMnQAOpoHADTtQsqaBwDtMlgAQswAepoHHP79fT8lrq0tDs4WAAAyR6pumgcA9XZ0AP6aB1KaBwD2nnQA/o0DfY0A9550AP6KA32KAPiedAD+hwN9hwD5nnQA/oQDfYQEgdoujyQ6mgcANP6aB3aaBwCAMnwAOpoHRnwA/poH+ZoAgjJ5ADqaBw15/poHZpoHAIUyfgA6mgcANcaaBwCJMlAAOpoHADX+mgdimgcAiqp3AP4NBJ0NAIuqdwD+EASdEACMqncA/hMEnRMAjap3AP4WBJ0WAIgydwA6AiYANV6aB3rxHQCHMlUAOnsHADXtI8p7BwCGMlgAQq0AWnsHeq0AAI4yVQA60AcANf5cB1ZcBwCPnnQA/k8DfU8AkJ50AP5MA31MAJGedAD+SQN9SQCSnnQA/kYDfUYAmjJ0ADpcBwA1nlwHZqFMbhwKAJkyfAA6XAdGfABOXAcwVM9jPyVmemg/LWKLZ6IqHgCbMnkAOlwHDXn+XAdeXAckNgiW2WkSMAjmDxYGsCzZAiIICgQKAgsrGAENChAvGAEiCgUUNC4QAxgBKgOZ12kKJhIeImgmFFRleHQtMFbhAzg5WroBCAAQAB0AACBBKhIyO6AgLUJvbGQ6HQgBFpsiDqAiQmcTKEABUABYAGAAaAB1ASAAfQEFDIABAaASZ7AExQEOoBMQyAEB3QEBGAzgAQH1BRIY+AEAgAIAiA65oAD/EQEEAaASv6AowAIAyAIA2AIB8gIWzC0BOVZ7AET4AgBicAgEGgEuJQAAEEIoAT0BLBhAAUgAUABdAQskagBwAHgAigEKDQEOEqy2AJUFgACdBY8ApQUGAK0FBhzKAQDQAQHYAQGOfA/gAQD4AQHCAgQImddpyAIB2AIA4AIA6AIA8AIANgiX/pABRpABnf3+kAH+kAH+kAH+kAHGkAEAmP6QAUaQAd0Z/pAB/pAB/pAB/pABxpABAJn+kAFGkAH9Nf6QAf6QAf6QAf6QAcaQAQCa/pABRpABKlEI/pAB/pAB/pAB/pABxpABAK8ykAEA297QBwAxXtAHALz90AAUNtAHFE1lZGl1bf7SB/7SB8rSBwAB/tIHctIHALD+kgFGkgEy0gf+kgH+kgH+kgH+kgHGkgEAsf6SAUaSATLUB/6SAf6SAf6SAf6SAcaSAQCy/pIBRpIBMtYH/pIB/pIB/pIB/pIBxpIBALP+kgFGkgEy2Af+kgH+kgH+kgH+kgHGkgEAyP6SASmSADL+2gf+2gf+2gf+2gf+2gf52gDJ/pIBRpIB/toH/toH/toH/toH+toHAMr+kgFGkgH+2gf+2gf+2gf+2gf62gcAy/6SAUaSAf7aB/7aB/7aB/7aB/raBwDM/pIBRpIB/toH/toH/toH/toH+toHAOH+kgEpkgAz/toH/toH/toH/toH/toH+doA4v6SAUaSAf7aB/7aB/7aB/7aB/raBwDj/pIBRpIB/toH/toH/toH/toH+toHAOT+kgFGkgH+2gf+2gf+2gf+2gf62gcA5f6SAUaSAf7aB/7aB/7aB/7aB/raBwD6/pIBKZIANPbaB2Z7vf5gH4JgH2Z7ADJgHwA4KmAf/o4XRo4XAAEqYB8A+/6SAUaSAcraB2YXAf6SAf6SAf6SAcaSAQD8/pIBRpIBytoH/pIB/pIB/pIB/pIBLpIBAP3+kgFGkgHK2gf+kgH+kgH+kgH+kgEukgEA/v6SAUaSAcraB/6SAf6SAf6SAf6SAS6SAQST2i44J+JoH1oZKwA5miAZEMnISD4lAQUALQEFADUOECca9OT+SAaCSAYBcVZ7AP7aB9raBwCU/pIBRpIBytoHZhcB/pIB/pIB/pIBxpIBAJX+kgFGkgHK2gf+kgH+kgH+kgH+kgEukgEAlv6SAUaSAcraB/6SAf6SAf6SAf6SAS6SAQCX/pIBRpIBytoH/pIB/pIB/pIB/pIBOZIIEQibEsSdAOkaEi8gswEKlAEKNgoWEvAuLE5hbWUtMC1zaGFwZRK8UQASWhgAGmJVCANaWIas3uG2LgTflvjkGFADWhgQATJS5VwIEQi0fsUAADFaxQAuGAD+xQD+xQAAzX7FAAAyWsUALhgA/sUA/sUAAOZ+xQAAM1rFAC4YAP7FAP7FAAD/fsUAADRaxQAuGAD+xQD+xQAAmBLzgGrZAwA1WsUALhgA/sUA9sUAGDkIo9dpEjMisDMA4YbgKwwGt9dpDrMzKCoKBVRpdGxlEht0FrEzJHBhcmFncmFwaHMO6OMALQUdDd4Sdy0AARK3MwDw/rcz/rczyrczAHQOtzMALEK3MwABorczAIB+tzMY0gIECLfXaS67MwwRCJrXDlODAOfNOTTRAgonCgZCdWxsZXQSFyV0FDEtbGlzdClvCRktcAgHWAI+AgAQZV10UT+eBQAAbQ6CNCBtAAAQQW0AAJABBQDYAQUUEEJtAAA0AQUAWAEFAHwBBRCQQnIMDcFyErE0BBgBGQ4EgL/+DgCODgAUggED4oCivgYAFvE1DDkIsNxB/gDqLWMg6AIiCQoFCgMBEq82DQsOsDYACwkWKrE2JN8CCisKDVRPQyAOSzcYaW5nIDESFC2VHHRvY2VudHJ5JZktkgg6WrUe6S4IYEEqNvTW/uIu/uIuduIuAHZB/e60Nha0NjBBygEJCgcNdfLwQxACWr02Lv8CIBIECAEYATkIrjKgBADkpqAECDEKBy2bBBIgKZkAMT6jBA0gBCAxLaWdpwCQ/qcE/qcEyqcEEl447qcEOl44DADgAQImWjguowQOntkU8AIAOQivMp4BAOamngEIMwoJMX4AMjGgADJeoAEAMkagAQCA/qAB/qAB/qABbqABGEDAFQAAQMB+/jkAAVagASaeGgg5CLAyoAEEvQMahDtmjjvx3j2gADMxoAAzXqABADM1oP7lBILlBAwK16M8/pk7Spk7BMsBgeZiPAMkBRWamZk/cAB4ARafO16hAQBA4egEkEEenzthQQCCGmzcMKG4oj4lpLyiPi2gtKIyWhXhOTKwDZa07BrxO3WXKfcAAWWXALEy9wEA6KaXAwg1CgtxlwhSZWQx+QA0XvkBADQ1+QS6ARrgCWqZAzTHn24/Jb4QCj4thrA+Pf5dFrJdFmZ7ACJdFmL9ASqXPV74ATo5BQABMpM9OqIBoTkIEQibMtwJFNkCCi8KChbDCQwgQmlnGlQLADJC4AkBHS10TuQJDOmiiz+eBQAe5AkAQA7aCQDAAQUS3wkAQA7VCQBwAQUAkAEFAKgBBQDADuQJYQJBqxbkCf4OALIOAL7eCQkwHuQJALH+5Akm5AkAMhrkCQAy/uQJ/uQJ/uQJpuQJBEBBLgEDAABymEDW5AkMNgi91y78GgDrhq8EEjRCJDEKB0NhcHRpb26NqAQyNj6oBA0g3aEgugEIARAAHQAAAB4KAJRSfCBBKhJIZWx2ZXRpY2FOZXVlLUJvbGQ6HQgBHQAAAAAlAQUALQEFHDUAAIA/YAFtAQcoQAFQAFgAYABoAXUBGwB9AQUogAEBoAEBsAEBxQEBIxDIAQHdAQEYDOABAfUFEiz4AQCAAgCIAgGYAv8RAUwBoAIBsAIBwAIAyAIA2AIB8gIfCnZ7AET4AgBidwgEGgEsJQAAEEIoAT0BZRhAAUgAUABdAQskagBwAHgAigEKDQEOABUBBQCVBYAAnQWPAKUFBgCtBQY4ygEHCgUN//9lQtABAdgBAZXgD+ABAPgBAcICBAiZ12nIAgHYAgDgAgDoAgDwAgA2CMDXaRIwCOYPEgMBAAUY9gIiCAoECgILKxgBDQoQLxgBIgoFFNguEAMYASoDmddpCj8KD0hlYWRlciAmIEZvb3RlchImdGV4dC0yOS1wYXJhZ3JhcGhzdHlsZS1INigAVCoECIXgaVA5WrUBCAAQAB0AAEBBKg0ysAGeqwEAAP6rAdKrAQB5/qsBNaskCQoHDQCA4UMQApatASQcCJzXaRIWCOcPKa0Q1QIyCRcRASgKJQoFSW1hZ2USFiWJGDMtbGlzdHMlgwUYLXkIBlgBPgIAAGVB3p4FAABtQX8AbSG2DG0AAMABBQQQQgEPAQUAcAEFAJABBQCoAQUMwEJyDEGzAD9BswiAGAH+DgC+DgAYigEEGgIIF94HACygAQE5CLLcaRIzCOotciDoAiIJCgUKAwFlIA0LYSEACwkWfSIk3wIKKwoNVE9DIGEpGGluZyAzEhQtmhx0b2NlbnRyeSWeLZgAOnkRAGD+EQP+EQO2EQMAdmERAC5SvAQEwEGmvAQEQcplEQh18vBmEQMuuwQgEgQIARgBNgjCMsEEBOQCjbcAK3bBBAg2CgiBuBRub3RlEiQplwQxLTq6BBEhECBUZXh0LaeduAAw/qcB/qcBtqcBAHAhp/5jBsVjAABurwQAAd1cAMUymwEA6ZqbATw7Cg1UYWJsZSBUaXRsZSAxMaAAND6gATImAEagAf5YBv5YBrpYBghwCALyAwgEgEAOAwgIQEHKdqABLvwHAMYyoAEA7r6gAQBTwV05oAA1VqABDSY1oAy6AQgB5fj2qAn+/QfW/Qf+RQOaRQMupQEAxzKlAcJFAyl/ADJxRQA2bqUBADI1pSKdCQAg/uUE/uUE/uUE/uUEUuUELqABAMgyoAHaRQMAMzGgADduoAEAMzWgjkUDEIH6fz8lDtsJEC11+H8/Uu0M/kUDXkUDZnsADu0MWkUDAAHG7QxyigYupQEEydcu5gwA8NbqBAA0MaUAOG6lAQA0NaUAvB7iDAwgQSoUMuIMGC1NZWRpdW3+6Qz+6Qx26QxSpwEAAc6UDqKnAQDK/qcBIacANTGnQosOFjEIqRIANbqnARCTkhI/JQEFAC0BBf5OA7JOAwFxVnsAMk4DADgqOxD+pwFGpwEm2AkYEQid12kSCyKHDgDGDuoMKAhMZXR0ZXJlZBIZEk4LADQqfw4RGy1yCAZYAz4CABBlXXTRP2YFAABWMh4AHoIOAJAifQ4AWA5uDhJ4DgC0AQoA2AEFAPwBBQQQQxJ0DgCAEoIOAAAagg7+DgCqDgAEeAk+AgAIyAEAXgMACDkIs/5tDiZtDgA0Gm0OADT+bQ4mbQ4AAjYpE/48Bl48Bg5gED6kEwl7Qe5qbQ4EEEL+bQ6GbQ4Ay/6hBIGhADaNoQQ0MG5IBgA2bS8AOZpIBhDJyEg+JQEFAC0BBf6hBLKhBAFxVnsAIbPVSP6hBJ6hBAg2CMwypwHaNAsANzGnQhkQLkgGADc1pwC1KtkMStEUZiUBInwW/lMDXlMDZnsAMqAB7nwWEnwWcugHLkEGAJ5KQQYMTnVtYt1BADXdQREbLWvGQQY2Xwb+QQb+QQauQQYAAD4CAF4+BhTIAQARCJ8yWAE4gAMKKQoHSGFydmFyZBIY5ZgANj1XDRotVgAJPpUHAFj+lwf+lwf+lwdmlwcwA3gJeAB4DngBeA14CAEGFIIBA+KAor4GABYeGmqSAQw5CKnXDkAWHl8ZAOKGeQwMBrfXaQ5iGRgwCghTdWJ0DgMTBBIeLbs6oBQRIC3BKpsUAKD+tg/+tg+2tg8AdFabFAAB/hEOJhEOFNICBAi31zJAFggRCKAyLgMstQIKIwoERGFzaBIVJXAAN30rARctZwgFWAI+AgAQZemiiz+eBQCRfgBADr8KikEZCJqZmRK/CgBAEr8K/g4Asg4ADIIBAS1+BAAYFQih12kSDyIODFj/AjICDg4KMQoLTm90ZSBUYWtpbmcSHCVSADg9Uh0eLVkABz5XAQRYAp6VGgUo/lkBKVkWJgxWZwH+HAAVHClViXMhY24KABa/GgAOFQcMAhABinIFADCgAQEWCOfXaRIQCOkPFiocLO8BKgO312kKvgEKHBYZDChib3gtMC1zaGFwZS6GGhwOWpsBCgASVnqzHgAVDlcSCBgAIA5IHxSAQDInCAIO4xsEABgWuQsSvgtOBQAAHQE3BCI0gl0AKICdQx0AAKBAIAEtATI0MAA4ACoAMgA6AFAOWioONh4wIgQKAggBMhQNAACAQAGNAEABWwBADu4SDEA4AFJl7BBYADkIrzJRDQDhpr4bONgCCiQKA1RPQxIXdG9jLRKuGwAtJSkYLWRlZmF1bB4QGv63G/63G/63G1K3GwAAqnMg1rcbJBAIlOBpEgoIqE5JoTAgCh4SFmRyb3AtY2FwTmkBDBAIqdwuMQAQUQoXEg8BMRkwADCNSDABWgBiMgowCAAQAxgAQTwIUAFZDlUOAQEAYQEFAQEIaZqZAQEIyT9xCQkg6T8xCKrcaRIrFZMEvAF+ShxGgwAe5hgIC1prDuUYACrGiCIcoAEByAEBiAIORyKiPiIJ7ggCGAGu7gAAq+7uAAXuHi8Y/u4A0u4AFAQYADABOKLcAQCs7u4ABe4efRf+7gDS7gAAA7bcAQCt7u4ABe4exhb+7gD+7gAF7gTgP3K4AwCuMu4AALiCZAtGuAMeDRYIDVptwV9qrhcABSJVGQABOlUZWroDZjEADnwPBKsBnakAAZapBAAa/p4HWp4HACp+qSYMEAjV16GEAOUaVggwGAoQCghFbXBoYXNpc7V9FAIIARAI1jIpAEAdChUKDVN0cmlrZXRocm91Zx5MCxwBWgJgARAI1zIuADAZChEKCVVuZGVybGluHt0MHAFaAlgBEAjYMioAKBYKDgoGSXRhbGljGX8QEAEcCNkSKCURqABZLsAmAbQMUmVkIA4UKA01EAJaQwgBEowZNO/ubj8liYgIPi3BwEA9LkQTHscnZiIACBwI2jJ2AABUMnYAGA0KBVdoaXQZzwBBBXEO3wgQJdv7fz8S6QgJcRbtFBFxZiIADBUI/98OegsA6C2PbBYqA7ncaQoOGgQIudxpIAEqBAiF4GlQAVoCYAA="),
-		Entry(path: "Index/DocumentMetadata.iwa", base64: "AEkAAEbwRRkIRxIVCINWEgMBAAUYLCIJCgMKAQMQAxgBCAAaKAomChS8CVQSNJPzhDYnJUxI0jHeRGo+DhABGdBdBB6C5NdBIgMKAgM="),
-		Entry(path: "Index/Metadata.iwa", base64: "ALlBAJelAfCwIAgCEhwI/lUSAwEABRjvogEiCQoDCgEKEAEYASoDteBpCLXgaRIoEiQ4Qjg5QkM2OC02NEMwLTQ4MzktOEZCMi02QzdCMTFEMTAwNzIYABomCEcSEERvY3VtZW50TWV0YWRhdGEiAwIAACoDAgAAUABgwwaoAQEaQQiC4GkSEUNhbGN1bGF0aW9uRW5naW5lGhlDYWxjdWxhdGlvbkVuZ2luZS0xNzMyNjEwIgMCAAAqAUtUUABgwwYaHgif4GkSCVZpZXdTdGF0ZT4gAHxNCIHgaRIXQW5ub3RhdGlvbkF1dGhvclN0b3JhZ2UaH1oZAAQtMQFvBDA5Pk8AILNvCIXgaRISRA3dJFN0eWxlc2hlZXQZKvBYOgoIDhIGCKHXaRACOgoIFxIGCJzXaRAJUABaGgja12kSFAiX6Y/71ZfCoxcQpvObkarKh6BsWhwI2ddpEhYIyKjsueeE26SeARCdheC0x4Pdr54BWhoI2NcBOlih4aeb242Mo3UQnb3Y3ZPp2I8cWhoI1wVWWN6B3Onj16ykKRC+9bDM8sOE9ndaGgjWBRzQ4//B5sWAtKV2EJzX9ZyAneWqdlobCNXXaRIVCLPU3IOLhrCnMhCjw4Pb8Y2O+6wBWhsIrtwBHWD/tN6Xp8TIp7UBELnruNHc6omOFFocCK3cAaxM7p+vzpLN9KfRARCercjEqqGblucBOwSs3AE7YKqwjLb37sKj+gEQhsmH4vGO2KR7WhoIq9wByVis1MPM8rWmpmsQpbX3tdKaitI/WhsIqgU5SPjNxvSAz/+lMhCsm6Kt+fr1wZIBVgCpBR1c/def/bLP9qPWARCym67Oh5W25w1aHAivBZFM7cKFkePe1qPuARCQ1aGc9IbC264BOwDnBelIk7mHg5+68aQ+EIvJyb/7g936iwEdAKEFHUi7wpPI9NWkoBIQkbWXxe3ToM67AR0AoAUdSLOE4q+fjYmkPRC0y+7r+vb71NchlACpJVxYsLm+xY7W76dfEJfJ8Pib5OvKWFobCJ8FOVz7i5jJ4uKhpJUBEIvxm7OqqovBZ1obCJ4FHUjP9raIuM22oEgQtIum7523zPOaAVYAzAVWWPW3xp618LSkMhCN8++WsNS0h1laGwjLBTlc9fLVsIalmKPIARCTneuCyIWonwZaHAizJQRM6+KX+pWd/6eYARCgx43Zp+/0mbQBygCdBTtcqvuoiOimq6esARC+qaWT5Z2JqV1aGwjKBR1cwKmjnrvw86ShARCryc3Ii7aJumZaGgjJBZFY7uLru8zR06cyELrH457B/bWZTloaCMgFHFiiqODagavwoDoQjNXaiai2oYgcWhsIxwVVYLu5udGU98Kh0gEQru/829LgkphGWhwIxtdBQkyEyuH71/nFo5kBELLnxKq56Z/MxgGtAMUFO0j+tI/I5t2RoWMQq/XB0MbF0bOKAR0AwgUdSKvK/YvorrqhGxCNgfbsx+34tbgBHQCyRSZU4vOGusytnKXTARC51/WskY/guXZaGmGJZBIUCIWV5oGS3JmhZRCs88SM6Nn9+WdaHAjABZFMt9Sb7NvM66LcARCbj6z4n4KymJwBVwC9BXRc4KbYn8+M2qTUARCUiaKByYqV5S1aGgixRdNYh4uy8LKh2KQcEJqduM65/f/raVobCJsFOVzDruLwi+m9poMBEKT/4KPi/4i+EVobCLEFHVzs+PTYzJOvoNcBEIfN2tep6r7SFFoaCLAlW1i7v4/Y4bK2pSMQn6mp/Yi58spQWhoIrwUcWPOXl5Tyi4akKBCCz6iIkaKo3TJaGgiuBRxIp7zDjuL+0aNJEJnbhcKPm66eQQFUBapYja7EiqSGuKIUEKzJtI6L4qC1XVoaCJoFOFjBt/jxoMrzoGUQkM+G6OCZ/oRdWhwIoyUdZNW34vXf/8mlmwEQvd2OwqqX26roAVocCJjaIcxMyvizhLePh6WJARCLk/qCjoyW98ghOwTm2YEOSLavsKmc0qGlMBC0sYj3rpeYg5ABHQDNBR1IrI6D3b7u2KM+EJbt0PX/kpKTnWEKdLTZaRIUCPGpu7KBj+anKBCN/dKK19DW0DhaHAib2QF0TI3PiIXdvJWhqAEQu+eIv6n1/Yf5AToEl9oBOljMz4uTwePFpR4QjY+Ihc3BrcMgWhoIlgUcXOv76rfR0KWmJhCDtbijvtbgpWpaGwiV2gGsXJe+moqwj4+l+AEQibehmdXa6MZKWhoIlAU5WIr1u6z23pmjDxCHtZ34q9WBqEtaGgiTBRxYoorG08qu8aA1ELHV466o7KeeNlobCOUF5NDN9cu+06H1oLkBELir3IOJkprAeloaCOTZaRIUCOCmr96mhb+kGBCGx5zm0ZHN8HdaGwjj2QGOSLKT7rSggZakGRCi3eGGkKDH5LIB4wT/3wE5WIfszOOqxI6nOBCi9YWr3r3FlHlaHAjiJR1MiJGLnICe6qKyARCkn6vOlKCcy6IhdADhBZBctbzz9t/Au6G0ARCUkebqlc7N3TVaHAjMBTtMldzYl6HLxqXZARCds8TomIq8qfYBOwDLBTvQ0tW7k/bPnqTcARCn38GL25S85HJaGgjK2WkSFAiltdePsov1p1wQhovl/9GH2+NkWhwIydkhr0z9qviL7Z2UptwBELbdl4eWva7N3wFXAMgFV0iulumx5+37pTQQm7XH/524/eK+AR0AswUdXLOio5TRntqj/QEQsuGTyt6BzqhbWhsIsgUdSMfh0+3/sL6mSxCj28Dowfjel6AhI2Cx2WkSFAjH36S67dH0p0wQk9HIy6K1wb8jYQoE2WkBrVSYwvzFk4KnQBCTt5uu+KiD4gVaGwivBVVc19ji7dqj86GqARCzgbnS64HMu2BaGwiaBR1I2Jj0pt/mkKAUELDnvJaij/Xhi2EKAJklPkyOmeCZp8LNp/QBEJyb3a+QoqOEzAHKAJgFO1yUic2P+4G4pvIBEKrvgNmo1NHCRVobCJcFHUjWgbTmgb3cpyAQsqvD6tj6ooXIAVgAlgVYTOPVpZywhsCm1AEQtIWi1rSekobMAegAm0V9WPD7kZ/U66GmdhCWuanZkL6xmUJaGwiZRdJI9/j+ipPHhKI8EK61noKm7dPPoQFXAJpluUyf+svZ+7aWo9MBEI23gYf+l/qYzgGvAJIFO0jzrK3IuYvapzYQqKfHxL3ez+25AXQAkQV0WMng8uDckeKlBRCxm6HKk9aipBBaGwiQBTlck5XGv/WcpKamARCyre6xpujY/BhaGwiPBR0YyJDCxIvthcGmMIOdoOW777OTC1obCI4FHUjVp9GmnN/GpRYQnMPOv/GwwYLSAZAAhgUdSKnZmLucwr2hexC0vYOLnr3C9+UBHQCHBR1cjPSq6tSg76fQARCt3ajWur7x4wxaHAiIBehMmo7QuY6muKGSARChpYDOqO+g+tohBgCNBR5M+7S2lZOlwaXtARCTpcLkhP6AvKcB6QCMBelY+MiuxqWKzqJ+EICZxvjLj9nLb1obCIsFdUiryuO3hcTcomwQmee5587J/vL7AZIAigUdXLDji/2h3tqk2gEQpJeKiuaPmZRMWhsIiQUdSMXTz7jLwO6iDBCg072msszGg6YBcwCFBXNIq7vgiLzCraVYELH786r+uIGRMYGiAOCBFEikpNfBzPKjrCsQt7G5uZX1ioPrAXMA+EVETO/k+rbgq7WktAEQi7HbnIjN/e45gb8A4EHyWM6ls7S6sYCtPhCa5b7coorA6nNaGwj3BTlIu76bqOjpzqYsEL/1/aHqocHoyAGPAJMFOVidx/WymY+HonkQr8WUncq8gu8qWhwI9kWZTLbyyu6Y3tuhywEQi9Wtj+3dw5TsATpw9dlpEhQI2dfXkcHR16Q1EJr/ip+7/LmHVVobCO0Fc1zvzsPf+OOdo64BELzb8ais/f2pRlobCO4FHVzHkYzjiu+ooMUBELTRssKGnpiXfVobCO8FHUTMjdbB8s/loloQkIP5kZWBq+alF3T02WkSFAjQxMLsg4zgpDMQusOt+ZSv6Lg8WhwI89mBhUzDkeqYgLfFo9IBEIDb1ZGp74CSliE9APIFV0jE5cfD9qS4pyMQlNuvvo/LvqjZAcpw8dlpEhQI2M7qsIa5jKNoEITnyaWBx7GRTVobCPAFOUiqx4eD58K3pyIQqoWYg73C7KmCQV0A7AV0TJvT29+hqfOl1AEQkL/jj63tw6zJAXQA6QU7XIrnidH0sMOi/gEQiMnLruGNgeQ3WhwI5wU7TP2QjqTHtdil8gEQvuO345XP4ojdAZJw6NlpEhQIj5zg4enSmKZ2EI//nYuejdH3EFocCOAFOkzc1vPQ74n3pPcBEI6T2bbyvO+5zwF1AN8FdUil46eD29/YpX8QqKmJl4KKvJzoAR0A3gUdSJGAjeG/sqOhCxCR1Yy7srGxzYYBHQDdBR1E2Jz0uMigx6ZPEK63kJzz+5ewEpcJANwFHWSPwc/X3JaSoPEBEJftvqX7l7TQNFoaCNTZaQ56CUSMq4rjte+gAxCA46b3rsuUgRcOhwwFOUjKoJDwh5+jpcoBEI7zod/Si9T1DvIKANYFHUi9//366rvuoDUQgs2w58z72rePIV0A2wXoGKa+6YSXgvNhYyCWhdGg0sK+n98BHgDaBR5Mx7iLk8LKgaDTARCJycrmsoyakfIBzADZBVlclt+koL/JvqGTARCj8YXCg/jGoENaGwjYBR1I3NW4lPWP1KPtARCfq7Xol+/hlQE6ANcFHUT1v7Xrn/nZowwQtu3gjeWom9ISawwA0wUdXNa+rYeW2tCgkgEQudO37svfw9QPWhsI0AUdXJuZlebs/bCgsQEQqau54qT+pYEpWhsIzgUd0J2M5Iex2/alogEQmcWtxPX+9K4MWhoIz9lpEhQIvqzNjIuiyaZ9EI3jluHt08vjUVoaCMfZARzImrn50pag46dGEISR+tPJ/u+GPVoaCMbZaRIUCO6cz4Ld/cigaxCDufLkgurgvypaGwjFBXFcpozP6Zzo0qPJARCX6c+7k/aksFhaGwjEBR1ImoX12fmixKRoEJjRpufNvdnw0kF8cMPZaRIUCKK3zqPZ/7CjIhCx7eKOs5D4kF5aGwi7BTlc3uCSz+y+hqTAARCeserp3dHdojdaGwi8BR1I4PPR+dH0kqUlEJbnoZ3frLKgqAFW4L3ZaRIUCJmRgtffuJ+mfxCykbHqkPzJkx9aGgjC2WkSFAift8CIro3VpV0Qu/esyNis7rcPWhwIwSXoHPinjaqNhsahgS0csZWk3pmJidNBBgDABR5Msv3jjJe1iqO/ARCI55Dgl7mz2bYBHgC/BR7Qh7GYreuaoaXxARCDjaWxjIK6/MMBWhkIvtlpEhMI/rK/j5bq6SYQqofLzN6Lo7QhWhsIutmhiETBgbitk+btoUoQldOu4ry7otJlRQC3BedE1+eMxPvM8ac3EI/925bZh6ToZblctdlpEhQI5oOggJft1KEVEKKB2pvRuujP4QAAtgU5TKyM3960jPSgmAEQtK/kyPqt+dtVDtkLdNlpEhQIuLCu6u+kwaADEI3B54CBjcXIEloaCK3ZaSEgQLCct9DA06Z4EIvztqiYq7bwDm4OAKsFVRjmr5e7q//iDjkPMKvThI3LyJuxf1ocCKolARiaqNnC/PHL4RsgrJPIyZy/w/j4IZMIotlpocFAm7Pmt6KipAIQsI+1+Pe5x8VBsACjBVdI3oeUs5/RvKFlEK+h+8DgusH8wmEkAKQFHWTPuO6xnevxppwBEIbHxbe4v6noIVoaCKnZaQFWVMXQsqjyo6deEImHjbOGr5r5W1ocCKgFkEimgYClxZurouwBEJ6LkPqK2/HcZXsApwVX0NeF2YiSmeKg5AEQgIGM+5TCoJ1TWhoIptlpEhQIidmhqZiOiaFcEIDHxbikjLPHKFobCKXZIa9I/pyi0/6DxKJ2EImNvoqugIfHowGtAKEFVkjc3N7bsa+UpCQQvbnfqu+jm5TnQSIAngWRGJ2yr9K/mLCB1yCe2/fCx67ukZ8BHgCcBR5M3NaVoL7d9KXjARCS47zVzp7f8pUhP1yd2WkSFAjj/oycoOOdpTMQk9fiqLqF1uJBQQCEEgIISK2x6eio5dyldxC86cbvn8vhjt0BkgDrBZIYqOWRjeLZrYEpMJTPn5CfmqCQVFobCNIFHUigpeS28auhpFcQoYus9K2R8KqsAZEAuQWRTLfy3Lb98K6gzgEQh6XI0uzE4a28AR4AoAUeRLSlkMGl1ren5AEQuYGBjs+04AmvAIASeAhcweTF9Ja3zaFcEL6thtDa+6CcC1ocCJ3g4TxMwJux1NOMm6n6ARCYsd+GhbjEzc4B6QCCBTpEh9yW9bilh6V7EKv1or/+4t+MDuIMcP/ZaRIUCNuP3P+O1qahHBCYpeiC+8fppRtaHAicBVZMpMLYwbnstquJARCPxcLHvYusrNEBVgCBBVZY2oDouIrf9qRiEKy/qpHIlf/SdVocCP4FyiDGiP2p7vqipqfBNRi88c6j4Nz1AToAmxKzCET8ldmjne2Br0sQh7PS3YKbidoOaQsA/SU/XImGn6XP8LCkkgEQt5PljZ+G+qA1WhoImgU5WJm3tqX3t7KsLBCE543Dib3wtT1aHAj8BXNMkpHXxf350KXoARCUi9Tur5O7tLYhswSZ4EFiXPn/jt+5xtqrrAEQoJPw0ZbD1eAtWhsI+wV0XNn+q8nMl4ymiAEQrc2Mv7Dn1PFdWhoImAV0yOPZqJCQ+OSraxCt5+2byo+7gyxaGgj62WkSFAjf16q86YLqpHQQtrWQ78yy04gvWhoIlwU4WJeKrrXJi++vSRC9v76e14+bnFdaGwj5BXFM09W63pm+6aaoARC+p/jQho/YghEOAg8JOVSLtpfhuLysChCYs+Cll4aO+EJaGwjzEpMQGNTrorzZ0OUO4g0wreeX0vTJ9qh5WhsIrAVWXNyXkbekkfqjrwEQhNvnutjQ9pEdWhwIuRJ/EkzW6Imat4KMoogBEK+l2sOApNXs3yEfBPzbIR9gt62tl72g9aGDARC/8c+Kzrn4sklaHAj720FdTMWS0KXt0aGnkgEQjfvx+q7rjZnjQbUAgwVZTLXdkLnz5/aktQEQhL2+zLag84jcAVkAghLxEVykmKDOpcjLpP4BEIKl67KtzrfPeFoaCIES8BBYjumzrP2UiaEGEKCl+fSd5/zUJlobCIAFOVzkp/38wJ6DooYBEK7DmPLd062FSlobCP8Fr1y8msOVw/iRodsBEKjJta67kMqJNFobCP4FHUjs09D1/pzXoEUQmcPvuMbZytu0QXsAowVzWJ/1+Y6qib6nOxCB+b76k8Hm7XtaGwiOBXNIy+qsuNLTiaUGELHP54z91tjnhwE5AI0FOUTW8ZLig7WcoAcQkome3cLosfgOwQwAjCUDTLSfwqaA7eSkkAEQkfuNq/ie2NCZIQMAiwVXXIyL0OeKhcKi9gEQrZPd85ul+J5sWhsIigUdSJzzramY8cikfBCou5iUm4yd6tkhWwCJBVhMzqOMjOzQtqT9ARC5kbvd58WO+4gBWACIBTtEjKbsye76o6cCELbfqbLL85XmEkYKAJVFDFzxlqmyzajypfwBEJfB0sX04cGQBVocCKIFWEzv07aox/TxpsEBEJWhyN6ZqbHCzQFYAJQFOxjKgfnX6NPmIV0wle+0tc3NhJUJWhoIoSUHWICT1oGOw7OmIxCOp8Xuk57NzSRaGwiTBTlc472rivGM66W5ARCmxbzH87WXvhBaGwigBa5I9N2Ett6S16ccEJq1noy3xPz4vAFzAJIFOkjRxZ/jtfXdpnwQk/nFj4j09sC/AR0AnwU6XOjmzoW1i6eklwEQp+Wsk6KD3bdQWhwIkWX2TLaO89PVvfSjzAEQiKWO/tuF8+itATsAngU7RJqqooqX8L2mbxCsn6z5pZzlqxIHCACQBXVIh8mNwvbuu6MsELmrmJr7lK7kxyF7AJ0lI0y6hPau+8/6ougBEKrpmKrUq57b70ENXI/ZaRIUCIbbpsjv+6GnChCgk6mG1JiKxw50DQCcBTpM7quKqqi8waWWARCxo7Gl+Zeu6rMBOmCO2WkSFAjf56fG2rbspVsQi+mt5pOsnfosDjUTBTpM3tGW792bhqfnARCTmcOl6/rJpdABkgCNBepMoLnJurXLvKLaARCdsdyNwO6RqLsBWACaJZjIwO7YpaXNnKFvEIORtZajrsjlGloaCIzZaRIUCM/TwpSOnPUmEK3Znu3e8trikAFaGgiZBThYlf2j8bXSi6BRELOFk9OEqqzIYVobCIclPlyIoZfPjbGap7wBEIypm5/tldOnDlocCIsFj0yRorf82LbLpesBEKXbuvCE4fCB6wGPAJgFV0TetaW3scWXpisQkpvCufyWxY0OJA8AiiV4XI3introv5iiqAEQrfnl8dTwqb1BWhwIlyUETJazxKSl+5ugtQEQiIWlk+nB1+DXIdAAiQU7XM6p88rGvP+nsAEQg9uwq6PNg+8+WhwIlgU7TPaf/eeP+YOl5wEQqOuti5jeuOKzATsAiAU7TNbCrtO27vOinwEQou2M5Zf6wcErDrcPBepI0b/b1Pal8aE2EKTZ9Mj27aiXiAHMcIfZaRIUCN3V5NKo1KOgbhC/h9Sx+Ivs6GVaGwiUBTkg+5/Q14WTsabODpcWGIzv2ZPztGgOdhQA3AE5RKrFjcPm4symURCQ95Hh05fTvsGuAJIFrUyBzejbipGIpZwBEIWx6fym+rmp2wGtAJEFV1yy46KW6rbEpuUBEKmL1L2juuW7A1ocCJAFO0z+2/n/wfvcpf0BELWD/9OhrtKQlwE7AI8FO1zw2Zmu6YOMpZMBEKbj6O3h97rXG1obCIYFHVzq8/T4kLmiosoBEL/jmLiYkuKVdVobCIUFHUiTi7Lsq8TCo4IBEIKj2Iq+j8G5DhwNAPqlVUiThOPN7eeToJ0BELPP3eeSyMbrDtEUAPnFIUy74qy+zZ+LpqkBEJbbv/T69+WLwEG5AP0FHkyv2dj9/u+po7oBEIzT05Lk86/ihwGwANAFWVy8yJ2Dx++cpO4BEKj1xc2CurfmdFobCM8FHUi3l4HLu6D3oNgBEL7n9Zf0/9C6oTsA1wUdYIvT7ejWs9uj6wEQl8/exKrwju9wWhoI1tshfFj05tKTgZ7Oo8UBELbnkeWUzMYqWhoI1QUcROT14MPBidKhThCPkYL48byTkeFhANQFVVzY7MS61oLhpKkBELfjmZa+3cu6LlobCNMFHUzcq5P27o3noL8BEK7z25nO+qSKXQ74CQUdSNKT5IGn+tmiQhCQhaKTtaXhvP4B5gD3BR0czMCvureLy6aBFRiLk6Tn4f7swesA4gUdGOCjnpisyIEObRkctdGBn4zNz5YOShcA4SU+TIi8j/yJkbyh0QEQor/+/fDn6e74AVgA4AU7SIGuudihv4ilBxCR956O28K0racheQDfBTtMkMKNn5Gvwqe7ARC1p5DZycf134UBOwDeBTtc44qRiOnMvKXpARCNjdjN34uc0ltaHAjdBTtI/KP8x+SmuqPXARCBp4Sq88a+4sWYANwFHky+1eytlczsp+IBELiByd7zvI3b9wF3APYFHkin6d+5yuHIp9gBEIv74t7h2ovMEogQAPUFd0ihpePl4qnsoQYQoaeStrSkqZHVATsA9AU7TI+rrp+Ukvig+AEQn/3Yrq+ziueQAR4A8wUeTJ+A76/RjNSi4wEQofnmpI2X/eCEYacA7SXWWP7YrNeW5NimeBChldiM8u+RmhNaHAjbBTpMkePJiq6djqaGARCo5aKqwsftt90hCgDaBZNI0IrosebWmqNkEJrtzabn4IKLhwF1ANkFO0iZm8i9l6bNpcABELOrppnPrfDlRdwAzgUeTKy285jOseOgggEQtInrmNm0jZraAVkAzQVZXJzp1vq/59aj8QEQicWG5MPfxdU2WhsI0QUdSNLRwbv13vGlhAEQjaenkpDjyfAOuxQApAUdTLDP7Om41ZOnwgEQr4mxrMSruZwlDu8ZBXUY08iiweO92CG6IJfrlZSr7ozJvQF1AKsFOxiY6fKhi8T0Di0cMKHD+9u1stjpSlobCKoFHUjZr+img5Txp6MBEI3fy5m/oI2XDroMAKkFHUig0uiRn/b5o3MQj7e9w+ey+qqfIV8AqCVfWNngtNvZm8GmUxCWq/G0u6PL4hpaGwinBTlc/53v9MP97qTGARCG+deC+6Hf2yVaGwimBR1cir2No/mpp6OoARCJ9aSB99W9mBhaHAjLBctMi4fvtZ2KzaOSARCWh+GUsY610dMBywC2BTtIlI6o+vOyyKYUELWDlLjqw/Tb7CGZALUFOxjT3//I+/XmDiEKHKbXlbiqlt/bRd4AtAU7SO+64o2HtJKggQEQm7P83OPhrskOVg8AswU7TKSLgtPgiNygoQEQno3h07uhnN7hAVkAsgUeTIDw2tjggdWhuwEQs9Xx4oqaiI/nIQgAsSUISLXq/d/n9POgBRCznb6zie+b9hcOthgFHFjS4JWUzN23oTkQju369afr4MJyWhwIygVWSJnMnqH33vunwQEQpr3eua7zla8Sog0AyQU6WMaMz9ydwoenHRCm0YiEjYPUs19aGgjIBRxEi7nsr7uG3aY1EISZv4G74ZbHoXoAxwVWIJOZ9YOIo7ikmw6iDRjkroLfvPOCIUAAxiUFSIH0h4SJ4qOkaRClo+2E7ciPrq4ByQDFBVdYjejW24H75aVDEJHXxtadzPm+GlocCMQFVxjGx4Pl1Oavoe4cpdPM3fbEkroS5w8AwwVXXNjApeef/Zmm3QEQqfuUvePR3a4fWhsIwgUdGIWJ5rjE54dlMBjjxtvA0Zy14aMAwQVYTNChsoi3ipik+QEQlM/tjZG50vyOAa8ArwU7SKOWoMv85/uiywEQpPXjyp6tz9cOcB0AwAWvWL77/sT888ykDxCZ4dWeh5KgjGpaGwi/BTlI5a//hKrI6aJcEJGhxuqXoKzc6CHPAL4FdEi5oOi1yue4oMwBEJmrt7usgv70ZS4AvQU7RJjokMqFj5OgJxCXo82o16+yzBISGgC8BR1c5tT8j/zq86aaARCY8f7pm+qC+m5aHAi7BVhgjrLevf7HzaWWARCT//Gx+YiM2eEBWhsIugU7SM+M8Kz4rreingEQgfermeCf8NIO7xAAuQUdXOzIpeGKgIKigAEQjbPszea+1KwvWhsIuAkdRJX87q7IsqE8ELKX7Z7XlrinvQHNALcFdUyIi4+wl/WHptkBEJ6RgoHi7O7h/wF1AK4FOyD1nua60NLdoYAO2iEo0uCgjdH1MlobCK0FHVyhsuuE2qGep/ABEIqp07bU7NfnTlobCKIFHUTivZTw8cL6oH0QqJGnqpCfjb0SVxwAoQUdXLqW5pbDgPmjvQEQt7G+zK+Gu9VEWhwIpQWSSM7r74rS3uWn0gEQhM/94tnxkb8SNRQA6xK2Hli61+7Ylem7oAQQlvGJm4n43rgJWhsI+BJjEUjZr/PxvMTQoO8BELqxy82cz+fRoQEE6tcOkQ5cr73YzNaX6qG5ARCw+caWqsOe4V9aHAj3EhMaSKG/4bbGsvWl9QEQit+M2a+VtI4SMAwA8gU7SO3uycvBlNulehC10bifprrH24QhIwD/BXVI0dW3qf7sjaErEIiZtpbso6WZqWETAPEFrlyV7O+syP3npzwQqLf90rnbxNVpWhkI/toObRREzIaYlo+t+6VsEKjd2+ixmqUnDmIYBXFctr6locGEvKc8EKfvoY28n9KClAFaGwj9BXFIlc/wyYWqn6axARCUt+/CwuGs/w6+DADvErkfTMyro63tgbeglgEQp8+E5tL40oatAY8E/NoOxAhEgLmOveGT5KEaEKuV36G3+rvbDlYWAO4Fq0iAkNieyKnIoTgQkL/Oo8bh2I0dDs8QBXNIwN2Ft6PEm6BjELqbrKf34sS2rgGQAO0FrUjIoZnq6Ljeo9sBEJuv7fe8tJqYQSQA+gU6RPvbxYTGnrOmERCX05ChiOXUjxIYDgCfRQdI5d7L05SO6KTZARCip4CF1Mmj/Q4mGACKBR1IytWUhfHTxqT2ARCjt9PL+b754Q6SDwCJBR1I/9vx/b6W/qLOARC+gbOtn6bMkWG9AIgFHUTtteC2/rf0oH8QnI+/hrOAidMSOAkAhwUdSJyykP+HiOyhSBC7n/LH+7mB+O8BywCGBR1codnlqd+Ni6XGARCaxYOB+8GsokhaGwiFBR0Ysauz4t+gz+ElMICx4Mvb4pKsDVobCIQFHUiK9JmR+I2hpWUQmO/p7eWGjJ2RAVcAngUdRLG9pKzzgZWiQRCHkcmDstj+lCU/AJ0FHUyfjKrn1uzPpTAQmJHx2KDW7MfOAQ4wE2UMSKru8qyatbWgyAEQsYW2r/yklvgSLAgAmwUeTOGQg9eZvden2gEQg8uKyPrmpL/rATwAmgUeTKGC1ajqjOej7gEQh8GZrpq7tL2PQQsEmdtBC1imu5GgpL+apTMQmofi5ay62oFWWhsImAWTSM6yu7ap6cWhCRCJi57ij/vgsNgBzQCXBR1IheTAwNjW46CAARCd2eTX1IfJuw7hIgCWBR1M1OqzpqWetqWPARCJtem23MSFvhUOFA0FHUiwmcKtqY7LoBAQu+XjoI6tkZ7yAZAA9kV/WOv/j9CeuI2jehC984rkwKzqxl9aGwiDBTlIhZeGkffhz6AzELLF+NbUlKTG6AE5AJQFyVjh3LnP+5nbpxcQmd/Iwp6q9JkIWhwIkyUDRPTT7Iiy2qKkwgEQtZvK7LfDnQ5XCggbCJIFV0iP2Z3u3Y/doO0BEL/nxqjCw7/YDv0hAJEFV0TdvM2O/NSsIRCUo62/zf20s8YhAwCQBTlc4trN0qnam6OjARCe+e7YkeCo1kNaGgiPBTlY2qXNz9Gu1aMZEKelnqecztiwRlobCI4FOUjuk+Wx/Lnjoy0QmZek+5OWsKPiAVYAjQUdXPamvJT1wZChdBCLgZ/Rk9DfqpQBWhsIjAUdXPqW/q6+lNanswEQkJWVrNyE54YVWhoI6SU8WPP0lsrGm8qlfRCcj+D+vuquvQNaGwj2ZYFgt4zvk6HShKfJARCL+fafquup2RxaGwjo16EUSPD32uSWkuSiRxCv7f/VlM6Ttq9BQAD1pRQY/ZPApdmu8w7EFByQsa+D+KC+sxIPEgDsBTtcnvHbjqOx26ORARC/vbiU4uWPl2VaGgj5hWhYl/KT96Sn+qY0ELvDxoTqttGFBFobCMwFkUinnNrrk5LcpdQBEIix5K377v6WDoYaAMsFHRi4qdmtlYbpAVYwmbf7lZbtzOkZWhoI0wVWWLWiuL/ahvGkTRCzo43vqcS2mRhaGgjSBRxExv6Cz9zmqqNGEL77sp2pgaj9DocOAMQFqxj+zpmPlrz2DsAKMLST8/Coxp3uXloaCNEFOVjpmOiEx8LuonsQutOP+8Svnq8GWhsIwwU5SIW0k5Kbg/SjFxC5sfT78q26p6IhHwDQJR9M3pb5haTIuKC2ARCl69akiOSzybMhsADPBclIjqaLgZyVkKJmEKat0KH/ue//p0GzAM4FdFj00/zH1KHwpGYQtL/X/P3r0+d6WhsI5gV0TO/PvPX4m4impAEQjI2m1b3U4vovDq0VBVZEk4f4tJyhjKYUEISf25+vs4bHElwIAOEFHUj64ePPwdOyo5YBEJ2J59XEpPz5DlgWANRFI1i58OC899+conoQoMmwnuDDws9NWhsI3gU5XKDWt7213sqm7QEQs9mhy7eHlo0eWhoI4AWsWJ+9iIm+/MqmcRCyjZGxiafZphdaHAjTxW1Ivv3Qj5uTrKWRARCs2470/tHs5aVNAN0FV0Tx2cOKh7WpozsQq8WM7/296uMSiQsA3AUdSL+iiLm90MOkfRCCo7yax5DWqtYhPQDbBR1ImbGu276QnaQ+EI6fsOryp665wQEdANoFHRjwub/Jg+TUDh4WMKT3jovitKeAfFocCNkllUjT2vnmvN3IptABEKTTm//F/Jb+Ej4NAOUlXFzM4f/h4oD1p6sBEKy9/t6K2e6Vb1ocCPIFOyDmop+3x76MpJoOlw0Y8761gaLQ5wF2AOQFO0jWjoLOo/H8pvcBEKf9iMr4s+bqDscqAPEFk0jZv4Wole/toLwBEKPLxt7DyLytDgQNAOMFOkSwmZjRydbApxIQk7GygNaDme8SzRYA8AU6SMSg7Ou94o+iJhCTrdiwuqnTq6FBJwDiJbRElYmk//WO8qV6EI3l2vfr2vmGDmUZAO8ll0SH2OzU+JCbpjEQhIPCrvKa3JQOkw0A4QVyTKed4Y3uqNKkiAEQjLnHityEjfcaDmohBXJE1Lqhr8r0s6AVEJmFw/j1veOkEtoKAOAl0UyhpoeUsLnWop4BEJf/od2ZvuT3/UHyAO0lIki69Lqhi5OEpJEBEJ3Hl+ee25neEusIAN8FrkT2vdyVrbCkpTEQhKG5+NHup/0ODQoA7AV1GJjJiIG08rUOTikcnYvAlPfBzYUOtBcA3gU5RI+C9oOr0p6jURCHqd+Z6sm0rw7ZIADrBXNM5ummsO3+z6P8ARCom6iZp7+urcIBkQDdBa8Yrp+Akr+EuA4KCRyAqa6AiZjh7hJ2DQDqBTxIq87ei4rDqaLqARCO7fL+pNTx+uV3ANwlJUjnsavrhbqopCgQgOmmkaLdupLDAVkA6QU7TJyA+9q04YyjwwEQqtXJ4++CufDYQQwA2wU7RLSf+5ac7sKmXhCordSIrZSxxhIzIQDoBetImorzq86axaMFELDHn+++7+eE9AE6AOcFHUiH4Oa/qs/IpXgQk4fB7a6l+t7QIe8ApxLdE1jDmrzxkvD3p0UQn9O/uKGF9eVFWhwI4gWRTMXq/uvRmf2myQEQo6Pq24ucsYaNAa8AphLAE0z9loGB/b3ApIsBELqPzt3o7/igiQEeAKUFHhiP2sqPu47yDtktIL3D3/qg6earugGTAN8Fk0i1tqaV5ZWQpHYQhueI7+/gu+bmATsA1gV3SLWo8ZvXhJql9wEQtvWr6tD+sIbFsQDVBTtMpO3e8cij86K3ARC1z+vg6YH3sUAOYiwFHUiIqpus36+QoGQQnt/vuunpkqXJAesAyUW+WIDjtInJ/sWndBCp7dbW8OeXvTlaGwjNBTlEzpT0+rOriKBKEIrRmoaJzLi7Em0ZAPRFLFitvMnKtvymp0AQgcn+8Kn7w586WhwIgeXtGK2627q69uOh5yCbydmN7dzQ9csBywDlBR4Y18mQ/Kz3wCFCILaZmayR9bKXsCEGAKAFdUSL0f2z6tzHpt4BEJj7w+iN9acSThMA5OV8HMeQ1MKQ4+WgDloVHNf80dK0ztJxDvgtBTpIwr3nibqmjKGbARCqk/XNuZelvw4PCQDsBTpMzOWCuqSho6LHARCU6aupkqfopUgO5BAFOlyIwaal3rOUoNwBEI7Tm5iyiuDTbVobCOsFOkzO9/DawfiFpecBEKezlfLH98nqRQ7kJ0WBSJ6J7aLc7f6jHRCvvYC0o7aW2okBywCmBVdIo9fr2b/7h6QOEKKhyvyX1JjevyF5AOoSnQhY6rGBxZDMhad9EIm7qcvu9peFIFobCKUFORj/ibep68zoDj8jHJ7vlKrsqZXuYcIA6QWQGKfg34milZZhiTC/6beToJLto0BaHAikRSdkofiM68mVkqH7ARCpy4DWt8C917QBWhkI6NsO6AxUkfuRk4qIiSYQp+fVvoy60rVnWhoIo0UIWMDphdDU1YaiKRCFk/yoxcnf8mxaGwjnBXJc2riwobruu6WmARCDm/+hrZXX8nFaGgiiBTlE/b7s6bX1iaBAEI2LhbWS4YanDg4YAMcFyEionuG1u82Vo28QmbHLk+3hi6rRQQcAsgWrGMzsgonGucUO5BEcov/I"
-			+ "q8enxrplDQCxBTsYpb+qy7uqlsEhMKr9/paP8szjUFobCLAFHUi5sef33PygonIQpNf3/6XgscauAVgAooWLTNSz7b3usOOj0QEQrdud8u6SjcmfAR4ArwV2GIq5zJ3KiMAOahkgpv+4vayg+vT6AR4ArgUeTLX+itObitmhqQEQk4mbyZyH6N+pIdAA8iUISK/Ei9OY3PClBBCM7frM5d3agqwBHQCtBZRI9b/xrbCL6qNzEKP1/8SAucXGvwFYAPFF8xiyxPyYuvv/AVgYovPt3u/Mzg4zLQgbCKwFO0iGuPaSovSKo1cQksmiwvnOzpHcQSgAxiVgRL37iL6zwKCmMBCYi9yvtKDRjA6HCQDFBRxYx7TfldmZpqSEARCMydj35YKsWlobCLdFmkirm+O1rsLMozAQiYmAl7Cc4M/ZAa0AxAVyXKy53va1xein1gEQtsOvg+iJyIseWhwIwyUFTMji68aUp8igmAEQnJeXvZnTt4S5AcsAwgUeSL73uorOhfOj2gEQps2bjN6Ov+ISgw8AwQVZSLH6jNPL05qjCBC/k/WZ5em35MMBdgC/BR1I4O75zJKUsqE2EL65ysKhmcbh6QHoAL4FzFjL94u0+Z2PpRsQnPvSn9KIjI05WhwI5QV0TJ3Xv9Xttuqj1QEQkfme5ovd8aWYAVcAvAVXIILo2Lfr5Zem0Q6RCyjJ7bbtvtk/WhoI5AVXRIW0+YXdm4ChdRCgofeRuoTpuA4JMQC7BVcYhfrf9fSCoA6JFSC8x/aTuZzw5ucBVwCoEjMZSKGs8p6i9v+iQBCMid6A9YusrKABrgDjBVdY2ZrVpdyt2qFdEJ6xjbr235TOE1oaCLoFHFiF3L7b0uf1ozkQqqPmt4mXrt4xWhwIuQVzTN7+wv/t59KmtQEQs7mDyZPV8KW1AXMAtgXKSJay54OustinfRChkdWLtbKig7IBHQCzBR0Ykuv134W5mA7jCTCdw7imvMeKxHxaGgi4BXREhqiy+4eXoqdFEIG1r7b5i9zzDoUkAPVFCkjDp/uZ7ffYpSsQi73y/o6EveTsAckAgoWHWLGZmszp2fCiBBCXjZbnu+fO0WZaHAjmRbYYj570zP3HxQ6RIByj/+bYmL+MwhKWHAChBXNYj/zJ9ITUgaNZELiB7b6Bxo+EM1obCLQFrETzk5Dmkbzpo08Qga/Mjdjo+dsSVAoA2AUdXM2+/+vPwrimpQEQkq/QkJ6K74MEWhoInQVWWODwyq+xgd2jPBC25bbM3ZXHl1xaGwjXBTlc4oq23+fIwaPEARCCj5fVsO+8+h9aGgiLBclE3byLlu7NxqRREJGpwNW7763bDvksAO9luVyeq4eVldmfpo8BEKu9u9Hy352xBVoaCKoFckS2sLC5hpGGJRC+86312LWXy7FB7QC3Ja9MypC27pWE7qWJARChn4/0z8zNocohkgDABZBMo6jL+tr9oaHmARCYlZG33frW1VMO3gkFdFzY/uX5opHVocgBEIfhz9f/+YGJHFobCKkFOkiy5I7Y64aXphIQt9mW3dLntqiEAXUAtQV1TJKb0Mv65ZCkhQEQn5v0/dvogMm8IbEA4wXoRNuNqNTBz4iiWRCRqai+mYfHycE4AJ4FV0yf/6ie0dvvo/QBELrnobGit4H9dA7KEgWRGJq67tSD7vUOnzMgj42wuufM4PNMDhs2JQVY0/jWnL7njqd2EIHh9/iT9bDKY1oaCL0FHEie/92nj/eVpW4QttGzw+Gh5ugtQSMFrFD4ttrVrbC0p+EBEI/57szzyaGikQEOJTgYnC4IARIIRBq0NyaqNwQyCA7ONxQQleBpMgQBCg0QBKbcEQoApRUKAKEVCgT/3xEeAKAVFACfFQoAnhUKAJ0VCgCcFQoAmxUKAJoVCgCZFQoAmBUKAJcVCgCWFQoAlRUKAJQVCgCTFQoAkhUKAJEVCgCQFQoAjxUKAI4VCgCNFQoAjBUKAIsVCgCKFQoAiRUKAIgVCgCHFQoAhhUKAIUVCgCDFQoAghUKAIEVCgCAFQoE/9sxSgD+FQoA/RUKAPwVCgD7FQoA+hUKAPkVCgD3FQoA9hUKAPUVCgD0FQoA8xUKAPIVCgDxFQoA8BUKAO8VCgDuFQoA7RUKAOwVCgDrFQoA6hUKAOkVCgDoFQoA5xUKAOYVCgDlFQoA5BUKAOMVCgDiFQoA4RUKAOAVCgDfFQoA3hUKAN0VCgDcFQoA2xUKANoVCgDZFQoA1xUKANYVCgDVFQoA1BUKALEVCgCwFQoArxUKAK4VCgCtFQoAnhUKAJ0VCgCbFQoAmhUKAJkVCgCYFQoAlxUKAJUVCgCUFQoAkxUKAJIVCgCRFQoAjBUKAIsVCgCKFQoAiRUKAIcVCgCGFQoAhRUKAIQVCgCDFQoAgRUKBPfaUbIA9hUKAPUVCgDzFQoA8hUKAPEVCgDwFQoA7xUKAO4VCgDtFQoA7BUKAOsVCgDqFQoA6RUKAOgVCgDnFQoA5hUKAOUVCgDkFQoA4xUKAOIVCgDhFQoA4BUKAN8VCgDeFQoA3RUKANwVCgDbFQoA2hUKANkVCgDYFQoA1xUKANYVCgDVFQoA0xUKANIVCgDRFQoA0BUKAM8VCgDOFQoAzRUKAMwVCgDLFQoAyhUKAMkVCgDHFQoAxhUKAMUVCgDEFQoAwxUKAMIVCgDBFQoAwBUKAL8VCgC+FQoAvRUKALwVCgC7FQoAuhUKALkVCgC4FQoAtxUKALYVCgC1FQoAtBUKALMVCgCyFQoAsRUKALAVCgCvFQoArhUKAK0VCgCsFQoAqxUKAKoVCgCpFQoApxUKAKYVCgClFQoApBUKAKMVCgCiFQoAoRUKAKAVCgCfFQoAnhUKAJ0VCgCbFQoAmhUKAJkVCgCXFQoAlhUKAJUVCgCUFQoAkxUKAJIVCgCRFQoAkBUKAI8VCgCOFQoAjRUKAIwVCgCLFQoAihUKAIkVCgCYFQoAqpUuBMvXkS4AqxUUAMwVFACFFTIAiBUKAIcVCgCGFQoAhBUKAIIVCgCBFQoAgBUKBP7ZEW4A/RUKAPwVCgD7FQoA+hUKAPkVCgD4FQoA9xUKAPYVCgD1FQoA9BUKAPMVCgDyFQoA8RUKAPAVCgD/FQoAqTUEAMo1BADsFR4A7xUKAO4VCgDtFQoA6xUKAOkVCgDoFQoA5xUKAOUVCgDkFQoA4xUKAOIVCgDhFQoA4BUKAN8VCgDeFQoA3RUKANwVCgDbFQoA2hUKANkVCgDYFQoA1xUKAOYVCgDTFQoA1hUKANUVCgDUFQoA0hUKANAVCgDPFQoAzhUKAMwVCgDLFQoAyhUKAMkVCgDIFQoAxxUKAMYVCgDFFQoAxBUKAMMVCgDCFQoAwRUKAMAVCgC/FQoAvhUKAM0VCgC6FQoAvRUKALwVCgC7FQoAuRUKALcVCgC2FQoAtRUKALMVCgCyFQoAsRUKALAVCgCvFQoArhUKAK0VCgCsFQoAqxUKAKoVCgCpFQoAqBUKAKcVCgCmFQoApRUKALQVCgCoVeQAyVXkAKcVFADIFRQAoRUyAKQVCgCjFQoAohUKAKAVCgCeFQoAnRUKAJwVCgCaFQoAmRUKAJgVCgCXFQoAlhUKAJUVCgCUFQoAkxUKAJIVCgCRFQoAkBUKAI8VCgCOFQoAjRUKAIwVCgCbFQoApDUEAMU1BACmFRQAxxUUAKUVFADGFRQAiBVGAIsVCgCKFQoAiRUKAIcVCgCuImIMAK0VCgCsFQoAqxUKAKoVCgCpFQoAoxWCAMQVggCiFRQAwxUUAKEVFADCFRQAnxUUAMAVFACcFRQAvRUUAJYVFAC3FRQAkBUUALEVFACPFRQAsBUUAI4VFACvFRQAiBUUAKkVFACCFRQAoxUUALkVFADaFRQAuBUUANkVFAC3FRQA2BUUALYVFADXFRQAtRUUANYVFAC0FRQA1RUUALMVFADUFRQAshUUANMVFACNFRQArhUUALM1mgCyFQoAsRUKALAVCgCvFQoAoRU8AP/1HACgFRQA/hUUAJ8VFAD9FRQAnhUUAPwVFACdFRQA+xUUAJwVFAD6FRQAmxUUAPkVFACaFRQA+BUUAJkVFADSFfAA8xUUANEVFADyFRQA0BUUAPEVFADPFRQA8BUUAM4VFADvFRQAzRUUAO4VFADtFQoAyxUeAOwVFADKFRQA6xUUAMkVFADqFRQAyBUUAOkVFADHFRQA6BUUAMYVFADnFRQAxRUUAOYVFADEFRQA5RUUAMMVFADkFRQAwhUUAOMVFADBFRQA4hUUAMAVFADhFRQAvxUUAOAVFAC+FRQA3xUUAL0VFADeFRQAvBUUAN0VFAC7FRQA3BUUALoVFADbFRQA0xUUBPTXDmwSBJ/gHqwJBKPcARAAghUQAKIFEEiB4Gk6CggJEgYImNdpEAU6CggIDQwIAVAADp48AN4OpyFE8e2m1vSq26YbEJffruKW6sL+EnUyAMwFHSDU87bgyuLzpasO6EcUl9uc/4aDDi0UBIrdAToY2fCU4tPh7g5tFjSah/icmomggnZaGwjA3wEdGJTD6aTrqpwOZUI0kbeUxKf3haoLWhwI398OozVM9a6c1tfdo6TDARCN27qY8Maf7NYOEBQAgRKNRFy//5WPp5nRo2QQq8uLu6+5jdlOWhwIjd0BOkywkZTh5Lj/ookBEKyzpLTF4oKv1AGSAP0S4RZIxo3l0Imu5ac2EJCNmdC31pHC0QFXAIIFV0SywLH32szLpGUQkLvI0JPDodMOUjEAvwXoSP++u6LinP+i8gEQobG4mqjdpYQOvR8A3QV0TLHz4JvhwLCh8gEQvandn6jfvcnkAVcAjgVXSM/l0si1nYyhLRCN64r4p5zz4zcO00ElIhjVlJ6vhpSlDrVIHLTx772H6s6rDgA3AKASvhRckPCG++/m3aeMARCUz5aS3ZnwxSdaHAjUJSJM7a6Rpb+ip6K/ARCAo4jQnO/Iw/oBdASc3g5gJVyAibDpw8DAoGsQotH0tPn59ZlbWhwIod4hIkzDwpTGjp3Zoa8BELX9hJzr54z84A6KFQCcEt4USI3tjJ7+pNqkrQEQn5+ZoNTk384S1h4ArgV2TJyV9vDhqIinyAEQqZfI38SJ36DjIV4AyAXOSImBipnx6YajNBCKhdC/56TgirUBWQCMBTsY9uuv/OO96w5lQSCLk5eihNen8JgBOwDdJWBE5tGjpK/Jr6RlEJvriJ2S8f6DEj8yALtFK0jilIS42eH0oUcQuJeIi7nsjdimAVgApBJhHlDbvay11+66ouEBEIzPyIGZ1bGQlAEOli4SJzNExuHnmYT3g6dBEICtnpiSl6GXEhonAPglYUjBkfnKqpvSpucBEJGN7bW43MriDvkrAJIFklyvwZbphPL5o+EBEIu1gv6srZytClobCMgSdhZI/ejwmKDD/6Q9EJiNnJPQ2Kqk8QF0BOrZQdpEzsihusiH9KQfEIXHj7fg1OjVEpo4ALgFHVzrvKft1P3LpYwBEJCh5s2exPHjHloaCPQSdxZI4svZ6JOdjKVEEI2l77+AjNmCZg7AJiUFTLzHqu7D1bqhuQEQnL2RwICHlr4+DqQmBZBUoYq70tS/j6TvARCWmd6kuunX9TZaGmHXZBIUCO2+t/zUsvejJRCR8fnxpojwpBxaHAjMFvAYRIzTsbyKoqbSARC4/c2bz8vKvGUSYJ/ZaRIUCLn58av2z+imGhCA2ZLVjMf84lcOfxkA3QEc8H2mjqLc65bHpBYQqb3/xqifjPdYWhgIARIUCI675N/DuOaiMhC1javu8L2H/ipgwwYiYggJEhR77MsZ0Vh+/+wDxVDfElUiEnjdQRoWdGlsZV9wYXBlcl9tZWRncmF5LmpwZyIAKiNnaW5nZXIvMDBiX3RoZW1lL3RpbGVfcGEdK/BGUgmiBgYYASgAOAAiUggXEhS8CVQSNJPzhDYnJUxI0jHeRGo+DhocYnVsbGV0X2NpcmNsZS1ibGstcmVzaXplLnBkZiIAKhheIABwImAICBIUsdhFQDYLqEQSKezCb1NTnH3OBL0aFXQZuAxsdGdyFbcAIm63AAkqLrYAkF4IDhIUFjVxmMf5kTXeSKObaWHff9pyyPUaGmhhcmRjb3Zlcl8NoDBibGFjay5wbmciAComEWcIMV90JR1WLgAAKg7IUAAyAQU4OgMaAQBAwwZSBAi14GkeAQUQEhgIh1YWklGAKCoMluY9r9sLiMtmsNsLCggIDhIECJbmPQoICAkSBAivBRREFxIECIjLZgoICAgSBAiw2wsQASMMEgoIhg1HKB8KHQgBHYiHBz8lAQUALQEFHDUAAIA/YAFtAQcAEAFJQjAAEMHAwD4lAQUALQEFNjAACIjLZkIwABCenR0/JQEFAC0BBTYwAASw20ZgABCHhgY/JQEFAC0BBSw1AACAP2ABbQAAgD8="),
-		Entry(path: "Metadata/Properties.plist", base64: "YnBsaXN0MDDaAQIDBAUGBwgJCgsMDQwPEAwSExRYcmV2aXNpb25fECFoYXNFeHRlcm5hbFJlZmVyZW5jZU9yTWlzc2luZ0RhdGFcZG9jdW1lbnRVVUlEXxAbaGFzVW5tYXRlcmlhbGl6ZWRSZW1vdGVEYXRhW3ZlcnNpb25VVUlEW3ByaXZhdGVVVUlEW2lzTXVsdGlQYWdlXxASc3RhYmxlRG9jdW1lbnRVVUlEWXNoYXJlVVVJRF8QEWZpbGVGb3JtYXRWZXJzaW9uXxAnMDo6OEI4OUJDNjgtNjRDMC00ODM5LThGQjItNkM3QjExRDEwMDcyCF8QJDJEMjM2MzFGLTM1OUQtNDI0Ny1CMDg3LTRBOUJFMzY2M0I2QwhfECQ4Qjg5QkM2OC02NEMwLTQ4MzktOEZCMi02QzdCMTFEMTAwNzJfECREM0M2N0EyMC0yMjNBLTREMTYtQjU0MC0zRjdGRDZGRUM2NEIIXxAkMkQyMzYzMUYtMzU5RC00MjQ3LUIwODctNEE5QkUzNjYzQjZDXxAkMkQyMzYzMUYtMzU5RC00MjQ3LUIwODctNEE5QkUzNjYzQjZDVjI2LjEuMAAIAB0AJgBKAFcAdQCBAI0AmQCuALgAzAD2APcBHgEfAUYBbQFuAZUBvAAAAAAAAAIBAAAAAAAAABUAAAAAAAAAAAAAAAAAAAHD"),
-		Entry(path: "Metadata/DocumentIdentifier", base64: "MkQyMzYzMUYtMzU5RC00MjQ3LUIwODctNEE5QkUzNjYzQjZD"),
-		Entry(path: "Metadata/BuildVersionHistory.plist", base64: "PD94bWwgdmVyc2lvbj0iMS4wIiBlbmNvZGluZz0iVVRGLTgiPz4KPCFET0NUWVBFIHBsaXN0IFBVQkxJQyAiLS8vQXBwbGUvL0RURCBQTElTVCAxLjAvL0VOIiAiaHR0cDovL3d3dy5hcHBsZS5jb20vRFREcy9Qcm9wZXJ0eUxpc3QtMS4wLmR0ZCI+CjxwbGlzdCB2ZXJzaW9uPSIxLjAiPgo8YXJyYXk+Cgk8c3RyaW5nPlRlbXBsYXRlOiBCbGFuayAoZGV2LzE1LjMpPC9zdHJpbmc+Cgk8c3RyaW5nPk0xNS4yLjEtNzA0OC4wLjMtMjwvc3RyaW5nPgo8L2FycmF5Pgo8L3BsaXN0Pgo="),
-		Entry(path: "preview.jpg", base64: "/9j/4AAQSkZJRgABAQAASABIAAD/4QBARXhpZgAATU0AKgAAAAgAAYdpAAQAAAABAAAAGgAAAAAAAqACAAQAAAABAAAC1KADAAQAAAABAAAEAAAAAAD/7QA4UGhvdG9zaG9wIDMuMAA4QklNBAQAAAAAAAA4QklNBCUAAAAAABDUHYzZjwCyBOmACZjs+EJ+/+ICKElDQ19QUk9GSUxFAAEBAAACGGFwcGwEAAAAbW50clJHQiBYWVogB+YAAQABAAAAAAAAYWNzcEFQUEwAAAAAQVBQTAAAAAAAAAAAAAAAAAAAAAAAAPbWAAEAAAAA0y1hcHBsAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAKZGVzYwAAAPwAAAAwY3BydAAAASwAAABQd3RwdAAAAXwAAAAUclhZWgAAAZAAAAAUZ1hZWgAAAaQAAAAUYlhZWgAAAbgAAAAUclRSQwAAAcwAAAAgY2hhZAAAAewAAAAsYlRSQwAAAcwAAAAgZ1RSQwAAAcwAAAAgbWx1YwAAAAAAAAABAAAADGVuVVMAAAAUAAAAHABEAGkAcwBwAGwAYQB5ACAAUAAzbWx1YwAAAAAAAAABAAAADGVuVVMAAAA0AAAAHABDAG8AcAB5AHIAaQBnAGgAdAAgAEEAcABwAGwAZQAgAEkAbgBjAC4ALAAgADIAMAAyADJYWVogAAAAAAAA9tUAAQAAAADTLFhZWiAAAAAAAACD3wAAPb////+7WFlaIAAAAAAAAEq/AACxNwAACrlYWVogAAAAAAAAKDgAABELAADIuXBhcmEAAAAAAAMAAAACZmYAAPKnAAANWQAAE9AAAApbc2YzMgAAAAAAAQxCAAAF3v//8yYAAAeTAAD9kP//+6L///2jAAAD3AAAwG7/wAARCAQAAtQDASIAAhEBAxEB/8QAHwAAAQUBAQEBAQEAAAAAAAAAAAECAwQFBgcICQoL/8QAtRAAAgEDAwIEAwUFBAQAAAF9AQIDAAQRBRIhMUEGE1FhByJxFDKBkaEII0KxwRVS0fAkM2JyggkKFhcYGRolJicoKSo0NTY3ODk6Q0RFRkdISUpTVFVWV1hZWmNkZWZnaGlqc3R1dnd4eXqDhIWGh4iJipKTlJWWl5iZmqKjpKWmp6ipqrKztLW2t7i5usLDxMXGx8jJytLT1NXW19jZ2uHi4+Tl5ufo6erx8vP09fb3+Pn6/8QAHwEAAwEBAQEBAQEBAQAAAAAAAAECAwQFBgcICQoL/8QAtREAAgECBAQDBAcFBAQAAQJ3AAECAxEEBSExBhJBUQdhcRMiMoEIFEKRobHBCSMzUvAVYnLRChYkNOEl8RcYGRomJygpKjU2Nzg5OkNERUZHSElKU1RVVldYWVpjZGVmZ2hpanN0dXZ3eHl6goOEhYaHiImKkpOUlZaXmJmaoqOkpaanqKmqsrO0tba3uLm6wsPExcbHyMnK0tPU1dbX2Nna4uPk5ebn6Onq8vP09fb3+Pn6/9sAQwACAgICAgIDAgIDBAMDAwQFBAQEBAUHBQUFBQUHCAcHBwcHBwgICAgICAgICgoKCgoKCwsLCwsNDQ0NDQ0NDQ0N/9sAQwECAgIDAwMGAwMGDQkHCQ0NDQ0NDQ0NDQ0NDQ0NDQ0NDQ0NDQ0NDQ0NDQ0NDQ0NDQ0NDQ0NDQ0NDQ0NDQ0NDQ0N/90ABAAu/9oADAMBAAIRAxEAPwD9/KKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKAP/0P38ooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooA//R/fyiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigD/9L9/KKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKAP/0/38ooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooA//U/fyiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigD/9X9/KKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKAP/1v38ooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooA//X/fyiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigD/9D9/KKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKAP/0f38ooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooA//S/fyiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigD/9P9/KKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKAP/1P38ooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooA//V/fyiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigD/9b9/KKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKAP/1/38ooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooA//Q/fyiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigD/9H9/KKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKAP/0v38ooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooA//T/fyiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigD/9T9/KKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKAP/1f38ooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooA//W/fyiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigD/9f9/KKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKAP/0P38ooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooA//R/fyiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigD/9L9/KKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKAP/0/38ooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooA//U/fyiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigD/9X9/KKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKAP/1v38ooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooA//X/fyiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigD/9D9/KKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKAP/0f38ooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooA//S/fyiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigD/9P9/KKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKAP/1P38ooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooA//V/fyiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigD/9b9/KKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKAP/1/38ooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooA//Q/fyiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigD/9H9/KKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKAP/0v38ooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooA//T/fyiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigD/9T9/KKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKAP/1f38ooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooA//W/fyiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigD/9f9/KKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKAP/0P38ooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooA//R/fyiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigD/9L9/KKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKAP/0/38ooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooA//U/fyiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigD/9X9/KKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKAP/1v38ooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooA//X/fyiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAoooo"
-			+ "AKKKKACiiigAooooAKKKKACiiigD/9D9/KKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKAP/0f38ooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooA//S/fyiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigD/9P9/KKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKAP/1P38ooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooA//V/fyiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigD/9b9/KKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKAP/2Q=="),
-		Entry(path: "preview-micro.jpg", base64: "/9j/4AAQSkZJRgABAQAASABIAAD/4QBARXhpZgAATU0AKgAAAAgAAYdpAAQAAAABAAAAGgAAAAAAAqACAAQAAAABAAAAJqADAAQAAAABAAAANgAAAAD/7QA4UGhvdG9zaG9wIDMuMAA4QklNBAQAAAAAAAA4QklNBCUAAAAAABDUHYzZjwCyBOmACZjs+EJ+/8AAEQgANgAmAwEiAAIRAQMRAf/EAB8AAAEFAQEBAQEBAAAAAAAAAAABAgMEBQYHCAkKC//EALUQAAIBAwMCBAMFBQQEAAABfQECAwAEEQUSITFBBhNRYQcicRQygZGhCCNCscEVUtHwJDNicoIJChYXGBkaJSYnKCkqNDU2Nzg5OkNERUZHSElKU1RVVldYWVpjZGVmZ2hpanN0dXZ3eHl6g4SFhoeIiYqSk5SVlpeYmZqio6Slpqeoqaqys7S1tre4ubrCw8TFxsfIycrS09TV1tfY2drh4uPk5ebn6Onq8fLz9PX29/j5+v/EAB8BAAMBAQEBAQEBAQEAAAAAAAABAgMEBQYHCAkKC//EALURAAIBAgQEAwQHBQQEAAECdwABAgMRBAUhMQYSQVEHYXETIjKBCBRCkaGxwQkjM1LwFWJy0QoWJDThJfEXGBkaJicoKSo1Njc4OTpDREVGR0hJSlNUVVZXWFlaY2RlZmdoaWpzdHV2d3h5eoKDhIWGh4iJipKTlJWWl5iZmqKjpKWmp6ipqrKztLW2t7i5usLDxMXGx8jJytLT1NXW19jZ2uLj5OXm5+jp6vLz9PX29/j5+v/bAEMAAgICAgICAwICAwQDAwMEBQQEBAQFBwUFBQUFBwgHBwcHBwcICAgICAgICAoKCgoKCgsLCwsLDQ0NDQ0NDQ0NDf/bAEMBAgICAwMDBgMDBg0JBwkNDQ0NDQ0NDQ0NDQ0NDQ0NDQ0NDQ0NDQ0NDQ0NDQ0NDQ0NDQ0NDQ0NDQ0NDQ0NDQ0NDf/dAAQAA//aAAwDAQACEQMRAD8A/fyiiigAooooAKKKKAP/0P38ooooAKKKKACiiigD/9H9/KKKKACiiigAooooA//S/fyiiigAooooAKKKKAP/2Q=="),
-		Entry(path: "preview-web.jpg", base64: "/9j/4AAQSkZJRgABAQAASABIAAD/4QBARXhpZgAATU0AKgAAAAgAAYdpAAQAAAABAAAAGgAAAAAAAqACAAQAAAABAAAAn6ADAAQAAAABAAAA4QAAAAD/7QA4UGhvdG9zaG9wIDMuMAA4QklNBAQAAAAAAAA4QklNBCUAAAAAABDUHYzZjwCyBOmACZjs+EJ+/8AAEQgA4QCfAwEiAAIRAQMRAf/EAB8AAAEFAQEBAQEBAAAAAAAAAAABAgMEBQYHCAkKC//EALUQAAIBAwMCBAMFBQQEAAABfQECAwAEEQUSITFBBhNRYQcicRQygZGhCCNCscEVUtHwJDNicoIJChYXGBkaJSYnKCkqNDU2Nzg5OkNERUZHSElKU1RVVldYWVpjZGVmZ2hpanN0dXZ3eHl6g4SFhoeIiYqSk5SVlpeYmZqio6Slpqeoqaqys7S1tre4ubrCw8TFxsfIycrS09TV1tfY2drh4uPk5ebn6Onq8fLz9PX29/j5+v/EAB8BAAMBAQEBAQEBAQEAAAAAAAABAgMEBQYHCAkKC//EALURAAIBAgQEAwQHBQQEAAECdwABAgMRBAUhMQYSQVEHYXETIjKBCBRCkaGxwQkjM1LwFWJy0QoWJDThJfEXGBkaJicoKSo1Njc4OTpDREVGR0hJSlNUVVZXWFlaY2RlZmdoaWpzdHV2d3h5eoKDhIWGh4iJipKTlJWWl5iZmqKjpKWmp6ipqrKztLW2t7i5usLDxMXGx8jJytLT1NXW19jZ2uLj5OXm5+jp6vLz9PX29/j5+v/bAEMAAgICAgICAwICAwQDAwMEBQQEBAQFBwUFBQUFBwgHBwcHBwcICAgICAgICAoKCgoKCgsLCwsLDQ0NDQ0NDQ0NDf/bAEMBAgICAwMDBgMDBg0JBwkNDQ0NDQ0NDQ0NDQ0NDQ0NDQ0NDQ0NDQ0NDQ0NDQ0NDQ0NDQ0NDQ0NDQ0NDQ0NDQ0NDf/dAAQACv/aAAwDAQACEQMRAD8A/fyiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigD/9D9/KKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKAP/0f38ooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooA//S/fyiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigD/9P9/KKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKAP/1P38ooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooA//V/fyiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigD/9b9/KKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKAP/1/38ooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooA//Q/fyiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigD/9H9/KKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKAP/0v38ooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooA//T/fyiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigD/9T9/KKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKAP/1f38ooooAKKKKACiiigAooooAKKKKACiiigAooooAKKKKACiiigAooooA//Z"),
-	])
+		Entry(path: "Index/Document.iwa", range: 0..<7839),
+		Entry(path: "Index/ViewState.iwa", range: 7839..<8563),
+		Entry(path: "Index/CalculationEngine-1732610.iwa", range: 8563..<9104),
+		Entry(path: "Index/AnnotationAuthorStorage-1732609.iwa", range: 9104..<9127),
+		Entry(path: "Index/DocumentStylesheet.iwa", range: 9127..<54555),
+		Entry(path: "Index/DocumentMetadata.iwa", range: 54555..<54632),
+		Entry(path: "Index/Metadata.iwa", range: 54632..<71461),
+		Entry(path: "Metadata/Properties.plist", range: 71461..<71986),
+		Entry(path: "Metadata/DocumentIdentifier", range: 71986..<72022),
+		Entry(path: "Metadata/BuildVersionHistory.plist", range: 72022..<72294),
+		Entry(path: "preview.jpg", range: 72294..<85633),
+		Entry(path: "preview-micro.jpg", range: 85633..<86450),
+		Entry(path: "preview-web.jpg", range: 86450..<87863),
+	], bytes: blankTemplateBytes)
 }
+
+private let blankTemplateBytes: [UInt8] = [
+	0x00, 0x9B, 0x1E, 0x00, 0xC8, 0x70, 0x68, 0x56, 0x08, 0x01, 0x12, 0x52, 0x08, 0x90, 0x4E, 0x12,
+	0x03, 0x01, 0x00, 0x05, 0x18, 0xF0, 0x0C, 0x22, 0x07, 0x0A, 0x03, 0x0A, 0x01, 0x2E, 0x18, 0x01,
+	0x22, 0x09, 0x01, 0x09, 0xF0, 0x75, 0x2F, 0x10, 0x01, 0x18, 0x01, 0x22, 0x0B, 0x0A, 0x05, 0x0A,
+	0x03, 0x0F, 0x01, 0x11, 0x10, 0x03, 0x18, 0x00, 0x2A, 0x24, 0x81, 0xE0, 0x69, 0x82, 0xE0, 0x69,
+	0x83, 0xE0, 0x69, 0x9F, 0xE0, 0x69, 0x84, 0xE0, 0x69, 0x98, 0xD7, 0x69, 0x85, 0xE0, 0x69, 0x8C,
+	0xDE, 0x69, 0xB6, 0xDD, 0x69, 0x96, 0xDD, 0x69, 0xBB, 0xDF, 0x69, 0x86, 0xE0, 0x69, 0x12, 0x04,
+	0x08, 0x85, 0xE0, 0x69, 0x1A, 0x04, 0x08, 0xB6, 0xDD, 0x69, 0x22, 0x04, 0x08, 0xBB, 0xDF, 0x69,
+	0x32, 0x04, 0x08, 0x98, 0xD7, 0x69, 0x3A, 0x04, 0x08, 0x86, 0xE0, 0x69, 0x7A, 0xD2, 0x0B, 0x0A,
+	0x93, 0x0B, 0x22, 0x0F, 0x65, 0x6E, 0x5F, 0x41, 0x54, 0x40, 0x72, 0x67, 0x3D, 0x61, 0x74, 0x7A,
+	0x7A, 0x7A, 0x7A, 0x3A, 0x04, 0x08, 0x81, 0xE0, 0x69, 0x4A, 0x0F, 0x65, 0x36, 0x17, 0x00, 0xD8,
+	0x50, 0x01, 0x60, 0x00, 0x78, 0x01, 0x80, 0x01, 0x01, 0x8A, 0x01, 0xDB, 0x0A, 0x0A, 0x07, 0x35,
+	0x30, 0x32, 0x36, 0x2E, 0x36, 0x30, 0x12, 0x09, 0x67, 0x72, 0x65, 0x67, 0x6F, 0x72, 0x69, 0x61,
+	0x6E, 0x1A, 0x04, 0x6C, 0x61, 0x74, 0x6E, 0x22, 0x07, 0x4A, 0x61, 0x6E, 0x75, 0x61, 0x72, 0x79,
+	0x22, 0x08, 0x46, 0x65, 0x62, 0x72, 0x75, 0x01, 0x0A, 0x5C, 0x05, 0x4D, 0x61, 0x72, 0x63, 0x68,
+	0x22, 0x05, 0x41, 0x70, 0x72, 0x69, 0x6C, 0x22, 0x03, 0x4D, 0x61, 0x79, 0x22, 0x04, 0x4A, 0x75,
+	0x6E, 0x65, 0x01, 0x06, 0x68, 0x6C, 0x79, 0x22, 0x06, 0x41, 0x75, 0x67, 0x75, 0x73, 0x74, 0x22,
+	0x09, 0x53, 0x65, 0x70, 0x74, 0x65, 0x6D, 0x62, 0x65, 0x72, 0x22, 0x07, 0x4F, 0x63, 0x74, 0x6F,
+	0x01, 0x09, 0x0C, 0x08, 0x4E, 0x6F, 0x76, 0x09, 0x13, 0x0C, 0x08, 0x44, 0x65, 0x63, 0x05, 0x0A,
+	0x04, 0x2A, 0x07, 0x0D, 0x62, 0x00, 0x2A, 0x15, 0x62, 0x00, 0x2A, 0x09, 0x62, 0x00, 0x2A, 0x09,
+	0x62, 0x00, 0x2A, 0x01, 0x62, 0x00, 0x2A, 0x05, 0x62, 0x01, 0x06, 0x08, 0x6C, 0x79, 0x2A, 0x0D,
+	0x62, 0x00, 0x2A, 0x19, 0x62, 0x00, 0x2A, 0x11, 0x62, 0x00, 0x2A, 0x15, 0x62, 0x00, 0x2A, 0x15,
+	0x62, 0x4C, 0x32, 0x03, 0x4A, 0x61, 0x6E, 0x32, 0x03, 0x46, 0x65, 0x62, 0x32, 0x03, 0x4D, 0x61,
+	0x72, 0x32, 0x03, 0x41, 0x70, 0x72, 0x01, 0x0A, 0x14, 0x79, 0x32, 0x03, 0x4A, 0x75, 0x6E, 0x01,
+	0x05, 0x68, 0x6C, 0x32, 0x03, 0x41, 0x75, 0x67, 0x32, 0x03, 0x53, 0x65, 0x70, 0x32, 0x03, 0x4F,
+	0x63, 0x74, 0x32, 0x03, 0x4E, 0x6F, 0x76, 0x32, 0x03, 0x44, 0x65, 0x63, 0x3A, 0x01, 0x3C, 0x00,
+	0x3A, 0x01, 0x3C, 0x00, 0x3A, 0x01, 0x3C, 0x00, 0x3A, 0x01, 0x3C, 0x01, 0x0A, 0x04, 0x79, 0x3A,
+	0x01, 0x3C, 0x01, 0x05, 0x04, 0x6C, 0x3A, 0x01, 0x3C, 0x00, 0x3A, 0x01, 0x3C, 0x00, 0x3A, 0x01,
+	0x3C, 0x00, 0x3A, 0x01, 0x3C, 0x00, 0x3A, 0x01, 0x3C, 0x2C, 0x42, 0x06, 0x53, 0x75, 0x6E, 0x64,
+	0x61, 0x79, 0x42, 0x06, 0x4D, 0x6F, 0x05, 0x08, 0x10, 0x07, 0x54, 0x75, 0x65, 0x73, 0x01, 0x11,
+	0x10, 0x09, 0x57, 0x65, 0x64, 0x6E, 0x09, 0x0B, 0x10, 0x08, 0x54, 0x68, 0x75, 0x72, 0x05, 0x15,
+	0x0C, 0x06, 0x46, 0x72, 0x69, 0x01, 0x1D, 0x24, 0x08, 0x53, 0x61, 0x74, 0x75, 0x72, 0x64, 0x61,
+	0x79, 0x4A, 0x0D, 0x40, 0x00, 0x4A, 0x0D, 0x40, 0x00, 0x4A, 0x11, 0x40, 0x00, 0x4A, 0x19, 0x40,
+	0x00, 0x4A, 0x15, 0x40, 0x00, 0x4A, 0x0D, 0x40, 0x00, 0x4A, 0x15, 0x40, 0xA0, 0x52, 0x03, 0x53,
+	0x75, 0x6E, 0x52, 0x03, 0x4D, 0x6F, 0x6E, 0x52, 0x03, 0x54, 0x75, 0x65, 0x52, 0x03, 0x57, 0x65,
+	0x64, 0x52, 0x03, 0x54, 0x68, 0x75, 0x52, 0x03, 0x46, 0x72, 0x69, 0x52, 0x03, 0x53, 0x61, 0x74,
+	0x5A, 0x03, 0x53, 0x75, 0x6E, 0x5A, 0x01, 0x23, 0x00, 0x5A, 0x01, 0x23, 0x00, 0x5A, 0x01, 0x23,
+	0x00, 0x5A, 0x01, 0x23, 0x00, 0x5A, 0x01, 0x23, 0x00, 0x5A, 0x01, 0x23, 0x4C, 0x62, 0x02, 0x41,
+	0x4D, 0x6A, 0x02, 0x50, 0x4D, 0x72, 0x01, 0x4A, 0x72, 0x01, 0x46, 0x72, 0x01, 0x4D, 0x72, 0x01,
+	0x41, 0x05, 0x06, 0x00, 0x4A, 0x05, 0x12, 0x60, 0x41, 0x72, 0x01, 0x53, 0x72, 0x01, 0x4F, 0x72,
+	0x01, 0x4E, 0x72, 0x01, 0x44, 0x7A, 0x01, 0x4A, 0x7A, 0x01, 0x46, 0x7A, 0x01, 0x4D, 0x7A, 0x01,
+	0x41, 0x05, 0x06, 0x00, 0x4A, 0x05, 0x12, 0x70, 0x41, 0x7A, 0x01, 0x53, 0x7A, 0x01, 0x4F, 0x7A,
+	0x01, 0x4E, 0x7A, 0x01, 0x44, 0x82, 0x01, 0x01, 0x53, 0x82, 0x01, 0x01, 0x4D, 0x82, 0x01, 0x01,
+	0x54, 0x82, 0x01, 0x01, 0x57, 0x0D, 0x08, 0x00, 0x46, 0x01, 0x18, 0x08, 0x8A, 0x01, 0x01, 0x01,
+	0x04, 0x20, 0x4D, 0x8A, 0x01, 0x01, 0x54, 0x8A, 0x01, 0x01, 0x57, 0x0D, 0x08, 0x00, 0x46, 0x01,
+	0x18, 0x4C, 0x92, 0x01, 0x0B, 0x31, 0x73, 0x74, 0x20, 0x71, 0x75, 0x61, 0x72, 0x74, 0x65, 0x72,
+	0x92, 0x01, 0x0B, 0x32, 0x6E, 0x64, 0x1D, 0x0E, 0x04, 0x33, 0x72, 0x2E, 0x0E, 0x00, 0x08, 0x34,
+	0x74, 0x68, 0x11, 0x1C, 0x00, 0x9A, 0x32, 0x38, 0x00, 0x00, 0x9A, 0x32, 0x38, 0x00, 0x04, 0x9A,
+	0x01, 0x2E, 0x38, 0x00, 0x04, 0x9A, 0x01, 0x2E, 0x38, 0x00, 0x10, 0xA2, 0x01, 0x02, 0x51, 0x31,
+	0x01, 0x05, 0x00, 0x32, 0x01, 0x05, 0x00, 0x33, 0x01, 0x05, 0x04, 0x34, 0xAA, 0x01, 0x14, 0x01,
+	0x05, 0x00, 0x32, 0x01, 0x05, 0x00, 0x33, 0x01, 0x05, 0xF0, 0x52, 0x34, 0xB2, 0x01, 0x02, 0x42,
+	0x43, 0xB2, 0x01, 0x02, 0x41, 0x44, 0xBA, 0x01, 0x0D, 0x42, 0x65, 0x66, 0x6F, 0x72, 0x65, 0x20,
+	0x43, 0x68, 0x72, 0x69, 0x73, 0x74, 0xBA, 0x01, 0x0B, 0x41, 0x6E, 0x6E, 0x6F, 0x20, 0x44, 0x6F,
+	0x6D, 0x69, 0x6E, 0x69, 0xC2, 0x01, 0x08, 0x64, 0x64, 0x2E, 0x4D, 0x4D, 0x2E, 0x79, 0x79, 0xCA,
+	0x01, 0x07, 0x64, 0x64, 0x2E, 0x4D, 0x4D, 0x2E, 0x79, 0xD2, 0x01, 0x09, 0x64, 0x2E, 0x20, 0x4D,
+	0x4D, 0x4D, 0x4D, 0x20, 0x79, 0xDA, 0x01, 0x0F, 0x45, 0x45, 0x45, 0x45, 0x2C, 0x20, 0x15, 0x12,
+	0x28, 0xE2, 0x01, 0x05, 0x48, 0x48, 0x3A, 0x6D, 0x6D, 0xEA, 0x01, 0x08, 0x05, 0x08, 0x14, 0x3A,
+	0x73, 0x73, 0xF2, 0x01, 0x0A, 0x11, 0x0B, 0x10, 0x20, 0x7A, 0xFA, 0x01, 0x0D, 0x19, 0x0D, 0xF0,
+	0x5B, 0x7A, 0x7A, 0x7A, 0x82, 0x02, 0x01, 0x2C, 0x8A, 0x02, 0x01, 0x2E, 0x92, 0x02, 0x01, 0x2C,
+	0x9A, 0x02, 0x01, 0x2E, 0xA2, 0x02, 0x01, 0x2B, 0xAA, 0x02, 0x01, 0x2D, 0xB2, 0x02, 0x01, 0x45,
+	0xBA, 0x02, 0x01, 0x25, 0xC2, 0x02, 0x03, 0xE2, 0x80, 0xB0, 0xCA, 0x02, 0x04, 0x2B, 0xE2, 0x88,
+	0x9E, 0xD2, 0x02, 0x03, 0x4E, 0x61, 0x4E, 0xDA, 0x02, 0x09, 0x23, 0x2C, 0x23, 0x23, 0x30, 0x2E,
+	0x23, 0x23, 0x23, 0xE2, 0x02, 0x03, 0x23, 0x45, 0x30, 0xEA, 0x02, 0x08, 0x23, 0x2C, 0x23, 0x23,
+	0x30, 0xC2, 0xA0, 0x25, 0xF2, 0x02, 0x0C, 0xC2, 0xA4, 0xC2, 0xA0, 0x23, 0x2C, 0x01, 0x21, 0x4C,
+	0x30, 0x30, 0xFA, 0x02, 0x03, 0x45, 0x55, 0x52, 0x82, 0x03, 0x09, 0x0A, 0x03, 0x41, 0x55, 0x44,
+	0x12, 0x02, 0x41, 0x24, 0x05, 0x0C, 0x44, 0x42, 0x52, 0x4C, 0x12, 0x02, 0x52, 0x24, 0x82, 0x03,
+	0x0A, 0x0A, 0x03, 0x43, 0x41, 0x44, 0x12, 0x03, 0x43, 0x01, 0x19, 0x2C, 0x0B, 0x0A, 0x03, 0x43,
+	0x4E, 0x59, 0x12, 0x04, 0x43, 0x4E, 0xC2, 0xA5, 0x05, 0x1B, 0x1C, 0x45, 0x55, 0x52, 0x12, 0x03,
+	0xE2, 0x82, 0xAC, 0x05, 0x34, 0x18, 0x47, 0x42, 0x50, 0x12, 0x02, 0xC2, 0xA3, 0x05, 0x19, 0x18,
+	0x48, 0x4B, 0x44, 0x12, 0x03, 0x48, 0x4B, 0x09, 0x41, 0x08, 0x49, 0x4C, 0x53, 0x01, 0x26, 0x00,
+	0xAA, 0x05, 0x1A, 0x04, 0x49, 0x4E, 0x05, 0x33, 0x04, 0xB9, 0x82, 0x01, 0x4E, 0x18, 0x4A, 0x50,
+	0x59, 0x12, 0x04, 0x4A, 0x50, 0x0D, 0x4E, 0x08, 0x4B, 0x52, 0x57, 0x01, 0x28, 0x00, 0xA9, 0x05,
+	0x28, 0x18, 0x4D, 0x58, 0x4E, 0x12, 0x03, 0x4D, 0x58, 0x09, 0x42, 0x18, 0x4E, 0x5A, 0x44, 0x12,
+	0x03, 0x4E, 0x5A, 0x09, 0x0D, 0x08, 0x50, 0x48, 0x50, 0x01, 0x27, 0x00, 0xB1, 0x05, 0x27, 0x04,
+	0x54, 0x57, 0x01, 0x1A, 0x00, 0x54, 0x09, 0x1A, 0x18, 0x55, 0x53, 0x44, 0x12, 0x03, 0x55, 0x53,
+	0x09, 0x0D, 0x08, 0x56, 0x4E, 0x44, 0x01, 0x27, 0x00, 0xAB, 0x05, 0x69, 0x20, 0x58, 0x41, 0x46,
+	0x12, 0x04, 0x46, 0x43, 0x46, 0x41, 0x05, 0x35, 0x18, 0x58, 0x43, 0x44, 0x12, 0x03, 0x45, 0x43,
+	0x09, 0x28, 0x54, 0x58, 0x43, 0x47, 0x12, 0x03, 0x43, 0x67, 0x2E, 0x82, 0x03, 0x0E, 0x0A, 0x03,
+	0x58, 0x4F, 0x46, 0x12, 0x07, 0x46, 0xE2, 0x80, 0xAF, 0x05, 0x2B, 0x2C, 0x0B, 0x0A, 0x03, 0x58,
+	0x50, 0x46, 0x12, 0x04, 0x43, 0x46, 0x50, 0x46, 0x05, 0xE3, 0xF0, 0xDE, 0x58, 0x58, 0x58, 0x12,
+	0x02, 0xC2, 0xA4, 0x90, 0x01, 0x01, 0x1A, 0x02, 0x65, 0x6E, 0x22, 0x04, 0x08, 0x82, 0xE0, 0x69,
+	0x2A, 0x04, 0x08, 0x9F, 0xE0, 0x69, 0x32, 0x04, 0x08, 0x84, 0xE0, 0x69, 0x40, 0x00, 0x4A, 0x15,
+	0x41, 0x70, 0x70, 0x6C, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2F, 0x42, 0x6C, 0x61, 0x6E,
+	0x6B, 0x2F, 0x49, 0x53, 0x4F, 0x62, 0x04, 0x08, 0x83, 0xE0, 0x69, 0x70, 0x00, 0x78, 0x00, 0x80,
+	0x01, 0x00, 0xA2, 0x01, 0x04, 0x08, 0x8C, 0xDE, 0x69, 0xF5, 0x01, 0xEC, 0xD1, 0x14, 0x44, 0xFD,
+	0x01, 0xF6, 0x78, 0x52, 0x44, 0x85, 0x02, 0x8C, 0xC5, 0x62, 0x42, 0x8D, 0x02, 0x8C, 0xC5, 0x62,
+	0x42, 0x95, 0x02, 0x8C, 0xC5, 0x62, 0x42, 0x9D, 0x02, 0x8C, 0xC5, 0x62, 0x42, 0xA5, 0x02, 0x77,
+	0xBB, 0x0D, 0x42, 0xAD, 0x02, 0x28, 0x14, 0x2A, 0x42, 0xB5, 0x02, 0x00, 0x00, 0x80, 0x3F, 0xB8,
+	0x02, 0x00, 0xC0, 0x02, 0x00, 0xD0, 0x02, 0x00, 0xDA, 0x02, 0x1E, 0x48, 0x50, 0x5F, 0x43, 0x6F,
+	0x6C, 0x6F, 0x72, 0x5F, 0x4C, 0x61, 0x73, 0x65, 0x72, 0x4A, 0x65, 0x74, 0x5F, 0x50, 0x72, 0x6F,
+	0x5F, 0x4D, 0x34, 0x37, 0x38, 0x66, 0x5F, 0x39, 0x66, 0xE2, 0x02, 0x06, 0x69, 0x73, 0x6F, 0x2D,
+	0x61, 0x34, 0xF0, 0x02, 0x01, 0xFA, 0x02, 0x04, 0x08, 0x96, 0xDD, 0x69, 0x88, 0x03, 0x00, 0x10,
+	0x08, 0x83, 0xE0, 0x69, 0x12, 0x0A, 0x08, 0xDE, 0x01, 0x12, 0x03, 0x01, 0x00, 0x05, 0x18, 0x00,
+	0x10, 0x08, 0x84, 0xE0, 0x69, 0x12, 0x0A, 0x08, 0xD9, 0x04, 0x12, 0xC5, 0xDA, 0x70, 0x11, 0x08,
+	0x0F, 0x08, 0xA8, 0x01, 0x08, 0x58, 0x08, 0x54, 0x08, 0x1E, 0x08, 0x1F, 0x08, 0x3E, 0x20, 0x00,
+	0x93, 0x02, 0x08, 0x98, 0xD7, 0x69, 0x12, 0x8C, 0x02, 0x08, 0x91, 0xCD, 0xFE, 0xF4, 0x02, 0x02,
+	0xFB, 0x17, 0x2A, 0xF6, 0x01, 0xF4, 0xD7, 0x69, 0xDB, 0xD7, 0x69, 0xDC, 0xD7, 0x69, 0xDD, 0xD7,
+	0x69, 0xDE, 0xD7, 0x69, 0xDF, 0xD7, 0x69, 0xE0, 0xD7, 0x69, 0xE1, 0xD7, 0x69, 0xE2, 0xD7, 0x69,
+	0xE3, 0xD7, 0x69, 0xE4, 0xD7, 0x69, 0xE5, 0xD7, 0x69, 0xE6, 0xD7, 0x69, 0xE7, 0xD7, 0x69, 0xE8,
+	0xD7, 0x69, 0xE9, 0xD7, 0x69, 0xEA, 0xD7, 0x69, 0xEB, 0xD7, 0x69, 0xEC, 0xD7, 0x69, 0xED, 0xD7,
+	0x69, 0xEE, 0xD7, 0x69, 0xEF, 0xD7, 0x69, 0xF0, 0xD7, 0x69, 0xF1, 0xD7, 0x69, 0xF2, 0xD7, 0x69,
+	0xF3, 0xD7, 0x69, 0x99, 0xD7, 0x69, 0x9A, 0xD7, 0x69, 0x9B, 0xD7, 0x69, 0x9C, 0xD7, 0x69, 0x9D,
+	0xD7, 0x69, 0x9E, 0xD7, 0x69, 0x9F, 0xD7, 0x69, 0xA0, 0xD7, 0x69, 0xA1, 0xD7, 0x69, 0xAF, 0xDC,
+	0x69, 0xB0, 0xDC, 0x69, 0xB1, 0xDC, 0x69, 0xB2, 0xDC, 0x69, 0xB3, 0xDC, 0x69, 0x8A, 0xE0, 0x69,
+	0xD3, 0xD7, 0x69, 0xD4, 0xD7, 0x69, 0xD5, 0xD7, 0x69, 0xD6, 0xD7, 0x69, 0xD7, 0xD7, 0x69, 0xD8,
+	0xD7, 0x69, 0xD9, 0xD7, 0x69, 0xDA, 0xD7, 0x69, 0xA3, 0xD7, 0x69, 0xA9, 0xD7, 0x69, 0xAE, 0xD7,
+	0x69, 0xAF, 0xD7, 0x69, 0xB0, 0xD7, 0x69, 0xB1, 0xD7, 0x69, 0xB7, 0xD7, 0x69, 0xBD, 0xD7, 0x69,
+	0xC0, 0xD7, 0x69, 0xC2, 0xD7, 0x69, 0xC3, 0xD7, 0x69, 0xC4, 0xD7, 0x69, 0xA9, 0xDC, 0x69, 0xAA,
+	0xDC, 0x69, 0xAB, 0xDC, 0x69, 0xAC, 0xDC, 0x69, 0xAD, 0xDC, 0x69, 0xAE, 0xDC, 0x69, 0x9F, 0xD9,
+	0x69, 0xB8, 0xD9, 0x69, 0xD1, 0xD9, 0x69, 0xEA, 0xD9, 0x69, 0x83, 0xDA, 0x69, 0x9C, 0xDA, 0x69,
+	0xC8, 0xDA, 0x69, 0xF4, 0xDA, 0x69, 0xA0, 0xDB, 0x69, 0xCC, 0xDB, 0x69, 0xF8, 0xDB, 0x69, 0xA4,
+	0xDC, 0x69, 0xA5, 0xDC, 0x69, 0xA6, 0xDC, 0x69, 0x95, 0xE0, 0x69, 0x32, 0x06, 0x09, 0x09, 0x09,
+	0x09, 0x09, 0x08, 0x0A, 0xF8, 0x17, 0x1A, 0x05, 0x42, 0x6C, 0x61, 0x6E, 0x6B, 0x22, 0x04, 0x08,
+	0x85, 0xE0, 0x69, 0x52, 0x1D, 0x08, 0x01, 0x1D, 0x81, 0xFA, 0x7F, 0x3F, 0x25, 0x00, 0x00, 0x80,
+	0x3F, 0x2D, 0x75, 0xF8, 0x7F, 0x3F, 0x35, 0x00, 0x00, 0x80, 0x3F, 0x60, 0x01, 0x6D, 0x00, 0x00,
+	0x80, 0x3F, 0x52, 0x1D, 0x08, 0x01, 0x1D, 0x1D, 0x06, 0x56, 0x3F, 0x25, 0x1C, 0x06, 0x56, 0x3F,
+	0x2D, 0x1C, 0x06, 0x56, 0x3F, 0x35, 0x00, 0x00, 0x80, 0x3F, 0x60, 0x01, 0x6D, 0x00, 0x00, 0x80,
+	0x3F, 0x52, 0x1D, 0x08, 0x01, 0x1D, 0xB3, 0x82, 0x12, 0x3F, 0x25, 0xB2, 0x82, 0x12, 0x3F, 0x2D,
+	0xB1, 0x82, 0x12, 0x3F, 0x35, 0x00, 0x00, 0x80, 0x3F, 0x60, 0x01, 0x6D, 0x00, 0x00, 0x80, 0x3F,
+	0x52, 0x1D, 0x08, 0x01, 0x1D, 0x4C, 0xA0, 0xBD, 0x3E, 0x25, 0x4A, 0xA0, 0xBD, 0x3E, 0x2D, 0x4C,
+	0xA0, 0xBD, 0x3E, 0x35, 0x00, 0x00, 0x80, 0x3F, 0x60, 0x01, 0x6D, 0x00, 0x00, 0x80, 0x3F, 0x52,
+	0x1D, 0x08, 0x01, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00,
+	0x00, 0x00, 0x35, 0x00, 0x00, 0x80, 0x3F, 0x60, 0x01, 0x6D, 0x00, 0x00, 0x80, 0x3F, 0x52, 0x1D,
+	0x08, 0x01, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00,
+	0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x60, 0x01, 0x6D, 0x00, 0x00, 0x80, 0x3F, 0x52, 0x1D, 0x08,
+	0x01, 0x1D, 0xE6, 0xD8, 0xAC, 0x3E, 0x25, 0x7D, 0xFA, 0x41, 0x3F, 0x2D, 0xFF, 0xFF, 0x7F, 0x3F,
+	0x35, 0x00, 0x00, 0x80, 0x3F, 0x60, 0x01, 0x6D, 0x00, 0x00, 0x80, 0x3F, 0x52, 0x1D, 0x08, 0x01,
+	0x1D, 0x7D, 0x82, 0x27, 0x3A, 0x25, 0xD0, 0x33, 0x22, 0x3F, 0x2D, 0xFF, 0xFF, 0x7F, 0x3F, 0x35,
+	0x00, 0x00, 0x80, 0x32, 0xBA, 0x00, 0x40, 0xE3, 0x92, 0xB7, 0x34, 0x25, 0x76, 0xC7, 0xEC, 0x3E,
+	0x2D, 0xB5, 0xA8, 0x3A, 0x3F, 0x35, 0x00, 0x00, 0x36, 0x3E, 0x00, 0x30, 0x2C, 0x36, 0x94, 0x3A,
+	0x25, 0x08, 0x3D, 0x9A, 0x3E, 0x2D, 0x01, 0x00, 0x00, 0x46, 0x1F, 0x00, 0x30, 0x4A, 0x69, 0xE6,
+	0x3E, 0x25, 0x25, 0x8F, 0x7D, 0x3F, 0x2D, 0x77, 0x89, 0x6A, 0x46, 0x1F, 0x00, 0x30, 0x45, 0x8B,
+	0xB4, 0x3D, 0x25, 0xD5, 0xA4, 0x67, 0x3F, 0x2D, 0x7F, 0xD9, 0x4F, 0x46, 0x1F, 0x00, 0x30, 0x00,
+	0x00, 0x00, 0x00, 0x25, 0xE5, 0xD4, 0x2B, 0x3F, 0x2D, 0x5F, 0xA1, 0x0E, 0x5A, 0x1F, 0x00, 0x1C,
+	0x44, 0xC1, 0xD8, 0x3E, 0x2D, 0xC7, 0xB4, 0xCB, 0x46, 0x36, 0x01, 0x30, 0xEB, 0xDD, 0x08, 0x3F,
+	0x25, 0x99, 0xF5, 0x7A, 0x3F, 0x2D, 0x06, 0x62, 0x9D, 0x46, 0x1F, 0x00, 0x30, 0xCB, 0xC3, 0xC1,
+	0x3E, 0x25, 0x53, 0x27, 0x59, 0x3F, 0x2D, 0x48, 0x27, 0x59, 0x46, 0x1F, 0x00, 0x34, 0x7F, 0x8D,
+	0xE7, 0x3D, 0x25, 0xE0, 0x99, 0x31, 0x3F, 0x2D, 0x96, 0x15, 0xE1, 0x3A, 0x42, 0xF8, 0x00, 0x30,
+	0xF5, 0xF7, 0xA5, 0x3B, 0x25, 0x3F, 0xB2, 0xE2, 0x3E, 0x2D, 0x3D, 0xA1, 0xE3, 0x46, 0x1F, 0x00,
+	0x21, 0x27, 0x20, 0x25, 0xF9, 0x48, 0x71, 0x3F, 0x2D, 0xE1, 0x5F, 0xAD, 0x46, 0x5D, 0x00, 0x05,
+	0x1F, 0x1C, 0x17, 0x2D, 0x5A, 0x3F, 0x2D, 0x50, 0x86, 0x48, 0x46, 0x1F, 0x00, 0x24, 0xE9, 0xB6,
+	0x7E, 0x3F, 0x25, 0x77, 0x3C, 0x2E, 0x3F, 0x2D, 0x21, 0x02, 0x42, 0x7C, 0x00, 0x20, 0x9D, 0x04,
+	0x73, 0x3F, 0x25, 0xFC, 0x45, 0xE4, 0x3E, 0x56, 0x1F, 0x00, 0x05, 0x5D, 0x1C, 0x95, 0xB7, 0x16,
+	0x3F, 0x2D, 0x92, 0x8C, 0x0D, 0x46, 0x36, 0x01, 0x30, 0xFF, 0xFF, 0x7F, 0x3F, 0x25, 0xDA, 0x06,
+	0xC8, 0x3E, 0x2D, 0xC7, 0x71, 0x9C, 0x46, 0x7C, 0x00, 0x34, 0xC7, 0x9F, 0x6E, 0x3F, 0x25, 0xC4,
+	0x10, 0x0A, 0x3E, 0x2D, 0x82, 0xB0, 0x3E, 0x3D, 0x42, 0x7C, 0x00, 0x34, 0x2F, 0x4E, 0x35, 0x3F,
+	0x25, 0x0B, 0x09, 0xBB, 0x3D, 0x2D, 0x52, 0xB8, 0xCE, 0x32, 0x42, 0x1F, 0x00, 0x05, 0x7C, 0x1C,
+	0x33, 0x61, 0x15, 0x3F, 0x2D, 0x0D, 0xF0, 0x4A, 0x46, 0x7C, 0x00, 0x05, 0x1F, 0x1C, 0x87, 0x3A,
+	0x85, 0x3E, 0x2D, 0x59, 0xBF, 0x21, 0x46, 0x1F, 0x00, 0x30, 0x63, 0x54, 0x54, 0x3F, 0x25, 0x6F,
+	0xAF, 0xC4, 0x3D, 0x2D, 0xC4, 0xC9, 0xED, 0x46, 0x9B, 0x00, 0x30, 0x8F, 0x90, 0x17, 0x3F, 0x25,
+	0x82, 0x0E, 0x5C, 0x3D, 0x2D, 0xB8, 0x77, 0xA6, 0x32, 0x1F, 0x00, 0x48, 0xA2, 0x06, 0xE8, 0x0D,
+	0x0A, 0x68, 0x12, 0x66, 0x08, 0x00, 0x12, 0x29, 0x0A, 0x1D, 0x08, 0x01, 0x1D, 0xE6, 0xD8, 0x5E,
+	0xF4, 0x02, 0x00, 0x15, 0x21, 0x53, 0x41, 0x5A, 0x00, 0x3F, 0x0D, 0x2B, 0x66, 0xE1, 0x02, 0x00,
+	0x15, 0x01, 0xAF, 0x05, 0x2B, 0x05, 0xB9, 0x20, 0x20, 0x00, 0x2A, 0x05, 0x15, 0xE4, 0xCB, 0x96,
+	0x40, 0x32, 0x6A, 0x00, 0x66, 0xC3, 0x02, 0x42, 0x6A, 0x00, 0x2C, 0x20, 0x8D, 0x86, 0x34, 0x25,
+	0xEA, 0xF1, 0xF7, 0x3E, 0x2D, 0x9C, 0xA2, 0x36, 0xDF, 0x00, 0x92, 0x6A, 0x00, 0x66, 0xB1, 0x02,
+	0x42, 0x6A, 0x00, 0x66, 0x9E, 0x02, 0x92, 0x6A, 0x00, 0x30, 0x41, 0x70, 0x7B, 0x3F, 0x25, 0xBD,
+	0xE9, 0x62, 0x3F, 0x2D, 0x98, 0x2B, 0x49, 0x32, 0x69, 0x01, 0x42, 0x6A, 0x00, 0x21, 0x23, 0x0C,
+	0x25, 0x8D, 0xE4, 0x13, 0x46, 0xAB, 0x02, 0x92, 0x6A, 0x00, 0x66, 0x8D, 0x02, 0x42, 0x6A, 0x00,
+	0x66, 0x7A, 0x02, 0x92, 0x6A, 0x00, 0x30, 0xD1, 0xE4, 0x7F, 0x3F, 0x25, 0xC7, 0xD1, 0x15, 0x3F,
+	0x2D, 0x27, 0x53, 0x4B, 0x32, 0x7B, 0x02, 0x42, 0x6A, 0x00, 0x2C, 0xF7, 0x45, 0x17, 0x3F, 0x25,
+	0xA2, 0x97, 0x5E, 0x3D, 0x2D, 0x54, 0x74, 0x36, 0x68, 0x02, 0x5E, 0x6A, 0x00, 0x18, 0x12, 0x54,
+	0x1A, 0x52, 0x10, 0x02, 0x1A, 0x41, 0x7A, 0x1C, 0xF8, 0x35, 0xAC, 0x3E, 0x25, 0xF1, 0xF9, 0x41,
+	0x21, 0x11, 0x00, 0x80, 0x01, 0x68, 0x00, 0x00, 0xB1, 0x4F, 0x1C, 0x22, 0x0A, 0x0D, 0x00, 0x00,
+	0x96, 0x43, 0x15, 0x01, 0x05, 0x18, 0x32, 0x02, 0x08, 0x09, 0x40, 0x01, 0x4A, 0x01, 0x31, 0x30,
+	0xB5, 0xB4, 0xB4, 0x3E, 0x25, 0x91, 0x90, 0x10, 0x3F, 0x2D, 0xB0, 0xAF, 0x2F, 0x01, 0x31, 0xB5,
+	0x61, 0x1D, 0x56, 0x42, 0x66, 0x02, 0x7E, 0x56, 0x00, 0x30, 0xE9, 0xE8, 0x68, 0x3E, 0x25, 0xA3,
+	0xA2, 0x22, 0x3F, 0x2D, 0x98, 0x97, 0x17, 0x5E, 0x56, 0x00, 0x42, 0x52, 0x02, 0x5E, 0x56, 0x00,
+	0x00, 0x08, 0x0D, 0xAC, 0x10, 0xE7, 0xE6, 0xE6, 0x3E, 0x25, 0x01, 0xA7, 0x0C, 0x2D, 0xBD, 0xBC,
+	0xBC, 0x32, 0x19, 0x02, 0x1D, 0xAC, 0x42, 0x13, 0x02, 0x5E, 0x56, 0x00, 0x31, 0x02, 0x01, 0x51,
+	0x20, 0x25, 0xF3, 0xF2, 0xF2, 0x3E, 0x2D, 0xBD, 0xBC, 0x3C, 0x5E, 0x56, 0x00, 0x42, 0x98, 0x04,
+	0x7E, 0x56, 0x00, 0x30, 0xA7, 0xA6, 0x26, 0x3F, 0x25, 0x81, 0x80, 0x80, 0x3E, 0x2D, 0xD5, 0xD4,
+	0x54, 0x5E, 0x56, 0x00, 0x30, 0x9F, 0x1D, 0x4C, 0x3F, 0x25, 0xCA, 0x35, 0x26, 0x3E, 0x2D, 0xE2,
+	0x2E, 0xF7, 0x01, 0x25, 0x7E, 0x56, 0x00, 0x30, 0x96, 0x95, 0x15, 0x3F, 0x25, 0x89, 0x88, 0x88,
+	0x3E, 0x2D, 0xDB, 0xDA, 0xDA, 0x01, 0x31, 0x35, 0xAE, 0x04, 0x1A, 0x34, 0x85, 0x7A, 0x81, 0x5F,
+	0x32, 0x8D, 0x07, 0x15, 0x21, 0x10, 0x15, 0x00, 0x00, 0xB4, 0x42, 0x01, 0x20, 0x08, 0x40, 0x20,
+	0x05, 0xA1, 0xBA, 0x10, 0x3F, 0x30, 0x01, 0x38, 0x00, 0x8E, 0x36, 0x00, 0x00, 0x34, 0x01, 0x36,
+	0x0C, 0xA0, 0x40, 0x20, 0x04, 0xB2, 0x36, 0x00, 0x09, 0x6C, 0x08, 0x41, 0x20, 0x0A, 0xB2, 0x36,
+	0x00, 0x05, 0x6C, 0x04, 0x00, 0x00, 0x05, 0x36, 0x00, 0x40, 0x09, 0xA2, 0x00, 0x3B, 0x92, 0xD8,
+	0x00, 0x18, 0x5D, 0x70, 0x2A, 0x3F, 0x20, 0x0F, 0x2D, 0x21, 0xFD, 0x28, 0x30, 0x01, 0x38, 0x02,
+	0x52, 0x05, 0x0D, 0x79, 0x19, 0xFC, 0xBD, 0x9A, 0x3D, 0x00, 0x01, 0x36, 0x05, 0x3D, 0x05, 0x73,
+	0x01, 0x3D, 0x0C, 0xF8, 0xD5, 0x28, 0x3E, 0x8E, 0x3D, 0x00, 0x00, 0x00, 0xA5, 0xCC, 0x10, 0x00,
+	0x20, 0x1C, 0x2D, 0x00, 0x09, 0x3D, 0x18, 0x01, 0x4A, 0x05, 0x15, 0xD4, 0xD0, 0x31, 0x9E, 0x3D,
+	0x00, 0x14, 0x33, 0xB3, 0x16, 0x41, 0x20, 0x1E, 0x2E, 0x3D, 0x00, 0x34, 0x00, 0x00, 0x80, 0x3E,
+	0x22, 0x04, 0x08, 0xDB, 0xD7, 0x69, 0x22, 0x04, 0x08, 0xDC, 0x05, 0x06, 0x00, 0xDD, 0x05, 0x06,
+	0x00, 0xDE, 0x05, 0x06, 0x00, 0xDF, 0x05, 0x06, 0x04, 0xE0, 0xD7, 0x0E, 0x1D, 0x0C, 0x00, 0xE1,
+	0x05, 0x06, 0x00, 0xE2, 0x05, 0x06, 0x00, 0xE3, 0x05, 0x06, 0x00, 0xE4, 0x05, 0x06, 0x00, 0xE5,
+	0x05, 0x06, 0x04, 0xE6, 0xD7, 0x0E, 0x3B, 0x0C, 0x18, 0xE7, 0xD7, 0x69, 0x3A, 0x04, 0x08, 0xE8,
+	0x05, 0x06, 0x00, 0xE9, 0x05, 0x06, 0x00, 0xEA, 0x05, 0x06, 0x00, 0xEB, 0x05, 0x06, 0x00, 0xEC,
+	0x05, 0x06, 0x18, 0xED, 0xD7, 0x69, 0x42, 0x04, 0x08, 0xEE, 0x05, 0x06, 0x00, 0xEF, 0x05, 0x06,
+	0x00, 0xF0, 0x05, 0x06, 0x00, 0xF1, 0x05, 0x06, 0x00, 0xF2, 0x05, 0x06, 0x58, 0xF3, 0xD7, 0x69,
+	0x4A, 0x04, 0x08, 0xF4, 0xD7, 0x69, 0xF2, 0x06, 0xF6, 0x01, 0x0A, 0x04, 0x08, 0x99, 0xD7, 0x69,
+	0x0A, 0x04, 0x08, 0x9A, 0x05, 0x06, 0x00, 0x9B, 0x05, 0x06, 0x00, 0x9C, 0x05, 0x06, 0x00, 0x9D,
+	0x05, 0x06, 0x00, 0x9E, 0x05, 0x06, 0x00, 0x9F, 0x05, 0x06, 0x00, 0xA0, 0x05, 0x06, 0x00, 0xA1,
+	0x05, 0xB8, 0x04, 0xAF, 0xDC, 0x01, 0xD6, 0x00, 0xB0, 0x05, 0x06, 0x00, 0xB1, 0x05, 0x06, 0x00,
+	0xB2, 0x05, 0x06, 0x04, 0xB3, 0xDC, 0x01, 0xD0, 0x00, 0x8A, 0x12, 0xED, 0x0C, 0x00, 0xD3, 0x05,
+	0xB8, 0x00, 0xD4, 0x05, 0x06, 0x00, 0xD5, 0x05, 0x06, 0x00, 0xD6, 0x05, 0x06, 0x00, 0xD7, 0x05,
+	0x06, 0x00, 0xD8, 0x05, 0x06, 0x00, 0xD9, 0x05, 0x06, 0x00, 0xDA, 0x05, 0xBE, 0x00, 0xA3, 0x05,
+	0x06, 0x00, 0xA9, 0x05, 0x06, 0x00, 0xAE, 0x05, 0x06, 0x00, 0xAF, 0x05, 0x06, 0x00, 0xB0, 0x05,
+	0x06, 0x00, 0xB1, 0x05, 0x06, 0x00, 0xB7, 0x05, 0x06, 0x00, 0xBD, 0x05, 0x06, 0x00, 0xC0, 0x05,
+	0x06, 0x00, 0xC2, 0x05, 0x06, 0x00, 0xC3, 0x05, 0x06, 0x00, 0xC4, 0x05, 0xE2, 0x04, 0xA9, 0xDC,
+	0x21, 0x06, 0x00, 0xAA, 0x05, 0x06, 0x00, 0xAB, 0x05, 0x06, 0x00, 0xAC, 0x05, 0x06, 0x00, 0xAD,
+	0x05, 0x06, 0x28, 0xAE, 0xDC, 0x69, 0xC2, 0x07, 0x24, 0x0A, 0x04, 0x08, 0xC8, 0xDA, 0x01, 0xF9,
+	0x00, 0xF4, 0x05, 0x06, 0x04, 0xA0, 0xDB, 0x01, 0x0C, 0x00, 0xCC, 0x05, 0x06, 0x00, 0xF8, 0x05,
+	0x06, 0x10, 0xA4, 0xDC, 0x69, 0xC2, 0x0C, 0x01, 0x27, 0x04, 0x9F, 0xD9, 0x01, 0x1B, 0x00, 0xB8,
+	0x05, 0x06, 0x00, 0xD1, 0x05, 0x06, 0x00, 0xEA, 0x05, 0x06, 0x00, 0x83, 0x05, 0x39, 0x28, 0x9C,
+	0xDA, 0x69, 0x92, 0x0D, 0x12, 0x0A, 0x04, 0x08, 0xA5, 0xDC, 0x01, 0x27, 0x04, 0xA6, 0xDC, 0x0E,
+	0xAD, 0x13, 0x0C, 0x95, 0xE0, 0x69, 0x18, 0x21, 0x04, 0x10, 0x12, 0x12, 0x08, 0x83, 0x10, 0x16,
+	0x0C, 0x14, 0x70, 0x20, 0x2A, 0x06, 0xAE, 0xD7, 0x69, 0xB0, 0xDC, 0x69, 0x0A, 0x0C, 0x53, 0x74,
+	0x61, 0x6E, 0x64, 0x61, 0x72, 0x64, 0x20, 0x54, 0x4F, 0x43, 0x10, 0x00, 0x1A, 0x0E, 0x0A, 0x04,
+	0x01, 0xEE, 0x04, 0x12, 0x04, 0x21, 0x4E, 0x08, 0x18, 0x01, 0x15, 0x01, 0x71, 0x10, 0x12, 0x0F,
+	0x08, 0xF8, 0x2E, 0x09, 0x39, 0x10, 0x06, 0x2A, 0x03, 0x8B, 0xE0, 0x0E, 0xFC, 0x13, 0x10, 0x8B,
+	0xE0, 0x69, 0x8B, 0x03, 0x01, 0x06, 0x30, 0x12, 0xDB, 0x02, 0x08, 0xE7, 0x30, 0x12, 0x03, 0x02,
+	0x04, 0x00, 0x18, 0xE2, 0x1A, 0x5A, 0x14, 0x10, 0x23, 0x10, 0x01, 0x18, 0x00, 0x16, 0x65, 0x14,
+	0x00, 0x22, 0x19, 0x0B, 0x00, 0x21, 0x19, 0x0B, 0x00, 0x1B, 0x19, 0x0B, 0x00, 0x1A, 0x19, 0x0B,
+	0x00, 0x19, 0x19, 0x0B, 0x00, 0x18, 0x19, 0x0B, 0x00, 0x17, 0x19, 0x0B, 0x00, 0x20, 0x19, 0x0B,
+	0x00, 0x1F, 0x19, 0x0B, 0x00, 0x1E, 0x19, 0x0B, 0x00, 0x1D, 0x19, 0x0B, 0x00, 0x1C, 0x19, 0x0B,
+	0x00, 0x11, 0x19, 0x0B, 0x00, 0x10, 0x19, 0x0B, 0x00, 0x0F, 0x19, 0x0B, 0x00, 0x0E, 0x19, 0x0B,
+	0x00, 0x0D, 0x19, 0x0B, 0x00, 0x16, 0x19, 0x0B, 0x00, 0x15, 0x19, 0x0B, 0x00, 0x14, 0x19, 0x0B,
+	0x00, 0x13, 0x19, 0x0B, 0x00, 0x12, 0x01, 0x0B, 0xF0, 0x55, 0x2A, 0x51, 0x87, 0xD9, 0x69, 0x89,
+	0xD9, 0x69, 0x8A, 0xD9, 0x69, 0x8B, 0xD9, 0x69, 0x88, 0xD9, 0x69, 0xC6, 0xD7, 0x69, 0xC7, 0xD7,
+	0x69, 0xC5, 0xD7, 0x69, 0x9B, 0xD9, 0x69, 0x8C, 0xD9, 0x69, 0x8D, 0xD9, 0x69, 0x8E, 0xD9, 0x69,
+	0x8F, 0xD9, 0x69, 0x90, 0xD9, 0x69, 0x91, 0xD9, 0x69, 0x92, 0xD9, 0x69, 0x93, 0xD9, 0x69, 0x94,
+	0xD9, 0x69, 0x95, 0xD9, 0x69, 0x96, 0xD9, 0x69, 0x97, 0xD9, 0x69, 0x98, 0xD9, 0x69, 0x99, 0xD9,
+	0x69, 0x9A, 0xD9, 0x69, 0x9C, 0xD9, 0x69, 0x9D, 0xD9, 0x69, 0x9E, 0xD9, 0x69, 0x12, 0x27, 0x08,
+	0x25, 0x5D, 0x14, 0x00, 0x00, 0x18, 0x44, 0x2A, 0x1B, 0x6A, 0x5F, 0x00, 0x10, 0x0A, 0x04, 0x08,
+	0xC7, 0xD7, 0x21, 0xB7, 0x04, 0xC6, 0xD7, 0x21, 0x9F, 0x00, 0xC6, 0x65, 0x17, 0x00, 0xC6, 0x65,
+	0xB1, 0x04, 0x88, 0xD9, 0x61, 0xB1, 0x04, 0x89, 0xD9, 0x61, 0xB1, 0x04, 0x8A, 0xD9, 0x41, 0x8D,
+	0x04, 0x8B, 0xD9, 0x61, 0x75, 0x48, 0x87, 0xD9, 0x69, 0x52, 0x04, 0x08, 0xC5, 0xD7, 0x69, 0x5A,
+	0x04, 0x08, 0x9B, 0xD9, 0x69, 0x60, 0x00, 0x6A, 0x04, 0x01, 0x32, 0x00, 0x72, 0x05, 0x06, 0x00,
+	0x7A, 0x05, 0x06, 0x04, 0x82, 0x01, 0x05, 0x07, 0x00, 0x8A, 0x09, 0x07, 0x00, 0x92, 0x0E, 0x06,
+	0x10, 0xF0, 0x79, 0xD9, 0x69, 0x9A, 0x01, 0x04, 0x08, 0x8D, 0xD9, 0x69, 0xA2, 0x01, 0x04, 0x08,
+	0x8E, 0xD9, 0x69, 0xAA, 0x01, 0x04, 0x08, 0x8F, 0xD9, 0x69, 0xB2, 0x01, 0x04, 0x08, 0x90, 0xD9,
+	0x69, 0xBA, 0x01, 0x04, 0x08, 0x96, 0xD9, 0x69, 0xC2, 0x01, 0x04, 0x08, 0x97, 0xD9, 0x69, 0xCA,
+	0x01, 0x04, 0x08, 0x98, 0xD9, 0x69, 0xD2, 0x01, 0x04, 0x08, 0x99, 0xD9, 0x69, 0xDA, 0x01, 0x04,
+	0x08, 0x9A, 0xD9, 0x69, 0xE2, 0x01, 0x04, 0x08, 0x91, 0xD9, 0x69, 0xEA, 0x01, 0x04, 0x08, 0x92,
+	0xD9, 0x69, 0xF2, 0x01, 0x04, 0x08, 0x93, 0xD9, 0x69, 0xFA, 0x01, 0x04, 0x08, 0x94, 0xD9, 0x69,
+	0x82, 0x02, 0x04, 0x08, 0x95, 0xD9, 0x69, 0x8A, 0x02, 0x04, 0x08, 0x9C, 0xD9, 0x69, 0x92, 0x02,
+	0x04, 0x08, 0x9D, 0xD9, 0x69, 0x9A, 0x02, 0x04, 0x08, 0x9E, 0xD9, 0x69, 0x0A, 0xEE, 0xE2, 0x00,
+	0x0D, 0xE2, 0x00, 0x15, 0x61, 0x3A, 0x36, 0xCF, 0x02, 0x00, 0x8C, 0x45, 0xCF, 0x10, 0x8C, 0xE0,
+	0x69, 0x97, 0x03, 0x01, 0x06, 0x04, 0x12, 0xE1, 0xFE, 0xCF, 0x02, 0xFE, 0xCF, 0x02, 0xFE, 0xCF,
+	0x02, 0xFE, 0xCF, 0x02, 0x59, 0xCF, 0x50, 0x57, 0xA0, 0xD9, 0x69, 0xA2, 0xD9, 0x69, 0xA3, 0xD9,
+	0x69, 0xA4, 0xD9, 0x69, 0xA1, 0xD9, 0x69, 0xC8, 0xD7, 0x69, 0xC9, 0xD7, 0x59, 0xD5, 0xE8, 0xB4,
+	0xD9, 0x69, 0xA5, 0xD9, 0x69, 0xA6, 0xD9, 0x69, 0xA7, 0xD9, 0x69, 0xA8, 0xD9, 0x69, 0xA9, 0xD9,
+	0x69, 0xAA, 0xD9, 0x69, 0xAB, 0xD9, 0x69, 0xAC, 0xD9, 0x69, 0xAD, 0xD9, 0x69, 0xAE, 0xD9, 0x69,
+	0xAF, 0xD9, 0x69, 0xB0, 0xD9, 0x69, 0xB1, 0xD9, 0x69, 0xB2, 0xD9, 0x69, 0xB3, 0xD9, 0x69, 0xB5,
+	0xD9, 0x69, 0xB6, 0xD9, 0x69, 0xB7, 0xD9, 0x69, 0x12, 0x2D, 0x89, 0x32, 0x45, 0xD5, 0x00, 0x21,
+	0x82, 0x65, 0x00, 0x55, 0xDB, 0x00, 0xC8, 0x45, 0xDB, 0x00, 0xC9, 0x5D, 0xDB, 0x00, 0xA1, 0x45,
+	0xDB, 0x00, 0xA2, 0x45, 0xDB, 0x00, 0xA3, 0x45, 0xDB, 0x00, 0xA4, 0x45, 0xDB, 0x00, 0xA0, 0x5D,
+	0xDB, 0x18, 0xB4, 0xD9, 0x69, 0x60, 0x01, 0x6A, 0x04, 0x01, 0x38, 0x00, 0x72, 0x05, 0x06, 0x00,
+	0x7A, 0x05, 0x06, 0x41, 0xDB, 0x04, 0xC9, 0xD7, 0x45, 0xDB, 0x04, 0xC9, 0xD7, 0x45, 0xDB, 0x00,
+	0xA5, 0x49, 0xDB, 0x00, 0xA6, 0x49, 0xDB, 0x00, 0xA7, 0x49, 0xDB, 0x00, 0xA8, 0x49, 0xDB, 0x00,
+	0xA9, 0x49, 0xDB, 0x00, 0xAF, 0x49, 0xDB, 0x04, 0xB0, 0xD9, 0x45, 0xDB, 0x00, 0xB1, 0x49, 0xDB,
+	0x04, 0xB2, 0xD9, 0x45, 0xDB, 0x00, 0xB3, 0x49, 0xDB, 0x04, 0xAA, 0xD9, 0x45, 0xDB, 0x00, 0xAB,
+	0x49, 0xDB, 0x08, 0xAC, 0xD9, 0x69, 0x41, 0xDB, 0x04, 0xAD, 0xD9, 0x45, 0xDB, 0x00, 0xAE, 0x49,
+	0xDB, 0x24, 0xB5, 0xD9, 0x69, 0x92, 0x02, 0x04, 0x08, 0xB6, 0xD9, 0x69, 0x41, 0xDB, 0x00, 0xB7,
+	0xA5, 0xC0, 0x69, 0xBD, 0xEA, 0xE2, 0x00, 0x00, 0x15, 0xC1, 0x0F, 0x36, 0xDB, 0x02, 0x00, 0x8D,
+	0x45, 0xDB, 0x00, 0x8D, 0x45, 0xDB, 0x04, 0x8D, 0xE0, 0xFE, 0xDB, 0x02, 0xFE, 0xDB, 0x02, 0xFE,
+	0xDB, 0x02, 0xFE, 0xDB, 0x02, 0x36, 0xDB, 0x02, 0x30, 0xB9, 0xD9, 0x69, 0xBB, 0xD9, 0x69, 0xBC,
+	0xD9, 0x69, 0xBD, 0xD9, 0x69, 0xBA, 0x42, 0xDB, 0x02, 0xD8, 0xCD, 0xD9, 0x69, 0xBE, 0xD9, 0x69,
+	0xBF, 0xD9, 0x69, 0xC0, 0xD9, 0x69, 0xC1, 0xD9, 0x69, 0xC2, 0xD9, 0x69, 0xC3, 0xD9, 0x69, 0xC4,
+	0xD9, 0x69, 0xC5, 0xD9, 0x69, 0xC6, 0xD9, 0x69, 0xC7, 0xD9, 0x69, 0xC8, 0xD9, 0x69, 0xC9, 0xD9,
+	0x69, 0xCA, 0xD9, 0x69, 0xCB, 0xD9, 0x69, 0xCC, 0xD9, 0x69, 0xCE, 0xD9, 0x69, 0xCF, 0xD9, 0x69,
+	0xD0, 0x3E, 0xDB, 0x02, 0x82, 0x65, 0x00, 0x6A, 0xDB, 0x02, 0x00, 0xBA, 0x45, 0xDB, 0x00, 0xBB,
+	0x45, 0xDB, 0x00, 0xBC, 0x45, 0xDB, 0x00, 0xBD, 0x45, 0xDB, 0x00, 0xB9, 0x5D, 0xDB, 0x10, 0xCD,
+	0xD9, 0x69, 0x60, 0x02, 0x8E, 0xDB, 0x02, 0x00, 0xBE, 0x49, 0xDB, 0x00, 0xBF, 0x49, 0xDB, 0x00,
+	0xC0, 0x49, 0xDB, 0x00, 0xC1, 0x49, 0xDB, 0x00, 0xC2, 0x49, 0xDB, 0x00, 0xC8, 0x49, 0xDB, 0x00,
+	0xC9, 0x49, 0xDB, 0x00, 0xCA, 0x49, 0xDB, 0x00, 0xCB, 0x49, 0xDB, 0x00, 0xCC, 0x49, 0xDB, 0x00,
+	0xC3, 0x49, 0xDB, 0x00, 0xC4, 0x49, 0xDB, 0x00, 0xC5, 0x49, 0xDB, 0x00, 0xC6, 0x49, 0xDB, 0x00,
+	0xC7, 0x49, 0xDB, 0x00, 0xCE, 0x49, 0xDB, 0x00, 0xCF, 0x49, 0xDB, 0x00, 0xD0, 0x72, 0xDB, 0x02,
+	0xA2, 0xE2, 0x00, 0x00, 0x15, 0x0E, 0xE4, 0x08, 0x36, 0xDB, 0x02, 0x00, 0x8E, 0x45, 0xDB, 0x00,
+	0x8E, 0x45, 0xDB, 0x00, 0x8E, 0xFE, 0xDB, 0x02, 0xFE, 0xDB, 0x02, 0xFE, 0xDB, 0x02, 0xFE, 0xDB,
+	0x02, 0x3A, 0xDB, 0x02, 0x30, 0xD2, 0xD9, 0x69, 0xD4, 0xD9, 0x69, 0xD5, 0xD9, 0x69, 0xD6, 0xD9,
+	0x69, 0xD3, 0x42, 0xDB, 0x02, 0xD8, 0xE6, 0xD9, 0x69, 0xD7, 0xD9, 0x69, 0xD8, 0xD9, 0x69, 0xD9,
+	0xD9, 0x69, 0xDA, 0xD9, 0x69, 0xDB, 0xD9, 0x69, 0xDC, 0xD9, 0x69, 0xDD, 0xD9, 0x69, 0xDE, 0xD9,
+	0x69, 0xDF, 0xD9, 0x69, 0xE0, 0xD9, 0x69, 0xE1, 0xD9, 0x69, 0xE2, 0xD9, 0x69, 0xE3, 0xD9, 0x69,
+	0xE4, 0xD9, 0x69, 0xE5, 0xD9, 0x69, 0xE7, 0xD9, 0x69, 0xE8, 0xD9, 0x69, 0xE9, 0x3E, 0xDB, 0x02,
+	0x82, 0x65, 0x00, 0x6A, 0xDB, 0x02, 0x00, 0xD3, 0x45, 0xDB, 0x00, 0xD4, 0x45, 0xDB, 0x00, 0xD5,
+	0x45, 0xDB, 0x00, 0xD6, 0x45, 0xDB, 0x00, 0xD2, 0x5D, 0xDB, 0x10, 0xE6, 0xD9, 0x69, 0x60, 0x03,
+	0x8E, 0xDB, 0x02, 0x00, 0xD7, 0x49, 0xDB, 0x00, 0xD8, 0x49, 0xDB, 0x00, 0xD9, 0x49, 0xDB, 0x00,
+	0xDA, 0x49, 0xDB, 0x00, 0xDB, 0x49, 0xDB, 0x00, 0xE1, 0x49, 0xDB, 0x00, 0xE2, 0x49, 0xDB, 0x00,
+	0xE3, 0x49, 0xDB, 0x00, 0xE4, 0x49, 0xDB, 0x00, 0xE5, 0x49, 0xDB, 0x00, 0xDC, 0x49, 0xDB, 0x00,
+	0xDD, 0x49, 0xDB, 0x00, 0xDE, 0x49, 0xDB, 0x00, 0xDF, 0x49, 0xDB, 0x00, 0xE0, 0x49, 0xDB, 0x00,
+	0xE7, 0x49, 0xDB, 0x00, 0xE8, 0x49, 0xDB, 0x00, 0xE9, 0x72, 0xDB, 0x02, 0xA2, 0xE2, 0x00, 0x00,
+	0x15, 0x0E, 0xB9, 0x0B, 0x36, 0xDB, 0x02, 0x00, 0x8F, 0x45, 0xDB, 0x10, 0x8F, 0xE0, 0x69, 0x91,
+	0x03, 0x01, 0x06, 0x04, 0x12, 0xDE, 0xFE, 0x91, 0x08, 0xFE, 0x91, 0x08, 0xFE, 0x91, 0x08, 0xFE,
+	0x91, 0x08, 0x26, 0x91, 0x08, 0x34, 0x54, 0xEB, 0xD9, 0x69, 0xED, 0xD9, 0x69, 0xEE, 0xD9, 0x69,
+	0xEF, 0xD9, 0x69, 0xEC, 0x12, 0x60, 0x0B, 0x00, 0xCA, 0x1E, 0x63, 0x0B, 0xE8, 0xFF, 0xD9, 0x69,
+	0xF0, 0xD9, 0x69, 0xF1, 0xD9, 0x69, 0xF2, 0xD9, 0x69, 0xF3, 0xD9, 0x69, 0xF4, 0xD9, 0x69, 0xF5,
+	0xD9, 0x69, 0xF6, 0xD9, 0x69, 0xF7, 0xD9, 0x69, 0xF8, 0xD9, 0x69, 0xF9, 0xD9, 0x69, 0xFA, 0xD9,
+	0x69, 0xFB, 0xD9, 0x69, 0xFC, 0xD9, 0x69, 0xFD, 0xD9, 0x69, 0xFE, 0xD9, 0x69, 0x80, 0xDA, 0x69,
+	0x81, 0xDA, 0x69, 0x82, 0xDA, 0x69, 0x12, 0x2A, 0x2A, 0x8E, 0x08, 0x00, 0x1E, 0x76, 0x62, 0x00,
+	0x55, 0xD5, 0x16, 0x66, 0x0B, 0x00, 0xCA, 0x2A, 0x8B, 0x08, 0x00, 0xEC, 0x45, 0xD5, 0x00, 0xED,
+	0x45, 0xD5, 0x00, 0xEE, 0x45, 0xD5, 0x00, 0xEF, 0x45, 0xD5, 0x00, 0xEB, 0x5D, 0xD5, 0x18, 0xFF,
+	0xD9, 0x69, 0x60, 0x04, 0x6A, 0x04, 0x01, 0x38, 0x00, 0x72, 0x05, 0x06, 0x00, 0x7A, 0x05, 0x06,
+	0x0E, 0x8B, 0x08, 0x00, 0xCA, 0x16, 0x8B, 0x08, 0x00, 0xCA, 0x16, 0x8B, 0x08, 0x00, 0xF0, 0x49,
+	0xD5, 0x00, 0xF1, 0x49, 0xD5, 0x00, 0xF2, 0x49, 0xD5, 0x00, 0xF3, 0x49, 0xD5, 0x00, 0xF4, 0x49,
+	0xD5, 0x00, 0xFA, 0x49, 0xD5, 0x00, 0xFB, 0x49, 0xD5, 0x00, 0xFC, 0x49, 0xD5, 0x00, 0xFD, 0x49,
+	0xD5, 0x00, 0xFE, 0x49, 0xD5, 0x00, 0xF5, 0x49, 0xD5, 0x00, 0xF6, 0x49, 0xD5, 0x00, 0xF7, 0x49,
+	0xD5, 0x00, 0xF8, 0x49, 0xD5, 0x00, 0xF9, 0x49, 0xD5, 0x04, 0x80, 0xDA, 0x12, 0x8B, 0x08, 0x04,
+	0x81, 0xDA, 0x12, 0x8B, 0x08, 0x00, 0x82, 0x12, 0x45, 0x0E, 0x16, 0x8B, 0x08, 0xEA, 0xE2, 0x00,
+	0x00, 0x15, 0x0E, 0x88, 0x0E, 0x36, 0xD5, 0x02, 0x00, 0x90, 0x45, 0xD5, 0x00, 0x90, 0x45, 0xD5,
+	0x04, 0x90, 0xE0, 0xFE, 0xD5, 0x02, 0xFE, 0xD5, 0x02, 0xFE, 0xD5, 0x02, 0xFE, 0xD5, 0x02, 0x36,
+	0xD5, 0x02, 0x48, 0x84, 0xDA, 0x69, 0x86, 0xDA, 0x69, 0x87, 0xDA, 0x69, 0x88, 0xDA, 0x69, 0x85,
+	0xDA, 0x69, 0xCC, 0xD7, 0x69, 0xCB, 0x51, 0xD5, 0xD8, 0x98, 0xDA, 0x69, 0x89, 0xDA, 0x69, 0x8A,
+	0xDA, 0x69, 0x8B, 0xDA, 0x69, 0x8C, 0xDA, 0x69, 0x8D, 0xDA, 0x69, 0x8E, 0xDA, 0x69, 0x8F, 0xDA,
+	0x69, 0x90, 0xDA, 0x69, 0x91, 0xDA, 0x69, 0x92, 0xDA, 0x69, 0x93, 0xDA, 0x69, 0x94, 0xDA, 0x69,
+	0x95, 0xDA, 0x69, 0x96, 0xDA, 0x69, 0x97, 0xDA, 0x69, 0x99, 0xDA, 0x69, 0x9A, 0xDA, 0x69, 0x9B,
+	0x3E, 0xD5, 0x02, 0x00, 0x84, 0x72, 0x62, 0x00, 0x55, 0xD5, 0x00, 0xCC, 0x12, 0x60, 0x0B, 0x00,
+	0xCB, 0x45, 0xD5, 0x00, 0xCC, 0x12, 0x3B, 0x0E, 0x04, 0x85, 0xDA, 0x0E, 0x3B, 0x0E, 0x04, 0x86,
+	0xDA, 0x0E, 0x3B, 0x0E, 0x04, 0x87, 0xDA, 0x0E, 0x3B, 0x0E, 0x04, 0x88, 0xDA, 0x0E, 0x3B, 0x0E,
+	0x04, 0x84, 0xDA, 0x26, 0x3B, 0x0E, 0x18, 0x98, 0xDA, 0x69, 0x60, 0x05, 0x6A, 0x04, 0x01, 0x38,
+	0x00, 0x72, 0x05, 0x06, 0x00, 0x7A, 0x05, 0x06, 0x41, 0xD5, 0x00, 0xCB, 0x49, 0xD5, 0x00, 0xCB,
+	0x49, 0xD5, 0x04, 0x89, 0xDA, 0x12, 0x3B, 0x0E, 0x04, 0x8A, 0xDA, 0x12, 0x3B, 0x0E, 0x04, 0x8B,
+	0xDA, 0x12, 0x3B, 0x0E, 0x04, 0x8C, 0xDA, 0x12, 0x3B, 0x0E, 0x04, 0x8D, 0xDA, 0x12, 0x3B, 0x0E,
+	0x08, 0x93, 0xDA, 0x69, 0x0E, 0x3B, 0x0E, 0x04, 0x94, 0xDA, 0x12, 0x60, 0x0B, 0x08, 0x95, 0xDA,
+	0x69, 0x0E, 0x3B, 0x0E, 0x04, 0x96, 0xDA, 0x12, 0x60, 0x0B, 0x08, 0x97, 0xDA, 0x69, 0x0E, 0x3B,
+	0x0E, 0x04, 0x8E, 0xDA, 0x12, 0x60, 0x0B, 0x0C, 0x8F, 0xDA, 0x69, 0xF2, 0x0E, 0x73, 0x0E, 0x00,
+	0xDA, 0x12, 0x60, 0x0B, 0x04, 0x91, 0xDA, 0x12, 0x60, 0x0B, 0x1C, 0x92, 0xDA, 0x69, 0x8A, 0x02,
+	0x04, 0x08, 0x99, 0x49, 0xD5, 0x00, 0x9A, 0x49, 0xD5, 0x00, 0x9B, 0x5D, 0xD5, 0xEA, 0xE2, 0x00,
+	0x04, 0x92, 0x01, 0x0E, 0xA3, 0x11, 0x14, 0x12, 0x8B, 0x01, 0x08, 0x9C, 0x27, 0x16, 0x0C, 0x11,
+	0xF0, 0x86, 0x92, 0x02, 0x2A, 0x7E, 0x9D, 0xDA, 0x69, 0x9E, 0xDA, 0x69, 0x9F, 0xDA, 0x69, 0xA0,
+	0xDA, 0x69, 0xA1, 0xDA, 0x69, 0xA2, 0xDA, 0x69, 0xA3, 0xDA, 0x69, 0xA4, 0xDA, 0x69, 0xA5, 0xDA,
+	0x69, 0xA6, 0xDA, 0x69, 0xA7, 0xDA, 0x69, 0xA9, 0xDA, 0x69, 0xAA, 0xDA, 0x69, 0xAB, 0xDA, 0x69,
+	0xAC, 0xDA, 0x69, 0xAD, 0xDA, 0x69, 0xAE, 0xDA, 0x69, 0xAF, 0xDA, 0x69, 0xB0, 0xDA, 0x69, 0xB1,
+	0xDA, 0x69, 0xB2, 0xDA, 0x69, 0xB3, 0xDA, 0x69, 0xB4, 0xDA, 0x69, 0xB5, 0xDA, 0x69, 0xB6, 0xDA,
+	0x69, 0xB7, 0xDA, 0x69, 0xB8, 0xDA, 0x69, 0xB9, 0xDA, 0x69, 0xBA, 0xDA, 0x69, 0xBB, 0xDA, 0x69,
+	0xBC, 0xDA, 0x69, 0xBD, 0xDA, 0x69, 0xBE, 0xDA, 0x69, 0xBF, 0xDA, 0x69, 0xC0, 0xDA, 0x69, 0xC1,
+	0xDA, 0x69, 0xC2, 0xDA, 0x69, 0xC3, 0xDA, 0x69, 0xC4, 0xDA, 0x69, 0xC5, 0xDA, 0x69, 0xC6, 0xDA,
+	0x69, 0xC7, 0xDA, 0x69, 0x0A, 0x04, 0x08, 0x9D, 0xDA, 0x0E, 0xF5, 0x0F, 0x04, 0x9E, 0xDA, 0x0E,
+	0xF5, 0x0F, 0x00, 0x9F, 0x05, 0x06, 0x04, 0xA0, 0xDA, 0x0E, 0x0C, 0x13, 0x04, 0xA1, 0xDA, 0x0E,
+	0xFA, 0x12, 0x00, 0xA2, 0x05, 0x06, 0x00, 0xA3, 0x05, 0x06, 0x00, 0xA4, 0x05, 0x06, 0x00, 0xA5,
+	0x05, 0x06, 0x00, 0xA6, 0x05, 0x06, 0x00, 0xA7, 0x25, 0xDE, 0x00, 0xA9, 0x05, 0x06, 0x00, 0xAA,
+	0x05, 0x06, 0x00, 0xAB, 0x05, 0x06, 0x00, 0xAC, 0x05, 0x06, 0x00, 0xAD, 0x05, 0x06, 0x00, 0xAE,
+	0x05, 0x06, 0x00, 0xAF, 0x05, 0x06, 0x00, 0xB0, 0x05, 0x06, 0x00, 0xB1, 0x05, 0x06, 0x00, 0xB2,
+	0x05, 0x06, 0x00, 0xB3, 0x05, 0x06, 0x00, 0xB4, 0x05, 0x06, 0x00, 0xB5, 0x05, 0x06, 0x00, 0xB6,
+	0x05, 0x06, 0x00, 0xB7, 0x05, 0x06, 0x00, 0xB8, 0x05, 0x06, 0x00, 0xB9, 0x05, 0x06, 0x00, 0xBA,
+	0x05, 0x06, 0x00, 0xBB, 0x05, 0x06, 0x00, 0xBC, 0x05, 0x06, 0x00, 0xBD, 0x05, 0x06, 0x00, 0xBE,
+	0x05, 0x06, 0x00, 0xBF, 0x05, 0x06, 0x00, 0xC0, 0x05, 0x06, 0x00, 0xC1, 0x05, 0x06, 0x00, 0xC2,
+	0x05, 0x06, 0x00, 0xC3, 0x05, 0x06, 0x00, 0xC4, 0x05, 0x06, 0x00, 0xC5, 0x05, 0x06, 0x60, 0xC6,
+	0xDA, 0x69, 0x3A, 0x10, 0x00, 0xD9, 0xDE, 0xC1, 0x0D, 0xFD, 0x4E, 0x22, 0x98, 0xF4, 0x2F, 0x79,
+	0x6A, 0xC7, 0x06, 0x26, 0x82, 0xF1, 0x04, 0x06, 0x41, 0xC6, 0x0C, 0xDA, 0x69, 0x92, 0x01, 0x0E,
+	0x43, 0x13, 0x3E, 0xA6, 0x01, 0xF0, 0x9A, 0xC9, 0xDA, 0x69, 0xCA, 0xDA, 0x69, 0xCB, 0xDA, 0x69,
+	0xCC, 0xDA, 0x69, 0xCD, 0xDA, 0x69, 0xCE, 0xDA, 0x69, 0xCF, 0xDA, 0x69, 0xD0, 0xDA, 0x69, 0xD1,
+	0xDA, 0x69, 0xD2, 0xDA, 0x69, 0xD3, 0xDA, 0x69, 0xD5, 0xDA, 0x69, 0xD6, 0xDA, 0x69, 0xD7, 0xDA,
+	0x69, 0xD8, 0xDA, 0x69, 0xD9, 0xDA, 0x69, 0xDA, 0xDA, 0x69, 0xDB, 0xDA, 0x69, 0xDC, 0xDA, 0x69,
+	0xDD, 0xDA, 0x69, 0xDE, 0xDA, 0x69, 0xDF, 0xDA, 0x69, 0xE0, 0xDA, 0x69, 0xE1, 0xDA, 0x69, 0xE2,
+	0xDA, 0x69, 0xE3, 0xDA, 0x69, 0xE4, 0xDA, 0x69, 0xE5, 0xDA, 0x69, 0xE6, 0xDA, 0x69, 0xE7, 0xDA,
+	0x69, 0xE8, 0xDA, 0x69, 0xE9, 0xDA, 0x69, 0xEA, 0xDA, 0x69, 0xEB, 0xDA, 0x69, 0xEC, 0xDA, 0x69,
+	0xED, 0xDA, 0x69, 0xEE, 0xDA, 0x69, 0xEF, 0xDA, 0x69, 0xF0, 0xDA, 0x69, 0xF1, 0xDA, 0x69, 0xF2,
+	0xDA, 0x69, 0xF3, 0xDA, 0x69, 0x0A, 0x04, 0x08, 0xC9, 0xDA, 0x69, 0x12, 0x04, 0x08, 0xCA, 0xDA,
+	0x69, 0x1A, 0x04, 0x08, 0xCB, 0xDA, 0x69, 0x1A, 0x04, 0x08, 0xCC, 0xDA, 0x69, 0x22, 0x04, 0x08,
+	0xCD, 0xDA, 0x21, 0xA6, 0x00, 0xCE, 0x25, 0x8E, 0x00, 0xCF, 0x05, 0x06, 0x00, 0xD0, 0x05, 0x06,
+	0x00, 0xD1, 0x05, 0x06, 0x00, 0xD2, 0x05, 0x06, 0x00, 0xD3, 0x05, 0xF8, 0x00, 0xD5, 0x05, 0x06,
+	0x00, 0xD6, 0x05, 0x06, 0x00, 0xD7, 0x05, 0x06, 0x00, 0xD8, 0x05, 0x06, 0x00, 0xD9, 0x05, 0x06,
+	0x00, 0xDA, 0x05, 0x06, 0x00, 0xDB, 0x05, 0x06, 0x00, 0xDC, 0x05, 0x06, 0x00, 0xDD, 0x05, 0x06,
+	0x00, 0xDE, 0x05, 0x06, 0x00, 0xDF, 0x05, 0x06, 0x00, 0xE0, 0x05, 0x06, 0x00, 0xE1, 0x05, 0x06,
+	0x00, 0xE2, 0x05, 0x06, 0x00, 0xE3, 0x05, 0x06, 0x00, 0xE4, 0x05, 0x06, 0x00, 0xE5, 0x05, 0x06,
+	0x00, 0xE6, 0x05, 0x06, 0x00, 0xE7, 0x05, 0x06, 0x00, 0xE8, 0x05, 0x06, 0x00, 0xE9, 0x05, 0x06,
+	0x00, 0xEA, 0x05, 0x06, 0x00, 0xEB, 0x05, 0x06, 0x00, 0xEC, 0x05, 0x06, 0x00, 0xED, 0x05, 0x06,
+	0x00, 0xEE, 0x05, 0x06, 0x00, 0xEF, 0x05, 0x06, 0x00, 0xF0, 0x05, 0x06, 0x00, 0xF1, 0x05, 0x06,
+	0x00, 0xF2, 0x21, 0xA6, 0x3C, 0x20, 0xD7, 0x05, 0x1C, 0x7C, 0xD9, 0x43, 0x4C, 0xB7, 0xEB, 0x97,
+	0x71, 0xE3, 0xF4, 0x7D, 0x80, 0x2D, 0xA6, 0x00, 0xF3, 0x25, 0xA6, 0x04, 0xA0, 0xDB, 0x42, 0xA6,
+	0x01, 0xF0, 0x81, 0xF5, 0xDA, 0x69, 0xF6, 0xDA, 0x69, 0xF7, 0xDA, 0x69, 0xF8, 0xDA, 0x69, 0xF9,
+	0xDA, 0x69, 0xFA, 0xDA, 0x69, 0xFB, 0xDA, 0x69, 0xFC, 0xDA, 0x69, 0xFD, 0xDA, 0x69, 0xFE, 0xDA,
+	0x69, 0xFF, 0xDA, 0x69, 0x81, 0xDB, 0x69, 0x82, 0xDB, 0x69, 0x83, 0xDB, 0x69, 0x84, 0xDB, 0x69,
+	0x85, 0xDB, 0x69, 0x86, 0xDB, 0x69, 0x87, 0xDB, 0x69, 0x88, 0xDB, 0x69, 0x89, 0xDB, 0x69, 0x8A,
+	0xDB, 0x69, 0x8B, 0xDB, 0x69, 0x8C, 0xDB, 0x69, 0x8D, 0xDB, 0x69, 0x8E, 0xDB, 0x69, 0x8F, 0xDB,
+	0x69, 0x90, 0xDB, 0x69, 0x91, 0xDB, 0x69, 0x92, 0xDB, 0x69, 0x93, 0xDB, 0x69, 0x94, 0xDB, 0x69,
+	0x95, 0xDB, 0x69, 0x96, 0xDB, 0x69, 0x97, 0xDB, 0x69, 0x98, 0xDB, 0x69, 0x99, 0xDB, 0x69, 0x9A,
+	0xDB, 0x69, 0x9B, 0xDB, 0x69, 0x9C, 0xDB, 0x69, 0x9D, 0xDB, 0x69, 0x9E, 0xDB, 0x69, 0x9F, 0xDB,
+	0x69, 0x0A, 0x04, 0x08, 0xF5, 0x25, 0xA6, 0x00, 0xF6, 0x65, 0x46, 0x00, 0xF7, 0x05, 0x06, 0x00,
+	0xF8, 0x65, 0x4C, 0x00, 0xF9, 0x25, 0x88, 0x00, 0xFA, 0x05, 0x06, 0x00, 0xFB, 0x05, 0x06, 0x00,
+	0xFC, 0x05, 0x06, 0x00, 0xFD, 0x05, 0x06, 0x00, 0xFE, 0x05, 0x06, 0x00, 0xFF, 0x05, 0xF8, 0x04,
+	0x81, 0xDB, 0xA1, 0x30, 0x00, 0x82, 0x05, 0x06, 0x00, 0x83, 0x05, 0x06, 0x00, 0x84, 0x05, 0x06,
+	0x00, 0x85, 0x05, 0x06, 0x00, 0x86, 0x05, 0x06, 0x00, 0x87, 0x05, 0x06, 0x00, 0x88, 0x05, 0x06,
+	0x00, 0x89, 0x05, 0x06, 0x00, 0x8A, 0x05, 0x06, 0x00, 0x8B, 0x05, 0x06, 0x00, 0x8C, 0x05, 0x06,
+	0x00, 0x8D, 0x05, 0x06, 0x00, 0x8E, 0x05, 0x06, 0x00, 0x8F, 0x05, 0x06, 0x00, 0x90, 0x05, 0x06,
+	0x00, 0x91, 0x05, 0x06, 0x00, 0x92, 0x05, 0x06, 0x00, 0x93, 0x05, 0x06, 0x00, 0x94, 0x05, 0x06,
+	0x00, 0x95, 0x05, 0x06, 0x00, 0x96, 0x05, 0x06, 0x00, 0x97, 0x05, 0x06, 0x00, 0x98, 0x05, 0x06,
+	0x00, 0x99, 0x05, 0x06, 0x00, 0x9A, 0x05, 0x06, 0x00, 0x9B, 0x05, 0x06, 0x00, 0x9C, 0x05, 0x06,
+	0x00, 0x9D, 0x05, 0x06, 0x50, 0x9E, 0xDB, 0x69, 0x3A, 0x10, 0x43, 0x5E, 0xD5, 0xB4, 0x48, 0xA8,
+	0x44, 0x4E, 0x93, 0x41, 0x14, 0xB7, 0x4C, 0x12, 0x12, 0x84, 0x2D, 0xA6, 0x04, 0x9F, 0xDB, 0x61,
+	0x4C, 0x00, 0xCC, 0x46, 0xA6, 0x01, 0xF0, 0x9A, 0xA1, 0xDB, 0x69, 0xA2, 0xDB, 0x69, 0xA3, 0xDB,
+	0x69, 0xA4, 0xDB, 0x69, 0xA5, 0xDB, 0x69, 0xA6, 0xDB, 0x69, 0xA7, 0xDB, 0x69, 0xA8, 0xDB, 0x69,
+	0xA9, 0xDB, 0x69, 0xAA, 0xDB, 0x69, 0xAB, 0xDB, 0x69, 0xAD, 0xDB, 0x69, 0xAE, 0xDB, 0x69, 0xAF,
+	0xDB, 0x69, 0xB0, 0xDB, 0x69, 0xB1, 0xDB, 0x69, 0xB2, 0xDB, 0x69, 0xB3, 0xDB, 0x69, 0xB4, 0xDB,
+	0x69, 0xB5, 0xDB, 0x69, 0xB6, 0xDB, 0x69, 0xB7, 0xDB, 0x69, 0xB8, 0xDB, 0x69, 0xB9, 0xDB, 0x69,
+	0xBA, 0xDB, 0x69, 0xBB, 0xDB, 0x69, 0xBC, 0xDB, 0x69, 0xBD, 0xDB, 0x69, 0xBE, 0xDB, 0x69, 0xBF,
+	0xDB, 0x69, 0xC0, 0xDB, 0x69, 0xC1, 0xDB, 0x69, 0xC2, 0xDB, 0x69, 0xC3, 0xDB, 0x69, 0xC4, 0xDB,
+	0x69, 0xC5, 0xDB, 0x69, 0xC6, 0xDB, 0x69, 0xC7, 0xDB, 0x69, 0xC8, 0xDB, 0x69, 0xC9, 0xDB, 0x69,
+	0xCA, 0xDB, 0x69, 0xCB, 0xDB, 0x69, 0x0A, 0x04, 0x08, 0xA1, 0xDB, 0x69, 0x12, 0x04, 0x08, 0xA2,
+	0xDB, 0x69, 0x1A, 0x04, 0x08, 0xA3, 0xDB, 0x69, 0x1A, 0x04, 0x08, 0xA4, 0xDB, 0x69, 0x22, 0x04,
+	0x08, 0xA5, 0xDB, 0x61, 0x4C, 0x04, 0xA6, 0xDB, 0x01, 0x06, 0x00, 0xA7, 0x05, 0x06, 0x00, 0xA8,
+	0x05, 0x06, 0x00, 0xA9, 0x05, 0x06, 0x00, 0xAA, 0x05, 0x06, 0x00, 0xAB, 0x05, 0xF8, 0x00, 0xAD,
+	0x05, 0x06, 0x00, 0xAE, 0x05, 0x06, 0x00, 0xAF, 0x05, 0x06, 0x00, 0xB0, 0x05, 0x06, 0x00, 0xB1,
+	0x05, 0x06, 0x00, 0xB2, 0x05, 0x06, 0x00, 0xB3, 0x05, 0x06, 0x00, 0xB4, 0x05, 0x06, 0x00, 0xB5,
+	0x05, 0x06, 0x00, 0xB6, 0x05, 0x06, 0x00, 0xB7, 0x05, 0x06, 0x00, 0xB8, 0x05, 0x06, 0x00, 0xB9,
+	0x05, 0x06, 0x00, 0xBA, 0x05, 0x06, 0x00, 0xBB, 0x05, 0x06, 0x00, 0xBC, 0x05, 0x06, 0x00, 0xBD,
+	0x05, 0x06, 0x00, 0xBE, 0x05, 0x06, 0x00, 0xBF, 0x05, 0x06, 0x00, 0xC0, 0x05, 0x06, 0x00, 0xC1,
+	0x05, 0x06, 0x00, 0xC2, 0x05, 0x06, 0x00, 0xC3, 0x05, 0x06, 0x00, 0xC4, 0x05, 0x06, 0x00, 0xC5,
+	0x05, 0x06, 0x00, 0xC6, 0x05, 0x06, 0x00, 0xC7, 0x05, 0x06, 0x00, 0xC8, 0x05, 0x06, 0x00, 0xC9,
+	0x05, 0x06, 0x00, 0xCA, 0x21, 0xA6, 0x3C, 0xA6, 0xC8, 0xE9, 0xBE, 0xAC, 0x30, 0x4A, 0x30, 0xB8,
+	0xD2, 0xB4, 0xCF, 0xC1, 0xE0, 0x75, 0xD3, 0x2D, 0xA6, 0x00, 0xCB, 0x25, 0xA6, 0x04, 0xF8, 0xDB,
+	0x42, 0x4C, 0x03, 0xF0, 0x81, 0xCD, 0xDB, 0x69, 0xCE, 0xDB, 0x69, 0xCF, 0xDB, 0x69, 0xD0, 0xDB,
+	0x69, 0xD1, 0xDB, 0x69, 0xD2, 0xDB, 0x69, 0xD3, 0xDB, 0x69, 0xD4, 0xDB, 0x69, 0xD5, 0xDB, 0x69,
+	0xD6, 0xDB, 0x69, 0xD7, 0xDB, 0x69, 0xD9, 0xDB, 0x69, 0xDA, 0xDB, 0x69, 0xDB, 0xDB, 0x69, 0xDC,
+	0xDB, 0x69, 0xDD, 0xDB, 0x69, 0xDE, 0xDB, 0x69, 0xDF, 0xDB, 0x69, 0xE0, 0xDB, 0x69, 0xE1, 0xDB,
+	0x69, 0xE2, 0xDB, 0x69, 0xE3, 0xDB, 0x69, 0xE4, 0xDB, 0x69, 0xE5, 0xDB, 0x69, 0xE6, 0xDB, 0x69,
+	0xE7, 0xDB, 0x69, 0xE8, 0xDB, 0x69, 0xE9, 0xDB, 0x69, 0xEA, 0xDB, 0x69, 0xEB, 0xDB, 0x69, 0xEC,
+	0xDB, 0x69, 0xED, 0xDB, 0x69, 0xEE, 0xDB, 0x69, 0xEF, 0xDB, 0x69, 0xF0, 0xDB, 0x69, 0xF1, 0xDB,
+	0x69, 0xF2, 0xDB, 0x69, 0xF3, 0xDB, 0x69, 0xF4, 0xDB, 0x69, 0xF5, 0xDB, 0x69, 0xF6, 0xDB, 0x69,
+	0xF7, 0xDB, 0x69, 0x0A, 0x04, 0x08, 0xCD, 0x25, 0xA6, 0x04, 0xCE, 0xDB, 0xC1, 0x98, 0x00, 0xCF,
+	0x05, 0x06, 0x04, 0xD0, 0xDB, 0xC1, 0x98, 0x00, 0xD1, 0x25, 0x88, 0x00, 0xD2, 0x05, 0x06, 0x00,
+	0xD3, 0x05, 0x06, 0x00, 0xD4, 0x05, 0x06, 0x00, 0xD5, 0x05, 0x06, 0x00, 0xD6, 0x05, 0x06, 0x00,
+	0xD7, 0x05, 0xF8, 0x00, 0xD9, 0x05, 0x06, 0x00, 0xDA, 0x05, 0x06, 0x00, 0xDB, 0x05, 0x06, 0x00,
+	0xDC, 0x05, 0x06, 0x00, 0xDD, 0x05, 0x06, 0x00, 0xDE, 0x05, 0x06, 0x00, 0xDF, 0x05, 0x06, 0x00,
+	0xE0, 0x05, 0x06, 0x00, 0xE1, 0x05, 0x06, 0x00, 0xE2, 0x05, 0x06, 0x00, 0xE3, 0x05, 0x06, 0x00,
+	0xE4, 0x05, 0x06, 0x00, 0xE5, 0x05, 0x06, 0x00, 0xE6, 0x05, 0x06, 0x00, 0xE7, 0x05, 0x06, 0x00,
+	0xE8, 0x05, 0x06, 0x00, 0xE9, 0x05, 0x06, 0x00, 0xEA, 0x05, 0x06, 0x00, 0xEB, 0x05, 0x06, 0x00,
+	0xEC, 0x05, 0x06, 0x00, 0xED, 0x05, 0x06, 0x00, 0xEE, 0x05, 0x06, 0x00, 0xEF, 0x05, 0x06, 0x00,
+	0xF0, 0x05, 0x06, 0x00, 0xF1, 0x05, 0x06, 0x00, 0xF2, 0x05, 0x06, 0x00, 0xF3, 0x05, 0x06, 0x00,
+	0xF4, 0x05, 0x06, 0x00, 0xF5, 0x05, 0x06, 0x00, 0xF6, 0x21, 0xA6, 0x3C, 0xA5, 0xF2, 0x1D, 0x52,
+	0x4E, 0x30, 0x44, 0x66, 0xBD, 0xB3, 0x2B, 0xC9, 0x16, 0x63, 0xF1, 0x39, 0x2D, 0xA6, 0x04, 0xF7,
+	0xDB, 0x61, 0x4C, 0x04, 0xA4, 0xDC, 0x42, 0xA6, 0x01, 0xF0, 0x81, 0xF9, 0xDB, 0x69, 0xFA, 0xDB,
+	0x69, 0xFB, 0xDB, 0x69, 0xFC, 0xDB, 0x69, 0xFD, 0xDB, 0x69, 0xFE, 0xDB, 0x69, 0xFF, 0xDB, 0x69,
+	0x80, 0xDC, 0x69, 0x81, 0xDC, 0x69, 0x82, 0xDC, 0x69, 0x83, 0xDC, 0x69, 0x85, 0xDC, 0x69, 0x86,
+	0xDC, 0x69, 0x87, 0xDC, 0x69, 0x88, 0xDC, 0x69, 0x89, 0xDC, 0x69, 0x8A, 0xDC, 0x69, 0x8B, 0xDC,
+	0x69, 0x8C, 0xDC, 0x69, 0x8D, 0xDC, 0x69, 0x8E, 0xDC, 0x69, 0x8F, 0xDC, 0x69, 0x90, 0xDC, 0x69,
+	0x91, 0xDC, 0x69, 0x92, 0xDC, 0x69, 0x93, 0xDC, 0x69, 0x94, 0xDC, 0x69, 0x95, 0xDC, 0x69, 0x96,
+	0xDC, 0x69, 0x97, 0xDC, 0x69, 0x98, 0xDC, 0x69, 0x99, 0xDC, 0x69, 0x9A, 0xDC, 0x69, 0x9B, 0xDC,
+	0x69, 0x9C, 0xDC, 0x69, 0x9D, 0xDC, 0x69, 0x9E, 0xDC, 0x69, 0x9F, 0xDC, 0x69, 0xA0, 0xDC, 0x69,
+	0xA1, 0xDC, 0x69, 0xA2, 0xDC, 0x69, 0xA3, 0xDC, 0x69, 0x0A, 0x04, 0x08, 0xF9, 0x25, 0xA6, 0x00,
+	0xFA, 0x25, 0xA0, 0x00, 0xFB, 0x05, 0x06, 0x00, 0xFC, 0x25, 0xA6, 0x00, 0xFD, 0x25, 0x88, 0x00,
+	0xFE, 0x05, 0x06, 0x00, 0xFF, 0x05, 0x06, 0x00, 0x80, 0x12, 0x4A, 0x1B, 0x00, 0x81, 0x05, 0x06,
+	0x00, 0x82, 0x05, 0x06, 0x04, 0x83, 0xDC, 0x81, 0xEC, 0x00, 0x85, 0x05, 0x06, 0x00, 0x86, 0x05,
+	0x06, 0x00, 0x87, 0x05, 0x06, 0x00, 0x88, 0x05, 0x06, 0x00, 0x89, 0x05, 0x06, 0x00, 0x8A, 0x05,
+	0x06, 0x00, 0x8B, 0x05, 0x06, 0x00, 0x8C, 0x05, 0x06, 0x00, 0x8D, 0x05, 0x06, 0x00, 0x8E, 0x05,
+	0x06, 0x00, 0x8F, 0x05, 0x06, 0x00, 0x90, 0x05, 0x06, 0x00, 0x91, 0x05, 0x06, 0x00, 0x92, 0x05,
+	0x06, 0x00, 0x93, 0x05, 0x06, 0x00, 0x94, 0x05, 0x06, 0x00, 0x95, 0x05, 0x06, 0x00, 0x96, 0x05,
+	0x06, 0x00, 0x97, 0x05, 0x06, 0x00, 0x98, 0x05, 0x06, 0x00, 0x99, 0x05, 0x06, 0x00, 0x9A, 0x05,
+	0x06, 0x00, 0x9B, 0x05, 0x06, 0x00, 0x9C, 0x05, 0x06, 0x00, 0x9D, 0x05, 0x06, 0x00, 0x9E, 0x05,
+	0x06, 0x00, 0x9F, 0x05, 0x06, 0x00, 0xA0, 0x05, 0x06, 0x00, 0xA1, 0x05, 0x06, 0x50, 0xA2, 0xDC,
+	0x69, 0x3A, 0x10, 0xAC, 0xEC, 0xD5, 0x5A, 0x3E, 0x83, 0x4D, 0x1D, 0x94, 0x25, 0x4D, 0x8F, 0x7D,
+	0x90, 0xE8, 0x81, 0x2D, 0xA6, 0x18, 0xA3, 0xDC, 0x69, 0x15, 0x08, 0x8C, 0xDE, 0x0E, 0xB9, 0x0C,
+	0x04, 0x9F, 0x4E, 0x16, 0xE2, 0x09, 0x10, 0x06, 0x2A, 0x03, 0xBB, 0xDF, 0x0E, 0x20, 0x0B, 0x0C,
+	0xBB, 0xDF, 0x69, 0x1E, 0x01, 0x05, 0x10, 0x12, 0x18, 0x08, 0xD1, 0x0F, 0x09, 0x1C, 0x44, 0x61,
+	0x2A, 0x0C, 0xB7, 0xD7, 0x69, 0x99, 0xD7, 0x69, 0xFF, 0xDF, 0x69, 0xC8, 0xDD, 0x69, 0x08, 0x00,
+	0x12, 0x12, 0x17, 0x2F, 0x0C, 0x2A, 0x0A, 0x0A, 0x08, 0x05, 0x0C, 0x34, 0xB7, 0xD7, 0x69, 0x32,
+	0x08, 0x0A, 0x06, 0x08, 0x00, 0x10, 0x00, 0x18, 0x00, 0x3A, 0x11, 0x16, 0x14, 0x99, 0xD7, 0x69,
+	0x50, 0x01, 0x62, 0x11, 0x0E, 0x0C, 0xFF, 0xDF, 0x69, 0x72, 0x15, 0x24, 0x04, 0x8A, 0x01, 0x11,
+	0x17, 0x10, 0xC8, 0xDD, 0x69, 0xC2, 0x01, 0x15, 0x18, 0x1C, 0xE2, 0x01, 0x04, 0x0A, 0x02, 0x08,
+	0x00, 0x29, 0x01, 0x17, 0x0C, 0x12, 0x23, 0x08, 0x9B, 0x0D, 0x9C, 0x00, 0x39, 0x16, 0x60, 0x1B,
+	0x0E, 0xF2, 0x1A, 0x80, 0x01, 0x2A, 0x0C, 0x9C, 0xDE, 0x69, 0x82, 0xDF, 0x69, 0xC0, 0xDF, 0x69,
+	0x89, 0xDD, 0x69, 0x88, 0x01, 0x01, 0x90, 0x01, 0x00, 0x98, 0x01, 0x00, 0xA0, 0x01, 0x00, 0xA8,
+	0x01, 0x00, 0xB0, 0x01, 0x01, 0x0E, 0x96, 0x19, 0x04, 0x9C, 0xDE, 0x12, 0x5B, 0x0B, 0x04, 0x82,
+	0xDF, 0x12, 0x5B, 0x0B, 0x18, 0xC0, 0xDF, 0x69, 0xD2, 0x01, 0x05, 0x42, 0x0E, 0xED, 0x29, 0x28,
+	0xE0, 0x01, 0x00, 0xEA, 0x01, 0x04, 0x08, 0x89, 0xDD, 0x69, 0x24, 0x01, 0x25, 0x10, 0x12, 0x1E,
+	0x08, 0x9F, 0x4F, 0x09, 0xE3, 0x4C, 0x24, 0x2A, 0x12, 0x8E, 0xDF, 0x69, 0xD4, 0xDF, 0x69, 0xDD,
+	0xDD, 0x69, 0xAE, 0xDF, 0x69, 0xBF, 0xDE, 0x69, 0x92, 0xDE, 0x21, 0x0E, 0x00, 0x8E, 0x25, 0x14,
+	0x00, 0xD4, 0x05, 0x06, 0x04, 0xDD, 0xDD, 0x0E, 0x80, 0x0A, 0x04, 0xAE, 0xDF, 0x01, 0x06, 0x04,
+	0xBF, 0xDE, 0x01, 0x06, 0x0C, 0x92, 0xDE, 0x69, 0x18, 0x01, 0x23, 0x04, 0x12, 0x12, 0x35, 0x2C,
+	0x0C, 0x41, 0x2A, 0x06, 0xC0, 0x25, 0x2C, 0x04, 0x08, 0x01, 0x3A, 0x26, 0x01, 0x00, 0xC0, 0x66,
+	0x26, 0x01, 0x39, 0x1A, 0x3D, 0x0D, 0x00, 0x18, 0x01, 0x77, 0xFE, 0x5A, 0x00, 0x5A, 0x5A, 0x00,
+	0x01, 0xCB, 0xFE, 0xB4, 0x00, 0x56, 0xB4, 0x00, 0x21, 0x1F, 0xFE, 0x5A, 0x00, 0x56, 0x5A, 0x00,
+	0x21, 0x73, 0xFE, 0x5A, 0x00, 0x56, 0x5A, 0x00, 0x04, 0x92, 0xDE, 0xFE, 0x68, 0x01, 0x56, 0x68,
+	0x01, 0x00, 0x24, 0x41, 0x83, 0x36, 0x65, 0x02, 0x3C, 0xFD, 0xDC, 0x69, 0x8D, 0xDD, 0x69, 0x8B,
+	0xDD, 0x69, 0xDD, 0xDE, 0x69, 0xB8, 0xDD, 0x69, 0x81, 0x45, 0x59, 0x00, 0xFD, 0x12, 0xC2, 0x1E,
+	0x04, 0x8D, 0xDD, 0x41, 0x71, 0x00, 0x8B, 0x45, 0x65, 0x00, 0xDD, 0x45, 0x5F, 0x00, 0xB8, 0x05,
+	0x0C, 0x0C, 0x81, 0xDF, 0x69, 0x18, 0x01, 0x23, 0xFE, 0xFD, 0x00, 0x5A, 0xFD, 0x00, 0x04, 0x8D,
+	0xDD, 0xFE, 0x5A, 0x00, 0x5E, 0x5A, 0x00, 0x01, 0xCB, 0xFE, 0xB1, 0x01, 0x56, 0xB1, 0x01, 0x21,
+	0x1F, 0xFE, 0x5A, 0x00, 0x56, 0x5A, 0x00, 0x21, 0x73, 0xFE, 0x5A, 0x00, 0x56, 0x5A, 0x00, 0x04,
+	0x81, 0xDF, 0xFE, 0x68, 0x01, 0x56, 0x68, 0x01, 0x00, 0x24, 0x81, 0xE1, 0x36, 0x65, 0x02, 0x3C,
+	0x8A, 0xDD, 0x69, 0xA1, 0xDE, 0x69, 0xCC, 0xDE, 0x69, 0x95, 0xDF, 0x69, 0xD8, 0xDE, 0x69, 0x8C,
+	0x45, 0x65, 0x00, 0x8A, 0x45, 0x5F, 0x00, 0xA1, 0x85, 0xD6, 0x00, 0xCC, 0x45, 0x5F, 0x00, 0x95,
+	0x85, 0xCA, 0x00, 0xD8, 0x05, 0x0C, 0x00, 0x8C, 0x41, 0x65, 0x00, 0x8A, 0xFE, 0x0B, 0x02, 0x62,
+	0x0B, 0x02, 0x00, 0xA1, 0xFE, 0x62, 0x03, 0x5A, 0x62, 0x03, 0x00, 0x18, 0x05, 0xCB, 0xFE, 0xB1,
+	0x01, 0x56, 0xB1, 0x01, 0x21, 0x1F, 0xFE, 0x5A, 0x00, 0x56, 0x5A, 0x00, 0x21, 0x73, 0xFE, 0x5A,
+	0x00, 0x56, 0x5A, 0x00, 0x00, 0x8C, 0xFE, 0x65, 0x02, 0x5A, 0x65, 0x02, 0x00, 0x15, 0xE1, 0x34,
+	0x40, 0x12, 0x0F, 0x08, 0xA0, 0x4E, 0x12, 0x03, 0x01, 0x01, 0x00, 0x18, 0x0A, 0x2A, 0x03, 0xDF,
+	0xDF, 0x69, 0xED, 0xFF, 0x0C, 0xDF, 0xDF, 0x69, 0x10, 0x01, 0x05, 0x10, 0x12, 0x0A, 0x08, 0xE7,
+	0x17, 0xE9, 0x4F, 0x10, 0x00, 0x10, 0x08, 0xB6, 0xDD, 0x01, 0x11, 0x00, 0x9A, 0x01, 0x31, 0x00,
+	0x00, 0x12, 0xC9, 0x30, 0x00, 0x96, 0x05, 0x11, 0x04, 0xEB, 0x12, 0x09, 0x22, 0x10, 0x02, 0x10,
+	0x00, 0x19, 0x08, 0x0E, 0x62, 0x37, 0x08, 0x13, 0x08, 0x9C, 0x0D, 0x24, 0x04, 0x7A, 0x22, 0x12,
+	0xB5, 0x37, 0x10, 0x22, 0x18, 0x01, 0x08, 0x01, 0x0E, 0xB0, 0x37, 0x0C, 0x20, 0x01, 0x28, 0x01,
+	0x0E, 0x61, 0x27, 0x30, 0x40, 0x01, 0x48, 0x00, 0x50, 0x01, 0x58, 0x00, 0x60, 0x01, 0x68, 0x01,
+	0x70, 0x16, 0x43, 0x37, 0xE9, 0xF8, 0x48, 0xA2, 0x01, 0x01, 0x2C, 0xAA, 0x01, 0x02, 0x65, 0x6E,
+	0xB2, 0x01, 0x00, 0xBA, 0x01, 0x0F, 0x65, 0x6E, 0x5F, 0x41, 0x2A, 0x87, 0x37, 0x00, 0xCA, 0xED,
+	0xF5, 0xB0, 0xD2, 0x01, 0x18, 0x32, 0x30, 0x32, 0x36, 0x2D, 0x30, 0x36, 0x2D, 0x31, 0x35, 0x54,
+	0x31, 0x38, 0x3A, 0x32, 0x33, 0x3A, 0x33, 0x39, 0x2B, 0x30, 0x32, 0x30, 0x30, 0xF0, 0x01, 0x00,
+	0xF8, 0x01, 0x00, 0x80, 0x02, 0x00, 0x88, 0x02, 0x0A, 0x90, 0x02, 0x00, 0xC0, 0x02, 0x00, 0x00,
+	0xD0, 0x02, 0x00, 0xA5, 0x07, 0x70, 0x15, 0x08, 0x9F, 0xE0, 0x69, 0x12, 0x0F, 0x08, 0xD2, 0x01,
+	0x12, 0x03, 0x01, 0x00, 0x05, 0x18, 0x06, 0x2A, 0x03, 0xAD, 0xE0, 0x69, 0x0A, 0x04, 0x08, 0xAD,
+	0xE0, 0x69, 0x18, 0x01, 0x05, 0x10, 0x12, 0x12, 0x08, 0xA3, 0x4F, 0x09, 0x1C, 0x18, 0x0C, 0x2A,
+	0x06, 0xAE, 0xE0, 0x69, 0xAF, 0x05, 0x1F, 0x24, 0xAE, 0xE0, 0x69, 0x12, 0x04, 0x08, 0xAF, 0xE0,
+	0x69, 0x10, 0x05, 0x0B, 0x08, 0x0A, 0x08, 0x93, 0x0D, 0x25, 0x64, 0x74, 0x08, 0x01, 0x10, 0x00,
+	0x18, 0x01, 0x20, 0x01, 0x2A, 0x63, 0x0A, 0x5F, 0x08, 0x01, 0x12, 0x42, 0x1A, 0x04, 0x08, 0x00,
+	0x10, 0x00, 0x20, 0x00, 0x2A, 0x05, 0x08, 0x1C, 0x30, 0x01, 0x38, 0x01, 0x42, 0x12, 0x09, 0x00,
+	0x0D, 0x01, 0x00, 0x11, 0x0D, 0x08, 0x04, 0x00, 0x4A, 0x05, 0x14, 0x10, 0xA0, 0x4E, 0x1E, 0x7E,
+	0x40, 0x01, 0x14, 0x30, 0x90, 0x08, 0xC4, 0x86, 0x40, 0x50, 0x01, 0x58, 0x00, 0x60, 0x00, 0x68,
+	0x00, 0x09, 0x42, 0x00, 0x22, 0x05, 0x40, 0x58, 0x50, 0x35, 0x58, 0x03, 0x90, 0x01, 0x00, 0x98,
+	0x01, 0x00, 0xA2, 0x01, 0x00, 0x10, 0x00, 0x30, 0x00, 0x40, 0xF0, 0xA3, 0xB3, 0x0C, 0x42, 0x01,
+	0x8A, 0x0C, 0x12, 0x3C, 0x08, 0x95, 0x0D, 0x85, 0x30, 0xDE, 0x01, 0x22, 0x07, 0x0A, 0x03, 0x0A,
+	0x01, 0x27, 0x18, 0x01, 0x22, 0x09, 0x01, 0x09, 0x0C, 0x20, 0x10, 0x01, 0x18, 0x0D, 0x14, 0x78,
+	0x17, 0x18, 0x01, 0x2A, 0x12, 0xB0, 0xE0, 0x69, 0xB1, 0xE0, 0x69, 0xB2, 0xE0, 0x69, 0xB3, 0xE0,
+	0x69, 0xA9, 0xE0, 0x69, 0xAA, 0xE0, 0x69, 0x12, 0x0A, 0x0D, 0xCD, 0xCC, 0xCC, 0xBE, 0x15, 0x01,
+	0x91, 0xB0, 0x30, 0x00, 0x3A, 0x0A, 0x0D, 0x00, 0x00, 0x15, 0x44, 0x15, 0x9A, 0x99, 0x52, 0x44,
+	0x48, 0x00, 0x50, 0x00, 0x58, 0x00, 0x60, 0x01, 0x68, 0x00, 0x70, 0x00, 0x7D, 0x00, 0x00, 0xA0,
+	0x3F, 0x82, 0x01, 0x0A, 0x0D, 0x00, 0x80, 0x3D, 0x44, 0x15, 0x00, 0x00, 0xBC, 0x42, 0x8A, 0x01,
+	0x0D, 0xF0, 0x3C, 0xE0, 0x80, 0x44, 0x15, 0x00, 0x20, 0x8C, 0x44, 0x92, 0x01, 0x25, 0x54, 0x50,
+	0x4D, 0x61, 0x63, 0x49, 0x6E, 0x73, 0x70, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x53, 0x65, 0x67, 0x6D,
+	0x65, 0x6E, 0x74, 0x49, 0x64, 0x65, 0x6E, 0x74, 0x69, 0x66, 0x69, 0x65, 0x72, 0x46, 0x6F, 0x72,
+	0x6D, 0x61, 0x74, 0x98, 0x01, 0x00, 0xA0, 0x01, 0x01, 0xAD, 0x01, 0x00, 0x00, 0x00, 0x3F, 0xB5,
+	0x01, 0x06, 0x34, 0x00, 0xB8, 0x01, 0x01, 0xC0, 0x01, 0x00, 0xCA, 0x01, 0x0C, 0x0A, 0x04, 0x08,
+	0xB0, 0x25, 0x62, 0xE0, 0xB1, 0xE0, 0x69, 0xD0, 0x01, 0x01, 0xD8, 0x01, 0x01, 0xE0, 0x01, 0x00,
+	0xF8, 0x01, 0x00, 0x88, 0x02, 0x00, 0x90, 0x02, 0x00, 0x9A, 0x02, 0x04, 0x08, 0xA9, 0xE0, 0x69,
+	0xB0, 0x02, 0x00, 0xB8, 0x02, 0x01, 0xC0, 0x02, 0x00, 0xCA, 0x02, 0x04, 0x08, 0xAA, 0xE0, 0x69,
+	0xD0, 0x02, 0x00, 0xE0, 0x02, 0x00, 0xED, 0x02, 0x00, 0x00, 0x00, 0x00, 0xF5, 0x05, 0x06, 0x04,
+	0xFA, 0x02, 0x01, 0x4A, 0x00, 0xB2, 0x05, 0x4A, 0x00, 0xB3, 0x21, 0xA6, 0x00, 0xB0, 0x01, 0xE3,
+	0x04, 0x08, 0xDB, 0x2D, 0xE7, 0x04, 0x00, 0x10, 0x01, 0x60, 0x0C, 0x12, 0x0A, 0x08, 0x94, 0x2D,
+	0x32, 0x6C, 0x24, 0x08, 0x00, 0x12, 0x08, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x10, 0x00, 0x18,
+	0x00, 0x20, 0x00, 0x48, 0x01, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x58, 0x08, 0x62, 0x15, 0x18,
+	0x00, 0x10, 0x01, 0x51, 0x00, 0x12, 0x32, 0x46, 0x00, 0x04, 0xB3, 0xE0, 0x01, 0x11, 0x11, 0x46,
+	0x0C, 0x18, 0x08, 0x00, 0x12, 0x25, 0xA7, 0x0D, 0x42, 0x0C, 0x00, 0x58, 0x08, 0x62, 0x05, 0x10,
+	0x00, 0x11, 0x01, 0xB6, 0x18, 0x12, 0x0B, 0x08, 0x93, 0x18, 0x12, 0x03, 0x41, 0x67, 0x70, 0xC7,
+	0x01, 0x0A, 0x1D, 0x08, 0x01, 0x1D, 0x77, 0xBE, 0x9F, 0x3D, 0x25, 0x91, 0xED, 0xFC, 0x3E, 0x2D,
+	0x6D, 0xE7, 0x7B, 0x3F, 0x35, 0x00, 0x00, 0x80, 0x3F, 0x60, 0x01, 0x6D, 0x01, 0x07, 0x08, 0x10,
+	0x00, 0x1D, 0x01, 0x07, 0x20, 0x25, 0x00, 0x00, 0x80, 0x40, 0x2D, 0x00, 0x00, 0x00, 0x09, 0x1D,
+	0x00, 0x3D, 0x01, 0x14, 0x00, 0x45, 0x01, 0x14, 0x00, 0x4D, 0x01, 0x0A, 0x1C, 0x55, 0x00, 0x00,
+	0x00, 0x41, 0x58, 0x00, 0x62, 0x76, 0x4B, 0x00, 0x00, 0x6A, 0x01, 0x1F, 0x34, 0x08, 0xAC, 0x9C,
+	0x3E, 0x25, 0xFE, 0xD4, 0x58, 0x3F, 0x2D, 0xF4, 0xFD, 0xD4, 0x3E, 0x2E, 0x6A, 0x00, 0x00, 0x72,
+	0x01, 0x1F, 0x30, 0x23, 0xDB, 0x79, 0x3F, 0x25, 0xCD, 0xCC, 0x4C, 0x3E, 0x2D, 0xF0, 0xA7, 0x86,
+	0x32, 0x1F, 0x00, 0x00, 0x7A, 0x01, 0x1F, 0x30, 0x91, 0xED, 0x7C, 0x3F, 0x25, 0x60, 0xE5, 0x50,
+	0x3F, 0x2D, 0x7F, 0x6A, 0x3C, 0x32, 0x1F, 0x00, 0x04, 0x10, 0x08, 0x45, 0x3C, 0x08, 0x08, 0x82,
+	0x02, 0x09, 0xD9, 0x0C, 0x54, 0x08, 0x01, 0x12, 0x01, 0x32, 0x66, 0x51, 0x00, 0x11, 0xD8, 0x08,
+	0x00, 0x00, 0x2A, 0x01, 0x29, 0x66, 0x5B, 0x00, 0x24, 0x35, 0xCD, 0xCC, 0x4C, 0x3F, 0x3D, 0x00,
+	0x00, 0x00, 0xBF, 0x00, 0x19, 0x02, 0x00, 0xAA, 0x07, 0xF0, 0x71, 0x2E, 0x08, 0x82, 0xE0, 0x69,
+	0x12, 0x28, 0x08, 0xA0, 0x1F, 0x12, 0x03, 0x01, 0x00, 0x05, 0x18, 0x81, 0x03, 0x22, 0x0A, 0x0A,
+	0x04, 0x0A, 0x02, 0x02, 0x06, 0x10, 0x01, 0x18, 0x00, 0x2A, 0x0F, 0x87, 0xE0, 0x69, 0xAB, 0xE0,
+	0x69, 0xAC, 0xE0, 0x69, 0x88, 0xE0, 0x69, 0x89, 0xE0, 0x69, 0x12, 0xC3, 0x02, 0x0A, 0x80, 0x01,
+	0x0A, 0x09, 0x10, 0x9A, 0x05, 0x18, 0x00, 0x20, 0x00, 0x28, 0x00, 0x12, 0x0F, 0x0A, 0x0D, 0x08,
+	0x00, 0x10, 0x01, 0x30, 0x01, 0x4A, 0x05, 0x48, 0x80, 0x80, 0x80, 0x08, 0x1A, 0x00, 0x22, 0x00,
+	0x2A, 0x2C, 0x22, 0x14, 0x08, 0xFF, 0xFF, 0x01, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x18, 0xFF,
+	0xFF, 0x01, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x2A, 0x14, 0x08, 0xFF, 0xFF, 0x42, 0x16, 0x00,
+	0x00, 0x32, 0xB2, 0x2E, 0x00, 0x90, 0x42, 0x00, 0x4A, 0x00, 0x0A, 0x80, 0x01, 0x0A, 0x18, 0x10,
+	0xAD, 0xAD, 0xD8, 0xEB, 0x05, 0x18, 0xB4, 0x95, 0xB7, 0xA2, 0x05, 0x20, 0xA4, 0x8B, 0x9F, 0xB0,
+	0x0C, 0x28, 0x96, 0xEE, 0xFA, 0xA6, 0x05, 0x12, 0x00, 0x1A, 0x00, 0xFE, 0x83, 0x00, 0x86, 0x83,
+	0x00, 0x1C, 0x1A, 0x2D, 0x0A, 0x0D, 0x08, 0x01, 0x12, 0x09, 0x35, 0x09, 0x10, 0x0A, 0x1C, 0x08,
+	0x02, 0x12, 0x62, 0x95, 0x00, 0xF0, 0x49, 0x28, 0x01, 0x32, 0x04, 0x08, 0x87, 0xE0, 0x69, 0x32,
+	0x04, 0x08, 0xAB, 0xE0, 0x69, 0x1A, 0x04, 0x08, 0xAC, 0xE0, 0x69, 0x20, 0x03, 0x30, 0x88, 0x97,
+	0xDB, 0x9A, 0xD4, 0x8E, 0xAB, 0xE5, 0xD8, 0x01, 0x3A, 0x00, 0x49, 0x2E, 0x73, 0xE8, 0x45, 0x2F,
+	0xF0, 0xC7, 0x41, 0x52, 0x0D, 0x45, 0x75, 0x72, 0x6F, 0x70, 0x65, 0x2F, 0x56, 0x69, 0x65, 0x6E,
+	0x6E, 0x61, 0x6A, 0x00, 0x72, 0x04, 0x08, 0x88, 0xE0, 0x69, 0x7A, 0x04, 0x08, 0x89, 0xE0, 0x69,
+	0x16, 0x01, 0x46, 0x90, 0x12, 0x10, 0x08, 0xA8, 0x1F, 0x12, 0x03, 0x03, 0x02, 0x0A, 0x18, 0xA2,
+	0x01, 0x2A, 0x03, 0x91, 0xE0, 0x69, 0x0A, 0x05, 0x08, 0x9A, 0x05, 0x10, 0x00, 0x10, 0x01, 0x18,
+	0xC8, 0x01, 0x22, 0x0C, 0x0A, 0x0A, 0x08, 0x00, 0x10, 0x01, 0x72, 0x20, 0x00, 0x10, 0x00, 0x2A,
+	0x00, 0x32, 0x0C, 0x0A, 0x00, 0x2D, 0x15, 0x14, 0x00, 0x3A, 0x00, 0x3A, 0x2C, 0x12, 0x52, 0x86,
+	0x01, 0x00, 0x1A, 0x52, 0x16, 0x00, 0x00, 0x42, 0xB2, 0x2E, 0x00, 0x70, 0x4A, 0x02, 0x0A, 0x00,
+	0x52, 0x00, 0x62, 0x05, 0x08, 0xD2, 0x03, 0x10, 0x00, 0x6A, 0x06, 0x0A, 0x04, 0x08, 0x91, 0xE0,
+	0x69, 0x72, 0x00, 0x7A, 0x00, 0x82, 0x01, 0x00, 0x10, 0x01, 0x0C, 0x0C, 0x12, 0x0A, 0x08, 0xA9,
+	0x4D, 0x69, 0x1C, 0x12, 0x08, 0x01, 0x10, 0x00, 0x18, 0x00, 0x22, 0x1D, 0xAB, 0x00, 0x11, 0x21,
+	0x1C, 0x04, 0x12, 0x0B, 0x15, 0xDC, 0x10, 0x97, 0x01, 0x0A, 0x14, 0x08, 0x21, 0xE6, 0x14, 0xC5,
+	0xD6, 0xF2, 0xA6, 0x54, 0x10, 0x21, 0xE4, 0x24, 0xEC, 0xE2, 0xAD, 0xEF, 0x54, 0x10, 0x02, 0x18,
+	0x07, 0x22, 0xFE, 0xD9, 0x00, 0xCA, 0xD9, 0x00, 0x04, 0x6A, 0x00, 0x0D, 0xCC, 0x00, 0x15, 0x21,
+	0xBF, 0x0C, 0x12, 0x0F, 0x08, 0xA3, 0x0D, 0xCC, 0x30, 0x06, 0x2A, 0x03, 0xB4, 0xE0, 0x69, 0x0A,
+	0x04, 0x08, 0xB4, 0xE0, 0x69, 0x10, 0x01, 0x05, 0x0C, 0x12, 0x0A, 0x08, 0xA4, 0x0D, 0x1C, 0x74,
+	0x19, 0x0A, 0x17, 0x10, 0xE7, 0xB7, 0xD9, 0x3A, 0x18, 0xCA, 0xE7, 0xA5, 0xB2, 0x03, 0x20, 0xAB,
+	0xC9, 0xE7, 0xC9, 0x01, 0x28, 0xAC, 0xED, 0xA7, 0xCB, 0x0D, 0x10, 0x08, 0x88, 0xE0, 0x01, 0x2A,
+	0x04, 0xDE, 0x31, 0x69, 0x7B, 0x00, 0x0D, 0x2D, 0xC5, 0x04, 0x12, 0x04, 0x21, 0xB8, 0x40, 0x10,
+	0x08, 0x89, 0xE0, 0x69, 0x12, 0x0A, 0x08, 0xAB, 0x1F, 0x12, 0x03, 0x01, 0x00, 0x05, 0x18, 0x00,
+	0x00, 0x13, 0x00, 0x00, 0x11, 0x40, 0x10, 0x08, 0x81, 0xE0, 0x69, 0x12, 0x0A, 0x08, 0xD5, 0x01,
+	0x12, 0x03, 0x01, 0x00, 0x05, 0x18, 0x00, 0x00, 0xE4, 0x35, 0x00, 0x80, 0x80, 0x04, 0xE8, 0x8F,
+	0x0C, 0x08, 0x85, 0xE0, 0x69, 0x12, 0x88, 0x0C, 0x08, 0x91, 0x03, 0x12, 0x03, 0x01, 0x00, 0x05,
+	0x18, 0xFC, 0x99, 0x01, 0x22, 0x35, 0x0A, 0x03, 0x0A, 0x01, 0x07, 0x10, 0x03, 0x18, 0x01, 0x22,
+	0x2A, 0xA9, 0xDC, 0x69, 0xAA, 0xDC, 0x69, 0xAB, 0xDC, 0x69, 0xAC, 0xDC, 0x69, 0xAD, 0xDC, 0x69,
+	0xAE, 0xDC, 0x69, 0x94, 0xE0, 0x69, 0x94, 0xE0, 0x69, 0xA9, 0x42, 0x18, 0x00, 0x04, 0x22, 0x17,
+	0x01, 0x37, 0x00, 0x08, 0x05, 0x37, 0x10, 0x0C, 0xA5, 0xDC, 0x69, 0xA6, 0x05, 0x03, 0xF4, 0x6D,
+	0x06, 0xA5, 0xDC, 0x69, 0x2A, 0xA9, 0x0B, 0xA8, 0xDC, 0x69, 0xA7, 0xDC, 0x69, 0xD4, 0xD7, 0x69,
+	0xD3, 0xD7, 0x69, 0xA1, 0xDA, 0x69, 0x9D, 0xDA, 0x69, 0x9E, 0xDA, 0x69, 0xA9, 0xDA, 0x69, 0xAA,
+	0xDA, 0x69, 0xB3, 0xDA, 0x69, 0xB4, 0xDA, 0x69, 0xB5, 0xDA, 0x69, 0xB6, 0xDA, 0x69, 0xB7, 0xDA,
+	0x69, 0xB8, 0xDA, 0x69, 0xB9, 0xDA, 0x69, 0xBA, 0xDA, 0x69, 0xBB, 0xDA, 0x69, 0xBC, 0xDA, 0x69,
+	0xAB, 0xDA, 0x69, 0xBD, 0xDA, 0x69, 0xBE, 0xDA, 0x69, 0xBF, 0xDA, 0x69, 0xC0, 0xDA, 0x69, 0xC1,
+	0xDA, 0x69, 0xC2, 0xDA, 0x69, 0xC3, 0xDA, 0x69, 0xC4, 0xDA, 0x69, 0xC5, 0xDA, 0x69, 0xC6, 0xDA,
+	0x69, 0xAC, 0xDA, 0x69, 0xAD, 0xDA, 0x69, 0xAE, 0xDA, 0x69, 0xAF, 0xDA, 0x69, 0xB0, 0xDA, 0x69,
+	0xB1, 0xDA, 0x69, 0xB2, 0xDA, 0x69, 0xC7, 0xDA, 0x69, 0xA2, 0xDA, 0x69, 0xA3, 0xDA, 0x69, 0xA4,
+	0xDA, 0x69, 0xA5, 0xDA, 0x69, 0xA6, 0xDA, 0x69, 0xA7, 0xDA, 0x69, 0x9F, 0xDA, 0x69, 0xA0, 0xDA,
+	0x69, 0xCD, 0xDA, 0x69, 0xC9, 0xDA, 0x69, 0xCA, 0xDA, 0x69, 0xD5, 0xDA, 0x69, 0xD6, 0xDA, 0x69,
+	0xDF, 0xDA, 0x69, 0xE0, 0xDA, 0x69, 0xE1, 0xDA, 0x69, 0xE2, 0xDA, 0x69, 0xE3, 0xDA, 0x69, 0xE4,
+	0xDA, 0x69, 0xE5, 0xDA, 0x69, 0xE6, 0xDA, 0x69, 0xE7, 0xDA, 0x69, 0xE8, 0xDA, 0x69, 0xD7, 0xDA,
+	0x69, 0xE9, 0xDA, 0x69, 0xEA, 0xDA, 0x69, 0xEB, 0xDA, 0x69, 0xEC, 0xDA, 0x69, 0xED, 0xDA, 0x69,
+	0xEE, 0xDA, 0x69, 0xEF, 0xDA, 0x69, 0xF0, 0xDA, 0x69, 0xF1, 0xDA, 0x69, 0xF2, 0xDA, 0x69, 0xD8,
+	0xDA, 0x69, 0xD9, 0xDA, 0x69, 0xDA, 0xDA, 0x69, 0xDB, 0xDA, 0x69, 0xDC, 0xDA, 0x69, 0xDD, 0xDA,
+	0x69, 0xDE, 0xDA, 0x69, 0xF3, 0xDA, 0x69, 0xCE, 0xDA, 0x69, 0xCF, 0xDA, 0x69, 0xD0, 0xDA, 0x69,
+	0xD1, 0xDA, 0x69, 0xD2, 0xDA, 0x69, 0xD3, 0xDA, 0x69, 0xCB, 0xDA, 0x69, 0xCC, 0xDA, 0x69, 0xF9,
+	0xDA, 0x69, 0xF5, 0xDA, 0x69, 0xF6, 0xDA, 0x69, 0x81, 0xDB, 0x69, 0x82, 0xDB, 0x69, 0x8B, 0xDB,
+	0x69, 0x8C, 0xDB, 0x69, 0x8D, 0xDB, 0x69, 0x8E, 0xDB, 0x69, 0x8F, 0xDB, 0x69, 0x90, 0xDB, 0x69,
+	0x91, 0xDB, 0x69, 0x92, 0xDB, 0x69, 0x93, 0xDB, 0x69, 0x94, 0xDB, 0x69, 0x83, 0xDB, 0x69, 0x95,
+	0xDB, 0x69, 0x96, 0xDB, 0x69, 0x97, 0xDB, 0x69, 0x98, 0xDB, 0x69, 0x99, 0xDB, 0x69, 0x9A, 0xDB,
+	0x69, 0x9B, 0xDB, 0x69, 0x9C, 0xDB, 0x69, 0x9D, 0xDB, 0x69, 0x9E, 0xDB, 0x69, 0x84, 0xDB, 0x69,
+	0x85, 0xDB, 0x69, 0x86, 0xDB, 0x69, 0x87, 0xDB, 0x69, 0x88, 0xDB, 0x69, 0x89, 0xDB, 0x69, 0x8A,
+	0xDB, 0x69, 0x9F, 0xDB, 0x69, 0xFA, 0xDA, 0x69, 0xFB, 0xDA, 0x69, 0xFC, 0xDA, 0x69, 0xFD, 0xDA,
+	0x69, 0xFE, 0xDA, 0x69, 0xFF, 0xDA, 0x69, 0xF7, 0xDA, 0x69, 0xF8, 0xDA, 0x69, 0xA5, 0xDB, 0x69,
+	0xA1, 0xDB, 0x69, 0xA2, 0xDB, 0x69, 0xAD, 0xDB, 0x69, 0xAE, 0xDB, 0x69, 0xB7, 0xDB, 0x69, 0xB8,
+	0xDB, 0x69, 0xB9, 0xDB, 0x69, 0xBA, 0xDB, 0x69, 0xBB, 0xDB, 0x69, 0xBC, 0xDB, 0x69, 0xBD, 0xDB,
+	0x69, 0xBE, 0xDB, 0x69, 0xBF, 0xDB, 0x69, 0xC0, 0xDB, 0x69, 0xAF, 0xDB, 0x69, 0xC1, 0xDB, 0x69,
+	0xC2, 0xDB, 0x69, 0xC3, 0xDB, 0x69, 0xC4, 0xDB, 0x69, 0xC5, 0xDB, 0x69, 0xC6, 0xDB, 0x69, 0xC7,
+	0xDB, 0x69, 0xC8, 0xDB, 0x69, 0xC9, 0xDB, 0x69, 0xCA, 0xDB, 0x69, 0xB0, 0xDB, 0x69, 0xB1, 0xDB,
+	0x69, 0xB2, 0xDB, 0x69, 0xB3, 0xDB, 0x69, 0xB4, 0xDB, 0x69, 0xB5, 0xDB, 0x69, 0xB6, 0xDB, 0x69,
+	0xCB, 0xDB, 0x69, 0xA6, 0xDB, 0x69, 0xA7, 0xDB, 0x69, 0xA8, 0xDB, 0x69, 0xA9, 0xDB, 0x69, 0xAA,
+	0xDB, 0x69, 0xAB, 0xDB, 0x69, 0xA3, 0xDB, 0x69, 0xA4, 0xDB, 0x69, 0xD1, 0xDB, 0x69, 0xCD, 0xDB,
+	0x69, 0xCE, 0xDB, 0x69, 0xD9, 0xDB, 0x69, 0xDA, 0xDB, 0x69, 0xE3, 0xDB, 0x69, 0xE4, 0xDB, 0x69,
+	0xE5, 0xDB, 0x69, 0xE6, 0xDB, 0x69, 0xE7, 0xDB, 0x69, 0xE8, 0xDB, 0x69, 0xE9, 0xDB, 0x69, 0xEA,
+	0xDB, 0x69, 0xEB, 0xDB, 0x69, 0xEC, 0xDB, 0x69, 0xDB, 0xDB, 0x69, 0xED, 0xDB, 0x69, 0xEE, 0xDB,
+	0x69, 0xEF, 0xDB, 0x69, 0xF0, 0xDB, 0x69, 0xF1, 0xDB, 0x69, 0xF2, 0xDB, 0x69, 0xF3, 0xDB, 0x69,
+	0xF4, 0xDB, 0x69, 0xF5, 0xDB, 0x69, 0xF6, 0xDB, 0x69, 0xDC, 0xDB, 0x69, 0xDD, 0xDB, 0x69, 0xDE,
+	0xDB, 0x69, 0xDF, 0xDB, 0x69, 0xE0, 0xDB, 0x69, 0xE1, 0xDB, 0x69, 0xE2, 0xDB, 0x69, 0xF7, 0xDB,
+	0x69, 0xD2, 0xDB, 0x69, 0xD3, 0xDB, 0x69, 0xD4, 0xDB, 0x69, 0xD5, 0xDB, 0x69, 0xD6, 0xDB, 0x69,
+	0xD7, 0xDB, 0x69, 0xCF, 0xDB, 0x69, 0xD0, 0xDB, 0x69, 0xFD, 0xDB, 0x69, 0xF9, 0xDB, 0x69, 0xFA,
+	0xDB, 0x69, 0x85, 0xDC, 0x69, 0x86, 0xDC, 0x69, 0x8F, 0xDC, 0x69, 0x90, 0xDC, 0x69, 0x91, 0xDC,
+	0x69, 0x92, 0xDC, 0x69, 0x93, 0xDC, 0x69, 0x94, 0xDC, 0x69, 0x95, 0xDC, 0x69, 0x96, 0xDC, 0x69,
+	0x97, 0xDC, 0x69, 0x98, 0xDC, 0x69, 0x87, 0xDC, 0x69, 0x99, 0xDC, 0x69, 0x9A, 0xDC, 0x69, 0x9B,
+	0xDC, 0x69, 0x9C, 0xDC, 0x69, 0x9D, 0xDC, 0x69, 0x9E, 0xDC, 0x69, 0x9F, 0xDC, 0x69, 0xA0, 0xDC,
+	0x69, 0xA1, 0xDC, 0x69, 0xA2, 0xDC, 0x69, 0x88, 0xDC, 0x69, 0x89, 0xDC, 0x69, 0x8A, 0xDC, 0x69,
+	0x8B, 0xDC, 0x69, 0x8C, 0xDC, 0x69, 0x8D, 0xDC, 0x69, 0x8E, 0xDC, 0x69, 0xA3, 0xDC, 0x69, 0xFE,
+	0xDB, 0x69, 0xFF, 0xDB, 0x69, 0x80, 0xDC, 0x69, 0x81, 0xDC, 0x69, 0x82, 0xDC, 0x69, 0x83, 0xDC,
+	0x69, 0xFB, 0xDB, 0x69, 0xFC, 0xDB, 0x69, 0xB9, 0xDC, 0x69, 0xF4, 0xD7, 0x69, 0x93, 0xE0, 0x69,
+	0xE8, 0xD7, 0x69, 0xE9, 0xD7, 0x69, 0xEA, 0xD7, 0x69, 0xEB, 0xD7, 0x69, 0xEC, 0xD7, 0x69, 0xED,
+	0xD7, 0x69, 0xDB, 0xD7, 0x69, 0xDC, 0xD7, 0x69, 0xDD, 0xD7, 0x69, 0xDE, 0xD7, 0x69, 0xDF, 0xD7,
+	0x69, 0xE0, 0xD7, 0x69, 0xEE, 0xD7, 0x69, 0xEF, 0xD7, 0x69, 0xF0, 0xD7, 0x69, 0xF1, 0xD7, 0x69,
+	0xF2, 0xD7, 0x69, 0xF3, 0xD7, 0x69, 0xA2, 0xD7, 0x69, 0xE1, 0xD7, 0x69, 0xE2, 0xD7, 0x69, 0xE3,
+	0xD7, 0x69, 0xE4, 0xD7, 0x69, 0xE5, 0xD7, 0x69, 0xE6, 0xD7, 0x69, 0xF5, 0xD7, 0x69, 0x96, 0xE0,
+	0x69, 0x97, 0xE0, 0x69, 0x98, 0xE0, 0x69, 0x99, 0xE0, 0x69, 0x9A, 0xE0, 0x69, 0x9B, 0xE0, 0x69,
+	0x9C, 0xE0, 0x69, 0x9D, 0xE0, 0x69, 0xF6, 0xD7, 0x69, 0x95, 0xE0, 0x69, 0x87, 0xD9, 0x69, 0xA0,
+	0xD9, 0x69, 0xB9, 0xD9, 0x69, 0xD2, 0xD9, 0x69, 0xEB, 0xD9, 0x69, 0x84, 0xDA, 0x69, 0x88, 0xD9,
+	0x69, 0x8C, 0xD9, 0x69, 0x8D, 0xD9, 0x69, 0x8E, 0xD9, 0x69, 0x8F, 0xD9, 0x69, 0x90, 0xD9, 0x69,
+	0x8B, 0xD9, 0x69, 0x8A, 0xD9, 0x69, 0x89, 0xD9, 0x69, 0x91, 0xD9, 0x69, 0x92, 0xD9, 0x69, 0x93,
+	0xD9, 0x69, 0x94, 0xD9, 0x69, 0x95, 0xD9, 0x69, 0x9D, 0xD9, 0x69, 0x9C, 0xD9, 0x69, 0x9E, 0xD9,
+	0x69, 0xA1, 0xD9, 0x69, 0xA5, 0xD9, 0x69, 0xA6, 0xD9, 0x69, 0xA7, 0xD9, 0x69, 0xA8, 0xD9, 0x69,
+	0xA9, 0xD9, 0x69, 0xA4, 0xD9, 0x69, 0xA3, 0xD9, 0x69, 0xA2, 0xD9, 0x69, 0xAA, 0xD9, 0x69, 0xAB,
+	0xD9, 0x69, 0xAC, 0xD9, 0x69, 0xAD, 0xD9, 0x69, 0xAE, 0xD9, 0x69, 0xB6, 0xD9, 0x69, 0xB5, 0xD9,
+	0x69, 0xB7, 0xD9, 0x69, 0xBA, 0xD9, 0x69, 0xBE, 0xD9, 0x69, 0xBF, 0xD9, 0x69, 0xC0, 0xD9, 0x69,
+	0xC1, 0xD9, 0x69, 0xC2, 0xD9, 0x69, 0xBD, 0xD9, 0x69, 0xBC, 0xD9, 0x69, 0xBB, 0xD9, 0x69, 0xC3,
+	0xD9, 0x69, 0xC4, 0xD9, 0x69, 0xC5, 0xD9, 0x69, 0xC6, 0xD9, 0x69, 0xC7, 0xD9, 0x69, 0xCF, 0xD9,
+	0x69, 0xCE, 0xD9, 0x69, 0xD0, 0xD9, 0x69, 0xD3, 0xD9, 0x69, 0xD7, 0xD9, 0x69, 0xD8, 0xD9, 0x69,
+	0xD9, 0xD9, 0x69, 0xDA, 0xD9, 0x69, 0xDB, 0xD9, 0x69, 0xD6, 0xD9, 0x69, 0xD5, 0xD9, 0x69, 0xD4,
+	0xD9, 0x69, 0xDC, 0xD9, 0x69, 0xDD, 0xD9, 0x69, 0xDE, 0xD9, 0x69, 0xDF, 0xD9, 0x69, 0xE0, 0xD9,
+	0x69, 0xE8, 0xD9, 0x69, 0xE7, 0xD9, 0x69, 0xE9, 0xD9, 0x69, 0xEC, 0xD9, 0x69, 0xF0, 0xD9, 0x69,
+	0xF1, 0xD9, 0x69, 0xF2, 0xD9, 0x69, 0xF3, 0xD9, 0x69, 0xF4, 0xD9, 0x69, 0xEF, 0xD9, 0x69, 0xEE,
+	0xD9, 0x69, 0xED, 0xD9, 0x69, 0xF5, 0xD9, 0x69, 0xF6, 0xD9, 0x69, 0xF7, 0xD9, 0x69, 0xF8, 0xD9,
+	0x69, 0xF9, 0xD9, 0x69, 0x81, 0xDA, 0x69, 0x80, 0xDA, 0x69, 0x82, 0xDA, 0x69, 0x85, 0xDA, 0x69,
+	0x89, 0xDA, 0x69, 0x8A, 0xDA, 0x69, 0x8B, 0xDA, 0x69, 0x8C, 0xDA, 0x69, 0x8D, 0xDA, 0x69, 0x88,
+	0xDA, 0x69, 0x87, 0xDA, 0x69, 0x86, 0xDA, 0x69, 0x8E, 0xDA, 0x69, 0x8F, 0xDA, 0x69, 0x90, 0xDA,
+	0x69, 0x91, 0xDA, 0x69, 0x92, 0xDA, 0x69, 0x9A, 0xDA, 0x69, 0x99, 0xDA, 0x69, 0x9B, 0xDA, 0x69,
+	0x96, 0xD9, 0x69, 0x97, 0xD9, 0x69, 0x98, 0xD9, 0x69, 0x99, 0xD9, 0x69, 0x9A, 0xD9, 0x69, 0xAF,
+	0xD9, 0x69, 0xB0, 0xD9, 0x69, 0xB1, 0xD9, 0x69, 0xB2, 0xD9, 0x69, 0xB3, 0xD9, 0x69, 0xC8, 0xD9,
+	0x69, 0xC9, 0xD9, 0x69, 0xCA, 0xD9, 0x69, 0xCB, 0xD9, 0x69, 0xCC, 0xD9, 0x69, 0xE1, 0xD9, 0x69,
+	0xE2, 0xD9, 0x69, 0xE3, 0xD9, 0x69, 0xE4, 0xD9, 0x69, 0xE5, 0xD9, 0x69, 0xFA, 0xD9, 0x69, 0xFB,
+	0xD9, 0x69, 0xFC, 0xD9, 0x69, 0xFD, 0xD9, 0x69, 0xFE, 0xD9, 0x69, 0x93, 0xDA, 0x69, 0x94, 0xDA,
+	0x69, 0x95, 0xDA, 0x69, 0x96, 0xDA, 0x69, 0x97, 0xDA, 0x69, 0x9B, 0xD9, 0x69, 0xB4, 0xD9, 0x69,
+	0xCD, 0xD9, 0x69, 0xE6, 0xD9, 0x69, 0xFF, 0xD9, 0x69, 0x98, 0xDA, 0x69, 0x99, 0xD7, 0x69, 0xA3,
+	0xD7, 0x69, 0x9A, 0xD7, 0x69, 0xB0, 0xDC, 0x69, 0xAE, 0xD7, 0x69, 0xAF, 0xD7, 0x69, 0xB0, 0xD7,
+	0x69, 0xB1, 0xD7, 0x69, 0x9B, 0xD7, 0x69, 0xB1, 0xDC, 0x69, 0xB7, 0xD7, 0x69, 0xBD, 0xD7, 0x69,
+	0xC0, 0xD7, 0x69, 0x9C, 0xD7, 0x69, 0xB2, 0xDC, 0x69, 0xC2, 0xD7, 0x69, 0xC3, 0xD7, 0x69, 0xC4,
+	0xD7, 0x69, 0xC5, 0xD7, 0x69, 0xC6, 0xD7, 0x69, 0xC7, 0xD7, 0x69, 0xC8, 0xD7, 0x69, 0xC9, 0xD7,
+	0x69, 0xCA, 0xD7, 0x69, 0x9D, 0xD7, 0x69, 0xB3, 0xDC, 0x69, 0xCB, 0xD7, 0x69, 0xCC, 0xD7, 0x69,
+	0x9E, 0xD7, 0x69, 0x9F, 0xD7, 0x69, 0xA9, 0xD7, 0x69, 0xA0, 0xD7, 0x69, 0xA1, 0xD7, 0x69, 0xE7,
+	0xD7, 0x69, 0xAF, 0xDC, 0x69, 0xA6, 0xDC, 0x69, 0xA5, 0xDC, 0x69, 0x94, 0xE0, 0x69, 0xA9, 0xDC,
+	0x69, 0xAA, 0xDC, 0x69, 0xAB, 0xDC, 0x69, 0xAC, 0xDC, 0x69, 0xAD, 0xDC, 0x69, 0xAE, 0xDC, 0x69,
+	0x0A, 0x04, 0x08, 0x99, 0xD7, 0x69, 0x0A, 0x04, 0x08, 0x9A, 0xD7, 0x69, 0x0A, 0x04, 0x08, 0x9B,
+	0xD7, 0x69, 0x0A, 0x04, 0x08, 0x9C, 0xD7, 0x69, 0x0A, 0x04, 0x08, 0x9D, 0xD7, 0x69, 0x0A, 0x04,
+	0x08, 0x9E, 0xD7, 0x69, 0x0A, 0x04, 0x08, 0x9F, 0xD7, 0x69, 0x0A, 0x04, 0x08, 0xA0, 0xD7, 0x69,
+	0x0A, 0x04, 0x08, 0xA1, 0xD7, 0x69, 0x0A, 0x04, 0x08, 0xA2, 0xD7, 0x69, 0x0A, 0x04, 0x08, 0xA3,
+	0xD7, 0x69, 0x0A, 0x04, 0x08, 0xA9, 0xD7, 0x69, 0x0A, 0x04, 0x08, 0xAE, 0xD7, 0x69, 0x0A, 0x04,
+	0x08, 0xAF, 0xD7, 0x69, 0x0A, 0x04, 0x08, 0xB0, 0xD7, 0x69, 0x0A, 0x04, 0x08, 0xB1, 0xD7, 0x69,
+	0x0A, 0x04, 0x08, 0xB7, 0xD7, 0x69, 0x0A, 0x04, 0x08, 0xBD, 0xD7, 0x69, 0x0A, 0x04, 0x08, 0xC0,
+	0xD7, 0x69, 0x0A, 0x04, 0x08, 0xC2, 0xD7, 0x69, 0x0A, 0x04, 0x08, 0xC3, 0xD7, 0x69, 0x0A, 0x04,
+	0x08, 0xC4, 0xD7, 0x69, 0x0A, 0x04, 0x08, 0xC5, 0xD7, 0x69, 0x0A, 0x04, 0x08, 0xC6, 0xD7, 0x69,
+	0x0A, 0x04, 0x08, 0xC7, 0xD7, 0x69, 0x0A, 0x04, 0x08, 0xC8, 0xD7, 0x69, 0x0A, 0x04, 0x08, 0xC9,
+	0xD7, 0x69, 0x0A, 0x04, 0x08, 0xCA, 0xD7, 0x69, 0x0A, 0x04, 0x08, 0xCB, 0xD7, 0x69, 0x0A, 0x04,
+	0x08, 0xCC, 0xD7, 0x69, 0x0A, 0x04, 0x08, 0xD3, 0xD7, 0x69, 0x0A, 0x04, 0x08, 0xD4, 0xD7, 0x01,
+	0xC0, 0x04, 0xD5, 0xD7, 0x01, 0x06, 0x00, 0xD6, 0x05, 0x06, 0x00, 0xD7, 0x05, 0x06, 0x00, 0xD8,
+	0x05, 0x06, 0x00, 0xD9, 0x05, 0x06, 0x00, 0xDA, 0x05, 0x06, 0x00, 0xDB, 0x05, 0x06, 0x00, 0xDC,
+	0x05, 0x06, 0x00, 0xDD, 0x05, 0x06, 0x00, 0xDE, 0x05, 0x06, 0x00, 0xDF, 0x05, 0x06, 0x00, 0xE0,
+	0x05, 0x06, 0x00, 0xE1, 0x05, 0x06, 0x00, 0xE2, 0x05, 0x06, 0x00, 0xE3, 0x05, 0x06, 0x00, 0xE4,
+	0x05, 0x06, 0x00, 0xE5, 0x05, 0x06, 0x00, 0xE6, 0x05, 0x06, 0x00, 0xE7, 0x05, 0x06, 0x00, 0xE8,
+	0x05, 0x06, 0x00, 0xE9, 0x05, 0x06, 0x00, 0xEA, 0x05, 0x06, 0x00, 0xEB, 0x05, 0x06, 0x00, 0xEC,
+	0x05, 0x06, 0x00, 0xED, 0x05, 0x06, 0x00, 0xEE, 0x05, 0x06, 0x00, 0xEF, 0x05, 0x06, 0x00, 0xF0,
+	0x05, 0x06, 0x00, 0xF1, 0x05, 0x06, 0x00, 0xF2, 0x05, 0x06, 0x00, 0xF3, 0x05, 0x06, 0x00, 0xF4,
+	0x05, 0x06, 0x00, 0xF5, 0x05, 0x06, 0x00, 0xF6, 0x05, 0x06, 0x04, 0x87, 0xD9, 0x01, 0xCC, 0x00,
+	0x88, 0x05, 0x06, 0x00, 0x89, 0x05, 0x06, 0x00, 0x8A, 0x05, 0x06, 0x00, 0x8B, 0x05, 0x06, 0x00,
+	0x8C, 0x05, 0x06, 0x00, 0x8D, 0x05, 0x06, 0x00, 0x8E, 0x05, 0x06, 0x00, 0x8F, 0x05, 0x06, 0x00,
+	0x90, 0x05, 0x06, 0x00, 0x91, 0x05, 0x06, 0x00, 0x92, 0x05, 0x06, 0x00, 0x93, 0x05, 0x06, 0x00,
+	0x94, 0x05, 0x06, 0x00, 0x95, 0x05, 0x06, 0x00, 0x96, 0x05, 0x06, 0x00, 0x97, 0x05, 0x06, 0x00,
+	0x98, 0x05, 0x06, 0x00, 0x99, 0x05, 0x06, 0x00, 0x9A, 0x05, 0x06, 0x00, 0x9B, 0x05, 0x06, 0x00,
+	0x9C, 0x05, 0x06, 0x00, 0x9D, 0x05, 0x06, 0x00, 0x9E, 0x05, 0x06, 0x00, 0xA0, 0x05, 0x06, 0x00,
+	0xA1, 0x05, 0x06, 0x00, 0xA2, 0x05, 0x06, 0x00, 0xA3, 0x05, 0x06, 0x00, 0xA4, 0x05, 0x06, 0x00,
+	0xA5, 0x05, 0x06, 0x00, 0xA6, 0x05, 0x06, 0x00, 0xA7, 0x05, 0x06, 0x00, 0xA8, 0x05, 0x06, 0x00,
+	0xA9, 0x05, 0x06, 0x00, 0xAA, 0x05, 0x06, 0x00, 0xAB, 0x05, 0x06, 0x00, 0xAC, 0x05, 0x06, 0x00,
+	0xAD, 0x05, 0x06, 0x00, 0xAE, 0x05, 0x06, 0x00, 0xAF, 0x05, 0x06, 0x00, 0xB0, 0x05, 0x06, 0x00,
+	0xB1, 0x05, 0x06, 0x00, 0xB2, 0x05, 0x06, 0x00, 0xB3, 0x05, 0x06, 0x00, 0xB4, 0x05, 0x06, 0x00,
+	0xB5, 0x05, 0x06, 0x00, 0xB6, 0x05, 0x06, 0x00, 0xB7, 0x05, 0x06, 0x00, 0xB9, 0x05, 0x06, 0x00,
+	0xBA, 0x05, 0x06, 0x00, 0xBB, 0x05, 0x06, 0x00, 0xBC, 0x05, 0x06, 0x00, 0xBD, 0x05, 0x06, 0x00,
+	0xBE, 0x05, 0x06, 0x00, 0xBF, 0x05, 0x06, 0x00, 0xC0, 0x05, 0x06, 0x00, 0xC1, 0x05, 0x06, 0x00,
+	0xC2, 0x05, 0x06, 0x00, 0xC3, 0x05, 0x06, 0x00, 0xC4, 0x05, 0x06, 0x00, 0xC5, 0x05, 0x06, 0x00,
+	0xC6, 0x05, 0x06, 0x00, 0xC7, 0x05, 0x06, 0x00, 0xC8, 0x05, 0x06, 0x00, 0xC9, 0x05, 0x06, 0x00,
+	0xCA, 0x05, 0x06, 0x00, 0xCB, 0x05, 0x06, 0x00, 0xCC, 0x05, 0x06, 0x00, 0xCD, 0x05, 0x06, 0x00,
+	0xCE, 0x05, 0x06, 0x00, 0xCF, 0x05, 0x06, 0x00, 0xD0, 0x05, 0x06, 0x00, 0xD2, 0x05, 0x06, 0x00,
+	0xD3, 0x05, 0x06, 0x00, 0xD4, 0x05, 0x06, 0x00, 0xD5, 0x05, 0x06, 0x00, 0xD6, 0x05, 0x06, 0x00,
+	0xD7, 0x05, 0x06, 0x00, 0xD8, 0x05, 0x06, 0x00, 0xD9, 0x05, 0x06, 0x00, 0xDA, 0x05, 0x06, 0x00,
+	0xDB, 0x05, 0x06, 0x00, 0xDC, 0x05, 0x06, 0x00, 0xDD, 0x05, 0x06, 0x00, 0xDE, 0x05, 0x06, 0x00,
+	0xDF, 0x05, 0x06, 0x00, 0xE0, 0x05, 0x06, 0x00, 0xE1, 0x05, 0x06, 0x00, 0xE2, 0x05, 0x06, 0x00,
+	0xE3, 0x05, 0x06, 0x00, 0xE4, 0x05, 0x06, 0x00, 0xE5, 0x05, 0x06, 0x00, 0xE6, 0x05, 0x06, 0x00,
+	0xE7, 0x05, 0x06, 0x00, 0xE8, 0x05, 0x06, 0x00, 0xE9, 0x05, 0x06, 0x00, 0xEB, 0x05, 0x06, 0x00,
+	0xEC, 0x05, 0x06, 0x00, 0xED, 0x05, 0x06, 0x00, 0xEE, 0x05, 0x06, 0x00, 0xEF, 0x05, 0x06, 0x00,
+	0xF0, 0x05, 0x06, 0x00, 0xF1, 0x05, 0x06, 0x00, 0xF2, 0x05, 0x06, 0x00, 0xF3, 0x05, 0x06, 0x00,
+	0xF4, 0x05, 0x06, 0x00, 0xF5, 0x05, 0x06, 0x00, 0xF6, 0x05, 0x06, 0x00, 0xF7, 0x05, 0x06, 0x00,
+	0xF8, 0x05, 0x06, 0x00, 0xF9, 0x05, 0x06, 0x00, 0xFA, 0x05, 0x06, 0x00, 0xFB, 0x05, 0x06, 0x00,
+	0xFC, 0x05, 0x06, 0x00, 0xFD, 0x05, 0x06, 0x00, 0xFE, 0x05, 0x06, 0x00, 0xFF, 0x05, 0x06, 0x04,
+	0x80, 0xDA, 0x41, 0xBE, 0x00, 0x81, 0x05, 0x06, 0x00, 0x82, 0x05, 0x06, 0x00, 0x84, 0x05, 0x06,
+	0x00, 0x85, 0x05, 0x06, 0x00, 0x86, 0x05, 0x06, 0x00, 0x87, 0x05, 0x06, 0x00, 0x88, 0x05, 0x06,
+	0x00, 0x89, 0x05, 0x06, 0x00, 0x8A, 0x05, 0x06, 0x00, 0x8B, 0x05, 0x06, 0x00, 0x8C, 0x05, 0x06,
+	0x00, 0x8D, 0x05, 0x06, 0x00, 0x8E, 0x05, 0x06, 0x00, 0x8F, 0x05, 0x06, 0x00, 0x90, 0x05, 0x06,
+	0x00, 0x91, 0x05, 0x06, 0x00, 0x92, 0x05, 0x06, 0x00, 0x93, 0x05, 0x06, 0x00, 0x94, 0x05, 0x06,
+	0x00, 0x95, 0x05, 0x06, 0x00, 0x96, 0x05, 0x06, 0x00, 0x97, 0x05, 0x06, 0x00, 0x98, 0x05, 0x06,
+	0x00, 0x99, 0x05, 0x06, 0x00, 0x9A, 0x05, 0x06, 0x00, 0x9B, 0x05, 0x06, 0x00, 0x9D, 0x05, 0x06,
+	0x00, 0x9E, 0x05, 0x06, 0x00, 0x9F, 0x05, 0x06, 0x00, 0xA0, 0x05, 0x06, 0x00, 0xA1, 0x05, 0x06,
+	0x00, 0xA2, 0x05, 0x06, 0x00, 0xA3, 0x05, 0x06, 0x00, 0xA4, 0x05, 0x06, 0x00, 0xA5, 0x05, 0x06,
+	0x00, 0xA6, 0x05, 0x06, 0x00, 0xA7, 0x05, 0x06, 0x00, 0xA9, 0x05, 0x06, 0x00, 0xAA, 0x05, 0x06,
+	0x00, 0xAB, 0x05, 0x06, 0x00, 0xAC, 0x05, 0x06, 0x00, 0xAD, 0x05, 0x06, 0x00, 0xAE, 0x05, 0x06,
+	0x00, 0xAF, 0x05, 0x06, 0x00, 0xB0, 0x05, 0x06, 0x00, 0xB1, 0x05, 0x06, 0x00, 0xB2, 0x05, 0x06,
+	0x00, 0xB3, 0x05, 0x06, 0x00, 0xB4, 0x05, 0x06, 0x00, 0xB5, 0x05, 0x06, 0x00, 0xB6, 0x05, 0x06,
+	0x00, 0xB7, 0x05, 0x06, 0x00, 0xB8, 0x05, 0x06, 0x00, 0xB9, 0x05, 0x06, 0x00, 0xBA, 0x05, 0x06,
+	0x00, 0xBB, 0x05, 0x06, 0x00, 0xBC, 0x05, 0x06, 0x00, 0xBD, 0x05, 0x06, 0x00, 0xBE, 0x05, 0x06,
+	0x00, 0xBF, 0x05, 0x06, 0x00, 0xC0, 0x05, 0x06, 0x00, 0xC1, 0x05, 0x06, 0x00, 0xC2, 0x05, 0x06,
+	0x00, 0xC3, 0x05, 0x06, 0x00, 0xC4, 0x05, 0x06, 0x00, 0xC5, 0x05, 0x06, 0x00, 0xC6, 0x05, 0x06,
+	0x00, 0xC7, 0x05, 0x06, 0x00, 0xC9, 0x05, 0x06, 0x00, 0xCA, 0x05, 0x06, 0x00, 0xCB, 0x05, 0x06,
+	0x00, 0xCC, 0x05, 0x06, 0x00, 0xCD, 0x05, 0x06, 0x00, 0xCE, 0x05, 0x06, 0x00, 0xCF, 0x05, 0x06,
+	0x00, 0xD0, 0x05, 0x06, 0x00, 0xD1, 0x05, 0x06, 0x00, 0xD2, 0x05, 0x06, 0x00, 0xD3, 0x05, 0x06,
+	0x00, 0xD5, 0x05, 0x06, 0x00, 0xD6, 0x05, 0x06, 0x00, 0xD7, 0x05, 0x06, 0x00, 0xD8, 0x05, 0x06,
+	0x00, 0xD9, 0x05, 0x06, 0x00, 0xDA, 0x05, 0x06, 0x00, 0xDB, 0x05, 0x06, 0x00, 0xDC, 0x05, 0x06,
+	0x00, 0xDD, 0x05, 0x06, 0x00, 0xDE, 0x05, 0x06, 0x00, 0xDF, 0x05, 0x06, 0x00, 0xE0, 0x05, 0x06,
+	0x00, 0xE1, 0x05, 0x06, 0x00, 0xE2, 0x05, 0x06, 0x00, 0xE3, 0x05, 0x06, 0x00, 0xE4, 0x05, 0x06,
+	0x00, 0xE5, 0x05, 0x06, 0x00, 0xE6, 0x05, 0x06, 0x00, 0xE7, 0x05, 0x06, 0x00, 0xE8, 0x05, 0x06,
+	0x00, 0xE9, 0x05, 0x06, 0x00, 0xEA, 0x05, 0x06, 0x00, 0xEB, 0x05, 0x06, 0x00, 0xEC, 0x05, 0x06,
+	0x00, 0xED, 0x05, 0x06, 0x00, 0xEE, 0x05, 0x06, 0x00, 0xEF, 0x05, 0x06, 0x00, 0xF0, 0x05, 0x06,
+	0x00, 0xF1, 0x05, 0x06, 0x00, 0xF2, 0x05, 0x06, 0x00, 0xF3, 0x05, 0x06, 0x00, 0xF5, 0x05, 0x06,
+	0x00, 0xF6, 0x05, 0x06, 0x00, 0xF7, 0x05, 0x06, 0x00, 0xF8, 0x05, 0x06, 0x00, 0xF9, 0x05, 0x06,
+	0x00, 0xFA, 0x05, 0x06, 0x00, 0xFB, 0x05, 0x06, 0x00, 0xFC, 0x05, 0x06, 0x00, 0xFD, 0x05, 0x06,
+	0x00, 0xFE, 0x05, 0x06, 0x00, 0xFF, 0x05, 0x06, 0x04, 0x81, 0xDB, 0x41, 0xDC, 0x00, 0x82, 0x05,
+	0x06, 0x00, 0x83, 0x05, 0x06, 0x00, 0x84, 0x05, 0x06, 0x00, 0x85, 0x05, 0x06, 0x00, 0x86, 0x05,
+	0x06, 0x00, 0x87, 0x05, 0x06, 0x00, 0x88, 0x05, 0x06, 0x00, 0x89, 0x05, 0x06, 0x00, 0x8A, 0x05,
+	0x06, 0x00, 0x8B, 0x05, 0x06, 0x00, 0x8C, 0x05, 0x06, 0x00, 0x8D, 0x05, 0x06, 0x00, 0x8E, 0x05,
+	0x06, 0x00, 0x8F, 0x05, 0x06, 0x00, 0x90, 0x05, 0x06, 0x00, 0x91, 0x05, 0x06, 0x00, 0x92, 0x05,
+	0x06, 0x00, 0x93, 0x05, 0x06, 0x00, 0x94, 0x05, 0x06, 0x00, 0x95, 0x05, 0x06, 0x00, 0x96, 0x05,
+	0x06, 0x00, 0x97, 0x05, 0x06, 0x00, 0x98, 0x05, 0x06, 0x00, 0x99, 0x05, 0x06, 0x00, 0x9A, 0x05,
+	0x06, 0x00, 0x9B, 0x05, 0x06, 0x00, 0x9C, 0x05, 0x06, 0x00, 0x9D, 0x05, 0x06, 0x00, 0x9E, 0x05,
+	0x06, 0x00, 0x9F, 0x05, 0x06, 0x00, 0xA1, 0x05, 0x06, 0x00, 0xA2, 0x05, 0x06, 0x00, 0xA3, 0x05,
+	0x06, 0x00, 0xA4, 0x05, 0x06, 0x00, 0xA5, 0x05, 0x06, 0x00, 0xA6, 0x05, 0x06, 0x00, 0xA7, 0x05,
+	0x06, 0x00, 0xA8, 0x05, 0x06, 0x00, 0xA9, 0x05, 0x06, 0x00, 0xAA, 0x05, 0x06, 0x00, 0xAB, 0x05,
+	0x06, 0x00, 0xAD, 0x05, 0x06, 0x00, 0xAE, 0x05, 0x06, 0x00, 0xAF, 0x05, 0x06, 0x00, 0xB0, 0x05,
+	0x06, 0x00, 0xB1, 0x05, 0x06, 0x00, 0xB2, 0x05, 0x06, 0x00, 0xB3, 0x05, 0x06, 0x00, 0xB4, 0x05,
+	0x06, 0x00, 0xB5, 0x05, 0x06, 0x00, 0xB6, 0x05, 0x06, 0x00, 0xB7, 0x05, 0x06, 0x00, 0xB8, 0x05,
+	0x06, 0x00, 0xB9, 0x05, 0x06, 0x00, 0xBA, 0x05, 0x06, 0x00, 0xBB, 0x05, 0x06, 0x00, 0xBC, 0x05,
+	0x06, 0x00, 0xBD, 0x05, 0x06, 0x00, 0xBE, 0x05, 0x06, 0x00, 0xBF, 0x05, 0x06, 0x00, 0xC0, 0x05,
+	0x06, 0x00, 0xC1, 0x05, 0x06, 0x00, 0xC2, 0x05, 0x06, 0x00, 0xC3, 0x05, 0x06, 0x00, 0xC4, 0x05,
+	0x06, 0x00, 0xC5, 0x05, 0x06, 0x00, 0xC6, 0x05, 0x06, 0x00, 0xC7, 0x05, 0x06, 0x00, 0xC8, 0x05,
+	0x06, 0x00, 0xC9, 0x05, 0x06, 0x00, 0xCA, 0x05, 0x06, 0x00, 0xCB, 0x05, 0x06, 0x00, 0xCD, 0x05,
+	0x06, 0x00, 0xCE, 0x05, 0x06, 0x00, 0xCF, 0x05, 0x06, 0x00, 0xD0, 0x05, 0x06, 0x00, 0xD1, 0x05,
+	0x06, 0x00, 0xD2, 0x05, 0x06, 0x00, 0xD3, 0x05, 0x06, 0x00, 0xD4, 0x05, 0x06, 0x00, 0xD5, 0x05,
+	0x06, 0x00, 0xD6, 0x05, 0x06, 0x00, 0xD7, 0x05, 0x06, 0x00, 0xD9, 0x05, 0x06, 0x00, 0xDA, 0x05,
+	0x06, 0x00, 0xDB, 0x05, 0x06, 0x00, 0xDC, 0x05, 0x06, 0x00, 0xDD, 0x05, 0x06, 0x00, 0xDE, 0x05,
+	0x06, 0x00, 0xDF, 0x05, 0x06, 0x00, 0xE0, 0x05, 0x06, 0x00, 0xE1, 0x05, 0x06, 0x00, 0xE2, 0x05,
+	0x06, 0x00, 0xE3, 0x05, 0x06, 0x00, 0xE4, 0x05, 0x06, 0x00, 0xE5, 0x05, 0x06, 0x00, 0xE6, 0x05,
+	0x06, 0x00, 0xE7, 0x05, 0x06, 0x00, 0xE8, 0x05, 0x06, 0x00, 0xE9, 0x05, 0x06, 0x00, 0xEA, 0x05,
+	0x06, 0x00, 0xEB, 0x05, 0x06, 0x00, 0xEC, 0x05, 0x06, 0x00, 0xED, 0x05, 0x06, 0x00, 0xEE, 0x05,
+	0x06, 0x00, 0xEF, 0x05, 0x06, 0x00, 0xF0, 0x05, 0x06, 0x00, 0xF1, 0x05, 0x06, 0x00, 0xF2, 0x05,
+	0x06, 0x00, 0xF3, 0x05, 0x06, 0x00, 0xF4, 0x05, 0x06, 0x00, 0xF5, 0x05, 0x06, 0x00, 0xF6, 0x05,
+	0x06, 0x00, 0xF7, 0x05, 0x06, 0x00, 0xF9, 0x05, 0x06, 0x00, 0xFA, 0x05, 0x06, 0x00, 0xFB, 0x05,
+	0x06, 0x00, 0xFC, 0x05, 0x06, 0x00, 0xFD, 0x05, 0x06, 0x00, 0xFE, 0x05, 0x06, 0x00, 0xFF, 0x05,
+	0x06, 0x04, 0x80, 0xDC, 0x41, 0xDC, 0x00, 0x81, 0x05, 0x06, 0x00, 0x82, 0x05, 0x06, 0x00, 0x83,
+	0x05, 0x06, 0x00, 0x85, 0x05, 0x06, 0x00, 0x86, 0x05, 0x06, 0x00, 0x87, 0x05, 0x06, 0x00, 0x88,
+	0x05, 0x06, 0x00, 0x89, 0x05, 0x06, 0x00, 0x8A, 0x05, 0x06, 0x00, 0x8B, 0x05, 0x06, 0x00, 0x8C,
+	0x05, 0x06, 0x00, 0x8D, 0x05, 0x06, 0x00, 0x8E, 0x05, 0x06, 0x00, 0x8F, 0x05, 0x06, 0x00, 0x90,
+	0x05, 0x06, 0x00, 0x91, 0x05, 0x06, 0x00, 0x92, 0x05, 0x06, 0x00, 0x93, 0x05, 0x06, 0x00, 0x94,
+	0x05, 0x06, 0x00, 0x95, 0x05, 0x06, 0x00, 0x96, 0x05, 0x06, 0x00, 0x97, 0x05, 0x06, 0x00, 0x98,
+	0x05, 0x06, 0x00, 0x99, 0x05, 0x06, 0x00, 0x9A, 0x05, 0x06, 0x00, 0x9B, 0x05, 0x06, 0x00, 0x9C,
+	0x05, 0x06, 0x00, 0x9D, 0x05, 0x06, 0x00, 0x9E, 0x05, 0x06, 0x00, 0x9F, 0x05, 0x06, 0x00, 0xA0,
+	0x05, 0x06, 0x00, 0xA1, 0x05, 0x06, 0x00, 0xA2, 0x05, 0x06, 0x00, 0xA3, 0x05, 0x06, 0x00, 0xA5,
+	0x05, 0x06, 0x00, 0xA6, 0x05, 0x06, 0x00, 0xA7, 0x05, 0x06, 0x00, 0xA8, 0x05, 0x06, 0x00, 0xA9,
+	0x05, 0x06, 0x00, 0xAA, 0x05, 0x06, 0x00, 0xAB, 0x05, 0x06, 0x00, 0xAC, 0x05, 0x06, 0x00, 0xAD,
+	0x05, 0x06, 0x00, 0xAE, 0x05, 0x06, 0x00, 0xAF, 0x05, 0x06, 0x00, 0xB0, 0x05, 0x06, 0x00, 0xB1,
+	0x05, 0x06, 0x00, 0xB2, 0x05, 0x06, 0x00, 0xB3, 0x05, 0x06, 0x00, 0xB9, 0x05, 0x06, 0x04, 0xFF,
+	0xDF, 0x21, 0x32, 0x04, 0x93, 0xE0, 0x01, 0x06, 0x00, 0x94, 0x05, 0x06, 0x00, 0x95, 0x05, 0x06,
+	0x00, 0x96, 0x05, 0x06, 0x00, 0x97, 0x05, 0x06, 0x00, 0x98, 0x05, 0x06, 0x00, 0x99, 0x05, 0x06,
+	0x00, 0x9A, 0x05, 0x06, 0x00, 0x9B, 0x05, 0x06, 0x00, 0x9C, 0x05, 0x06, 0x90, 0x9D, 0xE0, 0x69,
+	0x12, 0x2C, 0x0A, 0x24, 0x63, 0x61, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x2D, 0x30, 0x2D, 0x73,
+	0x68, 0x61, 0x70, 0x65, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x2D, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74,
+	0x20, 0x43, 0x09, 0x1D, 0x04, 0x12, 0x04, 0x01, 0xBE, 0x0C, 0x12, 0x2A, 0x0A, 0x22, 0x72, 0x2E,
+	0x00, 0x18, 0x54, 0x69, 0x74, 0x6C, 0x65, 0x12, 0x04, 0x01, 0xF0, 0x34, 0x12, 0x21, 0x0A, 0x19,
+	0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x2D, 0x09, 0x54, 0x48, 0x68, 0x79, 0x70,
+	0x65, 0x72, 0x6C, 0x69, 0x6E, 0x6B, 0x12, 0x04, 0x08, 0xD4, 0xD7, 0x69, 0x12, 0x1C, 0x0A, 0x14,
+	0x3E, 0x23, 0x00, 0x34, 0x6E, 0x75, 0x6C, 0x6C, 0x12, 0x04, 0x08, 0xD3, 0xD7, 0x69, 0x12, 0x1E,
+	0x0A, 0x16, 0x01, 0x1E, 0x4C, 0x74, 0x2D, 0x30, 0x2D, 0x63, 0x61, 0x74, 0x65, 0x67, 0x6F, 0x72,
+	0x79, 0x61, 0x78, 0x69, 0x73, 0x5F, 0x30, 0x12, 0x04, 0xE1, 0x2D, 0x0C, 0x12, 0x15, 0x0A, 0x0D,
+	0x15, 0x20, 0x14, 0x68, 0x61, 0x72, 0x74, 0x12, 0x04, 0xE1, 0x5C, 0x0C, 0x12, 0x16, 0x0A, 0x0E,
+	0x05, 0x0F, 0x28, 0x2D, 0x30, 0x2D, 0x6C, 0x65, 0x67, 0x65, 0x6E, 0x64, 0x12, 0x04, 0xE1, 0x6E,
+	0x0C, 0x12, 0x20, 0x0A, 0x18, 0x11, 0x18, 0x24, 0x70, 0x61, 0x72, 0x61, 0x67, 0x72, 0x61, 0x70,
+	0x68, 0x53, 0x01, 0xEB, 0x05, 0x51, 0x04, 0xA9, 0xDA, 0x6E, 0x22, 0x00, 0x08, 0x31, 0x12, 0x04,
+	0xE1, 0x70, 0x11, 0xD4, 0x01, 0x5C, 0x3A, 0x44, 0x00, 0x00, 0x31, 0x01, 0x96, 0x04, 0xB3, 0xDA,
+	0x72, 0x23, 0x00, 0x01, 0x46, 0x00, 0xB4, 0x76, 0x23, 0x00, 0x08, 0x32, 0x12, 0x04, 0xE1, 0x97,
+	0x6E, 0x69, 0x00, 0x08, 0x33, 0x12, 0x04, 0xE1, 0xB4, 0x6E, 0x23, 0x00, 0x08, 0x34, 0x12, 0x04,
+	0xE1, 0xD1, 0x6E, 0x23, 0x00, 0x08, 0x35, 0x12, 0x04, 0xE1, 0xEE, 0x6E, 0x23, 0x00, 0x08, 0x36,
+	0x12, 0x04, 0x0E, 0x0B, 0x08, 0x6E, 0x23, 0x00, 0x08, 0x37, 0x12, 0x04, 0x0E, 0x28, 0x08, 0x6E,
+	0x23, 0x00, 0x08, 0x38, 0x12, 0x04, 0x0E, 0x45, 0x08, 0x6E, 0x23, 0x00, 0x08, 0x39, 0x12, 0x04,
+	0x0E, 0x62, 0x08, 0x6A, 0xA2, 0x01, 0x21, 0x17, 0x00, 0xAB, 0x72, 0x3A, 0x01, 0x00, 0x32, 0x21,
+	0x80, 0x00, 0xBD, 0x76, 0x23, 0x00, 0x21, 0x80, 0x00, 0xBE, 0x76, 0x23, 0x00, 0x01, 0x69, 0x00,
+	0xBF, 0x76, 0x23, 0x00, 0x21, 0x80, 0x00, 0xC0, 0x76, 0x23, 0x00, 0x21, 0x80, 0x00, 0xC1, 0x76,
+	0x23, 0x00, 0x21, 0x80, 0x00, 0xC2, 0x76, 0x23, 0x00, 0x21, 0x80, 0x00, 0xC3, 0x76, 0x23, 0x00,
+	0x21, 0x80, 0x00, 0xC4, 0x76, 0x23, 0x00, 0x21, 0x80, 0x00, 0xC5, 0x76, 0x23, 0x00, 0x21, 0x80,
+	0x00, 0xC6, 0x72, 0x00, 0x03, 0x01, 0xF4, 0x00, 0xAC, 0x72, 0x22, 0x00, 0x01, 0xF3, 0x00, 0xAD,
+	0x72, 0x22, 0x00, 0x01, 0xF2, 0x00, 0xAE, 0x72, 0x22, 0x00, 0x01, 0xF1, 0x00, 0xAF, 0x72, 0x22,
+	0x00, 0x01, 0xF0, 0x00, 0xB0, 0x72, 0x22, 0x00, 0x01, 0xEF, 0x00, 0xB1, 0x72, 0x22, 0x00, 0x01,
+	0xEE, 0x18, 0xB2, 0xDA, 0x69, 0x12, 0x1F, 0x0A, 0x17, 0x91, 0x10, 0x2C, 0x72, 0x65, 0x66, 0x65,
+	0x72, 0x65, 0x6E, 0x63, 0x65, 0x4C, 0x69, 0x6E, 0x89, 0x0F, 0x18, 0xC7, 0xDA, 0x69, 0x12, 0x18,
+	0x0A, 0x10, 0x11, 0x21, 0x10, 0x73, 0x65, 0x72, 0x69, 0x65, 0x89, 0x7A, 0x00, 0xA2, 0x52, 0x1A,
+	0x00, 0x41, 0x5B, 0x00, 0xA3, 0x52, 0x1A, 0x00, 0x41, 0x52, 0x00, 0xA4, 0x52, 0x1A, 0x00, 0x21,
+	0x55, 0x00, 0xA5, 0x52, 0x1A, 0x00, 0x21, 0x4D, 0x00, 0xA6, 0x52, 0x1A, 0x00, 0x21, 0x45, 0x18,
+	0xA7, 0xDA, 0x69, 0x12, 0x1B, 0x0A, 0x13, 0x11, 0x9C, 0x10, 0x76, 0x61, 0x6C, 0x75, 0x65, 0xB5,
+	0x19, 0x00, 0x9F, 0x5E, 0x1D, 0x00, 0x01, 0xA2, 0x04, 0xA0, 0xDA, 0xBD, 0x56, 0x00, 0x31, 0x46,
+	0x56, 0x05, 0x04, 0xCD, 0xDA, 0xBD, 0x56, 0x04, 0x31, 0x2D, 0x05, 0x62, 0x04, 0x12, 0x04, 0x0E,
+	0xB6, 0x0B, 0xB9, 0x56, 0x00, 0x31, 0xB9, 0x56, 0x00, 0xCA, 0x2E, 0x68, 0x01, 0x00, 0x31, 0x3E,
+	0x12, 0x05, 0x61, 0x91, 0x00, 0xD5, 0x72, 0x22, 0x00, 0x01, 0x93, 0x00, 0xD6, 0x2E, 0x9B, 0x02,
+	0x42, 0x44, 0x00, 0xA5, 0x56, 0x00, 0xDF, 0x76, 0x23, 0x00, 0x01, 0x46, 0x00, 0xE0, 0x76, 0x23,
+	0x00, 0x21, 0x84, 0x00, 0xE1, 0x76, 0x23, 0x00, 0x21, 0x8D, 0x00, 0xE2, 0x76, 0x23, 0x00, 0x21,
+	0x96, 0x00, 0xE3, 0x76, 0x23, 0x00, 0x21, 0x9F, 0x00, 0xE4, 0x76, 0x23, 0x00, 0x41, 0xE5, 0x00,
+	0xE5, 0x76, 0x23, 0x00, 0x41, 0xE6, 0x00, 0xE6, 0x76, 0x23, 0x00, 0x41, 0xE7, 0x00, 0xE7, 0x76,
+	0x23, 0x00, 0x41, 0xE8, 0x00, 0xE8, 0x72, 0x80, 0x01, 0x21, 0x17, 0x00, 0xD7, 0x72, 0x45, 0x00,
+	0xA5, 0x56, 0x00, 0xE9, 0x76, 0x23, 0x00, 0x21, 0x80, 0x00, 0xEA, 0x76, 0x23, 0x00, 0x01, 0x69,
+	0x00, 0xEB, 0x76, 0x23, 0x00, 0x21, 0x80, 0x00, 0xEC, 0x76, 0x23, 0x00, 0x21, 0x80, 0x00, 0xED,
+	0x76, 0x23, 0x00, 0x21, 0x80, 0x00, 0xEE, 0x76, 0x23, 0x00, 0x21, 0x80, 0x00, 0xEF, 0x76, 0x23,
+	0x00, 0x21, 0x80, 0x00, 0xF0, 0x76, 0x23, 0x00, 0x21, 0x80, 0x00, 0xF1, 0x76, 0x23, 0x00, 0x21,
+	0x80, 0x00, 0xF2, 0x72, 0x80, 0x01, 0x01, 0xF4, 0x00, 0xD8, 0x72, 0x22, 0x00, 0x01, 0xF3, 0x00,
+	0xD9, 0x72, 0x22, 0x00, 0x01, 0xF2, 0x00, 0xDA, 0x72, 0x22, 0x00, 0x01, 0xF1, 0x00, 0xDB, 0x72,
+	0x22, 0x00, 0x01, 0xF0, 0x00, 0xDC, 0x72, 0x22, 0x00, 0x01, 0xEF, 0x00, 0xDD, 0x72, 0x22, 0x00,
+	0x01, 0xEE, 0x04, 0xDE, 0xDA, 0xBD, 0x56, 0x00, 0x31, 0x4A, 0x56, 0x05, 0x00, 0xF3, 0x2E, 0xD4,
+	0x04, 0x00, 0x31, 0x2E, 0x56, 0x05, 0x00, 0xCE, 0x52, 0x1A, 0x00, 0x41, 0x5B, 0x00, 0xCF, 0x52,
+	0x1A, 0x00, 0x41, 0x52, 0x00, 0xD0, 0x52, 0x1A, 0x00, 0x21, 0x55, 0x00, 0xD1, 0x52, 0x1A, 0x00,
+	0x21, 0x4D, 0x00, 0xD2, 0x52, 0x1A, 0x00, 0x21, 0x45, 0x00, 0xD3, 0x2E, 0x39, 0x05, 0x00, 0x31,
+	0x3A, 0x56, 0x05, 0x00, 0xCB, 0x5E, 0x1D, 0x00, 0x01, 0xA2, 0x00, 0xCC, 0x2E, 0x56, 0x05, 0x00,
+	0x32, 0x46, 0x56, 0x05, 0x00, 0xF9, 0x2E, 0x56, 0x05, 0x00, 0x32, 0xB5, 0x56, 0x04, 0xF5, 0xDA,
+	0xBD, 0x56, 0x00, 0x32, 0xB9, 0x56, 0x00, 0xF6, 0x2E, 0x68, 0x01, 0x00, 0x32, 0x4E, 0x56, 0x05,
+	0x04, 0x81, 0xDB, 0x2A, 0x2C, 0x09, 0x42, 0x22, 0x00, 0x01, 0x93, 0x04, 0x82, 0xDB, 0x2A, 0x71,
+	0x09, 0x46, 0x22, 0x00, 0xA1, 0x9B, 0x00, 0x8B, 0x76, 0x23, 0x00, 0x01, 0x46, 0x00, 0x8C, 0x76,
+	0x23, 0x00, 0x21, 0x84, 0x00, 0x8D, 0x76, 0x23, 0x00, 0x21, 0x8D, 0x00, 0x8E, 0x76, 0x23, 0x00,
+	0x21, 0x96, 0x00, 0x8F, 0x76, 0x23, 0x00, 0x21, 0x9F, 0x00, 0x90, 0x76, 0x23, 0x00, 0x41, 0xE5,
+	0x00, 0x91, 0x76, 0x23, 0x00, 0x41, 0xE6, 0x00, 0x92, 0x76, 0x23, 0x00, 0x41, 0xE7, 0x00, 0x93,
+	0x76, 0x23, 0x00, 0x41, 0xE8, 0x00, 0x94, 0x72, 0x80, 0x01, 0x21, 0x17, 0x00, 0x83, 0x72, 0x45,
+	0x00, 0xA5, 0x56, 0x00, 0x95, 0x76, 0x23, 0x00, 0x21, 0x80, 0x00, 0x96, 0x76, 0x23, 0x00, 0x01,
+	0x69, 0x00, 0x97, 0x76, 0x23, 0x00, 0x21, 0x80, 0x00, 0x98, 0x76, 0x23, 0x00, 0x21, 0x80, 0x00,
+	0x99, 0x76, 0x23, 0x00, 0x21, 0x80, 0x00, 0x9A, 0x76, 0x23, 0x00, 0x21, 0x80, 0x00, 0x9B, 0x76,
+	0x23, 0x00, 0x21, 0x80, 0x00, 0x9C, 0x76, 0x23, 0x00, 0x21, 0x80, 0x00, 0x9D, 0x76, 0x23, 0x00,
+	0x21, 0x80, 0x00, 0x9E, 0x72, 0x80, 0x01, 0x01, 0xF4, 0x00, 0x84, 0x72, 0x22, 0x00, 0x01, 0xF3,
+	0x00, 0x85, 0x72, 0x22, 0x00, 0x01, 0xF2, 0x00, 0x86, 0x72, 0x22, 0x00, 0x01, 0xF1, 0x00, 0x87,
+	0x72, 0x22, 0x00, 0x01, 0xF0, 0x00, 0x88, 0x72, 0x22, 0x00, 0x01, 0xEF, 0x00, 0x89, 0x72, 0x22,
+	0x00, 0x01, 0xEE, 0x04, 0x8A, 0xDB, 0xBD, 0x56, 0x00, 0x32, 0x4A, 0x56, 0x05, 0x04, 0x9F, 0xDB,
+	0x2A, 0xAC, 0x0A, 0x00, 0x32, 0x2E, 0x56, 0x05, 0x00, 0xFA, 0x2E, 0xEE, 0x04, 0x15, 0x1A, 0x41,
+	0x5B, 0x00, 0xFB, 0x52, 0x1A, 0x00, 0x41, 0x52, 0x00, 0xFC, 0x52, 0x1A, 0x00, 0x21, 0x55, 0x00,
+	0xFD, 0x52, 0x1A, 0x00, 0x21, 0x4D, 0x00, 0xFE, 0x52, 0x1A, 0x00, 0x21, 0x45, 0x00, 0xFF, 0x2E,
+	0x39, 0x05, 0x00, 0x32, 0x3A, 0x56, 0x05, 0x00, 0xF7, 0x5E, 0x1D, 0x00, 0x01, 0xA2, 0x00, 0xF8,
+	0x2E, 0x56, 0x05, 0x00, 0x33, 0x46, 0x56, 0x05, 0x04, 0xA5, 0xDB, 0x2A, 0xAC, 0x0A, 0x00, 0x33,
+	0xB5, 0x56, 0x04, 0xA1, 0xDB, 0xBD, 0x56, 0x00, 0x33, 0xB9, 0x56, 0x00, 0xA2, 0x2E, 0x68, 0x01,
+	0x00, 0x33, 0x4E, 0x56, 0x05, 0x00, 0xAD, 0x72, 0x22, 0x00, 0x01, 0x93, 0x00, 0xAE, 0x2E, 0x9B,
+	0x02, 0x42, 0x44, 0x00, 0xA5, 0x56, 0x00, 0xB7, 0x76, 0x23, 0x00, 0x01, 0x46, 0x00, 0xB8, 0x76,
+	0x23, 0x00, 0x21, 0x84, 0x00, 0xB9, 0x76, 0x23, 0x00, 0x21, 0x8D, 0x00, 0xBA, 0x76, 0x23, 0x00,
+	0x21, 0x96, 0x00, 0xBB, 0x76, 0x23, 0x00, 0x21, 0x9F, 0x00, 0xBC, 0x76, 0x23, 0x00, 0x41, 0xE5,
+	0x00, 0xBD, 0x76, 0x23, 0x00, 0x41, 0xE6, 0x00, 0xBE, 0x76, 0x23, 0x00, 0x41, 0xE7, 0x00, 0xBF,
+	0x76, 0x23, 0x00, 0x41, 0xE8, 0x00, 0xC0, 0x72, 0x80, 0x01, 0x21, 0x17, 0x00, 0xAF, 0x72, 0x45,
+	0x00, 0xA5, 0x56, 0x00, 0xC1, 0x76, 0x23, 0x00, 0x21, 0x80, 0x00, 0xC2, 0x76, 0x23, 0x00, 0x01,
+	0x69, 0x00, 0xC3, 0x76, 0x23, 0x00, 0x21, 0x80, 0x00, 0xC4, 0x76, 0x23, 0x00, 0x21, 0x80, 0x00,
+	0xC5, 0x76, 0x23, 0x00, 0x21, 0x80, 0x00, 0xC6, 0x76, 0x23, 0x00, 0x21, 0x80, 0x00, 0xC7, 0x76,
+	0x23, 0x00, 0x21, 0x80, 0x00, 0xC8, 0x76, 0x23, 0x00, 0x21, 0x80, 0x00, 0xC9, 0x76, 0x23, 0x00,
+	0x21, 0x80, 0x00, 0xCA, 0x72, 0x80, 0x01, 0x01, 0xF4, 0x00, 0xB0, 0x72, 0x22, 0x00, 0x01, 0xF3,
+	0x00, 0xB1, 0x72, 0x22, 0x00, 0x01, 0xF2, 0x00, 0xB2, 0x72, 0x22, 0x00, 0x01, 0xF1, 0x00, 0xB3,
+	0x72, 0x22, 0x00, 0x01, 0xF0, 0x00, 0xB4, 0x72, 0x22, 0x00, 0x01, 0xEF, 0x00, 0xB5, 0x72, 0x22,
+	0x00, 0x01, 0xEE, 0x00, 0xB6, 0x2E, 0x56, 0x05, 0x00, 0x33, 0x4A, 0x56, 0x05, 0x00, 0xCB, 0x2E,
+	0x56, 0x05, 0x00, 0x33, 0x2E, 0x56, 0x05, 0x00, 0xA6, 0x52, 0x1A, 0x00, 0x41, 0x5B, 0x00, 0xA7,
+	0x52, 0x1A, 0x00, 0x41, 0x52, 0x00, 0xA8, 0x52, 0x1A, 0x00, 0x21, 0x55, 0x00, 0xA9, 0x52, 0x1A,
+	0x00, 0x21, 0x4D, 0x00, 0xAA, 0x52, 0x1A, 0x00, 0x21, 0x45, 0x04, 0xAB, 0xDB, 0x2A, 0x02, 0x10,
+	0x00, 0x33, 0x3A, 0x56, 0x05, 0x00, 0xA3, 0x5E, 0x1D, 0x00, 0x01, 0xA2, 0x04, 0xA4, 0xDB, 0x2A,
+	0x02, 0x10, 0x00, 0x34, 0x46, 0x56, 0x05, 0x00, 0xD1, 0x2E, 0x56, 0x05, 0x00, 0x34, 0xB5, 0x56,
+	0x00, 0xCD, 0x2E, 0x56, 0x05, 0x00, 0x34, 0xB9, 0x56, 0x00, 0xCE, 0x2E, 0x68, 0x01, 0x00, 0x34,
+	0x4E, 0x56, 0x05, 0x00, 0xD9, 0x72, 0x22, 0x00, 0x01, 0x93, 0x00, 0xDA, 0x2E, 0x9B, 0x02, 0x42,
+	0x44, 0x00, 0xA5, 0x56, 0x00, 0xE3, 0x76, 0x23, 0x00, 0x01, 0x46, 0x00, 0xE4, 0x76, 0x23, 0x00,
+	0x21, 0x84, 0x00, 0xE5, 0x76, 0x23, 0x00, 0x21, 0x8D, 0x00, 0xE6, 0x76, 0x23, 0x00, 0x21, 0x96,
+	0x00, 0xE7, 0x76, 0x23, 0x00, 0x21, 0x9F, 0x00, 0xE8, 0x76, 0x23, 0x00, 0x41, 0xE5, 0x00, 0xE9,
+	0x76, 0x23, 0x00, 0x41, 0xE6, 0x00, 0xEA, 0x76, 0x23, 0x00, 0x41, 0xE7, 0x00, 0xEB, 0x76, 0x23,
+	0x00, 0x41, 0xE8, 0x00, 0xEC, 0x72, 0x80, 0x01, 0x21, 0x17, 0x00, 0xDB, 0x72, 0x45, 0x00, 0xA5,
+	0x56, 0x00, 0xED, 0x76, 0x23, 0x00, 0x21, 0x80, 0x00, 0xEE, 0x76, 0x23, 0x00, 0x01, 0x69, 0x00,
+	0xEF, 0x76, 0x23, 0x00, 0x21, 0x80, 0x00, 0xF0, 0x76, 0x23, 0x00, 0x21, 0x80, 0x00, 0xF1, 0x76,
+	0x23, 0x00, 0x21, 0x80, 0x00, 0xF2, 0x76, 0x23, 0x00, 0x21, 0x80, 0x00, 0xF3, 0x76, 0x23, 0x00,
+	0x21, 0x80, 0x00, 0xF4, 0x76, 0x23, 0x00, 0x21, 0x80, 0x00, 0xF5, 0x76, 0x23, 0x00, 0x21, 0x80,
+	0x00, 0xF6, 0x72, 0x80, 0x01, 0x01, 0xF4, 0x00, 0xDC, 0x72, 0x22, 0x00, 0x01, 0xF3, 0x00, 0xDD,
+	0x72, 0x22, 0x00, 0x01, 0xF2, 0x00, 0xDE, 0x72, 0x22, 0x00, 0x01, 0xF1, 0x00, 0xDF, 0x72, 0x22,
+	0x00, 0x01, 0xF0, 0x00, 0xE0, 0x72, 0x22, 0x00, 0x01, 0xEF, 0x00, 0xE1, 0x72, 0x22, 0x00, 0x01,
+	0xEE, 0x00, 0xE2, 0x2E, 0x56, 0x05, 0x00, 0x34, 0x4A, 0x56, 0x05, 0x00, 0xF7, 0x2E, 0xD4, 0x04,
+	0x00, 0x34, 0x2E, 0x56, 0x05, 0x00, 0xD2, 0x52, 0x1A, 0x00, 0x41, 0x5B, 0x00, 0xD3, 0x52, 0x1A,
+	0x00, 0x41, 0x52, 0x00, 0xD4, 0x52, 0x1A, 0x00, 0x21, 0x55, 0x00, 0xD5, 0x52, 0x1A, 0x00, 0x21,
+	0x4D, 0x00, 0xD6, 0x52, 0x1A, 0x00, 0x21, 0x45, 0x00, 0xD7, 0x2E, 0x39, 0x05, 0x00, 0x34, 0x3A,
+	0x56, 0x05, 0x00, 0xCF, 0x5E, 0x1D, 0x00, 0x01, 0xA2, 0x00, 0xD0, 0x2E, 0x56, 0x05, 0x00, 0x35,
+	0x46, 0x56, 0x05, 0x00, 0xFD, 0x2E, 0x56, 0x05, 0x00, 0x35, 0xB5, 0x56, 0x00, 0xF9, 0x2E, 0x56,
+	0x05, 0x00, 0x35, 0xB9, 0x56, 0x00, 0xFA, 0x2E, 0x68, 0x01, 0x00, 0x35, 0x4E, 0x56, 0x05, 0x04,
+	0x85, 0xDC, 0x2A, 0x02, 0x10, 0x42, 0x22, 0x00, 0x01, 0x93, 0x04, 0x86, 0xDC, 0x2A, 0x02, 0x10,
+	0x46, 0x22, 0x00, 0x0E, 0x02, 0x10, 0x00, 0x8F, 0x76, 0x23, 0x00, 0x01, 0x46, 0x00, 0x90, 0x76,
+	0x23, 0x00, 0x21, 0x84, 0x00, 0x91, 0x76, 0x23, 0x00, 0x21, 0x8D, 0x00, 0x92, 0x76, 0x23, 0x00,
+	0x21, 0x96, 0x00, 0x93, 0x76, 0x23, 0x00, 0x21, 0x9F, 0x00, 0x94, 0x76, 0x23, 0x00, 0x41, 0xE5,
+	0x00, 0x95, 0x76, 0x23, 0x00, 0x41, 0xE6, 0x00, 0x96, 0x76, 0x23, 0x00, 0x41, 0xE7, 0x00, 0x97,
+	0x76, 0x23, 0x00, 0x41, 0xE8, 0x00, 0x98, 0x72, 0x80, 0x01, 0x21, 0x17, 0x00, 0x87, 0x72, 0x45,
+	0x00, 0xA5, 0x56, 0x00, 0x99, 0x76, 0x23, 0x00, 0x21, 0x80, 0x00, 0x9A, 0x76, 0x23, 0x00, 0x01,
+	0x69, 0x00, 0x9B, 0x76, 0x23, 0x00, 0x21, 0x80, 0x00, 0x9C, 0x76, 0x23, 0x00, 0x21, 0x80, 0x00,
+	0x9D, 0x76, 0x23, 0x00, 0x21, 0x80, 0x00, 0x9E, 0x76, 0x23, 0x00, 0x21, 0x80, 0x00, 0x9F, 0x76,
+	0x23, 0x00, 0x21, 0x80, 0x00, 0xA0, 0x76, 0x23, 0x00, 0x21, 0x80, 0x00, 0xA1, 0x76, 0x23, 0x00,
+	0x21, 0x80, 0x00, 0xA2, 0x72, 0x80, 0x01, 0x01, 0xF4, 0x00, 0x88, 0x72, 0x22, 0x00, 0x01, 0xF3,
+	0x00, 0x89, 0x72, 0x22, 0x00, 0x01, 0xF2, 0x00, 0x8A, 0x72, 0x22, 0x00, 0x01, 0xF1, 0x00, 0x8B,
+	0x72, 0x22, 0x00, 0x01, 0xF0, 0x00, 0x8C, 0x72, 0x22, 0x00, 0x01, 0xEF, 0x00, 0x8D, 0x72, 0x22,
+	0x00, 0x01, 0xEE, 0x04, 0x8E, 0xDC, 0x2A, 0x02, 0x10, 0x00, 0x35, 0x4A, 0x56, 0x05, 0x04, 0xA3,
+	0xDC, 0x2A, 0x02, 0x10, 0x00, 0x35, 0x2E, 0x56, 0x05, 0x00, 0xFE, 0x2E, 0xEE, 0x04, 0x15, 0x1A,
+	0x41, 0x5B, 0x00, 0xFF, 0x52, 0x1A, 0x00, 0x41, 0x52, 0x00, 0x80, 0x52, 0x4E, 0x00, 0x21, 0x55,
+	0x00, 0x81, 0x52, 0x1A, 0x00, 0x21, 0x4D, 0x00, 0x82, 0x52, 0x1A, 0x00, 0x21, 0x45, 0x04, 0x83,
+	0xDC, 0x2A, 0xAC, 0x0A, 0x00, 0x35, 0x3A, 0x56, 0x05, 0x00, 0xFB, 0x2E, 0x56, 0x05, 0x2E, 0x1D,
+	0x00, 0x01, 0xA2, 0x04, 0xFC, 0xDB, 0x16, 0x22, 0x20, 0x10, 0x6F, 0x6C, 0x75, 0x6D, 0x6E, 0x1A,
+	0x42, 0x20, 0x14, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x0E, 0x95, 0x1A, 0x50, 0xB9, 0xDC, 0x69,
+	0x12, 0x26, 0x0A, 0x1E, 0x64, 0x72, 0x61, 0x77, 0x69, 0x6E, 0x67, 0x6C, 0x69, 0x6E, 0x65, 0x2D,
+	0x30, 0x2D, 0x1D, 0x0E, 0x12, 0xDB, 0x1F, 0x04, 0x12, 0x04, 0x0E, 0xE1, 0x2A, 0x1C, 0x12, 0x1D,
+	0x0A, 0x15, 0x65, 0x71, 0x75, 0x61, 0x0E, 0xE6, 0x20, 0x18, 0x2D, 0x30, 0x2D, 0x69, 0x6D, 0x61,
+	0x67, 0x15, 0x1F, 0x18, 0x93, 0xE0, 0x69, 0x12, 0x1A, 0x0A, 0x12, 0x05, 0x14, 0x3E, 0x1C, 0x00,
+	0x04, 0xE8, 0xD7, 0x1D, 0x1C, 0x00, 0x31, 0x36, 0x38, 0x00, 0x00, 0xE9, 0x2E, 0x1C, 0x00, 0x00,
+	0x32, 0x36, 0x1C, 0x00, 0x00, 0xEA, 0x2E, 0x1C, 0x00, 0x00, 0x33, 0x36, 0x1C, 0x00, 0x00, 0xEB,
+	0x2E, 0x1C, 0x00, 0x00, 0x34, 0x36, 0x1C, 0x00, 0x00, 0xEC, 0x2E, 0x1C, 0x00, 0x00, 0x35, 0x36,
+	0x1C, 0x00, 0x18, 0xED, 0xD7, 0x69, 0x12, 0x19, 0x0A, 0x11, 0x0D, 0xE8, 0x26, 0xA8, 0x21, 0x04,
+	0x12, 0x04, 0x0E, 0x59, 0x2C, 0x15, 0x1B, 0x00, 0x31, 0x36, 0x1B, 0x00, 0x00, 0xDC, 0x1D, 0x36,
+	0x00, 0x32, 0x36, 0x1B, 0x00, 0x00, 0xDD, 0x1D, 0x1B, 0x00, 0x33, 0x36, 0x1B, 0x00, 0x00, 0xDE,
+	0x1D, 0x1B, 0x00, 0x34, 0x36, 0x1B, 0x00, 0x00, 0xDF, 0x1D, 0x1B, 0x00, 0x35, 0x36, 0x1B, 0x00,
+	0x00, 0xE0, 0x09, 0xBE, 0x0C, 0x6D, 0x6F, 0x76, 0x69, 0x21, 0x4A, 0x05, 0x08, 0x31, 0x85, 0x00,
+	0xEE, 0x2E, 0x1C, 0x00, 0x00, 0x31, 0x36, 0x1C, 0x00, 0x00, 0xEF, 0x2E, 0x1C, 0x00, 0x00, 0x32,
+	0x36, 0x1C, 0x00, 0x00, 0xF0, 0x2E, 0x1C, 0x00, 0x00, 0x33, 0x36, 0x1C, 0x00, 0x00, 0xF1, 0x2E,
+	0x1C, 0x00, 0x00, 0x34, 0x36, 0x1C, 0x00, 0x00, 0xF2, 0x2E, 0x1C, 0x00, 0x00, 0x35, 0x36, 0x1C,
+	0x00, 0x04, 0xF3, 0xD7, 0x65, 0x4E, 0x22, 0xC0, 0x21, 0x42, 0x5A, 0x02, 0x00, 0xA2, 0x09, 0x3D,
+	0x25, 0x64, 0x32, 0x14, 0x23, 0x04, 0x12, 0x04, 0x0E, 0xA1, 0x2D, 0x41, 0x2F, 0x09, 0x1C, 0x3A,
+	0x6D, 0x01, 0x00, 0xE2, 0x2E, 0x38, 0x00, 0x3A, 0x6E, 0x01, 0x00, 0xE3, 0x2E, 0x1C, 0x00, 0x3A,
+	0x6F, 0x01, 0x00, 0xE4, 0x2E, 0x1C, 0x00, 0x3A, 0x70, 0x01, 0x00, 0xE5, 0x2E, 0x1C, 0x00, 0x3A,
+	0x71, 0x01, 0x48, 0xE6, 0xD7, 0x69, 0x12, 0x29, 0x0A, 0x21, 0x73, 0x74, 0x69, 0x63, 0x6B, 0x79,
+	0x43, 0x6F, 0x6D, 0x6D, 0x65, 0x6E, 0x32, 0x99, 0x22, 0x16, 0x74, 0x23, 0xE5, 0xA5, 0x00, 0xF5,
+	0x96, 0x2B, 0x00, 0x61, 0xE4, 0x04, 0x96, 0xE0, 0x92, 0x56, 0x00, 0x61, 0xF5, 0x00, 0x97, 0x96,
+	0x2B, 0x00, 0x81, 0x06, 0x00, 0x98, 0x96, 0x2B, 0x00, 0xA1, 0x54, 0x00, 0x99, 0x96, 0x2B, 0x00,
+	0xA1, 0x3B, 0x00, 0x9A, 0x92, 0x2B, 0x00, 0xE9, 0x27, 0x96, 0x2B, 0x00, 0x01, 0xD7, 0x00, 0x9C,
+	0x96, 0x2B, 0x00, 0x01, 0x81, 0x0E, 0x42, 0x25, 0x08, 0x22, 0x0A, 0x1A, 0x3E, 0x83, 0x01, 0x45,
+	0x1F, 0x51, 0xFC, 0x00, 0xF6, 0x16, 0xCB, 0x24, 0x18, 0x73, 0x76, 0x67, 0x69, 0x6D, 0x70, 0x6F,
+	0x12, 0x3C, 0x24, 0x05, 0x20, 0x25, 0x9F, 0x04, 0x12, 0x04, 0x0E, 0xB6, 0x25, 0x41, 0x53, 0x0C,
+	0x74, 0x61, 0x62, 0x6C, 0x41, 0x6F, 0x05, 0x08, 0x11, 0x3C, 0x04, 0x87, 0xD9, 0x1D, 0x1C, 0x00,
+	0x31, 0x36, 0x1C, 0x00, 0x00, 0xA0, 0x2E, 0x1C, 0x00, 0x00, 0x32, 0x36, 0x1C, 0x00, 0x00, 0xB9,
+	0x2E, 0x1C, 0x00, 0x00, 0x33, 0x36, 0x1C, 0x00, 0x00, 0xD2, 0x2E, 0x1C, 0x00, 0x00, 0x34, 0x36,
+	0x1C, 0x00, 0x00, 0xEB, 0x2E, 0x1C, 0x00, 0x00, 0x35, 0x36, 0x1C, 0x00, 0x04, 0x84, 0xDA, 0xA5,
+	0x49, 0x05, 0xA0, 0x28, 0x43, 0x65, 0x6C, 0x6C, 0x2D, 0x30, 0x2D, 0x62, 0x6F, 0x64, 0x79, 0x11,
+	0xAB, 0x18, 0x88, 0xD9, 0x69, 0x12, 0x25, 0x0A, 0x1D, 0x2E, 0x1F, 0x00, 0x00, 0x63, 0x1A, 0xB6,
+	0x25, 0x28, 0x4C, 0x65, 0x76, 0x65, 0x6C, 0x31, 0x52, 0x6F, 0x77, 0x12, 0x04, 0x0E, 0x40, 0x30,
+	0x72, 0x27, 0x00, 0x00, 0x32, 0x09, 0x27, 0x00, 0x8D, 0x7A, 0x4E, 0x00, 0x00, 0x33, 0x09, 0x27,
+	0x00, 0x8E, 0x7A, 0x27, 0x00, 0x00, 0x34, 0x09, 0x27, 0x00, 0x8F, 0x7A, 0x27, 0x00, 0x00, 0x35,
+	0x09, 0x27, 0x08, 0x90, 0xD9, 0x69, 0x21, 0xCE, 0x2E, 0xC3, 0x00, 0x20, 0x66, 0x6F, 0x6F, 0x74,
+	0x65, 0x72, 0x52, 0x6F, 0x77, 0x11, 0xE7, 0x00, 0x8B, 0x46, 0x4B, 0x00, 0x18, 0x68, 0x65, 0x61,
+	0x64, 0x65, 0x72, 0x43, 0xC5, 0xA7, 0x11, 0x27, 0x00, 0x8A, 0x46, 0x4B, 0x00, 0x09, 0x27, 0x1D,
+	0x4B, 0x00, 0x89, 0x46, 0x24, 0x00, 0x10, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x2E, 0x2F, 0x01, 0x00,
+	0x91, 0x6E, 0x24, 0x00, 0x2D, 0x2C, 0x00, 0x92, 0x6E, 0x24, 0x00, 0x2D, 0x29, 0x00, 0x93, 0x6E,
+	0x24, 0x00, 0x2D, 0x26, 0x00, 0x94, 0x6E, 0x24, 0x00, 0x2D, 0x23, 0x04, 0x95, 0xD9, 0x12, 0x05,
+	0x28, 0x2E, 0x23, 0x01, 0x14, 0x70, 0x69, 0x76, 0x6F, 0x74, 0x42, 0x41, 0x0A, 0x14, 0x75, 0x6D,
+	0x6D, 0x61, 0x72, 0x79, 0x29, 0x09, 0x0E, 0x8D, 0x27, 0x14, 0xD9, 0x69, 0x12, 0x27, 0x0A, 0x1F,
+	0x6E, 0x2C, 0x00, 0x29, 0x78, 0x04, 0x9C, 0xD9, 0x12, 0x88, 0x28, 0x42, 0x29, 0x00, 0x00, 0x48,
+	0x2E, 0x59, 0x01, 0x09, 0x5D, 0x0E, 0xCC, 0x27, 0x00, 0xD9, 0x3A, 0x88, 0x02, 0x00, 0x31, 0x32,
+	0x88, 0x02, 0x00, 0xA1, 0x3E, 0xA1, 0x01, 0x26, 0xE8, 0x22, 0x2E, 0x59, 0x01, 0x00, 0xA5, 0x7A,
+	0x27, 0x00, 0x2D, 0x5C, 0x00, 0xA6, 0x7A, 0x27, 0x00, 0x2D, 0x5F, 0x00, 0xA7, 0x7A, 0x27, 0x00,
+	0x2D, 0x62, 0x00, 0xA8, 0x7A, 0x27, 0x00, 0x2D, 0x65, 0x00, 0xA9, 0x3E, 0x89, 0x01, 0x00, 0x31,
+	0x46, 0x88, 0x02, 0x00, 0xA4, 0x46, 0x4B, 0x00, 0x49, 0x61, 0x29, 0x7F, 0x51, 0x88, 0x00, 0xA3,
+	0x46, 0x4B, 0x00, 0x09, 0x27, 0x5D, 0x88, 0x00, 0xA2, 0x46, 0x24, 0x00, 0x42, 0x88, 0x02, 0x00,
+	0xAA, 0x6E, 0x24, 0x00, 0x2D, 0x2C, 0x00, 0xAB, 0x6E, 0x24, 0x00, 0x2D, 0x29, 0x00, 0xAC, 0x6E,
+	0x24, 0x00, 0x2D, 0x26, 0x00, 0xAD, 0x6E, 0x24, 0x00, 0x2D, 0x23, 0x00, 0xAE, 0x3E, 0x88, 0x02,
+	0x00, 0x31, 0x66, 0x88, 0x02, 0x00, 0xB6, 0x3E, 0x88, 0x02, 0x46, 0x2C, 0x00, 0x49, 0x88, 0x00,
+	0xB5, 0x3E, 0x88, 0x02, 0x0D, 0x29, 0x56, 0x88, 0x02, 0x00, 0xB7, 0x3E, 0x88, 0x02, 0x00, 0x32,
+	0x32, 0x88, 0x02, 0x00, 0xBA, 0x3E, 0xA1, 0x01, 0x26, 0x1A, 0x20, 0x2E, 0x88, 0x02, 0x00, 0xBE,
+	0x7A, 0x27, 0x00, 0x2D, 0x5C, 0x00, 0xBF, 0x7A, 0x27, 0x00, 0x2D, 0x5F, 0x00, 0xC0, 0x7A, 0x27,
+	0x00, 0x2D, 0x62, 0x00, 0xC1, 0x7A, 0x27, 0x00, 0x2D, 0x65, 0x00, 0xC2, 0x3E, 0x89, 0x01, 0x00,
+	0x32, 0x46, 0x88, 0x02, 0x00, 0xBD, 0x46, 0x4B, 0x00, 0x49, 0x61, 0x36, 0x88, 0x02, 0x00, 0xBC,
+	0x46, 0x4B, 0x00, 0x09, 0x27, 0x5D, 0x88, 0x00, 0xBB, 0x46, 0x24, 0x00, 0x42, 0x88, 0x02, 0x00,
+	0xC3, 0x6E, 0x24, 0x00, 0x2D, 0x2C, 0x00, 0xC4, 0x6E, 0x24, 0x00, 0x2D, 0x29, 0x00, 0xC5, 0x6E,
+	0x24, 0x00, 0x2D, 0x26, 0x00, 0xC6, 0x6E, 0x24, 0x00, 0x2D, 0x23, 0x00, 0xC7, 0x3E, 0x88, 0x02,
+	0x00, 0x32, 0x66, 0x88, 0x02, 0x00, 0xCF, 0x3E, 0x88, 0x02, 0x46, 0x2C, 0x00, 0x49, 0x88, 0x00,
+	0xCE, 0x3E, 0x88, 0x02, 0x0D, 0x29, 0x56, 0x88, 0x02, 0x00, 0xD0, 0x3E, 0x88, 0x02, 0x00, 0x33,
+	0x32, 0x88, 0x02, 0x00, 0xD3, 0x3E, 0xA1, 0x01, 0x26, 0x4C, 0x1D, 0x2E, 0x88, 0x02, 0x00, 0xD7,
+	0x7A, 0x27, 0x00, 0x2D, 0x5C, 0x00, 0xD8, 0x7A, 0x27, 0x00, 0x2D, 0x5F, 0x00, 0xD9, 0x7A, 0x27,
+	0x00, 0x2D, 0x62, 0x00, 0xDA, 0x7A, 0x27, 0x00, 0x2D, 0x65, 0x00, 0xDB, 0x3E, 0x89, 0x01, 0x00,
+	0x33, 0x46, 0x88, 0x02, 0x00, 0xD6, 0x46, 0x4B, 0x00, 0x49, 0x61, 0x36, 0x88, 0x02, 0x00, 0xD5,
+	0x46, 0x4B, 0x00, 0x09, 0x27, 0x5D, 0x88, 0x00, 0xD4, 0x46, 0x24, 0x00, 0x42, 0x88, 0x02, 0x00,
+	0xDC, 0x6E, 0x24, 0x00, 0x2D, 0x2C, 0x00, 0xDD, 0x6E, 0x24, 0x00, 0x2D, 0x29, 0x00, 0xDE, 0x6E,
+	0x24, 0x00, 0x2D, 0x26, 0x00, 0xDF, 0x6E, 0x24, 0x00, 0x2D, 0x23, 0x00, 0xE0, 0x3E, 0x88, 0x02,
+	0x00, 0x33, 0x66, 0x88, 0x02, 0x00, 0xE8, 0x3E, 0x88, 0x02, 0x46, 0x2C, 0x00, 0x49, 0x88, 0x00,
+	0xE7, 0x3E, 0x88, 0x02, 0x0D, 0x29, 0x56, 0x88, 0x02, 0x00, 0xE9, 0x3E, 0x88, 0x02, 0x00, 0x34,
+	0x32, 0x88, 0x02, 0x00, 0xEC, 0x3E, 0xA1, 0x01, 0x26, 0x7E, 0x1A, 0x2E, 0x88, 0x02, 0x00, 0xF0,
+	0x7A, 0x27, 0x00, 0x2D, 0x5C, 0x00, 0xF1, 0x7A, 0x27, 0x00, 0x2D, 0x5F, 0x00, 0xF2, 0x7A, 0x27,
+	0x00, 0x2D, 0x62, 0x00, 0xF3, 0x7A, 0x27, 0x00, 0x2D, 0x65, 0x00, 0xF4, 0x3E, 0x89, 0x01, 0x00,
+	0x34, 0x46, 0x88, 0x02, 0x00, 0xEF, 0x46, 0x4B, 0x00, 0x49, 0x61, 0x36, 0x88, 0x02, 0x00, 0xEE,
+	0x46, 0x4B, 0x00, 0x09, 0x27, 0x5D, 0x88, 0x00, 0xED, 0x46, 0x24, 0x00, 0x42, 0x88, 0x02, 0x00,
+	0xF5, 0x6E, 0x24, 0x00, 0x2D, 0x2C, 0x00, 0xF6, 0x6E, 0x24, 0x00, 0x2D, 0x29, 0x00, 0xF7, 0x6E,
+	0x24, 0x00, 0x2D, 0x26, 0x00, 0xF8, 0x6E, 0x24, 0x00, 0x2D, 0x23, 0x00, 0xF9, 0x3E, 0x88, 0x02,
+	0x00, 0x34, 0x66, 0x88, 0x02, 0x04, 0x81, 0xDA, 0x3A, 0x20, 0x0A, 0x46, 0x2C, 0x00, 0x49, 0x88,
+	0x04, 0x80, 0xDA, 0x3A, 0x20, 0x0A, 0x0D, 0x29, 0x56, 0x88, 0x02, 0x00, 0x82, 0x3E, 0xA8, 0x0C,
+	0x00, 0x35, 0x32, 0x88, 0x02, 0x04, 0x85, 0xDA, 0x3A, 0x81, 0x0C, 0x26, 0xB0, 0x17, 0x2E, 0x88,
+	0x02, 0x00, 0x89, 0x7A, 0x27, 0x00, 0x2D, 0x5C, 0x00, 0x8A, 0x7A, 0x27, 0x00, 0x2D, 0x5F, 0x00,
+	0x8B, 0x7A, 0x27, 0x00, 0x2D, 0x62, 0x00, 0x8C, 0x7A, 0x27, 0x00, 0x2D, 0x65, 0x04, 0x8D, 0xDA,
+	0x3A, 0xA8, 0x0C, 0x00, 0x35, 0x46, 0x88, 0x02, 0x00, 0x88, 0x46, 0x4B, 0x00, 0x49, 0x61, 0x36,
+	0x88, 0x02, 0x00, 0x87, 0x46, 0x4B, 0x00, 0x09, 0x27, 0x5D, 0x88, 0x00, 0x86, 0x46, 0x24, 0x00,
+	0x42, 0x88, 0x02, 0x00, 0x8E, 0x6E, 0x24, 0x00, 0x2D, 0x2C, 0x00, 0x8F, 0x6E, 0x24, 0x00, 0x2D,
+	0x29, 0x00, 0x90, 0x6E, 0x24, 0x00, 0x2D, 0x26, 0x00, 0x91, 0x6E, 0x24, 0x00, 0x2D, 0x23, 0x04,
+	0x92, 0xDA, 0x3A, 0xA8, 0x0C, 0x00, 0x35, 0x66, 0x88, 0x02, 0x00, 0x9A, 0x3E, 0x88, 0x02, 0x46,
+	0x2C, 0x00, 0x49, 0x88, 0x00, 0x99, 0x3E, 0x88, 0x02, 0x0D, 0x29, 0x56, 0x88, 0x02, 0x04, 0x9B,
+	0xDA, 0x12, 0xA1, 0x14, 0x22, 0xD6, 0x0C, 0x08, 0x54, 0x65, 0x78, 0x0E, 0x9F, 0x11, 0x42, 0x3B,
+	0x01, 0x04, 0x96, 0xD9, 0x7A, 0x28, 0x00, 0x2D, 0x3F, 0x00, 0x97, 0x7E, 0x28, 0x00, 0x2D, 0x43,
+	0x00, 0x98, 0x7E, 0x28, 0x00, 0x2D, 0x47, 0x00, 0x99, 0x7E, 0x28, 0x00, 0x2D, 0x4B, 0x00, 0x9A,
+	0x4E, 0x28, 0x00, 0x00, 0x31, 0x46, 0xC8, 0x00, 0x00, 0xAF, 0x7E, 0x28, 0x00, 0x0D, 0xC8, 0x00,
+	0xB0, 0x7E, 0x28, 0x00, 0x0D, 0xC8, 0x00, 0xB1, 0x7E, 0x28, 0x00, 0x0D, 0xC8, 0x00, 0xB2, 0x7E,
+	0x28, 0x00, 0x0D, 0xC8, 0x00, 0xB3, 0x4E, 0x28, 0x00, 0x00, 0x32, 0x46, 0xC8, 0x00, 0x00, 0xC8,
+	0x7E, 0x28, 0x00, 0x0D, 0xC8, 0x00, 0xC9, 0x7E, 0x28, 0x00, 0x0D, 0xC8, 0x00, 0xCA, 0x7E, 0x28,
+	0x00, 0x0D, 0xC8, 0x00, 0xCB, 0x7E, 0x28, 0x00, 0x0D, 0xC8, 0x00, 0xCC, 0x4E, 0x28, 0x00, 0x00,
+	0x33, 0x46, 0xC8, 0x00, 0x00, 0xE1, 0x7E, 0x28, 0x00, 0x0D, 0xC8, 0x00, 0xE2, 0x7E, 0x28, 0x00,
+	0x0D, 0xC8, 0x00, 0xE3, 0x7E, 0x28, 0x00, 0x0D, 0xC8, 0x00, 0xE4, 0x7E, 0x28, 0x00, 0x0D, 0xC8,
+	0x00, 0xE5, 0x4E, 0x28, 0x00, 0x00, 0x34, 0x46, 0xC8, 0x00, 0x00, 0xFA, 0x7E, 0x28, 0x00, 0x0D,
+	0xC8, 0x00, 0xFB, 0x7E, 0x28, 0x00, 0x0D, 0xC8, 0x00, 0xFC, 0x7E, 0x28, 0x00, 0x0D, 0xC8, 0x00,
+	0xFD, 0x7E, 0x28, 0x00, 0x0D, 0xC8, 0x00, 0xFE, 0x4E, 0x28, 0x00, 0x00, 0x35, 0x46, 0xC8, 0x00,
+	0x00, 0x93, 0x4E, 0x10, 0x04, 0x2E, 0x28, 0x00, 0x0D, 0xC8, 0x00, 0x94, 0x7E, 0x28, 0x00, 0x0D,
+	0xC8, 0x00, 0x95, 0x7E, 0x28, 0x00, 0x0D, 0xC8, 0x00, 0x96, 0x7E, 0x28, 0x00, 0x0D, 0xC8, 0x00,
+	0x97, 0x16, 0x71, 0x29, 0x85, 0xB0, 0x08, 0x4E, 0x61, 0x6D, 0x0E, 0x8C, 0x14, 0x12, 0xA8, 0x14,
+	0x1E, 0x4B, 0x10, 0x04, 0x9B, 0xD9, 0x12, 0x3B, 0x24, 0x19, 0x20, 0x1A, 0xFF, 0x16, 0x11, 0x20,
+	0x00, 0xB4, 0x3E, 0x20, 0x00, 0x1A, 0x03, 0x17, 0x11, 0x20, 0x00, 0xCD, 0x3E, 0x20, 0x00, 0x1A,
+	0x07, 0x17, 0x11, 0x20, 0x00, 0xE6, 0x3E, 0x20, 0x00, 0x1A, 0x0B, 0x17, 0x11, 0x20, 0x00, 0xFF,
+	0x3E, 0x20, 0x00, 0x1A, 0x0F, 0x17, 0x11, 0x20, 0x00, 0x98, 0xED, 0xF8, 0xAD, 0x67, 0x08, 0x69,
+	0x73, 0x74, 0x12, 0x62, 0x15, 0x0C, 0x2D, 0x4E, 0x6F, 0x6E, 0x0E, 0x67, 0x15, 0x18, 0x99, 0xD7,
+	0x69, 0x12, 0x23, 0x0A, 0x1B, 0x0D, 0x1F, 0x00, 0x70, 0x1E, 0x02, 0x3A, 0x09, 0x24, 0x1E, 0xB8,
+	0x3A, 0x00, 0xA3, 0x16, 0x1C, 0x18, 0x05, 0x25, 0x04, 0x31, 0x2D, 0x19, 0x44, 0x10, 0x42, 0x75,
+	0x6C, 0x6C, 0x65, 0x0E, 0x76, 0x1A, 0x00, 0x9A, 0x16, 0xB6, 0x3A, 0x0D, 0x21, 0x1C, 0x74, 0x6F,
+	0x63, 0x65, 0x6E, 0x74, 0x72, 0x79, 0x05, 0x45, 0x04, 0x12, 0x04, 0x0E, 0xB1, 0x3B, 0x0C, 0x12,
+	0x28, 0x0A, 0x20, 0x09, 0x1E, 0x2A, 0xCD, 0x34, 0x05, 0x20, 0x00, 0x2D, 0xC1, 0x27, 0x0C, 0x69,
+	0x6E, 0x67, 0x20, 0x0E, 0xDC, 0x1A, 0x04, 0xAE, 0xD7, 0x1D, 0x2A, 0x2A, 0xA1, 0x2F, 0x36, 0x2A,
+	0x00, 0x0E, 0x8E, 0x1B, 0x00, 0xAF, 0x2E, 0x2A, 0x00, 0x2A, 0x75, 0x2A, 0x36, 0x2A, 0x00, 0x0E,
+	0xBA, 0x17, 0x00, 0xB0, 0x2E, 0x2A, 0x00, 0x2A, 0x49, 0x25, 0x36, 0x2A, 0x00, 0x0E, 0xE2, 0x16,
+	0x00, 0xB1, 0x3D, 0x0C, 0x00, 0x32, 0x42, 0xE7, 0x00, 0x1C, 0x20, 0x42, 0x69, 0x67, 0x12, 0x04,
+	0x08, 0x9B, 0x1D, 0xEB, 0x00, 0x32, 0x42, 0xEB, 0x00, 0x04, 0xB1, 0xDC, 0x16, 0x47, 0x09, 0x21,
+	0x6E, 0x04, 0x32, 0x30, 0x3E, 0x50, 0x01, 0x0E, 0x0F, 0x14, 0x05, 0xE8, 0x00, 0xB7, 0x1D, 0x94,
+	0x04, 0x32, 0x36, 0x3E, 0x27, 0x00, 0x00, 0x43, 0x16, 0x5D, 0x3C, 0x05, 0xBE, 0x18, 0xBD, 0xD7,
+	0x69, 0x12, 0x2E, 0x0A, 0x26, 0x09, 0x51, 0x00, 0x39, 0x3E, 0x2A, 0x00, 0x21, 0x3C, 0x14, 0x65,
+	0x72, 0x20, 0x26, 0x20, 0x46, 0x12, 0x91, 0x15, 0x0C, 0x12, 0x04, 0x08, 0xC0, 0x16, 0x57, 0x17,
+	0x05, 0x30, 0x00, 0x33, 0x1D, 0xC4, 0x00, 0x49, 0x0E, 0xDE, 0x1B, 0x0C, 0x12, 0x04, 0x08, 0x9C,
+	0x1D, 0xBF, 0x00, 0x33, 0x42, 0xBF, 0x00, 0x04, 0xB2, 0xDC, 0x16, 0x53, 0x0A, 0x01, 0xBF, 0x00,
+	0x33, 0x42, 0xAA, 0x01, 0x01, 0x65, 0x10, 0x6E, 0x6F, 0x74, 0x65, 0x20, 0xE1, 0xB4, 0x24, 0x12,
+	0x04, 0x08, 0xC2, 0xD7, 0x69, 0x12, 0x24, 0x0A, 0x1C, 0x09, 0x2E, 0x42, 0xAE, 0x01, 0x00, 0x4C,
+	0x0E, 0xB5, 0x15, 0x0C, 0x12, 0x04, 0x08, 0xC3, 0x16, 0x65, 0x19, 0x09, 0x26, 0x42, 0xAA, 0x01,
+	0x05, 0x26, 0x0C, 0x20, 0x44, 0x61, 0x72, 0x0E, 0xFD, 0x3C, 0x04, 0xC4, 0xD7, 0x1D, 0x7F, 0x42,
+	0xAB, 0x01, 0x00, 0x54, 0x0E, 0x0B, 0x18, 0x16, 0x4C, 0x3D, 0x25, 0x45, 0x00, 0xC5, 0x2E, 0x2E,
+	0x00, 0x2A, 0xCC, 0x21, 0x29, 0xD9, 0x09, 0x2E, 0x65, 0x06, 0x05, 0x2E, 0x00, 0xC6, 0x2E, 0x2E,
+	0x00, 0x42, 0x73, 0x01, 0x2E, 0x2E, 0x00, 0x41, 0x5F, 0x00, 0xC7, 0x2E, 0x2E, 0x00, 0x00, 0x37,
+	0x3E, 0x77, 0x01, 0x2E, 0x2E, 0x00, 0x41, 0x63, 0x00, 0xC8, 0x2E, 0x2E, 0x00, 0x00, 0x38, 0x6E,
+	0x2E, 0x00, 0x41, 0x67, 0x00, 0xC9, 0x2E, 0x2E, 0x00, 0x42, 0xD3, 0x01, 0x2E, 0x5C, 0x00, 0x0E,
+	0x23, 0x1A, 0x04, 0xCA, 0xD7, 0x12, 0xB2, 0x22, 0x25, 0x3F, 0x00, 0x34, 0x3D, 0xD1, 0x18, 0x4C,
+	0x65, 0x74, 0x74, 0x65, 0x72, 0x65, 0x0E, 0xC7, 0x3D, 0x00, 0x9D, 0x3D, 0xD4, 0x00, 0x34, 0x42,
+	0xD4, 0x01, 0x00, 0xB3, 0x3D, 0xD4, 0x00, 0x34, 0x42, 0x93, 0x02, 0x2E, 0x6F, 0x00, 0x0E, 0x67,
+	0x1A, 0x00, 0xCB, 0x1D, 0x9D, 0x00, 0x34, 0x42, 0x02, 0x02, 0x2E, 0x2E, 0x00, 0x0E, 0xC7, 0x1F,
+	0x00, 0xCC, 0x1D, 0x9D, 0x00, 0x35, 0x1D, 0x9D, 0x0C, 0x4E, 0x75, 0x6D, 0x62, 0x0D, 0x9D, 0x04,
+	0x9E, 0xD7, 0x12, 0x94, 0x23, 0x05, 0xC0, 0x00, 0x36, 0x1D, 0x23, 0x14, 0x48, 0x61, 0x72, 0x76,
+	0x61, 0x72, 0x01, 0xBF, 0x04, 0x9F, 0xD7, 0x16, 0xEA, 0x09, 0x41, 0x75, 0x42, 0x99, 0x01, 0x0C,
+	0x53, 0x75, 0x62, 0x74, 0x1A, 0x3E, 0x3F, 0x04, 0xA9, 0xD7, 0x16, 0xE2, 0x16, 0x01, 0x28, 0x00,
+	0x37, 0x1D, 0x4A, 0x1C, 0x44, 0x61, 0x73, 0x68, 0x12, 0x04, 0x08, 0xA0, 0x5D, 0x8E, 0x00, 0x38,
+	0x1D, 0x1F, 0x00, 0x4E, 0x45, 0xB2, 0x0C, 0x61, 0x6B, 0x69, 0x6E, 0x61, 0xBF, 0x00, 0xA1, 0x39,
+	0x2C, 0x08, 0x62, 0x6F, 0x78, 0x3E, 0xC8, 0x1C, 0x00, 0xE7, 0x8D, 0xE9, 0x08, 0x6F, 0x63, 0x2D,
+	0x85, 0xC2, 0x00, 0x2D, 0x49, 0x4C, 0x26, 0x5F, 0x1F, 0x20, 0xAF, 0xDC, 0x69, 0x20, 0x00, 0x2A,
+	0x0C, 0x0A, 0x04, 0x12, 0x69, 0x1F, 0x00, 0x04, 0x0E, 0x6E, 0x40, 0x18, 0x30, 0x01, 0x3A, 0xE0,
+	0x01, 0x0A, 0x04, 0x92, 0xC1, 0x40, 0x04, 0x94, 0xE0, 0xC5, 0x2D, 0x1C, 0x64, 0x72, 0x6F, 0x70,
+	0x2D, 0x63, 0x61, 0x70, 0x42, 0x5F, 0x00, 0x01, 0x20, 0x08, 0x17, 0x0A, 0x0F, 0x01, 0x20, 0x19,
+	0x1F, 0x0E, 0x95, 0x24, 0x08, 0xA9, 0xDC, 0x69, 0x46, 0x19, 0x00, 0xA1, 0x32, 0x00, 0xAA, 0x4E,
+	0x19, 0x00, 0x41, 0xC2, 0x00, 0xAB, 0x4E, 0x19, 0x00, 0x41, 0xAD, 0x00, 0xAC, 0x4E, 0x19, 0x00,
+	0x41, 0x98, 0x00, 0xAD, 0x4E, 0x19, 0x00, 0x41, 0x83, 0x18, 0xAE, 0xDC, 0x69, 0x42, 0x6D, 0x0A,
+	0x04, 0x26, 0xBB, 0x41, 0x81, 0x92, 0x2A, 0xF1, 0x40, 0x3A, 0x36, 0x06, 0x91, 0xBF, 0x8D, 0x26,
+	0x18, 0xA6, 0xDC, 0x69, 0x12, 0x2F, 0x0A, 0x27, 0x8A, 0x30, 0x00, 0x2D, 0xE8, 0x0C, 0xA5, 0xDC,
+	0x69, 0x16, 0x12, 0x57, 0x41, 0x0C, 0x10, 0x08, 0xE9, 0x0F, 0x16, 0x0B, 0x53, 0x0C, 0xFF, 0x01,
+	0x2A, 0x03, 0x0E, 0x33, 0x42, 0x10, 0xCE, 0x01, 0x0A, 0x2C, 0x12, 0x92, 0x9A, 0x41, 0x04, 0x2A,
+	0x04, 0x0E, 0x4F, 0x53, 0x48, 0x50, 0x0E, 0x5A, 0x9B, 0x01, 0x0A, 0x00, 0x12, 0x56, 0x0A, 0x1D,
+	0x08, 0x01, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x25, 0x01, 0x05, 0x00, 0x2D, 0x01, 0x05, 0x1C, 0x35,
+	0x00, 0x00, 0x80, 0x3F, 0x60, 0x01, 0x6D, 0x01, 0x07, 0x00, 0x15, 0x01, 0x05, 0x08, 0x18, 0x00,
+	0x20, 0x01, 0x1A, 0x18, 0x80, 0x40, 0x32, 0x27, 0x08, 0x02, 0x15, 0x01, 0x23, 0x00, 0x18, 0x09,
+	0x2F, 0x05, 0x34, 0x4E, 0x05, 0x00, 0x00, 0x1D, 0x01, 0x37, 0x04, 0x22, 0x34, 0x82, 0x5D, 0x00,
+	0x28, 0x80, 0x9D, 0x43, 0x1D, 0x00, 0x00, 0xA0, 0x40, 0x20, 0x01, 0x2D, 0x01, 0x32, 0x78, 0x30,
+	0x00, 0x38, 0x00, 0x2A, 0x00, 0x32, 0x00, 0x3A, 0x00, 0x50, 0x0E, 0x5A, 0x2A, 0x08, 0x00, 0x10,
+	0x00, 0x22, 0x04, 0x0A, 0x02, 0x08, 0x01, 0x32, 0x14, 0x0D, 0x00, 0x00, 0x80, 0x40, 0x01, 0x8D,
+	0x00, 0x40, 0x01, 0x5B, 0x04, 0x40, 0x25, 0x01, 0x0F, 0x0C, 0x38, 0x00, 0x52, 0x04, 0x21, 0x45,
+	0x08, 0x58, 0x00, 0x36, 0x01, 0x07, 0x0C, 0x12, 0x30, 0x08, 0xE6, 0x2D, 0x16, 0x2C, 0xF2, 0x02,
+	0x22, 0x08, 0x0A, 0x04, 0x0A, 0x02, 0x0B, 0x2B, 0x18, 0x01, 0x0D, 0x0A, 0x10, 0x2F, 0x18, 0x01,
+	0x22, 0x0A, 0x05, 0x14, 0x00, 0x2E, 0x0E, 0xFE, 0x53, 0x20, 0x2A, 0x03, 0x99, 0xD7, 0x69, 0x0A,
+	0x3E, 0x0A, 0x0E, 0x3A, 0xB7, 0x42, 0x9A, 0xBE, 0x01, 0x2D, 0x45, 0x0C, 0x39, 0x5A, 0xBB, 0x01,
+	0x01, 0xA6, 0x68, 0x1D, 0x00, 0x00, 0x40, 0x41, 0x2A, 0x13, 0x48, 0x65, 0x6C, 0x76, 0x65, 0x74,
+	0x69, 0x63, 0x61, 0x4E, 0x65, 0x75, 0x65, 0x2D, 0x4C, 0x69, 0x67, 0x68, 0x74, 0x3A, 0x76, 0x5F,
+	0x01, 0x28, 0x40, 0x01, 0x50, 0x00, 0x58, 0x00, 0x60, 0x00, 0x68, 0x00, 0x75, 0x21, 0x57, 0x00,
+	0x7D, 0x01, 0x05, 0x28, 0x80, 0x01, 0x01, 0xA0, 0x01, 0x01, 0xB0, 0x01, 0x01, 0xC5, 0x01, 0x21,
+	0x14, 0x10, 0xC8, 0x01, 0x01, 0xDD, 0x01, 0x01, 0x18, 0x0C, 0xE0, 0x01, 0x01, 0xF5, 0x05, 0x12,
+	0x2C, 0xF8, 0x01, 0x00, 0x80, 0x02, 0x00, 0x88, 0x02, 0x01, 0x98, 0x02, 0xFF, 0x11, 0x01, 0x48,
+	0x01, 0xA0, 0x02, 0x01, 0xB0, 0x02, 0x01, 0xC0, 0x02, 0x00, 0xC8, 0x02, 0x00, 0xD8, 0x02, 0x01,
+	0xF2, 0x02, 0x1F, 0x7A, 0x7D, 0x01, 0x44, 0xF8, 0x02, 0x00, 0x62, 0x70, 0x08, 0x02, 0x1A, 0x01,
+	0x2C, 0x25, 0x00, 0x00, 0x10, 0x42, 0x28, 0x01, 0x3D, 0x01, 0x65, 0x18, 0x40, 0x01, 0x48, 0x00,
+	0x50, 0x00, 0x5D, 0x01, 0x0B, 0x24, 0x6A, 0x00, 0x70, 0x00, 0x78, 0x00, 0x8A, 0x01, 0x0A, 0x0D,
+	0x01, 0x0E, 0x25, 0xF7, 0x00, 0x95, 0x05, 0x80, 0x00, 0x9D, 0x05, 0x8F, 0x00, 0xA5, 0x05, 0x06,
+	0x00, 0xAD, 0x05, 0x06, 0x1C, 0xCA, 0x01, 0x00, 0xD0, 0x01, 0x01, 0xD8, 0x01, 0x01, 0x8E, 0x24,
+	0x0F, 0xE0, 0x01, 0x00, 0xF8, 0x01, 0x01, 0xC2, 0x02, 0x04, 0x0E, 0x43, 0x09, 0x3C, 0xC8, 0x02,
+	0x01, 0xD8, 0x02, 0x01, 0xE0, 0x02, 0x00, 0xE8, 0x02, 0x00, 0xF0, 0x02, 0x00, 0x11, 0x01, 0x14,
+	0x0C, 0x12, 0x0B, 0x08, 0xE7, 0x2D, 0xA9, 0x14, 0x91, 0x02, 0x0A, 0x23, 0x0A, 0x04, 0x12, 0x72,
+	0x09, 0x00, 0x15, 0x85, 0xBF, 0x00, 0x30, 0x32, 0xA0, 0x04, 0x04, 0x6E, 0x65, 0x2D, 0x69, 0x08,
+	0x04, 0x58, 0x00, 0x3E, 0x02, 0x00, 0x10, 0x65, 0x00, 0x00, 0x00, 0x80, 0x01, 0x05, 0x05, 0x0A,
+	0x7A, 0x05, 0x00, 0x00, 0x6D, 0x01, 0xC3, 0x00, 0x6D, 0x01, 0xE8, 0x0C, 0x6D, 0x00, 0x00, 0x90,
+	0x01, 0x05, 0x00, 0xD8, 0x01, 0x05, 0x14, 0x10, 0x43, 0x6D, 0x00, 0x00, 0x34, 0x01, 0x05, 0x00,
+	0x58, 0x01, 0x05, 0x00, 0x7C, 0x01, 0x05, 0x0C, 0x90, 0x43, 0x72, 0x0C, 0x41, 0x6E, 0x41, 0xFB,
+	0x0C, 0x00, 0x00, 0x18, 0x01, 0xFE, 0x0E, 0x00, 0xBE, 0x0E, 0x00, 0x00, 0x16, 0x12, 0x0D, 0x45,
+	0x79, 0xE2, 0x0C, 0xFD, 0x01, 0x2A, 0x03, 0x0E, 0x1B, 0x46, 0x10, 0xCC, 0x01, 0x0A, 0x2A, 0x12,
+	0x8A, 0x4E, 0x45, 0x2D, 0x32, 0xFE, 0xE0, 0x03, 0xFE, 0xE0, 0x03, 0xFE, 0xE0, 0x03, 0x71, 0xE0,
+	0x04, 0xA5, 0xDC, 0x65, 0xE0, 0x04, 0xA5, 0xDC, 0x2E, 0xE0, 0x03, 0x00, 0xEB, 0x9A, 0xE0, 0x03,
+	0x08, 0x3D, 0x0A, 0x0C, 0x6D, 0xE0, 0xA9, 0x43, 0x9E, 0x6C, 0x05, 0x2D, 0x44, 0x08, 0x39, 0x5A,
+	0xB5, 0x7D, 0xDF, 0x00, 0x0D, 0x32, 0xDF, 0x03, 0xFE, 0xD9, 0x03, 0xFE, 0xD9, 0x03, 0xFE, 0xD9,
+	0x03, 0xFE, 0xD9, 0x03, 0x3A, 0xD9, 0x03, 0x00, 0x10, 0x12, 0xA0, 0x47, 0x08, 0x0A, 0x08, 0xE5,
+	0x6D, 0xD9, 0x14, 0x2F, 0x0A, 0x27, 0x0A, 0x04, 0x4C, 0x0E, 0xBA, 0x47, 0x66, 0xD5, 0x47, 0x2D,
+	0x66, 0x14, 0x01, 0x5A, 0x02, 0x58, 0x01, 0x10, 0x12, 0xC2, 0x47, 0x19, 0x40, 0x08, 0x24, 0x0A,
+	0x22, 0x8D, 0x18, 0x52, 0xF2, 0x47, 0x09, 0x3B, 0x00, 0x11, 0x12, 0xD7, 0x47, 0x0C, 0x0B, 0x08,
+	0xA2, 0x27, 0xE9, 0x0D, 0x10, 0xF4, 0x02, 0x0A, 0x1E, 0x12, 0x5A, 0x04, 0x48, 0x09, 0x32, 0x10,
+	0x82, 0xF1, 0x04, 0xCB, 0x02, 0x65, 0xDE, 0x00, 0x1A, 0xC9, 0xFA, 0x10, 0x89, 0x2E, 0x39, 0x3F,
+	0x25, 0x01, 0x05, 0x00, 0x2D, 0x01, 0x05, 0x72, 0xFA, 0x06, 0x00, 0x01, 0xA5, 0x03, 0x7E, 0xFA,
+	0x06, 0x18, 0x28, 0x00, 0x30, 0x14, 0x38, 0x13, 0x4D, 0x81, 0x70, 0x00, 0x65, 0xA1, 0xBF, 0x0C,
+	0x72, 0x00, 0x82, 0x01, 0x8A, 0x6B, 0x00, 0x00, 0x00, 0x32, 0x65, 0x07, 0x96, 0x6B, 0x00, 0xA9,
+	0x8E, 0x0C, 0xA2, 0x01, 0x00, 0xB2, 0xFE, 0x62, 0x00, 0x5E, 0x62, 0x00, 0x24, 0xC0, 0x01, 0x01,
+	0xD0, 0x01, 0x00, 0xD8, 0x01, 0x00, 0xE8, 0xC5, 0x73, 0x58, 0x90, 0x02, 0x00, 0xA0, 0x02, 0x02,
+	0xB0, 0x02, 0x14, 0xB8, 0x02, 0x13, 0xC8, 0x02, 0x00, 0xE0, 0x02, 0x01, 0x88, 0xF1, 0x04, 0x01,
+	0x11, 0x12, 0x46, 0x49, 0x08, 0x0B, 0x08, 0x9E, 0x2D, 0x86, 0x10, 0x8F, 0x1C, 0x0A, 0x15, 0x12,
+	0x36, 0x6A, 0x49, 0x35, 0x7D, 0x04, 0xEF, 0x1B, 0x25, 0x7D, 0x14, 0x12, 0xAE, 0x04, 0x0A, 0x07,
+	0x44, 0x1A, 0x9B, 0x29, 0x3C, 0x86, 0x01, 0x0A, 0x0B, 0x46, 0x69, 0x6C, 0x6C, 0x20, 0x43, 0x65,
+	0x6E, 0x74, 0x65, 0x72, 0x12, 0xE1, 0xEC, 0x00, 0x00, 0xC9, 0x70, 0x1E, 0x99, 0x08, 0x08, 0x80,
+	0x3F, 0x1A, 0x01, 0x16, 0xA5, 0x94, 0x08, 0x80, 0x3F, 0x1D, 0x21, 0x58, 0x0E, 0x02, 0x08, 0x04,
+	0x3F, 0x22, 0x52, 0x16, 0x00, 0x10, 0x2D, 0xCD, 0xCC, 0xCC, 0x3E, 0x12, 0x33, 0x08, 0x19, 0x47,
+	0x00, 0x80, 0x01, 0x31, 0x20, 0x00, 0x00, 0x38, 0x01, 0x40, 0x01, 0x4A, 0x16, 0x0A, 0x01, 0x37,
+	0x2C, 0x20, 0x41, 0x15, 0x00, 0x00, 0x70, 0x41, 0x1D, 0x00, 0x00, 0xF0, 0x41, 0x12, 0xC3, 0x08,
+	0x24, 0x12, 0x8A, 0x01, 0x0A, 0x0F, 0x44, 0x69, 0x72, 0x65, 0x63, 0x0E, 0xF8, 0x29, 0x14, 0x61,
+	0x6C, 0x20, 0x4B, 0x65, 0x79, 0xEE, 0x8D, 0x00, 0x0D, 0x8D, 0x0C, 0x00, 0x00, 0x40, 0x3F, 0x66,
+	0x8D, 0x00, 0x00, 0x52, 0x01, 0x8D, 0x34, 0x02, 0xBF, 0x80, 0xBE, 0x15, 0x28, 0xB9, 0x11, 0xBF,
+	0x1D, 0x47, 0x64, 0x48, 0xBF, 0x09, 0x8D, 0x0C, 0x85, 0x01, 0x0A, 0x0A, 0x25, 0x16, 0x00, 0x52,
+	0x0E, 0x47, 0x08, 0xEE, 0x88, 0x00, 0x0D, 0x88, 0x08, 0xCD, 0xCC, 0x4C, 0x86, 0x15, 0x01, 0x04,
+	0xC8, 0x42, 0x45, 0xE5, 0x31, 0x78, 0x18, 0x00, 0x00, 0x12, 0x84, 0x01, 0x0A, 0x09, 0x05, 0x88,
+	0x08, 0x4C, 0x65, 0x66, 0xFE, 0x87, 0x00, 0x09, 0x87, 0x04, 0xCC, 0x3D, 0x66, 0x0F, 0x01, 0x2D,
+	0x9C, 0x04, 0xC8, 0xC2, 0x3A, 0x87, 0x00, 0x28, 0x1A, 0xB7, 0x04, 0x0A, 0x0B, 0x4D, 0x65, 0x64,
+	0x69, 0x75, 0x6D, 0x09, 0x89, 0x01, 0x97, 0x0C, 0x54, 0x6F, 0x70, 0x20, 0x12, 0x65, 0x09, 0x62,
+	0x1E, 0x01, 0x10, 0xD3, 0xD1, 0x52, 0x3F, 0x15, 0x01, 0x05, 0x32, 0x33, 0x02, 0x01, 0x11, 0x3A,
+	0x16, 0x00, 0x41, 0x33, 0x86, 0x97, 0x00, 0x00, 0x40, 0x41, 0x33, 0x04, 0xC8, 0x42, 0x3D, 0x1E,
+	0x0C, 0x8B, 0x01, 0x0A, 0x10, 0x25, 0x1E, 0x49, 0xBC, 0x10, 0x20, 0x48, 0x69, 0x67, 0x68, 0x62,
+	0x8E, 0x00, 0x1C, 0x68, 0xC5, 0x74, 0x3F, 0x15, 0xB4, 0x3C, 0x78, 0x36, 0x8E, 0x00, 0x4A, 0x16,
+	0x00, 0x0C, 0x2D, 0x66, 0x66, 0x66, 0x6A, 0x34, 0x02, 0x2D, 0x25, 0x00, 0x48, 0x21, 0x25, 0x00,
+	0xB4, 0x01, 0x8E, 0x04, 0xC8, 0x42, 0xFE, 0x34, 0x02, 0xFE, 0x34, 0x02, 0x49, 0x34, 0x00, 0x20,
+	0x0D, 0x88, 0x61, 0x49, 0x2E, 0x16, 0x01, 0x08, 0x4C, 0x6F, 0x77, 0x62, 0x15, 0x01, 0x61, 0xCC,
+	0x00, 0x15, 0x01, 0x05, 0x32, 0xA3, 0x01, 0x01, 0x11, 0x3A, 0x16, 0x00, 0x0E, 0x9B, 0x0C, 0x9E,
+	0x15, 0x01, 0x08, 0xC2, 0x1D, 0x00, 0x31, 0x15, 0x20, 0x22, 0xB1, 0x04, 0x0A, 0x0A, 0x53, 0x6F,
+	0x66, 0x74, 0x4D, 0x2B, 0xFE, 0x6E, 0x04, 0xDA, 0x6E, 0x04, 0x00, 0x30, 0x41, 0x3B, 0x00, 0x48,
+	0x2E, 0xAD, 0x01, 0x21, 0x25, 0xFE, 0x6E, 0x04, 0x4E, 0x6E, 0x04, 0x00, 0x80, 0x9E, 0x25, 0x01,
+	0x2E, 0x8D, 0x00, 0xFE, 0x6E, 0x04, 0x4A, 0x6E, 0x04, 0x8A, 0x83, 0x05, 0xFE, 0x6E, 0x04, 0xFE,
+	0x6E, 0x04, 0x5E, 0x6E, 0x04, 0x00, 0x2A, 0xFE, 0x34, 0x02, 0xFE, 0x34, 0x02, 0xFE, 0x34, 0x02,
+	0xFE, 0x34, 0x02, 0xFE, 0x34, 0x02, 0xFE, 0x34, 0x02, 0xFE, 0x34, 0x02, 0xFE, 0x34, 0x02, 0xCA,
+	0x34, 0x02, 0x00, 0x32, 0xFE, 0xD3, 0x08, 0xFE, 0xD3, 0x08, 0xFE, 0xD3, 0x08, 0xFE, 0xD3, 0x08,
+	0xFE, 0xD3, 0x08, 0xFE, 0xD3, 0x08, 0xFE, 0xD3, 0x08, 0xFE, 0xD3, 0x08, 0xBE, 0xD3, 0x08, 0x10,
+	0x3A, 0xD4, 0x04, 0x0A, 0x0D, 0x1A, 0xD3, 0x08, 0x16, 0x3E, 0x08, 0xFE, 0x9C, 0x06, 0x4A, 0x9C,
+	0x06, 0x08, 0x9A, 0x99, 0x99, 0x86, 0xF5, 0x09, 0x08, 0x40, 0xC1, 0x15, 0x0E, 0xC0, 0x12, 0x2A,
+	0x0A, 0x0B, 0x00, 0xAA, 0xFE, 0x0A, 0x0B, 0x52, 0x0A, 0x0B, 0x76, 0xD6, 0x08, 0x3C, 0x5A, 0x36,
+	0x0A, 0x14, 0x0D, 0x01, 0x01, 0xF0, 0x41, 0x15, 0x91, 0x00, 0x20, 0x42, 0x1D, 0xF4, 0x22, 0x97,
+	0x0B, 0x38, 0x14, 0x0D, 0x31, 0x5C, 0xC6, 0x3E, 0x15, 0x26, 0x28, 0x14, 0xBF, 0x1D, 0x6B, 0xB5,
+	0x37, 0x16, 0x20, 0x0B, 0x0C, 0x1D, 0xCD, 0xCC, 0x4C, 0x0E, 0x06, 0x14, 0x04, 0x00, 0x00, 0xC5,
+	0xBC, 0x0C, 0x45, 0x64, 0x67, 0x65, 0x7A, 0x2A, 0x0B, 0x08, 0xE6, 0x0E, 0x66, 0x1E, 0x53, 0x08,
+	0x04, 0xF8, 0x7F, 0x0E, 0x0E, 0x0C, 0x12, 0x3F, 0x0C, 0x4A, 0x16, 0x00, 0x96, 0x2A, 0x0B, 0x00,
+	0x48, 0x0E, 0x2A, 0x0B, 0x00, 0xA0, 0x21, 0x35, 0x1A, 0x3B, 0x15, 0x12, 0x93, 0x0A, 0x05, 0x88,
+	0x72, 0x2A, 0x0B, 0x4A, 0x71, 0x00, 0x04, 0x22, 0x14, 0x4E, 0x16, 0x00, 0x9A, 0x87, 0x00, 0x0E,
+	0x05, 0x0A, 0x2E, 0x87, 0x00, 0x00, 0x55, 0x0E, 0x3B, 0x09, 0x08, 0x5A, 0x00, 0x62, 0x16, 0x74,
+	0x0E, 0x0E, 0x87, 0x0E, 0x12, 0x1C, 0x0A, 0x0E, 0x3E, 0x09, 0x76, 0xD9, 0x15, 0x96, 0x74, 0x0E,
+	0x08, 0x68, 0x00, 0x72, 0x0E, 0xA6, 0x14, 0x20, 0x80, 0x3F, 0x85, 0x01, 0x00, 0x00, 0x20, 0x41,
+	0x8D, 0x01, 0x06, 0x5C, 0x42, 0x90, 0x01, 0x00, 0xA0, 0x01, 0x0D, 0xA8, 0x01, 0x0C, 0xF0, 0x01,
+	0x0D, 0xF8, 0x01, 0x00, 0x85, 0x02, 0x00, 0x00, 0xC0, 0x40, 0xD5, 0x07, 0x01, 0x7D, 0x0E, 0x21,
+	0x0E, 0x00, 0x10, 0x12, 0x4F, 0x57, 0x08, 0x0A, 0x08, 0xA0, 0x1A, 0x21, 0x0E, 0x0C, 0x7D, 0x0A,
+	0x16, 0x12, 0x3A, 0x73, 0x57, 0x22, 0x21, 0x0E, 0x10, 0x61, 0x0A, 0x00, 0x10, 0x11, 0x12, 0x0B,
+	0x0A, 0x00, 0x2A, 0xC2, 0xC2, 0x00, 0x96, 0x9B, 0x16, 0x00, 0x31, 0x12, 0xBB, 0x57, 0x00, 0x2B,
+	0x22, 0x2C, 0x16, 0x00, 0xCA, 0x82, 0x4C, 0x12, 0x08, 0x0A, 0x20, 0x12, 0x62, 0x0A, 0x58, 0x09,
+	0xB9, 0x86, 0x2A, 0x12, 0x24, 0xC7, 0xFF, 0x7F, 0x3F, 0x25, 0xFF, 0xFF, 0x7F, 0x3F, 0x2D, 0x01,
+	0x05, 0x2E, 0x68, 0x10, 0xFE, 0x03, 0x16, 0x82, 0x03, 0x16, 0x66, 0x7B, 0x00, 0x0E, 0x03, 0x16,
+	0x00, 0x6C, 0x0E, 0x03, 0x16, 0x00, 0x2E, 0xFE, 0x03, 0x16, 0x52, 0x03, 0x16, 0x08, 0xB8, 0x02,
+	0x01, 0x12, 0xFF, 0x15, 0x00, 0x00, 0x22, 0xFF, 0x15, 0x00, 0x31, 0x12, 0x15, 0x59, 0xFE, 0x7C,
+	0x01, 0x2D, 0x7C, 0x00, 0x31, 0xFE, 0x7C, 0x01, 0xFE, 0x7C, 0x01, 0xFE, 0x7C, 0x01, 0xFE, 0x7C,
+	0x01, 0xBE, 0x7C, 0x01, 0x0E, 0x6E, 0x5A, 0x39, 0x7C, 0x00, 0xCB, 0x86, 0xF8, 0x02, 0x00, 0x21,
+	0x16, 0xBD, 0x13, 0x0E, 0x86, 0x26, 0x22, 0xCA, 0x1A, 0x12, 0x38, 0x1E, 0x04, 0x5F, 0x31, 0xA2,
+	0xF9, 0x02, 0x81, 0x05, 0x56, 0x82, 0x04, 0xFE, 0xF9, 0x02, 0x82, 0xF9, 0x02, 0x66, 0x7B, 0x00,
+	0xFE, 0xF9, 0x02, 0xCA, 0xF9, 0x02, 0x0E, 0xC8, 0x5B, 0xFE, 0x7D, 0x01, 0x31, 0x7D, 0xA2, 0xFA,
+	0x02, 0x66, 0x02, 0x01, 0xFE, 0x7D, 0x01, 0xFE, 0x7D, 0x01, 0xFE, 0x7D, 0x01, 0xB6, 0x7D, 0x01,
+	0x08, 0xB5, 0xDA, 0x69, 0xFE, 0x7D, 0x01, 0x35, 0x7D, 0x00, 0x32, 0x46, 0x77, 0x04, 0x04, 0xF0,
+	0x41, 0xFE, 0x1D, 0x18, 0xFE, 0x1D, 0x18, 0xB2, 0x1D, 0x18, 0xFE, 0xF3, 0x05, 0xBA, 0xF3, 0x05,
+	0x00, 0xB6, 0xFE, 0x7D, 0x01, 0x3D, 0x7D, 0x00, 0x33, 0x46, 0x7D, 0x01, 0x00, 0x40, 0xFE, 0x7D,
+	0x01, 0xFE, 0x7D, 0x01, 0xFE, 0x7D, 0x01, 0xFE, 0x7D, 0x01, 0x72, 0x7D, 0x01, 0x00, 0xB7, 0xFE,
+	0x7D, 0x01, 0x3D, 0x7D, 0x00, 0x34, 0xFE, 0x7D, 0x01, 0xFE, 0x7D, 0x01, 0xFE, 0x7D, 0x01, 0xFE,
+	0x7D, 0x01, 0xBE, 0x7D, 0x01, 0x00, 0xB8, 0xFE, 0x7D, 0x01, 0x3D, 0x7D, 0x00, 0x35, 0x46, 0x7D,
+	0x01, 0x00, 0x20, 0xFE, 0xFA, 0x02, 0xFE, 0xFA, 0x02, 0xFE, 0xFA, 0x02, 0xFE, 0xFA, 0x02, 0x72,
+	0xFA, 0x02, 0x00, 0xB9, 0xFE, 0x7D, 0x01, 0x3D, 0x7D, 0x00, 0x36, 0x46, 0x7D, 0x01, 0x56, 0x77,
+	0x04, 0x04, 0x09, 0xFA, 0x1A, 0x5B, 0x0E, 0x0C, 0x2D, 0x03, 0xF8, 0x7F, 0xFE, 0xE7, 0x0B, 0xB6,
+	0xE7, 0x0B, 0x66, 0x7B, 0x00, 0xFE, 0xEE, 0x08, 0xCA, 0xEE, 0x08, 0x00, 0xBA, 0xFE, 0x7D, 0x01,
+	0x3D, 0x7D, 0x00, 0x37, 0x46, 0x7D, 0x01, 0xFE, 0xFA, 0x02, 0xFE, 0xFA, 0x02, 0xFE, 0xFA, 0x02,
+	0xFE, 0xFA, 0x02, 0x76, 0xFA, 0x02, 0x00, 0xBB, 0xFE, 0x7D, 0x01, 0x3D, 0x7D, 0x00, 0x38, 0x46,
+	0x7D, 0x01, 0x56, 0xFA, 0x02, 0xFE, 0x6B, 0x0A, 0xFE, 0x6B, 0x0A, 0xFE, 0x6B, 0x0A, 0xFE, 0x6B,
+	0x0A, 0x1E, 0x6B, 0x0A, 0x00, 0xBC, 0xFE, 0x7D, 0x01, 0x3D, 0x7D, 0x00, 0x39, 0x46, 0x7D, 0x01,
+	0x04, 0x00, 0x42, 0xFE, 0x6B, 0x0A, 0xFE, 0x6B, 0x0A, 0xFE, 0x6B, 0x0A, 0xFE, 0x6B, 0x0A, 0x6E,
+	0x6B, 0x0A, 0x0E, 0xF3, 0x67, 0x26, 0x65, 0x0D, 0xF2, 0xDA, 0x11, 0x4A, 0xE7, 0x0B, 0x56, 0xF9,
+	0x02, 0x00, 0x05, 0xB5, 0xF3, 0x00, 0x01, 0xFE, 0xF3, 0x05, 0xBE, 0xF3, 0x05, 0x66, 0x7B, 0x00,
+	0xFE, 0xF3, 0x05, 0xCA, 0xF3, 0x05, 0x0E, 0x4C, 0x69, 0x39, 0x7C, 0xF2, 0x5E, 0x10, 0x00, 0x32,
+	0x4A, 0x5E, 0x10, 0xFE, 0xF3, 0x05, 0xFE, 0xF3, 0x05, 0xFE, 0xF3, 0x05, 0xFE, 0xF3, 0x05, 0x76,
+	0xF3, 0x05, 0x0E, 0xA6, 0x6A, 0xFE, 0x7D, 0x01, 0x31, 0x7D, 0x4A, 0x5E, 0x10, 0xFE, 0x7D, 0x01,
+	0xFE, 0x7D, 0x01, 0xFE, 0x7D, 0x01, 0xFE, 0x7D, 0x01, 0x76, 0x7D, 0x01, 0x0E, 0x00, 0x6C, 0xFE,
+	0x7D, 0x01, 0x31, 0x7D, 0x4A, 0x77, 0x04, 0xFE, 0x5E, 0x10, 0xFE, 0x5E, 0x10, 0xFE, 0x5E, 0x10,
+	0xFE, 0x5E, 0x10, 0x76, 0x5E, 0x10, 0x0E, 0x5A, 0x6D, 0xFE, 0x7D, 0x01, 0x31, 0x7D, 0x4A, 0x5E,
+	0x10, 0xFE, 0xFA, 0x02, 0xFE, 0xFA, 0x02, 0xFE, 0xFA, 0x02, 0xFE, 0xFA, 0x02, 0x76, 0xFA, 0x02,
+	0x0E, 0xB4, 0x6E, 0xFE, 0x7D, 0x01, 0x31, 0x7D, 0x4A, 0x5E, 0x10, 0xFE, 0x7D, 0x01, 0xFE, 0x7D,
+	0x01, 0xFE, 0x7D, 0x01, 0xFE, 0x7D, 0x01, 0x76, 0x7D, 0x01, 0x0E, 0x0E, 0x70, 0xFE, 0x7D, 0x01,
+	0x31, 0x7D, 0xFE, 0x5E, 0x10, 0xFE, 0x5E, 0x10, 0xFE, 0x5E, 0x10, 0xFE, 0x5E, 0x10, 0xC2, 0x5E,
+	0x10, 0x0E, 0x68, 0x71, 0xFE, 0x7D, 0x01, 0x31, 0x7D, 0xFE, 0x5E, 0x10, 0xFE, 0x5E, 0x10, 0xFE,
+	0x5E, 0x10, 0xFE, 0x5E, 0x10, 0xC2, 0x5E, 0x10, 0x0E, 0xC2, 0x72, 0xFE, 0x7D, 0x01, 0x31, 0x7D,
+	0x4A, 0x5E, 0x10, 0x56, 0xE8, 0x0B, 0x66, 0x47, 0x1D, 0xFE, 0x4C, 0x19, 0x82, 0x4C, 0x19, 0x66,
+	0x7B, 0x00, 0xFE, 0xE8, 0x0B, 0xCA, 0xE8, 0x0B, 0x0E, 0x1C, 0x74, 0xFE, 0x7D, 0x01, 0x31, 0x7D,
+	0x4A, 0x5E, 0x10, 0xFE, 0xF4, 0x05, 0xFE, 0xF4, 0x05, 0xFE, 0xF4, 0x05, 0xFE, 0xF4, 0x05, 0x76,
+	0xF4, 0x05, 0x0E, 0x76, 0x75, 0xFE, 0x7D, 0x01, 0x31, 0x7D, 0x4A, 0x5E, 0x10, 0xFE, 0x7D, 0x01,
+	0xFE, 0x7D, 0x01, 0xFE, 0x7D, 0x01, 0xFE, 0x7D, 0x01, 0x76, 0x7D, 0x01, 0x0E, 0xD1, 0x76, 0x39,
+	0x7D, 0xF2, 0x5E, 0x10, 0x4A, 0x6A, 0x0A, 0x56, 0x76, 0x04, 0xFE, 0x57, 0x13, 0xFE, 0x57, 0x13,
+	0xFE, 0x57, 0x13, 0xFE, 0x57, 0x13, 0x1E, 0x57, 0x13, 0x0E, 0x2B, 0x78, 0xFE, 0x7C, 0x01, 0x2D,
+	0x7C, 0x4A, 0x69, 0x0A, 0x56, 0x7C, 0x01, 0x66, 0x5F, 0x11, 0xFE, 0xF2, 0x05, 0x82, 0xF2, 0x05,
+	0x66, 0x7B, 0x00, 0xFE, 0xF2, 0x05, 0xCA, 0xF2, 0x05, 0x0E, 0x85, 0x79, 0xFE, 0x7C, 0x01, 0x2D,
+	0x7C, 0x4A, 0x68, 0x0A, 0x56, 0x7C, 0x01, 0xFE, 0xF8, 0x02, 0xFE, 0xF8, 0x02, 0xFE, 0xF8, 0x02,
+	0xFE, 0xF8, 0x02, 0x51, 0xF8, 0x00, 0xAF, 0x32, 0x4F, 0x16, 0xF2, 0x74, 0x04, 0xA2, 0x67, 0x0A,
+	0x66, 0x6F, 0x08, 0xFE, 0xF8, 0x02, 0x82, 0xF8, 0x02, 0x66, 0x7B, 0x00, 0xFE, 0xF8, 0x02, 0xCA,
+	0xF8, 0x02, 0x0E, 0x39, 0x7C, 0xFE, 0xF8, 0x02, 0x4D, 0xF8, 0xA2, 0x66, 0x0A, 0x66, 0xF9, 0x03,
+	0xFE, 0x7C, 0x01, 0x82, 0x7C, 0x01, 0x66, 0x7B, 0x00, 0xFE, 0x7C, 0x01, 0xCA, 0x7C, 0x01, 0x0E,
+	0x93, 0x7D, 0xFE, 0x7C, 0x01, 0x2D, 0x7C, 0x4A, 0x65, 0x0A, 0xFE, 0x74, 0x04, 0xFE, 0x74, 0x04,
+	0xFE, 0x74, 0x04, 0xFE, 0x74, 0x04, 0x76, 0x74, 0x04, 0x0E, 0xED, 0x7E, 0xFE, 0x7C, 0x01, 0x2D,
+	0x7C, 0x4A, 0x64, 0x0A, 0x56, 0x7C, 0x01, 0x66, 0x7D, 0x02, 0xFE, 0xF8, 0x02, 0xFE, 0xF8, 0x02,
+	0xFE, 0xF8, 0x02, 0xAE, 0xF8, 0x02, 0x04, 0x11, 0x08, 0x0E, 0x48, 0x80, 0x08, 0x0B, 0x08, 0xA6,
+	0x1A, 0x2A, 0x2D, 0x10, 0x83, 0x01, 0x0A, 0x1F, 0x12, 0x5E, 0x76, 0x80, 0x16, 0x1D, 0x1C, 0x10,
+	0x82, 0xF1, 0x04, 0x5E, 0x0A, 0x8A, 0x2B, 0x2D, 0x04, 0xE0, 0x3F, 0x2E, 0xC6, 0x43, 0x96, 0xED,
+	0x2D, 0x18, 0x12, 0x00, 0x18, 0x0F, 0x20, 0x0F, 0x11, 0x12, 0xC3, 0x80, 0x08, 0x0B, 0x08, 0xA4,
+	0x0D, 0x95, 0x10, 0x88, 0x19, 0x0A, 0x18, 0x12, 0x42, 0xEA, 0x80, 0x15, 0x8E, 0x28, 0xE1, 0x18,
+	0x0A, 0x36, 0x0A, 0x20, 0x0A, 0x0E, 0x08, 0x01, 0x12, 0x2A, 0x3A, 0x42, 0x0C, 0x0A, 0x0E, 0x08,
+	0x02, 0x05, 0x10, 0x00, 0xC0, 0x0E, 0xC6, 0x43, 0x10, 0x00, 0x00, 0x10, 0x00, 0x1A, 0x01, 0x1E,
+	0x20, 0x40, 0x40, 0x15, 0xCD, 0xCC, 0x4C, 0xBF, 0x2A, 0x04, 0x0E, 0xA8, 0x64, 0x00, 0x12, 0xDA,
+	0x38, 0x00, 0x08, 0x1A, 0x00, 0x22, 0x8A, 0x01, 0x01, 0x00, 0x80, 0xCA, 0x01, 0x01, 0xC6, 0x84,
+	0x2E, 0x96, 0x59, 0x01, 0x00, 0x32, 0x16, 0x9D, 0x43, 0x1C, 0x03, 0xAC, 0x27, 0x3A, 0x25, 0xD1,
+	0x33, 0x22, 0x0E, 0xDC, 0x38, 0x00, 0x80, 0x32, 0x2E, 0x22, 0x00, 0x3A, 0x7E, 0x21, 0x00, 0x00,
+	0x42, 0x7E, 0x21, 0x00, 0x00, 0x4A, 0x7E, 0x21, 0x00, 0x00, 0x52, 0x7E, 0x21, 0x00, 0x00, 0x5A,
+	0x7E, 0x21, 0x00, 0x00, 0x62, 0x7E, 0x21, 0x00, 0x00, 0x6A, 0x7E, 0x21, 0x00, 0x00, 0x72, 0x7E,
+	0x21, 0x00, 0x00, 0x7A, 0x7E, 0x21, 0x00, 0x04, 0x82, 0x01, 0x7E, 0x22, 0x00, 0x00, 0x8A, 0x82,
+	0x22, 0x00, 0x44, 0x90, 0x01, 0x01, 0x98, 0x01, 0x10, 0xA0, 0x01, 0x04, 0xA8, 0x01, 0x05, 0xB0,
+	0x01, 0x00, 0xB8, 0x01, 0x02, 0x22, 0x7A, 0x45, 0x34, 0xD0, 0x01, 0x03, 0xD8, 0x01, 0x0E, 0xE0,
+	0x01, 0x06, 0xE8, 0x01, 0x08, 0xF2, 0x01, 0x86, 0xD0, 0x46, 0x04, 0x00, 0x02, 0x0E, 0xD0, 0x46,
+	0x0C, 0x80, 0x3F, 0x20, 0x0A, 0x0E, 0x71, 0x31, 0x14, 0x3F, 0x30, 0x01, 0x38, 0x00, 0xFA, 0xA2,
+	0x37, 0x00, 0x04, 0x00, 0x00, 0x1D, 0x37, 0x04, 0x82, 0x02, 0x9E, 0x6E, 0x00, 0x32, 0x37, 0x00,
+	0x00, 0x8A, 0xA2, 0x37, 0x00, 0x0C, 0x40, 0x40, 0x20, 0x05, 0x15, 0xA5, 0x00, 0x92, 0x8E, 0x37,
+	0x00, 0x00, 0xF4, 0x0E, 0x32, 0x3A, 0x05, 0x6E, 0x08, 0xCD, 0xCC, 0x0C, 0x05, 0xDC, 0x70, 0x9A,
+	0x02, 0x00, 0xA2, 0x02, 0x00, 0xAA, 0x02, 0x00, 0xBA, 0x02, 0x00, 0xC2, 0x02, 0x00, 0xCA, 0x02,
+	0x00, 0xD2, 0x02, 0x00, 0xDA, 0x02, 0x00, 0xE2, 0x02, 0x00, 0xEA, 0x02, 0x69, 0x94, 0x30, 0xE1,
+	0x92, 0x12, 0x3F, 0x25, 0x24, 0x82, 0x12, 0x3F, 0x2D, 0x6E, 0x82, 0x12, 0x32, 0xE4, 0x02, 0x0E,
+	0x75, 0x34, 0x00, 0x40, 0x2E, 0x95, 0x04, 0x96, 0xC0, 0x31, 0x00, 0xF2, 0x0D, 0x59, 0x66, 0x22,
+	0x0C, 0x12, 0x39, 0x3C, 0xC6, 0x59, 0x00, 0x00, 0xFA, 0x0D, 0x59, 0x66, 0x96, 0x03, 0x42, 0x59,
+	0x00, 0x96, 0xEE, 0x03, 0x04, 0x82, 0x03, 0x29, 0x0B, 0x76, 0x59, 0x00, 0x32, 0x0B, 0x01, 0x96,
+	0x59, 0x00, 0x00, 0x8A, 0x0D, 0x59, 0x14, 0xB3, 0x82, 0x12, 0x3F, 0x25, 0xB2, 0x21, 0x64, 0x00,
+	0xB1, 0xFE, 0x64, 0x01, 0x29, 0x64, 0x00, 0x92, 0x0D, 0x59, 0x76, 0xB2, 0x00, 0x32, 0x64, 0x01,
+	0x96, 0xB2, 0x00, 0x00, 0x9A, 0x92, 0x59, 0x00, 0xCA, 0x0B, 0x01, 0x00, 0xA2, 0x0D, 0x59, 0xFE,
+	0x16, 0x02, 0x42, 0x16, 0x02, 0x00, 0xAA, 0x0D, 0x59, 0x72, 0x0B, 0x01, 0x36, 0xC8, 0x02, 0x96,
+	0x0B, 0x01, 0x04, 0xB2, 0x03, 0x89, 0xBA, 0x66, 0xFA, 0x08, 0x00, 0xBA, 0x0D, 0x22, 0x66, 0x7B,
+	0x00, 0x00, 0xC2, 0x0D, 0x22, 0x00, 0x81, 0x22, 0x84, 0x22, 0x00, 0x75, 0x3A, 0x84, 0x22, 0x00,
+	0xCA, 0x0D, 0x22, 0x66, 0x66, 0x00, 0x00, 0xD2, 0x82, 0x22, 0x00, 0x90, 0xDA, 0x03, 0x00, 0xE0,
+	0x03, 0x01, 0xE8, 0x03, 0x00, 0xF0, 0x03, 0x01, 0x80, 0x04, 0x00, 0x88, 0x04, 0x00, 0x90, 0x04,
+	0x00, 0x98, 0x04, 0x00, 0xA0, 0x04, 0x00, 0xA8, 0x04, 0x01, 0xB5, 0x04, 0xFF, 0xFF, 0x7F, 0x7F,
+	0xBD, 0x05, 0x06, 0x00, 0xC5, 0x05, 0x06, 0x00, 0xCD, 0x05, 0x06, 0x00, 0xD5, 0x05, 0x06, 0x04,
+	0xDA, 0x04, 0x49, 0xFC, 0xAA, 0xA3, 0x02, 0x96, 0x3F, 0x01, 0x00, 0xE2, 0x0D, 0x59, 0x66, 0x1D,
+	0x01, 0xDA, 0xAE, 0x03, 0x00, 0xEA, 0x92, 0x59, 0x00, 0xCA, 0xA3, 0x02, 0x00, 0xF2, 0x0D, 0x59,
+	0xFE, 0x0B, 0x01, 0x42, 0x0B, 0x01, 0x00, 0xFA, 0x0D, 0x59, 0x76, 0x0B, 0x01, 0xCA, 0xB2, 0x00,
+	0x04, 0x82, 0x05, 0x29, 0xBD, 0x72, 0x59, 0x00, 0xCE, 0xFC, 0x02, 0x04, 0x8D, 0x05, 0x0E, 0xA6,
+	0x38, 0x0C, 0x90, 0x05, 0x15, 0x9D, 0x05, 0x09, 0x10, 0xA0, 0x05, 0x19, 0xAA, 0x05, 0x8A, 0xEF,
+	0x06, 0xC9, 0x81, 0x1A, 0x2D, 0x4E, 0x00, 0x3E, 0xE1, 0x5D, 0x00, 0xB2, 0x0D, 0xA2, 0x1C, 0x79,
+	0x74, 0x4D, 0x3E, 0x25, 0x54, 0xF9, 0x34, 0x46, 0x4A, 0x09, 0x0E, 0x49, 0x44, 0xCA, 0xFB, 0x00,
+	0xA0, 0xB8, 0x05, 0x08, 0xC0, 0x05, 0x06, 0xD0, 0x05, 0x05, 0xD8, 0x05, 0x08, 0xE0, 0x05, 0x08,
+	0xE8, 0x05, 0x04, 0xF0, 0x05, 0x08, 0xF8, 0x05, 0x08, 0x80, 0x06, 0x08, 0x88, 0x06, 0x04, 0x90,
+	0x06, 0x00, 0x98, 0x06, 0x00, 0xA0, 0x06, 0x00, 0x82, 0x08, 0x29, 0x22, 0x72, 0x77, 0x04, 0xCE,
+	0xDC, 0x47, 0x1C, 0xC0, 0x09, 0x09, 0xC8, 0x09, 0x0A, 0xAA, 0x0A, 0x89, 0x24, 0x66, 0x81, 0x01,
+	0x24, 0xB8, 0x0A, 0x05, 0xC0, 0x0A, 0x05, 0xCA, 0x0A, 0x00, 0xE2, 0x1A, 0x05, 0x0C, 0x66, 0x2B,
+	0x00, 0x61, 0x10, 0xCA, 0x0A, 0x01, 0x00, 0xFA, 0x0D, 0x84, 0x66, 0x64, 0x04, 0x1C, 0x88, 0x0B,
+	0x00, 0x98, 0x0B, 0x00, 0xAD, 0x0B, 0x81, 0x08, 0x04, 0xBA, 0x0B, 0x29, 0x11, 0xFE, 0x87, 0x00,
+	0x42, 0x87, 0x00, 0x2C, 0xC8, 0x0B, 0x08, 0xE0, 0x0B, 0x01, 0xED, 0x0B, 0x9A, 0x99, 0x19, 0x3E,
+	0x0E, 0x55, 0x3A, 0x00, 0x90, 0x12, 0x7A, 0x48, 0x04, 0xA3, 0xDA, 0x0E, 0x4E, 0x4E, 0x72, 0x9A,
+	0x0C, 0x1A, 0xCF, 0x24, 0x04, 0x82, 0xF1, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C,
+	0xFE, 0x9A, 0x0C, 0xAE, 0x9A, 0x0C, 0x34, 0xCB, 0xC3, 0xC1, 0x3E, 0x25, 0x53, 0x27, 0x59, 0x3F,
+	0x2D, 0x48, 0x27, 0x59, 0x3E, 0x2E, 0xAF, 0x3A, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A,
+	0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00,
+	0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66,
+	0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1E, 0x9A,
+	0x0C, 0x66, 0x22, 0x00, 0x00, 0x8A, 0x1A, 0x9A, 0x0C, 0x66, 0x22, 0x00, 0x1E, 0x9A, 0x0C, 0x00,
+	0x07, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C,
+	0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0x16, 0x9A, 0x0C, 0x66, 0x29, 0x02, 0xA1,
+	0xDC, 0xCA, 0x8F, 0x0B, 0x1E, 0x9A, 0x0C, 0x76, 0x59, 0x00, 0xCA, 0x35, 0x06, 0xFE, 0x9A, 0x0C,
+	0x82, 0x9A, 0x0C, 0x76, 0xB2, 0x00, 0xCA, 0x0B, 0x01, 0x1E, 0x9A, 0x0C, 0x76, 0x59, 0x00, 0xCA,
+	0x0B, 0x01, 0xFE, 0x9A, 0x0C, 0x82, 0x9A, 0x0C, 0x72, 0xB2, 0x00, 0xCE, 0x9E, 0x09, 0xA6, 0x9A,
+	0x0C, 0x66, 0x7B, 0x00, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xEE, 0x9A, 0x0C,
+	0x1A, 0x9A, 0x0C, 0x66, 0x1D, 0x01, 0xDA, 0xAE, 0x03, 0x1E, 0x9A, 0x0C, 0x76, 0x59, 0x00, 0xCA,
+	0xA3, 0x02, 0xFE, 0x9A, 0x0C, 0x82, 0x9A, 0x0C, 0xFE, 0xB2, 0x00, 0x42, 0xB2, 0x00, 0x1E, 0x9A,
+	0x0C, 0x72, 0x59, 0x00, 0xCE, 0xFC, 0x02, 0xFE, 0x9A, 0x0C, 0x42, 0x9A, 0x0C, 0x0C, 0x5E, 0x6D,
+	0xE4, 0x3E, 0x12, 0xAC, 0x52, 0x0C, 0x2D, 0xF3, 0xFF, 0x7F, 0x32, 0x4A, 0x09, 0xFE, 0x9A, 0x0C,
+	0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0x12, 0x9A, 0x0C, 0x66, 0x81, 0x01, 0x42, 0x9A, 0x0C, 0x66,
+	0x2B, 0x00, 0x61, 0x10, 0xCA, 0xB7, 0x02, 0xD6, 0x9A, 0x0C, 0xFE, 0x87, 0x00, 0x42, 0x87, 0x00,
+	0x56, 0x9A, 0x0C, 0x0E, 0xC3, 0x99, 0x7A, 0x34, 0x19, 0x1A, 0xEC, 0x2F, 0xFE, 0x9A, 0x0C, 0xFE,
+	0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xB6, 0x9A, 0x0C, 0x66, 0x3E, 0x11, 0x1A, 0x9A,
+	0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00,
+	0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66,
+	0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A,
+	0x0C, 0x66, 0x21, 0x00, 0x1E, 0x9A, 0x0C, 0x66, 0x22, 0x00, 0x1E, 0x9A, 0x0C, 0x66, 0x22, 0x00,
+	0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE,
+	0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0x3A, 0x9A, 0x0C, 0x66, 0x29, 0x02, 0xA1, 0xDC,
+	0xCA, 0x8F, 0x0B, 0x1E, 0x9A, 0x0C, 0x76, 0x59, 0x00, 0xCA, 0x35, 0x06, 0xFE, 0x9A, 0x0C, 0x82,
+	0x9A, 0x0C, 0x76, 0xB2, 0x00, 0xCA, 0x0B, 0x01, 0x1E, 0x9A, 0x0C, 0x76, 0x59, 0x00, 0xCA, 0x0B,
+	0x01, 0xFE, 0x9A, 0x0C, 0x82, 0x9A, 0x0C, 0x72, 0xB2, 0x00, 0xCE, 0x9E, 0x09, 0xA6, 0x9A, 0x0C,
+	0x66, 0x7B, 0x00, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xEE, 0x9A, 0x0C, 0x1A,
+	0x9A, 0x0C, 0x66, 0x1D, 0x01, 0xDA, 0xAE, 0x03, 0x1E, 0x9A, 0x0C, 0x76, 0x59, 0x00, 0xCA, 0xA3,
+	0x02, 0xFE, 0x9A, 0x0C, 0x82, 0x9A, 0x0C, 0xFE, 0xB2, 0x00, 0x42, 0xB2, 0x00, 0x1E, 0x9A, 0x0C,
+	0x72, 0x59, 0x00, 0xCE, 0xFC, 0x02, 0xFE, 0x9A, 0x0C, 0x42, 0x9A, 0x0C, 0x30, 0xE6, 0xB5, 0x45,
+	0x3F, 0x25, 0xE5, 0xB5, 0x45, 0x3F, 0x2D, 0xE4, 0xB5, 0x45, 0x3E, 0x9A, 0x1F, 0xFE, 0x34, 0x19,
+	0xFE, 0x34, 0x19, 0xEE, 0x34, 0x19, 0x16, 0x34, 0x19, 0x66, 0x81, 0x01, 0x42, 0x9A, 0x0C, 0x66,
+	0x2B, 0x00, 0x61, 0x10, 0xCA, 0xB7, 0x02, 0xD6, 0x9A, 0x0C, 0xFE, 0x87, 0x00, 0x42, 0x87, 0x00,
+	0x56, 0x9A, 0x0C, 0x0E, 0x43, 0xA6, 0x7A, 0x9A, 0x0C, 0x1A, 0x9F, 0x30, 0xFE, 0x9A, 0x0C, 0xFE,
+	0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xB6, 0x9A, 0x0C, 0x1C, 0xC9, 0x60, 0x79, 0x3F,
+	0x25, 0x99, 0x08, 0x3B, 0x0E, 0x84, 0x1C, 0x36, 0x6C, 0x55, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00,
+	0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66,
+	0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A,
+	0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00,
+	0x1E, 0x9A, 0x0C, 0x66, 0x22, 0x00, 0x1E, 0x9A, 0x0C, 0x66, 0x22, 0x00, 0xFE, 0x9A, 0x0C, 0xFE,
+	0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A,
+	0x0C, 0xFE, 0x9A, 0x0C, 0x3A, 0x9A, 0x0C, 0x66, 0x29, 0x02, 0xA1, 0xDC, 0xCA, 0x8F, 0x0B, 0x1E,
+	0x9A, 0x0C, 0x76, 0x59, 0x00, 0xCA, 0x35, 0x06, 0xFE, 0x9A, 0x0C, 0x82, 0x9A, 0x0C, 0x76, 0xB2,
+	0x00, 0xCA, 0x0B, 0x01, 0x1E, 0x9A, 0x0C, 0x76, 0x59, 0x00, 0xCA, 0x0B, 0x01, 0xFE, 0x9A, 0x0C,
+	0x82, 0x9A, 0x0C, 0x72, 0xB2, 0x00, 0xCE, 0x9E, 0x09, 0xA6, 0x9A, 0x0C, 0x66, 0x7B, 0x00, 0xFE,
+	0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xEE, 0x9A, 0x0C, 0x1A, 0x9A, 0x0C, 0x66, 0x1D,
+	0x01, 0xDA, 0xAE, 0x03, 0x1E, 0x9A, 0x0C, 0x76, 0x59, 0x00, 0xCA, 0xA3, 0x02, 0xFE, 0x9A, 0x0C,
+	0x82, 0x9A, 0x0C, 0xFE, 0xB2, 0x00, 0x42, 0xB2, 0x00, 0x1E, 0x9A, 0x0C, 0x72, 0x59, 0x00, 0xCE,
+	0xFC, 0x02, 0xFE, 0x9A, 0x0C, 0x42, 0x9A, 0x0C, 0x0E, 0x1D, 0x26, 0x0C, 0x25, 0x02, 0x00, 0x40,
+	0x46, 0x4A, 0x09, 0xFE, 0x34, 0x19, 0xFE, 0x34, 0x19, 0xFE, 0x34, 0x19, 0x12, 0x34, 0x19, 0x66,
+	0x81, 0x01, 0x42, 0x9A, 0x0C, 0x66, 0x2B, 0x00, 0x61, 0x10, 0xCA, 0xB7, 0x02, 0xD6, 0x9A, 0x0C,
+	0xFE, 0x87, 0x00, 0x42, 0x87, 0x00, 0x56, 0x9A, 0x0C, 0x00, 0xA6, 0x86, 0xCE, 0x25, 0x1A, 0xBD,
+	0x3B, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xB6, 0x9A, 0x0C,
+	0x20, 0xB3, 0xF0, 0x7F, 0x3F, 0x25, 0xF0, 0xC0, 0x16, 0x3E, 0x0E, 0xF0, 0x2F, 0x32, 0x06, 0x62,
+	0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66,
+	0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A,
+	0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00,
+	0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1E, 0x9A, 0x0C, 0x66, 0x22, 0x00, 0x1E, 0x9A, 0x0C, 0x66,
+	0x22, 0x00, 0x12, 0x9A, 0x0C, 0x04, 0x1A, 0xA0, 0x56, 0xCE, 0x25, 0x00, 0x0B, 0xFE, 0x68, 0x32,
+	0xFE, 0x68, 0x32, 0xFE, 0x68, 0x32, 0xFE, 0x68, 0x32, 0xFE, 0x68, 0x32, 0xFE, 0x68, 0x32, 0xFE,
+	0x68, 0x32, 0xC2, 0x68, 0x32, 0x66, 0x29, 0x02, 0xA1, 0xDC, 0xCA, 0x8F, 0x0B, 0x1E, 0x9A, 0x0C,
+	0x76, 0x59, 0x00, 0xCA, 0x35, 0x06, 0xFE, 0x9A, 0x0C, 0x82, 0x9A, 0x0C, 0x76, 0xB2, 0x00, 0xCA,
+	0x0B, 0x01, 0x1E, 0x9A, 0x0C, 0x76, 0x59, 0x00, 0xCA, 0x0B, 0x01, 0xFE, 0x9A, 0x0C, 0x82, 0x9A,
+	0x0C, 0x72, 0xB2, 0x00, 0xCE, 0x9E, 0x09, 0xA6, 0x9A, 0x0C, 0x66, 0x7B, 0x00, 0xFE, 0x9A, 0x0C,
+	0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xEE, 0x9A, 0x0C, 0x1A, 0x9A, 0x0C, 0x66, 0x1D, 0x01, 0xDA,
+	0xAE, 0x03, 0x1E, 0x9A, 0x0C, 0x76, 0x59, 0x00, 0xCA, 0xA3, 0x02, 0xFE, 0x9A, 0x0C, 0x82, 0x9A,
+	0x0C, 0xFE, 0xB2, 0x00, 0x42, 0xB2, 0x00, 0x1E, 0x9A, 0x0C, 0x72, 0x59, 0x00, 0xCE, 0xFC, 0x02,
+	0x1E, 0x9A, 0x0C, 0x00, 0x1C, 0x1E, 0x68, 0x32, 0x00, 0x1D, 0xFA, 0x68, 0x32, 0x12, 0x9A, 0x0C,
+	0x04, 0xF3, 0xC9, 0x4A, 0x4A, 0x09, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xEE, 0x9A, 0x0C, 0x00,
+	0x12, 0x1E, 0x68, 0x32, 0x66, 0x81, 0x01, 0x42, 0x9A, 0x0C, 0x66, 0x2B, 0x00, 0x61, 0x10, 0xCA,
+	0xB7, 0x02, 0xD6, 0x9A, 0x0C, 0xFE, 0x87, 0x00, 0x42, 0x87, 0x00, 0x56, 0x9A, 0x0C, 0x0E, 0x43,
+	0xBF, 0x7A, 0x34, 0x19, 0x1A, 0xDB, 0x46, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C,
+	0xFE, 0x9A, 0x0C, 0xB6, 0x9A, 0x0C, 0x30, 0x63, 0x54, 0x54, 0x3F, 0x25, 0x6F, 0xAF, 0xC4, 0x3D,
+	0x2D, 0xC4, 0xC9, 0xED, 0x32, 0x1E, 0x29, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C,
+	0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A,
+	0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x30, 0xD5,
+	0xD4, 0x54, 0x3F, 0x25, 0xC1, 0xC0, 0xC0, 0x3D, 0x2D, 0xED, 0xEC, 0xEC, 0x32, 0xE7, 0x00, 0x1A,
+	0x9A, 0x0C, 0x66, 0x42, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1E, 0x9A, 0x0C, 0x66, 0x22,
+	0x00, 0x1E, 0x9A, 0x0C, 0x66, 0x22, 0x00, 0x12, 0x9A, 0x0C, 0x00, 0x10, 0x5A, 0x9A, 0x0C, 0xFE,
+	0x02, 0x3F, 0xFE, 0x02, 0x3F, 0xFE, 0x02, 0x3F, 0xFE, 0x02, 0x3F, 0xFE, 0x02, 0x3F, 0xFE, 0x02,
+	0x3F, 0xFE, 0x02, 0x3F, 0xC6, 0x02, 0x3F, 0x66, 0x29, 0x02, 0xA1, 0xDC, 0xCA, 0x8F, 0x0B, 0x1E,
+	0x9A, 0x0C, 0x76, 0x59, 0x00, 0xCA, 0x35, 0x06, 0xFE, 0x9A, 0x0C, 0x82, 0x9A, 0x0C, 0x76, 0xB2,
+	0x00, 0xCA, 0x0B, 0x01, 0x1E, 0x9A, 0x0C, 0x76, 0x59, 0x00, 0xCA, 0x0B, 0x01, 0xFE, 0x9A, 0x0C,
+	0x82, 0x9A, 0x0C, 0x72, 0xB2, 0x00, 0xCE, 0x9E, 0x09, 0xA6, 0x9A, 0x0C, 0x66, 0x7B, 0x00, 0xFE,
+	0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xEE, 0x9A, 0x0C, 0x1A, 0x9A, 0x0C, 0x66, 0x1D,
+	0x01, 0xDA, 0xAE, 0x03, 0x1E, 0x9A, 0x0C, 0x76, 0x59, 0x00, 0xCA, 0xA3, 0x02, 0xFE, 0x9A, 0x0C,
+	0x82, 0x9A, 0x0C, 0xFE, 0xB2, 0x00, 0x42, 0xB2, 0x00, 0x1E, 0x9A, 0x0C, 0x72, 0x59, 0x00, 0xCE,
+	0xFC, 0x02, 0x1E, 0x9A, 0x0C, 0xFE, 0x02, 0x3F, 0x22, 0x02, 0x3F, 0x12, 0x9A, 0x0C, 0x1C, 0x57,
+	0x23, 0xED, 0x3D, 0x2D, 0xEA, 0x58, 0x0F, 0xFE, 0xCE, 0x25, 0xFE, 0xCE, 0x25, 0xFE, 0xCE, 0x25,
+	0x22, 0xCE, 0x25, 0x22, 0x9A, 0x0C, 0x66, 0x81, 0x01, 0x42, 0x9A, 0x0C, 0x66, 0x2B, 0x00, 0x61,
+	0x10, 0xCA, 0xB7, 0x02, 0xD6, 0x9A, 0x0C, 0xFE, 0x87, 0x00, 0x42, 0x87, 0x00, 0x56, 0x9A, 0x0C,
+	0x0E, 0xC0, 0xCB, 0x26, 0x02, 0x89, 0x10, 0xEC, 0x02, 0x0A, 0x1B, 0x12, 0x4E, 0xEA, 0xCB, 0x22,
+	0x9F, 0x4B, 0x00, 0xC6, 0x0E, 0x66, 0x47, 0x04, 0x80, 0x3F, 0x1A, 0x32, 0x4B, 0x0E, 0xF5, 0x88,
+	0xFE, 0xFF, 0x88, 0x32, 0xFF, 0x88, 0x0C, 0x38, 0x13, 0x40, 0x0F, 0x12, 0x3E, 0x8E, 0x12, 0x3E,
+	0x90, 0x08, 0x7A, 0x00, 0x8A, 0xFE, 0x9B, 0x88, 0x5E, 0x9B, 0x88, 0x0E, 0x85, 0x8E, 0x14, 0x80,
+	0x3F, 0xAA, 0x01, 0x00, 0xBA, 0x0D, 0x62, 0x72, 0x83, 0x41, 0xCE, 0xAA, 0x07, 0x04, 0xC8, 0x01,
+	0x0E, 0x73, 0x8F, 0x00, 0xF0, 0x12, 0xCE, 0x8E, 0x38, 0x88, 0x02, 0x00, 0x98, 0x02, 0x00, 0xA8,
+	0x02, 0x03, 0xB8, 0x02, 0x13, 0xC0, 0x02, 0x14, 0x22, 0xFA, 0x88, 0x0E, 0x21, 0xCD, 0x86, 0x7E,
+	0x01, 0x26, 0x83, 0x40, 0xFE, 0x7E, 0x01, 0x7E, 0x7E, 0x01, 0x08, 0x16, 0x40, 0x17, 0xC2, 0x7E,
+	0x01, 0xCE, 0x1C, 0x01, 0x00, 0x9D, 0x12, 0x09, 0x90, 0x3D, 0x7E, 0x72, 0x49, 0x02, 0xCE, 0x01,
+	0x43, 0x14, 0xC8, 0x01, 0x01, 0xE0, 0x01, 0x00, 0x36, 0x7E, 0x01, 0x18, 0x01, 0xB8, 0x02, 0x16,
+	0xC0, 0x02, 0x18, 0x35, 0x7E, 0x00, 0xCD, 0x12, 0x30, 0x1C, 0x4E, 0xFE, 0x8B, 0x26, 0xC4, 0xAB,
+	0x16, 0xE9, 0xCE, 0x55, 0xFF, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE,
+	0x8B, 0xFE, 0xFE, 0x8B, 0x4A, 0xFE, 0x8B, 0x00, 0xC9, 0x25, 0x86, 0x4E, 0xFE, 0x8B, 0x00, 0x31,
+	0x16, 0xBA, 0xBA, 0x35, 0x7D, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE,
+	0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B,
+	0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE,
+	0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE,
+	0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B,
+	0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE,
+	0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE,
+	0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B,
+	0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE,
+	0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE,
+	0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xDA, 0xFE, 0x8B, 0x08, 0xCA, 0xDA,
+	0x69, 0x56, 0xFE, 0x8B, 0x1E, 0x1B, 0xDE, 0x22, 0x21, 0x0E, 0xFE, 0xFE, 0x8B, 0x8E, 0xFE, 0x8B,
+	0x0E, 0x63, 0xDE, 0xD6, 0xDE, 0x60, 0x2A, 0xF5, 0xA5, 0x16, 0x06, 0x89, 0x1A, 0x57, 0x10, 0xFE,
+	0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xA6, 0xFE, 0x8B, 0x0E, 0xBD,
+	0xDF, 0xFE, 0x7C, 0x01, 0x2D, 0x7C, 0x1A, 0x54, 0x13, 0xFE, 0x7C, 0x01, 0xFE, 0x7C, 0x01, 0xFE,
+	0x7C, 0x01, 0xFE, 0x7C, 0x01, 0xA6, 0x7C, 0x01, 0x0E, 0x16, 0xE1, 0x39, 0x7C, 0xAE, 0xA0, 0x7B,
+	0x42, 0xF8, 0x02, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xC6,
+	0xFE, 0x8B, 0x0E, 0x70, 0xE2, 0xFE, 0x7D, 0x01, 0x31, 0x7D, 0xA2, 0xFA, 0x02, 0x66, 0x12, 0x17,
+	0xFE, 0x54, 0x65, 0x82, 0x54, 0x65, 0x66, 0x7B, 0x00, 0xFE, 0x4C, 0x68, 0xCA, 0x4C, 0x68, 0x0E,
+	0xCA, 0xE3, 0xFE, 0x7D, 0x01, 0x31, 0x7D, 0x1A, 0xB4, 0x4B, 0x2E, 0x77, 0x04, 0x00, 0xF0, 0xFE,
+	0x87, 0x87, 0xFE, 0x87, 0x87, 0xFE, 0x87, 0x87, 0xFE, 0x87, 0x87, 0x72, 0x87, 0x87, 0x0E, 0x24,
+	0xE5, 0xFE, 0x7D, 0x01, 0x31, 0x7D, 0x1A, 0x97, 0x40, 0x2E, 0x7D, 0x01, 0x56, 0x4E, 0x68, 0x66,
+	0x7F, 0x02, 0xFE, 0xFA, 0x02, 0xFE, 0xFA, 0x02, 0xFE, 0xFA, 0x02, 0xB6, 0xFA, 0x02, 0x00, 0xE3,
+	0x32, 0x3E, 0x6E, 0xF6, 0xF4, 0x05, 0x1A, 0x7A, 0x35, 0xFE, 0x7D, 0x01, 0xC6, 0x7D, 0x01, 0x00,
+	0x80, 0x1C, 0x00, 0x80, 0x80, 0x04, 0x28, 0x01, 0x00, 0x80, 0x02, 0x00, 0x88, 0x02, 0x01, 0x98,
+	0x02, 0xFF, 0x11, 0x01, 0x70, 0x01, 0xA0, 0x02, 0x01, 0xB0, 0x02, 0x01, 0xC0, 0x02, 0x00, 0xC8,
+	0x02, 0x00, 0xD8, 0x02, 0x01, 0xF2, 0x02, 0x1F, 0x0A, 0x1D, 0x08, 0x01, 0x1D, 0x00, 0x00, 0x00,
+	0x00, 0x25, 0x01, 0x05, 0x00, 0x2D, 0x01, 0x05, 0x1C, 0x35, 0x00, 0x00, 0x80, 0x3F, 0x60, 0x01,
+	0x6D, 0x01, 0x07, 0x44, 0xF8, 0x02, 0x00, 0x62, 0x6C, 0x08, 0x02, 0x1A, 0x01, 0x2E, 0x25, 0x00,
+	0x00, 0x10, 0x42, 0x28, 0x01, 0x3D, 0x01, 0x22, 0x18, 0x40, 0x01, 0x48, 0x00, 0x50, 0x00, 0x5D,
+	0x01, 0x0B, 0x24, 0x6A, 0x00, 0x70, 0x00, 0x78, 0x00, 0x8A, 0x01, 0x0A, 0x0D, 0x01, 0x0E, 0x00,
+	0x15, 0x01, 0x05, 0x04, 0x95, 0x01, 0x01, 0x3A, 0x04, 0x9D, 0x01, 0x01, 0x0C, 0x00, 0xA5, 0x05,
+	0x06, 0x00, 0xAD, 0x05, 0x06, 0x1C, 0xCA, 0x01, 0x00, 0xD0, 0x01, 0x01, 0xD8, 0x01, 0x01, 0x8E,
+	0xD0, 0x0F, 0xE0, 0x01, 0x00, 0xF8, 0x01, 0x01, 0xB8, 0x02, 0x01, 0xC8, 0x02, 0x01, 0xD8, 0x02,
+	0x00, 0xE0, 0x02, 0x00, 0xE8, 0x02, 0x00, 0xF0, 0x02, 0x00, 0x31, 0x08, 0xE4, 0xDA, 0x69, 0x12,
+	0x2B, 0x08, 0xE6, 0x0F, 0x12, 0x03, 0x01, 0x00, 0x05, 0x18, 0xCB, 0x02, 0x22, 0x08, 0x0A, 0x04,
+	0x0A, 0x02, 0x0B, 0x2B, 0x18, 0x01, 0x0D, 0x0A, 0x10, 0x2F, 0x18, 0x01, 0x22, 0x0A, 0x05, 0x14,
+	0xF0, 0x46, 0x2E, 0x10, 0x03, 0x18, 0x01, 0x0A, 0x21, 0x12, 0x19, 0x63, 0x68, 0x61, 0x72, 0x74,
+	0x2D, 0x31, 0x2D, 0x70, 0x61, 0x72, 0x61, 0x67, 0x72, 0x61, 0x70, 0x68, 0x53, 0x74, 0x79, 0x6C,
+	0x65, 0x5F, 0x31, 0x35, 0x2A, 0x04, 0x08, 0x85, 0xE0, 0x69, 0x50, 0x39, 0x5A, 0xB5, 0x01, 0x08,
+	0x00, 0x10, 0x00, 0x1D, 0x00, 0x00, 0x20, 0x41, 0x2A, 0x0D, 0x48, 0x65, 0x6C, 0x76, 0x65, 0x74,
+	0x69, 0x63, 0x61, 0x4E, 0x65, 0x75, 0x65, 0x3A, 0x1D, 0x72, 0x02, 0x01, 0x28, 0x40, 0x01, 0x50,
+	0x00, 0x58, 0x00, 0x60, 0x00, 0x68, 0x00, 0x75, 0x01, 0xD1, 0x00, 0x7D, 0x01, 0x05, 0x24, 0x80,
+	0x01, 0x01, 0xA0, 0x01, 0x01, 0xB0, 0x01, 0x01, 0xC5, 0x05, 0xEB, 0x0C, 0xC8, 0x01, 0x01, 0xDD,
+	0x05, 0xE2, 0x0C, 0xE0, 0x01, 0x01, 0xF5, 0x05, 0x12, 0x00, 0xF8, 0xFE, 0x7D, 0x01, 0xFE, 0x7D,
+	0x01, 0xDE, 0x7D, 0x01, 0x00, 0xE5, 0xFE, 0x7D, 0x01, 0x3D, 0x7D, 0x04, 0x36, 0x2A, 0x42, 0x7D,
+	0x01, 0x00, 0x40, 0x52, 0x7D, 0x01, 0x10, 0x09, 0xFA, 0x7F, 0x3F, 0x25, 0x41, 0x34, 0x10, 0x2D,
+	0x03, 0xF8, 0x7F, 0x3F, 0x2E, 0x7F, 0x02, 0xFE, 0x7D, 0x01, 0x82, 0x7D, 0x01, 0x66, 0x7B, 0x00,
+	0xFE, 0xFA, 0x02, 0xCA, 0xFA, 0x02, 0x00, 0xE6, 0xFE, 0x7D, 0x01, 0x3D, 0x7D, 0x00, 0x37, 0x46,
+	0x7D, 0x01, 0x00, 0x20, 0x52, 0x7D, 0x01, 0x41, 0xD0, 0x56, 0xFC, 0x03, 0xFE, 0x7D, 0x01, 0x82,
+	0x7D, 0x01, 0x66, 0x7B, 0x00, 0xFE, 0x7D, 0x01, 0xCA, 0x7D, 0x01, 0x00, 0xE7, 0xFE, 0x7D, 0x01,
+	0x3D, 0x7D, 0x00, 0x38, 0x46, 0x7D, 0x01, 0x56, 0xFA, 0x02, 0x66, 0x02, 0x01, 0xFE, 0x7D, 0x01,
+	0xFE, 0x7D, 0x01, 0xFE, 0x7D, 0x01, 0xB6, 0x7D, 0x01, 0x00, 0xE8, 0xFE, 0x7D, 0x01, 0x3D, 0x7D,
+	0x00, 0x39, 0x46, 0x7D, 0x01, 0x08, 0x00, 0x42, 0x2A, 0xFE, 0xF4, 0x05, 0xFE, 0xF4, 0x05, 0xFE,
+	0xF4, 0x05, 0xFE, 0xF4, 0x05, 0x6A, 0xF4, 0x05, 0x00, 0xD7, 0x32, 0x7D, 0x01, 0x04, 0xCA, 0x02,
+	0xED, 0x67, 0x00, 0x2B, 0x62, 0x71, 0x07, 0x08, 0x20, 0x12, 0x18, 0x5A, 0x71, 0x07, 0x00, 0x32,
+	0x46, 0x7C, 0x01, 0x56, 0xF9, 0x02, 0x00, 0x05, 0xB5, 0xF3, 0x00, 0x01, 0xFE, 0xF3, 0x05, 0xBE,
+	0xF3, 0x05, 0x66, 0x7B, 0x00, 0xFE, 0x76, 0x04, 0xCA, 0x76, 0x04, 0x00, 0xE9, 0x32, 0x7C, 0x01,
+	0xF2, 0xED, 0x08, 0x04, 0x32, 0x30, 0x46, 0x7D, 0x01, 0xFE, 0xF3, 0x05, 0xFE, 0xF3, 0x05, 0xFE,
+	0xF3, 0x05, 0xFE, 0xF3, 0x05, 0x76, 0xF3, 0x05, 0x00, 0xEA, 0xFE, 0x7D, 0x01, 0x3D, 0x7D, 0x00,
+	0x31, 0xFE, 0x7D, 0x01, 0xFE, 0x7D, 0x01, 0xFE, 0x7D, 0x01, 0xFE, 0x7D, 0x01, 0xBE, 0x7D, 0x01,
+	0x00, 0xEB, 0xFE, 0x7D, 0x01, 0x3D, 0x7D, 0x4A, 0x77, 0x04, 0x00, 0xF0, 0xFE, 0xED, 0x08, 0xFE,
+	0xED, 0x08, 0xFE, 0xED, 0x08, 0xFE, 0xED, 0x08, 0x72, 0xED, 0x08, 0x00, 0xEC, 0xFE, 0x7D, 0x01,
+	0x3D, 0x7D, 0x00, 0x33, 0xFE, 0xFA, 0x02, 0xFE, 0xFA, 0x02, 0xFE, 0xFA, 0x02, 0xFE, 0xFA, 0x02,
+	0xBE, 0xFA, 0x02, 0x00, 0xED, 0xFE, 0x7D, 0x01, 0x3D, 0x7D, 0x00, 0x34, 0xFE, 0x7D, 0x01, 0xFE,
+	0x7D, 0x01, 0xFE, 0x7D, 0x01, 0xFE, 0x7D, 0x01, 0xBE, 0x7D, 0x01, 0x00, 0xEE, 0xFE, 0x7D, 0x01,
+	0x3D, 0x7D, 0xFE, 0x5E, 0x10, 0xFE, 0x5E, 0x10, 0xFE, 0x5E, 0x10, 0xFE, 0x5E, 0x10, 0xC2, 0x5E,
+	0x10, 0x00, 0xEF, 0xFE, 0x7D, 0x01, 0x3D, 0x7D, 0xFE, 0x5E, 0x10, 0xFE, 0x5E, 0x10, 0xFE, 0x5E,
+	0x10, 0xFE, 0x5E, 0x10, 0xC2, 0x5E, 0x10, 0x00, 0xF0, 0xFE, 0x7D, 0x01, 0x3D, 0x7D, 0x4A, 0x5E,
+	0x10, 0x56, 0xE8, 0x0B, 0x24, 0xC7, 0xFF, 0x7F, 0x3F, 0x25, 0xFF, 0xFF, 0x7F, 0x3F, 0x2D, 0x01,
+	0x05, 0xFE, 0xDB, 0x11, 0xB2, 0xDB, 0x11, 0x66, 0x7B, 0x00, 0xFE, 0xE8, 0x0B, 0xCA, 0xE8, 0x0B,
+	0x00, 0xF1, 0xFE, 0x7D, 0x01, 0x3D, 0x7D, 0x4A, 0x5E, 0x10, 0xFE, 0xE8, 0x0B, 0xFE, 0xE8, 0x0B,
+	0xFE, 0xE8, 0x0B, 0xFE, 0xE8, 0x0B, 0x76, 0xE8, 0x0B, 0x00, 0xF2, 0xFE, 0x7D, 0x01, 0x3D, 0x7D,
+	0x4A, 0x5E, 0x10, 0xFE, 0x7D, 0x01, 0xFE, 0x7D, 0x01, 0xFE, 0x7D, 0x01, 0xFE, 0x7D, 0x01, 0x76,
+	0x7D, 0x01, 0x00, 0xD8, 0x32, 0x7D, 0x01, 0xF2, 0x5E, 0x10, 0x4A, 0x6A, 0x0A, 0x56, 0x76, 0x04,
+	0xFE, 0x57, 0x13, 0xFE, 0x57, 0x13, 0xFE, 0x57, 0x13, 0xFE, 0x57, 0x13, 0x1E, 0x57, 0x13, 0x00,
+	0xD9, 0xFE, 0x7C, 0x01, 0x39, 0x7C, 0x4A, 0x69, 0x0A, 0x56, 0x7C, 0x01, 0x66, 0x5F, 0x11, 0xFE,
+	0xD3, 0x14, 0x82, 0xD3, 0x14, 0x66, 0x7B, 0x00, 0xFE, 0xF2, 0x05, 0xCA, 0xF2, 0x05, 0x00, 0xDA,
+	0xFE, 0x7C, 0x01, 0x39, 0x7C, 0x4A, 0x68, 0x0A, 0x56, 0x7C, 0x01, 0xFE, 0xF8, 0x02, 0xFE, 0xF8,
+	0x02, 0xFE, 0xF8, 0x02, 0xFE, 0xF8, 0x02, 0x51, 0xF8, 0x00, 0xDB, 0xFE, 0x7C, 0x01, 0x39, 0x7C,
+	0xA2, 0x67, 0x0A, 0x66, 0x6F, 0x08, 0xFE, 0xF8, 0x02, 0x82, 0xF8, 0x02, 0x66, 0x7B, 0x00, 0xFE,
+	0xF8, 0x02, 0xCA, 0xF8, 0x02, 0x00, 0xDC, 0xFE, 0x7C, 0x01, 0x39, 0x7C, 0xA2, 0x66, 0x0A, 0x66,
+	0xF9, 0x03, 0xFE, 0x7C, 0x01, 0x82, 0x7C, 0x01, 0x66, 0x7B, 0x00, 0xFE, 0x7C, 0x01, 0xCA, 0x7C,
+	0x01, 0x00, 0xDD, 0xFE, 0x7C, 0x01, 0x39, 0x7C, 0x4A, 0x65, 0x0A, 0xFE, 0x74, 0x04, 0xFE, 0x74,
+	0x04, 0xFE, 0x74, 0x04, 0xFE, 0x74, 0x04, 0x76, 0x74, 0x04, 0x00, 0xDE, 0xFE, 0x7C, 0x01, 0x39,
+	0x7C, 0x4A, 0x64, 0x0A, 0x56, 0x7C, 0x01, 0x66, 0x7D, 0x02, 0xFE, 0xF8, 0x02, 0xFE, 0xF8, 0x02,
+	0xFE, 0xF8, 0x02, 0xAE, 0xF8, 0x02, 0x24, 0x11, 0x08, 0xF3, 0xDA, 0x69, 0x12, 0x0B, 0x08, 0xA6,
+	0x27, 0x16, 0x33, 0x22, 0x14, 0x83, 0x01, 0x0A, 0x1F, 0x12, 0x17, 0x1E, 0xA2, 0x1A, 0x34, 0x72,
+	0x65, 0x66, 0x65, 0x72, 0x65, 0x6E, 0x63, 0x65, 0x4C, 0x69, 0x6E, 0x65, 0x5F, 0x1A, 0x24, 0x19,
+	0x14, 0x82, 0xF1, 0x04, 0x5E, 0x0A, 0x56, 0x7A, 0xFC, 0x22, 0x1C, 0x15, 0x00, 0x00, 0xE0, 0x3F,
+	0x18, 0x00, 0x20, 0x0E, 0x16, 0x23, 0x14, 0x80, 0x40, 0x32, 0x27, 0x08, 0x01, 0x12, 0xDF, 0x22,
+	0x00, 0x18, 0x16, 0x2F, 0x1F, 0x12, 0x34, 0x1F, 0x4E, 0x05, 0x00, 0x20, 0x12, 0x00, 0x18, 0x0F,
+	0x20, 0x0F, 0x11, 0x08, 0xCE, 0x05, 0x95, 0x00, 0xA4, 0x0D, 0x95, 0x14, 0x88, 0x19, 0x0A, 0x18,
+	0x12, 0x10, 0x11, 0x95, 0x14, 0x73, 0x65, 0x72, 0x69, 0x65, 0x73, 0x1D, 0x8E, 0x28, 0xE1, 0x18,
+	0x0A, 0x36, 0x0A, 0x20, 0x0A, 0x0E, 0x08, 0x01, 0x12, 0x2A, 0x4A, 0x23, 0x0C, 0x0A, 0x0E, 0x08,
+	0x02, 0x05, 0x10, 0x04, 0xC0, 0x40, 0x05, 0x7B, 0x08, 0x10, 0x00, 0x1A, 0x01, 0x1E, 0x34, 0x40,
+	0x40, 0x15, 0xCD, 0xCC, 0x4C, 0xBF, 0x2A, 0x04, 0x6C, 0x69, 0x6E, 0x65, 0x12, 0xDA, 0x38, 0x00,
+	0x08, 0x1A, 0x00, 0x22, 0x8A, 0x01, 0x01, 0x00, 0x80, 0xCA, 0x01, 0x01, 0x00, 0x2A, 0xFE, 0x58,
+	0x00, 0x5A, 0x58, 0x00, 0x00, 0x32, 0x16, 0xAD, 0x24, 0x1C, 0xE6, 0xD8, 0xAC, 0x3E, 0x25, 0x7D,
+	0xFA, 0x41, 0x46, 0x53, 0x10, 0x00, 0x3A, 0x7E, 0x21, 0x00, 0x00, 0x42, 0x7E, 0x21, 0x00, 0x00,
+	0x4A, 0x7E, 0x21, 0x00, 0x00, 0x52, 0x7E, 0x21, 0x00, 0x00, 0x5A, 0x7E, 0x21, 0x00, 0x00, 0x62,
+	0x7E, 0x21, 0x00, 0x00, 0x6A, 0x7E, 0x21, 0x00, 0x00, 0x72, 0x7E, 0x21, 0x00, 0x00, 0x7A, 0x7E,
+	0x21, 0x00, 0x04, 0x82, 0x01, 0x7E, 0x22, 0x00, 0x00, 0x8A, 0x82, 0x22, 0x00, 0x44, 0x90, 0x01,
+	0x01, 0x98, 0x01, 0x10, 0xA0, 0x01, 0x04, 0xA8, 0x01, 0x05, 0xB0, 0x01, 0x00, 0xB8, 0x01, 0x02,
+	0x22, 0x0D, 0x25, 0x38, 0xD0, 0x01, 0x03, 0xD8, 0x01, 0x0E, 0xE0, 0x01, 0x06, 0xE8, 0x01, 0x08,
+	0xF2, 0x01, 0x34, 0x86, 0x67, 0x03, 0x08, 0x02, 0x43, 0x1D, 0x0E, 0xFF, 0x23, 0x04, 0x20, 0x0A,
+	0x0E, 0x80, 0x26, 0x14, 0x3F, 0x30, 0x01, 0x38, 0x00, 0xFA, 0xA2, 0x37, 0x00, 0x04, 0x00, 0x00,
+	0x1D, 0x37, 0x04, 0x82, 0x02, 0x9E, 0x6E, 0x00, 0x32, 0x37, 0x00, 0x00, 0x8A, 0xA2, 0x37, 0x00,
+	0x0C, 0x40, 0x40, 0x20, 0x05, 0x15, 0xA5, 0x00, 0x92, 0x8E, 0x37, 0x00, 0x04, 0xF4, 0x42, 0x12,
+	0x97, 0x0B, 0x14, 0x20, 0x0A, 0x2D, 0xCD, 0xCC, 0x0C, 0x05, 0xDC, 0x70, 0x9A, 0x02, 0x00, 0xA2,
+	0x02, 0x00, 0xAA, 0x02, 0x00, 0xBA, 0x02, 0x00, 0xC2, 0x02, 0x00, 0xCA, 0x02, 0x00, 0xD2, 0x02,
+	0x00, 0xDA, 0x02, 0x00, 0xE2, 0x02, 0x00, 0xEA, 0x02, 0x69, 0x3C, 0x34, 0xE1, 0x92, 0x12, 0x3F,
+	0x25, 0x24, 0x82, 0x12, 0x3F, 0x2D, 0x6E, 0x82, 0x12, 0x3F, 0x2E, 0x37, 0x13, 0x10, 0x15, 0x00,
+	0x00, 0x40, 0x40, 0x2E, 0x95, 0x04, 0x00, 0x02, 0x85, 0x1A, 0x7E, 0x95, 0x04, 0x00, 0xF2, 0x0D,
+	0x59, 0x66, 0x22, 0x0C, 0x00, 0x15, 0x21, 0x82, 0xC6, 0x59, 0x00, 0x00, 0xFA, 0x0D, 0x59, 0x66,
+	0x96, 0x03, 0x42, 0x59, 0x00, 0x96, 0x47, 0x05, 0x04, 0x82, 0x03, 0x29, 0x0B, 0x76, 0x59, 0x00,
+	0x32, 0x0B, 0x01, 0x96, 0x59, 0x00, 0x00, 0x8A, 0x0D, 0x59, 0x14, 0xB3, 0x82, 0x12, 0x3F, 0x25,
+	0xB2, 0x21, 0x64, 0x00, 0xB1, 0xFE, 0x64, 0x01, 0x29, 0x64, 0x00, 0x92, 0x0D, 0x59, 0x76, 0xB2,
+	0x00, 0x32, 0x64, 0x01, 0x96, 0xB2, 0x00, 0x00, 0x9A, 0x92, 0x59, 0x00, 0xCA, 0x0B, 0x01, 0x00,
+	0xA2, 0x0D, 0x59, 0xFE, 0x16, 0x02, 0x42, 0x16, 0x02, 0x00, 0xAA, 0x0D, 0x59, 0x72, 0x0B, 0x01,
+	0x36, 0xC8, 0x02, 0x96, 0x0B, 0x01, 0x04, 0xB2, 0x03, 0x89, 0xBA, 0x66, 0xFA, 0x08, 0x00, 0xBA,
+	0x0D, 0x22, 0x66, 0x7B, 0x00, 0x00, 0xC2, 0x0D, 0x22, 0x00, 0x81, 0x22, 0x84, 0x22, 0x00, 0x75,
+	0x3A, 0x84, 0x22, 0x00, 0xCA, 0x0D, 0x22, 0x66, 0x66, 0x00, 0x00, 0xD2, 0x82, 0x22, 0x00, 0x90,
+	0xDA, 0x03, 0x00, 0xE0, 0x03, 0x01, 0xE8, 0x03, 0x00, 0xF0, 0x03, 0x01, 0x80, 0x04, 0x00, 0x88,
+	0x04, 0x00, 0x90, 0x04, 0x00, 0x98, 0x04, 0x00, 0xA0, 0x04, 0x00, 0xA8, 0x04, 0x01, 0xB5, 0x04,
+	0xFF, 0xFF, 0x7F, 0x7F, 0xBD, 0x05, 0x06, 0x00, 0xC5, 0x05, 0x06, 0x00, 0xCD, 0x05, 0x06, 0x00,
+	0xD5, 0x05, 0x06, 0x04, 0xDA, 0x04, 0x49, 0xFC, 0x2C, 0x5E, 0x85, 0x12, 0x3F, 0x25, 0x3C, 0x80,
+	0x12, 0x3F, 0x2D, 0xD4, 0x86, 0x91, 0x07, 0x00, 0x02, 0x12, 0x98, 0x2B, 0x42, 0x07, 0x04, 0x96,
+	0x3F, 0x01, 0x00, 0xE2, 0x0D, 0x59, 0x66, 0x1D, 0x01, 0xDA, 0xAE, 0x03, 0x00, 0xEA, 0x92, 0x59,
+	0x00, 0xCA, 0xA3, 0x02, 0x00, 0xF2, 0x0D, 0x59, 0xFE, 0x0B, 0x01, 0x42, 0x0B, 0x01, 0x00, 0xFA,
+	0x0D, 0x59, 0x76, 0x0B, 0x01, 0xCA, 0xB2, 0x00, 0x04, 0x82, 0x05, 0x29, 0xBD, 0x72, 0x59, 0x00,
+	0xCE, 0xFC, 0x02, 0x04, 0x8D, 0x05, 0xA1, 0xA3, 0x0C, 0x90, 0x05, 0x15, 0x9D, 0x05, 0x09, 0x10,
+	0xA0, 0x05, 0x19, 0xAA, 0x05, 0x8A, 0xEF, 0x06, 0xC9, 0x81, 0x1C, 0x40, 0x20, 0x01, 0x2D, 0x00,
+	0x00, 0x80, 0x3E, 0xE1, 0x5D, 0x00, 0xB2, 0x0D, 0xA2, 0x1C, 0xA6, 0x9F, 0x09, 0x3F, 0x25, 0x5E,
+	0xB4, 0x54, 0x46, 0x4A, 0x09, 0xC1, 0x54, 0xCA, 0xFB, 0x00, 0xA0, 0xB8, 0x05, 0x08, 0xC0, 0x05,
+	0x04, 0xD0, 0x05, 0x05, 0xD8, 0x05, 0x08, 0xE0, 0x05, 0x08, 0xE8, 0x05, 0x04, 0xF0, 0x05, 0x08,
+	0xF8, 0x05, 0x08, 0x80, 0x06, 0x08, 0x88, 0x06, 0x04, 0x90, 0x06, 0x00, 0x98, 0x06, 0x00, 0xA0,
+	0x06, 0x00, 0x82, 0x08, 0x29, 0x22, 0x72, 0x77, 0x04, 0x00, 0x00, 0xCA, 0x29, 0x05, 0x1C, 0xC0,
+	0x09, 0x09, 0xC8, 0x09, 0x0A, 0xAA, 0x0A, 0x89, 0x24, 0x42, 0x81, 0x01, 0x00, 0x00, 0x1E, 0xD6,
+	0x2E, 0x24, 0xB8, 0x0A, 0x05, 0xC0, 0x0A, 0x05, 0xCA, 0x0A, 0x00, 0xE2, 0x1A, 0x05, 0x0C, 0x42,
+	0x2B, 0x00, 0x22, 0x01, 0x2F, 0x61, 0x10, 0x32, 0x0A, 0x01, 0x96, 0x70, 0x07, 0x00, 0xFA, 0x0D,
+	0x84, 0x66, 0x64, 0x04, 0x1C, 0x88, 0x0B, 0x00, 0x98, 0x0B, 0x00, 0xAD, 0x0B, 0x81, 0x08, 0x04,
+	0xBA, 0x0B, 0x29, 0x11, 0xAA, 0x87, 0x00, 0x96, 0xF0, 0x03, 0x58, 0xC8, 0x0B, 0x08, 0xE0, 0x0B,
+	0x00, 0xED, 0x0B, 0x9A, 0x99, 0x19, 0x3E, 0x88, 0xF1, 0x04, 0x01, 0x90, 0xF1, 0x04, 0x01, 0x11,
+	0x08, 0xCF, 0x86, 0x9A, 0x0C, 0x1A, 0xCF, 0x24, 0x04, 0x82, 0xF1, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A,
+	0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xAE, 0x9A, 0x0C, 0x20, 0x03, 0xAC, 0x27, 0x3A, 0x25,
+	0xD1, 0x33, 0x22, 0x3F, 0x61, 0x6A, 0x32, 0xB6, 0x09, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A,
+	0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21,
+	0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x00, 0x62, 0x69, 0x37, 0x66, 0x21, 0x00, 0x1A, 0x9A,
+	0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00,
+	0x1E, 0x9A, 0x0C, 0x66, 0x22, 0x00, 0x00, 0x8A, 0x1A, 0x9A, 0x0C, 0x66, 0x22, 0x00, 0x1E, 0x9A,
+	0x0C, 0x00, 0x07, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE,
+	0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0x16, 0x9A, 0x0C, 0x66, 0x29,
+	0x02, 0xA1, 0xDC, 0xCA, 0x66, 0x06, 0x1E, 0x9A, 0x0C, 0x76, 0x59, 0x00, 0x32, 0x35, 0x06, 0x96,
+	0xAE, 0x05, 0xFE, 0x9A, 0x0C, 0x82, 0x9A, 0x0C, 0x76, 0xB2, 0x00, 0xCA, 0x0B, 0x01, 0x1E, 0x9A,
+	0x0C, 0x76, 0x59, 0x00, 0xCA, 0x0B, 0x01, 0xFE, 0x9A, 0x0C, 0x82, 0x9A, 0x0C, 0x72, 0xB2, 0x00,
+	0xCE, 0x9E, 0x09, 0xA6, 0x9A, 0x0C, 0x66, 0x7B, 0x00, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE,
+	0x9A, 0x0C, 0xEE, 0x9A, 0x0C, 0x1A, 0x9A, 0x0C, 0x66, 0x1D, 0x01, 0xDA, 0xAE, 0x03, 0x1E, 0x9A,
+	0x0C, 0x76, 0x59, 0x00, 0xCA, 0xA3, 0x02, 0xFE, 0x9A, 0x0C, 0x82, 0x9A, 0x0C, 0xFE, 0xB2, 0x00,
+	0x42, 0xB2, 0x00, 0x1E, 0x9A, 0x0C, 0x72, 0x59, 0x00, 0xCE, 0xFC, 0x02, 0xFE, 0x9A, 0x0C, 0x42,
+	0x9A, 0x0C, 0x1C, 0x79, 0x74, 0x4D, 0x3E, 0x25, 0x54, 0xF9, 0x34, 0x46, 0x4A, 0x09, 0xFE, 0x9A,
+	0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0x12, 0x9A, 0x0C, 0x42, 0x81, 0x01, 0x66, 0x9A, 0x0C,
+	0x42, 0x2B, 0x00, 0xFE, 0x9A, 0x0C, 0xD6, 0x9A, 0x0C, 0xAA, 0x87, 0x00, 0x96, 0xEC, 0x06, 0x56,
+	0x9A, 0x0C, 0x00, 0xD0, 0x86, 0x9A, 0x0C, 0x1A, 0xEC, 0x2F, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C,
+	0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xB6, 0x9A, 0x0C, 0x30, 0xE3, 0x92, 0xB7, 0x34, 0x25, 0x76,
+	0xC7, 0xEC, 0x3E, 0x2D, 0xB5, 0xA8, 0x3A, 0x4E, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C,
+	0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A,
+	0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21,
+	0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1E, 0x9A, 0x0C,
+	0x66, 0x22, 0x00, 0x1E, 0x9A, 0x0C, 0x66, 0x22, 0x00, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE,
+	0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A,
+	0x0C, 0x3A, 0x9A, 0x0C, 0x66, 0x29, 0x02, 0xDA, 0xEC, 0x08, 0x1E, 0x9A, 0x0C, 0x76, 0x59, 0x00,
+	0xCA, 0xEC, 0x08, 0xFE, 0x9A, 0x0C, 0x82, 0x9A, 0x0C, 0x76, 0xB2, 0x00, 0xEA, 0x9A, 0x0C, 0x76,
+	0x59, 0x00, 0xCA, 0x0B, 0x01, 0xFE, 0x9A, 0x0C, 0x82, 0x9A, 0x0C, 0x72, 0xB2, 0x00, 0xCE, 0x9E,
+	0x09, 0xA6, 0x9A, 0x0C, 0x66, 0x7B, 0x00, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C,
+	0xEE, 0x9A, 0x0C, 0x1A, 0x9A, 0x0C, 0x66, 0x1D, 0x01, 0xDA, 0xAE, 0x03, 0x1E, 0x9A, 0x0C, 0x76,
+	0x59, 0x00, 0xCA, 0xA3, 0x02, 0xFE, 0x9A, 0x0C, 0x82, 0x9A, 0x0C, 0xFE, 0xB2, 0x00, 0x42, 0xB2,
+	0x00, 0x1E, 0x9A, 0x0C, 0x72, 0x59, 0x00, 0xCE, 0xFC, 0x02, 0xFE, 0x9A, 0x0C, 0x42, 0x9A, 0x0C,
+	0x30, 0x71, 0xED, 0xE9, 0x34, 0x25, 0x0D, 0xDD, 0x16, 0x3F, 0x2D, 0xE8, 0xDB, 0x6D, 0x32, 0x4A,
+	0x09, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0x12, 0x9A, 0x0C, 0x42, 0x81, 0x01,
+	0x66, 0x9A, 0x0C, 0x42, 0x2B, 0x00, 0xFE, 0x9A, 0x0C, 0xD6, 0x9A, 0x0C, 0xAA, 0x87, 0x00, 0xEE,
+	0x9A, 0x0C, 0x00, 0xD1, 0x86, 0x9A, 0x0C, 0x1A, 0x9F, 0x30, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C,
+	0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xB6, 0x9A, 0x0C, 0x30, 0x2C, 0x36, 0x94, 0x3A, 0x25, 0x08,
+	0x3D, 0x9A, 0x3E, 0x2D, 0x01, 0x00, 0x00, 0x32, 0x50, 0x03, 0x1A, 0x34, 0x19, 0x66, 0x21, 0x00,
+	0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66,
+	0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A,
+	0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00,
+	0x1E, 0x9A, 0x0C, 0x66, 0x22, 0x00, 0x1E, 0x9A, 0x0C, 0x66, 0x22, 0x00, 0xFE, 0x9A, 0x0C, 0xFE,
+	0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A,
+	0x0C, 0xFE, 0x9A, 0x0C, 0x3A, 0x9A, 0x0C, 0x66, 0x29, 0x02, 0xDA, 0xEC, 0x08, 0x1E, 0x9A, 0x0C,
+	0x76, 0x59, 0x00, 0xCA, 0xEC, 0x08, 0xFE, 0x9A, 0x0C, 0x82, 0x9A, 0x0C, 0x76, 0xB2, 0x00, 0xEA,
+	0x9A, 0x0C, 0x76, 0x59, 0x00, 0xCA, 0x0B, 0x01, 0xFE, 0x9A, 0x0C, 0x82, 0x9A, 0x0C, 0x72, 0xB2,
+	0x00, 0xCE, 0x9E, 0x09, 0xA6, 0x9A, 0x0C, 0x66, 0x7B, 0x00, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C,
+	0xFE, 0x9A, 0x0C, 0xEE, 0x9A, 0x0C, 0x1A, 0x9A, 0x0C, 0x66, 0x1D, 0x01, 0xDA, 0xAE, 0x03, 0x1E,
+	0x9A, 0x0C, 0x76, 0x59, 0x00, 0xCA, 0xA3, 0x02, 0xFE, 0x9A, 0x0C, 0x82, 0x9A, 0x0C, 0xFE, 0xB2,
+	0x00, 0x42, 0xB2, 0x00, 0x1E, 0x9A, 0x0C, 0x72, 0x59, 0x00, 0xCE, 0xFC, 0x02, 0xFE, 0x9A, 0x0C,
+	0x42, 0x9A, 0x0C, 0x30, 0x0A, 0x7F, 0xCF, 0x3A, 0x25, 0x0B, 0xEF, 0xD7, 0x3E, 0x2D, 0x34, 0x33,
+	0x33, 0x32, 0x4A, 0x09, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0x12, 0x9A, 0x0C,
+	0x42, 0x81, 0x01, 0x66, 0x9A, 0x0C, 0x42, 0x2B, 0x00, 0xFE, 0x9A, 0x0C, 0xD6, 0x9A, 0x0C, 0xAA,
+	0x87, 0x00, 0xEE, 0x9A, 0x0C, 0x00, 0xD2, 0x86, 0x9A, 0x0C, 0x1A, 0xBD, 0x3B, 0xFE, 0x9A, 0x0C,
+	0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xB6, 0x9A, 0x0C, 0x34, 0xC5, 0x24, 0xE8,
+	0x33, 0x25, 0x56, 0xA5, 0x52, 0x3E, 0x2D, 0x72, 0x35, 0xC5, 0x3E, 0x2E, 0x84, 0x2F, 0x1A, 0x9A,
+	0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00,
+	0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66,
+	0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A,
+	0x0C, 0x66, 0x21, 0x00, 0x1E, 0x9A, 0x0C, 0x66, 0x22, 0x00, 0x1E, 0x9A, 0x0C, 0x66, 0x22, 0x00,
+	0x12, 0x9A, 0x0C, 0x04, 0x1A, 0xA0, 0x56, 0xCE, 0x25, 0x00, 0x0B, 0xFE, 0x68, 0x32, 0xFE, 0x68,
+	0x32, 0xFE, 0x68, 0x32, 0xFE, 0x68, 0x32, 0xFE, 0x68, 0x32, 0xFE, 0x68, 0x32, 0xFE, 0x68, 0x32,
+	0xC2, 0x68, 0x32, 0x66, 0x29, 0x02, 0xDA, 0xEC, 0x08, 0x1E, 0x9A, 0x0C, 0x76, 0x59, 0x00, 0xCA,
+	0xEC, 0x08, 0xFE, 0x9A, 0x0C, 0x82, 0x9A, 0x0C, 0x76, 0xB2, 0x00, 0xEA, 0x9A, 0x0C, 0x76, 0x59,
+	0x00, 0xCA, 0x0B, 0x01, 0xFE, 0x9A, 0x0C, 0x82, 0x9A, 0x0C, 0x72, 0xB2, 0x00, 0x00, 0x40, 0xCA,
+	0xB2, 0x00, 0xA6, 0x9A, 0x0C, 0x66, 0x7B, 0x00, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A,
+	0x0C, 0xEE, 0x9A, 0x0C, 0x1A, 0x9A, 0x0C, 0x66, 0x1D, 0x01, 0xDA, 0xAE, 0x03, 0x1E, 0x9A, 0x0C,
+	0x76, 0x59, 0x00, 0xCA, 0xF1, 0x01, 0xFE, 0x9A, 0x0C, 0x82, 0x9A, 0x0C, 0xFE, 0xB2, 0x00, 0x42,
+	0xB2, 0x00, 0x1E, 0x9A, 0x0C, 0x72, 0x59, 0x00, 0xCE, 0xFC, 0x02, 0x1E, 0x9A, 0x0C, 0x00, 0x1C,
+	0x1E, 0x68, 0x32, 0x00, 0x1D, 0xFA, 0x68, 0x32, 0x30, 0x7B, 0x57, 0x30, 0x34, 0x25, 0xF2, 0x02,
+	0xA0, 0x3E, 0x2D, 0xEC, 0xCD, 0x15, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0x22,
+	0x9A, 0x0C, 0x00, 0x12, 0x1E, 0x68, 0x32, 0x42, 0x81, 0x01, 0x66, 0x9A, 0x0C, 0x42, 0x2B, 0x00,
+	0xFE, 0x9A, 0x0C, 0xD6, 0x9A, 0x0C, 0xAA, 0x87, 0x00, 0xEE, 0x9A, 0x0C, 0x00, 0xD3, 0x86, 0x9A,
+	0x0C, 0x1A, 0xDB, 0x46, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C,
+	0xBA, 0x9A, 0x0C, 0x2C, 0x7A, 0xBA, 0x3A, 0x25, 0x47, 0x63, 0xBE, 0x3D, 0x2D, 0x24, 0x9D, 0x5B,
+	0x52, 0x9A, 0x0C, 0x62, 0x21, 0x00, 0x1E, 0x9A, 0x0C, 0x62, 0x21, 0x00, 0x1E, 0x9A, 0x0C, 0x62,
+	0x21, 0x00, 0x1E, 0x9A, 0x0C, 0x62, 0x21, 0x00, 0x1E, 0x9A, 0x0C, 0x62, 0x21, 0x00, 0x1E, 0x9A,
+	0x0C, 0x62, 0x21, 0x00, 0x1E, 0x9A, 0x0C, 0x62, 0x21, 0x00, 0x1E, 0x9A, 0x0C, 0x62, 0x21, 0x00,
+	0x1E, 0x9A, 0x0C, 0x62, 0x21, 0x00, 0x22, 0x9A, 0x0C, 0x62, 0x22, 0x00, 0x22, 0x9A, 0x0C, 0x62,
+	0x22, 0x00, 0x12, 0x9A, 0x0C, 0x00, 0x10, 0x5A, 0x9A, 0x0C, 0xFE, 0x02, 0x3F, 0xFE, 0x02, 0x3F,
+	0xFE, 0x02, 0x3F, 0xFE, 0x02, 0x3F, 0xFE, 0x02, 0x3F, 0xFE, 0x02, 0x3F, 0xFE, 0x02, 0x3F, 0xC6,
+	0x02, 0x3F, 0x66, 0x29, 0x02, 0xDA, 0xEC, 0x08, 0x22, 0x9A, 0x0C, 0x62, 0x82, 0x02, 0x01, 0x59,
+	0xCA, 0xEC, 0x08, 0xFE, 0x9A, 0x0C, 0x86, 0x9A, 0x0C, 0x72, 0xB2, 0x00, 0xEE, 0x9A, 0x0C, 0x72,
+	0x59, 0x00, 0xCA, 0x0B, 0x01, 0xFE, 0x9A, 0x0C, 0x86, 0x9A, 0x0C, 0x6E, 0xB2, 0x00, 0xCE, 0x9E,
+	0x09, 0xAA, 0x9A, 0x0C, 0x62, 0x7B, 0x00, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C,
+	0xFE, 0x9A, 0x0C, 0x0E, 0x9A, 0x0C, 0x62, 0x1D, 0x01, 0x61, 0x55, 0xCA, 0xA3, 0x02, 0x22, 0x9A,
+	0x0C, 0x72, 0x59, 0x00, 0xCA, 0xA3, 0x02, 0xFE, 0x9A, 0x0C, 0x86, 0x9A, 0x0C, 0xFE, 0xB2, 0x00,
+	0x3E, 0xB2, 0x00, 0x22, 0x9A, 0x0C, 0x6E, 0x59, 0x00, 0xCE, 0xFC, 0x02, 0x1E, 0x9A, 0x0C, 0xFE,
+	0x02, 0x3F, 0x22, 0x02, 0x3F, 0x30, 0xAF, 0x30, 0x34, 0x3B, 0x25, 0x73, 0xF7, 0x37, 0x3E, 0x2D,
+	0xF8, 0x34, 0xD4, 0x32, 0x4A, 0x09, 0xFE, 0x34, 0x19, 0xFE, 0x34, 0x19, 0xEE, 0x34, 0x19, 0x26,
+	0x9A, 0x0C, 0x3E, 0x81, 0x01, 0x6A, 0x9A, 0x0C, 0x3E, 0x2B, 0x00, 0xFE, 0x9A, 0x0C, 0xDA, 0x9A,
+	0x0C, 0xA6, 0x87, 0x00, 0xEE, 0x9A, 0x0C, 0x00, 0xCB, 0x12, 0x9A, 0x0C, 0x00, 0xA2, 0x1A, 0x9C,
+	0x4B, 0x14, 0xEC, 0x02, 0x0A, 0x1B, 0x12, 0x13, 0x1E, 0x9C, 0x4B, 0x1C, 0x76, 0x61, 0x6C, 0x75,
+	0x65, 0x61, 0x78, 0x69, 0x2E, 0x9F, 0x4B, 0x00, 0xC6, 0x0E, 0xF6, 0x3F, 0x04, 0x80, 0x3F, 0x1A,
+	0x32, 0x4B, 0x10, 0x89, 0x2E, 0x39, 0x3F, 0x25, 0x01, 0x05, 0x00, 0x2D, 0x01, 0x05, 0x2E, 0x1A,
+	0x18, 0xDA, 0x3C, 0x04, 0x0C, 0x38, 0x13, 0x40, 0x0F, 0x12, 0x4E, 0x6F, 0x12, 0xDC, 0x43, 0x0C,
+	0x7A, 0x00, 0x8A, 0x01, 0x16, 0x10, 0x40, 0x01, 0x5F, 0x62, 0x69, 0x00, 0xCE, 0x21, 0x41, 0x0E,
+	0x95, 0x6F, 0x14, 0x80, 0x3F, 0xAA, 0x01, 0x00, 0xBA, 0x0D, 0x62, 0x72, 0x83, 0x41, 0xCE, 0x07,
+	0x05, 0x04, 0xC8, 0x01, 0x0E, 0x06, 0x6F, 0x04, 0xF0, 0x01, 0x0E, 0xDE, 0x6F, 0x44, 0x88, 0x02,
+	0x00, 0x98, 0x02, 0x00, 0xA8, 0x02, 0x03, 0xB8, 0x02, 0x13, 0xC0, 0x02, 0x14, 0xE0, 0x02, 0x01,
+	0x0E, 0x84, 0x40, 0x08, 0x11, 0x08, 0xCC, 0x92, 0x7E, 0x01, 0x00, 0x31, 0x16, 0xDB, 0x60, 0x04,
+	0x82, 0xF1, 0xFE, 0x7E, 0x01, 0x82, 0x7E, 0x01, 0x08, 0x16, 0x40, 0x17, 0xC2, 0x7E, 0x01, 0xCE,
+	0x1C, 0x01, 0x00, 0x9D, 0x12, 0x1C, 0x70, 0x3D, 0x7E, 0xFE, 0xE0, 0x01, 0x42, 0xE0, 0x01, 0x14,
+	0xC8, 0x01, 0x01, 0xE0, 0x01, 0x00, 0x36, 0x7E, 0x01, 0x18, 0x01, 0xB8, 0x02, 0x16, 0xC0, 0x02,
+	0x18, 0x35, 0x7E, 0x00, 0xF9, 0x32, 0x7E, 0x01, 0x14, 0xF4, 0x02, 0x0A, 0x1E, 0x12, 0x16, 0x49,
+	0xFC, 0x24, 0x32, 0x2D, 0x63, 0x61, 0x74, 0x65, 0x67, 0x6F, 0x72, 0x79, 0x3A, 0xFF, 0x02, 0x08,
+	0xCB, 0x02, 0x0D, 0x0E, 0x7B, 0x44, 0x00, 0x1A, 0x8A, 0x96, 0x02, 0xCE, 0x18, 0x01, 0x18, 0x28,
+	0x00, 0x30, 0x14, 0x38, 0x13, 0x4D, 0x41, 0x8C, 0x00, 0x65, 0x01, 0x68, 0x08, 0x72, 0x00, 0x82,
+	0x4D, 0x9F, 0xFE, 0x21, 0x01, 0x42, 0x21, 0x01, 0x16, 0x9C, 0x72, 0x0C, 0xA2, 0x01, 0x00, 0xB2,
+	0xFE, 0x62, 0x00, 0x5E, 0x62, 0x00, 0x24, 0xC0, 0x01, 0x01, 0xD0, 0x01, 0x00, 0xD8, 0x01, 0x00,
+	0xE8, 0x12, 0x04, 0x72, 0x30, 0x90, 0x02, 0x00, 0xA0, 0x02, 0x02, 0xB0, 0x02, 0x14, 0xB8, 0x02,
+	0x13, 0xC8, 0x0E, 0xE8, 0x72, 0x6D, 0x04, 0x00, 0xF5, 0x25, 0x86, 0x00, 0x9E, 0x8D, 0x82, 0x14,
+	0x8F, 0x1C, 0x0A, 0x15, 0x12, 0x0D, 0x35, 0x86, 0x0E, 0xCE, 0x72, 0x55, 0xFE, 0x04, 0xEF, 0x1B,
+	0x25, 0x7D, 0x74, 0x12, 0xAE, 0x04, 0x0A, 0x07, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x12,
+	0x86, 0x01, 0x0A, 0x0B, 0x46, 0x69, 0x6C, 0x6C, 0x20, 0x43, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x12,
+	0x14, 0x26, 0x7E, 0x73, 0x71, 0xD3, 0x08, 0x80, 0x3F, 0x1A, 0x01, 0x16, 0x00, 0x80, 0x89, 0x94,
+	0x12, 0x60, 0x4D, 0x12, 0x64, 0x71, 0x00, 0x22, 0x52, 0x16, 0x00, 0x14, 0x2D, 0xCD, 0xCC, 0xCC,
+	0x3E, 0x32, 0x01, 0x1B, 0x00, 0x00, 0x16, 0xC5, 0x73, 0x11, 0x31, 0x20, 0x00, 0x00, 0x38, 0x01,
+	0x40, 0x01, 0x4A, 0x16, 0x0A, 0x01, 0x1C, 0x2C, 0x20, 0x41, 0x15, 0x00, 0x00, 0x70, 0x41, 0x1D,
+	0x00, 0x00, 0xF0, 0x41, 0x12, 0xFB, 0x50, 0x4C, 0x12, 0x8A, 0x01, 0x0A, 0x0F, 0x44, 0x69, 0x72,
+	0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x61, 0x6C, 0x20, 0x4B, 0x65, 0x79, 0xEE, 0x8D, 0x00, 0x0D,
+	0x8D, 0x0C, 0x00, 0x00, 0x40, 0x3F, 0x66, 0x8D, 0x00, 0x00, 0x52, 0x01, 0x8D, 0x34, 0x02, 0xBF,
+	0x80, 0xBE, 0x15, 0x28, 0xB9, 0x11, 0xBF, 0x1D, 0x47, 0x64, 0x48, 0xBF, 0x09, 0x8D, 0x0C, 0x85,
+	0x01, 0x0A, 0x0A, 0x25, 0x16, 0x10, 0x52, 0x69, 0x67, 0x68, 0x74, 0xEE, 0x88, 0x00, 0x0D, 0x88,
+	0x08, 0xCD, 0xCC, 0x4C, 0x86, 0x15, 0x01, 0x04, 0xC8, 0x42, 0x0E, 0x2C, 0x08, 0x21, 0x31, 0x1A,
+	0x45, 0x75, 0x10, 0x12, 0x84, 0x01, 0x0A, 0x09, 0x05, 0x88, 0x08, 0x4C, 0x65, 0x66, 0xFE, 0x87,
+	0x00, 0x09, 0x87, 0x04, 0xCC, 0x3D, 0x66, 0x0F, 0x01, 0x2D, 0x9C, 0x04, 0xC8, 0xC2, 0x3A, 0x87,
+	0x00, 0x28, 0x1A, 0xB7, 0x04, 0x0A, 0x0B, 0x4D, 0x65, 0x64, 0x69, 0x75, 0x6D, 0x09, 0x89, 0x01,
+	0x97, 0x10, 0x54, 0x6F, 0x70, 0x20, 0x4C, 0x72, 0x1E, 0x01, 0x10, 0xD3, 0xD1, 0x52, 0x3F, 0x15,
+	0x01, 0x05, 0x51, 0x02, 0x00, 0x80, 0x41, 0x33, 0x01, 0x11, 0x3A, 0x16, 0x00, 0x41, 0x33, 0x86,
+	0x97, 0x00, 0x00, 0x40, 0x41, 0x33, 0x00, 0xC8, 0x16, 0x04, 0x4F, 0x29, 0xA6, 0x0C, 0x8B, 0x01,
+	0x0A, 0x10, 0x25, 0x1E, 0x49, 0xBC, 0x10, 0x20, 0x48, 0x69, 0x67, 0x68, 0x62, 0xAC, 0x01, 0x1C,
+	0x68, 0xC5, 0x74, 0x3F, 0x15, 0xB4, 0x3C, 0x78, 0x36, 0x8E, 0x00, 0x4A, 0x16, 0x00, 0x0C, 0x2D,
+	0x66, 0x66, 0x66, 0x6A, 0x34, 0x02, 0x2D, 0x25, 0x00, 0x48, 0x21, 0x25, 0x00, 0xB4, 0x01, 0x8E,
+	0x04, 0xC8, 0x42, 0x09, 0x8E, 0xFE, 0x34, 0x02, 0xFE, 0x34, 0x02, 0x00, 0x20, 0x0D, 0x88, 0x61,
+	0x49, 0x2E, 0x16, 0x01, 0x08, 0x4C, 0x6F, 0x77, 0x62, 0x15, 0x01, 0xA1, 0x24, 0x12, 0x6A, 0x08,
+	0x32, 0xA3, 0x01, 0x4A, 0x16, 0x00, 0x12, 0xAA, 0x50, 0x82, 0x3A, 0x02, 0x29, 0x15, 0x08, 0xC2,
+	0x1D, 0x00, 0x31, 0x15, 0x20, 0x22, 0xB1, 0x04, 0x0A, 0x0A, 0x53, 0x6F, 0x66, 0x74, 0x4D, 0x2B,
+	0xFE, 0x6E, 0x04, 0xDA, 0x6E, 0x04, 0x00, 0x30, 0x41, 0x3B, 0x00, 0x48, 0x2E, 0xAD, 0x01, 0x21,
+	0x25, 0xFE, 0x6E, 0x04, 0x4E, 0x6E, 0x04, 0x00, 0x80, 0x9E, 0x25, 0x01, 0x2E, 0x8D, 0x00, 0xFE,
+	0x3A, 0x02, 0x4A, 0x3A, 0x02, 0x8A, 0x83, 0x05, 0xFE, 0x6E, 0x04, 0xFE, 0x6E, 0x04, 0x5E, 0x6E,
+	0x04, 0x00, 0x2A, 0xFE, 0x34, 0x02, 0xFE, 0x34, 0x02, 0xFE, 0x34, 0x02, 0xFE, 0x34, 0x02, 0xFE,
+	0x34, 0x02, 0xFE, 0x34, 0x02, 0xFE, 0x34, 0x02, 0xFE, 0x34, 0x02, 0xCA, 0x34, 0x02, 0x00, 0x32,
+	0xFE, 0xD3, 0x08, 0xFE, 0xD3, 0x08, 0xFE, 0xD3, 0x08, 0xFE, 0xD3, 0x08, 0xFE, 0xD3, 0x08, 0xFE,
+	0xD3, 0x08, 0xFE, 0xD3, 0x08, 0xFE, 0xD3, 0x08, 0xBE, 0xD3, 0x08, 0x10, 0x3A, 0xD4, 0x04, 0x0A,
+	0x0D, 0x1A, 0xD3, 0x08, 0x16, 0x3E, 0x08, 0xFE, 0x9C, 0x06, 0x4A, 0x9C, 0x06, 0x08, 0x9A, 0x99,
+	0x99, 0x86, 0xF5, 0x09, 0x04, 0x40, 0xC1, 0x0E, 0x82, 0x53, 0x2E, 0x0A, 0x0B, 0x00, 0xAA, 0xFE,
+	0x0A, 0x0B, 0x52, 0x0A, 0x0B, 0x76, 0xD6, 0x08, 0x3C, 0x5A, 0x36, 0x0A, 0x14, 0x0D, 0x01, 0x01,
+	0xF0, 0x41, 0x15, 0x91, 0x00, 0x20, 0x42, 0x1D, 0xF4, 0x22, 0x97, 0x0B, 0x38, 0x14, 0x0D, 0x31,
+	0x5C, 0xC6, 0x3E, 0x15, 0x26, 0x28, 0x14, 0xBF, 0x1D, 0x6B, 0xB5, 0x37, 0x16, 0x20, 0x0B, 0x10,
+	0x1D, 0xCD, 0xCC, 0x4C, 0x40, 0x26, 0xF6, 0x08, 0x0C, 0x45, 0x64, 0x67, 0x65, 0x7A, 0x2A, 0x0B,
+	0x08, 0xE6, 0x0E, 0x66, 0x1E, 0x69, 0x08, 0x00, 0xF8, 0x1A, 0xA3, 0x7D, 0x04, 0x22, 0x14, 0x4E,
+	0x16, 0x00, 0x96, 0x2A, 0x0B, 0x00, 0x48, 0x0E, 0x2A, 0x0B, 0x00, 0xA0, 0x21, 0x35, 0x2E, 0x2A,
+	0x0B, 0x05, 0x88, 0x72, 0x2A, 0x0B, 0xFE, 0x87, 0x00, 0x3E, 0x87, 0x00, 0x0E, 0x05, 0x0A, 0x2E,
+	0x87, 0x00, 0x00, 0x55, 0x0E, 0x3B, 0x09, 0x08, 0x5A, 0x00, 0x62, 0x16, 0xDF, 0x0E, 0x0E, 0x87,
+	0x0E, 0x25, 0x26, 0x0E, 0x3E, 0x09, 0x32, 0x0D, 0x81, 0x12, 0x74, 0x09, 0x2E, 0x23, 0x59, 0x96,
+	0x83, 0x12, 0x08, 0x68, 0x00, 0x72, 0x0E, 0x37, 0x80, 0x20, 0x80, 0x3F, 0x85, 0x01, 0x00, 0x00,
+	0x20, 0x41, 0x8D, 0x01, 0x06, 0x5C, 0x42, 0x90, 0x01, 0x00, 0xA0, 0x01, 0x0D, 0xA8, 0x01, 0x0C,
+	0xF0, 0x01, 0x0D, 0xF8, 0x01, 0x00, 0x85, 0x02, 0x00, 0x00, 0xC0, 0x40, 0xD5, 0x07, 0x01, 0x7D,
+	0x0E, 0x25, 0x11, 0x20, 0x10, 0x08, 0xF6, 0xDA, 0x69, 0x12, 0x0A, 0x08, 0xA0, 0x1A, 0x21, 0x0E,
+	0x10, 0x7D, 0x0A, 0x16, 0x12, 0x0E, 0x12, 0x18, 0x0E, 0x20, 0x2D, 0x32, 0x2D, 0x6C, 0x65, 0x67,
+	0x65, 0x6E, 0x64, 0x22, 0x21, 0x0E, 0x10, 0x61, 0x0A, 0x00, 0x10, 0x11, 0x12, 0x0B, 0x0A, 0xC6,
+	0x7A, 0x5D, 0x0E, 0xD8, 0x12, 0x00, 0x00, 0x82, 0x3E, 0x5A, 0x0C, 0x31, 0x08, 0x81, 0xDB, 0x2E,
+	0x95, 0x81, 0xAE, 0xC6, 0x69, 0x00, 0x32, 0x3E, 0x95, 0x81, 0x1A, 0x83, 0x5F, 0x00, 0x50, 0x2A,
+	0x94, 0x81, 0x56, 0xDE, 0x60, 0x66, 0xD7, 0x64, 0xFE, 0xDE, 0x60, 0x82, 0xDE, 0x60, 0x66, 0x7B,
+	0x00, 0xFE, 0xD6, 0x63, 0xCA, 0xD6, 0x63, 0x00, 0x82, 0xFE, 0x7C, 0x01, 0x39, 0x7C, 0x1A, 0x54,
+	0x13, 0xFE, 0x7C, 0x01, 0xFE, 0x7C, 0x01, 0xFE, 0x7C, 0x01, 0xFE, 0x7C, 0x01, 0xA6, 0x7C, 0x01,
+	0x00, 0x8B, 0x32, 0x7C, 0x01, 0xAE, 0xA0, 0x7B, 0x42, 0xF8, 0x02, 0x00, 0x31, 0xA2, 0xF9, 0x02,
+	0x81, 0x05, 0x56, 0x82, 0x04, 0xFE, 0xF9, 0x02, 0x82, 0xF9, 0x02, 0x66, 0x7B, 0x00, 0xFE, 0xF9,
+	0x02, 0xCA, 0xF9, 0x02, 0x00, 0x8C, 0xFE, 0x7D, 0x01, 0x3D, 0x7D, 0xA2, 0xFA, 0x02, 0x66, 0x02,
+	0x01, 0xFE, 0x7D, 0x01, 0xFE, 0x7D, 0x01, 0xFE, 0x7D, 0x01, 0xB6, 0x7D, 0x01, 0x00, 0x8D, 0xFE,
+	0x7D, 0x01, 0x3D, 0x7D, 0x1A, 0xB4, 0x4B, 0x2E, 0x77, 0x04, 0x00, 0xF0, 0xFE, 0xA0, 0x7B, 0xFE,
+	0xA0, 0x7B, 0xFE, 0xA0, 0x7B, 0xFE, 0xA0, 0x7B, 0x72, 0xA0, 0x7B, 0x00, 0x8E, 0xFE, 0x7D, 0x01,
+	0x3D, 0x7D, 0x1A, 0x97, 0x40, 0x2E, 0x7D, 0x01, 0x56, 0x70, 0x07, 0xFE, 0xFA, 0x02, 0xFE, 0xFA,
+	0x02, 0xFE, 0xFA, 0x02, 0xFE, 0xFA, 0x02, 0x51, 0xFA, 0x00, 0x8F, 0xFE, 0x7D, 0x01, 0x3D, 0x7D,
+	0x00, 0x34, 0x16, 0xA6, 0x09, 0xFE, 0x7D, 0x01, 0xFE, 0x7D, 0x01, 0xFE, 0x7D, 0x01, 0xFE, 0x7D,
+	0x01, 0xA6, 0x7D, 0x01, 0x00, 0x90, 0xFE, 0x7D, 0x01, 0x3D, 0x7D, 0x1A, 0x5D, 0x2A, 0x2E, 0x7D,
+	0x01, 0xFE, 0xAC, 0x75, 0xFE, 0xAC, 0x75, 0xFE, 0xAC, 0x75, 0xFE, 0xAC, 0x75, 0x76, 0xAC, 0x75,
+	0x00, 0x91, 0xFE, 0x7D, 0x01, 0x3D, 0x7D, 0xA2, 0x39, 0x71, 0x66, 0x83, 0x8B, 0xFE, 0x71, 0x07,
+	0x82, 0x71, 0x07, 0x66, 0x7B, 0x00, 0xFE, 0xEE, 0x08, 0xCA, 0xEE, 0x08, 0x00, 0x92, 0xFE, 0x7D,
+	0x01, 0x3D, 0x7D, 0x4A, 0x3A, 0x71, 0xFE, 0xFA, 0x02, 0xFE, 0xFA, 0x02, 0xFE, 0xFA, 0x02, 0xFE,
+	0xFA, 0x02, 0x76, 0xFA, 0x02, 0x00, 0x93, 0xFE, 0x7D, 0x01, 0x3D, 0x7D, 0xFE, 0x3B, 0x71, 0xFE,
+	0x3B, 0x71, 0xFE, 0x3B, 0x71, 0xFE, 0x3B, 0x71, 0xC2, 0x3B, 0x71, 0x00, 0x94, 0xFE, 0x7D, 0x01,
+	0x3D, 0x7D, 0x4A, 0x3C, 0x71, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE,
+	0x8B, 0x76, 0xFE, 0x8B, 0x00, 0x83, 0x32, 0x7D, 0x01, 0xF2, 0xDA, 0x11, 0x4A, 0xE7, 0x0B, 0x56,
+	0x6A, 0x0A, 0x66, 0x58, 0x69, 0xFE, 0xF3, 0x05, 0x82, 0xF3, 0x05, 0x66, 0x7B, 0x00, 0xFE, 0xF3,
+	0x05, 0xCA, 0xF3, 0x05, 0x00, 0x95, 0x32, 0x7C, 0x01, 0xF2, 0x5E, 0x10, 0xFE, 0xFE, 0x8B, 0xFE,
+	0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xC6, 0xFE, 0x8B, 0x00, 0x96, 0xFE, 0x7D, 0x01,
+	0x3D, 0x7D, 0x4A, 0x5E, 0x10, 0xFE, 0x70, 0x07, 0xFE, 0x70, 0x07, 0xFE, 0x70, 0x07, 0xFE, 0x70,
+	0x07, 0x76, 0x70, 0x07, 0x00, 0x97, 0xFE, 0x7D, 0x01, 0x3D, 0x7D, 0x4A, 0x77, 0x04, 0xFE, 0x5E,
+	0x10, 0xFE, 0x5E, 0x10, 0xFE, 0x5E, 0x10, 0xFE, 0x5E, 0x10, 0x76, 0x5E, 0x10, 0x00, 0x98, 0xFE,
+	0x7D, 0x01, 0x3D, 0x7D, 0x4A, 0x5E, 0x10, 0xFE, 0xFA, 0x02, 0xFE, 0xFA, 0x02, 0xFE, 0xFA, 0x02,
+	0xFE, 0xFA, 0x02, 0x76, 0xFA, 0x02, 0x00, 0x99, 0xFE, 0x7D, 0x01, 0x3D, 0x7D, 0x4A, 0x5E, 0x10,
+	0xFE, 0x7D, 0x01, 0xFE, 0x7D, 0x01, 0xFE, 0x7D, 0x01, 0xFE, 0x7D, 0x01, 0x76, 0x7D, 0x01, 0x00,
+	0x9A, 0xFE, 0x7D, 0x01, 0x3D, 0x7D, 0xFE, 0x5E, 0x10, 0xFE, 0x5E, 0x10, 0xFE, 0x5E, 0x10, 0xFE,
+	0x5E, 0x10, 0xC2, 0x5E, 0x10, 0x00, 0x9B, 0xFE, 0x7D, 0x01, 0x3D, 0x7D, 0xFE, 0x5E, 0x10, 0xFE,
+	0x5E, 0x10, 0xFE, 0x5E, 0x10, 0xFE, 0x5E, 0x10, 0xC2, 0x5E, 0x10, 0x00, 0x9C, 0xFE, 0x7D, 0x01,
+	0x3D, 0x7D, 0x4A, 0x5E, 0x10, 0x56, 0xE8, 0x0B, 0x66, 0x47, 0x1D, 0xFE, 0xE8, 0x0B, 0x82, 0xE8,
+	0x0B, 0x66, 0x7B, 0x00, 0xFE, 0xE8, 0x0B, 0xCA, 0xE8, 0x0B, 0x00, 0x9D, 0xFE, 0x7D, 0x01, 0x3D,
+	0x7D, 0x4A, 0x5E, 0x10, 0xFE, 0xF4, 0x05, 0xFE, 0xF4, 0x05, 0xFE, 0xF4, 0x05, 0xFE, 0xF4, 0x05,
+	0x76, 0xF4, 0x05, 0x00, 0x9E, 0xFE, 0x7D, 0x01, 0x3D, 0x7D, 0x4A, 0x5E, 0x10, 0xFE, 0x7D, 0x01,
+	0xFE, 0x7D, 0x01, 0xFE, 0x7D, 0x01, 0xFE, 0x7D, 0x01, 0x76, 0x7D, 0x01, 0x00, 0x84, 0x32, 0x7D,
+	0x01, 0xF2, 0x5E, 0x10, 0x4A, 0x6A, 0x0A, 0x56, 0x76, 0x04, 0xFE, 0xC8, 0x1A, 0xFE, 0xC8, 0x1A,
+	0xFE, 0xC8, 0x1A, 0xFE, 0xC8, 0x1A, 0x1E, 0xC8, 0x1A, 0x00, 0x85, 0xFE, 0x7C, 0x01, 0x39, 0x7C,
+	0x4A, 0x69, 0x0A, 0x56, 0x7C, 0x01, 0x66, 0x5F, 0x11, 0xFE, 0xF2, 0x05, 0x82, 0xF2, 0x05, 0x66,
+	0x7B, 0x00, 0xFE, 0xF2, 0x05, 0xCA, 0xF2, 0x05, 0x00, 0x86, 0xFE, 0x7C, 0x01, 0x39, 0x7C, 0x4A,
+	0x68, 0x0A, 0x56, 0x7C, 0x01, 0xFE, 0xF8, 0x02, 0xFE, 0xF8, 0x02, 0xFE, 0xF8, 0x02, 0xFE, 0xF8,
+	0x02, 0x51, 0xF8, 0x00, 0x87, 0xFE, 0x7C, 0x01, 0x39, 0x7C, 0xA2, 0x67, 0x0A, 0x66, 0x6F, 0x08,
+	0xFE, 0xF8, 0x02, 0x82, 0xF8, 0x02, 0x66, 0x7B, 0x00, 0xFE, 0xF8, 0x02, 0xCA, 0xF8, 0x02, 0x00,
+	0x88, 0xFE, 0x7C, 0x01, 0x39, 0x7C, 0xA2, 0x66, 0x0A, 0x66, 0xF9, 0x03, 0xFE, 0x7C, 0x01, 0x82,
+	0x7C, 0x01, 0x66, 0x7B, 0x00, 0xFE, 0x7C, 0x01, 0xCA, 0x7C, 0x01, 0x00, 0x89, 0xFE, 0x7C, 0x01,
+	0x39, 0x7C, 0x4A, 0x65, 0x0A, 0xFE, 0x74, 0x04, 0xFE, 0x74, 0x04, 0xFE, 0x74, 0x04, 0xFE, 0x74,
+	0x04, 0x76, 0x74, 0x04, 0x00, 0x8A, 0xFE, 0x7C, 0x01, 0x39, 0x7C, 0x4A, 0x64, 0x0A, 0x56, 0x7C,
+	0x01, 0x66, 0x7D, 0x02, 0xFE, 0xF8, 0x02, 0xFE, 0xF8, 0x02, 0xFE, 0xF8, 0x02, 0xAE, 0xF8, 0x02,
+	0x0C, 0x11, 0x08, 0x9F, 0xDB, 0x5E, 0xFE, 0x8B, 0x00, 0x32, 0xFE, 0xFE, 0x8B, 0xE6, 0xFE, 0x8B,
+	0x00, 0xFA, 0x12, 0xE0, 0x3B, 0x1E, 0xFE, 0x8B, 0x04, 0xE9, 0x18, 0x26, 0xFE, 0x8B, 0x00, 0x32,
+	0x46, 0xFE, 0x8B, 0x00, 0xC2, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE,
+	0x8B, 0xA6, 0xFE, 0x8B, 0x30, 0xCB, 0xC3, 0xC1, 0x3E, 0x25, 0x53, 0x27, 0x59, 0x3F, 0x2D, 0x48,
+	0x27, 0x59, 0x32, 0xB2, 0x43, 0x1A, 0x96, 0x59, 0x66, 0x21, 0x00, 0x1A, 0xFC, 0x4C, 0x66, 0x21,
+	0x00, 0x1A, 0xFC, 0x4C, 0x66, 0x21, 0x00, 0x1A, 0xFC, 0x4C, 0x66, 0x21, 0x00, 0x1A, 0xFC, 0x4C,
+	0x66, 0x21, 0x00, 0x1A, 0xFC, 0x4C, 0x66, 0x21, 0x00, 0x1A, 0xFC, 0x4C, 0x66, 0x21, 0x00, 0x1A,
+	0xFC, 0x4C, 0x66, 0x21, 0x00, 0x1A, 0xFC, 0x4C, 0x66, 0x21, 0x00, 0x1E, 0xFC, 0x4C, 0x66, 0x22,
+	0x00, 0x1E, 0xFC, 0x4C, 0x66, 0x22, 0x00, 0x1E, 0xFC, 0x4C, 0xFE, 0xFE, 0x8B, 0xEA, 0xFE, 0x8B,
+	0x16, 0xD8, 0x84, 0x0E, 0x59, 0x8B, 0x04, 0x00, 0x00, 0x16, 0x35, 0x8C, 0xFE, 0xFE, 0x8B, 0xFE,
+	0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xE6, 0xFE, 0x8B, 0x66, 0x29,
+	0x02, 0xDA, 0x34, 0x33, 0x1E, 0xFC, 0x4C, 0x76, 0x59, 0x00, 0x00, 0x40, 0xC6, 0x8D, 0x33, 0xFE,
+	0xFC, 0x4C, 0x82, 0xFC, 0x4C, 0x76, 0xB2, 0x00, 0xCA, 0x3F, 0x34, 0x1E, 0x64, 0x7F, 0x76, 0x59,
+	0x00, 0xCA, 0x0B, 0x01, 0xFE, 0xFC, 0x4C, 0x82, 0xFC, 0x4C, 0x72, 0xB2, 0x00, 0xCE, 0x00, 0x4A,
+	0xA6, 0xFC, 0x4C, 0x66, 0x7B, 0x00, 0xFE, 0xFC, 0x4C, 0xFE, 0xFC, 0x4C, 0xA6, 0xFC, 0x4C, 0xAA,
+	0xA1, 0x8E, 0x96, 0x89, 0x36, 0x1E, 0xFE, 0x8B, 0x66, 0x1D, 0x01, 0xDA, 0xAE, 0x03, 0x1E, 0xFC,
+	0x4C, 0x76, 0x59, 0x00, 0xCA, 0xA3, 0x02, 0x1E, 0xFC, 0x4C, 0xFE, 0x0B, 0x01, 0x42, 0x0B, 0x01,
+	0x1E, 0xFE, 0x8B, 0xFE, 0xB2, 0x00, 0x42, 0xB2, 0x00, 0x1E, 0xFC, 0x4C, 0x72, 0x59, 0x00, 0xCE,
+	0xFC, 0x02, 0xFE, 0xFC, 0x4C, 0x42, 0xFC, 0x4C, 0x0C, 0x5E, 0x6D, 0xE4, 0x3E, 0x12, 0x12, 0x46,
+	0x0C, 0x2D, 0xF3, 0xFF, 0x7F, 0x32, 0x4A, 0x09, 0x0E, 0x49, 0x44, 0xCA, 0xAD, 0x01, 0xFE, 0xFE,
+	0x8B, 0xFE, 0xFE, 0x8B, 0x1E, 0xFE, 0x8B, 0x00, 0x00, 0x42, 0xDF, 0x8B, 0x72, 0x8D, 0x01, 0xCE,
+	0x98, 0x02, 0xD6, 0xDF, 0x8B, 0xFE, 0x87, 0x00, 0x42, 0x87, 0x00, 0x56, 0x45, 0x7F, 0x00, 0xFB,
+	0x86, 0x7B, 0x0C, 0x1A, 0xB0, 0x24, 0x04, 0x82, 0xF1, 0xFE, 0x7B, 0x0C, 0xFE, 0x7B, 0x0C, 0xFE,
+	0x7B, 0x0C, 0xFE, 0x7B, 0x0C, 0xAE, 0x7B, 0x0C, 0x30, 0x20, 0x8D, 0x86, 0x34, 0x25, 0xEA, 0xF1,
+	0xF7, 0x3E, 0x2D, 0x9C, 0xA2, 0xED, 0x32, 0x31, 0x03, 0x1A, 0x7B, 0x0C, 0x66, 0x21, 0x00, 0x1A,
+	0x7B, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x7B, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x7B, 0x0C, 0x66, 0x21,
+	0x00, 0x1A, 0x7B, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x7B, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x7B, 0x0C,
+	0x66, 0x21, 0x00, 0x1A, 0x7B, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x7B, 0x0C, 0x66, 0x21, 0x00, 0x1E,
+	0x7B, 0x0C, 0x66, 0x22, 0x00, 0x1E, 0x7B, 0x0C, 0x66, 0x22, 0x00, 0x1E, 0x7B, 0x0C, 0xFE, 0xDF,
+	0x8B, 0xEA, 0xDF, 0x8B, 0xFE, 0x7B, 0x0C, 0xFE, 0x7B, 0x0C, 0xFE, 0x7B, 0x0C, 0xFE, 0x7B, 0x0C,
+	0xFE, 0x7B, 0x0C, 0xFE, 0x7B, 0x0C, 0x2E, 0x7B, 0x0C, 0x66, 0x29, 0x02, 0xDA, 0xCD, 0x08, 0x1E,
+	0x7B, 0x0C, 0x76, 0x59, 0x00, 0xCA, 0x20, 0x07, 0xFE, 0x7B, 0x0C, 0x82, 0x7B, 0x0C, 0x76, 0xB2,
+	0x00, 0xEA, 0x7B, 0x0C, 0x76, 0x59, 0x00, 0xCA, 0x0B, 0x01, 0xFE, 0x7B, 0x0C, 0x82, 0x7B, 0x0C,
+	0x72, 0xB2, 0x00, 0xCE, 0x7F, 0x09, 0xA6, 0x7B, 0x0C, 0x66, 0x7B, 0x00, 0xFE, 0x7B, 0x0C, 0xFE,
+	0x7B, 0x0C, 0xFE, 0x7B, 0x0C, 0xEE, 0x7B, 0x0C, 0x1A, 0x7B, 0x0C, 0x66, 0x1D, 0x01, 0xDA, 0xAE,
+	0x03, 0x1E, 0x7B, 0x0C, 0x76, 0x59, 0x00, 0xCA, 0xA3, 0x02, 0xFE, 0x7B, 0x0C, 0x82, 0x7B, 0x0C,
+	0xFE, 0xB2, 0x00, 0x42, 0xB2, 0x00, 0x1E, 0x7B, 0x0C, 0x72, 0x59, 0x00, 0xCE, 0xFC, 0x02, 0xFE,
+	0x7B, 0x0C, 0x42, 0x7B, 0x0C, 0x30, 0xC9, 0x1E, 0xBE, 0x34, 0x25, 0x28, 0x2C, 0x2F, 0x3F, 0x2D,
+	0x7F, 0xE3, 0x27, 0x3E, 0x41, 0x57, 0xFE, 0x7B, 0x0C, 0xFE, 0x7B, 0x0C, 0xFE, 0x7B, 0x0C, 0x36,
+	0x7B, 0x0C, 0x72, 0x8D, 0x01, 0xCE, 0x98, 0x02, 0xD6, 0x7B, 0x0C, 0xFE, 0x87, 0x00, 0x42, 0x87,
+	0x00, 0x56, 0x7B, 0x0C, 0x00, 0xFC, 0x86, 0x7B, 0x0C, 0x1A, 0xAE, 0x2F, 0xFE, 0x7B, 0x0C, 0xFE,
+	0x7B, 0x0C, 0xFE, 0x7B, 0x0C, 0xFE, 0x7B, 0x0C, 0xB6, 0x7B, 0x0C, 0x34, 0x7F, 0x8D, 0xE7, 0x3D,
+	0x25, 0xE0, 0x99, 0x31, 0x3F, 0x2D, 0x96, 0x15, 0xE1, 0x3A, 0x2E, 0x72, 0x5A, 0x1A, 0x7B, 0x0C,
+	0x66, 0x21, 0x00, 0x1A, 0x7B, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x7B, 0x0C, 0x66, 0x21, 0x00, 0x1A,
+	0x7B, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x7B, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x7B, 0x0C, 0x66, 0x21,
+	0x00, 0x1A, 0x7B, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x7B, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x7B, 0x0C,
+	0x66, 0x21, 0x00, 0x1E, 0x7B, 0x0C, 0x66, 0x22, 0x00, 0x1E, 0x7B, 0x0C, 0x66, 0x22, 0x00, 0xFE,
+	0x7B, 0x0C, 0xFE, 0x7B, 0x0C, 0xFE, 0x7B, 0x0C, 0xFE, 0x7B, 0x0C, 0xFE, 0x7B, 0x0C, 0xFE, 0x7B,
+	0x0C, 0xFE, 0x7B, 0x0C, 0xFE, 0x7B, 0x0C, 0x3A, 0x7B, 0x0C, 0x66, 0x29, 0x02, 0xDA, 0xCD, 0x08,
+	0x1E, 0x7B, 0x0C, 0x76, 0x59, 0x00, 0xCA, 0xCD, 0x08, 0xFE, 0x7B, 0x0C, 0x82, 0x7B, 0x0C, 0x76,
+	0xB2, 0x00, 0xEA, 0x7B, 0x0C, 0x76, 0x59, 0x00, 0xCA, 0x0B, 0x01, 0xFE, 0x7B, 0x0C, 0x82, 0x7B,
+	0x0C, 0x72, 0xB2, 0x00, 0xCE, 0x7F, 0x09, 0xA6, 0x7B, 0x0C, 0x66, 0x7B, 0x00, 0xFE, 0x7B, 0x0C,
+	0xFE, 0x7B, 0x0C, 0xFE, 0x7B, 0x0C, 0xEE, 0x7B, 0x0C, 0x1A, 0x7B, 0x0C, 0x66, 0x1D, 0x01, 0xDA,
+	0xAE, 0x03, 0x1E, 0x7B, 0x0C, 0x76, 0x59, 0x00, 0xCA, 0xA3, 0x02, 0xFE, 0x7B, 0x0C, 0x82, 0x7B,
+	0x0C, 0xFE, 0xB2, 0x00, 0x42, 0xB2, 0x00, 0x1E, 0x7B, 0x0C, 0x72, 0x59, 0x00, 0xCE, 0xFC, 0x02,
+	0xFE, 0x7B, 0x0C, 0x42, 0x7B, 0x0C, 0x34, 0x33, 0x27, 0x15, 0x3E, 0x25, 0x13, 0xCD, 0x64, 0x3F,
+	0x2D, 0x8F, 0xFC, 0x10, 0x3B, 0x2E, 0x4A, 0x09, 0xFE, 0xF6, 0x18, 0xFE, 0xF6, 0x18, 0xFE, 0xF6,
+	0x18, 0x42, 0xF6, 0x18, 0x72, 0x8D, 0x01, 0xCE, 0x98, 0x02, 0xD6, 0x7B, 0x0C, 0xFE, 0x87, 0x00,
+	0x42, 0x87, 0x00, 0x56, 0x7B, 0x0C, 0x00, 0xFD, 0x86, 0x7B, 0x0C, 0x1A, 0x42, 0x30, 0xFE, 0x7B,
+	0x0C, 0xFE, 0x7B, 0x0C, 0xFE, 0x7B, 0x0C, 0xFE, 0x7B, 0x0C, 0xB6, 0x7B, 0x0C, 0x30, 0x45, 0x8B,
+	0xB4, 0x3D, 0x25, 0xD5, 0xA4, 0x67, 0x3F, 0x2D, 0x7F, 0xD9, 0x4F, 0x32, 0xAC, 0x0F, 0x1A, 0x7B,
+	0x0C, 0x66, 0x21, 0x00, 0x1A, 0x7B, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x7B, 0x0C, 0x66, 0x21, 0x00,
+	0x1A, 0x7B, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x7B, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x7B, 0x0C, 0x66,
+	0x21, 0x00, 0x1A, 0x7B, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x7B, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x7B,
+	0x0C, 0x66, 0x21, 0x00, 0x1E, 0x7B, 0x0C, 0x66, 0x22, 0x00, 0x1E, 0x7B, 0x0C, 0x66, 0x22, 0x00,
+	0xFE, 0x7B, 0x0C, 0xFE, 0x7B, 0x0C, 0xFE, 0x7B, 0x0C, 0xFE, 0x7B, 0x0C, 0xFE, 0x7B, 0x0C, 0xFE,
+	0x7B, 0x0C, 0xFE, 0x7B, 0x0C, 0xFE, 0x7B, 0x0C, 0x3A, 0x7B, 0x0C, 0x66, 0x29, 0x02, 0xDA, 0xCD,
+	0x08, 0x1E, 0x7B, 0x0C, 0x76, 0x59, 0x00, 0xCA, 0xCD, 0x08, 0xFE, 0x7B, 0x0C, 0x82, 0x7B, 0x0C,
+	0x76, 0xB2, 0x00, 0xEA, 0x7B, 0x0C, 0x76, 0x59, 0x00, 0xCA, 0x0B, 0x01, 0xFE, 0x7B, 0x0C, 0x82,
+	0x7B, 0x0C, 0x72, 0xB2, 0x00, 0xCE, 0x7F, 0x09, 0xA6, 0x7B, 0x0C, 0x66, 0x7B, 0x00, 0xFE, 0x7B,
+	0x0C, 0xFE, 0x7B, 0x0C, 0xFE, 0x7B, 0x0C, 0xEE, 0x7B, 0x0C, 0x1A, 0x7B, 0x0C, 0x66, 0x1D, 0x01,
+	0xDA, 0xAE, 0x03, 0x1E, 0x7B, 0x0C, 0x76, 0x59, 0x00, 0xCA, 0xA3, 0x02, 0xFE, 0x7B, 0x0C, 0x82,
+	0x7B, 0x0C, 0xFE, 0xB2, 0x00, 0x42, 0xB2, 0x00, 0x1E, 0x7B, 0x0C, 0x72, 0x59, 0x00, 0xCE, 0xFC,
+	0x02, 0xFE, 0x7B, 0x0C, 0x42, 0x7B, 0x0C, 0x0C, 0xFB, 0x86, 0xC7, 0x3D, 0x16, 0x71, 0x25, 0x08,
+	0x31, 0xB4, 0x65, 0x32, 0x4A, 0x09, 0xFE, 0x7B, 0x0C, 0xFE, 0x7B, 0x0C, 0xFE, 0x7B, 0x0C, 0x42,
+	0x7B, 0x0C, 0x72, 0x8D, 0x01, 0xCE, 0x98, 0x02, 0xD6, 0x7B, 0x0C, 0xFE, 0x87, 0x00, 0x42, 0x87,
+	0x00, 0x56, 0x7B, 0x0C, 0x00, 0xFE, 0x86, 0x7B, 0x0C, 0x1A, 0x41, 0x3B, 0xFE, 0x7B, 0x0C, 0xFE,
+	0x7B, 0x0C, 0xFE, 0x7B, 0x0C, 0xFE, 0x7B, 0x0C, 0xB6, 0x7B, 0x0C, 0x30, 0xF5, 0xF7, 0xA5, 0x3B,
+	0x25, 0x3F, 0xB2, 0xE2, 0x3E, 0x2D, 0x3D, 0xA1, 0xE3, 0x4E, 0xF6, 0x18, 0x66, 0x21, 0x00, 0x1A,
+	0x7B, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x7B, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x7B, 0x0C, 0x66, 0x21,
+	0x00, 0x1A, 0x7B, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x7B, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x7B, 0x0C,
+	0x66, 0x21, 0x00, 0x1A, 0x7B, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x7B, 0x0C, 0x66, 0x21, 0x00, 0x1E,
+	0x7B, 0x0C, 0x66, 0x22, 0x00, 0x1E, 0x7B, 0x0C, 0x66, 0x22, 0x00, 0x12, 0x7B, 0x0C, 0xFE, 0x82,
+	0x8B, 0xF6, 0x82, 0x8B, 0xFE, 0x71, 0x25, 0xFE, 0x71, 0x25, 0xFE, 0x71, 0x25, 0xFE, 0x71, 0x25,
+	0xFE, 0x71, 0x25, 0xFE, 0x71, 0x25, 0x2E, 0x71, 0x25, 0x66, 0x29, 0x02, 0xDA, 0xCD, 0x08, 0x1E,
+	0x7B, 0x0C, 0x76, 0x59, 0x00, 0xCA, 0xCD, 0x08, 0xFE, 0x7B, 0x0C, 0x82, 0x7B, 0x0C, 0x76, 0xB2,
+	0x00, 0xEA, 0x7B, 0x0C, 0x76, 0x59, 0x00, 0xCA, 0x0B, 0x01, 0xFE, 0x7B, 0x0C, 0x82, 0x7B, 0x0C,
+	0x72, 0xB2, 0x00, 0xCE, 0x7F, 0x09, 0xA6, 0x7B, 0x0C, 0x66, 0x7B, 0x00, 0xFE, 0x7B, 0x0C, 0xFE,
+	0x7B, 0x0C, 0xFE, 0x7B, 0x0C, 0xEE, 0x7B, 0x0C, 0x1A, 0x7B, 0x0C, 0x66, 0x1D, 0x01, 0xDA, 0xAE,
+	0x03, 0x1E, 0x7B, 0x0C, 0x76, 0x59, 0x00, 0xCA, 0xA3, 0x02, 0xFE, 0x7B, 0x0C, 0x82, 0x7B, 0x0C,
+	0xFE, 0xB2, 0x00, 0x42, 0xB2, 0x00, 0x1E, 0x7B, 0x0C, 0x72, 0x59, 0x00, 0xCE, 0xFC, 0x02, 0x1E,
+	0x7B, 0x0C, 0xFE, 0x82, 0x8B, 0x22, 0x82, 0x8B, 0x30, 0x02, 0xF0, 0xF0, 0x3B, 0x25, 0x53, 0x8C,
+	0x24, 0x3F, 0x2D, 0xCC, 0x39, 0x25, 0xFE, 0xF6, 0x18, 0xFE, 0xF6, 0x18, 0xFE, 0xF6, 0x18, 0x22,
+	0xF6, 0x18, 0x04, 0x12, 0xAA, 0x4A, 0xEC, 0x31, 0x72, 0x8D, 0x01, 0xCE, 0x98, 0x02, 0xD6, 0x7B,
+	0x0C, 0xFE, 0x87, 0x00, 0x42, 0x87, 0x00, 0x56, 0x7B, 0x0C, 0x00, 0xFF, 0x86, 0x7B, 0x0C, 0x1A,
+	0x40, 0x46, 0xFE, 0x7B, 0x0C, 0xFE, 0x7B, 0x0C, 0xFE, 0x7B, 0x0C, 0xFE, 0x7B, 0x0C, 0xB6, 0x7B,
+	0x0C, 0x30, 0xF3, 0xE3, 0xA9, 0x34, 0x25, 0x93, 0xDA, 0x28, 0x3F, 0x2D, 0x9B, 0x82, 0x1D, 0x32,
+	0xAC, 0x0F, 0x1A, 0xF6, 0x18, 0x66, 0x21, 0x00, 0x1A, 0x7B, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x7B,
+	0x0C, 0x66, 0x21, 0x00, 0x1A, 0x7B, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x7B, 0x0C, 0x66, 0x21, 0x00,
+	0x1A, 0x7B, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x7B, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x7B, 0x0C, 0x66,
+	0x21, 0x00, 0x1A, 0x7B, 0x0C, 0x66, 0x21, 0x00, 0x1E, 0x7B, 0x0C, 0x66, 0x22, 0x00, 0x1E, 0x7B,
+	0x0C, 0x66, 0x22, 0x00, 0x12, 0x7B, 0x0C, 0xFE, 0x63, 0x8B, 0xF6, 0x63, 0x8B, 0xFE, 0x7B, 0x0C,
+	0xFE, 0x7B, 0x0C, 0xFE, 0x7B, 0x0C, 0xFE, 0x7B, 0x0C, 0xFE, 0x7B, 0x0C, 0xFE, 0x7B, 0x0C, 0x2E,
+	0x7B, 0x0C, 0x66, 0x29, 0x02, 0xDA, 0xCD, 0x08, 0x1E, 0x7B, 0x0C, 0x76, 0x59, 0x00, 0xCA, 0xCD,
+	0x08, 0xFE, 0x7B, 0x0C, 0x82, 0x7B, 0x0C, 0x76, 0xB2, 0x00, 0xEA, 0x7B, 0x0C, 0x76, 0x59, 0x00,
+	0xCA, 0x0B, 0x01, 0xFE, 0x7B, 0x0C, 0x82, 0x7B, 0x0C, 0x72, 0xB2, 0x00, 0xCE, 0x7F, 0x09, 0xA6,
+	0x7B, 0x0C, 0x66, 0x7B, 0x00, 0xFE, 0x7B, 0x0C, 0xFE, 0x7B, 0x0C, 0xFE, 0x7B, 0x0C, 0xEE, 0x7B,
+	0x0C, 0x1A, 0x7B, 0x0C, 0x66, 0x1D, 0x01, 0xDA, 0xAE, 0x03, 0x1E, 0x7B, 0x0C, 0x76, 0x59, 0x00,
+	0xCA, 0xA3, 0x02, 0xFE, 0x7B, 0x0C, 0x82, 0x7B, 0x0C, 0xFE, 0xB2, 0x00, 0x42, 0xB2, 0x00, 0x1E,
+	0x7B, 0x0C, 0x72, 0x59, 0x00, 0xCE, 0xFC, 0x02, 0x1E, 0x7B, 0x0C, 0xFE, 0x63, 0x8B, 0x22, 0x63,
+	0x8B, 0x30, 0x9E, 0x67, 0xDD, 0x34, 0x25, 0xC6, 0x0D, 0x5C, 0x3F, 0x2D, 0x43, 0x45, 0x4D, 0x32,
+	0x4A, 0x09, 0xFE, 0xF6, 0x18, 0xFE, 0xF6, 0x18, 0xEE, 0xF6, 0x18, 0x52, 0x7B, 0x0C, 0x72, 0x8D,
+	0x01, 0xCE, 0x98, 0x02, 0xD6, 0x7B, 0x0C, 0xFE, 0x87, 0x00, 0x42, 0x87, 0x00, 0x56, 0x7B, 0x0C,
+	0x00, 0xF7, 0x12, 0x7B, 0x0C, 0x4E, 0x44, 0x8B, 0x00, 0x32, 0xFE, 0x44, 0x8B, 0xFE, 0x44, 0x8B,
+	0xFE, 0x44, 0x8B, 0xFE, 0x44, 0x8B, 0xFE, 0x44, 0x8B, 0x8A, 0x44, 0x8B, 0x00, 0xF8, 0x92, 0x7E,
+	0x01, 0x00, 0x31, 0x16, 0x7F, 0x70, 0xFE, 0x44, 0x8B, 0xFE, 0x44, 0x8B, 0xFE, 0x44, 0x8B, 0xFE,
+	0x44, 0x8B, 0xFE, 0x44, 0x8B, 0x42, 0x44, 0x8B, 0x00, 0xA5, 0x12, 0x73, 0x4E, 0x51, 0xFC, 0x00,
+	0xF4, 0x2A, 0x44, 0x8B, 0x00, 0x33, 0xFE, 0x44, 0x8B, 0xFE, 0x44, 0x8B, 0xFE, 0x44, 0x8B, 0xFE,
+	0x44, 0x8B, 0xFE, 0x44, 0x8B, 0xAA, 0x44, 0x8B, 0x00, 0xA1, 0x25, 0x86, 0x4E, 0x44, 0x8B, 0x04,
+	0x33, 0x2D, 0x12, 0x2C, 0x7D, 0x55, 0xFE, 0xFE, 0x44, 0x8B, 0xFE, 0x44, 0x8B, 0xFE, 0x44, 0x8B,
+	0xCE, 0x44, 0x8B, 0x00, 0x5F, 0x1B, 0x00, 0x80, 0x80, 0x04, 0x28, 0x00, 0x40, 0x3F, 0x32, 0x14,
+	0x0D, 0x00, 0x00, 0x00, 0x00, 0x15, 0x01, 0x05, 0x14, 0x1D, 0x00, 0x00, 0x80, 0x3F, 0x25, 0x01,
+	0x0A, 0x58, 0x38, 0x01, 0x40, 0x01, 0x52, 0x16, 0x0A, 0x14, 0x0D, 0x02, 0xBF, 0x80, 0xBE, 0x15,
+	0x28, 0xB9, 0x11, 0xBF, 0x1D, 0x47, 0x64, 0x48, 0xBF, 0x05, 0x1C, 0x3C, 0x12, 0x85, 0x01, 0x0A,
+	0x0A, 0x46, 0x69, 0x6C, 0x6C, 0x20, 0x52, 0x69, 0x67, 0x68, 0x74, 0x12, 0x36, 0x41, 0x00, 0x08,
+	0x00, 0x00, 0x25, 0x01, 0x46, 0x00, 0x1A, 0x01, 0x16, 0x08, 0x80, 0x3F, 0x15, 0x01, 0x0C, 0x11,
+	0x57, 0x08, 0x80, 0x3F, 0x22, 0x52, 0x16, 0x00, 0x10, 0x2D, 0xCD, 0xCC, 0x4C, 0x3E, 0x66, 0x88,
+	0x00, 0x00, 0x4A, 0x01, 0x88, 0x0C, 0x00, 0x00, 0xC8, 0x42, 0x11, 0xA4, 0x05, 0x63, 0x18, 0x00,
+	0x00, 0x12, 0x84, 0x01, 0x0A, 0x09, 0x05, 0x88, 0x08, 0x4C, 0x65, 0x66, 0xFE, 0x87, 0x00, 0x09,
+	0x87, 0x04, 0xCC, 0x3D, 0x86, 0x87, 0x00, 0x00, 0xC2, 0x3A, 0x87, 0x00, 0x28, 0x1A, 0xB7, 0x04,
+	0x0A, 0x0B, 0x4D, 0x65, 0x64, 0x69, 0x75, 0x6D, 0x09, 0x89, 0x01, 0x97, 0x10, 0x54, 0x6F, 0x70,
+	0x20, 0x4C, 0x72, 0x1E, 0x01, 0x10, 0xD3, 0xD1, 0x52, 0x3F, 0x15, 0x01, 0x05, 0x32, 0x1E, 0x01,
+	0x01, 0x11, 0x3A, 0x16, 0x00, 0x04, 0x2D, 0xCD, 0x8E, 0x97, 0x00, 0x08, 0x40, 0x41, 0x15, 0x21,
+	0x23, 0x00, 0x1D, 0x21, 0xBD, 0x29, 0xA6, 0x0C, 0x8B, 0x01, 0x0A, 0x10, 0x25, 0x1E, 0x28, 0x43,
+	0x65, 0x6E, 0x74, 0x65, 0x72, 0x20, 0x48, 0x69, 0x67, 0x68, 0x62, 0xAC, 0x01, 0x1C, 0x68, 0xC5,
+	0x74, 0x3F, 0x15, 0xB4, 0x3C, 0x78, 0x36, 0x8E, 0x00, 0x4A, 0x16, 0x00, 0x0C, 0x2D, 0x66, 0x66,
+	0x66, 0x6A, 0x34, 0x02, 0x2D, 0xAC, 0x00, 0x48, 0x21, 0x25, 0x00, 0xB4, 0x01, 0x8E, 0x04, 0xC8,
+	0x42, 0x09, 0x8E, 0xFE, 0x34, 0x02, 0xFE, 0x34, 0x02, 0x00, 0x20, 0x0D, 0x88, 0x0C, 0x8A, 0x01,
+	0x0A, 0x0F, 0x2E, 0x16, 0x01, 0x08, 0x4C, 0x6F, 0x77, 0x62, 0x15, 0x01, 0x41, 0xBC, 0x96, 0xC1,
+	0x02, 0x08, 0x00, 0x00, 0x00, 0x9E, 0x15, 0x01, 0x04, 0xC2, 0x1D, 0x21, 0xA8, 0x25, 0x15, 0x20,
+	0x22, 0xB1, 0x04, 0x0A, 0x0A, 0x53, 0x6F, 0x66, 0x74, 0x4D, 0x2B, 0x0C, 0x86, 0x01, 0x0A, 0x0B,
+	0x1D, 0x9C, 0xEE, 0x98, 0x00, 0x0D, 0x98, 0x08, 0xCD, 0xCC, 0xCC, 0x86, 0x59, 0x03, 0x00, 0x30,
+	0x41, 0x3B, 0x00, 0x48, 0x2E, 0xAD, 0x01, 0x21, 0x25, 0x38, 0x44, 0x69, 0x72, 0x65, 0x63, 0x74,
+	0x69, 0x6F, 0x6E, 0x61, 0x6C, 0x20, 0x4B, 0x65, 0x79, 0xEE, 0x8D, 0x00, 0x0D, 0x8D, 0x21, 0x4F,
+	0x82, 0x5F, 0x03, 0xFE, 0x3A, 0x02, 0x92, 0x3A, 0x02, 0x8A, 0x15, 0x01, 0xFE, 0x6E, 0x04, 0xFE,
+	0x6E, 0x04, 0x5E, 0x6E, 0x04, 0x00, 0x2A, 0xFE, 0x34, 0x02, 0xFE, 0x34, 0x02, 0xFE, 0x34, 0x02,
+	0xFE, 0x34, 0x02, 0xFE, 0x34, 0x02, 0xFE, 0x34, 0x02, 0xFE, 0x34, 0x02, 0xFE, 0x34, 0x02, 0xCA,
+	0x34, 0x02, 0x2C, 0x32, 0xAE, 0x04, 0x0A, 0x07, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0xFE,
+	0x65, 0x04, 0xDE, 0x65, 0x04, 0x00, 0x20, 0x81, 0x65, 0x18, 0x70, 0x41, 0x1D, 0x00, 0x00, 0xF0,
+	0x41, 0x85, 0xFD, 0xFE, 0x65, 0x04, 0x62, 0x65, 0x04, 0xFE, 0xD3, 0x08, 0xFE, 0xD3, 0x08, 0xFE,
+	0xD3, 0x08, 0xFE, 0xD3, 0x08, 0xEE, 0xD3, 0x08, 0x1A, 0xD3, 0x08, 0x10, 0x3A, 0xD4, 0x04, 0x0A,
+	0x0D, 0x1A, 0xD3, 0x08, 0x16, 0x3E, 0x08, 0xFE, 0x37, 0x02, 0x4A, 0x37, 0x02, 0x08, 0x9A, 0x99,
+	0x99, 0x86, 0x9C, 0x06, 0x14, 0x40, 0xC1, 0x15, 0x00, 0x00, 0x40, 0x2E, 0x37, 0x02, 0x08, 0xAA,
+	0x01, 0x0A, 0xFE, 0x9C, 0x06, 0x4A, 0x9C, 0x06, 0x76, 0xD6, 0x08, 0x3C, 0x5A, 0x36, 0x0A, 0x14,
+	0x0D, 0x01, 0x01, 0xF0, 0x41, 0x15, 0x91, 0x00, 0x20, 0x42, 0x1D, 0xF4, 0x55, 0xC4, 0x38, 0x14,
+	0x0D, 0x31, 0x5C, 0xC6, 0x3E, 0x15, 0x26, 0x28, 0x14, 0xBF, 0x1D, 0x6B, 0xB5, 0x37, 0x16, 0x20,
+	0x0B, 0x10, 0x1D, 0xCD, 0xCC, 0x4C, 0x40, 0x49, 0xE4, 0x0E, 0xF6, 0x08, 0x0C, 0x45, 0x64, 0x67,
+	0x65, 0x7A, 0x2A, 0x0B, 0x08, 0xE6, 0x0E, 0x66, 0x1E, 0x69, 0x08, 0x04, 0xF8, 0x7F, 0x0E, 0x81,
+	0x0B, 0x12, 0x2A, 0x0B, 0x4A, 0x16, 0x00, 0x96, 0x2A, 0x0B, 0x00, 0x48, 0x0E, 0x2A, 0x0B, 0x00,
+	0xA0, 0x21, 0x35, 0x2E, 0x2A, 0x0B, 0x05, 0x88, 0x72, 0x2A, 0x0B, 0x4A, 0x71, 0x00, 0x04, 0x22,
+	0x14, 0x4E, 0x16, 0x00, 0x9A, 0x87, 0x00, 0x0E, 0x05, 0x0A, 0x2E, 0x87, 0x00, 0x00, 0x55, 0x0E,
+	0x02, 0x08, 0x1C, 0x5A, 0x00, 0x62, 0x56, 0x0A, 0x1D, 0x08, 0x01, 0x26, 0xAA, 0x0A, 0x0E, 0x3E,
+	0x09, 0x04, 0x00, 0x35, 0x01, 0x1C, 0x08, 0x60, 0x01, 0x6D, 0x01, 0x07, 0x12, 0x74, 0x09, 0x08,
+	0x18, 0x00, 0x20, 0x01, 0x1A, 0x14, 0x80, 0x40, 0x32, 0x27, 0x08, 0x01, 0x12, 0x73, 0x0B, 0x00,
+	0x18, 0x16, 0xD9, 0x0A, 0x25, 0x5A, 0x4E, 0x05, 0x00, 0x10, 0x68, 0x00, 0x72, 0x00, 0x7D, 0x01,
+	0x40, 0x18, 0x85, 0x01, 0x00, 0x00, 0x20, 0x41, 0x8D, 0x01, 0x06, 0x5C, 0x42, 0x90, 0x01, 0x00,
+	0xA0, 0x01, 0x0D, 0xA8, 0x01, 0x0C, 0xF0, 0x01, 0x0D, 0xF8, 0x01, 0x00, 0x85, 0x02, 0x00, 0x00,
+	0xC0, 0x40, 0xD5, 0x07, 0x0E, 0x27, 0x0B, 0xD0, 0x88, 0xF1, 0x04, 0x01, 0x10, 0x08, 0xA2, 0xDB,
+	0x69, 0x12, 0x0A, 0x08, 0xA0, 0x27, 0x12, 0x03, 0x01, 0x00, 0x05, 0x18, 0x7D, 0x0A, 0x16, 0x12,
+	0x0E, 0x63, 0x68, 0x61, 0x72, 0x74, 0x2D, 0x33, 0x2D, 0x6C, 0x65, 0x67, 0x65, 0x6E, 0x64, 0x2A,
+	0x04, 0x08, 0x85, 0xE0, 0x69, 0x82, 0xF1, 0x04, 0x61, 0x0A, 0x00, 0x10, 0x11, 0x12, 0xAE, 0x0B,
+	0x00, 0x2A, 0xC2, 0xC2, 0x00, 0x00, 0x02, 0x92, 0xC2, 0x00, 0x24, 0x31, 0x08, 0xAD, 0xDB, 0x69,
+	0x12, 0x2B, 0x08, 0xE6, 0x0F, 0x09, 0x8E, 0x2C, 0xCA, 0x02, 0x22, 0x08, 0x0A, 0x04, 0x0A, 0x02,
+	0x0B, 0x2B, 0x18, 0x01, 0x0D, 0x0A, 0x10, 0x2F, 0x18, 0x01, 0x22, 0x0A, 0x05, 0x14, 0x20, 0x2E,
+	0x10, 0x03, 0x18, 0x01, 0x0A, 0x20, 0x12, 0x18, 0x11, 0xAF, 0x3C, 0x70, 0x61, 0x72, 0x61, 0x67,
+	0x72, 0x61, 0x70, 0x68, 0x53, 0x74, 0x79, 0x6C, 0x65, 0x5F, 0x30, 0x09, 0xB9, 0x1C, 0x50, 0x39,
+	0x5A, 0xB5, 0x01, 0x08, 0x00, 0x10, 0x0E, 0xDD, 0x0D, 0x44, 0x40, 0x41, 0x2A, 0x0D, 0x48, 0x65,
+	0x6C, 0x76, 0x65, 0x74, 0x69, 0x63, 0x61, 0x4E, 0x65, 0x75, 0x65, 0x3A, 0x21, 0x89, 0x24, 0xC7,
+	0xFF, 0x7F, 0x3F, 0x25, 0xFF, 0xFF, 0x7F, 0x3F, 0x2D, 0x01, 0x05, 0x2E, 0x89, 0x01, 0x28, 0x40,
+	0x01, 0x50, 0x00, 0x58, 0x00, 0x60, 0x00, 0x68, 0x00, 0x75, 0x21, 0x31, 0x00, 0x7D, 0x01, 0x05,
+	0x28, 0x80, 0x01, 0x01, 0xA0, 0x01, 0x01, 0xB0, 0x01, 0x01, 0xC5, 0x01, 0x21, 0x6C, 0x10, 0xC8,
+	0x01, 0x01, 0xDD, 0x01, 0x01, 0x18, 0x0C, 0xE0, 0x01, 0x01, 0xF5, 0x05, 0x12, 0x2C, 0xF8, 0x01,
+	0x00, 0x80, 0x02, 0x00, 0x88, 0x02, 0x01, 0x98, 0x02, 0xFF, 0x11, 0x01, 0x48, 0x01, 0xA0, 0x02,
+	0x01, 0xB0, 0x02, 0x01, 0xC0, 0x02, 0x00, 0xC8, 0x02, 0x00, 0xD8, 0x02, 0x01, 0xF2, 0x02, 0x1F,
+	0x45, 0x04, 0x66, 0x7B, 0x00, 0x44, 0xF8, 0x02, 0x00, 0x62, 0x6C, 0x08, 0x02, 0x1A, 0x01, 0x2E,
+	0x25, 0x00, 0x00, 0x10, 0x42, 0x28, 0x01, 0x3D, 0x01, 0x65, 0x18, 0x40, 0x01, 0x48, 0x00, 0x50,
+	0x00, 0x5D, 0x01, 0x0B, 0x20, 0x6A, 0x00, 0x70, 0x00, 0x78, 0x00, 0x8A, 0x01, 0x0A, 0x26, 0xBF,
+	0x0E, 0x00, 0x95, 0x05, 0x80, 0x00, 0x9D, 0x05, 0x8F, 0x00, 0xA5, 0x05, 0x06, 0x00, 0xAD, 0x05,
+	0x06, 0x1C, 0xCA, 0x01, 0x00, 0xD0, 0x01, 0x01, 0xD8, 0x01, 0x01, 0x8E, 0x6C, 0x0F, 0xE0, 0x01,
+	0x00, 0xF8, 0x01, 0x01, 0xB8, 0x02, 0x01, 0xC8, 0x02, 0x01, 0xD8, 0x02, 0x00, 0xE0, 0x02, 0x00,
+	0xE8, 0x02, 0x00, 0xF0, 0x02, 0x00, 0x31, 0x08, 0xAE, 0xFE, 0x7C, 0x01, 0x39, 0x7C, 0x00, 0x31,
+	0xFE, 0x7C, 0x01, 0xFE, 0x7C, 0x01, 0xFE, 0x7C, 0x01, 0xFE, 0x7C, 0x01, 0xBE, 0x7C, 0x01, 0x00,
+	0xB7, 0x32, 0x7C, 0x01, 0x00, 0xCB, 0x86, 0xF8, 0x02, 0x08, 0x21, 0x12, 0x19, 0x5A, 0xF8, 0x02,
+	0x00, 0x31, 0xA2, 0xF9, 0x02, 0x41, 0x47, 0x85, 0x49, 0x42, 0x82, 0x04, 0xFE, 0xF9, 0x02, 0x82,
+	0xF9, 0x02, 0x66, 0x7B, 0x00, 0xFE, 0xF9, 0x02, 0xCA, 0xF9, 0x02, 0x00, 0xB8, 0xFE, 0x7D, 0x01,
+	0x3D, 0x7D, 0xA2, 0xFA, 0x02, 0x66, 0x02, 0x01, 0xFE, 0x7D, 0x01, 0xFE, 0x7D, 0x01, 0xFE, 0x7D,
+	0x01, 0xB6, 0x7D, 0x01, 0x00, 0xB9, 0xFE, 0x7D, 0x01, 0x3D, 0x7D, 0x00, 0x32, 0x46, 0x77, 0x04,
+	0x00, 0xF0, 0x52, 0xF3, 0x05, 0xFE, 0x7D, 0x01, 0xFE, 0x7D, 0x01, 0xFE, 0x7D, 0x01, 0xFE, 0x7D,
+	0x01, 0x31, 0x7D, 0x00, 0xBA, 0xFE, 0x7D, 0x01, 0x3D, 0x7D, 0x00, 0x33, 0x46, 0x7D, 0x01, 0x56,
+	0x70, 0x07, 0xFE, 0x7D, 0x01, 0xFE, 0x7D, 0x01, 0xFE, 0x7D, 0x01, 0xFE, 0x7D, 0x01, 0x31, 0x7D,
+	0x00, 0xBB, 0xFE, 0x7D, 0x01, 0x3D, 0x7D, 0x00, 0x34, 0xFE, 0x7D, 0x01, 0xFE, 0x7D, 0x01, 0xFE,
+	0x7D, 0x01, 0xFE, 0x7D, 0x01, 0xBE, 0x7D, 0x01, 0x00, 0xBC, 0xFE, 0x7D, 0x01, 0x3D, 0x7D, 0x00,
+	0x35, 0x46, 0x7D, 0x01, 0x00, 0x20, 0xFE, 0x77, 0x04, 0xFE, 0x77, 0x04, 0xFE, 0x77, 0x04, 0xFE,
+	0x77, 0x04, 0x72, 0x77, 0x04, 0x00, 0xBD, 0xFE, 0x7D, 0x01, 0x3D, 0x7D, 0x00, 0x36, 0x46, 0x7D,
+	0x01, 0x56, 0x77, 0x04, 0x04, 0x09, 0xFA, 0x1A, 0x5B, 0x0E, 0x0C, 0x2D, 0x03, 0xF8, 0x7F, 0xFE,
+	0xE7, 0x0B, 0xB6, 0xE7, 0x0B, 0x66, 0x7B, 0x00, 0xFE, 0xEE, 0x08, 0xCA, 0xEE, 0x08, 0x00, 0xBE,
+	0xFE, 0x7D, 0x01, 0x3D, 0x7D, 0x00, 0x37, 0x46, 0x7D, 0x01, 0xFE, 0xFA, 0x02, 0xFE, 0xFA, 0x02,
+	0xFE, 0xFA, 0x02, 0xFE, 0xFA, 0x02, 0x76, 0xFA, 0x02, 0x00, 0xBF, 0xFE, 0x7D, 0x01, 0x3D, 0x7D,
+	0x00, 0x38, 0x46, 0x7D, 0x01, 0x56, 0xFA, 0x02, 0xFE, 0x71, 0x07, 0xFE, 0x71, 0x07, 0xFE, 0x71,
+	0x07, 0xFE, 0x71, 0x07, 0xF1, 0x71, 0x00, 0xC0, 0xFE, 0x7D, 0x01, 0x3D, 0x7D, 0x00, 0x39, 0x46,
+	0x7D, 0x01, 0x04, 0x00, 0x42, 0x4E, 0x5E, 0x10, 0xFE, 0x7D, 0x01, 0xFE, 0x7D, 0x01, 0xFE, 0x7D,
+	0x01, 0xFE, 0x7D, 0x01, 0x31, 0x7D, 0x00, 0xAF, 0x32, 0x7D, 0x01, 0xF2, 0xDA, 0x11, 0x4A, 0xE7,
+	0x0B, 0x56, 0xF9, 0x02, 0x00, 0x05, 0xB5, 0xF3, 0x00, 0x01, 0xFE, 0xF3, 0x05, 0xBE, 0xF3, 0x05,
+	0x66, 0x7B, 0x00, 0xFE, 0xF3, 0x05, 0xCA, 0xF3, 0x05, 0x00, 0xC1, 0x32, 0x7C, 0x01, 0xF2, 0x5E,
+	0x10, 0x00, 0x32, 0x4A, 0x5E, 0x10, 0xFE, 0xF3, 0x05, 0xFE, 0xF3, 0x05, 0xFE, 0xF3, 0x05, 0xFE,
+	0xF3, 0x05, 0x76, 0xF3, 0x05, 0x00, 0xC2, 0xFE, 0x7D, 0x01, 0x3D, 0x7D, 0x4A, 0x5E, 0x10, 0xFE,
+	0x7D, 0x01, 0xFE, 0x7D, 0x01, 0xFE, 0x7D, 0x01, 0xFE, 0x7D, 0x01, 0x76, 0x7D, 0x01, 0x00, 0xC3,
+	0xFE, 0x7D, 0x01, 0x3D, 0x7D, 0x4A, 0x77, 0x04, 0xFE, 0x5E, 0x10, 0xFE, 0x5E, 0x10, 0xFE, 0x5E,
+	0x10, 0xFE, 0x5E, 0x10, 0x76, 0x5E, 0x10, 0x00, 0xC4, 0xFE, 0x7D, 0x01, 0x3D, 0x7D, 0x4A, 0x5E,
+	0x10, 0xFE, 0xFA, 0x02, 0xFE, 0xFA, 0x02, 0xFE, 0xFA, 0x02, 0xFE, 0xFA, 0x02, 0x76, 0xFA, 0x02,
+	0x00, 0xC5, 0xFE, 0x7D, 0x01, 0x3D, 0x7D, 0x4A, 0x5E, 0x10, 0xFE, 0x7D, 0x01, 0xFE, 0x7D, 0x01,
+	0xFE, 0x7D, 0x01, 0xFE, 0x7D, 0x01, 0x76, 0x7D, 0x01, 0x00, 0xC6, 0xFE, 0x7D, 0x01, 0x3D, 0x7D,
+	0xFE, 0x5E, 0x10, 0xFE, 0x5E, 0x10, 0xFE, 0x5E, 0x10, 0xFE, 0x5E, 0x10, 0xC2, 0x5E, 0x10, 0x00,
+	0xC7, 0xFE, 0x7D, 0x01, 0x3D, 0x7D, 0xFE, 0x5E, 0x10, 0xFE, 0x5E, 0x10, 0xFE, 0x5E, 0x10, 0xFE,
+	0x5E, 0x10, 0xC2, 0x5E, 0x10, 0x00, 0xC8, 0xFE, 0x7D, 0x01, 0x3D, 0x7D, 0x4A, 0x5E, 0x10, 0x56,
+	0xE8, 0x0B, 0x66, 0x47, 0x1D, 0xFE, 0x4C, 0x19, 0x82, 0x4C, 0x19, 0x66, 0x7B, 0x00, 0xFE, 0xE8,
+	0x0B, 0xCA, 0xE8, 0x0B, 0x00, 0xC9, 0xFE, 0x7D, 0x01, 0x3D, 0x7D, 0x4A, 0x5E, 0x10, 0xFE, 0xF4,
+	0x05, 0xFE, 0xF4, 0x05, 0xFE, 0xF4, 0x05, 0xFE, 0xF4, 0x05, 0x76, 0xF4, 0x05, 0x00, 0xCA, 0xFE,
+	0x7D, 0x01, 0x3D, 0x7D, 0x4A, 0x5E, 0x10, 0xFE, 0x7D, 0x01, 0xFE, 0x7D, 0x01, 0xFE, 0x7D, 0x01,
+	0xFE, 0x7D, 0x01, 0x76, 0x7D, 0x01, 0x00, 0xB0, 0x32, 0x7D, 0x01, 0xF2, 0x5E, 0x10, 0x4A, 0x6A,
+	0x0A, 0x56, 0x76, 0x04, 0xFE, 0xDA, 0x11, 0xFE, 0xDA, 0x11, 0xFE, 0xDA, 0x11, 0xFE, 0xDA, 0x11,
+	0x1E, 0xDA, 0x11, 0x00, 0xB1, 0xFE, 0x7C, 0x01, 0x39, 0x7C, 0x4A, 0x69, 0x0A, 0x56, 0x7C, 0x01,
+	0x66, 0x5F, 0x11, 0xFE, 0xF2, 0x05, 0x82, 0xF2, 0x05, 0x66, 0x7B, 0x00, 0xFE, 0xF2, 0x05, 0xCA,
+	0xF2, 0x05, 0x00, 0xB2, 0xFE, 0x7C, 0x01, 0x39, 0x7C, 0x4A, 0x68, 0x0A, 0x56, 0x7C, 0x01, 0xFE,
+	0xF8, 0x02, 0xFE, 0xF8, 0x02, 0xFE, 0xF8, 0x02, 0xFE, 0xF8, 0x02, 0x51, 0xF8, 0x00, 0xB3, 0xFE,
+	0x7C, 0x01, 0x39, 0x7C, 0xA2, 0x67, 0x0A, 0x66, 0x6F, 0x08, 0xFE, 0xF8, 0x02, 0x82, 0xF8, 0x02,
+	0x66, 0x7B, 0x00, 0xFE, 0xF8, 0x02, 0xCA, 0xF8, 0x02, 0x00, 0xB4, 0xFE, 0x7C, 0x01, 0x39, 0x7C,
+	0xA2, 0x66, 0x0A, 0x66, 0xF9, 0x03, 0xFE, 0x7C, 0x01, 0x82, 0x7C, 0x01, 0x66, 0x7B, 0x00, 0xFE,
+	0x7C, 0x01, 0xCA, 0x7C, 0x01, 0x00, 0xB5, 0xFE, 0x7C, 0x01, 0x39, 0x7C, 0x4A, 0x65, 0x0A, 0xFE,
+	0x74, 0x04, 0xFE, 0x74, 0x04, 0xFE, 0x74, 0x04, 0xFE, 0x74, 0x04, 0x76, 0x74, 0x04, 0x00, 0xB6,
+	0xFE, 0x7C, 0x01, 0x39, 0x7C, 0x4A, 0x64, 0x0A, 0x56, 0x7C, 0x01, 0x66, 0x7D, 0x02, 0xFE, 0xF8,
+	0x02, 0xFE, 0xF8, 0x02, 0xFE, 0xF8, 0x02, 0xAE, 0xF8, 0x02, 0x20, 0x11, 0x08, 0xCB, 0xDB, 0x69,
+	0x12, 0x0B, 0x08, 0xA6, 0x1A, 0x2A, 0x2D, 0x14, 0x83, 0x01, 0x0A, 0x1F, 0x12, 0x17, 0x1E, 0x84,
+	0x29, 0x2C, 0x72, 0x65, 0x66, 0x65, 0x72, 0x65, 0x6E, 0x63, 0x65, 0x4C, 0x69, 0x6E, 0x22, 0x7B,
+	0x2C, 0x10, 0x82, 0xF1, 0x04, 0x5E, 0x0A, 0x8A, 0x2B, 0x2D, 0x00, 0xE0, 0xCA, 0xED, 0x2D, 0x20,
+	0x12, 0x00, 0x18, 0x0F, 0x20, 0x0F, 0x11, 0x08, 0xA6, 0x05, 0x95, 0x00, 0xA4, 0x0D, 0x95, 0x14,
+	0x88, 0x19, 0x0A, 0x18, 0x12, 0x10, 0x11, 0x95, 0x14, 0x73, 0x65, 0x72, 0x69, 0x65, 0x73, 0x1E,
+	0x09, 0x2D, 0x34, 0x82, 0xF1, 0x04, 0xE1, 0x18, 0x0A, 0x36, 0x0A, 0x20, 0x0A, 0x0E, 0x08, 0x01,
+	0x12, 0x2A, 0x37, 0x2C, 0x0C, 0x0A, 0x0E, 0x08, 0x02, 0x05, 0x10, 0x04, 0xC0, 0x40, 0x12, 0xA6,
+	0x2D, 0x08, 0x10, 0x00, 0x1A, 0x01, 0x1E, 0x34, 0x40, 0x40, 0x15, 0xCD, 0xCC, 0x4C, 0xBF, 0x2A,
+	0x04, 0x6C, 0x69, 0x6E, 0x65, 0x12, 0xDA, 0x38, 0x00, 0x08, 0x1A, 0x00, 0x22, 0x8A, 0x01, 0x01,
+	0x00, 0x80, 0xCA, 0x01, 0x01, 0xC6, 0x84, 0x2E, 0x96, 0x46, 0x2F, 0x00, 0x32, 0x16, 0x9A, 0x2D,
+	0x20, 0xC9, 0x60, 0x79, 0x3F, 0x25, 0x99, 0x08, 0x3B, 0x3F, 0x42, 0x1C, 0x2B, 0x00, 0x3A, 0x7E,
+	0x21, 0x00, 0x00, 0x42, 0x7E, 0x21, 0x00, 0x00, 0x4A, 0x7E, 0x21, 0x00, 0x00, 0x52, 0x7E, 0x21,
+	0x00, 0x00, 0x5A, 0x7E, 0x21, 0x00, 0x00, 0x62, 0x7E, 0x21, 0x00, 0x00, 0x6A, 0x7E, 0x21, 0x00,
+	0x00, 0x72, 0x7E, 0x21, 0x00, 0x00, 0x7A, 0x7E, 0x21, 0x00, 0x04, 0x82, 0x01, 0x7E, 0x22, 0x00,
+	0x00, 0x8A, 0x82, 0x22, 0x00, 0x44, 0x90, 0x01, 0x01, 0x98, 0x01, 0x10, 0xA0, 0x01, 0x04, 0xA8,
+	0x01, 0x05, 0xB0, 0x01, 0x00, 0xB8, 0x01, 0x02, 0x22, 0x77, 0x2F, 0x38, 0xD0, 0x01, 0x03, 0xD8,
+	0x01, 0x0E, 0xE0, 0x01, 0x06, 0xE8, 0x01, 0x08, 0xF2, 0x01, 0x34, 0x12, 0x50, 0x2F, 0x66, 0x9B,
+	0x0A, 0x10, 0x15, 0x00, 0x00, 0x02, 0x43, 0x12, 0xBD, 0x30, 0x04, 0x20, 0x0A, 0x21, 0xD3, 0x14,
+	0x3F, 0x30, 0x01, 0x38, 0x00, 0xFA, 0xA2, 0x37, 0x00, 0x04, 0x00, 0x00, 0x1D, 0x37, 0x04, 0x82,
+	0x02, 0x9E, 0x6E, 0x00, 0x32, 0x37, 0x00, 0x00, 0x8A, 0xA2, 0x37, 0x00, 0x0C, 0x40, 0x40, 0x20,
+	0x05, 0x15, 0xA5, 0x00, 0x92, 0x8E, 0x37, 0x00, 0x00, 0xF4, 0x0E, 0xBF, 0x3A, 0x05, 0x6E, 0x08,
+	0xCD, 0xCC, 0x0C, 0x05, 0xDC, 0x70, 0x9A, 0x02, 0x00, 0xA2, 0x02, 0x00, 0xAA, 0x02, 0x00, 0xBA,
+	0x02, 0x00, 0xC2, 0x02, 0x00, 0xCA, 0x02, 0x00, 0xD2, 0x02, 0x00, 0xDA, 0x02, 0x00, 0xE2, 0x02,
+	0x00, 0xEA, 0x02, 0x69, 0x94, 0x30, 0xE1, 0x92, 0x12, 0x3F, 0x25, 0x24, 0x82, 0x12, 0x3F, 0x2D,
+	0x6E, 0x82, 0x12, 0x32, 0x12, 0x25, 0x0E, 0x75, 0x34, 0x00, 0x40, 0x2E, 0x82, 0x32, 0x96, 0xC0,
+	0x31, 0x00, 0xF2, 0x0D, 0x59, 0x72, 0x87, 0x01, 0x36, 0xED, 0x03, 0x96, 0x59, 0x00, 0x00, 0xFA,
+	0x0D, 0x59, 0x66, 0x96, 0x03, 0xDA, 0x34, 0x33, 0x04, 0x82, 0x03, 0x29, 0x0B, 0x76, 0x59, 0x00,
+	0x32, 0x0B, 0x01, 0x96, 0x47, 0x04, 0x00, 0x8A, 0x0D, 0x59, 0x14, 0xB3, 0x82, 0x12, 0x3F, 0x25,
+	0xB2, 0x21, 0x64, 0x00, 0xB1, 0xFE, 0x64, 0x01, 0x29, 0x64, 0x00, 0x92, 0x0D, 0x59, 0x76, 0xB2,
+	0x00, 0xCA, 0x51, 0x05, 0x00, 0x9A, 0x92, 0x59, 0x00, 0xCA, 0x0B, 0x01, 0x00, 0xA2, 0x0D, 0x59,
+	0xFE, 0x16, 0x02, 0x42, 0x16, 0x02, 0x00, 0xAA, 0x0D, 0x59, 0x72, 0x0B, 0x01, 0x36, 0xC8, 0x02,
+	0x96, 0xBD, 0x01, 0x04, 0xB2, 0x03, 0x89, 0xBA, 0x66, 0xFA, 0x08, 0x00, 0xBA, 0x0D, 0x22, 0x66,
+	0x7B, 0x00, 0x00, 0xC2, 0x0D, 0x22, 0x00, 0x81, 0x22, 0x84, 0x22, 0x00, 0x75, 0x3A, 0x84, 0x22,
+	0x00, 0xCA, 0x0D, 0x22, 0x66, 0x66, 0x00, 0x00, 0xD2, 0x82, 0x22, 0x00, 0x90, 0xDA, 0x03, 0x00,
+	0xE0, 0x03, 0x01, 0xE8, 0x03, 0x00, 0xF0, 0x03, 0x01, 0x80, 0x04, 0x00, 0x88, 0x04, 0x00, 0x90,
+	0x04, 0x00, 0x98, 0x04, 0x00, 0xA0, 0x04, 0x00, 0xA8, 0x04, 0x01, 0xB5, 0x04, 0xFF, 0xFF, 0x7F,
+	0x7F, 0xBD, 0x05, 0x06, 0x00, 0xC5, 0x05, 0x06, 0x00, 0xCD, 0x05, 0x06, 0x00, 0xD5, 0x05, 0x06,
+	0x04, 0xDA, 0x04, 0x49, 0xFC, 0xAA, 0xA3, 0x02, 0x96, 0x3F, 0x01, 0x00, 0xE2, 0x0D, 0x59, 0x66,
+	0x1D, 0x01, 0xDA, 0xAE, 0x03, 0x00, 0xEA, 0x92, 0x59, 0x00, 0xCA, 0xA3, 0x02, 0x00, 0xF2, 0x0D,
+	0x59, 0xFE, 0x0B, 0x01, 0x42, 0x0B, 0x01, 0x00, 0xFA, 0x0D, 0x59, 0x76, 0x0B, 0x01, 0xCA, 0xB2,
+	0x00, 0x04, 0x82, 0x05, 0x29, 0xBD, 0x72, 0x59, 0x00, 0xCE, 0xFC, 0x02, 0x04, 0x8D, 0x05, 0x0E,
+	0xD7, 0x36, 0x0C, 0x90, 0x05, 0x15, 0x9D, 0x05, 0x09, 0x10, 0xA0, 0x05, 0x19, 0xAA, 0x05, 0x8A,
+	0xEF, 0x06, 0xC9, 0x81, 0x08, 0x40, 0x20, 0x01, 0x0E, 0xE7, 0x40, 0x00, 0x3E, 0xE1, 0x5D, 0x00,
+	0xB2, 0x0D, 0xA2, 0x01, 0x4F, 0x0C, 0x25, 0x02, 0x00, 0x40, 0x46, 0x4A, 0x09, 0x0E, 0x6E, 0x0A,
+	0xCA, 0xFB, 0x00, 0xA0, 0xB8, 0x05, 0x08, 0xC0, 0x05, 0x04, 0xD0, 0x05, 0x05, 0xD8, 0x05, 0x08,
+	0xE0, 0x05, 0x08, 0xE8, 0x05, 0x04, 0xF0, 0x05, 0x08, 0xF8, 0x05, 0x08, 0x80, 0x06, 0x08, 0x88,
+	0x06, 0x04, 0x90, 0x06, 0x00, 0x98, 0x06, 0x00, 0xA0, 0x06, 0x00, 0x82, 0x08, 0x29, 0x22, 0x72,
+	0x77, 0x04, 0x00, 0x00, 0xCA, 0x29, 0x05, 0x1C, 0xC0, 0x09, 0x09, 0xC8, 0x09, 0x0A, 0xAA, 0x0A,
+	0x89, 0x24, 0x66, 0x81, 0x01, 0x24, 0xB8, 0x0A, 0x05, 0xC0, 0x0A, 0x05, 0xCA, 0x0A, 0x00, 0xE2,
+	0x1A, 0x05, 0x0C, 0x66, 0x2B, 0x00, 0x61, 0x10, 0xCA, 0x0A, 0x01, 0x00, 0xFA, 0x0D, 0x84, 0x66,
+	0x64, 0x04, 0x1C, 0x88, 0x0B, 0x00, 0x98, 0x0B, 0x00, 0xAD, 0x0B, 0x81, 0x08, 0x04, 0xBA, 0x0B,
+	0x29, 0x11, 0xFE, 0x87, 0x00, 0x42, 0x87, 0x00, 0x2C, 0xC8, 0x0B, 0x08, 0xE0, 0x0B, 0x01, 0xED,
+	0x0B, 0x9A, 0x99, 0x19, 0x3E, 0x0E, 0x55, 0x3A, 0x18, 0x90, 0xF1, 0x04, 0x01, 0x11, 0x08, 0xA7,
+	0x86, 0x9A, 0x0C, 0x1A, 0xCF, 0x24, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE,
+	0x9A, 0x0C, 0xB6, 0x9A, 0x0C, 0x65, 0x50, 0x08, 0x8D, 0xE4, 0x13, 0x46, 0x50, 0x03, 0x1A, 0x9A,
+	0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00,
+	0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66,
+	0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A,
+	0x0C, 0x66, 0x21, 0x00, 0x1E, 0x9A, 0x0C, 0x66, 0x22, 0x00, 0x00, 0x8A, 0x1A, 0x9A, 0x0C, 0x66,
+	0x22, 0x00, 0x1E, 0x9A, 0x0C, 0x00, 0x07, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C,
+	0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0x16,
+	0x9A, 0x0C, 0x66, 0x29, 0x02, 0xA1, 0xDC, 0xCA, 0x66, 0x06, 0x1E, 0x9A, 0x0C, 0x76, 0x59, 0x00,
+	0xCA, 0x35, 0x06, 0xFE, 0x9A, 0x0C, 0x82, 0x9A, 0x0C, 0x76, 0xB2, 0x00, 0xCA, 0x0B, 0x01, 0x1E,
+	0x9A, 0x0C, 0x76, 0x59, 0x00, 0xCA, 0x0B, 0x01, 0xFE, 0x9A, 0x0C, 0x82, 0x9A, 0x0C, 0x72, 0xB2,
+	0x00, 0xCE, 0x9E, 0x09, 0xA6, 0x9A, 0x0C, 0x66, 0x7B, 0x00, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C,
+	0xFE, 0x9A, 0x0C, 0xEE, 0x9A, 0x0C, 0x1A, 0x9A, 0x0C, 0x66, 0x1D, 0x01, 0xDA, 0xAE, 0x03, 0x1E,
+	0x9A, 0x0C, 0x76, 0x59, 0x00, 0xCA, 0xA3, 0x02, 0xFE, 0x9A, 0x0C, 0x82, 0x9A, 0x0C, 0xFE, 0xB2,
+	0x00, 0x42, 0xB2, 0x00, 0x1E, 0x9A, 0x0C, 0x72, 0x59, 0x00, 0xCE, 0xFC, 0x02, 0xFE, 0x9A, 0x0C,
+	0x56, 0x9A, 0x0C, 0x08, 0xA4, 0x83, 0x29, 0x16, 0xD0, 0x45, 0x2E, 0xF9, 0x43, 0xFE, 0x9A, 0x0C,
+	0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0x12, 0x9A, 0x0C, 0x66, 0x81, 0x01, 0x42, 0x9A, 0x0C, 0x66,
+	0x2B, 0x00, 0x61, 0x10, 0xCA, 0xB7, 0x02, 0xD6, 0x9A, 0x0C, 0xFE, 0x87, 0x00, 0x42, 0x87, 0x00,
+	0x56, 0x9A, 0x0C, 0x00, 0xA8, 0x86, 0x9A, 0x0C, 0x1A, 0xEC, 0x2F, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A,
+	0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xCA, 0x9A, 0x0C, 0x0C, 0xB6, 0xF2, 0xA7, 0x3E, 0x0E,
+	0xBC, 0x16, 0x32, 0xD2, 0x48, 0x2E, 0x9A, 0x0C, 0x52, 0x21, 0x00, 0x2E, 0x9A, 0x0C, 0x52, 0x21,
+	0x00, 0x2E, 0x9A, 0x0C, 0x52, 0x21, 0x00, 0x2E, 0x9A, 0x0C, 0x52, 0x21, 0x00, 0x2E, 0x9A, 0x0C,
+	0x52, 0x21, 0x00, 0x2E, 0x9A, 0x0C, 0x52, 0x21, 0x00, 0x2E, 0x9A, 0x0C, 0x52, 0x21, 0x00, 0x2E,
+	0x9A, 0x0C, 0x52, 0x21, 0x00, 0x2E, 0x9A, 0x0C, 0x52, 0x21, 0x00, 0x32, 0x9A, 0x0C, 0x52, 0x22,
+	0x00, 0x32, 0x9A, 0x0C, 0x52, 0x22, 0x00, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C,
+	0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0x4E,
+	0x9A, 0x0C, 0x52, 0x29, 0x02, 0xA1, 0xDC, 0xCA, 0x8F, 0x0B, 0x32, 0x9A, 0x0C, 0x62, 0x59, 0x00,
+	0xCA, 0x35, 0x06, 0xFE, 0x9A, 0x0C, 0x96, 0x9A, 0x0C, 0x62, 0xB2, 0x00, 0xCA, 0x0B, 0x01, 0x32,
+	0x9A, 0x0C, 0x62, 0x59, 0x00, 0xCA, 0x0B, 0x01, 0xFE, 0x9A, 0x0C, 0x96, 0x9A, 0x0C, 0x5E, 0xB2,
+	0x00, 0xCE, 0x9E, 0x09, 0xBA, 0x9A, 0x0C, 0x52, 0x7B, 0x00, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C,
+	0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0x1E, 0x9A, 0x0C, 0x52, 0x1D, 0x01, 0xDA, 0xAE, 0x03, 0x32,
+	0x9A, 0x0C, 0x62, 0x59, 0x00, 0xCA, 0xA3, 0x02, 0xFE, 0x9A, 0x0C, 0x96, 0x9A, 0x0C, 0xFE, 0xB2,
+	0x00, 0x2E, 0xB2, 0x00, 0x32, 0x9A, 0x0C, 0x5E, 0x59, 0x00, 0xCE, 0xFC, 0x02, 0xFE, 0x9A, 0x0C,
+	0x56, 0x9A, 0x0C, 0x0C, 0x2B, 0xC2, 0xEC, 0x3E, 0x12, 0x6A, 0x52, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A,
+	0x0C, 0xFE, 0x9A, 0x0C, 0x56, 0x9A, 0x0C, 0x52, 0x81, 0x01, 0x56, 0x9A, 0x0C, 0x52, 0x2B, 0x00,
+	0x61, 0x10, 0xCA, 0xB7, 0x02, 0xEA, 0x9A, 0x0C, 0xFE, 0x87, 0x00, 0x2E, 0x87, 0x00, 0x56, 0x9A,
+	0x0C, 0x00, 0xA9, 0x86, 0x9A, 0x0C, 0x1A, 0x9F, 0x30, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE,
+	0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xB6, 0x9A, 0x0C, 0x34, 0xC7, 0x9F, 0x6E, 0x3F, 0x25, 0xC4, 0x10,
+	0x0A, 0x3E, 0x2D, 0x82, 0xB0, 0x3E, 0x3D, 0x2E, 0x50, 0x03, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00,
+	0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66,
+	0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A,
+	0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00,
+	0x1E, 0x9A, 0x0C, 0x66, 0x22, 0x00, 0x1E, 0x9A, 0x0C, 0x66, 0x22, 0x00, 0xFE, 0x9A, 0x0C, 0xFE,
+	0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A,
+	0x0C, 0xFE, 0x9A, 0x0C, 0x3A, 0x9A, 0x0C, 0x66, 0x29, 0x02, 0xA1, 0xDC, 0xCA, 0x8F, 0x0B, 0x1E,
+	0x9A, 0x0C, 0x76, 0x59, 0x00, 0xCA, 0x35, 0x06, 0xFE, 0x9A, 0x0C, 0x82, 0x9A, 0x0C, 0x76, 0xB2,
+	0x00, 0xCA, 0x0B, 0x01, 0x1E, 0x9A, 0x0C, 0x76, 0x59, 0x00, 0xCA, 0x0B, 0x01, 0xFE, 0x9A, 0x0C,
+	0x82, 0x9A, 0x0C, 0x72, 0xB2, 0x00, 0xCE, 0x9E, 0x09, 0xA6, 0x9A, 0x0C, 0x66, 0x7B, 0x00, 0xFE,
+	0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xEE, 0x9A, 0x0C, 0x1A, 0x9A, 0x0C, 0x66, 0x1D,
+	0x01, 0xDA, 0xAE, 0x03, 0x1E, 0x9A, 0x0C, 0x76, 0x59, 0x00, 0xCA, 0xA3, 0x02, 0xFE, 0x9A, 0x0C,
+	0x82, 0x9A, 0x0C, 0xFE, 0xB2, 0x00, 0x42, 0xB2, 0x00, 0x1E, 0x9A, 0x0C, 0x72, 0x59, 0x00, 0xCE,
+	0xFC, 0x02, 0xFE, 0x9A, 0x0C, 0x56, 0x9A, 0x0C, 0x1C, 0x76, 0x1E, 0x14, 0x3E, 0x2D, 0x2D, 0x93,
+	0x4C, 0x32, 0x4A, 0x09, 0xFE, 0x34, 0x19, 0xFE, 0x34, 0x19, 0xFE, 0x34, 0x19, 0x12, 0x34, 0x19,
+	0x66, 0x81, 0x01, 0x42, 0x9A, 0x0C, 0x66, 0x2B, 0x00, 0x61, 0x10, 0xCA, 0xB7, 0x02, 0xD6, 0x9A,
+	0x0C, 0xFE, 0x87, 0x00, 0x42, 0x87, 0x00, 0x56, 0x9A, 0x0C, 0x00, 0xAA, 0x86, 0x9A, 0x0C, 0x1A,
+	0xBD, 0x3B, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xB6, 0x9A,
+	0x0C, 0x34, 0x2F, 0x4E, 0x35, 0x3F, 0x25, 0x0B, 0x09, 0xBB, 0x3D, 0x2D, 0x52, 0xB8, 0xCE, 0x32,
+	0x4A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66,
+	0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A,
+	0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00,
+	0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1E, 0x9A, 0x0C, 0x66, 0x22, 0x00, 0x1E, 0x9A, 0x0C, 0x66,
+	0x22, 0x00, 0x12, 0x9A, 0x0C, 0x04, 0x1A, 0xA0, 0x56, 0xCE, 0x25, 0x00, 0x0B, 0xFE, 0x68, 0x32,
+	0xFE, 0x68, 0x32, 0xFE, 0x68, 0x32, 0xFE, 0x68, 0x32, 0xFE, 0x68, 0x32, 0xFE, 0x68, 0x32, 0xFE,
+	0x68, 0x32, 0xC2, 0x68, 0x32, 0x66, 0x29, 0x02, 0xA1, 0xDC, 0xCA, 0x8F, 0x0B, 0x1E, 0x9A, 0x0C,
+	0x76, 0x59, 0x00, 0xCA, 0x35, 0x06, 0xFE, 0x9A, 0x0C, 0x82, 0x9A, 0x0C, 0x76, 0xB2, 0x00, 0xCA,
+	0x0B, 0x01, 0x1E, 0x9A, 0x0C, 0x76, 0x59, 0x00, 0xCA, 0x0B, 0x01, 0xFE, 0x9A, 0x0C, 0x82, 0x9A,
+	0x0C, 0x72, 0xB2, 0x00, 0xCE, 0x9E, 0x09, 0xA6, 0x9A, 0x0C, 0x66, 0x7B, 0x00, 0xFE, 0x9A, 0x0C,
+	0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xEE, 0x9A, 0x0C, 0x1A, 0x9A, 0x0C, 0x66, 0x1D, 0x01, 0xDA,
+	0xAE, 0x03, 0x1E, 0x9A, 0x0C, 0x76, 0x59, 0x00, 0xCA, 0xA3, 0x02, 0xFE, 0x9A, 0x0C, 0x82, 0x9A,
+	0x0C, 0xFE, 0xB2, 0x00, 0x42, 0xB2, 0x00, 0x1E, 0x9A, 0x0C, 0x72, 0x59, 0x00, 0xCE, 0xFC, 0x02,
+	0x1E, 0x9A, 0x0C, 0x00, 0x1C, 0x1E, 0x68, 0x32, 0x00, 0x1D, 0xFA, 0x68, 0x32, 0x34, 0x62, 0x81,
+	0x68, 0x3F, 0x25, 0x7B, 0xDA, 0xEF, 0x3D, 0x2D, 0x6A, 0x8C, 0x04, 0x33, 0x2E, 0x4A, 0x09, 0xFE,
+	0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xEE, 0x9A, 0x0C, 0x00, 0x12, 0x1E, 0x68, 0x32, 0x66, 0x81, 0x01,
+	0x42, 0x9A, 0x0C, 0x66, 0x2B, 0x00, 0x61, 0x10, 0xCA, 0xB7, 0x02, 0xD6, 0x9A, 0x0C, 0xFE, 0x87,
+	0x00, 0x42, 0x87, 0x00, 0x56, 0x9A, 0x0C, 0x00, 0xAB, 0x86, 0x9A, 0x0C, 0x1A, 0xDB, 0x46, 0xFE,
+	0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xB6, 0x9A, 0x0C, 0x20, 0x64,
+	0x9F, 0x09, 0x3F, 0x25, 0x82, 0x12, 0x70, 0x3D, 0x5E, 0xCE, 0x25, 0x66, 0x21, 0x00, 0x1A, 0x9A,
+	0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00,
+	0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66,
+	0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1E, 0x9A,
+	0x0C, 0x66, 0x22, 0x00, 0x1E, 0x9A, 0x0C, 0x66, 0x22, 0x00, 0x12, 0x9A, 0x0C, 0x00, 0x10, 0x5A,
+	0x9A, 0x0C, 0xFE, 0x02, 0x3F, 0xFE, 0x02, 0x3F, 0xFE, 0x02, 0x3F, 0xFE, 0x02, 0x3F, 0xFE, 0x02,
+	0x3F, 0xFE, 0x02, 0x3F, 0xFE, 0x02, 0x3F, 0xC6, 0x02, 0x3F, 0x66, 0x29, 0x02, 0xA1, 0xDC, 0xCA,
+	0x8F, 0x0B, 0x1E, 0x9A, 0x0C, 0x76, 0x59, 0x00, 0xCA, 0x35, 0x06, 0xFE, 0x9A, 0x0C, 0x82, 0x9A,
+	0x0C, 0x76, 0xB2, 0x00, 0xCA, 0x0B, 0x01, 0x1E, 0x9A, 0x0C, 0x76, 0x59, 0x00, 0xCA, 0x0B, 0x01,
+	0xFE, 0x9A, 0x0C, 0x82, 0x9A, 0x0C, 0x72, 0xB2, 0x00, 0xCE, 0x9E, 0x09, 0xA6, 0x9A, 0x0C, 0x66,
+	0x7B, 0x00, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xEE, 0x9A, 0x0C, 0x1A, 0x9A,
+	0x0C, 0x66, 0x1D, 0x01, 0xDA, 0xAE, 0x03, 0x1E, 0x9A, 0x0C, 0x76, 0x59, 0x00, 0xCA, 0xA3, 0x02,
+	0xFE, 0x9A, 0x0C, 0x82, 0x9A, 0x0C, 0xFE, 0xB2, 0x00, 0x42, 0xB2, 0x00, 0x1E, 0x9A, 0x0C, 0x72,
+	0x59, 0x00, 0xCE, 0xFC, 0x02, 0x1E, 0x9A, 0x0C, 0xFE, 0x02, 0x3F, 0x22, 0x02, 0x3F, 0x1C, 0x97,
+	0xD2, 0x3C, 0x3F, 0x25, 0x84, 0xB1, 0xA4, 0x46, 0x4A, 0x09, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C,
+	0xFE, 0x9A, 0x0C, 0x12, 0x9A, 0x0C, 0x66, 0x81, 0x01, 0x42, 0x9A, 0x0C, 0x66, 0x2B, 0x00, 0x61,
+	0x10, 0xCA, 0xB7, 0x02, 0xD6, 0x9A, 0x0C, 0xFE, 0x87, 0x00, 0x42, 0x87, 0x00, 0x56, 0x9A, 0x0C,
+	0x00, 0xA3, 0x12, 0x9A, 0x0C, 0x00, 0xA2, 0x1A, 0x9C, 0x4B, 0x14, 0xEC, 0x02, 0x0A, 0x1B, 0x12,
+	0x13, 0x1E, 0x9C, 0x4B, 0x1C, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x61, 0x78, 0x69, 0x2E, 0x9F, 0x4B,
+	0x00, 0xC6, 0x0E, 0x0D, 0x47, 0x04, 0x80, 0x3F, 0x1A, 0x32, 0x4B, 0x10, 0x89, 0x2E, 0x39, 0x3F,
+	0x25, 0x01, 0x05, 0x00, 0x2D, 0x01, 0x05, 0x3A, 0xD0, 0x0E, 0xCE, 0xDF, 0x06, 0x0C, 0x38, 0x13,
+	0x40, 0x0F, 0x12, 0x3B, 0x78, 0x12, 0x65, 0x7A, 0x0C, 0x7A, 0x00, 0x8A, 0x01, 0x16, 0x10, 0x40,
+	0x01, 0x5F, 0x62, 0x69, 0x00, 0xCE, 0x21, 0x41, 0x0E, 0x82, 0x78, 0x14, 0x80, 0x3F, 0xAA, 0x01,
+	0x00, 0xBA, 0x0D, 0x62, 0x72, 0x83, 0x41, 0xCE, 0xCB, 0x00, 0x04, 0xC8, 0x01, 0x0E, 0x70, 0x79,
+	0x00, 0xF0, 0x12, 0xCB, 0x78, 0x44, 0x88, 0x02, 0x00, 0x98, 0x02, 0x00, 0xA8, 0x02, 0x03, 0xB8,
+	0x02, 0x13, 0xC0, 0x02, 0x14, 0xE0, 0x02, 0x01, 0x0E, 0x84, 0x40, 0x08, 0x11, 0x08, 0xA4, 0x92,
+	0x7E, 0x01, 0x26, 0x83, 0x40, 0xFE, 0x7E, 0x01, 0x7E, 0x7E, 0x01, 0x08, 0x16, 0x40, 0x17, 0xC2,
+	0x7E, 0x01, 0xCE, 0x1C, 0x01, 0x00, 0x9D, 0x12, 0x06, 0x7A, 0x3D, 0x7E, 0xFE, 0xE0, 0x01, 0x42,
+	0xE0, 0x01, 0x14, 0xC8, 0x01, 0x01, 0xE0, 0x01, 0x00, 0x36, 0x7E, 0x01, 0x18, 0x01, 0xB8, 0x02,
+	0x16, 0xC0, 0x02, 0x18, 0x35, 0x7E, 0x00, 0xD1, 0x32, 0x7E, 0x01, 0x14, 0xF4, 0x02, 0x0A, 0x1E,
+	0x12, 0x16, 0x49, 0xFC, 0x24, 0x34, 0x2D, 0x63, 0x61, 0x74, 0x65, 0x67, 0x6F, 0x72, 0x79, 0x3A,
+	0xFF, 0x02, 0x04, 0xCB, 0x02, 0x12, 0x72, 0x86, 0x00, 0x1A, 0x8A, 0x96, 0x02, 0xCE, 0x18, 0x01,
+	0x18, 0x28, 0x00, 0x30, 0x14, 0x38, 0x13, 0x4D, 0x41, 0x8C, 0x00, 0x65, 0x0E, 0x69, 0x36, 0x08,
+	0x72, 0x00, 0x82, 0x4D, 0x9F, 0xFE, 0x21, 0x01, 0x42, 0x21, 0x01, 0x16, 0x89, 0x7B, 0x0C, 0xA2,
+	0x01, 0x00, 0xB2, 0xFE, 0x62, 0x00, 0x5E, 0x62, 0x00, 0x24, 0xC0, 0x01, 0x01, 0xD0, 0x01, 0x00,
+	0xD8, 0x01, 0x00, 0xE8, 0x12, 0x6E, 0x7C, 0x30, 0x90, 0x02, 0x00, 0xA0, 0x02, 0x02, 0xB0, 0x02,
+	0x14, 0xB8, 0x02, 0x13, 0xC8, 0x0E, 0xD5, 0x7B, 0x6D, 0x04, 0x00, 0xCD, 0x25, 0x86, 0x00, 0x9E,
+	0x8D, 0x82, 0x14, 0x8F, 0x1C, 0x0A, 0x15, 0x12, 0x0D, 0x35, 0x86, 0x0E, 0xE6, 0x7D, 0x16, 0xC6,
+	0x6C, 0x10, 0x82, 0xF1, 0x04, 0xEF, 0x1B, 0x25, 0x7D, 0x00, 0x12, 0xFE, 0x2B, 0x83, 0xFE, 0x2B,
+	0x83, 0xFE, 0x2B, 0x83, 0xFE, 0x2B, 0x83, 0xFE, 0x2B, 0x83, 0xFE, 0x2B, 0x83, 0xFE, 0x2B, 0x83,
+	0xFE, 0x2B, 0x83, 0xBE, 0x2B, 0x83, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE,
+	0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE,
+	0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B,
+	0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE,
+	0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE,
+	0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B,
+	0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE,
+	0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE,
+	0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B,
+	0xFA, 0xFE, 0x8B, 0x00, 0xCE, 0x5E, 0xFE, 0x8B, 0x00, 0x34, 0xFE, 0xFE, 0x8B, 0xCE, 0xFE, 0x8B,
+	0x00, 0xD9, 0xE2, 0xDE, 0x60, 0x00, 0x34, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B,
+	0xFE, 0xFE, 0x8B, 0xEE, 0xFE, 0x8B, 0x12, 0xFE, 0x8B, 0x00, 0xDA, 0xFE, 0x7C, 0x01, 0x39, 0x7C,
+	0x1A, 0x54, 0x13, 0xFE, 0x7A, 0x8D, 0xFE, 0x7A, 0x8D, 0xFE, 0x7A, 0x8D, 0xFE, 0x7A, 0x8D, 0xA6,
+	0x7A, 0x8D, 0x00, 0xE3, 0x32, 0x7C, 0x01, 0xAE, 0xA0, 0x7B, 0x42, 0xF8, 0x02, 0xFE, 0xFE, 0x8B,
+	0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xC6, 0xFE, 0x8B, 0x00, 0xE4, 0xFE, 0x7D,
+	0x01, 0x3D, 0x7D, 0xA2, 0xFA, 0x02, 0x0E, 0x86, 0x14, 0xFE, 0x7B, 0x8D, 0xFE, 0x7B, 0x8D, 0xFE,
+	0x7B, 0x8D, 0xFE, 0x7B, 0x8D, 0x0E, 0x7B, 0x8D, 0x00, 0xE5, 0xFE, 0x7D, 0x01, 0x3D, 0x7D, 0x1A,
+	0xB4, 0x4B, 0x2E, 0x77, 0x04, 0x00, 0xF0, 0xFE, 0x87, 0x87, 0xFE, 0x87, 0x87, 0xFE, 0x87, 0x87,
+	0xFE, 0x87, 0x87, 0x72, 0x87, 0x87, 0x00, 0xE6, 0xFE, 0x7D, 0x01, 0x3D, 0x7D, 0x1A, 0x97, 0x40,
+	0x2E, 0x7D, 0x01, 0x56, 0x4E, 0x68, 0xFE, 0xFA, 0x02, 0xFE, 0xFA, 0x02, 0xFE, 0xFA, 0x02, 0xFE,
+	0xFA, 0x02, 0x51, 0xFA, 0x00, 0xE7, 0xFE, 0x7D, 0x01, 0x3D, 0x7D, 0x00, 0x34, 0x16, 0xC7, 0x17,
+	0xFE, 0x7D, 0x01, 0xFE, 0x7D, 0x01, 0xFE, 0x7D, 0x01, 0xFE, 0x7D, 0x01, 0xA6, 0x7D, 0x01, 0x00,
+	0xE8, 0xFE, 0x7D, 0x01, 0x3D, 0x7D, 0x1A, 0x5D, 0x2A, 0x2E, 0x7D, 0x01, 0xFE, 0xAC, 0x75, 0xFE,
+	0xAC, 0x75, 0xFE, 0xAC, 0x75, 0xFE, 0xAC, 0x75, 0x76, 0xAC, 0x75, 0x00, 0xE9, 0xFE, 0x7D, 0x01,
+	0x3D, 0x7D, 0xA2, 0x39, 0x71, 0x66, 0x83, 0x8B, 0xFE, 0xC5, 0x6C, 0x82, 0xC5, 0x6C, 0x66, 0x7B,
+	0x00, 0xFE, 0xBD, 0x6F, 0xCA, 0xBD, 0x6F, 0x00, 0xEA, 0xFE, 0x7D, 0x01, 0x3D, 0x7D, 0x4A, 0x3A,
+	0x71, 0xFE, 0xFA, 0x02, 0xFE, 0xFA, 0x02, 0xFE, 0xFA, 0x02, 0xFE, 0xFA, 0x02, 0x76, 0xFA, 0x02,
+	0x00, 0xEB, 0xFE, 0x7D, 0x01, 0x3D, 0x7D, 0xFE, 0x3B, 0x71, 0xFE, 0x3B, 0x71, 0xFE, 0x3B, 0x71,
+	0xFE, 0x3B, 0x71, 0xC2, 0x3B, 0x71, 0x00, 0xEC, 0xFE, 0x7D, 0x01, 0x3D, 0x7D, 0x4A, 0x3C, 0x71,
+	0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0x76, 0xFE, 0x8B, 0x00,
+	0xDB, 0x32, 0x7D, 0x01, 0xAE, 0xA0, 0x7B, 0x42, 0xE2, 0x0E, 0x4A, 0xE7, 0x0B, 0x56, 0x6A, 0x0A,
+	0x66, 0x58, 0x69, 0xFE, 0xF3, 0x05, 0x82, 0xF3, 0x05, 0x66, 0x7B, 0x00, 0xFE, 0xF3, 0x05, 0xCA,
+	0xF3, 0x05, 0x00, 0xED, 0x32, 0x7C, 0x01, 0xF2, 0x5E, 0x10, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B,
+	0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xC6, 0xFE, 0x8B, 0x00, 0xEE, 0xFE, 0x7D, 0x01, 0x3D, 0x7D,
+	0x4A, 0x5E, 0x10, 0xFE, 0x70, 0x07, 0xFE, 0x70, 0x07, 0xFE, 0x70, 0x07, 0xFE, 0x70, 0x07, 0x76,
+	0x70, 0x07, 0x00, 0xEF, 0xFE, 0x7D, 0x01, 0x3D, 0x7D, 0x4A, 0x77, 0x04, 0xFE, 0x5E, 0x10, 0xFE,
+	0x5E, 0x10, 0xFE, 0x5E, 0x10, 0xFE, 0x5E, 0x10, 0x76, 0x5E, 0x10, 0x00, 0xF0, 0xFE, 0x7D, 0x01,
+	0x3D, 0x7D, 0x4A, 0x5E, 0x10, 0xFE, 0xFA, 0x02, 0xFE, 0xFA, 0x02, 0xFE, 0xFA, 0x02, 0xFE, 0xFA,
+	0x02, 0x76, 0xFA, 0x02, 0x00, 0xF1, 0xFE, 0x7D, 0x01, 0x3D, 0x7D, 0x4A, 0x5E, 0x10, 0xFE, 0x7D,
+	0x01, 0xFE, 0x7D, 0x01, 0xFE, 0x7D, 0x01, 0xFE, 0x7D, 0x01, 0x76, 0x7D, 0x01, 0x00, 0xF2, 0xFE,
+	0x7D, 0x01, 0x3D, 0x7D, 0xFE, 0x5E, 0x10, 0xFE, 0x5E, 0x10, 0xFE, 0x5E, 0x10, 0xFE, 0x5E, 0x10,
+	0xC2, 0x5E, 0x10, 0x00, 0xF3, 0xFE, 0x7D, 0x01, 0x3D, 0x7D, 0xFE, 0x5E, 0x10, 0xFE, 0x5E, 0x10,
+	0xFE, 0x5E, 0x10, 0xFE, 0x5E, 0x10, 0xC2, 0x5E, 0x10, 0x00, 0xF4, 0xFE, 0x7D, 0x01, 0x3D, 0x7D,
+	0x4A, 0x5E, 0x10, 0x56, 0xE8, 0x0B, 0x66, 0x99, 0x82, 0xFE, 0xE8, 0x0B, 0x82, 0xE8, 0x0B, 0x66,
+	0x7B, 0x00, 0xFE, 0xE8, 0x0B, 0xCA, 0xE8, 0x0B, 0x00, 0xF5, 0xFE, 0x7D, 0x01, 0x3D, 0x7D, 0x4A,
+	0x5E, 0x10, 0xFE, 0xF4, 0x05, 0xFE, 0xF4, 0x05, 0xFE, 0xF4, 0x05, 0xFE, 0xF4, 0x05, 0x76, 0xF4,
+	0x05, 0x00, 0xF6, 0xFE, 0x7D, 0x01, 0x3D, 0x7D, 0x4A, 0x5E, 0x10, 0xFE, 0x7D, 0x01, 0xFE, 0x7D,
+	0x01, 0xFE, 0x7D, 0x01, 0xFE, 0x7D, 0x01, 0x76, 0x7D, 0x01, 0x00, 0xDC, 0x32, 0x7D, 0x01, 0xF2,
+	0x5E, 0x10, 0x4A, 0x6A, 0x0A, 0x56, 0x76, 0x04, 0xFE, 0xC8, 0x1A, 0xFE, 0xC8, 0x1A, 0xFE, 0xC8,
+	0x1A, 0xFE, 0xC8, 0x1A, 0x1E, 0xC8, 0x1A, 0x00, 0xDD, 0xFE, 0x7C, 0x01, 0x39, 0x7C, 0x4A, 0x69,
+	0x0A, 0x56, 0x7C, 0x01, 0x66, 0x5F, 0x11, 0xFE, 0xF2, 0x05, 0x82, 0xF2, 0x05, 0x66, 0x7B, 0x00,
+	0xFE, 0xF2, 0x05, 0xCA, 0xF2, 0x05, 0x00, 0xDE, 0xFE, 0x7C, 0x01, 0x39, 0x7C, 0x4A, 0x68, 0x0A,
+	0x56, 0x7C, 0x01, 0xFE, 0xF8, 0x02, 0xFE, 0xF8, 0x02, 0xFE, 0xF8, 0x02, 0xFE, 0xF8, 0x02, 0x51,
+	0xF8, 0x00, 0xDF, 0xFE, 0x7C, 0x01, 0x39, 0x7C, 0xA2, 0x67, 0x0A, 0x66, 0x6F, 0x08, 0xFE, 0xF8,
+	0x02, 0x82, 0xF8, 0x02, 0x66, 0x7B, 0x00, 0xFE, 0xF8, 0x02, 0xCA, 0xF8, 0x02, 0x00, 0xE0, 0xFE,
+	0x7C, 0x01, 0x39, 0x7C, 0xA2, 0x66, 0x0A, 0x66, 0xF9, 0x03, 0xFE, 0x7C, 0x01, 0x82, 0x7C, 0x01,
+	0x66, 0x7B, 0x00, 0xFE, 0x7C, 0x01, 0xCA, 0x7C, 0x01, 0x00, 0xE1, 0xFE, 0x7C, 0x01, 0x39, 0x7C,
+	0x4A, 0x65, 0x0A, 0xFE, 0x74, 0x04, 0xFE, 0x74, 0x04, 0xFE, 0x74, 0x04, 0xFE, 0x74, 0x04, 0x76,
+	0x74, 0x04, 0x00, 0xE2, 0xFE, 0x7C, 0x01, 0x39, 0x7C, 0x4A, 0x64, 0x0A, 0x56, 0x7C, 0x01, 0x66,
+	0x7D, 0x02, 0xFE, 0xF8, 0x02, 0xFE, 0xF8, 0x02, 0xFE, 0xF8, 0x02, 0xAE, 0xF8, 0x02, 0x08, 0x11,
+	0x08, 0xF7, 0x12, 0x4B, 0x3B, 0x4E, 0xFE, 0x8B, 0x00, 0x34, 0xFE, 0xFE, 0x8B, 0xE6, 0xFE, 0x8B,
+	0x00, 0xD2, 0x05, 0x95, 0x4E, 0xFE, 0x8B, 0x00, 0x34, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE,
+	0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xF2, 0xFE, 0x8B, 0x30, 0x9F, 0x1D, 0x4C, 0x3F, 0x25, 0xCA, 0x35,
+	0x26, 0x3E, 0x2D, 0xE2, 0x2E, 0xF7, 0x32, 0x80, 0x69, 0x1A, 0x30, 0x66, 0x66, 0x21, 0x00, 0x1A,
+	0xFC, 0x4C, 0x66, 0x21, 0x00, 0x1A, 0xFC, 0x4C, 0x66, 0x21, 0x00, 0x1A, 0xFC, 0x4C, 0x66, 0x21,
+	0x00, 0x1A, 0xFC, 0x4C, 0x66, 0x21, 0x00, 0x1A, 0xFC, 0x4C, 0x66, 0x21, 0x00, 0x1A, 0xFC, 0x4C,
+	0x66, 0x21, 0x00, 0x1A, 0xFC, 0x4C, 0x66, 0x21, 0x00, 0x1A, 0xFC, 0x4C, 0x66, 0x21, 0x00, 0x1E,
+	0xFC, 0x4C, 0x66, 0x22, 0x00, 0x1E, 0xFC, 0x4C, 0x66, 0x22, 0x00, 0x1E, 0xFC, 0x4C, 0xFE, 0xFE,
+	0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B,
+	0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0x1A, 0xFE, 0x8B, 0x66, 0x29, 0x02, 0x0E, 0x3E, 0x46, 0xCA,
+	0xF1, 0x4B, 0x1E, 0xFC, 0x4C, 0x76, 0x59, 0x00, 0xCA, 0x97, 0x46, 0xFE, 0xFC, 0x4C, 0x82, 0xFC,
+	0x4C, 0x76, 0xB2, 0x00, 0xCA, 0x0B, 0x01, 0x1E, 0xFC, 0x4C, 0x76, 0x59, 0x00, 0xCA, 0x0B, 0x01,
+	0xFE, 0xFC, 0x4C, 0x82, 0xFC, 0x4C, 0x72, 0xB2, 0x00, 0xCE, 0x00, 0x4A, 0xA6, 0xFC, 0x4C, 0x66,
+	0x7B, 0x00, 0xFE, 0xFC, 0x4C, 0xFE, 0xFC, 0x4C, 0xFE, 0xFC, 0x4C, 0xEE, 0xFC, 0x4C, 0x1A, 0xFC,
+	0x4C, 0x66, 0x1D, 0x01, 0xDA, 0xAE, 0x03, 0x1E, 0xFC, 0x4C, 0x76, 0x59, 0x00, 0xCA, 0xA3, 0x02,
+	0xFE, 0xFC, 0x4C, 0x82, 0xFC, 0x4C, 0xFE, 0xB2, 0x00, 0x42, 0xB2, 0x00, 0x1E, 0xFC, 0x4C, 0x72,
+	0x59, 0x00, 0xCE, 0xFC, 0x02, 0xFE, 0xFC, 0x4C, 0x42, 0xFC, 0x4C, 0x30, 0xD2, 0x50, 0x7F, 0x3F,
+	0x25, 0xE6, 0xE6, 0x4F, 0x3E, 0x2D, 0xD2, 0x97, 0x1A, 0x3E, 0xC6, 0x4A, 0xFE, 0xFE, 0x8B, 0xFE,
+	0xFE, 0x8B, 0xEE, 0xFE, 0x8B, 0x16, 0xFE, 0x8B, 0x42, 0x81, 0x01, 0x00, 0x00, 0x1E, 0xC5, 0xC5,
+	0x42, 0xFC, 0x4C, 0x42, 0x2B, 0x00, 0x00, 0x80, 0x11, 0x2B, 0x61, 0x10, 0x32, 0xB7, 0x02, 0x0E,
+	0x08, 0x4C, 0x00, 0x00, 0x82, 0xF0, 0xC5, 0xD6, 0xFC, 0x4C, 0xAA, 0x87, 0x00, 0x96, 0xEE, 0x8F,
+	0x12, 0xFC, 0x4C, 0x00, 0x00, 0x3E, 0xFE, 0x8B, 0x00, 0xD3, 0x86, 0x9A, 0x0C, 0x1A, 0xCF, 0x24,
+	0xFE, 0x96, 0x59, 0xFE, 0x96, 0x59, 0xFE, 0x96, 0x59, 0xFE, 0x96, 0x59, 0xB6, 0x96, 0x59, 0x30,
+	0x54, 0xAD, 0x03, 0x3F, 0x25, 0x4B, 0x97, 0x81, 0x3E, 0x2D, 0xA8, 0x0D, 0x11, 0x32, 0x50, 0x03,
+	0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66,
+	0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A,
+	0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00,
+	0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1E, 0x9A, 0x0C, 0x66, 0x22, 0x00, 0x1E, 0x9A, 0x0C, 0x66,
+	0x22, 0x00, 0x1E, 0x9A, 0x0C, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE,
+	0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0x1A, 0xFE, 0x8B,
+	0x66, 0x29, 0x02, 0xA1, 0xDC, 0xCA, 0x8F, 0x0B, 0x1E, 0x9A, 0x0C, 0x76, 0x59, 0x00, 0x32, 0x35,
+	0x06, 0x96, 0xAE, 0x05, 0xFE, 0x9A, 0x0C, 0x82, 0x9A, 0x0C, 0x76, 0xB2, 0x00, 0xCA, 0x0B, 0x01,
+	0x1E, 0x9A, 0x0C, 0x76, 0x59, 0x00, 0xCA, 0x0B, 0x01, 0xFE, 0x9A, 0x0C, 0x82, 0x9A, 0x0C, 0x72,
+	0xB2, 0x00, 0xCE, 0x9E, 0x09, 0xA6, 0x9A, 0x0C, 0x66, 0x7B, 0x00, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A,
+	0x0C, 0xFE, 0x9A, 0x0C, 0xEE, 0x9A, 0x0C, 0x1A, 0x9A, 0x0C, 0x66, 0x1D, 0x01, 0xDA, 0xAE, 0x03,
+	0x1E, 0x9A, 0x0C, 0x76, 0x59, 0x00, 0xCA, 0xA3, 0x02, 0xFE, 0x9A, 0x0C, 0x82, 0x9A, 0x0C, 0xFE,
+	0xB2, 0x00, 0x42, 0xB2, 0x00, 0x1E, 0x9A, 0x0C, 0x72, 0x59, 0x00, 0xCE, 0xFC, 0x02, 0xFE, 0x9A,
+	0x0C, 0x42, 0x9A, 0x0C, 0x30, 0xD5, 0x27, 0x32, 0x3F, 0x25, 0x4C, 0x55, 0xAF, 0x3E, 0x2D, 0xDB,
+	0x40, 0x44, 0x32, 0x4A, 0x09, 0xFE, 0x96, 0x59, 0xFE, 0x96, 0x59, 0xEE, 0x96, 0x59, 0x22, 0x98,
+	0x98, 0x42, 0x81, 0x01, 0x66, 0x9A, 0x0C, 0x42, 0x2B, 0x00, 0xFE, 0x9A, 0x0C, 0xD6, 0x9A, 0x0C,
+	0xAA, 0x87, 0x00, 0x96, 0xEC, 0x06, 0x56, 0x9A, 0x0C, 0x00, 0xD4, 0x86, 0x9A, 0x0C, 0x1A, 0xEC,
+	0x2F, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xB6, 0x9A, 0x0C,
+	0x30, 0x85, 0x13, 0x70, 0x3F, 0x25, 0xDB, 0x8F, 0xBE, 0x3E, 0x2D, 0xF3, 0xFB, 0x27, 0x32, 0x50,
+	0x03, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C,
+	0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A,
+	0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21,
+	0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1E, 0x9A, 0x0C, 0x66, 0x22, 0x00, 0x1E, 0x9A, 0x0C,
+	0x66, 0x22, 0x00, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE,
+	0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0x3A, 0x9A, 0x0C, 0x66, 0x29,
+	0x02, 0xDA, 0xEC, 0x08, 0x1E, 0x9A, 0x0C, 0x76, 0x59, 0x00, 0xCA, 0xEC, 0x08, 0xFE, 0x9A, 0x0C,
+	0x82, 0x9A, 0x0C, 0x76, 0xB2, 0x00, 0xEA, 0x9A, 0x0C, 0x76, 0x59, 0x00, 0xCA, 0x0B, 0x01, 0xFE,
+	0x9A, 0x0C, 0x82, 0x9A, 0x0C, 0x72, 0xB2, 0x00, 0xCE, 0x9E, 0x09, 0xA6, 0x9A, 0x0C, 0x66, 0x7B,
+	0x00, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xEE, 0x9A, 0x0C, 0x1A, 0x9A, 0x0C,
+	0x66, 0x1D, 0x01, 0xDA, 0xAE, 0x03, 0x1E, 0x9A, 0x0C, 0x76, 0x59, 0x00, 0xCA, 0xA3, 0x02, 0xFE,
+	0x9A, 0x0C, 0x82, 0x9A, 0x0C, 0xFE, 0xB2, 0x00, 0x42, 0xB2, 0x00, 0x1E, 0x9A, 0x0C, 0x72, 0x59,
+	0x00, 0xCE, 0xFC, 0x02, 0xFE, 0x9A, 0x0C, 0x42, 0x9A, 0x0C, 0x0E, 0x9E, 0x60, 0x20, 0x25, 0x96,
+	0x33, 0xCB, 0x3E, 0x2D, 0x50, 0x20, 0x33, 0x32, 0x4A, 0x09, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C,
+	0xFE, 0x9A, 0x0C, 0x12, 0x9A, 0x0C, 0x42, 0x81, 0x01, 0x66, 0x9A, 0x0C, 0x42, 0x2B, 0x00, 0xFE,
+	0x9A, 0x0C, 0xD6, 0x9A, 0x0C, 0xAA, 0x87, 0x00, 0xEE, 0x9A, 0x0C, 0x00, 0xD5, 0x86, 0x9A, 0x0C,
+	0x1A, 0x9F, 0x30, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xB6,
+	0x9A, 0x0C, 0x30, 0xCF, 0xD6, 0x1D, 0x3F, 0x25, 0x90, 0x53, 0xE0, 0x3E, 0x2D, 0x9D, 0x1D, 0x4C,
+	0x32, 0x50, 0x03, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A,
+	0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21,
+	0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C,
+	0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1E, 0x9A, 0x0C, 0x66, 0x22, 0x00, 0x1E,
+	0x9A, 0x0C, 0x66, 0x22, 0x00, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A,
+	0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0x3A, 0x9A, 0x0C,
+	0x66, 0x29, 0x02, 0xDA, 0xEC, 0x08, 0x1E, 0x9A, 0x0C, 0x76, 0x59, 0x00, 0xCA, 0xEC, 0x08, 0xFE,
+	0x9A, 0x0C, 0x82, 0x9A, 0x0C, 0x76, 0xB2, 0x00, 0xEA, 0x9A, 0x0C, 0x76, 0x59, 0x00, 0xCA, 0x0B,
+	0x01, 0xFE, 0x9A, 0x0C, 0x82, 0x9A, 0x0C, 0x72, 0xB2, 0x00, 0xCE, 0x9E, 0x09, 0xA6, 0x9A, 0x0C,
+	0x66, 0x7B, 0x00, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xEE, 0x9A, 0x0C, 0x1A,
+	0x9A, 0x0C, 0x66, 0x1D, 0x01, 0xDA, 0xAE, 0x03, 0x1E, 0x9A, 0x0C, 0x76, 0x59, 0x00, 0xCA, 0xA3,
+	0x02, 0xFE, 0x9A, 0x0C, 0x82, 0x9A, 0x0C, 0xFE, 0xB2, 0x00, 0x42, 0xB2, 0x00, 0x1E, 0x9A, 0x0C,
+	0x72, 0x59, 0x00, 0xCE, 0xFC, 0x02, 0xFE, 0x9A, 0x0C, 0x42, 0x9A, 0x0C, 0x2C, 0x61, 0x6E, 0x45,
+	0x3F, 0x25, 0x4B, 0x4C, 0x0C, 0x3F, 0x2D, 0xD0, 0x50, 0x36, 0x44, 0xDD, 0xFE, 0x9A, 0x0C, 0xFE,
+	0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0x12, 0x9A, 0x0C, 0x42, 0x81, 0x01, 0x66, 0x9A, 0x0C, 0x42, 0x2B,
+	0x00, 0xFE, 0x9A, 0x0C, 0xD6, 0x9A, 0x0C, 0xAA, 0x87, 0x00, 0xEE, 0x9A, 0x0C, 0x00, 0xD6, 0x86,
+	0x9A, 0x0C, 0x1A, 0xBD, 0x3B, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A,
+	0x0C, 0xB6, 0x9A, 0x0C, 0x30, 0x02, 0x7B, 0x19, 0x3F, 0x25, 0x1F, 0x88, 0xC8, 0x3D, 0x2D, 0x80,
+	0x82, 0xBD, 0x4E, 0x68, 0x32, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A,
+	0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00,
+	0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66,
+	0x21, 0x00, 0x1A, 0x9A, 0x0C, 0x66, 0x21, 0x00, 0x1E, 0x9A, 0x0C, 0x66, 0x22, 0x00, 0x1E, 0x9A,
+	0x0C, 0x66, 0x22, 0x00, 0x12, 0x9A, 0x0C, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B,
+	0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0xFE, 0xFE, 0x8B, 0x26,
+	0xFE, 0x8B, 0x66, 0x29, 0x02, 0xDA, 0xEC, 0x08, 0x1E, 0x9A, 0x0C, 0x76, 0x59, 0x00, 0xCA, 0xEC,
+	0x08, 0xFE, 0x9A, 0x0C, 0x82, 0x9A, 0x0C, 0x76, 0xB2, 0x00, 0xEA, 0x9A, 0x0C, 0x76, 0x59, 0x00,
+	0xCA, 0x0B, 0x01, 0xD2, 0x9A, 0x0C, 0x00, 0xB5, 0x20, 0x00, 0x80, 0x80, 0x04, 0x18, 0x00, 0x00,
+	0x00, 0x00, 0x18, 0x00, 0x25, 0x01, 0x07, 0x62, 0x05, 0x00, 0x74, 0xAA, 0x03, 0x56, 0x0A, 0x1D,
+	0x08, 0x01, 0x1D, 0x02, 0x7B, 0x19, 0x3F, 0x25, 0x1F, 0x88, 0xC8, 0x3D, 0x2D, 0x80, 0x82, 0xBD,
+	0x3E, 0x35, 0x00, 0x00, 0x80, 0x3F, 0x60, 0x01, 0x6D, 0x01, 0x07, 0x48, 0x15, 0x00, 0x00, 0x40,
+	0x40, 0x18, 0x00, 0x20, 0x00, 0x2D, 0x00, 0x00, 0x80, 0x40, 0x32, 0x27, 0x08, 0x01, 0x15, 0x01,
+	0x52, 0x7E, 0x59, 0x00, 0x08, 0xB2, 0x03, 0x1F, 0x05, 0x59, 0x10, 0x05, 0xFA, 0x7F, 0x3F, 0x25,
+	0x01, 0x48, 0x10, 0x2D, 0x01, 0xF8, 0x7F, 0x3F, 0x2E, 0x59, 0x00, 0x00, 0xBA, 0x0D, 0x22, 0x66,
+	0x7B, 0x00, 0x00, 0xC2, 0x0D, 0x22, 0x00, 0x81, 0x15, 0x44, 0x00, 0x75, 0x3A, 0x44, 0x00, 0x00,
+	0xCA, 0x0D, 0x22, 0x66, 0x66, 0x00, 0x00, 0xD2, 0x82, 0x22, 0x00, 0x90, 0xDA, 0x03, 0x00, 0xE0,
+	0x03, 0x01, 0xE8, 0x03, 0x00, 0xF0, 0x03, 0x01, 0x80, 0x04, 0x00, 0x88, 0x04, 0x00, 0x90, 0x04,
+	0x00, 0x98, 0x04, 0x00, 0xA0, 0x04, 0x00, 0xA8, 0x04, 0x01, 0xB5, 0x04, 0xFF, 0xFF, 0x7F, 0x7F,
+	0xBD, 0x05, 0x06, 0x00, 0xC5, 0x05, 0x06, 0x00, 0xCD, 0x05, 0x06, 0x00, 0xD5, 0x05, 0x06, 0x04,
+	0xDA, 0x04, 0x29, 0x3F, 0x30, 0xB3, 0x82, 0x12, 0x3F, 0x25, 0xB2, 0x82, 0x12, 0x3F, 0x2D, 0xB1,
+	0x82, 0x12, 0x32, 0xE6, 0x00, 0xDA, 0x3F, 0x01, 0x00, 0xE2, 0x0D, 0x59, 0x66, 0x1D, 0x01, 0x00,
+	0x15, 0x21, 0x55, 0xC6, 0x98, 0x01, 0x00, 0xEA, 0x92, 0x59, 0x00, 0xCA, 0xF1, 0x01, 0x00, 0xF2,
+	0x0D, 0x59, 0xFE, 0x0B, 0x01, 0x42, 0x0B, 0x01, 0x00, 0xFA, 0x0D, 0x59, 0x76, 0x0B, 0x01, 0xCA,
+	0xB2, 0x00, 0x04, 0x82, 0x05, 0x29, 0xBD, 0x72, 0x59, 0x00, 0xCE, 0xFC, 0x02, 0x04, 0x8D, 0x05,
+	0x21, 0x9C, 0x0C, 0x90, 0x05, 0x1C, 0x9D, 0x05, 0x09, 0x14, 0xA0, 0x05, 0x1D, 0xAA, 0x05, 0x34,
+	0x65, 0x0E, 0x61, 0x3A, 0x65, 0x8C, 0x00, 0x2D, 0x01, 0x0A, 0x2E, 0x0E, 0x03, 0x10, 0x15, 0x00,
+	0x00, 0xF4, 0x42, 0x01, 0x20, 0x08, 0x40, 0x20, 0x01, 0x61, 0x6A, 0x14, 0x3E, 0x30, 0x01, 0x38,
+	0x00, 0xB2, 0x0D, 0xA2, 0x30, 0x35, 0xAE, 0x4C, 0x3F, 0x25, 0xBE, 0xB6, 0x05, 0x3E, 0x2D, 0x97,
+	0xBA, 0xFC, 0x3E, 0x9E, 0x03, 0x00, 0x00, 0xCA, 0xFB, 0x00, 0xA0, 0xB8, 0x05, 0x08, 0xC0, 0x05,
+	0x04, 0xD0, 0x05, 0x05, 0xD8, 0x05, 0x08, 0xE0, 0x05, 0x08, 0xE8, 0x05, 0x04, 0xF0, 0x05, 0x08,
+	0xF8, 0x05, 0x08, 0x80, 0x06, 0x08, 0x88, 0x06, 0x04, 0x90, 0x06, 0x00, 0x98, 0x06, 0x00, 0xA0,
+	0x06, 0x00, 0x82, 0x08, 0x29, 0x22, 0x01, 0xAD, 0x62, 0xB7, 0x00, 0x00, 0x00, 0xCA, 0x86, 0x02,
+	0x1C, 0xC0, 0x09, 0x09, 0xC8, 0x09, 0x12, 0xAA, 0x0A, 0x89, 0x24, 0x42, 0x81, 0x01, 0x00, 0x00,
+	0x91, 0x7D, 0x28, 0xB8, 0x0A, 0x05, 0xC0, 0x0A, 0x05, 0xCA, 0x0A, 0x00, 0xE2, 0x0A, 0x09, 0x8A,
+	0x42, 0x2B, 0x00, 0x2E, 0xA8, 0x04, 0x36, 0x05, 0x02, 0x00, 0x02, 0x92, 0xA8, 0x04, 0x00, 0xFA,
+	0x0D, 0x84, 0x66, 0x64, 0x04, 0x1C, 0x88, 0x0B, 0x00, 0x98, 0x0B, 0x00, 0xAD, 0x0B, 0x81, 0x08,
+	0x04, 0xBA, 0x0B, 0xC2, 0x87, 0x00, 0x96, 0x2F, 0x05, 0xF0, 0x4F, 0xC8, 0x0B, 0x08, 0xE0, 0x0B,
+	0x00, 0xED, 0x0B, 0x9A, 0x99, 0x19, 0x3E, 0x88, 0xF1, 0x04, 0x01, 0x90, 0xF1, 0x04, 0x01, 0x11,
+	0x08, 0xD7, 0xDB, 0x69, 0x12, 0x0B, 0x08, 0xA4, 0x27, 0x12, 0x03, 0x01, 0x00, 0x05, 0x18, 0x88,
+	0x19, 0x0A, 0x18, 0x12, 0x10, 0x63, 0x68, 0x61, 0x72, 0x74, 0x2D, 0x34, 0x2D, 0x73, 0x65, 0x72,
+	0x69, 0x65, 0x73, 0x5F, 0x35, 0x2A, 0x04, 0x08, 0x85, 0xE0, 0x69, 0x82, 0xF1, 0x04, 0xE1, 0x18,
+	0x0A, 0x36, 0x0A, 0x20, 0x0A, 0x0E, 0x08, 0x01, 0x12, 0x0A, 0x0D, 0x21, 0xB2, 0x25, 0x00, 0x0C,
+	0x0A, 0x0E, 0x08, 0x02, 0x05, 0x10, 0x04, 0xC0, 0x40, 0x05, 0x10, 0x10, 0x10, 0x00, 0x1A, 0x0A,
+	0x0D, 0xA1, 0xD3, 0x30, 0x15, 0xCD, 0xCC, 0x4C, 0xBF, 0x2A, 0x04, 0x6C, 0x69, 0x6E, 0x65, 0x12,
+	0x36, 0xD6, 0x38, 0x00, 0x08, 0x1A, 0x00, 0x22, 0x29, 0x0F, 0x01, 0x6E, 0x62, 0x20, 0x02, 0x00,
+	0x80, 0xCA, 0x20, 0x02, 0x00, 0x2A, 0xFE, 0x58, 0x00, 0x5A, 0x58, 0x00, 0x00, 0x32, 0x49, 0x71,
+	0x30, 0x07, 0xCE, 0x3F, 0x3F, 0x25, 0xAD, 0xCD, 0x16, 0x3F, 0x2D, 0x67, 0x58, 0x69, 0x32, 0xAF,
+	0x05, 0x00, 0x3A, 0x7E, 0x21, 0x00, 0x00, 0x42, 0x7E, 0x21, 0x00, 0x00, 0x4A, 0x7E, 0x21, 0x00,
+	0x00, 0x52, 0x7E, 0x21, 0x00, 0x00, 0x5A, 0x7E, 0x21, 0x00, 0x00, 0x62, 0x7E, 0x21, 0x00, 0x00,
+	0x6A, 0x7E, 0x21, 0x00, 0x00, 0x72, 0x7E, 0x21, 0x00, 0x00, 0x7A, 0x7E, 0x21, 0x00, 0x04, 0x82,
+	0x01, 0x7E, 0x22, 0x00, 0x00, 0x8A, 0x82, 0x22, 0x00, 0x4C, 0x90, 0x01, 0x01, 0x98, 0x01, 0x10,
+	0xA0, 0x01, 0x07, 0xA8, 0x01, 0x05, 0xB0, 0x01, 0x00, 0xB8, 0x01, 0x02, 0xC5, 0x01, 0xA1, 0x3A,
+	0x40, 0xC8, 0x01, 0x01, 0xD0, 0x01, 0x03, 0xD8, 0x01, 0x0E, 0xE0, 0x01, 0x06, 0xE8, 0x01, 0x08,
+	0xF2, 0x01, 0x8A, 0x3D, 0x05, 0x08, 0x02, 0x43, 0x1D, 0x01, 0x3B, 0x04, 0x20, 0x0A, 0xA1, 0x5A,
+	0x00, 0x3F, 0xA1, 0x3D, 0x00, 0xFA, 0xA2, 0x37, 0x00, 0x04, 0x00, 0x00, 0x1D, 0x37, 0x04, 0x82,
+	0x02, 0x9E, 0x6E, 0x00, 0x32, 0x37, 0x00, 0x00, 0x8A, 0xA2, 0x37, 0x00, 0x0C, 0x40, 0x40, 0x20,
+	0x05, 0x15, 0xA5, 0x00, 0x92, 0x8E, 0x37, 0x00, 0xC9, 0x19, 0x01, 0xA5, 0x08, 0xCD, 0xCC, 0x0C,
+	0x05, 0xDC, 0x70, 0x9A, 0x02, 0x00, 0xA2, 0x02, 0x00, 0xAA, 0x02, 0x00, 0xBA, 0x02, 0x00, 0xC2,
+	0x02, 0x00, 0xCA, 0x02, 0x00, 0xD2, 0x02, 0x00, 0xDA, 0x02, 0x00, 0xE2, 0x02, 0x00, 0xEA, 0x02,
+	0x69, 0x3C, 0x14, 0xE1, 0x92, 0x12, 0x3F, 0x25, 0x24, 0x0E, 0x93, 0x08, 0x00, 0x6E, 0x7E, 0x93,
+	0x08, 0x96, 0x2A, 0x05, 0x00, 0xF2, 0x0D, 0x59, 0xAA, 0xED, 0x03, 0x96, 0x59, 0x00, 0x00, 0xFA,
+	0x0D, 0x59, 0x66, 0x96, 0x03, 0xDA, 0xEC, 0x08, 0x00, 0x82, 0x1A, 0xDD, 0x0A, 0x76, 0x59, 0x00,
+	0xCA, 0x3F, 0x07, 0x00, 0x8A, 0x0D, 0x59, 0xAA, 0xEC, 0x08, 0x96, 0x0B, 0x01, 0x00, 0x92, 0x0D,
+	0x59, 0x76, 0xB2, 0x00, 0xCA, 0x51, 0x05, 0x00, 0x9A, 0x92, 0x59, 0x00, 0xCA, 0x0B, 0x01, 0x00,
+	0xA2, 0x0D, 0x59, 0xFE, 0x16, 0x02, 0x42, 0x16, 0x02, 0x00, 0xAA, 0x0D, 0x59, 0x72, 0x0B, 0x01,
+	0xCE, 0x9E, 0x09, 0xA6, 0x9A, 0x0C, 0x66, 0x7B, 0x00, 0xFE, 0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0xFE,
+	0x9A, 0x0C, 0xEE, 0x9A, 0x0C, 0x1A, 0x9A, 0x0C, 0x66, 0x1D, 0x01, 0xDA, 0xAE, 0x03, 0x1E, 0x9A,
+	0x0C, 0x76, 0x59, 0x00, 0xCA, 0xA3, 0x02, 0xFE, 0x9A, 0x0C, 0x82, 0x9A, 0x0C, 0xFE, 0xB2, 0x00,
+	0x42, 0xB2, 0x00, 0x1E, 0x9A, 0x0C, 0x72, 0x59, 0x00, 0xCE, 0xFC, 0x02, 0x1E, 0x9A, 0x0C, 0x00,
+	0x15, 0x1E, 0x9A, 0x0C, 0x00, 0x19, 0xFA, 0x9A, 0x0C, 0x20, 0x2C, 0x6D, 0x52, 0x3F, 0x25, 0xC4,
+	0x71, 0x25, 0x3F, 0x0E, 0xB4, 0x0C, 0x32, 0x4A, 0x09, 0x0E, 0x6E, 0x0A, 0xCA, 0xAD, 0x01, 0xFE,
+	0x9A, 0x0C, 0xFE, 0x9A, 0x0C, 0x36, 0x9A, 0x0C, 0x42, 0x81, 0x01, 0x66, 0x9A, 0x0C, 0x42, 0x2B,
+	0x00, 0xFE, 0x9A, 0x0C, 0xD6, 0x9A, 0x0C, 0xAA, 0x87, 0x00, 0xEE, 0x9A, 0x0C, 0x00, 0xCF, 0x12,
+	0x9A, 0x0C, 0x00, 0xA2, 0x1A, 0x9A, 0x0C, 0x18, 0xEC, 0x02, 0x0A, 0x1B, 0x12, 0x13, 0x63, 0x1A,
+	0x9A, 0x0C, 0x2C, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x61, 0x78, 0x69, 0x73, 0x5F, 0x30, 0x2A, 0x1E,
+	0x9D, 0x0C, 0x00, 0xC6, 0xE1, 0x00, 0x04, 0x80, 0x3F, 0x1A, 0x30, 0x0C, 0x10, 0x89, 0x2E, 0x39,
+	0x3F, 0x25, 0x01, 0x05, 0x00, 0x2D, 0x01, 0x05, 0x3A, 0x07, 0x0F, 0xCE, 0xDF, 0x06, 0x10, 0x38,
+	0x13, 0x40, 0x0F, 0x5D, 0xC1, 0x83, 0x12, 0xB3, 0x12, 0x0C, 0x7A, 0x00, 0x8A, 0x01, 0x16, 0x05,
+	0x09, 0x01, 0x5F, 0x62, 0x69, 0x00, 0xCE, 0xB9, 0x0E, 0x00, 0x9D, 0x12, 0xA1, 0x0A, 0x0C, 0xAA,
+	0x01, 0x00, 0xBA, 0x0D, 0x62, 0x01, 0x75, 0xFE, 0xFB, 0x0C, 0x32, 0xFB, 0x0C, 0x74, 0xC8, 0x01,
+	0x00, 0xE0, 0x01, 0x01, 0xF0, 0x01, 0x00, 0xF8, 0x01, 0x01, 0x88, 0x02, 0x00, 0x98, 0x02, 0x00,
+	0xA8, 0x02, 0x03, 0xB8, 0x02, 0x13, 0xC0, 0x02, 0x14, 0xE0, 0x02, 0x01, 0x0E, 0x1C, 0x0E, 0x08,
+	0x11, 0x08, 0xD0, 0x92, 0x7E, 0x01, 0x00, 0x31, 0xFE, 0x7E, 0x01, 0xA2, 0x7E, 0x01, 0x08, 0x16,
+	0x40, 0x17, 0xC2, 0x7E, 0x01, 0xCE, 0xE7, 0x01, 0x00, 0x9D, 0x3E, 0x7E, 0x01, 0xFE, 0xE0, 0x01,
+	0x42, 0xE0, 0x01, 0x14, 0xC8, 0x01, 0x01, 0xE0, 0x01, 0x00, 0x36, 0x7E, 0x01, 0x18, 0x01, 0xB8,
+	0x02, 0x16, 0xC0, 0x02, 0x18, 0x35, 0x7E, 0x00, 0xFD, 0x32, 0x7E, 0x01, 0x14, 0xF4, 0x02, 0x0A,
+	0x1E, 0x12, 0x16, 0x49, 0xFC, 0x24, 0x35, 0x2D, 0x63, 0x61, 0x74, 0x65, 0x67, 0x6F, 0x72, 0x79,
+	0x3A, 0xFF, 0x02, 0x08, 0xCB, 0x02, 0x0D, 0x0E, 0x9E, 0x0C, 0x00, 0x1A, 0x8A, 0x96, 0x02, 0xCE,
+	0x18, 0x01, 0x18, 0x28, 0x00, 0x30, 0x14, 0x38, 0x13, 0x4D, 0x41, 0x8C, 0x00, 0x65, 0x01, 0x68,
+	0x08, 0x72, 0x00, 0x82, 0x4D, 0x9F, 0xFE, 0x21, 0x01, 0x42, 0x21, 0x01, 0x00, 0x95, 0x25, 0x83,
+	0x0C, 0xA2, 0x01, 0x00, 0xB2, 0xFE, 0x62, 0x00, 0x5E, 0x62, 0x00, 0x00, 0xC0, 0x0E, 0xFE, 0x0D,
+	0x60, 0x00, 0xD8, 0x01, 0x00, 0xE8, 0x01, 0x00, 0x80, 0x02, 0x00, 0x90, 0x02, 0x00, 0xA0, 0x02,
+	0x02, 0xB0, 0x02, 0x14, 0xB8, 0x02, 0x13, 0xC8, 0x02, 0x00, 0x35, 0x86, 0x00, 0xF9, 0x25, 0x86,
+	0x00, 0x9E, 0x8D, 0x82, 0x14, 0x8F, 0x1C, 0x0A, 0x15, 0x12, 0x0D, 0x35, 0x86, 0x81, 0x8A, 0x55,
+	0xFE, 0x04, 0xEF, 0x1B, 0x25, 0x7D, 0x78, 0x12, 0xAE, 0x04, 0x0A, 0x07, 0x44, 0x65, 0x66, 0x61,
+	0x75, 0x6C, 0x74, 0x12, 0x86, 0x01, 0x0A, 0x0B, 0x46, 0x69, 0x6C, 0x6C, 0x20, 0x43, 0x65, 0x6E,
+	0x74, 0x65, 0x72, 0x12, 0x14, 0x0D, 0x21, 0x3D, 0xC1, 0xB4, 0x00, 0x00, 0x71, 0xD3, 0x08, 0x80,
+	0x3F, 0x1A, 0x01, 0x16, 0x00, 0x80, 0xC1, 0xCA, 0x04, 0x80, 0x3F, 0x12, 0x5E, 0x0E, 0x12, 0xC9,
+	0x16, 0x00, 0x22, 0x52, 0x16, 0x00, 0x14, 0x2D, 0xCD, 0xCC, 0xCC, 0x3E, 0x32, 0x01, 0x1B, 0x00,
+	0x00, 0x15, 0x47, 0x00, 0x80, 0x01, 0x31, 0x20, 0x00, 0x00, 0x38, 0x01, 0x40, 0x01, 0x4A, 0x16,
+	0x0A, 0x01, 0x1C, 0x2C, 0x20, 0x41, 0x15, 0x00, 0x00, 0x70, 0x41, 0x1D, 0x00, 0x00, 0xF0, 0x41,
+	0x85, 0x36, 0x4C, 0x12, 0x8A, 0x01, 0x0A, 0x0F, 0x44, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6F,
+	0x6E, 0x61, 0x6C, 0x20, 0x4B, 0x65, 0x79, 0xEE, 0x8D, 0x00, 0x0D, 0x8D, 0x0C, 0x00, 0x00, 0x40,
+	0x3F, 0x66, 0x8D, 0x00, 0x00, 0x52, 0x01, 0x8D, 0x34, 0x02, 0xBF, 0x80, 0xBE, 0x15, 0x28, 0xB9,
+	0x11, 0xBF, 0x1D, 0x47, 0x64, 0x48, 0xBF, 0x09, 0x8D, 0x0C, 0x85, 0x01, 0x0A, 0x0A, 0x25, 0x16,
+	0x10, 0x52, 0x69, 0x67, 0x68, 0x74, 0xEE, 0x88, 0x00, 0x0D, 0x88, 0x08, 0xCD, 0xCC, 0x4C, 0x86,
+	0x15, 0x01, 0x04, 0xC8, 0x42, 0x32, 0x78, 0x01, 0x18, 0x00, 0x00, 0x12, 0x84, 0x01, 0x0A, 0x09,
+	0x05, 0x88, 0x08, 0x4C, 0x65, 0x66, 0xFE, 0x87, 0x00, 0x09, 0x87, 0x04, 0xCC, 0x3D, 0x66, 0x0F,
+	0x01, 0x2D, 0x9C, 0x04, 0xC8, 0xC2, 0x3A, 0x87, 0x00, 0x28, 0x1A, 0xB7, 0x04, 0x0A, 0x0B, 0x4D,
+	0x65, 0x64, 0x69, 0x75, 0x6D, 0x09, 0x89, 0x01, 0x97, 0x10, 0x54, 0x6F, 0x70, 0x20, 0x4C, 0x72,
+	0x1E, 0x01, 0x10, 0xD3, 0xD1, 0x52, 0x3F, 0x15, 0x01, 0x05, 0x32, 0x33, 0x02, 0x01, 0x11, 0x3A,
+	0x16, 0x00, 0x41, 0x33, 0x86, 0x97, 0x00, 0x00, 0x40, 0x41, 0x33, 0x00, 0xC8, 0x12, 0x1B, 0x16,
+	0xC9, 0x69, 0x10, 0x12, 0x8B, 0x01, 0x0A, 0x10, 0x25, 0x1E, 0x49, 0xBC, 0x10, 0x20, 0x48, 0x69,
+	0x67, 0x68, 0x62, 0xAC, 0x01, 0x1C, 0x68, 0xC5, 0x74, 0x3F, 0x15, 0xB4, 0x3C, 0x78, 0x36, 0x8E,
+	0x00, 0x4A, 0x16, 0x00, 0x0C, 0x2D, 0x66, 0x66, 0x66, 0x6A, 0x34, 0x02, 0x2D, 0x25, 0x00, 0x48,
+	0x21, 0x25, 0x00, 0xB4, 0x01, 0x8E, 0x04, 0xC8, 0x42, 0xFE, 0x34, 0x02, 0xFE, 0x34, 0x02, 0x49,
+	0x34, 0x00, 0x20, 0x0D, 0x88, 0x61, 0x49, 0x2E, 0x16, 0x01, 0x08, 0x4C, 0x6F, 0x77, 0x62, 0x15,
+	0x01, 0xA1, 0x24, 0x12, 0xA6, 0x0C, 0x32, 0xA3, 0x01, 0x4A, 0x16, 0x00, 0x12, 0xA8, 0x11, 0x82,
+	0x3A, 0x02, 0x29, 0x15, 0x08, 0xC2, 0x1D, 0x00, 0x31, 0x15, 0x20, 0x22, 0xB1, 0x04, 0x0A, 0x0A,
+	0x53, 0x6F, 0x66, 0x74, 0x4D, 0x2B, 0xFE, 0x6E, 0x04, 0xDA, 0x6E, 0x04, 0x00, 0x30, 0x41, 0x3B,
+	0x00, 0x48, 0x2E, 0xAD, 0x01, 0x21, 0x25, 0xFE, 0x6E, 0x04, 0x4E, 0x6E, 0x04, 0x00, 0x80, 0x9E,
+	0x25, 0x01, 0x2E, 0x8D, 0x00, 0xFE, 0x6E, 0x04, 0x4A, 0x6E, 0x04, 0x8A, 0x83, 0x05, 0xFE, 0x6E,
+	0x04, 0xFE, 0x6E, 0x04, 0x5E, 0x6E, 0x04, 0x00, 0x2A, 0xFE, 0x34, 0x02, 0xFE, 0x34, 0x02, 0xFE,
+	0x34, 0x02, 0xFE, 0x34, 0x02, 0xFE, 0x34, 0x02, 0xFE, 0x34, 0x02, 0xFE, 0x34, 0x02, 0xFE, 0x34,
+	0x02, 0xCA, 0x34, 0x02, 0x00, 0x32, 0xFE, 0xD3, 0x08, 0xFE, 0xD3, 0x08, 0xFE, 0xD3, 0x08, 0xFE,
+	0xD3, 0x08, 0xFE, 0xD3, 0x08, 0xFE, 0xD3, 0x08, 0xFE, 0xD3, 0x08, 0xFE, 0xD3, 0x08, 0xBE, 0xD3,
+	0x08, 0x10, 0x3A, 0xD4, 0x04, 0x0A, 0x0D, 0x1A, 0xD3, 0x08, 0x16, 0x3E, 0x08, 0xFE, 0x9C, 0x06,
+	0x4A, 0x9C, 0x06, 0x08, 0x9A, 0x99, 0x99, 0x86, 0xF5, 0x09, 0x04, 0x40, 0xC1, 0x0E, 0x1A, 0x21,
+	0x2E, 0x0A, 0x0B, 0x00, 0xAA, 0xFE, 0x0A, 0x0B, 0x52, 0x0A, 0x0B, 0x76, 0xD6, 0x08, 0x3C, 0x5A,
+	0x36, 0x0A, 0x14, 0x0D, 0x01, 0x01, 0xF0, 0x41, 0x15, 0x91, 0x00, 0x20, 0x42, 0x1D, 0xF4, 0x22,
+	0x97, 0x0B, 0x38, 0x14, 0x0D, 0x31, 0x5C, 0xC6, 0x3E, 0x15, 0x26, 0x28, 0x14, 0xBF, 0x1D, 0x6B,
+	0xB5, 0x37, 0x16, 0x20, 0x0B, 0x10, 0x1D, 0xCD, 0xCC, 0x4C, 0x40, 0x26, 0xF6, 0x08, 0x0C, 0x45,
+	0x64, 0x67, 0x65, 0x7A, 0x2A, 0x0B, 0x08, 0xE6, 0x0E, 0x66, 0x1E, 0x69, 0x08, 0x00, 0xF8, 0x1A,
+	0x08, 0x23, 0x04, 0x22, 0x14, 0x4E, 0x16, 0x00, 0x96, 0x2A, 0x0B, 0x00, 0x48, 0x0E, 0x2A, 0x0B,
+	0x00, 0xA0, 0x21, 0x35, 0x1E, 0x0C, 0x0A, 0x0E, 0x93, 0x0A, 0x05, 0x88, 0x72, 0x2A, 0x0B, 0xFE,
+	0x87, 0x00, 0x3E, 0x87, 0x00, 0x0E, 0x05, 0x0A, 0x2E, 0x87, 0x00, 0x00, 0x55, 0x0E, 0x3B, 0x09,
+	0x08, 0x5A, 0x00, 0x62, 0x16, 0xDF, 0x0E, 0x0E, 0x4A, 0x0D, 0x25, 0x26, 0x0E, 0x3E, 0x09, 0x3E,
+	0xE5, 0x20, 0xCE, 0xDF, 0x0E, 0x10, 0x68, 0x00, 0x72, 0x00, 0x7D, 0x01, 0x63, 0x18, 0x85, 0x01,
+	0x00, 0x00, 0x20, 0x41, 0x8D, 0x01, 0x06, 0x5C, 0x42, 0x90, 0x01, 0x00, 0xA0, 0x01, 0x0D, 0xA8,
+	0x01, 0x0C, 0xF0, 0x01, 0x0D, 0xF8, 0x01, 0x00, 0x85, 0x02, 0x00, 0x00, 0xC0, 0x40, 0xD5, 0x07,
+	0x01, 0x7D, 0x0E, 0x25, 0x11, 0x20, 0x10, 0x08, 0xFA, 0xDB, 0x69, 0x12, 0x0A, 0x08, 0xA0, 0x1A,
+	0x21, 0x0E, 0x10, 0x7D, 0x0A, 0x16, 0x12, 0x0E, 0x12, 0x18, 0x0E, 0x20, 0x2D, 0x35, 0x2D, 0x6C,
+	0x65, 0x67, 0x65, 0x6E, 0x64, 0x22, 0x21, 0x0E, 0x10, 0x61, 0x0A, 0x00, 0x10, 0x11, 0x12, 0x0B,
+	0x0A, 0xC6, 0x78, 0x1E, 0x0E, 0xD8, 0x12, 0x86, 0x67, 0x25, 0x24, 0x31, 0x08, 0x85, 0xDC, 0x69,
+	0x12, 0x2B, 0x08, 0xE6, 0x0F, 0x16, 0xCB, 0x1F, 0x2C, 0xCA, 0x02, 0x22, 0x08, 0x0A, 0x04, 0x0A,
+	0x02, 0x0B, 0x2B, 0x18, 0x01, 0x0D, 0x0A, 0x10, 0x2F, 0x18, 0x01, 0x22, 0x0A, 0x05, 0x14, 0x20,
+	0x2E, 0x10, 0x03, 0x18, 0x01, 0x0A, 0x20, 0x12, 0x18, 0x11, 0xAF, 0x34, 0x70, 0x61, 0x72, 0x61,
+	0x67, 0x72, 0x61, 0x70, 0x68, 0x53, 0x74, 0x79, 0x6C, 0x65, 0x1E, 0x56, 0x13, 0x1C, 0x50, 0x39,
+	0x5A, 0xB5, 0x01, 0x08, 0x00, 0x10, 0x0E, 0xB1, 0x0E, 0x44, 0x40, 0x41, 0x2A, 0x0D, 0x48, 0x65,
+	0x6C, 0x76, 0x65, 0x74, 0x69, 0x63, 0x61, 0x4E, 0x65, 0x75, 0x65, 0x3A, 0x0E, 0xD5, 0x25, 0x24,
+	0xC7, 0xFF, 0x7F, 0x3F, 0x25, 0xFF, 0xFF, 0x7F, 0x3F, 0x2D, 0x01, 0x05, 0x2E, 0x67, 0x13, 0x28,
+	0x40, 0x01, 0x50, 0x00, 0x58, 0x00, 0x60, 0x00, 0x68, 0x00, 0x75, 0x21, 0x31, 0x00, 0x7D, 0x01,
+	0x05, 0x20, 0x80, 0x01, 0x01, 0xA0, 0x01, 0x01, 0xB0, 0x01, 0x01, 0x22, 0x85, 0x1D, 0x04, 0xDD,
+	0x01, 0x01, 0x18, 0x0C, 0xE0, 0x01, 0x01, 0xF5, 0x12, 0xF5, 0x0F, 0x00, 0xF8, 0x12, 0x90, 0x0F,
+	0x14, 0x88, 0x02, 0x01, 0x98, 0x02, 0xFF, 0x11, 0x01, 0x44, 0x01, 0xA0, 0x02, 0x01, 0xB0, 0x02,
+	0x01, 0xC0, 0x02, 0x00, 0xC8, 0x02, 0x00, 0xD8, 0x02, 0x01, 0xF2, 0x02, 0x16, 0x17, 0x1E, 0x66,
+	0x7B, 0x00, 0x44, 0xF8, 0x02, 0x00, 0x62, 0x6C, 0x08, 0x02, 0x1A, 0x01, 0x2E, 0x25, 0x00, 0x00,
+	0x10, 0x42, 0x28, 0x01, 0x3D, 0x01, 0x65, 0x14, 0x40, 0x01, 0x48, 0x00, 0x50, 0x00, 0x12, 0x45,
+	0x12, 0x1C, 0x6A, 0x00, 0x70, 0x00, 0x78, 0x00, 0x8A, 0x01, 0x0E, 0xA7, 0x20, 0x1A, 0x4C, 0x0F,
+	0x16, 0x75, 0x10, 0x0E, 0xFE, 0x11, 0x08, 0x00, 0x00, 0xA5, 0x05, 0x95, 0x00, 0xAD, 0x05, 0x06,
+	0x1C, 0xCA, 0x01, 0x00, 0xD0, 0x01, 0x01, 0xD8, 0x01, 0x01, 0x8E, 0x04, 0x0F, 0xE0, 0x12, 0x33,
+	0x13, 0x50, 0xB8, 0x02, 0x01, 0xC8, 0x02, 0x01, 0xD8, 0x02, 0x00, 0xE0, 0x02, 0x00, 0xE8, 0x02,
+	0x00, 0xF0, 0x02, 0x00, 0x31, 0x08, 0x86, 0xFE, 0x7C, 0x01, 0x39, 0x7C, 0x1A, 0x54, 0x13, 0xFE,
+	0x7C, 0x01, 0xFE, 0x7C, 0x01, 0xFE, 0x7C, 0x01, 0xFE, 0x7C, 0x01, 0xA6, 0x7C, 0x01, 0x00, 0x8F,
+	0x32, 0x7C, 0x01, 0x00, 0xCB, 0x86, 0xF8, 0x02, 0x08, 0x21, 0x12, 0x19, 0x5A, 0xF8, 0x02, 0x00,
+	0x31, 0x1A, 0x4F, 0x16, 0x86, 0x7D, 0x01, 0x41, 0x52, 0x56, 0x82, 0x04, 0xFE, 0xF9, 0x02, 0x82,
+	0xF9, 0x02, 0x66, 0x7B, 0x00, 0xFE, 0xF9, 0x02, 0xCA, 0xF9, 0x02, 0x00, 0x90, 0xFE, 0x7D, 0x01,
+	0x3D, 0x7D, 0xA2, 0xFA, 0x02, 0x66, 0x02, 0x01, 0xFE, 0x7D, 0x01, 0xFE, 0x7D, 0x01, 0xFE, 0x7D,
+	0x01, 0xB6, 0x7D, 0x01, 0x00, 0x91, 0xFE, 0x7D, 0x01, 0x3D, 0x7D, 0x00, 0x32, 0xC9, 0xAC, 0x2E,
+	0xFA, 0x02, 0x00, 0xF0, 0x52, 0xF3, 0x05, 0xFE, 0x7D, 0x01, 0xFE, 0x7D, 0x01, 0xFE, 0x7D, 0x01,
+	0xFE, 0x7D, 0x01, 0x31, 0x7D, 0x00, 0x92, 0xFE, 0x7D, 0x01, 0x3D, 0x7D, 0x00, 0x33, 0x46, 0x7D,
+	0x01, 0x56, 0x70, 0x07, 0xFE, 0x7D, 0x01, 0xFE, 0x7D, 0x01, 0xFE, 0x7D, 0x01, 0xFE, 0x7D, 0x01,
+	0x31, 0x7D, 0x00, 0x93, 0xFE, 0x7D, 0x01, 0x3D, 0x7D, 0x00, 0x34, 0xFE, 0x7D, 0x01, 0xFE, 0x7D,
+	0x01, 0xFE, 0x7D, 0x01, 0xFE, 0x7D, 0x01, 0xBE, 0x7D, 0x01, 0x00, 0x94, 0xFE, 0x7D, 0x01, 0x3D,
+	0x7D, 0x1A, 0x5D, 0x2A, 0x2E, 0x77, 0x04, 0x00, 0x20, 0xFE, 0x77, 0x04, 0xFE, 0x77, 0x04, 0xFE,
+	0x77, 0x04, 0xFE, 0x77, 0x04, 0x72, 0x77, 0x04, 0x00, 0x95, 0xFE, 0x7D, 0x01, 0x3D, 0x7D, 0x00,
+	0x36, 0x9E, 0xFA, 0x02, 0x00, 0x09, 0x22, 0x1F, 0x31, 0x00, 0x03, 0x3A, 0x1F, 0x31, 0xFE, 0x71,
+	0x07, 0x82, 0x71, 0x07, 0x66, 0x7B, 0x00, 0xFE, 0xEE, 0x08, 0xCA, 0xEE, 0x08, 0x00, 0x96, 0xFE,
+	0x7D, 0x01, 0x3D, 0x7D, 0x00, 0x37, 0x46, 0x7D, 0x01, 0xFE, 0xFA, 0x02, 0xFE, 0xFA, 0x02, 0xFE,
+	0xFA, 0x02, 0xFE, 0xFA, 0x02, 0x76, 0xFA, 0x02, 0x00, 0x97, 0xFE, 0x7D, 0x01, 0x3D, 0x7D, 0x00,
+	0x38, 0x46, 0x7D, 0x01, 0xFE, 0x71, 0x07, 0xFE, 0x71, 0x07, 0xFE, 0x71, 0x07, 0xFE, 0x71, 0x07,
+	0x76, 0x71, 0x07, 0x00, 0x98, 0xFE, 0x7D, 0x01, 0x3D, 0x7D, 0x00, 0x39, 0x46, 0x7D, 0x01, 0x04,
+	0x00, 0x42, 0x4E, 0x5E, 0x10, 0xFE, 0xEE, 0x08, 0xFE, 0xEE, 0x08, 0xFE, 0xEE, 0x08, 0xFE, 0xEE,
+	0x08, 0x1E, 0xEE, 0x08, 0x00, 0x87, 0x32, 0x7D, 0x01, 0xF2, 0xDA, 0x11, 0x4A, 0xE7, 0x0B, 0x56,
+	0xF9, 0x02, 0x66, 0xF0, 0x36, 0xFE, 0xF3, 0x05, 0x82, 0xF3, 0x05, 0x66, 0x7B, 0x00, 0xFE, 0xF3,
+	0x05, 0xCA, 0xF3, 0x05, 0x00, 0x99, 0x32, 0x7C, 0x01, 0xF2, 0x5E, 0x10, 0x00, 0x32, 0x4A, 0x5E,
+	0x10, 0xFE, 0xF3, 0x05, 0xFE, 0xF3, 0x05, 0xFE, 0xF3, 0x05, 0xFE, 0xF3, 0x05, 0x76, 0xF3, 0x05,
+	0x00, 0x9A, 0xFE, 0x7D, 0x01, 0x3D, 0x7D, 0x4A, 0x5E, 0x10, 0xFE, 0x7D, 0x01, 0xFE, 0x7D, 0x01,
+	0xFE, 0x7D, 0x01, 0xFE, 0x7D, 0x01, 0x76, 0x7D, 0x01, 0x00, 0x9B, 0xFE, 0x7D, 0x01, 0x3D, 0x7D,
+	0x4A, 0x77, 0x04, 0xFE, 0x5E, 0x10, 0xFE, 0x5E, 0x10, 0xFE, 0x5E, 0x10, 0xFE, 0x5E, 0x10, 0x76,
+	0x5E, 0x10, 0x00, 0x9C, 0xFE, 0x7D, 0x01, 0x3D, 0x7D, 0x4A, 0x5E, 0x10, 0xFE, 0xFA, 0x02, 0xFE,
+	0xFA, 0x02, 0xFE, 0xFA, 0x02, 0xFE, 0xFA, 0x02, 0x76, 0xFA, 0x02, 0x00, 0x9D, 0xFE, 0x7D, 0x01,
+	0x3D, 0x7D, 0x4A, 0x5E, 0x10, 0xFE, 0x7D, 0x01, 0xFE, 0x7D, 0x01, 0xFE, 0x7D, 0x01, 0xFE, 0x7D,
+	0x01, 0x76, 0x7D, 0x01, 0x00, 0x9E, 0xFE, 0x7D, 0x01, 0x3D, 0x7D, 0xFE, 0x5E, 0x10, 0xFE, 0x5E,
+	0x10, 0xFE, 0x5E, 0x10, 0xFE, 0x5E, 0x10, 0xC2, 0x5E, 0x10, 0x00, 0x9F, 0xFE, 0x7D, 0x01, 0x3D,
+	0x7D, 0xFE, 0x5E, 0x10, 0xFE, 0x5E, 0x10, 0xFE, 0x5E, 0x10, 0xFE, 0x5E, 0x10, 0xC2, 0x5E, 0x10,
+	0x00, 0xA0, 0xFE, 0x7D, 0x01, 0x3D, 0x7D, 0x4A, 0x5E, 0x10, 0x56, 0xE8, 0x0B, 0x66, 0x47, 0x1D,
+	0xFE, 0xE8, 0x0B, 0x82, 0xE8, 0x0B, 0x66, 0x7B, 0x00, 0xFE, 0xE8, 0x0B, 0xCA, 0xE8, 0x0B, 0x00,
+	0xA1, 0xFE, 0x7D, 0x01, 0x3D, 0x7D, 0x4A, 0x5E, 0x10, 0xFE, 0xF4, 0x05, 0xFE, 0xF4, 0x05, 0xFE,
+	0xF4, 0x05, 0xFE, 0xF4, 0x05, 0x76, 0xF4, 0x05, 0x00, 0xA2, 0xFE, 0x7D, 0x01, 0x3D, 0x7D, 0x4A,
+	0x5E, 0x10, 0xFE, 0x7D, 0x01, 0xFE, 0x7D, 0x01, 0xFE, 0x7D, 0x01, 0xFE, 0x7D, 0x01, 0x76, 0x7D,
+	0x01, 0x00, 0x88, 0x32, 0x7D, 0x01, 0xF2, 0x5E, 0x10, 0x4A, 0x6A, 0x0A, 0x56, 0x76, 0x04, 0xFE,
+	0xDA, 0x11, 0xFE, 0xDA, 0x11, 0xFE, 0xDA, 0x11, 0xFE, 0xDA, 0x11, 0x1E, 0xDA, 0x11, 0x00, 0x89,
+	0xFE, 0x7C, 0x01, 0x39, 0x7C, 0x4A, 0x69, 0x0A, 0x56, 0x7C, 0x01, 0x66, 0x5F, 0x11, 0xFE, 0xF2,
+	0x05, 0x82, 0xF2, 0x05, 0x66, 0x7B, 0x00, 0xFE, 0xF2, 0x05, 0xCA, 0xF2, 0x05, 0x00, 0x8A, 0xFE,
+	0x7C, 0x01, 0x39, 0x7C, 0x4A, 0x68, 0x0A, 0x56, 0x7C, 0x01, 0xFE, 0xF8, 0x02, 0xFE, 0xF8, 0x02,
+	0xFE, 0xF8, 0x02, 0xFE, 0xF8, 0x02, 0x51, 0xF8, 0x00, 0x8B, 0xFE, 0x7C, 0x01, 0x39, 0x7C, 0xA2,
+	0x67, 0x0A, 0x66, 0x6F, 0x08, 0xFE, 0xF8, 0x02, 0x82, 0xF8, 0x02, 0x66, 0x7B, 0x00, 0xFE, 0xF8,
+	0x02, 0xCA, 0xF8, 0x02, 0x00, 0x8C, 0xFE, 0x7C, 0x01, 0x39, 0x7C, 0xA2, 0x66, 0x0A, 0x66, 0xF9,
+	0x03, 0xFE, 0x7C, 0x01, 0x82, 0x7C, 0x01, 0x66, 0x7B, 0x00, 0xFE, 0x7C, 0x01, 0xCA, 0x7C, 0x01,
+	0x00, 0x8D, 0xFE, 0x7C, 0x01, 0x39, 0x7C, 0x4A, 0x65, 0x0A, 0xFE, 0x74, 0x04, 0xFE, 0x74, 0x04,
+	0xFE, 0x74, 0x04, 0xFE, 0x74, 0x04, 0x76, 0x74, 0x04, 0x00, 0x8E, 0xFE, 0x7C, 0x01, 0x39, 0x7C,
+	0x4A, 0x64, 0x0A, 0x56, 0x7C, 0x01, 0x66, 0x7D, 0x02, 0xFE, 0xF8, 0x02, 0xFE, 0xF8, 0x02, 0xFE,
+	0xF8, 0x02, 0xAE, 0xF8, 0x02, 0x0C, 0x11, 0x08, 0xA3, 0xDC, 0x0E, 0x67, 0x4C, 0x00, 0xA6, 0x1A,
+	0x2A, 0x2D, 0x14, 0x83, 0x01, 0x0A, 0x1F, 0x12, 0x17, 0x1E, 0x84, 0x29, 0x2C, 0x72, 0x65, 0x66,
+	0x65, 0x72, 0x65, 0x6E, 0x63, 0x65, 0x4C, 0x69, 0x6E, 0x22, 0x7B, 0x2C, 0x0C, 0x82, 0xF1, 0x04,
+	0x5E, 0x1A, 0x91, 0x4D, 0x66, 0x34, 0x07, 0x10, 0x15, 0x00, 0x00, 0xE0, 0x3F, 0xC6, 0xA1, 0x50,
+	0x24, 0x12, 0x00, 0x18, 0x0F, 0x20, 0x0F, 0x11, 0x08, 0xFE, 0xDB, 0x01, 0x95, 0x1E, 0xFC, 0x4C,
+	0x08, 0xE9, 0x18, 0x0A, 0x22, 0xFC, 0x4C, 0x00, 0x35, 0x1E, 0xFC, 0x4C, 0x1A, 0xB2, 0x19, 0x0C,
+	0x82, 0xF1, 0x04, 0xC2, 0xFE, 0xFC, 0x4C, 0xFE, 0xFC, 0x4C, 0xFE, 0xFC, 0x4C, 0xFE, 0xFC, 0x4C,
+	0xA6, 0xFC, 0x4C, 0x30, 0x62, 0x45, 0xA4, 0x3E, 0x25, 0x66, 0x1C, 0xB1, 0x3E, 0x2D, 0x64, 0x05,
+	0xBE, 0x32, 0x4C, 0x50, 0x1A, 0xFC, 0x4C, 0x66, 0x21, 0x00, 0x1A, 0xFC, 0x4C, 0x66, 0x21, 0x00,
+	0x1A, 0xFC, 0x4C, 0x66, 0x21, 0x00, 0x1A, 0xFC, 0x4C, 0x66, 0x21, 0x00, 0x1A, 0xFC, 0x4C, 0x66,
+	0x21, 0x00, 0x1A, 0xFC, 0x4C, 0x66, 0x21, 0x00, 0x1A, 0xFC, 0x4C, 0x66, 0x21, 0x00, 0x1A, 0xFC,
+	0x4C, 0x66, 0x21, 0x00, 0x1A, 0xFC, 0x4C, 0x66, 0x21, 0x00, 0x1E, 0xFC, 0x4C, 0x66, 0x22, 0x00,
+	0x00, 0x8A, 0x1A, 0xFC, 0x4C, 0x66, 0x22, 0x00, 0x1E, 0xFC, 0x4C, 0x00, 0x04, 0xFE, 0xFC, 0x4C,
+	0xFE, 0xFC, 0x4C, 0xFE, 0xFC, 0x4C, 0xFE, 0xFC, 0x4C, 0xFE, 0xFC, 0x4C, 0xFE, 0xFC, 0x4C, 0xFE,
+	0xFC, 0x4C, 0xFE, 0xFC, 0x4C, 0x16, 0xFC, 0x4C, 0x66, 0x29, 0x02, 0x12, 0xA8, 0x3C, 0xC6, 0x47,
+	0x05, 0x1E, 0xFC, 0x4C, 0x76, 0x59, 0x00, 0x00, 0x40, 0xC6, 0x59, 0x00, 0xFE, 0xFC, 0x4C, 0x82,
+	0xFC, 0x4C, 0x76, 0xB2, 0x00, 0xCA, 0x0B, 0x01, 0x1E, 0xFC, 0x4C, 0x76, 0x59, 0x00, 0xCA, 0x0B,
+	0x01, 0xFE, 0xFC, 0x4C, 0x82, 0xFC, 0x4C, 0x72, 0xB2, 0x00, 0xCE, 0x00, 0x4A, 0xA6, 0xFC, 0x4C,
+	0x66, 0x7B, 0x00, 0xFE, 0xFC, 0x4C, 0xFE, 0xFC, 0x4C, 0xFE, 0xFC, 0x4C, 0xEE, 0xFC, 0x4C, 0x1A,
+	0xFC, 0x4C, 0x66, 0x1D, 0x01, 0xDA, 0xAE, 0x03, 0x1E, 0xFC, 0x4C, 0x76, 0x59, 0x00, 0xCA, 0xA3,
+	0x02, 0xFE, 0xFC, 0x4C, 0x82, 0xFC, 0x4C, 0xFE, 0xB2, 0x00, 0x42, 0xB2, 0x00, 0x00, 0x82, 0x1A,
+	0xF4, 0x58, 0x72, 0x59, 0x00, 0xCE, 0xFC, 0x02, 0xFE, 0xFC, 0x4C, 0x42, 0xFC, 0x4C, 0x30, 0x6E,
+	0xCB, 0xFC, 0x3E, 0x25, 0xE4, 0x46, 0x08, 0x3F, 0x2D, 0xE5, 0x35, 0x12, 0x32, 0x5F, 0x37, 0x0E,
+	0x49, 0x44, 0xCA, 0xAD, 0x01, 0xFE, 0xFC, 0x4C, 0xFE, 0xFC, 0x4C, 0x12, 0xFC, 0x4C, 0x0C, 0x0A,
+	0xAA, 0x0A, 0x00, 0x42, 0x77, 0x59, 0x72, 0x8D, 0x01, 0xCE, 0x98, 0x02, 0xD6, 0x77, 0x59, 0xFE,
+	0x87, 0x00, 0x42, 0x87, 0x00, 0x00, 0xC8, 0x52, 0x77, 0x59, 0x00, 0xFF, 0x86, 0x7B, 0x0C, 0x1A,
+	0xB0, 0x24, 0xFE, 0x7B, 0x0C, 0xFE, 0x7B, 0x0C, 0xFE, 0x7B, 0x0C, 0xFE, 0x7B, 0x0C, 0xB6, 0x7B,
+	0x0C, 0x30, 0x84, 0x1D, 0xF2, 0x3E, 0x25, 0xC8, 0xC1, 0x00, 0x3F, 0x2D, 0x0C, 0x61, 0x09, 0x32,
+	0x31, 0x03, 0x1A, 0x7B, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x7B, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x7B,
+	0x0C, 0x66, 0x21, 0x00, 0x1A, 0x7B, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x7B, 0x0C, 0x66, 0x21, 0x00,
+	0x1A, 0x7B, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x7B, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x7B, 0x0C, 0x66,
+	0x21, 0x00, 0x1A, 0x7B, 0x0C, 0x66, 0x21, 0x00, 0x1E, 0x7B, 0x0C, 0x66, 0x22, 0x00, 0x1E, 0x7B,
+	0x0C, 0x66, 0x22, 0x00, 0x1E, 0x7B, 0x0C, 0xFE, 0x77, 0x59, 0xFE, 0x77, 0x59, 0xFE, 0x77, 0x59,
+	0xFE, 0x77, 0x59, 0xFE, 0x77, 0x59, 0xFE, 0x77, 0x59, 0xFE, 0x77, 0x59, 0xFE, 0x77, 0x59, 0x1A,
+	0x77, 0x59, 0x66, 0x29, 0x02, 0xDA, 0xCD, 0x08, 0x1E, 0x7B, 0x0C, 0x76, 0x59, 0x00, 0xCA, 0x20,
+	0x07, 0xFE, 0x7B, 0x0C, 0x82, 0x7B, 0x0C, 0x76, 0xB2, 0x00, 0xEA, 0x7B, 0x0C, 0x76, 0x59, 0x00,
+	0xCA, 0x0B, 0x01, 0xFE, 0x7B, 0x0C, 0x82, 0x7B, 0x0C, 0x72, 0xB2, 0x00, 0xCE, 0x7F, 0x09, 0xA6,
+	0x7B, 0x0C, 0x66, 0x7B, 0x00, 0xFE, 0x7B, 0x0C, 0xFE, 0x7B, 0x0C, 0xFE, 0x7B, 0x0C, 0xEE, 0x7B,
+	0x0C, 0x1A, 0x7B, 0x0C, 0x66, 0x1D, 0x01, 0xDA, 0xAE, 0x03, 0x1E, 0x7B, 0x0C, 0x76, 0x59, 0x00,
+	0xCA, 0xA3, 0x02, 0xFE, 0x7B, 0x0C, 0x82, 0x7B, 0x0C, 0xFE, 0xB2, 0x00, 0x42, 0xB2, 0x00, 0x1E,
+	0x7B, 0x0C, 0x72, 0x59, 0x00, 0xCE, 0xFC, 0x02, 0xFE, 0x7B, 0x0C, 0x42, 0x7B, 0x0C, 0x30, 0xBF,
+	0x2C, 0x26, 0x3F, 0x25, 0x5A, 0xBE, 0x30, 0x3F, 0x2D, 0x3F, 0x94, 0x3C, 0x32, 0x4A, 0x09, 0xFE,
+	0x7B, 0x0C, 0xFE, 0x7B, 0x0C, 0xFE, 0x7B, 0x0C, 0x42, 0x7B, 0x0C, 0x72, 0x8D, 0x01, 0xCE, 0x98,
+	0x02, 0xD6, 0x7B, 0x0C, 0xFE, 0x87, 0x00, 0x42, 0x87, 0x00, 0x56, 0x7B, 0x0C, 0x00, 0x80, 0x12,
+	0x8B, 0x19, 0x72, 0xF6, 0x18, 0x1A, 0xAE, 0x2F, 0xFE, 0x7B, 0x0C, 0xFE, 0x7B, 0x0C, 0xFE, 0x7B,
+	0x0C, 0xFE, 0x7B, 0x0C, 0xB6, 0x7B, 0x0C, 0x30, 0xB9, 0x33, 0x27, 0x3F, 0x25, 0x7F, 0xAD, 0x2B,
+	0x3F, 0x2D, 0x85, 0x67, 0x2F, 0x32, 0x31, 0x03, 0x1A, 0x7B, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x7B,
+	0x0C, 0x66, 0x21, 0x00, 0x1A, 0x7B, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x7B, 0x0C, 0x66, 0x21, 0x00,
+	0x1A, 0x7B, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x7B, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x7B, 0x0C, 0x66,
+	0x21, 0x00, 0x1A, 0x7B, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x7B, 0x0C, 0x66, 0x21, 0x00, 0x1E, 0x7B,
+	0x0C, 0x66, 0x22, 0x00, 0x1E, 0x7B, 0x0C, 0x66, 0x22, 0x00, 0xFE, 0x7B, 0x0C, 0xFE, 0x7B, 0x0C,
+	0xFE, 0x7B, 0x0C, 0xFE, 0x7B, 0x0C, 0xFE, 0x7B, 0x0C, 0xFE, 0x7B, 0x0C, 0xFE, 0x7B, 0x0C, 0xFE,
+	0x7B, 0x0C, 0x3A, 0x7B, 0x0C, 0x66, 0x29, 0x02, 0xDA, 0xCD, 0x08, 0x1E, 0x7B, 0x0C, 0x76, 0x59,
+	0x00, 0xCA, 0xCD, 0x08, 0xFE, 0x7B, 0x0C, 0x82, 0x7B, 0x0C, 0x76, 0xB2, 0x00, 0xEA, 0x7B, 0x0C,
+	0x76, 0x59, 0x00, 0xCA, 0x0B, 0x01, 0xFE, 0x7B, 0x0C, 0x82, 0x7B, 0x0C, 0x72, 0xB2, 0x00, 0xCE,
+	0x7F, 0x09, 0xA6, 0x7B, 0x0C, 0x66, 0x7B, 0x00, 0xFE, 0x7B, 0x0C, 0xFE, 0x7B, 0x0C, 0xFE, 0x7B,
+	0x0C, 0xEE, 0x7B, 0x0C, 0x1A, 0x7B, 0x0C, 0x66, 0x1D, 0x01, 0xDA, 0xAE, 0x03, 0x1E, 0x7B, 0x0C,
+	0x76, 0x59, 0x00, 0xCA, 0xA3, 0x02, 0xFE, 0x7B, 0x0C, 0x82, 0x7B, 0x0C, 0xFE, 0xB2, 0x00, 0x42,
+	0xB2, 0x00, 0x1E, 0x7B, 0x0C, 0x72, 0x59, 0x00, 0xCE, 0xFC, 0x02, 0xFE, 0x7B, 0x0C, 0x42, 0x7B,
+	0x0C, 0x30, 0x00, 0x02, 0x58, 0x3F, 0x25, 0x38, 0xCA, 0x5D, 0x3F, 0x2D, 0xB8, 0x9A, 0x62, 0x32,
+	0x4A, 0x09, 0xFE, 0x7B, 0x0C, 0xFE, 0x7B, 0x0C, 0xFE, 0x7B, 0x0C, 0x42, 0x7B, 0x0C, 0x72, 0x8D,
+	0x01, 0xCE, 0x98, 0x02, 0xD6, 0x7B, 0x0C, 0xFE, 0x87, 0x00, 0x42, 0x87, 0x00, 0x56, 0x7B, 0x0C,
+	0x00, 0x81, 0x86, 0x7B, 0x0C, 0x1A, 0x42, 0x30, 0xFE, 0x7B, 0x0C, 0xFE, 0x7B, 0x0C, 0xFE, 0x7B,
+	0x0C, 0xFE, 0x7B, 0x0C, 0xB6, 0x7B, 0x0C, 0x34, 0xB5, 0xE0, 0xE8, 0x3D, 0x25, 0xBD, 0xEE, 0xE8,
+	0x3D, 0x2D, 0x31, 0xAD, 0xF1, 0x3D, 0x2E, 0x86, 0x53, 0x1A, 0x7B, 0x0C, 0x66, 0x21, 0x00, 0x1A,
+	0x7B, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x7B, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x7B, 0x0C, 0x66, 0x21,
+	0x00, 0x1A, 0x7B, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x7B, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x7B, 0x0C,
+	0x66, 0x21, 0x00, 0x1A, 0x7B, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x7B, 0x0C, 0x66, 0x21, 0x00, 0x1E,
+	0x7B, 0x0C, 0x66, 0x22, 0x00, 0x1E, 0x7B, 0x0C, 0x66, 0x22, 0x00, 0xFE, 0x7B, 0x0C, 0xFE, 0x7B,
+	0x0C, 0xFE, 0x7B, 0x0C, 0xFE, 0x7B, 0x0C, 0xFE, 0x7B, 0x0C, 0xFE, 0x7B, 0x0C, 0xFE, 0x7B, 0x0C,
+	0xFE, 0x7B, 0x0C, 0x3A, 0x7B, 0x0C, 0x66, 0x29, 0x02, 0xDA, 0xCD, 0x08, 0x1E, 0x7B, 0x0C, 0x76,
+	0x59, 0x00, 0xCA, 0xCD, 0x08, 0xFE, 0x7B, 0x0C, 0x82, 0x7B, 0x0C, 0x76, 0xB2, 0x00, 0xEA, 0x7B,
+	0x0C, 0x76, 0x59, 0x00, 0xCA, 0x0B, 0x01, 0xFE, 0x7B, 0x0C, 0x82, 0x7B, 0x0C, 0x72, 0xB2, 0x00,
+	0xCE, 0x7F, 0x09, 0xA6, 0x7B, 0x0C, 0x66, 0x7B, 0x00, 0xFE, 0x7B, 0x0C, 0xFE, 0x7B, 0x0C, 0xFE,
+	0x7B, 0x0C, 0xEE, 0x7B, 0x0C, 0x1A, 0x7B, 0x0C, 0x66, 0x1D, 0x01, 0xDA, 0xAE, 0x03, 0x1E, 0x7B,
+	0x0C, 0x76, 0x59, 0x00, 0xCA, 0xA3, 0x02, 0xFE, 0x7B, 0x0C, 0x82, 0x7B, 0x0C, 0xFE, 0xB2, 0x00,
+	0x42, 0xB2, 0x00, 0x00, 0x82, 0x1A, 0x71, 0x25, 0x72, 0x59, 0x00, 0xCE, 0xFC, 0x02, 0xFE, 0x7B,
+	0x0C, 0x42, 0x7B, 0x0C, 0x30, 0x2F, 0xE4, 0x9C, 0x3E, 0x25, 0xA3, 0xED, 0x9C, 0x3E, 0x2D, 0xB3,
+	0xD1, 0xA2, 0x32, 0xBB, 0x2E, 0xFE, 0x7B, 0x0C, 0xFE, 0x7B, 0x0C, 0xFE, 0x7B, 0x0C, 0x42, 0x7B,
+	0x0C, 0x72, 0x8D, 0x01, 0xCE, 0x98, 0x02, 0xD6, 0x7B, 0x0C, 0xFE, 0x87, 0x00, 0x42, 0x87, 0x00,
+	0x56, 0x7B, 0x0C, 0x00, 0x82, 0x86, 0x7B, 0x0C, 0x1A, 0x41, 0x3B, 0xFE, 0x7B, 0x0C, 0xFE, 0x7B,
+	0x0C, 0xFE, 0x7B, 0x0C, 0xFE, 0x7B, 0x0C, 0xB6, 0x7B, 0x0C, 0x30, 0x8B, 0x61, 0x0D, 0x3F, 0x25,
+	0x29, 0xCB, 0x13, 0x3F, 0x2D, 0x4B, 0xB8, 0x1F, 0x32, 0xAC, 0x0F, 0x1A, 0x7B, 0x0C, 0x66, 0x21,
+	0x00, 0x1A, 0x7B, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x7B, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x7B, 0x0C,
+	0x66, 0x21, 0x00, 0x1A, 0x7B, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x7B, 0x0C, 0x66, 0x21, 0x00, 0x1A,
+	0x7B, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x7B, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x7B, 0x0C, 0x66, 0x21,
+	0x00, 0x1E, 0x7B, 0x0C, 0x66, 0x22, 0x00, 0x1E, 0x7B, 0x0C, 0x66, 0x22, 0x00, 0x12, 0x7B, 0x0C,
+	0x00, 0x1A, 0x5A, 0xE8, 0x7E, 0x00, 0x0B, 0xFE, 0xE8, 0x7E, 0xFE, 0xE8, 0x7E, 0xFE, 0xE8, 0x7E,
+	0xFE, 0xE8, 0x7E, 0xFE, 0xE8, 0x7E, 0xFE, 0xE8, 0x7E, 0xFE, 0xE8, 0x7E, 0xC2, 0xE8, 0x7E, 0x66,
+	0x29, 0x02, 0xDA, 0xCD, 0x08, 0x1E, 0x7B, 0x0C, 0x76, 0x59, 0x00, 0xCA, 0xCD, 0x08, 0xFE, 0x7B,
+	0x0C, 0x82, 0x7B, 0x0C, 0x76, 0xB2, 0x00, 0xEA, 0x7B, 0x0C, 0x76, 0x59, 0x00, 0xCA, 0x0B, 0x01,
+	0x00, 0xA2, 0x1A, 0x8F, 0x7E, 0x72, 0xF0, 0x38, 0x36, 0xB2, 0x00, 0x96, 0x1B, 0x66, 0x00, 0xAA,
+	0x0D, 0x59, 0x72, 0xB2, 0x00, 0xCE, 0x7F, 0x09, 0xA6, 0x7B, 0x0C, 0x66, 0x7B, 0x00, 0xFE, 0x7B,
+	0x0C, 0xFE, 0x7B, 0x0C, 0xFE, 0x7B, 0x0C, 0xEE, 0x7B, 0x0C, 0x1A, 0x7B, 0x0C, 0x66, 0x1D, 0x01,
+	0xDA, 0xAE, 0x03, 0x1E, 0x7B, 0x0C, 0x76, 0x59, 0x00, 0xCA, 0xA3, 0x02, 0xFE, 0x7B, 0x0C, 0x82,
+	0x7B, 0x0C, 0xFE, 0xB2, 0x00, 0x42, 0xB2, 0x00, 0x1E, 0x7B, 0x0C, 0x72, 0x59, 0x00, 0xCE, 0xFC,
+	0x02, 0x1E, 0x7B, 0x0C, 0xFE, 0x82, 0x8B, 0x22, 0x82, 0x8B, 0x30, 0xCA, 0xB3, 0x3A, 0x3F, 0x25,
+	0xA5, 0x2B, 0x43, 0x3F, 0x2D, 0x7E, 0xEB, 0x52, 0x32, 0x4A, 0x09, 0xFE, 0x7B, 0x0C, 0xFE, 0x7B,
+	0x0C, 0xEE, 0x7B, 0x0C, 0x00, 0x12, 0x4E, 0xEC, 0x31, 0x72, 0x8D, 0x01, 0xCE, 0x98, 0x02, 0xD6,
+	0x7B, 0x0C, 0xFE, 0x87, 0x00, 0x42, 0x87, 0x00, 0x56, 0x7B, 0x0C, 0x00, 0x83, 0x86, 0x7B, 0x0C,
+	0x1A, 0x40, 0x46, 0xFE, 0x7B, 0x0C, 0xFE, 0x7B, 0x0C, 0xFE, 0x7B, 0x0C, 0xFE, 0x7B, 0x0C, 0xB6,
+	0x7B, 0x0C, 0x30, 0xA6, 0xC2, 0x48, 0x3E, 0x25, 0x12, 0xCD, 0x48, 0x3E, 0x2D, 0x4A, 0xC1, 0x48,
+	0x32, 0xAC, 0x0F, 0x1A, 0x7B, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x7B, 0x0C, 0x66, 0x21, 0x00, 0x1A,
+	0x7B, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x7B, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x7B, 0x0C, 0x66, 0x21,
+	0x00, 0x1A, 0x7B, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x7B, 0x0C, 0x66, 0x21, 0x00, 0x1A, 0x7B, 0x0C,
+	0x66, 0x21, 0x00, 0x1A, 0x7B, 0x0C, 0x66, 0x21, 0x00, 0x1E, 0x7B, 0x0C, 0x66, 0x22, 0x00, 0x1E,
+	0x7B, 0x0C, 0x66, 0x22, 0x00, 0x12, 0x7B, 0x0C, 0xFE, 0x63, 0x8B, 0xFE, 0x63, 0x8B, 0xFE, 0x63,
+	0x8B, 0xFE, 0x63, 0x8B, 0xFE, 0x63, 0x8B, 0xFE, 0x63, 0x8B, 0xFE, 0x63, 0x8B, 0xFE, 0x63, 0x8B,
+	0x26, 0x63, 0x8B, 0x66, 0x29, 0x02, 0xDA, 0xCD, 0x08, 0x1E, 0x7B, 0x0C, 0x76, 0x59, 0x00, 0xCA,
+	0xCD, 0x08, 0xFE, 0x7B, 0x0C, 0x82, 0x7B, 0x0C, 0x76, 0xB2, 0x00, 0xEA, 0x7B, 0x0C, 0x76, 0x59,
+	0x00, 0xCA, 0x0B, 0x01, 0xFE, 0x7B, 0x0C, 0x82, 0x7B, 0x0C, 0x72, 0xB2, 0x00, 0xCE, 0x7F, 0x09,
+	0xA6, 0x7B, 0x0C, 0x66, 0x7B, 0x00, 0xFE, 0x7B, 0x0C, 0xFE, 0x7B, 0x0C, 0xFE, 0x7B, 0x0C, 0xEE,
+	0x7B, 0x0C, 0x1A, 0x7B, 0x0C, 0x66, 0x1D, 0x01, 0xDA, 0xAE, 0x03, 0x1E, 0x7B, 0x0C, 0x76, 0x59,
+	0x00, 0xCA, 0xA3, 0x02, 0xFE, 0x7B, 0x0C, 0x82, 0x7B, 0x0C, 0xFE, 0xB2, 0x00, 0x42, 0xB2, 0x00,
+	0x1E, 0x7B, 0x0C, 0x72, 0x59, 0x00, 0xCE, 0xFC, 0x02, 0x1E, 0x7B, 0x0C, 0xFE, 0x63, 0x8B, 0x22,
+	0x63, 0x8B, 0x30, 0x69, 0xC2, 0xCA, 0x3E, 0x25, 0xEF, 0xCC, 0xCA, 0x3E, 0x2D, 0x09, 0xC1, 0xCA,
+	0x32, 0x4A, 0x09, 0xFE, 0x7B, 0x0C, 0xFE, 0x7B, 0x0C, 0xFE, 0x7B, 0x0C, 0x42, 0x7B, 0x0C, 0x72,
+	0x8D, 0x01, 0xCE, 0x98, 0x02, 0xD6, 0x7B, 0x0C, 0xFE, 0x87, 0x00, 0x42, 0x87, 0x00, 0x56, 0x7B,
+	0x0C, 0x00, 0xFB, 0x12, 0x67, 0x3E, 0x4E, 0x44, 0x8B, 0x00, 0x35, 0xFE, 0x44, 0x8B, 0xFE, 0x44,
+	0x8B, 0xFE, 0x44, 0x8B, 0xFE, 0x44, 0x8B, 0xFE, 0x44, 0x8B, 0x8A, 0x44, 0x8B, 0x00, 0xFC, 0x92,
+	0x7E, 0x01, 0x26, 0xE8, 0x3F, 0xFE, 0xC2, 0x8C, 0x7E, 0xC2, 0x8C, 0x04, 0x16, 0x40, 0xFE, 0x44,
+	0x8B, 0xFE, 0x44, 0x8B, 0xFE, 0x44, 0x8B, 0xA6, 0x44, 0x8B, 0x0C, 0x10, 0x08, 0xB9, 0xDC, 0x0E,
+	0x9D, 0x7B, 0x00, 0xE8, 0x1A, 0x0F, 0x7B, 0x48, 0x4A, 0x0A, 0x22, 0x0A, 0x04, 0x4E, 0x6F, 0x6E,
+	0x65, 0x12, 0x14, 0x63, 0x6F, 0x6C, 0x75, 0x6D, 0x6E, 0x2D, 0x73, 0x0E, 0xEA, 0x7A, 0x04, 0x2D,
+	0x64, 0x16, 0xAE, 0x89, 0x1A, 0x92, 0x6A, 0x14, 0x09, 0x5A, 0x22, 0x08, 0x01, 0x10, 0x1E, 0x7A,
+	0xA0, 0x30, 0x28, 0x00, 0x3A, 0x04, 0x0A, 0x02, 0x08, 0x01, 0x4A, 0x00, 0x5A, 0x00, 0x60, 0x0E,
+	0x01, 0x7A, 0x05, 0x01, 0x10, 0x01, 0x11, 0x08, 0xF4, 0xD7, 0x0E, 0x39, 0x4E, 0x00, 0xE9, 0x0D,
+	0x5B, 0x3C, 0x9A, 0x01, 0x0A, 0x93, 0x01, 0x0A, 0x26, 0x12, 0x1E, 0x64, 0x72, 0x61, 0x77, 0x69,
+	0x6E, 0x67, 0x0E, 0xF0, 0x9A, 0x08, 0x2D, 0x30, 0x2D, 0x1D, 0x0E, 0x12, 0x55, 0x7B, 0x0D, 0x63,
+	0x14, 0x07, 0x5A, 0x67, 0x0A, 0x00, 0x12, 0x8A, 0xC7, 0x7C, 0xCE, 0xDF, 0x43, 0x12, 0x62, 0x7C,
+	0x3C, 0x22, 0x00, 0x2A, 0x00, 0x32, 0x00, 0x3A, 0x00, 0x50, 0x07, 0x5A, 0x00, 0x11, 0x08, 0x93,
+	0xE0, 0x01, 0xAC, 0x04, 0xC8, 0x17, 0x16, 0x16, 0x7C, 0x24, 0x84, 0x01, 0x0A, 0x1D, 0x12, 0x15,
+	0x65, 0x71, 0x75, 0x61, 0x0E, 0x0D, 0x8A, 0x18, 0x2D, 0x30, 0x2D, 0x69, 0x6D, 0x61, 0x67, 0x32,
+	0xA0, 0x00, 0x08, 0x04, 0x5A, 0x61, 0x8E, 0x78, 0x4F, 0x36, 0xBF, 0x0A, 0x96, 0x88, 0x16, 0x12,
+	0x53, 0x08, 0x18, 0x1A, 0x00, 0x22, 0x00, 0x11, 0x08, 0xE8, 0x25, 0x42, 0x11, 0x96, 0x14, 0xB6,
+	0x01, 0x0A, 0x1A, 0x12, 0x12, 0x05, 0x8B, 0x56, 0x93, 0x00, 0x04, 0x95, 0x01, 0xFE, 0x94, 0x00,
+	0x76, 0x94, 0x00, 0x86, 0x90, 0x99, 0x04, 0x80, 0x9D, 0x0E, 0xFE, 0x99, 0x00, 0xA0, 0x1A, 0x3B,
+	0x9F, 0x0C, 0x3F, 0x30, 0x00, 0x38, 0x05, 0xC8, 0x00, 0xE9, 0x32, 0xC8, 0x00, 0x00, 0xBB, 0x1D,
+	0xC8, 0x00, 0x31, 0x4E, 0x5B, 0x01, 0x00, 0x9A, 0xFE, 0xC8, 0x00, 0xFE, 0xC8, 0x00, 0x52, 0xC8,
+	0x00, 0x00, 0x05, 0x0E, 0x9A, 0x8C, 0x0C, 0x3F, 0x11, 0x08, 0xEA, 0x32, 0xCD, 0x00, 0x2E, 0x95,
+	0x01, 0x00, 0x32, 0x4E, 0xCD, 0x00, 0xFE, 0x95, 0x01, 0xEE, 0x95, 0x01, 0x29, 0x95, 0x16, 0x27,
+	0x8A, 0x1C, 0x20, 0x41, 0x20, 0x14, 0x2D, 0x33, 0x33, 0x33, 0x12, 0xB7, 0x9A, 0x41, 0x5D, 0x00,
+	0xEB, 0x62, 0xC8, 0x00, 0x00, 0x33, 0xE6, 0xC8, 0x00, 0xCE, 0x8F, 0x03, 0x49, 0xF1, 0xE2, 0x5D,
+	0x02, 0x00, 0xEC, 0x62, 0xC8, 0x00, 0x00, 0x34, 0x72, 0xC8, 0x00, 0x30, 0xF3, 0xAD, 0x73, 0x3F,
+	0x25, 0xF3, 0xE7, 0x77, 0x3F, 0x2D, 0xF3, 0x6A, 0x76, 0xFE, 0x4A, 0x16, 0x0E, 0x4A, 0x16, 0x9E,
+	0xC8, 0x00, 0x04, 0x00, 0x70, 0x0E, 0x7D, 0x89, 0x0C, 0x00, 0x40, 0x20, 0x04, 0x32, 0x90, 0x01,
+	0x00, 0xED, 0x32, 0xC8, 0x00, 0x00, 0xCC, 0x7D, 0x25, 0x00, 0x35, 0x4E, 0xC8, 0x00, 0x0C, 0xAB,
+	0x01, 0x0A, 0x6C, 0x86, 0xCB, 0xA2, 0xCE, 0x90, 0x01, 0x50, 0x42, 0x14, 0x12, 0x0D, 0x46, 0x6F,
+	0x72, 0x6D, 0x61, 0x6C, 0x20, 0x53, 0x68, 0x61, 0x64, 0x6F, 0x77, 0x1D, 0x9A, 0x99, 0x19, 0x0E,
+	0xE4, 0x0A, 0x04, 0x80, 0x3F, 0xDE, 0xA6, 0x01, 0x18, 0x16, 0x08, 0xDB, 0xD7, 0x69, 0x12, 0x10,
+	0xD5, 0x0D, 0x34, 0xE0, 0x01, 0x2A, 0x03, 0xB7, 0xD7, 0x69, 0x0A, 0xBB, 0x01, 0x0A, 0x19, 0x12,
+	0x11, 0xCD, 0x0B, 0x10, 0x73, 0x68, 0x61, 0x70, 0x65, 0xC5, 0x70, 0xCD, 0x05, 0x0C, 0x0A, 0x5A,
+	0x9B, 0x01, 0xFE, 0x06, 0x06, 0x7E, 0x06, 0x06, 0xD2, 0x77, 0x02, 0xCD, 0x3A, 0x10, 0x0A, 0x5A,
+	0x1E, 0x10, 0x00, 0x12, 0x95, 0x8C, 0x00, 0x80, 0x0E, 0xD4, 0xA1, 0x04, 0x80, 0x40, 0xC1, 0x59,
+	0x0E, 0x98, 0x84, 0x20, 0x80, 0x40, 0x52, 0x04, 0x08, 0xB7, 0xD7, 0x69, 0x36, 0x01, 0x05, 0x04,
+	0x12, 0x30, 0x22, 0x6E, 0x82, 0x00, 0xD9, 0x82, 0x76, 0x7F, 0x54, 0x2A, 0x03, 0x99, 0xD7, 0x69,
+	0x0A, 0x2B, 0x0A, 0x04, 0x42, 0x6F, 0x64, 0x79, 0x12, 0x1D, 0x74, 0x65, 0x78, 0x74, 0x2D, 0x32,
+	0x30, 0x26, 0x79, 0x82, 0x25, 0x1F, 0x00, 0x2D, 0x01, 0x1D, 0x00, 0x20, 0x1A, 0x12, 0x09, 0x00,
+	0x50, 0x2A, 0x7E, 0x82, 0x00, 0x30, 0xFE, 0x14, 0x78, 0xFE, 0x14, 0x78, 0xB6, 0x14, 0x78, 0x14,
+	0x70, 0x08, 0x04, 0x1A, 0x01, 0x2C, 0xFE, 0x7E, 0x82, 0x42, 0x7E, 0x82, 0x28, 0x01, 0xF8, 0x01,
+	0x01, 0xC2, 0x02, 0x04, 0x08, 0x99, 0xD7, 0x69, 0x3A, 0x82, 0x82, 0x08, 0x16, 0x08, 0xDC, 0x7E,
+	0x87, 0x02, 0x00, 0x31, 0x7A, 0x87, 0x02, 0x30, 0x26, 0x04, 0xDD, 0x3C, 0x25, 0xE6, 0x35, 0x2E,
+	0x3F, 0x2D, 0x11, 0xD8, 0x55, 0xFE, 0x36, 0x04, 0x81, 0x36, 0x41, 0x34, 0x00, 0x3F, 0xFE, 0x87,
+	0x02, 0x76, 0x87, 0x02, 0x08, 0x16, 0x08, 0xDD, 0x32, 0xF7, 0x00, 0x00, 0xEA, 0x6D, 0x7E, 0x00,
+	0xC5, 0x79, 0x7E, 0x00, 0x32, 0x4E, 0xF7, 0x00, 0x00, 0xA5, 0x61, 0x7E, 0x00, 0x60, 0x85, 0x65,
+	0x30, 0x63, 0x2E, 0x6E, 0x3F, 0x25, 0xE6, 0x1B, 0x09, 0x3E, 0x2D, 0xFA, 0x49, 0x53, 0x32, 0x3C,
+	0x31, 0x0E, 0x3E, 0x88, 0x08, 0x40, 0x18, 0x01, 0xBE, 0x97, 0xAA, 0x24, 0x3A, 0x08, 0x12, 0x06,
+	0x43, 0x68, 0x61, 0x6C, 0x6B, 0x32, 0xFE, 0x01, 0x01, 0x92, 0x01, 0x01, 0x00, 0xDE, 0x7E, 0x01,
+	0x01, 0x00, 0x33, 0x7A, 0x01, 0x01, 0x72, 0x6F, 0x20, 0xFE, 0x01, 0x01, 0xFE, 0x01, 0x01, 0x8A,
+	0x01, 0x01, 0x00, 0xDF, 0x32, 0x01, 0x01, 0x4A, 0x80, 0x05, 0x00, 0x34, 0x4E, 0x01, 0x01, 0xBD,
+	0x80, 0x30, 0x5E, 0xFC, 0xFF, 0x3E, 0x25, 0x40, 0xA4, 0x11, 0x3F, 0x2D, 0x9F, 0xBC, 0x11, 0xFE,
+	0xF9, 0x02, 0xFE, 0xF9, 0x02, 0xA2, 0xF9, 0x02, 0x00, 0xE0, 0x7E, 0xF7, 0x00, 0x00, 0x35, 0x7A,
+	0xF7, 0x00, 0xAA, 0xF8, 0x01, 0x0E, 0x01, 0x08, 0x20, 0x00, 0x00, 0x18, 0x02, 0x25, 0x6F, 0x12,
+	0x83, 0x3A, 0x0E, 0xF6, 0x84, 0xC1, 0x0B, 0x1A, 0x20, 0x8A, 0x01, 0x0F, 0x09, 0x05, 0xFE, 0xEF,
+	0x02, 0x8A, 0xEF, 0x02, 0x0C, 0x10, 0x08, 0xEE, 0xD7, 0x0E, 0xD6, 0x0D, 0x1E, 0x39, 0x0C, 0x00,
+	0x78, 0x0E, 0x38, 0x0C, 0x0C, 0x6D, 0x6F, 0x76, 0x69, 0x0E, 0x38, 0x0C, 0x05, 0x08, 0x2E, 0x6B,
+	0x0D, 0x08, 0x01, 0x5A, 0x58, 0xFE, 0x37, 0x0C, 0x5E, 0x37, 0x0C, 0x08, 0x10, 0x08, 0xEF, 0x5E,
+	0x89, 0x00, 0x00, 0x31, 0xFE, 0x89, 0x00, 0x0D, 0x89, 0x00, 0x01, 0x0E, 0x7C, 0x13, 0x1E, 0x8B,
+	0x0E, 0x39, 0x66, 0x3A, 0x0A, 0x00, 0x08, 0x11, 0x08, 0xF0, 0x32, 0x5E, 0x09, 0x00, 0xAF, 0x12,
+	0x5E, 0x09, 0x25, 0x0B, 0x04, 0x2D, 0x32, 0x46, 0x8A, 0x00, 0x08, 0x02, 0x5A, 0x8E, 0xFE, 0x83,
+	0x0C, 0x62, 0x83, 0x0C, 0x8A, 0x43, 0x09, 0x04, 0x00, 0x54, 0x0E, 0x21, 0x0A, 0x0C, 0x80, 0x40,
+	0x20, 0x06, 0x0E, 0xB9, 0x8B, 0x12, 0xB1, 0x0B, 0x08, 0x10, 0x08, 0xF1, 0x32, 0x4A, 0x01, 0x00,
+	0x7F, 0x39, 0xD3, 0x00, 0x33, 0x4E, 0xC0, 0x00, 0x00, 0x5F, 0xFE, 0xD3, 0x01, 0x5E, 0xD3, 0x01,
+	0x08, 0x22, 0x05, 0x0D, 0x0E, 0x61, 0x99, 0x08, 0x11, 0x08, 0xF2, 0x32, 0x51, 0x01, 0x00, 0x8A,
+	0x3D, 0x51, 0x00, 0x34, 0x46, 0x91, 0x00, 0x10, 0x01, 0x5A, 0x6A, 0x0A, 0x68, 0xC5, 0x49, 0x72,
+	0x50, 0x03, 0xD2, 0xAE, 0x0A, 0x18, 0x10, 0x12, 0x09, 0x48, 0x65, 0x61, 0x64, 0x0E, 0x45, 0x0A,
+	0x00, 0x73, 0x65, 0x5D, 0x08, 0x11, 0x08, 0xF3, 0x32, 0x9C, 0x00, 0x00, 0x8E, 0x1D, 0x9C, 0x00,
+	0x35, 0x4E, 0x9C, 0x00, 0x00, 0x6E, 0xFE, 0x4A, 0x0B, 0xA6, 0x4A, 0x0B, 0x1C, 0xF6, 0x28, 0x1C,
+	0x3F, 0x36, 0x08, 0xA2, 0xD7, 0x2E, 0x16, 0x0A, 0x00, 0xDB, 0x9A, 0x16, 0x0A, 0x00, 0x28, 0x26,
+	0x36, 0x9B, 0x00, 0x17, 0x22, 0x8A, 0x8C, 0x52, 0xA1, 0x11, 0x2A, 0x13, 0x0A, 0x56, 0x71, 0x61,
+	0x66, 0x86, 0x01, 0xFE, 0x71, 0x61, 0x82, 0x71, 0x61, 0x66, 0x7B, 0x00, 0x0E, 0x69, 0x64, 0x00,
+	0x75, 0x72, 0x13, 0x0A, 0x18, 0x05, 0x15, 0x9A, 0x99, 0x99, 0x3F, 0x70, 0x9A, 0x96, 0x8C, 0x00,
+	0x41, 0x4A, 0x96, 0x8C, 0x2E, 0x18, 0x0A, 0x00, 0x01, 0x22, 0x9A, 0x8C, 0x08, 0x16, 0x08, 0xE1,
+	0x32, 0x28, 0x06, 0x20, 0xD8, 0x01, 0x2A, 0x03, 0xC3, 0xD7, 0x69, 0x0A, 0xA7, 0x45, 0x3A, 0x12,
+	0x98, 0x0C, 0x04, 0x2D, 0x30, 0x46, 0x29, 0x06, 0x10, 0x0E, 0x5A, 0x86, 0x01, 0x0A, 0x16, 0x67,
+	0x8D, 0x66, 0xD6, 0x00, 0x00, 0x12, 0x8A, 0xC5, 0x12, 0xCE, 0x27, 0x12, 0x45, 0xEB, 0x22, 0xC5,
+	0x12, 0x1C, 0x0E, 0x5A, 0x2A, 0x08, 0x00, 0x10, 0x01, 0x22, 0x12, 0x8A, 0x13, 0x56, 0x93, 0x0C,
+	0x28, 0x38, 0x00, 0x52, 0x04, 0x08, 0xC3, 0xD7, 0x69, 0x58, 0x00, 0x36, 0x01, 0x07, 0x2A, 0x97,
+	0x0C, 0x00, 0xE0, 0x9A, 0x81, 0x02, 0x24, 0x2B, 0x0A, 0x05, 0x4C, 0x61, 0x62, 0x65, 0x6C, 0x12,
+	0x1C, 0x12, 0x98, 0x0C, 0x04, 0x33, 0x32, 0x3E, 0x98, 0x0C, 0x05, 0x1E, 0x1A, 0xBD, 0x0D, 0x08,
+	0x39, 0x5A, 0xBC, 0x2A, 0x15, 0x8F, 0x00, 0x14, 0x32, 0x15, 0x8F, 0x00, 0x2D, 0x16, 0xFA, 0x92,
+	0x12, 0x1C, 0x8F, 0xFE, 0xFC, 0x63, 0xFE, 0xFC, 0x63, 0x62, 0xFC, 0x63, 0x00, 0x70, 0x0E, 0x1C,
+	0x8F, 0x0E, 0x9E, 0x0C, 0x00, 0x38, 0x2A, 0x1C, 0x8F, 0x00, 0x01, 0xFE, 0x1C, 0x8F, 0x12, 0x1C,
+	0x8F, 0x5E, 0x86, 0x02, 0x00, 0xE2, 0x42, 0x86, 0x02, 0x00, 0xC4, 0x3A, 0x86, 0x02, 0x4A, 0x9F,
+	0x0C, 0x3E, 0x86, 0x02, 0x08, 0x77, 0x1A, 0x22, 0x0E, 0x2F, 0x9B, 0x36, 0x05, 0xA6, 0xFE, 0x86,
+	0x02, 0xFE, 0x86, 0x02, 0x36, 0x86, 0x02, 0x00, 0xC4, 0x49, 0x86, 0x00, 0xC4, 0x32, 0x07, 0x05,
+	0x00, 0xEA, 0x9A, 0x86, 0x02, 0x08, 0x35, 0x0A, 0x0A, 0x45, 0x68, 0x18, 0x20, 0x44, 0x61, 0x72,
+	0x6B, 0x12, 0x21, 0x49, 0x8B, 0x00, 0x33, 0x52, 0x8B, 0x02, 0x05, 0x23, 0xBA, 0x90, 0x02, 0x66,
+	0xCA, 0x03, 0xFE, 0x1B, 0x05, 0xFA, 0x1B, 0x05, 0xFE, 0x90, 0x02, 0xCA, 0x90, 0x02, 0x00, 0xE3,
+	0x82, 0x90, 0x02, 0x4A, 0x38, 0x0E, 0x5D, 0x90, 0x30, 0x80, 0x30, 0xC1, 0x3E, 0x25, 0x89, 0x87,
+	0x59, 0x3F, 0x2D, 0x7E, 0x9C, 0x5B, 0x32, 0x32, 0x1D, 0xFE, 0x90, 0x02, 0xFE, 0x90, 0x02, 0x4A,
+	0x90, 0x02, 0x08, 0x16, 0x08, 0xE4, 0x42, 0xEF, 0x00, 0x3E, 0x05, 0x06, 0x4A, 0x26, 0x0E, 0x1D,
+	0xEF, 0x66, 0x25, 0x0F, 0xFE, 0xEF, 0x00, 0xFE, 0xEF, 0x00, 0x36, 0xEF, 0x00, 0xC5, 0x05, 0x08,
+	0x16, 0x08, 0xE5, 0x42, 0xEF, 0x00, 0x3E, 0x6E, 0x04, 0x4A, 0x14, 0x0E, 0x1D, 0xEF, 0x1C, 0xE9,
+	0xB6, 0x7E, 0x3F, 0x25, 0x77, 0x3C, 0x2E, 0x81, 0x6E, 0x36, 0x5F, 0x96, 0xFE, 0xEF, 0x00, 0xFE,
+	0xEF, 0x00, 0x36, 0xEF, 0x00, 0x85, 0x6E, 0x08, 0x16, 0x08, 0xE6, 0x42, 0xEF, 0x00, 0x3E, 0xDE,
+	0x01, 0x4A, 0x0C, 0x0E, 0x1D, 0xEF, 0x30, 0x79, 0xC9, 0x7F, 0x3F, 0x25, 0x9F, 0x72, 0x85, 0x3E,
+	0x2D, 0xF6, 0xDE, 0x21, 0x32, 0x01, 0x0F, 0xFE, 0xEF, 0x00, 0xFE, 0xEF, 0x00, 0x36, 0xEF, 0x00,
+	0x25, 0xDE, 0x08, 0x36, 0x08, 0xF5, 0x32, 0x5D, 0x05, 0x00, 0xD7, 0x9A, 0x5D, 0x05, 0x40, 0x29,
+	0x12, 0x21, 0x73, 0x74, 0x69, 0x63, 0x6B, 0x79, 0x43, 0x6F, 0x6D, 0x6D, 0x65, 0x6E, 0x74, 0x2D,
+	0x42, 0x7C, 0x14, 0x4E, 0x03, 0x91, 0xFE, 0x65, 0x0A, 0xFE, 0x65, 0x0A, 0xBA, 0x65, 0x0A, 0x12,
+	0x78, 0x14, 0xFE, 0xF6, 0x96, 0x56, 0xF6, 0x96, 0x2E, 0xDA, 0x07, 0x26, 0xFA, 0x96, 0x0C, 0x36,
+	0x08, 0x96, 0xE0, 0x2E, 0x71, 0x09, 0xFE, 0x8E, 0x01, 0x3D, 0x8E, 0x1A, 0x0A, 0x46, 0x2E, 0xF3,
+	0x0B, 0x00, 0x50, 0xFE, 0x06, 0x16, 0xFE, 0x06, 0x16, 0xFE, 0x06, 0x16, 0xFE, 0x06, 0x16, 0x12,
+	0x06, 0x16, 0x0E, 0xB7, 0xAB, 0x5E, 0x8E, 0x01, 0x00, 0x97, 0xFE, 0x8E, 0x01, 0x5E, 0x8E, 0x01,
+	0x1A, 0x1D, 0x3B, 0x2E, 0x8E, 0x01, 0x00, 0x60, 0xFE, 0x8E, 0x01, 0xFE, 0x8E, 0x01, 0xFE, 0x8E,
+	0x01, 0xFE, 0x8E, 0x01, 0x82, 0x8E, 0x01, 0x00, 0x98, 0xFE, 0x8E, 0x01, 0x5E, 0x8E, 0x01, 0x1A,
+	0x30, 0x30, 0x2E, 0x8E, 0x01, 0x00, 0x70, 0xFE, 0x8E, 0x01, 0xFE, 0x8E, 0x01, 0xFE, 0x8E, 0x01,
+	0xFE, 0x8E, 0x01, 0x82, 0x8E, 0x01, 0x00, 0x99, 0xFE, 0x8E, 0x01, 0x5E, 0x8E, 0x01, 0x4A, 0x82,
+	0x76, 0x00, 0x80, 0xFE, 0x8E, 0x01, 0xFE, 0x8E, 0x01, 0xFE, 0x8E, 0x01, 0xFE, 0x8E, 0x01, 0x82,
+	0x8E, 0x01, 0x00, 0x9A, 0xFE, 0x8E, 0x01, 0x5E, 0x8E, 0x01, 0x4A, 0x18, 0x75, 0x00, 0x90, 0xFE,
+	0x8E, 0x01, 0xFE, 0x8E, 0x01, 0xFE, 0x8E, 0x01, 0xFE, 0x8E, 0x01, 0x82, 0x8E, 0x01, 0x00, 0x9B,
+	0xFE, 0x8E, 0x01, 0x5A, 0x8E, 0x01, 0x4E, 0xF9, 0x89, 0x00, 0xB0, 0xFE, 0x8E, 0x01, 0xFE, 0x8E,
+	0x01, 0xFE, 0x8E, 0x01, 0xFE, 0x8E, 0x01, 0x82, 0x8E, 0x01, 0x00, 0x9C, 0xFE, 0x8E, 0x01, 0x5E,
+	0x8E, 0x01, 0x4A, 0xC6, 0x07, 0x00, 0xC0, 0xFE, 0x8E, 0x01, 0xFE, 0x8E, 0x01, 0xFE, 0x8E, 0x01,
+	0xFE, 0x8E, 0x01, 0x82, 0x8E, 0x01, 0x00, 0x9D, 0xFE, 0x8E, 0x01, 0x5E, 0x8E, 0x01, 0x4A, 0xAA,
+	0x04, 0x00, 0xE0, 0xFE, 0x8E, 0x01, 0xFE, 0x8E, 0x01, 0xFE, 0x8E, 0x01, 0xFE, 0x8E, 0x01, 0x7A,
+	0x8E, 0x01, 0x08, 0x16, 0x08, 0xF6, 0x32, 0xED, 0x0E, 0x34, 0x80, 0x02, 0x2A, 0x03, 0xF5, 0xD7,
+	0x69, 0x0A, 0xE3, 0x01, 0x0A, 0x22, 0x12, 0x1A, 0x3E, 0xE1, 0x0D, 0x12, 0xE0, 0x16, 0x2E, 0x12,
+	0x1C, 0x08, 0x0E, 0x5A, 0xBA, 0x26, 0xD8, 0x16, 0x12, 0x3C, 0xB3, 0x00, 0x80, 0x0E, 0xE4, 0x0F,
+	0x8E, 0x52, 0x14, 0x0E, 0x37, 0xC5, 0x26, 0xB0, 0xCA, 0x36, 0xD8, 0x16, 0x96, 0xAB, 0x1B, 0x16,
+	0xD8, 0x16, 0x86, 0x97, 0x23, 0x16, 0xD6, 0x26, 0x04, 0x00, 0x40, 0x12, 0xC4, 0xC1, 0x00, 0x80,
+	0x12, 0xA6, 0xC7, 0x1A, 0x97, 0x23, 0x08, 0x0E, 0x5A, 0x16, 0x0E, 0x8E, 0xA5, 0x1A, 0x0C, 0x17,
+	0x00, 0x00, 0x12, 0xF8, 0x16, 0x00, 0xF5, 0x0E, 0x72, 0x14, 0x18, 0x15, 0x08, 0x95, 0xE0, 0x69,
+	0x12, 0x0F, 0x22, 0x86, 0x24, 0x00, 0x5E, 0x16, 0xE6, 0x17, 0x00, 0x2E, 0x0E, 0x38, 0xB6, 0x1C,
+	0x73, 0x76, 0x67, 0x69, 0x6D, 0x70, 0x6F, 0x72, 0x0E, 0xF2, 0x0E, 0x25, 0x11, 0x12, 0x6A, 0x23,
+	0x1A, 0x3C, 0x14, 0x10, 0x0C, 0x5A, 0x0A, 0x0A, 0x00, 0x22, 0x6C, 0x17, 0x00, 0x0C, 0xAE, 0x6C,
+	0x17, 0x0C, 0x11, 0x08, 0x87, 0xD9, 0x0E, 0x5B, 0x2A, 0x04, 0xF3, 0x2E, 0x16, 0x5B, 0x2A, 0x04,
+	0x98, 0x41, 0x0E, 0xBA, 0x1B, 0x0C, 0x74, 0x61, 0x62, 0x6C, 0x0E, 0x53, 0x18, 0x05, 0x08, 0x2E,
+	0x7B, 0x01, 0x18, 0x3F, 0x5A, 0xF7, 0x40, 0x08, 0x01, 0x12, 0x16, 0x55, 0x18, 0x10, 0xF6, 0xF5,
+	0x75, 0x3F, 0x25, 0x01, 0x05, 0x00, 0x2D, 0x01, 0x05, 0x2E, 0xB1, 0x52, 0x00, 0xA8, 0x12, 0x20,
+	0xA6, 0x20, 0x82, 0x02, 0xC5, 0x1F, 0x08, 0x0F, 0x1A, 0x8A, 0x02, 0x86, 0xED, 0x1B, 0x0C, 0x33,
+	0x33, 0xB3, 0x3E, 0xC6, 0x63, 0x74, 0x86, 0xD9, 0x10, 0xD6, 0x58, 0x00, 0x00, 0x1A, 0x82, 0x14,
+	0x19, 0xD6, 0x58, 0x00, 0x04, 0x20, 0x3F, 0xFE, 0x0D, 0x01, 0xFE, 0x0D, 0x01, 0xFE, 0x0D, 0x01,
+	0xFE, 0x0D, 0x01, 0x2E, 0x0D, 0x01, 0x00, 0x1F, 0xFE, 0x0D, 0x01, 0xFE, 0x0D, 0x01, 0xFE, 0x0D,
+	0x01, 0xFE, 0x0D, 0x01, 0x2E, 0x0D, 0x01, 0x00, 0x2F, 0xFE, 0x0D, 0x01, 0xFE, 0x0D, 0x01, 0xFE,
+	0x0D, 0x01, 0xFE, 0x0D, 0x01, 0x2E, 0x0D, 0x01, 0xFE, 0x34, 0x04, 0xFE, 0x34, 0x04, 0xFE, 0x34,
+	0x04, 0xFE, 0x34, 0x04, 0x32, 0x34, 0x04, 0x00, 0x01, 0xFE, 0x1A, 0x02, 0xFE, 0x1A, 0x02, 0xFE,
+	0x1A, 0x02, 0xFE, 0x1A, 0x02, 0x2E, 0x1A, 0x02, 0x00, 0x10, 0xFE, 0x0D, 0x01, 0xFE, 0x0D, 0x01,
+	0xFE, 0x0D, 0x01, 0xFE, 0x0D, 0x01, 0x2E, 0x0D, 0x01, 0x00, 0x02, 0xFE, 0x0D, 0x01, 0xFE, 0x0D,
+	0x01, 0xFE, 0x0D, 0x01, 0xFE, 0x0D, 0x01, 0x2E, 0x0D, 0x01, 0x00, 0x04, 0xFE, 0x0D, 0x01, 0xFE,
+	0x0D, 0x01, 0xFE, 0x0D, 0x01, 0xFE, 0x0D, 0x01, 0x2E, 0x0D, 0x01, 0x00, 0x20, 0xFE, 0x0D, 0x01,
+	0xFE, 0x0D, 0x01, 0xFE, 0x0D, 0x01, 0xFE, 0x0D, 0x01, 0x2E, 0x0D, 0x01, 0x00, 0x08, 0xFE, 0x0D,
+	0x01, 0xFE, 0x0D, 0x01, 0xFE, 0x0D, 0x01, 0xFE, 0x0D, 0x01, 0x2E, 0x0D, 0x01, 0x00, 0x13, 0xFE,
+	0x0D, 0x01, 0xFE, 0x0D, 0x01, 0xFE, 0x0D, 0x01, 0xFE, 0x0D, 0x01, 0x2E, 0x0D, 0x01, 0x00, 0x2C,
+	0xFE, 0x0D, 0x01, 0xFE, 0x0D, 0x01, 0xFE, 0x0D, 0x01, 0xFE, 0x0D, 0x01, 0x2E, 0x0D, 0x01, 0x00,
+	0x03, 0xFE, 0x0D, 0x01, 0xFE, 0x0D, 0x01, 0xFE, 0x0D, 0x01, 0xFE, 0x0D, 0x01, 0x2E, 0x0D, 0x01,
+	0x00, 0x0C, 0xFE, 0x0D, 0x01, 0xFE, 0x0D, 0x01, 0xFE, 0x0D, 0x01, 0xFE, 0x0D, 0x01, 0x2E, 0x0D,
+	0x01, 0x10, 0x30, 0x88, 0x02, 0x01, 0x90, 0x0E, 0xCE, 0xB5, 0x0E, 0xC5, 0xB5, 0x00, 0xA8, 0x12,
+	0xC8, 0xB5, 0x04, 0xCA, 0x02, 0x36, 0x47, 0xB6, 0x00, 0xD0, 0x0E, 0x4B, 0xB5, 0x1C, 0x01, 0xE0,
+	0x02, 0x01, 0xE8, 0x02, 0x00, 0xF2, 0x1A, 0xA7, 0xD1, 0x66, 0xAA, 0x24, 0x0E, 0x94, 0x31, 0xCA,
+	0x39, 0x45, 0x00, 0xFA, 0x86, 0x59, 0x00, 0xD6, 0x98, 0x0F, 0x1E, 0x9D, 0x46, 0x6A, 0xB2, 0x00,
+	0xD6, 0x59, 0x00, 0x1E, 0x9D, 0x46, 0xFE, 0x59, 0x00, 0x42, 0x59, 0x00, 0x1E, 0x00, 0xD2, 0xFE,
+	0x59, 0x00, 0x42, 0x59, 0x00, 0x1E, 0x04, 0x85, 0x6A, 0x59, 0x00, 0x0E, 0x34, 0xC6, 0xC6, 0xAC,
+	0x11, 0x8A, 0x9D, 0x46, 0xD6, 0x64, 0x01, 0x00, 0xAA, 0x1A, 0x18, 0x53, 0x6A, 0xB2, 0x00, 0xD6,
+	0x59, 0x00, 0x00, 0xB2, 0x86, 0x59, 0x00, 0xD6, 0x0B, 0x01, 0x00, 0xBA, 0x86, 0x59, 0x00, 0xD6,
+	0xB2, 0x00, 0x00, 0xC2, 0xFE, 0x59, 0x00, 0x5E, 0x59, 0x00, 0x00, 0xCA, 0xFE, 0x59, 0x00, 0x5E,
+	0x59, 0x00, 0x00, 0xD2, 0xFE, 0x59, 0x00, 0x5E, 0x59, 0x00, 0x00, 0xDA, 0xFE, 0x59, 0x00, 0x5E,
+	0x59, 0x00, 0x00, 0xE2, 0xFE, 0x59, 0x00, 0x5E, 0x59, 0x00, 0x00, 0xEA, 0xFE, 0x59, 0x00, 0x5E,
+	0x59, 0x00, 0x00, 0xF2, 0x86, 0x59, 0x00, 0x00, 0x00, 0xD2, 0xDB, 0x30, 0x00, 0xFA, 0xFE, 0x59,
+	0x00, 0x5E, 0x59, 0x00, 0x04, 0x82, 0x04, 0x82, 0x81, 0x15, 0xD6, 0xB2, 0x00, 0x00, 0x8A, 0xFE,
+	0x59, 0x00, 0x5E, 0x59, 0x00, 0x00, 0x92, 0xFE, 0x59, 0x00, 0x5E, 0x59, 0x00, 0x00, 0x9A, 0x8E,
+	0x59, 0x00, 0xCE, 0x4D, 0x07, 0x00, 0xA2, 0xFE, 0x59, 0x00, 0x5E, 0x59, 0x00, 0x00, 0xAA, 0xFE,
+	0x59, 0x00, 0x5E, 0x59, 0x00, 0x00, 0xB2, 0xFE, 0x59, 0x00, 0x5E, 0x59, 0x00, 0x00, 0xBA, 0xFE,
+	0x59, 0x00, 0x5E, 0x59, 0x00, 0x00, 0xC2, 0x86, 0x59, 0x00, 0xD6, 0xE9, 0x05, 0x00, 0xCA, 0xFE,
+	0x59, 0x00, 0x5E, 0x59, 0x00, 0x00, 0xD2, 0xFE, 0x59, 0x00, 0x5E, 0x59, 0x00, 0x1E, 0x01, 0xE5,
+	0xFE, 0xA6, 0x07, 0x42, 0xA6, 0x07, 0x1E, 0x01, 0xE5, 0xFE, 0x59, 0x00, 0x42, 0x59, 0x00, 0x1E,
+	0x04, 0x4D, 0x6A, 0x59, 0x00, 0x01, 0x1B, 0x2E, 0x0A, 0x09, 0x96, 0x41, 0x45, 0x1E, 0x04, 0x4D,
+	0x01, 0x3E, 0x00, 0x25, 0x01, 0x05, 0x0E, 0x46, 0x37, 0x00, 0x00, 0x2E, 0x3F, 0x1B, 0xDA, 0x59,
+	0x00, 0x1E, 0x01, 0xE5, 0x01, 0x54, 0xFE, 0x59, 0x00, 0x32, 0x59, 0x00, 0x1E, 0x04, 0x4D, 0xFE,
+	0x59, 0x00, 0x42, 0x59, 0x00, 0x00, 0x8A, 0x1A, 0x53, 0x66, 0xFE, 0x59, 0x00, 0x42, 0x59, 0x00,
+	0x00, 0x92, 0x8E, 0x59, 0x00, 0xCE, 0xFF, 0x1D, 0x00, 0x9A, 0xFE, 0x59, 0x00, 0x5E, 0x59, 0x00,
+	0x00, 0xA2, 0x8E, 0x59, 0x00, 0x0E, 0x4A, 0x3A, 0x26, 0xCA, 0x3E, 0x96, 0x6F, 0x02, 0x00, 0xAA,
+	0x8E, 0x59, 0x00, 0xCE, 0x0B, 0x01, 0x1E, 0x75, 0xE6, 0x72, 0xBD, 0x01, 0xCE, 0x59, 0x00, 0x00,
+	0xBA, 0x8E, 0xB2, 0x00, 0xCE, 0x0B, 0x01, 0x00, 0xC2, 0x8E, 0x59, 0x00, 0xCE, 0xB2, 0x00, 0x00,
+	0xCA, 0xFE, 0x59, 0x00, 0x5E, 0x59, 0x00, 0x00, 0xD2, 0x8E, 0x59, 0x00, 0xCE, 0x0B, 0x01, 0x00,
+	0xDA, 0x92, 0x59, 0x00, 0xCA, 0xE2, 0x51, 0x00, 0xE2, 0x8E, 0x59, 0x00, 0xCE, 0x64, 0x01, 0x08,
+	0x11, 0x08, 0xA0, 0x62, 0xAA, 0x20, 0x00, 0x31, 0x7A, 0xAA, 0x20, 0x10, 0xF8, 0xF7, 0x77, 0x3F,
+	0x25, 0x01, 0x05, 0x08, 0x2D, 0xF7, 0xF6, 0x36, 0x4C, 0x47, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20,
+	0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE,
+	0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA,
+	0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20,
+	0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE,
+	0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA,
+	0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20,
+	0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE,
+	0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA,
+	0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20,
+	0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE,
+	0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA,
+	0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0x12, 0xAA, 0x20, 0x30, 0x8A, 0x89,
+	0x09, 0x3F, 0x25, 0x85, 0x84, 0x04, 0x3F, 0x2D, 0xFF, 0xFE, 0xFE, 0x32, 0x08, 0x44, 0x12, 0x34,
+	0x57, 0x2E, 0xE3, 0x15, 0x96, 0x25, 0x32, 0x1E, 0xAA, 0x20, 0x00, 0x93, 0x0E, 0x5C, 0xF3, 0x01,
+	0x05, 0x00, 0x2D, 0x01, 0x05, 0x3E, 0xE3, 0x15, 0xCA, 0x59, 0x00, 0x26, 0xAA, 0x20, 0x5E, 0xF8,
+	0x32, 0x0E, 0x3C, 0x16, 0xCA, 0x59, 0x00, 0x26, 0xAA, 0x20, 0xFE, 0x59, 0x00, 0x3A, 0x59, 0x00,
+	0x1E, 0xAA, 0x20, 0x21, 0x01, 0xFE, 0x0B, 0x01, 0x32, 0x0B, 0x01, 0x1E, 0xAA, 0x20, 0xFE, 0xBD,
+	0x01, 0x42, 0xBD, 0x01, 0x1E, 0xAA, 0x20, 0xFE, 0xB2, 0x00, 0x42, 0xB2, 0x00, 0x00, 0xAA, 0x1A,
+	0x30, 0x1D, 0xFE, 0x59, 0x00, 0x42, 0x59, 0x00, 0x00, 0xB2, 0x0D, 0x59, 0xDA, 0x0B, 0x01, 0x00,
+	0xC6, 0x18, 0x00, 0x80, 0x80, 0x04, 0x10, 0x00, 0x25, 0x00, 0x00, 0x00, 0x52, 0x05, 0x00, 0x30,
+	0xBA, 0x03, 0x56, 0x0A, 0x1D, 0x08, 0x01, 0x1D, 0x93, 0x92, 0x12, 0x3F, 0x25, 0x01, 0x05, 0x00,
+	0x2D, 0x01, 0x05, 0x1C, 0x35, 0x00, 0x00, 0x80, 0x3F, 0x60, 0x01, 0x6D, 0x01, 0x07, 0x44, 0x15,
+	0x00, 0x00, 0x00, 0x3F, 0x18, 0x00, 0x20, 0x00, 0x2D, 0x00, 0x00, 0x80, 0x40, 0x32, 0x27, 0x08,
+	0x01, 0x01, 0x12, 0x04, 0x00, 0x18, 0x52, 0x4F, 0x00, 0x19, 0x68, 0x00, 0xC2, 0xFE, 0x59, 0x00,
+	0x5E, 0x59, 0x00, 0x00, 0xCA, 0xFE, 0x59, 0x00, 0x5E, 0x59, 0x00, 0x00, 0xD2, 0xFE, 0x59, 0x00,
+	0x5E, 0x59, 0x00, 0x00, 0xDA, 0xFE, 0x59, 0x00, 0x5E, 0x59, 0x00, 0x00, 0xE2, 0xFE, 0x59, 0x00,
+	0x5E, 0x59, 0x00, 0x00, 0xEA, 0xFE, 0x59, 0x00, 0x5E, 0x59, 0x00, 0x00, 0xF2, 0x0D, 0x59, 0x34,
+	0x8A, 0x89, 0x09, 0x3F, 0x25, 0x85, 0x84, 0x04, 0x3F, 0x2D, 0xFF, 0xFE, 0xFE, 0x3E, 0x3E, 0x6F,
+	0x02, 0x00, 0x40, 0xC6, 0x6F, 0x02, 0x00, 0xFA, 0xFE, 0x59, 0x00, 0x5E, 0x59, 0x00, 0x04, 0x82,
+	0x04, 0x69, 0x21, 0xFE, 0xB2, 0x00, 0x42, 0xB2, 0x00, 0x00, 0x8A, 0xFE, 0x59, 0x00, 0x5E, 0x59,
+	0x00, 0x00, 0x92, 0xFE, 0x59, 0x00, 0x5E, 0x59, 0x00, 0x00, 0x9A, 0x8E, 0x59, 0x00, 0x00, 0x40,
+	0xCA, 0x2C, 0x04, 0x00, 0xA2, 0xFE, 0x59, 0x00, 0x5E, 0x59, 0x00, 0x00, 0xAA, 0xFE, 0x59, 0x00,
+	0x5E, 0x59, 0x00, 0x00, 0xB2, 0xFE, 0x59, 0x00, 0x5E, 0x59, 0x00, 0x00, 0xBA, 0xFE, 0x59, 0x00,
+	0x5E, 0x59, 0x00, 0x00, 0xC2, 0x0D, 0x59, 0xA1, 0xDF, 0xFE, 0xE9, 0x05, 0x32, 0xE9, 0x05, 0x00,
+	0xCA, 0xFE, 0x59, 0x00, 0x5E, 0x59, 0x00, 0x00, 0xD2, 0xFE, 0x59, 0x00, 0x5E, 0x59, 0x00, 0x00,
+	0xDA, 0xFE, 0x59, 0x00, 0x5E, 0x59, 0x00, 0x00, 0xE2, 0xFE, 0x59, 0x00, 0x5E, 0x59, 0x00, 0x00,
+	0xEA, 0x0D, 0x59, 0xF5, 0xC6, 0x00, 0x2D, 0x01, 0x0A, 0x3E, 0x37, 0x05, 0x00, 0x00, 0x2E, 0x37,
+	0x05, 0x00, 0x02, 0x92, 0xA6, 0x07, 0x00, 0xF2, 0xFE, 0x59, 0x00, 0x5E, 0x59, 0x00, 0x00, 0xFA,
+	0xFE, 0x59, 0x00, 0x5E, 0x59, 0x00, 0x04, 0x82, 0x05, 0xA9, 0x90, 0x21, 0x01, 0x12, 0x6E, 0x08,
+	0xFE, 0x0B, 0x01, 0x31, 0x0B, 0x00, 0x8A, 0xFE, 0x59, 0x00, 0x5E, 0x59, 0x00, 0x00, 0x92, 0x0D,
+	0x59, 0x72, 0x7A, 0x03, 0x00, 0x80, 0xCA, 0x37, 0x05, 0x00, 0x9A, 0xFE, 0x59, 0x00, 0x5E, 0x59,
+	0x00, 0x00, 0xA2, 0x0D, 0x59, 0xFE, 0x64, 0x01, 0x42, 0x64, 0x01, 0x00, 0xAA, 0x0D, 0x59, 0xFE,
+	0x0B, 0x01, 0x42, 0x0B, 0x01, 0x00, 0xB2, 0xFE, 0x59, 0x00, 0x5E, 0x59, 0x00, 0x00, 0xBA, 0x0D,
+	0x59, 0xFE, 0x0B, 0x01, 0x42, 0x0B, 0x01, 0x00, 0xC2, 0x0D, 0x59, 0x72, 0x58, 0x08, 0xCE, 0x16,
+	0x02, 0x00, 0xCA, 0x0D, 0x59, 0x0E, 0xBC, 0x0B, 0x00, 0x25, 0x01, 0x05, 0x0E, 0xB8, 0x0B, 0x3E,
+	0xD2, 0x0B, 0xCE, 0x59, 0x00, 0x00, 0xD2, 0x15, 0x59, 0x1A, 0x4B, 0x0C, 0xFE, 0x7A, 0x03, 0x71,
+	0x7A, 0x00, 0xDA, 0x15, 0x59, 0x00, 0x80, 0x66, 0xB2, 0x00, 0xCE, 0x15, 0x0A, 0x00, 0xE2, 0x0D,
+	0x59, 0xFE, 0x6F, 0x02, 0x42, 0x6F, 0x02, 0x74, 0x11, 0x08, 0xB9, 0xD9, 0x69, 0x12, 0x0B, 0x08,
+	0xF3, 0x2E, 0x12, 0x03, 0x01, 0x00, 0x05, 0x18, 0x98, 0x41, 0x0A, 0x1A, 0x12, 0x12, 0x74, 0x61,
+	0x62, 0x6C, 0x65, 0x2D, 0x32, 0x2D, 0x05, 0x08, 0x4C, 0x53, 0x74, 0x79, 0x6C, 0x65, 0x2A, 0x04,
+	0x08, 0x85, 0xE0, 0x69, 0x50, 0x3F, 0x5A, 0xF7, 0x40, 0x08, 0x01, 0x12, 0x1F, 0x12, 0x6A, 0x0D,
+	0x10, 0xF8, 0xF7, 0x77, 0x3F, 0x25, 0x01, 0x05, 0x0C, 0x2D, 0xF7, 0xF6, 0x76, 0x32, 0x98, 0x01,
+	0x3C, 0xA8, 0x01, 0x01, 0xB0, 0x01, 0x01, 0x82, 0x02, 0xC5, 0x1F, 0x08, 0x0F, 0x1A, 0x8A, 0x02,
+	0x0A, 0x82, 0xE9, 0x04, 0x0C, 0x33, 0x33, 0xB3, 0x3E, 0x2E, 0xF4, 0x05, 0x96, 0x9A, 0x0D, 0x00,
+	0x12, 0xFE, 0x58, 0x00, 0x5A, 0x58, 0x00, 0x00, 0x1A, 0xFE, 0x58, 0x00, 0x5A, 0x58, 0x00, 0x04,
+	0x20, 0x3F, 0xFE, 0x0D, 0x01, 0xFE, 0x0D, 0x01, 0xFE, 0x0D, 0x01, 0xFE, 0x0D, 0x01, 0x2E, 0x0D,
+	0x01, 0x00, 0x1F, 0xFE, 0x0D, 0x01, 0xFE, 0x0D, 0x01, 0xFE, 0x0D, 0x01, 0xFE, 0x0D, 0x01, 0x2E,
+	0x0D, 0x01, 0x00, 0x2F, 0xFE, 0x0D, 0x01, 0xFE, 0x0D, 0x01, 0xFE, 0x0D, 0x01, 0xFE, 0x0D, 0x01,
+	0x2E, 0x0D, 0x01, 0xFE, 0x34, 0x04, 0xFE, 0x34, 0x04, 0xFE, 0x34, 0x04, 0xFE, 0x34, 0x04, 0x32,
+	0x34, 0x04, 0x00, 0x01, 0xFE, 0x1A, 0x02, 0xFE, 0x1A, 0x02, 0xFE, 0x1A, 0x02, 0xFE, 0x1A, 0x02,
+	0x2E, 0x1A, 0x02, 0x00, 0x10, 0xFE, 0x0D, 0x01, 0xFE, 0x0D, 0x01, 0xFE, 0x0D, 0x01, 0xFE, 0x0D,
+	0x01, 0x2E, 0x0D, 0x01, 0x00, 0x02, 0xFE, 0x0D, 0x01, 0xFE, 0x0D, 0x01, 0xFE, 0x0D, 0x01, 0xFE,
+	0x0D, 0x01, 0x2E, 0x0D, 0x01, 0x00, 0x04, 0xFE, 0x0D, 0x01, 0xFE, 0x0D, 0x01, 0xFE, 0x0D, 0x01,
+	0xFE, 0x0D, 0x01, 0x2E, 0x0D, 0x01, 0x00, 0x20, 0xFE, 0x0D, 0x01, 0xFE, 0x0D, 0x01, 0xFE, 0x0D,
+	0x01, 0xFE, 0x0D, 0x01, 0x2E, 0x0D, 0x01, 0x00, 0x08, 0xFE, 0x0D, 0x01, 0xFE, 0x0D, 0x01, 0xFE,
+	0x0D, 0x01, 0xFE, 0x0D, 0x01, 0x2E, 0x0D, 0x01, 0x00, 0x13, 0xFE, 0x0D, 0x01, 0xFE, 0x0D, 0x01,
+	0xFE, 0x0D, 0x01, 0xFE, 0x0D, 0x01, 0x2E, 0x0D, 0x01, 0x00, 0x2C, 0xFE, 0x0D, 0x01, 0xFE, 0x0D,
+	0x01, 0xFE, 0x0D, 0x01, 0xFE, 0x0D, 0x01, 0x2E, 0x0D, 0x01, 0x00, 0x03, 0xFE, 0x0D, 0x01, 0xFE,
+	0x0D, 0x01, 0xFE, 0x0D, 0x01, 0xFE, 0x0D, 0x01, 0x2E, 0x0D, 0x01, 0x00, 0x0C, 0xFE, 0x0D, 0x01,
+	0xFE, 0x0D, 0x01, 0xFE, 0x0D, 0x01, 0xFE, 0x0D, 0x01, 0x2E, 0x0D, 0x01, 0xC0, 0x30, 0x88, 0x02,
+	0x01, 0x90, 0x02, 0x01, 0x98, 0x02, 0x01, 0xA0, 0x02, 0x01, 0xA8, 0x02, 0x01, 0xB0, 0x02, 0x01,
+	0xCA, 0x02, 0x0D, 0x48, 0x65, 0x6C, 0x76, 0x65, 0x74, 0x69, 0x63, 0x61, 0x4E, 0x65, 0x75, 0x65,
+	0xD0, 0x02, 0x01, 0xD8, 0x02, 0x01, 0xE0, 0x02, 0x01, 0xE8, 0x02, 0x00, 0xF2, 0x02, 0x16, 0x3F,
+	0x0F, 0xFE, 0x10, 0x12, 0x42, 0x10, 0x12, 0x04, 0xFA, 0x02, 0x09, 0x59, 0x72, 0x05, 0x11, 0xCE,
+	0xE2, 0x1D, 0x00, 0x82, 0x1A, 0x73, 0x1B, 0x0E, 0x64, 0x12, 0x62, 0x69, 0x12, 0xCE, 0x59, 0x00,
+	0x00, 0x8A, 0xFE, 0x59, 0x00, 0x5E, 0x59, 0x00, 0x00, 0x92, 0x0D, 0x59, 0xFE, 0x0B, 0x01, 0x42,
+	0x0B, 0x01, 0x00, 0x9A, 0x0D, 0x59, 0xFE, 0xBD, 0x01, 0x42, 0xBD, 0x01, 0x00, 0xA2, 0x0D, 0x59,
+	0xFE, 0xB2, 0x00, 0x42, 0xB2, 0x00, 0x00, 0xAA, 0xFE, 0x59, 0x00, 0x5E, 0x59, 0x00, 0x00, 0xB2,
+	0x0D, 0x59, 0xFE, 0x0B, 0x01, 0x42, 0x0B, 0x01, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA,
+	0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20,
+	0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE,
+	0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA,
+	0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20,
+	0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE,
+	0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA,
+	0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20,
+	0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE,
+	0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA,
+	0x20, 0xFE, 0xAA, 0x20, 0xDE, 0xAA, 0x20, 0x00, 0xD2, 0x62, 0xAA, 0x20, 0x00, 0x33, 0xFE, 0xAA,
+	0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20,
+	0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE,
+	0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA,
+	0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20,
+	0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE,
+	0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA,
+	0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20,
+	0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE,
+	0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA,
+	0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20,
+	0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE,
+	0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA,
+	0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20,
+	0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE,
+	0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA,
+	0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20,
+	0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE,
+	0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA,
+	0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20,
+	0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE,
+	0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA,
+	0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20,
+	0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE,
+	0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA,
+	0x20, 0xFE, 0xAA, 0x20, 0x3A, 0xAA, 0x20, 0x00, 0xEB, 0x62, 0xAA, 0x20, 0x00, 0x34, 0xFE, 0xAA,
+	0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20,
+	0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE,
+	0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA,
+	0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20,
+	0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE,
+	0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA,
+	0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20,
+	0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE,
+	0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA,
+	0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20,
+	0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE,
+	0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA,
+	0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20,
+	0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE,
+	0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA,
+	0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20,
+	0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE,
+	0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA,
+	0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20,
+	0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE,
+	0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA,
+	0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20,
+	0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE,
+	0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA, 0x20, 0xFE, 0xAA,
+	0x20, 0xFE, 0xAA, 0x20, 0x3A, 0xAA, 0x20, 0x04, 0x84, 0xDA, 0x5E, 0xFE, 0x61, 0x00, 0x35, 0x7A,
+	0xAA, 0x20, 0x30, 0xF5, 0xF4, 0x74, 0x3F, 0x25, 0xFA, 0xF9, 0x79, 0x3F, 0x2D, 0xF9, 0xF8, 0x78,
+	0xFE, 0xFE, 0x61, 0xFE, 0xFE, 0x61, 0xFE, 0xFE, 0x61, 0xFE, 0xFE, 0x61, 0xFE, 0xFE, 0x61, 0xFE,
+	0xFE, 0x61, 0xFE, 0xFE, 0x61, 0xFE, 0xFE, 0x61, 0xFE, 0xFE, 0x61, 0xFE, 0xFE, 0x61, 0xFE, 0xFE,
+	0x61, 0xFE, 0xFE, 0x61, 0xFE, 0xFE, 0x61, 0xFE, 0xFE, 0x61, 0xFE, 0xFE, 0x61, 0xFE, 0xFE, 0x61,
+	0xFE, 0xFE, 0x61, 0xFE, 0xFE, 0x61, 0xFE, 0xFE, 0x61, 0xFE, 0xFE, 0x61, 0xFE, 0xFE, 0x61, 0xFE,
+	0xFE, 0x61, 0xFE, 0xFE, 0x61, 0xFE, 0xFE, 0x61, 0xFE, 0xFE, 0x61, 0xFE, 0xFE, 0x61, 0xFE, 0xFE,
+	0x61, 0xFE, 0xFE, 0x61, 0xFE, 0xFE, 0x61, 0xFE, 0xFE, 0x61, 0xFE, 0xFE, 0x61, 0xFE, 0xFE, 0x61,
+	0xFE, 0xFE, 0x61, 0xFE, 0xFE, 0x61, 0xFE, 0xFE, 0x61, 0xFE, 0xFE, 0x61, 0xFE, 0xFE, 0x61, 0xFE,
+	0xFE, 0x61, 0xFE, 0xFE, 0x61, 0xFE, 0xFE, 0x61, 0xFE, 0xFE, 0x61, 0xFE, 0xFE, 0x61, 0xFE, 0xFE,
+	0x61, 0xFE, 0xFE, 0x61, 0xFE, 0xFE, 0x61, 0xFE, 0xFE, 0x61, 0xFE, 0xFE, 0x61, 0xFE, 0xFE, 0x61,
+	0xFE, 0xFE, 0x61, 0xFE, 0xFE, 0x61, 0xFE, 0xFE, 0x61, 0xFE, 0xFE, 0x61, 0xFE, 0xFE, 0x61, 0xFE,
+	0xFE, 0x61, 0xFE, 0xFE, 0x61, 0xFE, 0xFE, 0x61, 0xFE, 0xFE, 0x61, 0xFE, 0xFE, 0x61, 0xFE, 0xFE,
+	0x61, 0xFE, 0xFE, 0x61, 0xFE, 0xFE, 0x61, 0xFE, 0xFE, 0x61, 0xFE, 0xFE, 0x61, 0xFE, 0xFE, 0x61,
+	0xFE, 0xFE, 0x61, 0xFE, 0xFE, 0x61, 0x1E, 0xFE, 0x61, 0xCE, 0xB4, 0x7B, 0x1E, 0xFE, 0x61, 0x10,
+	0xBD, 0xBC, 0xBC, 0x3E, 0x25, 0x01, 0x05, 0x00, 0x2D, 0x01, 0x05, 0x3A, 0x93, 0x78, 0x00, 0x80,
+	0xCA, 0x9F, 0x72, 0x1E, 0xFE, 0x61, 0x01, 0x4F, 0xFE, 0x59, 0x00, 0x32, 0x59, 0x00, 0x92, 0xFE,
+	0x61, 0xCE, 0x0B, 0x01, 0x92, 0xFE, 0x61, 0xCE, 0x59, 0x00, 0x92, 0xFE, 0x61, 0xCE, 0x64, 0x01,
+	0x92, 0xFE, 0x61, 0xCE, 0x59, 0x00, 0xFE, 0xFE, 0x61, 0xF6, 0xFE, 0x61, 0xCE, 0x64, 0x01, 0x92,
+	0xA8, 0x82, 0xCE, 0x0B, 0x01, 0x92, 0xA8, 0x82, 0xCE, 0x59, 0x00, 0x92, 0xA8, 0x82, 0xCE, 0x0B,
+	0x01, 0x92, 0xA8, 0x82, 0xCE, 0x59, 0x00, 0x92, 0xA8, 0x82, 0xCE, 0x0B, 0x01, 0x92, 0xA8, 0x82,
+	0xCE, 0x59, 0x00, 0xFE, 0xA8, 0x82, 0xFE, 0xA8, 0x82, 0xFE, 0xA8, 0x82, 0xFE, 0xA8, 0x82, 0xFE,
+	0xA8, 0x82, 0xFE, 0xA8, 0x82, 0xFE, 0xA8, 0x82, 0xFE, 0xA8, 0x82, 0xFE, 0xA8, 0x82, 0xFE, 0xA8,
+	0x82, 0xFE, 0xA8, 0x82, 0xFE, 0xA8, 0x82, 0xFE, 0xA8, 0x82, 0xFE, 0xA8, 0x82, 0x7A, 0xA8, 0x82,
+	0xCE, 0xD3, 0x03, 0x92, 0xA8, 0x82, 0xCE, 0x59, 0x00, 0x92, 0xA8, 0x82, 0xCE, 0x59, 0x00, 0x92,
+	0xA8, 0x82, 0xCE, 0x59, 0x00, 0x92, 0xA8, 0x82, 0xCE, 0x59, 0x00, 0xFE, 0xA8, 0x82, 0xFE, 0xA8,
+	0x82, 0xFE, 0xA8, 0x82, 0xFE, 0xA8, 0x82, 0xFE, 0xA8, 0x82, 0xFE, 0xA8, 0x82, 0xFE, 0xA8, 0x82,
+	0xFE, 0xA8, 0x82, 0xFE, 0xA8, 0x82, 0xFE, 0xA8, 0x82, 0xFE, 0xA8, 0x82, 0xFE, 0xA8, 0x82, 0xFE,
+	0xA8, 0x82, 0xFE, 0xA8, 0x82, 0xFE, 0xA8, 0x82, 0xFE, 0xA8, 0x82, 0xCE, 0xA8, 0x82, 0x76, 0xE8,
+	0x0D, 0xCA, 0x17, 0x85, 0xFE, 0xA8, 0x82, 0x82, 0xA8, 0x82, 0x72, 0xB2, 0x00, 0xFE, 0xA8, 0x82,
+	0xFE, 0xA8, 0x82, 0x32, 0xA8, 0x82, 0x20, 0x10, 0x08, 0x88, 0xD9, 0x69, 0x12, 0x0A, 0x08, 0xF4,
+	0x1A, 0xA8, 0x82, 0x10, 0x3F, 0x0A, 0x1D, 0x12, 0x15, 0x12, 0x9F, 0x82, 0x28, 0x43, 0x65, 0x6C,
+	0x6C, 0x2D, 0x30, 0x2D, 0x62, 0x6F, 0x64, 0x79, 0x2E, 0xAA, 0x82, 0x2C, 0x04, 0x5A, 0x1C, 0x0A,
+	0x00, 0x18, 0x01, 0x40, 0x00, 0x4A, 0x14, 0x0D, 0x0E, 0xEF, 0x8F, 0x00, 0x15, 0x01, 0x05, 0x0E,
+	0xE2, 0x71, 0x00, 0x40, 0x0E, 0xE2, 0x71, 0x0C, 0x40, 0x10, 0x08, 0x8C, 0x32, 0x50, 0x00, 0x10,
+	0x66, 0x0A, 0x25, 0x12, 0x1D, 0x2E, 0x50, 0x00, 0x40, 0x63, 0x61, 0x74, 0x65, 0x67, 0x6F, 0x72,
+	0x79, 0x4C, 0x65, 0x76, 0x65, 0x6C, 0x31, 0x52, 0x6F, 0x77, 0x1A, 0x02, 0x83, 0x0C, 0x04, 0x5A,
+	0x3B, 0x0A, 0x16, 0xFF, 0x82, 0x10, 0x3B, 0x07, 0x54, 0x3F, 0x25, 0x01, 0x05, 0x00, 0x2D, 0x01,
+	0x05, 0x2E, 0x30, 0x10, 0x04, 0x18, 0x00, 0x66, 0x77, 0x00, 0x00, 0x8D, 0xAA, 0x77, 0x00, 0x00,
+	0x32, 0x4E, 0x77, 0x00, 0x10, 0x98, 0x31, 0x4B, 0x3F, 0x25, 0x01, 0x05, 0x00, 0x2D, 0x01, 0x05,
+	0x9E, 0x77, 0x00, 0x00, 0x8E, 0xAA, 0x77, 0x00, 0x00, 0x33, 0x4E, 0x77, 0x00, 0x10, 0xF6, 0x5B,
+	0x42, 0x3F, 0x25, 0x01, 0x05, 0x00, 0x2D, 0x01, 0x05, 0x9E, 0x77, 0x00, 0x00, 0x8F, 0xAA, 0x77,
+	0x00, 0x00, 0x34, 0x4E, 0x77, 0x00, 0x10, 0x53, 0x86, 0x39, 0x3F, 0x25, 0x01, 0x05, 0x00, 0x2D,
+	0x01, 0x05, 0x9E, 0x77, 0x00, 0x00, 0x90, 0xAA, 0x77, 0x00, 0x00, 0x35, 0x4E, 0x77, 0x00, 0x10,
+	0xB1, 0xB0, 0x30, 0x3F, 0x25, 0x01, 0x05, 0x00, 0x2D, 0x01, 0x05, 0x9E, 0x77, 0x00, 0x00, 0x8B,
+	0x32, 0x77, 0x00, 0x10, 0x44, 0x0A, 0x22, 0x12, 0x1A, 0x2E, 0x53, 0x02, 0x20, 0x66, 0x6F, 0x6F,
+	0x74, 0x65, 0x72, 0x52, 0x6F, 0x77, 0xB2, 0xA8, 0x02, 0x00, 0x8A, 0x32, 0x55, 0x00, 0x42, 0xA8,
+	0x02, 0x2C, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x43, 0x6F, 0x6C, 0x75, 0x6D, 0x6E, 0x36, 0x58,
+	0x00, 0x51, 0xA8, 0x10, 0xDD, 0xDC, 0x5C, 0x3F, 0x25, 0x01, 0x05, 0x00, 0x2D, 0x01, 0x05, 0x32,
+	0xCC, 0x00, 0x6A, 0x1F, 0x03, 0x00, 0x89, 0x32, 0x77, 0x00, 0x00, 0x63, 0x3E, 0xCC, 0x00, 0x09,
+	0x77, 0x42, 0xCC, 0x00, 0x11, 0x74, 0x30, 0xBD, 0x56, 0x3E, 0x3F, 0x25, 0xC2, 0xF1, 0x40, 0x3F,
+	0x2D, 0xBF, 0x26, 0x40, 0xA2, 0x74, 0x00, 0x00, 0x91, 0x76, 0x74, 0x00, 0x10, 0x6C, 0x61, 0x62,
+	0x65, 0x6C, 0xFE, 0x90, 0x03, 0x3E, 0x90, 0x03, 0x00, 0x92, 0x9E, 0x74, 0x00, 0xFE, 0x8D, 0x03,
+	0x7D, 0x8D, 0x00, 0x93, 0x9E, 0x74, 0x00, 0xFE, 0x8A, 0x03, 0x7D, 0x8A, 0x00, 0x94, 0x9E, 0x74,
+	0x00, 0xFE, 0x87, 0x03, 0x7D, 0x87, 0x00, 0x95, 0x9E, 0x74, 0x00, 0xFE, 0x84, 0x03, 0x7D, 0x84,
+	0x00, 0x9D, 0x32, 0x74, 0x00, 0x10, 0x6B, 0x0A, 0x2A, 0x12, 0x22, 0x2E, 0x84, 0x03, 0x14, 0x70,
+	0x69, 0x76, 0x6F, 0x74, 0x42, 0xC1, 0x2C, 0x14, 0x75, 0x6D, 0x6D, 0x61, 0x72, 0x79, 0x69, 0x39,
+	0x42, 0xDC, 0x05, 0x10, 0xF6, 0xF5, 0x75, 0x3F, 0x25, 0x01, 0x05, 0x00, 0x2D, 0x01, 0x05, 0x9E,
+	0x34, 0x03, 0x00, 0x9C, 0x32, 0x7C, 0x00, 0x10, 0x68, 0x0A, 0x27, 0x12, 0x1F, 0x6E, 0x7C, 0x00,
+	0x4E, 0x79, 0x04, 0x10, 0x58, 0xBE, 0x64, 0x3F, 0x25, 0x01, 0x05, 0x00, 0x2D, 0x01, 0x05, 0x9E,
+	0x79, 0x00, 0x00, 0x9E, 0x32, 0x79, 0x00, 0x10, 0x6D, 0x0A, 0x2C, 0x12, 0x24, 0x42, 0x79, 0x00,
+	0x00, 0x48, 0x2E, 0x29, 0x04, 0x09, 0xFD, 0x42, 0xF7, 0x00, 0xC1, 0xC9, 0x5A, 0xD3, 0x06, 0x6A,
+	0x2B, 0x04, 0x00, 0xA1, 0x32, 0x7E, 0x00, 0x3A, 0x9A, 0x07, 0x00, 0x31, 0xC6, 0x9A, 0x07, 0x00,
+	0xA5, 0x32, 0x50, 0x00, 0x3A, 0xF2, 0x04, 0x00, 0x31, 0x8A, 0x9A, 0x07, 0x10, 0x8F, 0xC2, 0x75,
+	0x3F, 0x25, 0x01, 0x05, 0x00, 0x2D, 0x01, 0x05, 0x32, 0x45, 0x01, 0x6A, 0x9A, 0x07, 0x00, 0xA6,
+	0xAA, 0x77, 0x00, 0x52, 0x0D, 0x04, 0x10, 0x1F, 0x85, 0x6B, 0x3F, 0x25, 0x01, 0x05, 0x00, 0x2D,
+	0x01, 0x05, 0x9E, 0x77, 0x00, 0x00, 0xA7, 0xAA, 0x77, 0x00, 0x52, 0x10, 0x04, 0x10, 0xAE, 0x47,
+	0x61, 0x3F, 0x25, 0x01, 0x05, 0x00, 0x2D, 0x01, 0x05, 0x9E, 0x77, 0x00, 0x00, 0xA8, 0xAA, 0x77,
+	0x00, 0x52, 0x13, 0x04, 0x10, 0x3D, 0x0A, 0x57, 0x3F, 0x25, 0x01, 0x05, 0x00, 0x2D, 0x01, 0x05,
+	0x9E, 0x77, 0x00, 0x00, 0xA9, 0xAA, 0x77, 0x00, 0x52, 0x16, 0x04, 0x10, 0xCD, 0xCC, 0x4C, 0x3F,
+	0x25, 0x01, 0x05, 0x00, 0x2D, 0x01, 0x05, 0x9E, 0x77, 0x00, 0x00, 0xA4, 0x32, 0x77, 0x00, 0x3A,
+	0xCE, 0x06, 0x00, 0x31, 0x5E, 0x9A, 0x07, 0xD1, 0xCE, 0x10, 0xED, 0xEC, 0x6C, 0x3F, 0x25, 0x01,
+	0x05, 0x0C, 0x2D, 0xEB, 0xEA, 0x6A, 0x36, 0x74, 0x00, 0x6A, 0x17, 0x03, 0x00, 0xA3, 0x32, 0x74,
+	0x00, 0x00, 0x47, 0x36, 0x61, 0x0A, 0x00, 0x31, 0xED, 0x42, 0x89, 0x80, 0x36, 0xB9, 0x07, 0x7A,
+	0xB9, 0x0A, 0x00, 0xA2, 0x32, 0x58, 0x00, 0x42, 0xCC, 0x00, 0x7A, 0x9A, 0x07, 0x12, 0xFF, 0x8F,
+	0x08, 0xA3, 0xA2, 0x22, 0x46, 0x4D, 0x8F, 0x6E, 0xCC, 0x00, 0x00, 0xAA, 0x76, 0x74, 0x00, 0x7A,
+	0x9A, 0x07, 0x61, 0x86, 0xC6, 0x90, 0x03, 0x00, 0xAB, 0x9E, 0x74, 0x00, 0xFE, 0x8D, 0x03, 0x7D,
+	0x8D, 0x00, 0xAC, 0x9E, 0x74, 0x00, 0xFE, 0x8A, 0x03, 0x7D, 0x8A, 0x00, 0xAD, 0x9E, 0x74, 0x00,
+	0xFE, 0x87, 0x03, 0x7D, 0x87, 0x00, 0xAE, 0x9E, 0x74, 0x00, 0xFE, 0x84, 0x03, 0x7D, 0x84, 0x00,
+	0xB6, 0x32, 0x74, 0x00, 0x3A, 0x9A, 0x07, 0x00, 0x31, 0x9E, 0x9A, 0x07, 0x0E, 0x70, 0x90, 0x56,
+	0x75, 0x90, 0x6E, 0xC0, 0x02, 0x00, 0xB5, 0x32, 0x7C, 0x00, 0x3A, 0x9A, 0x07, 0x46, 0x7C, 0x00,
+	0x4E, 0x9A, 0x07, 0x10, 0x5F, 0x9C, 0x66, 0x3F, 0x25, 0x01, 0x05, 0x0C, 0x2D, 0x5B, 0xAD, 0x65,
+	0xA2, 0x05, 0x04, 0x00, 0xB7, 0x32, 0x79, 0x00, 0x3A, 0x9A, 0x07, 0x0D, 0x79, 0x8E, 0x9A, 0x07,
+	0x6A, 0x43, 0x03, 0x6A, 0x83, 0x04, 0x00, 0xBA, 0x32, 0x7E, 0x00, 0x3A, 0x9A, 0x07, 0x00, 0x32,
+	0xC6, 0x9A, 0x07, 0x00, 0xBE, 0x32, 0x50, 0x00, 0x3A, 0x9A, 0x07, 0x00, 0x32, 0xFE, 0x9A, 0x07,
+	0x62, 0x9A, 0x07, 0x00, 0xBF, 0xAA, 0x77, 0x00, 0xFE, 0x0D, 0x04, 0x9D, 0x0D, 0x00, 0xC0, 0xAA,
+	0x77, 0x00, 0xFE, 0x10, 0x04, 0x9D, 0x10, 0x00, 0xC1, 0xAA, 0x77, 0x00, 0xFE, 0x13, 0x04, 0x9D,
+	0x13, 0x00, 0xC2, 0xAA, 0x77, 0x00, 0xFE, 0x16, 0x04, 0x9D, 0x16, 0x00, 0xBD, 0x32, 0x77, 0x00,
+	0x3A, 0xCE, 0x06, 0x00, 0x32, 0xFE, 0x9A, 0x07, 0x56, 0x9A, 0x07, 0x00, 0xBC, 0x32, 0x74, 0x00,
+	0x3A, 0x9A, 0x07, 0x00, 0x32, 0xED, 0x42, 0xCA, 0x9A, 0x07, 0x00, 0xBB, 0x32, 0x58, 0x00, 0x42,
+	0xCC, 0x00, 0x7A, 0x9A, 0x07, 0x1C, 0xC1, 0xC0, 0xC0, 0x3E, 0x25, 0xD9, 0xD8, 0x58, 0x12, 0xA8,
+	0x0F, 0x32, 0x80, 0x22, 0x6E, 0xE3, 0x03, 0x00, 0xC3, 0x76, 0x74, 0x00, 0xFE, 0x9A, 0x07, 0x52,
+	0x9A, 0x07, 0x00, 0xC4, 0x9E, 0x74, 0x00, 0xFE, 0x8D, 0x03, 0x7D, 0x8D, 0x00, 0xC5, 0x9E, 0x74,
+	0x00, 0xFE, 0x8A, 0x03, 0x7D, 0x8A, 0x00, 0xC6, 0x9E, 0x74, 0x00, 0xFE, 0x87, 0x03, 0x7D, 0x87,
+	0x00, 0xC7, 0x9E, 0x74, 0x00, 0xFE, 0x84, 0x03, 0x7D, 0x84, 0x00, 0xCF, 0x32, 0x74, 0x00, 0x3A,
+	0x9A, 0x07, 0x00, 0x32, 0xFE, 0x9A, 0x07, 0x76, 0x9A, 0x07, 0x00, 0xCE, 0x32, 0x7C, 0x00, 0x3A,
+	0x9A, 0x07, 0x46, 0x7C, 0x00, 0xFE, 0x9A, 0x07, 0xF9, 0x9A, 0x00, 0xD0, 0x32, 0x79, 0x00, 0x3A,
+	0x9A, 0x07, 0x0D, 0x79, 0xFE, 0x9A, 0x07, 0x66, 0x9A, 0x07, 0x00, 0xD3, 0x32, 0x7E, 0x00, 0x3A,
+	0x9A, 0x07, 0x00, 0x33, 0xC6, 0x9A, 0x07, 0x00, 0xD7, 0x32, 0x50, 0x00, 0x3A, 0x9A, 0x07, 0x00,
+	0x33, 0xFE, 0x9A, 0x07, 0x62, 0x9A, 0x07, 0x00, 0xD8, 0xAA, 0x77, 0x00, 0xFE, 0x0D, 0x04, 0x9D,
+	0x0D, 0x00, 0xD9, 0xAA, 0x77, 0x00, 0xFE, 0x10, 0x04, 0x9D, 0x10, 0x00, 0xDA, 0xAA, 0x77, 0x00,
+	0xFE, 0x13, 0x04, 0x9D, 0x13, 0x00, 0xDB, 0xAA, 0x77, 0x00, 0xFE, 0x16, 0x04, 0x9D, 0x16, 0x00,
+	0xD6, 0x32, 0x77, 0x00, 0x3A, 0xCE, 0x06, 0x00, 0x33, 0xFE, 0x9A, 0x07, 0x56, 0x9A, 0x07, 0x00,
+	0xD5, 0x32, 0x74, 0x00, 0x3A, 0x9A, 0x07, 0x00, 0x33, 0xED, 0x42, 0xCA, 0x9A, 0x07, 0x00, 0xD4,
+	0x32, 0x58, 0x00, 0x42, 0xCC, 0x00, 0x7A, 0x9A, 0x07, 0x12, 0x18, 0x8C, 0x0C, 0x95, 0x94, 0x14,
+	0x3E, 0x42, 0x28, 0x9E, 0x6E, 0x9A, 0x07, 0x00, 0xDC, 0x76, 0x74, 0x00, 0xFE, 0x9A, 0x07, 0x52,
+	0x9A, 0x07, 0x00, 0xDD, 0x9E, 0x74, 0x00, 0xFE, 0x8D, 0x03, 0x7D, 0x8D, 0x00, 0xDE, 0x9E, 0x74,
+	0x00, 0xFE, 0x8A, 0x03, 0x7D, 0x8A, 0x00, 0xDF, 0x9E, 0x74, 0x00, 0xFE, 0x87, 0x03, 0x7D, 0x87,
+	0x00, 0xE0, 0x9E, 0x74, 0x00, 0xFE, 0x84, 0x03, 0x7D, 0x84, 0x00, 0xE8, 0x32, 0x74, 0x00, 0x3A,
+	0x9A, 0x07, 0x00, 0x33, 0xFE, 0x9A, 0x07, 0x76, 0x9A, 0x07, 0x00, 0xE7, 0x32, 0x7C, 0x00, 0x3A,
+	0x9A, 0x07, 0x46, 0x7C, 0x00, 0xFE, 0x9A, 0x07, 0xF9, 0x9A, 0x00, 0xE9, 0x32, 0x79, 0x00, 0x3A,
+	0x9A, 0x07, 0x0D, 0x79, 0xFE, 0x9A, 0x07, 0x66, 0x9A, 0x07, 0x00, 0xEC, 0x32, 0x7E, 0x00, 0x3A,
+	0x9A, 0x07, 0x00, 0x34, 0xC6, 0x9A, 0x07, 0x00, 0xF0, 0x32, 0x50, 0x00, 0x3A, 0x9A, 0x07, 0x00,
+	0x34, 0xFE, 0x9A, 0x07, 0x62, 0x9A, 0x07, 0x00, 0xF1, 0xAA, 0x77, 0x00, 0xFE, 0x0D, 0x04, 0x9D,
+	0x0D, 0x00, 0xF2, 0xAA, 0x77, 0x00, 0xFE, 0x10, 0x04, 0x9D, 0x10, 0x00, 0xF3, 0xAA, 0x77, 0x00,
+	0xFE, 0x13, 0x04, 0x9D, 0x13, 0x00, 0xF4, 0xAA, 0x77, 0x00, 0xFE, 0x16, 0x04, 0x9D, 0x16, 0x00,
+	0xEF, 0x32, 0x77, 0x00, 0x3A, 0xCE, 0x06, 0x00, 0x34, 0xFE, 0x9A, 0x07, 0x56, 0x9A, 0x07, 0x00,
+	0xEE, 0x32, 0x74, 0x00, 0x3A, 0x9A, 0x07, 0x00, 0x34, 0xED, 0x42, 0xCA, 0x9A, 0x07, 0x00, 0xED,
+	0x32, 0x58, 0x00, 0x42, 0xCC, 0x00, 0x7A, 0x9A, 0x07, 0x1C, 0xFE, 0xFD, 0x7D, 0x3F, 0x25, 0xAE,
+	0xAD, 0x2D, 0x0E, 0xCE, 0x16, 0x00, 0x00, 0x32, 0x47, 0xAA, 0x6E, 0x9A, 0x07, 0x00, 0xF5, 0x76,
+	0x74, 0x00, 0xFE, 0x9A, 0x07, 0x52, 0x9A, 0x07, 0x00, 0xF6, 0x9E, 0x74, 0x00, 0xFE, 0x8D, 0x03,
+	0x7D, 0x8D, 0x00, 0xF7, 0x9E, 0x74, 0x00, 0xFE, 0x8A, 0x03, 0x7D, 0x8A, 0x00, 0xF8, 0x9E, 0x74,
+	0x00, 0xFE, 0x87, 0x03, 0x7D, 0x87, 0x00, 0xF9, 0x9E, 0x74, 0x00, 0xFE, 0x84, 0x03, 0x7D, 0x84,
+	0x04, 0x81, 0xDA, 0x2E, 0x8F, 0x24, 0x3A, 0x9A, 0x07, 0x00, 0x34, 0xFE, 0x9A, 0x07, 0x76, 0x9A,
+	0x07, 0x00, 0x80, 0x32, 0x7C, 0x00, 0x3A, 0x9A, 0x07, 0x46, 0x7C, 0x00, 0xFE, 0x9A, 0x07, 0xF9,
+	0x9A, 0x00, 0x82, 0x32, 0x79, 0x00, 0x3A, 0x9A, 0x07, 0x0D, 0x79, 0xFE, 0x9A, 0x07, 0x66, 0x9A,
+	0x07, 0x00, 0x85, 0x32, 0x7E, 0x00, 0x3A, 0x9A, 0x07, 0x00, 0x35, 0xC6, 0x9A, 0x07, 0x00, 0x89,
+	0x32, 0x50, 0x00, 0x3A, 0x9A, 0x07, 0x00, 0x35, 0xFE, 0x9A, 0x07, 0x62, 0x9A, 0x07, 0x00, 0x8A,
+	0xAA, 0x77, 0x00, 0xFE, 0x0D, 0x04, 0x9D, 0x0D, 0x00, 0x8B, 0xAA, 0x77, 0x00, 0xFE, 0x10, 0x04,
+	0x9D, 0x10, 0x00, 0x8C, 0xAA, 0x77, 0x00, 0xFE, 0x13, 0x04, 0x9D, 0x13, 0x00, 0x8D, 0xAA, 0x77,
+	0x00, 0xFE, 0x16, 0x04, 0x9D, 0x16, 0x00, 0x88, 0x32, 0x77, 0x00, 0x3A, 0x02, 0x26, 0x00, 0x35,
+	0x5E, 0x9A, 0x07, 0x7A, 0xF1, 0x1D, 0x00, 0x87, 0x32, 0x55, 0x00, 0x3A, 0x7B, 0x07, 0x00, 0x35,
+	0xED, 0x23, 0xCA, 0x7B, 0x07, 0x00, 0x86, 0x32, 0x58, 0x00, 0x42, 0xAD, 0x00, 0x5A, 0x7B, 0x07,
+	0x7A, 0xAD, 0x00, 0x00, 0x8E, 0x32, 0x55, 0x00, 0x3A, 0xD0, 0x07, 0x00, 0x35, 0xFE, 0x5C, 0x07,
+	0x56, 0x5C, 0x07, 0x00, 0x8F, 0x9E, 0x74, 0x00, 0xFE, 0x4F, 0x03, 0x7D, 0x4F, 0x00, 0x90, 0x9E,
+	0x74, 0x00, 0xFE, 0x4C, 0x03, 0x7D, 0x4C, 0x00, 0x91, 0x9E, 0x74, 0x00, 0xFE, 0x49, 0x03, 0x7D,
+	0x49, 0x00, 0x92, 0x9E, 0x74, 0x00, 0xFE, 0x46, 0x03, 0x7D, 0x46, 0x00, 0x9A, 0x32, 0x74, 0x00,
+	0x3A, 0x5C, 0x07, 0x00, 0x35, 0x9E, 0x5C, 0x07, 0x66, 0xA1, 0x4C, 0x6E, 0x1C, 0x0A, 0x00, 0x99,
+	0x32, 0x7C, 0x00, 0x3A, 0x5C, 0x07, 0x46, 0x7C, 0x00, 0x4E, 0x5C, 0x07, 0x30, 0x54, 0xCF, 0x63,
+	0x3F, 0x25, 0x66, 0x7A, 0x68, 0x3F, 0x2D, 0x62, 0x8B, 0x67, 0xA2, 0x2A, 0x1E, 0x00, 0x9B, 0x32,
+	0x79, 0x00, 0x3A, 0x5C, 0x07, 0x0D, 0x79, 0xFE, 0x5C, 0x07, 0x5E, 0x5C, 0x07, 0x24, 0x36, 0x08,
+	0x96, 0xD9, 0x69, 0x12, 0x30, 0x08, 0xE6, 0x0F, 0x16, 0x06, 0xB0, 0x2C, 0xD9, 0x02, 0x22, 0x08,
+	0x0A, 0x04, 0x0A, 0x02, 0x0B, 0x2B, 0x18, 0x01, 0x0D, 0x0A, 0x10, 0x2F, 0x18, 0x01, 0x22, 0x0A,
+	0x05, 0x14, 0x34, 0x2E, 0x10, 0x03, 0x18, 0x01, 0x2A, 0x03, 0x99, 0xD7, 0x69, 0x0A, 0x26, 0x12,
+	0x1E, 0x22, 0x68, 0x26, 0x14, 0x54, 0x65, 0x78, 0x74, 0x2D, 0x30, 0x56, 0xE1, 0x03, 0x38, 0x39,
+	0x5A, 0xBA, 0x01, 0x08, 0x00, 0x10, 0x00, 0x1D, 0x00, 0x00, 0x20, 0x41, 0x2A, 0x12, 0x32, 0x3B,
+	0xA0, 0x20, 0x2D, 0x42, 0x6F, 0x6C, 0x64, 0x3A, 0x1D, 0x08, 0x01, 0x16, 0x9B, 0x22, 0x0E, 0xA0,
+	0x22, 0x42, 0x67, 0x13, 0x28, 0x40, 0x01, 0x50, 0x00, 0x58, 0x00, 0x60, 0x00, 0x68, 0x00, 0x75,
+	0x01, 0x20, 0x00, 0x7D, 0x01, 0x05, 0x0C, 0x80, 0x01, 0x01, 0xA0, 0x12, 0x67, 0xB0, 0x04, 0xC5,
+	0x01, 0x0E, 0xA0, 0x13, 0x10, 0xC8, 0x01, 0x01, 0xDD, 0x01, 0x01, 0x18, 0x0C, 0xE0, 0x01, 0x01,
+	0xF5, 0x05, 0x12, 0x18, 0xF8, 0x01, 0x00, 0x80, 0x02, 0x00, 0x88, 0x0E, 0xB9, 0xA0, 0x00, 0xFF,
+	0x11, 0x01, 0x04, 0x01, 0xA0, 0x12, 0xBF, 0xA0, 0x28, 0xC0, 0x02, 0x00, 0xC8, 0x02, 0x00, 0xD8,
+	0x02, 0x01, 0xF2, 0x02, 0x16, 0xCC, 0x2D, 0x01, 0x39, 0x56, 0x7B, 0x00, 0x44, 0xF8, 0x02, 0x00,
+	0x62, 0x70, 0x08, 0x04, 0x1A, 0x01, 0x2E, 0x25, 0x00, 0x00, 0x10, 0x42, 0x28, 0x01, 0x3D, 0x01,
+	0x2C, 0x18, 0x40, 0x01, 0x48, 0x00, 0x50, 0x00, 0x5D, 0x01, 0x0B, 0x24, 0x6A, 0x00, 0x70, 0x00,
+	0x78, 0x00, 0x8A, 0x01, 0x0A, 0x0D, 0x01, 0x0E, 0x12, 0xAC, 0xB6, 0x00, 0x95, 0x05, 0x80, 0x00,
+	0x9D, 0x05, 0x8F, 0x00, 0xA5, 0x05, 0x06, 0x00, 0xAD, 0x05, 0x06, 0x1C, 0xCA, 0x01, 0x00, 0xD0,
+	0x01, 0x01, 0xD8, 0x01, 0x01, 0x8E, 0x7C, 0x0F, 0xE0, 0x01, 0x00, 0xF8, 0x01, 0x01, 0xC2, 0x02,
+	0x04, 0x08, 0x99, 0xD7, 0x69, 0xC8, 0x02, 0x01, 0xD8, 0x02, 0x00, 0xE0, 0x02, 0x00, 0xE8, 0x02,
+	0x00, 0xF0, 0x02, 0x00, 0x36, 0x08, 0x97, 0xFE, 0x90, 0x01, 0x46, 0x90, 0x01, 0x9D, 0xFD, 0xFE,
+	0x90, 0x01, 0xFE, 0x90, 0x01, 0xFE, 0x90, 0x01, 0xFE, 0x90, 0x01, 0xC6, 0x90, 0x01, 0x00, 0x98,
+	0xFE, 0x90, 0x01, 0x46, 0x90, 0x01, 0xDD, 0x19, 0xFE, 0x90, 0x01, 0xFE, 0x90, 0x01, 0xFE, 0x90,
+	0x01, 0xFE, 0x90, 0x01, 0xC6, 0x90, 0x01, 0x00, 0x99, 0xFE, 0x90, 0x01, 0x46, 0x90, 0x01, 0xFD,
+	0x35, 0xFE, 0x90, 0x01, 0xFE, 0x90, 0x01, 0xFE, 0x90, 0x01, 0xFE, 0x90, 0x01, 0xC6, 0x90, 0x01,
+	0x00, 0x9A, 0xFE, 0x90, 0x01, 0x46, 0x90, 0x01, 0x2A, 0x51, 0x08, 0xFE, 0x90, 0x01, 0xFE, 0x90,
+	0x01, 0xFE, 0x90, 0x01, 0xFE, 0x90, 0x01, 0xC6, 0x90, 0x01, 0x00, 0xAF, 0x32, 0x90, 0x01, 0x00,
+	0xDB, 0xDE, 0xD0, 0x07, 0x00, 0x31, 0x5E, 0xD0, 0x07, 0x00, 0xBC, 0xFD, 0xD0, 0x00, 0x14, 0x36,
+	0xD0, 0x07, 0x14, 0x4D, 0x65, 0x64, 0x69, 0x75, 0x6D, 0xFE, 0xD2, 0x07, 0xFE, 0xD2, 0x07, 0xCA,
+	0xD2, 0x07, 0x00, 0x01, 0xFE, 0xD2, 0x07, 0x72, 0xD2, 0x07, 0x00, 0xB0, 0xFE, 0x92, 0x01, 0x46,
+	0x92, 0x01, 0x32, 0xD2, 0x07, 0xFE, 0x92, 0x01, 0xFE, 0x92, 0x01, 0xFE, 0x92, 0x01, 0xFE, 0x92,
+	0x01, 0xC6, 0x92, 0x01, 0x00, 0xB1, 0xFE, 0x92, 0x01, 0x46, 0x92, 0x01, 0x32, 0xD4, 0x07, 0xFE,
+	0x92, 0x01, 0xFE, 0x92, 0x01, 0xFE, 0x92, 0x01, 0xFE, 0x92, 0x01, 0xC6, 0x92, 0x01, 0x00, 0xB2,
+	0xFE, 0x92, 0x01, 0x46, 0x92, 0x01, 0x32, 0xD6, 0x07, 0xFE, 0x92, 0x01, 0xFE, 0x92, 0x01, 0xFE,
+	0x92, 0x01, 0xFE, 0x92, 0x01, 0xC6, 0x92, 0x01, 0x00, 0xB3, 0xFE, 0x92, 0x01, 0x46, 0x92, 0x01,
+	0x32, 0xD8, 0x07, 0xFE, 0x92, 0x01, 0xFE, 0x92, 0x01, 0xFE, 0x92, 0x01, 0xFE, 0x92, 0x01, 0xC6,
+	0x92, 0x01, 0x00, 0xC8, 0xFE, 0x92, 0x01, 0x29, 0x92, 0x00, 0x32, 0xFE, 0xDA, 0x07, 0xFE, 0xDA,
+	0x07, 0xFE, 0xDA, 0x07, 0xFE, 0xDA, 0x07, 0xFE, 0xDA, 0x07, 0xF9, 0xDA, 0x00, 0xC9, 0xFE, 0x92,
+	0x01, 0x46, 0x92, 0x01, 0xFE, 0xDA, 0x07, 0xFE, 0xDA, 0x07, 0xFE, 0xDA, 0x07, 0xFE, 0xDA, 0x07,
+	0xFA, 0xDA, 0x07, 0x00, 0xCA, 0xFE, 0x92, 0x01, 0x46, 0x92, 0x01, 0xFE, 0xDA, 0x07, 0xFE, 0xDA,
+	0x07, 0xFE, 0xDA, 0x07, 0xFE, 0xDA, 0x07, 0xFA, 0xDA, 0x07, 0x00, 0xCB, 0xFE, 0x92, 0x01, 0x46,
+	0x92, 0x01, 0xFE, 0xDA, 0x07, 0xFE, 0xDA, 0x07, 0xFE, 0xDA, 0x07, 0xFE, 0xDA, 0x07, 0xFA, 0xDA,
+	0x07, 0x00, 0xCC, 0xFE, 0x92, 0x01, 0x46, 0x92, 0x01, 0xFE, 0xDA, 0x07, 0xFE, 0xDA, 0x07, 0xFE,
+	0xDA, 0x07, 0xFE, 0xDA, 0x07, 0xFA, 0xDA, 0x07, 0x00, 0xE1, 0xFE, 0x92, 0x01, 0x29, 0x92, 0x00,
+	0x33, 0xFE, 0xDA, 0x07, 0xFE, 0xDA, 0x07, 0xFE, 0xDA, 0x07, 0xFE, 0xDA, 0x07, 0xFE, 0xDA, 0x07,
+	0xF9, 0xDA, 0x00, 0xE2, 0xFE, 0x92, 0x01, 0x46, 0x92, 0x01, 0xFE, 0xDA, 0x07, 0xFE, 0xDA, 0x07,
+	0xFE, 0xDA, 0x07, 0xFE, 0xDA, 0x07, 0xFA, 0xDA, 0x07, 0x00, 0xE3, 0xFE, 0x92, 0x01, 0x46, 0x92,
+	0x01, 0xFE, 0xDA, 0x07, 0xFE, 0xDA, 0x07, 0xFE, 0xDA, 0x07, 0xFE, 0xDA, 0x07, 0xFA, 0xDA, 0x07,
+	0x00, 0xE4, 0xFE, 0x92, 0x01, 0x46, 0x92, 0x01, 0xFE, 0xDA, 0x07, 0xFE, 0xDA, 0x07, 0xFE, 0xDA,
+	0x07, 0xFE, 0xDA, 0x07, 0xFA, 0xDA, 0x07, 0x00, 0xE5, 0xFE, 0x92, 0x01, 0x46, 0x92, 0x01, 0xFE,
+	0xDA, 0x07, 0xFE, 0xDA, 0x07, 0xFE, 0xDA, 0x07, 0xFE, 0xDA, 0x07, 0xFA, 0xDA, 0x07, 0x00, 0xFA,
+	0xFE, 0x92, 0x01, 0x29, 0x92, 0x00, 0x34, 0xF6, 0xDA, 0x07, 0x66, 0x7B, 0xBD, 0xFE, 0x60, 0x1F,
+	0x82, 0x60, 0x1F, 0x66, 0x7B, 0x00, 0x32, 0x60, 0x1F, 0x00, 0x38, 0x2A, 0x60, 0x1F, 0xFE, 0x8E,
+	0x17, 0x46, 0x8E, 0x17, 0x00, 0x01, 0x2A, 0x60, 0x1F, 0x00, 0xFB, 0xFE, 0x92, 0x01, 0x46, 0x92,
+	0x01, 0xCA, 0xDA, 0x07, 0x66, 0x17, 0x01, 0xFE, 0x92, 0x01, 0xFE, 0x92, 0x01, 0xFE, 0x92, 0x01,
+	0xC6, 0x92, 0x01, 0x00, 0xFC, 0xFE, 0x92, 0x01, 0x46, 0x92, 0x01, 0xCA, 0xDA, 0x07, 0xFE, 0x92,
+	0x01, 0xFE, 0x92, 0x01, 0xFE, 0x92, 0x01, 0xFE, 0x92, 0x01, 0x2E, 0x92, 0x01, 0x00, 0xFD, 0xFE,
+	0x92, 0x01, 0x46, 0x92, 0x01, 0xCA, 0xDA, 0x07, 0xFE, 0x92, 0x01, 0xFE, 0x92, 0x01, 0xFE, 0x92,
+	0x01, 0xFE, 0x92, 0x01, 0x2E, 0x92, 0x01, 0x00, 0xFE, 0xFE, 0x92, 0x01, 0x46, 0x92, 0x01, 0xCA,
+	0xDA, 0x07, 0xFE, 0x92, 0x01, 0xFE, 0x92, 0x01, 0xFE, 0x92, 0x01, 0xFE, 0x92, 0x01, 0x2E, 0x92,
+	0x01, 0x04, 0x93, 0xDA, 0x2E, 0x38, 0x27, 0xE2, 0x68, 0x1F, 0x5A, 0x19, 0x2B, 0x00, 0x39, 0x9A,
+	0x20, 0x19, 0x10, 0xC9, 0xC8, 0x48, 0x3E, 0x25, 0x01, 0x05, 0x00, 0x2D, 0x01, 0x05, 0x00, 0x35,
+	0x0E, 0x10, 0x27, 0x1A, 0xF4, 0xE4, 0xFE, 0x48, 0x06, 0x82, 0x48, 0x06, 0x01, 0x71, 0x56, 0x7B,
+	0x00, 0xFE, 0xDA, 0x07, 0xDA, 0xDA, 0x07, 0x00, 0x94, 0xFE, 0x92, 0x01, 0x46, 0x92, 0x01, 0xCA,
+	0xDA, 0x07, 0x66, 0x17, 0x01, 0xFE, 0x92, 0x01, 0xFE, 0x92, 0x01, 0xFE, 0x92, 0x01, 0xC6, 0x92,
+	0x01, 0x00, 0x95, 0xFE, 0x92, 0x01, 0x46, 0x92, 0x01, 0xCA, 0xDA, 0x07, 0xFE, 0x92, 0x01, 0xFE,
+	0x92, 0x01, 0xFE, 0x92, 0x01, 0xFE, 0x92, 0x01, 0x2E, 0x92, 0x01, 0x00, 0x96, 0xFE, 0x92, 0x01,
+	0x46, 0x92, 0x01, 0xCA, 0xDA, 0x07, 0xFE, 0x92, 0x01, 0xFE, 0x92, 0x01, 0xFE, 0x92, 0x01, 0xFE,
+	0x92, 0x01, 0x2E, 0x92, 0x01, 0x00, 0x97, 0xFE, 0x92, 0x01, 0x46, 0x92, 0x01, 0xCA, 0xDA, 0x07,
+	0xFE, 0x92, 0x01, 0xFE, 0x92, 0x01, 0xFE, 0x92, 0x01, 0xFE, 0x92, 0x01, 0x39, 0x92, 0x08, 0x11,
+	0x08, 0x9B, 0x12, 0xC4, 0x9D, 0x00, 0xE9, 0x1A, 0x12, 0x2F, 0x20, 0xB3, 0x01, 0x0A, 0x94, 0x01,
+	0x0A, 0x36, 0x0A, 0x16, 0x12, 0xF0, 0x2E, 0x2C, 0x4E, 0x61, 0x6D, 0x65, 0x2D, 0x30, 0x2D, 0x73,
+	0x68, 0x61, 0x70, 0x65, 0x12, 0xBC, 0x51, 0x00, 0x12, 0x5A, 0x18, 0x00, 0x1A, 0x62, 0x55, 0x08,
+	0x03, 0x5A, 0x58, 0x86, 0xAC, 0xDE, 0xE1, 0xB6, 0x2E, 0x04, 0xDF, 0x96, 0xF8, 0xE4, 0x18, 0x50,
+	0x03, 0x5A, 0x18, 0x10, 0x01, 0x32, 0x52, 0xE5, 0x5C, 0x08, 0x11, 0x08, 0xB4, 0x7E, 0xC5, 0x00,
+	0x00, 0x31, 0x5A, 0xC5, 0x00, 0x2E, 0x18, 0x00, 0xFE, 0xC5, 0x00, 0xFE, 0xC5, 0x00, 0x00, 0xCD,
+	0x7E, 0xC5, 0x00, 0x00, 0x32, 0x5A, 0xC5, 0x00, 0x2E, 0x18, 0x00, 0xFE, 0xC5, 0x00, 0xFE, 0xC5,
+	0x00, 0x00, 0xE6, 0x7E, 0xC5, 0x00, 0x00, 0x33, 0x5A, 0xC5, 0x00, 0x2E, 0x18, 0x00, 0xFE, 0xC5,
+	0x00, 0xFE, 0xC5, 0x00, 0x00, 0xFF, 0x7E, 0xC5, 0x00, 0x00, 0x34, 0x5A, 0xC5, 0x00, 0x2E, 0x18,
+	0x00, 0xFE, 0xC5, 0x00, 0xFE, 0xC5, 0x00, 0x00, 0x98, 0x12, 0xF3, 0x80, 0x6A, 0xD9, 0x03, 0x00,
+	0x35, 0x5A, 0xC5, 0x00, 0x2E, 0x18, 0x00, 0xFE, 0xC5, 0x00, 0xF6, 0xC5, 0x00, 0x18, 0x39, 0x08,
+	0xA3, 0xD7, 0x69, 0x12, 0x33, 0x22, 0xB0, 0x33, 0x00, 0xE1, 0x86, 0xE0, 0x2B, 0x0C, 0x06, 0xB7,
+	0xD7, 0x69, 0x0E, 0xB3, 0x33, 0x28, 0x2A, 0x0A, 0x05, 0x54, 0x69, 0x74, 0x6C, 0x65, 0x12, 0x1B,
+	0x74, 0x16, 0xB1, 0x33, 0x24, 0x70, 0x61, 0x72, 0x61, 0x67, 0x72, 0x61, 0x70, 0x68, 0x73, 0x0E,
+	0xE8, 0xE3, 0x00, 0x2D, 0x05, 0x1D, 0x0D, 0xDE, 0x12, 0x77, 0x2D, 0x00, 0x01, 0x12, 0xB7, 0x33,
+	0x00, 0xF0, 0xFE, 0xB7, 0x33, 0xFE, 0xB7, 0x33, 0xCA, 0xB7, 0x33, 0x00, 0x74, 0x0E, 0xB7, 0x33,
+	0x00, 0x2C, 0x42, 0xB7, 0x33, 0x00, 0x01, 0xA2, 0xB7, 0x33, 0x00, 0x80, 0x7E, 0xB7, 0x33, 0x18,
+	0xD2, 0x02, 0x04, 0x08, 0xB7, 0xD7, 0x69, 0x2E, 0xBB, 0x33, 0x0C, 0x11, 0x08, 0x9A, 0xD7, 0x0E,
+	0x53, 0x83, 0x00, 0xE7, 0xCD, 0x39, 0x34, 0xD1, 0x02, 0x0A, 0x27, 0x0A, 0x06, 0x42, 0x75, 0x6C,
+	0x6C, 0x65, 0x74, 0x12, 0x17, 0x25, 0x74, 0x14, 0x31, 0x2D, 0x6C, 0x69, 0x73, 0x74, 0x29, 0x6F,
+	0x09, 0x19, 0x2D, 0x70, 0x08, 0x07, 0x58, 0x02, 0x3E, 0x02, 0x00, 0x10, 0x65, 0x5D, 0x74, 0x51,
+	0x3F, 0x9E, 0x05, 0x00, 0x00, 0x6D, 0x0E, 0x82, 0x34, 0x20, 0x6D, 0x00, 0x00, 0x10, 0x41, 0x6D,
+	0x00, 0x00, 0x90, 0x01, 0x05, 0x00, 0xD8, 0x01, 0x05, 0x14, 0x10, 0x42, 0x6D, 0x00, 0x00, 0x34,
+	0x01, 0x05, 0x00, 0x58, 0x01, 0x05, 0x00, 0x7C, 0x01, 0x05, 0x10, 0x90, 0x42, 0x72, 0x0C, 0x0D,
+	0xC1, 0x72, 0x12, 0xB1, 0x34, 0x04, 0x18, 0x01, 0x19, 0x0E, 0x04, 0x80, 0xBF, 0xFE, 0x0E, 0x00,
+	0x8E, 0x0E, 0x00, 0x14, 0x82, 0x01, 0x03, 0xE2, 0x80, 0xA2, 0xBE, 0x06, 0x00, 0x16, 0xF1, 0x35,
+	0x0C, 0x39, 0x08, 0xB0, 0xDC, 0x41, 0xFE, 0x00, 0xEA, 0x2D, 0x63, 0x20, 0xE8, 0x02, 0x22, 0x09,
+	0x0A, 0x05, 0x0A, 0x03, 0x01, 0x12, 0xAF, 0x36, 0x0D, 0x0B, 0x0E, 0xB0, 0x36, 0x00, 0x0B, 0x09,
+	0x16, 0x2A, 0xB1, 0x36, 0x24, 0xDF, 0x02, 0x0A, 0x2B, 0x0A, 0x0D, 0x54, 0x4F, 0x43, 0x20, 0x0E,
+	0x4B, 0x37, 0x18, 0x69, 0x6E, 0x67, 0x20, 0x31, 0x12, 0x14, 0x2D, 0x95, 0x1C, 0x74, 0x6F, 0x63,
+	0x65, 0x6E, 0x74, 0x72, 0x79, 0x25, 0x99, 0x2D, 0x92, 0x08, 0x3A, 0x5A, 0xB5, 0x1E, 0xE9, 0x2E,
+	0x08, 0x60, 0x41, 0x2A, 0x36, 0xF4, 0xD6, 0xFE, 0xE2, 0x2E, 0xFE, 0xE2, 0x2E, 0x76, 0xE2, 0x2E,
+	0x00, 0x76, 0x41, 0xFD, 0xEE, 0xB4, 0x36, 0x16, 0xB4, 0x36, 0x30, 0x41, 0xCA, 0x01, 0x09, 0x0A,
+	0x07, 0x0D, 0x75, 0xF2, 0xF0, 0x43, 0x10, 0x02, 0x5A, 0xBD, 0x36, 0x2E, 0xFF, 0x02, 0x20, 0x12,
+	0x04, 0x08, 0x01, 0x18, 0x01, 0x39, 0x08, 0xAE, 0x32, 0xA0, 0x04, 0x00, 0xE4, 0xA6, 0xA0, 0x04,
+	0x08, 0x31, 0x0A, 0x07, 0x2D, 0x9B, 0x04, 0x12, 0x20, 0x29, 0x99, 0x00, 0x31, 0x3E, 0xA3, 0x04,
+	0x0D, 0x20, 0x04, 0x20, 0x31, 0x2D, 0xA5, 0x9D, 0xA7, 0x00, 0x90, 0xFE, 0xA7, 0x04, 0xFE, 0xA7,
+	0x04, 0xCA, 0xA7, 0x04, 0x12, 0x5E, 0x38, 0xEE, 0xA7, 0x04, 0x3A, 0x5E, 0x38, 0x0C, 0x00, 0xE0,
+	0x01, 0x02, 0x26, 0x5A, 0x38, 0x2E, 0xA3, 0x04, 0x0E, 0x9E, 0xD9, 0x14, 0xF0, 0x02, 0x00, 0x39,
+	0x08, 0xAF, 0x32, 0x9E, 0x01, 0x00, 0xE6, 0xA6, 0x9E, 0x01, 0x08, 0x33, 0x0A, 0x09, 0x31, 0x7E,
+	0x00, 0x32, 0x31, 0xA0, 0x00, 0x32, 0x5E, 0xA0, 0x01, 0x00, 0x32, 0x46, 0xA0, 0x01, 0x00, 0x80,
+	0xFE, 0xA0, 0x01, 0xFE, 0xA0, 0x01, 0xFE, 0xA0, 0x01, 0x6E, 0xA0, 0x01, 0x18, 0x40, 0xC0, 0x15,
+	0x00, 0x00, 0x40, 0xC0, 0x7E, 0xFE, 0x39, 0x00, 0x01, 0x56, 0xA0, 0x01, 0x26, 0x9E, 0x1A, 0x08,
+	0x39, 0x08, 0xB0, 0x32, 0xA0, 0x01, 0x04, 0xBD, 0x03, 0x1A, 0x84, 0x3B, 0x66, 0x8E, 0x3B, 0xF1,
+	0xDE, 0x3D, 0xA0, 0x00, 0x33, 0x31, 0xA0, 0x00, 0x33, 0x5E, 0xA0, 0x01, 0x00, 0x33, 0x35, 0xA0,
+	0xFE, 0xE5, 0x04, 0x82, 0xE5, 0x04, 0x0C, 0x0A, 0xD7, 0xA3, 0x3C, 0xFE, 0x99, 0x3B, 0x4A, 0x99,
+	0x3B, 0x04, 0xCB, 0x01, 0x81, 0xE6, 0x62, 0x3C, 0x03, 0x24, 0x05, 0x15, 0x9A, 0x99, 0x99, 0x3F,
+	0x70, 0x00, 0x78, 0x01, 0x16, 0x9F, 0x3B, 0x5E, 0xA1, 0x01, 0x00, 0x40, 0xE1, 0xE8, 0x04, 0x90,
+	0x41, 0x1E, 0x9F, 0x3B, 0x61, 0x41, 0x00, 0x82, 0x1A, 0x6C, 0xDC, 0x30, 0xA1, 0xB8, 0xA2, 0x3E,
+	0x25, 0xA4, 0xBC, 0xA2, 0x3E, 0x2D, 0xA0, 0xB4, 0xA2, 0x32, 0x5A, 0x15, 0xE1, 0x39, 0x32, 0xB0,
+	0x0D, 0x96, 0xB4, 0xEC, 0x1A, 0xF1, 0x3B, 0x75, 0x97, 0x29, 0xF7, 0x00, 0x01, 0x65, 0x97, 0x00,
+	0xB1, 0x32, 0xF7, 0x01, 0x00, 0xE8, 0xA6, 0x97, 0x03, 0x08, 0x35, 0x0A, 0x0B, 0x71, 0x97, 0x08,
+	0x52, 0x65, 0x64, 0x31, 0xF9, 0x00, 0x34, 0x5E, 0xF9, 0x01, 0x00, 0x34, 0x35, 0xF9, 0x04, 0xBA,
+	0x01, 0x1A, 0xE0, 0x09, 0x6A, 0x99, 0x03, 0x34, 0xC7, 0x9F, 0x6E, 0x3F, 0x25, 0xBE, 0x10, 0x0A,
+	0x3E, 0x2D, 0x86, 0xB0, 0x3E, 0x3D, 0xFE, 0x5D, 0x16, 0xB2, 0x5D, 0x16, 0x66, 0x7B, 0x00, 0x22,
+	0x5D, 0x16, 0x62, 0xFD, 0x01, 0x2A, 0x97, 0x3D, 0x5E, 0xF8, 0x01, 0x3A, 0x39, 0x05, 0x00, 0x01,
+	0x32, 0x93, 0x3D, 0x3A, 0xA2, 0x01, 0xA1, 0x39, 0x08, 0x11, 0x08, 0x9B, 0x32, 0xDC, 0x09, 0x14,
+	0xD9, 0x02, 0x0A, 0x2F, 0x0A, 0x0A, 0x16, 0xC3, 0x09, 0x0C, 0x20, 0x42, 0x69, 0x67, 0x1A, 0x54,
+	0x0B, 0x00, 0x32, 0x42, 0xE0, 0x09, 0x01, 0x1D, 0x2D, 0x74, 0x4E, 0xE4, 0x09, 0x0C, 0xE9, 0xA2,
+	0x8B, 0x3F, 0x9E, 0x05, 0x00, 0x1E, 0xE4, 0x09, 0x00, 0x40, 0x0E, 0xDA, 0x09, 0x00, 0xC0, 0x01,
+	0x05, 0x12, 0xDF, 0x09, 0x00, 0x40, 0x0E, 0xD5, 0x09, 0x00, 0x70, 0x01, 0x05, 0x00, 0x90, 0x01,
+	0x05, 0x00, 0xA8, 0x01, 0x05, 0x00, 0xC0, 0x0E, 0xE4, 0x09, 0x61, 0x02, 0x41, 0xAB, 0x16, 0xE4,
+	0x09, 0xFE, 0x0E, 0x00, 0xB2, 0x0E, 0x00, 0xBE, 0xDE, 0x09, 0x09, 0x30, 0x1E, 0xE4, 0x09, 0x00,
+	0xB1, 0xFE, 0xE4, 0x09, 0x26, 0xE4, 0x09, 0x00, 0x32, 0x1A, 0xE4, 0x09, 0x00, 0x32, 0xFE, 0xE4,
+	0x09, 0xFE, 0xE4, 0x09, 0xFE, 0xE4, 0x09, 0xA6, 0xE4, 0x09, 0x04, 0x40, 0x41, 0x2E, 0x01, 0x03,
+	0x00, 0x00, 0x72, 0x98, 0x40, 0xD6, 0xE4, 0x09, 0x0C, 0x36, 0x08, 0xBD, 0xD7, 0x2E, 0xFC, 0x1A,
+	0x00, 0xEB, 0x86, 0xAF, 0x04, 0x12, 0x34, 0x42, 0x24, 0x31, 0x0A, 0x07, 0x43, 0x61, 0x70, 0x74,
+	0x69, 0x6F, 0x6E, 0x8D, 0xA8, 0x04, 0x32, 0x36, 0x3E, 0xA8, 0x04, 0x0D, 0x20, 0xDD, 0xA1, 0x20,
+	0xBA, 0x01, 0x08, 0x01, 0x10, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x1E, 0x0A, 0x00, 0x94, 0x52, 0x7C,
+	0x20, 0x41, 0x2A, 0x12, 0x48, 0x65, 0x6C, 0x76, 0x65, 0x74, 0x69, 0x63, 0x61, 0x4E, 0x65, 0x75,
+	0x65, 0x2D, 0x42, 0x6F, 0x6C, 0x64, 0x3A, 0x1D, 0x08, 0x01, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x25,
+	0x01, 0x05, 0x00, 0x2D, 0x01, 0x05, 0x1C, 0x35, 0x00, 0x00, 0x80, 0x3F, 0x60, 0x01, 0x6D, 0x01,
+	0x07, 0x28, 0x40, 0x01, 0x50, 0x00, 0x58, 0x00, 0x60, 0x00, 0x68, 0x01, 0x75, 0x01, 0x1B, 0x00,
+	0x7D, 0x01, 0x05, 0x28, 0x80, 0x01, 0x01, 0xA0, 0x01, 0x01, 0xB0, 0x01, 0x01, 0xC5, 0x01, 0x01,
+	0x23, 0x10, 0xC8, 0x01, 0x01, 0xDD, 0x01, 0x01, 0x18, 0x0C, 0xE0, 0x01, 0x01, 0xF5, 0x05, 0x12,
+	0x2C, 0xF8, 0x01, 0x00, 0x80, 0x02, 0x00, 0x88, 0x02, 0x01, 0x98, 0x02, 0xFF, 0x11, 0x01, 0x4C,
+	0x01, 0xA0, 0x02, 0x01, 0xB0, 0x02, 0x01, 0xC0, 0x02, 0x00, 0xC8, 0x02, 0x00, 0xD8, 0x02, 0x01,
+	0xF2, 0x02, 0x1F, 0x0A, 0x76, 0x7B, 0x00, 0x44, 0xF8, 0x02, 0x00, 0x62, 0x77, 0x08, 0x04, 0x1A,
+	0x01, 0x2C, 0x25, 0x00, 0x00, 0x10, 0x42, 0x28, 0x01, 0x3D, 0x01, 0x65, 0x18, 0x40, 0x01, 0x48,
+	0x00, 0x50, 0x00, 0x5D, 0x01, 0x0B, 0x24, 0x6A, 0x00, 0x70, 0x00, 0x78, 0x00, 0x8A, 0x01, 0x0A,
+	0x0D, 0x01, 0x0E, 0x00, 0x15, 0x01, 0x05, 0x00, 0x95, 0x05, 0x80, 0x00, 0x9D, 0x05, 0x8F, 0x00,
+	0xA5, 0x05, 0x06, 0x00, 0xAD, 0x05, 0x06, 0x38, 0xCA, 0x01, 0x07, 0x0A, 0x05, 0x0D, 0xFF, 0xFF,
+	0x65, 0x42, 0xD0, 0x01, 0x01, 0xD8, 0x01, 0x01, 0x95, 0xE0, 0x0F, 0xE0, 0x01, 0x00, 0xF8, 0x01,
+	0x01, 0xC2, 0x02, 0x04, 0x08, 0x99, 0xD7, 0x69, 0xC8, 0x02, 0x01, 0xD8, 0x02, 0x00, 0xE0, 0x02,
+	0x00, 0xE8, 0x02, 0x00, 0xF0, 0x02, 0x00, 0x36, 0x08, 0xC0, 0xD7, 0x69, 0x12, 0x30, 0x08, 0xE6,
+	0x0F, 0x12, 0x03, 0x01, 0x00, 0x05, 0x18, 0xF6, 0x02, 0x22, 0x08, 0x0A, 0x04, 0x0A, 0x02, 0x0B,
+	0x2B, 0x18, 0x01, 0x0D, 0x0A, 0x10, 0x2F, 0x18, 0x01, 0x22, 0x0A, 0x05, 0x14, 0xD8, 0x2E, 0x10,
+	0x03, 0x18, 0x01, 0x2A, 0x03, 0x99, 0xD7, 0x69, 0x0A, 0x3F, 0x0A, 0x0F, 0x48, 0x65, 0x61, 0x64,
+	0x65, 0x72, 0x20, 0x26, 0x20, 0x46, 0x6F, 0x6F, 0x74, 0x65, 0x72, 0x12, 0x26, 0x74, 0x65, 0x78,
+	0x74, 0x2D, 0x32, 0x39, 0x2D, 0x70, 0x61, 0x72, 0x61, 0x67, 0x72, 0x61, 0x70, 0x68, 0x73, 0x74,
+	0x79, 0x6C, 0x65, 0x2D, 0x48, 0x36, 0x28, 0x00, 0x54, 0x2A, 0x04, 0x08, 0x85, 0xE0, 0x69, 0x50,
+	0x39, 0x5A, 0xB5, 0x01, 0x08, 0x00, 0x10, 0x00, 0x1D, 0x00, 0x00, 0x40, 0x41, 0x2A, 0x0D, 0x32,
+	0xB0, 0x01, 0x9E, 0xAB, 0x01, 0x00, 0x00, 0xFE, 0xAB, 0x01, 0xD2, 0xAB, 0x01, 0x00, 0x79, 0xFE,
+	0xAB, 0x01, 0x35, 0xAB, 0x24, 0x09, 0x0A, 0x07, 0x0D, 0x00, 0x80, 0xE1, 0x43, 0x10, 0x02, 0x96,
+	0xAD, 0x01, 0x24, 0x1C, 0x08, 0x9C, 0xD7, 0x69, 0x12, 0x16, 0x08, 0xE7, 0x0F, 0x29, 0xAD, 0x10,
+	0xD5, 0x02, 0x32, 0x09, 0x17, 0x11, 0x01, 0x28, 0x0A, 0x25, 0x0A, 0x05, 0x49, 0x6D, 0x61, 0x67,
+	0x65, 0x12, 0x16, 0x25, 0x89, 0x18, 0x33, 0x2D, 0x6C, 0x69, 0x73, 0x74, 0x73, 0x25, 0x83, 0x05,
+	0x18, 0x2D, 0x79, 0x08, 0x06, 0x58, 0x01, 0x3E, 0x02, 0x00, 0x00, 0x65, 0x41, 0xDE, 0x9E, 0x05,
+	0x00, 0x00, 0x6D, 0x41, 0x7F, 0x00, 0x6D, 0x21, 0xB6, 0x0C, 0x6D, 0x00, 0x00, 0xC0, 0x01, 0x05,
+	0x04, 0x10, 0x42, 0x01, 0x0F, 0x01, 0x05, 0x00, 0x70, 0x01, 0x05, 0x00, 0x90, 0x01, 0x05, 0x00,
+	0xA8, 0x01, 0x05, 0x0C, 0xC0, 0x42, 0x72, 0x0C, 0x41, 0xB3, 0x00, 0x3F, 0x41, 0xB3, 0x08, 0x80,
+	0x18, 0x01, 0xFE, 0x0E, 0x00, 0xBE, 0x0E, 0x00, 0x18, 0x8A, 0x01, 0x04, 0x1A, 0x02, 0x08, 0x17,
+	0xDE, 0x07, 0x00, 0x2C, 0xA0, 0x01, 0x01, 0x39, 0x08, 0xB2, 0xDC, 0x69, 0x12, 0x33, 0x08, 0xEA,
+	0x2D, 0x72, 0x20, 0xE8, 0x02, 0x22, 0x09, 0x0A, 0x05, 0x0A, 0x03, 0x01, 0x65, 0x20, 0x0D, 0x0B,
+	0x61, 0x21, 0x00, 0x0B, 0x09, 0x16, 0x7D, 0x22, 0x24, 0xDF, 0x02, 0x0A, 0x2B, 0x0A, 0x0D, 0x54,
+	0x4F, 0x43, 0x20, 0x61, 0x29, 0x18, 0x69, 0x6E, 0x67, 0x20, 0x33, 0x12, 0x14, 0x2D, 0x9A, 0x1C,
+	0x74, 0x6F, 0x63, 0x65, 0x6E, 0x74, 0x72, 0x79, 0x25, 0x9E, 0x2D, 0x98, 0x00, 0x3A, 0x79, 0x11,
+	0x00, 0x60, 0xFE, 0x11, 0x03, 0xFE, 0x11, 0x03, 0xB6, 0x11, 0x03, 0x00, 0x76, 0x61, 0x11, 0x00,
+	0x2E, 0x52, 0xBC, 0x04, 0x04, 0xC0, 0x41, 0xA6, 0xBC, 0x04, 0x04, 0x41, 0xCA, 0x65, 0x11, 0x08,
+	0x75, 0xF2, 0xF0, 0x66, 0x11, 0x03, 0x2E, 0xBB, 0x04, 0x20, 0x12, 0x04, 0x08, 0x01, 0x18, 0x01,
+	0x36, 0x08, 0xC2, 0x32, 0xC1, 0x04, 0x04, 0xE4, 0x02, 0x8D, 0xB7, 0x00, 0x2B, 0x76, 0xC1, 0x04,
+	0x08, 0x36, 0x0A, 0x08, 0x81, 0xB8, 0x14, 0x6E, 0x6F, 0x74, 0x65, 0x12, 0x24, 0x29, 0x97, 0x04,
+	0x31, 0x2D, 0x3A, 0xBA, 0x04, 0x11, 0x21, 0x10, 0x20, 0x54, 0x65, 0x78, 0x74, 0x2D, 0xA7, 0x9D,
+	0xB8, 0x00, 0x30, 0xFE, 0xA7, 0x01, 0xFE, 0xA7, 0x01, 0xB6, 0xA7, 0x01, 0x00, 0x70, 0x21, 0xA7,
+	0xFE, 0x63, 0x06, 0xC5, 0x63, 0x00, 0x00, 0x6E, 0xAF, 0x04, 0x00, 0x01, 0xDD, 0x5C, 0x00, 0xC5,
+	0x32, 0x9B, 0x01, 0x00, 0xE9, 0x9A, 0x9B, 0x01, 0x3C, 0x3B, 0x0A, 0x0D, 0x54, 0x61, 0x62, 0x6C,
+	0x65, 0x20, 0x54, 0x69, 0x74, 0x6C, 0x65, 0x20, 0x31, 0x31, 0xA0, 0x00, 0x34, 0x3E, 0xA0, 0x01,
+	0x32, 0x26, 0x00, 0x46, 0xA0, 0x01, 0xFE, 0x58, 0x06, 0xFE, 0x58, 0x06, 0xBA, 0x58, 0x06, 0x08,
+	0x70, 0x08, 0x02, 0xF2, 0x03, 0x08, 0x04, 0x80, 0x40, 0x0E, 0x03, 0x08, 0x08, 0x40, 0x41, 0xCA,
+	0x76, 0xA0, 0x01, 0x2E, 0xFC, 0x07, 0x00, 0xC6, 0x32, 0xA0, 0x01, 0x00, 0xEE, 0xBE, 0xA0, 0x01,
+	0x00, 0x53, 0xC1, 0x5D, 0x39, 0xA0, 0x00, 0x35, 0x56, 0xA0, 0x01, 0x0D, 0x26, 0x35, 0xA0, 0x0C,
+	0xBA, 0x01, 0x08, 0x01, 0xE5, 0xF8, 0xF6, 0xA8, 0x09, 0xFE, 0xFD, 0x07, 0xD6, 0xFD, 0x07, 0xFE,
+	0x45, 0x03, 0x9A, 0x45, 0x03, 0x2E, 0xA5, 0x01, 0x00, 0xC7, 0x32, 0xA5, 0x01, 0xC2, 0x45, 0x03,
+	0x29, 0x7F, 0x00, 0x32, 0x71, 0x45, 0x00, 0x36, 0x6E, 0xA5, 0x01, 0x00, 0x32, 0x35, 0xA5, 0x22,
+	0x9D, 0x09, 0x00, 0x20, 0xFE, 0xE5, 0x04, 0xFE, 0xE5, 0x04, 0xFE, 0xE5, 0x04, 0xFE, 0xE5, 0x04,
+	0x52, 0xE5, 0x04, 0x2E, 0xA0, 0x01, 0x00, 0xC8, 0x32, 0xA0, 0x01, 0xDA, 0x45, 0x03, 0x00, 0x33,
+	0x31, 0xA0, 0x00, 0x37, 0x6E, 0xA0, 0x01, 0x00, 0x33, 0x35, 0xA0, 0x8E, 0x45, 0x03, 0x10, 0x81,
+	0xFA, 0x7F, 0x3F, 0x25, 0x0E, 0xDB, 0x09, 0x10, 0x2D, 0x75, 0xF8, 0x7F, 0x3F, 0x52, 0xED, 0x0C,
+	0xFE, 0x45, 0x03, 0x5E, 0x45, 0x03, 0x66, 0x7B, 0x00, 0x0E, 0xED, 0x0C, 0x5A, 0x45, 0x03, 0x00,
+	0x01, 0xC6, 0xED, 0x0C, 0x72, 0x8A, 0x06, 0x2E, 0xA5, 0x01, 0x04, 0xC9, 0xD7, 0x2E, 0xE6, 0x0C,
+	0x00, 0xF0, 0xD6, 0xEA, 0x04, 0x00, 0x34, 0x31, 0xA5, 0x00, 0x38, 0x6E, 0xA5, 0x01, 0x00, 0x34,
+	0x35, 0xA5, 0x00, 0xBC, 0x1E, 0xE2, 0x0C, 0x0C, 0x20, 0x41, 0x2A, 0x14, 0x32, 0xE2, 0x0C, 0x18,
+	0x2D, 0x4D, 0x65, 0x64, 0x69, 0x75, 0x6D, 0xFE, 0xE9, 0x0C, 0xFE, 0xE9, 0x0C, 0x76, 0xE9, 0x0C,
+	0x52, 0xA7, 0x01, 0x00, 0x01, 0xCE, 0x94, 0x0E, 0xA2, 0xA7, 0x01, 0x00, 0xCA, 0xFE, 0xA7, 0x01,
+	0x21, 0xA7, 0x00, 0x35, 0x31, 0xA7, 0x42, 0x8B, 0x0E, 0x16, 0x31, 0x08, 0xA9, 0x12, 0x00, 0x35,
+	0xBA, 0xA7, 0x01, 0x10, 0x93, 0x92, 0x12, 0x3F, 0x25, 0x01, 0x05, 0x00, 0x2D, 0x01, 0x05, 0xFE,
+	0x4E, 0x03, 0xB2, 0x4E, 0x03, 0x01, 0x71, 0x56, 0x7B, 0x00, 0x32, 0x4E, 0x03, 0x00, 0x38, 0x2A,
+	0x3B, 0x10, 0xFE, 0xA7, 0x01, 0x46, 0xA7, 0x01, 0x26, 0xD8, 0x09, 0x18, 0x11, 0x08, 0x9D, 0xD7,
+	0x69, 0x12, 0x0B, 0x22, 0x87, 0x0E, 0x00, 0xC6, 0x0E, 0xEA, 0x0C, 0x28, 0x08, 0x4C, 0x65, 0x74,
+	0x74, 0x65, 0x72, 0x65, 0x64, 0x12, 0x19, 0x12, 0x4E, 0x0B, 0x00, 0x34, 0x2A, 0x7F, 0x0E, 0x11,
+	0x1B, 0x2D, 0x72, 0x08, 0x06, 0x58, 0x03, 0x3E, 0x02, 0x00, 0x10, 0x65, 0x5D, 0x74, 0xD1, 0x3F,
+	0x66, 0x05, 0x00, 0x00, 0x56, 0x32, 0x1E, 0x00, 0x1E, 0x82, 0x0E, 0x00, 0x90, 0x22, 0x7D, 0x0E,
+	0x00, 0x58, 0x0E, 0x6E, 0x0E, 0x12, 0x78, 0x0E, 0x00, 0xB4, 0x01, 0x0A, 0x00, 0xD8, 0x01, 0x05,
+	0x00, 0xFC, 0x01, 0x05, 0x04, 0x10, 0x43, 0x12, 0x74, 0x0E, 0x00, 0x80, 0x12, 0x82, 0x0E, 0x00,
+	0x00, 0x1A, 0x82, 0x0E, 0xFE, 0x0E, 0x00, 0xAA, 0x0E, 0x00, 0x04, 0x78, 0x09, 0x3E, 0x02, 0x00,
+	0x08, 0xC8, 0x01, 0x00, 0x5E, 0x03, 0x00, 0x08, 0x39, 0x08, 0xB3, 0xFE, 0x6D, 0x0E, 0x26, 0x6D,
+	0x0E, 0x00, 0x34, 0x1A, 0x6D, 0x0E, 0x00, 0x34, 0xFE, 0x6D, 0x0E, 0x26, 0x6D, 0x0E, 0x00, 0x02,
+	0x36, 0x29, 0x13, 0xFE, 0x3C, 0x06, 0x5E, 0x3C, 0x06, 0x0E, 0x60, 0x10, 0x3E, 0xA4, 0x13, 0x09,
+	0x7B, 0x41, 0xEE, 0x6A, 0x6D, 0x0E, 0x04, 0x10, 0x42, 0xFE, 0x6D, 0x0E, 0x86, 0x6D, 0x0E, 0x00,
+	0xCB, 0xFE, 0xA1, 0x04, 0x81, 0xA1, 0x00, 0x36, 0x8D, 0xA1, 0x04, 0x34, 0x30, 0x6E, 0x48, 0x06,
+	0x00, 0x36, 0x6D, 0x2F, 0x00, 0x39, 0x9A, 0x48, 0x06, 0x10, 0xC9, 0xC8, 0x48, 0x3E, 0x25, 0x01,
+	0x05, 0x00, 0x2D, 0x01, 0x05, 0xFE, 0xA1, 0x04, 0xB2, 0xA1, 0x04, 0x01, 0x71, 0x56, 0x7B, 0x00,
+	0x21, 0xB3, 0xD5, 0x48, 0xFE, 0xA1, 0x04, 0x9E, 0xA1, 0x04, 0x08, 0x36, 0x08, 0xCC, 0x32, 0xA7,
+	0x01, 0xDA, 0x34, 0x0B, 0x00, 0x37, 0x31, 0xA7, 0x42, 0x19, 0x10, 0x2E, 0x48, 0x06, 0x00, 0x37,
+	0x35, 0xA7, 0x00, 0xB5, 0x2A, 0xD9, 0x0C, 0x4A, 0xD1, 0x14, 0x66, 0x25, 0x01, 0x22, 0x7C, 0x16,
+	0xFE, 0x53, 0x03, 0x5E, 0x53, 0x03, 0x66, 0x7B, 0x00, 0x32, 0xA0, 0x01, 0xEE, 0x7C, 0x16, 0x12,
+	0x7C, 0x16, 0x72, 0xE8, 0x07, 0x2E, 0x41, 0x06, 0x00, 0x9E, 0x4A, 0x41, 0x06, 0x0C, 0x4E, 0x75,
+	0x6D, 0x62, 0xDD, 0x41, 0x00, 0x35, 0xDD, 0x41, 0x11, 0x1B, 0x2D, 0x6B, 0xC6, 0x41, 0x06, 0x36,
+	0x5F, 0x06, 0xFE, 0x41, 0x06, 0xFE, 0x41, 0x06, 0xAE, 0x41, 0x06, 0x00, 0x00, 0x3E, 0x02, 0x00,
+	0x5E, 0x3E, 0x06, 0x14, 0xC8, 0x01, 0x00, 0x11, 0x08, 0x9F, 0x32, 0x58, 0x01, 0x38, 0x80, 0x03,
+	0x0A, 0x29, 0x0A, 0x07, 0x48, 0x61, 0x72, 0x76, 0x61, 0x72, 0x64, 0x12, 0x18, 0xE5, 0x98, 0x00,
+	0x36, 0x3D, 0x57, 0x0D, 0x1A, 0x2D, 0x56, 0x00, 0x09, 0x3E, 0x95, 0x07, 0x00, 0x58, 0xFE, 0x97,
+	0x07, 0xFE, 0x97, 0x07, 0xFE, 0x97, 0x07, 0x66, 0x97, 0x07, 0x30, 0x03, 0x78, 0x09, 0x78, 0x00,
+	0x78, 0x0E, 0x78, 0x01, 0x78, 0x0D, 0x78, 0x08, 0x01, 0x06, 0x14, 0x82, 0x01, 0x03, 0xE2, 0x80,
+	0xA2, 0xBE, 0x06, 0x00, 0x16, 0x1E, 0x1A, 0x6A, 0x92, 0x01, 0x0C, 0x39, 0x08, 0xA9, 0xD7, 0x0E,
+	0x40, 0x16, 0x1E, 0x5F, 0x19, 0x00, 0xE2, 0x86, 0x79, 0x0C, 0x0C, 0x06, 0xB7, 0xD7, 0x69, 0x0E,
+	0x62, 0x19, 0x18, 0x30, 0x0A, 0x08, 0x53, 0x75, 0x62, 0x74, 0x0E, 0x03, 0x13, 0x04, 0x12, 0x1E,
+	0x2D, 0xBB, 0x3A, 0xA0, 0x14, 0x11, 0x20, 0x2D, 0xC1, 0x2A, 0x9B, 0x14, 0x00, 0xA0, 0xFE, 0xB6,
+	0x0F, 0xFE, 0xB6, 0x0F, 0xB6, 0xB6, 0x0F, 0x00, 0x74, 0x56, 0x9B, 0x14, 0x00, 0x01, 0xFE, 0x11,
+	0x0E, 0x26, 0x11, 0x0E, 0x14, 0xD2, 0x02, 0x04, 0x08, 0xB7, 0xD7, 0x32, 0x40, 0x16, 0x08, 0x11,
+	0x08, 0xA0, 0x32, 0x2E, 0x03, 0x2C, 0xB5, 0x02, 0x0A, 0x23, 0x0A, 0x04, 0x44, 0x61, 0x73, 0x68,
+	0x12, 0x15, 0x25, 0x70, 0x00, 0x37, 0x7D, 0x2B, 0x01, 0x17, 0x2D, 0x67, 0x08, 0x05, 0x58, 0x02,
+	0x3E, 0x02, 0x00, 0x10, 0x65, 0xE9, 0xA2, 0x8B, 0x3F, 0x9E, 0x05, 0x00, 0x91, 0x7E, 0x00, 0x40,
+	0x0E, 0xBF, 0x0A, 0x8A, 0x41, 0x19, 0x08, 0x9A, 0x99, 0x99, 0x12, 0xBF, 0x0A, 0x00, 0x40, 0x12,
+	0xBF, 0x0A, 0xFE, 0x0E, 0x00, 0xB2, 0x0E, 0x00, 0x0C, 0x82, 0x01, 0x01, 0x2D, 0x7E, 0x04, 0x00,
+	0x18, 0x15, 0x08, 0xA1, 0xD7, 0x69, 0x12, 0x0F, 0x22, 0x0E, 0x0C, 0x58, 0xFF, 0x02, 0x32, 0x02,
+	0x0E, 0x0E, 0x0A, 0x31, 0x0A, 0x0B, 0x4E, 0x6F, 0x74, 0x65, 0x20, 0x54, 0x61, 0x6B, 0x69, 0x6E,
+	0x67, 0x12, 0x1C, 0x25, 0x52, 0x00, 0x38, 0x3D, 0x52, 0x1D, 0x1E, 0x2D, 0x59, 0x00, 0x07, 0x3E,
+	0x57, 0x01, 0x04, 0x58, 0x02, 0x9E, 0x95, 0x1A, 0x05, 0x28, 0xFE, 0x59, 0x01, 0x29, 0x59, 0x16,
+	0x26, 0x0C, 0x56, 0x67, 0x01, 0xFE, 0x1C, 0x00, 0x15, 0x1C, 0x29, 0x55, 0x89, 0x73, 0x21, 0x63,
+	0x6E, 0x0A, 0x00, 0x16, 0xBF, 0x1A, 0x00, 0x0E, 0x15, 0x07, 0x0C, 0x02, 0x10, 0x01, 0x8A, 0x72,
+	0x05, 0x00, 0x30, 0xA0, 0x01, 0x01, 0x16, 0x08, 0xE7, 0xD7, 0x69, 0x12, 0x10, 0x08, 0xE9, 0x0F,
+	0x16, 0x2A, 0x1C, 0x2C, 0xEF, 0x01, 0x2A, 0x03, 0xB7, 0xD7, 0x69, 0x0A, 0xBE, 0x01, 0x0A, 0x1C,
+	0x16, 0x19, 0x0C, 0x28, 0x62, 0x6F, 0x78, 0x2D, 0x30, 0x2D, 0x73, 0x68, 0x61, 0x70, 0x65, 0x2E,
+	0x86, 0x1A, 0x1C, 0x0E, 0x5A, 0x9B, 0x01, 0x0A, 0x00, 0x12, 0x56, 0x7A, 0xB3, 0x1E, 0x00, 0x15,
+	0x0E, 0x57, 0x12, 0x08, 0x18, 0x00, 0x20, 0x0E, 0x48, 0x1F, 0x14, 0x80, 0x40, 0x32, 0x27, 0x08,
+	0x02, 0x0E, 0xE3, 0x1B, 0x04, 0x00, 0x18, 0x16, 0xB9, 0x0B, 0x12, 0xBE, 0x0B, 0x4E, 0x05, 0x00,
+	0x00, 0x1D, 0x01, 0x37, 0x04, 0x22, 0x34, 0x82, 0x5D, 0x00, 0x28, 0x80, 0x9D, 0x43, 0x1D, 0x00,
+	0x00, 0xA0, 0x40, 0x20, 0x01, 0x2D, 0x01, 0x32, 0x34, 0x30, 0x00, 0x38, 0x00, 0x2A, 0x00, 0x32,
+	0x00, 0x3A, 0x00, 0x50, 0x0E, 0x5A, 0x2A, 0x0E, 0x36, 0x1E, 0x30, 0x22, 0x04, 0x0A, 0x02, 0x08,
+	0x01, 0x32, 0x14, 0x0D, 0x00, 0x00, 0x80, 0x40, 0x01, 0x8D, 0x00, 0x40, 0x01, 0x5B, 0x00, 0x40,
+	0x0E, 0xEE, 0x12, 0x0C, 0x40, 0x38, 0x00, 0x52, 0x65, 0xEC, 0x10, 0x58, 0x00, 0x39, 0x08, 0xAF,
+	0x32, 0x51, 0x0D, 0x00, 0xE1, 0xA6, 0xBE, 0x1B, 0x38, 0xD8, 0x02, 0x0A, 0x24, 0x0A, 0x03, 0x54,
+	0x4F, 0x43, 0x12, 0x17, 0x74, 0x6F, 0x63, 0x2D, 0x12, 0xAE, 0x1B, 0x00, 0x2D, 0x25, 0x29, 0x18,
+	0x2D, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x1E, 0x10, 0x1A, 0xFE, 0xB7, 0x1B, 0xFE, 0xB7, 0x1B,
+	0xFE, 0xB7, 0x1B, 0x52, 0xB7, 0x1B, 0x00, 0x00, 0xAA, 0x73, 0x20, 0xD6, 0xB7, 0x1B, 0x24, 0x10,
+	0x08, 0x94, 0xE0, 0x69, 0x12, 0x0A, 0x08, 0xA8, 0x4E, 0x49, 0xA1, 0x30, 0x20, 0x0A, 0x1E, 0x12,
+	0x16, 0x64, 0x72, 0x6F, 0x70, 0x2D, 0x63, 0x61, 0x70, 0x4E, 0x69, 0x01, 0x0C, 0x10, 0x08, 0xA9,
+	0xDC, 0x2E, 0x31, 0x00, 0x10, 0x51, 0x0A, 0x17, 0x12, 0x0F, 0x01, 0x31, 0x19, 0x30, 0x00, 0x30,
+	0x8D, 0x48, 0x30, 0x01, 0x5A, 0x00, 0x62, 0x32, 0x0A, 0x30, 0x08, 0x00, 0x10, 0x03, 0x18, 0x00,
+	0x41, 0x3C, 0x08, 0x50, 0x01, 0x59, 0x0E, 0x55, 0x0E, 0x01, 0x01, 0x00, 0x61, 0x01, 0x05, 0x01,
+	0x01, 0x08, 0x69, 0x9A, 0x99, 0x01, 0x01, 0x08, 0xC9, 0x3F, 0x71, 0x09, 0x09, 0x20, 0xE9, 0x3F,
+	0x31, 0x08, 0xAA, 0xDC, 0x69, 0x12, 0x2B, 0x15, 0x93, 0x04, 0xBC, 0x01, 0x7E, 0x4A, 0x1C, 0x46,
+	0x83, 0x00, 0x1E, 0xE6, 0x18, 0x08, 0x0B, 0x5A, 0x6B, 0x0E, 0xE5, 0x18, 0x00, 0x2A, 0xC6, 0x88,
+	0x22, 0x1C, 0xA0, 0x01, 0x01, 0xC8, 0x01, 0x01, 0x88, 0x02, 0x0E, 0x47, 0x22, 0xA2, 0x3E, 0x22,
+	0x09, 0xEE, 0x08, 0x02, 0x18, 0x01, 0xAE, 0xEE, 0x00, 0x00, 0xAB, 0xEE, 0xEE, 0x00, 0x05, 0xEE,
+	0x1E, 0x2F, 0x18, 0xFE, 0xEE, 0x00, 0xD2, 0xEE, 0x00, 0x14, 0x04, 0x18, 0x00, 0x30, 0x01, 0x38,
+	0xA2, 0xDC, 0x01, 0x00, 0xAC, 0xEE, 0xEE, 0x00, 0x05, 0xEE, 0x1E, 0x7D, 0x17, 0xFE, 0xEE, 0x00,
+	0xD2, 0xEE, 0x00, 0x00, 0x03, 0xB6, 0xDC, 0x01, 0x00, 0xAD, 0xEE, 0xEE, 0x00, 0x05, 0xEE, 0x1E,
+	0xC6, 0x16, 0xFE, 0xEE, 0x00, 0xFE, 0xEE, 0x00, 0x05, 0xEE, 0x04, 0xE0, 0x3F, 0x72, 0xB8, 0x03,
+	0x00, 0xAE, 0x32, 0xEE, 0x00, 0x00, 0xB8, 0x82, 0x64, 0x0B, 0x46, 0xB8, 0x03, 0x1E, 0x0D, 0x16,
+	0x08, 0x0D, 0x5A, 0x6D, 0xC1, 0x5F, 0x6A, 0xAE, 0x17, 0x00, 0x05, 0x22, 0x55, 0x19, 0x00, 0x01,
+	0x3A, 0x55, 0x19, 0x5A, 0xBA, 0x03, 0x66, 0x31, 0x00, 0x0E, 0x7C, 0x0F, 0x04, 0xAB, 0x01, 0x9D,
+	0xA9, 0x00, 0x01, 0x96, 0xA9, 0x04, 0x00, 0x1A, 0xFE, 0x9E, 0x07, 0x5A, 0x9E, 0x07, 0x00, 0x2A,
+	0x7E, 0xA9, 0x26, 0x0C, 0x10, 0x08, 0xD5, 0xD7, 0xA1, 0x84, 0x00, 0xE5, 0x1A, 0x56, 0x08, 0x30,
+	0x18, 0x0A, 0x10, 0x0A, 0x08, 0x45, 0x6D, 0x70, 0x68, 0x61, 0x73, 0x69, 0x73, 0xB5, 0x7D, 0x14,
+	0x02, 0x08, 0x01, 0x10, 0x08, 0xD6, 0x32, 0x29, 0x00, 0x40, 0x1D, 0x0A, 0x15, 0x0A, 0x0D, 0x53,
+	0x74, 0x72, 0x69, 0x6B, 0x65, 0x74, 0x68, 0x72, 0x6F, 0x75, 0x67, 0x1E, 0x4C, 0x0B, 0x1C, 0x01,
+	0x5A, 0x02, 0x60, 0x01, 0x10, 0x08, 0xD7, 0x32, 0x2E, 0x00, 0x30, 0x19, 0x0A, 0x11, 0x0A, 0x09,
+	0x55, 0x6E, 0x64, 0x65, 0x72, 0x6C, 0x69, 0x6E, 0x1E, 0xDD, 0x0C, 0x1C, 0x01, 0x5A, 0x02, 0x58,
+	0x01, 0x10, 0x08, 0xD8, 0x32, 0x2A, 0x00, 0x28, 0x16, 0x0A, 0x0E, 0x0A, 0x06, 0x49, 0x74, 0x61,
+	0x6C, 0x69, 0x63, 0x19, 0x7F, 0x10, 0x10, 0x01, 0x1C, 0x08, 0xD9, 0x12, 0x28, 0x25, 0x11, 0xA8,
+	0x00, 0x59, 0x2E, 0xC0, 0x26, 0x01, 0xB4, 0x0C, 0x52, 0x65, 0x64, 0x20, 0x0E, 0x14, 0x28, 0x0D,
+	0x35, 0x10, 0x02, 0x5A, 0x43, 0x08, 0x01, 0x12, 0x8C, 0x19, 0x34, 0xEF, 0xEE, 0x6E, 0x3F, 0x25,
+	0x89, 0x88, 0x08, 0x3E, 0x2D, 0xC1, 0xC0, 0x40, 0x3D, 0x2E, 0x44, 0x13, 0x1E, 0xC7, 0x27, 0x66,
+	0x22, 0x00, 0x08, 0x1C, 0x08, 0xDA, 0x32, 0x76, 0x00, 0x00, 0x54, 0x32, 0x76, 0x00, 0x18, 0x0D,
+	0x0A, 0x05, 0x57, 0x68, 0x69, 0x74, 0x19, 0xCF, 0x00, 0x41, 0x05, 0x71, 0x0E, 0xDF, 0x08, 0x10,
+	0x25, 0xDB, 0xFB, 0x7F, 0x3F, 0x12, 0xE9, 0x08, 0x09, 0x71, 0x16, 0xED, 0x14, 0x11, 0x71, 0x66,
+	0x22, 0x00, 0x0C, 0x15, 0x08, 0xFF, 0xDF, 0x0E, 0x7A, 0x0B, 0x00, 0xE8, 0x2D, 0x8F, 0x6C, 0x16,
+	0x2A, 0x03, 0xB9, 0xDC, 0x69, 0x0A, 0x0E, 0x1A, 0x04, 0x08, 0xB9, 0xDC, 0x69, 0x20, 0x01, 0x2A,
+	0x04, 0x08, 0x85, 0xE0, 0x69, 0x50, 0x01, 0x5A, 0x02, 0x60, 0x00, 0x00, 0x49, 0x00, 0x00, 0x46,
+	0xF0, 0x45, 0x19, 0x08, 0x47, 0x12, 0x15, 0x08, 0x83, 0x56, 0x12, 0x03, 0x01, 0x00, 0x05, 0x18,
+	0x2C, 0x22, 0x09, 0x0A, 0x03, 0x0A, 0x01, 0x03, 0x10, 0x03, 0x18, 0x01, 0x08, 0x00, 0x1A, 0x28,
+	0x0A, 0x26, 0x0A, 0x14, 0xBC, 0x09, 0x54, 0x12, 0x34, 0x93, 0xF3, 0x84, 0x36, 0x27, 0x25, 0x4C,
+	0x48, 0xD2, 0x31, 0xDE, 0x44, 0x6A, 0x3E, 0x0E, 0x10, 0x01, 0x19, 0xD0, 0x5D, 0x04, 0x1E, 0x82,
+	0xE4, 0xD7, 0x41, 0x22, 0x03, 0x0A, 0x02, 0x03, 0x00, 0xB9, 0x41, 0x00, 0x97, 0xA5, 0x01, 0xF0,
+	0xB0, 0x20, 0x08, 0x02, 0x12, 0x1C, 0x08, 0xFE, 0x55, 0x12, 0x03, 0x01, 0x00, 0x05, 0x18, 0xEF,
+	0xA2, 0x01, 0x22, 0x09, 0x0A, 0x03, 0x0A, 0x01, 0x0A, 0x10, 0x01, 0x18, 0x01, 0x2A, 0x03, 0xB5,
+	0xE0, 0x69, 0x08, 0xB5, 0xE0, 0x69, 0x12, 0x28, 0x12, 0x24, 0x38, 0x42, 0x38, 0x39, 0x42, 0x43,
+	0x36, 0x38, 0x2D, 0x36, 0x34, 0x43, 0x30, 0x2D, 0x34, 0x38, 0x33, 0x39, 0x2D, 0x38, 0x46, 0x42,
+	0x32, 0x2D, 0x36, 0x43, 0x37, 0x42, 0x31, 0x31, 0x44, 0x31, 0x30, 0x30, 0x37, 0x32, 0x18, 0x00,
+	0x1A, 0x26, 0x08, 0x47, 0x12, 0x10, 0x44, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x4D, 0x65,
+	0x74, 0x61, 0x64, 0x61, 0x74, 0x61, 0x22, 0x03, 0x02, 0x00, 0x00, 0x2A, 0x03, 0x02, 0x00, 0x00,
+	0x50, 0x00, 0x60, 0xC3, 0x06, 0xA8, 0x01, 0x01, 0x1A, 0x41, 0x08, 0x82, 0xE0, 0x69, 0x12, 0x11,
+	0x43, 0x61, 0x6C, 0x63, 0x75, 0x6C, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x45, 0x6E, 0x67, 0x69, 0x6E,
+	0x65, 0x1A, 0x19, 0x43, 0x61, 0x6C, 0x63, 0x75, 0x6C, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x45, 0x6E,
+	0x67, 0x69, 0x6E, 0x65, 0x2D, 0x31, 0x37, 0x33, 0x32, 0x36, 0x31, 0x30, 0x22, 0x03, 0x02, 0x00,
+	0x00, 0x2A, 0x01, 0x4B, 0x54, 0x50, 0x00, 0x60, 0xC3, 0x06, 0x1A, 0x1E, 0x08, 0x9F, 0xE0, 0x69,
+	0x12, 0x09, 0x56, 0x69, 0x65, 0x77, 0x53, 0x74, 0x61, 0x74, 0x65, 0x3E, 0x20, 0x00, 0x7C, 0x4D,
+	0x08, 0x81, 0xE0, 0x69, 0x12, 0x17, 0x41, 0x6E, 0x6E, 0x6F, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E,
+	0x41, 0x75, 0x74, 0x68, 0x6F, 0x72, 0x53, 0x74, 0x6F, 0x72, 0x61, 0x67, 0x65, 0x1A, 0x1F, 0x5A,
+	0x19, 0x00, 0x04, 0x2D, 0x31, 0x01, 0x6F, 0x04, 0x30, 0x39, 0x3E, 0x4F, 0x00, 0x20, 0xB3, 0x6F,
+	0x08, 0x85, 0xE0, 0x69, 0x12, 0x12, 0x44, 0x0D, 0xDD, 0x24, 0x53, 0x74, 0x79, 0x6C, 0x65, 0x73,
+	0x68, 0x65, 0x65, 0x74, 0x19, 0x2A, 0xF0, 0x58, 0x3A, 0x0A, 0x08, 0x0E, 0x12, 0x06, 0x08, 0xA1,
+	0xD7, 0x69, 0x10, 0x02, 0x3A, 0x0A, 0x08, 0x17, 0x12, 0x06, 0x08, 0x9C, 0xD7, 0x69, 0x10, 0x09,
+	0x50, 0x00, 0x5A, 0x1A, 0x08, 0xDA, 0xD7, 0x69, 0x12, 0x14, 0x08, 0x97, 0xE9, 0x8F, 0xFB, 0xD5,
+	0x97, 0xC2, 0xA3, 0x17, 0x10, 0xA6, 0xF3, 0x9B, 0x91, 0xAA, 0xCA, 0x87, 0xA0, 0x6C, 0x5A, 0x1C,
+	0x08, 0xD9, 0xD7, 0x69, 0x12, 0x16, 0x08, 0xC8, 0xA8, 0xEC, 0xB9, 0xE7, 0x84, 0xDB, 0xA4, 0x9E,
+	0x01, 0x10, 0x9D, 0x85, 0xE0, 0xB4, 0xC7, 0x83, 0xDD, 0xAF, 0x9E, 0x01, 0x5A, 0x1A, 0x08, 0xD8,
+	0xD7, 0x01, 0x3A, 0x58, 0xA1, 0xE1, 0xA7, 0x9B, 0xDB, 0x8D, 0x8C, 0xA3, 0x75, 0x10, 0x9D, 0xBD,
+	0xD8, 0xDD, 0x93, 0xE9, 0xD8, 0x8F, 0x1C, 0x5A, 0x1A, 0x08, 0xD7, 0x05, 0x56, 0x58, 0xDE, 0x81,
+	0xDC, 0xE9, 0xE3, 0xD7, 0xAC, 0xA4, 0x29, 0x10, 0xBE, 0xF5, 0xB0, 0xCC, 0xF2, 0xC3, 0x84, 0xF6,
+	0x77, 0x5A, 0x1A, 0x08, 0xD6, 0x05, 0x1C, 0xD0, 0xE3, 0xFF, 0xC1, 0xE6, 0xC5, 0x80, 0xB4, 0xA5,
+	0x76, 0x10, 0x9C, 0xD7, 0xF5, 0x9C, 0x80, 0x9D, 0xE5, 0xAA, 0x76, 0x5A, 0x1B, 0x08, 0xD5, 0xD7,
+	0x69, 0x12, 0x15, 0x08, 0xB3, 0xD4, 0xDC, 0x83, 0x8B, 0x86, 0xB0, 0xA7, 0x32, 0x10, 0xA3, 0xC3,
+	0x83, 0xDB, 0xF1, 0x8D, 0x8E, 0xFB, 0xAC, 0x01, 0x5A, 0x1B, 0x08, 0xAE, 0xDC, 0x01, 0x1D, 0x60,
+	0xFF, 0xB4, 0xDE, 0x97, 0xA7, 0xC4, 0xC8, 0xA7, 0xB5, 0x01, 0x10, 0xB9, 0xEB, 0xB8, 0xD1, 0xDC,
+	0xEA, 0x89, 0x8E, 0x14, 0x5A, 0x1C, 0x08, 0xAD, 0xDC, 0x01, 0xAC, 0x4C, 0xEE, 0x9F, 0xAF, 0xCE,
+	0x92, 0xCD, 0xF4, 0xA7, 0xD1, 0x01, 0x10, 0x9E, 0xAD, 0xC8, 0xC4, 0xAA, 0xA1, 0x9B, 0x96, 0xE7,
+	0x01, 0x3B, 0x04, 0xAC, 0xDC, 0x01, 0x3B, 0x60, 0xAA, 0xB0, 0x8C, 0xB6, 0xF7, 0xEE, 0xC2, 0xA3,
+	0xFA, 0x01, 0x10, 0x86, 0xC9, 0x87, 0xE2, 0xF1, 0x8E, 0xD8, 0xA4, 0x7B, 0x5A, 0x1A, 0x08, 0xAB,
+	0xDC, 0x01, 0xC9, 0x58, 0xAC, 0xD4, 0xC3, 0xCC, 0xF2, 0xB5, 0xA6, 0xA6, 0x6B, 0x10, 0xA5, 0xB5,
+	0xF7, 0xB5, 0xD2, 0x9A, 0x8A, 0xD2, 0x3F, 0x5A, 0x1B, 0x08, 0xAA, 0x05, 0x39, 0x48, 0xF8, 0xCD,
+	0xC6, 0xF4, 0x80, 0xCF, 0xFF, 0xA5, 0x32, 0x10, 0xAC, 0x9B, 0xA2, 0xAD, 0xF9, 0xFA, 0xF5, 0xC1,
+	0x92, 0x01, 0x56, 0x00, 0xA9, 0x05, 0x1D, 0x5C, 0xFD, 0xD7, 0x9F, 0xFD, 0xB2, 0xCF, 0xF6, 0xA3,
+	0xD6, 0x01, 0x10, 0xB2, 0x9B, 0xAE, 0xCE, 0x87, 0x95, 0xB6, 0xE7, 0x0D, 0x5A, 0x1C, 0x08, 0xAF,
+	0x05, 0x91, 0x4C, 0xED, 0xC2, 0x85, 0x91, 0xE3, 0xDE, 0xD6, 0xA3, 0xEE, 0x01, 0x10, 0x90, 0xD5,
+	0xA1, 0x9C, 0xF4, 0x86, 0xC2, 0xDB, 0xAE, 0x01, 0x3B, 0x00, 0xE7, 0x05, 0xE9, 0x48, 0x93, 0xB9,
+	0x87, 0x83, 0x9F, 0xBA, 0xF1, 0xA4, 0x3E, 0x10, 0x8B, 0xC9, 0xC9, 0xBF, 0xFB, 0x83, 0xDD, 0xFA,
+	0x8B, 0x01, 0x1D, 0x00, 0xA1, 0x05, 0x1D, 0x48, 0xBB, 0xC2, 0x93, 0xC8, 0xF4, 0xD5, 0xA4, 0xA0,
+	0x12, 0x10, 0x91, 0xB5, 0x97, 0xC5, 0xED, 0xD3, 0xA0, 0xCE, 0xBB, 0x01, 0x1D, 0x00, 0xA0, 0x05,
+	0x1D, 0x48, 0xB3, 0x84, 0xE2, 0xAF, 0x9F, 0x8D, 0x89, 0xA4, 0x3D, 0x10, 0xB4, 0xCB, 0xEE, 0xEB,
+	0xFA, 0xF6, 0xFB, 0xD4, 0xD7, 0x21, 0x94, 0x00, 0xA9, 0x25, 0x5C, 0x58, 0xB0, 0xB9, 0xBE, 0xC5,
+	0x8E, 0xD6, 0xEF, 0xA7, 0x5F, 0x10, 0x97, 0xC9, 0xF0, 0xF8, 0x9B, 0xE4, 0xEB, 0xCA, 0x58, 0x5A,
+	0x1B, 0x08, 0x9F, 0x05, 0x39, 0x5C, 0xFB, 0x8B, 0x98, 0xC9, 0xE2, 0xE2, 0xA1, 0xA4, 0x95, 0x01,
+	0x10, 0x8B, 0xF1, 0x9B, 0xB3, 0xAA, 0xAA, 0x8B, 0xC1, 0x67, 0x5A, 0x1B, 0x08, 0x9E, 0x05, 0x1D,
+	0x48, 0xCF, 0xF6, 0xB6, 0x88, 0xB8, 0xCD, 0xB6, 0xA0, 0x48, 0x10, 0xB4, 0x8B, 0xA6, 0xEF, 0x9D,
+	0xB7, 0xCC, 0xF3, 0x9A, 0x01, 0x56, 0x00, 0xCC, 0x05, 0x56, 0x58, 0xF5, 0xB7, 0xC6, 0x9E, 0xB5,
+	0xF0, 0xB4, 0xA4, 0x32, 0x10, 0x8D, 0xF3, 0xEF, 0x96, 0xB0, 0xD4, 0xB4, 0x87, 0x59, 0x5A, 0x1B,
+	0x08, 0xCB, 0x05, 0x39, 0x5C, 0xF5, 0xF2, 0xD5, 0xB0, 0x86, 0xA5, 0x98, 0xA3, 0xC8, 0x01, 0x10,
+	0x93, 0x9D, 0xEB, 0x82, 0xC8, 0x85, 0xA8, 0x9F, 0x06, 0x5A, 0x1C, 0x08, 0xB3, 0x25, 0x04, 0x4C,
+	0xEB, 0xE2, 0x97, 0xFA, 0x95, 0x9D, 0xFF, 0xA7, 0x98, 0x01, 0x10, 0xA0, 0xC7, 0x8D, 0xD9, 0xA7,
+	0xEF, 0xF4, 0x99, 0xB4, 0x01, 0xCA, 0x00, 0x9D, 0x05, 0x3B, 0x5C, 0xAA, 0xFB, 0xA8, 0x88, 0xE8,
+	0xA6, 0xAB, 0xA7, 0xAC, 0x01, 0x10, 0xBE, 0xA9, 0xA5, 0x93, 0xE5, 0x9D, 0x89, 0xA9, 0x5D, 0x5A,
+	0x1B, 0x08, 0xCA, 0x05, 0x1D, 0x5C, 0xC0, 0xA9, 0xA3, 0x9E, 0xBB, 0xF0, 0xF3, 0xA4, 0xA1, 0x01,
+	0x10, 0xAB, 0xC9, 0xCD, 0xC8, 0x8B, 0xB6, 0x89, 0xBA, 0x66, 0x5A, 0x1A, 0x08, 0xC9, 0x05, 0x91,
+	0x58, 0xEE, 0xE2, 0xEB, 0xBB, 0xCC, 0xD1, 0xD3, 0xA7, 0x32, 0x10, 0xBA, 0xC7, 0xE3, 0x9E, 0xC1,
+	0xFD, 0xB5, 0x99, 0x4E, 0x5A, 0x1A, 0x08, 0xC8, 0x05, 0x1C, 0x58, 0xA2, 0xA8, 0xE0, 0xDA, 0x81,
+	0xAB, 0xF0, 0xA0, 0x3A, 0x10, 0x8C, 0xD5, 0xDA, 0x89, 0xA8, 0xB6, 0xA1, 0x88, 0x1C, 0x5A, 0x1B,
+	0x08, 0xC7, 0x05, 0x55, 0x60, 0xBB, 0xB9, 0xB9, 0xD1, 0x94, 0xF7, 0xC2, 0xA1, 0xD2, 0x01, 0x10,
+	0xAE, 0xEF, 0xFC, 0xDB, 0xD2, 0xE0, 0x92, 0x98, 0x46, 0x5A, 0x1C, 0x08, 0xC6, 0xD7, 0x41, 0x42,
+	0x4C, 0x84, 0xCA, 0xE1, 0xFB, 0xD7, 0xF9, 0xC5, 0xA3, 0x99, 0x01, 0x10, 0xB2, 0xE7, 0xC4, 0xAA,
+	0xB9, 0xE9, 0x9F, 0xCC, 0xC6, 0x01, 0xAD, 0x00, 0xC5, 0x05, 0x3B, 0x48, 0xFE, 0xB4, 0x8F, 0xC8,
+	0xE6, 0xDD, 0x91, 0xA1, 0x63, 0x10, 0xAB, 0xF5, 0xC1, 0xD0, 0xC6, 0xC5, 0xD1, 0xB3, 0x8A, 0x01,
+	0x1D, 0x00, 0xC2, 0x05, 0x1D, 0x48, 0xAB, 0xCA, 0xFD, 0x8B, 0xE8, 0xAE, 0xBA, 0xA1, 0x1B, 0x10,
+	0x8D, 0x81, 0xF6, 0xEC, 0xC7, 0xED, 0xF8, 0xB5, 0xB8, 0x01, 0x1D, 0x00, 0xB2, 0x45, 0x26, 0x54,
+	0xE2, 0xF3, 0x86, 0xBA, 0xCC, 0xAD, 0x9C, 0xA5, 0xD3, 0x01, 0x10, 0xB9, 0xD7, 0xF5, 0xAC, 0x91,
+	0x8F, 0xE0, 0xB9, 0x76, 0x5A, 0x1A, 0x61, 0x89, 0x64, 0x12, 0x14, 0x08, 0x85, 0x95, 0xE6, 0x81,
+	0x92, 0xDC, 0x99, 0xA1, 0x65, 0x10, 0xAC, 0xF3, 0xC4, 0x8C, 0xE8, 0xD9, 0xFD, 0xF9, 0x67, 0x5A,
+	0x1C, 0x08, 0xC0, 0x05, 0x91, 0x4C, 0xB7, 0xD4, 0x9B, 0xEC, 0xDB, 0xCC, 0xEB, 0xA2, 0xDC, 0x01,
+	0x10, 0x9B, 0x8F, 0xAC, 0xF8, 0x9F, 0x82, 0xB2, 0x98, 0x9C, 0x01, 0x57, 0x00, 0xBD, 0x05, 0x74,
+	0x5C, 0xE0, 0xA6, 0xD8, 0x9F, 0xCF, 0x8C, 0xDA, 0xA4, 0xD4, 0x01, 0x10, 0x94, 0x89, 0xA2, 0x81,
+	0xC9, 0x8A, 0x95, 0xE5, 0x2D, 0x5A, 0x1A, 0x08, 0xB1, 0x45, 0xD3, 0x58, 0x87, 0x8B, 0xB2, 0xF0,
+	0xB2, 0xA1, 0xD8, 0xA4, 0x1C, 0x10, 0x9A, 0x9D, 0xB8, 0xCE, 0xB9, 0xFD, 0xFF, 0xEB, 0x69, 0x5A,
+	0x1B, 0x08, 0x9B, 0x05, 0x39, 0x5C, 0xC3, 0xAE, 0xE2, 0xF0, 0x8B, 0xE9, 0xBD, 0xA6, 0x83, 0x01,
+	0x10, 0xA4, 0xFF, 0xE0, 0xA3, 0xE2, 0xFF, 0x88, 0xBE, 0x11, 0x5A, 0x1B, 0x08, 0xB1, 0x05, 0x1D,
+	0x5C, 0xEC, 0xF8, 0xF4, 0xD8, 0xCC, 0x93, 0xAF, 0xA0, 0xD7, 0x01, 0x10, 0x87, 0xCD, 0xDA, 0xD7,
+	0xA9, 0xEA, 0xBE, 0xD2, 0x14, 0x5A, 0x1A, 0x08, 0xB0, 0x25, 0x5B, 0x58, 0xBB, 0xBF, 0x8F, 0xD8,
+	0xE1, 0xB2, 0xB6, 0xA5, 0x23, 0x10, 0x9F, 0xA9, 0xA9, 0xFD, 0x88, 0xB9, 0xF2, 0xCA, 0x50, 0x5A,
+	0x1A, 0x08, 0xAF, 0x05, 0x1C, 0x58, 0xF3, 0x97, 0x97, 0x94, 0xF2, 0x8B, 0x86, 0xA4, 0x28, 0x10,
+	0x82, 0xCF, 0xA8, 0x88, 0x91, 0xA2, 0xA8, 0xDD, 0x32, 0x5A, 0x1A, 0x08, 0xAE, 0x05, 0x1C, 0x48,
+	0xA7, 0xBC, 0xC3, 0x8E, 0xE2, 0xFE, 0xD1, 0xA3, 0x49, 0x10, 0x99, 0xDB, 0x85, 0xC2, 0x8F, 0x9B,
+	0xAE, 0x9E, 0x41, 0x01, 0x54, 0x05, 0xAA, 0x58, 0x8D, 0xAE, 0xC4, 0x8A, 0xA4, 0x86, 0xB8, 0xA2,
+	0x14, 0x10, 0xAC, 0xC9, 0xB4, 0x8E, 0x8B, 0xE2, 0xA0, 0xB5, 0x5D, 0x5A, 0x1A, 0x08, 0x9A, 0x05,
+	0x38, 0x58, 0xC1, 0xB7, 0xF8, 0xF1, 0xA0, 0xCA, 0xF3, 0xA0, 0x65, 0x10, 0x90, 0xCF, 0x86, 0xE8,
+	0xE0, 0x99, 0xFE, 0x84, 0x5D, 0x5A, 0x1C, 0x08, 0xA3, 0x25, 0x1D, 0x64, 0xD5, 0xB7, 0xE2, 0xF5,
+	0xDF, 0xFF, 0xC9, 0xA5, 0x9B, 0x01, 0x10, 0xBD, 0xDD, 0x8E, 0xC2, 0xAA, 0x97, 0xDB, 0xAA, 0xE8,
+	0x01, 0x5A, 0x1C, 0x08, 0x98, 0xDA, 0x21, 0xCC, 0x4C, 0xCA, 0xF8, 0xB3, 0x84, 0xB7, 0x8F, 0x87,
+	0xA5, 0x89, 0x01, 0x10, 0x8B, 0x93, 0xFA, 0x82, 0x8E, 0x8C, 0x96, 0xF7, 0xC8, 0x21, 0x3B, 0x04,
+	0xE6, 0xD9, 0x81, 0x0E, 0x48, 0xB6, 0xAF, 0xB0, 0xA9, 0x9C, 0xD2, 0xA1, 0xA5, 0x30, 0x10, 0xB4,
+	0xB1, 0x88, 0xF7, 0xAE, 0x97, 0x98, 0x83, 0x90, 0x01, 0x1D, 0x00, 0xCD, 0x05, 0x1D, 0x48, 0xAC,
+	0x8E, 0x83, 0xDD, 0xBE, 0xEE, 0xD8, 0xA3, 0x3E, 0x10, 0x96, 0xED, 0xD0, 0xF5, 0xFF, 0x92, 0x92,
+	0x93, 0x9D, 0x61, 0x0A, 0x74, 0xB4, 0xD9, 0x69, 0x12, 0x14, 0x08, 0xF1, 0xA9, 0xBB, 0xB2, 0x81,
+	0x8F, 0xE6, 0xA7, 0x28, 0x10, 0x8D, 0xFD, 0xD2, 0x8A, 0xD7, 0xD0, 0xD6, 0xD0, 0x38, 0x5A, 0x1C,
+	0x08, 0x9B, 0xD9, 0x01, 0x74, 0x4C, 0x8D, 0xCF, 0x88, 0x85, 0xDD, 0xBC, 0x95, 0xA1, 0xA8, 0x01,
+	0x10, 0xBB, 0xE7, 0x88, 0xBF, 0xA9, 0xF5, 0xFD, 0x87, 0xF9, 0x01, 0x3A, 0x04, 0x97, 0xDA, 0x01,
+	0x3A, 0x58, 0xCC, 0xCF, 0x8B, 0x93, 0xC1, 0xE3, 0xC5, 0xA5, 0x1E, 0x10, 0x8D, 0x8F, 0x88, 0x85,
+	0xCD, 0xC1, 0xAD, 0xC3, 0x20, 0x5A, 0x1A, 0x08, 0x96, 0x05, 0x1C, 0x5C, 0xEB, 0xFB, 0xEA, 0xB7,
+	0xD1, 0xD0, 0xA5, 0xA6, 0x26, 0x10, 0x83, 0xB5, 0xB8, 0xA3, 0xBE, 0xD6, 0xE0, 0xA5, 0x6A, 0x5A,
+	0x1B, 0x08, 0x95, 0xDA, 0x01, 0xAC, 0x5C, 0x97, 0xBE, 0x9A, 0x8A, 0xB0, 0x8F, 0x8F, 0xA5, 0xF8,
+	0x01, 0x10, 0x89, 0xB7, 0xA1, 0x99, 0xD5, 0xDA, 0xE8, 0xC6, 0x4A, 0x5A, 0x1A, 0x08, 0x94, 0x05,
+	0x39, 0x58, 0x8A, 0xF5, 0xBB, 0xAC, 0xF6, 0xDE, 0x99, 0xA3, 0x0F, 0x10, 0x87, 0xB5, 0x9D, 0xF8,
+	0xAB, 0xD5, 0x81, 0xA8, 0x4B, 0x5A, 0x1A, 0x08, 0x93, 0x05, 0x1C, 0x58, 0xA2, 0x8A, 0xC6, 0xD3,
+	0xCA, 0xAE, 0xF1, 0xA0, 0x35, 0x10, 0xB1, 0xD5, 0xE3, 0xAE, 0xA8, 0xEC, 0xA7, 0x9E, 0x36, 0x5A,
+	0x1B, 0x08, 0xE5, 0x05, 0xE4, 0xD0, 0xCD, 0xF5, 0xCB, 0xBE, 0xD3, 0xA1, 0xF5, 0xA0, 0xB9, 0x01,
+	0x10, 0xB8, 0xAB, 0xDC, 0x83, 0x89, 0x92, 0x9A, 0xC0, 0x7A, 0x5A, 0x1A, 0x08, 0xE4, 0xD9, 0x69,
+	0x12, 0x14, 0x08, 0xE0, 0xA6, 0xAF, 0xDE, 0xA6, 0x85, 0xBF, 0xA4, 0x18, 0x10, 0x86, 0xC7, 0x9C,
+	0xE6, 0xD1, 0x91, 0xCD, 0xF0, 0x77, 0x5A, 0x1B, 0x08, 0xE3, 0xD9, 0x01, 0x8E, 0x48, 0xB2, 0x93,
+	0xEE, 0xB4, 0xA0, 0x81, 0x96, 0xA4, 0x19, 0x10, 0xA2, 0xDD, 0xE1, 0x86, 0x90, 0xA0, 0xC7, 0xE4,
+	0xB2, 0x01, 0xE3, 0x04, 0xFF, 0xDF, 0x01, 0x39, 0x58, 0x87, 0xEC, 0xCC, 0xE3, 0xAA, 0xC4, 0x8E,
+	0xA7, 0x38, 0x10, 0xA2, 0xF5, 0x85, 0xAB, 0xDE, 0xBD, 0xC5, 0x94, 0x79, 0x5A, 0x1C, 0x08, 0xE2,
+	0x25, 0x1D, 0x4C, 0x88, 0x91, 0x8B, 0x9C, 0x80, 0x9E, 0xEA, 0xA2, 0xB2, 0x01, 0x10, 0xA4, 0x9F,
+	0xAB, 0xCE, 0x94, 0xA0, 0x9C, 0xCB, 0xA2, 0x21, 0x74, 0x00, 0xE1, 0x05, 0x90, 0x5C, 0xB5, 0xBC,
+	0xF3, 0xF6, 0xDF, 0xC0, 0xBB, 0xA1, 0xB4, 0x01, 0x10, 0x94, 0x91, 0xE6, 0xEA, 0x95, 0xCE, 0xCD,
+	0xDD, 0x35, 0x5A, 0x1C, 0x08, 0xCC, 0x05, 0x3B, 0x4C, 0x95, 0xDC, 0xD8, 0x97, 0xA1, 0xCB, 0xC6,
+	0xA5, 0xD9, 0x01, 0x10, 0x9D, 0xB3, 0xC4, 0xE8, 0x98, 0x8A, 0xBC, 0xA9, 0xF6, 0x01, 0x3B, 0x00,
+	0xCB, 0x05, 0x3B, 0xD0, 0xD2, 0xD5, 0xBB, 0x93, 0xF6, 0xCF, 0x9E, 0xA4, 0xDC, 0x01, 0x10, 0xA7,
+	0xDF, 0xC1, 0x8B, 0xDB, 0x94, 0xBC, 0xE4, 0x72, 0x5A, 0x1A, 0x08, 0xCA, 0xD9, 0x69, 0x12, 0x14,
+	0x08, 0xA5, 0xB5, 0xD7, 0x8F, 0xB2, 0x8B, 0xF5, 0xA7, 0x5C, 0x10, 0x86, 0x8B, 0xE5, 0xFF, 0xD1,
+	0x87, 0xDB, 0xE3, 0x64, 0x5A, 0x1C, 0x08, 0xC9, 0xD9, 0x21, 0xAF, 0x4C, 0xFD, 0xAA, 0xF8, 0x8B,
+	0xED, 0x9D, 0x94, 0xA6, 0xDC, 0x01, 0x10, 0xB6, 0xDD, 0x97, 0x87, 0x96, 0xBD, 0xAE, 0xCD, 0xDF,
+	0x01, 0x57, 0x00, 0xC8, 0x05, 0x57, 0x48, 0xAE, 0x96, 0xE9, 0xB1, 0xE7, 0xED, 0xFB, 0xA5, 0x34,
+	0x10, 0x9B, 0xB5, 0xC7, 0xFF, 0x9D, 0xB8, 0xFD, 0xE2, 0xBE, 0x01, 0x1D, 0x00, 0xB3, 0x05, 0x1D,
+	0x5C, 0xB3, 0xA2, 0xA3, 0x94, 0xD1, 0x9E, 0xDA, 0xA3, 0xFD, 0x01, 0x10, 0xB2, 0xE1, 0x93, 0xCA,
+	0xDE, 0x81, 0xCE, 0xA8, 0x5B, 0x5A, 0x1B, 0x08, 0xB2, 0x05, 0x1D, 0x48, 0xC7, 0xE1, 0xD3, 0xED,
+	0xFF, 0xB0, 0xBE, 0xA6, 0x4B, 0x10, 0xA3, 0xDB, 0xC0, 0xE8, 0xC1, 0xF8, 0xDE, 0x97, 0xA0, 0x21,
+	0x23, 0x60, 0xB1, 0xD9, 0x69, 0x12, 0x14, 0x08, 0xC7, 0xDF, 0xA4, 0xBA, 0xED, 0xD1, 0xF4, 0xA7,
+	0x4C, 0x10, 0x93, 0xD1, 0xC8, 0xCB, 0xA2, 0xB5, 0xC1, 0xBF, 0x23, 0x61, 0x0A, 0x04, 0xD9, 0x69,
+	0x01, 0xAD, 0x54, 0x98, 0xC2, 0xFC, 0xC5, 0x93, 0x82, 0xA7, 0x40, 0x10, 0x93, 0xB7, 0x9B, 0xAE,
+	0xF8, 0xA8, 0x83, 0xE2, 0x05, 0x5A, 0x1B, 0x08, 0xAF, 0x05, 0x55, 0x5C, 0xD7, 0xD8, 0xE2, 0xED,
+	0xDA, 0xA3, 0xF3, 0xA1, 0xAA, 0x01, 0x10, 0xB3, 0x81, 0xB9, 0xD2, 0xEB, 0x81, 0xCC, 0xBB, 0x60,
+	0x5A, 0x1B, 0x08, 0x9A, 0x05, 0x1D, 0x48, 0xD8, 0x98, 0xF4, 0xA6, 0xDF, 0xE6, 0x90, 0xA0, 0x14,
+	0x10, 0xB0, 0xE7, 0xBC, 0x96, 0xA2, 0x8F, 0xF5, 0xE1, 0x8B, 0x61, 0x0A, 0x00, 0x99, 0x25, 0x3E,
+	0x4C, 0x8E, 0x99, 0xE0, 0x99, 0xA7, 0xC2, 0xCD, 0xA7, 0xF4, 0x01, 0x10, 0x9C, 0x9B, 0xDD, 0xAF,
+	0x90, 0xA2, 0xA3, 0x84, 0xCC, 0x01, 0xCA, 0x00, 0x98, 0x05, 0x3B, 0x5C, 0x94, 0x89, 0xCD, 0x8F,
+	0xFB, 0x81, 0xB8, 0xA6, 0xF2, 0x01, 0x10, 0xAA, 0xEF, 0x80, 0xD9, 0xA8, 0xD4, 0xD1, 0xC2, 0x45,
+	0x5A, 0x1B, 0x08, 0x97, 0x05, 0x1D, 0x48, 0xD6, 0x81, 0xB4, 0xE6, 0x81, 0xBD, 0xDC, 0xA7, 0x20,
+	0x10, 0xB2, 0xAB, 0xC3, 0xEA, 0xD8, 0xFA, 0xA2, 0x85, 0xC8, 0x01, 0x58, 0x00, 0x96, 0x05, 0x58,
+	0x4C, 0xE3, 0xD5, 0xA5, 0x9C, 0xB0, 0x86, 0xC0, 0xA6, 0xD4, 0x01, 0x10, 0xB4, 0x85, 0xA2, 0xD6,
+	0xB4, 0x9E, 0x92, 0x86, 0xCC, 0x01, 0xE8, 0x00, 0x9B, 0x45, 0x7D, 0x58, 0xF0, 0xFB, 0x91, 0x9F,
+	0xD4, 0xEB, 0xA1, 0xA6, 0x76, 0x10, 0x96, 0xB9, 0xA9, 0xD9, 0x90, 0xBE, 0xB1, 0x99, 0x42, 0x5A,
+	0x1B, 0x08, 0x99, 0x45, 0xD2, 0x48, 0xF7, 0xF8, 0xFE, 0x8A, 0x93, 0xC7, 0x84, 0xA2, 0x3C, 0x10,
+	0xAE, 0xB5, 0x9E, 0x82, 0xA6, 0xED, 0xD3, 0xCF, 0xA1, 0x01, 0x57, 0x00, 0x9A, 0x65, 0xB9, 0x4C,
+	0x9F, 0xFA, 0xCB, 0xD9, 0xFB, 0xB6, 0x96, 0xA3, 0xD3, 0x01, 0x10, 0x8D, 0xB7, 0x81, 0x87, 0xFE,
+	0x97, 0xFA, 0x98, 0xCE, 0x01, 0xAF, 0x00, 0x92, 0x05, 0x3B, 0x48, 0xF3, 0xAC, 0xAD, 0xC8, 0xB9,
+	0x8B, 0xDA, 0xA7, 0x36, 0x10, 0xA8, 0xA7, 0xC7, 0xC4, 0xBD, 0xDE, 0xCF, 0xED, 0xB9, 0x01, 0x74,
+	0x00, 0x91, 0x05, 0x74, 0x58, 0xC9, 0xE0, 0xF2, 0xE0, 0xDC, 0x91, 0xE2, 0xA5, 0x05, 0x10, 0xB1,
+	0x9B, 0xA1, 0xCA, 0x93, 0xD6, 0xA2, 0xA4, 0x10, 0x5A, 0x1B, 0x08, 0x90, 0x05, 0x39, 0x5C, 0x93,
+	0x95, 0xC6, 0xBF, 0xF5, 0x9C, 0xA4, 0xA6, 0xA6, 0x01, 0x10, 0xB2, 0xAD, 0xEE, 0xB1, 0xA6, 0xE8,
+	0xD8, 0xFC, 0x18, 0x5A, 0x1B, 0x08, 0x8F, 0x05, 0x1D, 0x18, 0xC8, 0x90, 0xC2, 0xC4, 0x8B, 0xED,
+	0x85, 0xC1, 0xA6, 0x30, 0x83, 0x9D, 0xA0, 0xE5, 0xBB, 0xEF, 0xB3, 0x93, 0x0B, 0x5A, 0x1B, 0x08,
+	0x8E, 0x05, 0x1D, 0x48, 0xD5, 0xA7, 0xD1, 0xA6, 0x9C, 0xDF, 0xC6, 0xA5, 0x16, 0x10, 0x9C, 0xC3,
+	0xCE, 0xBF, 0xF1, 0xB0, 0xC1, 0x82, 0xD2, 0x01, 0x90, 0x00, 0x86, 0x05, 0x1D, 0x48, 0xA9, 0xD9,
+	0x98, 0xBB, 0x9C, 0xC2, 0xBD, 0xA1, 0x7B, 0x10, 0xB4, 0xBD, 0x83, 0x8B, 0x9E, 0xBD, 0xC2, 0xF7,
+	0xE5, 0x01, 0x1D, 0x00, 0x87, 0x05, 0x1D, 0x5C, 0x8C, 0xF4, 0xAA, 0xEA, 0xD4, 0xA0, 0xEF, 0xA7,
+	0xD0, 0x01, 0x10, 0xAD, 0xDD, 0xA8, 0xD6, 0xBA, 0xBE, 0xF1, 0xE3, 0x0C, 0x5A, 0x1C, 0x08, 0x88,
+	0x05, 0xE8, 0x4C, 0x9A, 0x8E, 0xD0, 0xB9, 0x8E, 0xA6, 0xB8, 0xA1, 0x92, 0x01, 0x10, 0xA1, 0xA5,
+	0x80, 0xCE, 0xA8, 0xEF, 0xA0, 0xFA, 0xDA, 0x21, 0x06, 0x00, 0x8D, 0x05, 0x1E, 0x4C, 0xFB, 0xB4,
+	0xB6, 0x95, 0x93, 0xA5, 0xC1, 0xA5, 0xED, 0x01, 0x10, 0x93, 0xA5, 0xC2, 0xE4, 0x84, 0xFE, 0x80,
+	0xBC, 0xA7, 0x01, 0xE9, 0x00, 0x8C, 0x05, 0xE9, 0x58, 0xF8, 0xC8, 0xAE, 0xC6, 0xA5, 0x8A, 0xCE,
+	0xA2, 0x7E, 0x10, 0x80, 0x99, 0xC6, 0xF8, 0xCB, 0x8F, 0xD9, 0xCB, 0x6F, 0x5A, 0x1B, 0x08, 0x8B,
+	0x05, 0x75, 0x48, 0xAB, 0xCA, 0xE3, 0xB7, 0x85, 0xC4, 0xDC, 0xA2, 0x6C, 0x10, 0x99, 0xE7, 0xB9,
+	0xE7, 0xCE, 0xC9, 0xFE, 0xF2, 0xFB, 0x01, 0x92, 0x00, 0x8A, 0x05, 0x1D, 0x5C, 0xB0, 0xE3, 0x8B,
+	0xFD, 0xA1, 0xDE, 0xDA, 0xA4, 0xDA, 0x01, 0x10, 0xA4, 0x97, 0x8A, 0x8A, 0xE6, 0x8F, 0x99, 0x94,
+	0x4C, 0x5A, 0x1B, 0x08, 0x89, 0x05, 0x1D, 0x48, 0xC5, 0xD3, 0xCF, 0xB8, 0xCB, 0xC0, 0xEE, 0xA2,
+	0x0C, 0x10, 0xA0, 0xD3, 0xBD, 0xA6, 0xB2, 0xCC, 0xC6, 0x83, 0xA6, 0x01, 0x73, 0x00, 0x85, 0x05,
+	0x73, 0x48, 0xAB, 0xBB, 0xE0, 0x88, 0xBC, 0xC2, 0xAD, 0xA5, 0x58, 0x10, 0xB1, 0xFB, 0xF3, 0xAA,
+	0xFE, 0xB8, 0x81, 0x91, 0x31, 0x81, 0xA2, 0x00, 0xE0, 0x81, 0x14, 0x48, 0xA4, 0xA4, 0xD7, 0xC1,
+	0xCC, 0xF2, 0xA3, 0xAC, 0x2B, 0x10, 0xB7, 0xB1, 0xB9, 0xB9, 0x95, 0xF5, 0x8A, 0x83, 0xEB, 0x01,
+	0x73, 0x00, 0xF8, 0x45, 0x44, 0x4C, 0xEF, 0xE4, 0xFA, 0xB6, 0xE0, 0xAB, 0xB5, 0xA4, 0xB4, 0x01,
+	0x10, 0x8B, 0xB1, 0xDB, 0x9C, 0x88, 0xCD, 0xFD, 0xEE, 0x39, 0x81, 0xBF, 0x00, 0xE0, 0x41, 0xF2,
+	0x58, 0xCE, 0xA5, 0xB3, 0xB4, 0xBA, 0xB1, 0x80, 0xAD, 0x3E, 0x10, 0x9A, 0xE5, 0xBE, 0xDC, 0xA2,
+	0x8A, 0xC0, 0xEA, 0x73, 0x5A, 0x1B, 0x08, 0xF7, 0x05, 0x39, 0x48, 0xBB, 0xBE, 0x9B, 0xA8, 0xE8,
+	0xE9, 0xCE, 0xA6, 0x2C, 0x10, 0xBF, 0xF5, 0xFD, 0xA1, 0xEA, 0xA1, 0xC1, 0xE8, 0xC8, 0x01, 0x8F,
+	0x00, 0x93, 0x05, 0x39, 0x58, 0x9D, 0xC7, 0xF5, 0xB2, 0x99, 0x8F, 0x87, 0xA2, 0x79, 0x10, 0xAF,
+	0xC5, 0x94, 0x9D, 0xCA, 0xBC, 0x82, 0xEF, 0x2A, 0x5A, 0x1C, 0x08, 0xF6, 0x45, 0x99, 0x4C, 0xB6,
+	0xF2, 0xCA, 0xEE, 0x98, 0xDE, 0xDB, 0xA1, 0xCB, 0x01, 0x10, 0x8B, 0xD5, 0xAD, 0x8F, 0xED, 0xDD,
+	0xC3, 0x94, 0xEC, 0x01, 0x3A, 0x70, 0xF5, 0xD9, 0x69, 0x12, 0x14, 0x08, 0xD9, 0xD7, 0xD7, 0x91,
+	0xC1, 0xD1, 0xD7, 0xA4, 0x35, 0x10, 0x9A, 0xFF, 0x8A, 0x9F, 0xBB, 0xFC, 0xB9, 0x87, 0x55, 0x5A,
+	0x1B, 0x08, 0xED, 0x05, 0x73, 0x5C, 0xEF, 0xCE, 0xC3, 0xDF, 0xF8, 0xE3, 0x9D, 0xA3, 0xAE, 0x01,
+	0x10, 0xBC, 0xDB, 0xF1, 0xA8, 0xAC, 0xFD, 0xFD, 0xA9, 0x46, 0x5A, 0x1B, 0x08, 0xEE, 0x05, 0x1D,
+	0x5C, 0xC7, 0x91, 0x8C, 0xE3, 0x8A, 0xEF, 0xA8, 0xA0, 0xC5, 0x01, 0x10, 0xB4, 0xD1, 0xB2, 0xC2,
+	0x86, 0x9E, 0x98, 0x97, 0x7D, 0x5A, 0x1B, 0x08, 0xEF, 0x05, 0x1D, 0x44, 0xCC, 0x8D, 0xD6, 0xC1,
+	0xF2, 0xCF, 0xE5, 0xA2, 0x5A, 0x10, 0x90, 0x83, 0xF9, 0x91, 0x95, 0x81, 0xAB, 0xE6, 0xA5, 0x17,
+	0x74, 0xF4, 0xD9, 0x69, 0x12, 0x14, 0x08, 0xD0, 0xC4, 0xC2, 0xEC, 0x83, 0x8C, 0xE0, 0xA4, 0x33,
+	0x10, 0xBA, 0xC3, 0xAD, 0xF9, 0x94, 0xAF, 0xE8, 0xB8, 0x3C, 0x5A, 0x1C, 0x08, 0xF3, 0xD9, 0x81,
+	0x85, 0x4C, 0xC3, 0x91, 0xEA, 0x98, 0x80, 0xB7, 0xC5, 0xA3, 0xD2, 0x01, 0x10, 0x80, 0xDB, 0xD5,
+	0x91, 0xA9, 0xEF, 0x80, 0x92, 0x96, 0x21, 0x3D, 0x00, 0xF2, 0x05, 0x57, 0x48, 0xC4, 0xE5, 0xC7,
+	0xC3, 0xF6, 0xA4, 0xB8, 0xA7, 0x23, 0x10, 0x94, 0xDB, 0xAF, 0xBE, 0x8F, 0xCB, 0xBE, 0xA8, 0xD9,
+	0x01, 0xCA, 0x70, 0xF1, 0xD9, 0x69, 0x12, 0x14, 0x08, 0xD8, 0xCE, 0xEA, 0xB0, 0x86, 0xB9, 0x8C,
+	0xA3, 0x68, 0x10, 0x84, 0xE7, 0xC9, 0xA5, 0x81, 0xC7, 0xB1, 0x91, 0x4D, 0x5A, 0x1B, 0x08, 0xF0,
+	0x05, 0x39, 0x48, 0xAA, 0xC7, 0x87, 0x83, 0xE7, 0xC2, 0xB7, 0xA7, 0x22, 0x10, 0xAA, 0x85, 0x98,
+	0x83, 0xBD, 0xC2, 0xEC, 0xA9, 0x82, 0x41, 0x5D, 0x00, 0xEC, 0x05, 0x74, 0x4C, 0x9B, 0xD3, 0xDB,
+	0xDF, 0xA1, 0xA9, 0xF3, 0xA5, 0xD4, 0x01, 0x10, 0x90, 0xBF, 0xE3, 0x8F, 0xAD, 0xED, 0xC3, 0xAC,
+	0xC9, 0x01, 0x74, 0x00, 0xE9, 0x05, 0x3B, 0x5C, 0x8A, 0xE7, 0x89, 0xD1, 0xF4, 0xB0, 0xC3, 0xA2,
+	0xFE, 0x01, 0x10, 0x88, 0xC9, 0xCB, 0xAE, 0xE1, 0x8D, 0x81, 0xE4, 0x37, 0x5A, 0x1C, 0x08, 0xE7,
+	0x05, 0x3B, 0x4C, 0xFD, 0x90, 0x8E, 0xA4, 0xC7, 0xB5, 0xD8, 0xA5, 0xF2, 0x01, 0x10, 0xBE, 0xE3,
+	0xB7, 0xE3, 0x95, 0xCF, 0xE2, 0x88, 0xDD, 0x01, 0x92, 0x70, 0xE8, 0xD9, 0x69, 0x12, 0x14, 0x08,
+	0x8F, 0x9C, 0xE0, 0xE1, 0xE9, 0xD2, 0x98, 0xA6, 0x76, 0x10, 0x8F, 0xFF, 0x9D, 0x8B, 0x9E, 0x8D,
+	0xD1, 0xF7, 0x10, 0x5A, 0x1C, 0x08, 0xE0, 0x05, 0x3A, 0x4C, 0xDC, 0xD6, 0xF3, 0xD0, 0xEF, 0x89,
+	0xF7, 0xA4, 0xF7, 0x01, 0x10, 0x8E, 0x93, 0xD9, 0xB6, 0xF2, 0xBC, 0xEF, 0xB9, 0xCF, 0x01, 0x75,
+	0x00, 0xDF, 0x05, 0x75, 0x48, 0xA5, 0xE3, 0xA7, 0x83, 0xDB, 0xDF, 0xD8, 0xA5, 0x7F, 0x10, 0xA8,
+	0xA9, 0x89, 0x97, 0x82, 0x8A, 0xBC, 0x9C, 0xE8, 0x01, 0x1D, 0x00, 0xDE, 0x05, 0x1D, 0x48, 0x91,
+	0x80, 0x8D, 0xE1, 0xBF, 0xB2, 0xA3, 0xA1, 0x0B, 0x10, 0x91, 0xD5, 0x8C, 0xBB, 0xB2, 0xB1, 0xB1,
+	0xCD, 0x86, 0x01, 0x1D, 0x00, 0xDD, 0x05, 0x1D, 0x44, 0xD8, 0x9C, 0xF4, 0xB8, 0xC8, 0xA0, 0xC7,
+	0xA6, 0x4F, 0x10, 0xAE, 0xB7, 0x90, 0x9C, 0xF3, 0xFB, 0x97, 0xB0, 0x12, 0x97, 0x09, 0x00, 0xDC,
+	0x05, 0x1D, 0x64, 0x8F, 0xC1, 0xCF, 0xD7, 0xDC, 0x96, 0x92, 0xA0, 0xF1, 0x01, 0x10, 0x97, 0xED,
+	0xBE, 0xA5, 0xFB, 0x97, 0xB4, 0xD0, 0x34, 0x5A, 0x1A, 0x08, 0xD4, 0xD9, 0x69, 0x0E, 0x7A, 0x09,
+	0x44, 0x8C, 0xAB, 0x8A, 0xE3, 0xB5, 0xEF, 0xA0, 0x03, 0x10, 0x80, 0xE3, 0xA6, 0xF7, 0xAE, 0xCB,
+	0x94, 0x81, 0x17, 0x0E, 0x87, 0x0C, 0x05, 0x39, 0x48, 0xCA, 0xA0, 0x90, 0xF0, 0x87, 0x9F, 0xA3,
+	0xA5, 0xCA, 0x01, 0x10, 0x8E, 0xF3, 0xA1, 0xDF, 0xD2, 0x8B, 0xD4, 0xF5, 0x0E, 0xF2, 0x0A, 0x00,
+	0xD6, 0x05, 0x1D, 0x48, 0xBD, 0xFF, 0xFD, 0xFA, 0xEA, 0xBB, 0xEE, 0xA0, 0x35, 0x10, 0x82, 0xCD,
+	0xB0, 0xE7, 0xCC, 0xFB, 0xDA, 0xB7, 0x8F, 0x21, 0x5D, 0x00, 0xDB, 0x05, 0xE8, 0x18, 0xA6, 0xBE,
+	0xE9, 0x84, 0x97, 0x82, 0xF3, 0x61, 0x63, 0x20, 0x96, 0x85, 0xD1, 0xA0, 0xD2, 0xC2, 0xBE, 0x9F,
+	0xDF, 0x01, 0x1E, 0x00, 0xDA, 0x05, 0x1E, 0x4C, 0xC7, 0xB8, 0x8B, 0x93, 0xC2, 0xCA, 0x81, 0xA0,
+	0xD3, 0x01, 0x10, 0x89, 0xC9, 0xCA, 0xE6, 0xB2, 0x8C, 0x9A, 0x91, 0xF2, 0x01, 0xCC, 0x00, 0xD9,
+	0x05, 0x59, 0x5C, 0x96, 0xDF, 0xA4, 0xA0, 0xBF, 0xC9, 0xBE, 0xA1, 0x93, 0x01, 0x10, 0xA3, 0xF1,
+	0x85, 0xC2, 0x83, 0xF8, 0xC6, 0xA0, 0x43, 0x5A, 0x1B, 0x08, 0xD8, 0x05, 0x1D, 0x48, 0xDC, 0xD5,
+	0xB8, 0x94, 0xF5, 0x8F, 0xD4, 0xA3, 0xED, 0x01, 0x10, 0x9F, 0xAB, 0xB5, 0xE8, 0x97, 0xEF, 0xE1,
+	0x95, 0x01, 0x3A, 0x00, 0xD7, 0x05, 0x1D, 0x44, 0xF5, 0xBF, 0xB5, 0xEB, 0x9F, 0xF9, 0xD9, 0xA3,
+	0x0C, 0x10, 0xB6, 0xED, 0xE0, 0x8D, 0xE5, 0xA8, 0x9B, 0xD2, 0x12, 0x6B, 0x0C, 0x00, 0xD3, 0x05,
+	0x1D, 0x5C, 0xD6, 0xBE, 0xAD, 0x87, 0x96, 0xDA, 0xD0, 0xA0, 0x92, 0x01, 0x10, 0xB9, 0xD3, 0xB7,
+	0xEE, 0xCB, 0xDF, 0xC3, 0xD4, 0x0F, 0x5A, 0x1B, 0x08, 0xD0, 0x05, 0x1D, 0x5C, 0x9B, 0x99, 0x95,
+	0xE6, 0xEC, 0xFD, 0xB0, 0xA0, 0xB1, 0x01, 0x10, 0xA9, 0xAB, 0xB9, 0xE2, 0xA4, 0xFE, 0xA5, 0x81,
+	0x29, 0x5A, 0x1B, 0x08, 0xCE, 0x05, 0x1D, 0xD0, 0x9D, 0x8C, 0xE4, 0x87, 0xB1, 0xDB, 0xF6, 0xA5,
+	0xA2, 0x01, 0x10, 0x99, 0xC5, 0xAD, 0xC4, 0xF5, 0xFE, 0xF4, 0xAE, 0x0C, 0x5A, 0x1A, 0x08, 0xCF,
+	0xD9, 0x69, 0x12, 0x14, 0x08, 0xBE, 0xAC, 0xCD, 0x8C, 0x8B, 0xA2, 0xC9, 0xA6, 0x7D, 0x10, 0x8D,
+	0xE3, 0x96, 0xE1, 0xED, 0xD3, 0xCB, 0xE3, 0x51, 0x5A, 0x1A, 0x08, 0xC7, 0xD9, 0x01, 0x1C, 0xC8,
+	0x9A, 0xB9, 0xF9, 0xD2, 0x96, 0xA0, 0xE3, 0xA7, 0x46, 0x10, 0x84, 0x91, 0xFA, 0xD3, 0xC9, 0xFE,
+	0xEF, 0x86, 0x3D, 0x5A, 0x1A, 0x08, 0xC6, 0xD9, 0x69, 0x12, 0x14, 0x08, 0xEE, 0x9C, 0xCF, 0x82,
+	0xDD, 0xFD, 0xC8, 0xA0, 0x6B, 0x10, 0x83, 0xB9, 0xF2, 0xE4, 0x82, 0xEA, 0xE0, 0xBF, 0x2A, 0x5A,
+	0x1B, 0x08, 0xC5, 0x05, 0x71, 0x5C, 0xA6, 0x8C, 0xCF, 0xE9, 0x9C, 0xE8, 0xD2, 0xA3, 0xC9, 0x01,
+	0x10, 0x97, 0xE9, 0xCF, 0xBB, 0x93, 0xF6, 0xA4, 0xB0, 0x58, 0x5A, 0x1B, 0x08, 0xC4, 0x05, 0x1D,
+	0x48, 0x9A, 0x85, 0xF5, 0xD9, 0xF9, 0xA2, 0xC4, 0xA4, 0x68, 0x10, 0x98, 0xD1, 0xA6, 0xE7, 0xCD,
+	0xBD, 0xD9, 0xF0, 0xD2, 0x41, 0x7C, 0x70, 0xC3, 0xD9, 0x69, 0x12, 0x14, 0x08, 0xA2, 0xB7, 0xCE,
+	0xA3, 0xD9, 0xFF, 0xB0, 0xA3, 0x22, 0x10, 0xB1, 0xED, 0xE2, 0x8E, 0xB3, 0x90, 0xF8, 0x90, 0x5E,
+	0x5A, 0x1B, 0x08, 0xBB, 0x05, 0x39, 0x5C, 0xDE, 0xE0, 0x92, 0xCF, 0xEC, 0xBE, 0x86, 0xA4, 0xC0,
+	0x01, 0x10, 0x9E, 0xB1, 0xEA, 0xE9, 0xDD, 0xD1, 0xDD, 0xA2, 0x37, 0x5A, 0x1B, 0x08, 0xBC, 0x05,
+	0x1D, 0x48, 0xE0, 0xF3, 0xD1, 0xF9, 0xD1, 0xF4, 0x92, 0xA5, 0x25, 0x10, 0x96, 0xE7, 0xA1, 0x9D,
+	0xDF, 0xAC, 0xB2, 0xA0, 0xA8, 0x01, 0x56, 0xE0, 0xBD, 0xD9, 0x69, 0x12, 0x14, 0x08, 0x99, 0x91,
+	0x82, 0xD7, 0xDF, 0xB8, 0x9F, 0xA6, 0x7F, 0x10, 0xB2, 0x91, 0xB1, 0xEA, 0x90, 0xFC, 0xC9, 0x93,
+	0x1F, 0x5A, 0x1A, 0x08, 0xC2, 0xD9, 0x69, 0x12, 0x14, 0x08, 0x9F, 0xB7, 0xC0, 0x88, 0xAE, 0x8D,
+	0xD5, 0xA5, 0x5D, 0x10, 0xBB, 0xF7, 0xAC, 0xC8, 0xD8, 0xAC, 0xEE, 0xB7, 0x0F, 0x5A, 0x1C, 0x08,
+	0xC1, 0x25, 0xE8, 0x1C, 0xF8, 0xA7, 0x8D, 0xAA, 0x8D, 0x86, 0xC6, 0xA1, 0x81, 0x2D, 0x1C, 0xB1,
+	0x95, 0xA4, 0xDE, 0x99, 0x89, 0x89, 0xD3, 0x41, 0x06, 0x00, 0xC0, 0x05, 0x1E, 0x4C, 0xB2, 0xFD,
+	0xE3, 0x8C, 0x97, 0xB5, 0x8A, 0xA3, 0xBF, 0x01, 0x10, 0x88, 0xE7, 0x90, 0xE0, 0x97, 0xB9, 0xB3,
+	0xD9, 0xB6, 0x01, 0x1E, 0x00, 0xBF, 0x05, 0x1E, 0xD0, 0x87, 0xB1, 0x98, 0xAD, 0xEB, 0x9A, 0xA1,
+	0xA5, 0xF1, 0x01, 0x10, 0x83, 0x8D, 0xA5, 0xB1, 0x8C, 0x82, 0xBA, 0xFC, 0xC3, 0x01, 0x5A, 0x19,
+	0x08, 0xBE, 0xD9, 0x69, 0x12, 0x13, 0x08, 0xFE, 0xB2, 0xBF, 0x8F, 0x96, 0xEA, 0xE9, 0x26, 0x10,
+	0xAA, 0x87, 0xCB, 0xCC, 0xDE, 0x8B, 0xA3, 0xB4, 0x21, 0x5A, 0x1B, 0x08, 0xBA, 0xD9, 0xA1, 0x88,
+	0x44, 0xC1, 0x81, 0xB8, 0xAD, 0x93, 0xE6, 0xED, 0xA1, 0x4A, 0x10, 0x95, 0xD3, 0xAE, 0xE2, 0xBC,
+	0xBB, 0xA2, 0xD2, 0x65, 0x45, 0x00, 0xB7, 0x05, 0xE7, 0x44, 0xD7, 0xE7, 0x8C, 0xC4, 0xFB, 0xCC,
+	0xF1, 0xA7, 0x37, 0x10, 0x8F, 0xFD, 0xDB, 0x96, 0xD9, 0x87, 0xA4, 0xE8, 0x65, 0xB9, 0x5C, 0xB5,
+	0xD9, 0x69, 0x12, 0x14, 0x08, 0xE6, 0x83, 0xA0, 0x80, 0x97, 0xED, 0xD4, 0xA1, 0x15, 0x10, 0xA2,
+	0x81, 0xDA, 0x9B, 0xD1, 0xBA, 0xE8, 0xCF, 0xE1, 0x00, 0x00, 0xB6, 0x05, 0x39, 0x4C, 0xAC, 0x8C,
+	0xDF, 0xDE, 0xB4, 0x8C, 0xF4, 0xA0, 0x98, 0x01, 0x10, 0xB4, 0xAF, 0xE4, 0xC8, 0xFA, 0xAD, 0xF9,
+	0xDB, 0x55, 0x0E, 0xD9, 0x0B, 0x74, 0xD9, 0x69, 0x12, 0x14, 0x08, 0xB8, 0xB0, 0xAE, 0xEA, 0xEF,
+	0xA4, 0xC1, 0xA0, 0x03, 0x10, 0x8D, 0xC1, 0xE7, 0x80, 0x81, 0x8D, 0xC5, 0xC8, 0x12, 0x5A, 0x1A,
+	0x08, 0xAD, 0xD9, 0x69, 0x21, 0x20, 0x40, 0xB0, 0x9C, 0xB7, 0xD0, 0xC0, 0xD3, 0xA6, 0x78, 0x10,
+	0x8B, 0xF3, 0xB6, 0xA8, 0x98, 0xAB, 0xB6, 0xF0, 0x0E, 0x6E, 0x0E, 0x00, 0xAB, 0x05, 0x55, 0x18,
+	0xE6, 0xAF, 0x97, 0xBB, 0xAB, 0xFF, 0xE2, 0x0E, 0x39, 0x0F, 0x30, 0xAB, 0xD3, 0x84, 0x8D, 0xCB,
+	0xC8, 0x9B, 0xB1, 0x7F, 0x5A, 0x1C, 0x08, 0xAA, 0x25, 0x01, 0x18, 0x9A, 0xA8, 0xD9, 0xC2, 0xFC,
+	0xF1, 0xCB, 0xE1, 0x1B, 0x20, 0xAC, 0x93, 0xC8, 0xC9, 0x9C, 0xBF, 0xC3, 0xF8, 0xF8, 0x21, 0x93,
+	0x08, 0xA2, 0xD9, 0x69, 0xA1, 0xC1, 0x40, 0x9B, 0xB3, 0xE6, 0xB7, 0xA2, 0xA2, 0xA4, 0x02, 0x10,
+	0xB0, 0x8F, 0xB5, 0xF8, 0xF7, 0xB9, 0xC7, 0xC5, 0x41, 0xB0, 0x00, 0xA3, 0x05, 0x57, 0x48, 0xDE,
+	0x87, 0x94, 0xB3, 0x9F, 0xD1, 0xBC, 0xA1, 0x65, 0x10, 0xAF, 0xA1, 0xFB, 0xC0, 0xE0, 0xBA, 0xC1,
+	0xFC, 0xC2, 0x61, 0x24, 0x00, 0xA4, 0x05, 0x1D, 0x64, 0xCF, 0xB8, 0xEE, 0xB1, 0x9D, 0xEB, 0xF1,
+	0xA6, 0x9C, 0x01, 0x10, 0x86, 0xC7, 0xC5, 0xB7, 0xB8, 0xBF, 0xA9, 0xE8, 0x21, 0x5A, 0x1A, 0x08,
+	0xA9, 0xD9, 0x69, 0x01, 0x56, 0x54, 0xC5, 0xD0, 0xB2, 0xA8, 0xF2, 0xA3, 0xA7, 0x5E, 0x10, 0x89,
+	0x87, 0x8D, 0xB3, 0x86, 0xAF, 0x9A, 0xF9, 0x5B, 0x5A, 0x1C, 0x08, 0xA8, 0x05, 0x90, 0x48, 0xA6,
+	0x81, 0x80, 0xA5, 0xC5, 0x9B, 0xAB, 0xA2, 0xEC, 0x01, 0x10, 0x9E, 0x8B, 0x90, 0xFA, 0x8A, 0xDB,
+	0xF1, 0xDC, 0x65, 0x7B, 0x00, 0xA7, 0x05, 0x57, 0xD0, 0xD7, 0x85, 0xD9, 0x88, 0x92, 0x99, 0xE2,
+	0xA0, 0xE4, 0x01, 0x10, 0x80, 0x81, 0x8C, 0xFB, 0x94, 0xC2, 0xA0, 0x9D, 0x53, 0x5A, 0x1A, 0x08,
+	0xA6, 0xD9, 0x69, 0x12, 0x14, 0x08, 0x89, 0xD9, 0xA1, 0xA9, 0x98, 0x8E, 0x89, 0xA1, 0x5C, 0x10,
+	0x80, 0xC7, 0xC5, 0xB8, 0xA4, 0x8C, 0xB3, 0xC7, 0x28, 0x5A, 0x1B, 0x08, 0xA5, 0xD9, 0x21, 0xAF,
+	0x48, 0xFE, 0x9C, 0xA2, 0xD3, 0xFE, 0x83, 0xC4, 0xA2, 0x76, 0x10, 0x89, 0x8D, 0xBE, 0x8A, 0xAE,
+	0x80, 0x87, 0xC7, 0xA3, 0x01, 0xAD, 0x00, 0xA1, 0x05, 0x56, 0x48, 0xDC, 0xDC, 0xDE, 0xDB, 0xB1,
+	0xAF, 0x94, 0xA4, 0x24, 0x10, 0xBD, 0xB9, 0xDF, 0xAA, 0xEF, 0xA3, 0x9B, 0x94, 0xE7, 0x41, 0x22,
+	0x00, 0x9E, 0x05, 0x91, 0x18, 0x9D, 0xB2, 0xAF, 0xD2, 0xBF, 0x98, 0xB0, 0x81, 0xD7, 0x20, 0x9E,
+	0xDB, 0xF7, 0xC2, 0xC7, 0xAE, 0xEE, 0x91, 0x9F, 0x01, 0x1E, 0x00, 0x9C, 0x05, 0x1E, 0x4C, 0xDC,
+	0xD6, 0x95, 0xA0, 0xBE, 0xDD, 0xF4, 0xA5, 0xE3, 0x01, 0x10, 0x92, 0xE3, 0xBC, 0xD5, 0xCE, 0x9E,
+	0xDF, 0xF2, 0x95, 0x21, 0x3F, 0x5C, 0x9D, 0xD9, 0x69, 0x12, 0x14, 0x08, 0xE3, 0xFE, 0x8C, 0x9C,
+	0xA0, 0xE3, 0x9D, 0xA5, 0x33, 0x10, 0x93, 0xD7, 0xE2, 0xA8, 0xBA, 0x85, 0xD6, 0xE2, 0x41, 0x41,
+	0x00, 0x84, 0x12, 0x02, 0x08, 0x48, 0xAD, 0xB1, 0xE9, 0xE8, 0xA8, 0xE5, 0xDC, 0xA5, 0x77, 0x10,
+	0xBC, 0xE9, 0xC6, 0xEF, 0x9F, 0xCB, 0xE1, 0x8E, 0xDD, 0x01, 0x92, 0x00, 0xEB, 0x05, 0x92, 0x18,
+	0xA8, 0xE5, 0x91, 0x8D, 0xE2, 0xD9, 0xAD, 0x81, 0x29, 0x30, 0x94, 0xCF, 0x9F, 0x90, 0x9F, 0x9A,
+	0xA0, 0x90, 0x54, 0x5A, 0x1B, 0x08, 0xD2, 0x05, 0x1D, 0x48, 0xA0, 0xA5, 0xE4, 0xB6, 0xF1, 0xAB,
+	0xA1, 0xA4, 0x57, 0x10, 0xA1, 0x8B, 0xAC, 0xF4, 0xAD, 0x91, 0xF0, 0xAA, 0xAC, 0x01, 0x91, 0x00,
+	0xB9, 0x05, 0x91, 0x4C, 0xB7, 0xF2, 0xDC, 0xB6, 0xFD, 0xF0, 0xAE, 0xA0, 0xCE, 0x01, 0x10, 0x87,
+	0xA5, 0xC8, 0xD2, 0xEC, 0xC4, 0xE1, 0xAD, 0xBC, 0x01, 0x1E, 0x00, 0xA0, 0x05, 0x1E, 0x44, 0xB4,
+	0xA5, 0x90, 0xC1, 0xA5, 0xD6, 0xB7, 0xA7, 0xE4, 0x01, 0x10, 0xB9, 0x81, 0x81, 0x8E, 0xCF, 0xB4,
+	0xE0, 0x09, 0xAF, 0x00, 0x80, 0x12, 0x78, 0x08, 0x5C, 0xC1, 0xE4, 0xC5, 0xF4, 0x96, 0xB7, 0xCD,
+	0xA1, 0x5C, 0x10, 0xBE, 0xAD, 0x86, 0xD0, 0xDA, 0xFB, 0xA0, 0x9C, 0x0B, 0x5A, 0x1C, 0x08, 0x9D,
+	0xE0, 0xE1, 0x3C, 0x4C, 0xC0, 0x9B, 0xB1, 0xD4, 0xD3, 0x8C, 0x9B, 0xA9, 0xFA, 0x01, 0x10, 0x98,
+	0xB1, 0xDF, 0x86, 0x85, 0xB8, 0xC4, 0xCD, 0xCE, 0x01, 0xE9, 0x00, 0x82, 0x05, 0x3A, 0x44, 0x87,
+	0xDC, 0x96, 0xF5, 0xB8, 0xA5, 0x87, 0xA5, 0x7B, 0x10, 0xAB, 0xF5, 0xA2, 0xBF, 0xFE, 0xE2, 0xDF,
+	0x8C, 0x0E, 0xE2, 0x0C, 0x70, 0xFF, 0xD9, 0x69, 0x12, 0x14, 0x08, 0xDB, 0x8F, 0xDC, 0xFF, 0x8E,
+	0xD6, 0xA6, 0xA1, 0x1C, 0x10, 0x98, 0xA5, 0xE8, 0x82, 0xFB, 0xC7, 0xE9, 0xA5, 0x1B, 0x5A, 0x1C,
+	0x08, 0x9C, 0x05, 0x56, 0x4C, 0xA4, 0xC2, 0xD8, 0xC1, 0xB9, 0xEC, 0xB6, 0xAB, 0x89, 0x01, 0x10,
+	0x8F, 0xC5, 0xC2, 0xC7, 0xBD, 0x8B, 0xAC, 0xAC, 0xD1, 0x01, 0x56, 0x00, 0x81, 0x05, 0x56, 0x58,
+	0xDA, 0x80, 0xE8, 0xB8, 0x8A, 0xDF, 0xF6, 0xA4, 0x62, 0x10, 0xAC, 0xBF, 0xAA, 0x91, 0xC8, 0x95,
+	0xFF, 0xD2, 0x75, 0x5A, 0x1C, 0x08, 0xFE, 0x05, 0xCA, 0x20, 0xC6, 0x88, 0xFD, 0xA9, 0xEE, 0xFA,
+	0xA2, 0xA6, 0xA7, 0xC1, 0x35, 0x18, 0xBC, 0xF1, 0xCE, 0xA3, 0xE0, 0xDC, 0xF5, 0x01, 0x3A, 0x00,
+	0x9B, 0x12, 0xB3, 0x08, 0x44, 0xFC, 0x95, 0xD9, 0xA3, 0x9D, 0xED, 0x81, 0xAF, 0x4B, 0x10, 0x87,
+	0xB3, 0xD2, 0xDD, 0x82, 0x9B, 0x89, 0xDA, 0x0E, 0x69, 0x0B, 0x00, 0xFD, 0x25, 0x3F, 0x5C, 0x89,
+	0x86, 0x9F, 0xA5, 0xCF, 0xF0, 0xB0, 0xA4, 0x92, 0x01, 0x10, 0xB7, 0x93, 0xE5, 0x8D, 0x9F, 0x86,
+	0xFA, 0xA0, 0x35, 0x5A, 0x1A, 0x08, 0x9A, 0x05, 0x39, 0x58, 0x99, 0xB7, 0xB6, 0xA5, 0xF7, 0xB7,
+	0xB2, 0xAC, 0x2C, 0x10, 0x84, 0xE7, 0x8D, 0xC3, 0x89, 0xBD, 0xF0, 0xB5, 0x3D, 0x5A, 0x1C, 0x08,
+	0xFC, 0x05, 0x73, 0x4C, 0x92, 0x91, 0xD7, 0xC5, 0xFD, 0xF9, 0xD0, 0xA5, 0xE8, 0x01, 0x10, 0x94,
+	0x8B, 0xD4, 0xEE, 0xAF, 0x93, 0xBB, 0xB4, 0xB6, 0x21, 0xB3, 0x04, 0x99, 0xE0, 0x41, 0x62, 0x5C,
+	0xF9, 0xFF, 0x8E, 0xDF, 0xB9, 0xC6, 0xDA, 0xAB, 0xAC, 0x01, 0x10, 0xA0, 0x93, 0xF0, 0xD1, 0x96,
+	0xC3, 0xD5, 0xE0, 0x2D, 0x5A, 0x1B, 0x08, 0xFB, 0x05, 0x74, 0x5C, 0xD9, 0xFE, 0xAB, 0xC9, 0xCC,
+	0x97, 0x8C, 0xA6, 0x88, 0x01, 0x10, 0xAD, 0xCD, 0x8C, 0xBF, 0xB0, 0xE7, 0xD4, 0xF1, 0x5D, 0x5A,
+	0x1A, 0x08, 0x98, 0x05, 0x74, 0xC8, 0xE3, 0xD9, 0xA8, 0x90, 0x90, 0xF8, 0xE4, 0xAB, 0x6B, 0x10,
+	0xAD, 0xE7, 0xED, 0x9B, 0xCA, 0x8F, 0xBB, 0x83, 0x2C, 0x5A, 0x1A, 0x08, 0xFA, 0xD9, 0x69, 0x12,
+	0x14, 0x08, 0xDF, 0xD7, 0xAA, 0xBC, 0xE9, 0x82, 0xEA, 0xA4, 0x74, 0x10, 0xB6, 0xB5, 0x90, 0xEF,
+	0xCC, 0xB2, 0xD3, 0x88, 0x2F, 0x5A, 0x1A, 0x08, 0x97, 0x05, 0x38, 0x58, 0x97, 0x8A, 0xAE, 0xB5,
+	0xC9, 0x8B, 0xEF, 0xAF, 0x49, 0x10, 0xBD, 0xBF, 0xBE, 0x9E, 0xD7, 0x8F, 0x9B, 0x9C, 0x57, 0x5A,
+	0x1B, 0x08, 0xF9, 0x05, 0x71, 0x4C, 0xD3, 0xD5, 0xBA, 0xDE, 0x99, 0xBE, 0xE9, 0xA6, 0xA8, 0x01,
+	0x10, 0xBE, 0xA7, 0xF8, 0xD0, 0x86, 0x8F, 0xD8, 0x82, 0x11, 0x0E, 0x02, 0x0F, 0x09, 0x39, 0x54,
+	0x8B, 0xB6, 0x97, 0xE1, 0xB8, 0xBC, 0xAC, 0x0A, 0x10, 0x98, 0xB3, 0xE0, 0xA5, 0x97, 0x86, 0x8E,
+	0xF8, 0x42, 0x5A, 0x1B, 0x08, 0xF3, 0x12, 0x93, 0x10, 0x18, 0xD4, 0xEB, 0xA2, 0xBC, 0xD9, 0xD0,
+	0xE5, 0x0E, 0xE2, 0x0D, 0x30, 0xAD, 0xE7, 0x97, 0xD2, 0xF4, 0xC9, 0xF6, 0xA8, 0x79, 0x5A, 0x1B,
+	0x08, 0xAC, 0x05, 0x56, 0x5C, 0xDC, 0x97, 0x91, 0xB7, 0xA4, 0x91, 0xFA, 0xA3, 0xAF, 0x01, 0x10,
+	0x84, 0xDB, 0xE7, 0xBA, 0xD8, 0xD0, 0xF6, 0x91, 0x1D, 0x5A, 0x1C, 0x08, 0xB9, 0x12, 0x7F, 0x12,
+	0x4C, 0xD6, 0xE8, 0x89, 0x9A, 0xB7, 0x82, 0x8C, 0xA2, 0x88, 0x01, 0x10, 0xAF, 0xA5, 0xDA, 0xC3,
+	0x80, 0xA4, 0xD5, 0xEC, 0xDF, 0x21, 0x1F, 0x04, 0xFC, 0xDB, 0x21, 0x1F, 0x60, 0xB7, 0xAD, 0xAD,
+	0x97, 0xBD, 0xA0, 0xF5, 0xA1, 0x83, 0x01, 0x10, 0xBF, 0xF1, 0xCF, 0x8A, 0xCE, 0xB9, 0xF8, 0xB2,
+	0x49, 0x5A, 0x1C, 0x08, 0xFB, 0xDB, 0x41, 0x5D, 0x4C, 0xC5, 0x92, 0xD0, 0xA5, 0xED, 0xD1, 0xA1,
+	0xA7, 0x92, 0x01, 0x10, 0x8D, 0xFB, 0xF1, 0xFA, 0xAE, 0xEB, 0x8D, 0x99, 0xE3, 0x41, 0xB5, 0x00,
+	0x83, 0x05, 0x59, 0x4C, 0xB5, 0xDD, 0x90, 0xB9, 0xF3, 0xE7, 0xF6, 0xA4, 0xB5, 0x01, 0x10, 0x84,
+	0xBD, 0xBE, 0xCC, 0xB6, 0xA0, 0xF3, 0x88, 0xDC, 0x01, 0x59, 0x00, 0x82, 0x12, 0xF1, 0x11, 0x5C,
+	0xA4, 0x98, 0xA0, 0xCE, 0xA5, 0xC8, 0xCB, 0xA4, 0xFE, 0x01, 0x10, 0x82, 0xA5, 0xEB, 0xB2, 0xAD,
+	0xCE, 0xB7, 0xCF, 0x78, 0x5A, 0x1A, 0x08, 0x81, 0x12, 0xF0, 0x10, 0x58, 0x8E, 0xE9, 0xB3, 0xAC,
+	0xFD, 0x94, 0x89, 0xA1, 0x06, 0x10, 0xA0, 0xA5, 0xF9, 0xF4, 0x9D, 0xE7, 0xFC, 0xD4, 0x26, 0x5A,
+	0x1B, 0x08, 0x80, 0x05, 0x39, 0x5C, 0xE4, 0xA7, 0xFD, 0xFC, 0xC0, 0x9E, 0x83, 0xA2, 0x86, 0x01,
+	0x10, 0xAE, 0xC3, 0x98, 0xF2, 0xDD, 0xD3, 0xAD, 0x85, 0x4A, 0x5A, 0x1B, 0x08, 0xFF, 0x05, 0xAF,
+	0x5C, 0xBC, 0x9A, 0xC3, 0x95, 0xC3, 0xF8, 0x91, 0xA1, 0xDB, 0x01, 0x10, 0xA8, 0xC9, 0xB5, 0xAE,
+	0xBB, 0x90, 0xCA, 0x89, 0x34, 0x5A, 0x1B, 0x08, 0xFE, 0x05, 0x1D, 0x48, 0xEC, 0xD3, 0xD0, 0xF5,
+	0xFE, 0x9C, 0xD7, 0xA0, 0x45, 0x10, 0x99, 0xC3, 0xEF, 0xB8, 0xC6, 0xD9, 0xCA, 0xDB, 0xB4, 0x41,
+	0x7B, 0x00, 0xA3, 0x05, 0x73, 0x58, 0x9F, 0xF5, 0xF9, 0x8E, 0xAA, 0x89, 0xBE, 0xA7, 0x3B, 0x10,
+	0x81, 0xF9, 0xBE, 0xFA, 0x93, 0xC1, 0xE6, 0xED, 0x7B, 0x5A, 0x1B, 0x08, 0x8E, 0x05, 0x73, 0x48,
+	0xCB, 0xEA, 0xAC, 0xB8, 0xD2, 0xD3, 0x89, 0xA5, 0x06, 0x10, 0xB1, 0xCF, 0xE7, 0x8C, 0xFD, 0xD6,
+	0xD8, 0xE7, 0x87, 0x01, 0x39, 0x00, 0x8D, 0x05, 0x39, 0x44, 0xD6, 0xF1, 0x92, 0xE2, 0x83, 0xB5,
+	0x9C, 0xA0, 0x07, 0x10, 0x92, 0x89, 0x9E, 0xDD, 0xC2, 0xE8, 0xB1, 0xF8, 0x0E, 0xC1, 0x0C, 0x00,
+	0x8C, 0x25, 0x03, 0x4C, 0xB4, 0x9F, 0xC2, 0xA6, 0x80, 0xED, 0xE4, 0xA4, 0x90, 0x01, 0x10, 0x91,
+	0xFB, 0x8D, 0xAB, 0xF8, 0x9E, 0xD8, 0xD0, 0x99, 0x21, 0x03, 0x00, 0x8B, 0x05, 0x57, 0x5C, 0x8C,
+	0x8B, 0xD0, 0xE7, 0x8A, 0x85, 0xC2, 0xA2, 0xF6, 0x01, 0x10, 0xAD, 0x93, 0xDD, 0xF3, 0x9B, 0xA5,
+	0xF8, 0x9E, 0x6C, 0x5A, 0x1B, 0x08, 0x8A, 0x05, 0x1D, 0x48, 0x9C, 0xF3, 0xAD, 0xA9, 0x98, 0xF1,
+	0xC8, 0xA4, 0x7C, 0x10, 0xA8, 0xBB, 0x98, 0x94, 0x9B, 0x8C, 0x9D, 0xEA, 0xD9, 0x21, 0x5B, 0x00,
+	0x89, 0x05, 0x58, 0x4C, 0xCE, 0xA3, 0x8C, 0x8C, 0xEC, 0xD0, 0xB6, 0xA4, 0xFD, 0x01, 0x10, 0xB9,
+	0x91, 0xBB, 0xDD, 0xE7, 0xC5, 0x8E, 0xFB, 0x88, 0x01, 0x58, 0x00, 0x88, 0x05, 0x3B, 0x44, 0x8C,
+	0xA6, 0xEC, 0xC9, 0xEE, 0xFA, 0xA3, 0xA7, 0x02, 0x10, 0xB6, 0xDF, 0xA9, 0xB2, 0xCB, 0xF3, 0x95,
+	0xE6, 0x12, 0x46, 0x0A, 0x00, 0x95, 0x45, 0x0C, 0x5C, 0xF1, 0x96, 0xA9, 0xB2, 0xCD, 0xA8, 0xF2,
+	0xA5, 0xFC, 0x01, 0x10, 0x97, 0xC1, 0xD2, 0xC5, 0xF4, 0xE1, 0xC1, 0x90, 0x05, 0x5A, 0x1C, 0x08,
+	0xA2, 0x05, 0x58, 0x4C, 0xEF, 0xD3, 0xB6, 0xA8, 0xC7, 0xF4, 0xF1, 0xA6, 0xC1, 0x01, 0x10, 0x95,
+	0xA1, 0xC8, 0xDE, 0x99, 0xA9, 0xB1, 0xC2, 0xCD, 0x01, 0x58, 0x00, 0x94, 0x05, 0x3B, 0x18, 0xCA,
+	0x81, 0xF9, 0xD7, 0xE8, 0xD3, 0xE6, 0x21, 0x5D, 0x30, 0x95, 0xEF, 0xB4, 0xB5, 0xCD, 0xCD, 0x84,
+	0x95, 0x09, 0x5A, 0x1A, 0x08, 0xA1, 0x25, 0x07, 0x58, 0x80, 0x93, 0xD6, 0x81, 0x8E, 0xC3, 0xB3,
+	0xA6, 0x23, 0x10, 0x8E, 0xA7, 0xC5, 0xEE, 0x93, 0x9E, 0xCD, 0xCD, 0x24, 0x5A, 0x1B, 0x08, 0x93,
+	0x05, 0x39, 0x5C, 0xE3, 0xBD, 0xAB, 0x8A, 0xF1, 0x8C, 0xEB, 0xA5, 0xB9, 0x01, 0x10, 0xA6, 0xC5,
+	0xBC, 0xC7, 0xF3, 0xB5, 0x97, 0xBE, 0x10, 0x5A, 0x1B, 0x08, 0xA0, 0x05, 0xAE, 0x48, 0xF4, 0xDD,
+	0x84, 0xB6, 0xDE, 0x92, 0xD7, 0xA7, 0x1C, 0x10, 0x9A, 0xB5, 0x9E, 0x8C, 0xB7, 0xC4, 0xFC, 0xF8,
+	0xBC, 0x01, 0x73, 0x00, 0x92, 0x05, 0x3A, 0x48, 0xD1, 0xC5, 0x9F, 0xE3, 0xB5, 0xF5, 0xDD, 0xA6,
+	0x7C, 0x10, 0x93, 0xF9, 0xC5, 0x8F, 0x88, 0xF4, 0xF6, 0xC0, 0xBF, 0x01, 0x1D, 0x00, 0x9F, 0x05,
+	0x3A, 0x5C, 0xE8, 0xE6, 0xCE, 0x85, 0xB5, 0x8B, 0xA7, 0xA4, 0x97, 0x01, 0x10, 0xA7, 0xE5, 0xAC,
+	0x93, 0xA2, 0x83, 0xDD, 0xB7, 0x50, 0x5A, 0x1C, 0x08, 0x91, 0x65, 0xF6, 0x4C, 0xB6, 0x8E, 0xF3,
+	0xD3, 0xD5, 0xBD, 0xF4, 0xA3, 0xCC, 0x01, 0x10, 0x88, 0xA5, 0x8E, 0xFE, 0xDB, 0x85, 0xF3, 0xE8,
+	0xAD, 0x01, 0x3B, 0x00, 0x9E, 0x05, 0x3B, 0x44, 0x9A, 0xAA, 0xA2, 0x8A, 0x97, 0xF0, 0xBD, 0xA6,
+	0x6F, 0x10, 0xAC, 0x9F, 0xAC, 0xF9, 0xA5, 0x9C, 0xE5, 0xAB, 0x12, 0x07, 0x08, 0x00, 0x90, 0x05,
+	0x75, 0x48, 0x87, 0xC9, 0x8D, 0xC2, 0xF6, 0xEE, 0xBB, 0xA3, 0x2C, 0x10, 0xB9, 0xAB, 0x98, 0x9A,
+	0xFB, 0x94, 0xAE, 0xE4, 0xC7, 0x21, 0x7B, 0x00, 0x9D, 0x25, 0x23, 0x4C, 0xBA, 0x84, 0xF6, 0xAE,
+	0xFB, 0xCF, 0xFA, 0xA2, 0xE8, 0x01, 0x10, 0xAA, 0xE9, 0x98, 0xAA, 0xD4, 0xAB, 0x9E, 0xDB, 0xEF,
+	0x41, 0x0D, 0x5C, 0x8F, 0xD9, 0x69, 0x12, 0x14, 0x08, 0x86, 0xDB, 0xA6, 0xC8, 0xEF, 0xFB, 0xA1,
+	0xA7, 0x0A, 0x10, 0xA0, 0x93, 0xA9, 0x86, 0xD4, 0x98, 0x8A, 0xC7, 0x0E, 0x74, 0x0D, 0x00, 0x9C,
+	0x05, 0x3A, 0x4C, 0xEE, 0xAB, 0x8A, 0xAA, 0xA8, 0xBC, 0xC1, 0xA5, 0x96, 0x01, 0x10, 0xB1, 0xA3,
+	0xB1, 0xA5, 0xF9, 0x97, 0xAE, 0xEA, 0xB3, 0x01, 0x3A, 0x60, 0x8E, 0xD9, 0x69, 0x12, 0x14, 0x08,
+	0xDF, 0xE7, 0xA7, 0xC6, 0xDA, 0xB6, 0xEC, 0xA5, 0x5B, 0x10, 0x8B, 0xE9, 0xAD, 0xE6, 0x93, 0xAC,
+	0x9D, 0xFA, 0x2C, 0x0E, 0x35, 0x13, 0x05, 0x3A, 0x4C, 0xDE, 0xD1, 0x96, 0xEF, 0xDD, 0x9B, 0x86,
+	0xA7, 0xE7, 0x01, 0x10, 0x93, 0x99, 0xC3, 0xA5, 0xEB, 0xFA, 0xC9, 0xA5, 0xD0, 0x01, 0x92, 0x00,
+	0x8D, 0x05, 0xEA, 0x4C, 0xA0, 0xB9, 0xC9, 0xBA, 0xB5, 0xCB, 0xBC, 0xA2, 0xDA, 0x01, 0x10, 0x9D,
+	0xB1, 0xDC, 0x8D, 0xC0, 0xEE, 0x91, 0xA8, 0xBB, 0x01, 0x58, 0x00, 0x9A, 0x25, 0x98, 0xC8, 0xC0,
+	0xEE, 0xD8, 0xA5, 0xA5, 0xCD, 0x9C, 0xA1, 0x6F, 0x10, 0x83, 0x91, 0xB5, 0x96, 0xA3, 0xAE, 0xC8,
+	0xE5, 0x1A, 0x5A, 0x1A, 0x08, 0x8C, 0xD9, 0x69, 0x12, 0x14, 0x08, 0xCF, 0xD3, 0xC2, 0x94, 0x8E,
+	0x9C, 0xF5, 0x26, 0x10, 0xAD, 0xD9, 0x9E, 0xED, 0xDE, 0xF2, 0xDA, 0xE2, 0x90, 0x01, 0x5A, 0x1A,
+	0x08, 0x99, 0x05, 0x38, 0x58, 0x95, 0xFD, 0xA3, 0xF1, 0xB5, 0xD2, 0x8B, 0xA0, 0x51, 0x10, 0xB3,
+	0x85, 0x93, 0xD3, 0x84, 0xAA, 0xAC, 0xC8, 0x61, 0x5A, 0x1B, 0x08, 0x87, 0x25, 0x3E, 0x5C, 0x88,
+	0xA1, 0x97, 0xCF, 0x8D, 0xB1, 0x9A, 0xA7, 0xBC, 0x01, 0x10, 0x8C, 0xA9, 0x9B, 0x9F, 0xED, 0x95,
+	0xD3, 0xA7, 0x0E, 0x5A, 0x1C, 0x08, 0x8B, 0x05, 0x8F, 0x4C, 0x91, 0xA2, 0xB7, 0xFC, 0xD8, 0xB6,
+	0xCB, 0xA5, 0xEB, 0x01, 0x10, 0xA5, 0xDB, 0xBA, 0xF0, 0x84, 0xE1, 0xF0, 0x81, 0xEB, 0x01, 0x8F,
+	0x00, 0x98, 0x05, 0x57, 0x44, 0xDE, 0xB5, 0xA5, 0xB7, 0xB1, 0xC5, 0x97, 0xA6, 0x2B, 0x10, 0x92,
+	0x9B, 0xC2, 0xB9, 0xFC, 0x96, 0xC5, 0x8D, 0x0E, 0x24, 0x0F, 0x00, 0x8A, 0x25, 0x78, 0x5C, 0x8D,
+	0xE2, 0x9E, 0xDA, 0xE8, 0xBF, 0x98, 0xA2, 0xA8, 0x01, 0x10, 0xAD, 0xF9, 0xE5, 0xF1, 0xD4, 0xF0,
+	0xA9, 0xBD, 0x41, 0x5A, 0x1C, 0x08, 0x97, 0x25, 0x04, 0x4C, 0x96, 0xB3, 0xC4, 0xA4, 0xA5, 0xFB,
+	0x9B, 0xA0, 0xB5, 0x01, 0x10, 0x88, 0x85, 0xA5, 0x93, 0xE9, 0xC1, 0xD7, 0xE0, 0xD7, 0x21, 0xD0,
+	0x00, 0x89, 0x05, 0x3B, 0x5C, 0xCE, 0xA9, 0xF3, 0xCA, 0xC6, 0xBC, 0xFF, 0xA7, 0xB0, 0x01, 0x10,
+	0x83, 0xDB, 0xB0, 0xAB, 0xA3, 0xCD, 0x83, 0xEF, 0x3E, 0x5A, 0x1C, 0x08, 0x96, 0x05, 0x3B, 0x4C,
+	0xF6, 0x9F, 0xFD, 0xE7, 0x8F, 0xF9, 0x83, 0xA5, 0xE7, 0x01, 0x10, 0xA8, 0xEB, 0xAD, 0x8B, 0x98,
+	0xDE, 0xB8, 0xE2, 0xB3, 0x01, 0x3B, 0x00, 0x88, 0x05, 0x3B, 0x4C, 0xD6, 0xC2, 0xAE, 0xD3, 0xB6,
+	0xEE, 0xF3, 0xA2, 0x9F, 0x01, 0x10, 0xA2, 0xED, 0x8C, 0xE5, 0x97, 0xFA, 0xC1, 0xC1, 0x2B, 0x0E,
+	0xB7, 0x0F, 0x05, 0xEA, 0x48, 0xD1, 0xBF, 0xDB, 0xD4, 0xF6, 0xA5, 0xF1, 0xA1, 0x36, 0x10, 0xA4,
+	0xD9, 0xF4, 0xC8, 0xF6, 0xED, 0xA8, 0x97, 0x88, 0x01, 0xCC, 0x70, 0x87, 0xD9, 0x69, 0x12, 0x14,
+	0x08, 0xDD, 0xD5, 0xE4, 0xD2, 0xA8, 0xD4, 0xA3, 0xA0, 0x6E, 0x10, 0xBF, 0x87, 0xD4, 0xB1, 0xF8,
+	0x8B, 0xEC, 0xE8, 0x65, 0x5A, 0x1B, 0x08, 0x94, 0x05, 0x39, 0x20, 0xFB, 0x9F, 0xD0, 0xD7, 0x85,
+	0x93, 0xB1, 0xA6, 0xCE, 0x0E, 0x97, 0x16, 0x18, 0x8C, 0xEF, 0xD9, 0x93, 0xF3, 0xB4, 0x68, 0x0E,
+	0x76, 0x14, 0x00, 0xDC, 0x01, 0x39, 0x44, 0xAA, 0xC5, 0x8D, 0xC3, 0xE6, 0xE2, 0xCC, 0xA6, 0x51,
+	0x10, 0x90, 0xF7, 0x91, 0xE1, 0xD3, 0x97, 0xD3, 0xBE, 0xC1, 0xAE, 0x00, 0x92, 0x05, 0xAD, 0x4C,
+	0x81, 0xCD, 0xE8, 0xDB, 0x8A, 0x91, 0x88, 0xA5, 0x9C, 0x01, 0x10, 0x85, 0xB1, 0xE9, 0xFC, 0xA6,
+	0xFA, 0xB9, 0xA9, 0xDB, 0x01, 0xAD, 0x00, 0x91, 0x05, 0x57, 0x5C, 0xB2, 0xE3, 0xA2, 0x96, 0xEA,
+	0xB6, 0xC4, 0xA6, 0xE5, 0x01, 0x10, 0xA9, 0x8B, 0xD4, 0xBD, 0xA3, 0xBA, 0xE5, 0xBB, 0x03, 0x5A,
+	0x1C, 0x08, 0x90, 0x05, 0x3B, 0x4C, 0xFE, 0xDB, 0xF9, 0xFF, 0xC1, 0xFB, 0xDC, 0xA5, 0xFD, 0x01,
+	0x10, 0xB5, 0x83, 0xFF, 0xD3, 0xA1, 0xAE, 0xD2, 0x90, 0x97, 0x01, 0x3B, 0x00, 0x8F, 0x05, 0x3B,
+	0x5C, 0xF0, 0xD9, 0x99, 0xAE, 0xE9, 0x83, 0x8C, 0xA5, 0x93, 0x01, 0x10, 0xA6, 0xE3, 0xE8, 0xED,
+	0xE1, 0xF7, 0xBA, 0xD7, 0x1B, 0x5A, 0x1B, 0x08, 0x86, 0x05, 0x1D, 0x5C, 0xEA, 0xF3, 0xF4, 0xF8,
+	0x90, 0xB9, 0xA2, 0xA2, 0xCA, 0x01, 0x10, 0xBF, 0xE3, 0x98, 0xB8, 0x98, 0x92, 0xE2, 0x95, 0x75,
+	0x5A, 0x1B, 0x08, 0x85, 0x05, 0x1D, 0x48, 0x93, 0x8B, 0xB2, 0xEC, 0xAB, 0xC4, 0xC2, 0xA3, 0x82,
+	0x01, 0x10, 0x82, 0xA3, 0xD8, 0x8A, 0xBE, 0x8F, 0xC1, 0xB9, 0x0E, 0x1C, 0x0D, 0x00, 0xFA, 0xA5,
+	0x55, 0x48, 0x93, 0x84, 0xE3, 0xCD, 0xED, 0xE7, 0x93, 0xA0, 0x9D, 0x01, 0x10, 0xB3, 0xCF, 0xDD,
+	0xE7, 0x92, 0xC8, 0xC6, 0xEB, 0x0E, 0xD1, 0x14, 0x00, 0xF9, 0xC5, 0x21, 0x4C, 0xBB, 0xE2, 0xAC,
+	0xBE, 0xCD, 0x9F, 0x8B, 0xA6, 0xA9, 0x01, 0x10, 0x96, 0xDB, 0xBF, 0xF4, 0xFA, 0xF7, 0xE5, 0x8B,
+	0xC0, 0x41, 0xB9, 0x00, 0xFD, 0x05, 0x1E, 0x4C, 0xAF, 0xD9, 0xD8, 0xFD, 0xFE, 0xEF, 0xA9, 0xA3,
+	0xBA, 0x01, 0x10, 0x8C, 0xD3, 0xD3, 0x92, 0xE4, 0xF3, 0xAF, 0xE2, 0x87, 0x01, 0xB0, 0x00, 0xD0,
+	0x05, 0x59, 0x5C, 0xBC, 0xC8, 0x9D, 0x83, 0xC7, 0xEF, 0x9C, 0xA4, 0xEE, 0x01, 0x10, 0xA8, 0xF5,
+	0xC5, 0xCD, 0x82, 0xBA, 0xB7, 0xE6, 0x74, 0x5A, 0x1B, 0x08, 0xCF, 0x05, 0x1D, 0x48, 0xB7, 0x97,
+	0x81, 0xCB, 0xBB, 0xA0, 0xF7, 0xA0, 0xD8, 0x01, 0x10, 0xBE, 0xE7, 0xF5, 0x97, 0xF4, 0xFF, 0xD0,
+	0xBA, 0xA1, 0x3B, 0x00, 0xD7, 0x05, 0x1D, 0x60, 0x8B, 0xD3, 0xED, 0xE8, 0xD6, 0xB3, 0xDB, 0xA3,
+	0xEB, 0x01, 0x10, 0x97, 0xCF, 0xDE, 0xC4, 0xAA, 0xF0, 0x8E, 0xEF, 0x70, 0x5A, 0x1A, 0x08, 0xD6,
+	0xDB, 0x21, 0x7C, 0x58, 0xF4, 0xE6, 0xD2, 0x93, 0x81, 0x9E, 0xCE, 0xA3, 0xC5, 0x01, 0x10, 0xB6,
+	0xE7, 0x91, 0xE5, 0x94, 0xCC, 0xC6, 0x2A, 0x5A, 0x1A, 0x08, 0xD5, 0x05, 0x1C, 0x44, 0xE4, 0xF5,
+	0xE0, 0xC3, 0xC1, 0x89, 0xD2, 0xA1, 0x4E, 0x10, 0x8F, 0x91, 0x82, 0xF8, 0xF1, 0xBC, 0x93, 0x91,
+	0xE1, 0x61, 0x00, 0xD4, 0x05, 0x55, 0x5C, 0xD8, 0xEC, 0xC4, 0xBA, 0xD6, 0x82, 0xE1, 0xA4, 0xA9,
+	0x01, 0x10, 0xB7, 0xE3, 0x99, 0x96, 0xBE, 0xDD, 0xCB, 0xBA, 0x2E, 0x5A, 0x1B, 0x08, 0xD3, 0x05,
+	0x1D, 0x4C, 0xDC, 0xAB, 0x93, 0xF6, 0xEE, 0x8D, 0xE7, 0xA0, 0xBF, 0x01, 0x10, 0xAE, 0xF3, 0xDB,
+	0x99, 0xCE, 0xFA, 0xA4, 0x8A, 0x5D, 0x0E, 0xF8, 0x09, 0x05, 0x1D, 0x48, 0xD2, 0x93, 0xE4, 0x81,
+	0xA7, 0xFA, 0xD9, 0xA2, 0x42, 0x10, 0x90, 0x85, 0xA2, 0x93, 0xB5, 0xA5, 0xE1, 0xBC, 0xFE, 0x01,
+	0xE6, 0x00, 0xF7, 0x05, 0x1D, 0x1C, 0xCC, 0xC0, 0xAF, 0xBA, 0xB7, 0x8B, 0xCB, 0xA6, 0x81, 0x15,
+	0x18, 0x8B, 0x93, 0xA4, 0xE7, 0xE1, 0xFE, 0xEC, 0xC1, 0xEB, 0x00, 0xE2, 0x05, 0x1D, 0x18, 0xE0,
+	0xA3, 0x9E, 0x98, 0xAC, 0xC8, 0x81, 0x0E, 0x6D, 0x19, 0x1C, 0xB5, 0xD1, 0x81, 0x9F, 0x8C, 0xCD,
+	0xCF, 0x96, 0x0E, 0x4A, 0x17, 0x00, 0xE1, 0x25, 0x3E, 0x4C, 0x88, 0xBC, 0x8F, 0xFC, 0x89, 0x91,
+	0xBC, 0xA1, 0xD1, 0x01, 0x10, 0xA2, 0xBF, 0xFE, 0xFD, 0xF0, 0xE7, 0xE9, 0xEE, 0xF8, 0x01, 0x58,
+	0x00, 0xE0, 0x05, 0x3B, 0x48, 0x81, 0xAE, 0xB9, 0xD8, 0xA1, 0xBF, 0x88, 0xA5, 0x07, 0x10, 0x91,
+	0xF7, 0x9E, 0x8E, 0xDB, 0xC2, 0xB4, 0xAD, 0xA7, 0x21, 0x79, 0x00, 0xDF, 0x05, 0x3B, 0x4C, 0x90,
+	0xC2, 0x8D, 0x9F, 0x91, 0xAF, 0xC2, 0xA7, 0xBB, 0x01, 0x10, 0xB5, 0xA7, 0x90, 0xD9, 0xC9, 0xC7,
+	0xF5, 0xDF, 0x85, 0x01, 0x3B, 0x00, 0xDE, 0x05, 0x3B, 0x5C, 0xE3, 0x8A, 0x91, 0x88, 0xE9, 0xCC,
+	0xBC, 0xA5, 0xE9, 0x01, 0x10, 0x8D, 0x8D, 0xD8, 0xCD, 0xDF, 0x8B, 0x9C, 0xD2, 0x5B, 0x5A, 0x1C,
+	0x08, 0xDD, 0x05, 0x3B, 0x48, 0xFC, 0xA3, 0xFC, 0xC7, 0xE4, 0xA6, 0xBA, 0xA3, 0xD7, 0x01, 0x10,
+	0x81, 0xA7, 0x84, 0xAA, 0xF3, 0xC6, 0xBE, 0xE2, 0xC5, 0x98, 0x00, 0xDC, 0x05, 0x1E, 0x4C, 0xBE,
+	0xD5, 0xEC, 0xAD, 0x95, 0xCC, 0xEC, 0xA7, 0xE2, 0x01, 0x10, 0xB8, 0x81, 0xC9, 0xDE, 0xF3, 0xBC,
+	0x8D, 0xDB, 0xF7, 0x01, 0x77, 0x00, 0xF6, 0x05, 0x1E, 0x48, 0xA7, 0xE9, 0xDF, 0xB9, 0xCA, 0xE1,
+	0xC8, 0xA7, 0xD8, 0x01, 0x10, 0x8B, 0xFB, 0xE2, 0xDE, 0xE1, 0xDA, 0x8B, 0xCC, 0x12, 0x88, 0x10,
+	0x00, 0xF5, 0x05, 0x77, 0x48, 0xA1, 0xA5, 0xE3, 0xE5, 0xE2, 0xA9, 0xEC, 0xA1, 0x06, 0x10, 0xA1,
+	0xA7, 0x92, 0xB6, 0xB4, 0xA4, 0xA9, 0x91, 0xD5, 0x01, 0x3B, 0x00, 0xF4, 0x05, 0x3B, 0x4C, 0x8F,
+	0xAB, 0xAE, 0x9F, 0x94, 0x92, 0xF8, 0xA0, 0xF8, 0x01, 0x10, 0x9F, 0xFD, 0xD8, 0xAE, 0xAF, 0xB3,
+	0x8A, 0xE7, 0x90, 0x01, 0x1E, 0x00, 0xF3, 0x05, 0x1E, 0x4C, 0x9F, 0x80, 0xEF, 0xAF, 0xD1, 0x8C,
+	0xD4, 0xA2, 0xE3, 0x01, 0x10, 0xA1, 0xF9, 0xE6, 0xA4, 0x8D, 0x97, 0xFD, 0xE0, 0x84, 0x61, 0xA7,
+	0x00, 0xED, 0x25, 0xD6, 0x58, 0xFE, 0xD8, 0xAC, 0xD7, 0x96, 0xE4, 0xD8, 0xA6, 0x78, 0x10, 0xA1,
+	0x95, 0xD8, 0x8C, 0xF2, 0xEF, 0x91, 0x9A, 0x13, 0x5A, 0x1C, 0x08, 0xDB, 0x05, 0x3A, 0x4C, 0x91,
+	0xE3, 0xC9, 0x8A, 0xAE, 0x9D, 0x8E, 0xA6, 0x86, 0x01, 0x10, 0xA8, 0xE5, 0xA2, 0xAA, 0xC2, 0xC7,
+	0xED, 0xB7, 0xDD, 0x21, 0x0A, 0x00, 0xDA, 0x05, 0x93, 0x48, 0xD0, 0x8A, 0xE8, 0xB1, 0xE6, 0xD6,
+	0x9A, 0xA3, 0x64, 0x10, 0x9A, 0xED, 0xCD, 0xA6, 0xE7, 0xE0, 0x82, 0x8B, 0x87, 0x01, 0x75, 0x00,
+	0xD9, 0x05, 0x3B, 0x48, 0x99, 0x9B, 0xC8, 0xBD, 0x97, 0xA6, 0xCD, 0xA5, 0xC0, 0x01, 0x10, 0xB3,
+	0xAB, 0xA6, 0x99, 0xCF, 0xAD, 0xF0, 0xE5, 0x45, 0xDC, 0x00, 0xCE, 0x05, 0x1E, 0x4C, 0xAC, 0xB6,
+	0xF3, 0x98, 0xCE, 0xB1, 0xE3, 0xA0, 0x82, 0x01, 0x10, 0xB4, 0x89, 0xEB, 0x98, 0xD9, 0xB4, 0x8D,
+	0x9A, 0xDA, 0x01, 0x59, 0x00, 0xCD, 0x05, 0x59, 0x5C, 0x9C, 0xE9, 0xD6, 0xFA, 0xBF, 0xE7, 0xD6,
+	0xA3, 0xF1, 0x01, 0x10, 0x89, 0xC5, 0x86, 0xE4, 0xC3, 0xDF, 0xC5, 0xD5, 0x36, 0x5A, 0x1B, 0x08,
+	0xD1, 0x05, 0x1D, 0x48, 0xD2, 0xD1, 0xC1, 0xBB, 0xF5, 0xDE, 0xF1, 0xA5, 0x84, 0x01, 0x10, 0x8D,
+	0xA7, 0xA7, 0x92, 0x90, 0xE3, 0xC9, 0xF0, 0x0E, 0xBB, 0x14, 0x00, 0xA4, 0x05, 0x1D, 0x4C, 0xB0,
+	0xCF, 0xEC, 0xE9, 0xB8, 0xD5, 0x93, 0xA7, 0xC2, 0x01, 0x10, 0xAF, 0x89, 0xB1, 0xAC, 0xC4, 0xAB,
+	0xB9, 0x9C, 0x25, 0x0E, 0xEF, 0x19, 0x05, 0x75, 0x18, 0xD3, 0xC8, 0xA2, 0xC1, 0xE3, 0xBD, 0xD8,
+	0x21, 0xBA, 0x20, 0x97, 0xEB, 0x95, 0x94, 0xAB, 0xEE, 0x8C, 0xC9, 0xBD, 0x01, 0x75, 0x00, 0xAB,
+	0x05, 0x3B, 0x18, 0x98, 0xE9, 0xF2, 0xA1, 0x8B, 0xC4, 0xF4, 0x0E, 0x2D, 0x1C, 0x30, 0xA1, 0xC3,
+	0xFB, 0xDB, 0xB5, 0xB2, 0xD8, 0xE9, 0x4A, 0x5A, 0x1B, 0x08, 0xAA, 0x05, 0x1D, 0x48, 0xD9, 0xAF,
+	0xE8, 0xA6, 0x83, 0x94, 0xF1, 0xA7, 0xA3, 0x01, 0x10, 0x8D, 0xDF, 0xCB, 0x99, 0xBF, 0xA0, 0x8D,
+	0x97, 0x0E, 0xBA, 0x0C, 0x00, 0xA9, 0x05, 0x1D, 0x48, 0xA0, 0xD2, 0xE8, 0x91, 0x9F, 0xF6, 0xF9,
+	0xA3, 0x73, 0x10, 0x8F, 0xB7, 0xBD, 0xC3, 0xE7, 0xB2, 0xFA, 0xAA, 0x9F, 0x21, 0x5F, 0x00, 0xA8,
+	0x25, 0x5F, 0x58, 0xD9, 0xE0, 0xB4, 0xDB, 0xD9, 0x9B, 0xC1, 0xA6, 0x53, 0x10, 0x96, 0xAB, 0xF1,
+	0xB4, 0xBB, 0xA3, 0xCB, 0xE2, 0x1A, 0x5A, 0x1B, 0x08, 0xA7, 0x05, 0x39, 0x5C, 0xFF, 0x9D, 0xEF,
+	0xF4, 0xC3, 0xFD, 0xEE, 0xA4, 0xC6, 0x01, 0x10, 0x86, 0xF9, 0xD7, 0x82, 0xFB, 0xA1, 0xDF, 0xDB,
+	0x25, 0x5A, 0x1B, 0x08, 0xA6, 0x05, 0x1D, 0x5C, 0x8A, 0xBD, 0x8D, 0xA3, 0xF9, 0xA9, 0xA7, 0xA3,
+	0xA8, 0x01, 0x10, 0x89, 0xF5, 0xA4, 0x81, 0xF7, 0xD5, 0xBD, 0x98, 0x18, 0x5A, 0x1C, 0x08, 0xCB,
+	0x05, 0xCB, 0x4C, 0x8B, 0x87, 0xEF, 0xB5, 0x9D, 0x8A, 0xCD, 0xA3, 0x92, 0x01, 0x10, 0x96, 0x87,
+	0xE1, 0x94, 0xB1, 0x8E, 0xB5, 0xD1, 0xD3, 0x01, 0xCB, 0x00, 0xB6, 0x05, 0x3B, 0x48, 0x94, 0x8E,
+	0xA8, 0xFA, 0xF3, 0xB2, 0xC8, 0xA6, 0x14, 0x10, 0xB5, 0x83, 0x94, 0xB8, 0xEA, 0xC3, 0xF4, 0xDB,
+	0xEC, 0x21, 0x99, 0x00, 0xB5, 0x05, 0x3B, 0x18, 0xD3, 0xDF, 0xFF, 0xC8, 0xFB, 0xF5, 0xE6, 0x0E,
+	0x21, 0x0A, 0x1C, 0xA6, 0xD7, 0x95, 0xB8, 0xAA, 0x96, 0xDF, 0xDB, 0x45, 0xDE, 0x00, 0xB4, 0x05,
+	0x3B, 0x48, 0xEF, 0xBA, 0xE2, 0x8D, 0x87, 0xB4, 0x92, 0xA0, 0x81, 0x01, 0x10, 0x9B, 0xB3, 0xFC,
+	0xDC, 0xE3, 0xE1, 0xAE, 0xC9, 0x0E, 0x56, 0x0F, 0x00, 0xB3, 0x05, 0x3B, 0x4C, 0xA4, 0x8B, 0x82,
+	0xD3, 0xE0, 0x88, 0xDC, 0xA0, 0xA1, 0x01, 0x10, 0x9E, 0x8D, 0xE1, 0xD3, 0xBB, 0xA1, 0x9C, 0xDE,
+	0xE1, 0x01, 0x59, 0x00, 0xB2, 0x05, 0x1E, 0x4C, 0x80, 0xF0, 0xDA, 0xD8, 0xE0, 0x81, 0xD5, 0xA1,
+	0xBB, 0x01, 0x10, 0xB3, 0xD5, 0xF1, 0xE2, 0x8A, 0x9A, 0x88, 0x8F, 0xE7, 0x21, 0x08, 0x00, 0xB1,
+	0x25, 0x08, 0x48, 0xB5, 0xEA, 0xFD, 0xDF, 0xE7, 0xF4, 0xF3, 0xA0, 0x05, 0x10, 0xB3, 0x9D, 0xBE,
+	0xB3, 0x89, 0xEF, 0x9B, 0xF6, 0x17, 0x0E, 0xB6, 0x18, 0x05, 0x1C, 0x58, 0xD2, 0xE0, 0x95, 0x94,
+	0xCC, 0xDD, 0xB7, 0xA1, 0x39, 0x10, 0x8E, 0xED, 0xFA, 0xF5, 0xA7, 0xEB, 0xE0, 0xC2, 0x72, 0x5A,
+	0x1C, 0x08, 0xCA, 0x05, 0x56, 0x48, 0x99, 0xCC, 0x9E, 0xA1, 0xF7, 0xDE, 0xFB, 0xA7, 0xC1, 0x01,
+	0x10, 0xA6, 0xBD, 0xDE, 0xB9, 0xAE, 0xF3, 0x95, 0xAF, 0x12, 0xA2, 0x0D, 0x00, 0xC9, 0x05, 0x3A,
+	0x58, 0xC6, 0x8C, 0xCF, 0xDC, 0x9D, 0xC2, 0x87, 0xA7, 0x1D, 0x10, 0xA6, 0xD1, 0x88, 0x84, 0x8D,
+	0x83, 0xD4, 0xB3, 0x5F, 0x5A, 0x1A, 0x08, 0xC8, 0x05, 0x1C, 0x44, 0x8B, 0xB9, 0xEC, 0xAF, 0xBB,
+	0x86, 0xDD, 0xA6, 0x35, 0x10, 0x84, 0x99, 0xBF, 0x81, 0xBB, 0xE1, 0x96, 0xC7, 0xA1, 0x7A, 0x00,
+	0xC7, 0x05, 0x56, 0x20, 0x93, 0x99, 0xF5, 0x83, 0x88, 0xA3, 0xB8, 0xA4, 0x9B, 0x0E, 0xA2, 0x0D,
+	0x18, 0xE4, 0xAE, 0x82, 0xDF, 0xBC, 0xF3, 0x82, 0x21, 0x40, 0x00, 0xC6, 0x25, 0x05, 0x48, 0x81,
+	0xF4, 0x87, 0x84, 0x89, 0xE2, 0xA3, 0xA4, 0x69, 0x10, 0xA5, 0xA3, 0xED, 0x84, 0xED, 0xC8, 0x8F,
+	0xAE, 0xAE, 0x01, 0xC9, 0x00, 0xC5, 0x05, 0x57, 0x58, 0x8D, 0xE8, 0xD6, 0xDB, 0x81, 0xFB, 0xE5,
+	0xA5, 0x43, 0x10, 0x91, 0xD7, 0xC6, 0xD6, 0x9D, 0xCC, 0xF9, 0xBE, 0x1A, 0x5A, 0x1C, 0x08, 0xC4,
+	0x05, 0x57, 0x18, 0xC6, 0xC7, 0x83, 0xE5, 0xD4, 0xE6, 0xAF, 0xA1, 0xEE, 0x1C, 0xA5, 0xD3, 0xCC,
+	0xDD, 0xF6, 0xC4, 0x92, 0xBA, 0x12, 0xE7, 0x0F, 0x00, 0xC3, 0x05, 0x57, 0x5C, 0xD8, 0xC0, 0xA5,
+	0xE7, 0x9F, 0xFD, 0x99, 0xA6, 0xDD, 0x01, 0x10, 0xA9, 0xFB, 0x94, 0xBD, 0xE3, 0xD1, 0xDD, 0xAE,
+	0x1F, 0x5A, 0x1B, 0x08, 0xC2, 0x05, 0x1D, 0x18, 0x85, 0x89, 0xE6, 0xB8, 0xC4, 0xE7, 0x87, 0x65,
+	0x30, 0x18, 0xE3, 0xC6, 0xDB, 0xC0, 0xD1, 0x9C, 0xB5, 0xE1, 0xA3, 0x00, 0xC1, 0x05, 0x58, 0x4C,
+	0xD0, 0xA1, 0xB2, 0x88, 0xB7, 0x8A, 0x98, 0xA4, 0xF9, 0x01, 0x10, 0x94, 0xCF, 0xED, 0x8D, 0x91,
+	0xB9, 0xD2, 0xFC, 0x8E, 0x01, 0xAF, 0x00, 0xAF, 0x05, 0x3B, 0x48, 0xA3, 0x96, 0xA0, 0xCB, 0xFC,
+	0xE7, 0xFB, 0xA2, 0xCB, 0x01, 0x10, 0xA4, 0xF5, 0xE3, 0xCA, 0x9E, 0xAD, 0xCF, 0xD7, 0x0E, 0x70,
+	0x1D, 0x00, 0xC0, 0x05, 0xAF, 0x58, 0xBE, 0xFB, 0xFE, 0xC4, 0xFC, 0xF3, 0xCC, 0xA4, 0x0F, 0x10,
+	0x99, 0xE1, 0xD5, 0x9E, 0x87, 0x92, 0xA0, 0x8C, 0x6A, 0x5A, 0x1B, 0x08, 0xBF, 0x05, 0x39, 0x48,
+	0xE5, 0xAF, 0xFF, 0x84, 0xAA, 0xC8, 0xE9, 0xA2, 0x5C, 0x10, 0x91, 0xA1, 0xC6, 0xEA, 0x97, 0xA0,
+	0xAC, 0xDC, 0xE8, 0x21, 0xCF, 0x00, 0xBE, 0x05, 0x74, 0x48, 0xB9, 0xA0, 0xE8, 0xB5, 0xCA, 0xE7,
+	0xB8, 0xA0, 0xCC, 0x01, 0x10, 0x99, 0xAB, 0xB7, 0xBB, 0xAC, 0x82, 0xFE, 0xF4, 0x65, 0x2E, 0x00,
+	0xBD, 0x05, 0x3B, 0x44, 0x98, 0xE8, 0x90, 0xCA, 0x85, 0x8F, 0x93, 0xA0, 0x27, 0x10, 0x97, 0xA3,
+	0xCD, 0xA8, 0xD7, 0xAF, 0xB2, 0xCC, 0x12, 0x12, 0x1A, 0x00, 0xBC, 0x05, 0x1D, 0x5C, 0xE6, 0xD4,
+	0xFC, 0x8F, 0xFC, 0xEA, 0xF3, 0xA6, 0x9A, 0x01, 0x10, 0x98, 0xF1, 0xFE, 0xE9, 0x9B, 0xEA, 0x82,
+	0xFA, 0x6E, 0x5A, 0x1C, 0x08, 0xBB, 0x05, 0x58, 0x60, 0x8E, 0xB2, 0xDE, 0xBD, 0xFE, 0xC7, 0xCD,
+	0xA5, 0x96, 0x01, 0x10, 0x93, 0xFF, 0xF1, 0xB1, 0xF9, 0x88, 0x8C, 0xD9, 0xE1, 0x01, 0x5A, 0x1B,
+	0x08, 0xBA, 0x05, 0x3B, 0x48, 0xCF, 0x8C, 0xF0, 0xAC, 0xF8, 0xAE, 0xB7, 0xA2, 0x9E, 0x01, 0x10,
+	0x81, 0xF7, 0xAB, 0x99, 0xE0, 0x9F, 0xF0, 0xD2, 0x0E, 0xEF, 0x10, 0x00, 0xB9, 0x05, 0x1D, 0x5C,
+	0xEC, 0xC8, 0xA5, 0xE1, 0x8A, 0x80, 0x82, 0xA2, 0x80, 0x01, 0x10, 0x8D, 0xB3, 0xEC, 0xCD, 0xE6,
+	0xBE, 0xD4, 0xAC, 0x2F, 0x5A, 0x1B, 0x08, 0xB8, 0x09, 0x1D, 0x44, 0x95, 0xFC, 0xEE, 0xAE, 0xC8,
+	0xB2, 0xA1, 0x3C, 0x10, 0xB2, 0x97, 0xED, 0x9E, 0xD7, 0x96, 0xB8, 0xA7, 0xBD, 0x01, 0xCD, 0x00,
+	0xB7, 0x05, 0x75, 0x4C, 0x88, 0x8B, 0x8F, 0xB0, 0x97, 0xF5, 0x87, 0xA6, 0xD9, 0x01, 0x10, 0x9E,
+	0x91, 0x82, 0x81, 0xE2, 0xEC, 0xEE, 0xE1, 0xFF, 0x01, 0x75, 0x00, 0xAE, 0x05, 0x3B, 0x20, 0xF5,
+	0x9E, 0xE6, 0xBA, 0xD0, 0xD2, 0xDD, 0xA1, 0x80, 0x0E, 0xDA, 0x21, 0x28, 0xD2, 0xE0, 0xA0, 0x8D,
+	0xD1, 0xF5, 0x32, 0x5A, 0x1B, 0x08, 0xAD, 0x05, 0x1D, 0x5C, 0xA1, 0xB2, 0xEB, 0x84, 0xDA, 0xA1,
+	0x9E, 0xA7, 0xF0, 0x01, 0x10, 0x8A, 0xA9, 0xD3, 0xB6, 0xD4, 0xEC, 0xD7, 0xE7, 0x4E, 0x5A, 0x1B,
+	0x08, 0xA2, 0x05, 0x1D, 0x44, 0xE2, 0xBD, 0x94, 0xF0, 0xF1, 0xC2, 0xFA, 0xA0, 0x7D, 0x10, 0xA8,
+	0x91, 0xA7, 0xAA, 0x90, 0x9F, 0x8D, 0xBD, 0x12, 0x57, 0x1C, 0x00, 0xA1, 0x05, 0x1D, 0x5C, 0xBA,
+	0x96, 0xE6, 0x96, 0xC3, 0x80, 0xF9, 0xA3, 0xBD, 0x01, 0x10, 0xB7, 0xB1, 0xBE, 0xCC, 0xAF, 0x86,
+	0xBB, 0xD5, 0x44, 0x5A, 0x1C, 0x08, 0xA5, 0x05, 0x92, 0x48, 0xCE, 0xEB, 0xEF, 0x8A, 0xD2, 0xDE,
+	0xE5, 0xA7, 0xD2, 0x01, 0x10, 0x84, 0xCF, 0xFD, 0xE2, 0xD9, 0xF1, 0x91, 0xBF, 0x12, 0x35, 0x14,
+	0x00, 0xEB, 0x12, 0xB6, 0x1E, 0x58, 0xBA, 0xD7, 0xEE, 0xD8, 0x95, 0xE9, 0xBB, 0xA0, 0x04, 0x10,
+	0x96, 0xF1, 0x89, 0x9B, 0x89, 0xF8, 0xDE, 0xB8, 0x09, 0x5A, 0x1B, 0x08, 0xF8, 0x12, 0x63, 0x11,
+	0x48, 0xD9, 0xAF, 0xF3, 0xF1, 0xBC, 0xC4, 0xD0, 0xA0, 0xEF, 0x01, 0x10, 0xBA, 0xB1, 0xCB, 0xCD,
+	0x9C, 0xCF, 0xE7, 0xD1, 0xA1, 0x01, 0x04, 0xEA, 0xD7, 0x0E, 0x91, 0x0E, 0x5C, 0xAF, 0xBD, 0xD8,
+	0xCC, 0xD6, 0x97, 0xEA, 0xA1, 0xB9, 0x01, 0x10, 0xB0, 0xF9, 0xC6, 0x96, 0xAA, 0xC3, 0x9E, 0xE1,
+	0x5F, 0x5A, 0x1C, 0x08, 0xF7, 0x12, 0x13, 0x1A, 0x48, 0xA1, 0xBF, 0xE1, 0xB6, 0xC6, 0xB2, 0xF5,
+	0xA5, 0xF5, 0x01, 0x10, 0x8A, 0xDF, 0x8C, 0xD9, 0xAF, 0x95, 0xB4, 0x8E, 0x12, 0x30, 0x0C, 0x00,
+	0xF2, 0x05, 0x3B, 0x48, 0xED, 0xEE, 0xC9, 0xCB, 0xC1, 0x94, 0xDB, 0xA5, 0x7A, 0x10, 0xB5, 0xD1,
+	0xB8, 0x9F, 0xA6, 0xBA, 0xC7, 0xDB, 0x84, 0x21, 0x23, 0x00, 0xFF, 0x05, 0x75, 0x48, 0xD1, 0xD5,
+	0xB7, 0xA9, 0xFE, 0xEC, 0x8D, 0xA1, 0x2B, 0x10, 0x88, 0x99, 0xB6, 0x96, 0xEC, 0xA3, 0xA5, 0x99,
+	0xA9, 0x61, 0x13, 0x00, 0xF1, 0x05, 0xAE, 0x5C, 0x95, 0xEC, 0xEF, 0xAC, 0xC8, 0xFD, 0xE7, 0xA7,
+	0x3C, 0x10, 0xA8, 0xB7, 0xFD, 0xD2, 0xB9, 0xDB, 0xC4, 0xD5, 0x69, 0x5A, 0x19, 0x08, 0xFE, 0xDA,
+	0x0E, 0x6D, 0x14, 0x44, 0xCC, 0x86, 0x98, 0x96, 0x8F, 0xAD, 0xFB, 0xA5, 0x6C, 0x10, 0xA8, 0xDD,
+	0xDB, 0xE8, 0xB1, 0x9A, 0xA5, 0x27, 0x0E, 0x62, 0x18, 0x05, 0x71, 0x5C, 0xB6, 0xBE, 0xA5, 0xA1,
+	0xC1, 0x84, 0xBC, 0xA7, 0x3C, 0x10, 0xA7, 0xEF, 0xA1, 0x8D, 0xBC, 0x9F, 0xD2, 0x82, 0x94, 0x01,
+	0x5A, 0x1B, 0x08, 0xFD, 0x05, 0x71, 0x48, 0x95, 0xCF, 0xF0, 0xC9, 0x85, 0xAA, 0x9F, 0xA6, 0xB1,
+	0x01, 0x10, 0x94, 0xB7, 0xEF, 0xC2, 0xC2, 0xE1, 0xAC, 0xFF, 0x0E, 0xBE, 0x0C, 0x00, 0xEF, 0x12,
+	0xB9, 0x1F, 0x4C, 0xCC, 0xAB, 0xA3, 0xAD, 0xED, 0x81, 0xB7, 0xA0, 0x96, 0x01, 0x10, 0xA7, 0xCF,
+	0x84, 0xE6, 0xD2, 0xF8, 0xD2, 0x86, 0xAD, 0x01, 0x8F, 0x04, 0xFC, 0xDA, 0x0E, 0xC4, 0x08, 0x44,
+	0x80, 0xB9, 0x8E, 0xBD, 0xE1, 0x93, 0xE4, 0xA1, 0x1A, 0x10, 0xAB, 0x95, 0xDF, 0xA1, 0xB7, 0xFA,
+	0xBB, 0xDB, 0x0E, 0x56, 0x16, 0x00, 0xEE, 0x05, 0xAB, 0x48, 0x80, 0x90, 0xD8, 0x9E, 0xC8, 0xA9,
+	0xC8, 0xA1, 0x38, 0x10, 0x90, 0xBF, 0xCE, 0xA3, 0xC6, 0xE1, 0xD8, 0x8D, 0x1D, 0x0E, 0xCF, 0x10,
+	0x05, 0x73, 0x48, 0xC0, 0xDD, 0x85, 0xB7, 0xA3, 0xC4, 0x9B, 0xA0, 0x63, 0x10, 0xBA, 0x9B, 0xAC,
+	0xA7, 0xF7, 0xE2, 0xC4, 0xB6, 0xAE, 0x01, 0x90, 0x00, 0xED, 0x05, 0xAD, 0x48, 0xC8, 0xA1, 0x99,
+	0xEA, 0xE8, 0xB8, 0xDE, 0xA3, 0xDB, 0x01, 0x10, 0x9B, 0xAF, 0xED, 0xF7, 0xBC, 0xB4, 0x9A, 0x98,
+	0x41, 0x24, 0x00, 0xFA, 0x05, 0x3A, 0x44, 0xFB, 0xDB, 0xC5, 0x84, 0xC6, 0x9E, 0xB3, 0xA6, 0x11,
+	0x10, 0x97, 0xD3, 0x90, 0xA1, 0x88, 0xE5, 0xD4, 0x8F, 0x12, 0x18, 0x0E, 0x00, 0x9F, 0x45, 0x07,
+	0x48, 0xE5, 0xDE, 0xCB, 0xD3, 0x94, 0x8E, 0xE8, 0xA4, 0xD9, 0x01, 0x10, 0xA2, 0xA7, 0x80, 0x85,
+	0xD4, 0xC9, 0xA3, 0xFD, 0x0E, 0x26, 0x18, 0x00, 0x8A, 0x05, 0x1D, 0x48, 0xCA, 0xD5, 0x94, 0x85,
+	0xF1, 0xD3, 0xC6, 0xA4, 0xF6, 0x01, 0x10, 0xA3, 0xB7, 0xD3, 0xCB, 0xF9, 0xBE, 0xF9, 0xE1, 0x0E,
+	0x92, 0x0F, 0x00, 0x89, 0x05, 0x1D, 0x48, 0xFF, 0xDB, 0xF1, 0xFD, 0xBE, 0x96, 0xFE, 0xA2, 0xCE,
+	0x01, 0x10, 0xBE, 0x81, 0xB3, 0xAD, 0x9F, 0xA6, 0xCC, 0x91, 0x61, 0xBD, 0x00, 0x88, 0x05, 0x1D,
+	0x44, 0xED, 0xB5, 0xE0, 0xB6, 0xFE, 0xB7, 0xF4, 0xA0, 0x7F, 0x10, 0x9C, 0x8F, 0xBF, 0x86, 0xB3,
+	0x80, 0x89, 0xD3, 0x12, 0x38, 0x09, 0x00, 0x87, 0x05, 0x1D, 0x48, 0x9C, 0xB2, 0x90, 0xFF, 0x87,
+	0x88, 0xEC, 0xA1, 0x48, 0x10, 0xBB, 0x9F, 0xF2, 0xC7, 0xFB, 0xB9, 0x81, 0xF8, 0xEF, 0x01, 0xCB,
+	0x00, 0x86, 0x05, 0x1D, 0x5C, 0xA1, 0xD9, 0xE5, 0xA9, 0xDF, 0x8D, 0x8B, 0xA5, 0xC6, 0x01, 0x10,
+	0x9A, 0xC5, 0x83, 0x81, 0xFB, 0xC1, 0xAC, 0xA2, 0x48, 0x5A, 0x1B, 0x08, 0x85, 0x05, 0x1D, 0x18,
+	0xB1, 0xAB, 0xB3, 0xE2, 0xDF, 0xA0, 0xCF, 0xE1, 0x25, 0x30, 0x80, 0xB1, 0xE0, 0xCB, 0xDB, 0xE2,
+	0x92, 0xAC, 0x0D, 0x5A, 0x1B, 0x08, 0x84, 0x05, 0x1D, 0x48, 0x8A, 0xF4, 0x99, 0x91, 0xF8, 0x8D,
+	0xA1, 0xA5, 0x65, 0x10, 0x98, 0xEF, 0xE9, 0xED, 0xE5, 0x86, 0x8C, 0x9D, 0x91, 0x01, 0x57, 0x00,
+	0x9E, 0x05, 0x1D, 0x44, 0xB1, 0xBD, 0xA4, 0xAC, 0xF3, 0x81, 0x95, 0xA2, 0x41, 0x10, 0x87, 0x91,
+	0xC9, 0x83, 0xB2, 0xD8, 0xFE, 0x94, 0x25, 0x3F, 0x00, 0x9D, 0x05, 0x1D, 0x4C, 0x9F, 0x8C, 0xAA,
+	0xE7, 0xD6, 0xEC, 0xCF, 0xA5, 0x30, 0x10, 0x98, 0x91, 0xF1, 0xD8, 0xA0, 0xD6, 0xEC, 0xC7, 0xCE,
+	0x01, 0x0E, 0x30, 0x13, 0x65, 0x0C, 0x48, 0xAA, 0xEE, 0xF2, 0xAC, 0x9A, 0xB5, 0xB5, 0xA0, 0xC8,
+	0x01, 0x10, 0xB1, 0x85, 0xB6, 0xAF, 0xFC, 0xA4, 0x96, 0xF8, 0x12, 0x2C, 0x08, 0x00, 0x9B, 0x05,
+	0x1E, 0x4C, 0xE1, 0x90, 0x83, 0xD7, 0x99, 0xBD, 0xD7, 0xA7, 0xDA, 0x01, 0x10, 0x83, 0xCB, 0x8A,
+	0xC8, 0xFA, 0xE6, 0xA4, 0xBF, 0xEB, 0x01, 0x3C, 0x00, 0x9A, 0x05, 0x1E, 0x4C, 0xA1, 0x82, 0xD5,
+	0xA8, 0xEA, 0x8C, 0xE7, 0xA3, 0xEE, 0x01, 0x10, 0x87, 0xC1, 0x99, 0xAE, 0x9A, 0xBB, 0xB4, 0xBD,
+	0x8F, 0x41, 0x0B, 0x04, 0x99, 0xDB, 0x41, 0x0B, 0x58, 0xA6, 0xBB, 0x91, 0xA0, 0xA4, 0xBF, 0x9A,
+	0xA5, 0x33, 0x10, 0x9A, 0x87, 0xE2, 0xE5, 0xAC, 0xBA, 0xDA, 0x81, 0x56, 0x5A, 0x1B, 0x08, 0x98,
+	0x05, 0x93, 0x48, 0xCE, 0xB2, 0xBB, 0xB6, 0xA9, 0xE9, 0xC5, 0xA1, 0x09, 0x10, 0x89, 0x8B, 0x9E,
+	0xE2, 0x8F, 0xFB, 0xE0, 0xB0, 0xD8, 0x01, 0xCD, 0x00, 0x97, 0x05, 0x1D, 0x48, 0x85, 0xE4, 0xC0,
+	0xC0, 0xD8, 0xD6, 0xE3, 0xA0, 0x80, 0x01, 0x10, 0x9D, 0xD9, 0xE4, 0xD7, 0xD4, 0x87, 0xC9, 0xBB,
+	0x0E, 0xE1, 0x22, 0x00, 0x96, 0x05, 0x1D, 0x4C, 0xD4, 0xEA, 0xB3, 0xA6, 0xA5, 0x9E, 0xB6, 0xA5,
+	0x8F, 0x01, 0x10, 0x89, 0xB5, 0xE9, 0xB6, 0xDC, 0xC4, 0x85, 0xBE, 0x15, 0x0E, 0x14, 0x0D, 0x05,
+	0x1D, 0x48, 0xB0, 0x99, 0xC2, 0xAD, 0xA9, 0x8E, 0xCB, 0xA0, 0x10, 0x10, 0xBB, 0xE5, 0xE3, 0xA0,
+	0x8E, 0xAD, 0x91, 0x9E, 0xF2, 0x01, 0x90, 0x00, 0xF6, 0x45, 0x7F, 0x58, 0xEB, 0xFF, 0x8F, 0xD0,
+	0x9E, 0xB8, 0x8D, 0xA3, 0x7A, 0x10, 0xBD, 0xF3, 0x8A, 0xE4, 0xC0, 0xAC, 0xEA, 0xC6, 0x5F, 0x5A,
+	0x1B, 0x08, 0x83, 0x05, 0x39, 0x48, 0x85, 0x97, 0x86, 0x91, 0xF7, 0xE1, 0xCF, 0xA0, 0x33, 0x10,
+	0xB2, 0xC5, 0xF8, 0xD6, 0xD4, 0x94, 0xA4, 0xC6, 0xE8, 0x01, 0x39, 0x00, 0x94, 0x05, 0xC9, 0x58,
+	0xE1, 0xDC, 0xB9, 0xCF, 0xFB, 0x99, 0xDB, 0xA7, 0x17, 0x10, 0x99, 0xDF, 0xC8, 0xC2, 0x9E, 0xAA,
+	0xF4, 0x99, 0x08, 0x5A, 0x1C, 0x08, 0x93, 0x25, 0x03, 0x44, 0xF4, 0xD3, 0xEC, 0x88, 0xB2, 0xDA,
+	0xA2, 0xA4, 0xC2, 0x01, 0x10, 0xB5, 0x9B, 0xCA, 0xEC, 0xB7, 0xC3, 0x9D, 0x0E, 0x57, 0x0A, 0x08,
+	0x1B, 0x08, 0x92, 0x05, 0x57, 0x48, 0x8F, 0xD9, 0x9D, 0xEE, 0xDD, 0x8F, 0xDD, 0xA0, 0xED, 0x01,
+	0x10, 0xBF, 0xE7, 0xC6, 0xA8, 0xC2, 0xC3, 0xBF, 0xD8, 0x0E, 0xFD, 0x21, 0x00, 0x91, 0x05, 0x57,
+	0x44, 0xDD, 0xBC, 0xCD, 0x8E, 0xFC, 0xD4, 0xAC, 0x21, 0x10, 0x94, 0xA3, 0xAD, 0xBF, 0xCD, 0xFD,
+	0xB4, 0xB3, 0xC6, 0x21, 0x03, 0x00, 0x90, 0x05, 0x39, 0x5C, 0xE2, 0xDA, 0xCD, 0xD2, 0xA9, 0xDA,
+	0x9B, 0xA3, 0xA3, 0x01, 0x10, 0x9E, 0xF9, 0xEE, 0xD8, 0x91, 0xE0, 0xA8, 0xD6, 0x43, 0x5A, 0x1A,
+	0x08, 0x8F, 0x05, 0x39, 0x58, 0xDA, 0xA5, 0xCD, 0xCF, 0xD1, 0xAE, 0xD5, 0xA3, 0x19, 0x10, 0xA7,
+	0xA5, 0x9E, 0xA7, 0x9C, 0xCE, 0xD8, 0xB0, 0x46, 0x5A, 0x1B, 0x08, 0x8E, 0x05, 0x39, 0x48, 0xEE,
+	0x93, 0xE5, 0xB1, 0xFC, 0xB9, 0xE3, 0xA3, 0x2D, 0x10, 0x99, 0x97, 0xA4, 0xFB, 0x93, 0x96, 0xB0,
+	0xA3, 0xE2, 0x01, 0x56, 0x00, 0x8D, 0x05, 0x1D, 0x5C, 0xF6, 0xA6, 0xBC, 0x94, 0xF5, 0xC1, 0x90,
+	0xA1, 0x74, 0x10, 0x8B, 0x81, 0x9F, 0xD1, 0x93, 0xD0, 0xDF, 0xAA, 0x94, 0x01, 0x5A, 0x1B, 0x08,
+	0x8C, 0x05, 0x1D, 0x5C, 0xFA, 0x96, 0xFE, 0xAE, 0xBE, 0x94, 0xD6, 0xA7, 0xB3, 0x01, 0x10, 0x90,
+	0x95, 0x95, 0xAC, 0xDC, 0x84, 0xE7, 0x86, 0x15, 0x5A, 0x1A, 0x08, 0xE9, 0x25, 0x3C, 0x58, 0xF3,
+	0xF4, 0x96, 0xCA, 0xC6, 0x9B, 0xCA, 0xA5, 0x7D, 0x10, 0x9C, 0x8F, 0xE0, 0xFE, 0xBE, 0xEA, 0xAE,
+	0xBD, 0x03, 0x5A, 0x1B, 0x08, 0xF6, 0x65, 0x81, 0x60, 0xB7, 0x8C, 0xEF, 0x93, 0xA1, 0xD2, 0x84,
+	0xA7, 0xC9, 0x01, 0x10, 0x8B, 0xF9, 0xF6, 0x9F, 0xAA, 0xEB, 0xA9, 0xD9, 0x1C, 0x5A, 0x1B, 0x08,
+	0xE8, 0xD7, 0xA1, 0x14, 0x48, 0xF0, 0xF7, 0xDA, 0xE4, 0x96, 0x92, 0xE4, 0xA2, 0x47, 0x10, 0xAF,
+	0xED, 0xFF, 0xD5, 0x94, 0xCE, 0x93, 0xB6, 0xAF, 0x41, 0x40, 0x00, 0xF5, 0xA5, 0x14, 0x18, 0xFD,
+	0x93, 0xC0, 0xA5, 0xD9, 0xAE, 0xF3, 0x0E, 0xC4, 0x14, 0x1C, 0x90, 0xB1, 0xAF, 0x83, 0xF8, 0xA0,
+	0xBE, 0xB3, 0x12, 0x0F, 0x12, 0x00, 0xEC, 0x05, 0x3B, 0x5C, 0x9E, 0xF1, 0xDB, 0x8E, 0xA3, 0xB1,
+	0xDB, 0xA3, 0x91, 0x01, 0x10, 0xBF, 0xBD, 0xB8, 0x94, 0xE2, 0xE5, 0x8F, 0x97, 0x65, 0x5A, 0x1A,
+	0x08, 0xF9, 0x85, 0x68, 0x58, 0x97, 0xF2, 0x93, 0xF7, 0xA4, 0xA7, 0xFA, 0xA6, 0x34, 0x10, 0xBB,
+	0xC3, 0xC6, 0x84, 0xEA, 0xB6, 0xD1, 0x85, 0x04, 0x5A, 0x1B, 0x08, 0xCC, 0x05, 0x91, 0x48, 0xA7,
+	0x9C, 0xDA, 0xEB, 0x93, 0x92, 0xDC, 0xA5, 0xD4, 0x01, 0x10, 0x88, 0xB1, 0xE4, 0xAD, 0xFB, 0xEE,
+	0xFE, 0x96, 0x0E, 0x86, 0x1A, 0x00, 0xCB, 0x05, 0x1D, 0x18, 0xB8, 0xA9, 0xD9, 0xAD, 0x95, 0x86,
+	0xE9, 0x01, 0x56, 0x30, 0x99, 0xB7, 0xFB, 0x95, 0x96, 0xED, 0xCC, 0xE9, 0x19, 0x5A, 0x1A, 0x08,
+	0xD3, 0x05, 0x56, 0x58, 0xB5, 0xA2, 0xB8, 0xBF, 0xDA, 0x86, 0xF1, 0xA4, 0x4D, 0x10, 0xB3, 0xA3,
+	0x8D, 0xEF, 0xA9, 0xC4, 0xB6, 0x99, 0x18, 0x5A, 0x1A, 0x08, 0xD2, 0x05, 0x1C, 0x44, 0xC6, 0xFE,
+	0x82, 0xCF, 0xDC, 0xE6, 0xAA, 0xA3, 0x46, 0x10, 0xBE, 0xFB, 0xB2, 0x9D, 0xA9, 0x81, 0xA8, 0xFD,
+	0x0E, 0x87, 0x0E, 0x00, 0xC4, 0x05, 0xAB, 0x18, 0xFE, 0xCE, 0x99, 0x8F, 0x96, 0xBC, 0xF6, 0x0E,
+	0xC0, 0x0A, 0x30, 0xB4, 0x93, 0xF3, 0xF0, 0xA8, 0xC6, 0x9D, 0xEE, 0x5E, 0x5A, 0x1A, 0x08, 0xD1,
+	0x05, 0x39, 0x58, 0xE9, 0x98, 0xE8, 0x84, 0xC7, 0xC2, 0xEE, 0xA2, 0x7B, 0x10, 0xBA, 0xD3, 0x8F,
+	0xFB, 0xC4, 0xAF, 0x9E, 0xAF, 0x06, 0x5A, 0x1B, 0x08, 0xC3, 0x05, 0x39, 0x48, 0x85, 0xB4, 0x93,
+	0x92, 0x9B, 0x83, 0xF4, 0xA3, 0x17, 0x10, 0xB9, 0xB1, 0xF4, 0xFB, 0xF2, 0xAD, 0xBA, 0xA7, 0xA2,
+	0x21, 0x1F, 0x00, 0xD0, 0x25, 0x1F, 0x4C, 0xDE, 0x96, 0xF9, 0x85, 0xA4, 0xC8, 0xB8, 0xA0, 0xB6,
+	0x01, 0x10, 0xA5, 0xEB, 0xD6, 0xA4, 0x88, 0xE4, 0xB3, 0xC9, 0xB3, 0x21, 0xB0, 0x00, 0xCF, 0x05,
+	0xC9, 0x48, 0x8E, 0xA6, 0x8B, 0x81, 0x9C, 0x95, 0x90, 0xA2, 0x66, 0x10, 0xA6, 0xAD, 0xD0, 0xA1,
+	0xFF, 0xB9, 0xEF, 0xFF, 0xA7, 0x41, 0xB3, 0x00, 0xCE, 0x05, 0x74, 0x58, 0xF4, 0xD3, 0xFC, 0xC7,
+	0xD4, 0xA1, 0xF0, 0xA4, 0x66, 0x10, 0xB4, 0xBF, 0xD7, 0xFC, 0xFD, 0xEB, 0xD3, 0xE7, 0x7A, 0x5A,
+	0x1B, 0x08, 0xE6, 0x05, 0x74, 0x4C, 0xEF, 0xCF, 0xBC, 0xF5, 0xF8, 0x9B, 0x88, 0xA6, 0xA4, 0x01,
+	0x10, 0x8C, 0x8D, 0xA6, 0xD5, 0xBD, 0xD4, 0xE2, 0xFA, 0x2F, 0x0E, 0xAD, 0x15, 0x05, 0x56, 0x44,
+	0x93, 0x87, 0xF8, 0xB4, 0x9C, 0xA1, 0x8C, 0xA6, 0x14, 0x10, 0x84, 0x9F, 0xDB, 0x9F, 0xAF, 0xB3,
+	0x86, 0xC7, 0x12, 0x5C, 0x08, 0x00, 0xE1, 0x05, 0x1D, 0x48, 0xFA, 0xE1, 0xE3, 0xCF, 0xC1, 0xD3,
+	0xB2, 0xA3, 0x96, 0x01, 0x10, 0x9D, 0x89, 0xE7, 0xD5, 0xC4, 0xA4, 0xFC, 0xF9, 0x0E, 0x58, 0x16,
+	0x00, 0xD4, 0x45, 0x23, 0x58, 0xB9, 0xF0, 0xE0, 0xBC, 0xF7, 0xDF, 0x9C, 0xA2, 0x7A, 0x10, 0xA0,
+	0xC9, 0xB0, 0x9E, 0xE0, 0xC3, 0xC2, 0xCF, 0x4D, 0x5A, 0x1B, 0x08, 0xDE, 0x05, 0x39, 0x5C, 0xA0,
+	0xD6, 0xB7, 0xBD, 0xB5, 0xDE, 0xCA, 0xA6, 0xED, 0x01, 0x10, 0xB3, 0xD9, 0xA1, 0xCB, 0xB7, 0x87,
+	0x96, 0x8D, 0x1E, 0x5A, 0x1A, 0x08, 0xE0, 0x05, 0xAC, 0x58, 0x9F, 0xBD, 0x88, 0x89, 0xBE, 0xFC,
+	0xCA, 0xA6, 0x71, 0x10, 0xB2, 0x8D, 0x91, 0xB1, 0x89, 0xA7, 0xD9, 0xA6, 0x17, 0x5A, 0x1C, 0x08,
+	0xD3, 0xC5, 0x6D, 0x48, 0xBE, 0xFD, 0xD0, 0x8F, 0x9B, 0x93, 0xAC, 0xA5, 0x91, 0x01, 0x10, 0xAC,
+	0xDB, 0x8E, 0xF4, 0xFE, 0xD1, 0xEC, 0xE5, 0xA5, 0x4D, 0x00, 0xDD, 0x05, 0x57, 0x44, 0xF1, 0xD9,
+	0xC3, 0x8A, 0x87, 0xB5, 0xA9, 0xA3, 0x3B, 0x10, 0xAB, 0xC5, 0x8C, 0xEF, 0xFD, 0xBD, 0xEA, 0xE3,
+	0x12, 0x89, 0x0B, 0x00, 0xDC, 0x05, 0x1D, 0x48, 0xBF, 0xA2, 0x88, 0xB9, 0xBD, 0xD0, 0xC3, 0xA4,
+	0x7D, 0x10, 0x82, 0xA3, 0xBC, 0x9A, 0xC7, 0x90, 0xD6, 0xAA, 0xD6, 0x21, 0x3D, 0x00, 0xDB, 0x05,
+	0x1D, 0x48, 0x99, 0xB1, 0xAE, 0xDB, 0xBE, 0x90, 0x9D, 0xA4, 0x3E, 0x10, 0x8E, 0x9F, 0xB0, 0xEA,
+	0xF2, 0xA7, 0xAE, 0xB9, 0xC1, 0x01, 0x1D, 0x00, 0xDA, 0x05, 0x1D, 0x18, 0xF0, 0xB9, 0xBF, 0xC9,
+	0x83, 0xE4, 0xD4, 0x0E, 0x1E, 0x16, 0x30, 0xA4, 0xF7, 0x8E, 0x8B, 0xE2, 0xB4, 0xA7, 0x80, 0x7C,
+	0x5A, 0x1C, 0x08, 0xD9, 0x25, 0x95, 0x48, 0xD3, 0xDA, 0xF9, 0xE6, 0xBC, 0xDD, 0xC8, 0xA6, 0xD0,
+	0x01, 0x10, 0xA4, 0xD3, 0x9B, 0xFF, 0xC5, 0xFC, 0x96, 0xFE, 0x12, 0x3E, 0x0D, 0x00, 0xE5, 0x25,
+	0x5C, 0x5C, 0xCC, 0xE1, 0xFF, 0xE1, 0xE2, 0x80, 0xF5, 0xA7, 0xAB, 0x01, 0x10, 0xAC, 0xBD, 0xFE,
+	0xDE, 0x8A, 0xD9, 0xEE, 0x95, 0x6F, 0x5A, 0x1C, 0x08, 0xF2, 0x05, 0x3B, 0x20, 0xE6, 0xA2, 0x9F,
+	0xB7, 0xC7, 0xBE, 0x8C, 0xA4, 0x9A, 0x0E, 0x97, 0x0D, 0x18, 0xF3, 0xBE, 0xB5, 0x81, 0xA2, 0xD0,
+	0xE7, 0x01, 0x76, 0x00, 0xE4, 0x05, 0x3B, 0x48, 0xD6, 0x8E, 0x82, 0xCE, 0xA3, 0xF1, 0xFC, 0xA6,
+	0xF7, 0x01, 0x10, 0xA7, 0xFD, 0x88, 0xCA, 0xF8, 0xB3, 0xE6, 0xEA, 0x0E, 0xC7, 0x2A, 0x00, 0xF1,
+	0x05, 0x93, 0x48, 0xD9, 0xBF, 0x85, 0xA8, 0x95, 0xEF, 0xED, 0xA0, 0xBC, 0x01, 0x10, 0xA3, 0xCB,
+	0xC6, 0xDE, 0xC3, 0xC8, 0xBC, 0xAD, 0x0E, 0x04, 0x0D, 0x00, 0xE3, 0x05, 0x3A, 0x44, 0xB0, 0x99,
+	0x98, 0xD1, 0xC9, 0xD6, 0xC0, 0xA7, 0x12, 0x10, 0x93, 0xB1, 0xB2, 0x80, 0xD6, 0x83, 0x99, 0xEF,
+	0x12, 0xCD, 0x16, 0x00, 0xF0, 0x05, 0x3A, 0x48, 0xC4, 0xA0, 0xEC, 0xEB, 0xBD, 0xE2, 0x8F, 0xA2,
+	0x26, 0x10, 0x93, 0xAD, 0xD8, 0xB0, 0xBA, 0xA9, 0xD3, 0xAB, 0xA1, 0x41, 0x27, 0x00, 0xE2, 0x25,
+	0xB4, 0x44, 0x95, 0x89, 0xA4, 0xFF, 0xF5, 0x8E, 0xF2, 0xA5, 0x7A, 0x10, 0x8D, 0xE5, 0xDA, 0xF7,
+	0xEB, 0xDA, 0xF9, 0x86, 0x0E, 0x65, 0x19, 0x00, 0xEF, 0x25, 0x97, 0x44, 0x87, 0xD8, 0xEC, 0xD4,
+	0xF8, 0x90, 0x9B, 0xA6, 0x31, 0x10, 0x84, 0x83, 0xC2, 0xAE, 0xF2, 0x9A, 0xDC, 0x94, 0x0E, 0x93,
+	0x0D, 0x00, 0xE1, 0x05, 0x72, 0x4C, 0xA7, 0x9D, 0xE1, 0x8D, 0xEE, 0xA8, 0xD2, 0xA4, 0x88, 0x01,
+	0x10, 0x8C, 0xB9, 0xC7, 0x8A, 0xDC, 0x84, 0x8D, 0xF7, 0x1A, 0x0E, 0x6A, 0x21, 0x05, 0x72, 0x44,
+	0xD4, 0xBA, 0xA1, 0xAF, 0xCA, 0xF4, 0xB3, 0xA0, 0x15, 0x10, 0x99, 0x85, 0xC3, 0xF8, 0xF5, 0xBD,
+	0xE3, 0xA4, 0x12, 0xDA, 0x0A, 0x00, 0xE0, 0x25, 0xD1, 0x4C, 0xA1, 0xA6, 0x87, 0x94, 0xB0, 0xB9,
+	0xD6, 0xA2, 0x9E, 0x01, 0x10, 0x97, 0xFF, 0xA1, 0xDD, 0x99, 0xBE, 0xE4, 0xF7, 0xFD, 0x41, 0xF2,
+	0x00, 0xED, 0x25, 0x22, 0x48, 0xBA, 0xF4, 0xBA, 0xA1, 0x8B, 0x93, 0x84, 0xA4, 0x91, 0x01, 0x10,
+	0x9D, 0xC7, 0x97, 0xE7, 0x9E, 0xDB, 0x99, 0xDE, 0x12, 0xEB, 0x08, 0x00, 0xDF, 0x05, 0xAE, 0x44,
+	0xF6, 0xBD, 0xDC, 0x95, 0xAD, 0xB0, 0xA4, 0xA5, 0x31, 0x10, 0x84, 0xA1, 0xB9, 0xF8, 0xD1, 0xEE,
+	0xA7, 0xFD, 0x0E, 0x0D, 0x0A, 0x00, 0xEC, 0x05, 0x75, 0x18, 0x98, 0xC9, 0x88, 0x81, 0xB4, 0xF2,
+	0xB5, 0x0E, 0x4E, 0x29, 0x1C, 0x9D, 0x8B, 0xC0, 0x94, 0xF7, 0xC1, 0xCD, 0x85, 0x0E, 0xB4, 0x17,
+	0x00, 0xDE, 0x05, 0x39, 0x44, 0x8F, 0x82, 0xF6, 0x83, 0xAB, 0xD2, 0x9E, 0xA3, 0x51, 0x10, 0x87,
+	0xA9, 0xDF, 0x99, 0xEA, 0xC9, 0xB4, 0xAF, 0x0E, 0xD9, 0x20, 0x00, 0xEB, 0x05, 0x73, 0x4C, 0xE6,
+	0xE9, 0xA6, 0xB0, 0xED, 0xFE, 0xCF, 0xA3, 0xFC, 0x01, 0x10, 0xA8, 0x9B, 0xA8, 0x99, 0xA7, 0xBF,
+	0xAE, 0xAD, 0xC2, 0x01, 0x91, 0x00, 0xDD, 0x05, 0xAF, 0x18, 0xAE, 0x9F, 0x80, 0x92, 0xBF, 0x84,
+	0xB8, 0x0E, 0x0A, 0x09, 0x1C, 0x80, 0xA9, 0xAE, 0x80, 0x89, 0x98, 0xE1, 0xEE, 0x12, 0x76, 0x0D,
+	0x00, 0xEA, 0x05, 0x3C, 0x48, 0xAB, 0xCE, 0xDE, 0x8B, 0x8A, 0xC3, 0xA9, 0xA2, 0xEA, 0x01, 0x10,
+	0x8E, 0xED, 0xF2, 0xFE, 0xA4, 0xD4, 0xF1, 0xFA, 0xE5, 0x77, 0x00, 0xDC, 0x25, 0x25, 0x48, 0xE7,
+	0xB1, 0xAB, 0xEB, 0x85, 0xBA, 0xA8, 0xA4, 0x28, 0x10, 0x80, 0xE9, 0xA6, 0x91, 0xA2, 0xDD, 0xBA,
+	0x92, 0xC3, 0x01, 0x59, 0x00, 0xE9, 0x05, 0x3B, 0x4C, 0x9C, 0x80, 0xFB, 0xDA, 0xB4, 0xE1, 0x8C,
+	0xA3, 0xC3, 0x01, 0x10, 0xAA, 0xD5, 0xC9, 0xE3, 0xEF, 0x82, 0xB9, 0xF0, 0xD8, 0x41, 0x0C, 0x00,
+	0xDB, 0x05, 0x3B, 0x44, 0xB4, 0x9F, 0xFB, 0x96, 0x9C, 0xEE, 0xC2, 0xA6, 0x5E, 0x10, 0xA8, 0xAD,
+	0xD4, 0x88, 0xAD, 0x94, 0xB1, 0xC6, 0x12, 0x33, 0x21, 0x00, 0xE8, 0x05, 0xEB, 0x48, 0x9A, 0x8A,
+	0xF3, 0xAB, 0xCE, 0x9A, 0xC5, 0xA3, 0x05, 0x10, 0xB0, 0xC7, 0x9F, 0xEF, 0xBE, 0xEF, 0xE7, 0x84,
+	0xF4, 0x01, 0x3A, 0x00, 0xE7, 0x05, 0x1D, 0x48, 0x87, 0xE0, 0xE6, 0xBF, 0xAA, 0xCF, 0xC8, 0xA5,
+	0x78, 0x10, 0x93, 0x87, 0xC1, 0xED, 0xAE, 0xA5, 0xFA, 0xDE, 0xD0, 0x21, 0xEF, 0x00, 0xA7, 0x12,
+	0xDD, 0x13, 0x58, 0xC3, 0x9A, 0xBC, 0xF1, 0x92, 0xF0, 0xF7, 0xA7, 0x45, 0x10, 0x9F, 0xD3, 0xBF,
+	0xB8, 0xA1, 0x85, 0xF5, 0xE5, 0x45, 0x5A, 0x1C, 0x08, 0xE2, 0x05, 0x91, 0x4C, 0xC5, 0xEA, 0xFE,
+	0xEB, 0xD1, 0x99, 0xFD, 0xA6, 0xC9, 0x01, 0x10, 0xA3, 0xA3, 0xEA, 0xDB, 0x8B, 0x9C, 0xB1, 0x86,
+	0x8D, 0x01, 0xAF, 0x00, 0xA6, 0x12, 0xC0, 0x13, 0x4C, 0xFD, 0x96, 0x81, 0x81, 0xFD, 0xBD, 0xC0,
+	0xA4, 0x8B, 0x01, 0x10, 0xBA, 0x8F, 0xCE, 0xDD, 0xE8, 0xEF, 0xF8, 0xA0, 0x89, 0x01, 0x1E, 0x00,
+	0xA5, 0x05, 0x1E, 0x18, 0x8F, 0xDA, 0xCA, 0x8F, 0xBB, 0x8E, 0xF2, 0x0E, 0xD9, 0x2D, 0x20, 0xBD,
+	0xC3, 0xDF, 0xFA, 0xA0, 0xE9, 0xE6, 0xAB, 0xBA, 0x01, 0x93, 0x00, 0xDF, 0x05, 0x93, 0x48, 0xB5,
+	0xB6, 0xA6, 0x95, 0xE5, 0x95, 0x90, 0xA4, 0x76, 0x10, 0x86, 0xE7, 0x88, 0xEF, 0xEF, 0xE0, 0xBB,
+	0xE6, 0xE6, 0x01, 0x3B, 0x00, 0xD6, 0x05, 0x77, 0x48, 0xB5, 0xA8, 0xF1, 0x9B, 0xD7, 0x84, 0x9A,
+	0xA5, 0xF7, 0x01, 0x10, 0xB6, 0xF5, 0xAB, 0xEA, 0xD0, 0xFE, 0xB0, 0x86, 0xC5, 0xB1, 0x00, 0xD5,
+	0x05, 0x3B, 0x4C, 0xA4, 0xED, 0xDE, 0xF1, 0xC8, 0xA3, 0xF3, 0xA2, 0xB7, 0x01, 0x10, 0xB5, 0xCF,
+	0xEB, 0xE0, 0xE9, 0x81, 0xF7, 0xB1, 0x40, 0x0E, 0x62, 0x2C, 0x05, 0x1D, 0x48, 0x88, 0xAA, 0x9B,
+	0xAC, 0xDF, 0xAF, 0x90, 0xA0, 0x64, 0x10, 0x9E, 0xDF, 0xEF, 0xBA, 0xE9, 0xE9, 0x92, 0xA5, 0xC9,
+	0x01, 0xEB, 0x00, 0xC9, 0x45, 0xBE, 0x58, 0x80, 0xE3, 0xB4, 0x89, 0xC9, 0xFE, 0xC5, 0xA7, 0x74,
+	0x10, 0xA9, 0xED, 0xD6, 0xD6, 0xF0, 0xE7, 0x97, 0xBD, 0x39, 0x5A, 0x1B, 0x08, 0xCD, 0x05, 0x39,
+	0x44, 0xCE, 0x94, 0xF4, 0xFA, 0xB3, 0xAB, 0x88, 0xA0, 0x4A, 0x10, 0x8A, 0xD1, 0x9A, 0x86, 0x89,
+	0xCC, 0xB8, 0xBB, 0x12, 0x6D, 0x19, 0x00, 0xF4, 0x45, 0x2C, 0x58, 0xAD, 0xBC, 0xC9, 0xCA, 0xB6,
+	0xFC, 0xA6, 0xA7, 0x40, 0x10, 0x81, 0xC9, 0xFE, 0xF0, 0xA9, 0xFB, 0xC3, 0x9F, 0x3A, 0x5A, 0x1C,
+	0x08, 0x81, 0xE5, 0xED, 0x18, 0xAD, 0xBA, 0xDB, 0xBA, 0xBA, 0xF6, 0xE3, 0xA1, 0xE7, 0x20, 0x9B,
+	0xC9, 0xD9, 0x8D, 0xED, 0xDC, 0xD0, 0xF5, 0xCB, 0x01, 0xCB, 0x00, 0xE5, 0x05, 0x1E, 0x18, 0xD7,
+	0xC9, 0x90, 0xFC, 0xAC, 0xF7, 0xC0, 0x21, 0x42, 0x20, 0xB6, 0x99, 0x99, 0xAC, 0x91, 0xF5, 0xB2,
+	0x97, 0xB0, 0x21, 0x06, 0x00, 0xA0, 0x05, 0x75, 0x44, 0x8B, 0xD1, 0xFD, 0xB3, 0xEA, 0xDC, 0xC7,
+	0xA6, 0xDE, 0x01, 0x10, 0x98, 0xFB, 0xC3, 0xE8, 0x8D, 0xF5, 0xA7, 0x12, 0x4E, 0x13, 0x00, 0xE4,
+	0xE5, 0x7C, 0x1C, 0xC7, 0x90, 0xD4, 0xC2, 0x90, 0xE3, 0xE5, 0xA0, 0x0E, 0x5A, 0x15, 0x1C, 0xD7,
+	0xFC, 0xD1, 0xD2, 0xB4, 0xCE, 0xD2, 0x71, 0x0E, 0xF8, 0x2D, 0x05, 0x3A, 0x48, 0xC2, 0xBD, 0xE7,
+	0x89, 0xBA, 0xA6, 0x8C, 0xA1, 0x9B, 0x01, 0x10, 0xAA, 0x93, 0xF5, 0xCD, 0xB9, 0x97, 0xA5, 0xBF,
+	0x0E, 0x0F, 0x09, 0x00, 0xEC, 0x05, 0x3A, 0x4C, 0xCC, 0xE5, 0x82, 0xBA, 0xA4, 0xA1, 0xA3, 0xA2,
+	0xC7, 0x01, 0x10, 0x94, 0xE9, 0xAB, 0xA9, 0x92, 0xA7, 0xE8, 0xA5, 0x48, 0x0E, 0xE4, 0x10, 0x05,
+	0x3A, 0x5C, 0x88, 0xC1, 0xA6, 0xA5, 0xDE, 0xB3, 0x94, 0xA0, 0xDC, 0x01, 0x10, 0x8E, 0xD3, 0x9B,
+	0x98, 0xB2, 0x8A, 0xE0, 0xD3, 0x6D, 0x5A, 0x1B, 0x08, 0xEB, 0x05, 0x3A, 0x4C, 0xCE, 0xF7, 0xF0,
+	0xDA, 0xC1, 0xF8, 0x85, 0xA5, 0xE7, 0x01, 0x10, 0xA7, 0xB3, 0x95, 0xF2, 0xC7, 0xF7, 0xC9, 0xEA,
+	0x45, 0x0E, 0xE4, 0x27, 0x45, 0x81, 0x48, 0x9E, 0x89, 0xED, 0xA2, 0xDC, 0xED, 0xFE, 0xA3, 0x1D,
+	0x10, 0xAF, 0xBD, 0x80, 0xB4, 0xA3, 0xB6, 0x96, 0xDA, 0x89, 0x01, 0xCB, 0x00, 0xA6, 0x05, 0x57,
+	0x48, 0xA3, 0xD7, 0xEB, 0xD9, 0xBF, 0xFB, 0x87, 0xA4, 0x0E, 0x10, 0xA2, 0xA1, 0xCA, 0xFC, 0x97,
+	0xD4, 0x98, 0xDE, 0xBF, 0x21, 0x79, 0x00, 0xEA, 0x12, 0x9D, 0x08, 0x58, 0xEA, 0xB1, 0x81, 0xC5,
+	0x90, 0xCC, 0x85, 0xA7, 0x7D, 0x10, 0x89, 0xBB, 0xA9, 0xCB, 0xEE, 0xF6, 0x97, 0x85, 0x20, 0x5A,
+	0x1B, 0x08, 0xA5, 0x05, 0x39, 0x18, 0xFF, 0x89, 0xB7, 0xA9, 0xEB, 0xCC, 0xE8, 0x0E, 0x3F, 0x23,
+	0x1C, 0x9E, 0xEF, 0x94, 0xAA, 0xEC, 0xA9, 0x95, 0xEE, 0x61, 0xC2, 0x00, 0xE9, 0x05, 0x90, 0x18,
+	0xA7, 0xE0, 0xDF, 0x89, 0xA2, 0x95, 0x96, 0x61, 0x89, 0x30, 0xBF, 0xE9, 0xB7, 0x93, 0xA0, 0x92,
+	0xED, 0xA3, 0x40, 0x5A, 0x1C, 0x08, 0xA4, 0x45, 0x27, 0x64, 0xA1, 0xF8, 0x8C, 0xEB, 0xC9, 0x95,
+	0x92, 0xA1, 0xFB, 0x01, 0x10, 0xA9, 0xCB, 0x80, 0xD6, 0xB7, 0xC0, 0xBD, 0xD7, 0xB4, 0x01, 0x5A,
+	0x19, 0x08, 0xE8, 0xDB, 0x0E, 0xE8, 0x0C, 0x54, 0x91, 0xFB, 0x91, 0x93, 0x8A, 0x88, 0x89, 0x26,
+	0x10, 0xA7, 0xE7, 0xD5, 0xBE, 0x8C, 0xBA, 0xD2, 0xB5, 0x67, 0x5A, 0x1A, 0x08, 0xA3, 0x45, 0x08,
+	0x58, 0xC0, 0xE9, 0x85, 0xD0, 0xD4, 0xD5, 0x86, 0xA2, 0x29, 0x10, 0x85, 0x93, 0xFC, 0xA8, 0xC5,
+	0xC9, 0xDF, 0xF2, 0x6C, 0x5A, 0x1B, 0x08, 0xE7, 0x05, 0x72, 0x5C, 0xDA, 0xB8, 0xB0, 0xA1, 0xBA,
+	0xEE, 0xBB, 0xA5, 0xA6, 0x01, 0x10, 0x83, 0x9B, 0xFF, 0xA1, 0xAD, 0x95, 0xD7, 0xF2, 0x71, 0x5A,
+	0x1A, 0x08, 0xA2, 0x05, 0x39, 0x44, 0xFD, 0xBE, 0xEC, 0xE9, 0xB5, 0xF5, 0x89, 0xA0, 0x40, 0x10,
+	0x8D, 0x8B, 0x85, 0xB5, 0x92, 0xE1, 0x86, 0xA7, 0x0E, 0x0E, 0x18, 0x00, 0xC7, 0x05, 0xC8, 0x48,
+	0xA8, 0x9E, 0xE1, 0xB5, 0xBB, 0xCD, 0x95, 0xA3, 0x6F, 0x10, 0x99, 0xB1, 0xCB, 0x93, 0xED, 0xE1,
+	0x8B, 0xAA, 0xD1, 0x41, 0x07, 0x00, 0xB2, 0x05, 0xAB, 0x18, 0xCC, 0xEC, 0x82, 0x89, 0xC6, 0xB9,
+	0xC5, 0x0E, 0xE4, 0x11, 0x1C, 0xA2, 0xFF, 0xC8, 0xAB, 0xC7, 0xA7, 0xC6, 0xBA, 0x65, 0x0D, 0x00,
+	0xB1, 0x05, 0x3B, 0x18, 0xA5, 0xBF, 0xAA, 0xCB, 0xBB, 0xAA, 0x96, 0xC1, 0x21, 0x30, 0xAA, 0xFD,
+	0xFE, 0x96, 0x8F, 0xF2, 0xCC, 0xE3, 0x50, 0x5A, 0x1B, 0x08, 0xB0, 0x05, 0x1D, 0x48, 0xB9, 0xB1,
+	0xE7, 0xF7, 0xDC, 0xFC, 0xA0, 0xA2, 0x72, 0x10, 0xA4, 0xD7, 0xF7, 0xFF, 0xA5, 0xE0, 0xB1, 0xC6,
+	0xAE, 0x01, 0x58, 0x00, 0xA2, 0x85, 0x8B, 0x4C, 0xD4, 0xB3, 0xED, 0xBD, 0xEE, 0xB0, 0xE3, 0xA3,
+	0xD1, 0x01, 0x10, 0xAD, 0xDB, 0x9D, 0xF2, 0xEE, 0x92, 0x8D, 0xC9, 0x9F, 0x01, 0x1E, 0x00, 0xAF,
+	0x05, 0x76, 0x18, 0x8A, 0xB9, 0xCC, 0x9D, 0xCA, 0x88, 0xC0, 0x0E, 0x6A, 0x19, 0x20, 0xA6, 0xFF,
+	0xB8, 0xBD, 0xAC, 0xA0, 0xFA, 0xF4, 0xFA, 0x01, 0x1E, 0x00, 0xAE, 0x05, 0x1E, 0x4C, 0xB5, 0xFE,
+	0x8A, 0xD3, 0x9B, 0x8A, 0xD9, 0xA1, 0xA9, 0x01, 0x10, 0x93, 0x89, 0x9B, 0xC9, 0x9C, 0x87, 0xE8,
+	0xDF, 0xA9, 0x21, 0xD0, 0x00, 0xF2, 0x25, 0x08, 0x48, 0xAF, 0xC4, 0x8B, 0xD3, 0x98, 0xDC, 0xF0,
+	0xA5, 0x04, 0x10, 0x8C, 0xED, 0xFA, 0xCC, 0xE5, 0xDD, 0xDA, 0x82, 0xAC, 0x01, 0x1D, 0x00, 0xAD,
+	0x05, 0x94, 0x48, 0xF5, 0xBF, 0xF1, 0xAD, 0xB0, 0x8B, 0xEA, 0xA3, 0x73, 0x10, 0xA3, 0xF5, 0xFF,
+	0xC4, 0x80, 0xB9, 0xC5, 0xC6, 0xBF, 0x01, 0x58, 0x00, 0xF1, 0x45, 0xF3, 0x18, 0xB2, 0xC4, 0xFC,
+	0x98, 0xBA, 0xFB, 0xFF, 0x01, 0x58, 0x18, 0xA2, 0xF3, 0xED, 0xDE, 0xEF, 0xCC, 0xCE, 0x0E, 0x33,
+	0x2D, 0x08, 0x1B, 0x08, 0xAC, 0x05, 0x3B, 0x48, 0x86, 0xB8, 0xF6, 0x92, 0xA2, 0xF4, 0x8A, 0xA3,
+	0x57, 0x10, 0x92, 0xC9, 0xA2, 0xC2, 0xF9, 0xCE, 0xCE, 0x91, 0xDC, 0x41, 0x28, 0x00, 0xC6, 0x25,
+	0x60, 0x44, 0xBD, 0xFB, 0x88, 0xBE, 0xB3, 0xC0, 0xA0, 0xA6, 0x30, 0x10, 0x98, 0x8B, 0xDC, 0xAF,
+	0xB4, 0xA0, 0xD1, 0x8C, 0x0E, 0x87, 0x09, 0x00, 0xC5, 0x05, 0x1C, 0x58, 0xC7, 0xB4, 0xDF, 0x95,
+	0xD9, 0x99, 0xA6, 0xA4, 0x84, 0x01, 0x10, 0x8C, 0xC9, 0xD8, 0xF7, 0xE5, 0x82, 0xAC, 0x5A, 0x5A,
+	0x1B, 0x08, 0xB7, 0x45, 0x9A, 0x48, 0xAB, 0x9B, 0xE3, 0xB5, 0xAE, 0xC2, 0xCC, 0xA3, 0x30, 0x10,
+	0x89, 0x89, 0x80, 0x97, 0xB0, 0x9C, 0xE0, 0xCF, 0xD9, 0x01, 0xAD, 0x00, 0xC4, 0x05, 0x72, 0x5C,
+	0xAC, 0xB9, 0xDE, 0xF6, 0xB5, 0xC5, 0xE8, 0xA7, 0xD6, 0x01, 0x10, 0xB6, 0xC3, 0xAF, 0x83, 0xE8,
+	0x89, 0xC8, 0x8B, 0x1E, 0x5A, 0x1C, 0x08, 0xC3, 0x25, 0x05, 0x4C, 0xC8, 0xE2, 0xEB, 0xC6, 0x94,
+	0xA7, 0xC8, 0xA0, 0x98, 0x01, 0x10, 0x9C, 0x97, 0x97, 0xBD, 0x99, 0xD3, 0xB7, 0x84, 0xB9, 0x01,
+	0xCB, 0x00, 0xC2, 0x05, 0x1E, 0x48, 0xBE, 0xF7, 0xBA, 0x8A, 0xCE, 0x85, 0xF3, 0xA3, 0xDA, 0x01,
+	0x10, 0xA6, 0xCD, 0x9B, 0x8C, 0xDE, 0x8E, 0xBF, 0xE2, 0x12, 0x83, 0x0F, 0x00, 0xC1, 0x05, 0x59,
+	0x48, 0xB1, 0xFA, 0x8C, 0xD3, 0xCB, 0xD3, 0x9A, 0xA3, 0x08, 0x10, 0xBF, 0x93, 0xF5, 0x99, 0xE5,
+	0xE9, 0xB7, 0xE4, 0xC3, 0x01, 0x76, 0x00, 0xBF, 0x05, 0x1D, 0x48, 0xE0, 0xEE, 0xF9, 0xCC, 0x92,
+	0x94, 0xB2, 0xA1, 0x36, 0x10, 0xBE, 0xB9, 0xCA, 0xC2, 0xA1, 0x99, 0xC6, 0xE1, 0xE9, 0x01, 0xE8,
+	0x00, 0xBE, 0x05, 0xCC, 0x58, 0xCB, 0xF7, 0x8B, 0xB4, 0xF9, 0x9D, 0x8F, 0xA5, 0x1B, 0x10, 0x9C,
+	0xFB, 0xD2, 0x9F, 0xD2, 0x88, 0x8C, 0x8D, 0x39, 0x5A, 0x1C, 0x08, 0xE5, 0x05, 0x74, 0x4C, 0x9D,
+	0xD7, 0xBF, 0xD5, 0xED, 0xB6, 0xEA, 0xA3, 0xD5, 0x01, 0x10, 0x91, 0xF9, 0x9E, 0xE6, 0x8B, 0xDD,
+	0xF1, 0xA5, 0x98, 0x01, 0x57, 0x00, 0xBC, 0x05, 0x57, 0x20, 0x82, 0xE8, 0xD8, 0xB7, 0xEB, 0xE5,
+	0x97, 0xA6, 0xD1, 0x0E, 0x91, 0x0B, 0x28, 0xC9, 0xED, 0xB6, 0xED, 0xBE, 0xD9, 0x3F, 0x5A, 0x1A,
+	0x08, 0xE4, 0x05, 0x57, 0x44, 0x85, 0xB4, 0xF9, 0x85, 0xDD, 0x9B, 0x80, 0xA1, 0x75, 0x10, 0xA0,
+	0xA1, 0xF7, 0x91, 0xBA, 0x84, 0xE9, 0xB8, 0x0E, 0x09, 0x31, 0x00, 0xBB, 0x05, 0x57, 0x18, 0x85,
+	0xFA, 0xDF, 0xF5, 0xF4, 0x82, 0xA0, 0x0E, 0x89, 0x15, 0x20, 0xBC, 0xC7, 0xF6, 0x93, 0xB9, 0x9C,
+	0xF0, 0xE6, 0xE7, 0x01, 0x57, 0x00, 0xA8, 0x12, 0x33, 0x19, 0x48, 0xA1, 0xAC, 0xF2, 0x9E, 0xA2,
+	0xF6, 0xFF, 0xA2, 0x40, 0x10, 0x8C, 0x89, 0xDE, 0x80, 0xF5, 0x8B, 0xAC, 0xAC, 0xA0, 0x01, 0xAE,
+	0x00, 0xE3, 0x05, 0x57, 0x58, 0xD9, 0x9A, 0xD5, 0xA5, 0xDC, 0xAD, 0xDA, 0xA1, 0x5D, 0x10, 0x9E,
+	0xB1, 0x8D, 0xBA, 0xF6, 0xDF, 0x94, 0xCE, 0x13, 0x5A, 0x1A, 0x08, 0xBA, 0x05, 0x1C, 0x58, 0x85,
+	0xDC, 0xBE, 0xDB, 0xD2, 0xE7, 0xF5, 0xA3, 0x39, 0x10, 0xAA, 0xA3, 0xE6, 0xB7, 0x89, 0x97, 0xAE,
+	0xDE, 0x31, 0x5A, 0x1C, 0x08, 0xB9, 0x05, 0x73, 0x4C, 0xDE, 0xFE, 0xC2, 0xFF, 0xED, 0xE7, 0xD2,
+	0xA6, 0xB5, 0x01, 0x10, 0xB3, 0xB9, 0x83, 0xC9, 0x93, 0xD5, 0xF0, 0xA5, 0xB5, 0x01, 0x73, 0x00,
+	0xB6, 0x05, 0xCA, 0x48, 0x96, 0xB2, 0xE7, 0x83, 0xAE, 0xB2, 0xD8, 0xA7, 0x7D, 0x10, 0xA1, 0x91,
+	0xD5, 0x8B, 0xB5, 0xB2, 0xA2, 0x83, 0xB2, 0x01, 0x1D, 0x00, 0xB3, 0x05, 0x1D, 0x18, 0x92, 0xEB,
+	0xF5, 0xDF, 0x85, 0xB9, 0x98, 0x0E, 0xE3, 0x09, 0x30, 0x9D, 0xC3, 0xB8, 0xA6, 0xBC, 0xC7, 0x8A,
+	0xC4, 0x7C, 0x5A, 0x1A, 0x08, 0xB8, 0x05, 0x74, 0x44, 0x86, 0xA8, 0xB2, 0xFB, 0x87, 0x97, 0xA2,
+	0xA7, 0x45, 0x10, 0x81, 0xB5, 0xAF, 0xB6, 0xF9, 0x8B, 0xDC, 0xF3, 0x0E, 0x85, 0x24, 0x00, 0xF5,
+	0x45, 0x0A, 0x48, 0xC3, 0xA7, 0xFB, 0x99, 0xED, 0xF7, 0xD8, 0xA5, 0x2B, 0x10, 0x8B, 0xBD, 0xF2,
+	0xFE, 0x8E, 0x84, 0xBD, 0xE4, 0xEC, 0x01, 0xC9, 0x00, 0x82, 0x85, 0x87, 0x58, 0xB1, 0x99, 0x9A,
+	0xCC, 0xE9, 0xD9, 0xF0, 0xA2, 0x04, 0x10, 0x97, 0x8D, 0x96, 0xE7, 0xBB, 0xE7, 0xCE, 0xD1, 0x66,
+	0x5A, 0x1C, 0x08, 0xE6, 0x45, 0xB6, 0x18, 0x8F, 0x9E, 0xF4, 0xCC, 0xFD, 0xC7, 0xC5, 0x0E, 0x91,
+	0x20, 0x1C, 0xA3, 0xFF, 0xE6, 0xD8, 0x98, 0xBF, 0x8C, 0xC2, 0x12, 0x96, 0x1C, 0x00, 0xA1, 0x05,
+	0x73, 0x58, 0x8F, 0xFC, 0xC9, 0xF4, 0x84, 0xD4, 0x81, 0xA3, 0x59, 0x10, 0xB8, 0x81, 0xED, 0xBE,
+	0x81, 0xC6, 0x8F, 0x84, 0x33, 0x5A, 0x1B, 0x08, 0xB4, 0x05, 0xAC, 0x44, 0xF3, 0x93, 0x90, 0xE6,
+	0x91, 0xBC, 0xE9, 0xA3, 0x4F, 0x10, 0x81, 0xAF, 0xCC, 0x8D, 0xD8, 0xE8, 0xF9, 0xDB, 0x12, 0x54,
+	0x0A, 0x00, 0xD8, 0x05, 0x1D, 0x5C, 0xCD, 0xBE, 0xFF, 0xEB, 0xCF, 0xC2, 0xB8, 0xA6, 0xA5, 0x01,
+	0x10, 0x92, 0xAF, 0xD0, 0x90, 0x9E, 0x8A, 0xEF, 0x83, 0x04, 0x5A, 0x1A, 0x08, 0x9D, 0x05, 0x56,
+	0x58, 0xE0, 0xF0, 0xCA, 0xAF, 0xB1, 0x81, 0xDD, 0xA3, 0x3C, 0x10, 0xB6, 0xE5, 0xB6, 0xCC, 0xDD,
+	0x95, 0xC7, 0x97, 0x5C, 0x5A, 0x1B, 0x08, 0xD7, 0x05, 0x39, 0x5C, 0xE2, 0x8A, 0xB6, 0xDF, 0xE7,
+	0xC8, 0xC1, 0xA3, 0xC4, 0x01, 0x10, 0x82, 0x8F, 0x97, 0xD5, 0xB0, 0xEF, 0xBC, 0xFA, 0x1F, 0x5A,
+	0x1A, 0x08, 0x8B, 0x05, 0xC9, 0x44, 0xDD, 0xBC, 0x8B, 0x96, 0xEE, 0xCD, 0xC6, 0xA4, 0x51, 0x10,
+	0x91, 0xA9, 0xC0, 0xD5, 0xBB, 0xEF, 0xAD, 0xDB, 0x0E, 0xF9, 0x2C, 0x00, 0xEF, 0x65, 0xB9, 0x5C,
+	0x9E, 0xAB, 0x87, 0x95, 0x95, 0xD9, 0x9F, 0xA6, 0x8F, 0x01, 0x10, 0xAB, 0xBD, 0xBB, 0xD1, 0xF2,
+	0xDF, 0x9D, 0xB1, 0x05, 0x5A, 0x1A, 0x08, 0xAA, 0x05, 0x72, 0x44, 0xB6, 0xB0, 0xB0, 0xB9, 0x86,
+	0x91, 0x86, 0x25, 0x10, 0xBE, 0xF3, 0xAD, 0xF5, 0xD8, 0xB5, 0x97, 0xCB, 0xB1, 0x41, 0xED, 0x00,
+	0xB7, 0x25, 0xAF, 0x4C, 0xCA, 0x90, 0xB6, 0xEE, 0x95, 0x84, 0xEE, 0xA5, 0x89, 0x01, 0x10, 0xA1,
+	0x9F, 0x8F, 0xF4, 0xCF, 0xCC, 0xCD, 0xA1, 0xCA, 0x21, 0x92, 0x00, 0xC0, 0x05, 0x90, 0x4C, 0xA3,
+	0xA8, 0xCB, 0xFA, 0xDA, 0xFD, 0xA1, 0xA1, 0xE6, 0x01, 0x10, 0x98, 0x95, 0x91, 0xB7, 0xDD, 0xFA,
+	0xD6, 0xD5, 0x53, 0x0E, 0xDE, 0x09, 0x05, 0x74, 0x5C, 0xD8, 0xFE, 0xE5, 0xF9, 0xA2, 0x91, 0xD5,
+	0xA1, 0xC8, 0x01, 0x10, 0x87, 0xE1, 0xCF, 0xD7, 0xFF, 0xF9, 0x81, 0x89, 0x1C, 0x5A, 0x1B, 0x08,
+	0xA9, 0x05, 0x3A, 0x48, 0xB2, 0xE4, 0x8E, 0xD8, 0xEB, 0x86, 0x97, 0xA6, 0x12, 0x10, 0xB7, 0xD9,
+	0x96, 0xDD, 0xD2, 0xE7, 0xB6, 0xA8, 0x84, 0x01, 0x75, 0x00, 0xB5, 0x05, 0x75, 0x4C, 0x92, 0x9B,
+	0xD0, 0xCB, 0xFA, 0xE5, 0x90, 0xA4, 0x85, 0x01, 0x10, 0x9F, 0x9B, 0xF4, 0xFD, 0xDB, 0xE8, 0x80,
+	0xC9, 0xBC, 0x21, 0xB1, 0x00, 0xE3, 0x05, 0xE8, 0x44, 0xDB, 0x8D, 0xA8, 0xD4, 0xC1, 0xCF, 0x88,
+	0xA2, 0x59, 0x10, 0x91, 0xA9, 0xA8, 0xBE, 0x99, 0x87, 0xC7, 0xC9, 0xC1, 0x38, 0x00, 0x9E, 0x05,
+	0x57, 0x4C, 0x9F, 0xFF, 0xA8, 0x9E, 0xD1, 0xDB, 0xEF, 0xA3, 0xF4, 0x01, 0x10, 0xBA, 0xE7, 0xA1,
+	0xB1, 0xA2, 0xB7, 0x81, 0xFD, 0x74, 0x0E, 0xCA, 0x12, 0x05, 0x91, 0x18, 0x9A, 0xBA, 0xEE, 0xD4,
+	0x83, 0xEE, 0xF5, 0x0E, 0x9F, 0x33, 0x20, 0x8F, 0x8D, 0xB0, 0xBA, 0xE7, 0xCC, 0xE0, 0xF3, 0x4C,
+	0x0E, 0x1B, 0x36, 0x25, 0x05, 0x58, 0xD3, 0xF8, 0xD6, 0x9C, 0xBE, 0xE7, 0x8E, 0xA7, 0x76, 0x10,
+	0x81, 0xE1, 0xF7, 0xF8, 0x93, 0xF5, 0xB0, 0xCA, 0x63, 0x5A, 0x1A, 0x08, 0xBD, 0x05, 0x1C, 0x48,
+	0x9E, 0xFF, 0xDD, 0xA7, 0x8F, 0xF7, 0x95, 0xA5, 0x6E, 0x10, 0xB6, 0xD1, 0xB3, 0xC3, 0xE1, 0xA1,
+	0xE6, 0xE8, 0x2D, 0x41, 0x23, 0x05, 0xAC, 0x50, 0xF8, 0xB6, 0xDA, 0xD5, 0xAD, 0xB0, 0xB4, 0xA7,
+	0xE1, 0x01, 0x10, 0x8F, 0xF9, 0xEE, 0xCC, 0xF3, 0xC9, 0xA1, 0xA2, 0x91, 0x01, 0x0E, 0x25, 0x38,
+	0x18, 0x9C, 0x2E, 0x08, 0x01, 0x12, 0x08, 0x44, 0x1A, 0xB4, 0x37, 0x26, 0xAA, 0x37, 0x04, 0x32,
+	0x08, 0x0E, 0xCE, 0x37, 0x14, 0x10, 0x95, 0xE0, 0x69, 0x32, 0x04, 0x01, 0x0A, 0x0D, 0x10, 0x04,
+	0xA6, 0xDC, 0x11, 0x0A, 0x00, 0xA5, 0x15, 0x0A, 0x00, 0xA1, 0x15, 0x0A, 0x04, 0xFF, 0xDF, 0x11,
+	0x1E, 0x00, 0xA0, 0x15, 0x14, 0x00, 0x9F, 0x15, 0x0A, 0x00, 0x9E, 0x15, 0x0A, 0x00, 0x9D, 0x15,
+	0x0A, 0x00, 0x9C, 0x15, 0x0A, 0x00, 0x9B, 0x15, 0x0A, 0x00, 0x9A, 0x15, 0x0A, 0x00, 0x99, 0x15,
+	0x0A, 0x00, 0x98, 0x15, 0x0A, 0x00, 0x97, 0x15, 0x0A, 0x00, 0x96, 0x15, 0x0A, 0x00, 0x95, 0x15,
+	0x0A, 0x00, 0x94, 0x15, 0x0A, 0x00, 0x93, 0x15, 0x0A, 0x00, 0x92, 0x15, 0x0A, 0x00, 0x91, 0x15,
+	0x0A, 0x00, 0x90, 0x15, 0x0A, 0x00, 0x8F, 0x15, 0x0A, 0x00, 0x8E, 0x15, 0x0A, 0x00, 0x8D, 0x15,
+	0x0A, 0x00, 0x8C, 0x15, 0x0A, 0x00, 0x8B, 0x15, 0x0A, 0x00, 0x8A, 0x15, 0x0A, 0x00, 0x89, 0x15,
+	0x0A, 0x00, 0x88, 0x15, 0x0A, 0x00, 0x87, 0x15, 0x0A, 0x00, 0x86, 0x15, 0x0A, 0x00, 0x85, 0x15,
+	0x0A, 0x00, 0x83, 0x15, 0x0A, 0x00, 0x82, 0x15, 0x0A, 0x00, 0x81, 0x15, 0x0A, 0x00, 0x80, 0x15,
+	0x0A, 0x04, 0xFF, 0xDB, 0x31, 0x4A, 0x00, 0xFE, 0x15, 0x0A, 0x00, 0xFD, 0x15, 0x0A, 0x00, 0xFC,
+	0x15, 0x0A, 0x00, 0xFB, 0x15, 0x0A, 0x00, 0xFA, 0x15, 0x0A, 0x00, 0xF9, 0x15, 0x0A, 0x00, 0xF7,
+	0x15, 0x0A, 0x00, 0xF6, 0x15, 0x0A, 0x00, 0xF5, 0x15, 0x0A, 0x00, 0xF4, 0x15, 0x0A, 0x00, 0xF3,
+	0x15, 0x0A, 0x00, 0xF2, 0x15, 0x0A, 0x00, 0xF1, 0x15, 0x0A, 0x00, 0xF0, 0x15, 0x0A, 0x00, 0xEF,
+	0x15, 0x0A, 0x00, 0xEE, 0x15, 0x0A, 0x00, 0xED, 0x15, 0x0A, 0x00, 0xEC, 0x15, 0x0A, 0x00, 0xEB,
+	0x15, 0x0A, 0x00, 0xEA, 0x15, 0x0A, 0x00, 0xE9, 0x15, 0x0A, 0x00, 0xE8, 0x15, 0x0A, 0x00, 0xE7,
+	0x15, 0x0A, 0x00, 0xE6, 0x15, 0x0A, 0x00, 0xE5, 0x15, 0x0A, 0x00, 0xE4, 0x15, 0x0A, 0x00, 0xE3,
+	0x15, 0x0A, 0x00, 0xE2, 0x15, 0x0A, 0x00, 0xE1, 0x15, 0x0A, 0x00, 0xE0, 0x15, 0x0A, 0x00, 0xDF,
+	0x15, 0x0A, 0x00, 0xDE, 0x15, 0x0A, 0x00, 0xDD, 0x15, 0x0A, 0x00, 0xDC, 0x15, 0x0A, 0x00, 0xDB,
+	0x15, 0x0A, 0x00, 0xDA, 0x15, 0x0A, 0x00, 0xD9, 0x15, 0x0A, 0x00, 0xD7, 0x15, 0x0A, 0x00, 0xD6,
+	0x15, 0x0A, 0x00, 0xD5, 0x15, 0x0A, 0x00, 0xD4, 0x15, 0x0A, 0x00, 0xB1, 0x15, 0x0A, 0x00, 0xB0,
+	0x15, 0x0A, 0x00, 0xAF, 0x15, 0x0A, 0x00, 0xAE, 0x15, 0x0A, 0x00, 0xAD, 0x15, 0x0A, 0x00, 0x9E,
+	0x15, 0x0A, 0x00, 0x9D, 0x15, 0x0A, 0x00, 0x9B, 0x15, 0x0A, 0x00, 0x9A, 0x15, 0x0A, 0x00, 0x99,
+	0x15, 0x0A, 0x00, 0x98, 0x15, 0x0A, 0x00, 0x97, 0x15, 0x0A, 0x00, 0x95, 0x15, 0x0A, 0x00, 0x94,
+	0x15, 0x0A, 0x00, 0x93, 0x15, 0x0A, 0x00, 0x92, 0x15, 0x0A, 0x00, 0x91, 0x15, 0x0A, 0x00, 0x8C,
+	0x15, 0x0A, 0x00, 0x8B, 0x15, 0x0A, 0x00, 0x8A, 0x15, 0x0A, 0x00, 0x89, 0x15, 0x0A, 0x00, 0x87,
+	0x15, 0x0A, 0x00, 0x86, 0x15, 0x0A, 0x00, 0x85, 0x15, 0x0A, 0x00, 0x84, 0x15, 0x0A, 0x00, 0x83,
+	0x15, 0x0A, 0x00, 0x81, 0x15, 0x0A, 0x04, 0xF7, 0xDA, 0x51, 0xB2, 0x00, 0xF6, 0x15, 0x0A, 0x00,
+	0xF5, 0x15, 0x0A, 0x00, 0xF3, 0x15, 0x0A, 0x00, 0xF2, 0x15, 0x0A, 0x00, 0xF1, 0x15, 0x0A, 0x00,
+	0xF0, 0x15, 0x0A, 0x00, 0xEF, 0x15, 0x0A, 0x00, 0xEE, 0x15, 0x0A, 0x00, 0xED, 0x15, 0x0A, 0x00,
+	0xEC, 0x15, 0x0A, 0x00, 0xEB, 0x15, 0x0A, 0x00, 0xEA, 0x15, 0x0A, 0x00, 0xE9, 0x15, 0x0A, 0x00,
+	0xE8, 0x15, 0x0A, 0x00, 0xE7, 0x15, 0x0A, 0x00, 0xE6, 0x15, 0x0A, 0x00, 0xE5, 0x15, 0x0A, 0x00,
+	0xE4, 0x15, 0x0A, 0x00, 0xE3, 0x15, 0x0A, 0x00, 0xE2, 0x15, 0x0A, 0x00, 0xE1, 0x15, 0x0A, 0x00,
+	0xE0, 0x15, 0x0A, 0x00, 0xDF, 0x15, 0x0A, 0x00, 0xDE, 0x15, 0x0A, 0x00, 0xDD, 0x15, 0x0A, 0x00,
+	0xDC, 0x15, 0x0A, 0x00, 0xDB, 0x15, 0x0A, 0x00, 0xDA, 0x15, 0x0A, 0x00, 0xD9, 0x15, 0x0A, 0x00,
+	0xD8, 0x15, 0x0A, 0x00, 0xD7, 0x15, 0x0A, 0x00, 0xD6, 0x15, 0x0A, 0x00, 0xD5, 0x15, 0x0A, 0x00,
+	0xD3, 0x15, 0x0A, 0x00, 0xD2, 0x15, 0x0A, 0x00, 0xD1, 0x15, 0x0A, 0x00, 0xD0, 0x15, 0x0A, 0x00,
+	0xCF, 0x15, 0x0A, 0x00, 0xCE, 0x15, 0x0A, 0x00, 0xCD, 0x15, 0x0A, 0x00, 0xCC, 0x15, 0x0A, 0x00,
+	0xCB, 0x15, 0x0A, 0x00, 0xCA, 0x15, 0x0A, 0x00, 0xC9, 0x15, 0x0A, 0x00, 0xC7, 0x15, 0x0A, 0x00,
+	0xC6, 0x15, 0x0A, 0x00, 0xC5, 0x15, 0x0A, 0x00, 0xC4, 0x15, 0x0A, 0x00, 0xC3, 0x15, 0x0A, 0x00,
+	0xC2, 0x15, 0x0A, 0x00, 0xC1, 0x15, 0x0A, 0x00, 0xC0, 0x15, 0x0A, 0x00, 0xBF, 0x15, 0x0A, 0x00,
+	0xBE, 0x15, 0x0A, 0x00, 0xBD, 0x15, 0x0A, 0x00, 0xBC, 0x15, 0x0A, 0x00, 0xBB, 0x15, 0x0A, 0x00,
+	0xBA, 0x15, 0x0A, 0x00, 0xB9, 0x15, 0x0A, 0x00, 0xB8, 0x15, 0x0A, 0x00, 0xB7, 0x15, 0x0A, 0x00,
+	0xB6, 0x15, 0x0A, 0x00, 0xB5, 0x15, 0x0A, 0x00, 0xB4, 0x15, 0x0A, 0x00, 0xB3, 0x15, 0x0A, 0x00,
+	0xB2, 0x15, 0x0A, 0x00, 0xB1, 0x15, 0x0A, 0x00, 0xB0, 0x15, 0x0A, 0x00, 0xAF, 0x15, 0x0A, 0x00,
+	0xAE, 0x15, 0x0A, 0x00, 0xAD, 0x15, 0x0A, 0x00, 0xAC, 0x15, 0x0A, 0x00, 0xAB, 0x15, 0x0A, 0x00,
+	0xAA, 0x15, 0x0A, 0x00, 0xA9, 0x15, 0x0A, 0x00, 0xA7, 0x15, 0x0A, 0x00, 0xA6, 0x15, 0x0A, 0x00,
+	0xA5, 0x15, 0x0A, 0x00, 0xA4, 0x15, 0x0A, 0x00, 0xA3, 0x15, 0x0A, 0x00, 0xA2, 0x15, 0x0A, 0x00,
+	0xA1, 0x15, 0x0A, 0x00, 0xA0, 0x15, 0x0A, 0x00, 0x9F, 0x15, 0x0A, 0x00, 0x9E, 0x15, 0x0A, 0x00,
+	0x9D, 0x15, 0x0A, 0x00, 0x9B, 0x15, 0x0A, 0x00, 0x9A, 0x15, 0x0A, 0x00, 0x99, 0x15, 0x0A, 0x00,
+	0x97, 0x15, 0x0A, 0x00, 0x96, 0x15, 0x0A, 0x00, 0x95, 0x15, 0x0A, 0x00, 0x94, 0x15, 0x0A, 0x00,
+	0x93, 0x15, 0x0A, 0x00, 0x92, 0x15, 0x0A, 0x00, 0x91, 0x15, 0x0A, 0x00, 0x90, 0x15, 0x0A, 0x00,
+	0x8F, 0x15, 0x0A, 0x00, 0x8E, 0x15, 0x0A, 0x00, 0x8D, 0x15, 0x0A, 0x00, 0x8C, 0x15, 0x0A, 0x00,
+	0x8B, 0x15, 0x0A, 0x00, 0x8A, 0x15, 0x0A, 0x00, 0x89, 0x15, 0x0A, 0x00, 0x98, 0x15, 0x0A, 0x00,
+	0xAA, 0x95, 0x2E, 0x04, 0xCB, 0xD7, 0x91, 0x2E, 0x00, 0xAB, 0x15, 0x14, 0x00, 0xCC, 0x15, 0x14,
+	0x00, 0x85, 0x15, 0x32, 0x00, 0x88, 0x15, 0x0A, 0x00, 0x87, 0x15, 0x0A, 0x00, 0x86, 0x15, 0x0A,
+	0x00, 0x84, 0x15, 0x0A, 0x00, 0x82, 0x15, 0x0A, 0x00, 0x81, 0x15, 0x0A, 0x00, 0x80, 0x15, 0x0A,
+	0x04, 0xFE, 0xD9, 0x11, 0x6E, 0x00, 0xFD, 0x15, 0x0A, 0x00, 0xFC, 0x15, 0x0A, 0x00, 0xFB, 0x15,
+	0x0A, 0x00, 0xFA, 0x15, 0x0A, 0x00, 0xF9, 0x15, 0x0A, 0x00, 0xF8, 0x15, 0x0A, 0x00, 0xF7, 0x15,
+	0x0A, 0x00, 0xF6, 0x15, 0x0A, 0x00, 0xF5, 0x15, 0x0A, 0x00, 0xF4, 0x15, 0x0A, 0x00, 0xF3, 0x15,
+	0x0A, 0x00, 0xF2, 0x15, 0x0A, 0x00, 0xF1, 0x15, 0x0A, 0x00, 0xF0, 0x15, 0x0A, 0x00, 0xFF, 0x15,
+	0x0A, 0x00, 0xA9, 0x35, 0x04, 0x00, 0xCA, 0x35, 0x04, 0x00, 0xEC, 0x15, 0x1E, 0x00, 0xEF, 0x15,
+	0x0A, 0x00, 0xEE, 0x15, 0x0A, 0x00, 0xED, 0x15, 0x0A, 0x00, 0xEB, 0x15, 0x0A, 0x00, 0xE9, 0x15,
+	0x0A, 0x00, 0xE8, 0x15, 0x0A, 0x00, 0xE7, 0x15, 0x0A, 0x00, 0xE5, 0x15, 0x0A, 0x00, 0xE4, 0x15,
+	0x0A, 0x00, 0xE3, 0x15, 0x0A, 0x00, 0xE2, 0x15, 0x0A, 0x00, 0xE1, 0x15, 0x0A, 0x00, 0xE0, 0x15,
+	0x0A, 0x00, 0xDF, 0x15, 0x0A, 0x00, 0xDE, 0x15, 0x0A, 0x00, 0xDD, 0x15, 0x0A, 0x00, 0xDC, 0x15,
+	0x0A, 0x00, 0xDB, 0x15, 0x0A, 0x00, 0xDA, 0x15, 0x0A, 0x00, 0xD9, 0x15, 0x0A, 0x00, 0xD8, 0x15,
+	0x0A, 0x00, 0xD7, 0x15, 0x0A, 0x00, 0xE6, 0x15, 0x0A, 0x00, 0xD3, 0x15, 0x0A, 0x00, 0xD6, 0x15,
+	0x0A, 0x00, 0xD5, 0x15, 0x0A, 0x00, 0xD4, 0x15, 0x0A, 0x00, 0xD2, 0x15, 0x0A, 0x00, 0xD0, 0x15,
+	0x0A, 0x00, 0xCF, 0x15, 0x0A, 0x00, 0xCE, 0x15, 0x0A, 0x00, 0xCC, 0x15, 0x0A, 0x00, 0xCB, 0x15,
+	0x0A, 0x00, 0xCA, 0x15, 0x0A, 0x00, 0xC9, 0x15, 0x0A, 0x00, 0xC8, 0x15, 0x0A, 0x00, 0xC7, 0x15,
+	0x0A, 0x00, 0xC6, 0x15, 0x0A, 0x00, 0xC5, 0x15, 0x0A, 0x00, 0xC4, 0x15, 0x0A, 0x00, 0xC3, 0x15,
+	0x0A, 0x00, 0xC2, 0x15, 0x0A, 0x00, 0xC1, 0x15, 0x0A, 0x00, 0xC0, 0x15, 0x0A, 0x00, 0xBF, 0x15,
+	0x0A, 0x00, 0xBE, 0x15, 0x0A, 0x00, 0xCD, 0x15, 0x0A, 0x00, 0xBA, 0x15, 0x0A, 0x00, 0xBD, 0x15,
+	0x0A, 0x00, 0xBC, 0x15, 0x0A, 0x00, 0xBB, 0x15, 0x0A, 0x00, 0xB9, 0x15, 0x0A, 0x00, 0xB7, 0x15,
+	0x0A, 0x00, 0xB6, 0x15, 0x0A, 0x00, 0xB5, 0x15, 0x0A, 0x00, 0xB3, 0x15, 0x0A, 0x00, 0xB2, 0x15,
+	0x0A, 0x00, 0xB1, 0x15, 0x0A, 0x00, 0xB0, 0x15, 0x0A, 0x00, 0xAF, 0x15, 0x0A, 0x00, 0xAE, 0x15,
+	0x0A, 0x00, 0xAD, 0x15, 0x0A, 0x00, 0xAC, 0x15, 0x0A, 0x00, 0xAB, 0x15, 0x0A, 0x00, 0xAA, 0x15,
+	0x0A, 0x00, 0xA9, 0x15, 0x0A, 0x00, 0xA8, 0x15, 0x0A, 0x00, 0xA7, 0x15, 0x0A, 0x00, 0xA6, 0x15,
+	0x0A, 0x00, 0xA5, 0x15, 0x0A, 0x00, 0xB4, 0x15, 0x0A, 0x00, 0xA8, 0x55, 0xE4, 0x00, 0xC9, 0x55,
+	0xE4, 0x00, 0xA7, 0x15, 0x14, 0x00, 0xC8, 0x15, 0x14, 0x00, 0xA1, 0x15, 0x32, 0x00, 0xA4, 0x15,
+	0x0A, 0x00, 0xA3, 0x15, 0x0A, 0x00, 0xA2, 0x15, 0x0A, 0x00, 0xA0, 0x15, 0x0A, 0x00, 0x9E, 0x15,
+	0x0A, 0x00, 0x9D, 0x15, 0x0A, 0x00, 0x9C, 0x15, 0x0A, 0x00, 0x9A, 0x15, 0x0A, 0x00, 0x99, 0x15,
+	0x0A, 0x00, 0x98, 0x15, 0x0A, 0x00, 0x97, 0x15, 0x0A, 0x00, 0x96, 0x15, 0x0A, 0x00, 0x95, 0x15,
+	0x0A, 0x00, 0x94, 0x15, 0x0A, 0x00, 0x93, 0x15, 0x0A, 0x00, 0x92, 0x15, 0x0A, 0x00, 0x91, 0x15,
+	0x0A, 0x00, 0x90, 0x15, 0x0A, 0x00, 0x8F, 0x15, 0x0A, 0x00, 0x8E, 0x15, 0x0A, 0x00, 0x8D, 0x15,
+	0x0A, 0x00, 0x8C, 0x15, 0x0A, 0x00, 0x9B, 0x15, 0x0A, 0x00, 0xA4, 0x35, 0x04, 0x00, 0xC5, 0x35,
+	0x04, 0x00, 0xA6, 0x15, 0x14, 0x00, 0xC7, 0x15, 0x14, 0x00, 0xA5, 0x15, 0x14, 0x00, 0xC6, 0x15,
+	0x14, 0x00, 0x88, 0x15, 0x46, 0x00, 0x8B, 0x15, 0x0A, 0x00, 0x8A, 0x15, 0x0A, 0x00, 0x89, 0x15,
+	0x0A, 0x00, 0x87, 0x15, 0x0A, 0x00, 0xAE, 0x22, 0x62, 0x0C, 0x00, 0xAD, 0x15, 0x0A, 0x00, 0xAC,
+	0x15, 0x0A, 0x00, 0xAB, 0x15, 0x0A, 0x00, 0xAA, 0x15, 0x0A, 0x00, 0xA9, 0x15, 0x0A, 0x00, 0xA3,
+	0x15, 0x82, 0x00, 0xC4, 0x15, 0x82, 0x00, 0xA2, 0x15, 0x14, 0x00, 0xC3, 0x15, 0x14, 0x00, 0xA1,
+	0x15, 0x14, 0x00, 0xC2, 0x15, 0x14, 0x00, 0x9F, 0x15, 0x14, 0x00, 0xC0, 0x15, 0x14, 0x00, 0x9C,
+	0x15, 0x14, 0x00, 0xBD, 0x15, 0x14, 0x00, 0x96, 0x15, 0x14, 0x00, 0xB7, 0x15, 0x14, 0x00, 0x90,
+	0x15, 0x14, 0x00, 0xB1, 0x15, 0x14, 0x00, 0x8F, 0x15, 0x14, 0x00, 0xB0, 0x15, 0x14, 0x00, 0x8E,
+	0x15, 0x14, 0x00, 0xAF, 0x15, 0x14, 0x00, 0x88, 0x15, 0x14, 0x00, 0xA9, 0x15, 0x14, 0x00, 0x82,
+	0x15, 0x14, 0x00, 0xA3, 0x15, 0x14, 0x00, 0xB9, 0x15, 0x14, 0x00, 0xDA, 0x15, 0x14, 0x00, 0xB8,
+	0x15, 0x14, 0x00, 0xD9, 0x15, 0x14, 0x00, 0xB7, 0x15, 0x14, 0x00, 0xD8, 0x15, 0x14, 0x00, 0xB6,
+	0x15, 0x14, 0x00, 0xD7, 0x15, 0x14, 0x00, 0xB5, 0x15, 0x14, 0x00, 0xD6, 0x15, 0x14, 0x00, 0xB4,
+	0x15, 0x14, 0x00, 0xD5, 0x15, 0x14, 0x00, 0xB3, 0x15, 0x14, 0x00, 0xD4, 0x15, 0x14, 0x00, 0xB2,
+	0x15, 0x14, 0x00, 0xD3, 0x15, 0x14, 0x00, 0x8D, 0x15, 0x14, 0x00, 0xAE, 0x15, 0x14, 0x00, 0xB3,
+	0x35, 0x9A, 0x00, 0xB2, 0x15, 0x0A, 0x00, 0xB1, 0x15, 0x0A, 0x00, 0xB0, 0x15, 0x0A, 0x00, 0xAF,
+	0x15, 0x0A, 0x00, 0xA1, 0x15, 0x3C, 0x00, 0xFF, 0xF5, 0x1C, 0x00, 0xA0, 0x15, 0x14, 0x00, 0xFE,
+	0x15, 0x14, 0x00, 0x9F, 0x15, 0x14, 0x00, 0xFD, 0x15, 0x14, 0x00, 0x9E, 0x15, 0x14, 0x00, 0xFC,
+	0x15, 0x14, 0x00, 0x9D, 0x15, 0x14, 0x00, 0xFB, 0x15, 0x14, 0x00, 0x9C, 0x15, 0x14, 0x00, 0xFA,
+	0x15, 0x14, 0x00, 0x9B, 0x15, 0x14, 0x00, 0xF9, 0x15, 0x14, 0x00, 0x9A, 0x15, 0x14, 0x00, 0xF8,
+	0x15, 0x14, 0x00, 0x99, 0x15, 0x14, 0x00, 0xD2, 0x15, 0xF0, 0x00, 0xF3, 0x15, 0x14, 0x00, 0xD1,
+	0x15, 0x14, 0x00, 0xF2, 0x15, 0x14, 0x00, 0xD0, 0x15, 0x14, 0x00, 0xF1, 0x15, 0x14, 0x00, 0xCF,
+	0x15, 0x14, 0x00, 0xF0, 0x15, 0x14, 0x00, 0xCE, 0x15, 0x14, 0x00, 0xEF, 0x15, 0x14, 0x00, 0xCD,
+	0x15, 0x14, 0x00, 0xEE, 0x15, 0x14, 0x00, 0xED, 0x15, 0x0A, 0x00, 0xCB, 0x15, 0x1E, 0x00, 0xEC,
+	0x15, 0x14, 0x00, 0xCA, 0x15, 0x14, 0x00, 0xEB, 0x15, 0x14, 0x00, 0xC9, 0x15, 0x14, 0x00, 0xEA,
+	0x15, 0x14, 0x00, 0xC8, 0x15, 0x14, 0x00, 0xE9, 0x15, 0x14, 0x00, 0xC7, 0x15, 0x14, 0x00, 0xE8,
+	0x15, 0x14, 0x00, 0xC6, 0x15, 0x14, 0x00, 0xE7, 0x15, 0x14, 0x00, 0xC5, 0x15, 0x14, 0x00, 0xE6,
+	0x15, 0x14, 0x00, 0xC4, 0x15, 0x14, 0x00, 0xE5, 0x15, 0x14, 0x00, 0xC3, 0x15, 0x14, 0x00, 0xE4,
+	0x15, 0x14, 0x00, 0xC2, 0x15, 0x14, 0x00, 0xE3, 0x15, 0x14, 0x00, 0xC1, 0x15, 0x14, 0x00, 0xE2,
+	0x15, 0x14, 0x00, 0xC0, 0x15, 0x14, 0x00, 0xE1, 0x15, 0x14, 0x00, 0xBF, 0x15, 0x14, 0x00, 0xE0,
+	0x15, 0x14, 0x00, 0xBE, 0x15, 0x14, 0x00, 0xDF, 0x15, 0x14, 0x00, 0xBD, 0x15, 0x14, 0x00, 0xDE,
+	0x15, 0x14, 0x00, 0xBC, 0x15, 0x14, 0x00, 0xDD, 0x15, 0x14, 0x00, 0xBB, 0x15, 0x14, 0x00, 0xDC,
+	0x15, 0x14, 0x00, 0xBA, 0x15, 0x14, 0x00, 0xDB, 0x15, 0x14, 0x00, 0xD3, 0x15, 0x14, 0x04, 0xF4,
+	0xD7, 0x0E, 0x6C, 0x12, 0x04, 0x9F, 0xE0, 0x1E, 0xAC, 0x09, 0x04, 0xA3, 0xDC, 0x01, 0x10, 0x00,
+	0x82, 0x15, 0x10, 0x00, 0xA2, 0x05, 0x10, 0x48, 0x81, 0xE0, 0x69, 0x3A, 0x0A, 0x08, 0x09, 0x12,
+	0x06, 0x08, 0x98, 0xD7, 0x69, 0x10, 0x05, 0x3A, 0x0A, 0x08, 0x08, 0x0D, 0x0C, 0x08, 0x01, 0x50,
+	0x00, 0x0E, 0x9E, 0x3C, 0x00, 0xDE, 0x0E, 0xA7, 0x21, 0x44, 0xF1, 0xED, 0xA6, 0xD6, 0xF4, 0xAA,
+	0xDB, 0xA6, 0x1B, 0x10, 0x97, 0xDF, 0xAE, 0xE2, 0x96, 0xEA, 0xC2, 0xFE, 0x12, 0x75, 0x32, 0x00,
+	0xCC, 0x05, 0x1D, 0x20, 0xD4, 0xF3, 0xB6, 0xE0, 0xCA, 0xE2, 0xF3, 0xA5, 0xAB, 0x0E, 0xE8, 0x47,
+	0x14, 0x97, 0xDB, 0x9C, 0xFF, 0x86, 0x83, 0x0E, 0x2D, 0x14, 0x04, 0x8A, 0xDD, 0x01, 0x3A, 0x18,
+	0xD9, 0xF0, 0x94, 0xE2, 0xD3, 0xE1, 0xEE, 0x0E, 0x6D, 0x16, 0x34, 0x9A, 0x87, 0xF8, 0x9C, 0x9A,
+	0x89, 0xA0, 0x82, 0x76, 0x5A, 0x1B, 0x08, 0xC0, 0xDF, 0x01, 0x1D, 0x18, 0x94, 0xC3, 0xE9, 0xA4,
+	0xEB, 0xAA, 0x9C, 0x0E, 0x65, 0x42, 0x34, 0x91, 0xB7, 0x94, 0xC4, 0xA7, 0xF7, 0x85, 0xAA, 0x0B,
+	0x5A, 0x1C, 0x08, 0xDF, 0xDF, 0x0E, 0xA3, 0x35, 0x4C, 0xF5, 0xAE, 0x9C, 0xD6, 0xD7, 0xDD, 0xA3,
+	0xA4, 0xC3, 0x01, 0x10, 0x8D, 0xDB, 0xBA, 0x98, 0xF0, 0xC6, 0x9F, 0xEC, 0xD6, 0x0E, 0x10, 0x14,
+	0x00, 0x81, 0x12, 0x8D, 0x44, 0x5C, 0xBF, 0xFF, 0x95, 0x8F, 0xA7, 0x99, 0xD1, 0xA3, 0x64, 0x10,
+	0xAB, 0xCB, 0x8B, 0xBB, 0xAF, 0xB9, 0x8D, 0xD9, 0x4E, 0x5A, 0x1C, 0x08, 0x8D, 0xDD, 0x01, 0x3A,
+	0x4C, 0xB0, 0x91, 0x94, 0xE1, 0xE4, 0xB8, 0xFF, 0xA2, 0x89, 0x01, 0x10, 0xAC, 0xB3, 0xA4, 0xB4,
+	0xC5, 0xE2, 0x82, 0xAF, 0xD4, 0x01, 0x92, 0x00, 0xFD, 0x12, 0xE1, 0x16, 0x48, 0xC6, 0x8D, 0xE5,
+	0xD0, 0x89, 0xAE, 0xE5, 0xA7, 0x36, 0x10, 0x90, 0x8D, 0x99, 0xD0, 0xB7, 0xD6, 0x91, 0xC2, 0xD1,
+	0x01, 0x57, 0x00, 0x82, 0x05, 0x57, 0x44, 0xB2, 0xC0, 0xB1, 0xF7, 0xDA, 0xCC, 0xCB, 0xA4, 0x65,
+	0x10, 0x90, 0xBB, 0xC8, 0xD0, 0x93, 0xC3, 0xA1, 0xD3, 0x0E, 0x52, 0x31, 0x00, 0xBF, 0x05, 0xE8,
+	0x48, 0xFF, 0xBE, 0xBB, 0xA2, 0xE2, 0x9C, 0xFF, 0xA2, 0xF2, 0x01, 0x10, 0xA1, 0xB1, 0xB8, 0x9A,
+	0xA8, 0xDD, 0xA5, 0x84, 0x0E, 0xBD, 0x1F, 0x00, 0xDD, 0x05, 0x74, 0x4C, 0xB1, 0xF3, 0xE0, 0x9B,
+	0xE1, 0xC0, 0xB0, 0xA1, 0xF2, 0x01, 0x10, 0xBD, 0xA9, 0xDD, 0x9F, 0xA8, 0xDF, 0xBD, 0xC9, 0xE4,
+	0x01, 0x57, 0x00, 0x8E, 0x05, 0x57, 0x48, 0xCF, 0xE5, 0xD2, 0xC8, 0xB5, 0x9D, 0x8C, 0xA1, 0x2D,
+	0x10, 0x8D, 0xEB, 0x8A, 0xF8, 0xA7, 0x9C, 0xF3, 0xE3, 0x37, 0x0E, 0xD3, 0x41, 0x25, 0x22, 0x18,
+	0xD5, 0x94, 0x9E, 0xAF, 0x86, 0x94, 0xA5, 0x0E, 0xB5, 0x48, 0x1C, 0xB4, 0xF1, 0xEF, 0xBD, 0x87,
+	0xEA, 0xCE, 0xAB, 0x0E, 0x00, 0x37, 0x00, 0xA0, 0x12, 0xBE, 0x14, 0x5C, 0x90, 0xF0, 0x86, 0xFB,
+	0xEF, 0xE6, 0xDD, 0xA7, 0x8C, 0x01, 0x10, 0x94, 0xCF, 0x96, 0x92, 0xDD, 0x99, 0xF0, 0xC5, 0x27,
+	0x5A, 0x1C, 0x08, 0xD4, 0x25, 0x22, 0x4C, 0xED, 0xAE, 0x91, 0xA5, 0xBF, 0xA2, 0xA7, 0xA2, 0xBF,
+	0x01, 0x10, 0x80, 0xA3, 0x88, 0xD0, 0x9C, 0xEF, 0xC8, 0xC3, 0xFA, 0x01, 0x74, 0x04, 0x9C, 0xDE,
+	0x0E, 0x60, 0x25, 0x5C, 0x80, 0x89, 0xB0, 0xE9, 0xC3, 0xC0, 0xC0, 0xA0, 0x6B, 0x10, 0xA2, 0xD1,
+	0xF4, 0xB4, 0xF9, 0xF9, 0xF5, 0x99, 0x5B, 0x5A, 0x1C, 0x08, 0xA1, 0xDE, 0x21, 0x22, 0x4C, 0xC3,
+	0xC2, 0x94, 0xC6, 0x8E, 0x9D, 0xD9, 0xA1, 0xAF, 0x01, 0x10, 0xB5, 0xFD, 0x84, 0x9C, 0xEB, 0xE7,
+	0x8C, 0xFC, 0xE0, 0x0E, 0x8A, 0x15, 0x00, 0x9C, 0x12, 0xDE, 0x14, 0x48, 0x8D, 0xED, 0x8C, 0x9E,
+	0xFE, 0xA4, 0xDA, 0xA4, 0xAD, 0x01, 0x10, 0x9F, 0x9F, 0x99, 0xA0, 0xD4, 0xE4, 0xDF, 0xCE, 0x12,
+	0xD6, 0x1E, 0x00, 0xAE, 0x05, 0x76, 0x4C, 0x9C, 0x95, 0xF6, 0xF0, 0xE1, 0xA8, 0x88, 0xA7, 0xC8,
+	0x01, 0x10, 0xA9, 0x97, 0xC8, 0xDF, 0xC4, 0x89, 0xDF, 0xA0, 0xE3, 0x21, 0x5E, 0x00, 0xC8, 0x05,
+	0xCE, 0x48, 0x89, 0x81, 0x8A, 0x99, 0xF1, 0xE9, 0x86, 0xA3, 0x34, 0x10, 0x8A, 0x85, 0xD0, 0xBF,
+	0xE7, 0xA4, 0xE0, 0x8A, 0xB5, 0x01, 0x59, 0x00, 0x8C, 0x05, 0x3B, 0x18, 0xF6, 0xEB, 0xAF, 0xFC,
+	0xE3, 0xBD, 0xEB, 0x0E, 0x65, 0x41, 0x20, 0x8B, 0x93, 0x97, 0xA2, 0x84, 0xD7, 0xA7, 0xF0, 0x98,
+	0x01, 0x3B, 0x00, 0xDD, 0x25, 0x60, 0x44, 0xE6, 0xD1, 0xA3, 0xA4, 0xAF, 0xC9, 0xAF, 0xA4, 0x65,
+	0x10, 0x9B, 0xEB, 0x88, 0x9D, 0x92, 0xF1, 0xFE, 0x83, 0x12, 0x3F, 0x32, 0x00, 0xBB, 0x45, 0x2B,
+	0x48, 0xE2, 0x94, 0x84, 0xB8, 0xD9, 0xE1, 0xF4, 0xA1, 0x47, 0x10, 0xB8, 0x97, 0x88, 0x8B, 0xB9,
+	0xEC, 0x8D, 0xD8, 0xA6, 0x01, 0x58, 0x00, 0xA4, 0x12, 0x61, 0x1E, 0x50, 0xDB, 0xBD, 0xAC, 0xB5,
+	0xD7, 0xEE, 0xBA, 0xA2, 0xE1, 0x01, 0x10, 0x8C, 0xCF, 0xC8, 0x81, 0x99, 0xD5, 0xB1, 0x90, 0x94,
+	0x01, 0x0E, 0x96, 0x2E, 0x12, 0x27, 0x33, 0x44, 0xC6, 0xE1, 0xE7, 0x99, 0x84, 0xF7, 0x83, 0xA7,
+	0x41, 0x10, 0x80, 0xAD, 0x9E, 0x98, 0x92, 0x97, 0xA1, 0x97, 0x12, 0x1A, 0x27, 0x00, 0xF8, 0x25,
+	0x61, 0x48, 0xC1, 0x91, 0xF9, 0xCA, 0xAA, 0x9B, 0xD2, 0xA6, 0xE7, 0x01, 0x10, 0x91, 0x8D, 0xED,
+	0xB5, 0xB8, 0xDC, 0xCA, 0xE2, 0x0E, 0xF9, 0x2B, 0x00, 0x92, 0x05, 0x92, 0x5C, 0xAF, 0xC1, 0x96,
+	0xE9, 0x84, 0xF2, 0xF9, 0xA3, 0xE1, 0x01, 0x10, 0x8B, 0xB5, 0x82, 0xFE, 0xAC, 0xAD, 0x9C, 0xAD,
+	0x0A, 0x5A, 0x1B, 0x08, 0xC8, 0x12, 0x76, 0x16, 0x48, 0xFD, 0xE8, 0xF0, 0x98, 0xA0, 0xC3, 0xFF,
+	0xA4, 0x3D, 0x10, 0x98, 0x8D, 0x9C, 0x93, 0xD0, 0xD8, 0xAA, 0xA4, 0xF1, 0x01, 0x74, 0x04, 0xEA,
+	0xD9, 0x41, 0xDA, 0x44, 0xCE, 0xC8, 0xA1, 0xBA, 0xC8, 0x87, 0xF4, 0xA4, 0x1F, 0x10, 0x85, 0xC7,
+	0x8F, 0xB7, 0xE0, 0xD4, 0xE8, 0xD5, 0x12, 0x9A, 0x38, 0x00, 0xB8, 0x05, 0x1D, 0x5C, 0xEB, 0xBC,
+	0xA7, 0xED, 0xD4, 0xFD, 0xCB, 0xA5, 0x8C, 0x01, 0x10, 0x90, 0xA1, 0xE6, 0xCD, 0x9E, 0xC4, 0xF1,
+	0xE3, 0x1E, 0x5A, 0x1A, 0x08, 0xF4, 0x12, 0x77, 0x16, 0x48, 0xE2, 0xCB, 0xD9, 0xE8, 0x93, 0x9D,
+	0x8C, 0xA5, 0x44, 0x10, 0x8D, 0xA5, 0xEF, 0xBF, 0x80, 0x8C, 0xD9, 0x82, 0x66, 0x0E, 0xC0, 0x26,
+	0x25, 0x05, 0x4C, 0xBC, 0xC7, 0xAA, 0xEE, 0xC3, 0xD5, 0xBA, 0xA1, 0xB9, 0x01, 0x10, 0x9C, 0xBD,
+	0x91, 0xC0, 0x80, 0x87, 0x96, 0xBE, 0x3E, 0x0E, 0xA4, 0x26, 0x05, 0x90, 0x54, 0xA1, 0x8A, 0xBB,
+	0xD2, 0xD4, 0xBF, 0x8F, 0xA4, 0xEF, 0x01, 0x10, 0x96, 0x99, 0xDE, 0xA4, 0xBA, 0xE9, 0xD7, 0xF5,
+	0x36, 0x5A, 0x1A, 0x61, 0xD7, 0x64, 0x12, 0x14, 0x08, 0xED, 0xBE, 0xB7, 0xFC, 0xD4, 0xB2, 0xF7,
+	0xA3, 0x25, 0x10, 0x91, 0xF1, 0xF9, 0xF1, 0xA6, 0x88, 0xF0, 0xA4, 0x1C, 0x5A, 0x1C, 0x08, 0xCC,
+	0x16, 0xF0, 0x18, 0x44, 0x8C, 0xD3, 0xB1, 0xBC, 0x8A, 0xA2, 0xA6, 0xD2, 0x01, 0x10, 0xB8, 0xFD,
+	0xCD, 0x9B, 0xCF, 0xCB, 0xCA, 0xBC, 0x65, 0x12, 0x60, 0x9F, 0xD9, 0x69, 0x12, 0x14, 0x08, 0xB9,
+	0xF9, 0xF1, 0xAB, 0xF6, 0xCF, 0xE8, 0xA6, 0x1A, 0x10, 0x80, 0xD9, 0x92, 0xD5, 0x8C, 0xC7, 0xFC,
+	0xE2, 0x57, 0x0E, 0x7F, 0x19, 0x00, 0xDD, 0x01, 0x1C, 0xF0, 0x7D, 0xA6, 0x8E, 0xA2, 0xDC, 0xEB,
+	0x96, 0xC7, 0xA4, 0x16, 0x10, 0xA9, 0xBD, 0xFF, 0xC6, 0xA8, 0x9F, 0x8C, 0xF7, 0x58, 0x5A, 0x18,
+	0x08, 0x01, 0x12, 0x14, 0x08, 0x8E, 0xBB, 0xE4, 0xDF, 0xC3, 0xB8, 0xE6, 0xA2, 0x32, 0x10, 0xB5,
+	0x8D, 0xAB, 0xEE, 0xF0, 0xBD, 0x87, 0xFE, 0x2A, 0x60, 0xC3, 0x06, 0x22, 0x62, 0x08, 0x09, 0x12,
+	0x14, 0x7B, 0xEC, 0xCB, 0x19, 0xD1, 0x58, 0x7E, 0xFF, 0xEC, 0x03, 0xC5, 0x50, 0xDF, 0x12, 0x55,
+	0x22, 0x12, 0x78, 0xDD, 0x41, 0x1A, 0x16, 0x74, 0x69, 0x6C, 0x65, 0x5F, 0x70, 0x61, 0x70, 0x65,
+	0x72, 0x5F, 0x6D, 0x65, 0x64, 0x67, 0x72, 0x61, 0x79, 0x2E, 0x6A, 0x70, 0x67, 0x22, 0x00, 0x2A,
+	0x23, 0x67, 0x69, 0x6E, 0x67, 0x65, 0x72, 0x2F, 0x30, 0x30, 0x62, 0x5F, 0x74, 0x68, 0x65, 0x6D,
+	0x65, 0x2F, 0x74, 0x69, 0x6C, 0x65, 0x5F, 0x70, 0x61, 0x1D, 0x2B, 0xF0, 0x46, 0x52, 0x09, 0xA2,
+	0x06, 0x06, 0x18, 0x01, 0x28, 0x00, 0x38, 0x00, 0x22, 0x52, 0x08, 0x17, 0x12, 0x14, 0xBC, 0x09,
+	0x54, 0x12, 0x34, 0x93, 0xF3, 0x84, 0x36, 0x27, 0x25, 0x4C, 0x48, 0xD2, 0x31, 0xDE, 0x44, 0x6A,
+	0x3E, 0x0E, 0x1A, 0x1C, 0x62, 0x75, 0x6C, 0x6C, 0x65, 0x74, 0x5F, 0x63, 0x69, 0x72, 0x63, 0x6C,
+	0x65, 0x2D, 0x62, 0x6C, 0x6B, 0x2D, 0x72, 0x65, 0x73, 0x69, 0x7A, 0x65, 0x2E, 0x70, 0x64, 0x66,
+	0x22, 0x00, 0x2A, 0x18, 0x5E, 0x20, 0x00, 0x70, 0x22, 0x60, 0x08, 0x08, 0x12, 0x14, 0xB1, 0xD8,
+	0x45, 0x40, 0x36, 0x0B, 0xA8, 0x44, 0x12, 0x29, 0xEC, 0xC2, 0x6F, 0x53, 0x53, 0x9C, 0x7D, 0xCE,
+	0x04, 0xBD, 0x1A, 0x15, 0x74, 0x19, 0xB8, 0x0C, 0x6C, 0x74, 0x67, 0x72, 0x15, 0xB7, 0x00, 0x22,
+	0x6E, 0xB7, 0x00, 0x09, 0x2A, 0x2E, 0xB6, 0x00, 0x90, 0x5E, 0x08, 0x0E, 0x12, 0x14, 0x16, 0x35,
+	0x71, 0x98, 0xC7, 0xF9, 0x91, 0x35, 0xDE, 0x48, 0xA3, 0x9B, 0x69, 0x61, 0xDF, 0x7F, 0xDA, 0x72,
+	0xC8, 0xF5, 0x1A, 0x1A, 0x68, 0x61, 0x72, 0x64, 0x63, 0x6F, 0x76, 0x65, 0x72, 0x5F, 0x0D, 0xA0,
+	0x30, 0x62, 0x6C, 0x61, 0x63, 0x6B, 0x2E, 0x70, 0x6E, 0x67, 0x22, 0x00, 0x2A, 0x26, 0x11, 0x67,
+	0x08, 0x31, 0x5F, 0x74, 0x25, 0x1D, 0x56, 0x2E, 0x00, 0x00, 0x2A, 0x0E, 0xC8, 0x50, 0x00, 0x32,
+	0x01, 0x05, 0x38, 0x3A, 0x03, 0x1A, 0x01, 0x00, 0x40, 0xC3, 0x06, 0x52, 0x04, 0x08, 0xB5, 0xE0,
+	0x69, 0x1E, 0x01, 0x05, 0x10, 0x12, 0x18, 0x08, 0x87, 0x56, 0x16, 0x92, 0x51, 0x80, 0x28, 0x2A,
+	0x0C, 0x96, 0xE6, 0x3D, 0xAF, 0xDB, 0x0B, 0x88, 0xCB, 0x66, 0xB0, 0xDB, 0x0B, 0x0A, 0x08, 0x08,
+	0x0E, 0x12, 0x04, 0x08, 0x96, 0xE6, 0x3D, 0x0A, 0x08, 0x08, 0x09, 0x12, 0x04, 0x08, 0xAF, 0x05,
+	0x14, 0x44, 0x17, 0x12, 0x04, 0x08, 0x88, 0xCB, 0x66, 0x0A, 0x08, 0x08, 0x08, 0x12, 0x04, 0x08,
+	0xB0, 0xDB, 0x0B, 0x10, 0x01, 0x23, 0x0C, 0x12, 0x0A, 0x08, 0x86, 0x0D, 0x47, 0x28, 0x1F, 0x0A,
+	0x1D, 0x08, 0x01, 0x1D, 0x88, 0x87, 0x07, 0x3F, 0x25, 0x01, 0x05, 0x00, 0x2D, 0x01, 0x05, 0x1C,
+	0x35, 0x00, 0x00, 0x80, 0x3F, 0x60, 0x01, 0x6D, 0x01, 0x07, 0x00, 0x10, 0x01, 0x49, 0x42, 0x30,
+	0x00, 0x10, 0xC1, 0xC0, 0xC0, 0x3E, 0x25, 0x01, 0x05, 0x00, 0x2D, 0x01, 0x05, 0x36, 0x30, 0x00,
+	0x08, 0x88, 0xCB, 0x66, 0x42, 0x30, 0x00, 0x10, 0x9E, 0x9D, 0x1D, 0x3F, 0x25, 0x01, 0x05, 0x00,
+	0x2D, 0x01, 0x05, 0x36, 0x30, 0x00, 0x04, 0xB0, 0xDB, 0x46, 0x60, 0x00, 0x10, 0x87, 0x86, 0x06,
+	0x3F, 0x25, 0x01, 0x05, 0x00, 0x2D, 0x01, 0x05, 0x2C, 0x35, 0x00, 0x00, 0x80, 0x3F, 0x60, 0x01,
+	0x6D, 0x00, 0x00, 0x80, 0x3F, 0x62, 0x70, 0x6C, 0x69, 0x73, 0x74, 0x30, 0x30, 0xDA, 0x01, 0x02,
+	0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0C, 0x0F, 0x10, 0x0C, 0x12,
+	0x13, 0x14, 0x58, 0x72, 0x65, 0x76, 0x69, 0x73, 0x69, 0x6F, 0x6E, 0x5F, 0x10, 0x21, 0x68, 0x61,
+	0x73, 0x45, 0x78, 0x74, 0x65, 0x72, 0x6E, 0x61, 0x6C, 0x52, 0x65, 0x66, 0x65, 0x72, 0x65, 0x6E,
+	0x63, 0x65, 0x4F, 0x72, 0x4D, 0x69, 0x73, 0x73, 0x69, 0x6E, 0x67, 0x44, 0x61, 0x74, 0x61, 0x5C,
+	0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x55, 0x55, 0x49, 0x44, 0x5F, 0x10, 0x1B, 0x68,
+	0x61, 0x73, 0x55, 0x6E, 0x6D, 0x61, 0x74, 0x65, 0x72, 0x69, 0x61, 0x6C, 0x69, 0x7A, 0x65, 0x64,
+	0x52, 0x65, 0x6D, 0x6F, 0x74, 0x65, 0x44, 0x61, 0x74, 0x61, 0x5B, 0x76, 0x65, 0x72, 0x73, 0x69,
+	0x6F, 0x6E, 0x55, 0x55, 0x49, 0x44, 0x5B, 0x70, 0x72, 0x69, 0x76, 0x61, 0x74, 0x65, 0x55, 0x55,
+	0x49, 0x44, 0x5B, 0x69, 0x73, 0x4D, 0x75, 0x6C, 0x74, 0x69, 0x50, 0x61, 0x67, 0x65, 0x5F, 0x10,
+	0x12, 0x73, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x44, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x55,
+	0x55, 0x49, 0x44, 0x59, 0x73, 0x68, 0x61, 0x72, 0x65, 0x55, 0x55, 0x49, 0x44, 0x5F, 0x10, 0x11,
+	0x66, 0x69, 0x6C, 0x65, 0x46, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6F,
+	0x6E, 0x5F, 0x10, 0x27, 0x30, 0x3A, 0x3A, 0x38, 0x42, 0x38, 0x39, 0x42, 0x43, 0x36, 0x38, 0x2D,
+	0x36, 0x34, 0x43, 0x30, 0x2D, 0x34, 0x38, 0x33, 0x39, 0x2D, 0x38, 0x46, 0x42, 0x32, 0x2D, 0x36,
+	0x43, 0x37, 0x42, 0x31, 0x31, 0x44, 0x31, 0x30, 0x30, 0x37, 0x32, 0x08, 0x5F, 0x10, 0x24, 0x32,
+	0x44, 0x32, 0x33, 0x36, 0x33, 0x31, 0x46, 0x2D, 0x33, 0x35, 0x39, 0x44, 0x2D, 0x34, 0x32, 0x34,
+	0x37, 0x2D, 0x42, 0x30, 0x38, 0x37, 0x2D, 0x34, 0x41, 0x39, 0x42, 0x45, 0x33, 0x36, 0x36, 0x33,
+	0x42, 0x36, 0x43, 0x08, 0x5F, 0x10, 0x24, 0x38, 0x42, 0x38, 0x39, 0x42, 0x43, 0x36, 0x38, 0x2D,
+	0x36, 0x34, 0x43, 0x30, 0x2D, 0x34, 0x38, 0x33, 0x39, 0x2D, 0x38, 0x46, 0x42, 0x32, 0x2D, 0x36,
+	0x43, 0x37, 0x42, 0x31, 0x31, 0x44, 0x31, 0x30, 0x30, 0x37, 0x32, 0x5F, 0x10, 0x24, 0x44, 0x33,
+	0x43, 0x36, 0x37, 0x41, 0x32, 0x30, 0x2D, 0x32, 0x32, 0x33, 0x41, 0x2D, 0x34, 0x44, 0x31, 0x36,
+	0x2D, 0x42, 0x35, 0x34, 0x30, 0x2D, 0x33, 0x46, 0x37, 0x46, 0x44, 0x36, 0x46, 0x45, 0x43, 0x36,
+	0x34, 0x42, 0x08, 0x5F, 0x10, 0x24, 0x32, 0x44, 0x32, 0x33, 0x36, 0x33, 0x31, 0x46, 0x2D, 0x33,
+	0x35, 0x39, 0x44, 0x2D, 0x34, 0x32, 0x34, 0x37, 0x2D, 0x42, 0x30, 0x38, 0x37, 0x2D, 0x34, 0x41,
+	0x39, 0x42, 0x45, 0x33, 0x36, 0x36, 0x33, 0x42, 0x36, 0x43, 0x5F, 0x10, 0x24, 0x32, 0x44, 0x32,
+	0x33, 0x36, 0x33, 0x31, 0x46, 0x2D, 0x33, 0x35, 0x39, 0x44, 0x2D, 0x34, 0x32, 0x34, 0x37, 0x2D,
+	0x42, 0x30, 0x38, 0x37, 0x2D, 0x34, 0x41, 0x39, 0x42, 0x45, 0x33, 0x36, 0x36, 0x33, 0x42, 0x36,
+	0x43, 0x56, 0x32, 0x36, 0x2E, 0x31, 0x2E, 0x30, 0x00, 0x08, 0x00, 0x1D, 0x00, 0x26, 0x00, 0x4A,
+	0x00, 0x57, 0x00, 0x75, 0x00, 0x81, 0x00, 0x8D, 0x00, 0x99, 0x00, 0xAE, 0x00, 0xB8, 0x00, 0xCC,
+	0x00, 0xF6, 0x00, 0xF7, 0x01, 0x1E, 0x01, 0x1F, 0x01, 0x46, 0x01, 0x6D, 0x01, 0x6E, 0x01, 0x95,
+	0x01, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0xC3, 0x32, 0x44, 0x32, 0x33, 0x36, 0x33, 0x31, 0x46, 0x2D, 0x33, 0x35, 0x39, 0x44, 0x2D,
+	0x34, 0x32, 0x34, 0x37, 0x2D, 0x42, 0x30, 0x38, 0x37, 0x2D, 0x34, 0x41, 0x39, 0x42, 0x45, 0x33,
+	0x36, 0x36, 0x33, 0x42, 0x36, 0x43, 0x3C, 0x3F, 0x78, 0x6D, 0x6C, 0x20, 0x76, 0x65, 0x72, 0x73,
+	0x69, 0x6F, 0x6E, 0x3D, 0x22, 0x31, 0x2E, 0x30, 0x22, 0x20, 0x65, 0x6E, 0x63, 0x6F, 0x64, 0x69,
+	0x6E, 0x67, 0x3D, 0x22, 0x55, 0x54, 0x46, 0x2D, 0x38, 0x22, 0x3F, 0x3E, 0x0A, 0x3C, 0x21, 0x44,
+	0x4F, 0x43, 0x54, 0x59, 0x50, 0x45, 0x20, 0x70, 0x6C, 0x69, 0x73, 0x74, 0x20, 0x50, 0x55, 0x42,
+	0x4C, 0x49, 0x43, 0x20, 0x22, 0x2D, 0x2F, 0x2F, 0x41, 0x70, 0x70, 0x6C, 0x65, 0x2F, 0x2F, 0x44,
+	0x54, 0x44, 0x20, 0x50, 0x4C, 0x49, 0x53, 0x54, 0x20, 0x31, 0x2E, 0x30, 0x2F, 0x2F, 0x45, 0x4E,
+	0x22, 0x20, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3A, 0x2F, 0x2F, 0x77, 0x77, 0x77, 0x2E, 0x61, 0x70,
+	0x70, 0x6C, 0x65, 0x2E, 0x63, 0x6F, 0x6D, 0x2F, 0x44, 0x54, 0x44, 0x73, 0x2F, 0x50, 0x72, 0x6F,
+	0x70, 0x65, 0x72, 0x74, 0x79, 0x4C, 0x69, 0x73, 0x74, 0x2D, 0x31, 0x2E, 0x30, 0x2E, 0x64, 0x74,
+	0x64, 0x22, 0x3E, 0x0A, 0x3C, 0x70, 0x6C, 0x69, 0x73, 0x74, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69,
+	0x6F, 0x6E, 0x3D, 0x22, 0x31, 0x2E, 0x30, 0x22, 0x3E, 0x0A, 0x3C, 0x61, 0x72, 0x72, 0x61, 0x79,
+	0x3E, 0x0A, 0x09, 0x3C, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x3E, 0x54, 0x65, 0x6D, 0x70, 0x6C,
+	0x61, 0x74, 0x65, 0x3A, 0x20, 0x42, 0x6C, 0x61, 0x6E, 0x6B, 0x20, 0x28, 0x64, 0x65, 0x76, 0x2F,
+	0x31, 0x35, 0x2E, 0x33, 0x29, 0x3C, 0x2F, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x3E, 0x0A, 0x09,
+	0x3C, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x3E, 0x4D, 0x31, 0x35, 0x2E, 0x32, 0x2E, 0x31, 0x2D,
+	0x37, 0x30, 0x34, 0x38, 0x2E, 0x30, 0x2E, 0x33, 0x2D, 0x32, 0x3C, 0x2F, 0x73, 0x74, 0x72, 0x69,
+	0x6E, 0x67, 0x3E, 0x0A, 0x3C, 0x2F, 0x61, 0x72, 0x72, 0x61, 0x79, 0x3E, 0x0A, 0x3C, 0x2F, 0x70,
+	0x6C, 0x69, 0x73, 0x74, 0x3E, 0x0A, 0xFF, 0xD8, 0xFF, 0xE0, 0x00, 0x10, 0x4A, 0x46, 0x49, 0x46,
+	0x00, 0x01, 0x01, 0x00, 0x00, 0x48, 0x00, 0x48, 0x00, 0x00, 0xFF, 0xE1, 0x00, 0x40, 0x45, 0x78,
+	0x69, 0x66, 0x00, 0x00, 0x4D, 0x4D, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x08, 0x00, 0x01, 0x87, 0x69,
+	0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+	0xA0, 0x02, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0xD4, 0xA0, 0x03, 0x00, 0x04,
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xED, 0x00, 0x38,
+	0x50, 0x68, 0x6F, 0x74, 0x6F, 0x73, 0x68, 0x6F, 0x70, 0x20, 0x33, 0x2E, 0x30, 0x00, 0x38, 0x42,
+	0x49, 0x4D, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x42, 0x49, 0x4D, 0x04, 0x25,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xD4, 0x1D, 0x8C, 0xD9, 0x8F, 0x00, 0xB2, 0x04, 0xE9, 0x80,
+	0x09, 0x98, 0xEC, 0xF8, 0x42, 0x7E, 0xFF, 0xE2, 0x02, 0x28, 0x49, 0x43, 0x43, 0x5F, 0x50, 0x52,
+	0x4F, 0x46, 0x49, 0x4C, 0x45, 0x00, 0x01, 0x01, 0x00, 0x00, 0x02, 0x18, 0x61, 0x70, 0x70, 0x6C,
+	0x04, 0x00, 0x00, 0x00, 0x6D, 0x6E, 0x74, 0x72, 0x52, 0x47, 0x42, 0x20, 0x58, 0x59, 0x5A, 0x20,
+	0x07, 0xE6, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x63, 0x73, 0x70,
+	0x41, 0x50, 0x50, 0x4C, 0x00, 0x00, 0x00, 0x00, 0x41, 0x50, 0x50, 0x4C, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xD6,
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0xD3, 0x2D, 0x61, 0x70, 0x70, 0x6C, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x64, 0x65, 0x73, 0x63,
+	0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x30, 0x63, 0x70, 0x72, 0x74, 0x00, 0x00, 0x01, 0x2C,
+	0x00, 0x00, 0x00, 0x50, 0x77, 0x74, 0x70, 0x74, 0x00, 0x00, 0x01, 0x7C, 0x00, 0x00, 0x00, 0x14,
+	0x72, 0x58, 0x59, 0x5A, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x14, 0x67, 0x58, 0x59, 0x5A,
+	0x00, 0x00, 0x01, 0xA4, 0x00, 0x00, 0x00, 0x14, 0x62, 0x58, 0x59, 0x5A, 0x00, 0x00, 0x01, 0xB8,
+	0x00, 0x00, 0x00, 0x14, 0x72, 0x54, 0x52, 0x43, 0x00, 0x00, 0x01, 0xCC, 0x00, 0x00, 0x00, 0x20,
+	0x63, 0x68, 0x61, 0x64, 0x00, 0x00, 0x01, 0xEC, 0x00, 0x00, 0x00, 0x2C, 0x62, 0x54, 0x52, 0x43,
+	0x00, 0x00, 0x01, 0xCC, 0x00, 0x00, 0x00, 0x20, 0x67, 0x54, 0x52, 0x43, 0x00, 0x00, 0x01, 0xCC,
+	0x00, 0x00, 0x00, 0x20, 0x6D, 0x6C, 0x75, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+	0x00, 0x00, 0x00, 0x0C, 0x65, 0x6E, 0x55, 0x53, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x1C,
+	0x00, 0x44, 0x00, 0x69, 0x00, 0x73, 0x00, 0x70, 0x00, 0x6C, 0x00, 0x61, 0x00, 0x79, 0x00, 0x20,
+	0x00, 0x50, 0x00, 0x33, 0x6D, 0x6C, 0x75, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+	0x00, 0x00, 0x00, 0x0C, 0x65, 0x6E, 0x55, 0x53, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x1C,
+	0x00, 0x43, 0x00, 0x6F, 0x00, 0x70, 0x00, 0x79, 0x00, 0x72, 0x00, 0x69, 0x00, 0x67, 0x00, 0x68,
+	0x00, 0x74, 0x00, 0x20, 0x00, 0x41, 0x00, 0x70, 0x00, 0x70, 0x00, 0x6C, 0x00, 0x65, 0x00, 0x20,
+	0x00, 0x49, 0x00, 0x6E, 0x00, 0x63, 0x00, 0x2E, 0x00, 0x2C, 0x00, 0x20, 0x00, 0x32, 0x00, 0x30,
+	0x00, 0x32, 0x00, 0x32, 0x58, 0x59, 0x5A, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xD5,
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0xD3, 0x2C, 0x58, 0x59, 0x5A, 0x20, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x83, 0xDF, 0x00, 0x00, 0x3D, 0xBF, 0xFF, 0xFF, 0xFF, 0xBB, 0x58, 0x59, 0x5A, 0x20,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4A, 0xBF, 0x00, 0x00, 0xB1, 0x37, 0x00, 0x00, 0x0A, 0xB9,
+	0x58, 0x59, 0x5A, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x38, 0x00, 0x00, 0x11, 0x0B,
+	0x00, 0x00, 0xC8, 0xB9, 0x70, 0x61, 0x72, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+	0x00, 0x02, 0x66, 0x66, 0x00, 0x00, 0xF2, 0xA7, 0x00, 0x00, 0x0D, 0x59, 0x00, 0x00, 0x13, 0xD0,
+	0x00, 0x00, 0x0A, 0x5B, 0x73, 0x66, 0x33, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0C, 0x42,
+	0x00, 0x00, 0x05, 0xDE, 0xFF, 0xFF, 0xF3, 0x26, 0x00, 0x00, 0x07, 0x93, 0x00, 0x00, 0xFD, 0x90,
+	0xFF, 0xFF, 0xFB, 0xA2, 0xFF, 0xFF, 0xFD, 0xA3, 0x00, 0x00, 0x03, 0xDC, 0x00, 0x00, 0xC0, 0x6E,
+	0xFF, 0xC0, 0x00, 0x11, 0x08, 0x04, 0x00, 0x02, 0xD4, 0x03, 0x01, 0x22, 0x00, 0x02, 0x11, 0x01,
+	0x03, 0x11, 0x01, 0xFF, 0xC4, 0x00, 0x1F, 0x00, 0x00, 0x01, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+	0x08, 0x09, 0x0A, 0x0B, 0xFF, 0xC4, 0x00, 0xB5, 0x10, 0x00, 0x02, 0x01, 0x03, 0x03, 0x02, 0x04,
+	0x03, 0x05, 0x05, 0x04, 0x04, 0x00, 0x00, 0x01, 0x7D, 0x01, 0x02, 0x03, 0x00, 0x04, 0x11, 0x05,
+	0x12, 0x21, 0x31, 0x41, 0x06, 0x13, 0x51, 0x61, 0x07, 0x22, 0x71, 0x14, 0x32, 0x81, 0x91, 0xA1,
+	0x08, 0x23, 0x42, 0xB1, 0xC1, 0x15, 0x52, 0xD1, 0xF0, 0x24, 0x33, 0x62, 0x72, 0x82, 0x09, 0x0A,
+	0x16, 0x17, 0x18, 0x19, 0x1A, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2A, 0x34, 0x35, 0x36, 0x37, 0x38,
+	0x39, 0x3A, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58,
+	0x59, 0x5A, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78,
+	0x79, 0x7A, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97,
+	0x98, 0x99, 0x9A, 0xA2, 0xA3, 0xA4, 0xA5, 0xA6, 0xA7, 0xA8, 0xA9, 0xAA, 0xB2, 0xB3, 0xB4, 0xB5,
+	0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xC2, 0xC3, 0xC4, 0xC5, 0xC6, 0xC7, 0xC8, 0xC9, 0xCA, 0xD2, 0xD3,
+	0xD4, 0xD5, 0xD6, 0xD7, 0xD8, 0xD9, 0xDA, 0xE1, 0xE2, 0xE3, 0xE4, 0xE5, 0xE6, 0xE7, 0xE8, 0xE9,
+	0xEA, 0xF1, 0xF2, 0xF3, 0xF4, 0xF5, 0xF6, 0xF7, 0xF8, 0xF9, 0xFA, 0xFF, 0xC4, 0x00, 0x1F, 0x01,
+	0x00, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0xFF, 0xC4, 0x00, 0xB5,
+	0x11, 0x00, 0x02, 0x01, 0x02, 0x04, 0x04, 0x03, 0x04, 0x07, 0x05, 0x04, 0x04, 0x00, 0x01, 0x02,
+	0x77, 0x00, 0x01, 0x02, 0x03, 0x11, 0x04, 0x05, 0x21, 0x31, 0x06, 0x12, 0x41, 0x51, 0x07, 0x61,
+	0x71, 0x13, 0x22, 0x32, 0x81, 0x08, 0x14, 0x42, 0x91, 0xA1, 0xB1, 0xC1, 0x09, 0x23, 0x33, 0x52,
+	0xF0, 0x15, 0x62, 0x72, 0xD1, 0x0A, 0x16, 0x24, 0x34, 0xE1, 0x25, 0xF1, 0x17, 0x18, 0x19, 0x1A,
+	0x26, 0x27, 0x28, 0x29, 0x2A, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x43, 0x44, 0x45, 0x46, 0x47,
+	0x48, 0x49, 0x4A, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A, 0x63, 0x64, 0x65, 0x66, 0x67,
+	0x68, 0x69, 0x6A, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x82, 0x83, 0x84, 0x85, 0x86,
+	0x87, 0x88, 0x89, 0x8A, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9A, 0xA2, 0xA3, 0xA4,
+	0xA5, 0xA6, 0xA7, 0xA8, 0xA9, 0xAA, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xC2,
+	0xC3, 0xC4, 0xC5, 0xC6, 0xC7, 0xC8, 0xC9, 0xCA, 0xD2, 0xD3, 0xD4, 0xD5, 0xD6, 0xD7, 0xD8, 0xD9,
+	0xDA, 0xE2, 0xE3, 0xE4, 0xE5, 0xE6, 0xE7, 0xE8, 0xE9, 0xEA, 0xF2, 0xF3, 0xF4, 0xF5, 0xF6, 0xF7,
+	0xF8, 0xF9, 0xFA, 0xFF, 0xDB, 0x00, 0x43, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x02,
+	0x02, 0x03, 0x04, 0x03, 0x03, 0x03, 0x04, 0x05, 0x04, 0x04, 0x04, 0x04, 0x05, 0x07, 0x05, 0x05,
+	0x05, 0x05, 0x05, 0x07, 0x08, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x08, 0x08, 0x08, 0x08, 0x08,
+	0x08, 0x08, 0x08, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0xFF, 0xDB, 0x00, 0x43, 0x01, 0x02, 0x02, 0x02,
+	0x03, 0x03, 0x03, 0x06, 0x03, 0x03, 0x06, 0x0D, 0x09, 0x07, 0x09, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0xFF, 0xDD, 0x00,
+	0x04, 0x00, 0x2E, 0xFF, 0xDA, 0x00, 0x0C, 0x03, 0x01, 0x00, 0x02, 0x11, 0x03, 0x11, 0x00, 0x3F,
+	0x00, 0xFD, 0xFC, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x03, 0xFF, 0xD0, 0xFD, 0xFC, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x03, 0xFF, 0xD1, 0xFD, 0xFC, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x03, 0xFF, 0xD2, 0xFD, 0xFC, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x03, 0xFF,
+	0xD3, 0xFD, 0xFC, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x03, 0xFF, 0xD4, 0xFD, 0xFC, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x03, 0xFF, 0xD5, 0xFD, 0xFC, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x03, 0xFF, 0xD6, 0xFD, 0xFC, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x03, 0xFF,
+	0xD7, 0xFD, 0xFC, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x03, 0xFF, 0xD0, 0xFD, 0xFC, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x03, 0xFF, 0xD1, 0xFD, 0xFC, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x03, 0xFF, 0xD2, 0xFD, 0xFC, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x03, 0xFF,
+	0xD3, 0xFD, 0xFC, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x03, 0xFF, 0xD4, 0xFD, 0xFC, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x03, 0xFF, 0xD5, 0xFD, 0xFC, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x03, 0xFF, 0xD6, 0xFD, 0xFC, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x03, 0xFF,
+	0xD7, 0xFD, 0xFC, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x03, 0xFF, 0xD0, 0xFD, 0xFC, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x03, 0xFF, 0xD1, 0xFD, 0xFC, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x03, 0xFF, 0xD2, 0xFD, 0xFC, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x03, 0xFF,
+	0xD3, 0xFD, 0xFC, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x03, 0xFF, 0xD4, 0xFD, 0xFC, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x03, 0xFF, 0xD5, 0xFD, 0xFC, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x03, 0xFF, 0xD6, 0xFD, 0xFC, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x03, 0xFF,
+	0xD7, 0xFD, 0xFC, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x03, 0xFF, 0xD0, 0xFD, 0xFC, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x03, 0xFF, 0xD1, 0xFD, 0xFC, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x03, 0xFF, 0xD2, 0xFD, 0xFC, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x03, 0xFF,
+	0xD3, 0xFD, 0xFC, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x03, 0xFF, 0xD4, 0xFD, 0xFC, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x03, 0xFF, 0xD5, 0xFD, 0xFC, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x03, 0xFF, 0xD6, 0xFD, 0xFC, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x03, 0xFF,
+	0xD7, 0xFD, 0xFC, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x03, 0xFF, 0xD0, 0xFD, 0xFC, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x03, 0xFF, 0xD1, 0xFD, 0xFC, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x03, 0xFF, 0xD2, 0xFD, 0xFC, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x03, 0xFF,
+	0xD3, 0xFD, 0xFC, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x03, 0xFF, 0xD4, 0xFD, 0xFC, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x03, 0xFF, 0xD5, 0xFD, 0xFC, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x03, 0xFF, 0xD6, 0xFD, 0xFC, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x03, 0xFF,
+	0xD7, 0xFD, 0xFC, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x03, 0xFF, 0xD0, 0xFD, 0xFC, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x03, 0xFF, 0xD1, 0xFD, 0xFC, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x03, 0xFF, 0xD2, 0xFD, 0xFC, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x03, 0xFF,
+	0xD3, 0xFD, 0xFC, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x03, 0xFF, 0xD4, 0xFD, 0xFC, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x03, 0xFF, 0xD5, 0xFD, 0xFC, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x03, 0xFF, 0xD6, 0xFD, 0xFC, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x03, 0xFF,
+	0xD7, 0xFD, 0xFC, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x03, 0xFF, 0xD0, 0xFD, 0xFC, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x03, 0xFF, 0xD1, 0xFD, 0xFC, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x03, 0xFF, 0xD2, 0xFD, 0xFC, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x03, 0xFF,
+	0xD3, 0xFD, 0xFC, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x03, 0xFF, 0xD4, 0xFD, 0xFC, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x03, 0xFF, 0xD5, 0xFD, 0xFC, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x03, 0xFF, 0xD6, 0xFD, 0xFC, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x03, 0xFF,
+	0xD7, 0xFD, 0xFC, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x03, 0xFF, 0xD0, 0xFD, 0xFC, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x03, 0xFF, 0xD1, 0xFD, 0xFC, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x03, 0xFF, 0xD2, 0xFD, 0xFC, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x03, 0xFF,
+	0xD3, 0xFD, 0xFC, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x03, 0xFF, 0xD4, 0xFD, 0xFC, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x03, 0xFF, 0xD5, 0xFD, 0xFC, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x03, 0xFF, 0xD6, 0xFD, 0xFC, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2,
+	0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x03, 0xFF,
+	0xD9, 0xFF, 0xD8, 0xFF, 0xE0, 0x00, 0x10, 0x4A, 0x46, 0x49, 0x46, 0x00, 0x01, 0x01, 0x00, 0x00,
+	0x48, 0x00, 0x48, 0x00, 0x00, 0xFF, 0xE1, 0x00, 0x40, 0x45, 0x78, 0x69, 0x66, 0x00, 0x00, 0x4D,
+	0x4D, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x08, 0x00, 0x01, 0x87, 0x69, 0x00, 0x04, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA0, 0x02, 0x00, 0x04, 0x00,
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x26, 0xA0, 0x03, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xED, 0x00, 0x38, 0x50, 0x68, 0x6F, 0x74, 0x6F,
+	0x73, 0x68, 0x6F, 0x70, 0x20, 0x33, 0x2E, 0x30, 0x00, 0x38, 0x42, 0x49, 0x4D, 0x04, 0x04, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x42, 0x49, 0x4D, 0x04, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x10, 0xD4, 0x1D, 0x8C, 0xD9, 0x8F, 0x00, 0xB2, 0x04, 0xE9, 0x80, 0x09, 0x98, 0xEC, 0xF8, 0x42,
+	0x7E, 0xFF, 0xC0, 0x00, 0x11, 0x08, 0x00, 0x36, 0x00, 0x26, 0x03, 0x01, 0x22, 0x00, 0x02, 0x11,
+	0x01, 0x03, 0x11, 0x01, 0xFF, 0xC4, 0x00, 0x1F, 0x00, 0x00, 0x01, 0x05, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
+	0x07, 0x08, 0x09, 0x0A, 0x0B, 0xFF, 0xC4, 0x00, 0xB5, 0x10, 0x00, 0x02, 0x01, 0x03, 0x03, 0x02,
+	0x04, 0x03, 0x05, 0x05, 0x04, 0x04, 0x00, 0x00, 0x01, 0x7D, 0x01, 0x02, 0x03, 0x00, 0x04, 0x11,
+	0x05, 0x12, 0x21, 0x31, 0x41, 0x06, 0x13, 0x51, 0x61, 0x07, 0x22, 0x71, 0x14, 0x32, 0x81, 0x91,
+	0xA1, 0x08, 0x23, 0x42, 0xB1, 0xC1, 0x15, 0x52, 0xD1, 0xF0, 0x24, 0x33, 0x62, 0x72, 0x82, 0x09,
+	0x0A, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2A, 0x34, 0x35, 0x36, 0x37,
+	0x38, 0x39, 0x3A, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A, 0x53, 0x54, 0x55, 0x56, 0x57,
+	0x58, 0x59, 0x5A, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x73, 0x74, 0x75, 0x76, 0x77,
+	0x78, 0x79, 0x7A, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x92, 0x93, 0x94, 0x95, 0x96,
+	0x97, 0x98, 0x99, 0x9A, 0xA2, 0xA3, 0xA4, 0xA5, 0xA6, 0xA7, 0xA8, 0xA9, 0xAA, 0xB2, 0xB3, 0xB4,
+	0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xC2, 0xC3, 0xC4, 0xC5, 0xC6, 0xC7, 0xC8, 0xC9, 0xCA, 0xD2,
+	0xD3, 0xD4, 0xD5, 0xD6, 0xD7, 0xD8, 0xD9, 0xDA, 0xE1, 0xE2, 0xE3, 0xE4, 0xE5, 0xE6, 0xE7, 0xE8,
+	0xE9, 0xEA, 0xF1, 0xF2, 0xF3, 0xF4, 0xF5, 0xF6, 0xF7, 0xF8, 0xF9, 0xFA, 0xFF, 0xC4, 0x00, 0x1F,
+	0x01, 0x00, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0xFF, 0xC4, 0x00,
+	0xB5, 0x11, 0x00, 0x02, 0x01, 0x02, 0x04, 0x04, 0x03, 0x04, 0x07, 0x05, 0x04, 0x04, 0x00, 0x01,
+	0x02, 0x77, 0x00, 0x01, 0x02, 0x03, 0x11, 0x04, 0x05, 0x21, 0x31, 0x06, 0x12, 0x41, 0x51, 0x07,
+	0x61, 0x71, 0x13, 0x22, 0x32, 0x81, 0x08, 0x14, 0x42, 0x91, 0xA1, 0xB1, 0xC1, 0x09, 0x23, 0x33,
+	0x52, 0xF0, 0x15, 0x62, 0x72, 0xD1, 0x0A, 0x16, 0x24, 0x34, 0xE1, 0x25, 0xF1, 0x17, 0x18, 0x19,
+	0x1A, 0x26, 0x27, 0x28, 0x29, 0x2A, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x43, 0x44, 0x45, 0x46,
+	0x47, 0x48, 0x49, 0x4A, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A, 0x63, 0x64, 0x65, 0x66,
+	0x67, 0x68, 0x69, 0x6A, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x82, 0x83, 0x84, 0x85,
+	0x86, 0x87, 0x88, 0x89, 0x8A, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9A, 0xA2, 0xA3,
+	0xA4, 0xA5, 0xA6, 0xA7, 0xA8, 0xA9, 0xAA, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA,
+	0xC2, 0xC3, 0xC4, 0xC5, 0xC6, 0xC7, 0xC8, 0xC9, 0xCA, 0xD2, 0xD3, 0xD4, 0xD5, 0xD6, 0xD7, 0xD8,
+	0xD9, 0xDA, 0xE2, 0xE3, 0xE4, 0xE5, 0xE6, 0xE7, 0xE8, 0xE9, 0xEA, 0xF2, 0xF3, 0xF4, 0xF5, 0xF6,
+	0xF7, 0xF8, 0xF9, 0xFA, 0xFF, 0xDB, 0x00, 0x43, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03,
+	0x02, 0x02, 0x03, 0x04, 0x03, 0x03, 0x03, 0x04, 0x05, 0x04, 0x04, 0x04, 0x04, 0x05, 0x07, 0x05,
+	0x05, 0x05, 0x05, 0x05, 0x07, 0x08, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x08, 0x08, 0x08, 0x08,
+	0x08, 0x08, 0x08, 0x08, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0xFF, 0xDB, 0x00, 0x43, 0x01, 0x02, 0x02,
+	0x02, 0x03, 0x03, 0x03, 0x06, 0x03, 0x03, 0x06, 0x0D, 0x09, 0x07, 0x09, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0xFF, 0xDD,
+	0x00, 0x04, 0x00, 0x03, 0xFF, 0xDA, 0x00, 0x0C, 0x03, 0x01, 0x00, 0x02, 0x11, 0x03, 0x11, 0x00,
+	0x3F, 0x00, 0xFD, 0xFC, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x03,
+	0xFF, 0xD0, 0xFD, 0xFC, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x03,
+	0xFF, 0xD1, 0xFD, 0xFC, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x03,
+	0xFF, 0xD2, 0xFD, 0xFC, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x03,
+	0xFF, 0xD9, 0xFF, 0xD8, 0xFF, 0xE0, 0x00, 0x10, 0x4A, 0x46, 0x49, 0x46, 0x00, 0x01, 0x01, 0x00,
+	0x00, 0x48, 0x00, 0x48, 0x00, 0x00, 0xFF, 0xE1, 0x00, 0x40, 0x45, 0x78, 0x69, 0x66, 0x00, 0x00,
+	0x4D, 0x4D, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x08, 0x00, 0x01, 0x87, 0x69, 0x00, 0x04, 0x00, 0x00,
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA0, 0x02, 0x00, 0x04,
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x9F, 0xA0, 0x03, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01,
+	0x00, 0x00, 0x00, 0xE1, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xED, 0x00, 0x38, 0x50, 0x68, 0x6F, 0x74,
+	0x6F, 0x73, 0x68, 0x6F, 0x70, 0x20, 0x33, 0x2E, 0x30, 0x00, 0x38, 0x42, 0x49, 0x4D, 0x04, 0x04,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x42, 0x49, 0x4D, 0x04, 0x25, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x10, 0xD4, 0x1D, 0x8C, 0xD9, 0x8F, 0x00, 0xB2, 0x04, 0xE9, 0x80, 0x09, 0x98, 0xEC, 0xF8,
+	0x42, 0x7E, 0xFF, 0xC0, 0x00, 0x11, 0x08, 0x00, 0xE1, 0x00, 0x9F, 0x03, 0x01, 0x22, 0x00, 0x02,
+	0x11, 0x01, 0x03, 0x11, 0x01, 0xFF, 0xC4, 0x00, 0x1F, 0x00, 0x00, 0x01, 0x05, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
+	0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0xFF, 0xC4, 0x00, 0xB5, 0x10, 0x00, 0x02, 0x01, 0x03, 0x03,
+	0x02, 0x04, 0x03, 0x05, 0x05, 0x04, 0x04, 0x00, 0x00, 0x01, 0x7D, 0x01, 0x02, 0x03, 0x00, 0x04,
+	0x11, 0x05, 0x12, 0x21, 0x31, 0x41, 0x06, 0x13, 0x51, 0x61, 0x07, 0x22, 0x71, 0x14, 0x32, 0x81,
+	0x91, 0xA1, 0x08, 0x23, 0x42, 0xB1, 0xC1, 0x15, 0x52, 0xD1, 0xF0, 0x24, 0x33, 0x62, 0x72, 0x82,
+	0x09, 0x0A, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2A, 0x34, 0x35, 0x36,
+	0x37, 0x38, 0x39, 0x3A, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A, 0x53, 0x54, 0x55, 0x56,
+	0x57, 0x58, 0x59, 0x5A, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x73, 0x74, 0x75, 0x76,
+	0x77, 0x78, 0x79, 0x7A, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x92, 0x93, 0x94, 0x95,
+	0x96, 0x97, 0x98, 0x99, 0x9A, 0xA2, 0xA3, 0xA4, 0xA5, 0xA6, 0xA7, 0xA8, 0xA9, 0xAA, 0xB2, 0xB3,
+	0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xC2, 0xC3, 0xC4, 0xC5, 0xC6, 0xC7, 0xC8, 0xC9, 0xCA,
+	0xD2, 0xD3, 0xD4, 0xD5, 0xD6, 0xD7, 0xD8, 0xD9, 0xDA, 0xE1, 0xE2, 0xE3, 0xE4, 0xE5, 0xE6, 0xE7,
+	0xE8, 0xE9, 0xEA, 0xF1, 0xF2, 0xF3, 0xF4, 0xF5, 0xF6, 0xF7, 0xF8, 0xF9, 0xFA, 0xFF, 0xC4, 0x00,
+	0x1F, 0x01, 0x00, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0xFF, 0xC4,
+	0x00, 0xB5, 0x11, 0x00, 0x02, 0x01, 0x02, 0x04, 0x04, 0x03, 0x04, 0x07, 0x05, 0x04, 0x04, 0x00,
+	0x01, 0x02, 0x77, 0x00, 0x01, 0x02, 0x03, 0x11, 0x04, 0x05, 0x21, 0x31, 0x06, 0x12, 0x41, 0x51,
+	0x07, 0x61, 0x71, 0x13, 0x22, 0x32, 0x81, 0x08, 0x14, 0x42, 0x91, 0xA1, 0xB1, 0xC1, 0x09, 0x23,
+	0x33, 0x52, 0xF0, 0x15, 0x62, 0x72, 0xD1, 0x0A, 0x16, 0x24, 0x34, 0xE1, 0x25, 0xF1, 0x17, 0x18,
+	0x19, 0x1A, 0x26, 0x27, 0x28, 0x29, 0x2A, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x43, 0x44, 0x45,
+	0x46, 0x47, 0x48, 0x49, 0x4A, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A, 0x63, 0x64, 0x65,
+	0x66, 0x67, 0x68, 0x69, 0x6A, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x82, 0x83, 0x84,
+	0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9A, 0xA2,
+	0xA3, 0xA4, 0xA5, 0xA6, 0xA7, 0xA8, 0xA9, 0xAA, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9,
+	0xBA, 0xC2, 0xC3, 0xC4, 0xC5, 0xC6, 0xC7, 0xC8, 0xC9, 0xCA, 0xD2, 0xD3, 0xD4, 0xD5, 0xD6, 0xD7,
+	0xD8, 0xD9, 0xDA, 0xE2, 0xE3, 0xE4, 0xE5, 0xE6, 0xE7, 0xE8, 0xE9, 0xEA, 0xF2, 0xF3, 0xF4, 0xF5,
+	0xF6, 0xF7, 0xF8, 0xF9, 0xFA, 0xFF, 0xDB, 0x00, 0x43, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+	0x03, 0x02, 0x02, 0x03, 0x04, 0x03, 0x03, 0x03, 0x04, 0x05, 0x04, 0x04, 0x04, 0x04, 0x05, 0x07,
+	0x05, 0x05, 0x05, 0x05, 0x05, 0x07, 0x08, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x08, 0x08, 0x08,
+	0x08, 0x08, 0x08, 0x08, 0x08, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0xFF, 0xDB, 0x00, 0x43, 0x01, 0x02,
+	0x02, 0x02, 0x03, 0x03, 0x03, 0x06, 0x03, 0x03, 0x06, 0x0D, 0x09, 0x07, 0x09, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0xFF,
+	0xDD, 0x00, 0x04, 0x00, 0x0A, 0xFF, 0xDA, 0x00, 0x0C, 0x03, 0x01, 0x00, 0x02, 0x11, 0x03, 0x11,
+	0x00, 0x3F, 0x00, 0xFD, 0xFC, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28,
+	0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28,
+	0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x03, 0xFF, 0xD0, 0xFD,
+	0xFC, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28,
+	0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28,
+	0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x03, 0xFF, 0xD1, 0xFD, 0xFC, 0xA2, 0x8A, 0x28,
+	0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28,
+	0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28,
+	0x00, 0xA2, 0x8A, 0x28, 0x03, 0xFF, 0xD2, 0xFD, 0xFC, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28,
+	0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28,
+	0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28,
+	0x03, 0xFF, 0xD3, 0xFD, 0xFC, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28,
+	0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28,
+	0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x03, 0xFF, 0xD4, 0xFD,
+	0xFC, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28,
+	0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28,
+	0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x03, 0xFF, 0xD5, 0xFD, 0xFC, 0xA2, 0x8A, 0x28,
+	0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28,
+	0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28,
+	0x00, 0xA2, 0x8A, 0x28, 0x03, 0xFF, 0xD6, 0xFD, 0xFC, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28,
+	0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28,
+	0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28,
+	0x03, 0xFF, 0xD7, 0xFD, 0xFC, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28,
+	0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28,
+	0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x03, 0xFF, 0xD0, 0xFD,
+	0xFC, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28,
+	0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28,
+	0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x03, 0xFF, 0xD1, 0xFD, 0xFC, 0xA2, 0x8A, 0x28,
+	0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28,
+	0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28,
+	0x00, 0xA2, 0x8A, 0x28, 0x03, 0xFF, 0xD2, 0xFD, 0xFC, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28,
+	0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28,
+	0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28,
+	0x03, 0xFF, 0xD3, 0xFD, 0xFC, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28,
+	0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28,
+	0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x03, 0xFF, 0xD4, 0xFD,
+	0xFC, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28,
+	0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28,
+	0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x03, 0xFF, 0xD5, 0xFD, 0xFC, 0xA2, 0x8A, 0x28,
+	0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28,
+	0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28, 0x00, 0xA2, 0x8A, 0x28,
+	0x00, 0xA2, 0x8A, 0x28, 0x03, 0xFF, 0xD9,
+]
@@ -3,11 +3,12 @@
 import Foundation
 import SwiftTextIWA
 
-/// Every generated iWork archive model, by proto full name + a decode factory.
-/// Lets a binder match an unknown object's type number to its best-fit message.
+/// Every generated iWork archive model. Each carries its proto full name and
+/// field table (`schema`), which a binder matches against an unknown object's
+/// wire fields to find its type number's best-fit message.
 enum IWACatalog {
-    static func all() -> [(name: String, decode: (ProtobufMessage) -> IWAMessage)] {
-        var a = [(name: String, decode: (ProtobufMessage) -> IWAMessage)]()
+    static func all() -> [any IWAMessage.Type] {
+        var a = [any IWAMessage.Type]()
         registerIWA_TNArchives(&a)
         registerIWA_TPArchives(&a)
         registerIWA_TSAArchives(&a)
@@ -7,586 +7,306 @@ import SwiftTextIWA
 /// an un-vendored archive (TSCE/TSCK/charts/Keynote) are absent — callers treat a
 /// `nil` result as "pass the original bytes through unchanged".
 enum IWATypeRegistry {
-    /// Round-trips a known object payload through its typed model (decode → encode).
-    /// Returns nil for types this build does not model.
-    static func reencode(type: UInt64, payload: [UInt8]) -> [UInt8]? {
-        let m = ProtobufMessage(payload)
+    /// The generated model for an IWA type number. Returns nil for types this build
+    /// does not model.
+    static func model(for type: UInt64) -> (any IWAMessage.Type)? {
         switch type {
-        case 14: return TSWP_TextualAttachmentArchive(m).encoded()
-        case 200: return TSK_DocumentArchive(m).encoded()
-        case 201: return TSK_LocalCommandHistory(m).encoded()
-        case 202: return TSK_CommandGroupArchive(m).encoded()
-        case 203: return TSK_CommandContainerArchive(m).encoded()
-        case 205: return TSK_TreeNode(m).encoded()
-        case 210: return TSK_ViewStateArchive(m).encoded()
-        case 211: return TSK_DocumentSupportArchive(m).encoded()
-        case 212: return TSK_AnnotationAuthorArchive(m).encoded()
-        case 213: return TSK_AnnotationAuthorStorageArchive(m).encoded()
-        case 215: return TSCK_SetAnnotationAuthorColorCommandArchive(m).encoded()
-        case 218: return TSCK_CollaborationCommandHistory(m).encoded()
-        case 219: return TSK_DocumentSelectionArchive(m).encoded()
-        case 220: return TSK_CommandSelectionBehaviorArchive(m).encoded()
-        case 221: return TSK_NullCommandArchive(m).encoded()
-        case 222: return TSK_CustomFormatListArchive(m).encoded()
-        case 223: return TSK_GroupCommitCommandArchive(m).encoded()
-        case 224: return TSK_InducedCommandCollectionArchive(m).encoded()
-        case 225: return TSK_InducedCommandCollectionCommitCommandArchive(m).encoded()
-        case 226: return TSCK_CollaborationDocumentSessionState(m).encoded()
-        case 227: return TSCK_CollaborationCommandHistoryCoalescingGroup(m).encoded()
-        case 228: return TSCK_CollaborationCommandHistoryCoalescingGroupNode(m).encoded()
-        case 229: return TSCK_CollaborationCommandHistoryOriginatingCommandAcknowledgementObserver(m).encoded()
-        case 230: return TSCK_DocumentSupportCollaborationState(m).encoded()
-        case 231: return TSK_ChangeDocumentPackageTypeCommandArchive(m).encoded()
-        case 232: return TSK_UpgradeDocPostProcessingCommandArchive(m).encoded()
-        case 233: return TSK_FinalCommandPairArchive(m).encoded()
-        case 234: return TSK_OutgoingCommandQueueItem(m).encoded()
-        case 235: return TSCK_TransformerEntry(m).encoded()
-        case 238: return TSCK_CreateLocalStorageSnapshotCommandArchive(m).encoded()
-        case 240: return TSK_SelectionPathTransformerArchive(m).encoded()
-        case 241: return TSK_NativeContentDescription(m).encoded()
-        case 242: return TSD_PencilAnnotationStorageArchive(m).encoded()
-        case 245: return TSCK_OperationStorage(m).encoded()
-        case 246: return TSCK_OperationStorageEntryArray(m).encoded()
-        case 247: return TSCK_OperationStorageEntryArraySegment(m).encoded()
-        case 248: return TSCK_BlockDiffsAtCurrentRevisionCommand(m).encoded()
-        case 249: return TSCK_OutgoingCommandQueue(m).encoded()
-        case 250: return TSCK_OutgoingCommandQueueSegment(m).encoded()
-        case 251: return TSK_PropagatedCommandCollectionArchive(m).encoded()
-        case 252: return TSK_LocalCommandHistoryItem(m).encoded()
-        case 253: return TSK_LocalCommandHistoryArray(m).encoded()
-        case 254: return TSK_LocalCommandHistoryArraySegment(m).encoded()
-        case 255: return TSCK_CollaborationCommandHistoryItem(m).encoded()
-        case 256: return TSCK_CollaborationCommandHistoryArray(m).encoded()
-        case 257: return TSCK_CollaborationCommandHistoryArraySegment(m).encoded()
-        case 258: return TSK_PencilAnnotationUIState(m).encoded()
-        case 260: return TSCK_CommandAssetChunkArchive(m).encoded()
-        case 261: return TSCK_AssetUploadStatusCommandArchive(m).encoded()
-        case 262: return TSCK_AssetUnmaterializedOnServerCommandArchive(m).encoded()
-        case 263: return TSK_CommandBehaviorArchive(m).encoded()
-        case 264: return TSK_CommandBehaviorSelectionPathStorageArchive(m).encoded()
-        case 265: return TSCK_CommandActivityBehaviorArchive(m).encoded()
-        case 273: return TSCK_ActivityOnlyCommandArchive(m).encoded()
-        case 275: return TSCK_SetActivityAuthorShareParticipantIDCommandArchive(m).encoded()
-        case 279: return TSCK_ActivityAuthorCacheArchive(m).encoded()
-        case 280: return TSCK_ActivityStreamArchive(m).encoded()
-        case 281: return TSCK_ActivityArchive(m).encoded()
-        case 282: return TSCK_ActivityCommitCommandArchive(m).encoded()
-        case 283: return TSCK_ActivityStreamActivityArray(m).encoded()
-        case 284: return TSCK_ActivityStreamActivityArraySegment(m).encoded()
-        case 285: return TSCK_ActivityStreamRemovedAuthorAuditorPendingStateArchive(m).encoded()
-        case 286: return TSCK_ActivityAuthorArchive(m).encoded()
-        case 289: return TSCK_ActivityCursorCollectionPersistenceWrapperArchive(m).encoded()
-        case 400: return TSS_StyleArchive(m).encoded()
-        case 401: return TSS_StylesheetArchive(m).encoded()
-        case 402: return TSS_ThemeArchive(m).encoded()
-        case 412: return TSS_StyleUpdatePropertyMapCommandArchive(m).encoded()
-        case 413: return TSS_ThemeReplacePresetCommandArchive(m).encoded()
-        case 414: return TSS_ThemeAddStylePresetCommandArchive(m).encoded()
-        case 415: return TSS_ThemeRemoveStylePresetCommandArchive(m).encoded()
-        case 416: return TSS_ThemeReplaceColorPresetCommandArchive(m).encoded()
-        case 417: return TSS_ThemeMovePresetCommandArchive(m).encoded()
-        case 419: return TSS_ThemeReplaceStylePresetAndDisconnectStylesCommandArchive(m).encoded()
-        case 600: return TSA_DocumentArchive(m).encoded()
-        case 601: return TSA_FunctionBrowserStateArchive(m).encoded()
-        case 602: return TSA_PropagatePresetCommandArchive(m).encoded()
-        case 603: return TSA_ShortcutControllerArchive(m).encoded()
-        case 604: return TSA_ShortcutCommandArchive(m).encoded()
-        case 605: return TSA_AddCustomFormatCommandArchive(m).encoded()
-        case 606: return TSA_UpdateCustomFormatCommandArchive(m).encoded()
-        case 607: return TSA_ReplaceCustomFormatCommandArchive(m).encoded()
-        case 612: return TSA_InducedVerifyObjectsWithServerCommandArchive(m).encoded()
-        case 616: return TSA_NeedsMediaCompatibilityUpgradeCommandArchive(m).encoded()
-        case 617: return TSA_ChangeDocumentLocaleCommandArchive(m).encoded()
-        case 618: return TSA_StyleUpdatePropertyMapCommandArchive(m).encoded()
-        case 619: return TSA_RemoteDataChangeCommandArchive(m).encoded()
-        case 623: return TSA_GalleryItem(m).encoded()
-        case 624: return TSA_GallerySelectionTransformer(m).encoded()
-        case 625: return TSA_GalleryItemSelection(m).encoded()
-        case 626: return TSA_GalleryItemSelectionTransformer(m).encoded()
-        case 627: return TSA_GalleryInfoSetValueCommandArchive(m).encoded()
-        case 628: return TSA_GalleryItemSetGeometryCommand(m).encoded()
-        case 629: return TSA_GalleryItemSetValueCommand(m).encoded()
-        case 630: return TSA_InducedVerifyTransformHistoryWithServerCommandArchive(m).encoded()
-        case 633: return TSA_CaptionInfoArchive(m).encoded()
-        case 634: return TSA_CaptionPlacementArchive(m).encoded()
-        case 635: return TSA_TitlePlacementCommandArchive(m).encoded()
-        case 636: return TSA_GalleryInfoInsertItemsCommandArchive(m).encoded()
-        case 637: return TSA_GalleryInfoRemoveItemsCommandArchive(m).encoded()
-        case 641: return TSA_Object3DInfoSetValueCommandArchive(m).encoded()
-        case 642: return TSA_Object3DInfoCommandArchive(m).encoded()
-        case 2001: return TSWP_StorageArchive(m).encoded()
-        case 2002: return TSWP_SelectionArchive(m).encoded()
-        case 2003: return TSWP_DrawableAttachmentArchive(m).encoded()
-        case 2004: return TSWP_TextualAttachmentArchive(m).encoded()
-        case 2005: return TSWP_StorageArchive(m).encoded()
-        case 2006: return TSWP_UIGraphicalAttachment(m).encoded()
-        case 2007: return TSWP_TextualAttachmentArchive(m).encoded()
-        case 2008: return TSWP_FootnoteReferenceAttachmentArchive(m).encoded()
-        case 2009: return TSWP_TextualAttachmentArchive(m).encoded()
-        case 2010: return TSWP_TSWPTOCPageNumberAttachmentArchive(m).encoded()
-        case 2011: return TSWP_ShapeInfoArchive(m).encoded()
-        case 2013: return TSWP_HighlightArchive(m).encoded()
-        case 2014: return TSWP_CommentInfoArchive(m).encoded()
-        case 2015: return TSWP_EquationInfoArchive(m).encoded()
-        case 2016: return TSWP_PencilAnnotationArchive(m).encoded()
-        case 2021: return TSWP_CharacterStyleArchive(m).encoded()
-        case 2022: return TSWP_ParagraphStyleArchive(m).encoded()
-        case 2023: return TSWP_ListStyleArchive(m).encoded()
-        case 2024: return TSWP_ColumnStyleArchive(m).encoded()
-        case 2025: return TSWP_ShapeStyleArchive(m).encoded()
-        case 2026: return TSWP_TOCEntryStyleArchive(m).encoded()
-        case 2031: return TSWP_PlaceholderSmartFieldArchive(m).encoded()
-        case 2032: return TSWP_HyperlinkFieldArchive(m).encoded()
-        case 2033: return TSWP_FilenameSmartFieldArchive(m).encoded()
-        case 2034: return TSWP_DateTimeSmartFieldArchive(m).encoded()
-        case 2035: return TSWP_BookmarkFieldArchive(m).encoded()
-        case 2036: return TSWP_MergeSmartFieldArchive(m).encoded()
-        case 2037: return TSWP_CitationRecordArchive(m).encoded()
-        case 2038: return TSWP_CitationSmartFieldArchive(m).encoded()
-        case 2039: return TSWP_UnsupportedHyperlinkFieldArchive(m).encoded()
-        case 2040: return TSWP_BibliographySmartFieldArchive(m).encoded()
-        case 2041: return TSWP_TOCSmartFieldArchive(m).encoded()
-        case 2042: return TSWP_RubyFieldArchive(m).encoded()
-        case 2043: return TSWP_NumberAttachmentArchive(m).encoded()
-        case 2050: return TSWP_TextStylePresetArchive(m).encoded()
-        case 2051: return TSWP_TOCSettingsArchive(m).encoded()
-        case 2052: return TSWP_TOCEntryInstanceArchive(m).encoded()
-        case 2060: return TSWP_ChangeArchive(m).encoded()
-        case 2061: return TSK_DeprecatedChangeAuthorArchive(m).encoded()
-        case 2062: return TSWP_ChangeSessionArchive(m).encoded()
-        case 2240: return TSWP_TOCInfoArchive(m).encoded()
-        case 2241: return TSWP_TOCAttachmentArchive(m).encoded()
-        case 2242: return TSWP_TOCLayoutHintArchive(m).encoded()
-        case 2409: return TSWP_HyperlinkSelectionArchive(m).encoded()
-        case 2410: return TSWP_FlowInfoArchive(m).encoded()
-        case 2411: return TSWP_FlowInfoContainerArchive(m).encoded()
-        case 2413: return TSWP_DateTimeSelectionArchive(m).encoded()
-        case 3002: return TSD_DrawableArchive(m).encoded()
-        case 3003: return TSD_ContainerArchive(m).encoded()
-        case 3004: return TSD_ShapeArchive(m).encoded()
-        case 3005: return TSD_ImageArchive(m).encoded()
-        case 3006: return TSD_MaskArchive(m).encoded()
-        case 3007: return TSD_MovieArchive(m).encoded()
-        case 3008: return TSD_GroupArchive(m).encoded()
-        case 3009: return TSD_ConnectionLineArchive(m).encoded()
-        case 3015: return TSD_ShapeStyleArchive(m).encoded()
-        case 3016: return TSD_MediaStyleArchive(m).encoded()
-        case 3045: return TSD_CanvasSelectionArchive(m).encoded()
-        case 3047: return TSD_GuideStorageArchive(m).encoded()
-        case 3056: return TSD_CommentStorageArchive(m).encoded()
-        case 3057: return TSD_ThemeReplaceFillPresetCommandArchive(m).encoded()
-        case 3061: return TSD_DrawableSelectionArchive(m).encoded()
-        case 3062: return TSD_GroupSelectionArchive(m).encoded()
-        case 3063: return TSD_PathSelectionArchive(m).encoded()
-        case 3070: return TSD_ReplaceAnnotationAuthorCommandArchive(m).encoded()
-        case 3083: return TSD_DrawableContentDescription(m).encoded()
-        case 3086: return TSD_PencilAnnotationArchive(m).encoded()
-        case 3089: return TSD_PencilAnnotationSelectionArchive(m).encoded()
-        case 3090: return TSD_FreehandDrawingContentDescription(m).encoded()
-        case 3091: return TSD_FreehandDrawingToolkitUIState(m).encoded()
-        case 3097: return TSD_StandinCaptionArchive(m).encoded()
-        case 4000: return TSCE_CalculationEngineArchive(m).encoded()
-        case 4001: return TSCE_FormulaRewriteCommandArchive(m).encoded()
-        case 4003: return TSCE_NamedReferenceManagerArchive(m).encoded()
-        case 4004: return TSCE_TrackedReferenceStoreArchive(m).encoded()
-        case 4005: return TSCE_TrackedReferenceArchive(m).encoded()
-        case 4007: return TSCE_RemoteDataStoreArchive(m).encoded()
-        case 4008: return TSCE_FormulaOwnerDependenciesArchive(m).encoded()
-        case 4009: return TSCE_CellRecordTileArchive(m).encoded()
-        case 4010: return TSCE_RangePrecedentsTileArchive(m).encoded()
-        case 4011: return TSCE_ReferencesToDirtyArchive(m).encoded()
-        case 6000: return TST_TableInfoArchive(m).encoded()
-        case 6001: return TST_TableModelArchive(m).encoded()
-        case 6002: return TST_Tile(m).encoded()
-        case 6003: return TST_TableStyleArchive(m).encoded()
-        case 6004: return TST_CellStyleArchive(m).encoded()
-        case 6005: return TST_TableDataList(m).encoded()
-        case 6006: return TST_HeaderStorageBucket(m).encoded()
-        case 6007: return TST_WPTableInfoArchive(m).encoded()
-        case 6008: return TST_TableStylePresetArchive(m).encoded()
-        case 6009: return TST_TableStrokePresetArchive(m).encoded()
-        case 6010: return TST_ConditionalStyleSetArchive(m).encoded()
-        case 6011: return TST_TableDataListSegment(m).encoded()
-        case 6030: return TST_SelectionArchive(m).encoded()
-        case 6031: return TST_CellMapArchive(m).encoded()
-        case 6032: return TST_DeathhawkRdar39989167CellSelectionArchive(m).encoded()
-        case 6033: return TST_ConcurrentCellMapArchive(m).encoded()
-        case 6034: return TST_ConcurrentCellListArchive(m).encoded()
-        case 6144: return TST_MergeRegionMapArchive(m).encoded()
-        case 6179: return TST_FormulaEqualsTokenAttachmentArchive(m).encoded()
-        case 6181: return TST_TokenAttachmentArchive(m).encoded()
-        case 6182: return TST_ExpressionNodeArchive(m).encoded()
-        case 6183: return TST_BooleanNodeArchive(m).encoded()
-        case 6184: return TST_NumberNodeArchive(m).encoded()
-        case 6185: return TST_StringNodeArchive(m).encoded()
-        case 6186: return TST_ArrayNodeArchive(m).encoded()
-        case 6187: return TST_ListNodeArchive(m).encoded()
-        case 6188: return TST_OperatorNodeArchive(m).encoded()
-        case 6189: return TST_FunctionNodeArchive(m).encoded()
-        case 6190: return TST_DateNodeArchive(m).encoded()
-        case 6191: return TST_ReferenceNodeArchive(m).encoded()
-        case 6192: return TST_DurationNodeArchive(m).encoded()
-        case 6193: return TST_ArgumentPlaceholderNodeArchive(m).encoded()
-        case 6194: return TST_PostfixOperatorNodeArchive(m).encoded()
-        case 6195: return TST_PrefixOperatorNodeArchive(m).encoded()
-        case 6196: return TST_FunctionEndNodeArchive(m).encoded()
-        case 6197: return TST_EmptyExpressionNodeArchive(m).encoded()
-        case 6198: return TST_LayoutHintArchive(m).encoded()
-        case 6199: return TST_CompletionTokenAttachmentArchive(m).encoded()
-        case 6201: return TST_TableDataList(m).encoded()
-        case 6204: return TST_HiddenStateFormulaOwnerArchive(m).encoded()
-        case 6206: return TST_PopUpMenuModel(m).encoded()
-        case 6218: return TST_RichTextPayloadArchive(m).encoded()
-        case 6220: return TST_FilterSetArchive(m).encoded()
-        case 6235: return TST_IdentifierNodeArchive(m).encoded()
-        case 6247: return TST_TableStyleNetworkArchive(m).encoded()
-        case 6264: return TST_CellDiffMapArchive(m).encoded()
-        case 6267: return TST_ColumnRowUIDMapArchive(m).encoded()
-        case 6271: return TST_FormulaSelectionArchive(m).encoded()
-        case 6273: return TST_CellListArchive(m).encoded()
-        case 6283: return TST_ControlCellSelectionArchive(m).encoded()
-        case 6284: return TST_TableNameSelectionArchive(m).encoded()
-        case 6295: return TST_StrokeSelectionArchive(m).encoded()
-        case 6298: return TST_VariableNodeArchive(m).encoded()
-        case 6302: return TST_DefaultCellStylesContainerArchive(m).encoded()
-        case 6305: return TST_StrokeSidecarArchive(m).encoded()
-        case 6306: return TST_StrokeLayerArchive(m).encoded()
-        case 6311: return TST_AutofillSelectionArchive(m).encoded()
-        case 6312: return TST_StockCellSelectionArchive(m).encoded()
-        case 6316: return TST_SummaryModelArchive(m).encoded()
-        case 6317: return TST_SummaryCellVendorArchive(m).encoded()
-        case 6318: return TST_CategoryOrderArchive(m).encoded()
-        case 6357: return TST_ChangePropagationMapWrapper(m).encoded()
-        case 6363: return TST_PencilAnnotationArchive(m).encoded()
-        case 6365: return TST_HeaderNameMgrTileArchive(m).encoded()
-        case 6366: return TST_HeaderNameMgrArchive(m).encoded()
-        case 6367: return TST_CellDiffArray(m).encoded()
-        case 6368: return TST_CellDiffArraySegment(m).encoded()
-        case 6369: return TST_PivotOrderArchive(m).encoded()
-        case 6370: return TST_PivotOwnerArchive(m).encoded()
-        case 6372: return TST_CategoryOwnerRefArchive(m).encoded()
-        case 6373: return TST_GroupByArchive(m).encoded()
-        case 6374: return TST_PivotGroupingColumnOptionsMapArchive(m).encoded()
-        case 6382: return TST_GroupByArchive_AggregatorArchive(m).encoded()
-        case 6383: return TST_GroupByArchive_GroupNodeArchive(m).encoded()
-        case 6384: return TST_SpillOriginRefNodeArchive(m).encoded()
-        case 10011: return TSWP_SectionPlaceholderArchive(m).encoded()
-        case 10023: return TSWP_TateChuYokoFieldArchive(m).encoded()
-        case 10024: return TSWP_DropCapStyleArchive(m).encoded()
-        case 11000: return TSP_PasteboardObject(m).encoded()
-        case 11006: return TSP_PackageMetadata(m).encoded()
-        case 11007: return TSP_PasteboardMetadata(m).encoded()
-        case 11008: return TSP_ObjectContainer(m).encoded()
-        case 11009: return TSP_ViewStateMetadata(m).encoded()
-        case 11010: return TSP_ObjectCollection(m).encoded()
-        case 11011: return TSP_DocumentMetadata(m).encoded()
-        case 11012: return TSP_SupportMetadata(m).encoded()
-        case 11013: return TSP_ObjectSerializationMetadata(m).encoded()
-        case 11014: return TSP_DataMetadata(m).encoded()
-        case 11015: return TSP_DataMetadataMap(m).encoded()
-        case 11016: return TSP_LargeNumberArraySegment(m).encoded()
-        case 11017: return TSP_LargeStringArraySegment(m).encoded()
-        case 11018: return TSP_LargeLazyObjectArraySegment(m).encoded()
-        case 11019: return TSP_LargeNumberArray(m).encoded()
-        case 11020: return TSP_LargeStringArray(m).encoded()
-        case 11021: return TSP_LargeLazyObjectArray(m).encoded()
-        case 11024: return TSP_LargeUUIDArraySegment(m).encoded()
-        case 11025: return TSP_LargeUUIDArray(m).encoded()
-        case 11026: return TSP_LargeObjectArraySegment(m).encoded()
-        case 11027: return TSP_LargeObjectArray(m).encoded()
+        case 14: return TSWP_TextualAttachmentArchive.self
+        case 200: return TSK_DocumentArchive.self
+        case 201: return TSK_LocalCommandHistory.self
+        case 202: return TSK_CommandGroupArchive.self
+        case 203: return TSK_CommandContainerArchive.self
+        case 205: return TSK_TreeNode.self
+        case 210: return TSK_ViewStateArchive.self
+        case 211: return TSK_DocumentSupportArchive.self
+        case 212: return TSK_AnnotationAuthorArchive.self
+        case 213: return TSK_AnnotationAuthorStorageArchive.self
+        case 215: return TSCK_SetAnnotationAuthorColorCommandArchive.self
+        case 218: return TSCK_CollaborationCommandHistory.self
+        case 219: return TSK_DocumentSelectionArchive.self
+        case 220: return TSK_CommandSelectionBehaviorArchive.self
+        case 221: return TSK_NullCommandArchive.self
+        case 222: return TSK_CustomFormatListArchive.self
+        case 223: return TSK_GroupCommitCommandArchive.self
+        case 224: return TSK_InducedCommandCollectionArchive.self
+        case 225: return TSK_InducedCommandCollectionCommitCommandArchive.self
+        case 226: return TSCK_CollaborationDocumentSessionState.self
+        case 227: return TSCK_CollaborationCommandHistoryCoalescingGroup.self
+        case 228: return TSCK_CollaborationCommandHistoryCoalescingGroupNode.self
+        case 229: return TSCK_CollaborationCommandHistoryOriginatingCommandAcknowledgementObserver.self
+        case 230: return TSCK_DocumentSupportCollaborationState.self
+        case 231: return TSK_ChangeDocumentPackageTypeCommandArchive.self
+        case 232: return TSK_UpgradeDocPostProcessingCommandArchive.self
+        case 233: return TSK_FinalCommandPairArchive.self
+        case 234: return TSK_OutgoingCommandQueueItem.self
+        case 235: return TSCK_TransformerEntry.self
+        case 238: return TSCK_CreateLocalStorageSnapshotCommandArchive.self
+        case 240: return TSK_SelectionPathTransformerArchive.self
+        case 241: return TSK_NativeContentDescription.self
+        case 242: return TSD_PencilAnnotationStorageArchive.self
+        case 245: return TSCK_OperationStorage.self
+        case 246: return TSCK_OperationStorageEntryArray.self
+        case 247: return TSCK_OperationStorageEntryArraySegment.self
+        case 248: return TSCK_BlockDiffsAtCurrentRevisionCommand.self
+        case 249: return TSCK_OutgoingCommandQueue.self
+        case 250: return TSCK_OutgoingCommandQueueSegment.self
+        case 251: return TSK_PropagatedCommandCollectionArchive.self
+        case 252: return TSK_LocalCommandHistoryItem.self
+        case 253: return TSK_LocalCommandHistoryArray.self
+        case 254: return TSK_LocalCommandHistoryArraySegment.self
+        case 255: return TSCK_CollaborationCommandHistoryItem.self
+        case 256: return TSCK_CollaborationCommandHistoryArray.self
+        case 257: return TSCK_CollaborationCommandHistoryArraySegment.self
+        case 258: return TSK_PencilAnnotationUIState.self
+        case 260: return TSCK_CommandAssetChunkArchive.self
+        case 261: return TSCK_AssetUploadStatusCommandArchive.self
+        case 262: return TSCK_AssetUnmaterializedOnServerCommandArchive.self
+        case 263: return TSK_CommandBehaviorArchive.self
+        case 264: return TSK_CommandBehaviorSelectionPathStorageArchive.self
+        case 265: return TSCK_CommandActivityBehaviorArchive.self
+        case 273: return TSCK_ActivityOnlyCommandArchive.self
+        case 275: return TSCK_SetActivityAuthorShareParticipantIDCommandArchive.self
+        case 279: return TSCK_ActivityAuthorCacheArchive.self
+        case 280: return TSCK_ActivityStreamArchive.self
+        case 281: return TSCK_ActivityArchive.self
+        case 282: return TSCK_ActivityCommitCommandArchive.self
+        case 283: return TSCK_ActivityStreamActivityArray.self
+        case 284: return TSCK_ActivityStreamActivityArraySegment.self
+        case 285: return TSCK_ActivityStreamRemovedAuthorAuditorPendingStateArchive.self
+        case 286: return TSCK_ActivityAuthorArchive.self
+        case 289: return TSCK_ActivityCursorCollectionPersistenceWrapperArchive.self
+        case 400: return TSS_StyleArchive.self
+        case 401: return TSS_StylesheetArchive.self
+        case 402: return TSS_ThemeArchive.self
+        case 412: return TSS_StyleUpdatePropertyMapCommandArchive.self
+        case 413: return TSS_ThemeReplacePresetCommandArchive.self
+        case 414: return TSS_ThemeAddStylePresetCommandArchive.self
+        case 415: return TSS_ThemeRemoveStylePresetCommandArchive.self
+        case 416: return TSS_ThemeReplaceColorPresetCommandArchive.self
+        case 417: return TSS_ThemeMovePresetCommandArchive.self
+        case 419: return TSS_ThemeReplaceStylePresetAndDisconnectStylesCommandArchive.self
+        case 600: return TSA_DocumentArchive.self
+        case 601: return TSA_FunctionBrowserStateArchive.self
+        case 602: return TSA_PropagatePresetCommandArchive.self
+        case 603: return TSA_ShortcutControllerArchive.self
+        case 604: return TSA_ShortcutCommandArchive.self
+        case 605: return TSA_AddCustomFormatCommandArchive.self
+        case 606: return TSA_UpdateCustomFormatCommandArchive.self
+        case 607: return TSA_ReplaceCustomFormatCommandArchive.self
+        case 612: return TSA_InducedVerifyObjectsWithServerCommandArchive.self
+        case 616: return TSA_NeedsMediaCompatibilityUpgradeCommandArchive.self
+        case 617: return TSA_ChangeDocumentLocaleCommandArchive.self
+        case 618: return TSA_StyleUpdatePropertyMapCommandArchive.self
+        case 619: return TSA_RemoteDataChangeCommandArchive.self
+        case 623: return TSA_GalleryItem.self
+        case 624: return TSA_GallerySelectionTransformer.self
+        case 625: return TSA_GalleryItemSelection.self
+        case 626: return TSA_GalleryItemSelectionTransformer.self
+        case 627: return TSA_GalleryInfoSetValueCommandArchive.self
+        case 628: return TSA_GalleryItemSetGeometryCommand.self
+        case 629: return TSA_GalleryItemSetValueCommand.self
+        case 630: return TSA_InducedVerifyTransformHistoryWithServerCommandArchive.self
+        case 633: return TSA_CaptionInfoArchive.self
+        case 634: return TSA_CaptionPlacementArchive.self
+        case 635: return TSA_TitlePlacementCommandArchive.self
+        case 636: return TSA_GalleryInfoInsertItemsCommandArchive.self
+        case 637: return TSA_GalleryInfoRemoveItemsCommandArchive.self
+        case 641: return TSA_Object3DInfoSetValueCommandArchive.self
+        case 642: return TSA_Object3DInfoCommandArchive.self
+        case 2001: return TSWP_StorageArchive.self
+        case 2002: return TSWP_SelectionArchive.self
+        case 2003: return TSWP_DrawableAttachmentArchive.self
+        case 2004: return TSWP_TextualAttachmentArchive.self
+        case 2005: return TSWP_StorageArchive.self
+        case 2006: return TSWP_UIGraphicalAttachment.self
+        case 2007: return TSWP_TextualAttachmentArchive.self
+        case 2008: return TSWP_FootnoteReferenceAttachmentArchive.self
+        case 2009: return TSWP_TextualAttachmentArchive.self
+        case 2010: return TSWP_TSWPTOCPageNumberAttachmentArchive.self
+        case 2011: return TSWP_ShapeInfoArchive.self
+        case 2013: return TSWP_HighlightArchive.self
+        case 2014: return TSWP_CommentInfoArchive.self
+        case 2015: return TSWP_EquationInfoArchive.self
+        case 2016: return TSWP_PencilAnnotationArchive.self
+        case 2021: return TSWP_CharacterStyleArchive.self
+        case 2022: return TSWP_ParagraphStyleArchive.self
+        case 2023: return TSWP_ListStyleArchive.self
+        case 2024: return TSWP_ColumnStyleArchive.self
+        case 2025: return TSWP_ShapeStyleArchive.self
+        case 2026: return TSWP_TOCEntryStyleArchive.self
+        case 2031: return TSWP_PlaceholderSmartFieldArchive.self
+        case 2032: return TSWP_HyperlinkFieldArchive.self
+        case 2033: return TSWP_FilenameSmartFieldArchive.self
+        case 2034: return TSWP_DateTimeSmartFieldArchive.self
+        case 2035: return TSWP_BookmarkFieldArchive.self
+        case 2036: return TSWP_MergeSmartFieldArchive.self
+        case 2037: return TSWP_CitationRecordArchive.self
+        case 2038: return TSWP_CitationSmartFieldArchive.self
+        case 2039: return TSWP_UnsupportedHyperlinkFieldArchive.self
+        case 2040: return TSWP_BibliographySmartFieldArchive.self
+        case 2041: return TSWP_TOCSmartFieldArchive.self
+        case 2042: return TSWP_RubyFieldArchive.self
+        case 2043: return TSWP_NumberAttachmentArchive.self
+        case 2050: return TSWP_TextStylePresetArchive.self
+        case 2051: return TSWP_TOCSettingsArchive.self
+        case 2052: return TSWP_TOCEntryInstanceArchive.self
+        case 2060: return TSWP_ChangeArchive.self
+        case 2061: return TSK_DeprecatedChangeAuthorArchive.self
+        case 2062: return TSWP_ChangeSessionArchive.self
+        case 2240: return TSWP_TOCInfoArchive.self
+        case 2241: return TSWP_TOCAttachmentArchive.self
+        case 2242: return TSWP_TOCLayoutHintArchive.self
+        case 2409: return TSWP_HyperlinkSelectionArchive.self
+        case 2410: return TSWP_FlowInfoArchive.self
+        case 2411: return TSWP_FlowInfoContainerArchive.self
+        case 2413: return TSWP_DateTimeSelectionArchive.self
+        case 3002: return TSD_DrawableArchive.self
+        case 3003: return TSD_ContainerArchive.self
+        case 3004: return TSD_ShapeArchive.self
+        case 3005: return TSD_ImageArchive.self
+        case 3006: return TSD_MaskArchive.self
+        case 3007: return TSD_MovieArchive.self
+        case 3008: return TSD_GroupArchive.self
+        case 3009: return TSD_ConnectionLineArchive.self
+        case 3015: return TSD_ShapeStyleArchive.self
+        case 3016: return TSD_MediaStyleArchive.self
+        case 3045: return TSD_CanvasSelectionArchive.self
+        case 3047: return TSD_GuideStorageArchive.self
+        case 3056: return TSD_CommentStorageArchive.self
+        case 3057: return TSD_ThemeReplaceFillPresetCommandArchive.self
+        case 3061: return TSD_DrawableSelectionArchive.self
+        case 3062: return TSD_GroupSelectionArchive.self
+        case 3063: return TSD_PathSelectionArchive.self
+        case 3070: return TSD_ReplaceAnnotationAuthorCommandArchive.self
+        case 3083: return TSD_DrawableContentDescription.self
+        case 3086: return TSD_PencilAnnotationArchive.self
+        case 3089: return TSD_PencilAnnotationSelectionArchive.self
+        case 3090: return TSD_FreehandDrawingContentDescription.self
+        case 3091: return TSD_FreehandDrawingToolkitUIState.self
+        case 3097: return TSD_StandinCaptionArchive.self
+        case 4000: return TSCE_CalculationEngineArchive.self
+        case 4001: return TSCE_FormulaRewriteCommandArchive.self
+        case 4003: return TSCE_NamedReferenceManagerArchive.self
+        case 4004: return TSCE_TrackedReferenceStoreArchive.self
+        case 4005: return TSCE_TrackedReferenceArchive.self
+        case 4007: return TSCE_RemoteDataStoreArchive.self
+        case 4008: return TSCE_FormulaOwnerDependenciesArchive.self
+        case 4009: return TSCE_CellRecordTileArchive.self
+        case 4010: return TSCE_RangePrecedentsTileArchive.self
+        case 4011: return TSCE_ReferencesToDirtyArchive.self
+        case 6000: return TST_TableInfoArchive.self
+        case 6001: return TST_TableModelArchive.self
+        case 6002: return TST_Tile.self
+        case 6003: return TST_TableStyleArchive.self
+        case 6004: return TST_CellStyleArchive.self
+        case 6005: return TST_TableDataList.self
+        case 6006: return TST_HeaderStorageBucket.self
+        case 6007: return TST_WPTableInfoArchive.self
+        case 6008: return TST_TableStylePresetArchive.self
+        case 6009: return TST_TableStrokePresetArchive.self
+        case 6010: return TST_ConditionalStyleSetArchive.self
+        case 6011: return TST_TableDataListSegment.self
+        case 6030: return TST_SelectionArchive.self
+        case 6031: return TST_CellMapArchive.self
+        case 6032: return TST_DeathhawkRdar39989167CellSelectionArchive.self
+        case 6033: return TST_ConcurrentCellMapArchive.self
+        case 6034: return TST_ConcurrentCellListArchive.self
+        case 6144: return TST_MergeRegionMapArchive.self
+        case 6179: return TST_FormulaEqualsTokenAttachmentArchive.self
+        case 6181: return TST_TokenAttachmentArchive.self
+        case 6182: return TST_ExpressionNodeArchive.self
+        case 6183: return TST_BooleanNodeArchive.self
+        case 6184: return TST_NumberNodeArchive.self
+        case 6185: return TST_StringNodeArchive.self
+        case 6186: return TST_ArrayNodeArchive.self
+        case 6187: return TST_ListNodeArchive.self
+        case 6188: return TST_OperatorNodeArchive.self
+        case 6189: return TST_FunctionNodeArchive.self
+        case 6190: return TST_DateNodeArchive.self
+        case 6191: return TST_ReferenceNodeArchive.self
+        case 6192: return TST_DurationNodeArchive.self
+        case 6193: return TST_ArgumentPlaceholderNodeArchive.self
+        case 6194: return TST_PostfixOperatorNodeArchive.self
+        case 6195: return TST_PrefixOperatorNodeArchive.self
+        case 6196: return TST_FunctionEndNodeArchive.self
+        case 6197: return TST_EmptyExpressionNodeArchive.self
+        case 6198: return TST_LayoutHintArchive.self
+        case 6199: return TST_CompletionTokenAttachmentArchive.self
+        case 6201: return TST_TableDataList.self
+        case 6204: return TST_HiddenStateFormulaOwnerArchive.self
+        case 6206: return TST_PopUpMenuModel.self
+        case 6218: return TST_RichTextPayloadArchive.self
+        case 6220: return TST_FilterSetArchive.self
+        case 6235: return TST_IdentifierNodeArchive.self
+        case 6247: return TST_TableStyleNetworkArchive.self
+        case 6264: return TST_CellDiffMapArchive.self
+        case 6267: return TST_ColumnRowUIDMapArchive.self
+        case 6271: return TST_FormulaSelectionArchive.self
+        case 6273: return TST_CellListArchive.self
+        case 6283: return TST_ControlCellSelectionArchive.self
+        case 6284: return TST_TableNameSelectionArchive.self
+        case 6295: return TST_StrokeSelectionArchive.self
+        case 6298: return TST_VariableNodeArchive.self
+        case 6302: return TST_DefaultCellStylesContainerArchive.self
+        case 6305: return TST_StrokeSidecarArchive.self
+        case 6306: return TST_StrokeLayerArchive.self
+        case 6311: return TST_AutofillSelectionArchive.self
+        case 6312: return TST_StockCellSelectionArchive.self
+        case 6316: return TST_SummaryModelArchive.self
+        case 6317: return TST_SummaryCellVendorArchive.self
+        case 6318: return TST_CategoryOrderArchive.self
+        case 6357: return TST_ChangePropagationMapWrapper.self
+        case 6363: return TST_PencilAnnotationArchive.self
+        case 6365: return TST_HeaderNameMgrTileArchive.self
+        case 6366: return TST_HeaderNameMgrArchive.self
+        case 6367: return TST_CellDiffArray.self
+        case 6368: return TST_CellDiffArraySegment.self
+        case 6369: return TST_PivotOrderArchive.self
+        case 6370: return TST_PivotOwnerArchive.self
+        case 6372: return TST_CategoryOwnerRefArchive.self
+        case 6373: return TST_GroupByArchive.self
+        case 6374: return TST_PivotGroupingColumnOptionsMapArchive.self
+        case 6382: return TST_GroupByArchive_AggregatorArchive.self
+        case 6383: return TST_GroupByArchive_GroupNodeArchive.self
+        case 6384: return TST_SpillOriginRefNodeArchive.self
+        case 10011: return TSWP_SectionPlaceholderArchive.self
+        case 10023: return TSWP_TateChuYokoFieldArchive.self
+        case 10024: return TSWP_DropCapStyleArchive.self
+        case 11000: return TSP_PasteboardObject.self
+        case 11006: return TSP_PackageMetadata.self
+        case 11007: return TSP_PasteboardMetadata.self
+        case 11008: return TSP_ObjectContainer.self
+        case 11009: return TSP_ViewStateMetadata.self
+        case 11010: return TSP_ObjectCollection.self
+        case 11011: return TSP_DocumentMetadata.self
+        case 11012: return TSP_SupportMetadata.self
+        case 11013: return TSP_ObjectSerializationMetadata.self
+        case 11014: return TSP_DataMetadata.self
+        case 11015: return TSP_DataMetadataMap.self
+        case 11016: return TSP_LargeNumberArraySegment.self
+        case 11017: return TSP_LargeStringArraySegment.self
+        case 11018: return TSP_LargeLazyObjectArraySegment.self
+        case 11019: return TSP_LargeNumberArray.self
+        case 11020: return TSP_LargeStringArray.self
+        case 11021: return TSP_LargeLazyObjectArray.self
+        case 11024: return TSP_LargeUUIDArraySegment.self
+        case 11025: return TSP_LargeUUIDArray.self
+        case 11026: return TSP_LargeObjectArraySegment.self
+        case 11027: return TSP_LargeObjectArray.self
         default: return nil
         }
     }
 
+    /// Round-trips a known object payload through its typed model (decode → encode).
+    /// Returns nil for types this build does not model.
+    static func reencode(type: UInt64, payload: [UInt8]) -> [UInt8]? {
+        decode(type: type, payload: payload)?.encoded()
+    }
+
     /// Decodes a known object payload into its typed model. Returns nil for types
     /// this build does not model (the caller keeps the raw bytes).
-    static func decode(type: UInt64, payload: [UInt8]) -> IWAMessage? {
-        let m = ProtobufMessage(payload)
-        switch type {
-        case 14: return TSWP_TextualAttachmentArchive(m)
-        case 200: return TSK_DocumentArchive(m)
-        case 201: return TSK_LocalCommandHistory(m)
-        case 202: return TSK_CommandGroupArchive(m)
-        case 203: return TSK_CommandContainerArchive(m)
-        case 205: return TSK_TreeNode(m)
-        case 210: return TSK_ViewStateArchive(m)
-        case 211: return TSK_DocumentSupportArchive(m)
-        case 212: return TSK_AnnotationAuthorArchive(m)
-        case 213: return TSK_AnnotationAuthorStorageArchive(m)
-        case 215: return TSCK_SetAnnotationAuthorColorCommandArchive(m)
-        case 218: return TSCK_CollaborationCommandHistory(m)
-        case 219: return TSK_DocumentSelectionArchive(m)
-        case 220: return TSK_CommandSelectionBehaviorArchive(m)
-        case 221: return TSK_NullCommandArchive(m)
-        case 222: return TSK_CustomFormatListArchive(m)
-        case 223: return TSK_GroupCommitCommandArchive(m)
-        case 224: return TSK_InducedCommandCollectionArchive(m)
-        case 225: return TSK_InducedCommandCollectionCommitCommandArchive(m)
-        case 226: return TSCK_CollaborationDocumentSessionState(m)
-        case 227: return TSCK_CollaborationCommandHistoryCoalescingGroup(m)
-        case 228: return TSCK_CollaborationCommandHistoryCoalescingGroupNode(m)
-        case 229: return TSCK_CollaborationCommandHistoryOriginatingCommandAcknowledgementObserver(m)
-        case 230: return TSCK_DocumentSupportCollaborationState(m)
-        case 231: return TSK_ChangeDocumentPackageTypeCommandArchive(m)
-        case 232: return TSK_UpgradeDocPostProcessingCommandArchive(m)
-        case 233: return TSK_FinalCommandPairArchive(m)
-        case 234: return TSK_OutgoingCommandQueueItem(m)
-        case 235: return TSCK_TransformerEntry(m)
-        case 238: return TSCK_CreateLocalStorageSnapshotCommandArchive(m)
-        case 240: return TSK_SelectionPathTransformerArchive(m)
-        case 241: return TSK_NativeContentDescription(m)
-        case 242: return TSD_PencilAnnotationStorageArchive(m)
-        case 245: return TSCK_OperationStorage(m)
-        case 246: return TSCK_OperationStorageEntryArray(m)
-        case 247: return TSCK_OperationStorageEntryArraySegment(m)
-        case 248: return TSCK_BlockDiffsAtCurrentRevisionCommand(m)
-        case 249: return TSCK_OutgoingCommandQueue(m)
-        case 250: return TSCK_OutgoingCommandQueueSegment(m)
-        case 251: return TSK_PropagatedCommandCollectionArchive(m)
-        case 252: return TSK_LocalCommandHistoryItem(m)
-        case 253: return TSK_LocalCommandHistoryArray(m)
-        case 254: return TSK_LocalCommandHistoryArraySegment(m)
-        case 255: return TSCK_CollaborationCommandHistoryItem(m)
-        case 256: return TSCK_CollaborationCommandHistoryArray(m)
-        case 257: return TSCK_CollaborationCommandHistoryArraySegment(m)
-        case 258: return TSK_PencilAnnotationUIState(m)
-        case 260: return TSCK_CommandAssetChunkArchive(m)
-        case 261: return TSCK_AssetUploadStatusCommandArchive(m)
-        case 262: return TSCK_AssetUnmaterializedOnServerCommandArchive(m)
-        case 263: return TSK_CommandBehaviorArchive(m)
-        case 264: return TSK_CommandBehaviorSelectionPathStorageArchive(m)
-        case 265: return TSCK_CommandActivityBehaviorArchive(m)
-        case 273: return TSCK_ActivityOnlyCommandArchive(m)
-        case 275: return TSCK_SetActivityAuthorShareParticipantIDCommandArchive(m)
-        case 279: return TSCK_ActivityAuthorCacheArchive(m)
-        case 280: return TSCK_ActivityStreamArchive(m)
-        case 281: return TSCK_ActivityArchive(m)
-        case 282: return TSCK_ActivityCommitCommandArchive(m)
-        case 283: return TSCK_ActivityStreamActivityArray(m)
-        case 284: return TSCK_ActivityStreamActivityArraySegment(m)
-        case 285: return TSCK_ActivityStreamRemovedAuthorAuditorPendingStateArchive(m)
-        case 286: return TSCK_ActivityAuthorArchive(m)
-        case 289: return TSCK_ActivityCursorCollectionPersistenceWrapperArchive(m)
-        case 400: return TSS_StyleArchive(m)
-        case 401: return TSS_StylesheetArchive(m)
-        case 402: return TSS_ThemeArchive(m)
-        case 412: return TSS_StyleUpdatePropertyMapCommandArchive(m)
-        case 413: return TSS_ThemeReplacePresetCommandArchive(m)
-        case 414: return TSS_ThemeAddStylePresetCommandArchive(m)
-        case 415: return TSS_ThemeRemoveStylePresetCommandArchive(m)
-        case 416: return TSS_ThemeReplaceColorPresetCommandArchive(m)
-        case 417: return TSS_ThemeMovePresetCommandArchive(m)
-        case 419: return TSS_ThemeReplaceStylePresetAndDisconnectStylesCommandArchive(m)
-        case 600: return TSA_DocumentArchive(m)
-        case 601: return TSA_FunctionBrowserStateArchive(m)
-        case 602: return TSA_PropagatePresetCommandArchive(m)
-        case 603: return TSA_ShortcutControllerArchive(m)
-        case 604: return TSA_ShortcutCommandArchive(m)
-        case 605: return TSA_AddCustomFormatCommandArchive(m)
-        case 606: return TSA_UpdateCustomFormatCommandArchive(m)
-        case 607: return TSA_ReplaceCustomFormatCommandArchive(m)
-        case 612: return TSA_InducedVerifyObjectsWithServerCommandArchive(m)
-        case 616: return TSA_NeedsMediaCompatibilityUpgradeCommandArchive(m)
-        case 617: return TSA_ChangeDocumentLocaleCommandArchive(m)
-        case 618: return TSA_StyleUpdatePropertyMapCommandArchive(m)
-        case 619: return TSA_RemoteDataChangeCommandArchive(m)
-        case 623: return TSA_GalleryItem(m)
-        case 624: return TSA_GallerySelectionTransformer(m)
-        case 625: return TSA_GalleryItemSelection(m)
-        case 626: return TSA_GalleryItemSelectionTransformer(m)
-        case 627: return TSA_GalleryInfoSetValueCommandArchive(m)
-        case 628: return TSA_GalleryItemSetGeometryCommand(m)
-        case 629: return TSA_GalleryItemSetValueCommand(m)
-        case 630: return TSA_InducedVerifyTransformHistoryWithServerCommandArchive(m)
-        case 633: return TSA_CaptionInfoArchive(m)
-        case 634: return TSA_CaptionPlacementArchive(m)
-        case 635: return TSA_TitlePlacementCommandArchive(m)
-        case 636: return TSA_GalleryInfoInsertItemsCommandArchive(m)
-        case 637: return TSA_GalleryInfoRemoveItemsCommandArchive(m)
-        case 641: return TSA_Object3DInfoSetValueCommandArchive(m)
-        case 642: return TSA_Object3DInfoCommandArchive(m)
-        case 2001: return TSWP_StorageArchive(m)
-        case 2002: return TSWP_SelectionArchive(m)
-        case 2003: return TSWP_DrawableAttachmentArchive(m)
-        case 2004: return TSWP_TextualAttachmentArchive(m)
-        case 2005: return TSWP_StorageArchive(m)
-        case 2006: return TSWP_UIGraphicalAttachment(m)
-        case 2007: return TSWP_TextualAttachmentArchive(m)
-        case 2008: return TSWP_FootnoteReferenceAttachmentArchive(m)
-        case 2009: return TSWP_TextualAttachmentArchive(m)
-        case 2010: return TSWP_TSWPTOCPageNumberAttachmentArchive(m)
-        case 2011: return TSWP_ShapeInfoArchive(m)
-        case 2013: return TSWP_HighlightArchive(m)
-        case 2014: return TSWP_CommentInfoArchive(m)
-        case 2015: return TSWP_EquationInfoArchive(m)
-        case 2016: return TSWP_PencilAnnotationArchive(m)
-        case 2021: return TSWP_CharacterStyleArchive(m)
-        case 2022: return TSWP_ParagraphStyleArchive(m)
-        case 2023: return TSWP_ListStyleArchive(m)
-        case 2024: return TSWP_ColumnStyleArchive(m)
-        case 2025: return TSWP_ShapeStyleArchive(m)
-        case 2026: return TSWP_TOCEntryStyleArchive(m)
-        case 2031: return TSWP_PlaceholderSmartFieldArchive(m)
-        case 2032: return TSWP_HyperlinkFieldArchive(m)
-        case 2033: return TSWP_FilenameSmartFieldArchive(m)
-        case 2034: return TSWP_DateTimeSmartFieldArchive(m)
-        case 2035: return TSWP_BookmarkFieldArchive(m)
-        case 2036: return TSWP_MergeSmartFieldArchive(m)
-        case 2037: return TSWP_CitationRecordArchive(m)
-        case 2038: return TSWP_CitationSmartFieldArchive(m)
-        case 2039: return TSWP_UnsupportedHyperlinkFieldArchive(m)
-        case 2040: return TSWP_BibliographySmartFieldArchive(m)
-        case 2041: return TSWP_TOCSmartFieldArchive(m)
-        case 2042: return TSWP_RubyFieldArchive(m)
-        case 2043: return TSWP_NumberAttachmentArchive(m)
-        case 2050: return TSWP_TextStylePresetArchive(m)
-        case 2051: return TSWP_TOCSettingsArchive(m)
-        case 2052: return TSWP_TOCEntryInstanceArchive(m)
-        case 2060: return TSWP_ChangeArchive(m)
-        case 2061: return TSK_DeprecatedChangeAuthorArchive(m)
-        case 2062: return TSWP_ChangeSessionArchive(m)
-        case 2240: return TSWP_TOCInfoArchive(m)
-        case 2241: return TSWP_TOCAttachmentArchive(m)
-        case 2242: return TSWP_TOCLayoutHintArchive(m)
-        case 2409: return TSWP_HyperlinkSelectionArchive(m)
-        case 2410: return TSWP_FlowInfoArchive(m)
-        case 2411: return TSWP_FlowInfoContainerArchive(m)
-        case 2413: return TSWP_DateTimeSelectionArchive(m)
-        case 3002: return TSD_DrawableArchive(m)
-        case 3003: return TSD_ContainerArchive(m)
-        case 3004: return TSD_ShapeArchive(m)
-        case 3005: return TSD_ImageArchive(m)
-        case 3006: return TSD_MaskArchive(m)
-        case 3007: return TSD_MovieArchive(m)
-        case 3008: return TSD_GroupArchive(m)
-        case 3009: return TSD_ConnectionLineArchive(m)
-        case 3015: return TSD_ShapeStyleArchive(m)
-        case 3016: return TSD_MediaStyleArchive(m)
-        case 3045: return TSD_CanvasSelectionArchive(m)
-        case 3047: return TSD_GuideStorageArchive(m)
-        case 3056: return TSD_CommentStorageArchive(m)
-        case 3057: return TSD_ThemeReplaceFillPresetCommandArchive(m)
-        case 3061: return TSD_DrawableSelectionArchive(m)
-        case 3062: return TSD_GroupSelectionArchive(m)
-        case 3063: return TSD_PathSelectionArchive(m)
-        case 3070: return TSD_ReplaceAnnotationAuthorCommandArchive(m)
-        case 3083: return TSD_DrawableContentDescription(m)
-        case 3086: return TSD_PencilAnnotationArchive(m)
-        case 3089: return TSD_PencilAnnotationSelectionArchive(m)
-        case 3090: return TSD_FreehandDrawingContentDescription(m)
-        case 3091: return TSD_FreehandDrawingToolkitUIState(m)
-        case 3097: return TSD_StandinCaptionArchive(m)
-        case 4000: return TSCE_CalculationEngineArchive(m)
-        case 4001: return TSCE_FormulaRewriteCommandArchive(m)
-        case 4003: return TSCE_NamedReferenceManagerArchive(m)
-        case 4004: return TSCE_TrackedReferenceStoreArchive(m)
-        case 4005: return TSCE_TrackedReferenceArchive(m)
-        case 4007: return TSCE_RemoteDataStoreArchive(m)
-        case 4008: return TSCE_FormulaOwnerDependenciesArchive(m)
-        case 4009: return TSCE_CellRecordTileArchive(m)
-        case 4010: return TSCE_RangePrecedentsTileArchive(m)
-        case 4011: return TSCE_ReferencesToDirtyArchive(m)
-        case 6000: return TST_TableInfoArchive(m)
-        case 6001: return TST_TableModelArchive(m)
-        case 6002: return TST_Tile(m)
-        case 6003: return TST_TableStyleArchive(m)
-        case 6004: return TST_CellStyleArchive(m)
-        case 6005: return TST_TableDataList(m)
-        case 6006: return TST_HeaderStorageBucket(m)
-        case 6007: return TST_WPTableInfoArchive(m)
-        case 6008: return TST_TableStylePresetArchive(m)
-        case 6009: return TST_TableStrokePresetArchive(m)
-        case 6010: return TST_ConditionalStyleSetArchive(m)
-        case 6011: return TST_TableDataListSegment(m)
-        case 6030: return TST_SelectionArchive(m)
-        case 6031: return TST_CellMapArchive(m)
-        case 6032: return TST_DeathhawkRdar39989167CellSelectionArchive(m)
-        case 6033: return TST_ConcurrentCellMapArchive(m)
-        case 6034: return TST_ConcurrentCellListArchive(m)
-        case 6144: return TST_MergeRegionMapArchive(m)
-        case 6179: return TST_FormulaEqualsTokenAttachmentArchive(m)
-        case 6181: return TST_TokenAttachmentArchive(m)
-        case 6182: return TST_ExpressionNodeArchive(m)
-        case 6183: return TST_BooleanNodeArchive(m)
-        case 6184: return TST_NumberNodeArchive(m)
-        case 6185: return TST_StringNodeArchive(m)
-        case 6186: return TST_ArrayNodeArchive(m)
-        case 6187: return TST_ListNodeArchive(m)
-        case 6188: return TST_OperatorNodeArchive(m)
-        case 6189: return TST_FunctionNodeArchive(m)
-        case 6190: return TST_DateNodeArchive(m)
-        case 6191: return TST_ReferenceNodeArchive(m)
-        case 6192: return TST_DurationNodeArchive(m)
-        case 6193: return TST_ArgumentPlaceholderNodeArchive(m)
-        case 6194: return TST_PostfixOperatorNodeArchive(m)
-        case 6195: return TST_PrefixOperatorNodeArchive(m)
-        case 6196: return TST_FunctionEndNodeArchive(m)
-        case 6197: return TST_EmptyExpressionNodeArchive(m)
-        case 6198: return TST_LayoutHintArchive(m)
-        case 6199: return TST_CompletionTokenAttachmentArchive(m)
-        case 6201: return TST_TableDataList(m)
-        case 6204: return TST_HiddenStateFormulaOwnerArchive(m)
-        case 6206: return TST_PopUpMenuModel(m)
-        case 6218: return TST_RichTextPayloadArchive(m)
-        case 6220: return TST_FilterSetArchive(m)
-        case 6235: return TST_IdentifierNodeArchive(m)
-        case 6247: return TST_TableStyleNetworkArchive(m)
-        case 6264: return TST_CellDiffMapArchive(m)
-        case 6267: return TST_ColumnRowUIDMapArchive(m)
-        case 6271: return TST_FormulaSelectionArchive(m)
-        case 6273: return TST_CellListArchive(m)
-        case 6283: return TST_ControlCellSelectionArchive(m)
-        case 6284: return TST_TableNameSelectionArchive(m)
-        case 6295: return TST_StrokeSelectionArchive(m)
-        case 6298: return TST_VariableNodeArchive(m)
-        case 6302: return TST_DefaultCellStylesContainerArchive(m)
-        case 6305: return TST_StrokeSidecarArchive(m)
-        case 6306: return TST_StrokeLayerArchive(m)
-        case 6311: return TST_AutofillSelectionArchive(m)
-        case 6312: return TST_StockCellSelectionArchive(m)
-        case 6316: return TST_SummaryModelArchive(m)
-        case 6317: return TST_SummaryCellVendorArchive(m)
-        case 6318: return TST_CategoryOrderArchive(m)
-        case 6357: return TST_ChangePropagationMapWrapper(m)
-        case 6363: return TST_PencilAnnotationArchive(m)
-        case 6365: return TST_HeaderNameMgrTileArchive(m)
-        case 6366: return TST_HeaderNameMgrArchive(m)
-        case 6367: return TST_CellDiffArray(m)
-        case 6368: return TST_CellDiffArraySegment(m)
-        case 6369: return TST_PivotOrderArchive(m)
-        case 6370: return TST_PivotOwnerArchive(m)
-        case 6372: return TST_CategoryOwnerRefArchive(m)
-        case 6373: return TST_GroupByArchive(m)
-        case 6374: return TST_PivotGroupingColumnOptionsMapArchive(m)
-        case 6382: return TST_GroupByArchive_AggregatorArchive(m)
-        case 6383: return TST_GroupByArchive_GroupNodeArchive(m)
-        case 6384: return TST_SpillOriginRefNodeArchive(m)
-        case 10011: return TSWP_SectionPlaceholderArchive(m)
-        case 10023: return TSWP_TateChuYokoFieldArchive(m)
-        case 10024: return TSWP_DropCapStyleArchive(m)
-        case 11000: return TSP_PasteboardObject(m)
-        case 11006: return TSP_PackageMetadata(m)
-        case 11007: return TSP_PasteboardMetadata(m)
-        case 11008: return TSP_ObjectContainer(m)
-        case 11009: return TSP_ViewStateMetadata(m)
-        case 11010: return TSP_ObjectCollection(m)
-        case 11011: return TSP_DocumentMetadata(m)
-        case 11012: return TSP_SupportMetadata(m)
-        case 11013: return TSP_ObjectSerializationMetadata(m)
-        case 11014: return TSP_DataMetadata(m)
-        case 11015: return TSP_DataMetadataMap(m)
-        case 11016: return TSP_LargeNumberArraySegment(m)
-        case 11017: return TSP_LargeStringArraySegment(m)
-        case 11018: return TSP_LargeLazyObjectArraySegment(m)
-        case 11019: return TSP_LargeNumberArray(m)
-        case 11020: return TSP_LargeStringArray(m)
-        case 11021: return TSP_LargeLazyObjectArray(m)
-        case 11024: return TSP_LargeUUIDArraySegment(m)
-        case 11025: return TSP_LargeUUIDArray(m)
-        case 11026: return TSP_LargeObjectArraySegment(m)
-        case 11027: return TSP_LargeObjectArray(m)
-        default: return nil
-        }
+    static func decode(type: UInt64, payload: [UInt8]) -> (any IWAMessage)? {
+        model(for: type).map { IWACodec.decode(ProtobufMessage(payload), as: $0) }
     }
 
     /// The fully-qualified persistence name (e.g. "TST.TableModelArchive") for an
@@ -1231,4 +951,4 @@ enum IWATypeRegistry {
 
     /// The set of IWA type numbers this build can decode into a typed model.
     static let modeledTypes: Set<UInt64> = [14, 200, 201, 202, 203, 205, 210, 211, 212, 213, 215, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 238, 240, 241, 242, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255, 256, 257, 258, 260, 261, 262, 263, 264, 265, 273, 275, 279, 280, 281, 282, 283, 284, 285, 286, 289, 400, 401, 402, 412, 413, 414, 415, 416, 417, 419, 600, 601, 602, 603, 604, 605, 606, 607, 612, 616, 617, 618, 619, 623, 624, 625, 626, 627, 628, 629, 630, 633, 634, 635, 636, 637, 641, 642, 2001, 2002, 2003, 2004, 2005, 2006, 2007, 2008, 2009, 2010, 2011, 2013, 2014, 2015, 2016, 2021, 2022, 2023, 2024, 2025, 2026, 2031, 2032, 2033, 2034, 2035, 2036, 2037, 2038, 2039, 2040, 2041, 2042, 2043, 2050, 2051, 2052, 2060, 2061, 2062, 2240, 2241, 2242, 2409, 2410, 2411, 2413, 3002, 3003, 3004, 3005, 3006, 3007, 3008, 3009, 3015, 3016, 3045, 3047, 3056, 3057, 3061, 3062, 3063, 3070, 3083, 3086, 3089, 3090, 3091, 3097, 4000, 4001, 4003, 4004, 4005, 4007, 4008, 4009, 4010, 4011, 6000, 6001, 6002, 6003, 6004, 6005, 6006, 6007, 6008, 6009, 6010, 6011, 6030, 6031, 6032, 6033, 6034, 6144, 6179, 6181, 6182, 6183, 6184, 6185, 6186, 6187, 6188, 6189, 6190, 6191, 6192, 6193, 6194, 6195, 6196, 6197, 6198, 6199, 6201, 6204, 6206, 6218, 6220, 6235, 6247, 6264, 6267, 6271, 6273, 6283, 6284, 6295, 6298, 6302, 6305, 6306, 6311, 6312, 6316, 6317, 6318, 6357, 6363, 6365, 6366, 6367, 6368, 6369, 6370, 6372, 6373, 6374, 6382, 6383, 6384, 10011, 10023, 10024, 11000, 11006, 11007, 11008, 11009, 11010, 11011, 11012, 11013, 11014, 11015, 11016, 11017, 11018, 11019, 11020, 11021, 11024, 11025, 11026, 11027]
-}
\ No newline at end of file
+}
@@ -1,44 +0,0 @@
-// Generated by Scripts/GenerateIWAModels.swift — do not edit.
-import Foundation
-import SwiftTextIWA
-
-/// Common interface for every generated iWork archive model: decode from a
-/// `ProtobufMessage`, re-encode, and expose the fields it didn't model. Enables the
-/// reflective `IWACatalog` (used to derive type-number bindings by best-fit).
-protocol IWAMessage {
-    init(_ message: ProtobufMessage)
-    func encoded() -> [UInt8]
-    var unknownFields: [ProtobufField] { get }
-}
-
-/// Wire helpers shared by the generated iWork archive models.
-enum IWAWire {
-    static func u32(_ b: [UInt8]) -> UInt32 {
-        b.count >= 4 ? UInt32(b[0]) | UInt32(b[1]) << 8 | UInt32(b[2]) << 16 | UInt32(b[3]) << 24 : 0
-    }
-    static func u64(_ b: [UInt8]) -> UInt64 {
-        guard b.count >= 8 else { return 0 }
-        var v: UInt64 = 0; for k in 0..<8 { v |= UInt64(b[k]) << (8 * k) }; return v
-    }
-    static func unzigzag32(_ v: UInt64) -> Int32 {
-        let u = UInt32(truncatingIfNeeded: v); return Int32(bitPattern: (u >> 1) ^ (~(u & 1) &+ 1))
-    }
-    static func unzigzag64(_ v: UInt64) -> Int64 {
-        Int64(bitPattern: (v >> 1) ^ (~(v & 1) &+ 1))
-    }
-    static func zigzag32(_ n: Int32) -> UInt64 {
-        UInt64(UInt32(bitPattern: (n << 1) ^ (n >> 31)))
-    }
-    static func zigzag64(_ n: Int64) -> UInt64 {
-        UInt64(bitPattern: (n << 1) ^ (n >> 63))
-    }
-    static func unpackVarints(_ b: [UInt8]) -> [UInt64] {
-        var out = [UInt64](); var pos = 0
-        while pos < b.count {
-            var shift: UInt64 = 0, value: UInt64 = 0
-            while pos < b.count { let byte = b[pos]; pos += 1; value |= UInt64(byte & 0x7F) << shift; if byte & 0x80 == 0 { break }; shift += 7 }
-            out.append(value)
-        }
-        return out
-    }
-}
\ No newline at end of file
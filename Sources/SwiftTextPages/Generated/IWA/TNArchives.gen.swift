@@ -5,1142 +5,400 @@ import SwiftTextIWA
 
 /// Generated wire model for `TN.SheetUIStateArchive`.
 final class TN_SheetUIStateArchive: IWAMessage {
-    var viewScale: Float?
-    var scrollPosition: TSP_Point?
-    var previousViewScale: Float?
-    var scrollPositionIsUnscaled: Bool?
-    var previousScrollPosition: TSP_Point?
-    var scrollPositionValid: Bool?
-    var previousScrollPositionValid: Bool?
-    var visibleSize: TSP_Size?
-    var previousVisibleSize: TSP_Size?
-    var deviceIdiom: UInt32?
-    var selectionPath: TSK_SelectionPathArchive?
-    var selectionPathTransformer: TSP_Reference?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TN.SheetUIStateArchive", [
+        .optional(1, .float), .optional(2, TSP_Point.self), .optional(3, .float), .optional(4, .bool),
+        .optional(5, TSP_Point.self), .optional(6, .bool), .optional(7, .bool), .optional(8, TSP_Size.self),
+        .optional(9, TSP_Size.self), .optional(10, .uint32), .optional(11, TSK_SelectionPathArchive.self),
+        .optional(12, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 12)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { viewScale = _v }
-        case 2:
-            var _v: TSP_Point?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Point(ProtobufMessage(_b)) }
-            if let _v { scrollPosition = _v }
-        case 3:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { previousViewScale = _v }
-        case 4:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { scrollPositionIsUnscaled = _v }
-        case 5:
-            var _v: TSP_Point?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Point(ProtobufMessage(_b)) }
-            if let _v { previousScrollPosition = _v }
-        case 6:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { scrollPositionValid = _v }
-        case 7:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { previousScrollPositionValid = _v }
-        case 8:
-            var _v: TSP_Size?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Size(ProtobufMessage(_b)) }
-            if let _v { visibleSize = _v }
-        case 9:
-            var _v: TSP_Size?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Size(ProtobufMessage(_b)) }
-            if let _v { previousVisibleSize = _v }
-        case 10:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { deviceIdiom = _v }
-        case 11:
-            var _v: TSK_SelectionPathArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_SelectionPathArchive(ProtobufMessage(_b)) }
-            if let _v { selectionPath = _v }
-        case 12:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { selectionPathTransformer = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = viewScale { _w.fixed32Field(1, _x.bitPattern) }
-        if let _x = scrollPosition { _w.bytesField(2, _x.encoded()) }
-        if let _x = previousViewScale { _w.fixed32Field(3, _x.bitPattern) }
-        if let _x = scrollPositionIsUnscaled { _w.varintField(4, _x ? 1 : 0) }
-        if let _x = previousScrollPosition { _w.bytesField(5, _x.encoded()) }
-        if let _x = scrollPositionValid { _w.varintField(6, _x ? 1 : 0) }
-        if let _x = previousScrollPositionValid { _w.varintField(7, _x ? 1 : 0) }
-        if let _x = visibleSize { _w.bytesField(8, _x.encoded()) }
-        if let _x = previousVisibleSize { _w.bytesField(9, _x.encoded()) }
-        if let _x = deviceIdiom { _w.varintField(10, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = selectionPath { _w.bytesField(11, _x.encoded()) }
-        if let _x = selectionPathTransformer { _w.bytesField(12, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var viewScale: Float? { get { self[0] } set { self[0] = newValue } }
+    var scrollPosition: TSP_Point? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var previousViewScale: Float? { get { self[2] } set { self[2] = newValue } }
+    var scrollPositionIsUnscaled: Bool? { get { self[3] } set { self[3] = newValue } }
+    var previousScrollPosition: TSP_Point? { get { self[message: 4] } set { self[message: 4] = newValue } }
+    var scrollPositionValid: Bool? { get { self[5] } set { self[5] = newValue } }
+    var previousScrollPositionValid: Bool? { get { self[6] } set { self[6] = newValue } }
+    var visibleSize: TSP_Size? { get { self[message: 7] } set { self[message: 7] = newValue } }
+    var previousVisibleSize: TSP_Size? { get { self[message: 8] } set { self[message: 8] = newValue } }
+    var deviceIdiom: UInt32? { get { self[9] } set { self[9] = newValue } }
+    var selectionPath: TSK_SelectionPathArchive? { get { self[message: 10] } set { self[message: 10] = newValue } }
+    var selectionPathTransformer: TSP_Reference? { get { self[message: 11] } set { self[message: 11] = newValue } }
 }
 
 /// Generated wire model for `TN.SheetUIStateDictionaryEntryArchive`.
 final class TN_SheetUIStateDictionaryEntryArchive: IWAMessage {
-    var sheet: TSP_Reference?
-    var sheetUistate: TN_SheetUIStateArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TN.SheetUIStateDictionaryEntryArchive", [
+        .optional(1, TSP_Reference.self), .optional(2, TN_SheetUIStateArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { sheet = _v }
-        case 2:
-            var _v: TN_SheetUIStateArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TN_SheetUIStateArchive(ProtobufMessage(_b)) }
-            if let _v { sheetUistate = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = sheet { _w.bytesField(1, _x.encoded()) }
-        if let _x = sheetUistate { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var sheet: TSP_Reference? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var sheetUistate: TN_SheetUIStateArchive? { get { self[message: 1] } set { self[message: 1] = newValue } }
 }
 
 /// Generated wire model for `TN.UUIDSheetUIStateDictionaryArchive`.
 final class TN_UUIDSheetUIStateDictionaryArchive: IWAMessage {
-    var sheetUuid: TSP_UUID?
-    var sheetUistate: TN_SheetUIStateArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TN.UUIDSheetUIStateDictionaryArchive", [
+        .optional(1, TSP_UUID.self), .optional(2, TN_SheetUIStateArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { sheetUuid = _v }
-        case 2:
-            var _v: TN_SheetUIStateArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TN_SheetUIStateArchive(ProtobufMessage(_b)) }
-            if let _v { sheetUistate = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = sheetUuid { _w.bytesField(1, _x.encoded()) }
-        if let _x = sheetUistate { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var sheetUuid: TSP_UUID? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var sheetUistate: TN_SheetUIStateArchive? { get { self[message: 1] } set { self[message: 1] = newValue } }
 }
 
 /// Generated wire model for `TN.UIStateArchive`.
 final class TN_UIStateArchive: IWAMessage {
-    var activeSheetIndex: UInt32?
-    var selectedInfo: [TSP_Reference] = []
-    var sheetUistateDictionaryEntry: [TN_SheetUIStateDictionaryEntryArchive] = []
-    var tableSelection: TST_SelectionArchive?
-    var editingSheetIndex: UInt32?
-    var documentMode: Int32?
-    var editModeSheetUistateDictionaryEntry: [TN_SheetUIStateDictionaryEntryArchive] = []
-    var tableEditingMode: Int32?
-    var formFocusedRecordIndex: UInt32?
-    var formFocusedFieldIndex: UInt32?
-    var inChartMode: Bool?
-    var chartSelection: TN_ChartSelectionArchive?
-    var sheetSelection: TSP_Reference?
-    var inspectorPaneVisible: Bool?
-    var inspectorPaneViewMode: Int32?
-    var selectedQuickCalcFunctions: [UInt32] = []
-    var removedAllQuickCalcFunctions: Bool?
-    var showCanvasGuides: Bool?
-    var showsComments: Bool?
-    var desktopWindowOrigin: TSP_Point?
-    var desktopWindowSize: TSP_Size?
-    var desktopScreenSize: TSP_Size?
-    var selectionPath: TSK_SelectionPathArchive?
-    var inspectorPaneAutohidden: Bool?
-    var showsSidebar: Bool?
-    var showsRulers: Bool?
-    var uuidSheetUistateDictionary: [TN_UUIDSheetUIStateDictionaryArchive] = []
-    var freehandDrawingToolkitState: TSP_Reference?
-    var selectionPathTransformer: TSP_Reference?
-    var editingDisabled: Bool?
-    var sidebarVisible: Bool?
-    var sidebarWidth: Float?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TN.UIStateArchive", [
+        .optional(1, .uint32), .repeated(2, TSP_Reference.self),
+        .repeated(3, TN_SheetUIStateDictionaryEntryArchive.self), .optional(4, TST_SelectionArchive.self),
+        .optional(5, .uint32), .optional(6, .int32), .repeated(7, TN_SheetUIStateDictionaryEntryArchive.self),
+        .optional(8, .int32), .optional(9, .uint32), .optional(10, .uint32), .optional(11, .bool),
+        .optional(12, TN_ChartSelectionArchive.self), .optional(13, TSP_Reference.self), .optional(14, .bool),
+        .optional(15, .int32), .repeated(16, .uint32), .optional(17, .bool), .optional(18, .bool), .optional(19, .bool),
+        .optional(20, TSP_Point.self), .optional(21, TSP_Size.self), .optional(22, TSP_Size.self),
+        .optional(24, TSK_SelectionPathArchive.self), .optional(25, .bool), .optional(26, .bool), .optional(27, .bool),
+        .repeated(28, TN_UUIDSheetUIStateDictionaryArchive.self), .optional(29, TSP_Reference.self),
+        .optional(30, TSP_Reference.self), .optional(31, .bool), .optional(32, .bool), .optional(33, .float),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 32)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { activeSheetIndex = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { selectedInfo.append(_v) }
-        case 3:
-            var _v: TN_SheetUIStateDictionaryEntryArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TN_SheetUIStateDictionaryEntryArchive(ProtobufMessage(_b)) }
-            if let _v { sheetUistateDictionaryEntry.append(_v) }
-        case 4:
-            var _v: TST_SelectionArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_SelectionArchive(ProtobufMessage(_b)) }
-            if let _v { tableSelection = _v }
-        case 5:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { editingSheetIndex = _v }
-        case 6:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { documentMode = _v }
-        case 7:
-            var _v: TN_SheetUIStateDictionaryEntryArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TN_SheetUIStateDictionaryEntryArchive(ProtobufMessage(_b)) }
-            if let _v { editModeSheetUistateDictionaryEntry.append(_v) }
-        case 8:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { tableEditingMode = _v }
-        case 9:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { formFocusedRecordIndex = _v }
-        case 10:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { formFocusedFieldIndex = _v }
-        case 11:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { inChartMode = _v }
-        case 12:
-            var _v: TN_ChartSelectionArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TN_ChartSelectionArchive(ProtobufMessage(_b)) }
-            if let _v { chartSelection = _v }
-        case 13:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { sheetSelection = _v }
-        case 14:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { inspectorPaneVisible = _v }
-        case 15:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { inspectorPaneViewMode = _v }
-        case 16:
-            if case .varint(let _u) = _f.value { selectedQuickCalcFunctions.append(UInt32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { selectedQuickCalcFunctions.append(UInt32(truncatingIfNeeded: _u)) } }
-        case 17:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { removedAllQuickCalcFunctions = _v }
-        case 18:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { showCanvasGuides = _v }
-        case 19:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { showsComments = _v }
-        case 20:
-            var _v: TSP_Point?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Point(ProtobufMessage(_b)) }
-            if let _v { desktopWindowOrigin = _v }
-        case 21:
-            var _v: TSP_Size?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Size(ProtobufMessage(_b)) }
-            if let _v { desktopWindowSize = _v }
-        case 22:
-            var _v: TSP_Size?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Size(ProtobufMessage(_b)) }
-            if let _v { desktopScreenSize = _v }
-        case 24:
-            var _v: TSK_SelectionPathArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_SelectionPathArchive(ProtobufMessage(_b)) }
-            if let _v { selectionPath = _v }
-        case 25:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { inspectorPaneAutohidden = _v }
-        case 26:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { showsSidebar = _v }
-        case 27:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { showsRulers = _v }
-        case 28:
-            var _v: TN_UUIDSheetUIStateDictionaryArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TN_UUIDSheetUIStateDictionaryArchive(ProtobufMessage(_b)) }
-            if let _v { uuidSheetUistateDictionary.append(_v) }
-        case 29:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { freehandDrawingToolkitState = _v }
-        case 30:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { selectionPathTransformer = _v }
-        case 31:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { editingDisabled = _v }
-        case 32:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { sidebarVisible = _v }
-        case 33:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { sidebarWidth = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = activeSheetIndex { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        for _x in selectedInfo { _w.bytesField(2, _x.encoded()) }
-        for _x in sheetUistateDictionaryEntry { _w.bytesField(3, _x.encoded()) }
-        if let _x = tableSelection { _w.bytesField(4, _x.encoded()) }
-        if let _x = editingSheetIndex { _w.varintField(5, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = documentMode { _w.varintField(6, UInt64(truncatingIfNeeded: _x)) }
-        for _x in editModeSheetUistateDictionaryEntry { _w.bytesField(7, _x.encoded()) }
-        if let _x = tableEditingMode { _w.varintField(8, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = formFocusedRecordIndex { _w.varintField(9, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = formFocusedFieldIndex { _w.varintField(10, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = inChartMode { _w.varintField(11, _x ? 1 : 0) }
-        if let _x = chartSelection { _w.bytesField(12, _x.encoded()) }
-        if let _x = sheetSelection { _w.bytesField(13, _x.encoded()) }
-        if let _x = inspectorPaneVisible { _w.varintField(14, _x ? 1 : 0) }
-        if let _x = inspectorPaneViewMode { _w.varintField(15, UInt64(truncatingIfNeeded: _x)) }
-        for _x in selectedQuickCalcFunctions { _w.varintField(16, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = removedAllQuickCalcFunctions { _w.varintField(17, _x ? 1 : 0) }
-        if let _x = showCanvasGuides { _w.varintField(18, _x ? 1 : 0) }
-        if let _x = showsComments { _w.varintField(19, _x ? 1 : 0) }
-        if let _x = desktopWindowOrigin { _w.bytesField(20, _x.encoded()) }
-        if let _x = desktopWindowSize { _w.bytesField(21, _x.encoded()) }
-        if let _x = desktopScreenSize { _w.bytesField(22, _x.encoded()) }
-        if let _x = selectionPath { _w.bytesField(24, _x.encoded()) }
-        if let _x = inspectorPaneAutohidden { _w.varintField(25, _x ? 1 : 0) }
-        if let _x = showsSidebar { _w.varintField(26, _x ? 1 : 0) }
-        if let _x = showsRulers { _w.varintField(27, _x ? 1 : 0) }
-        for _x in uuidSheetUistateDictionary { _w.bytesField(28, _x.encoded()) }
-        if let _x = freehandDrawingToolkitState { _w.bytesField(29, _x.encoded()) }
-        if let _x = selectionPathTransformer { _w.bytesField(30, _x.encoded()) }
-        if let _x = editingDisabled { _w.varintField(31, _x ? 1 : 0) }
-        if let _x = sidebarVisible { _w.varintField(32, _x ? 1 : 0) }
-        if let _x = sidebarWidth { _w.fixed32Field(33, _x.bitPattern) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var activeSheetIndex: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var selectedInfo: [TSP_Reference] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(selectedInfo value: TSP_Reference) { append(value, toMessages: 1) }
+    var sheetUistateDictionaryEntry: [TN_SheetUIStateDictionaryEntryArchive] { get { self[messages: 2] } set { self[messages: 2] = newValue } }
+    func append(sheetUistateDictionaryEntry value: TN_SheetUIStateDictionaryEntryArchive) { append(value, toMessages: 2) }
+    var tableSelection: TST_SelectionArchive? { get { self[message: 3] } set { self[message: 3] = newValue } }
+    var editingSheetIndex: UInt32? { get { self[4] } set { self[4] = newValue } }
+    var documentMode: Int32? { get { self[5] } set { self[5] = newValue } }
+    var editModeSheetUistateDictionaryEntry: [TN_SheetUIStateDictionaryEntryArchive] { get { self[messages: 6] } set { self[messages: 6] = newValue } }
+    func append(editModeSheetUistateDictionaryEntry value: TN_SheetUIStateDictionaryEntryArchive) { append(value, toMessages: 6) }
+    var tableEditingMode: Int32? { get { self[7] } set { self[7] = newValue } }
+    var formFocusedRecordIndex: UInt32? { get { self[8] } set { self[8] = newValue } }
+    var formFocusedFieldIndex: UInt32? { get { self[9] } set { self[9] = newValue } }
+    var inChartMode: Bool? { get { self[10] } set { self[10] = newValue } }
+    var chartSelection: TN_ChartSelectionArchive? { get { self[message: 11] } set { self[message: 11] = newValue } }
+    var sheetSelection: TSP_Reference? { get { self[message: 12] } set { self[message: 12] = newValue } }
+    var inspectorPaneVisible: Bool? { get { self[13] } set { self[13] = newValue } }
+    var inspectorPaneViewMode: Int32? { get { self[14] } set { self[14] = newValue } }
+    var selectedQuickCalcFunctions: [UInt32] { get { self[all: 15] } set { self[all: 15] = newValue } }
+    func append(selectedQuickCalcFunctions value: UInt32) { append(value, toAll: 15) }
+    var removedAllQuickCalcFunctions: Bool? { get { self[16] } set { self[16] = newValue } }
+    var showCanvasGuides: Bool? { get { self[17] } set { self[17] = newValue } }
+    var showsComments: Bool? { get { self[18] } set { self[18] = newValue } }
+    var desktopWindowOrigin: TSP_Point? { get { self[message: 19] } set { self[message: 19] = newValue } }
+    var desktopWindowSize: TSP_Size? { get { self[message: 20] } set { self[message: 20] = newValue } }
+    var desktopScreenSize: TSP_Size? { get { self[message: 21] } set { self[message: 21] = newValue } }
+    var selectionPath: TSK_SelectionPathArchive? { get { self[message: 22] } set { self[message: 22] = newValue } }
+    var inspectorPaneAutohidden: Bool? { get { self[23] } set { self[23] = newValue } }
+    var showsSidebar: Bool? { get { self[24] } set { self[24] = newValue } }
+    var showsRulers: Bool? { get { self[25] } set { self[25] = newValue } }
+    var uuidSheetUistateDictionary: [TN_UUIDSheetUIStateDictionaryArchive] { get { self[messages: 26] } set { self[messages: 26] = newValue } }
+    func append(uuidSheetUistateDictionary value: TN_UUIDSheetUIStateDictionaryArchive) { append(value, toMessages: 26) }
+    var freehandDrawingToolkitState: TSP_Reference? { get { self[message: 27] } set { self[message: 27] = newValue } }
+    var selectionPathTransformer: TSP_Reference? { get { self[message: 28] } set { self[message: 28] = newValue } }
+    var editingDisabled: Bool? { get { self[29] } set { self[29] = newValue } }
+    var sidebarVisible: Bool? { get { self[30] } set { self[30] = newValue } }
+    var sidebarWidth: Float? { get { self[31] } set { self[31] = newValue } }
 }
 
 /// Generated wire model for `TN.SheetSelectionArchive`.
 final class TN_SheetSelectionArchive: IWAMessage {
-    var sheet: TSP_Reference?
-    var paginated: Bool?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TN.SheetSelectionArchive", [
+        .optional(1, TSP_Reference.self), .optional(2, .bool),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { sheet = _v }
-        case 2:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { paginated = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = sheet { _w.bytesField(1, _x.encoded()) }
-        if let _x = paginated { _w.varintField(2, _x ? 1 : 0) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var sheet: TSP_Reference? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var paginated: Bool? { get { self[1] } set { self[1] = newValue } }
 }
 
 /// Generated wire model for `TN.FormSelectionArchive`.
 final class TN_FormSelectionArchive: IWAMessage {
-    var recordIndex: UInt32?
-    var fieldIndex: UInt32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TN.FormSelectionArchive", [
+        .optional(1, .uint32), .optional(2, .uint32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { recordIndex = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { fieldIndex = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = recordIndex { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = fieldIndex { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var recordIndex: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var fieldIndex: UInt32? { get { self[1] } set { self[1] = newValue } }
 }
 
 /// Generated wire model for `TN.FormBuilderSelectionArchive`.
 final class TN_FormBuilderSelectionArchive: IWAMessage {
-    var viewingRecordIndex: UInt32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TN.FormBuilderSelectionArchive", [
+        .optional(1, .uint32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { viewingRecordIndex = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = viewingRecordIndex { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var viewingRecordIndex: UInt32? { get { self[0] } set { self[0] = newValue } }
 }
 
 /// Generated wire model for `TN.FormTableChooserSelectionArchive`.
 final class TN_FormTableChooserSelectionArchive: IWAMessage {
-
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TN.FormTableChooserSelectionArchive", [])
+    var _values = [IWAValue](repeating: .absent, count: 0)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
 }
 
 /// Generated wire model for `TN.UndoRedoStateArchive`.
 final class TN_UndoRedoStateArchive: IWAMessage {
-    var uiState: TN_UIStateArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TN.UndoRedoStateArchive", [
+        .optional(1, TN_UIStateArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TN_UIStateArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TN_UIStateArchive(ProtobufMessage(_b)) }
-            if let _v { uiState = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = uiState { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var uiState: TN_UIStateArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
 }
 
 /// Generated wire model for `TN.DocumentArchive`.
 final class TN_DocumentArchive: IWAMessage {
-    var sheets: [TSP_Reference] = []
-    var `super`: TSA_DocumentArchive?
-    var calculationEngine: TSP_Reference?
-    var stylesheet: TSP_Reference?
-    var sidebarOrder: TSP_Reference?
-    var theme: TSP_Reference?
-    var uistate: TN_UIStateArchive?
-    var customFormatList: TSP_Reference?
-    var printerId: String?
-    var paperId: String?
-    var pageSize: TSP_Size?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TN.DocumentArchive", [
+        .repeated(1, TSP_Reference.self), .optional(8, TSA_DocumentArchive.self), .optional(3, TSP_Reference.self),
+        .optional(4, TSP_Reference.self), .optional(5, TSP_Reference.self), .optional(6, TSP_Reference.self),
+        .optional(7, TN_UIStateArchive.self), .optional(9, TSP_Reference.self), .optional(10, .string),
+        .optional(11, .string), .optional(12, TSP_Size.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 11)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { sheets.append(_v) }
-        case 8:
-            var _v: TSA_DocumentArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSA_DocumentArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 3:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { calculationEngine = _v }
-        case 4:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { stylesheet = _v }
-        case 5:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { sidebarOrder = _v }
-        case 6:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { theme = _v }
-        case 7:
-            var _v: TN_UIStateArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TN_UIStateArchive(ProtobufMessage(_b)) }
-            if let _v { uistate = _v }
-        case 9:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { customFormatList = _v }
-        case 10:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { printerId = _v }
-        case 11:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { paperId = _v }
-        case 12:
-            var _v: TSP_Size?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Size(ProtobufMessage(_b)) }
-            if let _v { pageSize = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in sheets { _w.bytesField(1, _x.encoded()) }
-        if let _x = `super` { _w.bytesField(8, _x.encoded()) }
-        if let _x = calculationEngine { _w.bytesField(3, _x.encoded()) }
-        if let _x = stylesheet { _w.bytesField(4, _x.encoded()) }
-        if let _x = sidebarOrder { _w.bytesField(5, _x.encoded()) }
-        if let _x = theme { _w.bytesField(6, _x.encoded()) }
-        if let _x = uistate { _w.bytesField(7, _x.encoded()) }
-        if let _x = customFormatList { _w.bytesField(9, _x.encoded()) }
-        if let _x = printerId { _w.stringField(10, _x) }
-        if let _x = paperId { _w.stringField(11, _x) }
-        if let _x = pageSize { _w.bytesField(12, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var sheets: [TSP_Reference] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(sheets value: TSP_Reference) { append(value, toMessages: 0) }
+    var `super`: TSA_DocumentArchive? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var calculationEngine: TSP_Reference? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var stylesheet: TSP_Reference? { get { self[message: 3] } set { self[message: 3] = newValue } }
+    var sidebarOrder: TSP_Reference? { get { self[message: 4] } set { self[message: 4] = newValue } }
+    var theme: TSP_Reference? { get { self[message: 5] } set { self[message: 5] = newValue } }
+    var uistate: TN_UIStateArchive? { get { self[message: 6] } set { self[message: 6] = newValue } }
+    var customFormatList: TSP_Reference? { get { self[message: 7] } set { self[message: 7] = newValue } }
+    var printerId: String? { get { self[8] } set { self[8] = newValue } }
+    var paperId: String? { get { self[9] } set { self[9] = newValue } }
+    var pageSize: TSP_Size? { get { self[message: 10] } set { self[message: 10] = newValue } }
 }
 
 /// Generated wire model for `TN.PlaceholderArchive`.
 final class TN_PlaceholderArchive: IWAMessage {
-    var `super`: TSWP_ShapeInfoArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TN.PlaceholderArchive", [
+        .optional(1, TSWP_ShapeInfoArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSWP_ShapeInfoArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_ShapeInfoArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var `super`: TSWP_ShapeInfoArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
 }
 
 /// Generated wire model for `TN.SheetArchive`.
 final class TN_SheetArchive: IWAMessage {
-    var name: String?
-    var drawableInfos: [TSP_Reference] = []
-    var inPortraitPageOrientation: Bool?
-    var showRepeatingHeaders: Bool?
-    var showPageNumbers: Bool?
-    var isAutofitOn: Bool?
-    var contentScale: Float?
-    var pageOrder: Int32?
-    var printMargins: TSD_EdgeInsetsArchive?
-    var usingStartPageNumber: Bool?
-    var startPageNumber: Int32?
-    var pageHeaderInset: Float?
-    var pageFooterInset: Float?
-    var headerStorage: TSP_Reference?
-    var footerStorage: TSP_Reference?
-    var userdefinedguidestorage: TSP_Reference?
-    var headers: [TSP_Reference] = []
-    var footers: [TSP_Reference] = []
-    var usesSingleHeaderFooter: Bool?
-    var layoutDirection: Int32?
-    var style: TSP_Reference?
-    var printBackgrounds: Bool?
-    var shouldPrintComments: Bool?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TN.SheetArchive", [
+        .optional(1, .string), .repeated(2, TSP_Reference.self), .optional(3, .bool), .optional(4, .bool),
+        .optional(5, .bool), .optional(6, .bool), .optional(7, .float), .optional(8, .int32),
+        .optional(10, TSD_EdgeInsetsArchive.self), .optional(11, .bool), .optional(12, .int32), .optional(13, .float),
+        .optional(14, .float), .optional(15, TSP_Reference.self), .optional(16, TSP_Reference.self),
+        .optional(17, TSP_Reference.self), .repeated(18, TSP_Reference.self), .repeated(19, TSP_Reference.self),
+        .optional(20, .bool), .optional(21, .int32), .optional(22, TSP_Reference.self), .optional(23, .bool),
+        .optional(24, .bool),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 23)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { name = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { drawableInfos.append(_v) }
-        case 3:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { inPortraitPageOrientation = _v }
-        case 4:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { showRepeatingHeaders = _v }
-        case 5:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { showPageNumbers = _v }
-        case 6:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { isAutofitOn = _v }
-        case 7:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { contentScale = _v }
-        case 8:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { pageOrder = _v }
-        case 10:
-            var _v: TSD_EdgeInsetsArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_EdgeInsetsArchive(ProtobufMessage(_b)) }
-            if let _v { printMargins = _v }
-        case 11:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { usingStartPageNumber = _v }
-        case 12:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { startPageNumber = _v }
-        case 13:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { pageHeaderInset = _v }
-        case 14:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { pageFooterInset = _v }
-        case 15:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { headerStorage = _v }
-        case 16:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { footerStorage = _v }
-        case 17:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { userdefinedguidestorage = _v }
-        case 18:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { headers.append(_v) }
-        case 19:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { footers.append(_v) }
-        case 20:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { usesSingleHeaderFooter = _v }
-        case 21:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { layoutDirection = _v }
-        case 22:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { style = _v }
-        case 23:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { printBackgrounds = _v }
-        case 24:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { shouldPrintComments = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = name { _w.stringField(1, _x) }
-        for _x in drawableInfos { _w.bytesField(2, _x.encoded()) }
-        if let _x = inPortraitPageOrientation { _w.varintField(3, _x ? 1 : 0) }
-        if let _x = showRepeatingHeaders { _w.varintField(4, _x ? 1 : 0) }
-        if let _x = showPageNumbers { _w.varintField(5, _x ? 1 : 0) }
-        if let _x = isAutofitOn { _w.varintField(6, _x ? 1 : 0) }
-        if let _x = contentScale { _w.fixed32Field(7, _x.bitPattern) }
-        if let _x = pageOrder { _w.varintField(8, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = printMargins { _w.bytesField(10, _x.encoded()) }
-        if let _x = usingStartPageNumber { _w.varintField(11, _x ? 1 : 0) }
-        if let _x = startPageNumber { _w.varintField(12, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = pageHeaderInset { _w.fixed32Field(13, _x.bitPattern) }
-        if let _x = pageFooterInset { _w.fixed32Field(14, _x.bitPattern) }
-        if let _x = headerStorage { _w.bytesField(15, _x.encoded()) }
-        if let _x = footerStorage { _w.bytesField(16, _x.encoded()) }
-        if let _x = userdefinedguidestorage { _w.bytesField(17, _x.encoded()) }
-        for _x in headers { _w.bytesField(18, _x.encoded()) }
-        for _x in footers { _w.bytesField(19, _x.encoded()) }
-        if let _x = usesSingleHeaderFooter { _w.varintField(20, _x ? 1 : 0) }
-        if let _x = layoutDirection { _w.varintField(21, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = style { _w.bytesField(22, _x.encoded()) }
-        if let _x = printBackgrounds { _w.varintField(23, _x ? 1 : 0) }
-        if let _x = shouldPrintComments { _w.varintField(24, _x ? 1 : 0) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var name: String? { get { self[0] } set { self[0] = newValue } }
+    var drawableInfos: [TSP_Reference] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(drawableInfos value: TSP_Reference) { append(value, toMessages: 1) }
+    var inPortraitPageOrientation: Bool? { get { self[2] } set { self[2] = newValue } }
+    var showRepeatingHeaders: Bool? { get { self[3] } set { self[3] = newValue } }
+    var showPageNumbers: Bool? { get { self[4] } set { self[4] = newValue } }
+    var isAutofitOn: Bool? { get { self[5] } set { self[5] = newValue } }
+    var contentScale: Float? { get { self[6] } set { self[6] = newValue } }
+    var pageOrder: Int32? { get { self[7] } set { self[7] = newValue } }
+    var printMargins: TSD_EdgeInsetsArchive? { get { self[message: 8] } set { self[message: 8] = newValue } }
+    var usingStartPageNumber: Bool? { get { self[9] } set { self[9] = newValue } }
+    var startPageNumber: Int32? { get { self[10] } set { self[10] = newValue } }
+    var pageHeaderInset: Float? { get { self[11] } set { self[11] = newValue } }
+    var pageFooterInset: Float? { get { self[12] } set { self[12] = newValue } }
+    var headerStorage: TSP_Reference? { get { self[message: 13] } set { self[message: 13] = newValue } }
+    var footerStorage: TSP_Reference? { get { self[message: 14] } set { self[message: 14] = newValue } }
+    var userdefinedguidestorage: TSP_Reference? { get { self[message: 15] } set { self[message: 15] = newValue } }
+    var headers: [TSP_Reference] { get { self[messages: 16] } set { self[messages: 16] = newValue } }
+    func append(headers value: TSP_Reference) { append(value, toMessages: 16) }
+    var footers: [TSP_Reference] { get { self[messages: 17] } set { self[messages: 17] = newValue } }
+    func append(footers value: TSP_Reference) { append(value, toMessages: 17) }
+    var usesSingleHeaderFooter: Bool? { get { self[18] } set { self[18] = newValue } }
+    var layoutDirection: Int32? { get { self[19] } set { self[19] = newValue } }
+    var style: TSP_Reference? { get { self[message: 20] } set { self[message: 20] = newValue } }
+    var printBackgrounds: Bool? { get { self[21] } set { self[21] = newValue } }
+    var shouldPrintComments: Bool? { get { self[22] } set { self[22] = newValue } }
 }
 
 /// Generated wire model for `TN.SheetStylePropertiesArchive`.
 final class TN_SheetStylePropertiesArchive: IWAMessage {
-    var fill: TSD_FillArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TN.SheetStylePropertiesArchive", [
+        .optional(1, TSD_FillArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSD_FillArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_FillArchive(ProtobufMessage(_b)) }
-            if let _v { fill = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = fill { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var fill: TSD_FillArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
 }
 
 /// Generated wire model for `TN.SheetStyleArchive`.
 final class TN_SheetStyleArchive: IWAMessage {
-    var `super`: TSS_StyleArchive?
-    var overrideCount: UInt32?
-    var sheetProperties: TN_SheetStylePropertiesArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TN.SheetStyleArchive", [
+        .optional(1, TSS_StyleArchive.self), .optional(2, .uint32), .optional(3, TN_SheetStylePropertiesArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSS_StyleArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSS_StyleArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { overrideCount = _v }
-        case 3:
-            var _v: TN_SheetStylePropertiesArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TN_SheetStylePropertiesArchive(ProtobufMessage(_b)) }
-            if let _v { sheetProperties = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = overrideCount { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = sheetProperties { _w.bytesField(3, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var `super`: TSS_StyleArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var overrideCount: UInt32? { get { self[1] } set { self[1] = newValue } }
+    var sheetProperties: TN_SheetStylePropertiesArchive? { get { self[message: 2] } set { self[message: 2] = newValue } }
 }
 
 /// Generated wire model for `TN.FormBasedSheetArchive`.
 final class TN_FormBasedSheetArchive: IWAMessage {
-    var `super`: TN_SheetArchive?
-    var tableId: TSP_CFUUIDArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TN.FormBasedSheetArchive", [
+        .optional(1, TN_SheetArchive.self), .optional(2, TSP_CFUUIDArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TN_SheetArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TN_SheetArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: TSP_CFUUIDArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_CFUUIDArchive(ProtobufMessage(_b)) }
-            if let _v { tableId = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = tableId { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var `super`: TN_SheetArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var tableId: TSP_CFUUIDArchive? { get { self[message: 1] } set { self[message: 1] = newValue } }
 }
 
 /// Generated wire model for `TN.ThemeArchive`.
 final class TN_ThemeArchive: IWAMessage {
-    var `super`: TSS_ThemeArchive?
-    var prototypes: [TSP_Reference] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TN.ThemeArchive", [
+        .optional(1, TSS_ThemeArchive.self), .repeated(2, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSS_ThemeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSS_ThemeArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { prototypes.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        for _x in prototypes { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var `super`: TSS_ThemeArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var prototypes: [TSP_Reference] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(prototypes value: TSP_Reference) { append(value, toMessages: 1) }
 }
 
 /// Generated wire model for `TN.PasteboardNativeStorageArchive`.
 final class TN_PasteboardNativeStorageArchive: IWAMessage {
-    var sheet: TSP_Reference?
-    var uiState: TN_SheetUIStateArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TN.PasteboardNativeStorageArchive", [
+        .optional(1, TSP_Reference.self), .optional(2, TN_SheetUIStateArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { sheet = _v }
-        case 2:
-            var _v: TN_SheetUIStateArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TN_SheetUIStateArchive(ProtobufMessage(_b)) }
-            if let _v { uiState = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = sheet { _w.bytesField(1, _x.encoded()) }
-        if let _x = uiState { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var sheet: TSP_Reference? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var uiState: TN_SheetUIStateArchive? { get { self[message: 1] } set { self[message: 1] = newValue } }
 }
 
 /// Generated wire model for `TN.ChartMediatorFormulaStorage`.
 final class TN_ChartMediatorFormulaStorage: IWAMessage {
-    var dataFormulae: [TSCE_FormulaArchive] = []
-    var rowLabelFormulae: [TSCE_FormulaArchive] = []
-    var colLabelFormulae: [TSCE_FormulaArchive] = []
-    var direction: Int32?
-    var errorCustomPosFormulae: [TSCE_FormulaArchive] = []
-    var errorCustomNegFormulae: [TSCE_FormulaArchive] = []
-    var errorCustomPosScatterXFormulae: [TSCE_FormulaArchive] = []
-    var errorCustomNegScatterXFormulae: [TSCE_FormulaArchive] = []
-    var scheme: Int32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TN.ChartMediatorFormulaStorage", [
+        .repeated(1, TSCE_FormulaArchive.self), .repeated(3, TSCE_FormulaArchive.self),
+        .repeated(4, TSCE_FormulaArchive.self), .optional(5, .int32), .repeated(6, TSCE_FormulaArchive.self),
+        .repeated(7, TSCE_FormulaArchive.self), .repeated(8, TSCE_FormulaArchive.self),
+        .repeated(9, TSCE_FormulaArchive.self), .optional(10, .int32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 9)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSCE_FormulaArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_FormulaArchive(ProtobufMessage(_b)) }
-            if let _v { dataFormulae.append(_v) }
-        case 3:
-            var _v: TSCE_FormulaArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_FormulaArchive(ProtobufMessage(_b)) }
-            if let _v { rowLabelFormulae.append(_v) }
-        case 4:
-            var _v: TSCE_FormulaArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_FormulaArchive(ProtobufMessage(_b)) }
-            if let _v { colLabelFormulae.append(_v) }
-        case 5:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { direction = _v }
-        case 6:
-            var _v: TSCE_FormulaArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_FormulaArchive(ProtobufMessage(_b)) }
-            if let _v { errorCustomPosFormulae.append(_v) }
-        case 7:
-            var _v: TSCE_FormulaArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_FormulaArchive(ProtobufMessage(_b)) }
-            if let _v { errorCustomNegFormulae.append(_v) }
-        case 8:
-            var _v: TSCE_FormulaArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_FormulaArchive(ProtobufMessage(_b)) }
-            if let _v { errorCustomPosScatterXFormulae.append(_v) }
-        case 9:
-            var _v: TSCE_FormulaArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_FormulaArchive(ProtobufMessage(_b)) }
-            if let _v { errorCustomNegScatterXFormulae.append(_v) }
-        case 10:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { scheme = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in dataFormulae { _w.bytesField(1, _x.encoded()) }
-        for _x in rowLabelFormulae { _w.bytesField(3, _x.encoded()) }
-        for _x in colLabelFormulae { _w.bytesField(4, _x.encoded()) }
-        if let _x = direction { _w.varintField(5, UInt64(truncatingIfNeeded: _x)) }
-        for _x in errorCustomPosFormulae { _w.bytesField(6, _x.encoded()) }
-        for _x in errorCustomNegFormulae { _w.bytesField(7, _x.encoded()) }
-        for _x in errorCustomPosScatterXFormulae { _w.bytesField(8, _x.encoded()) }
-        for _x in errorCustomNegScatterXFormulae { _w.bytesField(9, _x.encoded()) }
-        if let _x = scheme { _w.varintField(10, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var dataFormulae: [TSCE_FormulaArchive] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(dataFormulae value: TSCE_FormulaArchive) { append(value, toMessages: 0) }
+    var rowLabelFormulae: [TSCE_FormulaArchive] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(rowLabelFormulae value: TSCE_FormulaArchive) { append(value, toMessages: 1) }
+    var colLabelFormulae: [TSCE_FormulaArchive] { get { self[messages: 2] } set { self[messages: 2] = newValue } }
+    func append(colLabelFormulae value: TSCE_FormulaArchive) { append(value, toMessages: 2) }
+    var direction: Int32? { get { self[3] } set { self[3] = newValue } }
+    var errorCustomPosFormulae: [TSCE_FormulaArchive] { get { self[messages: 4] } set { self[messages: 4] = newValue } }
+    func append(errorCustomPosFormulae value: TSCE_FormulaArchive) { append(value, toMessages: 4) }
+    var errorCustomNegFormulae: [TSCE_FormulaArchive] { get { self[messages: 5] } set { self[messages: 5] = newValue } }
+    func append(errorCustomNegFormulae value: TSCE_FormulaArchive) { append(value, toMessages: 5) }
+    var errorCustomPosScatterXFormulae: [TSCE_FormulaArchive] { get { self[messages: 6] } set { self[messages: 6] = newValue } }
+    func append(errorCustomPosScatterXFormulae value: TSCE_FormulaArchive) { append(value, toMessages: 6) }
+    var errorCustomNegScatterXFormulae: [TSCE_FormulaArchive] { get { self[messages: 7] } set { self[messages: 7] = newValue } }
+    func append(errorCustomNegScatterXFormulae value: TSCE_FormulaArchive) { append(value, toMessages: 7) }
+    var scheme: Int32? { get { self[8] } set { self[8] = newValue } }
 }
 
 /// Generated wire model for `TN.ChartMediatorArchive`.
 final class TN_ChartMediatorArchive: IWAMessage {
-    var entityId: String?
-    var formulas: TN_ChartMediatorFormulaStorage?
-    var columnsAreSeries: Bool?
-    var isRegisteredWithCalcEngine: Bool?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TN.ChartMediatorArchive", [
+        .optional(2, .string), .optional(3, TN_ChartMediatorFormulaStorage.self), .optional(4, .bool),
+        .optional(5, .bool),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 2:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { entityId = _v }
-        case 3:
-            var _v: TN_ChartMediatorFormulaStorage?
-            if case .lengthDelimited(let _b) = _f.value { _v = TN_ChartMediatorFormulaStorage(ProtobufMessage(_b)) }
-            if let _v { formulas = _v }
-        case 4:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { columnsAreSeries = _v }
-        case 5:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { isRegisteredWithCalcEngine = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = entityId { _w.stringField(2, _x) }
-        if let _x = formulas { _w.bytesField(3, _x.encoded()) }
-        if let _x = columnsAreSeries { _w.varintField(4, _x ? 1 : 0) }
-        if let _x = isRegisteredWithCalcEngine { _w.varintField(5, _x ? 1 : 0) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var entityId: String? { get { self[0] } set { self[0] = newValue } }
+    var formulas: TN_ChartMediatorFormulaStorage? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var columnsAreSeries: Bool? { get { self[2] } set { self[2] = newValue } }
+    var isRegisteredWithCalcEngine: Bool? { get { self[3] } set { self[3] = newValue } }
 }
 
 /// Generated wire model for `TN.ChartSelectionArchive`.
 final class TN_ChartSelectionArchive: IWAMessage {
-    var reference: TSCE_RangeReferenceArchive?
-    var chart: TSP_Reference?
-    var `super`: TSD_DrawableSelectionArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TN.ChartSelectionArchive", [
+        .optional(1, TSCE_RangeReferenceArchive.self), .optional(3, TSP_Reference.self),
+        .optional(4, TSD_DrawableSelectionArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSCE_RangeReferenceArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_RangeReferenceArchive(ProtobufMessage(_b)) }
-            if let _v { reference = _v }
-        case 3:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { chart = _v }
-        case 4:
-            var _v: TSD_DrawableSelectionArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_DrawableSelectionArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = reference { _w.bytesField(1, _x.encoded()) }
-        if let _x = chart { _w.bytesField(3, _x.encoded()) }
-        if let _x = `super` { _w.bytesField(4, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var reference: TSCE_RangeReferenceArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var chart: TSP_Reference? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var `super`: TSD_DrawableSelectionArchive? { get { self[message: 2] } set { self[message: 2] = newValue } }
 }
 
 /// Generated wire model for `TN.FormCommandActivityBehaviorArchive`.
 final class TN_FormCommandActivityBehaviorArchive: IWAMessage {
-    var `super`: TSCK_CommandActivityBehaviorArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TN.FormCommandActivityBehaviorArchive", [
+        .optional(1, TSCK_CommandActivityBehaviorArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSCK_CommandActivityBehaviorArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCK_CommandActivityBehaviorArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var `super`: TSCK_CommandActivityBehaviorArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
 }
 
 /// Registers this file's archives into the reflective catalog.
-func registerIWA_TNArchives(_ into: inout [(name: String, decode: (ProtobufMessage) -> IWAMessage)]) {
-    into.append(("TN.SheetUIStateArchive", { TN_SheetUIStateArchive($0) as IWAMessage }))
-    into.append(("TN.SheetUIStateDictionaryEntryArchive", { TN_SheetUIStateDictionaryEntryArchive($0) as IWAMessage }))
-    into.append(("TN.UUIDSheetUIStateDictionaryArchive", { TN_UUIDSheetUIStateDictionaryArchive($0) as IWAMessage }))
-    into.append(("TN.UIStateArchive", { TN_UIStateArchive($0) as IWAMessage }))
-    into.append(("TN.SheetSelectionArchive", { TN_SheetSelectionArchive($0) as IWAMessage }))
-    into.append(("TN.FormSelectionArchive", { TN_FormSelectionArchive($0) as IWAMessage }))
-    into.append(("TN.FormBuilderSelectionArchive", { TN_FormBuilderSelectionArchive($0) as IWAMessage }))
-    into.append(("TN.FormTableChooserSelectionArchive", { TN_FormTableChooserSelectionArchive($0) as IWAMessage }))
-    into.append(("TN.UndoRedoStateArchive", { TN_UndoRedoStateArchive($0) as IWAMessage }))
-    into.append(("TN.DocumentArchive", { TN_DocumentArchive($0) as IWAMessage }))
-    into.append(("TN.PlaceholderArchive", { TN_PlaceholderArchive($0) as IWAMessage }))
-    into.append(("TN.SheetArchive", { TN_SheetArchive($0) as IWAMessage }))
-    into.append(("TN.SheetStylePropertiesArchive", { TN_SheetStylePropertiesArchive($0) as IWAMessage }))
-    into.append(("TN.SheetStyleArchive", { TN_SheetStyleArchive($0) as IWAMessage }))
-    into.append(("TN.FormBasedSheetArchive", { TN_FormBasedSheetArchive($0) as IWAMessage }))
-    into.append(("TN.ThemeArchive", { TN_ThemeArchive($0) as IWAMessage }))
-    into.append(("TN.PasteboardNativeStorageArchive", { TN_PasteboardNativeStorageArchive($0) as IWAMessage }))
-    into.append(("TN.ChartMediatorFormulaStorage", { TN_ChartMediatorFormulaStorage($0) as IWAMessage }))
-    into.append(("TN.ChartMediatorArchive", { TN_ChartMediatorArchive($0) as IWAMessage }))
-    into.append(("TN.ChartSelectionArchive", { TN_ChartSelectionArchive($0) as IWAMessage }))
-    into.append(("TN.FormCommandActivityBehaviorArchive", { TN_FormCommandActivityBehaviorArchive($0) as IWAMessage }))
+func registerIWA_TNArchives(_ into: inout [any IWAMessage.Type]) {
+    into += [
+        TN_SheetUIStateArchive.self, TN_SheetUIStateDictionaryEntryArchive.self,
+        TN_UUIDSheetUIStateDictionaryArchive.self, TN_UIStateArchive.self, TN_SheetSelectionArchive.self,
+        TN_FormSelectionArchive.self, TN_FormBuilderSelectionArchive.self, TN_FormTableChooserSelectionArchive.self,
+        TN_UndoRedoStateArchive.self, TN_DocumentArchive.self, TN_PlaceholderArchive.self, TN_SheetArchive.self,
+        TN_SheetStylePropertiesArchive.self, TN_SheetStyleArchive.self, TN_FormBasedSheetArchive.self,
+        TN_ThemeArchive.self, TN_PasteboardNativeStorageArchive.self, TN_ChartMediatorFormulaStorage.self,
+        TN_ChartMediatorArchive.self, TN_ChartSelectionArchive.self, TN_FormCommandActivityBehaviorArchive.self,
+    ]
 }
@@ -5,2576 +5,865 @@ import SwiftTextIWA
 
 /// Generated wire model for `TP.DocumentArchive`.
 final class TP_DocumentArchive: IWAMessage {
-    var `super`: TSA_DocumentArchive?
-    var stylesheet: TSP_Reference?
-    var floatingDrawables: TSP_Reference?
-    var bodyStorage: TSP_Reference?
-    var section: TSP_Reference?
-    var theme: TSP_Reference?
-    var settings: TSP_Reference?
-    var deprecatedLayoutState: TSP_Reference?
-    var deprecatedViewState: TSP_Reference?
-    var citationRecords: [TSP_Reference] = []
-    var tocStyles: [TSP_Reference] = []
-    var changeSessions: [TSP_Reference] = []
-    var mostRecentChangeSession: TSP_Reference?
-    var drawablesZorder: TSP_Reference?
-    var usesSingleHeaderFooter: Bool?
-    var pageWidth: Float?
-    var pageHeight: Float?
-    var leftMargin: Float?
-    var rightMargin: Float?
-    var topMargin: Float?
-    var bottomMargin: Float?
-    var headerMargin: Float?
-    var footerMargin: Float?
-    var pageScale: Float?
-    var laysOutBodyVertically: Bool?
-    var changeTrackingEnabled: Bool?
-    var tablesCustomFormatList: TSP_Reference?
-    var orientation: UInt32?
-    var printerId: String?
-    var paperId: String?
-    var equationEnvironment: TSP_DataReference?
-    var showInBookmarksListParagraphStylesPropertyInitialized: Bool?
-    var flowInfoContainer: TSP_Reference?
-    var pageTemplates: [TSP_Reference] = []
-    var shouldUseAnchoredDrawableWrapSlop: Bool?
-    var mergeData: TSP_Reference?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 15:
-            var _v: TSA_DocumentArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSA_DocumentArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { stylesheet = _v }
-        case 3:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { floatingDrawables = _v }
-        case 4:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { bodyStorage = _v }
-        case 5:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { section = _v }
-        case 6:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { theme = _v }
-        case 7:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { settings = _v }
-        case 11:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { deprecatedLayoutState = _v }
-        case 12:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { deprecatedViewState = _v }
-        case 13:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { citationRecords.append(_v) }
-        case 14:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { tocStyles.append(_v) }
-        case 16:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { changeSessions.append(_v) }
-        case 17:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { mostRecentChangeSession = _v }
-        case 20:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { drawablesZorder = _v }
-        case 21:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { usesSingleHeaderFooter = _v }
-        case 30:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { pageWidth = _v }
-        case 31:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { pageHeight = _v }
-        case 32:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { leftMargin = _v }
-        case 33:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { rightMargin = _v }
-        case 34:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { topMargin = _v }
-        case 35:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { bottomMargin = _v }
-        case 36:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { headerMargin = _v }
-        case 37:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { footerMargin = _v }
-        case 38:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { pageScale = _v }
-        case 39:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { laysOutBodyVertically = _v }
-        case 40:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { changeTrackingEnabled = _v }
-        case 41:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { tablesCustomFormatList = _v }
-        case 42:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { orientation = _v }
-        case 43:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { printerId = _v }
-        case 44:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { paperId = _v }
-        case 45:
-            var _v: TSP_DataReference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_DataReference(ProtobufMessage(_b)) }
-            if let _v { equationEnvironment = _v }
-        case 46:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { showInBookmarksListParagraphStylesPropertyInitialized = _v }
-        case 47:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { flowInfoContainer = _v }
-        case 48:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { pageTemplates.append(_v) }
-        case 49:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { shouldUseAnchoredDrawableWrapSlop = _v }
-        case 50:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { mergeData = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(15, _x.encoded()) }
-        if let _x = stylesheet { _w.bytesField(2, _x.encoded()) }
-        if let _x = floatingDrawables { _w.bytesField(3, _x.encoded()) }
-        if let _x = bodyStorage { _w.bytesField(4, _x.encoded()) }
-        if let _x = section { _w.bytesField(5, _x.encoded()) }
-        if let _x = theme { _w.bytesField(6, _x.encoded()) }
-        if let _x = settings { _w.bytesField(7, _x.encoded()) }
-        if let _x = deprecatedLayoutState { _w.bytesField(11, _x.encoded()) }
-        if let _x = deprecatedViewState { _w.bytesField(12, _x.encoded()) }
-        for _x in citationRecords { _w.bytesField(13, _x.encoded()) }
-        for _x in tocStyles { _w.bytesField(14, _x.encoded()) }
-        for _x in changeSessions { _w.bytesField(16, _x.encoded()) }
-        if let _x = mostRecentChangeSession { _w.bytesField(17, _x.encoded()) }
-        if let _x = drawablesZorder { _w.bytesField(20, _x.encoded()) }
-        if let _x = usesSingleHeaderFooter { _w.varintField(21, _x ? 1 : 0) }
-        if let _x = pageWidth { _w.fixed32Field(30, _x.bitPattern) }
-        if let _x = pageHeight { _w.fixed32Field(31, _x.bitPattern) }
-        if let _x = leftMargin { _w.fixed32Field(32, _x.bitPattern) }
-        if let _x = rightMargin { _w.fixed32Field(33, _x.bitPattern) }
-        if let _x = topMargin { _w.fixed32Field(34, _x.bitPattern) }
-        if let _x = bottomMargin { _w.fixed32Field(35, _x.bitPattern) }
-        if let _x = headerMargin { _w.fixed32Field(36, _x.bitPattern) }
-        if let _x = footerMargin { _w.fixed32Field(37, _x.bitPattern) }
-        if let _x = pageScale { _w.fixed32Field(38, _x.bitPattern) }
-        if let _x = laysOutBodyVertically { _w.varintField(39, _x ? 1 : 0) }
-        if let _x = changeTrackingEnabled { _w.varintField(40, _x ? 1 : 0) }
-        if let _x = tablesCustomFormatList { _w.bytesField(41, _x.encoded()) }
-        if let _x = orientation { _w.varintField(42, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = printerId { _w.stringField(43, _x) }
-        if let _x = paperId { _w.stringField(44, _x) }
-        if let _x = equationEnvironment { _w.bytesField(45, _x.encoded()) }
-        if let _x = showInBookmarksListParagraphStylesPropertyInitialized { _w.varintField(46, _x ? 1 : 0) }
-        if let _x = flowInfoContainer { _w.bytesField(47, _x.encoded()) }
-        for _x in pageTemplates { _w.bytesField(48, _x.encoded()) }
-        if let _x = shouldUseAnchoredDrawableWrapSlop { _w.varintField(49, _x ? 1 : 0) }
-        if let _x = mergeData { _w.bytesField(50, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TP.DocumentArchive", [
+        .optional(15, TSA_DocumentArchive.self), .optional(2, TSP_Reference.self), .optional(3, TSP_Reference.self),
+        .optional(4, TSP_Reference.self), .optional(5, TSP_Reference.self), .optional(6, TSP_Reference.self),
+        .optional(7, TSP_Reference.self), .optional(11, TSP_Reference.self), .optional(12, TSP_Reference.self),
+        .repeated(13, TSP_Reference.self), .repeated(14, TSP_Reference.self), .repeated(16, TSP_Reference.self),
+        .optional(17, TSP_Reference.self), .optional(20, TSP_Reference.self), .optional(21, .bool),
+        .optional(30, .float), .optional(31, .float), .optional(32, .float), .optional(33, .float),
+        .optional(34, .float), .optional(35, .float), .optional(36, .float), .optional(37, .float),
+        .optional(38, .float), .optional(39, .bool), .optional(40, .bool), .optional(41, TSP_Reference.self),
+        .optional(42, .uint32), .optional(43, .string), .optional(44, .string), .optional(45, TSP_DataReference.self),
+        .optional(46, .bool), .optional(47, TSP_Reference.self), .repeated(48, TSP_Reference.self),
+        .optional(49, .bool), .optional(50, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 36)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var `super`: TSA_DocumentArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var stylesheet: TSP_Reference? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var floatingDrawables: TSP_Reference? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var bodyStorage: TSP_Reference? { get { self[message: 3] } set { self[message: 3] = newValue } }
+    var section: TSP_Reference? { get { self[message: 4] } set { self[message: 4] = newValue } }
+    var theme: TSP_Reference? { get { self[message: 5] } set { self[message: 5] = newValue } }
+    var settings: TSP_Reference? { get { self[message: 6] } set { self[message: 6] = newValue } }
+    var deprecatedLayoutState: TSP_Reference? { get { self[message: 7] } set { self[message: 7] = newValue } }
+    var deprecatedViewState: TSP_Reference? { get { self[message: 8] } set { self[message: 8] = newValue } }
+    var citationRecords: [TSP_Reference] { get { self[messages: 9] } set { self[messages: 9] = newValue } }
+    func append(citationRecords value: TSP_Reference) { append(value, toMessages: 9) }
+    var tocStyles: [TSP_Reference] { get { self[messages: 10] } set { self[messages: 10] = newValue } }
+    func append(tocStyles value: TSP_Reference) { append(value, toMessages: 10) }
+    var changeSessions: [TSP_Reference] { get { self[messages: 11] } set { self[messages: 11] = newValue } }
+    func append(changeSessions value: TSP_Reference) { append(value, toMessages: 11) }
+    var mostRecentChangeSession: TSP_Reference? { get { self[message: 12] } set { self[message: 12] = newValue } }
+    var drawablesZorder: TSP_Reference? { get { self[message: 13] } set { self[message: 13] = newValue } }
+    var usesSingleHeaderFooter: Bool? { get { self[14] } set { self[14] = newValue } }
+    var pageWidth: Float? { get { self[15] } set { self[15] = newValue } }
+    var pageHeight: Float? { get { self[16] } set { self[16] = newValue } }
+    var leftMargin: Float? { get { self[17] } set { self[17] = newValue } }
+    var rightMargin: Float? { get { self[18] } set { self[18] = newValue } }
+    var topMargin: Float? { get { self[19] } set { self[19] = newValue } }
+    var bottomMargin: Float? { get { self[20] } set { self[20] = newValue } }
+    var headerMargin: Float? { get { self[21] } set { self[21] = newValue } }
+    var footerMargin: Float? { get { self[22] } set { self[22] = newValue } }
+    var pageScale: Float? { get { self[23] } set { self[23] = newValue } }
+    var laysOutBodyVertically: Bool? { get { self[24] } set { self[24] = newValue } }
+    var changeTrackingEnabled: Bool? { get { self[25] } set { self[25] = newValue } }
+    var tablesCustomFormatList: TSP_Reference? { get { self[message: 26] } set { self[message: 26] = newValue } }
+    var orientation: UInt32? { get { self[27] } set { self[27] = newValue } }
+    var printerId: String? { get { self[28] } set { self[28] = newValue } }
+    var paperId: String? { get { self[29] } set { self[29] = newValue } }
+    var equationEnvironment: TSP_DataReference? { get { self[message: 30] } set { self[message: 30] = newValue } }
+    var showInBookmarksListParagraphStylesPropertyInitialized: Bool? { get { self[31] } set { self[31] = newValue } }
+    var flowInfoContainer: TSP_Reference? { get { self[message: 32] } set { self[message: 32] = newValue } }
+    var pageTemplates: [TSP_Reference] { get { self[messages: 33] } set { self[messages: 33] = newValue } }
+    func append(pageTemplates value: TSP_Reference) { append(value, toMessages: 33) }
+    var shouldUseAnchoredDrawableWrapSlop: Bool? { get { self[34] } set { self[34] = newValue } }
+    var mergeData: TSP_Reference? { get { self[message: 35] } set { self[message: 35] = newValue } }
 }
 
 /// Generated wire model for `TP.ThemeArchive`.
 final class TP_ThemeArchive: IWAMessage {
-    var `super`: TSS_ThemeArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TP.ThemeArchive", [
+        .optional(1, TSS_ThemeArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSS_ThemeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSS_ThemeArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var `super`: TSS_ThemeArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
 }
 
 /// Generated wire model for `TP.SettingsArchive`.
 final class TP_SettingsArchive: IWAMessage {
-    var body: Bool?
-    var headers: Bool?
-    var footers: Bool?
-    var preview: Bool?
-    var copyMovies: Bool?
-    var copyAssets: Bool?
-    var placeholderAuthoring: Bool?
-    var linksEnabled: Bool?
-    var hyphenation: Bool?
-    var useLigatures: Bool?
-    var tocLinksEnabled: Bool?
-    var showCtMarkup: Bool?
-    var showCtDeletions: Bool?
-    var ctBubblesVisibility: Int32?
-    var changeBarsVisible: Bool?
-    var formatChangesVisible: Bool?
-    var annotationsVisible: Bool?
-    var documentIsRtl: Bool?
-    var decimalTab: String?
-    var language: String?
-    var hyphenationLanguage: String?
-    var creationLocale: String?
-    var lastLocale: String?
-    var origTemplate: String?
-    var creationDate: String?
-    var bibliographyFormat: String?
-    var footnoteKind: Int32?
-    var footnoteFormat: Int32?
-    var footnoteNumbering: Int32?
-    var footnoteGap: Int32?
-    var facingPages: Bool?
-    var sectionAuthoring: Bool?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { body = _v }
-        case 2:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { headers = _v }
-        case 3:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { footers = _v }
-        case 4:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { preview = _v }
-        case 5:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { copyMovies = _v }
-        case 6:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { copyAssets = _v }
-        case 7:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { placeholderAuthoring = _v }
-        case 8:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { linksEnabled = _v }
-        case 9:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { hyphenation = _v }
-        case 10:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { useLigatures = _v }
-        case 11:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { tocLinksEnabled = _v }
-        case 12:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { showCtMarkup = _v }
-        case 13:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { showCtDeletions = _v }
-        case 14:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { ctBubblesVisibility = _v }
-        case 15:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { changeBarsVisible = _v }
-        case 16:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { formatChangesVisible = _v }
-        case 17:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { annotationsVisible = _v }
-        case 18:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { documentIsRtl = _v }
-        case 20:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { decimalTab = _v }
-        case 21:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { language = _v }
-        case 22:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { hyphenationLanguage = _v }
-        case 23:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { creationLocale = _v }
-        case 24:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { lastLocale = _v }
-        case 25:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { origTemplate = _v }
-        case 26:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { creationDate = _v }
-        case 27:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { bibliographyFormat = _v }
-        case 30:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { footnoteKind = _v }
-        case 31:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { footnoteFormat = _v }
-        case 32:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { footnoteNumbering = _v }
-        case 33:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { footnoteGap = _v }
-        case 34:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { facingPages = _v }
-        case 40:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { sectionAuthoring = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = body { _w.varintField(1, _x ? 1 : 0) }
-        if let _x = headers { _w.varintField(2, _x ? 1 : 0) }
-        if let _x = footers { _w.varintField(3, _x ? 1 : 0) }
-        if let _x = preview { _w.varintField(4, _x ? 1 : 0) }
-        if let _x = copyMovies { _w.varintField(5, _x ? 1 : 0) }
-        if let _x = copyAssets { _w.varintField(6, _x ? 1 : 0) }
-        if let _x = placeholderAuthoring { _w.varintField(7, _x ? 1 : 0) }
-        if let _x = linksEnabled { _w.varintField(8, _x ? 1 : 0) }
-        if let _x = hyphenation { _w.varintField(9, _x ? 1 : 0) }
-        if let _x = useLigatures { _w.varintField(10, _x ? 1 : 0) }
-        if let _x = tocLinksEnabled { _w.varintField(11, _x ? 1 : 0) }
-        if let _x = showCtMarkup { _w.varintField(12, _x ? 1 : 0) }
-        if let _x = showCtDeletions { _w.varintField(13, _x ? 1 : 0) }
-        if let _x = ctBubblesVisibility { _w.varintField(14, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = changeBarsVisible { _w.varintField(15, _x ? 1 : 0) }
-        if let _x = formatChangesVisible { _w.varintField(16, _x ? 1 : 0) }
-        if let _x = annotationsVisible { _w.varintField(17, _x ? 1 : 0) }
-        if let _x = documentIsRtl { _w.varintField(18, _x ? 1 : 0) }
-        if let _x = decimalTab { _w.stringField(20, _x) }
-        if let _x = language { _w.stringField(21, _x) }
-        if let _x = hyphenationLanguage { _w.stringField(22, _x) }
-        if let _x = creationLocale { _w.stringField(23, _x) }
-        if let _x = lastLocale { _w.stringField(24, _x) }
-        if let _x = origTemplate { _w.stringField(25, _x) }
-        if let _x = creationDate { _w.stringField(26, _x) }
-        if let _x = bibliographyFormat { _w.stringField(27, _x) }
-        if let _x = footnoteKind { _w.varintField(30, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = footnoteFormat { _w.varintField(31, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = footnoteNumbering { _w.varintField(32, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = footnoteGap { _w.varintField(33, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = facingPages { _w.varintField(34, _x ? 1 : 0) }
-        if let _x = sectionAuthoring { _w.varintField(40, _x ? 1 : 0) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TP.SettingsArchive", [
+        .optional(1, .bool), .optional(2, .bool), .optional(3, .bool), .optional(4, .bool), .optional(5, .bool),
+        .optional(6, .bool), .optional(7, .bool), .optional(8, .bool), .optional(9, .bool), .optional(10, .bool),
+        .optional(11, .bool), .optional(12, .bool), .optional(13, .bool), .optional(14, .int32), .optional(15, .bool),
+        .optional(16, .bool), .optional(17, .bool), .optional(18, .bool), .optional(20, .string),
+        .optional(21, .string), .optional(22, .string), .optional(23, .string), .optional(24, .string),
+        .optional(25, .string), .optional(26, .string), .optional(27, .string), .optional(30, .int32),
+        .optional(31, .int32), .optional(32, .int32), .optional(33, .int32), .optional(34, .bool), .optional(40, .bool),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 32)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var body: Bool? { get { self[0] } set { self[0] = newValue } }
+    var headers: Bool? { get { self[1] } set { self[1] = newValue } }
+    var footers: Bool? { get { self[2] } set { self[2] = newValue } }
+    var preview: Bool? { get { self[3] } set { self[3] = newValue } }
+    var copyMovies: Bool? { get { self[4] } set { self[4] = newValue } }
+    var copyAssets: Bool? { get { self[5] } set { self[5] = newValue } }
+    var placeholderAuthoring: Bool? { get { self[6] } set { self[6] = newValue } }
+    var linksEnabled: Bool? { get { self[7] } set { self[7] = newValue } }
+    var hyphenation: Bool? { get { self[8] } set { self[8] = newValue } }
+    var useLigatures: Bool? { get { self[9] } set { self[9] = newValue } }
+    var tocLinksEnabled: Bool? { get { self[10] } set { self[10] = newValue } }
+    var showCtMarkup: Bool? { get { self[11] } set { self[11] = newValue } }
+    var showCtDeletions: Bool? { get { self[12] } set { self[12] = newValue } }
+    var ctBubblesVisibility: Int32? { get { self[13] } set { self[13] = newValue } }
+    var changeBarsVisible: Bool? { get { self[14] } set { self[14] = newValue } }
+    var formatChangesVisible: Bool? { get { self[15] } set { self[15] = newValue } }
+    var annotationsVisible: Bool? { get { self[16] } set { self[16] = newValue } }
+    var documentIsRtl: Bool? { get { self[17] } set { self[17] = newValue } }
+    var decimalTab: String? { get { self[18] } set { self[18] = newValue } }
+    var language: String? { get { self[19] } set { self[19] = newValue } }
+    var hyphenationLanguage: String? { get { self[20] } set { self[20] = newValue } }
+    var creationLocale: String? { get { self[21] } set { self[21] = newValue } }
+    var lastLocale: String? { get { self[22] } set { self[22] = newValue } }
+    var origTemplate: String? { get { self[23] } set { self[23] = newValue } }
+    var creationDate: String? { get { self[24] } set { self[24] = newValue } }
+    var bibliographyFormat: String? { get { self[25] } set { self[25] = newValue } }
+    var footnoteKind: Int32? { get { self[26] } set { self[26] = newValue } }
+    var footnoteFormat: Int32? { get { self[27] } set { self[27] = newValue } }
+    var footnoteNumbering: Int32? { get { self[28] } set { self[28] = newValue } }
+    var footnoteGap: Int32? { get { self[29] } set { self[29] = newValue } }
+    var facingPages: Bool? { get { self[30] } set { self[30] = newValue } }
+    var sectionAuthoring: Bool? { get { self[31] } set { self[31] = newValue } }
 }
 
 /// Generated wire model for `TP.PlaceholderArchive`.
 final class TP_PlaceholderArchive: IWAMessage {
-    var `super`: TSWP_ShapeInfoArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TP.PlaceholderArchive", [
+        .optional(1, TSWP_ShapeInfoArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSWP_ShapeInfoArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_ShapeInfoArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var `super`: TSWP_ShapeInfoArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
 }
 
 /// Generated wire model for `TP.DrawableTagPairsArchive`.
 final class TP_DrawableTagPairsArchive: IWAMessage {
-    var drawableTagPairs: [TP_DrawableTagPairsArchive_DrawableTagPair] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TP.DrawableTagPairsArchive", [
+        .repeated(1, TP_DrawableTagPairsArchive_DrawableTagPair.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TP_DrawableTagPairsArchive_DrawableTagPair?
-            if case .lengthDelimited(let _b) = _f.value { _v = TP_DrawableTagPairsArchive_DrawableTagPair(ProtobufMessage(_b)) }
-            if let _v { drawableTagPairs.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in drawableTagPairs { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var drawableTagPairs: [TP_DrawableTagPairsArchive_DrawableTagPair] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(drawableTagPairs value: TP_DrawableTagPairsArchive_DrawableTagPair) { append(value, toMessages: 0) }
 }
 
 /// Generated wire model for `TP.DrawableTagPairsArchive.DrawableTagPair`.
 final class TP_DrawableTagPairsArchive_DrawableTagPair: IWAMessage {
-    var tag: String?
-    var drawable: TSP_Reference?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TP.DrawableTagPairsArchive.DrawableTagPair", [
+        .optional(1, .string), .optional(2, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { tag = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { drawable = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = tag { _w.stringField(1, _x) }
-        if let _x = drawable { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var tag: String? { get { self[0] } set { self[0] = newValue } }
+    var drawable: TSP_Reference? { get { self[message: 1] } set { self[message: 1] = newValue } }
 }
 
 /// Generated wire model for `TP.FloatingDrawablesArchive`.
 final class TP_FloatingDrawablesArchive: IWAMessage {
-    var pageGroups: [TP_FloatingDrawablesArchive_PageGroup] = []
-    var drawableTagPairs: TP_DrawableTagPairsArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TP.FloatingDrawablesArchive", [
+        .repeated(1, TP_FloatingDrawablesArchive_PageGroup.self), .optional(2, TP_DrawableTagPairsArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TP_FloatingDrawablesArchive_PageGroup?
-            if case .lengthDelimited(let _b) = _f.value { _v = TP_FloatingDrawablesArchive_PageGroup(ProtobufMessage(_b)) }
-            if let _v { pageGroups.append(_v) }
-        case 2:
-            var _v: TP_DrawableTagPairsArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TP_DrawableTagPairsArchive(ProtobufMessage(_b)) }
-            if let _v { drawableTagPairs = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in pageGroups { _w.bytesField(1, _x.encoded()) }
-        if let _x = drawableTagPairs { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var pageGroups: [TP_FloatingDrawablesArchive_PageGroup] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(pageGroups value: TP_FloatingDrawablesArchive_PageGroup) { append(value, toMessages: 0) }
+    var drawableTagPairs: TP_DrawableTagPairsArchive? { get { self[message: 1] } set { self[message: 1] = newValue } }
 }
 
 /// Generated wire model for `TP.FloatingDrawablesArchive.DrawableEntry`.
 final class TP_FloatingDrawablesArchive_DrawableEntry: IWAMessage {
-    var drawable: TSP_Reference?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TP.FloatingDrawablesArchive.DrawableEntry", [
+        .optional(1, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { drawable = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = drawable { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var drawable: TSP_Reference? { get { self[message: 0] } set { self[message: 0] = newValue } }
 }
 
 /// Generated wire model for `TP.FloatingDrawablesArchive.PageGroup`.
 final class TP_FloatingDrawablesArchive_PageGroup: IWAMessage {
-    var pageIndex: UInt32?
-    var backgroundDrawables: [TP_FloatingDrawablesArchive_DrawableEntry] = []
-    var foregroundDrawables: [TP_FloatingDrawablesArchive_DrawableEntry] = []
-    var drawables: [TP_FloatingDrawablesArchive_DrawableEntry] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TP.FloatingDrawablesArchive.PageGroup", [
+        .optional(1, .uint32), .repeated(2, TP_FloatingDrawablesArchive_DrawableEntry.self),
+        .repeated(3, TP_FloatingDrawablesArchive_DrawableEntry.self),
+        .repeated(4, TP_FloatingDrawablesArchive_DrawableEntry.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { pageIndex = _v }
-        case 2:
-            var _v: TP_FloatingDrawablesArchive_DrawableEntry?
-            if case .lengthDelimited(let _b) = _f.value { _v = TP_FloatingDrawablesArchive_DrawableEntry(ProtobufMessage(_b)) }
-            if let _v { backgroundDrawables.append(_v) }
-        case 3:
-            var _v: TP_FloatingDrawablesArchive_DrawableEntry?
-            if case .lengthDelimited(let _b) = _f.value { _v = TP_FloatingDrawablesArchive_DrawableEntry(ProtobufMessage(_b)) }
-            if let _v { foregroundDrawables.append(_v) }
-        case 4:
-            var _v: TP_FloatingDrawablesArchive_DrawableEntry?
-            if case .lengthDelimited(let _b) = _f.value { _v = TP_FloatingDrawablesArchive_DrawableEntry(ProtobufMessage(_b)) }
-            if let _v { drawables.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = pageIndex { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        for _x in backgroundDrawables { _w.bytesField(2, _x.encoded()) }
-        for _x in foregroundDrawables { _w.bytesField(3, _x.encoded()) }
-        for _x in drawables { _w.bytesField(4, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var pageIndex: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var backgroundDrawables: [TP_FloatingDrawablesArchive_DrawableEntry] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(backgroundDrawables value: TP_FloatingDrawablesArchive_DrawableEntry) { append(value, toMessages: 1) }
+    var foregroundDrawables: [TP_FloatingDrawablesArchive_DrawableEntry] { get { self[messages: 2] } set { self[messages: 2] = newValue } }
+    func append(foregroundDrawables value: TP_FloatingDrawablesArchive_DrawableEntry) { append(value, toMessages: 2) }
+    var drawables: [TP_FloatingDrawablesArchive_DrawableEntry] { get { self[messages: 3] } set { self[messages: 3] = newValue } }
+    func append(drawables value: TP_FloatingDrawablesArchive_DrawableEntry) { append(value, toMessages: 3) }
 }
 
 /// Generated wire model for `TP.DrawablesZOrderArchive`.
 final class TP_DrawablesZOrderArchive: IWAMessage {
-    var drawables: [TSP_Reference] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TP.DrawablesZOrderArchive", [
+        .repeated(1, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { drawables.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in drawables { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var drawables: [TSP_Reference] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(drawables value: TSP_Reference) { append(value, toMessages: 0) }
 }
 
 /// Generated wire model for `TP.SectionTemplateArchive`.
 final class TP_SectionTemplateArchive: IWAMessage {
-    var headers: [TSP_Reference] = []
-    var footers: [TSP_Reference] = []
-    var sectionTemplateDrawables: [TSP_Reference] = []
-    var pageTemplateUuidpath: TSP_UUIDPath?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TP.SectionTemplateArchive", [
+        .repeated(1, TSP_Reference.self), .repeated(2, TSP_Reference.self), .repeated(3, TSP_Reference.self),
+        .optional(4, TSP_UUIDPath.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { headers.append(_v) }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { footers.append(_v) }
-        case 3:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { sectionTemplateDrawables.append(_v) }
-        case 4:
-            var _v: TSP_UUIDPath?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUIDPath(ProtobufMessage(_b)) }
-            if let _v { pageTemplateUuidpath = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in headers { _w.bytesField(1, _x.encoded()) }
-        for _x in footers { _w.bytesField(2, _x.encoded()) }
-        for _x in sectionTemplateDrawables { _w.bytesField(3, _x.encoded()) }
-        if let _x = pageTemplateUuidpath { _w.bytesField(4, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var headers: [TSP_Reference] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(headers value: TSP_Reference) { append(value, toMessages: 0) }
+    var footers: [TSP_Reference] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(footers value: TSP_Reference) { append(value, toMessages: 1) }
+    var sectionTemplateDrawables: [TSP_Reference] { get { self[messages: 2] } set { self[messages: 2] = newValue } }
+    func append(sectionTemplateDrawables value: TSP_Reference) { append(value, toMessages: 2) }
+    var pageTemplateUuidpath: TSP_UUIDPath? { get { self[message: 3] } set { self[message: 3] = newValue } }
 }
 
 /// Generated wire model for `TP.PageTemplateArchive`.
 final class TP_PageTemplateArchive: IWAMessage {
-    var name: String?
-    var sectionTemplateDrawables: [TSP_Reference] = []
-    var placeholderDrawables: [TP_PageTemplateArchive_TagDrawablePair] = []
-    var headersFootersMatchPreviousPage: Bool?
-    var hideHeadersFooters: Bool?
-    var backgroundFill: TSD_FillArchive?
-    var guideStorage: TSP_Reference?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TP.PageTemplateArchive", [
+        .optional(1, .string), .repeated(2, TSP_Reference.self),
+        .repeated(3, TP_PageTemplateArchive_TagDrawablePair.self), .optional(4, .bool), .optional(5, .bool),
+        .optional(6, TSD_FillArchive.self), .optional(7, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 7)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { name = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { sectionTemplateDrawables.append(_v) }
-        case 3:
-            var _v: TP_PageTemplateArchive_TagDrawablePair?
-            if case .lengthDelimited(let _b) = _f.value { _v = TP_PageTemplateArchive_TagDrawablePair(ProtobufMessage(_b)) }
-            if let _v { placeholderDrawables.append(_v) }
-        case 4:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { headersFootersMatchPreviousPage = _v }
-        case 5:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { hideHeadersFooters = _v }
-        case 6:
-            var _v: TSD_FillArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_FillArchive(ProtobufMessage(_b)) }
-            if let _v { backgroundFill = _v }
-        case 7:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { guideStorage = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = name { _w.stringField(1, _x) }
-        for _x in sectionTemplateDrawables { _w.bytesField(2, _x.encoded()) }
-        for _x in placeholderDrawables { _w.bytesField(3, _x.encoded()) }
-        if let _x = headersFootersMatchPreviousPage { _w.varintField(4, _x ? 1 : 0) }
-        if let _x = hideHeadersFooters { _w.varintField(5, _x ? 1 : 0) }
-        if let _x = backgroundFill { _w.bytesField(6, _x.encoded()) }
-        if let _x = guideStorage { _w.bytesField(7, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var name: String? { get { self[0] } set { self[0] = newValue } }
+    var sectionTemplateDrawables: [TSP_Reference] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(sectionTemplateDrawables value: TSP_Reference) { append(value, toMessages: 1) }
+    var placeholderDrawables: [TP_PageTemplateArchive_TagDrawablePair] { get { self[messages: 2] } set { self[messages: 2] = newValue } }
+    func append(placeholderDrawables value: TP_PageTemplateArchive_TagDrawablePair) { append(value, toMessages: 2) }
+    var headersFootersMatchPreviousPage: Bool? { get { self[3] } set { self[3] = newValue } }
+    var hideHeadersFooters: Bool? { get { self[4] } set { self[4] = newValue } }
+    var backgroundFill: TSD_FillArchive? { get { self[message: 5] } set { self[message: 5] = newValue } }
+    var guideStorage: TSP_Reference? { get { self[message: 6] } set { self[message: 6] = newValue } }
 }
 
 /// Generated wire model for `TP.PageTemplateArchive.TagDrawablePair`.
 final class TP_PageTemplateArchive_TagDrawablePair: IWAMessage {
-    var tag: String?
-    var drawable: TSP_Reference?
-    var zIndex: UInt32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TP.PageTemplateArchive.TagDrawablePair", [
+        .optional(1, .string), .optional(2, TSP_Reference.self), .optional(3, .uint32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { tag = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { drawable = _v }
-        case 3:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { zIndex = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = tag { _w.stringField(1, _x) }
-        if let _x = drawable { _w.bytesField(2, _x.encoded()) }
-        if let _x = zIndex { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var tag: String? { get { self[0] } set { self[0] = newValue } }
+    var drawable: TSP_Reference? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var zIndex: UInt32? { get { self[2] } set { self[2] = newValue } }
 }
 
 /// Generated wire model for `TP.SectionArchive`.
 final class TP_SectionArchive: IWAMessage {
-    var obsoleteShowsHeader: Bool?
-    var obsoleteShowsFooter: Bool?
-    var obsoleteHeaders: [TSP_Reference] = []
-    var obsoleteFooters: [TSP_Reference] = []
-    var obsoleteLeftMargin: Float?
-    var obsoleteRightMargin: Float?
-    var obsoleteTopMargin: Float?
-    var obsoleteBottomMargin: Float?
-    var obsoleteHeaderPadding: Float?
-    var obsoleteFooterPadding: Float?
-    var obsoletePaperWidth: Float?
-    var obsoletePaperHeight: Float?
-    var obsoleteLandscapeMode: Bool?
-    var obsoleteSectionTemplateDrawables: [TSP_Reference] = []
-    var obsoleteHeaderMargin: Float?
-    var obsoleteFooterMargin: Float?
-    var inheritPreviousHeaderFooter: Bool?
-    var sectionTemplateFirstPageDifferent: Bool?
-    var sectionTemplateEvenOddPagesDifferent: Bool?
-    var sectionStartKind: UInt32?
-    var sectionPageNumberKind: UInt32?
-    var sectionPageNumberStart: UInt32?
-    var firstSectionTemplatePage: TSP_Reference?
-    var evenSectionTemplatePage: TSP_Reference?
-    var oddSectionTemplatePage: TSP_Reference?
-    var name: String?
-    var sectionTemplateFirstPageHidesHeaderFooter: Bool?
-    var userDefinedGuideStorage: TSP_Reference?
-    var backgroundFill: TSD_FillArchive?
-    var sectionHyperlinkUuid: TSP_UUID?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { obsoleteShowsHeader = _v }
-        case 2:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { obsoleteShowsFooter = _v }
-        case 3:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { obsoleteHeaders.append(_v) }
-        case 4:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { obsoleteFooters.append(_v) }
-        case 5:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { obsoleteLeftMargin = _v }
-        case 6:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { obsoleteRightMargin = _v }
-        case 7:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { obsoleteTopMargin = _v }
-        case 8:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { obsoleteBottomMargin = _v }
-        case 9:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { obsoleteHeaderPadding = _v }
-        case 10:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { obsoleteFooterPadding = _v }
-        case 11:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { obsoletePaperWidth = _v }
-        case 12:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { obsoletePaperHeight = _v }
-        case 13:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { obsoleteLandscapeMode = _v }
-        case 14:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { obsoleteSectionTemplateDrawables.append(_v) }
-        case 15:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { obsoleteHeaderMargin = _v }
-        case 16:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { obsoleteFooterMargin = _v }
-        case 17:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { inheritPreviousHeaderFooter = _v }
-        case 18:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { sectionTemplateFirstPageDifferent = _v }
-        case 19:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { sectionTemplateEvenOddPagesDifferent = _v }
-        case 20:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { sectionStartKind = _v }
-        case 21:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { sectionPageNumberKind = _v }
-        case 22:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { sectionPageNumberStart = _v }
-        case 23:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { firstSectionTemplatePage = _v }
-        case 24:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { evenSectionTemplatePage = _v }
-        case 25:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { oddSectionTemplatePage = _v }
-        case 26:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { name = _v }
-        case 28:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { sectionTemplateFirstPageHidesHeaderFooter = _v }
-        case 29:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { userDefinedGuideStorage = _v }
-        case 30:
-            var _v: TSD_FillArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_FillArchive(ProtobufMessage(_b)) }
-            if let _v { backgroundFill = _v }
-        case 31:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { sectionHyperlinkUuid = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = obsoleteShowsHeader { _w.varintField(1, _x ? 1 : 0) }
-        if let _x = obsoleteShowsFooter { _w.varintField(2, _x ? 1 : 0) }
-        for _x in obsoleteHeaders { _w.bytesField(3, _x.encoded()) }
-        for _x in obsoleteFooters { _w.bytesField(4, _x.encoded()) }
-        if let _x = obsoleteLeftMargin { _w.fixed32Field(5, _x.bitPattern) }
-        if let _x = obsoleteRightMargin { _w.fixed32Field(6, _x.bitPattern) }
-        if let _x = obsoleteTopMargin { _w.fixed32Field(7, _x.bitPattern) }
-        if let _x = obsoleteBottomMargin { _w.fixed32Field(8, _x.bitPattern) }
-        if let _x = obsoleteHeaderPadding { _w.fixed32Field(9, _x.bitPattern) }
-        if let _x = obsoleteFooterPadding { _w.fixed32Field(10, _x.bitPattern) }
-        if let _x = obsoletePaperWidth { _w.fixed32Field(11, _x.bitPattern) }
-        if let _x = obsoletePaperHeight { _w.fixed32Field(12, _x.bitPattern) }
-        if let _x = obsoleteLandscapeMode { _w.varintField(13, _x ? 1 : 0) }
-        for _x in obsoleteSectionTemplateDrawables { _w.bytesField(14, _x.encoded()) }
-        if let _x = obsoleteHeaderMargin { _w.fixed32Field(15, _x.bitPattern) }
-        if let _x = obsoleteFooterMargin { _w.fixed32Field(16, _x.bitPattern) }
-        if let _x = inheritPreviousHeaderFooter { _w.varintField(17, _x ? 1 : 0) }
-        if let _x = sectionTemplateFirstPageDifferent { _w.varintField(18, _x ? 1 : 0) }
-        if let _x = sectionTemplateEvenOddPagesDifferent { _w.varintField(19, _x ? 1 : 0) }
-        if let _x = sectionStartKind { _w.varintField(20, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = sectionPageNumberKind { _w.varintField(21, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = sectionPageNumberStart { _w.varintField(22, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = firstSectionTemplatePage { _w.bytesField(23, _x.encoded()) }
-        if let _x = evenSectionTemplatePage { _w.bytesField(24, _x.encoded()) }
-        if let _x = oddSectionTemplatePage { _w.bytesField(25, _x.encoded()) }
-        if let _x = name { _w.stringField(26, _x) }
-        if let _x = sectionTemplateFirstPageHidesHeaderFooter { _w.varintField(28, _x ? 1 : 0) }
-        if let _x = userDefinedGuideStorage { _w.bytesField(29, _x.encoded()) }
-        if let _x = backgroundFill { _w.bytesField(30, _x.encoded()) }
-        if let _x = sectionHyperlinkUuid { _w.bytesField(31, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TP.SectionArchive", [
+        .optional(1, .bool), .optional(2, .bool), .repeated(3, TSP_Reference.self), .repeated(4, TSP_Reference.self),
+        .optional(5, .float), .optional(6, .float), .optional(7, .float), .optional(8, .float), .optional(9, .float),
+        .optional(10, .float), .optional(11, .float), .optional(12, .float), .optional(13, .bool),
+        .repeated(14, TSP_Reference.self), .optional(15, .float), .optional(16, .float), .optional(17, .bool),
+        .optional(18, .bool), .optional(19, .bool), .optional(20, .uint32), .optional(21, .uint32),
+        .optional(22, .uint32), .optional(23, TSP_Reference.self), .optional(24, TSP_Reference.self),
+        .optional(25, TSP_Reference.self), .optional(26, .string), .optional(28, .bool),
+        .optional(29, TSP_Reference.self), .optional(30, TSD_FillArchive.self), .optional(31, TSP_UUID.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 30)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var obsoleteShowsHeader: Bool? { get { self[0] } set { self[0] = newValue } }
+    var obsoleteShowsFooter: Bool? { get { self[1] } set { self[1] = newValue } }
+    var obsoleteHeaders: [TSP_Reference] { get { self[messages: 2] } set { self[messages: 2] = newValue } }
+    func append(obsoleteHeaders value: TSP_Reference) { append(value, toMessages: 2) }
+    var obsoleteFooters: [TSP_Reference] { get { self[messages: 3] } set { self[messages: 3] = newValue } }
+    func append(obsoleteFooters value: TSP_Reference) { append(value, toMessages: 3) }
+    var obsoleteLeftMargin: Float? { get { self[4] } set { self[4] = newValue } }
+    var obsoleteRightMargin: Float? { get { self[5] } set { self[5] = newValue } }
+    var obsoleteTopMargin: Float? { get { self[6] } set { self[6] = newValue } }
+    var obsoleteBottomMargin: Float? { get { self[7] } set { self[7] = newValue } }
+    var obsoleteHeaderPadding: Float? { get { self[8] } set { self[8] = newValue } }
+    var obsoleteFooterPadding: Float? { get { self[9] } set { self[9] = newValue } }
+    var obsoletePaperWidth: Float? { get { self[10] } set { self[10] = newValue } }
+    var obsoletePaperHeight: Float? { get { self[11] } set { self[11] = newValue } }
+    var obsoleteLandscapeMode: Bool? { get { self[12] } set { self[12] = newValue } }
+    var obsoleteSectionTemplateDrawables: [TSP_Reference] { get { self[messages: 13] } set { self[messages: 13] = newValue } }
+    func append(obsoleteSectionTemplateDrawables value: TSP_Reference) { append(value, toMessages: 13) }
+    var obsoleteHeaderMargin: Float? { get { self[14] } set { self[14] = newValue } }
+    var obsoleteFooterMargin: Float? { get { self[15] } set { self[15] = newValue } }
+    var inheritPreviousHeaderFooter: Bool? { get { self[16] } set { self[16] = newValue } }
+    var sectionTemplateFirstPageDifferent: Bool? { get { self[17] } set { self[17] = newValue } }
+    var sectionTemplateEvenOddPagesDifferent: Bool? { get { self[18] } set { self[18] = newValue } }
+    var sectionStartKind: UInt32? { get { self[19] } set { self[19] = newValue } }
+    var sectionPageNumberKind: UInt32? { get { self[20] } set { self[20] = newValue } }
+    var sectionPageNumberStart: UInt32? { get { self[21] } set { self[21] = newValue } }
+    var firstSectionTemplatePage: TSP_Reference? { get { self[message: 22] } set { self[message: 22] = newValue } }
+    var evenSectionTemplatePage: TSP_Reference? { get { self[message: 23] } set { self[message: 23] = newValue } }
+    var oddSectionTemplatePage: TSP_Reference? { get { self[message: 24] } set { self[message: 24] = newValue } }
+    var name: String? { get { self[25] } set { self[25] = newValue } }
+    var sectionTemplateFirstPageHidesHeaderFooter: Bool? { get { self[26] } set { self[26] = newValue } }
+    var userDefinedGuideStorage: TSP_Reference? { get { self[message: 27] } set { self[message: 27] = newValue } }
+    var backgroundFill: TSD_FillArchive? { get { self[message: 28] } set { self[message: 28] = newValue } }
+    var sectionHyperlinkUuid: TSP_UUID? { get { self[message: 29] } set { self[message: 29] = newValue } }
 }
 
 /// Generated wire model for `TP.DoublePoint`.
 final class TP_DoublePoint: IWAMessage {
-    var x: Double?
-    var y: Double?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TP.DoublePoint", [
+        .optional(1, .double), .optional(2, .double),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { x = _v }
-        case 2:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { y = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = x { _w.fixed64Field(1, _x.bitPattern) }
-        if let _x = y { _w.fixed64Field(2, _x.bitPattern) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var x: Double? { get { self[0] } set { self[0] = newValue } }
+    var y: Double? { get { self[1] } set { self[1] = newValue } }
 }
 
 /// Generated wire model for `TP.DoubleSize`.
 final class TP_DoubleSize: IWAMessage {
-    var width: Double?
-    var height: Double?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TP.DoubleSize", [
+        .optional(1, .double), .optional(2, .double),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { width = _v }
-        case 2:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { height = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = width { _w.fixed64Field(1, _x.bitPattern) }
-        if let _x = height { _w.fixed64Field(2, _x.bitPattern) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var width: Double? { get { self[0] } set { self[0] = newValue } }
+    var height: Double? { get { self[1] } set { self[1] = newValue } }
 }
 
 /// Generated wire model for `TP.AnchorPosArchive`.
 final class TP_AnchorPosArchive: IWAMessage {
-    var attachment: TSP_Reference?
-    var position: TSP_Point?
-    var drawableUuidPath: TSP_UUIDPath?
-    var doublePosition: TP_DoublePoint?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TP.AnchorPosArchive", [
+        .optional(1, TSP_Reference.self), .optional(2, TSP_Point.self), .optional(3, TSP_UUIDPath.self),
+        .optional(4, TP_DoublePoint.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { attachment = _v }
-        case 2:
-            var _v: TSP_Point?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Point(ProtobufMessage(_b)) }
-            if let _v { position = _v }
-        case 3:
-            var _v: TSP_UUIDPath?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUIDPath(ProtobufMessage(_b)) }
-            if let _v { drawableUuidPath = _v }
-        case 4:
-            var _v: TP_DoublePoint?
-            if case .lengthDelimited(let _b) = _f.value { _v = TP_DoublePoint(ProtobufMessage(_b)) }
-            if let _v { doublePosition = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = attachment { _w.bytesField(1, _x.encoded()) }
-        if let _x = position { _w.bytesField(2, _x.encoded()) }
-        if let _x = drawableUuidPath { _w.bytesField(3, _x.encoded()) }
-        if let _x = doublePosition { _w.bytesField(4, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var attachment: TSP_Reference? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var position: TSP_Point? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var drawableUuidPath: TSP_UUIDPath? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var doublePosition: TP_DoublePoint? { get { self[message: 3] } set { self[message: 3] = newValue } }
 }
 
 /// Generated wire model for `TP.TargetHintArchive`.
 final class TP_TargetHintArchive: IWAMessage {
-    var frameOrigin: TSP_Point?
-    var frameSize: TSP_Size?
-    var range: TSP_Range?
-    var nextWidowPullsDownFromCharIndex: UInt32?
-    var anchoredRange: TSP_Range?
-    var columnCount: UInt32?
-    var lineFragmentCount: UInt32?
-    var doubleOrigin: TP_DoublePoint?
-    var doubleSize: TP_DoubleSize?
-    var endOfLayout: Bool?
-    var lastLineIsEmptyAndHasListLabel: Bool?
-    var textIsVertical: Bool?
-    var terminatedByBreak: Bool?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Point?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Point(ProtobufMessage(_b)) }
-            if let _v { frameOrigin = _v }
-        case 2:
-            var _v: TSP_Size?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Size(ProtobufMessage(_b)) }
-            if let _v { frameSize = _v }
-        case 3:
-            var _v: TSP_Range?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Range(ProtobufMessage(_b)) }
-            if let _v { range = _v }
-        case 4:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { nextWidowPullsDownFromCharIndex = _v }
-        case 5:
-            var _v: TSP_Range?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Range(ProtobufMessage(_b)) }
-            if let _v { anchoredRange = _v }
-        case 6:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { columnCount = _v }
-        case 7:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { lineFragmentCount = _v }
-        case 8:
-            var _v: TP_DoublePoint?
-            if case .lengthDelimited(let _b) = _f.value { _v = TP_DoublePoint(ProtobufMessage(_b)) }
-            if let _v { doubleOrigin = _v }
-        case 9:
-            var _v: TP_DoubleSize?
-            if case .lengthDelimited(let _b) = _f.value { _v = TP_DoubleSize(ProtobufMessage(_b)) }
-            if let _v { doubleSize = _v }
-        case 10:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { endOfLayout = _v }
-        case 11:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { lastLineIsEmptyAndHasListLabel = _v }
-        case 12:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { textIsVertical = _v }
-        case 13:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { terminatedByBreak = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = frameOrigin { _w.bytesField(1, _x.encoded()) }
-        if let _x = frameSize { _w.bytesField(2, _x.encoded()) }
-        if let _x = range { _w.bytesField(3, _x.encoded()) }
-        if let _x = nextWidowPullsDownFromCharIndex { _w.varintField(4, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = anchoredRange { _w.bytesField(5, _x.encoded()) }
-        if let _x = columnCount { _w.varintField(6, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = lineFragmentCount { _w.varintField(7, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = doubleOrigin { _w.bytesField(8, _x.encoded()) }
-        if let _x = doubleSize { _w.bytesField(9, _x.encoded()) }
-        if let _x = endOfLayout { _w.varintField(10, _x ? 1 : 0) }
-        if let _x = lastLineIsEmptyAndHasListLabel { _w.varintField(11, _x ? 1 : 0) }
-        if let _x = textIsVertical { _w.varintField(12, _x ? 1 : 0) }
-        if let _x = terminatedByBreak { _w.varintField(13, _x ? 1 : 0) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TP.TargetHintArchive", [
+        .optional(1, TSP_Point.self), .optional(2, TSP_Size.self), .optional(3, TSP_Range.self), .optional(4, .uint32),
+        .optional(5, TSP_Range.self), .optional(6, .uint32), .optional(7, .uint32), .optional(8, TP_DoublePoint.self),
+        .optional(9, TP_DoubleSize.self), .optional(10, .bool), .optional(11, .bool), .optional(12, .bool),
+        .optional(13, .bool),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 13)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var frameOrigin: TSP_Point? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var frameSize: TSP_Size? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var range: TSP_Range? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var nextWidowPullsDownFromCharIndex: UInt32? { get { self[3] } set { self[3] = newValue } }
+    var anchoredRange: TSP_Range? { get { self[message: 4] } set { self[message: 4] = newValue } }
+    var columnCount: UInt32? { get { self[5] } set { self[5] = newValue } }
+    var lineFragmentCount: UInt32? { get { self[6] } set { self[6] = newValue } }
+    var doubleOrigin: TP_DoublePoint? { get { self[message: 7] } set { self[message: 7] = newValue } }
+    var doubleSize: TP_DoubleSize? { get { self[message: 8] } set { self[message: 8] = newValue } }
+    var endOfLayout: Bool? { get { self[9] } set { self[9] = newValue } }
+    var lastLineIsEmptyAndHasListLabel: Bool? { get { self[10] } set { self[10] = newValue } }
+    var textIsVertical: Bool? { get { self[11] } set { self[11] = newValue } }
+    var terminatedByBreak: Bool? { get { self[12] } set { self[12] = newValue } }
 }
 
 /// Generated wire model for `TP.PageHintArchive`.
 final class TP_PageHintArchive: IWAMessage {
-    var pageKind: Int32?
-    var targetHints: [TP_TargetHintArchive] = []
-    var footnoteAutoNumberRange: TSP_Range?
-    var footnoteLayoutRange: TSP_Range?
-    var firstChildHint: TSP_Reference?
-    var lastChildHint: TSP_Reference?
-    var anchoredAttachmentsMap: [TP_AnchorPosArchive] = []
-    var versionNumber: UInt32?
-    var platformId: UInt32?
-    var childHints: [TSP_Reference] = []
-    var partitionedAttachmentUuids: [TSP_UUID] = []
-    var textFlows: [TSP_Reference] = []
-    var flowHints: [TP_TargetHintArchive] = []
-    var pageSide: Int32?
-    var pageColumn: UInt32?
-    var pageRow: UInt32?
-    var topicNumberHints: TP_TopicNumberHintsArchive?
-    var flowTopicNumberHints: [TP_TopicNumberHintsArchive] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { pageKind = _v }
-        case 2:
-            var _v: TP_TargetHintArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TP_TargetHintArchive(ProtobufMessage(_b)) }
-            if let _v { targetHints.append(_v) }
-        case 3:
-            var _v: TSP_Range?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Range(ProtobufMessage(_b)) }
-            if let _v { footnoteAutoNumberRange = _v }
-        case 4:
-            var _v: TSP_Range?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Range(ProtobufMessage(_b)) }
-            if let _v { footnoteLayoutRange = _v }
-        case 6:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { firstChildHint = _v }
-        case 7:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { lastChildHint = _v }
-        case 8:
-            var _v: TP_AnchorPosArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TP_AnchorPosArchive(ProtobufMessage(_b)) }
-            if let _v { anchoredAttachmentsMap.append(_v) }
-        case 10:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { versionNumber = _v }
-        case 11:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { platformId = _v }
-        case 12:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { childHints.append(_v) }
-        case 13:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { partitionedAttachmentUuids.append(_v) }
-        case 14:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { textFlows.append(_v) }
-        case 15:
-            var _v: TP_TargetHintArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TP_TargetHintArchive(ProtobufMessage(_b)) }
-            if let _v { flowHints.append(_v) }
-        case 17:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { pageSide = _v }
-        case 18:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { pageColumn = _v }
-        case 19:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { pageRow = _v }
-        case 20:
-            var _v: TP_TopicNumberHintsArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TP_TopicNumberHintsArchive(ProtobufMessage(_b)) }
-            if let _v { topicNumberHints = _v }
-        case 21:
-            var _v: TP_TopicNumberHintsArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TP_TopicNumberHintsArchive(ProtobufMessage(_b)) }
-            if let _v { flowTopicNumberHints.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = pageKind { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        for _x in targetHints { _w.bytesField(2, _x.encoded()) }
-        if let _x = footnoteAutoNumberRange { _w.bytesField(3, _x.encoded()) }
-        if let _x = footnoteLayoutRange { _w.bytesField(4, _x.encoded()) }
-        if let _x = firstChildHint { _w.bytesField(6, _x.encoded()) }
-        if let _x = lastChildHint { _w.bytesField(7, _x.encoded()) }
-        for _x in anchoredAttachmentsMap { _w.bytesField(8, _x.encoded()) }
-        if let _x = versionNumber { _w.varintField(10, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = platformId { _w.varintField(11, UInt64(truncatingIfNeeded: _x)) }
-        for _x in childHints { _w.bytesField(12, _x.encoded()) }
-        for _x in partitionedAttachmentUuids { _w.bytesField(13, _x.encoded()) }
-        for _x in textFlows { _w.bytesField(14, _x.encoded()) }
-        for _x in flowHints { _w.bytesField(15, _x.encoded()) }
-        if let _x = pageSide { _w.varintField(17, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = pageColumn { _w.varintField(18, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = pageRow { _w.varintField(19, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = topicNumberHints { _w.bytesField(20, _x.encoded()) }
-        for _x in flowTopicNumberHints { _w.bytesField(21, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TP.PageHintArchive", [
+        .optional(1, .int32), .repeated(2, TP_TargetHintArchive.self), .optional(3, TSP_Range.self),
+        .optional(4, TSP_Range.self), .optional(6, TSP_Reference.self), .optional(7, TSP_Reference.self),
+        .repeated(8, TP_AnchorPosArchive.self), .optional(10, .uint32), .optional(11, .uint32),
+        .repeated(12, TSP_Reference.self), .repeated(13, TSP_UUID.self), .repeated(14, TSP_Reference.self),
+        .repeated(15, TP_TargetHintArchive.self), .optional(17, .int32), .optional(18, .uint32), .optional(19, .uint32),
+        .optional(20, TP_TopicNumberHintsArchive.self), .repeated(21, TP_TopicNumberHintsArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 18)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var pageKind: Int32? { get { self[0] } set { self[0] = newValue } }
+    var targetHints: [TP_TargetHintArchive] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(targetHints value: TP_TargetHintArchive) { append(value, toMessages: 1) }
+    var footnoteAutoNumberRange: TSP_Range? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var footnoteLayoutRange: TSP_Range? { get { self[message: 3] } set { self[message: 3] = newValue } }
+    var firstChildHint: TSP_Reference? { get { self[message: 4] } set { self[message: 4] = newValue } }
+    var lastChildHint: TSP_Reference? { get { self[message: 5] } set { self[message: 5] = newValue } }
+    var anchoredAttachmentsMap: [TP_AnchorPosArchive] { get { self[messages: 6] } set { self[messages: 6] = newValue } }
+    func append(anchoredAttachmentsMap value: TP_AnchorPosArchive) { append(value, toMessages: 6) }
+    var versionNumber: UInt32? { get { self[7] } set { self[7] = newValue } }
+    var platformId: UInt32? { get { self[8] } set { self[8] = newValue } }
+    var childHints: [TSP_Reference] { get { self[messages: 9] } set { self[messages: 9] = newValue } }
+    func append(childHints value: TSP_Reference) { append(value, toMessages: 9) }
+    var partitionedAttachmentUuids: [TSP_UUID] { get { self[messages: 10] } set { self[messages: 10] = newValue } }
+    func append(partitionedAttachmentUuids value: TSP_UUID) { append(value, toMessages: 10) }
+    var textFlows: [TSP_Reference] { get { self[messages: 11] } set { self[messages: 11] = newValue } }
+    func append(textFlows value: TSP_Reference) { append(value, toMessages: 11) }
+    var flowHints: [TP_TargetHintArchive] { get { self[messages: 12] } set { self[messages: 12] = newValue } }
+    func append(flowHints value: TP_TargetHintArchive) { append(value, toMessages: 12) }
+    var pageSide: Int32? { get { self[13] } set { self[13] = newValue } }
+    var pageColumn: UInt32? { get { self[14] } set { self[14] = newValue } }
+    var pageRow: UInt32? { get { self[15] } set { self[15] = newValue } }
+    var topicNumberHints: TP_TopicNumberHintsArchive? { get { self[message: 16] } set { self[message: 16] = newValue } }
+    var flowTopicNumberHints: [TP_TopicNumberHintsArchive] { get { self[messages: 17] } set { self[messages: 17] = newValue } }
+    func append(flowTopicNumberHints value: TP_TopicNumberHintsArchive) { append(value, toMessages: 17) }
 }
 
 /// Generated wire model for `TP.NullChildHintArchive`.
 final class TP_NullChildHintArchive: IWAMessage {
-
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TP.NullChildHintArchive", [])
+    var _values = [IWAValue](repeating: .absent, count: 0)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
 }
 
 /// Generated wire model for `TP.SectionHintArchive`.
 final class TP_SectionHintArchive: IWAMessage {
-    var pageHints: [TP_PageHintArchive] = []
-    var startPageIndex: UInt32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TP.SectionHintArchive", [
+        .repeated(1, TP_PageHintArchive.self), .optional(2, .uint32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TP_PageHintArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TP_PageHintArchive(ProtobufMessage(_b)) }
-            if let _v { pageHints.append(_v) }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { startPageIndex = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in pageHints { _w.bytesField(1, _x.encoded()) }
-        if let _x = startPageIndex { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var pageHints: [TP_PageHintArchive] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(pageHints value: TP_PageHintArchive) { append(value, toMessages: 0) }
+    var startPageIndex: UInt32? { get { self[1] } set { self[1] = newValue } }
 }
 
 /// Generated wire model for `TP.TextboxHintArchive`.
 final class TP_TextboxHintArchive: IWAMessage {
-    var range: TSP_Range?
-    var size: TSP_Size?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TP.TextboxHintArchive", [
+        .optional(1, TSP_Range.self), .optional(2, TSP_Size.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Range?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Range(ProtobufMessage(_b)) }
-            if let _v { range = _v }
-        case 2:
-            var _v: TSP_Size?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Size(ProtobufMessage(_b)) }
-            if let _v { size = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = range { _w.bytesField(1, _x.encoded()) }
-        if let _x = size { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var range: TSP_Range? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var size: TSP_Size? { get { self[message: 1] } set { self[message: 1] = newValue } }
 }
 
 /// Generated wire model for `TP.TopicNumberHintLevelDataArchive`.
 final class TP_TopicNumberHintLevelDataArchive: IWAMessage {
-    var number: UInt32?
-    var labelType: UInt32?
-    var numberType: UInt32?
-    var isTiered: Bool?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TP.TopicNumberHintLevelDataArchive", [
+        .optional(1, .uint32), .optional(2, .uint32), .optional(3, .uint32), .optional(4, .bool),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { number = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { labelType = _v }
-        case 3:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { numberType = _v }
-        case 4:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { isTiered = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = number { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = labelType { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = numberType { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = isTiered { _w.varintField(4, _x ? 1 : 0) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var number: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var labelType: UInt32? { get { self[1] } set { self[1] = newValue } }
+    var numberType: UInt32? { get { self[2] } set { self[2] = newValue } }
+    var isTiered: Bool? { get { self[3] } set { self[3] = newValue } }
 }
 
 /// Generated wire model for `TP.TopicNumberHintEntryArchive`.
 final class TP_TopicNumberHintEntryArchive: IWAMessage {
-    var listStyle: TSP_Reference?
-    var topicNumbers: [TP_TopicNumberHintLevelDataArchive] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TP.TopicNumberHintEntryArchive", [
+        .optional(1, TSP_Reference.self), .repeated(2, TP_TopicNumberHintLevelDataArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { listStyle = _v }
-        case 2:
-            var _v: TP_TopicNumberHintLevelDataArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TP_TopicNumberHintLevelDataArchive(ProtobufMessage(_b)) }
-            if let _v { topicNumbers.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = listStyle { _w.bytesField(1, _x.encoded()) }
-        for _x in topicNumbers { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var listStyle: TSP_Reference? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var topicNumbers: [TP_TopicNumberHintLevelDataArchive] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(topicNumbers value: TP_TopicNumberHintLevelDataArchive) { append(value, toMessages: 1) }
 }
 
 /// Generated wire model for `TP.TopicNumberHintsArchive`.
 final class TP_TopicNumberHintsArchive: IWAMessage {
-    var topicNumbersMap: [TP_TopicNumberHintEntryArchive] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TP.TopicNumberHintsArchive", [
+        .repeated(2, TP_TopicNumberHintEntryArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 2:
-            var _v: TP_TopicNumberHintEntryArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TP_TopicNumberHintEntryArchive(ProtobufMessage(_b)) }
-            if let _v { topicNumbersMap.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in topicNumbersMap { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var topicNumbersMap: [TP_TopicNumberHintEntryArchive] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(topicNumbersMap value: TP_TopicNumberHintEntryArchive) { append(value, toMessages: 0) }
 }
 
 /// Generated wire model for `TP.LayoutStateArchive`.
 final class TP_LayoutStateArchive: IWAMessage {
-    var sectionIndex: UInt32?
-    var sectionPageIndex: UInt32?
-    var documentPageIndex: UInt32?
-    var lastPageCount: UInt32?
-    var sectionHints: [TP_SectionHintArchive] = []
-    var bodyLength: UInt32?
-    var missingFonts: [String] = []
-    var osVersion: Int32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TP.LayoutStateArchive", [
+        .optional(1, .uint32), .optional(2, .uint32), .optional(3, .uint32), .optional(4, .uint32),
+        .repeated(5, TP_SectionHintArchive.self), .optional(6, .uint32), .repeated(7, .string), .optional(8, .int32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 8)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { sectionIndex = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { sectionPageIndex = _v }
-        case 3:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { documentPageIndex = _v }
-        case 4:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { lastPageCount = _v }
-        case 5:
-            var _v: TP_SectionHintArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TP_SectionHintArchive(ProtobufMessage(_b)) }
-            if let _v { sectionHints.append(_v) }
-        case 6:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { bodyLength = _v }
-        case 7:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { missingFonts.append(_v) }
-        case 8:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { osVersion = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = sectionIndex { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = sectionPageIndex { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = documentPageIndex { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = lastPageCount { _w.varintField(4, UInt64(truncatingIfNeeded: _x)) }
-        for _x in sectionHints { _w.bytesField(5, _x.encoded()) }
-        if let _x = bodyLength { _w.varintField(6, UInt64(truncatingIfNeeded: _x)) }
-        for _x in missingFonts { _w.stringField(7, _x) }
-        if let _x = osVersion { _w.varintField(8, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var sectionIndex: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var sectionPageIndex: UInt32? { get { self[1] } set { self[1] = newValue } }
+    var documentPageIndex: UInt32? { get { self[2] } set { self[2] = newValue } }
+    var lastPageCount: UInt32? { get { self[3] } set { self[3] = newValue } }
+    var sectionHints: [TP_SectionHintArchive] { get { self[messages: 4] } set { self[messages: 4] = newValue } }
+    func append(sectionHints value: TP_SectionHintArchive) { append(value, toMessages: 4) }
+    var bodyLength: UInt32? { get { self[5] } set { self[5] = newValue } }
+    var missingFonts: [String] { get { self[all: 6] } set { self[all: 6] = newValue } }
+    func append(missingFonts value: String) { append(value, toAll: 6) }
+    var osVersion: Int32? { get { self[7] } set { self[7] = newValue } }
 }
 
 /// Generated wire model for `TP.CanvasSelectionArchive`.
 final class TP_CanvasSelectionArchive: IWAMessage {
-    var deprecatedType: Int32?
-    var visualDefinitionRange: TSP_Range?
-    var styleInsertionBehavior: Int32?
-    var caretAffinity: Int32?
-    var infos: [TSP_Reference] = []
-    var excludedInfos: [TSP_Reference] = []
-    var additionalInfos: [TSP_Reference] = []
-    var deprecatedContainer: TSP_Reference?
-    var leadingEdge: Bool?
-    var leadingCharIndex: UInt32?
-    var type: Int32?
-    var ranges: [TSP_Range] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { deprecatedType = _v }
-        case 2:
-            var _v: TSP_Range?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Range(ProtobufMessage(_b)) }
-            if let _v { visualDefinitionRange = _v }
-        case 3:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { styleInsertionBehavior = _v }
-        case 4:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { caretAffinity = _v }
-        case 5:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { infos.append(_v) }
-        case 6:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { excludedInfos.append(_v) }
-        case 7:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { additionalInfos.append(_v) }
-        case 8:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { deprecatedContainer = _v }
-        case 9:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { leadingEdge = _v }
-        case 10:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { leadingCharIndex = _v }
-        case 11:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { type = _v }
-        case 12:
-            var _v: TSP_Range?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Range(ProtobufMessage(_b)) }
-            if let _v { ranges.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = deprecatedType { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = visualDefinitionRange { _w.bytesField(2, _x.encoded()) }
-        if let _x = styleInsertionBehavior { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = caretAffinity { _w.varintField(4, UInt64(truncatingIfNeeded: _x)) }
-        for _x in infos { _w.bytesField(5, _x.encoded()) }
-        for _x in excludedInfos { _w.bytesField(6, _x.encoded()) }
-        for _x in additionalInfos { _w.bytesField(7, _x.encoded()) }
-        if let _x = deprecatedContainer { _w.bytesField(8, _x.encoded()) }
-        if let _x = leadingEdge { _w.varintField(9, _x ? 1 : 0) }
-        if let _x = leadingCharIndex { _w.varintField(10, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = type { _w.varintField(11, UInt64(truncatingIfNeeded: _x)) }
-        for _x in ranges { _w.bytesField(12, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TP.CanvasSelectionArchive", [
+        .optional(1, .int32), .optional(2, TSP_Range.self), .optional(3, .int32), .optional(4, .int32),
+        .repeated(5, TSP_Reference.self), .repeated(6, TSP_Reference.self), .repeated(7, TSP_Reference.self),
+        .optional(8, TSP_Reference.self), .optional(9, .bool), .optional(10, .uint32), .optional(11, .int32),
+        .repeated(12, TSP_Range.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 12)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var deprecatedType: Int32? { get { self[0] } set { self[0] = newValue } }
+    var visualDefinitionRange: TSP_Range? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var styleInsertionBehavior: Int32? { get { self[2] } set { self[2] = newValue } }
+    var caretAffinity: Int32? { get { self[3] } set { self[3] = newValue } }
+    var infos: [TSP_Reference] { get { self[messages: 4] } set { self[messages: 4] = newValue } }
+    func append(infos value: TSP_Reference) { append(value, toMessages: 4) }
+    var excludedInfos: [TSP_Reference] { get { self[messages: 5] } set { self[messages: 5] = newValue } }
+    func append(excludedInfos value: TSP_Reference) { append(value, toMessages: 5) }
+    var additionalInfos: [TSP_Reference] { get { self[messages: 6] } set { self[messages: 6] = newValue } }
+    func append(additionalInfos value: TSP_Reference) { append(value, toMessages: 6) }
+    var deprecatedContainer: TSP_Reference? { get { self[message: 7] } set { self[message: 7] = newValue } }
+    var leadingEdge: Bool? { get { self[8] } set { self[8] = newValue } }
+    var leadingCharIndex: UInt32? { get { self[9] } set { self[9] = newValue } }
+    var type: Int32? { get { self[10] } set { self[10] = newValue } }
+    var ranges: [TSP_Range] { get { self[messages: 11] } set { self[messages: 11] = newValue } }
+    func append(ranges value: TSP_Range) { append(value, toMessages: 11) }
 }
 
 /// Generated wire model for `TP.AllFootnoteSelectionArchive`.
 final class TP_AllFootnoteSelectionArchive: IWAMessage {
-
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TP.AllFootnoteSelectionArchive", [])
+    var _values = [IWAValue](repeating: .absent, count: 0)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
 }
 
 /// Generated wire model for `TP.UIStateArchive`.
 final class TP_UIStateArchive: IWAMessage {
-    var obsoleteViewScale: Float?
-    var visibleRectOrigin: TSP_Point?
-    var obsoleteLandscape: Bool?
-    var selection: TSP_Reference?
-    var selectionModel: TSP_Reference?
-    var sectionTemplateDrawablesSelectable: Bool?
-    var visibleRectSize: TSP_Size?
-    var rulerVisible: Bool?
-    var layoutBordersVisible: Bool?
-    var wordCountHudVisible: Bool?
-    var showsComments: Bool?
-    var showsPageNavigator: Bool?
-    var viewScaleMode: Int32?
-    var viewScale: Float?
-    var windowFrameOrigin: TSP_Point?
-    var windowFrameSize: TSP_Size?
-    var selectedInspectorSwitchSegmentIdentifier: String?
-    var inspectorHidden: Bool?
-    var wordCountHudType: UInt32?
-    var wordCountHudXPosition: Float?
-    var wordCountHudYPosition: Float?
-    var showUserDefinedGuides: Bool?
-    var shouldShowCommentSidebar: Bool?
-    var compatibilitySelectionPath: TSK_SelectionPathArchive?
-    var showsCtmarkup: Bool?
-    var showsCtdeletions: Bool?
-    var changeTrackingPaused: Bool?
-    var compatibility2SelectionPath: TSK_SelectionPathArchive?
-    var filteredAuthorName: String?
-    var viewScaleModeIos: Int32?
-    var filteredAuthor: TSP_Reference?
-    var pageViewState: Int32?
-    var pencilAnnotationsHidden: Bool?
-    var freehandDrawingToolkitState: TSP_Reference?
-    var presentationAutoScrollSpeed: Float?
-    var selectionPathTransformer: TSP_Reference?
-    var showsTocNavigator: Bool?
-    var showUserDefinedPageTemplateGuides: Bool?
-    var editingDisabled: Bool?
-    var pencilAnnotationUiState: TSP_Reference?
-    var showsFlowMode: Bool?
-    var mailMergeSettings: TP_MailMergeSettingsArchive?
-    var showsActivityStream: Bool?
-    var tocOrPageNavWidth: Float?
-    var activityOrAnnotationWidth: Float?
-    var selectionPath: TSK_SelectionPathArchive?
-    var flowModeFontScale: Float?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { obsoleteViewScale = _v }
-        case 2:
-            var _v: TSP_Point?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Point(ProtobufMessage(_b)) }
-            if let _v { visibleRectOrigin = _v }
-        case 3:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { obsoleteLandscape = _v }
-        case 4:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { selection = _v }
-        case 5:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { selectionModel = _v }
-        case 6:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { sectionTemplateDrawablesSelectable = _v }
-        case 7:
-            var _v: TSP_Size?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Size(ProtobufMessage(_b)) }
-            if let _v { visibleRectSize = _v }
-        case 9:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { rulerVisible = _v }
-        case 10:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { layoutBordersVisible = _v }
-        case 11:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { wordCountHudVisible = _v }
-        case 12:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { showsComments = _v }
-        case 13:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { showsPageNavigator = _v }
-        case 14:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { viewScaleMode = _v }
-        case 15:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { viewScale = _v }
-        case 16:
-            var _v: TSP_Point?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Point(ProtobufMessage(_b)) }
-            if let _v { windowFrameOrigin = _v }
-        case 17:
-            var _v: TSP_Size?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Size(ProtobufMessage(_b)) }
-            if let _v { windowFrameSize = _v }
-        case 18:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { selectedInspectorSwitchSegmentIdentifier = _v }
-        case 19:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { inspectorHidden = _v }
-        case 20:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { wordCountHudType = _v }
-        case 21:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { wordCountHudXPosition = _v }
-        case 22:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { wordCountHudYPosition = _v }
-        case 23:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { showUserDefinedGuides = _v }
-        case 24:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { shouldShowCommentSidebar = _v }
-        case 25:
-            var _v: TSK_SelectionPathArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_SelectionPathArchive(ProtobufMessage(_b)) }
-            if let _v { compatibilitySelectionPath = _v }
-        case 26:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { showsCtmarkup = _v }
-        case 27:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { showsCtdeletions = _v }
-        case 28:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { changeTrackingPaused = _v }
-        case 29:
-            var _v: TSK_SelectionPathArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_SelectionPathArchive(ProtobufMessage(_b)) }
-            if let _v { compatibility2SelectionPath = _v }
-        case 30:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { filteredAuthorName = _v }
-        case 31:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { viewScaleModeIos = _v }
-        case 32:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { filteredAuthor = _v }
-        case 33:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { pageViewState = _v }
-        case 34:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { pencilAnnotationsHidden = _v }
-        case 35:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { freehandDrawingToolkitState = _v }
-        case 36:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { presentationAutoScrollSpeed = _v }
-        case 37:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { selectionPathTransformer = _v }
-        case 38:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { showsTocNavigator = _v }
-        case 39:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { showUserDefinedPageTemplateGuides = _v }
-        case 40:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { editingDisabled = _v }
-        case 41:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { pencilAnnotationUiState = _v }
-        case 42:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { showsFlowMode = _v }
-        case 43:
-            var _v: TP_MailMergeSettingsArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TP_MailMergeSettingsArchive(ProtobufMessage(_b)) }
-            if let _v { mailMergeSettings = _v }
-        case 44:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { showsActivityStream = _v }
-        case 45:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { tocOrPageNavWidth = _v }
-        case 46:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { activityOrAnnotationWidth = _v }
-        case 47:
-            var _v: TSK_SelectionPathArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_SelectionPathArchive(ProtobufMessage(_b)) }
-            if let _v { selectionPath = _v }
-        case 48:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { flowModeFontScale = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = obsoleteViewScale { _w.fixed32Field(1, _x.bitPattern) }
-        if let _x = visibleRectOrigin { _w.bytesField(2, _x.encoded()) }
-        if let _x = obsoleteLandscape { _w.varintField(3, _x ? 1 : 0) }
-        if let _x = selection { _w.bytesField(4, _x.encoded()) }
-        if let _x = selectionModel { _w.bytesField(5, _x.encoded()) }
-        if let _x = sectionTemplateDrawablesSelectable { _w.varintField(6, _x ? 1 : 0) }
-        if let _x = visibleRectSize { _w.bytesField(7, _x.encoded()) }
-        if let _x = rulerVisible { _w.varintField(9, _x ? 1 : 0) }
-        if let _x = layoutBordersVisible { _w.varintField(10, _x ? 1 : 0) }
-        if let _x = wordCountHudVisible { _w.varintField(11, _x ? 1 : 0) }
-        if let _x = showsComments { _w.varintField(12, _x ? 1 : 0) }
-        if let _x = showsPageNavigator { _w.varintField(13, _x ? 1 : 0) }
-        if let _x = viewScaleMode { _w.varintField(14, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = viewScale { _w.fixed32Field(15, _x.bitPattern) }
-        if let _x = windowFrameOrigin { _w.bytesField(16, _x.encoded()) }
-        if let _x = windowFrameSize { _w.bytesField(17, _x.encoded()) }
-        if let _x = selectedInspectorSwitchSegmentIdentifier { _w.stringField(18, _x) }
-        if let _x = inspectorHidden { _w.varintField(19, _x ? 1 : 0) }
-        if let _x = wordCountHudType { _w.varintField(20, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = wordCountHudXPosition { _w.fixed32Field(21, _x.bitPattern) }
-        if let _x = wordCountHudYPosition { _w.fixed32Field(22, _x.bitPattern) }
-        if let _x = showUserDefinedGuides { _w.varintField(23, _x ? 1 : 0) }
-        if let _x = shouldShowCommentSidebar { _w.varintField(24, _x ? 1 : 0) }
-        if let _x = compatibilitySelectionPath { _w.bytesField(25, _x.encoded()) }
-        if let _x = showsCtmarkup { _w.varintField(26, _x ? 1 : 0) }
-        if let _x = showsCtdeletions { _w.varintField(27, _x ? 1 : 0) }
-        if let _x = changeTrackingPaused { _w.varintField(28, _x ? 1 : 0) }
-        if let _x = compatibility2SelectionPath { _w.bytesField(29, _x.encoded()) }
-        if let _x = filteredAuthorName { _w.stringField(30, _x) }
-        if let _x = viewScaleModeIos { _w.varintField(31, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = filteredAuthor { _w.bytesField(32, _x.encoded()) }
-        if let _x = pageViewState { _w.varintField(33, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = pencilAnnotationsHidden { _w.varintField(34, _x ? 1 : 0) }
-        if let _x = freehandDrawingToolkitState { _w.bytesField(35, _x.encoded()) }
-        if let _x = presentationAutoScrollSpeed { _w.fixed32Field(36, _x.bitPattern) }
-        if let _x = selectionPathTransformer { _w.bytesField(37, _x.encoded()) }
-        if let _x = showsTocNavigator { _w.varintField(38, _x ? 1 : 0) }
-        if let _x = showUserDefinedPageTemplateGuides { _w.varintField(39, _x ? 1 : 0) }
-        if let _x = editingDisabled { _w.varintField(40, _x ? 1 : 0) }
-        if let _x = pencilAnnotationUiState { _w.bytesField(41, _x.encoded()) }
-        if let _x = showsFlowMode { _w.varintField(42, _x ? 1 : 0) }
-        if let _x = mailMergeSettings { _w.bytesField(43, _x.encoded()) }
-        if let _x = showsActivityStream { _w.varintField(44, _x ? 1 : 0) }
-        if let _x = tocOrPageNavWidth { _w.fixed32Field(45, _x.bitPattern) }
-        if let _x = activityOrAnnotationWidth { _w.fixed32Field(46, _x.bitPattern) }
-        if let _x = selectionPath { _w.bytesField(47, _x.encoded()) }
-        if let _x = flowModeFontScale { _w.fixed32Field(48, _x.bitPattern) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TP.UIStateArchive", [
+        .optional(1, .float), .optional(2, TSP_Point.self), .optional(3, .bool), .optional(4, TSP_Reference.self),
+        .optional(5, TSP_Reference.self), .optional(6, .bool), .optional(7, TSP_Size.self), .optional(9, .bool),
+        .optional(10, .bool), .optional(11, .bool), .optional(12, .bool), .optional(13, .bool), .optional(14, .int32),
+        .optional(15, .float), .optional(16, TSP_Point.self), .optional(17, TSP_Size.self), .optional(18, .string),
+        .optional(19, .bool), .optional(20, .uint32), .optional(21, .float), .optional(22, .float),
+        .optional(23, .bool), .optional(24, .bool), .optional(25, TSK_SelectionPathArchive.self), .optional(26, .bool),
+        .optional(27, .bool), .optional(28, .bool), .optional(29, TSK_SelectionPathArchive.self),
+        .optional(30, .string), .optional(31, .int32), .optional(32, TSP_Reference.self), .optional(33, .int32),
+        .optional(34, .bool), .optional(35, TSP_Reference.self), .optional(36, .float),
+        .optional(37, TSP_Reference.self), .optional(38, .bool), .optional(39, .bool), .optional(40, .bool),
+        .optional(41, TSP_Reference.self), .optional(42, .bool), .optional(43, TP_MailMergeSettingsArchive.self),
+        .optional(44, .bool), .optional(45, .float), .optional(46, .float),
+        .optional(47, TSK_SelectionPathArchive.self), .optional(48, .float),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 47)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var obsoleteViewScale: Float? { get { self[0] } set { self[0] = newValue } }
+    var visibleRectOrigin: TSP_Point? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var obsoleteLandscape: Bool? { get { self[2] } set { self[2] = newValue } }
+    var selection: TSP_Reference? { get { self[message: 3] } set { self[message: 3] = newValue } }
+    var selectionModel: TSP_Reference? { get { self[message: 4] } set { self[message: 4] = newValue } }
+    var sectionTemplateDrawablesSelectable: Bool? { get { self[5] } set { self[5] = newValue } }
+    var visibleRectSize: TSP_Size? { get { self[message: 6] } set { self[message: 6] = newValue } }
+    var rulerVisible: Bool? { get { self[7] } set { self[7] = newValue } }
+    var layoutBordersVisible: Bool? { get { self[8] } set { self[8] = newValue } }
+    var wordCountHudVisible: Bool? { get { self[9] } set { self[9] = newValue } }
+    var showsComments: Bool? { get { self[10] } set { self[10] = newValue } }
+    var showsPageNavigator: Bool? { get { self[11] } set { self[11] = newValue } }
+    var viewScaleMode: Int32? { get { self[12] } set { self[12] = newValue } }
+    var viewScale: Float? { get { self[13] } set { self[13] = newValue } }
+    var windowFrameOrigin: TSP_Point? { get { self[message: 14] } set { self[message: 14] = newValue } }
+    var windowFrameSize: TSP_Size? { get { self[message: 15] } set { self[message: 15] = newValue } }
+    var selectedInspectorSwitchSegmentIdentifier: String? { get { self[16] } set { self[16] = newValue } }
+    var inspectorHidden: Bool? { get { self[17] } set { self[17] = newValue } }
+    var wordCountHudType: UInt32? { get { self[18] } set { self[18] = newValue } }
+    var wordCountHudXPosition: Float? { get { self[19] } set { self[19] = newValue } }
+    var wordCountHudYPosition: Float? { get { self[20] } set { self[20] = newValue } }
+    var showUserDefinedGuides: Bool? { get { self[21] } set { self[21] = newValue } }
+    var shouldShowCommentSidebar: Bool? { get { self[22] } set { self[22] = newValue } }
+    var compatibilitySelectionPath: TSK_SelectionPathArchive? { get { self[message: 23] } set { self[message: 23] = newValue } }
+    var showsCtmarkup: Bool? { get { self[24] } set { self[24] = newValue } }
+    var showsCtdeletions: Bool? { get { self[25] } set { self[25] = newValue } }
+    var changeTrackingPaused: Bool? { get { self[26] } set { self[26] = newValue } }
+    var compatibility2SelectionPath: TSK_SelectionPathArchive? { get { self[message: 27] } set { self[message: 27] = newValue } }
+    var filteredAuthorName: String? { get { self[28] } set { self[28] = newValue } }
+    var viewScaleModeIos: Int32? { get { self[29] } set { self[29] = newValue } }
+    var filteredAuthor: TSP_Reference? { get { self[message: 30] } set { self[message: 30] = newValue } }
+    var pageViewState: Int32? { get { self[31] } set { self[31] = newValue } }
+    var pencilAnnotationsHidden: Bool? { get { self[32] } set { self[32] = newValue } }
+    var freehandDrawingToolkitState: TSP_Reference? { get { self[message: 33] } set { self[message: 33] = newValue } }
+    var presentationAutoScrollSpeed: Float? { get { self[34] } set { self[34] = newValue } }
+    var selectionPathTransformer: TSP_Reference? { get { self[message: 35] } set { self[message: 35] = newValue } }
+    var showsTocNavigator: Bool? { get { self[36] } set { self[36] = newValue } }
+    var showUserDefinedPageTemplateGuides: Bool? { get { self[37] } set { self[37] = newValue } }
+    var editingDisabled: Bool? { get { self[38] } set { self[38] = newValue } }
+    var pencilAnnotationUiState: TSP_Reference? { get { self[message: 39] } set { self[message: 39] = newValue } }
+    var showsFlowMode: Bool? { get { self[40] } set { self[40] = newValue } }
+    var mailMergeSettings: TP_MailMergeSettingsArchive? { get { self[message: 41] } set { self[message: 41] = newValue } }
+    var showsActivityStream: Bool? { get { self[42] } set { self[42] = newValue } }
+    var tocOrPageNavWidth: Float? { get { self[43] } set { self[43] = newValue } }
+    var activityOrAnnotationWidth: Float? { get { self[44] } set { self[44] = newValue } }
+    var selectionPath: TSK_SelectionPathArchive? { get { self[message: 45] } set { self[message: 45] = newValue } }
+    var flowModeFontScale: Float? { get { self[46] } set { self[46] = newValue } }
 }
 
 /// Generated wire model for `TP.ViewStateRootArchive`.
 final class TP_ViewStateRootArchive: IWAMessage {
-    var layoutState: TSP_Reference?
-    var viewState: TSP_Reference?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TP.ViewStateRootArchive", [
+        .optional(1, TSP_Reference.self), .optional(2, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { layoutState = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { viewState = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = layoutState { _w.bytesField(1, _x.encoded()) }
-        if let _x = viewState { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var layoutState: TSP_Reference? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var viewState: TSP_Reference? { get { self[message: 1] } set { self[message: 1] = newValue } }
 }
 
 /// Generated wire model for `TP.UserDefinedGuideMapArchive`.
 final class TP_UserDefinedGuideMapArchive: IWAMessage {
-    var userDefinedGuideStorages: [TP_UserDefinedGuideMapArchive_UserDefinedGuide] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TP.UserDefinedGuideMapArchive", [
+        .repeated(1, TP_UserDefinedGuideMapArchive_UserDefinedGuide.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TP_UserDefinedGuideMapArchive_UserDefinedGuide?
-            if case .lengthDelimited(let _b) = _f.value { _v = TP_UserDefinedGuideMapArchive_UserDefinedGuide(ProtobufMessage(_b)) }
-            if let _v { userDefinedGuideStorages.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in userDefinedGuideStorages { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var userDefinedGuideStorages: [TP_UserDefinedGuideMapArchive_UserDefinedGuide] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(userDefinedGuideStorages value: TP_UserDefinedGuideMapArchive_UserDefinedGuide) { append(value, toMessages: 0) }
 }
 
 /// Generated wire model for `TP.UserDefinedGuideMapArchive.UserDefinedGuide`.
 final class TP_UserDefinedGuideMapArchive_UserDefinedGuide: IWAMessage {
-    var pageIndex: UInt32?
-    var guideStorage: TSP_Reference?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TP.UserDefinedGuideMapArchive.UserDefinedGuide", [
+        .optional(1, .uint32), .optional(2, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { pageIndex = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { guideStorage = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = pageIndex { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = guideStorage { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var pageIndex: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var guideStorage: TSP_Reference? { get { self[message: 1] } set { self[message: 1] = newValue } }
 }
 
 /// Generated wire model for `TP.SectionSelectionArchive`.
 final class TP_SectionSelectionArchive: IWAMessage {
-    var sections: [TSP_Reference] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TP.SectionSelectionArchive", [
+        .repeated(1, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { sections.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in sections { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var sections: [TSP_Reference] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(sections value: TSP_Reference) { append(value, toMessages: 0) }
 }
 
 /// Generated wire model for `TP.SectionSelectionTransformerArchive`.
 final class TP_SectionSelectionTransformerArchive: IWAMessage {
-    var originalSelection: TSP_Reference?
-    var storageUuidPath: TSP_UUIDPath?
-    var sectionUuidPaths: [TSP_UUIDPath] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TP.SectionSelectionTransformerArchive", [
+        .optional(1, TSP_Reference.self), .optional(2, TSP_UUIDPath.self), .repeated(3, TSP_UUIDPath.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { originalSelection = _v }
-        case 2:
-            var _v: TSP_UUIDPath?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUIDPath(ProtobufMessage(_b)) }
-            if let _v { storageUuidPath = _v }
-        case 3:
-            var _v: TSP_UUIDPath?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUIDPath(ProtobufMessage(_b)) }
-            if let _v { sectionUuidPaths.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = originalSelection { _w.bytesField(1, _x.encoded()) }
-        if let _x = storageUuidPath { _w.bytesField(2, _x.encoded()) }
-        for _x in sectionUuidPaths { _w.bytesField(3, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var originalSelection: TSP_Reference? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var storageUuidPath: TSP_UUIDPath? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var sectionUuidPaths: [TSP_UUIDPath] { get { self[messages: 2] } set { self[messages: 2] = newValue } }
+    func append(sectionUuidPaths value: TSP_UUIDPath) { append(value, toMessages: 2) }
 }
 
 /// Generated wire model for `TP.SectionPasteboardObjectArchive`.
 final class TP_SectionPasteboardObjectArchive: IWAMessage {
-    var textStorage: TSP_Reference?
-    var pageCount: UInt32?
-    var pageDrawables: [TP_SectionPasteboardObjectArchive_PageDrawables] = []
-    var orderedDrawables: [TSP_Reference] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TP.SectionPasteboardObjectArchive", [
+        .optional(1, TSP_Reference.self), .optional(2, .uint32),
+        .repeated(3, TP_SectionPasteboardObjectArchive_PageDrawables.self), .repeated(4, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { textStorage = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { pageCount = _v }
-        case 3:
-            var _v: TP_SectionPasteboardObjectArchive_PageDrawables?
-            if case .lengthDelimited(let _b) = _f.value { _v = TP_SectionPasteboardObjectArchive_PageDrawables(ProtobufMessage(_b)) }
-            if let _v { pageDrawables.append(_v) }
-        case 4:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { orderedDrawables.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = textStorage { _w.bytesField(1, _x.encoded()) }
-        if let _x = pageCount { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        for _x in pageDrawables { _w.bytesField(3, _x.encoded()) }
-        for _x in orderedDrawables { _w.bytesField(4, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var textStorage: TSP_Reference? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var pageCount: UInt32? { get { self[1] } set { self[1] = newValue } }
+    var pageDrawables: [TP_SectionPasteboardObjectArchive_PageDrawables] { get { self[messages: 2] } set { self[messages: 2] = newValue } }
+    func append(pageDrawables value: TP_SectionPasteboardObjectArchive_PageDrawables) { append(value, toMessages: 2) }
+    var orderedDrawables: [TSP_Reference] { get { self[messages: 3] } set { self[messages: 3] = newValue } }
+    func append(orderedDrawables value: TSP_Reference) { append(value, toMessages: 3) }
 }
 
 /// Generated wire model for `TP.SectionPasteboardObjectArchive.PageDrawables`.
 final class TP_SectionPasteboardObjectArchive_PageDrawables: IWAMessage {
-    var pageIndex: UInt32?
-    var drawableTagPairs: TP_DrawableTagPairsArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TP.SectionPasteboardObjectArchive.PageDrawables", [
+        .optional(1, .uint32), .optional(2, TP_DrawableTagPairsArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { pageIndex = _v }
-        case 2:
-            var _v: TP_DrawableTagPairsArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TP_DrawableTagPairsArchive(ProtobufMessage(_b)) }
-            if let _v { drawableTagPairs = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = pageIndex { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = drawableTagPairs { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var pageIndex: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var drawableTagPairs: TP_DrawableTagPairsArchive? { get { self[message: 1] } set { self[message: 1] = newValue } }
 }
 
 /// Generated wire model for `TP.SectionsAppNativeObjectArchive`.
 final class TP_SectionsAppNativeObjectArchive: IWAMessage {
-    var sectionPasteboardObjects: [TSP_Reference] = []
-    var pageTemplates: [TP_SectionsAppNativeObjectArchive_PageTemplatesEntry] = []
-    var flows: [TSP_Reference] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TP.SectionsAppNativeObjectArchive", [
+        .repeated(1, TSP_Reference.self), .repeated(2, TP_SectionsAppNativeObjectArchive_PageTemplatesEntry.self),
+        .repeated(3, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { sectionPasteboardObjects.append(_v) }
-        case 2:
-            var _v: TP_SectionsAppNativeObjectArchive_PageTemplatesEntry?
-            if case .lengthDelimited(let _b) = _f.value { _v = TP_SectionsAppNativeObjectArchive_PageTemplatesEntry(ProtobufMessage(_b)) }
-            if let _v { pageTemplates.append(_v) }
-        case 3:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { flows.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in sectionPasteboardObjects { _w.bytesField(1, _x.encoded()) }
-        for _x in pageTemplates { _w.bytesField(2, _x.encoded()) }
-        for _x in flows { _w.bytesField(3, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var sectionPasteboardObjects: [TSP_Reference] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(sectionPasteboardObjects value: TSP_Reference) { append(value, toMessages: 0) }
+    var pageTemplates: [TP_SectionsAppNativeObjectArchive_PageTemplatesEntry] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(pageTemplates value: TP_SectionsAppNativeObjectArchive_PageTemplatesEntry) { append(value, toMessages: 1) }
+    var flows: [TSP_Reference] { get { self[messages: 2] } set { self[messages: 2] = newValue } }
+    func append(flows value: TSP_Reference) { append(value, toMessages: 2) }
 }
 
 /// Generated wire model for `TP.SectionsAppNativeObjectArchive.PageTemplatesEntry`.
 final class TP_SectionsAppNativeObjectArchive_PageTemplatesEntry: IWAMessage {
-    var key: TSP_UUID?
-    var value: TSP_Reference?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TP.SectionsAppNativeObjectArchive.PageTemplatesEntry", [
+        .optional(1, TSP_UUID.self), .optional(2, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { key = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { value = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = key { _w.bytesField(1, _x.encoded()) }
-        if let _x = value { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var key: TSP_UUID? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var value: TSP_Reference? { get { self[message: 1] } set { self[message: 1] = newValue } }
 }
 
 /// Generated wire model for `TP.MailMergeSettingsArchive`.
 final class TP_MailMergeSettingsArchive: IWAMessage {
-    var substituteClosest: Bool?
-    var dataHasHeaderRow: Bool?
-    var currentDataSource: Int32?
-    var contactsGroupIdentifier: String?
-    var numbersDocumentUrl: String?
-    var numbersTableUuid: TSP_UUID?
-    var numbersBookmarkData: [UInt8]?
-    var numbersDataSource: TP_MailMergeSettingsArchive_NumbersDataSourceArchive?
-    var mergingNumbersDataSource: TP_MailMergeSettingsArchive_NumbersDataSourceArchive?
-    var contactsFieldsMap: [TP_MailMergeSettingsArchive_ContactsFieldsMapEntry] = []
-    var numbersFieldsMap: [TP_MailMergeSettingsArchive_NumbersFieldsMapEntry] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { substituteClosest = _v }
-        case 2:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { dataHasHeaderRow = _v }
-        case 3:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { currentDataSource = _v }
-        case 4:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { contactsGroupIdentifier = _v }
-        case 5:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { numbersDocumentUrl = _v }
-        case 6:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { numbersTableUuid = _v }
-        case 7:
-            var _v: [UInt8]?
-            if case .lengthDelimited(let _b) = _f.value { _v = _b }
-            if let _v { numbersBookmarkData = _v }
-        case 8:
-            var _v: TP_MailMergeSettingsArchive_NumbersDataSourceArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TP_MailMergeSettingsArchive_NumbersDataSourceArchive(ProtobufMessage(_b)) }
-            if let _v { numbersDataSource = _v }
-        case 9:
-            var _v: TP_MailMergeSettingsArchive_NumbersDataSourceArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TP_MailMergeSettingsArchive_NumbersDataSourceArchive(ProtobufMessage(_b)) }
-            if let _v { mergingNumbersDataSource = _v }
-        case 10:
-            var _v: TP_MailMergeSettingsArchive_ContactsFieldsMapEntry?
-            if case .lengthDelimited(let _b) = _f.value { _v = TP_MailMergeSettingsArchive_ContactsFieldsMapEntry(ProtobufMessage(_b)) }
-            if let _v { contactsFieldsMap.append(_v) }
-        case 11:
-            var _v: TP_MailMergeSettingsArchive_NumbersFieldsMapEntry?
-            if case .lengthDelimited(let _b) = _f.value { _v = TP_MailMergeSettingsArchive_NumbersFieldsMapEntry(ProtobufMessage(_b)) }
-            if let _v { numbersFieldsMap.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = substituteClosest { _w.varintField(1, _x ? 1 : 0) }
-        if let _x = dataHasHeaderRow { _w.varintField(2, _x ? 1 : 0) }
-        if let _x = currentDataSource { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = contactsGroupIdentifier { _w.stringField(4, _x) }
-        if let _x = numbersDocumentUrl { _w.stringField(5, _x) }
-        if let _x = numbersTableUuid { _w.bytesField(6, _x.encoded()) }
-        if let _x = numbersBookmarkData { _w.bytesField(7, _x) }
-        if let _x = numbersDataSource { _w.bytesField(8, _x.encoded()) }
-        if let _x = mergingNumbersDataSource { _w.bytesField(9, _x.encoded()) }
-        for _x in contactsFieldsMap { _w.bytesField(10, _x.encoded()) }
-        for _x in numbersFieldsMap { _w.bytesField(11, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TP.MailMergeSettingsArchive", [
+        .optional(1, .bool), .optional(2, .bool), .optional(3, .int32), .optional(4, .string), .optional(5, .string),
+        .optional(6, TSP_UUID.self), .optional(7, .bytes),
+        .optional(8, TP_MailMergeSettingsArchive_NumbersDataSourceArchive.self),
+        .optional(9, TP_MailMergeSettingsArchive_NumbersDataSourceArchive.self),
+        .repeated(10, TP_MailMergeSettingsArchive_ContactsFieldsMapEntry.self),
+        .repeated(11, TP_MailMergeSettingsArchive_NumbersFieldsMapEntry.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 11)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var substituteClosest: Bool? { get { self[0] } set { self[0] = newValue } }
+    var dataHasHeaderRow: Bool? { get { self[1] } set { self[1] = newValue } }
+    var currentDataSource: Int32? { get { self[2] } set { self[2] = newValue } }
+    var contactsGroupIdentifier: String? { get { self[3] } set { self[3] = newValue } }
+    var numbersDocumentUrl: String? { get { self[4] } set { self[4] = newValue } }
+    var numbersTableUuid: TSP_UUID? { get { self[message: 5] } set { self[message: 5] = newValue } }
+    var numbersBookmarkData: [UInt8]? { get { self[6] } set { self[6] = newValue } }
+    var numbersDataSource: TP_MailMergeSettingsArchive_NumbersDataSourceArchive? { get { self[message: 7] } set { self[message: 7] = newValue } }
+    var mergingNumbersDataSource: TP_MailMergeSettingsArchive_NumbersDataSourceArchive? { get { self[message: 8] } set { self[message: 8] = newValue } }
+    var contactsFieldsMap: [TP_MailMergeSettingsArchive_ContactsFieldsMapEntry] { get { self[messages: 9] } set { self[messages: 9] = newValue } }
+    func append(contactsFieldsMap value: TP_MailMergeSettingsArchive_ContactsFieldsMapEntry) { append(value, toMessages: 9) }
+    var numbersFieldsMap: [TP_MailMergeSettingsArchive_NumbersFieldsMapEntry] { get { self[messages: 10] } set { self[messages: 10] = newValue } }
+    func append(numbersFieldsMap value: TP_MailMergeSettingsArchive_NumbersFieldsMapEntry) { append(value, toMessages: 10) }
 }
 
 /// Generated wire model for `TP.MailMergeSettingsArchive.NumbersDataSourceArchive`.
 final class TP_MailMergeSettingsArchive_NumbersDataSourceArchive: IWAMessage {
-    var bookmarkData: [UInt8]?
-    var tableUuid: TSP_UUID?
-    var documentUuid: TSP_UUID?
-    var mergeFieldTypes: [TSWP_MergeFieldTypeArchive] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TP.MailMergeSettingsArchive.NumbersDataSourceArchive", [
+        .optional(1, .bytes), .optional(2, TSP_UUID.self), .optional(4, TSP_UUID.self),
+        .repeated(3, TSWP_MergeFieldTypeArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: [UInt8]?
-            if case .lengthDelimited(let _b) = _f.value { _v = _b }
-            if let _v { bookmarkData = _v }
-        case 2:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { tableUuid = _v }
-        case 4:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { documentUuid = _v }
-        case 3:
-            var _v: TSWP_MergeFieldTypeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_MergeFieldTypeArchive(ProtobufMessage(_b)) }
-            if let _v { mergeFieldTypes.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = bookmarkData { _w.bytesField(1, _x) }
-        if let _x = tableUuid { _w.bytesField(2, _x.encoded()) }
-        if let _x = documentUuid { _w.bytesField(4, _x.encoded()) }
-        for _x in mergeFieldTypes { _w.bytesField(3, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var bookmarkData: [UInt8]? { get { self[0] } set { self[0] = newValue } }
+    var tableUuid: TSP_UUID? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var documentUuid: TSP_UUID? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var mergeFieldTypes: [TSWP_MergeFieldTypeArchive] { get { self[messages: 3] } set { self[messages: 3] = newValue } }
+    func append(mergeFieldTypes value: TSWP_MergeFieldTypeArchive) { append(value, toMessages: 3) }
 }
 
 /// Generated wire model for `TP.MailMergeSettingsArchive.ContactsFieldsMapEntry`.
 final class TP_MailMergeSettingsArchive_ContactsFieldsMapEntry: IWAMessage {
-    var key: String?
-    var value: TSWP_MergeFieldTypeArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TP.MailMergeSettingsArchive.ContactsFieldsMapEntry", [
+        .optional(1, .string), .optional(2, TSWP_MergeFieldTypeArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { key = _v }
-        case 2:
-            var _v: TSWP_MergeFieldTypeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_MergeFieldTypeArchive(ProtobufMessage(_b)) }
-            if let _v { value = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = key { _w.stringField(1, _x) }
-        if let _x = value { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var key: String? { get { self[0] } set { self[0] = newValue } }
+    var value: TSWP_MergeFieldTypeArchive? { get { self[message: 1] } set { self[message: 1] = newValue } }
 }
 
 /// Generated wire model for `TP.MailMergeSettingsArchive.NumbersFieldsMapEntry`.
 final class TP_MailMergeSettingsArchive_NumbersFieldsMapEntry: IWAMessage {
-    var key: String?
-    var value: TSWP_MergeFieldTypeArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TP.MailMergeSettingsArchive.NumbersFieldsMapEntry", [
+        .optional(1, .string), .optional(2, TSWP_MergeFieldTypeArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { key = _v }
-        case 2:
-            var _v: TSWP_MergeFieldTypeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_MergeFieldTypeArchive(ProtobufMessage(_b)) }
-            if let _v { value = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = key { _w.stringField(1, _x) }
-        if let _x = value { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var key: String? { get { self[0] } set { self[0] = newValue } }
+    var value: TSWP_MergeFieldTypeArchive? { get { self[message: 1] } set { self[message: 1] = newValue } }
 }
 
 /// Registers this file's archives into the reflective catalog.
-func registerIWA_TPArchives(_ into: inout [(name: String, decode: (ProtobufMessage) -> IWAMessage)]) {
-    into.append(("TP.DocumentArchive", { TP_DocumentArchive($0) as IWAMessage }))
-    into.append(("TP.ThemeArchive", { TP_ThemeArchive($0) as IWAMessage }))
-    into.append(("TP.SettingsArchive", { TP_SettingsArchive($0) as IWAMessage }))
-    into.append(("TP.PlaceholderArchive", { TP_PlaceholderArchive($0) as IWAMessage }))
-    into.append(("TP.DrawableTagPairsArchive", { TP_DrawableTagPairsArchive($0) as IWAMessage }))
-    into.append(("TP.DrawableTagPairsArchive.DrawableTagPair", { TP_DrawableTagPairsArchive_DrawableTagPair($0) as IWAMessage }))
-    into.append(("TP.FloatingDrawablesArchive", { TP_FloatingDrawablesArchive($0) as IWAMessage }))
-    into.append(("TP.FloatingDrawablesArchive.DrawableEntry", { TP_FloatingDrawablesArchive_DrawableEntry($0) as IWAMessage }))
-    into.append(("TP.FloatingDrawablesArchive.PageGroup", { TP_FloatingDrawablesArchive_PageGroup($0) as IWAMessage }))
-    into.append(("TP.DrawablesZOrderArchive", { TP_DrawablesZOrderArchive($0) as IWAMessage }))
-    into.append(("TP.SectionTemplateArchive", { TP_SectionTemplateArchive($0) as IWAMessage }))
-    into.append(("TP.PageTemplateArchive", { TP_PageTemplateArchive($0) as IWAMessage }))
-    into.append(("TP.PageTemplateArchive.TagDrawablePair", { TP_PageTemplateArchive_TagDrawablePair($0) as IWAMessage }))
-    into.append(("TP.SectionArchive", { TP_SectionArchive($0) as IWAMessage }))
-    into.append(("TP.DoublePoint", { TP_DoublePoint($0) as IWAMessage }))
-    into.append(("TP.DoubleSize", { TP_DoubleSize($0) as IWAMessage }))
-    into.append(("TP.AnchorPosArchive", { TP_AnchorPosArchive($0) as IWAMessage }))
-    into.append(("TP.TargetHintArchive", { TP_TargetHintArchive($0) as IWAMessage }))
-    into.append(("TP.PageHintArchive", { TP_PageHintArchive($0) as IWAMessage }))
-    into.append(("TP.NullChildHintArchive", { TP_NullChildHintArchive($0) as IWAMessage }))
-    into.append(("TP.SectionHintArchive", { TP_SectionHintArchive($0) as IWAMessage }))
-    into.append(("TP.TextboxHintArchive", { TP_TextboxHintArchive($0) as IWAMessage }))
-    into.append(("TP.TopicNumberHintLevelDataArchive", { TP_TopicNumberHintLevelDataArchive($0) as IWAMessage }))
-    into.append(("TP.TopicNumberHintEntryArchive", { TP_TopicNumberHintEntryArchive($0) as IWAMessage }))
-    into.append(("TP.TopicNumberHintsArchive", { TP_TopicNumberHintsArchive($0) as IWAMessage }))
-    into.append(("TP.LayoutStateArchive", { TP_LayoutStateArchive($0) as IWAMessage }))
-    into.append(("TP.CanvasSelectionArchive", { TP_CanvasSelectionArchive($0) as IWAMessage }))
-    into.append(("TP.AllFootnoteSelectionArchive", { TP_AllFootnoteSelectionArchive($0) as IWAMessage }))
-    into.append(("TP.UIStateArchive", { TP_UIStateArchive($0) as IWAMessage }))
-    into.append(("TP.ViewStateRootArchive", { TP_ViewStateRootArchive($0) as IWAMessage }))
-    into.append(("TP.UserDefinedGuideMapArchive", { TP_UserDefinedGuideMapArchive($0) as IWAMessage }))
-    into.append(("TP.UserDefinedGuideMapArchive.UserDefinedGuide", { TP_UserDefinedGuideMapArchive_UserDefinedGuide($0) as IWAMessage }))
-    into.append(("TP.SectionSelectionArchive", { TP_SectionSelectionArchive($0) as IWAMessage }))
-    into.append(("TP.SectionSelectionTransformerArchive", { TP_SectionSelectionTransformerArchive($0) as IWAMessage }))
-    into.append(("TP.SectionPasteboardObjectArchive", { TP_SectionPasteboardObjectArchive($0) as IWAMessage }))
-    into.append(("TP.SectionPasteboardObjectArchive.PageDrawables", { TP_SectionPasteboardObjectArchive_PageDrawables($0) as IWAMessage }))
-    into.append(("TP.SectionsAppNativeObjectArchive", { TP_SectionsAppNativeObjectArchive($0) as IWAMessage }))
-    into.append(("TP.SectionsAppNativeObjectArchive.PageTemplatesEntry", { TP_SectionsAppNativeObjectArchive_PageTemplatesEntry($0) as IWAMessage }))
-    into.append(("TP.MailMergeSettingsArchive", { TP_MailMergeSettingsArchive($0) as IWAMessage }))
-    into.append(("TP.MailMergeSettingsArchive.NumbersDataSourceArchive", { TP_MailMergeSettingsArchive_NumbersDataSourceArchive($0) as IWAMessage }))
-    into.append(("TP.MailMergeSettingsArchive.ContactsFieldsMapEntry", { TP_MailMergeSettingsArchive_ContactsFieldsMapEntry($0) as IWAMessage }))
-    into.append(("TP.MailMergeSettingsArchive.NumbersFieldsMapEntry", { TP_MailMergeSettingsArchive_NumbersFieldsMapEntry($0) as IWAMessage }))
+func registerIWA_TPArchives(_ into: inout [any IWAMessage.Type]) {
+    into += [
+        TP_DocumentArchive.self, TP_ThemeArchive.self, TP_SettingsArchive.self, TP_PlaceholderArchive.self,
+        TP_DrawableTagPairsArchive.self, TP_DrawableTagPairsArchive_DrawableTagPair.self,
+        TP_FloatingDrawablesArchive.self, TP_FloatingDrawablesArchive_DrawableEntry.self,
+        TP_FloatingDrawablesArchive_PageGroup.self, TP_DrawablesZOrderArchive.self, TP_SectionTemplateArchive.self,
+        TP_PageTemplateArchive.self, TP_PageTemplateArchive_TagDrawablePair.self, TP_SectionArchive.self,
+        TP_DoublePoint.self, TP_DoubleSize.self, TP_AnchorPosArchive.self, TP_TargetHintArchive.self,
+        TP_PageHintArchive.self, TP_NullChildHintArchive.self, TP_SectionHintArchive.self, TP_TextboxHintArchive.self,
+        TP_TopicNumberHintLevelDataArchive.self, TP_TopicNumberHintEntryArchive.self, TP_TopicNumberHintsArchive.self,
+        TP_LayoutStateArchive.self, TP_CanvasSelectionArchive.self, TP_AllFootnoteSelectionArchive.self,
+        TP_UIStateArchive.self, TP_ViewStateRootArchive.self, TP_UserDefinedGuideMapArchive.self,
+        TP_UserDefinedGuideMapArchive_UserDefinedGuide.self, TP_SectionSelectionArchive.self,
+        TP_SectionSelectionTransformerArchive.self, TP_SectionPasteboardObjectArchive.self,
+        TP_SectionPasteboardObjectArchive_PageDrawables.self, TP_SectionsAppNativeObjectArchive.self,
+        TP_SectionsAppNativeObjectArchive_PageTemplatesEntry.self, TP_MailMergeSettingsArchive.self,
+        TP_MailMergeSettingsArchive_NumbersDataSourceArchive.self,
+        TP_MailMergeSettingsArchive_ContactsFieldsMapEntry.self, TP_MailMergeSettingsArchive_NumbersFieldsMapEntry.self,
+    ]
 }
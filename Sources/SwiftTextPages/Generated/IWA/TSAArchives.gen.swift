@@ -5,1673 +5,622 @@ import SwiftTextIWA
 
 /// Generated wire model for `TSA.DocumentArchive`.
 final class TSA_DocumentArchive: IWAMessage {
-    var `super`: TSK_DocumentArchive?
-    var textPresetDisplayItems: [TSWP_TextPresetDisplayItemArchive] = []
-    var documentLanguage: String?
-    var calculationEngine: TSP_Reference?
-    var viewState: TSP_Reference?
-    var functionBrowserState: TSP_Reference?
-    var tablesCustomFormatList: TSP_Reference?
-    var needsMediaCompatibilityUpgrade: Bool?
-    var templateIdentifier: String?
-    var shortcutController: TSP_Reference?
-    var annotationCacheDeprecated: TSP_Reference?
-    var customFormatList: TSP_Reference?
-    var annotationCacheDeprecated2: TSP_Reference?
-    var collaborativeMediaCompatibilityUpgradeDidFail: Bool?
-    var canUseHevc: Bool?
-    var isContentSource: Bool?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSK_DocumentArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_DocumentArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: TSWP_TextPresetDisplayItemArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_TextPresetDisplayItemArchive(ProtobufMessage(_b)) }
-            if let _v { textPresetDisplayItems.append(_v) }
-        case 3:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { documentLanguage = _v }
-        case 4:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { calculationEngine = _v }
-        case 5:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { viewState = _v }
-        case 6:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { functionBrowserState = _v }
-        case 7:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { tablesCustomFormatList = _v }
-        case 8:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { needsMediaCompatibilityUpgrade = _v }
-        case 9:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { templateIdentifier = _v }
-        case 10:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { shortcutController = _v }
-        case 11:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { annotationCacheDeprecated = _v }
-        case 12:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { customFormatList = _v }
-        case 13:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { annotationCacheDeprecated2 = _v }
-        case 14:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { collaborativeMediaCompatibilityUpgradeDidFail = _v }
-        case 15:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { canUseHevc = _v }
-        case 16:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { isContentSource = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        for _x in textPresetDisplayItems { _w.bytesField(2, _x.encoded()) }
-        if let _x = documentLanguage { _w.stringField(3, _x) }
-        if let _x = calculationEngine { _w.bytesField(4, _x.encoded()) }
-        if let _x = viewState { _w.bytesField(5, _x.encoded()) }
-        if let _x = functionBrowserState { _w.bytesField(6, _x.encoded()) }
-        if let _x = tablesCustomFormatList { _w.bytesField(7, _x.encoded()) }
-        if let _x = needsMediaCompatibilityUpgrade { _w.varintField(8, _x ? 1 : 0) }
-        if let _x = templateIdentifier { _w.stringField(9, _x) }
-        if let _x = shortcutController { _w.bytesField(10, _x.encoded()) }
-        if let _x = annotationCacheDeprecated { _w.bytesField(11, _x.encoded()) }
-        if let _x = customFormatList { _w.bytesField(12, _x.encoded()) }
-        if let _x = annotationCacheDeprecated2 { _w.bytesField(13, _x.encoded()) }
-        if let _x = collaborativeMediaCompatibilityUpgradeDidFail { _w.varintField(14, _x ? 1 : 0) }
-        if let _x = canUseHevc { _w.varintField(15, _x ? 1 : 0) }
-        if let _x = isContentSource { _w.varintField(16, _x ? 1 : 0) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSA.DocumentArchive", [
+        .optional(1, TSK_DocumentArchive.self), .repeated(2, TSWP_TextPresetDisplayItemArchive.self),
+        .optional(3, .string), .optional(4, TSP_Reference.self), .optional(5, TSP_Reference.self),
+        .optional(6, TSP_Reference.self), .optional(7, TSP_Reference.self), .optional(8, .bool), .optional(9, .string),
+        .optional(10, TSP_Reference.self), .optional(11, TSP_Reference.self), .optional(12, TSP_Reference.self),
+        .optional(13, TSP_Reference.self), .optional(14, .bool), .optional(15, .bool), .optional(16, .bool),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 16)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var `super`: TSK_DocumentArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var textPresetDisplayItems: [TSWP_TextPresetDisplayItemArchive] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(textPresetDisplayItems value: TSWP_TextPresetDisplayItemArchive) { append(value, toMessages: 1) }
+    var documentLanguage: String? { get { self[2] } set { self[2] = newValue } }
+    var calculationEngine: TSP_Reference? { get { self[message: 3] } set { self[message: 3] = newValue } }
+    var viewState: TSP_Reference? { get { self[message: 4] } set { self[message: 4] = newValue } }
+    var functionBrowserState: TSP_Reference? { get { self[message: 5] } set { self[message: 5] = newValue } }
+    var tablesCustomFormatList: TSP_Reference? { get { self[message: 6] } set { self[message: 6] = newValue } }
+    var needsMediaCompatibilityUpgrade: Bool? { get { self[7] } set { self[7] = newValue } }
+    var templateIdentifier: String? { get { self[8] } set { self[8] = newValue } }
+    var shortcutController: TSP_Reference? { get { self[message: 9] } set { self[message: 9] = newValue } }
+    var annotationCacheDeprecated: TSP_Reference? { get { self[message: 10] } set { self[message: 10] = newValue } }
+    var customFormatList: TSP_Reference? { get { self[message: 11] } set { self[message: 11] = newValue } }
+    var annotationCacheDeprecated2: TSP_Reference? { get { self[message: 12] } set { self[message: 12] = newValue } }
+    var collaborativeMediaCompatibilityUpgradeDidFail: Bool? { get { self[13] } set { self[13] = newValue } }
+    var canUseHevc: Bool? { get { self[14] } set { self[14] = newValue } }
+    var isContentSource: Bool? { get { self[15] } set { self[15] = newValue } }
 }
 
 /// Generated wire model for `TSA.FunctionBrowserStateArchive`.
 final class TSA_FunctionBrowserStateArchive: IWAMessage {
-    var recentFunctions: [UInt32] = []
-    var backFunctions: [UInt32] = []
-    var forwardFunctions: [UInt32] = []
-    var currentFunction: UInt32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSA.FunctionBrowserStateArchive", [
+        .repeated(1, .uint32), .repeated(2, .uint32), .repeated(3, .uint32), .optional(4, .uint32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            if case .varint(let _u) = _f.value { recentFunctions.append(UInt32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { recentFunctions.append(UInt32(truncatingIfNeeded: _u)) } }
-        case 2:
-            if case .varint(let _u) = _f.value { backFunctions.append(UInt32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { backFunctions.append(UInt32(truncatingIfNeeded: _u)) } }
-        case 3:
-            if case .varint(let _u) = _f.value { forwardFunctions.append(UInt32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { forwardFunctions.append(UInt32(truncatingIfNeeded: _u)) } }
-        case 4:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { currentFunction = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in recentFunctions { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        for _x in backFunctions { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        for _x in forwardFunctions { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = currentFunction { _w.varintField(4, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var recentFunctions: [UInt32] { get { self[all: 0] } set { self[all: 0] = newValue } }
+    func append(recentFunctions value: UInt32) { append(value, toAll: 0) }
+    var backFunctions: [UInt32] { get { self[all: 1] } set { self[all: 1] = newValue } }
+    func append(backFunctions value: UInt32) { append(value, toAll: 1) }
+    var forwardFunctions: [UInt32] { get { self[all: 2] } set { self[all: 2] = newValue } }
+    func append(forwardFunctions value: UInt32) { append(value, toAll: 2) }
+    var currentFunction: UInt32? { get { self[3] } set { self[3] = newValue } }
 }
 
 /// Generated wire model for `TSA.ThemePresetsArchive`.
 final class TSA_ThemePresetsArchive: IWAMessage {
-    var captionStylePresets: [TSP_Reference] = []
-    var svgImportStylePresets: [TSP_Reference] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSA.ThemePresetsArchive", [
+        .repeated(1, TSP_Reference.self), .repeated(2, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { captionStylePresets.append(_v) }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { svgImportStylePresets.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in captionStylePresets { _w.bytesField(1, _x.encoded()) }
-        for _x in svgImportStylePresets { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var captionStylePresets: [TSP_Reference] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(captionStylePresets value: TSP_Reference) { append(value, toMessages: 0) }
+    var svgImportStylePresets: [TSP_Reference] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(svgImportStylePresets value: TSP_Reference) { append(value, toMessages: 1) }
 }
 
 /// Generated wire model for `TSA.ShortcutControllerArchive`.
 final class TSA_ShortcutControllerArchive: IWAMessage {
-    var entries: [TSA_ShortcutControllerArchive_ShortcutMapEntry] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSA.ShortcutControllerArchive", [
+        .repeated(1, TSA_ShortcutControllerArchive_ShortcutMapEntry.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSA_ShortcutControllerArchive_ShortcutMapEntry?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSA_ShortcutControllerArchive_ShortcutMapEntry(ProtobufMessage(_b)) }
-            if let _v { entries.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in entries { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var entries: [TSA_ShortcutControllerArchive_ShortcutMapEntry] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(entries value: TSA_ShortcutControllerArchive_ShortcutMapEntry) { append(value, toMessages: 0) }
 }
 
 /// Generated wire model for `TSA.ShortcutControllerArchive.ShortcutMapEntry`.
 final class TSA_ShortcutControllerArchive_ShortcutMapEntry: IWAMessage {
-    var shortcut: String?
-    var style: TSP_Reference?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSA.ShortcutControllerArchive.ShortcutMapEntry", [
+        .optional(1, .string), .optional(2, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { shortcut = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { style = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = shortcut { _w.stringField(1, _x) }
-        if let _x = style { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var shortcut: String? { get { self[0] } set { self[0] = newValue } }
+    var style: TSP_Reference? { get { self[message: 1] } set { self[message: 1] = newValue } }
 }
 
 /// Generated wire model for `TSA.PropagatePresetCommandArchive`.
 final class TSA_PropagatePresetCommandArchive: IWAMessage {
-    var `super`: TSK_CommandArchive?
-    var presetChangeCommand: TSP_Reference?
-    var alwaysPreserveAppearance: Bool?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSA.PropagatePresetCommandArchive", [
+        .optional(1, TSK_CommandArchive.self), .optional(2, TSP_Reference.self), .optional(3, .bool),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSK_CommandArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_CommandArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { presetChangeCommand = _v }
-        case 3:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { alwaysPreserveAppearance = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = presetChangeCommand { _w.bytesField(2, _x.encoded()) }
-        if let _x = alwaysPreserveAppearance { _w.varintField(3, _x ? 1 : 0) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var `super`: TSK_CommandArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var presetChangeCommand: TSP_Reference? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var alwaysPreserveAppearance: Bool? { get { self[2] } set { self[2] = newValue } }
 }
 
 /// Generated wire model for `TSA.ShortcutCommandArchive`.
 final class TSA_ShortcutCommandArchive: IWAMessage {
-    var `super`: TSK_CommandArchive?
-    var oldStyle: TSP_Reference?
-    var newStyle: TSP_Reference?
-    var oldShortcut: String?
-    var newShortcut: String?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSA.ShortcutCommandArchive", [
+        .optional(1, TSK_CommandArchive.self), .optional(2, TSP_Reference.self), .optional(3, TSP_Reference.self),
+        .optional(4, .string), .optional(5, .string),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 5)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSK_CommandArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_CommandArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { oldStyle = _v }
-        case 3:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { newStyle = _v }
-        case 4:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { oldShortcut = _v }
-        case 5:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { newShortcut = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = oldStyle { _w.bytesField(2, _x.encoded()) }
-        if let _x = newStyle { _w.bytesField(3, _x.encoded()) }
-        if let _x = oldShortcut { _w.stringField(4, _x) }
-        if let _x = newShortcut { _w.stringField(5, _x) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var `super`: TSK_CommandArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var oldStyle: TSP_Reference? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var newStyle: TSP_Reference? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var oldShortcut: String? { get { self[3] } set { self[3] = newValue } }
+    var newShortcut: String? { get { self[4] } set { self[4] = newValue } }
 }
 
 /// Generated wire model for `TSA.AddCustomFormatCommandArchive`.
 final class TSA_AddCustomFormatCommandArchive: IWAMessage {
-    var `super`: TSK_CommandArchive?
-    var customFormat: TSK_CustomFormatArchive?
-    var customFormatKey: TSP_UUID?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSA.AddCustomFormatCommandArchive", [
+        .optional(1, TSK_CommandArchive.self), .optional(2, TSK_CustomFormatArchive.self), .optional(3, TSP_UUID.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSK_CommandArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_CommandArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: TSK_CustomFormatArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_CustomFormatArchive(ProtobufMessage(_b)) }
-            if let _v { customFormat = _v }
-        case 3:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { customFormatKey = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = customFormat { _w.bytesField(2, _x.encoded()) }
-        if let _x = customFormatKey { _w.bytesField(3, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var `super`: TSK_CommandArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var customFormat: TSK_CustomFormatArchive? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var customFormatKey: TSP_UUID? { get { self[message: 2] } set { self[message: 2] = newValue } }
 }
 
 /// Generated wire model for `TSA.UpdateCustomFormatCommandArchive`.
 final class TSA_UpdateCustomFormatCommandArchive: IWAMessage {
-    var `super`: TSK_CommandArchive?
-    var customFormat: TSK_CustomFormatArchive?
-    var oldCustomFormat: TSK_CustomFormatArchive?
-    var customFormatKey: TSP_UUID?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSA.UpdateCustomFormatCommandArchive", [
+        .optional(1, TSK_CommandArchive.self), .optional(2, TSK_CustomFormatArchive.self),
+        .optional(3, TSK_CustomFormatArchive.self), .optional(4, TSP_UUID.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSK_CommandArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_CommandArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: TSK_CustomFormatArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_CustomFormatArchive(ProtobufMessage(_b)) }
-            if let _v { customFormat = _v }
-        case 3:
-            var _v: TSK_CustomFormatArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_CustomFormatArchive(ProtobufMessage(_b)) }
-            if let _v { oldCustomFormat = _v }
-        case 4:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { customFormatKey = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = customFormat { _w.bytesField(2, _x.encoded()) }
-        if let _x = oldCustomFormat { _w.bytesField(3, _x.encoded()) }
-        if let _x = customFormatKey { _w.bytesField(4, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var `super`: TSK_CommandArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var customFormat: TSK_CustomFormatArchive? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var oldCustomFormat: TSK_CustomFormatArchive? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var customFormatKey: TSP_UUID? { get { self[message: 3] } set { self[message: 3] = newValue } }
 }
 
 /// Generated wire model for `TSA.ReplaceCustomFormatCommandArchive`.
 final class TSA_ReplaceCustomFormatCommandArchive: IWAMessage {
-    var `super`: TSK_CommandArchive?
-    var customFormat: TSK_CustomFormatArchive?
-    var customFormatKey: TSP_UUID?
-    var replacementFormat: TSK_FormatStructArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSA.ReplaceCustomFormatCommandArchive", [
+        .optional(1, TSK_CommandArchive.self), .optional(2, TSK_CustomFormatArchive.self), .optional(3, TSP_UUID.self),
+        .optional(4, TSK_FormatStructArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSK_CommandArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_CommandArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: TSK_CustomFormatArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_CustomFormatArchive(ProtobufMessage(_b)) }
-            if let _v { customFormat = _v }
-        case 3:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { customFormatKey = _v }
-        case 4:
-            var _v: TSK_FormatStructArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_FormatStructArchive(ProtobufMessage(_b)) }
-            if let _v { replacementFormat = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = customFormat { _w.bytesField(2, _x.encoded()) }
-        if let _x = customFormatKey { _w.bytesField(3, _x.encoded()) }
-        if let _x = replacementFormat { _w.bytesField(4, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var `super`: TSK_CommandArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var customFormat: TSK_CustomFormatArchive? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var customFormatKey: TSP_UUID? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var replacementFormat: TSK_FormatStructArchive? { get { self[message: 3] } set { self[message: 3] = newValue } }
 }
 
 /// Generated wire model for `TSA.NeedsMediaCompatibilityUpgradeCommandArchive`.
 final class TSA_NeedsMediaCompatibilityUpgradeCommandArchive: IWAMessage {
-    var `super`: TSK_CommandArchive?
-    var needsMediaCompatibilityUpgrade: Bool?
-    var oldNeedsMediaCompatibilityUpgrade: Bool?
-    var collaborativeMediaCompatibilityUpgradeDidFail: Bool?
-    var oldCollaborativeMediaCompatibilityUpgradeDidFail: Bool?
-    var canUseHevc: Bool?
-    var oldCanUseHevc: Bool?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSA.NeedsMediaCompatibilityUpgradeCommandArchive", [
+        .optional(1, TSK_CommandArchive.self), .optional(2, .bool), .optional(3, .bool), .optional(4, .bool),
+        .optional(5, .bool), .optional(6, .bool), .optional(7, .bool),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 7)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSK_CommandArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_CommandArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { needsMediaCompatibilityUpgrade = _v }
-        case 3:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { oldNeedsMediaCompatibilityUpgrade = _v }
-        case 4:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { collaborativeMediaCompatibilityUpgradeDidFail = _v }
-        case 5:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { oldCollaborativeMediaCompatibilityUpgradeDidFail = _v }
-        case 6:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { canUseHevc = _v }
-        case 7:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { oldCanUseHevc = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = needsMediaCompatibilityUpgrade { _w.varintField(2, _x ? 1 : 0) }
-        if let _x = oldNeedsMediaCompatibilityUpgrade { _w.varintField(3, _x ? 1 : 0) }
-        if let _x = collaborativeMediaCompatibilityUpgradeDidFail { _w.varintField(4, _x ? 1 : 0) }
-        if let _x = oldCollaborativeMediaCompatibilityUpgradeDidFail { _w.varintField(5, _x ? 1 : 0) }
-        if let _x = canUseHevc { _w.varintField(6, _x ? 1 : 0) }
-        if let _x = oldCanUseHevc { _w.varintField(7, _x ? 1 : 0) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var `super`: TSK_CommandArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var needsMediaCompatibilityUpgrade: Bool? { get { self[1] } set { self[1] = newValue } }
+    var oldNeedsMediaCompatibilityUpgrade: Bool? { get { self[2] } set { self[2] = newValue } }
+    var collaborativeMediaCompatibilityUpgradeDidFail: Bool? { get { self[3] } set { self[3] = newValue } }
+    var oldCollaborativeMediaCompatibilityUpgradeDidFail: Bool? { get { self[4] } set { self[4] = newValue } }
+    var canUseHevc: Bool? { get { self[5] } set { self[5] = newValue } }
+    var oldCanUseHevc: Bool? { get { self[6] } set { self[6] = newValue } }
 }
 
 /// Generated wire model for `TSA.ChangeDocumentLocaleCommandArchive`.
 final class TSA_ChangeDocumentLocaleCommandArchive: IWAMessage {
-    var `super`: TSK_CommandArchive?
-    var oldLocaleId: String?
-    var newLocaleId: String?
-    var oldFormattingSymbols: TSK_FormattingSymbolsArchive?
-    var newFormattingSymbols: TSK_FormattingSymbolsArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSA.ChangeDocumentLocaleCommandArchive", [
+        .optional(1, TSK_CommandArchive.self), .optional(2, .string), .optional(3, .string),
+        .optional(4, TSK_FormattingSymbolsArchive.self), .optional(5, TSK_FormattingSymbolsArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 5)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSK_CommandArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_CommandArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { oldLocaleId = _v }
-        case 3:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { newLocaleId = _v }
-        case 4:
-            var _v: TSK_FormattingSymbolsArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_FormattingSymbolsArchive(ProtobufMessage(_b)) }
-            if let _v { oldFormattingSymbols = _v }
-        case 5:
-            var _v: TSK_FormattingSymbolsArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_FormattingSymbolsArchive(ProtobufMessage(_b)) }
-            if let _v { newFormattingSymbols = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = oldLocaleId { _w.stringField(2, _x) }
-        if let _x = newLocaleId { _w.stringField(3, _x) }
-        if let _x = oldFormattingSymbols { _w.bytesField(4, _x.encoded()) }
-        if let _x = newFormattingSymbols { _w.bytesField(5, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var `super`: TSK_CommandArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var oldLocaleId: String? { get { self[1] } set { self[1] = newValue } }
+    var newLocaleId: String? { get { self[2] } set { self[2] = newValue } }
+    var oldFormattingSymbols: TSK_FormattingSymbolsArchive? { get { self[message: 3] } set { self[message: 3] = newValue } }
+    var newFormattingSymbols: TSK_FormattingSymbolsArchive? { get { self[message: 4] } set { self[message: 4] = newValue } }
 }
 
 /// Generated wire model for `TSA.InducedVerifyObjectsWithServerCommandArchive`.
 final class TSA_InducedVerifyObjectsWithServerCommandArchive: IWAMessage {
-    var `super`: TSK_CommandArchive?
-    var objectIdList: [TSP_UUID] = []
-    var objectIdListUndefined: Bool?
-    var serverObjectSOSStringList: [String] = []
-    var serverObjectSOSStringListUndefined: Bool?
-    var pendingRecalc: Bool?
-    var remoteDataSyncKey: Double?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSA.InducedVerifyObjectsWithServerCommandArchive", [
+        .optional(1, TSK_CommandArchive.self), .repeated(2, TSP_UUID.self), .optional(3, .bool), .repeated(4, .string),
+        .optional(5, .bool), .optional(6, .bool), .optional(7, .double),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 7)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSK_CommandArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_CommandArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { objectIdList.append(_v) }
-        case 3:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { objectIdListUndefined = _v }
-        case 4:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { serverObjectSOSStringList.append(_v) }
-        case 5:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { serverObjectSOSStringListUndefined = _v }
-        case 6:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { pendingRecalc = _v }
-        case 7:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { remoteDataSyncKey = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        for _x in objectIdList { _w.bytesField(2, _x.encoded()) }
-        if let _x = objectIdListUndefined { _w.varintField(3, _x ? 1 : 0) }
-        for _x in serverObjectSOSStringList { _w.stringField(4, _x) }
-        if let _x = serverObjectSOSStringListUndefined { _w.varintField(5, _x ? 1 : 0) }
-        if let _x = pendingRecalc { _w.varintField(6, _x ? 1 : 0) }
-        if let _x = remoteDataSyncKey { _w.fixed64Field(7, _x.bitPattern) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var `super`: TSK_CommandArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var objectIdList: [TSP_UUID] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(objectIdList value: TSP_UUID) { append(value, toMessages: 1) }
+    var objectIdListUndefined: Bool? { get { self[2] } set { self[2] = newValue } }
+    var serverObjectSOSStringList: [String] { get { self[all: 3] } set { self[all: 3] = newValue } }
+    func append(serverObjectSOSStringList value: String) { append(value, toAll: 3) }
+    var serverObjectSOSStringListUndefined: Bool? { get { self[4] } set { self[4] = newValue } }
+    var pendingRecalc: Bool? { get { self[5] } set { self[5] = newValue } }
+    var remoteDataSyncKey: Double? { get { self[6] } set { self[6] = newValue } }
 }
 
 /// Generated wire model for `TSA.InducedVerifyTransformHistoryWithServerCommandArchive`.
 final class TSA_InducedVerifyTransformHistoryWithServerCommandArchive: IWAMessage {
-    var `super`: TSK_CommandArchive?
-    var serverOperationStorageEntries: [TSK_OperationStorageEntry] = []
-    var serverOperationStorageEntriesUndefined: Bool?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSA.InducedVerifyTransformHistoryWithServerCommandArchive", [
+        .optional(1, TSK_CommandArchive.self), .repeated(2, TSK_OperationStorageEntry.self), .optional(3, .bool),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSK_CommandArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_CommandArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: TSK_OperationStorageEntry?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_OperationStorageEntry(ProtobufMessage(_b)) }
-            if let _v { serverOperationStorageEntries.append(_v) }
-        case 3:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { serverOperationStorageEntriesUndefined = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        for _x in serverOperationStorageEntries { _w.bytesField(2, _x.encoded()) }
-        if let _x = serverOperationStorageEntriesUndefined { _w.varintField(3, _x ? 1 : 0) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var `super`: TSK_CommandArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var serverOperationStorageEntries: [TSK_OperationStorageEntry] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(serverOperationStorageEntries value: TSK_OperationStorageEntry) { append(value, toMessages: 1) }
+    var serverOperationStorageEntriesUndefined: Bool? { get { self[2] } set { self[2] = newValue } }
 }
 
 /// Generated wire model for `TSA.StyleUpdatePropertyMapCommandArchive`.
 final class TSA_StyleUpdatePropertyMapCommandArchive: IWAMessage {
-
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSA.StyleUpdatePropertyMapCommandArchive", [])
+    var _values = [IWAValue](repeating: .absent, count: 0)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
 }
 
 /// Generated wire model for `TSA.RemoteDataChangeCommandArchive`.
 final class TSA_RemoteDataChangeCommandArchive: IWAMessage {
-    var `super`: TSK_CommandArchive?
-    var valueMap: TSCE_RemoteDataValueMapArchive?
-    var quotes: [TSCE_StockArchive] = []
-    var remoteDataSyncKey: Double?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSA.RemoteDataChangeCommandArchive", [
+        .optional(1, TSK_CommandArchive.self), .optional(2, TSCE_RemoteDataValueMapArchive.self),
+        .repeated(3, TSCE_StockArchive.self), .optional(4, .double),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSK_CommandArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_CommandArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: TSCE_RemoteDataValueMapArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_RemoteDataValueMapArchive(ProtobufMessage(_b)) }
-            if let _v { valueMap = _v }
-        case 3:
-            var _v: TSCE_StockArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_StockArchive(ProtobufMessage(_b)) }
-            if let _v { quotes.append(_v) }
-        case 4:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { remoteDataSyncKey = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = valueMap { _w.bytesField(2, _x.encoded()) }
-        for _x in quotes { _w.bytesField(3, _x.encoded()) }
-        if let _x = remoteDataSyncKey { _w.fixed64Field(4, _x.bitPattern) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var `super`: TSK_CommandArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var valueMap: TSCE_RemoteDataValueMapArchive? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var quotes: [TSCE_StockArchive] { get { self[messages: 2] } set { self[messages: 2] = newValue } }
+    func append(quotes value: TSCE_StockArchive) { append(value, toMessages: 2) }
+    var remoteDataSyncKey: Double? { get { self[3] } set { self[3] = newValue } }
 }
 
 /// Generated wire model for `TSA.GalleryInfoSetValueCommandArchive`.
 final class TSA_GalleryInfoSetValueCommandArchive: IWAMessage {
-    var `super`: TSK_CommandArchive?
-    var infoIdPath: TSP_UUIDPath?
-    var property: Int32?
-    var value: TSA_GalleryInfoSetValueCommandArchive_PropertyValue?
-    var oldValue: TSA_GalleryInfoSetValueCommandArchive_PropertyValue?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSA.GalleryInfoSetValueCommandArchive", [
+        .optional(1, TSK_CommandArchive.self), .optional(2, TSP_UUIDPath.self), .optional(3, .int32),
+        .optional(4, TSA_GalleryInfoSetValueCommandArchive_PropertyValue.self),
+        .optional(5, TSA_GalleryInfoSetValueCommandArchive_PropertyValue.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 5)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSK_CommandArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_CommandArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: TSP_UUIDPath?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUIDPath(ProtobufMessage(_b)) }
-            if let _v { infoIdPath = _v }
-        case 3:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { property = _v }
-        case 4:
-            var _v: TSA_GalleryInfoSetValueCommandArchive_PropertyValue?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSA_GalleryInfoSetValueCommandArchive_PropertyValue(ProtobufMessage(_b)) }
-            if let _v { value = _v }
-        case 5:
-            var _v: TSA_GalleryInfoSetValueCommandArchive_PropertyValue?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSA_GalleryInfoSetValueCommandArchive_PropertyValue(ProtobufMessage(_b)) }
-            if let _v { oldValue = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = infoIdPath { _w.bytesField(2, _x.encoded()) }
-        if let _x = property { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = value { _w.bytesField(4, _x.encoded()) }
-        if let _x = oldValue { _w.bytesField(5, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var `super`: TSK_CommandArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var infoIdPath: TSP_UUIDPath? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var property: Int32? { get { self[2] } set { self[2] = newValue } }
+    var value: TSA_GalleryInfoSetValueCommandArchive_PropertyValue? { get { self[message: 3] } set { self[message: 3] = newValue } }
+    var oldValue: TSA_GalleryInfoSetValueCommandArchive_PropertyValue? { get { self[message: 4] } set { self[message: 4] = newValue } }
 }
 
 /// Generated wire model for `TSA.GalleryInfoSetValueCommandArchive.PropertyValue`.
 final class TSA_GalleryInfoSetValueCommandArchive_PropertyValue: IWAMessage {
-    var captionMode: Int32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSA.GalleryInfoSetValueCommandArchive.PropertyValue", [
+        .optional(1, .int32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { captionMode = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = captionMode { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var captionMode: Int32? { get { self[0] } set { self[0] = newValue } }
 }
 
 /// Generated wire model for `TSA.GalleryInfoInsertItemsCommandArchive`.
 final class TSA_GalleryInfoInsertItemsCommandArchive: IWAMessage {
-    var items: [TSP_Reference] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSA.GalleryInfoInsertItemsCommandArchive", [
+        .repeated(2, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { items.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in items { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var items: [TSP_Reference] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(items value: TSP_Reference) { append(value, toMessages: 0) }
 }
 
 /// Generated wire model for `TSA.GalleryInfoRemoveItemsCommandArchive`.
 final class TSA_GalleryInfoRemoveItemsCommandArchive: IWAMessage {
-
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSA.GalleryInfoRemoveItemsCommandArchive", [])
+    var _values = [IWAValue](repeating: .absent, count: 0)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
 }
 
 /// Generated wire model for `TSA.GalleryItemSetGeometryCommand`.
 final class TSA_GalleryItemSetGeometryCommand: IWAMessage {
-    var `super`: TSK_CommandArchive?
-    var itemIdPath: TSP_UUIDPath?
-    var offset: TSP_Point?
-    var scale: Float?
-    var oldOffset: TSP_Point?
-    var oldScale: Float?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSA.GalleryItemSetGeometryCommand", [
+        .optional(1, TSK_CommandArchive.self), .optional(2, TSP_UUIDPath.self), .optional(3, TSP_Point.self),
+        .optional(4, .float), .optional(5, TSP_Point.self), .optional(6, .float),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 6)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSK_CommandArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_CommandArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: TSP_UUIDPath?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUIDPath(ProtobufMessage(_b)) }
-            if let _v { itemIdPath = _v }
-        case 3:
-            var _v: TSP_Point?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Point(ProtobufMessage(_b)) }
-            if let _v { offset = _v }
-        case 4:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { scale = _v }
-        case 5:
-            var _v: TSP_Point?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Point(ProtobufMessage(_b)) }
-            if let _v { oldOffset = _v }
-        case 6:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { oldScale = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = itemIdPath { _w.bytesField(2, _x.encoded()) }
-        if let _x = offset { _w.bytesField(3, _x.encoded()) }
-        if let _x = scale { _w.fixed32Field(4, _x.bitPattern) }
-        if let _x = oldOffset { _w.bytesField(5, _x.encoded()) }
-        if let _x = oldScale { _w.fixed32Field(6, _x.bitPattern) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var `super`: TSK_CommandArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var itemIdPath: TSP_UUIDPath? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var offset: TSP_Point? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var scale: Float? { get { self[3] } set { self[3] = newValue } }
+    var oldOffset: TSP_Point? { get { self[message: 4] } set { self[message: 4] = newValue } }
+    var oldScale: Float? { get { self[5] } set { self[5] = newValue } }
 }
 
 /// Generated wire model for `TSA.GalleryItem`.
 final class TSA_GalleryItem: IWAMessage {
-    var offset: TSP_Point?
-    var scale: Float?
-    var imageData: TSP_DataReference?
-    var thumbnailImageData: TSP_DataReference?
-    var imageAdjustments: TSD_ImageAdjustmentsArchive?
-    var adjustedImageData: TSP_DataReference?
-    var thumbnailAdjustedImageData: TSP_DataReference?
-    var captionStorage: TSP_Reference?
-    var accessibilityDescription: String?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSA.GalleryItem", [
+        .optional(1, TSP_Point.self), .optional(2, .float), .optional(3, TSP_DataReference.self),
+        .optional(4, TSP_DataReference.self), .optional(5, TSD_ImageAdjustmentsArchive.self),
+        .optional(6, TSP_DataReference.self), .optional(7, TSP_DataReference.self), .optional(8, TSP_Reference.self),
+        .optional(9, .string),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 9)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Point?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Point(ProtobufMessage(_b)) }
-            if let _v { offset = _v }
-        case 2:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { scale = _v }
-        case 3:
-            var _v: TSP_DataReference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_DataReference(ProtobufMessage(_b)) }
-            if let _v { imageData = _v }
-        case 4:
-            var _v: TSP_DataReference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_DataReference(ProtobufMessage(_b)) }
-            if let _v { thumbnailImageData = _v }
-        case 5:
-            var _v: TSD_ImageAdjustmentsArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_ImageAdjustmentsArchive(ProtobufMessage(_b)) }
-            if let _v { imageAdjustments = _v }
-        case 6:
-            var _v: TSP_DataReference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_DataReference(ProtobufMessage(_b)) }
-            if let _v { adjustedImageData = _v }
-        case 7:
-            var _v: TSP_DataReference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_DataReference(ProtobufMessage(_b)) }
-            if let _v { thumbnailAdjustedImageData = _v }
-        case 8:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { captionStorage = _v }
-        case 9:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { accessibilityDescription = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = offset { _w.bytesField(1, _x.encoded()) }
-        if let _x = scale { _w.fixed32Field(2, _x.bitPattern) }
-        if let _x = imageData { _w.bytesField(3, _x.encoded()) }
-        if let _x = thumbnailImageData { _w.bytesField(4, _x.encoded()) }
-        if let _x = imageAdjustments { _w.bytesField(5, _x.encoded()) }
-        if let _x = adjustedImageData { _w.bytesField(6, _x.encoded()) }
-        if let _x = thumbnailAdjustedImageData { _w.bytesField(7, _x.encoded()) }
-        if let _x = captionStorage { _w.bytesField(8, _x.encoded()) }
-        if let _x = accessibilityDescription { _w.stringField(9, _x) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var offset: TSP_Point? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var scale: Float? { get { self[1] } set { self[1] = newValue } }
+    var imageData: TSP_DataReference? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var thumbnailImageData: TSP_DataReference? { get { self[message: 3] } set { self[message: 3] = newValue } }
+    var imageAdjustments: TSD_ImageAdjustmentsArchive? { get { self[message: 4] } set { self[message: 4] = newValue } }
+    var adjustedImageData: TSP_DataReference? { get { self[message: 5] } set { self[message: 5] = newValue } }
+    var thumbnailAdjustedImageData: TSP_DataReference? { get { self[message: 6] } set { self[message: 6] = newValue } }
+    var captionStorage: TSP_Reference? { get { self[message: 7] } set { self[message: 7] = newValue } }
+    var accessibilityDescription: String? { get { self[8] } set { self[8] = newValue } }
 }
 
 /// Generated wire model for `TSA.GalleryInfo`.
 final class TSA_GalleryInfo: IWAMessage {
-    var items: [TSP_Reference] = []
-    var captionMode: Int32?
-    var captionStorage: TSP_Reference?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSA.GalleryInfo", [
+        .repeated(1, TSP_Reference.self), .optional(2, .int32), .optional(3, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { items.append(_v) }
-        case 2:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { captionMode = _v }
-        case 3:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { captionStorage = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in items { _w.bytesField(1, _x.encoded()) }
-        if let _x = captionMode { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = captionStorage { _w.bytesField(3, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var items: [TSP_Reference] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(items value: TSP_Reference) { append(value, toMessages: 0) }
+    var captionMode: Int32? { get { self[1] } set { self[1] = newValue } }
+    var captionStorage: TSP_Reference? { get { self[message: 2] } set { self[message: 2] = newValue } }
 }
 
 /// Generated wire model for `TSA.GallerySelectionTransformer`.
 final class TSA_GallerySelectionTransformer: IWAMessage {
-    var galleryUuidPath: TSP_UUIDPath?
-    var captionStorageUuidPath: TSP_UUIDPath?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSA.GallerySelectionTransformer", [
+        .optional(2, TSP_UUIDPath.self), .optional(3, TSP_UUIDPath.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 2:
-            var _v: TSP_UUIDPath?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUIDPath(ProtobufMessage(_b)) }
-            if let _v { galleryUuidPath = _v }
-        case 3:
-            var _v: TSP_UUIDPath?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUIDPath(ProtobufMessage(_b)) }
-            if let _v { captionStorageUuidPath = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = galleryUuidPath { _w.bytesField(2, _x.encoded()) }
-        if let _x = captionStorageUuidPath { _w.bytesField(3, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var galleryUuidPath: TSP_UUIDPath? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var captionStorageUuidPath: TSP_UUIDPath? { get { self[message: 1] } set { self[message: 1] = newValue } }
 }
 
 /// Generated wire model for `TSA.GalleryItemSelection`.
 final class TSA_GalleryItemSelection: IWAMessage {
-    var displayedItem: TSP_Reference?
-    var items: [TSP_Reference] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSA.GalleryItemSelection", [
+        .optional(1, TSP_Reference.self), .repeated(2, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { displayedItem = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { items.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = displayedItem { _w.bytesField(1, _x.encoded()) }
-        for _x in items { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var displayedItem: TSP_Reference? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var items: [TSP_Reference] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(items value: TSP_Reference) { append(value, toMessages: 1) }
 }
 
 /// Generated wire model for `TSA.GalleryItemSelectionTransformer`.
 final class TSA_GalleryItemSelectionTransformer: IWAMessage {
-    var transformerHelper: TSA_GalleryItemSelectionTransformerHelper?
-    var captionStorageUuidPath: TSP_UUIDPath?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSA.GalleryItemSelectionTransformer", [
+        .optional(1, TSA_GalleryItemSelectionTransformerHelper.self), .optional(2, TSP_UUIDPath.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSA_GalleryItemSelectionTransformerHelper?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSA_GalleryItemSelectionTransformerHelper(ProtobufMessage(_b)) }
-            if let _v { transformerHelper = _v }
-        case 2:
-            var _v: TSP_UUIDPath?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUIDPath(ProtobufMessage(_b)) }
-            if let _v { captionStorageUuidPath = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = transformerHelper { _w.bytesField(1, _x.encoded()) }
-        if let _x = captionStorageUuidPath { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var transformerHelper: TSA_GalleryItemSelectionTransformerHelper? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var captionStorageUuidPath: TSP_UUIDPath? { get { self[message: 1] } set { self[message: 1] = newValue } }
 }
 
 /// Generated wire model for `TSA.GalleryItemSelectionTransformerHelper`.
 final class TSA_GalleryItemSelectionTransformerHelper: IWAMessage {
-    var displayedItemUuidPath: TSP_UUIDPath?
-    var itemUuidPaths: [TSP_UUIDPath] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSA.GalleryItemSelectionTransformerHelper", [
+        .optional(1, TSP_UUIDPath.self), .repeated(2, TSP_UUIDPath.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_UUIDPath?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUIDPath(ProtobufMessage(_b)) }
-            if let _v { displayedItemUuidPath = _v }
-        case 2:
-            var _v: TSP_UUIDPath?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUIDPath(ProtobufMessage(_b)) }
-            if let _v { itemUuidPaths.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = displayedItemUuidPath { _w.bytesField(1, _x.encoded()) }
-        for _x in itemUuidPaths { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var displayedItemUuidPath: TSP_UUIDPath? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var itemUuidPaths: [TSP_UUIDPath] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(itemUuidPaths value: TSP_UUIDPath) { append(value, toMessages: 1) }
 }
 
 /// Generated wire model for `TSA.GalleryItemSetValueCommand`.
 final class TSA_GalleryItemSetValueCommand: IWAMessage {
-    var `super`: TSK_CommandArchive?
-    var itemIdPath: TSP_UUIDPath?
-    var property: Int32?
-    var value: TSA_GalleryItemSetValueCommand_PropertyValue?
-    var oldValue: TSA_GalleryItemSetValueCommand_PropertyValue?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSA.GalleryItemSetValueCommand", [
+        .optional(1, TSK_CommandArchive.self), .optional(2, TSP_UUIDPath.self), .optional(3, .int32),
+        .optional(4, TSA_GalleryItemSetValueCommand_PropertyValue.self),
+        .optional(5, TSA_GalleryItemSetValueCommand_PropertyValue.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 5)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSK_CommandArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_CommandArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: TSP_UUIDPath?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUIDPath(ProtobufMessage(_b)) }
-            if let _v { itemIdPath = _v }
-        case 3:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { property = _v }
-        case 4:
-            var _v: TSA_GalleryItemSetValueCommand_PropertyValue?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSA_GalleryItemSetValueCommand_PropertyValue(ProtobufMessage(_b)) }
-            if let _v { value = _v }
-        case 5:
-            var _v: TSA_GalleryItemSetValueCommand_PropertyValue?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSA_GalleryItemSetValueCommand_PropertyValue(ProtobufMessage(_b)) }
-            if let _v { oldValue = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = itemIdPath { _w.bytesField(2, _x.encoded()) }
-        if let _x = property { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = value { _w.bytesField(4, _x.encoded()) }
-        if let _x = oldValue { _w.bytesField(5, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var `super`: TSK_CommandArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var itemIdPath: TSP_UUIDPath? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var property: Int32? { get { self[2] } set { self[2] = newValue } }
+    var value: TSA_GalleryItemSetValueCommand_PropertyValue? { get { self[message: 3] } set { self[message: 3] = newValue } }
+    var oldValue: TSA_GalleryItemSetValueCommand_PropertyValue? { get { self[message: 4] } set { self[message: 4] = newValue } }
 }
 
 /// Generated wire model for `TSA.GalleryItemSetValueCommand.PropertyValue`.
 final class TSA_GalleryItemSetValueCommand_PropertyValue: IWAMessage {
-    var imageData: TSP_DataReference?
-    var accessibilityDescription: String?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSA.GalleryItemSetValueCommand.PropertyValue", [
+        .optional(1, TSP_DataReference.self), .optional(2, .string),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_DataReference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_DataReference(ProtobufMessage(_b)) }
-            if let _v { imageData = _v }
-        case 2:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { accessibilityDescription = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = imageData { _w.bytesField(1, _x.encoded()) }
-        if let _x = accessibilityDescription { _w.stringField(2, _x) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var imageData: TSP_DataReference? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var accessibilityDescription: String? { get { self[1] } set { self[1] = newValue } }
 }
 
 /// Generated wire model for `TSA.CollaboratorGalleryItemCursor`.
 final class TSA_CollaboratorGalleryItemCursor: IWAMessage {
-    var displayedItemId: TSP_UUID?
-    var itemIds: [TSP_UUID] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSA.CollaboratorGalleryItemCursor", [
+        .optional(1, TSP_UUID.self), .repeated(2, TSP_UUID.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { displayedItemId = _v }
-        case 2:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { itemIds.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = displayedItemId { _w.bytesField(1, _x.encoded()) }
-        for _x in itemIds { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var displayedItemId: TSP_UUID? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var itemIds: [TSP_UUID] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(itemIds value: TSP_UUID) { append(value, toMessages: 1) }
 }
 
 /// Generated wire model for `TSA.WebVideoInfo`.
 final class TSA_WebVideoInfo: IWAMessage {
-    var url: String?
-    var posterImageData: TSP_DataReference?
-    var attribution: TSD_Attribution?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSA.WebVideoInfo", [
+        .optional(1, .string), .optional(2, TSP_DataReference.self), .optional(3, TSD_Attribution.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { url = _v }
-        case 2:
-            var _v: TSP_DataReference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_DataReference(ProtobufMessage(_b)) }
-            if let _v { posterImageData = _v }
-        case 3:
-            var _v: TSD_Attribution?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_Attribution(ProtobufMessage(_b)) }
-            if let _v { attribution = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = url { _w.stringField(1, _x) }
-        if let _x = posterImageData { _w.bytesField(2, _x.encoded()) }
-        if let _x = attribution { _w.bytesField(3, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var url: String? { get { self[0] } set { self[0] = newValue } }
+    var posterImageData: TSP_DataReference? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var attribution: TSD_Attribution? { get { self[message: 2] } set { self[message: 2] = newValue } }
 }
 
 /// Generated wire model for `TSA.CaptionPlacementArchive`.
 final class TSA_CaptionPlacementArchive: IWAMessage {
-    var captionAnchorLocation: Int32?
-    var drawableAnchorLocation: Int32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSA.CaptionPlacementArchive", [
+        .optional(1, .int32), .optional(2, .int32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { captionAnchorLocation = _v }
-        case 2:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { drawableAnchorLocation = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = captionAnchorLocation { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = drawableAnchorLocation { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var captionAnchorLocation: Int32? { get { self[0] } set { self[0] = newValue } }
+    var drawableAnchorLocation: Int32? { get { self[1] } set { self[1] = newValue } }
 }
 
 /// Generated wire model for `TSA.CaptionInfoArchive`.
 final class TSA_CaptionInfoArchive: IWAMessage {
-    var `super`: TSWP_ShapeInfoArchive?
-    var placement: TSP_Reference?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSA.CaptionInfoArchive", [
+        .optional(1, TSWP_ShapeInfoArchive.self), .optional(2, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSWP_ShapeInfoArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_ShapeInfoArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { placement = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = placement { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var `super`: TSWP_ShapeInfoArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var placement: TSP_Reference? { get { self[message: 1] } set { self[message: 1] = newValue } }
 }
 
 /// Generated wire model for `TSA.TitlePlacementCommandArchive`.
 final class TSA_TitlePlacementCommandArchive: IWAMessage {
-    var placement: TSP_Reference?
-    var oldPlacement: TSP_Reference?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSA.TitlePlacementCommandArchive", [
+        .optional(3, TSP_Reference.self), .optional(4, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 3:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { placement = _v }
-        case 4:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { oldPlacement = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = placement { _w.bytesField(3, _x.encoded()) }
-        if let _x = oldPlacement { _w.bytesField(4, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var placement: TSP_Reference? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var oldPlacement: TSP_Reference? { get { self[message: 1] } set { self[message: 1] = newValue } }
 }
 
 /// Generated wire model for `TSA.Object3DInfo`.
 final class TSA_Object3DInfo: IWAMessage {
-    var objectData: TSP_DataReference?
-    var playsAnimations: Bool?
-    var pose3d: TSP_Pose3D?
-    var boundingrect: TSP_Rect?
-    var thumbnailImageData: TSP_DataReference?
-    var embeddedAnimations: Bool?
-    var tracedpath: TSP_Path?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSA.Object3DInfo", [
+        .optional(1, TSP_DataReference.self), .optional(2, .bool), .optional(3, TSP_Pose3D.self),
+        .optional(4, TSP_Rect.self), .optional(5, TSP_DataReference.self), .optional(6, .bool),
+        .optional(7, TSP_Path.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 7)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_DataReference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_DataReference(ProtobufMessage(_b)) }
-            if let _v { objectData = _v }
-        case 2:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { playsAnimations = _v }
-        case 3:
-            var _v: TSP_Pose3D?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Pose3D(ProtobufMessage(_b)) }
-            if let _v { pose3d = _v }
-        case 4:
-            var _v: TSP_Rect?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Rect(ProtobufMessage(_b)) }
-            if let _v { boundingrect = _v }
-        case 5:
-            var _v: TSP_DataReference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_DataReference(ProtobufMessage(_b)) }
-            if let _v { thumbnailImageData = _v }
-        case 6:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { embeddedAnimations = _v }
-        case 7:
-            var _v: TSP_Path?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Path(ProtobufMessage(_b)) }
-            if let _v { tracedpath = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = objectData { _w.bytesField(1, _x.encoded()) }
-        if let _x = playsAnimations { _w.varintField(2, _x ? 1 : 0) }
-        if let _x = pose3d { _w.bytesField(3, _x.encoded()) }
-        if let _x = boundingrect { _w.bytesField(4, _x.encoded()) }
-        if let _x = thumbnailImageData { _w.bytesField(5, _x.encoded()) }
-        if let _x = embeddedAnimations { _w.varintField(6, _x ? 1 : 0) }
-        if let _x = tracedpath { _w.bytesField(7, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var objectData: TSP_DataReference? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var playsAnimations: Bool? { get { self[1] } set { self[1] = newValue } }
+    var pose3d: TSP_Pose3D? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var boundingrect: TSP_Rect? { get { self[message: 3] } set { self[message: 3] = newValue } }
+    var thumbnailImageData: TSP_DataReference? { get { self[message: 4] } set { self[message: 4] = newValue } }
+    var embeddedAnimations: Bool? { get { self[5] } set { self[5] = newValue } }
+    var tracedpath: TSP_Path? { get { self[message: 6] } set { self[message: 6] = newValue } }
 }
 
 /// Generated wire model for `TSA.Object3DInfoCommandArchive`.
 final class TSA_Object3DInfoCommandArchive: IWAMessage {
-    var info: TSP_Reference?
-    var infoIdPath: TSP_UUIDPath?
-    var thumbnailImageData: TSP_DataReference?
-    var oldThumbnailImageData: TSP_DataReference?
-    var pose3d: TSP_Pose3D?
-    var oldPose3d: TSP_Pose3D?
-    var boundingrect: TSP_Rect?
-    var oldboundingrect: TSP_Rect?
-    var tracedpath: TSP_Path?
-    var oldtracedpath: TSP_Path?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSA.Object3DInfoCommandArchive", [
+        .optional(2, TSP_Reference.self), .optional(3, TSP_UUIDPath.self), .optional(4, TSP_DataReference.self),
+        .optional(5, TSP_DataReference.self), .optional(6, TSP_Pose3D.self), .optional(7, TSP_Pose3D.self),
+        .optional(8, TSP_Rect.self), .optional(9, TSP_Rect.self), .optional(10, TSP_Path.self),
+        .optional(11, TSP_Path.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 10)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { info = _v }
-        case 3:
-            var _v: TSP_UUIDPath?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUIDPath(ProtobufMessage(_b)) }
-            if let _v { infoIdPath = _v }
-        case 4:
-            var _v: TSP_DataReference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_DataReference(ProtobufMessage(_b)) }
-            if let _v { thumbnailImageData = _v }
-        case 5:
-            var _v: TSP_DataReference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_DataReference(ProtobufMessage(_b)) }
-            if let _v { oldThumbnailImageData = _v }
-        case 6:
-            var _v: TSP_Pose3D?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Pose3D(ProtobufMessage(_b)) }
-            if let _v { pose3d = _v }
-        case 7:
-            var _v: TSP_Pose3D?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Pose3D(ProtobufMessage(_b)) }
-            if let _v { oldPose3d = _v }
-        case 8:
-            var _v: TSP_Rect?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Rect(ProtobufMessage(_b)) }
-            if let _v { boundingrect = _v }
-        case 9:
-            var _v: TSP_Rect?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Rect(ProtobufMessage(_b)) }
-            if let _v { oldboundingrect = _v }
-        case 10:
-            var _v: TSP_Path?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Path(ProtobufMessage(_b)) }
-            if let _v { tracedpath = _v }
-        case 11:
-            var _v: TSP_Path?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Path(ProtobufMessage(_b)) }
-            if let _v { oldtracedpath = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = info { _w.bytesField(2, _x.encoded()) }
-        if let _x = infoIdPath { _w.bytesField(3, _x.encoded()) }
-        if let _x = thumbnailImageData { _w.bytesField(4, _x.encoded()) }
-        if let _x = oldThumbnailImageData { _w.bytesField(5, _x.encoded()) }
-        if let _x = pose3d { _w.bytesField(6, _x.encoded()) }
-        if let _x = oldPose3d { _w.bytesField(7, _x.encoded()) }
-        if let _x = boundingrect { _w.bytesField(8, _x.encoded()) }
-        if let _x = oldboundingrect { _w.bytesField(9, _x.encoded()) }
-        if let _x = tracedpath { _w.bytesField(10, _x.encoded()) }
-        if let _x = oldtracedpath { _w.bytesField(11, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var info: TSP_Reference? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var infoIdPath: TSP_UUIDPath? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var thumbnailImageData: TSP_DataReference? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var oldThumbnailImageData: TSP_DataReference? { get { self[message: 3] } set { self[message: 3] = newValue } }
+    var pose3d: TSP_Pose3D? { get { self[message: 4] } set { self[message: 4] = newValue } }
+    var oldPose3d: TSP_Pose3D? { get { self[message: 5] } set { self[message: 5] = newValue } }
+    var boundingrect: TSP_Rect? { get { self[message: 6] } set { self[message: 6] = newValue } }
+    var oldboundingrect: TSP_Rect? { get { self[message: 7] } set { self[message: 7] = newValue } }
+    var tracedpath: TSP_Path? { get { self[message: 8] } set { self[message: 8] = newValue } }
+    var oldtracedpath: TSP_Path? { get { self[message: 9] } set { self[message: 9] = newValue } }
 }
 
 /// Generated wire model for `TSA.Object3DInfoSetValueCommandArchive`.
 final class TSA_Object3DInfoSetValueCommandArchive: IWAMessage {
-    var `super`: TSK_CommandArchive?
-    var object3dInfoIdPath: TSP_UUIDPath?
-    var property: Int32?
-    var value: TSA_Object3DInfoSetValueCommandArchive_PropertyValue?
-    var oldValue: TSA_Object3DInfoSetValueCommandArchive_PropertyValue?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSA.Object3DInfoSetValueCommandArchive", [
+        .optional(1, TSK_CommandArchive.self), .optional(2, TSP_UUIDPath.self), .optional(3, .int32),
+        .optional(4, TSA_Object3DInfoSetValueCommandArchive_PropertyValue.self),
+        .optional(5, TSA_Object3DInfoSetValueCommandArchive_PropertyValue.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 5)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSK_CommandArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_CommandArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: TSP_UUIDPath?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUIDPath(ProtobufMessage(_b)) }
-            if let _v { object3dInfoIdPath = _v }
-        case 3:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { property = _v }
-        case 4:
-            var _v: TSA_Object3DInfoSetValueCommandArchive_PropertyValue?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSA_Object3DInfoSetValueCommandArchive_PropertyValue(ProtobufMessage(_b)) }
-            if let _v { value = _v }
-        case 5:
-            var _v: TSA_Object3DInfoSetValueCommandArchive_PropertyValue?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSA_Object3DInfoSetValueCommandArchive_PropertyValue(ProtobufMessage(_b)) }
-            if let _v { oldValue = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = object3dInfoIdPath { _w.bytesField(2, _x.encoded()) }
-        if let _x = property { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = value { _w.bytesField(4, _x.encoded()) }
-        if let _x = oldValue { _w.bytesField(5, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var `super`: TSK_CommandArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var object3dInfoIdPath: TSP_UUIDPath? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var property: Int32? { get { self[2] } set { self[2] = newValue } }
+    var value: TSA_Object3DInfoSetValueCommandArchive_PropertyValue? { get { self[message: 3] } set { self[message: 3] = newValue } }
+    var oldValue: TSA_Object3DInfoSetValueCommandArchive_PropertyValue? { get { self[message: 4] } set { self[message: 4] = newValue } }
 }
 
 /// Generated wire model for `TSA.Object3DInfoSetValueCommandArchive.PropertyValue`.
 final class TSA_Object3DInfoSetValueCommandArchive_PropertyValue: IWAMessage {
-    var playsAnimations: Bool?
-    var opacity: Float?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSA.Object3DInfoSetValueCommandArchive.PropertyValue", [
+        .optional(4, .bool), .optional(10, .float),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 4:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { playsAnimations = _v }
-        case 10:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { opacity = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = playsAnimations { _w.varintField(4, _x ? 1 : 0) }
-        if let _x = opacity { _w.fixed32Field(10, _x.bitPattern) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var playsAnimations: Bool? { get { self[0] } set { self[0] = newValue } }
+    var opacity: Float? { get { self[1] } set { self[1] = newValue } }
 }
 
 /// Registers this file's archives into the reflective catalog.
-func registerIWA_TSAArchives(_ into: inout [(name: String, decode: (ProtobufMessage) -> IWAMessage)]) {
-    into.append(("TSA.DocumentArchive", { TSA_DocumentArchive($0) as IWAMessage }))
-    into.append(("TSA.FunctionBrowserStateArchive", { TSA_FunctionBrowserStateArchive($0) as IWAMessage }))
-    into.append(("TSA.ThemePresetsArchive", { TSA_ThemePresetsArchive($0) as IWAMessage }))
-    into.append(("TSA.ShortcutControllerArchive", { TSA_ShortcutControllerArchive($0) as IWAMessage }))
-    into.append(("TSA.ShortcutControllerArchive.ShortcutMapEntry", { TSA_ShortcutControllerArchive_ShortcutMapEntry($0) as IWAMessage }))
-    into.append(("TSA.PropagatePresetCommandArchive", { TSA_PropagatePresetCommandArchive($0) as IWAMessage }))
-    into.append(("TSA.ShortcutCommandArchive", { TSA_ShortcutCommandArchive($0) as IWAMessage }))
-    into.append(("TSA.AddCustomFormatCommandArchive", { TSA_AddCustomFormatCommandArchive($0) as IWAMessage }))
-    into.append(("TSA.UpdateCustomFormatCommandArchive", { TSA_UpdateCustomFormatCommandArchive($0) as IWAMessage }))
-    into.append(("TSA.ReplaceCustomFormatCommandArchive", { TSA_ReplaceCustomFormatCommandArchive($0) as IWAMessage }))
-    into.append(("TSA.NeedsMediaCompatibilityUpgradeCommandArchive", { TSA_NeedsMediaCompatibilityUpgradeCommandArchive($0) as IWAMessage }))
-    into.append(("TSA.ChangeDocumentLocaleCommandArchive", { TSA_ChangeDocumentLocaleCommandArchive($0) as IWAMessage }))
-    into.append(("TSA.InducedVerifyObjectsWithServerCommandArchive", { TSA_InducedVerifyObjectsWithServerCommandArchive($0) as IWAMessage }))
-    into.append(("TSA.InducedVerifyTransformHistoryWithServerCommandArchive", { TSA_InducedVerifyTransformHistoryWithServerCommandArchive($0) as IWAMessage }))
-    into.append(("TSA.StyleUpdatePropertyMapCommandArchive", { TSA_StyleUpdatePropertyMapCommandArchive($0) as IWAMessage }))
-    into.append(("TSA.RemoteDataChangeCommandArchive", { TSA_RemoteDataChangeCommandArchive($0) as IWAMessage }))
-    into.append(("TSA.GalleryInfoSetValueCommandArchive", { TSA_GalleryInfoSetValueCommandArchive($0) as IWAMessage }))
-    into.append(("TSA.GalleryInfoSetValueCommandArchive.PropertyValue", { TSA_GalleryInfoSetValueCommandArchive_PropertyValue($0) as IWAMessage }))
-    into.append(("TSA.GalleryInfoInsertItemsCommandArchive", { TSA_GalleryInfoInsertItemsCommandArchive($0) as IWAMessage }))
-    into.append(("TSA.GalleryInfoRemoveItemsCommandArchive", { TSA_GalleryInfoRemoveItemsCommandArchive($0) as IWAMessage }))
-    into.append(("TSA.GalleryItemSetGeometryCommand", { TSA_GalleryItemSetGeometryCommand($0) as IWAMessage }))
-    into.append(("TSA.GalleryItem", { TSA_GalleryItem($0) as IWAMessage }))
-    into.append(("TSA.GalleryInfo", { TSA_GalleryInfo($0) as IWAMessage }))
-    into.append(("TSA.GallerySelectionTransformer", { TSA_GallerySelectionTransformer($0) as IWAMessage }))
-    into.append(("TSA.GalleryItemSelection", { TSA_GalleryItemSelection($0) as IWAMessage }))
-    into.append(("TSA.GalleryItemSelectionTransformer", { TSA_GalleryItemSelectionTransformer($0) as IWAMessage }))
-    into.append(("TSA.GalleryItemSelectionTransformerHelper", { TSA_GalleryItemSelectionTransformerHelper($0) as IWAMessage }))
-    into.append(("TSA.GalleryItemSetValueCommand", { TSA_GalleryItemSetValueCommand($0) as IWAMessage }))
-    into.append(("TSA.GalleryItemSetValueCommand.PropertyValue", { TSA_GalleryItemSetValueCommand_PropertyValue($0) as IWAMessage }))
-    into.append(("TSA.CollaboratorGalleryItemCursor", { TSA_CollaboratorGalleryItemCursor($0) as IWAMessage }))
-    into.append(("TSA.WebVideoInfo", { TSA_WebVideoInfo($0) as IWAMessage }))
-    into.append(("TSA.CaptionPlacementArchive", { TSA_CaptionPlacementArchive($0) as IWAMessage }))
-    into.append(("TSA.CaptionInfoArchive", { TSA_CaptionInfoArchive($0) as IWAMessage }))
-    into.append(("TSA.TitlePlacementCommandArchive", { TSA_TitlePlacementCommandArchive($0) as IWAMessage }))
-    into.append(("TSA.Object3DInfo", { TSA_Object3DInfo($0) as IWAMessage }))
-    into.append(("TSA.Object3DInfoCommandArchive", { TSA_Object3DInfoCommandArchive($0) as IWAMessage }))
-    into.append(("TSA.Object3DInfoSetValueCommandArchive", { TSA_Object3DInfoSetValueCommandArchive($0) as IWAMessage }))
-    into.append(("TSA.Object3DInfoSetValueCommandArchive.PropertyValue", { TSA_Object3DInfoSetValueCommandArchive_PropertyValue($0) as IWAMessage }))
+func registerIWA_TSAArchives(_ into: inout [any IWAMessage.Type]) {
+    into += [
+        TSA_DocumentArchive.self, TSA_FunctionBrowserStateArchive.self, TSA_ThemePresetsArchive.self,
+        TSA_ShortcutControllerArchive.self, TSA_ShortcutControllerArchive_ShortcutMapEntry.self,
+        TSA_PropagatePresetCommandArchive.self, TSA_ShortcutCommandArchive.self, TSA_AddCustomFormatCommandArchive.self,
+        TSA_UpdateCustomFormatCommandArchive.self, TSA_ReplaceCustomFormatCommandArchive.self,
+        TSA_NeedsMediaCompatibilityUpgradeCommandArchive.self, TSA_ChangeDocumentLocaleCommandArchive.self,
+        TSA_InducedVerifyObjectsWithServerCommandArchive.self,
+        TSA_InducedVerifyTransformHistoryWithServerCommandArchive.self, TSA_StyleUpdatePropertyMapCommandArchive.self,
+        TSA_RemoteDataChangeCommandArchive.self, TSA_GalleryInfoSetValueCommandArchive.self,
+        TSA_GalleryInfoSetValueCommandArchive_PropertyValue.self, TSA_GalleryInfoInsertItemsCommandArchive.self,
+        TSA_GalleryInfoRemoveItemsCommandArchive.self, TSA_GalleryItemSetGeometryCommand.self, TSA_GalleryItem.self,
+        TSA_GalleryInfo.self, TSA_GallerySelectionTransformer.self, TSA_GalleryItemSelection.self,
+        TSA_GalleryItemSelectionTransformer.self, TSA_GalleryItemSelectionTransformerHelper.self,
+        TSA_GalleryItemSetValueCommand.self, TSA_GalleryItemSetValueCommand_PropertyValue.self,
+        TSA_CollaboratorGalleryItemCursor.self, TSA_WebVideoInfo.self, TSA_CaptionPlacementArchive.self,
+        TSA_CaptionInfoArchive.self, TSA_TitlePlacementCommandArchive.self, TSA_Object3DInfo.self,
+        TSA_Object3DInfoCommandArchive.self, TSA_Object3DInfoSetValueCommandArchive.self,
+        TSA_Object3DInfoSetValueCommandArchive_PropertyValue.self,
+    ]
 }
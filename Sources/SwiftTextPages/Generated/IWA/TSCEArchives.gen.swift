@@ -5,6632 +5,2546 @@ import SwiftTextIWA
 
 /// Generated wire model for `TSCE.CellReferenceArchive`.
 final class TSCE_CellReferenceArchive: IWAMessage {
-    var column: UInt32?
-    var row: UInt32?
-    var tableId: TSP_CFUUIDArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { column = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { row = _v }
-        case 3:
-            var _v: TSP_CFUUIDArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_CFUUIDArchive(ProtobufMessage(_b)) }
-            if let _v { tableId = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = column { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = row { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = tableId { _w.bytesField(3, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.CellReferenceArchive", [
+        .optional(1, .uint32), .optional(2, .uint32), .optional(3, TSP_CFUUIDArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var column: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var row: UInt32? { get { self[1] } set { self[1] = newValue } }
+    var tableId: TSP_CFUUIDArchive? { get { self[message: 2] } set { self[message: 2] = newValue } }
 }
 
 /// Generated wire model for `TSCE.InternalCellReferenceArchive`.
 final class TSCE_InternalCellReferenceArchive: IWAMessage {
-    var coordinate: TSCE_CellCoordinateArchive?
-    var ownerId: UInt32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSCE_CellCoordinateArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CellCoordinateArchive(ProtobufMessage(_b)) }
-            if let _v { coordinate = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { ownerId = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = coordinate { _w.bytesField(1, _x.encoded()) }
-        if let _x = ownerId { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.InternalCellReferenceArchive", [
+        .optional(1, TSCE_CellCoordinateArchive.self), .optional(2, .uint32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var coordinate: TSCE_CellCoordinateArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var ownerId: UInt32? { get { self[1] } set { self[1] = newValue } }
 }
 
 /// Generated wire model for `TSCE.RelativeCellRefArchive`.
 final class TSCE_RelativeCellRefArchive: IWAMessage {
-    var relativeRowOffset: Int32?
-    var relativeColumnOffset: Int32?
-    var tableUid: TSP_UUID?
-    var preserveColumn: Bool?
-    var preserveRow: Bool?
-    var isSpanningColumn: Bool?
-    var isSpanningRow: Bool?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { relativeRowOffset = _v }
-        case 2:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { relativeColumnOffset = _v }
-        case 3:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { tableUid = _v }
-        case 4:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { preserveColumn = _v }
-        case 5:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { preserveRow = _v }
-        case 6:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { isSpanningColumn = _v }
-        case 7:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { isSpanningRow = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = relativeRowOffset { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = relativeColumnOffset { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = tableUid { _w.bytesField(3, _x.encoded()) }
-        if let _x = preserveColumn { _w.varintField(4, _x ? 1 : 0) }
-        if let _x = preserveRow { _w.varintField(5, _x ? 1 : 0) }
-        if let _x = isSpanningColumn { _w.varintField(6, _x ? 1 : 0) }
-        if let _x = isSpanningRow { _w.varintField(7, _x ? 1 : 0) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.RelativeCellRefArchive", [
+        .optional(1, .int32), .optional(2, .int32), .optional(3, TSP_UUID.self), .optional(4, .bool),
+        .optional(5, .bool), .optional(6, .bool), .optional(7, .bool),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 7)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var relativeRowOffset: Int32? { get { self[0] } set { self[0] = newValue } }
+    var relativeColumnOffset: Int32? { get { self[1] } set { self[1] = newValue } }
+    var tableUid: TSP_UUID? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var preserveColumn: Bool? { get { self[3] } set { self[3] = newValue } }
+    var preserveRow: Bool? { get { self[4] } set { self[4] = newValue } }
+    var isSpanningColumn: Bool? { get { self[5] } set { self[5] = newValue } }
+    var isSpanningRow: Bool? { get { self[6] } set { self[6] = newValue } }
 }
 
 /// Generated wire model for `TSCE.RangeReferenceArchive`.
 final class TSCE_RangeReferenceArchive: IWAMessage {
-    var tableId: TSP_CFUUIDArchive?
-    var topLeftColumn: UInt32?
-    var topLeftRow: UInt32?
-    var bottomRightColumn: UInt32?
-    var bottomRightRow: UInt32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_CFUUIDArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_CFUUIDArchive(ProtobufMessage(_b)) }
-            if let _v { tableId = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { topLeftColumn = _v }
-        case 3:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { topLeftRow = _v }
-        case 4:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { bottomRightColumn = _v }
-        case 5:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { bottomRightRow = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = tableId { _w.bytesField(1, _x.encoded()) }
-        if let _x = topLeftColumn { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = topLeftRow { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = bottomRightColumn { _w.varintField(4, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = bottomRightRow { _w.varintField(5, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.RangeReferenceArchive", [
+        .optional(1, TSP_CFUUIDArchive.self), .optional(2, .uint32), .optional(3, .uint32), .optional(4, .uint32),
+        .optional(5, .uint32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 5)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var tableId: TSP_CFUUIDArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var topLeftColumn: UInt32? { get { self[1] } set { self[1] = newValue } }
+    var topLeftRow: UInt32? { get { self[2] } set { self[2] = newValue } }
+    var bottomRightColumn: UInt32? { get { self[3] } set { self[3] = newValue } }
+    var bottomRightRow: UInt32? { get { self[4] } set { self[4] = newValue } }
 }
 
 /// Generated wire model for `TSCE.InternalRangeReferenceArchive`.
 final class TSCE_InternalRangeReferenceArchive: IWAMessage {
-    var ownerId: UInt32?
-    var range: TSCE_RangeCoordinateArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { ownerId = _v }
-        case 2:
-            var _v: TSCE_RangeCoordinateArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_RangeCoordinateArchive(ProtobufMessage(_b)) }
-            if let _v { range = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = ownerId { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = range { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.InternalRangeReferenceArchive", [
+        .optional(1, .uint32), .optional(2, TSCE_RangeCoordinateArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var ownerId: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var range: TSCE_RangeCoordinateArchive? { get { self[message: 1] } set { self[message: 1] = newValue } }
 }
 
 /// Generated wire model for `TSCE.IndexSetArchive`.
 final class TSCE_IndexSetArchive: IWAMessage {
-    var entries: [TSCE_IndexSetArchive_IndexSetEntry] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSCE_IndexSetArchive_IndexSetEntry?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_IndexSetArchive_IndexSetEntry(ProtobufMessage(_b)) }
-            if let _v { entries.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in entries { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.IndexSetArchive", [
+        .repeated(1, TSCE_IndexSetArchive_IndexSetEntry.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var entries: [TSCE_IndexSetArchive_IndexSetEntry] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(entries value: TSCE_IndexSetArchive_IndexSetEntry) { append(value, toMessages: 0) }
 }
 
 /// Generated wire model for `TSCE.IndexSetArchive.IndexSetEntry`.
 final class TSCE_IndexSetArchive_IndexSetEntry: IWAMessage {
-    var rangeBegin: Int32?
-    var rangeEnd: Int32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { rangeBegin = _v }
-        case 2:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { rangeEnd = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = rangeBegin { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = rangeEnd { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.IndexSetArchive.IndexSetEntry", [
+        .optional(1, .int32), .optional(2, .int32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var rangeBegin: Int32? { get { self[0] } set { self[0] = newValue } }
+    var rangeEnd: Int32? { get { self[1] } set { self[1] = newValue } }
 }
 
 /// Generated wire model for `TSCE.CellCoordSetArchive`.
 final class TSCE_CellCoordSetArchive: IWAMessage {
-    var columnEntries: [TSCE_CellCoordSetArchive_ColumnEntry] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSCE_CellCoordSetArchive_ColumnEntry?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CellCoordSetArchive_ColumnEntry(ProtobufMessage(_b)) }
-            if let _v { columnEntries.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in columnEntries { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.CellCoordSetArchive", [
+        .repeated(1, TSCE_CellCoordSetArchive_ColumnEntry.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var columnEntries: [TSCE_CellCoordSetArchive_ColumnEntry] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(columnEntries value: TSCE_CellCoordSetArchive_ColumnEntry) { append(value, toMessages: 0) }
 }
 
 /// Generated wire model for `TSCE.CellCoordSetArchive.ColumnEntry`.
 final class TSCE_CellCoordSetArchive_ColumnEntry: IWAMessage {
-    var column: UInt32?
-    var rowSet: TSCE_IndexSetArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { column = _v }
-        case 2:
-            var _v: TSCE_IndexSetArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_IndexSetArchive(ProtobufMessage(_b)) }
-            if let _v { rowSet = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = column { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = rowSet { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.CellCoordSetArchive.ColumnEntry", [
+        .optional(1, .uint32), .optional(2, TSCE_IndexSetArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var column: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var rowSet: TSCE_IndexSetArchive? { get { self[message: 1] } set { self[message: 1] = newValue } }
 }
 
 /// Generated wire model for `TSCE.InternalCellRefSetArchive`.
 final class TSCE_InternalCellRefSetArchive: IWAMessage {
-    var ownerEntries: [TSCE_InternalCellRefSetArchive_OwnerEntry] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSCE_InternalCellRefSetArchive_OwnerEntry?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_InternalCellRefSetArchive_OwnerEntry(ProtobufMessage(_b)) }
-            if let _v { ownerEntries.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in ownerEntries { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.InternalCellRefSetArchive", [
+        .repeated(1, TSCE_InternalCellRefSetArchive_OwnerEntry.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var ownerEntries: [TSCE_InternalCellRefSetArchive_OwnerEntry] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(ownerEntries value: TSCE_InternalCellRefSetArchive_OwnerEntry) { append(value, toMessages: 0) }
 }
 
 /// Generated wire model for `TSCE.InternalCellRefSetArchive.OwnerEntry`.
 final class TSCE_InternalCellRefSetArchive_OwnerEntry: IWAMessage {
-    var ownerId: UInt32?
-    var coordSet: TSCE_CellCoordSetArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { ownerId = _v }
-        case 2:
-            var _v: TSCE_CellCoordSetArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CellCoordSetArchive(ProtobufMessage(_b)) }
-            if let _v { coordSet = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = ownerId { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = coordSet { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.InternalCellRefSetArchive.OwnerEntry", [
+        .optional(1, .uint32), .optional(2, TSCE_CellCoordSetArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var ownerId: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var coordSet: TSCE_CellCoordSetArchive? { get { self[message: 1] } set { self[message: 1] = newValue } }
 }
 
 /// Generated wire model for `TSCE.ColumnRowSize`.
 final class TSCE_ColumnRowSize: IWAMessage {
-    var numColumns: UInt32?
-    var numRows: UInt32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { numColumns = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { numRows = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = numColumns { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = numRows { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.ColumnRowSize", [
+        .optional(1, .uint32), .optional(2, .uint32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var numColumns: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var numRows: UInt32? { get { self[1] } set { self[1] = newValue } }
 }
 
 /// Generated wire model for `TSCE.CellRectArchive`.
 final class TSCE_CellRectArchive: IWAMessage {
-    var origin: TSCE_CellCoordinateArchive?
-    var size: TSCE_ColumnRowSize?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSCE_CellCoordinateArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CellCoordinateArchive(ProtobufMessage(_b)) }
-            if let _v { origin = _v }
-        case 2:
-            var _v: TSCE_ColumnRowSize?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_ColumnRowSize(ProtobufMessage(_b)) }
-            if let _v { size = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = origin { _w.bytesField(1, _x.encoded()) }
-        if let _x = size { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.CellRectArchive", [
+        .optional(1, TSCE_CellCoordinateArchive.self), .optional(2, TSCE_ColumnRowSize.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var origin: TSCE_CellCoordinateArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var size: TSCE_ColumnRowSize? { get { self[message: 1] } set { self[message: 1] = newValue } }
 }
 
 /// Generated wire model for `TSCE.CellRefSetArchive`.
 final class TSCE_CellRefSetArchive: IWAMessage {
-    var ownerEntries: [TSCE_CellRefSetArchive_OwnerEntry] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSCE_CellRefSetArchive_OwnerEntry?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CellRefSetArchive_OwnerEntry(ProtobufMessage(_b)) }
-            if let _v { ownerEntries.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in ownerEntries { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.CellRefSetArchive", [
+        .repeated(1, TSCE_CellRefSetArchive_OwnerEntry.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var ownerEntries: [TSCE_CellRefSetArchive_OwnerEntry] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(ownerEntries value: TSCE_CellRefSetArchive_OwnerEntry) { append(value, toMessages: 0) }
 }
 
 /// Generated wire model for `TSCE.CellRefSetArchive.OwnerEntry`.
 final class TSCE_CellRefSetArchive_OwnerEntry: IWAMessage {
-    var ownerUid: TSP_UUID?
-    var coordSet: TSCE_CellCoordSetArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { ownerUid = _v }
-        case 2:
-            var _v: TSCE_CellCoordSetArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CellCoordSetArchive(ProtobufMessage(_b)) }
-            if let _v { coordSet = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = ownerUid { _w.bytesField(1, _x.encoded()) }
-        if let _x = coordSet { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.CellRefSetArchive.OwnerEntry", [
+        .optional(1, TSP_UUID.self), .optional(2, TSCE_CellCoordSetArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var ownerUid: TSP_UUID? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var coordSet: TSCE_CellCoordSetArchive? { get { self[message: 1] } set { self[message: 1] = newValue } }
 }
 
 /// Generated wire model for `TSCE.UidCoordSetArchive`.
 final class TSCE_UidCoordSetArchive: IWAMessage {
-    var columnEntries: [TSCE_UidCoordSetArchive_ColumnEntry] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSCE_UidCoordSetArchive_ColumnEntry?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_UidCoordSetArchive_ColumnEntry(ProtobufMessage(_b)) }
-            if let _v { columnEntries.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in columnEntries { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.UidCoordSetArchive", [
+        .repeated(1, TSCE_UidCoordSetArchive_ColumnEntry.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var columnEntries: [TSCE_UidCoordSetArchive_ColumnEntry] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(columnEntries value: TSCE_UidCoordSetArchive_ColumnEntry) { append(value, toMessages: 0) }
 }
 
 /// Generated wire model for `TSCE.UidCoordSetArchive.ColumnEntry`.
 final class TSCE_UidCoordSetArchive_ColumnEntry: IWAMessage {
-    var column: TSP_UUID?
-    var rowSet: [TSP_UUID] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { column = _v }
-        case 2:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { rowSet.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = column { _w.bytesField(1, _x.encoded()) }
-        for _x in rowSet { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.UidCoordSetArchive.ColumnEntry", [
+        .optional(1, TSP_UUID.self), .repeated(2, TSP_UUID.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var column: TSP_UUID? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var rowSet: [TSP_UUID] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(rowSet value: TSP_UUID) { append(value, toMessages: 1) }
 }
 
 /// Generated wire model for `TSCE.UidCellRefSetArchive`.
 final class TSCE_UidCellRefSetArchive: IWAMessage {
-    var ownerEntries: [TSCE_UidCellRefSetArchive_OwnerEntry] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSCE_UidCellRefSetArchive_OwnerEntry?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_UidCellRefSetArchive_OwnerEntry(ProtobufMessage(_b)) }
-            if let _v { ownerEntries.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in ownerEntries { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.UidCellRefSetArchive", [
+        .repeated(1, TSCE_UidCellRefSetArchive_OwnerEntry.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var ownerEntries: [TSCE_UidCellRefSetArchive_OwnerEntry] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(ownerEntries value: TSCE_UidCellRefSetArchive_OwnerEntry) { append(value, toMessages: 0) }
 }
 
 /// Generated wire model for `TSCE.UidCellRefSetArchive.OwnerEntry`.
 final class TSCE_UidCellRefSetArchive_OwnerEntry: IWAMessage {
-    var ownerUid: TSP_UUID?
-    var coordSet: TSCE_UidCoordSetArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { ownerUid = _v }
-        case 2:
-            var _v: TSCE_UidCoordSetArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_UidCoordSetArchive(ProtobufMessage(_b)) }
-            if let _v { coordSet = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = ownerUid { _w.bytesField(1, _x.encoded()) }
-        if let _x = coordSet { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.UidCellRefSetArchive.OwnerEntry", [
+        .optional(1, TSP_UUID.self), .optional(2, TSCE_UidCoordSetArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var ownerUid: TSP_UUID? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var coordSet: TSCE_UidCoordSetArchive? { get { self[message: 1] } set { self[message: 1] = newValue } }
 }
 
 /// Generated wire model for `TSCE.ReferencesToDirtyArchive`.
 final class TSCE_ReferencesToDirtyArchive: IWAMessage {
-    var toDirtyOwnerIds: TSCE_IndexSetArchive?
-    var toDirtyCells: TSCE_InternalCellRefSetArchive?
-    var toDirtyCellsAdditional: TSCE_InternalCellRefSetArchive?
-    var toDirtyRangeRefs: [TSCE_InternalRangeReferenceArchive] = []
-    var calcInProgressCells: TSCE_InternalCellRefSetArchive?
-    var toUpdatePrecedentsCells: TSCE_InternalCellRefSetArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSCE_IndexSetArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_IndexSetArchive(ProtobufMessage(_b)) }
-            if let _v { toDirtyOwnerIds = _v }
-        case 2:
-            var _v: TSCE_InternalCellRefSetArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_InternalCellRefSetArchive(ProtobufMessage(_b)) }
-            if let _v { toDirtyCells = _v }
-        case 3:
-            var _v: TSCE_InternalCellRefSetArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_InternalCellRefSetArchive(ProtobufMessage(_b)) }
-            if let _v { toDirtyCellsAdditional = _v }
-        case 4:
-            var _v: TSCE_InternalRangeReferenceArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_InternalRangeReferenceArchive(ProtobufMessage(_b)) }
-            if let _v { toDirtyRangeRefs.append(_v) }
-        case 6:
-            var _v: TSCE_InternalCellRefSetArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_InternalCellRefSetArchive(ProtobufMessage(_b)) }
-            if let _v { calcInProgressCells = _v }
-        case 7:
-            var _v: TSCE_InternalCellRefSetArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_InternalCellRefSetArchive(ProtobufMessage(_b)) }
-            if let _v { toUpdatePrecedentsCells = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = toDirtyOwnerIds { _w.bytesField(1, _x.encoded()) }
-        if let _x = toDirtyCells { _w.bytesField(2, _x.encoded()) }
-        if let _x = toDirtyCellsAdditional { _w.bytesField(3, _x.encoded()) }
-        for _x in toDirtyRangeRefs { _w.bytesField(4, _x.encoded()) }
-        if let _x = calcInProgressCells { _w.bytesField(6, _x.encoded()) }
-        if let _x = toUpdatePrecedentsCells { _w.bytesField(7, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.ReferencesToDirtyArchive", [
+        .optional(1, TSCE_IndexSetArchive.self), .optional(2, TSCE_InternalCellRefSetArchive.self),
+        .optional(3, TSCE_InternalCellRefSetArchive.self), .repeated(4, TSCE_InternalRangeReferenceArchive.self),
+        .optional(6, TSCE_InternalCellRefSetArchive.self), .optional(7, TSCE_InternalCellRefSetArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 6)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var toDirtyOwnerIds: TSCE_IndexSetArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var toDirtyCells: TSCE_InternalCellRefSetArchive? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var toDirtyCellsAdditional: TSCE_InternalCellRefSetArchive? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var toDirtyRangeRefs: [TSCE_InternalRangeReferenceArchive] { get { self[messages: 3] } set { self[messages: 3] = newValue } }
+    func append(toDirtyRangeRefs value: TSCE_InternalRangeReferenceArchive) { append(value, toMessages: 3) }
+    var calcInProgressCells: TSCE_InternalCellRefSetArchive? { get { self[message: 4] } set { self[message: 4] = newValue } }
+    var toUpdatePrecedentsCells: TSCE_InternalCellRefSetArchive? { get { self[message: 5] } set { self[message: 5] = newValue } }
 }
 
 /// Generated wire model for `TSCE.CoordMapperArchive`.
 final class TSCE_CoordMapperArchive: IWAMessage {
-    var tableUid: TSP_UUID?
-    var summaryRowsSet: TSCE_IndexSetArchive?
-    var summaryColumnsSet: TSCE_IndexSetArchive?
-    var labelRowsSet: TSCE_IndexSetArchive?
-    var baseToViewRowMap: [TSCE_CoordMapperArchive_BaseToViewEntry] = []
-    var baseToViewColumnMap: [TSCE_CoordMapperArchive_BaseToViewEntry] = []
-    var summaryToViewRowMap: [TSCE_CoordMapperArchive_SummaryToViewEntry] = []
-    var summaryToViewColumnMap: [TSCE_CoordMapperArchive_SummaryToViewEntry] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { tableUid = _v }
-        case 2:
-            var _v: TSCE_IndexSetArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_IndexSetArchive(ProtobufMessage(_b)) }
-            if let _v { summaryRowsSet = _v }
-        case 3:
-            var _v: TSCE_IndexSetArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_IndexSetArchive(ProtobufMessage(_b)) }
-            if let _v { summaryColumnsSet = _v }
-        case 4:
-            var _v: TSCE_IndexSetArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_IndexSetArchive(ProtobufMessage(_b)) }
-            if let _v { labelRowsSet = _v }
-        case 5:
-            var _v: TSCE_CoordMapperArchive_BaseToViewEntry?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CoordMapperArchive_BaseToViewEntry(ProtobufMessage(_b)) }
-            if let _v { baseToViewRowMap.append(_v) }
-        case 6:
-            var _v: TSCE_CoordMapperArchive_BaseToViewEntry?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CoordMapperArchive_BaseToViewEntry(ProtobufMessage(_b)) }
-            if let _v { baseToViewColumnMap.append(_v) }
-        case 7:
-            var _v: TSCE_CoordMapperArchive_SummaryToViewEntry?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CoordMapperArchive_SummaryToViewEntry(ProtobufMessage(_b)) }
-            if let _v { summaryToViewRowMap.append(_v) }
-        case 8:
-            var _v: TSCE_CoordMapperArchive_SummaryToViewEntry?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CoordMapperArchive_SummaryToViewEntry(ProtobufMessage(_b)) }
-            if let _v { summaryToViewColumnMap.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = tableUid { _w.bytesField(1, _x.encoded()) }
-        if let _x = summaryRowsSet { _w.bytesField(2, _x.encoded()) }
-        if let _x = summaryColumnsSet { _w.bytesField(3, _x.encoded()) }
-        if let _x = labelRowsSet { _w.bytesField(4, _x.encoded()) }
-        for _x in baseToViewRowMap { _w.bytesField(5, _x.encoded()) }
-        for _x in baseToViewColumnMap { _w.bytesField(6, _x.encoded()) }
-        for _x in summaryToViewRowMap { _w.bytesField(7, _x.encoded()) }
-        for _x in summaryToViewColumnMap { _w.bytesField(8, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.CoordMapperArchive", [
+        .optional(1, TSP_UUID.self), .optional(2, TSCE_IndexSetArchive.self), .optional(3, TSCE_IndexSetArchive.self),
+        .optional(4, TSCE_IndexSetArchive.self), .repeated(5, TSCE_CoordMapperArchive_BaseToViewEntry.self),
+        .repeated(6, TSCE_CoordMapperArchive_BaseToViewEntry.self),
+        .repeated(7, TSCE_CoordMapperArchive_SummaryToViewEntry.self),
+        .repeated(8, TSCE_CoordMapperArchive_SummaryToViewEntry.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 8)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var tableUid: TSP_UUID? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var summaryRowsSet: TSCE_IndexSetArchive? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var summaryColumnsSet: TSCE_IndexSetArchive? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var labelRowsSet: TSCE_IndexSetArchive? { get { self[message: 3] } set { self[message: 3] = newValue } }
+    var baseToViewRowMap: [TSCE_CoordMapperArchive_BaseToViewEntry] { get { self[messages: 4] } set { self[messages: 4] = newValue } }
+    func append(baseToViewRowMap value: TSCE_CoordMapperArchive_BaseToViewEntry) { append(value, toMessages: 4) }
+    var baseToViewColumnMap: [TSCE_CoordMapperArchive_BaseToViewEntry] { get { self[messages: 5] } set { self[messages: 5] = newValue } }
+    func append(baseToViewColumnMap value: TSCE_CoordMapperArchive_BaseToViewEntry) { append(value, toMessages: 5) }
+    var summaryToViewRowMap: [TSCE_CoordMapperArchive_SummaryToViewEntry] { get { self[messages: 6] } set { self[messages: 6] = newValue } }
+    func append(summaryToViewRowMap value: TSCE_CoordMapperArchive_SummaryToViewEntry) { append(value, toMessages: 6) }
+    var summaryToViewColumnMap: [TSCE_CoordMapperArchive_SummaryToViewEntry] { get { self[messages: 7] } set { self[messages: 7] = newValue } }
+    func append(summaryToViewColumnMap value: TSCE_CoordMapperArchive_SummaryToViewEntry) { append(value, toMessages: 7) }
 }
 
 /// Generated wire model for `TSCE.CoordMapperArchive.BaseToViewEntry`.
 final class TSCE_CoordMapperArchive_BaseToViewEntry: IWAMessage {
-    var baseColumnOrRow: UInt32?
-    var viewColumnOrRow: UInt32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { baseColumnOrRow = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { viewColumnOrRow = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = baseColumnOrRow { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = viewColumnOrRow { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.CoordMapperArchive.BaseToViewEntry", [
+        .optional(1, .uint32), .optional(2, .uint32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var baseColumnOrRow: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var viewColumnOrRow: UInt32? { get { self[1] } set { self[1] = newValue } }
 }
 
 /// Generated wire model for `TSCE.CoordMapperArchive.SummaryToViewEntry`.
 final class TSCE_CoordMapperArchive_SummaryToViewEntry: IWAMessage {
-    var summaryColumnOrRow: UInt32?
-    var viewColumnOrRow: UInt32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { summaryColumnOrRow = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { viewColumnOrRow = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = summaryColumnOrRow { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = viewColumnOrRow { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.CoordMapperArchive.SummaryToViewEntry", [
+        .optional(1, .uint32), .optional(2, .uint32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var summaryColumnOrRow: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var viewColumnOrRow: UInt32? { get { self[1] } set { self[1] = newValue } }
 }
 
 /// Generated wire model for `TSCE.ReferenceArchive`.
 final class TSCE_ReferenceArchive: IWAMessage {
-    var referenceType: Int32?
-    var cellReference: TSCE_CellReferenceArchive?
-    var rangeReference: TSCE_RangeReferenceArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { referenceType = _v }
-        case 2:
-            var _v: TSCE_CellReferenceArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CellReferenceArchive(ProtobufMessage(_b)) }
-            if let _v { cellReference = _v }
-        case 3:
-            var _v: TSCE_RangeReferenceArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_RangeReferenceArchive(ProtobufMessage(_b)) }
-            if let _v { rangeReference = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = referenceType { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = cellReference { _w.bytesField(2, _x.encoded()) }
-        if let _x = rangeReference { _w.bytesField(3, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.ReferenceArchive", [
+        .optional(1, .int32), .optional(2, TSCE_CellReferenceArchive.self),
+        .optional(3, TSCE_RangeReferenceArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var referenceType: Int32? { get { self[0] } set { self[0] = newValue } }
+    var cellReference: TSCE_CellReferenceArchive? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var rangeReference: TSCE_RangeReferenceArchive? { get { self[message: 2] } set { self[message: 2] = newValue } }
 }
 
 /// Generated wire model for `TSCE.EdgeArchive`.
 final class TSCE_EdgeArchive: IWAMessage {
-    var column: UInt32?
-    var row: UInt32?
-    var isPrecedent: Bool?
-    var ownerId: TSP_CFUUIDArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { column = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { row = _v }
-        case 3:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { isPrecedent = _v }
-        case 4:
-            var _v: TSP_CFUUIDArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_CFUUIDArchive(ProtobufMessage(_b)) }
-            if let _v { ownerId = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = column { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = row { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = isPrecedent { _w.varintField(3, _x ? 1 : 0) }
-        if let _x = ownerId { _w.bytesField(4, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.EdgeArchive", [
+        .optional(1, .uint32), .optional(2, .uint32), .optional(3, .bool), .optional(4, TSP_CFUUIDArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var column: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var row: UInt32? { get { self[1] } set { self[1] = newValue } }
+    var isPrecedent: Bool? { get { self[2] } set { self[2] = newValue } }
+    var ownerId: TSP_CFUUIDArchive? { get { self[message: 3] } set { self[message: 3] = newValue } }
 }
 
 /// Generated wire model for `TSCE.EdgesArchive`.
 final class TSCE_EdgesArchive: IWAMessage {
-    var packedEdgeWithoutOwner: [UInt32] = []
-    var packedEdgeWithOwner: [UInt32] = []
-    var ownerIdForEdge: [TSP_CFUUIDArchive] = []
-    var internalOwnerIdForEdge: [UInt32] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 9:
-            if case .varint(let _u) = _f.value { packedEdgeWithoutOwner.append(UInt32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { packedEdgeWithoutOwner.append(UInt32(truncatingIfNeeded: _u)) } }
-        case 10:
-            if case .varint(let _u) = _f.value { packedEdgeWithOwner.append(UInt32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { packedEdgeWithOwner.append(UInt32(truncatingIfNeeded: _u)) } }
-        case 11:
-            var _v: TSP_CFUUIDArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_CFUUIDArchive(ProtobufMessage(_b)) }
-            if let _v { ownerIdForEdge.append(_v) }
-        case 12:
-            if case .varint(let _u) = _f.value { internalOwnerIdForEdge.append(UInt32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { internalOwnerIdForEdge.append(UInt32(truncatingIfNeeded: _u)) } }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in packedEdgeWithoutOwner { _w.varintField(9, UInt64(truncatingIfNeeded: _x)) }
-        for _x in packedEdgeWithOwner { _w.varintField(10, UInt64(truncatingIfNeeded: _x)) }
-        for _x in ownerIdForEdge { _w.bytesField(11, _x.encoded()) }
-        for _x in internalOwnerIdForEdge { _w.varintField(12, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.EdgesArchive", [
+        .repeated(9, .uint32), .repeated(10, .uint32), .repeated(11, TSP_CFUUIDArchive.self), .repeated(12, .uint32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var packedEdgeWithoutOwner: [UInt32] { get { self[all: 0] } set { self[all: 0] = newValue } }
+    func append(packedEdgeWithoutOwner value: UInt32) { append(value, toAll: 0) }
+    var packedEdgeWithOwner: [UInt32] { get { self[all: 1] } set { self[all: 1] = newValue } }
+    func append(packedEdgeWithOwner value: UInt32) { append(value, toAll: 1) }
+    var ownerIdForEdge: [TSP_CFUUIDArchive] { get { self[messages: 2] } set { self[messages: 2] = newValue } }
+    func append(ownerIdForEdge value: TSP_CFUUIDArchive) { append(value, toMessages: 2) }
+    var internalOwnerIdForEdge: [UInt32] { get { self[all: 3] } set { self[all: 3] = newValue } }
+    func append(internalOwnerIdForEdge value: UInt32) { append(value, toAll: 3) }
 }
 
 /// Generated wire model for `TSCE.ExpandedEdgesArchive`.
 final class TSCE_ExpandedEdgesArchive: IWAMessage {
-    var edgeWithoutOwnerRows: [UInt32] = []
-    var edgeWithoutOwnerColumns: [UInt32] = []
-    var edgeWithOwnerRows: [UInt32] = []
-    var edgeWithOwnerColumns: [UInt32] = []
-    var internalOwnerIdForEdge: [UInt32] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            if case .varint(let _u) = _f.value { edgeWithoutOwnerRows.append(UInt32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { edgeWithoutOwnerRows.append(UInt32(truncatingIfNeeded: _u)) } }
-        case 2:
-            if case .varint(let _u) = _f.value { edgeWithoutOwnerColumns.append(UInt32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { edgeWithoutOwnerColumns.append(UInt32(truncatingIfNeeded: _u)) } }
-        case 3:
-            if case .varint(let _u) = _f.value { edgeWithOwnerRows.append(UInt32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { edgeWithOwnerRows.append(UInt32(truncatingIfNeeded: _u)) } }
-        case 4:
-            if case .varint(let _u) = _f.value { edgeWithOwnerColumns.append(UInt32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { edgeWithOwnerColumns.append(UInt32(truncatingIfNeeded: _u)) } }
-        case 5:
-            if case .varint(let _u) = _f.value { internalOwnerIdForEdge.append(UInt32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { internalOwnerIdForEdge.append(UInt32(truncatingIfNeeded: _u)) } }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in edgeWithoutOwnerRows { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        for _x in edgeWithoutOwnerColumns { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        for _x in edgeWithOwnerRows { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        for _x in edgeWithOwnerColumns { _w.varintField(4, UInt64(truncatingIfNeeded: _x)) }
-        for _x in internalOwnerIdForEdge { _w.varintField(5, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.ExpandedEdgesArchive", [
+        .repeated(1, .uint32), .repeated(2, .uint32), .repeated(3, .uint32), .repeated(4, .uint32),
+        .repeated(5, .uint32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 5)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var edgeWithoutOwnerRows: [UInt32] { get { self[all: 0] } set { self[all: 0] = newValue } }
+    func append(edgeWithoutOwnerRows value: UInt32) { append(value, toAll: 0) }
+    var edgeWithoutOwnerColumns: [UInt32] { get { self[all: 1] } set { self[all: 1] = newValue } }
+    func append(edgeWithoutOwnerColumns value: UInt32) { append(value, toAll: 1) }
+    var edgeWithOwnerRows: [UInt32] { get { self[all: 2] } set { self[all: 2] = newValue } }
+    func append(edgeWithOwnerRows value: UInt32) { append(value, toAll: 2) }
+    var edgeWithOwnerColumns: [UInt32] { get { self[all: 3] } set { self[all: 3] = newValue } }
+    func append(edgeWithOwnerColumns value: UInt32) { append(value, toAll: 3) }
+    var internalOwnerIdForEdge: [UInt32] { get { self[all: 4] } set { self[all: 4] = newValue } }
+    func append(internalOwnerIdForEdge value: UInt32) { append(value, toAll: 4) }
 }
 
 /// Generated wire model for `TSCE.CellRecordArchive`.
 final class TSCE_CellRecordArchive: IWAMessage {
-    var column: UInt32?
-    var row: UInt32?
-    var dirtySelfPlusPrecedentsCount: UInt64?
-    var isInACycle: Bool?
-    var edge: [TSCE_EdgeArchive] = []
-    var containsAFormula: Bool?
-    var hasCalculatedPrecedents: Bool?
-    var calculatePrecedentsOnNextRecalc: Bool?
-    var translateForExcelImportOnNextRecalc: Bool?
-    var edges: TSCE_EdgesArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { column = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { row = _v }
-        case 3:
-            var _v: UInt64?
-            if case .varint(let _u) = _f.value { _v = UInt64(truncatingIfNeeded: _u) }
-            if let _v { dirtySelfPlusPrecedentsCount = _v }
-        case 4:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { isInACycle = _v }
-        case 5:
-            var _v: TSCE_EdgeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_EdgeArchive(ProtobufMessage(_b)) }
-            if let _v { edge.append(_v) }
-        case 6:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { containsAFormula = _v }
-        case 7:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { hasCalculatedPrecedents = _v }
-        case 8:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { calculatePrecedentsOnNextRecalc = _v }
-        case 10:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { translateForExcelImportOnNextRecalc = _v }
-        case 9:
-            var _v: TSCE_EdgesArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_EdgesArchive(ProtobufMessage(_b)) }
-            if let _v { edges = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = column { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = row { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = dirtySelfPlusPrecedentsCount { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = isInACycle { _w.varintField(4, _x ? 1 : 0) }
-        for _x in edge { _w.bytesField(5, _x.encoded()) }
-        if let _x = containsAFormula { _w.varintField(6, _x ? 1 : 0) }
-        if let _x = hasCalculatedPrecedents { _w.varintField(7, _x ? 1 : 0) }
-        if let _x = calculatePrecedentsOnNextRecalc { _w.varintField(8, _x ? 1 : 0) }
-        if let _x = translateForExcelImportOnNextRecalc { _w.varintField(10, _x ? 1 : 0) }
-        if let _x = edges { _w.bytesField(9, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.CellRecordArchive", [
+        .optional(1, .uint32), .optional(2, .uint32), .optional(3, .uint64), .optional(4, .bool),
+        .repeated(5, TSCE_EdgeArchive.self), .optional(6, .bool), .optional(7, .bool), .optional(8, .bool),
+        .optional(10, .bool), .optional(9, TSCE_EdgesArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 10)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var column: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var row: UInt32? { get { self[1] } set { self[1] = newValue } }
+    var dirtySelfPlusPrecedentsCount: UInt64? { get { self[2] } set { self[2] = newValue } }
+    var isInACycle: Bool? { get { self[3] } set { self[3] = newValue } }
+    var edge: [TSCE_EdgeArchive] { get { self[messages: 4] } set { self[messages: 4] = newValue } }
+    func append(edge value: TSCE_EdgeArchive) { append(value, toMessages: 4) }
+    var containsAFormula: Bool? { get { self[5] } set { self[5] = newValue } }
+    var hasCalculatedPrecedents: Bool? { get { self[6] } set { self[6] = newValue } }
+    var calculatePrecedentsOnNextRecalc: Bool? { get { self[7] } set { self[7] = newValue } }
+    var translateForExcelImportOnNextRecalc: Bool? { get { self[8] } set { self[8] = newValue } }
+    var edges: TSCE_EdgesArchive? { get { self[message: 9] } set { self[message: 9] = newValue } }
 }
 
 /// Generated wire model for `TSCE.CellDependenciesArchive`.
 final class TSCE_CellDependenciesArchive: IWAMessage {
-    var cellRecord: [TSCE_CellRecordArchive] = []
-    var numDirtyCells: UInt32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSCE_CellRecordArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CellRecordArchive(ProtobufMessage(_b)) }
-            if let _v { cellRecord.append(_v) }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { numDirtyCells = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in cellRecord { _w.bytesField(1, _x.encoded()) }
-        if let _x = numDirtyCells { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.CellDependenciesArchive", [
+        .repeated(1, TSCE_CellRecordArchive.self), .optional(2, .uint32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var cellRecord: [TSCE_CellRecordArchive] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(cellRecord value: TSCE_CellRecordArchive) { append(value, toMessages: 0) }
+    var numDirtyCells: UInt32? { get { self[1] } set { self[1] = newValue } }
 }
 
 /// Generated wire model for `TSCE.CellRecordExpandedArchive`.
 final class TSCE_CellRecordExpandedArchive: IWAMessage {
-    var column: UInt32?
-    var row: UInt32?
-    var dirtySelfPlusPrecedentsCount: UInt64?
-    var isInACycle: Bool?
-    var hasCalculatedPrecedents: Bool?
-    var expandedEdges: TSCE_ExpandedEdgesArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { column = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { row = _v }
-        case 3:
-            var _v: UInt64?
-            if case .varint(let _u) = _f.value { _v = UInt64(truncatingIfNeeded: _u) }
-            if let _v { dirtySelfPlusPrecedentsCount = _v }
-        case 4:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { isInACycle = _v }
-        case 5:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { hasCalculatedPrecedents = _v }
-        case 6:
-            var _v: TSCE_ExpandedEdgesArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_ExpandedEdgesArchive(ProtobufMessage(_b)) }
-            if let _v { expandedEdges = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = column { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = row { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = dirtySelfPlusPrecedentsCount { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = isInACycle { _w.varintField(4, _x ? 1 : 0) }
-        if let _x = hasCalculatedPrecedents { _w.varintField(5, _x ? 1 : 0) }
-        if let _x = expandedEdges { _w.bytesField(6, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.CellRecordExpandedArchive", [
+        .optional(1, .uint32), .optional(2, .uint32), .optional(3, .uint64), .optional(4, .bool), .optional(5, .bool),
+        .optional(6, TSCE_ExpandedEdgesArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 6)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var column: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var row: UInt32? { get { self[1] } set { self[1] = newValue } }
+    var dirtySelfPlusPrecedentsCount: UInt64? { get { self[2] } set { self[2] = newValue } }
+    var isInACycle: Bool? { get { self[3] } set { self[3] = newValue } }
+    var hasCalculatedPrecedents: Bool? { get { self[4] } set { self[4] = newValue } }
+    var expandedEdges: TSCE_ExpandedEdgesArchive? { get { self[message: 5] } set { self[message: 5] = newValue } }
 }
 
 /// Generated wire model for `TSCE.CellDependenciesExpandedArchive`.
 final class TSCE_CellDependenciesExpandedArchive: IWAMessage {
-    var cellRecord: [TSCE_CellRecordExpandedArchive] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSCE_CellRecordExpandedArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CellRecordExpandedArchive(ProtobufMessage(_b)) }
-            if let _v { cellRecord.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in cellRecord { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.CellDependenciesExpandedArchive", [
+        .repeated(1, TSCE_CellRecordExpandedArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var cellRecord: [TSCE_CellRecordExpandedArchive] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(cellRecord value: TSCE_CellRecordExpandedArchive) { append(value, toMessages: 0) }
 }
 
 /// Generated wire model for `TSCE.CellRecordTileArchive`.
 final class TSCE_CellRecordTileArchive: IWAMessage {
-    var internalOwnerId: UInt32?
-    var tileColumnBegin: UInt32?
-    var tileRowBegin: UInt32?
-    var cellRecords: [TSCE_CellRecordExpandedArchive] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { internalOwnerId = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { tileColumnBegin = _v }
-        case 3:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { tileRowBegin = _v }
-        case 4:
-            var _v: TSCE_CellRecordExpandedArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CellRecordExpandedArchive(ProtobufMessage(_b)) }
-            if let _v { cellRecords.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = internalOwnerId { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = tileColumnBegin { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = tileRowBegin { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        for _x in cellRecords { _w.bytesField(4, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.CellRecordTileArchive", [
+        .optional(1, .uint32), .optional(2, .uint32), .optional(3, .uint32),
+        .repeated(4, TSCE_CellRecordExpandedArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var internalOwnerId: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var tileColumnBegin: UInt32? { get { self[1] } set { self[1] = newValue } }
+    var tileRowBegin: UInt32? { get { self[2] } set { self[2] = newValue } }
+    var cellRecords: [TSCE_CellRecordExpandedArchive] { get { self[messages: 3] } set { self[messages: 3] = newValue } }
+    func append(cellRecords value: TSCE_CellRecordExpandedArchive) { append(value, toMessages: 3) }
 }
 
 /// Generated wire model for `TSCE.CellDependenciesTiledArchive`.
 final class TSCE_CellDependenciesTiledArchive: IWAMessage {
-    var cellRecordTiles: [TSP_Reference] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { cellRecordTiles.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in cellRecordTiles { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.CellDependenciesTiledArchive", [
+        .repeated(1, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var cellRecordTiles: [TSP_Reference] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(cellRecordTiles value: TSP_Reference) { append(value, toMessages: 0) }
 }
 
 /// Generated wire model for `TSCE.VolatileDependenciesArchive`.
 final class TSCE_VolatileDependenciesArchive: IWAMessage {
-    var volatileTimeCellColumn: [UInt32] = []
-    var volatileTimeCellRow: [UInt32] = []
-    var volatileRandomCellColumn: [UInt32] = []
-    var volatileRandomCellRow: [UInt32] = []
-    var volatileLocaleCellColumn: [UInt32] = []
-    var volatileLocaleCellRow: [UInt32] = []
-    var volatileLocationCellColumn: [UInt32] = []
-    var volatileLocationCellRow: [UInt32] = []
-    var volatileCompassCellColumn: [UInt32] = []
-    var volatileCompassCellRow: [UInt32] = []
-    var volatileRemoteDataCellColumn: [UInt32] = []
-    var volatileRemoteDataCellRow: [UInt32] = []
-    var volatileSheetTableNameCellColumn: [UInt32] = []
-    var volatileSheetTableNameCellRow: [UInt32] = []
-    var calculatedDependencyCellColumn: [UInt32] = []
-    var calculatedDependencyCellRow: [UInt32] = []
-    var volatileGeometryCellReference: [TSCE_CellReferenceArchive] = []
-    var volatileGeometryCell: [TSCE_CellCoordinateArchive] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            if case .varint(let _u) = _f.value { volatileTimeCellColumn.append(UInt32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { volatileTimeCellColumn.append(UInt32(truncatingIfNeeded: _u)) } }
-        case 2:
-            if case .varint(let _u) = _f.value { volatileTimeCellRow.append(UInt32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { volatileTimeCellRow.append(UInt32(truncatingIfNeeded: _u)) } }
-        case 3:
-            if case .varint(let _u) = _f.value { volatileRandomCellColumn.append(UInt32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { volatileRandomCellColumn.append(UInt32(truncatingIfNeeded: _u)) } }
-        case 4:
-            if case .varint(let _u) = _f.value { volatileRandomCellRow.append(UInt32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { volatileRandomCellRow.append(UInt32(truncatingIfNeeded: _u)) } }
-        case 15:
-            if case .varint(let _u) = _f.value { volatileLocaleCellColumn.append(UInt32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { volatileLocaleCellColumn.append(UInt32(truncatingIfNeeded: _u)) } }
-        case 16:
-            if case .varint(let _u) = _f.value { volatileLocaleCellRow.append(UInt32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { volatileLocaleCellRow.append(UInt32(truncatingIfNeeded: _u)) } }
-        case 5:
-            if case .varint(let _u) = _f.value { volatileLocationCellColumn.append(UInt32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { volatileLocationCellColumn.append(UInt32(truncatingIfNeeded: _u)) } }
-        case 6:
-            if case .varint(let _u) = _f.value { volatileLocationCellRow.append(UInt32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { volatileLocationCellRow.append(UInt32(truncatingIfNeeded: _u)) } }
-        case 7:
-            if case .varint(let _u) = _f.value { volatileCompassCellColumn.append(UInt32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { volatileCompassCellColumn.append(UInt32(truncatingIfNeeded: _u)) } }
-        case 8:
-            if case .varint(let _u) = _f.value { volatileCompassCellRow.append(UInt32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { volatileCompassCellRow.append(UInt32(truncatingIfNeeded: _u)) } }
-        case 19:
-            if case .varint(let _u) = _f.value { volatileRemoteDataCellColumn.append(UInt32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { volatileRemoteDataCellColumn.append(UInt32(truncatingIfNeeded: _u)) } }
-        case 20:
-            if case .varint(let _u) = _f.value { volatileRemoteDataCellRow.append(UInt32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { volatileRemoteDataCellRow.append(UInt32(truncatingIfNeeded: _u)) } }
-        case 17:
-            if case .varint(let _u) = _f.value { volatileSheetTableNameCellColumn.append(UInt32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { volatileSheetTableNameCellColumn.append(UInt32(truncatingIfNeeded: _u)) } }
-        case 18:
-            if case .varint(let _u) = _f.value { volatileSheetTableNameCellRow.append(UInt32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { volatileSheetTableNameCellRow.append(UInt32(truncatingIfNeeded: _u)) } }
-        case 9:
-            if case .varint(let _u) = _f.value { calculatedDependencyCellColumn.append(UInt32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { calculatedDependencyCellColumn.append(UInt32(truncatingIfNeeded: _u)) } }
-        case 10:
-            if case .varint(let _u) = _f.value { calculatedDependencyCellRow.append(UInt32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { calculatedDependencyCellRow.append(UInt32(truncatingIfNeeded: _u)) } }
-        case 13:
-            var _v: TSCE_CellReferenceArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CellReferenceArchive(ProtobufMessage(_b)) }
-            if let _v { volatileGeometryCellReference.append(_v) }
-        case 11:
-            var _v: TSCE_CellCoordinateArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CellCoordinateArchive(ProtobufMessage(_b)) }
-            if let _v { volatileGeometryCell.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in volatileTimeCellColumn { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        for _x in volatileTimeCellRow { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        for _x in volatileRandomCellColumn { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        for _x in volatileRandomCellRow { _w.varintField(4, UInt64(truncatingIfNeeded: _x)) }
-        for _x in volatileLocaleCellColumn { _w.varintField(15, UInt64(truncatingIfNeeded: _x)) }
-        for _x in volatileLocaleCellRow { _w.varintField(16, UInt64(truncatingIfNeeded: _x)) }
-        for _x in volatileLocationCellColumn { _w.varintField(5, UInt64(truncatingIfNeeded: _x)) }
-        for _x in volatileLocationCellRow { _w.varintField(6, UInt64(truncatingIfNeeded: _x)) }
-        for _x in volatileCompassCellColumn { _w.varintField(7, UInt64(truncatingIfNeeded: _x)) }
-        for _x in volatileCompassCellRow { _w.varintField(8, UInt64(truncatingIfNeeded: _x)) }
-        for _x in volatileRemoteDataCellColumn { _w.varintField(19, UInt64(truncatingIfNeeded: _x)) }
-        for _x in volatileRemoteDataCellRow { _w.varintField(20, UInt64(truncatingIfNeeded: _x)) }
-        for _x in volatileSheetTableNameCellColumn { _w.varintField(17, UInt64(truncatingIfNeeded: _x)) }
-        for _x in volatileSheetTableNameCellRow { _w.varintField(18, UInt64(truncatingIfNeeded: _x)) }
-        for _x in calculatedDependencyCellColumn { _w.varintField(9, UInt64(truncatingIfNeeded: _x)) }
-        for _x in calculatedDependencyCellRow { _w.varintField(10, UInt64(truncatingIfNeeded: _x)) }
-        for _x in volatileGeometryCellReference { _w.bytesField(13, _x.encoded()) }
-        for _x in volatileGeometryCell { _w.bytesField(11, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.VolatileDependenciesArchive", [
+        .repeated(1, .uint32), .repeated(2, .uint32), .repeated(3, .uint32), .repeated(4, .uint32),
+        .repeated(15, .uint32), .repeated(16, .uint32), .repeated(5, .uint32), .repeated(6, .uint32),
+        .repeated(7, .uint32), .repeated(8, .uint32), .repeated(19, .uint32), .repeated(20, .uint32),
+        .repeated(17, .uint32), .repeated(18, .uint32), .repeated(9, .uint32), .repeated(10, .uint32),
+        .repeated(13, TSCE_CellReferenceArchive.self), .repeated(11, TSCE_CellCoordinateArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 18)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var volatileTimeCellColumn: [UInt32] { get { self[all: 0] } set { self[all: 0] = newValue } }
+    func append(volatileTimeCellColumn value: UInt32) { append(value, toAll: 0) }
+    var volatileTimeCellRow: [UInt32] { get { self[all: 1] } set { self[all: 1] = newValue } }
+    func append(volatileTimeCellRow value: UInt32) { append(value, toAll: 1) }
+    var volatileRandomCellColumn: [UInt32] { get { self[all: 2] } set { self[all: 2] = newValue } }
+    func append(volatileRandomCellColumn value: UInt32) { append(value, toAll: 2) }
+    var volatileRandomCellRow: [UInt32] { get { self[all: 3] } set { self[all: 3] = newValue } }
+    func append(volatileRandomCellRow value: UInt32) { append(value, toAll: 3) }
+    var volatileLocaleCellColumn: [UInt32] { get { self[all: 4] } set { self[all: 4] = newValue } }
+    func append(volatileLocaleCellColumn value: UInt32) { append(value, toAll: 4) }
+    var volatileLocaleCellRow: [UInt32] { get { self[all: 5] } set { self[all: 5] = newValue } }
+    func append(volatileLocaleCellRow value: UInt32) { append(value, toAll: 5) }
+    var volatileLocationCellColumn: [UInt32] { get { self[all: 6] } set { self[all: 6] = newValue } }
+    func append(volatileLocationCellColumn value: UInt32) { append(value, toAll: 6) }
+    var volatileLocationCellRow: [UInt32] { get { self[all: 7] } set { self[all: 7] = newValue } }
+    func append(volatileLocationCellRow value: UInt32) { append(value, toAll: 7) }
+    var volatileCompassCellColumn: [UInt32] { get { self[all: 8] } set { self[all: 8] = newValue } }
+    func append(volatileCompassCellColumn value: UInt32) { append(value, toAll: 8) }
+    var volatileCompassCellRow: [UInt32] { get { self[all: 9] } set { self[all: 9] = newValue } }
+    func append(volatileCompassCellRow value: UInt32) { append(value, toAll: 9) }
+    var volatileRemoteDataCellColumn: [UInt32] { get { self[all: 10] } set { self[all: 10] = newValue } }
+    func append(volatileRemoteDataCellColumn value: UInt32) { append(value, toAll: 10) }
+    var volatileRemoteDataCellRow: [UInt32] { get { self[all: 11] } set { self[all: 11] = newValue } }
+    func append(volatileRemoteDataCellRow value: UInt32) { append(value, toAll: 11) }
+    var volatileSheetTableNameCellColumn: [UInt32] { get { self[all: 12] } set { self[all: 12] = newValue } }
+    func append(volatileSheetTableNameCellColumn value: UInt32) { append(value, toAll: 12) }
+    var volatileSheetTableNameCellRow: [UInt32] { get { self[all: 13] } set { self[all: 13] = newValue } }
+    func append(volatileSheetTableNameCellRow value: UInt32) { append(value, toAll: 13) }
+    var calculatedDependencyCellColumn: [UInt32] { get { self[all: 14] } set { self[all: 14] = newValue } }
+    func append(calculatedDependencyCellColumn value: UInt32) { append(value, toAll: 14) }
+    var calculatedDependencyCellRow: [UInt32] { get { self[all: 15] } set { self[all: 15] = newValue } }
+    func append(calculatedDependencyCellRow value: UInt32) { append(value, toAll: 15) }
+    var volatileGeometryCellReference: [TSCE_CellReferenceArchive] { get { self[messages: 16] } set { self[messages: 16] = newValue } }
+    func append(volatileGeometryCellReference value: TSCE_CellReferenceArchive) { append(value, toMessages: 16) }
+    var volatileGeometryCell: [TSCE_CellCoordinateArchive] { get { self[messages: 17] } set { self[messages: 17] = newValue } }
+    func append(volatileGeometryCell value: TSCE_CellCoordinateArchive) { append(value, toMessages: 17) }
 }
 
 /// Generated wire model for `TSCE.VolatileDependenciesExpandedArchive`.
 final class TSCE_VolatileDependenciesExpandedArchive: IWAMessage {
-    var volatileTimeCells: TSCE_CellCoordSetArchive?
-    var volatileRandomCells: TSCE_CellCoordSetArchive?
-    var volatileLocaleCells: TSCE_CellCoordSetArchive?
-    var volatileSheetTableNameCells: TSCE_CellCoordSetArchive?
-    var volatileRemoteDataCells: TSCE_CellCoordSetArchive?
-    var volatileGeometryCellRefs: TSCE_InternalCellRefSetArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSCE_CellCoordSetArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CellCoordSetArchive(ProtobufMessage(_b)) }
-            if let _v { volatileTimeCells = _v }
-        case 2:
-            var _v: TSCE_CellCoordSetArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CellCoordSetArchive(ProtobufMessage(_b)) }
-            if let _v { volatileRandomCells = _v }
-        case 3:
-            var _v: TSCE_CellCoordSetArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CellCoordSetArchive(ProtobufMessage(_b)) }
-            if let _v { volatileLocaleCells = _v }
-        case 4:
-            var _v: TSCE_CellCoordSetArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CellCoordSetArchive(ProtobufMessage(_b)) }
-            if let _v { volatileSheetTableNameCells = _v }
-        case 5:
-            var _v: TSCE_CellCoordSetArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CellCoordSetArchive(ProtobufMessage(_b)) }
-            if let _v { volatileRemoteDataCells = _v }
-        case 7:
-            var _v: TSCE_InternalCellRefSetArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_InternalCellRefSetArchive(ProtobufMessage(_b)) }
-            if let _v { volatileGeometryCellRefs = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = volatileTimeCells { _w.bytesField(1, _x.encoded()) }
-        if let _x = volatileRandomCells { _w.bytesField(2, _x.encoded()) }
-        if let _x = volatileLocaleCells { _w.bytesField(3, _x.encoded()) }
-        if let _x = volatileSheetTableNameCells { _w.bytesField(4, _x.encoded()) }
-        if let _x = volatileRemoteDataCells { _w.bytesField(5, _x.encoded()) }
-        if let _x = volatileGeometryCellRefs { _w.bytesField(7, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.VolatileDependenciesExpandedArchive", [
+        .optional(1, TSCE_CellCoordSetArchive.self), .optional(2, TSCE_CellCoordSetArchive.self),
+        .optional(3, TSCE_CellCoordSetArchive.self), .optional(4, TSCE_CellCoordSetArchive.self),
+        .optional(5, TSCE_CellCoordSetArchive.self), .optional(7, TSCE_InternalCellRefSetArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 6)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var volatileTimeCells: TSCE_CellCoordSetArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var volatileRandomCells: TSCE_CellCoordSetArchive? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var volatileLocaleCells: TSCE_CellCoordSetArchive? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var volatileSheetTableNameCells: TSCE_CellCoordSetArchive? { get { self[message: 3] } set { self[message: 3] = newValue } }
+    var volatileRemoteDataCells: TSCE_CellCoordSetArchive? { get { self[message: 4] } set { self[message: 4] = newValue } }
+    var volatileGeometryCellRefs: TSCE_InternalCellRefSetArchive? { get { self[message: 5] } set { self[message: 5] = newValue } }
 }
 
 /// Generated wire model for `TSCE.RTreeInternalNodeContentsArchive`.
 final class TSCE_RTreeInternalNodeContentsArchive: IWAMessage {
-    var min: [UInt32] = []
-    var max: [UInt32] = []
-    var child: TSCE_RTreeNodeArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            if case .varint(let _u) = _f.value { min.append(UInt32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { min.append(UInt32(truncatingIfNeeded: _u)) } }
-        case 2:
-            if case .varint(let _u) = _f.value { max.append(UInt32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { max.append(UInt32(truncatingIfNeeded: _u)) } }
-        case 3:
-            var _v: TSCE_RTreeNodeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_RTreeNodeArchive(ProtobufMessage(_b)) }
-            if let _v { child = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in min { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        for _x in max { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = child { _w.bytesField(3, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.RTreeInternalNodeContentsArchive", [
+        .repeated(1, .uint32), .repeated(2, .uint32), .optional(3, TSCE_RTreeNodeArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var min: [UInt32] { get { self[all: 0] } set { self[all: 0] = newValue } }
+    func append(min value: UInt32) { append(value, toAll: 0) }
+    var max: [UInt32] { get { self[all: 1] } set { self[all: 1] = newValue } }
+    func append(max value: UInt32) { append(value, toAll: 1) }
+    var child: TSCE_RTreeNodeArchive? { get { self[message: 2] } set { self[message: 2] = newValue } }
 }
 
 /// Generated wire model for `TSCE.RTreeLeafNodeContentsArchive`.
 final class TSCE_RTreeLeafNodeContentsArchive: IWAMessage {
-    var min: [UInt32] = []
-    var max: [UInt32] = []
-    var cellReference: TSCE_CellReferenceArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            if case .varint(let _u) = _f.value { min.append(UInt32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { min.append(UInt32(truncatingIfNeeded: _u)) } }
-        case 2:
-            if case .varint(let _u) = _f.value { max.append(UInt32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { max.append(UInt32(truncatingIfNeeded: _u)) } }
-        case 3:
-            var _v: TSCE_CellReferenceArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CellReferenceArchive(ProtobufMessage(_b)) }
-            if let _v { cellReference = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in min { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        for _x in max { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = cellReference { _w.bytesField(3, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.RTreeLeafNodeContentsArchive", [
+        .repeated(1, .uint32), .repeated(2, .uint32), .optional(3, TSCE_CellReferenceArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var min: [UInt32] { get { self[all: 0] } set { self[all: 0] = newValue } }
+    func append(min value: UInt32) { append(value, toAll: 0) }
+    var max: [UInt32] { get { self[all: 1] } set { self[all: 1] = newValue } }
+    func append(max value: UInt32) { append(value, toAll: 1) }
+    var cellReference: TSCE_CellReferenceArchive? { get { self[message: 2] } set { self[message: 2] = newValue } }
 }
 
 /// Generated wire model for `TSCE.RTreeNodeArchive`.
 final class TSCE_RTreeNodeArchive: IWAMessage {
-    var level: UInt32?
-    var count: UInt32?
-    var internalNodeContents: [TSCE_RTreeInternalNodeContentsArchive] = []
-    var leafNodeContents: [TSCE_RTreeLeafNodeContentsArchive] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { level = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { count = _v }
-        case 3:
-            var _v: TSCE_RTreeInternalNodeContentsArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_RTreeInternalNodeContentsArchive(ProtobufMessage(_b)) }
-            if let _v { internalNodeContents.append(_v) }
-        case 4:
-            var _v: TSCE_RTreeLeafNodeContentsArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_RTreeLeafNodeContentsArchive(ProtobufMessage(_b)) }
-            if let _v { leafNodeContents.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = level { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = count { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        for _x in internalNodeContents { _w.bytesField(3, _x.encoded()) }
-        for _x in leafNodeContents { _w.bytesField(4, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.RTreeNodeArchive", [
+        .optional(1, .uint32), .optional(2, .uint32), .repeated(3, TSCE_RTreeInternalNodeContentsArchive.self),
+        .repeated(4, TSCE_RTreeLeafNodeContentsArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var level: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var count: UInt32? { get { self[1] } set { self[1] = newValue } }
+    var internalNodeContents: [TSCE_RTreeInternalNodeContentsArchive] { get { self[messages: 2] } set { self[messages: 2] = newValue } }
+    func append(internalNodeContents value: TSCE_RTreeInternalNodeContentsArchive) { append(value, toMessages: 2) }
+    var leafNodeContents: [TSCE_RTreeLeafNodeContentsArchive] { get { self[messages: 3] } set { self[messages: 3] = newValue } }
+    func append(leafNodeContents value: TSCE_RTreeLeafNodeContentsArchive) { append(value, toMessages: 3) }
 }
 
 /// Generated wire model for `TSCE.RTreeArchive`.
 final class TSCE_RTreeArchive: IWAMessage {
-    var dataFileId: UInt32?
-    var dataSize: UInt32?
-    var dataNumDims: UInt32?
-    var dataElemSize: UInt32?
-    var dataElemRealSize: UInt32?
-    var dataMaxNodes: UInt32?
-    var dataMinNodes: UInt32?
-    var root: TSCE_RTreeNodeArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { dataFileId = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { dataSize = _v }
-        case 3:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { dataNumDims = _v }
-        case 4:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { dataElemSize = _v }
-        case 5:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { dataElemRealSize = _v }
-        case 6:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { dataMaxNodes = _v }
-        case 7:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { dataMinNodes = _v }
-        case 8:
-            var _v: TSCE_RTreeNodeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_RTreeNodeArchive(ProtobufMessage(_b)) }
-            if let _v { root = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = dataFileId { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = dataSize { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = dataNumDims { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = dataElemSize { _w.varintField(4, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = dataElemRealSize { _w.varintField(5, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = dataMaxNodes { _w.varintField(6, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = dataMinNodes { _w.varintField(7, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = root { _w.bytesField(8, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.RTreeArchive", [
+        .optional(1, .uint32), .optional(2, .uint32), .optional(3, .uint32), .optional(4, .uint32),
+        .optional(5, .uint32), .optional(6, .uint32), .optional(7, .uint32), .optional(8, TSCE_RTreeNodeArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 8)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var dataFileId: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var dataSize: UInt32? { get { self[1] } set { self[1] = newValue } }
+    var dataNumDims: UInt32? { get { self[2] } set { self[2] = newValue } }
+    var dataElemSize: UInt32? { get { self[3] } set { self[3] = newValue } }
+    var dataElemRealSize: UInt32? { get { self[4] } set { self[4] = newValue } }
+    var dataMaxNodes: UInt32? { get { self[5] } set { self[5] = newValue } }
+    var dataMinNodes: UInt32? { get { self[6] } set { self[6] = newValue } }
+    var root: TSCE_RTreeNodeArchive? { get { self[message: 7] } set { self[message: 7] = newValue } }
 }
 
 /// Generated wire model for `TSCE.RangeBackDependencyArchive`.
 final class TSCE_RangeBackDependencyArchive: IWAMessage {
-    var cellCoordRow: UInt32?
-    var cellCoordColumn: UInt32?
-    var rangeReference: TSCE_RangeReferenceArchive?
-    var internalRangeReference: TSCE_InternalRangeReferenceArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { cellCoordRow = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { cellCoordColumn = _v }
-        case 3:
-            var _v: TSCE_RangeReferenceArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_RangeReferenceArchive(ProtobufMessage(_b)) }
-            if let _v { rangeReference = _v }
-        case 4:
-            var _v: TSCE_InternalRangeReferenceArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_InternalRangeReferenceArchive(ProtobufMessage(_b)) }
-            if let _v { internalRangeReference = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = cellCoordRow { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = cellCoordColumn { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = rangeReference { _w.bytesField(3, _x.encoded()) }
-        if let _x = internalRangeReference { _w.bytesField(4, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.RangeBackDependencyArchive", [
+        .optional(1, .uint32), .optional(2, .uint32), .optional(3, TSCE_RangeReferenceArchive.self),
+        .optional(4, TSCE_InternalRangeReferenceArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var cellCoordRow: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var cellCoordColumn: UInt32? { get { self[1] } set { self[1] = newValue } }
+    var rangeReference: TSCE_RangeReferenceArchive? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var internalRangeReference: TSCE_InternalRangeReferenceArchive? { get { self[message: 3] } set { self[message: 3] = newValue } }
 }
 
 /// Generated wire model for `TSCE.RangeDependenciesArchive`.
 final class TSCE_RangeDependenciesArchive: IWAMessage {
-    var backDependency: [TSCE_RangeBackDependencyArchive] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 2:
-            var _v: TSCE_RangeBackDependencyArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_RangeBackDependencyArchive(ProtobufMessage(_b)) }
-            if let _v { backDependency.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in backDependency { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.RangeDependenciesArchive", [
+        .repeated(2, TSCE_RangeBackDependencyArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var backDependency: [TSCE_RangeBackDependencyArchive] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(backDependency value: TSCE_RangeBackDependencyArchive) { append(value, toMessages: 0) }
 }
 
 /// Generated wire model for `TSCE.RangePrecedentsTileArchive`.
 final class TSCE_RangePrecedentsTileArchive: IWAMessage {
-    var toOwnerId: UInt32?
-    var fromToRange: [TSCE_RangePrecedentsTileArchive_FromToRangeArchive] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { toOwnerId = _v }
-        case 2:
-            var _v: TSCE_RangePrecedentsTileArchive_FromToRangeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_RangePrecedentsTileArchive_FromToRangeArchive(ProtobufMessage(_b)) }
-            if let _v { fromToRange.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = toOwnerId { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        for _x in fromToRange { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.RangePrecedentsTileArchive", [
+        .optional(1, .uint32), .repeated(2, TSCE_RangePrecedentsTileArchive_FromToRangeArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var toOwnerId: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var fromToRange: [TSCE_RangePrecedentsTileArchive_FromToRangeArchive] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(fromToRange value: TSCE_RangePrecedentsTileArchive_FromToRangeArchive) { append(value, toMessages: 1) }
 }
 
 /// Generated wire model for `TSCE.RangePrecedentsTileArchive.FromToRangeArchive`.
 final class TSCE_RangePrecedentsTileArchive_FromToRangeArchive: IWAMessage {
-    var fromCoord: TSCE_CellCoordinateArchive?
-    var refersToRect: TSCE_CellRectArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSCE_CellCoordinateArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CellCoordinateArchive(ProtobufMessage(_b)) }
-            if let _v { fromCoord = _v }
-        case 2:
-            var _v: TSCE_CellRectArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CellRectArchive(ProtobufMessage(_b)) }
-            if let _v { refersToRect = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = fromCoord { _w.bytesField(1, _x.encoded()) }
-        if let _x = refersToRect { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.RangePrecedentsTileArchive.FromToRangeArchive", [
+        .optional(1, TSCE_CellCoordinateArchive.self), .optional(2, TSCE_CellRectArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var fromCoord: TSCE_CellCoordinateArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var refersToRect: TSCE_CellRectArchive? { get { self[message: 1] } set { self[message: 1] = newValue } }
 }
 
 /// Generated wire model for `TSCE.RangeDependenciesTiledArchive`.
 final class TSCE_RangeDependenciesTiledArchive: IWAMessage {
-    var rangePrecedentsTile: [TSP_Reference] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { rangePrecedentsTile.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in rangePrecedentsTile { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.RangeDependenciesTiledArchive", [
+        .repeated(1, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var rangePrecedentsTile: [TSP_Reference] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(rangePrecedentsTile value: TSP_Reference) { append(value, toMessages: 0) }
 }
 
 /// Generated wire model for `TSCE.SpanningDependenciesArchive`.
 final class TSCE_SpanningDependenciesArchive: IWAMessage {
-    var column: [UInt32] = []
-    var rangeContext: [Int32] = []
-    var cell: [TSCE_CellReferenceArchive] = []
-    var totalRangeForDeletedTable: TSCE_RangeCoordinateArchive?
-    var bodyRangeForDeletedTable: TSCE_RangeCoordinateArchive?
-    var referringColumnToLocalCells: [TSCE_SpanningDependenciesArchive_ReferringColumnToLocalCells] = []
-    var referringColumnToRemoteCells: [TSCE_SpanningDependenciesArchive_ReferringColumnToRemoteCells] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            if case .varint(let _u) = _f.value { column.append(UInt32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { column.append(UInt32(truncatingIfNeeded: _u)) } }
-        case 2:
-            if case .varint(let _u) = _f.value { rangeContext.append(Int32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { rangeContext.append(Int32(truncatingIfNeeded: _u)) } }
-        case 3:
-            var _v: TSCE_CellReferenceArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CellReferenceArchive(ProtobufMessage(_b)) }
-            if let _v { cell.append(_v) }
-        case 4:
-            var _v: TSCE_RangeCoordinateArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_RangeCoordinateArchive(ProtobufMessage(_b)) }
-            if let _v { totalRangeForDeletedTable = _v }
-        case 5:
-            var _v: TSCE_RangeCoordinateArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_RangeCoordinateArchive(ProtobufMessage(_b)) }
-            if let _v { bodyRangeForDeletedTable = _v }
-        case 6:
-            var _v: TSCE_SpanningDependenciesArchive_ReferringColumnToLocalCells?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_SpanningDependenciesArchive_ReferringColumnToLocalCells(ProtobufMessage(_b)) }
-            if let _v { referringColumnToLocalCells.append(_v) }
-        case 7:
-            var _v: TSCE_SpanningDependenciesArchive_ReferringColumnToRemoteCells?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_SpanningDependenciesArchive_ReferringColumnToRemoteCells(ProtobufMessage(_b)) }
-            if let _v { referringColumnToRemoteCells.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in column { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        for _x in rangeContext { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        for _x in cell { _w.bytesField(3, _x.encoded()) }
-        if let _x = totalRangeForDeletedTable { _w.bytesField(4, _x.encoded()) }
-        if let _x = bodyRangeForDeletedTable { _w.bytesField(5, _x.encoded()) }
-        for _x in referringColumnToLocalCells { _w.bytesField(6, _x.encoded()) }
-        for _x in referringColumnToRemoteCells { _w.bytesField(7, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.SpanningDependenciesArchive", [
+        .repeated(1, .uint32), .repeated(2, .int32), .repeated(3, TSCE_CellReferenceArchive.self),
+        .optional(4, TSCE_RangeCoordinateArchive.self), .optional(5, TSCE_RangeCoordinateArchive.self),
+        .repeated(6, TSCE_SpanningDependenciesArchive_ReferringColumnToLocalCells.self),
+        .repeated(7, TSCE_SpanningDependenciesArchive_ReferringColumnToRemoteCells.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 7)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var column: [UInt32] { get { self[all: 0] } set { self[all: 0] = newValue } }
+    func append(column value: UInt32) { append(value, toAll: 0) }
+    var rangeContext: [Int32] { get { self[all: 1] } set { self[all: 1] = newValue } }
+    func append(rangeContext value: Int32) { append(value, toAll: 1) }
+    var cell: [TSCE_CellReferenceArchive] { get { self[messages: 2] } set { self[messages: 2] = newValue } }
+    func append(cell value: TSCE_CellReferenceArchive) { append(value, toMessages: 2) }
+    var totalRangeForDeletedTable: TSCE_RangeCoordinateArchive? { get { self[message: 3] } set { self[message: 3] = newValue } }
+    var bodyRangeForDeletedTable: TSCE_RangeCoordinateArchive? { get { self[message: 4] } set { self[message: 4] = newValue } }
+    var referringColumnToLocalCells: [TSCE_SpanningDependenciesArchive_ReferringColumnToLocalCells] { get { self[messages: 5] } set { self[messages: 5] = newValue } }
+    func append(referringColumnToLocalCells value: TSCE_SpanningDependenciesArchive_ReferringColumnToLocalCells) { append(value, toMessages: 5) }
+    var referringColumnToRemoteCells: [TSCE_SpanningDependenciesArchive_ReferringColumnToRemoteCells] { get { self[messages: 6] } set { self[messages: 6] = newValue } }
+    func append(referringColumnToRemoteCells value: TSCE_SpanningDependenciesArchive_ReferringColumnToRemoteCells) { append(value, toMessages: 6) }
 }
 
 /// Generated wire model for `TSCE.SpanningDependenciesArchive.ReferringColumnToLocalCells`.
 final class TSCE_SpanningDependenciesArchive_ReferringColumnToLocalCells: IWAMessage {
-    var column: UInt32?
-    var rangeContext: Int32?
-    var cellCoordinate: [TSCE_CellCoordinateArchive] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { column = _v }
-        case 2:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { rangeContext = _v }
-        case 3:
-            var _v: TSCE_CellCoordinateArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CellCoordinateArchive(ProtobufMessage(_b)) }
-            if let _v { cellCoordinate.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = column { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = rangeContext { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        for _x in cellCoordinate { _w.bytesField(3, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.SpanningDependenciesArchive.ReferringColumnToLocalCells", [
+        .optional(1, .uint32), .optional(2, .int32), .repeated(3, TSCE_CellCoordinateArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var column: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var rangeContext: Int32? { get { self[1] } set { self[1] = newValue } }
+    var cellCoordinate: [TSCE_CellCoordinateArchive] { get { self[messages: 2] } set { self[messages: 2] = newValue } }
+    func append(cellCoordinate value: TSCE_CellCoordinateArchive) { append(value, toMessages: 2) }
 }
 
 /// Generated wire model for `TSCE.SpanningDependenciesArchive.ReferringColumnToRemoteCells`.
 final class TSCE_SpanningDependenciesArchive_ReferringColumnToRemoteCells: IWAMessage {
-    var column: UInt32?
-    var rangeContext: Int32?
-    var internalCellReference: [TSCE_InternalCellReferenceArchive] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { column = _v }
-        case 2:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { rangeContext = _v }
-        case 3:
-            var _v: TSCE_InternalCellReferenceArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_InternalCellReferenceArchive(ProtobufMessage(_b)) }
-            if let _v { internalCellReference.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = column { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = rangeContext { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        for _x in internalCellReference { _w.bytesField(3, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.SpanningDependenciesArchive.ReferringColumnToRemoteCells", [
+        .optional(1, .uint32), .optional(2, .int32), .repeated(3, TSCE_InternalCellReferenceArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var column: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var rangeContext: Int32? { get { self[1] } set { self[1] = newValue } }
+    var internalCellReference: [TSCE_InternalCellReferenceArchive] { get { self[messages: 2] } set { self[messages: 2] = newValue } }
+    func append(internalCellReference value: TSCE_InternalCellReferenceArchive) { append(value, toMessages: 2) }
 }
 
 /// Generated wire model for `TSCE.SpanningDependenciesExpandedArchive`.
 final class TSCE_SpanningDependenciesExpandedArchive: IWAMessage {
-    var coordRefersToSpans: [TSCE_SpanningDependenciesExpandedArchive_CellCoordRefersToExtents] = []
-    var totalRangeForTable: TSCE_RangeCoordinateArchive?
-    var bodyRangeForTable: TSCE_RangeCoordinateArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSCE_SpanningDependenciesExpandedArchive_CellCoordRefersToExtents?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_SpanningDependenciesExpandedArchive_CellCoordRefersToExtents(ProtobufMessage(_b)) }
-            if let _v { coordRefersToSpans.append(_v) }
-        case 2:
-            var _v: TSCE_RangeCoordinateArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_RangeCoordinateArchive(ProtobufMessage(_b)) }
-            if let _v { totalRangeForTable = _v }
-        case 3:
-            var _v: TSCE_RangeCoordinateArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_RangeCoordinateArchive(ProtobufMessage(_b)) }
-            if let _v { bodyRangeForTable = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in coordRefersToSpans { _w.bytesField(1, _x.encoded()) }
-        if let _x = totalRangeForTable { _w.bytesField(2, _x.encoded()) }
-        if let _x = bodyRangeForTable { _w.bytesField(3, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.SpanningDependenciesExpandedArchive", [
+        .repeated(1, TSCE_SpanningDependenciesExpandedArchive_CellCoordRefersToExtents.self),
+        .optional(2, TSCE_RangeCoordinateArchive.self), .optional(3, TSCE_RangeCoordinateArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var coordRefersToSpans: [TSCE_SpanningDependenciesExpandedArchive_CellCoordRefersToExtents] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(coordRefersToSpans value: TSCE_SpanningDependenciesExpandedArchive_CellCoordRefersToExtents) { append(value, toMessages: 0) }
+    var totalRangeForTable: TSCE_RangeCoordinateArchive? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var bodyRangeForTable: TSCE_RangeCoordinateArchive? { get { self[message: 2] } set { self[message: 2] = newValue } }
 }
 
 /// Generated wire model for `TSCE.SpanningDependenciesExpandedArchive.ExtentRange`.
 final class TSCE_SpanningDependenciesExpandedArchive_ExtentRange: IWAMessage {
-    var extentBegin: UInt32?
-    var extentEnd: UInt32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { extentBegin = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { extentEnd = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = extentBegin { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = extentEnd { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.SpanningDependenciesExpandedArchive.ExtentRange", [
+        .optional(1, .uint32), .optional(2, .uint32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var extentBegin: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var extentEnd: UInt32? { get { self[1] } set { self[1] = newValue } }
 }
 
 /// Generated wire model for `TSCE.SpanningDependenciesExpandedArchive.ExtentRangeWithTableWithContext`.
 final class TSCE_SpanningDependenciesExpandedArchive_ExtentRangeWithTableWithContext: IWAMessage {
-    var ownerId: UInt32?
-    var rangeContext: Int32?
-    var ranges: [TSCE_SpanningDependenciesExpandedArchive_ExtentRange] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { ownerId = _v }
-        case 2:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { rangeContext = _v }
-        case 3:
-            var _v: TSCE_SpanningDependenciesExpandedArchive_ExtentRange?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_SpanningDependenciesExpandedArchive_ExtentRange(ProtobufMessage(_b)) }
-            if let _v { ranges.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = ownerId { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = rangeContext { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        for _x in ranges { _w.bytesField(3, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.SpanningDependenciesExpandedArchive.ExtentRangeWithTableWithContext", [
+        .optional(1, .uint32), .optional(2, .int32),
+        .repeated(3, TSCE_SpanningDependenciesExpandedArchive_ExtentRange.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var ownerId: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var rangeContext: Int32? { get { self[1] } set { self[1] = newValue } }
+    var ranges: [TSCE_SpanningDependenciesExpandedArchive_ExtentRange] { get { self[messages: 2] } set { self[messages: 2] = newValue } }
+    func append(ranges value: TSCE_SpanningDependenciesExpandedArchive_ExtentRange) { append(value, toMessages: 2) }
 }
 
 /// Generated wire model for `TSCE.SpanningDependenciesExpandedArchive.CellCoordRefersToExtents`.
 final class TSCE_SpanningDependenciesExpandedArchive_CellCoordRefersToExtents: IWAMessage {
-    var coordinate: TSCE_CellCoordinateArchive?
-    var rangesByTableContext: [TSCE_SpanningDependenciesExpandedArchive_ExtentRangeWithTableWithContext] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSCE_CellCoordinateArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CellCoordinateArchive(ProtobufMessage(_b)) }
-            if let _v { coordinate = _v }
-        case 2:
-            var _v: TSCE_SpanningDependenciesExpandedArchive_ExtentRangeWithTableWithContext?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_SpanningDependenciesExpandedArchive_ExtentRangeWithTableWithContext(ProtobufMessage(_b)) }
-            if let _v { rangesByTableContext.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = coordinate { _w.bytesField(1, _x.encoded()) }
-        for _x in rangesByTableContext { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.SpanningDependenciesExpandedArchive.CellCoordRefersToExtents", [
+        .optional(1, TSCE_CellCoordinateArchive.self),
+        .repeated(2, TSCE_SpanningDependenciesExpandedArchive_ExtentRangeWithTableWithContext.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var coordinate: TSCE_CellCoordinateArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var rangesByTableContext: [TSCE_SpanningDependenciesExpandedArchive_ExtentRangeWithTableWithContext] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(rangesByTableContext value: TSCE_SpanningDependenciesExpandedArchive_ExtentRangeWithTableWithContext) { append(value, toMessages: 1) }
 }
 
 /// Generated wire model for `TSCE.WholeOwnerDependenciesArchive`.
 final class TSCE_WholeOwnerDependenciesArchive: IWAMessage {
-    var dependentCell: [TSCE_InternalCellReferenceArchive] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSCE_InternalCellReferenceArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_InternalCellReferenceArchive(ProtobufMessage(_b)) }
-            if let _v { dependentCell.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in dependentCell { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.WholeOwnerDependenciesArchive", [
+        .repeated(1, TSCE_InternalCellReferenceArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var dependentCell: [TSCE_InternalCellReferenceArchive] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(dependentCell value: TSCE_InternalCellReferenceArchive) { append(value, toMessages: 0) }
 }
 
 /// Generated wire model for `TSCE.WholeOwnerDependenciesExpandedArchive`.
 final class TSCE_WholeOwnerDependenciesExpandedArchive: IWAMessage {
-    var dependentCells: TSCE_InternalCellRefSetArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSCE_InternalCellRefSetArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_InternalCellRefSetArchive(ProtobufMessage(_b)) }
-            if let _v { dependentCells = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = dependentCells { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.WholeOwnerDependenciesExpandedArchive", [
+        .optional(1, TSCE_InternalCellRefSetArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var dependentCells: TSCE_InternalCellRefSetArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
 }
 
 /// Generated wire model for `TSCE.ErrorArchive`.
 final class TSCE_ErrorArchive: IWAMessage {
-    var errorTypeCode: UInt32?
-    var errorInfoDictionary: [TSCE_ErrorArchive_ErrorDictionaryEntry] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { errorTypeCode = _v }
-        case 2:
-            var _v: TSCE_ErrorArchive_ErrorDictionaryEntry?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_ErrorArchive_ErrorDictionaryEntry(ProtobufMessage(_b)) }
-            if let _v { errorInfoDictionary.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = errorTypeCode { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        for _x in errorInfoDictionary { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.ErrorArchive", [
+        .optional(1, .uint32), .repeated(2, TSCE_ErrorArchive_ErrorDictionaryEntry.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var errorTypeCode: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var errorInfoDictionary: [TSCE_ErrorArchive_ErrorDictionaryEntry] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(errorInfoDictionary value: TSCE_ErrorArchive_ErrorDictionaryEntry) { append(value, toMessages: 1) }
 }
 
 /// Generated wire model for `TSCE.ErrorArchive.ErrorDictionaryEntry`.
 final class TSCE_ErrorArchive_ErrorDictionaryEntry: IWAMessage {
-    var errorKey: String?
-    var valueForKeyString: String?
-    var valueForKeyNumber: Double?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { errorKey = _v }
-        case 2:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { valueForKeyString = _v }
-        case 3:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { valueForKeyNumber = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = errorKey { _w.stringField(1, _x) }
-        if let _x = valueForKeyString { _w.stringField(2, _x) }
-        if let _x = valueForKeyNumber { _w.fixed64Field(3, _x.bitPattern) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.ErrorArchive.ErrorDictionaryEntry", [
+        .optional(1, .string), .optional(2, .string), .optional(3, .double),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var errorKey: String? { get { self[0] } set { self[0] = newValue } }
+    var valueForKeyString: String? { get { self[1] } set { self[1] = newValue } }
+    var valueForKeyNumber: Double? { get { self[2] } set { self[2] = newValue } }
 }
 
 /// Generated wire model for `TSCE.WarningArchive`.
 final class TSCE_WarningArchive: IWAMessage {
-    var warningType: UInt32?
-    var warningInfoDictionary: [TSCE_WarningArchive_WarningDictionaryEntry] = []
-    var rangeRef: TSCE_RangeReferenceArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { warningType = _v }
-        case 2:
-            var _v: TSCE_WarningArchive_WarningDictionaryEntry?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_WarningArchive_WarningDictionaryEntry(ProtobufMessage(_b)) }
-            if let _v { warningInfoDictionary.append(_v) }
-        case 3:
-            var _v: TSCE_RangeReferenceArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_RangeReferenceArchive(ProtobufMessage(_b)) }
-            if let _v { rangeRef = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = warningType { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        for _x in warningInfoDictionary { _w.bytesField(2, _x.encoded()) }
-        if let _x = rangeRef { _w.bytesField(3, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.WarningArchive", [
+        .optional(1, .uint32), .repeated(2, TSCE_WarningArchive_WarningDictionaryEntry.self),
+        .optional(3, TSCE_RangeReferenceArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var warningType: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var warningInfoDictionary: [TSCE_WarningArchive_WarningDictionaryEntry] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(warningInfoDictionary value: TSCE_WarningArchive_WarningDictionaryEntry) { append(value, toMessages: 1) }
+    var rangeRef: TSCE_RangeReferenceArchive? { get { self[message: 2] } set { self[message: 2] = newValue } }
 }
 
 /// Generated wire model for `TSCE.WarningArchive.WarningDictionaryEntry`.
 final class TSCE_WarningArchive_WarningDictionaryEntry: IWAMessage {
-    var warningKey: String?
-    var valueForKeyString: String?
-    var valueForKeyNumber: Double?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { warningKey = _v }
-        case 2:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { valueForKeyString = _v }
-        case 3:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { valueForKeyNumber = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = warningKey { _w.stringField(1, _x) }
-        if let _x = valueForKeyString { _w.stringField(2, _x) }
-        if let _x = valueForKeyNumber { _w.fixed64Field(3, _x.bitPattern) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.WarningArchive.WarningDictionaryEntry", [
+        .optional(1, .string), .optional(2, .string), .optional(3, .double),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var warningKey: String? { get { self[0] } set { self[0] = newValue } }
+    var valueForKeyString: String? { get { self[1] } set { self[1] = newValue } }
+    var valueForKeyNumber: Double? { get { self[2] } set { self[2] = newValue } }
 }
 
 /// Generated wire model for `TSCE.CellErrorsArchive`.
 final class TSCE_CellErrorsArchive: IWAMessage {
-    var errors: [TSCE_CellErrorsArchive_ErrorForCell] = []
-    var enhancedErrors: [TSCE_CellErrorsArchive_EnhancedErrorForCell] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSCE_CellErrorsArchive_ErrorForCell?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CellErrorsArchive_ErrorForCell(ProtobufMessage(_b)) }
-            if let _v { errors.append(_v) }
-        case 2:
-            var _v: TSCE_CellErrorsArchive_EnhancedErrorForCell?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CellErrorsArchive_EnhancedErrorForCell(ProtobufMessage(_b)) }
-            if let _v { enhancedErrors.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in errors { _w.bytesField(1, _x.encoded()) }
-        for _x in enhancedErrors { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.CellErrorsArchive", [
+        .repeated(1, TSCE_CellErrorsArchive_ErrorForCell.self),
+        .repeated(2, TSCE_CellErrorsArchive_EnhancedErrorForCell.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var errors: [TSCE_CellErrorsArchive_ErrorForCell] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(errors value: TSCE_CellErrorsArchive_ErrorForCell) { append(value, toMessages: 0) }
+    var enhancedErrors: [TSCE_CellErrorsArchive_EnhancedErrorForCell] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(enhancedErrors value: TSCE_CellErrorsArchive_EnhancedErrorForCell) { append(value, toMessages: 1) }
 }
 
 /// Generated wire model for `TSCE.CellErrorsArchive.ErrorForCell`.
 final class TSCE_CellErrorsArchive_ErrorForCell: IWAMessage {
-    var coordinate: TSCE_CellCoordinateArchive?
-    var errorFlavor: Int32?
-    var errDueToCell: TSCE_InternalCellReferenceArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSCE_CellCoordinateArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CellCoordinateArchive(ProtobufMessage(_b)) }
-            if let _v { coordinate = _v }
-        case 2:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { errorFlavor = _v }
-        case 3:
-            var _v: TSCE_InternalCellReferenceArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_InternalCellReferenceArchive(ProtobufMessage(_b)) }
-            if let _v { errDueToCell = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = coordinate { _w.bytesField(1, _x.encoded()) }
-        if let _x = errorFlavor { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = errDueToCell { _w.bytesField(3, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.CellErrorsArchive.ErrorForCell", [
+        .optional(1, TSCE_CellCoordinateArchive.self), .optional(2, .int32),
+        .optional(3, TSCE_InternalCellReferenceArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var coordinate: TSCE_CellCoordinateArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var errorFlavor: Int32? { get { self[1] } set { self[1] = newValue } }
+    var errDueToCell: TSCE_InternalCellReferenceArchive? { get { self[message: 2] } set { self[message: 2] = newValue } }
 }
 
 /// Generated wire model for `TSCE.CellErrorsArchive.EnhancedErrorForCell`.
 final class TSCE_CellErrorsArchive_EnhancedErrorForCell: IWAMessage {
-    var coordinate: TSCE_CellCoordinateArchive?
-    var error: TSCE_ErrorArchive?
-    var errDueToCell: TSCE_InternalCellReferenceArchive?
-    var sortedWarnings: [TSCE_WarningArchive] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSCE_CellCoordinateArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CellCoordinateArchive(ProtobufMessage(_b)) }
-            if let _v { coordinate = _v }
-        case 2:
-            var _v: TSCE_ErrorArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_ErrorArchive(ProtobufMessage(_b)) }
-            if let _v { error = _v }
-        case 3:
-            var _v: TSCE_InternalCellReferenceArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_InternalCellReferenceArchive(ProtobufMessage(_b)) }
-            if let _v { errDueToCell = _v }
-        case 4:
-            var _v: TSCE_WarningArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_WarningArchive(ProtobufMessage(_b)) }
-            if let _v { sortedWarnings.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = coordinate { _w.bytesField(1, _x.encoded()) }
-        if let _x = error { _w.bytesField(2, _x.encoded()) }
-        if let _x = errDueToCell { _w.bytesField(3, _x.encoded()) }
-        for _x in sortedWarnings { _w.bytesField(4, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.CellErrorsArchive.EnhancedErrorForCell", [
+        .optional(1, TSCE_CellCoordinateArchive.self), .optional(2, TSCE_ErrorArchive.self),
+        .optional(3, TSCE_InternalCellReferenceArchive.self), .repeated(4, TSCE_WarningArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var coordinate: TSCE_CellCoordinateArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var error: TSCE_ErrorArchive? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var errDueToCell: TSCE_InternalCellReferenceArchive? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var sortedWarnings: [TSCE_WarningArchive] { get { self[messages: 3] } set { self[messages: 3] = newValue } }
+    func append(sortedWarnings value: TSCE_WarningArchive) { append(value, toMessages: 3) }
 }
 
 /// Generated wire model for `TSCE.CellSpillSizesArchive`.
 final class TSCE_CellSpillSizesArchive: IWAMessage {
-    var spills: [TSCE_CellSpillSizesArchive_SpillForCell] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSCE_CellSpillSizesArchive_SpillForCell?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CellSpillSizesArchive_SpillForCell(ProtobufMessage(_b)) }
-            if let _v { spills.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in spills { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.CellSpillSizesArchive", [
+        .repeated(1, TSCE_CellSpillSizesArchive_SpillForCell.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var spills: [TSCE_CellSpillSizesArchive_SpillForCell] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(spills value: TSCE_CellSpillSizesArchive_SpillForCell) { append(value, toMessages: 0) }
 }
 
 /// Generated wire model for `TSCE.CellSpillSizesArchive.SpillForCell`.
 final class TSCE_CellSpillSizesArchive_SpillForCell: IWAMessage {
-    var coordinate: TSCE_CellCoordinateArchive?
-    var spillSize: TSCE_ColumnRowSize?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSCE_CellCoordinateArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CellCoordinateArchive(ProtobufMessage(_b)) }
-            if let _v { coordinate = _v }
-        case 2:
-            var _v: TSCE_ColumnRowSize?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_ColumnRowSize(ProtobufMessage(_b)) }
-            if let _v { spillSize = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = coordinate { _w.bytesField(1, _x.encoded()) }
-        if let _x = spillSize { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.CellSpillSizesArchive.SpillForCell", [
+        .optional(1, TSCE_CellCoordinateArchive.self), .optional(2, TSCE_ColumnRowSize.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var coordinate: TSCE_CellCoordinateArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var spillSize: TSCE_ColumnRowSize? { get { self[message: 1] } set { self[message: 1] = newValue } }
 }
 
 /// Generated wire model for `TSCE.UuidReferencesArchive`.
 final class TSCE_UuidReferencesArchive: IWAMessage {
-    var tableRefs: [TSCE_UuidReferencesArchive_TableRef] = []
-    var tableUuidRefs: [TSCE_UuidReferencesArchive_TableWithUuidRef] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSCE_UuidReferencesArchive_TableRef?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_UuidReferencesArchive_TableRef(ProtobufMessage(_b)) }
-            if let _v { tableRefs.append(_v) }
-        case 2:
-            var _v: TSCE_UuidReferencesArchive_TableWithUuidRef?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_UuidReferencesArchive_TableWithUuidRef(ProtobufMessage(_b)) }
-            if let _v { tableUuidRefs.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in tableRefs { _w.bytesField(1, _x.encoded()) }
-        for _x in tableUuidRefs { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.UuidReferencesArchive", [
+        .repeated(1, TSCE_UuidReferencesArchive_TableRef.self),
+        .repeated(2, TSCE_UuidReferencesArchive_TableWithUuidRef.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var tableRefs: [TSCE_UuidReferencesArchive_TableRef] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(tableRefs value: TSCE_UuidReferencesArchive_TableRef) { append(value, toMessages: 0) }
+    var tableUuidRefs: [TSCE_UuidReferencesArchive_TableWithUuidRef] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(tableUuidRefs value: TSCE_UuidReferencesArchive_TableWithUuidRef) { append(value, toMessages: 1) }
 }
 
 /// Generated wire model for `TSCE.UuidReferencesArchive.TableRef`.
 final class TSCE_UuidReferencesArchive_TableRef: IWAMessage {
-    var ownerUuid: TSP_UUID?
-    var coordSet: TSCE_CellCoordSetArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { ownerUuid = _v }
-        case 2:
-            var _v: TSCE_CellCoordSetArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CellCoordSetArchive(ProtobufMessage(_b)) }
-            if let _v { coordSet = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = ownerUuid { _w.bytesField(1, _x.encoded()) }
-        if let _x = coordSet { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.UuidReferencesArchive.TableRef", [
+        .optional(1, TSP_UUID.self), .optional(2, TSCE_CellCoordSetArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var ownerUuid: TSP_UUID? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var coordSet: TSCE_CellCoordSetArchive? { get { self[message: 1] } set { self[message: 1] = newValue } }
 }
 
 /// Generated wire model for `TSCE.UuidReferencesArchive.UuidRef`.
 final class TSCE_UuidReferencesArchive_UuidRef: IWAMessage {
-    var uuid: TSP_UUID?
-    var coordSet: TSCE_CellCoordSetArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { uuid = _v }
-        case 2:
-            var _v: TSCE_CellCoordSetArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CellCoordSetArchive(ProtobufMessage(_b)) }
-            if let _v { coordSet = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = uuid { _w.bytesField(1, _x.encoded()) }
-        if let _x = coordSet { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.UuidReferencesArchive.UuidRef", [
+        .optional(1, TSP_UUID.self), .optional(2, TSCE_CellCoordSetArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var uuid: TSP_UUID? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var coordSet: TSCE_CellCoordSetArchive? { get { self[message: 1] } set { self[message: 1] = newValue } }
 }
 
 /// Generated wire model for `TSCE.UuidReferencesArchive.TableWithUuidRef`.
 final class TSCE_UuidReferencesArchive_TableWithUuidRef: IWAMessage {
-    var ownerUuid: TSP_UUID?
-    var uuidRefs: [TSCE_UuidReferencesArchive_UuidRef] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { ownerUuid = _v }
-        case 2:
-            var _v: TSCE_UuidReferencesArchive_UuidRef?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_UuidReferencesArchive_UuidRef(ProtobufMessage(_b)) }
-            if let _v { uuidRefs.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = ownerUuid { _w.bytesField(1, _x.encoded()) }
-        for _x in uuidRefs { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.UuidReferencesArchive.TableWithUuidRef", [
+        .optional(1, TSP_UUID.self), .repeated(2, TSCE_UuidReferencesArchive_UuidRef.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var ownerUuid: TSP_UUID? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var uuidRefs: [TSCE_UuidReferencesArchive_UuidRef] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(uuidRefs value: TSCE_UuidReferencesArchive_UuidRef) { append(value, toMessages: 1) }
 }
 
 /// Generated wire model for `TSCE.FormulaOwnerDependenciesArchive`.
 final class TSCE_FormulaOwnerDependenciesArchive: IWAMessage {
-    var formulaOwnerUid: TSP_UUID?
-    var internalFormulaOwnerId: UInt32?
-    var ownerKind: UInt32?
-    var cellDependencies: TSCE_CellDependenciesExpandedArchive?
-    var rangeDependencies: TSCE_RangeDependenciesArchive?
-    var volatileDependencies: TSCE_VolatileDependenciesExpandedArchive?
-    var spanningColumnDependencies: TSCE_SpanningDependenciesExpandedArchive?
-    var spanningRowDependencies: TSCE_SpanningDependenciesExpandedArchive?
-    var wholeOwnerDependencies: TSCE_WholeOwnerDependenciesExpandedArchive?
-    var cellErrors: TSCE_CellErrorsArchive?
-    var formulaOwner: TSP_Reference?
-    var baseOwnerUid: TSP_UUID?
-    var tiledCellDependencies: TSCE_CellDependenciesTiledArchive?
-    var uuidReferences: TSCE_UuidReferencesArchive?
-    var tiledRangeDependencies: TSCE_RangeDependenciesTiledArchive?
-    var spillRangeSizes: TSCE_CellSpillSizesArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { formulaOwnerUid = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { internalFormulaOwnerId = _v }
-        case 3:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { ownerKind = _v }
-        case 4:
-            var _v: TSCE_CellDependenciesExpandedArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CellDependenciesExpandedArchive(ProtobufMessage(_b)) }
-            if let _v { cellDependencies = _v }
-        case 5:
-            var _v: TSCE_RangeDependenciesArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_RangeDependenciesArchive(ProtobufMessage(_b)) }
-            if let _v { rangeDependencies = _v }
-        case 6:
-            var _v: TSCE_VolatileDependenciesExpandedArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_VolatileDependenciesExpandedArchive(ProtobufMessage(_b)) }
-            if let _v { volatileDependencies = _v }
-        case 7:
-            var _v: TSCE_SpanningDependenciesExpandedArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_SpanningDependenciesExpandedArchive(ProtobufMessage(_b)) }
-            if let _v { spanningColumnDependencies = _v }
-        case 8:
-            var _v: TSCE_SpanningDependenciesExpandedArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_SpanningDependenciesExpandedArchive(ProtobufMessage(_b)) }
-            if let _v { spanningRowDependencies = _v }
-        case 9:
-            var _v: TSCE_WholeOwnerDependenciesExpandedArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_WholeOwnerDependenciesExpandedArchive(ProtobufMessage(_b)) }
-            if let _v { wholeOwnerDependencies = _v }
-        case 10:
-            var _v: TSCE_CellErrorsArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CellErrorsArchive(ProtobufMessage(_b)) }
-            if let _v { cellErrors = _v }
-        case 11:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { formulaOwner = _v }
-        case 12:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { baseOwnerUid = _v }
-        case 13:
-            var _v: TSCE_CellDependenciesTiledArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CellDependenciesTiledArchive(ProtobufMessage(_b)) }
-            if let _v { tiledCellDependencies = _v }
-        case 14:
-            var _v: TSCE_UuidReferencesArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_UuidReferencesArchive(ProtobufMessage(_b)) }
-            if let _v { uuidReferences = _v }
-        case 15:
-            var _v: TSCE_RangeDependenciesTiledArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_RangeDependenciesTiledArchive(ProtobufMessage(_b)) }
-            if let _v { tiledRangeDependencies = _v }
-        case 16:
-            var _v: TSCE_CellSpillSizesArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CellSpillSizesArchive(ProtobufMessage(_b)) }
-            if let _v { spillRangeSizes = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = formulaOwnerUid { _w.bytesField(1, _x.encoded()) }
-        if let _x = internalFormulaOwnerId { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = ownerKind { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = cellDependencies { _w.bytesField(4, _x.encoded()) }
-        if let _x = rangeDependencies { _w.bytesField(5, _x.encoded()) }
-        if let _x = volatileDependencies { _w.bytesField(6, _x.encoded()) }
-        if let _x = spanningColumnDependencies { _w.bytesField(7, _x.encoded()) }
-        if let _x = spanningRowDependencies { _w.bytesField(8, _x.encoded()) }
-        if let _x = wholeOwnerDependencies { _w.bytesField(9, _x.encoded()) }
-        if let _x = cellErrors { _w.bytesField(10, _x.encoded()) }
-        if let _x = formulaOwner { _w.bytesField(11, _x.encoded()) }
-        if let _x = baseOwnerUid { _w.bytesField(12, _x.encoded()) }
-        if let _x = tiledCellDependencies { _w.bytesField(13, _x.encoded()) }
-        if let _x = uuidReferences { _w.bytesField(14, _x.encoded()) }
-        if let _x = tiledRangeDependencies { _w.bytesField(15, _x.encoded()) }
-        if let _x = spillRangeSizes { _w.bytesField(16, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.FormulaOwnerDependenciesArchive", [
+        .optional(1, TSP_UUID.self), .optional(2, .uint32), .optional(3, .uint32),
+        .optional(4, TSCE_CellDependenciesExpandedArchive.self), .optional(5, TSCE_RangeDependenciesArchive.self),
+        .optional(6, TSCE_VolatileDependenciesExpandedArchive.self),
+        .optional(7, TSCE_SpanningDependenciesExpandedArchive.self),
+        .optional(8, TSCE_SpanningDependenciesExpandedArchive.self),
+        .optional(9, TSCE_WholeOwnerDependenciesExpandedArchive.self), .optional(10, TSCE_CellErrorsArchive.self),
+        .optional(11, TSP_Reference.self), .optional(12, TSP_UUID.self),
+        .optional(13, TSCE_CellDependenciesTiledArchive.self), .optional(14, TSCE_UuidReferencesArchive.self),
+        .optional(15, TSCE_RangeDependenciesTiledArchive.self), .optional(16, TSCE_CellSpillSizesArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 16)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var formulaOwnerUid: TSP_UUID? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var internalFormulaOwnerId: UInt32? { get { self[1] } set { self[1] = newValue } }
+    var ownerKind: UInt32? { get { self[2] } set { self[2] = newValue } }
+    var cellDependencies: TSCE_CellDependenciesExpandedArchive? { get { self[message: 3] } set { self[message: 3] = newValue } }
+    var rangeDependencies: TSCE_RangeDependenciesArchive? { get { self[message: 4] } set { self[message: 4] = newValue } }
+    var volatileDependencies: TSCE_VolatileDependenciesExpandedArchive? { get { self[message: 5] } set { self[message: 5] = newValue } }
+    var spanningColumnDependencies: TSCE_SpanningDependenciesExpandedArchive? { get { self[message: 6] } set { self[message: 6] = newValue } }
+    var spanningRowDependencies: TSCE_SpanningDependenciesExpandedArchive? { get { self[message: 7] } set { self[message: 7] = newValue } }
+    var wholeOwnerDependencies: TSCE_WholeOwnerDependenciesExpandedArchive? { get { self[message: 8] } set { self[message: 8] = newValue } }
+    var cellErrors: TSCE_CellErrorsArchive? { get { self[message: 9] } set { self[message: 9] = newValue } }
+    var formulaOwner: TSP_Reference? { get { self[message: 10] } set { self[message: 10] = newValue } }
+    var baseOwnerUid: TSP_UUID? { get { self[message: 11] } set { self[message: 11] = newValue } }
+    var tiledCellDependencies: TSCE_CellDependenciesTiledArchive? { get { self[message: 12] } set { self[message: 12] = newValue } }
+    var uuidReferences: TSCE_UuidReferencesArchive? { get { self[message: 13] } set { self[message: 13] = newValue } }
+    var tiledRangeDependencies: TSCE_RangeDependenciesTiledArchive? { get { self[message: 14] } set { self[message: 14] = newValue } }
+    var spillRangeSizes: TSCE_CellSpillSizesArchive? { get { self[message: 15] } set { self[message: 15] = newValue } }
 }
 
 /// Generated wire model for `TSCE.FormulaOwnerInfoArchive`.
 final class TSCE_FormulaOwnerInfoArchive: IWAMessage {
-    var formulaOwnerId: TSP_CFUUIDArchive?
-    var cellDependencies: TSCE_CellDependenciesArchive?
-    var rangeDependencies: TSCE_RangeDependenciesArchive?
-    var volatileDependencies: TSCE_VolatileDependenciesArchive?
-    var spanningColumnDependencies: TSCE_SpanningDependenciesArchive?
-    var spanningRowDependencies: TSCE_SpanningDependenciesArchive?
-    var wholeOwnerDependencies: TSCE_WholeOwnerDependenciesArchive?
-    var cellErrors: TSCE_CellErrorsArchive?
-    var formulaOwner: TSP_Reference?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_CFUUIDArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_CFUUIDArchive(ProtobufMessage(_b)) }
-            if let _v { formulaOwnerId = _v }
-        case 2:
-            var _v: TSCE_CellDependenciesArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CellDependenciesArchive(ProtobufMessage(_b)) }
-            if let _v { cellDependencies = _v }
-        case 3:
-            var _v: TSCE_RangeDependenciesArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_RangeDependenciesArchive(ProtobufMessage(_b)) }
-            if let _v { rangeDependencies = _v }
-        case 4:
-            var _v: TSCE_VolatileDependenciesArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_VolatileDependenciesArchive(ProtobufMessage(_b)) }
-            if let _v { volatileDependencies = _v }
-        case 5:
-            var _v: TSCE_SpanningDependenciesArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_SpanningDependenciesArchive(ProtobufMessage(_b)) }
-            if let _v { spanningColumnDependencies = _v }
-        case 6:
-            var _v: TSCE_SpanningDependenciesArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_SpanningDependenciesArchive(ProtobufMessage(_b)) }
-            if let _v { spanningRowDependencies = _v }
-        case 8:
-            var _v: TSCE_WholeOwnerDependenciesArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_WholeOwnerDependenciesArchive(ProtobufMessage(_b)) }
-            if let _v { wholeOwnerDependencies = _v }
-        case 9:
-            var _v: TSCE_CellErrorsArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CellErrorsArchive(ProtobufMessage(_b)) }
-            if let _v { cellErrors = _v }
-        case 7:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { formulaOwner = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = formulaOwnerId { _w.bytesField(1, _x.encoded()) }
-        if let _x = cellDependencies { _w.bytesField(2, _x.encoded()) }
-        if let _x = rangeDependencies { _w.bytesField(3, _x.encoded()) }
-        if let _x = volatileDependencies { _w.bytesField(4, _x.encoded()) }
-        if let _x = spanningColumnDependencies { _w.bytesField(5, _x.encoded()) }
-        if let _x = spanningRowDependencies { _w.bytesField(6, _x.encoded()) }
-        if let _x = wholeOwnerDependencies { _w.bytesField(8, _x.encoded()) }
-        if let _x = cellErrors { _w.bytesField(9, _x.encoded()) }
-        if let _x = formulaOwner { _w.bytesField(7, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.FormulaOwnerInfoArchive", [
+        .optional(1, TSP_CFUUIDArchive.self), .optional(2, TSCE_CellDependenciesArchive.self),
+        .optional(3, TSCE_RangeDependenciesArchive.self), .optional(4, TSCE_VolatileDependenciesArchive.self),
+        .optional(5, TSCE_SpanningDependenciesArchive.self), .optional(6, TSCE_SpanningDependenciesArchive.self),
+        .optional(8, TSCE_WholeOwnerDependenciesArchive.self), .optional(9, TSCE_CellErrorsArchive.self),
+        .optional(7, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 9)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var formulaOwnerId: TSP_CFUUIDArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var cellDependencies: TSCE_CellDependenciesArchive? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var rangeDependencies: TSCE_RangeDependenciesArchive? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var volatileDependencies: TSCE_VolatileDependenciesArchive? { get { self[message: 3] } set { self[message: 3] = newValue } }
+    var spanningColumnDependencies: TSCE_SpanningDependenciesArchive? { get { self[message: 4] } set { self[message: 4] = newValue } }
+    var spanningRowDependencies: TSCE_SpanningDependenciesArchive? { get { self[message: 5] } set { self[message: 5] = newValue } }
+    var wholeOwnerDependencies: TSCE_WholeOwnerDependenciesArchive? { get { self[message: 6] } set { self[message: 6] = newValue } }
+    var cellErrors: TSCE_CellErrorsArchive? { get { self[message: 7] } set { self[message: 7] = newValue } }
+    var formulaOwner: TSP_Reference? { get { self[message: 8] } set { self[message: 8] = newValue } }
 }
 
 /// Generated wire model for `TSCE.SubFormulaOwnerIDArchive`.
 final class TSCE_SubFormulaOwnerIDArchive: IWAMessage {
-    var baseOwnerUid: TSP_UUID?
-    var ownerKind: UInt32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { baseOwnerUid = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { ownerKind = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = baseOwnerUid { _w.bytesField(1, _x.encoded()) }
-        if let _x = ownerKind { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.SubFormulaOwnerIDArchive", [
+        .optional(1, TSP_UUID.self), .optional(2, .uint32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var baseOwnerUid: TSP_UUID? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var ownerKind: UInt32? { get { self[1] } set { self[1] = newValue } }
 }
 
 /// Generated wire model for `TSCE.OwnerIDMapArchive`.
 final class TSCE_OwnerIDMapArchive: IWAMessage {
-    var mapEntry: [TSCE_OwnerIDMapArchive_OwnerIDMapArchiveEntry] = []
-    var unregisteredInternalOwnerId: [UInt32] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSCE_OwnerIDMapArchive_OwnerIDMapArchiveEntry?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_OwnerIDMapArchive_OwnerIDMapArchiveEntry(ProtobufMessage(_b)) }
-            if let _v { mapEntry.append(_v) }
-        case 2:
-            if case .varint(let _u) = _f.value { unregisteredInternalOwnerId.append(UInt32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { unregisteredInternalOwnerId.append(UInt32(truncatingIfNeeded: _u)) } }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in mapEntry { _w.bytesField(1, _x.encoded()) }
-        for _x in unregisteredInternalOwnerId { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.OwnerIDMapArchive", [
+        .repeated(1, TSCE_OwnerIDMapArchive_OwnerIDMapArchiveEntry.self), .repeated(2, .uint32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var mapEntry: [TSCE_OwnerIDMapArchive_OwnerIDMapArchiveEntry] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(mapEntry value: TSCE_OwnerIDMapArchive_OwnerIDMapArchiveEntry) { append(value, toMessages: 0) }
+    var unregisteredInternalOwnerId: [UInt32] { get { self[all: 1] } set { self[all: 1] = newValue } }
+    func append(unregisteredInternalOwnerId value: UInt32) { append(value, toAll: 1) }
 }
 
 /// Generated wire model for `TSCE.OwnerIDMapArchive.OwnerIDMapArchiveEntry`.
 final class TSCE_OwnerIDMapArchive_OwnerIDMapArchiveEntry: IWAMessage {
-    var internalOwnerId: UInt32?
-    var ownerId: TSP_CFUUIDArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { internalOwnerId = _v }
-        case 2:
-            var _v: TSP_CFUUIDArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_CFUUIDArchive(ProtobufMessage(_b)) }
-            if let _v { ownerId = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = internalOwnerId { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = ownerId { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.OwnerIDMapArchive.OwnerIDMapArchiveEntry", [
+        .optional(1, .uint32), .optional(2, TSP_CFUUIDArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var internalOwnerId: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var ownerId: TSP_CFUUIDArchive? { get { self[message: 1] } set { self[message: 1] = newValue } }
 }
 
 /// Generated wire model for `TSCE.UidLookupListArchive`.
 final class TSCE_UidLookupListArchive: IWAMessage {
-    var uuids: [TSP_UUID] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { uuids.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in uuids { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.UidLookupListArchive", [
+        .repeated(1, TSP_UUID.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var uuids: [TSP_UUID] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(uuids value: TSP_UUID) { append(value, toMessages: 0) }
 }
 
 /// Generated wire model for `TSCE.DependencyTrackerArchive`.
 final class TSCE_DependencyTrackerArchive: IWAMessage {
-    var formulaOwnerInfo: [TSCE_FormulaOwnerInfoArchive] = []
-    var dirtyLeaf: [TSCE_CellReferenceArchive] = []
-    var ownerIdMap: TSCE_OwnerIDMapArchive?
-    var internalDirtyLeaf: [TSCE_InternalCellReferenceArchive] = []
-    var numberOfFormulas: UInt64?
-    var formulaOwnerDependencies: [TSP_Reference] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSCE_FormulaOwnerInfoArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_FormulaOwnerInfoArchive(ProtobufMessage(_b)) }
-            if let _v { formulaOwnerInfo.append(_v) }
-        case 2:
-            var _v: TSCE_CellReferenceArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CellReferenceArchive(ProtobufMessage(_b)) }
-            if let _v { dirtyLeaf.append(_v) }
-        case 3:
-            var _v: TSCE_OwnerIDMapArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_OwnerIDMapArchive(ProtobufMessage(_b)) }
-            if let _v { ownerIdMap = _v }
-        case 4:
-            var _v: TSCE_InternalCellReferenceArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_InternalCellReferenceArchive(ProtobufMessage(_b)) }
-            if let _v { internalDirtyLeaf.append(_v) }
-        case 5:
-            var _v: UInt64?
-            if case .varint(let _u) = _f.value { _v = UInt64(truncatingIfNeeded: _u) }
-            if let _v { numberOfFormulas = _v }
-        case 6:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { formulaOwnerDependencies.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in formulaOwnerInfo { _w.bytesField(1, _x.encoded()) }
-        for _x in dirtyLeaf { _w.bytesField(2, _x.encoded()) }
-        if let _x = ownerIdMap { _w.bytesField(3, _x.encoded()) }
-        for _x in internalDirtyLeaf { _w.bytesField(4, _x.encoded()) }
-        if let _x = numberOfFormulas { _w.varintField(5, UInt64(truncatingIfNeeded: _x)) }
-        for _x in formulaOwnerDependencies { _w.bytesField(6, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.DependencyTrackerArchive", [
+        .repeated(1, TSCE_FormulaOwnerInfoArchive.self), .repeated(2, TSCE_CellReferenceArchive.self),
+        .optional(3, TSCE_OwnerIDMapArchive.self), .repeated(4, TSCE_InternalCellReferenceArchive.self),
+        .optional(5, .uint64), .repeated(6, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 6)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var formulaOwnerInfo: [TSCE_FormulaOwnerInfoArchive] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(formulaOwnerInfo value: TSCE_FormulaOwnerInfoArchive) { append(value, toMessages: 0) }
+    var dirtyLeaf: [TSCE_CellReferenceArchive] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(dirtyLeaf value: TSCE_CellReferenceArchive) { append(value, toMessages: 1) }
+    var ownerIdMap: TSCE_OwnerIDMapArchive? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var internalDirtyLeaf: [TSCE_InternalCellReferenceArchive] { get { self[messages: 3] } set { self[messages: 3] = newValue } }
+    func append(internalDirtyLeaf value: TSCE_InternalCellReferenceArchive) { append(value, toMessages: 3) }
+    var numberOfFormulas: UInt64? { get { self[4] } set { self[4] = newValue } }
+    var formulaOwnerDependencies: [TSP_Reference] { get { self[messages: 5] } set { self[messages: 5] = newValue } }
+    func append(formulaOwnerDependencies value: TSP_Reference) { append(value, toMessages: 5) }
 }
 
 /// Generated wire model for `TSCE.RemoteDataSpecifierArchive`.
 final class TSCE_RemoteDataSpecifierArchive: IWAMessage {
-    var functionIndex: UInt32?
-    var symbol: String?
-    var attribute: UInt32?
-    var date: Double?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { functionIndex = _v }
-        case 2:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { symbol = _v }
-        case 3:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { attribute = _v }
-        case 4:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { date = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = functionIndex { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = symbol { _w.stringField(2, _x) }
-        if let _x = attribute { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = date { _w.fixed64Field(4, _x.bitPattern) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.RemoteDataSpecifierArchive", [
+        .optional(1, .uint32), .optional(2, .string), .optional(3, .uint32), .optional(4, .double),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var functionIndex: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var symbol: String? { get { self[1] } set { self[1] = newValue } }
+    var attribute: UInt32? { get { self[2] } set { self[2] = newValue } }
+    var date: Double? { get { self[3] } set { self[3] = newValue } }
 }
 
 /// Generated wire model for `TSCE.RemoteDataValueMapArchive`.
 final class TSCE_RemoteDataValueMapArchive: IWAMessage {
-    var entry: [TSCE_RemoteDataValueMapArchive_RemoteDataMapEntry] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSCE_RemoteDataValueMapArchive_RemoteDataMapEntry?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_RemoteDataValueMapArchive_RemoteDataMapEntry(ProtobufMessage(_b)) }
-            if let _v { entry.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in entry { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.RemoteDataValueMapArchive", [
+        .repeated(1, TSCE_RemoteDataValueMapArchive_RemoteDataMapEntry.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var entry: [TSCE_RemoteDataValueMapArchive_RemoteDataMapEntry] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(entry value: TSCE_RemoteDataValueMapArchive_RemoteDataMapEntry) { append(value, toMessages: 0) }
 }
 
 /// Generated wire model for `TSCE.RemoteDataValueMapArchive.RemoteDataMapEntry`.
 final class TSCE_RemoteDataValueMapArchive_RemoteDataMapEntry: IWAMessage {
-    var specifier: TSCE_RemoteDataSpecifierArchive?
-    var value: TSCE_CellValueArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSCE_RemoteDataSpecifierArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_RemoteDataSpecifierArchive(ProtobufMessage(_b)) }
-            if let _v { specifier = _v }
-        case 2:
-            var _v: TSCE_CellValueArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CellValueArchive(ProtobufMessage(_b)) }
-            if let _v { value = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = specifier { _w.bytesField(1, _x.encoded()) }
-        if let _x = value { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.RemoteDataValueMapArchive.RemoteDataMapEntry", [
+        .optional(1, TSCE_RemoteDataSpecifierArchive.self), .optional(2, TSCE_CellValueArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var specifier: TSCE_RemoteDataSpecifierArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var value: TSCE_CellValueArchive? { get { self[message: 1] } set { self[message: 1] = newValue } }
 }
 
 /// Generated wire model for `TSCE.StockArchive`.
 final class TSCE_StockArchive: IWAMessage {
-    var symbol: String?
-    var date: Double?
-    var attribute: [TSCE_StockArchive_AttributeEntry] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { symbol = _v }
-        case 2:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { date = _v }
-        case 3:
-            var _v: TSCE_StockArchive_AttributeEntry?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_StockArchive_AttributeEntry(ProtobufMessage(_b)) }
-            if let _v { attribute.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = symbol { _w.stringField(1, _x) }
-        if let _x = date { _w.fixed64Field(2, _x.bitPattern) }
-        for _x in attribute { _w.bytesField(3, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.StockArchive", [
+        .optional(1, .string), .optional(2, .double), .repeated(3, TSCE_StockArchive_AttributeEntry.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var symbol: String? { get { self[0] } set { self[0] = newValue } }
+    var date: Double? { get { self[1] } set { self[1] = newValue } }
+    var attribute: [TSCE_StockArchive_AttributeEntry] { get { self[messages: 2] } set { self[messages: 2] = newValue } }
+    func append(attribute value: TSCE_StockArchive_AttributeEntry) { append(value, toMessages: 2) }
 }
 
 /// Generated wire model for `TSCE.StockArchive.AttributeEntry`.
 final class TSCE_StockArchive_AttributeEntry: IWAMessage {
-    var attribute: UInt32?
-    var value: String?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { attribute = _v }
-        case 2:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { value = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = attribute { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = value { _w.stringField(2, _x) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.StockArchive.AttributeEntry", [
+        .optional(1, .uint32), .optional(2, .string),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var attribute: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var value: String? { get { self[1] } set { self[1] = newValue } }
 }
 
 /// Generated wire model for `TSCE.RemoteDataStoreArchive`.
 final class TSCE_RemoteDataStoreArchive: IWAMessage {
-    var valueMap: TSCE_RemoteDataValueMapArchive?
-    var stocks: [TSCE_StockArchive] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSCE_RemoteDataValueMapArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_RemoteDataValueMapArchive(ProtobufMessage(_b)) }
-            if let _v { valueMap = _v }
-        case 2:
-            var _v: TSCE_StockArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_StockArchive(ProtobufMessage(_b)) }
-            if let _v { stocks.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = valueMap { _w.bytesField(1, _x.encoded()) }
-        for _x in stocks { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.RemoteDataStoreArchive", [
+        .optional(1, TSCE_RemoteDataValueMapArchive.self), .repeated(2, TSCE_StockArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var valueMap: TSCE_RemoteDataValueMapArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var stocks: [TSCE_StockArchive] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(stocks value: TSCE_StockArchive) { append(value, toMessages: 1) }
 }
 
 /// Generated wire model for `TSCE.NameTrackedReferencePair`.
 final class TSCE_NameTrackedReferencePair: IWAMessage {
-    var name: String?
-    var trackedReference: TSP_Reference?
-    var trackedReferenceId: UInt32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { name = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { trackedReference = _v }
-        case 3:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { trackedReferenceId = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = name { _w.stringField(1, _x) }
-        if let _x = trackedReference { _w.bytesField(2, _x.encoded()) }
-        if let _x = trackedReferenceId { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.NameTrackedReferencePair", [
+        .optional(1, .string), .optional(2, TSP_Reference.self), .optional(3, .uint32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var name: String? { get { self[0] } set { self[0] = newValue } }
+    var trackedReference: TSP_Reference? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var trackedReferenceId: UInt32? { get { self[2] } set { self[2] = newValue } }
 }
 
 /// Generated wire model for `TSCE.NamesByTrackedReferenceArchive`.
 final class TSCE_NamesByTrackedReferenceArchive: IWAMessage {
-    var tableId: TSP_CFUUIDArchive?
-    var nameTrackedReferencePair: [TSCE_NameTrackedReferencePair] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_CFUUIDArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_CFUUIDArchive(ProtobufMessage(_b)) }
-            if let _v { tableId = _v }
-        case 2:
-            var _v: TSCE_NameTrackedReferencePair?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_NameTrackedReferencePair(ProtobufMessage(_b)) }
-            if let _v { nameTrackedReferencePair.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = tableId { _w.bytesField(1, _x.encoded()) }
-        for _x in nameTrackedReferencePair { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.NamesByTrackedReferenceArchive", [
+        .optional(1, TSP_CFUUIDArchive.self), .repeated(2, TSCE_NameTrackedReferencePair.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var tableId: TSP_CFUUIDArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var nameTrackedReferencePair: [TSCE_NameTrackedReferencePair] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(nameTrackedReferencePair value: TSCE_NameTrackedReferencePair) { append(value, toMessages: 1) }
 }
 
 /// Generated wire model for `TSCE.NamedReferenceManagerArchive`.
 final class TSCE_NamedReferenceManagerArchive: IWAMessage {
-    var referenceTracker: TSP_Reference?
-    var namesByTrackedReferenceByTable: [TSCE_NamesByTrackedReferenceArchive] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { referenceTracker = _v }
-        case 2:
-            var _v: TSCE_NamesByTrackedReferenceArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_NamesByTrackedReferenceArchive(ProtobufMessage(_b)) }
-            if let _v { namesByTrackedReferenceByTable.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = referenceTracker { _w.bytesField(1, _x.encoded()) }
-        for _x in namesByTrackedReferenceByTable { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.NamedReferenceManagerArchive", [
+        .optional(1, TSP_Reference.self), .repeated(2, TSCE_NamesByTrackedReferenceArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var referenceTracker: TSP_Reference? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var namesByTrackedReferenceByTable: [TSCE_NamesByTrackedReferenceArchive] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(namesByTrackedReferenceByTable value: TSCE_NamesByTrackedReferenceArchive) { append(value, toMessages: 1) }
 }
 
 /// Generated wire model for `TSCE.UuidSetStoreArchive`.
 final class TSCE_UuidSetStoreArchive: IWAMessage {
-    var uuidset: [TSCE_UuidSetStoreArchive_UuidSet] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSCE_UuidSetStoreArchive_UuidSet?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_UuidSetStoreArchive_UuidSet(ProtobufMessage(_b)) }
-            if let _v { uuidset.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in uuidset { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.UuidSetStoreArchive", [
+        .repeated(1, TSCE_UuidSetStoreArchive_UuidSet.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var uuidset: [TSCE_UuidSetStoreArchive_UuidSet] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(uuidset value: TSCE_UuidSetStoreArchive_UuidSet) { append(value, toMessages: 0) }
 }
 
 /// Generated wire model for `TSCE.UuidSetStoreArchive.UuidSet`.
 final class TSCE_UuidSetStoreArchive_UuidSet: IWAMessage {
-    var uuid: [TSP_UUID] = []
-    var indexOfSet: UInt32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { uuid.append(_v) }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { indexOfSet = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in uuid { _w.bytesField(1, _x.encoded()) }
-        if let _x = indexOfSet { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.UuidSetStoreArchive.UuidSet", [
+        .repeated(1, TSP_UUID.self), .optional(2, .uint32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var uuid: [TSP_UUID] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(uuid value: TSP_UUID) { append(value, toMessages: 0) }
+    var indexOfSet: UInt32? { get { self[1] } set { self[1] = newValue } }
 }
 
 /// Generated wire model for `TSCE.UuidReferenceMapArchive`.
 final class TSCE_UuidReferenceMapArchive: IWAMessage {
-    var cellRefsForUuid: [TSCE_UuidReferenceMapArchive_CellRefsForUuid] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSCE_UuidReferenceMapArchive_CellRefsForUuid?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_UuidReferenceMapArchive_CellRefsForUuid(ProtobufMessage(_b)) }
-            if let _v { cellRefsForUuid.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in cellRefsForUuid { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.UuidReferenceMapArchive", [
+        .repeated(1, TSCE_UuidReferenceMapArchive_CellRefsForUuid.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var cellRefsForUuid: [TSCE_UuidReferenceMapArchive_CellRefsForUuid] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(cellRefsForUuid value: TSCE_UuidReferenceMapArchive_CellRefsForUuid) { append(value, toMessages: 0) }
 }
 
 /// Generated wire model for `TSCE.UuidReferenceMapArchive.CellRefsForUuid`.
 final class TSCE_UuidReferenceMapArchive_CellRefsForUuid: IWAMessage {
-    var uuid: TSP_UUID?
-    var cellRef: [TSCE_InternalCellReferenceArchive] = []
-    var cellRefs: TSCE_InternalCellRefSetArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { uuid = _v }
-        case 2:
-            var _v: TSCE_InternalCellReferenceArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_InternalCellReferenceArchive(ProtobufMessage(_b)) }
-            if let _v { cellRef.append(_v) }
-        case 3:
-            var _v: TSCE_InternalCellRefSetArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_InternalCellRefSetArchive(ProtobufMessage(_b)) }
-            if let _v { cellRefs = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = uuid { _w.bytesField(1, _x.encoded()) }
-        for _x in cellRef { _w.bytesField(2, _x.encoded()) }
-        if let _x = cellRefs { _w.bytesField(3, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.UuidReferenceMapArchive.CellRefsForUuid", [
+        .optional(1, TSP_UUID.self), .repeated(2, TSCE_InternalCellReferenceArchive.self),
+        .optional(3, TSCE_InternalCellRefSetArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var uuid: TSP_UUID? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var cellRef: [TSCE_InternalCellReferenceArchive] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(cellRef value: TSCE_InternalCellReferenceArchive) { append(value, toMessages: 1) }
+    var cellRefs: TSCE_InternalCellRefSetArchive? { get { self[message: 2] } set { self[message: 2] = newValue } }
 }
 
 /// Generated wire model for `TSCE.GroupByNodeMapArchive`.
 final class TSCE_GroupByNodeMapArchive: IWAMessage {
-    var refsForGroupBy: [TSCE_GroupByNodeMapArchive_GroupNodesForGroupBy] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSCE_GroupByNodeMapArchive_GroupNodesForGroupBy?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_GroupByNodeMapArchive_GroupNodesForGroupBy(ProtobufMessage(_b)) }
-            if let _v { refsForGroupBy.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in refsForGroupBy { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.GroupByNodeMapArchive", [
+        .repeated(1, TSCE_GroupByNodeMapArchive_GroupNodesForGroupBy.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var refsForGroupBy: [TSCE_GroupByNodeMapArchive_GroupNodesForGroupBy] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(refsForGroupBy value: TSCE_GroupByNodeMapArchive_GroupNodesForGroupBy) { append(value, toMessages: 0) }
 }
 
 /// Generated wire model for `TSCE.GroupByNodeMapArchive.CellRefsForGroupNode`.
 final class TSCE_GroupByNodeMapArchive_CellRefsForGroupNode: IWAMessage {
-    var groupNodeUid: TSP_UUID?
-    var cellRefs: TSCE_InternalCellRefSetArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { groupNodeUid = _v }
-        case 3:
-            var _v: TSCE_InternalCellRefSetArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_InternalCellRefSetArchive(ProtobufMessage(_b)) }
-            if let _v { cellRefs = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = groupNodeUid { _w.bytesField(1, _x.encoded()) }
-        if let _x = cellRefs { _w.bytesField(3, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.GroupByNodeMapArchive.CellRefsForGroupNode", [
+        .optional(1, TSP_UUID.self), .optional(3, TSCE_InternalCellRefSetArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var groupNodeUid: TSP_UUID? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var cellRefs: TSCE_InternalCellRefSetArchive? { get { self[message: 1] } set { self[message: 1] = newValue } }
 }
 
 /// Generated wire model for `TSCE.GroupByNodeMapArchive.GroupNodesForGroupBy`.
 final class TSCE_GroupByNodeMapArchive_GroupNodesForGroupBy: IWAMessage {
-    var groupByUid: TSP_UUID?
-    var refsForGroupNode: [TSCE_GroupByNodeMapArchive_CellRefsForGroupNode] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { groupByUid = _v }
-        case 2:
-            var _v: TSCE_GroupByNodeMapArchive_CellRefsForGroupNode?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_GroupByNodeMapArchive_CellRefsForGroupNode(ProtobufMessage(_b)) }
-            if let _v { refsForGroupNode.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = groupByUid { _w.bytesField(1, _x.encoded()) }
-        for _x in refsForGroupNode { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.GroupByNodeMapArchive.GroupNodesForGroupBy", [
+        .optional(1, TSP_UUID.self), .repeated(2, TSCE_GroupByNodeMapArchive_CellRefsForGroupNode.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var groupByUid: TSP_UUID? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var refsForGroupNode: [TSCE_GroupByNodeMapArchive_CellRefsForGroupNode] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(refsForGroupNode value: TSCE_GroupByNodeMapArchive_CellRefsForGroupNode) { append(value, toMessages: 1) }
 }
 
 /// Generated wire model for `TSCE.CalculationEngineArchive`.
 final class TSCE_CalculationEngineArchive: IWAMessage {
-    var baseDate1904: Bool?
-    var dependencyTracker: TSCE_DependencyTrackerArchive?
-    var namedReferenceManager: TSP_Reference?
-    var excelImportDateMode: Int32?
-    var savedLocaleIdentifierFor42: String?
-    var documentRandomSeed: UInt64?
-    var uuidReferenceMap: TSCE_UuidReferenceMapArchive?
-    var documentTimestamp: Double?
-    var documentTimezone: String?
-    var tableUidHistory: TSCE_RewriteTableUIDInfoArchive?
-    var remoteDataStore: TSP_Reference?
-    var groupNodeMap: TSCE_GroupByNodeMapArchive?
-    var headerNameManager: TSP_Reference?
-    var refsToDirty: TSP_Reference?
-    var savedLocaleIdentifier: String?
-    var beginTrackingNamesLegacyNrm: [TSP_UUID] = []
-    var endTrackingNamesLegacyNrm: [TSP_UUID] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { baseDate1904 = _v }
-        case 2:
-            var _v: TSCE_DependencyTrackerArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_DependencyTrackerArchive(ProtobufMessage(_b)) }
-            if let _v { dependencyTracker = _v }
-        case 3:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { namedReferenceManager = _v }
-        case 4:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { excelImportDateMode = _v }
-        case 5:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { savedLocaleIdentifierFor42 = _v }
-        case 6:
-            var _v: UInt64?
-            if case .varint(let _u) = _f.value { _v = UInt64(truncatingIfNeeded: _u) }
-            if let _v { documentRandomSeed = _v }
-        case 7:
-            var _v: TSCE_UuidReferenceMapArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_UuidReferenceMapArchive(ProtobufMessage(_b)) }
-            if let _v { uuidReferenceMap = _v }
-        case 9:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { documentTimestamp = _v }
-        case 10:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { documentTimezone = _v }
-        case 11:
-            var _v: TSCE_RewriteTableUIDInfoArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_RewriteTableUIDInfoArchive(ProtobufMessage(_b)) }
-            if let _v { tableUidHistory = _v }
-        case 12:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { remoteDataStore = _v }
-        case 13:
-            var _v: TSCE_GroupByNodeMapArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_GroupByNodeMapArchive(ProtobufMessage(_b)) }
-            if let _v { groupNodeMap = _v }
-        case 14:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { headerNameManager = _v }
-        case 15:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { refsToDirty = _v }
-        case 16:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { savedLocaleIdentifier = _v }
-        case 17:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { beginTrackingNamesLegacyNrm.append(_v) }
-        case 18:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { endTrackingNamesLegacyNrm.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = baseDate1904 { _w.varintField(1, _x ? 1 : 0) }
-        if let _x = dependencyTracker { _w.bytesField(2, _x.encoded()) }
-        if let _x = namedReferenceManager { _w.bytesField(3, _x.encoded()) }
-        if let _x = excelImportDateMode { _w.varintField(4, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = savedLocaleIdentifierFor42 { _w.stringField(5, _x) }
-        if let _x = documentRandomSeed { _w.varintField(6, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = uuidReferenceMap { _w.bytesField(7, _x.encoded()) }
-        if let _x = documentTimestamp { _w.fixed64Field(9, _x.bitPattern) }
-        if let _x = documentTimezone { _w.stringField(10, _x) }
-        if let _x = tableUidHistory { _w.bytesField(11, _x.encoded()) }
-        if let _x = remoteDataStore { _w.bytesField(12, _x.encoded()) }
-        if let _x = groupNodeMap { _w.bytesField(13, _x.encoded()) }
-        if let _x = headerNameManager { _w.bytesField(14, _x.encoded()) }
-        if let _x = refsToDirty { _w.bytesField(15, _x.encoded()) }
-        if let _x = savedLocaleIdentifier { _w.stringField(16, _x) }
-        for _x in beginTrackingNamesLegacyNrm { _w.bytesField(17, _x.encoded()) }
-        for _x in endTrackingNamesLegacyNrm { _w.bytesField(18, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.CalculationEngineArchive", [
+        .optional(1, .bool), .optional(2, TSCE_DependencyTrackerArchive.self), .optional(3, TSP_Reference.self),
+        .optional(4, .int32), .optional(5, .string), .optional(6, .uint64),
+        .optional(7, TSCE_UuidReferenceMapArchive.self), .optional(9, .double), .optional(10, .string),
+        .optional(11, TSCE_RewriteTableUIDInfoArchive.self), .optional(12, TSP_Reference.self),
+        .optional(13, TSCE_GroupByNodeMapArchive.self), .optional(14, TSP_Reference.self),
+        .optional(15, TSP_Reference.self), .optional(16, .string), .repeated(17, TSP_UUID.self),
+        .repeated(18, TSP_UUID.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 17)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var baseDate1904: Bool? { get { self[0] } set { self[0] = newValue } }
+    var dependencyTracker: TSCE_DependencyTrackerArchive? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var namedReferenceManager: TSP_Reference? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var excelImportDateMode: Int32? { get { self[3] } set { self[3] = newValue } }
+    var savedLocaleIdentifierFor42: String? { get { self[4] } set { self[4] = newValue } }
+    var documentRandomSeed: UInt64? { get { self[5] } set { self[5] = newValue } }
+    var uuidReferenceMap: TSCE_UuidReferenceMapArchive? { get { self[message: 6] } set { self[message: 6] = newValue } }
+    var documentTimestamp: Double? { get { self[7] } set { self[7] = newValue } }
+    var documentTimezone: String? { get { self[8] } set { self[8] = newValue } }
+    var tableUidHistory: TSCE_RewriteTableUIDInfoArchive? { get { self[message: 9] } set { self[message: 9] = newValue } }
+    var remoteDataStore: TSP_Reference? { get { self[message: 10] } set { self[message: 10] = newValue } }
+    var groupNodeMap: TSCE_GroupByNodeMapArchive? { get { self[message: 11] } set { self[message: 11] = newValue } }
+    var headerNameManager: TSP_Reference? { get { self[message: 12] } set { self[message: 12] = newValue } }
+    var refsToDirty: TSP_Reference? { get { self[message: 13] } set { self[message: 13] = newValue } }
+    var savedLocaleIdentifier: String? { get { self[14] } set { self[14] = newValue } }
+    var beginTrackingNamesLegacyNrm: [TSP_UUID] { get { self[messages: 15] } set { self[messages: 15] = newValue } }
+    func append(beginTrackingNamesLegacyNrm value: TSP_UUID) { append(value, toMessages: 15) }
+    var endTrackingNamesLegacyNrm: [TSP_UUID] { get { self[messages: 16] } set { self[messages: 16] = newValue } }
+    func append(endTrackingNamesLegacyNrm value: TSP_UUID) { append(value, toMessages: 16) }
 }
 
 /// Generated wire model for `TSCE.PreserveColumnRowFlagsArchive`.
 final class TSCE_PreserveColumnRowFlagsArchive: IWAMessage {
-    var beginRowIsAbsolute: Bool?
-    var beginColumnIsAbsolute: Bool?
-    var endRowIsAbsolute: Bool?
-    var endColumnIsAbsolute: Bool?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { beginRowIsAbsolute = _v }
-        case 2:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { beginColumnIsAbsolute = _v }
-        case 3:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { endRowIsAbsolute = _v }
-        case 4:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { endColumnIsAbsolute = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = beginRowIsAbsolute { _w.varintField(1, _x ? 1 : 0) }
-        if let _x = beginColumnIsAbsolute { _w.varintField(2, _x ? 1 : 0) }
-        if let _x = endRowIsAbsolute { _w.varintField(3, _x ? 1 : 0) }
-        if let _x = endColumnIsAbsolute { _w.varintField(4, _x ? 1 : 0) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.PreserveColumnRowFlagsArchive", [
+        .optional(1, .bool), .optional(2, .bool), .optional(3, .bool), .optional(4, .bool),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var beginRowIsAbsolute: Bool? { get { self[0] } set { self[0] = newValue } }
+    var beginColumnIsAbsolute: Bool? { get { self[1] } set { self[1] = newValue } }
+    var endRowIsAbsolute: Bool? { get { self[2] } set { self[2] = newValue } }
+    var endColumnIsAbsolute: Bool? { get { self[3] } set { self[3] = newValue } }
 }
 
 /// Generated wire model for `TSCE.CategoryReferenceArchive`.
 final class TSCE_CategoryReferenceArchive: IWAMessage {
-    var groupByUid: TSP_UUID?
-    var columnUid: TSP_UUID?
-    var aggregateType: UInt32?
-    var groupLevel: Int32?
-    var groupUids: TSCE_CategoryReferenceArchive_CatRefUidList?
-    var preserveFlags: TSCE_PreserveColumnRowFlagsArchive?
-    var relativeColumn: Int32?
-    var relativeGroupUid: TSP_UUID?
-    var absoluteGroupUid: TSP_UUID?
-    var optionRefersToPivotRows: Bool?
-    var optionRefersToPivotColumns: Bool?
-    var aggIndexLevel: UInt32?
-    var optionShowAggregateName: Bool?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { groupByUid = _v }
-        case 2:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { columnUid = _v }
-        case 3:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { aggregateType = _v }
-        case 4:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = IWAWire.unzigzag32(_u) }
-            if let _v { groupLevel = _v }
-        case 6:
-            var _v: TSCE_CategoryReferenceArchive_CatRefUidList?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CategoryReferenceArchive_CatRefUidList(ProtobufMessage(_b)) }
-            if let _v { groupUids = _v }
-        case 7:
-            var _v: TSCE_PreserveColumnRowFlagsArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_PreserveColumnRowFlagsArchive(ProtobufMessage(_b)) }
-            if let _v { preserveFlags = _v }
-        case 8:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { relativeColumn = _v }
-        case 9:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { relativeGroupUid = _v }
-        case 10:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { absoluteGroupUid = _v }
-        case 11:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { optionRefersToPivotRows = _v }
-        case 12:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { optionRefersToPivotColumns = _v }
-        case 13:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { aggIndexLevel = _v }
-        case 14:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { optionShowAggregateName = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = groupByUid { _w.bytesField(1, _x.encoded()) }
-        if let _x = columnUid { _w.bytesField(2, _x.encoded()) }
-        if let _x = aggregateType { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = groupLevel { _w.varintField(4, IWAWire.zigzag32(_x)) }
-        if let _x = groupUids { _w.bytesField(6, _x.encoded()) }
-        if let _x = preserveFlags { _w.bytesField(7, _x.encoded()) }
-        if let _x = relativeColumn { _w.varintField(8, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = relativeGroupUid { _w.bytesField(9, _x.encoded()) }
-        if let _x = absoluteGroupUid { _w.bytesField(10, _x.encoded()) }
-        if let _x = optionRefersToPivotRows { _w.varintField(11, _x ? 1 : 0) }
-        if let _x = optionRefersToPivotColumns { _w.varintField(12, _x ? 1 : 0) }
-        if let _x = aggIndexLevel { _w.varintField(13, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = optionShowAggregateName { _w.varintField(14, _x ? 1 : 0) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.CategoryReferenceArchive", [
+        .optional(1, TSP_UUID.self), .optional(2, TSP_UUID.self), .optional(3, .uint32), .optional(4, .sint32),
+        .optional(6, TSCE_CategoryReferenceArchive_CatRefUidList.self),
+        .optional(7, TSCE_PreserveColumnRowFlagsArchive.self), .optional(8, .int32), .optional(9, TSP_UUID.self),
+        .optional(10, TSP_UUID.self), .optional(11, .bool), .optional(12, .bool), .optional(13, .uint32),
+        .optional(14, .bool),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 13)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var groupByUid: TSP_UUID? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var columnUid: TSP_UUID? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var aggregateType: UInt32? { get { self[2] } set { self[2] = newValue } }
+    var groupLevel: Int32? { get { self[3] } set { self[3] = newValue } }
+    var groupUids: TSCE_CategoryReferenceArchive_CatRefUidList? { get { self[message: 4] } set { self[message: 4] = newValue } }
+    var preserveFlags: TSCE_PreserveColumnRowFlagsArchive? { get { self[message: 5] } set { self[message: 5] = newValue } }
+    var relativeColumn: Int32? { get { self[6] } set { self[6] = newValue } }
+    var relativeGroupUid: TSP_UUID? { get { self[message: 7] } set { self[message: 7] = newValue } }
+    var absoluteGroupUid: TSP_UUID? { get { self[message: 8] } set { self[message: 8] = newValue } }
+    var optionRefersToPivotRows: Bool? { get { self[9] } set { self[9] = newValue } }
+    var optionRefersToPivotColumns: Bool? { get { self[10] } set { self[10] = newValue } }
+    var aggIndexLevel: UInt32? { get { self[11] } set { self[11] = newValue } }
+    var optionShowAggregateName: Bool? { get { self[12] } set { self[12] = newValue } }
 }
 
 /// Generated wire model for `TSCE.CategoryReferenceArchive.CatRefUidList`.
 final class TSCE_CategoryReferenceArchive_CatRefUidList: IWAMessage {
-    var uid: [TSP_UUID] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { uid.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in uid { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.CategoryReferenceArchive.CatRefUidList", [
+        .repeated(1, TSP_UUID.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var uid: [TSP_UUID] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(uid value: TSP_UUID) { append(value, toMessages: 0) }
 }
 
 /// Generated wire model for `TSCE.ASTNodeArrayArchive`.
 final class TSCE_ASTNodeArrayArchive: IWAMessage {
-    var astNode: [TSCE_ASTNodeArrayArchive_ASTNodeArchive] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSCE_ASTNodeArrayArchive_ASTNodeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_ASTNodeArrayArchive_ASTNodeArchive(ProtobufMessage(_b)) }
-            if let _v { astNode.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in astNode { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.ASTNodeArrayArchive", [
+        .repeated(1, TSCE_ASTNodeArrayArchive_ASTNodeArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var astNode: [TSCE_ASTNodeArrayArchive_ASTNodeArchive] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(astNode value: TSCE_ASTNodeArrayArchive_ASTNodeArchive) { append(value, toMessages: 0) }
 }
 
 /// Generated wire model for `TSCE.ASTNodeArrayArchive.ASTLocalCellReferenceNodeArchive`.
 final class TSCE_ASTNodeArrayArchive_ASTLocalCellReferenceNodeArchive: IWAMessage {
-    var rowHandle: UInt32?
-    var columnHandle: UInt32?
-    var rowIsSticky: UInt32?
-    var columnIsSticky: UInt32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { rowHandle = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { columnHandle = _v }
-        case 3:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { rowIsSticky = _v }
-        case 4:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { columnIsSticky = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = rowHandle { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = columnHandle { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = rowIsSticky { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = columnIsSticky { _w.varintField(4, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.ASTNodeArrayArchive.ASTLocalCellReferenceNodeArchive", [
+        .optional(1, .uint32), .optional(2, .uint32), .optional(3, .uint32), .optional(4, .uint32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var rowHandle: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var columnHandle: UInt32? { get { self[1] } set { self[1] = newValue } }
+    var rowIsSticky: UInt32? { get { self[2] } set { self[2] = newValue } }
+    var columnIsSticky: UInt32? { get { self[3] } set { self[3] = newValue } }
 }
 
 /// Generated wire model for `TSCE.ASTNodeArrayArchive.ASTCrossTableCellReferenceNodeArchive`.
 final class TSCE_ASTNodeArrayArchive_ASTCrossTableCellReferenceNodeArchive: IWAMessage {
-    var rowHandle: UInt32?
-    var columnHandle: UInt32?
-    var rowIsSticky: UInt32?
-    var columnIsSticky: UInt32?
-    var tableId: TSP_CFUUIDArchive?
-    var astReferenceWhitespaceAfterSheetName: String?
-    var astReferenceWhitespaceBeforeTableName: String?
-    var astReferenceWhitespaceAfterTableName: String?
-    var astReferenceWhitespaceBeforeCellAddress: String?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { rowHandle = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { columnHandle = _v }
-        case 3:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { rowIsSticky = _v }
-        case 4:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { columnIsSticky = _v }
-        case 5:
-            var _v: TSP_CFUUIDArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_CFUUIDArchive(ProtobufMessage(_b)) }
-            if let _v { tableId = _v }
-        case 6:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { astReferenceWhitespaceAfterSheetName = _v }
-        case 7:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { astReferenceWhitespaceBeforeTableName = _v }
-        case 8:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { astReferenceWhitespaceAfterTableName = _v }
-        case 9:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { astReferenceWhitespaceBeforeCellAddress = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = rowHandle { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = columnHandle { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = rowIsSticky { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = columnIsSticky { _w.varintField(4, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = tableId { _w.bytesField(5, _x.encoded()) }
-        if let _x = astReferenceWhitespaceAfterSheetName { _w.stringField(6, _x) }
-        if let _x = astReferenceWhitespaceBeforeTableName { _w.stringField(7, _x) }
-        if let _x = astReferenceWhitespaceAfterTableName { _w.stringField(8, _x) }
-        if let _x = astReferenceWhitespaceBeforeCellAddress { _w.stringField(9, _x) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.ASTNodeArrayArchive.ASTCrossTableCellReferenceNodeArchive", [
+        .optional(1, .uint32), .optional(2, .uint32), .optional(3, .uint32), .optional(4, .uint32),
+        .optional(5, TSP_CFUUIDArchive.self), .optional(6, .string), .optional(7, .string), .optional(8, .string),
+        .optional(9, .string),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 9)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var rowHandle: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var columnHandle: UInt32? { get { self[1] } set { self[1] = newValue } }
+    var rowIsSticky: UInt32? { get { self[2] } set { self[2] = newValue } }
+    var columnIsSticky: UInt32? { get { self[3] } set { self[3] = newValue } }
+    var tableId: TSP_CFUUIDArchive? { get { self[message: 4] } set { self[message: 4] = newValue } }
+    var astReferenceWhitespaceAfterSheetName: String? { get { self[5] } set { self[5] = newValue } }
+    var astReferenceWhitespaceBeforeTableName: String? { get { self[6] } set { self[6] = newValue } }
+    var astReferenceWhitespaceAfterTableName: String? { get { self[7] } set { self[7] = newValue } }
+    var astReferenceWhitespaceBeforeCellAddress: String? { get { self[8] } set { self[8] = newValue } }
 }
 
 /// Generated wire model for `TSCE.ASTNodeArrayArchive.ASTColumnCoordinateArchive`.
 final class TSCE_ASTNodeArrayArchive_ASTColumnCoordinateArchive: IWAMessage {
-    var column: Int32?
-    var absolute: Bool?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = IWAWire.unzigzag32(_u) }
-            if let _v { column = _v }
-        case 2:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { absolute = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = column { _w.varintField(1, IWAWire.zigzag32(_x)) }
-        if let _x = absolute { _w.varintField(2, _x ? 1 : 0) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.ASTNodeArrayArchive.ASTColumnCoordinateArchive", [
+        .optional(1, .sint32), .optional(2, .bool),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var column: Int32? { get { self[0] } set { self[0] = newValue } }
+    var absolute: Bool? { get { self[1] } set { self[1] = newValue } }
 }
 
 /// Generated wire model for `TSCE.ASTNodeArrayArchive.ASTRowCoordinateArchive`.
 final class TSCE_ASTNodeArrayArchive_ASTRowCoordinateArchive: IWAMessage {
-    var row: Int32?
-    var absolute: Bool?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = IWAWire.unzigzag32(_u) }
-            if let _v { row = _v }
-        case 2:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { absolute = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = row { _w.varintField(1, IWAWire.zigzag32(_x)) }
-        if let _x = absolute { _w.varintField(2, _x ? 1 : 0) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.ASTNodeArrayArchive.ASTRowCoordinateArchive", [
+        .optional(1, .sint32), .optional(2, .bool),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var row: Int32? { get { self[0] } set { self[0] = newValue } }
+    var absolute: Bool? { get { self[1] } set { self[1] = newValue } }
 }
 
 /// Generated wire model for `TSCE.ASTNodeArrayArchive.ASTUidList`.
 final class TSCE_ASTNodeArrayArchive_ASTUidList: IWAMessage {
-    var uid: [TSP_UUID] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { uid.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in uid { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.ASTNodeArrayArchive.ASTUidList", [
+        .repeated(1, TSP_UUID.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var uid: [TSP_UUID] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(uid value: TSP_UUID) { append(value, toMessages: 0) }
 }
 
 /// Generated wire model for `TSCE.ASTNodeArrayArchive.ASTUidTract`.
 final class TSCE_ASTNodeArrayArchive_ASTUidTract: IWAMessage {
-    var columnuids: TSCE_ASTNodeArrayArchive_ASTUidList?
-    var rowuids: TSCE_ASTNodeArrayArchive_ASTUidList?
-    var isRangeRef: Bool?
-    var purpose: Int32?
-    var preserveRectangular: Bool?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSCE_ASTNodeArrayArchive_ASTUidList?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_ASTNodeArrayArchive_ASTUidList(ProtobufMessage(_b)) }
-            if let _v { columnuids = _v }
-        case 2:
-            var _v: TSCE_ASTNodeArrayArchive_ASTUidList?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_ASTNodeArrayArchive_ASTUidList(ProtobufMessage(_b)) }
-            if let _v { rowuids = _v }
-        case 3:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { isRangeRef = _v }
-        case 4:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { purpose = _v }
-        case 5:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { preserveRectangular = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = columnuids { _w.bytesField(1, _x.encoded()) }
-        if let _x = rowuids { _w.bytesField(2, _x.encoded()) }
-        if let _x = isRangeRef { _w.varintField(3, _x ? 1 : 0) }
-        if let _x = purpose { _w.varintField(4, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = preserveRectangular { _w.varintField(5, _x ? 1 : 0) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.ASTNodeArrayArchive.ASTUidTract", [
+        .optional(1, TSCE_ASTNodeArrayArchive_ASTUidList.self), .optional(2, TSCE_ASTNodeArrayArchive_ASTUidList.self),
+        .optional(3, .bool), .optional(4, .int32), .optional(5, .bool),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 5)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var columnuids: TSCE_ASTNodeArrayArchive_ASTUidList? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var rowuids: TSCE_ASTNodeArrayArchive_ASTUidList? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var isRangeRef: Bool? { get { self[2] } set { self[2] = newValue } }
+    var purpose: Int32? { get { self[3] } set { self[3] = newValue } }
+    var preserveRectangular: Bool? { get { self[4] } set { self[4] = newValue } }
 }
 
 /// Generated wire model for `TSCE.ASTNodeArrayArchive.ASTStickyBits`.
 final class TSCE_ASTNodeArrayArchive_ASTStickyBits: IWAMessage {
-    var beginRowIsAbsolute: Bool?
-    var beginColumnIsAbsolute: Bool?
-    var endRowIsAbsolute: Bool?
-    var endColumnIsAbsolute: Bool?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { beginRowIsAbsolute = _v }
-        case 2:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { beginColumnIsAbsolute = _v }
-        case 3:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { endRowIsAbsolute = _v }
-        case 4:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { endColumnIsAbsolute = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = beginRowIsAbsolute { _w.varintField(1, _x ? 1 : 0) }
-        if let _x = beginColumnIsAbsolute { _w.varintField(2, _x ? 1 : 0) }
-        if let _x = endRowIsAbsolute { _w.varintField(3, _x ? 1 : 0) }
-        if let _x = endColumnIsAbsolute { _w.varintField(4, _x ? 1 : 0) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.ASTNodeArrayArchive.ASTStickyBits", [
+        .optional(1, .bool), .optional(2, .bool), .optional(3, .bool), .optional(4, .bool),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var beginRowIsAbsolute: Bool? { get { self[0] } set { self[0] = newValue } }
+    var beginColumnIsAbsolute: Bool? { get { self[1] } set { self[1] = newValue } }
+    var endRowIsAbsolute: Bool? { get { self[2] } set { self[2] = newValue } }
+    var endColumnIsAbsolute: Bool? { get { self[3] } set { self[3] = newValue } }
 }
 
 /// Generated wire model for `TSCE.ASTNodeArrayArchive.ASTUidTractList`.
 final class TSCE_ASTNodeArrayArchive_ASTUidTractList: IWAMessage {
-    var tract: [TSCE_ASTNodeArrayArchive_ASTUidTract] = []
-    var stickyBits: TSCE_ASTNodeArrayArchive_ASTStickyBits?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSCE_ASTNodeArrayArchive_ASTUidTract?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_ASTNodeArrayArchive_ASTUidTract(ProtobufMessage(_b)) }
-            if let _v { tract.append(_v) }
-        case 2:
-            var _v: TSCE_ASTNodeArrayArchive_ASTStickyBits?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_ASTNodeArrayArchive_ASTStickyBits(ProtobufMessage(_b)) }
-            if let _v { stickyBits = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in tract { _w.bytesField(1, _x.encoded()) }
-        if let _x = stickyBits { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.ASTNodeArrayArchive.ASTUidTractList", [
+        .repeated(1, TSCE_ASTNodeArrayArchive_ASTUidTract.self),
+        .optional(2, TSCE_ASTNodeArrayArchive_ASTStickyBits.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var tract: [TSCE_ASTNodeArrayArchive_ASTUidTract] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(tract value: TSCE_ASTNodeArrayArchive_ASTUidTract) { append(value, toMessages: 0) }
+    var stickyBits: TSCE_ASTNodeArrayArchive_ASTStickyBits? { get { self[message: 1] } set { self[message: 1] = newValue } }
 }
 
 /// Generated wire model for `TSCE.ASTNodeArrayArchive.ASTUidCoordinateArchive`.
 final class TSCE_ASTNodeArrayArchive_ASTUidCoordinateArchive: IWAMessage {
-    var columnUid: TSP_UUID?
-    var rowUid: TSP_UUID?
-    var columnAbsolute: Bool?
-    var rowAbsolute: Bool?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { columnUid = _v }
-        case 2:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { rowUid = _v }
-        case 3:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { columnAbsolute = _v }
-        case 4:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { rowAbsolute = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = columnUid { _w.bytesField(1, _x.encoded()) }
-        if let _x = rowUid { _w.bytesField(2, _x.encoded()) }
-        if let _x = columnAbsolute { _w.varintField(3, _x ? 1 : 0) }
-        if let _x = rowAbsolute { _w.varintField(4, _x ? 1 : 0) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.ASTNodeArrayArchive.ASTUidCoordinateArchive", [
+        .optional(1, TSP_UUID.self), .optional(2, TSP_UUID.self), .optional(3, .bool), .optional(4, .bool),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var columnUid: TSP_UUID? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var rowUid: TSP_UUID? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var columnAbsolute: Bool? { get { self[2] } set { self[2] = newValue } }
+    var rowAbsolute: Bool? { get { self[3] } set { self[3] = newValue } }
 }
 
 /// Generated wire model for `TSCE.ASTNodeArrayArchive.ASTCategoryLevels`.
 final class TSCE_ASTNodeArrayArchive_ASTCategoryLevels: IWAMessage {
-    var astColumnGroupLevel: UInt32?
-    var astRowGroupLevel: UInt32?
-    var astAggIndexLevel: UInt32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { astColumnGroupLevel = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { astRowGroupLevel = _v }
-        case 3:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { astAggIndexLevel = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = astColumnGroupLevel { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = astRowGroupLevel { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = astAggIndexLevel { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.ASTNodeArrayArchive.ASTCategoryLevels", [
+        .optional(1, .uint32), .optional(2, .uint32), .optional(3, .uint32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var astColumnGroupLevel: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var astRowGroupLevel: UInt32? { get { self[1] } set { self[1] = newValue } }
+    var astAggIndexLevel: UInt32? { get { self[2] } set { self[2] = newValue } }
 }
 
 /// Generated wire model for `TSCE.ASTNodeArrayArchive.ASTCategoryReferenceArchive`.
 final class TSCE_ASTNodeArrayArchive_ASTCategoryReferenceArchive: IWAMessage {
-    var categoryRef: TSCE_CategoryReferenceArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSCE_CategoryReferenceArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CategoryReferenceArchive(ProtobufMessage(_b)) }
-            if let _v { categoryRef = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = categoryRef { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.ASTNodeArrayArchive.ASTCategoryReferenceArchive", [
+        .optional(1, TSCE_CategoryReferenceArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var categoryRef: TSCE_CategoryReferenceArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
 }
 
 /// Generated wire model for `TSCE.ASTNodeArrayArchive.ASTColonTractArchive`.
 final class TSCE_ASTNodeArrayArchive_ASTColonTractArchive: IWAMessage {
-    var relativeColumn: [TSCE_ASTNodeArrayArchive_ASTColonTractArchive_ASTColonTractRelativeRangeArchive] = []
-    var relativeRow: [TSCE_ASTNodeArrayArchive_ASTColonTractArchive_ASTColonTractRelativeRangeArchive] = []
-    var absoluteColumn: [TSCE_ASTNodeArrayArchive_ASTColonTractArchive_ASTColonTractAbsoluteRangeArchive] = []
-    var absoluteRow: [TSCE_ASTNodeArrayArchive_ASTColonTractArchive_ASTColonTractAbsoluteRangeArchive] = []
-    var preserveRectangular: Bool?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSCE_ASTNodeArrayArchive_ASTColonTractArchive_ASTColonTractRelativeRangeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_ASTNodeArrayArchive_ASTColonTractArchive_ASTColonTractRelativeRangeArchive(ProtobufMessage(_b)) }
-            if let _v { relativeColumn.append(_v) }
-        case 2:
-            var _v: TSCE_ASTNodeArrayArchive_ASTColonTractArchive_ASTColonTractRelativeRangeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_ASTNodeArrayArchive_ASTColonTractArchive_ASTColonTractRelativeRangeArchive(ProtobufMessage(_b)) }
-            if let _v { relativeRow.append(_v) }
-        case 3:
-            var _v: TSCE_ASTNodeArrayArchive_ASTColonTractArchive_ASTColonTractAbsoluteRangeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_ASTNodeArrayArchive_ASTColonTractArchive_ASTColonTractAbsoluteRangeArchive(ProtobufMessage(_b)) }
-            if let _v { absoluteColumn.append(_v) }
-        case 4:
-            var _v: TSCE_ASTNodeArrayArchive_ASTColonTractArchive_ASTColonTractAbsoluteRangeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_ASTNodeArrayArchive_ASTColonTractArchive_ASTColonTractAbsoluteRangeArchive(ProtobufMessage(_b)) }
-            if let _v { absoluteRow.append(_v) }
-        case 5:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { preserveRectangular = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in relativeColumn { _w.bytesField(1, _x.encoded()) }
-        for _x in relativeRow { _w.bytesField(2, _x.encoded()) }
-        for _x in absoluteColumn { _w.bytesField(3, _x.encoded()) }
-        for _x in absoluteRow { _w.bytesField(4, _x.encoded()) }
-        if let _x = preserveRectangular { _w.varintField(5, _x ? 1 : 0) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.ASTNodeArrayArchive.ASTColonTractArchive", [
+        .repeated(1, TSCE_ASTNodeArrayArchive_ASTColonTractArchive_ASTColonTractRelativeRangeArchive.self),
+        .repeated(2, TSCE_ASTNodeArrayArchive_ASTColonTractArchive_ASTColonTractRelativeRangeArchive.self),
+        .repeated(3, TSCE_ASTNodeArrayArchive_ASTColonTractArchive_ASTColonTractAbsoluteRangeArchive.self),
+        .repeated(4, TSCE_ASTNodeArrayArchive_ASTColonTractArchive_ASTColonTractAbsoluteRangeArchive.self),
+        .optional(5, .bool),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 5)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var relativeColumn: [TSCE_ASTNodeArrayArchive_ASTColonTractArchive_ASTColonTractRelativeRangeArchive] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(relativeColumn value: TSCE_ASTNodeArrayArchive_ASTColonTractArchive_ASTColonTractRelativeRangeArchive) { append(value, toMessages: 0) }
+    var relativeRow: [TSCE_ASTNodeArrayArchive_ASTColonTractArchive_ASTColonTractRelativeRangeArchive] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(relativeRow value: TSCE_ASTNodeArrayArchive_ASTColonTractArchive_ASTColonTractRelativeRangeArchive) { append(value, toMessages: 1) }
+    var absoluteColumn: [TSCE_ASTNodeArrayArchive_ASTColonTractArchive_ASTColonTractAbsoluteRangeArchive] { get { self[messages: 2] } set { self[messages: 2] = newValue } }
+    func append(absoluteColumn value: TSCE_ASTNodeArrayArchive_ASTColonTractArchive_ASTColonTractAbsoluteRangeArchive) { append(value, toMessages: 2) }
+    var absoluteRow: [TSCE_ASTNodeArrayArchive_ASTColonTractArchive_ASTColonTractAbsoluteRangeArchive] { get { self[messages: 3] } set { self[messages: 3] = newValue } }
+    func append(absoluteRow value: TSCE_ASTNodeArrayArchive_ASTColonTractArchive_ASTColonTractAbsoluteRangeArchive) { append(value, toMessages: 3) }
+    var preserveRectangular: Bool? { get { self[4] } set { self[4] = newValue } }
 }
 
 /// Generated wire model for `TSCE.ASTNodeArrayArchive.ASTColonTractArchive.ASTColonTractRelativeRangeArchive`.
 final class TSCE_ASTNodeArrayArchive_ASTColonTractArchive_ASTColonTractRelativeRangeArchive: IWAMessage {
-    var rangeBegin: Int32?
-    var rangeEnd: Int32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { rangeBegin = _v }
-        case 2:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { rangeEnd = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = rangeBegin { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = rangeEnd { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.ASTNodeArrayArchive.ASTColonTractArchive.ASTColonTractRelativeRangeArchive", [
+        .optional(1, .int32), .optional(2, .int32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var rangeBegin: Int32? { get { self[0] } set { self[0] = newValue } }
+    var rangeEnd: Int32? { get { self[1] } set { self[1] = newValue } }
 }
 
 /// Generated wire model for `TSCE.ASTNodeArrayArchive.ASTColonTractArchive.ASTColonTractAbsoluteRangeArchive`.
 final class TSCE_ASTNodeArrayArchive_ASTColonTractArchive_ASTColonTractAbsoluteRangeArchive: IWAMessage {
-    var rangeBegin: UInt32?
-    var rangeEnd: UInt32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { rangeBegin = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { rangeEnd = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = rangeBegin { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = rangeEnd { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.ASTNodeArrayArchive.ASTColonTractArchive.ASTColonTractAbsoluteRangeArchive", [
+        .optional(1, .uint32), .optional(2, .uint32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var rangeBegin: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var rangeEnd: UInt32? { get { self[1] } set { self[1] = newValue } }
 }
 
 /// Generated wire model for `TSCE.ASTNodeArrayArchive.ASTCrossTableReferenceExtraInfoArchive`.
 final class TSCE_ASTNodeArrayArchive_ASTCrossTableReferenceExtraInfoArchive: IWAMessage {
-    var tableId: TSP_CFUUIDArchive?
-    var astReferenceWhitespaceAfterSheetName: String?
-    var astReferenceWhitespaceBeforeTableName: String?
-    var astReferenceWhitespaceAfterTableName: String?
-    var astReferenceWhitespaceBeforeCellAddress: String?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_CFUUIDArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_CFUUIDArchive(ProtobufMessage(_b)) }
-            if let _v { tableId = _v }
-        case 2:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { astReferenceWhitespaceAfterSheetName = _v }
-        case 3:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { astReferenceWhitespaceBeforeTableName = _v }
-        case 4:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { astReferenceWhitespaceAfterTableName = _v }
-        case 5:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { astReferenceWhitespaceBeforeCellAddress = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = tableId { _w.bytesField(1, _x.encoded()) }
-        if let _x = astReferenceWhitespaceAfterSheetName { _w.stringField(2, _x) }
-        if let _x = astReferenceWhitespaceBeforeTableName { _w.stringField(3, _x) }
-        if let _x = astReferenceWhitespaceAfterTableName { _w.stringField(4, _x) }
-        if let _x = astReferenceWhitespaceBeforeCellAddress { _w.stringField(5, _x) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.ASTNodeArrayArchive.ASTCrossTableReferenceExtraInfoArchive", [
+        .optional(1, TSP_CFUUIDArchive.self), .optional(2, .string), .optional(3, .string), .optional(4, .string),
+        .optional(5, .string),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 5)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var tableId: TSP_CFUUIDArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var astReferenceWhitespaceAfterSheetName: String? { get { self[1] } set { self[1] = newValue } }
+    var astReferenceWhitespaceBeforeTableName: String? { get { self[2] } set { self[2] = newValue } }
+    var astReferenceWhitespaceAfterTableName: String? { get { self[3] } set { self[3] = newValue } }
+    var astReferenceWhitespaceBeforeCellAddress: String? { get { self[4] } set { self[4] = newValue } }
 }
 
 /// Generated wire model for `TSCE.ASTNodeArrayArchive.ASTLambdaIdentsListArchive`.
 final class TSCE_ASTNodeArrayArchive_ASTLambdaIdentsListArchive: IWAMessage {
-    var astIdentifierString: [String] = []
-    var astFirstSymbol: UInt32?
-    var astWhitespaceBeforeIdents: String?
-    var astWhitespaceAfterIdents: String?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { astIdentifierString.append(_v) }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { astFirstSymbol = _v }
-        case 3:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { astWhitespaceBeforeIdents = _v }
-        case 4:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { astWhitespaceAfterIdents = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in astIdentifierString { _w.stringField(1, _x) }
-        if let _x = astFirstSymbol { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = astWhitespaceBeforeIdents { _w.stringField(3, _x) }
-        if let _x = astWhitespaceAfterIdents { _w.stringField(4, _x) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.ASTNodeArrayArchive.ASTLambdaIdentsListArchive", [
+        .repeated(1, .string), .optional(2, .uint32), .optional(3, .string), .optional(4, .string),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var astIdentifierString: [String] { get { self[all: 0] } set { self[all: 0] = newValue } }
+    func append(astIdentifierString value: String) { append(value, toAll: 0) }
+    var astFirstSymbol: UInt32? { get { self[1] } set { self[1] = newValue } }
+    var astWhitespaceBeforeIdents: String? { get { self[2] } set { self[2] = newValue } }
+    var astWhitespaceAfterIdents: String? { get { self[3] } set { self[3] = newValue } }
 }
 
 /// Generated wire model for `TSCE.ASTNodeArrayArchive.ASTNodeArchive`.
 final class TSCE_ASTNodeArrayArchive_ASTNodeArchive: IWAMessage {
-    var astNodeType: Int32?
-    var astFunctionNodeIndex: UInt32?
-    var astFunctionNodeNumArgs: UInt32?
-    var astNumberNodeNumber: Double?
-    var astBooleanNodeBoolean: Bool?
-    var astStringNodeString: String?
-    var astDateNodeDateNum: Double?
-    var astDateNodeSuppressDateFormat: Bool?
-    var astDateNodeSuppressTimeFormat: Bool?
-    var astDateNodeDateTimeFormat: String?
-    var astDurationNodeUnitNum: Double?
-    var astDurationNodeUnit: Int32?
-    var astDurationNodeStyle: UInt32?
-    var astDurationNodeDurationUnitLargest: UInt32?
-    var astDurationNodeDurationUnitSmallest: UInt32?
-    var astDurationNodeUseAutomaticUnits: Bool?
-    var astTokenNodeBoolean: Bool?
-    var astArrayNodeNumCol: UInt32?
-    var astArrayNodeNumRow: UInt32?
-    var astListNodeNumArgs: UInt32?
-    var astThunkNodeArray: TSCE_ASTNodeArrayArchive?
-    var astLocalCellReferenceNodeReference: TSCE_ASTNodeArrayArchive_ASTLocalCellReferenceNodeArchive?
-    var astCrossTableCellReferenceNodeReference: TSCE_ASTNodeArrayArchive_ASTCrossTableCellReferenceNodeArchive?
-    var astUnknownFunctionNodeString: String?
-    var astUnknownFunctionNodeNumArgs: UInt32?
-    var astWhitespace: String?
-    var astColumn: TSCE_ASTNodeArrayArchive_ASTColumnCoordinateArchive?
-    var astRow: TSCE_ASTNodeArrayArchive_ASTRowCoordinateArchive?
-    var astCrossTableReferenceExtraInfo: TSCE_ASTNodeArrayArchive_ASTCrossTableReferenceExtraInfoArchive?
-    var astUidCoordinate: TSCE_ASTNodeArrayArchive_ASTUidCoordinateArchive?
-    var astStickyBits: TSCE_ASTNodeArrayArchive_ASTStickyBits?
-    var astFrozenStickyBits: TSCE_ASTNodeArrayArchive_ASTStickyBits?
-    var astLetIdentifier: String?
-    var astLetWhitespace: String?
-    var astLetIsContinuation: Bool?
-    var astSymbol: UInt32?
-    var astTractList: TSCE_ASTNodeArrayArchive_ASTUidTractList?
-    var astCategoryRef: TSCE_ASTNodeArrayArchive_ASTCategoryReferenceArchive?
-    var astColonTract: TSCE_ASTNodeArrayArchive_ASTColonTractArchive?
-    var astNumberNodeDecimalLow: UInt64?
-    var astNumberNodeDecimalHigh: UInt64?
-    var astCategoryLevels: TSCE_ASTNodeArrayArchive_ASTCategoryLevels?
-    var astLambdaIdents: TSCE_ASTNodeArrayArchive_ASTLambdaIdentsListArchive?
-    var astRangeContext: UInt32?
-    var upgradeNodeType: Int32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { astNodeType = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { astFunctionNodeIndex = _v }
-        case 3:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { astFunctionNodeNumArgs = _v }
-        case 4:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { astNumberNodeNumber = _v }
-        case 5:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { astBooleanNodeBoolean = _v }
-        case 6:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { astStringNodeString = _v }
-        case 7:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { astDateNodeDateNum = _v }
-        case 19:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { astDateNodeSuppressDateFormat = _v }
-        case 20:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { astDateNodeSuppressTimeFormat = _v }
-        case 21:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { astDateNodeDateTimeFormat = _v }
-        case 8:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { astDurationNodeUnitNum = _v }
-        case 9:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { astDurationNodeUnit = _v }
-        case 22:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { astDurationNodeStyle = _v }
-        case 23:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { astDurationNodeDurationUnitLargest = _v }
-        case 24:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { astDurationNodeDurationUnitSmallest = _v }
-        case 29:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { astDurationNodeUseAutomaticUnits = _v }
-        case 10:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { astTokenNodeBoolean = _v }
-        case 11:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { astArrayNodeNumCol = _v }
-        case 12:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { astArrayNodeNumRow = _v }
-        case 13:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { astListNodeNumArgs = _v }
-        case 14:
-            var _v: TSCE_ASTNodeArrayArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_ASTNodeArrayArchive(ProtobufMessage(_b)) }
-            if let _v { astThunkNodeArray = _v }
-        case 15:
-            var _v: TSCE_ASTNodeArrayArchive_ASTLocalCellReferenceNodeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_ASTNodeArrayArchive_ASTLocalCellReferenceNodeArchive(ProtobufMessage(_b)) }
-            if let _v { astLocalCellReferenceNodeReference = _v }
-        case 16:
-            var _v: TSCE_ASTNodeArrayArchive_ASTCrossTableCellReferenceNodeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_ASTNodeArrayArchive_ASTCrossTableCellReferenceNodeArchive(ProtobufMessage(_b)) }
-            if let _v { astCrossTableCellReferenceNodeReference = _v }
-        case 17:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { astUnknownFunctionNodeString = _v }
-        case 18:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { astUnknownFunctionNodeNumArgs = _v }
-        case 25:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { astWhitespace = _v }
-        case 26:
-            var _v: TSCE_ASTNodeArrayArchive_ASTColumnCoordinateArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_ASTNodeArrayArchive_ASTColumnCoordinateArchive(ProtobufMessage(_b)) }
-            if let _v { astColumn = _v }
-        case 27:
-            var _v: TSCE_ASTNodeArrayArchive_ASTRowCoordinateArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_ASTNodeArrayArchive_ASTRowCoordinateArchive(ProtobufMessage(_b)) }
-            if let _v { astRow = _v }
-        case 28:
-            var _v: TSCE_ASTNodeArrayArchive_ASTCrossTableReferenceExtraInfoArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_ASTNodeArrayArchive_ASTCrossTableReferenceExtraInfoArchive(ProtobufMessage(_b)) }
-            if let _v { astCrossTableReferenceExtraInfo = _v }
-        case 30:
-            var _v: TSCE_ASTNodeArrayArchive_ASTUidCoordinateArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_ASTNodeArrayArchive_ASTUidCoordinateArchive(ProtobufMessage(_b)) }
-            if let _v { astUidCoordinate = _v }
-        case 33:
-            var _v: TSCE_ASTNodeArrayArchive_ASTStickyBits?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_ASTNodeArrayArchive_ASTStickyBits(ProtobufMessage(_b)) }
-            if let _v { astStickyBits = _v }
-        case 41:
-            var _v: TSCE_ASTNodeArrayArchive_ASTStickyBits?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_ASTNodeArrayArchive_ASTStickyBits(ProtobufMessage(_b)) }
-            if let _v { astFrozenStickyBits = _v }
-        case 34:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { astLetIdentifier = _v }
-        case 35:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { astLetWhitespace = _v }
-        case 36:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { astLetIsContinuation = _v }
-        case 37:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { astSymbol = _v }
-        case 38:
-            var _v: TSCE_ASTNodeArrayArchive_ASTUidTractList?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_ASTNodeArrayArchive_ASTUidTractList(ProtobufMessage(_b)) }
-            if let _v { astTractList = _v }
-        case 39:
-            var _v: TSCE_ASTNodeArrayArchive_ASTCategoryReferenceArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_ASTNodeArrayArchive_ASTCategoryReferenceArchive(ProtobufMessage(_b)) }
-            if let _v { astCategoryRef = _v }
-        case 40:
-            var _v: TSCE_ASTNodeArrayArchive_ASTColonTractArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_ASTNodeArrayArchive_ASTColonTractArchive(ProtobufMessage(_b)) }
-            if let _v { astColonTract = _v }
-        case 42:
-            var _v: UInt64?
-            if case .varint(let _u) = _f.value { _v = UInt64(truncatingIfNeeded: _u) }
-            if let _v { astNumberNodeDecimalLow = _v }
-        case 43:
-            var _v: UInt64?
-            if case .varint(let _u) = _f.value { _v = UInt64(truncatingIfNeeded: _u) }
-            if let _v { astNumberNodeDecimalHigh = _v }
-        case 44:
-            var _v: TSCE_ASTNodeArrayArchive_ASTCategoryLevels?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_ASTNodeArrayArchive_ASTCategoryLevels(ProtobufMessage(_b)) }
-            if let _v { astCategoryLevels = _v }
-        case 45:
-            var _v: TSCE_ASTNodeArrayArchive_ASTLambdaIdentsListArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_ASTNodeArrayArchive_ASTLambdaIdentsListArchive(ProtobufMessage(_b)) }
-            if let _v { astLambdaIdents = _v }
-        case 46:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { astRangeContext = _v }
-        case 47:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { upgradeNodeType = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = astNodeType { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = astFunctionNodeIndex { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = astFunctionNodeNumArgs { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = astNumberNodeNumber { _w.fixed64Field(4, _x.bitPattern) }
-        if let _x = astBooleanNodeBoolean { _w.varintField(5, _x ? 1 : 0) }
-        if let _x = astStringNodeString { _w.stringField(6, _x) }
-        if let _x = astDateNodeDateNum { _w.fixed64Field(7, _x.bitPattern) }
-        if let _x = astDateNodeSuppressDateFormat { _w.varintField(19, _x ? 1 : 0) }
-        if let _x = astDateNodeSuppressTimeFormat { _w.varintField(20, _x ? 1 : 0) }
-        if let _x = astDateNodeDateTimeFormat { _w.stringField(21, _x) }
-        if let _x = astDurationNodeUnitNum { _w.fixed64Field(8, _x.bitPattern) }
-        if let _x = astDurationNodeUnit { _w.varintField(9, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = astDurationNodeStyle { _w.varintField(22, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = astDurationNodeDurationUnitLargest { _w.varintField(23, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = astDurationNodeDurationUnitSmallest { _w.varintField(24, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = astDurationNodeUseAutomaticUnits { _w.varintField(29, _x ? 1 : 0) }
-        if let _x = astTokenNodeBoolean { _w.varintField(10, _x ? 1 : 0) }
-        if let _x = astArrayNodeNumCol { _w.varintField(11, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = astArrayNodeNumRow { _w.varintField(12, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = astListNodeNumArgs { _w.varintField(13, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = astThunkNodeArray { _w.bytesField(14, _x.encoded()) }
-        if let _x = astLocalCellReferenceNodeReference { _w.bytesField(15, _x.encoded()) }
-        if let _x = astCrossTableCellReferenceNodeReference { _w.bytesField(16, _x.encoded()) }
-        if let _x = astUnknownFunctionNodeString { _w.stringField(17, _x) }
-        if let _x = astUnknownFunctionNodeNumArgs { _w.varintField(18, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = astWhitespace { _w.stringField(25, _x) }
-        if let _x = astColumn { _w.bytesField(26, _x.encoded()) }
-        if let _x = astRow { _w.bytesField(27, _x.encoded()) }
-        if let _x = astCrossTableReferenceExtraInfo { _w.bytesField(28, _x.encoded()) }
-        if let _x = astUidCoordinate { _w.bytesField(30, _x.encoded()) }
-        if let _x = astStickyBits { _w.bytesField(33, _x.encoded()) }
-        if let _x = astFrozenStickyBits { _w.bytesField(41, _x.encoded()) }
-        if let _x = astLetIdentifier { _w.stringField(34, _x) }
-        if let _x = astLetWhitespace { _w.stringField(35, _x) }
-        if let _x = astLetIsContinuation { _w.varintField(36, _x ? 1 : 0) }
-        if let _x = astSymbol { _w.varintField(37, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = astTractList { _w.bytesField(38, _x.encoded()) }
-        if let _x = astCategoryRef { _w.bytesField(39, _x.encoded()) }
-        if let _x = astColonTract { _w.bytesField(40, _x.encoded()) }
-        if let _x = astNumberNodeDecimalLow { _w.varintField(42, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = astNumberNodeDecimalHigh { _w.varintField(43, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = astCategoryLevels { _w.bytesField(44, _x.encoded()) }
-        if let _x = astLambdaIdents { _w.bytesField(45, _x.encoded()) }
-        if let _x = astRangeContext { _w.varintField(46, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = upgradeNodeType { _w.varintField(47, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.ASTNodeArrayArchive.ASTNodeArchive", [
+        .optional(1, .int32), .optional(2, .uint32), .optional(3, .uint32), .optional(4, .double), .optional(5, .bool),
+        .optional(6, .string), .optional(7, .double), .optional(19, .bool), .optional(20, .bool),
+        .optional(21, .string), .optional(8, .double), .optional(9, .int32), .optional(22, .uint32),
+        .optional(23, .uint32), .optional(24, .uint32), .optional(29, .bool), .optional(10, .bool),
+        .optional(11, .uint32), .optional(12, .uint32), .optional(13, .uint32),
+        .optional(14, TSCE_ASTNodeArrayArchive.self),
+        .optional(15, TSCE_ASTNodeArrayArchive_ASTLocalCellReferenceNodeArchive.self),
+        .optional(16, TSCE_ASTNodeArrayArchive_ASTCrossTableCellReferenceNodeArchive.self), .optional(17, .string),
+        .optional(18, .uint32), .optional(25, .string),
+        .optional(26, TSCE_ASTNodeArrayArchive_ASTColumnCoordinateArchive.self),
+        .optional(27, TSCE_ASTNodeArrayArchive_ASTRowCoordinateArchive.self),
+        .optional(28, TSCE_ASTNodeArrayArchive_ASTCrossTableReferenceExtraInfoArchive.self),
+        .optional(30, TSCE_ASTNodeArrayArchive_ASTUidCoordinateArchive.self),
+        .optional(33, TSCE_ASTNodeArrayArchive_ASTStickyBits.self),
+        .optional(41, TSCE_ASTNodeArrayArchive_ASTStickyBits.self), .optional(34, .string), .optional(35, .string),
+        .optional(36, .bool), .optional(37, .uint32), .optional(38, TSCE_ASTNodeArrayArchive_ASTUidTractList.self),
+        .optional(39, TSCE_ASTNodeArrayArchive_ASTCategoryReferenceArchive.self),
+        .optional(40, TSCE_ASTNodeArrayArchive_ASTColonTractArchive.self), .optional(42, .uint64),
+        .optional(43, .uint64), .optional(44, TSCE_ASTNodeArrayArchive_ASTCategoryLevels.self),
+        .optional(45, TSCE_ASTNodeArrayArchive_ASTLambdaIdentsListArchive.self), .optional(46, .uint32),
+        .optional(47, .int32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 45)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var astNodeType: Int32? { get { self[0] } set { self[0] = newValue } }
+    var astFunctionNodeIndex: UInt32? { get { self[1] } set { self[1] = newValue } }
+    var astFunctionNodeNumArgs: UInt32? { get { self[2] } set { self[2] = newValue } }
+    var astNumberNodeNumber: Double? { get { self[3] } set { self[3] = newValue } }
+    var astBooleanNodeBoolean: Bool? { get { self[4] } set { self[4] = newValue } }
+    var astStringNodeString: String? { get { self[5] } set { self[5] = newValue } }
+    var astDateNodeDateNum: Double? { get { self[6] } set { self[6] = newValue } }
+    var astDateNodeSuppressDateFormat: Bool? { get { self[7] } set { self[7] = newValue } }
+    var astDateNodeSuppressTimeFormat: Bool? { get { self[8] } set { self[8] = newValue } }
+    var astDateNodeDateTimeFormat: String? { get { self[9] } set { self[9] = newValue } }
+    var astDurationNodeUnitNum: Double? { get { self[10] } set { self[10] = newValue } }
+    var astDurationNodeUnit: Int32? { get { self[11] } set { self[11] = newValue } }
+    var astDurationNodeStyle: UInt32? { get { self[12] } set { self[12] = newValue } }
+    var astDurationNodeDurationUnitLargest: UInt32? { get { self[13] } set { self[13] = newValue } }
+    var astDurationNodeDurationUnitSmallest: UInt32? { get { self[14] } set { self[14] = newValue } }
+    var astDurationNodeUseAutomaticUnits: Bool? { get { self[15] } set { self[15] = newValue } }
+    var astTokenNodeBoolean: Bool? { get { self[16] } set { self[16] = newValue } }
+    var astArrayNodeNumCol: UInt32? { get { self[17] } set { self[17] = newValue } }
+    var astArrayNodeNumRow: UInt32? { get { self[18] } set { self[18] = newValue } }
+    var astListNodeNumArgs: UInt32? { get { self[19] } set { self[19] = newValue } }
+    var astThunkNodeArray: TSCE_ASTNodeArrayArchive? { get { self[message: 20] } set { self[message: 20] = newValue } }
+    var astLocalCellReferenceNodeReference: TSCE_ASTNodeArrayArchive_ASTLocalCellReferenceNodeArchive? { get { self[message: 21] } set { self[message: 21] = newValue } }
+    var astCrossTableCellReferenceNodeReference: TSCE_ASTNodeArrayArchive_ASTCrossTableCellReferenceNodeArchive? { get { self[message: 22] } set { self[message: 22] = newValue } }
+    var astUnknownFunctionNodeString: String? { get { self[23] } set { self[23] = newValue } }
+    var astUnknownFunctionNodeNumArgs: UInt32? { get { self[24] } set { self[24] = newValue } }
+    var astWhitespace: String? { get { self[25] } set { self[25] = newValue } }
+    var astColumn: TSCE_ASTNodeArrayArchive_ASTColumnCoordinateArchive? { get { self[message: 26] } set { self[message: 26] = newValue } }
+    var astRow: TSCE_ASTNodeArrayArchive_ASTRowCoordinateArchive? { get { self[message: 27] } set { self[message: 27] = newValue } }
+    var astCrossTableReferenceExtraInfo: TSCE_ASTNodeArrayArchive_ASTCrossTableReferenceExtraInfoArchive? { get { self[message: 28] } set { self[message: 28] = newValue } }
+    var astUidCoordinate: TSCE_ASTNodeArrayArchive_ASTUidCoordinateArchive? { get { self[message: 29] } set { self[message: 29] = newValue } }
+    var astStickyBits: TSCE_ASTNodeArrayArchive_ASTStickyBits? { get { self[message: 30] } set { self[message: 30] = newValue } }
+    var astFrozenStickyBits: TSCE_ASTNodeArrayArchive_ASTStickyBits? { get { self[message: 31] } set { self[message: 31] = newValue } }
+    var astLetIdentifier: String? { get { self[32] } set { self[32] = newValue } }
+    var astLetWhitespace: String? { get { self[33] } set { self[33] = newValue } }
+    var astLetIsContinuation: Bool? { get { self[34] } set { self[34] = newValue } }
+    var astSymbol: UInt32? { get { self[35] } set { self[35] = newValue } }
+    var astTractList: TSCE_ASTNodeArrayArchive_ASTUidTractList? { get { self[message: 36] } set { self[message: 36] = newValue } }
+    var astCategoryRef: TSCE_ASTNodeArrayArchive_ASTCategoryReferenceArchive? { get { self[message: 37] } set { self[message: 37] = newValue } }
+    var astColonTract: TSCE_ASTNodeArrayArchive_ASTColonTractArchive? { get { self[message: 38] } set { self[message: 38] = newValue } }
+    var astNumberNodeDecimalLow: UInt64? { get { self[39] } set { self[39] = newValue } }
+    var astNumberNodeDecimalHigh: UInt64? { get { self[40] } set { self[40] = newValue } }
+    var astCategoryLevels: TSCE_ASTNodeArrayArchive_ASTCategoryLevels? { get { self[message: 41] } set { self[message: 41] = newValue } }
+    var astLambdaIdents: TSCE_ASTNodeArrayArchive_ASTLambdaIdentsListArchive? { get { self[message: 42] } set { self[message: 42] = newValue } }
+    var astRangeContext: UInt32? { get { self[43] } set { self[43] = newValue } }
+    var upgradeNodeType: Int32? { get { self[44] } set { self[44] = newValue } }
 }
 
 /// Generated wire model for `TSCE.FormulaTranslationFlagsArchive`.
 final class TSCE_FormulaTranslationFlagsArchive: IWAMessage {
-    var excelImportTranslation: Bool?
-    var numberToDateCoercionRemovalTranslation: Bool?
-    var containsUidFormReferences: Bool?
-    var containsFrozenReferences: Bool?
-    var returnsPercentFormatted: Bool?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { excelImportTranslation = _v }
-        case 2:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { numberToDateCoercionRemovalTranslation = _v }
-        case 3:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { containsUidFormReferences = _v }
-        case 4:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { containsFrozenReferences = _v }
-        case 5:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { returnsPercentFormatted = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = excelImportTranslation { _w.varintField(1, _x ? 1 : 0) }
-        if let _x = numberToDateCoercionRemovalTranslation { _w.varintField(2, _x ? 1 : 0) }
-        if let _x = containsUidFormReferences { _w.varintField(3, _x ? 1 : 0) }
-        if let _x = containsFrozenReferences { _w.varintField(4, _x ? 1 : 0) }
-        if let _x = returnsPercentFormatted { _w.varintField(5, _x ? 1 : 0) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.FormulaTranslationFlagsArchive", [
+        .optional(1, .bool), .optional(2, .bool), .optional(3, .bool), .optional(4, .bool), .optional(5, .bool),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 5)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var excelImportTranslation: Bool? { get { self[0] } set { self[0] = newValue } }
+    var numberToDateCoercionRemovalTranslation: Bool? { get { self[1] } set { self[1] = newValue } }
+    var containsUidFormReferences: Bool? { get { self[2] } set { self[2] = newValue } }
+    var containsFrozenReferences: Bool? { get { self[3] } set { self[3] = newValue } }
+    var returnsPercentFormatted: Bool? { get { self[4] } set { self[4] = newValue } }
 }
 
 /// Generated wire model for `TSCE.FormulaArchive`.
 final class TSCE_FormulaArchive: IWAMessage {
-    var astNodeArray: TSCE_ASTNodeArrayArchive?
-    var hostColumn: UInt32?
-    var hostRow: UInt32?
-    var hostColumnIsNegative: Bool?
-    var hostRowIsNegative: Bool?
-    var translationFlags: TSCE_FormulaTranslationFlagsArchive?
-    var hostTableUid: TSP_UUID?
-    var hostColumnUid: TSP_UUID?
-    var hostRowUid: TSP_UUID?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSCE_ASTNodeArrayArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_ASTNodeArrayArchive(ProtobufMessage(_b)) }
-            if let _v { astNodeArray = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { hostColumn = _v }
-        case 3:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { hostRow = _v }
-        case 4:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { hostColumnIsNegative = _v }
-        case 5:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { hostRowIsNegative = _v }
-        case 6:
-            var _v: TSCE_FormulaTranslationFlagsArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_FormulaTranslationFlagsArchive(ProtobufMessage(_b)) }
-            if let _v { translationFlags = _v }
-        case 7:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { hostTableUid = _v }
-        case 8:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { hostColumnUid = _v }
-        case 9:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { hostRowUid = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = astNodeArray { _w.bytesField(1, _x.encoded()) }
-        if let _x = hostColumn { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = hostRow { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = hostColumnIsNegative { _w.varintField(4, _x ? 1 : 0) }
-        if let _x = hostRowIsNegative { _w.varintField(5, _x ? 1 : 0) }
-        if let _x = translationFlags { _w.bytesField(6, _x.encoded()) }
-        if let _x = hostTableUid { _w.bytesField(7, _x.encoded()) }
-        if let _x = hostColumnUid { _w.bytesField(8, _x.encoded()) }
-        if let _x = hostRowUid { _w.bytesField(9, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.FormulaArchive", [
+        .optional(1, TSCE_ASTNodeArrayArchive.self), .optional(2, .uint32), .optional(3, .uint32), .optional(4, .bool),
+        .optional(5, .bool), .optional(6, TSCE_FormulaTranslationFlagsArchive.self), .optional(7, TSP_UUID.self),
+        .optional(8, TSP_UUID.self), .optional(9, TSP_UUID.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 9)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var astNodeArray: TSCE_ASTNodeArrayArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var hostColumn: UInt32? { get { self[1] } set { self[1] = newValue } }
+    var hostRow: UInt32? { get { self[2] } set { self[2] = newValue } }
+    var hostColumnIsNegative: Bool? { get { self[3] } set { self[3] = newValue } }
+    var hostRowIsNegative: Bool? { get { self[4] } set { self[4] = newValue } }
+    var translationFlags: TSCE_FormulaTranslationFlagsArchive? { get { self[message: 5] } set { self[message: 5] = newValue } }
+    var hostTableUid: TSP_UUID? { get { self[message: 6] } set { self[message: 6] = newValue } }
+    var hostColumnUid: TSP_UUID? { get { self[message: 7] } set { self[message: 7] = newValue } }
+    var hostRowUid: TSP_UUID? { get { self[message: 8] } set { self[message: 8] = newValue } }
 }
 
 /// Generated wire model for `TSCE.FunctorArchive`.
 final class TSCE_FunctorArchive: IWAMessage {
-    var formula: TSCE_FormulaArchive?
-    var numArgs: UInt32?
-    var firstSymbol: UInt32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSCE_FormulaArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_FormulaArchive(ProtobufMessage(_b)) }
-            if let _v { formula = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { numArgs = _v }
-        case 3:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { firstSymbol = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = formula { _w.bytesField(1, _x.encoded()) }
-        if let _x = numArgs { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = firstSymbol { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.FunctorArchive", [
+        .optional(1, TSCE_FormulaArchive.self), .optional(2, .uint32), .optional(3, .uint32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var formula: TSCE_FormulaArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var numArgs: UInt32? { get { self[1] } set { self[1] = newValue } }
+    var firstSymbol: UInt32? { get { self[2] } set { self[2] = newValue } }
 }
 
 /// Generated wire model for `TSCE.FormatStructArchive`.
 final class TSCE_FormatStructArchive: IWAMessage {
-    var formatType: UInt32?
-    var decimalPlaces: UInt32?
-    var currencyCode: String?
-    var negativeStyle: UInt32?
-    var showThousandsSeparator: Bool?
-    var useAccountingStyle: Bool?
-    var durationStyle: UInt32?
-    var base: UInt32?
-    var basePlaces: UInt32?
-    var baseUseMinusSign: Bool?
-    var fractionAccuracy: UInt32?
-    var suppressDateFormat: Bool?
-    var suppressTimeFormat: Bool?
-    var dateTimeFormat: String?
-    var durationUnitLargest: UInt32?
-    var durationUnitSmallest: UInt32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { formatType = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { decimalPlaces = _v }
-        case 3:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { currencyCode = _v }
-        case 4:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { negativeStyle = _v }
-        case 5:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { showThousandsSeparator = _v }
-        case 6:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { useAccountingStyle = _v }
-        case 7:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { durationStyle = _v }
-        case 8:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { base = _v }
-        case 9:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { basePlaces = _v }
-        case 10:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { baseUseMinusSign = _v }
-        case 11:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { fractionAccuracy = _v }
-        case 12:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { suppressDateFormat = _v }
-        case 13:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { suppressTimeFormat = _v }
-        case 14:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { dateTimeFormat = _v }
-        case 15:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { durationUnitLargest = _v }
-        case 16:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { durationUnitSmallest = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = formatType { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = decimalPlaces { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = currencyCode { _w.stringField(3, _x) }
-        if let _x = negativeStyle { _w.varintField(4, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = showThousandsSeparator { _w.varintField(5, _x ? 1 : 0) }
-        if let _x = useAccountingStyle { _w.varintField(6, _x ? 1 : 0) }
-        if let _x = durationStyle { _w.varintField(7, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = base { _w.varintField(8, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = basePlaces { _w.varintField(9, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = baseUseMinusSign { _w.varintField(10, _x ? 1 : 0) }
-        if let _x = fractionAccuracy { _w.varintField(11, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = suppressDateFormat { _w.varintField(12, _x ? 1 : 0) }
-        if let _x = suppressTimeFormat { _w.varintField(13, _x ? 1 : 0) }
-        if let _x = dateTimeFormat { _w.stringField(14, _x) }
-        if let _x = durationUnitLargest { _w.varintField(15, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = durationUnitSmallest { _w.varintField(16, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.FormatStructArchive", [
+        .optional(1, .uint32), .optional(2, .uint32), .optional(3, .string), .optional(4, .uint32), .optional(5, .bool),
+        .optional(6, .bool), .optional(7, .uint32), .optional(8, .uint32), .optional(9, .uint32), .optional(10, .bool),
+        .optional(11, .uint32), .optional(12, .bool), .optional(13, .bool), .optional(14, .string),
+        .optional(15, .uint32), .optional(16, .uint32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 16)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var formatType: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var decimalPlaces: UInt32? { get { self[1] } set { self[1] = newValue } }
+    var currencyCode: String? { get { self[2] } set { self[2] = newValue } }
+    var negativeStyle: UInt32? { get { self[3] } set { self[3] = newValue } }
+    var showThousandsSeparator: Bool? { get { self[4] } set { self[4] = newValue } }
+    var useAccountingStyle: Bool? { get { self[5] } set { self[5] = newValue } }
+    var durationStyle: UInt32? { get { self[6] } set { self[6] = newValue } }
+    var base: UInt32? { get { self[7] } set { self[7] = newValue } }
+    var basePlaces: UInt32? { get { self[8] } set { self[8] = newValue } }
+    var baseUseMinusSign: Bool? { get { self[9] } set { self[9] = newValue } }
+    var fractionAccuracy: UInt32? { get { self[10] } set { self[10] = newValue } }
+    var suppressDateFormat: Bool? { get { self[11] } set { self[11] = newValue } }
+    var suppressTimeFormat: Bool? { get { self[12] } set { self[12] = newValue } }
+    var dateTimeFormat: String? { get { self[13] } set { self[13] = newValue } }
+    var durationUnitLargest: UInt32? { get { self[14] } set { self[14] = newValue } }
+    var durationUnitSmallest: UInt32? { get { self[15] } set { self[15] = newValue } }
 }
 
 /// Generated wire model for `TSCE.RangeCoordinateArchive`.
 final class TSCE_RangeCoordinateArchive: IWAMessage {
-    var topLeftColumn: UInt32?
-    var topLeftRow: UInt32?
-    var bottomRightColumn: UInt32?
-    var bottomRightRow: UInt32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { topLeftColumn = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { topLeftRow = _v }
-        case 3:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { bottomRightColumn = _v }
-        case 4:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { bottomRightRow = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = topLeftColumn { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = topLeftRow { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = bottomRightColumn { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = bottomRightRow { _w.varintField(4, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.RangeCoordinateArchive", [
+        .optional(1, .uint32), .optional(2, .uint32), .optional(3, .uint32), .optional(4, .uint32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var topLeftColumn: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var topLeftRow: UInt32? { get { self[1] } set { self[1] = newValue } }
+    var bottomRightColumn: UInt32? { get { self[2] } set { self[2] = newValue } }
+    var bottomRightRow: UInt32? { get { self[3] } set { self[3] = newValue } }
 }
 
 /// Generated wire model for `TSCE.TableTransposeInfoArchive`.
 final class TSCE_TableTransposeInfoArchive: IWAMessage {
-    var numberOfFooterRows: UInt32?
-    var bodyRangeForTransposedTable: TSCE_RangeCoordinateArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 3:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { numberOfFooterRows = _v }
-        case 4:
-            var _v: TSCE_RangeCoordinateArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_RangeCoordinateArchive(ProtobufMessage(_b)) }
-            if let _v { bodyRangeForTransposedTable = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = numberOfFooterRows { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = bodyRangeForTransposedTable { _w.bytesField(4, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.TableTransposeInfoArchive", [
+        .optional(3, .uint32), .optional(4, TSCE_RangeCoordinateArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var numberOfFooterRows: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var bodyRangeForTransposedTable: TSCE_RangeCoordinateArchive? { get { self[message: 1] } set { self[message: 1] = newValue } }
 }
 
 /// Generated wire model for `TSCE.MergeOriginMovedArchive`.
 final class TSCE_MergeOriginMovedArchive: IWAMessage {
-    var srcColumn: [UInt32] = []
-    var srcRow: [UInt32] = []
-    var dstColumn: [UInt32] = []
-    var dstRow: [UInt32] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            if case .varint(let _u) = _f.value { srcColumn.append(UInt32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { srcColumn.append(UInt32(truncatingIfNeeded: _u)) } }
-        case 2:
-            if case .varint(let _u) = _f.value { srcRow.append(UInt32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { srcRow.append(UInt32(truncatingIfNeeded: _u)) } }
-        case 3:
-            if case .varint(let _u) = _f.value { dstColumn.append(UInt32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { dstColumn.append(UInt32(truncatingIfNeeded: _u)) } }
-        case 4:
-            if case .varint(let _u) = _f.value { dstRow.append(UInt32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { dstRow.append(UInt32(truncatingIfNeeded: _u)) } }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in srcColumn { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        for _x in srcRow { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        for _x in dstColumn { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        for _x in dstRow { _w.varintField(4, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.MergeOriginMovedArchive", [
+        .repeated(1, .uint32), .repeated(2, .uint32), .repeated(3, .uint32), .repeated(4, .uint32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var srcColumn: [UInt32] { get { self[all: 0] } set { self[all: 0] = newValue } }
+    func append(srcColumn value: UInt32) { append(value, toAll: 0) }
+    var srcRow: [UInt32] { get { self[all: 1] } set { self[all: 1] = newValue } }
+    func append(srcRow value: UInt32) { append(value, toAll: 1) }
+    var dstColumn: [UInt32] { get { self[all: 2] } set { self[all: 2] = newValue } }
+    func append(dstColumn value: UInt32) { append(value, toAll: 2) }
+    var dstRow: [UInt32] { get { self[all: 3] } set { self[all: 3] = newValue } }
+    func append(dstRow value: UInt32) { append(value, toAll: 3) }
 }
 
 /// Generated wire model for `TSCE.OwnerUIDMapperArchive`.
 final class TSCE_OwnerUIDMapperArchive: IWAMessage {
-    var tableUid: TSP_UUID?
-    var nextTableUid: TSP_UUID?
-    var hiddenStateForRowsOwnerUid: TSP_UUID?
-    var nextHiddenStateForRowsOwnerUid: TSP_UUID?
-    var hiddenStateForColumnsOwnerUid: TSP_UUID?
-    var nextHiddenStateForColumnsOwnerUid: TSP_UUID?
-    var conditionalStyleOwnerUid: TSP_UUID?
-    var nextConditionalStyleOwnerUid: TSP_UUID?
-    var sortRuleReferenceTrackerOwnerUid: TSP_UUID?
-    var nextSortRuleReferenceTrackerOwnerUid: TSP_UUID?
-    var mergeOwnerUid: TSP_UUID?
-    var nextMergeOwnerUid: TSP_UUID?
-    var categoryAggregatesOwnerUid: TSP_UUID?
-    var nextCategoryAggregatesOwnerUid: TSP_UUID?
-    var groupByUid: TSP_UUID?
-    var nextGroupByUid: TSP_UUID?
-    var pencilAnnotationOwnerUid: TSP_UUID?
-    var nextPencilAnnotationOwnerUid: TSP_UUID?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { tableUid = _v }
-        case 2:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { nextTableUid = _v }
-        case 3:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { hiddenStateForRowsOwnerUid = _v }
-        case 4:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { nextHiddenStateForRowsOwnerUid = _v }
-        case 5:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { hiddenStateForColumnsOwnerUid = _v }
-        case 6:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { nextHiddenStateForColumnsOwnerUid = _v }
-        case 7:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { conditionalStyleOwnerUid = _v }
-        case 8:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { nextConditionalStyleOwnerUid = _v }
-        case 9:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { sortRuleReferenceTrackerOwnerUid = _v }
-        case 10:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { nextSortRuleReferenceTrackerOwnerUid = _v }
-        case 11:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { mergeOwnerUid = _v }
-        case 12:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { nextMergeOwnerUid = _v }
-        case 15:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { categoryAggregatesOwnerUid = _v }
-        case 16:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { nextCategoryAggregatesOwnerUid = _v }
-        case 17:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { groupByUid = _v }
-        case 18:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { nextGroupByUid = _v }
-        case 19:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { pencilAnnotationOwnerUid = _v }
-        case 20:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { nextPencilAnnotationOwnerUid = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = tableUid { _w.bytesField(1, _x.encoded()) }
-        if let _x = nextTableUid { _w.bytesField(2, _x.encoded()) }
-        if let _x = hiddenStateForRowsOwnerUid { _w.bytesField(3, _x.encoded()) }
-        if let _x = nextHiddenStateForRowsOwnerUid { _w.bytesField(4, _x.encoded()) }
-        if let _x = hiddenStateForColumnsOwnerUid { _w.bytesField(5, _x.encoded()) }
-        if let _x = nextHiddenStateForColumnsOwnerUid { _w.bytesField(6, _x.encoded()) }
-        if let _x = conditionalStyleOwnerUid { _w.bytesField(7, _x.encoded()) }
-        if let _x = nextConditionalStyleOwnerUid { _w.bytesField(8, _x.encoded()) }
-        if let _x = sortRuleReferenceTrackerOwnerUid { _w.bytesField(9, _x.encoded()) }
-        if let _x = nextSortRuleReferenceTrackerOwnerUid { _w.bytesField(10, _x.encoded()) }
-        if let _x = mergeOwnerUid { _w.bytesField(11, _x.encoded()) }
-        if let _x = nextMergeOwnerUid { _w.bytesField(12, _x.encoded()) }
-        if let _x = categoryAggregatesOwnerUid { _w.bytesField(15, _x.encoded()) }
-        if let _x = nextCategoryAggregatesOwnerUid { _w.bytesField(16, _x.encoded()) }
-        if let _x = groupByUid { _w.bytesField(17, _x.encoded()) }
-        if let _x = nextGroupByUid { _w.bytesField(18, _x.encoded()) }
-        if let _x = pencilAnnotationOwnerUid { _w.bytesField(19, _x.encoded()) }
-        if let _x = nextPencilAnnotationOwnerUid { _w.bytesField(20, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.OwnerUIDMapperArchive", [
+        .optional(1, TSP_UUID.self), .optional(2, TSP_UUID.self), .optional(3, TSP_UUID.self),
+        .optional(4, TSP_UUID.self), .optional(5, TSP_UUID.self), .optional(6, TSP_UUID.self),
+        .optional(7, TSP_UUID.self), .optional(8, TSP_UUID.self), .optional(9, TSP_UUID.self),
+        .optional(10, TSP_UUID.self), .optional(11, TSP_UUID.self), .optional(12, TSP_UUID.self),
+        .optional(15, TSP_UUID.self), .optional(16, TSP_UUID.self), .optional(17, TSP_UUID.self),
+        .optional(18, TSP_UUID.self), .optional(19, TSP_UUID.self), .optional(20, TSP_UUID.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 18)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var tableUid: TSP_UUID? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var nextTableUid: TSP_UUID? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var hiddenStateForRowsOwnerUid: TSP_UUID? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var nextHiddenStateForRowsOwnerUid: TSP_UUID? { get { self[message: 3] } set { self[message: 3] = newValue } }
+    var hiddenStateForColumnsOwnerUid: TSP_UUID? { get { self[message: 4] } set { self[message: 4] = newValue } }
+    var nextHiddenStateForColumnsOwnerUid: TSP_UUID? { get { self[message: 5] } set { self[message: 5] = newValue } }
+    var conditionalStyleOwnerUid: TSP_UUID? { get { self[message: 6] } set { self[message: 6] = newValue } }
+    var nextConditionalStyleOwnerUid: TSP_UUID? { get { self[message: 7] } set { self[message: 7] = newValue } }
+    var sortRuleReferenceTrackerOwnerUid: TSP_UUID? { get { self[message: 8] } set { self[message: 8] = newValue } }
+    var nextSortRuleReferenceTrackerOwnerUid: TSP_UUID? { get { self[message: 9] } set { self[message: 9] = newValue } }
+    var mergeOwnerUid: TSP_UUID? { get { self[message: 10] } set { self[message: 10] = newValue } }
+    var nextMergeOwnerUid: TSP_UUID? { get { self[message: 11] } set { self[message: 11] = newValue } }
+    var categoryAggregatesOwnerUid: TSP_UUID? { get { self[message: 12] } set { self[message: 12] = newValue } }
+    var nextCategoryAggregatesOwnerUid: TSP_UUID? { get { self[message: 13] } set { self[message: 13] = newValue } }
+    var groupByUid: TSP_UUID? { get { self[message: 14] } set { self[message: 14] = newValue } }
+    var nextGroupByUid: TSP_UUID? { get { self[message: 15] } set { self[message: 15] = newValue } }
+    var pencilAnnotationOwnerUid: TSP_UUID? { get { self[message: 16] } set { self[message: 16] = newValue } }
+    var nextPencilAnnotationOwnerUid: TSP_UUID? { get { self[message: 17] } set { self[message: 17] = newValue } }
 }
 
 /// Generated wire model for `TSCE.RewriteTableUIDInfoArchive`.
 final class TSCE_RewriteTableUIDInfoArchive: IWAMessage {
-    var tableUidMap: [TSCE_RewriteTableUIDInfoArchive_TableUIDMapEntryArchive] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSCE_RewriteTableUIDInfoArchive_TableUIDMapEntryArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_RewriteTableUIDInfoArchive_TableUIDMapEntryArchive(ProtobufMessage(_b)) }
-            if let _v { tableUidMap.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in tableUidMap { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.RewriteTableUIDInfoArchive", [
+        .repeated(1, TSCE_RewriteTableUIDInfoArchive_TableUIDMapEntryArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var tableUidMap: [TSCE_RewriteTableUIDInfoArchive_TableUIDMapEntryArchive] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(tableUidMap value: TSCE_RewriteTableUIDInfoArchive_TableUIDMapEntryArchive) { append(value, toMessages: 0) }
 }
 
 /// Generated wire model for `TSCE.RewriteTableUIDInfoArchive.TableUIDMapEntryArchive`.
 final class TSCE_RewriteTableUIDInfoArchive_TableUIDMapEntryArchive: IWAMessage {
-    var prevTableUid: TSP_UUID?
-    var newTableUid: TSP_UUID?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { prevTableUid = _v }
-        case 2:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { newTableUid = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = prevTableUid { _w.bytesField(1, _x.encoded()) }
-        if let _x = newTableUid { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.RewriteTableUIDInfoArchive.TableUIDMapEntryArchive", [
+        .optional(1, TSP_UUID.self), .optional(2, TSP_UUID.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var prevTableUid: TSP_UUID? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var newTableUid: TSP_UUID? { get { self[message: 1] } set { self[message: 1] = newValue } }
 }
 
 /// Generated wire model for `TSCE.GroupByChangeArchive`.
 final class TSCE_GroupByChangeArchive: IWAMessage {
-    var changeType: Int32?
-    var groupByUid: TSP_UUID?
-    var previousLevel: UInt32?
-    var updatedLevel: UInt32?
-    var previousToUpdatedMap: TSP_UUIDMapArchive?
-    var updatedToPreviousMap: TSP_UUIDMapArchive?
-    var removedGroupUids: [TSP_UUID] = []
-    var groupingColumnChanges: [TSCE_GroupByChangeArchive_GroupingColumnChangeArchive] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { changeType = _v }
-        case 2:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { groupByUid = _v }
-        case 3:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { previousLevel = _v }
-        case 4:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { updatedLevel = _v }
-        case 5:
-            var _v: TSP_UUIDMapArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUIDMapArchive(ProtobufMessage(_b)) }
-            if let _v { previousToUpdatedMap = _v }
-        case 6:
-            var _v: TSP_UUIDMapArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUIDMapArchive(ProtobufMessage(_b)) }
-            if let _v { updatedToPreviousMap = _v }
-        case 7:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { removedGroupUids.append(_v) }
-        case 8:
-            var _v: TSCE_GroupByChangeArchive_GroupingColumnChangeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_GroupByChangeArchive_GroupingColumnChangeArchive(ProtobufMessage(_b)) }
-            if let _v { groupingColumnChanges.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = changeType { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = groupByUid { _w.bytesField(2, _x.encoded()) }
-        if let _x = previousLevel { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = updatedLevel { _w.varintField(4, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = previousToUpdatedMap { _w.bytesField(5, _x.encoded()) }
-        if let _x = updatedToPreviousMap { _w.bytesField(6, _x.encoded()) }
-        for _x in removedGroupUids { _w.bytesField(7, _x.encoded()) }
-        for _x in groupingColumnChanges { _w.bytesField(8, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.GroupByChangeArchive", [
+        .optional(1, .int32), .optional(2, TSP_UUID.self), .optional(3, .uint32), .optional(4, .uint32),
+        .optional(5, TSP_UUIDMapArchive.self), .optional(6, TSP_UUIDMapArchive.self), .repeated(7, TSP_UUID.self),
+        .repeated(8, TSCE_GroupByChangeArchive_GroupingColumnChangeArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 8)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var changeType: Int32? { get { self[0] } set { self[0] = newValue } }
+    var groupByUid: TSP_UUID? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var previousLevel: UInt32? { get { self[2] } set { self[2] = newValue } }
+    var updatedLevel: UInt32? { get { self[3] } set { self[3] = newValue } }
+    var previousToUpdatedMap: TSP_UUIDMapArchive? { get { self[message: 4] } set { self[message: 4] = newValue } }
+    var updatedToPreviousMap: TSP_UUIDMapArchive? { get { self[message: 5] } set { self[message: 5] = newValue } }
+    var removedGroupUids: [TSP_UUID] { get { self[messages: 6] } set { self[messages: 6] = newValue } }
+    func append(removedGroupUids value: TSP_UUID) { append(value, toMessages: 6) }
+    var groupingColumnChanges: [TSCE_GroupByChangeArchive_GroupingColumnChangeArchive] { get { self[messages: 7] } set { self[messages: 7] = newValue } }
+    func append(groupingColumnChanges value: TSCE_GroupByChangeArchive_GroupingColumnChangeArchive) { append(value, toMessages: 7) }
 }
 
 /// Generated wire model for `TSCE.GroupByChangeArchive.GroupingColumnChangeArchive`.
 final class TSCE_GroupByChangeArchive_GroupingColumnChangeArchive: IWAMessage {
-    var oldLevel: UInt32?
-    var newLevel: UInt32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { oldLevel = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { newLevel = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = oldLevel { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = newLevel { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.GroupByChangeArchive.GroupingColumnChangeArchive", [
+        .optional(1, .uint32), .optional(2, .uint32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var oldLevel: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var newLevel: UInt32? { get { self[1] } set { self[1] = newValue } }
 }
 
 /// Generated wire model for `TSCE.RewriteGroupNodeUIDInfoArchive`.
 final class TSCE_RewriteGroupNodeUIDInfoArchive: IWAMessage {
-    var groupByUid: TSP_UUID?
-    var groupNodeUidMap: TSP_UUIDMapArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { groupByUid = _v }
-        case 2:
-            var _v: TSP_UUIDMapArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUIDMapArchive(ProtobufMessage(_b)) }
-            if let _v { groupNodeUidMap = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = groupByUid { _w.bytesField(1, _x.encoded()) }
-        if let _x = groupNodeUidMap { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.RewriteGroupNodeUIDInfoArchive", [
+        .optional(1, TSP_UUID.self), .optional(2, TSP_UUIDMapArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var groupByUid: TSP_UUID? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var groupNodeUidMap: TSP_UUIDMapArchive? { get { self[message: 1] } set { self[message: 1] = newValue } }
 }
 
 /// Generated wire model for `TSCE.IndexedUidsArchive`.
 final class TSCE_IndexedUidsArchive: IWAMessage {
-    var uids: [TSCE_IndexedUidsArchive_IndexedUid] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSCE_IndexedUidsArchive_IndexedUid?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_IndexedUidsArchive_IndexedUid(ProtobufMessage(_b)) }
-            if let _v { uids.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in uids { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.IndexedUidsArchive", [
+        .repeated(1, TSCE_IndexedUidsArchive_IndexedUid.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var uids: [TSCE_IndexedUidsArchive_IndexedUid] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(uids value: TSCE_IndexedUidsArchive_IndexedUid) { append(value, toMessages: 0) }
 }
 
 /// Generated wire model for `TSCE.IndexedUidsArchive.IndexedUid`.
 final class TSCE_IndexedUidsArchive_IndexedUid: IWAMessage {
-    var uidForIndex: TSP_UUID?
-    var indexForUid: UInt32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { uidForIndex = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { indexForUid = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = uidForIndex { _w.bytesField(1, _x.encoded()) }
-        if let _x = indexForUid { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.IndexedUidsArchive.IndexedUid", [
+        .optional(1, TSP_UUID.self), .optional(2, .uint32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var uidForIndex: TSP_UUID? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var indexForUid: UInt32? { get { self[1] } set { self[1] = newValue } }
 }
 
 /// Generated wire model for `TSCE.RewriteRangeEntryArchive`.
 final class TSCE_RewriteRangeEntryArchive: IWAMessage {
-    var rangeLocation: UInt32?
-    var rangeLength: UInt32?
-    var rangeUids: [TSP_UUID] = []
-    var offset: UInt32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { rangeLocation = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { rangeLength = _v }
-        case 3:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { rangeUids.append(_v) }
-        case 4:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { offset = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = rangeLocation { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = rangeLength { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        for _x in rangeUids { _w.bytesField(3, _x.encoded()) }
-        if let _x = offset { _w.varintField(4, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.RewriteRangeEntryArchive", [
+        .optional(1, .uint32), .optional(2, .uint32), .repeated(3, TSP_UUID.self), .optional(4, .uint32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var rangeLocation: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var rangeLength: UInt32? { get { self[1] } set { self[1] = newValue } }
+    var rangeUids: [TSP_UUID] { get { self[messages: 2] } set { self[messages: 2] = newValue } }
+    func append(rangeUids value: TSP_UUID) { append(value, toMessages: 2) }
+    var offset: UInt32? { get { self[3] } set { self[3] = newValue } }
 }
 
 /// Generated wire model for `TSCE.ColumnOrRowUuidsInfoArchive`.
 final class TSCE_ColumnOrRowUuidsInfoArchive: IWAMessage {
-    var isRows: Bool?
-    var tableUid: TSP_UUID?
-    var condStyleOwnerUid: TSP_UUID?
-    var groupByUid: TSP_UUID?
-    var uids: TSCE_IndexedUidsArchive?
-    var rangeEntries: [TSCE_RewriteRangeEntryArchive] = []
-    var tableRange: TSCE_RangeCoordinateArchive?
-    var insertAtUid: TSP_UUID?
-    var insertOppositeUid: TSP_UUID?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { isRows = _v }
-        case 2:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { tableUid = _v }
-        case 3:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { condStyleOwnerUid = _v }
-        case 4:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { groupByUid = _v }
-        case 5:
-            var _v: TSCE_IndexedUidsArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_IndexedUidsArchive(ProtobufMessage(_b)) }
-            if let _v { uids = _v }
-        case 6:
-            var _v: TSCE_RewriteRangeEntryArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_RewriteRangeEntryArchive(ProtobufMessage(_b)) }
-            if let _v { rangeEntries.append(_v) }
-        case 7:
-            var _v: TSCE_RangeCoordinateArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_RangeCoordinateArchive(ProtobufMessage(_b)) }
-            if let _v { tableRange = _v }
-        case 8:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { insertAtUid = _v }
-        case 9:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { insertOppositeUid = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = isRows { _w.varintField(1, _x ? 1 : 0) }
-        if let _x = tableUid { _w.bytesField(2, _x.encoded()) }
-        if let _x = condStyleOwnerUid { _w.bytesField(3, _x.encoded()) }
-        if let _x = groupByUid { _w.bytesField(4, _x.encoded()) }
-        if let _x = uids { _w.bytesField(5, _x.encoded()) }
-        for _x in rangeEntries { _w.bytesField(6, _x.encoded()) }
-        if let _x = tableRange { _w.bytesField(7, _x.encoded()) }
-        if let _x = insertAtUid { _w.bytesField(8, _x.encoded()) }
-        if let _x = insertOppositeUid { _w.bytesField(9, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.ColumnOrRowUuidsInfoArchive", [
+        .optional(1, .bool), .optional(2, TSP_UUID.self), .optional(3, TSP_UUID.self), .optional(4, TSP_UUID.self),
+        .optional(5, TSCE_IndexedUidsArchive.self), .repeated(6, TSCE_RewriteRangeEntryArchive.self),
+        .optional(7, TSCE_RangeCoordinateArchive.self), .optional(8, TSP_UUID.self), .optional(9, TSP_UUID.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 9)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var isRows: Bool? { get { self[0] } set { self[0] = newValue } }
+    var tableUid: TSP_UUID? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var condStyleOwnerUid: TSP_UUID? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var groupByUid: TSP_UUID? { get { self[message: 3] } set { self[message: 3] = newValue } }
+    var uids: TSCE_IndexedUidsArchive? { get { self[message: 4] } set { self[message: 4] = newValue } }
+    var rangeEntries: [TSCE_RewriteRangeEntryArchive] { get { self[messages: 5] } set { self[messages: 5] = newValue } }
+    func append(rangeEntries value: TSCE_RewriteRangeEntryArchive) { append(value, toMessages: 5) }
+    var tableRange: TSCE_RangeCoordinateArchive? { get { self[message: 6] } set { self[message: 6] = newValue } }
+    var insertAtUid: TSP_UUID? { get { self[message: 7] } set { self[message: 7] = newValue } }
+    var insertOppositeUid: TSP_UUID? { get { self[message: 8] } set { self[message: 8] = newValue } }
 }
 
 /// Generated wire model for `TSCE.RegionInfoArchive`.
 final class TSCE_RegionInfoArchive: IWAMessage {
-    var tableUid: TSP_UUID?
-    var columnUids: TSCE_IndexedUidsArchive?
-    var rowUids: TSCE_IndexedUidsArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { tableUid = _v }
-        case 2:
-            var _v: TSCE_IndexedUidsArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_IndexedUidsArchive(ProtobufMessage(_b)) }
-            if let _v { columnUids = _v }
-        case 3:
-            var _v: TSCE_IndexedUidsArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_IndexedUidsArchive(ProtobufMessage(_b)) }
-            if let _v { rowUids = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = tableUid { _w.bytesField(1, _x.encoded()) }
-        if let _x = columnUids { _w.bytesField(2, _x.encoded()) }
-        if let _x = rowUids { _w.bytesField(3, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.RegionInfoArchive", [
+        .optional(1, TSP_UUID.self), .optional(2, TSCE_IndexedUidsArchive.self),
+        .optional(3, TSCE_IndexedUidsArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var tableUid: TSP_UUID? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var columnUids: TSCE_IndexedUidsArchive? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var rowUids: TSCE_IndexedUidsArchive? { get { self[message: 2] } set { self[message: 2] = newValue } }
 }
 
 /// Generated wire model for `TSCE.RegionMovedInfoArchive`.
 final class TSCE_RegionMovedInfoArchive: IWAMessage {
-    var srcRegion: TSCE_RegionInfoArchive?
-    var dstRegion: TSCE_RegionInfoArchive?
-    var spanRows: Bool?
-    var spanColumns: Bool?
-    var originalSrcRegion: TSCE_RegionInfoArchive?
-    var finalDestTableUid: TSP_UUID?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSCE_RegionInfoArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_RegionInfoArchive(ProtobufMessage(_b)) }
-            if let _v { srcRegion = _v }
-        case 2:
-            var _v: TSCE_RegionInfoArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_RegionInfoArchive(ProtobufMessage(_b)) }
-            if let _v { dstRegion = _v }
-        case 3:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { spanRows = _v }
-        case 4:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { spanColumns = _v }
-        case 5:
-            var _v: TSCE_RegionInfoArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_RegionInfoArchive(ProtobufMessage(_b)) }
-            if let _v { originalSrcRegion = _v }
-        case 6:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { finalDestTableUid = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = srcRegion { _w.bytesField(1, _x.encoded()) }
-        if let _x = dstRegion { _w.bytesField(2, _x.encoded()) }
-        if let _x = spanRows { _w.varintField(3, _x ? 1 : 0) }
-        if let _x = spanColumns { _w.varintField(4, _x ? 1 : 0) }
-        if let _x = originalSrcRegion { _w.bytesField(5, _x.encoded()) }
-        if let _x = finalDestTableUid { _w.bytesField(6, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.RegionMovedInfoArchive", [
+        .optional(1, TSCE_RegionInfoArchive.self), .optional(2, TSCE_RegionInfoArchive.self), .optional(3, .bool),
+        .optional(4, .bool), .optional(5, TSCE_RegionInfoArchive.self), .optional(6, TSP_UUID.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 6)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var srcRegion: TSCE_RegionInfoArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var dstRegion: TSCE_RegionInfoArchive? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var spanRows: Bool? { get { self[2] } set { self[2] = newValue } }
+    var spanColumns: Bool? { get { self[3] } set { self[3] = newValue } }
+    var originalSrcRegion: TSCE_RegionInfoArchive? { get { self[message: 4] } set { self[message: 4] = newValue } }
+    var finalDestTableUid: TSP_UUID? { get { self[message: 5] } set { self[message: 5] = newValue } }
 }
 
 /// Generated wire model for `TSCE.MergeSourceArchive`.
 final class TSCE_MergeSourceArchive: IWAMessage {
-    var coordColumn: UInt32?
-    var coordRow: UInt32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { coordColumn = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { coordRow = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = coordColumn { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = coordRow { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.MergeSourceArchive", [
+        .optional(1, .uint32), .optional(2, .uint32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var coordColumn: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var coordRow: UInt32? { get { self[1] } set { self[1] = newValue } }
 }
 
 /// Generated wire model for `TSCE.HauntedOwnerArchive`.
 final class TSCE_HauntedOwnerArchive: IWAMessage {
-    var ownerUid: TSP_UUID?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { ownerUid = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = ownerUid { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.HauntedOwnerArchive", [
+        .optional(1, TSP_UUID.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var ownerUid: TSP_UUID? { get { self[message: 0] } set { self[message: 0] = newValue } }
 }
 
 /// Generated wire model for `TSCE.SpillOwnerArchive`.
 final class TSCE_SpillOwnerArchive: IWAMessage {
-    var ownerUid: TSP_UUID?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { ownerUid = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = ownerUid { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.SpillOwnerArchive", [
+        .optional(1, TSP_UUID.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var ownerUid: TSP_UUID? { get { self[message: 0] } set { self[message: 0] = newValue } }
 }
 
 /// Generated wire model for `TSCE.CellCoordinateArchive`.
 final class TSCE_CellCoordinateArchive: IWAMessage {
-    var packeddata: UInt32?
-    var column: UInt32?
-    var row: UInt32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .fixed32(let _b) = _f.value { _v = IWAWire.u32(_b) }
-            if let _v { packeddata = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { column = _v }
-        case 3:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { row = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = packeddata { _w.fixed32Field(1, _x) }
-        if let _x = column { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = row { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.CellCoordinateArchive", [
+        .optional(1, .fixed32), .optional(2, .uint32), .optional(3, .uint32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var packeddata: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var column: UInt32? { get { self[1] } set { self[1] = newValue } }
+    var row: UInt32? { get { self[2] } set { self[2] = newValue } }
 }
 
 /// Generated wire model for `TSCE.CellCoordinateVectorArchive`.
 final class TSCE_CellCoordinateVectorArchive: IWAMessage {
-    var cellCoord: [TSCE_CellCoordinateArchive] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSCE_CellCoordinateArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CellCoordinateArchive(ProtobufMessage(_b)) }
-            if let _v { cellCoord.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in cellCoord { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.CellCoordinateVectorArchive", [
+        .repeated(1, TSCE_CellCoordinateArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var cellCoord: [TSCE_CellCoordinateArchive] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(cellCoord value: TSCE_CellCoordinateArchive) { append(value, toMessages: 0) }
 }
 
 /// Generated wire model for `TSCE.ExpandedCellRefObjectPairArchive`.
 final class TSCE_ExpandedCellRefObjectPairArchive: IWAMessage {
-    var cellRef: TSCE_CellReferenceArchive?
-    var object: TSP_Reference?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSCE_CellReferenceArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CellReferenceArchive(ProtobufMessage(_b)) }
-            if let _v { cellRef = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { object = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = cellRef { _w.bytesField(1, _x.encoded()) }
-        if let _x = object { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.ExpandedCellRefObjectPairArchive", [
+        .optional(1, TSCE_CellReferenceArchive.self), .optional(2, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var cellRef: TSCE_CellReferenceArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var object: TSP_Reference? { get { self[message: 1] } set { self[message: 1] = newValue } }
 }
 
 /// Generated wire model for `TSCE.ExpandedCellRefObjectMapArchive`.
 final class TSCE_ExpandedCellRefObjectMapArchive: IWAMessage {
-    var cellRefObjectPair: [TSCE_ExpandedCellRefObjectPairArchive] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSCE_ExpandedCellRefObjectPairArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_ExpandedCellRefObjectPairArchive(ProtobufMessage(_b)) }
-            if let _v { cellRefObjectPair.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in cellRefObjectPair { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.ExpandedCellRefObjectMapArchive", [
+        .repeated(1, TSCE_ExpandedCellRefObjectPairArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var cellRefObjectPair: [TSCE_ExpandedCellRefObjectPairArchive] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(cellRefObjectPair value: TSCE_ExpandedCellRefObjectPairArchive) { append(value, toMessages: 0) }
 }
 
 /// Generated wire model for `TSCE.FormulaAtCoordArchive`.
 final class TSCE_FormulaAtCoordArchive: IWAMessage {
-    var column: UInt32?
-    var row: UInt32?
-    var formula: TSCE_FormulaArchive?
-    var repeatPreviousFormula: Bool?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { column = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { row = _v }
-        case 3:
-            var _v: TSCE_FormulaArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_FormulaArchive(ProtobufMessage(_b)) }
-            if let _v { formula = _v }
-        case 4:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { repeatPreviousFormula = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = column { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = row { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = formula { _w.bytesField(3, _x.encoded()) }
-        if let _x = repeatPreviousFormula { _w.varintField(4, _x ? 1 : 0) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.FormulaAtCoordArchive", [
+        .optional(1, .uint32), .optional(2, .uint32), .optional(3, TSCE_FormulaArchive.self), .optional(4, .bool),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var column: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var row: UInt32? { get { self[1] } set { self[1] = newValue } }
+    var formula: TSCE_FormulaArchive? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var repeatPreviousFormula: Bool? { get { self[3] } set { self[3] = newValue } }
 }
 
 /// Generated wire model for `TSCE.FormulaCoordPairsByOwnerArchive`.
 final class TSCE_FormulaCoordPairsByOwnerArchive: IWAMessage {
-    var ownerKind: UInt32?
-    var ownerUid: TSP_UUID?
-    var formulaAtCoords: [TSCE_FormulaAtCoordArchive] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { ownerKind = _v }
-        case 2:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { ownerUid = _v }
-        case 3:
-            var _v: TSCE_FormulaAtCoordArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_FormulaAtCoordArchive(ProtobufMessage(_b)) }
-            if let _v { formulaAtCoords.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = ownerKind { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = ownerUid { _w.bytesField(2, _x.encoded()) }
-        for _x in formulaAtCoords { _w.bytesField(3, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.FormulaCoordPairsByOwnerArchive", [
+        .optional(1, .uint32), .optional(2, TSP_UUID.self), .repeated(3, TSCE_FormulaAtCoordArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var ownerKind: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var ownerUid: TSP_UUID? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var formulaAtCoords: [TSCE_FormulaAtCoordArchive] { get { self[messages: 2] } set { self[messages: 2] = newValue } }
+    func append(formulaAtCoords value: TSCE_FormulaAtCoordArchive) { append(value, toMessages: 2) }
 }
 
 /// Generated wire model for `TSCE.FormulasForUndoArchive`.
 final class TSCE_FormulasForUndoArchive: IWAMessage {
-    var formulasForOwner: [TSCE_FormulaCoordPairsByOwnerArchive] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSCE_FormulaCoordPairsByOwnerArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_FormulaCoordPairsByOwnerArchive(ProtobufMessage(_b)) }
-            if let _v { formulasForOwner.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in formulasForOwner { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.FormulasForUndoArchive", [
+        .repeated(1, TSCE_FormulaCoordPairsByOwnerArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var formulasForOwner: [TSCE_FormulaCoordPairsByOwnerArchive] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(formulasForOwner value: TSCE_FormulaCoordPairsByOwnerArchive) { append(value, toMessages: 0) }
 }
 
 /// Generated wire model for `TSCE.FormulaRewriteCommandArchive`.
 final class TSCE_FormulaRewriteCommandArchive: IWAMessage {
-    var tableRewriteCommand: TSP_Reference?
-    var `super`: TSK_CommandArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { tableRewriteCommand = _v }
-        case 2:
-            var _v: TSK_CommandArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_CommandArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = tableRewriteCommand { _w.bytesField(1, _x.encoded()) }
-        if let _x = `super` { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.FormulaRewriteCommandArchive", [
+        .optional(1, TSP_Reference.self), .optional(2, TSK_CommandArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var tableRewriteCommand: TSP_Reference? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var `super`: TSK_CommandArchive? { get { self[message: 1] } set { self[message: 1] = newValue } }
 }
 
 /// Generated wire model for `TSCE.TrackedReferenceArchive`.
 final class TSCE_TrackedReferenceArchive: IWAMessage {
-    var ast: TSCE_ASTNodeArrayArchive?
-    var formulaId: UInt32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSCE_ASTNodeArrayArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_ASTNodeArrayArchive(ProtobufMessage(_b)) }
-            if let _v { ast = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { formulaId = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = ast { _w.bytesField(1, _x.encoded()) }
-        if let _x = formulaId { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.TrackedReferenceArchive", [
+        .optional(1, TSCE_ASTNodeArrayArchive.self), .optional(2, .uint32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var ast: TSCE_ASTNodeArrayArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var formulaId: UInt32? { get { self[1] } set { self[1] = newValue } }
 }
 
 /// Generated wire model for `TSCE.ExpandedTrackedReferenceArchive`.
 final class TSCE_ExpandedTrackedReferenceArchive: IWAMessage {
-    var ast: TSCE_ASTNodeArrayArchive?
-    var formulaColumn: UInt32?
-    var formulaRow: UInt32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSCE_ASTNodeArrayArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_ASTNodeArrayArchive(ProtobufMessage(_b)) }
-            if let _v { ast = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { formulaColumn = _v }
-        case 3:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { formulaRow = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = ast { _w.bytesField(1, _x.encoded()) }
-        if let _x = formulaColumn { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = formulaRow { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.ExpandedTrackedReferenceArchive", [
+        .optional(1, TSCE_ASTNodeArrayArchive.self), .optional(2, .uint32), .optional(3, .uint32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var ast: TSCE_ASTNodeArrayArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var formulaColumn: UInt32? { get { self[1] } set { self[1] = newValue } }
+    var formulaRow: UInt32? { get { self[2] } set { self[2] = newValue } }
 }
 
 /// Generated wire model for `TSCE.TrackedReferenceStoreArchive`.
 final class TSCE_TrackedReferenceStoreArchive: IWAMessage {
-    var uuid: TSP_CFUUIDArchive?
-    var trackedReference: [TSP_Reference] = []
-    var containedTrackedReference: [TSCE_TrackedReferenceArchive] = []
-    var containedExpandedTrackedReference: [TSCE_ExpandedTrackedReferenceArchive] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_CFUUIDArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_CFUUIDArchive(ProtobufMessage(_b)) }
-            if let _v { uuid = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { trackedReference.append(_v) }
-        case 3:
-            var _v: TSCE_TrackedReferenceArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_TrackedReferenceArchive(ProtobufMessage(_b)) }
-            if let _v { containedTrackedReference.append(_v) }
-        case 4:
-            var _v: TSCE_ExpandedTrackedReferenceArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_ExpandedTrackedReferenceArchive(ProtobufMessage(_b)) }
-            if let _v { containedExpandedTrackedReference.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = uuid { _w.bytesField(1, _x.encoded()) }
-        for _x in trackedReference { _w.bytesField(2, _x.encoded()) }
-        for _x in containedTrackedReference { _w.bytesField(3, _x.encoded()) }
-        for _x in containedExpandedTrackedReference { _w.bytesField(4, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.TrackedReferenceStoreArchive", [
+        .optional(1, TSP_CFUUIDArchive.self), .repeated(2, TSP_Reference.self),
+        .repeated(3, TSCE_TrackedReferenceArchive.self), .repeated(4, TSCE_ExpandedTrackedReferenceArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var uuid: TSP_CFUUIDArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var trackedReference: [TSP_Reference] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(trackedReference value: TSP_Reference) { append(value, toMessages: 1) }
+    var containedTrackedReference: [TSCE_TrackedReferenceArchive] { get { self[messages: 2] } set { self[messages: 2] = newValue } }
+    func append(containedTrackedReference value: TSCE_TrackedReferenceArchive) { append(value, toMessages: 2) }
+    var containedExpandedTrackedReference: [TSCE_ExpandedTrackedReferenceArchive] { get { self[messages: 3] } set { self[messages: 3] = newValue } }
+    func append(containedExpandedTrackedReference value: TSCE_ExpandedTrackedReferenceArchive) { append(value, toMessages: 3) }
 }
 
 /// Generated wire model for `TSCE.ViewTractRefArchive`.
 final class TSCE_ViewTractRefArchive: IWAMessage {
-    var tableUid: TSP_UUID?
-    var uidTract: TSCE_ASTNodeArrayArchive_ASTUidTract?
-    var preserveFlags: TSCE_PreserveColumnRowFlagsArchive?
-    var aggIndexLevel: UInt32?
-    var columnGroupLevel: Int32?
-    var rowGroupLevel: Int32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { tableUid = _v }
-        case 2:
-            var _v: TSCE_ASTNodeArrayArchive_ASTUidTract?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_ASTNodeArrayArchive_ASTUidTract(ProtobufMessage(_b)) }
-            if let _v { uidTract = _v }
-        case 3:
-            var _v: TSCE_PreserveColumnRowFlagsArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_PreserveColumnRowFlagsArchive(ProtobufMessage(_b)) }
-            if let _v { preserveFlags = _v }
-        case 4:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { aggIndexLevel = _v }
-        case 5:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = IWAWire.unzigzag32(_u) }
-            if let _v { columnGroupLevel = _v }
-        case 6:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = IWAWire.unzigzag32(_u) }
-            if let _v { rowGroupLevel = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = tableUid { _w.bytesField(1, _x.encoded()) }
-        if let _x = uidTract { _w.bytesField(2, _x.encoded()) }
-        if let _x = preserveFlags { _w.bytesField(3, _x.encoded()) }
-        if let _x = aggIndexLevel { _w.varintField(4, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = columnGroupLevel { _w.varintField(5, IWAWire.zigzag32(_x)) }
-        if let _x = rowGroupLevel { _w.varintField(6, IWAWire.zigzag32(_x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.ViewTractRefArchive", [
+        .optional(1, TSP_UUID.self), .optional(2, TSCE_ASTNodeArrayArchive_ASTUidTract.self),
+        .optional(3, TSCE_PreserveColumnRowFlagsArchive.self), .optional(4, .uint32), .optional(5, .sint32),
+        .optional(6, .sint32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 6)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var tableUid: TSP_UUID? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var uidTract: TSCE_ASTNodeArrayArchive_ASTUidTract? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var preserveFlags: TSCE_PreserveColumnRowFlagsArchive? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var aggIndexLevel: UInt32? { get { self[3] } set { self[3] = newValue } }
+    var columnGroupLevel: Int32? { get { self[4] } set { self[4] = newValue } }
+    var rowGroupLevel: Int32? { get { self[5] } set { self[5] = newValue } }
 }
 
 /// Generated wire model for `TSCE.BooleanCellValueArchive`.
 final class TSCE_BooleanCellValueArchive: IWAMessage {
-    var value: Bool?
-    var format: TSK_FormatStructArchive?
-    var formatIsExplicit: Bool?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { value = _v }
-        case 2:
-            var _v: TSK_FormatStructArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_FormatStructArchive(ProtobufMessage(_b)) }
-            if let _v { format = _v }
-        case 3:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { formatIsExplicit = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = value { _w.varintField(1, _x ? 1 : 0) }
-        if let _x = format { _w.bytesField(2, _x.encoded()) }
-        if let _x = formatIsExplicit { _w.varintField(3, _x ? 1 : 0) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.BooleanCellValueArchive", [
+        .optional(1, .bool), .optional(2, TSK_FormatStructArchive.self), .optional(3, .bool),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var value: Bool? { get { self[0] } set { self[0] = newValue } }
+    var format: TSK_FormatStructArchive? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var formatIsExplicit: Bool? { get { self[2] } set { self[2] = newValue } }
 }
 
 /// Generated wire model for `TSCE.DateCellValueArchive`.
 final class TSCE_DateCellValueArchive: IWAMessage {
-    var value: Double?
-    var format: TSK_FormatStructArchive?
-    var formatIsImplicit: Bool?
-    var formatIsExplicit: Bool?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { value = _v }
-        case 2:
-            var _v: TSK_FormatStructArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_FormatStructArchive(ProtobufMessage(_b)) }
-            if let _v { format = _v }
-        case 3:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { formatIsImplicit = _v }
-        case 4:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { formatIsExplicit = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = value { _w.fixed64Field(1, _x.bitPattern) }
-        if let _x = format { _w.bytesField(2, _x.encoded()) }
-        if let _x = formatIsImplicit { _w.varintField(3, _x ? 1 : 0) }
-        if let _x = formatIsExplicit { _w.varintField(4, _x ? 1 : 0) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.DateCellValueArchive", [
+        .optional(1, .double), .optional(2, TSK_FormatStructArchive.self), .optional(3, .bool), .optional(4, .bool),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var value: Double? { get { self[0] } set { self[0] = newValue } }
+    var format: TSK_FormatStructArchive? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var formatIsImplicit: Bool? { get { self[2] } set { self[2] = newValue } }
+    var formatIsExplicit: Bool? { get { self[3] } set { self[3] = newValue } }
 }
 
 /// Generated wire model for `TSCE.NumberCellValueArchive`.
 final class TSCE_NumberCellValueArchive: IWAMessage {
-    var value: Double?
-    var unitIndex: Int32?
-    var currencyCode: String?
-    var format: TSK_FormatStructArchive?
-    var formatIsImplicit: Bool?
-    var formatIsExplicit: Bool?
-    var decimalLow: UInt64?
-    var decimalHigh: UInt64?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { value = _v }
-        case 2:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { unitIndex = _v }
-        case 5:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { currencyCode = _v }
-        case 3:
-            var _v: TSK_FormatStructArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_FormatStructArchive(ProtobufMessage(_b)) }
-            if let _v { format = _v }
-        case 4:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { formatIsImplicit = _v }
-        case 6:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { formatIsExplicit = _v }
-        case 7:
-            var _v: UInt64?
-            if case .varint(let _u) = _f.value { _v = UInt64(truncatingIfNeeded: _u) }
-            if let _v { decimalLow = _v }
-        case 8:
-            var _v: UInt64?
-            if case .varint(let _u) = _f.value { _v = UInt64(truncatingIfNeeded: _u) }
-            if let _v { decimalHigh = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = value { _w.fixed64Field(1, _x.bitPattern) }
-        if let _x = unitIndex { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = currencyCode { _w.stringField(5, _x) }
-        if let _x = format { _w.bytesField(3, _x.encoded()) }
-        if let _x = formatIsImplicit { _w.varintField(4, _x ? 1 : 0) }
-        if let _x = formatIsExplicit { _w.varintField(6, _x ? 1 : 0) }
-        if let _x = decimalLow { _w.varintField(7, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = decimalHigh { _w.varintField(8, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.NumberCellValueArchive", [
+        .optional(1, .double), .optional(2, .int32), .optional(5, .string), .optional(3, TSK_FormatStructArchive.self),
+        .optional(4, .bool), .optional(6, .bool), .optional(7, .uint64), .optional(8, .uint64),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 8)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var value: Double? { get { self[0] } set { self[0] = newValue } }
+    var unitIndex: Int32? { get { self[1] } set { self[1] = newValue } }
+    var currencyCode: String? { get { self[2] } set { self[2] = newValue } }
+    var format: TSK_FormatStructArchive? { get { self[message: 3] } set { self[message: 3] = newValue } }
+    var formatIsImplicit: Bool? { get { self[4] } set { self[4] = newValue } }
+    var formatIsExplicit: Bool? { get { self[5] } set { self[5] = newValue } }
+    var decimalLow: UInt64? { get { self[6] } set { self[6] = newValue } }
+    var decimalHigh: UInt64? { get { self[7] } set { self[7] = newValue } }
 }
 
 /// Generated wire model for `TSCE.StringCellValueArchive`.
 final class TSCE_StringCellValueArchive: IWAMessage {
-    var value: String?
-    var format: TSK_FormatStructArchive?
-    var formatIsImplicit: Bool?
-    var formatIsExplicit: Bool?
-    var isRegex: Bool?
-    var isCaseSensitiveRegex: Bool?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { value = _v }
-        case 2:
-            var _v: TSK_FormatStructArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_FormatStructArchive(ProtobufMessage(_b)) }
-            if let _v { format = _v }
-        case 3:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { formatIsImplicit = _v }
-        case 4:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { formatIsExplicit = _v }
-        case 5:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { isRegex = _v }
-        case 6:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { isCaseSensitiveRegex = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = value { _w.stringField(1, _x) }
-        if let _x = format { _w.bytesField(2, _x.encoded()) }
-        if let _x = formatIsImplicit { _w.varintField(3, _x ? 1 : 0) }
-        if let _x = formatIsExplicit { _w.varintField(4, _x ? 1 : 0) }
-        if let _x = isRegex { _w.varintField(5, _x ? 1 : 0) }
-        if let _x = isCaseSensitiveRegex { _w.varintField(6, _x ? 1 : 0) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.StringCellValueArchive", [
+        .optional(1, .string), .optional(2, TSK_FormatStructArchive.self), .optional(3, .bool), .optional(4, .bool),
+        .optional(5, .bool), .optional(6, .bool),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 6)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var value: String? { get { self[0] } set { self[0] = newValue } }
+    var format: TSK_FormatStructArchive? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var formatIsImplicit: Bool? { get { self[2] } set { self[2] = newValue } }
+    var formatIsExplicit: Bool? { get { self[3] } set { self[3] = newValue } }
+    var isRegex: Bool? { get { self[4] } set { self[4] = newValue } }
+    var isCaseSensitiveRegex: Bool? { get { self[5] } set { self[5] = newValue } }
 }
 
 /// Generated wire model for `TSCE.ErrorCellValueArchive`.
 final class TSCE_ErrorCellValueArchive: IWAMessage {
-    var errorType: Int32?
-    var extraInfoInt: Int32?
-    var extraInfoString: String?
-    var extraInfoDouble: Double?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { errorType = _v }
-        case 3:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { extraInfoInt = _v }
-        case 4:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { extraInfoString = _v }
-        case 5:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { extraInfoDouble = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = errorType { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = extraInfoInt { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = extraInfoString { _w.stringField(4, _x) }
-        if let _x = extraInfoDouble { _w.fixed64Field(5, _x.bitPattern) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.ErrorCellValueArchive", [
+        .optional(1, .int32), .optional(3, .int32), .optional(4, .string), .optional(5, .double),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var errorType: Int32? { get { self[0] } set { self[0] = newValue } }
+    var extraInfoInt: Int32? { get { self[1] } set { self[1] = newValue } }
+    var extraInfoString: String? { get { self[2] } set { self[2] = newValue } }
+    var extraInfoDouble: Double? { get { self[3] } set { self[3] = newValue } }
 }
 
 /// Generated wire model for `TSCE.CellValueArchive`.
 final class TSCE_CellValueArchive: IWAMessage {
-    var cellValueType: Int32?
-    var booleanValue: TSCE_BooleanCellValueArchive?
-    var dateValue: TSCE_DateCellValueArchive?
-    var numberValue: TSCE_NumberCellValueArchive?
-    var stringValue: TSCE_StringCellValueArchive?
-    var errorValue: TSCE_ErrorCellValueArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { cellValueType = _v }
-        case 2:
-            var _v: TSCE_BooleanCellValueArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_BooleanCellValueArchive(ProtobufMessage(_b)) }
-            if let _v { booleanValue = _v }
-        case 3:
-            var _v: TSCE_DateCellValueArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_DateCellValueArchive(ProtobufMessage(_b)) }
-            if let _v { dateValue = _v }
-        case 4:
-            var _v: TSCE_NumberCellValueArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_NumberCellValueArchive(ProtobufMessage(_b)) }
-            if let _v { numberValue = _v }
-        case 5:
-            var _v: TSCE_StringCellValueArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_StringCellValueArchive(ProtobufMessage(_b)) }
-            if let _v { stringValue = _v }
-        case 6:
-            var _v: TSCE_ErrorCellValueArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_ErrorCellValueArchive(ProtobufMessage(_b)) }
-            if let _v { errorValue = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = cellValueType { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = booleanValue { _w.bytesField(2, _x.encoded()) }
-        if let _x = dateValue { _w.bytesField(3, _x.encoded()) }
-        if let _x = numberValue { _w.bytesField(4, _x.encoded()) }
-        if let _x = stringValue { _w.bytesField(5, _x.encoded()) }
-        if let _x = errorValue { _w.bytesField(6, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCE.CellValueArchive", [
+        .optional(1, .int32), .optional(2, TSCE_BooleanCellValueArchive.self),
+        .optional(3, TSCE_DateCellValueArchive.self), .optional(4, TSCE_NumberCellValueArchive.self),
+        .optional(5, TSCE_StringCellValueArchive.self), .optional(6, TSCE_ErrorCellValueArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 6)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var cellValueType: Int32? { get { self[0] } set { self[0] = newValue } }
+    var booleanValue: TSCE_BooleanCellValueArchive? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var dateValue: TSCE_DateCellValueArchive? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var numberValue: TSCE_NumberCellValueArchive? { get { self[message: 3] } set { self[message: 3] = newValue } }
+    var stringValue: TSCE_StringCellValueArchive? { get { self[message: 4] } set { self[message: 4] = newValue } }
+    var errorValue: TSCE_ErrorCellValueArchive? { get { self[message: 5] } set { self[message: 5] = newValue } }
 }
 
 /// Registers this file's archives into the reflective catalog.
-func registerIWA_TSCEArchives(_ into: inout [(name: String, decode: (ProtobufMessage) -> IWAMessage)]) {
-    into.append(("TSCE.CellReferenceArchive", { TSCE_CellReferenceArchive($0) as IWAMessage }))
-    into.append(("TSCE.InternalCellReferenceArchive", { TSCE_InternalCellReferenceArchive($0) as IWAMessage }))
-    into.append(("TSCE.RelativeCellRefArchive", { TSCE_RelativeCellRefArchive($0) as IWAMessage }))
-    into.append(("TSCE.RangeReferenceArchive", { TSCE_RangeReferenceArchive($0) as IWAMessage }))
-    into.append(("TSCE.InternalRangeReferenceArchive", { TSCE_InternalRangeReferenceArchive($0) as IWAMessage }))
-    into.append(("TSCE.IndexSetArchive", { TSCE_IndexSetArchive($0) as IWAMessage }))
-    into.append(("TSCE.IndexSetArchive.IndexSetEntry", { TSCE_IndexSetArchive_IndexSetEntry($0) as IWAMessage }))
-    into.append(("TSCE.CellCoordSetArchive", { TSCE_CellCoordSetArchive($0) as IWAMessage }))
-    into.append(("TSCE.CellCoordSetArchive.ColumnEntry", { TSCE_CellCoordSetArchive_ColumnEntry($0) as IWAMessage }))
-    into.append(("TSCE.InternalCellRefSetArchive", { TSCE_InternalCellRefSetArchive($0) as IWAMessage }))
-    into.append(("TSCE.InternalCellRefSetArchive.OwnerEntry", { TSCE_InternalCellRefSetArchive_OwnerEntry($0) as IWAMessage }))
-    into.append(("TSCE.ColumnRowSize", { TSCE_ColumnRowSize($0) as IWAMessage }))
-    into.append(("TSCE.CellRectArchive", { TSCE_CellRectArchive($0) as IWAMessage }))
-    into.append(("TSCE.CellRefSetArchive", { TSCE_CellRefSetArchive($0) as IWAMessage }))
-    into.append(("TSCE.CellRefSetArchive.OwnerEntry", { TSCE_CellRefSetArchive_OwnerEntry($0) as IWAMessage }))
-    into.append(("TSCE.UidCoordSetArchive", { TSCE_UidCoordSetArchive($0) as IWAMessage }))
-    into.append(("TSCE.UidCoordSetArchive.ColumnEntry", { TSCE_UidCoordSetArchive_ColumnEntry($0) as IWAMessage }))
-    into.append(("TSCE.UidCellRefSetArchive", { TSCE_UidCellRefSetArchive($0) as IWAMessage }))
-    into.append(("TSCE.UidCellRefSetArchive.OwnerEntry", { TSCE_UidCellRefSetArchive_OwnerEntry($0) as IWAMessage }))
-    into.append(("TSCE.ReferencesToDirtyArchive", { TSCE_ReferencesToDirtyArchive($0) as IWAMessage }))
-    into.append(("TSCE.CoordMapperArchive", { TSCE_CoordMapperArchive($0) as IWAMessage }))
-    into.append(("TSCE.CoordMapperArchive.BaseToViewEntry", { TSCE_CoordMapperArchive_BaseToViewEntry($0) as IWAMessage }))
-    into.append(("TSCE.CoordMapperArchive.SummaryToViewEntry", { TSCE_CoordMapperArchive_SummaryToViewEntry($0) as IWAMessage }))
-    into.append(("TSCE.ReferenceArchive", { TSCE_ReferenceArchive($0) as IWAMessage }))
-    into.append(("TSCE.EdgeArchive", { TSCE_EdgeArchive($0) as IWAMessage }))
-    into.append(("TSCE.EdgesArchive", { TSCE_EdgesArchive($0) as IWAMessage }))
-    into.append(("TSCE.ExpandedEdgesArchive", { TSCE_ExpandedEdgesArchive($0) as IWAMessage }))
-    into.append(("TSCE.CellRecordArchive", { TSCE_CellRecordArchive($0) as IWAMessage }))
-    into.append(("TSCE.CellDependenciesArchive", { TSCE_CellDependenciesArchive($0) as IWAMessage }))
-    into.append(("TSCE.CellRecordExpandedArchive", { TSCE_CellRecordExpandedArchive($0) as IWAMessage }))
-    into.append(("TSCE.CellDependenciesExpandedArchive", { TSCE_CellDependenciesExpandedArchive($0) as IWAMessage }))
-    into.append(("TSCE.CellRecordTileArchive", { TSCE_CellRecordTileArchive($0) as IWAMessage }))
-    into.append(("TSCE.CellDependenciesTiledArchive", { TSCE_CellDependenciesTiledArchive($0) as IWAMessage }))
-    into.append(("TSCE.VolatileDependenciesArchive", { TSCE_VolatileDependenciesArchive($0) as IWAMessage }))
-    into.append(("TSCE.VolatileDependenciesExpandedArchive", { TSCE_VolatileDependenciesExpandedArchive($0) as IWAMessage }))
-    into.append(("TSCE.RTreeInternalNodeContentsArchive", { TSCE_RTreeInternalNodeContentsArchive($0) as IWAMessage }))
-    into.append(("TSCE.RTreeLeafNodeContentsArchive", { TSCE_RTreeLeafNodeContentsArchive($0) as IWAMessage }))
-    into.append(("TSCE.RTreeNodeArchive", { TSCE_RTreeNodeArchive($0) as IWAMessage }))
-    into.append(("TSCE.RTreeArchive", { TSCE_RTreeArchive($0) as IWAMessage }))
-    into.append(("TSCE.RangeBackDependencyArchive", { TSCE_RangeBackDependencyArchive($0) as IWAMessage }))
-    into.append(("TSCE.RangeDependenciesArchive", { TSCE_RangeDependenciesArchive($0) as IWAMessage }))
-    into.append(("TSCE.RangePrecedentsTileArchive", { TSCE_RangePrecedentsTileArchive($0) as IWAMessage }))
-    into.append(("TSCE.RangePrecedentsTileArchive.FromToRangeArchive", { TSCE_RangePrecedentsTileArchive_FromToRangeArchive($0) as IWAMessage }))
-    into.append(("TSCE.RangeDependenciesTiledArchive", { TSCE_RangeDependenciesTiledArchive($0) as IWAMessage }))
-    into.append(("TSCE.SpanningDependenciesArchive", { TSCE_SpanningDependenciesArchive($0) as IWAMessage }))
-    into.append(("TSCE.SpanningDependenciesArchive.ReferringColumnToLocalCells", { TSCE_SpanningDependenciesArchive_ReferringColumnToLocalCells($0) as IWAMessage }))
-    into.append(("TSCE.SpanningDependenciesArchive.ReferringColumnToRemoteCells", { TSCE_SpanningDependenciesArchive_ReferringColumnToRemoteCells($0) as IWAMessage }))
-    into.append(("TSCE.SpanningDependenciesExpandedArchive", { TSCE_SpanningDependenciesExpandedArchive($0) as IWAMessage }))
-    into.append(("TSCE.SpanningDependenciesExpandedArchive.ExtentRange", { TSCE_SpanningDependenciesExpandedArchive_ExtentRange($0) as IWAMessage }))
-    into.append(("TSCE.SpanningDependenciesExpandedArchive.ExtentRangeWithTableWithContext", { TSCE_SpanningDependenciesExpandedArchive_ExtentRangeWithTableWithContext($0) as IWAMessage }))
-    into.append(("TSCE.SpanningDependenciesExpandedArchive.CellCoordRefersToExtents", { TSCE_SpanningDependenciesExpandedArchive_CellCoordRefersToExtents($0) as IWAMessage }))
-    into.append(("TSCE.WholeOwnerDependenciesArchive", { TSCE_WholeOwnerDependenciesArchive($0) as IWAMessage }))
-    into.append(("TSCE.WholeOwnerDependenciesExpandedArchive", { TSCE_WholeOwnerDependenciesExpandedArchive($0) as IWAMessage }))
-    into.append(("TSCE.ErrorArchive", { TSCE_ErrorArchive($0) as IWAMessage }))
-    into.append(("TSCE.ErrorArchive.ErrorDictionaryEntry", { TSCE_ErrorArchive_ErrorDictionaryEntry($0) as IWAMessage }))
-    into.append(("TSCE.WarningArchive", { TSCE_WarningArchive($0) as IWAMessage }))
-    into.append(("TSCE.WarningArchive.WarningDictionaryEntry", { TSCE_WarningArchive_WarningDictionaryEntry($0) as IWAMessage }))
-    into.append(("TSCE.CellErrorsArchive", { TSCE_CellErrorsArchive($0) as IWAMessage }))
-    into.append(("TSCE.CellErrorsArchive.ErrorForCell", { TSCE_CellErrorsArchive_ErrorForCell($0) as IWAMessage }))
-    into.append(("TSCE.CellErrorsArchive.EnhancedErrorForCell", { TSCE_CellErrorsArchive_EnhancedErrorForCell($0) as IWAMessage }))
-    into.append(("TSCE.CellSpillSizesArchive", { TSCE_CellSpillSizesArchive($0) as IWAMessage }))
-    into.append(("TSCE.CellSpillSizesArchive.SpillForCell", { TSCE_CellSpillSizesArchive_SpillForCell($0) as IWAMessage }))
-    into.append(("TSCE.UuidReferencesArchive", { TSCE_UuidReferencesArchive($0) as IWAMessage }))
-    into.append(("TSCE.UuidReferencesArchive.TableRef", { TSCE_UuidReferencesArchive_TableRef($0) as IWAMessage }))
-    into.append(("TSCE.UuidReferencesArchive.UuidRef", { TSCE_UuidReferencesArchive_UuidRef($0) as IWAMessage }))
-    into.append(("TSCE.UuidReferencesArchive.TableWithUuidRef", { TSCE_UuidReferencesArchive_TableWithUuidRef($0) as IWAMessage }))
-    into.append(("TSCE.FormulaOwnerDependenciesArchive", { TSCE_FormulaOwnerDependenciesArchive($0) as IWAMessage }))
-    into.append(("TSCE.FormulaOwnerInfoArchive", { TSCE_FormulaOwnerInfoArchive($0) as IWAMessage }))
-    into.append(("TSCE.SubFormulaOwnerIDArchive", { TSCE_SubFormulaOwnerIDArchive($0) as IWAMessage }))
-    into.append(("TSCE.OwnerIDMapArchive", { TSCE_OwnerIDMapArchive($0) as IWAMessage }))
-    into.append(("TSCE.OwnerIDMapArchive.OwnerIDMapArchiveEntry", { TSCE_OwnerIDMapArchive_OwnerIDMapArchiveEntry($0) as IWAMessage }))
-    into.append(("TSCE.UidLookupListArchive", { TSCE_UidLookupListArchive($0) as IWAMessage }))
-    into.append(("TSCE.DependencyTrackerArchive", { TSCE_DependencyTrackerArchive($0) as IWAMessage }))
-    into.append(("TSCE.RemoteDataSpecifierArchive", { TSCE_RemoteDataSpecifierArchive($0) as IWAMessage }))
-    into.append(("TSCE.RemoteDataValueMapArchive", { TSCE_RemoteDataValueMapArchive($0) as IWAMessage }))
-    into.append(("TSCE.RemoteDataValueMapArchive.RemoteDataMapEntry", { TSCE_RemoteDataValueMapArchive_RemoteDataMapEntry($0) as IWAMessage }))
-    into.append(("TSCE.StockArchive", { TSCE_StockArchive($0) as IWAMessage }))
-    into.append(("TSCE.StockArchive.AttributeEntry", { TSCE_StockArchive_AttributeEntry($0) as IWAMessage }))
-    into.append(("TSCE.RemoteDataStoreArchive", { TSCE_RemoteDataStoreArchive($0) as IWAMessage }))
-    into.append(("TSCE.NameTrackedReferencePair", { TSCE_NameTrackedReferencePair($0) as IWAMessage }))
-    into.append(("TSCE.NamesByTrackedReferenceArchive", { TSCE_NamesByTrackedReferenceArchive($0) as IWAMessage }))
-    into.append(("TSCE.NamedReferenceManagerArchive", { TSCE_NamedReferenceManagerArchive($0) as IWAMessage }))
-    into.append(("TSCE.UuidSetStoreArchive", { TSCE_UuidSetStoreArchive($0) as IWAMessage }))
-    into.append(("TSCE.UuidSetStoreArchive.UuidSet", { TSCE_UuidSetStoreArchive_UuidSet($0) as IWAMessage }))
-    into.append(("TSCE.UuidReferenceMapArchive", { TSCE_UuidReferenceMapArchive($0) as IWAMessage }))
-    into.append(("TSCE.UuidReferenceMapArchive.CellRefsForUuid", { TSCE_UuidReferenceMapArchive_CellRefsForUuid($0) as IWAMessage }))
-    into.append(("TSCE.GroupByNodeMapArchive", { TSCE_GroupByNodeMapArchive($0) as IWAMessage }))
-    into.append(("TSCE.GroupByNodeMapArchive.CellRefsForGroupNode", { TSCE_GroupByNodeMapArchive_CellRefsForGroupNode($0) as IWAMessage }))
-    into.append(("TSCE.GroupByNodeMapArchive.GroupNodesForGroupBy", { TSCE_GroupByNodeMapArchive_GroupNodesForGroupBy($0) as IWAMessage }))
-    into.append(("TSCE.CalculationEngineArchive", { TSCE_CalculationEngineArchive($0) as IWAMessage }))
-    into.append(("TSCE.PreserveColumnRowFlagsArchive", { TSCE_PreserveColumnRowFlagsArchive($0) as IWAMessage }))
-    into.append(("TSCE.CategoryReferenceArchive", { TSCE_CategoryReferenceArchive($0) as IWAMessage }))
-    into.append(("TSCE.CategoryReferenceArchive.CatRefUidList", { TSCE_CategoryReferenceArchive_CatRefUidList($0) as IWAMessage }))
-    into.append(("TSCE.ASTNodeArrayArchive", { TSCE_ASTNodeArrayArchive($0) as IWAMessage }))
-    into.append(("TSCE.ASTNodeArrayArchive.ASTLocalCellReferenceNodeArchive", { TSCE_ASTNodeArrayArchive_ASTLocalCellReferenceNodeArchive($0) as IWAMessage }))
-    into.append(("TSCE.ASTNodeArrayArchive.ASTCrossTableCellReferenceNodeArchive", { TSCE_ASTNodeArrayArchive_ASTCrossTableCellReferenceNodeArchive($0) as IWAMessage }))
-    into.append(("TSCE.ASTNodeArrayArchive.ASTColumnCoordinateArchive", { TSCE_ASTNodeArrayArchive_ASTColumnCoordinateArchive($0) as IWAMessage }))
-    into.append(("TSCE.ASTNodeArrayArchive.ASTRowCoordinateArchive", { TSCE_ASTNodeArrayArchive_ASTRowCoordinateArchive($0) as IWAMessage }))
-    into.append(("TSCE.ASTNodeArrayArchive.ASTUidList", { TSCE_ASTNodeArrayArchive_ASTUidList($0) as IWAMessage }))
-    into.append(("TSCE.ASTNodeArrayArchive.ASTUidTract", { TSCE_ASTNodeArrayArchive_ASTUidTract($0) as IWAMessage }))
-    into.append(("TSCE.ASTNodeArrayArchive.ASTStickyBits", { TSCE_ASTNodeArrayArchive_ASTStickyBits($0) as IWAMessage }))
-    into.append(("TSCE.ASTNodeArrayArchive.ASTUidTractList", { TSCE_ASTNodeArrayArchive_ASTUidTractList($0) as IWAMessage }))
-    into.append(("TSCE.ASTNodeArrayArchive.ASTUidCoordinateArchive", { TSCE_ASTNodeArrayArchive_ASTUidCoordinateArchive($0) as IWAMessage }))
-    into.append(("TSCE.ASTNodeArrayArchive.ASTCategoryLevels", { TSCE_ASTNodeArrayArchive_ASTCategoryLevels($0) as IWAMessage }))
-    into.append(("TSCE.ASTNodeArrayArchive.ASTCategoryReferenceArchive", { TSCE_ASTNodeArrayArchive_ASTCategoryReferenceArchive($0) as IWAMessage }))
-    into.append(("TSCE.ASTNodeArrayArchive.ASTColonTractArchive", { TSCE_ASTNodeArrayArchive_ASTColonTractArchive($0) as IWAMessage }))
-    into.append(("TSCE.ASTNodeArrayArchive.ASTColonTractArchive.ASTColonTractRelativeRangeArchive", { TSCE_ASTNodeArrayArchive_ASTColonTractArchive_ASTColonTractRelativeRangeArchive($0) as IWAMessage }))
-    into.append(("TSCE.ASTNodeArrayArchive.ASTColonTractArchive.ASTColonTractAbsoluteRangeArchive", { TSCE_ASTNodeArrayArchive_ASTColonTractArchive_ASTColonTractAbsoluteRangeArchive($0) as IWAMessage }))
-    into.append(("TSCE.ASTNodeArrayArchive.ASTCrossTableReferenceExtraInfoArchive", { TSCE_ASTNodeArrayArchive_ASTCrossTableReferenceExtraInfoArchive($0) as IWAMessage }))
-    into.append(("TSCE.ASTNodeArrayArchive.ASTLambdaIdentsListArchive", { TSCE_ASTNodeArrayArchive_ASTLambdaIdentsListArchive($0) as IWAMessage }))
-    into.append(("TSCE.ASTNodeArrayArchive.ASTNodeArchive", { TSCE_ASTNodeArrayArchive_ASTNodeArchive($0) as IWAMessage }))
-    into.append(("TSCE.FormulaTranslationFlagsArchive", { TSCE_FormulaTranslationFlagsArchive($0) as IWAMessage }))
-    into.append(("TSCE.FormulaArchive", { TSCE_FormulaArchive($0) as IWAMessage }))
-    into.append(("TSCE.FunctorArchive", { TSCE_FunctorArchive($0) as IWAMessage }))
-    into.append(("TSCE.FormatStructArchive", { TSCE_FormatStructArchive($0) as IWAMessage }))
-    into.append(("TSCE.RangeCoordinateArchive", { TSCE_RangeCoordinateArchive($0) as IWAMessage }))
-    into.append(("TSCE.TableTransposeInfoArchive", { TSCE_TableTransposeInfoArchive($0) as IWAMessage }))
-    into.append(("TSCE.MergeOriginMovedArchive", { TSCE_MergeOriginMovedArchive($0) as IWAMessage }))
-    into.append(("TSCE.OwnerUIDMapperArchive", { TSCE_OwnerUIDMapperArchive($0) as IWAMessage }))
-    into.append(("TSCE.RewriteTableUIDInfoArchive", { TSCE_RewriteTableUIDInfoArchive($0) as IWAMessage }))
-    into.append(("TSCE.RewriteTableUIDInfoArchive.TableUIDMapEntryArchive", { TSCE_RewriteTableUIDInfoArchive_TableUIDMapEntryArchive($0) as IWAMessage }))
-    into.append(("TSCE.GroupByChangeArchive", { TSCE_GroupByChangeArchive($0) as IWAMessage }))
-    into.append(("TSCE.GroupByChangeArchive.GroupingColumnChangeArchive", { TSCE_GroupByChangeArchive_GroupingColumnChangeArchive($0) as IWAMessage }))
-    into.append(("TSCE.RewriteGroupNodeUIDInfoArchive", { TSCE_RewriteGroupNodeUIDInfoArchive($0) as IWAMessage }))
-    into.append(("TSCE.IndexedUidsArchive", { TSCE_IndexedUidsArchive($0) as IWAMessage }))
-    into.append(("TSCE.IndexedUidsArchive.IndexedUid", { TSCE_IndexedUidsArchive_IndexedUid($0) as IWAMessage }))
-    into.append(("TSCE.RewriteRangeEntryArchive", { TSCE_RewriteRangeEntryArchive($0) as IWAMessage }))
-    into.append(("TSCE.ColumnOrRowUuidsInfoArchive", { TSCE_ColumnOrRowUuidsInfoArchive($0) as IWAMessage }))
-    into.append(("TSCE.RegionInfoArchive", { TSCE_RegionInfoArchive($0) as IWAMessage }))
-    into.append(("TSCE.RegionMovedInfoArchive", { TSCE_RegionMovedInfoArchive($0) as IWAMessage }))
-    into.append(("TSCE.MergeSourceArchive", { TSCE_MergeSourceArchive($0) as IWAMessage }))
-    into.append(("TSCE.HauntedOwnerArchive", { TSCE_HauntedOwnerArchive($0) as IWAMessage }))
-    into.append(("TSCE.SpillOwnerArchive", { TSCE_SpillOwnerArchive($0) as IWAMessage }))
-    into.append(("TSCE.CellCoordinateArchive", { TSCE_CellCoordinateArchive($0) as IWAMessage }))
-    into.append(("TSCE.CellCoordinateVectorArchive", { TSCE_CellCoordinateVectorArchive($0) as IWAMessage }))
-    into.append(("TSCE.ExpandedCellRefObjectPairArchive", { TSCE_ExpandedCellRefObjectPairArchive($0) as IWAMessage }))
-    into.append(("TSCE.ExpandedCellRefObjectMapArchive", { TSCE_ExpandedCellRefObjectMapArchive($0) as IWAMessage }))
-    into.append(("TSCE.FormulaAtCoordArchive", { TSCE_FormulaAtCoordArchive($0) as IWAMessage }))
-    into.append(("TSCE.FormulaCoordPairsByOwnerArchive", { TSCE_FormulaCoordPairsByOwnerArchive($0) as IWAMessage }))
-    into.append(("TSCE.FormulasForUndoArchive", { TSCE_FormulasForUndoArchive($0) as IWAMessage }))
-    into.append(("TSCE.FormulaRewriteCommandArchive", { TSCE_FormulaRewriteCommandArchive($0) as IWAMessage }))
-    into.append(("TSCE.TrackedReferenceArchive", { TSCE_TrackedReferenceArchive($0) as IWAMessage }))
-    into.append(("TSCE.ExpandedTrackedReferenceArchive", { TSCE_ExpandedTrackedReferenceArchive($0) as IWAMessage }))
-    into.append(("TSCE.TrackedReferenceStoreArchive", { TSCE_TrackedReferenceStoreArchive($0) as IWAMessage }))
-    into.append(("TSCE.ViewTractRefArchive", { TSCE_ViewTractRefArchive($0) as IWAMessage }))
-    into.append(("TSCE.BooleanCellValueArchive", { TSCE_BooleanCellValueArchive($0) as IWAMessage }))
-    into.append(("TSCE.DateCellValueArchive", { TSCE_DateCellValueArchive($0) as IWAMessage }))
-    into.append(("TSCE.NumberCellValueArchive", { TSCE_NumberCellValueArchive($0) as IWAMessage }))
-    into.append(("TSCE.StringCellValueArchive", { TSCE_StringCellValueArchive($0) as IWAMessage }))
-    into.append(("TSCE.ErrorCellValueArchive", { TSCE_ErrorCellValueArchive($0) as IWAMessage }))
-    into.append(("TSCE.CellValueArchive", { TSCE_CellValueArchive($0) as IWAMessage }))
+func registerIWA_TSCEArchives(_ into: inout [any IWAMessage.Type]) {
+    into += [
+        TSCE_CellReferenceArchive.self, TSCE_InternalCellReferenceArchive.self, TSCE_RelativeCellRefArchive.self,
+        TSCE_RangeReferenceArchive.self, TSCE_InternalRangeReferenceArchive.self, TSCE_IndexSetArchive.self,
+        TSCE_IndexSetArchive_IndexSetEntry.self, TSCE_CellCoordSetArchive.self,
+        TSCE_CellCoordSetArchive_ColumnEntry.self, TSCE_InternalCellRefSetArchive.self,
+        TSCE_InternalCellRefSetArchive_OwnerEntry.self, TSCE_ColumnRowSize.self, TSCE_CellRectArchive.self,
+        TSCE_CellRefSetArchive.self, TSCE_CellRefSetArchive_OwnerEntry.self, TSCE_UidCoordSetArchive.self,
+        TSCE_UidCoordSetArchive_ColumnEntry.self, TSCE_UidCellRefSetArchive.self,
+        TSCE_UidCellRefSetArchive_OwnerEntry.self, TSCE_ReferencesToDirtyArchive.self, TSCE_CoordMapperArchive.self,
+        TSCE_CoordMapperArchive_BaseToViewEntry.self, TSCE_CoordMapperArchive_SummaryToViewEntry.self,
+        TSCE_ReferenceArchive.self, TSCE_EdgeArchive.self, TSCE_EdgesArchive.self, TSCE_ExpandedEdgesArchive.self,
+        TSCE_CellRecordArchive.self, TSCE_CellDependenciesArchive.self, TSCE_CellRecordExpandedArchive.self,
+        TSCE_CellDependenciesExpandedArchive.self, TSCE_CellRecordTileArchive.self,
+        TSCE_CellDependenciesTiledArchive.self, TSCE_VolatileDependenciesArchive.self,
+        TSCE_VolatileDependenciesExpandedArchive.self, TSCE_RTreeInternalNodeContentsArchive.self,
+        TSCE_RTreeLeafNodeContentsArchive.self, TSCE_RTreeNodeArchive.self, TSCE_RTreeArchive.self,
+        TSCE_RangeBackDependencyArchive.self, TSCE_RangeDependenciesArchive.self, TSCE_RangePrecedentsTileArchive.self,
+        TSCE_RangePrecedentsTileArchive_FromToRangeArchive.self, TSCE_RangeDependenciesTiledArchive.self,
+        TSCE_SpanningDependenciesArchive.self, TSCE_SpanningDependenciesArchive_ReferringColumnToLocalCells.self,
+        TSCE_SpanningDependenciesArchive_ReferringColumnToRemoteCells.self,
+        TSCE_SpanningDependenciesExpandedArchive.self, TSCE_SpanningDependenciesExpandedArchive_ExtentRange.self,
+        TSCE_SpanningDependenciesExpandedArchive_ExtentRangeWithTableWithContext.self,
+        TSCE_SpanningDependenciesExpandedArchive_CellCoordRefersToExtents.self, TSCE_WholeOwnerDependenciesArchive.self,
+        TSCE_WholeOwnerDependenciesExpandedArchive.self, TSCE_ErrorArchive.self,
+        TSCE_ErrorArchive_ErrorDictionaryEntry.self, TSCE_WarningArchive.self,
+        TSCE_WarningArchive_WarningDictionaryEntry.self, TSCE_CellErrorsArchive.self,
+        TSCE_CellErrorsArchive_ErrorForCell.self, TSCE_CellErrorsArchive_EnhancedErrorForCell.self,
+        TSCE_CellSpillSizesArchive.self, TSCE_CellSpillSizesArchive_SpillForCell.self, TSCE_UuidReferencesArchive.self,
+        TSCE_UuidReferencesArchive_TableRef.self, TSCE_UuidReferencesArchive_UuidRef.self,
+        TSCE_UuidReferencesArchive_TableWithUuidRef.self, TSCE_FormulaOwnerDependenciesArchive.self,
+        TSCE_FormulaOwnerInfoArchive.self, TSCE_SubFormulaOwnerIDArchive.self, TSCE_OwnerIDMapArchive.self,
+        TSCE_OwnerIDMapArchive_OwnerIDMapArchiveEntry.self, TSCE_UidLookupListArchive.self,
+        TSCE_DependencyTrackerArchive.self, TSCE_RemoteDataSpecifierArchive.self, TSCE_RemoteDataValueMapArchive.self,
+        TSCE_RemoteDataValueMapArchive_RemoteDataMapEntry.self, TSCE_StockArchive.self,
+        TSCE_StockArchive_AttributeEntry.self, TSCE_RemoteDataStoreArchive.self, TSCE_NameTrackedReferencePair.self,
+        TSCE_NamesByTrackedReferenceArchive.self, TSCE_NamedReferenceManagerArchive.self, TSCE_UuidSetStoreArchive.self,
+        TSCE_UuidSetStoreArchive_UuidSet.self, TSCE_UuidReferenceMapArchive.self,
+        TSCE_UuidReferenceMapArchive_CellRefsForUuid.self, TSCE_GroupByNodeMapArchive.self,
+        TSCE_GroupByNodeMapArchive_CellRefsForGroupNode.self, TSCE_GroupByNodeMapArchive_GroupNodesForGroupBy.self,
+        TSCE_CalculationEngineArchive.self, TSCE_PreserveColumnRowFlagsArchive.self, TSCE_CategoryReferenceArchive.self,
+        TSCE_CategoryReferenceArchive_CatRefUidList.self, TSCE_ASTNodeArrayArchive.self,
+        TSCE_ASTNodeArrayArchive_ASTLocalCellReferenceNodeArchive.self,
+        TSCE_ASTNodeArrayArchive_ASTCrossTableCellReferenceNodeArchive.self,
+        TSCE_ASTNodeArrayArchive_ASTColumnCoordinateArchive.self, TSCE_ASTNodeArrayArchive_ASTRowCoordinateArchive.self,
+        TSCE_ASTNodeArrayArchive_ASTUidList.self, TSCE_ASTNodeArrayArchive_ASTUidTract.self,
+        TSCE_ASTNodeArrayArchive_ASTStickyBits.self, TSCE_ASTNodeArrayArchive_ASTUidTractList.self,
+        TSCE_ASTNodeArrayArchive_ASTUidCoordinateArchive.self, TSCE_ASTNodeArrayArchive_ASTCategoryLevels.self,
+        TSCE_ASTNodeArrayArchive_ASTCategoryReferenceArchive.self, TSCE_ASTNodeArrayArchive_ASTColonTractArchive.self,
+        TSCE_ASTNodeArrayArchive_ASTColonTractArchive_ASTColonTractRelativeRangeArchive.self,
+        TSCE_ASTNodeArrayArchive_ASTColonTractArchive_ASTColonTractAbsoluteRangeArchive.self,
+        TSCE_ASTNodeArrayArchive_ASTCrossTableReferenceExtraInfoArchive.self,
+        TSCE_ASTNodeArrayArchive_ASTLambdaIdentsListArchive.self, TSCE_ASTNodeArrayArchive_ASTNodeArchive.self,
+        TSCE_FormulaTranslationFlagsArchive.self, TSCE_FormulaArchive.self, TSCE_FunctorArchive.self,
+        TSCE_FormatStructArchive.self, TSCE_RangeCoordinateArchive.self, TSCE_TableTransposeInfoArchive.self,
+        TSCE_MergeOriginMovedArchive.self, TSCE_OwnerUIDMapperArchive.self, TSCE_RewriteTableUIDInfoArchive.self,
+        TSCE_RewriteTableUIDInfoArchive_TableUIDMapEntryArchive.self, TSCE_GroupByChangeArchive.self,
+        TSCE_GroupByChangeArchive_GroupingColumnChangeArchive.self, TSCE_RewriteGroupNodeUIDInfoArchive.self,
+        TSCE_IndexedUidsArchive.self, TSCE_IndexedUidsArchive_IndexedUid.self, TSCE_RewriteRangeEntryArchive.self,
+        TSCE_ColumnOrRowUuidsInfoArchive.self, TSCE_RegionInfoArchive.self, TSCE_RegionMovedInfoArchive.self,
+        TSCE_MergeSourceArchive.self, TSCE_HauntedOwnerArchive.self, TSCE_SpillOwnerArchive.self,
+        TSCE_CellCoordinateArchive.self, TSCE_CellCoordinateVectorArchive.self,
+        TSCE_ExpandedCellRefObjectPairArchive.self, TSCE_ExpandedCellRefObjectMapArchive.self,
+        TSCE_FormulaAtCoordArchive.self, TSCE_FormulaCoordPairsByOwnerArchive.self, TSCE_FormulasForUndoArchive.self,
+        TSCE_FormulaRewriteCommandArchive.self, TSCE_TrackedReferenceArchive.self,
+        TSCE_ExpandedTrackedReferenceArchive.self, TSCE_TrackedReferenceStoreArchive.self,
+        TSCE_ViewTractRefArchive.self, TSCE_BooleanCellValueArchive.self, TSCE_DateCellValueArchive.self,
+        TSCE_NumberCellValueArchive.self, TSCE_StringCellValueArchive.self, TSCE_ErrorCellValueArchive.self,
+        TSCE_CellValueArchive.self,
+    ]
 }
@@ -5,2435 +5,971 @@ import SwiftTextIWA
 
 /// Generated wire model for `TSCK.CollaborationCommandHistoryArray`.
 final class TSCK_CollaborationCommandHistoryArray: IWAMessage {
-    var largeArray: TSP_LargeArray?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSCK.CollaborationCommandHistoryArray", [
+        .optional(1, TSP_LargeArray.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_LargeArray?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_LargeArray(ProtobufMessage(_b)) }
-            if let _v { largeArray = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = largeArray { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var largeArray: TSP_LargeArray? { get { self[message: 0] } set { self[message: 0] = newValue } }
 }
 
 /// Generated wire model for `TSCK.CollaborationCommandHistoryArraySegment`.
 final class TSCK_CollaborationCommandHistoryArraySegment: IWAMessage {
-    var largeObjectArraySegment: TSP_LargeObjectArraySegment?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSCK.CollaborationCommandHistoryArraySegment", [
+        .optional(1, TSP_LargeObjectArraySegment.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_LargeObjectArraySegment?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_LargeObjectArraySegment(ProtobufMessage(_b)) }
-            if let _v { largeObjectArraySegment = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = largeObjectArraySegment { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var largeObjectArraySegment: TSP_LargeObjectArraySegment? { get { self[message: 0] } set { self[message: 0] = newValue } }
 }
 
 /// Generated wire model for `TSCK.CollaborationCommandHistory`.
 final class TSCK_CollaborationCommandHistory: IWAMessage {
-    var localIdentifier: TSP_UUID?
-    var undoItems: TSCK_CollaborationCommandHistory_ItemList?
-    var redoItems: TSCK_CollaborationCommandHistory_ItemList?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSCK.CollaborationCommandHistory", [
+        .optional(1, TSP_UUID.self), .optional(2, TSCK_CollaborationCommandHistory_ItemList.self),
+        .optional(3, TSCK_CollaborationCommandHistory_ItemList.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { localIdentifier = _v }
-        case 2:
-            var _v: TSCK_CollaborationCommandHistory_ItemList?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCK_CollaborationCommandHistory_ItemList(ProtobufMessage(_b)) }
-            if let _v { undoItems = _v }
-        case 3:
-            var _v: TSCK_CollaborationCommandHistory_ItemList?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCK_CollaborationCommandHistory_ItemList(ProtobufMessage(_b)) }
-            if let _v { redoItems = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = localIdentifier { _w.bytesField(1, _x.encoded()) }
-        if let _x = undoItems { _w.bytesField(2, _x.encoded()) }
-        if let _x = redoItems { _w.bytesField(3, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var localIdentifier: TSP_UUID? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var undoItems: TSCK_CollaborationCommandHistory_ItemList? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var redoItems: TSCK_CollaborationCommandHistory_ItemList? { get { self[message: 2] } set { self[message: 2] = newValue } }
 }
 
 /// Generated wire model for `TSCK.CollaborationCommandHistory.ItemList`.
 final class TSCK_CollaborationCommandHistory_ItemList: IWAMessage {
-    var itemsArray: TSP_Reference?
-    var transformerEntries: [TSP_Reference] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSCK.CollaborationCommandHistory.ItemList", [
+        .optional(1, TSP_Reference.self), .repeated(2, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { itemsArray = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { transformerEntries.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = itemsArray { _w.bytesField(1, _x.encoded()) }
-        for _x in transformerEntries { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var itemsArray: TSP_Reference? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var transformerEntries: [TSP_Reference] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(transformerEntries value: TSP_Reference) { append(value, toMessages: 1) }
 }
 
 /// Generated wire model for `TSCK.CollaborationCommandHistoryItem`.
 final class TSCK_CollaborationCommandHistoryItem: IWAMessage {
-    var command: TSP_Reference?
-    var actionString: String?
-    var behavior: TSP_Reference?
-    var coalescingGroup: TSP_Reference?
-    var revisionSequence: UInt64?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSCK.CollaborationCommandHistoryItem", [
+        .optional(1, TSP_Reference.self), .optional(2, .string), .optional(3, TSP_Reference.self),
+        .optional(4, TSP_Reference.self), .optional(5, .uint64),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 5)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { command = _v }
-        case 2:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { actionString = _v }
-        case 3:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { behavior = _v }
-        case 4:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { coalescingGroup = _v }
-        case 5:
-            var _v: UInt64?
-            if case .varint(let _u) = _f.value { _v = UInt64(truncatingIfNeeded: _u) }
-            if let _v { revisionSequence = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = command { _w.bytesField(1, _x.encoded()) }
-        if let _x = actionString { _w.stringField(2, _x) }
-        if let _x = behavior { _w.bytesField(3, _x.encoded()) }
-        if let _x = coalescingGroup { _w.bytesField(4, _x.encoded()) }
-        if let _x = revisionSequence { _w.varintField(5, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var command: TSP_Reference? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var actionString: String? { get { self[1] } set { self[1] = newValue } }
+    var behavior: TSP_Reference? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var coalescingGroup: TSP_Reference? { get { self[message: 3] } set { self[message: 3] = newValue } }
+    var revisionSequence: UInt64? { get { self[4] } set { self[4] = newValue } }
 }
 
 /// Generated wire model for `TSCK.CollaborationCommandHistoryCoalescingGroup`.
 final class TSCK_CollaborationCommandHistoryCoalescingGroup: IWAMessage {
-    var nodes: [TSP_Reference] = []
-    var didCoalesceAllCommands: Bool?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSCK.CollaborationCommandHistoryCoalescingGroup", [
+        .repeated(1, TSP_Reference.self), .optional(2, .bool),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { nodes.append(_v) }
-        case 2:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { didCoalesceAllCommands = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in nodes { _w.bytesField(1, _x.encoded()) }
-        if let _x = didCoalesceAllCommands { _w.varintField(2, _x ? 1 : 0) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var nodes: [TSP_Reference] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(nodes value: TSP_Reference) { append(value, toMessages: 0) }
+    var didCoalesceAllCommands: Bool? { get { self[1] } set { self[1] = newValue } }
 }
 
 /// Generated wire model for `TSCK.CollaborationCommandHistoryCoalescingGroupNode`.
 final class TSCK_CollaborationCommandHistoryCoalescingGroupNode: IWAMessage {
-    var command: TSP_Reference?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSCK.CollaborationCommandHistoryCoalescingGroupNode", [
+        .optional(1, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { command = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = command { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var command: TSP_Reference? { get { self[message: 0] } set { self[message: 0] = newValue } }
 }
 
 /// Generated wire model for `TSCK.CollaborationCommandHistoryOriginatingCommandAcknowledgementObserver`.
 final class TSCK_CollaborationCommandHistoryOriginatingCommandAcknowledgementObserver: IWAMessage {
-    var coalescingGroup: TSP_Reference?
-    var node: TSP_Reference?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSCK.CollaborationCommandHistoryOriginatingCommandAcknowledgementObserver", [
+        .optional(1, TSP_Reference.self), .optional(2, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { coalescingGroup = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { node = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = coalescingGroup { _w.bytesField(1, _x.encoded()) }
-        if let _x = node { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var coalescingGroup: TSP_Reference? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var node: TSP_Reference? { get { self[message: 1] } set { self[message: 1] = newValue } }
 }
 
 /// Generated wire model for `TSCK.DocumentSupportCollaborationState`.
 final class TSCK_DocumentSupportCollaborationState: IWAMessage {
-    var collaborationCommandHistory: TSP_Reference?
-    var collaborationSessionState: TSP_Reference?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSCK.DocumentSupportCollaborationState", [
+        .optional(1, TSP_Reference.self), .optional(2, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { collaborationCommandHistory = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { collaborationSessionState = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = collaborationCommandHistory { _w.bytesField(1, _x.encoded()) }
-        if let _x = collaborationSessionState { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var collaborationCommandHistory: TSP_Reference? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var collaborationSessionState: TSP_Reference? { get { self[message: 1] } set { self[message: 1] = newValue } }
 }
 
 /// Generated wire model for `TSCK.SetAnnotationAuthorColorCommandArchive`.
 final class TSCK_SetAnnotationAuthorColorCommandArchive: IWAMessage {
-    var `super`: TSK_CommandArchive?
-    var annotationAuthor: TSP_Reference?
-    var color: TSP_Color?
-    var oldColor: TSP_Color?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSCK.SetAnnotationAuthorColorCommandArchive", [
+        .optional(1, TSK_CommandArchive.self), .optional(2, TSP_Reference.self), .optional(3, TSP_Color.self),
+        .optional(4, TSP_Color.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSK_CommandArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_CommandArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { annotationAuthor = _v }
-        case 3:
-            var _v: TSP_Color?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Color(ProtobufMessage(_b)) }
-            if let _v { color = _v }
-        case 4:
-            var _v: TSP_Color?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Color(ProtobufMessage(_b)) }
-            if let _v { oldColor = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = annotationAuthor { _w.bytesField(2, _x.encoded()) }
-        if let _x = color { _w.bytesField(3, _x.encoded()) }
-        if let _x = oldColor { _w.bytesField(4, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var `super`: TSK_CommandArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var annotationAuthor: TSP_Reference? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var color: TSP_Color? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var oldColor: TSP_Color? { get { self[message: 3] } set { self[message: 3] = newValue } }
 }
 
 /// Generated wire model for `TSCK.SetActivityAuthorShareParticipantIDCommandArchive`.
 final class TSCK_SetActivityAuthorShareParticipantIDCommandArchive: IWAMessage {
-    var `super`: TSK_CommandArchive?
-    var activityAuthor: TSP_Reference?
-    var shareParticipantId: String?
-    var oldShareParticipantId: String?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSCK.SetActivityAuthorShareParticipantIDCommandArchive", [
+        .optional(1, TSK_CommandArchive.self), .optional(2, TSP_Reference.self), .optional(3, .string),
+        .optional(4, .string),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSK_CommandArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_CommandArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { activityAuthor = _v }
-        case 3:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { shareParticipantId = _v }
-        case 4:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { oldShareParticipantId = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = activityAuthor { _w.bytesField(2, _x.encoded()) }
-        if let _x = shareParticipantId { _w.stringField(3, _x) }
-        if let _x = oldShareParticipantId { _w.stringField(4, _x) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var `super`: TSK_CommandArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var activityAuthor: TSP_Reference? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var shareParticipantId: String? { get { self[2] } set { self[2] = newValue } }
+    var oldShareParticipantId: String? { get { self[3] } set { self[3] = newValue } }
 }
 
 /// Generated wire model for `TSCK.IdOperationArgs`.
 final class TSCK_IdOperationArgs: IWAMessage {
-    var idPath: TSP_UUIDPath?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSCK.IdOperationArgs", [
+        .optional(1, TSP_UUIDPath.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_UUIDPath?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUIDPath(ProtobufMessage(_b)) }
-            if let _v { idPath = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = idPath { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var idPath: TSP_UUIDPath? { get { self[message: 0] } set { self[message: 0] = newValue } }
 }
 
 /// Generated wire model for `TSCK.AddIdOperationArgs`.
 final class TSCK_AddIdOperationArgs: IWAMessage {
-    var `super`: TSCK_IdOperationArgs?
-    var index: Int32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSCK.AddIdOperationArgs", [
+        .optional(1, TSCK_IdOperationArgs.self), .optional(2, .int32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSCK_IdOperationArgs?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCK_IdOperationArgs(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { index = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = index { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var `super`: TSCK_IdOperationArgs? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var index: Int32? { get { self[1] } set { self[1] = newValue } }
 }
 
 /// Generated wire model for `TSCK.RemoveIdOperationArgs`.
 final class TSCK_RemoveIdOperationArgs: IWAMessage {
-    var `super`: TSCK_IdOperationArgs?
-    var index: Int32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSCK.RemoveIdOperationArgs", [
+        .optional(1, TSCK_IdOperationArgs.self), .optional(2, .int32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSCK_IdOperationArgs?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCK_IdOperationArgs(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { index = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = index { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var `super`: TSCK_IdOperationArgs? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var index: Int32? { get { self[1] } set { self[1] = newValue } }
 }
 
 /// Generated wire model for `TSCK.RearrangeIdOperationArgs`.
 final class TSCK_RearrangeIdOperationArgs: IWAMessage {
-    var `super`: TSCK_IdOperationArgs?
-    var fromIndex: Int32?
-    var toIndex: Int32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSCK.RearrangeIdOperationArgs", [
+        .optional(1, TSCK_IdOperationArgs.self), .optional(2, .int32), .optional(3, .int32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSCK_IdOperationArgs?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCK_IdOperationArgs(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { fromIndex = _v }
-        case 3:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { toIndex = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = fromIndex { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = toIndex { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var `super`: TSCK_IdOperationArgs? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var fromIndex: Int32? { get { self[1] } set { self[1] = newValue } }
+    var toIndex: Int32? { get { self[2] } set { self[2] = newValue } }
 }
 
 /// Generated wire model for `TSCK.IdPlacementOperationArgs`.
 final class TSCK_IdPlacementOperationArgs: IWAMessage {
-    var `super`: TSCK_IdOperationArgs?
-    var fromIndex: Int32?
-    var toIndex: Int32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSCK.IdPlacementOperationArgs", [
+        .optional(1, TSCK_IdOperationArgs.self), .optional(2, .int32), .optional(3, .int32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSCK_IdOperationArgs?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCK_IdOperationArgs(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { fromIndex = _v }
-        case 3:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { toIndex = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = fromIndex { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = toIndex { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var `super`: TSCK_IdOperationArgs? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var fromIndex: Int32? { get { self[1] } set { self[1] = newValue } }
+    var toIndex: Int32? { get { self[2] } set { self[2] = newValue } }
 }
 
 /// Generated wire model for `TSCK.ActivityCommitCommandArchive`.
 final class TSCK_ActivityCommitCommandArchive: IWAMessage {
-    var `super`: TSK_CommandArchive?
-    var activity: TSP_Reference?
-    var author: TSP_Reference?
-    var wasActivityCommitted: Bool?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSCK.ActivityCommitCommandArchive", [
+        .optional(1, TSK_CommandArchive.self), .optional(2, TSP_Reference.self), .optional(3, TSP_Reference.self),
+        .optional(4, .bool),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSK_CommandArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_CommandArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { activity = _v }
-        case 3:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { author = _v }
-        case 4:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { wasActivityCommitted = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = activity { _w.bytesField(2, _x.encoded()) }
-        if let _x = author { _w.bytesField(3, _x.encoded()) }
-        if let _x = wasActivityCommitted { _w.varintField(4, _x ? 1 : 0) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var `super`: TSK_CommandArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var activity: TSP_Reference? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var author: TSP_Reference? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var wasActivityCommitted: Bool? { get { self[3] } set { self[3] = newValue } }
 }
 
 /// Generated wire model for `TSCK.ExecuteTestBetweenRollbackAndReapplyCommandArchive`.
 final class TSCK_ExecuteTestBetweenRollbackAndReapplyCommandArchive: IWAMessage {
-    var `super`: TSK_CommandArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSCK.ExecuteTestBetweenRollbackAndReapplyCommandArchive", [
+        .optional(1, TSK_CommandArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSK_CommandArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_CommandArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var `super`: TSK_CommandArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
 }
 
 /// Generated wire model for `TSCK.CreateLocalStorageSnapshotCommandArchive`.
 final class TSCK_CreateLocalStorageSnapshotCommandArchive: IWAMessage {
-    var `super`: TSK_CommandArchive?
-    var snapshotId: String?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSCK.CreateLocalStorageSnapshotCommandArchive", [
+        .optional(1, TSK_CommandArchive.self), .optional(2, .string),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSK_CommandArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_CommandArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { snapshotId = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = snapshotId { _w.stringField(2, _x) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var `super`: TSK_CommandArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var snapshotId: String? { get { self[1] } set { self[1] = newValue } }
 }
 
 /// Generated wire model for `TSCK.BlockDiffsAtCurrentRevisionCommand`.
 final class TSCK_BlockDiffsAtCurrentRevisionCommand: IWAMessage {
-    var `super`: TSK_CommandArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSCK.BlockDiffsAtCurrentRevisionCommand", [
+        .optional(1, TSK_CommandArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSK_CommandArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_CommandArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var `super`: TSK_CommandArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
 }
 
 /// Generated wire model for `TSCK.TransformerEntry`.
 final class TSCK_TransformerEntry: IWAMessage {
-    var sequence: UInt64?
-    var creationTime: Double?
-    var transformer: TSK_OperationTransformer?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSCK.TransformerEntry", [
+        .optional(1, .uint64), .optional(2, .double), .optional(3, TSK_OperationTransformer.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt64?
-            if case .varint(let _u) = _f.value { _v = UInt64(truncatingIfNeeded: _u) }
-            if let _v { sequence = _v }
-        case 2:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { creationTime = _v }
-        case 3:
-            var _v: TSK_OperationTransformer?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_OperationTransformer(ProtobufMessage(_b)) }
-            if let _v { transformer = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = sequence { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = creationTime { _w.fixed64Field(2, _x.bitPattern) }
-        if let _x = transformer { _w.bytesField(3, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var sequence: UInt64? { get { self[0] } set { self[0] = newValue } }
+    var creationTime: Double? { get { self[1] } set { self[1] = newValue } }
+    var transformer: TSK_OperationTransformer? { get { self[message: 2] } set { self[message: 2] = newValue } }
 }
 
 /// Generated wire model for `TSCK.CollaborationAppliedCommandDocumentRevisionMapping`.
 final class TSCK_CollaborationAppliedCommandDocumentRevisionMapping: IWAMessage {
-    var command: TSP_Reference?
-    var documentRevisionIdentifier: TSP_UUID?
-    var documentRevisionSequence: Int32?
-    var remainingCommandOperations: [TSK_Operation] = []
-    var timestamp: TSP_Date?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSCK.CollaborationAppliedCommandDocumentRevisionMapping", [
+        .optional(1, TSP_Reference.self), .optional(2, TSP_UUID.self), .optional(3, .int32),
+        .repeated(4, TSK_Operation.self), .optional(5, TSP_Date.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 5)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { command = _v }
-        case 2:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { documentRevisionIdentifier = _v }
-        case 3:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { documentRevisionSequence = _v }
-        case 4:
-            var _v: TSK_Operation?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_Operation(ProtobufMessage(_b)) }
-            if let _v { remainingCommandOperations.append(_v) }
-        case 5:
-            var _v: TSP_Date?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Date(ProtobufMessage(_b)) }
-            if let _v { timestamp = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = command { _w.bytesField(1, _x.encoded()) }
-        if let _x = documentRevisionIdentifier { _w.bytesField(2, _x.encoded()) }
-        if let _x = documentRevisionSequence { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        for _x in remainingCommandOperations { _w.bytesField(4, _x.encoded()) }
-        if let _x = timestamp { _w.bytesField(5, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var command: TSP_Reference? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var documentRevisionIdentifier: TSP_UUID? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var documentRevisionSequence: Int32? { get { self[2] } set { self[2] = newValue } }
+    var remainingCommandOperations: [TSK_Operation] { get { self[messages: 3] } set { self[messages: 3] = newValue } }
+    func append(remainingCommandOperations value: TSK_Operation) { append(value, toMessages: 3) }
+    var timestamp: TSP_Date? { get { self[message: 4] } set { self[message: 4] = newValue } }
 }
 
 /// Generated wire model for `TSCK.CollaborationDocumentSessionState`.
 final class TSCK_CollaborationDocumentSessionState: IWAMessage {
-    var collaboratorIds: [String] = []
-    var rsvpCommandQueueItems: [TSP_Reference] = []
-    var collaboratorCursorTransformerEntries: [TSP_Reference] = []
-    var acknowledgedCommandsPendingResumeProcessDiffs: [TSP_Reference] = []
-    var unprocessedCommandsPendingResumeProcessDiffs: [TSP_Reference] = []
-    var commandAcknowledgementObserverEntries: [TSCK_CollaborationDocumentSessionState_AcknowledgementObserverEntry] = []
-    var transformerFromUnprocessedCommandOperationsEntries: [TSP_Reference] = []
-    var mailboxRequestDocumentRevisionSequence: Int32?
-    var mailboxRequestDocumentRevisionIdentifier: TSP_UUID?
-    var lastSendPendingCommandQueueItemWasMovedFromRsvpCommandQueue: Bool?
-    var lastCommandSendMarkerSequence: Int32?
-    var lastCommandSendMarkerIdentifier: TSP_UUID?
-    var skippedAcknowledgedCommandsPendingResumeProcessDiffs: [TSP_Reference] = []
-    var lastTooOldCommandIdentifier: TSP_UUID?
-    var unprocessedOperationEntriesPendingResumeProcessDiffs: TSP_Reference?
-    var sendPendingCommandQueue: TSP_Reference?
-    var countOfSendPendingCommandQueueItemsMovedFromRsvpQueue: UInt64?
-    var lastEnqueuedDocumentLoadCommandIdentifier: TSP_UUID?
-    var appliedCommandDocumentRevisionMappingsToNotifyPendingResumeProcessDiffs: [TSCK_CollaborationAppliedCommandDocumentRevisionMapping] = []
-    var countOfCommandQueueItemsInLastOutgoingCommandGroup: UInt64?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { collaboratorIds.append(_v) }
-        case 3:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { rsvpCommandQueueItems.append(_v) }
-        case 4:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { collaboratorCursorTransformerEntries.append(_v) }
-        case 5:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { acknowledgedCommandsPendingResumeProcessDiffs.append(_v) }
-        case 6:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { unprocessedCommandsPendingResumeProcessDiffs.append(_v) }
-        case 7:
-            var _v: TSCK_CollaborationDocumentSessionState_AcknowledgementObserverEntry?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCK_CollaborationDocumentSessionState_AcknowledgementObserverEntry(ProtobufMessage(_b)) }
-            if let _v { commandAcknowledgementObserverEntries.append(_v) }
-        case 8:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { transformerFromUnprocessedCommandOperationsEntries.append(_v) }
-        case 10:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { mailboxRequestDocumentRevisionSequence = _v }
-        case 11:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { mailboxRequestDocumentRevisionIdentifier = _v }
-        case 12:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { lastSendPendingCommandQueueItemWasMovedFromRsvpCommandQueue = _v }
-        case 13:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { lastCommandSendMarkerSequence = _v }
-        case 14:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { lastCommandSendMarkerIdentifier = _v }
-        case 15:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { skippedAcknowledgedCommandsPendingResumeProcessDiffs.append(_v) }
-        case 16:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { lastTooOldCommandIdentifier = _v }
-        case 17:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { unprocessedOperationEntriesPendingResumeProcessDiffs = _v }
-        case 18:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { sendPendingCommandQueue = _v }
-        case 19:
-            var _v: UInt64?
-            if case .varint(let _u) = _f.value { _v = UInt64(truncatingIfNeeded: _u) }
-            if let _v { countOfSendPendingCommandQueueItemsMovedFromRsvpQueue = _v }
-        case 20:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { lastEnqueuedDocumentLoadCommandIdentifier = _v }
-        case 21:
-            var _v: TSCK_CollaborationAppliedCommandDocumentRevisionMapping?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCK_CollaborationAppliedCommandDocumentRevisionMapping(ProtobufMessage(_b)) }
-            if let _v { appliedCommandDocumentRevisionMappingsToNotifyPendingResumeProcessDiffs.append(_v) }
-        case 22:
-            var _v: UInt64?
-            if case .varint(let _u) = _f.value { _v = UInt64(truncatingIfNeeded: _u) }
-            if let _v { countOfCommandQueueItemsInLastOutgoingCommandGroup = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in collaboratorIds { _w.stringField(1, _x) }
-        for _x in rsvpCommandQueueItems { _w.bytesField(3, _x.encoded()) }
-        for _x in collaboratorCursorTransformerEntries { _w.bytesField(4, _x.encoded()) }
-        for _x in acknowledgedCommandsPendingResumeProcessDiffs { _w.bytesField(5, _x.encoded()) }
-        for _x in unprocessedCommandsPendingResumeProcessDiffs { _w.bytesField(6, _x.encoded()) }
-        for _x in commandAcknowledgementObserverEntries { _w.bytesField(7, _x.encoded()) }
-        for _x in transformerFromUnprocessedCommandOperationsEntries { _w.bytesField(8, _x.encoded()) }
-        if let _x = mailboxRequestDocumentRevisionSequence { _w.varintField(10, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = mailboxRequestDocumentRevisionIdentifier { _w.bytesField(11, _x.encoded()) }
-        if let _x = lastSendPendingCommandQueueItemWasMovedFromRsvpCommandQueue { _w.varintField(12, _x ? 1 : 0) }
-        if let _x = lastCommandSendMarkerSequence { _w.varintField(13, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = lastCommandSendMarkerIdentifier { _w.bytesField(14, _x.encoded()) }
-        for _x in skippedAcknowledgedCommandsPendingResumeProcessDiffs { _w.bytesField(15, _x.encoded()) }
-        if let _x = lastTooOldCommandIdentifier { _w.bytesField(16, _x.encoded()) }
-        if let _x = unprocessedOperationEntriesPendingResumeProcessDiffs { _w.bytesField(17, _x.encoded()) }
-        if let _x = sendPendingCommandQueue { _w.bytesField(18, _x.encoded()) }
-        if let _x = countOfSendPendingCommandQueueItemsMovedFromRsvpQueue { _w.varintField(19, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = lastEnqueuedDocumentLoadCommandIdentifier { _w.bytesField(20, _x.encoded()) }
-        for _x in appliedCommandDocumentRevisionMappingsToNotifyPendingResumeProcessDiffs { _w.bytesField(21, _x.encoded()) }
-        if let _x = countOfCommandQueueItemsInLastOutgoingCommandGroup { _w.varintField(22, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCK.CollaborationDocumentSessionState", [
+        .repeated(1, .string), .repeated(3, TSP_Reference.self), .repeated(4, TSP_Reference.self),
+        .repeated(5, TSP_Reference.self), .repeated(6, TSP_Reference.self),
+        .repeated(7, TSCK_CollaborationDocumentSessionState_AcknowledgementObserverEntry.self),
+        .repeated(8, TSP_Reference.self), .optional(10, .int32), .optional(11, TSP_UUID.self), .optional(12, .bool),
+        .optional(13, .int32), .optional(14, TSP_UUID.self), .repeated(15, TSP_Reference.self),
+        .optional(16, TSP_UUID.self), .optional(17, TSP_Reference.self), .optional(18, TSP_Reference.self),
+        .optional(19, .uint64), .optional(20, TSP_UUID.self),
+        .repeated(21, TSCK_CollaborationAppliedCommandDocumentRevisionMapping.self), .optional(22, .uint64),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 20)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var collaboratorIds: [String] { get { self[all: 0] } set { self[all: 0] = newValue } }
+    func append(collaboratorIds value: String) { append(value, toAll: 0) }
+    var rsvpCommandQueueItems: [TSP_Reference] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(rsvpCommandQueueItems value: TSP_Reference) { append(value, toMessages: 1) }
+    var collaboratorCursorTransformerEntries: [TSP_Reference] { get { self[messages: 2] } set { self[messages: 2] = newValue } }
+    func append(collaboratorCursorTransformerEntries value: TSP_Reference) { append(value, toMessages: 2) }
+    var acknowledgedCommandsPendingResumeProcessDiffs: [TSP_Reference] { get { self[messages: 3] } set { self[messages: 3] = newValue } }
+    func append(acknowledgedCommandsPendingResumeProcessDiffs value: TSP_Reference) { append(value, toMessages: 3) }
+    var unprocessedCommandsPendingResumeProcessDiffs: [TSP_Reference] { get { self[messages: 4] } set { self[messages: 4] = newValue } }
+    func append(unprocessedCommandsPendingResumeProcessDiffs value: TSP_Reference) { append(value, toMessages: 4) }
+    var commandAcknowledgementObserverEntries: [TSCK_CollaborationDocumentSessionState_AcknowledgementObserverEntry] { get { self[messages: 5] } set { self[messages: 5] = newValue } }
+    func append(commandAcknowledgementObserverEntries value: TSCK_CollaborationDocumentSessionState_AcknowledgementObserverEntry) { append(value, toMessages: 5) }
+    var transformerFromUnprocessedCommandOperationsEntries: [TSP_Reference] { get { self[messages: 6] } set { self[messages: 6] = newValue } }
+    func append(transformerFromUnprocessedCommandOperationsEntries value: TSP_Reference) { append(value, toMessages: 6) }
+    var mailboxRequestDocumentRevisionSequence: Int32? { get { self[7] } set { self[7] = newValue } }
+    var mailboxRequestDocumentRevisionIdentifier: TSP_UUID? { get { self[message: 8] } set { self[message: 8] = newValue } }
+    var lastSendPendingCommandQueueItemWasMovedFromRsvpCommandQueue: Bool? { get { self[9] } set { self[9] = newValue } }
+    var lastCommandSendMarkerSequence: Int32? { get { self[10] } set { self[10] = newValue } }
+    var lastCommandSendMarkerIdentifier: TSP_UUID? { get { self[message: 11] } set { self[message: 11] = newValue } }
+    var skippedAcknowledgedCommandsPendingResumeProcessDiffs: [TSP_Reference] { get { self[messages: 12] } set { self[messages: 12] = newValue } }
+    func append(skippedAcknowledgedCommandsPendingResumeProcessDiffs value: TSP_Reference) { append(value, toMessages: 12) }
+    var lastTooOldCommandIdentifier: TSP_UUID? { get { self[message: 13] } set { self[message: 13] = newValue } }
+    var unprocessedOperationEntriesPendingResumeProcessDiffs: TSP_Reference? { get { self[message: 14] } set { self[message: 14] = newValue } }
+    var sendPendingCommandQueue: TSP_Reference? { get { self[message: 15] } set { self[message: 15] = newValue } }
+    var countOfSendPendingCommandQueueItemsMovedFromRsvpQueue: UInt64? { get { self[16] } set { self[16] = newValue } }
+    var lastEnqueuedDocumentLoadCommandIdentifier: TSP_UUID? { get { self[message: 17] } set { self[message: 17] = newValue } }
+    var appliedCommandDocumentRevisionMappingsToNotifyPendingResumeProcessDiffs: [TSCK_CollaborationAppliedCommandDocumentRevisionMapping] { get { self[messages: 18] } set { self[messages: 18] = newValue } }
+    func append(appliedCommandDocumentRevisionMappingsToNotifyPendingResumeProcessDiffs value: TSCK_CollaborationAppliedCommandDocumentRevisionMapping) { append(value, toMessages: 18) }
+    var countOfCommandQueueItemsInLastOutgoingCommandGroup: UInt64? { get { self[19] } set { self[19] = newValue } }
 }
 
 /// Generated wire model for `TSCK.CollaborationDocumentSessionState.AcknowledgementObserverEntry`.
 final class TSCK_CollaborationDocumentSessionState_AcknowledgementObserverEntry: IWAMessage {
-    var commandIdentifier: TSP_UUID?
-    var acknowledgementObservers: [TSP_Reference] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSCK.CollaborationDocumentSessionState.AcknowledgementObserverEntry", [
+        .optional(1, TSP_UUID.self), .repeated(2, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { commandIdentifier = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { acknowledgementObservers.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = commandIdentifier { _w.bytesField(1, _x.encoded()) }
-        for _x in acknowledgementObservers { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var commandIdentifier: TSP_UUID? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var acknowledgementObservers: [TSP_Reference] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(acknowledgementObservers value: TSP_Reference) { append(value, toMessages: 1) }
 }
 
 /// Generated wire model for `TSCK.OperationStorageEntryArray`.
 final class TSCK_OperationStorageEntryArray: IWAMessage {
-    var largeArray: TSP_LargeArray?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSCK.OperationStorageEntryArray", [
+        .optional(1, TSP_LargeArray.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_LargeArray?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_LargeArray(ProtobufMessage(_b)) }
-            if let _v { largeArray = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = largeArray { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var largeArray: TSP_LargeArray? { get { self[message: 0] } set { self[message: 0] = newValue } }
 }
 
 /// Generated wire model for `TSCK.OperationStorageEntryArraySegment`.
 final class TSCK_OperationStorageEntryArraySegment: IWAMessage {
-    var largeArraySegment: TSP_LargeArraySegment?
-    var elements: [TSK_OperationStorageEntry] = []
-    var lastDocumentRevisionSequenceBeforeSegment: Int32?
-    var lastDocumentRevisionSequence: Int32?
-    var segmentFirstEntryCreationTime: Double?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSCK.OperationStorageEntryArraySegment", [
+        .optional(1, TSP_LargeArraySegment.self), .repeated(2, TSK_OperationStorageEntry.self), .optional(3, .int32),
+        .optional(4, .int32), .optional(5, .double),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 5)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_LargeArraySegment?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_LargeArraySegment(ProtobufMessage(_b)) }
-            if let _v { largeArraySegment = _v }
-        case 2:
-            var _v: TSK_OperationStorageEntry?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_OperationStorageEntry(ProtobufMessage(_b)) }
-            if let _v { elements.append(_v) }
-        case 3:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { lastDocumentRevisionSequenceBeforeSegment = _v }
-        case 4:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { lastDocumentRevisionSequence = _v }
-        case 5:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { segmentFirstEntryCreationTime = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = largeArraySegment { _w.bytesField(1, _x.encoded()) }
-        for _x in elements { _w.bytesField(2, _x.encoded()) }
-        if let _x = lastDocumentRevisionSequenceBeforeSegment { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = lastDocumentRevisionSequence { _w.varintField(4, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = segmentFirstEntryCreationTime { _w.fixed64Field(5, _x.bitPattern) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var largeArraySegment: TSP_LargeArraySegment? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var elements: [TSK_OperationStorageEntry] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(elements value: TSK_OperationStorageEntry) { append(value, toMessages: 1) }
+    var lastDocumentRevisionSequenceBeforeSegment: Int32? { get { self[2] } set { self[2] = newValue } }
+    var lastDocumentRevisionSequence: Int32? { get { self[3] } set { self[3] = newValue } }
+    var segmentFirstEntryCreationTime: Double? { get { self[4] } set { self[4] = newValue } }
 }
 
 /// Generated wire model for `TSCK.OperationStorage`.
 final class TSCK_OperationStorage: IWAMessage {
-    var entries: TSP_Reference?
-    var operationCount: UInt64?
-    var lastDocumentRevisionSequence: Int32?
-    var lastDocumentRevisionIdentifier: [UInt64] = []
-    var lastUnskippableDocumentRevisionBeforeEntriesSequence: Int32?
-    var lastUnskippableDocumentRevisionBeforeEntriesIdentifier: [UInt64] = []
-    var lastUnskippableDocumentRevisionInEntriesSequence: Int32?
-    var lastUnskippableDocumentRevisionInEntriesIdentifier: [UInt64] = []
-    var daysWithAnEntry: TSP_IndexSet?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSCK.OperationStorage", [
+        .optional(1, TSP_Reference.self), .optional(2, .uint64), .optional(3, .int32), .repeated(4, .fixed64),
+        .optional(5, .int32), .repeated(6, .fixed64), .optional(7, .int32), .repeated(8, .fixed64),
+        .optional(9, TSP_IndexSet.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 9)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { entries = _v }
-        case 2:
-            var _v: UInt64?
-            if case .varint(let _u) = _f.value { _v = UInt64(truncatingIfNeeded: _u) }
-            if let _v { operationCount = _v }
-        case 3:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { lastDocumentRevisionSequence = _v }
-        case 4:
-            var _v: UInt64?
-            if case .fixed64(let _b) = _f.value { _v = IWAWire.u64(_b) }
-            if let _v { lastDocumentRevisionIdentifier.append(_v) }
-        case 5:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { lastUnskippableDocumentRevisionBeforeEntriesSequence = _v }
-        case 6:
-            var _v: UInt64?
-            if case .fixed64(let _b) = _f.value { _v = IWAWire.u64(_b) }
-            if let _v { lastUnskippableDocumentRevisionBeforeEntriesIdentifier.append(_v) }
-        case 7:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { lastUnskippableDocumentRevisionInEntriesSequence = _v }
-        case 8:
-            var _v: UInt64?
-            if case .fixed64(let _b) = _f.value { _v = IWAWire.u64(_b) }
-            if let _v { lastUnskippableDocumentRevisionInEntriesIdentifier.append(_v) }
-        case 9:
-            var _v: TSP_IndexSet?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_IndexSet(ProtobufMessage(_b)) }
-            if let _v { daysWithAnEntry = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = entries { _w.bytesField(1, _x.encoded()) }
-        if let _x = operationCount { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = lastDocumentRevisionSequence { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        for _x in lastDocumentRevisionIdentifier { _w.fixed64Field(4, _x) }
-        if let _x = lastUnskippableDocumentRevisionBeforeEntriesSequence { _w.varintField(5, UInt64(truncatingIfNeeded: _x)) }
-        for _x in lastUnskippableDocumentRevisionBeforeEntriesIdentifier { _w.fixed64Field(6, _x) }
-        if let _x = lastUnskippableDocumentRevisionInEntriesSequence { _w.varintField(7, UInt64(truncatingIfNeeded: _x)) }
-        for _x in lastUnskippableDocumentRevisionInEntriesIdentifier { _w.fixed64Field(8, _x) }
-        if let _x = daysWithAnEntry { _w.bytesField(9, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var entries: TSP_Reference? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var operationCount: UInt64? { get { self[1] } set { self[1] = newValue } }
+    var lastDocumentRevisionSequence: Int32? { get { self[2] } set { self[2] = newValue } }
+    var lastDocumentRevisionIdentifier: [UInt64] { get { self[all: 3] } set { self[all: 3] = newValue } }
+    func append(lastDocumentRevisionIdentifier value: UInt64) { append(value, toAll: 3) }
+    var lastUnskippableDocumentRevisionBeforeEntriesSequence: Int32? { get { self[4] } set { self[4] = newValue } }
+    var lastUnskippableDocumentRevisionBeforeEntriesIdentifier: [UInt64] { get { self[all: 5] } set { self[all: 5] = newValue } }
+    func append(lastUnskippableDocumentRevisionBeforeEntriesIdentifier value: UInt64) { append(value, toAll: 5) }
+    var lastUnskippableDocumentRevisionInEntriesSequence: Int32? { get { self[6] } set { self[6] = newValue } }
+    var lastUnskippableDocumentRevisionInEntriesIdentifier: [UInt64] { get { self[all: 7] } set { self[all: 7] = newValue } }
+    func append(lastUnskippableDocumentRevisionInEntriesIdentifier value: UInt64) { append(value, toAll: 7) }
+    var daysWithAnEntry: TSP_IndexSet? { get { self[message: 8] } set { self[message: 8] = newValue } }
 }
 
 /// Generated wire model for `TSCK.OutgoingCommandQueue`.
 final class TSCK_OutgoingCommandQueue: IWAMessage {
-    var largeObjectArray: TSP_LargeObjectArray?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSCK.OutgoingCommandQueue", [
+        .optional(1, TSP_LargeObjectArray.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_LargeObjectArray?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_LargeObjectArray(ProtobufMessage(_b)) }
-            if let _v { largeObjectArray = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = largeObjectArray { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var largeObjectArray: TSP_LargeObjectArray? { get { self[message: 0] } set { self[message: 0] = newValue } }
 }
 
 /// Generated wire model for `TSCK.OutgoingCommandQueueSegment`.
 final class TSCK_OutgoingCommandQueueSegment: IWAMessage {
-    var largeObjectArraySegment: TSP_LargeObjectArraySegment?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSCK.OutgoingCommandQueueSegment", [
+        .optional(1, TSP_LargeObjectArraySegment.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_LargeObjectArraySegment?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_LargeObjectArraySegment(ProtobufMessage(_b)) }
-            if let _v { largeObjectArraySegment = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = largeObjectArraySegment { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var largeObjectArraySegment: TSP_LargeObjectArraySegment? { get { self[message: 0] } set { self[message: 0] = newValue } }
 }
 
 /// Generated wire model for `TSCK.CommandAssetChunkArchive`.
 final class TSCK_CommandAssetChunkArchive: IWAMessage {
-    var `super`: TSK_CommandArchive?
-    var digest: String?
-    var assetChunk: String?
-    var assetChunkLength: Int64?
-    var resumePosition: Int64?
-    var materializedLength: Int64?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSCK.CommandAssetChunkArchive", [
+        .optional(1, TSK_CommandArchive.self), .optional(2, .string), .optional(3, .string), .optional(4, .int64),
+        .optional(5, .int64), .optional(6, .int64),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 6)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSK_CommandArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_CommandArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { digest = _v }
-        case 3:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { assetChunk = _v }
-        case 4:
-            var _v: Int64?
-            if case .varint(let _u) = _f.value { _v = Int64(truncatingIfNeeded: _u) }
-            if let _v { assetChunkLength = _v }
-        case 5:
-            var _v: Int64?
-            if case .varint(let _u) = _f.value { _v = Int64(truncatingIfNeeded: _u) }
-            if let _v { resumePosition = _v }
-        case 6:
-            var _v: Int64?
-            if case .varint(let _u) = _f.value { _v = Int64(truncatingIfNeeded: _u) }
-            if let _v { materializedLength = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = digest { _w.stringField(2, _x) }
-        if let _x = assetChunk { _w.stringField(3, _x) }
-        if let _x = assetChunkLength { _w.varintField(4, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = resumePosition { _w.varintField(5, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = materializedLength { _w.varintField(6, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var `super`: TSK_CommandArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var digest: String? { get { self[1] } set { self[1] = newValue } }
+    var assetChunk: String? { get { self[2] } set { self[2] = newValue } }
+    var assetChunkLength: Int64? { get { self[3] } set { self[3] = newValue } }
+    var resumePosition: Int64? { get { self[4] } set { self[4] = newValue } }
+    var materializedLength: Int64? { get { self[5] } set { self[5] = newValue } }
 }
 
 /// Generated wire model for `TSCK.AssetUploadStatusCommandArchive`.
 final class TSCK_AssetUploadStatusCommandArchive: IWAMessage {
-    var `super`: TSK_CommandArchive?
-    var infoList: [TSCK_AssetUploadStatusCommandArchive_AssetUploadStatusInfo] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSCK.AssetUploadStatusCommandArchive", [
+        .optional(1, TSK_CommandArchive.self),
+        .repeated(2, TSCK_AssetUploadStatusCommandArchive_AssetUploadStatusInfo.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSK_CommandArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_CommandArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: TSCK_AssetUploadStatusCommandArchive_AssetUploadStatusInfo?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCK_AssetUploadStatusCommandArchive_AssetUploadStatusInfo(ProtobufMessage(_b)) }
-            if let _v { infoList.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        for _x in infoList { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var `super`: TSK_CommandArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var infoList: [TSCK_AssetUploadStatusCommandArchive_AssetUploadStatusInfo] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(infoList value: TSCK_AssetUploadStatusCommandArchive_AssetUploadStatusInfo) { append(value, toMessages: 1) }
 }
 
 /// Generated wire model for `TSCK.AssetUploadStatusCommandArchive.AssetUploadStatusInfo`.
 final class TSCK_AssetUploadStatusCommandArchive_AssetUploadStatusInfo: IWAMessage {
-    var digest: String?
-    var uploadStatus: Int32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSCK.AssetUploadStatusCommandArchive.AssetUploadStatusInfo", [
+        .optional(1, .string), .optional(2, .int32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { digest = _v }
-        case 2:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { uploadStatus = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = digest { _w.stringField(1, _x) }
-        if let _x = uploadStatus { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var digest: String? { get { self[0] } set { self[0] = newValue } }
+    var uploadStatus: Int32? { get { self[1] } set { self[1] = newValue } }
 }
 
 /// Generated wire model for `TSCK.AssetUnmaterializedOnServerCommandArchive`.
 final class TSCK_AssetUnmaterializedOnServerCommandArchive: IWAMessage {
-    var `super`: TSK_CommandArchive?
-    var digestList: [String] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSCK.AssetUnmaterializedOnServerCommandArchive", [
+        .optional(1, TSK_CommandArchive.self), .repeated(2, .string),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSK_CommandArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_CommandArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { digestList.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        for _x in digestList { _w.stringField(2, _x) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var `super`: TSK_CommandArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var digestList: [String] { get { self[all: 1] } set { self[all: 1] = newValue } }
+    func append(digestList value: String) { append(value, toAll: 1) }
 }
 
 /// Generated wire model for `TSCK.CollaboratorCursorArchive`.
 final class TSCK_CollaboratorCursorArchive: IWAMessage {
-    var idPath: TSP_UUIDPath?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSCK.CollaboratorCursorArchive", [
+        .optional(1, TSP_UUIDPath.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_UUIDPath?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUIDPath(ProtobufMessage(_b)) }
-            if let _v { idPath = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = idPath { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var idPath: TSP_UUIDPath? { get { self[message: 0] } set { self[message: 0] = newValue } }
 }
 
 /// Generated wire model for `TSCK.ActivityStreamArchive`.
 final class TSCK_ActivityStreamArchive: IWAMessage {
-    var acknowledgedActivityArray: TSP_Reference?
-    var unacknowledgedLocalActivityArray: TSP_Reference?
-    var authorCache: TSP_Reference?
-    var unacknowledgedRemoteActivityArray: TSP_Reference?
-    var didUpgradeCommentsToActivities: Bool?
-    var activityStreamTransformationState: TSCK_ActivityStreamTransformationStateArchive?
-    var activityCounter: TSCK_ActivityStreamActivityCounterArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSCK.ActivityStreamArchive", [
+        .optional(1, TSP_Reference.self), .optional(2, TSP_Reference.self), .optional(3, TSP_Reference.self),
+        .optional(5, TSP_Reference.self), .optional(6, .bool),
+        .optional(15, TSCK_ActivityStreamTransformationStateArchive.self),
+        .optional(16, TSCK_ActivityStreamActivityCounterArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 7)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { acknowledgedActivityArray = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { unacknowledgedLocalActivityArray = _v }
-        case 3:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { authorCache = _v }
-        case 5:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { unacknowledgedRemoteActivityArray = _v }
-        case 6:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { didUpgradeCommentsToActivities = _v }
-        case 15:
-            var _v: TSCK_ActivityStreamTransformationStateArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCK_ActivityStreamTransformationStateArchive(ProtobufMessage(_b)) }
-            if let _v { activityStreamTransformationState = _v }
-        case 16:
-            var _v: TSCK_ActivityStreamActivityCounterArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCK_ActivityStreamActivityCounterArchive(ProtobufMessage(_b)) }
-            if let _v { activityCounter = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = acknowledgedActivityArray { _w.bytesField(1, _x.encoded()) }
-        if let _x = unacknowledgedLocalActivityArray { _w.bytesField(2, _x.encoded()) }
-        if let _x = authorCache { _w.bytesField(3, _x.encoded()) }
-        if let _x = unacknowledgedRemoteActivityArray { _w.bytesField(5, _x.encoded()) }
-        if let _x = didUpgradeCommentsToActivities { _w.varintField(6, _x ? 1 : 0) }
-        if let _x = activityStreamTransformationState { _w.bytesField(15, _x.encoded()) }
-        if let _x = activityCounter { _w.bytesField(16, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var acknowledgedActivityArray: TSP_Reference? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var unacknowledgedLocalActivityArray: TSP_Reference? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var authorCache: TSP_Reference? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var unacknowledgedRemoteActivityArray: TSP_Reference? { get { self[message: 3] } set { self[message: 3] = newValue } }
+    var didUpgradeCommentsToActivities: Bool? { get { self[4] } set { self[4] = newValue } }
+    var activityStreamTransformationState: TSCK_ActivityStreamTransformationStateArchive? { get { self[message: 5] } set { self[message: 5] = newValue } }
+    var activityCounter: TSCK_ActivityStreamActivityCounterArchive? { get { self[message: 6] } set { self[message: 6] = newValue } }
 }
 
 /// Generated wire model for `TSCK.ActivityStreamActivityArray`.
 final class TSCK_ActivityStreamActivityArray: IWAMessage {
-    var largeArray: TSP_LargeObjectArray?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSCK.ActivityStreamActivityArray", [
+        .optional(1, TSP_LargeObjectArray.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_LargeObjectArray?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_LargeObjectArray(ProtobufMessage(_b)) }
-            if let _v { largeArray = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = largeArray { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var largeArray: TSP_LargeObjectArray? { get { self[message: 0] } set { self[message: 0] = newValue } }
 }
 
 /// Generated wire model for `TSCK.ActivityStreamActivityArraySegment`.
 final class TSCK_ActivityStreamActivityArraySegment: IWAMessage {
-    var largeArraySegment: TSP_LargeObjectArraySegment?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSCK.ActivityStreamActivityArraySegment", [
+        .optional(1, TSP_LargeObjectArraySegment.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_LargeObjectArraySegment?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_LargeObjectArraySegment(ProtobufMessage(_b)) }
-            if let _v { largeArraySegment = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = largeArraySegment { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var largeArraySegment: TSP_LargeObjectArraySegment? { get { self[message: 0] } set { self[message: 0] = newValue } }
 }
 
 /// Generated wire model for `TSCK.ActivityArchive`.
 final class TSCK_ActivityArchive: IWAMessage {
-    var cursorCollectionPersistenceWrappers: [TSP_Reference] = []
-    var authorIdentifier: TSP_UUID?
-    var nondirectionalActionType: Int32?
-    var direction: Int32?
-    var shouldSendNotification: Bool?
-    var timestamp: TSP_Date?
-    var revisionSequence: Int32?
-    var additionalNavigationInfo: TSCK_ActivityNavigationInfoArchive?
-    var didPrepareSerializedStringOnServer: Bool?
-    var oldestRevisionSequenceOfNextActivities: Int32?
-    var actionSubType: Int32?
-    var minUpdatableVersion: [UInt32] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { cursorCollectionPersistenceWrappers.append(_v) }
-        case 2:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { authorIdentifier = _v }
-        case 3:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { nondirectionalActionType = _v }
-        case 4:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { direction = _v }
-        case 5:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { shouldSendNotification = _v }
-        case 6:
-            var _v: TSP_Date?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Date(ProtobufMessage(_b)) }
-            if let _v { timestamp = _v }
-        case 7:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { revisionSequence = _v }
-        case 8:
-            var _v: TSCK_ActivityNavigationInfoArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCK_ActivityNavigationInfoArchive(ProtobufMessage(_b)) }
-            if let _v { additionalNavigationInfo = _v }
-        case 9:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { didPrepareSerializedStringOnServer = _v }
-        case 10:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { oldestRevisionSequenceOfNextActivities = _v }
-        case 11:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { actionSubType = _v }
-        case 12:
-            if case .varint(let _u) = _f.value { minUpdatableVersion.append(UInt32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { minUpdatableVersion.append(UInt32(truncatingIfNeeded: _u)) } }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in cursorCollectionPersistenceWrappers { _w.bytesField(1, _x.encoded()) }
-        if let _x = authorIdentifier { _w.bytesField(2, _x.encoded()) }
-        if let _x = nondirectionalActionType { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = direction { _w.varintField(4, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = shouldSendNotification { _w.varintField(5, _x ? 1 : 0) }
-        if let _x = timestamp { _w.bytesField(6, _x.encoded()) }
-        if let _x = revisionSequence { _w.varintField(7, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = additionalNavigationInfo { _w.bytesField(8, _x.encoded()) }
-        if let _x = didPrepareSerializedStringOnServer { _w.varintField(9, _x ? 1 : 0) }
-        if let _x = oldestRevisionSequenceOfNextActivities { _w.varintField(10, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = actionSubType { _w.varintField(11, UInt64(truncatingIfNeeded: _x)) }
-        if !minUpdatableVersion.isEmpty { _w.packedVarintField(12, minUpdatableVersion.map { UInt64(truncatingIfNeeded: $0) }) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCK.ActivityArchive", [
+        .repeated(1, TSP_Reference.self), .optional(2, TSP_UUID.self), .optional(3, .int32), .optional(4, .int32),
+        .optional(5, .bool), .optional(6, TSP_Date.self), .optional(7, .int32),
+        .optional(8, TSCK_ActivityNavigationInfoArchive.self), .optional(9, .bool), .optional(10, .int32),
+        .optional(11, .int32), .repeated(12, .uint32, packed: true),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 12)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var cursorCollectionPersistenceWrappers: [TSP_Reference] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(cursorCollectionPersistenceWrappers value: TSP_Reference) { append(value, toMessages: 0) }
+    var authorIdentifier: TSP_UUID? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var nondirectionalActionType: Int32? { get { self[2] } set { self[2] = newValue } }
+    var direction: Int32? { get { self[3] } set { self[3] = newValue } }
+    var shouldSendNotification: Bool? { get { self[4] } set { self[4] = newValue } }
+    var timestamp: TSP_Date? { get { self[message: 5] } set { self[message: 5] = newValue } }
+    var revisionSequence: Int32? { get { self[6] } set { self[6] = newValue } }
+    var additionalNavigationInfo: TSCK_ActivityNavigationInfoArchive? { get { self[message: 7] } set { self[message: 7] = newValue } }
+    var didPrepareSerializedStringOnServer: Bool? { get { self[8] } set { self[8] = newValue } }
+    var oldestRevisionSequenceOfNextActivities: Int32? { get { self[9] } set { self[9] = newValue } }
+    var actionSubType: Int32? { get { self[10] } set { self[10] = newValue } }
+    var minUpdatableVersion: [UInt32] { get { self[all: 11] } set { self[all: 11] = newValue } }
+    func append(minUpdatableVersion value: UInt32) { append(value, toAll: 11) }
 }
 
 /// Generated wire model for `TSCK.ActivityAuthorArchive`.
 final class TSCK_ActivityAuthorArchive: IWAMessage {
-    var name: String?
-    var color: TSP_Color?
-    var publicIds: [String] = []
-    var isPublicAuthor: Bool?
-    var shareParticipantId: String?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSCK.ActivityAuthorArchive", [
+        .optional(1, .string), .optional(2, TSP_Color.self), .repeated(3, .string), .optional(4, .bool),
+        .optional(5, .string),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 5)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { name = _v }
-        case 2:
-            var _v: TSP_Color?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Color(ProtobufMessage(_b)) }
-            if let _v { color = _v }
-        case 3:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { publicIds.append(_v) }
-        case 4:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { isPublicAuthor = _v }
-        case 5:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { shareParticipantId = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = name { _w.stringField(1, _x) }
-        if let _x = color { _w.bytesField(2, _x.encoded()) }
-        for _x in publicIds { _w.stringField(3, _x) }
-        if let _x = isPublicAuthor { _w.varintField(4, _x ? 1 : 0) }
-        if let _x = shareParticipantId { _w.stringField(5, _x) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var name: String? { get { self[0] } set { self[0] = newValue } }
+    var color: TSP_Color? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var publicIds: [String] { get { self[all: 2] } set { self[all: 2] = newValue } }
+    func append(publicIds value: String) { append(value, toAll: 2) }
+    var isPublicAuthor: Bool? { get { self[3] } set { self[3] = newValue } }
+    var shareParticipantId: String? { get { self[4] } set { self[4] = newValue } }
 }
 
 /// Generated wire model for `TSCK.CommandActivityBehaviorArchive`.
 final class TSCK_CommandActivityBehaviorArchive: IWAMessage {
-    var selectionPathStorages: [TSP_Reference] = []
-    var actionType: Int32?
-    var shouldSendNotification: Bool?
-    var additionalNavigationInfo: TSCK_ActivityNavigationInfoArchive?
-    var actionSubType: Int32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSCK.CommandActivityBehaviorArchive", [
+        .repeated(1, TSP_Reference.self), .optional(2, .int32), .optional(3, .bool),
+        .optional(4, TSCK_ActivityNavigationInfoArchive.self), .optional(5, .int32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 5)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { selectionPathStorages.append(_v) }
-        case 2:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { actionType = _v }
-        case 3:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { shouldSendNotification = _v }
-        case 4:
-            var _v: TSCK_ActivityNavigationInfoArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCK_ActivityNavigationInfoArchive(ProtobufMessage(_b)) }
-            if let _v { additionalNavigationInfo = _v }
-        case 5:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { actionSubType = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in selectionPathStorages { _w.bytesField(1, _x.encoded()) }
-        if let _x = actionType { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = shouldSendNotification { _w.varintField(3, _x ? 1 : 0) }
-        if let _x = additionalNavigationInfo { _w.bytesField(4, _x.encoded()) }
-        if let _x = actionSubType { _w.varintField(5, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var selectionPathStorages: [TSP_Reference] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(selectionPathStorages value: TSP_Reference) { append(value, toMessages: 0) }
+    var actionType: Int32? { get { self[1] } set { self[1] = newValue } }
+    var shouldSendNotification: Bool? { get { self[2] } set { self[2] = newValue } }
+    var additionalNavigationInfo: TSCK_ActivityNavigationInfoArchive? { get { self[message: 3] } set { self[message: 3] = newValue } }
+    var actionSubType: Int32? { get { self[4] } set { self[4] = newValue } }
 }
 
 /// Generated wire model for `TSCK.ActivityCursorCollectionArchive`.
 final class TSCK_ActivityCursorCollectionArchive: IWAMessage {
-    var idCursors: [TSCK_CollaboratorCursorArchive] = []
-    var textCursor: TSCK_CollaboratorCursorArchive?
-    var tableCursor: TSCK_CollaboratorCursorArchive?
-    var cdeCursor: TSCK_CollaboratorCursorArchive?
-    var chartTitleCursor: TSCK_CollaboratorCursorArchive?
-    var galleryItemCursor: TSCK_CollaboratorCursorArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSCK.ActivityCursorCollectionArchive", [
+        .repeated(1, TSCK_CollaboratorCursorArchive.self), .optional(2, TSCK_CollaboratorCursorArchive.self),
+        .optional(3, TSCK_CollaboratorCursorArchive.self), .optional(4, TSCK_CollaboratorCursorArchive.self),
+        .optional(5, TSCK_CollaboratorCursorArchive.self), .optional(6, TSCK_CollaboratorCursorArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 6)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSCK_CollaboratorCursorArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCK_CollaboratorCursorArchive(ProtobufMessage(_b)) }
-            if let _v { idCursors.append(_v) }
-        case 2:
-            var _v: TSCK_CollaboratorCursorArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCK_CollaboratorCursorArchive(ProtobufMessage(_b)) }
-            if let _v { textCursor = _v }
-        case 3:
-            var _v: TSCK_CollaboratorCursorArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCK_CollaboratorCursorArchive(ProtobufMessage(_b)) }
-            if let _v { tableCursor = _v }
-        case 4:
-            var _v: TSCK_CollaboratorCursorArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCK_CollaboratorCursorArchive(ProtobufMessage(_b)) }
-            if let _v { cdeCursor = _v }
-        case 5:
-            var _v: TSCK_CollaboratorCursorArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCK_CollaboratorCursorArchive(ProtobufMessage(_b)) }
-            if let _v { chartTitleCursor = _v }
-        case 6:
-            var _v: TSCK_CollaboratorCursorArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCK_CollaboratorCursorArchive(ProtobufMessage(_b)) }
-            if let _v { galleryItemCursor = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in idCursors { _w.bytesField(1, _x.encoded()) }
-        if let _x = textCursor { _w.bytesField(2, _x.encoded()) }
-        if let _x = tableCursor { _w.bytesField(3, _x.encoded()) }
-        if let _x = cdeCursor { _w.bytesField(4, _x.encoded()) }
-        if let _x = chartTitleCursor { _w.bytesField(5, _x.encoded()) }
-        if let _x = galleryItemCursor { _w.bytesField(6, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var idCursors: [TSCK_CollaboratorCursorArchive] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(idCursors value: TSCK_CollaboratorCursorArchive) { append(value, toMessages: 0) }
+    var textCursor: TSCK_CollaboratorCursorArchive? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var tableCursor: TSCK_CollaboratorCursorArchive? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var cdeCursor: TSCK_CollaboratorCursorArchive? { get { self[message: 3] } set { self[message: 3] = newValue } }
+    var chartTitleCursor: TSCK_CollaboratorCursorArchive? { get { self[message: 4] } set { self[message: 4] = newValue } }
+    var galleryItemCursor: TSCK_CollaboratorCursorArchive? { get { self[message: 5] } set { self[message: 5] = newValue } }
 }
 
 /// Generated wire model for `TSCK.ActivityCursorCollectionPersistenceWrapperArchive`.
 final class TSCK_ActivityCursorCollectionPersistenceWrapperArchive: IWAMessage {
-    var activityCursorCollection: TSCK_ActivityCursorCollectionArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSCK.ActivityCursorCollectionPersistenceWrapperArchive", [
+        .optional(1, TSCK_ActivityCursorCollectionArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSCK_ActivityCursorCollectionArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCK_ActivityCursorCollectionArchive(ProtobufMessage(_b)) }
-            if let _v { activityCursorCollection = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = activityCursorCollection { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var activityCursorCollection: TSCK_ActivityCursorCollectionArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
 }
 
 /// Generated wire model for `TSCK.ActivityNavigationInfoArchive`.
 final class TSCK_ActivityNavigationInfoArchive: IWAMessage {
-
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSCK.ActivityNavigationInfoArchive", [])
+    var _values = [IWAValue](repeating: .absent, count: 0)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
 }
 
 /// Generated wire model for `TSCK.CommentActivityNavigationInfoArchive`.
 final class TSCK_CommentActivityNavigationInfoArchive: IWAMessage {
-    var commentId: String?
-    var parentUuid: TSP_UUID?
-    var storageUuid: TSP_UUID?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSCK.CommentActivityNavigationInfoArchive", [
+        .optional(1, .string), .optional(2, TSP_UUID.self), .optional(3, TSP_UUID.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { commentId = _v }
-        case 2:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { parentUuid = _v }
-        case 3:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { storageUuid = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = commentId { _w.stringField(1, _x) }
-        if let _x = parentUuid { _w.bytesField(2, _x.encoded()) }
-        if let _x = storageUuid { _w.bytesField(3, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var commentId: String? { get { self[0] } set { self[0] = newValue } }
+    var parentUuid: TSP_UUID? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var storageUuid: TSP_UUID? { get { self[message: 2] } set { self[message: 2] = newValue } }
 }
 
 /// Generated wire model for `TSCK.ActivityAuthorCacheArchive`.
 final class TSCK_ActivityAuthorCacheArchive: IWAMessage {
-    var shareParticipantIdCache: [TSCK_ActivityAuthorCacheArchive_ShareParticipantIDCache] = []
-    var fallbackPublicIdCache: [TSCK_ActivityAuthorCacheArchive_PublicIDCache] = []
-    var indexCache: [TSCK_ActivityAuthorCacheArchive_IndexCache] = []
-    var firstJoinCache: [TSCK_ActivityAuthorCacheArchive_FirstJoinCache] = []
-    var authors: [TSP_Reference] = []
-    var lastAuditDate: TSP_Date?
-    var authorIdentifiersToRemove: [TSP_UUID] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSCK_ActivityAuthorCacheArchive_ShareParticipantIDCache?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCK_ActivityAuthorCacheArchive_ShareParticipantIDCache(ProtobufMessage(_b)) }
-            if let _v { shareParticipantIdCache.append(_v) }
-        case 3:
-            var _v: TSCK_ActivityAuthorCacheArchive_PublicIDCache?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCK_ActivityAuthorCacheArchive_PublicIDCache(ProtobufMessage(_b)) }
-            if let _v { fallbackPublicIdCache.append(_v) }
-        case 4:
-            var _v: TSCK_ActivityAuthorCacheArchive_IndexCache?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCK_ActivityAuthorCacheArchive_IndexCache(ProtobufMessage(_b)) }
-            if let _v { indexCache.append(_v) }
-        case 5:
-            var _v: TSCK_ActivityAuthorCacheArchive_FirstJoinCache?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCK_ActivityAuthorCacheArchive_FirstJoinCache(ProtobufMessage(_b)) }
-            if let _v { firstJoinCache.append(_v) }
-        case 6:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { authors.append(_v) }
-        case 7:
-            var _v: TSP_Date?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Date(ProtobufMessage(_b)) }
-            if let _v { lastAuditDate = _v }
-        case 8:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { authorIdentifiersToRemove.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in shareParticipantIdCache { _w.bytesField(1, _x.encoded()) }
-        for _x in fallbackPublicIdCache { _w.bytesField(3, _x.encoded()) }
-        for _x in indexCache { _w.bytesField(4, _x.encoded()) }
-        for _x in firstJoinCache { _w.bytesField(5, _x.encoded()) }
-        for _x in authors { _w.bytesField(6, _x.encoded()) }
-        if let _x = lastAuditDate { _w.bytesField(7, _x.encoded()) }
-        for _x in authorIdentifiersToRemove { _w.bytesField(8, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSCK.ActivityAuthorCacheArchive", [
+        .repeated(1, TSCK_ActivityAuthorCacheArchive_ShareParticipantIDCache.self),
+        .repeated(3, TSCK_ActivityAuthorCacheArchive_PublicIDCache.self),
+        .repeated(4, TSCK_ActivityAuthorCacheArchive_IndexCache.self),
+        .repeated(5, TSCK_ActivityAuthorCacheArchive_FirstJoinCache.self), .repeated(6, TSP_Reference.self),
+        .optional(7, TSP_Date.self), .repeated(8, TSP_UUID.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 7)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var shareParticipantIdCache: [TSCK_ActivityAuthorCacheArchive_ShareParticipantIDCache] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(shareParticipantIdCache value: TSCK_ActivityAuthorCacheArchive_ShareParticipantIDCache) { append(value, toMessages: 0) }
+    var fallbackPublicIdCache: [TSCK_ActivityAuthorCacheArchive_PublicIDCache] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(fallbackPublicIdCache value: TSCK_ActivityAuthorCacheArchive_PublicIDCache) { append(value, toMessages: 1) }
+    var indexCache: [TSCK_ActivityAuthorCacheArchive_IndexCache] { get { self[messages: 2] } set { self[messages: 2] = newValue } }
+    func append(indexCache value: TSCK_ActivityAuthorCacheArchive_IndexCache) { append(value, toMessages: 2) }
+    var firstJoinCache: [TSCK_ActivityAuthorCacheArchive_FirstJoinCache] { get { self[messages: 3] } set { self[messages: 3] = newValue } }
+    func append(firstJoinCache value: TSCK_ActivityAuthorCacheArchive_FirstJoinCache) { append(value, toMessages: 3) }
+    var authors: [TSP_Reference] { get { self[messages: 4] } set { self[messages: 4] = newValue } }
+    func append(authors value: TSP_Reference) { append(value, toMessages: 4) }
+    var lastAuditDate: TSP_Date? { get { self[message: 5] } set { self[message: 5] = newValue } }
+    var authorIdentifiersToRemove: [TSP_UUID] { get { self[messages: 6] } set { self[messages: 6] = newValue } }
+    func append(authorIdentifiersToRemove value: TSP_UUID) { append(value, toMessages: 6) }
 }
 
 /// Generated wire model for `TSCK.ActivityAuthorCacheArchive.ShareParticipantIDCache`.
 final class TSCK_ActivityAuthorCacheArchive_ShareParticipantIDCache: IWAMessage {
-    var identifier: TSP_UUID?
-    var shareParticipantId: String?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSCK.ActivityAuthorCacheArchive.ShareParticipantIDCache", [
+        .optional(1, TSP_UUID.self), .optional(2, .string),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { identifier = _v }
-        case 2:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { shareParticipantId = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = identifier { _w.bytesField(1, _x.encoded()) }
-        if let _x = shareParticipantId { _w.stringField(2, _x) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var identifier: TSP_UUID? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var shareParticipantId: String? { get { self[1] } set { self[1] = newValue } }
 }
 
 /// Generated wire model for `TSCK.ActivityAuthorCacheArchive.PublicIDCache`.
 final class TSCK_ActivityAuthorCacheArchive_PublicIDCache: IWAMessage {
-    var identifier: TSP_UUID?
-    var publicIdentifier: String?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSCK.ActivityAuthorCacheArchive.PublicIDCache", [
+        .optional(1, TSP_UUID.self), .optional(2, .string),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { identifier = _v }
-        case 2:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { publicIdentifier = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = identifier { _w.bytesField(1, _x.encoded()) }
-        if let _x = publicIdentifier { _w.stringField(2, _x) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var identifier: TSP_UUID? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var publicIdentifier: String? { get { self[1] } set { self[1] = newValue } }
 }
 
 /// Generated wire model for `TSCK.ActivityAuthorCacheArchive.IndexCache`.
 final class TSCK_ActivityAuthorCacheArchive_IndexCache: IWAMessage {
-    var identifier: TSP_UUID?
-    var authorIndex: UInt64?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSCK.ActivityAuthorCacheArchive.IndexCache", [
+        .optional(1, TSP_UUID.self), .optional(2, .uint64),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { identifier = _v }
-        case 2:
-            var _v: UInt64?
-            if case .varint(let _u) = _f.value { _v = UInt64(truncatingIfNeeded: _u) }
-            if let _v { authorIndex = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = identifier { _w.bytesField(1, _x.encoded()) }
-        if let _x = authorIndex { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var identifier: TSP_UUID? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var authorIndex: UInt64? { get { self[1] } set { self[1] = newValue } }
 }
 
 /// Generated wire model for `TSCK.ActivityAuthorCacheArchive.FirstJoinCache`.
 final class TSCK_ActivityAuthorCacheArchive_FirstJoinCache: IWAMessage {
-    var identifier: TSP_UUID?
-    var firstJoinDate: TSP_Date?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSCK.ActivityAuthorCacheArchive.FirstJoinCache", [
+        .optional(1, TSP_UUID.self), .optional(2, TSP_Date.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { identifier = _v }
-        case 2:
-            var _v: TSP_Date?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Date(ProtobufMessage(_b)) }
-            if let _v { firstJoinDate = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = identifier { _w.bytesField(1, _x.encoded()) }
-        if let _x = firstJoinDate { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var identifier: TSP_UUID? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var firstJoinDate: TSP_Date? { get { self[message: 1] } set { self[message: 1] = newValue } }
 }
 
 /// Generated wire model for `TSCK.ActivityOnlyCommandArchive`.
 final class TSCK_ActivityOnlyCommandArchive: IWAMessage {
-    var `super`: TSK_CommandArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSCK.ActivityOnlyCommandArchive", [
+        .optional(1, TSK_CommandArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSK_CommandArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_CommandArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var `super`: TSK_CommandArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
 }
 
 /// Generated wire model for `TSCK.ActivityNotificationItemArchive`.
 final class TSCK_ActivityNotificationItemArchive: IWAMessage {
-    var type: Int32?
-    var uniqueIdentifier: TSP_UUID?
-    var activities: [TSP_Reference] = []
-    var firstTimestamp: TSP_Date?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSCK.ActivityNotificationItemArchive", [
+        .optional(1, .int32), .optional(2, TSP_UUID.self), .repeated(3, TSP_Reference.self),
+        .optional(4, TSP_Date.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { type = _v }
-        case 2:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { uniqueIdentifier = _v }
-        case 3:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { activities.append(_v) }
-        case 4:
-            var _v: TSP_Date?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Date(ProtobufMessage(_b)) }
-            if let _v { firstTimestamp = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = type { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = uniqueIdentifier { _w.bytesField(2, _x.encoded()) }
-        for _x in activities { _w.bytesField(3, _x.encoded()) }
-        if let _x = firstTimestamp { _w.bytesField(4, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var type: Int32? { get { self[0] } set { self[0] = newValue } }
+    var uniqueIdentifier: TSP_UUID? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var activities: [TSP_Reference] { get { self[messages: 2] } set { self[messages: 2] = newValue } }
+    func append(activities value: TSP_Reference) { append(value, toMessages: 2) }
+    var firstTimestamp: TSP_Date? { get { self[message: 3] } set { self[message: 3] = newValue } }
 }
 
 /// Generated wire model for `TSCK.ActivityNotificationParticipantCacheArchive`.
 final class TSCK_ActivityNotificationParticipantCacheArchive: IWAMessage {
-    var notificationItems: [TSP_Reference] = []
-    var lastEditNotificationItemSentDate: TSP_Date?
-    var senderFailedToEnqueueAttempts: [TSCK_ActivityNotificationParticipantCacheArchive_UniqueIdentifierAndAttempts] = []
-    var privateId: String?
-    var lastCommentNotificationItemSentDate: TSP_Date?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSCK.ActivityNotificationParticipantCacheArchive", [
+        .repeated(1, TSP_Reference.self), .optional(2, TSP_Date.self),
+        .repeated(3, TSCK_ActivityNotificationParticipantCacheArchive_UniqueIdentifierAndAttempts.self),
+        .optional(4, .string), .optional(5, TSP_Date.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 5)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { notificationItems.append(_v) }
-        case 2:
-            var _v: TSP_Date?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Date(ProtobufMessage(_b)) }
-            if let _v { lastEditNotificationItemSentDate = _v }
-        case 3:
-            var _v: TSCK_ActivityNotificationParticipantCacheArchive_UniqueIdentifierAndAttempts?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCK_ActivityNotificationParticipantCacheArchive_UniqueIdentifierAndAttempts(ProtobufMessage(_b)) }
-            if let _v { senderFailedToEnqueueAttempts.append(_v) }
-        case 4:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { privateId = _v }
-        case 5:
-            var _v: TSP_Date?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Date(ProtobufMessage(_b)) }
-            if let _v { lastCommentNotificationItemSentDate = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in notificationItems { _w.bytesField(1, _x.encoded()) }
-        if let _x = lastEditNotificationItemSentDate { _w.bytesField(2, _x.encoded()) }
-        for _x in senderFailedToEnqueueAttempts { _w.bytesField(3, _x.encoded()) }
-        if let _x = privateId { _w.stringField(4, _x) }
-        if let _x = lastCommentNotificationItemSentDate { _w.bytesField(5, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var notificationItems: [TSP_Reference] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(notificationItems value: TSP_Reference) { append(value, toMessages: 0) }
+    var lastEditNotificationItemSentDate: TSP_Date? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var senderFailedToEnqueueAttempts: [TSCK_ActivityNotificationParticipantCacheArchive_UniqueIdentifierAndAttempts] { get { self[messages: 2] } set { self[messages: 2] = newValue } }
+    func append(senderFailedToEnqueueAttempts value: TSCK_ActivityNotificationParticipantCacheArchive_UniqueIdentifierAndAttempts) { append(value, toMessages: 2) }
+    var privateId: String? { get { self[3] } set { self[3] = newValue } }
+    var lastCommentNotificationItemSentDate: TSP_Date? { get { self[message: 4] } set { self[message: 4] = newValue } }
 }
 
 /// Generated wire model for `TSCK.ActivityNotificationParticipantCacheArchive.UniqueIdentifierAndAttempts`.
 final class TSCK_ActivityNotificationParticipantCacheArchive_UniqueIdentifierAndAttempts: IWAMessage {
-    var uniqueIdentifier: TSP_UUID?
-    var attempts: UInt32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSCK.ActivityNotificationParticipantCacheArchive.UniqueIdentifierAndAttempts", [
+        .optional(1, TSP_UUID.self), .optional(2, .uint32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { uniqueIdentifier = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { attempts = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = uniqueIdentifier { _w.bytesField(1, _x.encoded()) }
-        if let _x = attempts { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var uniqueIdentifier: TSP_UUID? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var attempts: UInt32? { get { self[1] } set { self[1] = newValue } }
 }
 
 /// Generated wire model for `TSCK.ActivityNotificationQueueArchive`.
 final class TSCK_ActivityNotificationQueueArchive: IWAMessage {
-    var unprocessedNotificationItems: [TSP_Reference] = []
-    var pendingParticipantCaches: [TSP_Reference] = []
-    var sentParticipantCaches: [TSP_Reference] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSCK.ActivityNotificationQueueArchive", [
+        .repeated(1, TSP_Reference.self), .repeated(3, TSP_Reference.self), .repeated(5, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { unprocessedNotificationItems.append(_v) }
-        case 3:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { pendingParticipantCaches.append(_v) }
-        case 5:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { sentParticipantCaches.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in unprocessedNotificationItems { _w.bytesField(1, _x.encoded()) }
-        for _x in pendingParticipantCaches { _w.bytesField(3, _x.encoded()) }
-        for _x in sentParticipantCaches { _w.bytesField(5, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var unprocessedNotificationItems: [TSP_Reference] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(unprocessedNotificationItems value: TSP_Reference) { append(value, toMessages: 0) }
+    var pendingParticipantCaches: [TSP_Reference] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(pendingParticipantCaches value: TSP_Reference) { append(value, toMessages: 1) }
+    var sentParticipantCaches: [TSP_Reference] { get { self[messages: 2] } set { self[messages: 2] = newValue } }
+    func append(sentParticipantCaches value: TSP_Reference) { append(value, toMessages: 2) }
 }
 
 /// Generated wire model for `TSCK.ActivityStreamTransformationStateArchive`.
 final class TSCK_ActivityStreamTransformationStateArchive: IWAMessage {
-    var nextActivityToTransformIndex: Int32?
-    var oldestRevisionSequenceAfterTransformed: Int32?
-    var lastActivityCoalescedDate: TSP_Date?
-    var actionType: Int32?
-    var transformToDocumentRevisionSequence: Int32?
-    var transformToDocumentRevisionIdentifier: [UInt64] = []
-    var timestampOfLastActivityWhenLastActivityCoalescing: Double?
-    var preservingRevisionSequenceOrder: Bool?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSCK.ActivityStreamTransformationStateArchive", [
+        .optional(1, .int32), .optional(2, .int32), .optional(3, TSP_Date.self), .optional(4, .int32),
+        .optional(5, .int32), .repeated(6, .fixed64), .optional(7, .double), .optional(8, .bool),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 8)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { nextActivityToTransformIndex = _v }
-        case 2:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { oldestRevisionSequenceAfterTransformed = _v }
-        case 3:
-            var _v: TSP_Date?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Date(ProtobufMessage(_b)) }
-            if let _v { lastActivityCoalescedDate = _v }
-        case 4:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { actionType = _v }
-        case 5:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { transformToDocumentRevisionSequence = _v }
-        case 6:
-            var _v: UInt64?
-            if case .fixed64(let _b) = _f.value { _v = IWAWire.u64(_b) }
-            if let _v { transformToDocumentRevisionIdentifier.append(_v) }
-        case 7:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { timestampOfLastActivityWhenLastActivityCoalescing = _v }
-        case 8:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { preservingRevisionSequenceOrder = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = nextActivityToTransformIndex { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = oldestRevisionSequenceAfterTransformed { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = lastActivityCoalescedDate { _w.bytesField(3, _x.encoded()) }
-        if let _x = actionType { _w.varintField(4, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = transformToDocumentRevisionSequence { _w.varintField(5, UInt64(truncatingIfNeeded: _x)) }
-        for _x in transformToDocumentRevisionIdentifier { _w.fixed64Field(6, _x) }
-        if let _x = timestampOfLastActivityWhenLastActivityCoalescing { _w.fixed64Field(7, _x.bitPattern) }
-        if let _x = preservingRevisionSequenceOrder { _w.varintField(8, _x ? 1 : 0) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var nextActivityToTransformIndex: Int32? { get { self[0] } set { self[0] = newValue } }
+    var oldestRevisionSequenceAfterTransformed: Int32? { get { self[1] } set { self[1] = newValue } }
+    var lastActivityCoalescedDate: TSP_Date? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var actionType: Int32? { get { self[3] } set { self[3] = newValue } }
+    var transformToDocumentRevisionSequence: Int32? { get { self[4] } set { self[4] = newValue } }
+    var transformToDocumentRevisionIdentifier: [UInt64] { get { self[all: 5] } set { self[all: 5] = newValue } }
+    func append(transformToDocumentRevisionIdentifier value: UInt64) { append(value, toAll: 5) }
+    var timestampOfLastActivityWhenLastActivityCoalescing: Double? { get { self[6] } set { self[6] = newValue } }
+    var preservingRevisionSequenceOrder: Bool? { get { self[7] } set { self[7] = newValue } }
 }
 
 /// Generated wire model for `TSCK.ActivityStreamActivityCounterArchive`.
 final class TSCK_ActivityStreamActivityCounterArchive: IWAMessage {
-    var actionTypeCounter: [TSCK_ActivityStreamActivityCounterArchive_ActionTypeCounter] = []
-    var cursorTypeCounter: [TSCK_ActivityStreamActivityCounterArchive_CursorTypeCounter] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSCK.ActivityStreamActivityCounterArchive", [
+        .repeated(1, TSCK_ActivityStreamActivityCounterArchive_ActionTypeCounter.self),
+        .repeated(2, TSCK_ActivityStreamActivityCounterArchive_CursorTypeCounter.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSCK_ActivityStreamActivityCounterArchive_ActionTypeCounter?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCK_ActivityStreamActivityCounterArchive_ActionTypeCounter(ProtobufMessage(_b)) }
-            if let _v { actionTypeCounter.append(_v) }
-        case 2:
-            var _v: TSCK_ActivityStreamActivityCounterArchive_CursorTypeCounter?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCK_ActivityStreamActivityCounterArchive_CursorTypeCounter(ProtobufMessage(_b)) }
-            if let _v { cursorTypeCounter.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in actionTypeCounter { _w.bytesField(1, _x.encoded()) }
-        for _x in cursorTypeCounter { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var actionTypeCounter: [TSCK_ActivityStreamActivityCounterArchive_ActionTypeCounter] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(actionTypeCounter value: TSCK_ActivityStreamActivityCounterArchive_ActionTypeCounter) { append(value, toMessages: 0) }
+    var cursorTypeCounter: [TSCK_ActivityStreamActivityCounterArchive_CursorTypeCounter] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(cursorTypeCounter value: TSCK_ActivityStreamActivityCounterArchive_CursorTypeCounter) { append(value, toMessages: 1) }
 }
 
 /// Generated wire model for `TSCK.ActivityStreamActivityCounterArchive.ActionTypeCounter`.
 final class TSCK_ActivityStreamActivityCounterArchive_ActionTypeCounter: IWAMessage {
-    var actionType: Int32?
-    var count: UInt32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSCK.ActivityStreamActivityCounterArchive.ActionTypeCounter", [
+        .optional(1, .int32), .optional(2, .uint32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { actionType = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { count = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = actionType { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = count { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var actionType: Int32? { get { self[0] } set { self[0] = newValue } }
+    var count: UInt32? { get { self[1] } set { self[1] = newValue } }
 }
 
 /// Generated wire model for `TSCK.ActivityStreamActivityCounterArchive.CursorTypeCounter`.
 final class TSCK_ActivityStreamActivityCounterArchive_CursorTypeCounter: IWAMessage {
-    var cursorType: Int32?
-    var count: UInt32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSCK.ActivityStreamActivityCounterArchive.CursorTypeCounter", [
+        .optional(1, .int32), .optional(2, .uint32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { cursorType = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { count = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = cursorType { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = count { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var cursorType: Int32? { get { self[0] } set { self[0] = newValue } }
+    var count: UInt32? { get { self[1] } set { self[1] = newValue } }
 }
 
 /// Generated wire model for `TSCK.ActivityStreamRemovedAuthorAuditorPendingStateArchive`.
 final class TSCK_ActivityStreamRemovedAuthorAuditorPendingStateArchive: IWAMessage {
-    var currentAuthorIdentifiers: [TSP_UUID] = []
-    var datesToAudit: [TSCK_ActivityStreamRemovedAuthorAuditorPendingStateArchive_DateToAuditAndType] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSCK.ActivityStreamRemovedAuthorAuditorPendingStateArchive", [
+        .repeated(1, TSP_UUID.self),
+        .repeated(3, TSCK_ActivityStreamRemovedAuthorAuditorPendingStateArchive_DateToAuditAndType.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { currentAuthorIdentifiers.append(_v) }
-        case 3:
-            var _v: TSCK_ActivityStreamRemovedAuthorAuditorPendingStateArchive_DateToAuditAndType?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCK_ActivityStreamRemovedAuthorAuditorPendingStateArchive_DateToAuditAndType(ProtobufMessage(_b)) }
-            if let _v { datesToAudit.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in currentAuthorIdentifiers { _w.bytesField(1, _x.encoded()) }
-        for _x in datesToAudit { _w.bytesField(3, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var currentAuthorIdentifiers: [TSP_UUID] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(currentAuthorIdentifiers value: TSP_UUID) { append(value, toMessages: 0) }
+    var datesToAudit: [TSCK_ActivityStreamRemovedAuthorAuditorPendingStateArchive_DateToAuditAndType] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(datesToAudit value: TSCK_ActivityStreamRemovedAuthorAuditorPendingStateArchive_DateToAuditAndType) { append(value, toMessages: 1) }
 }
 
 /// Generated wire model for `TSCK.ActivityStreamRemovedAuthorAuditorPendingStateArchive.DateToAuditAndType`.
 final class TSCK_ActivityStreamRemovedAuthorAuditorPendingStateArchive_DateToAuditAndType: IWAMessage {
-    var dateToAudit: TSP_Date?
-    var type: Int32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSCK.ActivityStreamRemovedAuthorAuditorPendingStateArchive.DateToAuditAndType", [
+        .optional(1, TSP_Date.self), .optional(2, .int32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Date?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Date(ProtobufMessage(_b)) }
-            if let _v { dateToAudit = _v }
-        case 2:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { type = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = dateToAudit { _w.bytesField(1, _x.encoded()) }
-        if let _x = type { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var dateToAudit: TSP_Date? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var type: Int32? { get { self[1] } set { self[1] = newValue } }
 }
 
 /// Registers this file's archives into the reflective catalog.
-func registerIWA_TSCKArchives(_ into: inout [(name: String, decode: (ProtobufMessage) -> IWAMessage)]) {
-    into.append(("TSCK.CollaborationCommandHistoryArray", { TSCK_CollaborationCommandHistoryArray($0) as IWAMessage }))
-    into.append(("TSCK.CollaborationCommandHistoryArraySegment", { TSCK_CollaborationCommandHistoryArraySegment($0) as IWAMessage }))
-    into.append(("TSCK.CollaborationCommandHistory", { TSCK_CollaborationCommandHistory($0) as IWAMessage }))
-    into.append(("TSCK.CollaborationCommandHistory.ItemList", { TSCK_CollaborationCommandHistory_ItemList($0) as IWAMessage }))
-    into.append(("TSCK.CollaborationCommandHistoryItem", { TSCK_CollaborationCommandHistoryItem($0) as IWAMessage }))
-    into.append(("TSCK.CollaborationCommandHistoryCoalescingGroup", { TSCK_CollaborationCommandHistoryCoalescingGroup($0) as IWAMessage }))
-    into.append(("TSCK.CollaborationCommandHistoryCoalescingGroupNode", { TSCK_CollaborationCommandHistoryCoalescingGroupNode($0) as IWAMessage }))
-    into.append(("TSCK.CollaborationCommandHistoryOriginatingCommandAcknowledgementObserver", { TSCK_CollaborationCommandHistoryOriginatingCommandAcknowledgementObserver($0) as IWAMessage }))
-    into.append(("TSCK.DocumentSupportCollaborationState", { TSCK_DocumentSupportCollaborationState($0) as IWAMessage }))
-    into.append(("TSCK.SetAnnotationAuthorColorCommandArchive", { TSCK_SetAnnotationAuthorColorCommandArchive($0) as IWAMessage }))
-    into.append(("TSCK.SetActivityAuthorShareParticipantIDCommandArchive", { TSCK_SetActivityAuthorShareParticipantIDCommandArchive($0) as IWAMessage }))
-    into.append(("TSCK.IdOperationArgs", { TSCK_IdOperationArgs($0) as IWAMessage }))
-    into.append(("TSCK.AddIdOperationArgs", { TSCK_AddIdOperationArgs($0) as IWAMessage }))
-    into.append(("TSCK.RemoveIdOperationArgs", { TSCK_RemoveIdOperationArgs($0) as IWAMessage }))
-    into.append(("TSCK.RearrangeIdOperationArgs", { TSCK_RearrangeIdOperationArgs($0) as IWAMessage }))
-    into.append(("TSCK.IdPlacementOperationArgs", { TSCK_IdPlacementOperationArgs($0) as IWAMessage }))
-    into.append(("TSCK.ActivityCommitCommandArchive", { TSCK_ActivityCommitCommandArchive($0) as IWAMessage }))
-    into.append(("TSCK.ExecuteTestBetweenRollbackAndReapplyCommandArchive", { TSCK_ExecuteTestBetweenRollbackAndReapplyCommandArchive($0) as IWAMessage }))
-    into.append(("TSCK.CreateLocalStorageSnapshotCommandArchive", { TSCK_CreateLocalStorageSnapshotCommandArchive($0) as IWAMessage }))
-    into.append(("TSCK.BlockDiffsAtCurrentRevisionCommand", { TSCK_BlockDiffsAtCurrentRevisionCommand($0) as IWAMessage }))
-    into.append(("TSCK.TransformerEntry", { TSCK_TransformerEntry($0) as IWAMessage }))
-    into.append(("TSCK.CollaborationAppliedCommandDocumentRevisionMapping", { TSCK_CollaborationAppliedCommandDocumentRevisionMapping($0) as IWAMessage }))
-    into.append(("TSCK.CollaborationDocumentSessionState", { TSCK_CollaborationDocumentSessionState($0) as IWAMessage }))
-    into.append(("TSCK.CollaborationDocumentSessionState.AcknowledgementObserverEntry", { TSCK_CollaborationDocumentSessionState_AcknowledgementObserverEntry($0) as IWAMessage }))
-    into.append(("TSCK.OperationStorageEntryArray", { TSCK_OperationStorageEntryArray($0) as IWAMessage }))
-    into.append(("TSCK.OperationStorageEntryArraySegment", { TSCK_OperationStorageEntryArraySegment($0) as IWAMessage }))
-    into.append(("TSCK.OperationStorage", { TSCK_OperationStorage($0) as IWAMessage }))
-    into.append(("TSCK.OutgoingCommandQueue", { TSCK_OutgoingCommandQueue($0) as IWAMessage }))
-    into.append(("TSCK.OutgoingCommandQueueSegment", { TSCK_OutgoingCommandQueueSegment($0) as IWAMessage }))
-    into.append(("TSCK.CommandAssetChunkArchive", { TSCK_CommandAssetChunkArchive($0) as IWAMessage }))
-    into.append(("TSCK.AssetUploadStatusCommandArchive", { TSCK_AssetUploadStatusCommandArchive($0) as IWAMessage }))
-    into.append(("TSCK.AssetUploadStatusCommandArchive.AssetUploadStatusInfo", { TSCK_AssetUploadStatusCommandArchive_AssetUploadStatusInfo($0) as IWAMessage }))
-    into.append(("TSCK.AssetUnmaterializedOnServerCommandArchive", { TSCK_AssetUnmaterializedOnServerCommandArchive($0) as IWAMessage }))
-    into.append(("TSCK.CollaboratorCursorArchive", { TSCK_CollaboratorCursorArchive($0) as IWAMessage }))
-    into.append(("TSCK.ActivityStreamArchive", { TSCK_ActivityStreamArchive($0) as IWAMessage }))
-    into.append(("TSCK.ActivityStreamActivityArray", { TSCK_ActivityStreamActivityArray($0) as IWAMessage }))
-    into.append(("TSCK.ActivityStreamActivityArraySegment", { TSCK_ActivityStreamActivityArraySegment($0) as IWAMessage }))
-    into.append(("TSCK.ActivityArchive", { TSCK_ActivityArchive($0) as IWAMessage }))
-    into.append(("TSCK.ActivityAuthorArchive", { TSCK_ActivityAuthorArchive($0) as IWAMessage }))
-    into.append(("TSCK.CommandActivityBehaviorArchive", { TSCK_CommandActivityBehaviorArchive($0) as IWAMessage }))
-    into.append(("TSCK.ActivityCursorCollectionArchive", { TSCK_ActivityCursorCollectionArchive($0) as IWAMessage }))
-    into.append(("TSCK.ActivityCursorCollectionPersistenceWrapperArchive", { TSCK_ActivityCursorCollectionPersistenceWrapperArchive($0) as IWAMessage }))
-    into.append(("TSCK.ActivityNavigationInfoArchive", { TSCK_ActivityNavigationInfoArchive($0) as IWAMessage }))
-    into.append(("TSCK.CommentActivityNavigationInfoArchive", { TSCK_CommentActivityNavigationInfoArchive($0) as IWAMessage }))
-    into.append(("TSCK.ActivityAuthorCacheArchive", { TSCK_ActivityAuthorCacheArchive($0) as IWAMessage }))
-    into.append(("TSCK.ActivityAuthorCacheArchive.ShareParticipantIDCache", { TSCK_ActivityAuthorCacheArchive_ShareParticipantIDCache($0) as IWAMessage }))
-    into.append(("TSCK.ActivityAuthorCacheArchive.PublicIDCache", { TSCK_ActivityAuthorCacheArchive_PublicIDCache($0) as IWAMessage }))
-    into.append(("TSCK.ActivityAuthorCacheArchive.IndexCache", { TSCK_ActivityAuthorCacheArchive_IndexCache($0) as IWAMessage }))
-    into.append(("TSCK.ActivityAuthorCacheArchive.FirstJoinCache", { TSCK_ActivityAuthorCacheArchive_FirstJoinCache($0) as IWAMessage }))
-    into.append(("TSCK.ActivityOnlyCommandArchive", { TSCK_ActivityOnlyCommandArchive($0) as IWAMessage }))
-    into.append(("TSCK.ActivityNotificationItemArchive", { TSCK_ActivityNotificationItemArchive($0) as IWAMessage }))
-    into.append(("TSCK.ActivityNotificationParticipantCacheArchive", { TSCK_ActivityNotificationParticipantCacheArchive($0) as IWAMessage }))
-    into.append(("TSCK.ActivityNotificationParticipantCacheArchive.UniqueIdentifierAndAttempts", { TSCK_ActivityNotificationParticipantCacheArchive_UniqueIdentifierAndAttempts($0) as IWAMessage }))
-    into.append(("TSCK.ActivityNotificationQueueArchive", { TSCK_ActivityNotificationQueueArchive($0) as IWAMessage }))
-    into.append(("TSCK.ActivityStreamTransformationStateArchive", { TSCK_ActivityStreamTransformationStateArchive($0) as IWAMessage }))
-    into.append(("TSCK.ActivityStreamActivityCounterArchive", { TSCK_ActivityStreamActivityCounterArchive($0) as IWAMessage }))
-    into.append(("TSCK.ActivityStreamActivityCounterArchive.ActionTypeCounter", { TSCK_ActivityStreamActivityCounterArchive_ActionTypeCounter($0) as IWAMessage }))
-    into.append(("TSCK.ActivityStreamActivityCounterArchive.CursorTypeCounter", { TSCK_ActivityStreamActivityCounterArchive_CursorTypeCounter($0) as IWAMessage }))
-    into.append(("TSCK.ActivityStreamRemovedAuthorAuditorPendingStateArchive", { TSCK_ActivityStreamRemovedAuthorAuditorPendingStateArchive($0) as IWAMessage }))
-    into.append(("TSCK.ActivityStreamRemovedAuthorAuditorPendingStateArchive.DateToAuditAndType", { TSCK_ActivityStreamRemovedAuthorAuditorPendingStateArchive_DateToAuditAndType($0) as IWAMessage }))
+func registerIWA_TSCKArchives(_ into: inout [any IWAMessage.Type]) {
+    into += [
+        TSCK_CollaborationCommandHistoryArray.self, TSCK_CollaborationCommandHistoryArraySegment.self,
+        TSCK_CollaborationCommandHistory.self, TSCK_CollaborationCommandHistory_ItemList.self,
+        TSCK_CollaborationCommandHistoryItem.self, TSCK_CollaborationCommandHistoryCoalescingGroup.self,
+        TSCK_CollaborationCommandHistoryCoalescingGroupNode.self,
+        TSCK_CollaborationCommandHistoryOriginatingCommandAcknowledgementObserver.self,
+        TSCK_DocumentSupportCollaborationState.self, TSCK_SetAnnotationAuthorColorCommandArchive.self,
+        TSCK_SetActivityAuthorShareParticipantIDCommandArchive.self, TSCK_IdOperationArgs.self,
+        TSCK_AddIdOperationArgs.self, TSCK_RemoveIdOperationArgs.self, TSCK_RearrangeIdOperationArgs.self,
+        TSCK_IdPlacementOperationArgs.self, TSCK_ActivityCommitCommandArchive.self,
+        TSCK_ExecuteTestBetweenRollbackAndReapplyCommandArchive.self,
+        TSCK_CreateLocalStorageSnapshotCommandArchive.self, TSCK_BlockDiffsAtCurrentRevisionCommand.self,
+        TSCK_TransformerEntry.self, TSCK_CollaborationAppliedCommandDocumentRevisionMapping.self,
+        TSCK_CollaborationDocumentSessionState.self,
+        TSCK_CollaborationDocumentSessionState_AcknowledgementObserverEntry.self, TSCK_OperationStorageEntryArray.self,
+        TSCK_OperationStorageEntryArraySegment.self, TSCK_OperationStorage.self, TSCK_OutgoingCommandQueue.self,
+        TSCK_OutgoingCommandQueueSegment.self, TSCK_CommandAssetChunkArchive.self,
+        TSCK_AssetUploadStatusCommandArchive.self, TSCK_AssetUploadStatusCommandArchive_AssetUploadStatusInfo.self,
+        TSCK_AssetUnmaterializedOnServerCommandArchive.self, TSCK_CollaboratorCursorArchive.self,
+        TSCK_ActivityStreamArchive.self, TSCK_ActivityStreamActivityArray.self,
+        TSCK_ActivityStreamActivityArraySegment.self, TSCK_ActivityArchive.self, TSCK_ActivityAuthorArchive.self,
+        TSCK_CommandActivityBehaviorArchive.self, TSCK_ActivityCursorCollectionArchive.self,
+        TSCK_ActivityCursorCollectionPersistenceWrapperArchive.self, TSCK_ActivityNavigationInfoArchive.self,
+        TSCK_CommentActivityNavigationInfoArchive.self, TSCK_ActivityAuthorCacheArchive.self,
+        TSCK_ActivityAuthorCacheArchive_ShareParticipantIDCache.self,
+        TSCK_ActivityAuthorCacheArchive_PublicIDCache.self, TSCK_ActivityAuthorCacheArchive_IndexCache.self,
+        TSCK_ActivityAuthorCacheArchive_FirstJoinCache.self, TSCK_ActivityOnlyCommandArchive.self,
+        TSCK_ActivityNotificationItemArchive.self, TSCK_ActivityNotificationParticipantCacheArchive.self,
+        TSCK_ActivityNotificationParticipantCacheArchive_UniqueIdentifierAndAttempts.self,
+        TSCK_ActivityNotificationQueueArchive.self, TSCK_ActivityStreamTransformationStateArchive.self,
+        TSCK_ActivityStreamActivityCounterArchive.self,
+        TSCK_ActivityStreamActivityCounterArchive_ActionTypeCounter.self,
+        TSCK_ActivityStreamActivityCounterArchive_CursorTypeCounter.self,
+        TSCK_ActivityStreamRemovedAuthorAuditorPendingStateArchive.self,
+        TSCK_ActivityStreamRemovedAuthorAuditorPendingStateArchive_DateToAuditAndType.self,
+    ]
 }
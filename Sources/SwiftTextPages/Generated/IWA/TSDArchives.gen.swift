@@ -5,3911 +5,1364 @@ import SwiftTextIWA
 
 /// Generated wire model for `TSD.EdgeInsetsArchive`.
 final class TSD_EdgeInsetsArchive: IWAMessage {
-    var top: Float?
-    var left: Float?
-    var bottom: Float?
-    var right: Float?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { top = _v }
-        case 2:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { left = _v }
-        case 3:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { bottom = _v }
-        case 4:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { right = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = top { _w.fixed32Field(1, _x.bitPattern) }
-        if let _x = left { _w.fixed32Field(2, _x.bitPattern) }
-        if let _x = bottom { _w.fixed32Field(3, _x.bitPattern) }
-        if let _x = right { _w.fixed32Field(4, _x.bitPattern) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSD.EdgeInsetsArchive", [
+        .optional(1, .float), .optional(2, .float), .optional(3, .float), .optional(4, .float),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var top: Float? { get { self[0] } set { self[0] = newValue } }
+    var left: Float? { get { self[1] } set { self[1] = newValue } }
+    var bottom: Float? { get { self[2] } set { self[2] = newValue } }
+    var right: Float? { get { self[3] } set { self[3] = newValue } }
 }
 
 /// Generated wire model for `TSD.GeometryArchive`.
 final class TSD_GeometryArchive: IWAMessage {
-    var position: TSP_Point?
-    var size: TSP_Size?
-    var flags: UInt32?
-    var angle: Float?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Point?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Point(ProtobufMessage(_b)) }
-            if let _v { position = _v }
-        case 2:
-            var _v: TSP_Size?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Size(ProtobufMessage(_b)) }
-            if let _v { size = _v }
-        case 3:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { flags = _v }
-        case 4:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { angle = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = position { _w.bytesField(1, _x.encoded()) }
-        if let _x = size { _w.bytesField(2, _x.encoded()) }
-        if let _x = flags { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = angle { _w.fixed32Field(4, _x.bitPattern) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSD.GeometryArchive", [
+        .optional(1, TSP_Point.self), .optional(2, TSP_Size.self), .optional(3, .uint32), .optional(4, .float),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var position: TSP_Point? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var size: TSP_Size? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var flags: UInt32? { get { self[2] } set { self[2] = newValue } }
+    var angle: Float? { get { self[3] } set { self[3] = newValue } }
 }
 
 /// Generated wire model for `TSD.PointPathSourceArchive`.
 final class TSD_PointPathSourceArchive: IWAMessage {
-    var type: Int32?
-    var point: TSP_Point?
-    var naturalsize: TSP_Size?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { type = _v }
-        case 2:
-            var _v: TSP_Point?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Point(ProtobufMessage(_b)) }
-            if let _v { point = _v }
-        case 3:
-            var _v: TSP_Size?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Size(ProtobufMessage(_b)) }
-            if let _v { naturalsize = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = type { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = point { _w.bytesField(2, _x.encoded()) }
-        if let _x = naturalsize { _w.bytesField(3, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSD.PointPathSourceArchive", [
+        .optional(1, .int32), .optional(2, TSP_Point.self), .optional(3, TSP_Size.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var type: Int32? { get { self[0] } set { self[0] = newValue } }
+    var point: TSP_Point? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var naturalsize: TSP_Size? { get { self[message: 2] } set { self[message: 2] = newValue } }
 }
 
 /// Generated wire model for `TSD.ScalarPathSourceArchive`.
 final class TSD_ScalarPathSourceArchive: IWAMessage {
-    var type: Int32?
-    var scalar: Float?
-    var naturalsize: TSP_Size?
-    var isCurveContinuous: Bool?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { type = _v }
-        case 2:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { scalar = _v }
-        case 3:
-            var _v: TSP_Size?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Size(ProtobufMessage(_b)) }
-            if let _v { naturalsize = _v }
-        case 4:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { isCurveContinuous = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = type { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = scalar { _w.fixed32Field(2, _x.bitPattern) }
-        if let _x = naturalsize { _w.bytesField(3, _x.encoded()) }
-        if let _x = isCurveContinuous { _w.varintField(4, _x ? 1 : 0) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSD.ScalarPathSourceArchive", [
+        .optional(1, .int32), .optional(2, .float), .optional(3, TSP_Size.self), .optional(4, .bool),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var type: Int32? { get { self[0] } set { self[0] = newValue } }
+    var scalar: Float? { get { self[1] } set { self[1] = newValue } }
+    var naturalsize: TSP_Size? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var isCurveContinuous: Bool? { get { self[3] } set { self[3] = newValue } }
 }
 
 /// Generated wire model for `TSD.BezierPathSourceArchive`.
 final class TSD_BezierPathSourceArchive: IWAMessage {
-    var pathString: String?
-    var naturalsize: TSP_Size?
-    var path: TSP_Path?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { pathString = _v }
-        case 2:
-            var _v: TSP_Size?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Size(ProtobufMessage(_b)) }
-            if let _v { naturalsize = _v }
-        case 3:
-            var _v: TSP_Path?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Path(ProtobufMessage(_b)) }
-            if let _v { path = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = pathString { _w.stringField(1, _x) }
-        if let _x = naturalsize { _w.bytesField(2, _x.encoded()) }
-        if let _x = path { _w.bytesField(3, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSD.BezierPathSourceArchive", [
+        .optional(1, .string), .optional(2, TSP_Size.self), .optional(3, TSP_Path.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var pathString: String? { get { self[0] } set { self[0] = newValue } }
+    var naturalsize: TSP_Size? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var path: TSP_Path? { get { self[message: 2] } set { self[message: 2] = newValue } }
 }
 
 /// Generated wire model for `TSD.CalloutPathSourceArchive`.
 final class TSD_CalloutPathSourceArchive: IWAMessage {
-    var naturalSize: TSP_Size?
-    var tailPosition: TSP_Point?
-    var tailSize: Float?
-    var cornerRadius: Float?
-    var centerTail: Bool?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Size?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Size(ProtobufMessage(_b)) }
-            if let _v { naturalSize = _v }
-        case 2:
-            var _v: TSP_Point?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Point(ProtobufMessage(_b)) }
-            if let _v { tailPosition = _v }
-        case 3:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { tailSize = _v }
-        case 4:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { cornerRadius = _v }
-        case 5:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { centerTail = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = naturalSize { _w.bytesField(1, _x.encoded()) }
-        if let _x = tailPosition { _w.bytesField(2, _x.encoded()) }
-        if let _x = tailSize { _w.fixed32Field(3, _x.bitPattern) }
-        if let _x = cornerRadius { _w.fixed32Field(4, _x.bitPattern) }
-        if let _x = centerTail { _w.varintField(5, _x ? 1 : 0) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSD.CalloutPathSourceArchive", [
+        .optional(1, TSP_Size.self), .optional(2, TSP_Point.self), .optional(3, .float), .optional(4, .float),
+        .optional(5, .bool),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 5)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var naturalSize: TSP_Size? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var tailPosition: TSP_Point? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var tailSize: Float? { get { self[2] } set { self[2] = newValue } }
+    var cornerRadius: Float? { get { self[3] } set { self[3] = newValue } }
+    var centerTail: Bool? { get { self[4] } set { self[4] = newValue } }
 }
 
 /// Generated wire model for `TSD.ConnectionLinePathSourceArchive`.
 final class TSD_ConnectionLinePathSourceArchive: IWAMessage {
-    var `super`: TSD_BezierPathSourceArchive?
-    var type: Int32?
-    var outsetFrom: Float?
-    var outsetTo: Float?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSD_BezierPathSourceArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_BezierPathSourceArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { type = _v }
-        case 3:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { outsetFrom = _v }
-        case 4:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { outsetTo = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = type { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = outsetFrom { _w.fixed32Field(3, _x.bitPattern) }
-        if let _x = outsetTo { _w.fixed32Field(4, _x.bitPattern) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSD.ConnectionLinePathSourceArchive", [
+        .optional(1, TSD_BezierPathSourceArchive.self), .optional(2, .int32), .optional(3, .float),
+        .optional(4, .float),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var `super`: TSD_BezierPathSourceArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var type: Int32? { get { self[1] } set { self[1] = newValue } }
+    var outsetFrom: Float? { get { self[2] } set { self[2] = newValue } }
+    var outsetTo: Float? { get { self[3] } set { self[3] = newValue } }
 }
 
 /// Generated wire model for `TSD.EditableBezierPathSourceArchive`.
 final class TSD_EditableBezierPathSourceArchive: IWAMessage {
-    var subpaths: [TSD_EditableBezierPathSourceArchive_Subpath] = []
-    var naturalsize: TSP_Size?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSD_EditableBezierPathSourceArchive_Subpath?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_EditableBezierPathSourceArchive_Subpath(ProtobufMessage(_b)) }
-            if let _v { subpaths.append(_v) }
-        case 2:
-            var _v: TSP_Size?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Size(ProtobufMessage(_b)) }
-            if let _v { naturalsize = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in subpaths { _w.bytesField(1, _x.encoded()) }
-        if let _x = naturalsize { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSD.EditableBezierPathSourceArchive", [
+        .repeated(1, TSD_EditableBezierPathSourceArchive_Subpath.self), .optional(2, TSP_Size.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var subpaths: [TSD_EditableBezierPathSourceArchive_Subpath] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(subpaths value: TSD_EditableBezierPathSourceArchive_Subpath) { append(value, toMessages: 0) }
+    var naturalsize: TSP_Size? { get { self[message: 1] } set { self[message: 1] = newValue } }
 }
 
 /// Generated wire model for `TSD.EditableBezierPathSourceArchive.Node`.
 final class TSD_EditableBezierPathSourceArchive_Node: IWAMessage {
-    var incontrolpoint: TSP_Point?
-    var nodepoint: TSP_Point?
-    var outcontrolpoint: TSP_Point?
-    var type: Int32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Point?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Point(ProtobufMessage(_b)) }
-            if let _v { incontrolpoint = _v }
-        case 2:
-            var _v: TSP_Point?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Point(ProtobufMessage(_b)) }
-            if let _v { nodepoint = _v }
-        case 3:
-            var _v: TSP_Point?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Point(ProtobufMessage(_b)) }
-            if let _v { outcontrolpoint = _v }
-        case 4:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { type = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = incontrolpoint { _w.bytesField(1, _x.encoded()) }
-        if let _x = nodepoint { _w.bytesField(2, _x.encoded()) }
-        if let _x = outcontrolpoint { _w.bytesField(3, _x.encoded()) }
-        if let _x = type { _w.varintField(4, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSD.EditableBezierPathSourceArchive.Node", [
+        .optional(1, TSP_Point.self), .optional(2, TSP_Point.self), .optional(3, TSP_Point.self), .optional(4, .int32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var incontrolpoint: TSP_Point? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var nodepoint: TSP_Point? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var outcontrolpoint: TSP_Point? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var type: Int32? { get { self[3] } set { self[3] = newValue } }
 }
 
 /// Generated wire model for `TSD.EditableBezierPathSourceArchive.Subpath`.
 final class TSD_EditableBezierPathSourceArchive_Subpath: IWAMessage {
-    var nodes: [TSD_EditableBezierPathSourceArchive_Node] = []
-    var closed: Bool?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSD_EditableBezierPathSourceArchive_Node?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_EditableBezierPathSourceArchive_Node(ProtobufMessage(_b)) }
-            if let _v { nodes.append(_v) }
-        case 2:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { closed = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in nodes { _w.bytesField(1, _x.encoded()) }
-        if let _x = closed { _w.varintField(2, _x ? 1 : 0) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSD.EditableBezierPathSourceArchive.Subpath", [
+        .repeated(1, TSD_EditableBezierPathSourceArchive_Node.self), .optional(2, .bool),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var nodes: [TSD_EditableBezierPathSourceArchive_Node] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(nodes value: TSD_EditableBezierPathSourceArchive_Node) { append(value, toMessages: 0) }
+    var closed: Bool? { get { self[1] } set { self[1] = newValue } }
 }
 
 /// Generated wire model for `TSD.PathSourceArchive`.
 final class TSD_PathSourceArchive: IWAMessage {
-    var horizontalflip: Bool?
-    var verticalflip: Bool?
-    var pointPathSource: TSD_PointPathSourceArchive?
-    var scalarPathSource: TSD_ScalarPathSourceArchive?
-    var bezierPathSource: TSD_BezierPathSourceArchive?
-    var calloutPathSource: TSD_CalloutPathSourceArchive?
-    var connectionLinePathSource: TSD_ConnectionLinePathSourceArchive?
-    var editableBezierPathSource: TSD_EditableBezierPathSourceArchive?
-    var localizationkey: String?
-    var userdefinedname: String?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { horizontalflip = _v }
-        case 2:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { verticalflip = _v }
-        case 3:
-            var _v: TSD_PointPathSourceArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_PointPathSourceArchive(ProtobufMessage(_b)) }
-            if let _v { pointPathSource = _v }
-        case 4:
-            var _v: TSD_ScalarPathSourceArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_ScalarPathSourceArchive(ProtobufMessage(_b)) }
-            if let _v { scalarPathSource = _v }
-        case 5:
-            var _v: TSD_BezierPathSourceArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_BezierPathSourceArchive(ProtobufMessage(_b)) }
-            if let _v { bezierPathSource = _v }
-        case 6:
-            var _v: TSD_CalloutPathSourceArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_CalloutPathSourceArchive(ProtobufMessage(_b)) }
-            if let _v { calloutPathSource = _v }
-        case 7:
-            var _v: TSD_ConnectionLinePathSourceArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_ConnectionLinePathSourceArchive(ProtobufMessage(_b)) }
-            if let _v { connectionLinePathSource = _v }
-        case 8:
-            var _v: TSD_EditableBezierPathSourceArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_EditableBezierPathSourceArchive(ProtobufMessage(_b)) }
-            if let _v { editableBezierPathSource = _v }
-        case 9:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { localizationkey = _v }
-        case 10:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { userdefinedname = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = horizontalflip { _w.varintField(1, _x ? 1 : 0) }
-        if let _x = verticalflip { _w.varintField(2, _x ? 1 : 0) }
-        if let _x = pointPathSource { _w.bytesField(3, _x.encoded()) }
-        if let _x = scalarPathSource { _w.bytesField(4, _x.encoded()) }
-        if let _x = bezierPathSource { _w.bytesField(5, _x.encoded()) }
-        if let _x = calloutPathSource { _w.bytesField(6, _x.encoded()) }
-        if let _x = connectionLinePathSource { _w.bytesField(7, _x.encoded()) }
-        if let _x = editableBezierPathSource { _w.bytesField(8, _x.encoded()) }
-        if let _x = localizationkey { _w.stringField(9, _x) }
-        if let _x = userdefinedname { _w.stringField(10, _x) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSD.PathSourceArchive", [
+        .optional(1, .bool), .optional(2, .bool), .optional(3, TSD_PointPathSourceArchive.self),
+        .optional(4, TSD_ScalarPathSourceArchive.self), .optional(5, TSD_BezierPathSourceArchive.self),
+        .optional(6, TSD_CalloutPathSourceArchive.self), .optional(7, TSD_ConnectionLinePathSourceArchive.self),
+        .optional(8, TSD_EditableBezierPathSourceArchive.self), .optional(9, .string), .optional(10, .string),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 10)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var horizontalflip: Bool? { get { self[0] } set { self[0] = newValue } }
+    var verticalflip: Bool? { get { self[1] } set { self[1] = newValue } }
+    var pointPathSource: TSD_PointPathSourceArchive? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var scalarPathSource: TSD_ScalarPathSourceArchive? { get { self[message: 3] } set { self[message: 3] = newValue } }
+    var bezierPathSource: TSD_BezierPathSourceArchive? { get { self[message: 4] } set { self[message: 4] = newValue } }
+    var calloutPathSource: TSD_CalloutPathSourceArchive? { get { self[message: 5] } set { self[message: 5] = newValue } }
+    var connectionLinePathSource: TSD_ConnectionLinePathSourceArchive? { get { self[message: 6] } set { self[message: 6] = newValue } }
+    var editableBezierPathSource: TSD_EditableBezierPathSourceArchive? { get { self[message: 7] } set { self[message: 7] = newValue } }
+    var localizationkey: String? { get { self[8] } set { self[8] = newValue } }
+    var userdefinedname: String? { get { self[9] } set { self[9] = newValue } }
 }
 
 /// Generated wire model for `TSD.AngleGradientArchive`.
 final class TSD_AngleGradientArchive: IWAMessage {
-    var gradientangle: Float?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 2:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { gradientangle = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = gradientangle { _w.fixed32Field(2, _x.bitPattern) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSD.AngleGradientArchive", [
+        .optional(2, .float),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var gradientangle: Float? { get { self[0] } set { self[0] = newValue } }
 }
 
 /// Generated wire model for `TSD.TransformGradientArchive`.
 final class TSD_TransformGradientArchive: IWAMessage {
-    var start: TSP_Point?
-    var end: TSP_Point?
-    var basenaturalsize: TSP_Size?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Point?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Point(ProtobufMessage(_b)) }
-            if let _v { start = _v }
-        case 2:
-            var _v: TSP_Point?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Point(ProtobufMessage(_b)) }
-            if let _v { end = _v }
-        case 3:
-            var _v: TSP_Size?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Size(ProtobufMessage(_b)) }
-            if let _v { basenaturalsize = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = start { _w.bytesField(1, _x.encoded()) }
-        if let _x = end { _w.bytesField(2, _x.encoded()) }
-        if let _x = basenaturalsize { _w.bytesField(3, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSD.TransformGradientArchive", [
+        .optional(1, TSP_Point.self), .optional(2, TSP_Point.self), .optional(3, TSP_Size.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var start: TSP_Point? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var end: TSP_Point? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var basenaturalsize: TSP_Size? { get { self[message: 2] } set { self[message: 2] = newValue } }
 }
 
 /// Generated wire model for `TSD.GradientArchive`.
 final class TSD_GradientArchive: IWAMessage {
-    var type: Int32?
-    var stops: [TSD_GradientArchive_GradientStop] = []
-    var opacity: Float?
-    var advancedgradient: Bool?
-    var anglegradient: TSD_AngleGradientArchive?
-    var transformgradient: TSD_TransformGradientArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { type = _v }
-        case 2:
-            var _v: TSD_GradientArchive_GradientStop?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_GradientArchive_GradientStop(ProtobufMessage(_b)) }
-            if let _v { stops.append(_v) }
-        case 3:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { opacity = _v }
-        case 4:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { advancedgradient = _v }
-        case 5:
-            var _v: TSD_AngleGradientArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_AngleGradientArchive(ProtobufMessage(_b)) }
-            if let _v { anglegradient = _v }
-        case 6:
-            var _v: TSD_TransformGradientArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_TransformGradientArchive(ProtobufMessage(_b)) }
-            if let _v { transformgradient = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = type { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        for _x in stops { _w.bytesField(2, _x.encoded()) }
-        if let _x = opacity { _w.fixed32Field(3, _x.bitPattern) }
-        if let _x = advancedgradient { _w.varintField(4, _x ? 1 : 0) }
-        if let _x = anglegradient { _w.bytesField(5, _x.encoded()) }
-        if let _x = transformgradient { _w.bytesField(6, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSD.GradientArchive", [
+        .optional(1, .int32), .repeated(2, TSD_GradientArchive_GradientStop.self), .optional(3, .float),
+        .optional(4, .bool), .optional(5, TSD_AngleGradientArchive.self),
+        .optional(6, TSD_TransformGradientArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 6)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var type: Int32? { get { self[0] } set { self[0] = newValue } }
+    var stops: [TSD_GradientArchive_GradientStop] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(stops value: TSD_GradientArchive_GradientStop) { append(value, toMessages: 1) }
+    var opacity: Float? { get { self[2] } set { self[2] = newValue } }
+    var advancedgradient: Bool? { get { self[3] } set { self[3] = newValue } }
+    var anglegradient: TSD_AngleGradientArchive? { get { self[message: 4] } set { self[message: 4] = newValue } }
+    var transformgradient: TSD_TransformGradientArchive? { get { self[message: 5] } set { self[message: 5] = newValue } }
 }
 
 /// Generated wire model for `TSD.GradientArchive.GradientStop`.
 final class TSD_GradientArchive_GradientStop: IWAMessage {
-    var color: TSP_Color?
-    var fraction: Float?
-    var inflection: Float?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Color?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Color(ProtobufMessage(_b)) }
-            if let _v { color = _v }
-        case 2:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { fraction = _v }
-        case 3:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { inflection = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = color { _w.bytesField(1, _x.encoded()) }
-        if let _x = fraction { _w.fixed32Field(2, _x.bitPattern) }
-        if let _x = inflection { _w.fixed32Field(3, _x.bitPattern) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSD.GradientArchive.GradientStop", [
+        .optional(1, TSP_Color.self), .optional(2, .float), .optional(3, .float),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var color: TSP_Color? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var fraction: Float? { get { self[1] } set { self[1] = newValue } }
+    var inflection: Float? { get { self[2] } set { self[2] = newValue } }
 }
 
 /// Generated wire model for `TSD.ImageFillArchive`.
 final class TSD_ImageFillArchive: IWAMessage {
-    var imagedata: TSP_DataReference?
-    var technique: Int32?
-    var tint: TSP_Color?
-    var fillsize: TSP_Size?
-    var originalimagedata: TSP_DataReference?
-    var interpretsuntaggedimagedataasgeneric: Bool?
-    var referencecolor: TSP_Color?
-    var databaseImagedata: TSP_Reference?
-    var databaseOriginalimagedata: TSP_Reference?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 6:
-            var _v: TSP_DataReference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_DataReference(ProtobufMessage(_b)) }
-            if let _v { imagedata = _v }
-        case 2:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { technique = _v }
-        case 3:
-            var _v: TSP_Color?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Color(ProtobufMessage(_b)) }
-            if let _v { tint = _v }
-        case 4:
-            var _v: TSP_Size?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Size(ProtobufMessage(_b)) }
-            if let _v { fillsize = _v }
-        case 7:
-            var _v: TSP_DataReference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_DataReference(ProtobufMessage(_b)) }
-            if let _v { originalimagedata = _v }
-        case 8:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { interpretsuntaggedimagedataasgeneric = _v }
-        case 9:
-            var _v: TSP_Color?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Color(ProtobufMessage(_b)) }
-            if let _v { referencecolor = _v }
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { databaseImagedata = _v }
-        case 5:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { databaseOriginalimagedata = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = imagedata { _w.bytesField(6, _x.encoded()) }
-        if let _x = technique { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = tint { _w.bytesField(3, _x.encoded()) }
-        if let _x = fillsize { _w.bytesField(4, _x.encoded()) }
-        if let _x = originalimagedata { _w.bytesField(7, _x.encoded()) }
-        if let _x = interpretsuntaggedimagedataasgeneric { _w.varintField(8, _x ? 1 : 0) }
-        if let _x = referencecolor { _w.bytesField(9, _x.encoded()) }
-        if let _x = databaseImagedata { _w.bytesField(1, _x.encoded()) }
-        if let _x = databaseOriginalimagedata { _w.bytesField(5, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSD.ImageFillArchive", [
+        .optional(6, TSP_DataReference.self), .optional(2, .int32), .optional(3, TSP_Color.self),
+        .optional(4, TSP_Size.self), .optional(7, TSP_DataReference.self), .optional(8, .bool),
+        .optional(9, TSP_Color.self), .optional(1, TSP_Reference.self), .optional(5, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 9)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var imagedata: TSP_DataReference? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var technique: Int32? { get { self[1] } set { self[1] = newValue } }
+    var tint: TSP_Color? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var fillsize: TSP_Size? { get { self[message: 3] } set { self[message: 3] = newValue } }
+    var originalimagedata: TSP_DataReference? { get { self[message: 4] } set { self[message: 4] = newValue } }
+    var interpretsuntaggedimagedataasgeneric: Bool? { get { self[5] } set { self[5] = newValue } }
+    var referencecolor: TSP_Color? { get { self[message: 6] } set { self[message: 6] = newValue } }
+    var databaseImagedata: TSP_Reference? { get { self[message: 7] } set { self[message: 7] = newValue } }
+    var databaseOriginalimagedata: TSP_Reference? { get { self[message: 8] } set { self[message: 8] = newValue } }
 }
 
 /// Generated wire model for `TSD.FillArchive`.
 final class TSD_FillArchive: IWAMessage {
-    var color: TSP_Color?
-    var gradient: TSD_GradientArchive?
-    var image: TSD_ImageFillArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Color?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Color(ProtobufMessage(_b)) }
-            if let _v { color = _v }
-        case 2:
-            var _v: TSD_GradientArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_GradientArchive(ProtobufMessage(_b)) }
-            if let _v { gradient = _v }
-        case 3:
-            var _v: TSD_ImageFillArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_ImageFillArchive(ProtobufMessage(_b)) }
-            if let _v { image = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = color { _w.bytesField(1, _x.encoded()) }
-        if let _x = gradient { _w.bytesField(2, _x.encoded()) }
-        if let _x = image { _w.bytesField(3, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSD.FillArchive", [
+        .optional(1, TSP_Color.self), .optional(2, TSD_GradientArchive.self), .optional(3, TSD_ImageFillArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var color: TSP_Color? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var gradient: TSD_GradientArchive? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var image: TSD_ImageFillArchive? { get { self[message: 2] } set { self[message: 2] = newValue } }
 }
 
 /// Generated wire model for `TSD.StrokePatternArchive`.
 final class TSD_StrokePatternArchive: IWAMessage {
-    var type: Int32?
-    var phase: Float?
-    var count: UInt32?
-    var pattern: [Float] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { type = _v }
-        case 2:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { phase = _v }
-        case 3:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { count = _v }
-        case 4:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { pattern.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = type { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = phase { _w.fixed32Field(2, _x.bitPattern) }
-        if let _x = count { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        for _x in pattern { _w.fixed32Field(4, _x.bitPattern) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSD.StrokePatternArchive", [
+        .optional(1, .int32), .optional(2, .float), .optional(3, .uint32), .repeated(4, .float),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var type: Int32? { get { self[0] } set { self[0] = newValue } }
+    var phase: Float? { get { self[1] } set { self[1] = newValue } }
+    var count: UInt32? { get { self[2] } set { self[2] = newValue } }
+    var pattern: [Float] { get { self[all: 3] } set { self[all: 3] = newValue } }
+    func append(pattern value: Float) { append(value, toAll: 3) }
 }
 
 /// Generated wire model for `TSD.StrokeArchive`.
 final class TSD_StrokeArchive: IWAMessage {
-    var color: TSP_Color?
-    var width: Float?
-    var cap: Int32?
-    var join: Int32?
-    var miterLimit: Float?
-    var pattern: TSD_StrokePatternArchive?
-    var smartStroke: TSD_SmartStrokeArchive?
-    var frame: TSD_FrameArchive?
-    var patternedStroke: TSD_PatternedStrokeArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Color?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Color(ProtobufMessage(_b)) }
-            if let _v { color = _v }
-        case 2:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { width = _v }
-        case 3:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { cap = _v }
-        case 4:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { join = _v }
-        case 5:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { miterLimit = _v }
-        case 6:
-            var _v: TSD_StrokePatternArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_StrokePatternArchive(ProtobufMessage(_b)) }
-            if let _v { pattern = _v }
-        case 7:
-            var _v: TSD_SmartStrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_SmartStrokeArchive(ProtobufMessage(_b)) }
-            if let _v { smartStroke = _v }
-        case 8:
-            var _v: TSD_FrameArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_FrameArchive(ProtobufMessage(_b)) }
-            if let _v { frame = _v }
-        case 9:
-            var _v: TSD_PatternedStrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_PatternedStrokeArchive(ProtobufMessage(_b)) }
-            if let _v { patternedStroke = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = color { _w.bytesField(1, _x.encoded()) }
-        if let _x = width { _w.fixed32Field(2, _x.bitPattern) }
-        if let _x = cap { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = join { _w.varintField(4, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = miterLimit { _w.fixed32Field(5, _x.bitPattern) }
-        if let _x = pattern { _w.bytesField(6, _x.encoded()) }
-        if let _x = smartStroke { _w.bytesField(7, _x.encoded()) }
-        if let _x = frame { _w.bytesField(8, _x.encoded()) }
-        if let _x = patternedStroke { _w.bytesField(9, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSD.StrokeArchive", [
+        .optional(1, TSP_Color.self), .optional(2, .float), .optional(3, .int32), .optional(4, .int32),
+        .optional(5, .float), .optional(6, TSD_StrokePatternArchive.self), .optional(7, TSD_SmartStrokeArchive.self),
+        .optional(8, TSD_FrameArchive.self), .optional(9, TSD_PatternedStrokeArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 9)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var color: TSP_Color? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var width: Float? { get { self[1] } set { self[1] = newValue } }
+    var cap: Int32? { get { self[2] } set { self[2] = newValue } }
+    var join: Int32? { get { self[3] } set { self[3] = newValue } }
+    var miterLimit: Float? { get { self[4] } set { self[4] = newValue } }
+    var pattern: TSD_StrokePatternArchive? { get { self[message: 5] } set { self[message: 5] = newValue } }
+    var smartStroke: TSD_SmartStrokeArchive? { get { self[message: 6] } set { self[message: 6] = newValue } }
+    var frame: TSD_FrameArchive? { get { self[message: 7] } set { self[message: 7] = newValue } }
+    var patternedStroke: TSD_PatternedStrokeArchive? { get { self[message: 8] } set { self[message: 8] = newValue } }
 }
 
 /// Generated wire model for `TSD.SmartStrokeArchive`.
 final class TSD_SmartStrokeArchive: IWAMessage {
-    var strokeName: String?
-    var randomSeed: UInt32?
-    var parametervalues: TSP_ReferenceDictionary?
-    var patternOffsetDistance: Double?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 2:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { strokeName = _v }
-        case 3:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { randomSeed = _v }
-        case 4:
-            var _v: TSP_ReferenceDictionary?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_ReferenceDictionary(ProtobufMessage(_b)) }
-            if let _v { parametervalues = _v }
-        case 5:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { patternOffsetDistance = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = strokeName { _w.stringField(2, _x) }
-        if let _x = randomSeed { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = parametervalues { _w.bytesField(4, _x.encoded()) }
-        if let _x = patternOffsetDistance { _w.fixed64Field(5, _x.bitPattern) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSD.SmartStrokeArchive", [
+        .optional(2, .string), .optional(3, .uint32), .optional(4, TSP_ReferenceDictionary.self), .optional(5, .double),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var strokeName: String? { get { self[0] } set { self[0] = newValue } }
+    var randomSeed: UInt32? { get { self[1] } set { self[1] = newValue } }
+    var parametervalues: TSP_ReferenceDictionary? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var patternOffsetDistance: Double? { get { self[3] } set { self[3] = newValue } }
 }
 
 /// Generated wire model for `TSD.FrameArchive`.
 final class TSD_FrameArchive: IWAMessage {
-    var framename: String?
-    var assetscale: Float?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 2:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { framename = _v }
-        case 3:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { assetscale = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = framename { _w.stringField(2, _x) }
-        if let _x = assetscale { _w.fixed32Field(3, _x.bitPattern) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSD.FrameArchive", [
+        .optional(2, .string), .optional(3, .float),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var framename: String? { get { self[0] } set { self[0] = newValue } }
+    var assetscale: Float? { get { self[1] } set { self[1] = newValue } }
 }
 
 /// Generated wire model for `TSD.PatternedStrokeArchive`.
 final class TSD_PatternedStrokeArchive: IWAMessage {
-    var patternName: String?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 2:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { patternName = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = patternName { _w.stringField(2, _x) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSD.PatternedStrokeArchive", [
+        .optional(2, .string),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var patternName: String? { get { self[0] } set { self[0] = newValue } }
 }
 
 /// Generated wire model for `TSD.LineEndArchive`.
 final class TSD_LineEndArchive: IWAMessage {
-    var path: TSP_Path?
-    var lineJoin: Int32?
-    var endPoint: TSP_Point?
-    var isFilled: Bool?
-    var identifier: String?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Path?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Path(ProtobufMessage(_b)) }
-            if let _v { path = _v }
-        case 2:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { lineJoin = _v }
-        case 3:
-            var _v: TSP_Point?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Point(ProtobufMessage(_b)) }
-            if let _v { endPoint = _v }
-        case 4:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { isFilled = _v }
-        case 5:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { identifier = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = path { _w.bytesField(1, _x.encoded()) }
-        if let _x = lineJoin { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = endPoint { _w.bytesField(3, _x.encoded()) }
-        if let _x = isFilled { _w.varintField(4, _x ? 1 : 0) }
-        if let _x = identifier { _w.stringField(5, _x) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSD.LineEndArchive", [
+        .optional(1, TSP_Path.self), .optional(2, .int32), .optional(3, TSP_Point.self), .optional(4, .bool),
+        .optional(5, .string),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 5)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var path: TSP_Path? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var lineJoin: Int32? { get { self[1] } set { self[1] = newValue } }
+    var endPoint: TSP_Point? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var isFilled: Bool? { get { self[3] } set { self[3] = newValue } }
+    var identifier: String? { get { self[4] } set { self[4] = newValue } }
 }
 
 /// Generated wire model for `TSD.ShadowArchive`.
 final class TSD_ShadowArchive: IWAMessage {
-    var color: TSP_Color?
-    var angle: Float?
-    var offset: Float?
-    var radius: Int32?
-    var opacity: Float?
-    var isEnabled: Bool?
-    var type: Int32?
-    var dropshadow: TSD_DropShadowArchive?
-    var contactshadow: TSD_ContactShadowArchive?
-    var curvedshadow: TSD_CurvedShadowArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Color?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Color(ProtobufMessage(_b)) }
-            if let _v { color = _v }
-        case 2:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { angle = _v }
-        case 3:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { offset = _v }
-        case 4:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { radius = _v }
-        case 5:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { opacity = _v }
-        case 6:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { isEnabled = _v }
-        case 7:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { type = _v }
-        case 8:
-            var _v: TSD_DropShadowArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_DropShadowArchive(ProtobufMessage(_b)) }
-            if let _v { dropshadow = _v }
-        case 9:
-            var _v: TSD_ContactShadowArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_ContactShadowArchive(ProtobufMessage(_b)) }
-            if let _v { contactshadow = _v }
-        case 10:
-            var _v: TSD_CurvedShadowArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_CurvedShadowArchive(ProtobufMessage(_b)) }
-            if let _v { curvedshadow = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = color { _w.bytesField(1, _x.encoded()) }
-        if let _x = angle { _w.fixed32Field(2, _x.bitPattern) }
-        if let _x = offset { _w.fixed32Field(3, _x.bitPattern) }
-        if let _x = radius { _w.varintField(4, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = opacity { _w.fixed32Field(5, _x.bitPattern) }
-        if let _x = isEnabled { _w.varintField(6, _x ? 1 : 0) }
-        if let _x = type { _w.varintField(7, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = dropshadow { _w.bytesField(8, _x.encoded()) }
-        if let _x = contactshadow { _w.bytesField(9, _x.encoded()) }
-        if let _x = curvedshadow { _w.bytesField(10, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSD.ShadowArchive", [
+        .optional(1, TSP_Color.self), .optional(2, .float), .optional(3, .float), .optional(4, .int32),
+        .optional(5, .float), .optional(6, .bool), .optional(7, .int32), .optional(8, TSD_DropShadowArchive.self),
+        .optional(9, TSD_ContactShadowArchive.self), .optional(10, TSD_CurvedShadowArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 10)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var color: TSP_Color? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var angle: Float? { get { self[1] } set { self[1] = newValue } }
+    var offset: Float? { get { self[2] } set { self[2] = newValue } }
+    var radius: Int32? { get { self[3] } set { self[3] = newValue } }
+    var opacity: Float? { get { self[4] } set { self[4] = newValue } }
+    var isEnabled: Bool? { get { self[5] } set { self[5] = newValue } }
+    var type: Int32? { get { self[6] } set { self[6] = newValue } }
+    var dropshadow: TSD_DropShadowArchive? { get { self[message: 7] } set { self[message: 7] = newValue } }
+    var contactshadow: TSD_ContactShadowArchive? { get { self[message: 8] } set { self[message: 8] = newValue } }
+    var curvedshadow: TSD_CurvedShadowArchive? { get { self[message: 9] } set { self[message: 9] = newValue } }
 }
 
 /// Generated wire model for `TSD.DropShadowArchive`.
 final class TSD_DropShadowArchive: IWAMessage {
-
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSD.DropShadowArchive", [])
+    var _values = [IWAValue](repeating: .absent, count: 0)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
 }
 
 /// Generated wire model for `TSD.ContactShadowArchive`.
 final class TSD_ContactShadowArchive: IWAMessage {
-    var height: Float?
-    var offset: Float?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 2:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { height = _v }
-        case 4:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { offset = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = height { _w.fixed32Field(2, _x.bitPattern) }
-        if let _x = offset { _w.fixed32Field(4, _x.bitPattern) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSD.ContactShadowArchive", [
+        .optional(2, .float), .optional(4, .float),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var height: Float? { get { self[0] } set { self[0] = newValue } }
+    var offset: Float? { get { self[1] } set { self[1] = newValue } }
 }
 
 /// Generated wire model for `TSD.CurvedShadowArchive`.
 final class TSD_CurvedShadowArchive: IWAMessage {
-    var curve: Float?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { curve = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = curve { _w.fixed32Field(1, _x.bitPattern) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSD.CurvedShadowArchive", [
+        .optional(1, .float),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var curve: Float? { get { self[0] } set { self[0] = newValue } }
 }
 
 /// Generated wire model for `TSD.ReflectionArchive`.
 final class TSD_ReflectionArchive: IWAMessage {
-    var opacity: Float?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { opacity = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = opacity { _w.fixed32Field(1, _x.bitPattern) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSD.ReflectionArchive", [
+        .optional(1, .float),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var opacity: Float? { get { self[0] } set { self[0] = newValue } }
 }
 
 /// Generated wire model for `TSD.ImageAdjustmentsArchive`.
 final class TSD_ImageAdjustmentsArchive: IWAMessage {
-    var exposure: Float?
-    var saturation: Float?
-    var contrast: Float?
-    var highlights: Float?
-    var shadows: Float?
-    var sharpness: Float?
-    var denoise: Float?
-    var temperature: Float?
-    var tint: Float?
-    var bottomLevel: Float?
-    var topLevel: Float?
-    var gamma: Float?
-    var enhance: Bool?
-    var representsSageAdjustments: Bool?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { exposure = _v }
-        case 2:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { saturation = _v }
-        case 3:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { contrast = _v }
-        case 4:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { highlights = _v }
-        case 5:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { shadows = _v }
-        case 6:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { sharpness = _v }
-        case 7:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { denoise = _v }
-        case 8:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { temperature = _v }
-        case 9:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { tint = _v }
-        case 10:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { bottomLevel = _v }
-        case 11:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { topLevel = _v }
-        case 12:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { gamma = _v }
-        case 13:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { enhance = _v }
-        case 14:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { representsSageAdjustments = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = exposure { _w.fixed32Field(1, _x.bitPattern) }
-        if let _x = saturation { _w.fixed32Field(2, _x.bitPattern) }
-        if let _x = contrast { _w.fixed32Field(3, _x.bitPattern) }
-        if let _x = highlights { _w.fixed32Field(4, _x.bitPattern) }
-        if let _x = shadows { _w.fixed32Field(5, _x.bitPattern) }
-        if let _x = sharpness { _w.fixed32Field(6, _x.bitPattern) }
-        if let _x = denoise { _w.fixed32Field(7, _x.bitPattern) }
-        if let _x = temperature { _w.fixed32Field(8, _x.bitPattern) }
-        if let _x = tint { _w.fixed32Field(9, _x.bitPattern) }
-        if let _x = bottomLevel { _w.fixed32Field(10, _x.bitPattern) }
-        if let _x = topLevel { _w.fixed32Field(11, _x.bitPattern) }
-        if let _x = gamma { _w.fixed32Field(12, _x.bitPattern) }
-        if let _x = enhance { _w.varintField(13, _x ? 1 : 0) }
-        if let _x = representsSageAdjustments { _w.varintField(14, _x ? 1 : 0) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSD.ImageAdjustmentsArchive", [
+        .optional(1, .float), .optional(2, .float), .optional(3, .float), .optional(4, .float), .optional(5, .float),
+        .optional(6, .float), .optional(7, .float), .optional(8, .float), .optional(9, .float), .optional(10, .float),
+        .optional(11, .float), .optional(12, .float), .optional(13, .bool), .optional(14, .bool),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 14)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var exposure: Float? { get { self[0] } set { self[0] = newValue } }
+    var saturation: Float? { get { self[1] } set { self[1] = newValue } }
+    var contrast: Float? { get { self[2] } set { self[2] = newValue } }
+    var highlights: Float? { get { self[3] } set { self[3] = newValue } }
+    var shadows: Float? { get { self[4] } set { self[4] = newValue } }
+    var sharpness: Float? { get { self[5] } set { self[5] = newValue } }
+    var denoise: Float? { get { self[6] } set { self[6] = newValue } }
+    var temperature: Float? { get { self[7] } set { self[7] = newValue } }
+    var tint: Float? { get { self[8] } set { self[8] = newValue } }
+    var bottomLevel: Float? { get { self[9] } set { self[9] = newValue } }
+    var topLevel: Float? { get { self[10] } set { self[10] = newValue } }
+    var gamma: Float? { get { self[11] } set { self[11] = newValue } }
+    var enhance: Bool? { get { self[12] } set { self[12] = newValue } }
+    var representsSageAdjustments: Bool? { get { self[13] } set { self[13] = newValue } }
 }
 
 /// Generated wire model for `TSD.ShapeStylePropertiesArchive`.
 final class TSD_ShapeStylePropertiesArchive: IWAMessage {
-    var fill: TSD_FillArchive?
-    var stroke: TSD_StrokeArchive?
-    var opacity: Float?
-    var shadow: TSD_ShadowArchive?
-    var reflection: TSD_ReflectionArchive?
-    var headLineEnd: TSD_LineEndArchive?
-    var tailLineEnd: TSD_LineEndArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSD_FillArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_FillArchive(ProtobufMessage(_b)) }
-            if let _v { fill = _v }
-        case 2:
-            var _v: TSD_StrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_StrokeArchive(ProtobufMessage(_b)) }
-            if let _v { stroke = _v }
-        case 3:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { opacity = _v }
-        case 4:
-            var _v: TSD_ShadowArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_ShadowArchive(ProtobufMessage(_b)) }
-            if let _v { shadow = _v }
-        case 5:
-            var _v: TSD_ReflectionArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_ReflectionArchive(ProtobufMessage(_b)) }
-            if let _v { reflection = _v }
-        case 6:
-            var _v: TSD_LineEndArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_LineEndArchive(ProtobufMessage(_b)) }
-            if let _v { headLineEnd = _v }
-        case 7:
-            var _v: TSD_LineEndArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_LineEndArchive(ProtobufMessage(_b)) }
-            if let _v { tailLineEnd = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = fill { _w.bytesField(1, _x.encoded()) }
-        if let _x = stroke { _w.bytesField(2, _x.encoded()) }
-        if let _x = opacity { _w.fixed32Field(3, _x.bitPattern) }
-        if let _x = shadow { _w.bytesField(4, _x.encoded()) }
-        if let _x = reflection { _w.bytesField(5, _x.encoded()) }
-        if let _x = headLineEnd { _w.bytesField(6, _x.encoded()) }
-        if let _x = tailLineEnd { _w.bytesField(7, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSD.ShapeStylePropertiesArchive", [
+        .optional(1, TSD_FillArchive.self), .optional(2, TSD_StrokeArchive.self), .optional(3, .float),
+        .optional(4, TSD_ShadowArchive.self), .optional(5, TSD_ReflectionArchive.self),
+        .optional(6, TSD_LineEndArchive.self), .optional(7, TSD_LineEndArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 7)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var fill: TSD_FillArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var stroke: TSD_StrokeArchive? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var opacity: Float? { get { self[2] } set { self[2] = newValue } }
+    var shadow: TSD_ShadowArchive? { get { self[message: 3] } set { self[message: 3] = newValue } }
+    var reflection: TSD_ReflectionArchive? { get { self[message: 4] } set { self[message: 4] = newValue } }
+    var headLineEnd: TSD_LineEndArchive? { get { self[message: 5] } set { self[message: 5] = newValue } }
+    var tailLineEnd: TSD_LineEndArchive? { get { self[message: 6] } set { self[message: 6] = newValue } }
 }
 
 /// Generated wire model for `TSD.ShapeStyleArchive`.
 final class TSD_ShapeStyleArchive: IWAMessage {
-    var `super`: TSS_StyleArchive?
-    var overrideCount: UInt32?
-    var shapeProperties: TSD_ShapeStylePropertiesArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSS_StyleArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSS_StyleArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 10:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { overrideCount = _v }
-        case 11:
-            var _v: TSD_ShapeStylePropertiesArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_ShapeStylePropertiesArchive(ProtobufMessage(_b)) }
-            if let _v { shapeProperties = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = overrideCount { _w.varintField(10, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = shapeProperties { _w.bytesField(11, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSD.ShapeStyleArchive", [
+        .optional(1, TSS_StyleArchive.self), .optional(10, .uint32),
+        .optional(11, TSD_ShapeStylePropertiesArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var `super`: TSS_StyleArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var overrideCount: UInt32? { get { self[1] } set { self[1] = newValue } }
+    var shapeProperties: TSD_ShapeStylePropertiesArchive? { get { self[message: 2] } set { self[message: 2] = newValue } }
 }
 
 /// Generated wire model for `TSD.MediaStylePropertiesArchive`.
 final class TSD_MediaStylePropertiesArchive: IWAMessage {
-    var stroke: TSD_StrokeArchive?
-    var opacity: Float?
-    var shadow: TSD_ShadowArchive?
-    var reflection: TSD_ReflectionArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSD_StrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_StrokeArchive(ProtobufMessage(_b)) }
-            if let _v { stroke = _v }
-        case 2:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { opacity = _v }
-        case 3:
-            var _v: TSD_ShadowArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_ShadowArchive(ProtobufMessage(_b)) }
-            if let _v { shadow = _v }
-        case 4:
-            var _v: TSD_ReflectionArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_ReflectionArchive(ProtobufMessage(_b)) }
-            if let _v { reflection = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = stroke { _w.bytesField(1, _x.encoded()) }
-        if let _x = opacity { _w.fixed32Field(2, _x.bitPattern) }
-        if let _x = shadow { _w.bytesField(3, _x.encoded()) }
-        if let _x = reflection { _w.bytesField(4, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSD.MediaStylePropertiesArchive", [
+        .optional(1, TSD_StrokeArchive.self), .optional(2, .float), .optional(3, TSD_ShadowArchive.self),
+        .optional(4, TSD_ReflectionArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var stroke: TSD_StrokeArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var opacity: Float? { get { self[1] } set { self[1] = newValue } }
+    var shadow: TSD_ShadowArchive? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var reflection: TSD_ReflectionArchive? { get { self[message: 3] } set { self[message: 3] = newValue } }
 }
 
 /// Generated wire model for `TSD.MediaStyleArchive`.
 final class TSD_MediaStyleArchive: IWAMessage {
-    var `super`: TSS_StyleArchive?
-    var overrideCount: UInt32?
-    var mediaProperties: TSD_MediaStylePropertiesArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSS_StyleArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSS_StyleArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 10:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { overrideCount = _v }
-        case 11:
-            var _v: TSD_MediaStylePropertiesArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_MediaStylePropertiesArchive(ProtobufMessage(_b)) }
-            if let _v { mediaProperties = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = overrideCount { _w.varintField(10, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = mediaProperties { _w.bytesField(11, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSD.MediaStyleArchive", [
+        .optional(1, TSS_StyleArchive.self), .optional(10, .uint32),
+        .optional(11, TSD_MediaStylePropertiesArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var `super`: TSS_StyleArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var overrideCount: UInt32? { get { self[1] } set { self[1] = newValue } }
+    var mediaProperties: TSD_MediaStylePropertiesArchive? { get { self[message: 2] } set { self[message: 2] = newValue } }
 }
 
 /// Generated wire model for `TSD.ThemePresetsArchive`.
 final class TSD_ThemePresetsArchive: IWAMessage {
-    var gradientFillPresets: [TSD_FillArchive] = []
-    var imageFillPresets: [TSD_FillArchive] = []
-    var shadowPresets: [TSD_ShadowArchive] = []
-    var lineStylePresets: [TSP_Reference] = []
-    var shapeStylePresets: [TSP_Reference] = []
-    var textboxStylePresets: [TSP_Reference] = []
-    var imageStylePresets: [TSP_Reference] = []
-    var movieStylePresets: [TSP_Reference] = []
-    var drawingLineStylePresets: [TSP_Reference] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSD_FillArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_FillArchive(ProtobufMessage(_b)) }
-            if let _v { gradientFillPresets.append(_v) }
-        case 2:
-            var _v: TSD_FillArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_FillArchive(ProtobufMessage(_b)) }
-            if let _v { imageFillPresets.append(_v) }
-        case 3:
-            var _v: TSD_ShadowArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_ShadowArchive(ProtobufMessage(_b)) }
-            if let _v { shadowPresets.append(_v) }
-        case 4:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { lineStylePresets.append(_v) }
-        case 5:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { shapeStylePresets.append(_v) }
-        case 6:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { textboxStylePresets.append(_v) }
-        case 7:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { imageStylePresets.append(_v) }
-        case 8:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { movieStylePresets.append(_v) }
-        case 9:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { drawingLineStylePresets.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in gradientFillPresets { _w.bytesField(1, _x.encoded()) }
-        for _x in imageFillPresets { _w.bytesField(2, _x.encoded()) }
-        for _x in shadowPresets { _w.bytesField(3, _x.encoded()) }
-        for _x in lineStylePresets { _w.bytesField(4, _x.encoded()) }
-        for _x in shapeStylePresets { _w.bytesField(5, _x.encoded()) }
-        for _x in textboxStylePresets { _w.bytesField(6, _x.encoded()) }
-        for _x in imageStylePresets { _w.bytesField(7, _x.encoded()) }
-        for _x in movieStylePresets { _w.bytesField(8, _x.encoded()) }
-        for _x in drawingLineStylePresets { _w.bytesField(9, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSD.ThemePresetsArchive", [
+        .repeated(1, TSD_FillArchive.self), .repeated(2, TSD_FillArchive.self), .repeated(3, TSD_ShadowArchive.self),
+        .repeated(4, TSP_Reference.self), .repeated(5, TSP_Reference.self), .repeated(6, TSP_Reference.self),
+        .repeated(7, TSP_Reference.self), .repeated(8, TSP_Reference.self), .repeated(9, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 9)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var gradientFillPresets: [TSD_FillArchive] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(gradientFillPresets value: TSD_FillArchive) { append(value, toMessages: 0) }
+    var imageFillPresets: [TSD_FillArchive] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(imageFillPresets value: TSD_FillArchive) { append(value, toMessages: 1) }
+    var shadowPresets: [TSD_ShadowArchive] { get { self[messages: 2] } set { self[messages: 2] = newValue } }
+    func append(shadowPresets value: TSD_ShadowArchive) { append(value, toMessages: 2) }
+    var lineStylePresets: [TSP_Reference] { get { self[messages: 3] } set { self[messages: 3] = newValue } }
+    func append(lineStylePresets value: TSP_Reference) { append(value, toMessages: 3) }
+    var shapeStylePresets: [TSP_Reference] { get { self[messages: 4] } set { self[messages: 4] = newValue } }
+    func append(shapeStylePresets value: TSP_Reference) { append(value, toMessages: 4) }
+    var textboxStylePresets: [TSP_Reference] { get { self[messages: 5] } set { self[messages: 5] = newValue } }
+    func append(textboxStylePresets value: TSP_Reference) { append(value, toMessages: 5) }
+    var imageStylePresets: [TSP_Reference] { get { self[messages: 6] } set { self[messages: 6] = newValue } }
+    func append(imageStylePresets value: TSP_Reference) { append(value, toMessages: 6) }
+    var movieStylePresets: [TSP_Reference] { get { self[messages: 7] } set { self[messages: 7] = newValue } }
+    func append(movieStylePresets value: TSP_Reference) { append(value, toMessages: 7) }
+    var drawingLineStylePresets: [TSP_Reference] { get { self[messages: 8] } set { self[messages: 8] = newValue } }
+    func append(drawingLineStylePresets value: TSP_Reference) { append(value, toMessages: 8) }
 }
 
 /// Generated wire model for `TSD.ThemeReplaceFillPresetCommandArchive`.
 final class TSD_ThemeReplaceFillPresetCommandArchive: IWAMessage {
-    var `super`: TSK_CommandArchive?
-    var theme: TSP_Reference?
-    var fill: TSD_FillArchive?
-    var oldFill: TSD_FillArchive?
-    var index: UInt32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSK_CommandArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_CommandArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { theme = _v }
-        case 3:
-            var _v: TSD_FillArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_FillArchive(ProtobufMessage(_b)) }
-            if let _v { fill = _v }
-        case 4:
-            var _v: TSD_FillArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_FillArchive(ProtobufMessage(_b)) }
-            if let _v { oldFill = _v }
-        case 5:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { index = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = theme { _w.bytesField(2, _x.encoded()) }
-        if let _x = fill { _w.bytesField(3, _x.encoded()) }
-        if let _x = oldFill { _w.bytesField(4, _x.encoded()) }
-        if let _x = index { _w.varintField(5, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSD.ThemeReplaceFillPresetCommandArchive", [
+        .optional(1, TSK_CommandArchive.self), .optional(2, TSP_Reference.self), .optional(3, TSD_FillArchive.self),
+        .optional(4, TSD_FillArchive.self), .optional(5, .uint32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 5)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var `super`: TSK_CommandArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var theme: TSP_Reference? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var fill: TSD_FillArchive? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var oldFill: TSD_FillArchive? { get { self[message: 3] } set { self[message: 3] = newValue } }
+    var index: UInt32? { get { self[4] } set { self[4] = newValue } }
 }
 
 /// Generated wire model for `TSD.DrawableArchive`.
 final class TSD_DrawableArchive: IWAMessage {
-    var geometry: TSD_GeometryArchive?
-    var parent: TSP_Reference?
-    var exteriorTextWrap: TSD_ExteriorTextWrapArchive?
-    var hyperlinkUrl: String?
-    var locked: Bool?
-    var comment: TSP_Reference?
-    var aspectRatioLocked: Bool?
-    var accessibilityDescription: String?
-    var pencilAnnotations: [TSP_Reference] = []
-    var title: TSP_Reference?
-    var caption: TSP_Reference?
-    var titleHidden: Bool?
-    var captionHidden: Bool?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSD_GeometryArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_GeometryArchive(ProtobufMessage(_b)) }
-            if let _v { geometry = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { parent = _v }
-        case 3:
-            var _v: TSD_ExteriorTextWrapArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_ExteriorTextWrapArchive(ProtobufMessage(_b)) }
-            if let _v { exteriorTextWrap = _v }
-        case 4:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { hyperlinkUrl = _v }
-        case 5:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { locked = _v }
-        case 6:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { comment = _v }
-        case 7:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { aspectRatioLocked = _v }
-        case 8:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { accessibilityDescription = _v }
-        case 9:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { pencilAnnotations.append(_v) }
-        case 10:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { title = _v }
-        case 11:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { caption = _v }
-        case 12:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { titleHidden = _v }
-        case 13:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { captionHidden = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = geometry { _w.bytesField(1, _x.encoded()) }
-        if let _x = parent { _w.bytesField(2, _x.encoded()) }
-        if let _x = exteriorTextWrap { _w.bytesField(3, _x.encoded()) }
-        if let _x = hyperlinkUrl { _w.stringField(4, _x) }
-        if let _x = locked { _w.varintField(5, _x ? 1 : 0) }
-        if let _x = comment { _w.bytesField(6, _x.encoded()) }
-        if let _x = aspectRatioLocked { _w.varintField(7, _x ? 1 : 0) }
-        if let _x = accessibilityDescription { _w.stringField(8, _x) }
-        for _x in pencilAnnotations { _w.bytesField(9, _x.encoded()) }
-        if let _x = title { _w.bytesField(10, _x.encoded()) }
-        if let _x = caption { _w.bytesField(11, _x.encoded()) }
-        if let _x = titleHidden { _w.varintField(12, _x ? 1 : 0) }
-        if let _x = captionHidden { _w.varintField(13, _x ? 1 : 0) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSD.DrawableArchive", [
+        .optional(1, TSD_GeometryArchive.self), .optional(2, TSP_Reference.self),
+        .optional(3, TSD_ExteriorTextWrapArchive.self), .optional(4, .string), .optional(5, .bool),
+        .optional(6, TSP_Reference.self), .optional(7, .bool), .optional(8, .string), .repeated(9, TSP_Reference.self),
+        .optional(10, TSP_Reference.self), .optional(11, TSP_Reference.self), .optional(12, .bool),
+        .optional(13, .bool),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 13)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var geometry: TSD_GeometryArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var parent: TSP_Reference? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var exteriorTextWrap: TSD_ExteriorTextWrapArchive? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var hyperlinkUrl: String? { get { self[3] } set { self[3] = newValue } }
+    var locked: Bool? { get { self[4] } set { self[4] = newValue } }
+    var comment: TSP_Reference? { get { self[message: 5] } set { self[message: 5] = newValue } }
+    var aspectRatioLocked: Bool? { get { self[6] } set { self[6] = newValue } }
+    var accessibilityDescription: String? { get { self[7] } set { self[7] = newValue } }
+    var pencilAnnotations: [TSP_Reference] { get { self[messages: 8] } set { self[messages: 8] = newValue } }
+    func append(pencilAnnotations value: TSP_Reference) { append(value, toMessages: 8) }
+    var title: TSP_Reference? { get { self[message: 9] } set { self[message: 9] = newValue } }
+    var caption: TSP_Reference? { get { self[message: 10] } set { self[message: 10] = newValue } }
+    var titleHidden: Bool? { get { self[11] } set { self[11] = newValue } }
+    var captionHidden: Bool? { get { self[12] } set { self[12] = newValue } }
 }
 
 /// Generated wire model for `TSD.ContainerArchive`.
 final class TSD_ContainerArchive: IWAMessage {
-    var geometry: TSD_GeometryArchive?
-    var parent: TSP_Reference?
-    var children: [TSP_Reference] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSD_GeometryArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_GeometryArchive(ProtobufMessage(_b)) }
-            if let _v { geometry = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { parent = _v }
-        case 3:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { children.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = geometry { _w.bytesField(1, _x.encoded()) }
-        if let _x = parent { _w.bytesField(2, _x.encoded()) }
-        for _x in children { _w.bytesField(3, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSD.ContainerArchive", [
+        .optional(1, TSD_GeometryArchive.self), .optional(2, TSP_Reference.self), .repeated(3, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var geometry: TSD_GeometryArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var parent: TSP_Reference? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var children: [TSP_Reference] { get { self[messages: 2] } set { self[messages: 2] = newValue } }
+    func append(children value: TSP_Reference) { append(value, toMessages: 2) }
 }
 
 /// Generated wire model for `TSD.GroupArchive`.
 final class TSD_GroupArchive: IWAMessage {
-    var `super`: TSD_DrawableArchive?
-    var children: [TSP_Reference] = []
-    var fakeShapeForEmptyGroup: TSP_Reference?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSD_DrawableArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_DrawableArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { children.append(_v) }
-        case 3:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { fakeShapeForEmptyGroup = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        for _x in children { _w.bytesField(2, _x.encoded()) }
-        if let _x = fakeShapeForEmptyGroup { _w.bytesField(3, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSD.GroupArchive", [
+        .optional(1, TSD_DrawableArchive.self), .repeated(2, TSP_Reference.self), .optional(3, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var `super`: TSD_DrawableArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var children: [TSP_Reference] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(children value: TSP_Reference) { append(value, toMessages: 1) }
+    var fakeShapeForEmptyGroup: TSP_Reference? { get { self[message: 2] } set { self[message: 2] = newValue } }
 }
 
 /// Generated wire model for `TSD.FreehandDrawingAnimationArchive`.
 final class TSD_FreehandDrawingAnimationArchive: IWAMessage {
-    var duration: Double?
-    var shouldLoop: Bool?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { duration = _v }
-        case 2:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { shouldLoop = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = duration { _w.fixed64Field(1, _x.bitPattern) }
-        if let _x = shouldLoop { _w.varintField(2, _x ? 1 : 0) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSD.FreehandDrawingAnimationArchive", [
+        .optional(1, .double), .optional(2, .bool),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var duration: Double? { get { self[0] } set { self[0] = newValue } }
+    var shouldLoop: Bool? { get { self[1] } set { self[1] = newValue } }
 }
 
 /// Generated wire model for `TSD.FreehandDrawingArchive`.
 final class TSD_FreehandDrawingArchive: IWAMessage {
-    var spacerShape: TSP_Reference?
-    var opacity: Double?
-    var animation: TSD_FreehandDrawingAnimationArchive?
-    var lastClampedScale: Double?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { spacerShape = _v }
-        case 2:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { opacity = _v }
-        case 3:
-            var _v: TSD_FreehandDrawingAnimationArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_FreehandDrawingAnimationArchive(ProtobufMessage(_b)) }
-            if let _v { animation = _v }
-        case 4:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { lastClampedScale = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = spacerShape { _w.bytesField(1, _x.encoded()) }
-        if let _x = opacity { _w.fixed64Field(2, _x.bitPattern) }
-        if let _x = animation { _w.bytesField(3, _x.encoded()) }
-        if let _x = lastClampedScale { _w.fixed64Field(4, _x.bitPattern) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSD.FreehandDrawingArchive", [
+        .optional(1, TSP_Reference.self), .optional(2, .double), .optional(3, TSD_FreehandDrawingAnimationArchive.self),
+        .optional(4, .double),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var spacerShape: TSP_Reference? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var opacity: Double? { get { self[1] } set { self[1] = newValue } }
+    var animation: TSD_FreehandDrawingAnimationArchive? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var lastClampedScale: Double? { get { self[3] } set { self[3] = newValue } }
 }
 
 /// Generated wire model for `TSD.ShapeArchive`.
 final class TSD_ShapeArchive: IWAMessage {
-    var `super`: TSD_DrawableArchive?
-    var style: TSP_Reference?
-    var pathsource: TSD_PathSourceArchive?
-    var headLineEnd: TSD_LineEndArchive?
-    var tailLineEnd: TSD_LineEndArchive?
-    var strokepatternoffsetdistance: Float?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSD_DrawableArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_DrawableArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { style = _v }
-        case 3:
-            var _v: TSD_PathSourceArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_PathSourceArchive(ProtobufMessage(_b)) }
-            if let _v { pathsource = _v }
-        case 4:
-            var _v: TSD_LineEndArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_LineEndArchive(ProtobufMessage(_b)) }
-            if let _v { headLineEnd = _v }
-        case 5:
-            var _v: TSD_LineEndArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_LineEndArchive(ProtobufMessage(_b)) }
-            if let _v { tailLineEnd = _v }
-        case 6:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { strokepatternoffsetdistance = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = style { _w.bytesField(2, _x.encoded()) }
-        if let _x = pathsource { _w.bytesField(3, _x.encoded()) }
-        if let _x = headLineEnd { _w.bytesField(4, _x.encoded()) }
-        if let _x = tailLineEnd { _w.bytesField(5, _x.encoded()) }
-        if let _x = strokepatternoffsetdistance { _w.fixed32Field(6, _x.bitPattern) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSD.ShapeArchive", [
+        .optional(1, TSD_DrawableArchive.self), .optional(2, TSP_Reference.self),
+        .optional(3, TSD_PathSourceArchive.self), .optional(4, TSD_LineEndArchive.self),
+        .optional(5, TSD_LineEndArchive.self), .optional(6, .float),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 6)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var `super`: TSD_DrawableArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var style: TSP_Reference? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var pathsource: TSD_PathSourceArchive? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var headLineEnd: TSD_LineEndArchive? { get { self[message: 3] } set { self[message: 3] = newValue } }
+    var tailLineEnd: TSD_LineEndArchive? { get { self[message: 4] } set { self[message: 4] = newValue } }
+    var strokepatternoffsetdistance: Float? { get { self[5] } set { self[5] = newValue } }
 }
 
 /// Generated wire model for `TSD.ConnectionLineArchive`.
 final class TSD_ConnectionLineArchive: IWAMessage {
-    var `super`: TSD_ShapeArchive?
-    var connectedFrom: TSP_Reference?
-    var connectedTo: TSP_Reference?
-    var connectedToUuid: TSP_UUID?
-    var connectedFromUuid: TSP_UUID?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSD_ShapeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_ShapeArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { connectedFrom = _v }
-        case 3:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { connectedTo = _v }
-        case 4:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { connectedToUuid = _v }
-        case 5:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { connectedFromUuid = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = connectedFrom { _w.bytesField(2, _x.encoded()) }
-        if let _x = connectedTo { _w.bytesField(3, _x.encoded()) }
-        if let _x = connectedToUuid { _w.bytesField(4, _x.encoded()) }
-        if let _x = connectedFromUuid { _w.bytesField(5, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSD.ConnectionLineArchive", [
+        .optional(1, TSD_ShapeArchive.self), .optional(2, TSP_Reference.self), .optional(3, TSP_Reference.self),
+        .optional(4, TSP_UUID.self), .optional(5, TSP_UUID.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 5)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var `super`: TSD_ShapeArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var connectedFrom: TSP_Reference? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var connectedTo: TSP_Reference? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var connectedToUuid: TSP_UUID? { get { self[message: 3] } set { self[message: 3] = newValue } }
+    var connectedFromUuid: TSP_UUID? { get { self[message: 4] } set { self[message: 4] = newValue } }
 }
 
 /// Generated wire model for `TSD.ImageArchive`.
 final class TSD_ImageArchive: IWAMessage {
-    var `super`: TSD_DrawableArchive?
-    var data: TSP_DataReference?
-    var style: TSP_Reference?
-    var originalsize: TSP_Size?
-    var mask: TSP_Reference?
-    var thumbnaildata: TSP_DataReference?
-    var flags: UInt32?
-    var originaldata: TSP_DataReference?
-    var originalsvgdata: TSP_DataReference?
-    var naturalsize: TSP_Size?
-    var instantalphapath: TSP_Path?
-    var imageadjustments: TSD_ImageAdjustmentsArchive?
-    var enhancedimagedata: TSP_DataReference?
-    var adjustedimagedata: TSP_DataReference?
-    var thumbnailadjustedimagedata: TSP_DataReference?
-    var interpretsuntaggedimagedataasgeneric: Bool?
-    var databaseData: TSP_Reference?
-    var databaseThumbnailData: TSP_Reference?
-    var databaseOriginalData: TSP_Reference?
-    var tracedPath: TSP_Path?
-    var attribution: TSD_Attribution?
-    var shouldTracePdfContent: Bool?
-    var backgroundRemoved: Bool?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSD_DrawableArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_DrawableArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 11:
-            var _v: TSP_DataReference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_DataReference(ProtobufMessage(_b)) }
-            if let _v { data = _v }
-        case 3:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { style = _v }
-        case 4:
-            var _v: TSP_Size?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Size(ProtobufMessage(_b)) }
-            if let _v { originalsize = _v }
-        case 5:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { mask = _v }
-        case 12:
-            var _v: TSP_DataReference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_DataReference(ProtobufMessage(_b)) }
-            if let _v { thumbnaildata = _v }
-        case 7:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { flags = _v }
-        case 13:
-            var _v: TSP_DataReference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_DataReference(ProtobufMessage(_b)) }
-            if let _v { originaldata = _v }
-        case 23:
-            var _v: TSP_DataReference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_DataReference(ProtobufMessage(_b)) }
-            if let _v { originalsvgdata = _v }
-        case 9:
-            var _v: TSP_Size?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Size(ProtobufMessage(_b)) }
-            if let _v { naturalsize = _v }
-        case 10:
-            var _v: TSP_Path?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Path(ProtobufMessage(_b)) }
-            if let _v { instantalphapath = _v }
-        case 14:
-            var _v: TSD_ImageAdjustmentsArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_ImageAdjustmentsArchive(ProtobufMessage(_b)) }
-            if let _v { imageadjustments = _v }
-        case 17:
-            var _v: TSP_DataReference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_DataReference(ProtobufMessage(_b)) }
-            if let _v { enhancedimagedata = _v }
-        case 15:
-            var _v: TSP_DataReference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_DataReference(ProtobufMessage(_b)) }
-            if let _v { adjustedimagedata = _v }
-        case 16:
-            var _v: TSP_DataReference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_DataReference(ProtobufMessage(_b)) }
-            if let _v { thumbnailadjustedimagedata = _v }
-        case 18:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { interpretsuntaggedimagedataasgeneric = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { databaseData = _v }
-        case 6:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { databaseThumbnailData = _v }
-        case 8:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { databaseOriginalData = _v }
-        case 19:
-            var _v: TSP_Path?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Path(ProtobufMessage(_b)) }
-            if let _v { tracedPath = _v }
-        case 20:
-            var _v: TSD_Attribution?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_Attribution(ProtobufMessage(_b)) }
-            if let _v { attribution = _v }
-        case 21:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { shouldTracePdfContent = _v }
-        case 22:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { backgroundRemoved = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = data { _w.bytesField(11, _x.encoded()) }
-        if let _x = style { _w.bytesField(3, _x.encoded()) }
-        if let _x = originalsize { _w.bytesField(4, _x.encoded()) }
-        if let _x = mask { _w.bytesField(5, _x.encoded()) }
-        if let _x = thumbnaildata { _w.bytesField(12, _x.encoded()) }
-        if let _x = flags { _w.varintField(7, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = originaldata { _w.bytesField(13, _x.encoded()) }
-        if let _x = originalsvgdata { _w.bytesField(23, _x.encoded()) }
-        if let _x = naturalsize { _w.bytesField(9, _x.encoded()) }
-        if let _x = instantalphapath { _w.bytesField(10, _x.encoded()) }
-        if let _x = imageadjustments { _w.bytesField(14, _x.encoded()) }
-        if let _x = enhancedimagedata { _w.bytesField(17, _x.encoded()) }
-        if let _x = adjustedimagedata { _w.bytesField(15, _x.encoded()) }
-        if let _x = thumbnailadjustedimagedata { _w.bytesField(16, _x.encoded()) }
-        if let _x = interpretsuntaggedimagedataasgeneric { _w.varintField(18, _x ? 1 : 0) }
-        if let _x = databaseData { _w.bytesField(2, _x.encoded()) }
-        if let _x = databaseThumbnailData { _w.bytesField(6, _x.encoded()) }
-        if let _x = databaseOriginalData { _w.bytesField(8, _x.encoded()) }
-        if let _x = tracedPath { _w.bytesField(19, _x.encoded()) }
-        if let _x = attribution { _w.bytesField(20, _x.encoded()) }
-        if let _x = shouldTracePdfContent { _w.varintField(21, _x ? 1 : 0) }
-        if let _x = backgroundRemoved { _w.varintField(22, _x ? 1 : 0) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSD.ImageArchive", [
+        .optional(1, TSD_DrawableArchive.self), .optional(11, TSP_DataReference.self), .optional(3, TSP_Reference.self),
+        .optional(4, TSP_Size.self), .optional(5, TSP_Reference.self), .optional(12, TSP_DataReference.self),
+        .optional(7, .uint32), .optional(13, TSP_DataReference.self), .optional(23, TSP_DataReference.self),
+        .optional(9, TSP_Size.self), .optional(10, TSP_Path.self), .optional(14, TSD_ImageAdjustmentsArchive.self),
+        .optional(17, TSP_DataReference.self), .optional(15, TSP_DataReference.self),
+        .optional(16, TSP_DataReference.self), .optional(18, .bool), .optional(2, TSP_Reference.self),
+        .optional(6, TSP_Reference.self), .optional(8, TSP_Reference.self), .optional(19, TSP_Path.self),
+        .optional(20, TSD_Attribution.self), .optional(21, .bool), .optional(22, .bool),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 23)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var `super`: TSD_DrawableArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var data: TSP_DataReference? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var style: TSP_Reference? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var originalsize: TSP_Size? { get { self[message: 3] } set { self[message: 3] = newValue } }
+    var mask: TSP_Reference? { get { self[message: 4] } set { self[message: 4] = newValue } }
+    var thumbnaildata: TSP_DataReference? { get { self[message: 5] } set { self[message: 5] = newValue } }
+    var flags: UInt32? { get { self[6] } set { self[6] = newValue } }
+    var originaldata: TSP_DataReference? { get { self[message: 7] } set { self[message: 7] = newValue } }
+    var originalsvgdata: TSP_DataReference? { get { self[message: 8] } set { self[message: 8] = newValue } }
+    var naturalsize: TSP_Size? { get { self[message: 9] } set { self[message: 9] = newValue } }
+    var instantalphapath: TSP_Path? { get { self[message: 10] } set { self[message: 10] = newValue } }
+    var imageadjustments: TSD_ImageAdjustmentsArchive? { get { self[message: 11] } set { self[message: 11] = newValue } }
+    var enhancedimagedata: TSP_DataReference? { get { self[message: 12] } set { self[message: 12] = newValue } }
+    var adjustedimagedata: TSP_DataReference? { get { self[message: 13] } set { self[message: 13] = newValue } }
+    var thumbnailadjustedimagedata: TSP_DataReference? { get { self[message: 14] } set { self[message: 14] = newValue } }
+    var interpretsuntaggedimagedataasgeneric: Bool? { get { self[15] } set { self[15] = newValue } }
+    var databaseData: TSP_Reference? { get { self[message: 16] } set { self[message: 16] = newValue } }
+    var databaseThumbnailData: TSP_Reference? { get { self[message: 17] } set { self[message: 17] = newValue } }
+    var databaseOriginalData: TSP_Reference? { get { self[message: 18] } set { self[message: 18] = newValue } }
+    var tracedPath: TSP_Path? { get { self[message: 19] } set { self[message: 19] = newValue } }
+    var attribution: TSD_Attribution? { get { self[message: 20] } set { self[message: 20] = newValue } }
+    var shouldTracePdfContent: Bool? { get { self[21] } set { self[21] = newValue } }
+    var backgroundRemoved: Bool? { get { self[22] } set { self[22] = newValue } }
 }
 
 /// Generated wire model for `TSD.MaskArchive`.
 final class TSD_MaskArchive: IWAMessage {
-    var `super`: TSD_DrawableArchive?
-    var pathsource: TSD_PathSourceArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSD_DrawableArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_DrawableArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: TSD_PathSourceArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_PathSourceArchive(ProtobufMessage(_b)) }
-            if let _v { pathsource = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = pathsource { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSD.MaskArchive", [
+        .optional(1, TSD_DrawableArchive.self), .optional(2, TSD_PathSourceArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var `super`: TSD_DrawableArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var pathsource: TSD_PathSourceArchive? { get { self[message: 1] } set { self[message: 1] = newValue } }
 }
 
 /// Generated wire model for `TSD.ImageDataAttributes`.
 final class TSD_ImageDataAttributes: IWAMessage {
-    var pixelSize: TSP_Size?
-    var imageIsSrgb: Bool?
-    var shouldBeInterpretedAsGenericIfUntagged: Bool?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Size?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Size(ProtobufMessage(_b)) }
-            if let _v { pixelSize = _v }
-        case 2:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { imageIsSrgb = _v }
-        case 3:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { shouldBeInterpretedAsGenericIfUntagged = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = pixelSize { _w.bytesField(1, _x.encoded()) }
-        if let _x = imageIsSrgb { _w.varintField(2, _x ? 1 : 0) }
-        if let _x = shouldBeInterpretedAsGenericIfUntagged { _w.varintField(3, _x ? 1 : 0) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSD.ImageDataAttributes", [
+        .optional(1, TSP_Size.self), .optional(2, .bool), .optional(3, .bool),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var pixelSize: TSP_Size? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var imageIsSrgb: Bool? { get { self[1] } set { self[1] = newValue } }
+    var shouldBeInterpretedAsGenericIfUntagged: Bool? { get { self[2] } set { self[2] = newValue } }
 }
 
 /// Generated wire model for `TSD.MovieArchive`.
 final class TSD_MovieArchive: IWAMessage {
-    var `super`: TSD_DrawableArchive?
-    var moviedata: TSP_DataReference?
-    var importedauxiliarymoviedata: TSP_DataReference?
-    var importedAuxiliaryMovieDataOriginalFilename: String?
-    var movieremoteurl: String?
-    var starttime: Float?
-    var endtime: Float?
-    var postertime: Float?
-    var loopoptionasinteger: UInt32?
-    var loopOption: Int32?
-    var volume: Float?
-    var autoplay: Bool?
-    var audioonly: Bool?
-    var streaming: Bool?
-    var nativeaudiorecording: Bool?
-    var playsacrossslides: Bool?
-    var posterimagedata: TSP_DataReference?
-    var audioonlyimagedata: TSP_DataReference?
-    var posterImageGeneratedWithAlphaSupport: Bool?
-    var playablestate: UInt32?
-    var flags: UInt32?
-    var databaseMovieData: TSP_Reference?
-    var databasePosterImageData: TSP_Reference?
-    var databaseAudioOnlyImageData: TSP_Reference?
-    var style: TSP_Reference?
-    var originalsize: TSP_Size?
-    var naturalsize: TSP_Size?
-    var attribution: TSD_Attribution?
-    var fingerprint: TSD_MovieFingerprint?
-    var isLiveVideo: Bool?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSD_DrawableArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_DrawableArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 14:
-            var _v: TSP_DataReference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_DataReference(ProtobufMessage(_b)) }
-            if let _v { moviedata = _v }
-        case 22:
-            var _v: TSP_DataReference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_DataReference(ProtobufMessage(_b)) }
-            if let _v { importedauxiliarymoviedata = _v }
-        case 25:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { importedAuxiliaryMovieDataOriginalFilename = _v }
-        case 17:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { movieremoteurl = _v }
-        case 3:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { starttime = _v }
-        case 4:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { endtime = _v }
-        case 5:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { postertime = _v }
-        case 6:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { loopoptionasinteger = _v }
-        case 24:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { loopOption = _v }
-        case 7:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { volume = _v }
-        case 8:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { autoplay = _v }
-        case 9:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { audioonly = _v }
-        case 18:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { streaming = _v }
-        case 27:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { nativeaudiorecording = _v }
-        case 28:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { playsacrossslides = _v }
-        case 15:
-            var _v: TSP_DataReference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_DataReference(ProtobufMessage(_b)) }
-            if let _v { posterimagedata = _v }
-        case 16:
-            var _v: TSP_DataReference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_DataReference(ProtobufMessage(_b)) }
-            if let _v { audioonlyimagedata = _v }
-        case 23:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { posterImageGeneratedWithAlphaSupport = _v }
-        case 12:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { playablestate = _v }
-        case 13:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { flags = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { databaseMovieData = _v }
-        case 10:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { databasePosterImageData = _v }
-        case 11:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { databaseAudioOnlyImageData = _v }
-        case 19:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { style = _v }
-        case 20:
-            var _v: TSP_Size?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Size(ProtobufMessage(_b)) }
-            if let _v { originalsize = _v }
-        case 21:
-            var _v: TSP_Size?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Size(ProtobufMessage(_b)) }
-            if let _v { naturalsize = _v }
-        case 26:
-            var _v: TSD_Attribution?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_Attribution(ProtobufMessage(_b)) }
-            if let _v { attribution = _v }
-        case 29:
-            var _v: TSD_MovieFingerprint?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_MovieFingerprint(ProtobufMessage(_b)) }
-            if let _v { fingerprint = _v }
-        case 30:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { isLiveVideo = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = moviedata { _w.bytesField(14, _x.encoded()) }
-        if let _x = importedauxiliarymoviedata { _w.bytesField(22, _x.encoded()) }
-        if let _x = importedAuxiliaryMovieDataOriginalFilename { _w.stringField(25, _x) }
-        if let _x = movieremoteurl { _w.stringField(17, _x) }
-        if let _x = starttime { _w.fixed32Field(3, _x.bitPattern) }
-        if let _x = endtime { _w.fixed32Field(4, _x.bitPattern) }
-        if let _x = postertime { _w.fixed32Field(5, _x.bitPattern) }
-        if let _x = loopoptionasinteger { _w.varintField(6, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = loopOption { _w.varintField(24, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = volume { _w.fixed32Field(7, _x.bitPattern) }
-        if let _x = autoplay { _w.varintField(8, _x ? 1 : 0) }
-        if let _x = audioonly { _w.varintField(9, _x ? 1 : 0) }
-        if let _x = streaming { _w.varintField(18, _x ? 1 : 0) }
-        if let _x = nativeaudiorecording { _w.varintField(27, _x ? 1 : 0) }
-        if let _x = playsacrossslides { _w.varintField(28, _x ? 1 : 0) }
-        if let _x = posterimagedata { _w.bytesField(15, _x.encoded()) }
-        if let _x = audioonlyimagedata { _w.bytesField(16, _x.encoded()) }
-        if let _x = posterImageGeneratedWithAlphaSupport { _w.varintField(23, _x ? 1 : 0) }
-        if let _x = playablestate { _w.varintField(12, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = flags { _w.varintField(13, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = databaseMovieData { _w.bytesField(2, _x.encoded()) }
-        if let _x = databasePosterImageData { _w.bytesField(10, _x.encoded()) }
-        if let _x = databaseAudioOnlyImageData { _w.bytesField(11, _x.encoded()) }
-        if let _x = style { _w.bytesField(19, _x.encoded()) }
-        if let _x = originalsize { _w.bytesField(20, _x.encoded()) }
-        if let _x = naturalsize { _w.bytesField(21, _x.encoded()) }
-        if let _x = attribution { _w.bytesField(26, _x.encoded()) }
-        if let _x = fingerprint { _w.bytesField(29, _x.encoded()) }
-        if let _x = isLiveVideo { _w.varintField(30, _x ? 1 : 0) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSD.MovieArchive", [
+        .optional(1, TSD_DrawableArchive.self), .optional(14, TSP_DataReference.self),
+        .optional(22, TSP_DataReference.self), .optional(25, .string), .optional(17, .string), .optional(3, .float),
+        .optional(4, .float), .optional(5, .float), .optional(6, .uint32), .optional(24, .int32), .optional(7, .float),
+        .optional(8, .bool), .optional(9, .bool), .optional(18, .bool), .optional(27, .bool), .optional(28, .bool),
+        .optional(15, TSP_DataReference.self), .optional(16, TSP_DataReference.self), .optional(23, .bool),
+        .optional(12, .uint32), .optional(13, .uint32), .optional(2, TSP_Reference.self),
+        .optional(10, TSP_Reference.self), .optional(11, TSP_Reference.self), .optional(19, TSP_Reference.self),
+        .optional(20, TSP_Size.self), .optional(21, TSP_Size.self), .optional(26, TSD_Attribution.self),
+        .optional(29, TSD_MovieFingerprint.self), .optional(30, .bool),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 30)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var `super`: TSD_DrawableArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var moviedata: TSP_DataReference? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var importedauxiliarymoviedata: TSP_DataReference? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var importedAuxiliaryMovieDataOriginalFilename: String? { get { self[3] } set { self[3] = newValue } }
+    var movieremoteurl: String? { get { self[4] } set { self[4] = newValue } }
+    var starttime: Float? { get { self[5] } set { self[5] = newValue } }
+    var endtime: Float? { get { self[6] } set { self[6] = newValue } }
+    var postertime: Float? { get { self[7] } set { self[7] = newValue } }
+    var loopoptionasinteger: UInt32? { get { self[8] } set { self[8] = newValue } }
+    var loopOption: Int32? { get { self[9] } set { self[9] = newValue } }
+    var volume: Float? { get { self[10] } set { self[10] = newValue } }
+    var autoplay: Bool? { get { self[11] } set { self[11] = newValue } }
+    var audioonly: Bool? { get { self[12] } set { self[12] = newValue } }
+    var streaming: Bool? { get { self[13] } set { self[13] = newValue } }
+    var nativeaudiorecording: Bool? { get { self[14] } set { self[14] = newValue } }
+    var playsacrossslides: Bool? { get { self[15] } set { self[15] = newValue } }
+    var posterimagedata: TSP_DataReference? { get { self[message: 16] } set { self[message: 16] = newValue } }
+    var audioonlyimagedata: TSP_DataReference? { get { self[message: 17] } set { self[message: 17] = newValue } }
+    var posterImageGeneratedWithAlphaSupport: Bool? { get { self[18] } set { self[18] = newValue } }
+    var playablestate: UInt32? { get { self[19] } set { self[19] = newValue } }
+    var flags: UInt32? { get { self[20] } set { self[20] = newValue } }
+    var databaseMovieData: TSP_Reference? { get { self[message: 21] } set { self[message: 21] = newValue } }
+    var databasePosterImageData: TSP_Reference? { get { self[message: 22] } set { self[message: 22] = newValue } }
+    var databaseAudioOnlyImageData: TSP_Reference? { get { self[message: 23] } set { self[message: 23] = newValue } }
+    var style: TSP_Reference? { get { self[message: 24] } set { self[message: 24] = newValue } }
+    var originalsize: TSP_Size? { get { self[message: 25] } set { self[message: 25] = newValue } }
+    var naturalsize: TSP_Size? { get { self[message: 26] } set { self[message: 26] = newValue } }
+    var attribution: TSD_Attribution? { get { self[message: 27] } set { self[message: 27] = newValue } }
+    var fingerprint: TSD_MovieFingerprint? { get { self[message: 28] } set { self[message: 28] = newValue } }
+    var isLiveVideo: Bool? { get { self[29] } set { self[29] = newValue } }
 }
 
 /// Generated wire model for `TSD.ExteriorTextWrapArchive`.
 final class TSD_ExteriorTextWrapArchive: IWAMessage {
-    var type: UInt32?
-    var direction: UInt32?
-    var fitType: UInt32?
-    var margin: Float?
-    var alphaThreshold: Float?
-    var isHtmlWrap: Bool?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { type = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { direction = _v }
-        case 3:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { fitType = _v }
-        case 4:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { margin = _v }
-        case 5:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { alphaThreshold = _v }
-        case 6:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { isHtmlWrap = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = type { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = direction { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = fitType { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = margin { _w.fixed32Field(4, _x.bitPattern) }
-        if let _x = alphaThreshold { _w.fixed32Field(5, _x.bitPattern) }
-        if let _x = isHtmlWrap { _w.varintField(6, _x ? 1 : 0) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSD.ExteriorTextWrapArchive", [
+        .optional(1, .uint32), .optional(2, .uint32), .optional(3, .uint32), .optional(4, .float), .optional(5, .float),
+        .optional(6, .bool),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 6)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var type: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var direction: UInt32? { get { self[1] } set { self[1] = newValue } }
+    var fitType: UInt32? { get { self[2] } set { self[2] = newValue } }
+    var margin: Float? { get { self[3] } set { self[3] = newValue } }
+    var alphaThreshold: Float? { get { self[4] } set { self[4] = newValue } }
+    var isHtmlWrap: Bool? { get { self[5] } set { self[5] = newValue } }
 }
 
 /// Generated wire model for `TSD.DrawableContentDescription`.
 final class TSD_DrawableContentDescription: IWAMessage {
-    var elementKind: UInt32?
-    var isAnchoredToText: Bool?
-    var isFloatingAboveText: Bool?
-    var isInlineWithText: Bool?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { elementKind = _v }
-        case 2:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { isAnchoredToText = _v }
-        case 3:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { isFloatingAboveText = _v }
-        case 4:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { isInlineWithText = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = elementKind { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = isAnchoredToText { _w.varintField(2, _x ? 1 : 0) }
-        if let _x = isFloatingAboveText { _w.varintField(3, _x ? 1 : 0) }
-        if let _x = isInlineWithText { _w.varintField(4, _x ? 1 : 0) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSD.DrawableContentDescription", [
+        .optional(1, .uint32), .optional(2, .bool), .optional(3, .bool), .optional(4, .bool),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var elementKind: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var isAnchoredToText: Bool? { get { self[1] } set { self[1] = newValue } }
+    var isFloatingAboveText: Bool? { get { self[2] } set { self[2] = newValue } }
+    var isInlineWithText: Bool? { get { self[3] } set { self[3] = newValue } }
 }
 
 /// Generated wire model for `TSD.FreehandDrawingContentDescription`.
 final class TSD_FreehandDrawingContentDescription: IWAMessage {
-    var `super`: TSD_DrawableContentDescription?
-    var sourceDocWantedSpacerShape: Bool?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSD_DrawableContentDescription?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_DrawableContentDescription(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { sourceDocWantedSpacerShape = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = sourceDocWantedSpacerShape { _w.varintField(2, _x ? 1 : 0) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSD.FreehandDrawingContentDescription", [
+        .optional(1, TSD_DrawableContentDescription.self), .optional(2, .bool),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var `super`: TSD_DrawableContentDescription? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var sourceDocWantedSpacerShape: Bool? { get { self[1] } set { self[1] = newValue } }
 }
 
 /// Generated wire model for `TSD.FreehandDrawingToolkitUIState`.
 final class TSD_FreehandDrawingToolkitUIState: IWAMessage {
-    var currentColor: TSP_Color?
-    var mostRecentRestorableToolType: Int32?
-    var penToolOpacity: Float?
-    var penToolUnscaledWidth: Float?
-    var pencilToolOpacity: Float?
-    var pencilToolUnscaledWidth: Float?
-    var crayonToolOpacity: Float?
-    var crayonToolUnscaledWidth: Float?
-    var fillToolOpacity: Float?
-    var eraserToolScaledWidth: Float?
-    var eraserToolErasesWholeObjects: Bool?
-    var penToolColor: TSP_Color?
-    var pencilToolColor: TSP_Color?
-    var crayonToolColor: TSP_Color?
-    var fillToolColor: TSP_Color?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Color?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Color(ProtobufMessage(_b)) }
-            if let _v { currentColor = _v }
-        case 2:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { mostRecentRestorableToolType = _v }
-        case 3:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { penToolOpacity = _v }
-        case 4:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { penToolUnscaledWidth = _v }
-        case 5:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { pencilToolOpacity = _v }
-        case 6:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { pencilToolUnscaledWidth = _v }
-        case 7:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { crayonToolOpacity = _v }
-        case 8:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { crayonToolUnscaledWidth = _v }
-        case 9:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { fillToolOpacity = _v }
-        case 10:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { eraserToolScaledWidth = _v }
-        case 11:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { eraserToolErasesWholeObjects = _v }
-        case 12:
-            var _v: TSP_Color?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Color(ProtobufMessage(_b)) }
-            if let _v { penToolColor = _v }
-        case 13:
-            var _v: TSP_Color?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Color(ProtobufMessage(_b)) }
-            if let _v { pencilToolColor = _v }
-        case 14:
-            var _v: TSP_Color?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Color(ProtobufMessage(_b)) }
-            if let _v { crayonToolColor = _v }
-        case 15:
-            var _v: TSP_Color?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Color(ProtobufMessage(_b)) }
-            if let _v { fillToolColor = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = currentColor { _w.bytesField(1, _x.encoded()) }
-        if let _x = mostRecentRestorableToolType { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = penToolOpacity { _w.fixed32Field(3, _x.bitPattern) }
-        if let _x = penToolUnscaledWidth { _w.fixed32Field(4, _x.bitPattern) }
-        if let _x = pencilToolOpacity { _w.fixed32Field(5, _x.bitPattern) }
-        if let _x = pencilToolUnscaledWidth { _w.fixed32Field(6, _x.bitPattern) }
-        if let _x = crayonToolOpacity { _w.fixed32Field(7, _x.bitPattern) }
-        if let _x = crayonToolUnscaledWidth { _w.fixed32Field(8, _x.bitPattern) }
-        if let _x = fillToolOpacity { _w.fixed32Field(9, _x.bitPattern) }
-        if let _x = eraserToolScaledWidth { _w.fixed32Field(10, _x.bitPattern) }
-        if let _x = eraserToolErasesWholeObjects { _w.varintField(11, _x ? 1 : 0) }
-        if let _x = penToolColor { _w.bytesField(12, _x.encoded()) }
-        if let _x = pencilToolColor { _w.bytesField(13, _x.encoded()) }
-        if let _x = crayonToolColor { _w.bytesField(14, _x.encoded()) }
-        if let _x = fillToolColor { _w.bytesField(15, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSD.FreehandDrawingToolkitUIState", [
+        .optional(1, TSP_Color.self), .optional(2, .int32), .optional(3, .float), .optional(4, .float),
+        .optional(5, .float), .optional(6, .float), .optional(7, .float), .optional(8, .float), .optional(9, .float),
+        .optional(10, .float), .optional(11, .bool), .optional(12, TSP_Color.self), .optional(13, TSP_Color.self),
+        .optional(14, TSP_Color.self), .optional(15, TSP_Color.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 15)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var currentColor: TSP_Color? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var mostRecentRestorableToolType: Int32? { get { self[1] } set { self[1] = newValue } }
+    var penToolOpacity: Float? { get { self[2] } set { self[2] = newValue } }
+    var penToolUnscaledWidth: Float? { get { self[3] } set { self[3] = newValue } }
+    var pencilToolOpacity: Float? { get { self[4] } set { self[4] = newValue } }
+    var pencilToolUnscaledWidth: Float? { get { self[5] } set { self[5] = newValue } }
+    var crayonToolOpacity: Float? { get { self[6] } set { self[6] = newValue } }
+    var crayonToolUnscaledWidth: Float? { get { self[7] } set { self[7] = newValue } }
+    var fillToolOpacity: Float? { get { self[8] } set { self[8] = newValue } }
+    var eraserToolScaledWidth: Float? { get { self[9] } set { self[9] = newValue } }
+    var eraserToolErasesWholeObjects: Bool? { get { self[10] } set { self[10] = newValue } }
+    var penToolColor: TSP_Color? { get { self[message: 11] } set { self[message: 11] = newValue } }
+    var pencilToolColor: TSP_Color? { get { self[message: 12] } set { self[message: 12] = newValue } }
+    var crayonToolColor: TSP_Color? { get { self[message: 13] } set { self[message: 13] = newValue } }
+    var fillToolColor: TSP_Color? { get { self[message: 14] } set { self[message: 14] = newValue } }
 }
 
 /// Generated wire model for `TSD.StandinCaptionArchive`.
 final class TSD_StandinCaptionArchive: IWAMessage {
-
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSD.StandinCaptionArchive", [])
+    var _values = [IWAValue](repeating: .absent, count: 0)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
 }
 
 /// Generated wire model for `TSD.GuideArchive`.
 final class TSD_GuideArchive: IWAMessage {
-    var type: Int32?
-    var offset: Float?
-    var start: Float?
-    var end: Float?
-    var dynamic: Bool?
-    var infinite: Bool?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { type = _v }
-        case 2:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { offset = _v }
-        case 3:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { start = _v }
-        case 4:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { end = _v }
-        case 5:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { dynamic = _v }
-        case 6:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { infinite = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = type { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = offset { _w.fixed32Field(2, _x.bitPattern) }
-        if let _x = start { _w.fixed32Field(3, _x.bitPattern) }
-        if let _x = end { _w.fixed32Field(4, _x.bitPattern) }
-        if let _x = dynamic { _w.varintField(5, _x ? 1 : 0) }
-        if let _x = infinite { _w.varintField(6, _x ? 1 : 0) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSD.GuideArchive", [
+        .optional(1, .int32), .optional(2, .float), .optional(3, .float), .optional(4, .float), .optional(5, .bool),
+        .optional(6, .bool),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 6)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var type: Int32? { get { self[0] } set { self[0] = newValue } }
+    var offset: Float? { get { self[1] } set { self[1] = newValue } }
+    var start: Float? { get { self[2] } set { self[2] = newValue } }
+    var end: Float? { get { self[3] } set { self[3] = newValue } }
+    var dynamic: Bool? { get { self[4] } set { self[4] = newValue } }
+    var infinite: Bool? { get { self[5] } set { self[5] = newValue } }
 }
 
 /// Generated wire model for `TSD.UserDefinedGuideArchive`.
 final class TSD_UserDefinedGuideArchive: IWAMessage {
-    var type: Int32?
-    var position: Float?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { type = _v }
-        case 2:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { position = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = type { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = position { _w.fixed32Field(2, _x.bitPattern) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSD.UserDefinedGuideArchive", [
+        .optional(1, .int32), .optional(2, .float),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var type: Int32? { get { self[0] } set { self[0] = newValue } }
+    var position: Float? { get { self[1] } set { self[1] = newValue } }
 }
 
 /// Generated wire model for `TSD.GuideStorageArchive`.
 final class TSD_GuideStorageArchive: IWAMessage {
-    var userdefinedguides: [TSD_UserDefinedGuideArchive] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSD_UserDefinedGuideArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_UserDefinedGuideArchive(ProtobufMessage(_b)) }
-            if let _v { userdefinedguides.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in userdefinedguides { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSD.GuideStorageArchive", [
+        .repeated(1, TSD_UserDefinedGuideArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var userdefinedguides: [TSD_UserDefinedGuideArchive] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(userdefinedguides value: TSD_UserDefinedGuideArchive) { append(value, toMessages: 0) }
 }
 
 /// Generated wire model for `TSD.CanvasSelectionArchive`.
 final class TSD_CanvasSelectionArchive: IWAMessage {
-    var infos: [TSP_Reference] = []
-    var nonInteractiveInfos: [TSP_Reference] = []
-    var container: TSP_Reference?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { infos.append(_v) }
-        case 3:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { nonInteractiveInfos.append(_v) }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { container = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in infos { _w.bytesField(1, _x.encoded()) }
-        for _x in nonInteractiveInfos { _w.bytesField(3, _x.encoded()) }
-        if let _x = container { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSD.CanvasSelectionArchive", [
+        .repeated(1, TSP_Reference.self), .repeated(3, TSP_Reference.self), .optional(2, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var infos: [TSP_Reference] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(infos value: TSP_Reference) { append(value, toMessages: 0) }
+    var nonInteractiveInfos: [TSP_Reference] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(nonInteractiveInfos value: TSP_Reference) { append(value, toMessages: 1) }
+    var container: TSP_Reference? { get { self[message: 2] } set { self[message: 2] = newValue } }
 }
 
 /// Generated wire model for `TSD.DrawableSelectionArchive`.
 final class TSD_DrawableSelectionArchive: IWAMessage {
-    var infos: [TSP_Reference] = []
-    var nonInteractiveInfos: [TSP_Reference] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { infos.append(_v) }
-        case 3:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { nonInteractiveInfos.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in infos { _w.bytesField(2, _x.encoded()) }
-        for _x in nonInteractiveInfos { _w.bytesField(3, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSD.DrawableSelectionArchive", [
+        .repeated(2, TSP_Reference.self), .repeated(3, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var infos: [TSP_Reference] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(infos value: TSP_Reference) { append(value, toMessages: 0) }
+    var nonInteractiveInfos: [TSP_Reference] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(nonInteractiveInfos value: TSP_Reference) { append(value, toMessages: 1) }
 }
 
 /// Generated wire model for `TSD.GroupSelectionArchive`.
 final class TSD_GroupSelectionArchive: IWAMessage {
-    var `super`: TSD_DrawableSelectionArchive?
-    var hasSelectedInfosInNonGroupContainer: Bool?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSD_DrawableSelectionArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_DrawableSelectionArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { hasSelectedInfosInNonGroupContainer = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = hasSelectedInfosInNonGroupContainer { _w.varintField(2, _x ? 1 : 0) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSD.GroupSelectionArchive", [
+        .optional(1, TSD_DrawableSelectionArchive.self), .optional(2, .bool),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var `super`: TSD_DrawableSelectionArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var hasSelectedInfosInNonGroupContainer: Bool? { get { self[1] } set { self[1] = newValue } }
 }
 
 /// Generated wire model for `TSD.PathSelectionArchive`.
 final class TSD_PathSelectionArchive: IWAMessage {
-
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSD.PathSelectionArchive", [])
+    var _values = [IWAValue](repeating: .absent, count: 0)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
 }
 
 /// Generated wire model for `TSD.InfoHyperlinkSelectionArchive`.
 final class TSD_InfoHyperlinkSelectionArchive: IWAMessage {
-
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSD.InfoHyperlinkSelectionArchive", [])
+    var _values = [IWAValue](repeating: .absent, count: 0)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
 }
 
 /// Generated wire model for `TSD.CommentStorageArchive`.
 final class TSD_CommentStorageArchive: IWAMessage {
-    var text: String?
-    var creationDate: TSP_Date?
-    var author: TSP_Reference?
-    var replies: [TSP_Reference] = []
-    var storageUuid: TSP_UUID?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { text = _v }
-        case 2:
-            var _v: TSP_Date?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Date(ProtobufMessage(_b)) }
-            if let _v { creationDate = _v }
-        case 3:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { author = _v }
-        case 4:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { replies.append(_v) }
-        case 5:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { storageUuid = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = text { _w.stringField(1, _x) }
-        if let _x = creationDate { _w.bytesField(2, _x.encoded()) }
-        if let _x = author { _w.bytesField(3, _x.encoded()) }
-        for _x in replies { _w.bytesField(4, _x.encoded()) }
-        if let _x = storageUuid { _w.bytesField(5, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSD.CommentStorageArchive", [
+        .optional(1, .string), .optional(2, TSP_Date.self), .optional(3, TSP_Reference.self),
+        .repeated(4, TSP_Reference.self), .optional(5, TSP_UUID.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 5)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var text: String? { get { self[0] } set { self[0] = newValue } }
+    var creationDate: TSP_Date? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var author: TSP_Reference? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var replies: [TSP_Reference] { get { self[messages: 3] } set { self[messages: 3] = newValue } }
+    func append(replies value: TSP_Reference) { append(value, toMessages: 3) }
+    var storageUuid: TSP_UUID? { get { self[message: 4] } set { self[message: 4] = newValue } }
 }
 
 /// Generated wire model for `TSD.ReplaceAnnotationAuthorCommandArchive`.
 final class TSD_ReplaceAnnotationAuthorCommandArchive: IWAMessage {
-    var `super`: TSK_CommandArchive?
-    var oldAnnotationAuthor: TSP_Reference?
-    var newAnnotationAuthor: TSP_Reference?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSK_CommandArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_CommandArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { oldAnnotationAuthor = _v }
-        case 3:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { newAnnotationAuthor = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = oldAnnotationAuthor { _w.bytesField(2, _x.encoded()) }
-        if let _x = newAnnotationAuthor { _w.bytesField(3, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSD.ReplaceAnnotationAuthorCommandArchive", [
+        .optional(1, TSK_CommandArchive.self), .optional(2, TSP_Reference.self), .optional(3, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var `super`: TSK_CommandArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var oldAnnotationAuthor: TSP_Reference? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var newAnnotationAuthor: TSP_Reference? { get { self[message: 2] } set { self[message: 2] = newValue } }
 }
 
 /// Generated wire model for `TSD.PencilAnnotationArchive`.
 final class TSD_PencilAnnotationArchive: IWAMessage {
-    var pencilAnnotationStorage: TSP_Reference?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { pencilAnnotationStorage = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = pencilAnnotationStorage { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSD.PencilAnnotationArchive", [
+        .optional(1, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var pencilAnnotationStorage: TSP_Reference? { get { self[message: 0] } set { self[message: 0] = newValue } }
 }
 
 /// Generated wire model for `TSD.PencilAnnotationSelectionArchive`.
 final class TSD_PencilAnnotationSelectionArchive: IWAMessage {
-    var pencilAnnotation: TSP_Reference?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { pencilAnnotation = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = pencilAnnotation { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSD.PencilAnnotationSelectionArchive", [
+        .optional(1, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var pencilAnnotation: TSP_Reference? { get { self[message: 0] } set { self[message: 0] = newValue } }
 }
 
 /// Generated wire model for `TSD.PencilAnnotationStorageArchive`.
 final class TSD_PencilAnnotationStorageArchive: IWAMessage {
-    var attachedLocation: Int32?
-    var markupOffset: TSP_Point?
-    var rasterizedImage: TSP_DataReference?
-    var legacyEncodedDrawing: TSP_DataReference?
-    var drawingPath: TSP_Path?
-    var strokesBoundingBoxOrigin: TSP_Point?
-    var strokesBoundingBoxSize: TSP_Size?
-    var attachedType: Int32?
-    var originalAttachedSize: TSP_Size?
-    var percentOfPaContainedInParentRep: Double?
-    var textBaselinesTouchedCount: UInt64?
-    var visibleStrokesCount: UInt64?
-    var penColor: TSP_Color?
-    var toolType: Int32?
-    var calloutSubStorages: [TSP_Reference] = []
-    var creationDate: TSP_Date?
-    var pencilAnnotationDrawingScale: Double?
-    var compoundAnnotationType: Int32?
-    var subStorages: [TSP_Reference] = []
-    var encodedDrawing: TSP_DataReference?
-    var strokePointsFrameOrigin: TSP_Point?
-    var strokePointsFrameSize: TSP_Size?
-    var renderedFrameOrigin: TSP_Point?
-    var renderedFrameSize: TSP_Size?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { attachedLocation = _v }
-        case 2:
-            var _v: TSP_Point?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Point(ProtobufMessage(_b)) }
-            if let _v { markupOffset = _v }
-        case 3:
-            var _v: TSP_DataReference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_DataReference(ProtobufMessage(_b)) }
-            if let _v { rasterizedImage = _v }
-        case 4:
-            var _v: TSP_DataReference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_DataReference(ProtobufMessage(_b)) }
-            if let _v { legacyEncodedDrawing = _v }
-        case 5:
-            var _v: TSP_Path?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Path(ProtobufMessage(_b)) }
-            if let _v { drawingPath = _v }
-        case 6:
-            var _v: TSP_Point?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Point(ProtobufMessage(_b)) }
-            if let _v { strokesBoundingBoxOrigin = _v }
-        case 7:
-            var _v: TSP_Size?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Size(ProtobufMessage(_b)) }
-            if let _v { strokesBoundingBoxSize = _v }
-        case 8:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { attachedType = _v }
-        case 9:
-            var _v: TSP_Size?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Size(ProtobufMessage(_b)) }
-            if let _v { originalAttachedSize = _v }
-        case 10:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { percentOfPaContainedInParentRep = _v }
-        case 11:
-            var _v: UInt64?
-            if case .varint(let _u) = _f.value { _v = UInt64(truncatingIfNeeded: _u) }
-            if let _v { textBaselinesTouchedCount = _v }
-        case 12:
-            var _v: UInt64?
-            if case .varint(let _u) = _f.value { _v = UInt64(truncatingIfNeeded: _u) }
-            if let _v { visibleStrokesCount = _v }
-        case 13:
-            var _v: TSP_Color?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Color(ProtobufMessage(_b)) }
-            if let _v { penColor = _v }
-        case 14:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { toolType = _v }
-        case 15:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { calloutSubStorages.append(_v) }
-        case 16:
-            var _v: TSP_Date?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Date(ProtobufMessage(_b)) }
-            if let _v { creationDate = _v }
-        case 17:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { pencilAnnotationDrawingScale = _v }
-        case 18:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { compoundAnnotationType = _v }
-        case 19:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { subStorages.append(_v) }
-        case 20:
-            var _v: TSP_DataReference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_DataReference(ProtobufMessage(_b)) }
-            if let _v { encodedDrawing = _v }
-        case 21:
-            var _v: TSP_Point?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Point(ProtobufMessage(_b)) }
-            if let _v { strokePointsFrameOrigin = _v }
-        case 22:
-            var _v: TSP_Size?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Size(ProtobufMessage(_b)) }
-            if let _v { strokePointsFrameSize = _v }
-        case 23:
-            var _v: TSP_Point?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Point(ProtobufMessage(_b)) }
-            if let _v { renderedFrameOrigin = _v }
-        case 24:
-            var _v: TSP_Size?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Size(ProtobufMessage(_b)) }
-            if let _v { renderedFrameSize = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = attachedLocation { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = markupOffset { _w.bytesField(2, _x.encoded()) }
-        if let _x = rasterizedImage { _w.bytesField(3, _x.encoded()) }
-        if let _x = legacyEncodedDrawing { _w.bytesField(4, _x.encoded()) }
-        if let _x = drawingPath { _w.bytesField(5, _x.encoded()) }
-        if let _x = strokesBoundingBoxOrigin { _w.bytesField(6, _x.encoded()) }
-        if let _x = strokesBoundingBoxSize { _w.bytesField(7, _x.encoded()) }
-        if let _x = attachedType { _w.varintField(8, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = originalAttachedSize { _w.bytesField(9, _x.encoded()) }
-        if let _x = percentOfPaContainedInParentRep { _w.fixed64Field(10, _x.bitPattern) }
-        if let _x = textBaselinesTouchedCount { _w.varintField(11, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = visibleStrokesCount { _w.varintField(12, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = penColor { _w.bytesField(13, _x.encoded()) }
-        if let _x = toolType { _w.varintField(14, UInt64(truncatingIfNeeded: _x)) }
-        for _x in calloutSubStorages { _w.bytesField(15, _x.encoded()) }
-        if let _x = creationDate { _w.bytesField(16, _x.encoded()) }
-        if let _x = pencilAnnotationDrawingScale { _w.fixed64Field(17, _x.bitPattern) }
-        if let _x = compoundAnnotationType { _w.varintField(18, UInt64(truncatingIfNeeded: _x)) }
-        for _x in subStorages { _w.bytesField(19, _x.encoded()) }
-        if let _x = encodedDrawing { _w.bytesField(20, _x.encoded()) }
-        if let _x = strokePointsFrameOrigin { _w.bytesField(21, _x.encoded()) }
-        if let _x = strokePointsFrameSize { _w.bytesField(22, _x.encoded()) }
-        if let _x = renderedFrameOrigin { _w.bytesField(23, _x.encoded()) }
-        if let _x = renderedFrameSize { _w.bytesField(24, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSD.PencilAnnotationStorageArchive", [
+        .optional(1, .int32), .optional(2, TSP_Point.self), .optional(3, TSP_DataReference.self),
+        .optional(4, TSP_DataReference.self), .optional(5, TSP_Path.self), .optional(6, TSP_Point.self),
+        .optional(7, TSP_Size.self), .optional(8, .int32), .optional(9, TSP_Size.self), .optional(10, .double),
+        .optional(11, .uint64), .optional(12, .uint64), .optional(13, TSP_Color.self), .optional(14, .int32),
+        .repeated(15, TSP_Reference.self), .optional(16, TSP_Date.self), .optional(17, .double), .optional(18, .int32),
+        .repeated(19, TSP_Reference.self), .optional(20, TSP_DataReference.self), .optional(21, TSP_Point.self),
+        .optional(22, TSP_Size.self), .optional(23, TSP_Point.self), .optional(24, TSP_Size.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 24)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var attachedLocation: Int32? { get { self[0] } set { self[0] = newValue } }
+    var markupOffset: TSP_Point? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var rasterizedImage: TSP_DataReference? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var legacyEncodedDrawing: TSP_DataReference? { get { self[message: 3] } set { self[message: 3] = newValue } }
+    var drawingPath: TSP_Path? { get { self[message: 4] } set { self[message: 4] = newValue } }
+    var strokesBoundingBoxOrigin: TSP_Point? { get { self[message: 5] } set { self[message: 5] = newValue } }
+    var strokesBoundingBoxSize: TSP_Size? { get { self[message: 6] } set { self[message: 6] = newValue } }
+    var attachedType: Int32? { get { self[7] } set { self[7] = newValue } }
+    var originalAttachedSize: TSP_Size? { get { self[message: 8] } set { self[message: 8] = newValue } }
+    var percentOfPaContainedInParentRep: Double? { get { self[9] } set { self[9] = newValue } }
+    var textBaselinesTouchedCount: UInt64? { get { self[10] } set { self[10] = newValue } }
+    var visibleStrokesCount: UInt64? { get { self[11] } set { self[11] = newValue } }
+    var penColor: TSP_Color? { get { self[message: 12] } set { self[message: 12] = newValue } }
+    var toolType: Int32? { get { self[13] } set { self[13] = newValue } }
+    var calloutSubStorages: [TSP_Reference] { get { self[messages: 14] } set { self[messages: 14] = newValue } }
+    func append(calloutSubStorages value: TSP_Reference) { append(value, toMessages: 14) }
+    var creationDate: TSP_Date? { get { self[message: 15] } set { self[message: 15] = newValue } }
+    var pencilAnnotationDrawingScale: Double? { get { self[16] } set { self[16] = newValue } }
+    var compoundAnnotationType: Int32? { get { self[17] } set { self[17] = newValue } }
+    var subStorages: [TSP_Reference] { get { self[messages: 18] } set { self[messages: 18] = newValue } }
+    func append(subStorages value: TSP_Reference) { append(value, toMessages: 18) }
+    var encodedDrawing: TSP_DataReference? { get { self[message: 19] } set { self[message: 19] = newValue } }
+    var strokePointsFrameOrigin: TSP_Point? { get { self[message: 20] } set { self[message: 20] = newValue } }
+    var strokePointsFrameSize: TSP_Size? { get { self[message: 21] } set { self[message: 21] = newValue } }
+    var renderedFrameOrigin: TSP_Point? { get { self[message: 22] } set { self[message: 22] = newValue } }
+    var renderedFrameSize: TSP_Size? { get { self[message: 23] } set { self[message: 23] = newValue } }
 }
 
 /// Generated wire model for `TSD.SpecColorFillSetColorArchive`.
 final class TSD_SpecColorFillSetColorArchive: IWAMessage {
-    var color: TSP_Color?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Color?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Color(ProtobufMessage(_b)) }
-            if let _v { color = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = color { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSD.SpecColorFillSetColorArchive", [
+        .optional(1, TSP_Color.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var color: TSP_Color? { get { self[message: 0] } set { self[message: 0] = newValue } }
 }
 
 /// Generated wire model for `TSD.SpecFrameSetAssetScaleArchive`.
 final class TSD_SpecFrameSetAssetScaleArchive: IWAMessage {
-    var assetScale: Double?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { assetScale = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = assetScale { _w.fixed64Field(1, _x.bitPattern) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSD.SpecFrameSetAssetScaleArchive", [
+        .optional(1, .double),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var assetScale: Double? { get { self[0] } set { self[0] = newValue } }
 }
 
 /// Generated wire model for `TSD.SpecGradientFillSetAngleArchive`.
 final class TSD_SpecGradientFillSetAngleArchive: IWAMessage {
-    var angle: Double?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { angle = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = angle { _w.fixed64Field(1, _x.bitPattern) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSD.SpecGradientFillSetAngleArchive", [
+        .optional(1, .double),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var angle: Double? { get { self[0] } set { self[0] = newValue } }
 }
 
 /// Generated wire model for `TSD.SpecImageFillSetTechniqueArchive`.
 final class TSD_SpecImageFillSetTechniqueArchive: IWAMessage {
-    var technique: Int32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { technique = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = technique { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSD.SpecImageFillSetTechniqueArchive", [
+        .optional(1, .int32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var technique: Int32? { get { self[0] } set { self[0] = newValue } }
 }
 
 /// Generated wire model for `TSD.SpecReflectionSetOpacityArchive`.
 final class TSD_SpecReflectionSetOpacityArchive: IWAMessage {
-    var opacity: Double?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { opacity = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = opacity { _w.fixed64Field(1, _x.bitPattern) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSD.SpecReflectionSetOpacityArchive", [
+        .optional(1, .double),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var opacity: Double? { get { self[0] } set { self[0] = newValue } }
 }
 
 /// Generated wire model for `TSD.SpecShadowSetAngleArchive`.
 final class TSD_SpecShadowSetAngleArchive: IWAMessage {
-    var angle: Double?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { angle = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = angle { _w.fixed64Field(1, _x.bitPattern) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSD.SpecShadowSetAngleArchive", [
+        .optional(1, .double),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var angle: Double? { get { self[0] } set { self[0] = newValue } }
 }
 
 /// Generated wire model for `TSD.SpecShadowSetColorArchive`.
 final class TSD_SpecShadowSetColorArchive: IWAMessage {
-    var color: TSP_Color?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Color?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Color(ProtobufMessage(_b)) }
-            if let _v { color = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = color { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSD.SpecShadowSetColorArchive", [
+        .optional(1, TSP_Color.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var color: TSP_Color? { get { self[message: 0] } set { self[message: 0] = newValue } }
 }
 
 /// Generated wire model for `TSD.SpecShadowSetOffsetArchive`.
 final class TSD_SpecShadowSetOffsetArchive: IWAMessage {
-    var offset: Double?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { offset = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = offset { _w.fixed64Field(1, _x.bitPattern) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSD.SpecShadowSetOffsetArchive", [
+        .optional(1, .double),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var offset: Double? { get { self[0] } set { self[0] = newValue } }
 }
 
 /// Generated wire model for `TSD.SpecShadowSetOpacityArchive`.
 final class TSD_SpecShadowSetOpacityArchive: IWAMessage {
-    var opacity: Double?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { opacity = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = opacity { _w.fixed64Field(1, _x.bitPattern) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSD.SpecShadowSetOpacityArchive", [
+        .optional(1, .double),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var opacity: Double? { get { self[0] } set { self[0] = newValue } }
 }
 
 /// Generated wire model for `TSD.SpecShadowSetRadiusArchive`.
 final class TSD_SpecShadowSetRadiusArchive: IWAMessage {
-    var radius: Int32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { radius = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = radius { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSD.SpecShadowSetRadiusArchive", [
+        .optional(1, .int32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var radius: Int32? { get { self[0] } set { self[0] = newValue } }
 }
 
 /// Generated wire model for `TSD.SpecStrokeSetColorArchive`.
 final class TSD_SpecStrokeSetColorArchive: IWAMessage {
-    var color: TSP_Color?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Color?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Color(ProtobufMessage(_b)) }
-            if let _v { color = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = color { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSD.SpecStrokeSetColorArchive", [
+        .optional(1, TSP_Color.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var color: TSP_Color? { get { self[message: 0] } set { self[message: 0] = newValue } }
 }
 
 /// Generated wire model for `TSD.SpecStrokeSetPatternArchive`.
 final class TSD_SpecStrokeSetPatternArchive: IWAMessage {
-    var lineCap: Int32?
-    var lineJoin: Int32?
-    var miterLimit: Double?
-    var width: Double?
-    var color: TSP_Color?
-    var pattern: TSD_StrokePatternArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { lineCap = _v }
-        case 2:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { lineJoin = _v }
-        case 3:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { miterLimit = _v }
-        case 4:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { width = _v }
-        case 5:
-            var _v: TSP_Color?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Color(ProtobufMessage(_b)) }
-            if let _v { color = _v }
-        case 6:
-            var _v: TSD_StrokePatternArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_StrokePatternArchive(ProtobufMessage(_b)) }
-            if let _v { pattern = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = lineCap { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = lineJoin { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = miterLimit { _w.fixed64Field(3, _x.bitPattern) }
-        if let _x = width { _w.fixed64Field(4, _x.bitPattern) }
-        if let _x = color { _w.bytesField(5, _x.encoded()) }
-        if let _x = pattern { _w.bytesField(6, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSD.SpecStrokeSetPatternArchive", [
+        .optional(1, .int32), .optional(2, .int32), .optional(3, .double), .optional(4, .double),
+        .optional(5, TSP_Color.self), .optional(6, TSD_StrokePatternArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 6)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var lineCap: Int32? { get { self[0] } set { self[0] = newValue } }
+    var lineJoin: Int32? { get { self[1] } set { self[1] = newValue } }
+    var miterLimit: Double? { get { self[2] } set { self[2] = newValue } }
+    var width: Double? { get { self[3] } set { self[3] = newValue } }
+    var color: TSP_Color? { get { self[message: 4] } set { self[message: 4] = newValue } }
+    var pattern: TSD_StrokePatternArchive? { get { self[message: 5] } set { self[message: 5] = newValue } }
 }
 
 /// Generated wire model for `TSD.SpecStrokeSetWidthArchive`.
 final class TSD_SpecStrokeSetWidthArchive: IWAMessage {
-    var width: Double?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { width = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = width { _w.fixed64Field(1, _x.bitPattern) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSD.SpecStrokeSetWidthArchive", [
+        .optional(1, .double),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var width: Double? { get { self[0] } set { self[0] = newValue } }
 }
 
 /// Generated wire model for `TSD.Attribution`.
 final class TSD_Attribution: IWAMessage {
-    var title: String?
-    var descriptionText: String?
-    var externalUrl: String?
-    var authorName: String?
-    var authorUrl: String?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { title = _v }
-        case 2:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { descriptionText = _v }
-        case 3:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { externalUrl = _v }
-        case 4:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { authorName = _v }
-        case 5:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { authorUrl = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = title { _w.stringField(1, _x) }
-        if let _x = descriptionText { _w.stringField(2, _x) }
-        if let _x = externalUrl { _w.stringField(3, _x) }
-        if let _x = authorName { _w.stringField(4, _x) }
-        if let _x = authorUrl { _w.stringField(5, _x) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSD.Attribution", [
+        .optional(1, .string), .optional(2, .string), .optional(3, .string), .optional(4, .string),
+        .optional(5, .string),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 5)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var title: String? { get { self[0] } set { self[0] = newValue } }
+    var descriptionText: String? { get { self[1] } set { self[1] = newValue } }
+    var externalUrl: String? { get { self[2] } set { self[2] = newValue } }
+    var authorName: String? { get { self[3] } set { self[3] = newValue } }
+    var authorUrl: String? { get { self[4] } set { self[4] = newValue } }
 }
 
 /// Generated wire model for `TSD.MovieFingerprint`.
 final class TSD_MovieFingerprint: IWAMessage {
-    var tracks: [TSD_MovieFingerprintTrack] = []
-    var version: [UInt32] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSD_MovieFingerprintTrack?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_MovieFingerprintTrack(ProtobufMessage(_b)) }
-            if let _v { tracks.append(_v) }
-        case 2:
-            if case .varint(let _u) = _f.value { version.append(UInt32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { version.append(UInt32(truncatingIfNeeded: _u)) } }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in tracks { _w.bytesField(1, _x.encoded()) }
-        if !version.isEmpty { _w.packedVarintField(2, version.map { UInt64(truncatingIfNeeded: $0) }) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSD.MovieFingerprint", [
+        .repeated(1, TSD_MovieFingerprintTrack.self), .repeated(2, .uint32, packed: true),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var tracks: [TSD_MovieFingerprintTrack] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(tracks value: TSD_MovieFingerprintTrack) { append(value, toMessages: 0) }
+    var version: [UInt32] { get { self[all: 1] } set { self[all: 1] = newValue } }
+    func append(version value: UInt32) { append(value, toAll: 1) }
 }
 
 /// Generated wire model for `TSD.MovieFingerprintTrack`.
 final class TSD_MovieFingerprintTrack: IWAMessage {
-    var mediaType: String?
-    var enabled: Bool?
-    var totalSampleDataLength: Int64?
-    var sampleDataDigestString: String?
-    var timeRangeStartValue: Int64?
-    var timeRangeStartTimescale: Int32?
-    var timeRangeStartIsValid: Bool?
-    var timeRangeDurationValue: Int64?
-    var timeRangeDurationTimescale: Int32?
-    var timeRangeDurationIsValid: Bool?
-    var naturalSize: TSP_Size?
-    var preferredTransformA: Double?
-    var preferredTransformB: Double?
-    var preferredTransformC: Double?
-    var preferredTransformD: Double?
-    var preferredTransformTx: Double?
-    var preferredTransformTy: Double?
-    var preferredVolume: Double?
-    var languageCode: String?
-    var extendedLanguageTag: String?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { mediaType = _v }
-        case 2:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { enabled = _v }
-        case 3:
-            var _v: Int64?
-            if case .varint(let _u) = _f.value { _v = Int64(truncatingIfNeeded: _u) }
-            if let _v { totalSampleDataLength = _v }
-        case 4:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { sampleDataDigestString = _v }
-        case 5:
-            var _v: Int64?
-            if case .varint(let _u) = _f.value { _v = Int64(truncatingIfNeeded: _u) }
-            if let _v { timeRangeStartValue = _v }
-        case 6:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { timeRangeStartTimescale = _v }
-        case 7:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { timeRangeStartIsValid = _v }
-        case 8:
-            var _v: Int64?
-            if case .varint(let _u) = _f.value { _v = Int64(truncatingIfNeeded: _u) }
-            if let _v { timeRangeDurationValue = _v }
-        case 9:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { timeRangeDurationTimescale = _v }
-        case 10:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { timeRangeDurationIsValid = _v }
-        case 11:
-            var _v: TSP_Size?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Size(ProtobufMessage(_b)) }
-            if let _v { naturalSize = _v }
-        case 12:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { preferredTransformA = _v }
-        case 13:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { preferredTransformB = _v }
-        case 14:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { preferredTransformC = _v }
-        case 15:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { preferredTransformD = _v }
-        case 16:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { preferredTransformTx = _v }
-        case 17:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { preferredTransformTy = _v }
-        case 18:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { preferredVolume = _v }
-        case 19:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { languageCode = _v }
-        case 20:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { extendedLanguageTag = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = mediaType { _w.stringField(1, _x) }
-        if let _x = enabled { _w.varintField(2, _x ? 1 : 0) }
-        if let _x = totalSampleDataLength { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = sampleDataDigestString { _w.stringField(4, _x) }
-        if let _x = timeRangeStartValue { _w.varintField(5, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = timeRangeStartTimescale { _w.varintField(6, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = timeRangeStartIsValid { _w.varintField(7, _x ? 1 : 0) }
-        if let _x = timeRangeDurationValue { _w.varintField(8, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = timeRangeDurationTimescale { _w.varintField(9, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = timeRangeDurationIsValid { _w.varintField(10, _x ? 1 : 0) }
-        if let _x = naturalSize { _w.bytesField(11, _x.encoded()) }
-        if let _x = preferredTransformA { _w.fixed64Field(12, _x.bitPattern) }
-        if let _x = preferredTransformB { _w.fixed64Field(13, _x.bitPattern) }
-        if let _x = preferredTransformC { _w.fixed64Field(14, _x.bitPattern) }
-        if let _x = preferredTransformD { _w.fixed64Field(15, _x.bitPattern) }
-        if let _x = preferredTransformTx { _w.fixed64Field(16, _x.bitPattern) }
-        if let _x = preferredTransformTy { _w.fixed64Field(17, _x.bitPattern) }
-        if let _x = preferredVolume { _w.fixed64Field(18, _x.bitPattern) }
-        if let _x = languageCode { _w.stringField(19, _x) }
-        if let _x = extendedLanguageTag { _w.stringField(20, _x) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSD.MovieFingerprintTrack", [
+        .optional(1, .string), .optional(2, .bool), .optional(3, .int64), .optional(4, .string), .optional(5, .int64),
+        .optional(6, .int32), .optional(7, .bool), .optional(8, .int64), .optional(9, .int32), .optional(10, .bool),
+        .optional(11, TSP_Size.self), .optional(12, .double), .optional(13, .double), .optional(14, .double),
+        .optional(15, .double), .optional(16, .double), .optional(17, .double), .optional(18, .double),
+        .optional(19, .string), .optional(20, .string),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 20)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var mediaType: String? { get { self[0] } set { self[0] = newValue } }
+    var enabled: Bool? { get { self[1] } set { self[1] = newValue } }
+    var totalSampleDataLength: Int64? { get { self[2] } set { self[2] = newValue } }
+    var sampleDataDigestString: String? { get { self[3] } set { self[3] = newValue } }
+    var timeRangeStartValue: Int64? { get { self[4] } set { self[4] = newValue } }
+    var timeRangeStartTimescale: Int32? { get { self[5] } set { self[5] = newValue } }
+    var timeRangeStartIsValid: Bool? { get { self[6] } set { self[6] = newValue } }
+    var timeRangeDurationValue: Int64? { get { self[7] } set { self[7] = newValue } }
+    var timeRangeDurationTimescale: Int32? { get { self[8] } set { self[8] = newValue } }
+    var timeRangeDurationIsValid: Bool? { get { self[9] } set { self[9] = newValue } }
+    var naturalSize: TSP_Size? { get { self[message: 10] } set { self[message: 10] = newValue } }
+    var preferredTransformA: Double? { get { self[11] } set { self[11] = newValue } }
+    var preferredTransformB: Double? { get { self[12] } set { self[12] = newValue } }
+    var preferredTransformC: Double? { get { self[13] } set { self[13] = newValue } }
+    var preferredTransformD: Double? { get { self[14] } set { self[14] = newValue } }
+    var preferredTransformTx: Double? { get { self[15] } set { self[15] = newValue } }
+    var preferredTransformTy: Double? { get { self[16] } set { self[16] = newValue } }
+    var preferredVolume: Double? { get { self[17] } set { self[17] = newValue } }
+    var languageCode: String? { get { self[18] } set { self[18] = newValue } }
+    var extendedLanguageTag: String? { get { self[19] } set { self[19] = newValue } }
 }
 
 /// Registers this file's archives into the reflective catalog.
-func registerIWA_TSDArchives(_ into: inout [(name: String, decode: (ProtobufMessage) -> IWAMessage)]) {
-    into.append(("TSD.EdgeInsetsArchive", { TSD_EdgeInsetsArchive($0) as IWAMessage }))
-    into.append(("TSD.GeometryArchive", { TSD_GeometryArchive($0) as IWAMessage }))
-    into.append(("TSD.PointPathSourceArchive", { TSD_PointPathSourceArchive($0) as IWAMessage }))
-    into.append(("TSD.ScalarPathSourceArchive", { TSD_ScalarPathSourceArchive($0) as IWAMessage }))
-    into.append(("TSD.BezierPathSourceArchive", { TSD_BezierPathSourceArchive($0) as IWAMessage }))
-    into.append(("TSD.CalloutPathSourceArchive", { TSD_CalloutPathSourceArchive($0) as IWAMessage }))
-    into.append(("TSD.ConnectionLinePathSourceArchive", { TSD_ConnectionLinePathSourceArchive($0) as IWAMessage }))
-    into.append(("TSD.EditableBezierPathSourceArchive", { TSD_EditableBezierPathSourceArchive($0) as IWAMessage }))
-    into.append(("TSD.EditableBezierPathSourceArchive.Node", { TSD_EditableBezierPathSourceArchive_Node($0) as IWAMessage }))
-    into.append(("TSD.EditableBezierPathSourceArchive.Subpath", { TSD_EditableBezierPathSourceArchive_Subpath($0) as IWAMessage }))
-    into.append(("TSD.PathSourceArchive", { TSD_PathSourceArchive($0) as IWAMessage }))
-    into.append(("TSD.AngleGradientArchive", { TSD_AngleGradientArchive($0) as IWAMessage }))
-    into.append(("TSD.TransformGradientArchive", { TSD_TransformGradientArchive($0) as IWAMessage }))
-    into.append(("TSD.GradientArchive", { TSD_GradientArchive($0) as IWAMessage }))
-    into.append(("TSD.GradientArchive.GradientStop", { TSD_GradientArchive_GradientStop($0) as IWAMessage }))
-    into.append(("TSD.ImageFillArchive", { TSD_ImageFillArchive($0) as IWAMessage }))
-    into.append(("TSD.FillArchive", { TSD_FillArchive($0) as IWAMessage }))
-    into.append(("TSD.StrokePatternArchive", { TSD_StrokePatternArchive($0) as IWAMessage }))
-    into.append(("TSD.StrokeArchive", { TSD_StrokeArchive($0) as IWAMessage }))
-    into.append(("TSD.SmartStrokeArchive", { TSD_SmartStrokeArchive($0) as IWAMessage }))
-    into.append(("TSD.FrameArchive", { TSD_FrameArchive($0) as IWAMessage }))
-    into.append(("TSD.PatternedStrokeArchive", { TSD_PatternedStrokeArchive($0) as IWAMessage }))
-    into.append(("TSD.LineEndArchive", { TSD_LineEndArchive($0) as IWAMessage }))
-    into.append(("TSD.ShadowArchive", { TSD_ShadowArchive($0) as IWAMessage }))
-    into.append(("TSD.DropShadowArchive", { TSD_DropShadowArchive($0) as IWAMessage }))
-    into.append(("TSD.ContactShadowArchive", { TSD_ContactShadowArchive($0) as IWAMessage }))
-    into.append(("TSD.CurvedShadowArchive", { TSD_CurvedShadowArchive($0) as IWAMessage }))
-    into.append(("TSD.ReflectionArchive", { TSD_ReflectionArchive($0) as IWAMessage }))
-    into.append(("TSD.ImageAdjustmentsArchive", { TSD_ImageAdjustmentsArchive($0) as IWAMessage }))
-    into.append(("TSD.ShapeStylePropertiesArchive", { TSD_ShapeStylePropertiesArchive($0) as IWAMessage }))
-    into.append(("TSD.ShapeStyleArchive", { TSD_ShapeStyleArchive($0) as IWAMessage }))
-    into.append(("TSD.MediaStylePropertiesArchive", { TSD_MediaStylePropertiesArchive($0) as IWAMessage }))
-    into.append(("TSD.MediaStyleArchive", { TSD_MediaStyleArchive($0) as IWAMessage }))
-    into.append(("TSD.ThemePresetsArchive", { TSD_ThemePresetsArchive($0) as IWAMessage }))
-    into.append(("TSD.ThemeReplaceFillPresetCommandArchive", { TSD_ThemeReplaceFillPresetCommandArchive($0) as IWAMessage }))
-    into.append(("TSD.DrawableArchive", { TSD_DrawableArchive($0) as IWAMessage }))
-    into.append(("TSD.ContainerArchive", { TSD_ContainerArchive($0) as IWAMessage }))
-    into.append(("TSD.GroupArchive", { TSD_GroupArchive($0) as IWAMessage }))
-    into.append(("TSD.FreehandDrawingAnimationArchive", { TSD_FreehandDrawingAnimationArchive($0) as IWAMessage }))
-    into.append(("TSD.FreehandDrawingArchive", { TSD_FreehandDrawingArchive($0) as IWAMessage }))
-    into.append(("TSD.ShapeArchive", { TSD_ShapeArchive($0) as IWAMessage }))
-    into.append(("TSD.ConnectionLineArchive", { TSD_ConnectionLineArchive($0) as IWAMessage }))
-    into.append(("TSD.ImageArchive", { TSD_ImageArchive($0) as IWAMessage }))
-    into.append(("TSD.MaskArchive", { TSD_MaskArchive($0) as IWAMessage }))
-    into.append(("TSD.ImageDataAttributes", { TSD_ImageDataAttributes($0) as IWAMessage }))
-    into.append(("TSD.MovieArchive", { TSD_MovieArchive($0) as IWAMessage }))
-    into.append(("TSD.ExteriorTextWrapArchive", { TSD_ExteriorTextWrapArchive($0) as IWAMessage }))
-    into.append(("TSD.DrawableContentDescription", { TSD_DrawableContentDescription($0) as IWAMessage }))
-    into.append(("TSD.FreehandDrawingContentDescription", { TSD_FreehandDrawingContentDescription($0) as IWAMessage }))
-    into.append(("TSD.FreehandDrawingToolkitUIState", { TSD_FreehandDrawingToolkitUIState($0) as IWAMessage }))
-    into.append(("TSD.StandinCaptionArchive", { TSD_StandinCaptionArchive($0) as IWAMessage }))
-    into.append(("TSD.GuideArchive", { TSD_GuideArchive($0) as IWAMessage }))
-    into.append(("TSD.UserDefinedGuideArchive", { TSD_UserDefinedGuideArchive($0) as IWAMessage }))
-    into.append(("TSD.GuideStorageArchive", { TSD_GuideStorageArchive($0) as IWAMessage }))
-    into.append(("TSD.CanvasSelectionArchive", { TSD_CanvasSelectionArchive($0) as IWAMessage }))
-    into.append(("TSD.DrawableSelectionArchive", { TSD_DrawableSelectionArchive($0) as IWAMessage }))
-    into.append(("TSD.GroupSelectionArchive", { TSD_GroupSelectionArchive($0) as IWAMessage }))
-    into.append(("TSD.PathSelectionArchive", { TSD_PathSelectionArchive($0) as IWAMessage }))
-    into.append(("TSD.InfoHyperlinkSelectionArchive", { TSD_InfoHyperlinkSelectionArchive($0) as IWAMessage }))
-    into.append(("TSD.CommentStorageArchive", { TSD_CommentStorageArchive($0) as IWAMessage }))
-    into.append(("TSD.ReplaceAnnotationAuthorCommandArchive", { TSD_ReplaceAnnotationAuthorCommandArchive($0) as IWAMessage }))
-    into.append(("TSD.PencilAnnotationArchive", { TSD_PencilAnnotationArchive($0) as IWAMessage }))
-    into.append(("TSD.PencilAnnotationSelectionArchive", { TSD_PencilAnnotationSelectionArchive($0) as IWAMessage }))
-    into.append(("TSD.PencilAnnotationStorageArchive", { TSD_PencilAnnotationStorageArchive($0) as IWAMessage }))
-    into.append(("TSD.SpecColorFillSetColorArchive", { TSD_SpecColorFillSetColorArchive($0) as IWAMessage }))
-    into.append(("TSD.SpecFrameSetAssetScaleArchive", { TSD_SpecFrameSetAssetScaleArchive($0) as IWAMessage }))
-    into.append(("TSD.SpecGradientFillSetAngleArchive", { TSD_SpecGradientFillSetAngleArchive($0) as IWAMessage }))
-    into.append(("TSD.SpecImageFillSetTechniqueArchive", { TSD_SpecImageFillSetTechniqueArchive($0) as IWAMessage }))
-    into.append(("TSD.SpecReflectionSetOpacityArchive", { TSD_SpecReflectionSetOpacityArchive($0) as IWAMessage }))
-    into.append(("TSD.SpecShadowSetAngleArchive", { TSD_SpecShadowSetAngleArchive($0) as IWAMessage }))
-    into.append(("TSD.SpecShadowSetColorArchive", { TSD_SpecShadowSetColorArchive($0) as IWAMessage }))
-    into.append(("TSD.SpecShadowSetOffsetArchive", { TSD_SpecShadowSetOffsetArchive($0) as IWAMessage }))
-    into.append(("TSD.SpecShadowSetOpacityArchive", { TSD_SpecShadowSetOpacityArchive($0) as IWAMessage }))
-    into.append(("TSD.SpecShadowSetRadiusArchive", { TSD_SpecShadowSetRadiusArchive($0) as IWAMessage }))
-    into.append(("TSD.SpecStrokeSetColorArchive", { TSD_SpecStrokeSetColorArchive($0) as IWAMessage }))
-    into.append(("TSD.SpecStrokeSetPatternArchive", { TSD_SpecStrokeSetPatternArchive($0) as IWAMessage }))
-    into.append(("TSD.SpecStrokeSetWidthArchive", { TSD_SpecStrokeSetWidthArchive($0) as IWAMessage }))
-    into.append(("TSD.Attribution", { TSD_Attribution($0) as IWAMessage }))
-    into.append(("TSD.MovieFingerprint", { TSD_MovieFingerprint($0) as IWAMessage }))
-    into.append(("TSD.MovieFingerprintTrack", { TSD_MovieFingerprintTrack($0) as IWAMessage }))
+func registerIWA_TSDArchives(_ into: inout [any IWAMessage.Type]) {
+    into += [
+        TSD_EdgeInsetsArchive.self, TSD_GeometryArchive.self, TSD_PointPathSourceArchive.self,
+        TSD_ScalarPathSourceArchive.self, TSD_BezierPathSourceArchive.self, TSD_CalloutPathSourceArchive.self,
+        TSD_ConnectionLinePathSourceArchive.self, TSD_EditableBezierPathSourceArchive.self,
+        TSD_EditableBezierPathSourceArchive_Node.self, TSD_EditableBezierPathSourceArchive_Subpath.self,
+        TSD_PathSourceArchive.self, TSD_AngleGradientArchive.self, TSD_TransformGradientArchive.self,
+        TSD_GradientArchive.self, TSD_GradientArchive_GradientStop.self, TSD_ImageFillArchive.self,
+        TSD_FillArchive.self, TSD_StrokePatternArchive.self, TSD_StrokeArchive.self, TSD_SmartStrokeArchive.self,
+        TSD_FrameArchive.self, TSD_PatternedStrokeArchive.self, TSD_LineEndArchive.self, TSD_ShadowArchive.self,
+        TSD_DropShadowArchive.self, TSD_ContactShadowArchive.self, TSD_CurvedShadowArchive.self,
+        TSD_ReflectionArchive.self, TSD_ImageAdjustmentsArchive.self, TSD_ShapeStylePropertiesArchive.self,
+        TSD_ShapeStyleArchive.self, TSD_MediaStylePropertiesArchive.self, TSD_MediaStyleArchive.self,
+        TSD_ThemePresetsArchive.self, TSD_ThemeReplaceFillPresetCommandArchive.self, TSD_DrawableArchive.self,
+        TSD_ContainerArchive.self, TSD_GroupArchive.self, TSD_FreehandDrawingAnimationArchive.self,
+        TSD_FreehandDrawingArchive.self, TSD_ShapeArchive.self, TSD_ConnectionLineArchive.self, TSD_ImageArchive.self,
+        TSD_MaskArchive.self, TSD_ImageDataAttributes.self, TSD_MovieArchive.self, TSD_ExteriorTextWrapArchive.self,
+        TSD_DrawableContentDescription.self, TSD_FreehandDrawingContentDescription.self,
+        TSD_FreehandDrawingToolkitUIState.self, TSD_StandinCaptionArchive.self, TSD_GuideArchive.self,
+        TSD_UserDefinedGuideArchive.self, TSD_GuideStorageArchive.self, TSD_CanvasSelectionArchive.self,
+        TSD_DrawableSelectionArchive.self, TSD_GroupSelectionArchive.self, TSD_PathSelectionArchive.self,
+        TSD_InfoHyperlinkSelectionArchive.self, TSD_CommentStorageArchive.self,
+        TSD_ReplaceAnnotationAuthorCommandArchive.self, TSD_PencilAnnotationArchive.self,
+        TSD_PencilAnnotationSelectionArchive.self, TSD_PencilAnnotationStorageArchive.self,
+        TSD_SpecColorFillSetColorArchive.self, TSD_SpecFrameSetAssetScaleArchive.self,
+        TSD_SpecGradientFillSetAngleArchive.self, TSD_SpecImageFillSetTechniqueArchive.self,
+        TSD_SpecReflectionSetOpacityArchive.self, TSD_SpecShadowSetAngleArchive.self,
+        TSD_SpecShadowSetColorArchive.self, TSD_SpecShadowSetOffsetArchive.self, TSD_SpecShadowSetOpacityArchive.self,
+        TSD_SpecShadowSetRadiusArchive.self, TSD_SpecStrokeSetColorArchive.self, TSD_SpecStrokeSetPatternArchive.self,
+        TSD_SpecStrokeSetWidthArchive.self, TSD_Attribution.self, TSD_MovieFingerprint.self,
+        TSD_MovieFingerprintTrack.self,
+    ]
 }
@@ -5,2619 +5,917 @@ import SwiftTextIWA
 
 /// Generated wire model for `TSK.TreeNode`.
 final class TSK_TreeNode: IWAMessage {
-    var name: String?
-    var children: [TSP_Reference] = []
-    var object: TSP_Reference?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSK.TreeNode", [
+        .optional(1, .string), .repeated(2, TSP_Reference.self), .optional(3, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { name = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { children.append(_v) }
-        case 3:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { object = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = name { _w.stringField(1, _x) }
-        for _x in children { _w.bytesField(2, _x.encoded()) }
-        if let _x = object { _w.bytesField(3, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var name: String? { get { self[0] } set { self[0] = newValue } }
+    var children: [TSP_Reference] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(children value: TSP_Reference) { append(value, toMessages: 1) }
+    var object: TSP_Reference? { get { self[message: 2] } set { self[message: 2] = newValue } }
 }
 
 /// Generated wire model for `TSK.LocalCommandHistoryItem`.
 final class TSK_LocalCommandHistoryItem: IWAMessage {
-    var command: TSP_Reference?
-    var behavior: TSP_Reference?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSK.LocalCommandHistoryItem", [
+        .optional(1, TSP_Reference.self), .optional(2, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { command = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { behavior = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = command { _w.bytesField(1, _x.encoded()) }
-        if let _x = behavior { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var command: TSP_Reference? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var behavior: TSP_Reference? { get { self[message: 1] } set { self[message: 1] = newValue } }
 }
 
 /// Generated wire model for `TSK.LocalCommandHistoryArray`.
 final class TSK_LocalCommandHistoryArray: IWAMessage {
-    var largeArray: TSP_LargeArray?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSK.LocalCommandHistoryArray", [
+        .optional(1, TSP_LargeArray.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_LargeArray?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_LargeArray(ProtobufMessage(_b)) }
-            if let _v { largeArray = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = largeArray { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var largeArray: TSP_LargeArray? { get { self[message: 0] } set { self[message: 0] = newValue } }
 }
 
 /// Generated wire model for `TSK.LocalCommandHistoryArraySegment`.
 final class TSK_LocalCommandHistoryArraySegment: IWAMessage {
-    var largeObjectArraySegment: TSP_LargeObjectArraySegment?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSK.LocalCommandHistoryArraySegment", [
+        .optional(1, TSP_LargeObjectArraySegment.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_LargeObjectArraySegment?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_LargeObjectArraySegment(ProtobufMessage(_b)) }
-            if let _v { largeObjectArraySegment = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = largeObjectArraySegment { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var largeObjectArraySegment: TSP_LargeObjectArraySegment? { get { self[message: 0] } set { self[message: 0] = newValue } }
 }
 
 /// Generated wire model for `TSK.LocalCommandHistory`.
 final class TSK_LocalCommandHistory: IWAMessage {
-    var undoCount: UInt32?
-    var itemsArray: TSP_Reference?
-    var fixedRadar13365177: Bool?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSK.LocalCommandHistory", [
+        .optional(1, .uint32), .optional(2, TSP_Reference.self), .optional(10, .bool),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { undoCount = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { itemsArray = _v }
-        case 10:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { fixedRadar13365177 = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = undoCount { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = itemsArray { _w.bytesField(2, _x.encoded()) }
-        if let _x = fixedRadar13365177 { _w.varintField(10, _x ? 1 : 0) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var undoCount: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var itemsArray: TSP_Reference? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var fixedRadar13365177: Bool? { get { self[2] } set { self[2] = newValue } }
 }
 
 /// Generated wire model for `TSK.DocumentArchive`.
 final class TSK_DocumentArchive: IWAMessage {
-    var localeIdentifier: String?
-    var annotationAuthorStorage: TSP_Reference?
-    var activityLogEntries: [TSP_Reference] = []
-    var creationLocaleIdentifier: String?
-    var preventImageConversionOnOpen: Bool?
-    var hasFloatingLocale: Bool?
-    var hasUserDefinedLocale: Bool?
-    var collaborationOperationHistory: TSP_Reference?
-    var shouldMeasureNegativelyTrackedTextCorrectly: Bool?
-    var useOptimizedTextVerticalAlignment: Bool?
-    var shouldAllowLigaturesInMinimallyTrackedText: Bool?
-    var formattingSymbols: TSK_FormattingSymbolsArchive?
-    var activityStream: TSP_Reference?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 4:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { localeIdentifier = _v }
-        case 7:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { annotationAuthorStorage = _v }
-        case 8:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { activityLogEntries.append(_v) }
-        case 9:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { creationLocaleIdentifier = _v }
-        case 10:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { preventImageConversionOnOpen = _v }
-        case 11:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { hasFloatingLocale = _v }
-        case 12:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { hasUserDefinedLocale = _v }
-        case 14:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { collaborationOperationHistory = _v }
-        case 15:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { shouldMeasureNegativelyTrackedTextCorrectly = _v }
-        case 16:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { useOptimizedTextVerticalAlignment = _v }
-        case 18:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { shouldAllowLigaturesInMinimallyTrackedText = _v }
-        case 17:
-            var _v: TSK_FormattingSymbolsArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_FormattingSymbolsArchive(ProtobufMessage(_b)) }
-            if let _v { formattingSymbols = _v }
-        case 199:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { activityStream = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = localeIdentifier { _w.stringField(4, _x) }
-        if let _x = annotationAuthorStorage { _w.bytesField(7, _x.encoded()) }
-        for _x in activityLogEntries { _w.bytesField(8, _x.encoded()) }
-        if let _x = creationLocaleIdentifier { _w.stringField(9, _x) }
-        if let _x = preventImageConversionOnOpen { _w.varintField(10, _x ? 1 : 0) }
-        if let _x = hasFloatingLocale { _w.varintField(11, _x ? 1 : 0) }
-        if let _x = hasUserDefinedLocale { _w.varintField(12, _x ? 1 : 0) }
-        if let _x = collaborationOperationHistory { _w.bytesField(14, _x.encoded()) }
-        if let _x = shouldMeasureNegativelyTrackedTextCorrectly { _w.varintField(15, _x ? 1 : 0) }
-        if let _x = useOptimizedTextVerticalAlignment { _w.varintField(16, _x ? 1 : 0) }
-        if let _x = shouldAllowLigaturesInMinimallyTrackedText { _w.varintField(18, _x ? 1 : 0) }
-        if let _x = formattingSymbols { _w.bytesField(17, _x.encoded()) }
-        if let _x = activityStream { _w.bytesField(199, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSK.DocumentArchive", [
+        .optional(4, .string), .optional(7, TSP_Reference.self), .repeated(8, TSP_Reference.self),
+        .optional(9, .string), .optional(10, .bool), .optional(11, .bool), .optional(12, .bool),
+        .optional(14, TSP_Reference.self), .optional(15, .bool), .optional(16, .bool), .optional(18, .bool),
+        .optional(17, TSK_FormattingSymbolsArchive.self), .optional(199, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 13)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var localeIdentifier: String? { get { self[0] } set { self[0] = newValue } }
+    var annotationAuthorStorage: TSP_Reference? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var activityLogEntries: [TSP_Reference] { get { self[messages: 2] } set { self[messages: 2] = newValue } }
+    func append(activityLogEntries value: TSP_Reference) { append(value, toMessages: 2) }
+    var creationLocaleIdentifier: String? { get { self[3] } set { self[3] = newValue } }
+    var preventImageConversionOnOpen: Bool? { get { self[4] } set { self[4] = newValue } }
+    var hasFloatingLocale: Bool? { get { self[5] } set { self[5] = newValue } }
+    var hasUserDefinedLocale: Bool? { get { self[6] } set { self[6] = newValue } }
+    var collaborationOperationHistory: TSP_Reference? { get { self[message: 7] } set { self[message: 7] = newValue } }
+    var shouldMeasureNegativelyTrackedTextCorrectly: Bool? { get { self[8] } set { self[8] = newValue } }
+    var useOptimizedTextVerticalAlignment: Bool? { get { self[9] } set { self[9] = newValue } }
+    var shouldAllowLigaturesInMinimallyTrackedText: Bool? { get { self[10] } set { self[10] = newValue } }
+    var formattingSymbols: TSK_FormattingSymbolsArchive? { get { self[message: 11] } set { self[message: 11] = newValue } }
+    var activityStream: TSP_Reference? { get { self[message: 12] } set { self[message: 12] = newValue } }
 }
 
 /// Generated wire model for `TSK.FormattingSymbolsArchive`.
 final class TSK_FormattingSymbolsArchive: IWAMessage {
-    var version: String?
-    var calendar: String?
-    var numberingSystem: String?
-    var months: [String] = []
-    var standaloneMonths: [String] = []
-    var shortMonths: [String] = []
-    var standaloneShortMonths: [String] = []
-    var weekdays: [String] = []
-    var standaloneWeekdays: [String] = []
-    var shortWeekdays: [String] = []
-    var standaloneShortWeekdays: [String] = []
-    var amSymbol: String?
-    var pmSymbol: String?
-    var tinyMonths: [String] = []
-    var standaloneTinyMonths: [String] = []
-    var tinyWeekdays: [String] = []
-    var standaloneTinyWeekdays: [String] = []
-    var quarters: [String] = []
-    var standaloneQuarters: [String] = []
-    var shortQuarters: [String] = []
-    var standaloneShortQuarters: [String] = []
-    var eras: [String] = []
-    var longEras: [String] = []
-    var shortDatePattern: String?
-    var mediumDatePattern: String?
-    var longDatePattern: String?
-    var fullDatePattern: String?
-    var shortTimePattern: String?
-    var mediumTimePattern: String?
-    var longTimePattern: String?
-    var fullTimePattern: String?
-    var decimalSeparator: String?
-    var groupingSeparator: String?
-    var currencyDecimalSeparator: String?
-    var currencyGroupingSeparator: String?
-    var plusSign: String?
-    var minusSign: String?
-    var exponentialSymbol: String?
-    var percentSymbol: String?
-    var perMilleSymbol: String?
-    var infinitySymbol: String?
-    var nanSymbol: String?
-    var decimalPattern: String?
-    var scientificPattern: String?
-    var percentPattern: String?
-    var currencyPattern: String?
-    var currencyCode: String?
-    var currencySymbols: [TSK_FormattingSymbolsArchive_CurrencySymbol] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { version = _v }
-        case 2:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { calendar = _v }
-        case 3:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { numberingSystem = _v }
-        case 4:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { months.append(_v) }
-        case 5:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { standaloneMonths.append(_v) }
-        case 6:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { shortMonths.append(_v) }
-        case 7:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { standaloneShortMonths.append(_v) }
-        case 8:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { weekdays.append(_v) }
-        case 9:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { standaloneWeekdays.append(_v) }
-        case 10:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { shortWeekdays.append(_v) }
-        case 11:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { standaloneShortWeekdays.append(_v) }
-        case 12:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { amSymbol = _v }
-        case 13:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { pmSymbol = _v }
-        case 14:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { tinyMonths.append(_v) }
-        case 15:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { standaloneTinyMonths.append(_v) }
-        case 16:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { tinyWeekdays.append(_v) }
-        case 17:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { standaloneTinyWeekdays.append(_v) }
-        case 18:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { quarters.append(_v) }
-        case 19:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { standaloneQuarters.append(_v) }
-        case 20:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { shortQuarters.append(_v) }
-        case 21:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { standaloneShortQuarters.append(_v) }
-        case 22:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { eras.append(_v) }
-        case 23:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { longEras.append(_v) }
-        case 24:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { shortDatePattern = _v }
-        case 25:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { mediumDatePattern = _v }
-        case 26:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { longDatePattern = _v }
-        case 27:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { fullDatePattern = _v }
-        case 28:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { shortTimePattern = _v }
-        case 29:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { mediumTimePattern = _v }
-        case 30:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { longTimePattern = _v }
-        case 31:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { fullTimePattern = _v }
-        case 32:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { decimalSeparator = _v }
-        case 33:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { groupingSeparator = _v }
-        case 34:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { currencyDecimalSeparator = _v }
-        case 35:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { currencyGroupingSeparator = _v }
-        case 36:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { plusSign = _v }
-        case 37:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { minusSign = _v }
-        case 38:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { exponentialSymbol = _v }
-        case 39:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { percentSymbol = _v }
-        case 40:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { perMilleSymbol = _v }
-        case 41:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { infinitySymbol = _v }
-        case 42:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { nanSymbol = _v }
-        case 43:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { decimalPattern = _v }
-        case 44:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { scientificPattern = _v }
-        case 45:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { percentPattern = _v }
-        case 46:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { currencyPattern = _v }
-        case 47:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { currencyCode = _v }
-        case 48:
-            var _v: TSK_FormattingSymbolsArchive_CurrencySymbol?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_FormattingSymbolsArchive_CurrencySymbol(ProtobufMessage(_b)) }
-            if let _v { currencySymbols.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = version { _w.stringField(1, _x) }
-        if let _x = calendar { _w.stringField(2, _x) }
-        if let _x = numberingSystem { _w.stringField(3, _x) }
-        for _x in months { _w.stringField(4, _x) }
-        for _x in standaloneMonths { _w.stringField(5, _x) }
-        for _x in shortMonths { _w.stringField(6, _x) }
-        for _x in standaloneShortMonths { _w.stringField(7, _x) }
-        for _x in weekdays { _w.stringField(8, _x) }
-        for _x in standaloneWeekdays { _w.stringField(9, _x) }
-        for _x in shortWeekdays { _w.stringField(10, _x) }
-        for _x in standaloneShortWeekdays { _w.stringField(11, _x) }
-        if let _x = amSymbol { _w.stringField(12, _x) }
-        if let _x = pmSymbol { _w.stringField(13, _x) }
-        for _x in tinyMonths { _w.stringField(14, _x) }
-        for _x in standaloneTinyMonths { _w.stringField(15, _x) }
-        for _x in tinyWeekdays { _w.stringField(16, _x) }
-        for _x in standaloneTinyWeekdays { _w.stringField(17, _x) }
-        for _x in quarters { _w.stringField(18, _x) }
-        for _x in standaloneQuarters { _w.stringField(19, _x) }
-        for _x in shortQuarters { _w.stringField(20, _x) }
-        for _x in standaloneShortQuarters { _w.stringField(21, _x) }
-        for _x in eras { _w.stringField(22, _x) }
-        for _x in longEras { _w.stringField(23, _x) }
-        if let _x = shortDatePattern { _w.stringField(24, _x) }
-        if let _x = mediumDatePattern { _w.stringField(25, _x) }
-        if let _x = longDatePattern { _w.stringField(26, _x) }
-        if let _x = fullDatePattern { _w.stringField(27, _x) }
-        if let _x = shortTimePattern { _w.stringField(28, _x) }
-        if let _x = mediumTimePattern { _w.stringField(29, _x) }
-        if let _x = longTimePattern { _w.stringField(30, _x) }
-        if let _x = fullTimePattern { _w.stringField(31, _x) }
-        if let _x = decimalSeparator { _w.stringField(32, _x) }
-        if let _x = groupingSeparator { _w.stringField(33, _x) }
-        if let _x = currencyDecimalSeparator { _w.stringField(34, _x) }
-        if let _x = currencyGroupingSeparator { _w.stringField(35, _x) }
-        if let _x = plusSign { _w.stringField(36, _x) }
-        if let _x = minusSign { _w.stringField(37, _x) }
-        if let _x = exponentialSymbol { _w.stringField(38, _x) }
-        if let _x = percentSymbol { _w.stringField(39, _x) }
-        if let _x = perMilleSymbol { _w.stringField(40, _x) }
-        if let _x = infinitySymbol { _w.stringField(41, _x) }
-        if let _x = nanSymbol { _w.stringField(42, _x) }
-        if let _x = decimalPattern { _w.stringField(43, _x) }
-        if let _x = scientificPattern { _w.stringField(44, _x) }
-        if let _x = percentPattern { _w.stringField(45, _x) }
-        if let _x = currencyPattern { _w.stringField(46, _x) }
-        if let _x = currencyCode { _w.stringField(47, _x) }
-        for _x in currencySymbols { _w.bytesField(48, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSK.FormattingSymbolsArchive", [
+        .optional(1, .string), .optional(2, .string), .optional(3, .string), .repeated(4, .string),
+        .repeated(5, .string), .repeated(6, .string), .repeated(7, .string), .repeated(8, .string),
+        .repeated(9, .string), .repeated(10, .string), .repeated(11, .string), .optional(12, .string),
+        .optional(13, .string), .repeated(14, .string), .repeated(15, .string), .repeated(16, .string),
+        .repeated(17, .string), .repeated(18, .string), .repeated(19, .string), .repeated(20, .string),
+        .repeated(21, .string), .repeated(22, .string), .repeated(23, .string), .optional(24, .string),
+        .optional(25, .string), .optional(26, .string), .optional(27, .string), .optional(28, .string),
+        .optional(29, .string), .optional(30, .string), .optional(31, .string), .optional(32, .string),
+        .optional(33, .string), .optional(34, .string), .optional(35, .string), .optional(36, .string),
+        .optional(37, .string), .optional(38, .string), .optional(39, .string), .optional(40, .string),
+        .optional(41, .string), .optional(42, .string), .optional(43, .string), .optional(44, .string),
+        .optional(45, .string), .optional(46, .string), .optional(47, .string),
+        .repeated(48, TSK_FormattingSymbolsArchive_CurrencySymbol.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 48)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var version: String? { get { self[0] } set { self[0] = newValue } }
+    var calendar: String? { get { self[1] } set { self[1] = newValue } }
+    var numberingSystem: String? { get { self[2] } set { self[2] = newValue } }
+    var months: [String] { get { self[all: 3] } set { self[all: 3] = newValue } }
+    func append(months value: String) { append(value, toAll: 3) }
+    var standaloneMonths: [String] { get { self[all: 4] } set { self[all: 4] = newValue } }
+    func append(standaloneMonths value: String) { append(value, toAll: 4) }
+    var shortMonths: [String] { get { self[all: 5] } set { self[all: 5] = newValue } }
+    func append(shortMonths value: String) { append(value, toAll: 5) }
+    var standaloneShortMonths: [String] { get { self[all: 6] } set { self[all: 6] = newValue } }
+    func append(standaloneShortMonths value: String) { append(value, toAll: 6) }
+    var weekdays: [String] { get { self[all: 7] } set { self[all: 7] = newValue } }
+    func append(weekdays value: String) { append(value, toAll: 7) }
+    var standaloneWeekdays: [String] { get { self[all: 8] } set { self[all: 8] = newValue } }
+    func append(standaloneWeekdays value: String) { append(value, toAll: 8) }
+    var shortWeekdays: [String] { get { self[all: 9] } set { self[all: 9] = newValue } }
+    func append(shortWeekdays value: String) { append(value, toAll: 9) }
+    var standaloneShortWeekdays: [String] { get { self[all: 10] } set { self[all: 10] = newValue } }
+    func append(standaloneShortWeekdays value: String) { append(value, toAll: 10) }
+    var amSymbol: String? { get { self[11] } set { self[11] = newValue } }
+    var pmSymbol: String? { get { self[12] } set { self[12] = newValue } }
+    var tinyMonths: [String] { get { self[all: 13] } set { self[all: 13] = newValue } }
+    func append(tinyMonths value: String) { append(value, toAll: 13) }
+    var standaloneTinyMonths: [String] { get { self[all: 14] } set { self[all: 14] = newValue } }
+    func append(standaloneTinyMonths value: String) { append(value, toAll: 14) }
+    var tinyWeekdays: [String] { get { self[all: 15] } set { self[all: 15] = newValue } }
+    func append(tinyWeekdays value: String) { append(value, toAll: 15) }
+    var standaloneTinyWeekdays: [String] { get { self[all: 16] } set { self[all: 16] = newValue } }
+    func append(standaloneTinyWeekdays value: String) { append(value, toAll: 16) }
+    var quarters: [String] { get { self[all: 17] } set { self[all: 17] = newValue } }
+    func append(quarters value: String) { append(value, toAll: 17) }
+    var standaloneQuarters: [String] { get { self[all: 18] } set { self[all: 18] = newValue } }
+    func append(standaloneQuarters value: String) { append(value, toAll: 18) }
+    var shortQuarters: [String] { get { self[all: 19] } set { self[all: 19] = newValue } }
+    func append(shortQuarters value: String) { append(value, toAll: 19) }
+    var standaloneShortQuarters: [String] { get { self[all: 20] } set { self[all: 20] = newValue } }
+    func append(standaloneShortQuarters value: String) { append(value, toAll: 20) }
+    var eras: [String] { get { self[all: 21] } set { self[all: 21] = newValue } }
+    func append(eras value: String) { append(value, toAll: 21) }
+    var longEras: [String] { get { self[all: 22] } set { self[all: 22] = newValue } }
+    func append(longEras value: String) { append(value, toAll: 22) }
+    var shortDatePattern: String? { get { self[23] } set { self[23] = newValue } }
+    var mediumDatePattern: String? { get { self[24] } set { self[24] = newValue } }
+    var longDatePattern: String? { get { self[25] } set { self[25] = newValue } }
+    var fullDatePattern: String? { get { self[26] } set { self[26] = newValue } }
+    var shortTimePattern: String? { get { self[27] } set { self[27] = newValue } }
+    var mediumTimePattern: String? { get { self[28] } set { self[28] = newValue } }
+    var longTimePattern: String? { get { self[29] } set { self[29] = newValue } }
+    var fullTimePattern: String? { get { self[30] } set { self[30] = newValue } }
+    var decimalSeparator: String? { get { self[31] } set { self[31] = newValue } }
+    var groupingSeparator: String? { get { self[32] } set { self[32] = newValue } }
+    var currencyDecimalSeparator: String? { get { self[33] } set { self[33] = newValue } }
+    var currencyGroupingSeparator: String? { get { self[34] } set { self[34] = newValue } }
+    var plusSign: String? { get { self[35] } set { self[35] = newValue } }
+    var minusSign: String? { get { self[36] } set { self[36] = newValue } }
+    var exponentialSymbol: String? { get { self[37] } set { self[37] = newValue } }
+    var percentSymbol: String? { get { self[38] } set { self[38] = newValue } }
+    var perMilleSymbol: String? { get { self[39] } set { self[39] = newValue } }
+    var infinitySymbol: String? { get { self[40] } set { self[40] = newValue } }
+    var nanSymbol: String? { get { self[41] } set { self[41] = newValue } }
+    var decimalPattern: String? { get { self[42] } set { self[42] = newValue } }
+    var scientificPattern: String? { get { self[43] } set { self[43] = newValue } }
+    var percentPattern: String? { get { self[44] } set { self[44] = newValue } }
+    var currencyPattern: String? { get { self[45] } set { self[45] = newValue } }
+    var currencyCode: String? { get { self[46] } set { self[46] = newValue } }
+    var currencySymbols: [TSK_FormattingSymbolsArchive_CurrencySymbol] { get { self[messages: 47] } set { self[messages: 47] = newValue } }
+    func append(currencySymbols value: TSK_FormattingSymbolsArchive_CurrencySymbol) { append(value, toMessages: 47) }
 }
 
 /// Generated wire model for `TSK.FormattingSymbolsArchive.CurrencySymbol`.
 final class TSK_FormattingSymbolsArchive_CurrencySymbol: IWAMessage {
-    var code: String?
-    var symbol: String?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSK.FormattingSymbolsArchive.CurrencySymbol", [
+        .optional(1, .string), .optional(2, .string),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { code = _v }
-        case 2:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { symbol = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = code { _w.stringField(1, _x) }
-        if let _x = symbol { _w.stringField(2, _x) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var code: String? { get { self[0] } set { self[0] = newValue } }
+    var symbol: String? { get { self[1] } set { self[1] = newValue } }
 }
 
 /// Generated wire model for `TSK.DocumentSupportArchive`.
 final class TSK_DocumentSupportArchive: IWAMessage {
-    var commandHistory: TSP_Reference?
-    var undoCount: UInt32?
-    var redoCount: UInt32?
-    var undoActionString: String?
-    var redoActionString: String?
-    var webState: TSP_Reference?
-    var isInCollaborationMode: Bool?
-    var actionStringLocalization: String?
-    var collaborationState: TSP_Reference?
-    var activityNotificationMap: TSP_Reference?
-    var removedAuthorAuditorPendingState: TSP_Reference?
-    var commandSelectionBehaviorHistory: TSP_Reference?
-    var viewState: TSP_Reference?
-    var collaborationCommandHistory: TSP_Reference?
-    var collaborationSessionState: TSP_Reference?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { commandHistory = _v }
-        case 4:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { undoCount = _v }
-        case 5:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { redoCount = _v }
-        case 6:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { undoActionString = _v }
-        case 7:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { redoActionString = _v }
-        case 8:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { webState = _v }
-        case 9:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { isInCollaborationMode = _v }
-        case 12:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { actionStringLocalization = _v }
-        case 13:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { collaborationState = _v }
-        case 14:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { activityNotificationMap = _v }
-        case 15:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { removedAuthorAuditorPendingState = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { commandSelectionBehaviorHistory = _v }
-        case 3:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { viewState = _v }
-        case 10:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { collaborationCommandHistory = _v }
-        case 11:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { collaborationSessionState = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = commandHistory { _w.bytesField(1, _x.encoded()) }
-        if let _x = undoCount { _w.varintField(4, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = redoCount { _w.varintField(5, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = undoActionString { _w.stringField(6, _x) }
-        if let _x = redoActionString { _w.stringField(7, _x) }
-        if let _x = webState { _w.bytesField(8, _x.encoded()) }
-        if let _x = isInCollaborationMode { _w.varintField(9, _x ? 1 : 0) }
-        if let _x = actionStringLocalization { _w.stringField(12, _x) }
-        if let _x = collaborationState { _w.bytesField(13, _x.encoded()) }
-        if let _x = activityNotificationMap { _w.bytesField(14, _x.encoded()) }
-        if let _x = removedAuthorAuditorPendingState { _w.bytesField(15, _x.encoded()) }
-        if let _x = commandSelectionBehaviorHistory { _w.bytesField(2, _x.encoded()) }
-        if let _x = viewState { _w.bytesField(3, _x.encoded()) }
-        if let _x = collaborationCommandHistory { _w.bytesField(10, _x.encoded()) }
-        if let _x = collaborationSessionState { _w.bytesField(11, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSK.DocumentSupportArchive", [
+        .optional(1, TSP_Reference.self), .optional(4, .uint32), .optional(5, .uint32), .optional(6, .string),
+        .optional(7, .string), .optional(8, TSP_Reference.self), .optional(9, .bool), .optional(12, .string),
+        .optional(13, TSP_Reference.self), .optional(14, TSP_Reference.self), .optional(15, TSP_Reference.self),
+        .optional(2, TSP_Reference.self), .optional(3, TSP_Reference.self), .optional(10, TSP_Reference.self),
+        .optional(11, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 15)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var commandHistory: TSP_Reference? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var undoCount: UInt32? { get { self[1] } set { self[1] = newValue } }
+    var redoCount: UInt32? { get { self[2] } set { self[2] = newValue } }
+    var undoActionString: String? { get { self[3] } set { self[3] = newValue } }
+    var redoActionString: String? { get { self[4] } set { self[4] = newValue } }
+    var webState: TSP_Reference? { get { self[message: 5] } set { self[message: 5] = newValue } }
+    var isInCollaborationMode: Bool? { get { self[6] } set { self[6] = newValue } }
+    var actionStringLocalization: String? { get { self[7] } set { self[7] = newValue } }
+    var collaborationState: TSP_Reference? { get { self[message: 8] } set { self[message: 8] = newValue } }
+    var activityNotificationMap: TSP_Reference? { get { self[message: 9] } set { self[message: 9] = newValue } }
+    var removedAuthorAuditorPendingState: TSP_Reference? { get { self[message: 10] } set { self[message: 10] = newValue } }
+    var commandSelectionBehaviorHistory: TSP_Reference? { get { self[message: 11] } set { self[message: 11] = newValue } }
+    var viewState: TSP_Reference? { get { self[message: 12] } set { self[message: 12] = newValue } }
+    var collaborationCommandHistory: TSP_Reference? { get { self[message: 13] } set { self[message: 13] = newValue } }
+    var collaborationSessionState: TSP_Reference? { get { self[message: 14] } set { self[message: 14] = newValue } }
 }
 
 /// Generated wire model for `TSK.ViewStateArchive`.
 final class TSK_ViewStateArchive: IWAMessage {
-    var viewStateRoot: TSP_Reference?
-    var documentRevisionSequence: Int32?
-    var documentRevisionIdentifier: String?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSK.ViewStateArchive", [
+        .optional(1, TSP_Reference.self), .optional(2, .int32), .optional(3, .string),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { viewStateRoot = _v }
-        case 2:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { documentRevisionSequence = _v }
-        case 3:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { documentRevisionIdentifier = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = viewStateRoot { _w.bytesField(1, _x.encoded()) }
-        if let _x = documentRevisionSequence { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = documentRevisionIdentifier { _w.stringField(3, _x) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var viewStateRoot: TSP_Reference? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var documentRevisionSequence: Int32? { get { self[1] } set { self[1] = newValue } }
+    var documentRevisionIdentifier: String? { get { self[2] } set { self[2] = newValue } }
 }
 
 /// Generated wire model for `TSK.CommandArchive`.
 final class TSK_CommandArchive: IWAMessage {
-    var undoredostate: TSP_Reference?
-    var undocollection: TSP_Reference?
-    var shadowedByTransform: Bool?
-    var shadowedByCommit: Bool?
-    var remote: Bool?
-    var shouldHoldUntilGroupCommit: Bool?
-    var serverOriginated: Bool?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSK.CommandArchive", [
+        .optional(1, TSP_Reference.self), .optional(2, TSP_Reference.self), .optional(3, .bool), .optional(4, .bool),
+        .optional(5, .bool), .optional(6, .bool), .optional(7, .bool),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 7)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { undoredostate = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { undocollection = _v }
-        case 3:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { shadowedByTransform = _v }
-        case 4:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { shadowedByCommit = _v }
-        case 5:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { remote = _v }
-        case 6:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { shouldHoldUntilGroupCommit = _v }
-        case 7:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { serverOriginated = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = undoredostate { _w.bytesField(1, _x.encoded()) }
-        if let _x = undocollection { _w.bytesField(2, _x.encoded()) }
-        if let _x = shadowedByTransform { _w.varintField(3, _x ? 1 : 0) }
-        if let _x = shadowedByCommit { _w.varintField(4, _x ? 1 : 0) }
-        if let _x = remote { _w.varintField(5, _x ? 1 : 0) }
-        if let _x = shouldHoldUntilGroupCommit { _w.varintField(6, _x ? 1 : 0) }
-        if let _x = serverOriginated { _w.varintField(7, _x ? 1 : 0) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var undoredostate: TSP_Reference? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var undocollection: TSP_Reference? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var shadowedByTransform: Bool? { get { self[2] } set { self[2] = newValue } }
+    var shadowedByCommit: Bool? { get { self[3] } set { self[3] = newValue } }
+    var remote: Bool? { get { self[4] } set { self[4] = newValue } }
+    var shouldHoldUntilGroupCommit: Bool? { get { self[5] } set { self[5] = newValue } }
+    var serverOriginated: Bool? { get { self[6] } set { self[6] = newValue } }
 }
 
 /// Generated wire model for `TSK.CommandGroupArchive`.
 final class TSK_CommandGroupArchive: IWAMessage {
-    var `super`: TSK_CommandArchive?
-    var commands: [TSP_Reference] = []
-    var processResults: TSP_IndexSet?
-    var actionString: String?
-    var canCoalesceGroup: Bool?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSK.CommandGroupArchive", [
+        .optional(1, TSK_CommandArchive.self), .repeated(2, TSP_Reference.self), .optional(3, TSP_IndexSet.self),
+        .optional(4, .string), .optional(5, .bool),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 5)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSK_CommandArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_CommandArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { commands.append(_v) }
-        case 3:
-            var _v: TSP_IndexSet?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_IndexSet(ProtobufMessage(_b)) }
-            if let _v { processResults = _v }
-        case 4:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { actionString = _v }
-        case 5:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { canCoalesceGroup = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        for _x in commands { _w.bytesField(2, _x.encoded()) }
-        if let _x = processResults { _w.bytesField(3, _x.encoded()) }
-        if let _x = actionString { _w.stringField(4, _x) }
-        if let _x = canCoalesceGroup { _w.varintField(5, _x ? 1 : 0) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var `super`: TSK_CommandArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var commands: [TSP_Reference] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(commands value: TSP_Reference) { append(value, toMessages: 1) }
+    var processResults: TSP_IndexSet? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var actionString: String? { get { self[3] } set { self[3] = newValue } }
+    var canCoalesceGroup: Bool? { get { self[4] } set { self[4] = newValue } }
 }
 
 /// Generated wire model for `TSK.InducedCommandCollectionArchive`.
 final class TSK_InducedCommandCollectionArchive: IWAMessage {
-    var `super`: TSK_CommandArchive?
-    var inducingCommand: TSP_Reference?
-    var inducedCommands: [TSP_Reference] = []
-    var indexesOfProcessedInducedCommands: TSP_IndexSet?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSK.InducedCommandCollectionArchive", [
+        .optional(1, TSK_CommandArchive.self), .optional(2, TSP_Reference.self), .repeated(3, TSP_Reference.self),
+        .optional(4, TSP_IndexSet.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSK_CommandArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_CommandArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { inducingCommand = _v }
-        case 3:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { inducedCommands.append(_v) }
-        case 4:
-            var _v: TSP_IndexSet?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_IndexSet(ProtobufMessage(_b)) }
-            if let _v { indexesOfProcessedInducedCommands = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = inducingCommand { _w.bytesField(2, _x.encoded()) }
-        for _x in inducedCommands { _w.bytesField(3, _x.encoded()) }
-        if let _x = indexesOfProcessedInducedCommands { _w.bytesField(4, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var `super`: TSK_CommandArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var inducingCommand: TSP_Reference? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var inducedCommands: [TSP_Reference] { get { self[messages: 2] } set { self[messages: 2] = newValue } }
+    func append(inducedCommands value: TSP_Reference) { append(value, toMessages: 2) }
+    var indexesOfProcessedInducedCommands: TSP_IndexSet? { get { self[message: 3] } set { self[message: 3] = newValue } }
 }
 
 /// Generated wire model for `TSK.PropagatedCommandCollectionArchive`.
 final class TSK_PropagatedCommandCollectionArchive: IWAMessage {
-    var `super`: TSK_CommandArchive?
-    var propagatableCommand: TSP_Reference?
-    var propagatableCommandProcessResult: Bool?
-    var propagatingCommand: TSP_Reference?
-    var propagatingCommandProcessResult: Bool?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSK.PropagatedCommandCollectionArchive", [
+        .optional(1, TSK_CommandArchive.self), .optional(2, TSP_Reference.self), .optional(3, .bool),
+        .optional(4, TSP_Reference.self), .optional(5, .bool),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 5)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSK_CommandArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_CommandArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { propagatableCommand = _v }
-        case 3:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { propagatableCommandProcessResult = _v }
-        case 4:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { propagatingCommand = _v }
-        case 5:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { propagatingCommandProcessResult = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = propagatableCommand { _w.bytesField(2, _x.encoded()) }
-        if let _x = propagatableCommandProcessResult { _w.varintField(3, _x ? 1 : 0) }
-        if let _x = propagatingCommand { _w.bytesField(4, _x.encoded()) }
-        if let _x = propagatingCommandProcessResult { _w.varintField(5, _x ? 1 : 0) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var `super`: TSK_CommandArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var propagatableCommand: TSP_Reference? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var propagatableCommandProcessResult: Bool? { get { self[2] } set { self[2] = newValue } }
+    var propagatingCommand: TSP_Reference? { get { self[message: 3] } set { self[message: 3] = newValue } }
+    var propagatingCommandProcessResult: Bool? { get { self[4] } set { self[4] = newValue } }
 }
 
 /// Generated wire model for `TSK.FinalCommandPairArchive`.
 final class TSK_FinalCommandPairArchive: IWAMessage {
-    var `super`: TSK_CommandArchive?
-    var command: TSP_Reference?
-    var commandProcessResult: Bool?
-    var finalCommand: TSP_Reference?
-    var finalCommandProcessResult: Bool?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSK.FinalCommandPairArchive", [
+        .optional(1, TSK_CommandArchive.self), .optional(2, TSP_Reference.self), .optional(3, .bool),
+        .optional(4, TSP_Reference.self), .optional(5, .bool),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 5)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSK_CommandArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_CommandArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { command = _v }
-        case 3:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { commandProcessResult = _v }
-        case 4:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { finalCommand = _v }
-        case 5:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { finalCommandProcessResult = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = command { _w.bytesField(2, _x.encoded()) }
-        if let _x = commandProcessResult { _w.varintField(3, _x ? 1 : 0) }
-        if let _x = finalCommand { _w.bytesField(4, _x.encoded()) }
-        if let _x = finalCommandProcessResult { _w.varintField(5, _x ? 1 : 0) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var `super`: TSK_CommandArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var command: TSP_Reference? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var commandProcessResult: Bool? { get { self[2] } set { self[2] = newValue } }
+    var finalCommand: TSP_Reference? { get { self[message: 3] } set { self[message: 3] = newValue } }
+    var finalCommandProcessResult: Bool? { get { self[4] } set { self[4] = newValue } }
 }
 
 /// Generated wire model for `TSK.CommandContainerArchive`.
 final class TSK_CommandContainerArchive: IWAMessage {
-    var commands: [TSP_Reference] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSK.CommandContainerArchive", [
+        .repeated(1, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { commands.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in commands { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var commands: [TSP_Reference] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(commands value: TSP_Reference) { append(value, toMessages: 0) }
 }
 
 /// Generated wire model for `TSK.ProgressiveCommandGroupArchive`.
 final class TSK_ProgressiveCommandGroupArchive: IWAMessage {
-    var `super`: TSK_CommandGroupArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSK.ProgressiveCommandGroupArchive", [
+        .optional(1, TSK_CommandGroupArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSK_CommandGroupArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_CommandGroupArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var `super`: TSK_CommandGroupArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
 }
 
 /// Generated wire model for `TSK.FormatStructArchive`.
 final class TSK_FormatStructArchive: IWAMessage {
-    var formatType: UInt32?
-    var decimalPlaces: UInt32?
-    var currencyCode: String?
-    var negativeStyle: UInt32?
-    var showThousandsSeparator: Bool?
-    var useAccountingStyle: Bool?
-    var durationStyle: UInt32?
-    var base: UInt32?
-    var basePlaces: UInt32?
-    var baseUseMinusSign: Bool?
-    var fractionAccuracy: UInt32?
-    var suppressDateFormat: Bool?
-    var suppressTimeFormat: Bool?
-    var dateTimeFormat: String?
-    var durationUnitLargest: UInt32?
-    var durationUnitSmallest: UInt32?
-    var customId: UInt32?
-    var customFormatString: String?
-    var scaleFactor: Double?
-    var requiresFractionReplacement: Bool?
-    var controlMinimum: Double?
-    var controlMaximum: Double?
-    var controlIncrement: Double?
-    var controlFormatType: UInt32?
-    var sliderOrientation: UInt32?
-    var sliderPosition: UInt32?
-    var decimalWidth: UInt32?
-    var minIntegerWidth: UInt32?
-    var numNonspaceIntegerDigits: UInt32?
-    var numNonspaceDecimalDigits: UInt32?
-    var indexFromRightLastInteger: UInt32?
-    var interstitialStrings: [String] = []
-    var intersStrInsertionIndexes: TSP_IndexSet?
-    var numHashDecimalDigits: UInt32?
-    var totalNumDecimalDigits: UInt32?
-    var isComplex: Bool?
-    var containsIntegerToken: Bool?
-    var multipleChoiceListInitialValue: UInt32?
-    var multipleChoiceListId: UInt32?
-    var useAutomaticDurationUnits: Bool?
-    var customUid: TSP_UUID?
-    var customFormat: TSK_CustomFormatArchive?
-    var usesPlusSign: Bool?
-    var boolTrueString: String?
-    var boolFalseString: String?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { formatType = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { decimalPlaces = _v }
-        case 3:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { currencyCode = _v }
-        case 4:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { negativeStyle = _v }
-        case 5:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { showThousandsSeparator = _v }
-        case 6:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { useAccountingStyle = _v }
-        case 7:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { durationStyle = _v }
-        case 8:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { base = _v }
-        case 9:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { basePlaces = _v }
-        case 10:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { baseUseMinusSign = _v }
-        case 11:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { fractionAccuracy = _v }
-        case 12:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { suppressDateFormat = _v }
-        case 13:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { suppressTimeFormat = _v }
-        case 14:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { dateTimeFormat = _v }
-        case 15:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { durationUnitLargest = _v }
-        case 16:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { durationUnitSmallest = _v }
-        case 17:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { customId = _v }
-        case 18:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { customFormatString = _v }
-        case 19:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { scaleFactor = _v }
-        case 20:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { requiresFractionReplacement = _v }
-        case 21:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { controlMinimum = _v }
-        case 22:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { controlMaximum = _v }
-        case 23:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { controlIncrement = _v }
-        case 24:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { controlFormatType = _v }
-        case 25:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { sliderOrientation = _v }
-        case 26:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { sliderPosition = _v }
-        case 27:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { decimalWidth = _v }
-        case 28:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { minIntegerWidth = _v }
-        case 29:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { numNonspaceIntegerDigits = _v }
-        case 30:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { numNonspaceDecimalDigits = _v }
-        case 31:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { indexFromRightLastInteger = _v }
-        case 32:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { interstitialStrings.append(_v) }
-        case 33:
-            var _v: TSP_IndexSet?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_IndexSet(ProtobufMessage(_b)) }
-            if let _v { intersStrInsertionIndexes = _v }
-        case 34:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { numHashDecimalDigits = _v }
-        case 35:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { totalNumDecimalDigits = _v }
-        case 36:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { isComplex = _v }
-        case 37:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { containsIntegerToken = _v }
-        case 38:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { multipleChoiceListInitialValue = _v }
-        case 39:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { multipleChoiceListId = _v }
-        case 40:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { useAutomaticDurationUnits = _v }
-        case 41:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { customUid = _v }
-        case 42:
-            var _v: TSK_CustomFormatArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_CustomFormatArchive(ProtobufMessage(_b)) }
-            if let _v { customFormat = _v }
-        case 43:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { usesPlusSign = _v }
-        case 44:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { boolTrueString = _v }
-        case 45:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { boolFalseString = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = formatType { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = decimalPlaces { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = currencyCode { _w.stringField(3, _x) }
-        if let _x = negativeStyle { _w.varintField(4, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = showThousandsSeparator { _w.varintField(5, _x ? 1 : 0) }
-        if let _x = useAccountingStyle { _w.varintField(6, _x ? 1 : 0) }
-        if let _x = durationStyle { _w.varintField(7, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = base { _w.varintField(8, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = basePlaces { _w.varintField(9, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = baseUseMinusSign { _w.varintField(10, _x ? 1 : 0) }
-        if let _x = fractionAccuracy { _w.varintField(11, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = suppressDateFormat { _w.varintField(12, _x ? 1 : 0) }
-        if let _x = suppressTimeFormat { _w.varintField(13, _x ? 1 : 0) }
-        if let _x = dateTimeFormat { _w.stringField(14, _x) }
-        if let _x = durationUnitLargest { _w.varintField(15, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = durationUnitSmallest { _w.varintField(16, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = customId { _w.varintField(17, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = customFormatString { _w.stringField(18, _x) }
-        if let _x = scaleFactor { _w.fixed64Field(19, _x.bitPattern) }
-        if let _x = requiresFractionReplacement { _w.varintField(20, _x ? 1 : 0) }
-        if let _x = controlMinimum { _w.fixed64Field(21, _x.bitPattern) }
-        if let _x = controlMaximum { _w.fixed64Field(22, _x.bitPattern) }
-        if let _x = controlIncrement { _w.fixed64Field(23, _x.bitPattern) }
-        if let _x = controlFormatType { _w.varintField(24, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = sliderOrientation { _w.varintField(25, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = sliderPosition { _w.varintField(26, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = decimalWidth { _w.varintField(27, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = minIntegerWidth { _w.varintField(28, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = numNonspaceIntegerDigits { _w.varintField(29, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = numNonspaceDecimalDigits { _w.varintField(30, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = indexFromRightLastInteger { _w.varintField(31, UInt64(truncatingIfNeeded: _x)) }
-        for _x in interstitialStrings { _w.stringField(32, _x) }
-        if let _x = intersStrInsertionIndexes { _w.bytesField(33, _x.encoded()) }
-        if let _x = numHashDecimalDigits { _w.varintField(34, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = totalNumDecimalDigits { _w.varintField(35, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = isComplex { _w.varintField(36, _x ? 1 : 0) }
-        if let _x = containsIntegerToken { _w.varintField(37, _x ? 1 : 0) }
-        if let _x = multipleChoiceListInitialValue { _w.varintField(38, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = multipleChoiceListId { _w.varintField(39, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = useAutomaticDurationUnits { _w.varintField(40, _x ? 1 : 0) }
-        if let _x = customUid { _w.bytesField(41, _x.encoded()) }
-        if let _x = customFormat { _w.bytesField(42, _x.encoded()) }
-        if let _x = usesPlusSign { _w.varintField(43, _x ? 1 : 0) }
-        if let _x = boolTrueString { _w.stringField(44, _x) }
-        if let _x = boolFalseString { _w.stringField(45, _x) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSK.FormatStructArchive", [
+        .optional(1, .uint32), .optional(2, .uint32), .optional(3, .string), .optional(4, .uint32), .optional(5, .bool),
+        .optional(6, .bool), .optional(7, .uint32), .optional(8, .uint32), .optional(9, .uint32), .optional(10, .bool),
+        .optional(11, .uint32), .optional(12, .bool), .optional(13, .bool), .optional(14, .string),
+        .optional(15, .uint32), .optional(16, .uint32), .optional(17, .uint32), .optional(18, .string),
+        .optional(19, .double), .optional(20, .bool), .optional(21, .double), .optional(22, .double),
+        .optional(23, .double), .optional(24, .uint32), .optional(25, .uint32), .optional(26, .uint32),
+        .optional(27, .uint32), .optional(28, .uint32), .optional(29, .uint32), .optional(30, .uint32),
+        .optional(31, .uint32), .repeated(32, .string), .optional(33, TSP_IndexSet.self), .optional(34, .uint32),
+        .optional(35, .uint32), .optional(36, .bool), .optional(37, .bool), .optional(38, .uint32),
+        .optional(39, .uint32), .optional(40, .bool), .optional(41, TSP_UUID.self),
+        .optional(42, TSK_CustomFormatArchive.self), .optional(43, .bool), .optional(44, .string),
+        .optional(45, .string),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 45)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var formatType: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var decimalPlaces: UInt32? { get { self[1] } set { self[1] = newValue } }
+    var currencyCode: String? { get { self[2] } set { self[2] = newValue } }
+    var negativeStyle: UInt32? { get { self[3] } set { self[3] = newValue } }
+    var showThousandsSeparator: Bool? { get { self[4] } set { self[4] = newValue } }
+    var useAccountingStyle: Bool? { get { self[5] } set { self[5] = newValue } }
+    var durationStyle: UInt32? { get { self[6] } set { self[6] = newValue } }
+    var base: UInt32? { get { self[7] } set { self[7] = newValue } }
+    var basePlaces: UInt32? { get { self[8] } set { self[8] = newValue } }
+    var baseUseMinusSign: Bool? { get { self[9] } set { self[9] = newValue } }
+    var fractionAccuracy: UInt32? { get { self[10] } set { self[10] = newValue } }
+    var suppressDateFormat: Bool? { get { self[11] } set { self[11] = newValue } }
+    var suppressTimeFormat: Bool? { get { self[12] } set { self[12] = newValue } }
+    var dateTimeFormat: String? { get { self[13] } set { self[13] = newValue } }
+    var durationUnitLargest: UInt32? { get { self[14] } set { self[14] = newValue } }
+    var durationUnitSmallest: UInt32? { get { self[15] } set { self[15] = newValue } }
+    var customId: UInt32? { get { self[16] } set { self[16] = newValue } }
+    var customFormatString: String? { get { self[17] } set { self[17] = newValue } }
+    var scaleFactor: Double? { get { self[18] } set { self[18] = newValue } }
+    var requiresFractionReplacement: Bool? { get { self[19] } set { self[19] = newValue } }
+    var controlMinimum: Double? { get { self[20] } set { self[20] = newValue } }
+    var controlMaximum: Double? { get { self[21] } set { self[21] = newValue } }
+    var controlIncrement: Double? { get { self[22] } set { self[22] = newValue } }
+    var controlFormatType: UInt32? { get { self[23] } set { self[23] = newValue } }
+    var sliderOrientation: UInt32? { get { self[24] } set { self[24] = newValue } }
+    var sliderPosition: UInt32? { get { self[25] } set { self[25] = newValue } }
+    var decimalWidth: UInt32? { get { self[26] } set { self[26] = newValue } }
+    var minIntegerWidth: UInt32? { get { self[27] } set { self[27] = newValue } }
+    var numNonspaceIntegerDigits: UInt32? { get { self[28] } set { self[28] = newValue } }
+    var numNonspaceDecimalDigits: UInt32? { get { self[29] } set { self[29] = newValue } }
+    var indexFromRightLastInteger: UInt32? { get { self[30] } set { self[30] = newValue } }
+    var interstitialStrings: [String] { get { self[all: 31] } set { self[all: 31] = newValue } }
+    func append(interstitialStrings value: String) { append(value, toAll: 31) }
+    var intersStrInsertionIndexes: TSP_IndexSet? { get { self[message: 32] } set { self[message: 32] = newValue } }
+    var numHashDecimalDigits: UInt32? { get { self[33] } set { self[33] = newValue } }
+    var totalNumDecimalDigits: UInt32? { get { self[34] } set { self[34] = newValue } }
+    var isComplex: Bool? { get { self[35] } set { self[35] = newValue } }
+    var containsIntegerToken: Bool? { get { self[36] } set { self[36] = newValue } }
+    var multipleChoiceListInitialValue: UInt32? { get { self[37] } set { self[37] = newValue } }
+    var multipleChoiceListId: UInt32? { get { self[38] } set { self[38] = newValue } }
+    var useAutomaticDurationUnits: Bool? { get { self[39] } set { self[39] = newValue } }
+    var customUid: TSP_UUID? { get { self[message: 40] } set { self[message: 40] = newValue } }
+    var customFormat: TSK_CustomFormatArchive? { get { self[message: 41] } set { self[message: 41] = newValue } }
+    var usesPlusSign: Bool? { get { self[42] } set { self[42] = newValue } }
+    var boolTrueString: String? { get { self[43] } set { self[43] = newValue } }
+    var boolFalseString: String? { get { self[44] } set { self[44] = newValue } }
 }
 
 /// Generated wire model for `TSK.CustomFormatArchive`.
 final class TSK_CustomFormatArchive: IWAMessage {
-    var name: String?
-    var formatTypePreBnc: UInt32?
-    var defaultFormat: TSK_FormatStructArchive?
-    var conditions: [TSK_CustomFormatArchive_Condition] = []
-    var formatType: UInt32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSK.CustomFormatArchive", [
+        .optional(1, .string), .optional(2, .uint32), .optional(3, TSK_FormatStructArchive.self),
+        .repeated(4, TSK_CustomFormatArchive_Condition.self), .optional(5, .uint32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 5)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { name = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { formatTypePreBnc = _v }
-        case 3:
-            var _v: TSK_FormatStructArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_FormatStructArchive(ProtobufMessage(_b)) }
-            if let _v { defaultFormat = _v }
-        case 4:
-            var _v: TSK_CustomFormatArchive_Condition?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_CustomFormatArchive_Condition(ProtobufMessage(_b)) }
-            if let _v { conditions.append(_v) }
-        case 5:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { formatType = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = name { _w.stringField(1, _x) }
-        if let _x = formatTypePreBnc { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = defaultFormat { _w.bytesField(3, _x.encoded()) }
-        for _x in conditions { _w.bytesField(4, _x.encoded()) }
-        if let _x = formatType { _w.varintField(5, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var name: String? { get { self[0] } set { self[0] = newValue } }
+    var formatTypePreBnc: UInt32? { get { self[1] } set { self[1] = newValue } }
+    var defaultFormat: TSK_FormatStructArchive? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var conditions: [TSK_CustomFormatArchive_Condition] { get { self[messages: 3] } set { self[messages: 3] = newValue } }
+    func append(conditions value: TSK_CustomFormatArchive_Condition) { append(value, toMessages: 3) }
+    var formatType: UInt32? { get { self[4] } set { self[4] = newValue } }
 }
 
 /// Generated wire model for `TSK.CustomFormatArchive.Condition`.
 final class TSK_CustomFormatArchive_Condition: IWAMessage {
-    var conditionType: UInt32?
-    var conditionValue: Float?
-    var conditionFormat: TSK_FormatStructArchive?
-    var conditionValueDbl: Double?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSK.CustomFormatArchive.Condition", [
+        .optional(1, .uint32), .optional(2, .float), .optional(3, TSK_FormatStructArchive.self), .optional(4, .double),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { conditionType = _v }
-        case 2:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { conditionValue = _v }
-        case 3:
-            var _v: TSK_FormatStructArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_FormatStructArchive(ProtobufMessage(_b)) }
-            if let _v { conditionFormat = _v }
-        case 4:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { conditionValueDbl = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = conditionType { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = conditionValue { _w.fixed32Field(2, _x.bitPattern) }
-        if let _x = conditionFormat { _w.bytesField(3, _x.encoded()) }
-        if let _x = conditionValueDbl { _w.fixed64Field(4, _x.bitPattern) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var conditionType: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var conditionValue: Float? { get { self[1] } set { self[1] = newValue } }
+    var conditionFormat: TSK_FormatStructArchive? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var conditionValueDbl: Double? { get { self[3] } set { self[3] = newValue } }
 }
 
 /// Generated wire model for `TSK.CustomFormatListArchive`.
 final class TSK_CustomFormatListArchive: IWAMessage {
-    var uuids: [TSP_UUID] = []
-    var customFormats: [TSK_CustomFormatArchive] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSK.CustomFormatListArchive", [
+        .repeated(1, TSP_UUID.self), .repeated(2, TSK_CustomFormatArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { uuids.append(_v) }
-        case 2:
-            var _v: TSK_CustomFormatArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_CustomFormatArchive(ProtobufMessage(_b)) }
-            if let _v { customFormats.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in uuids { _w.bytesField(1, _x.encoded()) }
-        for _x in customFormats { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var uuids: [TSP_UUID] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(uuids value: TSP_UUID) { append(value, toMessages: 0) }
+    var customFormats: [TSK_CustomFormatArchive] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(customFormats value: TSK_CustomFormatArchive) { append(value, toMessages: 1) }
 }
 
 /// Generated wire model for `TSK.AnnotationAuthorArchive`.
 final class TSK_AnnotationAuthorArchive: IWAMessage {
-    var name: String?
-    var color: TSP_Color?
-    var publicId: String?
-    var isPublicAuthor: Bool?
-    var publicIds: [String] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSK.AnnotationAuthorArchive", [
+        .optional(1, .string), .optional(2, TSP_Color.self), .optional(3, .string), .optional(4, .bool),
+        .repeated(5, .string),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 5)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { name = _v }
-        case 2:
-            var _v: TSP_Color?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Color(ProtobufMessage(_b)) }
-            if let _v { color = _v }
-        case 3:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { publicId = _v }
-        case 4:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { isPublicAuthor = _v }
-        case 5:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { publicIds.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = name { _w.stringField(1, _x) }
-        if let _x = color { _w.bytesField(2, _x.encoded()) }
-        if let _x = publicId { _w.stringField(3, _x) }
-        if let _x = isPublicAuthor { _w.varintField(4, _x ? 1 : 0) }
-        for _x in publicIds { _w.stringField(5, _x) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var name: String? { get { self[0] } set { self[0] = newValue } }
+    var color: TSP_Color? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var publicId: String? { get { self[2] } set { self[2] = newValue } }
+    var isPublicAuthor: Bool? { get { self[3] } set { self[3] = newValue } }
+    var publicIds: [String] { get { self[all: 4] } set { self[all: 4] = newValue } }
+    func append(publicIds value: String) { append(value, toAll: 4) }
 }
 
 /// Generated wire model for `TSK.DeprecatedChangeAuthorArchive`.
 final class TSK_DeprecatedChangeAuthorArchive: IWAMessage {
-    var name: String?
-    var changeColor: TSP_Color?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSK.DeprecatedChangeAuthorArchive", [
+        .optional(1, .string), .optional(2, TSP_Color.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { name = _v }
-        case 2:
-            var _v: TSP_Color?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Color(ProtobufMessage(_b)) }
-            if let _v { changeColor = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = name { _w.stringField(1, _x) }
-        if let _x = changeColor { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var name: String? { get { self[0] } set { self[0] = newValue } }
+    var changeColor: TSP_Color? { get { self[message: 1] } set { self[message: 1] = newValue } }
 }
 
 /// Generated wire model for `TSK.AnnotationAuthorStorageArchive`.
 final class TSK_AnnotationAuthorStorageArchive: IWAMessage {
-    var annotationAuthor: [TSP_Reference] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSK.AnnotationAuthorStorageArchive", [
+        .repeated(1, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { annotationAuthor.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in annotationAuthor { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var annotationAuthor: [TSP_Reference] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(annotationAuthor value: TSP_Reference) { append(value, toMessages: 0) }
 }
 
 /// Generated wire model for `TSK.CommandBehaviorSelectionPathStorageArchive`.
 final class TSK_CommandBehaviorSelectionPathStorageArchive: IWAMessage {
-    var archivedSelection: TSK_SelectionPathArchive?
-    var archivedOldSelection: TSK_SelectionPathArchive?
-    var archivedNewSelection: TSK_SelectionPathArchive?
-    var forwardSelectionPathTransformer: TSP_Reference?
-    var reverseSelectionPathTransformer: TSP_Reference?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSK.CommandBehaviorSelectionPathStorageArchive", [
+        .optional(1, TSK_SelectionPathArchive.self), .optional(2, TSK_SelectionPathArchive.self),
+        .optional(3, TSK_SelectionPathArchive.self), .optional(4, TSP_Reference.self), .optional(5, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 5)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSK_SelectionPathArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_SelectionPathArchive(ProtobufMessage(_b)) }
-            if let _v { archivedSelection = _v }
-        case 2:
-            var _v: TSK_SelectionPathArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_SelectionPathArchive(ProtobufMessage(_b)) }
-            if let _v { archivedOldSelection = _v }
-        case 3:
-            var _v: TSK_SelectionPathArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_SelectionPathArchive(ProtobufMessage(_b)) }
-            if let _v { archivedNewSelection = _v }
-        case 4:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { forwardSelectionPathTransformer = _v }
-        case 5:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { reverseSelectionPathTransformer = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = archivedSelection { _w.bytesField(1, _x.encoded()) }
-        if let _x = archivedOldSelection { _w.bytesField(2, _x.encoded()) }
-        if let _x = archivedNewSelection { _w.bytesField(3, _x.encoded()) }
-        if let _x = forwardSelectionPathTransformer { _w.bytesField(4, _x.encoded()) }
-        if let _x = reverseSelectionPathTransformer { _w.bytesField(5, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var archivedSelection: TSK_SelectionPathArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var archivedOldSelection: TSK_SelectionPathArchive? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var archivedNewSelection: TSK_SelectionPathArchive? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var forwardSelectionPathTransformer: TSP_Reference? { get { self[message: 3] } set { self[message: 3] = newValue } }
+    var reverseSelectionPathTransformer: TSP_Reference? { get { self[message: 4] } set { self[message: 4] = newValue } }
 }
 
 /// Generated wire model for `TSK.CommandBehaviorArchive`.
 final class TSK_CommandBehaviorArchive: IWAMessage {
-    var selectionBehavior: TSP_Reference?
-    var activityBehavior: TSP_Reference?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSK.CommandBehaviorArchive", [
+        .optional(1, TSP_Reference.self), .optional(2, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { selectionBehavior = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { activityBehavior = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = selectionBehavior { _w.bytesField(1, _x.encoded()) }
-        if let _x = activityBehavior { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var selectionBehavior: TSP_Reference? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var activityBehavior: TSP_Reference? { get { self[message: 1] } set { self[message: 1] = newValue } }
 }
 
 /// Generated wire model for `TSK.CommandSelectionBehaviorArchive`.
 final class TSK_CommandSelectionBehaviorArchive: IWAMessage {
-    var selectionPathStorage: TSP_Reference?
-    var selectionFlags: UInt64?
-    var additionalForwardSelectionFlags: UInt64?
-    var additionalReverseSelectionFlags: UInt64?
-    var additionalSelectionBehaviors: [TSP_Reference] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSK.CommandSelectionBehaviorArchive", [
+        .optional(1, TSP_Reference.self), .optional(2, .uint64), .optional(3, .uint64), .optional(4, .uint64),
+        .repeated(5, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 5)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { selectionPathStorage = _v }
-        case 2:
-            var _v: UInt64?
-            if case .varint(let _u) = _f.value { _v = UInt64(truncatingIfNeeded: _u) }
-            if let _v { selectionFlags = _v }
-        case 3:
-            var _v: UInt64?
-            if case .varint(let _u) = _f.value { _v = UInt64(truncatingIfNeeded: _u) }
-            if let _v { additionalForwardSelectionFlags = _v }
-        case 4:
-            var _v: UInt64?
-            if case .varint(let _u) = _f.value { _v = UInt64(truncatingIfNeeded: _u) }
-            if let _v { additionalReverseSelectionFlags = _v }
-        case 5:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { additionalSelectionBehaviors.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = selectionPathStorage { _w.bytesField(1, _x.encoded()) }
-        if let _x = selectionFlags { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = additionalForwardSelectionFlags { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = additionalReverseSelectionFlags { _w.varintField(4, UInt64(truncatingIfNeeded: _x)) }
-        for _x in additionalSelectionBehaviors { _w.bytesField(5, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var selectionPathStorage: TSP_Reference? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var selectionFlags: UInt64? { get { self[1] } set { self[1] = newValue } }
+    var additionalForwardSelectionFlags: UInt64? { get { self[2] } set { self[2] = newValue } }
+    var additionalReverseSelectionFlags: UInt64? { get { self[3] } set { self[3] = newValue } }
+    var additionalSelectionBehaviors: [TSP_Reference] { get { self[messages: 4] } set { self[messages: 4] = newValue } }
+    func append(additionalSelectionBehaviors value: TSP_Reference) { append(value, toMessages: 4) }
 }
 
 /// Generated wire model for `TSK.SelectionPathTransformerArchive`.
 final class TSK_SelectionPathTransformerArchive: IWAMessage {
-    var selectionTransformers: [TSP_Reference] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSK.SelectionPathTransformerArchive", [
+        .repeated(1, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { selectionTransformers.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in selectionTransformers { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var selectionTransformers: [TSP_Reference] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(selectionTransformers value: TSP_Reference) { append(value, toMessages: 0) }
 }
 
 /// Generated wire model for `TSK.SelectionPathArchive`.
 final class TSK_SelectionPathArchive: IWAMessage {
-    var orderedSelections: [TSP_Reference] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSK.SelectionPathArchive", [
+        .repeated(1, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { orderedSelections.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in orderedSelections { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var orderedSelections: [TSP_Reference] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(orderedSelections value: TSP_Reference) { append(value, toMessages: 0) }
 }
 
 /// Generated wire model for `TSK.DocumentSelectionArchive`.
 final class TSK_DocumentSelectionArchive: IWAMessage {
-    var documentRoot: TSP_Reference?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSK.DocumentSelectionArchive", [
+        .optional(1, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { documentRoot = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = documentRoot { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var documentRoot: TSP_Reference? { get { self[message: 0] } set { self[message: 0] = newValue } }
 }
 
 /// Generated wire model for `TSK.NullCommandArchive`.
 final class TSK_NullCommandArchive: IWAMessage {
-    var `super`: TSK_CommandArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSK.NullCommandArchive", [
+        .optional(1, TSK_CommandArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSK_CommandArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_CommandArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var `super`: TSK_CommandArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
 }
 
 /// Generated wire model for `TSK.GroupCommitCommandArchive`.
 final class TSK_GroupCommitCommandArchive: IWAMessage {
-    var `super`: TSK_CommandArchive?
-    var canCoalesceGroup: Bool?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSK.GroupCommitCommandArchive", [
+        .optional(1, TSK_CommandArchive.self), .optional(2, .bool),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSK_CommandArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_CommandArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { canCoalesceGroup = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = canCoalesceGroup { _w.varintField(2, _x ? 1 : 0) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var `super`: TSK_CommandArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var canCoalesceGroup: Bool? { get { self[1] } set { self[1] = newValue } }
 }
 
 /// Generated wire model for `TSK.UpgradeDocPostProcessingCommandArchive`.
 final class TSK_UpgradeDocPostProcessingCommandArchive: IWAMessage {
-    var `super`: TSK_CommandArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSK.UpgradeDocPostProcessingCommandArchive", [
+        .optional(1, TSK_CommandArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSK_CommandArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_CommandArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var `super`: TSK_CommandArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
 }
 
 /// Generated wire model for `TSK.InducedCommandCollectionCommitCommandArchive`.
 final class TSK_InducedCommandCollectionCommitCommandArchive: IWAMessage {
-    var `super`: TSK_CommandArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSK.InducedCommandCollectionCommitCommandArchive", [
+        .optional(1, TSK_CommandArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSK_CommandArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_CommandArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var `super`: TSK_CommandArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
 }
 
 /// Generated wire model for `TSK.ChangeDocumentPackageTypeCommandArchive`.
 final class TSK_ChangeDocumentPackageTypeCommandArchive: IWAMessage {
-    var `super`: TSK_CommandArchive?
-    var newPackageType: Int32?
-    var oldPackageType: Int32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSK.ChangeDocumentPackageTypeCommandArchive", [
+        .optional(1, TSK_CommandArchive.self), .optional(2, .int32), .optional(3, .int32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSK_CommandArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_CommandArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { newPackageType = _v }
-        case 3:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { oldPackageType = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = newPackageType { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = oldPackageType { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var `super`: TSK_CommandArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var newPackageType: Int32? { get { self[1] } set { self[1] = newValue } }
+    var oldPackageType: Int32? { get { self[2] } set { self[2] = newValue } }
 }
 
 /// Generated wire model for `TSK.RangeAddress`.
 final class TSK_RangeAddress: IWAMessage {
-    var addressIdentifier: [UInt64] = []
-    var rangeList: [UInt32] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSK.RangeAddress", [
+        .repeated(1, .uint64), .repeated(2, .uint32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            if case .varint(let _u) = _f.value { addressIdentifier.append(UInt64(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { addressIdentifier.append(UInt64(truncatingIfNeeded: _u)) } }
-        case 2:
-            if case .varint(let _u) = _f.value { rangeList.append(UInt32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { rangeList.append(UInt32(truncatingIfNeeded: _u)) } }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in addressIdentifier { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        for _x in rangeList { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var addressIdentifier: [UInt64] { get { self[all: 0] } set { self[all: 0] = newValue } }
+    func append(addressIdentifier value: UInt64) { append(value, toAll: 0) }
+    var rangeList: [UInt32] { get { self[all: 1] } set { self[all: 1] = newValue } }
+    func append(rangeList value: UInt32) { append(value, toAll: 1) }
 }
 
 /// Generated wire model for `TSK.Operation`.
 final class TSK_Operation: IWAMessage {
-    var type: Int32?
-    var noop: Bool?
-    var addressIdentifier: [UInt64] = []
-    var insertLength: UInt64?
-    var preserveLowerPriorityLocation: Bool?
-    var rangeList: [UInt32] = []
-    var transformBehavior: UInt32?
-    var propertyId: UInt32?
-    var fromIndex: Int32?
-    var toIndex: Int32?
-    var dominating: Bool?
-    var objectCount: Int32?
-    var objectCounterSpace: Int32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { type = _v }
-        case 2:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { noop = _v }
-        case 3:
-            var _v: UInt64?
-            if case .fixed64(let _b) = _f.value { _v = IWAWire.u64(_b) }
-            if let _v { addressIdentifier.append(_v) }
-        case 4:
-            var _v: UInt64?
-            if case .varint(let _u) = _f.value { _v = UInt64(truncatingIfNeeded: _u) }
-            if let _v { insertLength = _v }
-        case 5:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { preserveLowerPriorityLocation = _v }
-        case 6:
-            if case .varint(let _u) = _f.value { rangeList.append(UInt32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { rangeList.append(UInt32(truncatingIfNeeded: _u)) } }
-        case 7:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { transformBehavior = _v }
-        case 8:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { propertyId = _v }
-        case 9:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { fromIndex = _v }
-        case 10:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { toIndex = _v }
-        case 11:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { dominating = _v }
-        case 12:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { objectCount = _v }
-        case 13:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { objectCounterSpace = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = type { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = noop { _w.varintField(2, _x ? 1 : 0) }
-        for _x in addressIdentifier { _w.fixed64Field(3, _x) }
-        if let _x = insertLength { _w.varintField(4, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = preserveLowerPriorityLocation { _w.varintField(5, _x ? 1 : 0) }
-        if !rangeList.isEmpty { _w.packedVarintField(6, rangeList.map { UInt64(truncatingIfNeeded: $0) }) }
-        if let _x = transformBehavior { _w.varintField(7, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = propertyId { _w.varintField(8, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = fromIndex { _w.varintField(9, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = toIndex { _w.varintField(10, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = dominating { _w.varintField(11, _x ? 1 : 0) }
-        if let _x = objectCount { _w.varintField(12, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = objectCounterSpace { _w.varintField(13, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSK.Operation", [
+        .optional(1, .int32), .optional(2, .bool), .repeated(3, .fixed64), .optional(4, .uint64), .optional(5, .bool),
+        .repeated(6, .uint32, packed: true), .optional(7, .uint32), .optional(8, .uint32), .optional(9, .int32),
+        .optional(10, .int32), .optional(11, .bool), .optional(12, .int32), .optional(13, .int32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 13)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var type: Int32? { get { self[0] } set { self[0] = newValue } }
+    var noop: Bool? { get { self[1] } set { self[1] = newValue } }
+    var addressIdentifier: [UInt64] { get { self[all: 2] } set { self[all: 2] = newValue } }
+    func append(addressIdentifier value: UInt64) { append(value, toAll: 2) }
+    var insertLength: UInt64? { get { self[3] } set { self[3] = newValue } }
+    var preserveLowerPriorityLocation: Bool? { get { self[4] } set { self[4] = newValue } }
+    var rangeList: [UInt32] { get { self[all: 5] } set { self[all: 5] = newValue } }
+    func append(rangeList value: UInt32) { append(value, toAll: 5) }
+    var transformBehavior: UInt32? { get { self[6] } set { self[6] = newValue } }
+    var propertyId: UInt32? { get { self[7] } set { self[7] = newValue } }
+    var fromIndex: Int32? { get { self[8] } set { self[8] = newValue } }
+    var toIndex: Int32? { get { self[9] } set { self[9] = newValue } }
+    var dominating: Bool? { get { self[10] } set { self[10] = newValue } }
+    var objectCount: Int32? { get { self[11] } set { self[11] = newValue } }
+    var objectCounterSpace: Int32? { get { self[12] } set { self[12] = newValue } }
 }
 
 /// Generated wire model for `TSK.OperationTransformer`.
 final class TSK_OperationTransformer: IWAMessage {
-    var higherPriority: Bool?
-    var operations: [TSK_Operation] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSK.OperationTransformer", [
+        .optional(1, .bool), .repeated(2, TSK_Operation.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { higherPriority = _v }
-        case 2:
-            var _v: TSK_Operation?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_Operation(ProtobufMessage(_b)) }
-            if let _v { operations.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = higherPriority { _w.varintField(1, _x ? 1 : 0) }
-        for _x in operations { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var higherPriority: Bool? { get { self[0] } set { self[0] = newValue } }
+    var operations: [TSK_Operation] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(operations value: TSK_Operation) { append(value, toMessages: 1) }
 }
 
 /// Generated wire model for `TSK.OutgoingCommandQueueItem`.
 final class TSK_OutgoingCommandQueueItem: IWAMessage {
-    var command: TSP_Reference?
-    var serializedJsonWithoutDataBase64EncodedString: String?
-    var serializedJsonWithoutDataBase64EncodedData: TSP_DataReference?
-    var didRollbackReapply: Bool?
-    var containsLargePendingUploadData: Bool?
-    var uuidToDataMapEntries: [TSK_OutgoingCommandQueueItemUUIDToDataMapEntry] = []
-    var largeDataList: [TSP_DataReference] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSK.OutgoingCommandQueueItem", [
+        .optional(1, TSP_Reference.self), .optional(2, .string), .optional(4, TSP_DataReference.self),
+        .optional(6, .bool), .optional(7, .bool), .repeated(3, TSK_OutgoingCommandQueueItemUUIDToDataMapEntry.self),
+        .repeated(5, TSP_DataReference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 7)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { command = _v }
-        case 2:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { serializedJsonWithoutDataBase64EncodedString = _v }
-        case 4:
-            var _v: TSP_DataReference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_DataReference(ProtobufMessage(_b)) }
-            if let _v { serializedJsonWithoutDataBase64EncodedData = _v }
-        case 6:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { didRollbackReapply = _v }
-        case 7:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { containsLargePendingUploadData = _v }
-        case 3:
-            var _v: TSK_OutgoingCommandQueueItemUUIDToDataMapEntry?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_OutgoingCommandQueueItemUUIDToDataMapEntry(ProtobufMessage(_b)) }
-            if let _v { uuidToDataMapEntries.append(_v) }
-        case 5:
-            var _v: TSP_DataReference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_DataReference(ProtobufMessage(_b)) }
-            if let _v { largeDataList.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = command { _w.bytesField(1, _x.encoded()) }
-        if let _x = serializedJsonWithoutDataBase64EncodedString { _w.stringField(2, _x) }
-        if let _x = serializedJsonWithoutDataBase64EncodedData { _w.bytesField(4, _x.encoded()) }
-        if let _x = didRollbackReapply { _w.varintField(6, _x ? 1 : 0) }
-        if let _x = containsLargePendingUploadData { _w.varintField(7, _x ? 1 : 0) }
-        for _x in uuidToDataMapEntries { _w.bytesField(3, _x.encoded()) }
-        for _x in largeDataList { _w.bytesField(5, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var command: TSP_Reference? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var serializedJsonWithoutDataBase64EncodedString: String? { get { self[1] } set { self[1] = newValue } }
+    var serializedJsonWithoutDataBase64EncodedData: TSP_DataReference? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var didRollbackReapply: Bool? { get { self[3] } set { self[3] = newValue } }
+    var containsLargePendingUploadData: Bool? { get { self[4] } set { self[4] = newValue } }
+    var uuidToDataMapEntries: [TSK_OutgoingCommandQueueItemUUIDToDataMapEntry] { get { self[messages: 5] } set { self[messages: 5] = newValue } }
+    func append(uuidToDataMapEntries value: TSK_OutgoingCommandQueueItemUUIDToDataMapEntry) { append(value, toMessages: 5) }
+    var largeDataList: [TSP_DataReference] { get { self[messages: 6] } set { self[messages: 6] = newValue } }
+    func append(largeDataList value: TSP_DataReference) { append(value, toMessages: 6) }
 }
 
 /// Generated wire model for `TSK.OutgoingCommandQueueItemUUIDToDataMapEntry`.
 final class TSK_OutgoingCommandQueueItemUUIDToDataMapEntry: IWAMessage {
-    var uuid: TSP_UUID?
-    var data: TSP_DataReference?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSK.OutgoingCommandQueueItemUUIDToDataMapEntry", [
+        .optional(1, TSP_UUID.self), .optional(2, TSP_DataReference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { uuid = _v }
-        case 2:
-            var _v: TSP_DataReference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_DataReference(ProtobufMessage(_b)) }
-            if let _v { data = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = uuid { _w.bytesField(1, _x.encoded()) }
-        if let _x = data { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var uuid: TSP_UUID? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var data: TSP_DataReference? { get { self[message: 1] } set { self[message: 1] = newValue } }
 }
 
 /// Generated wire model for `TSK.NativeContentDescription`.
 final class TSK_NativeContentDescription: IWAMessage {
-    var appName: String?
-    var appVersion: String?
-    var documentId: String?
-    var drawableDescriptions: [TSP_Reference] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSK.NativeContentDescription", [
+        .optional(1, .string), .optional(2, .string), .optional(3, .string), .repeated(4, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { appName = _v }
-        case 2:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { appVersion = _v }
-        case 3:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { documentId = _v }
-        case 4:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { drawableDescriptions.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = appName { _w.stringField(1, _x) }
-        if let _x = appVersion { _w.stringField(2, _x) }
-        if let _x = documentId { _w.stringField(3, _x) }
-        for _x in drawableDescriptions { _w.bytesField(4, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var appName: String? { get { self[0] } set { self[0] = newValue } }
+    var appVersion: String? { get { self[1] } set { self[1] = newValue } }
+    var documentId: String? { get { self[2] } set { self[2] = newValue } }
+    var drawableDescriptions: [TSP_Reference] { get { self[messages: 3] } set { self[messages: 3] = newValue } }
+    func append(drawableDescriptions value: TSP_Reference) { append(value, toMessages: 3) }
 }
 
 /// Generated wire model for `TSK.StructuredTextImportSettings`.
 final class TSK_StructuredTextImportSettings: IWAMessage {
-    var type: Int32?
-    var startingRow: Int32?
-    var decimalSeparators: [String] = []
-    var thousandsSeparators: [String] = []
-    var transposeRowsAndColumns: Bool?
-    var delimiters: [String] = []
-    var textQualifiers: [String] = []
-    var collapseConsecutive: Bool?
-    var columnOffsets: TSP_IndexSet?
-    var automaticDelimiters: Bool?
-    var automaticOffsets: Bool?
-    var sourceEncoding: UInt64?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { type = _v }
-        case 2:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { startingRow = _v }
-        case 3:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { decimalSeparators.append(_v) }
-        case 4:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { thousandsSeparators.append(_v) }
-        case 5:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { transposeRowsAndColumns = _v }
-        case 6:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { delimiters.append(_v) }
-        case 7:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { textQualifiers.append(_v) }
-        case 8:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { collapseConsecutive = _v }
-        case 9:
-            var _v: TSP_IndexSet?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_IndexSet(ProtobufMessage(_b)) }
-            if let _v { columnOffsets = _v }
-        case 10:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { automaticDelimiters = _v }
-        case 11:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { automaticOffsets = _v }
-        case 12:
-            var _v: UInt64?
-            if case .varint(let _u) = _f.value { _v = UInt64(truncatingIfNeeded: _u) }
-            if let _v { sourceEncoding = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = type { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = startingRow { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        for _x in decimalSeparators { _w.stringField(3, _x) }
-        for _x in thousandsSeparators { _w.stringField(4, _x) }
-        if let _x = transposeRowsAndColumns { _w.varintField(5, _x ? 1 : 0) }
-        for _x in delimiters { _w.stringField(6, _x) }
-        for _x in textQualifiers { _w.stringField(7, _x) }
-        if let _x = collapseConsecutive { _w.varintField(8, _x ? 1 : 0) }
-        if let _x = columnOffsets { _w.bytesField(9, _x.encoded()) }
-        if let _x = automaticDelimiters { _w.varintField(10, _x ? 1 : 0) }
-        if let _x = automaticOffsets { _w.varintField(11, _x ? 1 : 0) }
-        if let _x = sourceEncoding { _w.varintField(12, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSK.StructuredTextImportSettings", [
+        .optional(1, .int32), .optional(2, .int32), .repeated(3, .string), .repeated(4, .string), .optional(5, .bool),
+        .repeated(6, .string), .repeated(7, .string), .optional(8, .bool), .optional(9, TSP_IndexSet.self),
+        .optional(10, .bool), .optional(11, .bool), .optional(12, .uint64),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 12)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var type: Int32? { get { self[0] } set { self[0] = newValue } }
+    var startingRow: Int32? { get { self[1] } set { self[1] = newValue } }
+    var decimalSeparators: [String] { get { self[all: 2] } set { self[all: 2] = newValue } }
+    func append(decimalSeparators value: String) { append(value, toAll: 2) }
+    var thousandsSeparators: [String] { get { self[all: 3] } set { self[all: 3] = newValue } }
+    func append(thousandsSeparators value: String) { append(value, toAll: 3) }
+    var transposeRowsAndColumns: Bool? { get { self[4] } set { self[4] = newValue } }
+    var delimiters: [String] { get { self[all: 5] } set { self[all: 5] = newValue } }
+    func append(delimiters value: String) { append(value, toAll: 5) }
+    var textQualifiers: [String] { get { self[all: 6] } set { self[all: 6] = newValue } }
+    func append(textQualifiers value: String) { append(value, toAll: 6) }
+    var collapseConsecutive: Bool? { get { self[7] } set { self[7] = newValue } }
+    var columnOffsets: TSP_IndexSet? { get { self[message: 8] } set { self[message: 8] = newValue } }
+    var automaticDelimiters: Bool? { get { self[9] } set { self[9] = newValue } }
+    var automaticOffsets: Bool? { get { self[10] } set { self[10] = newValue } }
+    var sourceEncoding: UInt64? { get { self[11] } set { self[11] = newValue } }
 }
 
 /// Generated wire model for `TSK.OperationStorageCommandOperationsEntry`.
 final class TSK_OperationStorageCommandOperationsEntry: IWAMessage {
-    var commandIdentifierSameAsRevisionIdentifier: Bool?
-    var commandIdentifier: [UInt64] = []
-    var operations: [TSK_Operation] = []
-    var serverOriginated: Bool?
-    var coalescedCommandEntryCount: UInt64?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSK.OperationStorageCommandOperationsEntry", [
+        .optional(1, .bool), .repeated(2, .fixed64), .repeated(3, TSK_Operation.self), .optional(4, .bool),
+        .optional(5, .uint64),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 5)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { commandIdentifierSameAsRevisionIdentifier = _v }
-        case 2:
-            var _v: UInt64?
-            if case .fixed64(let _b) = _f.value { _v = IWAWire.u64(_b) }
-            if let _v { commandIdentifier.append(_v) }
-        case 3:
-            var _v: TSK_Operation?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_Operation(ProtobufMessage(_b)) }
-            if let _v { operations.append(_v) }
-        case 4:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { serverOriginated = _v }
-        case 5:
-            var _v: UInt64?
-            if case .varint(let _u) = _f.value { _v = UInt64(truncatingIfNeeded: _u) }
-            if let _v { coalescedCommandEntryCount = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = commandIdentifierSameAsRevisionIdentifier { _w.varintField(1, _x ? 1 : 0) }
-        for _x in commandIdentifier { _w.fixed64Field(2, _x) }
-        for _x in operations { _w.bytesField(3, _x.encoded()) }
-        if let _x = serverOriginated { _w.varintField(4, _x ? 1 : 0) }
-        if let _x = coalescedCommandEntryCount { _w.varintField(5, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var commandIdentifierSameAsRevisionIdentifier: Bool? { get { self[0] } set { self[0] = newValue } }
+    var commandIdentifier: [UInt64] { get { self[all: 1] } set { self[all: 1] = newValue } }
+    func append(commandIdentifier value: UInt64) { append(value, toAll: 1) }
+    var operations: [TSK_Operation] { get { self[messages: 2] } set { self[messages: 2] = newValue } }
+    func append(operations value: TSK_Operation) { append(value, toMessages: 2) }
+    var serverOriginated: Bool? { get { self[3] } set { self[3] = newValue } }
+    var coalescedCommandEntryCount: UInt64? { get { self[4] } set { self[4] = newValue } }
 }
 
 /// Generated wire model for `TSK.OperationStorageEntry`.
 final class TSK_OperationStorageEntry: IWAMessage {
-    var documentRevisionIdentifier: [UInt64] = []
-    var documentRevisionSequenceDelta: Int32?
-    var commandOperationEntries: [TSK_OperationStorageCommandOperationsEntry] = []
-    var firstEntryCreationTime: Double?
-    var creationTimeDiffBucket: Int32?
-    var fileFormatVersion: [UInt32] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSK.OperationStorageEntry", [
+        .repeated(1, .fixed64), .optional(2, .int32), .repeated(3, TSK_OperationStorageCommandOperationsEntry.self),
+        .optional(4, .double), .optional(5, .int32), .repeated(6, .uint32, packed: true),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 6)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt64?
-            if case .fixed64(let _b) = _f.value { _v = IWAWire.u64(_b) }
-            if let _v { documentRevisionIdentifier.append(_v) }
-        case 2:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { documentRevisionSequenceDelta = _v }
-        case 3:
-            var _v: TSK_OperationStorageCommandOperationsEntry?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_OperationStorageCommandOperationsEntry(ProtobufMessage(_b)) }
-            if let _v { commandOperationEntries.append(_v) }
-        case 4:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { firstEntryCreationTime = _v }
-        case 5:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { creationTimeDiffBucket = _v }
-        case 6:
-            if case .varint(let _u) = _f.value { fileFormatVersion.append(UInt32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { fileFormatVersion.append(UInt32(truncatingIfNeeded: _u)) } }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in documentRevisionIdentifier { _w.fixed64Field(1, _x) }
-        if let _x = documentRevisionSequenceDelta { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        for _x in commandOperationEntries { _w.bytesField(3, _x.encoded()) }
-        if let _x = firstEntryCreationTime { _w.fixed64Field(4, _x.bitPattern) }
-        if let _x = creationTimeDiffBucket { _w.varintField(5, UInt64(truncatingIfNeeded: _x)) }
-        if !fileFormatVersion.isEmpty { _w.packedVarintField(6, fileFormatVersion.map { UInt64(truncatingIfNeeded: $0) }) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var documentRevisionIdentifier: [UInt64] { get { self[all: 0] } set { self[all: 0] = newValue } }
+    func append(documentRevisionIdentifier value: UInt64) { append(value, toAll: 0) }
+    var documentRevisionSequenceDelta: Int32? { get { self[1] } set { self[1] = newValue } }
+    var commandOperationEntries: [TSK_OperationStorageCommandOperationsEntry] { get { self[messages: 2] } set { self[messages: 2] = newValue } }
+    func append(commandOperationEntries value: TSK_OperationStorageCommandOperationsEntry) { append(value, toMessages: 2) }
+    var firstEntryCreationTime: Double? { get { self[3] } set { self[3] = newValue } }
+    var creationTimeDiffBucket: Int32? { get { self[4] } set { self[4] = newValue } }
+    var fileFormatVersion: [UInt32] { get { self[all: 5] } set { self[all: 5] = newValue } }
+    func append(fileFormatVersion value: UInt32) { append(value, toAll: 5) }
 }
 
 /// Generated wire model for `TSK.DataReferenceRecord`.
 final class TSK_DataReferenceRecord: IWAMessage {
-    var addedContainerUuidToReferencedDataPairs: [TSK_DataReferenceRecord_ContainerUUIDToReferencedDataPair] = []
-    var removedContainerUuidToReferencedDataPairs: [TSK_DataReferenceRecord_ContainerUUIDToReferencedDataPair] = []
-    var unboundedReferencedDatas: [TSP_DataReference] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSK.DataReferenceRecord", [
+        .repeated(1, TSK_DataReferenceRecord_ContainerUUIDToReferencedDataPair.self),
+        .repeated(2, TSK_DataReferenceRecord_ContainerUUIDToReferencedDataPair.self),
+        .repeated(3, TSP_DataReference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSK_DataReferenceRecord_ContainerUUIDToReferencedDataPair?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_DataReferenceRecord_ContainerUUIDToReferencedDataPair(ProtobufMessage(_b)) }
-            if let _v { addedContainerUuidToReferencedDataPairs.append(_v) }
-        case 2:
-            var _v: TSK_DataReferenceRecord_ContainerUUIDToReferencedDataPair?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_DataReferenceRecord_ContainerUUIDToReferencedDataPair(ProtobufMessage(_b)) }
-            if let _v { removedContainerUuidToReferencedDataPairs.append(_v) }
-        case 3:
-            var _v: TSP_DataReference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_DataReference(ProtobufMessage(_b)) }
-            if let _v { unboundedReferencedDatas.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in addedContainerUuidToReferencedDataPairs { _w.bytesField(1, _x.encoded()) }
-        for _x in removedContainerUuidToReferencedDataPairs { _w.bytesField(2, _x.encoded()) }
-        for _x in unboundedReferencedDatas { _w.bytesField(3, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var addedContainerUuidToReferencedDataPairs: [TSK_DataReferenceRecord_ContainerUUIDToReferencedDataPair] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(addedContainerUuidToReferencedDataPairs value: TSK_DataReferenceRecord_ContainerUUIDToReferencedDataPair) { append(value, toMessages: 0) }
+    var removedContainerUuidToReferencedDataPairs: [TSK_DataReferenceRecord_ContainerUUIDToReferencedDataPair] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(removedContainerUuidToReferencedDataPairs value: TSK_DataReferenceRecord_ContainerUUIDToReferencedDataPair) { append(value, toMessages: 1) }
+    var unboundedReferencedDatas: [TSP_DataReference] { get { self[messages: 2] } set { self[messages: 2] = newValue } }
+    func append(unboundedReferencedDatas value: TSP_DataReference) { append(value, toMessages: 2) }
 }
 
 /// Generated wire model for `TSK.DataReferenceRecord.ContainerUUIDToReferencedDataPair`.
 final class TSK_DataReferenceRecord_ContainerUUIDToReferencedDataPair: IWAMessage {
-    var containerUuid: TSP_UUID?
-    var referencedData: TSP_DataReference?
-    var referenceCount: UInt32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSK.DataReferenceRecord.ContainerUUIDToReferencedDataPair", [
+        .optional(1, TSP_UUID.self), .optional(2, TSP_DataReference.self), .optional(3, .uint32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { containerUuid = _v }
-        case 2:
-            var _v: TSP_DataReference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_DataReference(ProtobufMessage(_b)) }
-            if let _v { referencedData = _v }
-        case 3:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { referenceCount = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = containerUuid { _w.bytesField(1, _x.encoded()) }
-        if let _x = referencedData { _w.bytesField(2, _x.encoded()) }
-        if let _x = referenceCount { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var containerUuid: TSP_UUID? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var referencedData: TSP_DataReference? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var referenceCount: UInt32? { get { self[2] } set { self[2] = newValue } }
 }
 
 /// Generated wire model for `TSK.PencilAnnotationUIState`.
 final class TSK_PencilAnnotationUIState: IWAMessage {
-    var currentToolType: Int32?
-    var penToolColor: TSP_Color?
-    var penToolOpacity: Float?
-    var penToolWidth: Float?
-    var highlighterToolColor: TSP_Color?
-    var highlighterToolOpacity: Float?
-    var highlighterToolWidth: Float?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSK.PencilAnnotationUIState", [
+        .optional(1, .int32), .optional(2, TSP_Color.self), .optional(3, .float), .optional(4, .float),
+        .optional(5, TSP_Color.self), .optional(6, .float), .optional(7, .float),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 7)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { currentToolType = _v }
-        case 2:
-            var _v: TSP_Color?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Color(ProtobufMessage(_b)) }
-            if let _v { penToolColor = _v }
-        case 3:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { penToolOpacity = _v }
-        case 4:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { penToolWidth = _v }
-        case 5:
-            var _v: TSP_Color?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Color(ProtobufMessage(_b)) }
-            if let _v { highlighterToolColor = _v }
-        case 6:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { highlighterToolOpacity = _v }
-        case 7:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { highlighterToolWidth = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = currentToolType { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = penToolColor { _w.bytesField(2, _x.encoded()) }
-        if let _x = penToolOpacity { _w.fixed32Field(3, _x.bitPattern) }
-        if let _x = penToolWidth { _w.fixed32Field(4, _x.bitPattern) }
-        if let _x = highlighterToolColor { _w.bytesField(5, _x.encoded()) }
-        if let _x = highlighterToolOpacity { _w.fixed32Field(6, _x.bitPattern) }
-        if let _x = highlighterToolWidth { _w.fixed32Field(7, _x.bitPattern) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var currentToolType: Int32? { get { self[0] } set { self[0] = newValue } }
+    var penToolColor: TSP_Color? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var penToolOpacity: Float? { get { self[2] } set { self[2] = newValue } }
+    var penToolWidth: Float? { get { self[3] } set { self[3] = newValue } }
+    var highlighterToolColor: TSP_Color? { get { self[message: 4] } set { self[message: 4] = newValue } }
+    var highlighterToolOpacity: Float? { get { self[5] } set { self[5] = newValue } }
+    var highlighterToolWidth: Float? { get { self[6] } set { self[6] = newValue } }
 }
 
 /// Registers this file's archives into the reflective catalog.
-func registerIWA_TSKArchives(_ into: inout [(name: String, decode: (ProtobufMessage) -> IWAMessage)]) {
-    into.append(("TSK.TreeNode", { TSK_TreeNode($0) as IWAMessage }))
-    into.append(("TSK.LocalCommandHistoryItem", { TSK_LocalCommandHistoryItem($0) as IWAMessage }))
-    into.append(("TSK.LocalCommandHistoryArray", { TSK_LocalCommandHistoryArray($0) as IWAMessage }))
-    into.append(("TSK.LocalCommandHistoryArraySegment", { TSK_LocalCommandHistoryArraySegment($0) as IWAMessage }))
-    into.append(("TSK.LocalCommandHistory", { TSK_LocalCommandHistory($0) as IWAMessage }))
-    into.append(("TSK.DocumentArchive", { TSK_DocumentArchive($0) as IWAMessage }))
-    into.append(("TSK.FormattingSymbolsArchive", { TSK_FormattingSymbolsArchive($0) as IWAMessage }))
-    into.append(("TSK.FormattingSymbolsArchive.CurrencySymbol", { TSK_FormattingSymbolsArchive_CurrencySymbol($0) as IWAMessage }))
-    into.append(("TSK.DocumentSupportArchive", { TSK_DocumentSupportArchive($0) as IWAMessage }))
-    into.append(("TSK.ViewStateArchive", { TSK_ViewStateArchive($0) as IWAMessage }))
-    into.append(("TSK.CommandArchive", { TSK_CommandArchive($0) as IWAMessage }))
-    into.append(("TSK.CommandGroupArchive", { TSK_CommandGroupArchive($0) as IWAMessage }))
-    into.append(("TSK.InducedCommandCollectionArchive", { TSK_InducedCommandCollectionArchive($0) as IWAMessage }))
-    into.append(("TSK.PropagatedCommandCollectionArchive", { TSK_PropagatedCommandCollectionArchive($0) as IWAMessage }))
-    into.append(("TSK.FinalCommandPairArchive", { TSK_FinalCommandPairArchive($0) as IWAMessage }))
-    into.append(("TSK.CommandContainerArchive", { TSK_CommandContainerArchive($0) as IWAMessage }))
-    into.append(("TSK.ProgressiveCommandGroupArchive", { TSK_ProgressiveCommandGroupArchive($0) as IWAMessage }))
-    into.append(("TSK.FormatStructArchive", { TSK_FormatStructArchive($0) as IWAMessage }))
-    into.append(("TSK.CustomFormatArchive", { TSK_CustomFormatArchive($0) as IWAMessage }))
-    into.append(("TSK.CustomFormatArchive.Condition", { TSK_CustomFormatArchive_Condition($0) as IWAMessage }))
-    into.append(("TSK.CustomFormatListArchive", { TSK_CustomFormatListArchive($0) as IWAMessage }))
-    into.append(("TSK.AnnotationAuthorArchive", { TSK_AnnotationAuthorArchive($0) as IWAMessage }))
-    into.append(("TSK.DeprecatedChangeAuthorArchive", { TSK_DeprecatedChangeAuthorArchive($0) as IWAMessage }))
-    into.append(("TSK.AnnotationAuthorStorageArchive", { TSK_AnnotationAuthorStorageArchive($0) as IWAMessage }))
-    into.append(("TSK.CommandBehaviorSelectionPathStorageArchive", { TSK_CommandBehaviorSelectionPathStorageArchive($0) as IWAMessage }))
-    into.append(("TSK.CommandBehaviorArchive", { TSK_CommandBehaviorArchive($0) as IWAMessage }))
-    into.append(("TSK.CommandSelectionBehaviorArchive", { TSK_CommandSelectionBehaviorArchive($0) as IWAMessage }))
-    into.append(("TSK.SelectionPathTransformerArchive", { TSK_SelectionPathTransformerArchive($0) as IWAMessage }))
-    into.append(("TSK.SelectionPathArchive", { TSK_SelectionPathArchive($0) as IWAMessage }))
-    into.append(("TSK.DocumentSelectionArchive", { TSK_DocumentSelectionArchive($0) as IWAMessage }))
-    into.append(("TSK.NullCommandArchive", { TSK_NullCommandArchive($0) as IWAMessage }))
-    into.append(("TSK.GroupCommitCommandArchive", { TSK_GroupCommitCommandArchive($0) as IWAMessage }))
-    into.append(("TSK.UpgradeDocPostProcessingCommandArchive", { TSK_UpgradeDocPostProcessingCommandArchive($0) as IWAMessage }))
-    into.append(("TSK.InducedCommandCollectionCommitCommandArchive", { TSK_InducedCommandCollectionCommitCommandArchive($0) as IWAMessage }))
-    into.append(("TSK.ChangeDocumentPackageTypeCommandArchive", { TSK_ChangeDocumentPackageTypeCommandArchive($0) as IWAMessage }))
-    into.append(("TSK.RangeAddress", { TSK_RangeAddress($0) as IWAMessage }))
-    into.append(("TSK.Operation", { TSK_Operation($0) as IWAMessage }))
-    into.append(("TSK.OperationTransformer", { TSK_OperationTransformer($0) as IWAMessage }))
-    into.append(("TSK.OutgoingCommandQueueItem", { TSK_OutgoingCommandQueueItem($0) as IWAMessage }))
-    into.append(("TSK.OutgoingCommandQueueItemUUIDToDataMapEntry", { TSK_OutgoingCommandQueueItemUUIDToDataMapEntry($0) as IWAMessage }))
-    into.append(("TSK.NativeContentDescription", { TSK_NativeContentDescription($0) as IWAMessage }))
-    into.append(("TSK.StructuredTextImportSettings", { TSK_StructuredTextImportSettings($0) as IWAMessage }))
-    into.append(("TSK.OperationStorageCommandOperationsEntry", { TSK_OperationStorageCommandOperationsEntry($0) as IWAMessage }))
-    into.append(("TSK.OperationStorageEntry", { TSK_OperationStorageEntry($0) as IWAMessage }))
-    into.append(("TSK.DataReferenceRecord", { TSK_DataReferenceRecord($0) as IWAMessage }))
-    into.append(("TSK.DataReferenceRecord.ContainerUUIDToReferencedDataPair", { TSK_DataReferenceRecord_ContainerUUIDToReferencedDataPair($0) as IWAMessage }))
-    into.append(("TSK.PencilAnnotationUIState", { TSK_PencilAnnotationUIState($0) as IWAMessage }))
+func registerIWA_TSKArchives(_ into: inout [any IWAMessage.Type]) {
+    into += [
+        TSK_TreeNode.self, TSK_LocalCommandHistoryItem.self, TSK_LocalCommandHistoryArray.self,
+        TSK_LocalCommandHistoryArraySegment.self, TSK_LocalCommandHistory.self, TSK_DocumentArchive.self,
+        TSK_FormattingSymbolsArchive.self, TSK_FormattingSymbolsArchive_CurrencySymbol.self,
+        TSK_DocumentSupportArchive.self, TSK_ViewStateArchive.self, TSK_CommandArchive.self,
+        TSK_CommandGroupArchive.self, TSK_InducedCommandCollectionArchive.self,
+        TSK_PropagatedCommandCollectionArchive.self, TSK_FinalCommandPairArchive.self, TSK_CommandContainerArchive.self,
+        TSK_ProgressiveCommandGroupArchive.self, TSK_FormatStructArchive.self, TSK_CustomFormatArchive.self,
+        TSK_CustomFormatArchive_Condition.self, TSK_CustomFormatListArchive.self, TSK_AnnotationAuthorArchive.self,
+        TSK_DeprecatedChangeAuthorArchive.self, TSK_AnnotationAuthorStorageArchive.self,
+        TSK_CommandBehaviorSelectionPathStorageArchive.self, TSK_CommandBehaviorArchive.self,
+        TSK_CommandSelectionBehaviorArchive.self, TSK_SelectionPathTransformerArchive.self,
+        TSK_SelectionPathArchive.self, TSK_DocumentSelectionArchive.self, TSK_NullCommandArchive.self,
+        TSK_GroupCommitCommandArchive.self, TSK_UpgradeDocPostProcessingCommandArchive.self,
+        TSK_InducedCommandCollectionCommitCommandArchive.self, TSK_ChangeDocumentPackageTypeCommandArchive.self,
+        TSK_RangeAddress.self, TSK_Operation.self, TSK_OperationTransformer.self, TSK_OutgoingCommandQueueItem.self,
+        TSK_OutgoingCommandQueueItemUUIDToDataMapEntry.self, TSK_NativeContentDescription.self,
+        TSK_StructuredTextImportSettings.self, TSK_OperationStorageCommandOperationsEntry.self,
+        TSK_OperationStorageEntry.self, TSK_DataReferenceRecord.self,
+        TSK_DataReferenceRecord_ContainerUUIDToReferencedDataPair.self, TSK_PencilAnnotationUIState.self,
+    ]
 }
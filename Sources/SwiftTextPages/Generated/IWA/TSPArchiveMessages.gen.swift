@@ -5,1382 +5,531 @@ import SwiftTextIWA
 
 /// Generated wire model for `TSP.ArchiveInfo`.
 final class TSP_ArchiveInfo: IWAMessage {
-    var identifier: UInt64?
-    var messageInfos: [TSP_MessageInfo] = []
-    var shouldMerge: Bool?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSP.ArchiveInfo", [
+        .optional(1, .uint64), .repeated(2, TSP_MessageInfo.self), .optional(3, .bool),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt64?
-            if case .varint(let _u) = _f.value { _v = UInt64(truncatingIfNeeded: _u) }
-            if let _v { identifier = _v }
-        case 2:
-            var _v: TSP_MessageInfo?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_MessageInfo(ProtobufMessage(_b)) }
-            if let _v { messageInfos.append(_v) }
-        case 3:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { shouldMerge = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = identifier { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        for _x in messageInfos { _w.bytesField(2, _x.encoded()) }
-        if let _x = shouldMerge { _w.varintField(3, _x ? 1 : 0) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var identifier: UInt64? { get { self[0] } set { self[0] = newValue } }
+    var messageInfos: [TSP_MessageInfo] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(messageInfos value: TSP_MessageInfo) { append(value, toMessages: 1) }
+    var shouldMerge: Bool? { get { self[2] } set { self[2] = newValue } }
 }
 
 /// Generated wire model for `TSP.MessageInfo`.
 final class TSP_MessageInfo: IWAMessage {
-    var type: UInt32?
-    var version: [UInt32] = []
-    var length: UInt32?
-    var fieldInfos: [TSP_FieldInfo] = []
-    var objectReferences: [UInt64] = []
-    var dataReferences: [UInt64] = []
-    var baseMessageIndex: UInt32?
-    var diffMergeVersion: [UInt32] = []
-    var diffFieldPath: TSP_FieldPath?
-    var fieldsToRemove: [TSP_FieldPath] = []
-    var diffReadVersion: [UInt32] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSP.MessageInfo", [
+        .optional(1, .uint32), .repeated(2, .uint32, packed: true), .optional(3, .uint32),
+        .repeated(4, TSP_FieldInfo.self), .repeated(5, .uint64, packed: true), .repeated(6, .uint64, packed: true),
+        .optional(7, .uint32), .repeated(8, .uint32, packed: true), .optional(9, TSP_FieldPath.self),
+        .repeated(10, TSP_FieldPath.self), .repeated(11, .uint32, packed: true),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 11)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { type = _v }
-        case 2:
-            if case .varint(let _u) = _f.value { version.append(UInt32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { version.append(UInt32(truncatingIfNeeded: _u)) } }
-        case 3:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { length = _v }
-        case 4:
-            var _v: TSP_FieldInfo?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_FieldInfo(ProtobufMessage(_b)) }
-            if let _v { fieldInfos.append(_v) }
-        case 5:
-            if case .varint(let _u) = _f.value { objectReferences.append(UInt64(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { objectReferences.append(UInt64(truncatingIfNeeded: _u)) } }
-        case 6:
-            if case .varint(let _u) = _f.value { dataReferences.append(UInt64(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { dataReferences.append(UInt64(truncatingIfNeeded: _u)) } }
-        case 7:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { baseMessageIndex = _v }
-        case 8:
-            if case .varint(let _u) = _f.value { diffMergeVersion.append(UInt32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { diffMergeVersion.append(UInt32(truncatingIfNeeded: _u)) } }
-        case 9:
-            var _v: TSP_FieldPath?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_FieldPath(ProtobufMessage(_b)) }
-            if let _v { diffFieldPath = _v }
-        case 10:
-            var _v: TSP_FieldPath?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_FieldPath(ProtobufMessage(_b)) }
-            if let _v { fieldsToRemove.append(_v) }
-        case 11:
-            if case .varint(let _u) = _f.value { diffReadVersion.append(UInt32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { diffReadVersion.append(UInt32(truncatingIfNeeded: _u)) } }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = type { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if !version.isEmpty { _w.packedVarintField(2, version.map { UInt64(truncatingIfNeeded: $0) }) }
-        if let _x = length { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        for _x in fieldInfos { _w.bytesField(4, _x.encoded()) }
-        if !objectReferences.isEmpty { _w.packedVarintField(5, objectReferences.map { UInt64(truncatingIfNeeded: $0) }) }
-        if !dataReferences.isEmpty { _w.packedVarintField(6, dataReferences.map { UInt64(truncatingIfNeeded: $0) }) }
-        if let _x = baseMessageIndex { _w.varintField(7, UInt64(truncatingIfNeeded: _x)) }
-        if !diffMergeVersion.isEmpty { _w.packedVarintField(8, diffMergeVersion.map { UInt64(truncatingIfNeeded: $0) }) }
-        if let _x = diffFieldPath { _w.bytesField(9, _x.encoded()) }
-        for _x in fieldsToRemove { _w.bytesField(10, _x.encoded()) }
-        if !diffReadVersion.isEmpty { _w.packedVarintField(11, diffReadVersion.map { UInt64(truncatingIfNeeded: $0) }) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var type: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var version: [UInt32] { get { self[all: 1] } set { self[all: 1] = newValue } }
+    func append(version value: UInt32) { append(value, toAll: 1) }
+    var length: UInt32? { get { self[2] } set { self[2] = newValue } }
+    var fieldInfos: [TSP_FieldInfo] { get { self[messages: 3] } set { self[messages: 3] = newValue } }
+    func append(fieldInfos value: TSP_FieldInfo) { append(value, toMessages: 3) }
+    var objectReferences: [UInt64] { get { self[all: 4] } set { self[all: 4] = newValue } }
+    func append(objectReferences value: UInt64) { append(value, toAll: 4) }
+    var dataReferences: [UInt64] { get { self[all: 5] } set { self[all: 5] = newValue } }
+    func append(dataReferences value: UInt64) { append(value, toAll: 5) }
+    var baseMessageIndex: UInt32? { get { self[6] } set { self[6] = newValue } }
+    var diffMergeVersion: [UInt32] { get { self[all: 7] } set { self[all: 7] = newValue } }
+    func append(diffMergeVersion value: UInt32) { append(value, toAll: 7) }
+    var diffFieldPath: TSP_FieldPath? { get { self[message: 8] } set { self[message: 8] = newValue } }
+    var fieldsToRemove: [TSP_FieldPath] { get { self[messages: 9] } set { self[messages: 9] = newValue } }
+    func append(fieldsToRemove value: TSP_FieldPath) { append(value, toMessages: 9) }
+    var diffReadVersion: [UInt32] { get { self[all: 10] } set { self[all: 10] = newValue } }
+    func append(diffReadVersion value: UInt32) { append(value, toAll: 10) }
 }
 
 /// Generated wire model for `TSP.FieldInfo`.
 final class TSP_FieldInfo: IWAMessage {
-    var path: TSP_FieldPath?
-    var type: Int32?
-    var unknownFieldRule: Int32?
-    var objectReferences: [UInt64] = []
-    var dataReferences: [UInt64] = []
-    var knownFieldRule: Int32?
-    var knownFieldVersion: [UInt32] = []
-    var knownFieldFeatureIdentifier: String?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSP.FieldInfo", [
+        .optional(1, TSP_FieldPath.self), .optional(2, .int32), .optional(3, .int32),
+        .repeated(4, .uint64, packed: true), .repeated(5, .uint64, packed: true), .optional(6, .int32),
+        .repeated(7, .uint32, packed: true), .optional(8, .string),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 8)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_FieldPath?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_FieldPath(ProtobufMessage(_b)) }
-            if let _v { path = _v }
-        case 2:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { type = _v }
-        case 3:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { unknownFieldRule = _v }
-        case 4:
-            if case .varint(let _u) = _f.value { objectReferences.append(UInt64(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { objectReferences.append(UInt64(truncatingIfNeeded: _u)) } }
-        case 5:
-            if case .varint(let _u) = _f.value { dataReferences.append(UInt64(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { dataReferences.append(UInt64(truncatingIfNeeded: _u)) } }
-        case 6:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { knownFieldRule = _v }
-        case 7:
-            if case .varint(let _u) = _f.value { knownFieldVersion.append(UInt32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { knownFieldVersion.append(UInt32(truncatingIfNeeded: _u)) } }
-        case 8:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { knownFieldFeatureIdentifier = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = path { _w.bytesField(1, _x.encoded()) }
-        if let _x = type { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = unknownFieldRule { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        if !objectReferences.isEmpty { _w.packedVarintField(4, objectReferences.map { UInt64(truncatingIfNeeded: $0) }) }
-        if !dataReferences.isEmpty { _w.packedVarintField(5, dataReferences.map { UInt64(truncatingIfNeeded: $0) }) }
-        if let _x = knownFieldRule { _w.varintField(6, UInt64(truncatingIfNeeded: _x)) }
-        if !knownFieldVersion.isEmpty { _w.packedVarintField(7, knownFieldVersion.map { UInt64(truncatingIfNeeded: $0) }) }
-        if let _x = knownFieldFeatureIdentifier { _w.stringField(8, _x) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var path: TSP_FieldPath? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var type: Int32? { get { self[1] } set { self[1] = newValue } }
+    var unknownFieldRule: Int32? { get { self[2] } set { self[2] = newValue } }
+    var objectReferences: [UInt64] { get { self[all: 3] } set { self[all: 3] = newValue } }
+    func append(objectReferences value: UInt64) { append(value, toAll: 3) }
+    var dataReferences: [UInt64] { get { self[all: 4] } set { self[all: 4] = newValue } }
+    func append(dataReferences value: UInt64) { append(value, toAll: 4) }
+    var knownFieldRule: Int32? { get { self[5] } set { self[5] = newValue } }
+    var knownFieldVersion: [UInt32] { get { self[all: 6] } set { self[all: 6] = newValue } }
+    func append(knownFieldVersion value: UInt32) { append(value, toAll: 6) }
+    var knownFieldFeatureIdentifier: String? { get { self[7] } set { self[7] = newValue } }
 }
 
 /// Generated wire model for `TSP.FieldPath`.
 final class TSP_FieldPath: IWAMessage {
-    var path: [UInt32] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSP.FieldPath", [
+        .repeated(1, .uint32, packed: true),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            if case .varint(let _u) = _f.value { path.append(UInt32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { path.append(UInt32(truncatingIfNeeded: _u)) } }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if !path.isEmpty { _w.packedVarintField(1, path.map { UInt64(truncatingIfNeeded: $0) }) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var path: [UInt32] { get { self[all: 0] } set { self[all: 0] = newValue } }
+    func append(path value: UInt32) { append(value, toAll: 0) }
 }
 
 /// Generated wire model for `TSP.ComponentInfo`.
 final class TSP_ComponentInfo: IWAMessage {
-    var identifier: UInt64?
-    var preferredLocator: String?
-    var locator: String?
-    var documentReadVersion: [UInt32] = []
-    var documentWriteVersion: [UInt32] = []
-    var externalReferences: [TSP_ComponentExternalReference] = []
-    var dataReferences: [TSP_ComponentDataReference] = []
-    var isStoredOutsideObjectArchive: Bool?
-    var objectUuidMapEntries: [TSP_ObjectUUIDMapEntry] = []
-    var saveToken: UInt64?
-    var featureInfos: [TSP_FeatureInfo] = []
-    var componentReadVersion: [UInt32] = []
-    var componentRequiredVersion: [UInt32] = []
-    var compressionAlgorithm: UInt32?
-    var canBeDropped: Bool?
-    var versionedExternalReferences: [TSP_ComponentExternalReference] = []
-    var isWasteful: Bool?
-    var ambiguousObjectIdentifiers: [UInt64] = []
-    var requiredPackageIdentifier: UInt32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSP.ComponentInfo", [
+        .optional(1, .uint64), .optional(2, .string), .optional(3, .string), .repeated(4, .uint32, packed: true),
+        .repeated(5, .uint32, packed: true), .repeated(6, TSP_ComponentExternalReference.self),
+        .repeated(7, TSP_ComponentDataReference.self), .optional(10, .bool), .repeated(11, TSP_ObjectUUIDMapEntry.self),
+        .optional(12, .uint64), .repeated(13, TSP_FeatureInfo.self), .repeated(14, .uint32, packed: true),
+        .repeated(15, .uint32, packed: true), .optional(16, .uint32), .optional(17, .bool),
+        .repeated(18, TSP_ComponentExternalReference.self), .optional(19, .bool), .repeated(20, .uint64, packed: true),
+        .optional(21, .uint32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 19)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt64?
-            if case .varint(let _u) = _f.value { _v = UInt64(truncatingIfNeeded: _u) }
-            if let _v { identifier = _v }
-        case 2:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { preferredLocator = _v }
-        case 3:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { locator = _v }
-        case 4:
-            if case .varint(let _u) = _f.value { documentReadVersion.append(UInt32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { documentReadVersion.append(UInt32(truncatingIfNeeded: _u)) } }
-        case 5:
-            if case .varint(let _u) = _f.value { documentWriteVersion.append(UInt32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { documentWriteVersion.append(UInt32(truncatingIfNeeded: _u)) } }
-        case 6:
-            var _v: TSP_ComponentExternalReference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_ComponentExternalReference(ProtobufMessage(_b)) }
-            if let _v { externalReferences.append(_v) }
-        case 7:
-            var _v: TSP_ComponentDataReference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_ComponentDataReference(ProtobufMessage(_b)) }
-            if let _v { dataReferences.append(_v) }
-        case 10:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { isStoredOutsideObjectArchive = _v }
-        case 11:
-            var _v: TSP_ObjectUUIDMapEntry?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_ObjectUUIDMapEntry(ProtobufMessage(_b)) }
-            if let _v { objectUuidMapEntries.append(_v) }
-        case 12:
-            var _v: UInt64?
-            if case .varint(let _u) = _f.value { _v = UInt64(truncatingIfNeeded: _u) }
-            if let _v { saveToken = _v }
-        case 13:
-            var _v: TSP_FeatureInfo?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_FeatureInfo(ProtobufMessage(_b)) }
-            if let _v { featureInfos.append(_v) }
-        case 14:
-            if case .varint(let _u) = _f.value { componentReadVersion.append(UInt32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { componentReadVersion.append(UInt32(truncatingIfNeeded: _u)) } }
-        case 15:
-            if case .varint(let _u) = _f.value { componentRequiredVersion.append(UInt32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { componentRequiredVersion.append(UInt32(truncatingIfNeeded: _u)) } }
-        case 16:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { compressionAlgorithm = _v }
-        case 17:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { canBeDropped = _v }
-        case 18:
-            var _v: TSP_ComponentExternalReference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_ComponentExternalReference(ProtobufMessage(_b)) }
-            if let _v { versionedExternalReferences.append(_v) }
-        case 19:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { isWasteful = _v }
-        case 20:
-            if case .varint(let _u) = _f.value { ambiguousObjectIdentifiers.append(UInt64(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { ambiguousObjectIdentifiers.append(UInt64(truncatingIfNeeded: _u)) } }
-        case 21:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { requiredPackageIdentifier = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = identifier { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = preferredLocator { _w.stringField(2, _x) }
-        if let _x = locator { _w.stringField(3, _x) }
-        if !documentReadVersion.isEmpty { _w.packedVarintField(4, documentReadVersion.map { UInt64(truncatingIfNeeded: $0) }) }
-        if !documentWriteVersion.isEmpty { _w.packedVarintField(5, documentWriteVersion.map { UInt64(truncatingIfNeeded: $0) }) }
-        for _x in externalReferences { _w.bytesField(6, _x.encoded()) }
-        for _x in dataReferences { _w.bytesField(7, _x.encoded()) }
-        if let _x = isStoredOutsideObjectArchive { _w.varintField(10, _x ? 1 : 0) }
-        for _x in objectUuidMapEntries { _w.bytesField(11, _x.encoded()) }
-        if let _x = saveToken { _w.varintField(12, UInt64(truncatingIfNeeded: _x)) }
-        for _x in featureInfos { _w.bytesField(13, _x.encoded()) }
-        if !componentReadVersion.isEmpty { _w.packedVarintField(14, componentReadVersion.map { UInt64(truncatingIfNeeded: $0) }) }
-        if !componentRequiredVersion.isEmpty { _w.packedVarintField(15, componentRequiredVersion.map { UInt64(truncatingIfNeeded: $0) }) }
-        if let _x = compressionAlgorithm { _w.varintField(16, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = canBeDropped { _w.varintField(17, _x ? 1 : 0) }
-        for _x in versionedExternalReferences { _w.bytesField(18, _x.encoded()) }
-        if let _x = isWasteful { _w.varintField(19, _x ? 1 : 0) }
-        if !ambiguousObjectIdentifiers.isEmpty { _w.packedVarintField(20, ambiguousObjectIdentifiers.map { UInt64(truncatingIfNeeded: $0) }) }
-        if let _x = requiredPackageIdentifier { _w.varintField(21, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var identifier: UInt64? { get { self[0] } set { self[0] = newValue } }
+    var preferredLocator: String? { get { self[1] } set { self[1] = newValue } }
+    var locator: String? { get { self[2] } set { self[2] = newValue } }
+    var documentReadVersion: [UInt32] { get { self[all: 3] } set { self[all: 3] = newValue } }
+    func append(documentReadVersion value: UInt32) { append(value, toAll: 3) }
+    var documentWriteVersion: [UInt32] { get { self[all: 4] } set { self[all: 4] = newValue } }
+    func append(documentWriteVersion value: UInt32) { append(value, toAll: 4) }
+    var externalReferences: [TSP_ComponentExternalReference] { get { self[messages: 5] } set { self[messages: 5] = newValue } }
+    func append(externalReferences value: TSP_ComponentExternalReference) { append(value, toMessages: 5) }
+    var dataReferences: [TSP_ComponentDataReference] { get { self[messages: 6] } set { self[messages: 6] = newValue } }
+    func append(dataReferences value: TSP_ComponentDataReference) { append(value, toMessages: 6) }
+    var isStoredOutsideObjectArchive: Bool? { get { self[7] } set { self[7] = newValue } }
+    var objectUuidMapEntries: [TSP_ObjectUUIDMapEntry] { get { self[messages: 8] } set { self[messages: 8] = newValue } }
+    func append(objectUuidMapEntries value: TSP_ObjectUUIDMapEntry) { append(value, toMessages: 8) }
+    var saveToken: UInt64? { get { self[9] } set { self[9] = newValue } }
+    var featureInfos: [TSP_FeatureInfo] { get { self[messages: 10] } set { self[messages: 10] = newValue } }
+    func append(featureInfos value: TSP_FeatureInfo) { append(value, toMessages: 10) }
+    var componentReadVersion: [UInt32] { get { self[all: 11] } set { self[all: 11] = newValue } }
+    func append(componentReadVersion value: UInt32) { append(value, toAll: 11) }
+    var componentRequiredVersion: [UInt32] { get { self[all: 12] } set { self[all: 12] = newValue } }
+    func append(componentRequiredVersion value: UInt32) { append(value, toAll: 12) }
+    var compressionAlgorithm: UInt32? { get { self[13] } set { self[13] = newValue } }
+    var canBeDropped: Bool? { get { self[14] } set { self[14] = newValue } }
+    var versionedExternalReferences: [TSP_ComponentExternalReference] { get { self[messages: 15] } set { self[messages: 15] = newValue } }
+    func append(versionedExternalReferences value: TSP_ComponentExternalReference) { append(value, toMessages: 15) }
+    var isWasteful: Bool? { get { self[16] } set { self[16] = newValue } }
+    var ambiguousObjectIdentifiers: [UInt64] { get { self[all: 17] } set { self[all: 17] = newValue } }
+    func append(ambiguousObjectIdentifiers value: UInt64) { append(value, toAll: 17) }
+    var requiredPackageIdentifier: UInt32? { get { self[18] } set { self[18] = newValue } }
 }
 
 /// Generated wire model for `TSP.ComponentExternalReference`.
 final class TSP_ComponentExternalReference: IWAMessage {
-    var componentIdentifier: UInt64?
-    var objectIdentifier: UInt64?
-    var isWeak: Bool?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSP.ComponentExternalReference", [
+        .optional(1, .uint64), .optional(2, .uint64), .optional(3, .bool),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt64?
-            if case .varint(let _u) = _f.value { _v = UInt64(truncatingIfNeeded: _u) }
-            if let _v { componentIdentifier = _v }
-        case 2:
-            var _v: UInt64?
-            if case .varint(let _u) = _f.value { _v = UInt64(truncatingIfNeeded: _u) }
-            if let _v { objectIdentifier = _v }
-        case 3:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { isWeak = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = componentIdentifier { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = objectIdentifier { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = isWeak { _w.varintField(3, _x ? 1 : 0) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var componentIdentifier: UInt64? { get { self[0] } set { self[0] = newValue } }
+    var objectIdentifier: UInt64? { get { self[1] } set { self[1] = newValue } }
+    var isWeak: Bool? { get { self[2] } set { self[2] = newValue } }
 }
 
 /// Generated wire model for `TSP.ComponentDataReference`.
 final class TSP_ComponentDataReference: IWAMessage {
-    var dataIdentifier: UInt64?
-    var objectReferenceList: [TSP_ComponentDataReference_ObjectReference] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSP.ComponentDataReference", [
+        .optional(1, .uint64), .repeated(2, TSP_ComponentDataReference_ObjectReference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt64?
-            if case .varint(let _u) = _f.value { _v = UInt64(truncatingIfNeeded: _u) }
-            if let _v { dataIdentifier = _v }
-        case 2:
-            var _v: TSP_ComponentDataReference_ObjectReference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_ComponentDataReference_ObjectReference(ProtobufMessage(_b)) }
-            if let _v { objectReferenceList.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = dataIdentifier { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        for _x in objectReferenceList { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var dataIdentifier: UInt64? { get { self[0] } set { self[0] = newValue } }
+    var objectReferenceList: [TSP_ComponentDataReference_ObjectReference] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(objectReferenceList value: TSP_ComponentDataReference_ObjectReference) { append(value, toMessages: 1) }
 }
 
 /// Generated wire model for `TSP.ComponentDataReference.ObjectReference`.
 final class TSP_ComponentDataReference_ObjectReference: IWAMessage {
-    var objectIdentifier: UInt64?
-    var count: UInt32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSP.ComponentDataReference.ObjectReference", [
+        .optional(1, .uint64), .optional(2, .uint32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt64?
-            if case .varint(let _u) = _f.value { _v = UInt64(truncatingIfNeeded: _u) }
-            if let _v { objectIdentifier = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { count = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = objectIdentifier { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = count { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var objectIdentifier: UInt64? { get { self[0] } set { self[0] = newValue } }
+    var count: UInt32? { get { self[1] } set { self[1] = newValue } }
 }
 
 /// Generated wire model for `TSP.ObjectUUIDMapEntry`.
 final class TSP_ObjectUUIDMapEntry: IWAMessage {
-    var identifier: UInt64?
-    var uuid: TSP_UUID?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSP.ObjectUUIDMapEntry", [
+        .optional(1, .uint64), .optional(2, TSP_UUID.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt64?
-            if case .varint(let _u) = _f.value { _v = UInt64(truncatingIfNeeded: _u) }
-            if let _v { identifier = _v }
-        case 2:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { uuid = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = identifier { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = uuid { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var identifier: UInt64? { get { self[0] } set { self[0] = newValue } }
+    var uuid: TSP_UUID? { get { self[message: 1] } set { self[message: 1] = newValue } }
 }
 
 /// Generated wire model for `TSP.FeatureInfo`.
 final class TSP_FeatureInfo: IWAMessage {
-    var identifier: String?
-    var readVersion: [UInt32] = []
-    var writeVersion: [UInt32] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSP.FeatureInfo", [
+        .optional(1, .string), .repeated(2, .uint32, packed: true), .repeated(3, .uint32, packed: true),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { identifier = _v }
-        case 2:
-            if case .varint(let _u) = _f.value { readVersion.append(UInt32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { readVersion.append(UInt32(truncatingIfNeeded: _u)) } }
-        case 3:
-            if case .varint(let _u) = _f.value { writeVersion.append(UInt32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { writeVersion.append(UInt32(truncatingIfNeeded: _u)) } }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = identifier { _w.stringField(1, _x) }
-        if !readVersion.isEmpty { _w.packedVarintField(2, readVersion.map { UInt64(truncatingIfNeeded: $0) }) }
-        if !writeVersion.isEmpty { _w.packedVarintField(3, writeVersion.map { UInt64(truncatingIfNeeded: $0) }) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var identifier: String? { get { self[0] } set { self[0] = newValue } }
+    var readVersion: [UInt32] { get { self[all: 1] } set { self[all: 1] = newValue } }
+    func append(readVersion value: UInt32) { append(value, toAll: 1) }
+    var writeVersion: [UInt32] { get { self[all: 2] } set { self[all: 2] = newValue } }
+    func append(writeVersion value: UInt32) { append(value, toAll: 2) }
 }
 
 /// Generated wire model for `TSP.PackageMetadata`.
 final class TSP_PackageMetadata: IWAMessage {
-    var lastObjectIdentifier: UInt64?
-    var revision: TSP_DocumentRevision?
-    var components: [TSP_ComponentInfo] = []
-    var datas: [TSP_DataInfo] = []
-    var readVersion: [UInt32] = []
-    var writeVersion: [UInt32] = []
-    var fileFormatVersion: [UInt32] = []
-    var saveToken: UInt64?
-    var preferredPackageType: Int32?
-    var dataMetadataMap: TSP_Reference?
-    var versionedComponents: [TSP_ComponentInfo] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSP.PackageMetadata", [
+        .optional(1, .uint64), .optional(2, TSP_DocumentRevision.self), .repeated(3, TSP_ComponentInfo.self),
+        .repeated(4, TSP_DataInfo.self), .repeated(5, .uint32, packed: true), .repeated(6, .uint32, packed: true),
+        .repeated(7, .uint32, packed: true), .optional(8, .uint64), .optional(9, .int32),
+        .optional(10, TSP_Reference.self), .repeated(11, TSP_ComponentInfo.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 11)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt64?
-            if case .varint(let _u) = _f.value { _v = UInt64(truncatingIfNeeded: _u) }
-            if let _v { lastObjectIdentifier = _v }
-        case 2:
-            var _v: TSP_DocumentRevision?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_DocumentRevision(ProtobufMessage(_b)) }
-            if let _v { revision = _v }
-        case 3:
-            var _v: TSP_ComponentInfo?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_ComponentInfo(ProtobufMessage(_b)) }
-            if let _v { components.append(_v) }
-        case 4:
-            var _v: TSP_DataInfo?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_DataInfo(ProtobufMessage(_b)) }
-            if let _v { datas.append(_v) }
-        case 5:
-            if case .varint(let _u) = _f.value { readVersion.append(UInt32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { readVersion.append(UInt32(truncatingIfNeeded: _u)) } }
-        case 6:
-            if case .varint(let _u) = _f.value { writeVersion.append(UInt32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { writeVersion.append(UInt32(truncatingIfNeeded: _u)) } }
-        case 7:
-            if case .varint(let _u) = _f.value { fileFormatVersion.append(UInt32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { fileFormatVersion.append(UInt32(truncatingIfNeeded: _u)) } }
-        case 8:
-            var _v: UInt64?
-            if case .varint(let _u) = _f.value { _v = UInt64(truncatingIfNeeded: _u) }
-            if let _v { saveToken = _v }
-        case 9:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { preferredPackageType = _v }
-        case 10:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { dataMetadataMap = _v }
-        case 11:
-            var _v: TSP_ComponentInfo?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_ComponentInfo(ProtobufMessage(_b)) }
-            if let _v { versionedComponents.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = lastObjectIdentifier { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = revision { _w.bytesField(2, _x.encoded()) }
-        for _x in components { _w.bytesField(3, _x.encoded()) }
-        for _x in datas { _w.bytesField(4, _x.encoded()) }
-        if !readVersion.isEmpty { _w.packedVarintField(5, readVersion.map { UInt64(truncatingIfNeeded: $0) }) }
-        if !writeVersion.isEmpty { _w.packedVarintField(6, writeVersion.map { UInt64(truncatingIfNeeded: $0) }) }
-        if !fileFormatVersion.isEmpty { _w.packedVarintField(7, fileFormatVersion.map { UInt64(truncatingIfNeeded: $0) }) }
-        if let _x = saveToken { _w.varintField(8, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = preferredPackageType { _w.varintField(9, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = dataMetadataMap { _w.bytesField(10, _x.encoded()) }
-        for _x in versionedComponents { _w.bytesField(11, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var lastObjectIdentifier: UInt64? { get { self[0] } set { self[0] = newValue } }
+    var revision: TSP_DocumentRevision? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var components: [TSP_ComponentInfo] { get { self[messages: 2] } set { self[messages: 2] = newValue } }
+    func append(components value: TSP_ComponentInfo) { append(value, toMessages: 2) }
+    var datas: [TSP_DataInfo] { get { self[messages: 3] } set { self[messages: 3] = newValue } }
+    func append(datas value: TSP_DataInfo) { append(value, toMessages: 3) }
+    var readVersion: [UInt32] { get { self[all: 4] } set { self[all: 4] = newValue } }
+    func append(readVersion value: UInt32) { append(value, toAll: 4) }
+    var writeVersion: [UInt32] { get { self[all: 5] } set { self[all: 5] = newValue } }
+    func append(writeVersion value: UInt32) { append(value, toAll: 5) }
+    var fileFormatVersion: [UInt32] { get { self[all: 6] } set { self[all: 6] = newValue } }
+    func append(fileFormatVersion value: UInt32) { append(value, toAll: 6) }
+    var saveToken: UInt64? { get { self[7] } set { self[7] = newValue } }
+    var preferredPackageType: Int32? { get { self[8] } set { self[8] = newValue } }
+    var dataMetadataMap: TSP_Reference? { get { self[message: 9] } set { self[message: 9] = newValue } }
+    var versionedComponents: [TSP_ComponentInfo] { get { self[messages: 10] } set { self[messages: 10] = newValue } }
+    func append(versionedComponents value: TSP_ComponentInfo) { append(value, toMessages: 10) }
 }
 
 /// Generated wire model for `TSP.DocumentRevision`.
 final class TSP_DocumentRevision: IWAMessage {
-    var sequence32: Int32?
-    var identifier: String?
-    var sequence64: UInt64?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSP.DocumentRevision", [
+        .optional(3, .int32), .optional(2, .string), .optional(1, .uint64),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 3:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { sequence32 = _v }
-        case 2:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { identifier = _v }
-        case 1:
-            var _v: UInt64?
-            if case .varint(let _u) = _f.value { _v = UInt64(truncatingIfNeeded: _u) }
-            if let _v { sequence64 = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = sequence32 { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = identifier { _w.stringField(2, _x) }
-        if let _x = sequence64 { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var sequence32: Int32? { get { self[0] } set { self[0] = newValue } }
+    var identifier: String? { get { self[1] } set { self[1] = newValue } }
+    var sequence64: UInt64? { get { self[2] } set { self[2] = newValue } }
 }
 
 /// Generated wire model for `TSP.PasteboardMetadata`.
 final class TSP_PasteboardMetadata: IWAMessage {
-    var version: [UInt32] = []
-    var appName: String?
-    var datas: [TSP_DataInfo] = []
-    var sourceDocumentUuid: TSP_UUID?
-    var dataMetadataMap: TSP_Reference?
-    var readVersion: [UInt32] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSP.PasteboardMetadata", [
+        .repeated(1, .uint32, packed: true), .optional(2, .string), .repeated(3, TSP_DataInfo.self),
+        .optional(5, TSP_UUID.self), .optional(6, TSP_Reference.self), .repeated(7, .uint32, packed: true),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 6)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            if case .varint(let _u) = _f.value { version.append(UInt32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { version.append(UInt32(truncatingIfNeeded: _u)) } }
-        case 2:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { appName = _v }
-        case 3:
-            var _v: TSP_DataInfo?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_DataInfo(ProtobufMessage(_b)) }
-            if let _v { datas.append(_v) }
-        case 5:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { sourceDocumentUuid = _v }
-        case 6:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { dataMetadataMap = _v }
-        case 7:
-            if case .varint(let _u) = _f.value { readVersion.append(UInt32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { readVersion.append(UInt32(truncatingIfNeeded: _u)) } }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if !version.isEmpty { _w.packedVarintField(1, version.map { UInt64(truncatingIfNeeded: $0) }) }
-        if let _x = appName { _w.stringField(2, _x) }
-        for _x in datas { _w.bytesField(3, _x.encoded()) }
-        if let _x = sourceDocumentUuid { _w.bytesField(5, _x.encoded()) }
-        if let _x = dataMetadataMap { _w.bytesField(6, _x.encoded()) }
-        if !readVersion.isEmpty { _w.packedVarintField(7, readVersion.map { UInt64(truncatingIfNeeded: $0) }) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var version: [UInt32] { get { self[all: 0] } set { self[all: 0] = newValue } }
+    func append(version value: UInt32) { append(value, toAll: 0) }
+    var appName: String? { get { self[1] } set { self[1] = newValue } }
+    var datas: [TSP_DataInfo] { get { self[messages: 2] } set { self[messages: 2] = newValue } }
+    func append(datas value: TSP_DataInfo) { append(value, toMessages: 2) }
+    var sourceDocumentUuid: TSP_UUID? { get { self[message: 3] } set { self[message: 3] = newValue } }
+    var dataMetadataMap: TSP_Reference? { get { self[message: 4] } set { self[message: 4] = newValue } }
+    var readVersion: [UInt32] { get { self[all: 5] } set { self[all: 5] = newValue } }
+    func append(readVersion value: UInt32) { append(value, toAll: 5) }
 }
 
 /// Generated wire model for `TSP.DataInfo`.
 final class TSP_DataInfo: IWAMessage {
-    var identifier: UInt64?
-    var digest: [UInt8]?
-    var preferredFileName: String?
-    var fileName: String?
-    var documentResourceLocator: String?
-    var sourceBookmarkData: [UInt8]?
-    var remoteUrl: String?
-    var canDownload: Bool?
-    var downloadPriority: Int32?
-    var attributes: TSP_DataAttributes?
-    var encryptionInfo: TSP_EncryptionInfo?
-    var lastMismatchedDigest: [UInt8]?
-    var unmaterializedRanges: TSP_IndexSet?
-    var remoteDataLength: UInt64?
-    var remoteDataHasPackageStorage: Bool?
-    var uploadStatus: Int32?
-    var remoteDataMtime: Double?
-    var materializedLength: UInt64?
-    var pasteboardExternalFilePath: String?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSP.DataInfo", [
+        .optional(1, .uint64), .optional(2, .bytes), .optional(3, .string), .optional(4, .string),
+        .optional(5, .string), .optional(6, .bytes), .optional(7, .string), .optional(8, .bool), .optional(9, .int32),
+        .optional(10, TSP_DataAttributes.self), .optional(11, TSP_EncryptionInfo.self), .optional(12, .bytes),
+        .optional(13, TSP_IndexSet.self), .optional(14, .uint64), .optional(15, .bool), .optional(16, .int32),
+        .optional(17, .double), .optional(18, .uint64), .optional(99, .string),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 19)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt64?
-            if case .varint(let _u) = _f.value { _v = UInt64(truncatingIfNeeded: _u) }
-            if let _v { identifier = _v }
-        case 2:
-            var _v: [UInt8]?
-            if case .lengthDelimited(let _b) = _f.value { _v = _b }
-            if let _v { digest = _v }
-        case 3:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { preferredFileName = _v }
-        case 4:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { fileName = _v }
-        case 5:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { documentResourceLocator = _v }
-        case 6:
-            var _v: [UInt8]?
-            if case .lengthDelimited(let _b) = _f.value { _v = _b }
-            if let _v { sourceBookmarkData = _v }
-        case 7:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { remoteUrl = _v }
-        case 8:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { canDownload = _v }
-        case 9:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { downloadPriority = _v }
-        case 10:
-            var _v: TSP_DataAttributes?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_DataAttributes(ProtobufMessage(_b)) }
-            if let _v { attributes = _v }
-        case 11:
-            var _v: TSP_EncryptionInfo?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_EncryptionInfo(ProtobufMessage(_b)) }
-            if let _v { encryptionInfo = _v }
-        case 12:
-            var _v: [UInt8]?
-            if case .lengthDelimited(let _b) = _f.value { _v = _b }
-            if let _v { lastMismatchedDigest = _v }
-        case 13:
-            var _v: TSP_IndexSet?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_IndexSet(ProtobufMessage(_b)) }
-            if let _v { unmaterializedRanges = _v }
-        case 14:
-            var _v: UInt64?
-            if case .varint(let _u) = _f.value { _v = UInt64(truncatingIfNeeded: _u) }
-            if let _v { remoteDataLength = _v }
-        case 15:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { remoteDataHasPackageStorage = _v }
-        case 16:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { uploadStatus = _v }
-        case 17:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { remoteDataMtime = _v }
-        case 18:
-            var _v: UInt64?
-            if case .varint(let _u) = _f.value { _v = UInt64(truncatingIfNeeded: _u) }
-            if let _v { materializedLength = _v }
-        case 99:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { pasteboardExternalFilePath = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = identifier { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = digest { _w.bytesField(2, _x) }
-        if let _x = preferredFileName { _w.stringField(3, _x) }
-        if let _x = fileName { _w.stringField(4, _x) }
-        if let _x = documentResourceLocator { _w.stringField(5, _x) }
-        if let _x = sourceBookmarkData { _w.bytesField(6, _x) }
-        if let _x = remoteUrl { _w.stringField(7, _x) }
-        if let _x = canDownload { _w.varintField(8, _x ? 1 : 0) }
-        if let _x = downloadPriority { _w.varintField(9, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = attributes { _w.bytesField(10, _x.encoded()) }
-        if let _x = encryptionInfo { _w.bytesField(11, _x.encoded()) }
-        if let _x = lastMismatchedDigest { _w.bytesField(12, _x) }
-        if let _x = unmaterializedRanges { _w.bytesField(13, _x.encoded()) }
-        if let _x = remoteDataLength { _w.varintField(14, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = remoteDataHasPackageStorage { _w.varintField(15, _x ? 1 : 0) }
-        if let _x = uploadStatus { _w.varintField(16, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = remoteDataMtime { _w.fixed64Field(17, _x.bitPattern) }
-        if let _x = materializedLength { _w.varintField(18, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = pasteboardExternalFilePath { _w.stringField(99, _x) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var identifier: UInt64? { get { self[0] } set { self[0] = newValue } }
+    var digest: [UInt8]? { get { self[1] } set { self[1] = newValue } }
+    var preferredFileName: String? { get { self[2] } set { self[2] = newValue } }
+    var fileName: String? { get { self[3] } set { self[3] = newValue } }
+    var documentResourceLocator: String? { get { self[4] } set { self[4] = newValue } }
+    var sourceBookmarkData: [UInt8]? { get { self[5] } set { self[5] = newValue } }
+    var remoteUrl: String? { get { self[6] } set { self[6] = newValue } }
+    var canDownload: Bool? { get { self[7] } set { self[7] = newValue } }
+    var downloadPriority: Int32? { get { self[8] } set { self[8] = newValue } }
+    var attributes: TSP_DataAttributes? { get { self[message: 9] } set { self[message: 9] = newValue } }
+    var encryptionInfo: TSP_EncryptionInfo? { get { self[message: 10] } set { self[message: 10] = newValue } }
+    var lastMismatchedDigest: [UInt8]? { get { self[11] } set { self[11] = newValue } }
+    var unmaterializedRanges: TSP_IndexSet? { get { self[message: 12] } set { self[message: 12] = newValue } }
+    var remoteDataLength: UInt64? { get { self[13] } set { self[13] = newValue } }
+    var remoteDataHasPackageStorage: Bool? { get { self[14] } set { self[14] = newValue } }
+    var uploadStatus: Int32? { get { self[15] } set { self[15] = newValue } }
+    var remoteDataMtime: Double? { get { self[16] } set { self[16] = newValue } }
+    var materializedLength: UInt64? { get { self[17] } set { self[17] = newValue } }
+    var pasteboardExternalFilePath: String? { get { self[18] } set { self[18] = newValue } }
 }
 
 /// Generated wire model for `TSP.DataMetadataMap`.
 final class TSP_DataMetadataMap: IWAMessage {
-    var dataMetadataEntries: [TSP_DataMetadataMap_DataMetadataMapEntry] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSP.DataMetadataMap", [
+        .repeated(1, TSP_DataMetadataMap_DataMetadataMapEntry.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_DataMetadataMap_DataMetadataMapEntry?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_DataMetadataMap_DataMetadataMapEntry(ProtobufMessage(_b)) }
-            if let _v { dataMetadataEntries.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in dataMetadataEntries { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var dataMetadataEntries: [TSP_DataMetadataMap_DataMetadataMapEntry] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(dataMetadataEntries value: TSP_DataMetadataMap_DataMetadataMapEntry) { append(value, toMessages: 0) }
 }
 
 /// Generated wire model for `TSP.DataMetadataMap.DataMetadataMapEntry`.
 final class TSP_DataMetadataMap_DataMetadataMapEntry: IWAMessage {
-    var dataIdentifier: UInt64?
-    var dataMetadata: TSP_Reference?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSP.DataMetadataMap.DataMetadataMapEntry", [
+        .optional(1, .uint64), .optional(2, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt64?
-            if case .varint(let _u) = _f.value { _v = UInt64(truncatingIfNeeded: _u) }
-            if let _v { dataIdentifier = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { dataMetadata = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = dataIdentifier { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = dataMetadata { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var dataIdentifier: UInt64? { get { self[0] } set { self[0] = newValue } }
+    var dataMetadata: TSP_Reference? { get { self[message: 1] } set { self[message: 1] = newValue } }
 }
 
 /// Generated wire model for `TSP.DataMetadata`.
 final class TSP_DataMetadata: IWAMessage {
-    var fallbackColor: TSP_Color?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSP.DataMetadata", [
+        .optional(1, TSP_Color.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Color?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Color(ProtobufMessage(_b)) }
-            if let _v { fallbackColor = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = fallbackColor { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var fallbackColor: TSP_Color? { get { self[message: 0] } set { self[message: 0] = newValue } }
 }
 
 /// Generated wire model for `TSP.EncryptionInfo`.
 final class TSP_EncryptionInfo: IWAMessage {
-    var decodedLength: UInt64?
-    var preferredBlockSize: UInt64?
-    var blockInfos: [TSP_EncryptionBlockInfo] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSP.EncryptionInfo", [
+        .optional(1, .uint64), .optional(2, .uint64), .repeated(3, TSP_EncryptionBlockInfo.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt64?
-            if case .varint(let _u) = _f.value { _v = UInt64(truncatingIfNeeded: _u) }
-            if let _v { decodedLength = _v }
-        case 2:
-            var _v: UInt64?
-            if case .varint(let _u) = _f.value { _v = UInt64(truncatingIfNeeded: _u) }
-            if let _v { preferredBlockSize = _v }
-        case 3:
-            var _v: TSP_EncryptionBlockInfo?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_EncryptionBlockInfo(ProtobufMessage(_b)) }
-            if let _v { blockInfos.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = decodedLength { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = preferredBlockSize { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        for _x in blockInfos { _w.bytesField(3, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var decodedLength: UInt64? { get { self[0] } set { self[0] = newValue } }
+    var preferredBlockSize: UInt64? { get { self[1] } set { self[1] = newValue } }
+    var blockInfos: [TSP_EncryptionBlockInfo] { get { self[messages: 2] } set { self[messages: 2] = newValue } }
+    func append(blockInfos value: TSP_EncryptionBlockInfo) { append(value, toMessages: 2) }
 }
 
 /// Generated wire model for `TSP.EncryptionBlockInfo`.
 final class TSP_EncryptionBlockInfo: IWAMessage {
-    var encodedLength: UInt64?
-    var decodedLength: UInt64?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSP.EncryptionBlockInfo", [
+        .optional(1, .uint64), .optional(2, .uint64),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt64?
-            if case .varint(let _u) = _f.value { _v = UInt64(truncatingIfNeeded: _u) }
-            if let _v { encodedLength = _v }
-        case 2:
-            var _v: UInt64?
-            if case .varint(let _u) = _f.value { _v = UInt64(truncatingIfNeeded: _u) }
-            if let _v { decodedLength = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = encodedLength { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = decodedLength { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var encodedLength: UInt64? { get { self[0] } set { self[0] = newValue } }
+    var decodedLength: UInt64? { get { self[1] } set { self[1] = newValue } }
 }
 
 /// Generated wire model for `TSP.ViewStateMetadata`.
 final class TSP_ViewStateMetadata: IWAMessage {
-    var version: [UInt32] = []
-    var versionUuid: TSP_UUID?
-    var component: TSP_ComponentInfo?
-    var externalObjectUuidMapEntries: [TSP_ObjectUUIDMapEntry] = []
-    var readVersion: [UInt32] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSP.ViewStateMetadata", [
+        .repeated(1, .uint32, packed: true), .optional(4, TSP_UUID.self), .optional(3, TSP_ComponentInfo.self),
+        .repeated(5, TSP_ObjectUUIDMapEntry.self), .repeated(6, .uint32, packed: true),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 5)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            if case .varint(let _u) = _f.value { version.append(UInt32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { version.append(UInt32(truncatingIfNeeded: _u)) } }
-        case 4:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { versionUuid = _v }
-        case 3:
-            var _v: TSP_ComponentInfo?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_ComponentInfo(ProtobufMessage(_b)) }
-            if let _v { component = _v }
-        case 5:
-            var _v: TSP_ObjectUUIDMapEntry?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_ObjectUUIDMapEntry(ProtobufMessage(_b)) }
-            if let _v { externalObjectUuidMapEntries.append(_v) }
-        case 6:
-            if case .varint(let _u) = _f.value { readVersion.append(UInt32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { readVersion.append(UInt32(truncatingIfNeeded: _u)) } }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if !version.isEmpty { _w.packedVarintField(1, version.map { UInt64(truncatingIfNeeded: $0) }) }
-        if let _x = versionUuid { _w.bytesField(4, _x.encoded()) }
-        if let _x = component { _w.bytesField(3, _x.encoded()) }
-        for _x in externalObjectUuidMapEntries { _w.bytesField(5, _x.encoded()) }
-        if !readVersion.isEmpty { _w.packedVarintField(6, readVersion.map { UInt64(truncatingIfNeeded: $0) }) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var version: [UInt32] { get { self[all: 0] } set { self[all: 0] = newValue } }
+    func append(version value: UInt32) { append(value, toAll: 0) }
+    var versionUuid: TSP_UUID? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var component: TSP_ComponentInfo? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var externalObjectUuidMapEntries: [TSP_ObjectUUIDMapEntry] { get { self[messages: 3] } set { self[messages: 3] = newValue } }
+    func append(externalObjectUuidMapEntries value: TSP_ObjectUUIDMapEntry) { append(value, toMessages: 3) }
+    var readVersion: [UInt32] { get { self[all: 4] } set { self[all: 4] = newValue } }
+    func append(readVersion value: UInt32) { append(value, toAll: 4) }
 }
 
 /// Generated wire model for `TSP.ObjectSerializationMetadata`.
 final class TSP_ObjectSerializationMetadata: IWAMessage {
-    var version: [UInt32] = []
-    var sourceDocumentUuid: TSP_UUID?
-    var versionUuid: TSP_UUID?
-    var component: TSP_ComponentInfo?
-    var datas: [TSP_DataInfo] = []
-    var externalObjectUuidMapEntries: [TSP_ObjectUUIDMapEntry] = []
-    var dataMetadataMap: TSP_Reference?
-    var readVersion: [UInt32] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSP.ObjectSerializationMetadata", [
+        .repeated(1, .uint32, packed: true), .optional(2, TSP_UUID.self), .optional(3, TSP_UUID.self),
+        .optional(4, TSP_ComponentInfo.self), .repeated(5, TSP_DataInfo.self),
+        .repeated(6, TSP_ObjectUUIDMapEntry.self), .optional(7, TSP_Reference.self),
+        .repeated(8, .uint32, packed: true),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 8)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            if case .varint(let _u) = _f.value { version.append(UInt32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { version.append(UInt32(truncatingIfNeeded: _u)) } }
-        case 2:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { sourceDocumentUuid = _v }
-        case 3:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { versionUuid = _v }
-        case 4:
-            var _v: TSP_ComponentInfo?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_ComponentInfo(ProtobufMessage(_b)) }
-            if let _v { component = _v }
-        case 5:
-            var _v: TSP_DataInfo?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_DataInfo(ProtobufMessage(_b)) }
-            if let _v { datas.append(_v) }
-        case 6:
-            var _v: TSP_ObjectUUIDMapEntry?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_ObjectUUIDMapEntry(ProtobufMessage(_b)) }
-            if let _v { externalObjectUuidMapEntries.append(_v) }
-        case 7:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { dataMetadataMap = _v }
-        case 8:
-            if case .varint(let _u) = _f.value { readVersion.append(UInt32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { readVersion.append(UInt32(truncatingIfNeeded: _u)) } }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if !version.isEmpty { _w.packedVarintField(1, version.map { UInt64(truncatingIfNeeded: $0) }) }
-        if let _x = sourceDocumentUuid { _w.bytesField(2, _x.encoded()) }
-        if let _x = versionUuid { _w.bytesField(3, _x.encoded()) }
-        if let _x = component { _w.bytesField(4, _x.encoded()) }
-        for _x in datas { _w.bytesField(5, _x.encoded()) }
-        for _x in externalObjectUuidMapEntries { _w.bytesField(6, _x.encoded()) }
-        if let _x = dataMetadataMap { _w.bytesField(7, _x.encoded()) }
-        if !readVersion.isEmpty { _w.packedVarintField(8, readVersion.map { UInt64(truncatingIfNeeded: $0) }) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var version: [UInt32] { get { self[all: 0] } set { self[all: 0] = newValue } }
+    func append(version value: UInt32) { append(value, toAll: 0) }
+    var sourceDocumentUuid: TSP_UUID? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var versionUuid: TSP_UUID? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var component: TSP_ComponentInfo? { get { self[message: 3] } set { self[message: 3] = newValue } }
+    var datas: [TSP_DataInfo] { get { self[messages: 4] } set { self[messages: 4] = newValue } }
+    func append(datas value: TSP_DataInfo) { append(value, toMessages: 4) }
+    var externalObjectUuidMapEntries: [TSP_ObjectUUIDMapEntry] { get { self[messages: 5] } set { self[messages: 5] = newValue } }
+    func append(externalObjectUuidMapEntries value: TSP_ObjectUUIDMapEntry) { append(value, toMessages: 5) }
+    var dataMetadataMap: TSP_Reference? { get { self[message: 6] } set { self[message: 6] = newValue } }
+    var readVersion: [UInt32] { get { self[all: 7] } set { self[all: 7] = newValue } }
+    func append(readVersion value: UInt32) { append(value, toAll: 7) }
 }
 
 /// Generated wire model for `TSP.ObjectSerializationDirectory`.
 final class TSP_ObjectSerializationDirectory: IWAMessage {
-    var entries: [TSP_ObjectSerializationDirectory_Entry] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSP.ObjectSerializationDirectory", [
+        .repeated(1, TSP_ObjectSerializationDirectory_Entry.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_ObjectSerializationDirectory_Entry?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_ObjectSerializationDirectory_Entry(ProtobufMessage(_b)) }
-            if let _v { entries.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in entries { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var entries: [TSP_ObjectSerializationDirectory_Entry] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(entries value: TSP_ObjectSerializationDirectory_Entry) { append(value, toMessages: 0) }
 }
 
 /// Generated wire model for `TSP.ObjectSerializationDirectory.Entry`.
 final class TSP_ObjectSerializationDirectory_Entry: IWAMessage {
-    var locator: String?
-    var offset: UInt64?
-    var size: UInt64?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSP.ObjectSerializationDirectory.Entry", [
+        .optional(1, .string), .optional(2, .uint64), .optional(3, .uint64),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { locator = _v }
-        case 2:
-            var _v: UInt64?
-            if case .varint(let _u) = _f.value { _v = UInt64(truncatingIfNeeded: _u) }
-            if let _v { offset = _v }
-        case 3:
-            var _v: UInt64?
-            if case .varint(let _u) = _f.value { _v = UInt64(truncatingIfNeeded: _u) }
-            if let _v { size = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = locator { _w.stringField(1, _x) }
-        if let _x = offset { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = size { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var locator: String? { get { self[0] } set { self[0] = newValue } }
+    var offset: UInt64? { get { self[1] } set { self[1] = newValue } }
+    var size: UInt64? { get { self[2] } set { self[2] = newValue } }
 }
 
 /// Generated wire model for `TSP.DataPropertiesEntryV1`.
 final class TSP_DataPropertiesEntryV1: IWAMessage {
-    var digest: [UInt8]?
-    var expectsMatchedDigest: Bool?
-    var creationTimeIntervalSince1970: Double?
-    var creationVersion: [UInt32] = []
-    var lastMismatchedDigest: [UInt8]?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSP.DataPropertiesEntryV1", [
+        .optional(1, .bytes), .optional(2, .bool), .optional(3, .double), .repeated(4, .uint32, packed: true),
+        .optional(5, .bytes),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 5)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: [UInt8]?
-            if case .lengthDelimited(let _b) = _f.value { _v = _b }
-            if let _v { digest = _v }
-        case 2:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { expectsMatchedDigest = _v }
-        case 3:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { creationTimeIntervalSince1970 = _v }
-        case 4:
-            if case .varint(let _u) = _f.value { creationVersion.append(UInt32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { creationVersion.append(UInt32(truncatingIfNeeded: _u)) } }
-        case 5:
-            var _v: [UInt8]?
-            if case .lengthDelimited(let _b) = _f.value { _v = _b }
-            if let _v { lastMismatchedDigest = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = digest { _w.bytesField(1, _x) }
-        if let _x = expectsMatchedDigest { _w.varintField(2, _x ? 1 : 0) }
-        if let _x = creationTimeIntervalSince1970 { _w.fixed64Field(3, _x.bitPattern) }
-        if !creationVersion.isEmpty { _w.packedVarintField(4, creationVersion.map { UInt64(truncatingIfNeeded: $0) }) }
-        if let _x = lastMismatchedDigest { _w.bytesField(5, _x) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var digest: [UInt8]? { get { self[0] } set { self[0] = newValue } }
+    var expectsMatchedDigest: Bool? { get { self[1] } set { self[1] = newValue } }
+    var creationTimeIntervalSince1970: Double? { get { self[2] } set { self[2] = newValue } }
+    var creationVersion: [UInt32] { get { self[all: 3] } set { self[all: 3] = newValue } }
+    func append(creationVersion value: UInt32) { append(value, toAll: 3) }
+    var lastMismatchedDigest: [UInt8]? { get { self[4] } set { self[4] = newValue } }
 }
 
 /// Generated wire model for `TSP.DataPropertiesV1`.
 final class TSP_DataPropertiesV1: IWAMessage {
-    var properties: [TSP_DataPropertiesEntryV1] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSP.DataPropertiesV1", [
+        .repeated(1, TSP_DataPropertiesEntryV1.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_DataPropertiesEntryV1?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_DataPropertiesEntryV1(ProtobufMessage(_b)) }
-            if let _v { properties.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in properties { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var properties: [TSP_DataPropertiesEntryV1] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(properties value: TSP_DataPropertiesEntryV1) { append(value, toMessages: 0) }
 }
 
 /// Generated wire model for `TSP.DocumentMetadata`.
 final class TSP_DocumentMetadata: IWAMessage {
-    var isInCollaborationMode: Bool?
-    var dataPropertiesV1: TSP_DataPropertiesV1?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSP.DocumentMetadata", [
+        .optional(1, .bool), .optional(3, TSP_DataPropertiesV1.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { isInCollaborationMode = _v }
-        case 3:
-            var _v: TSP_DataPropertiesV1?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_DataPropertiesV1(ProtobufMessage(_b)) }
-            if let _v { dataPropertiesV1 = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = isInCollaborationMode { _w.varintField(1, _x ? 1 : 0) }
-        if let _x = dataPropertiesV1 { _w.bytesField(3, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var isInCollaborationMode: Bool? { get { self[0] } set { self[0] = newValue } }
+    var dataPropertiesV1: TSP_DataPropertiesV1? { get { self[message: 1] } set { self[message: 1] = newValue } }
 }
 
 /// Generated wire model for `TSP.SupportMetadata`.
 final class TSP_SupportMetadata: IWAMessage {
-    var isInCollaborationMode: Bool?
-    var dataCollaborationProperties: [TSP_SupportMetadata_DataCollaborationProperties] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSP.SupportMetadata", [
+        .optional(1, .bool), .repeated(2, TSP_SupportMetadata_DataCollaborationProperties.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { isInCollaborationMode = _v }
-        case 2:
-            var _v: TSP_SupportMetadata_DataCollaborationProperties?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_SupportMetadata_DataCollaborationProperties(ProtobufMessage(_b)) }
-            if let _v { dataCollaborationProperties.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = isInCollaborationMode { _w.varintField(1, _x ? 1 : 0) }
-        for _x in dataCollaborationProperties { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var isInCollaborationMode: Bool? { get { self[0] } set { self[0] = newValue } }
+    var dataCollaborationProperties: [TSP_SupportMetadata_DataCollaborationProperties] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(dataCollaborationProperties value: TSP_SupportMetadata_DataCollaborationProperties) { append(value, toMessages: 1) }
 }
 
 /// Generated wire model for `TSP.SupportMetadata.DataCollaborationProperties`.
 final class TSP_SupportMetadata_DataCollaborationProperties: IWAMessage {
-    var digest: [UInt8]?
-    var acknowledgedByServer: Bool?
-    var materializedOnServer: Bool?
-    var revisionSequenceForMaterializedOnServer: Int32?
-    var uploadStatus: Int32?
-    var isRemoteDataEver: Bool?
-    var revisionSequenceForAcknowledgedByServer: Int32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSP.SupportMetadata.DataCollaborationProperties", [
+        .optional(1, .bytes), .optional(2, .bool), .optional(3, .bool), .optional(5, .int32), .optional(4, .int32),
+        .optional(6, .bool), .optional(7, .int32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 7)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: [UInt8]?
-            if case .lengthDelimited(let _b) = _f.value { _v = _b }
-            if let _v { digest = _v }
-        case 2:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { acknowledgedByServer = _v }
-        case 3:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { materializedOnServer = _v }
-        case 5:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { revisionSequenceForMaterializedOnServer = _v }
-        case 4:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { uploadStatus = _v }
-        case 6:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { isRemoteDataEver = _v }
-        case 7:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { revisionSequenceForAcknowledgedByServer = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = digest { _w.bytesField(1, _x) }
-        if let _x = acknowledgedByServer { _w.varintField(2, _x ? 1 : 0) }
-        if let _x = materializedOnServer { _w.varintField(3, _x ? 1 : 0) }
-        if let _x = revisionSequenceForMaterializedOnServer { _w.varintField(5, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = uploadStatus { _w.varintField(4, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = isRemoteDataEver { _w.varintField(6, _x ? 1 : 0) }
-        if let _x = revisionSequenceForAcknowledgedByServer { _w.varintField(7, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var digest: [UInt8]? { get { self[0] } set { self[0] = newValue } }
+    var acknowledgedByServer: Bool? { get { self[1] } set { self[1] = newValue } }
+    var materializedOnServer: Bool? { get { self[2] } set { self[2] = newValue } }
+    var revisionSequenceForMaterializedOnServer: Int32? { get { self[3] } set { self[3] = newValue } }
+    var uploadStatus: Int32? { get { self[4] } set { self[4] = newValue } }
+    var isRemoteDataEver: Bool? { get { self[5] } set { self[5] = newValue } }
+    var revisionSequenceForAcknowledgedByServer: Int32? { get { self[6] } set { self[6] = newValue } }
 }
 
 /// Registers this file's archives into the reflective catalog.
-func registerIWA_TSPArchiveMessages(_ into: inout [(name: String, decode: (ProtobufMessage) -> IWAMessage)]) {
-    into.append(("TSP.ArchiveInfo", { TSP_ArchiveInfo($0) as IWAMessage }))
-    into.append(("TSP.MessageInfo", { TSP_MessageInfo($0) as IWAMessage }))
-    into.append(("TSP.FieldInfo", { TSP_FieldInfo($0) as IWAMessage }))
-    into.append(("TSP.FieldPath", { TSP_FieldPath($0) as IWAMessage }))
-    into.append(("TSP.ComponentInfo", { TSP_ComponentInfo($0) as IWAMessage }))
-    into.append(("TSP.ComponentExternalReference", { TSP_ComponentExternalReference($0) as IWAMessage }))
-    into.append(("TSP.ComponentDataReference", { TSP_ComponentDataReference($0) as IWAMessage }))
-    into.append(("TSP.ComponentDataReference.ObjectReference", { TSP_ComponentDataReference_ObjectReference($0) as IWAMessage }))
-    into.append(("TSP.ObjectUUIDMapEntry", { TSP_ObjectUUIDMapEntry($0) as IWAMessage }))
-    into.append(("TSP.FeatureInfo", { TSP_FeatureInfo($0) as IWAMessage }))
-    into.append(("TSP.PackageMetadata", { TSP_PackageMetadata($0) as IWAMessage }))
-    into.append(("TSP.DocumentRevision", { TSP_DocumentRevision($0) as IWAMessage }))
-    into.append(("TSP.PasteboardMetadata", { TSP_PasteboardMetadata($0) as IWAMessage }))
-    into.append(("TSP.DataInfo", { TSP_DataInfo($0) as IWAMessage }))
-    into.append(("TSP.DataMetadataMap", { TSP_DataMetadataMap($0) as IWAMessage }))
-    into.append(("TSP.DataMetadataMap.DataMetadataMapEntry", { TSP_DataMetadataMap_DataMetadataMapEntry($0) as IWAMessage }))
-    into.append(("TSP.DataMetadata", { TSP_DataMetadata($0) as IWAMessage }))
-    into.append(("TSP.EncryptionInfo", { TSP_EncryptionInfo($0) as IWAMessage }))
-    into.append(("TSP.EncryptionBlockInfo", { TSP_EncryptionBlockInfo($0) as IWAMessage }))
-    into.append(("TSP.ViewStateMetadata", { TSP_ViewStateMetadata($0) as IWAMessage }))
-    into.append(("TSP.ObjectSerializationMetadata", { TSP_ObjectSerializationMetadata($0) as IWAMessage }))
-    into.append(("TSP.ObjectSerializationDirectory", { TSP_ObjectSerializationDirectory($0) as IWAMessage }))
-    into.append(("TSP.ObjectSerializationDirectory.Entry", { TSP_ObjectSerializationDirectory_Entry($0) as IWAMessage }))
-    into.append(("TSP.DataPropertiesEntryV1", { TSP_DataPropertiesEntryV1($0) as IWAMessage }))
-    into.append(("TSP.DataPropertiesV1", { TSP_DataPropertiesV1($0) as IWAMessage }))
-    into.append(("TSP.DocumentMetadata", { TSP_DocumentMetadata($0) as IWAMessage }))
-    into.append(("TSP.SupportMetadata", { TSP_SupportMetadata($0) as IWAMessage }))
-    into.append(("TSP.SupportMetadata.DataCollaborationProperties", { TSP_SupportMetadata_DataCollaborationProperties($0) as IWAMessage }))
+func registerIWA_TSPArchiveMessages(_ into: inout [any IWAMessage.Type]) {
+    into += [
+        TSP_ArchiveInfo.self, TSP_MessageInfo.self, TSP_FieldInfo.self, TSP_FieldPath.self, TSP_ComponentInfo.self,
+        TSP_ComponentExternalReference.self, TSP_ComponentDataReference.self,
+        TSP_ComponentDataReference_ObjectReference.self, TSP_ObjectUUIDMapEntry.self, TSP_FeatureInfo.self,
+        TSP_PackageMetadata.self, TSP_DocumentRevision.self, TSP_PasteboardMetadata.self, TSP_DataInfo.self,
+        TSP_DataMetadataMap.self, TSP_DataMetadataMap_DataMetadataMapEntry.self, TSP_DataMetadata.self,
+        TSP_EncryptionInfo.self, TSP_EncryptionBlockInfo.self, TSP_ViewStateMetadata.self,
+        TSP_ObjectSerializationMetadata.self, TSP_ObjectSerializationDirectory.self,
+        TSP_ObjectSerializationDirectory_Entry.self, TSP_DataPropertiesEntryV1.self, TSP_DataPropertiesV1.self,
+        TSP_DocumentMetadata.self, TSP_SupportMetadata.self, TSP_SupportMetadata_DataCollaborationProperties.self,
+    ]
 }
@@ -5,1614 +5,664 @@ import SwiftTextIWA
 
 /// Generated wire model for `TSP.Reference`.
 final class TSP_Reference: IWAMessage {
-    var identifier: UInt64?
-    var deprecatedType: Int32?
-    var deprecatedIsExternal: Bool?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSP.Reference", [
+        .optional(1, .uint64), .optional(2, .int32), .optional(3, .bool),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt64?
-            if case .varint(let _u) = _f.value { _v = UInt64(truncatingIfNeeded: _u) }
-            if let _v { identifier = _v }
-        case 2:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { deprecatedType = _v }
-        case 3:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { deprecatedIsExternal = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = identifier { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = deprecatedType { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = deprecatedIsExternal { _w.varintField(3, _x ? 1 : 0) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var identifier: UInt64? { get { self[0] } set { self[0] = newValue } }
+    var deprecatedType: Int32? { get { self[1] } set { self[1] = newValue } }
+    var deprecatedIsExternal: Bool? { get { self[2] } set { self[2] = newValue } }
 }
 
 /// Generated wire model for `TSP.DataReference`.
 final class TSP_DataReference: IWAMessage {
-    var identifier: UInt64?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSP.DataReference", [
+        .optional(1, .uint64),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt64?
-            if case .varint(let _u) = _f.value { _v = UInt64(truncatingIfNeeded: _u) }
-            if let _v { identifier = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = identifier { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var identifier: UInt64? { get { self[0] } set { self[0] = newValue } }
 }
 
 /// Generated wire model for `TSP.SparseReferenceArray`.
 final class TSP_SparseReferenceArray: IWAMessage {
-    var count: UInt32?
-    var entries: [TSP_SparseReferenceArray_Entry] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSP.SparseReferenceArray", [
+        .optional(1, .uint32), .repeated(2, TSP_SparseReferenceArray_Entry.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { count = _v }
-        case 2:
-            var _v: TSP_SparseReferenceArray_Entry?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_SparseReferenceArray_Entry(ProtobufMessage(_b)) }
-            if let _v { entries.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = count { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        for _x in entries { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var count: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var entries: [TSP_SparseReferenceArray_Entry] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(entries value: TSP_SparseReferenceArray_Entry) { append(value, toMessages: 1) }
 }
 
 /// Generated wire model for `TSP.SparseReferenceArray.Entry`.
 final class TSP_SparseReferenceArray_Entry: IWAMessage {
-    var index: UInt32?
-    var reference: TSP_Reference?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSP.SparseReferenceArray.Entry", [
+        .optional(1, .uint32), .optional(2, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { index = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { reference = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = index { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = reference { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var index: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var reference: TSP_Reference? { get { self[message: 1] } set { self[message: 1] = newValue } }
 }
 
 /// Generated wire model for `TSP.Point`.
 final class TSP_Point: IWAMessage {
-    var x: Float?
-    var y: Float?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSP.Point", [
+        .optional(1, .float), .optional(2, .float),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { x = _v }
-        case 2:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { y = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = x { _w.fixed32Field(1, _x.bitPattern) }
-        if let _x = y { _w.fixed32Field(2, _x.bitPattern) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var x: Float? { get { self[0] } set { self[0] = newValue } }
+    var y: Float? { get { self[1] } set { self[1] = newValue } }
 }
 
 /// Generated wire model for `TSP.Pose3D`.
 final class TSP_Pose3D: IWAMessage {
-    var yaw: Float?
-    var pitch: Float?
-    var roll: Float?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSP.Pose3D", [
+        .optional(1, .float), .optional(2, .float), .optional(3, .float),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { yaw = _v }
-        case 2:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { pitch = _v }
-        case 3:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { roll = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = yaw { _w.fixed32Field(1, _x.bitPattern) }
-        if let _x = pitch { _w.fixed32Field(2, _x.bitPattern) }
-        if let _x = roll { _w.fixed32Field(3, _x.bitPattern) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var yaw: Float? { get { self[0] } set { self[0] = newValue } }
+    var pitch: Float? { get { self[1] } set { self[1] = newValue } }
+    var roll: Float? { get { self[2] } set { self[2] = newValue } }
 }
 
 /// Generated wire model for `TSP.Rect`.
 final class TSP_Rect: IWAMessage {
-    var origin: TSP_Point?
-    var size: TSP_Size?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSP.Rect", [
+        .optional(1, TSP_Point.self), .optional(2, TSP_Size.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Point?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Point(ProtobufMessage(_b)) }
-            if let _v { origin = _v }
-        case 2:
-            var _v: TSP_Size?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Size(ProtobufMessage(_b)) }
-            if let _v { size = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = origin { _w.bytesField(1, _x.encoded()) }
-        if let _x = size { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var origin: TSP_Point? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var size: TSP_Size? { get { self[message: 1] } set { self[message: 1] = newValue } }
 }
 
 /// Generated wire model for `TSP.Size`.
 final class TSP_Size: IWAMessage {
-    var width: Float?
-    var height: Float?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSP.Size", [
+        .optional(1, .float), .optional(2, .float),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { width = _v }
-        case 2:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { height = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = width { _w.fixed32Field(1, _x.bitPattern) }
-        if let _x = height { _w.fixed32Field(2, _x.bitPattern) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var width: Float? { get { self[0] } set { self[0] = newValue } }
+    var height: Float? { get { self[1] } set { self[1] = newValue } }
 }
 
 /// Generated wire model for `TSP.Range`.
 final class TSP_Range: IWAMessage {
-    var location: UInt32?
-    var length: UInt32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSP.Range", [
+        .optional(1, .uint32), .optional(2, .uint32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { location = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { length = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = location { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = length { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var location: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var length: UInt32? { get { self[1] } set { self[1] = newValue } }
 }
 
 /// Generated wire model for `TSP.Date`.
 final class TSP_Date: IWAMessage {
-    var seconds: Double?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSP.Date", [
+        .optional(1, .double),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { seconds = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = seconds { _w.fixed64Field(1, _x.bitPattern) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var seconds: Double? { get { self[0] } set { self[0] = newValue } }
 }
 
 /// Generated wire model for `TSP.IndexSet`.
 final class TSP_IndexSet: IWAMessage {
-    var ranges: [TSP_Range] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSP.IndexSet", [
+        .repeated(1, TSP_Range.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Range?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Range(ProtobufMessage(_b)) }
-            if let _v { ranges.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in ranges { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var ranges: [TSP_Range] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(ranges value: TSP_Range) { append(value, toMessages: 0) }
 }
 
 /// Generated wire model for `TSP.Color`.
 final class TSP_Color: IWAMessage {
-    var model: Int32?
-    var r: Float?
-    var g: Float?
-    var b: Float?
-    var rgbspace: Int32?
-    var a: Float?
-    var c: Float?
-    var m: Float?
-    var y: Float?
-    var k: Float?
-    var w: Float?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSP.Color", [
+        .optional(1, .int32), .optional(3, .float), .optional(4, .float), .optional(5, .float), .optional(12, .int32),
+        .optional(6, .float), .optional(7, .float), .optional(8, .float), .optional(9, .float), .optional(10, .float),
+        .optional(11, .float),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 11)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { model = _v }
-        case 3:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { r = _v }
-        case 4:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { g = _v }
-        case 5:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { b = _v }
-        case 12:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { rgbspace = _v }
-        case 6:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { a = _v }
-        case 7:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { c = _v }
-        case 8:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { m = _v }
-        case 9:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { y = _v }
-        case 10:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { k = _v }
-        case 11:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { w = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = model { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = r { _w.fixed32Field(3, _x.bitPattern) }
-        if let _x = g { _w.fixed32Field(4, _x.bitPattern) }
-        if let _x = b { _w.fixed32Field(5, _x.bitPattern) }
-        if let _x = rgbspace { _w.varintField(12, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = a { _w.fixed32Field(6, _x.bitPattern) }
-        if let _x = c { _w.fixed32Field(7, _x.bitPattern) }
-        if let _x = m { _w.fixed32Field(8, _x.bitPattern) }
-        if let _x = y { _w.fixed32Field(9, _x.bitPattern) }
-        if let _x = k { _w.fixed32Field(10, _x.bitPattern) }
-        if let _x = w { _w.fixed32Field(11, _x.bitPattern) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var model: Int32? { get { self[0] } set { self[0] = newValue } }
+    var r: Float? { get { self[1] } set { self[1] = newValue } }
+    var g: Float? { get { self[2] } set { self[2] = newValue } }
+    var b: Float? { get { self[3] } set { self[3] = newValue } }
+    var rgbspace: Int32? { get { self[4] } set { self[4] = newValue } }
+    var a: Float? { get { self[5] } set { self[5] = newValue } }
+    var c: Float? { get { self[6] } set { self[6] = newValue } }
+    var m: Float? { get { self[7] } set { self[7] = newValue } }
+    var y: Float? { get { self[8] } set { self[8] = newValue } }
+    var k: Float? { get { self[9] } set { self[9] = newValue } }
+    var w: Float? { get { self[10] } set { self[10] = newValue } }
 }
 
 /// Generated wire model for `TSP.Path`.
 final class TSP_Path: IWAMessage {
-    var elements: [TSP_Path_Element] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSP.Path", [
+        .repeated(1, TSP_Path_Element.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Path_Element?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Path_Element(ProtobufMessage(_b)) }
-            if let _v { elements.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in elements { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var elements: [TSP_Path_Element] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(elements value: TSP_Path_Element) { append(value, toMessages: 0) }
 }
 
 /// Generated wire model for `TSP.Path.Element`.
 final class TSP_Path_Element: IWAMessage {
-    var type: Int32?
-    var points: [TSP_Point] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSP.Path.Element", [
+        .optional(1, .int32), .repeated(2, TSP_Point.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { type = _v }
-        case 2:
-            var _v: TSP_Point?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Point(ProtobufMessage(_b)) }
-            if let _v { points.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = type { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        for _x in points { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var type: Int32? { get { self[0] } set { self[0] = newValue } }
+    var points: [TSP_Point] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(points value: TSP_Point) { append(value, toMessages: 1) }
 }
 
 /// Generated wire model for `TSP.ReferenceDictionary`.
 final class TSP_ReferenceDictionary: IWAMessage {
-    var entries: [TSP_ReferenceDictionary_Entry] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSP.ReferenceDictionary", [
+        .repeated(1, TSP_ReferenceDictionary_Entry.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_ReferenceDictionary_Entry?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_ReferenceDictionary_Entry(ProtobufMessage(_b)) }
-            if let _v { entries.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in entries { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var entries: [TSP_ReferenceDictionary_Entry] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(entries value: TSP_ReferenceDictionary_Entry) { append(value, toMessages: 0) }
 }
 
 /// Generated wire model for `TSP.ReferenceDictionary.Entry`.
 final class TSP_ReferenceDictionary_Entry: IWAMessage {
-    var key: TSP_Reference?
-    var value: TSP_Reference?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSP.ReferenceDictionary.Entry", [
+        .optional(1, TSP_Reference.self), .optional(2, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { key = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { value = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = key { _w.bytesField(1, _x.encoded()) }
-        if let _x = value { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var key: TSP_Reference? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var value: TSP_Reference? { get { self[message: 1] } set { self[message: 1] = newValue } }
 }
 
 /// Generated wire model for `TSP.UUID`.
 final class TSP_UUID: IWAMessage {
-    var lower: UInt64?
-    var upper: UInt64?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSP.UUID", [
+        .optional(1, .uint64), .optional(2, .uint64),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt64?
-            if case .varint(let _u) = _f.value { _v = UInt64(truncatingIfNeeded: _u) }
-            if let _v { lower = _v }
-        case 2:
-            var _v: UInt64?
-            if case .varint(let _u) = _f.value { _v = UInt64(truncatingIfNeeded: _u) }
-            if let _v { upper = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = lower { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = upper { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var lower: UInt64? { get { self[0] } set { self[0] = newValue } }
+    var upper: UInt64? { get { self[1] } set { self[1] = newValue } }
 }
 
 /// Generated wire model for `TSP.CFUUIDArchive`.
 final class TSP_CFUUIDArchive: IWAMessage {
-    var uuidBytes: [UInt8]?
-    var uuidW0: UInt32?
-    var uuidW1: UInt32?
-    var uuidW2: UInt32?
-    var uuidW3: UInt32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSP.CFUUIDArchive", [
+        .optional(1, .bytes), .optional(2, .uint32), .optional(3, .uint32), .optional(4, .uint32),
+        .optional(5, .uint32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 5)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: [UInt8]?
-            if case .lengthDelimited(let _b) = _f.value { _v = _b }
-            if let _v { uuidBytes = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { uuidW0 = _v }
-        case 3:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { uuidW1 = _v }
-        case 4:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { uuidW2 = _v }
-        case 5:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { uuidW3 = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = uuidBytes { _w.bytesField(1, _x) }
-        if let _x = uuidW0 { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = uuidW1 { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = uuidW2 { _w.varintField(4, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = uuidW3 { _w.varintField(5, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var uuidBytes: [UInt8]? { get { self[0] } set { self[0] = newValue } }
+    var uuidW0: UInt32? { get { self[1] } set { self[1] = newValue } }
+    var uuidW1: UInt32? { get { self[2] } set { self[2] = newValue } }
+    var uuidW2: UInt32? { get { self[3] } set { self[3] = newValue } }
+    var uuidW3: UInt32? { get { self[4] } set { self[4] = newValue } }
 }
 
 /// Generated wire model for `TSP.UUIDSetArchive`.
 final class TSP_UUIDSetArchive: IWAMessage {
-    var uids: [TSP_UUID] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSP.UUIDSetArchive", [
+        .repeated(1, TSP_UUID.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { uids.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in uids { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var uids: [TSP_UUID] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(uids value: TSP_UUID) { append(value, toMessages: 0) }
 }
 
 /// Generated wire model for `TSP.UUIDMapArchive`.
 final class TSP_UUIDMapArchive: IWAMessage {
-    var source: [TSP_UUID] = []
-    var target: [TSP_UUID] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSP.UUIDMapArchive", [
+        .repeated(1, TSP_UUID.self), .repeated(2, TSP_UUID.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { source.append(_v) }
-        case 2:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { target.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in source { _w.bytesField(1, _x.encoded()) }
-        for _x in target { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var source: [TSP_UUID] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(source value: TSP_UUID) { append(value, toMessages: 0) }
+    var target: [TSP_UUID] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(target value: TSP_UUID) { append(value, toMessages: 1) }
 }
 
 /// Generated wire model for `TSP.UUIDMultiMapArchive`.
 final class TSP_UUIDMultiMapArchive: IWAMessage {
-    var source: [TSP_UUID] = []
-    var target: [TSP_UUID] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSP.UUIDMultiMapArchive", [
+        .repeated(1, TSP_UUID.self), .repeated(2, TSP_UUID.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { source.append(_v) }
-        case 2:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { target.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in source { _w.bytesField(1, _x.encoded()) }
-        for _x in target { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var source: [TSP_UUID] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(source value: TSP_UUID) { append(value, toMessages: 0) }
+    var target: [TSP_UUID] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(target value: TSP_UUID) { append(value, toMessages: 1) }
 }
 
 /// Generated wire model for `TSP.UUIDCoordArchive`.
 final class TSP_UUIDCoordArchive: IWAMessage {
-    var rowUid: TSP_UUID?
-    var columnUid: TSP_UUID?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSP.UUIDCoordArchive", [
+        .optional(1, TSP_UUID.self), .optional(2, TSP_UUID.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { rowUid = _v }
-        case 2:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { columnUid = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = rowUid { _w.bytesField(1, _x.encoded()) }
-        if let _x = columnUid { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var rowUid: TSP_UUID? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var columnUid: TSP_UUID? { get { self[message: 1] } set { self[message: 1] = newValue } }
 }
 
 /// Generated wire model for `TSP.UUIDRectArchive`.
 final class TSP_UUIDRectArchive: IWAMessage {
-    var columnUids: [TSP_UUID] = []
-    var rowUids: [TSP_UUID] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSP.UUIDRectArchive", [
+        .repeated(1, TSP_UUID.self), .repeated(2, TSP_UUID.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { columnUids.append(_v) }
-        case 2:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { rowUids.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in columnUids { _w.bytesField(1, _x.encoded()) }
-        for _x in rowUids { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var columnUids: [TSP_UUID] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(columnUids value: TSP_UUID) { append(value, toMessages: 0) }
+    var rowUids: [TSP_UUID] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(rowUids value: TSP_UUID) { append(value, toMessages: 1) }
 }
 
 /// Generated wire model for `TSP.SparseUUIDArray`.
 final class TSP_SparseUUIDArray: IWAMessage {
-    var count: UInt32?
-    var entries: [TSP_SparseUUIDArray_Entry] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSP.SparseUUIDArray", [
+        .optional(1, .uint32), .repeated(2, TSP_SparseUUIDArray_Entry.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { count = _v }
-        case 2:
-            var _v: TSP_SparseUUIDArray_Entry?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_SparseUUIDArray_Entry(ProtobufMessage(_b)) }
-            if let _v { entries.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = count { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        for _x in entries { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var count: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var entries: [TSP_SparseUUIDArray_Entry] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(entries value: TSP_SparseUUIDArray_Entry) { append(value, toMessages: 1) }
 }
 
 /// Generated wire model for `TSP.SparseUUIDArray.Entry`.
 final class TSP_SparseUUIDArray_Entry: IWAMessage {
-    var index: UInt32?
-    var uuid: TSP_UUID?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSP.SparseUUIDArray.Entry", [
+        .optional(1, .uint32), .optional(2, TSP_UUID.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { index = _v }
-        case 2:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { uuid = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = index { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = uuid { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var index: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var uuid: TSP_UUID? { get { self[message: 1] } set { self[message: 1] = newValue } }
 }
 
 /// Generated wire model for `TSP.UUIDPath`.
 final class TSP_UUIDPath: IWAMessage {
-    var uuids: [TSP_UUID] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSP.UUIDPath", [
+        .repeated(1, TSP_UUID.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { uuids.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in uuids { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var uuids: [TSP_UUID] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(uuids value: TSP_UUID) { append(value, toMessages: 0) }
 }
 
 /// Generated wire model for `TSP.SparseUUIDPathArray`.
 final class TSP_SparseUUIDPathArray: IWAMessage {
-    var count: UInt32?
-    var entries: [TSP_SparseUUIDPathArray_Entry] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSP.SparseUUIDPathArray", [
+        .optional(1, .uint32), .repeated(2, TSP_SparseUUIDPathArray_Entry.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { count = _v }
-        case 2:
-            var _v: TSP_SparseUUIDPathArray_Entry?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_SparseUUIDPathArray_Entry(ProtobufMessage(_b)) }
-            if let _v { entries.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = count { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        for _x in entries { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var count: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var entries: [TSP_SparseUUIDPathArray_Entry] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(entries value: TSP_SparseUUIDPathArray_Entry) { append(value, toMessages: 1) }
 }
 
 /// Generated wire model for `TSP.SparseUUIDPathArray.Entry`.
 final class TSP_SparseUUIDPathArray_Entry: IWAMessage {
-    var index: UInt32?
-    var uuidPath: TSP_UUIDPath?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSP.SparseUUIDPathArray.Entry", [
+        .optional(1, .uint32), .optional(2, TSP_UUIDPath.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { index = _v }
-        case 2:
-            var _v: TSP_UUIDPath?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUIDPath(ProtobufMessage(_b)) }
-            if let _v { uuidPath = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = index { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = uuidPath { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var index: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var uuidPath: TSP_UUIDPath? { get { self[message: 1] } set { self[message: 1] = newValue } }
 }
 
 /// Generated wire model for `TSP.PasteboardObject`.
 final class TSP_PasteboardObject: IWAMessage {
-    var stylesheet: TSP_Reference?
-    var drawables: [TSP_Reference] = []
-    var styles: [TSP_Reference] = []
-    var wpStorage: TSP_Reference?
-    var guideStorage: TSP_Reference?
-    var appNativeObject: TSP_Reference?
-    var isTextPrimary: Bool?
-    var isSmart: Bool?
-    var presets: [TSP_Reference] = []
-    var topLevelObjects: [TSP_Reference] = []
-    var nativeContentDescription: TSP_Reference?
-    var textRanges: [TSP_Range] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { stylesheet = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { drawables.append(_v) }
-        case 3:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { styles.append(_v) }
-        case 5:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { wpStorage = _v }
-        case 9:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { guideStorage = _v }
-        case 6:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { appNativeObject = _v }
-        case 7:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { isTextPrimary = _v }
-        case 8:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { isSmart = _v }
-        case 10:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { presets.append(_v) }
-        case 11:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { topLevelObjects.append(_v) }
-        case 12:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { nativeContentDescription = _v }
-        case 13:
-            var _v: TSP_Range?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Range(ProtobufMessage(_b)) }
-            if let _v { textRanges.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = stylesheet { _w.bytesField(1, _x.encoded()) }
-        for _x in drawables { _w.bytesField(2, _x.encoded()) }
-        for _x in styles { _w.bytesField(3, _x.encoded()) }
-        if let _x = wpStorage { _w.bytesField(5, _x.encoded()) }
-        if let _x = guideStorage { _w.bytesField(9, _x.encoded()) }
-        if let _x = appNativeObject { _w.bytesField(6, _x.encoded()) }
-        if let _x = isTextPrimary { _w.varintField(7, _x ? 1 : 0) }
-        if let _x = isSmart { _w.varintField(8, _x ? 1 : 0) }
-        for _x in presets { _w.bytesField(10, _x.encoded()) }
-        for _x in topLevelObjects { _w.bytesField(11, _x.encoded()) }
-        if let _x = nativeContentDescription { _w.bytesField(12, _x.encoded()) }
-        for _x in textRanges { _w.bytesField(13, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSP.PasteboardObject", [
+        .optional(1, TSP_Reference.self), .repeated(2, TSP_Reference.self), .repeated(3, TSP_Reference.self),
+        .optional(5, TSP_Reference.self), .optional(9, TSP_Reference.self), .optional(6, TSP_Reference.self),
+        .optional(7, .bool), .optional(8, .bool), .repeated(10, TSP_Reference.self), .repeated(11, TSP_Reference.self),
+        .optional(12, TSP_Reference.self), .repeated(13, TSP_Range.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 12)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var stylesheet: TSP_Reference? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var drawables: [TSP_Reference] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(drawables value: TSP_Reference) { append(value, toMessages: 1) }
+    var styles: [TSP_Reference] { get { self[messages: 2] } set { self[messages: 2] = newValue } }
+    func append(styles value: TSP_Reference) { append(value, toMessages: 2) }
+    var wpStorage: TSP_Reference? { get { self[message: 3] } set { self[message: 3] = newValue } }
+    var guideStorage: TSP_Reference? { get { self[message: 4] } set { self[message: 4] = newValue } }
+    var appNativeObject: TSP_Reference? { get { self[message: 5] } set { self[message: 5] = newValue } }
+    var isTextPrimary: Bool? { get { self[6] } set { self[6] = newValue } }
+    var isSmart: Bool? { get { self[7] } set { self[7] = newValue } }
+    var presets: [TSP_Reference] { get { self[messages: 8] } set { self[messages: 8] = newValue } }
+    func append(presets value: TSP_Reference) { append(value, toMessages: 8) }
+    var topLevelObjects: [TSP_Reference] { get { self[messages: 9] } set { self[messages: 9] = newValue } }
+    func append(topLevelObjects value: TSP_Reference) { append(value, toMessages: 9) }
+    var nativeContentDescription: TSP_Reference? { get { self[message: 10] } set { self[message: 10] = newValue } }
+    var textRanges: [TSP_Range] { get { self[messages: 11] } set { self[messages: 11] = newValue } }
+    func append(textRanges value: TSP_Range) { append(value, toMessages: 11) }
 }
 
 /// Generated wire model for `TSP.ObjectCollection`.
 final class TSP_ObjectCollection: IWAMessage {
-    var objects: [TSP_Reference] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSP.ObjectCollection", [
+        .repeated(1, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { objects.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in objects { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var objects: [TSP_Reference] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(objects value: TSP_Reference) { append(value, toMessages: 0) }
 }
 
 /// Generated wire model for `TSP.ObjectContainer`.
 final class TSP_ObjectContainer: IWAMessage {
-    var identifier: UInt32?
-    var objects: [TSP_Reference] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSP.ObjectContainer", [
+        .optional(1, .uint32), .repeated(2, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { identifier = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { objects.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = identifier { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        for _x in objects { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var identifier: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var objects: [TSP_Reference] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(objects value: TSP_Reference) { append(value, toMessages: 1) }
 }
 
 /// Generated wire model for `TSP.DataAttributes`.
 final class TSP_DataAttributes: IWAMessage {
-
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSP.DataAttributes", [])
+    var _values = [IWAValue](repeating: .absent, count: 0)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
 }
 
 /// Generated wire model for `TSP.LargeArraySegment`.
 final class TSP_LargeArraySegment: IWAMessage {
-    var shouldDelayArchiving: Bool?
-    var delayedArchivingPriority: UInt32?
-    var packageLocator: String?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSP.LargeArraySegment", [
+        .optional(1, .bool), .optional(2, .uint32), .optional(3, .string),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { shouldDelayArchiving = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { delayedArchivingPriority = _v }
-        case 3:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { packageLocator = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = shouldDelayArchiving { _w.varintField(1, _x ? 1 : 0) }
-        if let _x = delayedArchivingPriority { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = packageLocator { _w.stringField(3, _x) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var shouldDelayArchiving: Bool? { get { self[0] } set { self[0] = newValue } }
+    var delayedArchivingPriority: UInt32? { get { self[1] } set { self[1] = newValue } }
+    var packageLocator: String? { get { self[2] } set { self[2] = newValue } }
 }
 
 /// Generated wire model for `TSP.LargeNumberArraySegment`.
 final class TSP_LargeNumberArraySegment: IWAMessage {
-    var largeArraySegment: TSP_LargeArraySegment?
-    var elements: [Double] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSP.LargeNumberArraySegment", [
+        .optional(1, TSP_LargeArraySegment.self), .repeated(2, .double),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_LargeArraySegment?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_LargeArraySegment(ProtobufMessage(_b)) }
-            if let _v { largeArraySegment = _v }
-        case 2:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { elements.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = largeArraySegment { _w.bytesField(1, _x.encoded()) }
-        for _x in elements { _w.fixed64Field(2, _x.bitPattern) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var largeArraySegment: TSP_LargeArraySegment? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var elements: [Double] { get { self[all: 1] } set { self[all: 1] = newValue } }
+    func append(elements value: Double) { append(value, toAll: 1) }
 }
 
 /// Generated wire model for `TSP.LargeStringArraySegment`.
 final class TSP_LargeStringArraySegment: IWAMessage {
-    var largeArraySegment: TSP_LargeArraySegment?
-    var elements: [TSP_LargeStringArraySegment_OptionalElement] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSP.LargeStringArraySegment", [
+        .optional(1, TSP_LargeArraySegment.self), .repeated(2, TSP_LargeStringArraySegment_OptionalElement.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_LargeArraySegment?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_LargeArraySegment(ProtobufMessage(_b)) }
-            if let _v { largeArraySegment = _v }
-        case 2:
-            var _v: TSP_LargeStringArraySegment_OptionalElement?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_LargeStringArraySegment_OptionalElement(ProtobufMessage(_b)) }
-            if let _v { elements.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = largeArraySegment { _w.bytesField(1, _x.encoded()) }
-        for _x in elements { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var largeArraySegment: TSP_LargeArraySegment? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var elements: [TSP_LargeStringArraySegment_OptionalElement] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(elements value: TSP_LargeStringArraySegment_OptionalElement) { append(value, toMessages: 1) }
 }
 
 /// Generated wire model for `TSP.LargeStringArraySegment.OptionalElement`.
 final class TSP_LargeStringArraySegment_OptionalElement: IWAMessage {
-    var element: String?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSP.LargeStringArraySegment.OptionalElement", [
+        .optional(1, .string),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { element = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = element { _w.stringField(1, _x) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var element: String? { get { self[0] } set { self[0] = newValue } }
 }
 
 /// Generated wire model for `TSP.LargeUUIDArraySegment`.
 final class TSP_LargeUUIDArraySegment: IWAMessage {
-    var largeArraySegment: TSP_LargeArraySegment?
-    var elements: [TSP_UUID] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSP.LargeUUIDArraySegment", [
+        .optional(1, TSP_LargeArraySegment.self), .repeated(2, TSP_UUID.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_LargeArraySegment?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_LargeArraySegment(ProtobufMessage(_b)) }
-            if let _v { largeArraySegment = _v }
-        case 2:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { elements.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = largeArraySegment { _w.bytesField(1, _x.encoded()) }
-        for _x in elements { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var largeArraySegment: TSP_LargeArraySegment? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var elements: [TSP_UUID] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(elements value: TSP_UUID) { append(value, toMessages: 1) }
 }
 
 /// Generated wire model for `TSP.LargeLazyObjectArraySegment`.
 final class TSP_LargeLazyObjectArraySegment: IWAMessage {
-    var largeArraySegment: TSP_LargeArraySegment?
-    var elements: [TSP_Reference] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSP.LargeLazyObjectArraySegment", [
+        .optional(1, TSP_LargeArraySegment.self), .repeated(2, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_LargeArraySegment?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_LargeArraySegment(ProtobufMessage(_b)) }
-            if let _v { largeArraySegment = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { elements.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = largeArraySegment { _w.bytesField(1, _x.encoded()) }
-        for _x in elements { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var largeArraySegment: TSP_LargeArraySegment? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var elements: [TSP_Reference] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(elements value: TSP_Reference) { append(value, toMessages: 1) }
 }
 
 /// Generated wire model for `TSP.LargeObjectArraySegment`.
 final class TSP_LargeObjectArraySegment: IWAMessage {
-    var largeArraySegment: TSP_LargeArraySegment?
-    var elements: [TSP_Reference] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSP.LargeObjectArraySegment", [
+        .optional(1, TSP_LargeArraySegment.self), .repeated(2, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_LargeArraySegment?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_LargeArraySegment(ProtobufMessage(_b)) }
-            if let _v { largeArraySegment = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { elements.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = largeArraySegment { _w.bytesField(1, _x.encoded()) }
-        for _x in elements { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var largeArraySegment: TSP_LargeArraySegment? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var elements: [TSP_Reference] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(elements value: TSP_Reference) { append(value, toMessages: 1) }
 }
 
 /// Generated wire model for `TSP.LargeArray`.
 final class TSP_LargeArray: IWAMessage {
-    var ranges: [TSP_Range] = []
-    var segments: [TSP_Reference] = []
-    var maxSegmentElementCount: UInt64?
-    var maxSegmentSize: UInt64?
-    var shouldDelayArchiving: Bool?
-    var delayedArchivingPriority: UInt32?
-    var storeOutsideObjectArchive: Bool?
-    var estimatedByteSize: UInt64?
-    var maxSegmentCost: UInt64?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSP.LargeArray", [
+        .repeated(1, TSP_Range.self), .repeated(2, TSP_Reference.self), .optional(3, .uint64), .optional(4, .uint64),
+        .optional(5, .bool), .optional(6, .uint32), .optional(7, .bool), .optional(8, .uint64), .optional(9, .uint64),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 9)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Range?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Range(ProtobufMessage(_b)) }
-            if let _v { ranges.append(_v) }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { segments.append(_v) }
-        case 3:
-            var _v: UInt64?
-            if case .varint(let _u) = _f.value { _v = UInt64(truncatingIfNeeded: _u) }
-            if let _v { maxSegmentElementCount = _v }
-        case 4:
-            var _v: UInt64?
-            if case .varint(let _u) = _f.value { _v = UInt64(truncatingIfNeeded: _u) }
-            if let _v { maxSegmentSize = _v }
-        case 5:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { shouldDelayArchiving = _v }
-        case 6:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { delayedArchivingPriority = _v }
-        case 7:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { storeOutsideObjectArchive = _v }
-        case 8:
-            var _v: UInt64?
-            if case .varint(let _u) = _f.value { _v = UInt64(truncatingIfNeeded: _u) }
-            if let _v { estimatedByteSize = _v }
-        case 9:
-            var _v: UInt64?
-            if case .varint(let _u) = _f.value { _v = UInt64(truncatingIfNeeded: _u) }
-            if let _v { maxSegmentCost = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in ranges { _w.bytesField(1, _x.encoded()) }
-        for _x in segments { _w.bytesField(2, _x.encoded()) }
-        if let _x = maxSegmentElementCount { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = maxSegmentSize { _w.varintField(4, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = shouldDelayArchiving { _w.varintField(5, _x ? 1 : 0) }
-        if let _x = delayedArchivingPriority { _w.varintField(6, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = storeOutsideObjectArchive { _w.varintField(7, _x ? 1 : 0) }
-        if let _x = estimatedByteSize { _w.varintField(8, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = maxSegmentCost { _w.varintField(9, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var ranges: [TSP_Range] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(ranges value: TSP_Range) { append(value, toMessages: 0) }
+    var segments: [TSP_Reference] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(segments value: TSP_Reference) { append(value, toMessages: 1) }
+    var maxSegmentElementCount: UInt64? { get { self[2] } set { self[2] = newValue } }
+    var maxSegmentSize: UInt64? { get { self[3] } set { self[3] = newValue } }
+    var shouldDelayArchiving: Bool? { get { self[4] } set { self[4] = newValue } }
+    var delayedArchivingPriority: UInt32? { get { self[5] } set { self[5] = newValue } }
+    var storeOutsideObjectArchive: Bool? { get { self[6] } set { self[6] = newValue } }
+    var estimatedByteSize: UInt64? { get { self[7] } set { self[7] = newValue } }
+    var maxSegmentCost: UInt64? { get { self[8] } set { self[8] = newValue } }
 }
 
 /// Generated wire model for `TSP.LargeNumberArray`.
 final class TSP_LargeNumberArray: IWAMessage {
-    var largeArray: TSP_LargeArray?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSP.LargeNumberArray", [
+        .optional(1, TSP_LargeArray.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_LargeArray?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_LargeArray(ProtobufMessage(_b)) }
-            if let _v { largeArray = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = largeArray { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var largeArray: TSP_LargeArray? { get { self[message: 0] } set { self[message: 0] = newValue } }
 }
 
 /// Generated wire model for `TSP.LargeStringArray`.
 final class TSP_LargeStringArray: IWAMessage {
-    var largeArray: TSP_LargeArray?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSP.LargeStringArray", [
+        .optional(1, TSP_LargeArray.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_LargeArray?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_LargeArray(ProtobufMessage(_b)) }
-            if let _v { largeArray = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = largeArray { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var largeArray: TSP_LargeArray? { get { self[message: 0] } set { self[message: 0] = newValue } }
 }
 
 /// Generated wire model for `TSP.LargeLazyObjectArray`.
 final class TSP_LargeLazyObjectArray: IWAMessage {
-    var largeArray: TSP_LargeArray?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSP.LargeLazyObjectArray", [
+        .optional(1, TSP_LargeArray.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_LargeArray?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_LargeArray(ProtobufMessage(_b)) }
-            if let _v { largeArray = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = largeArray { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var largeArray: TSP_LargeArray? { get { self[message: 0] } set { self[message: 0] = newValue } }
 }
 
 /// Generated wire model for `TSP.LargeObjectArray`.
 final class TSP_LargeObjectArray: IWAMessage {
-    var largeArray: TSP_LargeArray?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSP.LargeObjectArray", [
+        .optional(1, TSP_LargeArray.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_LargeArray?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_LargeArray(ProtobufMessage(_b)) }
-            if let _v { largeArray = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = largeArray { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var largeArray: TSP_LargeArray? { get { self[message: 0] } set { self[message: 0] = newValue } }
 }
 
 /// Generated wire model for `TSP.LargeUUIDArray`.
 final class TSP_LargeUUIDArray: IWAMessage {
-    var largeArray: TSP_LargeArray?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSP.LargeUUIDArray", [
+        .optional(1, TSP_LargeArray.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_LargeArray?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_LargeArray(ProtobufMessage(_b)) }
-            if let _v { largeArray = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = largeArray { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var largeArray: TSP_LargeArray? { get { self[message: 0] } set { self[message: 0] = newValue } }
 }
 
 /// Generated wire model for `TSP.FieldOptions`.
 final class TSP_FieldOptions: IWAMessage {
-    var metadataType: Int32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSP.FieldOptions", [
+        .optional(1, .int32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { metadataType = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = metadataType { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var metadataType: Int32? { get { self[0] } set { self[0] = newValue } }
 }
 
 /// Registers this file's archives into the reflective catalog.
-func registerIWA_TSPMessages(_ into: inout [(name: String, decode: (ProtobufMessage) -> IWAMessage)]) {
-    into.append(("TSP.Reference", { TSP_Reference($0) as IWAMessage }))
-    into.append(("TSP.DataReference", { TSP_DataReference($0) as IWAMessage }))
-    into.append(("TSP.SparseReferenceArray", { TSP_SparseReferenceArray($0) as IWAMessage }))
-    into.append(("TSP.SparseReferenceArray.Entry", { TSP_SparseReferenceArray_Entry($0) as IWAMessage }))
-    into.append(("TSP.Point", { TSP_Point($0) as IWAMessage }))
-    into.append(("TSP.Pose3D", { TSP_Pose3D($0) as IWAMessage }))
-    into.append(("TSP.Rect", { TSP_Rect($0) as IWAMessage }))
-    into.append(("TSP.Size", { TSP_Size($0) as IWAMessage }))
-    into.append(("TSP.Range", { TSP_Range($0) as IWAMessage }))
-    into.append(("TSP.Date", { TSP_Date($0) as IWAMessage }))
-    into.append(("TSP.IndexSet", { TSP_IndexSet($0) as IWAMessage }))
-    into.append(("TSP.Color", { TSP_Color($0) as IWAMessage }))
-    into.append(("TSP.Path", { TSP_Path($0) as IWAMessage }))
-    into.append(("TSP.Path.Element", { TSP_Path_Element($0) as IWAMessage }))
-    into.append(("TSP.ReferenceDictionary", { TSP_ReferenceDictionary($0) as IWAMessage }))
-    into.append(("TSP.ReferenceDictionary.Entry", { TSP_ReferenceDictionary_Entry($0) as IWAMessage }))
-    into.append(("TSP.UUID", { TSP_UUID($0) as IWAMessage }))
-    into.append(("TSP.CFUUIDArchive", { TSP_CFUUIDArchive($0) as IWAMessage }))
-    into.append(("TSP.UUIDSetArchive", { TSP_UUIDSetArchive($0) as IWAMessage }))
-    into.append(("TSP.UUIDMapArchive", { TSP_UUIDMapArchive($0) as IWAMessage }))
-    into.append(("TSP.UUIDMultiMapArchive", { TSP_UUIDMultiMapArchive($0) as IWAMessage }))
-    into.append(("TSP.UUIDCoordArchive", { TSP_UUIDCoordArchive($0) as IWAMessage }))
-    into.append(("TSP.UUIDRectArchive", { TSP_UUIDRectArchive($0) as IWAMessage }))
-    into.append(("TSP.SparseUUIDArray", { TSP_SparseUUIDArray($0) as IWAMessage }))
-    into.append(("TSP.SparseUUIDArray.Entry", { TSP_SparseUUIDArray_Entry($0) as IWAMessage }))
-    into.append(("TSP.UUIDPath", { TSP_UUIDPath($0) as IWAMessage }))
-    into.append(("TSP.SparseUUIDPathArray", { TSP_SparseUUIDPathArray($0) as IWAMessage }))
-    into.append(("TSP.SparseUUIDPathArray.Entry", { TSP_SparseUUIDPathArray_Entry($0) as IWAMessage }))
-    into.append(("TSP.PasteboardObject", { TSP_PasteboardObject($0) as IWAMessage }))
-    into.append(("TSP.ObjectCollection", { TSP_ObjectCollection($0) as IWAMessage }))
-    into.append(("TSP.ObjectContainer", { TSP_ObjectContainer($0) as IWAMessage }))
-    into.append(("TSP.DataAttributes", { TSP_DataAttributes($0) as IWAMessage }))
-    into.append(("TSP.LargeArraySegment", { TSP_LargeArraySegment($0) as IWAMessage }))
-    into.append(("TSP.LargeNumberArraySegment", { TSP_LargeNumberArraySegment($0) as IWAMessage }))
-    into.append(("TSP.LargeStringArraySegment", { TSP_LargeStringArraySegment($0) as IWAMessage }))
-    into.append(("TSP.LargeStringArraySegment.OptionalElement", { TSP_LargeStringArraySegment_OptionalElement($0) as IWAMessage }))
-    into.append(("TSP.LargeUUIDArraySegment", { TSP_LargeUUIDArraySegment($0) as IWAMessage }))
-    into.append(("TSP.LargeLazyObjectArraySegment", { TSP_LargeLazyObjectArraySegment($0) as IWAMessage }))
-    into.append(("TSP.LargeObjectArraySegment", { TSP_LargeObjectArraySegment($0) as IWAMessage }))
-    into.append(("TSP.LargeArray", { TSP_LargeArray($0) as IWAMessage }))
-    into.append(("TSP.LargeNumberArray", { TSP_LargeNumberArray($0) as IWAMessage }))
-    into.append(("TSP.LargeStringArray", { TSP_LargeStringArray($0) as IWAMessage }))
-    into.append(("TSP.LargeLazyObjectArray", { TSP_LargeLazyObjectArray($0) as IWAMessage }))
-    into.append(("TSP.LargeObjectArray", { TSP_LargeObjectArray($0) as IWAMessage }))
-    into.append(("TSP.LargeUUIDArray", { TSP_LargeUUIDArray($0) as IWAMessage }))
-    into.append(("TSP.FieldOptions", { TSP_FieldOptions($0) as IWAMessage }))
+func registerIWA_TSPMessages(_ into: inout [any IWAMessage.Type]) {
+    into += [
+        TSP_Reference.self, TSP_DataReference.self, TSP_SparseReferenceArray.self, TSP_SparseReferenceArray_Entry.self,
+        TSP_Point.self, TSP_Pose3D.self, TSP_Rect.self, TSP_Size.self, TSP_Range.self, TSP_Date.self, TSP_IndexSet.self,
+        TSP_Color.self, TSP_Path.self, TSP_Path_Element.self, TSP_ReferenceDictionary.self,
+        TSP_ReferenceDictionary_Entry.self, TSP_UUID.self, TSP_CFUUIDArchive.self, TSP_UUIDSetArchive.self,
+        TSP_UUIDMapArchive.self, TSP_UUIDMultiMapArchive.self, TSP_UUIDCoordArchive.self, TSP_UUIDRectArchive.self,
+        TSP_SparseUUIDArray.self, TSP_SparseUUIDArray_Entry.self, TSP_UUIDPath.self, TSP_SparseUUIDPathArray.self,
+        TSP_SparseUUIDPathArray_Entry.self, TSP_PasteboardObject.self, TSP_ObjectCollection.self,
+        TSP_ObjectContainer.self, TSP_DataAttributes.self, TSP_LargeArraySegment.self, TSP_LargeNumberArraySegment.self,
+        TSP_LargeStringArraySegment.self, TSP_LargeStringArraySegment_OptionalElement.self,
+        TSP_LargeUUIDArraySegment.self, TSP_LargeLazyObjectArraySegment.self, TSP_LargeObjectArraySegment.self,
+        TSP_LargeArray.self, TSP_LargeNumberArray.self, TSP_LargeStringArray.self, TSP_LargeLazyObjectArray.self,
+        TSP_LargeObjectArray.self, TSP_LargeUUIDArray.self, TSP_FieldOptions.self,
+    ]
 }
@@ -5,901 +5,332 @@ import SwiftTextIWA
 
 /// Generated wire model for `TSS.StyleArchive`.
 final class TSS_StyleArchive: IWAMessage {
-    var name: String?
-    var styleIdentifier: String?
-    var parent: TSP_Reference?
-    var isVariation: Bool?
-    var stylesheet: TSP_Reference?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSS.StyleArchive", [
+        .optional(1, .string), .optional(2, .string), .optional(3, TSP_Reference.self), .optional(4, .bool),
+        .optional(5, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 5)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { name = _v }
-        case 2:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { styleIdentifier = _v }
-        case 3:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { parent = _v }
-        case 4:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { isVariation = _v }
-        case 5:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { stylesheet = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = name { _w.stringField(1, _x) }
-        if let _x = styleIdentifier { _w.stringField(2, _x) }
-        if let _x = parent { _w.bytesField(3, _x.encoded()) }
-        if let _x = isVariation { _w.varintField(4, _x ? 1 : 0) }
-        if let _x = stylesheet { _w.bytesField(5, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var name: String? { get { self[0] } set { self[0] = newValue } }
+    var styleIdentifier: String? { get { self[1] } set { self[1] = newValue } }
+    var parent: TSP_Reference? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var isVariation: Bool? { get { self[3] } set { self[3] = newValue } }
+    var stylesheet: TSP_Reference? { get { self[message: 4] } set { self[message: 4] = newValue } }
 }
 
 /// Generated wire model for `TSS.StylesheetArchive`.
 final class TSS_StylesheetArchive: IWAMessage {
-    var styles: [TSP_Reference] = []
-    var identifierToStyleMap: [TSS_StylesheetArchive_IdentifiedStyleEntry] = []
-    var parent: TSP_Reference?
-    var isLocked: Bool?
-    var parentToChildrenStyleMap: [TSS_StylesheetArchive_StyleChildrenEntry] = []
-    var canCullStyles: Bool?
-    var stylesFor100: TSS_StylesheetArchive_VersionedStyles?
-    var stylesFor101: TSS_StylesheetArchive_VersionedStyles?
-    var stylesFor102: TSS_StylesheetArchive_VersionedStyles?
-    var stylesFor110: TSS_StylesheetArchive_VersionedStyles?
-    var stylesFor111: TSS_StylesheetArchive_VersionedStyles?
-    var stylesFor112: TSS_StylesheetArchive_VersionedStyles?
-    var stylesFor120: TSS_StylesheetArchive_VersionedStyles?
-    var stylesFor121: TSS_StylesheetArchive_VersionedStyles?
-    var stylesFor122: TSS_StylesheetArchive_VersionedStyles?
-    var stylesFor130: TSS_StylesheetArchive_VersionedStyles?
-    var stylesFor131: TSS_StylesheetArchive_VersionedStyles?
-    var stylesFor132: TSS_StylesheetArchive_VersionedStyles?
-    var stylesFor140: TSS_StylesheetArchive_VersionedStyles?
-    var stylesFor141: TSS_StylesheetArchive_VersionedStyles?
-    var stylesFor142: TSS_StylesheetArchive_VersionedStyles?
-    var stylesFor144: TSS_StylesheetArchive_VersionedStyles?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSS.StylesheetArchive", [
+        .repeated(1, TSP_Reference.self), .repeated(2, TSS_StylesheetArchive_IdentifiedStyleEntry.self),
+        .optional(3, TSP_Reference.self), .optional(4, .bool),
+        .repeated(5, TSS_StylesheetArchive_StyleChildrenEntry.self), .optional(6, .bool),
+        .optional(7, TSS_StylesheetArchive_VersionedStyles.self),
+        .optional(8, TSS_StylesheetArchive_VersionedStyles.self),
+        .optional(9, TSS_StylesheetArchive_VersionedStyles.self),
+        .optional(10, TSS_StylesheetArchive_VersionedStyles.self),
+        .optional(11, TSS_StylesheetArchive_VersionedStyles.self),
+        .optional(12, TSS_StylesheetArchive_VersionedStyles.self),
+        .optional(13, TSS_StylesheetArchive_VersionedStyles.self),
+        .optional(14, TSS_StylesheetArchive_VersionedStyles.self),
+        .optional(15, TSS_StylesheetArchive_VersionedStyles.self),
+        .optional(16, TSS_StylesheetArchive_VersionedStyles.self),
+        .optional(17, TSS_StylesheetArchive_VersionedStyles.self),
+        .optional(18, TSS_StylesheetArchive_VersionedStyles.self),
+        .optional(19, TSS_StylesheetArchive_VersionedStyles.self),
+        .optional(20, TSS_StylesheetArchive_VersionedStyles.self),
+        .optional(21, TSS_StylesheetArchive_VersionedStyles.self),
+        .optional(22, TSS_StylesheetArchive_VersionedStyles.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 22)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { styles.append(_v) }
-        case 2:
-            var _v: TSS_StylesheetArchive_IdentifiedStyleEntry?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSS_StylesheetArchive_IdentifiedStyleEntry(ProtobufMessage(_b)) }
-            if let _v { identifierToStyleMap.append(_v) }
-        case 3:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { parent = _v }
-        case 4:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { isLocked = _v }
-        case 5:
-            var _v: TSS_StylesheetArchive_StyleChildrenEntry?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSS_StylesheetArchive_StyleChildrenEntry(ProtobufMessage(_b)) }
-            if let _v { parentToChildrenStyleMap.append(_v) }
-        case 6:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { canCullStyles = _v }
-        case 7:
-            var _v: TSS_StylesheetArchive_VersionedStyles?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSS_StylesheetArchive_VersionedStyles(ProtobufMessage(_b)) }
-            if let _v { stylesFor100 = _v }
-        case 8:
-            var _v: TSS_StylesheetArchive_VersionedStyles?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSS_StylesheetArchive_VersionedStyles(ProtobufMessage(_b)) }
-            if let _v { stylesFor101 = _v }
-        case 9:
-            var _v: TSS_StylesheetArchive_VersionedStyles?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSS_StylesheetArchive_VersionedStyles(ProtobufMessage(_b)) }
-            if let _v { stylesFor102 = _v }
-        case 10:
-            var _v: TSS_StylesheetArchive_VersionedStyles?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSS_StylesheetArchive_VersionedStyles(ProtobufMessage(_b)) }
-            if let _v { stylesFor110 = _v }
-        case 11:
-            var _v: TSS_StylesheetArchive_VersionedStyles?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSS_StylesheetArchive_VersionedStyles(ProtobufMessage(_b)) }
-            if let _v { stylesFor111 = _v }
-        case 12:
-            var _v: TSS_StylesheetArchive_VersionedStyles?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSS_StylesheetArchive_VersionedStyles(ProtobufMessage(_b)) }
-            if let _v { stylesFor112 = _v }
-        case 13:
-            var _v: TSS_StylesheetArchive_VersionedStyles?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSS_StylesheetArchive_VersionedStyles(ProtobufMessage(_b)) }
-            if let _v { stylesFor120 = _v }
-        case 14:
-            var _v: TSS_StylesheetArchive_VersionedStyles?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSS_StylesheetArchive_VersionedStyles(ProtobufMessage(_b)) }
-            if let _v { stylesFor121 = _v }
-        case 15:
-            var _v: TSS_StylesheetArchive_VersionedStyles?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSS_StylesheetArchive_VersionedStyles(ProtobufMessage(_b)) }
-            if let _v { stylesFor122 = _v }
-        case 16:
-            var _v: TSS_StylesheetArchive_VersionedStyles?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSS_StylesheetArchive_VersionedStyles(ProtobufMessage(_b)) }
-            if let _v { stylesFor130 = _v }
-        case 17:
-            var _v: TSS_StylesheetArchive_VersionedStyles?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSS_StylesheetArchive_VersionedStyles(ProtobufMessage(_b)) }
-            if let _v { stylesFor131 = _v }
-        case 18:
-            var _v: TSS_StylesheetArchive_VersionedStyles?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSS_StylesheetArchive_VersionedStyles(ProtobufMessage(_b)) }
-            if let _v { stylesFor132 = _v }
-        case 19:
-            var _v: TSS_StylesheetArchive_VersionedStyles?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSS_StylesheetArchive_VersionedStyles(ProtobufMessage(_b)) }
-            if let _v { stylesFor140 = _v }
-        case 20:
-            var _v: TSS_StylesheetArchive_VersionedStyles?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSS_StylesheetArchive_VersionedStyles(ProtobufMessage(_b)) }
-            if let _v { stylesFor141 = _v }
-        case 21:
-            var _v: TSS_StylesheetArchive_VersionedStyles?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSS_StylesheetArchive_VersionedStyles(ProtobufMessage(_b)) }
-            if let _v { stylesFor142 = _v }
-        case 22:
-            var _v: TSS_StylesheetArchive_VersionedStyles?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSS_StylesheetArchive_VersionedStyles(ProtobufMessage(_b)) }
-            if let _v { stylesFor144 = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in styles { _w.bytesField(1, _x.encoded()) }
-        for _x in identifierToStyleMap { _w.bytesField(2, _x.encoded()) }
-        if let _x = parent { _w.bytesField(3, _x.encoded()) }
-        if let _x = isLocked { _w.varintField(4, _x ? 1 : 0) }
-        for _x in parentToChildrenStyleMap { _w.bytesField(5, _x.encoded()) }
-        if let _x = canCullStyles { _w.varintField(6, _x ? 1 : 0) }
-        if let _x = stylesFor100 { _w.bytesField(7, _x.encoded()) }
-        if let _x = stylesFor101 { _w.bytesField(8, _x.encoded()) }
-        if let _x = stylesFor102 { _w.bytesField(9, _x.encoded()) }
-        if let _x = stylesFor110 { _w.bytesField(10, _x.encoded()) }
-        if let _x = stylesFor111 { _w.bytesField(11, _x.encoded()) }
-        if let _x = stylesFor112 { _w.bytesField(12, _x.encoded()) }
-        if let _x = stylesFor120 { _w.bytesField(13, _x.encoded()) }
-        if let _x = stylesFor121 { _w.bytesField(14, _x.encoded()) }
-        if let _x = stylesFor122 { _w.bytesField(15, _x.encoded()) }
-        if let _x = stylesFor130 { _w.bytesField(16, _x.encoded()) }
-        if let _x = stylesFor131 { _w.bytesField(17, _x.encoded()) }
-        if let _x = stylesFor132 { _w.bytesField(18, _x.encoded()) }
-        if let _x = stylesFor140 { _w.bytesField(19, _x.encoded()) }
-        if let _x = stylesFor141 { _w.bytesField(20, _x.encoded()) }
-        if let _x = stylesFor142 { _w.bytesField(21, _x.encoded()) }
-        if let _x = stylesFor144 { _w.bytesField(22, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var styles: [TSP_Reference] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(styles value: TSP_Reference) { append(value, toMessages: 0) }
+    var identifierToStyleMap: [TSS_StylesheetArchive_IdentifiedStyleEntry] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(identifierToStyleMap value: TSS_StylesheetArchive_IdentifiedStyleEntry) { append(value, toMessages: 1) }
+    var parent: TSP_Reference? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var isLocked: Bool? { get { self[3] } set { self[3] = newValue } }
+    var parentToChildrenStyleMap: [TSS_StylesheetArchive_StyleChildrenEntry] { get { self[messages: 4] } set { self[messages: 4] = newValue } }
+    func append(parentToChildrenStyleMap value: TSS_StylesheetArchive_StyleChildrenEntry) { append(value, toMessages: 4) }
+    var canCullStyles: Bool? { get { self[5] } set { self[5] = newValue } }
+    var stylesFor100: TSS_StylesheetArchive_VersionedStyles? { get { self[message: 6] } set { self[message: 6] = newValue } }
+    var stylesFor101: TSS_StylesheetArchive_VersionedStyles? { get { self[message: 7] } set { self[message: 7] = newValue } }
+    var stylesFor102: TSS_StylesheetArchive_VersionedStyles? { get { self[message: 8] } set { self[message: 8] = newValue } }
+    var stylesFor110: TSS_StylesheetArchive_VersionedStyles? { get { self[message: 9] } set { self[message: 9] = newValue } }
+    var stylesFor111: TSS_StylesheetArchive_VersionedStyles? { get { self[message: 10] } set { self[message: 10] = newValue } }
+    var stylesFor112: TSS_StylesheetArchive_VersionedStyles? { get { self[message: 11] } set { self[message: 11] = newValue } }
+    var stylesFor120: TSS_StylesheetArchive_VersionedStyles? { get { self[message: 12] } set { self[message: 12] = newValue } }
+    var stylesFor121: TSS_StylesheetArchive_VersionedStyles? { get { self[message: 13] } set { self[message: 13] = newValue } }
+    var stylesFor122: TSS_StylesheetArchive_VersionedStyles? { get { self[message: 14] } set { self[message: 14] = newValue } }
+    var stylesFor130: TSS_StylesheetArchive_VersionedStyles? { get { self[message: 15] } set { self[message: 15] = newValue } }
+    var stylesFor131: TSS_StylesheetArchive_VersionedStyles? { get { self[message: 16] } set { self[message: 16] = newValue } }
+    var stylesFor132: TSS_StylesheetArchive_VersionedStyles? { get { self[message: 17] } set { self[message: 17] = newValue } }
+    var stylesFor140: TSS_StylesheetArchive_VersionedStyles? { get { self[message: 18] } set { self[message: 18] = newValue } }
+    var stylesFor141: TSS_StylesheetArchive_VersionedStyles? { get { self[message: 19] } set { self[message: 19] = newValue } }
+    var stylesFor142: TSS_StylesheetArchive_VersionedStyles? { get { self[message: 20] } set { self[message: 20] = newValue } }
+    var stylesFor144: TSS_StylesheetArchive_VersionedStyles? { get { self[message: 21] } set { self[message: 21] = newValue } }
 }
 
 /// Generated wire model for `TSS.StylesheetArchive.IdentifiedStyleEntry`.
 final class TSS_StylesheetArchive_IdentifiedStyleEntry: IWAMessage {
-    var identifier: String?
-    var style: TSP_Reference?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSS.StylesheetArchive.IdentifiedStyleEntry", [
+        .optional(1, .string), .optional(2, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { identifier = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { style = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = identifier { _w.stringField(1, _x) }
-        if let _x = style { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var identifier: String? { get { self[0] } set { self[0] = newValue } }
+    var style: TSP_Reference? { get { self[message: 1] } set { self[message: 1] = newValue } }
 }
 
 /// Generated wire model for `TSS.StylesheetArchive.StyleChildrenEntry`.
 final class TSS_StylesheetArchive_StyleChildrenEntry: IWAMessage {
-    var parent: TSP_Reference?
-    var children: [TSP_Reference] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSS.StylesheetArchive.StyleChildrenEntry", [
+        .optional(1, TSP_Reference.self), .repeated(2, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { parent = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { children.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = parent { _w.bytesField(1, _x.encoded()) }
-        for _x in children { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var parent: TSP_Reference? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var children: [TSP_Reference] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(children value: TSP_Reference) { append(value, toMessages: 1) }
 }
 
 /// Generated wire model for `TSS.StylesheetArchive.VersionedStyles`.
 final class TSS_StylesheetArchive_VersionedStyles: IWAMessage {
-    var styles: [TSP_Reference] = []
-    var identifierToStyleMap: [TSS_StylesheetArchive_IdentifiedStyleEntry] = []
-    var parentToChildrenStyleMap: [TSS_StylesheetArchive_StyleChildrenEntry] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSS.StylesheetArchive.VersionedStyles", [
+        .repeated(1, TSP_Reference.self), .repeated(2, TSS_StylesheetArchive_IdentifiedStyleEntry.self),
+        .repeated(3, TSS_StylesheetArchive_StyleChildrenEntry.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { styles.append(_v) }
-        case 2:
-            var _v: TSS_StylesheetArchive_IdentifiedStyleEntry?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSS_StylesheetArchive_IdentifiedStyleEntry(ProtobufMessage(_b)) }
-            if let _v { identifierToStyleMap.append(_v) }
-        case 3:
-            var _v: TSS_StylesheetArchive_StyleChildrenEntry?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSS_StylesheetArchive_StyleChildrenEntry(ProtobufMessage(_b)) }
-            if let _v { parentToChildrenStyleMap.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in styles { _w.bytesField(1, _x.encoded()) }
-        for _x in identifierToStyleMap { _w.bytesField(2, _x.encoded()) }
-        for _x in parentToChildrenStyleMap { _w.bytesField(3, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var styles: [TSP_Reference] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(styles value: TSP_Reference) { append(value, toMessages: 0) }
+    var identifierToStyleMap: [TSS_StylesheetArchive_IdentifiedStyleEntry] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(identifierToStyleMap value: TSS_StylesheetArchive_IdentifiedStyleEntry) { append(value, toMessages: 1) }
+    var parentToChildrenStyleMap: [TSS_StylesheetArchive_StyleChildrenEntry] { get { self[messages: 2] } set { self[messages: 2] = newValue } }
+    func append(parentToChildrenStyleMap value: TSS_StylesheetArchive_StyleChildrenEntry) { append(value, toMessages: 2) }
 }
 
 /// Generated wire model for `TSS.ThemeArchive`.
 final class TSS_ThemeArchive: IWAMessage {
-    var legacyStylesheet: TSP_Reference?
-    var themeIdentifier: String?
-    var documentStylesheet: TSP_Reference?
-    var oldUuidsForPresetReplacements: [TSP_UUID] = []
-    var newUuidsForPresetReplacements: [TSP_UUID] = []
-    var colorPresets: [TSP_Color] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSS.ThemeArchive", [
+        .optional(1, TSP_Reference.self), .optional(3, .string), .optional(4, TSP_Reference.self),
+        .repeated(5, TSP_UUID.self), .repeated(6, TSP_UUID.self), .repeated(10, TSP_Color.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 6)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { legacyStylesheet = _v }
-        case 3:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { themeIdentifier = _v }
-        case 4:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { documentStylesheet = _v }
-        case 5:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { oldUuidsForPresetReplacements.append(_v) }
-        case 6:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { newUuidsForPresetReplacements.append(_v) }
-        case 10:
-            var _v: TSP_Color?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Color(ProtobufMessage(_b)) }
-            if let _v { colorPresets.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = legacyStylesheet { _w.bytesField(1, _x.encoded()) }
-        if let _x = themeIdentifier { _w.stringField(3, _x) }
-        if let _x = documentStylesheet { _w.bytesField(4, _x.encoded()) }
-        for _x in oldUuidsForPresetReplacements { _w.bytesField(5, _x.encoded()) }
-        for _x in newUuidsForPresetReplacements { _w.bytesField(6, _x.encoded()) }
-        for _x in colorPresets { _w.bytesField(10, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var legacyStylesheet: TSP_Reference? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var themeIdentifier: String? { get { self[1] } set { self[1] = newValue } }
+    var documentStylesheet: TSP_Reference? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var oldUuidsForPresetReplacements: [TSP_UUID] { get { self[messages: 3] } set { self[messages: 3] = newValue } }
+    func append(oldUuidsForPresetReplacements value: TSP_UUID) { append(value, toMessages: 3) }
+    var newUuidsForPresetReplacements: [TSP_UUID] { get { self[messages: 4] } set { self[messages: 4] = newValue } }
+    func append(newUuidsForPresetReplacements value: TSP_UUID) { append(value, toMessages: 4) }
+    var colorPresets: [TSP_Color] { get { self[messages: 5] } set { self[messages: 5] = newValue } }
+    func append(colorPresets value: TSP_Color) { append(value, toMessages: 5) }
 }
 
 /// Generated wire model for `TSS.ApplyThemeCommandArchive`.
 final class TSS_ApplyThemeCommandArchive: IWAMessage {
-    var `super`: TSK_CommandArchive?
-    var commands: [TSP_Reference] = []
-    var oldTheme: TSP_Reference?
-    var newTheme: TSP_Reference?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSS.ApplyThemeCommandArchive", [
+        .optional(1, TSK_CommandArchive.self), .repeated(2, TSP_Reference.self), .optional(3, TSP_Reference.self),
+        .optional(4, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSK_CommandArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_CommandArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { commands.append(_v) }
-        case 3:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { oldTheme = _v }
-        case 4:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { newTheme = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        for _x in commands { _w.bytesField(2, _x.encoded()) }
-        if let _x = oldTheme { _w.bytesField(3, _x.encoded()) }
-        if let _x = newTheme { _w.bytesField(4, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var `super`: TSK_CommandArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var commands: [TSP_Reference] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(commands value: TSP_Reference) { append(value, toMessages: 1) }
+    var oldTheme: TSP_Reference? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var newTheme: TSP_Reference? { get { self[message: 3] } set { self[message: 3] = newValue } }
 }
 
 /// Generated wire model for `TSS.ApplyThemeChildCommandArchive`.
 final class TSS_ApplyThemeChildCommandArchive: IWAMessage {
-    var `super`: TSK_CommandArchive?
-    var parent: TSP_Reference?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSS.ApplyThemeChildCommandArchive", [
+        .optional(1, TSK_CommandArchive.self), .optional(2, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSK_CommandArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_CommandArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { parent = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = parent { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var `super`: TSK_CommandArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var parent: TSP_Reference? { get { self[message: 1] } set { self[message: 1] = newValue } }
 }
 
 /// Generated wire model for `TSS.StyleUpdatePropertyMapCommandArchive`.
 final class TSS_StyleUpdatePropertyMapCommandArchive: IWAMessage {
-    var `super`: TSK_CommandArchive?
-    var currentStyle: TSP_Reference?
-    var styleWithOldPropertyMap: TSP_Reference?
-    var styleWithNewPropertyMap: TSP_Reference?
-    var styleDiff: TSP_Reference?
-    var notifyForStyleClients: Bool?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSS.StyleUpdatePropertyMapCommandArchive", [
+        .optional(1, TSK_CommandArchive.self), .optional(2, TSP_Reference.self), .optional(3, TSP_Reference.self),
+        .optional(4, TSP_Reference.self), .optional(7, TSP_Reference.self), .optional(6, .bool),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 6)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSK_CommandArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_CommandArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { currentStyle = _v }
-        case 3:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { styleWithOldPropertyMap = _v }
-        case 4:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { styleWithNewPropertyMap = _v }
-        case 7:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { styleDiff = _v }
-        case 6:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { notifyForStyleClients = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = currentStyle { _w.bytesField(2, _x.encoded()) }
-        if let _x = styleWithOldPropertyMap { _w.bytesField(3, _x.encoded()) }
-        if let _x = styleWithNewPropertyMap { _w.bytesField(4, _x.encoded()) }
-        if let _x = styleDiff { _w.bytesField(7, _x.encoded()) }
-        if let _x = notifyForStyleClients { _w.varintField(6, _x ? 1 : 0) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var `super`: TSK_CommandArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var currentStyle: TSP_Reference? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var styleWithOldPropertyMap: TSP_Reference? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var styleWithNewPropertyMap: TSP_Reference? { get { self[message: 3] } set { self[message: 3] = newValue } }
+    var styleDiff: TSP_Reference? { get { self[message: 4] } set { self[message: 4] = newValue } }
+    var notifyForStyleClients: Bool? { get { self[5] } set { self[5] = newValue } }
 }
 
 /// Generated wire model for `TSS.ThemeReplacePresetCommandArchive`.
 final class TSS_ThemeReplacePresetCommandArchive: IWAMessage {
-    var `super`: TSK_CommandArchive?
-    var preset: TSP_Reference?
-    var oldpreset: TSP_Reference?
-    var index: UInt32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSS.ThemeReplacePresetCommandArchive", [
+        .optional(1, TSK_CommandArchive.self), .optional(3, TSP_Reference.self), .optional(4, TSP_Reference.self),
+        .optional(5, .uint32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSK_CommandArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_CommandArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 3:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { preset = _v }
-        case 4:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { oldpreset = _v }
-        case 5:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { index = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = preset { _w.bytesField(3, _x.encoded()) }
-        if let _x = oldpreset { _w.bytesField(4, _x.encoded()) }
-        if let _x = index { _w.varintField(5, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var `super`: TSK_CommandArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var preset: TSP_Reference? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var oldpreset: TSP_Reference? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var index: UInt32? { get { self[3] } set { self[3] = newValue } }
 }
 
 /// Generated wire model for `TSS.ThemeReplaceColorPresetCommandArchive`.
 final class TSS_ThemeReplaceColorPresetCommandArchive: IWAMessage {
-    var `super`: TSK_CommandArchive?
-    var theme: TSP_Reference?
-    var color: TSP_Color?
-    var oldColor: TSP_Color?
-    var index: UInt32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSS.ThemeReplaceColorPresetCommandArchive", [
+        .optional(1, TSK_CommandArchive.self), .optional(2, TSP_Reference.self), .optional(3, TSP_Color.self),
+        .optional(4, TSP_Color.self), .optional(5, .uint32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 5)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSK_CommandArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_CommandArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { theme = _v }
-        case 3:
-            var _v: TSP_Color?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Color(ProtobufMessage(_b)) }
-            if let _v { color = _v }
-        case 4:
-            var _v: TSP_Color?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Color(ProtobufMessage(_b)) }
-            if let _v { oldColor = _v }
-        case 5:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { index = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = theme { _w.bytesField(2, _x.encoded()) }
-        if let _x = color { _w.bytesField(3, _x.encoded()) }
-        if let _x = oldColor { _w.bytesField(4, _x.encoded()) }
-        if let _x = index { _w.varintField(5, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var `super`: TSK_CommandArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var theme: TSP_Reference? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var color: TSP_Color? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var oldColor: TSP_Color? { get { self[message: 3] } set { self[message: 3] = newValue } }
+    var index: UInt32? { get { self[4] } set { self[4] = newValue } }
 }
 
 /// Generated wire model for `TSS.ThemeAddStylePresetCommandArchive`.
 final class TSS_ThemeAddStylePresetCommandArchive: IWAMessage {
-    var `super`: TSK_CommandArchive?
-    var theme: TSP_Reference?
-    var preset: TSP_Reference?
-    var presetKind: String?
-    var identifier: String?
-    var addPresetToStylesheet: Bool?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSS.ThemeAddStylePresetCommandArchive", [
+        .optional(1, TSK_CommandArchive.self), .optional(2, TSP_Reference.self), .optional(3, TSP_Reference.self),
+        .optional(4, .string), .optional(5, .string), .optional(6, .bool),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 6)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSK_CommandArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_CommandArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { theme = _v }
-        case 3:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { preset = _v }
-        case 4:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { presetKind = _v }
-        case 5:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { identifier = _v }
-        case 6:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { addPresetToStylesheet = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = theme { _w.bytesField(2, _x.encoded()) }
-        if let _x = preset { _w.bytesField(3, _x.encoded()) }
-        if let _x = presetKind { _w.stringField(4, _x) }
-        if let _x = identifier { _w.stringField(5, _x) }
-        if let _x = addPresetToStylesheet { _w.varintField(6, _x ? 1 : 0) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var `super`: TSK_CommandArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var theme: TSP_Reference? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var preset: TSP_Reference? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var presetKind: String? { get { self[3] } set { self[3] = newValue } }
+    var identifier: String? { get { self[4] } set { self[4] = newValue } }
+    var addPresetToStylesheet: Bool? { get { self[5] } set { self[5] = newValue } }
 }
 
 /// Generated wire model for `TSS.ThemeRemoveStylePresetCommandArchive`.
 final class TSS_ThemeRemoveStylePresetCommandArchive: IWAMessage {
-    var `super`: TSK_CommandArchive?
-    var theme: TSP_Reference?
-    var preset: TSP_Reference?
-    var presetIndex: UInt32?
-    var presetKind: String?
-    var identifier: String?
-    var replacementPreset: TSP_Reference?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSS.ThemeRemoveStylePresetCommandArchive", [
+        .optional(1, TSK_CommandArchive.self), .optional(2, TSP_Reference.self), .optional(3, TSP_Reference.self),
+        .optional(4, .uint32), .optional(5, .string), .optional(6, .string), .optional(7, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 7)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSK_CommandArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_CommandArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { theme = _v }
-        case 3:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { preset = _v }
-        case 4:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { presetIndex = _v }
-        case 5:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { presetKind = _v }
-        case 6:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { identifier = _v }
-        case 7:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { replacementPreset = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = theme { _w.bytesField(2, _x.encoded()) }
-        if let _x = preset { _w.bytesField(3, _x.encoded()) }
-        if let _x = presetIndex { _w.varintField(4, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = presetKind { _w.stringField(5, _x) }
-        if let _x = identifier { _w.stringField(6, _x) }
-        if let _x = replacementPreset { _w.bytesField(7, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var `super`: TSK_CommandArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var theme: TSP_Reference? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var preset: TSP_Reference? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var presetIndex: UInt32? { get { self[3] } set { self[3] = newValue } }
+    var presetKind: String? { get { self[4] } set { self[4] = newValue } }
+    var identifier: String? { get { self[5] } set { self[5] = newValue } }
+    var replacementPreset: TSP_Reference? { get { self[message: 6] } set { self[message: 6] = newValue } }
 }
 
 /// Generated wire model for `TSS.ThemeMovePresetCommandArchive`.
 final class TSS_ThemeMovePresetCommandArchive: IWAMessage {
-    var `super`: TSK_CommandArchive?
-    var theme: TSP_Reference?
-    var presetId: TSP_UUID?
-    var newIndex: UInt32?
-    var oldIndex: UInt32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSS.ThemeMovePresetCommandArchive", [
+        .optional(1, TSK_CommandArchive.self), .optional(2, TSP_Reference.self), .optional(3, TSP_UUID.self),
+        .optional(4, .uint32), .optional(5, .uint32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 5)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSK_CommandArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_CommandArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { theme = _v }
-        case 3:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { presetId = _v }
-        case 4:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { newIndex = _v }
-        case 5:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { oldIndex = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = theme { _w.bytesField(2, _x.encoded()) }
-        if let _x = presetId { _w.bytesField(3, _x.encoded()) }
-        if let _x = newIndex { _w.varintField(4, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = oldIndex { _w.varintField(5, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var `super`: TSK_CommandArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var theme: TSP_Reference? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var presetId: TSP_UUID? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var newIndex: UInt32? { get { self[3] } set { self[3] = newValue } }
+    var oldIndex: UInt32? { get { self[4] } set { self[4] = newValue } }
 }
 
 /// Generated wire model for `TSS.ThemeReplaceStylePresetAndDisconnectStylesCommandArchive`.
 final class TSS_ThemeReplaceStylePresetAndDisconnectStylesCommandArchive: IWAMessage {
-    var `super`: TSK_CommandArchive?
-    var preset: TSP_Reference?
-    var replacementPreset: TSP_Reference?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSS.ThemeReplaceStylePresetAndDisconnectStylesCommandArchive", [
+        .optional(1, TSK_CommandArchive.self), .optional(2, TSP_Reference.self), .optional(3, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSK_CommandArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_CommandArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { preset = _v }
-        case 3:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { replacementPreset = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = preset { _w.bytesField(2, _x.encoded()) }
-        if let _x = replacementPreset { _w.bytesField(3, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var `super`: TSK_CommandArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var preset: TSP_Reference? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var replacementPreset: TSP_Reference? { get { self[message: 2] } set { self[message: 2] = newValue } }
 }
 
 /// Generated wire model for `TSS.CommandPropertyEntryArchive`.
 final class TSS_CommandPropertyEntryArchive: IWAMessage {
-    var property: UInt32?
-    var type: Int32?
-    var integerValue: Int32?
-    var floatValue: Float?
-    var doubleValue: Double?
-    var stringValue: String?
-    var tspReference: TSP_Reference?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSS.CommandPropertyEntryArchive", [
+        .optional(1, .uint32), .optional(2, .int32), .optional(3, .int32), .optional(4, .float), .optional(5, .double),
+        .optional(6, .string), .optional(7, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 7)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { property = _v }
-        case 2:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { type = _v }
-        case 3:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { integerValue = _v }
-        case 4:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { floatValue = _v }
-        case 5:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { doubleValue = _v }
-        case 6:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { stringValue = _v }
-        case 7:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { tspReference = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = property { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = type { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = integerValue { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = floatValue { _w.fixed32Field(4, _x.bitPattern) }
-        if let _x = doubleValue { _w.fixed64Field(5, _x.bitPattern) }
-        if let _x = stringValue { _w.stringField(6, _x) }
-        if let _x = tspReference { _w.bytesField(7, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var property: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var type: Int32? { get { self[1] } set { self[1] = newValue } }
+    var integerValue: Int32? { get { self[2] } set { self[2] = newValue } }
+    var floatValue: Float? { get { self[3] } set { self[3] = newValue } }
+    var doubleValue: Double? { get { self[4] } set { self[4] = newValue } }
+    var stringValue: String? { get { self[5] } set { self[5] = newValue } }
+    var tspReference: TSP_Reference? { get { self[message: 6] } set { self[message: 6] = newValue } }
 }
 
 /// Generated wire model for `TSS.CommandPropertyMapArchive`.
 final class TSS_CommandPropertyMapArchive: IWAMessage {
-    var propertyEntries: [TSS_CommandPropertyEntryArchive] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSS.CommandPropertyMapArchive", [
+        .repeated(1, TSS_CommandPropertyEntryArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSS_CommandPropertyEntryArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSS_CommandPropertyEntryArchive(ProtobufMessage(_b)) }
-            if let _v { propertyEntries.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in propertyEntries { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var propertyEntries: [TSS_CommandPropertyEntryArchive] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(propertyEntries value: TSS_CommandPropertyEntryArchive) { append(value, toMessages: 0) }
 }
 
 /// Registers this file's archives into the reflective catalog.
-func registerIWA_TSSArchives(_ into: inout [(name: String, decode: (ProtobufMessage) -> IWAMessage)]) {
-    into.append(("TSS.StyleArchive", { TSS_StyleArchive($0) as IWAMessage }))
-    into.append(("TSS.StylesheetArchive", { TSS_StylesheetArchive($0) as IWAMessage }))
-    into.append(("TSS.StylesheetArchive.IdentifiedStyleEntry", { TSS_StylesheetArchive_IdentifiedStyleEntry($0) as IWAMessage }))
-    into.append(("TSS.StylesheetArchive.StyleChildrenEntry", { TSS_StylesheetArchive_StyleChildrenEntry($0) as IWAMessage }))
-    into.append(("TSS.StylesheetArchive.VersionedStyles", { TSS_StylesheetArchive_VersionedStyles($0) as IWAMessage }))
-    into.append(("TSS.ThemeArchive", { TSS_ThemeArchive($0) as IWAMessage }))
-    into.append(("TSS.ApplyThemeCommandArchive", { TSS_ApplyThemeCommandArchive($0) as IWAMessage }))
-    into.append(("TSS.ApplyThemeChildCommandArchive", { TSS_ApplyThemeChildCommandArchive($0) as IWAMessage }))
-    into.append(("TSS.StyleUpdatePropertyMapCommandArchive", { TSS_StyleUpdatePropertyMapCommandArchive($0) as IWAMessage }))
-    into.append(("TSS.ThemeReplacePresetCommandArchive", { TSS_ThemeReplacePresetCommandArchive($0) as IWAMessage }))
-    into.append(("TSS.ThemeReplaceColorPresetCommandArchive", { TSS_ThemeReplaceColorPresetCommandArchive($0) as IWAMessage }))
-    into.append(("TSS.ThemeAddStylePresetCommandArchive", { TSS_ThemeAddStylePresetCommandArchive($0) as IWAMessage }))
-    into.append(("TSS.ThemeRemoveStylePresetCommandArchive", { TSS_ThemeRemoveStylePresetCommandArchive($0) as IWAMessage }))
-    into.append(("TSS.ThemeMovePresetCommandArchive", { TSS_ThemeMovePresetCommandArchive($0) as IWAMessage }))
-    into.append(("TSS.ThemeReplaceStylePresetAndDisconnectStylesCommandArchive", { TSS_ThemeReplaceStylePresetAndDisconnectStylesCommandArchive($0) as IWAMessage }))
-    into.append(("TSS.CommandPropertyEntryArchive", { TSS_CommandPropertyEntryArchive($0) as IWAMessage }))
-    into.append(("TSS.CommandPropertyMapArchive", { TSS_CommandPropertyMapArchive($0) as IWAMessage }))
+func registerIWA_TSSArchives(_ into: inout [any IWAMessage.Type]) {
+    into += [
+        TSS_StyleArchive.self, TSS_StylesheetArchive.self, TSS_StylesheetArchive_IdentifiedStyleEntry.self,
+        TSS_StylesheetArchive_StyleChildrenEntry.self, TSS_StylesheetArchive_VersionedStyles.self,
+        TSS_ThemeArchive.self, TSS_ApplyThemeCommandArchive.self, TSS_ApplyThemeChildCommandArchive.self,
+        TSS_StyleUpdatePropertyMapCommandArchive.self, TSS_ThemeReplacePresetCommandArchive.self,
+        TSS_ThemeReplaceColorPresetCommandArchive.self, TSS_ThemeAddStylePresetCommandArchive.self,
+        TSS_ThemeRemoveStylePresetCommandArchive.self, TSS_ThemeMovePresetCommandArchive.self,
+        TSS_ThemeReplaceStylePresetAndDisconnectStylesCommandArchive.self, TSS_CommandPropertyEntryArchive.self,
+        TSS_CommandPropertyMapArchive.self,
+    ]
 }
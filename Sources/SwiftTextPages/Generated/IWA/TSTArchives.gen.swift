@@ -5,8400 +5,2978 @@ import SwiftTextIWA
 
 /// Generated wire model for `TST.CellID`.
 final class TST_CellID: IWAMessage {
-    var packeddata: UInt32?
-    var expandedCoord: TSCE_CellCoordinateArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .fixed32(let _b) = _f.value { _v = IWAWire.u32(_b) }
-            if let _v { packeddata = _v }
-        case 2:
-            var _v: TSCE_CellCoordinateArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CellCoordinateArchive(ProtobufMessage(_b)) }
-            if let _v { expandedCoord = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = packeddata { _w.fixed32Field(1, _x) }
-        if let _x = expandedCoord { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.CellID", [
+        .optional(1, .fixed32), .optional(2, TSCE_CellCoordinateArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var packeddata: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var expandedCoord: TSCE_CellCoordinateArchive? { get { self[message: 1] } set { self[message: 1] = newValue } }
 }
 
 /// Generated wire model for `TST.CellUIDLookupListArchive`.
 final class TST_CellUIDLookupListArchive: IWAMessage {
-    var columnUids: TSCE_UidLookupListArchive?
-    var rowUids: TSCE_UidLookupListArchive?
-    var columnIndexes: [Int32] = []
-    var rowIndexes: [Int32] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSCE_UidLookupListArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_UidLookupListArchive(ProtobufMessage(_b)) }
-            if let _v { columnUids = _v }
-        case 2:
-            var _v: TSCE_UidLookupListArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_UidLookupListArchive(ProtobufMessage(_b)) }
-            if let _v { rowUids = _v }
-        case 3:
-            if case .varint(let _u) = _f.value { columnIndexes.append(Int32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { columnIndexes.append(Int32(truncatingIfNeeded: _u)) } }
-        case 4:
-            if case .varint(let _u) = _f.value { rowIndexes.append(Int32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { rowIndexes.append(Int32(truncatingIfNeeded: _u)) } }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = columnUids { _w.bytesField(1, _x.encoded()) }
-        if let _x = rowUids { _w.bytesField(2, _x.encoded()) }
-        for _x in columnIndexes { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        for _x in rowIndexes { _w.varintField(4, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.CellUIDLookupListArchive", [
+        .optional(1, TSCE_UidLookupListArchive.self), .optional(2, TSCE_UidLookupListArchive.self),
+        .repeated(3, .int32), .repeated(4, .int32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var columnUids: TSCE_UidLookupListArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var rowUids: TSCE_UidLookupListArchive? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var columnIndexes: [Int32] { get { self[all: 2] } set { self[all: 2] = newValue } }
+    func append(columnIndexes value: Int32) { append(value, toAll: 2) }
+    var rowIndexes: [Int32] { get { self[all: 3] } set { self[all: 3] = newValue } }
+    func append(rowIndexes value: Int32) { append(value, toAll: 3) }
 }
 
 /// Generated wire model for `TST.CellUIDListArchive`.
 final class TST_CellUIDListArchive: IWAMessage {
-    var rowUids: [TSP_UUID] = []
-    var columnUids: [TSP_UUID] = []
-    var compressedRowIndexes: [Int32] = []
-    var compressedColumnIndexes: [Int32] = []
-    var uncompressedLookupList: TST_CellUIDLookupListArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { rowUids.append(_v) }
-        case 2:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { columnUids.append(_v) }
-        case 3:
-            if case .varint(let _u) = _f.value { compressedRowIndexes.append(Int32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { compressedRowIndexes.append(Int32(truncatingIfNeeded: _u)) } }
-        case 4:
-            if case .varint(let _u) = _f.value { compressedColumnIndexes.append(Int32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { compressedColumnIndexes.append(Int32(truncatingIfNeeded: _u)) } }
-        case 5:
-            var _v: TST_CellUIDLookupListArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_CellUIDLookupListArchive(ProtobufMessage(_b)) }
-            if let _v { uncompressedLookupList = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in rowUids { _w.bytesField(1, _x.encoded()) }
-        for _x in columnUids { _w.bytesField(2, _x.encoded()) }
-        for _x in compressedRowIndexes { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        for _x in compressedColumnIndexes { _w.varintField(4, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = uncompressedLookupList { _w.bytesField(5, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.CellUIDListArchive", [
+        .repeated(1, TSP_UUID.self), .repeated(2, TSP_UUID.self), .repeated(3, .int32), .repeated(4, .int32),
+        .optional(5, TST_CellUIDLookupListArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 5)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var rowUids: [TSP_UUID] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(rowUids value: TSP_UUID) { append(value, toMessages: 0) }
+    var columnUids: [TSP_UUID] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(columnUids value: TSP_UUID) { append(value, toMessages: 1) }
+    var compressedRowIndexes: [Int32] { get { self[all: 2] } set { self[all: 2] = newValue } }
+    func append(compressedRowIndexes value: Int32) { append(value, toAll: 2) }
+    var compressedColumnIndexes: [Int32] { get { self[all: 3] } set { self[all: 3] = newValue } }
+    func append(compressedColumnIndexes value: Int32) { append(value, toAll: 3) }
+    var uncompressedLookupList: TST_CellUIDLookupListArchive? { get { self[message: 4] } set { self[message: 4] = newValue } }
 }
 
 /// Generated wire model for `TST.TableSize`.
 final class TST_TableSize: IWAMessage {
-    var packeddata: UInt32?
-    var numColumns: UInt32?
-    var numRows: UInt32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .fixed32(let _b) = _f.value { _v = IWAWire.u32(_b) }
-            if let _v { packeddata = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { numColumns = _v }
-        case 3:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { numRows = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = packeddata { _w.fixed32Field(1, _x) }
-        if let _x = numColumns { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = numRows { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.TableSize", [
+        .optional(1, .fixed32), .optional(2, .uint32), .optional(3, .uint32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var packeddata: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var numColumns: UInt32? { get { self[1] } set { self[1] = newValue } }
+    var numRows: UInt32? { get { self[2] } set { self[2] = newValue } }
 }
 
 /// Generated wire model for `TST.ExpandedTableSize`.
 final class TST_ExpandedTableSize: IWAMessage {
-    var numColumns: UInt32?
-    var numRows: UInt32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { numColumns = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { numRows = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = numColumns { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = numRows { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.ExpandedTableSize", [
+        .optional(1, .uint32), .optional(2, .uint32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var numColumns: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var numRows: UInt32? { get { self[1] } set { self[1] = newValue } }
 }
 
 /// Generated wire model for `TST.CellRange`.
 final class TST_CellRange: IWAMessage {
-    var origin: TST_CellID?
-    var size: TST_TableSize?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TST_CellID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_CellID(ProtobufMessage(_b)) }
-            if let _v { origin = _v }
-        case 2:
-            var _v: TST_TableSize?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_TableSize(ProtobufMessage(_b)) }
-            if let _v { size = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = origin { _w.bytesField(1, _x.encoded()) }
-        if let _x = size { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.CellRange", [
+        .optional(1, TST_CellID.self), .optional(2, TST_TableSize.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var origin: TST_CellID? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var size: TST_TableSize? { get { self[message: 1] } set { self[message: 1] = newValue } }
 }
 
 /// Generated wire model for `TST.ExpandedCellRange`.
 final class TST_ExpandedCellRange: IWAMessage {
-    var origin: TSCE_CellCoordinateArchive?
-    var size: TST_ExpandedTableSize?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSCE_CellCoordinateArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CellCoordinateArchive(ProtobufMessage(_b)) }
-            if let _v { origin = _v }
-        case 2:
-            var _v: TST_ExpandedTableSize?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_ExpandedTableSize(ProtobufMessage(_b)) }
-            if let _v { size = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = origin { _w.bytesField(1, _x.encoded()) }
-        if let _x = size { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.ExpandedCellRange", [
+        .optional(1, TSCE_CellCoordinateArchive.self), .optional(2, TST_ExpandedTableSize.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var origin: TSCE_CellCoordinateArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var size: TST_ExpandedTableSize? { get { self[message: 1] } set { self[message: 1] = newValue } }
 }
 
 /// Generated wire model for `TST.TableSelection`.
 final class TST_TableSelection: IWAMessage {
-    var cellrange: TST_CellRange?
-    var extendedcellrange: TST_CellRange?
-    var extendedcellrangevalid: Bool?
-    var selectionType: Int32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TST_CellRange?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_CellRange(ProtobufMessage(_b)) }
-            if let _v { cellrange = _v }
-        case 2:
-            var _v: TST_CellRange?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_CellRange(ProtobufMessage(_b)) }
-            if let _v { extendedcellrange = _v }
-        case 3:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { extendedcellrangevalid = _v }
-        case 4:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { selectionType = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = cellrange { _w.bytesField(1, _x.encoded()) }
-        if let _x = extendedcellrange { _w.bytesField(2, _x.encoded()) }
-        if let _x = extendedcellrangevalid { _w.varintField(3, _x ? 1 : 0) }
-        if let _x = selectionType { _w.varintField(4, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.TableSelection", [
+        .optional(1, TST_CellRange.self), .optional(2, TST_CellRange.self), .optional(3, .bool), .optional(4, .int32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var cellrange: TST_CellRange? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var extendedcellrange: TST_CellRange? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var extendedcellrangevalid: Bool? { get { self[2] } set { self[2] = newValue } }
+    var selectionType: Int32? { get { self[3] } set { self[3] = newValue } }
 }
 
 /// Generated wire model for `TST.TileRowInfo`.
 final class TST_TileRowInfo: IWAMessage {
-    var tileRowIndex: UInt32?
-    var cellCount: UInt32?
-    var cellStorageBufferPreBnc: [UInt8]?
-    var cellOffsetsPreBnc: [UInt8]?
-    var storageVersion: UInt32?
-    var cellStorageBuffer: [UInt8]?
-    var cellOffsets: [UInt8]?
-    var hasWideOffsets: Bool?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { tileRowIndex = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { cellCount = _v }
-        case 3:
-            var _v: [UInt8]?
-            if case .lengthDelimited(let _b) = _f.value { _v = _b }
-            if let _v { cellStorageBufferPreBnc = _v }
-        case 4:
-            var _v: [UInt8]?
-            if case .lengthDelimited(let _b) = _f.value { _v = _b }
-            if let _v { cellOffsetsPreBnc = _v }
-        case 5:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { storageVersion = _v }
-        case 6:
-            var _v: [UInt8]?
-            if case .lengthDelimited(let _b) = _f.value { _v = _b }
-            if let _v { cellStorageBuffer = _v }
-        case 7:
-            var _v: [UInt8]?
-            if case .lengthDelimited(let _b) = _f.value { _v = _b }
-            if let _v { cellOffsets = _v }
-        case 8:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { hasWideOffsets = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = tileRowIndex { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = cellCount { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = cellStorageBufferPreBnc { _w.bytesField(3, _x) }
-        if let _x = cellOffsetsPreBnc { _w.bytesField(4, _x) }
-        if let _x = storageVersion { _w.varintField(5, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = cellStorageBuffer { _w.bytesField(6, _x) }
-        if let _x = cellOffsets { _w.bytesField(7, _x) }
-        if let _x = hasWideOffsets { _w.varintField(8, _x ? 1 : 0) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.TileRowInfo", [
+        .optional(1, .uint32), .optional(2, .uint32), .optional(3, .bytes), .optional(4, .bytes), .optional(5, .uint32),
+        .optional(6, .bytes), .optional(7, .bytes), .optional(8, .bool),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 8)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var tileRowIndex: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var cellCount: UInt32? { get { self[1] } set { self[1] = newValue } }
+    var cellStorageBufferPreBnc: [UInt8]? { get { self[2] } set { self[2] = newValue } }
+    var cellOffsetsPreBnc: [UInt8]? { get { self[3] } set { self[3] = newValue } }
+    var storageVersion: UInt32? { get { self[4] } set { self[4] = newValue } }
+    var cellStorageBuffer: [UInt8]? { get { self[5] } set { self[5] = newValue } }
+    var cellOffsets: [UInt8]? { get { self[6] } set { self[6] = newValue } }
+    var hasWideOffsets: Bool? { get { self[7] } set { self[7] = newValue } }
 }
 
 /// Generated wire model for `TST.Tile`.
 final class TST_Tile: IWAMessage {
-    var maxcolumn: UInt32?
-    var maxrow: UInt32?
-    var numcells: UInt32?
-    var numrows: UInt32?
-    var rowinfos: [TST_TileRowInfo] = []
-    var storageVersion: UInt32?
-    var lastSavedInBNC: Bool?
-    var shouldUseWideRows: Bool?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { maxcolumn = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { maxrow = _v }
-        case 3:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { numcells = _v }
-        case 4:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { numrows = _v }
-        case 5:
-            var _v: TST_TileRowInfo?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_TileRowInfo(ProtobufMessage(_b)) }
-            if let _v { rowinfos.append(_v) }
-        case 6:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { storageVersion = _v }
-        case 7:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { lastSavedInBNC = _v }
-        case 8:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { shouldUseWideRows = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = maxcolumn { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = maxrow { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = numcells { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = numrows { _w.varintField(4, UInt64(truncatingIfNeeded: _x)) }
-        for _x in rowinfos { _w.bytesField(5, _x.encoded()) }
-        if let _x = storageVersion { _w.varintField(6, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = lastSavedInBNC { _w.varintField(7, _x ? 1 : 0) }
-        if let _x = shouldUseWideRows { _w.varintField(8, _x ? 1 : 0) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.Tile", [
+        .optional(1, .uint32), .optional(2, .uint32), .optional(3, .uint32), .optional(4, .uint32),
+        .repeated(5, TST_TileRowInfo.self), .optional(6, .uint32), .optional(7, .bool), .optional(8, .bool),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 8)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var maxcolumn: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var maxrow: UInt32? { get { self[1] } set { self[1] = newValue } }
+    var numcells: UInt32? { get { self[2] } set { self[2] = newValue } }
+    var numrows: UInt32? { get { self[3] } set { self[3] = newValue } }
+    var rowinfos: [TST_TileRowInfo] { get { self[messages: 4] } set { self[messages: 4] = newValue } }
+    func append(rowinfos value: TST_TileRowInfo) { append(value, toMessages: 4) }
+    var storageVersion: UInt32? { get { self[5] } set { self[5] = newValue } }
+    var lastSavedInBNC: Bool? { get { self[6] } set { self[6] = newValue } }
+    var shouldUseWideRows: Bool? { get { self[7] } set { self[7] = newValue } }
 }
 
 /// Generated wire model for `TST.TileStorage`.
 final class TST_TileStorage: IWAMessage {
-    var tiles: [TST_TileStorage_Tile] = []
-    var tileSize: UInt32?
-    var shouldUseWideRows: Bool?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TST_TileStorage_Tile?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_TileStorage_Tile(ProtobufMessage(_b)) }
-            if let _v { tiles.append(_v) }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { tileSize = _v }
-        case 3:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { shouldUseWideRows = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in tiles { _w.bytesField(1, _x.encoded()) }
-        if let _x = tileSize { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = shouldUseWideRows { _w.varintField(3, _x ? 1 : 0) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.TileStorage", [
+        .repeated(1, TST_TileStorage_Tile.self), .optional(2, .uint32), .optional(3, .bool),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var tiles: [TST_TileStorage_Tile] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(tiles value: TST_TileStorage_Tile) { append(value, toMessages: 0) }
+    var tileSize: UInt32? { get { self[1] } set { self[1] = newValue } }
+    var shouldUseWideRows: Bool? { get { self[2] } set { self[2] = newValue } }
 }
 
 /// Generated wire model for `TST.TileStorage.Tile`.
 final class TST_TileStorage_Tile: IWAMessage {
-    var tileid: UInt32?
-    var tile: TSP_Reference?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { tileid = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { tile = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = tileid { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = tile { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.TileStorage.Tile", [
+        .optional(1, .uint32), .optional(2, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var tileid: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var tile: TSP_Reference? { get { self[message: 1] } set { self[message: 1] = newValue } }
 }
 
 /// Generated wire model for `TST.PopUpMenuModel`.
 final class TST_PopUpMenuModel: IWAMessage {
-    var item: [TST_PopUpMenuModel_CellValue] = []
-    var tsceItem: [TSCE_CellValueArchive] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TST_PopUpMenuModel_CellValue?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_PopUpMenuModel_CellValue(ProtobufMessage(_b)) }
-            if let _v { item.append(_v) }
-        case 2:
-            var _v: TSCE_CellValueArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CellValueArchive(ProtobufMessage(_b)) }
-            if let _v { tsceItem.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in item { _w.bytesField(1, _x.encoded()) }
-        for _x in tsceItem { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.PopUpMenuModel", [
+        .repeated(1, TST_PopUpMenuModel_CellValue.self), .repeated(2, TSCE_CellValueArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var item: [TST_PopUpMenuModel_CellValue] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(item value: TST_PopUpMenuModel_CellValue) { append(value, toMessages: 0) }
+    var tsceItem: [TSCE_CellValueArchive] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(tsceItem value: TSCE_CellValueArchive) { append(value, toMessages: 1) }
 }
 
 /// Generated wire model for `TST.PopUpMenuModel.CellValue`.
 final class TST_PopUpMenuModel_CellValue: IWAMessage {
-    var cellValueType: Int32?
-    var booleanValue: TSCE_BooleanCellValueArchive?
-    var dateValue: TSCE_DateCellValueArchive?
-    var numberValue: TSCE_NumberCellValueArchive?
-    var stringValue: TSCE_StringCellValueArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { cellValueType = _v }
-        case 2:
-            var _v: TSCE_BooleanCellValueArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_BooleanCellValueArchive(ProtobufMessage(_b)) }
-            if let _v { booleanValue = _v }
-        case 3:
-            var _v: TSCE_DateCellValueArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_DateCellValueArchive(ProtobufMessage(_b)) }
-            if let _v { dateValue = _v }
-        case 4:
-            var _v: TSCE_NumberCellValueArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_NumberCellValueArchive(ProtobufMessage(_b)) }
-            if let _v { numberValue = _v }
-        case 5:
-            var _v: TSCE_StringCellValueArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_StringCellValueArchive(ProtobufMessage(_b)) }
-            if let _v { stringValue = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = cellValueType { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = booleanValue { _w.bytesField(2, _x.encoded()) }
-        if let _x = dateValue { _w.bytesField(3, _x.encoded()) }
-        if let _x = numberValue { _w.bytesField(4, _x.encoded()) }
-        if let _x = stringValue { _w.bytesField(5, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.PopUpMenuModel.CellValue", [
+        .optional(1, .int32), .optional(2, TSCE_BooleanCellValueArchive.self),
+        .optional(3, TSCE_DateCellValueArchive.self), .optional(4, TSCE_NumberCellValueArchive.self),
+        .optional(5, TSCE_StringCellValueArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 5)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var cellValueType: Int32? { get { self[0] } set { self[0] = newValue } }
+    var booleanValue: TSCE_BooleanCellValueArchive? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var dateValue: TSCE_DateCellValueArchive? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var numberValue: TSCE_NumberCellValueArchive? { get { self[message: 3] } set { self[message: 3] = newValue } }
+    var stringValue: TSCE_StringCellValueArchive? { get { self[message: 4] } set { self[message: 4] = newValue } }
 }
 
 /// Generated wire model for `TST.ImportWarningSetArchive`.
 final class TST_ImportWarningSetArchive: IWAMessage {
-    var formulaImportWarning: TST_ImportWarningSetArchive_FormulaImportWarning?
-    var condFormatAboveAvgEqualAvg: Bool?
-    var condFormatAboveAvgStdDev: Bool?
-    var condFormatComplexFormula: Bool?
-    var condFormatContainsErrors: Bool?
-    var condFormatExpr: Bool?
-    var condFormatNotContainsErrors: Bool?
-    var condFormatParametersNotAllSameType: Bool?
-    var condFormatStopIfTrue: Bool?
-    var condFormatUnsupportedOperator: Bool?
-    var condFormatUnsupportedStyling: Bool?
-    var condFormatUnsupportedTimePeriod: Bool?
-    var errorCellWithNoFormula: Bool?
-    var unsupportedCondFormat: Bool?
-    var originalDataFormat: String?
-    var formulaWarningFilteredColumnFormulaNotCopied: Bool?
-    var durationFormatRangeChanged: Bool?
-    var sortedWarnings: [TSCE_WarningArchive] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TST_ImportWarningSetArchive_FormulaImportWarning?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_ImportWarningSetArchive_FormulaImportWarning(ProtobufMessage(_b)) }
-            if let _v { formulaImportWarning = _v }
-        case 2:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { condFormatAboveAvgEqualAvg = _v }
-        case 3:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { condFormatAboveAvgStdDev = _v }
-        case 4:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { condFormatComplexFormula = _v }
-        case 5:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { condFormatContainsErrors = _v }
-        case 6:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { condFormatExpr = _v }
-        case 7:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { condFormatNotContainsErrors = _v }
-        case 8:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { condFormatParametersNotAllSameType = _v }
-        case 9:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { condFormatStopIfTrue = _v }
-        case 10:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { condFormatUnsupportedOperator = _v }
-        case 11:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { condFormatUnsupportedStyling = _v }
-        case 12:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { condFormatUnsupportedTimePeriod = _v }
-        case 13:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { errorCellWithNoFormula = _v }
-        case 14:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { unsupportedCondFormat = _v }
-        case 15:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { originalDataFormat = _v }
-        case 16:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { formulaWarningFilteredColumnFormulaNotCopied = _v }
-        case 17:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { durationFormatRangeChanged = _v }
-        case 18:
-            var _v: TSCE_WarningArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_WarningArchive(ProtobufMessage(_b)) }
-            if let _v { sortedWarnings.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = formulaImportWarning { _w.bytesField(1, _x.encoded()) }
-        if let _x = condFormatAboveAvgEqualAvg { _w.varintField(2, _x ? 1 : 0) }
-        if let _x = condFormatAboveAvgStdDev { _w.varintField(3, _x ? 1 : 0) }
-        if let _x = condFormatComplexFormula { _w.varintField(4, _x ? 1 : 0) }
-        if let _x = condFormatContainsErrors { _w.varintField(5, _x ? 1 : 0) }
-        if let _x = condFormatExpr { _w.varintField(6, _x ? 1 : 0) }
-        if let _x = condFormatNotContainsErrors { _w.varintField(7, _x ? 1 : 0) }
-        if let _x = condFormatParametersNotAllSameType { _w.varintField(8, _x ? 1 : 0) }
-        if let _x = condFormatStopIfTrue { _w.varintField(9, _x ? 1 : 0) }
-        if let _x = condFormatUnsupportedOperator { _w.varintField(10, _x ? 1 : 0) }
-        if let _x = condFormatUnsupportedStyling { _w.varintField(11, _x ? 1 : 0) }
-        if let _x = condFormatUnsupportedTimePeriod { _w.varintField(12, _x ? 1 : 0) }
-        if let _x = errorCellWithNoFormula { _w.varintField(13, _x ? 1 : 0) }
-        if let _x = unsupportedCondFormat { _w.varintField(14, _x ? 1 : 0) }
-        if let _x = originalDataFormat { _w.stringField(15, _x) }
-        if let _x = formulaWarningFilteredColumnFormulaNotCopied { _w.varintField(16, _x ? 1 : 0) }
-        if let _x = durationFormatRangeChanged { _w.varintField(17, _x ? 1 : 0) }
-        for _x in sortedWarnings { _w.bytesField(18, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.ImportWarningSetArchive", [
+        .optional(1, TST_ImportWarningSetArchive_FormulaImportWarning.self), .optional(2, .bool), .optional(3, .bool),
+        .optional(4, .bool), .optional(5, .bool), .optional(6, .bool), .optional(7, .bool), .optional(8, .bool),
+        .optional(9, .bool), .optional(10, .bool), .optional(11, .bool), .optional(12, .bool), .optional(13, .bool),
+        .optional(14, .bool), .optional(15, .string), .optional(16, .bool), .optional(17, .bool),
+        .repeated(18, TSCE_WarningArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 18)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var formulaImportWarning: TST_ImportWarningSetArchive_FormulaImportWarning? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var condFormatAboveAvgEqualAvg: Bool? { get { self[1] } set { self[1] = newValue } }
+    var condFormatAboveAvgStdDev: Bool? { get { self[2] } set { self[2] = newValue } }
+    var condFormatComplexFormula: Bool? { get { self[3] } set { self[3] = newValue } }
+    var condFormatContainsErrors: Bool? { get { self[4] } set { self[4] = newValue } }
+    var condFormatExpr: Bool? { get { self[5] } set { self[5] = newValue } }
+    var condFormatNotContainsErrors: Bool? { get { self[6] } set { self[6] = newValue } }
+    var condFormatParametersNotAllSameType: Bool? { get { self[7] } set { self[7] = newValue } }
+    var condFormatStopIfTrue: Bool? { get { self[8] } set { self[8] = newValue } }
+    var condFormatUnsupportedOperator: Bool? { get { self[9] } set { self[9] = newValue } }
+    var condFormatUnsupportedStyling: Bool? { get { self[10] } set { self[10] = newValue } }
+    var condFormatUnsupportedTimePeriod: Bool? { get { self[11] } set { self[11] = newValue } }
+    var errorCellWithNoFormula: Bool? { get { self[12] } set { self[12] = newValue } }
+    var unsupportedCondFormat: Bool? { get { self[13] } set { self[13] = newValue } }
+    var originalDataFormat: String? { get { self[14] } set { self[14] = newValue } }
+    var formulaWarningFilteredColumnFormulaNotCopied: Bool? { get { self[15] } set { self[15] = newValue } }
+    var durationFormatRangeChanged: Bool? { get { self[16] } set { self[16] = newValue } }
+    var sortedWarnings: [TSCE_WarningArchive] { get { self[messages: 17] } set { self[messages: 17] = newValue } }
+    func append(sortedWarnings value: TSCE_WarningArchive) { append(value, toMessages: 17) }
 }
 
 /// Generated wire model for `TST.ImportWarningSetArchive.FormulaImportWarning`.
 final class TST_ImportWarningSetArchive_FormulaImportWarning: IWAMessage {
-    var formulaWarningType: Int32?
-    var originalFormula: String?
-    var supplementaryText: String?
-    var formulaWarningTypeInt: Int32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { formulaWarningType = _v }
-        case 2:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { originalFormula = _v }
-        case 3:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { supplementaryText = _v }
-        case 4:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { formulaWarningTypeInt = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = formulaWarningType { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = originalFormula { _w.stringField(2, _x) }
-        if let _x = supplementaryText { _w.stringField(3, _x) }
-        if let _x = formulaWarningTypeInt { _w.varintField(4, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.ImportWarningSetArchive.FormulaImportWarning", [
+        .optional(1, .int32), .optional(2, .string), .optional(3, .string), .optional(4, .int32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var formulaWarningType: Int32? { get { self[0] } set { self[0] = newValue } }
+    var originalFormula: String? { get { self[1] } set { self[1] = newValue } }
+    var supplementaryText: String? { get { self[2] } set { self[2] = newValue } }
+    var formulaWarningTypeInt: Int32? { get { self[3] } set { self[3] = newValue } }
 }
 
 /// Generated wire model for `TST.CellRefImportWarningSetPairArchive`.
 final class TST_CellRefImportWarningSetPairArchive: IWAMessage {
-    var cellRef: TSCE_CellReferenceArchive?
-    var warningSet: TST_ImportWarningSetArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSCE_CellReferenceArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CellReferenceArchive(ProtobufMessage(_b)) }
-            if let _v { cellRef = _v }
-        case 3:
-            var _v: TST_ImportWarningSetArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_ImportWarningSetArchive(ProtobufMessage(_b)) }
-            if let _v { warningSet = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = cellRef { _w.bytesField(1, _x.encoded()) }
-        if let _x = warningSet { _w.bytesField(3, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.CellRefImportWarningSetPairArchive", [
+        .optional(1, TSCE_CellReferenceArchive.self), .optional(3, TST_ImportWarningSetArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var cellRef: TSCE_CellReferenceArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var warningSet: TST_ImportWarningSetArchive? { get { self[message: 1] } set { self[message: 1] = newValue } }
 }
 
 /// Generated wire model for `TST.ImportWarningSetByCellRefArchive`.
 final class TST_ImportWarningSetByCellRefArchive: IWAMessage {
-    var cellrefWarningSetPair: [TST_CellRefImportWarningSetPairArchive] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TST_CellRefImportWarningSetPairArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_CellRefImportWarningSetPairArchive(ProtobufMessage(_b)) }
-            if let _v { cellrefWarningSetPair.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in cellrefWarningSetPair { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.ImportWarningSetByCellRefArchive", [
+        .repeated(1, TST_CellRefImportWarningSetPairArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var cellrefWarningSetPair: [TST_CellRefImportWarningSetPairArchive] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(cellrefWarningSetPair value: TST_CellRefImportWarningSetPairArchive) { append(value, toMessages: 0) }
 }
 
 /// Generated wire model for `TST.TableDataList`.
 final class TST_TableDataList: IWAMessage {
-    var listtype: Int32?
-    var nextlistid: UInt32?
-    var entries: [TST_TableDataList_ListEntry] = []
-    var segments: [TSP_Reference] = []
-    var isNewForBnc: Bool?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { listtype = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { nextlistid = _v }
-        case 3:
-            var _v: TST_TableDataList_ListEntry?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_TableDataList_ListEntry(ProtobufMessage(_b)) }
-            if let _v { entries.append(_v) }
-        case 4:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { segments.append(_v) }
-        case 5:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { isNewForBnc = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = listtype { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = nextlistid { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        for _x in entries { _w.bytesField(3, _x.encoded()) }
-        for _x in segments { _w.bytesField(4, _x.encoded()) }
-        if let _x = isNewForBnc { _w.varintField(5, _x ? 1 : 0) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.TableDataList", [
+        .optional(1, .int32), .optional(2, .uint32), .repeated(3, TST_TableDataList_ListEntry.self),
+        .repeated(4, TSP_Reference.self), .optional(5, .bool),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 5)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var listtype: Int32? { get { self[0] } set { self[0] = newValue } }
+    var nextlistid: UInt32? { get { self[1] } set { self[1] = newValue } }
+    var entries: [TST_TableDataList_ListEntry] { get { self[messages: 2] } set { self[messages: 2] = newValue } }
+    func append(entries value: TST_TableDataList_ListEntry) { append(value, toMessages: 2) }
+    var segments: [TSP_Reference] { get { self[messages: 3] } set { self[messages: 3] = newValue } }
+    func append(segments value: TSP_Reference) { append(value, toMessages: 3) }
+    var isNewForBnc: Bool? { get { self[4] } set { self[4] = newValue } }
 }
 
 /// Generated wire model for `TST.TableDataList.ListEntry`.
 final class TST_TableDataList_ListEntry: IWAMessage {
-    var key: UInt32?
-    var refcount: UInt32?
-    var string: String?
-    var reference: TSP_Reference?
-    var formula: TSCE_FormulaArchive?
-    var format: TSK_FormatStructArchive?
-    var customFormat: TSK_CustomFormatArchive?
-    var richTextPayload: TSP_Reference?
-    var commentStorage: TSP_Reference?
-    var importWarningSet: TST_ImportWarningSetArchive?
-    var cellSpec: TST_CellSpecArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { key = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { refcount = _v }
-        case 3:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { string = _v }
-        case 4:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { reference = _v }
-        case 5:
-            var _v: TSCE_FormulaArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_FormulaArchive(ProtobufMessage(_b)) }
-            if let _v { formula = _v }
-        case 6:
-            var _v: TSK_FormatStructArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_FormatStructArchive(ProtobufMessage(_b)) }
-            if let _v { format = _v }
-        case 8:
-            var _v: TSK_CustomFormatArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_CustomFormatArchive(ProtobufMessage(_b)) }
-            if let _v { customFormat = _v }
-        case 9:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { richTextPayload = _v }
-        case 10:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { commentStorage = _v }
-        case 11:
-            var _v: TST_ImportWarningSetArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_ImportWarningSetArchive(ProtobufMessage(_b)) }
-            if let _v { importWarningSet = _v }
-        case 12:
-            var _v: TST_CellSpecArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_CellSpecArchive(ProtobufMessage(_b)) }
-            if let _v { cellSpec = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = key { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = refcount { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = string { _w.stringField(3, _x) }
-        if let _x = reference { _w.bytesField(4, _x.encoded()) }
-        if let _x = formula { _w.bytesField(5, _x.encoded()) }
-        if let _x = format { _w.bytesField(6, _x.encoded()) }
-        if let _x = customFormat { _w.bytesField(8, _x.encoded()) }
-        if let _x = richTextPayload { _w.bytesField(9, _x.encoded()) }
-        if let _x = commentStorage { _w.bytesField(10, _x.encoded()) }
-        if let _x = importWarningSet { _w.bytesField(11, _x.encoded()) }
-        if let _x = cellSpec { _w.bytesField(12, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.TableDataList.ListEntry", [
+        .optional(1, .uint32), .optional(2, .uint32), .optional(3, .string), .optional(4, TSP_Reference.self),
+        .optional(5, TSCE_FormulaArchive.self), .optional(6, TSK_FormatStructArchive.self),
+        .optional(8, TSK_CustomFormatArchive.self), .optional(9, TSP_Reference.self), .optional(10, TSP_Reference.self),
+        .optional(11, TST_ImportWarningSetArchive.self), .optional(12, TST_CellSpecArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 11)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var key: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var refcount: UInt32? { get { self[1] } set { self[1] = newValue } }
+    var string: String? { get { self[2] } set { self[2] = newValue } }
+    var reference: TSP_Reference? { get { self[message: 3] } set { self[message: 3] = newValue } }
+    var formula: TSCE_FormulaArchive? { get { self[message: 4] } set { self[message: 4] = newValue } }
+    var format: TSK_FormatStructArchive? { get { self[message: 5] } set { self[message: 5] = newValue } }
+    var customFormat: TSK_CustomFormatArchive? { get { self[message: 6] } set { self[message: 6] = newValue } }
+    var richTextPayload: TSP_Reference? { get { self[message: 7] } set { self[message: 7] = newValue } }
+    var commentStorage: TSP_Reference? { get { self[message: 8] } set { self[message: 8] = newValue } }
+    var importWarningSet: TST_ImportWarningSetArchive? { get { self[message: 9] } set { self[message: 9] = newValue } }
+    var cellSpec: TST_CellSpecArchive? { get { self[message: 10] } set { self[message: 10] = newValue } }
 }
 
 /// Generated wire model for `TST.TableDataListSegment`.
 final class TST_TableDataListSegment: IWAMessage {
-    var listType: Int32?
-    var keyRange: TSP_Range?
-    var entries: [TST_TableDataList_ListEntry] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { listType = _v }
-        case 2:
-            var _v: TSP_Range?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Range(ProtobufMessage(_b)) }
-            if let _v { keyRange = _v }
-        case 3:
-            var _v: TST_TableDataList_ListEntry?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_TableDataList_ListEntry(ProtobufMessage(_b)) }
-            if let _v { entries.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = listType { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = keyRange { _w.bytesField(2, _x.encoded()) }
-        for _x in entries { _w.bytesField(3, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.TableDataListSegment", [
+        .optional(1, .int32), .optional(2, TSP_Range.self), .repeated(3, TST_TableDataList_ListEntry.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var listType: Int32? { get { self[0] } set { self[0] = newValue } }
+    var keyRange: TSP_Range? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var entries: [TST_TableDataList_ListEntry] { get { self[messages: 2] } set { self[messages: 2] = newValue } }
+    func append(entries value: TST_TableDataList_ListEntry) { append(value, toMessages: 2) }
 }
 
 /// Generated wire model for `TST.TableRBTree`.
 final class TST_TableRBTree: IWAMessage {
-    var nodes: [TST_TableRBTree_Node] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TST_TableRBTree_Node?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_TableRBTree_Node(ProtobufMessage(_b)) }
-            if let _v { nodes.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in nodes { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.TableRBTree", [
+        .repeated(1, TST_TableRBTree_Node.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var nodes: [TST_TableRBTree_Node] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(nodes value: TST_TableRBTree_Node) { append(value, toMessages: 0) }
 }
 
 /// Generated wire model for `TST.TableRBTree.Node`.
 final class TST_TableRBTree_Node: IWAMessage {
-    var key: UInt32?
-    var value: UInt32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { key = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { value = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = key { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = value { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.TableRBTree.Node", [
+        .optional(1, .uint32), .optional(2, .uint32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var key: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var value: UInt32? { get { self[1] } set { self[1] = newValue } }
 }
 
 /// Generated wire model for `TST.HeaderStorageBucket`.
 final class TST_HeaderStorageBucket: IWAMessage {
-    var buckethashfunction: UInt32?
-    var headers: [TST_HeaderStorageBucket_Header] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { buckethashfunction = _v }
-        case 2:
-            var _v: TST_HeaderStorageBucket_Header?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_HeaderStorageBucket_Header(ProtobufMessage(_b)) }
-            if let _v { headers.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = buckethashfunction { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        for _x in headers { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.HeaderStorageBucket", [
+        .optional(1, .uint32), .repeated(2, TST_HeaderStorageBucket_Header.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var buckethashfunction: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var headers: [TST_HeaderStorageBucket_Header] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(headers value: TST_HeaderStorageBucket_Header) { append(value, toMessages: 1) }
 }
 
 /// Generated wire model for `TST.HeaderStorageBucket.Header`.
 final class TST_HeaderStorageBucket_Header: IWAMessage {
-    var index: UInt32?
-    var size: Float?
-    var hidingstate: UInt32?
-    var numberofcells: UInt32?
-    var cellStyle: TSP_Reference?
-    var textStyle: TSP_Reference?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { index = _v }
-        case 2:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { size = _v }
-        case 3:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { hidingstate = _v }
-        case 4:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { numberofcells = _v }
-        case 5:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { cellStyle = _v }
-        case 6:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { textStyle = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = index { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = size { _w.fixed32Field(2, _x.bitPattern) }
-        if let _x = hidingstate { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = numberofcells { _w.varintField(4, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = cellStyle { _w.bytesField(5, _x.encoded()) }
-        if let _x = textStyle { _w.bytesField(6, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.HeaderStorageBucket.Header", [
+        .optional(1, .uint32), .optional(2, .float), .optional(3, .uint32), .optional(4, .uint32),
+        .optional(5, TSP_Reference.self), .optional(6, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 6)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var index: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var size: Float? { get { self[1] } set { self[1] = newValue } }
+    var hidingstate: UInt32? { get { self[2] } set { self[2] = newValue } }
+    var numberofcells: UInt32? { get { self[3] } set { self[3] = newValue } }
+    var cellStyle: TSP_Reference? { get { self[message: 4] } set { self[message: 4] = newValue } }
+    var textStyle: TSP_Reference? { get { self[message: 5] } set { self[message: 5] = newValue } }
 }
 
 /// Generated wire model for `TST.HeaderStorage`.
 final class TST_HeaderStorage: IWAMessage {
-    var buckethashfunction: UInt32?
-    var buckets: [TSP_Reference] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { buckethashfunction = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { buckets.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = buckethashfunction { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        for _x in buckets { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.HeaderStorage", [
+        .optional(1, .uint32), .repeated(2, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var buckethashfunction: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var buckets: [TSP_Reference] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(buckets value: TSP_Reference) { append(value, toMessages: 1) }
 }
 
 /// Generated wire model for `TST.DataStore`.
 final class TST_DataStore: IWAMessage {
-    var rowheaders: TST_HeaderStorage?
-    var columnheaders: TSP_Reference?
-    var tiles: TST_TileStorage?
-    var stringtable: TSP_Reference?
-    var styletable: TSP_Reference?
-    var formulaTable: TSP_Reference?
-    var formulaerrortable: TSP_Reference?
-    var formatTablePreBnc: TSP_Reference?
-    var multiplechoicelistformattable: TSP_Reference?
-    var mergeRegionMap: TSP_Reference?
-    var deprecatedCustomFormatTable: TSP_Reference?
-    var nextrowstripid: UInt32?
-    var nextcolumnstripid: UInt32?
-    var rowtiletree: TST_TableRBTree?
-    var columntiletree: TST_TableRBTree?
-    var storageVersionPreBnc: UInt32?
-    var richTextTable: TSP_Reference?
-    var conditionalstyletable: TSP_Reference?
-    var commentstoragetable: TSP_Reference?
-    var importwarningsettable: TSP_Reference?
-    var controlCellSpecTable: TSP_Reference?
-    var formatTable: TSP_Reference?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TST_HeaderStorage?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_HeaderStorage(ProtobufMessage(_b)) }
-            if let _v { rowheaders = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { columnheaders = _v }
-        case 3:
-            var _v: TST_TileStorage?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_TileStorage(ProtobufMessage(_b)) }
-            if let _v { tiles = _v }
-        case 4:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { stringtable = _v }
-        case 5:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { styletable = _v }
-        case 6:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { formulaTable = _v }
-        case 12:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { formulaerrortable = _v }
-        case 11:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { formatTablePreBnc = _v }
-        case 16:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { multiplechoicelistformattable = _v }
-        case 13:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { mergeRegionMap = _v }
-        case 15:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { deprecatedCustomFormatTable = _v }
-        case 7:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { nextrowstripid = _v }
-        case 8:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { nextcolumnstripid = _v }
-        case 9:
-            var _v: TST_TableRBTree?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_TableRBTree(ProtobufMessage(_b)) }
-            if let _v { rowtiletree = _v }
-        case 10:
-            var _v: TST_TableRBTree?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_TableRBTree(ProtobufMessage(_b)) }
-            if let _v { columntiletree = _v }
-        case 14:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { storageVersionPreBnc = _v }
-        case 17:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { richTextTable = _v }
-        case 18:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { conditionalstyletable = _v }
-        case 19:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { commentstoragetable = _v }
-        case 20:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { importwarningsettable = _v }
-        case 21:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { controlCellSpecTable = _v }
-        case 22:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { formatTable = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = rowheaders { _w.bytesField(1, _x.encoded()) }
-        if let _x = columnheaders { _w.bytesField(2, _x.encoded()) }
-        if let _x = tiles { _w.bytesField(3, _x.encoded()) }
-        if let _x = stringtable { _w.bytesField(4, _x.encoded()) }
-        if let _x = styletable { _w.bytesField(5, _x.encoded()) }
-        if let _x = formulaTable { _w.bytesField(6, _x.encoded()) }
-        if let _x = formulaerrortable { _w.bytesField(12, _x.encoded()) }
-        if let _x = formatTablePreBnc { _w.bytesField(11, _x.encoded()) }
-        if let _x = multiplechoicelistformattable { _w.bytesField(16, _x.encoded()) }
-        if let _x = mergeRegionMap { _w.bytesField(13, _x.encoded()) }
-        if let _x = deprecatedCustomFormatTable { _w.bytesField(15, _x.encoded()) }
-        if let _x = nextrowstripid { _w.varintField(7, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = nextcolumnstripid { _w.varintField(8, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = rowtiletree { _w.bytesField(9, _x.encoded()) }
-        if let _x = columntiletree { _w.bytesField(10, _x.encoded()) }
-        if let _x = storageVersionPreBnc { _w.varintField(14, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = richTextTable { _w.bytesField(17, _x.encoded()) }
-        if let _x = conditionalstyletable { _w.bytesField(18, _x.encoded()) }
-        if let _x = commentstoragetable { _w.bytesField(19, _x.encoded()) }
-        if let _x = importwarningsettable { _w.bytesField(20, _x.encoded()) }
-        if let _x = controlCellSpecTable { _w.bytesField(21, _x.encoded()) }
-        if let _x = formatTable { _w.bytesField(22, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.DataStore", [
+        .optional(1, TST_HeaderStorage.self), .optional(2, TSP_Reference.self), .optional(3, TST_TileStorage.self),
+        .optional(4, TSP_Reference.self), .optional(5, TSP_Reference.self), .optional(6, TSP_Reference.self),
+        .optional(12, TSP_Reference.self), .optional(11, TSP_Reference.self), .optional(16, TSP_Reference.self),
+        .optional(13, TSP_Reference.self), .optional(15, TSP_Reference.self), .optional(7, .uint32),
+        .optional(8, .uint32), .optional(9, TST_TableRBTree.self), .optional(10, TST_TableRBTree.self),
+        .optional(14, .uint32), .optional(17, TSP_Reference.self), .optional(18, TSP_Reference.self),
+        .optional(19, TSP_Reference.self), .optional(20, TSP_Reference.self), .optional(21, TSP_Reference.self),
+        .optional(22, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 22)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var rowheaders: TST_HeaderStorage? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var columnheaders: TSP_Reference? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var tiles: TST_TileStorage? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var stringtable: TSP_Reference? { get { self[message: 3] } set { self[message: 3] = newValue } }
+    var styletable: TSP_Reference? { get { self[message: 4] } set { self[message: 4] = newValue } }
+    var formulaTable: TSP_Reference? { get { self[message: 5] } set { self[message: 5] = newValue } }
+    var formulaerrortable: TSP_Reference? { get { self[message: 6] } set { self[message: 6] = newValue } }
+    var formatTablePreBnc: TSP_Reference? { get { self[message: 7] } set { self[message: 7] = newValue } }
+    var multiplechoicelistformattable: TSP_Reference? { get { self[message: 8] } set { self[message: 8] = newValue } }
+    var mergeRegionMap: TSP_Reference? { get { self[message: 9] } set { self[message: 9] = newValue } }
+    var deprecatedCustomFormatTable: TSP_Reference? { get { self[message: 10] } set { self[message: 10] = newValue } }
+    var nextrowstripid: UInt32? { get { self[11] } set { self[11] = newValue } }
+    var nextcolumnstripid: UInt32? { get { self[12] } set { self[12] = newValue } }
+    var rowtiletree: TST_TableRBTree? { get { self[message: 13] } set { self[message: 13] = newValue } }
+    var columntiletree: TST_TableRBTree? { get { self[message: 14] } set { self[message: 14] = newValue } }
+    var storageVersionPreBnc: UInt32? { get { self[15] } set { self[15] = newValue } }
+    var richTextTable: TSP_Reference? { get { self[message: 16] } set { self[message: 16] = newValue } }
+    var conditionalstyletable: TSP_Reference? { get { self[message: 17] } set { self[message: 17] = newValue } }
+    var commentstoragetable: TSP_Reference? { get { self[message: 18] } set { self[message: 18] = newValue } }
+    var importwarningsettable: TSP_Reference? { get { self[message: 19] } set { self[message: 19] = newValue } }
+    var controlCellSpecTable: TSP_Reference? { get { self[message: 20] } set { self[message: 20] = newValue } }
+    var formatTable: TSP_Reference? { get { self[message: 21] } set { self[message: 21] = newValue } }
 }
 
 /// Generated wire model for `TST.TableInfoArchive`.
 final class TST_TableInfoArchive: IWAMessage {
-    var `super`: TSD_DrawableArchive?
-    var tablemodel: TSP_Reference?
-    var editingState: TSP_Reference?
-    var summaryModel: TSP_Reference?
-    var categoryOrder: TSP_Reference?
-    var viewColumnRowUids: TSP_Reference?
-    var groupByUuid: TSP_UUID?
-    var hiddenStatesUuid: TSP_UUID?
-    var formulaCoordSpaceInPre40: UInt32?
-    var formulaCoordSpace: UInt32?
-    var pasteboardCoordMapper: TSCE_CoordMapperArchive?
-    var layoutEngine: TST_LayoutEngineArchive?
-    var pivotDataModel: TSP_Reference?
-    var isAPivotTable: Bool?
-    var pivotOrder: TSP_Reference?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSD_DrawableArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_DrawableArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { tablemodel = _v }
-        case 3:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { editingState = _v }
-        case 4:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { summaryModel = _v }
-        case 5:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { categoryOrder = _v }
-        case 6:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { viewColumnRowUids = _v }
-        case 7:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { groupByUuid = _v }
-        case 8:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { hiddenStatesUuid = _v }
-        case 9:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { formulaCoordSpaceInPre40 = _v }
-        case 10:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { formulaCoordSpace = _v }
-        case 13:
-            var _v: TSCE_CoordMapperArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CoordMapperArchive(ProtobufMessage(_b)) }
-            if let _v { pasteboardCoordMapper = _v }
-        case 14:
-            var _v: TST_LayoutEngineArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_LayoutEngineArchive(ProtobufMessage(_b)) }
-            if let _v { layoutEngine = _v }
-        case 15:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { pivotDataModel = _v }
-        case 16:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { isAPivotTable = _v }
-        case 17:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { pivotOrder = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = tablemodel { _w.bytesField(2, _x.encoded()) }
-        if let _x = editingState { _w.bytesField(3, _x.encoded()) }
-        if let _x = summaryModel { _w.bytesField(4, _x.encoded()) }
-        if let _x = categoryOrder { _w.bytesField(5, _x.encoded()) }
-        if let _x = viewColumnRowUids { _w.bytesField(6, _x.encoded()) }
-        if let _x = groupByUuid { _w.bytesField(7, _x.encoded()) }
-        if let _x = hiddenStatesUuid { _w.bytesField(8, _x.encoded()) }
-        if let _x = formulaCoordSpaceInPre40 { _w.varintField(9, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = formulaCoordSpace { _w.varintField(10, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = pasteboardCoordMapper { _w.bytesField(13, _x.encoded()) }
-        if let _x = layoutEngine { _w.bytesField(14, _x.encoded()) }
-        if let _x = pivotDataModel { _w.bytesField(15, _x.encoded()) }
-        if let _x = isAPivotTable { _w.varintField(16, _x ? 1 : 0) }
-        if let _x = pivotOrder { _w.bytesField(17, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.TableInfoArchive", [
+        .optional(1, TSD_DrawableArchive.self), .optional(2, TSP_Reference.self), .optional(3, TSP_Reference.self),
+        .optional(4, TSP_Reference.self), .optional(5, TSP_Reference.self), .optional(6, TSP_Reference.self),
+        .optional(7, TSP_UUID.self), .optional(8, TSP_UUID.self), .optional(9, .uint32), .optional(10, .uint32),
+        .optional(13, TSCE_CoordMapperArchive.self), .optional(14, TST_LayoutEngineArchive.self),
+        .optional(15, TSP_Reference.self), .optional(16, .bool), .optional(17, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 15)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var `super`: TSD_DrawableArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var tablemodel: TSP_Reference? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var editingState: TSP_Reference? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var summaryModel: TSP_Reference? { get { self[message: 3] } set { self[message: 3] = newValue } }
+    var categoryOrder: TSP_Reference? { get { self[message: 4] } set { self[message: 4] = newValue } }
+    var viewColumnRowUids: TSP_Reference? { get { self[message: 5] } set { self[message: 5] = newValue } }
+    var groupByUuid: TSP_UUID? { get { self[message: 6] } set { self[message: 6] = newValue } }
+    var hiddenStatesUuid: TSP_UUID? { get { self[message: 7] } set { self[message: 7] = newValue } }
+    var formulaCoordSpaceInPre40: UInt32? { get { self[8] } set { self[8] = newValue } }
+    var formulaCoordSpace: UInt32? { get { self[9] } set { self[9] = newValue } }
+    var pasteboardCoordMapper: TSCE_CoordMapperArchive? { get { self[message: 10] } set { self[message: 10] = newValue } }
+    var layoutEngine: TST_LayoutEngineArchive? { get { self[message: 11] } set { self[message: 11] = newValue } }
+    var pivotDataModel: TSP_Reference? { get { self[message: 12] } set { self[message: 12] = newValue } }
+    var isAPivotTable: Bool? { get { self[13] } set { self[13] = newValue } }
+    var pivotOrder: TSP_Reference? { get { self[message: 14] } set { self[message: 14] = newValue } }
 }
 
 /// Generated wire model for `TST.CategoryInfoArchive`.
 final class TST_CategoryInfoArchive: IWAMessage {
-    var `super`: TSD_DrawableArchive?
-    var tablemodel: TSP_Reference?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSD_DrawableArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_DrawableArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { tablemodel = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = tablemodel { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.CategoryInfoArchive", [
+        .optional(1, TSD_DrawableArchive.self), .optional(2, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var `super`: TSD_DrawableArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var tablemodel: TSP_Reference? { get { self[message: 1] } set { self[message: 1] = newValue } }
 }
 
 /// Generated wire model for `TST.WPTableInfoArchive`.
 final class TST_WPTableInfoArchive: IWAMessage {
-    var `super`: TST_TableInfoArchive?
-    var storage: TSP_Reference?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TST_TableInfoArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_TableInfoArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { storage = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = storage { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.WPTableInfoArchive", [
+        .optional(1, TST_TableInfoArchive.self), .optional(2, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var `super`: TST_TableInfoArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var storage: TSP_Reference? { get { self[message: 1] } set { self[message: 1] = newValue } }
 }
 
 /// Generated wire model for `TST.TableStyleNetworkArchive`.
 final class TST_TableStyleNetworkArchive: IWAMessage {
-    var bodyTextStyle: TSP_Reference?
-    var headerRowTextStyle: TSP_Reference?
-    var headerColumnTextStyle: TSP_Reference?
-    var footerRowTextStyle: TSP_Reference?
-    var bodyCellStyle: TSP_Reference?
-    var headerRowStyle: TSP_Reference?
-    var headerColumnStyle: TSP_Reference?
-    var footerRowStyle: TSP_Reference?
-    var tableStyle: TSP_Reference?
-    var tableNameStyle: TSP_Reference?
-    var tableNameShapeStyle: TSP_Reference?
-    var presetId: UInt32?
-    var categoryLevel1TextStyle: TSP_Reference?
-    var categoryLevel2TextStyle: TSP_Reference?
-    var categoryLevel3TextStyle: TSP_Reference?
-    var categoryLevel4TextStyle: TSP_Reference?
-    var categoryLevel5TextStyle: TSP_Reference?
-    var categoryLevel1Style: TSP_Reference?
-    var categoryLevel2Style: TSP_Reference?
-    var categoryLevel3Style: TSP_Reference?
-    var categoryLevel4Style: TSP_Reference?
-    var categoryLevel5Style: TSP_Reference?
-    var labelLevel1TextStyle: TSP_Reference?
-    var labelLevel2TextStyle: TSP_Reference?
-    var labelLevel3TextStyle: TSP_Reference?
-    var labelLevel4TextStyle: TSP_Reference?
-    var labelLevel5TextStyle: TSP_Reference?
-    var labelLevel1Style: TSP_Reference?
-    var labelLevel2Style: TSP_Reference?
-    var labelLevel3Style: TSP_Reference?
-    var labelLevel4Style: TSP_Reference?
-    var labelLevel5Style: TSP_Reference?
-    var pivotBodySummaryRowStyle: TSP_Reference?
-    var pivotBodySummaryColumnStyle: TSP_Reference?
-    var pivotHeaderColumnSummaryStyle: TSP_Reference?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { bodyTextStyle = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { headerRowTextStyle = _v }
-        case 3:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { headerColumnTextStyle = _v }
-        case 4:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { footerRowTextStyle = _v }
-        case 5:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { bodyCellStyle = _v }
-        case 6:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { headerRowStyle = _v }
-        case 7:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { headerColumnStyle = _v }
-        case 8:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { footerRowStyle = _v }
-        case 9:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { tableStyle = _v }
-        case 10:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { tableNameStyle = _v }
-        case 11:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { tableNameShapeStyle = _v }
-        case 12:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { presetId = _v }
-        case 13:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { categoryLevel1TextStyle = _v }
-        case 14:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { categoryLevel2TextStyle = _v }
-        case 15:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { categoryLevel3TextStyle = _v }
-        case 16:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { categoryLevel4TextStyle = _v }
-        case 17:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { categoryLevel5TextStyle = _v }
-        case 18:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { categoryLevel1Style = _v }
-        case 19:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { categoryLevel2Style = _v }
-        case 20:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { categoryLevel3Style = _v }
-        case 21:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { categoryLevel4Style = _v }
-        case 22:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { categoryLevel5Style = _v }
-        case 23:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { labelLevel1TextStyle = _v }
-        case 24:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { labelLevel2TextStyle = _v }
-        case 25:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { labelLevel3TextStyle = _v }
-        case 26:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { labelLevel4TextStyle = _v }
-        case 27:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { labelLevel5TextStyle = _v }
-        case 28:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { labelLevel1Style = _v }
-        case 29:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { labelLevel2Style = _v }
-        case 30:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { labelLevel3Style = _v }
-        case 31:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { labelLevel4Style = _v }
-        case 32:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { labelLevel5Style = _v }
-        case 33:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { pivotBodySummaryRowStyle = _v }
-        case 34:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { pivotBodySummaryColumnStyle = _v }
-        case 35:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { pivotHeaderColumnSummaryStyle = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = bodyTextStyle { _w.bytesField(1, _x.encoded()) }
-        if let _x = headerRowTextStyle { _w.bytesField(2, _x.encoded()) }
-        if let _x = headerColumnTextStyle { _w.bytesField(3, _x.encoded()) }
-        if let _x = footerRowTextStyle { _w.bytesField(4, _x.encoded()) }
-        if let _x = bodyCellStyle { _w.bytesField(5, _x.encoded()) }
-        if let _x = headerRowStyle { _w.bytesField(6, _x.encoded()) }
-        if let _x = headerColumnStyle { _w.bytesField(7, _x.encoded()) }
-        if let _x = footerRowStyle { _w.bytesField(8, _x.encoded()) }
-        if let _x = tableStyle { _w.bytesField(9, _x.encoded()) }
-        if let _x = tableNameStyle { _w.bytesField(10, _x.encoded()) }
-        if let _x = tableNameShapeStyle { _w.bytesField(11, _x.encoded()) }
-        if let _x = presetId { _w.varintField(12, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = categoryLevel1TextStyle { _w.bytesField(13, _x.encoded()) }
-        if let _x = categoryLevel2TextStyle { _w.bytesField(14, _x.encoded()) }
-        if let _x = categoryLevel3TextStyle { _w.bytesField(15, _x.encoded()) }
-        if let _x = categoryLevel4TextStyle { _w.bytesField(16, _x.encoded()) }
-        if let _x = categoryLevel5TextStyle { _w.bytesField(17, _x.encoded()) }
-        if let _x = categoryLevel1Style { _w.bytesField(18, _x.encoded()) }
-        if let _x = categoryLevel2Style { _w.bytesField(19, _x.encoded()) }
-        if let _x = categoryLevel3Style { _w.bytesField(20, _x.encoded()) }
-        if let _x = categoryLevel4Style { _w.bytesField(21, _x.encoded()) }
-        if let _x = categoryLevel5Style { _w.bytesField(22, _x.encoded()) }
-        if let _x = labelLevel1TextStyle { _w.bytesField(23, _x.encoded()) }
-        if let _x = labelLevel2TextStyle { _w.bytesField(24, _x.encoded()) }
-        if let _x = labelLevel3TextStyle { _w.bytesField(25, _x.encoded()) }
-        if let _x = labelLevel4TextStyle { _w.bytesField(26, _x.encoded()) }
-        if let _x = labelLevel5TextStyle { _w.bytesField(27, _x.encoded()) }
-        if let _x = labelLevel1Style { _w.bytesField(28, _x.encoded()) }
-        if let _x = labelLevel2Style { _w.bytesField(29, _x.encoded()) }
-        if let _x = labelLevel3Style { _w.bytesField(30, _x.encoded()) }
-        if let _x = labelLevel4Style { _w.bytesField(31, _x.encoded()) }
-        if let _x = labelLevel5Style { _w.bytesField(32, _x.encoded()) }
-        if let _x = pivotBodySummaryRowStyle { _w.bytesField(33, _x.encoded()) }
-        if let _x = pivotBodySummaryColumnStyle { _w.bytesField(34, _x.encoded()) }
-        if let _x = pivotHeaderColumnSummaryStyle { _w.bytesField(35, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.TableStyleNetworkArchive", [
+        .optional(1, TSP_Reference.self), .optional(2, TSP_Reference.self), .optional(3, TSP_Reference.self),
+        .optional(4, TSP_Reference.self), .optional(5, TSP_Reference.self), .optional(6, TSP_Reference.self),
+        .optional(7, TSP_Reference.self), .optional(8, TSP_Reference.self), .optional(9, TSP_Reference.self),
+        .optional(10, TSP_Reference.self), .optional(11, TSP_Reference.self), .optional(12, .uint32),
+        .optional(13, TSP_Reference.self), .optional(14, TSP_Reference.self), .optional(15, TSP_Reference.self),
+        .optional(16, TSP_Reference.self), .optional(17, TSP_Reference.self), .optional(18, TSP_Reference.self),
+        .optional(19, TSP_Reference.self), .optional(20, TSP_Reference.self), .optional(21, TSP_Reference.self),
+        .optional(22, TSP_Reference.self), .optional(23, TSP_Reference.self), .optional(24, TSP_Reference.self),
+        .optional(25, TSP_Reference.self), .optional(26, TSP_Reference.self), .optional(27, TSP_Reference.self),
+        .optional(28, TSP_Reference.self), .optional(29, TSP_Reference.self), .optional(30, TSP_Reference.self),
+        .optional(31, TSP_Reference.self), .optional(32, TSP_Reference.self), .optional(33, TSP_Reference.self),
+        .optional(34, TSP_Reference.self), .optional(35, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 35)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var bodyTextStyle: TSP_Reference? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var headerRowTextStyle: TSP_Reference? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var headerColumnTextStyle: TSP_Reference? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var footerRowTextStyle: TSP_Reference? { get { self[message: 3] } set { self[message: 3] = newValue } }
+    var bodyCellStyle: TSP_Reference? { get { self[message: 4] } set { self[message: 4] = newValue } }
+    var headerRowStyle: TSP_Reference? { get { self[message: 5] } set { self[message: 5] = newValue } }
+    var headerColumnStyle: TSP_Reference? { get { self[message: 6] } set { self[message: 6] = newValue } }
+    var footerRowStyle: TSP_Reference? { get { self[message: 7] } set { self[message: 7] = newValue } }
+    var tableStyle: TSP_Reference? { get { self[message: 8] } set { self[message: 8] = newValue } }
+    var tableNameStyle: TSP_Reference? { get { self[message: 9] } set { self[message: 9] = newValue } }
+    var tableNameShapeStyle: TSP_Reference? { get { self[message: 10] } set { self[message: 10] = newValue } }
+    var presetId: UInt32? { get { self[11] } set { self[11] = newValue } }
+    var categoryLevel1TextStyle: TSP_Reference? { get { self[message: 12] } set { self[message: 12] = newValue } }
+    var categoryLevel2TextStyle: TSP_Reference? { get { self[message: 13] } set { self[message: 13] = newValue } }
+    var categoryLevel3TextStyle: TSP_Reference? { get { self[message: 14] } set { self[message: 14] = newValue } }
+    var categoryLevel4TextStyle: TSP_Reference? { get { self[message: 15] } set { self[message: 15] = newValue } }
+    var categoryLevel5TextStyle: TSP_Reference? { get { self[message: 16] } set { self[message: 16] = newValue } }
+    var categoryLevel1Style: TSP_Reference? { get { self[message: 17] } set { self[message: 17] = newValue } }
+    var categoryLevel2Style: TSP_Reference? { get { self[message: 18] } set { self[message: 18] = newValue } }
+    var categoryLevel3Style: TSP_Reference? { get { self[message: 19] } set { self[message: 19] = newValue } }
+    var categoryLevel4Style: TSP_Reference? { get { self[message: 20] } set { self[message: 20] = newValue } }
+    var categoryLevel5Style: TSP_Reference? { get { self[message: 21] } set { self[message: 21] = newValue } }
+    var labelLevel1TextStyle: TSP_Reference? { get { self[message: 22] } set { self[message: 22] = newValue } }
+    var labelLevel2TextStyle: TSP_Reference? { get { self[message: 23] } set { self[message: 23] = newValue } }
+    var labelLevel3TextStyle: TSP_Reference? { get { self[message: 24] } set { self[message: 24] = newValue } }
+    var labelLevel4TextStyle: TSP_Reference? { get { self[message: 25] } set { self[message: 25] = newValue } }
+    var labelLevel5TextStyle: TSP_Reference? { get { self[message: 26] } set { self[message: 26] = newValue } }
+    var labelLevel1Style: TSP_Reference? { get { self[message: 27] } set { self[message: 27] = newValue } }
+    var labelLevel2Style: TSP_Reference? { get { self[message: 28] } set { self[message: 28] = newValue } }
+    var labelLevel3Style: TSP_Reference? { get { self[message: 29] } set { self[message: 29] = newValue } }
+    var labelLevel4Style: TSP_Reference? { get { self[message: 30] } set { self[message: 30] = newValue } }
+    var labelLevel5Style: TSP_Reference? { get { self[message: 31] } set { self[message: 31] = newValue } }
+    var pivotBodySummaryRowStyle: TSP_Reference? { get { self[message: 32] } set { self[message: 32] = newValue } }
+    var pivotBodySummaryColumnStyle: TSP_Reference? { get { self[message: 33] } set { self[message: 33] = newValue } }
+    var pivotHeaderColumnSummaryStyle: TSP_Reference? { get { self[message: 34] } set { self[message: 34] = newValue } }
 }
 
 /// Generated wire model for `TST.TableGroupSortOrderUIDArchive`.
 final class TST_TableGroupSortOrderUIDArchive: IWAMessage {
-    var groupSortRules: [TST_TableGroupSortOrderUIDArchive_GroupSortRuleUIDArchive] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TST_TableGroupSortOrderUIDArchive_GroupSortRuleUIDArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_TableGroupSortOrderUIDArchive_GroupSortRuleUIDArchive(ProtobufMessage(_b)) }
-            if let _v { groupSortRules.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in groupSortRules { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.TableGroupSortOrderUIDArchive", [
+        .repeated(1, TST_TableGroupSortOrderUIDArchive_GroupSortRuleUIDArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var groupSortRules: [TST_TableGroupSortOrderUIDArchive_GroupSortRuleUIDArchive] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(groupSortRules value: TST_TableGroupSortOrderUIDArchive_GroupSortRuleUIDArchive) { append(value, toMessages: 0) }
 }
 
 /// Generated wire model for `TST.TableGroupSortOrderUIDArchive.GroupSortRuleUIDArchive`.
 final class TST_TableGroupSortOrderUIDArchive_GroupSortRuleUIDArchive: IWAMessage {
-    var groupingColumnUid: TSP_UUID?
-    var columnUid: TSP_UUID?
-    var direction: Int32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { groupingColumnUid = _v }
-        case 2:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { columnUid = _v }
-        case 3:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { direction = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = groupingColumnUid { _w.bytesField(1, _x.encoded()) }
-        if let _x = columnUid { _w.bytesField(2, _x.encoded()) }
-        if let _x = direction { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.TableGroupSortOrderUIDArchive.GroupSortRuleUIDArchive", [
+        .optional(1, TSP_UUID.self), .optional(2, TSP_UUID.self), .optional(3, .int32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var groupingColumnUid: TSP_UUID? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var columnUid: TSP_UUID? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var direction: Int32? { get { self[2] } set { self[2] = newValue } }
 }
 
 /// Generated wire model for `TST.TableSortOrderArchive`.
 final class TST_TableSortOrderArchive: IWAMessage {
-    var type: Int32?
-    var rules: [TST_TableSortOrderArchive_SortRuleArchive] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { type = _v }
-        case 2:
-            var _v: TST_TableSortOrderArchive_SortRuleArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_TableSortOrderArchive_SortRuleArchive(ProtobufMessage(_b)) }
-            if let _v { rules.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = type { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        for _x in rules { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.TableSortOrderArchive", [
+        .optional(1, .int32), .repeated(2, TST_TableSortOrderArchive_SortRuleArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var type: Int32? { get { self[0] } set { self[0] = newValue } }
+    var rules: [TST_TableSortOrderArchive_SortRuleArchive] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(rules value: TST_TableSortOrderArchive_SortRuleArchive) { append(value, toMessages: 1) }
 }
 
 /// Generated wire model for `TST.TableSortOrderArchive.SortRuleArchive`.
 final class TST_TableSortOrderArchive_SortRuleArchive: IWAMessage {
-    var index: UInt32?
-    var direction: Int32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { index = _v }
-        case 2:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { direction = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = index { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = direction { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.TableSortOrderArchive.SortRuleArchive", [
+        .optional(1, .uint32), .optional(2, .int32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var index: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var direction: Int32? { get { self[1] } set { self[1] = newValue } }
 }
 
 /// Generated wire model for `TST.TableSortOrderUIDArchive`.
 final class TST_TableSortOrderUIDArchive: IWAMessage {
-    var type: Int32?
-    var rules: [TST_TableSortOrderUIDArchive_SortRuleArchive] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { type = _v }
-        case 2:
-            var _v: TST_TableSortOrderUIDArchive_SortRuleArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_TableSortOrderUIDArchive_SortRuleArchive(ProtobufMessage(_b)) }
-            if let _v { rules.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = type { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        for _x in rules { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.TableSortOrderUIDArchive", [
+        .optional(1, .int32), .repeated(2, TST_TableSortOrderUIDArchive_SortRuleArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var type: Int32? { get { self[0] } set { self[0] = newValue } }
+    var rules: [TST_TableSortOrderUIDArchive_SortRuleArchive] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(rules value: TST_TableSortOrderUIDArchive_SortRuleArchive) { append(value, toMessages: 1) }
 }
 
 /// Generated wire model for `TST.TableSortOrderUIDArchive.SortRuleArchive`.
 final class TST_TableSortOrderUIDArchive_SortRuleArchive: IWAMessage {
-    var columnUid: TSP_UUID?
-    var direction: Int32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { columnUid = _v }
-        case 2:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { direction = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = columnUid { _w.bytesField(1, _x.encoded()) }
-        if let _x = direction { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.TableSortOrderUIDArchive.SortRuleArchive", [
+        .optional(1, TSP_UUID.self), .optional(2, .int32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var columnUid: TSP_UUID? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var direction: Int32? { get { self[1] } set { self[1] = newValue } }
 }
 
 /// Generated wire model for `TST.SortRuleReferenceTrackerArchive`.
 final class TST_SortRuleReferenceTrackerArchive: IWAMessage {
-    var referenceTracker: TSP_Reference?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { referenceTracker = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = referenceTracker { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.SortRuleReferenceTrackerArchive", [
+        .optional(1, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var referenceTracker: TSP_Reference? { get { self[message: 0] } set { self[message: 0] = newValue } }
 }
 
 /// Generated wire model for `TST.CellRegion`.
 final class TST_CellRegion: IWAMessage {
-    var cellRanges: [TST_CellRange] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TST_CellRange?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_CellRange(ProtobufMessage(_b)) }
-            if let _v { cellRanges.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in cellRanges { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.CellRegion", [
+        .repeated(1, TST_CellRange.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var cellRanges: [TST_CellRange] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(cellRanges value: TST_CellRange) { append(value, toMessages: 0) }
 }
 
 /// Generated wire model for `TST.CellUIDRegionArchive`.
 final class TST_CellUIDRegionArchive: IWAMessage {
-    var cellUidRanges: [TSP_UUIDRectArchive] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_UUIDRectArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUIDRectArchive(ProtobufMessage(_b)) }
-            if let _v { cellUidRanges.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in cellUidRanges { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.CellUIDRegionArchive", [
+        .repeated(1, TSP_UUIDRectArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var cellUidRanges: [TSP_UUIDRectArchive] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(cellUidRanges value: TSP_UUIDRectArchive) { append(value, toMessages: 0) }
 }
 
 /// Generated wire model for `TST.StructuredTextImportRecord`.
 final class TST_StructuredTextImportRecord: IWAMessage {
-    var importSettings: TSK_StructuredTextImportSettings?
-    var importSource: String?
-    var importDate: Double?
-    var sourceData: [UInt8]?
-    var sourceEncoding: UInt64?
-    var confidence: Float?
-    var importedRegion: TST_CellRegion?
-    var sourceRowCount: UInt64?
-    var sourceColumnCount: UInt64?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSK_StructuredTextImportSettings?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_StructuredTextImportSettings(ProtobufMessage(_b)) }
-            if let _v { importSettings = _v }
-        case 2:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { importSource = _v }
-        case 3:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { importDate = _v }
-        case 4:
-            var _v: [UInt8]?
-            if case .lengthDelimited(let _b) = _f.value { _v = _b }
-            if let _v { sourceData = _v }
-        case 5:
-            var _v: UInt64?
-            if case .varint(let _u) = _f.value { _v = UInt64(truncatingIfNeeded: _u) }
-            if let _v { sourceEncoding = _v }
-        case 6:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { confidence = _v }
-        case 7:
-            var _v: TST_CellRegion?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_CellRegion(ProtobufMessage(_b)) }
-            if let _v { importedRegion = _v }
-        case 8:
-            var _v: UInt64?
-            if case .varint(let _u) = _f.value { _v = UInt64(truncatingIfNeeded: _u) }
-            if let _v { sourceRowCount = _v }
-        case 9:
-            var _v: UInt64?
-            if case .varint(let _u) = _f.value { _v = UInt64(truncatingIfNeeded: _u) }
-            if let _v { sourceColumnCount = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = importSettings { _w.bytesField(1, _x.encoded()) }
-        if let _x = importSource { _w.stringField(2, _x) }
-        if let _x = importDate { _w.fixed64Field(3, _x.bitPattern) }
-        if let _x = sourceData { _w.bytesField(4, _x) }
-        if let _x = sourceEncoding { _w.varintField(5, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = confidence { _w.fixed32Field(6, _x.bitPattern) }
-        if let _x = importedRegion { _w.bytesField(7, _x.encoded()) }
-        if let _x = sourceRowCount { _w.varintField(8, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = sourceColumnCount { _w.varintField(9, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.StructuredTextImportRecord", [
+        .optional(1, TSK_StructuredTextImportSettings.self), .optional(2, .string), .optional(3, .double),
+        .optional(4, .bytes), .optional(5, .uint64), .optional(6, .float), .optional(7, TST_CellRegion.self),
+        .optional(8, .uint64), .optional(9, .uint64),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 9)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var importSettings: TSK_StructuredTextImportSettings? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var importSource: String? { get { self[1] } set { self[1] = newValue } }
+    var importDate: Double? { get { self[2] } set { self[2] = newValue } }
+    var sourceData: [UInt8]? { get { self[3] } set { self[3] = newValue } }
+    var sourceEncoding: UInt64? { get { self[4] } set { self[4] = newValue } }
+    var confidence: Float? { get { self[5] } set { self[5] = newValue } }
+    var importedRegion: TST_CellRegion? { get { self[message: 6] } set { self[message: 6] = newValue } }
+    var sourceRowCount: UInt64? { get { self[7] } set { self[7] = newValue } }
+    var sourceColumnCount: UInt64? { get { self[8] } set { self[8] = newValue } }
 }
 
 /// Generated wire model for `TST.TableModelArchive`.
 final class TST_TableModelArchive: IWAMessage {
-    var tableId: String?
-    var fromTableId: String?
-    var wasCut: Bool?
-    var tableStyle: TSP_Reference?
-    var bodyTextStyle: TSP_Reference?
-    var headerRowTextStyle: TSP_Reference?
-    var headerColumnTextStyle: TSP_Reference?
-    var footerRowTextStyle: TSP_Reference?
-    var bodyCellStyle: TSP_Reference?
-    var headerRowStyle: TSP_Reference?
-    var headerColumnStyle: TSP_Reference?
-    var footerRowStyle: TSP_Reference?
-    var tableNameStyle: TSP_Reference?
-    var tableNameShapeStyle: TSP_Reference?
-    var tableStylePreset: TSP_Reference?
-    var presetIndex: UInt32?
-    var baseDataStore: TST_DataStore?
-    var provider: TSP_Reference?
-    var numberOfRows: UInt32?
-    var numberOfColumns: UInt32?
-    var tableName: String?
-    var tableNameEnabled: Bool?
-    var tableNameHeight: Double?
-    var tableNameBorderEnabled: Bool?
-    var numberOfHeaderRows: UInt32?
-    var numberOfHeaderColumns: UInt32?
-    var numberOfFooterRows: UInt32?
-    var headerRowsFrozen: Bool?
-    var headerColumnsFrozen: Bool?
-    var numberOfHiddenRows: UInt32?
-    var numberOfHiddenColumns: UInt32?
-    var numberOfUserHiddenRows: UInt32?
-    var numberOfUserHiddenColumns: UInt32?
-    var numberOfFilteredRows: UInt32?
-    var defaultRowHeight: Double?
-    var defaultColumnWidth: Double?
-    var originOffset: TST_CellID?
-    var repeatingHeaderRowsEnabled: Bool?
-    var styleApplyClearsAll: Bool?
-    var repeatingHeaderColumnsEnabled: Bool?
-    var hiddenStateFormulaOwnerForColumns: TSP_Reference?
-    var hiddenStateFormulaOwnerForRows: TSP_Reference?
-    var rowFilterSetPrePivot: TSP_Reference?
-    var conditionalStyleFormulaOwnerId: TSP_CFUUIDArchive?
-    var sortOrder: TST_TableSortOrderArchive?
-    var sortRuleReferenceTracker: TST_SortRuleReferenceTrackerArchive?
-    var baseColumnRowUids: TSP_Reference?
-    var mergeOwner: TST_MergeOwnerArchive?
-    var strokeSidecar: TSP_Reference?
-    var presetNeedsStrongOwnership: Bool?
-    var textImportRecord: TST_StructuredTextImportRecord?
-    var categoryLevel1Style: TSP_Reference?
-    var categoryLevel2Style: TSP_Reference?
-    var categoryLevel3Style: TSP_Reference?
-    var categoryLevel4Style: TSP_Reference?
-    var categoryLevel5Style: TSP_Reference?
-    var categoryLevel1TextStyle: TSP_Reference?
-    var categoryLevel2TextStyle: TSP_Reference?
-    var categoryLevel3TextStyle: TSP_Reference?
-    var categoryLevel4TextStyle: TSP_Reference?
-    var categoryLevel5TextStyle: TSP_Reference?
-    var hiddenStatesOwner: TST_HiddenStatesOwnerArchive?
-    var labelLevel1Style: TSP_Reference?
-    var labelLevel2Style: TSP_Reference?
-    var labelLevel3Style: TSP_Reference?
-    var labelLevel4Style: TSP_Reference?
-    var labelLevel5Style: TSP_Reference?
-    var labelLevel1TextStyle: TSP_Reference?
-    var labelLevel2TextStyle: TSP_Reference?
-    var labelLevel3TextStyle: TSP_Reference?
-    var labelLevel4TextStyle: TSP_Reference?
-    var labelLevel5TextStyle: TSP_Reference?
-    var categoryOwnerDeprecated: TST_CategoryOwnerArchive?
-    var pencilAnnotationOwner: TST_PencilAnnotationOwnerArchive?
-    var fromGroupByUid: String?
-    var hauntedOwner: TSCE_HauntedOwnerArchive?
-    var pivotOwner: TSP_Reference?
-    var categoryOwner: TSP_Reference?
-    var pivotBodySummaryRowStyle: TSP_Reference?
-    var pivotBodySummaryColumnStyle: TSP_Reference?
-    var pivotHeaderColumnSummaryStyle: TSP_Reference?
-    var pivotValueTypesByCol: [UInt32] = []
-    var pivotDateGroupingColumns: [UInt32] = []
-    var pivotDateGroupingTypes: [UInt32] = []
-    var spillOwner: TSCE_SpillOwnerArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { tableId = _v }
-        case 43:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { fromTableId = _v }
-        case 50:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { wasCut = _v }
-        case 3:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { tableStyle = _v }
-        case 24:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { bodyTextStyle = _v }
-        case 25:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { headerRowTextStyle = _v }
-        case 26:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { headerColumnTextStyle = _v }
-        case 27:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { footerRowTextStyle = _v }
-        case 18:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { bodyCellStyle = _v }
-        case 19:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { headerRowStyle = _v }
-        case 20:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { headerColumnStyle = _v }
-        case 21:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { footerRowStyle = _v }
-        case 30:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { tableNameStyle = _v }
-        case 36:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { tableNameShapeStyle = _v }
-        case 48:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { tableStylePreset = _v }
-        case 28:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { presetIndex = _v }
-        case 4:
-            var _v: TST_DataStore?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_DataStore(ProtobufMessage(_b)) }
-            if let _v { baseDataStore = _v }
-        case 5:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { provider = _v }
-        case 6:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { numberOfRows = _v }
-        case 7:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { numberOfColumns = _v }
-        case 8:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { tableName = _v }
-        case 22:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { tableNameEnabled = _v }
-        case 33:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { tableNameHeight = _v }
-        case 37:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { tableNameBorderEnabled = _v }
-        case 9:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { numberOfHeaderRows = _v }
-        case 10:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { numberOfHeaderColumns = _v }
-        case 11:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { numberOfFooterRows = _v }
-        case 12:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { headerRowsFrozen = _v }
-        case 13:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { headerColumnsFrozen = _v }
-        case 14:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { numberOfHiddenRows = _v }
-        case 15:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { numberOfHiddenColumns = _v }
-        case 41:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { numberOfUserHiddenRows = _v }
-        case 42:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { numberOfUserHiddenColumns = _v }
-        case 40:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { numberOfFilteredRows = _v }
-        case 16:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { defaultRowHeight = _v }
-        case 17:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { defaultColumnWidth = _v }
-        case 23:
-            var _v: TST_CellID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_CellID(ProtobufMessage(_b)) }
-            if let _v { originOffset = _v }
-        case 29:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { repeatingHeaderRowsEnabled = _v }
-        case 31:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { styleApplyClearsAll = _v }
-        case 32:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { repeatingHeaderColumnsEnabled = _v }
-        case 34:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { hiddenStateFormulaOwnerForColumns = _v }
-        case 35:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { hiddenStateFormulaOwnerForRows = _v }
-        case 38:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { rowFilterSetPrePivot = _v }
-        case 39:
-            var _v: TSP_CFUUIDArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_CFUUIDArchive(ProtobufMessage(_b)) }
-            if let _v { conditionalStyleFormulaOwnerId = _v }
-        case 44:
-            var _v: TST_TableSortOrderArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_TableSortOrderArchive(ProtobufMessage(_b)) }
-            if let _v { sortOrder = _v }
-        case 45:
-            var _v: TST_SortRuleReferenceTrackerArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_SortRuleReferenceTrackerArchive(ProtobufMessage(_b)) }
-            if let _v { sortRuleReferenceTracker = _v }
-        case 46:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { baseColumnRowUids = _v }
-        case 47:
-            var _v: TST_MergeOwnerArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_MergeOwnerArchive(ProtobufMessage(_b)) }
-            if let _v { mergeOwner = _v }
-        case 49:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { strokeSidecar = _v }
-        case 51:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { presetNeedsStrongOwnership = _v }
-        case 52:
-            var _v: TST_StructuredTextImportRecord?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_StructuredTextImportRecord(ProtobufMessage(_b)) }
-            if let _v { textImportRecord = _v }
-        case 60:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { categoryLevel1Style = _v }
-        case 61:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { categoryLevel2Style = _v }
-        case 62:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { categoryLevel3Style = _v }
-        case 63:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { categoryLevel4Style = _v }
-        case 64:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { categoryLevel5Style = _v }
-        case 65:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { categoryLevel1TextStyle = _v }
-        case 66:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { categoryLevel2TextStyle = _v }
-        case 67:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { categoryLevel3TextStyle = _v }
-        case 68:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { categoryLevel4TextStyle = _v }
-        case 69:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { categoryLevel5TextStyle = _v }
-        case 70:
-            var _v: TST_HiddenStatesOwnerArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_HiddenStatesOwnerArchive(ProtobufMessage(_b)) }
-            if let _v { hiddenStatesOwner = _v }
-        case 71:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { labelLevel1Style = _v }
-        case 72:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { labelLevel2Style = _v }
-        case 73:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { labelLevel3Style = _v }
-        case 74:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { labelLevel4Style = _v }
-        case 75:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { labelLevel5Style = _v }
-        case 76:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { labelLevel1TextStyle = _v }
-        case 77:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { labelLevel2TextStyle = _v }
-        case 78:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { labelLevel3TextStyle = _v }
-        case 79:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { labelLevel4TextStyle = _v }
-        case 80:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { labelLevel5TextStyle = _v }
-        case 81:
-            var _v: TST_CategoryOwnerArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_CategoryOwnerArchive(ProtobufMessage(_b)) }
-            if let _v { categoryOwnerDeprecated = _v }
-        case 82:
-            var _v: TST_PencilAnnotationOwnerArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_PencilAnnotationOwnerArchive(ProtobufMessage(_b)) }
-            if let _v { pencilAnnotationOwner = _v }
-        case 83:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { fromGroupByUid = _v }
-        case 84:
-            var _v: TSCE_HauntedOwnerArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_HauntedOwnerArchive(ProtobufMessage(_b)) }
-            if let _v { hauntedOwner = _v }
-        case 85:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { pivotOwner = _v }
-        case 86:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { categoryOwner = _v }
-        case 87:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { pivotBodySummaryRowStyle = _v }
-        case 88:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { pivotBodySummaryColumnStyle = _v }
-        case 89:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { pivotHeaderColumnSummaryStyle = _v }
-        case 90:
-            if case .varint(let _u) = _f.value { pivotValueTypesByCol.append(UInt32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { pivotValueTypesByCol.append(UInt32(truncatingIfNeeded: _u)) } }
-        case 91:
-            if case .varint(let _u) = _f.value { pivotDateGroupingColumns.append(UInt32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { pivotDateGroupingColumns.append(UInt32(truncatingIfNeeded: _u)) } }
-        case 92:
-            if case .varint(let _u) = _f.value { pivotDateGroupingTypes.append(UInt32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { pivotDateGroupingTypes.append(UInt32(truncatingIfNeeded: _u)) } }
-        case 93:
-            var _v: TSCE_SpillOwnerArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_SpillOwnerArchive(ProtobufMessage(_b)) }
-            if let _v { spillOwner = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = tableId { _w.stringField(1, _x) }
-        if let _x = fromTableId { _w.stringField(43, _x) }
-        if let _x = wasCut { _w.varintField(50, _x ? 1 : 0) }
-        if let _x = tableStyle { _w.bytesField(3, _x.encoded()) }
-        if let _x = bodyTextStyle { _w.bytesField(24, _x.encoded()) }
-        if let _x = headerRowTextStyle { _w.bytesField(25, _x.encoded()) }
-        if let _x = headerColumnTextStyle { _w.bytesField(26, _x.encoded()) }
-        if let _x = footerRowTextStyle { _w.bytesField(27, _x.encoded()) }
-        if let _x = bodyCellStyle { _w.bytesField(18, _x.encoded()) }
-        if let _x = headerRowStyle { _w.bytesField(19, _x.encoded()) }
-        if let _x = headerColumnStyle { _w.bytesField(20, _x.encoded()) }
-        if let _x = footerRowStyle { _w.bytesField(21, _x.encoded()) }
-        if let _x = tableNameStyle { _w.bytesField(30, _x.encoded()) }
-        if let _x = tableNameShapeStyle { _w.bytesField(36, _x.encoded()) }
-        if let _x = tableStylePreset { _w.bytesField(48, _x.encoded()) }
-        if let _x = presetIndex { _w.varintField(28, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = baseDataStore { _w.bytesField(4, _x.encoded()) }
-        if let _x = provider { _w.bytesField(5, _x.encoded()) }
-        if let _x = numberOfRows { _w.varintField(6, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = numberOfColumns { _w.varintField(7, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = tableName { _w.stringField(8, _x) }
-        if let _x = tableNameEnabled { _w.varintField(22, _x ? 1 : 0) }
-        if let _x = tableNameHeight { _w.fixed64Field(33, _x.bitPattern) }
-        if let _x = tableNameBorderEnabled { _w.varintField(37, _x ? 1 : 0) }
-        if let _x = numberOfHeaderRows { _w.varintField(9, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = numberOfHeaderColumns { _w.varintField(10, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = numberOfFooterRows { _w.varintField(11, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = headerRowsFrozen { _w.varintField(12, _x ? 1 : 0) }
-        if let _x = headerColumnsFrozen { _w.varintField(13, _x ? 1 : 0) }
-        if let _x = numberOfHiddenRows { _w.varintField(14, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = numberOfHiddenColumns { _w.varintField(15, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = numberOfUserHiddenRows { _w.varintField(41, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = numberOfUserHiddenColumns { _w.varintField(42, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = numberOfFilteredRows { _w.varintField(40, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = defaultRowHeight { _w.fixed64Field(16, _x.bitPattern) }
-        if let _x = defaultColumnWidth { _w.fixed64Field(17, _x.bitPattern) }
-        if let _x = originOffset { _w.bytesField(23, _x.encoded()) }
-        if let _x = repeatingHeaderRowsEnabled { _w.varintField(29, _x ? 1 : 0) }
-        if let _x = styleApplyClearsAll { _w.varintField(31, _x ? 1 : 0) }
-        if let _x = repeatingHeaderColumnsEnabled { _w.varintField(32, _x ? 1 : 0) }
-        if let _x = hiddenStateFormulaOwnerForColumns { _w.bytesField(34, _x.encoded()) }
-        if let _x = hiddenStateFormulaOwnerForRows { _w.bytesField(35, _x.encoded()) }
-        if let _x = rowFilterSetPrePivot { _w.bytesField(38, _x.encoded()) }
-        if let _x = conditionalStyleFormulaOwnerId { _w.bytesField(39, _x.encoded()) }
-        if let _x = sortOrder { _w.bytesField(44, _x.encoded()) }
-        if let _x = sortRuleReferenceTracker { _w.bytesField(45, _x.encoded()) }
-        if let _x = baseColumnRowUids { _w.bytesField(46, _x.encoded()) }
-        if let _x = mergeOwner { _w.bytesField(47, _x.encoded()) }
-        if let _x = strokeSidecar { _w.bytesField(49, _x.encoded()) }
-        if let _x = presetNeedsStrongOwnership { _w.varintField(51, _x ? 1 : 0) }
-        if let _x = textImportRecord { _w.bytesField(52, _x.encoded()) }
-        if let _x = categoryLevel1Style { _w.bytesField(60, _x.encoded()) }
-        if let _x = categoryLevel2Style { _w.bytesField(61, _x.encoded()) }
-        if let _x = categoryLevel3Style { _w.bytesField(62, _x.encoded()) }
-        if let _x = categoryLevel4Style { _w.bytesField(63, _x.encoded()) }
-        if let _x = categoryLevel5Style { _w.bytesField(64, _x.encoded()) }
-        if let _x = categoryLevel1TextStyle { _w.bytesField(65, _x.encoded()) }
-        if let _x = categoryLevel2TextStyle { _w.bytesField(66, _x.encoded()) }
-        if let _x = categoryLevel3TextStyle { _w.bytesField(67, _x.encoded()) }
-        if let _x = categoryLevel4TextStyle { _w.bytesField(68, _x.encoded()) }
-        if let _x = categoryLevel5TextStyle { _w.bytesField(69, _x.encoded()) }
-        if let _x = hiddenStatesOwner { _w.bytesField(70, _x.encoded()) }
-        if let _x = labelLevel1Style { _w.bytesField(71, _x.encoded()) }
-        if let _x = labelLevel2Style { _w.bytesField(72, _x.encoded()) }
-        if let _x = labelLevel3Style { _w.bytesField(73, _x.encoded()) }
-        if let _x = labelLevel4Style { _w.bytesField(74, _x.encoded()) }
-        if let _x = labelLevel5Style { _w.bytesField(75, _x.encoded()) }
-        if let _x = labelLevel1TextStyle { _w.bytesField(76, _x.encoded()) }
-        if let _x = labelLevel2TextStyle { _w.bytesField(77, _x.encoded()) }
-        if let _x = labelLevel3TextStyle { _w.bytesField(78, _x.encoded()) }
-        if let _x = labelLevel4TextStyle { _w.bytesField(79, _x.encoded()) }
-        if let _x = labelLevel5TextStyle { _w.bytesField(80, _x.encoded()) }
-        if let _x = categoryOwnerDeprecated { _w.bytesField(81, _x.encoded()) }
-        if let _x = pencilAnnotationOwner { _w.bytesField(82, _x.encoded()) }
-        if let _x = fromGroupByUid { _w.stringField(83, _x) }
-        if let _x = hauntedOwner { _w.bytesField(84, _x.encoded()) }
-        if let _x = pivotOwner { _w.bytesField(85, _x.encoded()) }
-        if let _x = categoryOwner { _w.bytesField(86, _x.encoded()) }
-        if let _x = pivotBodySummaryRowStyle { _w.bytesField(87, _x.encoded()) }
-        if let _x = pivotBodySummaryColumnStyle { _w.bytesField(88, _x.encoded()) }
-        if let _x = pivotHeaderColumnSummaryStyle { _w.bytesField(89, _x.encoded()) }
-        for _x in pivotValueTypesByCol { _w.varintField(90, UInt64(truncatingIfNeeded: _x)) }
-        for _x in pivotDateGroupingColumns { _w.varintField(91, UInt64(truncatingIfNeeded: _x)) }
-        for _x in pivotDateGroupingTypes { _w.varintField(92, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = spillOwner { _w.bytesField(93, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.TableModelArchive", [
+        .optional(1, .string), .optional(43, .string), .optional(50, .bool), .optional(3, TSP_Reference.self),
+        .optional(24, TSP_Reference.self), .optional(25, TSP_Reference.self), .optional(26, TSP_Reference.self),
+        .optional(27, TSP_Reference.self), .optional(18, TSP_Reference.self), .optional(19, TSP_Reference.self),
+        .optional(20, TSP_Reference.self), .optional(21, TSP_Reference.self), .optional(30, TSP_Reference.self),
+        .optional(36, TSP_Reference.self), .optional(48, TSP_Reference.self), .optional(28, .uint32),
+        .optional(4, TST_DataStore.self), .optional(5, TSP_Reference.self), .optional(6, .uint32),
+        .optional(7, .uint32), .optional(8, .string), .optional(22, .bool), .optional(33, .double),
+        .optional(37, .bool), .optional(9, .uint32), .optional(10, .uint32), .optional(11, .uint32),
+        .optional(12, .bool), .optional(13, .bool), .optional(14, .uint32), .optional(15, .uint32),
+        .optional(41, .uint32), .optional(42, .uint32), .optional(40, .uint32), .optional(16, .double),
+        .optional(17, .double), .optional(23, TST_CellID.self), .optional(29, .bool), .optional(31, .bool),
+        .optional(32, .bool), .optional(34, TSP_Reference.self), .optional(35, TSP_Reference.self),
+        .optional(38, TSP_Reference.self), .optional(39, TSP_CFUUIDArchive.self),
+        .optional(44, TST_TableSortOrderArchive.self), .optional(45, TST_SortRuleReferenceTrackerArchive.self),
+        .optional(46, TSP_Reference.self), .optional(47, TST_MergeOwnerArchive.self), .optional(49, TSP_Reference.self),
+        .optional(51, .bool), .optional(52, TST_StructuredTextImportRecord.self), .optional(60, TSP_Reference.self),
+        .optional(61, TSP_Reference.self), .optional(62, TSP_Reference.self), .optional(63, TSP_Reference.self),
+        .optional(64, TSP_Reference.self), .optional(65, TSP_Reference.self), .optional(66, TSP_Reference.self),
+        .optional(67, TSP_Reference.self), .optional(68, TSP_Reference.self), .optional(69, TSP_Reference.self),
+        .optional(70, TST_HiddenStatesOwnerArchive.self), .optional(71, TSP_Reference.self),
+        .optional(72, TSP_Reference.self), .optional(73, TSP_Reference.self), .optional(74, TSP_Reference.self),
+        .optional(75, TSP_Reference.self), .optional(76, TSP_Reference.self), .optional(77, TSP_Reference.self),
+        .optional(78, TSP_Reference.self), .optional(79, TSP_Reference.self), .optional(80, TSP_Reference.self),
+        .optional(81, TST_CategoryOwnerArchive.self), .optional(82, TST_PencilAnnotationOwnerArchive.self),
+        .optional(83, .string), .optional(84, TSCE_HauntedOwnerArchive.self), .optional(85, TSP_Reference.self),
+        .optional(86, TSP_Reference.self), .optional(87, TSP_Reference.self), .optional(88, TSP_Reference.self),
+        .optional(89, TSP_Reference.self), .repeated(90, .uint32), .repeated(91, .uint32), .repeated(92, .uint32),
+        .optional(93, TSCE_SpillOwnerArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 85)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var tableId: String? { get { self[0] } set { self[0] = newValue } }
+    var fromTableId: String? { get { self[1] } set { self[1] = newValue } }
+    var wasCut: Bool? { get { self[2] } set { self[2] = newValue } }
+    var tableStyle: TSP_Reference? { get { self[message: 3] } set { self[message: 3] = newValue } }
+    var bodyTextStyle: TSP_Reference? { get { self[message: 4] } set { self[message: 4] = newValue } }
+    var headerRowTextStyle: TSP_Reference? { get { self[message: 5] } set { self[message: 5] = newValue } }
+    var headerColumnTextStyle: TSP_Reference? { get { self[message: 6] } set { self[message: 6] = newValue } }
+    var footerRowTextStyle: TSP_Reference? { get { self[message: 7] } set { self[message: 7] = newValue } }
+    var bodyCellStyle: TSP_Reference? { get { self[message: 8] } set { self[message: 8] = newValue } }
+    var headerRowStyle: TSP_Reference? { get { self[message: 9] } set { self[message: 9] = newValue } }
+    var headerColumnStyle: TSP_Reference? { get { self[message: 10] } set { self[message: 10] = newValue } }
+    var footerRowStyle: TSP_Reference? { get { self[message: 11] } set { self[message: 11] = newValue } }
+    var tableNameStyle: TSP_Reference? { get { self[message: 12] } set { self[message: 12] = newValue } }
+    var tableNameShapeStyle: TSP_Reference? { get { self[message: 13] } set { self[message: 13] = newValue } }
+    var tableStylePreset: TSP_Reference? { get { self[message: 14] } set { self[message: 14] = newValue } }
+    var presetIndex: UInt32? { get { self[15] } set { self[15] = newValue } }
+    var baseDataStore: TST_DataStore? { get { self[message: 16] } set { self[message: 16] = newValue } }
+    var provider: TSP_Reference? { get { self[message: 17] } set { self[message: 17] = newValue } }
+    var numberOfRows: UInt32? { get { self[18] } set { self[18] = newValue } }
+    var numberOfColumns: UInt32? { get { self[19] } set { self[19] = newValue } }
+    var tableName: String? { get { self[20] } set { self[20] = newValue } }
+    var tableNameEnabled: Bool? { get { self[21] } set { self[21] = newValue } }
+    var tableNameHeight: Double? { get { self[22] } set { self[22] = newValue } }
+    var tableNameBorderEnabled: Bool? { get { self[23] } set { self[23] = newValue } }
+    var numberOfHeaderRows: UInt32? { get { self[24] } set { self[24] = newValue } }
+    var numberOfHeaderColumns: UInt32? { get { self[25] } set { self[25] = newValue } }
+    var numberOfFooterRows: UInt32? { get { self[26] } set { self[26] = newValue } }
+    var headerRowsFrozen: Bool? { get { self[27] } set { self[27] = newValue } }
+    var headerColumnsFrozen: Bool? { get { self[28] } set { self[28] = newValue } }
+    var numberOfHiddenRows: UInt32? { get { self[29] } set { self[29] = newValue } }
+    var numberOfHiddenColumns: UInt32? { get { self[30] } set { self[30] = newValue } }
+    var numberOfUserHiddenRows: UInt32? { get { self[31] } set { self[31] = newValue } }
+    var numberOfUserHiddenColumns: UInt32? { get { self[32] } set { self[32] = newValue } }
+    var numberOfFilteredRows: UInt32? { get { self[33] } set { self[33] = newValue } }
+    var defaultRowHeight: Double? { get { self[34] } set { self[34] = newValue } }
+    var defaultColumnWidth: Double? { get { self[35] } set { self[35] = newValue } }
+    var originOffset: TST_CellID? { get { self[message: 36] } set { self[message: 36] = newValue } }
+    var repeatingHeaderRowsEnabled: Bool? { get { self[37] } set { self[37] = newValue } }
+    var styleApplyClearsAll: Bool? { get { self[38] } set { self[38] = newValue } }
+    var repeatingHeaderColumnsEnabled: Bool? { get { self[39] } set { self[39] = newValue } }
+    var hiddenStateFormulaOwnerForColumns: TSP_Reference? { get { self[message: 40] } set { self[message: 40] = newValue } }
+    var hiddenStateFormulaOwnerForRows: TSP_Reference? { get { self[message: 41] } set { self[message: 41] = newValue } }
+    var rowFilterSetPrePivot: TSP_Reference? { get { self[message: 42] } set { self[message: 42] = newValue } }
+    var conditionalStyleFormulaOwnerId: TSP_CFUUIDArchive? { get { self[message: 43] } set { self[message: 43] = newValue } }
+    var sortOrder: TST_TableSortOrderArchive? { get { self[message: 44] } set { self[message: 44] = newValue } }
+    var sortRuleReferenceTracker: TST_SortRuleReferenceTrackerArchive? { get { self[message: 45] } set { self[message: 45] = newValue } }
+    var baseColumnRowUids: TSP_Reference? { get { self[message: 46] } set { self[message: 46] = newValue } }
+    var mergeOwner: TST_MergeOwnerArchive? { get { self[message: 47] } set { self[message: 47] = newValue } }
+    var strokeSidecar: TSP_Reference? { get { self[message: 48] } set { self[message: 48] = newValue } }
+    var presetNeedsStrongOwnership: Bool? { get { self[49] } set { self[49] = newValue } }
+    var textImportRecord: TST_StructuredTextImportRecord? { get { self[message: 50] } set { self[message: 50] = newValue } }
+    var categoryLevel1Style: TSP_Reference? { get { self[message: 51] } set { self[message: 51] = newValue } }
+    var categoryLevel2Style: TSP_Reference? { get { self[message: 52] } set { self[message: 52] = newValue } }
+    var categoryLevel3Style: TSP_Reference? { get { self[message: 53] } set { self[message: 53] = newValue } }
+    var categoryLevel4Style: TSP_Reference? { get { self[message: 54] } set { self[message: 54] = newValue } }
+    var categoryLevel5Style: TSP_Reference? { get { self[message: 55] } set { self[message: 55] = newValue } }
+    var categoryLevel1TextStyle: TSP_Reference? { get { self[message: 56] } set { self[message: 56] = newValue } }
+    var categoryLevel2TextStyle: TSP_Reference? { get { self[message: 57] } set { self[message: 57] = newValue } }
+    var categoryLevel3TextStyle: TSP_Reference? { get { self[message: 58] } set { self[message: 58] = newValue } }
+    var categoryLevel4TextStyle: TSP_Reference? { get { self[message: 59] } set { self[message: 59] = newValue } }
+    var categoryLevel5TextStyle: TSP_Reference? { get { self[message: 60] } set { self[message: 60] = newValue } }
+    var hiddenStatesOwner: TST_HiddenStatesOwnerArchive? { get { self[message: 61] } set { self[message: 61] = newValue } }
+    var labelLevel1Style: TSP_Reference? { get { self[message: 62] } set { self[message: 62] = newValue } }
+    var labelLevel2Style: TSP_Reference? { get { self[message: 63] } set { self[message: 63] = newValue } }
+    var labelLevel3Style: TSP_Reference? { get { self[message: 64] } set { self[message: 64] = newValue } }
+    var labelLevel4Style: TSP_Reference? { get { self[message: 65] } set { self[message: 65] = newValue } }
+    var labelLevel5Style: TSP_Reference? { get { self[message: 66] } set { self[message: 66] = newValue } }
+    var labelLevel1TextStyle: TSP_Reference? { get { self[message: 67] } set { self[message: 67] = newValue } }
+    var labelLevel2TextStyle: TSP_Reference? { get { self[message: 68] } set { self[message: 68] = newValue } }
+    var labelLevel3TextStyle: TSP_Reference? { get { self[message: 69] } set { self[message: 69] = newValue } }
+    var labelLevel4TextStyle: TSP_Reference? { get { self[message: 70] } set { self[message: 70] = newValue } }
+    var labelLevel5TextStyle: TSP_Reference? { get { self[message: 71] } set { self[message: 71] = newValue } }
+    var categoryOwnerDeprecated: TST_CategoryOwnerArchive? { get { self[message: 72] } set { self[message: 72] = newValue } }
+    var pencilAnnotationOwner: TST_PencilAnnotationOwnerArchive? { get { self[message: 73] } set { self[message: 73] = newValue } }
+    var fromGroupByUid: String? { get { self[74] } set { self[74] = newValue } }
+    var hauntedOwner: TSCE_HauntedOwnerArchive? { get { self[message: 75] } set { self[message: 75] = newValue } }
+    var pivotOwner: TSP_Reference? { get { self[message: 76] } set { self[message: 76] = newValue } }
+    var categoryOwner: TSP_Reference? { get { self[message: 77] } set { self[message: 77] = newValue } }
+    var pivotBodySummaryRowStyle: TSP_Reference? { get { self[message: 78] } set { self[message: 78] = newValue } }
+    var pivotBodySummaryColumnStyle: TSP_Reference? { get { self[message: 79] } set { self[message: 79] = newValue } }
+    var pivotHeaderColumnSummaryStyle: TSP_Reference? { get { self[message: 80] } set { self[message: 80] = newValue } }
+    var pivotValueTypesByCol: [UInt32] { get { self[all: 81] } set { self[all: 81] = newValue } }
+    func append(pivotValueTypesByCol value: UInt32) { append(value, toAll: 81) }
+    var pivotDateGroupingColumns: [UInt32] { get { self[all: 82] } set { self[all: 82] = newValue } }
+    func append(pivotDateGroupingColumns value: UInt32) { append(value, toAll: 82) }
+    var pivotDateGroupingTypes: [UInt32] { get { self[all: 83] } set { self[all: 83] = newValue } }
+    func append(pivotDateGroupingTypes value: UInt32) { append(value, toAll: 83) }
+    var spillOwner: TSCE_SpillOwnerArchive? { get { self[message: 84] } set { self[message: 84] = newValue } }
 }
 
 /// Generated wire model for `TST.SummaryModelArchive`.
 final class TST_SummaryModelArchive: IWAMessage {
-    var tableInfo: TSP_Reference?
-    var dataStore: TST_DataStore?
-    var columnRowUids: TSP_Reference?
-    var aggregateFormulaOwnerUuid: TSP_UUID?
-    var summaryCellVendor: TSP_Reference?
-    var categoryColumnWidth: Double?
-    var summaryRowLevel1Height: Double?
-    var summaryRowLevel2Height: Double?
-    var summaryRowLevel3Height: Double?
-    var summaryRowLevel4Height: Double?
-    var summaryRowLevel5Height: Double?
-    var summaryLabelRowLevel1Height: Double?
-    var summaryLabelRowLevel2Height: Double?
-    var summaryLabelRowLevel3Height: Double?
-    var summaryLabelRowLevel4Height: Double?
-    var summaryLabelRowLevel5Height: Double?
-    var labelRowVisibility1: UInt32?
-    var labelRowVisibility2: UInt32?
-    var labelRowVisibility3: UInt32?
-    var labelRowVisibility4: UInt32?
-    var labelRowVisibility5: UInt32?
-    var summaryRowHeightList: [Double] = []
-    var labelRowHeightList: [Double] = []
-    var labelRowVisibilityList: [UInt32] = []
-    var groupSortOrder: TST_TableGroupSortOrderUIDArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { tableInfo = _v }
-        case 2:
-            var _v: TST_DataStore?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_DataStore(ProtobufMessage(_b)) }
-            if let _v { dataStore = _v }
-        case 3:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { columnRowUids = _v }
-        case 4:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { aggregateFormulaOwnerUuid = _v }
-        case 5:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { summaryCellVendor = _v }
-        case 10:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { categoryColumnWidth = _v }
-        case 11:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { summaryRowLevel1Height = _v }
-        case 12:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { summaryRowLevel2Height = _v }
-        case 13:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { summaryRowLevel3Height = _v }
-        case 14:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { summaryRowLevel4Height = _v }
-        case 15:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { summaryRowLevel5Height = _v }
-        case 16:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { summaryLabelRowLevel1Height = _v }
-        case 17:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { summaryLabelRowLevel2Height = _v }
-        case 18:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { summaryLabelRowLevel3Height = _v }
-        case 19:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { summaryLabelRowLevel4Height = _v }
-        case 20:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { summaryLabelRowLevel5Height = _v }
-        case 21:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { labelRowVisibility1 = _v }
-        case 22:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { labelRowVisibility2 = _v }
-        case 23:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { labelRowVisibility3 = _v }
-        case 24:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { labelRowVisibility4 = _v }
-        case 25:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { labelRowVisibility5 = _v }
-        case 26:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { summaryRowHeightList.append(_v) }
-        case 27:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { labelRowHeightList.append(_v) }
-        case 28:
-            if case .varint(let _u) = _f.value { labelRowVisibilityList.append(UInt32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { labelRowVisibilityList.append(UInt32(truncatingIfNeeded: _u)) } }
-        case 29:
-            var _v: TST_TableGroupSortOrderUIDArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_TableGroupSortOrderUIDArchive(ProtobufMessage(_b)) }
-            if let _v { groupSortOrder = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = tableInfo { _w.bytesField(1, _x.encoded()) }
-        if let _x = dataStore { _w.bytesField(2, _x.encoded()) }
-        if let _x = columnRowUids { _w.bytesField(3, _x.encoded()) }
-        if let _x = aggregateFormulaOwnerUuid { _w.bytesField(4, _x.encoded()) }
-        if let _x = summaryCellVendor { _w.bytesField(5, _x.encoded()) }
-        if let _x = categoryColumnWidth { _w.fixed64Field(10, _x.bitPattern) }
-        if let _x = summaryRowLevel1Height { _w.fixed64Field(11, _x.bitPattern) }
-        if let _x = summaryRowLevel2Height { _w.fixed64Field(12, _x.bitPattern) }
-        if let _x = summaryRowLevel3Height { _w.fixed64Field(13, _x.bitPattern) }
-        if let _x = summaryRowLevel4Height { _w.fixed64Field(14, _x.bitPattern) }
-        if let _x = summaryRowLevel5Height { _w.fixed64Field(15, _x.bitPattern) }
-        if let _x = summaryLabelRowLevel1Height { _w.fixed64Field(16, _x.bitPattern) }
-        if let _x = summaryLabelRowLevel2Height { _w.fixed64Field(17, _x.bitPattern) }
-        if let _x = summaryLabelRowLevel3Height { _w.fixed64Field(18, _x.bitPattern) }
-        if let _x = summaryLabelRowLevel4Height { _w.fixed64Field(19, _x.bitPattern) }
-        if let _x = summaryLabelRowLevel5Height { _w.fixed64Field(20, _x.bitPattern) }
-        if let _x = labelRowVisibility1 { _w.varintField(21, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = labelRowVisibility2 { _w.varintField(22, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = labelRowVisibility3 { _w.varintField(23, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = labelRowVisibility4 { _w.varintField(24, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = labelRowVisibility5 { _w.varintField(25, UInt64(truncatingIfNeeded: _x)) }
-        for _x in summaryRowHeightList { _w.fixed64Field(26, _x.bitPattern) }
-        for _x in labelRowHeightList { _w.fixed64Field(27, _x.bitPattern) }
-        for _x in labelRowVisibilityList { _w.varintField(28, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = groupSortOrder { _w.bytesField(29, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.SummaryModelArchive", [
+        .optional(1, TSP_Reference.self), .optional(2, TST_DataStore.self), .optional(3, TSP_Reference.self),
+        .optional(4, TSP_UUID.self), .optional(5, TSP_Reference.self), .optional(10, .double), .optional(11, .double),
+        .optional(12, .double), .optional(13, .double), .optional(14, .double), .optional(15, .double),
+        .optional(16, .double), .optional(17, .double), .optional(18, .double), .optional(19, .double),
+        .optional(20, .double), .optional(21, .uint32), .optional(22, .uint32), .optional(23, .uint32),
+        .optional(24, .uint32), .optional(25, .uint32), .repeated(26, .double), .repeated(27, .double),
+        .repeated(28, .uint32), .optional(29, TST_TableGroupSortOrderUIDArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 25)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var tableInfo: TSP_Reference? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var dataStore: TST_DataStore? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var columnRowUids: TSP_Reference? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var aggregateFormulaOwnerUuid: TSP_UUID? { get { self[message: 3] } set { self[message: 3] = newValue } }
+    var summaryCellVendor: TSP_Reference? { get { self[message: 4] } set { self[message: 4] = newValue } }
+    var categoryColumnWidth: Double? { get { self[5] } set { self[5] = newValue } }
+    var summaryRowLevel1Height: Double? { get { self[6] } set { self[6] = newValue } }
+    var summaryRowLevel2Height: Double? { get { self[7] } set { self[7] = newValue } }
+    var summaryRowLevel3Height: Double? { get { self[8] } set { self[8] = newValue } }
+    var summaryRowLevel4Height: Double? { get { self[9] } set { self[9] = newValue } }
+    var summaryRowLevel5Height: Double? { get { self[10] } set { self[10] = newValue } }
+    var summaryLabelRowLevel1Height: Double? { get { self[11] } set { self[11] = newValue } }
+    var summaryLabelRowLevel2Height: Double? { get { self[12] } set { self[12] = newValue } }
+    var summaryLabelRowLevel3Height: Double? { get { self[13] } set { self[13] = newValue } }
+    var summaryLabelRowLevel4Height: Double? { get { self[14] } set { self[14] = newValue } }
+    var summaryLabelRowLevel5Height: Double? { get { self[15] } set { self[15] = newValue } }
+    var labelRowVisibility1: UInt32? { get { self[16] } set { self[16] = newValue } }
+    var labelRowVisibility2: UInt32? { get { self[17] } set { self[17] = newValue } }
+    var labelRowVisibility3: UInt32? { get { self[18] } set { self[18] = newValue } }
+    var labelRowVisibility4: UInt32? { get { self[19] } set { self[19] = newValue } }
+    var labelRowVisibility5: UInt32? { get { self[20] } set { self[20] = newValue } }
+    var summaryRowHeightList: [Double] { get { self[all: 21] } set { self[all: 21] = newValue } }
+    func append(summaryRowHeightList value: Double) { append(value, toAll: 21) }
+    var labelRowHeightList: [Double] { get { self[all: 22] } set { self[all: 22] = newValue } }
+    func append(labelRowHeightList value: Double) { append(value, toAll: 22) }
+    var labelRowVisibilityList: [UInt32] { get { self[all: 23] } set { self[all: 23] = newValue } }
+    func append(labelRowVisibilityList value: UInt32) { append(value, toAll: 23) }
+    var groupSortOrder: TST_TableGroupSortOrderUIDArchive? { get { self[message: 24] } set { self[message: 24] = newValue } }
 }
 
 /// Generated wire model for `TST.SummaryModelGroupByChangeStateArchive`.
 final class TST_SummaryModelGroupByChangeStateArchive: IWAMessage {
-    var cellMap: TSP_Reference?
-    var summaryRowHeightList: [Double] = []
-    var labelRowHeightList: [Double] = []
-    var labelRowVisibilityList: [UInt32] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { cellMap = _v }
-        case 2:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { summaryRowHeightList.append(_v) }
-        case 3:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { labelRowHeightList.append(_v) }
-        case 4:
-            if case .varint(let _u) = _f.value { labelRowVisibilityList.append(UInt32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { labelRowVisibilityList.append(UInt32(truncatingIfNeeded: _u)) } }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = cellMap { _w.bytesField(1, _x.encoded()) }
-        for _x in summaryRowHeightList { _w.fixed64Field(2, _x.bitPattern) }
-        for _x in labelRowHeightList { _w.fixed64Field(3, _x.bitPattern) }
-        for _x in labelRowVisibilityList { _w.varintField(4, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.SummaryModelGroupByChangeStateArchive", [
+        .optional(1, TSP_Reference.self), .repeated(2, .double), .repeated(3, .double), .repeated(4, .uint32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var cellMap: TSP_Reference? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var summaryRowHeightList: [Double] { get { self[all: 1] } set { self[all: 1] = newValue } }
+    func append(summaryRowHeightList value: Double) { append(value, toAll: 1) }
+    var labelRowHeightList: [Double] { get { self[all: 2] } set { self[all: 2] = newValue } }
+    func append(labelRowHeightList value: Double) { append(value, toAll: 2) }
+    var labelRowVisibilityList: [UInt32] { get { self[all: 3] } set { self[all: 3] = newValue } }
+    func append(labelRowVisibilityList value: UInt32) { append(value, toAll: 3) }
 }
 
 /// Generated wire model for `TST.ColumnRowUIDMapArchive`.
 final class TST_ColumnRowUIDMapArchive: IWAMessage {
-    var sortedColumnUids: [TSP_UUID] = []
-    var columnIndexForUid: [UInt32] = []
-    var columnUidForIndex: [UInt32] = []
-    var sortedRowUids: [TSP_UUID] = []
-    var rowIndexForUid: [UInt32] = []
-    var rowUidForIndex: [UInt32] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { sortedColumnUids.append(_v) }
-        case 2:
-            if case .varint(let _u) = _f.value { columnIndexForUid.append(UInt32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { columnIndexForUid.append(UInt32(truncatingIfNeeded: _u)) } }
-        case 3:
-            if case .varint(let _u) = _f.value { columnUidForIndex.append(UInt32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { columnUidForIndex.append(UInt32(truncatingIfNeeded: _u)) } }
-        case 4:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { sortedRowUids.append(_v) }
-        case 5:
-            if case .varint(let _u) = _f.value { rowIndexForUid.append(UInt32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { rowIndexForUid.append(UInt32(truncatingIfNeeded: _u)) } }
-        case 6:
-            if case .varint(let _u) = _f.value { rowUidForIndex.append(UInt32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { rowUidForIndex.append(UInt32(truncatingIfNeeded: _u)) } }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in sortedColumnUids { _w.bytesField(1, _x.encoded()) }
-        for _x in columnIndexForUid { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        for _x in columnUidForIndex { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        for _x in sortedRowUids { _w.bytesField(4, _x.encoded()) }
-        for _x in rowIndexForUid { _w.varintField(5, UInt64(truncatingIfNeeded: _x)) }
-        for _x in rowUidForIndex { _w.varintField(6, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.ColumnRowUIDMapArchive", [
+        .repeated(1, TSP_UUID.self), .repeated(2, .uint32), .repeated(3, .uint32), .repeated(4, TSP_UUID.self),
+        .repeated(5, .uint32), .repeated(6, .uint32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 6)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var sortedColumnUids: [TSP_UUID] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(sortedColumnUids value: TSP_UUID) { append(value, toMessages: 0) }
+    var columnIndexForUid: [UInt32] { get { self[all: 1] } set { self[all: 1] = newValue } }
+    func append(columnIndexForUid value: UInt32) { append(value, toAll: 1) }
+    var columnUidForIndex: [UInt32] { get { self[all: 2] } set { self[all: 2] = newValue } }
+    func append(columnUidForIndex value: UInt32) { append(value, toAll: 2) }
+    var sortedRowUids: [TSP_UUID] { get { self[messages: 3] } set { self[messages: 3] = newValue } }
+    func append(sortedRowUids value: TSP_UUID) { append(value, toMessages: 3) }
+    var rowIndexForUid: [UInt32] { get { self[all: 4] } set { self[all: 4] = newValue } }
+    func append(rowIndexForUid value: UInt32) { append(value, toAll: 4) }
+    var rowUidForIndex: [UInt32] { get { self[all: 5] } set { self[all: 5] = newValue } }
+    func append(rowUidForIndex value: UInt32) { append(value, toAll: 5) }
 }
 
 /// Generated wire model for `TST.StrokeLayerArchive`.
 final class TST_StrokeLayerArchive: IWAMessage {
-    var rowColumnIndex: UInt32?
-    var strokeRuns: [TST_StrokeLayerArchive_StrokeRunArchive] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { rowColumnIndex = _v }
-        case 2:
-            var _v: TST_StrokeLayerArchive_StrokeRunArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_StrokeLayerArchive_StrokeRunArchive(ProtobufMessage(_b)) }
-            if let _v { strokeRuns.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = rowColumnIndex { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        for _x in strokeRuns { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.StrokeLayerArchive", [
+        .optional(1, .uint32), .repeated(2, TST_StrokeLayerArchive_StrokeRunArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var rowColumnIndex: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var strokeRuns: [TST_StrokeLayerArchive_StrokeRunArchive] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(strokeRuns value: TST_StrokeLayerArchive_StrokeRunArchive) { append(value, toMessages: 1) }
 }
 
 /// Generated wire model for `TST.StrokeLayerArchive.StrokeRunArchive`.
 final class TST_StrokeLayerArchive_StrokeRunArchive: IWAMessage {
-    var origin: Int32?
-    var length: UInt32?
-    var stroke: TSD_StrokeArchive?
-    var order: UInt32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { origin = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { length = _v }
-        case 3:
-            var _v: TSD_StrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_StrokeArchive(ProtobufMessage(_b)) }
-            if let _v { stroke = _v }
-        case 4:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { order = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = origin { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = length { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = stroke { _w.bytesField(3, _x.encoded()) }
-        if let _x = order { _w.varintField(4, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.StrokeLayerArchive.StrokeRunArchive", [
+        .optional(1, .int32), .optional(2, .uint32), .optional(3, TSD_StrokeArchive.self), .optional(4, .uint32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var origin: Int32? { get { self[0] } set { self[0] = newValue } }
+    var length: UInt32? { get { self[1] } set { self[1] = newValue } }
+    var stroke: TSD_StrokeArchive? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var order: UInt32? { get { self[3] } set { self[3] = newValue } }
 }
 
 /// Generated wire model for `TST.StrokeSidecarArchive`.
 final class TST_StrokeSidecarArchive: IWAMessage {
-    var maxOrder: UInt32?
-    var columnCount: UInt32?
-    var rowCount: UInt32?
-    var leftColumnStrokeLayers: [TSP_Reference] = []
-    var rightColumnStrokeLayers: [TSP_Reference] = []
-    var topRowStrokeLayers: [TSP_Reference] = []
-    var bottomRowStrokeLayers: [TSP_Reference] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { maxOrder = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { columnCount = _v }
-        case 3:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { rowCount = _v }
-        case 4:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { leftColumnStrokeLayers.append(_v) }
-        case 5:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { rightColumnStrokeLayers.append(_v) }
-        case 6:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { topRowStrokeLayers.append(_v) }
-        case 7:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { bottomRowStrokeLayers.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = maxOrder { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = columnCount { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = rowCount { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        for _x in leftColumnStrokeLayers { _w.bytesField(4, _x.encoded()) }
-        for _x in rightColumnStrokeLayers { _w.bytesField(5, _x.encoded()) }
-        for _x in topRowStrokeLayers { _w.bytesField(6, _x.encoded()) }
-        for _x in bottomRowStrokeLayers { _w.bytesField(7, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.StrokeSidecarArchive", [
+        .optional(1, .uint32), .optional(2, .uint32), .optional(3, .uint32), .repeated(4, TSP_Reference.self),
+        .repeated(5, TSP_Reference.self), .repeated(6, TSP_Reference.self), .repeated(7, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 7)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var maxOrder: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var columnCount: UInt32? { get { self[1] } set { self[1] = newValue } }
+    var rowCount: UInt32? { get { self[2] } set { self[2] = newValue } }
+    var leftColumnStrokeLayers: [TSP_Reference] { get { self[messages: 3] } set { self[messages: 3] = newValue } }
+    func append(leftColumnStrokeLayers value: TSP_Reference) { append(value, toMessages: 3) }
+    var rightColumnStrokeLayers: [TSP_Reference] { get { self[messages: 4] } set { self[messages: 4] = newValue } }
+    func append(rightColumnStrokeLayers value: TSP_Reference) { append(value, toMessages: 4) }
+    var topRowStrokeLayers: [TSP_Reference] { get { self[messages: 5] } set { self[messages: 5] = newValue } }
+    func append(topRowStrokeLayers value: TSP_Reference) { append(value, toMessages: 5) }
+    var bottomRowStrokeLayers: [TSP_Reference] { get { self[messages: 6] } set { self[messages: 6] = newValue } }
+    func append(bottomRowStrokeLayers value: TSP_Reference) { append(value, toMessages: 6) }
 }
 
 /// Generated wire model for `TST.DurationWrapperArchive`.
 final class TST_DurationWrapperArchive: IWAMessage {
-
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TST.DurationWrapperArchive", [])
+    var _values = [IWAValue](repeating: .absent, count: 0)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
 }
 
 /// Generated wire model for `TST.Cell`.
 final class TST_Cell: IWAMessage {
-    var valuetype: Int32?
-    var cellStyle: TSP_Reference?
-    var textStyle: TSP_Reference?
-    var numbervalue: Double?
-    var stringvalue: String?
-    var boolvalue: Bool?
-    var currentFormat: TSK_FormatStructArchive?
-    var formulaerror: TSP_Reference?
-    var numberFormat: TSK_FormatStructArchive?
-    var currencyFormat: TSK_FormatStructArchive?
-    var durationFormat: TSK_FormatStructArchive?
-    var dateFormat: TSK_FormatStructArchive?
-    var customFormat: TSK_FormatStructArchive?
-    var baseFormat: TSK_FormatStructArchive?
-    var explicitFormatFlags: UInt32?
-    var richtext: TSP_Reference?
-    var conditionalStyle: TSP_Reference?
-    var commentStorage: TSP_Reference?
-    var conditionalStyleAppliedRule: UInt32?
-    var importWarningSet: TST_ImportWarningSetArchive?
-    var customFormatObject: TSK_CustomFormatArchive?
-    var cellBorder: TST_CellBorderArchive?
-    var cellSpec: TST_CellSpecArchive?
-    var cellFormatKind: UInt32?
-    var textFormat: TSK_FormatStructArchive?
-    var booleanFormat: TSK_FormatStructArchive?
-    var decimalValueLow: UInt64?
-    var decimalValueHigh: UInt64?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 2:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { valuetype = _v }
-        case 3:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { cellStyle = _v }
-        case 4:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { textStyle = _v }
-        case 5:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { numbervalue = _v }
-        case 6:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { stringvalue = _v }
-        case 7:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { boolvalue = _v }
-        case 9:
-            var _v: TSK_FormatStructArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_FormatStructArchive(ProtobufMessage(_b)) }
-            if let _v { currentFormat = _v }
-        case 10:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { formulaerror = _v }
-        case 11:
-            var _v: TSK_FormatStructArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_FormatStructArchive(ProtobufMessage(_b)) }
-            if let _v { numberFormat = _v }
-        case 12:
-            var _v: TSK_FormatStructArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_FormatStructArchive(ProtobufMessage(_b)) }
-            if let _v { currencyFormat = _v }
-        case 13:
-            var _v: TSK_FormatStructArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_FormatStructArchive(ProtobufMessage(_b)) }
-            if let _v { durationFormat = _v }
-        case 14:
-            var _v: TSK_FormatStructArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_FormatStructArchive(ProtobufMessage(_b)) }
-            if let _v { dateFormat = _v }
-        case 16:
-            var _v: TSK_FormatStructArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_FormatStructArchive(ProtobufMessage(_b)) }
-            if let _v { customFormat = _v }
-        case 17:
-            var _v: TSK_FormatStructArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_FormatStructArchive(ProtobufMessage(_b)) }
-            if let _v { baseFormat = _v }
-        case 19:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { explicitFormatFlags = _v }
-        case 20:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { richtext = _v }
-        case 21:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { conditionalStyle = _v }
-        case 23:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { commentStorage = _v }
-        case 24:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { conditionalStyleAppliedRule = _v }
-        case 25:
-            var _v: TST_ImportWarningSetArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_ImportWarningSetArchive(ProtobufMessage(_b)) }
-            if let _v { importWarningSet = _v }
-        case 26:
-            var _v: TSK_CustomFormatArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_CustomFormatArchive(ProtobufMessage(_b)) }
-            if let _v { customFormatObject = _v }
-        case 27:
-            var _v: TST_CellBorderArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_CellBorderArchive(ProtobufMessage(_b)) }
-            if let _v { cellBorder = _v }
-        case 28:
-            var _v: TST_CellSpecArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_CellSpecArchive(ProtobufMessage(_b)) }
-            if let _v { cellSpec = _v }
-        case 29:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { cellFormatKind = _v }
-        case 30:
-            var _v: TSK_FormatStructArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_FormatStructArchive(ProtobufMessage(_b)) }
-            if let _v { textFormat = _v }
-        case 31:
-            var _v: TSK_FormatStructArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_FormatStructArchive(ProtobufMessage(_b)) }
-            if let _v { booleanFormat = _v }
-        case 32:
-            var _v: UInt64?
-            if case .varint(let _u) = _f.value { _v = UInt64(truncatingIfNeeded: _u) }
-            if let _v { decimalValueLow = _v }
-        case 33:
-            var _v: UInt64?
-            if case .varint(let _u) = _f.value { _v = UInt64(truncatingIfNeeded: _u) }
-            if let _v { decimalValueHigh = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = valuetype { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = cellStyle { _w.bytesField(3, _x.encoded()) }
-        if let _x = textStyle { _w.bytesField(4, _x.encoded()) }
-        if let _x = numbervalue { _w.fixed64Field(5, _x.bitPattern) }
-        if let _x = stringvalue { _w.stringField(6, _x) }
-        if let _x = boolvalue { _w.varintField(7, _x ? 1 : 0) }
-        if let _x = currentFormat { _w.bytesField(9, _x.encoded()) }
-        if let _x = formulaerror { _w.bytesField(10, _x.encoded()) }
-        if let _x = numberFormat { _w.bytesField(11, _x.encoded()) }
-        if let _x = currencyFormat { _w.bytesField(12, _x.encoded()) }
-        if let _x = durationFormat { _w.bytesField(13, _x.encoded()) }
-        if let _x = dateFormat { _w.bytesField(14, _x.encoded()) }
-        if let _x = customFormat { _w.bytesField(16, _x.encoded()) }
-        if let _x = baseFormat { _w.bytesField(17, _x.encoded()) }
-        if let _x = explicitFormatFlags { _w.varintField(19, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = richtext { _w.bytesField(20, _x.encoded()) }
-        if let _x = conditionalStyle { _w.bytesField(21, _x.encoded()) }
-        if let _x = commentStorage { _w.bytesField(23, _x.encoded()) }
-        if let _x = conditionalStyleAppliedRule { _w.varintField(24, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = importWarningSet { _w.bytesField(25, _x.encoded()) }
-        if let _x = customFormatObject { _w.bytesField(26, _x.encoded()) }
-        if let _x = cellBorder { _w.bytesField(27, _x.encoded()) }
-        if let _x = cellSpec { _w.bytesField(28, _x.encoded()) }
-        if let _x = cellFormatKind { _w.varintField(29, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = textFormat { _w.bytesField(30, _x.encoded()) }
-        if let _x = booleanFormat { _w.bytesField(31, _x.encoded()) }
-        if let _x = decimalValueLow { _w.varintField(32, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = decimalValueHigh { _w.varintField(33, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.Cell", [
+        .optional(2, .int32), .optional(3, TSP_Reference.self), .optional(4, TSP_Reference.self), .optional(5, .double),
+        .optional(6, .string), .optional(7, .bool), .optional(9, TSK_FormatStructArchive.self),
+        .optional(10, TSP_Reference.self), .optional(11, TSK_FormatStructArchive.self),
+        .optional(12, TSK_FormatStructArchive.self), .optional(13, TSK_FormatStructArchive.self),
+        .optional(14, TSK_FormatStructArchive.self), .optional(16, TSK_FormatStructArchive.self),
+        .optional(17, TSK_FormatStructArchive.self), .optional(19, .uint32), .optional(20, TSP_Reference.self),
+        .optional(21, TSP_Reference.self), .optional(23, TSP_Reference.self), .optional(24, .uint32),
+        .optional(25, TST_ImportWarningSetArchive.self), .optional(26, TSK_CustomFormatArchive.self),
+        .optional(27, TST_CellBorderArchive.self), .optional(28, TST_CellSpecArchive.self), .optional(29, .uint32),
+        .optional(30, TSK_FormatStructArchive.self), .optional(31, TSK_FormatStructArchive.self),
+        .optional(32, .uint64), .optional(33, .uint64),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 28)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var valuetype: Int32? { get { self[0] } set { self[0] = newValue } }
+    var cellStyle: TSP_Reference? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var textStyle: TSP_Reference? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var numbervalue: Double? { get { self[3] } set { self[3] = newValue } }
+    var stringvalue: String? { get { self[4] } set { self[4] = newValue } }
+    var boolvalue: Bool? { get { self[5] } set { self[5] = newValue } }
+    var currentFormat: TSK_FormatStructArchive? { get { self[message: 6] } set { self[message: 6] = newValue } }
+    var formulaerror: TSP_Reference? { get { self[message: 7] } set { self[message: 7] = newValue } }
+    var numberFormat: TSK_FormatStructArchive? { get { self[message: 8] } set { self[message: 8] = newValue } }
+    var currencyFormat: TSK_FormatStructArchive? { get { self[message: 9] } set { self[message: 9] = newValue } }
+    var durationFormat: TSK_FormatStructArchive? { get { self[message: 10] } set { self[message: 10] = newValue } }
+    var dateFormat: TSK_FormatStructArchive? { get { self[message: 11] } set { self[message: 11] = newValue } }
+    var customFormat: TSK_FormatStructArchive? { get { self[message: 12] } set { self[message: 12] = newValue } }
+    var baseFormat: TSK_FormatStructArchive? { get { self[message: 13] } set { self[message: 13] = newValue } }
+    var explicitFormatFlags: UInt32? { get { self[14] } set { self[14] = newValue } }
+    var richtext: TSP_Reference? { get { self[message: 15] } set { self[message: 15] = newValue } }
+    var conditionalStyle: TSP_Reference? { get { self[message: 16] } set { self[message: 16] = newValue } }
+    var commentStorage: TSP_Reference? { get { self[message: 17] } set { self[message: 17] = newValue } }
+    var conditionalStyleAppliedRule: UInt32? { get { self[18] } set { self[18] = newValue } }
+    var importWarningSet: TST_ImportWarningSetArchive? { get { self[message: 19] } set { self[message: 19] = newValue } }
+    var customFormatObject: TSK_CustomFormatArchive? { get { self[message: 20] } set { self[message: 20] = newValue } }
+    var cellBorder: TST_CellBorderArchive? { get { self[message: 21] } set { self[message: 21] = newValue } }
+    var cellSpec: TST_CellSpecArchive? { get { self[message: 22] } set { self[message: 22] = newValue } }
+    var cellFormatKind: UInt32? { get { self[23] } set { self[23] = newValue } }
+    var textFormat: TSK_FormatStructArchive? { get { self[message: 24] } set { self[message: 24] = newValue } }
+    var booleanFormat: TSK_FormatStructArchive? { get { self[message: 25] } set { self[message: 25] = newValue } }
+    var decimalValueLow: UInt64? { get { self[26] } set { self[26] = newValue } }
+    var decimalValueHigh: UInt64? { get { self[27] } set { self[27] = newValue } }
 }
 
 /// Generated wire model for `TST.MergeRegionMapArchive`.
 final class TST_MergeRegionMapArchive: IWAMessage {
-    var cellRange: [TST_CellRange] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TST_CellRange?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_CellRange(ProtobufMessage(_b)) }
-            if let _v { cellRange.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in cellRange { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.MergeRegionMapArchive", [
+        .repeated(1, TST_CellRange.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var cellRange: [TST_CellRange] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(cellRange value: TST_CellRange) { append(value, toMessages: 0) }
 }
 
 /// Generated wire model for `TST.CellMapArchive`.
 final class TST_CellMapArchive: IWAMessage {
-    var cellTiles: [TSP_Reference] = []
-    var uidBased: Bool?
-    var expandedCellIds: [TSCE_CellCoordinateArchive] = []
-    var cellUidList: TST_CellUIDListArchive?
-    var mergeUidRanges: [TSP_UUIDRectArchive] = []
-    var unmergeUidRanges: [TSP_UUIDRectArchive] = []
-    var mergeActions: [TST_MergeOperationArchive] = []
-    var mayModifyFormulasInCells: Bool?
-    var mayModifyValuesReferencedByFormulas: Bool?
-    var shouldResetSpillFormulas: Bool?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { cellTiles.append(_v) }
-        case 3:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { uidBased = _v }
-        case 14:
-            var _v: TSCE_CellCoordinateArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CellCoordinateArchive(ProtobufMessage(_b)) }
-            if let _v { expandedCellIds.append(_v) }
-        case 5:
-            var _v: TST_CellUIDListArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_CellUIDListArchive(ProtobufMessage(_b)) }
-            if let _v { cellUidList = _v }
-        case 7:
-            var _v: TSP_UUIDRectArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUIDRectArchive(ProtobufMessage(_b)) }
-            if let _v { mergeUidRanges.append(_v) }
-        case 9:
-            var _v: TSP_UUIDRectArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUIDRectArchive(ProtobufMessage(_b)) }
-            if let _v { unmergeUidRanges.append(_v) }
-        case 13:
-            var _v: TST_MergeOperationArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_MergeOperationArchive(ProtobufMessage(_b)) }
-            if let _v { mergeActions.append(_v) }
-        case 10:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { mayModifyFormulasInCells = _v }
-        case 11:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { mayModifyValuesReferencedByFormulas = _v }
-        case 12:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { shouldResetSpillFormulas = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in cellTiles { _w.bytesField(2, _x.encoded()) }
-        if let _x = uidBased { _w.varintField(3, _x ? 1 : 0) }
-        for _x in expandedCellIds { _w.bytesField(14, _x.encoded()) }
-        if let _x = cellUidList { _w.bytesField(5, _x.encoded()) }
-        for _x in mergeUidRanges { _w.bytesField(7, _x.encoded()) }
-        for _x in unmergeUidRanges { _w.bytesField(9, _x.encoded()) }
-        for _x in mergeActions { _w.bytesField(13, _x.encoded()) }
-        if let _x = mayModifyFormulasInCells { _w.varintField(10, _x ? 1 : 0) }
-        if let _x = mayModifyValuesReferencedByFormulas { _w.varintField(11, _x ? 1 : 0) }
-        if let _x = shouldResetSpillFormulas { _w.varintField(12, _x ? 1 : 0) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.CellMapArchive", [
+        .repeated(2, TSP_Reference.self), .optional(3, .bool), .repeated(14, TSCE_CellCoordinateArchive.self),
+        .optional(5, TST_CellUIDListArchive.self), .repeated(7, TSP_UUIDRectArchive.self),
+        .repeated(9, TSP_UUIDRectArchive.self), .repeated(13, TST_MergeOperationArchive.self), .optional(10, .bool),
+        .optional(11, .bool), .optional(12, .bool),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 10)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var cellTiles: [TSP_Reference] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(cellTiles value: TSP_Reference) { append(value, toMessages: 0) }
+    var uidBased: Bool? { get { self[1] } set { self[1] = newValue } }
+    var expandedCellIds: [TSCE_CellCoordinateArchive] { get { self[messages: 2] } set { self[messages: 2] = newValue } }
+    func append(expandedCellIds value: TSCE_CellCoordinateArchive) { append(value, toMessages: 2) }
+    var cellUidList: TST_CellUIDListArchive? { get { self[message: 3] } set { self[message: 3] = newValue } }
+    var mergeUidRanges: [TSP_UUIDRectArchive] { get { self[messages: 4] } set { self[messages: 4] = newValue } }
+    func append(mergeUidRanges value: TSP_UUIDRectArchive) { append(value, toMessages: 4) }
+    var unmergeUidRanges: [TSP_UUIDRectArchive] { get { self[messages: 5] } set { self[messages: 5] = newValue } }
+    func append(unmergeUidRanges value: TSP_UUIDRectArchive) { append(value, toMessages: 5) }
+    var mergeActions: [TST_MergeOperationArchive] { get { self[messages: 6] } set { self[messages: 6] = newValue } }
+    func append(mergeActions value: TST_MergeOperationArchive) { append(value, toMessages: 6) }
+    var mayModifyFormulasInCells: Bool? { get { self[7] } set { self[7] = newValue } }
+    var mayModifyValuesReferencedByFormulas: Bool? { get { self[8] } set { self[8] = newValue } }
+    var shouldResetSpillFormulas: Bool? { get { self[9] } set { self[9] = newValue } }
 }
 
 /// Generated wire model for `TST.CellListArchive`.
 final class TST_CellListArchive: IWAMessage {
-    var cells: [TST_CellListArchive_OptionalCell] = []
-    var trailingEmptyCellCount: UInt32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TST_CellListArchive_OptionalCell?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_CellListArchive_OptionalCell(ProtobufMessage(_b)) }
-            if let _v { cells.append(_v) }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { trailingEmptyCellCount = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in cells { _w.bytesField(1, _x.encoded()) }
-        if let _x = trailingEmptyCellCount { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.CellListArchive", [
+        .repeated(1, TST_CellListArchive_OptionalCell.self), .optional(2, .uint32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var cells: [TST_CellListArchive_OptionalCell] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(cells value: TST_CellListArchive_OptionalCell) { append(value, toMessages: 0) }
+    var trailingEmptyCellCount: UInt32? { get { self[1] } set { self[1] = newValue } }
 }
 
 /// Generated wire model for `TST.CellListArchive.OptionalCell`.
 final class TST_CellListArchive_OptionalCell: IWAMessage {
-    var cell: TST_Cell?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TST_Cell?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_Cell(ProtobufMessage(_b)) }
-            if let _v { cell = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = cell { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.CellListArchive.OptionalCell", [
+        .optional(1, TST_Cell.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var cell: TST_Cell? { get { self[message: 0] } set { self[message: 0] = newValue } }
 }
 
 /// Generated wire model for `TST.ConcurrentCellMapArchive`.
 final class TST_ConcurrentCellMapArchive: IWAMessage {
-    var cellLists: [TSP_Reference] = []
-    var uidBased: Bool?
-    var mergeActions: [TST_MergeOperationArchive] = []
-    var mayModifyFormulasInCells: Bool?
-    var mayModifyValuesReferencedByFormulas: Bool?
-    var affectsCellBorders: Bool?
-    var skipDirtyingRanges: Bool?
-    var shouldResetSpillFormulas: Bool?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { cellLists.append(_v) }
-        case 2:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { uidBased = _v }
-        case 3:
-            var _v: TST_MergeOperationArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_MergeOperationArchive(ProtobufMessage(_b)) }
-            if let _v { mergeActions.append(_v) }
-        case 4:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { mayModifyFormulasInCells = _v }
-        case 5:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { mayModifyValuesReferencedByFormulas = _v }
-        case 6:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { affectsCellBorders = _v }
-        case 7:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { skipDirtyingRanges = _v }
-        case 8:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { shouldResetSpillFormulas = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in cellLists { _w.bytesField(1, _x.encoded()) }
-        if let _x = uidBased { _w.varintField(2, _x ? 1 : 0) }
-        for _x in mergeActions { _w.bytesField(3, _x.encoded()) }
-        if let _x = mayModifyFormulasInCells { _w.varintField(4, _x ? 1 : 0) }
-        if let _x = mayModifyValuesReferencedByFormulas { _w.varintField(5, _x ? 1 : 0) }
-        if let _x = affectsCellBorders { _w.varintField(6, _x ? 1 : 0) }
-        if let _x = skipDirtyingRanges { _w.varintField(7, _x ? 1 : 0) }
-        if let _x = shouldResetSpillFormulas { _w.varintField(8, _x ? 1 : 0) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.ConcurrentCellMapArchive", [
+        .repeated(1, TSP_Reference.self), .optional(2, .bool), .repeated(3, TST_MergeOperationArchive.self),
+        .optional(4, .bool), .optional(5, .bool), .optional(6, .bool), .optional(7, .bool), .optional(8, .bool),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 8)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var cellLists: [TSP_Reference] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(cellLists value: TSP_Reference) { append(value, toMessages: 0) }
+    var uidBased: Bool? { get { self[1] } set { self[1] = newValue } }
+    var mergeActions: [TST_MergeOperationArchive] { get { self[messages: 2] } set { self[messages: 2] = newValue } }
+    func append(mergeActions value: TST_MergeOperationArchive) { append(value, toMessages: 2) }
+    var mayModifyFormulasInCells: Bool? { get { self[3] } set { self[3] = newValue } }
+    var mayModifyValuesReferencedByFormulas: Bool? { get { self[4] } set { self[4] = newValue } }
+    var affectsCellBorders: Bool? { get { self[5] } set { self[5] = newValue } }
+    var skipDirtyingRanges: Bool? { get { self[6] } set { self[6] = newValue } }
+    var shouldResetSpillFormulas: Bool? { get { self[7] } set { self[7] = newValue } }
 }
 
 /// Generated wire model for `TST.ConcurrentCellListArchive`.
 final class TST_ConcurrentCellListArchive: IWAMessage {
-    var cells: [TST_ConcurrentCellListArchive_OptionalCell] = []
-    var cellUidRange: TSP_UUIDRectArchive?
-    var cellRange: TST_CellRange?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TST_ConcurrentCellListArchive_OptionalCell?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_ConcurrentCellListArchive_OptionalCell(ProtobufMessage(_b)) }
-            if let _v { cells.append(_v) }
-        case 2:
-            var _v: TSP_UUIDRectArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUIDRectArchive(ProtobufMessage(_b)) }
-            if let _v { cellUidRange = _v }
-        case 3:
-            var _v: TST_CellRange?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_CellRange(ProtobufMessage(_b)) }
-            if let _v { cellRange = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in cells { _w.bytesField(1, _x.encoded()) }
-        if let _x = cellUidRange { _w.bytesField(2, _x.encoded()) }
-        if let _x = cellRange { _w.bytesField(3, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.ConcurrentCellListArchive", [
+        .repeated(1, TST_ConcurrentCellListArchive_OptionalCell.self), .optional(2, TSP_UUIDRectArchive.self),
+        .optional(3, TST_CellRange.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var cells: [TST_ConcurrentCellListArchive_OptionalCell] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(cells value: TST_ConcurrentCellListArchive_OptionalCell) { append(value, toMessages: 0) }
+    var cellUidRange: TSP_UUIDRectArchive? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var cellRange: TST_CellRange? { get { self[message: 2] } set { self[message: 2] = newValue } }
 }
 
 /// Generated wire model for `TST.ConcurrentCellListArchive.OptionalCell`.
 final class TST_ConcurrentCellListArchive_OptionalCell: IWAMessage {
-    var cell: TST_Cell?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TST_Cell?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_Cell(ProtobufMessage(_b)) }
-            if let _v { cell = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = cell { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.ConcurrentCellListArchive.OptionalCell", [
+        .optional(1, TST_Cell.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var cell: TST_Cell? { get { self[message: 0] } set { self[message: 0] = newValue } }
 }
 
 /// Generated wire model for `TST.CellFormatAndValueArchive`.
 final class TST_CellFormatAndValueArchive: IWAMessage {
-    var valuetype: Int32?
-    var numbervalue: Double?
-    var stringvalue: String?
-    var boolvalue: Bool?
-    var richtextstorage: TSP_Reference?
-    var useAllSpareFormats: Bool?
-    var explicitFlags: UInt32?
-    var cellFormatKind: UInt32?
-    var numberFormat: TSK_FormatStructArchive?
-    var currencyFormat: TSK_FormatStructArchive?
-    var dateFormat: TSK_FormatStructArchive?
-    var durationFormat: TSK_FormatStructArchive?
-    var textFormat: TSK_FormatStructArchive?
-    var booleanFormat: TSK_FormatStructArchive?
-    var formattedValue: String?
-    var formattedRichTextValue: TSP_Reference?
-    var applySpareFormatOnly: Bool?
-    var spareFormatType: Bool?
-    var decimalLow: UInt64?
-    var decimalHigh: UInt64?
-    var suppressApplyValue: Bool?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { valuetype = _v }
-        case 2:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { numbervalue = _v }
-        case 3:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { stringvalue = _v }
-        case 4:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { boolvalue = _v }
-        case 5:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { richtextstorage = _v }
-        case 6:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { useAllSpareFormats = _v }
-        case 7:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { explicitFlags = _v }
-        case 8:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { cellFormatKind = _v }
-        case 10:
-            var _v: TSK_FormatStructArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_FormatStructArchive(ProtobufMessage(_b)) }
-            if let _v { numberFormat = _v }
-        case 11:
-            var _v: TSK_FormatStructArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_FormatStructArchive(ProtobufMessage(_b)) }
-            if let _v { currencyFormat = _v }
-        case 12:
-            var _v: TSK_FormatStructArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_FormatStructArchive(ProtobufMessage(_b)) }
-            if let _v { dateFormat = _v }
-        case 13:
-            var _v: TSK_FormatStructArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_FormatStructArchive(ProtobufMessage(_b)) }
-            if let _v { durationFormat = _v }
-        case 14:
-            var _v: TSK_FormatStructArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_FormatStructArchive(ProtobufMessage(_b)) }
-            if let _v { textFormat = _v }
-        case 15:
-            var _v: TSK_FormatStructArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_FormatStructArchive(ProtobufMessage(_b)) }
-            if let _v { booleanFormat = _v }
-        case 16:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { formattedValue = _v }
-        case 17:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { formattedRichTextValue = _v }
-        case 18:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { applySpareFormatOnly = _v }
-        case 19:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { spareFormatType = _v }
-        case 20:
-            var _v: UInt64?
-            if case .varint(let _u) = _f.value { _v = UInt64(truncatingIfNeeded: _u) }
-            if let _v { decimalLow = _v }
-        case 21:
-            var _v: UInt64?
-            if case .varint(let _u) = _f.value { _v = UInt64(truncatingIfNeeded: _u) }
-            if let _v { decimalHigh = _v }
-        case 22:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { suppressApplyValue = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = valuetype { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = numbervalue { _w.fixed64Field(2, _x.bitPattern) }
-        if let _x = stringvalue { _w.stringField(3, _x) }
-        if let _x = boolvalue { _w.varintField(4, _x ? 1 : 0) }
-        if let _x = richtextstorage { _w.bytesField(5, _x.encoded()) }
-        if let _x = useAllSpareFormats { _w.varintField(6, _x ? 1 : 0) }
-        if let _x = explicitFlags { _w.varintField(7, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = cellFormatKind { _w.varintField(8, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = numberFormat { _w.bytesField(10, _x.encoded()) }
-        if let _x = currencyFormat { _w.bytesField(11, _x.encoded()) }
-        if let _x = dateFormat { _w.bytesField(12, _x.encoded()) }
-        if let _x = durationFormat { _w.bytesField(13, _x.encoded()) }
-        if let _x = textFormat { _w.bytesField(14, _x.encoded()) }
-        if let _x = booleanFormat { _w.bytesField(15, _x.encoded()) }
-        if let _x = formattedValue { _w.stringField(16, _x) }
-        if let _x = formattedRichTextValue { _w.bytesField(17, _x.encoded()) }
-        if let _x = applySpareFormatOnly { _w.varintField(18, _x ? 1 : 0) }
-        if let _x = spareFormatType { _w.varintField(19, _x ? 1 : 0) }
-        if let _x = decimalLow { _w.varintField(20, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = decimalHigh { _w.varintField(21, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = suppressApplyValue { _w.varintField(22, _x ? 1 : 0) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.CellFormatAndValueArchive", [
+        .optional(1, .int32), .optional(2, .double), .optional(3, .string), .optional(4, .bool),
+        .optional(5, TSP_Reference.self), .optional(6, .bool), .optional(7, .uint32), .optional(8, .uint32),
+        .optional(10, TSK_FormatStructArchive.self), .optional(11, TSK_FormatStructArchive.self),
+        .optional(12, TSK_FormatStructArchive.self), .optional(13, TSK_FormatStructArchive.self),
+        .optional(14, TSK_FormatStructArchive.self), .optional(15, TSK_FormatStructArchive.self),
+        .optional(16, .string), .optional(17, TSP_Reference.self), .optional(18, .bool), .optional(19, .bool),
+        .optional(20, .uint64), .optional(21, .uint64), .optional(22, .bool),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 21)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var valuetype: Int32? { get { self[0] } set { self[0] = newValue } }
+    var numbervalue: Double? { get { self[1] } set { self[1] = newValue } }
+    var stringvalue: String? { get { self[2] } set { self[2] = newValue } }
+    var boolvalue: Bool? { get { self[3] } set { self[3] = newValue } }
+    var richtextstorage: TSP_Reference? { get { self[message: 4] } set { self[message: 4] = newValue } }
+    var useAllSpareFormats: Bool? { get { self[5] } set { self[5] = newValue } }
+    var explicitFlags: UInt32? { get { self[6] } set { self[6] = newValue } }
+    var cellFormatKind: UInt32? { get { self[7] } set { self[7] = newValue } }
+    var numberFormat: TSK_FormatStructArchive? { get { self[message: 8] } set { self[message: 8] = newValue } }
+    var currencyFormat: TSK_FormatStructArchive? { get { self[message: 9] } set { self[message: 9] = newValue } }
+    var dateFormat: TSK_FormatStructArchive? { get { self[message: 10] } set { self[message: 10] = newValue } }
+    var durationFormat: TSK_FormatStructArchive? { get { self[message: 11] } set { self[message: 11] = newValue } }
+    var textFormat: TSK_FormatStructArchive? { get { self[message: 12] } set { self[message: 12] = newValue } }
+    var booleanFormat: TSK_FormatStructArchive? { get { self[message: 13] } set { self[message: 13] = newValue } }
+    var formattedValue: String? { get { self[14] } set { self[14] = newValue } }
+    var formattedRichTextValue: TSP_Reference? { get { self[message: 15] } set { self[message: 15] = newValue } }
+    var applySpareFormatOnly: Bool? { get { self[16] } set { self[16] = newValue } }
+    var spareFormatType: Bool? { get { self[17] } set { self[17] = newValue } }
+    var decimalLow: UInt64? { get { self[18] } set { self[18] = newValue } }
+    var decimalHigh: UInt64? { get { self[19] } set { self[19] = newValue } }
+    var suppressApplyValue: Bool? { get { self[20] } set { self[20] = newValue } }
 }
 
 /// Generated wire model for `TST.CellSpecArchive`.
 final class TST_CellSpecArchive: IWAMessage {
-    var interactionType: UInt32?
-    var formula: TSCE_FormulaArchive?
-    var rangeControlMin: Double?
-    var rangeControlMax: Double?
-    var rangeControlInc: Double?
-    var chooserControlPopupModel: TSP_Reference?
-    var chooserControlStartWFirst: Bool?
-    var categorySummaryShouldDisplayLabel: Bool?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { interactionType = _v }
-        case 2:
-            var _v: TSCE_FormulaArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_FormulaArchive(ProtobufMessage(_b)) }
-            if let _v { formula = _v }
-        case 3:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { rangeControlMin = _v }
-        case 4:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { rangeControlMax = _v }
-        case 5:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { rangeControlInc = _v }
-        case 6:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { chooserControlPopupModel = _v }
-        case 7:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { chooserControlStartWFirst = _v }
-        case 8:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { categorySummaryShouldDisplayLabel = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = interactionType { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = formula { _w.bytesField(2, _x.encoded()) }
-        if let _x = rangeControlMin { _w.fixed64Field(3, _x.bitPattern) }
-        if let _x = rangeControlMax { _w.fixed64Field(4, _x.bitPattern) }
-        if let _x = rangeControlInc { _w.fixed64Field(5, _x.bitPattern) }
-        if let _x = chooserControlPopupModel { _w.bytesField(6, _x.encoded()) }
-        if let _x = chooserControlStartWFirst { _w.varintField(7, _x ? 1 : 0) }
-        if let _x = categorySummaryShouldDisplayLabel { _w.varintField(8, _x ? 1 : 0) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.CellSpecArchive", [
+        .optional(1, .uint32), .optional(2, TSCE_FormulaArchive.self), .optional(3, .double), .optional(4, .double),
+        .optional(5, .double), .optional(6, TSP_Reference.self), .optional(7, .bool), .optional(8, .bool),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 8)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var interactionType: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var formula: TSCE_FormulaArchive? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var rangeControlMin: Double? { get { self[2] } set { self[2] = newValue } }
+    var rangeControlMax: Double? { get { self[3] } set { self[3] = newValue } }
+    var rangeControlInc: Double? { get { self[4] } set { self[4] = newValue } }
+    var chooserControlPopupModel: TSP_Reference? { get { self[message: 5] } set { self[message: 5] = newValue } }
+    var chooserControlStartWFirst: Bool? { get { self[6] } set { self[6] = newValue } }
+    var categorySummaryShouldDisplayLabel: Bool? { get { self[7] } set { self[7] = newValue } }
 }
 
 /// Generated wire model for `TST.CommentStorageWrapperArchive`.
 final class TST_CommentStorageWrapperArchive: IWAMessage {
-    var commentStorage: TSP_Reference?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { commentStorage = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = commentStorage { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.CommentStorageWrapperArchive", [
+        .optional(1, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var commentStorage: TSP_Reference? { get { self[message: 0] } set { self[message: 0] = newValue } }
 }
 
 /// Generated wire model for `TST.CellDiffArchive`.
 final class TST_CellDiffArchive: IWAMessage {
-    var propertyMapToSet: TSS_CommandPropertyMapArchive?
-    var propertyMapToReset: TSS_CommandPropertyMapArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSS_CommandPropertyMapArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSS_CommandPropertyMapArchive(ProtobufMessage(_b)) }
-            if let _v { propertyMapToSet = _v }
-        case 2:
-            var _v: TSS_CommandPropertyMapArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSS_CommandPropertyMapArchive(ProtobufMessage(_b)) }
-            if let _v { propertyMapToReset = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = propertyMapToSet { _w.bytesField(1, _x.encoded()) }
-        if let _x = propertyMapToReset { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.CellDiffArchive", [
+        .optional(1, TSS_CommandPropertyMapArchive.self), .optional(2, TSS_CommandPropertyMapArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var propertyMapToSet: TSS_CommandPropertyMapArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var propertyMapToReset: TSS_CommandPropertyMapArchive? { get { self[message: 1] } set { self[message: 1] = newValue } }
 }
 
 /// Generated wire model for `TST.CellDiffArray`.
 final class TST_CellDiffArray: IWAMessage {
-    var largeArray: TSP_LargeArray?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_LargeArray?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_LargeArray(ProtobufMessage(_b)) }
-            if let _v { largeArray = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = largeArray { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.CellDiffArray", [
+        .optional(1, TSP_LargeArray.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var largeArray: TSP_LargeArray? { get { self[message: 0] } set { self[message: 0] = newValue } }
 }
 
 /// Generated wire model for `TST.CellDiffArraySegment`.
 final class TST_CellDiffArraySegment: IWAMessage {
-    var largeArraySegment: TSP_LargeArraySegment?
-    var elements: [TST_CellDiffArchive] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_LargeArraySegment?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_LargeArraySegment(ProtobufMessage(_b)) }
-            if let _v { largeArraySegment = _v }
-        case 2:
-            var _v: TST_CellDiffArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_CellDiffArchive(ProtobufMessage(_b)) }
-            if let _v { elements.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = largeArraySegment { _w.bytesField(1, _x.encoded()) }
-        for _x in elements { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.CellDiffArraySegment", [
+        .optional(1, TSP_LargeArraySegment.self), .repeated(2, TST_CellDiffArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var largeArraySegment: TSP_LargeArraySegment? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var elements: [TST_CellDiffArchive] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(elements value: TST_CellDiffArchive) { append(value, toMessages: 1) }
 }
 
 /// Generated wire model for `TST.CellDiffMapArchive`.
 final class TST_CellDiffMapArchive: IWAMessage {
-    var uidBased: Bool?
-    var expandedCellIds: [TSCE_CellCoordinateArchive] = []
-    var cellUids: TST_CellUIDListArchive?
-    var cellDiffArray: TSP_Reference?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { uidBased = _v }
-        case 2:
-            var _v: TSCE_CellCoordinateArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CellCoordinateArchive(ProtobufMessage(_b)) }
-            if let _v { expandedCellIds.append(_v) }
-        case 3:
-            var _v: TST_CellUIDListArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_CellUIDListArchive(ProtobufMessage(_b)) }
-            if let _v { cellUids = _v }
-        case 4:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { cellDiffArray = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = uidBased { _w.varintField(1, _x ? 1 : 0) }
-        for _x in expandedCellIds { _w.bytesField(2, _x.encoded()) }
-        if let _x = cellUids { _w.bytesField(3, _x.encoded()) }
-        if let _x = cellDiffArray { _w.bytesField(4, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.CellDiffMapArchive", [
+        .optional(1, .bool), .repeated(2, TSCE_CellCoordinateArchive.self), .optional(3, TST_CellUIDListArchive.self),
+        .optional(4, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var uidBased: Bool? { get { self[0] } set { self[0] = newValue } }
+    var expandedCellIds: [TSCE_CellCoordinateArchive] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(expandedCellIds value: TSCE_CellCoordinateArchive) { append(value, toMessages: 1) }
+    var cellUids: TST_CellUIDListArchive? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var cellDiffArray: TSP_Reference? { get { self[message: 3] } set { self[message: 3] = newValue } }
 }
 
 /// Generated wire model for `TST.HierarchicalCellDiffMapArchive`.
 final class TST_HierarchicalCellDiffMapArchive: IWAMessage {
-    var numRowRules: Int32?
-    var numColumnRules: Int32?
-    var rowHeaderUids: [TSP_UUID] = []
-    var columnHeaderUids: [TSP_UUID] = []
-    var aggregateRuleUids: [TSP_UUID] = []
-    var activeFlatteningDimension: Int32?
-    var rowValueUids: [TSP_UUID] = []
-    var rowLevelPreorder: [UInt32] = []
-    var columnValueUids: [TSP_UUID] = []
-    var columnLevelPreorder: [UInt32] = []
-    var cellDiffStorage: [TST_HierarchicalCellDiffMapArchive_BoxedRow] = []
-    var rowSizes: [Double] = []
-    var columnSizes: [Double] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { numRowRules = _v }
-        case 2:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { numColumnRules = _v }
-        case 3:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { rowHeaderUids.append(_v) }
-        case 4:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { columnHeaderUids.append(_v) }
-        case 5:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { aggregateRuleUids.append(_v) }
-        case 6:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { activeFlatteningDimension = _v }
-        case 7:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { rowValueUids.append(_v) }
-        case 8:
-            if case .varint(let _u) = _f.value { rowLevelPreorder.append(UInt32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { rowLevelPreorder.append(UInt32(truncatingIfNeeded: _u)) } }
-        case 9:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { columnValueUids.append(_v) }
-        case 10:
-            if case .varint(let _u) = _f.value { columnLevelPreorder.append(UInt32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { columnLevelPreorder.append(UInt32(truncatingIfNeeded: _u)) } }
-        case 11:
-            var _v: TST_HierarchicalCellDiffMapArchive_BoxedRow?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_HierarchicalCellDiffMapArchive_BoxedRow(ProtobufMessage(_b)) }
-            if let _v { cellDiffStorage.append(_v) }
-        case 12:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { rowSizes.append(_v) }
-        case 13:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { columnSizes.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = numRowRules { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = numColumnRules { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        for _x in rowHeaderUids { _w.bytesField(3, _x.encoded()) }
-        for _x in columnHeaderUids { _w.bytesField(4, _x.encoded()) }
-        for _x in aggregateRuleUids { _w.bytesField(5, _x.encoded()) }
-        if let _x = activeFlatteningDimension { _w.varintField(6, UInt64(truncatingIfNeeded: _x)) }
-        for _x in rowValueUids { _w.bytesField(7, _x.encoded()) }
-        for _x in rowLevelPreorder { _w.varintField(8, UInt64(truncatingIfNeeded: _x)) }
-        for _x in columnValueUids { _w.bytesField(9, _x.encoded()) }
-        for _x in columnLevelPreorder { _w.varintField(10, UInt64(truncatingIfNeeded: _x)) }
-        for _x in cellDiffStorage { _w.bytesField(11, _x.encoded()) }
-        for _x in rowSizes { _w.fixed64Field(12, _x.bitPattern) }
-        for _x in columnSizes { _w.fixed64Field(13, _x.bitPattern) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.HierarchicalCellDiffMapArchive", [
+        .optional(1, .int32), .optional(2, .int32), .repeated(3, TSP_UUID.self), .repeated(4, TSP_UUID.self),
+        .repeated(5, TSP_UUID.self), .optional(6, .int32), .repeated(7, TSP_UUID.self), .repeated(8, .uint32),
+        .repeated(9, TSP_UUID.self), .repeated(10, .uint32),
+        .repeated(11, TST_HierarchicalCellDiffMapArchive_BoxedRow.self), .repeated(12, .double), .repeated(13, .double),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 13)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var numRowRules: Int32? { get { self[0] } set { self[0] = newValue } }
+    var numColumnRules: Int32? { get { self[1] } set { self[1] = newValue } }
+    var rowHeaderUids: [TSP_UUID] { get { self[messages: 2] } set { self[messages: 2] = newValue } }
+    func append(rowHeaderUids value: TSP_UUID) { append(value, toMessages: 2) }
+    var columnHeaderUids: [TSP_UUID] { get { self[messages: 3] } set { self[messages: 3] = newValue } }
+    func append(columnHeaderUids value: TSP_UUID) { append(value, toMessages: 3) }
+    var aggregateRuleUids: [TSP_UUID] { get { self[messages: 4] } set { self[messages: 4] = newValue } }
+    func append(aggregateRuleUids value: TSP_UUID) { append(value, toMessages: 4) }
+    var activeFlatteningDimension: Int32? { get { self[5] } set { self[5] = newValue } }
+    var rowValueUids: [TSP_UUID] { get { self[messages: 6] } set { self[messages: 6] = newValue } }
+    func append(rowValueUids value: TSP_UUID) { append(value, toMessages: 6) }
+    var rowLevelPreorder: [UInt32] { get { self[all: 7] } set { self[all: 7] = newValue } }
+    func append(rowLevelPreorder value: UInt32) { append(value, toAll: 7) }
+    var columnValueUids: [TSP_UUID] { get { self[messages: 8] } set { self[messages: 8] = newValue } }
+    func append(columnValueUids value: TSP_UUID) { append(value, toMessages: 8) }
+    var columnLevelPreorder: [UInt32] { get { self[all: 9] } set { self[all: 9] = newValue } }
+    func append(columnLevelPreorder value: UInt32) { append(value, toAll: 9) }
+    var cellDiffStorage: [TST_HierarchicalCellDiffMapArchive_BoxedRow] { get { self[messages: 10] } set { self[messages: 10] = newValue } }
+    func append(cellDiffStorage value: TST_HierarchicalCellDiffMapArchive_BoxedRow) { append(value, toMessages: 10) }
+    var rowSizes: [Double] { get { self[all: 11] } set { self[all: 11] = newValue } }
+    func append(rowSizes value: Double) { append(value, toAll: 11) }
+    var columnSizes: [Double] { get { self[all: 12] } set { self[all: 12] = newValue } }
+    func append(columnSizes value: Double) { append(value, toAll: 12) }
 }
 
 /// Generated wire model for `TST.HierarchicalCellDiffMapArchive.BoxedRow`.
 final class TST_HierarchicalCellDiffMapArchive_BoxedRow: IWAMessage {
-    var columnIndexSet: TSP_IndexSet?
-    var cellDiffList: [TST_CellDiffArchive] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_IndexSet?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_IndexSet(ProtobufMessage(_b)) }
-            if let _v { columnIndexSet = _v }
-        case 2:
-            var _v: TST_CellDiffArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_CellDiffArchive(ProtobufMessage(_b)) }
-            if let _v { cellDiffList.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = columnIndexSet { _w.bytesField(1, _x.encoded()) }
-        for _x in cellDiffList { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.HierarchicalCellDiffMapArchive.BoxedRow", [
+        .optional(1, TSP_IndexSet.self), .repeated(2, TST_CellDiffArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var columnIndexSet: TSP_IndexSet? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var cellDiffList: [TST_CellDiffArchive] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(cellDiffList value: TST_CellDiffArchive) { append(value, toMessages: 1) }
 }
 
 /// Generated wire model for `TST.DoubleStyleMapArchive`.
 final class TST_DoubleStyleMapArchive: IWAMessage {
-    var capacity: UInt32?
-    var count: UInt32?
-    var cellMapEntry: [TST_DoubleStyleMapArchive_DoubleStyleMapEntryArchive] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { capacity = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { count = _v }
-        case 3:
-            var _v: TST_DoubleStyleMapArchive_DoubleStyleMapEntryArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_DoubleStyleMapArchive_DoubleStyleMapEntryArchive(ProtobufMessage(_b)) }
-            if let _v { cellMapEntry.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = capacity { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = count { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        for _x in cellMapEntry { _w.bytesField(3, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.DoubleStyleMapArchive", [
+        .optional(1, .uint32), .optional(2, .uint32),
+        .repeated(3, TST_DoubleStyleMapArchive_DoubleStyleMapEntryArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var capacity: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var count: UInt32? { get { self[1] } set { self[1] = newValue } }
+    var cellMapEntry: [TST_DoubleStyleMapArchive_DoubleStyleMapEntryArchive] { get { self[messages: 2] } set { self[messages: 2] = newValue } }
+    func append(cellMapEntry value: TST_DoubleStyleMapArchive_DoubleStyleMapEntryArchive) { append(value, toMessages: 2) }
 }
 
 /// Generated wire model for `TST.DoubleStyleMapArchive.DoubleStyleMapEntryArchive`.
 final class TST_DoubleStyleMapArchive_DoubleStyleMapEntryArchive: IWAMessage {
-    var cellId: TST_CellID?
-    var oldStyle: TSP_Reference?
-    var newStyle: TSP_Reference?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TST_CellID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_CellID(ProtobufMessage(_b)) }
-            if let _v { cellId = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { oldStyle = _v }
-        case 3:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { newStyle = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = cellId { _w.bytesField(1, _x.encoded()) }
-        if let _x = oldStyle { _w.bytesField(2, _x.encoded()) }
-        if let _x = newStyle { _w.bytesField(3, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.DoubleStyleMapArchive.DoubleStyleMapEntryArchive", [
+        .optional(1, TST_CellID.self), .optional(2, TSP_Reference.self), .optional(3, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var cellId: TST_CellID? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var oldStyle: TSP_Reference? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var newStyle: TSP_Reference? { get { self[message: 2] } set { self[message: 2] = newValue } }
 }
 
 /// Generated wire model for `TST.StyleTableMapArchive`.
 final class TST_StyleTableMapArchive: IWAMessage {
-    var capacity: UInt32?
-    var count: UInt32?
-    var mapEntry: [TST_StyleTableMapArchive_StyleTableMapEntryArchive] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { capacity = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { count = _v }
-        case 3:
-            var _v: TST_StyleTableMapArchive_StyleTableMapEntryArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_StyleTableMapArchive_StyleTableMapEntryArchive(ProtobufMessage(_b)) }
-            if let _v { mapEntry.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = capacity { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = count { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        for _x in mapEntry { _w.bytesField(3, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.StyleTableMapArchive", [
+        .optional(1, .uint32), .optional(2, .uint32),
+        .repeated(3, TST_StyleTableMapArchive_StyleTableMapEntryArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var capacity: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var count: UInt32? { get { self[1] } set { self[1] = newValue } }
+    var mapEntry: [TST_StyleTableMapArchive_StyleTableMapEntryArchive] { get { self[messages: 2] } set { self[messages: 2] = newValue } }
+    func append(mapEntry value: TST_StyleTableMapArchive_StyleTableMapEntryArchive) { append(value, toMessages: 2) }
 }
 
 /// Generated wire model for `TST.StyleTableMapArchive.StyleTableMapEntryArchive`.
 final class TST_StyleTableMapArchive_StyleTableMapEntryArchive: IWAMessage {
-    var key: UInt32?
-    var oldStyle: TSP_Reference?
-    var newStyle: TSP_Reference?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { key = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { oldStyle = _v }
-        case 3:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { newStyle = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = key { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = oldStyle { _w.bytesField(2, _x.encoded()) }
-        if let _x = newStyle { _w.bytesField(3, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.StyleTableMapArchive.StyleTableMapEntryArchive", [
+        .optional(1, .uint32), .optional(2, TSP_Reference.self), .optional(3, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var key: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var oldStyle: TSP_Reference? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var newStyle: TSP_Reference? { get { self[message: 2] } set { self[message: 2] = newValue } }
 }
 
 /// Generated wire model for `TST.SelectionArchive`.
 final class TST_SelectionArchive: IWAMessage {
-    var tablemodel: TSP_Reference?
-    var selectionType: Int32?
-    var anchorCell: TST_CellID?
-    var cellRanges: [TST_CellRange] = []
-    var baseRanges: [TST_CellRange] = []
-    var cursorCell: TST_CellID?
-    var tableInfo: TSP_Reference?
-    var cellUidRegion: TST_CellUIDRegionArchive?
-    var baseUidRegion: TST_CellUIDRegionArchive?
-    var anchorCellUid: TSP_UUIDCoordArchive?
-    var cursorCellUid: TSP_UUIDCoordArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { tablemodel = _v }
-        case 4:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { selectionType = _v }
-        case 5:
-            var _v: TST_CellID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_CellID(ProtobufMessage(_b)) }
-            if let _v { anchorCell = _v }
-        case 6:
-            var _v: TST_CellRange?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_CellRange(ProtobufMessage(_b)) }
-            if let _v { cellRanges.append(_v) }
-        case 7:
-            var _v: TST_CellRange?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_CellRange(ProtobufMessage(_b)) }
-            if let _v { baseRanges.append(_v) }
-        case 8:
-            var _v: TST_CellID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_CellID(ProtobufMessage(_b)) }
-            if let _v { cursorCell = _v }
-        case 9:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { tableInfo = _v }
-        case 10:
-            var _v: TST_CellUIDRegionArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_CellUIDRegionArchive(ProtobufMessage(_b)) }
-            if let _v { cellUidRegion = _v }
-        case 11:
-            var _v: TST_CellUIDRegionArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_CellUIDRegionArchive(ProtobufMessage(_b)) }
-            if let _v { baseUidRegion = _v }
-        case 12:
-            var _v: TSP_UUIDCoordArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUIDCoordArchive(ProtobufMessage(_b)) }
-            if let _v { anchorCellUid = _v }
-        case 13:
-            var _v: TSP_UUIDCoordArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUIDCoordArchive(ProtobufMessage(_b)) }
-            if let _v { cursorCellUid = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = tablemodel { _w.bytesField(1, _x.encoded()) }
-        if let _x = selectionType { _w.varintField(4, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = anchorCell { _w.bytesField(5, _x.encoded()) }
-        for _x in cellRanges { _w.bytesField(6, _x.encoded()) }
-        for _x in baseRanges { _w.bytesField(7, _x.encoded()) }
-        if let _x = cursorCell { _w.bytesField(8, _x.encoded()) }
-        if let _x = tableInfo { _w.bytesField(9, _x.encoded()) }
-        if let _x = cellUidRegion { _w.bytesField(10, _x.encoded()) }
-        if let _x = baseUidRegion { _w.bytesField(11, _x.encoded()) }
-        if let _x = anchorCellUid { _w.bytesField(12, _x.encoded()) }
-        if let _x = cursorCellUid { _w.bytesField(13, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.SelectionArchive", [
+        .optional(1, TSP_Reference.self), .optional(4, .int32), .optional(5, TST_CellID.self),
+        .repeated(6, TST_CellRange.self), .repeated(7, TST_CellRange.self), .optional(8, TST_CellID.self),
+        .optional(9, TSP_Reference.self), .optional(10, TST_CellUIDRegionArchive.self),
+        .optional(11, TST_CellUIDRegionArchive.self), .optional(12, TSP_UUIDCoordArchive.self),
+        .optional(13, TSP_UUIDCoordArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 11)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var tablemodel: TSP_Reference? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var selectionType: Int32? { get { self[1] } set { self[1] = newValue } }
+    var anchorCell: TST_CellID? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var cellRanges: [TST_CellRange] { get { self[messages: 3] } set { self[messages: 3] = newValue } }
+    func append(cellRanges value: TST_CellRange) { append(value, toMessages: 3) }
+    var baseRanges: [TST_CellRange] { get { self[messages: 4] } set { self[messages: 4] = newValue } }
+    func append(baseRanges value: TST_CellRange) { append(value, toMessages: 4) }
+    var cursorCell: TST_CellID? { get { self[message: 5] } set { self[message: 5] = newValue } }
+    var tableInfo: TSP_Reference? { get { self[message: 6] } set { self[message: 6] = newValue } }
+    var cellUidRegion: TST_CellUIDRegionArchive? { get { self[message: 7] } set { self[message: 7] = newValue } }
+    var baseUidRegion: TST_CellUIDRegionArchive? { get { self[message: 8] } set { self[message: 8] = newValue } }
+    var anchorCellUid: TSP_UUIDCoordArchive? { get { self[message: 9] } set { self[message: 9] = newValue } }
+    var cursorCellUid: TSP_UUIDCoordArchive? { get { self[message: 10] } set { self[message: 10] = newValue } }
 }
 
 /// Generated wire model for `TST.DeathhawkRdar39989167CellSelectionArchive`.
 final class TST_DeathhawkRdar39989167CellSelectionArchive: IWAMessage {
-    var tableInfo: TSP_Reference?
-    var selectionType: Int32?
-    var cellUidRegion: TST_CellUIDRegionArchive?
-    var baseUidRegion: TST_CellUIDRegionArchive?
-    var anchorCellUid: TSP_UUIDCoordArchive?
-    var cursorCellUid: TSP_UUIDCoordArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { tableInfo = _v }
-        case 2:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { selectionType = _v }
-        case 3:
-            var _v: TST_CellUIDRegionArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_CellUIDRegionArchive(ProtobufMessage(_b)) }
-            if let _v { cellUidRegion = _v }
-        case 4:
-            var _v: TST_CellUIDRegionArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_CellUIDRegionArchive(ProtobufMessage(_b)) }
-            if let _v { baseUidRegion = _v }
-        case 5:
-            var _v: TSP_UUIDCoordArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUIDCoordArchive(ProtobufMessage(_b)) }
-            if let _v { anchorCellUid = _v }
-        case 6:
-            var _v: TSP_UUIDCoordArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUIDCoordArchive(ProtobufMessage(_b)) }
-            if let _v { cursorCellUid = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = tableInfo { _w.bytesField(1, _x.encoded()) }
-        if let _x = selectionType { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = cellUidRegion { _w.bytesField(3, _x.encoded()) }
-        if let _x = baseUidRegion { _w.bytesField(4, _x.encoded()) }
-        if let _x = anchorCellUid { _w.bytesField(5, _x.encoded()) }
-        if let _x = cursorCellUid { _w.bytesField(6, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.DeathhawkRdar39989167CellSelectionArchive", [
+        .optional(1, TSP_Reference.self), .optional(2, .int32), .optional(3, TST_CellUIDRegionArchive.self),
+        .optional(4, TST_CellUIDRegionArchive.self), .optional(5, TSP_UUIDCoordArchive.self),
+        .optional(6, TSP_UUIDCoordArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 6)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var tableInfo: TSP_Reference? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var selectionType: Int32? { get { self[1] } set { self[1] = newValue } }
+    var cellUidRegion: TST_CellUIDRegionArchive? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var baseUidRegion: TST_CellUIDRegionArchive? { get { self[message: 3] } set { self[message: 3] = newValue } }
+    var anchorCellUid: TSP_UUIDCoordArchive? { get { self[message: 4] } set { self[message: 4] = newValue } }
+    var cursorCellUid: TSP_UUIDCoordArchive? { get { self[message: 5] } set { self[message: 5] = newValue } }
 }
 
 /// Generated wire model for `TST.StrokeSelectionArchive`.
 final class TST_StrokeSelectionArchive: IWAMessage {
-    var mask: Int32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { mask = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = mask { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.StrokeSelectionArchive", [
+        .optional(1, .int32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var mask: Int32? { get { self[0] } set { self[0] = newValue } }
 }
 
 /// Generated wire model for `TST.ControlCellSelectionArchive`.
 final class TST_ControlCellSelectionArchive: IWAMessage {
-
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TST.ControlCellSelectionArchive", [])
+    var _values = [IWAValue](repeating: .absent, count: 0)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
 }
 
 /// Generated wire model for `TST.StockCellSelectionArchive`.
 final class TST_StockCellSelectionArchive: IWAMessage {
-
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TST.StockCellSelectionArchive", [])
+    var _values = [IWAValue](repeating: .absent, count: 0)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
 }
 
 /// Generated wire model for `TST.TableNameSelectionArchive`.
 final class TST_TableNameSelectionArchive: IWAMessage {
-
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TST.TableNameSelectionArchive", [])
+    var _values = [IWAValue](repeating: .absent, count: 0)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
 }
 
 /// Generated wire model for `TST.AutofillSelectionArchive`.
 final class TST_AutofillSelectionArchive: IWAMessage {
-    var sourceCellRange: TST_CellRange?
-    var targetCellRange: TST_CellRange?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TST_CellRange?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_CellRange(ProtobufMessage(_b)) }
-            if let _v { sourceCellRange = _v }
-        case 2:
-            var _v: TST_CellRange?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_CellRange(ProtobufMessage(_b)) }
-            if let _v { targetCellRange = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = sourceCellRange { _w.bytesField(1, _x.encoded()) }
-        if let _x = targetCellRange { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.AutofillSelectionArchive", [
+        .optional(1, TST_CellRange.self), .optional(2, TST_CellRange.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var sourceCellRange: TST_CellRange? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var targetCellRange: TST_CellRange? { get { self[message: 1] } set { self[message: 1] = newValue } }
 }
 
 /// Generated wire model for `TST.FilterRulePrePivotArchive`.
 final class TST_FilterRulePrePivotArchive: IWAMessage {
-    var predicate: TST_FormulaPredicatePrePivotArchive?
-    var disabled: Bool?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TST_FormulaPredicatePrePivotArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_FormulaPredicatePrePivotArchive(ProtobufMessage(_b)) }
-            if let _v { predicate = _v }
-        case 2:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { disabled = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = predicate { _w.bytesField(1, _x.encoded()) }
-        if let _x = disabled { _w.varintField(2, _x ? 1 : 0) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.FilterRulePrePivotArchive", [
+        .optional(1, TST_FormulaPredicatePrePivotArchive.self), .optional(2, .bool),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var predicate: TST_FormulaPredicatePrePivotArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var disabled: Bool? { get { self[1] } set { self[1] = newValue } }
 }
 
 /// Generated wire model for `TST.FilterRuleArchive`.
 final class TST_FilterRuleArchive: IWAMessage {
-    var predicate: TST_FormulaPredicateArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TST_FormulaPredicateArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_FormulaPredicateArchive(ProtobufMessage(_b)) }
-            if let _v { predicate = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = predicate { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.FilterRuleArchive", [
+        .optional(1, TST_FormulaPredicateArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var predicate: TST_FormulaPredicateArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
 }
 
 /// Generated wire model for `TST.TableStyleArchive`.
 final class TST_TableStyleArchive: IWAMessage {
-    var `super`: TSS_StyleArchive?
-    var overrideCount: UInt32?
-    var tableProperties: TST_TableStylePropertiesArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSS_StyleArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSS_StyleArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 10:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { overrideCount = _v }
-        case 11:
-            var _v: TST_TableStylePropertiesArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_TableStylePropertiesArchive(ProtobufMessage(_b)) }
-            if let _v { tableProperties = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = overrideCount { _w.varintField(10, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = tableProperties { _w.bytesField(11, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.TableStyleArchive", [
+        .optional(1, TSS_StyleArchive.self), .optional(10, .uint32),
+        .optional(11, TST_TableStylePropertiesArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var `super`: TSS_StyleArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var overrideCount: UInt32? { get { self[1] } set { self[1] = newValue } }
+    var tableProperties: TST_TableStylePropertiesArchive? { get { self[message: 2] } set { self[message: 2] = newValue } }
 }
 
 /// Generated wire model for `TST.CellStyleArchive`.
 final class TST_CellStyleArchive: IWAMessage {
-    var `super`: TSS_StyleArchive?
-    var overrideCount: UInt32?
-    var cellProperties: TST_CellStylePropertiesArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSS_StyleArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSS_StyleArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 10:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { overrideCount = _v }
-        case 11:
-            var _v: TST_CellStylePropertiesArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_CellStylePropertiesArchive(ProtobufMessage(_b)) }
-            if let _v { cellProperties = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = overrideCount { _w.varintField(10, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = cellProperties { _w.bytesField(11, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.CellStyleArchive", [
+        .optional(1, TSS_StyleArchive.self), .optional(10, .uint32), .optional(11, TST_CellStylePropertiesArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var `super`: TSS_StyleArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var overrideCount: UInt32? { get { self[1] } set { self[1] = newValue } }
+    var cellProperties: TST_CellStylePropertiesArchive? { get { self[message: 2] } set { self[message: 2] = newValue } }
 }
 
 /// Generated wire model for `TST.FormulaPredArgDataArchive`.
 final class TST_FormulaPredArgDataArchive: IWAMessage {
-    var doubleValue: Double?
-    var decimalLow: UInt64?
-    var decimalHigh: UInt64?
-    var stringValue: String?
-    var dateValue: Double?
-    var durationTimeinterval: Double?
-    var durationUnits: Int32?
-    var booleanValue: Bool?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { doubleValue = _v }
-        case 2:
-            var _v: UInt64?
-            if case .varint(let _u) = _f.value { _v = UInt64(truncatingIfNeeded: _u) }
-            if let _v { decimalLow = _v }
-        case 3:
-            var _v: UInt64?
-            if case .varint(let _u) = _f.value { _v = UInt64(truncatingIfNeeded: _u) }
-            if let _v { decimalHigh = _v }
-        case 4:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { stringValue = _v }
-        case 5:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { dateValue = _v }
-        case 6:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { durationTimeinterval = _v }
-        case 7:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { durationUnits = _v }
-        case 8:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { booleanValue = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = doubleValue { _w.fixed64Field(1, _x.bitPattern) }
-        if let _x = decimalLow { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = decimalHigh { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = stringValue { _w.stringField(4, _x) }
-        if let _x = dateValue { _w.fixed64Field(5, _x.bitPattern) }
-        if let _x = durationTimeinterval { _w.fixed64Field(6, _x.bitPattern) }
-        if let _x = durationUnits { _w.varintField(7, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = booleanValue { _w.varintField(8, _x ? 1 : 0) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.FormulaPredArgDataArchive", [
+        .optional(1, .double), .optional(2, .uint64), .optional(3, .uint64), .optional(4, .string),
+        .optional(5, .double), .optional(6, .double), .optional(7, .int32), .optional(8, .bool),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 8)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var doubleValue: Double? { get { self[0] } set { self[0] = newValue } }
+    var decimalLow: UInt64? { get { self[1] } set { self[1] = newValue } }
+    var decimalHigh: UInt64? { get { self[2] } set { self[2] = newValue } }
+    var stringValue: String? { get { self[3] } set { self[3] = newValue } }
+    var dateValue: Double? { get { self[4] } set { self[4] = newValue } }
+    var durationTimeinterval: Double? { get { self[5] } set { self[5] = newValue } }
+    var durationUnits: Int32? { get { self[6] } set { self[6] = newValue } }
+    var booleanValue: Bool? { get { self[7] } set { self[7] = newValue } }
 }
 
 /// Generated wire model for `TST.FormulaPredArgArchive`.
 final class TST_FormulaPredArgArchive: IWAMessage {
-    var argType: Int32?
-    var argValue: TST_FormulaPredArgDataArchive?
-    var baseCellRef: TSCE_CellReferenceArchive?
-    var relativeCellRef: TSCE_RelativeCellRefArchive?
-    var categoryRef: TSCE_CategoryReferenceArchive?
-    var uidTractList: TSCE_ASTNodeArrayArchive_ASTUidTractList?
-    var hostCellCoord: TSCE_CellCoordinateArchive?
-    var preserveRow: Bool?
-    var preserveColumn: Bool?
-    var listEntries: [TST_FormulaPredArgDataArchive] = []
-    var viewTractRef: TSCE_ViewTractRefArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { argType = _v }
-        case 2:
-            var _v: TST_FormulaPredArgDataArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_FormulaPredArgDataArchive(ProtobufMessage(_b)) }
-            if let _v { argValue = _v }
-        case 3:
-            var _v: TSCE_CellReferenceArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CellReferenceArchive(ProtobufMessage(_b)) }
-            if let _v { baseCellRef = _v }
-        case 4:
-            var _v: TSCE_RelativeCellRefArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_RelativeCellRefArchive(ProtobufMessage(_b)) }
-            if let _v { relativeCellRef = _v }
-        case 5:
-            var _v: TSCE_CategoryReferenceArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CategoryReferenceArchive(ProtobufMessage(_b)) }
-            if let _v { categoryRef = _v }
-        case 6:
-            var _v: TSCE_ASTNodeArrayArchive_ASTUidTractList?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_ASTNodeArrayArchive_ASTUidTractList(ProtobufMessage(_b)) }
-            if let _v { uidTractList = _v }
-        case 7:
-            var _v: TSCE_CellCoordinateArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CellCoordinateArchive(ProtobufMessage(_b)) }
-            if let _v { hostCellCoord = _v }
-        case 8:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { preserveRow = _v }
-        case 9:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { preserveColumn = _v }
-        case 10:
-            var _v: TST_FormulaPredArgDataArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_FormulaPredArgDataArchive(ProtobufMessage(_b)) }
-            if let _v { listEntries.append(_v) }
-        case 11:
-            var _v: TSCE_ViewTractRefArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_ViewTractRefArchive(ProtobufMessage(_b)) }
-            if let _v { viewTractRef = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = argType { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = argValue { _w.bytesField(2, _x.encoded()) }
-        if let _x = baseCellRef { _w.bytesField(3, _x.encoded()) }
-        if let _x = relativeCellRef { _w.bytesField(4, _x.encoded()) }
-        if let _x = categoryRef { _w.bytesField(5, _x.encoded()) }
-        if let _x = uidTractList { _w.bytesField(6, _x.encoded()) }
-        if let _x = hostCellCoord { _w.bytesField(7, _x.encoded()) }
-        if let _x = preserveRow { _w.varintField(8, _x ? 1 : 0) }
-        if let _x = preserveColumn { _w.varintField(9, _x ? 1 : 0) }
-        for _x in listEntries { _w.bytesField(10, _x.encoded()) }
-        if let _x = viewTractRef { _w.bytesField(11, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.FormulaPredArgArchive", [
+        .optional(1, .int32), .optional(2, TST_FormulaPredArgDataArchive.self),
+        .optional(3, TSCE_CellReferenceArchive.self), .optional(4, TSCE_RelativeCellRefArchive.self),
+        .optional(5, TSCE_CategoryReferenceArchive.self), .optional(6, TSCE_ASTNodeArrayArchive_ASTUidTractList.self),
+        .optional(7, TSCE_CellCoordinateArchive.self), .optional(8, .bool), .optional(9, .bool),
+        .repeated(10, TST_FormulaPredArgDataArchive.self), .optional(11, TSCE_ViewTractRefArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 11)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var argType: Int32? { get { self[0] } set { self[0] = newValue } }
+    var argValue: TST_FormulaPredArgDataArchive? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var baseCellRef: TSCE_CellReferenceArchive? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var relativeCellRef: TSCE_RelativeCellRefArchive? { get { self[message: 3] } set { self[message: 3] = newValue } }
+    var categoryRef: TSCE_CategoryReferenceArchive? { get { self[message: 4] } set { self[message: 4] = newValue } }
+    var uidTractList: TSCE_ASTNodeArrayArchive_ASTUidTractList? { get { self[message: 5] } set { self[message: 5] = newValue } }
+    var hostCellCoord: TSCE_CellCoordinateArchive? { get { self[message: 6] } set { self[message: 6] = newValue } }
+    var preserveRow: Bool? { get { self[7] } set { self[7] = newValue } }
+    var preserveColumn: Bool? { get { self[8] } set { self[8] = newValue } }
+    var listEntries: [TST_FormulaPredArgDataArchive] { get { self[messages: 9] } set { self[messages: 9] = newValue } }
+    func append(listEntries value: TST_FormulaPredArgDataArchive) { append(value, toMessages: 9) }
+    var viewTractRef: TSCE_ViewTractRefArchive? { get { self[message: 10] } set { self[message: 10] = newValue } }
 }
 
 /// Generated wire model for `TST.FormulaPredicatePrePivotArchive`.
 final class TST_FormulaPredicatePrePivotArchive: IWAMessage {
-    var formula: TSCE_FormulaArchive?
-    var predicateType: Int32?
-    var qualifier1: Int32?
-    var qualifier2: Int32?
-    var paramIndex1: Int32?
-    var paramIndex2: Int32?
-    var paramIndex0: Int32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSCE_FormulaArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_FormulaArchive(ProtobufMessage(_b)) }
-            if let _v { formula = _v }
-        case 2:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { predicateType = _v }
-        case 3:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { qualifier1 = _v }
-        case 4:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { qualifier2 = _v }
-        case 5:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { paramIndex1 = _v }
-        case 6:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { paramIndex2 = _v }
-        case 7:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { paramIndex0 = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = formula { _w.bytesField(1, _x.encoded()) }
-        if let _x = predicateType { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = qualifier1 { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = qualifier2 { _w.varintField(4, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = paramIndex1 { _w.varintField(5, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = paramIndex2 { _w.varintField(6, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = paramIndex0 { _w.varintField(7, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.FormulaPredicatePrePivotArchive", [
+        .optional(1, TSCE_FormulaArchive.self), .optional(2, .int32), .optional(3, .int32), .optional(4, .int32),
+        .optional(5, .int32), .optional(6, .int32), .optional(7, .int32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 7)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var formula: TSCE_FormulaArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var predicateType: Int32? { get { self[1] } set { self[1] = newValue } }
+    var qualifier1: Int32? { get { self[2] } set { self[2] = newValue } }
+    var qualifier2: Int32? { get { self[3] } set { self[3] = newValue } }
+    var paramIndex1: Int32? { get { self[4] } set { self[4] = newValue } }
+    var paramIndex2: Int32? { get { self[5] } set { self[5] = newValue } }
+    var paramIndex0: Int32? { get { self[6] } set { self[6] = newValue } }
 }
 
 /// Generated wire model for `TST.FormulaPredicateArchive`.
 final class TST_FormulaPredicateArchive: IWAMessage {
-    var predicateType: Int32?
-    var qualifier1: Int32?
-    var qualifier2: Int32?
-    var paramValue0: TST_FormulaPredArgArchive?
-    var paramValue1: TST_FormulaPredArgArchive?
-    var paramValue2: TST_FormulaPredArgArchive?
-    var formula: TSCE_FormulaArchive?
-    var forConditionalStyle: Bool?
-    var hostTableUid: TSP_UUID?
-    var hostColumnUid: TSP_UUID?
-    var hostRowUid: TSP_UUID?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { predicateType = _v }
-        case 2:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { qualifier1 = _v }
-        case 3:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { qualifier2 = _v }
-        case 4:
-            var _v: TST_FormulaPredArgArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_FormulaPredArgArchive(ProtobufMessage(_b)) }
-            if let _v { paramValue0 = _v }
-        case 5:
-            var _v: TST_FormulaPredArgArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_FormulaPredArgArchive(ProtobufMessage(_b)) }
-            if let _v { paramValue1 = _v }
-        case 6:
-            var _v: TST_FormulaPredArgArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_FormulaPredArgArchive(ProtobufMessage(_b)) }
-            if let _v { paramValue2 = _v }
-        case 7:
-            var _v: TSCE_FormulaArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_FormulaArchive(ProtobufMessage(_b)) }
-            if let _v { formula = _v }
-        case 8:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { forConditionalStyle = _v }
-        case 9:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { hostTableUid = _v }
-        case 10:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { hostColumnUid = _v }
-        case 11:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { hostRowUid = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = predicateType { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = qualifier1 { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = qualifier2 { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = paramValue0 { _w.bytesField(4, _x.encoded()) }
-        if let _x = paramValue1 { _w.bytesField(5, _x.encoded()) }
-        if let _x = paramValue2 { _w.bytesField(6, _x.encoded()) }
-        if let _x = formula { _w.bytesField(7, _x.encoded()) }
-        if let _x = forConditionalStyle { _w.varintField(8, _x ? 1 : 0) }
-        if let _x = hostTableUid { _w.bytesField(9, _x.encoded()) }
-        if let _x = hostColumnUid { _w.bytesField(10, _x.encoded()) }
-        if let _x = hostRowUid { _w.bytesField(11, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.FormulaPredicateArchive", [
+        .optional(1, .int32), .optional(2, .int32), .optional(3, .int32), .optional(4, TST_FormulaPredArgArchive.self),
+        .optional(5, TST_FormulaPredArgArchive.self), .optional(6, TST_FormulaPredArgArchive.self),
+        .optional(7, TSCE_FormulaArchive.self), .optional(8, .bool), .optional(9, TSP_UUID.self),
+        .optional(10, TSP_UUID.self), .optional(11, TSP_UUID.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 11)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var predicateType: Int32? { get { self[0] } set { self[0] = newValue } }
+    var qualifier1: Int32? { get { self[1] } set { self[1] = newValue } }
+    var qualifier2: Int32? { get { self[2] } set { self[2] = newValue } }
+    var paramValue0: TST_FormulaPredArgArchive? { get { self[message: 3] } set { self[message: 3] = newValue } }
+    var paramValue1: TST_FormulaPredArgArchive? { get { self[message: 4] } set { self[message: 4] = newValue } }
+    var paramValue2: TST_FormulaPredArgArchive? { get { self[message: 5] } set { self[message: 5] = newValue } }
+    var formula: TSCE_FormulaArchive? { get { self[message: 6] } set { self[message: 6] = newValue } }
+    var forConditionalStyle: Bool? { get { self[7] } set { self[7] = newValue } }
+    var hostTableUid: TSP_UUID? { get { self[message: 8] } set { self[message: 8] = newValue } }
+    var hostColumnUid: TSP_UUID? { get { self[message: 9] } set { self[message: 9] = newValue } }
+    var hostRowUid: TSP_UUID? { get { self[message: 10] } set { self[message: 10] = newValue } }
 }
 
 /// Generated wire model for `TST.ConditionalStyleSetArchive`.
 final class TST_ConditionalStyleSetArchive: IWAMessage {
-    var rulecount: UInt32?
-    var rulesPrepivot: [TST_ConditionalStyleSetArchive_ConditionalStyleRulePrePivot] = []
-    var rules: TST_ConditionalStyleSetArchive_ConditionalStyleRules?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { rulecount = _v }
-        case 2:
-            var _v: TST_ConditionalStyleSetArchive_ConditionalStyleRulePrePivot?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_ConditionalStyleSetArchive_ConditionalStyleRulePrePivot(ProtobufMessage(_b)) }
-            if let _v { rulesPrepivot.append(_v) }
-        case 3:
-            var _v: TST_ConditionalStyleSetArchive_ConditionalStyleRules?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_ConditionalStyleSetArchive_ConditionalStyleRules(ProtobufMessage(_b)) }
-            if let _v { rules = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = rulecount { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        for _x in rulesPrepivot { _w.bytesField(2, _x.encoded()) }
-        if let _x = rules { _w.bytesField(3, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.ConditionalStyleSetArchive", [
+        .optional(1, .uint32), .repeated(2, TST_ConditionalStyleSetArchive_ConditionalStyleRulePrePivot.self),
+        .optional(3, TST_ConditionalStyleSetArchive_ConditionalStyleRules.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var rulecount: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var rulesPrepivot: [TST_ConditionalStyleSetArchive_ConditionalStyleRulePrePivot] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(rulesPrepivot value: TST_ConditionalStyleSetArchive_ConditionalStyleRulePrePivot) { append(value, toMessages: 1) }
+    var rules: TST_ConditionalStyleSetArchive_ConditionalStyleRules? { get { self[message: 2] } set { self[message: 2] = newValue } }
 }
 
 /// Generated wire model for `TST.ConditionalStyleSetArchive.ConditionalStyleRulePrePivot`.
 final class TST_ConditionalStyleSetArchive_ConditionalStyleRulePrePivot: IWAMessage {
-    var predicate: TST_FormulaPredicatePrePivotArchive?
-    var cellStyle: TSP_Reference?
-    var textStyle: TSP_Reference?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TST_FormulaPredicatePrePivotArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_FormulaPredicatePrePivotArchive(ProtobufMessage(_b)) }
-            if let _v { predicate = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { cellStyle = _v }
-        case 3:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { textStyle = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = predicate { _w.bytesField(1, _x.encoded()) }
-        if let _x = cellStyle { _w.bytesField(2, _x.encoded()) }
-        if let _x = textStyle { _w.bytesField(3, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.ConditionalStyleSetArchive.ConditionalStyleRulePrePivot", [
+        .optional(1, TST_FormulaPredicatePrePivotArchive.self), .optional(2, TSP_Reference.self),
+        .optional(3, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var predicate: TST_FormulaPredicatePrePivotArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var cellStyle: TSP_Reference? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var textStyle: TSP_Reference? { get { self[message: 2] } set { self[message: 2] = newValue } }
 }
 
 /// Generated wire model for `TST.ConditionalStyleSetArchive.ConditionalStyleRule`.
 final class TST_ConditionalStyleSetArchive_ConditionalStyleRule: IWAMessage {
-    var predicate: TST_FormulaPredicateArchive?
-    var cellStyle: TSP_Reference?
-    var textStyle: TSP_Reference?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TST_FormulaPredicateArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_FormulaPredicateArchive(ProtobufMessage(_b)) }
-            if let _v { predicate = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { cellStyle = _v }
-        case 3:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { textStyle = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = predicate { _w.bytesField(1, _x.encoded()) }
-        if let _x = cellStyle { _w.bytesField(2, _x.encoded()) }
-        if let _x = textStyle { _w.bytesField(3, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.ConditionalStyleSetArchive.ConditionalStyleRule", [
+        .optional(1, TST_FormulaPredicateArchive.self), .optional(2, TSP_Reference.self),
+        .optional(3, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var predicate: TST_FormulaPredicateArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var cellStyle: TSP_Reference? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var textStyle: TSP_Reference? { get { self[message: 2] } set { self[message: 2] = newValue } }
 }
 
 /// Generated wire model for `TST.ConditionalStyleSetArchive.ConditionalStyleRules`.
 final class TST_ConditionalStyleSetArchive_ConditionalStyleRules: IWAMessage {
-    var rule: [TST_ConditionalStyleSetArchive_ConditionalStyleRule] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TST_ConditionalStyleSetArchive_ConditionalStyleRule?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_ConditionalStyleSetArchive_ConditionalStyleRule(ProtobufMessage(_b)) }
-            if let _v { rule.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in rule { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.ConditionalStyleSetArchive.ConditionalStyleRules", [
+        .repeated(1, TST_ConditionalStyleSetArchive_ConditionalStyleRule.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var rule: [TST_ConditionalStyleSetArchive_ConditionalStyleRule] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(rule value: TST_ConditionalStyleSetArchive_ConditionalStyleRule) { append(value, toMessages: 0) }
 }
 
 /// Generated wire model for `TST.FilterSetArchive`.
 final class TST_FilterSetArchive: IWAMessage {
-    var type: Int32?
-    var isEnabled: Bool?
-    var filterRulesPrepivot: [TST_FilterRulePrePivotArchive] = []
-    var needsFormulaRewriteForImport: Bool?
-    var filterOffsets: [UInt32] = []
-    var filterEnabled: [Bool] = []
-    var filterRules: [TST_FilterRuleArchive] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { type = _v }
-        case 2:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { isEnabled = _v }
-        case 3:
-            var _v: TST_FilterRulePrePivotArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_FilterRulePrePivotArchive(ProtobufMessage(_b)) }
-            if let _v { filterRulesPrepivot.append(_v) }
-        case 4:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { needsFormulaRewriteForImport = _v }
-        case 5:
-            if case .varint(let _u) = _f.value { filterOffsets.append(UInt32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { filterOffsets.append(UInt32(truncatingIfNeeded: _u)) } }
-        case 6:
-            if case .varint(let _u) = _f.value { filterEnabled.append((_u != 0)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { filterEnabled.append((_u != 0)) } }
-        case 7:
-            var _v: TST_FilterRuleArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_FilterRuleArchive(ProtobufMessage(_b)) }
-            if let _v { filterRules.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = type { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = isEnabled { _w.varintField(2, _x ? 1 : 0) }
-        for _x in filterRulesPrepivot { _w.bytesField(3, _x.encoded()) }
-        if let _x = needsFormulaRewriteForImport { _w.varintField(4, _x ? 1 : 0) }
-        for _x in filterOffsets { _w.varintField(5, UInt64(truncatingIfNeeded: _x)) }
-        for _x in filterEnabled { _w.varintField(6, _x ? 1 : 0) }
-        for _x in filterRules { _w.bytesField(7, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.FilterSetArchive", [
+        .optional(1, .int32), .optional(2, .bool), .repeated(3, TST_FilterRulePrePivotArchive.self),
+        .optional(4, .bool), .repeated(5, .uint32), .repeated(6, .bool), .repeated(7, TST_FilterRuleArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 7)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var type: Int32? { get { self[0] } set { self[0] = newValue } }
+    var isEnabled: Bool? { get { self[1] } set { self[1] = newValue } }
+    var filterRulesPrepivot: [TST_FilterRulePrePivotArchive] { get { self[messages: 2] } set { self[messages: 2] = newValue } }
+    func append(filterRulesPrepivot value: TST_FilterRulePrePivotArchive) { append(value, toMessages: 2) }
+    var needsFormulaRewriteForImport: Bool? { get { self[3] } set { self[3] = newValue } }
+    var filterOffsets: [UInt32] { get { self[all: 4] } set { self[all: 4] = newValue } }
+    func append(filterOffsets value: UInt32) { append(value, toAll: 4) }
+    var filterEnabled: [Bool] { get { self[all: 5] } set { self[all: 5] = newValue } }
+    func append(filterEnabled value: Bool) { append(value, toAll: 5) }
+    var filterRules: [TST_FilterRuleArchive] { get { self[messages: 6] } set { self[messages: 6] = newValue } }
+    func append(filterRules value: TST_FilterRuleArchive) { append(value, toMessages: 6) }
 }
 
 /// Generated wire model for `TST.UniqueIndexArchive`.
 final class TST_UniqueIndexArchive: IWAMessage {
-    var columnUid: TSP_UUID?
-    var uniqueEntries: [TST_UniqueIndexArchive_UniqueIndexEntryArchive] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { columnUid = _v }
-        case 2:
-            var _v: TST_UniqueIndexArchive_UniqueIndexEntryArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_UniqueIndexArchive_UniqueIndexEntryArchive(ProtobufMessage(_b)) }
-            if let _v { uniqueEntries.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = columnUid { _w.bytesField(1, _x.encoded()) }
-        for _x in uniqueEntries { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.UniqueIndexArchive", [
+        .optional(1, TSP_UUID.self), .repeated(2, TST_UniqueIndexArchive_UniqueIndexEntryArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var columnUid: TSP_UUID? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var uniqueEntries: [TST_UniqueIndexArchive_UniqueIndexEntryArchive] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(uniqueEntries value: TST_UniqueIndexArchive_UniqueIndexEntryArchive) { append(value, toMessages: 1) }
 }
 
 /// Generated wire model for `TST.UniqueIndexArchive.UniqueIndexEntryArchive`.
 final class TST_UniqueIndexArchive_UniqueIndexEntryArchive: IWAMessage {
-    var stringValue: String?
-    var rowUids: [TSP_UUID] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { stringValue = _v }
-        case 2:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { rowUids.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = stringValue { _w.stringField(1, _x) }
-        for _x in rowUids { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.UniqueIndexArchive.UniqueIndexEntryArchive", [
+        .optional(1, .string), .repeated(2, TSP_UUID.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var stringValue: String? { get { self[0] } set { self[0] = newValue } }
+    var rowUids: [TSP_UUID] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(rowUids value: TSP_UUID) { append(value, toMessages: 1) }
 }
 
 /// Generated wire model for `TST.HiddenStateExtentArchive`.
 final class TST_HiddenStateExtentArchive: IWAMessage {
-    var hiddenStateExtentUid: TSP_UUID?
-    var baseHiddenStates: [TST_HiddenStateExtentArchive_RowOrColumnState] = []
-    var rowOrColumnDirection: Int32?
-    var thresholdValue: [TSCE_CellValueArchive] = []
-    var needsToUpdateFilterSetForImport: Bool?
-    var collapsedGroupUids: [TSP_UUID] = []
-    var filterSet: TSP_Reference?
-    var summaryPivotHiddenIndexes: TSCE_IndexSetArchive?
-    var summaryFilteredIndexes: TSCE_IndexSetArchive?
-    var uniqueIndexes: [TST_UniqueIndexArchive] = []
-    var summaryHiddenStates: [TST_HiddenStateExtentArchive_RowOrColumnState] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { hiddenStateExtentUid = _v }
-        case 2:
-            var _v: TST_HiddenStateExtentArchive_RowOrColumnState?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_HiddenStateExtentArchive_RowOrColumnState(ProtobufMessage(_b)) }
-            if let _v { baseHiddenStates.append(_v) }
-        case 3:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { rowOrColumnDirection = _v }
-        case 5:
-            var _v: TSCE_CellValueArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CellValueArchive(ProtobufMessage(_b)) }
-            if let _v { thresholdValue.append(_v) }
-        case 6:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { needsToUpdateFilterSetForImport = _v }
-        case 7:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { collapsedGroupUids.append(_v) }
-        case 8:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { filterSet = _v }
-        case 9:
-            var _v: TSCE_IndexSetArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_IndexSetArchive(ProtobufMessage(_b)) }
-            if let _v { summaryPivotHiddenIndexes = _v }
-        case 10:
-            var _v: TSCE_IndexSetArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_IndexSetArchive(ProtobufMessage(_b)) }
-            if let _v { summaryFilteredIndexes = _v }
-        case 11:
-            var _v: TST_UniqueIndexArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_UniqueIndexArchive(ProtobufMessage(_b)) }
-            if let _v { uniqueIndexes.append(_v) }
-        case 12:
-            var _v: TST_HiddenStateExtentArchive_RowOrColumnState?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_HiddenStateExtentArchive_RowOrColumnState(ProtobufMessage(_b)) }
-            if let _v { summaryHiddenStates.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = hiddenStateExtentUid { _w.bytesField(1, _x.encoded()) }
-        for _x in baseHiddenStates { _w.bytesField(2, _x.encoded()) }
-        if let _x = rowOrColumnDirection { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        for _x in thresholdValue { _w.bytesField(5, _x.encoded()) }
-        if let _x = needsToUpdateFilterSetForImport { _w.varintField(6, _x ? 1 : 0) }
-        for _x in collapsedGroupUids { _w.bytesField(7, _x.encoded()) }
-        if let _x = filterSet { _w.bytesField(8, _x.encoded()) }
-        if let _x = summaryPivotHiddenIndexes { _w.bytesField(9, _x.encoded()) }
-        if let _x = summaryFilteredIndexes { _w.bytesField(10, _x.encoded()) }
-        for _x in uniqueIndexes { _w.bytesField(11, _x.encoded()) }
-        for _x in summaryHiddenStates { _w.bytesField(12, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.HiddenStateExtentArchive", [
+        .optional(1, TSP_UUID.self), .repeated(2, TST_HiddenStateExtentArchive_RowOrColumnState.self),
+        .optional(3, .int32), .repeated(5, TSCE_CellValueArchive.self), .optional(6, .bool),
+        .repeated(7, TSP_UUID.self), .optional(8, TSP_Reference.self), .optional(9, TSCE_IndexSetArchive.self),
+        .optional(10, TSCE_IndexSetArchive.self), .repeated(11, TST_UniqueIndexArchive.self),
+        .repeated(12, TST_HiddenStateExtentArchive_RowOrColumnState.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 11)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var hiddenStateExtentUid: TSP_UUID? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var baseHiddenStates: [TST_HiddenStateExtentArchive_RowOrColumnState] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(baseHiddenStates value: TST_HiddenStateExtentArchive_RowOrColumnState) { append(value, toMessages: 1) }
+    var rowOrColumnDirection: Int32? { get { self[2] } set { self[2] = newValue } }
+    var thresholdValue: [TSCE_CellValueArchive] { get { self[messages: 3] } set { self[messages: 3] = newValue } }
+    func append(thresholdValue value: TSCE_CellValueArchive) { append(value, toMessages: 3) }
+    var needsToUpdateFilterSetForImport: Bool? { get { self[4] } set { self[4] = newValue } }
+    var collapsedGroupUids: [TSP_UUID] { get { self[messages: 5] } set { self[messages: 5] = newValue } }
+    func append(collapsedGroupUids value: TSP_UUID) { append(value, toMessages: 5) }
+    var filterSet: TSP_Reference? { get { self[message: 6] } set { self[message: 6] = newValue } }
+    var summaryPivotHiddenIndexes: TSCE_IndexSetArchive? { get { self[message: 7] } set { self[message: 7] = newValue } }
+    var summaryFilteredIndexes: TSCE_IndexSetArchive? { get { self[message: 8] } set { self[message: 8] = newValue } }
+    var uniqueIndexes: [TST_UniqueIndexArchive] { get { self[messages: 9] } set { self[messages: 9] = newValue } }
+    func append(uniqueIndexes value: TST_UniqueIndexArchive) { append(value, toMessages: 9) }
+    var summaryHiddenStates: [TST_HiddenStateExtentArchive_RowOrColumnState] { get { self[messages: 10] } set { self[messages: 10] = newValue } }
+    func append(summaryHiddenStates value: TST_HiddenStateExtentArchive_RowOrColumnState) { append(value, toMessages: 10) }
 }
 
 /// Generated wire model for `TST.HiddenStateExtentArchive.RowOrColumnState`.
 final class TST_HiddenStateExtentArchive_RowOrColumnState: IWAMessage {
-    var rowOrColumnUid: TSP_UUID?
-    var userHidden: Bool?
-    var filtered: Bool?
-    var pivotHidden: Bool?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { rowOrColumnUid = _v }
-        case 2:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { userHidden = _v }
-        case 3:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { filtered = _v }
-        case 4:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { pivotHidden = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = rowOrColumnUid { _w.bytesField(1, _x.encoded()) }
-        if let _x = userHidden { _w.varintField(2, _x ? 1 : 0) }
-        if let _x = filtered { _w.varintField(3, _x ? 1 : 0) }
-        if let _x = pivotHidden { _w.varintField(4, _x ? 1 : 0) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.HiddenStateExtentArchive.RowOrColumnState", [
+        .optional(1, TSP_UUID.self), .optional(2, .bool), .optional(3, .bool), .optional(4, .bool),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var rowOrColumnUid: TSP_UUID? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var userHidden: Bool? { get { self[1] } set { self[1] = newValue } }
+    var filtered: Bool? { get { self[2] } set { self[2] = newValue } }
+    var pivotHidden: Bool? { get { self[3] } set { self[3] = newValue } }
 }
 
 /// Generated wire model for `TST.HiddenStatesArchive`.
 final class TST_HiddenStatesArchive: IWAMessage {
-    var hiddenStatesUid: TSP_UUID?
-    var columnHiddenStateExtent: TST_HiddenStateExtentArchive?
-    var rowHiddenStateExtent: TST_HiddenStateExtentArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { hiddenStatesUid = _v }
-        case 2:
-            var _v: TST_HiddenStateExtentArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_HiddenStateExtentArchive(ProtobufMessage(_b)) }
-            if let _v { columnHiddenStateExtent = _v }
-        case 3:
-            var _v: TST_HiddenStateExtentArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_HiddenStateExtentArchive(ProtobufMessage(_b)) }
-            if let _v { rowHiddenStateExtent = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = hiddenStatesUid { _w.bytesField(1, _x.encoded()) }
-        if let _x = columnHiddenStateExtent { _w.bytesField(2, _x.encoded()) }
-        if let _x = rowHiddenStateExtent { _w.bytesField(3, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.HiddenStatesArchive", [
+        .optional(1, TSP_UUID.self), .optional(2, TST_HiddenStateExtentArchive.self),
+        .optional(3, TST_HiddenStateExtentArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var hiddenStatesUid: TSP_UUID? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var columnHiddenStateExtent: TST_HiddenStateExtentArchive? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var rowHiddenStateExtent: TST_HiddenStateExtentArchive? { get { self[message: 2] } set { self[message: 2] = newValue } }
 }
 
 /// Generated wire model for `TST.HiddenStatesOwnerArchive`.
 final class TST_HiddenStatesOwnerArchive: IWAMessage {
-    var ownerUid: TSP_UUID?
-    var hiddenStates: [TST_HiddenStatesArchive] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { ownerUid = _v }
-        case 2:
-            var _v: TST_HiddenStatesArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_HiddenStatesArchive(ProtobufMessage(_b)) }
-            if let _v { hiddenStates.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = ownerUid { _w.bytesField(1, _x.encoded()) }
-        for _x in hiddenStates { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.HiddenStatesOwnerArchive", [
+        .optional(1, TSP_UUID.self), .repeated(2, TST_HiddenStatesArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var ownerUid: TSP_UUID? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var hiddenStates: [TST_HiddenStatesArchive] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(hiddenStates value: TST_HiddenStatesArchive) { append(value, toMessages: 1) }
 }
 
 /// Generated wire model for `TST.ExpandCollapseStateArchive`.
 final class TST_ExpandCollapseStateArchive: IWAMessage {
-    var uidsCollapsed: [TSP_UUID] = []
-    var uidsExpanded: [TSP_UUID] = []
-    var dimension: Int32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { uidsCollapsed.append(_v) }
-        case 2:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { uidsExpanded.append(_v) }
-        case 3:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { dimension = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in uidsCollapsed { _w.bytesField(1, _x.encoded()) }
-        for _x in uidsExpanded { _w.bytesField(2, _x.encoded()) }
-        if let _x = dimension { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.ExpandCollapseStateArchive", [
+        .repeated(1, TSP_UUID.self), .repeated(2, TSP_UUID.self), .optional(3, .int32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var uidsCollapsed: [TSP_UUID] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(uidsCollapsed value: TSP_UUID) { append(value, toMessages: 0) }
+    var uidsExpanded: [TSP_UUID] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(uidsExpanded value: TSP_UUID) { append(value, toMessages: 1) }
+    var dimension: Int32? { get { self[2] } set { self[2] = newValue } }
 }
 
 /// Generated wire model for `TST.TokenAttachmentArchive`.
 final class TST_TokenAttachmentArchive: IWAMessage {
-    var `super`: TSWP_UIGraphicalAttachment?
-    var expressionnode: TSP_Reference?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSWP_UIGraphicalAttachment?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_UIGraphicalAttachment(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { expressionnode = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = expressionnode { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.TokenAttachmentArchive", [
+        .optional(1, TSWP_UIGraphicalAttachment.self), .optional(2, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var `super`: TSWP_UIGraphicalAttachment? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var expressionnode: TSP_Reference? { get { self[message: 1] } set { self[message: 1] = newValue } }
 }
 
 /// Generated wire model for `TST.ExpressionNodeArchive`.
 final class TST_ExpressionNodeArchive: IWAMessage {
-    var children: [TSP_Reference] = []
-    var firstIndex: UInt64?
-    var lastIndex: UInt64?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { children.append(_v) }
-        case 2:
-            var _v: UInt64?
-            if case .varint(let _u) = _f.value { _v = UInt64(truncatingIfNeeded: _u) }
-            if let _v { firstIndex = _v }
-        case 3:
-            var _v: UInt64?
-            if case .varint(let _u) = _f.value { _v = UInt64(truncatingIfNeeded: _u) }
-            if let _v { lastIndex = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in children { _w.bytesField(1, _x.encoded()) }
-        if let _x = firstIndex { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = lastIndex { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.ExpressionNodeArchive", [
+        .repeated(1, TSP_Reference.self), .optional(2, .uint64), .optional(3, .uint64),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var children: [TSP_Reference] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(children value: TSP_Reference) { append(value, toMessages: 0) }
+    var firstIndex: UInt64? { get { self[1] } set { self[1] = newValue } }
+    var lastIndex: UInt64? { get { self[2] } set { self[2] = newValue } }
 }
 
 /// Generated wire model for `TST.BooleanNodeArchive`.
 final class TST_BooleanNodeArchive: IWAMessage {
-    var `super`: TST_ExpressionNodeArchive?
-    var value: Bool?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TST_ExpressionNodeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_ExpressionNodeArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { value = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = value { _w.varintField(2, _x ? 1 : 0) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.BooleanNodeArchive", [
+        .optional(1, TST_ExpressionNodeArchive.self), .optional(2, .bool),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var `super`: TST_ExpressionNodeArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var value: Bool? { get { self[1] } set { self[1] = newValue } }
 }
 
 /// Generated wire model for `TST.NumberNodeArchive`.
 final class TST_NumberNodeArchive: IWAMessage {
-    var `super`: TST_ExpressionNodeArchive?
-    var number: Double?
-    var decimalLow: UInt64?
-    var decimalHigh: UInt64?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TST_ExpressionNodeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_ExpressionNodeArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { number = _v }
-        case 3:
-            var _v: UInt64?
-            if case .varint(let _u) = _f.value { _v = UInt64(truncatingIfNeeded: _u) }
-            if let _v { decimalLow = _v }
-        case 4:
-            var _v: UInt64?
-            if case .varint(let _u) = _f.value { _v = UInt64(truncatingIfNeeded: _u) }
-            if let _v { decimalHigh = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = number { _w.fixed64Field(2, _x.bitPattern) }
-        if let _x = decimalLow { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = decimalHigh { _w.varintField(4, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.NumberNodeArchive", [
+        .optional(1, TST_ExpressionNodeArchive.self), .optional(2, .double), .optional(3, .uint64),
+        .optional(4, .uint64),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var `super`: TST_ExpressionNodeArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var number: Double? { get { self[1] } set { self[1] = newValue } }
+    var decimalLow: UInt64? { get { self[2] } set { self[2] = newValue } }
+    var decimalHigh: UInt64? { get { self[3] } set { self[3] = newValue } }
 }
 
 /// Generated wire model for `TST.StringNodeArchive`.
 final class TST_StringNodeArchive: IWAMessage {
-    var `super`: TST_ExpressionNodeArchive?
-    var value: String?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TST_ExpressionNodeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_ExpressionNodeArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { value = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = value { _w.stringField(2, _x) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.StringNodeArchive", [
+        .optional(1, TST_ExpressionNodeArchive.self), .optional(2, .string),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var `super`: TST_ExpressionNodeArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var value: String? { get { self[1] } set { self[1] = newValue } }
 }
 
 /// Generated wire model for `TST.IdentifierNodeArchive`.
 final class TST_IdentifierNodeArchive: IWAMessage {
-    var `super`: TST_ExpressionNodeArchive?
-    var identifier: String?
-    var symbol: UInt32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TST_ExpressionNodeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_ExpressionNodeArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { identifier = _v }
-        case 3:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { symbol = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = identifier { _w.stringField(2, _x) }
-        if let _x = symbol { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.IdentifierNodeArchive", [
+        .optional(1, TST_ExpressionNodeArchive.self), .optional(2, .string), .optional(3, .uint32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var `super`: TST_ExpressionNodeArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var identifier: String? { get { self[1] } set { self[1] = newValue } }
+    var symbol: UInt32? { get { self[2] } set { self[2] = newValue } }
 }
 
 /// Generated wire model for `TST.ArrayNodeArchive`.
 final class TST_ArrayNodeArchive: IWAMessage {
-    var `super`: TST_ExpressionNodeArchive?
-    var columns: UInt32?
-    var rows: UInt32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TST_ExpressionNodeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_ExpressionNodeArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { columns = _v }
-        case 3:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { rows = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = columns { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = rows { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.ArrayNodeArchive", [
+        .optional(1, TST_ExpressionNodeArchive.self), .optional(2, .uint32), .optional(3, .uint32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var `super`: TST_ExpressionNodeArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var columns: UInt32? { get { self[1] } set { self[1] = newValue } }
+    var rows: UInt32? { get { self[2] } set { self[2] = newValue } }
 }
 
 /// Generated wire model for `TST.ListNodeArchive`.
 final class TST_ListNodeArchive: IWAMessage {
-    var `super`: TST_ExpressionNodeArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TST_ExpressionNodeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_ExpressionNodeArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.ListNodeArchive", [
+        .optional(1, TST_ExpressionNodeArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var `super`: TST_ExpressionNodeArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
 }
 
 /// Generated wire model for `TST.OperatorNodeArchive`.
 final class TST_OperatorNodeArchive: IWAMessage {
-    var `super`: TST_ExpressionNodeArchive?
-    var operatorchar: UInt32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TST_ExpressionNodeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_ExpressionNodeArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { operatorchar = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = operatorchar { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.OperatorNodeArchive", [
+        .optional(1, TST_ExpressionNodeArchive.self), .optional(2, .uint32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var `super`: TST_ExpressionNodeArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var operatorchar: UInt32? { get { self[1] } set { self[1] = newValue } }
 }
 
 /// Generated wire model for `TST.PostfixOperatorNodeArchive`.
 final class TST_PostfixOperatorNodeArchive: IWAMessage {
-    var `super`: TST_OperatorNodeArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TST_OperatorNodeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_OperatorNodeArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.PostfixOperatorNodeArchive", [
+        .optional(1, TST_OperatorNodeArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var `super`: TST_OperatorNodeArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
 }
 
 /// Generated wire model for `TST.PrefixOperatorNodeArchive`.
 final class TST_PrefixOperatorNodeArchive: IWAMessage {
-    var `super`: TST_OperatorNodeArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TST_OperatorNodeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_OperatorNodeArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.PrefixOperatorNodeArchive", [
+        .optional(1, TST_OperatorNodeArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var `super`: TST_OperatorNodeArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
 }
 
 /// Generated wire model for `TST.FunctionNodeArchive`.
 final class TST_FunctionNodeArchive: IWAMessage {
-    var `super`: TST_ExpressionNodeArchive?
-    var functionindex: UInt32?
-    var invalidfunctionname: String?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TST_ExpressionNodeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_ExpressionNodeArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { functionindex = _v }
-        case 3:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { invalidfunctionname = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = functionindex { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = invalidfunctionname { _w.stringField(3, _x) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.FunctionNodeArchive", [
+        .optional(1, TST_ExpressionNodeArchive.self), .optional(2, .uint32), .optional(3, .string),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var `super`: TST_ExpressionNodeArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var functionindex: UInt32? { get { self[1] } set { self[1] = newValue } }
+    var invalidfunctionname: String? { get { self[2] } set { self[2] = newValue } }
 }
 
 /// Generated wire model for `TST.FunctionEndNodeArchive`.
 final class TST_FunctionEndNodeArchive: IWAMessage {
-    var `super`: TST_ExpressionNodeArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TST_ExpressionNodeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_ExpressionNodeArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.FunctionEndNodeArchive", [
+        .optional(1, TST_ExpressionNodeArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var `super`: TST_ExpressionNodeArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
 }
 
 /// Generated wire model for `TST.DateNodeArchive`.
 final class TST_DateNodeArchive: IWAMessage {
-    var `super`: TST_ExpressionNodeArchive?
-    var value: String?
-    var format: String?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TST_ExpressionNodeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_ExpressionNodeArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { value = _v }
-        case 3:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { format = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = value { _w.stringField(2, _x) }
-        if let _x = format { _w.stringField(3, _x) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.DateNodeArchive", [
+        .optional(1, TST_ExpressionNodeArchive.self), .optional(2, .string), .optional(3, .string),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var `super`: TST_ExpressionNodeArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var value: String? { get { self[1] } set { self[1] = newValue } }
+    var format: String? { get { self[2] } set { self[2] = newValue } }
 }
 
 /// Generated wire model for `TST.ReferenceNodeArchive`.
 final class TST_ReferenceNodeArchive: IWAMessage {
-    var `super`: TST_ExpressionNodeArchive?
-    var rangereference: TSCE_RangeReferenceArchive?
-    var preserveFlags: UInt32?
-    var hosttableid: String?
-    var hostCellRef: TSCE_CellReferenceArchive?
-    var tableUid: TSP_UUID?
-    var rangeTopLeft: TSP_UUIDCoordArchive?
-    var rangeBottomRight: TSP_UUIDCoordArchive?
-    var categoryRef: TSCE_CategoryReferenceArchive?
-    var uidRangeRect: TSP_UUIDRectArchive?
-    var spillRangeOpSuffix: Bool?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TST_ExpressionNodeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_ExpressionNodeArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: TSCE_RangeReferenceArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_RangeReferenceArchive(ProtobufMessage(_b)) }
-            if let _v { rangereference = _v }
-        case 3:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { preserveFlags = _v }
-        case 4:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { hosttableid = _v }
-        case 10:
-            var _v: TSCE_CellReferenceArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CellReferenceArchive(ProtobufMessage(_b)) }
-            if let _v { hostCellRef = _v }
-        case 5:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { tableUid = _v }
-        case 6:
-            var _v: TSP_UUIDCoordArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUIDCoordArchive(ProtobufMessage(_b)) }
-            if let _v { rangeTopLeft = _v }
-        case 7:
-            var _v: TSP_UUIDCoordArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUIDCoordArchive(ProtobufMessage(_b)) }
-            if let _v { rangeBottomRight = _v }
-        case 8:
-            var _v: TSCE_CategoryReferenceArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CategoryReferenceArchive(ProtobufMessage(_b)) }
-            if let _v { categoryRef = _v }
-        case 9:
-            var _v: TSP_UUIDRectArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUIDRectArchive(ProtobufMessage(_b)) }
-            if let _v { uidRangeRect = _v }
-        case 11:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { spillRangeOpSuffix = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = rangereference { _w.bytesField(2, _x.encoded()) }
-        if let _x = preserveFlags { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = hosttableid { _w.stringField(4, _x) }
-        if let _x = hostCellRef { _w.bytesField(10, _x.encoded()) }
-        if let _x = tableUid { _w.bytesField(5, _x.encoded()) }
-        if let _x = rangeTopLeft { _w.bytesField(6, _x.encoded()) }
-        if let _x = rangeBottomRight { _w.bytesField(7, _x.encoded()) }
-        if let _x = categoryRef { _w.bytesField(8, _x.encoded()) }
-        if let _x = uidRangeRect { _w.bytesField(9, _x.encoded()) }
-        if let _x = spillRangeOpSuffix { _w.varintField(11, _x ? 1 : 0) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.ReferenceNodeArchive", [
+        .optional(1, TST_ExpressionNodeArchive.self), .optional(2, TSCE_RangeReferenceArchive.self),
+        .optional(3, .uint32), .optional(4, .string), .optional(10, TSCE_CellReferenceArchive.self),
+        .optional(5, TSP_UUID.self), .optional(6, TSP_UUIDCoordArchive.self), .optional(7, TSP_UUIDCoordArchive.self),
+        .optional(8, TSCE_CategoryReferenceArchive.self), .optional(9, TSP_UUIDRectArchive.self), .optional(11, .bool),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 11)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var `super`: TST_ExpressionNodeArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var rangereference: TSCE_RangeReferenceArchive? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var preserveFlags: UInt32? { get { self[2] } set { self[2] = newValue } }
+    var hosttableid: String? { get { self[3] } set { self[3] = newValue } }
+    var hostCellRef: TSCE_CellReferenceArchive? { get { self[message: 4] } set { self[message: 4] = newValue } }
+    var tableUid: TSP_UUID? { get { self[message: 5] } set { self[message: 5] = newValue } }
+    var rangeTopLeft: TSP_UUIDCoordArchive? { get { self[message: 6] } set { self[message: 6] = newValue } }
+    var rangeBottomRight: TSP_UUIDCoordArchive? { get { self[message: 7] } set { self[message: 7] = newValue } }
+    var categoryRef: TSCE_CategoryReferenceArchive? { get { self[message: 8] } set { self[message: 8] = newValue } }
+    var uidRangeRect: TSP_UUIDRectArchive? { get { self[message: 9] } set { self[message: 9] = newValue } }
+    var spillRangeOpSuffix: Bool? { get { self[10] } set { self[10] = newValue } }
 }
 
 /// Generated wire model for `TST.DurationNodeArchive`.
 final class TST_DurationNodeArchive: IWAMessage {
-    var `super`: TST_ExpressionNodeArchive?
-    var timeinterval: Double?
-    var smallest: UInt32?
-    var largest: UInt32?
-    var style: UInt32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TST_ExpressionNodeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_ExpressionNodeArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { timeinterval = _v }
-        case 3:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { smallest = _v }
-        case 4:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { largest = _v }
-        case 5:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { style = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = timeinterval { _w.fixed64Field(2, _x.bitPattern) }
-        if let _x = smallest { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = largest { _w.varintField(4, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = style { _w.varintField(5, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.DurationNodeArchive", [
+        .optional(1, TST_ExpressionNodeArchive.self), .optional(2, .double), .optional(3, .uint32),
+        .optional(4, .uint32), .optional(5, .uint32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 5)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var `super`: TST_ExpressionNodeArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var timeinterval: Double? { get { self[1] } set { self[1] = newValue } }
+    var smallest: UInt32? { get { self[2] } set { self[2] = newValue } }
+    var largest: UInt32? { get { self[3] } set { self[3] = newValue } }
+    var style: UInt32? { get { self[4] } set { self[4] = newValue } }
 }
 
 /// Generated wire model for `TST.ArgumentPlaceholderNodeArchive`.
 final class TST_ArgumentPlaceholderNodeArchive: IWAMessage {
-    var `super`: TST_ExpressionNodeArchive?
-    var functionindex: UInt32?
-    var argumentindex: UInt32?
-    var mode: UInt32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TST_ExpressionNodeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_ExpressionNodeArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { functionindex = _v }
-        case 3:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { argumentindex = _v }
-        case 4:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { mode = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = functionindex { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = argumentindex { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = mode { _w.varintField(4, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.ArgumentPlaceholderNodeArchive", [
+        .optional(1, TST_ExpressionNodeArchive.self), .optional(2, .uint32), .optional(3, .uint32),
+        .optional(4, .uint32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var `super`: TST_ExpressionNodeArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var functionindex: UInt32? { get { self[1] } set { self[1] = newValue } }
+    var argumentindex: UInt32? { get { self[2] } set { self[2] = newValue } }
+    var mode: UInt32? { get { self[3] } set { self[3] = newValue } }
 }
 
 /// Generated wire model for `TST.EmptyExpressionNodeArchive`.
 final class TST_EmptyExpressionNodeArchive: IWAMessage {
-    var `super`: TST_ExpressionNodeArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TST_ExpressionNodeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_ExpressionNodeArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.EmptyExpressionNodeArchive", [
+        .optional(1, TST_ExpressionNodeArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var `super`: TST_ExpressionNodeArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
 }
 
 /// Generated wire model for `TST.VariableNodeArchive`.
 final class TST_VariableNodeArchive: IWAMessage {
-    var `super`: TST_ExpressionNodeArchive?
-    var identifier: String?
-    var symbol: UInt32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TST_ExpressionNodeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_ExpressionNodeArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { identifier = _v }
-        case 3:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { symbol = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = identifier { _w.stringField(2, _x) }
-        if let _x = symbol { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.VariableNodeArchive", [
+        .optional(1, TST_ExpressionNodeArchive.self), .optional(2, .string), .optional(3, .uint32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var `super`: TST_ExpressionNodeArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var identifier: String? { get { self[1] } set { self[1] = newValue } }
+    var symbol: UInt32? { get { self[2] } set { self[2] = newValue } }
 }
 
 /// Generated wire model for `TST.SpillOriginRefNodeArchive`.
 final class TST_SpillOriginRefNodeArchive: IWAMessage {
-    var `super`: TST_ExpressionNodeArchive?
-    var spillOriginCoord: TSCE_CellCoordinateArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TST_ExpressionNodeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_ExpressionNodeArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: TSCE_CellCoordinateArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CellCoordinateArchive(ProtobufMessage(_b)) }
-            if let _v { spillOriginCoord = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = spillOriginCoord { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.SpillOriginRefNodeArchive", [
+        .optional(1, TST_ExpressionNodeArchive.self), .optional(2, TSCE_CellCoordinateArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var `super`: TST_ExpressionNodeArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var spillOriginCoord: TSCE_CellCoordinateArchive? { get { self[message: 1] } set { self[message: 1] = newValue } }
 }
 
 /// Generated wire model for `TST.LayoutHintArchive`.
 final class TST_LayoutHintArchive: IWAMessage {
-    var isvalid: Bool?
-    var cellrange: TST_CellRange?
-    var hintid: TST_CellID?
-    var maximumsize: TSP_Size?
-    var partitionposition: UInt32?
-    var horizontal: Bool?
-    var effectivesize: TSP_Size?
-    var partitioningpass: UInt32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { isvalid = _v }
-        case 2:
-            var _v: TST_CellRange?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_CellRange(ProtobufMessage(_b)) }
-            if let _v { cellrange = _v }
-        case 3:
-            var _v: TST_CellID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_CellID(ProtobufMessage(_b)) }
-            if let _v { hintid = _v }
-        case 4:
-            var _v: TSP_Size?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Size(ProtobufMessage(_b)) }
-            if let _v { maximumsize = _v }
-        case 5:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { partitionposition = _v }
-        case 6:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { horizontal = _v }
-        case 7:
-            var _v: TSP_Size?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Size(ProtobufMessage(_b)) }
-            if let _v { effectivesize = _v }
-        case 8:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { partitioningpass = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = isvalid { _w.varintField(1, _x ? 1 : 0) }
-        if let _x = cellrange { _w.bytesField(2, _x.encoded()) }
-        if let _x = hintid { _w.bytesField(3, _x.encoded()) }
-        if let _x = maximumsize { _w.bytesField(4, _x.encoded()) }
-        if let _x = partitionposition { _w.varintField(5, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = horizontal { _w.varintField(6, _x ? 1 : 0) }
-        if let _x = effectivesize { _w.bytesField(7, _x.encoded()) }
-        if let _x = partitioningpass { _w.varintField(8, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.LayoutHintArchive", [
+        .optional(1, .bool), .optional(2, TST_CellRange.self), .optional(3, TST_CellID.self),
+        .optional(4, TSP_Size.self), .optional(5, .uint32), .optional(6, .bool), .optional(7, TSP_Size.self),
+        .optional(8, .uint32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 8)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var isvalid: Bool? { get { self[0] } set { self[0] = newValue } }
+    var cellrange: TST_CellRange? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var hintid: TST_CellID? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var maximumsize: TSP_Size? { get { self[message: 3] } set { self[message: 3] = newValue } }
+    var partitionposition: UInt32? { get { self[4] } set { self[4] = newValue } }
+    var horizontal: Bool? { get { self[5] } set { self[5] = newValue } }
+    var effectivesize: TSP_Size? { get { self[message: 6] } set { self[message: 6] = newValue } }
+    var partitioningpass: UInt32? { get { self[7] } set { self[7] = newValue } }
 }
 
 /// Generated wire model for `TST.CompletionTokenAttachmentArchive`.
 final class TST_CompletionTokenAttachmentArchive: IWAMessage {
-    var `super`: TST_TokenAttachmentArchive?
-    var completiontext: String?
-    var caretposition: UInt32?
-    var prefixstart: UInt32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TST_TokenAttachmentArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_TokenAttachmentArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { completiontext = _v }
-        case 3:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { caretposition = _v }
-        case 4:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { prefixstart = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = completiontext { _w.stringField(2, _x) }
-        if let _x = caretposition { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = prefixstart { _w.varintField(4, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.CompletionTokenAttachmentArchive", [
+        .optional(1, TST_TokenAttachmentArchive.self), .optional(2, .string), .optional(3, .uint32),
+        .optional(4, .uint32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var `super`: TST_TokenAttachmentArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var completiontext: String? { get { self[1] } set { self[1] = newValue } }
+    var caretposition: UInt32? { get { self[2] } set { self[2] = newValue } }
+    var prefixstart: UInt32? { get { self[3] } set { self[3] = newValue } }
 }
 
 /// Generated wire model for `TST.HiddenStateFormulaOwnerArchive`.
 final class TST_HiddenStateFormulaOwnerArchive: IWAMessage {
-    var ownerId: TSP_CFUUIDArchive?
-    var thresholdValue: [TSCE_CellValueArchive] = []
-    var needsToUpdateFilterSetForImport: Bool?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_CFUUIDArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_CFUUIDArchive(ProtobufMessage(_b)) }
-            if let _v { ownerId = _v }
-        case 2:
-            var _v: TSCE_CellValueArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CellValueArchive(ProtobufMessage(_b)) }
-            if let _v { thresholdValue.append(_v) }
-        case 3:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { needsToUpdateFilterSetForImport = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = ownerId { _w.bytesField(1, _x.encoded()) }
-        for _x in thresholdValue { _w.bytesField(2, _x.encoded()) }
-        if let _x = needsToUpdateFilterSetForImport { _w.varintField(3, _x ? 1 : 0) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.HiddenStateFormulaOwnerArchive", [
+        .optional(1, TSP_CFUUIDArchive.self), .repeated(2, TSCE_CellValueArchive.self), .optional(3, .bool),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var ownerId: TSP_CFUUIDArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var thresholdValue: [TSCE_CellValueArchive] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(thresholdValue value: TSCE_CellValueArchive) { append(value, toMessages: 1) }
+    var needsToUpdateFilterSetForImport: Bool? { get { self[2] } set { self[2] = newValue } }
 }
 
 /// Generated wire model for `TST.FormulaStoreArchive`.
 final class TST_FormulaStoreArchive: IWAMessage {
-    var nextFormulaIndex: UInt32?
-    var formulas: [TST_FormulaStoreArchive_FormulaStorePair] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { nextFormulaIndex = _v }
-        case 3:
-            var _v: TST_FormulaStoreArchive_FormulaStorePair?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_FormulaStoreArchive_FormulaStorePair(ProtobufMessage(_b)) }
-            if let _v { formulas.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = nextFormulaIndex { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        for _x in formulas { _w.bytesField(3, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.FormulaStoreArchive", [
+        .optional(2, .uint32), .repeated(3, TST_FormulaStoreArchive_FormulaStorePair.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var nextFormulaIndex: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var formulas: [TST_FormulaStoreArchive_FormulaStorePair] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(formulas value: TST_FormulaStoreArchive_FormulaStorePair) { append(value, toMessages: 1) }
 }
 
 /// Generated wire model for `TST.FormulaStoreArchive.FormulaStorePair`.
 final class TST_FormulaStoreArchive_FormulaStorePair: IWAMessage {
-    var formulaIndex: UInt32?
-    var formula: TSCE_FormulaArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { formulaIndex = _v }
-        case 2:
-            var _v: TSCE_FormulaArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_FormulaArchive(ProtobufMessage(_b)) }
-            if let _v { formula = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = formulaIndex { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = formula { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.FormulaStoreArchive.FormulaStorePair", [
+        .optional(1, .uint32), .optional(2, TSCE_FormulaArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var formulaIndex: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var formula: TSCE_FormulaArchive? { get { self[message: 1] } set { self[message: 1] = newValue } }
 }
 
 /// Generated wire model for `TST.MergeOperationArchive`.
 final class TST_MergeOperationArchive: IWAMessage {
-    var mergeType: Int32?
-    var mergeRanges: [TSP_UUIDRectArchive] = []
-    var mergeFormulas: [TSCE_FormulaArchive] = []
-    var mergeFormulaIndexes: [UInt32] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { mergeType = _v }
-        case 2:
-            var _v: TSP_UUIDRectArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUIDRectArchive(ProtobufMessage(_b)) }
-            if let _v { mergeRanges.append(_v) }
-        case 3:
-            var _v: TSCE_FormulaArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_FormulaArchive(ProtobufMessage(_b)) }
-            if let _v { mergeFormulas.append(_v) }
-        case 4:
-            if case .varint(let _u) = _f.value { mergeFormulaIndexes.append(UInt32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { mergeFormulaIndexes.append(UInt32(truncatingIfNeeded: _u)) } }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = mergeType { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        for _x in mergeRanges { _w.bytesField(2, _x.encoded()) }
-        for _x in mergeFormulas { _w.bytesField(3, _x.encoded()) }
-        for _x in mergeFormulaIndexes { _w.varintField(4, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.MergeOperationArchive", [
+        .optional(1, .int32), .repeated(2, TSP_UUIDRectArchive.self), .repeated(3, TSCE_FormulaArchive.self),
+        .repeated(4, .uint32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var mergeType: Int32? { get { self[0] } set { self[0] = newValue } }
+    var mergeRanges: [TSP_UUIDRectArchive] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(mergeRanges value: TSP_UUIDRectArchive) { append(value, toMessages: 1) }
+    var mergeFormulas: [TSCE_FormulaArchive] { get { self[messages: 2] } set { self[messages: 2] = newValue } }
+    func append(mergeFormulas value: TSCE_FormulaArchive) { append(value, toMessages: 2) }
+    var mergeFormulaIndexes: [UInt32] { get { self[all: 3] } set { self[all: 3] = newValue } }
+    func append(mergeFormulaIndexes value: UInt32) { append(value, toAll: 3) }
 }
 
 /// Generated wire model for `TST.MergeOwnerArchive`.
 final class TST_MergeOwnerArchive: IWAMessage {
-    var ownerId: TSP_CFUUIDArchive?
-    var formulaStore: TST_FormulaStoreArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_CFUUIDArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_CFUUIDArchive(ProtobufMessage(_b)) }
-            if let _v { ownerId = _v }
-        case 2:
-            var _v: TST_FormulaStoreArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_FormulaStoreArchive(ProtobufMessage(_b)) }
-            if let _v { formulaStore = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = ownerId { _w.bytesField(1, _x.encoded()) }
-        if let _x = formulaStore { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.MergeOwnerArchive", [
+        .optional(1, TSP_CFUUIDArchive.self), .optional(2, TST_FormulaStoreArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var ownerId: TSP_CFUUIDArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var formulaStore: TST_FormulaStoreArchive? { get { self[message: 1] } set { self[message: 1] = newValue } }
 }
 
 /// Generated wire model for `TST.PencilAnnotationArchive`.
 final class TST_PencilAnnotationArchive: IWAMessage {
-    var tableInfo: TSP_Reference?
-    var pencilAnnotationStorage: TSP_Reference?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { tableInfo = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { pencilAnnotationStorage = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = tableInfo { _w.bytesField(1, _x.encoded()) }
-        if let _x = pencilAnnotationStorage { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.PencilAnnotationArchive", [
+        .optional(1, TSP_Reference.self), .optional(2, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var tableInfo: TSP_Reference? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var pencilAnnotationStorage: TSP_Reference? { get { self[message: 1] } set { self[message: 1] = newValue } }
 }
 
 /// Generated wire model for `TST.PencilAnnotationOwnerArchive`.
 final class TST_PencilAnnotationOwnerArchive: IWAMessage {
-    var ownerId: TSP_CFUUIDArchive?
-    var formulaStore: TST_FormulaStoreArchive?
-    var annotations: [TSP_Reference] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_CFUUIDArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_CFUUIDArchive(ProtobufMessage(_b)) }
-            if let _v { ownerId = _v }
-        case 2:
-            var _v: TST_FormulaStoreArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_FormulaStoreArchive(ProtobufMessage(_b)) }
-            if let _v { formulaStore = _v }
-        case 3:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { annotations.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = ownerId { _w.bytesField(1, _x.encoded()) }
-        if let _x = formulaStore { _w.bytesField(2, _x.encoded()) }
-        for _x in annotations { _w.bytesField(3, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.PencilAnnotationOwnerArchive", [
+        .optional(1, TSP_CFUUIDArchive.self), .optional(2, TST_FormulaStoreArchive.self),
+        .repeated(3, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var ownerId: TSP_CFUUIDArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var formulaStore: TST_FormulaStoreArchive? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var annotations: [TSP_Reference] { get { self[messages: 2] } set { self[messages: 2] = newValue } }
+    func append(annotations value: TSP_Reference) { append(value, toMessages: 2) }
 }
 
 /// Generated wire model for `TST.AccumulatorArchive`.
 final class TST_AccumulatorArchive: IWAMessage {
-    var boolCount: UInt32?
-    var numberCount: UInt32?
-    var dateCount: UInt32?
-    var durationCount: UInt32?
-    var stringCount: UInt32?
-    var minValue: TSCE_CellValueArchive?
-    var maxValue: TSCE_CellValueArchive?
-    var numberTotalValue: TSCE_CellValueArchive?
-    var firstDateSeen: TSCE_CellValueArchive?
-    var totalSecsSinceRefDate: Double?
-    var secsToAdd: Double?
-    var boolTrueCount: UInt32?
-    var errorCount: UInt32?
-    var isCircularRef: Bool?
-    var productValue: TSCE_CellValueArchive?
-    var noContentCount: UInt32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { boolCount = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { numberCount = _v }
-        case 3:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { dateCount = _v }
-        case 4:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { durationCount = _v }
-        case 5:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { stringCount = _v }
-        case 6:
-            var _v: TSCE_CellValueArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CellValueArchive(ProtobufMessage(_b)) }
-            if let _v { minValue = _v }
-        case 7:
-            var _v: TSCE_CellValueArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CellValueArchive(ProtobufMessage(_b)) }
-            if let _v { maxValue = _v }
-        case 8:
-            var _v: TSCE_CellValueArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CellValueArchive(ProtobufMessage(_b)) }
-            if let _v { numberTotalValue = _v }
-        case 9:
-            var _v: TSCE_CellValueArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CellValueArchive(ProtobufMessage(_b)) }
-            if let _v { firstDateSeen = _v }
-        case 10:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { totalSecsSinceRefDate = _v }
-        case 11:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { secsToAdd = _v }
-        case 12:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { boolTrueCount = _v }
-        case 13:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { errorCount = _v }
-        case 14:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { isCircularRef = _v }
-        case 15:
-            var _v: TSCE_CellValueArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CellValueArchive(ProtobufMessage(_b)) }
-            if let _v { productValue = _v }
-        case 16:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { noContentCount = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = boolCount { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = numberCount { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = dateCount { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = durationCount { _w.varintField(4, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = stringCount { _w.varintField(5, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = minValue { _w.bytesField(6, _x.encoded()) }
-        if let _x = maxValue { _w.bytesField(7, _x.encoded()) }
-        if let _x = numberTotalValue { _w.bytesField(8, _x.encoded()) }
-        if let _x = firstDateSeen { _w.bytesField(9, _x.encoded()) }
-        if let _x = totalSecsSinceRefDate { _w.fixed64Field(10, _x.bitPattern) }
-        if let _x = secsToAdd { _w.fixed64Field(11, _x.bitPattern) }
-        if let _x = boolTrueCount { _w.varintField(12, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = errorCount { _w.varintField(13, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = isCircularRef { _w.varintField(14, _x ? 1 : 0) }
-        if let _x = productValue { _w.bytesField(15, _x.encoded()) }
-        if let _x = noContentCount { _w.varintField(16, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.AccumulatorArchive", [
+        .optional(1, .uint32), .optional(2, .uint32), .optional(3, .uint32), .optional(4, .uint32),
+        .optional(5, .uint32), .optional(6, TSCE_CellValueArchive.self), .optional(7, TSCE_CellValueArchive.self),
+        .optional(8, TSCE_CellValueArchive.self), .optional(9, TSCE_CellValueArchive.self), .optional(10, .double),
+        .optional(11, .double), .optional(12, .uint32), .optional(13, .uint32), .optional(14, .bool),
+        .optional(15, TSCE_CellValueArchive.self), .optional(16, .uint32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 16)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var boolCount: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var numberCount: UInt32? { get { self[1] } set { self[1] = newValue } }
+    var dateCount: UInt32? { get { self[2] } set { self[2] = newValue } }
+    var durationCount: UInt32? { get { self[3] } set { self[3] = newValue } }
+    var stringCount: UInt32? { get { self[4] } set { self[4] = newValue } }
+    var minValue: TSCE_CellValueArchive? { get { self[message: 5] } set { self[message: 5] = newValue } }
+    var maxValue: TSCE_CellValueArchive? { get { self[message: 6] } set { self[message: 6] = newValue } }
+    var numberTotalValue: TSCE_CellValueArchive? { get { self[message: 7] } set { self[message: 7] = newValue } }
+    var firstDateSeen: TSCE_CellValueArchive? { get { self[message: 8] } set { self[message: 8] = newValue } }
+    var totalSecsSinceRefDate: Double? { get { self[9] } set { self[9] = newValue } }
+    var secsToAdd: Double? { get { self[10] } set { self[10] = newValue } }
+    var boolTrueCount: UInt32? { get { self[11] } set { self[11] = newValue } }
+    var errorCount: UInt32? { get { self[12] } set { self[12] = newValue } }
+    var isCircularRef: Bool? { get { self[13] } set { self[13] = newValue } }
+    var productValue: TSCE_CellValueArchive? { get { self[message: 14] } set { self[message: 14] = newValue } }
+    var noContentCount: UInt32? { get { self[15] } set { self[15] = newValue } }
 }
 
 /// Generated wire model for `TST.GroupColumnArchive`.
 final class TST_GroupColumnArchive: IWAMessage {
-    var columnUid: TSP_UUID?
-    var groupingType: UInt32?
-    var groupingFunctor: TSCE_FunctorArchive?
-    var groupingColumnUid: TSP_UUID?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { columnUid = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { groupingType = _v }
-        case 3:
-            var _v: TSCE_FunctorArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_FunctorArchive(ProtobufMessage(_b)) }
-            if let _v { groupingFunctor = _v }
-        case 4:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { groupingColumnUid = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = columnUid { _w.bytesField(1, _x.encoded()) }
-        if let _x = groupingType { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = groupingFunctor { _w.bytesField(3, _x.encoded()) }
-        if let _x = groupingColumnUid { _w.bytesField(4, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.GroupColumnArchive", [
+        .optional(1, TSP_UUID.self), .optional(2, .uint32), .optional(3, TSCE_FunctorArchive.self),
+        .optional(4, TSP_UUID.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var columnUid: TSP_UUID? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var groupingType: UInt32? { get { self[1] } set { self[1] = newValue } }
+    var groupingFunctor: TSCE_FunctorArchive? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var groupingColumnUid: TSP_UUID? { get { self[message: 3] } set { self[message: 3] = newValue } }
 }
 
 /// Generated wire model for `TST.GroupColumnListArchive`.
 final class TST_GroupColumnListArchive: IWAMessage {
-    var groupColumn: [TST_GroupColumnArchive] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TST_GroupColumnArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_GroupColumnArchive(ProtobufMessage(_b)) }
-            if let _v { groupColumn.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in groupColumn { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.GroupColumnListArchive", [
+        .repeated(1, TST_GroupColumnArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var groupColumn: [TST_GroupColumnArchive] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(groupColumn value: TST_GroupColumnArchive) { append(value, toMessages: 0) }
 }
 
 /// Generated wire model for `TST.ColumnAggregateArchive`.
 final class TST_ColumnAggregateArchive: IWAMessage {
-    var columnUid: TSP_UUID?
-    var level: UInt32?
-    var aggType: UInt32?
-    var showAsType: UInt32?
-    var columnAggregateUid: TSP_UUID?
-    var runningTotalGroupColumnUid: TSP_UUID?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { columnUid = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { level = _v }
-        case 3:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { aggType = _v }
-        case 4:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { showAsType = _v }
-        case 5:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { columnAggregateUid = _v }
-        case 6:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { runningTotalGroupColumnUid = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = columnUid { _w.bytesField(1, _x.encoded()) }
-        if let _x = level { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = aggType { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = showAsType { _w.varintField(4, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = columnAggregateUid { _w.bytesField(5, _x.encoded()) }
-        if let _x = runningTotalGroupColumnUid { _w.bytesField(6, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.ColumnAggregateArchive", [
+        .optional(1, TSP_UUID.self), .optional(2, .uint32), .optional(3, .uint32), .optional(4, .uint32),
+        .optional(5, TSP_UUID.self), .optional(6, TSP_UUID.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 6)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var columnUid: TSP_UUID? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var level: UInt32? { get { self[1] } set { self[1] = newValue } }
+    var aggType: UInt32? { get { self[2] } set { self[2] = newValue } }
+    var showAsType: UInt32? { get { self[3] } set { self[3] = newValue } }
+    var columnAggregateUid: TSP_UUID? { get { self[message: 4] } set { self[message: 4] = newValue } }
+    var runningTotalGroupColumnUid: TSP_UUID? { get { self[message: 5] } set { self[message: 5] = newValue } }
 }
 
 /// Generated wire model for `TST.ColumnAggregateListArchive`.
 final class TST_ColumnAggregateListArchive: IWAMessage {
-    var aggregates: [TST_ColumnAggregateArchive] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TST_ColumnAggregateArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_ColumnAggregateArchive(ProtobufMessage(_b)) }
-            if let _v { aggregates.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in aggregates { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.ColumnAggregateListArchive", [
+        .repeated(1, TST_ColumnAggregateArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var aggregates: [TST_ColumnAggregateArchive] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(aggregates value: TST_ColumnAggregateArchive) { append(value, toMessages: 0) }
 }
 
 /// Generated wire model for `TST.GroupByArchive`.
 final class TST_GroupByArchive: IWAMessage {
-    var groupByUid: TSP_UUID?
-    var groupColumn: [TST_GroupColumnArchive] = []
-    var groupNodeRoot: TST_GroupByArchive_GroupNodeArchive?
-    var aggregator: [TST_GroupByArchive_AggregatorArchive] = []
-    var columnAggType: [TST_ColumnAggregateArchive] = []
-    var isEnabled: Bool?
-    var indirectAggTypeChangeFormula: TSCE_CellCoordinateArchive?
-    var groupingColumnsFormula: TSCE_CellCoordinateArchive?
-    var aggsInGroupRootFormula: TSCE_CellCoordinateArchive?
-    var groupingColumnHeadersFormula: TSCE_CellCoordinateArchive?
-    var columnOrderChangedFormula: TSCE_CellCoordinateArchive?
-    var rowOrderChangedFormula: TSCE_CellCoordinateArchive?
-    var rowOrderChangedIgnoringRecalcFormula: TSCE_CellCoordinateArchive?
-    var ownerIndex: Int32?
-    var rowUidLookup: TSCE_UidLookupListArchive?
-    var hiddenStatesChangedFormula: TSCE_CellCoordinateArchive?
-    var aggregatorRef: [TSP_Reference] = []
-    var groupNodeRootRef: TSP_Reference?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { groupByUid = _v }
-        case 2:
-            var _v: TST_GroupColumnArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_GroupColumnArchive(ProtobufMessage(_b)) }
-            if let _v { groupColumn.append(_v) }
-        case 3:
-            var _v: TST_GroupByArchive_GroupNodeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_GroupByArchive_GroupNodeArchive(ProtobufMessage(_b)) }
-            if let _v { groupNodeRoot = _v }
-        case 4:
-            var _v: TST_GroupByArchive_AggregatorArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_GroupByArchive_AggregatorArchive(ProtobufMessage(_b)) }
-            if let _v { aggregator.append(_v) }
-        case 5:
-            var _v: TST_ColumnAggregateArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_ColumnAggregateArchive(ProtobufMessage(_b)) }
-            if let _v { columnAggType.append(_v) }
-        case 6:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { isEnabled = _v }
-        case 7:
-            var _v: TSCE_CellCoordinateArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CellCoordinateArchive(ProtobufMessage(_b)) }
-            if let _v { indirectAggTypeChangeFormula = _v }
-        case 8:
-            var _v: TSCE_CellCoordinateArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CellCoordinateArchive(ProtobufMessage(_b)) }
-            if let _v { groupingColumnsFormula = _v }
-        case 9:
-            var _v: TSCE_CellCoordinateArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CellCoordinateArchive(ProtobufMessage(_b)) }
-            if let _v { aggsInGroupRootFormula = _v }
-        case 10:
-            var _v: TSCE_CellCoordinateArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CellCoordinateArchive(ProtobufMessage(_b)) }
-            if let _v { groupingColumnHeadersFormula = _v }
-        case 11:
-            var _v: TSCE_CellCoordinateArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CellCoordinateArchive(ProtobufMessage(_b)) }
-            if let _v { columnOrderChangedFormula = _v }
-        case 12:
-            var _v: TSCE_CellCoordinateArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CellCoordinateArchive(ProtobufMessage(_b)) }
-            if let _v { rowOrderChangedFormula = _v }
-        case 13:
-            var _v: TSCE_CellCoordinateArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CellCoordinateArchive(ProtobufMessage(_b)) }
-            if let _v { rowOrderChangedIgnoringRecalcFormula = _v }
-        case 14:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { ownerIndex = _v }
-        case 15:
-            var _v: TSCE_UidLookupListArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_UidLookupListArchive(ProtobufMessage(_b)) }
-            if let _v { rowUidLookup = _v }
-        case 16:
-            var _v: TSCE_CellCoordinateArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CellCoordinateArchive(ProtobufMessage(_b)) }
-            if let _v { hiddenStatesChangedFormula = _v }
-        case 17:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { aggregatorRef.append(_v) }
-        case 18:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { groupNodeRootRef = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = groupByUid { _w.bytesField(1, _x.encoded()) }
-        for _x in groupColumn { _w.bytesField(2, _x.encoded()) }
-        if let _x = groupNodeRoot { _w.bytesField(3, _x.encoded()) }
-        for _x in aggregator { _w.bytesField(4, _x.encoded()) }
-        for _x in columnAggType { _w.bytesField(5, _x.encoded()) }
-        if let _x = isEnabled { _w.varintField(6, _x ? 1 : 0) }
-        if let _x = indirectAggTypeChangeFormula { _w.bytesField(7, _x.encoded()) }
-        if let _x = groupingColumnsFormula { _w.bytesField(8, _x.encoded()) }
-        if let _x = aggsInGroupRootFormula { _w.bytesField(9, _x.encoded()) }
-        if let _x = groupingColumnHeadersFormula { _w.bytesField(10, _x.encoded()) }
-        if let _x = columnOrderChangedFormula { _w.bytesField(11, _x.encoded()) }
-        if let _x = rowOrderChangedFormula { _w.bytesField(12, _x.encoded()) }
-        if let _x = rowOrderChangedIgnoringRecalcFormula { _w.bytesField(13, _x.encoded()) }
-        if let _x = ownerIndex { _w.varintField(14, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = rowUidLookup { _w.bytesField(15, _x.encoded()) }
-        if let _x = hiddenStatesChangedFormula { _w.bytesField(16, _x.encoded()) }
-        for _x in aggregatorRef { _w.bytesField(17, _x.encoded()) }
-        if let _x = groupNodeRootRef { _w.bytesField(18, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.GroupByArchive", [
+        .optional(1, TSP_UUID.self), .repeated(2, TST_GroupColumnArchive.self),
+        .optional(3, TST_GroupByArchive_GroupNodeArchive.self), .repeated(4, TST_GroupByArchive_AggregatorArchive.self),
+        .repeated(5, TST_ColumnAggregateArchive.self), .optional(6, .bool),
+        .optional(7, TSCE_CellCoordinateArchive.self), .optional(8, TSCE_CellCoordinateArchive.self),
+        .optional(9, TSCE_CellCoordinateArchive.self), .optional(10, TSCE_CellCoordinateArchive.self),
+        .optional(11, TSCE_CellCoordinateArchive.self), .optional(12, TSCE_CellCoordinateArchive.self),
+        .optional(13, TSCE_CellCoordinateArchive.self), .optional(14, .int32),
+        .optional(15, TSCE_UidLookupListArchive.self), .optional(16, TSCE_CellCoordinateArchive.self),
+        .repeated(17, TSP_Reference.self), .optional(18, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 18)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var groupByUid: TSP_UUID? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var groupColumn: [TST_GroupColumnArchive] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(groupColumn value: TST_GroupColumnArchive) { append(value, toMessages: 1) }
+    var groupNodeRoot: TST_GroupByArchive_GroupNodeArchive? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var aggregator: [TST_GroupByArchive_AggregatorArchive] { get { self[messages: 3] } set { self[messages: 3] = newValue } }
+    func append(aggregator value: TST_GroupByArchive_AggregatorArchive) { append(value, toMessages: 3) }
+    var columnAggType: [TST_ColumnAggregateArchive] { get { self[messages: 4] } set { self[messages: 4] = newValue } }
+    func append(columnAggType value: TST_ColumnAggregateArchive) { append(value, toMessages: 4) }
+    var isEnabled: Bool? { get { self[5] } set { self[5] = newValue } }
+    var indirectAggTypeChangeFormula: TSCE_CellCoordinateArchive? { get { self[message: 6] } set { self[message: 6] = newValue } }
+    var groupingColumnsFormula: TSCE_CellCoordinateArchive? { get { self[message: 7] } set { self[message: 7] = newValue } }
+    var aggsInGroupRootFormula: TSCE_CellCoordinateArchive? { get { self[message: 8] } set { self[message: 8] = newValue } }
+    var groupingColumnHeadersFormula: TSCE_CellCoordinateArchive? { get { self[message: 9] } set { self[message: 9] = newValue } }
+    var columnOrderChangedFormula: TSCE_CellCoordinateArchive? { get { self[message: 10] } set { self[message: 10] = newValue } }
+    var rowOrderChangedFormula: TSCE_CellCoordinateArchive? { get { self[message: 11] } set { self[message: 11] = newValue } }
+    var rowOrderChangedIgnoringRecalcFormula: TSCE_CellCoordinateArchive? { get { self[message: 12] } set { self[message: 12] = newValue } }
+    var ownerIndex: Int32? { get { self[13] } set { self[13] = newValue } }
+    var rowUidLookup: TSCE_UidLookupListArchive? { get { self[message: 14] } set { self[message: 14] = newValue } }
+    var hiddenStatesChangedFormula: TSCE_CellCoordinateArchive? { get { self[message: 15] } set { self[message: 15] = newValue } }
+    var aggregatorRef: [TSP_Reference] { get { self[messages: 16] } set { self[messages: 16] = newValue } }
+    func append(aggregatorRef value: TSP_Reference) { append(value, toMessages: 16) }
+    var groupNodeRootRef: TSP_Reference? { get { self[message: 17] } set { self[message: 17] = newValue } }
 }
 
 /// Generated wire model for `TST.GroupByArchive.AggNodeArchive`.
 final class TST_GroupByArchive_AggNodeArchive: IWAMessage {
-    var formulaCoord: TSCE_CellCoordinateArchive?
-    var accum: TST_AccumulatorArchive?
-    var child: [TST_GroupByArchive_AggNodeArchive] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSCE_CellCoordinateArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CellCoordinateArchive(ProtobufMessage(_b)) }
-            if let _v { formulaCoord = _v }
-        case 2:
-            var _v: TST_AccumulatorArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_AccumulatorArchive(ProtobufMessage(_b)) }
-            if let _v { accum = _v }
-        case 3:
-            var _v: TST_GroupByArchive_AggNodeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_GroupByArchive_AggNodeArchive(ProtobufMessage(_b)) }
-            if let _v { child.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = formulaCoord { _w.bytesField(1, _x.encoded()) }
-        if let _x = accum { _w.bytesField(2, _x.encoded()) }
-        for _x in child { _w.bytesField(3, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.GroupByArchive.AggNodeArchive", [
+        .optional(1, TSCE_CellCoordinateArchive.self), .optional(2, TST_AccumulatorArchive.self),
+        .repeated(3, TST_GroupByArchive_AggNodeArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var formulaCoord: TSCE_CellCoordinateArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var accum: TST_AccumulatorArchive? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var child: [TST_GroupByArchive_AggNodeArchive] { get { self[messages: 2] } set { self[messages: 2] = newValue } }
+    func append(child value: TST_GroupByArchive_AggNodeArchive) { append(value, toMessages: 2) }
 }
 
 /// Generated wire model for `TST.GroupByArchive.AggregatorArchive`.
 final class TST_GroupByArchive_AggregatorArchive: IWAMessage {
-    var columnUid: TSP_UUID?
-    var aggNode: TST_GroupByArchive_AggNodeArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { columnUid = _v }
-        case 2:
-            var _v: TST_GroupByArchive_AggNodeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_GroupByArchive_AggNodeArchive(ProtobufMessage(_b)) }
-            if let _v { aggNode = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = columnUid { _w.bytesField(1, _x.encoded()) }
-        if let _x = aggNode { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.GroupByArchive.AggregatorArchive", [
+        .optional(1, TSP_UUID.self), .optional(2, TST_GroupByArchive_AggNodeArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var columnUid: TSP_UUID? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var aggNode: TST_GroupByArchive_AggNodeArchive? { get { self[message: 1] } set { self[message: 1] = newValue } }
 }
 
 /// Generated wire model for `TST.GroupByArchive.GroupNodeArchive`.
 final class TST_GroupByArchive_GroupNodeArchive: IWAMessage {
-    var groupUid: TSP_UUID?
-    var child: [TST_GroupByArchive_GroupNodeArchive] = []
-    var rowUid: [TSP_UUID] = []
-    var aggFormulaCoords: [TSCE_CellCoordinateArchive] = []
-    var formatManager: TST_GroupByArchive_GroupNodeArchive_FormatManagerArchive?
-    var groupCellValue: TSCE_CellValueArchive?
-    var rowIndexes: TSCE_IndexSetArchive?
-    var rowLookupUids: TSCE_IndexSetArchive?
-    var childRef: [TSP_Reference] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { groupUid = _v }
-        case 3:
-            var _v: TST_GroupByArchive_GroupNodeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_GroupByArchive_GroupNodeArchive(ProtobufMessage(_b)) }
-            if let _v { child.append(_v) }
-        case 4:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { rowUid.append(_v) }
-        case 5:
-            var _v: TSCE_CellCoordinateArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CellCoordinateArchive(ProtobufMessage(_b)) }
-            if let _v { aggFormulaCoords.append(_v) }
-        case 6:
-            var _v: TST_GroupByArchive_GroupNodeArchive_FormatManagerArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_GroupByArchive_GroupNodeArchive_FormatManagerArchive(ProtobufMessage(_b)) }
-            if let _v { formatManager = _v }
-        case 7:
-            var _v: TSCE_CellValueArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CellValueArchive(ProtobufMessage(_b)) }
-            if let _v { groupCellValue = _v }
-        case 8:
-            var _v: TSCE_IndexSetArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_IndexSetArchive(ProtobufMessage(_b)) }
-            if let _v { rowIndexes = _v }
-        case 9:
-            var _v: TSCE_IndexSetArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_IndexSetArchive(ProtobufMessage(_b)) }
-            if let _v { rowLookupUids = _v }
-        case 10:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { childRef.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = groupUid { _w.bytesField(1, _x.encoded()) }
-        for _x in child { _w.bytesField(3, _x.encoded()) }
-        for _x in rowUid { _w.bytesField(4, _x.encoded()) }
-        for _x in aggFormulaCoords { _w.bytesField(5, _x.encoded()) }
-        if let _x = formatManager { _w.bytesField(6, _x.encoded()) }
-        if let _x = groupCellValue { _w.bytesField(7, _x.encoded()) }
-        if let _x = rowIndexes { _w.bytesField(8, _x.encoded()) }
-        if let _x = rowLookupUids { _w.bytesField(9, _x.encoded()) }
-        for _x in childRef { _w.bytesField(10, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.GroupByArchive.GroupNodeArchive", [
+        .optional(1, TSP_UUID.self), .repeated(3, TST_GroupByArchive_GroupNodeArchive.self),
+        .repeated(4, TSP_UUID.self), .repeated(5, TSCE_CellCoordinateArchive.self),
+        .optional(6, TST_GroupByArchive_GroupNodeArchive_FormatManagerArchive.self),
+        .optional(7, TSCE_CellValueArchive.self), .optional(8, TSCE_IndexSetArchive.self),
+        .optional(9, TSCE_IndexSetArchive.self), .repeated(10, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 9)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var groupUid: TSP_UUID? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var child: [TST_GroupByArchive_GroupNodeArchive] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(child value: TST_GroupByArchive_GroupNodeArchive) { append(value, toMessages: 1) }
+    var rowUid: [TSP_UUID] { get { self[messages: 2] } set { self[messages: 2] = newValue } }
+    func append(rowUid value: TSP_UUID) { append(value, toMessages: 2) }
+    var aggFormulaCoords: [TSCE_CellCoordinateArchive] { get { self[messages: 3] } set { self[messages: 3] = newValue } }
+    func append(aggFormulaCoords value: TSCE_CellCoordinateArchive) { append(value, toMessages: 3) }
+    var formatManager: TST_GroupByArchive_GroupNodeArchive_FormatManagerArchive? { get { self[message: 4] } set { self[message: 4] = newValue } }
+    var groupCellValue: TSCE_CellValueArchive? { get { self[message: 5] } set { self[message: 5] = newValue } }
+    var rowIndexes: TSCE_IndexSetArchive? { get { self[message: 6] } set { self[message: 6] = newValue } }
+    var rowLookupUids: TSCE_IndexSetArchive? { get { self[message: 7] } set { self[message: 7] = newValue } }
+    var childRef: [TSP_Reference] { get { self[messages: 8] } set { self[messages: 8] = newValue } }
+    func append(childRef value: TSP_Reference) { append(value, toMessages: 8) }
 }
 
 /// Generated wire model for `TST.GroupByArchive.GroupNodeArchive.FormatManagerArchive`.
 final class TST_GroupByArchive_GroupNodeArchive_FormatManagerArchive: IWAMessage {
-    var cellValue: TSCE_CellValueArchive?
-    var formats: [TSK_FormatStructArchive] = []
-    var rowSets: [TST_GroupByArchive_GroupNodeArchive_FormatManagerArchive_RowSetArchive] = []
-    var rowUidLookupSets: [TSCE_IndexSetArchive] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSCE_CellValueArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CellValueArchive(ProtobufMessage(_b)) }
-            if let _v { cellValue = _v }
-        case 2:
-            var _v: TSK_FormatStructArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSK_FormatStructArchive(ProtobufMessage(_b)) }
-            if let _v { formats.append(_v) }
-        case 3:
-            var _v: TST_GroupByArchive_GroupNodeArchive_FormatManagerArchive_RowSetArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_GroupByArchive_GroupNodeArchive_FormatManagerArchive_RowSetArchive(ProtobufMessage(_b)) }
-            if let _v { rowSets.append(_v) }
-        case 4:
-            var _v: TSCE_IndexSetArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_IndexSetArchive(ProtobufMessage(_b)) }
-            if let _v { rowUidLookupSets.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = cellValue { _w.bytesField(1, _x.encoded()) }
-        for _x in formats { _w.bytesField(2, _x.encoded()) }
-        for _x in rowSets { _w.bytesField(3, _x.encoded()) }
-        for _x in rowUidLookupSets { _w.bytesField(4, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.GroupByArchive.GroupNodeArchive.FormatManagerArchive", [
+        .optional(1, TSCE_CellValueArchive.self), .repeated(2, TSK_FormatStructArchive.self),
+        .repeated(3, TST_GroupByArchive_GroupNodeArchive_FormatManagerArchive_RowSetArchive.self),
+        .repeated(4, TSCE_IndexSetArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var cellValue: TSCE_CellValueArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var formats: [TSK_FormatStructArchive] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(formats value: TSK_FormatStructArchive) { append(value, toMessages: 1) }
+    var rowSets: [TST_GroupByArchive_GroupNodeArchive_FormatManagerArchive_RowSetArchive] { get { self[messages: 2] } set { self[messages: 2] = newValue } }
+    func append(rowSets value: TST_GroupByArchive_GroupNodeArchive_FormatManagerArchive_RowSetArchive) { append(value, toMessages: 2) }
+    var rowUidLookupSets: [TSCE_IndexSetArchive] { get { self[messages: 3] } set { self[messages: 3] = newValue } }
+    func append(rowUidLookupSets value: TSCE_IndexSetArchive) { append(value, toMessages: 3) }
 }
 
 /// Generated wire model for `TST.GroupByArchive.GroupNodeArchive.FormatManagerArchive.RowSetArchive`.
 final class TST_GroupByArchive_GroupNodeArchive_FormatManagerArchive_RowSetArchive: IWAMessage {
-    var rowUids: [TSP_UUID] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { rowUids.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in rowUids { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.GroupByArchive.GroupNodeArchive.FormatManagerArchive.RowSetArchive", [
+        .repeated(1, TSP_UUID.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var rowUids: [TSP_UUID] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(rowUids value: TSP_UUID) { append(value, toMessages: 0) }
 }
 
 /// Generated wire model for `TST.CategoryOwnerArchive`.
 final class TST_CategoryOwnerArchive: IWAMessage {
-    var ownerUid: TSP_UUID?
-    var groupBy: [TST_GroupByArchive] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { ownerUid = _v }
-        case 2:
-            var _v: TST_GroupByArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_GroupByArchive(ProtobufMessage(_b)) }
-            if let _v { groupBy.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = ownerUid { _w.bytesField(1, _x.encoded()) }
-        for _x in groupBy { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.CategoryOwnerArchive", [
+        .optional(1, TSP_UUID.self), .repeated(2, TST_GroupByArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var ownerUid: TSP_UUID? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var groupBy: [TST_GroupByArchive] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(groupBy value: TST_GroupByArchive) { append(value, toMessages: 1) }
 }
 
 /// Generated wire model for `TST.CategoryOwnerRefArchive`.
 final class TST_CategoryOwnerRefArchive: IWAMessage {
-    var groupBy: [TSP_Reference] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { groupBy.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in groupBy { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.CategoryOwnerRefArchive", [
+        .repeated(1, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var groupBy: [TSP_Reference] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(groupBy value: TSP_Reference) { append(value, toMessages: 0) }
 }
 
 /// Generated wire model for `TST.PivotGroupingColumnOptionsMapArchive`.
 final class TST_PivotGroupingColumnOptionsMapArchive: IWAMessage {
-    var uids: [TSP_UUID] = []
-    var flags: [UInt32] = []
-    var aggregateRuleUids: [TSP_UUID] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { uids.append(_v) }
-        case 2:
-            if case .varint(let _u) = _f.value { flags.append(UInt32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { flags.append(UInt32(truncatingIfNeeded: _u)) } }
-        case 4:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { aggregateRuleUids.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in uids { _w.bytesField(1, _x.encoded()) }
-        for _x in flags { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        for _x in aggregateRuleUids { _w.bytesField(4, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.PivotGroupingColumnOptionsMapArchive", [
+        .repeated(1, TSP_UUID.self), .repeated(2, .uint32), .repeated(4, TSP_UUID.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var uids: [TSP_UUID] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(uids value: TSP_UUID) { append(value, toMessages: 0) }
+    var flags: [UInt32] { get { self[all: 1] } set { self[all: 1] = newValue } }
+    func append(flags value: UInt32) { append(value, toAll: 1) }
+    var aggregateRuleUids: [TSP_UUID] { get { self[messages: 2] } set { self[messages: 2] = newValue } }
+    func append(aggregateRuleUids value: TSP_UUID) { append(value, toMessages: 2) }
 }
 
 /// Generated wire model for `TST.PivotOwnerArchive`.
 final class TST_PivotOwnerArchive: IWAMessage {
-    var pivotOwnerUid: TSP_UUID?
-    var groupingColumnsForRows: TST_GroupColumnListArchive?
-    var groupingColumnsForColumns: TST_GroupColumnListArchive?
-    var aggregateColumns: TST_ColumnAggregateListArchive?
-    var flatteningDimension: Int32?
-    var isEmptyPivot: Bool?
-    var sourceTableUid: TSP_UUID?
-    var refreshTimestamp: Double?
-    var grpgColOptionsMap: TSP_Reference?
-    var hideGrandTotalRows: Bool?
-    var sourceTableName: String?
-    var hideGrandTotalColumns: Bool?
-    var formulaStore: TST_FormulaStoreArchive?
-    var refreshUid: TSP_UUID?
-    var rowColumnRuleChangeUid: TSP_UUID?
-    var aggregateRuleChangeUid: TSP_UUID?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 2:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { pivotOwnerUid = _v }
-        case 3:
-            var _v: TST_GroupColumnListArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_GroupColumnListArchive(ProtobufMessage(_b)) }
-            if let _v { groupingColumnsForRows = _v }
-        case 4:
-            var _v: TST_GroupColumnListArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_GroupColumnListArchive(ProtobufMessage(_b)) }
-            if let _v { groupingColumnsForColumns = _v }
-        case 5:
-            var _v: TST_ColumnAggregateListArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_ColumnAggregateListArchive(ProtobufMessage(_b)) }
-            if let _v { aggregateColumns = _v }
-        case 6:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { flatteningDimension = _v }
-        case 7:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { isEmptyPivot = _v }
-        case 8:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { sourceTableUid = _v }
-        case 9:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { refreshTimestamp = _v }
-        case 10:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { grpgColOptionsMap = _v }
-        case 11:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { hideGrandTotalRows = _v }
-        case 12:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { sourceTableName = _v }
-        case 13:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { hideGrandTotalColumns = _v }
-        case 17:
-            var _v: TST_FormulaStoreArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_FormulaStoreArchive(ProtobufMessage(_b)) }
-            if let _v { formulaStore = _v }
-        case 18:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { refreshUid = _v }
-        case 19:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { rowColumnRuleChangeUid = _v }
-        case 20:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { aggregateRuleChangeUid = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = pivotOwnerUid { _w.bytesField(2, _x.encoded()) }
-        if let _x = groupingColumnsForRows { _w.bytesField(3, _x.encoded()) }
-        if let _x = groupingColumnsForColumns { _w.bytesField(4, _x.encoded()) }
-        if let _x = aggregateColumns { _w.bytesField(5, _x.encoded()) }
-        if let _x = flatteningDimension { _w.varintField(6, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = isEmptyPivot { _w.varintField(7, _x ? 1 : 0) }
-        if let _x = sourceTableUid { _w.bytesField(8, _x.encoded()) }
-        if let _x = refreshTimestamp { _w.fixed64Field(9, _x.bitPattern) }
-        if let _x = grpgColOptionsMap { _w.bytesField(10, _x.encoded()) }
-        if let _x = hideGrandTotalRows { _w.varintField(11, _x ? 1 : 0) }
-        if let _x = sourceTableName { _w.stringField(12, _x) }
-        if let _x = hideGrandTotalColumns { _w.varintField(13, _x ? 1 : 0) }
-        if let _x = formulaStore { _w.bytesField(17, _x.encoded()) }
-        if let _x = refreshUid { _w.bytesField(18, _x.encoded()) }
-        if let _x = rowColumnRuleChangeUid { _w.bytesField(19, _x.encoded()) }
-        if let _x = aggregateRuleChangeUid { _w.bytesField(20, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.PivotOwnerArchive", [
+        .optional(2, TSP_UUID.self), .optional(3, TST_GroupColumnListArchive.self),
+        .optional(4, TST_GroupColumnListArchive.self), .optional(5, TST_ColumnAggregateListArchive.self),
+        .optional(6, .int32), .optional(7, .bool), .optional(8, TSP_UUID.self), .optional(9, .double),
+        .optional(10, TSP_Reference.self), .optional(11, .bool), .optional(12, .string), .optional(13, .bool),
+        .optional(17, TST_FormulaStoreArchive.self), .optional(18, TSP_UUID.self), .optional(19, TSP_UUID.self),
+        .optional(20, TSP_UUID.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 16)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var pivotOwnerUid: TSP_UUID? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var groupingColumnsForRows: TST_GroupColumnListArchive? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var groupingColumnsForColumns: TST_GroupColumnListArchive? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var aggregateColumns: TST_ColumnAggregateListArchive? { get { self[message: 3] } set { self[message: 3] = newValue } }
+    var flatteningDimension: Int32? { get { self[4] } set { self[4] = newValue } }
+    var isEmptyPivot: Bool? { get { self[5] } set { self[5] = newValue } }
+    var sourceTableUid: TSP_UUID? { get { self[message: 6] } set { self[message: 6] = newValue } }
+    var refreshTimestamp: Double? { get { self[7] } set { self[7] = newValue } }
+    var grpgColOptionsMap: TSP_Reference? { get { self[message: 8] } set { self[message: 8] = newValue } }
+    var hideGrandTotalRows: Bool? { get { self[9] } set { self[9] = newValue } }
+    var sourceTableName: String? { get { self[10] } set { self[10] = newValue } }
+    var hideGrandTotalColumns: Bool? { get { self[11] } set { self[11] = newValue } }
+    var formulaStore: TST_FormulaStoreArchive? { get { self[message: 12] } set { self[message: 12] = newValue } }
+    var refreshUid: TSP_UUID? { get { self[message: 13] } set { self[message: 13] = newValue } }
+    var rowColumnRuleChangeUid: TSP_UUID? { get { self[message: 14] } set { self[message: 14] = newValue } }
+    var aggregateRuleChangeUid: TSP_UUID? { get { self[message: 15] } set { self[message: 15] = newValue } }
 }
 
 /// Generated wire model for `TST.RichTextPayloadArchive`.
 final class TST_RichTextPayloadArchive: IWAMessage {
-    var storage: TSP_Reference?
-    var range: TSP_Range?
-    var cellid: TST_CellID?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { storage = _v }
-        case 2:
-            var _v: TSP_Range?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Range(ProtobufMessage(_b)) }
-            if let _v { range = _v }
-        case 3:
-            var _v: TST_CellID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_CellID(ProtobufMessage(_b)) }
-            if let _v { cellid = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = storage { _w.bytesField(1, _x.encoded()) }
-        if let _x = range { _w.bytesField(2, _x.encoded()) }
-        if let _x = cellid { _w.bytesField(3, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.RichTextPayloadArchive", [
+        .optional(1, TSP_Reference.self), .optional(2, TSP_Range.self), .optional(3, TST_CellID.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var storage: TSP_Reference? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var range: TSP_Range? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var cellid: TST_CellID? { get { self[message: 2] } set { self[message: 2] = newValue } }
 }
 
 /// Generated wire model for `TST.FormulaEqualsTokenAttachmentArchive`.
 final class TST_FormulaEqualsTokenAttachmentArchive: IWAMessage {
-    var `super`: TSWP_UIGraphicalAttachment?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSWP_UIGraphicalAttachment?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_UIGraphicalAttachment(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.FormulaEqualsTokenAttachmentArchive", [
+        .optional(1, TSWP_UIGraphicalAttachment.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var `super`: TSWP_UIGraphicalAttachment? { get { self[message: 0] } set { self[message: 0] = newValue } }
 }
 
 /// Generated wire model for `TST.CellFillStandIn`.
 final class TST_CellFillStandIn: IWAMessage {
-    var fill: TSD_FillArchive?
-    var typeIsMixed: Bool?
-    var colorHasBeenModified: Bool?
-    var colorIsMixed: Bool?
-    var firstColorHasBeenModified: Bool?
-    var firstColorIsMixed: Bool?
-    var lastColorHasBeenModified: Bool?
-    var lastColorIsMixed: Bool?
-    var gradientTypeHasBeenModified: Bool?
-    var gradientTypeIsMixed: Bool?
-    var gradientAngleHasBeenModified: Bool?
-    var gradientAngleIsMixed: Bool?
-    var imageDataHasBeenModified: Bool?
-    var imageDataIsMixed: Bool?
-    var tintColorHasBeenModified: Bool?
-    var tintColorIsMixed: Bool?
-    var scaleHasBeenModified: Bool?
-    var scaleIsMixed: Bool?
-    var techniqueHasBeenModified: Bool?
-    var techniqueIsMixed: Bool?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSD_FillArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_FillArchive(ProtobufMessage(_b)) }
-            if let _v { fill = _v }
-        case 2:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { typeIsMixed = _v }
-        case 3:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { colorHasBeenModified = _v }
-        case 4:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { colorIsMixed = _v }
-        case 5:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { firstColorHasBeenModified = _v }
-        case 6:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { firstColorIsMixed = _v }
-        case 7:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { lastColorHasBeenModified = _v }
-        case 8:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { lastColorIsMixed = _v }
-        case 9:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { gradientTypeHasBeenModified = _v }
-        case 10:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { gradientTypeIsMixed = _v }
-        case 11:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { gradientAngleHasBeenModified = _v }
-        case 12:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { gradientAngleIsMixed = _v }
-        case 13:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { imageDataHasBeenModified = _v }
-        case 14:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { imageDataIsMixed = _v }
-        case 15:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { tintColorHasBeenModified = _v }
-        case 16:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { tintColorIsMixed = _v }
-        case 17:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { scaleHasBeenModified = _v }
-        case 18:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { scaleIsMixed = _v }
-        case 19:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { techniqueHasBeenModified = _v }
-        case 20:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { techniqueIsMixed = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = fill { _w.bytesField(1, _x.encoded()) }
-        if let _x = typeIsMixed { _w.varintField(2, _x ? 1 : 0) }
-        if let _x = colorHasBeenModified { _w.varintField(3, _x ? 1 : 0) }
-        if let _x = colorIsMixed { _w.varintField(4, _x ? 1 : 0) }
-        if let _x = firstColorHasBeenModified { _w.varintField(5, _x ? 1 : 0) }
-        if let _x = firstColorIsMixed { _w.varintField(6, _x ? 1 : 0) }
-        if let _x = lastColorHasBeenModified { _w.varintField(7, _x ? 1 : 0) }
-        if let _x = lastColorIsMixed { _w.varintField(8, _x ? 1 : 0) }
-        if let _x = gradientTypeHasBeenModified { _w.varintField(9, _x ? 1 : 0) }
-        if let _x = gradientTypeIsMixed { _w.varintField(10, _x ? 1 : 0) }
-        if let _x = gradientAngleHasBeenModified { _w.varintField(11, _x ? 1 : 0) }
-        if let _x = gradientAngleIsMixed { _w.varintField(12, _x ? 1 : 0) }
-        if let _x = imageDataHasBeenModified { _w.varintField(13, _x ? 1 : 0) }
-        if let _x = imageDataIsMixed { _w.varintField(14, _x ? 1 : 0) }
-        if let _x = tintColorHasBeenModified { _w.varintField(15, _x ? 1 : 0) }
-        if let _x = tintColorIsMixed { _w.varintField(16, _x ? 1 : 0) }
-        if let _x = scaleHasBeenModified { _w.varintField(17, _x ? 1 : 0) }
-        if let _x = scaleIsMixed { _w.varintField(18, _x ? 1 : 0) }
-        if let _x = techniqueHasBeenModified { _w.varintField(19, _x ? 1 : 0) }
-        if let _x = techniqueIsMixed { _w.varintField(20, _x ? 1 : 0) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.CellFillStandIn", [
+        .optional(1, TSD_FillArchive.self), .optional(2, .bool), .optional(3, .bool), .optional(4, .bool),
+        .optional(5, .bool), .optional(6, .bool), .optional(7, .bool), .optional(8, .bool), .optional(9, .bool),
+        .optional(10, .bool), .optional(11, .bool), .optional(12, .bool), .optional(13, .bool), .optional(14, .bool),
+        .optional(15, .bool), .optional(16, .bool), .optional(17, .bool), .optional(18, .bool), .optional(19, .bool),
+        .optional(20, .bool),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 20)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var fill: TSD_FillArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var typeIsMixed: Bool? { get { self[1] } set { self[1] = newValue } }
+    var colorHasBeenModified: Bool? { get { self[2] } set { self[2] = newValue } }
+    var colorIsMixed: Bool? { get { self[3] } set { self[3] = newValue } }
+    var firstColorHasBeenModified: Bool? { get { self[4] } set { self[4] = newValue } }
+    var firstColorIsMixed: Bool? { get { self[5] } set { self[5] = newValue } }
+    var lastColorHasBeenModified: Bool? { get { self[6] } set { self[6] = newValue } }
+    var lastColorIsMixed: Bool? { get { self[7] } set { self[7] = newValue } }
+    var gradientTypeHasBeenModified: Bool? { get { self[8] } set { self[8] = newValue } }
+    var gradientTypeIsMixed: Bool? { get { self[9] } set { self[9] = newValue } }
+    var gradientAngleHasBeenModified: Bool? { get { self[10] } set { self[10] = newValue } }
+    var gradientAngleIsMixed: Bool? { get { self[11] } set { self[11] = newValue } }
+    var imageDataHasBeenModified: Bool? { get { self[12] } set { self[12] = newValue } }
+    var imageDataIsMixed: Bool? { get { self[13] } set { self[13] = newValue } }
+    var tintColorHasBeenModified: Bool? { get { self[14] } set { self[14] = newValue } }
+    var tintColorIsMixed: Bool? { get { self[15] } set { self[15] = newValue } }
+    var scaleHasBeenModified: Bool? { get { self[16] } set { self[16] = newValue } }
+    var scaleIsMixed: Bool? { get { self[17] } set { self[17] = newValue } }
+    var techniqueHasBeenModified: Bool? { get { self[18] } set { self[18] = newValue } }
+    var techniqueIsMixed: Bool? { get { self[19] } set { self[19] = newValue } }
 }
 
 /// Generated wire model for `TST.FormulaSelectionArchive`.
 final class TST_FormulaSelectionArchive: IWAMessage {
-    var `super`: TSWP_SelectionArchive?
-    var activetokencharindex: UInt32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSWP_SelectionArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_SelectionArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { activetokencharindex = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = activetokencharindex { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.FormulaSelectionArchive", [
+        .optional(1, TSWP_SelectionArchive.self), .optional(2, .uint32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var `super`: TSWP_SelectionArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var activetokencharindex: UInt32? { get { self[1] } set { self[1] = newValue } }
 }
 
 /// Generated wire model for `TST.CellBorderArchive`.
 final class TST_CellBorderArchive: IWAMessage {
-    var topStroke: TSD_StrokeArchive?
-    var topStrokeOrder: Int32?
-    var rightStroke: TSD_StrokeArchive?
-    var rightStrokeOrder: Int32?
-    var bottomStroke: TSD_StrokeArchive?
-    var bottomStrokeOrder: Int32?
-    var leftStroke: TSD_StrokeArchive?
-    var leftStrokeOrder: Int32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSD_StrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_StrokeArchive(ProtobufMessage(_b)) }
-            if let _v { topStroke = _v }
-        case 2:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { topStrokeOrder = _v }
-        case 3:
-            var _v: TSD_StrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_StrokeArchive(ProtobufMessage(_b)) }
-            if let _v { rightStroke = _v }
-        case 4:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { rightStrokeOrder = _v }
-        case 5:
-            var _v: TSD_StrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_StrokeArchive(ProtobufMessage(_b)) }
-            if let _v { bottomStroke = _v }
-        case 6:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { bottomStrokeOrder = _v }
-        case 7:
-            var _v: TSD_StrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_StrokeArchive(ProtobufMessage(_b)) }
-            if let _v { leftStroke = _v }
-        case 8:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { leftStrokeOrder = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = topStroke { _w.bytesField(1, _x.encoded()) }
-        if let _x = topStrokeOrder { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = rightStroke { _w.bytesField(3, _x.encoded()) }
-        if let _x = rightStrokeOrder { _w.varintField(4, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = bottomStroke { _w.bytesField(5, _x.encoded()) }
-        if let _x = bottomStrokeOrder { _w.varintField(6, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = leftStroke { _w.bytesField(7, _x.encoded()) }
-        if let _x = leftStrokeOrder { _w.varintField(8, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.CellBorderArchive", [
+        .optional(1, TSD_StrokeArchive.self), .optional(2, .int32), .optional(3, TSD_StrokeArchive.self),
+        .optional(4, .int32), .optional(5, TSD_StrokeArchive.self), .optional(6, .int32),
+        .optional(7, TSD_StrokeArchive.self), .optional(8, .int32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 8)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var topStroke: TSD_StrokeArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var topStrokeOrder: Int32? { get { self[1] } set { self[1] = newValue } }
+    var rightStroke: TSD_StrokeArchive? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var rightStrokeOrder: Int32? { get { self[3] } set { self[3] = newValue } }
+    var bottomStroke: TSD_StrokeArchive? { get { self[message: 4] } set { self[message: 4] = newValue } }
+    var bottomStrokeOrder: Int32? { get { self[5] } set { self[5] = newValue } }
+    var leftStroke: TSD_StrokeArchive? { get { self[message: 6] } set { self[message: 6] = newValue } }
+    var leftStrokeOrder: Int32? { get { self[7] } set { self[7] = newValue } }
 }
 
 /// Generated wire model for `TST.DefaultCellStylesContainerArchive`.
 final class TST_DefaultCellStylesContainerArchive: IWAMessage {
-    var tableStyleNetwork: TSP_Reference?
-    var rowUids: [TSP_UUID] = []
-    var columnUids: [TSP_UUID] = []
-    var rowTypes: [UInt32] = []
-    var columnTypes: [UInt32] = []
-    var isAPivotTable: Bool?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { tableStyleNetwork = _v }
-        case 2:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { rowUids.append(_v) }
-        case 3:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { columnUids.append(_v) }
-        case 4:
-            if case .varint(let _u) = _f.value { rowTypes.append(UInt32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { rowTypes.append(UInt32(truncatingIfNeeded: _u)) } }
-        case 5:
-            if case .varint(let _u) = _f.value { columnTypes.append(UInt32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { columnTypes.append(UInt32(truncatingIfNeeded: _u)) } }
-        case 6:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { isAPivotTable = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = tableStyleNetwork { _w.bytesField(1, _x.encoded()) }
-        for _x in rowUids { _w.bytesField(2, _x.encoded()) }
-        for _x in columnUids { _w.bytesField(3, _x.encoded()) }
-        for _x in rowTypes { _w.varintField(4, UInt64(truncatingIfNeeded: _x)) }
-        for _x in columnTypes { _w.varintField(5, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = isAPivotTable { _w.varintField(6, _x ? 1 : 0) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.DefaultCellStylesContainerArchive", [
+        .optional(1, TSP_Reference.self), .repeated(2, TSP_UUID.self), .repeated(3, TSP_UUID.self),
+        .repeated(4, .uint32), .repeated(5, .uint32), .optional(6, .bool),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 6)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var tableStyleNetwork: TSP_Reference? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var rowUids: [TSP_UUID] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(rowUids value: TSP_UUID) { append(value, toMessages: 1) }
+    var columnUids: [TSP_UUID] { get { self[messages: 2] } set { self[messages: 2] = newValue } }
+    func append(columnUids value: TSP_UUID) { append(value, toMessages: 2) }
+    var rowTypes: [UInt32] { get { self[all: 3] } set { self[all: 3] = newValue } }
+    func append(rowTypes value: UInt32) { append(value, toAll: 3) }
+    var columnTypes: [UInt32] { get { self[all: 4] } set { self[all: 4] = newValue } }
+    func append(columnTypes value: UInt32) { append(value, toAll: 4) }
+    var isAPivotTable: Bool? { get { self[5] } set { self[5] = newValue } }
 }
 
 /// Generated wire model for `TST.MultiTableRemapperArchive`.
 final class TST_MultiTableRemapperArchive: IWAMessage {
-    var mappingPurpose: Int32?
-    var shouldStealReferences: Bool?
-    var canReuseTableNames: Bool?
-    var ownerUidMapper: [TSCE_OwnerUIDMapperArchive] = []
-    var backingTablesForCharts: TSP_UUIDMapArchive?
-    var crossDocumentPaste: Bool?
-    var nestedInnerMapper: Bool?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { mappingPurpose = _v }
-        case 2:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { shouldStealReferences = _v }
-        case 3:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { canReuseTableNames = _v }
-        case 4:
-            var _v: TSCE_OwnerUIDMapperArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_OwnerUIDMapperArchive(ProtobufMessage(_b)) }
-            if let _v { ownerUidMapper.append(_v) }
-        case 5:
-            var _v: TSP_UUIDMapArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUIDMapArchive(ProtobufMessage(_b)) }
-            if let _v { backingTablesForCharts = _v }
-        case 6:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { crossDocumentPaste = _v }
-        case 7:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { nestedInnerMapper = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = mappingPurpose { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = shouldStealReferences { _w.varintField(2, _x ? 1 : 0) }
-        if let _x = canReuseTableNames { _w.varintField(3, _x ? 1 : 0) }
-        for _x in ownerUidMapper { _w.bytesField(4, _x.encoded()) }
-        if let _x = backingTablesForCharts { _w.bytesField(5, _x.encoded()) }
-        if let _x = crossDocumentPaste { _w.varintField(6, _x ? 1 : 0) }
-        if let _x = nestedInnerMapper { _w.varintField(7, _x ? 1 : 0) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.MultiTableRemapperArchive", [
+        .optional(1, .int32), .optional(2, .bool), .optional(3, .bool), .repeated(4, TSCE_OwnerUIDMapperArchive.self),
+        .optional(5, TSP_UUIDMapArchive.self), .optional(6, .bool), .optional(7, .bool),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 7)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var mappingPurpose: Int32? { get { self[0] } set { self[0] = newValue } }
+    var shouldStealReferences: Bool? { get { self[1] } set { self[1] = newValue } }
+    var canReuseTableNames: Bool? { get { self[2] } set { self[2] = newValue } }
+    var ownerUidMapper: [TSCE_OwnerUIDMapperArchive] { get { self[messages: 3] } set { self[messages: 3] = newValue } }
+    func append(ownerUidMapper value: TSCE_OwnerUIDMapperArchive) { append(value, toMessages: 3) }
+    var backingTablesForCharts: TSP_UUIDMapArchive? { get { self[message: 4] } set { self[message: 4] = newValue } }
+    var crossDocumentPaste: Bool? { get { self[5] } set { self[5] = newValue } }
+    var nestedInnerMapper: Bool? { get { self[6] } set { self[6] = newValue } }
 }
 
 /// Generated wire model for `TST.ChangePropagationMapWrapper`.
 final class TST_ChangePropagationMapWrapper: IWAMessage {
-    var replacementBehavior: Int32?
-    var styleReplacePrototypes: [TSP_Reference] = []
-    var styleReplaceReplacements: [TSP_Reference] = []
-    var styleModifyStyles: [TSP_Reference] = []
-    var styleModifyOldPropMaps: [TSP_Reference] = []
-    var styleModifyNewPropMaps: [TSP_Reference] = []
-    var styleDeletePrototypes: [TSP_Reference] = []
-    var styleDeleteReplacements: [TSP_Reference] = []
-    var tablePresetReplacePrototype: TSP_Reference?
-    var tablePresetReplaceReplacement: TSP_Reference?
-    var tablePresetDeletePrototype: TSP_Reference?
-    var tablePresetDeleteReplacement: TSP_Reference?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { replacementBehavior = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { styleReplacePrototypes.append(_v) }
-        case 3:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { styleReplaceReplacements.append(_v) }
-        case 4:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { styleModifyStyles.append(_v) }
-        case 5:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { styleModifyOldPropMaps.append(_v) }
-        case 6:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { styleModifyNewPropMaps.append(_v) }
-        case 7:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { styleDeletePrototypes.append(_v) }
-        case 8:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { styleDeleteReplacements.append(_v) }
-        case 9:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { tablePresetReplacePrototype = _v }
-        case 10:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { tablePresetReplaceReplacement = _v }
-        case 11:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { tablePresetDeletePrototype = _v }
-        case 12:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { tablePresetDeleteReplacement = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = replacementBehavior { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        for _x in styleReplacePrototypes { _w.bytesField(2, _x.encoded()) }
-        for _x in styleReplaceReplacements { _w.bytesField(3, _x.encoded()) }
-        for _x in styleModifyStyles { _w.bytesField(4, _x.encoded()) }
-        for _x in styleModifyOldPropMaps { _w.bytesField(5, _x.encoded()) }
-        for _x in styleModifyNewPropMaps { _w.bytesField(6, _x.encoded()) }
-        for _x in styleDeletePrototypes { _w.bytesField(7, _x.encoded()) }
-        for _x in styleDeleteReplacements { _w.bytesField(8, _x.encoded()) }
-        if let _x = tablePresetReplacePrototype { _w.bytesField(9, _x.encoded()) }
-        if let _x = tablePresetReplaceReplacement { _w.bytesField(10, _x.encoded()) }
-        if let _x = tablePresetDeletePrototype { _w.bytesField(11, _x.encoded()) }
-        if let _x = tablePresetDeleteReplacement { _w.bytesField(12, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.ChangePropagationMapWrapper", [
+        .optional(1, .int32), .repeated(2, TSP_Reference.self), .repeated(3, TSP_Reference.self),
+        .repeated(4, TSP_Reference.self), .repeated(5, TSP_Reference.self), .repeated(6, TSP_Reference.self),
+        .repeated(7, TSP_Reference.self), .repeated(8, TSP_Reference.self), .optional(9, TSP_Reference.self),
+        .optional(10, TSP_Reference.self), .optional(11, TSP_Reference.self), .optional(12, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 12)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var replacementBehavior: Int32? { get { self[0] } set { self[0] = newValue } }
+    var styleReplacePrototypes: [TSP_Reference] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(styleReplacePrototypes value: TSP_Reference) { append(value, toMessages: 1) }
+    var styleReplaceReplacements: [TSP_Reference] { get { self[messages: 2] } set { self[messages: 2] = newValue } }
+    func append(styleReplaceReplacements value: TSP_Reference) { append(value, toMessages: 2) }
+    var styleModifyStyles: [TSP_Reference] { get { self[messages: 3] } set { self[messages: 3] = newValue } }
+    func append(styleModifyStyles value: TSP_Reference) { append(value, toMessages: 3) }
+    var styleModifyOldPropMaps: [TSP_Reference] { get { self[messages: 4] } set { self[messages: 4] = newValue } }
+    func append(styleModifyOldPropMaps value: TSP_Reference) { append(value, toMessages: 4) }
+    var styleModifyNewPropMaps: [TSP_Reference] { get { self[messages: 5] } set { self[messages: 5] = newValue } }
+    func append(styleModifyNewPropMaps value: TSP_Reference) { append(value, toMessages: 5) }
+    var styleDeletePrototypes: [TSP_Reference] { get { self[messages: 6] } set { self[messages: 6] = newValue } }
+    func append(styleDeletePrototypes value: TSP_Reference) { append(value, toMessages: 6) }
+    var styleDeleteReplacements: [TSP_Reference] { get { self[messages: 7] } set { self[messages: 7] = newValue } }
+    func append(styleDeleteReplacements value: TSP_Reference) { append(value, toMessages: 7) }
+    var tablePresetReplacePrototype: TSP_Reference? { get { self[message: 8] } set { self[message: 8] = newValue } }
+    var tablePresetReplaceReplacement: TSP_Reference? { get { self[message: 9] } set { self[message: 9] = newValue } }
+    var tablePresetDeletePrototype: TSP_Reference? { get { self[message: 10] } set { self[message: 10] = newValue } }
+    var tablePresetDeleteReplacement: TSP_Reference? { get { self[message: 11] } set { self[message: 11] = newValue } }
 }
 
 /// Generated wire model for `TST.SummaryCellVendorArchive`.
 final class TST_SummaryCellVendorArchive: IWAMessage {
-    var tableInfo: TSP_Reference?
-    var entries: [TST_SummaryCellVendorArchive_SummaryCellEntry] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { tableInfo = _v }
-        case 2:
-            var _v: TST_SummaryCellVendorArchive_SummaryCellEntry?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_SummaryCellVendorArchive_SummaryCellEntry(ProtobufMessage(_b)) }
-            if let _v { entries.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = tableInfo { _w.bytesField(1, _x.encoded()) }
-        for _x in entries { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.SummaryCellVendorArchive", [
+        .optional(1, TSP_Reference.self), .repeated(2, TST_SummaryCellVendorArchive_SummaryCellEntry.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var tableInfo: TSP_Reference? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var entries: [TST_SummaryCellVendorArchive_SummaryCellEntry] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(entries value: TST_SummaryCellVendorArchive_SummaryCellEntry) { append(value, toMessages: 1) }
 }
 
 /// Generated wire model for `TST.SummaryCellVendorArchive.SummaryCellEntry`.
 final class TST_SummaryCellVendorArchive_SummaryCellEntry: IWAMessage {
-    var wildcarduid: TSP_UUID?
-    var columnuid: TSP_UUID?
-    var cell: TST_Cell?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { wildcarduid = _v }
-        case 2:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { columnuid = _v }
-        case 3:
-            var _v: TST_Cell?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_Cell(ProtobufMessage(_b)) }
-            if let _v { cell = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = wildcarduid { _w.bytesField(1, _x.encoded()) }
-        if let _x = columnuid { _w.bytesField(2, _x.encoded()) }
-        if let _x = cell { _w.bytesField(3, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.SummaryCellVendorArchive.SummaryCellEntry", [
+        .optional(1, TSP_UUID.self), .optional(2, TSP_UUID.self), .optional(3, TST_Cell.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var wildcarduid: TSP_UUID? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var columnuid: TSP_UUID? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var cell: TST_Cell? { get { self[message: 2] } set { self[message: 2] = newValue } }
 }
 
 /// Generated wire model for `TST.CategoryOrderArchive`.
 final class TST_CategoryOrderArchive: IWAMessage {
-    var tableInfo: TSP_Reference?
-    var uidMap: TSP_Reference?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { tableInfo = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { uidMap = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = tableInfo { _w.bytesField(1, _x.encoded()) }
-        if let _x = uidMap { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.CategoryOrderArchive", [
+        .optional(1, TSP_Reference.self), .optional(2, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var tableInfo: TSP_Reference? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var uidMap: TSP_Reference? { get { self[message: 1] } set { self[message: 1] = newValue } }
 }
 
 /// Generated wire model for `TST.PivotOrderArchive`.
 final class TST_PivotOrderArchive: IWAMessage {
-    var uidMap: TSP_Reference?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { uidMap = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = uidMap { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.PivotOrderArchive", [
+        .optional(1, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var uidMap: TSP_Reference? { get { self[message: 0] } set { self[message: 0] = newValue } }
 }
 
 /// Generated wire model for `TST.HeaderNameMgrTileArchive`.
 final class TST_HeaderNameMgrTileArchive: IWAMessage {
-    var firstFragment: String?
-    var lastFragment: String?
-    var nameFragEntries: [TST_HeaderNameMgrTileArchive_NameFragmentArchive] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { firstFragment = _v }
-        case 2:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { lastFragment = _v }
-        case 3:
-            var _v: TST_HeaderNameMgrTileArchive_NameFragmentArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_HeaderNameMgrTileArchive_NameFragmentArchive(ProtobufMessage(_b)) }
-            if let _v { nameFragEntries.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = firstFragment { _w.stringField(1, _x) }
-        if let _x = lastFragment { _w.stringField(2, _x) }
-        for _x in nameFragEntries { _w.bytesField(3, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.HeaderNameMgrTileArchive", [
+        .optional(1, .string), .optional(2, .string),
+        .repeated(3, TST_HeaderNameMgrTileArchive_NameFragmentArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var firstFragment: String? { get { self[0] } set { self[0] = newValue } }
+    var lastFragment: String? { get { self[1] } set { self[1] = newValue } }
+    var nameFragEntries: [TST_HeaderNameMgrTileArchive_NameFragmentArchive] { get { self[messages: 2] } set { self[messages: 2] = newValue } }
+    func append(nameFragEntries value: TST_HeaderNameMgrTileArchive_NameFragmentArchive) { append(value, toMessages: 2) }
 }
 
 /// Generated wire model for `TST.HeaderNameMgrTileArchive.NameFragmentArchive`.
 final class TST_HeaderNameMgrTileArchive_NameFragmentArchive: IWAMessage {
-    var nameFragment: String?
-    var namePrecedent: TSCE_CellCoordinateArchive?
-    var usesOfNameFragment: TSCE_UidCellRefSetArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { nameFragment = _v }
-        case 2:
-            var _v: TSCE_CellCoordinateArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CellCoordinateArchive(ProtobufMessage(_b)) }
-            if let _v { namePrecedent = _v }
-        case 3:
-            var _v: TSCE_UidCellRefSetArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_UidCellRefSetArchive(ProtobufMessage(_b)) }
-            if let _v { usesOfNameFragment = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = nameFragment { _w.stringField(1, _x) }
-        if let _x = namePrecedent { _w.bytesField(2, _x.encoded()) }
-        if let _x = usesOfNameFragment { _w.bytesField(3, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.HeaderNameMgrTileArchive.NameFragmentArchive", [
+        .optional(1, .string), .optional(2, TSCE_CellCoordinateArchive.self),
+        .optional(3, TSCE_UidCellRefSetArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var nameFragment: String? { get { self[0] } set { self[0] = newValue } }
+    var namePrecedent: TSCE_CellCoordinateArchive? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var usesOfNameFragment: TSCE_UidCellRefSetArchive? { get { self[message: 2] } set { self[message: 2] = newValue } }
 }
 
 /// Generated wire model for `TST.HeaderNameMgrArchive`.
 final class TST_HeaderNameMgrArchive: IWAMessage {
-    var ownerUid: TSP_UUID?
-    var nrmOwnerUid: TSP_UUID?
-    var perTables: [TST_HeaderNameMgrArchive_PerTableArchive] = []
-    var nameFragTiles: [TSP_Reference] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { ownerUid = _v }
-        case 2:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { nrmOwnerUid = _v }
-        case 3:
-            var _v: TST_HeaderNameMgrArchive_PerTableArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_HeaderNameMgrArchive_PerTableArchive(ProtobufMessage(_b)) }
-            if let _v { perTables.append(_v) }
-        case 4:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { nameFragTiles.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = ownerUid { _w.bytesField(1, _x.encoded()) }
-        if let _x = nrmOwnerUid { _w.bytesField(2, _x.encoded()) }
-        for _x in perTables { _w.bytesField(3, _x.encoded()) }
-        for _x in nameFragTiles { _w.bytesField(4, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.HeaderNameMgrArchive", [
+        .optional(1, TSP_UUID.self), .optional(2, TSP_UUID.self),
+        .repeated(3, TST_HeaderNameMgrArchive_PerTableArchive.self), .repeated(4, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var ownerUid: TSP_UUID? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var nrmOwnerUid: TSP_UUID? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var perTables: [TST_HeaderNameMgrArchive_PerTableArchive] { get { self[messages: 2] } set { self[messages: 2] = newValue } }
+    func append(perTables value: TST_HeaderNameMgrArchive_PerTableArchive) { append(value, toMessages: 2) }
+    var nameFragTiles: [TSP_Reference] { get { self[messages: 3] } set { self[messages: 3] = newValue } }
+    func append(nameFragTiles value: TSP_Reference) { append(value, toMessages: 3) }
 }
 
 /// Generated wire model for `TST.HeaderNameMgrArchive.PerTableArchive`.
 final class TST_HeaderNameMgrArchive_PerTableArchive: IWAMessage {
-    var tableUid: TSP_UUID?
-    var perTablePrecedent: TSCE_CellCoordinateArchive?
-    var isDeleted: Bool?
-    var headerRowUids: [TSP_UUID] = []
-    var headerColumnUids: [TSP_UUID] = []
-    var updateHeaderRowUids: [TSP_UUID] = []
-    var updateHeaderColumnUids: [TSP_UUID] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { tableUid = _v }
-        case 2:
-            var _v: TSCE_CellCoordinateArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSCE_CellCoordinateArchive(ProtobufMessage(_b)) }
-            if let _v { perTablePrecedent = _v }
-        case 3:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { isDeleted = _v }
-        case 5:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { headerRowUids.append(_v) }
-        case 6:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { headerColumnUids.append(_v) }
-        case 7:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { updateHeaderRowUids.append(_v) }
-        case 8:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { updateHeaderColumnUids.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = tableUid { _w.bytesField(1, _x.encoded()) }
-        if let _x = perTablePrecedent { _w.bytesField(2, _x.encoded()) }
-        if let _x = isDeleted { _w.varintField(3, _x ? 1 : 0) }
-        for _x in headerRowUids { _w.bytesField(5, _x.encoded()) }
-        for _x in headerColumnUids { _w.bytesField(6, _x.encoded()) }
-        for _x in updateHeaderRowUids { _w.bytesField(7, _x.encoded()) }
-        for _x in updateHeaderColumnUids { _w.bytesField(8, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.HeaderNameMgrArchive.PerTableArchive", [
+        .optional(1, TSP_UUID.self), .optional(2, TSCE_CellCoordinateArchive.self), .optional(3, .bool),
+        .repeated(5, TSP_UUID.self), .repeated(6, TSP_UUID.self), .repeated(7, TSP_UUID.self),
+        .repeated(8, TSP_UUID.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 7)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var tableUid: TSP_UUID? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var perTablePrecedent: TSCE_CellCoordinateArchive? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var isDeleted: Bool? { get { self[2] } set { self[2] = newValue } }
+    var headerRowUids: [TSP_UUID] { get { self[messages: 3] } set { self[messages: 3] = newValue } }
+    func append(headerRowUids value: TSP_UUID) { append(value, toMessages: 3) }
+    var headerColumnUids: [TSP_UUID] { get { self[messages: 4] } set { self[messages: 4] = newValue } }
+    func append(headerColumnUids value: TSP_UUID) { append(value, toMessages: 4) }
+    var updateHeaderRowUids: [TSP_UUID] { get { self[messages: 5] } set { self[messages: 5] = newValue } }
+    func append(updateHeaderRowUids value: TSP_UUID) { append(value, toMessages: 5) }
+    var updateHeaderColumnUids: [TSP_UUID] { get { self[messages: 6] } set { self[messages: 6] = newValue } }
+    func append(updateHeaderColumnUids value: TSP_UUID) { append(value, toMessages: 6) }
 }
 
 /// Generated wire model for `TST.WidthHeightCacheFittingEntry`.
 final class TST_WidthHeightCacheFittingEntry: IWAMessage {
-    var fittingIndex: UInt32?
-    var fittingSize: Float?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { fittingIndex = _v }
-        case 2:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { fittingSize = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = fittingIndex { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = fittingSize { _w.fixed32Field(2, _x.bitPattern) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.WidthHeightCacheFittingEntry", [
+        .optional(1, .uint32), .optional(2, .float),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var fittingIndex: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var fittingSize: Float? { get { self[1] } set { self[1] = newValue } }
 }
 
 /// Generated wire model for `TST.WidthHeightCache`.
 final class TST_WidthHeightCache: IWAMessage {
-    var rowsFittingEntries: [TST_WidthHeightCacheFittingEntry] = []
-    var columnsCount: UInt32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TST_WidthHeightCacheFittingEntry?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_WidthHeightCacheFittingEntry(ProtobufMessage(_b)) }
-            if let _v { rowsFittingEntries.append(_v) }
-        case 3:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { columnsCount = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in rowsFittingEntries { _w.bytesField(1, _x.encoded()) }
-        if let _x = columnsCount { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.WidthHeightCache", [
+        .repeated(1, TST_WidthHeightCacheFittingEntry.self), .optional(3, .uint32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var rowsFittingEntries: [TST_WidthHeightCacheFittingEntry] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(rowsFittingEntries value: TST_WidthHeightCacheFittingEntry) { append(value, toMessages: 0) }
+    var columnsCount: UInt32? { get { self[1] } set { self[1] = newValue } }
 }
 
 /// Generated wire model for `TST.LayoutEngineArchive`.
 final class TST_LayoutEngineArchive: IWAMessage {
-    var widthHeightCache: TST_WidthHeightCache?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TST_WidthHeightCache?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_WidthHeightCache(ProtobufMessage(_b)) }
-            if let _v { widthHeightCache = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = widthHeightCache { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.LayoutEngineArchive", [
+        .optional(1, TST_WidthHeightCache.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var widthHeightCache: TST_WidthHeightCache? { get { self[message: 0] } set { self[message: 0] = newValue } }
 }
 
 /// Generated wire model for `TST.CollaboratorTableCursorSubselectionArchive`.
 final class TST_CollaboratorTableCursorSubselectionArchive: IWAMessage {
-    var cellUidList: TST_CellUIDListArchive?
-    var selectionType: Int32?
-    var rowColumnUidList: [TSP_UUID] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TST_CellUIDListArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_CellUIDListArchive(ProtobufMessage(_b)) }
-            if let _v { cellUidList = _v }
-        case 3:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { selectionType = _v }
-        case 4:
-            var _v: TSP_UUID?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_UUID(ProtobufMessage(_b)) }
-            if let _v { rowColumnUidList.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = cellUidList { _w.bytesField(1, _x.encoded()) }
-        if let _x = selectionType { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        for _x in rowColumnUidList { _w.bytesField(4, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TST.CollaboratorTableCursorSubselectionArchive", [
+        .optional(1, TST_CellUIDListArchive.self), .optional(3, .int32), .repeated(4, TSP_UUID.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var cellUidList: TST_CellUIDListArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var selectionType: Int32? { get { self[1] } set { self[1] = newValue } }
+    var rowColumnUidList: [TSP_UUID] { get { self[messages: 2] } set { self[messages: 2] = newValue } }
+    func append(rowColumnUidList value: TSP_UUID) { append(value, toMessages: 2) }
 }
 
 /// Registers this file's archives into the reflective catalog.
-func registerIWA_TSTArchives(_ into: inout [(name: String, decode: (ProtobufMessage) -> IWAMessage)]) {
-    into.append(("TST.CellID", { TST_CellID($0) as IWAMessage }))
-    into.append(("TST.CellUIDLookupListArchive", { TST_CellUIDLookupListArchive($0) as IWAMessage }))
-    into.append(("TST.CellUIDListArchive", { TST_CellUIDListArchive($0) as IWAMessage }))
-    into.append(("TST.TableSize", { TST_TableSize($0) as IWAMessage }))
-    into.append(("TST.ExpandedTableSize", { TST_ExpandedTableSize($0) as IWAMessage }))
-    into.append(("TST.CellRange", { TST_CellRange($0) as IWAMessage }))
-    into.append(("TST.ExpandedCellRange", { TST_ExpandedCellRange($0) as IWAMessage }))
-    into.append(("TST.TableSelection", { TST_TableSelection($0) as IWAMessage }))
-    into.append(("TST.TileRowInfo", { TST_TileRowInfo($0) as IWAMessage }))
-    into.append(("TST.Tile", { TST_Tile($0) as IWAMessage }))
-    into.append(("TST.TileStorage", { TST_TileStorage($0) as IWAMessage }))
-    into.append(("TST.TileStorage.Tile", { TST_TileStorage_Tile($0) as IWAMessage }))
-    into.append(("TST.PopUpMenuModel", { TST_PopUpMenuModel($0) as IWAMessage }))
-    into.append(("TST.PopUpMenuModel.CellValue", { TST_PopUpMenuModel_CellValue($0) as IWAMessage }))
-    into.append(("TST.ImportWarningSetArchive", { TST_ImportWarningSetArchive($0) as IWAMessage }))
-    into.append(("TST.ImportWarningSetArchive.FormulaImportWarning", { TST_ImportWarningSetArchive_FormulaImportWarning($0) as IWAMessage }))
-    into.append(("TST.CellRefImportWarningSetPairArchive", { TST_CellRefImportWarningSetPairArchive($0) as IWAMessage }))
-    into.append(("TST.ImportWarningSetByCellRefArchive", { TST_ImportWarningSetByCellRefArchive($0) as IWAMessage }))
-    into.append(("TST.TableDataList", { TST_TableDataList($0) as IWAMessage }))
-    into.append(("TST.TableDataList.ListEntry", { TST_TableDataList_ListEntry($0) as IWAMessage }))
-    into.append(("TST.TableDataListSegment", { TST_TableDataListSegment($0) as IWAMessage }))
-    into.append(("TST.TableRBTree", { TST_TableRBTree($0) as IWAMessage }))
-    into.append(("TST.TableRBTree.Node", { TST_TableRBTree_Node($0) as IWAMessage }))
-    into.append(("TST.HeaderStorageBucket", { TST_HeaderStorageBucket($0) as IWAMessage }))
-    into.append(("TST.HeaderStorageBucket.Header", { TST_HeaderStorageBucket_Header($0) as IWAMessage }))
-    into.append(("TST.HeaderStorage", { TST_HeaderStorage($0) as IWAMessage }))
-    into.append(("TST.DataStore", { TST_DataStore($0) as IWAMessage }))
-    into.append(("TST.TableInfoArchive", { TST_TableInfoArchive($0) as IWAMessage }))
-    into.append(("TST.CategoryInfoArchive", { TST_CategoryInfoArchive($0) as IWAMessage }))
-    into.append(("TST.WPTableInfoArchive", { TST_WPTableInfoArchive($0) as IWAMessage }))
-    into.append(("TST.TableStyleNetworkArchive", { TST_TableStyleNetworkArchive($0) as IWAMessage }))
-    into.append(("TST.TableGroupSortOrderUIDArchive", { TST_TableGroupSortOrderUIDArchive($0) as IWAMessage }))
-    into.append(("TST.TableGroupSortOrderUIDArchive.GroupSortRuleUIDArchive", { TST_TableGroupSortOrderUIDArchive_GroupSortRuleUIDArchive($0) as IWAMessage }))
-    into.append(("TST.TableSortOrderArchive", { TST_TableSortOrderArchive($0) as IWAMessage }))
-    into.append(("TST.TableSortOrderArchive.SortRuleArchive", { TST_TableSortOrderArchive_SortRuleArchive($0) as IWAMessage }))
-    into.append(("TST.TableSortOrderUIDArchive", { TST_TableSortOrderUIDArchive($0) as IWAMessage }))
-    into.append(("TST.TableSortOrderUIDArchive.SortRuleArchive", { TST_TableSortOrderUIDArchive_SortRuleArchive($0) as IWAMessage }))
-    into.append(("TST.SortRuleReferenceTrackerArchive", { TST_SortRuleReferenceTrackerArchive($0) as IWAMessage }))
-    into.append(("TST.CellRegion", { TST_CellRegion($0) as IWAMessage }))
-    into.append(("TST.CellUIDRegionArchive", { TST_CellUIDRegionArchive($0) as IWAMessage }))
-    into.append(("TST.StructuredTextImportRecord", { TST_StructuredTextImportRecord($0) as IWAMessage }))
-    into.append(("TST.TableModelArchive", { TST_TableModelArchive($0) as IWAMessage }))
-    into.append(("TST.SummaryModelArchive", { TST_SummaryModelArchive($0) as IWAMessage }))
-    into.append(("TST.SummaryModelGroupByChangeStateArchive", { TST_SummaryModelGroupByChangeStateArchive($0) as IWAMessage }))
-    into.append(("TST.ColumnRowUIDMapArchive", { TST_ColumnRowUIDMapArchive($0) as IWAMessage }))
-    into.append(("TST.StrokeLayerArchive", { TST_StrokeLayerArchive($0) as IWAMessage }))
-    into.append(("TST.StrokeLayerArchive.StrokeRunArchive", { TST_StrokeLayerArchive_StrokeRunArchive($0) as IWAMessage }))
-    into.append(("TST.StrokeSidecarArchive", { TST_StrokeSidecarArchive($0) as IWAMessage }))
-    into.append(("TST.DurationWrapperArchive", { TST_DurationWrapperArchive($0) as IWAMessage }))
-    into.append(("TST.Cell", { TST_Cell($0) as IWAMessage }))
-    into.append(("TST.MergeRegionMapArchive", { TST_MergeRegionMapArchive($0) as IWAMessage }))
-    into.append(("TST.CellMapArchive", { TST_CellMapArchive($0) as IWAMessage }))
-    into.append(("TST.CellListArchive", { TST_CellListArchive($0) as IWAMessage }))
-    into.append(("TST.CellListArchive.OptionalCell", { TST_CellListArchive_OptionalCell($0) as IWAMessage }))
-    into.append(("TST.ConcurrentCellMapArchive", { TST_ConcurrentCellMapArchive($0) as IWAMessage }))
-    into.append(("TST.ConcurrentCellListArchive", { TST_ConcurrentCellListArchive($0) as IWAMessage }))
-    into.append(("TST.ConcurrentCellListArchive.OptionalCell", { TST_ConcurrentCellListArchive_OptionalCell($0) as IWAMessage }))
-    into.append(("TST.CellFormatAndValueArchive", { TST_CellFormatAndValueArchive($0) as IWAMessage }))
-    into.append(("TST.CellSpecArchive", { TST_CellSpecArchive($0) as IWAMessage }))
-    into.append(("TST.CommentStorageWrapperArchive", { TST_CommentStorageWrapperArchive($0) as IWAMessage }))
-    into.append(("TST.CellDiffArchive", { TST_CellDiffArchive($0) as IWAMessage }))
-    into.append(("TST.CellDiffArray", { TST_CellDiffArray($0) as IWAMessage }))
-    into.append(("TST.CellDiffArraySegment", { TST_CellDiffArraySegment($0) as IWAMessage }))
-    into.append(("TST.CellDiffMapArchive", { TST_CellDiffMapArchive($0) as IWAMessage }))
-    into.append(("TST.HierarchicalCellDiffMapArchive", { TST_HierarchicalCellDiffMapArchive($0) as IWAMessage }))
-    into.append(("TST.HierarchicalCellDiffMapArchive.BoxedRow", { TST_HierarchicalCellDiffMapArchive_BoxedRow($0) as IWAMessage }))
-    into.append(("TST.DoubleStyleMapArchive", { TST_DoubleStyleMapArchive($0) as IWAMessage }))
-    into.append(("TST.DoubleStyleMapArchive.DoubleStyleMapEntryArchive", { TST_DoubleStyleMapArchive_DoubleStyleMapEntryArchive($0) as IWAMessage }))
-    into.append(("TST.StyleTableMapArchive", { TST_StyleTableMapArchive($0) as IWAMessage }))
-    into.append(("TST.StyleTableMapArchive.StyleTableMapEntryArchive", { TST_StyleTableMapArchive_StyleTableMapEntryArchive($0) as IWAMessage }))
-    into.append(("TST.SelectionArchive", { TST_SelectionArchive($0) as IWAMessage }))
-    into.append(("TST.DeathhawkRdar39989167CellSelectionArchive", { TST_DeathhawkRdar39989167CellSelectionArchive($0) as IWAMessage }))
-    into.append(("TST.StrokeSelectionArchive", { TST_StrokeSelectionArchive($0) as IWAMessage }))
-    into.append(("TST.ControlCellSelectionArchive", { TST_ControlCellSelectionArchive($0) as IWAMessage }))
-    into.append(("TST.StockCellSelectionArchive", { TST_StockCellSelectionArchive($0) as IWAMessage }))
-    into.append(("TST.TableNameSelectionArchive", { TST_TableNameSelectionArchive($0) as IWAMessage }))
-    into.append(("TST.AutofillSelectionArchive", { TST_AutofillSelectionArchive($0) as IWAMessage }))
-    into.append(("TST.FilterRulePrePivotArchive", { TST_FilterRulePrePivotArchive($0) as IWAMessage }))
-    into.append(("TST.FilterRuleArchive", { TST_FilterRuleArchive($0) as IWAMessage }))
-    into.append(("TST.TableStyleArchive", { TST_TableStyleArchive($0) as IWAMessage }))
-    into.append(("TST.CellStyleArchive", { TST_CellStyleArchive($0) as IWAMessage }))
-    into.append(("TST.FormulaPredArgDataArchive", { TST_FormulaPredArgDataArchive($0) as IWAMessage }))
-    into.append(("TST.FormulaPredArgArchive", { TST_FormulaPredArgArchive($0) as IWAMessage }))
-    into.append(("TST.FormulaPredicatePrePivotArchive", { TST_FormulaPredicatePrePivotArchive($0) as IWAMessage }))
-    into.append(("TST.FormulaPredicateArchive", { TST_FormulaPredicateArchive($0) as IWAMessage }))
-    into.append(("TST.ConditionalStyleSetArchive", { TST_ConditionalStyleSetArchive($0) as IWAMessage }))
-    into.append(("TST.ConditionalStyleSetArchive.ConditionalStyleRulePrePivot", { TST_ConditionalStyleSetArchive_ConditionalStyleRulePrePivot($0) as IWAMessage }))
-    into.append(("TST.ConditionalStyleSetArchive.ConditionalStyleRule", { TST_ConditionalStyleSetArchive_ConditionalStyleRule($0) as IWAMessage }))
-    into.append(("TST.ConditionalStyleSetArchive.ConditionalStyleRules", { TST_ConditionalStyleSetArchive_ConditionalStyleRules($0) as IWAMessage }))
-    into.append(("TST.FilterSetArchive", { TST_FilterSetArchive($0) as IWAMessage }))
-    into.append(("TST.UniqueIndexArchive", { TST_UniqueIndexArchive($0) as IWAMessage }))
-    into.append(("TST.UniqueIndexArchive.UniqueIndexEntryArchive", { TST_UniqueIndexArchive_UniqueIndexEntryArchive($0) as IWAMessage }))
-    into.append(("TST.HiddenStateExtentArchive", { TST_HiddenStateExtentArchive($0) as IWAMessage }))
-    into.append(("TST.HiddenStateExtentArchive.RowOrColumnState", { TST_HiddenStateExtentArchive_RowOrColumnState($0) as IWAMessage }))
-    into.append(("TST.HiddenStatesArchive", { TST_HiddenStatesArchive($0) as IWAMessage }))
-    into.append(("TST.HiddenStatesOwnerArchive", { TST_HiddenStatesOwnerArchive($0) as IWAMessage }))
-    into.append(("TST.ExpandCollapseStateArchive", { TST_ExpandCollapseStateArchive($0) as IWAMessage }))
-    into.append(("TST.TokenAttachmentArchive", { TST_TokenAttachmentArchive($0) as IWAMessage }))
-    into.append(("TST.ExpressionNodeArchive", { TST_ExpressionNodeArchive($0) as IWAMessage }))
-    into.append(("TST.BooleanNodeArchive", { TST_BooleanNodeArchive($0) as IWAMessage }))
-    into.append(("TST.NumberNodeArchive", { TST_NumberNodeArchive($0) as IWAMessage }))
-    into.append(("TST.StringNodeArchive", { TST_StringNodeArchive($0) as IWAMessage }))
-    into.append(("TST.IdentifierNodeArchive", { TST_IdentifierNodeArchive($0) as IWAMessage }))
-    into.append(("TST.ArrayNodeArchive", { TST_ArrayNodeArchive($0) as IWAMessage }))
-    into.append(("TST.ListNodeArchive", { TST_ListNodeArchive($0) as IWAMessage }))
-    into.append(("TST.OperatorNodeArchive", { TST_OperatorNodeArchive($0) as IWAMessage }))
-    into.append(("TST.PostfixOperatorNodeArchive", { TST_PostfixOperatorNodeArchive($0) as IWAMessage }))
-    into.append(("TST.PrefixOperatorNodeArchive", { TST_PrefixOperatorNodeArchive($0) as IWAMessage }))
-    into.append(("TST.FunctionNodeArchive", { TST_FunctionNodeArchive($0) as IWAMessage }))
-    into.append(("TST.FunctionEndNodeArchive", { TST_FunctionEndNodeArchive($0) as IWAMessage }))
-    into.append(("TST.DateNodeArchive", { TST_DateNodeArchive($0) as IWAMessage }))
-    into.append(("TST.ReferenceNodeArchive", { TST_ReferenceNodeArchive($0) as IWAMessage }))
-    into.append(("TST.DurationNodeArchive", { TST_DurationNodeArchive($0) as IWAMessage }))
-    into.append(("TST.ArgumentPlaceholderNodeArchive", { TST_ArgumentPlaceholderNodeArchive($0) as IWAMessage }))
-    into.append(("TST.EmptyExpressionNodeArchive", { TST_EmptyExpressionNodeArchive($0) as IWAMessage }))
-    into.append(("TST.VariableNodeArchive", { TST_VariableNodeArchive($0) as IWAMessage }))
-    into.append(("TST.SpillOriginRefNodeArchive", { TST_SpillOriginRefNodeArchive($0) as IWAMessage }))
-    into.append(("TST.LayoutHintArchive", { TST_LayoutHintArchive($0) as IWAMessage }))
-    into.append(("TST.CompletionTokenAttachmentArchive", { TST_CompletionTokenAttachmentArchive($0) as IWAMessage }))
-    into.append(("TST.HiddenStateFormulaOwnerArchive", { TST_HiddenStateFormulaOwnerArchive($0) as IWAMessage }))
-    into.append(("TST.FormulaStoreArchive", { TST_FormulaStoreArchive($0) as IWAMessage }))
-    into.append(("TST.FormulaStoreArchive.FormulaStorePair", { TST_FormulaStoreArchive_FormulaStorePair($0) as IWAMessage }))
-    into.append(("TST.MergeOperationArchive", { TST_MergeOperationArchive($0) as IWAMessage }))
-    into.append(("TST.MergeOwnerArchive", { TST_MergeOwnerArchive($0) as IWAMessage }))
-    into.append(("TST.PencilAnnotationArchive", { TST_PencilAnnotationArchive($0) as IWAMessage }))
-    into.append(("TST.PencilAnnotationOwnerArchive", { TST_PencilAnnotationOwnerArchive($0) as IWAMessage }))
-    into.append(("TST.AccumulatorArchive", { TST_AccumulatorArchive($0) as IWAMessage }))
-    into.append(("TST.GroupColumnArchive", { TST_GroupColumnArchive($0) as IWAMessage }))
-    into.append(("TST.GroupColumnListArchive", { TST_GroupColumnListArchive($0) as IWAMessage }))
-    into.append(("TST.ColumnAggregateArchive", { TST_ColumnAggregateArchive($0) as IWAMessage }))
-    into.append(("TST.ColumnAggregateListArchive", { TST_ColumnAggregateListArchive($0) as IWAMessage }))
-    into.append(("TST.GroupByArchive", { TST_GroupByArchive($0) as IWAMessage }))
-    into.append(("TST.GroupByArchive.AggNodeArchive", { TST_GroupByArchive_AggNodeArchive($0) as IWAMessage }))
-    into.append(("TST.GroupByArchive.AggregatorArchive", { TST_GroupByArchive_AggregatorArchive($0) as IWAMessage }))
-    into.append(("TST.GroupByArchive.GroupNodeArchive", { TST_GroupByArchive_GroupNodeArchive($0) as IWAMessage }))
-    into.append(("TST.GroupByArchive.GroupNodeArchive.FormatManagerArchive", { TST_GroupByArchive_GroupNodeArchive_FormatManagerArchive($0) as IWAMessage }))
-    into.append(("TST.GroupByArchive.GroupNodeArchive.FormatManagerArchive.RowSetArchive", { TST_GroupByArchive_GroupNodeArchive_FormatManagerArchive_RowSetArchive($0) as IWAMessage }))
-    into.append(("TST.CategoryOwnerArchive", { TST_CategoryOwnerArchive($0) as IWAMessage }))
-    into.append(("TST.CategoryOwnerRefArchive", { TST_CategoryOwnerRefArchive($0) as IWAMessage }))
-    into.append(("TST.PivotGroupingColumnOptionsMapArchive", { TST_PivotGroupingColumnOptionsMapArchive($0) as IWAMessage }))
-    into.append(("TST.PivotOwnerArchive", { TST_PivotOwnerArchive($0) as IWAMessage }))
-    into.append(("TST.RichTextPayloadArchive", { TST_RichTextPayloadArchive($0) as IWAMessage }))
-    into.append(("TST.FormulaEqualsTokenAttachmentArchive", { TST_FormulaEqualsTokenAttachmentArchive($0) as IWAMessage }))
-    into.append(("TST.CellFillStandIn", { TST_CellFillStandIn($0) as IWAMessage }))
-    into.append(("TST.FormulaSelectionArchive", { TST_FormulaSelectionArchive($0) as IWAMessage }))
-    into.append(("TST.CellBorderArchive", { TST_CellBorderArchive($0) as IWAMessage }))
-    into.append(("TST.DefaultCellStylesContainerArchive", { TST_DefaultCellStylesContainerArchive($0) as IWAMessage }))
-    into.append(("TST.MultiTableRemapperArchive", { TST_MultiTableRemapperArchive($0) as IWAMessage }))
-    into.append(("TST.ChangePropagationMapWrapper", { TST_ChangePropagationMapWrapper($0) as IWAMessage }))
-    into.append(("TST.SummaryCellVendorArchive", { TST_SummaryCellVendorArchive($0) as IWAMessage }))
-    into.append(("TST.SummaryCellVendorArchive.SummaryCellEntry", { TST_SummaryCellVendorArchive_SummaryCellEntry($0) as IWAMessage }))
-    into.append(("TST.CategoryOrderArchive", { TST_CategoryOrderArchive($0) as IWAMessage }))
-    into.append(("TST.PivotOrderArchive", { TST_PivotOrderArchive($0) as IWAMessage }))
-    into.append(("TST.HeaderNameMgrTileArchive", { TST_HeaderNameMgrTileArchive($0) as IWAMessage }))
-    into.append(("TST.HeaderNameMgrTileArchive.NameFragmentArchive", { TST_HeaderNameMgrTileArchive_NameFragmentArchive($0) as IWAMessage }))
-    into.append(("TST.HeaderNameMgrArchive", { TST_HeaderNameMgrArchive($0) as IWAMessage }))
-    into.append(("TST.HeaderNameMgrArchive.PerTableArchive", { TST_HeaderNameMgrArchive_PerTableArchive($0) as IWAMessage }))
-    into.append(("TST.WidthHeightCacheFittingEntry", { TST_WidthHeightCacheFittingEntry($0) as IWAMessage }))
-    into.append(("TST.WidthHeightCache", { TST_WidthHeightCache($0) as IWAMessage }))
-    into.append(("TST.LayoutEngineArchive", { TST_LayoutEngineArchive($0) as IWAMessage }))
-    into.append(("TST.CollaboratorTableCursorSubselectionArchive", { TST_CollaboratorTableCursorSubselectionArchive($0) as IWAMessage }))
+func registerIWA_TSTArchives(_ into: inout [any IWAMessage.Type]) {
+    into += [
+        TST_CellID.self, TST_CellUIDLookupListArchive.self, TST_CellUIDListArchive.self, TST_TableSize.self,
+        TST_ExpandedTableSize.self, TST_CellRange.self, TST_ExpandedCellRange.self, TST_TableSelection.self,
+        TST_TileRowInfo.self, TST_Tile.self, TST_TileStorage.self, TST_TileStorage_Tile.self, TST_PopUpMenuModel.self,
+        TST_PopUpMenuModel_CellValue.self, TST_ImportWarningSetArchive.self,
+        TST_ImportWarningSetArchive_FormulaImportWarning.self, TST_CellRefImportWarningSetPairArchive.self,
+        TST_ImportWarningSetByCellRefArchive.self, TST_TableDataList.self, TST_TableDataList_ListEntry.self,
+        TST_TableDataListSegment.self, TST_TableRBTree.self, TST_TableRBTree_Node.self, TST_HeaderStorageBucket.self,
+        TST_HeaderStorageBucket_Header.self, TST_HeaderStorage.self, TST_DataStore.self, TST_TableInfoArchive.self,
+        TST_CategoryInfoArchive.self, TST_WPTableInfoArchive.self, TST_TableStyleNetworkArchive.self,
+        TST_TableGroupSortOrderUIDArchive.self, TST_TableGroupSortOrderUIDArchive_GroupSortRuleUIDArchive.self,
+        TST_TableSortOrderArchive.self, TST_TableSortOrderArchive_SortRuleArchive.self,
+        TST_TableSortOrderUIDArchive.self, TST_TableSortOrderUIDArchive_SortRuleArchive.self,
+        TST_SortRuleReferenceTrackerArchive.self, TST_CellRegion.self, TST_CellUIDRegionArchive.self,
+        TST_StructuredTextImportRecord.self, TST_TableModelArchive.self, TST_SummaryModelArchive.self,
+        TST_SummaryModelGroupByChangeStateArchive.self, TST_ColumnRowUIDMapArchive.self, TST_StrokeLayerArchive.self,
+        TST_StrokeLayerArchive_StrokeRunArchive.self, TST_StrokeSidecarArchive.self, TST_DurationWrapperArchive.self,
+        TST_Cell.self, TST_MergeRegionMapArchive.self, TST_CellMapArchive.self, TST_CellListArchive.self,
+        TST_CellListArchive_OptionalCell.self, TST_ConcurrentCellMapArchive.self, TST_ConcurrentCellListArchive.self,
+        TST_ConcurrentCellListArchive_OptionalCell.self, TST_CellFormatAndValueArchive.self, TST_CellSpecArchive.self,
+        TST_CommentStorageWrapperArchive.self, TST_CellDiffArchive.self, TST_CellDiffArray.self,
+        TST_CellDiffArraySegment.self, TST_CellDiffMapArchive.self, TST_HierarchicalCellDiffMapArchive.self,
+        TST_HierarchicalCellDiffMapArchive_BoxedRow.self, TST_DoubleStyleMapArchive.self,
+        TST_DoubleStyleMapArchive_DoubleStyleMapEntryArchive.self, TST_StyleTableMapArchive.self,
+        TST_StyleTableMapArchive_StyleTableMapEntryArchive.self, TST_SelectionArchive.self,
+        TST_DeathhawkRdar39989167CellSelectionArchive.self, TST_StrokeSelectionArchive.self,
+        TST_ControlCellSelectionArchive.self, TST_StockCellSelectionArchive.self, TST_TableNameSelectionArchive.self,
+        TST_AutofillSelectionArchive.self, TST_FilterRulePrePivotArchive.self, TST_FilterRuleArchive.self,
+        TST_TableStyleArchive.self, TST_CellStyleArchive.self, TST_FormulaPredArgDataArchive.self,
+        TST_FormulaPredArgArchive.self, TST_FormulaPredicatePrePivotArchive.self, TST_FormulaPredicateArchive.self,
+        TST_ConditionalStyleSetArchive.self, TST_ConditionalStyleSetArchive_ConditionalStyleRulePrePivot.self,
+        TST_ConditionalStyleSetArchive_ConditionalStyleRule.self,
+        TST_ConditionalStyleSetArchive_ConditionalStyleRules.self, TST_FilterSetArchive.self,
+        TST_UniqueIndexArchive.self, TST_UniqueIndexArchive_UniqueIndexEntryArchive.self,
+        TST_HiddenStateExtentArchive.self, TST_HiddenStateExtentArchive_RowOrColumnState.self,
+        TST_HiddenStatesArchive.self, TST_HiddenStatesOwnerArchive.self, TST_ExpandCollapseStateArchive.self,
+        TST_TokenAttachmentArchive.self, TST_ExpressionNodeArchive.self, TST_BooleanNodeArchive.self,
+        TST_NumberNodeArchive.self, TST_StringNodeArchive.self, TST_IdentifierNodeArchive.self,
+        TST_ArrayNodeArchive.self, TST_ListNodeArchive.self, TST_OperatorNodeArchive.self,
+        TST_PostfixOperatorNodeArchive.self, TST_PrefixOperatorNodeArchive.self, TST_FunctionNodeArchive.self,
+        TST_FunctionEndNodeArchive.self, TST_DateNodeArchive.self, TST_ReferenceNodeArchive.self,
+        TST_DurationNodeArchive.self, TST_ArgumentPlaceholderNodeArchive.self, TST_EmptyExpressionNodeArchive.self,
+        TST_VariableNodeArchive.self, TST_SpillOriginRefNodeArchive.self, TST_LayoutHintArchive.self,
+        TST_CompletionTokenAttachmentArchive.self, TST_HiddenStateFormulaOwnerArchive.self,
+        TST_FormulaStoreArchive.self, TST_FormulaStoreArchive_FormulaStorePair.self, TST_MergeOperationArchive.self,
+        TST_MergeOwnerArchive.self, TST_PencilAnnotationArchive.self, TST_PencilAnnotationOwnerArchive.self,
+        TST_AccumulatorArchive.self, TST_GroupColumnArchive.self, TST_GroupColumnListArchive.self,
+        TST_ColumnAggregateArchive.self, TST_ColumnAggregateListArchive.self, TST_GroupByArchive.self,
+        TST_GroupByArchive_AggNodeArchive.self, TST_GroupByArchive_AggregatorArchive.self,
+        TST_GroupByArchive_GroupNodeArchive.self, TST_GroupByArchive_GroupNodeArchive_FormatManagerArchive.self,
+        TST_GroupByArchive_GroupNodeArchive_FormatManagerArchive_RowSetArchive.self, TST_CategoryOwnerArchive.self,
+        TST_CategoryOwnerRefArchive.self, TST_PivotGroupingColumnOptionsMapArchive.self, TST_PivotOwnerArchive.self,
+        TST_RichTextPayloadArchive.self, TST_FormulaEqualsTokenAttachmentArchive.self, TST_CellFillStandIn.self,
+        TST_FormulaSelectionArchive.self, TST_CellBorderArchive.self, TST_DefaultCellStylesContainerArchive.self,
+        TST_MultiTableRemapperArchive.self, TST_ChangePropagationMapWrapper.self, TST_SummaryCellVendorArchive.self,
+        TST_SummaryCellVendorArchive_SummaryCellEntry.self, TST_CategoryOrderArchive.self, TST_PivotOrderArchive.self,
+        TST_HeaderNameMgrTileArchive.self, TST_HeaderNameMgrTileArchive_NameFragmentArchive.self,
+        TST_HeaderNameMgrArchive.self, TST_HeaderNameMgrArchive_PerTableArchive.self,
+        TST_WidthHeightCacheFittingEntry.self, TST_WidthHeightCache.self, TST_LayoutEngineArchive.self,
+        TST_CollaboratorTableCursorSubselectionArchive.self,
+    ]
 }
@@ -5,877 +5,270 @@ import SwiftTextIWA
 
 /// Generated wire model for `TST.Deprecated_TableStrokeArchive`.
 final class TST_Deprecated_TableStrokeArchive: IWAMessage {
-    var stroke: TSD_StrokeArchive?
-    var background: Bool?
-    var opacity: Float?
-    var empty: Bool?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TST.Deprecated_TableStrokeArchive", [
+        .optional(1, TSD_StrokeArchive.self), .optional(2, .bool), .optional(3, .float), .optional(4, .bool),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSD_StrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_StrokeArchive(ProtobufMessage(_b)) }
-            if let _v { stroke = _v }
-        case 2:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { background = _v }
-        case 3:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { opacity = _v }
-        case 4:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { empty = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = stroke { _w.bytesField(1, _x.encoded()) }
-        if let _x = background { _w.varintField(2, _x ? 1 : 0) }
-        if let _x = opacity { _w.fixed32Field(3, _x.bitPattern) }
-        if let _x = empty { _w.varintField(4, _x ? 1 : 0) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var stroke: TSD_StrokeArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var background: Bool? { get { self[1] } set { self[1] = newValue } }
+    var opacity: Float? { get { self[2] } set { self[2] = newValue } }
+    var empty: Bool? { get { self[3] } set { self[3] = newValue } }
 }
 
 /// Generated wire model for `TST.CellStylePropertiesArchive`.
 final class TST_CellStylePropertiesArchive: IWAMessage {
-    var cellFill: TSD_FillArchive?
-    var textWrap: Bool?
-    var deprecatedTopStroke: TST_Deprecated_TableStrokeArchive?
-    var deprecatedRightStroke: TST_Deprecated_TableStrokeArchive?
-    var deprecatedBottomStroke: TST_Deprecated_TableStrokeArchive?
-    var deprecatedLeftStroke: TST_Deprecated_TableStrokeArchive?
-    var verticalAlignment: Int32?
-    var padding: TSWP_PaddingArchive?
-    var topStroke: TSD_StrokeArchive?
-    var rightStroke: TSD_StrokeArchive?
-    var bottomStroke: TSD_StrokeArchive?
-    var leftStroke: TSD_StrokeArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TST.CellStylePropertiesArchive", [
+        .optional(1, TSD_FillArchive.self), .optional(3, .bool), .optional(4, TST_Deprecated_TableStrokeArchive.self),
+        .optional(5, TST_Deprecated_TableStrokeArchive.self), .optional(6, TST_Deprecated_TableStrokeArchive.self),
+        .optional(7, TST_Deprecated_TableStrokeArchive.self), .optional(8, .int32),
+        .optional(9, TSWP_PaddingArchive.self), .optional(10, TSD_StrokeArchive.self),
+        .optional(11, TSD_StrokeArchive.self), .optional(12, TSD_StrokeArchive.self),
+        .optional(13, TSD_StrokeArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 12)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSD_FillArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_FillArchive(ProtobufMessage(_b)) }
-            if let _v { cellFill = _v }
-        case 3:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { textWrap = _v }
-        case 4:
-            var _v: TST_Deprecated_TableStrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_Deprecated_TableStrokeArchive(ProtobufMessage(_b)) }
-            if let _v { deprecatedTopStroke = _v }
-        case 5:
-            var _v: TST_Deprecated_TableStrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_Deprecated_TableStrokeArchive(ProtobufMessage(_b)) }
-            if let _v { deprecatedRightStroke = _v }
-        case 6:
-            var _v: TST_Deprecated_TableStrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_Deprecated_TableStrokeArchive(ProtobufMessage(_b)) }
-            if let _v { deprecatedBottomStroke = _v }
-        case 7:
-            var _v: TST_Deprecated_TableStrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_Deprecated_TableStrokeArchive(ProtobufMessage(_b)) }
-            if let _v { deprecatedLeftStroke = _v }
-        case 8:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { verticalAlignment = _v }
-        case 9:
-            var _v: TSWP_PaddingArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_PaddingArchive(ProtobufMessage(_b)) }
-            if let _v { padding = _v }
-        case 10:
-            var _v: TSD_StrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_StrokeArchive(ProtobufMessage(_b)) }
-            if let _v { topStroke = _v }
-        case 11:
-            var _v: TSD_StrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_StrokeArchive(ProtobufMessage(_b)) }
-            if let _v { rightStroke = _v }
-        case 12:
-            var _v: TSD_StrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_StrokeArchive(ProtobufMessage(_b)) }
-            if let _v { bottomStroke = _v }
-        case 13:
-            var _v: TSD_StrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_StrokeArchive(ProtobufMessage(_b)) }
-            if let _v { leftStroke = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = cellFill { _w.bytesField(1, _x.encoded()) }
-        if let _x = textWrap { _w.varintField(3, _x ? 1 : 0) }
-        if let _x = deprecatedTopStroke { _w.bytesField(4, _x.encoded()) }
-        if let _x = deprecatedRightStroke { _w.bytesField(5, _x.encoded()) }
-        if let _x = deprecatedBottomStroke { _w.bytesField(6, _x.encoded()) }
-        if let _x = deprecatedLeftStroke { _w.bytesField(7, _x.encoded()) }
-        if let _x = verticalAlignment { _w.varintField(8, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = padding { _w.bytesField(9, _x.encoded()) }
-        if let _x = topStroke { _w.bytesField(10, _x.encoded()) }
-        if let _x = rightStroke { _w.bytesField(11, _x.encoded()) }
-        if let _x = bottomStroke { _w.bytesField(12, _x.encoded()) }
-        if let _x = leftStroke { _w.bytesField(13, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var cellFill: TSD_FillArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var textWrap: Bool? { get { self[1] } set { self[1] = newValue } }
+    var deprecatedTopStroke: TST_Deprecated_TableStrokeArchive? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var deprecatedRightStroke: TST_Deprecated_TableStrokeArchive? { get { self[message: 3] } set { self[message: 3] = newValue } }
+    var deprecatedBottomStroke: TST_Deprecated_TableStrokeArchive? { get { self[message: 4] } set { self[message: 4] = newValue } }
+    var deprecatedLeftStroke: TST_Deprecated_TableStrokeArchive? { get { self[message: 5] } set { self[message: 5] = newValue } }
+    var verticalAlignment: Int32? { get { self[6] } set { self[6] = newValue } }
+    var padding: TSWP_PaddingArchive? { get { self[message: 7] } set { self[message: 7] = newValue } }
+    var topStroke: TSD_StrokeArchive? { get { self[message: 8] } set { self[message: 8] = newValue } }
+    var rightStroke: TSD_StrokeArchive? { get { self[message: 9] } set { self[message: 9] = newValue } }
+    var bottomStroke: TSD_StrokeArchive? { get { self[message: 10] } set { self[message: 10] = newValue } }
+    var leftStroke: TSD_StrokeArchive? { get { self[message: 11] } set { self[message: 11] = newValue } }
 }
 
 /// Generated wire model for `TST.Deprecated_StrokePresetDataArchive`.
 final class TST_Deprecated_StrokePresetDataArchive: IWAMessage {
-    var deprecatedHorizontalStroke: TST_Deprecated_TableStrokeArchive?
-    var deprecatedVerticalStroke: TST_Deprecated_TableStrokeArchive?
-    var deprecatedExteriorStroke: TST_Deprecated_TableStrokeArchive?
-    var deprecatedVisibleMask: Int32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TST.Deprecated_StrokePresetDataArchive", [
+        .optional(2, TST_Deprecated_TableStrokeArchive.self), .optional(1, TST_Deprecated_TableStrokeArchive.self),
+        .optional(3, TST_Deprecated_TableStrokeArchive.self), .optional(5, .int32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 2:
-            var _v: TST_Deprecated_TableStrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_Deprecated_TableStrokeArchive(ProtobufMessage(_b)) }
-            if let _v { deprecatedHorizontalStroke = _v }
-        case 1:
-            var _v: TST_Deprecated_TableStrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_Deprecated_TableStrokeArchive(ProtobufMessage(_b)) }
-            if let _v { deprecatedVerticalStroke = _v }
-        case 3:
-            var _v: TST_Deprecated_TableStrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_Deprecated_TableStrokeArchive(ProtobufMessage(_b)) }
-            if let _v { deprecatedExteriorStroke = _v }
-        case 5:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { deprecatedVisibleMask = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = deprecatedHorizontalStroke { _w.bytesField(2, _x.encoded()) }
-        if let _x = deprecatedVerticalStroke { _w.bytesField(1, _x.encoded()) }
-        if let _x = deprecatedExteriorStroke { _w.bytesField(3, _x.encoded()) }
-        if let _x = deprecatedVisibleMask { _w.varintField(5, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var deprecatedHorizontalStroke: TST_Deprecated_TableStrokeArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var deprecatedVerticalStroke: TST_Deprecated_TableStrokeArchive? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var deprecatedExteriorStroke: TST_Deprecated_TableStrokeArchive? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var deprecatedVisibleMask: Int32? { get { self[3] } set { self[3] = newValue } }
 }
 
 /// Generated wire model for `TST.StrokePresetDataArchive`.
 final class TST_StrokePresetDataArchive: IWAMessage {
-    var horizontalStroke: TSD_StrokeArchive?
-    var verticalStroke: TSD_StrokeArchive?
-    var exteriorStroke: TSD_StrokeArchive?
-    var visibleMask: Int32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TST.StrokePresetDataArchive", [
+        .optional(1, TSD_StrokeArchive.self), .optional(2, TSD_StrokeArchive.self),
+        .optional(3, TSD_StrokeArchive.self), .optional(4, .int32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSD_StrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_StrokeArchive(ProtobufMessage(_b)) }
-            if let _v { horizontalStroke = _v }
-        case 2:
-            var _v: TSD_StrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_StrokeArchive(ProtobufMessage(_b)) }
-            if let _v { verticalStroke = _v }
-        case 3:
-            var _v: TSD_StrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_StrokeArchive(ProtobufMessage(_b)) }
-            if let _v { exteriorStroke = _v }
-        case 4:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { visibleMask = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = horizontalStroke { _w.bytesField(1, _x.encoded()) }
-        if let _x = verticalStroke { _w.bytesField(2, _x.encoded()) }
-        if let _x = exteriorStroke { _w.bytesField(3, _x.encoded()) }
-        if let _x = visibleMask { _w.varintField(4, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var horizontalStroke: TSD_StrokeArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var verticalStroke: TSD_StrokeArchive? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var exteriorStroke: TSD_StrokeArchive? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var visibleMask: Int32? { get { self[3] } set { self[3] = newValue } }
 }
 
 /// Generated wire model for `TST.StrokePresetListArchive`.
 final class TST_StrokePresetListArchive: IWAMessage {
-    var count: Int32?
-    var deprecatedPreset: [TST_Deprecated_StrokePresetDataArchive] = []
-    var preset: [TST_StrokePresetDataArchive] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TST.StrokePresetListArchive", [
+        .optional(1, .int32), .repeated(2, TST_Deprecated_StrokePresetDataArchive.self),
+        .repeated(3, TST_StrokePresetDataArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { count = _v }
-        case 2:
-            var _v: TST_Deprecated_StrokePresetDataArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_Deprecated_StrokePresetDataArchive(ProtobufMessage(_b)) }
-            if let _v { deprecatedPreset.append(_v) }
-        case 3:
-            var _v: TST_StrokePresetDataArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_StrokePresetDataArchive(ProtobufMessage(_b)) }
-            if let _v { preset.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = count { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        for _x in deprecatedPreset { _w.bytesField(2, _x.encoded()) }
-        for _x in preset { _w.bytesField(3, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var count: Int32? { get { self[0] } set { self[0] = newValue } }
+    var deprecatedPreset: [TST_Deprecated_StrokePresetDataArchive] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(deprecatedPreset value: TST_Deprecated_StrokePresetDataArchive) { append(value, toMessages: 1) }
+    var preset: [TST_StrokePresetDataArchive] { get { self[messages: 2] } set { self[messages: 2] = newValue } }
+    func append(preset value: TST_StrokePresetDataArchive) { append(value, toMessages: 2) }
 }
 
 /// Generated wire model for `TST.TableStylePropertiesArchive`.
 final class TST_TableStylePropertiesArchive: IWAMessage {
-    var bandedRows: Bool?
-    var bandedFill: TSD_FillArchive?
-    var behavesLikeSpreadsheet: Bool?
-    var autoResize: Bool?
-    var deprecatedHeaderRowSeparatorStroke: TST_Deprecated_TableStrokeArchive?
-    var deprecatedHeaderRowBorderStroke: TST_Deprecated_TableStrokeArchive?
-    var deprecatedHeaderRowHorizontalStroke: TST_Deprecated_TableStrokeArchive?
-    var deprecatedHeaderRowVerticalStroke: TST_Deprecated_TableStrokeArchive?
-    var deprecatedHeaderColumnBorderStroke: TST_Deprecated_TableStrokeArchive?
-    var deprecatedHeaderColumnSeparatorStroke: TST_Deprecated_TableStrokeArchive?
-    var deprecatedHeaderColumnHorizontalStroke: TST_Deprecated_TableStrokeArchive?
-    var deprecatedHeaderColumnVerticalStroke: TST_Deprecated_TableStrokeArchive?
-    var deprecatedFooterRowSeparatorStroke: TST_Deprecated_TableStrokeArchive?
-    var deprecatedFooterRowBorderStroke: TST_Deprecated_TableStrokeArchive?
-    var deprecatedFooterRowHorizontalStroke: TST_Deprecated_TableStrokeArchive?
-    var deprecatedFooterRowVerticalStroke: TST_Deprecated_TableStrokeArchive?
-    var deprecatedTableBodyHorizontalBorderStroke: TST_Deprecated_TableStrokeArchive?
-    var deprecatedTableBodyVerticalBorderStroke: TST_Deprecated_TableStrokeArchive?
-    var deprecatedTableBodyHorizontalStroke: TST_Deprecated_TableStrokeArchive?
-    var deprecatedTableBodyVerticalStroke: TST_Deprecated_TableStrokeArchive?
-    var strokePresetList: TST_StrokePresetListArchive?
-    var vStrokesVisible: Bool?
-    var hStrokesVisible: Bool?
-    var hrSeparatorVisible: Bool?
-    var hcSeparatorVisible: Bool?
-    var footerSeparatorVisible: Bool?
-    var tableBorderVisible: Bool?
-    var tableHeaderBorderVisible: Bool?
-    var tableHcDividerVisible: Bool?
-    var tableHrDividerVisible: Bool?
-    var tableFooterDividerVisible: Bool?
-    var obsoleteMasterFontSize: Int32?
-    var masterFontFamily: String?
-    var writingDirection: Int32?
-    var headerRowSeparatorStroke: TSD_StrokeArchive?
-    var headerRowBorderStroke: TSD_StrokeArchive?
-    var headerRowHorizontalStroke: TSD_StrokeArchive?
-    var headerRowVerticalStroke: TSD_StrokeArchive?
-    var headerColumnBorderStroke: TSD_StrokeArchive?
-    var headerColumnSeparatorStroke: TSD_StrokeArchive?
-    var headerColumnHorizontalStroke: TSD_StrokeArchive?
-    var headerColumnVerticalStroke: TSD_StrokeArchive?
-    var footerRowSeparatorStroke: TSD_StrokeArchive?
-    var footerRowBorderStroke: TSD_StrokeArchive?
-    var footerRowHorizontalStroke: TSD_StrokeArchive?
-    var footerRowVerticalStroke: TSD_StrokeArchive?
-    var tableBodyHorizontalBorderStroke: TSD_StrokeArchive?
-    var tableBodyVerticalBorderStroke: TSD_StrokeArchive?
-    var tableBodyHorizontalStroke: TSD_StrokeArchive?
-    var tableBodyVerticalStroke: TSD_StrokeArchive?
-    var categoryLevel1TopStroke: TSD_StrokeArchive?
-    var categoryLevel2TopStroke: TSD_StrokeArchive?
-    var categoryLevel3TopStroke: TSD_StrokeArchive?
-    var categoryLevel4TopStroke: TSD_StrokeArchive?
-    var categoryLevel5TopStroke: TSD_StrokeArchive?
-    var categoryLevel1BottomStroke: TSD_StrokeArchive?
-    var categoryLevel2BottomStroke: TSD_StrokeArchive?
-    var categoryLevel3BottomStroke: TSD_StrokeArchive?
-    var categoryLevel4BottomStroke: TSD_StrokeArchive?
-    var categoryLevel5BottomStroke: TSD_StrokeArchive?
-    var categoryLevel1InteriorStroke: TSD_StrokeArchive?
-    var categoryLevel2InteriorStroke: TSD_StrokeArchive?
-    var categoryLevel3InteriorStroke: TSD_StrokeArchive?
-    var categoryLevel4InteriorStroke: TSD_StrokeArchive?
-    var categoryLevel5InteriorStroke: TSD_StrokeArchive?
-    var categoryLevel1LabelSeparatorStroke: TSD_StrokeArchive?
-    var categoryLevel2LabelSeparatorStroke: TSD_StrokeArchive?
-    var categoryLevel3LabelSeparatorStroke: TSD_StrokeArchive?
-    var categoryLevel4LabelSeparatorStroke: TSD_StrokeArchive?
-    var categoryLevel5LabelSeparatorStroke: TSD_StrokeArchive?
-    var tableBodyPivotGroupHorizontalStroke: TSD_StrokeArchive?
-    var tableBodyPivotGroupVerticalStroke: TSD_StrokeArchive?
-    var tableBodyPivotDeemphasisHorizontalStroke: TSD_StrokeArchive?
-    var tableBodyPivotEmphasisVerticalStroke: TSD_StrokeArchive?
-    var headerColumnPivotGroupHorizontalStroke: TSD_StrokeArchive?
-    var headerColumnPivotGroupDeemphasisStroke: TSD_StrokeArchive?
-    var headerColumnPivotSeparatorStroke: TSD_StrokeArchive?
-    var headerRowPivotGroupVerticalStroke: TSD_StrokeArchive?
-    var headerRowPivotGroupDeemphasisStroke: TSD_StrokeArchive?
-    var headerRowPivotTitleStroke: TSD_StrokeArchive?
-    var footerRowPivotGroupVerticalStroke: TSD_StrokeArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TST.TableStylePropertiesArchive", [
+        .optional(1, .bool), .optional(2, TSD_FillArchive.self), .optional(21, .bool), .optional(22, .bool),
+        .optional(4, TST_Deprecated_TableStrokeArchive.self), .optional(5, TST_Deprecated_TableStrokeArchive.self),
+        .optional(23, TST_Deprecated_TableStrokeArchive.self), .optional(24, TST_Deprecated_TableStrokeArchive.self),
+        .optional(7, TST_Deprecated_TableStrokeArchive.self), .optional(8, TST_Deprecated_TableStrokeArchive.self),
+        .optional(25, TST_Deprecated_TableStrokeArchive.self), .optional(26, TST_Deprecated_TableStrokeArchive.self),
+        .optional(10, TST_Deprecated_TableStrokeArchive.self), .optional(11, TST_Deprecated_TableStrokeArchive.self),
+        .optional(27, TST_Deprecated_TableStrokeArchive.self), .optional(28, TST_Deprecated_TableStrokeArchive.self),
+        .optional(12, TST_Deprecated_TableStrokeArchive.self), .optional(29, TST_Deprecated_TableStrokeArchive.self),
+        .optional(30, TST_Deprecated_TableStrokeArchive.self), .optional(31, TST_Deprecated_TableStrokeArchive.self),
+        .optional(32, TST_StrokePresetListArchive.self), .optional(33, .bool), .optional(34, .bool),
+        .optional(35, .bool), .optional(36, .bool), .optional(37, .bool), .optional(38, .bool), .optional(39, .bool),
+        .optional(42, .bool), .optional(43, .bool), .optional(44, .bool), .optional(40, .int32), .optional(41, .string),
+        .optional(45, .int32), .optional(46, TSD_StrokeArchive.self), .optional(47, TSD_StrokeArchive.self),
+        .optional(48, TSD_StrokeArchive.self), .optional(49, TSD_StrokeArchive.self),
+        .optional(50, TSD_StrokeArchive.self), .optional(51, TSD_StrokeArchive.self),
+        .optional(52, TSD_StrokeArchive.self), .optional(53, TSD_StrokeArchive.self),
+        .optional(54, TSD_StrokeArchive.self), .optional(55, TSD_StrokeArchive.self),
+        .optional(56, TSD_StrokeArchive.self), .optional(57, TSD_StrokeArchive.self),
+        .optional(58, TSD_StrokeArchive.self), .optional(59, TSD_StrokeArchive.self),
+        .optional(60, TSD_StrokeArchive.self), .optional(61, TSD_StrokeArchive.self),
+        .optional(62, TSD_StrokeArchive.self), .optional(63, TSD_StrokeArchive.self),
+        .optional(64, TSD_StrokeArchive.self), .optional(65, TSD_StrokeArchive.self),
+        .optional(66, TSD_StrokeArchive.self), .optional(67, TSD_StrokeArchive.self),
+        .optional(68, TSD_StrokeArchive.self), .optional(69, TSD_StrokeArchive.self),
+        .optional(70, TSD_StrokeArchive.self), .optional(71, TSD_StrokeArchive.self),
+        .optional(72, TSD_StrokeArchive.self), .optional(73, TSD_StrokeArchive.self),
+        .optional(74, TSD_StrokeArchive.self), .optional(75, TSD_StrokeArchive.self),
+        .optional(76, TSD_StrokeArchive.self), .optional(77, TSD_StrokeArchive.self),
+        .optional(78, TSD_StrokeArchive.self), .optional(79, TSD_StrokeArchive.self),
+        .optional(80, TSD_StrokeArchive.self), .optional(81, TSD_StrokeArchive.self),
+        .optional(82, TSD_StrokeArchive.self), .optional(83, TSD_StrokeArchive.self),
+        .optional(84, TSD_StrokeArchive.self), .optional(85, TSD_StrokeArchive.self),
+        .optional(86, TSD_StrokeArchive.self), .optional(87, TSD_StrokeArchive.self),
+        .optional(88, TSD_StrokeArchive.self), .optional(89, TSD_StrokeArchive.self),
+        .optional(90, TSD_StrokeArchive.self), .optional(91, TSD_StrokeArchive.self),
+        .optional(92, TSD_StrokeArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 81)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { bandedRows = _v }
-        case 2:
-            var _v: TSD_FillArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_FillArchive(ProtobufMessage(_b)) }
-            if let _v { bandedFill = _v }
-        case 21:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { behavesLikeSpreadsheet = _v }
-        case 22:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { autoResize = _v }
-        case 4:
-            var _v: TST_Deprecated_TableStrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_Deprecated_TableStrokeArchive(ProtobufMessage(_b)) }
-            if let _v { deprecatedHeaderRowSeparatorStroke = _v }
-        case 5:
-            var _v: TST_Deprecated_TableStrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_Deprecated_TableStrokeArchive(ProtobufMessage(_b)) }
-            if let _v { deprecatedHeaderRowBorderStroke = _v }
-        case 23:
-            var _v: TST_Deprecated_TableStrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_Deprecated_TableStrokeArchive(ProtobufMessage(_b)) }
-            if let _v { deprecatedHeaderRowHorizontalStroke = _v }
-        case 24:
-            var _v: TST_Deprecated_TableStrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_Deprecated_TableStrokeArchive(ProtobufMessage(_b)) }
-            if let _v { deprecatedHeaderRowVerticalStroke = _v }
-        case 7:
-            var _v: TST_Deprecated_TableStrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_Deprecated_TableStrokeArchive(ProtobufMessage(_b)) }
-            if let _v { deprecatedHeaderColumnBorderStroke = _v }
-        case 8:
-            var _v: TST_Deprecated_TableStrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_Deprecated_TableStrokeArchive(ProtobufMessage(_b)) }
-            if let _v { deprecatedHeaderColumnSeparatorStroke = _v }
-        case 25:
-            var _v: TST_Deprecated_TableStrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_Deprecated_TableStrokeArchive(ProtobufMessage(_b)) }
-            if let _v { deprecatedHeaderColumnHorizontalStroke = _v }
-        case 26:
-            var _v: TST_Deprecated_TableStrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_Deprecated_TableStrokeArchive(ProtobufMessage(_b)) }
-            if let _v { deprecatedHeaderColumnVerticalStroke = _v }
-        case 10:
-            var _v: TST_Deprecated_TableStrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_Deprecated_TableStrokeArchive(ProtobufMessage(_b)) }
-            if let _v { deprecatedFooterRowSeparatorStroke = _v }
-        case 11:
-            var _v: TST_Deprecated_TableStrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_Deprecated_TableStrokeArchive(ProtobufMessage(_b)) }
-            if let _v { deprecatedFooterRowBorderStroke = _v }
-        case 27:
-            var _v: TST_Deprecated_TableStrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_Deprecated_TableStrokeArchive(ProtobufMessage(_b)) }
-            if let _v { deprecatedFooterRowHorizontalStroke = _v }
-        case 28:
-            var _v: TST_Deprecated_TableStrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_Deprecated_TableStrokeArchive(ProtobufMessage(_b)) }
-            if let _v { deprecatedFooterRowVerticalStroke = _v }
-        case 12:
-            var _v: TST_Deprecated_TableStrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_Deprecated_TableStrokeArchive(ProtobufMessage(_b)) }
-            if let _v { deprecatedTableBodyHorizontalBorderStroke = _v }
-        case 29:
-            var _v: TST_Deprecated_TableStrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_Deprecated_TableStrokeArchive(ProtobufMessage(_b)) }
-            if let _v { deprecatedTableBodyVerticalBorderStroke = _v }
-        case 30:
-            var _v: TST_Deprecated_TableStrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_Deprecated_TableStrokeArchive(ProtobufMessage(_b)) }
-            if let _v { deprecatedTableBodyHorizontalStroke = _v }
-        case 31:
-            var _v: TST_Deprecated_TableStrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_Deprecated_TableStrokeArchive(ProtobufMessage(_b)) }
-            if let _v { deprecatedTableBodyVerticalStroke = _v }
-        case 32:
-            var _v: TST_StrokePresetListArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TST_StrokePresetListArchive(ProtobufMessage(_b)) }
-            if let _v { strokePresetList = _v }
-        case 33:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { vStrokesVisible = _v }
-        case 34:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { hStrokesVisible = _v }
-        case 35:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { hrSeparatorVisible = _v }
-        case 36:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { hcSeparatorVisible = _v }
-        case 37:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { footerSeparatorVisible = _v }
-        case 38:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { tableBorderVisible = _v }
-        case 39:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { tableHeaderBorderVisible = _v }
-        case 42:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { tableHcDividerVisible = _v }
-        case 43:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { tableHrDividerVisible = _v }
-        case 44:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { tableFooterDividerVisible = _v }
-        case 40:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { obsoleteMasterFontSize = _v }
-        case 41:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { masterFontFamily = _v }
-        case 45:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { writingDirection = _v }
-        case 46:
-            var _v: TSD_StrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_StrokeArchive(ProtobufMessage(_b)) }
-            if let _v { headerRowSeparatorStroke = _v }
-        case 47:
-            var _v: TSD_StrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_StrokeArchive(ProtobufMessage(_b)) }
-            if let _v { headerRowBorderStroke = _v }
-        case 48:
-            var _v: TSD_StrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_StrokeArchive(ProtobufMessage(_b)) }
-            if let _v { headerRowHorizontalStroke = _v }
-        case 49:
-            var _v: TSD_StrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_StrokeArchive(ProtobufMessage(_b)) }
-            if let _v { headerRowVerticalStroke = _v }
-        case 50:
-            var _v: TSD_StrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_StrokeArchive(ProtobufMessage(_b)) }
-            if let _v { headerColumnBorderStroke = _v }
-        case 51:
-            var _v: TSD_StrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_StrokeArchive(ProtobufMessage(_b)) }
-            if let _v { headerColumnSeparatorStroke = _v }
-        case 52:
-            var _v: TSD_StrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_StrokeArchive(ProtobufMessage(_b)) }
-            if let _v { headerColumnHorizontalStroke = _v }
-        case 53:
-            var _v: TSD_StrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_StrokeArchive(ProtobufMessage(_b)) }
-            if let _v { headerColumnVerticalStroke = _v }
-        case 54:
-            var _v: TSD_StrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_StrokeArchive(ProtobufMessage(_b)) }
-            if let _v { footerRowSeparatorStroke = _v }
-        case 55:
-            var _v: TSD_StrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_StrokeArchive(ProtobufMessage(_b)) }
-            if let _v { footerRowBorderStroke = _v }
-        case 56:
-            var _v: TSD_StrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_StrokeArchive(ProtobufMessage(_b)) }
-            if let _v { footerRowHorizontalStroke = _v }
-        case 57:
-            var _v: TSD_StrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_StrokeArchive(ProtobufMessage(_b)) }
-            if let _v { footerRowVerticalStroke = _v }
-        case 58:
-            var _v: TSD_StrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_StrokeArchive(ProtobufMessage(_b)) }
-            if let _v { tableBodyHorizontalBorderStroke = _v }
-        case 59:
-            var _v: TSD_StrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_StrokeArchive(ProtobufMessage(_b)) }
-            if let _v { tableBodyVerticalBorderStroke = _v }
-        case 60:
-            var _v: TSD_StrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_StrokeArchive(ProtobufMessage(_b)) }
-            if let _v { tableBodyHorizontalStroke = _v }
-        case 61:
-            var _v: TSD_StrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_StrokeArchive(ProtobufMessage(_b)) }
-            if let _v { tableBodyVerticalStroke = _v }
-        case 62:
-            var _v: TSD_StrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_StrokeArchive(ProtobufMessage(_b)) }
-            if let _v { categoryLevel1TopStroke = _v }
-        case 63:
-            var _v: TSD_StrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_StrokeArchive(ProtobufMessage(_b)) }
-            if let _v { categoryLevel2TopStroke = _v }
-        case 64:
-            var _v: TSD_StrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_StrokeArchive(ProtobufMessage(_b)) }
-            if let _v { categoryLevel3TopStroke = _v }
-        case 65:
-            var _v: TSD_StrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_StrokeArchive(ProtobufMessage(_b)) }
-            if let _v { categoryLevel4TopStroke = _v }
-        case 66:
-            var _v: TSD_StrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_StrokeArchive(ProtobufMessage(_b)) }
-            if let _v { categoryLevel5TopStroke = _v }
-        case 67:
-            var _v: TSD_StrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_StrokeArchive(ProtobufMessage(_b)) }
-            if let _v { categoryLevel1BottomStroke = _v }
-        case 68:
-            var _v: TSD_StrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_StrokeArchive(ProtobufMessage(_b)) }
-            if let _v { categoryLevel2BottomStroke = _v }
-        case 69:
-            var _v: TSD_StrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_StrokeArchive(ProtobufMessage(_b)) }
-            if let _v { categoryLevel3BottomStroke = _v }
-        case 70:
-            var _v: TSD_StrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_StrokeArchive(ProtobufMessage(_b)) }
-            if let _v { categoryLevel4BottomStroke = _v }
-        case 71:
-            var _v: TSD_StrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_StrokeArchive(ProtobufMessage(_b)) }
-            if let _v { categoryLevel5BottomStroke = _v }
-        case 72:
-            var _v: TSD_StrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_StrokeArchive(ProtobufMessage(_b)) }
-            if let _v { categoryLevel1InteriorStroke = _v }
-        case 73:
-            var _v: TSD_StrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_StrokeArchive(ProtobufMessage(_b)) }
-            if let _v { categoryLevel2InteriorStroke = _v }
-        case 74:
-            var _v: TSD_StrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_StrokeArchive(ProtobufMessage(_b)) }
-            if let _v { categoryLevel3InteriorStroke = _v }
-        case 75:
-            var _v: TSD_StrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_StrokeArchive(ProtobufMessage(_b)) }
-            if let _v { categoryLevel4InteriorStroke = _v }
-        case 76:
-            var _v: TSD_StrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_StrokeArchive(ProtobufMessage(_b)) }
-            if let _v { categoryLevel5InteriorStroke = _v }
-        case 77:
-            var _v: TSD_StrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_StrokeArchive(ProtobufMessage(_b)) }
-            if let _v { categoryLevel1LabelSeparatorStroke = _v }
-        case 78:
-            var _v: TSD_StrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_StrokeArchive(ProtobufMessage(_b)) }
-            if let _v { categoryLevel2LabelSeparatorStroke = _v }
-        case 79:
-            var _v: TSD_StrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_StrokeArchive(ProtobufMessage(_b)) }
-            if let _v { categoryLevel3LabelSeparatorStroke = _v }
-        case 80:
-            var _v: TSD_StrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_StrokeArchive(ProtobufMessage(_b)) }
-            if let _v { categoryLevel4LabelSeparatorStroke = _v }
-        case 81:
-            var _v: TSD_StrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_StrokeArchive(ProtobufMessage(_b)) }
-            if let _v { categoryLevel5LabelSeparatorStroke = _v }
-        case 82:
-            var _v: TSD_StrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_StrokeArchive(ProtobufMessage(_b)) }
-            if let _v { tableBodyPivotGroupHorizontalStroke = _v }
-        case 83:
-            var _v: TSD_StrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_StrokeArchive(ProtobufMessage(_b)) }
-            if let _v { tableBodyPivotGroupVerticalStroke = _v }
-        case 84:
-            var _v: TSD_StrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_StrokeArchive(ProtobufMessage(_b)) }
-            if let _v { tableBodyPivotDeemphasisHorizontalStroke = _v }
-        case 85:
-            var _v: TSD_StrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_StrokeArchive(ProtobufMessage(_b)) }
-            if let _v { tableBodyPivotEmphasisVerticalStroke = _v }
-        case 86:
-            var _v: TSD_StrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_StrokeArchive(ProtobufMessage(_b)) }
-            if let _v { headerColumnPivotGroupHorizontalStroke = _v }
-        case 87:
-            var _v: TSD_StrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_StrokeArchive(ProtobufMessage(_b)) }
-            if let _v { headerColumnPivotGroupDeemphasisStroke = _v }
-        case 88:
-            var _v: TSD_StrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_StrokeArchive(ProtobufMessage(_b)) }
-            if let _v { headerColumnPivotSeparatorStroke = _v }
-        case 89:
-            var _v: TSD_StrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_StrokeArchive(ProtobufMessage(_b)) }
-            if let _v { headerRowPivotGroupVerticalStroke = _v }
-        case 90:
-            var _v: TSD_StrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_StrokeArchive(ProtobufMessage(_b)) }
-            if let _v { headerRowPivotGroupDeemphasisStroke = _v }
-        case 91:
-            var _v: TSD_StrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_StrokeArchive(ProtobufMessage(_b)) }
-            if let _v { headerRowPivotTitleStroke = _v }
-        case 92:
-            var _v: TSD_StrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_StrokeArchive(ProtobufMessage(_b)) }
-            if let _v { footerRowPivotGroupVerticalStroke = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = bandedRows { _w.varintField(1, _x ? 1 : 0) }
-        if let _x = bandedFill { _w.bytesField(2, _x.encoded()) }
-        if let _x = behavesLikeSpreadsheet { _w.varintField(21, _x ? 1 : 0) }
-        if let _x = autoResize { _w.varintField(22, _x ? 1 : 0) }
-        if let _x = deprecatedHeaderRowSeparatorStroke { _w.bytesField(4, _x.encoded()) }
-        if let _x = deprecatedHeaderRowBorderStroke { _w.bytesField(5, _x.encoded()) }
-        if let _x = deprecatedHeaderRowHorizontalStroke { _w.bytesField(23, _x.encoded()) }
-        if let _x = deprecatedHeaderRowVerticalStroke { _w.bytesField(24, _x.encoded()) }
-        if let _x = deprecatedHeaderColumnBorderStroke { _w.bytesField(7, _x.encoded()) }
-        if let _x = deprecatedHeaderColumnSeparatorStroke { _w.bytesField(8, _x.encoded()) }
-        if let _x = deprecatedHeaderColumnHorizontalStroke { _w.bytesField(25, _x.encoded()) }
-        if let _x = deprecatedHeaderColumnVerticalStroke { _w.bytesField(26, _x.encoded()) }
-        if let _x = deprecatedFooterRowSeparatorStroke { _w.bytesField(10, _x.encoded()) }
-        if let _x = deprecatedFooterRowBorderStroke { _w.bytesField(11, _x.encoded()) }
-        if let _x = deprecatedFooterRowHorizontalStroke { _w.bytesField(27, _x.encoded()) }
-        if let _x = deprecatedFooterRowVerticalStroke { _w.bytesField(28, _x.encoded()) }
-        if let _x = deprecatedTableBodyHorizontalBorderStroke { _w.bytesField(12, _x.encoded()) }
-        if let _x = deprecatedTableBodyVerticalBorderStroke { _w.bytesField(29, _x.encoded()) }
-        if let _x = deprecatedTableBodyHorizontalStroke { _w.bytesField(30, _x.encoded()) }
-        if let _x = deprecatedTableBodyVerticalStroke { _w.bytesField(31, _x.encoded()) }
-        if let _x = strokePresetList { _w.bytesField(32, _x.encoded()) }
-        if let _x = vStrokesVisible { _w.varintField(33, _x ? 1 : 0) }
-        if let _x = hStrokesVisible { _w.varintField(34, _x ? 1 : 0) }
-        if let _x = hrSeparatorVisible { _w.varintField(35, _x ? 1 : 0) }
-        if let _x = hcSeparatorVisible { _w.varintField(36, _x ? 1 : 0) }
-        if let _x = footerSeparatorVisible { _w.varintField(37, _x ? 1 : 0) }
-        if let _x = tableBorderVisible { _w.varintField(38, _x ? 1 : 0) }
-        if let _x = tableHeaderBorderVisible { _w.varintField(39, _x ? 1 : 0) }
-        if let _x = tableHcDividerVisible { _w.varintField(42, _x ? 1 : 0) }
-        if let _x = tableHrDividerVisible { _w.varintField(43, _x ? 1 : 0) }
-        if let _x = tableFooterDividerVisible { _w.varintField(44, _x ? 1 : 0) }
-        if let _x = obsoleteMasterFontSize { _w.varintField(40, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = masterFontFamily { _w.stringField(41, _x) }
-        if let _x = writingDirection { _w.varintField(45, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = headerRowSeparatorStroke { _w.bytesField(46, _x.encoded()) }
-        if let _x = headerRowBorderStroke { _w.bytesField(47, _x.encoded()) }
-        if let _x = headerRowHorizontalStroke { _w.bytesField(48, _x.encoded()) }
-        if let _x = headerRowVerticalStroke { _w.bytesField(49, _x.encoded()) }
-        if let _x = headerColumnBorderStroke { _w.bytesField(50, _x.encoded()) }
-        if let _x = headerColumnSeparatorStroke { _w.bytesField(51, _x.encoded()) }
-        if let _x = headerColumnHorizontalStroke { _w.bytesField(52, _x.encoded()) }
-        if let _x = headerColumnVerticalStroke { _w.bytesField(53, _x.encoded()) }
-        if let _x = footerRowSeparatorStroke { _w.bytesField(54, _x.encoded()) }
-        if let _x = footerRowBorderStroke { _w.bytesField(55, _x.encoded()) }
-        if let _x = footerRowHorizontalStroke { _w.bytesField(56, _x.encoded()) }
-        if let _x = footerRowVerticalStroke { _w.bytesField(57, _x.encoded()) }
-        if let _x = tableBodyHorizontalBorderStroke { _w.bytesField(58, _x.encoded()) }
-        if let _x = tableBodyVerticalBorderStroke { _w.bytesField(59, _x.encoded()) }
-        if let _x = tableBodyHorizontalStroke { _w.bytesField(60, _x.encoded()) }
-        if let _x = tableBodyVerticalStroke { _w.bytesField(61, _x.encoded()) }
-        if let _x = categoryLevel1TopStroke { _w.bytesField(62, _x.encoded()) }
-        if let _x = categoryLevel2TopStroke { _w.bytesField(63, _x.encoded()) }
-        if let _x = categoryLevel3TopStroke { _w.bytesField(64, _x.encoded()) }
-        if let _x = categoryLevel4TopStroke { _w.bytesField(65, _x.encoded()) }
-        if let _x = categoryLevel5TopStroke { _w.bytesField(66, _x.encoded()) }
-        if let _x = categoryLevel1BottomStroke { _w.bytesField(67, _x.encoded()) }
-        if let _x = categoryLevel2BottomStroke { _w.bytesField(68, _x.encoded()) }
-        if let _x = categoryLevel3BottomStroke { _w.bytesField(69, _x.encoded()) }
-        if let _x = categoryLevel4BottomStroke { _w.bytesField(70, _x.encoded()) }
-        if let _x = categoryLevel5BottomStroke { _w.bytesField(71, _x.encoded()) }
-        if let _x = categoryLevel1InteriorStroke { _w.bytesField(72, _x.encoded()) }
-        if let _x = categoryLevel2InteriorStroke { _w.bytesField(73, _x.encoded()) }
-        if let _x = categoryLevel3InteriorStroke { _w.bytesField(74, _x.encoded()) }
-        if let _x = categoryLevel4InteriorStroke { _w.bytesField(75, _x.encoded()) }
-        if let _x = categoryLevel5InteriorStroke { _w.bytesField(76, _x.encoded()) }
-        if let _x = categoryLevel1LabelSeparatorStroke { _w.bytesField(77, _x.encoded()) }
-        if let _x = categoryLevel2LabelSeparatorStroke { _w.bytesField(78, _x.encoded()) }
-        if let _x = categoryLevel3LabelSeparatorStroke { _w.bytesField(79, _x.encoded()) }
-        if let _x = categoryLevel4LabelSeparatorStroke { _w.bytesField(80, _x.encoded()) }
-        if let _x = categoryLevel5LabelSeparatorStroke { _w.bytesField(81, _x.encoded()) }
-        if let _x = tableBodyPivotGroupHorizontalStroke { _w.bytesField(82, _x.encoded()) }
-        if let _x = tableBodyPivotGroupVerticalStroke { _w.bytesField(83, _x.encoded()) }
-        if let _x = tableBodyPivotDeemphasisHorizontalStroke { _w.bytesField(84, _x.encoded()) }
-        if let _x = tableBodyPivotEmphasisVerticalStroke { _w.bytesField(85, _x.encoded()) }
-        if let _x = headerColumnPivotGroupHorizontalStroke { _w.bytesField(86, _x.encoded()) }
-        if let _x = headerColumnPivotGroupDeemphasisStroke { _w.bytesField(87, _x.encoded()) }
-        if let _x = headerColumnPivotSeparatorStroke { _w.bytesField(88, _x.encoded()) }
-        if let _x = headerRowPivotGroupVerticalStroke { _w.bytesField(89, _x.encoded()) }
-        if let _x = headerRowPivotGroupDeemphasisStroke { _w.bytesField(90, _x.encoded()) }
-        if let _x = headerRowPivotTitleStroke { _w.bytesField(91, _x.encoded()) }
-        if let _x = footerRowPivotGroupVerticalStroke { _w.bytesField(92, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var bandedRows: Bool? { get { self[0] } set { self[0] = newValue } }
+    var bandedFill: TSD_FillArchive? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var behavesLikeSpreadsheet: Bool? { get { self[2] } set { self[2] = newValue } }
+    var autoResize: Bool? { get { self[3] } set { self[3] = newValue } }
+    var deprecatedHeaderRowSeparatorStroke: TST_Deprecated_TableStrokeArchive? { get { self[message: 4] } set { self[message: 4] = newValue } }
+    var deprecatedHeaderRowBorderStroke: TST_Deprecated_TableStrokeArchive? { get { self[message: 5] } set { self[message: 5] = newValue } }
+    var deprecatedHeaderRowHorizontalStroke: TST_Deprecated_TableStrokeArchive? { get { self[message: 6] } set { self[message: 6] = newValue } }
+    var deprecatedHeaderRowVerticalStroke: TST_Deprecated_TableStrokeArchive? { get { self[message: 7] } set { self[message: 7] = newValue } }
+    var deprecatedHeaderColumnBorderStroke: TST_Deprecated_TableStrokeArchive? { get { self[message: 8] } set { self[message: 8] = newValue } }
+    var deprecatedHeaderColumnSeparatorStroke: TST_Deprecated_TableStrokeArchive? { get { self[message: 9] } set { self[message: 9] = newValue } }
+    var deprecatedHeaderColumnHorizontalStroke: TST_Deprecated_TableStrokeArchive? { get { self[message: 10] } set { self[message: 10] = newValue } }
+    var deprecatedHeaderColumnVerticalStroke: TST_Deprecated_TableStrokeArchive? { get { self[message: 11] } set { self[message: 11] = newValue } }
+    var deprecatedFooterRowSeparatorStroke: TST_Deprecated_TableStrokeArchive? { get { self[message: 12] } set { self[message: 12] = newValue } }
+    var deprecatedFooterRowBorderStroke: TST_Deprecated_TableStrokeArchive? { get { self[message: 13] } set { self[message: 13] = newValue } }
+    var deprecatedFooterRowHorizontalStroke: TST_Deprecated_TableStrokeArchive? { get { self[message: 14] } set { self[message: 14] = newValue } }
+    var deprecatedFooterRowVerticalStroke: TST_Deprecated_TableStrokeArchive? { get { self[message: 15] } set { self[message: 15] = newValue } }
+    var deprecatedTableBodyHorizontalBorderStroke: TST_Deprecated_TableStrokeArchive? { get { self[message: 16] } set { self[message: 16] = newValue } }
+    var deprecatedTableBodyVerticalBorderStroke: TST_Deprecated_TableStrokeArchive? { get { self[message: 17] } set { self[message: 17] = newValue } }
+    var deprecatedTableBodyHorizontalStroke: TST_Deprecated_TableStrokeArchive? { get { self[message: 18] } set { self[message: 18] = newValue } }
+    var deprecatedTableBodyVerticalStroke: TST_Deprecated_TableStrokeArchive? { get { self[message: 19] } set { self[message: 19] = newValue } }
+    var strokePresetList: TST_StrokePresetListArchive? { get { self[message: 20] } set { self[message: 20] = newValue } }
+    var vStrokesVisible: Bool? { get { self[21] } set { self[21] = newValue } }
+    var hStrokesVisible: Bool? { get { self[22] } set { self[22] = newValue } }
+    var hrSeparatorVisible: Bool? { get { self[23] } set { self[23] = newValue } }
+    var hcSeparatorVisible: Bool? { get { self[24] } set { self[24] = newValue } }
+    var footerSeparatorVisible: Bool? { get { self[25] } set { self[25] = newValue } }
+    var tableBorderVisible: Bool? { get { self[26] } set { self[26] = newValue } }
+    var tableHeaderBorderVisible: Bool? { get { self[27] } set { self[27] = newValue } }
+    var tableHcDividerVisible: Bool? { get { self[28] } set { self[28] = newValue } }
+    var tableHrDividerVisible: Bool? { get { self[29] } set { self[29] = newValue } }
+    var tableFooterDividerVisible: Bool? { get { self[30] } set { self[30] = newValue } }
+    var obsoleteMasterFontSize: Int32? { get { self[31] } set { self[31] = newValue } }
+    var masterFontFamily: String? { get { self[32] } set { self[32] = newValue } }
+    var writingDirection: Int32? { get { self[33] } set { self[33] = newValue } }
+    var headerRowSeparatorStroke: TSD_StrokeArchive? { get { self[message: 34] } set { self[message: 34] = newValue } }
+    var headerRowBorderStroke: TSD_StrokeArchive? { get { self[message: 35] } set { self[message: 35] = newValue } }
+    var headerRowHorizontalStroke: TSD_StrokeArchive? { get { self[message: 36] } set { self[message: 36] = newValue } }
+    var headerRowVerticalStroke: TSD_StrokeArchive? { get { self[message: 37] } set { self[message: 37] = newValue } }
+    var headerColumnBorderStroke: TSD_StrokeArchive? { get { self[message: 38] } set { self[message: 38] = newValue } }
+    var headerColumnSeparatorStroke: TSD_StrokeArchive? { get { self[message: 39] } set { self[message: 39] = newValue } }
+    var headerColumnHorizontalStroke: TSD_StrokeArchive? { get { self[message: 40] } set { self[message: 40] = newValue } }
+    var headerColumnVerticalStroke: TSD_StrokeArchive? { get { self[message: 41] } set { self[message: 41] = newValue } }
+    var footerRowSeparatorStroke: TSD_StrokeArchive? { get { self[message: 42] } set { self[message: 42] = newValue } }
+    var footerRowBorderStroke: TSD_StrokeArchive? { get { self[message: 43] } set { self[message: 43] = newValue } }
+    var footerRowHorizontalStroke: TSD_StrokeArchive? { get { self[message: 44] } set { self[message: 44] = newValue } }
+    var footerRowVerticalStroke: TSD_StrokeArchive? { get { self[message: 45] } set { self[message: 45] = newValue } }
+    var tableBodyHorizontalBorderStroke: TSD_StrokeArchive? { get { self[message: 46] } set { self[message: 46] = newValue } }
+    var tableBodyVerticalBorderStroke: TSD_StrokeArchive? { get { self[message: 47] } set { self[message: 47] = newValue } }
+    var tableBodyHorizontalStroke: TSD_StrokeArchive? { get { self[message: 48] } set { self[message: 48] = newValue } }
+    var tableBodyVerticalStroke: TSD_StrokeArchive? { get { self[message: 49] } set { self[message: 49] = newValue } }
+    var categoryLevel1TopStroke: TSD_StrokeArchive? { get { self[message: 50] } set { self[message: 50] = newValue } }
+    var categoryLevel2TopStroke: TSD_StrokeArchive? { get { self[message: 51] } set { self[message: 51] = newValue } }
+    var categoryLevel3TopStroke: TSD_StrokeArchive? { get { self[message: 52] } set { self[message: 52] = newValue } }
+    var categoryLevel4TopStroke: TSD_StrokeArchive? { get { self[message: 53] } set { self[message: 53] = newValue } }
+    var categoryLevel5TopStroke: TSD_StrokeArchive? { get { self[message: 54] } set { self[message: 54] = newValue } }
+    var categoryLevel1BottomStroke: TSD_StrokeArchive? { get { self[message: 55] } set { self[message: 55] = newValue } }
+    var categoryLevel2BottomStroke: TSD_StrokeArchive? { get { self[message: 56] } set { self[message: 56] = newValue } }
+    var categoryLevel3BottomStroke: TSD_StrokeArchive? { get { self[message: 57] } set { self[message: 57] = newValue } }
+    var categoryLevel4BottomStroke: TSD_StrokeArchive? { get { self[message: 58] } set { self[message: 58] = newValue } }
+    var categoryLevel5BottomStroke: TSD_StrokeArchive? { get { self[message: 59] } set { self[message: 59] = newValue } }
+    var categoryLevel1InteriorStroke: TSD_StrokeArchive? { get { self[message: 60] } set { self[message: 60] = newValue } }
+    var categoryLevel2InteriorStroke: TSD_StrokeArchive? { get { self[message: 61] } set { self[message: 61] = newValue } }
+    var categoryLevel3InteriorStroke: TSD_StrokeArchive? { get { self[message: 62] } set { self[message: 62] = newValue } }
+    var categoryLevel4InteriorStroke: TSD_StrokeArchive? { get { self[message: 63] } set { self[message: 63] = newValue } }
+    var categoryLevel5InteriorStroke: TSD_StrokeArchive? { get { self[message: 64] } set { self[message: 64] = newValue } }
+    var categoryLevel1LabelSeparatorStroke: TSD_StrokeArchive? { get { self[message: 65] } set { self[message: 65] = newValue } }
+    var categoryLevel2LabelSeparatorStroke: TSD_StrokeArchive? { get { self[message: 66] } set { self[message: 66] = newValue } }
+    var categoryLevel3LabelSeparatorStroke: TSD_StrokeArchive? { get { self[message: 67] } set { self[message: 67] = newValue } }
+    var categoryLevel4LabelSeparatorStroke: TSD_StrokeArchive? { get { self[message: 68] } set { self[message: 68] = newValue } }
+    var categoryLevel5LabelSeparatorStroke: TSD_StrokeArchive? { get { self[message: 69] } set { self[message: 69] = newValue } }
+    var tableBodyPivotGroupHorizontalStroke: TSD_StrokeArchive? { get { self[message: 70] } set { self[message: 70] = newValue } }
+    var tableBodyPivotGroupVerticalStroke: TSD_StrokeArchive? { get { self[message: 71] } set { self[message: 71] = newValue } }
+    var tableBodyPivotDeemphasisHorizontalStroke: TSD_StrokeArchive? { get { self[message: 72] } set { self[message: 72] = newValue } }
+    var tableBodyPivotEmphasisVerticalStroke: TSD_StrokeArchive? { get { self[message: 73] } set { self[message: 73] = newValue } }
+    var headerColumnPivotGroupHorizontalStroke: TSD_StrokeArchive? { get { self[message: 74] } set { self[message: 74] = newValue } }
+    var headerColumnPivotGroupDeemphasisStroke: TSD_StrokeArchive? { get { self[message: 75] } set { self[message: 75] = newValue } }
+    var headerColumnPivotSeparatorStroke: TSD_StrokeArchive? { get { self[message: 76] } set { self[message: 76] = newValue } }
+    var headerRowPivotGroupVerticalStroke: TSD_StrokeArchive? { get { self[message: 77] } set { self[message: 77] = newValue } }
+    var headerRowPivotGroupDeemphasisStroke: TSD_StrokeArchive? { get { self[message: 78] } set { self[message: 78] = newValue } }
+    var headerRowPivotTitleStroke: TSD_StrokeArchive? { get { self[message: 79] } set { self[message: 79] = newValue } }
+    var footerRowPivotGroupVerticalStroke: TSD_StrokeArchive? { get { self[message: 80] } set { self[message: 80] = newValue } }
 }
 
 /// Generated wire model for `TST.TableStylePresetArchive`.
 final class TST_TableStylePresetArchive: IWAMessage {
-    var index: Int32?
-    var image: TSP_Reference?
-    var styleNetwork: TSP_Reference?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TST.TableStylePresetArchive", [
+        .optional(1, .int32), .optional(2, TSP_Reference.self), .optional(3, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { index = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { image = _v }
-        case 3:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { styleNetwork = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = index { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = image { _w.bytesField(2, _x.encoded()) }
-        if let _x = styleNetwork { _w.bytesField(3, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var index: Int32? { get { self[0] } set { self[0] = newValue } }
+    var image: TSP_Reference? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var styleNetwork: TSP_Reference? { get { self[message: 2] } set { self[message: 2] = newValue } }
 }
 
 /// Generated wire model for `TST.TableStrokePresetArchive`.
 final class TST_TableStrokePresetArchive: IWAMessage {
-    var index: Int32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TST.TableStrokePresetArchive", [
+        .optional(1, .int32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { index = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = index { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var index: Int32? { get { self[0] } set { self[0] = newValue } }
 }
 
 /// Generated wire model for `TST.ThemePresetsArchive`.
 final class TST_ThemePresetsArchive: IWAMessage {
-    var tableStylePresets: [TSP_Reference] = []
-    var tableCellStrokePresets: [TSP_Reference] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TST.ThemePresetsArchive", [
+        .repeated(1, TSP_Reference.self), .repeated(2, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { tableStylePresets.append(_v) }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { tableCellStrokePresets.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in tableStylePresets { _w.bytesField(1, _x.encoded()) }
-        for _x in tableCellStrokePresets { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var tableStylePresets: [TSP_Reference] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(tableStylePresets value: TSP_Reference) { append(value, toMessages: 0) }
+    var tableCellStrokePresets: [TSP_Reference] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(tableCellStrokePresets value: TSP_Reference) { append(value, toMessages: 1) }
 }
 
 /// Registers this file's archives into the reflective catalog.
-func registerIWA_TSTStylePropertyArchiving(_ into: inout [(name: String, decode: (ProtobufMessage) -> IWAMessage)]) {
-    into.append(("TST.Deprecated_TableStrokeArchive", { TST_Deprecated_TableStrokeArchive($0) as IWAMessage }))
-    into.append(("TST.CellStylePropertiesArchive", { TST_CellStylePropertiesArchive($0) as IWAMessage }))
-    into.append(("TST.Deprecated_StrokePresetDataArchive", { TST_Deprecated_StrokePresetDataArchive($0) as IWAMessage }))
-    into.append(("TST.StrokePresetDataArchive", { TST_StrokePresetDataArchive($0) as IWAMessage }))
-    into.append(("TST.StrokePresetListArchive", { TST_StrokePresetListArchive($0) as IWAMessage }))
-    into.append(("TST.TableStylePropertiesArchive", { TST_TableStylePropertiesArchive($0) as IWAMessage }))
-    into.append(("TST.TableStylePresetArchive", { TST_TableStylePresetArchive($0) as IWAMessage }))
-    into.append(("TST.TableStrokePresetArchive", { TST_TableStrokePresetArchive($0) as IWAMessage }))
-    into.append(("TST.ThemePresetsArchive", { TST_ThemePresetsArchive($0) as IWAMessage }))
+func registerIWA_TSTStylePropertyArchiving(_ into: inout [any IWAMessage.Type]) {
+    into += [
+        TST_Deprecated_TableStrokeArchive.self, TST_CellStylePropertiesArchive.self,
+        TST_Deprecated_StrokePresetDataArchive.self, TST_StrokePresetDataArchive.self, TST_StrokePresetListArchive.self,
+        TST_TableStylePropertiesArchive.self, TST_TableStylePresetArchive.self, TST_TableStrokePresetArchive.self,
+        TST_ThemePresetsArchive.self,
+    ]
 }
@@ -5,4722 +5,1655 @@ import SwiftTextIWA
 
 /// Generated wire model for `TSWP.SelectionArchive`.
 final class TSWP_SelectionArchive: IWAMessage {
-    var deprecatedType: Int32?
-    var visualDefinitionRange: TSP_Range?
-    var styleinsertionbehavior: Int32?
-    var caretaffinity: Int32?
-    var smartFieldRange: TSP_Range?
-    var leadingEdge: Bool?
-    var leadingCharIndex: UInt32?
-    var type: Int32?
-    var ranges: [TSP_Range] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.SelectionArchive", [
+        .optional(1, .int32), .optional(2, TSP_Range.self), .optional(3, .int32), .optional(4, .int32),
+        .optional(5, TSP_Range.self), .optional(6, .bool), .optional(7, .uint32), .optional(8, .int32),
+        .repeated(9, TSP_Range.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 9)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { deprecatedType = _v }
-        case 2:
-            var _v: TSP_Range?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Range(ProtobufMessage(_b)) }
-            if let _v { visualDefinitionRange = _v }
-        case 3:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { styleinsertionbehavior = _v }
-        case 4:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { caretaffinity = _v }
-        case 5:
-            var _v: TSP_Range?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Range(ProtobufMessage(_b)) }
-            if let _v { smartFieldRange = _v }
-        case 6:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { leadingEdge = _v }
-        case 7:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { leadingCharIndex = _v }
-        case 8:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { type = _v }
-        case 9:
-            var _v: TSP_Range?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Range(ProtobufMessage(_b)) }
-            if let _v { ranges.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = deprecatedType { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = visualDefinitionRange { _w.bytesField(2, _x.encoded()) }
-        if let _x = styleinsertionbehavior { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = caretaffinity { _w.varintField(4, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = smartFieldRange { _w.bytesField(5, _x.encoded()) }
-        if let _x = leadingEdge { _w.varintField(6, _x ? 1 : 0) }
-        if let _x = leadingCharIndex { _w.varintField(7, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = type { _w.varintField(8, UInt64(truncatingIfNeeded: _x)) }
-        for _x in ranges { _w.bytesField(9, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var deprecatedType: Int32? { get { self[0] } set { self[0] = newValue } }
+    var visualDefinitionRange: TSP_Range? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var styleinsertionbehavior: Int32? { get { self[2] } set { self[2] = newValue } }
+    var caretaffinity: Int32? { get { self[3] } set { self[3] = newValue } }
+    var smartFieldRange: TSP_Range? { get { self[message: 4] } set { self[message: 4] = newValue } }
+    var leadingEdge: Bool? { get { self[5] } set { self[5] = newValue } }
+    var leadingCharIndex: UInt32? { get { self[6] } set { self[6] = newValue } }
+    var type: Int32? { get { self[7] } set { self[7] = newValue } }
+    var ranges: [TSP_Range] { get { self[messages: 8] } set { self[messages: 8] = newValue } }
+    func append(ranges value: TSP_Range) { append(value, toMessages: 8) }
 }
 
 /// Generated wire model for `TSWP.ObjectAttributeTable`.
 final class TSWP_ObjectAttributeTable: IWAMessage {
-    var entries: [TSWP_ObjectAttributeTable_ObjectAttribute] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.ObjectAttributeTable", [
+        .repeated(1, TSWP_ObjectAttributeTable_ObjectAttribute.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSWP_ObjectAttributeTable_ObjectAttribute?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_ObjectAttributeTable_ObjectAttribute(ProtobufMessage(_b)) }
-            if let _v { entries.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in entries { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var entries: [TSWP_ObjectAttributeTable_ObjectAttribute] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(entries value: TSWP_ObjectAttributeTable_ObjectAttribute) { append(value, toMessages: 0) }
 }
 
 /// Generated wire model for `TSWP.ObjectAttributeTable.ObjectAttribute`.
 final class TSWP_ObjectAttributeTable_ObjectAttribute: IWAMessage {
-    var characterIndex: UInt32?
-    var object: TSP_Reference?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.ObjectAttributeTable.ObjectAttribute", [
+        .optional(1, .uint32), .optional(2, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { characterIndex = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { object = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = characterIndex { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = object { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var characterIndex: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var object: TSP_Reference? { get { self[message: 1] } set { self[message: 1] = newValue } }
 }
 
 /// Generated wire model for `TSWP.StringAttributeTable`.
 final class TSWP_StringAttributeTable: IWAMessage {
-    var entries: [TSWP_StringAttributeTable_StringAttribute] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.StringAttributeTable", [
+        .repeated(1, TSWP_StringAttributeTable_StringAttribute.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSWP_StringAttributeTable_StringAttribute?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_StringAttributeTable_StringAttribute(ProtobufMessage(_b)) }
-            if let _v { entries.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in entries { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var entries: [TSWP_StringAttributeTable_StringAttribute] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(entries value: TSWP_StringAttributeTable_StringAttribute) { append(value, toMessages: 0) }
 }
 
 /// Generated wire model for `TSWP.StringAttributeTable.StringAttribute`.
 final class TSWP_StringAttributeTable_StringAttribute: IWAMessage {
-    var characterIndex: UInt32?
-    var object: String?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.StringAttributeTable.StringAttribute", [
+        .optional(1, .uint32), .optional(2, .string),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { characterIndex = _v }
-        case 2:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { object = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = characterIndex { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = object { _w.stringField(2, _x) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var characterIndex: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var object: String? { get { self[1] } set { self[1] = newValue } }
 }
 
 /// Generated wire model for `TSWP.ParaDataAttributeTable`.
 final class TSWP_ParaDataAttributeTable: IWAMessage {
-    var entries: [TSWP_ParaDataAttributeTable_ParaDataAttribute] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.ParaDataAttributeTable", [
+        .repeated(1, TSWP_ParaDataAttributeTable_ParaDataAttribute.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSWP_ParaDataAttributeTable_ParaDataAttribute?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_ParaDataAttributeTable_ParaDataAttribute(ProtobufMessage(_b)) }
-            if let _v { entries.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in entries { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var entries: [TSWP_ParaDataAttributeTable_ParaDataAttribute] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(entries value: TSWP_ParaDataAttributeTable_ParaDataAttribute) { append(value, toMessages: 0) }
 }
 
 /// Generated wire model for `TSWP.ParaDataAttributeTable.ParaDataAttribute`.
 final class TSWP_ParaDataAttributeTable_ParaDataAttribute: IWAMessage {
-    var characterIndex: UInt32?
-    var first: UInt32?
-    var second: UInt32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.ParaDataAttributeTable.ParaDataAttribute", [
+        .optional(1, .uint32), .optional(2, .uint32), .optional(3, .uint32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { characterIndex = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { first = _v }
-        case 3:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { second = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = characterIndex { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = first { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = second { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var characterIndex: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var first: UInt32? { get { self[1] } set { self[1] = newValue } }
+    var second: UInt32? { get { self[2] } set { self[2] = newValue } }
 }
 
 /// Generated wire model for `TSWP.OverlappingFieldAttributeTable`.
 final class TSWP_OverlappingFieldAttributeTable: IWAMessage {
-    var entries: [TSWP_OverlappingFieldAttributeTable_OverlappingFieldAttribute] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.OverlappingFieldAttributeTable", [
+        .repeated(1, TSWP_OverlappingFieldAttributeTable_OverlappingFieldAttribute.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSWP_OverlappingFieldAttributeTable_OverlappingFieldAttribute?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_OverlappingFieldAttributeTable_OverlappingFieldAttribute(ProtobufMessage(_b)) }
-            if let _v { entries.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in entries { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var entries: [TSWP_OverlappingFieldAttributeTable_OverlappingFieldAttribute] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(entries value: TSWP_OverlappingFieldAttributeTable_OverlappingFieldAttribute) { append(value, toMessages: 0) }
 }
 
 /// Generated wire model for `TSWP.OverlappingFieldAttributeTable.OverlappingFieldAttribute`.
 final class TSWP_OverlappingFieldAttributeTable_OverlappingFieldAttribute: IWAMessage {
-    var range: TSP_Range?
-    var field: TSP_Reference?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.OverlappingFieldAttributeTable.OverlappingFieldAttribute", [
+        .optional(1, TSP_Range.self), .optional(2, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Range?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Range(ProtobufMessage(_b)) }
-            if let _v { range = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { field = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = range { _w.bytesField(1, _x.encoded()) }
-        if let _x = field { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var range: TSP_Range? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var field: TSP_Reference? { get { self[message: 1] } set { self[message: 1] = newValue } }
 }
 
 /// Generated wire model for `TSWP.StorageArchive`.
 final class TSWP_StorageArchive: IWAMessage {
-    var kind: Int32?
-    var styleSheet: TSP_Reference?
-    var text: [String] = []
-    var hasItext: Bool?
-    var inDocument: Bool?
-    var tableParaStyle: TSWP_ObjectAttributeTable?
-    var tableParaData: TSWP_ParaDataAttributeTable?
-    var tableListStyle: TSWP_ObjectAttributeTable?
-    var tableCharStyle: TSWP_ObjectAttributeTable?
-    var tableAttachment: TSWP_ObjectAttributeTable?
-    var tableSmartfield: TSWP_ObjectAttributeTable?
-    var tableLayoutStyle: TSWP_ObjectAttributeTable?
-    var tableParaStarts: TSWP_ParaDataAttributeTable?
-    var tableBookmark: TSWP_ObjectAttributeTable?
-    var tableFootnote: TSWP_ObjectAttributeTable?
-    var tableSection: TSWP_ObjectAttributeTable?
-    var tableRubyfield: TSWP_ObjectAttributeTable?
-    var tableLanguage: TSWP_StringAttributeTable?
-    var tableDictation: TSWP_StringAttributeTable?
-    var tableInsertion: TSWP_ObjectAttributeTable?
-    var tableDeletion: TSWP_ObjectAttributeTable?
-    var tableHighlight: TSWP_ObjectAttributeTable?
-    var tableParaBidi: TSWP_ParaDataAttributeTable?
-    var tableOverlappingHighlight: TSWP_OverlappingFieldAttributeTable?
-    var tablePencilAnnotation: TSWP_OverlappingFieldAttributeTable?
-    var tableTatechuyoko: TSWP_ObjectAttributeTable?
-    var tableDropCapStyle: TSWP_ObjectAttributeTable?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { kind = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { styleSheet = _v }
-        case 3:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { text.append(_v) }
-        case 4:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { hasItext = _v }
-        case 10:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { inDocument = _v }
-        case 5:
-            var _v: TSWP_ObjectAttributeTable?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_ObjectAttributeTable(ProtobufMessage(_b)) }
-            if let _v { tableParaStyle = _v }
-        case 6:
-            var _v: TSWP_ParaDataAttributeTable?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_ParaDataAttributeTable(ProtobufMessage(_b)) }
-            if let _v { tableParaData = _v }
-        case 7:
-            var _v: TSWP_ObjectAttributeTable?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_ObjectAttributeTable(ProtobufMessage(_b)) }
-            if let _v { tableListStyle = _v }
-        case 8:
-            var _v: TSWP_ObjectAttributeTable?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_ObjectAttributeTable(ProtobufMessage(_b)) }
-            if let _v { tableCharStyle = _v }
-        case 9:
-            var _v: TSWP_ObjectAttributeTable?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_ObjectAttributeTable(ProtobufMessage(_b)) }
-            if let _v { tableAttachment = _v }
-        case 11:
-            var _v: TSWP_ObjectAttributeTable?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_ObjectAttributeTable(ProtobufMessage(_b)) }
-            if let _v { tableSmartfield = _v }
-        case 12:
-            var _v: TSWP_ObjectAttributeTable?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_ObjectAttributeTable(ProtobufMessage(_b)) }
-            if let _v { tableLayoutStyle = _v }
-        case 14:
-            var _v: TSWP_ParaDataAttributeTable?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_ParaDataAttributeTable(ProtobufMessage(_b)) }
-            if let _v { tableParaStarts = _v }
-        case 15:
-            var _v: TSWP_ObjectAttributeTable?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_ObjectAttributeTable(ProtobufMessage(_b)) }
-            if let _v { tableBookmark = _v }
-        case 16:
-            var _v: TSWP_ObjectAttributeTable?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_ObjectAttributeTable(ProtobufMessage(_b)) }
-            if let _v { tableFootnote = _v }
-        case 17:
-            var _v: TSWP_ObjectAttributeTable?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_ObjectAttributeTable(ProtobufMessage(_b)) }
-            if let _v { tableSection = _v }
-        case 18:
-            var _v: TSWP_ObjectAttributeTable?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_ObjectAttributeTable(ProtobufMessage(_b)) }
-            if let _v { tableRubyfield = _v }
-        case 19:
-            var _v: TSWP_StringAttributeTable?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_StringAttributeTable(ProtobufMessage(_b)) }
-            if let _v { tableLanguage = _v }
-        case 20:
-            var _v: TSWP_StringAttributeTable?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_StringAttributeTable(ProtobufMessage(_b)) }
-            if let _v { tableDictation = _v }
-        case 21:
-            var _v: TSWP_ObjectAttributeTable?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_ObjectAttributeTable(ProtobufMessage(_b)) }
-            if let _v { tableInsertion = _v }
-        case 22:
-            var _v: TSWP_ObjectAttributeTable?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_ObjectAttributeTable(ProtobufMessage(_b)) }
-            if let _v { tableDeletion = _v }
-        case 23:
-            var _v: TSWP_ObjectAttributeTable?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_ObjectAttributeTable(ProtobufMessage(_b)) }
-            if let _v { tableHighlight = _v }
-        case 24:
-            var _v: TSWP_ParaDataAttributeTable?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_ParaDataAttributeTable(ProtobufMessage(_b)) }
-            if let _v { tableParaBidi = _v }
-        case 25:
-            var _v: TSWP_OverlappingFieldAttributeTable?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_OverlappingFieldAttributeTable(ProtobufMessage(_b)) }
-            if let _v { tableOverlappingHighlight = _v }
-        case 26:
-            var _v: TSWP_OverlappingFieldAttributeTable?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_OverlappingFieldAttributeTable(ProtobufMessage(_b)) }
-            if let _v { tablePencilAnnotation = _v }
-        case 27:
-            var _v: TSWP_ObjectAttributeTable?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_ObjectAttributeTable(ProtobufMessage(_b)) }
-            if let _v { tableTatechuyoko = _v }
-        case 28:
-            var _v: TSWP_ObjectAttributeTable?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_ObjectAttributeTable(ProtobufMessage(_b)) }
-            if let _v { tableDropCapStyle = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = kind { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = styleSheet { _w.bytesField(2, _x.encoded()) }
-        for _x in text { _w.stringField(3, _x) }
-        if let _x = hasItext { _w.varintField(4, _x ? 1 : 0) }
-        if let _x = inDocument { _w.varintField(10, _x ? 1 : 0) }
-        if let _x = tableParaStyle { _w.bytesField(5, _x.encoded()) }
-        if let _x = tableParaData { _w.bytesField(6, _x.encoded()) }
-        if let _x = tableListStyle { _w.bytesField(7, _x.encoded()) }
-        if let _x = tableCharStyle { _w.bytesField(8, _x.encoded()) }
-        if let _x = tableAttachment { _w.bytesField(9, _x.encoded()) }
-        if let _x = tableSmartfield { _w.bytesField(11, _x.encoded()) }
-        if let _x = tableLayoutStyle { _w.bytesField(12, _x.encoded()) }
-        if let _x = tableParaStarts { _w.bytesField(14, _x.encoded()) }
-        if let _x = tableBookmark { _w.bytesField(15, _x.encoded()) }
-        if let _x = tableFootnote { _w.bytesField(16, _x.encoded()) }
-        if let _x = tableSection { _w.bytesField(17, _x.encoded()) }
-        if let _x = tableRubyfield { _w.bytesField(18, _x.encoded()) }
-        if let _x = tableLanguage { _w.bytesField(19, _x.encoded()) }
-        if let _x = tableDictation { _w.bytesField(20, _x.encoded()) }
-        if let _x = tableInsertion { _w.bytesField(21, _x.encoded()) }
-        if let _x = tableDeletion { _w.bytesField(22, _x.encoded()) }
-        if let _x = tableHighlight { _w.bytesField(23, _x.encoded()) }
-        if let _x = tableParaBidi { _w.bytesField(24, _x.encoded()) }
-        if let _x = tableOverlappingHighlight { _w.bytesField(25, _x.encoded()) }
-        if let _x = tablePencilAnnotation { _w.bytesField(26, _x.encoded()) }
-        if let _x = tableTatechuyoko { _w.bytesField(27, _x.encoded()) }
-        if let _x = tableDropCapStyle { _w.bytesField(28, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSWP.StorageArchive", [
+        .optional(1, .int32), .optional(2, TSP_Reference.self), .repeated(3, .string), .optional(4, .bool),
+        .optional(10, .bool), .optional(5, TSWP_ObjectAttributeTable.self),
+        .optional(6, TSWP_ParaDataAttributeTable.self), .optional(7, TSWP_ObjectAttributeTable.self),
+        .optional(8, TSWP_ObjectAttributeTable.self), .optional(9, TSWP_ObjectAttributeTable.self),
+        .optional(11, TSWP_ObjectAttributeTable.self), .optional(12, TSWP_ObjectAttributeTable.self),
+        .optional(14, TSWP_ParaDataAttributeTable.self), .optional(15, TSWP_ObjectAttributeTable.self),
+        .optional(16, TSWP_ObjectAttributeTable.self), .optional(17, TSWP_ObjectAttributeTable.self),
+        .optional(18, TSWP_ObjectAttributeTable.self), .optional(19, TSWP_StringAttributeTable.self),
+        .optional(20, TSWP_StringAttributeTable.self), .optional(21, TSWP_ObjectAttributeTable.self),
+        .optional(22, TSWP_ObjectAttributeTable.self), .optional(23, TSWP_ObjectAttributeTable.self),
+        .optional(24, TSWP_ParaDataAttributeTable.self), .optional(25, TSWP_OverlappingFieldAttributeTable.self),
+        .optional(26, TSWP_OverlappingFieldAttributeTable.self), .optional(27, TSWP_ObjectAttributeTable.self),
+        .optional(28, TSWP_ObjectAttributeTable.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 27)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var kind: Int32? { get { self[0] } set { self[0] = newValue } }
+    var styleSheet: TSP_Reference? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var text: [String] { get { self[all: 2] } set { self[all: 2] = newValue } }
+    func append(text value: String) { append(value, toAll: 2) }
+    var hasItext: Bool? { get { self[3] } set { self[3] = newValue } }
+    var inDocument: Bool? { get { self[4] } set { self[4] = newValue } }
+    var tableParaStyle: TSWP_ObjectAttributeTable? { get { self[message: 5] } set { self[message: 5] = newValue } }
+    var tableParaData: TSWP_ParaDataAttributeTable? { get { self[message: 6] } set { self[message: 6] = newValue } }
+    var tableListStyle: TSWP_ObjectAttributeTable? { get { self[message: 7] } set { self[message: 7] = newValue } }
+    var tableCharStyle: TSWP_ObjectAttributeTable? { get { self[message: 8] } set { self[message: 8] = newValue } }
+    var tableAttachment: TSWP_ObjectAttributeTable? { get { self[message: 9] } set { self[message: 9] = newValue } }
+    var tableSmartfield: TSWP_ObjectAttributeTable? { get { self[message: 10] } set { self[message: 10] = newValue } }
+    var tableLayoutStyle: TSWP_ObjectAttributeTable? { get { self[message: 11] } set { self[message: 11] = newValue } }
+    var tableParaStarts: TSWP_ParaDataAttributeTable? { get { self[message: 12] } set { self[message: 12] = newValue } }
+    var tableBookmark: TSWP_ObjectAttributeTable? { get { self[message: 13] } set { self[message: 13] = newValue } }
+    var tableFootnote: TSWP_ObjectAttributeTable? { get { self[message: 14] } set { self[message: 14] = newValue } }
+    var tableSection: TSWP_ObjectAttributeTable? { get { self[message: 15] } set { self[message: 15] = newValue } }
+    var tableRubyfield: TSWP_ObjectAttributeTable? { get { self[message: 16] } set { self[message: 16] = newValue } }
+    var tableLanguage: TSWP_StringAttributeTable? { get { self[message: 17] } set { self[message: 17] = newValue } }
+    var tableDictation: TSWP_StringAttributeTable? { get { self[message: 18] } set { self[message: 18] = newValue } }
+    var tableInsertion: TSWP_ObjectAttributeTable? { get { self[message: 19] } set { self[message: 19] = newValue } }
+    var tableDeletion: TSWP_ObjectAttributeTable? { get { self[message: 20] } set { self[message: 20] = newValue } }
+    var tableHighlight: TSWP_ObjectAttributeTable? { get { self[message: 21] } set { self[message: 21] = newValue } }
+    var tableParaBidi: TSWP_ParaDataAttributeTable? { get { self[message: 22] } set { self[message: 22] = newValue } }
+    var tableOverlappingHighlight: TSWP_OverlappingFieldAttributeTable? { get { self[message: 23] } set { self[message: 23] = newValue } }
+    var tablePencilAnnotation: TSWP_OverlappingFieldAttributeTable? { get { self[message: 24] } set { self[message: 24] = newValue } }
+    var tableTatechuyoko: TSWP_ObjectAttributeTable? { get { self[message: 25] } set { self[message: 25] = newValue } }
+    var tableDropCapStyle: TSWP_ObjectAttributeTable? { get { self[message: 26] } set { self[message: 26] = newValue } }
 }
 
 /// Generated wire model for `TSWP.HighlightArchive`.
 final class TSWP_HighlightArchive: IWAMessage {
-    var commentstorage: TSP_Reference?
-    var textAttributeUuidString: String?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.HighlightArchive", [
+        .optional(1, TSP_Reference.self), .optional(2, .string),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { commentstorage = _v }
-        case 2:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { textAttributeUuidString = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = commentstorage { _w.bytesField(1, _x.encoded()) }
-        if let _x = textAttributeUuidString { _w.stringField(2, _x) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var commentstorage: TSP_Reference? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var textAttributeUuidString: String? { get { self[1] } set { self[1] = newValue } }
 }
 
 /// Generated wire model for `TSWP.PencilAnnotationArchive`.
 final class TSWP_PencilAnnotationArchive: IWAMessage {
-    var pencilAnnotationStorage: TSP_Reference?
-    var textAttributeUuidString: String?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.PencilAnnotationArchive", [
+        .optional(1, TSP_Reference.self), .optional(2, .string),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { pencilAnnotationStorage = _v }
-        case 2:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { textAttributeUuidString = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = pencilAnnotationStorage { _w.bytesField(1, _x.encoded()) }
-        if let _x = textAttributeUuidString { _w.stringField(2, _x) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var pencilAnnotationStorage: TSP_Reference? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var textAttributeUuidString: String? { get { self[1] } set { self[1] = newValue } }
 }
 
 /// Generated wire model for `TSWP.FontFeatureArchive`.
 final class TSWP_FontFeatureArchive: IWAMessage {
-    var featureType: UInt32?
-    var featureSelector: UInt32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.FontFeatureArchive", [
+        .optional(1, .uint32), .optional(2, .uint32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { featureType = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { featureSelector = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = featureType { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = featureSelector { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var featureType: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var featureSelector: UInt32? { get { self[1] } set { self[1] = newValue } }
 }
 
 /// Generated wire model for `TSWP.CharacterStylePropertiesArchive`.
 final class TSWP_CharacterStylePropertiesArchive: IWAMessage {
-    var bold: Bool?
-    var italic: Bool?
-    var fontSize: Float?
-    var fontNameNull: Bool?
-    var fontName: String?
-    var fontColorNull: Bool?
-    var fontColor: TSP_Color?
-    var languageNull: Bool?
-    var language: String?
-    var superscript: Int32?
-    var underline: Int32?
-    var strikethru: Int32?
-    var capitalization: Int32?
-    var baselineShift: Float?
-    var kerning: Float?
-    var ligatures: Int32?
-    var outlineColorNull: Bool?
-    var outlineColor: TSP_Color?
-    var outline: Float?
-    var shadowNull: Bool?
-    var shadow: TSD_ShadowArchive?
-    var strikethruColorNull: Bool?
-    var strikethruColor: TSP_Color?
-    var strikethruWidth: Float?
-    var backgroundColorNull: Bool?
-    var backgroundColor: TSP_Color?
-    var tracking: Float?
-    var underlineColorNull: Bool?
-    var underlineColor: TSP_Color?
-    var underlineWidth: Float?
-    var wordStrikethru: Bool?
-    var wordUnderline: Bool?
-    var fontFeaturesNull: Bool?
-    var fontFeatures: [TSWP_FontFeatureArchive] = []
-    var writingDirection: Int32?
-    var emphasisMarksNull: Bool?
-    var emphasisMarks: String?
-    var compatibilityFontNameNull: Bool?
-    var compatibilityFontName: String?
-    var isNamedPointSize: Bool?
-    var capitalizationUsesLinguistics: Bool?
-    var tateChuYoko: Bool?
-    var tsdStrokeNull: Bool?
-    var tsdStroke: TSD_StrokeArchive?
-    var tsdFillNull: Bool?
-    var tsdFill: TSD_FillArchive?
-    var tsdFillShouldFillTextContainer: Bool?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { bold = _v }
-        case 2:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { italic = _v }
-        case 3:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { fontSize = _v }
-        case 4:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { fontNameNull = _v }
-        case 5:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { fontName = _v }
-        case 6:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { fontColorNull = _v }
-        case 7:
-            var _v: TSP_Color?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Color(ProtobufMessage(_b)) }
-            if let _v { fontColor = _v }
-        case 8:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { languageNull = _v }
-        case 9:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { language = _v }
-        case 10:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { superscript = _v }
-        case 11:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { underline = _v }
-        case 12:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { strikethru = _v }
-        case 13:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { capitalization = _v }
-        case 14:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { baselineShift = _v }
-        case 15:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { kerning = _v }
-        case 16:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { ligatures = _v }
-        case 17:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { outlineColorNull = _v }
-        case 18:
-            var _v: TSP_Color?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Color(ProtobufMessage(_b)) }
-            if let _v { outlineColor = _v }
-        case 19:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { outline = _v }
-        case 20:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { shadowNull = _v }
-        case 21:
-            var _v: TSD_ShadowArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_ShadowArchive(ProtobufMessage(_b)) }
-            if let _v { shadow = _v }
-        case 22:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { strikethruColorNull = _v }
-        case 23:
-            var _v: TSP_Color?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Color(ProtobufMessage(_b)) }
-            if let _v { strikethruColor = _v }
-        case 24:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { strikethruWidth = _v }
-        case 25:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { backgroundColorNull = _v }
-        case 26:
-            var _v: TSP_Color?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Color(ProtobufMessage(_b)) }
-            if let _v { backgroundColor = _v }
-        case 27:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { tracking = _v }
-        case 28:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { underlineColorNull = _v }
-        case 29:
-            var _v: TSP_Color?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Color(ProtobufMessage(_b)) }
-            if let _v { underlineColor = _v }
-        case 30:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { underlineWidth = _v }
-        case 31:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { wordStrikethru = _v }
-        case 32:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { wordUnderline = _v }
-        case 33:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { fontFeaturesNull = _v }
-        case 34:
-            var _v: TSWP_FontFeatureArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_FontFeatureArchive(ProtobufMessage(_b)) }
-            if let _v { fontFeatures.append(_v) }
-        case 35:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { writingDirection = _v }
-        case 36:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { emphasisMarksNull = _v }
-        case 37:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { emphasisMarks = _v }
-        case 38:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { compatibilityFontNameNull = _v }
-        case 39:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { compatibilityFontName = _v }
-        case 40:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { isNamedPointSize = _v }
-        case 41:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { capitalizationUsesLinguistics = _v }
-        case 42:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { tateChuYoko = _v }
-        case 43:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { tsdStrokeNull = _v }
-        case 44:
-            var _v: TSD_StrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_StrokeArchive(ProtobufMessage(_b)) }
-            if let _v { tsdStroke = _v }
-        case 45:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { tsdFillNull = _v }
-        case 46:
-            var _v: TSD_FillArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_FillArchive(ProtobufMessage(_b)) }
-            if let _v { tsdFill = _v }
-        case 47:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { tsdFillShouldFillTextContainer = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = bold { _w.varintField(1, _x ? 1 : 0) }
-        if let _x = italic { _w.varintField(2, _x ? 1 : 0) }
-        if let _x = fontSize { _w.fixed32Field(3, _x.bitPattern) }
-        if let _x = fontNameNull { _w.varintField(4, _x ? 1 : 0) }
-        if let _x = fontName { _w.stringField(5, _x) }
-        if let _x = fontColorNull { _w.varintField(6, _x ? 1 : 0) }
-        if let _x = fontColor { _w.bytesField(7, _x.encoded()) }
-        if let _x = languageNull { _w.varintField(8, _x ? 1 : 0) }
-        if let _x = language { _w.stringField(9, _x) }
-        if let _x = superscript { _w.varintField(10, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = underline { _w.varintField(11, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = strikethru { _w.varintField(12, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = capitalization { _w.varintField(13, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = baselineShift { _w.fixed32Field(14, _x.bitPattern) }
-        if let _x = kerning { _w.fixed32Field(15, _x.bitPattern) }
-        if let _x = ligatures { _w.varintField(16, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = outlineColorNull { _w.varintField(17, _x ? 1 : 0) }
-        if let _x = outlineColor { _w.bytesField(18, _x.encoded()) }
-        if let _x = outline { _w.fixed32Field(19, _x.bitPattern) }
-        if let _x = shadowNull { _w.varintField(20, _x ? 1 : 0) }
-        if let _x = shadow { _w.bytesField(21, _x.encoded()) }
-        if let _x = strikethruColorNull { _w.varintField(22, _x ? 1 : 0) }
-        if let _x = strikethruColor { _w.bytesField(23, _x.encoded()) }
-        if let _x = strikethruWidth { _w.fixed32Field(24, _x.bitPattern) }
-        if let _x = backgroundColorNull { _w.varintField(25, _x ? 1 : 0) }
-        if let _x = backgroundColor { _w.bytesField(26, _x.encoded()) }
-        if let _x = tracking { _w.fixed32Field(27, _x.bitPattern) }
-        if let _x = underlineColorNull { _w.varintField(28, _x ? 1 : 0) }
-        if let _x = underlineColor { _w.bytesField(29, _x.encoded()) }
-        if let _x = underlineWidth { _w.fixed32Field(30, _x.bitPattern) }
-        if let _x = wordStrikethru { _w.varintField(31, _x ? 1 : 0) }
-        if let _x = wordUnderline { _w.varintField(32, _x ? 1 : 0) }
-        if let _x = fontFeaturesNull { _w.varintField(33, _x ? 1 : 0) }
-        for _x in fontFeatures { _w.bytesField(34, _x.encoded()) }
-        if let _x = writingDirection { _w.varintField(35, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = emphasisMarksNull { _w.varintField(36, _x ? 1 : 0) }
-        if let _x = emphasisMarks { _w.stringField(37, _x) }
-        if let _x = compatibilityFontNameNull { _w.varintField(38, _x ? 1 : 0) }
-        if let _x = compatibilityFontName { _w.stringField(39, _x) }
-        if let _x = isNamedPointSize { _w.varintField(40, _x ? 1 : 0) }
-        if let _x = capitalizationUsesLinguistics { _w.varintField(41, _x ? 1 : 0) }
-        if let _x = tateChuYoko { _w.varintField(42, _x ? 1 : 0) }
-        if let _x = tsdStrokeNull { _w.varintField(43, _x ? 1 : 0) }
-        if let _x = tsdStroke { _w.bytesField(44, _x.encoded()) }
-        if let _x = tsdFillNull { _w.varintField(45, _x ? 1 : 0) }
-        if let _x = tsdFill { _w.bytesField(46, _x.encoded()) }
-        if let _x = tsdFillShouldFillTextContainer { _w.varintField(47, _x ? 1 : 0) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSWP.CharacterStylePropertiesArchive", [
+        .optional(1, .bool), .optional(2, .bool), .optional(3, .float), .optional(4, .bool), .optional(5, .string),
+        .optional(6, .bool), .optional(7, TSP_Color.self), .optional(8, .bool), .optional(9, .string),
+        .optional(10, .int32), .optional(11, .int32), .optional(12, .int32), .optional(13, .int32),
+        .optional(14, .float), .optional(15, .float), .optional(16, .int32), .optional(17, .bool),
+        .optional(18, TSP_Color.self), .optional(19, .float), .optional(20, .bool),
+        .optional(21, TSD_ShadowArchive.self), .optional(22, .bool), .optional(23, TSP_Color.self),
+        .optional(24, .float), .optional(25, .bool), .optional(26, TSP_Color.self), .optional(27, .float),
+        .optional(28, .bool), .optional(29, TSP_Color.self), .optional(30, .float), .optional(31, .bool),
+        .optional(32, .bool), .optional(33, .bool), .repeated(34, TSWP_FontFeatureArchive.self), .optional(35, .int32),
+        .optional(36, .bool), .optional(37, .string), .optional(38, .bool), .optional(39, .string),
+        .optional(40, .bool), .optional(41, .bool), .optional(42, .bool), .optional(43, .bool),
+        .optional(44, TSD_StrokeArchive.self), .optional(45, .bool), .optional(46, TSD_FillArchive.self),
+        .optional(47, .bool),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 47)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var bold: Bool? { get { self[0] } set { self[0] = newValue } }
+    var italic: Bool? { get { self[1] } set { self[1] = newValue } }
+    var fontSize: Float? { get { self[2] } set { self[2] = newValue } }
+    var fontNameNull: Bool? { get { self[3] } set { self[3] = newValue } }
+    var fontName: String? { get { self[4] } set { self[4] = newValue } }
+    var fontColorNull: Bool? { get { self[5] } set { self[5] = newValue } }
+    var fontColor: TSP_Color? { get { self[message: 6] } set { self[message: 6] = newValue } }
+    var languageNull: Bool? { get { self[7] } set { self[7] = newValue } }
+    var language: String? { get { self[8] } set { self[8] = newValue } }
+    var superscript: Int32? { get { self[9] } set { self[9] = newValue } }
+    var underline: Int32? { get { self[10] } set { self[10] = newValue } }
+    var strikethru: Int32? { get { self[11] } set { self[11] = newValue } }
+    var capitalization: Int32? { get { self[12] } set { self[12] = newValue } }
+    var baselineShift: Float? { get { self[13] } set { self[13] = newValue } }
+    var kerning: Float? { get { self[14] } set { self[14] = newValue } }
+    var ligatures: Int32? { get { self[15] } set { self[15] = newValue } }
+    var outlineColorNull: Bool? { get { self[16] } set { self[16] = newValue } }
+    var outlineColor: TSP_Color? { get { self[message: 17] } set { self[message: 17] = newValue } }
+    var outline: Float? { get { self[18] } set { self[18] = newValue } }
+    var shadowNull: Bool? { get { self[19] } set { self[19] = newValue } }
+    var shadow: TSD_ShadowArchive? { get { self[message: 20] } set { self[message: 20] = newValue } }
+    var strikethruColorNull: Bool? { get { self[21] } set { self[21] = newValue } }
+    var strikethruColor: TSP_Color? { get { self[message: 22] } set { self[message: 22] = newValue } }
+    var strikethruWidth: Float? { get { self[23] } set { self[23] = newValue } }
+    var backgroundColorNull: Bool? { get { self[24] } set { self[24] = newValue } }
+    var backgroundColor: TSP_Color? { get { self[message: 25] } set { self[message: 25] = newValue } }
+    var tracking: Float? { get { self[26] } set { self[26] = newValue } }
+    var underlineColorNull: Bool? { get { self[27] } set { self[27] = newValue } }
+    var underlineColor: TSP_Color? { get { self[message: 28] } set { self[message: 28] = newValue } }
+    var underlineWidth: Float? { get { self[29] } set { self[29] = newValue } }
+    var wordStrikethru: Bool? { get { self[30] } set { self[30] = newValue } }
+    var wordUnderline: Bool? { get { self[31] } set { self[31] = newValue } }
+    var fontFeaturesNull: Bool? { get { self[32] } set { self[32] = newValue } }
+    var fontFeatures: [TSWP_FontFeatureArchive] { get { self[messages: 33] } set { self[messages: 33] = newValue } }
+    func append(fontFeatures value: TSWP_FontFeatureArchive) { append(value, toMessages: 33) }
+    var writingDirection: Int32? { get { self[34] } set { self[34] = newValue } }
+    var emphasisMarksNull: Bool? { get { self[35] } set { self[35] = newValue } }
+    var emphasisMarks: String? { get { self[36] } set { self[36] = newValue } }
+    var compatibilityFontNameNull: Bool? { get { self[37] } set { self[37] = newValue } }
+    var compatibilityFontName: String? { get { self[38] } set { self[38] = newValue } }
+    var isNamedPointSize: Bool? { get { self[39] } set { self[39] = newValue } }
+    var capitalizationUsesLinguistics: Bool? { get { self[40] } set { self[40] = newValue } }
+    var tateChuYoko: Bool? { get { self[41] } set { self[41] = newValue } }
+    var tsdStrokeNull: Bool? { get { self[42] } set { self[42] = newValue } }
+    var tsdStroke: TSD_StrokeArchive? { get { self[message: 43] } set { self[message: 43] = newValue } }
+    var tsdFillNull: Bool? { get { self[44] } set { self[44] = newValue } }
+    var tsdFill: TSD_FillArchive? { get { self[message: 45] } set { self[message: 45] = newValue } }
+    var tsdFillShouldFillTextContainer: Bool? { get { self[46] } set { self[46] = newValue } }
 }
 
 /// Generated wire model for `TSWP.CharacterStyleArchive`.
 final class TSWP_CharacterStyleArchive: IWAMessage {
-    var `super`: TSS_StyleArchive?
-    var overrideCount: UInt32?
-    var charProperties: TSWP_CharacterStylePropertiesArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.CharacterStyleArchive", [
+        .optional(1, TSS_StyleArchive.self), .optional(10, .uint32),
+        .optional(11, TSWP_CharacterStylePropertiesArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSS_StyleArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSS_StyleArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 10:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { overrideCount = _v }
-        case 11:
-            var _v: TSWP_CharacterStylePropertiesArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_CharacterStylePropertiesArchive(ProtobufMessage(_b)) }
-            if let _v { charProperties = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = overrideCount { _w.varintField(10, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = charProperties { _w.bytesField(11, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var `super`: TSS_StyleArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var overrideCount: UInt32? { get { self[1] } set { self[1] = newValue } }
+    var charProperties: TSWP_CharacterStylePropertiesArchive? { get { self[message: 2] } set { self[message: 2] = newValue } }
 }
 
 /// Generated wire model for `TSWP.TabArchive`.
 final class TSWP_TabArchive: IWAMessage {
-    var position: Float?
-    var alignment: Int32?
-    var leader: String?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.TabArchive", [
+        .optional(1, .float), .optional(2, .int32), .optional(3, .string),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { position = _v }
-        case 2:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { alignment = _v }
-        case 3:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { leader = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = position { _w.fixed32Field(1, _x.bitPattern) }
-        if let _x = alignment { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = leader { _w.stringField(3, _x) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var position: Float? { get { self[0] } set { self[0] = newValue } }
+    var alignment: Int32? { get { self[1] } set { self[1] = newValue } }
+    var leader: String? { get { self[2] } set { self[2] = newValue } }
 }
 
 /// Generated wire model for `TSWP.TabsArchive`.
 final class TSWP_TabsArchive: IWAMessage {
-    var tabs: [TSWP_TabArchive] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.TabsArchive", [
+        .repeated(1, TSWP_TabArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSWP_TabArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_TabArchive(ProtobufMessage(_b)) }
-            if let _v { tabs.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in tabs { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var tabs: [TSWP_TabArchive] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(tabs value: TSWP_TabArchive) { append(value, toMessages: 0) }
 }
 
 /// Generated wire model for `TSWP.LineSpacingArchive`.
 final class TSWP_LineSpacingArchive: IWAMessage {
-    var mode: Int32?
-    var amount: Float?
-    var baselinerule: Float?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.LineSpacingArchive", [
+        .optional(1, .int32), .optional(2, .float), .optional(3, .float),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { mode = _v }
-        case 2:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { amount = _v }
-        case 3:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { baselinerule = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = mode { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = amount { _w.fixed32Field(2, _x.bitPattern) }
-        if let _x = baselinerule { _w.fixed32Field(3, _x.bitPattern) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var mode: Int32? { get { self[0] } set { self[0] = newValue } }
+    var amount: Float? { get { self[1] } set { self[1] = newValue } }
+    var baselinerule: Float? { get { self[2] } set { self[2] = newValue } }
 }
 
 /// Generated wire model for `TSWP.ParagraphStylePropertiesArchive`.
 final class TSWP_ParagraphStylePropertiesArchive: IWAMessage {
-    var alignment: Int32?
-    var decimalTabNull: Bool?
-    var decimalTab: String?
-    var defaultTabStops: Float?
-    var fillNull: Bool?
-    var fill: TSP_Color?
-    var firstLineIndent: Float?
-    var hyphenate: Bool?
-    var keepLinesTogether: Bool?
-    var keepWithNext: Bool?
-    var leftIndent: Float?
-    var lineSpacingNull: Bool?
-    var lineSpacing: TSWP_LineSpacingArchive?
-    var pageBreakBefore: Bool?
-    var deprecatedBorders: Int32?
-    var historicalRuleOffsetNull: Bool?
-    var historicalRuleOffset: TSP_Point?
-    var ruleWidth: Float?
-    var rightIndent: Float?
-    var spaceAfter: Float?
-    var spaceBefore: Float?
-    var tabsNull: Bool?
-    var tabs: TSWP_TabsArchive?
-    var widowControl: Bool?
-    var outlineLevel: UInt32?
-    var outlineStyle: Int32?
-    var followingStyleIdNull: Bool?
-    var followingStyleId: String?
-    var strokeNull: Bool?
-    var stroke: TSD_StrokeArchive?
-    var showInToc: Bool?
-    var tocStyleIdNull: Bool?
-    var tocStyleId: String?
-    var writingDirection: Int32?
-    var listStyleNull: Bool?
-    var listStyle: TSP_Reference?
-    var followingStyleNull: Bool?
-    var followingStyle: TSP_Reference?
-    var showInBookmarksList: Bool?
-    var showInTocNavigator: Bool?
-    var borderPositions: Int32?
-    var roundedCorners: Bool?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { alignment = _v }
-        case 2:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { decimalTabNull = _v }
-        case 3:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { decimalTab = _v }
-        case 4:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { defaultTabStops = _v }
-        case 5:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { fillNull = _v }
-        case 6:
-            var _v: TSP_Color?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Color(ProtobufMessage(_b)) }
-            if let _v { fill = _v }
-        case 7:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { firstLineIndent = _v }
-        case 8:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { hyphenate = _v }
-        case 9:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { keepLinesTogether = _v }
-        case 10:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { keepWithNext = _v }
-        case 11:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { leftIndent = _v }
-        case 12:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { lineSpacingNull = _v }
-        case 13:
-            var _v: TSWP_LineSpacingArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_LineSpacingArchive(ProtobufMessage(_b)) }
-            if let _v { lineSpacing = _v }
-        case 14:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { pageBreakBefore = _v }
-        case 15:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { deprecatedBorders = _v }
-        case 16:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { historicalRuleOffsetNull = _v }
-        case 17:
-            var _v: TSP_Point?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Point(ProtobufMessage(_b)) }
-            if let _v { historicalRuleOffset = _v }
-        case 18:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { ruleWidth = _v }
-        case 19:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { rightIndent = _v }
-        case 20:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { spaceAfter = _v }
-        case 21:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { spaceBefore = _v }
-        case 24:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { tabsNull = _v }
-        case 25:
-            var _v: TSWP_TabsArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_TabsArchive(ProtobufMessage(_b)) }
-            if let _v { tabs = _v }
-        case 26:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { widowControl = _v }
-        case 27:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { outlineLevel = _v }
-        case 28:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { outlineStyle = _v }
-        case 29:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { followingStyleIdNull = _v }
-        case 30:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { followingStyleId = _v }
-        case 31:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { strokeNull = _v }
-        case 32:
-            var _v: TSD_StrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_StrokeArchive(ProtobufMessage(_b)) }
-            if let _v { stroke = _v }
-        case 33:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { showInToc = _v }
-        case 34:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { tocStyleIdNull = _v }
-        case 35:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { tocStyleId = _v }
-        case 38:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { writingDirection = _v }
-        case 39:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { listStyleNull = _v }
-        case 40:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { listStyle = _v }
-        case 41:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { followingStyleNull = _v }
-        case 42:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { followingStyle = _v }
-        case 43:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { showInBookmarksList = _v }
-        case 44:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { showInTocNavigator = _v }
-        case 45:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { borderPositions = _v }
-        case 46:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { roundedCorners = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = alignment { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = decimalTabNull { _w.varintField(2, _x ? 1 : 0) }
-        if let _x = decimalTab { _w.stringField(3, _x) }
-        if let _x = defaultTabStops { _w.fixed32Field(4, _x.bitPattern) }
-        if let _x = fillNull { _w.varintField(5, _x ? 1 : 0) }
-        if let _x = fill { _w.bytesField(6, _x.encoded()) }
-        if let _x = firstLineIndent { _w.fixed32Field(7, _x.bitPattern) }
-        if let _x = hyphenate { _w.varintField(8, _x ? 1 : 0) }
-        if let _x = keepLinesTogether { _w.varintField(9, _x ? 1 : 0) }
-        if let _x = keepWithNext { _w.varintField(10, _x ? 1 : 0) }
-        if let _x = leftIndent { _w.fixed32Field(11, _x.bitPattern) }
-        if let _x = lineSpacingNull { _w.varintField(12, _x ? 1 : 0) }
-        if let _x = lineSpacing { _w.bytesField(13, _x.encoded()) }
-        if let _x = pageBreakBefore { _w.varintField(14, _x ? 1 : 0) }
-        if let _x = deprecatedBorders { _w.varintField(15, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = historicalRuleOffsetNull { _w.varintField(16, _x ? 1 : 0) }
-        if let _x = historicalRuleOffset { _w.bytesField(17, _x.encoded()) }
-        if let _x = ruleWidth { _w.fixed32Field(18, _x.bitPattern) }
-        if let _x = rightIndent { _w.fixed32Field(19, _x.bitPattern) }
-        if let _x = spaceAfter { _w.fixed32Field(20, _x.bitPattern) }
-        if let _x = spaceBefore { _w.fixed32Field(21, _x.bitPattern) }
-        if let _x = tabsNull { _w.varintField(24, _x ? 1 : 0) }
-        if let _x = tabs { _w.bytesField(25, _x.encoded()) }
-        if let _x = widowControl { _w.varintField(26, _x ? 1 : 0) }
-        if let _x = outlineLevel { _w.varintField(27, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = outlineStyle { _w.varintField(28, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = followingStyleIdNull { _w.varintField(29, _x ? 1 : 0) }
-        if let _x = followingStyleId { _w.stringField(30, _x) }
-        if let _x = strokeNull { _w.varintField(31, _x ? 1 : 0) }
-        if let _x = stroke { _w.bytesField(32, _x.encoded()) }
-        if let _x = showInToc { _w.varintField(33, _x ? 1 : 0) }
-        if let _x = tocStyleIdNull { _w.varintField(34, _x ? 1 : 0) }
-        if let _x = tocStyleId { _w.stringField(35, _x) }
-        if let _x = writingDirection { _w.varintField(38, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = listStyleNull { _w.varintField(39, _x ? 1 : 0) }
-        if let _x = listStyle { _w.bytesField(40, _x.encoded()) }
-        if let _x = followingStyleNull { _w.varintField(41, _x ? 1 : 0) }
-        if let _x = followingStyle { _w.bytesField(42, _x.encoded()) }
-        if let _x = showInBookmarksList { _w.varintField(43, _x ? 1 : 0) }
-        if let _x = showInTocNavigator { _w.varintField(44, _x ? 1 : 0) }
-        if let _x = borderPositions { _w.varintField(45, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = roundedCorners { _w.varintField(46, _x ? 1 : 0) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSWP.ParagraphStylePropertiesArchive", [
+        .optional(1, .int32), .optional(2, .bool), .optional(3, .string), .optional(4, .float), .optional(5, .bool),
+        .optional(6, TSP_Color.self), .optional(7, .float), .optional(8, .bool), .optional(9, .bool),
+        .optional(10, .bool), .optional(11, .float), .optional(12, .bool), .optional(13, TSWP_LineSpacingArchive.self),
+        .optional(14, .bool), .optional(15, .int32), .optional(16, .bool), .optional(17, TSP_Point.self),
+        .optional(18, .float), .optional(19, .float), .optional(20, .float), .optional(21, .float),
+        .optional(24, .bool), .optional(25, TSWP_TabsArchive.self), .optional(26, .bool), .optional(27, .uint32),
+        .optional(28, .int32), .optional(29, .bool), .optional(30, .string), .optional(31, .bool),
+        .optional(32, TSD_StrokeArchive.self), .optional(33, .bool), .optional(34, .bool), .optional(35, .string),
+        .optional(38, .int32), .optional(39, .bool), .optional(40, TSP_Reference.self), .optional(41, .bool),
+        .optional(42, TSP_Reference.self), .optional(43, .bool), .optional(44, .bool), .optional(45, .int32),
+        .optional(46, .bool),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 42)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var alignment: Int32? { get { self[0] } set { self[0] = newValue } }
+    var decimalTabNull: Bool? { get { self[1] } set { self[1] = newValue } }
+    var decimalTab: String? { get { self[2] } set { self[2] = newValue } }
+    var defaultTabStops: Float? { get { self[3] } set { self[3] = newValue } }
+    var fillNull: Bool? { get { self[4] } set { self[4] = newValue } }
+    var fill: TSP_Color? { get { self[message: 5] } set { self[message: 5] = newValue } }
+    var firstLineIndent: Float? { get { self[6] } set { self[6] = newValue } }
+    var hyphenate: Bool? { get { self[7] } set { self[7] = newValue } }
+    var keepLinesTogether: Bool? { get { self[8] } set { self[8] = newValue } }
+    var keepWithNext: Bool? { get { self[9] } set { self[9] = newValue } }
+    var leftIndent: Float? { get { self[10] } set { self[10] = newValue } }
+    var lineSpacingNull: Bool? { get { self[11] } set { self[11] = newValue } }
+    var lineSpacing: TSWP_LineSpacingArchive? { get { self[message: 12] } set { self[message: 12] = newValue } }
+    var pageBreakBefore: Bool? { get { self[13] } set { self[13] = newValue } }
+    var deprecatedBorders: Int32? { get { self[14] } set { self[14] = newValue } }
+    var historicalRuleOffsetNull: Bool? { get { self[15] } set { self[15] = newValue } }
+    var historicalRuleOffset: TSP_Point? { get { self[message: 16] } set { self[message: 16] = newValue } }
+    var ruleWidth: Float? { get { self[17] } set { self[17] = newValue } }
+    var rightIndent: Float? { get { self[18] } set { self[18] = newValue } }
+    var spaceAfter: Float? { get { self[19] } set { self[19] = newValue } }
+    var spaceBefore: Float? { get { self[20] } set { self[20] = newValue } }
+    var tabsNull: Bool? { get { self[21] } set { self[21] = newValue } }
+    var tabs: TSWP_TabsArchive? { get { self[message: 22] } set { self[message: 22] = newValue } }
+    var widowControl: Bool? { get { self[23] } set { self[23] = newValue } }
+    var outlineLevel: UInt32? { get { self[24] } set { self[24] = newValue } }
+    var outlineStyle: Int32? { get { self[25] } set { self[25] = newValue } }
+    var followingStyleIdNull: Bool? { get { self[26] } set { self[26] = newValue } }
+    var followingStyleId: String? { get { self[27] } set { self[27] = newValue } }
+    var strokeNull: Bool? { get { self[28] } set { self[28] = newValue } }
+    var stroke: TSD_StrokeArchive? { get { self[message: 29] } set { self[message: 29] = newValue } }
+    var showInToc: Bool? { get { self[30] } set { self[30] = newValue } }
+    var tocStyleIdNull: Bool? { get { self[31] } set { self[31] = newValue } }
+    var tocStyleId: String? { get { self[32] } set { self[32] = newValue } }
+    var writingDirection: Int32? { get { self[33] } set { self[33] = newValue } }
+    var listStyleNull: Bool? { get { self[34] } set { self[34] = newValue } }
+    var listStyle: TSP_Reference? { get { self[message: 35] } set { self[message: 35] = newValue } }
+    var followingStyleNull: Bool? { get { self[36] } set { self[36] = newValue } }
+    var followingStyle: TSP_Reference? { get { self[message: 37] } set { self[message: 37] = newValue } }
+    var showInBookmarksList: Bool? { get { self[38] } set { self[38] = newValue } }
+    var showInTocNavigator: Bool? { get { self[39] } set { self[39] = newValue } }
+    var borderPositions: Int32? { get { self[40] } set { self[40] = newValue } }
+    var roundedCorners: Bool? { get { self[41] } set { self[41] = newValue } }
 }
 
 /// Generated wire model for `TSWP.ParagraphStyleArchive`.
 final class TSWP_ParagraphStyleArchive: IWAMessage {
-    var `super`: TSS_StyleArchive?
-    var overrideCount: UInt32?
-    var charProperties: TSWP_CharacterStylePropertiesArchive?
-    var paraProperties: TSWP_ParagraphStylePropertiesArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.ParagraphStyleArchive", [
+        .optional(1, TSS_StyleArchive.self), .optional(10, .uint32),
+        .optional(11, TSWP_CharacterStylePropertiesArchive.self),
+        .optional(12, TSWP_ParagraphStylePropertiesArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSS_StyleArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSS_StyleArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 10:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { overrideCount = _v }
-        case 11:
-            var _v: TSWP_CharacterStylePropertiesArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_CharacterStylePropertiesArchive(ProtobufMessage(_b)) }
-            if let _v { charProperties = _v }
-        case 12:
-            var _v: TSWP_ParagraphStylePropertiesArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_ParagraphStylePropertiesArchive(ProtobufMessage(_b)) }
-            if let _v { paraProperties = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = overrideCount { _w.varintField(10, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = charProperties { _w.bytesField(11, _x.encoded()) }
-        if let _x = paraProperties { _w.bytesField(12, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var `super`: TSS_StyleArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var overrideCount: UInt32? { get { self[1] } set { self[1] = newValue } }
+    var charProperties: TSWP_CharacterStylePropertiesArchive? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var paraProperties: TSWP_ParagraphStylePropertiesArchive? { get { self[message: 3] } set { self[message: 3] = newValue } }
 }
 
 /// Generated wire model for `TSWP.ListStyleArchive`.
 final class TSWP_ListStyleArchive: IWAMessage {
-    var `super`: TSS_StyleArchive?
-    var overrideCount: UInt32?
-    var labelTypes: [Int32] = []
-    var textIndents: [Float] = []
-    var indents: [Float] = []
-    var geometries: [TSWP_ListStyleArchive_LabelGeometry] = []
-    var numberTypes: [Int32] = []
-    var strings: [String] = []
-    var images: [TSWP_ListStyleArchive_LabelImage] = []
-    var shadowNull: Bool?
-    var shadow: TSD_ShadowArchive?
-    var fontColorNull: Bool?
-    var fontColor: TSP_Color?
-    var fontNameNull: Bool?
-    var fontName: String?
-    var writingDirection: Int32?
-    var tieredNumbers: [Bool] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSS_StyleArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSS_StyleArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 10:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { overrideCount = _v }
-        case 11:
-            if case .varint(let _u) = _f.value { labelTypes.append(Int32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { labelTypes.append(Int32(truncatingIfNeeded: _u)) } }
-        case 12:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { textIndents.append(_v) }
-        case 13:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { indents.append(_v) }
-        case 14:
-            var _v: TSWP_ListStyleArchive_LabelGeometry?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_ListStyleArchive_LabelGeometry(ProtobufMessage(_b)) }
-            if let _v { geometries.append(_v) }
-        case 15:
-            if case .varint(let _u) = _f.value { numberTypes.append(Int32(truncatingIfNeeded: _u)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { numberTypes.append(Int32(truncatingIfNeeded: _u)) } }
-        case 16:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { strings.append(_v) }
-        case 17:
-            var _v: TSWP_ListStyleArchive_LabelImage?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_ListStyleArchive_LabelImage(ProtobufMessage(_b)) }
-            if let _v { images.append(_v) }
-        case 18:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { shadowNull = _v }
-        case 19:
-            var _v: TSD_ShadowArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_ShadowArchive(ProtobufMessage(_b)) }
-            if let _v { shadow = _v }
-        case 20:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { fontColorNull = _v }
-        case 21:
-            var _v: TSP_Color?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Color(ProtobufMessage(_b)) }
-            if let _v { fontColor = _v }
-        case 22:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { fontNameNull = _v }
-        case 23:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { fontName = _v }
-        case 24:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { writingDirection = _v }
-        case 25:
-            if case .varint(let _u) = _f.value { tieredNumbers.append((_u != 0)) }
-            else if case .lengthDelimited(let _b) = _f.value { for _u in IWAWire.unpackVarints(_b) { tieredNumbers.append((_u != 0)) } }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = overrideCount { _w.varintField(10, UInt64(truncatingIfNeeded: _x)) }
-        for _x in labelTypes { _w.varintField(11, UInt64(truncatingIfNeeded: _x)) }
-        for _x in textIndents { _w.fixed32Field(12, _x.bitPattern) }
-        for _x in indents { _w.fixed32Field(13, _x.bitPattern) }
-        for _x in geometries { _w.bytesField(14, _x.encoded()) }
-        for _x in numberTypes { _w.varintField(15, UInt64(truncatingIfNeeded: _x)) }
-        for _x in strings { _w.stringField(16, _x) }
-        for _x in images { _w.bytesField(17, _x.encoded()) }
-        if let _x = shadowNull { _w.varintField(18, _x ? 1 : 0) }
-        if let _x = shadow { _w.bytesField(19, _x.encoded()) }
-        if let _x = fontColorNull { _w.varintField(20, _x ? 1 : 0) }
-        if let _x = fontColor { _w.bytesField(21, _x.encoded()) }
-        if let _x = fontNameNull { _w.varintField(22, _x ? 1 : 0) }
-        if let _x = fontName { _w.stringField(23, _x) }
-        if let _x = writingDirection { _w.varintField(24, UInt64(truncatingIfNeeded: _x)) }
-        for _x in tieredNumbers { _w.varintField(25, _x ? 1 : 0) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSWP.ListStyleArchive", [
+        .optional(1, TSS_StyleArchive.self), .optional(10, .uint32), .repeated(11, .int32), .repeated(12, .float),
+        .repeated(13, .float), .repeated(14, TSWP_ListStyleArchive_LabelGeometry.self), .repeated(15, .int32),
+        .repeated(16, .string), .repeated(17, TSWP_ListStyleArchive_LabelImage.self), .optional(18, .bool),
+        .optional(19, TSD_ShadowArchive.self), .optional(20, .bool), .optional(21, TSP_Color.self),
+        .optional(22, .bool), .optional(23, .string), .optional(24, .int32), .repeated(25, .bool),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 17)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var `super`: TSS_StyleArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var overrideCount: UInt32? { get { self[1] } set { self[1] = newValue } }
+    var labelTypes: [Int32] { get { self[all: 2] } set { self[all: 2] = newValue } }
+    func append(labelTypes value: Int32) { append(value, toAll: 2) }
+    var textIndents: [Float] { get { self[all: 3] } set { self[all: 3] = newValue } }
+    func append(textIndents value: Float) { append(value, toAll: 3) }
+    var indents: [Float] { get { self[all: 4] } set { self[all: 4] = newValue } }
+    func append(indents value: Float) { append(value, toAll: 4) }
+    var geometries: [TSWP_ListStyleArchive_LabelGeometry] { get { self[messages: 5] } set { self[messages: 5] = newValue } }
+    func append(geometries value: TSWP_ListStyleArchive_LabelGeometry) { append(value, toMessages: 5) }
+    var numberTypes: [Int32] { get { self[all: 6] } set { self[all: 6] = newValue } }
+    func append(numberTypes value: Int32) { append(value, toAll: 6) }
+    var strings: [String] { get { self[all: 7] } set { self[all: 7] = newValue } }
+    func append(strings value: String) { append(value, toAll: 7) }
+    var images: [TSWP_ListStyleArchive_LabelImage] { get { self[messages: 8] } set { self[messages: 8] = newValue } }
+    func append(images value: TSWP_ListStyleArchive_LabelImage) { append(value, toMessages: 8) }
+    var shadowNull: Bool? { get { self[9] } set { self[9] = newValue } }
+    var shadow: TSD_ShadowArchive? { get { self[message: 10] } set { self[message: 10] = newValue } }
+    var fontColorNull: Bool? { get { self[11] } set { self[11] = newValue } }
+    var fontColor: TSP_Color? { get { self[message: 12] } set { self[message: 12] = newValue } }
+    var fontNameNull: Bool? { get { self[13] } set { self[13] = newValue } }
+    var fontName: String? { get { self[14] } set { self[14] = newValue } }
+    var writingDirection: Int32? { get { self[15] } set { self[15] = newValue } }
+    var tieredNumbers: [Bool] { get { self[all: 16] } set { self[all: 16] = newValue } }
+    func append(tieredNumbers value: Bool) { append(value, toAll: 16) }
 }
 
 /// Generated wire model for `TSWP.ListStyleArchive.LabelGeometry`.
 final class TSWP_ListStyleArchive_LabelGeometry: IWAMessage {
-    var scale: Float?
-    var baselineOffset: Float?
-    var scaleWithText: Bool?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.ListStyleArchive.LabelGeometry", [
+        .optional(1, .float), .optional(2, .float), .optional(3, .bool),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { scale = _v }
-        case 2:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { baselineOffset = _v }
-        case 3:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { scaleWithText = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = scale { _w.fixed32Field(1, _x.bitPattern) }
-        if let _x = baselineOffset { _w.fixed32Field(2, _x.bitPattern) }
-        if let _x = scaleWithText { _w.varintField(3, _x ? 1 : 0) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var scale: Float? { get { self[0] } set { self[0] = newValue } }
+    var baselineOffset: Float? { get { self[1] } set { self[1] = newValue } }
+    var scaleWithText: Bool? { get { self[2] } set { self[2] = newValue } }
 }
 
 /// Generated wire model for `TSWP.ListStyleArchive.LabelImage`.
 final class TSWP_ListStyleArchive_LabelImage: IWAMessage {
-    var image: TSP_DataReference?
-    var imageNull: Bool?
-    var databaseImage: TSP_Reference?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.ListStyleArchive.LabelImage", [
+        .optional(3, TSP_DataReference.self), .optional(2, .bool), .optional(1, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 3:
-            var _v: TSP_DataReference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_DataReference(ProtobufMessage(_b)) }
-            if let _v { image = _v }
-        case 2:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { imageNull = _v }
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { databaseImage = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = image { _w.bytesField(3, _x.encoded()) }
-        if let _x = imageNull { _w.varintField(2, _x ? 1 : 0) }
-        if let _x = databaseImage { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var image: TSP_DataReference? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var imageNull: Bool? { get { self[1] } set { self[1] = newValue } }
+    var databaseImage: TSP_Reference? { get { self[message: 2] } set { self[message: 2] = newValue } }
 }
 
 /// Generated wire model for `TSWP.TextStylePresetArchive`.
 final class TSWP_TextStylePresetArchive: IWAMessage {
-    var presetIdentifier: String?
-    var paragraphStyle: TSP_Reference?
-    var listStyle: TSP_Reference?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.TextStylePresetArchive", [
+        .optional(1, .string), .optional(2, TSP_Reference.self), .optional(3, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { presetIdentifier = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { paragraphStyle = _v }
-        case 3:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { listStyle = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = presetIdentifier { _w.stringField(1, _x) }
-        if let _x = paragraphStyle { _w.bytesField(2, _x.encoded()) }
-        if let _x = listStyle { _w.bytesField(3, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var presetIdentifier: String? { get { self[0] } set { self[0] = newValue } }
+    var paragraphStyle: TSP_Reference? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var listStyle: TSP_Reference? { get { self[message: 2] } set { self[message: 2] = newValue } }
 }
 
 /// Generated wire model for `TSWP.ColumnsArchive`.
 final class TSWP_ColumnsArchive: IWAMessage {
-    var equalColumns: TSWP_ColumnsArchive_EqualColumnsArchive?
-    var nonEqualColumns: TSWP_ColumnsArchive_NonEqualColumnsArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.ColumnsArchive", [
+        .optional(1, TSWP_ColumnsArchive_EqualColumnsArchive.self),
+        .optional(2, TSWP_ColumnsArchive_NonEqualColumnsArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSWP_ColumnsArchive_EqualColumnsArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_ColumnsArchive_EqualColumnsArchive(ProtobufMessage(_b)) }
-            if let _v { equalColumns = _v }
-        case 2:
-            var _v: TSWP_ColumnsArchive_NonEqualColumnsArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_ColumnsArchive_NonEqualColumnsArchive(ProtobufMessage(_b)) }
-            if let _v { nonEqualColumns = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = equalColumns { _w.bytesField(1, _x.encoded()) }
-        if let _x = nonEqualColumns { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var equalColumns: TSWP_ColumnsArchive_EqualColumnsArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var nonEqualColumns: TSWP_ColumnsArchive_NonEqualColumnsArchive? { get { self[message: 1] } set { self[message: 1] = newValue } }
 }
 
 /// Generated wire model for `TSWP.ColumnsArchive.EqualColumnsArchive`.
 final class TSWP_ColumnsArchive_EqualColumnsArchive: IWAMessage {
-    var count: UInt32?
-    var gap: Float?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.ColumnsArchive.EqualColumnsArchive", [
+        .optional(1, .uint32), .optional(2, .float),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { count = _v }
-        case 2:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { gap = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = count { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = gap { _w.fixed32Field(2, _x.bitPattern) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var count: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var gap: Float? { get { self[1] } set { self[1] = newValue } }
 }
 
 /// Generated wire model for `TSWP.ColumnsArchive.NonEqualColumnsArchive`.
 final class TSWP_ColumnsArchive_NonEqualColumnsArchive: IWAMessage {
-    var first: Float?
-    var following: [TSWP_ColumnsArchive_NonEqualColumnsArchive_GapWidthArchive] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.ColumnsArchive.NonEqualColumnsArchive", [
+        .optional(1, .float), .repeated(2, TSWP_ColumnsArchive_NonEqualColumnsArchive_GapWidthArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { first = _v }
-        case 2:
-            var _v: TSWP_ColumnsArchive_NonEqualColumnsArchive_GapWidthArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_ColumnsArchive_NonEqualColumnsArchive_GapWidthArchive(ProtobufMessage(_b)) }
-            if let _v { following.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = first { _w.fixed32Field(1, _x.bitPattern) }
-        for _x in following { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var first: Float? { get { self[0] } set { self[0] = newValue } }
+    var following: [TSWP_ColumnsArchive_NonEqualColumnsArchive_GapWidthArchive] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(following value: TSWP_ColumnsArchive_NonEqualColumnsArchive_GapWidthArchive) { append(value, toMessages: 1) }
 }
 
 /// Generated wire model for `TSWP.ColumnsArchive.NonEqualColumnsArchive.GapWidthArchive`.
 final class TSWP_ColumnsArchive_NonEqualColumnsArchive_GapWidthArchive: IWAMessage {
-    var gap: Float?
-    var width: Float?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.ColumnsArchive.NonEqualColumnsArchive.GapWidthArchive", [
+        .optional(1, .float), .optional(2, .float),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { gap = _v }
-        case 2:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { width = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = gap { _w.fixed32Field(1, _x.bitPattern) }
-        if let _x = width { _w.fixed32Field(2, _x.bitPattern) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var gap: Float? { get { self[0] } set { self[0] = newValue } }
+    var width: Float? { get { self[1] } set { self[1] = newValue } }
 }
 
 /// Generated wire model for `TSWP.PaddingArchive`.
 final class TSWP_PaddingArchive: IWAMessage {
-    var left: Float?
-    var top: Float?
-    var right: Float?
-    var bottom: Float?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.PaddingArchive", [
+        .optional(1, .float), .optional(2, .float), .optional(3, .float), .optional(4, .float),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { left = _v }
-        case 2:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { top = _v }
-        case 3:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { right = _v }
-        case 4:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { bottom = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = left { _w.fixed32Field(1, _x.bitPattern) }
-        if let _x = top { _w.fixed32Field(2, _x.bitPattern) }
-        if let _x = right { _w.fixed32Field(3, _x.bitPattern) }
-        if let _x = bottom { _w.fixed32Field(4, _x.bitPattern) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var left: Float? { get { self[0] } set { self[0] = newValue } }
+    var top: Float? { get { self[1] } set { self[1] = newValue } }
+    var right: Float? { get { self[2] } set { self[2] = newValue } }
+    var bottom: Float? { get { self[3] } set { self[3] = newValue } }
 }
 
 /// Generated wire model for `TSWP.ColumnStylePropertiesArchive`.
 final class TSWP_ColumnStylePropertiesArchive: IWAMessage {
-    var continuous: Bool?
-    var shrinkToFit: Bool?
-    var verticalText: Bool?
-    var minHorizontalInset: Float?
-    var verticalAlignment: Int32?
-    var columnsNull: Bool?
-    var columns: TSWP_ColumnsArchive?
-    var marginsNull: Bool?
-    var margins: TSWP_PaddingArchive?
-    var paddingNull: Bool?
-    var padding: TSWP_PaddingArchive?
-    var writingDirection: Int32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { continuous = _v }
-        case 2:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { shrinkToFit = _v }
-        case 3:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { verticalText = _v }
-        case 4:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { minHorizontalInset = _v }
-        case 5:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { verticalAlignment = _v }
-        case 6:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { columnsNull = _v }
-        case 7:
-            var _v: TSWP_ColumnsArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_ColumnsArchive(ProtobufMessage(_b)) }
-            if let _v { columns = _v }
-        case 8:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { marginsNull = _v }
-        case 9:
-            var _v: TSWP_PaddingArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_PaddingArchive(ProtobufMessage(_b)) }
-            if let _v { margins = _v }
-        case 10:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { paddingNull = _v }
-        case 11:
-            var _v: TSWP_PaddingArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_PaddingArchive(ProtobufMessage(_b)) }
-            if let _v { padding = _v }
-        case 12:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { writingDirection = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = continuous { _w.varintField(1, _x ? 1 : 0) }
-        if let _x = shrinkToFit { _w.varintField(2, _x ? 1 : 0) }
-        if let _x = verticalText { _w.varintField(3, _x ? 1 : 0) }
-        if let _x = minHorizontalInset { _w.fixed32Field(4, _x.bitPattern) }
-        if let _x = verticalAlignment { _w.varintField(5, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = columnsNull { _w.varintField(6, _x ? 1 : 0) }
-        if let _x = columns { _w.bytesField(7, _x.encoded()) }
-        if let _x = marginsNull { _w.varintField(8, _x ? 1 : 0) }
-        if let _x = margins { _w.bytesField(9, _x.encoded()) }
-        if let _x = paddingNull { _w.varintField(10, _x ? 1 : 0) }
-        if let _x = padding { _w.bytesField(11, _x.encoded()) }
-        if let _x = writingDirection { _w.varintField(12, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSWP.ColumnStylePropertiesArchive", [
+        .optional(1, .bool), .optional(2, .bool), .optional(3, .bool), .optional(4, .float), .optional(5, .int32),
+        .optional(6, .bool), .optional(7, TSWP_ColumnsArchive.self), .optional(8, .bool),
+        .optional(9, TSWP_PaddingArchive.self), .optional(10, .bool), .optional(11, TSWP_PaddingArchive.self),
+        .optional(12, .int32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 12)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var continuous: Bool? { get { self[0] } set { self[0] = newValue } }
+    var shrinkToFit: Bool? { get { self[1] } set { self[1] = newValue } }
+    var verticalText: Bool? { get { self[2] } set { self[2] = newValue } }
+    var minHorizontalInset: Float? { get { self[3] } set { self[3] = newValue } }
+    var verticalAlignment: Int32? { get { self[4] } set { self[4] = newValue } }
+    var columnsNull: Bool? { get { self[5] } set { self[5] = newValue } }
+    var columns: TSWP_ColumnsArchive? { get { self[message: 6] } set { self[message: 6] = newValue } }
+    var marginsNull: Bool? { get { self[7] } set { self[7] = newValue } }
+    var margins: TSWP_PaddingArchive? { get { self[message: 8] } set { self[message: 8] = newValue } }
+    var paddingNull: Bool? { get { self[9] } set { self[9] = newValue } }
+    var padding: TSWP_PaddingArchive? { get { self[message: 10] } set { self[message: 10] = newValue } }
+    var writingDirection: Int32? { get { self[11] } set { self[11] = newValue } }
 }
 
 /// Generated wire model for `TSWP.ColumnStyleArchive`.
 final class TSWP_ColumnStyleArchive: IWAMessage {
-    var `super`: TSS_StyleArchive?
-    var overrideCount: UInt32?
-    var columnProperties: TSWP_ColumnStylePropertiesArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.ColumnStyleArchive", [
+        .optional(1, TSS_StyleArchive.self), .optional(10, .uint32),
+        .optional(11, TSWP_ColumnStylePropertiesArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSS_StyleArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSS_StyleArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 10:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { overrideCount = _v }
-        case 11:
-            var _v: TSWP_ColumnStylePropertiesArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_ColumnStylePropertiesArchive(ProtobufMessage(_b)) }
-            if let _v { columnProperties = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = overrideCount { _w.varintField(10, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = columnProperties { _w.bytesField(11, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var `super`: TSS_StyleArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var overrideCount: UInt32? { get { self[1] } set { self[1] = newValue } }
+    var columnProperties: TSWP_ColumnStylePropertiesArchive? { get { self[message: 2] } set { self[message: 2] = newValue } }
 }
 
 /// Generated wire model for `TSWP.ShapeStylePropertiesArchive`.
 final class TSWP_ShapeStylePropertiesArchive: IWAMessage {
-    var shrinkToFit: Bool?
-    var verticalAlignment: Int32?
-    var columnsNull: Bool?
-    var columns: TSWP_ColumnsArchive?
-    var paddingNull: Bool?
-    var padding: TSWP_PaddingArchive?
-    var defaultTextPresetIndex: UInt32?
-    var verticalText: Bool?
-    var paragraphStyleNull: Bool?
-    var paragraphStyle: TSP_Reference?
-    var verticalText40: Bool?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.ShapeStylePropertiesArchive", [
+        .optional(1, .bool), .optional(2, .int32), .optional(3, .bool), .optional(4, TSWP_ColumnsArchive.self),
+        .optional(5, .bool), .optional(6, TSWP_PaddingArchive.self), .optional(7, .uint32), .optional(8, .bool),
+        .optional(9, .bool), .optional(10, TSP_Reference.self), .optional(11, .bool),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 11)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { shrinkToFit = _v }
-        case 2:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { verticalAlignment = _v }
-        case 3:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { columnsNull = _v }
-        case 4:
-            var _v: TSWP_ColumnsArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_ColumnsArchive(ProtobufMessage(_b)) }
-            if let _v { columns = _v }
-        case 5:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { paddingNull = _v }
-        case 6:
-            var _v: TSWP_PaddingArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_PaddingArchive(ProtobufMessage(_b)) }
-            if let _v { padding = _v }
-        case 7:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { defaultTextPresetIndex = _v }
-        case 8:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { verticalText = _v }
-        case 9:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { paragraphStyleNull = _v }
-        case 10:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { paragraphStyle = _v }
-        case 11:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { verticalText40 = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = shrinkToFit { _w.varintField(1, _x ? 1 : 0) }
-        if let _x = verticalAlignment { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = columnsNull { _w.varintField(3, _x ? 1 : 0) }
-        if let _x = columns { _w.bytesField(4, _x.encoded()) }
-        if let _x = paddingNull { _w.varintField(5, _x ? 1 : 0) }
-        if let _x = padding { _w.bytesField(6, _x.encoded()) }
-        if let _x = defaultTextPresetIndex { _w.varintField(7, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = verticalText { _w.varintField(8, _x ? 1 : 0) }
-        if let _x = paragraphStyleNull { _w.varintField(9, _x ? 1 : 0) }
-        if let _x = paragraphStyle { _w.bytesField(10, _x.encoded()) }
-        if let _x = verticalText40 { _w.varintField(11, _x ? 1 : 0) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var shrinkToFit: Bool? { get { self[0] } set { self[0] = newValue } }
+    var verticalAlignment: Int32? { get { self[1] } set { self[1] = newValue } }
+    var columnsNull: Bool? { get { self[2] } set { self[2] = newValue } }
+    var columns: TSWP_ColumnsArchive? { get { self[message: 3] } set { self[message: 3] = newValue } }
+    var paddingNull: Bool? { get { self[4] } set { self[4] = newValue } }
+    var padding: TSWP_PaddingArchive? { get { self[message: 5] } set { self[message: 5] = newValue } }
+    var defaultTextPresetIndex: UInt32? { get { self[6] } set { self[6] = newValue } }
+    var verticalText: Bool? { get { self[7] } set { self[7] = newValue } }
+    var paragraphStyleNull: Bool? { get { self[8] } set { self[8] = newValue } }
+    var paragraphStyle: TSP_Reference? { get { self[message: 9] } set { self[message: 9] = newValue } }
+    var verticalText40: Bool? { get { self[10] } set { self[10] = newValue } }
 }
 
 /// Generated wire model for `TSWP.ShapeStyleArchive`.
 final class TSWP_ShapeStyleArchive: IWAMessage {
-    var `super`: TSD_ShapeStyleArchive?
-    var overrideCount: UInt32?
-    var shapeProperties: TSWP_ShapeStylePropertiesArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.ShapeStyleArchive", [
+        .optional(1, TSD_ShapeStyleArchive.self), .optional(10, .uint32),
+        .optional(11, TSWP_ShapeStylePropertiesArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSD_ShapeStyleArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_ShapeStyleArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 10:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { overrideCount = _v }
-        case 11:
-            var _v: TSWP_ShapeStylePropertiesArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_ShapeStylePropertiesArchive(ProtobufMessage(_b)) }
-            if let _v { shapeProperties = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = overrideCount { _w.varintField(10, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = shapeProperties { _w.bytesField(11, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var `super`: TSD_ShapeStyleArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var overrideCount: UInt32? { get { self[1] } set { self[1] = newValue } }
+    var shapeProperties: TSWP_ShapeStylePropertiesArchive? { get { self[message: 2] } set { self[message: 2] = newValue } }
 }
 
 /// Generated wire model for `TSWP.ThemePresetsArchive`.
 final class TSWP_ThemePresetsArchive: IWAMessage {
-    var listStylePresets: [TSP_Reference] = []
-    var textStylePresets: [TSP_Reference] = []
-    var importedTextStylePresets: [TSP_Reference] = []
-    var tocEntryStylePresets: [TSP_Reference] = []
-    var tocSettingsPresets: [TSP_Reference] = []
-    var characterStylePresets: [TSP_Reference] = []
-    var paragraphStylePresets: [TSP_Reference] = []
-    var dropcapStylePresets: [TSP_Reference] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { listStylePresets.append(_v) }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { textStylePresets.append(_v) }
-        case 3:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { importedTextStylePresets.append(_v) }
-        case 4:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { tocEntryStylePresets.append(_v) }
-        case 5:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { tocSettingsPresets.append(_v) }
-        case 6:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { characterStylePresets.append(_v) }
-        case 7:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { paragraphStylePresets.append(_v) }
-        case 8:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { dropcapStylePresets.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in listStylePresets { _w.bytesField(1, _x.encoded()) }
-        for _x in textStylePresets { _w.bytesField(2, _x.encoded()) }
-        for _x in importedTextStylePresets { _w.bytesField(3, _x.encoded()) }
-        for _x in tocEntryStylePresets { _w.bytesField(4, _x.encoded()) }
-        for _x in tocSettingsPresets { _w.bytesField(5, _x.encoded()) }
-        for _x in characterStylePresets { _w.bytesField(6, _x.encoded()) }
-        for _x in paragraphStylePresets { _w.bytesField(7, _x.encoded()) }
-        for _x in dropcapStylePresets { _w.bytesField(8, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSWP.ThemePresetsArchive", [
+        .repeated(1, TSP_Reference.self), .repeated(2, TSP_Reference.self), .repeated(3, TSP_Reference.self),
+        .repeated(4, TSP_Reference.self), .repeated(5, TSP_Reference.self), .repeated(6, TSP_Reference.self),
+        .repeated(7, TSP_Reference.self), .repeated(8, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 8)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var listStylePresets: [TSP_Reference] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(listStylePresets value: TSP_Reference) { append(value, toMessages: 0) }
+    var textStylePresets: [TSP_Reference] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(textStylePresets value: TSP_Reference) { append(value, toMessages: 1) }
+    var importedTextStylePresets: [TSP_Reference] { get { self[messages: 2] } set { self[messages: 2] = newValue } }
+    func append(importedTextStylePresets value: TSP_Reference) { append(value, toMessages: 2) }
+    var tocEntryStylePresets: [TSP_Reference] { get { self[messages: 3] } set { self[messages: 3] = newValue } }
+    func append(tocEntryStylePresets value: TSP_Reference) { append(value, toMessages: 3) }
+    var tocSettingsPresets: [TSP_Reference] { get { self[messages: 4] } set { self[messages: 4] = newValue } }
+    func append(tocSettingsPresets value: TSP_Reference) { append(value, toMessages: 4) }
+    var characterStylePresets: [TSP_Reference] { get { self[messages: 5] } set { self[messages: 5] = newValue } }
+    func append(characterStylePresets value: TSP_Reference) { append(value, toMessages: 5) }
+    var paragraphStylePresets: [TSP_Reference] { get { self[messages: 6] } set { self[messages: 6] = newValue } }
+    func append(paragraphStylePresets value: TSP_Reference) { append(value, toMessages: 6) }
+    var dropcapStylePresets: [TSP_Reference] { get { self[messages: 7] } set { self[messages: 7] = newValue } }
+    func append(dropcapStylePresets value: TSP_Reference) { append(value, toMessages: 7) }
 }
 
 /// Generated wire model for `TSWP.TextPresetDisplayItemArchive`.
 final class TSWP_TextPresetDisplayItemArchive: IWAMessage {
-    var preset: TSP_Reference?
-    var displayName: String?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.TextPresetDisplayItemArchive", [
+        .optional(1, TSP_Reference.self), .optional(2, .string),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { preset = _v }
-        case 2:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { displayName = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = preset { _w.bytesField(1, _x.encoded()) }
-        if let _x = displayName { _w.stringField(2, _x) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var preset: TSP_Reference? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var displayName: String? { get { self[1] } set { self[1] = newValue } }
 }
 
 /// Generated wire model for `TSWP.TOCEntryStylePropertiesArchive`.
 final class TSWP_TOCEntryStylePropertiesArchive: IWAMessage {
-    var pageNumberStyleNull: Bool?
-    var pageNumberStyle: TSP_Reference?
-    var showPageNumber: Bool?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.TOCEntryStylePropertiesArchive", [
+        .optional(1, .bool), .optional(2, TSP_Reference.self), .optional(3, .bool),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { pageNumberStyleNull = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { pageNumberStyle = _v }
-        case 3:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { showPageNumber = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = pageNumberStyleNull { _w.varintField(1, _x ? 1 : 0) }
-        if let _x = pageNumberStyle { _w.bytesField(2, _x.encoded()) }
-        if let _x = showPageNumber { _w.varintField(3, _x ? 1 : 0) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var pageNumberStyleNull: Bool? { get { self[0] } set { self[0] = newValue } }
+    var pageNumberStyle: TSP_Reference? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var showPageNumber: Bool? { get { self[2] } set { self[2] = newValue } }
 }
 
 /// Generated wire model for `TSWP.TOCEntryStyleArchive`.
 final class TSWP_TOCEntryStyleArchive: IWAMessage {
-    var `super`: TSWP_ParagraphStyleArchive?
-    var tocProperties: TSWP_TOCEntryStylePropertiesArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.TOCEntryStyleArchive", [
+        .optional(1, TSWP_ParagraphStyleArchive.self), .optional(2, TSWP_TOCEntryStylePropertiesArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSWP_ParagraphStyleArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_ParagraphStyleArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: TSWP_TOCEntryStylePropertiesArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_TOCEntryStylePropertiesArchive(ProtobufMessage(_b)) }
-            if let _v { tocProperties = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = tocProperties { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var `super`: TSWP_ParagraphStyleArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var tocProperties: TSWP_TOCEntryStylePropertiesArchive? { get { self[message: 1] } set { self[message: 1] = newValue } }
 }
 
 /// Generated wire model for `TSWP.TOCSettingsArchive`.
 final class TSWP_TOCSettingsArchive: IWAMessage {
-    var tocName: String?
-    var tocScope: UInt32?
-    var entries: [TSWP_TOCSettingsArchive_TOCEntryData] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.TOCSettingsArchive", [
+        .optional(1, .string), .optional(2, .uint32), .repeated(3, TSWP_TOCSettingsArchive_TOCEntryData.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { tocName = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { tocScope = _v }
-        case 3:
-            var _v: TSWP_TOCSettingsArchive_TOCEntryData?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_TOCSettingsArchive_TOCEntryData(ProtobufMessage(_b)) }
-            if let _v { entries.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = tocName { _w.stringField(1, _x) }
-        if let _x = tocScope { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        for _x in entries { _w.bytesField(3, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var tocName: String? { get { self[0] } set { self[0] = newValue } }
+    var tocScope: UInt32? { get { self[1] } set { self[1] = newValue } }
+    var entries: [TSWP_TOCSettingsArchive_TOCEntryData] { get { self[messages: 2] } set { self[messages: 2] = newValue } }
+    func append(entries value: TSWP_TOCSettingsArchive_TOCEntryData) { append(value, toMessages: 2) }
 }
 
 /// Generated wire model for `TSWP.TOCSettingsArchive.TOCEntryData`.
 final class TSWP_TOCSettingsArchive_TOCEntryData: IWAMessage {
-    var paragraphStyle: TSP_Reference?
-    var tocEntryStyle: TSP_Reference?
-    var showInToc: Bool?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.TOCSettingsArchive.TOCEntryData", [
+        .optional(1, TSP_Reference.self), .optional(2, TSP_Reference.self), .optional(3, .bool),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { paragraphStyle = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { tocEntryStyle = _v }
-        case 3:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { showInToc = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = paragraphStyle { _w.bytesField(1, _x.encoded()) }
-        if let _x = tocEntryStyle { _w.bytesField(2, _x.encoded()) }
-        if let _x = showInToc { _w.varintField(3, _x ? 1 : 0) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var paragraphStyle: TSP_Reference? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var tocEntryStyle: TSP_Reference? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var showInToc: Bool? { get { self[2] } set { self[2] = newValue } }
 }
 
 /// Generated wire model for `TSWP.TOCEntryInstanceArchive`.
 final class TSWP_TOCEntryInstanceArchive: IWAMessage {
-    var paragraphIndex: UInt32?
-    var pageNumber: UInt32?
-    var numberFormat: UInt32?
-    var heading: String?
-    var indexedStyle: TSP_Reference?
-    var indexedListStyle: TSP_Reference?
-    var indexedListStart: UInt32?
-    var indexedParagraphLevel: UInt32?
-    var numberFormatName: String?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.TOCEntryInstanceArchive", [
+        .optional(1, .uint32), .optional(2, .uint32), .optional(3, .uint32), .optional(4, .string),
+        .optional(5, TSP_Reference.self), .optional(6, TSP_Reference.self), .optional(7, .uint32),
+        .optional(8, .uint32), .optional(9, .string),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 9)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { paragraphIndex = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { pageNumber = _v }
-        case 3:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { numberFormat = _v }
-        case 4:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { heading = _v }
-        case 5:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { indexedStyle = _v }
-        case 6:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { indexedListStyle = _v }
-        case 7:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { indexedListStart = _v }
-        case 8:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { indexedParagraphLevel = _v }
-        case 9:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { numberFormatName = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = paragraphIndex { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = pageNumber { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = numberFormat { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = heading { _w.stringField(4, _x) }
-        if let _x = indexedStyle { _w.bytesField(5, _x.encoded()) }
-        if let _x = indexedListStyle { _w.bytesField(6, _x.encoded()) }
-        if let _x = indexedListStart { _w.varintField(7, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = indexedParagraphLevel { _w.varintField(8, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = numberFormatName { _w.stringField(9, _x) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var paragraphIndex: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var pageNumber: UInt32? { get { self[1] } set { self[1] = newValue } }
+    var numberFormat: UInt32? { get { self[2] } set { self[2] = newValue } }
+    var heading: String? { get { self[3] } set { self[3] = newValue } }
+    var indexedStyle: TSP_Reference? { get { self[message: 4] } set { self[message: 4] = newValue } }
+    var indexedListStyle: TSP_Reference? { get { self[message: 5] } set { self[message: 5] = newValue } }
+    var indexedListStart: UInt32? { get { self[6] } set { self[6] = newValue } }
+    var indexedParagraphLevel: UInt32? { get { self[7] } set { self[7] = newValue } }
+    var numberFormatName: String? { get { self[8] } set { self[8] = newValue } }
 }
 
 /// Generated wire model for `TSWP.UndoTransaction`.
 final class TSWP_UndoTransaction: IWAMessage {
-    var entries: [TSWP_UndoTransaction_UnionTransaction] = []
-    var groupEntries: [TSWP_UndoTransaction_StorageActionGroup] = []
-    var flags: UInt32?
-    var version: UInt32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.UndoTransaction", [
+        .repeated(1, TSWP_UndoTransaction_UnionTransaction.self),
+        .repeated(2, TSWP_UndoTransaction_StorageActionGroup.self), .optional(3, .uint32), .optional(4, .uint32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSWP_UndoTransaction_UnionTransaction?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_UndoTransaction_UnionTransaction(ProtobufMessage(_b)) }
-            if let _v { entries.append(_v) }
-        case 2:
-            var _v: TSWP_UndoTransaction_StorageActionGroup?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_UndoTransaction_StorageActionGroup(ProtobufMessage(_b)) }
-            if let _v { groupEntries.append(_v) }
-        case 3:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { flags = _v }
-        case 4:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { version = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in entries { _w.bytesField(1, _x.encoded()) }
-        for _x in groupEntries { _w.bytesField(2, _x.encoded()) }
-        if let _x = flags { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = version { _w.varintField(4, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var entries: [TSWP_UndoTransaction_UnionTransaction] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(entries value: TSWP_UndoTransaction_UnionTransaction) { append(value, toMessages: 0) }
+    var groupEntries: [TSWP_UndoTransaction_StorageActionGroup] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(groupEntries value: TSWP_UndoTransaction_StorageActionGroup) { append(value, toMessages: 1) }
+    var flags: UInt32? { get { self[2] } set { self[2] = newValue } }
+    var version: UInt32? { get { self[3] } set { self[3] = newValue } }
 }
 
 /// Generated wire model for `TSWP.UndoTransaction.GenericTransaction`.
 final class TSWP_UndoTransaction_GenericTransaction: IWAMessage {
-    var value1: UInt32?
-    var value2: UInt32?
-    var value3: UInt32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.UndoTransaction.GenericTransaction", [
+        .optional(1, .uint32), .optional(2, .uint32), .optional(3, .uint32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { value1 = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { value2 = _v }
-        case 3:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { value3 = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = value1 { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = value2 { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = value3 { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var value1: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var value2: UInt32? { get { self[1] } set { self[1] = newValue } }
+    var value3: UInt32? { get { self[2] } set { self[2] = newValue } }
 }
 
 /// Generated wire model for `TSWP.UndoTransaction.TextTransaction`.
 final class TSWP_UndoTransaction_TextTransaction: IWAMessage {
-    var insertLocation: UInt32?
-    var insertLength: UInt32?
-    var stringToDelete: String?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.UndoTransaction.TextTransaction", [
+        .optional(1, .uint32), .optional(2, .uint32), .optional(3, .string),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { insertLocation = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { insertLength = _v }
-        case 3:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { stringToDelete = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = insertLocation { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = insertLength { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = stringToDelete { _w.stringField(3, _x) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var insertLocation: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var insertLength: UInt32? { get { self[1] } set { self[1] = newValue } }
+    var stringToDelete: String? { get { self[2] } set { self[2] = newValue } }
 }
 
 /// Generated wire model for `TSWP.UndoTransaction.CharIndexTransaction`.
 final class TSWP_UndoTransaction_CharIndexTransaction: IWAMessage {
-    var charIndex: UInt32?
-    var count: UInt32?
-    var object: TSP_Reference?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.UndoTransaction.CharIndexTransaction", [
+        .optional(1, .uint32), .optional(2, .uint32), .optional(3, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { charIndex = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { count = _v }
-        case 3:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { object = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = charIndex { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = count { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = object { _w.bytesField(3, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var charIndex: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var count: UInt32? { get { self[1] } set { self[1] = newValue } }
+    var object: TSP_Reference? { get { self[message: 2] } set { self[message: 2] = newValue } }
 }
 
 /// Generated wire model for `TSWP.UndoTransaction.ReplaceCharIndexTransaction`.
 final class TSWP_UndoTransaction_ReplaceCharIndexTransaction: IWAMessage {
-    var attributeIndex: UInt32?
-    var charIndex: UInt32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.UndoTransaction.ReplaceCharIndexTransaction", [
+        .optional(1, .uint32), .optional(2, .uint32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { attributeIndex = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { charIndex = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = attributeIndex { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = charIndex { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var attributeIndex: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var charIndex: UInt32? { get { self[1] } set { self[1] = newValue } }
 }
 
 /// Generated wire model for `TSWP.UndoTransaction.AttributeIndexTransaction`.
 final class TSWP_UndoTransaction_AttributeIndexTransaction: IWAMessage {
-    var attributeIndex: UInt32?
-    var charIndex: UInt32?
-    var object: TSP_Reference?
-    var string: String?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.UndoTransaction.AttributeIndexTransaction", [
+        .optional(1, .uint32), .optional(2, .uint32), .optional(3, TSP_Reference.self), .optional(4, .string),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { attributeIndex = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { charIndex = _v }
-        case 3:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { object = _v }
-        case 4:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { string = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = attributeIndex { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = charIndex { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = object { _w.bytesField(3, _x.encoded()) }
-        if let _x = string { _w.stringField(4, _x) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var attributeIndex: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var charIndex: UInt32? { get { self[1] } set { self[1] = newValue } }
+    var object: TSP_Reference? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var string: String? { get { self[3] } set { self[3] = newValue } }
 }
 
 /// Generated wire model for `TSWP.UndoTransaction.InsertAttributeTransaction`.
 final class TSWP_UndoTransaction_InsertAttributeTransaction: IWAMessage {
-    var attributeIndex: UInt32?
-    var attributeCount: UInt32?
-    var object: TSP_Reference?
-    var string: String?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.UndoTransaction.InsertAttributeTransaction", [
+        .optional(1, .uint32), .optional(2, .uint32), .optional(3, TSP_Reference.self), .optional(4, .string),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { attributeIndex = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { attributeCount = _v }
-        case 3:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { object = _v }
-        case 4:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { string = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = attributeIndex { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = attributeCount { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = object { _w.bytesField(3, _x.encoded()) }
-        if let _x = string { _w.stringField(4, _x) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var attributeIndex: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var attributeCount: UInt32? { get { self[1] } set { self[1] = newValue } }
+    var object: TSP_Reference? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var string: String? { get { self[3] } set { self[3] = newValue } }
 }
 
 /// Generated wire model for `TSWP.UndoTransaction.InsertNilTransaction`.
 final class TSWP_UndoTransaction_InsertNilTransaction: IWAMessage {
-    var attributeIndex: UInt32?
-    var attributeCount: UInt32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.UndoTransaction.InsertNilTransaction", [
+        .optional(1, .uint32), .optional(2, .uint32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { attributeIndex = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { attributeCount = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = attributeIndex { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = attributeCount { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var attributeIndex: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var attributeCount: UInt32? { get { self[1] } set { self[1] = newValue } }
 }
 
 /// Generated wire model for `TSWP.UndoTransaction.CharDeltaTransaction`.
 final class TSWP_UndoTransaction_CharDeltaTransaction: IWAMessage {
-    var charIndex: UInt32?
-    var attributeIndex: UInt32?
-    var charDelta: Int32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.UndoTransaction.CharDeltaTransaction", [
+        .optional(1, .uint32), .optional(2, .uint32), .optional(3, .sint32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { charIndex = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { attributeIndex = _v }
-        case 3:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = IWAWire.unzigzag32(_u) }
-            if let _v { charDelta = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = charIndex { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = attributeIndex { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = charDelta { _w.varintField(3, IWAWire.zigzag32(_x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var charIndex: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var attributeIndex: UInt32? { get { self[1] } set { self[1] = newValue } }
+    var charDelta: Int32? { get { self[2] } set { self[2] = newValue } }
 }
 
 /// Generated wire model for `TSWP.UndoTransaction.ParagraphDataTransaction`.
 final class TSWP_UndoTransaction_ParagraphDataTransaction: IWAMessage {
-    var attributeIndex: UInt32?
-    var first: UInt32?
-    var second: UInt32?
-    var charIndex: UInt32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.UndoTransaction.ParagraphDataTransaction", [
+        .optional(1, .uint32), .optional(2, .uint32), .optional(3, .uint32), .optional(4, .uint32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { attributeIndex = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { first = _v }
-        case 3:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { second = _v }
-        case 4:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { charIndex = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = attributeIndex { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = first { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = second { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = charIndex { _w.varintField(4, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var attributeIndex: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var first: UInt32? { get { self[1] } set { self[1] = newValue } }
+    var second: UInt32? { get { self[2] } set { self[2] = newValue } }
+    var charIndex: UInt32? { get { self[3] } set { self[3] = newValue } }
 }
 
 /// Generated wire model for `TSWP.UndoTransaction.ObjectDOLCTransaction`.
 final class TSWP_UndoTransaction_ObjectDOLCTransaction: IWAMessage {
-    var flags: UInt32?
-    var object: TSP_Reference?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.UndoTransaction.ObjectDOLCTransaction", [
+        .optional(1, .uint32), .optional(2, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { flags = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { object = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = flags { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = object { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var flags: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var object: TSP_Reference? { get { self[message: 1] } set { self[message: 1] = newValue } }
 }
 
 /// Generated wire model for `TSWP.UndoTransaction.CTDateTransaction`.
 final class TSWP_UndoTransaction_CTDateTransaction: IWAMessage {
-    var attributeIndex: UInt32?
-    var date: TSP_Date?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.UndoTransaction.CTDateTransaction", [
+        .optional(1, .uint32), .optional(2, TSP_Date.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { attributeIndex = _v }
-        case 2:
-            var _v: TSP_Date?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Date(ProtobufMessage(_b)) }
-            if let _v { date = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = attributeIndex { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = date { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var attributeIndex: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var date: TSP_Date? { get { self[message: 1] } set { self[message: 1] = newValue } }
 }
 
 /// Generated wire model for `TSWP.UndoTransaction.UnionTransaction`.
 final class TSWP_UndoTransaction_UnionTransaction: IWAMessage {
-    var kind: Int32?
-    var table: UInt32?
-    var generic: TSWP_UndoTransaction_GenericTransaction?
-    var text: TSWP_UndoTransaction_TextTransaction?
-    var charIndex: TSWP_UndoTransaction_CharIndexTransaction?
-    var replaceCharIndex: TSWP_UndoTransaction_ReplaceCharIndexTransaction?
-    var attributeIndex: TSWP_UndoTransaction_AttributeIndexTransaction?
-    var insertNil: TSWP_UndoTransaction_InsertNilTransaction?
-    var insertAttribute: TSWP_UndoTransaction_InsertAttributeTransaction?
-    var charDelta: TSWP_UndoTransaction_CharDeltaTransaction?
-    var paragraphData: TSWP_UndoTransaction_ParagraphDataTransaction?
-    var objectDolc: TSWP_UndoTransaction_ObjectDOLCTransaction?
-    var ctDate: TSWP_UndoTransaction_CTDateTransaction?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { kind = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { table = _v }
-        case 5:
-            var _v: TSWP_UndoTransaction_GenericTransaction?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_UndoTransaction_GenericTransaction(ProtobufMessage(_b)) }
-            if let _v { generic = _v }
-        case 6:
-            var _v: TSWP_UndoTransaction_TextTransaction?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_UndoTransaction_TextTransaction(ProtobufMessage(_b)) }
-            if let _v { text = _v }
-        case 7:
-            var _v: TSWP_UndoTransaction_CharIndexTransaction?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_UndoTransaction_CharIndexTransaction(ProtobufMessage(_b)) }
-            if let _v { charIndex = _v }
-        case 8:
-            var _v: TSWP_UndoTransaction_ReplaceCharIndexTransaction?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_UndoTransaction_ReplaceCharIndexTransaction(ProtobufMessage(_b)) }
-            if let _v { replaceCharIndex = _v }
-        case 9:
-            var _v: TSWP_UndoTransaction_AttributeIndexTransaction?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_UndoTransaction_AttributeIndexTransaction(ProtobufMessage(_b)) }
-            if let _v { attributeIndex = _v }
-        case 10:
-            var _v: TSWP_UndoTransaction_InsertNilTransaction?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_UndoTransaction_InsertNilTransaction(ProtobufMessage(_b)) }
-            if let _v { insertNil = _v }
-        case 11:
-            var _v: TSWP_UndoTransaction_InsertAttributeTransaction?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_UndoTransaction_InsertAttributeTransaction(ProtobufMessage(_b)) }
-            if let _v { insertAttribute = _v }
-        case 12:
-            var _v: TSWP_UndoTransaction_CharDeltaTransaction?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_UndoTransaction_CharDeltaTransaction(ProtobufMessage(_b)) }
-            if let _v { charDelta = _v }
-        case 13:
-            var _v: TSWP_UndoTransaction_ParagraphDataTransaction?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_UndoTransaction_ParagraphDataTransaction(ProtobufMessage(_b)) }
-            if let _v { paragraphData = _v }
-        case 14:
-            var _v: TSWP_UndoTransaction_ObjectDOLCTransaction?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_UndoTransaction_ObjectDOLCTransaction(ProtobufMessage(_b)) }
-            if let _v { objectDolc = _v }
-        case 15:
-            var _v: TSWP_UndoTransaction_CTDateTransaction?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_UndoTransaction_CTDateTransaction(ProtobufMessage(_b)) }
-            if let _v { ctDate = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = kind { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = table { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = generic { _w.bytesField(5, _x.encoded()) }
-        if let _x = text { _w.bytesField(6, _x.encoded()) }
-        if let _x = charIndex { _w.bytesField(7, _x.encoded()) }
-        if let _x = replaceCharIndex { _w.bytesField(8, _x.encoded()) }
-        if let _x = attributeIndex { _w.bytesField(9, _x.encoded()) }
-        if let _x = insertNil { _w.bytesField(10, _x.encoded()) }
-        if let _x = insertAttribute { _w.bytesField(11, _x.encoded()) }
-        if let _x = charDelta { _w.bytesField(12, _x.encoded()) }
-        if let _x = paragraphData { _w.bytesField(13, _x.encoded()) }
-        if let _x = objectDolc { _w.bytesField(14, _x.encoded()) }
-        if let _x = ctDate { _w.bytesField(15, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSWP.UndoTransaction.UnionTransaction", [
+        .optional(1, .int32), .optional(2, .uint32), .optional(5, TSWP_UndoTransaction_GenericTransaction.self),
+        .optional(6, TSWP_UndoTransaction_TextTransaction.self),
+        .optional(7, TSWP_UndoTransaction_CharIndexTransaction.self),
+        .optional(8, TSWP_UndoTransaction_ReplaceCharIndexTransaction.self),
+        .optional(9, TSWP_UndoTransaction_AttributeIndexTransaction.self),
+        .optional(10, TSWP_UndoTransaction_InsertNilTransaction.self),
+        .optional(11, TSWP_UndoTransaction_InsertAttributeTransaction.self),
+        .optional(12, TSWP_UndoTransaction_CharDeltaTransaction.self),
+        .optional(13, TSWP_UndoTransaction_ParagraphDataTransaction.self),
+        .optional(14, TSWP_UndoTransaction_ObjectDOLCTransaction.self),
+        .optional(15, TSWP_UndoTransaction_CTDateTransaction.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 13)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var kind: Int32? { get { self[0] } set { self[0] = newValue } }
+    var table: UInt32? { get { self[1] } set { self[1] = newValue } }
+    var generic: TSWP_UndoTransaction_GenericTransaction? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var text: TSWP_UndoTransaction_TextTransaction? { get { self[message: 3] } set { self[message: 3] = newValue } }
+    var charIndex: TSWP_UndoTransaction_CharIndexTransaction? { get { self[message: 4] } set { self[message: 4] = newValue } }
+    var replaceCharIndex: TSWP_UndoTransaction_ReplaceCharIndexTransaction? { get { self[message: 5] } set { self[message: 5] = newValue } }
+    var attributeIndex: TSWP_UndoTransaction_AttributeIndexTransaction? { get { self[message: 6] } set { self[message: 6] = newValue } }
+    var insertNil: TSWP_UndoTransaction_InsertNilTransaction? { get { self[message: 7] } set { self[message: 7] = newValue } }
+    var insertAttribute: TSWP_UndoTransaction_InsertAttributeTransaction? { get { self[message: 8] } set { self[message: 8] = newValue } }
+    var charDelta: TSWP_UndoTransaction_CharDeltaTransaction? { get { self[message: 9] } set { self[message: 9] = newValue } }
+    var paragraphData: TSWP_UndoTransaction_ParagraphDataTransaction? { get { self[message: 10] } set { self[message: 10] = newValue } }
+    var objectDolc: TSWP_UndoTransaction_ObjectDOLCTransaction? { get { self[message: 11] } set { self[message: 11] = newValue } }
+    var ctDate: TSWP_UndoTransaction_CTDateTransaction? { get { self[message: 12] } set { self[message: 12] = newValue } }
 }
 
 /// Generated wire model for `TSWP.UndoTransaction.StorageAction`.
 final class TSWP_UndoTransaction_StorageAction: IWAMessage {
-    var kind: Int32?
-    var flags: UInt32?
-    var table: UInt32?
-    var range: TSP_Range?
-    var string: String?
-    var object: TSP_Reference?
-    var date: TSP_Date?
-    var paragraphLevel: UInt32?
-    var paragraphFlags: UInt32?
-    var paragraphValue: UInt32?
-    var placementIndex: Int32?
-    var placementUuidPath: String?
-    var undoObject: TSP_Reference?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { kind = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { flags = _v }
-        case 3:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { table = _v }
-        case 4:
-            var _v: TSP_Range?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Range(ProtobufMessage(_b)) }
-            if let _v { range = _v }
-        case 5:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { string = _v }
-        case 6:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { object = _v }
-        case 7:
-            var _v: TSP_Date?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Date(ProtobufMessage(_b)) }
-            if let _v { date = _v }
-        case 8:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { paragraphLevel = _v }
-        case 9:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { paragraphFlags = _v }
-        case 10:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { paragraphValue = _v }
-        case 11:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { placementIndex = _v }
-        case 12:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { placementUuidPath = _v }
-        case 13:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { undoObject = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = kind { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = flags { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = table { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = range { _w.bytesField(4, _x.encoded()) }
-        if let _x = string { _w.stringField(5, _x) }
-        if let _x = object { _w.bytesField(6, _x.encoded()) }
-        if let _x = date { _w.bytesField(7, _x.encoded()) }
-        if let _x = paragraphLevel { _w.varintField(8, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = paragraphFlags { _w.varintField(9, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = paragraphValue { _w.varintField(10, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = placementIndex { _w.varintField(11, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = placementUuidPath { _w.stringField(12, _x) }
-        if let _x = undoObject { _w.bytesField(13, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSWP.UndoTransaction.StorageAction", [
+        .optional(1, .int32), .optional(2, .uint32), .optional(3, .uint32), .optional(4, TSP_Range.self),
+        .optional(5, .string), .optional(6, TSP_Reference.self), .optional(7, TSP_Date.self), .optional(8, .uint32),
+        .optional(9, .uint32), .optional(10, .uint32), .optional(11, .int32), .optional(12, .string),
+        .optional(13, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 13)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var kind: Int32? { get { self[0] } set { self[0] = newValue } }
+    var flags: UInt32? { get { self[1] } set { self[1] = newValue } }
+    var table: UInt32? { get { self[2] } set { self[2] = newValue } }
+    var range: TSP_Range? { get { self[message: 3] } set { self[message: 3] = newValue } }
+    var string: String? { get { self[4] } set { self[4] = newValue } }
+    var object: TSP_Reference? { get { self[message: 5] } set { self[message: 5] = newValue } }
+    var date: TSP_Date? { get { self[message: 6] } set { self[message: 6] = newValue } }
+    var paragraphLevel: UInt32? { get { self[7] } set { self[7] = newValue } }
+    var paragraphFlags: UInt32? { get { self[8] } set { self[8] = newValue } }
+    var paragraphValue: UInt32? { get { self[9] } set { self[9] = newValue } }
+    var placementIndex: Int32? { get { self[10] } set { self[10] = newValue } }
+    var placementUuidPath: String? { get { self[11] } set { self[11] = newValue } }
+    var undoObject: TSP_Reference? { get { self[message: 12] } set { self[message: 12] = newValue } }
 }
 
 /// Generated wire model for `TSWP.UndoTransaction.StorageActionGroup`.
 final class TSWP_UndoTransaction_StorageActionGroup: IWAMessage {
-    var kind: Int32?
-    var forwardActions: [TSWP_UndoTransaction_StorageAction] = []
-    var inverseForwardActions: [TSWP_UndoTransaction_StorageAction] = []
-    var inverseDetailActions: [TSWP_UndoTransaction_StorageAction] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.UndoTransaction.StorageActionGroup", [
+        .optional(1, .int32), .repeated(3, TSWP_UndoTransaction_StorageAction.self),
+        .repeated(4, TSWP_UndoTransaction_StorageAction.self), .repeated(6, TSWP_UndoTransaction_StorageAction.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { kind = _v }
-        case 3:
-            var _v: TSWP_UndoTransaction_StorageAction?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_UndoTransaction_StorageAction(ProtobufMessage(_b)) }
-            if let _v { forwardActions.append(_v) }
-        case 4:
-            var _v: TSWP_UndoTransaction_StorageAction?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_UndoTransaction_StorageAction(ProtobufMessage(_b)) }
-            if let _v { inverseForwardActions.append(_v) }
-        case 6:
-            var _v: TSWP_UndoTransaction_StorageAction?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_UndoTransaction_StorageAction(ProtobufMessage(_b)) }
-            if let _v { inverseDetailActions.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = kind { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        for _x in forwardActions { _w.bytesField(3, _x.encoded()) }
-        for _x in inverseForwardActions { _w.bytesField(4, _x.encoded()) }
-        for _x in inverseDetailActions { _w.bytesField(6, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var kind: Int32? { get { self[0] } set { self[0] = newValue } }
+    var forwardActions: [TSWP_UndoTransaction_StorageAction] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(forwardActions value: TSWP_UndoTransaction_StorageAction) { append(value, toMessages: 1) }
+    var inverseForwardActions: [TSWP_UndoTransaction_StorageAction] { get { self[messages: 2] } set { self[messages: 2] = newValue } }
+    func append(inverseForwardActions value: TSWP_UndoTransaction_StorageAction) { append(value, toMessages: 2) }
+    var inverseDetailActions: [TSWP_UndoTransaction_StorageAction] { get { self[messages: 3] } set { self[messages: 3] = newValue } }
+    func append(inverseDetailActions value: TSWP_UndoTransaction_StorageAction) { append(value, toMessages: 3) }
 }
 
 /// Generated wire model for `TSWP.UndoTransactionWrapperArchive`.
 final class TSWP_UndoTransactionWrapperArchive: IWAMessage {
-    var undoTransaction: TSWP_UndoTransaction?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.UndoTransactionWrapperArchive", [
+        .optional(1, TSWP_UndoTransaction.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSWP_UndoTransaction?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_UndoTransaction(ProtobufMessage(_b)) }
-            if let _v { undoTransaction = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = undoTransaction { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var undoTransaction: TSWP_UndoTransaction? { get { self[message: 0] } set { self[message: 0] = newValue } }
 }
 
 /// Generated wire model for `TSWP.ShapeInfoArchive`.
 final class TSWP_ShapeInfoArchive: IWAMessage {
-    var `super`: TSD_ShapeArchive?
-    var deprecatedStorage: TSP_Reference?
-    var textFlow: TSP_Reference?
-    var ownedStorage: TSP_Reference?
-    var isTextBox: Bool?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.ShapeInfoArchive", [
+        .optional(1, TSD_ShapeArchive.self), .optional(2, TSP_Reference.self), .optional(3, TSP_Reference.self),
+        .optional(4, TSP_Reference.self), .optional(6, .bool),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 5)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSD_ShapeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_ShapeArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { deprecatedStorage = _v }
-        case 3:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { textFlow = _v }
-        case 4:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { ownedStorage = _v }
-        case 6:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { isTextBox = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = deprecatedStorage { _w.bytesField(2, _x.encoded()) }
-        if let _x = textFlow { _w.bytesField(3, _x.encoded()) }
-        if let _x = ownedStorage { _w.bytesField(4, _x.encoded()) }
-        if let _x = isTextBox { _w.varintField(6, _x ? 1 : 0) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var `super`: TSD_ShapeArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var deprecatedStorage: TSP_Reference? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var textFlow: TSP_Reference? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var ownedStorage: TSP_Reference? { get { self[message: 3] } set { self[message: 3] = newValue } }
+    var isTextBox: Bool? { get { self[4] } set { self[4] = newValue } }
 }
 
 /// Generated wire model for `TSWP.CommentInfoArchive`.
 final class TSWP_CommentInfoArchive: IWAMessage {
-    var `super`: TSWP_ShapeInfoArchive?
-    var commentStorage: TSP_Reference?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.CommentInfoArchive", [
+        .optional(1, TSWP_ShapeInfoArchive.self), .optional(2, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSWP_ShapeInfoArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_ShapeInfoArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { commentStorage = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = commentStorage { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var `super`: TSWP_ShapeInfoArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var commentStorage: TSP_Reference? { get { self[message: 1] } set { self[message: 1] = newValue } }
 }
 
 /// Generated wire model for `TSWP.TOCInfoArchive`.
 final class TSWP_TOCInfoArchive: IWAMessage {
-    var `super`: TSWP_ShapeInfoArchive?
-    var tocSettings: TSP_Reference?
-    var tocEntryData: [TSP_Reference] = []
-    var pageNumberRanges: [TSP_Range] = []
-    var syncTocSettingsWithTocNavigator: Bool?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.TOCInfoArchive", [
+        .optional(1, TSWP_ShapeInfoArchive.self), .optional(2, TSP_Reference.self), .repeated(3, TSP_Reference.self),
+        .repeated(4, TSP_Range.self), .optional(5, .bool),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 5)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSWP_ShapeInfoArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_ShapeInfoArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { tocSettings = _v }
-        case 3:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { tocEntryData.append(_v) }
-        case 4:
-            var _v: TSP_Range?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Range(ProtobufMessage(_b)) }
-            if let _v { pageNumberRanges.append(_v) }
-        case 5:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { syncTocSettingsWithTocNavigator = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = tocSettings { _w.bytesField(2, _x.encoded()) }
-        for _x in tocEntryData { _w.bytesField(3, _x.encoded()) }
-        for _x in pageNumberRanges { _w.bytesField(4, _x.encoded()) }
-        if let _x = syncTocSettingsWithTocNavigator { _w.varintField(5, _x ? 1 : 0) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var `super`: TSWP_ShapeInfoArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var tocSettings: TSP_Reference? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var tocEntryData: [TSP_Reference] { get { self[messages: 2] } set { self[messages: 2] = newValue } }
+    func append(tocEntryData value: TSP_Reference) { append(value, toMessages: 2) }
+    var pageNumberRanges: [TSP_Range] { get { self[messages: 3] } set { self[messages: 3] = newValue } }
+    func append(pageNumberRanges value: TSP_Range) { append(value, toMessages: 3) }
+    var syncTocSettingsWithTocNavigator: Bool? { get { self[4] } set { self[4] = newValue } }
 }
 
 /// Generated wire model for `TSWP.TOCLayoutHintArchive`.
 final class TSWP_TOCLayoutHintArchive: IWAMessage {
-    var charrange: TSP_Range?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.TOCLayoutHintArchive", [
+        .optional(1, TSP_Range.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Range?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Range(ProtobufMessage(_b)) }
-            if let _v { charrange = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = charrange { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var charrange: TSP_Range? { get { self[message: 0] } set { self[message: 0] = newValue } }
 }
 
 /// Generated wire model for `TSWP.EquationInfoArchive`.
 final class TSWP_EquationInfoArchive: IWAMessage {
-
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.EquationInfoArchive", [])
+    var _values = [IWAValue](repeating: .absent, count: 0)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
 }
 
 /// Generated wire model for `TSWP.TextualAttachmentArchive`.
 final class TSWP_TextualAttachmentArchive: IWAMessage {
-    var stringEquivalent: String?
-    var kind: Int32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.TextualAttachmentArchive", [
+        .optional(1, .string), .optional(2, .int32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { stringEquivalent = _v }
-        case 2:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { kind = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = stringEquivalent { _w.stringField(1, _x) }
-        if let _x = kind { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var stringEquivalent: String? { get { self[0] } set { self[0] = newValue } }
+    var kind: Int32? { get { self[1] } set { self[1] = newValue } }
 }
 
 /// Generated wire model for `TSWP.TSWPTOCPageNumberAttachmentArchive`.
 final class TSWP_TSWPTOCPageNumberAttachmentArchive: IWAMessage {
-    var `super`: TSWP_TextualAttachmentArchive?
-    var pageNumber: String?
-    var bookmarkName: String?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.TSWPTOCPageNumberAttachmentArchive", [
+        .optional(1, TSWP_TextualAttachmentArchive.self), .optional(2, .string), .optional(3, .string),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSWP_TextualAttachmentArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_TextualAttachmentArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { pageNumber = _v }
-        case 3:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { bookmarkName = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = pageNumber { _w.stringField(2, _x) }
-        if let _x = bookmarkName { _w.stringField(3, _x) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var `super`: TSWP_TextualAttachmentArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var pageNumber: String? { get { self[1] } set { self[1] = newValue } }
+    var bookmarkName: String? { get { self[2] } set { self[2] = newValue } }
 }
 
 /// Generated wire model for `TSWP.UIGraphicalAttachment`.
 final class TSWP_UIGraphicalAttachment: IWAMessage {
-
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.UIGraphicalAttachment", [])
+    var _values = [IWAValue](repeating: .absent, count: 0)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
 }
 
 /// Generated wire model for `TSWP.DrawableAttachmentArchive`.
 final class TSWP_DrawableAttachmentArchive: IWAMessage {
-    var drawable: TSP_Reference?
-    var hOffsetType: UInt32?
-    var hOffset: Float?
-    var vOffsetType: UInt32?
-    var vOffset: Float?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.DrawableAttachmentArchive", [
+        .optional(1, TSP_Reference.self), .optional(2, .uint32), .optional(3, .float), .optional(4, .uint32),
+        .optional(5, .float),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 5)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { drawable = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { hOffsetType = _v }
-        case 3:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { hOffset = _v }
-        case 4:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { vOffsetType = _v }
-        case 5:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { vOffset = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = drawable { _w.bytesField(1, _x.encoded()) }
-        if let _x = hOffsetType { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = hOffset { _w.fixed32Field(3, _x.bitPattern) }
-        if let _x = vOffsetType { _w.varintField(4, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = vOffset { _w.fixed32Field(5, _x.bitPattern) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var drawable: TSP_Reference? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var hOffsetType: UInt32? { get { self[1] } set { self[1] = newValue } }
+    var hOffset: Float? { get { self[2] } set { self[2] = newValue } }
+    var vOffsetType: UInt32? { get { self[3] } set { self[3] = newValue } }
+    var vOffset: Float? { get { self[4] } set { self[4] = newValue } }
 }
 
 /// Generated wire model for `TSWP.TOCAttachmentArchive`.
 final class TSWP_TOCAttachmentArchive: IWAMessage {
-    var `super`: TSWP_DrawableAttachmentArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.TOCAttachmentArchive", [
+        .optional(1, TSWP_DrawableAttachmentArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSWP_DrawableAttachmentArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_DrawableAttachmentArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var `super`: TSWP_DrawableAttachmentArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
 }
 
 /// Generated wire model for `TSWP.FootnoteReferenceAttachmentArchive`.
 final class TSWP_FootnoteReferenceAttachmentArchive: IWAMessage {
-    var `super`: TSWP_TextualAttachmentArchive?
-    var containedStorage: TSP_Reference?
-    var customMarkString: String?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.FootnoteReferenceAttachmentArchive", [
+        .optional(1, TSWP_TextualAttachmentArchive.self), .optional(2, TSP_Reference.self), .optional(3, .string),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSWP_TextualAttachmentArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_TextualAttachmentArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { containedStorage = _v }
-        case 3:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { customMarkString = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = containedStorage { _w.bytesField(2, _x.encoded()) }
-        if let _x = customMarkString { _w.stringField(3, _x) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var `super`: TSWP_TextualAttachmentArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var containedStorage: TSP_Reference? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var customMarkString: String? { get { self[2] } set { self[2] = newValue } }
 }
 
 /// Generated wire model for `TSWP.NumberAttachmentArchive`.
 final class TSWP_NumberAttachmentArchive: IWAMessage {
-    var `super`: TSWP_TextualAttachmentArchive?
-    var numberFormat: UInt32?
-    var stringValue: String?
-    var numberFormatName: String?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.NumberAttachmentArchive", [
+        .optional(1, TSWP_TextualAttachmentArchive.self), .optional(2, .uint32), .optional(3, .string),
+        .optional(4, .string),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSWP_TextualAttachmentArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_TextualAttachmentArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { numberFormat = _v }
-        case 3:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { stringValue = _v }
-        case 4:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { numberFormatName = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = numberFormat { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = stringValue { _w.stringField(3, _x) }
-        if let _x = numberFormatName { _w.stringField(4, _x) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var `super`: TSWP_TextualAttachmentArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var numberFormat: UInt32? { get { self[1] } set { self[1] = newValue } }
+    var stringValue: String? { get { self[2] } set { self[2] = newValue } }
+    var numberFormatName: String? { get { self[3] } set { self[3] = newValue } }
 }
 
 /// Generated wire model for `TSWP.SmartFieldArchive`.
 final class TSWP_SmartFieldArchive: IWAMessage {
-    var textAttributeUuidString: String?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.SmartFieldArchive", [
+        .optional(1, .string),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { textAttributeUuidString = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = textAttributeUuidString { _w.stringField(1, _x) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var textAttributeUuidString: String? { get { self[0] } set { self[0] = newValue } }
 }
 
 /// Generated wire model for `TSWP.HyperlinkFieldArchive`.
 final class TSWP_HyperlinkFieldArchive: IWAMessage {
-    var `super`: TSWP_SmartFieldArchive?
-    var urlRef: String?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.HyperlinkFieldArchive", [
+        .optional(1, TSWP_SmartFieldArchive.self), .optional(2, .string),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSWP_SmartFieldArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_SmartFieldArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { urlRef = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = urlRef { _w.stringField(2, _x) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var `super`: TSWP_SmartFieldArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var urlRef: String? { get { self[1] } set { self[1] = newValue } }
 }
 
 /// Generated wire model for `TSWP.PlaceholderSmartFieldArchive`.
 final class TSWP_PlaceholderSmartFieldArchive: IWAMessage {
-    var `super`: TSWP_SmartFieldArchive?
-    var localizable: Bool?
-    var scriptTag: String?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.PlaceholderSmartFieldArchive", [
+        .optional(1, TSWP_SmartFieldArchive.self), .optional(2, .bool), .optional(3, .string),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSWP_SmartFieldArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_SmartFieldArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { localizable = _v }
-        case 3:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { scriptTag = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = localizable { _w.varintField(2, _x ? 1 : 0) }
-        if let _x = scriptTag { _w.stringField(3, _x) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var `super`: TSWP_SmartFieldArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var localizable: Bool? { get { self[1] } set { self[1] = newValue } }
+    var scriptTag: String? { get { self[2] } set { self[2] = newValue } }
 }
 
 /// Generated wire model for `TSWP.UnsupportedHyperlinkFieldArchive`.
 final class TSWP_UnsupportedHyperlinkFieldArchive: IWAMessage {
-    var `super`: TSWP_PlaceholderSmartFieldArchive?
-    var urlRef: String?
-    var urlOriginalRef: String?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.UnsupportedHyperlinkFieldArchive", [
+        .optional(1, TSWP_PlaceholderSmartFieldArchive.self), .optional(2, .string), .optional(3, .string),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSWP_PlaceholderSmartFieldArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_PlaceholderSmartFieldArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { urlRef = _v }
-        case 3:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { urlOriginalRef = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = urlRef { _w.stringField(2, _x) }
-        if let _x = urlOriginalRef { _w.stringField(3, _x) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var `super`: TSWP_PlaceholderSmartFieldArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var urlRef: String? { get { self[1] } set { self[1] = newValue } }
+    var urlOriginalRef: String? { get { self[2] } set { self[2] = newValue } }
 }
 
 /// Generated wire model for `TSWP.BibliographySmartFieldArchive`.
 final class TSWP_BibliographySmartFieldArchive: IWAMessage {
-    var `super`: TSWP_SmartFieldArchive?
-    var citationRecords: [TSP_Reference] = []
-    var localizable: Bool?
-    var oldSuper: TSWP_PlaceholderSmartFieldArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.BibliographySmartFieldArchive", [
+        .optional(3, TSWP_SmartFieldArchive.self), .repeated(2, TSP_Reference.self), .optional(4, .bool),
+        .optional(1, TSWP_PlaceholderSmartFieldArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 3:
-            var _v: TSWP_SmartFieldArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_SmartFieldArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { citationRecords.append(_v) }
-        case 4:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { localizable = _v }
-        case 1:
-            var _v: TSWP_PlaceholderSmartFieldArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_PlaceholderSmartFieldArchive(ProtobufMessage(_b)) }
-            if let _v { oldSuper = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(3, _x.encoded()) }
-        for _x in citationRecords { _w.bytesField(2, _x.encoded()) }
-        if let _x = localizable { _w.varintField(4, _x ? 1 : 0) }
-        if let _x = oldSuper { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var `super`: TSWP_SmartFieldArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var citationRecords: [TSP_Reference] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(citationRecords value: TSP_Reference) { append(value, toMessages: 1) }
+    var localizable: Bool? { get { self[2] } set { self[2] = newValue } }
+    var oldSuper: TSWP_PlaceholderSmartFieldArchive? { get { self[message: 3] } set { self[message: 3] = newValue } }
 }
 
 /// Generated wire model for `TSWP.CitationRecordArchive`.
 final class TSWP_CitationRecordArchive: IWAMessage {
-    var endnoteXml: String?
-    var hideAuthorNames: Bool?
-    var hideYear: Bool?
-    var pageRange: String?
-    var prefix: String?
-    var suffix: String?
-    var authorsString: String?
-    var title: String?
-    var year: String?
-    var type: String?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.CitationRecordArchive", [
+        .optional(1, .string), .optional(2, .bool), .optional(3, .bool), .optional(4, .string), .optional(5, .string),
+        .optional(6, .string), .optional(7, .string), .optional(8, .string), .optional(9, .string),
+        .optional(10, .string),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 10)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { endnoteXml = _v }
-        case 2:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { hideAuthorNames = _v }
-        case 3:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { hideYear = _v }
-        case 4:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { pageRange = _v }
-        case 5:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { prefix = _v }
-        case 6:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { suffix = _v }
-        case 7:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { authorsString = _v }
-        case 8:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { title = _v }
-        case 9:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { year = _v }
-        case 10:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { type = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = endnoteXml { _w.stringField(1, _x) }
-        if let _x = hideAuthorNames { _w.varintField(2, _x ? 1 : 0) }
-        if let _x = hideYear { _w.varintField(3, _x ? 1 : 0) }
-        if let _x = pageRange { _w.stringField(4, _x) }
-        if let _x = prefix { _w.stringField(5, _x) }
-        if let _x = suffix { _w.stringField(6, _x) }
-        if let _x = authorsString { _w.stringField(7, _x) }
-        if let _x = title { _w.stringField(8, _x) }
-        if let _x = year { _w.stringField(9, _x) }
-        if let _x = type { _w.stringField(10, _x) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var endnoteXml: String? { get { self[0] } set { self[0] = newValue } }
+    var hideAuthorNames: Bool? { get { self[1] } set { self[1] = newValue } }
+    var hideYear: Bool? { get { self[2] } set { self[2] = newValue } }
+    var pageRange: String? { get { self[3] } set { self[3] = newValue } }
+    var prefix: String? { get { self[4] } set { self[4] = newValue } }
+    var suffix: String? { get { self[5] } set { self[5] = newValue } }
+    var authorsString: String? { get { self[6] } set { self[6] = newValue } }
+    var title: String? { get { self[7] } set { self[7] = newValue } }
+    var year: String? { get { self[8] } set { self[8] = newValue } }
+    var type: String? { get { self[9] } set { self[9] = newValue } }
 }
 
 /// Generated wire model for `TSWP.CitationSmartFieldArchive`.
 final class TSWP_CitationSmartFieldArchive: IWAMessage {
-    var `super`: TSWP_SmartFieldArchive?
-    var citationRecords: [TSP_Reference] = []
-    var localizable: Bool?
-    var oldSuper: TSWP_PlaceholderSmartFieldArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.CitationSmartFieldArchive", [
+        .optional(3, TSWP_SmartFieldArchive.self), .repeated(2, TSP_Reference.self), .optional(4, .bool),
+        .optional(1, TSWP_PlaceholderSmartFieldArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 3:
-            var _v: TSWP_SmartFieldArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_SmartFieldArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { citationRecords.append(_v) }
-        case 4:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { localizable = _v }
-        case 1:
-            var _v: TSWP_PlaceholderSmartFieldArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_PlaceholderSmartFieldArchive(ProtobufMessage(_b)) }
-            if let _v { oldSuper = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(3, _x.encoded()) }
-        for _x in citationRecords { _w.bytesField(2, _x.encoded()) }
-        if let _x = localizable { _w.varintField(4, _x ? 1 : 0) }
-        if let _x = oldSuper { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var `super`: TSWP_SmartFieldArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var citationRecords: [TSP_Reference] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(citationRecords value: TSP_Reference) { append(value, toMessages: 1) }
+    var localizable: Bool? { get { self[2] } set { self[2] = newValue } }
+    var oldSuper: TSWP_PlaceholderSmartFieldArchive? { get { self[message: 3] } set { self[message: 3] = newValue } }
 }
 
 /// Generated wire model for `TSWP.DateTimeSmartFieldArchive`.
 final class TSWP_DateTimeSmartFieldArchive: IWAMessage {
-    var `super`: TSWP_SmartFieldArchive?
-    var format: String?
-    var localeIdentifier: String?
-    var dateStyle: Int32?
-    var timeStyle: Int32?
-    var updatePlan: Int32?
-    var needsUpdate: Bool?
-    var date: TSP_Date?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.DateTimeSmartFieldArchive", [
+        .optional(1, TSWP_SmartFieldArchive.self), .optional(2, .string), .optional(3, .string), .optional(4, .int32),
+        .optional(5, .int32), .optional(6, .int32), .optional(7, .bool), .optional(8, TSP_Date.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 8)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSWP_SmartFieldArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_SmartFieldArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { format = _v }
-        case 3:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { localeIdentifier = _v }
-        case 4:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { dateStyle = _v }
-        case 5:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { timeStyle = _v }
-        case 6:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { updatePlan = _v }
-        case 7:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { needsUpdate = _v }
-        case 8:
-            var _v: TSP_Date?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Date(ProtobufMessage(_b)) }
-            if let _v { date = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = format { _w.stringField(2, _x) }
-        if let _x = localeIdentifier { _w.stringField(3, _x) }
-        if let _x = dateStyle { _w.varintField(4, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = timeStyle { _w.varintField(5, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = updatePlan { _w.varintField(6, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = needsUpdate { _w.varintField(7, _x ? 1 : 0) }
-        if let _x = date { _w.bytesField(8, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var `super`: TSWP_SmartFieldArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var format: String? { get { self[1] } set { self[1] = newValue } }
+    var localeIdentifier: String? { get { self[2] } set { self[2] = newValue } }
+    var dateStyle: Int32? { get { self[3] } set { self[3] = newValue } }
+    var timeStyle: Int32? { get { self[4] } set { self[4] = newValue } }
+    var updatePlan: Int32? { get { self[5] } set { self[5] = newValue } }
+    var needsUpdate: Bool? { get { self[6] } set { self[6] = newValue } }
+    var date: TSP_Date? { get { self[message: 7] } set { self[message: 7] = newValue } }
 }
 
 /// Generated wire model for `TSWP.BookmarkFieldArchive`.
 final class TSWP_BookmarkFieldArchive: IWAMessage {
-    var `super`: TSWP_SmartFieldArchive?
-    var name: String?
-    var ranged: UInt32?
-    var hidden: UInt32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.BookmarkFieldArchive", [
+        .optional(1, TSWP_SmartFieldArchive.self), .optional(2, .string), .optional(3, .uint32), .optional(4, .uint32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSWP_SmartFieldArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_SmartFieldArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { name = _v }
-        case 3:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { ranged = _v }
-        case 4:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { hidden = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = name { _w.stringField(2, _x) }
-        if let _x = ranged { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = hidden { _w.varintField(4, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var `super`: TSWP_SmartFieldArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var name: String? { get { self[1] } set { self[1] = newValue } }
+    var ranged: UInt32? { get { self[2] } set { self[2] = newValue } }
+    var hidden: UInt32? { get { self[3] } set { self[3] = newValue } }
 }
 
 /// Generated wire model for `TSWP.FilenameSmartFieldArchive`.
 final class TSWP_FilenameSmartFieldArchive: IWAMessage {
-    var `super`: TSWP_PlaceholderSmartFieldArchive?
-    var displayFlags: UInt32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.FilenameSmartFieldArchive", [
+        .optional(1, TSWP_PlaceholderSmartFieldArchive.self), .optional(2, .uint32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSWP_PlaceholderSmartFieldArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_PlaceholderSmartFieldArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { displayFlags = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = displayFlags { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var `super`: TSWP_PlaceholderSmartFieldArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var displayFlags: UInt32? { get { self[1] } set { self[1] = newValue } }
 }
 
 /// Generated wire model for `TSWP.MergeFieldTypeArchive`.
 final class TSWP_MergeFieldTypeArchive: IWAMessage {
-    var contactsProperty: String?
-    var contactsKey: String?
-    var contactsLabel: String?
-    var tableKey: String?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.MergeFieldTypeArchive", [
+        .optional(2, .string), .optional(3, .string), .optional(4, .string), .optional(5, .string),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 2:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { contactsProperty = _v }
-        case 3:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { contactsKey = _v }
-        case 4:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { contactsLabel = _v }
-        case 5:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { tableKey = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = contactsProperty { _w.stringField(2, _x) }
-        if let _x = contactsKey { _w.stringField(3, _x) }
-        if let _x = contactsLabel { _w.stringField(4, _x) }
-        if let _x = tableKey { _w.stringField(5, _x) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var contactsProperty: String? { get { self[0] } set { self[0] = newValue } }
+    var contactsKey: String? { get { self[1] } set { self[1] = newValue } }
+    var contactsLabel: String? { get { self[2] } set { self[2] = newValue } }
+    var tableKey: String? { get { self[3] } set { self[3] = newValue } }
 }
 
 /// Generated wire model for `TSWP.MergeSmartFieldArchive`.
 final class TSWP_MergeSmartFieldArchive: IWAMessage {
-    var `super`: TSWP_PlaceholderSmartFieldArchive?
-    var contactsProperty: String?
-    var contactsKey: String?
-    var contactsLabel: String?
-    var category: Int32?
-    var requiresFollowingWhitespace: Bool?
-    var whitespace: String?
-    var guid: String?
-    var tableKey: String?
-    var fieldType: TSWP_MergeFieldTypeArchive?
-    var hasCustomText: Bool?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.MergeSmartFieldArchive", [
+        .optional(1, TSWP_PlaceholderSmartFieldArchive.self), .optional(2, .string), .optional(3, .string),
+        .optional(4, .string), .optional(5, .int32), .optional(6, .bool), .optional(7, .string), .optional(8, .string),
+        .optional(9, .string), .optional(10, TSWP_MergeFieldTypeArchive.self), .optional(11, .bool),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 11)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSWP_PlaceholderSmartFieldArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_PlaceholderSmartFieldArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { contactsProperty = _v }
-        case 3:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { contactsKey = _v }
-        case 4:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { contactsLabel = _v }
-        case 5:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { category = _v }
-        case 6:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { requiresFollowingWhitespace = _v }
-        case 7:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { whitespace = _v }
-        case 8:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { guid = _v }
-        case 9:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { tableKey = _v }
-        case 10:
-            var _v: TSWP_MergeFieldTypeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_MergeFieldTypeArchive(ProtobufMessage(_b)) }
-            if let _v { fieldType = _v }
-        case 11:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { hasCustomText = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = contactsProperty { _w.stringField(2, _x) }
-        if let _x = contactsKey { _w.stringField(3, _x) }
-        if let _x = contactsLabel { _w.stringField(4, _x) }
-        if let _x = category { _w.varintField(5, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = requiresFollowingWhitespace { _w.varintField(6, _x ? 1 : 0) }
-        if let _x = whitespace { _w.stringField(7, _x) }
-        if let _x = guid { _w.stringField(8, _x) }
-        if let _x = tableKey { _w.stringField(9, _x) }
-        if let _x = fieldType { _w.bytesField(10, _x.encoded()) }
-        if let _x = hasCustomText { _w.varintField(11, _x ? 1 : 0) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var `super`: TSWP_PlaceholderSmartFieldArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var contactsProperty: String? { get { self[1] } set { self[1] = newValue } }
+    var contactsKey: String? { get { self[2] } set { self[2] = newValue } }
+    var contactsLabel: String? { get { self[3] } set { self[3] = newValue } }
+    var category: Int32? { get { self[4] } set { self[4] = newValue } }
+    var requiresFollowingWhitespace: Bool? { get { self[5] } set { self[5] = newValue } }
+    var whitespace: String? { get { self[6] } set { self[6] = newValue } }
+    var guid: String? { get { self[7] } set { self[7] = newValue } }
+    var tableKey: String? { get { self[8] } set { self[8] = newValue } }
+    var fieldType: TSWP_MergeFieldTypeArchive? { get { self[message: 9] } set { self[message: 9] = newValue } }
+    var hasCustomText: Bool? { get { self[10] } set { self[10] = newValue } }
 }
 
 /// Generated wire model for `TSWP.TOCSmartFieldArchive`.
 final class TSWP_TOCSmartFieldArchive: IWAMessage {
-    var `super`: TSWP_PlaceholderSmartFieldArchive?
-    var tocEntries: [TSWP_TOCSmartFieldArchive_TOCEntry] = []
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.TOCSmartFieldArchive", [
+        .optional(1, TSWP_PlaceholderSmartFieldArchive.self), .repeated(2, TSWP_TOCSmartFieldArchive_TOCEntry.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSWP_PlaceholderSmartFieldArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_PlaceholderSmartFieldArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: TSWP_TOCSmartFieldArchive_TOCEntry?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_TOCSmartFieldArchive_TOCEntry(ProtobufMessage(_b)) }
-            if let _v { tocEntries.append(_v) }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        for _x in tocEntries { _w.bytesField(2, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var `super`: TSWP_PlaceholderSmartFieldArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var tocEntries: [TSWP_TOCSmartFieldArchive_TOCEntry] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(tocEntries value: TSWP_TOCSmartFieldArchive_TOCEntry) { append(value, toMessages: 1) }
 }
 
 /// Generated wire model for `TSWP.TOCSmartFieldArchive.TOCEntry`.
 final class TSWP_TOCSmartFieldArchive_TOCEntry: IWAMessage {
-    var bookmarkName: String?
-    var targetStyle: TSP_Reference?
-    var range: TSP_Range?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.TOCSmartFieldArchive.TOCEntry", [
+        .optional(1, .string), .optional(2, TSP_Reference.self), .optional(3, TSP_Range.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { bookmarkName = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { targetStyle = _v }
-        case 3:
-            var _v: TSP_Range?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Range(ProtobufMessage(_b)) }
-            if let _v { range = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = bookmarkName { _w.stringField(1, _x) }
-        if let _x = targetStyle { _w.bytesField(2, _x.encoded()) }
-        if let _x = range { _w.bytesField(3, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var bookmarkName: String? { get { self[0] } set { self[0] = newValue } }
+    var targetStyle: TSP_Reference? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var range: TSP_Range? { get { self[message: 2] } set { self[message: 2] = newValue } }
 }
 
 /// Generated wire model for `TSWP.RubyFieldArchive`.
 final class TSWP_RubyFieldArchive: IWAMessage {
-    var `super`: TSWP_SmartFieldArchive?
-    var rubyText: String?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.RubyFieldArchive", [
+        .optional(1, TSWP_SmartFieldArchive.self), .optional(2, .string),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSWP_SmartFieldArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_SmartFieldArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 2:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { rubyText = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = rubyText { _w.stringField(2, _x) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var `super`: TSWP_SmartFieldArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var rubyText: String? { get { self[1] } set { self[1] = newValue } }
 }
 
 /// Generated wire model for `TSWP.TateChuYokoFieldArchive`.
 final class TSWP_TateChuYokoFieldArchive: IWAMessage {
-    var `super`: TSWP_SmartFieldArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.TateChuYokoFieldArchive", [
+        .optional(1, TSWP_SmartFieldArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSWP_SmartFieldArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_SmartFieldArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var `super`: TSWP_SmartFieldArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
 }
 
 /// Generated wire model for `TSWP.ChangeArchive`.
 final class TSWP_ChangeArchive: IWAMessage {
-    var kind: Int32?
-    var session: TSP_Reference?
-    var date: TSP_Date?
-    var textAttributeUuidString: String?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.ChangeArchive", [
+        .optional(1, .int32), .optional(2, TSP_Reference.self), .optional(3, TSP_Date.self), .optional(4, .string),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { kind = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { session = _v }
-        case 3:
-            var _v: TSP_Date?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Date(ProtobufMessage(_b)) }
-            if let _v { date = _v }
-        case 4:
-            var _v: String?
-            if case .lengthDelimited(let _b) = _f.value { _v = String(decoding: _b, as: UTF8.self) }
-            if let _v { textAttributeUuidString = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = kind { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = session { _w.bytesField(2, _x.encoded()) }
-        if let _x = date { _w.bytesField(3, _x.encoded()) }
-        if let _x = textAttributeUuidString { _w.stringField(4, _x) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var kind: Int32? { get { self[0] } set { self[0] = newValue } }
+    var session: TSP_Reference? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var date: TSP_Date? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var textAttributeUuidString: String? { get { self[3] } set { self[3] = newValue } }
 }
 
 /// Generated wire model for `TSWP.ChangeSessionArchive`.
 final class TSWP_ChangeSessionArchive: IWAMessage {
-    var sessionUid: UInt32?
-    var author: TSP_Reference?
-    var date: TSP_Date?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.ChangeSessionArchive", [
+        .optional(1, .uint32), .optional(2, TSP_Reference.self), .optional(3, TSP_Date.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { sessionUid = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { author = _v }
-        case 3:
-            var _v: TSP_Date?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Date(ProtobufMessage(_b)) }
-            if let _v { date = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = sessionUid { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = author { _w.bytesField(2, _x.encoded()) }
-        if let _x = date { _w.bytesField(3, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var sessionUid: UInt32? { get { self[0] } set { self[0] = newValue } }
+    var author: TSP_Reference? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var date: TSP_Date? { get { self[message: 2] } set { self[message: 2] = newValue } }
 }
 
 /// Generated wire model for `TSWP.SectionPlaceholderArchive`.
 final class TSWP_SectionPlaceholderArchive: IWAMessage {
-    var parentStorage: TSP_Reference?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.SectionPlaceholderArchive", [
+        .optional(1, TSP_Reference.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { parentStorage = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = parentStorage { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var parentStorage: TSP_Reference? { get { self[message: 0] } set { self[message: 0] = newValue } }
 }
 
 /// Generated wire model for `TSWP.HyperlinkSelectionArchive`.
 final class TSWP_HyperlinkSelectionArchive: IWAMessage {
-
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.HyperlinkSelectionArchive", [])
+    var _values = [IWAValue](repeating: .absent, count: 0)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
 }
 
 /// Generated wire model for `TSWP.DateTimeSelectionArchive`.
 final class TSWP_DateTimeSelectionArchive: IWAMessage {
-
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.DateTimeSelectionArchive", [])
+    var _values = [IWAValue](repeating: .absent, count: 0)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
 }
 
 /// Generated wire model for `TSWP.FlowInfoArchive`.
 final class TSWP_FlowInfoArchive: IWAMessage {
-    var textStorage: TSP_Reference?
-    var textboxes: [TSP_Reference] = []
-    var userInterfaceIdentifier: UInt32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.FlowInfoArchive", [
+        .optional(1, TSP_Reference.self), .repeated(2, TSP_Reference.self), .optional(3, .uint32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 3)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { textStorage = _v }
-        case 2:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { textboxes.append(_v) }
-        case 3:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { userInterfaceIdentifier = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = textStorage { _w.bytesField(1, _x.encoded()) }
-        for _x in textboxes { _w.bytesField(2, _x.encoded()) }
-        if let _x = userInterfaceIdentifier { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var textStorage: TSP_Reference? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var textboxes: [TSP_Reference] { get { self[messages: 1] } set { self[messages: 1] = newValue } }
+    func append(textboxes value: TSP_Reference) { append(value, toMessages: 1) }
+    var userInterfaceIdentifier: UInt32? { get { self[2] } set { self[2] = newValue } }
 }
 
 /// Generated wire model for `TSWP.FlowInfoContainerArchive`.
 final class TSWP_FlowInfoContainerArchive: IWAMessage {
-    var flowInfos: [TSP_Reference] = []
-    var nextUserInterfaceIdentifier: UInt32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.FlowInfoContainerArchive", [
+        .repeated(1, TSP_Reference.self), .optional(2, .uint32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 2)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSP_Reference?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSP_Reference(ProtobufMessage(_b)) }
-            if let _v { flowInfos.append(_v) }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { nextUserInterfaceIdentifier = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        for _x in flowInfos { _w.bytesField(1, _x.encoded()) }
-        if let _x = nextUserInterfaceIdentifier { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var flowInfos: [TSP_Reference] { get { self[messages: 0] } set { self[messages: 0] = newValue } }
+    func append(flowInfos value: TSP_Reference) { append(value, toMessages: 0) }
+    var nextUserInterfaceIdentifier: UInt32? { get { self[1] } set { self[1] = newValue } }
 }
 
 /// Generated wire model for `TSWP.DropCapArchive`.
 final class TSWP_DropCapArchive: IWAMessage {
-    var type: Int32?
-    var numberOfLines: UInt32?
-    var numberOfRaisedLines: UInt32?
-    var deprecatedOutdent: Float?
-    var outdent: Double?
-    var deprecatedPadding: Float?
-    var padding: Double?
-    var wrapType: Int32?
-    var shapeEnabled: Bool?
-    var deprecatedCornerRadius: Float?
-    var cornerRadius: Double?
-    var deprecatedCharacterScale: Float?
-    var characterScale: Double?
-    var numberOfCharacters: UInt32?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
-    var unknownFields: [ProtobufField] = []
-
-    init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { type = _v }
-        case 2:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { numberOfLines = _v }
-        case 3:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { numberOfRaisedLines = _v }
-        case 4:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { deprecatedOutdent = _v }
-        case 11:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { outdent = _v }
-        case 5:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { deprecatedPadding = _v }
-        case 12:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { padding = _v }
-        case 6:
-            var _v: Int32?
-            if case .varint(let _u) = _f.value { _v = Int32(truncatingIfNeeded: _u) }
-            if let _v { wrapType = _v }
-        case 7:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { shapeEnabled = _v }
-        case 8:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { deprecatedCornerRadius = _v }
-        case 13:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { cornerRadius = _v }
-        case 9:
-            var _v: Float?
-            if case .fixed32(let _b) = _f.value { _v = Float(bitPattern: IWAWire.u32(_b)) }
-            if let _v { deprecatedCharacterScale = _v }
-        case 14:
-            var _v: Double?
-            if case .fixed64(let _b) = _f.value { _v = Double(bitPattern: IWAWire.u64(_b)) }
-            if let _v { characterScale = _v }
-        case 10:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { numberOfCharacters = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = type { _w.varintField(1, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = numberOfLines { _w.varintField(2, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = numberOfRaisedLines { _w.varintField(3, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = deprecatedOutdent { _w.fixed32Field(4, _x.bitPattern) }
-        if let _x = outdent { _w.fixed64Field(11, _x.bitPattern) }
-        if let _x = deprecatedPadding { _w.fixed32Field(5, _x.bitPattern) }
-        if let _x = padding { _w.fixed64Field(12, _x.bitPattern) }
-        if let _x = wrapType { _w.varintField(6, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = shapeEnabled { _w.varintField(7, _x ? 1 : 0) }
-        if let _x = deprecatedCornerRadius { _w.fixed32Field(8, _x.bitPattern) }
-        if let _x = cornerRadius { _w.fixed64Field(13, _x.bitPattern) }
-        if let _x = deprecatedCharacterScale { _w.fixed32Field(9, _x.bitPattern) }
-        if let _x = characterScale { _w.fixed64Field(14, _x.bitPattern) }
-        if let _x = numberOfCharacters { _w.varintField(10, UInt64(truncatingIfNeeded: _x)) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+    static let schema = IWASchema("TSWP.DropCapArchive", [
+        .optional(1, .int32), .optional(2, .uint32), .optional(3, .uint32), .optional(4, .float),
+        .optional(11, .double), .optional(5, .float), .optional(12, .double), .optional(6, .int32), .optional(7, .bool),
+        .optional(8, .float), .optional(13, .double), .optional(9, .float), .optional(14, .double),
+        .optional(10, .uint32),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 14)
+    var unknownFields: [ProtobufField] = []
+    init() {}
+
+    var type: Int32? { get { self[0] } set { self[0] = newValue } }
+    var numberOfLines: UInt32? { get { self[1] } set { self[1] = newValue } }
+    var numberOfRaisedLines: UInt32? { get { self[2] } set { self[2] = newValue } }
+    var deprecatedOutdent: Float? { get { self[3] } set { self[3] = newValue } }
+    var outdent: Double? { get { self[4] } set { self[4] = newValue } }
+    var deprecatedPadding: Float? { get { self[5] } set { self[5] = newValue } }
+    var padding: Double? { get { self[6] } set { self[6] = newValue } }
+    var wrapType: Int32? { get { self[7] } set { self[7] = newValue } }
+    var shapeEnabled: Bool? { get { self[8] } set { self[8] = newValue } }
+    var deprecatedCornerRadius: Float? { get { self[9] } set { self[9] = newValue } }
+    var cornerRadius: Double? { get { self[10] } set { self[10] = newValue } }
+    var deprecatedCharacterScale: Float? { get { self[11] } set { self[11] = newValue } }
+    var characterScale: Double? { get { self[12] } set { self[12] = newValue } }
+    var numberOfCharacters: UInt32? { get { self[13] } set { self[13] = newValue } }
 }
 
 /// Generated wire model for `TSWP.DropCapStylePropertiesArchive`.
 final class TSWP_DropCapStylePropertiesArchive: IWAMessage {
-    var dropCap: TSWP_DropCapArchive?
-    var dropCapShapeStroke: TSD_StrokeArchive?
-    var dropCapShapeFillNull: Bool?
-    var dropCapShapeFill: TSD_FillArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.DropCapStylePropertiesArchive", [
+        .optional(1, TSWP_DropCapArchive.self), .optional(3, TSD_StrokeArchive.self), .optional(4, .bool),
+        .optional(5, TSD_FillArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSWP_DropCapArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_DropCapArchive(ProtobufMessage(_b)) }
-            if let _v { dropCap = _v }
-        case 3:
-            var _v: TSD_StrokeArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_StrokeArchive(ProtobufMessage(_b)) }
-            if let _v { dropCapShapeStroke = _v }
-        case 4:
-            var _v: Bool?
-            if case .varint(let _u) = _f.value { _v = _u != 0 }
-            if let _v { dropCapShapeFillNull = _v }
-        case 5:
-            var _v: TSD_FillArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSD_FillArchive(ProtobufMessage(_b)) }
-            if let _v { dropCapShapeFill = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = dropCap { _w.bytesField(1, _x.encoded()) }
-        if let _x = dropCapShapeStroke { _w.bytesField(3, _x.encoded()) }
-        if let _x = dropCapShapeFillNull { _w.varintField(4, _x ? 1 : 0) }
-        if let _x = dropCapShapeFill { _w.bytesField(5, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var dropCap: TSWP_DropCapArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var dropCapShapeStroke: TSD_StrokeArchive? { get { self[message: 1] } set { self[message: 1] = newValue } }
+    var dropCapShapeFillNull: Bool? { get { self[2] } set { self[2] = newValue } }
+    var dropCapShapeFill: TSD_FillArchive? { get { self[message: 3] } set { self[message: 3] = newValue } }
 }
 
 /// Generated wire model for `TSWP.DropCapStyleArchive`.
 final class TSWP_DropCapStyleArchive: IWAMessage {
-    var `super`: TSS_StyleArchive?
-    var overrideCount: UInt32?
-    var charProperties: TSWP_CharacterStylePropertiesArchive?
-    var dropCapProperties: TSWP_DropCapStylePropertiesArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.DropCapStyleArchive", [
+        .optional(1, TSS_StyleArchive.self), .optional(10, .uint32),
+        .optional(11, TSWP_CharacterStylePropertiesArchive.self),
+        .optional(12, TSWP_DropCapStylePropertiesArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 4)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSS_StyleArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSS_StyleArchive(ProtobufMessage(_b)) }
-            if let _v { `super` = _v }
-        case 10:
-            var _v: UInt32?
-            if case .varint(let _u) = _f.value { _v = UInt32(truncatingIfNeeded: _u) }
-            if let _v { overrideCount = _v }
-        case 11:
-            var _v: TSWP_CharacterStylePropertiesArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_CharacterStylePropertiesArchive(ProtobufMessage(_b)) }
-            if let _v { charProperties = _v }
-        case 12:
-            var _v: TSWP_DropCapStylePropertiesArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_DropCapStylePropertiesArchive(ProtobufMessage(_b)) }
-            if let _v { dropCapProperties = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = `super` { _w.bytesField(1, _x.encoded()) }
-        if let _x = overrideCount { _w.varintField(10, UInt64(truncatingIfNeeded: _x)) }
-        if let _x = charProperties { _w.bytesField(11, _x.encoded()) }
-        if let _x = dropCapProperties { _w.bytesField(12, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var `super`: TSS_StyleArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
+    var overrideCount: UInt32? { get { self[1] } set { self[1] = newValue } }
+    var charProperties: TSWP_CharacterStylePropertiesArchive? { get { self[message: 2] } set { self[message: 2] = newValue } }
+    var dropCapProperties: TSWP_DropCapStylePropertiesArchive? { get { self[message: 3] } set { self[message: 3] = newValue } }
 }
 
 /// Generated wire model for `TSWP.CollaboratorTextCursorSubselectionArchive`.
 final class TSWP_CollaboratorTextCursorSubselectionArchive: IWAMessage {
-    var textSelection: TSWP_SelectionArchive?
-    /// Fields not modeled above, preserved verbatim for lossless round-trip.
+    static let schema = IWASchema("TSWP.CollaboratorTextCursorSubselectionArchive", [
+        .optional(1, TSWP_SelectionArchive.self),
+    ])
+    var _values = [IWAValue](repeating: .absent, count: 1)
     var unknownFields: [ProtobufField] = []
-
     init() {}
-    init(_ _pb: ProtobufMessage) {
-        for _f in _pb.fields {
-            switch _f.number {
-        case 1:
-            var _v: TSWP_SelectionArchive?
-            if case .lengthDelimited(let _b) = _f.value { _v = TSWP_SelectionArchive(ProtobufMessage(_b)) }
-            if let _v { textSelection = _v }
-                default: unknownFields.append(_f)
-            }
-        }
-    }
-    func encoded() -> [UInt8] {
-        var _w = ProtobufWriter()
-        if let _x = textSelection { _w.bytesField(1, _x.encoded()) }
-        for _f in unknownFields { _w.append(_f) }
-        return _w.bytes
-    }
+
+    var textSelection: TSWP_SelectionArchive? { get { self[message: 0] } set { self[message: 0] = newValue } }
 }
 
 /// Registers this file's archives into the reflective catalog.
-func registerIWA_TSWPArchives(_ into: inout [(name: String, decode: (ProtobufMessage) -> IWAMessage)]) {
-    into.append(("TSWP.SelectionArchive", { TSWP_SelectionArchive($0) as IWAMessage }))
-    into.append(("TSWP.ObjectAttributeTable", { TSWP_ObjectAttributeTable($0) as IWAMessage }))
-    into.append(("TSWP.ObjectAttributeTable.ObjectAttribute", { TSWP_ObjectAttributeTable_ObjectAttribute($0) as IWAMessage }))
-    into.append(("TSWP.StringAttributeTable", { TSWP_StringAttributeTable($0) as IWAMessage }))
-    into.append(("TSWP.StringAttributeTable.StringAttribute", { TSWP_StringAttributeTable_StringAttribute($0) as IWAMessage }))
-    into.append(("TSWP.ParaDataAttributeTable", { TSWP_ParaDataAttributeTable($0) as IWAMessage }))
-    into.append(("TSWP.ParaDataAttributeTable.ParaDataAttribute", { TSWP_ParaDataAttributeTable_ParaDataAttribute($0) as IWAMessage }))
-    into.append(("TSWP.OverlappingFieldAttributeTable", { TSWP_OverlappingFieldAttributeTable($0) as IWAMessage }))
-    into.append(("TSWP.OverlappingFieldAttributeTable.OverlappingFieldAttribute", { TSWP_OverlappingFieldAttributeTable_OverlappingFieldAttribute($0) as IWAMessage }))
-    into.append(("TSWP.StorageArchive", { TSWP_StorageArchive($0) as IWAMessage }))
-    into.append(("TSWP.HighlightArchive", { TSWP_HighlightArchive($0) as IWAMessage }))
-    into.append(("TSWP.PencilAnnotationArchive", { TSWP_PencilAnnotationArchive($0) as IWAMessage }))
-    into.append(("TSWP.FontFeatureArchive", { TSWP_FontFeatureArchive($0) as IWAMessage }))
-    into.append(("TSWP.CharacterStylePropertiesArchive", { TSWP_CharacterStylePropertiesArchive($0) as IWAMessage }))
-    into.append(("TSWP.CharacterStyleArchive", { TSWP_CharacterStyleArchive($0) as IWAMessage }))
-    into.append(("TSWP.TabArchive", { TSWP_TabArchive($0) as IWAMessage }))
-    into.append(("TSWP.TabsArchive", { TSWP_TabsArchive($0) as IWAMessage }))
-    into.append(("TSWP.LineSpacingArchive", { TSWP_LineSpacingArchive($0) as IWAMessage }))
-    into.append(("TSWP.ParagraphStylePropertiesArchive", { TSWP_ParagraphStylePropertiesArchive($0) as IWAMessage }))
-    into.append(("TSWP.ParagraphStyleArchive", { TSWP_ParagraphStyleArchive($0) as IWAMessage }))
-    into.append(("TSWP.ListStyleArchive", { TSWP_ListStyleArchive($0) as IWAMessage }))
-    into.append(("TSWP.ListStyleArchive.LabelGeometry", { TSWP_ListStyleArchive_LabelGeometry($0) as IWAMessage }))
-    into.append(("TSWP.ListStyleArchive.LabelImage", { TSWP_ListStyleArchive_LabelImage($0) as IWAMessage }))
-    into.append(("TSWP.TextStylePresetArchive", { TSWP_TextStylePresetArchive($0) as IWAMessage }))
-    into.append(("TSWP.ColumnsArchive", { TSWP_ColumnsArchive($0) as IWAMessage }))
-    into.append(("TSWP.ColumnsArchive.EqualColumnsArchive", { TSWP_ColumnsArchive_EqualColumnsArchive($0) as IWAMessage }))
-    into.append(("TSWP.ColumnsArchive.NonEqualColumnsArchive", { TSWP_ColumnsArchive_NonEqualColumnsArchive($0) as IWAMessage }))
-    into.append(("TSWP.ColumnsArchive.NonEqualColumnsArchive.GapWidthArchive", { TSWP_ColumnsArchive_NonEqualColumnsArchive_GapWidthArchive($0) as IWAMessage }))
-    into.append(("TSWP.PaddingArchive", { TSWP_PaddingArchive($0) as IWAMessage }))
-    into.append(("TSWP.ColumnStylePropertiesArchive", { TSWP_ColumnStylePropertiesArchive($0) as IWAMessage }))
-    into.append(("TSWP.ColumnStyleArchive", { TSWP_ColumnStyleArchive($0) as IWAMessage }))
-    into.append(("TSWP.ShapeStylePropertiesArchive", { TSWP_ShapeStylePropertiesArchive($0) as IWAMessage }))
-    into.append(("TSWP.ShapeStyleArchive", { TSWP_ShapeStyleArchive($0) as IWAMessage }))
-    into.append(("TSWP.ThemePresetsArchive", { TSWP_ThemePresetsArchive($0) as IWAMessage }))
-    into.append(("TSWP.TextPresetDisplayItemArchive", { TSWP_TextPresetDisplayItemArchive($0) as IWAMessage }))
-    into.append(("TSWP.TOCEntryStylePropertiesArchive", { TSWP_TOCEntryStylePropertiesArchive($0) as IWAMessage }))
-    into.append(("TSWP.TOCEntryStyleArchive", { TSWP_TOCEntryStyleArchive($0) as IWAMessage }))
-    into.append(("TSWP.TOCSettingsArchive", { TSWP_TOCSettingsArchive($0) as IWAMessage }))
-    into.append(("TSWP.TOCSettingsArchive.TOCEntryData", { TSWP_TOCSettingsArchive_TOCEntryData($0) as IWAMessage }))
-    into.append(("TSWP.TOCEntryInstanceArchive", { TSWP_TOCEntryInstanceArchive($0) as IWAMessage }))
-    into.append(("TSWP.UndoTransaction", { TSWP_UndoTransaction($0) as IWAMessage }))
-    into.append(("TSWP.UndoTransaction.GenericTransaction", { TSWP_UndoTransaction_GenericTransaction($0) as IWAMessage }))
-    into.append(("TSWP.UndoTransaction.TextTransaction", { TSWP_UndoTransaction_TextTransaction($0) as IWAMessage }))
-    into.append(("TSWP.UndoTransaction.CharIndexTransaction", { TSWP_UndoTransaction_CharIndexTransaction($0) as IWAMessage }))
-    into.append(("TSWP.UndoTransaction.ReplaceCharIndexTransaction", { TSWP_UndoTransaction_ReplaceCharIndexTransaction($0) as IWAMessage }))
-    into.append(("TSWP.UndoTransaction.AttributeIndexTransaction", { TSWP_UndoTransaction_AttributeIndexTransaction($0) as IWAMessage }))
-    into.append(("TSWP.UndoTransaction.InsertAttributeTransaction", { TSWP_UndoTransaction_InsertAttributeTransaction($0) as IWAMessage }))
-    into.append(("TSWP.UndoTransaction.InsertNilTransaction", { TSWP_UndoTransaction_InsertNilTransaction($0) as IWAMessage }))
-    into.append(("TSWP.UndoTransaction.CharDeltaTransaction", { TSWP_UndoTransaction_CharDeltaTransaction($0) as IWAMessage }))
-    into.append(("TSWP.UndoTransaction.ParagraphDataTransaction", { TSWP_UndoTransaction_ParagraphDataTransaction($0) as IWAMessage }))
-    into.append(("TSWP.UndoTransaction.ObjectDOLCTransaction", { TSWP_UndoTransaction_ObjectDOLCTransaction($0) as IWAMessage }))
-    into.append(("TSWP.UndoTransaction.CTDateTransaction", { TSWP_UndoTransaction_CTDateTransaction($0) as IWAMessage }))
-    into.append(("TSWP.UndoTransaction.UnionTransaction", { TSWP_UndoTransaction_UnionTransaction($0) as IWAMessage }))
-    into.append(("TSWP.UndoTransaction.StorageAction", { TSWP_UndoTransaction_StorageAction($0) as IWAMessage }))
-    into.append(("TSWP.UndoTransaction.StorageActionGroup", { TSWP_UndoTransaction_StorageActionGroup($0) as IWAMessage }))
-    into.append(("TSWP.UndoTransactionWrapperArchive", { TSWP_UndoTransactionWrapperArchive($0) as IWAMessage }))
-    into.append(("TSWP.ShapeInfoArchive", { TSWP_ShapeInfoArchive($0) as IWAMessage }))
-    into.append(("TSWP.CommentInfoArchive", { TSWP_CommentInfoArchive($0) as IWAMessage }))
-    into.append(("TSWP.TOCInfoArchive", { TSWP_TOCInfoArchive($0) as IWAMessage }))
-    into.append(("TSWP.TOCLayoutHintArchive", { TSWP_TOCLayoutHintArchive($0) as IWAMessage }))
-    into.append(("TSWP.EquationInfoArchive", { TSWP_EquationInfoArchive($0) as IWAMessage }))
-    into.append(("TSWP.TextualAttachmentArchive", { TSWP_TextualAttachmentArchive($0) as IWAMessage }))
-    into.append(("TSWP.TSWPTOCPageNumberAttachmentArchive", { TSWP_TSWPTOCPageNumberAttachmentArchive($0) as IWAMessage }))
-    into.append(("TSWP.UIGraphicalAttachment", { TSWP_UIGraphicalAttachment($0) as IWAMessage }))
-    into.append(("TSWP.DrawableAttachmentArchive", { TSWP_DrawableAttachmentArchive($0) as IWAMessage }))
-    into.append(("TSWP.TOCAttachmentArchive", { TSWP_TOCAttachmentArchive($0) as IWAMessage }))
-    into.append(("TSWP.FootnoteReferenceAttachmentArchive", { TSWP_FootnoteReferenceAttachmentArchive($0) as IWAMessage }))
-    into.append(("TSWP.NumberAttachmentArchive", { TSWP_NumberAttachmentArchive($0) as IWAMessage }))
-    into.append(("TSWP.SmartFieldArchive", { TSWP_SmartFieldArchive($0) as IWAMessage }))
-    into.append(("TSWP.HyperlinkFieldArchive", { TSWP_HyperlinkFieldArchive($0) as IWAMessage }))
-    into.append(("TSWP.PlaceholderSmartFieldArchive", { TSWP_PlaceholderSmartFieldArchive($0) as IWAMessage }))
-    into.append(("TSWP.UnsupportedHyperlinkFieldArchive", { TSWP_UnsupportedHyperlinkFieldArchive($0) as IWAMessage }))
-    into.append(("TSWP.BibliographySmartFieldArchive", { TSWP_BibliographySmartFieldArchive($0) as IWAMessage }))
-    into.append(("TSWP.CitationRecordArchive", { TSWP_CitationRecordArchive($0) as IWAMessage }))
-    into.append(("TSWP.CitationSmartFieldArchive", { TSWP_CitationSmartFieldArchive($0) as IWAMessage }))
-    into.append(("TSWP.DateTimeSmartFieldArchive", { TSWP_DateTimeSmartFieldArchive($0) as IWAMessage }))
-    into.append(("TSWP.BookmarkFieldArchive", { TSWP_BookmarkFieldArchive($0) as IWAMessage }))
-    into.append(("TSWP.FilenameSmartFieldArchive", { TSWP_FilenameSmartFieldArchive($0) as IWAMessage }))
-    into.append(("TSWP.MergeFieldTypeArchive", { TSWP_MergeFieldTypeArchive($0) as IWAMessage }))
-    into.append(("TSWP.MergeSmartFieldArchive", { TSWP_MergeSmartFieldArchive($0) as IWAMessage }))
-    into.append(("TSWP.TOCSmartFieldArchive", { TSWP_TOCSmartFieldArchive($0) as IWAMessage }))
-    into.append(("TSWP.TOCSmartFieldArchive.TOCEntry", { TSWP_TOCSmartFieldArchive_TOCEntry($0) as IWAMessage }))
-    into.append(("TSWP.RubyFieldArchive", { TSWP_RubyFieldArchive($0) as IWAMessage }))
-    into.append(("TSWP.TateChuYokoFieldArchive", { TSWP_TateChuYokoFieldArchive($0) as IWAMessage }))
-    into.append(("TSWP.ChangeArchive", { TSWP_ChangeArchive($0) as IWAMessage }))
-    into.append(("TSWP.ChangeSessionArchive", { TSWP_ChangeSessionArchive($0) as IWAMessage }))
-    into.append(("TSWP.SectionPlaceholderArchive", { TSWP_SectionPlaceholderArchive($0) as IWAMessage }))
-    into.append(("TSWP.HyperlinkSelectionArchive", { TSWP_HyperlinkSelectionArchive($0) as IWAMessage }))
-    into.append(("TSWP.DateTimeSelectionArchive", { TSWP_DateTimeSelectionArchive($0) as IWAMessage }))
-    into.append(("TSWP.FlowInfoArchive", { TSWP_FlowInfoArchive($0) as IWAMessage }))
-    into.append(("TSWP.FlowInfoContainerArchive", { TSWP_FlowInfoContainerArchive($0) as IWAMessage }))
-    into.append(("TSWP.DropCapArchive", { TSWP_DropCapArchive($0) as IWAMessage }))
-    into.append(("TSWP.DropCapStylePropertiesArchive", { TSWP_DropCapStylePropertiesArchive($0) as IWAMessage }))
-    into.append(("TSWP.DropCapStyleArchive", { TSWP_DropCapStyleArchive($0) as IWAMessage }))
-    into.append(("TSWP.CollaboratorTextCursorSubselectionArchive", { TSWP_CollaboratorTextCursorSubselectionArchive($0) as IWAMessage }))
+func registerIWA_TSWPArchives(_ into: inout [any IWAMessage.Type]) {
+    into += [
+        TSWP_SelectionArchive.self, TSWP_ObjectAttributeTable.self, TSWP_ObjectAttributeTable_ObjectAttribute.self,
+        TSWP_StringAttributeTable.self, TSWP_StringAttributeTable_StringAttribute.self,
+        TSWP_ParaDataAttributeTable.self, TSWP_ParaDataAttributeTable_ParaDataAttribute.self,
+        TSWP_OverlappingFieldAttributeTable.self, TSWP_OverlappingFieldAttributeTable_OverlappingFieldAttribute.self,
+        TSWP_StorageArchive.self, TSWP_HighlightArchive.self, TSWP_PencilAnnotationArchive.self,
+        TSWP_FontFeatureArchive.self, TSWP_CharacterStylePropertiesArchive.self, TSWP_CharacterStyleArchive.self,
+        TSWP_TabArchive.self, TSWP_TabsArchive.self, TSWP_LineSpacingArchive.self,
+        TSWP_ParagraphStylePropertiesArchive.self, TSWP_ParagraphStyleArchive.self, TSWP_ListStyleArchive.self,
+        TSWP_ListStyleArchive_LabelGeometry.self, TSWP_ListStyleArchive_LabelImage.self,
+        TSWP_TextStylePresetArchive.self, TSWP_ColumnsArchive.self, TSWP_ColumnsArchive_EqualColumnsArchive.self,
+        TSWP_ColumnsArchive_NonEqualColumnsArchive.self,
+        TSWP_ColumnsArchive_NonEqualColumnsArchive_GapWidthArchive.self, TSWP_PaddingArchive.self,
+        TSWP_ColumnStylePropertiesArchive.self, TSWP_ColumnStyleArchive.self, TSWP_ShapeStylePropertiesArchive.self,
+        TSWP_ShapeStyleArchive.self, TSWP_ThemePresetsArchive.self, TSWP_TextPresetDisplayItemArchive.self,
+        TSWP_TOCEntryStylePropertiesArchive.self, TSWP_TOCEntryStyleArchive.self, TSWP_TOCSettingsArchive.self,
+        TSWP_TOCSettingsArchive_TOCEntryData.self, TSWP_TOCEntryInstanceArchive.self, TSWP_UndoTransaction.self,
+        TSWP_UndoTransaction_GenericTransaction.self, TSWP_UndoTransaction_TextTransaction.self,
+        TSWP_UndoTransaction_CharIndexTransaction.self, TSWP_UndoTransaction_ReplaceCharIndexTransaction.self,
+        TSWP_UndoTransaction_AttributeIndexTransaction.self, TSWP_UndoTransaction_InsertAttributeTransaction.self,
+        TSWP_UndoTransaction_InsertNilTransaction.self, TSWP_UndoTransaction_CharDeltaTransaction.self,
+        TSWP_UndoTransaction_ParagraphDataTransaction.self, TSWP_UndoTransaction_ObjectDOLCTransaction.self,
+        TSWP_UndoTransaction_CTDateTransaction.self, TSWP_UndoTransaction_UnionTransaction.self,
+        TSWP_UndoTransaction_StorageAction.self, TSWP_UndoTransaction_StorageActionGroup.self,
+        TSWP_UndoTransactionWrapperArchive.self, TSWP_ShapeInfoArchive.self, TSWP_CommentInfoArchive.self,
+        TSWP_TOCInfoArchive.self, TSWP_TOCLayoutHintArchive.self, TSWP_EquationInfoArchive.self,
+        TSWP_TextualAttachmentArchive.self, TSWP_TSWPTOCPageNumberAttachmentArchive.self,
+        TSWP_UIGraphicalAttachment.self, TSWP_DrawableAttachmentArchive.self, TSWP_TOCAttachmentArchive.self,
+        TSWP_FootnoteReferenceAttachmentArchive.self, TSWP_NumberAttachmentArchive.self, TSWP_SmartFieldArchive.self,
+        TSWP_HyperlinkFieldArchive.self, TSWP_PlaceholderSmartFieldArchive.self,
+        TSWP_UnsupportedHyperlinkFieldArchive.self, TSWP_BibliographySmartFieldArchive.self,
+        TSWP_CitationRecordArchive.self, TSWP_CitationSmartFieldArchive.self, TSWP_DateTimeSmartFieldArchive.self,
+        TSWP_BookmarkFieldArchive.self, TSWP_FilenameSmartFieldArchive.self, TSWP_MergeFieldTypeArchive.self,
+        TSWP_MergeSmartFieldArchive.self, TSWP_TOCSmartFieldArchive.self, TSWP_TOCSmartFieldArchive_TOCEntry.self,
+        TSWP_RubyFieldArchive.self, TSWP_TateChuYokoFieldArchive.self, TSWP_ChangeArchive.self,
+        TSWP_ChangeSessionArchive.self, TSWP_SectionPlaceholderArchive.self, TSWP_HyperlinkSelectionArchive.self,
+        TSWP_DateTimeSelectionArchive.self, TSWP_FlowInfoArchive.self, TSWP_FlowInfoContainerArchive.self,
+        TSWP_DropCapArchive.self, TSWP_DropCapStylePropertiesArchive.self, TSWP_DropCapStyleArchive.self,
+        TSWP_CollaboratorTextCursorSubselectionArchive.self,
+    ]
 }
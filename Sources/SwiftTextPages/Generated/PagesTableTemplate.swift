@@ -2,658 +2,93 @@
 // Generated by Scripts/GeneratePagesTableTemplate.swift — do not edit by hand.
 // The native-table object set captured from a single-table .pages, minus the
 // blank template's objects. Records are verbatim (length-prefixed ArchiveInfo +
-// payload) so MessageInfo.object_references survive injection.
-import Foundation
+// payload) so MessageInfo.object_references survive injection; each is a range
+// of `bytes`.
 
 enum PagesTableTemplate {
-	struct Record { let file: String; let id: UInt64; let type: UInt64; let base64: String }
+	struct Record { let file: String; let id: UInt64; let type: UInt64; let range: Range<Int> }
 	/// Every object present in the captured table document but not the blank template.
 	static let records: [Record] = [
-		Record(file: "Index/CalculationEngine-1732610.iwa", id: 1734377, type: 4008, base64:
-		"EQjp7WkSCwioHxIDAwIKGLEBChYIl4Phvtf10aD5ARCZx8bq7Lumx8sBEA4YCSIAKgAyDAoAEgAaACIAKgA6ADosEhQI//8BEP////8HGP//ASD/////BxoU" +
-		"CP//ARD/////Bxj//wEg/////wdCLBIUCP//ARD/////Bxj//wEg/////wcaFAj//wEQ/////wcY//8BIP////8HSgIKAFIAYhYIjoPhvtf10aD5ARCZx8bq" +
-		"7Lumx8sBagByAHoAggEA" +
-		""
-		),
-		Record(file: "Index/CalculationEngine-1732610.iwa", id: 1734378, type: 4008, base64:
-		"Fgjq7WkSEAioHxIDAwIKGOkBKgP97WkKFgiWg+G+1/XRoPkBEJnHxursu6bHywEQDRgIIjIKCggAEAAyBAgAEAIKBggBEAAyAAoGCAIQADIACgYIAxAAMgAK" +
-		"DAgHEAAyBhgAIAsoCyoAMgwKABIAGgAiACoAOgA6LBIUCP//ARD/////Bxj//wEg/////wcaFAj//wEQ/////wcY//8BIP////8HQiwSFAj//wEQ/////wcY" +
-		"//8BIP////8HGhQI//8BEP////8HGP//ASD/////B0oCCgBSAGIWCI6D4b7X9dGg+QEQmcfG6uy7psfLAWoGCgQI/e1pcgB6AIIBAA==" +
-		""
-		),
-		Record(file: "Index/CalculationEngine-1732610.iwa", id: 1734397, type: 4009, base64:
-		"EAj97WkSCgipHxIDAQAFGDgIDRAAGAAiCggAEAAyBAgAEAIiBggBEAAyACIGCAIQADIAIgYIAxAAMgAiDAgHEAAyBhgAIAsoCw==" +
-		""
-		),
-		Record(file: "Index/CalculationEngine-1732610.iwa", id: 1734379, type: 4008, base64:
-		"Fgjr7WkSEAioHxIDAwIKGLcBKgP+7WkKFgixg+G+1/XRoPkBEJnHxursu6bHywEQCxgjIgAqADIMCgASABoAIgAqADoAOiwSFAj//wEQ/////wcY//8BIP//" +
-		"//8HGhQI//8BEP////8HGP//ASD/////B0IsEhQI//8BEP////8HGP//ASD/////BxoUCP//ARD/////Bxj//wEg/////wdKAgoAUgBiFgiOg+G+1/XRoPkB" +
-		"EJnHxursu6bHywFqBgoECP7taXIAegCCAQA=" +
-		""
-		),
-		Record(file: "Index/CalculationEngine-1732610.iwa", id: 1734398, type: 4009, base64:
-		"EAj+7WkSCgipHxIDAQAFGAYICxAAGAA=" +
-		""
-		),
-		Record(file: "Index/CalculationEngine-1732610.iwa", id: 1734380, type: 4008, base64:
-		"EQjs7WkSCwioHxIDAwIKGLEBChYIlIPhvtf10aD5ARCZx8bq7Lumx8sBEAoYBiIAKgAyDAoAEgAaACIAKgA6ADosEhQI//8BEP////8HGP//ASD/////BxoU" +
-		"CP//ARD/////Bxj//wEg/////wdCLBIUCP//ARD/////Bxj//wEg/////wcaFAj//wEQ/////wcY//8BIP////8HSgIKAFIAYhYIjoPhvtf10aD5ARCZx8bq" +
-		"7Lumx8sBagByAHoAggEA" +
-		""
-		),
-		Record(file: "Index/CalculationEngine-1732610.iwa", id: 1734381, type: 4008, base64:
-		"EQjt7WkSCwioHxIDAwIKGLEBChYIk4Phvtf10aD5ARCZx8bq7Lumx8sBEAkYBSIAKgAyDAoAEgAaACIAKgA6ADosEhQI//8BEP////8HGP//ASD/////BxoU" +
-		"CP//ARD/////Bxj//wEg/////wdCLBIUCP//ARD/////Bxj//wEg/////wcaFAj//wEQ/////wcY//8BIP////8HSgIKAFIAYhYIjoPhvtf10aD5ARCZx8bq" +
-		"7Lumx8sBagByAHoAggEA" +
-		""
-		),
-		Record(file: "Index/CalculationEngine-1732610.iwa", id: 1734382, type: 4008, base64:
-		"EQju7WkSCwioHxIDAwIKGLEBChYImIPhvtf10aD5ARCZx8bq7Lumx8sBEAgYCiIAKgAyDAoAEgAaACIAKgA6ADosEhQI//8BEP////8HGP//ASD/////BxoU" +
-		"CP//ARD/////Bxj//wEg/////wdCLBIUCP//ARD/////Bxj//wEg/////wcaFAj//wEQ/////wcY//8BIP////8HSgIKAFIAYhYIjoPhvtf10aD5ARCZx8bq" +
-		"7Lumx8sBagByAHoAggEA" +
-		""
-		),
-		Record(file: "Index/CalculationEngine-1732610.iwa", id: 1734383, type: 4008, base64:
-		"EQjv7WkSCwioHxIDAwIKGLEBChYIkYPhvtf10aD5ARCZx8bq7Lumx8sBEAcYAyIAKgAyDAoAEgAaACIAKgA6ADosEhQI//8BEP////8HGP//ASD/////BxoU" +
-		"CP//ARD/////Bxj//wEg/////wdCLBIUCP//ARD/////Bxj//wEg/////wcaFAj//wEQ/////wcY//8BIP////8HSgIKAFIAYhYIjoPhvtf10aD5ARCZx8bq" +
-		"7Lumx8sBagByAHoAggEA" +
-		""
-		),
-		Record(file: "Index/CalculationEngine-1732610.iwa", id: 1734384, type: 4008, base64:
-		"EQjw7WkSCwioHxIDAwIKGLEBChYIkoPhvtf10aD5ARCZx8bq7Lumx8sBEAUYBCIAKgAyDAoAEgAaACIAKgA6ADosEhQI//8BEP////8HGP//ASD/////BxoU" +
-		"CP//ARD/////Bxj//wEg/////wdCLBIUCP//ARD/////Bxj//wEg/////wcaFAj//wEQ/////wcY//8BIP////8HSgIKAFIAYhYIjoPhvtf10aD5ARCZx8bq" +
-		"7Lumx8sBagByAHoAggEA" +
-		""
-		),
-		Record(file: "Index/CalculationEngine-1732610.iwa", id: 1734385, type: 4008, base64:
-		"EAjx7WkSCgioHxIDAwIKGG8KFgiOg+G+1/XRoPkBEJnHxursu6bHywEQBBgBIgAqADIMCgASABoAIgAqADoAOhQSCAgAEAAYAyAEGggIARABGAMgBEIUEggI" +
-		"ABAAGAMgBBoICAEQARgDIARKAgoAUgBaBAj05GlqAHIAegCCAQA=" +
-		""
-		),
-		Record(file: "Index/CalculationEngine-1732610.iwa", id: 1734386, type: 4008, base64:
-		"EQjy7WkSCwioHxIDAwIKGLEBChYImYPhvtf10aD5ARCZx8bq7Lumx8sBEAYYCyIAKgAyDAoAEgAaACIAKgA6ADosEhQI//8BEP////8HGP//ASD/////BxoU" +
-		"CP//ARD/////Bxj//wEg/////wdCLBIUCP//ARD/////Bxj//wEg/////wcaFAj//wEQ/////wcY//8BIP////8HSgIKAFIAYhYIjoPhvtf10aD5ARCZx8bq" +
-		"7Lumx8sBagByAHoAggEA" +
-		""
-		),
-		Record(file: "Index/CalculationEngine-1732610.iwa", id: 1734387, type: 4008, base64:
-		"EQjz7WkSCwioHxIDAwIKGLEBChYImoPhvtf10aD5ARCZx8bq7Lumx8sBEAwYDCIAKgAyDAoAEgAaACIAKgA6ADosEhQI//8BEP////8HGP//ASD/////BxoU" +
-		"CP//ARD/////Bxj//wEg/////wdCLBIUCP//ARD/////Bxj//wEg/////wcaFAj//wEQ/////wcY//8BIP////8HSgIKAFIAYhYIjoPhvtf10aD5ARCZx8bq" +
-		"7Lumx8sBagByAHoAggEA" +
-		""
-		),
-		Record(file: "Index/CalculationEngine-1732610.iwa", id: 1732664, type: 4004, base64:
-		"EQi44GkSCwikHxIDAQAFGI0DChgQob3u3AIY9eCqqgUgir26oQcoueGs9wwaMwovCi0IJNIBBAgCEAHaAQQIABAB4gEaChgQjoPhvgcYrY+Fyg8gmcfG6gwo" +
-		"3rO63AwQABozCi8KLQgk0gEECAQQAdoBBAgAEAHiARoKGBCOg+G+Bxitj4XKDyCZx8bqDCjes7rcDBABGjMKLwotCCTSAQQIBhAB2gEECAAQAeIBGgoYEI6D" +
-		"4b4HGK2PhcoPIJnHxuoMKN6zutwMEAIaMwovCi0IJNIBBAgAEAHaAQQIAhAB4gEaChgQjoPhvgcYrY+Fyg8gmcfG6gwo3rO63AwQAxozCi8KLQgk0gEECAAQ" +
-		"AdoBBAgEEAHiARoKGBCOg+G+Bxitj4XKDyCZx8bqDCjes7rcDBAEGjMKLwotCCTSAQQIABAB2gEECAYQAeIBGgoYEI6D4b4HGK2PhcoPIJnHxuoMKN6zutwM" +
-		"EAUaMwovCi0IJNIBBAgAEAHaAQQICBAB4gEaChgQjoPhvgcYrY+Fyg8gmcfG6gwo3rO63AwQBg==" +
-		""
-		),
-		Record(file: "Index/CalculationEngine-1732610.iwa", id: 1734399, type: 6365, base64:
-		"EQj/7WkSCwjdMRIDAQAFGOYFCgJoMRIEcm93NBpZCgJoMRIEEAIYARpNCksKFgiOg+G+1/XRoPkBEJnHxursu6bHywESMQovChYIhND55PCJu6KqARCL6Pm4" +
-		"5afb/aEBEhUI4rv+v7yFqp1rEIyslYbMgK2aiQEaWQoCaDISBBADGAEaTQpLChYIjoPhvtf10aD5ARCZx8bq7Lumx8sBEjEKLwoWCInhh/WTlq673AEQ04G0" +
-		"xaboiJn2ARIVCOK7/r+8haqdaxCMrJWGzICtmokBGlcKAmgzEgQQBBgBGksKSQoWCI6D4b7X9dGg+QEQmcfG6uy7psfLARIvCi0KFAiS1o3lkfP7g04Q+cu0" +
-		"mOOzmrwDEhUI4rv+v7yFqp1rEIyslYbMgK2aiQEaVwoCaDQSBBAFGAEaSwpJChYIjoPhvtf10aD5ARCZx8bq7Lumx8sBEi8KLQoUCKzY+92I5oemBRDw3oK/" +
-		"lc/MyTsSFQjiu/6/vIWqnWsQjKyVhsyArZqJARpcCgRyb3cxEgQQBhgBGk4KTAoWCI6D4b7X9dGg+QEQmcfG6uy7psfLARIyCjAKFgiE0Pnk8Im7oqoBEIvo" +
-		"+bjlp9v9oQESFgjgquyJy9qfqr0BEKTf2amGoKjPygEaWgoEcm93MhIEEAcYARpMCkoKFgiOg+G+1/XRoPkBEJnHxursu6bHywESMAouChYIhND55PCJu6Kq" +
-		"ARCL6Pm45afb/aEBEhQI/fu55pWCqYpLEI6BjMeopIXQERpbCgRyb3czEgQQCBgBGk0KSwoWCI6D4b7X9dGg+QEQmcfG6uy7psfLARIxCi8KFgiE0Pnk8Im7" +
-		"oqoBEIvo+bjlp9v9oQESFQjjjral7arOl/0BEK7Alc3G7OKCTBpbCgRyb3c0EgQQCRgBGk0KSwoWCI6D4b7X9dGg+QEQmcfG6uy7psfLARIxCi8KFgiE0Pnk" +
-		"8Im7oqoBEIvo+bjlp9v9oQESFQiz4/PowNTb6FUQ3rf3xsDu/bLEAQ==" +
-		""
-		),
-		Record(file: "Index/CalculationEngine-1732610.iwa", id: 1733236, type: 6000, base64:
-		"ggEI9ORpEnwI8C4SAwEABRiZASIHCgMKAQoYACIJCgMKAQgQAxgAIgkKAwoBBxADGAAiCQoDCgEFEAEYACIJCgMKAQYQARgAIgkKAwoBBBABGAAiCAoECgIB" +
-		"DBgBIggKBAoCAQ0YASIKCgQKAgELEAEYASoP5uxp/+Rpl+Vp5uRp6ORpCk8KHwoKDbBHyEIVxmLrQhIKDXXy8EMVAADkQhgDJQAAAAASBAi732kaEggAEAIY" +
-		"ACUAAAAALQAAAD8wACgAOABSBAj/5GlaBAjm7GlgAGgAEgQIl+VpIgQI5uRpKgQI6ORpOhYIloPhvtf10aD5ARCZx8bq7Lumx8sBQhYIkoPhvtf10aD5ARCZ" +
-		"x8bq7Lumx8sBUAByAgoA" +
-		""
-		),
-		Record(file: "Index/CalculationEngine-1732610.iwa", id: 1734246, type: 633, base64:
-		"Pgjm7GkSOAj5BBIDCgEAGNYBIgoKBgoEAQEBDBgBIggKBAoCAQYYASIKCgYKBAEBAQ0YASoJqNxp5+xpgO5pCssBCroBCkMKHwoKDQAAAAAVAAAAABIKDXXy" +
-		"8EMVAAAAABgBJQAAAAASBAj05GkaEggEEAIYASUAAEBBLQAAAD8wACgAOABgAGgAEgQIqNxpGmgIABAAKmISCg118vBDFQAAAAAaVAoOCAESCg0AAAAAFQAA" +
-		"AAAKDggCEgoNAADIQhUAAAAACg4IAhIKDQAAyEIVAADIQgoOCAISCg0AAAAAFQAAyEIKAggFCg4IARIKDQAAAAAVAAAAADUAAAAAEgQI5+xpIgQI5+xpMAES" +
-		"BAiA7mkYAQ==" +
-		""
-		),
-		Record(file: "Index/CalculationEngine-1732610.iwa", id: 1734247, type: 2001, base64:
-		"GAjn7GkSEgjRDxIDAQAFGEYqBqbcaZnXaRIECIXgaSoKCggIABIECKbcaTIICgYIABAAGAA6CgoICAASBAiZ12lQAXIICgYIABAAGADCAQgKBggAEAAYAOIB" +
-		"BAoCCAA=" +
-		""
-		),
-		Record(file: "Index/CalculationEngine-1732610.iwa", id: 1734400, type: 634, base64:
-		"EAiA7mkSCgj6BBIDCgEAGAQIARAH" +
-		""
-		),
-		Record(file: "Index/CalculationEngine-1732610.iwa", id: 1733247, type: 3097, base64:
-		"EAj/5GkSCgiZGBIDCgEAGAA=" +
-		""
-		),
-		Record(file: "Index/CalculationEngine-1732610.iwa", id: 1733271, type: 6001, base64:
-		"3gMIl+VpEtcDCPEuEgMDAgoY+gYiCQoDCgFWEAEYACIJCgMKAVUQARgAIgkKAwoBUhADGAAiEQoDCgFGEAMYACIGh+VpluVpIgkKAwoBUBABGAAiCQoDCgFP" +
-		"EAEYACIJCgMKAU4QARgAIgkKAwoBTRABGAAiCQoDCgFMEAEYACIJCgMKAUsQARgAIgkKAwoBShABGAAiCQoDCgFJEAEYACIJCgMKAUgQARgAIgkKAwoBRxAB" +
-		"GAAiCQoDCgFFEAEYACIJCgMKAUQQARgAIgkKAwoBQxABGAAiCQoDCgFCEAEYACIJCgMKAUEQARgAIgkKAwoBQBABGAAiCQoDCgE/EAEYACIJCgMKAT4QARgA" +
-		"IgkKAwoBPRABGAAiCQoDCgE8EAEYACIKCgQKAgQWEAEYACIKCgQKAgQVEAEYACIJCgMKAVEQAxgAKpYB2eRpkuVp7eRpxuRp3ORpzuRpyORpzeRp2+Rp0ORp" +
-		"yuRpyeRp4+Rp0+RpzORph9lpidlpitlpi9lpiNlpxtdpx9dpjNlpjdlpjtlpj9lpkNlpkdlpktlpk9lplNlpldlpltlpl9lpmNlpmdlpmtlpxddpm9lpnNlp" +
-		"ndlpntlpguVp4eRpi+Vp3uRph+VpluVp7+Rp6+RpCiQ4RTQxRDg3Ny1BRDQ3LTQxRjktOTlBMy01MUNEREU5OThFQ0IaBAiH2WkifgoICAESBAjt5GkSBAiS" +
-		"5WkaDQoICAASBAjZ5GkQgAIiBAjG5GkqBAjc5GkyBAjO5Gk4AUAASgYKBAgAEABSAFoECMnkaWIECMjkaXAEggEECOPkaYoBBAjN5GmSAQQIyuRpmgEECNvk" +
-		"aaIBBAjQ5GmqAQQI0+RpsgEECMzkaTAFOARCB1RhYmxlIDFIAVABaACBAQAAAAAQ7jNAiQEAAAAAAIBYQJIBBAiI2WmaAQQIidlpogEECIrZaaoBBAiL2Wmw" +
-		"AQHCAQQIx9dpygEECMbXadIBBAjG12naAQQIxtdp6AEB8gEECMXXafgBAIACAYkCAAAAAAAAAACSAgQI7+RpmgIECOvkaaICBAib2Wm6AhgQkYPhvgcYrY+F" +
-		"yg8gmcfG6gwo3rO63AziAgIIAOoCBgoECILlafICBAjh5Gn6Ah4KGBCTg+G+Bxitj4XKDyCZx8bqDCjes7rcDBICEACCAwQIn9lpigMECIvlaeIDBAiM2Wnq" +
-		"AwQIjdlp8gMECI7ZafoDBAiP2WmCBAQIkNlpigQECMbXaZIEBAjG12maBAQIxtdpogQECMbXaaoEBAjG12myBHoKFgiSg+G+1/XRoPkBEJnHxursu6bHywES" +
-		"YAoWCJKD4b7X9dGg+QEQmcfG6uy7psfLARIiChYImYPhvtf10aD5ARCZx8bq7Lumx8sBGAAwAEIECIflaRoiChYIkoPhvtf10aD5ARCZx8bq7Lumx8sBGAEw" +
-		"AEIECJblaboEBAiR2WnCBAQIktlpygQECJPZadIEBAiU2WnaBAQIldlp4gQECJbZaeoEBAiX2WnyBAQImNlp+gQECJnZaYIFBAia2WmKBV8KBAgAEAASVwoW" +
-		"CJaD4b7X9dGg+QEQmcfG6uy7psfLARoICgQIARAAMgAwADoEEAAYAEIEEAEYAEoEEAMYAFIEEAIYAFoEEAQYAGIEEAUYAGoEEAYYAHAIggEEEAcYAJIFHgoY" +
-		"EJiD4b4HGK2PhcoPIJnHxuoMKN6zutwMEgIQAKIFGAoWCLGD4b7X9dGg+QEQmcfG6uy7psfLAbIFBAje5Gm6BQQInNlpwgUECJ3ZacoFBAie2WnqBRgKFgia" +
-		"g+G+1/XRoPkBEJnHxursu6bHywE=" +
-		""
-		),
-		Record(file: "Index/CalculationEngine-1732610.iwa", id: 1733250, type: 4004, base64:
-		"EAiC5WkSCgikHxIDAQAFGBoKGBCUg+G+Bxitj4XKDyCZx8bqDCjes7rcDA==" +
-		""
-		),
-		Record(file: "Index/CalculationEngine-1732610.iwa", id: 1733217, type: 6267, base64:
-		"EQjh5GkSCwj7MBIDAQAFGPMBChQIktaN5ZHz+4NOEPnLtJjjs5q8AwoUCKzY+92I5oemBRDw3oK/lc/MyTsKFgiE0Pnk8Im7oqoBEIvo+bjlp9v9oQEKFgiJ" +
-		"4Yf1k5auu9wBENOBtMWm6IiZ9gEQAhADEAAQARgCGAMYABgBIhQI/fu55pWCqYpLEI6BjMeopIXQESIVCOOOtqXtqs6X/QEQrsCVzcbs4oJMIhUI4rv+v7yF" +
-		"qp1rEIyslYbMgK2aiQEiFQiz4/PowNTb6FUQ3rf3xsDu/bLEASIWCOCq7InL2p+qvQEQpN/ZqYagqM/KASgCKAMoACgEKAEwAjAEMAAwATAD" +
-		""
-		),
-		Record(file: "Index/CalculationEngine-1732610.iwa", id: 1733259, type: 6305, base64:
-		"EAiL5WkSCgihMRIDAQAFGAYIAhAEGAU=" +
-		""
-		),
-		Record(file: "Index/CalculationEngine-1732610.iwa", id: 1733214, type: 6372, base64:
-		"FQje5GkSDwjkMRIDAQAFGAYqA/LkaQoECPLkaQ==" +
-		""
-		),
-		Record(file: "Index/CalculationEngine-1732610.iwa", id: 1733234, type: 6373, base64:
-		"Kwjy5GkSJQjlMRIDAQAFGF4iCQoDCgEREAEYACIJCgMKARIQARgAKgOG5WkKFgiWg+G+1/XRoPkBEJnHxursu6bHywEaCAoECAEQADIAMAA6BBAAGABCBBAB" +
-		"GABKBBADGABSBBACGABaBBAEGABiBBAFGABqBBAGGABwCIIBBBAHGACSAQQIhuVp" +
-		""
-		),
-		Record(file: "Index/CalculationEngine-1732610.iwa", id: 1733254, type: 6383, base64:
-		"EAiG5WkSCgjvMRIDAQAFGAgKBAgBEAAyAA==" +
-		""
-		),
-		Record(file: "Index/CalculationEngine-1732610.iwa", id: 1733255, type: 6220, base64:
-		"EAiH5WkSCgjMMBIDAQAFGAgIABAAIAAoAA==" +
-		""
-		),
-		Record(file: "Index/CalculationEngine-1732610.iwa", id: 1733270, type: 6220, base64:
-		"EAiW5WkSCgjMMBIDAQAFGAgIABAAIAAoAA==" +
-		""
-		),
-		Record(file: "Index/CalculationEngine-1732610.iwa", id: 1733231, type: 6204, base64:
-		"EAjv5GkSCgi8MBIDAQAFGBwKGBCZg+G+Bxitj4XKDyCZx8bqDCjes7rcDBgA" +
-		""
-		),
-		Record(file: "Index/CalculationEngine-1732610.iwa", id: 1733227, type: 6204, base64:
-		"EAjr5GkSCgi8MBIDAQAFGBwKGBCSg+G+Bxitj4XKDyCZx8bqDCjes7rcDBgA" +
-		""
-		),
-		Record(file: "Index/CalculationEngine-1732610.iwa", id: 1733222, type: 6316, base64:
-		"Rgjm5GkSQAisMRIDAwIKGMACKjOF6Wnw5GmE5WmG6WmH6WmK6WmM6WmN6WmO6WmP6WmI6WmQ6WmR7GmL6WmJ6Wnu5Gn+5GkKBAj05GkSfgoICAESBAiE5WkS" +
-		"BAjw5GkaDQoICAASBAiF6WkQgAIiBAiG6WkqBAiH6WkyBAiK6Wk4AUAASgYKBAgAEABSAFoECJDpaWIECIzpaXAEggEECJHsaYoBBAiN6WmSAQQIiOlpmgEE" +
-		"CI7paaIBBAiP6WmqAQQIi+lpsgEECInpaRoECO7kaSIWCJeD4b7X9dGg+QEQmcfG6uy7psfLASoECP7kaVEAAAAAAABJQNEBAAAAAAAAAADRAQAAAAAAAAAA" +
-		"0QEAAAAAAAAAANEBAAAAAAAAAADRAQAAAAAAAAAA0QEAAAAAAAAAANkBAAAAAAAAAADZAQAAAAAAAAAA2QEAAAAAAAAAANkBAAAAAAAAAADZAQAAAAAAAAAA" +
-		"2QEAAAAAAAAAAOABAOABAOABAOABAOABAOABAOoBAA==" +
-		""
-		),
-		Record(file: "Index/CalculationEngine-1732610.iwa", id: 1733230, type: 6267, base64:
-		"EAju5GkSCgj7MBIDAQAFGAA=" +
-		""
-		),
-		Record(file: "Index/CalculationEngine-1732610.iwa", id: 1733246, type: 6317, base64:
-		"EAj+5GkSCgitMRIDAwIKGAYKBAj05Gk=" +
-		""
-		),
-		Record(file: "Index/CalculationEngine-1732610.iwa", id: 1733224, type: 6318, base64:
-		"FQjo5GkSDwiuMRIDAwIKGAwqA/HkaQoECPTkaRIECPHkaQ==" +
-		""
-		),
-		Record(file: "Index/CalculationEngine-1732610.iwa", id: 1733233, type: 6267, base64:
-		"EAjx5GkSCgj7MBIDAQAFGAA=" +
-		""
-		),
-		Record(file: "Index/Document.iwa", id: 1734389, type: 2003, base64:
-		"FQj17WkSDwjTDxIDAQAFGBQqA/TkaQoECPTkaRAAHQAAAAAgAC0AAAAA" +
-		""
-		),
-		Record(file: "Index/DocumentStylesheet.iwa", id: 1734364, type: 2022, base64:
-		"FQjc7WkSDwjmDxIDAQAFGBgqA8bXaQoOGgQIxtdpIAEqBAiF4GlQAVoAYgIIAg==" +
-		""
-		),
-		Record(file: "Index/Metadata.iwa", id: 1734988, type: 11015, base64:
-		"HgjM8mkSGAiHVhIDAQAFGCgqDJbmPa/bC4jLZrDbCwoICA4SBAiW5j0KCAgJEgQIr9sLCggIFxIECIjLZgoICAgSBAiw2ws=" +
-		""
-		),
-		Record(file: "Index/ViewState.iwa", id: 1734980, type: 10147, base64:
-		"GAjE8mkSEgijTxIDAQAFGAwqBsXyacbyaQoECMXyaRIECMbyaQ==" +
-		""
-		),
-		Record(file: "Index/ViewState.iwa", id: 1734981, type: 10131, base64:
-		"EQjF8mkSCwiTTxIDAQAFGIsBCAEQABgBIAEqegp2CAESQhoECAAQEiASKgQIABASMAE4BUISCQAAAAAAAAAAEQAAAAAAAAAAShIJAAAAoE4efkARAAAAkAjE" +
-		"hkBQAVgAYABoABoECAAQACIECAAQAFA1WANqFQiImaT1+KHxomsQs/WozoTd6KnIAZABAJgBAKIBABAAMBJA8KOzDA==" +
-		""
-		),
-		Record(file: "Index/ViewState.iwa", id: 1734982, type: 10133, base64:
-		"RQjG8mkSPwiVTxIDAQAFGOQBIgcKAwoBJxgBIgkKAwoBIBABGAEiBwoDCgEXGAEqFcfyacjyacnyacryacvyaangaargaRIKDc3MzD4VAAAAADAAOgoNAAAV" +
-		"RBWamVJESABQAFgAYAFoAHAAfQAAoD+CAQoNAACSRBUAAGhCigEKDQDggEQVACCMRJIBJVRQTWFjSW5zcGVjdG9yU2VnbWVudElkZW50aWZpZXJGb3JtYXSY" +
-		"AQCgAQGtAQAAAD+1AQAAAAC4AQHAAQDKAQwKBAjH8mkKBAjI8mnQAQHYAQHgAQD4AQCIAgCQAgCaAgQIqeBpsAIAuAIBwAIAygIECKrgadACAOACAO0CAAAA" +
-		"APUCAAAAAPoCEgoECMnyaQoECMryaQoECMvyaQ==" +
-		""
-		),
-		Record(file: "Index/ViewState.iwa", id: 1734983, type: 219, base64:
-		"EAjH8mkSCgjbARIDAQAFGAA=" +
-		""
-		),
-		Record(file: "Index/ViewState.iwa", id: 1734984, type: 10132, base64:
-		"EAjI8mkSCgiUTxIDAQAFGCQIABIICP////8PEAAYACAASAFQ/////w9YCGIICP////8PEAA=" +
-		""
-		),
-		Record(file: "Index/ViewState.iwa", id: 1734985, type: 219, base64:
-		"EAjJ8mkSCgjbARIDAQAFGAA=" +
-		""
-		),
-		Record(file: "Index/ViewState.iwa", id: 1734986, type: 10132, base64:
-		"EAjK8mkSCgiUTxIDAQAFGCQIABIICP////8PEAAYACAASAFQ/////w9YCGIICP////8PEAA=" +
-		""
-		),
-		Record(file: "Index/ViewState.iwa", id: 1734987, type: 3061, base64:
-		"EAjL8mkSCgj1FxIDAQAFGAYSBAj05Gk=" +
-		""
-		),
-		Record(file: "Index/Tables/DataList-1733192-2.iwa", id: 1733192, type: 6005, base64:
-		"EAjI5GkSCgj1LhIDAQAFGAQIBRAB" +
-		""
-		),
-		Record(file: "Index/Tables/DataList-1733193-2.iwa", id: 1733193, type: 6005, base64:
-		"EAjJ5GkSCgj1LhIDAQAFGAQIAhAB" +
-		""
-		),
-		Record(file: "Index/Tables/DataList-1733194-2.iwa", id: 1733194, type: 6005, base64:
-		"EAjK5GkSCgj1LhIDAQAFGAQICRAB" +
-		""
-		),
-		Record(file: "Index/Tables/DataList-1733196-2.iwa", id: 1733196, type: 6005, base64:
-		"EAjM5GkSCgj1LhIDAwIKGCMIAhADGgkIARAIMgMIhAIaEAgCEAwyCgiAAhD9ASAAKAAoAQ==" +
-		""
-		),
-		Record(file: "Index/Tables/DataList-1733197-2.iwa", id: 1733197, type: 6005, base64:
-		"EAjN5GkSCgj1LhIDAQAFGAQICBAB" +
-		""
-		),
-		Record(file: "Index/Tables/DataList-1733198-2.iwa", id: 1733198, type: 6005, base64:
-		"EAjO5GkSCgj1LhIDAQAFGAQIAxAB" +
-		""
-		),
-		Record(file: "Index/Tables/DataList-1733200-2.iwa", id: 1733200, type: 6005, base64:
-		"EAjQ5GkSCgj1LhIDAQAFGAQICxAB" +
-		""
-		),
-		Record(file: "Index/Tables/DataList-1733203-2.iwa", id: 1733203, type: 6005, base64:
-		"EAjT5GkSCgj1LhIDAwIKGAYIDBABKAE=" +
-		""
-		),
-		Record(file: "Index/Tables/DataList-1733211-2.iwa", id: 1733211, type: 6005, base64:
-		"EAjb5GkSCgj1LhIDAQAFGAQIChAB" +
-		""
-		),
-		Record(file: "Index/Tables/DataList-1733212-2.iwa", id: 1733212, type: 6005, base64:
-		"FQjc5GkSDwj1LhIDAQAFGBAqA9ztaQgEEAIaCggBEAQiBAjc7Wk=" +
-		""
-		),
-		Record(file: "Index/Tables/DataList-1733219-2.iwa", id: 1733219, type: 6005, base64:
-		"EAjj5GkSCgj1LhIDAQAFGAQIBxAB" +
-		""
-		),
-		Record(file: "Index/Tables/DataList-1733766-2.iwa", id: 1733766, type: 6005, base64:
-		"EAiG6WkSCgj1LhIDAQAFGAQIARAB" +
-		""
-		),
-		Record(file: "Index/Tables/DataList-1733767-2.iwa", id: 1733767, type: 6005, base64:
-		"EAiH6WkSCgj1LhIDAQAFGAQIBBAB" +
-		""
-		),
-		Record(file: "Index/Tables/DataList-1733768-2.iwa", id: 1733768, type: 6005, base64:
-		"EAiI6WkSCgj1LhIDAQAFGAQICRAB" +
-		""
-		),
-		Record(file: "Index/Tables/DataList-1733769-2.iwa", id: 1733769, type: 6005, base64:
-		"EAiJ6WkSCgj1LhIDAwIKGAYIAhABKAE=" +
-		""
-		),
-		Record(file: "Index/Tables/DataList-1733770-2.iwa", id: 1733770, type: 6005, base64:
-		"EAiK6WkSCgj1LhIDAQAFGAQIAxAB" +
-		""
-		),
-		Record(file: "Index/Tables/DataList-1733771-2.iwa", id: 1733771, type: 6005, base64:
-		"EAiL6WkSCgj1LhIDAwIKGAYIDBABKAE=" +
-		""
-		),
-		Record(file: "Index/Tables/DataList-1733772-2.iwa", id: 1733772, type: 6005, base64:
-		"EAiM6WkSCgj1LhIDAQAFGAQIBRAB" +
-		""
-		),
-		Record(file: "Index/Tables/DataList-1733773-2.iwa", id: 1733773, type: 6005, base64:
-		"EAiN6WkSCgj1LhIDAQAFGAQICBAB" +
-		""
-		),
-		Record(file: "Index/Tables/DataList-1733774-2.iwa", id: 1733774, type: 6005, base64:
-		"EAiO6WkSCgj1LhIDAQAFGAQIChAB" +
-		""
-		),
-		Record(file: "Index/Tables/DataList-1733775-2.iwa", id: 1733775, type: 6005, base64:
-		"EAiP6WkSCgj1LhIDAQAFGAQICxAB" +
-		""
-		),
-		Record(file: "Index/Tables/DataList-1733776-2.iwa", id: 1733776, type: 6005, base64:
-		"EAiQ6WkSCgj1LhIDAQAFGAQIAhAB" +
-		""
-		),
-		Record(file: "Index/Tables/DataList-1734161-2.iwa", id: 1734161, type: 6005, base64:
-		"EAiR7GkSCgj1LhIDAQAFGAQIBxAB" +
-		""
-		),
-		Record(file: "Index/Tables/DataList.iwa", id: 1733190, type: 6005, base64:
-		"EAjG5GkSCgj1LhIDAQAFGFwIARAJGggIARABGgJIMRoICAIQARoCSDIaCAgDEAEaAkgzGggIBBABGgJINBoKCAUQARoEcm93MRoKCAYQARoEcm93MhoKCAcQ" +
-		"ARoEcm93MxoKCAgQARoEcm93NA==" +
-		""
-		),
-		Record(file: "Index/Tables/HeaderStorageBucket-1733232-2.iwa", id: 1733232, type: 6006, base64:
-		"EAjw5GkSCgj2LhIDAQAFGAIIAQ==" +
-		""
-		),
-		Record(file: "Index/Tables/HeaderStorageBucket-1733252-2.iwa", id: 1733252, type: 6006, base64:
-		"EAiE5WkSCgj2LhIDAQAFGAIIAQ==" +
-		""
-		),
-		Record(file: "Index/Tables/HeaderStorageBucket-1733266-2.iwa", id: 1733266, type: 6006, base64:
-		"EAiS5WkSCgj2LhIDAQAFGDYIARILCAAVqMXwQhgAIAUSCwgBFajF8EIYACAFEgsIAhWoxfBCGAAgBRILCAMVqMXwQhgAIAU=" +
-		""
-		),
-		Record(file: "Index/Tables/HeaderStorageBucket.iwa", id: 1733229, type: 6006, base64:
-		"EAjt5GkSCgj2LhIDAQAFGEMIARILCAAVCte1QRgAIAQSCwgBFQrXtUEYACAEEgsIAhUK17VBGAAgBBILCAMVCte1QRgAIAQSCwgEFQrXtUEYACAE" +
-		""
-		),
-		Record(file: "Index/Tables/Tile-1733765-2.iwa", id: 1733765, type: 6002, base64:
-		"GQiF6WkSEwjyLhIDAQAFGAwiBwoDCgEHGAAIABAAGAAgADAFOAE=" +
-		""
-		),
-		Record(file: "Index/Tables/Tile.iwa", id: 1733209, type: 6002, base64:
-		"GgjZ5GkSFAjyLhIDAQAFGMsvIgcKAwoBBxgACAAQABgAIAUqrAkIABAEGjAEAAAAAAAAAAAAAAAEAAAAAAAAAAAAAAAEAAAAAAAAAAAAAAAEAAAAAAAAAAAA" +
-		"AAAi/gMAAAwAGAAkAP//////////////////////////////////////////////////////////////////////////////////////////////////////" +
-		"////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////" +
-		"////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////" +
-		"////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////" +
-		"////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////" +
-		"//////////////////////////////////////////////////////////////////////////////////////8oBTJwBQMAAAAAAABIEAIAAQAAAAEAAAAF" +
-		"AAAAAQAAAAUDAAAAAAAASBACAAIAAAABAAAABQAAAAEAAAAFAwAAAAAAAEgQAgADAAAAAQAAAAUAAAABAAAABQMAAAAAAABIEAIABAAAAAEAAAAFAAAAAQAA" +
-		"ADr+AwAAHAA4AFQA////////////////////////////////////////////////////////////////////////////////////////////////////////" +
-		"////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////" +
-		"////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////" +
-		"////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////" +
-		"////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////" +
-		"/////////////////////////////////////////////////////////////////////////////////////yrBCQgBEAQaMAQAAAAAAAAAAAAAAAQAAAAA" +
-		"AAAAAAAAAAQAAAAAAAAAAAAAAAQAAAAAAAAAAAAAACL+AwAADAAYACQA////////////////////////////////////////////////////////////////" +
-		"////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////" +
-		"////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////" +
-		"////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////" +
-		"////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////" +
-		"////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////" +
-		"/////ygFMoQBBQMAAAAAAAAIEAIABQAAAAUAAAABAAAABQIAAAAAAAABMAAAAQAAAAAAAAAAAAAAAABAMAEAAAACAAAABQIAAAAAAAABMAAAAgAAAAAAAAAA" +
-		"AAAAAABAMAEAAAACAAAABQIAAAAAAAABMAAAAwAAAAAAAAAAAAAAAABAMAEAAAACAAAAOv4DAAAYADwAYAD/////////////////////////////////////" +
-		"////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////" +
-		"////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////" +
-		"////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////" +
-		"////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////" +
-		"////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////" +
-		"////////////////////////////////KsEJCAIQBBowBAAAAAAAAAAAAAAABAAAAAAAAAAAAAAABAAAAAAAAAAAAAAABAAAAAAAAAAAAAAAIv4DAAAMABgA" +
-		"JAD/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////" +
-		"////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////" +
-		"////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////" +
-		"////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////" +
-		"////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////" +
-		"////////////////////////////////////////////////////////////////////////KAUyhAEFAwAAAAAAAAgQAgAGAAAABQAAAAEAAAAFAgAAAAAA" +
-		"AAEwAAABAAAAAAAAAAAAAAAAAEAwAQAAAAIAAAAFAgAAAAAAAAEwAAACAAAAAAAAAAAAAAAAAEAwAQAAAAIAAAAFAgAAAAAAAAEwAAADAAAAAAAAAAAAAAAA" +
-		"AEAwAQAAAAIAAAA6/gMAABgAPABgAP//////////////////////////////////////////////////////////////////////////////////////////" +
-		"////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////" +
-		"////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////" +
-		"////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////" +
-		"////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////" +
-		"//////////////////////////////////////////////////////////////////////////////////////////////////8qwQkIAxAEGjAEAAAAAAAA" +
-		"AAAAAAAEAAAAAAAAAAAAAAAEAAAAAAAAAAAAAAAEAAAAAAAAAAAAAAAi/gMAAAwAGAAkAP//////////////////////////////////////////////////" +
-		"////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////" +
-		"////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////" +
-		"////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////" +
-		"////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////" +
-		"////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////" +
-		"//////////////////8oBTKEAQUDAAAAAAAACBACAAcAAAAFAAAAAQAAAAUCAAAAAAAAATAAAAEAAAAAAAAAAAAAAAAAQDABAAAAAgAAAAUCAAAAAAAAATAA" +
-		"AAIAAAAAAAAAAAAAAAAAQDABAAAAAgAAAAUCAAAAAAAAATAAAAMAAAAAAAAAAAAAAAAAQDABAAAAAgAAADr+AwAAGAA8AGAA////////////////////////" +
-		"////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////" +
-		"////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////" +
-		"////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////" +
-		"////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////" +
-		"////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////" +
-		"/////////////////////////////////////////////yrBCQgEEAQaMAQAAAAAAAAAAAAAAAQAAAAAAAAAAAAAAAQAAAAAAAAAAAAAAAQAAAAAAAAAAAAA" +
-		"ACL+AwAADAAYACQA////////////////////////////////////////////////////////////////////////////////////////////////////////" +
-		"////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////" +
-		"////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////" +
-		"////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////" +
-		"////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////" +
-		"/////////////////////////////////////////////////////////////////////////////////////ygFMoQBBQMAAAAAAAAIEAIACAAAAAUAAAAB" +
-		"AAAABQIAAAAAAAABMAAAAQAAAAAAAAAAAAAAAABAMAEAAAACAAAABQIAAAAAAAABMAAAAgAAAAAAAAAAAAAAAABAMAEAAAACAAAABQIAAAAAAAABMAAAAwAA" +
-		"AAAAAAAAAAAAAABAMAEAAAACAAAAOv4DAAAYADwAYAD/////////////////////////////////////////////////////////////////////////////" +
-		"////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////" +
-		"////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////" +
-		"////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////" +
-		"////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////" +
-		"////////////////////////////////////////////////////////////////////////////////////////////////////////////////MAU4AQ==" +
-		""
-		),
+		Record(file: "Index/CalculationEngine-1732610.iwa", id: 1734377, type: 4008, range: 0..<195),
+		Record(file: "Index/CalculationEngine-1732610.iwa", id: 1734378, type: 4008, range: 195..<451),
+		Record(file: "Index/CalculationEngine-1732610.iwa", id: 1734397, type: 4009, range: 451..<524),
+		Record(file: "Index/CalculationEngine-1732610.iwa", id: 1734379, type: 4008, range: 524..<730),
+		Record(file: "Index/CalculationEngine-1732610.iwa", id: 1734398, type: 4009, range: 730..<753),
+		Record(file: "Index/CalculationEngine-1732610.iwa", id: 1734380, type: 4008, range: 753..<948),
+		Record(file: "Index/CalculationEngine-1732610.iwa", id: 1734381, type: 4008, range: 948..<1143),
+		Record(file: "Index/CalculationEngine-1732610.iwa", id: 1734382, type: 4008, range: 1143..<1338),
+		Record(file: "Index/CalculationEngine-1732610.iwa", id: 1734383, type: 4008, range: 1338..<1533),
+		Record(file: "Index/CalculationEngine-1732610.iwa", id: 1734384, type: 4008, range: 1533..<1728),
+		Record(file: "Index/CalculationEngine-1732610.iwa", id: 1734385, type: 4008, range: 1728..<1856),
+		Record(file: "Index/CalculationEngine-1732610.iwa", id: 1734386, type: 4008, range: 1856..<2051),
+		Record(file: "Index/CalculationEngine-1732610.iwa", id: 1734387, type: 4008, range: 2051..<2246),
+		Record(file: "Index/CalculationEngine-1732610.iwa", id: 1732664, type: 4004, range: 2246..<2661),
+		Record(file: "Index/CalculationEngine-1732610.iwa", id: 1734399, type: 6365, range: 2661..<3421),
+		Record(file: "Index/CalculationEngine-1732610.iwa", id: 1733236, type: 6000, range: 3421..<3706),
+		Record(file: "Index/CalculationEngine-1732610.iwa", id: 1734246, type: 633, range: 3706..<3983),
+		Record(file: "Index/CalculationEngine-1732610.iwa", id: 1734247, type: 2001, range: 3983..<4078),
+		Record(file: "Index/CalculationEngine-1732610.iwa", id: 1734400, type: 634, range: 4078..<4099),
+		Record(file: "Index/CalculationEngine-1732610.iwa", id: 1733247, type: 3097, range: 4099..<4116),
+		Record(file: "Index/CalculationEngine-1732610.iwa", id: 1733271, type: 6001, range: 4116..<5486),
+		Record(file: "Index/CalculationEngine-1732610.iwa", id: 1733250, type: 4004, range: 5486..<5529),
+		Record(file: "Index/CalculationEngine-1732610.iwa", id: 1733217, type: 6267, range: 5529..<5790),
+		Record(file: "Index/CalculationEngine-1732610.iwa", id: 1733259, type: 6305, range: 5790..<5813),
+		Record(file: "Index/CalculationEngine-1732610.iwa", id: 1733214, type: 6372, range: 5813..<5841),
+		Record(file: "Index/CalculationEngine-1732610.iwa", id: 1733234, type: 6373, range: 5841..<5979),
+		Record(file: "Index/CalculationEngine-1732610.iwa", id: 1733254, type: 6383, range: 5979..<6004),
+		Record(file: "Index/CalculationEngine-1732610.iwa", id: 1733255, type: 6220, range: 6004..<6029),
+		Record(file: "Index/CalculationEngine-1732610.iwa", id: 1733270, type: 6220, range: 6029..<6054),
+		Record(file: "Index/CalculationEngine-1732610.iwa", id: 1733231, type: 6204, range: 6054..<6099),
+		Record(file: "Index/CalculationEngine-1732610.iwa", id: 1733227, type: 6204, range: 6099..<6144),
+		Record(file: "Index/CalculationEngine-1732610.iwa", id: 1733222, type: 6316, range: 6144..<6535),
+		Record(file: "Index/CalculationEngine-1732610.iwa", id: 1733230, type: 6267, range: 6535..<6552),
+		Record(file: "Index/CalculationEngine-1732610.iwa", id: 1733246, type: 6317, range: 6552..<6575),
+		Record(file: "Index/CalculationEngine-1732610.iwa", id: 1733224, type: 6318, range: 6575..<6609),
+		Record(file: "Index/CalculationEngine-1732610.iwa", id: 1733233, type: 6267, range: 6609..<6626),
+		Record(file: "Index/Document.iwa", id: 1734389, type: 2003, range: 6626..<6668),
+		Record(file: "Index/DocumentStylesheet.iwa", id: 1734364, type: 2022, range: 6668..<6714),
+		Record(file: "Index/Metadata.iwa", id: 1734988, type: 11015, range: 6714..<6785),
+		Record(file: "Index/ViewState.iwa", id: 1734980, type: 10147, range: 6785..<6822),
+		Record(file: "Index/ViewState.iwa", id: 1734981, type: 10131, range: 6822..<6979),
+		Record(file: "Index/ViewState.iwa", id: 1734982, type: 10133, range: 6979..<7277),
+		Record(file: "Index/ViewState.iwa", id: 1734983, type: 219, range: 7277..<7294),
+		Record(file: "Index/ViewState.iwa", id: 1734984, type: 10132, range: 7294..<7347),
+		Record(file: "Index/ViewState.iwa", id: 1734985, type: 219, range: 7347..<7364),
+		Record(file: "Index/ViewState.iwa", id: 1734986, type: 10132, range: 7364..<7417),
+		Record(file: "Index/ViewState.iwa", id: 1734987, type: 3061, range: 7417..<7440),
+		Record(file: "Index/Tables/DataList-1733192-2.iwa", id: 1733192, type: 6005, range: 7440..<7461),
+		Record(file: "Index/Tables/DataList-1733193-2.iwa", id: 1733193, type: 6005, range: 7461..<7482),
+		Record(file: "Index/Tables/DataList-1733194-2.iwa", id: 1733194, type: 6005, range: 7482..<7503),
+		Record(file: "Index/Tables/DataList-1733196-2.iwa", id: 1733196, type: 6005, range: 7503..<7555),
+		Record(file: "Index/Tables/DataList-1733197-2.iwa", id: 1733197, type: 6005, range: 7555..<7576),
+		Record(file: "Index/Tables/DataList-1733198-2.iwa", id: 1733198, type: 6005, range: 7576..<7597),
+		Record(file: "Index/Tables/DataList-1733200-2.iwa", id: 1733200, type: 6005, range: 7597..<7618),
+		Record(file: "Index/Tables/DataList-1733203-2.iwa", id: 1733203, type: 6005, range: 7618..<7641),
+		Record(file: "Index/Tables/DataList-1733211-2.iwa", id: 1733211, type: 6005, range: 7641..<7662),
+		Record(file: "Index/Tables/DataList-1733212-2.iwa", id: 1733212, type: 6005, range: 7662..<7700),
+		Record(file: "Index/Tables/DataList-1733219-2.iwa", id: 1733219, type: 6005, range: 7700..<7721),
+		Record(file: "Index/Tables/DataList-1733766-2.iwa", id: 1733766, type: 6005, range: 7721..<7742),
+		Record(file: "Index/Tables/DataList-1733767-2.iwa", id: 1733767, type: 6005, range: 7742..<7763),
+		Record(file: "Index/Tables/DataList-1733768-2.iwa", id: 1733768, type: 6005, range: 7763..<7784),
+		Record(file: "Index/Tables/DataList-1733769-2.iwa", id: 1733769, type: 6005, range: 7784..<7807),
+		Record(file: "Index/Tables/DataList-1733770-2.iwa", id: 1733770, type: 6005, range: 7807..<7828),
+		Record(file: "Index/Tables/DataList-1733771-2.iwa", id: 1733771, type: 6005, range: 7828..<7851),
+		Record(file: "Index/Tables/DataList-1733772-2.iwa", id: 1733772, type: 6005, range: 7851..<7872),
+		Record(file: "Index/Tables/DataList-1733773-2.iwa", id: 1733773, type: 6005, range: 7872..<7893),
+		Record(file: "Index/Tables/DataList-1733774-2.iwa", id: 1733774, type: 6005, range: 7893..<7914),
+		Record(file: "Index/Tables/DataList-1733775-2.iwa", id: 1733775, type: 6005, range: 7914..<7935),
+		Record(file: "Index/Tables/DataList-1733776-2.iwa", id: 1733776, type: 6005, range: 7935..<7956),
+		Record(file: "Index/Tables/DataList-1734161-2.iwa", id: 1734161, type: 6005, range: 7956..<7977),
+		Record(file: "Index/Tables/DataList.iwa", id: 1733190, type: 6005, range: 7977..<8086),
+		Record(file: "Index/Tables/HeaderStorageBucket-1733232-2.iwa", id: 1733232, type: 6006, range: 8086..<8105),
+		Record(file: "Index/Tables/HeaderStorageBucket-1733252-2.iwa", id: 1733252, type: 6006, range: 8105..<8124),
+		Record(file: "Index/Tables/HeaderStorageBucket-1733266-2.iwa", id: 1733266, type: 6006, range: 8124..<8195),
+		Record(file: "Index/Tables/HeaderStorageBucket.iwa", id: 1733229, type: 6006, range: 8195..<8279),
+		Record(file: "Index/Tables/Tile-1733765-2.iwa", id: 1733765, type: 6002, range: 8279..<8317),
+		Record(file: "Index/Tables/Tile.iwa", id: 1733209, type: 6002, range: 8317..<14435),
 	]
 	/// The table document's `Index/Metadata.iwa` (PackageMetadata), used for table docs.
-	static let metadataBase64: String =
-		"ANZFALK6AfCqIAgCEhwI/lUSAwEABRiKuAEiCQoDCgEKEAEYASoDzPJpCMzyaRIoEiRFRUI5RkVCMy04N0QxLTQ5RDMtQURCOC04NkRCQ0MwQ0ZBNzEYABov" +
-		"CO3kaRIaVGFibGVzL0hlYWRlclN0b3JhZ2VCdWNrZXQiAwIAACoDAgAAUABgxQYaNwiF6WkSC1RhYmxlcy9UaWxlGhVUYWJsZXMvVGlsZS0xNzMzNzY1LTIi" +
-		"OjkAHCQIxuRpEg9UCSwgRGF0YUxpc3QiOiYACD8IzkomAAQaGTo3AAVnEDE5OC0yRkEAAMiqQQAAMk5BAADNqkEAADdOQQAAyapBAAAzRkEAPCoIn+BpEglW" +
-		"aWV3U3RhdGUZ41QyCgiC4GkQ9ORpGAFQAGDGBho/CIfpRlYBVjABBDc2Uq4AANOirgAEMjBKrgAIVQjwdkICBBokLb0ASEZeAiXIBDIzUocBAIiq2QBSCQIA" +
-		"iapBAAA5RocBFFUIhOVpEmobA4bZAAA1UtkAAIqmmAAENzBGmAAIPwiMqkEASoIAFCAI2eRpEi7DA1liDFAAYMVBVgCNqmMAShUCCD8IjqpBAAA0RuUACFUI" +
-		"kv59AQQ2NkZXAAg/COOm7gIAMUoVAlAmCEcSEERvY3VtZW50TWV0YWRhdGEyPwEgxgaoAQEaPwjMomkABDE5UqoAAIuqQgEAMU7rAADKqoIASoMBCD8I0KJB" +
-		"AAQyMFKpAgDbpkEAADFSwwAAj6oEAQA1RgQBFKYuCAESCDGvOadEMgQIgeBpMggIheBpEKLcaTIEoVgNEACjBRAAnxUgBPTXERoE09sRCgDbFRQAuhUUANwV" +
-		"FAC7FRQA3RUUALwVFADeFRQAvRUUAN8VFAC+FRQA4BUUAL8VFADhFRQAwBUUAOIVFADBFRQA4xUUAMIVFADkFRQAwxUUAOUVFADEFRQA5hUUAMUVFADnFRQA" +
-		"xhUUAOgVFADHFRQA6RUUAMgVFADqFRQAyRUUAOsVFADKFRQA7BUUAMsVFADtFRQA7hUKAM0VHgDvFRQAzhUUAPAVFADPFRQA8RUUANAVFADyFRQA0RUUAPMV" +
-		"FADSFRQAmRUUBPjaMf4AmhUUAPkVFACbFRQA+hUUAJwVFAD7FRQAnRUUAPwVFACeFRQA/RUUAJ8VFAD+FRQAoBUUAP8VFAChFRQEr9wRoACwFQoAsRUKALIV" +
-		"CgCzFQoArhU8AI0V8ADTFRQAshUUANQVFACzFRQA1RUUALQVFADWFRQAtRUUANcVFAC2FRQA2BUUALcVFADZFRQAuBUUANoVFAC5FRQAoxUUAIIVFACpFRQA" +
-		"iBUUAK8VFACOFRQAsBUUAI8VFACxFRQAkBUUALcVFACWFRQAvRUUAJwVFADAFRQAnxUUAMIVFAChFRQAwxUUAKIVFADEFRQAoxUUAKk1mgCqFQoAqxUKAKwV" +
-		"CgCtFQoArhUKBIfZMf4AiRUKAIoVCgCLFQoAiBUKAMYVggClFYIAxxUUAKYVFADFFRQApBUUAJsVRgCMFQoAjRUKAI4VCgCPFQoAkBUKAJEVCgCSFQoAkxUK" +
-		"AJQVCgCVFQoAlhUKAJcVCgCYFQoAmRUKAJoVCgCcFQoAnRUKAJ4VCgCgFQoAohUKAKMVCgCkFQoAoRUKAMg1BACnNQQAyRUUAKgVFAC0FTIApRUKAKYVCgCn" +
-		"FQoAqBUKAKkVCgCqFQoAqxUKAKwVCgCtFQoArhUKAK8VCgCwFQoAsRUKALIVCgCzFQoAtRUKALYVCgC3FQoAuRUKALsVCgC8FQoAvRUKALoVCgDNFQoAvhUK" +
-		"AL8VCgDAFQoAwRUKAMIVCgDDFQoAxBUKAMUVCgDGFQoAxxUKAMgVCgDJFQoAyhUKAMsVCgDMFQoAzhUKAM8VCgDQFQoA0hUKANQVCgDVFQoA1hUKANMVCgDm" +
-		"FQoA1wUKGo4NGjoIANgFFA5UCADZFQoA2hUKANsVCgDcFQoA3RUKAN4VCgDfFQoA4BUKAOEVCgDiFQoA4xUKAOQVCgDlFQoA5xUKAOgVCgDpFQoA6xUKAO0V" +
-		"CgDuFQoA7xUKAOwVCgDKVe4AqVXuAP8VHgDwFQoA8RUKAPIVCgDzFQoA9BUKAPUVCgD2FQoA9xUKAPgVCgD5FQoA+hUKAPsVCgD8FQoA/RUKAP4VCgCA9SYA" +
-		"gRUKAIIVCgCEFQoAhhUKAIcVCgCIFQoAhRUKAMw1BACrNQQAyxUUAKoVFACYFTIAiRUKAIoVCgCLFQoAjBUKAI0VCgCOFQoAjxUKAJAVCgCRFQoAkhUKAJMV" +
-		"CgCUFQoAlRUKAJYVCgCXFQoAmRUKAJoVCgCbFQoAnRUKAJ4VCgCfFQoAoBUKAKEVCgCiFQoAoxUKAKQVCgClFQoAphUKAKcVCgCpFQoAqhUKAKsVCgCsFQoA" +
-		"rRUKAK4VCgCvFQoAsBUKALEVCgCyFQoAsxUKALQVCgC1FQoAthUKALcVCgC4FQoAuRUKALoVCgC7FQoAvBUKAL0VCgC+FQoAvxUKAMAVCgDBFQoAwhUKAMMV" +
-		"CgDEFQoAxRUKAMYVCgDHFQoAyRUKAMoVCgDLFQoAzBUKAM0VCgDOFQoAzxUKANAVCgDRFQoA0hUKANMVCgDVFQoA1hUKANcVCgDYFQoA2RUKANoVCgDbFQoA" +
-		"3BUKAN0VCgDeFQoA3xUKAOAVCgDhFQoA4hUKAOMVCgDkFQoA5RUKAOYVCgDnFQoA6BUKAOkVCgDqFQoA6xUKAOwVCgDtFQoA7hUKAO8VCgDwFQoA8RUKAPIV" +
-		"CgDzFQoA9RUKAPYVCgD3FQoAgZUuAIMVCgCEFQoAhRUKAIYVCgCHFQoAiRUKAIoVCgCLFQoAjBUKAJEVCgCSFQoAkxUKAJQVCgCVFQoAlxUKAJgVCgCZFQoA" +
-		"mhUKAJsVCgCdFQoAnhUKAK0VCgCuFQoArxUKALAVCgCxFQoA1BUKANUVCgDWFQoA1xUKANkVCgDaFQoA2xUKANwVCgDdFQoA3hUKAN8VCgDgFQoA4RUKAOIV" +
-		"CgDjFQoA5BUKAOUVCgDmFQoA5xUKAOgVCgDpFQoA6hUKAOsVCgDsFQoA7RUKAO4VCgDvFQoA8BUKAPEVCgDyFQoA8xUKAPQVCgD1FQoA9hUKAPcVCgD5FQoA" +
-		"+hUKAPsVCgD8FQoA/RUKAP4VCgD/FQoAgCJsDACBFQoAghUKAIMVCgCFFQoAhhUKAIcVCgCIFQoAiRUKAIoVCgCLFQoAjBUKAI0VCgCOFQoAjxUKAJAVCgCR" +
-		"FQoAkhUKAJMVCgCUFQoAlRUKAJYVCgCXFQoAmBUKAJkVCgCaFQoAmxUKAJwVCgCdFQoAnhUKAJ8VCgCgFQoE/98eKAoAoRUUAKUVCgCmEnYSAIUidhJIleBp" +
-		"OgoICBIGCJjXaRABOgoICQ0M9GwEBVAAWhgIARIUCI675N/DuOaiMhC1javu8L2H/ipaGgi43WkSFAimjqLc65bHpBYQqb3/xqifjPdYWhoIn9lpEhQIufnx" +
-		"q/bP6KYaEIDZktWMx/ziV1ocCMzbaRIWCI+M07G8iqKm0gEQuP3Nm8/LyrzRAVoaCJjXaRIUCO2+t/zUsvejJRCR8fnxpojwpBxaGwiD2mkSFQihirvS1L+P" +
-		"pO8BEJaZ3qS66df1NlobCJXfaRIVCLzHqu7D1bqhuQEQnL2RwICHlr4+WhoI9NppEhQI4svZ6JOdjKVEEI2l77+AjNmCZlobCLjZaRIVCOu8p+3U/culjAEQ" +
-		"kKHmzZ7E8eMeWhsI6tlpEhUIzsihusiH9KQfEIXHj7fg1OjV3wFaGwjI2mkSFQj96PCYoMP/pD0QmI2ck9DYqqTxAVobCJLeaRIVCK/BlumE8vmj4QEQi7WC" +
-		"/qytnK0KWhsI+NtpEhUIwZH5yqqb0qbnARCRje21uNzK4h9aGwjR2WkSFQjG4eeZhPeDp0EQgK2emJKXoZeRAVocCKTcaRIWCNu9rLXX7rqi4QEQjM/IgZnV" +
-		"sZCUAVobCLvfaRIVCOKUhLjZ4fShRxC4l4iLueyN2KYBWhsI3d5pEhUI5tGjpK/Jr6RlEJvriJ2S8f6D2wFaHAiM32kSFgj266/8473roMUBEIuTl6KE16fw" +
-		"mAFaGwjI3WkSFQiJgYqZ8emGozQQioXQv+ek4Iq1AVocCK7faRIWCJyV9vDhqIinyAEQqZfI38SJ36DjAVocCJzaaRIWCI3tjJ7+pNqkrQEQn5+ZoNTk387h" +
-		"AVocCKHeaRIWCMPClMaOndmhrwEQtf2EnOvnjPzgAVoaCJzeaRIUCICJsOnDwMCgaxCi0fS0+fn1mVtaHAjU32kSFgjtrpGlv6Knor8BEICjiNCc78jD+gFa" +
-		"Gwig22kSFQiQ8Ib77+bdp4wBEJTPlpLdmfDFJ1obCIvdaRIVCNWUnq+GlKWh0gEQtPHvvYfqzqt5WhoIjt9pEhQIz+XSyLWdjKEtEI3rivinnPPjN1ocCN3d" +
-		"aRIWCLHz4JvhwLCh8gEQvandn6jfvcnkAVobCL/eaRIVCP++u6LinP+i8gEQobG4mqjdpYRvWhoIgt9pEhQIssCx99rMy6RlEJC7yNCTw6HTK1obCP3caRIV" +
-		"CMaN5dCJruWnNhCQjZnQt9aRwtEBWhwIjd1pEhYIsJGU4eS4/6KJARCss6S0xeKCr9QBWhoIgd9pEhQIv/+Vj6eZ0aNkEKvLi7uvuY3ZTlocCN/faRIWCPWu" +
-		"nNbX3aOkwwEQjdu6mPDGn+zWAVobCMDfaRIVCJTD6aTrqpym1AEQkbeUxKf3haoLWhsIit1pEhUI2fCU4tPh7qfCARCah/icmomggnZaGwjM3mkSFQjU87bg" +
-		"yuLzpasBEL6pl9uc/4aDAVobCNjeaRIVCPHtptb0qtumGxCX367ilurC/ugBYMUGGk0IgeBpEhdBbm5vdGF0aW9uQXV0aG9yU3QSCh5MGh9Bbm5vdGF0aW9u" +
-		"QXV0aG9yU3QFGQ6/GwwyNjA5JloXDFAAYMMOQBoAhqa5F06oGQhJCNyqOxgy5BoajA8I3O1pHswaAJCmjAAAN1KKGQSR7JpjHQg0MTZKxxgEkAYOKBAcEhFD" +
-		"YWxjdWwlRhxFbmdpbmUaGUITAClSKDEwIgMDAgoqAwoBAdAgARC732kYATIEDrkbDeAOChMABsEwBBgBDRIW4BIMARCf2RkUAKjVYCZEE8FqFvoYJmwTDuYW" +
-		"AAQB6AQyBA55Gw0gBI3ZARAE7eQBBgSF6QEGAMYFDATc5BEiDnITAAQOsx8NMg4OFAAEDoIfBDIEDkcfDRYAiwVIANsVNg6yEwAEDl4aDSAmMBQObBQABA65" +
-		"Gg0aDq4UAAQOUB8NEA7mFAAEDsQbBDIEDrgeDRYOUhQABA5xGw0QJvgUJgwVJu4UJpQUJu4UJp4UTpQUJooUJnYUJgIVNmwUAAQODx8EMgQOvh4EMgQOQh4E" +
-		"MgRhDQQyBA6pHwQyBA79HQQyBA7CHQQyBA5lHQQyBA4qHQQyBA7qGgQyBEGrBDIEDvobBDIEDr8eGFAAWhsI9OThQUiImaT1+KHxomsQs/WozoTd6KnIoeQE" +
-		"/+ShxmSgjrHh07vhpp8BEJThmdGL972czwFaGwjm7AE7SIW+lcPM57GlBhCN/fid+bSs99jh0nTn7GkSFAjdsrbaz9CUolEQiYmK5/niw557WhsIl+UBOYCS" +
-		"/72kmqL1oSsQuK//4MKWsrjVAWDFBmoXCgtUU0FDYXCBERhzEgMCBAAaQas0aicKG1RTQ0VSZWR1Y2VB3EnoHE1zZ1NpemUSQdQAGgUFBNBvQbsEEhIemxsg" +
-		"U3R5bGVzaGVlKqUbXDoKCBcSBgic12kQCToKCA4SBgih12kQAiUVBNXXAaFIs9Tcg4uGsKcyEKPDg9vxjY77rCEVBNnXIRVMyKjsueeE26SeARCdheC0x4Pd" +
-		"r54B+ATa1wH4WJfpj/vVl8KjFxCm85uRqsqHoGxaGgjWBRxY4//B5sWAtKV2EJzX9ZyAneWqdloaCNcFHFjegdzp49espCkQvvWwzPLDhPZ3WhoI2AUcXKHh" +
-		"p5vbjYyjdRCdvdjdk+nYjxxaGwiu3AGrYP+03penxMintQEQueu40dzqiY4UWhwIrdwBq0zun6/Oks30p9EBEJ6tyMSqoZuW5yHAAKwFO2CqsIy29+7Co/oB" +
-		"EIbJh+Lxjtike1oaCKvcAchYrNTDzPK1pqZrEKW197XSmorSP1obCKoFOUj4zcb0gM//pTIQrJuirfn69cGSAVYAqQUdXP3Xn/2yz/aj1gEQspuuzoeVtucN" +
-		"WhwIrwWRTO3ChZHj3taj7gEQkNWhnPSGwtuuATsA5yV3SJO5h4OfuvGkPhCLycm/+4Pd+osBHQChBR1Iu8KTyPTVpKASEJG1l8Xt06DOuwEdAKAFHUizhOKv" +
-		"n42JpD0QtMvu6/r2+9TXIZMAqSU/WLC5vsWO1u+nXxCXyfD4m+TrylhaGwifBTlc+4uYyeLioaSVARCL8ZuzqqqLwWdaGwieBR1Iz/a2iLjNtqBIELSLpu+d" +
-		"t8zzmgFWAMwFVlj1t8aetfC0pDIQjfPvlrDUtIdZWhsIywU5XPXy1bCGpZijyAEQk53rgsiFqJ8GWhwIsyUETOvil/qVnf+nmAEQoMeN2afv9Jm0AcoAnQU7" +
-		"IKr7qIjopqunrOFnKKWT5Z2JqV1aGwjKBR1cwKmjnrvw86ShARCryc3Ii7aJumZaGgjJBZFY7uLru8zR06cyELrH457B/bWZTloaCMgFHESiqODagavwoDoQ" +
-		"jNXaiai2oYhBQgDHBVVcu7m50ZT3wqHSARCu7/zb0uCSmEZaHAjGRe1MhMrh+9f5xaOZARCy58SquemfzMYBrQDFBTtI/rSPyObdkaFjEKv1wdDGxdGzigEd" +
-		"AMIFHUiryv2L6K66oRsQjYH27Mft+LW4AR0AskUmSOLzhrrMrZyl0wEQudf1rJGP4LlhDACcBa5YhZXmgZLcmaFlEKzzxIzo2f35Z1ocCMAFkUy31Jvs28zr" +
-		"otwBEJuPrPifgrKYnAFXAL0FdFzgptifz4zapNQBEJSJooHJipXlLVoaCLFF01iHi7LwsqHYpBwQmp24zrn9/+tpWhsImwU5XMOu4vCL6b2mgwEQpP/go+L/" +
-		"iL4RWhsIsQUdXOz49NjMk6+g1wEQh83a16nqvtIUWhoIsAWtWLu/j9jhsralIxCfqan9iLnyylBaGgivBRxY85eXlPKLhqQoEILPqIiRoqjdMloaCK4FHEin" +
-		"vMOO4v7Ro0kQmduFwo+brp5BAVQFqliNrsSKpIa4ohQQrMm0jovioLVdWhoImgU4WMG3+PGgyvOgZRCQz4bo4Jn+hF1aHAijJR1M1bfi9d//yaWbARC93Y7C" +
-		"qpfbquiBuQSY2oEOTMr4s4S3j4eliQEQi5P6go6MlvfIITsE5tmBSUi2r7CpnNKhpTAQtLGI966XmIOQAR0AzQUdSKyOg92+7tijPhCW7dD1/5KSk51hCnS0" +
-		"2WkSFAjxqbuygY/mpygQjf3SitfQ1tA4WhwIm9kBdEyNz4iF3byVoagBELvniL+p9f2H+QE6BJfaATpYzM+Lk8HjxaUeEI2PiIXNwa3DIFoaCJYFHFzr++q3" +
-		"0dClpiYQg7W4o77W4KVqWhsIldoBrFyXvpqKsI+PpfgBEIm3oZnV2ujGSloaCJQFOViK9bus9t6Zow8Qh7Wd+KvVgahLWhoIkwUcRKKKxtPKrvGgNRCx1eOu" +
-		"qOynng5LDgDlBeTQzfXLvtOh9aC5ARC4q9yDiZKawHpaGgjk2WkSFAjgpq/epoW/pBgQhsec5tGRzfB3WhsI49kBjkiyk+60oIGWpBkQot3hhpCgx+SyAeME" +
-		"/98BOViH7MzjqsSOpzgQovWFq969xZR5WhwI4iUdTIiRi5yAnuqisgEQpJ+rzpSgnMuiIXQA4QWQXLW88/bfwLuhtAEQlJHm6pXOzd01WhwIzAU7TJXc2Jeh" +
-		"y8al2QEQnbPE6JiKvKn2ATsAywU70NLVu5P2z56k3AEQp9/Bi9uUvORyWhoIytlpEhQIpbXXj7KL9adcEIaL5f/Rh9vjZFocCMnZIa9M/ar4i+2dlKbcARC2" +
-		"3ZeHlr2uzd8BVwDIBVdIrpbpseft+6U0EJu1x/+duP3ivgEdALMFHVyzoqOU0Z7ao/0BELLhk8regc6oW1obCLIFHUjH4dPt/7C+pksQo9vA6MH43pegISNg" +
-		"sdlpEhQIx9+kuu3R9KdMEJPRyMuitcG/I2EKBNlpAa1UmML8xZOCp0AQk7ebrviog+IFWhsIrwVVXNfY4u3ao/OhqgEQs4G50uuBzLtgWhsImgUdSNiY9Kbf" +
-		"5pCgFBCw57yWoo/14YthCgCZJT5MjpngmafCzaf0ARCcm92vkKKjhMwBygCYBTtMlInNj/uBuKbyARCq74DZqNTRwkUOvAgFHUTWgbTmgb3cpyAQsqvD6tj6" +
-		"ooUSMAkAlgVYTOPVpZywhsCm1AEQtIWi1rSekobMAegAm0V9WPD7kZ/U66GmdhCWuanZkL6xmUJaGwiZRdJI9/j+ipPHhKI8EK61noKm7dPPoQGvAJpluUyf" +
-		"+svZ+7aWo9MBEI23gYf+l/qYzgGvAJIFO0jzrK3IuYvapzYQqKfHxL3ez+25AXQAkQV0WMng8uDckeKlBRCxm6HKk9aipBBaGwiQBTlck5XGv/WcpKamARCy" +
-		"re6xpujY/BhaGwiPBR0YyJDCxIvthcGmMIOdoOW777OTC1obCI4FHUjVp9GmnN/GpRYQnMPOv/GwwYLSAZAAhgUdSKnZmLucwr2hexC0vYOLnr3C9+UBHQCH" +
-		"BR1cjPSq6tSg76fQARCt3ajWur7x4wxaHAiIBehMmo7QuY6muKGSARChpYDOqO+g+tohBgCNBR5M+7S2lZOlwaXtARCTpcLkhP6AvKcB6QCMBelY+MiuxqWK" +
-		"zqJ+EICZxvjLj9nLb1obCIsFdUiryuO3hcTcomwQmee5587J/vL7AZIAigUdXLDji/2h3tqk2gEQpJeKiuaPmZRMWhsIiQUdSMXTz7jLwO6iDBCg072msszG" +
-		"g6YBcwCFBXNIq7vgiLzCraVYELH786r+uIGRMYGiAOCBFEikpNfBzPKjrCsQt7G5uZX1ioPrAXMA+EVETO/k+rbgq7WktAEQi7HbnIjN/e45gb8A4EHyWM6l" +
-		"s7S6sYCtPhCa5b7coorA6nNaGwj3BTlIu76bqOjpzqYsEL/1/aHqocHoyAGPAJMFOVidx/WymY+HonkQr8WUncq8gu8qWhwI9kWZTLbyyu6Y3tuhywEQi9Wt" +
-		"j+3dw5TsATpw9dlpEhQI2dfXkcHR16Q1EJr/ip+7/LmHVVobCO0Fc1zvzsPf+OOdo64BELzb8ais/f2pRlobCO4FHVzHkYzjiu+ooMUBELTRssKGnpiXfVob" +
-		"CO8FHUTMjdbB8s/loloQkIP5kZWBq+alF3T02WkSFAjQxMLsg4zgpDMQusOt+ZSv6Lg8WhwI89mBhUzDkeqYgLfFo9IBEIDb1ZGp74CSliE9APIFV0jE5cfD" +
-		"9qS4pyMQlNuvvo/LvqjZAcpw8dlpEhQI2M7qsIa5jKNoEITnyaWBx7GRTVobCPAFOUiqx4eD58K3pyIQqoWYg73C7KmCQV0A7AV0TJvT29+hqfOl1AEQkL/j" +
-		"j63tw6zJAXQA6QU7XIrnidH0sMOi/gEQiMnLruGNgeQ3WhwI5wU7TP2QjqTHtdil8gEQvuO345XP4ojdAZJw6NlpEhQIj5zg4enSmKZ2EI//nYuejdH3EFoc" +
-		"COAFOkjc1vPQ74n3pPcBEI6T2bbyvO+5El8NAN8FdUil46eD29/YpX8QqKmJl4KKvJzoAZIA3gUdSJGAjeG/sqOhCxCR1Yy7srGxzYYBHQDdBR1E2Jz0uMig" +
-		"x6ZPEK63kJzz+5ewEpcJANwFHdCPwc/X3JaSoPEBEJftvqX7l7TQNFoaCNTZaRIUCIWMq4rjte+gAxCA46b3rsuUgRdaGwjV2UHTSMqgkPCHn6OlygEQjvOh" +
-		"39KL1PUO8goA1gVWSL3//frqu+6gNRCCzbDnzPvat48hXQDbBegYpr7phJeC82FjIJaF0aDSwr6f3wEeANoFHkzHuIuTwsqBoNMBEInJyuayjJqR8gHMANkF" +
-		"WVyW36Sgv8m+oZMBEKPxhcKD+MagQ1obCNgFHUjc1biU9Y/Uo+0BEJ+rteiX7+GVAToA1wUdRPW/teuf+dmjDBC27eCN5aib0hJrDADTBR1c1r6th5ba0KCS" +
-		"ARC507fuy9/D1A9aGwjQBR1cm5mV5uz9sKCxARCpq7nipP6lgSlaGwjOBR3QnYzkh7Hb9qWiARCZxa3E9f70rgxaGgjP2WkSFAi+rM2Mi6LJpn0QjeOW4e3T" +
-		"y+NRWhoIx9kBHMiaufnSlqDjp0YQhJH608n+74Y9WhoIxtlpEhQI7pzPgt39yKBrEIO58uSC6uC/KlobCMUFcVymjM/pnOjSo8kBEJfpz7uT9qSwWFobCMQF" +
-		"HUiahfXZ+aLEpGgQmNGm58292fDSQXxww9lpEhQIorfOo9n/sKMiELHt4o6zkPiQXlobCLsFOVze4JLP7L6GpMABEJ6x6und0d2iN1obCLwFHUjg89H50fSS" +
-		"pSUQluehnd+ssqCoAVbgvdlpEhQImZGC19+4n6Z/ELKRseqQ/MmTH1oaCMLZaRIUCJ+3wIiujdWlXRC796zI2Kzutw9aHAjBJegc+KeNqo2GxqGBLRyxlaTe" +
-		"mYmJ00EGAMAFHkyy/eOMl7WKo78BEIjnkOCXubPZtgEeAL8FHtCHsZit65qhpfEBEIONpbGMgrr8wwFaGQi+2WkSEwj+sr+PlurpJhCqh8vM3oujtCFaGwi6" +
-		"2UG1RMGBuK2T5u2hShCV067ivLui0mVFALcF50TX54zE+8zxpzcQj/3bltmHpOhluVy12WkSFAjmg6CAl+3UoRUQooHam9G66M/hAAC2BTlMrIzf3rSM9KCY" +
-		"ARC0r+TI+q3521UO2Qt02WkSFAi4sK7q76TBoAMQjcHngIGNxcgSWhoIrdlpISBAsJy30MDTpngQi/O2qJirtvAObg4AqwVVGOavl7ur/+IOOQ8wq9OEjcvI" +
-		"m7F/WhwIqiUBGJqo2cL88cvhGyCsk8jJnL/D+Pghkwii2WmhwUCbs+a3oqKkAhCwj7X497nHxUGwAKMFV0jeh5Szn9G8oWUQr6H7wOC6wfzCYSQApAUdZM+4" +
-		"7rGd6/GmnAEQhsfFt7i/qeghWhoIqdlpAVZUxdCyqPKjp14QiYeNs4avmvlbWhwIqAWQSKaBgKXFm6ui7AEQnouQ+orb8dxlewCnBVfQ14XZiJKZ4qDkARCA" +
-		"gYz7lMKgnVNaGgim2WkSFAiJ2aGpmI6JoVwQgMfFuKSMs8coWhsIpdkhr0j+nKLT/oPEonYQiY2+iq6Ah8ejAa0AoQVWSNzc3tuxr5SkJBC9ud+q76OblOdB" +
-		"IgCeBZEYnbKv0r+YsIHXIJ7b98LHru6RnwEeAJwFHkzc1pWgvt30peMBEJLjvNXOnt/ylSE/XJ3ZaRIUCOP+jJyg452lMxCT1+KouoXW4kFBAIQSAghIrbHp" +
-		"6Kjl3KV3ELzpxu+fy+GO3QGSAOsFkhio5ZGN4tmtgSkwlM+fkJ+aoJBUWhsI0gUdRKCl5Lbxq6GkVxChi6z0rZHwqhJFEgC5BZFMt/Lctv3wrqDOARCHpcjS" +
-		"7MThrbwBrwCgBR5EtKWQwaXWt6fkARC5gYGOz7TgCa8AgBJ4CFzB5MX0lrfNoVwQvq2G0Nr7oJwLWhwIneDhPEzAm7HU04ybqfoBEJix34aFuMTNzgHpAIIF" +
-		"OkSH3Jb1uKWHpXsQq/Wiv/7i34wO4gxw/9lpEhQI24/c/47WpqEcEJil6IL7x+mlG1ocCJwFVkykwtjBuey2q4kBEI/Fwse9i6ys0QFWAIEFVljagOi4it/2" +
-		"pGIQrL+qkciV/9J1WhwI/gXKIMaI/anu+qKmp8E1GLzxzqPg3PUBOgCbErMIRPyV2aOd7YGvSxCHs9LdgpuJ2g5pCwD9JT9MiYafpc/wsKSSARC3k+WNn4b6" +
-		"oDUOBQ8FOViZt7al97eyrCwQhOeNw4m98LU9WhwI/AVzTJKR18X9+dCl6AEQlIvU7q+Tu7S2IbMEmeBBYlz5/47fucbaq6wBEKCT8NGWw9XgLVobCPsFdFzZ" +
-		"/qvJzJeMpogBEK3NjL+w59TxXVoaCJgFdMjj2aiQkPjkq2sQreftm8qPu4MsWhoI+tlpEhQI39eqvOmC6qR0ELa1kO/MstOIL1oaCJcFOFiXiq61yYvvr0kQ" +
-		"vb++ntePm5xXWhsI+QVxTNPVut6ZvummqAEQvqf40IaP2IIRDgIPCTlUi7aX4bi8rAoQmLPgpZeGjvhCWhsI8xKTEBjU66K82dDlDuINMK3nl9L0yfaoeVob" +
-		"CKwFVlzcl5G3pJH6o68BEITb57rY0PaRHVocCLkSfxJM1uiJmreCjKKIARCvpdrDgKTV7N8hHwT82yEfXLetrZe9oPWhgwEQv/HPis65+LJJWhwI+xLEHUzF" +
-		"ktCl7dGhp5IBEI378fqu642Z40G1AIMFWUy13ZC58+f2pLUBEIS9vsy2oPOI3AFZAIIS8RFcpJigzqXIy6T+ARCCpeuyrc63z3haGgiBEvAQWI7ps6z9lImh" +
-		"BhCgpfn0nef81CZaGwiABTlc5Kf9/MCeg6KGARCuw5jy3dOthUpaGwj/Ba9cvJrDlcP4kaHbARCoybWuu5DKiTRaGwj+BR1I7NPQ9f6c16BFEJnD77jG2crb" +
-		"tEF7AKMFc0Sf9fmOqom+pzsQgfm++pPB5u0OoBYAjgVzSMvqrLjS04mlBhCxz+eM/dbY54cBOQCNBTlE1vGS4oO1nKAHEJKJnt3C6LH4DsEMAIwlA0y0n8Km" +
-		"gO3kpJABEJH7jav4ntjQmSEDAIsFV1yMi9DnioXCovYBEK2T3fObpfiebFobCIoFHUic862pmPHIpHwQqLuYlJuMnerZIVsAiQVYTM6jjIzs0Lak/QEQuZG7" +
-		"3efFjvuIAVgAiAU7RIym7Mnu+qOnAhC236myy/OV5hJGCgCVRQxc8Zapss2o8qX8ARCXwdLF9OHBkAVaHAiiBVhM79O2qMf08abBARCVocjemamxws0BWACU" +
-		"BTsYyoH51+jT5iFdMJXvtLXNzYSVCVoaCKElB1iAk9aBjsOzpiMQjqfF7pOezc0kWhsIkwU5XOO9q4rxjOuluQEQpsW8x/O1l74QWhsIoAWuSPTdhLbekten" +
-		"HBCatZ6Mt8T8+LwBcwCSBTpI0cWf47X13aZ8EJP5xY+I9PbAvwEdAJ8FOlzo5s6FtYunpJcBEKflrJOig923UFocCJFl9ky2jvPT1b30o8wBEIiljv7bhfPo" +
-		"rQE7AJ4FO0SaqqKKl/C9pm8QrJ+s+aWc5asSBwgAkAV1SIfJjcL27rujLBC5q5ia+5Su5MchewCdJSNMuoT2rvvP+qLoARCq6Ziq1Kue2+9BDVyP2WkSFAiG" +
-		"26bI7/uhpwoQoJOphtSYiscOdA0AnAU6TO6riqqovMGllgEQsaOxpfmXruqzATpgjtlpEhQI3+enxtq27KVbEIvpreaTrJ36LA41EwU6TN7Rlu/dm4an5wEQ" +
-		"k5nDpev6yaXQAZIAjQXqTKC5ybq1y7yi2gEQnbHcjcDukai7AVgAmiWYyMDu2KWlzZyhbxCDkbWWo67I5RpaGgiM2WkSFAjP08KUjpz1JhCt2Z7t3vLa4pAB" +
-		"WhoImQU4WJX9o/G10ougURCzhZPThKqsyGFaGwiHJT5ciKGXz42xmqe8ARCMqZuf7ZXTpw5aHAiLBY9MkaK3/Ni2y6XrARCl27rwhOHwgesBjwCYBVdE3rWl" +
-		"t7HFl6YrEJKbwrn8lsWNDiQPAIoleFyN4p7a6L+YoqgBEK355fHU8Km9QVocCJclBEyWs8SkpfuboLUBEIiFpZPpwdfg1yHQAIkFO1zOqfPKxrz/p7ABEIPb" +
-		"sKujzYPvPlocCJYFO0z2n/3nj/mDpecBEKjrrYuY3rjiswE7AIgFO0zWwq7Ttu7zop8BEKLtjOWX+sHBKw63DwXqSNG/29T2pfGhNhCk2fTI9u2ol4gBzAiH" +
-		"2WkO0xpU1eTSqNSjoG4Qv4fUsfiL7OhlWhsIlAU5IPuf0NeFk7Gmzg6XFhiM79mT87RoDnYUANwBOUSqxY3D5uLMplEQkPeR4dOX077BrgCSBa1Mgc3o24qR" +
-		"iKWcARCFsen8pvq5qdsBrQCRBVdcsuOiluq2xKblARCpi9S9o7rluwNaHAiQBTtM/tv5/8H73KX9ARC1g//Toa7SkJcBOwCPBTtc8NmZrumDjKWTARCm4+jt" +
-		"4fe61xtaGwiGBR1c6vP0+JC5oqLKARC/45i4mJLilXVaGwiFBR1Ik4uy7KvEwqOCARCCo9iKvo/BuQ4cDQD6pVVIk4Tjze3nk6CdARCzz93nksjG6w7RFAD5" +
-		"xSFMu+Ksvs2fi6apARCW27/0+vfli8BBuQD9BR5Mr9nY/f7vqaO6ARCM09OS5POv4ocBsADQBVlcvMidg8fvnKTuARCo9cXNgrq35nRaGwjPBR1It5eBy7ug" +
-		"96DYARC+5/WX9P/QuqE7ANcFHWCL0+3o1rPbo+sBEJfP3sSq8I7vcFoaCNbbIXxE9ObSk4GezqPFARC255HllMzGDswkANUFHETk9eDDwYnSoU4Qj5GC+PG8" +
-		"k5HhYQDUBVVc2OzEutaC4aSpARC345mWvt3Lui5aGwjTBR1M3KuT9u6N56C/ARCu89uZzvqkil0O+AkFHUjSk+SBp/rZokIQkIWik7Wl4bz+AeYA9wUdHMzA" +
-		"r7q3i8umgRUYi5Ok5+H+7MHrAOIFHRjgo56YrMiBDm0ZHLXRgZ+Mzc+WDkoXAOElPkyIvI/8iZG8odEBEKK//v3w5+nu+AFYAOAFO0iBrrnYob+IpQcQkfee" +
-		"jtvCtK2nIXkA3wU7TJDCjZ+Rr8KnuwEQtaeQ2cnH9d+FATsA3gU7XOOKkYjpzLyl6QEQjY3Yzd+LnNJbWhwI3QU7SPyj/Mfkprqj1wEQgaeEqvPGvuLFmADc" +
-		"BR5MvtXsrZXM7KfiARC4gcne87yN2/cBdwD2BR5Ip+nfucrhyKfYARCL++Le4dqLzBKIEAD1BXdIoaXj5eKp7KEGEKGnkra0pKmR1QE7APQFO0yPq66flJL4" +
-		"oPgBEJ/92K6vs4rnkAEeAPMFHkyfgO+v0YzUouMBEKH55qSNl/3ghGGnAO0l1lj+2KzXluTYpngQoZXYjPLvkZoTWhwI2wU6TJHjyYqunY6mhgEQqOWiqsLH" +
-		"7bfdIQoA2gWTSNCK6LHm1pqjZBCa7c2m5+CCi4cBdQDZBTtImZvIvZemzaXAARCzq6aZz63w5UXcAM4FHkystvOYzrHjoIIBELSJ65jZtI2a2gFZAM0FWUyc" +
-		"6db6v+fWo/EBEInFhuTD38XVNg75JQUdSNLRwbv13vGlhAEQjaenkpDjyfAOuxQApAUdTLDP7Om41ZOnwgEQr4mxrMSruZwlDu8ZBXUY08iiweO92CG6IJfr" +
-		"lZSr7ozJvQF1AKsFOxiY6fKhi8T0Di0cMKHD+9u1stjpSlobCKoFHUjZr+img5Txp6MBEI3fy5m/oI2XDroMAKkFHUig0uiRn/b5o3MQj7e9w+ey+qqfIV8A" +
-		"qCVfWNngtNvZm8GmUxCWq/G0u6PL4hpaGwinBTlc/53v9MP97qTGARCG+deC+6Hf2yVaGwimBR1cir2No/mpp6OoARCJ9aSB99W9mBhaHAjLBctMi4fvtZ2K" +
-		"zaOSARCWh+GUsY610dMBywC2BTtIlI6o+vOyyKYUELWDlLjqw/Tb7CGZALUFOxjT3//I+/XmDiEKHKbXlbiqlt/bRd4AtAU7SO+64o2HtJKggQEQm7P83OPh" +
-		"rskOVg8AswU7TKSLgtPgiNygoQEQno3h07uhnN7hAVkAsgUeTIDw2tjggdWhuwEQs9Xx4oqaiI/nIQgAsSUISLXq/d/n9POgBRCznb6zie+b9hcOthgFHFjS" +
-		"4JWUzN23oTkQju369afr4MJyWhwIygVWSJnMnqH33vunwQEQpr3eua7zla8Sog0AyQU6WMaMz9ydwoenHRCm0YiEjYPUs19aGgjIBRxEi7nsr7uG3aY1EISZ" +
-		"v4G74ZbHoXoAxwVWIJOZ9YOIo7ikmw6iDRjkroLfvPOCIUAAxiUFSIH0h4SJ4qOkaRClo+2E7ciPrq4ByQDFBVdYjejW24H75aVDEJHXxtadzPm+GlocCMQF" +
-		"VxjGx4Pl1Oavoe4cpdPM3fbEkroS5w8AwwVXXNjApeef/Zmm3QEQqfuUvePR3a4fWhsIwgUdGIWJ5rjE54dlMBjjxtvA0Zy14aMAwQVYTNChsoi3ipik+QEQ" +
-		"lM/tjZG50vyOAa8ArwU7SKOWoMv85/uiywEQpPXjyp6tz9cOcB0AwAWvWL77/sT888ykDxCZ4dWeh5KgjGpaGwi/BTlI5a//hKrI6aJcEJGhxuqXoKzc6CHP" +
-		"AL4FdEi5oOi1yue4oMwBEJmrt7usgv70ZS4AvQU7RJjokMqFj5OgJxCXo82o16+yzBISGgC8BR1c5tT8j/zq86aaARCY8f7pm+qC+m5aHAi7BVhgjrLevf7H" +
-		"zaWWARCT//Gx+YiM2eEBWhsIugU7SM+M8Kz4rreingEQgfermeCf8NIO7xAAuQUdXOzIpeGKgIKigAEQjbPszea+1KwvWhsIuAkdRJX87q7IsqE8ELKX7Z7X" +
-		"lrinvQHNALcFdUyIi4+wl/WHptkBEJ6RgoHi7O7h/wF1AK4FOyD1nua60NLdoYAO2iEo0uCgjdH1MlobCK0FHVyhsuuE2qGep/ABEIqp07bU7NfnTlobCKIF" +
-		"HUTivZTw8cL6oH0QqJGnqpCfjb0SVxwAoQUdXLqW5pbDgPmjvQEQt7G+zK+Gu9VEWhwIpQWSSM7r74rS3uWn0gEQhM/94tnxkb8SNRQA6xK2Hli61+7Ylem7" +
-		"oAQQlvGJm4n43rgJWhsI+BJjEUjZr/PxvMTQoO8BELqxy82cz+fRoQEE6tcOkQ5cr73YzNaX6qG5ARCw+caWqsOe4V9aHAj3EhMaSKG/4bbGsvWl9QEQit+M" +
-		"2a+VtI4SMAwA8gU7SO3uycvBlNulehC10bifprrH24QhIwD/BXVI0dW3qf7sjaErEIiZtpbso6WZqWETAPEFrlyV7O+syP3npzwQqLf90rnbxNVpWhkI/toO" +
-		"bRREzIaYlo+t+6VsEKjd2+ixmqUnDmIYBXFctr6locGEvKc8EKfvoY28n9KClAFaGwj9BXFIlc/wyYWqn6axARCUt+/CwuGs/w6+DADvErkfTMyro63tgbeg" +
-		"lgEQp8+E5tL40oatAY8E/NoOxAhEgLmOveGT5KEaEKuV36G3+rvbDlYWAO4Fq0iAkNieyKnIoTgQkL/Oo8bh2I0dDs8QBXNIwN2Ft6PEm6BjELqbrKf34sS2" +
-		"rgGQAO0FrUjIoZnq6Ljeo9sBEJuv7fe8tJqYQSQA+gU6RPvbxYTGnrOmERCX05ChiOXUjxIYDgCfRQdI5d7L05SO6KTZARCip4CF1Mmj/Q4mGACKBR1IytWU" +
-		"hfHTxqT2ARCjt9PL+b754Q6SDwCJBR1I/9vx/b6W/qLOARC+gbOtn6bMkWG9AIgFHUTtteC2/rf0oH8QnI+/hrOAidMSOAkAhwUdSJyykP+HiOyhSBC7n/LH" +
-		"+7mB+O8BywCGBR1godnlqd+Ni6XGARCaxYOB+8GsokhaGwjc7UFBXJCYmpGimrKkwwEQge2KoYPAzdYHWhsIhQU6GLGrs+LfoM/hQjCAseDL2+KSrA1aGwiE" +
-		"BR1IivSZkfiNoaVlEJjv6e3lhoydkQF0AJ4FHUSxvaSs84GVokEQh5HJg7LY/pQlXACdBR1Mn4yq59bsz6UwEJiR8dig1uzHzgEOTRNlKUiq7vKsmrW1oMgB" +
-		"ELGFtq/8pJb4EkkIAJsFHkzhkIPXmb3Xp9oBEIPLisj65qS/6wE8AJoFHkyhgtWo6ozno+4BEIfBma6au7S9j0EoBJnbQShYpruRoKS/mqUzEJqH4uWsutqB" +
-		"VlobCJgFk0jOsru2qenFoQkQiYue4o/74LDYAc0AlwUdSIXkwMDY1uOggAEQndnk19SHybsO/iIAlgUdTNTqs6alnraljwEQibXpttzEhb4VDjENBR1IsJnC" +
-		"ramOy6AQELvl46COrZGe8gGQAPZFnFjr/4/QnriNo3oQvfOK5MCs6sZfWhsIgwU5SIWXhpH34c+gMxCyxfjW1JSkxugBOQCUBclY4dy5z/uZ26cXEJnfyMKe" +
-		"qvSZCFocCJMlA0T00+yIstqipMIBELWbyuy3w50OdAoIGwiSBVdIj9md7t2P3aDtARC/58aowsO/2A4aIgCRBVdE3bzNjvzUrCEQlKOtv839tLPGIQMAkAU5" +
-		"XOLazdKp2pujowEQnvnu2JHgqNZDWhoIjwU5WNqlzc/RrtWjGRCnpZ6nnM7YsEZaGwiOBTlI7pPlsfy546MtEJmXpPuTlrCj4gFWAI0FHVz2pryU9cGQoXQQ" +
-		"i4Gf0ZPQ36qUAVobCIwFHVz6lv6uvpTWp7MBEJCVlazchOeGFVoaCOklPFjz9JbKxpvKpX0QnI/g/r7qrr0DWhsI9mWeYLeM75Oh0oSnyQEQi/n2n6rrqdkc" +
-		"WhsI6NdB8Ejw99rklpLkokcQr+3/1ZTOk7avQUAA9aUxGP2TwKXZrvMO4RQckLGvg/igvrMSLBIA7AU7XJ7x246jsdujkQEQv724lOLlj5dlWhoI+YWFWJfy" +
-		"k/ekp/qmNBC7w8aE6rbRhQRaGwjMBZFIp5za65OS3KXUARCIseSt++7+lg6jGgDLBR0YuKnZrZWG6QFWMJm3+5WW7czpGVoaCNMFVli1ori/2obxpE0Qs6ON" +
-		"76nEtpkYWhoI0gUcRMb+gs/c5qqjRhC++7KdqYGo/Q6kDgDEBasY/s6Zj5a89g7dCjC0k/PwqMad7l5aGgjRBTlY6ZjohMfC7qJ7ELrTj/vEr56vBlobCMMF" +
-		"OUiFtJOSm4P0oxcQubH0+/KtuqeiIR8A0CUfTN6W+YWkyLigtgEQpevWpIjks8mzIbAAzwXJSI6mi4GclZCiZhCmrdCh/7nv/6dBswDOBXRY9NP8x9Sh8KRm" +
-		"ELS/1/z969PnelobCOYFdEzvz7z1+JuIpqQBEIyNptW91OL6Lw7KFQVWRJOH+LScoYymFBCEn9ufr7OGxxJ5CADhBR1I+uHjz8HTsqOWARCdiefVxKT8+Q51" +
-		"FgDURSNYufDgvPffnKJ6EKDJsJ7gw8LPTVobCN4FOVyg1re9td7Kpu0BELPZocu3h5aNHloaCOAFrFifvYiJvvzKpnEQso2RsYmn2aYXWhwI08WKSL790I+b" +
-		"k6ylkQEQrNuO9P7R7OWlagDdBVdE8dnDioe1qaM7EKvFjO/9verjEqYLANwFHUi/ooi5vdDDpH0QgqO8mseQ1qrWIT0A2wUdSJmxrtu+kJ2kPhCOn7Dq8qeu" +
-		"ucEBHQDaBR0Y8Lm/yYPk1A47FjCk946L4rSngHxaHAjZJZVI09r55rzdyKbQARCk05v/xfyW/hJbDQDlJVxczOH/4eKA9aerARCsvf7eitnulW9aHAjyBTsg" +
-		"5qKft8e+jKSaDrQNGPO+tYGi0OcBdgDkBTtI1o6CzqPx/Kb3ARCn/YjK+LPm6g7kKgDxBZNI2b+FqJXv7aC8ARCjy8bew8i8rQ4hDQDjBTpEsJmY0cnWwKcS" +
-		"EJOxsoDWg5nvEuoWAPAFOkjEoOzrveKPoiYQk63YsLqp06uhQScA4iW0RJWJpP/1jvKlehCN5dr369r5hg6CGQDvJZdEh9js1PiQm6YxEISDwq7ymtyUDrAN" +
-		"AOEFckynneGN7qjSpIgBEIy5x4rchI33Gg6HIQVyRNS6oa/K9LOgFRCZhcP49b3jpBL3CgDgJdFMoaaHlLC51qKeARCX/6Hdmb7k9/1B8gDtJSJIuvS6oYuT" +
-		"hKSRARCdx5fnntuZ3hIICQDfBa5E9r3cla2wpKUxEIShufjR7qf9DioKAOwFdRiYyYiBtPK1DmspHJ2LwJT3wc2FDtEXAN4FOUSPgvaDq9Keo1EQh6nfmerJ" +
-		"tK8O9iAA6wVzTObpprDt/s+j/AEQqJuomae/rq3CAZEA3QWvGK6fgJK/hLgOJwkcgKmugImY4e4Skw0A6gU8SKvO3ouKw6mi6gEQju3y/qTU8frldwDcJSVI" +
-		"57Gr64W6qKQoEIDpppGi3bqSwwFZAOkFO0ycgPvatOGMo8MBEKrVyePvgrnw2EEMANsFO0S0n/uWnO7Cpl4QqK3UiK2UscYSUCEA6AXrSJqK86vOmsWjBRCw" +
-		"x5/vvu/nhPQBOgDnBR1Ih+Dmv6rPyKV4EJOHwe2upfre0CHvAKcS+hNYw5q88ZLw96dFEJ/Tv7ihhfXlRVocCOIFkUzF6v7r0Zn9pskBEKOj6tuLnLGGjQGv" +
-		"AKYS3RNM/ZaBgf29wKSLARC6j87d6O/4oIkBHgClBR4Yj9rKj7uO8g72LSC9w9/6oOnmq7oBkwDfBZNItbamleWVkKR2EIbniO/v4Lvm5gE7ANYFd0i1qPGb" +
-		"14SapfcBELb1q+rQ/rCGxbEA1QU7TKTt3vHIo/OitwEQtc/r4OmB97FADn8sBR1IiKqbrN+vkKBkEJ7f77rp6ZKlyQHrAMlFvliA47SJyf7Fp3QQqe3W1vDn" +
-		"l705WhsIzQU5RM6U9Pqzq4igShCK0ZqGicy4uxKKGQD0RSxYrbzJyrb8pqdAEIHJ/vCp+8OfOlocCIHl7Ritutu6uvbjoecgm8nZje3c0PXLAcsA5QUeGNfJ" +
-		"kPys98AhQiC2mZmskfWyl7AhBgCgBXVEi9H9s+rcx6beARCY+8PojfWnEmsTAOTlfBzHkNTCkOPloA53FRzX/NHStM7ScQ4VLgU6SMK954m6poyhmwEQqpP1" +
-		"zbmXpb8ODwkA7AU6TMzlgrqkoaOixwEQlOmrqZKn6KVIDgERBTpciMGmpd6zlKDcARCO05uYsorg021aGwjrBTpMzvfw2sH4haXnARCns5Xyx/fJ6kUOAShF" +
-		"gUieie2i3O3+ox0Qr72AtKO2ltqJAcsApgVXSKPX69m/+4ekDhCiocr8l9SY3r8heQDqEp0IWOqxgcWQzIWnfRCJu6nL7vaXhSBaGwilBTkY/4m3qevM6A5c" +
-		"Ixye75Sq7KmV7mHCAOkFkBin4N+JopWWYYkwv+m3k6CS7aNAWhwIpEUnZKH4jOvJlZKh+wEQqcuA1rfAvde0AVoZCOjbDgUNVJH7kZOKiIkmEKfn1b6MutK1" +
-		"Z1oaCKNFCFjA6YXQ1NWGoikQhZP8qMXJ3/JsWhsI5wVyXNq4sKG67rulpgEQg5v/oa2V1/JxWhoIogU5RP2+7Om19YmgQBCNi4W1kuGGpw4rGADHBchIqJ7h" +
-		"tbvNlaNvEJmxy5Pt4Yuq0UEHALIFqxjM7IKJxrnFDgESHKL/yKvHp8a6ZQ0AsQU7GKW/qsu7qpbBITCq/f6Wj/LM41BaGwiwBR1IubHn99z8oKJyEKTX9/+l" +
-		"4LHGrgFYAKKFi0zUs+297rDjo9EBEK3bnfLuko3JnwEeAK8FdhiKucydyojADocZIKb/uL2soPr0+gEeAK4FHky1/orTm4rZoakBEJOJm8mch+jfqSHQAPIl" +
-		"CEivxIvTmNzwpQQQjO36zOXd2oKsAR0ArQWUSPW/8a2wi+qjcxCj9f/EgLnFxr8BWADxRfMYssT8mLr7/wFYGKLz7d7vzM4OUC0IGwisBTtIhrj2kqL0iqNX" +
-		"EJLJosL5zs6R3EEoAMYlYES9+4i+s8CgpjAQmIvcr7Sg0YwOhwkAxQUcWMe035XZmaakhAEQjMnY9+WCrFpaGwi3RZpIq5vjta7CzKMwEImJgJewnODP2QGt" +
-		"AMQFclysud72tcXop9YBELbDr4PoiciLHlocCMMlBUzI4uvGlKfIoJgBEJyXl72Z07eEuQHLAMIFHki+97qKzoXzo9oBEKbNm4zejr/iEqAPAMEFWUix+ozT" +
-		"y9OaowgQv5P1meXpt+TDAXYAvwUdSODu+cySlLKhNhC+ucrCoZnG4ekB6AC+BcxYy/eLtPmdj6UbEJz70p/SiIyNOVocCOUFdEyd17/V7bbqo9UBEJH5nuaL" +
-		"3fGlmAFXALwFVyCC6Ni36+WXptEOkQsoye227b7ZP1oaCOQFV0SFtPmF3ZuAoXUQoKH3kbqE6bgOJjEAuwVXGIX63/X0gqAOphUgvMf2k7mc8ObnAVcAqBJQ" +
-		"GUihrPKeovb/okAQjInegPWLrKygAa4A4wVXWNma1aXcrdqhXRCesY269t+UzhNaGgi6BRxYhdy+29Ln9aM5EKqj5reJl67eMVocCLkFc0ze/sL/7efSprUB" +
-		"ELO5g8mT1fCltQFzALYFykiWsueDrrLYp30QoZHVi7WyooOyAR0AswUdGJLr9d+FuZgO4wkwncO4przHisR8WhoIuAV0RIaosvuHl6KnRRCBta+2+Yvc8w6i" +
-		"JAD1RQpIw6f7me332KUrEIu98v6OhL3k7AHJAIKFh1ixmZrM6dnwogQQl42W57vnztFmWhwI5kW2GI+e9Mz9x8UOriAco//m2Ji/jMISsxwAoQVzWI/8yfSE" +
-		"1IGjWRC4ge2+gcaPhDNaGwi0BaxE85OQ5pG86aNPEIGvzI3Y6PnbElQKANgFHVzNvv/rz8K4pqUBEJKv0JCeiu+DBFoaCJ0FVljg8MqvsYHdozwQtuW2zN2V" +
-		"x5dcWhsI1wU5XOKKtt/nyMGjxAEQgo+X1bDvvPofWhoIiwXJRN28i5buzcakURCRqcDVu++t2w4WLQDvZblcnquHlZXZn6aPARCrvbvR8t+dsQVaGgiqBXJE" +
-		"trCwuYaRhiUQvvOt9di1l8uxQe0AtyWvTMqQtu6VhO6liQEQoZ+P9M/MzaHKIZIAwAWQTKOoy/ra/aGh5gEQmJWRt9361tVTDt4JBXRc2P7l+aKR1aHIARCH" +
-		"4c/X//mBiRxaGwipBTpIsuSO2OuGl6YSELfZlt3S57aohAF1ALUFdUySm9DL+uWQpIUBEJ+b9P3b6IDJvCGxAOMF6ETbjajUwc+IolkQkamovpmHx8nBOACe" +
-		"BVdMn/+ontHb76P0ARC656GxoreB/XQO5xIFkRiauu7Ug+71DrwzII+NsLrnzODzTA44NiUFWNP41py+546ndhCB4ff4k/WwymNaGgi9BRxInv/dp4/3laVu" +
-		"ELbRs8PhoeboLUEjBazwYfi22tWtsLSn4QEQj/nuzPPJoaKRAWDGBiJiCAkSFHvsyxnRWH7/7APFUN8SVSISeN1BGhZ0aWxlX3BhcGVyX21lZGdyYXkuanBn" +
-		"IgAqI2dpbmdlci8wMGJfdGhlbWUvdGlsOisA8EZSCaIGBhgBKAA4ACJSCBcSFLwJVBI0k/OENiclTEjSMd5Eaj4OGhxidWxsZXRfY2lyY2xlLWJsay1yZXNp" +
-		"emUucGRmIgAqGF4gAGwiYAgIEhSx2EVANguoRBIp7MJvU1Ocfc4EvRoVHY0MbHRnchW3CCJnaWa3AAkqLrYAkF4IDhIUFjVxmMf5kTXeSKObaWHff9pyyPUa" +
-		"GmhhcmRjb3Zlcl8NoDBibGFjay5wbmciAComEWcEMV8pHVYuAAAqDlI5ADIOgDkkOgMaAQBAxgZSBA4GXAAeAQUQEhgIh1YWLVyAKCoMluY9r9sLiMtmsNsL" +
-		"CggIDhIECJbmPQoICAkSBAivBRREFxIECIjLZgoICAgSBAiw2wsQASMMEgoIhg1HKB8KHQgBHYiHBz8lAQUALQEFHDUAAIA/YAFtAQcAEAFJQjAAEMHAwD4l" +
-		"AQUALQEFNjAACIjLZkIwABCenR0/JQEFAC0BBTYwAASw20ZgABCHhgY/JQEFAC0BBSw1AACAP2ABbQAAgD8=" +
-		""
+	static let metadataRange = 14435..<32317
 
 	// Identifiers of the regenerated, dimension-dependent objects (captured table).
 	static let columnRowUIDsID: UInt64 = 1733217
@@ -667,4 +102,2028 @@ enum PagesTableTemplate {
 	static let bodyStorageID: UInt64 = 1732539
 	/// Highest captured object id (for the package id high-water mark).
 	static let maxObjectID: UInt64 = 1734988
+
+	/// The captured records followed by the metadata file.
+	static let bytes: [UInt8] = [
+		0x11, 0x08, 0xE9, 0xED, 0x69, 0x12, 0x0B, 0x08, 0xA8, 0x1F, 0x12, 0x03, 0x03, 0x02, 0x0A, 0x18,
+		0xB1, 0x01, 0x0A, 0x16, 0x08, 0x97, 0x83, 0xE1, 0xBE, 0xD7, 0xF5, 0xD1, 0xA0, 0xF9, 0x01, 0x10,
+		0x99, 0xC7, 0xC6, 0xEA, 0xEC, 0xBB, 0xA6, 0xC7, 0xCB, 0x01, 0x10, 0x0E, 0x18, 0x09, 0x22, 0x00,
+		0x2A, 0x00, 0x32, 0x0C, 0x0A, 0x00, 0x12, 0x00, 0x1A, 0x00, 0x22, 0x00, 0x2A, 0x00, 0x3A, 0x00,
+		0x3A, 0x2C, 0x12, 0x14, 0x08, 0xFF, 0xFF, 0x01, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x18, 0xFF,
+		0xFF, 0x01, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x1A, 0x14, 0x08, 0xFF, 0xFF, 0x01, 0x10, 0xFF,
+		0xFF, 0xFF, 0xFF, 0x07, 0x18, 0xFF, 0xFF, 0x01, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x42, 0x2C,
+		0x12, 0x14, 0x08, 0xFF, 0xFF, 0x01, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x18, 0xFF, 0xFF, 0x01,
+		0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x1A, 0x14, 0x08, 0xFF, 0xFF, 0x01, 0x10, 0xFF, 0xFF, 0xFF,
+		0xFF, 0x07, 0x18, 0xFF, 0xFF, 0x01, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x4A, 0x02, 0x0A, 0x00,
+		0x52, 0x00, 0x62, 0x16, 0x08, 0x8E, 0x83, 0xE1, 0xBE, 0xD7, 0xF5, 0xD1, 0xA0, 0xF9, 0x01, 0x10,
+		0x99, 0xC7, 0xC6, 0xEA, 0xEC, 0xBB, 0xA6, 0xC7, 0xCB, 0x01, 0x6A, 0x00, 0x72, 0x00, 0x7A, 0x00,
+		0x82, 0x01, 0x00, 0x16, 0x08, 0xEA, 0xED, 0x69, 0x12, 0x10, 0x08, 0xA8, 0x1F, 0x12, 0x03, 0x03,
+		0x02, 0x0A, 0x18, 0xE9, 0x01, 0x2A, 0x03, 0xFD, 0xED, 0x69, 0x0A, 0x16, 0x08, 0x96, 0x83, 0xE1,
+		0xBE, 0xD7, 0xF5, 0xD1, 0xA0, 0xF9, 0x01, 0x10, 0x99, 0xC7, 0xC6, 0xEA, 0xEC, 0xBB, 0xA6, 0xC7,
+		0xCB, 0x01, 0x10, 0x0D, 0x18, 0x08, 0x22, 0x32, 0x0A, 0x0A, 0x08, 0x00, 0x10, 0x00, 0x32, 0x04,
+		0x08, 0x00, 0x10, 0x02, 0x0A, 0x06, 0x08, 0x01, 0x10, 0x00, 0x32, 0x00, 0x0A, 0x06, 0x08, 0x02,
+		0x10, 0x00, 0x32, 0x00, 0x0A, 0x06, 0x08, 0x03, 0x10, 0x00, 0x32, 0x00, 0x0A, 0x0C, 0x08, 0x07,
+		0x10, 0x00, 0x32, 0x06, 0x18, 0x00, 0x20, 0x0B, 0x28, 0x0B, 0x2A, 0x00, 0x32, 0x0C, 0x0A, 0x00,
+		0x12, 0x00, 0x1A, 0x00, 0x22, 0x00, 0x2A, 0x00, 0x3A, 0x00, 0x3A, 0x2C, 0x12, 0x14, 0x08, 0xFF,
+		0xFF, 0x01, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x18, 0xFF, 0xFF, 0x01, 0x20, 0xFF, 0xFF, 0xFF,
+		0xFF, 0x07, 0x1A, 0x14, 0x08, 0xFF, 0xFF, 0x01, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x18, 0xFF,
+		0xFF, 0x01, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x42, 0x2C, 0x12, 0x14, 0x08, 0xFF, 0xFF, 0x01,
+		0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x18, 0xFF, 0xFF, 0x01, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0x07,
+		0x1A, 0x14, 0x08, 0xFF, 0xFF, 0x01, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x18, 0xFF, 0xFF, 0x01,
+		0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x4A, 0x02, 0x0A, 0x00, 0x52, 0x00, 0x62, 0x16, 0x08, 0x8E,
+		0x83, 0xE1, 0xBE, 0xD7, 0xF5, 0xD1, 0xA0, 0xF9, 0x01, 0x10, 0x99, 0xC7, 0xC6, 0xEA, 0xEC, 0xBB,
+		0xA6, 0xC7, 0xCB, 0x01, 0x6A, 0x06, 0x0A, 0x04, 0x08, 0xFD, 0xED, 0x69, 0x72, 0x00, 0x7A, 0x00,
+		0x82, 0x01, 0x00, 0x10, 0x08, 0xFD, 0xED, 0x69, 0x12, 0x0A, 0x08, 0xA9, 0x1F, 0x12, 0x03, 0x01,
+		0x00, 0x05, 0x18, 0x38, 0x08, 0x0D, 0x10, 0x00, 0x18, 0x00, 0x22, 0x0A, 0x08, 0x00, 0x10, 0x00,
+		0x32, 0x04, 0x08, 0x00, 0x10, 0x02, 0x22, 0x06, 0x08, 0x01, 0x10, 0x00, 0x32, 0x00, 0x22, 0x06,
+		0x08, 0x02, 0x10, 0x00, 0x32, 0x00, 0x22, 0x06, 0x08, 0x03, 0x10, 0x00, 0x32, 0x00, 0x22, 0x0C,
+		0x08, 0x07, 0x10, 0x00, 0x32, 0x06, 0x18, 0x00, 0x20, 0x0B, 0x28, 0x0B, 0x16, 0x08, 0xEB, 0xED,
+		0x69, 0x12, 0x10, 0x08, 0xA8, 0x1F, 0x12, 0x03, 0x03, 0x02, 0x0A, 0x18, 0xB7, 0x01, 0x2A, 0x03,
+		0xFE, 0xED, 0x69, 0x0A, 0x16, 0x08, 0xB1, 0x83, 0xE1, 0xBE, 0xD7, 0xF5, 0xD1, 0xA0, 0xF9, 0x01,
+		0x10, 0x99, 0xC7, 0xC6, 0xEA, 0xEC, 0xBB, 0xA6, 0xC7, 0xCB, 0x01, 0x10, 0x0B, 0x18, 0x23, 0x22,
+		0x00, 0x2A, 0x00, 0x32, 0x0C, 0x0A, 0x00, 0x12, 0x00, 0x1A, 0x00, 0x22, 0x00, 0x2A, 0x00, 0x3A,
+		0x00, 0x3A, 0x2C, 0x12, 0x14, 0x08, 0xFF, 0xFF, 0x01, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x18,
+		0xFF, 0xFF, 0x01, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x1A, 0x14, 0x08, 0xFF, 0xFF, 0x01, 0x10,
+		0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x18, 0xFF, 0xFF, 0x01, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x42,
+		0x2C, 0x12, 0x14, 0x08, 0xFF, 0xFF, 0x01, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x18, 0xFF, 0xFF,
+		0x01, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x1A, 0x14, 0x08, 0xFF, 0xFF, 0x01, 0x10, 0xFF, 0xFF,
+		0xFF, 0xFF, 0x07, 0x18, 0xFF, 0xFF, 0x01, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x4A, 0x02, 0x0A,
+		0x00, 0x52, 0x00, 0x62, 0x16, 0x08, 0x8E, 0x83, 0xE1, 0xBE, 0xD7, 0xF5, 0xD1, 0xA0, 0xF9, 0x01,
+		0x10, 0x99, 0xC7, 0xC6, 0xEA, 0xEC, 0xBB, 0xA6, 0xC7, 0xCB, 0x01, 0x6A, 0x06, 0x0A, 0x04, 0x08,
+		0xFE, 0xED, 0x69, 0x72, 0x00, 0x7A, 0x00, 0x82, 0x01, 0x00, 0x10, 0x08, 0xFE, 0xED, 0x69, 0x12,
+		0x0A, 0x08, 0xA9, 0x1F, 0x12, 0x03, 0x01, 0x00, 0x05, 0x18, 0x06, 0x08, 0x0B, 0x10, 0x00, 0x18,
+		0x00, 0x11, 0x08, 0xEC, 0xED, 0x69, 0x12, 0x0B, 0x08, 0xA8, 0x1F, 0x12, 0x03, 0x03, 0x02, 0x0A,
+		0x18, 0xB1, 0x01, 0x0A, 0x16, 0x08, 0x94, 0x83, 0xE1, 0xBE, 0xD7, 0xF5, 0xD1, 0xA0, 0xF9, 0x01,
+		0x10, 0x99, 0xC7, 0xC6, 0xEA, 0xEC, 0xBB, 0xA6, 0xC7, 0xCB, 0x01, 0x10, 0x0A, 0x18, 0x06, 0x22,
+		0x00, 0x2A, 0x00, 0x32, 0x0C, 0x0A, 0x00, 0x12, 0x00, 0x1A, 0x00, 0x22, 0x00, 0x2A, 0x00, 0x3A,
+		0x00, 0x3A, 0x2C, 0x12, 0x14, 0x08, 0xFF, 0xFF, 0x01, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x18,
+		0xFF, 0xFF, 0x01, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x1A, 0x14, 0x08, 0xFF, 0xFF, 0x01, 0x10,
+		0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x18, 0xFF, 0xFF, 0x01, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x42,
+		0x2C, 0x12, 0x14, 0x08, 0xFF, 0xFF, 0x01, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x18, 0xFF, 0xFF,
+		0x01, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x1A, 0x14, 0x08, 0xFF, 0xFF, 0x01, 0x10, 0xFF, 0xFF,
+		0xFF, 0xFF, 0x07, 0x18, 0xFF, 0xFF, 0x01, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x4A, 0x02, 0x0A,
+		0x00, 0x52, 0x00, 0x62, 0x16, 0x08, 0x8E, 0x83, 0xE1, 0xBE, 0xD7, 0xF5, 0xD1, 0xA0, 0xF9, 0x01,
+		0x10, 0x99, 0xC7, 0xC6, 0xEA, 0xEC, 0xBB, 0xA6, 0xC7, 0xCB, 0x01, 0x6A, 0x00, 0x72, 0x00, 0x7A,
+		0x00, 0x82, 0x01, 0x00, 0x11, 0x08, 0xED, 0xED, 0x69, 0x12, 0x0B, 0x08, 0xA8, 0x1F, 0x12, 0x03,
+		0x03, 0x02, 0x0A, 0x18, 0xB1, 0x01, 0x0A, 0x16, 0x08, 0x93, 0x83, 0xE1, 0xBE, 0xD7, 0xF5, 0xD1,
+		0xA0, 0xF9, 0x01, 0x10, 0x99, 0xC7, 0xC6, 0xEA, 0xEC, 0xBB, 0xA6, 0xC7, 0xCB, 0x01, 0x10, 0x09,
+		0x18, 0x05, 0x22, 0x00, 0x2A, 0x00, 0x32, 0x0C, 0x0A, 0x00, 0x12, 0x00, 0x1A, 0x00, 0x22, 0x00,
+		0x2A, 0x00, 0x3A, 0x00, 0x3A, 0x2C, 0x12, 0x14, 0x08, 0xFF, 0xFF, 0x01, 0x10, 0xFF, 0xFF, 0xFF,
+		0xFF, 0x07, 0x18, 0xFF, 0xFF, 0x01, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x1A, 0x14, 0x08, 0xFF,
+		0xFF, 0x01, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x18, 0xFF, 0xFF, 0x01, 0x20, 0xFF, 0xFF, 0xFF,
+		0xFF, 0x07, 0x42, 0x2C, 0x12, 0x14, 0x08, 0xFF, 0xFF, 0x01, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x07,
+		0x18, 0xFF, 0xFF, 0x01, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x1A, 0x14, 0x08, 0xFF, 0xFF, 0x01,
+		0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x18, 0xFF, 0xFF, 0x01, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0x07,
+		0x4A, 0x02, 0x0A, 0x00, 0x52, 0x00, 0x62, 0x16, 0x08, 0x8E, 0x83, 0xE1, 0xBE, 0xD7, 0xF5, 0xD1,
+		0xA0, 0xF9, 0x01, 0x10, 0x99, 0xC7, 0xC6, 0xEA, 0xEC, 0xBB, 0xA6, 0xC7, 0xCB, 0x01, 0x6A, 0x00,
+		0x72, 0x00, 0x7A, 0x00, 0x82, 0x01, 0x00, 0x11, 0x08, 0xEE, 0xED, 0x69, 0x12, 0x0B, 0x08, 0xA8,
+		0x1F, 0x12, 0x03, 0x03, 0x02, 0x0A, 0x18, 0xB1, 0x01, 0x0A, 0x16, 0x08, 0x98, 0x83, 0xE1, 0xBE,
+		0xD7, 0xF5, 0xD1, 0xA0, 0xF9, 0x01, 0x10, 0x99, 0xC7, 0xC6, 0xEA, 0xEC, 0xBB, 0xA6, 0xC7, 0xCB,
+		0x01, 0x10, 0x08, 0x18, 0x0A, 0x22, 0x00, 0x2A, 0x00, 0x32, 0x0C, 0x0A, 0x00, 0x12, 0x00, 0x1A,
+		0x00, 0x22, 0x00, 0x2A, 0x00, 0x3A, 0x00, 0x3A, 0x2C, 0x12, 0x14, 0x08, 0xFF, 0xFF, 0x01, 0x10,
+		0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x18, 0xFF, 0xFF, 0x01, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x1A,
+		0x14, 0x08, 0xFF, 0xFF, 0x01, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x18, 0xFF, 0xFF, 0x01, 0x20,
+		0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x42, 0x2C, 0x12, 0x14, 0x08, 0xFF, 0xFF, 0x01, 0x10, 0xFF, 0xFF,
+		0xFF, 0xFF, 0x07, 0x18, 0xFF, 0xFF, 0x01, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x1A, 0x14, 0x08,
+		0xFF, 0xFF, 0x01, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x18, 0xFF, 0xFF, 0x01, 0x20, 0xFF, 0xFF,
+		0xFF, 0xFF, 0x07, 0x4A, 0x02, 0x0A, 0x00, 0x52, 0x00, 0x62, 0x16, 0x08, 0x8E, 0x83, 0xE1, 0xBE,
+		0xD7, 0xF5, 0xD1, 0xA0, 0xF9, 0x01, 0x10, 0x99, 0xC7, 0xC6, 0xEA, 0xEC, 0xBB, 0xA6, 0xC7, 0xCB,
+		0x01, 0x6A, 0x00, 0x72, 0x00, 0x7A, 0x00, 0x82, 0x01, 0x00, 0x11, 0x08, 0xEF, 0xED, 0x69, 0x12,
+		0x0B, 0x08, 0xA8, 0x1F, 0x12, 0x03, 0x03, 0x02, 0x0A, 0x18, 0xB1, 0x01, 0x0A, 0x16, 0x08, 0x91,
+		0x83, 0xE1, 0xBE, 0xD7, 0xF5, 0xD1, 0xA0, 0xF9, 0x01, 0x10, 0x99, 0xC7, 0xC6, 0xEA, 0xEC, 0xBB,
+		0xA6, 0xC7, 0xCB, 0x01, 0x10, 0x07, 0x18, 0x03, 0x22, 0x00, 0x2A, 0x00, 0x32, 0x0C, 0x0A, 0x00,
+		0x12, 0x00, 0x1A, 0x00, 0x22, 0x00, 0x2A, 0x00, 0x3A, 0x00, 0x3A, 0x2C, 0x12, 0x14, 0x08, 0xFF,
+		0xFF, 0x01, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x18, 0xFF, 0xFF, 0x01, 0x20, 0xFF, 0xFF, 0xFF,
+		0xFF, 0x07, 0x1A, 0x14, 0x08, 0xFF, 0xFF, 0x01, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x18, 0xFF,
+		0xFF, 0x01, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x42, 0x2C, 0x12, 0x14, 0x08, 0xFF, 0xFF, 0x01,
+		0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x18, 0xFF, 0xFF, 0x01, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0x07,
+		0x1A, 0x14, 0x08, 0xFF, 0xFF, 0x01, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x18, 0xFF, 0xFF, 0x01,
+		0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x4A, 0x02, 0x0A, 0x00, 0x52, 0x00, 0x62, 0x16, 0x08, 0x8E,
+		0x83, 0xE1, 0xBE, 0xD7, 0xF5, 0xD1, 0xA0, 0xF9, 0x01, 0x10, 0x99, 0xC7, 0xC6, 0xEA, 0xEC, 0xBB,
+		0xA6, 0xC7, 0xCB, 0x01, 0x6A, 0x00, 0x72, 0x00, 0x7A, 0x00, 0x82, 0x01, 0x00, 0x11, 0x08, 0xF0,
+		0xED, 0x69, 0x12, 0x0B, 0x08, 0xA8, 0x1F, 0x12, 0x03, 0x03, 0x02, 0x0A, 0x18, 0xB1, 0x01, 0x0A,
+		0x16, 0x08, 0x92, 0x83, 0xE1, 0xBE, 0xD7, 0xF5, 0xD1, 0xA0, 0xF9, 0x01, 0x10, 0x99, 0xC7, 0xC6,
+		0xEA, 0xEC, 0xBB, 0xA6, 0xC7, 0xCB, 0x01, 0x10, 0x05, 0x18, 0x04, 0x22, 0x00, 0x2A, 0x00, 0x32,
+		0x0C, 0x0A, 0x00, 0x12, 0x00, 0x1A, 0x00, 0x22, 0x00, 0x2A, 0x00, 0x3A, 0x00, 0x3A, 0x2C, 0x12,
+		0x14, 0x08, 0xFF, 0xFF, 0x01, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x18, 0xFF, 0xFF, 0x01, 0x20,
+		0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x1A, 0x14, 0x08, 0xFF, 0xFF, 0x01, 0x10, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x07, 0x18, 0xFF, 0xFF, 0x01, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x42, 0x2C, 0x12, 0x14, 0x08,
+		0xFF, 0xFF, 0x01, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x18, 0xFF, 0xFF, 0x01, 0x20, 0xFF, 0xFF,
+		0xFF, 0xFF, 0x07, 0x1A, 0x14, 0x08, 0xFF, 0xFF, 0x01, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x18,
+		0xFF, 0xFF, 0x01, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x4A, 0x02, 0x0A, 0x00, 0x52, 0x00, 0x62,
+		0x16, 0x08, 0x8E, 0x83, 0xE1, 0xBE, 0xD7, 0xF5, 0xD1, 0xA0, 0xF9, 0x01, 0x10, 0x99, 0xC7, 0xC6,
+		0xEA, 0xEC, 0xBB, 0xA6, 0xC7, 0xCB, 0x01, 0x6A, 0x00, 0x72, 0x00, 0x7A, 0x00, 0x82, 0x01, 0x00,
+		0x10, 0x08, 0xF1, 0xED, 0x69, 0x12, 0x0A, 0x08, 0xA8, 0x1F, 0x12, 0x03, 0x03, 0x02, 0x0A, 0x18,
+		0x6F, 0x0A, 0x16, 0x08, 0x8E, 0x83, 0xE1, 0xBE, 0xD7, 0xF5, 0xD1, 0xA0, 0xF9, 0x01, 0x10, 0x99,
+		0xC7, 0xC6, 0xEA, 0xEC, 0xBB, 0xA6, 0xC7, 0xCB, 0x01, 0x10, 0x04, 0x18, 0x01, 0x22, 0x00, 0x2A,
+		0x00, 0x32, 0x0C, 0x0A, 0x00, 0x12, 0x00, 0x1A, 0x00, 0x22, 0x00, 0x2A, 0x00, 0x3A, 0x00, 0x3A,
+		0x14, 0x12, 0x08, 0x08, 0x00, 0x10, 0x00, 0x18, 0x03, 0x20, 0x04, 0x1A, 0x08, 0x08, 0x01, 0x10,
+		0x01, 0x18, 0x03, 0x20, 0x04, 0x42, 0x14, 0x12, 0x08, 0x08, 0x00, 0x10, 0x00, 0x18, 0x03, 0x20,
+		0x04, 0x1A, 0x08, 0x08, 0x01, 0x10, 0x01, 0x18, 0x03, 0x20, 0x04, 0x4A, 0x02, 0x0A, 0x00, 0x52,
+		0x00, 0x5A, 0x04, 0x08, 0xF4, 0xE4, 0x69, 0x6A, 0x00, 0x72, 0x00, 0x7A, 0x00, 0x82, 0x01, 0x00,
+		0x11, 0x08, 0xF2, 0xED, 0x69, 0x12, 0x0B, 0x08, 0xA8, 0x1F, 0x12, 0x03, 0x03, 0x02, 0x0A, 0x18,
+		0xB1, 0x01, 0x0A, 0x16, 0x08, 0x99, 0x83, 0xE1, 0xBE, 0xD7, 0xF5, 0xD1, 0xA0, 0xF9, 0x01, 0x10,
+		0x99, 0xC7, 0xC6, 0xEA, 0xEC, 0xBB, 0xA6, 0xC7, 0xCB, 0x01, 0x10, 0x06, 0x18, 0x0B, 0x22, 0x00,
+		0x2A, 0x00, 0x32, 0x0C, 0x0A, 0x00, 0x12, 0x00, 0x1A, 0x00, 0x22, 0x00, 0x2A, 0x00, 0x3A, 0x00,
+		0x3A, 0x2C, 0x12, 0x14, 0x08, 0xFF, 0xFF, 0x01, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x18, 0xFF,
+		0xFF, 0x01, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x1A, 0x14, 0x08, 0xFF, 0xFF, 0x01, 0x10, 0xFF,
+		0xFF, 0xFF, 0xFF, 0x07, 0x18, 0xFF, 0xFF, 0x01, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x42, 0x2C,
+		0x12, 0x14, 0x08, 0xFF, 0xFF, 0x01, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x18, 0xFF, 0xFF, 0x01,
+		0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x1A, 0x14, 0x08, 0xFF, 0xFF, 0x01, 0x10, 0xFF, 0xFF, 0xFF,
+		0xFF, 0x07, 0x18, 0xFF, 0xFF, 0x01, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x4A, 0x02, 0x0A, 0x00,
+		0x52, 0x00, 0x62, 0x16, 0x08, 0x8E, 0x83, 0xE1, 0xBE, 0xD7, 0xF5, 0xD1, 0xA0, 0xF9, 0x01, 0x10,
+		0x99, 0xC7, 0xC6, 0xEA, 0xEC, 0xBB, 0xA6, 0xC7, 0xCB, 0x01, 0x6A, 0x00, 0x72, 0x00, 0x7A, 0x00,
+		0x82, 0x01, 0x00, 0x11, 0x08, 0xF3, 0xED, 0x69, 0x12, 0x0B, 0x08, 0xA8, 0x1F, 0x12, 0x03, 0x03,
+		0x02, 0x0A, 0x18, 0xB1, 0x01, 0x0A, 0x16, 0x08, 0x9A, 0x83, 0xE1, 0xBE, 0xD7, 0xF5, 0xD1, 0xA0,
+		0xF9, 0x01, 0x10, 0x99, 0xC7, 0xC6, 0xEA, 0xEC, 0xBB, 0xA6, 0xC7, 0xCB, 0x01, 0x10, 0x0C, 0x18,
+		0x0C, 0x22, 0x00, 0x2A, 0x00, 0x32, 0x0C, 0x0A, 0x00, 0x12, 0x00, 0x1A, 0x00, 0x22, 0x00, 0x2A,
+		0x00, 0x3A, 0x00, 0x3A, 0x2C, 0x12, 0x14, 0x08, 0xFF, 0xFF, 0x01, 0x10, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x07, 0x18, 0xFF, 0xFF, 0x01, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x1A, 0x14, 0x08, 0xFF, 0xFF,
+		0x01, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x18, 0xFF, 0xFF, 0x01, 0x20, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x07, 0x42, 0x2C, 0x12, 0x14, 0x08, 0xFF, 0xFF, 0x01, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x18,
+		0xFF, 0xFF, 0x01, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x1A, 0x14, 0x08, 0xFF, 0xFF, 0x01, 0x10,
+		0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x18, 0xFF, 0xFF, 0x01, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x4A,
+		0x02, 0x0A, 0x00, 0x52, 0x00, 0x62, 0x16, 0x08, 0x8E, 0x83, 0xE1, 0xBE, 0xD7, 0xF5, 0xD1, 0xA0,
+		0xF9, 0x01, 0x10, 0x99, 0xC7, 0xC6, 0xEA, 0xEC, 0xBB, 0xA6, 0xC7, 0xCB, 0x01, 0x6A, 0x00, 0x72,
+		0x00, 0x7A, 0x00, 0x82, 0x01, 0x00, 0x11, 0x08, 0xB8, 0xE0, 0x69, 0x12, 0x0B, 0x08, 0xA4, 0x1F,
+		0x12, 0x03, 0x01, 0x00, 0x05, 0x18, 0x8D, 0x03, 0x0A, 0x18, 0x10, 0xA1, 0xBD, 0xEE, 0xDC, 0x02,
+		0x18, 0xF5, 0xE0, 0xAA, 0xAA, 0x05, 0x20, 0x8A, 0xBD, 0xBA, 0xA1, 0x07, 0x28, 0xB9, 0xE1, 0xAC,
+		0xF7, 0x0C, 0x1A, 0x33, 0x0A, 0x2F, 0x0A, 0x2D, 0x08, 0x24, 0xD2, 0x01, 0x04, 0x08, 0x02, 0x10,
+		0x01, 0xDA, 0x01, 0x04, 0x08, 0x00, 0x10, 0x01, 0xE2, 0x01, 0x1A, 0x0A, 0x18, 0x10, 0x8E, 0x83,
+		0xE1, 0xBE, 0x07, 0x18, 0xAD, 0x8F, 0x85, 0xCA, 0x0F, 0x20, 0x99, 0xC7, 0xC6, 0xEA, 0x0C, 0x28,
+		0xDE, 0xB3, 0xBA, 0xDC, 0x0C, 0x10, 0x00, 0x1A, 0x33, 0x0A, 0x2F, 0x0A, 0x2D, 0x08, 0x24, 0xD2,
+		0x01, 0x04, 0x08, 0x04, 0x10, 0x01, 0xDA, 0x01, 0x04, 0x08, 0x00, 0x10, 0x01, 0xE2, 0x01, 0x1A,
+		0x0A, 0x18, 0x10, 0x8E, 0x83, 0xE1, 0xBE, 0x07, 0x18, 0xAD, 0x8F, 0x85, 0xCA, 0x0F, 0x20, 0x99,
+		0xC7, 0xC6, 0xEA, 0x0C, 0x28, 0xDE, 0xB3, 0xBA, 0xDC, 0x0C, 0x10, 0x01, 0x1A, 0x33, 0x0A, 0x2F,
+		0x0A, 0x2D, 0x08, 0x24, 0xD2, 0x01, 0x04, 0x08, 0x06, 0x10, 0x01, 0xDA, 0x01, 0x04, 0x08, 0x00,
+		0x10, 0x01, 0xE2, 0x01, 0x1A, 0x0A, 0x18, 0x10, 0x8E, 0x83, 0xE1, 0xBE, 0x07, 0x18, 0xAD, 0x8F,
+		0x85, 0xCA, 0x0F, 0x20, 0x99, 0xC7, 0xC6, 0xEA, 0x0C, 0x28, 0xDE, 0xB3, 0xBA, 0xDC, 0x0C, 0x10,
+		0x02, 0x1A, 0x33, 0x0A, 0x2F, 0x0A, 0x2D, 0x08, 0x24, 0xD2, 0x01, 0x04, 0x08, 0x00, 0x10, 0x01,
+		0xDA, 0x01, 0x04, 0x08, 0x02, 0x10, 0x01, 0xE2, 0x01, 0x1A, 0x0A, 0x18, 0x10, 0x8E, 0x83, 0xE1,
+		0xBE, 0x07, 0x18, 0xAD, 0x8F, 0x85, 0xCA, 0x0F, 0x20, 0x99, 0xC7, 0xC6, 0xEA, 0x0C, 0x28, 0xDE,
+		0xB3, 0xBA, 0xDC, 0x0C, 0x10, 0x03, 0x1A, 0x33, 0x0A, 0x2F, 0x0A, 0x2D, 0x08, 0x24, 0xD2, 0x01,
+		0x04, 0x08, 0x00, 0x10, 0x01, 0xDA, 0x01, 0x04, 0x08, 0x04, 0x10, 0x01, 0xE2, 0x01, 0x1A, 0x0A,
+		0x18, 0x10, 0x8E, 0x83, 0xE1, 0xBE, 0x07, 0x18, 0xAD, 0x8F, 0x85, 0xCA, 0x0F, 0x20, 0x99, 0xC7,
+		0xC6, 0xEA, 0x0C, 0x28, 0xDE, 0xB3, 0xBA, 0xDC, 0x0C, 0x10, 0x04, 0x1A, 0x33, 0x0A, 0x2F, 0x0A,
+		0x2D, 0x08, 0x24, 0xD2, 0x01, 0x04, 0x08, 0x00, 0x10, 0x01, 0xDA, 0x01, 0x04, 0x08, 0x06, 0x10,
+		0x01, 0xE2, 0x01, 0x1A, 0x0A, 0x18, 0x10, 0x8E, 0x83, 0xE1, 0xBE, 0x07, 0x18, 0xAD, 0x8F, 0x85,
+		0xCA, 0x0F, 0x20, 0x99, 0xC7, 0xC6, 0xEA, 0x0C, 0x28, 0xDE, 0xB3, 0xBA, 0xDC, 0x0C, 0x10, 0x05,
+		0x1A, 0x33, 0x0A, 0x2F, 0x0A, 0x2D, 0x08, 0x24, 0xD2, 0x01, 0x04, 0x08, 0x00, 0x10, 0x01, 0xDA,
+		0x01, 0x04, 0x08, 0x08, 0x10, 0x01, 0xE2, 0x01, 0x1A, 0x0A, 0x18, 0x10, 0x8E, 0x83, 0xE1, 0xBE,
+		0x07, 0x18, 0xAD, 0x8F, 0x85, 0xCA, 0x0F, 0x20, 0x99, 0xC7, 0xC6, 0xEA, 0x0C, 0x28, 0xDE, 0xB3,
+		0xBA, 0xDC, 0x0C, 0x10, 0x06, 0x11, 0x08, 0xFF, 0xED, 0x69, 0x12, 0x0B, 0x08, 0xDD, 0x31, 0x12,
+		0x03, 0x01, 0x00, 0x05, 0x18, 0xE6, 0x05, 0x0A, 0x02, 0x68, 0x31, 0x12, 0x04, 0x72, 0x6F, 0x77,
+		0x34, 0x1A, 0x59, 0x0A, 0x02, 0x68, 0x31, 0x12, 0x04, 0x10, 0x02, 0x18, 0x01, 0x1A, 0x4D, 0x0A,
+		0x4B, 0x0A, 0x16, 0x08, 0x8E, 0x83, 0xE1, 0xBE, 0xD7, 0xF5, 0xD1, 0xA0, 0xF9, 0x01, 0x10, 0x99,
+		0xC7, 0xC6, 0xEA, 0xEC, 0xBB, 0xA6, 0xC7, 0xCB, 0x01, 0x12, 0x31, 0x0A, 0x2F, 0x0A, 0x16, 0x08,
+		0x84, 0xD0, 0xF9, 0xE4, 0xF0, 0x89, 0xBB, 0xA2, 0xAA, 0x01, 0x10, 0x8B, 0xE8, 0xF9, 0xB8, 0xE5,
+		0xA7, 0xDB, 0xFD, 0xA1, 0x01, 0x12, 0x15, 0x08, 0xE2, 0xBB, 0xFE, 0xBF, 0xBC, 0x85, 0xAA, 0x9D,
+		0x6B, 0x10, 0x8C, 0xAC, 0x95, 0x86, 0xCC, 0x80, 0xAD, 0x9A, 0x89, 0x01, 0x1A, 0x59, 0x0A, 0x02,
+		0x68, 0x32, 0x12, 0x04, 0x10, 0x03, 0x18, 0x01, 0x1A, 0x4D, 0x0A, 0x4B, 0x0A, 0x16, 0x08, 0x8E,
+		0x83, 0xE1, 0xBE, 0xD7, 0xF5, 0xD1, 0xA0, 0xF9, 0x01, 0x10, 0x99, 0xC7, 0xC6, 0xEA, 0xEC, 0xBB,
+		0xA6, 0xC7, 0xCB, 0x01, 0x12, 0x31, 0x0A, 0x2F, 0x0A, 0x16, 0x08, 0x89, 0xE1, 0x87, 0xF5, 0x93,
+		0x96, 0xAE, 0xBB, 0xDC, 0x01, 0x10, 0xD3, 0x81, 0xB4, 0xC5, 0xA6, 0xE8, 0x88, 0x99, 0xF6, 0x01,
+		0x12, 0x15, 0x08, 0xE2, 0xBB, 0xFE, 0xBF, 0xBC, 0x85, 0xAA, 0x9D, 0x6B, 0x10, 0x8C, 0xAC, 0x95,
+		0x86, 0xCC, 0x80, 0xAD, 0x9A, 0x89, 0x01, 0x1A, 0x57, 0x0A, 0x02, 0x68, 0x33, 0x12, 0x04, 0x10,
+		0x04, 0x18, 0x01, 0x1A, 0x4B, 0x0A, 0x49, 0x0A, 0x16, 0x08, 0x8E, 0x83, 0xE1, 0xBE, 0xD7, 0xF5,
+		0xD1, 0xA0, 0xF9, 0x01, 0x10, 0x99, 0xC7, 0xC6, 0xEA, 0xEC, 0xBB, 0xA6, 0xC7, 0xCB, 0x01, 0x12,
+		0x2F, 0x0A, 0x2D, 0x0A, 0x14, 0x08, 0x92, 0xD6, 0x8D, 0xE5, 0x91, 0xF3, 0xFB, 0x83, 0x4E, 0x10,
+		0xF9, 0xCB, 0xB4, 0x98, 0xE3, 0xB3, 0x9A, 0xBC, 0x03, 0x12, 0x15, 0x08, 0xE2, 0xBB, 0xFE, 0xBF,
+		0xBC, 0x85, 0xAA, 0x9D, 0x6B, 0x10, 0x8C, 0xAC, 0x95, 0x86, 0xCC, 0x80, 0xAD, 0x9A, 0x89, 0x01,
+		0x1A, 0x57, 0x0A, 0x02, 0x68, 0x34, 0x12, 0x04, 0x10, 0x05, 0x18, 0x01, 0x1A, 0x4B, 0x0A, 0x49,
+		0x0A, 0x16, 0x08, 0x8E, 0x83, 0xE1, 0xBE, 0xD7, 0xF5, 0xD1, 0xA0, 0xF9, 0x01, 0x10, 0x99, 0xC7,
+		0xC6, 0xEA, 0xEC, 0xBB, 0xA6, 0xC7, 0xCB, 0x01, 0x12, 0x2F, 0x0A, 0x2D, 0x0A, 0x14, 0x08, 0xAC,
+		0xD8, 0xFB, 0xDD, 0x88, 0xE6, 0x87, 0xA6, 0x05, 0x10, 0xF0, 0xDE, 0x82, 0xBF, 0x95, 0xCF, 0xCC,
+		0xC9, 0x3B, 0x12, 0x15, 0x08, 0xE2, 0xBB, 0xFE, 0xBF, 0xBC, 0x85, 0xAA, 0x9D, 0x6B, 0x10, 0x8C,
+		0xAC, 0x95, 0x86, 0xCC, 0x80, 0xAD, 0x9A, 0x89, 0x01, 0x1A, 0x5C, 0x0A, 0x04, 0x72, 0x6F, 0x77,
+		0x31, 0x12, 0x04, 0x10, 0x06, 0x18, 0x01, 0x1A, 0x4E, 0x0A, 0x4C, 0x0A, 0x16, 0x08, 0x8E, 0x83,
+		0xE1, 0xBE, 0xD7, 0xF5, 0xD1, 0xA0, 0xF9, 0x01, 0x10, 0x99, 0xC7, 0xC6, 0xEA, 0xEC, 0xBB, 0xA6,
+		0xC7, 0xCB, 0x01, 0x12, 0x32, 0x0A, 0x30, 0x0A, 0x16, 0x08, 0x84, 0xD0, 0xF9, 0xE4, 0xF0, 0x89,
+		0xBB, 0xA2, 0xAA, 0x01, 0x10, 0x8B, 0xE8, 0xF9, 0xB8, 0xE5, 0xA7, 0xDB, 0xFD, 0xA1, 0x01, 0x12,
+		0x16, 0x08, 0xE0, 0xAA, 0xEC, 0x89, 0xCB, 0xDA, 0x9F, 0xAA, 0xBD, 0x01, 0x10, 0xA4, 0xDF, 0xD9,
+		0xA9, 0x86, 0xA0, 0xA8, 0xCF, 0xCA, 0x01, 0x1A, 0x5A, 0x0A, 0x04, 0x72, 0x6F, 0x77, 0x32, 0x12,
+		0x04, 0x10, 0x07, 0x18, 0x01, 0x1A, 0x4C, 0x0A, 0x4A, 0x0A, 0x16, 0x08, 0x8E, 0x83, 0xE1, 0xBE,
+		0xD7, 0xF5, 0xD1, 0xA0, 0xF9, 0x01, 0x10, 0x99, 0xC7, 0xC6, 0xEA, 0xEC, 0xBB, 0xA6, 0xC7, 0xCB,
+		0x01, 0x12, 0x30, 0x0A, 0x2E, 0x0A, 0x16, 0x08, 0x84, 0xD0, 0xF9, 0xE4, 0xF0, 0x89, 0xBB, 0xA2,
+		0xAA, 0x01, 0x10, 0x8B, 0xE8, 0xF9, 0xB8, 0xE5, 0xA7, 0xDB, 0xFD, 0xA1, 0x01, 0x12, 0x14, 0x08,
+		0xFD, 0xFB, 0xB9, 0xE6, 0x95, 0x82, 0xA9, 0x8A, 0x4B, 0x10, 0x8E, 0x81, 0x8C, 0xC7, 0xA8, 0xA4,
+		0x85, 0xD0, 0x11, 0x1A, 0x5B, 0x0A, 0x04, 0x72, 0x6F, 0x77, 0x33, 0x12, 0x04, 0x10, 0x08, 0x18,
+		0x01, 0x1A, 0x4D, 0x0A, 0x4B, 0x0A, 0x16, 0x08, 0x8E, 0x83, 0xE1, 0xBE, 0xD7, 0xF5, 0xD1, 0xA0,
+		0xF9, 0x01, 0x10, 0x99, 0xC7, 0xC6, 0xEA, 0xEC, 0xBB, 0xA6, 0xC7, 0xCB, 0x01, 0x12, 0x31, 0x0A,
+		0x2F, 0x0A, 0x16, 0x08, 0x84, 0xD0, 0xF9, 0xE4, 0xF0, 0x89, 0xBB, 0xA2, 0xAA, 0x01, 0x10, 0x8B,
+		0xE8, 0xF9, 0xB8, 0xE5, 0xA7, 0xDB, 0xFD, 0xA1, 0x01, 0x12, 0x15, 0x08, 0xE3, 0x8E, 0xB6, 0xA5,
+		0xED, 0xAA, 0xCE, 0x97, 0xFD, 0x01, 0x10, 0xAE, 0xC0, 0x95, 0xCD, 0xC6, 0xEC, 0xE2, 0x82, 0x4C,
+		0x1A, 0x5B, 0x0A, 0x04, 0x72, 0x6F, 0x77, 0x34, 0x12, 0x04, 0x10, 0x09, 0x18, 0x01, 0x1A, 0x4D,
+		0x0A, 0x4B, 0x0A, 0x16, 0x08, 0x8E, 0x83, 0xE1, 0xBE, 0xD7, 0xF5, 0xD1, 0xA0, 0xF9, 0x01, 0x10,
+		0x99, 0xC7, 0xC6, 0xEA, 0xEC, 0xBB, 0xA6, 0xC7, 0xCB, 0x01, 0x12, 0x31, 0x0A, 0x2F, 0x0A, 0x16,
+		0x08, 0x84, 0xD0, 0xF9, 0xE4, 0xF0, 0x89, 0xBB, 0xA2, 0xAA, 0x01, 0x10, 0x8B, 0xE8, 0xF9, 0xB8,
+		0xE5, 0xA7, 0xDB, 0xFD, 0xA1, 0x01, 0x12, 0x15, 0x08, 0xB3, 0xE3, 0xF3, 0xE8, 0xC0, 0xD4, 0xDB,
+		0xE8, 0x55, 0x10, 0xDE, 0xB7, 0xF7, 0xC6, 0xC0, 0xEE, 0xFD, 0xB2, 0xC4, 0x01, 0x82, 0x01, 0x08,
+		0xF4, 0xE4, 0x69, 0x12, 0x7C, 0x08, 0xF0, 0x2E, 0x12, 0x03, 0x01, 0x00, 0x05, 0x18, 0x99, 0x01,
+		0x22, 0x07, 0x0A, 0x03, 0x0A, 0x01, 0x0A, 0x18, 0x00, 0x22, 0x09, 0x0A, 0x03, 0x0A, 0x01, 0x08,
+		0x10, 0x03, 0x18, 0x00, 0x22, 0x09, 0x0A, 0x03, 0x0A, 0x01, 0x07, 0x10, 0x03, 0x18, 0x00, 0x22,
+		0x09, 0x0A, 0x03, 0x0A, 0x01, 0x05, 0x10, 0x01, 0x18, 0x00, 0x22, 0x09, 0x0A, 0x03, 0x0A, 0x01,
+		0x06, 0x10, 0x01, 0x18, 0x00, 0x22, 0x09, 0x0A, 0x03, 0x0A, 0x01, 0x04, 0x10, 0x01, 0x18, 0x00,
+		0x22, 0x08, 0x0A, 0x04, 0x0A, 0x02, 0x01, 0x0C, 0x18, 0x01, 0x22, 0x08, 0x0A, 0x04, 0x0A, 0x02,
+		0x01, 0x0D, 0x18, 0x01, 0x22, 0x0A, 0x0A, 0x04, 0x0A, 0x02, 0x01, 0x0B, 0x10, 0x01, 0x18, 0x01,
+		0x2A, 0x0F, 0xE6, 0xEC, 0x69, 0xFF, 0xE4, 0x69, 0x97, 0xE5, 0x69, 0xE6, 0xE4, 0x69, 0xE8, 0xE4,
+		0x69, 0x0A, 0x4F, 0x0A, 0x1F, 0x0A, 0x0A, 0x0D, 0xB0, 0x47, 0xC8, 0x42, 0x15, 0xC6, 0x62, 0xEB,
+		0x42, 0x12, 0x0A, 0x0D, 0x75, 0xF2, 0xF0, 0x43, 0x15, 0x00, 0x00, 0xE4, 0x42, 0x18, 0x03, 0x25,
+		0x00, 0x00, 0x00, 0x00, 0x12, 0x04, 0x08, 0xBB, 0xDF, 0x69, 0x1A, 0x12, 0x08, 0x00, 0x10, 0x02,
+		0x18, 0x00, 0x25, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x3F, 0x30, 0x00, 0x28, 0x00,
+		0x38, 0x00, 0x52, 0x04, 0x08, 0xFF, 0xE4, 0x69, 0x5A, 0x04, 0x08, 0xE6, 0xEC, 0x69, 0x60, 0x00,
+		0x68, 0x00, 0x12, 0x04, 0x08, 0x97, 0xE5, 0x69, 0x22, 0x04, 0x08, 0xE6, 0xE4, 0x69, 0x2A, 0x04,
+		0x08, 0xE8, 0xE4, 0x69, 0x3A, 0x16, 0x08, 0x96, 0x83, 0xE1, 0xBE, 0xD7, 0xF5, 0xD1, 0xA0, 0xF9,
+		0x01, 0x10, 0x99, 0xC7, 0xC6, 0xEA, 0xEC, 0xBB, 0xA6, 0xC7, 0xCB, 0x01, 0x42, 0x16, 0x08, 0x92,
+		0x83, 0xE1, 0xBE, 0xD7, 0xF5, 0xD1, 0xA0, 0xF9, 0x01, 0x10, 0x99, 0xC7, 0xC6, 0xEA, 0xEC, 0xBB,
+		0xA6, 0xC7, 0xCB, 0x01, 0x50, 0x00, 0x72, 0x02, 0x0A, 0x00, 0x3E, 0x08, 0xE6, 0xEC, 0x69, 0x12,
+		0x38, 0x08, 0xF9, 0x04, 0x12, 0x03, 0x0A, 0x01, 0x00, 0x18, 0xD6, 0x01, 0x22, 0x0A, 0x0A, 0x06,
+		0x0A, 0x04, 0x01, 0x01, 0x01, 0x0C, 0x18, 0x01, 0x22, 0x08, 0x0A, 0x04, 0x0A, 0x02, 0x01, 0x06,
+		0x18, 0x01, 0x22, 0x0A, 0x0A, 0x06, 0x0A, 0x04, 0x01, 0x01, 0x01, 0x0D, 0x18, 0x01, 0x2A, 0x09,
+		0xA8, 0xDC, 0x69, 0xE7, 0xEC, 0x69, 0x80, 0xEE, 0x69, 0x0A, 0xCB, 0x01, 0x0A, 0xBA, 0x01, 0x0A,
+		0x43, 0x0A, 0x1F, 0x0A, 0x0A, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x12,
+		0x0A, 0x0D, 0x75, 0xF2, 0xF0, 0x43, 0x15, 0x00, 0x00, 0x00, 0x00, 0x18, 0x01, 0x25, 0x00, 0x00,
+		0x00, 0x00, 0x12, 0x04, 0x08, 0xF4, 0xE4, 0x69, 0x1A, 0x12, 0x08, 0x04, 0x10, 0x02, 0x18, 0x01,
+		0x25, 0x00, 0x00, 0x40, 0x41, 0x2D, 0x00, 0x00, 0x00, 0x3F, 0x30, 0x00, 0x28, 0x00, 0x38, 0x00,
+		0x60, 0x00, 0x68, 0x00, 0x12, 0x04, 0x08, 0xA8, 0xDC, 0x69, 0x1A, 0x68, 0x08, 0x00, 0x10, 0x00,
+		0x2A, 0x62, 0x12, 0x0A, 0x0D, 0x75, 0xF2, 0xF0, 0x43, 0x15, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x54,
+		0x0A, 0x0E, 0x08, 0x01, 0x12, 0x0A, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00,
+		0x0A, 0x0E, 0x08, 0x02, 0x12, 0x0A, 0x0D, 0x00, 0x00, 0xC8, 0x42, 0x15, 0x00, 0x00, 0x00, 0x00,
+		0x0A, 0x0E, 0x08, 0x02, 0x12, 0x0A, 0x0D, 0x00, 0x00, 0xC8, 0x42, 0x15, 0x00, 0x00, 0xC8, 0x42,
+		0x0A, 0x0E, 0x08, 0x02, 0x12, 0x0A, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0xC8, 0x42,
+		0x0A, 0x02, 0x08, 0x05, 0x0A, 0x0E, 0x08, 0x01, 0x12, 0x0A, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x15,
+		0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x12, 0x04, 0x08, 0xE7, 0xEC, 0x69, 0x22,
+		0x04, 0x08, 0xE7, 0xEC, 0x69, 0x30, 0x01, 0x12, 0x04, 0x08, 0x80, 0xEE, 0x69, 0x18, 0x01, 0x18,
+		0x08, 0xE7, 0xEC, 0x69, 0x12, 0x12, 0x08, 0xD1, 0x0F, 0x12, 0x03, 0x01, 0x00, 0x05, 0x18, 0x46,
+		0x2A, 0x06, 0xA6, 0xDC, 0x69, 0x99, 0xD7, 0x69, 0x12, 0x04, 0x08, 0x85, 0xE0, 0x69, 0x2A, 0x0A,
+		0x0A, 0x08, 0x08, 0x00, 0x12, 0x04, 0x08, 0xA6, 0xDC, 0x69, 0x32, 0x08, 0x0A, 0x06, 0x08, 0x00,
+		0x10, 0x00, 0x18, 0x00, 0x3A, 0x0A, 0x0A, 0x08, 0x08, 0x00, 0x12, 0x04, 0x08, 0x99, 0xD7, 0x69,
+		0x50, 0x01, 0x72, 0x08, 0x0A, 0x06, 0x08, 0x00, 0x10, 0x00, 0x18, 0x00, 0xC2, 0x01, 0x08, 0x0A,
+		0x06, 0x08, 0x00, 0x10, 0x00, 0x18, 0x00, 0xE2, 0x01, 0x04, 0x0A, 0x02, 0x08, 0x00, 0x10, 0x08,
+		0x80, 0xEE, 0x69, 0x12, 0x0A, 0x08, 0xFA, 0x04, 0x12, 0x03, 0x0A, 0x01, 0x00, 0x18, 0x04, 0x08,
+		0x01, 0x10, 0x07, 0x10, 0x08, 0xFF, 0xE4, 0x69, 0x12, 0x0A, 0x08, 0x99, 0x18, 0x12, 0x03, 0x0A,
+		0x01, 0x00, 0x18, 0x00, 0xDE, 0x03, 0x08, 0x97, 0xE5, 0x69, 0x12, 0xD7, 0x03, 0x08, 0xF1, 0x2E,
+		0x12, 0x03, 0x03, 0x02, 0x0A, 0x18, 0xFA, 0x06, 0x22, 0x09, 0x0A, 0x03, 0x0A, 0x01, 0x56, 0x10,
+		0x01, 0x18, 0x00, 0x22, 0x09, 0x0A, 0x03, 0x0A, 0x01, 0x55, 0x10, 0x01, 0x18, 0x00, 0x22, 0x09,
+		0x0A, 0x03, 0x0A, 0x01, 0x52, 0x10, 0x03, 0x18, 0x00, 0x22, 0x11, 0x0A, 0x03, 0x0A, 0x01, 0x46,
+		0x10, 0x03, 0x18, 0x00, 0x22, 0x06, 0x87, 0xE5, 0x69, 0x96, 0xE5, 0x69, 0x22, 0x09, 0x0A, 0x03,
+		0x0A, 0x01, 0x50, 0x10, 0x01, 0x18, 0x00, 0x22, 0x09, 0x0A, 0x03, 0x0A, 0x01, 0x4F, 0x10, 0x01,
+		0x18, 0x00, 0x22, 0x09, 0x0A, 0x03, 0x0A, 0x01, 0x4E, 0x10, 0x01, 0x18, 0x00, 0x22, 0x09, 0x0A,
+		0x03, 0x0A, 0x01, 0x4D, 0x10, 0x01, 0x18, 0x00, 0x22, 0x09, 0x0A, 0x03, 0x0A, 0x01, 0x4C, 0x10,
+		0x01, 0x18, 0x00, 0x22, 0x09, 0x0A, 0x03, 0x0A, 0x01, 0x4B, 0x10, 0x01, 0x18, 0x00, 0x22, 0x09,
+		0x0A, 0x03, 0x0A, 0x01, 0x4A, 0x10, 0x01, 0x18, 0x00, 0x22, 0x09, 0x0A, 0x03, 0x0A, 0x01, 0x49,
+		0x10, 0x01, 0x18, 0x00, 0x22, 0x09, 0x0A, 0x03, 0x0A, 0x01, 0x48, 0x10, 0x01, 0x18, 0x00, 0x22,
+		0x09, 0x0A, 0x03, 0x0A, 0x01, 0x47, 0x10, 0x01, 0x18, 0x00, 0x22, 0x09, 0x0A, 0x03, 0x0A, 0x01,
+		0x45, 0x10, 0x01, 0x18, 0x00, 0x22, 0x09, 0x0A, 0x03, 0x0A, 0x01, 0x44, 0x10, 0x01, 0x18, 0x00,
+		0x22, 0x09, 0x0A, 0x03, 0x0A, 0x01, 0x43, 0x10, 0x01, 0x18, 0x00, 0x22, 0x09, 0x0A, 0x03, 0x0A,
+		0x01, 0x42, 0x10, 0x01, 0x18, 0x00, 0x22, 0x09, 0x0A, 0x03, 0x0A, 0x01, 0x41, 0x10, 0x01, 0x18,
+		0x00, 0x22, 0x09, 0x0A, 0x03, 0x0A, 0x01, 0x40, 0x10, 0x01, 0x18, 0x00, 0x22, 0x09, 0x0A, 0x03,
+		0x0A, 0x01, 0x3F, 0x10, 0x01, 0x18, 0x00, 0x22, 0x09, 0x0A, 0x03, 0x0A, 0x01, 0x3E, 0x10, 0x01,
+		0x18, 0x00, 0x22, 0x09, 0x0A, 0x03, 0x0A, 0x01, 0x3D, 0x10, 0x01, 0x18, 0x00, 0x22, 0x09, 0x0A,
+		0x03, 0x0A, 0x01, 0x3C, 0x10, 0x01, 0x18, 0x00, 0x22, 0x0A, 0x0A, 0x04, 0x0A, 0x02, 0x04, 0x16,
+		0x10, 0x01, 0x18, 0x00, 0x22, 0x0A, 0x0A, 0x04, 0x0A, 0x02, 0x04, 0x15, 0x10, 0x01, 0x18, 0x00,
+		0x22, 0x09, 0x0A, 0x03, 0x0A, 0x01, 0x51, 0x10, 0x03, 0x18, 0x00, 0x2A, 0x96, 0x01, 0xD9, 0xE4,
+		0x69, 0x92, 0xE5, 0x69, 0xED, 0xE4, 0x69, 0xC6, 0xE4, 0x69, 0xDC, 0xE4, 0x69, 0xCE, 0xE4, 0x69,
+		0xC8, 0xE4, 0x69, 0xCD, 0xE4, 0x69, 0xDB, 0xE4, 0x69, 0xD0, 0xE4, 0x69, 0xCA, 0xE4, 0x69, 0xC9,
+		0xE4, 0x69, 0xE3, 0xE4, 0x69, 0xD3, 0xE4, 0x69, 0xCC, 0xE4, 0x69, 0x87, 0xD9, 0x69, 0x89, 0xD9,
+		0x69, 0x8A, 0xD9, 0x69, 0x8B, 0xD9, 0x69, 0x88, 0xD9, 0x69, 0xC6, 0xD7, 0x69, 0xC7, 0xD7, 0x69,
+		0x8C, 0xD9, 0x69, 0x8D, 0xD9, 0x69, 0x8E, 0xD9, 0x69, 0x8F, 0xD9, 0x69, 0x90, 0xD9, 0x69, 0x91,
+		0xD9, 0x69, 0x92, 0xD9, 0x69, 0x93, 0xD9, 0x69, 0x94, 0xD9, 0x69, 0x95, 0xD9, 0x69, 0x96, 0xD9,
+		0x69, 0x97, 0xD9, 0x69, 0x98, 0xD9, 0x69, 0x99, 0xD9, 0x69, 0x9A, 0xD9, 0x69, 0xC5, 0xD7, 0x69,
+		0x9B, 0xD9, 0x69, 0x9C, 0xD9, 0x69, 0x9D, 0xD9, 0x69, 0x9E, 0xD9, 0x69, 0x82, 0xE5, 0x69, 0xE1,
+		0xE4, 0x69, 0x8B, 0xE5, 0x69, 0xDE, 0xE4, 0x69, 0x87, 0xE5, 0x69, 0x96, 0xE5, 0x69, 0xEF, 0xE4,
+		0x69, 0xEB, 0xE4, 0x69, 0x0A, 0x24, 0x38, 0x45, 0x34, 0x31, 0x44, 0x38, 0x37, 0x37, 0x2D, 0x41,
+		0x44, 0x34, 0x37, 0x2D, 0x34, 0x31, 0x46, 0x39, 0x2D, 0x39, 0x39, 0x41, 0x33, 0x2D, 0x35, 0x31,
+		0x43, 0x44, 0x44, 0x45, 0x39, 0x39, 0x38, 0x45, 0x43, 0x42, 0x1A, 0x04, 0x08, 0x87, 0xD9, 0x69,
+		0x22, 0x7E, 0x0A, 0x08, 0x08, 0x01, 0x12, 0x04, 0x08, 0xED, 0xE4, 0x69, 0x12, 0x04, 0x08, 0x92,
+		0xE5, 0x69, 0x1A, 0x0D, 0x0A, 0x08, 0x08, 0x00, 0x12, 0x04, 0x08, 0xD9, 0xE4, 0x69, 0x10, 0x80,
+		0x02, 0x22, 0x04, 0x08, 0xC6, 0xE4, 0x69, 0x2A, 0x04, 0x08, 0xDC, 0xE4, 0x69, 0x32, 0x04, 0x08,
+		0xCE, 0xE4, 0x69, 0x38, 0x01, 0x40, 0x00, 0x4A, 0x06, 0x0A, 0x04, 0x08, 0x00, 0x10, 0x00, 0x52,
+		0x00, 0x5A, 0x04, 0x08, 0xC9, 0xE4, 0x69, 0x62, 0x04, 0x08, 0xC8, 0xE4, 0x69, 0x70, 0x04, 0x82,
+		0x01, 0x04, 0x08, 0xE3, 0xE4, 0x69, 0x8A, 0x01, 0x04, 0x08, 0xCD, 0xE4, 0x69, 0x92, 0x01, 0x04,
+		0x08, 0xCA, 0xE4, 0x69, 0x9A, 0x01, 0x04, 0x08, 0xDB, 0xE4, 0x69, 0xA2, 0x01, 0x04, 0x08, 0xD0,
+		0xE4, 0x69, 0xAA, 0x01, 0x04, 0x08, 0xD3, 0xE4, 0x69, 0xB2, 0x01, 0x04, 0x08, 0xCC, 0xE4, 0x69,
+		0x30, 0x05, 0x38, 0x04, 0x42, 0x07, 0x54, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x31, 0x48, 0x01, 0x50,
+		0x01, 0x68, 0x00, 0x81, 0x01, 0x00, 0x00, 0x00, 0x00, 0x10, 0xEE, 0x33, 0x40, 0x89, 0x01, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x80, 0x58, 0x40, 0x92, 0x01, 0x04, 0x08, 0x88, 0xD9, 0x69, 0x9A, 0x01,
+		0x04, 0x08, 0x89, 0xD9, 0x69, 0xA2, 0x01, 0x04, 0x08, 0x8A, 0xD9, 0x69, 0xAA, 0x01, 0x04, 0x08,
+		0x8B, 0xD9, 0x69, 0xB0, 0x01, 0x01, 0xC2, 0x01, 0x04, 0x08, 0xC7, 0xD7, 0x69, 0xCA, 0x01, 0x04,
+		0x08, 0xC6, 0xD7, 0x69, 0xD2, 0x01, 0x04, 0x08, 0xC6, 0xD7, 0x69, 0xDA, 0x01, 0x04, 0x08, 0xC6,
+		0xD7, 0x69, 0xE8, 0x01, 0x01, 0xF2, 0x01, 0x04, 0x08, 0xC5, 0xD7, 0x69, 0xF8, 0x01, 0x00, 0x80,
+		0x02, 0x01, 0x89, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x02, 0x04, 0x08,
+		0xEF, 0xE4, 0x69, 0x9A, 0x02, 0x04, 0x08, 0xEB, 0xE4, 0x69, 0xA2, 0x02, 0x04, 0x08, 0x9B, 0xD9,
+		0x69, 0xBA, 0x02, 0x18, 0x10, 0x91, 0x83, 0xE1, 0xBE, 0x07, 0x18, 0xAD, 0x8F, 0x85, 0xCA, 0x0F,
+		0x20, 0x99, 0xC7, 0xC6, 0xEA, 0x0C, 0x28, 0xDE, 0xB3, 0xBA, 0xDC, 0x0C, 0xE2, 0x02, 0x02, 0x08,
+		0x00, 0xEA, 0x02, 0x06, 0x0A, 0x04, 0x08, 0x82, 0xE5, 0x69, 0xF2, 0x02, 0x04, 0x08, 0xE1, 0xE4,
+		0x69, 0xFA, 0x02, 0x1E, 0x0A, 0x18, 0x10, 0x93, 0x83, 0xE1, 0xBE, 0x07, 0x18, 0xAD, 0x8F, 0x85,
+		0xCA, 0x0F, 0x20, 0x99, 0xC7, 0xC6, 0xEA, 0x0C, 0x28, 0xDE, 0xB3, 0xBA, 0xDC, 0x0C, 0x12, 0x02,
+		0x10, 0x00, 0x82, 0x03, 0x04, 0x08, 0x9F, 0xD9, 0x69, 0x8A, 0x03, 0x04, 0x08, 0x8B, 0xE5, 0x69,
+		0xE2, 0x03, 0x04, 0x08, 0x8C, 0xD9, 0x69, 0xEA, 0x03, 0x04, 0x08, 0x8D, 0xD9, 0x69, 0xF2, 0x03,
+		0x04, 0x08, 0x8E, 0xD9, 0x69, 0xFA, 0x03, 0x04, 0x08, 0x8F, 0xD9, 0x69, 0x82, 0x04, 0x04, 0x08,
+		0x90, 0xD9, 0x69, 0x8A, 0x04, 0x04, 0x08, 0xC6, 0xD7, 0x69, 0x92, 0x04, 0x04, 0x08, 0xC6, 0xD7,
+		0x69, 0x9A, 0x04, 0x04, 0x08, 0xC6, 0xD7, 0x69, 0xA2, 0x04, 0x04, 0x08, 0xC6, 0xD7, 0x69, 0xAA,
+		0x04, 0x04, 0x08, 0xC6, 0xD7, 0x69, 0xB2, 0x04, 0x7A, 0x0A, 0x16, 0x08, 0x92, 0x83, 0xE1, 0xBE,
+		0xD7, 0xF5, 0xD1, 0xA0, 0xF9, 0x01, 0x10, 0x99, 0xC7, 0xC6, 0xEA, 0xEC, 0xBB, 0xA6, 0xC7, 0xCB,
+		0x01, 0x12, 0x60, 0x0A, 0x16, 0x08, 0x92, 0x83, 0xE1, 0xBE, 0xD7, 0xF5, 0xD1, 0xA0, 0xF9, 0x01,
+		0x10, 0x99, 0xC7, 0xC6, 0xEA, 0xEC, 0xBB, 0xA6, 0xC7, 0xCB, 0x01, 0x12, 0x22, 0x0A, 0x16, 0x08,
+		0x99, 0x83, 0xE1, 0xBE, 0xD7, 0xF5, 0xD1, 0xA0, 0xF9, 0x01, 0x10, 0x99, 0xC7, 0xC6, 0xEA, 0xEC,
+		0xBB, 0xA6, 0xC7, 0xCB, 0x01, 0x18, 0x00, 0x30, 0x00, 0x42, 0x04, 0x08, 0x87, 0xE5, 0x69, 0x1A,
+		0x22, 0x0A, 0x16, 0x08, 0x92, 0x83, 0xE1, 0xBE, 0xD7, 0xF5, 0xD1, 0xA0, 0xF9, 0x01, 0x10, 0x99,
+		0xC7, 0xC6, 0xEA, 0xEC, 0xBB, 0xA6, 0xC7, 0xCB, 0x01, 0x18, 0x01, 0x30, 0x00, 0x42, 0x04, 0x08,
+		0x96, 0xE5, 0x69, 0xBA, 0x04, 0x04, 0x08, 0x91, 0xD9, 0x69, 0xC2, 0x04, 0x04, 0x08, 0x92, 0xD9,
+		0x69, 0xCA, 0x04, 0x04, 0x08, 0x93, 0xD9, 0x69, 0xD2, 0x04, 0x04, 0x08, 0x94, 0xD9, 0x69, 0xDA,
+		0x04, 0x04, 0x08, 0x95, 0xD9, 0x69, 0xE2, 0x04, 0x04, 0x08, 0x96, 0xD9, 0x69, 0xEA, 0x04, 0x04,
+		0x08, 0x97, 0xD9, 0x69, 0xF2, 0x04, 0x04, 0x08, 0x98, 0xD9, 0x69, 0xFA, 0x04, 0x04, 0x08, 0x99,
+		0xD9, 0x69, 0x82, 0x05, 0x04, 0x08, 0x9A, 0xD9, 0x69, 0x8A, 0x05, 0x5F, 0x0A, 0x04, 0x08, 0x00,
+		0x10, 0x00, 0x12, 0x57, 0x0A, 0x16, 0x08, 0x96, 0x83, 0xE1, 0xBE, 0xD7, 0xF5, 0xD1, 0xA0, 0xF9,
+		0x01, 0x10, 0x99, 0xC7, 0xC6, 0xEA, 0xEC, 0xBB, 0xA6, 0xC7, 0xCB, 0x01, 0x1A, 0x08, 0x0A, 0x04,
+		0x08, 0x01, 0x10, 0x00, 0x32, 0x00, 0x30, 0x00, 0x3A, 0x04, 0x10, 0x00, 0x18, 0x00, 0x42, 0x04,
+		0x10, 0x01, 0x18, 0x00, 0x4A, 0x04, 0x10, 0x03, 0x18, 0x00, 0x52, 0x04, 0x10, 0x02, 0x18, 0x00,
+		0x5A, 0x04, 0x10, 0x04, 0x18, 0x00, 0x62, 0x04, 0x10, 0x05, 0x18, 0x00, 0x6A, 0x04, 0x10, 0x06,
+		0x18, 0x00, 0x70, 0x08, 0x82, 0x01, 0x04, 0x10, 0x07, 0x18, 0x00, 0x92, 0x05, 0x1E, 0x0A, 0x18,
+		0x10, 0x98, 0x83, 0xE1, 0xBE, 0x07, 0x18, 0xAD, 0x8F, 0x85, 0xCA, 0x0F, 0x20, 0x99, 0xC7, 0xC6,
+		0xEA, 0x0C, 0x28, 0xDE, 0xB3, 0xBA, 0xDC, 0x0C, 0x12, 0x02, 0x10, 0x00, 0xA2, 0x05, 0x18, 0x0A,
+		0x16, 0x08, 0xB1, 0x83, 0xE1, 0xBE, 0xD7, 0xF5, 0xD1, 0xA0, 0xF9, 0x01, 0x10, 0x99, 0xC7, 0xC6,
+		0xEA, 0xEC, 0xBB, 0xA6, 0xC7, 0xCB, 0x01, 0xB2, 0x05, 0x04, 0x08, 0xDE, 0xE4, 0x69, 0xBA, 0x05,
+		0x04, 0x08, 0x9C, 0xD9, 0x69, 0xC2, 0x05, 0x04, 0x08, 0x9D, 0xD9, 0x69, 0xCA, 0x05, 0x04, 0x08,
+		0x9E, 0xD9, 0x69, 0xEA, 0x05, 0x18, 0x0A, 0x16, 0x08, 0x9A, 0x83, 0xE1, 0xBE, 0xD7, 0xF5, 0xD1,
+		0xA0, 0xF9, 0x01, 0x10, 0x99, 0xC7, 0xC6, 0xEA, 0xEC, 0xBB, 0xA6, 0xC7, 0xCB, 0x01, 0x10, 0x08,
+		0x82, 0xE5, 0x69, 0x12, 0x0A, 0x08, 0xA4, 0x1F, 0x12, 0x03, 0x01, 0x00, 0x05, 0x18, 0x1A, 0x0A,
+		0x18, 0x10, 0x94, 0x83, 0xE1, 0xBE, 0x07, 0x18, 0xAD, 0x8F, 0x85, 0xCA, 0x0F, 0x20, 0x99, 0xC7,
+		0xC6, 0xEA, 0x0C, 0x28, 0xDE, 0xB3, 0xBA, 0xDC, 0x0C, 0x11, 0x08, 0xE1, 0xE4, 0x69, 0x12, 0x0B,
+		0x08, 0xFB, 0x30, 0x12, 0x03, 0x01, 0x00, 0x05, 0x18, 0xF3, 0x01, 0x0A, 0x14, 0x08, 0x92, 0xD6,
+		0x8D, 0xE5, 0x91, 0xF3, 0xFB, 0x83, 0x4E, 0x10, 0xF9, 0xCB, 0xB4, 0x98, 0xE3, 0xB3, 0x9A, 0xBC,
+		0x03, 0x0A, 0x14, 0x08, 0xAC, 0xD8, 0xFB, 0xDD, 0x88, 0xE6, 0x87, 0xA6, 0x05, 0x10, 0xF0, 0xDE,
+		0x82, 0xBF, 0x95, 0xCF, 0xCC, 0xC9, 0x3B, 0x0A, 0x16, 0x08, 0x84, 0xD0, 0xF9, 0xE4, 0xF0, 0x89,
+		0xBB, 0xA2, 0xAA, 0x01, 0x10, 0x8B, 0xE8, 0xF9, 0xB8, 0xE5, 0xA7, 0xDB, 0xFD, 0xA1, 0x01, 0x0A,
+		0x16, 0x08, 0x89, 0xE1, 0x87, 0xF5, 0x93, 0x96, 0xAE, 0xBB, 0xDC, 0x01, 0x10, 0xD3, 0x81, 0xB4,
+		0xC5, 0xA6, 0xE8, 0x88, 0x99, 0xF6, 0x01, 0x10, 0x02, 0x10, 0x03, 0x10, 0x00, 0x10, 0x01, 0x18,
+		0x02, 0x18, 0x03, 0x18, 0x00, 0x18, 0x01, 0x22, 0x14, 0x08, 0xFD, 0xFB, 0xB9, 0xE6, 0x95, 0x82,
+		0xA9, 0x8A, 0x4B, 0x10, 0x8E, 0x81, 0x8C, 0xC7, 0xA8, 0xA4, 0x85, 0xD0, 0x11, 0x22, 0x15, 0x08,
+		0xE3, 0x8E, 0xB6, 0xA5, 0xED, 0xAA, 0xCE, 0x97, 0xFD, 0x01, 0x10, 0xAE, 0xC0, 0x95, 0xCD, 0xC6,
+		0xEC, 0xE2, 0x82, 0x4C, 0x22, 0x15, 0x08, 0xE2, 0xBB, 0xFE, 0xBF, 0xBC, 0x85, 0xAA, 0x9D, 0x6B,
+		0x10, 0x8C, 0xAC, 0x95, 0x86, 0xCC, 0x80, 0xAD, 0x9A, 0x89, 0x01, 0x22, 0x15, 0x08, 0xB3, 0xE3,
+		0xF3, 0xE8, 0xC0, 0xD4, 0xDB, 0xE8, 0x55, 0x10, 0xDE, 0xB7, 0xF7, 0xC6, 0xC0, 0xEE, 0xFD, 0xB2,
+		0xC4, 0x01, 0x22, 0x16, 0x08, 0xE0, 0xAA, 0xEC, 0x89, 0xCB, 0xDA, 0x9F, 0xAA, 0xBD, 0x01, 0x10,
+		0xA4, 0xDF, 0xD9, 0xA9, 0x86, 0xA0, 0xA8, 0xCF, 0xCA, 0x01, 0x28, 0x02, 0x28, 0x03, 0x28, 0x00,
+		0x28, 0x04, 0x28, 0x01, 0x30, 0x02, 0x30, 0x04, 0x30, 0x00, 0x30, 0x01, 0x30, 0x03, 0x10, 0x08,
+		0x8B, 0xE5, 0x69, 0x12, 0x0A, 0x08, 0xA1, 0x31, 0x12, 0x03, 0x01, 0x00, 0x05, 0x18, 0x06, 0x08,
+		0x02, 0x10, 0x04, 0x18, 0x05, 0x15, 0x08, 0xDE, 0xE4, 0x69, 0x12, 0x0F, 0x08, 0xE4, 0x31, 0x12,
+		0x03, 0x01, 0x00, 0x05, 0x18, 0x06, 0x2A, 0x03, 0xF2, 0xE4, 0x69, 0x0A, 0x04, 0x08, 0xF2, 0xE4,
+		0x69, 0x2B, 0x08, 0xF2, 0xE4, 0x69, 0x12, 0x25, 0x08, 0xE5, 0x31, 0x12, 0x03, 0x01, 0x00, 0x05,
+		0x18, 0x5E, 0x22, 0x09, 0x0A, 0x03, 0x0A, 0x01, 0x11, 0x10, 0x01, 0x18, 0x00, 0x22, 0x09, 0x0A,
+		0x03, 0x0A, 0x01, 0x12, 0x10, 0x01, 0x18, 0x00, 0x2A, 0x03, 0x86, 0xE5, 0x69, 0x0A, 0x16, 0x08,
+		0x96, 0x83, 0xE1, 0xBE, 0xD7, 0xF5, 0xD1, 0xA0, 0xF9, 0x01, 0x10, 0x99, 0xC7, 0xC6, 0xEA, 0xEC,
+		0xBB, 0xA6, 0xC7, 0xCB, 0x01, 0x1A, 0x08, 0x0A, 0x04, 0x08, 0x01, 0x10, 0x00, 0x32, 0x00, 0x30,
+		0x00, 0x3A, 0x04, 0x10, 0x00, 0x18, 0x00, 0x42, 0x04, 0x10, 0x01, 0x18, 0x00, 0x4A, 0x04, 0x10,
+		0x03, 0x18, 0x00, 0x52, 0x04, 0x10, 0x02, 0x18, 0x00, 0x5A, 0x04, 0x10, 0x04, 0x18, 0x00, 0x62,
+		0x04, 0x10, 0x05, 0x18, 0x00, 0x6A, 0x04, 0x10, 0x06, 0x18, 0x00, 0x70, 0x08, 0x82, 0x01, 0x04,
+		0x10, 0x07, 0x18, 0x00, 0x92, 0x01, 0x04, 0x08, 0x86, 0xE5, 0x69, 0x10, 0x08, 0x86, 0xE5, 0x69,
+		0x12, 0x0A, 0x08, 0xEF, 0x31, 0x12, 0x03, 0x01, 0x00, 0x05, 0x18, 0x08, 0x0A, 0x04, 0x08, 0x01,
+		0x10, 0x00, 0x32, 0x00, 0x10, 0x08, 0x87, 0xE5, 0x69, 0x12, 0x0A, 0x08, 0xCC, 0x30, 0x12, 0x03,
+		0x01, 0x00, 0x05, 0x18, 0x08, 0x08, 0x00, 0x10, 0x00, 0x20, 0x00, 0x28, 0x00, 0x10, 0x08, 0x96,
+		0xE5, 0x69, 0x12, 0x0A, 0x08, 0xCC, 0x30, 0x12, 0x03, 0x01, 0x00, 0x05, 0x18, 0x08, 0x08, 0x00,
+		0x10, 0x00, 0x20, 0x00, 0x28, 0x00, 0x10, 0x08, 0xEF, 0xE4, 0x69, 0x12, 0x0A, 0x08, 0xBC, 0x30,
+		0x12, 0x03, 0x01, 0x00, 0x05, 0x18, 0x1C, 0x0A, 0x18, 0x10, 0x99, 0x83, 0xE1, 0xBE, 0x07, 0x18,
+		0xAD, 0x8F, 0x85, 0xCA, 0x0F, 0x20, 0x99, 0xC7, 0xC6, 0xEA, 0x0C, 0x28, 0xDE, 0xB3, 0xBA, 0xDC,
+		0x0C, 0x18, 0x00, 0x10, 0x08, 0xEB, 0xE4, 0x69, 0x12, 0x0A, 0x08, 0xBC, 0x30, 0x12, 0x03, 0x01,
+		0x00, 0x05, 0x18, 0x1C, 0x0A, 0x18, 0x10, 0x92, 0x83, 0xE1, 0xBE, 0x07, 0x18, 0xAD, 0x8F, 0x85,
+		0xCA, 0x0F, 0x20, 0x99, 0xC7, 0xC6, 0xEA, 0x0C, 0x28, 0xDE, 0xB3, 0xBA, 0xDC, 0x0C, 0x18, 0x00,
+		0x46, 0x08, 0xE6, 0xE4, 0x69, 0x12, 0x40, 0x08, 0xAC, 0x31, 0x12, 0x03, 0x03, 0x02, 0x0A, 0x18,
+		0xC0, 0x02, 0x2A, 0x33, 0x85, 0xE9, 0x69, 0xF0, 0xE4, 0x69, 0x84, 0xE5, 0x69, 0x86, 0xE9, 0x69,
+		0x87, 0xE9, 0x69, 0x8A, 0xE9, 0x69, 0x8C, 0xE9, 0x69, 0x8D, 0xE9, 0x69, 0x8E, 0xE9, 0x69, 0x8F,
+		0xE9, 0x69, 0x88, 0xE9, 0x69, 0x90, 0xE9, 0x69, 0x91, 0xEC, 0x69, 0x8B, 0xE9, 0x69, 0x89, 0xE9,
+		0x69, 0xEE, 0xE4, 0x69, 0xFE, 0xE4, 0x69, 0x0A, 0x04, 0x08, 0xF4, 0xE4, 0x69, 0x12, 0x7E, 0x0A,
+		0x08, 0x08, 0x01, 0x12, 0x04, 0x08, 0x84, 0xE5, 0x69, 0x12, 0x04, 0x08, 0xF0, 0xE4, 0x69, 0x1A,
+		0x0D, 0x0A, 0x08, 0x08, 0x00, 0x12, 0x04, 0x08, 0x85, 0xE9, 0x69, 0x10, 0x80, 0x02, 0x22, 0x04,
+		0x08, 0x86, 0xE9, 0x69, 0x2A, 0x04, 0x08, 0x87, 0xE9, 0x69, 0x32, 0x04, 0x08, 0x8A, 0xE9, 0x69,
+		0x38, 0x01, 0x40, 0x00, 0x4A, 0x06, 0x0A, 0x04, 0x08, 0x00, 0x10, 0x00, 0x52, 0x00, 0x5A, 0x04,
+		0x08, 0x90, 0xE9, 0x69, 0x62, 0x04, 0x08, 0x8C, 0xE9, 0x69, 0x70, 0x04, 0x82, 0x01, 0x04, 0x08,
+		0x91, 0xEC, 0x69, 0x8A, 0x01, 0x04, 0x08, 0x8D, 0xE9, 0x69, 0x92, 0x01, 0x04, 0x08, 0x88, 0xE9,
+		0x69, 0x9A, 0x01, 0x04, 0x08, 0x8E, 0xE9, 0x69, 0xA2, 0x01, 0x04, 0x08, 0x8F, 0xE9, 0x69, 0xAA,
+		0x01, 0x04, 0x08, 0x8B, 0xE9, 0x69, 0xB2, 0x01, 0x04, 0x08, 0x89, 0xE9, 0x69, 0x1A, 0x04, 0x08,
+		0xEE, 0xE4, 0x69, 0x22, 0x16, 0x08, 0x97, 0x83, 0xE1, 0xBE, 0xD7, 0xF5, 0xD1, 0xA0, 0xF9, 0x01,
+		0x10, 0x99, 0xC7, 0xC6, 0xEA, 0xEC, 0xBB, 0xA6, 0xC7, 0xCB, 0x01, 0x2A, 0x04, 0x08, 0xFE, 0xE4,
+		0x69, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x40, 0xD1, 0x01, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0xD1, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD1, 0x01,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD1, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0xD1, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD1, 0x01, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0xD9, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x01, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0xD9, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x01,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0xE0, 0x01, 0x00, 0xE0, 0x01, 0x00, 0xE0, 0x01, 0x00, 0xE0, 0x01, 0x00, 0xE0, 0x01,
+		0x00, 0xE0, 0x01, 0x00, 0xEA, 0x01, 0x00, 0x10, 0x08, 0xEE, 0xE4, 0x69, 0x12, 0x0A, 0x08, 0xFB,
+		0x30, 0x12, 0x03, 0x01, 0x00, 0x05, 0x18, 0x00, 0x10, 0x08, 0xFE, 0xE4, 0x69, 0x12, 0x0A, 0x08,
+		0xAD, 0x31, 0x12, 0x03, 0x03, 0x02, 0x0A, 0x18, 0x06, 0x0A, 0x04, 0x08, 0xF4, 0xE4, 0x69, 0x15,
+		0x08, 0xE8, 0xE4, 0x69, 0x12, 0x0F, 0x08, 0xAE, 0x31, 0x12, 0x03, 0x03, 0x02, 0x0A, 0x18, 0x0C,
+		0x2A, 0x03, 0xF1, 0xE4, 0x69, 0x0A, 0x04, 0x08, 0xF4, 0xE4, 0x69, 0x12, 0x04, 0x08, 0xF1, 0xE4,
+		0x69, 0x10, 0x08, 0xF1, 0xE4, 0x69, 0x12, 0x0A, 0x08, 0xFB, 0x30, 0x12, 0x03, 0x01, 0x00, 0x05,
+		0x18, 0x00, 0x15, 0x08, 0xF5, 0xED, 0x69, 0x12, 0x0F, 0x08, 0xD3, 0x0F, 0x12, 0x03, 0x01, 0x00,
+		0x05, 0x18, 0x14, 0x2A, 0x03, 0xF4, 0xE4, 0x69, 0x0A, 0x04, 0x08, 0xF4, 0xE4, 0x69, 0x10, 0x00,
+		0x1D, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x15, 0x08, 0xDC, 0xED,
+		0x69, 0x12, 0x0F, 0x08, 0xE6, 0x0F, 0x12, 0x03, 0x01, 0x00, 0x05, 0x18, 0x18, 0x2A, 0x03, 0xC6,
+		0xD7, 0x69, 0x0A, 0x0E, 0x1A, 0x04, 0x08, 0xC6, 0xD7, 0x69, 0x20, 0x01, 0x2A, 0x04, 0x08, 0x85,
+		0xE0, 0x69, 0x50, 0x01, 0x5A, 0x00, 0x62, 0x02, 0x08, 0x02, 0x1E, 0x08, 0xCC, 0xF2, 0x69, 0x12,
+		0x18, 0x08, 0x87, 0x56, 0x12, 0x03, 0x01, 0x00, 0x05, 0x18, 0x28, 0x2A, 0x0C, 0x96, 0xE6, 0x3D,
+		0xAF, 0xDB, 0x0B, 0x88, 0xCB, 0x66, 0xB0, 0xDB, 0x0B, 0x0A, 0x08, 0x08, 0x0E, 0x12, 0x04, 0x08,
+		0x96, 0xE6, 0x3D, 0x0A, 0x08, 0x08, 0x09, 0x12, 0x04, 0x08, 0xAF, 0xDB, 0x0B, 0x0A, 0x08, 0x08,
+		0x17, 0x12, 0x04, 0x08, 0x88, 0xCB, 0x66, 0x0A, 0x08, 0x08, 0x08, 0x12, 0x04, 0x08, 0xB0, 0xDB,
+		0x0B, 0x18, 0x08, 0xC4, 0xF2, 0x69, 0x12, 0x12, 0x08, 0xA3, 0x4F, 0x12, 0x03, 0x01, 0x00, 0x05,
+		0x18, 0x0C, 0x2A, 0x06, 0xC5, 0xF2, 0x69, 0xC6, 0xF2, 0x69, 0x0A, 0x04, 0x08, 0xC5, 0xF2, 0x69,
+		0x12, 0x04, 0x08, 0xC6, 0xF2, 0x69, 0x11, 0x08, 0xC5, 0xF2, 0x69, 0x12, 0x0B, 0x08, 0x93, 0x4F,
+		0x12, 0x03, 0x01, 0x00, 0x05, 0x18, 0x8B, 0x01, 0x08, 0x01, 0x10, 0x00, 0x18, 0x01, 0x20, 0x01,
+		0x2A, 0x7A, 0x0A, 0x76, 0x08, 0x01, 0x12, 0x42, 0x1A, 0x04, 0x08, 0x00, 0x10, 0x12, 0x20, 0x12,
+		0x2A, 0x04, 0x08, 0x00, 0x10, 0x12, 0x30, 0x01, 0x38, 0x05, 0x42, 0x12, 0x09, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4A, 0x12,
+		0x09, 0x00, 0x00, 0x00, 0xA0, 0x4E, 0x1E, 0x7E, 0x40, 0x11, 0x00, 0x00, 0x00, 0x90, 0x08, 0xC4,
+		0x86, 0x40, 0x50, 0x01, 0x58, 0x00, 0x60, 0x00, 0x68, 0x00, 0x1A, 0x04, 0x08, 0x00, 0x10, 0x00,
+		0x22, 0x04, 0x08, 0x00, 0x10, 0x00, 0x50, 0x35, 0x58, 0x03, 0x6A, 0x15, 0x08, 0x88, 0x99, 0xA4,
+		0xF5, 0xF8, 0xA1, 0xF1, 0xA2, 0x6B, 0x10, 0xB3, 0xF5, 0xA8, 0xCE, 0x84, 0xDD, 0xE8, 0xA9, 0xC8,
+		0x01, 0x90, 0x01, 0x00, 0x98, 0x01, 0x00, 0xA2, 0x01, 0x00, 0x10, 0x00, 0x30, 0x12, 0x40, 0xF0,
+		0xA3, 0xB3, 0x0C, 0x45, 0x08, 0xC6, 0xF2, 0x69, 0x12, 0x3F, 0x08, 0x95, 0x4F, 0x12, 0x03, 0x01,
+		0x00, 0x05, 0x18, 0xE4, 0x01, 0x22, 0x07, 0x0A, 0x03, 0x0A, 0x01, 0x27, 0x18, 0x01, 0x22, 0x09,
+		0x0A, 0x03, 0x0A, 0x01, 0x20, 0x10, 0x01, 0x18, 0x01, 0x22, 0x07, 0x0A, 0x03, 0x0A, 0x01, 0x17,
+		0x18, 0x01, 0x2A, 0x15, 0xC7, 0xF2, 0x69, 0xC8, 0xF2, 0x69, 0xC9, 0xF2, 0x69, 0xCA, 0xF2, 0x69,
+		0xCB, 0xF2, 0x69, 0xA9, 0xE0, 0x69, 0xAA, 0xE0, 0x69, 0x12, 0x0A, 0x0D, 0xCD, 0xCC, 0xCC, 0x3E,
+		0x15, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x3A, 0x0A, 0x0D, 0x00, 0x00, 0x15, 0x44, 0x15, 0x9A,
+		0x99, 0x52, 0x44, 0x48, 0x00, 0x50, 0x00, 0x58, 0x00, 0x60, 0x01, 0x68, 0x00, 0x70, 0x00, 0x7D,
+		0x00, 0x00, 0xA0, 0x3F, 0x82, 0x01, 0x0A, 0x0D, 0x00, 0x00, 0x92, 0x44, 0x15, 0x00, 0x00, 0x68,
+		0x42, 0x8A, 0x01, 0x0A, 0x0D, 0x00, 0xE0, 0x80, 0x44, 0x15, 0x00, 0x20, 0x8C, 0x44, 0x92, 0x01,
+		0x25, 0x54, 0x50, 0x4D, 0x61, 0x63, 0x49, 0x6E, 0x73, 0x70, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x53,
+		0x65, 0x67, 0x6D, 0x65, 0x6E, 0x74, 0x49, 0x64, 0x65, 0x6E, 0x74, 0x69, 0x66, 0x69, 0x65, 0x72,
+		0x46, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x98, 0x01, 0x00, 0xA0, 0x01, 0x01, 0xAD, 0x01, 0x00, 0x00,
+		0x00, 0x3F, 0xB5, 0x01, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01, 0x01, 0xC0, 0x01, 0x00, 0xCA, 0x01,
+		0x0C, 0x0A, 0x04, 0x08, 0xC7, 0xF2, 0x69, 0x0A, 0x04, 0x08, 0xC8, 0xF2, 0x69, 0xD0, 0x01, 0x01,
+		0xD8, 0x01, 0x01, 0xE0, 0x01, 0x00, 0xF8, 0x01, 0x00, 0x88, 0x02, 0x00, 0x90, 0x02, 0x00, 0x9A,
+		0x02, 0x04, 0x08, 0xA9, 0xE0, 0x69, 0xB0, 0x02, 0x00, 0xB8, 0x02, 0x01, 0xC0, 0x02, 0x00, 0xCA,
+		0x02, 0x04, 0x08, 0xAA, 0xE0, 0x69, 0xD0, 0x02, 0x00, 0xE0, 0x02, 0x00, 0xED, 0x02, 0x00, 0x00,
+		0x00, 0x00, 0xF5, 0x02, 0x00, 0x00, 0x00, 0x00, 0xFA, 0x02, 0x12, 0x0A, 0x04, 0x08, 0xC9, 0xF2,
+		0x69, 0x0A, 0x04, 0x08, 0xCA, 0xF2, 0x69, 0x0A, 0x04, 0x08, 0xCB, 0xF2, 0x69, 0x10, 0x08, 0xC7,
+		0xF2, 0x69, 0x12, 0x0A, 0x08, 0xDB, 0x01, 0x12, 0x03, 0x01, 0x00, 0x05, 0x18, 0x00, 0x10, 0x08,
+		0xC8, 0xF2, 0x69, 0x12, 0x0A, 0x08, 0x94, 0x4F, 0x12, 0x03, 0x01, 0x00, 0x05, 0x18, 0x24, 0x08,
+		0x00, 0x12, 0x08, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x10, 0x00, 0x18, 0x00, 0x20, 0x00, 0x48,
+		0x01, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x58, 0x08, 0x62, 0x08, 0x08, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x0F, 0x10, 0x00, 0x10, 0x08, 0xC9, 0xF2, 0x69, 0x12, 0x0A, 0x08, 0xDB, 0x01, 0x12, 0x03, 0x01,
+		0x00, 0x05, 0x18, 0x00, 0x10, 0x08, 0xCA, 0xF2, 0x69, 0x12, 0x0A, 0x08, 0x94, 0x4F, 0x12, 0x03,
+		0x01, 0x00, 0x05, 0x18, 0x24, 0x08, 0x00, 0x12, 0x08, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x10,
+		0x00, 0x18, 0x00, 0x20, 0x00, 0x48, 0x01, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x58, 0x08, 0x62,
+		0x08, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x10, 0x00, 0x10, 0x08, 0xCB, 0xF2, 0x69, 0x12, 0x0A,
+		0x08, 0xF5, 0x17, 0x12, 0x03, 0x01, 0x00, 0x05, 0x18, 0x06, 0x12, 0x04, 0x08, 0xF4, 0xE4, 0x69,
+		0x10, 0x08, 0xC8, 0xE4, 0x69, 0x12, 0x0A, 0x08, 0xF5, 0x2E, 0x12, 0x03, 0x01, 0x00, 0x05, 0x18,
+		0x04, 0x08, 0x05, 0x10, 0x01, 0x10, 0x08, 0xC9, 0xE4, 0x69, 0x12, 0x0A, 0x08, 0xF5, 0x2E, 0x12,
+		0x03, 0x01, 0x00, 0x05, 0x18, 0x04, 0x08, 0x02, 0x10, 0x01, 0x10, 0x08, 0xCA, 0xE4, 0x69, 0x12,
+		0x0A, 0x08, 0xF5, 0x2E, 0x12, 0x03, 0x01, 0x00, 0x05, 0x18, 0x04, 0x08, 0x09, 0x10, 0x01, 0x10,
+		0x08, 0xCC, 0xE4, 0x69, 0x12, 0x0A, 0x08, 0xF5, 0x2E, 0x12, 0x03, 0x03, 0x02, 0x0A, 0x18, 0x23,
+		0x08, 0x02, 0x10, 0x03, 0x1A, 0x09, 0x08, 0x01, 0x10, 0x08, 0x32, 0x03, 0x08, 0x84, 0x02, 0x1A,
+		0x10, 0x08, 0x02, 0x10, 0x0C, 0x32, 0x0A, 0x08, 0x80, 0x02, 0x10, 0xFD, 0x01, 0x20, 0x00, 0x28,
+		0x00, 0x28, 0x01, 0x10, 0x08, 0xCD, 0xE4, 0x69, 0x12, 0x0A, 0x08, 0xF5, 0x2E, 0x12, 0x03, 0x01,
+		0x00, 0x05, 0x18, 0x04, 0x08, 0x08, 0x10, 0x01, 0x10, 0x08, 0xCE, 0xE4, 0x69, 0x12, 0x0A, 0x08,
+		0xF5, 0x2E, 0x12, 0x03, 0x01, 0x00, 0x05, 0x18, 0x04, 0x08, 0x03, 0x10, 0x01, 0x10, 0x08, 0xD0,
+		0xE4, 0x69, 0x12, 0x0A, 0x08, 0xF5, 0x2E, 0x12, 0x03, 0x01, 0x00, 0x05, 0x18, 0x04, 0x08, 0x0B,
+		0x10, 0x01, 0x10, 0x08, 0xD3, 0xE4, 0x69, 0x12, 0x0A, 0x08, 0xF5, 0x2E, 0x12, 0x03, 0x03, 0x02,
+		0x0A, 0x18, 0x06, 0x08, 0x0C, 0x10, 0x01, 0x28, 0x01, 0x10, 0x08, 0xDB, 0xE4, 0x69, 0x12, 0x0A,
+		0x08, 0xF5, 0x2E, 0x12, 0x03, 0x01, 0x00, 0x05, 0x18, 0x04, 0x08, 0x0A, 0x10, 0x01, 0x15, 0x08,
+		0xDC, 0xE4, 0x69, 0x12, 0x0F, 0x08, 0xF5, 0x2E, 0x12, 0x03, 0x01, 0x00, 0x05, 0x18, 0x10, 0x2A,
+		0x03, 0xDC, 0xED, 0x69, 0x08, 0x04, 0x10, 0x02, 0x1A, 0x0A, 0x08, 0x01, 0x10, 0x04, 0x22, 0x04,
+		0x08, 0xDC, 0xED, 0x69, 0x10, 0x08, 0xE3, 0xE4, 0x69, 0x12, 0x0A, 0x08, 0xF5, 0x2E, 0x12, 0x03,
+		0x01, 0x00, 0x05, 0x18, 0x04, 0x08, 0x07, 0x10, 0x01, 0x10, 0x08, 0x86, 0xE9, 0x69, 0x12, 0x0A,
+		0x08, 0xF5, 0x2E, 0x12, 0x03, 0x01, 0x00, 0x05, 0x18, 0x04, 0x08, 0x01, 0x10, 0x01, 0x10, 0x08,
+		0x87, 0xE9, 0x69, 0x12, 0x0A, 0x08, 0xF5, 0x2E, 0x12, 0x03, 0x01, 0x00, 0x05, 0x18, 0x04, 0x08,
+		0x04, 0x10, 0x01, 0x10, 0x08, 0x88, 0xE9, 0x69, 0x12, 0x0A, 0x08, 0xF5, 0x2E, 0x12, 0x03, 0x01,
+		0x00, 0x05, 0x18, 0x04, 0x08, 0x09, 0x10, 0x01, 0x10, 0x08, 0x89, 0xE9, 0x69, 0x12, 0x0A, 0x08,
+		0xF5, 0x2E, 0x12, 0x03, 0x03, 0x02, 0x0A, 0x18, 0x06, 0x08, 0x02, 0x10, 0x01, 0x28, 0x01, 0x10,
+		0x08, 0x8A, 0xE9, 0x69, 0x12, 0x0A, 0x08, 0xF5, 0x2E, 0x12, 0x03, 0x01, 0x00, 0x05, 0x18, 0x04,
+		0x08, 0x03, 0x10, 0x01, 0x10, 0x08, 0x8B, 0xE9, 0x69, 0x12, 0x0A, 0x08, 0xF5, 0x2E, 0x12, 0x03,
+		0x03, 0x02, 0x0A, 0x18, 0x06, 0x08, 0x0C, 0x10, 0x01, 0x28, 0x01, 0x10, 0x08, 0x8C, 0xE9, 0x69,
+		0x12, 0x0A, 0x08, 0xF5, 0x2E, 0x12, 0x03, 0x01, 0x00, 0x05, 0x18, 0x04, 0x08, 0x05, 0x10, 0x01,
+		0x10, 0x08, 0x8D, 0xE9, 0x69, 0x12, 0x0A, 0x08, 0xF5, 0x2E, 0x12, 0x03, 0x01, 0x00, 0x05, 0x18,
+		0x04, 0x08, 0x08, 0x10, 0x01, 0x10, 0x08, 0x8E, 0xE9, 0x69, 0x12, 0x0A, 0x08, 0xF5, 0x2E, 0x12,
+		0x03, 0x01, 0x00, 0x05, 0x18, 0x04, 0x08, 0x0A, 0x10, 0x01, 0x10, 0x08, 0x8F, 0xE9, 0x69, 0x12,
+		0x0A, 0x08, 0xF5, 0x2E, 0x12, 0x03, 0x01, 0x00, 0x05, 0x18, 0x04, 0x08, 0x0B, 0x10, 0x01, 0x10,
+		0x08, 0x90, 0xE9, 0x69, 0x12, 0x0A, 0x08, 0xF5, 0x2E, 0x12, 0x03, 0x01, 0x00, 0x05, 0x18, 0x04,
+		0x08, 0x02, 0x10, 0x01, 0x10, 0x08, 0x91, 0xEC, 0x69, 0x12, 0x0A, 0x08, 0xF5, 0x2E, 0x12, 0x03,
+		0x01, 0x00, 0x05, 0x18, 0x04, 0x08, 0x07, 0x10, 0x01, 0x10, 0x08, 0xC6, 0xE4, 0x69, 0x12, 0x0A,
+		0x08, 0xF5, 0x2E, 0x12, 0x03, 0x01, 0x00, 0x05, 0x18, 0x5C, 0x08, 0x01, 0x10, 0x09, 0x1A, 0x08,
+		0x08, 0x01, 0x10, 0x01, 0x1A, 0x02, 0x48, 0x31, 0x1A, 0x08, 0x08, 0x02, 0x10, 0x01, 0x1A, 0x02,
+		0x48, 0x32, 0x1A, 0x08, 0x08, 0x03, 0x10, 0x01, 0x1A, 0x02, 0x48, 0x33, 0x1A, 0x08, 0x08, 0x04,
+		0x10, 0x01, 0x1A, 0x02, 0x48, 0x34, 0x1A, 0x0A, 0x08, 0x05, 0x10, 0x01, 0x1A, 0x04, 0x72, 0x6F,
+		0x77, 0x31, 0x1A, 0x0A, 0x08, 0x06, 0x10, 0x01, 0x1A, 0x04, 0x72, 0x6F, 0x77, 0x32, 0x1A, 0x0A,
+		0x08, 0x07, 0x10, 0x01, 0x1A, 0x04, 0x72, 0x6F, 0x77, 0x33, 0x1A, 0x0A, 0x08, 0x08, 0x10, 0x01,
+		0x1A, 0x04, 0x72, 0x6F, 0x77, 0x34, 0x10, 0x08, 0xF0, 0xE4, 0x69, 0x12, 0x0A, 0x08, 0xF6, 0x2E,
+		0x12, 0x03, 0x01, 0x00, 0x05, 0x18, 0x02, 0x08, 0x01, 0x10, 0x08, 0x84, 0xE5, 0x69, 0x12, 0x0A,
+		0x08, 0xF6, 0x2E, 0x12, 0x03, 0x01, 0x00, 0x05, 0x18, 0x02, 0x08, 0x01, 0x10, 0x08, 0x92, 0xE5,
+		0x69, 0x12, 0x0A, 0x08, 0xF6, 0x2E, 0x12, 0x03, 0x01, 0x00, 0x05, 0x18, 0x36, 0x08, 0x01, 0x12,
+		0x0B, 0x08, 0x00, 0x15, 0xA8, 0xC5, 0xF0, 0x42, 0x18, 0x00, 0x20, 0x05, 0x12, 0x0B, 0x08, 0x01,
+		0x15, 0xA8, 0xC5, 0xF0, 0x42, 0x18, 0x00, 0x20, 0x05, 0x12, 0x0B, 0x08, 0x02, 0x15, 0xA8, 0xC5,
+		0xF0, 0x42, 0x18, 0x00, 0x20, 0x05, 0x12, 0x0B, 0x08, 0x03, 0x15, 0xA8, 0xC5, 0xF0, 0x42, 0x18,
+		0x00, 0x20, 0x05, 0x10, 0x08, 0xED, 0xE4, 0x69, 0x12, 0x0A, 0x08, 0xF6, 0x2E, 0x12, 0x03, 0x01,
+		0x00, 0x05, 0x18, 0x43, 0x08, 0x01, 0x12, 0x0B, 0x08, 0x00, 0x15, 0x0A, 0xD7, 0xB5, 0x41, 0x18,
+		0x00, 0x20, 0x04, 0x12, 0x0B, 0x08, 0x01, 0x15, 0x0A, 0xD7, 0xB5, 0x41, 0x18, 0x00, 0x20, 0x04,
+		0x12, 0x0B, 0x08, 0x02, 0x15, 0x0A, 0xD7, 0xB5, 0x41, 0x18, 0x00, 0x20, 0x04, 0x12, 0x0B, 0x08,
+		0x03, 0x15, 0x0A, 0xD7, 0xB5, 0x41, 0x18, 0x00, 0x20, 0x04, 0x12, 0x0B, 0x08, 0x04, 0x15, 0x0A,
+		0xD7, 0xB5, 0x41, 0x18, 0x00, 0x20, 0x04, 0x19, 0x08, 0x85, 0xE9, 0x69, 0x12, 0x13, 0x08, 0xF2,
+		0x2E, 0x12, 0x03, 0x01, 0x00, 0x05, 0x18, 0x0C, 0x22, 0x07, 0x0A, 0x03, 0x0A, 0x01, 0x07, 0x18,
+		0x00, 0x08, 0x00, 0x10, 0x00, 0x18, 0x00, 0x20, 0x00, 0x30, 0x05, 0x38, 0x01, 0x1A, 0x08, 0xD9,
+		0xE4, 0x69, 0x12, 0x14, 0x08, 0xF2, 0x2E, 0x12, 0x03, 0x01, 0x00, 0x05, 0x18, 0xCB, 0x2F, 0x22,
+		0x07, 0x0A, 0x03, 0x0A, 0x01, 0x07, 0x18, 0x00, 0x08, 0x00, 0x10, 0x00, 0x18, 0x00, 0x20, 0x05,
+		0x2A, 0xAC, 0x09, 0x08, 0x00, 0x10, 0x04, 0x1A, 0x30, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFE, 0x03, 0x00, 0x00, 0x0C, 0x00,
+		0x18, 0x00, 0x24, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x28, 0x05, 0x32, 0x70, 0x05, 0x03,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x10, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00,
+		0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x03, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x48, 0x10, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00,
+		0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x10,
+		0x02, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00,
+		0x00, 0x00, 0x05, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x10, 0x02, 0x00, 0x04, 0x00,
+		0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x3A, 0xFE,
+		0x03, 0x00, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x54, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2A,
+		0xC1, 0x09, 0x08, 0x01, 0x10, 0x04, 0x1A, 0x30, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFE, 0x03, 0x00, 0x00, 0x0C, 0x00, 0x18,
+		0x00, 0x24, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x28, 0x05, 0x32, 0x84, 0x01, 0x05, 0x03,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x02, 0x00, 0x05, 0x00, 0x00, 0x00, 0x05, 0x00,
+		0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x30,
+		0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x40, 0x30, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x01, 0x30, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x40, 0x30, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x05, 0x02,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x30, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x30, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00,
+		0x00, 0x00, 0x3A, 0xFE, 0x03, 0x00, 0x00, 0x18, 0x00, 0x3C, 0x00, 0x60, 0x00, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0x2A, 0xC1, 0x09, 0x08, 0x02, 0x10, 0x04, 0x1A, 0x30, 0x04, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFE, 0x03, 0x00,
+		0x00, 0x0C, 0x00, 0x18, 0x00, 0x24, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x28, 0x05, 0x32,
+		0x84, 0x01, 0x05, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x02, 0x00, 0x06, 0x00,
+		0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x01, 0x30, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x40, 0x30, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x05, 0x02,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x30, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x30, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00,
+		0x00, 0x00, 0x05, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x30, 0x00, 0x00, 0x03, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x30, 0x01, 0x00,
+		0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x3A, 0xFE, 0x03, 0x00, 0x00, 0x18, 0x00, 0x3C, 0x00, 0x60,
+		0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2A, 0xC1, 0x09, 0x08, 0x03, 0x10, 0x04, 0x1A, 0x30,
+		0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x22, 0xFE, 0x03, 0x00, 0x00, 0x0C, 0x00, 0x18, 0x00, 0x24, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0x28, 0x05, 0x32, 0x84, 0x01, 0x05, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10,
+		0x02, 0x00, 0x07, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x02,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x30, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x30, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00,
+		0x00, 0x00, 0x05, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x30, 0x00, 0x00, 0x02, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x30, 0x01, 0x00,
+		0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x30,
+		0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x40, 0x30, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x3A, 0xFE, 0x03, 0x00, 0x00, 0x18,
+		0x00, 0x3C, 0x00, 0x60, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2A, 0xC1, 0x09, 0x08, 0x04,
+		0x10, 0x04, 0x1A, 0x30, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x22, 0xFE, 0x03, 0x00, 0x00, 0x0C, 0x00, 0x18, 0x00, 0x24, 0x00, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x28, 0x05, 0x32, 0x84, 0x01, 0x05, 0x03, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x08, 0x10, 0x02, 0x00, 0x08, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00,
+		0x00, 0x00, 0x05, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x30, 0x00, 0x00, 0x01, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x30, 0x01, 0x00,
+		0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x30,
+		0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x40, 0x30, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x01, 0x30, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x40, 0x30, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x3A, 0xFE,
+		0x03, 0x00, 0x00, 0x18, 0x00, 0x3C, 0x00, 0x60, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30,
+		0x05, 0x38, 0x01, 0x00, 0xD6, 0x45, 0x00, 0xB2, 0xBA, 0x01, 0xF0, 0xAA, 0x20, 0x08, 0x02, 0x12,
+		0x1C, 0x08, 0xFE, 0x55, 0x12, 0x03, 0x01, 0x00, 0x05, 0x18, 0x8A, 0xB8, 0x01, 0x22, 0x09, 0x0A,
+		0x03, 0x0A, 0x01, 0x0A, 0x10, 0x01, 0x18, 0x01, 0x2A, 0x03, 0xCC, 0xF2, 0x69, 0x08, 0xCC, 0xF2,
+		0x69, 0x12, 0x28, 0x12, 0x24, 0x45, 0x45, 0x42, 0x39, 0x46, 0x45, 0x42, 0x33, 0x2D, 0x38, 0x37,
+		0x44, 0x31, 0x2D, 0x34, 0x39, 0x44, 0x33, 0x2D, 0x41, 0x44, 0x42, 0x38, 0x2D, 0x38, 0x36, 0x44,
+		0x42, 0x43, 0x43, 0x30, 0x43, 0x46, 0x41, 0x37, 0x31, 0x18, 0x00, 0x1A, 0x2F, 0x08, 0xED, 0xE4,
+		0x69, 0x12, 0x1A, 0x54, 0x61, 0x62, 0x6C, 0x65, 0x73, 0x2F, 0x48, 0x65, 0x61, 0x64, 0x65, 0x72,
+		0x53, 0x74, 0x6F, 0x72, 0x61, 0x67, 0x65, 0x42, 0x75, 0x63, 0x6B, 0x65, 0x74, 0x22, 0x03, 0x02,
+		0x00, 0x00, 0x2A, 0x03, 0x02, 0x00, 0x00, 0x50, 0x00, 0x60, 0xC5, 0x06, 0x1A, 0x37, 0x08, 0x85,
+		0xE9, 0x69, 0x12, 0x0B, 0x54, 0x61, 0x62, 0x6C, 0x65, 0x73, 0x2F, 0x54, 0x69, 0x6C, 0x65, 0x1A,
+		0x15, 0x54, 0x61, 0x62, 0x6C, 0x65, 0x73, 0x2F, 0x54, 0x69, 0x6C, 0x65, 0x2D, 0x31, 0x37, 0x33,
+		0x33, 0x37, 0x36, 0x35, 0x2D, 0x32, 0x22, 0x3A, 0x39, 0x00, 0x1C, 0x24, 0x08, 0xC6, 0xE4, 0x69,
+		0x12, 0x0F, 0x54, 0x09, 0x2C, 0x20, 0x44, 0x61, 0x74, 0x61, 0x4C, 0x69, 0x73, 0x74, 0x22, 0x3A,
+		0x26, 0x00, 0x08, 0x3F, 0x08, 0xCE, 0x4A, 0x26, 0x00, 0x04, 0x1A, 0x19, 0x3A, 0x37, 0x00, 0x05,
+		0x67, 0x10, 0x31, 0x39, 0x38, 0x2D, 0x32, 0x46, 0x41, 0x00, 0x00, 0xC8, 0xAA, 0x41, 0x00, 0x00,
+		0x32, 0x4E, 0x41, 0x00, 0x00, 0xCD, 0xAA, 0x41, 0x00, 0x00, 0x37, 0x4E, 0x41, 0x00, 0x00, 0xC9,
+		0xAA, 0x41, 0x00, 0x00, 0x33, 0x46, 0x41, 0x00, 0x3C, 0x2A, 0x08, 0x9F, 0xE0, 0x69, 0x12, 0x09,
+		0x56, 0x69, 0x65, 0x77, 0x53, 0x74, 0x61, 0x74, 0x65, 0x19, 0xE3, 0x54, 0x32, 0x0A, 0x08, 0x82,
+		0xE0, 0x69, 0x10, 0xF4, 0xE4, 0x69, 0x18, 0x01, 0x50, 0x00, 0x60, 0xC6, 0x06, 0x1A, 0x3F, 0x08,
+		0x87, 0xE9, 0x46, 0x56, 0x01, 0x56, 0x30, 0x01, 0x04, 0x37, 0x36, 0x52, 0xAE, 0x00, 0x00, 0xD3,
+		0xA2, 0xAE, 0x00, 0x04, 0x32, 0x30, 0x4A, 0xAE, 0x00, 0x08, 0x55, 0x08, 0xF0, 0x76, 0x42, 0x02,
+		0x04, 0x1A, 0x24, 0x2D, 0xBD, 0x00, 0x48, 0x46, 0x5E, 0x02, 0x25, 0xC8, 0x04, 0x32, 0x33, 0x52,
+		0x87, 0x01, 0x00, 0x88, 0xAA, 0xD9, 0x00, 0x52, 0x09, 0x02, 0x00, 0x89, 0xAA, 0x41, 0x00, 0x00,
+		0x39, 0x46, 0x87, 0x01, 0x14, 0x55, 0x08, 0x84, 0xE5, 0x69, 0x12, 0x6A, 0x1B, 0x03, 0x86, 0xD9,
+		0x00, 0x00, 0x35, 0x52, 0xD9, 0x00, 0x00, 0x8A, 0xA6, 0x98, 0x00, 0x04, 0x37, 0x30, 0x46, 0x98,
+		0x00, 0x08, 0x3F, 0x08, 0x8C, 0xAA, 0x41, 0x00, 0x4A, 0x82, 0x00, 0x14, 0x20, 0x08, 0xD9, 0xE4,
+		0x69, 0x12, 0x2E, 0xC3, 0x03, 0x59, 0x62, 0x0C, 0x50, 0x00, 0x60, 0xC5, 0x41, 0x56, 0x00, 0x8D,
+		0xAA, 0x63, 0x00, 0x4A, 0x15, 0x02, 0x08, 0x3F, 0x08, 0x8E, 0xAA, 0x41, 0x00, 0x00, 0x34, 0x46,
+		0xE5, 0x00, 0x08, 0x55, 0x08, 0x92, 0xFE, 0x7D, 0x01, 0x04, 0x36, 0x36, 0x46, 0x57, 0x00, 0x08,
+		0x3F, 0x08, 0xE3, 0xA6, 0xEE, 0x02, 0x00, 0x31, 0x4A, 0x15, 0x02, 0x50, 0x26, 0x08, 0x47, 0x12,
+		0x10, 0x44, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x4D, 0x65, 0x74, 0x61, 0x64, 0x61, 0x74,
+		0x61, 0x32, 0x3F, 0x01, 0x20, 0xC6, 0x06, 0xA8, 0x01, 0x01, 0x1A, 0x3F, 0x08, 0xCC, 0xA2, 0x69,
+		0x00, 0x04, 0x31, 0x39, 0x52, 0xAA, 0x00, 0x00, 0x8B, 0xAA, 0x42, 0x01, 0x00, 0x31, 0x4E, 0xEB,
+		0x00, 0x00, 0xCA, 0xAA, 0x82, 0x00, 0x4A, 0x83, 0x01, 0x08, 0x3F, 0x08, 0xD0, 0xA2, 0x41, 0x00,
+		0x04, 0x32, 0x30, 0x52, 0xA9, 0x02, 0x00, 0xDB, 0xA6, 0x41, 0x00, 0x00, 0x31, 0x52, 0xC3, 0x00,
+		0x00, 0x8F, 0xAA, 0x04, 0x01, 0x00, 0x35, 0x46, 0x04, 0x01, 0x14, 0xA6, 0x2E, 0x08, 0x01, 0x12,
+		0x08, 0x31, 0xAF, 0x39, 0xA7, 0x44, 0x32, 0x04, 0x08, 0x81, 0xE0, 0x69, 0x32, 0x08, 0x08, 0x85,
+		0xE0, 0x69, 0x10, 0xA2, 0xDC, 0x69, 0x32, 0x04, 0xA1, 0x58, 0x0D, 0x10, 0x00, 0xA3, 0x05, 0x10,
+		0x00, 0x9F, 0x15, 0x20, 0x04, 0xF4, 0xD7, 0x11, 0x1A, 0x04, 0xD3, 0xDB, 0x11, 0x0A, 0x00, 0xDB,
+		0x15, 0x14, 0x00, 0xBA, 0x15, 0x14, 0x00, 0xDC, 0x15, 0x14, 0x00, 0xBB, 0x15, 0x14, 0x00, 0xDD,
+		0x15, 0x14, 0x00, 0xBC, 0x15, 0x14, 0x00, 0xDE, 0x15, 0x14, 0x00, 0xBD, 0x15, 0x14, 0x00, 0xDF,
+		0x15, 0x14, 0x00, 0xBE, 0x15, 0x14, 0x00, 0xE0, 0x15, 0x14, 0x00, 0xBF, 0x15, 0x14, 0x00, 0xE1,
+		0x15, 0x14, 0x00, 0xC0, 0x15, 0x14, 0x00, 0xE2, 0x15, 0x14, 0x00, 0xC1, 0x15, 0x14, 0x00, 0xE3,
+		0x15, 0x14, 0x00, 0xC2, 0x15, 0x14, 0x00, 0xE4, 0x15, 0x14, 0x00, 0xC3, 0x15, 0x14, 0x00, 0xE5,
+		0x15, 0x14, 0x00, 0xC4, 0x15, 0x14, 0x00, 0xE6, 0x15, 0x14, 0x00, 0xC5, 0x15, 0x14, 0x00, 0xE7,
+		0x15, 0x14, 0x00, 0xC6, 0x15, 0x14, 0x00, 0xE8, 0x15, 0x14, 0x00, 0xC7, 0x15, 0x14, 0x00, 0xE9,
+		0x15, 0x14, 0x00, 0xC8, 0x15, 0x14, 0x00, 0xEA, 0x15, 0x14, 0x00, 0xC9, 0x15, 0x14, 0x00, 0xEB,
+		0x15, 0x14, 0x00, 0xCA, 0x15, 0x14, 0x00, 0xEC, 0x15, 0x14, 0x00, 0xCB, 0x15, 0x14, 0x00, 0xED,
+		0x15, 0x14, 0x00, 0xEE, 0x15, 0x0A, 0x00, 0xCD, 0x15, 0x1E, 0x00, 0xEF, 0x15, 0x14, 0x00, 0xCE,
+		0x15, 0x14, 0x00, 0xF0, 0x15, 0x14, 0x00, 0xCF, 0x15, 0x14, 0x00, 0xF1, 0x15, 0x14, 0x00, 0xD0,
+		0x15, 0x14, 0x00, 0xF2, 0x15, 0x14, 0x00, 0xD1, 0x15, 0x14, 0x00, 0xF3, 0x15, 0x14, 0x00, 0xD2,
+		0x15, 0x14, 0x00, 0x99, 0x15, 0x14, 0x04, 0xF8, 0xDA, 0x31, 0xFE, 0x00, 0x9A, 0x15, 0x14, 0x00,
+		0xF9, 0x15, 0x14, 0x00, 0x9B, 0x15, 0x14, 0x00, 0xFA, 0x15, 0x14, 0x00, 0x9C, 0x15, 0x14, 0x00,
+		0xFB, 0x15, 0x14, 0x00, 0x9D, 0x15, 0x14, 0x00, 0xFC, 0x15, 0x14, 0x00, 0x9E, 0x15, 0x14, 0x00,
+		0xFD, 0x15, 0x14, 0x00, 0x9F, 0x15, 0x14, 0x00, 0xFE, 0x15, 0x14, 0x00, 0xA0, 0x15, 0x14, 0x00,
+		0xFF, 0x15, 0x14, 0x00, 0xA1, 0x15, 0x14, 0x04, 0xAF, 0xDC, 0x11, 0xA0, 0x00, 0xB0, 0x15, 0x0A,
+		0x00, 0xB1, 0x15, 0x0A, 0x00, 0xB2, 0x15, 0x0A, 0x00, 0xB3, 0x15, 0x0A, 0x00, 0xAE, 0x15, 0x3C,
+		0x00, 0x8D, 0x15, 0xF0, 0x00, 0xD3, 0x15, 0x14, 0x00, 0xB2, 0x15, 0x14, 0x00, 0xD4, 0x15, 0x14,
+		0x00, 0xB3, 0x15, 0x14, 0x00, 0xD5, 0x15, 0x14, 0x00, 0xB4, 0x15, 0x14, 0x00, 0xD6, 0x15, 0x14,
+		0x00, 0xB5, 0x15, 0x14, 0x00, 0xD7, 0x15, 0x14, 0x00, 0xB6, 0x15, 0x14, 0x00, 0xD8, 0x15, 0x14,
+		0x00, 0xB7, 0x15, 0x14, 0x00, 0xD9, 0x15, 0x14, 0x00, 0xB8, 0x15, 0x14, 0x00, 0xDA, 0x15, 0x14,
+		0x00, 0xB9, 0x15, 0x14, 0x00, 0xA3, 0x15, 0x14, 0x00, 0x82, 0x15, 0x14, 0x00, 0xA9, 0x15, 0x14,
+		0x00, 0x88, 0x15, 0x14, 0x00, 0xAF, 0x15, 0x14, 0x00, 0x8E, 0x15, 0x14, 0x00, 0xB0, 0x15, 0x14,
+		0x00, 0x8F, 0x15, 0x14, 0x00, 0xB1, 0x15, 0x14, 0x00, 0x90, 0x15, 0x14, 0x00, 0xB7, 0x15, 0x14,
+		0x00, 0x96, 0x15, 0x14, 0x00, 0xBD, 0x15, 0x14, 0x00, 0x9C, 0x15, 0x14, 0x00, 0xC0, 0x15, 0x14,
+		0x00, 0x9F, 0x15, 0x14, 0x00, 0xC2, 0x15, 0x14, 0x00, 0xA1, 0x15, 0x14, 0x00, 0xC3, 0x15, 0x14,
+		0x00, 0xA2, 0x15, 0x14, 0x00, 0xC4, 0x15, 0x14, 0x00, 0xA3, 0x15, 0x14, 0x00, 0xA9, 0x35, 0x9A,
+		0x00, 0xAA, 0x15, 0x0A, 0x00, 0xAB, 0x15, 0x0A, 0x00, 0xAC, 0x15, 0x0A, 0x00, 0xAD, 0x15, 0x0A,
+		0x00, 0xAE, 0x15, 0x0A, 0x04, 0x87, 0xD9, 0x31, 0xFE, 0x00, 0x89, 0x15, 0x0A, 0x00, 0x8A, 0x15,
+		0x0A, 0x00, 0x8B, 0x15, 0x0A, 0x00, 0x88, 0x15, 0x0A, 0x00, 0xC6, 0x15, 0x82, 0x00, 0xA5, 0x15,
+		0x82, 0x00, 0xC7, 0x15, 0x14, 0x00, 0xA6, 0x15, 0x14, 0x00, 0xC5, 0x15, 0x14, 0x00, 0xA4, 0x15,
+		0x14, 0x00, 0x9B, 0x15, 0x46, 0x00, 0x8C, 0x15, 0x0A, 0x00, 0x8D, 0x15, 0x0A, 0x00, 0x8E, 0x15,
+		0x0A, 0x00, 0x8F, 0x15, 0x0A, 0x00, 0x90, 0x15, 0x0A, 0x00, 0x91, 0x15, 0x0A, 0x00, 0x92, 0x15,
+		0x0A, 0x00, 0x93, 0x15, 0x0A, 0x00, 0x94, 0x15, 0x0A, 0x00, 0x95, 0x15, 0x0A, 0x00, 0x96, 0x15,
+		0x0A, 0x00, 0x97, 0x15, 0x0A, 0x00, 0x98, 0x15, 0x0A, 0x00, 0x99, 0x15, 0x0A, 0x00, 0x9A, 0x15,
+		0x0A, 0x00, 0x9C, 0x15, 0x0A, 0x00, 0x9D, 0x15, 0x0A, 0x00, 0x9E, 0x15, 0x0A, 0x00, 0xA0, 0x15,
+		0x0A, 0x00, 0xA2, 0x15, 0x0A, 0x00, 0xA3, 0x15, 0x0A, 0x00, 0xA4, 0x15, 0x0A, 0x00, 0xA1, 0x15,
+		0x0A, 0x00, 0xC8, 0x35, 0x04, 0x00, 0xA7, 0x35, 0x04, 0x00, 0xC9, 0x15, 0x14, 0x00, 0xA8, 0x15,
+		0x14, 0x00, 0xB4, 0x15, 0x32, 0x00, 0xA5, 0x15, 0x0A, 0x00, 0xA6, 0x15, 0x0A, 0x00, 0xA7, 0x15,
+		0x0A, 0x00, 0xA8, 0x15, 0x0A, 0x00, 0xA9, 0x15, 0x0A, 0x00, 0xAA, 0x15, 0x0A, 0x00, 0xAB, 0x15,
+		0x0A, 0x00, 0xAC, 0x15, 0x0A, 0x00, 0xAD, 0x15, 0x0A, 0x00, 0xAE, 0x15, 0x0A, 0x00, 0xAF, 0x15,
+		0x0A, 0x00, 0xB0, 0x15, 0x0A, 0x00, 0xB1, 0x15, 0x0A, 0x00, 0xB2, 0x15, 0x0A, 0x00, 0xB3, 0x15,
+		0x0A, 0x00, 0xB5, 0x15, 0x0A, 0x00, 0xB6, 0x15, 0x0A, 0x00, 0xB7, 0x15, 0x0A, 0x00, 0xB9, 0x15,
+		0x0A, 0x00, 0xBB, 0x15, 0x0A, 0x00, 0xBC, 0x15, 0x0A, 0x00, 0xBD, 0x15, 0x0A, 0x00, 0xBA, 0x15,
+		0x0A, 0x00, 0xCD, 0x15, 0x0A, 0x00, 0xBE, 0x15, 0x0A, 0x00, 0xBF, 0x15, 0x0A, 0x00, 0xC0, 0x15,
+		0x0A, 0x00, 0xC1, 0x15, 0x0A, 0x00, 0xC2, 0x15, 0x0A, 0x00, 0xC3, 0x15, 0x0A, 0x00, 0xC4, 0x15,
+		0x0A, 0x00, 0xC5, 0x15, 0x0A, 0x00, 0xC6, 0x15, 0x0A, 0x00, 0xC7, 0x15, 0x0A, 0x00, 0xC8, 0x15,
+		0x0A, 0x00, 0xC9, 0x15, 0x0A, 0x00, 0xCA, 0x15, 0x0A, 0x00, 0xCB, 0x15, 0x0A, 0x00, 0xCC, 0x15,
+		0x0A, 0x00, 0xCE, 0x15, 0x0A, 0x00, 0xCF, 0x15, 0x0A, 0x00, 0xD0, 0x15, 0x0A, 0x00, 0xD2, 0x15,
+		0x0A, 0x00, 0xD4, 0x15, 0x0A, 0x00, 0xD5, 0x15, 0x0A, 0x00, 0xD6, 0x15, 0x0A, 0x00, 0xD3, 0x15,
+		0x0A, 0x00, 0xE6, 0x15, 0x0A, 0x00, 0xD7, 0x05, 0x0A, 0x1A, 0x8E, 0x0D, 0x1A, 0x3A, 0x08, 0x00,
+		0xD8, 0x05, 0x14, 0x0E, 0x54, 0x08, 0x00, 0xD9, 0x15, 0x0A, 0x00, 0xDA, 0x15, 0x0A, 0x00, 0xDB,
+		0x15, 0x0A, 0x00, 0xDC, 0x15, 0x0A, 0x00, 0xDD, 0x15, 0x0A, 0x00, 0xDE, 0x15, 0x0A, 0x00, 0xDF,
+		0x15, 0x0A, 0x00, 0xE0, 0x15, 0x0A, 0x00, 0xE1, 0x15, 0x0A, 0x00, 0xE2, 0x15, 0x0A, 0x00, 0xE3,
+		0x15, 0x0A, 0x00, 0xE4, 0x15, 0x0A, 0x00, 0xE5, 0x15, 0x0A, 0x00, 0xE7, 0x15, 0x0A, 0x00, 0xE8,
+		0x15, 0x0A, 0x00, 0xE9, 0x15, 0x0A, 0x00, 0xEB, 0x15, 0x0A, 0x00, 0xED, 0x15, 0x0A, 0x00, 0xEE,
+		0x15, 0x0A, 0x00, 0xEF, 0x15, 0x0A, 0x00, 0xEC, 0x15, 0x0A, 0x00, 0xCA, 0x55, 0xEE, 0x00, 0xA9,
+		0x55, 0xEE, 0x00, 0xFF, 0x15, 0x1E, 0x00, 0xF0, 0x15, 0x0A, 0x00, 0xF1, 0x15, 0x0A, 0x00, 0xF2,
+		0x15, 0x0A, 0x00, 0xF3, 0x15, 0x0A, 0x00, 0xF4, 0x15, 0x0A, 0x00, 0xF5, 0x15, 0x0A, 0x00, 0xF6,
+		0x15, 0x0A, 0x00, 0xF7, 0x15, 0x0A, 0x00, 0xF8, 0x15, 0x0A, 0x00, 0xF9, 0x15, 0x0A, 0x00, 0xFA,
+		0x15, 0x0A, 0x00, 0xFB, 0x15, 0x0A, 0x00, 0xFC, 0x15, 0x0A, 0x00, 0xFD, 0x15, 0x0A, 0x00, 0xFE,
+		0x15, 0x0A, 0x00, 0x80, 0xF5, 0x26, 0x00, 0x81, 0x15, 0x0A, 0x00, 0x82, 0x15, 0x0A, 0x00, 0x84,
+		0x15, 0x0A, 0x00, 0x86, 0x15, 0x0A, 0x00, 0x87, 0x15, 0x0A, 0x00, 0x88, 0x15, 0x0A, 0x00, 0x85,
+		0x15, 0x0A, 0x00, 0xCC, 0x35, 0x04, 0x00, 0xAB, 0x35, 0x04, 0x00, 0xCB, 0x15, 0x14, 0x00, 0xAA,
+		0x15, 0x14, 0x00, 0x98, 0x15, 0x32, 0x00, 0x89, 0x15, 0x0A, 0x00, 0x8A, 0x15, 0x0A, 0x00, 0x8B,
+		0x15, 0x0A, 0x00, 0x8C, 0x15, 0x0A, 0x00, 0x8D, 0x15, 0x0A, 0x00, 0x8E, 0x15, 0x0A, 0x00, 0x8F,
+		0x15, 0x0A, 0x00, 0x90, 0x15, 0x0A, 0x00, 0x91, 0x15, 0x0A, 0x00, 0x92, 0x15, 0x0A, 0x00, 0x93,
+		0x15, 0x0A, 0x00, 0x94, 0x15, 0x0A, 0x00, 0x95, 0x15, 0x0A, 0x00, 0x96, 0x15, 0x0A, 0x00, 0x97,
+		0x15, 0x0A, 0x00, 0x99, 0x15, 0x0A, 0x00, 0x9A, 0x15, 0x0A, 0x00, 0x9B, 0x15, 0x0A, 0x00, 0x9D,
+		0x15, 0x0A, 0x00, 0x9E, 0x15, 0x0A, 0x00, 0x9F, 0x15, 0x0A, 0x00, 0xA0, 0x15, 0x0A, 0x00, 0xA1,
+		0x15, 0x0A, 0x00, 0xA2, 0x15, 0x0A, 0x00, 0xA3, 0x15, 0x0A, 0x00, 0xA4, 0x15, 0x0A, 0x00, 0xA5,
+		0x15, 0x0A, 0x00, 0xA6, 0x15, 0x0A, 0x00, 0xA7, 0x15, 0x0A, 0x00, 0xA9, 0x15, 0x0A, 0x00, 0xAA,
+		0x15, 0x0A, 0x00, 0xAB, 0x15, 0x0A, 0x00, 0xAC, 0x15, 0x0A, 0x00, 0xAD, 0x15, 0x0A, 0x00, 0xAE,
+		0x15, 0x0A, 0x00, 0xAF, 0x15, 0x0A, 0x00, 0xB0, 0x15, 0x0A, 0x00, 0xB1, 0x15, 0x0A, 0x00, 0xB2,
+		0x15, 0x0A, 0x00, 0xB3, 0x15, 0x0A, 0x00, 0xB4, 0x15, 0x0A, 0x00, 0xB5, 0x15, 0x0A, 0x00, 0xB6,
+		0x15, 0x0A, 0x00, 0xB7, 0x15, 0x0A, 0x00, 0xB8, 0x15, 0x0A, 0x00, 0xB9, 0x15, 0x0A, 0x00, 0xBA,
+		0x15, 0x0A, 0x00, 0xBB, 0x15, 0x0A, 0x00, 0xBC, 0x15, 0x0A, 0x00, 0xBD, 0x15, 0x0A, 0x00, 0xBE,
+		0x15, 0x0A, 0x00, 0xBF, 0x15, 0x0A, 0x00, 0xC0, 0x15, 0x0A, 0x00, 0xC1, 0x15, 0x0A, 0x00, 0xC2,
+		0x15, 0x0A, 0x00, 0xC3, 0x15, 0x0A, 0x00, 0xC4, 0x15, 0x0A, 0x00, 0xC5, 0x15, 0x0A, 0x00, 0xC6,
+		0x15, 0x0A, 0x00, 0xC7, 0x15, 0x0A, 0x00, 0xC9, 0x15, 0x0A, 0x00, 0xCA, 0x15, 0x0A, 0x00, 0xCB,
+		0x15, 0x0A, 0x00, 0xCC, 0x15, 0x0A, 0x00, 0xCD, 0x15, 0x0A, 0x00, 0xCE, 0x15, 0x0A, 0x00, 0xCF,
+		0x15, 0x0A, 0x00, 0xD0, 0x15, 0x0A, 0x00, 0xD1, 0x15, 0x0A, 0x00, 0xD2, 0x15, 0x0A, 0x00, 0xD3,
+		0x15, 0x0A, 0x00, 0xD5, 0x15, 0x0A, 0x00, 0xD6, 0x15, 0x0A, 0x00, 0xD7, 0x15, 0x0A, 0x00, 0xD8,
+		0x15, 0x0A, 0x00, 0xD9, 0x15, 0x0A, 0x00, 0xDA, 0x15, 0x0A, 0x00, 0xDB, 0x15, 0x0A, 0x00, 0xDC,
+		0x15, 0x0A, 0x00, 0xDD, 0x15, 0x0A, 0x00, 0xDE, 0x15, 0x0A, 0x00, 0xDF, 0x15, 0x0A, 0x00, 0xE0,
+		0x15, 0x0A, 0x00, 0xE1, 0x15, 0x0A, 0x00, 0xE2, 0x15, 0x0A, 0x00, 0xE3, 0x15, 0x0A, 0x00, 0xE4,
+		0x15, 0x0A, 0x00, 0xE5, 0x15, 0x0A, 0x00, 0xE6, 0x15, 0x0A, 0x00, 0xE7, 0x15, 0x0A, 0x00, 0xE8,
+		0x15, 0x0A, 0x00, 0xE9, 0x15, 0x0A, 0x00, 0xEA, 0x15, 0x0A, 0x00, 0xEB, 0x15, 0x0A, 0x00, 0xEC,
+		0x15, 0x0A, 0x00, 0xED, 0x15, 0x0A, 0x00, 0xEE, 0x15, 0x0A, 0x00, 0xEF, 0x15, 0x0A, 0x00, 0xF0,
+		0x15, 0x0A, 0x00, 0xF1, 0x15, 0x0A, 0x00, 0xF2, 0x15, 0x0A, 0x00, 0xF3, 0x15, 0x0A, 0x00, 0xF5,
+		0x15, 0x0A, 0x00, 0xF6, 0x15, 0x0A, 0x00, 0xF7, 0x15, 0x0A, 0x00, 0x81, 0x95, 0x2E, 0x00, 0x83,
+		0x15, 0x0A, 0x00, 0x84, 0x15, 0x0A, 0x00, 0x85, 0x15, 0x0A, 0x00, 0x86, 0x15, 0x0A, 0x00, 0x87,
+		0x15, 0x0A, 0x00, 0x89, 0x15, 0x0A, 0x00, 0x8A, 0x15, 0x0A, 0x00, 0x8B, 0x15, 0x0A, 0x00, 0x8C,
+		0x15, 0x0A, 0x00, 0x91, 0x15, 0x0A, 0x00, 0x92, 0x15, 0x0A, 0x00, 0x93, 0x15, 0x0A, 0x00, 0x94,
+		0x15, 0x0A, 0x00, 0x95, 0x15, 0x0A, 0x00, 0x97, 0x15, 0x0A, 0x00, 0x98, 0x15, 0x0A, 0x00, 0x99,
+		0x15, 0x0A, 0x00, 0x9A, 0x15, 0x0A, 0x00, 0x9B, 0x15, 0x0A, 0x00, 0x9D, 0x15, 0x0A, 0x00, 0x9E,
+		0x15, 0x0A, 0x00, 0xAD, 0x15, 0x0A, 0x00, 0xAE, 0x15, 0x0A, 0x00, 0xAF, 0x15, 0x0A, 0x00, 0xB0,
+		0x15, 0x0A, 0x00, 0xB1, 0x15, 0x0A, 0x00, 0xD4, 0x15, 0x0A, 0x00, 0xD5, 0x15, 0x0A, 0x00, 0xD6,
+		0x15, 0x0A, 0x00, 0xD7, 0x15, 0x0A, 0x00, 0xD9, 0x15, 0x0A, 0x00, 0xDA, 0x15, 0x0A, 0x00, 0xDB,
+		0x15, 0x0A, 0x00, 0xDC, 0x15, 0x0A, 0x00, 0xDD, 0x15, 0x0A, 0x00, 0xDE, 0x15, 0x0A, 0x00, 0xDF,
+		0x15, 0x0A, 0x00, 0xE0, 0x15, 0x0A, 0x00, 0xE1, 0x15, 0x0A, 0x00, 0xE2, 0x15, 0x0A, 0x00, 0xE3,
+		0x15, 0x0A, 0x00, 0xE4, 0x15, 0x0A, 0x00, 0xE5, 0x15, 0x0A, 0x00, 0xE6, 0x15, 0x0A, 0x00, 0xE7,
+		0x15, 0x0A, 0x00, 0xE8, 0x15, 0x0A, 0x00, 0xE9, 0x15, 0x0A, 0x00, 0xEA, 0x15, 0x0A, 0x00, 0xEB,
+		0x15, 0x0A, 0x00, 0xEC, 0x15, 0x0A, 0x00, 0xED, 0x15, 0x0A, 0x00, 0xEE, 0x15, 0x0A, 0x00, 0xEF,
+		0x15, 0x0A, 0x00, 0xF0, 0x15, 0x0A, 0x00, 0xF1, 0x15, 0x0A, 0x00, 0xF2, 0x15, 0x0A, 0x00, 0xF3,
+		0x15, 0x0A, 0x00, 0xF4, 0x15, 0x0A, 0x00, 0xF5, 0x15, 0x0A, 0x00, 0xF6, 0x15, 0x0A, 0x00, 0xF7,
+		0x15, 0x0A, 0x00, 0xF9, 0x15, 0x0A, 0x00, 0xFA, 0x15, 0x0A, 0x00, 0xFB, 0x15, 0x0A, 0x00, 0xFC,
+		0x15, 0x0A, 0x00, 0xFD, 0x15, 0x0A, 0x00, 0xFE, 0x15, 0x0A, 0x00, 0xFF, 0x15, 0x0A, 0x00, 0x80,
+		0x22, 0x6C, 0x0C, 0x00, 0x81, 0x15, 0x0A, 0x00, 0x82, 0x15, 0x0A, 0x00, 0x83, 0x15, 0x0A, 0x00,
+		0x85, 0x15, 0x0A, 0x00, 0x86, 0x15, 0x0A, 0x00, 0x87, 0x15, 0x0A, 0x00, 0x88, 0x15, 0x0A, 0x00,
+		0x89, 0x15, 0x0A, 0x00, 0x8A, 0x15, 0x0A, 0x00, 0x8B, 0x15, 0x0A, 0x00, 0x8C, 0x15, 0x0A, 0x00,
+		0x8D, 0x15, 0x0A, 0x00, 0x8E, 0x15, 0x0A, 0x00, 0x8F, 0x15, 0x0A, 0x00, 0x90, 0x15, 0x0A, 0x00,
+		0x91, 0x15, 0x0A, 0x00, 0x92, 0x15, 0x0A, 0x00, 0x93, 0x15, 0x0A, 0x00, 0x94, 0x15, 0x0A, 0x00,
+		0x95, 0x15, 0x0A, 0x00, 0x96, 0x15, 0x0A, 0x00, 0x97, 0x15, 0x0A, 0x00, 0x98, 0x15, 0x0A, 0x00,
+		0x99, 0x15, 0x0A, 0x00, 0x9A, 0x15, 0x0A, 0x00, 0x9B, 0x15, 0x0A, 0x00, 0x9C, 0x15, 0x0A, 0x00,
+		0x9D, 0x15, 0x0A, 0x00, 0x9E, 0x15, 0x0A, 0x00, 0x9F, 0x15, 0x0A, 0x00, 0xA0, 0x15, 0x0A, 0x04,
+		0xFF, 0xDF, 0x1E, 0x28, 0x0A, 0x00, 0xA1, 0x15, 0x14, 0x00, 0xA5, 0x15, 0x0A, 0x00, 0xA6, 0x12,
+		0x76, 0x12, 0x00, 0x85, 0x22, 0x76, 0x12, 0x48, 0x95, 0xE0, 0x69, 0x3A, 0x0A, 0x08, 0x08, 0x12,
+		0x06, 0x08, 0x98, 0xD7, 0x69, 0x10, 0x01, 0x3A, 0x0A, 0x08, 0x09, 0x0D, 0x0C, 0xF4, 0x6C, 0x04,
+		0x05, 0x50, 0x00, 0x5A, 0x18, 0x08, 0x01, 0x12, 0x14, 0x08, 0x8E, 0xBB, 0xE4, 0xDF, 0xC3, 0xB8,
+		0xE6, 0xA2, 0x32, 0x10, 0xB5, 0x8D, 0xAB, 0xEE, 0xF0, 0xBD, 0x87, 0xFE, 0x2A, 0x5A, 0x1A, 0x08,
+		0xB8, 0xDD, 0x69, 0x12, 0x14, 0x08, 0xA6, 0x8E, 0xA2, 0xDC, 0xEB, 0x96, 0xC7, 0xA4, 0x16, 0x10,
+		0xA9, 0xBD, 0xFF, 0xC6, 0xA8, 0x9F, 0x8C, 0xF7, 0x58, 0x5A, 0x1A, 0x08, 0x9F, 0xD9, 0x69, 0x12,
+		0x14, 0x08, 0xB9, 0xF9, 0xF1, 0xAB, 0xF6, 0xCF, 0xE8, 0xA6, 0x1A, 0x10, 0x80, 0xD9, 0x92, 0xD5,
+		0x8C, 0xC7, 0xFC, 0xE2, 0x57, 0x5A, 0x1C, 0x08, 0xCC, 0xDB, 0x69, 0x12, 0x16, 0x08, 0x8F, 0x8C,
+		0xD3, 0xB1, 0xBC, 0x8A, 0xA2, 0xA6, 0xD2, 0x01, 0x10, 0xB8, 0xFD, 0xCD, 0x9B, 0xCF, 0xCB, 0xCA,
+		0xBC, 0xD1, 0x01, 0x5A, 0x1A, 0x08, 0x98, 0xD7, 0x69, 0x12, 0x14, 0x08, 0xED, 0xBE, 0xB7, 0xFC,
+		0xD4, 0xB2, 0xF7, 0xA3, 0x25, 0x10, 0x91, 0xF1, 0xF9, 0xF1, 0xA6, 0x88, 0xF0, 0xA4, 0x1C, 0x5A,
+		0x1B, 0x08, 0x83, 0xDA, 0x69, 0x12, 0x15, 0x08, 0xA1, 0x8A, 0xBB, 0xD2, 0xD4, 0xBF, 0x8F, 0xA4,
+		0xEF, 0x01, 0x10, 0x96, 0x99, 0xDE, 0xA4, 0xBA, 0xE9, 0xD7, 0xF5, 0x36, 0x5A, 0x1B, 0x08, 0x95,
+		0xDF, 0x69, 0x12, 0x15, 0x08, 0xBC, 0xC7, 0xAA, 0xEE, 0xC3, 0xD5, 0xBA, 0xA1, 0xB9, 0x01, 0x10,
+		0x9C, 0xBD, 0x91, 0xC0, 0x80, 0x87, 0x96, 0xBE, 0x3E, 0x5A, 0x1A, 0x08, 0xF4, 0xDA, 0x69, 0x12,
+		0x14, 0x08, 0xE2, 0xCB, 0xD9, 0xE8, 0x93, 0x9D, 0x8C, 0xA5, 0x44, 0x10, 0x8D, 0xA5, 0xEF, 0xBF,
+		0x80, 0x8C, 0xD9, 0x82, 0x66, 0x5A, 0x1B, 0x08, 0xB8, 0xD9, 0x69, 0x12, 0x15, 0x08, 0xEB, 0xBC,
+		0xA7, 0xED, 0xD4, 0xFD, 0xCB, 0xA5, 0x8C, 0x01, 0x10, 0x90, 0xA1, 0xE6, 0xCD, 0x9E, 0xC4, 0xF1,
+		0xE3, 0x1E, 0x5A, 0x1B, 0x08, 0xEA, 0xD9, 0x69, 0x12, 0x15, 0x08, 0xCE, 0xC8, 0xA1, 0xBA, 0xC8,
+		0x87, 0xF4, 0xA4, 0x1F, 0x10, 0x85, 0xC7, 0x8F, 0xB7, 0xE0, 0xD4, 0xE8, 0xD5, 0xDF, 0x01, 0x5A,
+		0x1B, 0x08, 0xC8, 0xDA, 0x69, 0x12, 0x15, 0x08, 0xFD, 0xE8, 0xF0, 0x98, 0xA0, 0xC3, 0xFF, 0xA4,
+		0x3D, 0x10, 0x98, 0x8D, 0x9C, 0x93, 0xD0, 0xD8, 0xAA, 0xA4, 0xF1, 0x01, 0x5A, 0x1B, 0x08, 0x92,
+		0xDE, 0x69, 0x12, 0x15, 0x08, 0xAF, 0xC1, 0x96, 0xE9, 0x84, 0xF2, 0xF9, 0xA3, 0xE1, 0x01, 0x10,
+		0x8B, 0xB5, 0x82, 0xFE, 0xAC, 0xAD, 0x9C, 0xAD, 0x0A, 0x5A, 0x1B, 0x08, 0xF8, 0xDB, 0x69, 0x12,
+		0x15, 0x08, 0xC1, 0x91, 0xF9, 0xCA, 0xAA, 0x9B, 0xD2, 0xA6, 0xE7, 0x01, 0x10, 0x91, 0x8D, 0xED,
+		0xB5, 0xB8, 0xDC, 0xCA, 0xE2, 0x1F, 0x5A, 0x1B, 0x08, 0xD1, 0xD9, 0x69, 0x12, 0x15, 0x08, 0xC6,
+		0xE1, 0xE7, 0x99, 0x84, 0xF7, 0x83, 0xA7, 0x41, 0x10, 0x80, 0xAD, 0x9E, 0x98, 0x92, 0x97, 0xA1,
+		0x97, 0x91, 0x01, 0x5A, 0x1C, 0x08, 0xA4, 0xDC, 0x69, 0x12, 0x16, 0x08, 0xDB, 0xBD, 0xAC, 0xB5,
+		0xD7, 0xEE, 0xBA, 0xA2, 0xE1, 0x01, 0x10, 0x8C, 0xCF, 0xC8, 0x81, 0x99, 0xD5, 0xB1, 0x90, 0x94,
+		0x01, 0x5A, 0x1B, 0x08, 0xBB, 0xDF, 0x69, 0x12, 0x15, 0x08, 0xE2, 0x94, 0x84, 0xB8, 0xD9, 0xE1,
+		0xF4, 0xA1, 0x47, 0x10, 0xB8, 0x97, 0x88, 0x8B, 0xB9, 0xEC, 0x8D, 0xD8, 0xA6, 0x01, 0x5A, 0x1B,
+		0x08, 0xDD, 0xDE, 0x69, 0x12, 0x15, 0x08, 0xE6, 0xD1, 0xA3, 0xA4, 0xAF, 0xC9, 0xAF, 0xA4, 0x65,
+		0x10, 0x9B, 0xEB, 0x88, 0x9D, 0x92, 0xF1, 0xFE, 0x83, 0xDB, 0x01, 0x5A, 0x1C, 0x08, 0x8C, 0xDF,
+		0x69, 0x12, 0x16, 0x08, 0xF6, 0xEB, 0xAF, 0xFC, 0xE3, 0xBD, 0xEB, 0xA0, 0xC5, 0x01, 0x10, 0x8B,
+		0x93, 0x97, 0xA2, 0x84, 0xD7, 0xA7, 0xF0, 0x98, 0x01, 0x5A, 0x1B, 0x08, 0xC8, 0xDD, 0x69, 0x12,
+		0x15, 0x08, 0x89, 0x81, 0x8A, 0x99, 0xF1, 0xE9, 0x86, 0xA3, 0x34, 0x10, 0x8A, 0x85, 0xD0, 0xBF,
+		0xE7, 0xA4, 0xE0, 0x8A, 0xB5, 0x01, 0x5A, 0x1C, 0x08, 0xAE, 0xDF, 0x69, 0x12, 0x16, 0x08, 0x9C,
+		0x95, 0xF6, 0xF0, 0xE1, 0xA8, 0x88, 0xA7, 0xC8, 0x01, 0x10, 0xA9, 0x97, 0xC8, 0xDF, 0xC4, 0x89,
+		0xDF, 0xA0, 0xE3, 0x01, 0x5A, 0x1C, 0x08, 0x9C, 0xDA, 0x69, 0x12, 0x16, 0x08, 0x8D, 0xED, 0x8C,
+		0x9E, 0xFE, 0xA4, 0xDA, 0xA4, 0xAD, 0x01, 0x10, 0x9F, 0x9F, 0x99, 0xA0, 0xD4, 0xE4, 0xDF, 0xCE,
+		0xE1, 0x01, 0x5A, 0x1C, 0x08, 0xA1, 0xDE, 0x69, 0x12, 0x16, 0x08, 0xC3, 0xC2, 0x94, 0xC6, 0x8E,
+		0x9D, 0xD9, 0xA1, 0xAF, 0x01, 0x10, 0xB5, 0xFD, 0x84, 0x9C, 0xEB, 0xE7, 0x8C, 0xFC, 0xE0, 0x01,
+		0x5A, 0x1A, 0x08, 0x9C, 0xDE, 0x69, 0x12, 0x14, 0x08, 0x80, 0x89, 0xB0, 0xE9, 0xC3, 0xC0, 0xC0,
+		0xA0, 0x6B, 0x10, 0xA2, 0xD1, 0xF4, 0xB4, 0xF9, 0xF9, 0xF5, 0x99, 0x5B, 0x5A, 0x1C, 0x08, 0xD4,
+		0xDF, 0x69, 0x12, 0x16, 0x08, 0xED, 0xAE, 0x91, 0xA5, 0xBF, 0xA2, 0xA7, 0xA2, 0xBF, 0x01, 0x10,
+		0x80, 0xA3, 0x88, 0xD0, 0x9C, 0xEF, 0xC8, 0xC3, 0xFA, 0x01, 0x5A, 0x1B, 0x08, 0xA0, 0xDB, 0x69,
+		0x12, 0x15, 0x08, 0x90, 0xF0, 0x86, 0xFB, 0xEF, 0xE6, 0xDD, 0xA7, 0x8C, 0x01, 0x10, 0x94, 0xCF,
+		0x96, 0x92, 0xDD, 0x99, 0xF0, 0xC5, 0x27, 0x5A, 0x1B, 0x08, 0x8B, 0xDD, 0x69, 0x12, 0x15, 0x08,
+		0xD5, 0x94, 0x9E, 0xAF, 0x86, 0x94, 0xA5, 0xA1, 0xD2, 0x01, 0x10, 0xB4, 0xF1, 0xEF, 0xBD, 0x87,
+		0xEA, 0xCE, 0xAB, 0x79, 0x5A, 0x1A, 0x08, 0x8E, 0xDF, 0x69, 0x12, 0x14, 0x08, 0xCF, 0xE5, 0xD2,
+		0xC8, 0xB5, 0x9D, 0x8C, 0xA1, 0x2D, 0x10, 0x8D, 0xEB, 0x8A, 0xF8, 0xA7, 0x9C, 0xF3, 0xE3, 0x37,
+		0x5A, 0x1C, 0x08, 0xDD, 0xDD, 0x69, 0x12, 0x16, 0x08, 0xB1, 0xF3, 0xE0, 0x9B, 0xE1, 0xC0, 0xB0,
+		0xA1, 0xF2, 0x01, 0x10, 0xBD, 0xA9, 0xDD, 0x9F, 0xA8, 0xDF, 0xBD, 0xC9, 0xE4, 0x01, 0x5A, 0x1B,
+		0x08, 0xBF, 0xDE, 0x69, 0x12, 0x15, 0x08, 0xFF, 0xBE, 0xBB, 0xA2, 0xE2, 0x9C, 0xFF, 0xA2, 0xF2,
+		0x01, 0x10, 0xA1, 0xB1, 0xB8, 0x9A, 0xA8, 0xDD, 0xA5, 0x84, 0x6F, 0x5A, 0x1A, 0x08, 0x82, 0xDF,
+		0x69, 0x12, 0x14, 0x08, 0xB2, 0xC0, 0xB1, 0xF7, 0xDA, 0xCC, 0xCB, 0xA4, 0x65, 0x10, 0x90, 0xBB,
+		0xC8, 0xD0, 0x93, 0xC3, 0xA1, 0xD3, 0x2B, 0x5A, 0x1B, 0x08, 0xFD, 0xDC, 0x69, 0x12, 0x15, 0x08,
+		0xC6, 0x8D, 0xE5, 0xD0, 0x89, 0xAE, 0xE5, 0xA7, 0x36, 0x10, 0x90, 0x8D, 0x99, 0xD0, 0xB7, 0xD6,
+		0x91, 0xC2, 0xD1, 0x01, 0x5A, 0x1C, 0x08, 0x8D, 0xDD, 0x69, 0x12, 0x16, 0x08, 0xB0, 0x91, 0x94,
+		0xE1, 0xE4, 0xB8, 0xFF, 0xA2, 0x89, 0x01, 0x10, 0xAC, 0xB3, 0xA4, 0xB4, 0xC5, 0xE2, 0x82, 0xAF,
+		0xD4, 0x01, 0x5A, 0x1A, 0x08, 0x81, 0xDF, 0x69, 0x12, 0x14, 0x08, 0xBF, 0xFF, 0x95, 0x8F, 0xA7,
+		0x99, 0xD1, 0xA3, 0x64, 0x10, 0xAB, 0xCB, 0x8B, 0xBB, 0xAF, 0xB9, 0x8D, 0xD9, 0x4E, 0x5A, 0x1C,
+		0x08, 0xDF, 0xDF, 0x69, 0x12, 0x16, 0x08, 0xF5, 0xAE, 0x9C, 0xD6, 0xD7, 0xDD, 0xA3, 0xA4, 0xC3,
+		0x01, 0x10, 0x8D, 0xDB, 0xBA, 0x98, 0xF0, 0xC6, 0x9F, 0xEC, 0xD6, 0x01, 0x5A, 0x1B, 0x08, 0xC0,
+		0xDF, 0x69, 0x12, 0x15, 0x08, 0x94, 0xC3, 0xE9, 0xA4, 0xEB, 0xAA, 0x9C, 0xA6, 0xD4, 0x01, 0x10,
+		0x91, 0xB7, 0x94, 0xC4, 0xA7, 0xF7, 0x85, 0xAA, 0x0B, 0x5A, 0x1B, 0x08, 0x8A, 0xDD, 0x69, 0x12,
+		0x15, 0x08, 0xD9, 0xF0, 0x94, 0xE2, 0xD3, 0xE1, 0xEE, 0xA7, 0xC2, 0x01, 0x10, 0x9A, 0x87, 0xF8,
+		0x9C, 0x9A, 0x89, 0xA0, 0x82, 0x76, 0x5A, 0x1B, 0x08, 0xCC, 0xDE, 0x69, 0x12, 0x15, 0x08, 0xD4,
+		0xF3, 0xB6, 0xE0, 0xCA, 0xE2, 0xF3, 0xA5, 0xAB, 0x01, 0x10, 0xBE, 0xA9, 0x97, 0xDB, 0x9C, 0xFF,
+		0x86, 0x83, 0x01, 0x5A, 0x1B, 0x08, 0xD8, 0xDE, 0x69, 0x12, 0x15, 0x08, 0xF1, 0xED, 0xA6, 0xD6,
+		0xF4, 0xAA, 0xDB, 0xA6, 0x1B, 0x10, 0x97, 0xDF, 0xAE, 0xE2, 0x96, 0xEA, 0xC2, 0xFE, 0xE8, 0x01,
+		0x60, 0xC5, 0x06, 0x1A, 0x4D, 0x08, 0x81, 0xE0, 0x69, 0x12, 0x17, 0x41, 0x6E, 0x6E, 0x6F, 0x74,
+		0x61, 0x74, 0x69, 0x6F, 0x6E, 0x41, 0x75, 0x74, 0x68, 0x6F, 0x72, 0x53, 0x74, 0x12, 0x0A, 0x1E,
+		0x4C, 0x1A, 0x1F, 0x41, 0x6E, 0x6E, 0x6F, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x41, 0x75, 0x74,
+		0x68, 0x6F, 0x72, 0x53, 0x74, 0x05, 0x19, 0x0E, 0xBF, 0x1B, 0x0C, 0x32, 0x36, 0x30, 0x39, 0x26,
+		0x5A, 0x17, 0x0C, 0x50, 0x00, 0x60, 0xC3, 0x0E, 0x40, 0x1A, 0x00, 0x86, 0xA6, 0xB9, 0x17, 0x4E,
+		0xA8, 0x19, 0x08, 0x49, 0x08, 0xDC, 0xAA, 0x3B, 0x18, 0x32, 0xE4, 0x1A, 0x1A, 0x8C, 0x0F, 0x08,
+		0xDC, 0xED, 0x69, 0x1E, 0xCC, 0x1A, 0x00, 0x90, 0xA6, 0x8C, 0x00, 0x00, 0x37, 0x52, 0x8A, 0x19,
+		0x04, 0x91, 0xEC, 0x9A, 0x63, 0x1D, 0x08, 0x34, 0x31, 0x36, 0x4A, 0xC7, 0x18, 0x04, 0x90, 0x06,
+		0x0E, 0x28, 0x10, 0x1C, 0x12, 0x11, 0x43, 0x61, 0x6C, 0x63, 0x75, 0x6C, 0x25, 0x46, 0x1C, 0x45,
+		0x6E, 0x67, 0x69, 0x6E, 0x65, 0x1A, 0x19, 0x42, 0x13, 0x00, 0x29, 0x52, 0x28, 0x31, 0x30, 0x22,
+		0x03, 0x03, 0x02, 0x0A, 0x2A, 0x03, 0x0A, 0x01, 0x01, 0xD0, 0x20, 0x01, 0x10, 0xBB, 0xDF, 0x69,
+		0x18, 0x01, 0x32, 0x04, 0x0E, 0xB9, 0x1B, 0x0D, 0xE0, 0x0E, 0x0A, 0x13, 0x00, 0x06, 0xC1, 0x30,
+		0x04, 0x18, 0x01, 0x0D, 0x12, 0x16, 0xE0, 0x12, 0x0C, 0x01, 0x10, 0x9F, 0xD9, 0x19, 0x14, 0x00,
+		0xA8, 0xD5, 0x60, 0x26, 0x44, 0x13, 0xC1, 0x6A, 0x16, 0xFA, 0x18, 0x26, 0x6C, 0x13, 0x0E, 0xE6,
+		0x16, 0x00, 0x04, 0x01, 0xE8, 0x04, 0x32, 0x04, 0x0E, 0x79, 0x1B, 0x0D, 0x20, 0x04, 0x8D, 0xD9,
+		0x01, 0x10, 0x04, 0xED, 0xE4, 0x01, 0x06, 0x04, 0x85, 0xE9, 0x01, 0x06, 0x00, 0xC6, 0x05, 0x0C,
+		0x04, 0xDC, 0xE4, 0x11, 0x22, 0x0E, 0x72, 0x13, 0x00, 0x04, 0x0E, 0xB3, 0x1F, 0x0D, 0x32, 0x0E,
+		0x0E, 0x14, 0x00, 0x04, 0x0E, 0x82, 0x1F, 0x04, 0x32, 0x04, 0x0E, 0x47, 0x1F, 0x0D, 0x16, 0x00,
+		0x8B, 0x05, 0x48, 0x00, 0xDB, 0x15, 0x36, 0x0E, 0xB2, 0x13, 0x00, 0x04, 0x0E, 0x5E, 0x1A, 0x0D,
+		0x20, 0x26, 0x30, 0x14, 0x0E, 0x6C, 0x14, 0x00, 0x04, 0x0E, 0xB9, 0x1A, 0x0D, 0x1A, 0x0E, 0xAE,
+		0x14, 0x00, 0x04, 0x0E, 0x50, 0x1F, 0x0D, 0x10, 0x0E, 0xE6, 0x14, 0x00, 0x04, 0x0E, 0xC4, 0x1B,
+		0x04, 0x32, 0x04, 0x0E, 0xB8, 0x1E, 0x0D, 0x16, 0x0E, 0x52, 0x14, 0x00, 0x04, 0x0E, 0x71, 0x1B,
+		0x0D, 0x10, 0x26, 0xF8, 0x14, 0x26, 0x0C, 0x15, 0x26, 0xEE, 0x14, 0x26, 0x94, 0x14, 0x26, 0xEE,
+		0x14, 0x26, 0x9E, 0x14, 0x4E, 0x94, 0x14, 0x26, 0x8A, 0x14, 0x26, 0x76, 0x14, 0x26, 0x02, 0x15,
+		0x36, 0x6C, 0x14, 0x00, 0x04, 0x0E, 0x0F, 0x1F, 0x04, 0x32, 0x04, 0x0E, 0xBE, 0x1E, 0x04, 0x32,
+		0x04, 0x0E, 0x42, 0x1E, 0x04, 0x32, 0x04, 0x61, 0x0D, 0x04, 0x32, 0x04, 0x0E, 0xA9, 0x1F, 0x04,
+		0x32, 0x04, 0x0E, 0xFD, 0x1D, 0x04, 0x32, 0x04, 0x0E, 0xC2, 0x1D, 0x04, 0x32, 0x04, 0x0E, 0x65,
+		0x1D, 0x04, 0x32, 0x04, 0x0E, 0x2A, 0x1D, 0x04, 0x32, 0x04, 0x0E, 0xEA, 0x1A, 0x04, 0x32, 0x04,
+		0x41, 0xAB, 0x04, 0x32, 0x04, 0x0E, 0xFA, 0x1B, 0x04, 0x32, 0x04, 0x0E, 0xBF, 0x1E, 0x18, 0x50,
+		0x00, 0x5A, 0x1B, 0x08, 0xF4, 0xE4, 0xE1, 0x41, 0x48, 0x88, 0x99, 0xA4, 0xF5, 0xF8, 0xA1, 0xF1,
+		0xA2, 0x6B, 0x10, 0xB3, 0xF5, 0xA8, 0xCE, 0x84, 0xDD, 0xE8, 0xA9, 0xC8, 0xA1, 0xE4, 0x04, 0xFF,
+		0xE4, 0xA1, 0xC6, 0x64, 0xA0, 0x8E, 0xB1, 0xE1, 0xD3, 0xBB, 0xE1, 0xA6, 0x9F, 0x01, 0x10, 0x94,
+		0xE1, 0x99, 0xD1, 0x8B, 0xF7, 0xBD, 0x9C, 0xCF, 0x01, 0x5A, 0x1B, 0x08, 0xE6, 0xEC, 0x01, 0x3B,
+		0x48, 0x85, 0xBE, 0x95, 0xC3, 0xCC, 0xE7, 0xB1, 0xA5, 0x06, 0x10, 0x8D, 0xFD, 0xF8, 0x9D, 0xF9,
+		0xB4, 0xAC, 0xF7, 0xD8, 0xE1, 0xD2, 0x74, 0xE7, 0xEC, 0x69, 0x12, 0x14, 0x08, 0xDD, 0xB2, 0xB6,
+		0xDA, 0xCF, 0xD0, 0x94, 0xA2, 0x51, 0x10, 0x89, 0x89, 0x8A, 0xE7, 0xF9, 0xE2, 0xC3, 0x9E, 0x7B,
+		0x5A, 0x1B, 0x08, 0x97, 0xE5, 0x01, 0x39, 0x80, 0x92, 0xFF, 0xBD, 0xA4, 0x9A, 0xA2, 0xF5, 0xA1,
+		0x2B, 0x10, 0xB8, 0xAF, 0xFF, 0xE0, 0xC2, 0x96, 0xB2, 0xB8, 0xD5, 0x01, 0x60, 0xC5, 0x06, 0x6A,
+		0x17, 0x0A, 0x0B, 0x54, 0x53, 0x41, 0x43, 0x61, 0x70, 0x81, 0x11, 0x18, 0x73, 0x12, 0x03, 0x02,
+		0x04, 0x00, 0x1A, 0x41, 0xAB, 0x34, 0x6A, 0x27, 0x0A, 0x1B, 0x54, 0x53, 0x43, 0x45, 0x52, 0x65,
+		0x64, 0x75, 0x63, 0x65, 0x41, 0xDC, 0x49, 0xE8, 0x1C, 0x4D, 0x73, 0x67, 0x53, 0x69, 0x7A, 0x65,
+		0x12, 0x41, 0xD4, 0x00, 0x1A, 0x05, 0x05, 0x04, 0xD0, 0x6F, 0x41, 0xBB, 0x04, 0x12, 0x12, 0x1E,
+		0x9B, 0x1B, 0x20, 0x53, 0x74, 0x79, 0x6C, 0x65, 0x73, 0x68, 0x65, 0x65, 0x2A, 0xA5, 0x1B, 0x5C,
+		0x3A, 0x0A, 0x08, 0x17, 0x12, 0x06, 0x08, 0x9C, 0xD7, 0x69, 0x10, 0x09, 0x3A, 0x0A, 0x08, 0x0E,
+		0x12, 0x06, 0x08, 0xA1, 0xD7, 0x69, 0x10, 0x02, 0x25, 0x15, 0x04, 0xD5, 0xD7, 0x01, 0xA1, 0x48,
+		0xB3, 0xD4, 0xDC, 0x83, 0x8B, 0x86, 0xB0, 0xA7, 0x32, 0x10, 0xA3, 0xC3, 0x83, 0xDB, 0xF1, 0x8D,
+		0x8E, 0xFB, 0xAC, 0x21, 0x15, 0x04, 0xD9, 0xD7, 0x21, 0x15, 0x4C, 0xC8, 0xA8, 0xEC, 0xB9, 0xE7,
+		0x84, 0xDB, 0xA4, 0x9E, 0x01, 0x10, 0x9D, 0x85, 0xE0, 0xB4, 0xC7, 0x83, 0xDD, 0xAF, 0x9E, 0x01,
+		0xF8, 0x04, 0xDA, 0xD7, 0x01, 0xF8, 0x58, 0x97, 0xE9, 0x8F, 0xFB, 0xD5, 0x97, 0xC2, 0xA3, 0x17,
+		0x10, 0xA6, 0xF3, 0x9B, 0x91, 0xAA, 0xCA, 0x87, 0xA0, 0x6C, 0x5A, 0x1A, 0x08, 0xD6, 0x05, 0x1C,
+		0x58, 0xE3, 0xFF, 0xC1, 0xE6, 0xC5, 0x80, 0xB4, 0xA5, 0x76, 0x10, 0x9C, 0xD7, 0xF5, 0x9C, 0x80,
+		0x9D, 0xE5, 0xAA, 0x76, 0x5A, 0x1A, 0x08, 0xD7, 0x05, 0x1C, 0x58, 0xDE, 0x81, 0xDC, 0xE9, 0xE3,
+		0xD7, 0xAC, 0xA4, 0x29, 0x10, 0xBE, 0xF5, 0xB0, 0xCC, 0xF2, 0xC3, 0x84, 0xF6, 0x77, 0x5A, 0x1A,
+		0x08, 0xD8, 0x05, 0x1C, 0x5C, 0xA1, 0xE1, 0xA7, 0x9B, 0xDB, 0x8D, 0x8C, 0xA3, 0x75, 0x10, 0x9D,
+		0xBD, 0xD8, 0xDD, 0x93, 0xE9, 0xD8, 0x8F, 0x1C, 0x5A, 0x1B, 0x08, 0xAE, 0xDC, 0x01, 0xAB, 0x60,
+		0xFF, 0xB4, 0xDE, 0x97, 0xA7, 0xC4, 0xC8, 0xA7, 0xB5, 0x01, 0x10, 0xB9, 0xEB, 0xB8, 0xD1, 0xDC,
+		0xEA, 0x89, 0x8E, 0x14, 0x5A, 0x1C, 0x08, 0xAD, 0xDC, 0x01, 0xAB, 0x4C, 0xEE, 0x9F, 0xAF, 0xCE,
+		0x92, 0xCD, 0xF4, 0xA7, 0xD1, 0x01, 0x10, 0x9E, 0xAD, 0xC8, 0xC4, 0xAA, 0xA1, 0x9B, 0x96, 0xE7,
+		0x21, 0xC0, 0x00, 0xAC, 0x05, 0x3B, 0x60, 0xAA, 0xB0, 0x8C, 0xB6, 0xF7, 0xEE, 0xC2, 0xA3, 0xFA,
+		0x01, 0x10, 0x86, 0xC9, 0x87, 0xE2, 0xF1, 0x8E, 0xD8, 0xA4, 0x7B, 0x5A, 0x1A, 0x08, 0xAB, 0xDC,
+		0x01, 0xC8, 0x58, 0xAC, 0xD4, 0xC3, 0xCC, 0xF2, 0xB5, 0xA6, 0xA6, 0x6B, 0x10, 0xA5, 0xB5, 0xF7,
+		0xB5, 0xD2, 0x9A, 0x8A, 0xD2, 0x3F, 0x5A, 0x1B, 0x08, 0xAA, 0x05, 0x39, 0x48, 0xF8, 0xCD, 0xC6,
+		0xF4, 0x80, 0xCF, 0xFF, 0xA5, 0x32, 0x10, 0xAC, 0x9B, 0xA2, 0xAD, 0xF9, 0xFA, 0xF5, 0xC1, 0x92,
+		0x01, 0x56, 0x00, 0xA9, 0x05, 0x1D, 0x5C, 0xFD, 0xD7, 0x9F, 0xFD, 0xB2, 0xCF, 0xF6, 0xA3, 0xD6,
+		0x01, 0x10, 0xB2, 0x9B, 0xAE, 0xCE, 0x87, 0x95, 0xB6, 0xE7, 0x0D, 0x5A, 0x1C, 0x08, 0xAF, 0x05,
+		0x91, 0x4C, 0xED, 0xC2, 0x85, 0x91, 0xE3, 0xDE, 0xD6, 0xA3, 0xEE, 0x01, 0x10, 0x90, 0xD5, 0xA1,
+		0x9C, 0xF4, 0x86, 0xC2, 0xDB, 0xAE, 0x01, 0x3B, 0x00, 0xE7, 0x25, 0x77, 0x48, 0x93, 0xB9, 0x87,
+		0x83, 0x9F, 0xBA, 0xF1, 0xA4, 0x3E, 0x10, 0x8B, 0xC9, 0xC9, 0xBF, 0xFB, 0x83, 0xDD, 0xFA, 0x8B,
+		0x01, 0x1D, 0x00, 0xA1, 0x05, 0x1D, 0x48, 0xBB, 0xC2, 0x93, 0xC8, 0xF4, 0xD5, 0xA4, 0xA0, 0x12,
+		0x10, 0x91, 0xB5, 0x97, 0xC5, 0xED, 0xD3, 0xA0, 0xCE, 0xBB, 0x01, 0x1D, 0x00, 0xA0, 0x05, 0x1D,
+		0x48, 0xB3, 0x84, 0xE2, 0xAF, 0x9F, 0x8D, 0x89, 0xA4, 0x3D, 0x10, 0xB4, 0xCB, 0xEE, 0xEB, 0xFA,
+		0xF6, 0xFB, 0xD4, 0xD7, 0x21, 0x93, 0x00, 0xA9, 0x25, 0x3F, 0x58, 0xB0, 0xB9, 0xBE, 0xC5, 0x8E,
+		0xD6, 0xEF, 0xA7, 0x5F, 0x10, 0x97, 0xC9, 0xF0, 0xF8, 0x9B, 0xE4, 0xEB, 0xCA, 0x58, 0x5A, 0x1B,
+		0x08, 0x9F, 0x05, 0x39, 0x5C, 0xFB, 0x8B, 0x98, 0xC9, 0xE2, 0xE2, 0xA1, 0xA4, 0x95, 0x01, 0x10,
+		0x8B, 0xF1, 0x9B, 0xB3, 0xAA, 0xAA, 0x8B, 0xC1, 0x67, 0x5A, 0x1B, 0x08, 0x9E, 0x05, 0x1D, 0x48,
+		0xCF, 0xF6, 0xB6, 0x88, 0xB8, 0xCD, 0xB6, 0xA0, 0x48, 0x10, 0xB4, 0x8B, 0xA6, 0xEF, 0x9D, 0xB7,
+		0xCC, 0xF3, 0x9A, 0x01, 0x56, 0x00, 0xCC, 0x05, 0x56, 0x58, 0xF5, 0xB7, 0xC6, 0x9E, 0xB5, 0xF0,
+		0xB4, 0xA4, 0x32, 0x10, 0x8D, 0xF3, 0xEF, 0x96, 0xB0, 0xD4, 0xB4, 0x87, 0x59, 0x5A, 0x1B, 0x08,
+		0xCB, 0x05, 0x39, 0x5C, 0xF5, 0xF2, 0xD5, 0xB0, 0x86, 0xA5, 0x98, 0xA3, 0xC8, 0x01, 0x10, 0x93,
+		0x9D, 0xEB, 0x82, 0xC8, 0x85, 0xA8, 0x9F, 0x06, 0x5A, 0x1C, 0x08, 0xB3, 0x25, 0x04, 0x4C, 0xEB,
+		0xE2, 0x97, 0xFA, 0x95, 0x9D, 0xFF, 0xA7, 0x98, 0x01, 0x10, 0xA0, 0xC7, 0x8D, 0xD9, 0xA7, 0xEF,
+		0xF4, 0x99, 0xB4, 0x01, 0xCA, 0x00, 0x9D, 0x05, 0x3B, 0x20, 0xAA, 0xFB, 0xA8, 0x88, 0xE8, 0xA6,
+		0xAB, 0xA7, 0xAC, 0xE1, 0x67, 0x28, 0xA5, 0x93, 0xE5, 0x9D, 0x89, 0xA9, 0x5D, 0x5A, 0x1B, 0x08,
+		0xCA, 0x05, 0x1D, 0x5C, 0xC0, 0xA9, 0xA3, 0x9E, 0xBB, 0xF0, 0xF3, 0xA4, 0xA1, 0x01, 0x10, 0xAB,
+		0xC9, 0xCD, 0xC8, 0x8B, 0xB6, 0x89, 0xBA, 0x66, 0x5A, 0x1A, 0x08, 0xC9, 0x05, 0x91, 0x58, 0xEE,
+		0xE2, 0xEB, 0xBB, 0xCC, 0xD1, 0xD3, 0xA7, 0x32, 0x10, 0xBA, 0xC7, 0xE3, 0x9E, 0xC1, 0xFD, 0xB5,
+		0x99, 0x4E, 0x5A, 0x1A, 0x08, 0xC8, 0x05, 0x1C, 0x44, 0xA2, 0xA8, 0xE0, 0xDA, 0x81, 0xAB, 0xF0,
+		0xA0, 0x3A, 0x10, 0x8C, 0xD5, 0xDA, 0x89, 0xA8, 0xB6, 0xA1, 0x88, 0x41, 0x42, 0x00, 0xC7, 0x05,
+		0x55, 0x5C, 0xBB, 0xB9, 0xB9, 0xD1, 0x94, 0xF7, 0xC2, 0xA1, 0xD2, 0x01, 0x10, 0xAE, 0xEF, 0xFC,
+		0xDB, 0xD2, 0xE0, 0x92, 0x98, 0x46, 0x5A, 0x1C, 0x08, 0xC6, 0x45, 0xED, 0x4C, 0x84, 0xCA, 0xE1,
+		0xFB, 0xD7, 0xF9, 0xC5, 0xA3, 0x99, 0x01, 0x10, 0xB2, 0xE7, 0xC4, 0xAA, 0xB9, 0xE9, 0x9F, 0xCC,
+		0xC6, 0x01, 0xAD, 0x00, 0xC5, 0x05, 0x3B, 0x48, 0xFE, 0xB4, 0x8F, 0xC8, 0xE6, 0xDD, 0x91, 0xA1,
+		0x63, 0x10, 0xAB, 0xF5, 0xC1, 0xD0, 0xC6, 0xC5, 0xD1, 0xB3, 0x8A, 0x01, 0x1D, 0x00, 0xC2, 0x05,
+		0x1D, 0x48, 0xAB, 0xCA, 0xFD, 0x8B, 0xE8, 0xAE, 0xBA, 0xA1, 0x1B, 0x10, 0x8D, 0x81, 0xF6, 0xEC,
+		0xC7, 0xED, 0xF8, 0xB5, 0xB8, 0x01, 0x1D, 0x00, 0xB2, 0x45, 0x26, 0x48, 0xE2, 0xF3, 0x86, 0xBA,
+		0xCC, 0xAD, 0x9C, 0xA5, 0xD3, 0x01, 0x10, 0xB9, 0xD7, 0xF5, 0xAC, 0x91, 0x8F, 0xE0, 0xB9, 0x61,
+		0x0C, 0x00, 0x9C, 0x05, 0xAE, 0x58, 0x85, 0x95, 0xE6, 0x81, 0x92, 0xDC, 0x99, 0xA1, 0x65, 0x10,
+		0xAC, 0xF3, 0xC4, 0x8C, 0xE8, 0xD9, 0xFD, 0xF9, 0x67, 0x5A, 0x1C, 0x08, 0xC0, 0x05, 0x91, 0x4C,
+		0xB7, 0xD4, 0x9B, 0xEC, 0xDB, 0xCC, 0xEB, 0xA2, 0xDC, 0x01, 0x10, 0x9B, 0x8F, 0xAC, 0xF8, 0x9F,
+		0x82, 0xB2, 0x98, 0x9C, 0x01, 0x57, 0x00, 0xBD, 0x05, 0x74, 0x5C, 0xE0, 0xA6, 0xD8, 0x9F, 0xCF,
+		0x8C, 0xDA, 0xA4, 0xD4, 0x01, 0x10, 0x94, 0x89, 0xA2, 0x81, 0xC9, 0x8A, 0x95, 0xE5, 0x2D, 0x5A,
+		0x1A, 0x08, 0xB1, 0x45, 0xD3, 0x58, 0x87, 0x8B, 0xB2, 0xF0, 0xB2, 0xA1, 0xD8, 0xA4, 0x1C, 0x10,
+		0x9A, 0x9D, 0xB8, 0xCE, 0xB9, 0xFD, 0xFF, 0xEB, 0x69, 0x5A, 0x1B, 0x08, 0x9B, 0x05, 0x39, 0x5C,
+		0xC3, 0xAE, 0xE2, 0xF0, 0x8B, 0xE9, 0xBD, 0xA6, 0x83, 0x01, 0x10, 0xA4, 0xFF, 0xE0, 0xA3, 0xE2,
+		0xFF, 0x88, 0xBE, 0x11, 0x5A, 0x1B, 0x08, 0xB1, 0x05, 0x1D, 0x5C, 0xEC, 0xF8, 0xF4, 0xD8, 0xCC,
+		0x93, 0xAF, 0xA0, 0xD7, 0x01, 0x10, 0x87, 0xCD, 0xDA, 0xD7, 0xA9, 0xEA, 0xBE, 0xD2, 0x14, 0x5A,
+		0x1A, 0x08, 0xB0, 0x05, 0xAD, 0x58, 0xBB, 0xBF, 0x8F, 0xD8, 0xE1, 0xB2, 0xB6, 0xA5, 0x23, 0x10,
+		0x9F, 0xA9, 0xA9, 0xFD, 0x88, 0xB9, 0xF2, 0xCA, 0x50, 0x5A, 0x1A, 0x08, 0xAF, 0x05, 0x1C, 0x58,
+		0xF3, 0x97, 0x97, 0x94, 0xF2, 0x8B, 0x86, 0xA4, 0x28, 0x10, 0x82, 0xCF, 0xA8, 0x88, 0x91, 0xA2,
+		0xA8, 0xDD, 0x32, 0x5A, 0x1A, 0x08, 0xAE, 0x05, 0x1C, 0x48, 0xA7, 0xBC, 0xC3, 0x8E, 0xE2, 0xFE,
+		0xD1, 0xA3, 0x49, 0x10, 0x99, 0xDB, 0x85, 0xC2, 0x8F, 0x9B, 0xAE, 0x9E, 0x41, 0x01, 0x54, 0x05,
+		0xAA, 0x58, 0x8D, 0xAE, 0xC4, 0x8A, 0xA4, 0x86, 0xB8, 0xA2, 0x14, 0x10, 0xAC, 0xC9, 0xB4, 0x8E,
+		0x8B, 0xE2, 0xA0, 0xB5, 0x5D, 0x5A, 0x1A, 0x08, 0x9A, 0x05, 0x38, 0x58, 0xC1, 0xB7, 0xF8, 0xF1,
+		0xA0, 0xCA, 0xF3, 0xA0, 0x65, 0x10, 0x90, 0xCF, 0x86, 0xE8, 0xE0, 0x99, 0xFE, 0x84, 0x5D, 0x5A,
+		0x1C, 0x08, 0xA3, 0x25, 0x1D, 0x4C, 0xD5, 0xB7, 0xE2, 0xF5, 0xDF, 0xFF, 0xC9, 0xA5, 0x9B, 0x01,
+		0x10, 0xBD, 0xDD, 0x8E, 0xC2, 0xAA, 0x97, 0xDB, 0xAA, 0xE8, 0x81, 0xB9, 0x04, 0x98, 0xDA, 0x81,
+		0x0E, 0x4C, 0xCA, 0xF8, 0xB3, 0x84, 0xB7, 0x8F, 0x87, 0xA5, 0x89, 0x01, 0x10, 0x8B, 0x93, 0xFA,
+		0x82, 0x8E, 0x8C, 0x96, 0xF7, 0xC8, 0x21, 0x3B, 0x04, 0xE6, 0xD9, 0x81, 0x49, 0x48, 0xB6, 0xAF,
+		0xB0, 0xA9, 0x9C, 0xD2, 0xA1, 0xA5, 0x30, 0x10, 0xB4, 0xB1, 0x88, 0xF7, 0xAE, 0x97, 0x98, 0x83,
+		0x90, 0x01, 0x1D, 0x00, 0xCD, 0x05, 0x1D, 0x48, 0xAC, 0x8E, 0x83, 0xDD, 0xBE, 0xEE, 0xD8, 0xA3,
+		0x3E, 0x10, 0x96, 0xED, 0xD0, 0xF5, 0xFF, 0x92, 0x92, 0x93, 0x9D, 0x61, 0x0A, 0x74, 0xB4, 0xD9,
+		0x69, 0x12, 0x14, 0x08, 0xF1, 0xA9, 0xBB, 0xB2, 0x81, 0x8F, 0xE6, 0xA7, 0x28, 0x10, 0x8D, 0xFD,
+		0xD2, 0x8A, 0xD7, 0xD0, 0xD6, 0xD0, 0x38, 0x5A, 0x1C, 0x08, 0x9B, 0xD9, 0x01, 0x74, 0x4C, 0x8D,
+		0xCF, 0x88, 0x85, 0xDD, 0xBC, 0x95, 0xA1, 0xA8, 0x01, 0x10, 0xBB, 0xE7, 0x88, 0xBF, 0xA9, 0xF5,
+		0xFD, 0x87, 0xF9, 0x01, 0x3A, 0x04, 0x97, 0xDA, 0x01, 0x3A, 0x58, 0xCC, 0xCF, 0x8B, 0x93, 0xC1,
+		0xE3, 0xC5, 0xA5, 0x1E, 0x10, 0x8D, 0x8F, 0x88, 0x85, 0xCD, 0xC1, 0xAD, 0xC3, 0x20, 0x5A, 0x1A,
+		0x08, 0x96, 0x05, 0x1C, 0x5C, 0xEB, 0xFB, 0xEA, 0xB7, 0xD1, 0xD0, 0xA5, 0xA6, 0x26, 0x10, 0x83,
+		0xB5, 0xB8, 0xA3, 0xBE, 0xD6, 0xE0, 0xA5, 0x6A, 0x5A, 0x1B, 0x08, 0x95, 0xDA, 0x01, 0xAC, 0x5C,
+		0x97, 0xBE, 0x9A, 0x8A, 0xB0, 0x8F, 0x8F, 0xA5, 0xF8, 0x01, 0x10, 0x89, 0xB7, 0xA1, 0x99, 0xD5,
+		0xDA, 0xE8, 0xC6, 0x4A, 0x5A, 0x1A, 0x08, 0x94, 0x05, 0x39, 0x58, 0x8A, 0xF5, 0xBB, 0xAC, 0xF6,
+		0xDE, 0x99, 0xA3, 0x0F, 0x10, 0x87, 0xB5, 0x9D, 0xF8, 0xAB, 0xD5, 0x81, 0xA8, 0x4B, 0x5A, 0x1A,
+		0x08, 0x93, 0x05, 0x1C, 0x44, 0xA2, 0x8A, 0xC6, 0xD3, 0xCA, 0xAE, 0xF1, 0xA0, 0x35, 0x10, 0xB1,
+		0xD5, 0xE3, 0xAE, 0xA8, 0xEC, 0xA7, 0x9E, 0x0E, 0x4B, 0x0E, 0x00, 0xE5, 0x05, 0xE4, 0xD0, 0xCD,
+		0xF5, 0xCB, 0xBE, 0xD3, 0xA1, 0xF5, 0xA0, 0xB9, 0x01, 0x10, 0xB8, 0xAB, 0xDC, 0x83, 0x89, 0x92,
+		0x9A, 0xC0, 0x7A, 0x5A, 0x1A, 0x08, 0xE4, 0xD9, 0x69, 0x12, 0x14, 0x08, 0xE0, 0xA6, 0xAF, 0xDE,
+		0xA6, 0x85, 0xBF, 0xA4, 0x18, 0x10, 0x86, 0xC7, 0x9C, 0xE6, 0xD1, 0x91, 0xCD, 0xF0, 0x77, 0x5A,
+		0x1B, 0x08, 0xE3, 0xD9, 0x01, 0x8E, 0x48, 0xB2, 0x93, 0xEE, 0xB4, 0xA0, 0x81, 0x96, 0xA4, 0x19,
+		0x10, 0xA2, 0xDD, 0xE1, 0x86, 0x90, 0xA0, 0xC7, 0xE4, 0xB2, 0x01, 0xE3, 0x04, 0xFF, 0xDF, 0x01,
+		0x39, 0x58, 0x87, 0xEC, 0xCC, 0xE3, 0xAA, 0xC4, 0x8E, 0xA7, 0x38, 0x10, 0xA2, 0xF5, 0x85, 0xAB,
+		0xDE, 0xBD, 0xC5, 0x94, 0x79, 0x5A, 0x1C, 0x08, 0xE2, 0x25, 0x1D, 0x4C, 0x88, 0x91, 0x8B, 0x9C,
+		0x80, 0x9E, 0xEA, 0xA2, 0xB2, 0x01, 0x10, 0xA4, 0x9F, 0xAB, 0xCE, 0x94, 0xA0, 0x9C, 0xCB, 0xA2,
+		0x21, 0x74, 0x00, 0xE1, 0x05, 0x90, 0x5C, 0xB5, 0xBC, 0xF3, 0xF6, 0xDF, 0xC0, 0xBB, 0xA1, 0xB4,
+		0x01, 0x10, 0x94, 0x91, 0xE6, 0xEA, 0x95, 0xCE, 0xCD, 0xDD, 0x35, 0x5A, 0x1C, 0x08, 0xCC, 0x05,
+		0x3B, 0x4C, 0x95, 0xDC, 0xD8, 0x97, 0xA1, 0xCB, 0xC6, 0xA5, 0xD9, 0x01, 0x10, 0x9D, 0xB3, 0xC4,
+		0xE8, 0x98, 0x8A, 0xBC, 0xA9, 0xF6, 0x01, 0x3B, 0x00, 0xCB, 0x05, 0x3B, 0xD0, 0xD2, 0xD5, 0xBB,
+		0x93, 0xF6, 0xCF, 0x9E, 0xA4, 0xDC, 0x01, 0x10, 0xA7, 0xDF, 0xC1, 0x8B, 0xDB, 0x94, 0xBC, 0xE4,
+		0x72, 0x5A, 0x1A, 0x08, 0xCA, 0xD9, 0x69, 0x12, 0x14, 0x08, 0xA5, 0xB5, 0xD7, 0x8F, 0xB2, 0x8B,
+		0xF5, 0xA7, 0x5C, 0x10, 0x86, 0x8B, 0xE5, 0xFF, 0xD1, 0x87, 0xDB, 0xE3, 0x64, 0x5A, 0x1C, 0x08,
+		0xC9, 0xD9, 0x21, 0xAF, 0x4C, 0xFD, 0xAA, 0xF8, 0x8B, 0xED, 0x9D, 0x94, 0xA6, 0xDC, 0x01, 0x10,
+		0xB6, 0xDD, 0x97, 0x87, 0x96, 0xBD, 0xAE, 0xCD, 0xDF, 0x01, 0x57, 0x00, 0xC8, 0x05, 0x57, 0x48,
+		0xAE, 0x96, 0xE9, 0xB1, 0xE7, 0xED, 0xFB, 0xA5, 0x34, 0x10, 0x9B, 0xB5, 0xC7, 0xFF, 0x9D, 0xB8,
+		0xFD, 0xE2, 0xBE, 0x01, 0x1D, 0x00, 0xB3, 0x05, 0x1D, 0x5C, 0xB3, 0xA2, 0xA3, 0x94, 0xD1, 0x9E,
+		0xDA, 0xA3, 0xFD, 0x01, 0x10, 0xB2, 0xE1, 0x93, 0xCA, 0xDE, 0x81, 0xCE, 0xA8, 0x5B, 0x5A, 0x1B,
+		0x08, 0xB2, 0x05, 0x1D, 0x48, 0xC7, 0xE1, 0xD3, 0xED, 0xFF, 0xB0, 0xBE, 0xA6, 0x4B, 0x10, 0xA3,
+		0xDB, 0xC0, 0xE8, 0xC1, 0xF8, 0xDE, 0x97, 0xA0, 0x21, 0x23, 0x60, 0xB1, 0xD9, 0x69, 0x12, 0x14,
+		0x08, 0xC7, 0xDF, 0xA4, 0xBA, 0xED, 0xD1, 0xF4, 0xA7, 0x4C, 0x10, 0x93, 0xD1, 0xC8, 0xCB, 0xA2,
+		0xB5, 0xC1, 0xBF, 0x23, 0x61, 0x0A, 0x04, 0xD9, 0x69, 0x01, 0xAD, 0x54, 0x98, 0xC2, 0xFC, 0xC5,
+		0x93, 0x82, 0xA7, 0x40, 0x10, 0x93, 0xB7, 0x9B, 0xAE, 0xF8, 0xA8, 0x83, 0xE2, 0x05, 0x5A, 0x1B,
+		0x08, 0xAF, 0x05, 0x55, 0x5C, 0xD7, 0xD8, 0xE2, 0xED, 0xDA, 0xA3, 0xF3, 0xA1, 0xAA, 0x01, 0x10,
+		0xB3, 0x81, 0xB9, 0xD2, 0xEB, 0x81, 0xCC, 0xBB, 0x60, 0x5A, 0x1B, 0x08, 0x9A, 0x05, 0x1D, 0x48,
+		0xD8, 0x98, 0xF4, 0xA6, 0xDF, 0xE6, 0x90, 0xA0, 0x14, 0x10, 0xB0, 0xE7, 0xBC, 0x96, 0xA2, 0x8F,
+		0xF5, 0xE1, 0x8B, 0x61, 0x0A, 0x00, 0x99, 0x25, 0x3E, 0x4C, 0x8E, 0x99, 0xE0, 0x99, 0xA7, 0xC2,
+		0xCD, 0xA7, 0xF4, 0x01, 0x10, 0x9C, 0x9B, 0xDD, 0xAF, 0x90, 0xA2, 0xA3, 0x84, 0xCC, 0x01, 0xCA,
+		0x00, 0x98, 0x05, 0x3B, 0x4C, 0x94, 0x89, 0xCD, 0x8F, 0xFB, 0x81, 0xB8, 0xA6, 0xF2, 0x01, 0x10,
+		0xAA, 0xEF, 0x80, 0xD9, 0xA8, 0xD4, 0xD1, 0xC2, 0x45, 0x0E, 0xBC, 0x08, 0x05, 0x1D, 0x44, 0xD6,
+		0x81, 0xB4, 0xE6, 0x81, 0xBD, 0xDC, 0xA7, 0x20, 0x10, 0xB2, 0xAB, 0xC3, 0xEA, 0xD8, 0xFA, 0xA2,
+		0x85, 0x12, 0x30, 0x09, 0x00, 0x96, 0x05, 0x58, 0x4C, 0xE3, 0xD5, 0xA5, 0x9C, 0xB0, 0x86, 0xC0,
+		0xA6, 0xD4, 0x01, 0x10, 0xB4, 0x85, 0xA2, 0xD6, 0xB4, 0x9E, 0x92, 0x86, 0xCC, 0x01, 0xE8, 0x00,
+		0x9B, 0x45, 0x7D, 0x58, 0xF0, 0xFB, 0x91, 0x9F, 0xD4, 0xEB, 0xA1, 0xA6, 0x76, 0x10, 0x96, 0xB9,
+		0xA9, 0xD9, 0x90, 0xBE, 0xB1, 0x99, 0x42, 0x5A, 0x1B, 0x08, 0x99, 0x45, 0xD2, 0x48, 0xF7, 0xF8,
+		0xFE, 0x8A, 0x93, 0xC7, 0x84, 0xA2, 0x3C, 0x10, 0xAE, 0xB5, 0x9E, 0x82, 0xA6, 0xED, 0xD3, 0xCF,
+		0xA1, 0x01, 0xAF, 0x00, 0x9A, 0x65, 0xB9, 0x4C, 0x9F, 0xFA, 0xCB, 0xD9, 0xFB, 0xB6, 0x96, 0xA3,
+		0xD3, 0x01, 0x10, 0x8D, 0xB7, 0x81, 0x87, 0xFE, 0x97, 0xFA, 0x98, 0xCE, 0x01, 0xAF, 0x00, 0x92,
+		0x05, 0x3B, 0x48, 0xF3, 0xAC, 0xAD, 0xC8, 0xB9, 0x8B, 0xDA, 0xA7, 0x36, 0x10, 0xA8, 0xA7, 0xC7,
+		0xC4, 0xBD, 0xDE, 0xCF, 0xED, 0xB9, 0x01, 0x74, 0x00, 0x91, 0x05, 0x74, 0x58, 0xC9, 0xE0, 0xF2,
+		0xE0, 0xDC, 0x91, 0xE2, 0xA5, 0x05, 0x10, 0xB1, 0x9B, 0xA1, 0xCA, 0x93, 0xD6, 0xA2, 0xA4, 0x10,
+		0x5A, 0x1B, 0x08, 0x90, 0x05, 0x39, 0x5C, 0x93, 0x95, 0xC6, 0xBF, 0xF5, 0x9C, 0xA4, 0xA6, 0xA6,
+		0x01, 0x10, 0xB2, 0xAD, 0xEE, 0xB1, 0xA6, 0xE8, 0xD8, 0xFC, 0x18, 0x5A, 0x1B, 0x08, 0x8F, 0x05,
+		0x1D, 0x18, 0xC8, 0x90, 0xC2, 0xC4, 0x8B, 0xED, 0x85, 0xC1, 0xA6, 0x30, 0x83, 0x9D, 0xA0, 0xE5,
+		0xBB, 0xEF, 0xB3, 0x93, 0x0B, 0x5A, 0x1B, 0x08, 0x8E, 0x05, 0x1D, 0x48, 0xD5, 0xA7, 0xD1, 0xA6,
+		0x9C, 0xDF, 0xC6, 0xA5, 0x16, 0x10, 0x9C, 0xC3, 0xCE, 0xBF, 0xF1, 0xB0, 0xC1, 0x82, 0xD2, 0x01,
+		0x90, 0x00, 0x86, 0x05, 0x1D, 0x48, 0xA9, 0xD9, 0x98, 0xBB, 0x9C, 0xC2, 0xBD, 0xA1, 0x7B, 0x10,
+		0xB4, 0xBD, 0x83, 0x8B, 0x9E, 0xBD, 0xC2, 0xF7, 0xE5, 0x01, 0x1D, 0x00, 0x87, 0x05, 0x1D, 0x5C,
+		0x8C, 0xF4, 0xAA, 0xEA, 0xD4, 0xA0, 0xEF, 0xA7, 0xD0, 0x01, 0x10, 0xAD, 0xDD, 0xA8, 0xD6, 0xBA,
+		0xBE, 0xF1, 0xE3, 0x0C, 0x5A, 0x1C, 0x08, 0x88, 0x05, 0xE8, 0x4C, 0x9A, 0x8E, 0xD0, 0xB9, 0x8E,
+		0xA6, 0xB8, 0xA1, 0x92, 0x01, 0x10, 0xA1, 0xA5, 0x80, 0xCE, 0xA8, 0xEF, 0xA0, 0xFA, 0xDA, 0x21,
+		0x06, 0x00, 0x8D, 0x05, 0x1E, 0x4C, 0xFB, 0xB4, 0xB6, 0x95, 0x93, 0xA5, 0xC1, 0xA5, 0xED, 0x01,
+		0x10, 0x93, 0xA5, 0xC2, 0xE4, 0x84, 0xFE, 0x80, 0xBC, 0xA7, 0x01, 0xE9, 0x00, 0x8C, 0x05, 0xE9,
+		0x58, 0xF8, 0xC8, 0xAE, 0xC6, 0xA5, 0x8A, 0xCE, 0xA2, 0x7E, 0x10, 0x80, 0x99, 0xC6, 0xF8, 0xCB,
+		0x8F, 0xD9, 0xCB, 0x6F, 0x5A, 0x1B, 0x08, 0x8B, 0x05, 0x75, 0x48, 0xAB, 0xCA, 0xE3, 0xB7, 0x85,
+		0xC4, 0xDC, 0xA2, 0x6C, 0x10, 0x99, 0xE7, 0xB9, 0xE7, 0xCE, 0xC9, 0xFE, 0xF2, 0xFB, 0x01, 0x92,
+		0x00, 0x8A, 0x05, 0x1D, 0x5C, 0xB0, 0xE3, 0x8B, 0xFD, 0xA1, 0xDE, 0xDA, 0xA4, 0xDA, 0x01, 0x10,
+		0xA4, 0x97, 0x8A, 0x8A, 0xE6, 0x8F, 0x99, 0x94, 0x4C, 0x5A, 0x1B, 0x08, 0x89, 0x05, 0x1D, 0x48,
+		0xC5, 0xD3, 0xCF, 0xB8, 0xCB, 0xC0, 0xEE, 0xA2, 0x0C, 0x10, 0xA0, 0xD3, 0xBD, 0xA6, 0xB2, 0xCC,
+		0xC6, 0x83, 0xA6, 0x01, 0x73, 0x00, 0x85, 0x05, 0x73, 0x48, 0xAB, 0xBB, 0xE0, 0x88, 0xBC, 0xC2,
+		0xAD, 0xA5, 0x58, 0x10, 0xB1, 0xFB, 0xF3, 0xAA, 0xFE, 0xB8, 0x81, 0x91, 0x31, 0x81, 0xA2, 0x00,
+		0xE0, 0x81, 0x14, 0x48, 0xA4, 0xA4, 0xD7, 0xC1, 0xCC, 0xF2, 0xA3, 0xAC, 0x2B, 0x10, 0xB7, 0xB1,
+		0xB9, 0xB9, 0x95, 0xF5, 0x8A, 0x83, 0xEB, 0x01, 0x73, 0x00, 0xF8, 0x45, 0x44, 0x4C, 0xEF, 0xE4,
+		0xFA, 0xB6, 0xE0, 0xAB, 0xB5, 0xA4, 0xB4, 0x01, 0x10, 0x8B, 0xB1, 0xDB, 0x9C, 0x88, 0xCD, 0xFD,
+		0xEE, 0x39, 0x81, 0xBF, 0x00, 0xE0, 0x41, 0xF2, 0x58, 0xCE, 0xA5, 0xB3, 0xB4, 0xBA, 0xB1, 0x80,
+		0xAD, 0x3E, 0x10, 0x9A, 0xE5, 0xBE, 0xDC, 0xA2, 0x8A, 0xC0, 0xEA, 0x73, 0x5A, 0x1B, 0x08, 0xF7,
+		0x05, 0x39, 0x48, 0xBB, 0xBE, 0x9B, 0xA8, 0xE8, 0xE9, 0xCE, 0xA6, 0x2C, 0x10, 0xBF, 0xF5, 0xFD,
+		0xA1, 0xEA, 0xA1, 0xC1, 0xE8, 0xC8, 0x01, 0x8F, 0x00, 0x93, 0x05, 0x39, 0x58, 0x9D, 0xC7, 0xF5,
+		0xB2, 0x99, 0x8F, 0x87, 0xA2, 0x79, 0x10, 0xAF, 0xC5, 0x94, 0x9D, 0xCA, 0xBC, 0x82, 0xEF, 0x2A,
+		0x5A, 0x1C, 0x08, 0xF6, 0x45, 0x99, 0x4C, 0xB6, 0xF2, 0xCA, 0xEE, 0x98, 0xDE, 0xDB, 0xA1, 0xCB,
+		0x01, 0x10, 0x8B, 0xD5, 0xAD, 0x8F, 0xED, 0xDD, 0xC3, 0x94, 0xEC, 0x01, 0x3A, 0x70, 0xF5, 0xD9,
+		0x69, 0x12, 0x14, 0x08, 0xD9, 0xD7, 0xD7, 0x91, 0xC1, 0xD1, 0xD7, 0xA4, 0x35, 0x10, 0x9A, 0xFF,
+		0x8A, 0x9F, 0xBB, 0xFC, 0xB9, 0x87, 0x55, 0x5A, 0x1B, 0x08, 0xED, 0x05, 0x73, 0x5C, 0xEF, 0xCE,
+		0xC3, 0xDF, 0xF8, 0xE3, 0x9D, 0xA3, 0xAE, 0x01, 0x10, 0xBC, 0xDB, 0xF1, 0xA8, 0xAC, 0xFD, 0xFD,
+		0xA9, 0x46, 0x5A, 0x1B, 0x08, 0xEE, 0x05, 0x1D, 0x5C, 0xC7, 0x91, 0x8C, 0xE3, 0x8A, 0xEF, 0xA8,
+		0xA0, 0xC5, 0x01, 0x10, 0xB4, 0xD1, 0xB2, 0xC2, 0x86, 0x9E, 0x98, 0x97, 0x7D, 0x5A, 0x1B, 0x08,
+		0xEF, 0x05, 0x1D, 0x44, 0xCC, 0x8D, 0xD6, 0xC1, 0xF2, 0xCF, 0xE5, 0xA2, 0x5A, 0x10, 0x90, 0x83,
+		0xF9, 0x91, 0x95, 0x81, 0xAB, 0xE6, 0xA5, 0x17, 0x74, 0xF4, 0xD9, 0x69, 0x12, 0x14, 0x08, 0xD0,
+		0xC4, 0xC2, 0xEC, 0x83, 0x8C, 0xE0, 0xA4, 0x33, 0x10, 0xBA, 0xC3, 0xAD, 0xF9, 0x94, 0xAF, 0xE8,
+		0xB8, 0x3C, 0x5A, 0x1C, 0x08, 0xF3, 0xD9, 0x81, 0x85, 0x4C, 0xC3, 0x91, 0xEA, 0x98, 0x80, 0xB7,
+		0xC5, 0xA3, 0xD2, 0x01, 0x10, 0x80, 0xDB, 0xD5, 0x91, 0xA9, 0xEF, 0x80, 0x92, 0x96, 0x21, 0x3D,
+		0x00, 0xF2, 0x05, 0x57, 0x48, 0xC4, 0xE5, 0xC7, 0xC3, 0xF6, 0xA4, 0xB8, 0xA7, 0x23, 0x10, 0x94,
+		0xDB, 0xAF, 0xBE, 0x8F, 0xCB, 0xBE, 0xA8, 0xD9, 0x01, 0xCA, 0x70, 0xF1, 0xD9, 0x69, 0x12, 0x14,
+		0x08, 0xD8, 0xCE, 0xEA, 0xB0, 0x86, 0xB9, 0x8C, 0xA3, 0x68, 0x10, 0x84, 0xE7, 0xC9, 0xA5, 0x81,
+		0xC7, 0xB1, 0x91, 0x4D, 0x5A, 0x1B, 0x08, 0xF0, 0x05, 0x39, 0x48, 0xAA, 0xC7, 0x87, 0x83, 0xE7,
+		0xC2, 0xB7, 0xA7, 0x22, 0x10, 0xAA, 0x85, 0x98, 0x83, 0xBD, 0xC2, 0xEC, 0xA9, 0x82, 0x41, 0x5D,
+		0x00, 0xEC, 0x05, 0x74, 0x4C, 0x9B, 0xD3, 0xDB, 0xDF, 0xA1, 0xA9, 0xF3, 0xA5, 0xD4, 0x01, 0x10,
+		0x90, 0xBF, 0xE3, 0x8F, 0xAD, 0xED, 0xC3, 0xAC, 0xC9, 0x01, 0x74, 0x00, 0xE9, 0x05, 0x3B, 0x5C,
+		0x8A, 0xE7, 0x89, 0xD1, 0xF4, 0xB0, 0xC3, 0xA2, 0xFE, 0x01, 0x10, 0x88, 0xC9, 0xCB, 0xAE, 0xE1,
+		0x8D, 0x81, 0xE4, 0x37, 0x5A, 0x1C, 0x08, 0xE7, 0x05, 0x3B, 0x4C, 0xFD, 0x90, 0x8E, 0xA4, 0xC7,
+		0xB5, 0xD8, 0xA5, 0xF2, 0x01, 0x10, 0xBE, 0xE3, 0xB7, 0xE3, 0x95, 0xCF, 0xE2, 0x88, 0xDD, 0x01,
+		0x92, 0x70, 0xE8, 0xD9, 0x69, 0x12, 0x14, 0x08, 0x8F, 0x9C, 0xE0, 0xE1, 0xE9, 0xD2, 0x98, 0xA6,
+		0x76, 0x10, 0x8F, 0xFF, 0x9D, 0x8B, 0x9E, 0x8D, 0xD1, 0xF7, 0x10, 0x5A, 0x1C, 0x08, 0xE0, 0x05,
+		0x3A, 0x48, 0xDC, 0xD6, 0xF3, 0xD0, 0xEF, 0x89, 0xF7, 0xA4, 0xF7, 0x01, 0x10, 0x8E, 0x93, 0xD9,
+		0xB6, 0xF2, 0xBC, 0xEF, 0xB9, 0x12, 0x5F, 0x0D, 0x00, 0xDF, 0x05, 0x75, 0x48, 0xA5, 0xE3, 0xA7,
+		0x83, 0xDB, 0xDF, 0xD8, 0xA5, 0x7F, 0x10, 0xA8, 0xA9, 0x89, 0x97, 0x82, 0x8A, 0xBC, 0x9C, 0xE8,
+		0x01, 0x92, 0x00, 0xDE, 0x05, 0x1D, 0x48, 0x91, 0x80, 0x8D, 0xE1, 0xBF, 0xB2, 0xA3, 0xA1, 0x0B,
+		0x10, 0x91, 0xD5, 0x8C, 0xBB, 0xB2, 0xB1, 0xB1, 0xCD, 0x86, 0x01, 0x1D, 0x00, 0xDD, 0x05, 0x1D,
+		0x44, 0xD8, 0x9C, 0xF4, 0xB8, 0xC8, 0xA0, 0xC7, 0xA6, 0x4F, 0x10, 0xAE, 0xB7, 0x90, 0x9C, 0xF3,
+		0xFB, 0x97, 0xB0, 0x12, 0x97, 0x09, 0x00, 0xDC, 0x05, 0x1D, 0xD0, 0x8F, 0xC1, 0xCF, 0xD7, 0xDC,
+		0x96, 0x92, 0xA0, 0xF1, 0x01, 0x10, 0x97, 0xED, 0xBE, 0xA5, 0xFB, 0x97, 0xB4, 0xD0, 0x34, 0x5A,
+		0x1A, 0x08, 0xD4, 0xD9, 0x69, 0x12, 0x14, 0x08, 0x85, 0x8C, 0xAB, 0x8A, 0xE3, 0xB5, 0xEF, 0xA0,
+		0x03, 0x10, 0x80, 0xE3, 0xA6, 0xF7, 0xAE, 0xCB, 0x94, 0x81, 0x17, 0x5A, 0x1B, 0x08, 0xD5, 0xD9,
+		0x41, 0xD3, 0x48, 0xCA, 0xA0, 0x90, 0xF0, 0x87, 0x9F, 0xA3, 0xA5, 0xCA, 0x01, 0x10, 0x8E, 0xF3,
+		0xA1, 0xDF, 0xD2, 0x8B, 0xD4, 0xF5, 0x0E, 0xF2, 0x0A, 0x00, 0xD6, 0x05, 0x56, 0x48, 0xBD, 0xFF,
+		0xFD, 0xFA, 0xEA, 0xBB, 0xEE, 0xA0, 0x35, 0x10, 0x82, 0xCD, 0xB0, 0xE7, 0xCC, 0xFB, 0xDA, 0xB7,
+		0x8F, 0x21, 0x5D, 0x00, 0xDB, 0x05, 0xE8, 0x18, 0xA6, 0xBE, 0xE9, 0x84, 0x97, 0x82, 0xF3, 0x61,
+		0x63, 0x20, 0x96, 0x85, 0xD1, 0xA0, 0xD2, 0xC2, 0xBE, 0x9F, 0xDF, 0x01, 0x1E, 0x00, 0xDA, 0x05,
+		0x1E, 0x4C, 0xC7, 0xB8, 0x8B, 0x93, 0xC2, 0xCA, 0x81, 0xA0, 0xD3, 0x01, 0x10, 0x89, 0xC9, 0xCA,
+		0xE6, 0xB2, 0x8C, 0x9A, 0x91, 0xF2, 0x01, 0xCC, 0x00, 0xD9, 0x05, 0x59, 0x5C, 0x96, 0xDF, 0xA4,
+		0xA0, 0xBF, 0xC9, 0xBE, 0xA1, 0x93, 0x01, 0x10, 0xA3, 0xF1, 0x85, 0xC2, 0x83, 0xF8, 0xC6, 0xA0,
+		0x43, 0x5A, 0x1B, 0x08, 0xD8, 0x05, 0x1D, 0x48, 0xDC, 0xD5, 0xB8, 0x94, 0xF5, 0x8F, 0xD4, 0xA3,
+		0xED, 0x01, 0x10, 0x9F, 0xAB, 0xB5, 0xE8, 0x97, 0xEF, 0xE1, 0x95, 0x01, 0x3A, 0x00, 0xD7, 0x05,
+		0x1D, 0x44, 0xF5, 0xBF, 0xB5, 0xEB, 0x9F, 0xF9, 0xD9, 0xA3, 0x0C, 0x10, 0xB6, 0xED, 0xE0, 0x8D,
+		0xE5, 0xA8, 0x9B, 0xD2, 0x12, 0x6B, 0x0C, 0x00, 0xD3, 0x05, 0x1D, 0x5C, 0xD6, 0xBE, 0xAD, 0x87,
+		0x96, 0xDA, 0xD0, 0xA0, 0x92, 0x01, 0x10, 0xB9, 0xD3, 0xB7, 0xEE, 0xCB, 0xDF, 0xC3, 0xD4, 0x0F,
+		0x5A, 0x1B, 0x08, 0xD0, 0x05, 0x1D, 0x5C, 0x9B, 0x99, 0x95, 0xE6, 0xEC, 0xFD, 0xB0, 0xA0, 0xB1,
+		0x01, 0x10, 0xA9, 0xAB, 0xB9, 0xE2, 0xA4, 0xFE, 0xA5, 0x81, 0x29, 0x5A, 0x1B, 0x08, 0xCE, 0x05,
+		0x1D, 0xD0, 0x9D, 0x8C, 0xE4, 0x87, 0xB1, 0xDB, 0xF6, 0xA5, 0xA2, 0x01, 0x10, 0x99, 0xC5, 0xAD,
+		0xC4, 0xF5, 0xFE, 0xF4, 0xAE, 0x0C, 0x5A, 0x1A, 0x08, 0xCF, 0xD9, 0x69, 0x12, 0x14, 0x08, 0xBE,
+		0xAC, 0xCD, 0x8C, 0x8B, 0xA2, 0xC9, 0xA6, 0x7D, 0x10, 0x8D, 0xE3, 0x96, 0xE1, 0xED, 0xD3, 0xCB,
+		0xE3, 0x51, 0x5A, 0x1A, 0x08, 0xC7, 0xD9, 0x01, 0x1C, 0xC8, 0x9A, 0xB9, 0xF9, 0xD2, 0x96, 0xA0,
+		0xE3, 0xA7, 0x46, 0x10, 0x84, 0x91, 0xFA, 0xD3, 0xC9, 0xFE, 0xEF, 0x86, 0x3D, 0x5A, 0x1A, 0x08,
+		0xC6, 0xD9, 0x69, 0x12, 0x14, 0x08, 0xEE, 0x9C, 0xCF, 0x82, 0xDD, 0xFD, 0xC8, 0xA0, 0x6B, 0x10,
+		0x83, 0xB9, 0xF2, 0xE4, 0x82, 0xEA, 0xE0, 0xBF, 0x2A, 0x5A, 0x1B, 0x08, 0xC5, 0x05, 0x71, 0x5C,
+		0xA6, 0x8C, 0xCF, 0xE9, 0x9C, 0xE8, 0xD2, 0xA3, 0xC9, 0x01, 0x10, 0x97, 0xE9, 0xCF, 0xBB, 0x93,
+		0xF6, 0xA4, 0xB0, 0x58, 0x5A, 0x1B, 0x08, 0xC4, 0x05, 0x1D, 0x48, 0x9A, 0x85, 0xF5, 0xD9, 0xF9,
+		0xA2, 0xC4, 0xA4, 0x68, 0x10, 0x98, 0xD1, 0xA6, 0xE7, 0xCD, 0xBD, 0xD9, 0xF0, 0xD2, 0x41, 0x7C,
+		0x70, 0xC3, 0xD9, 0x69, 0x12, 0x14, 0x08, 0xA2, 0xB7, 0xCE, 0xA3, 0xD9, 0xFF, 0xB0, 0xA3, 0x22,
+		0x10, 0xB1, 0xED, 0xE2, 0x8E, 0xB3, 0x90, 0xF8, 0x90, 0x5E, 0x5A, 0x1B, 0x08, 0xBB, 0x05, 0x39,
+		0x5C, 0xDE, 0xE0, 0x92, 0xCF, 0xEC, 0xBE, 0x86, 0xA4, 0xC0, 0x01, 0x10, 0x9E, 0xB1, 0xEA, 0xE9,
+		0xDD, 0xD1, 0xDD, 0xA2, 0x37, 0x5A, 0x1B, 0x08, 0xBC, 0x05, 0x1D, 0x48, 0xE0, 0xF3, 0xD1, 0xF9,
+		0xD1, 0xF4, 0x92, 0xA5, 0x25, 0x10, 0x96, 0xE7, 0xA1, 0x9D, 0xDF, 0xAC, 0xB2, 0xA0, 0xA8, 0x01,
+		0x56, 0xE0, 0xBD, 0xD9, 0x69, 0x12, 0x14, 0x08, 0x99, 0x91, 0x82, 0xD7, 0xDF, 0xB8, 0x9F, 0xA6,
+		0x7F, 0x10, 0xB2, 0x91, 0xB1, 0xEA, 0x90, 0xFC, 0xC9, 0x93, 0x1F, 0x5A, 0x1A, 0x08, 0xC2, 0xD9,
+		0x69, 0x12, 0x14, 0x08, 0x9F, 0xB7, 0xC0, 0x88, 0xAE, 0x8D, 0xD5, 0xA5, 0x5D, 0x10, 0xBB, 0xF7,
+		0xAC, 0xC8, 0xD8, 0xAC, 0xEE, 0xB7, 0x0F, 0x5A, 0x1C, 0x08, 0xC1, 0x25, 0xE8, 0x1C, 0xF8, 0xA7,
+		0x8D, 0xAA, 0x8D, 0x86, 0xC6, 0xA1, 0x81, 0x2D, 0x1C, 0xB1, 0x95, 0xA4, 0xDE, 0x99, 0x89, 0x89,
+		0xD3, 0x41, 0x06, 0x00, 0xC0, 0x05, 0x1E, 0x4C, 0xB2, 0xFD, 0xE3, 0x8C, 0x97, 0xB5, 0x8A, 0xA3,
+		0xBF, 0x01, 0x10, 0x88, 0xE7, 0x90, 0xE0, 0x97, 0xB9, 0xB3, 0xD9, 0xB6, 0x01, 0x1E, 0x00, 0xBF,
+		0x05, 0x1E, 0xD0, 0x87, 0xB1, 0x98, 0xAD, 0xEB, 0x9A, 0xA1, 0xA5, 0xF1, 0x01, 0x10, 0x83, 0x8D,
+		0xA5, 0xB1, 0x8C, 0x82, 0xBA, 0xFC, 0xC3, 0x01, 0x5A, 0x19, 0x08, 0xBE, 0xD9, 0x69, 0x12, 0x13,
+		0x08, 0xFE, 0xB2, 0xBF, 0x8F, 0x96, 0xEA, 0xE9, 0x26, 0x10, 0xAA, 0x87, 0xCB, 0xCC, 0xDE, 0x8B,
+		0xA3, 0xB4, 0x21, 0x5A, 0x1B, 0x08, 0xBA, 0xD9, 0x41, 0xB5, 0x44, 0xC1, 0x81, 0xB8, 0xAD, 0x93,
+		0xE6, 0xED, 0xA1, 0x4A, 0x10, 0x95, 0xD3, 0xAE, 0xE2, 0xBC, 0xBB, 0xA2, 0xD2, 0x65, 0x45, 0x00,
+		0xB7, 0x05, 0xE7, 0x44, 0xD7, 0xE7, 0x8C, 0xC4, 0xFB, 0xCC, 0xF1, 0xA7, 0x37, 0x10, 0x8F, 0xFD,
+		0xDB, 0x96, 0xD9, 0x87, 0xA4, 0xE8, 0x65, 0xB9, 0x5C, 0xB5, 0xD9, 0x69, 0x12, 0x14, 0x08, 0xE6,
+		0x83, 0xA0, 0x80, 0x97, 0xED, 0xD4, 0xA1, 0x15, 0x10, 0xA2, 0x81, 0xDA, 0x9B, 0xD1, 0xBA, 0xE8,
+		0xCF, 0xE1, 0x00, 0x00, 0xB6, 0x05, 0x39, 0x4C, 0xAC, 0x8C, 0xDF, 0xDE, 0xB4, 0x8C, 0xF4, 0xA0,
+		0x98, 0x01, 0x10, 0xB4, 0xAF, 0xE4, 0xC8, 0xFA, 0xAD, 0xF9, 0xDB, 0x55, 0x0E, 0xD9, 0x0B, 0x74,
+		0xD9, 0x69, 0x12, 0x14, 0x08, 0xB8, 0xB0, 0xAE, 0xEA, 0xEF, 0xA4, 0xC1, 0xA0, 0x03, 0x10, 0x8D,
+		0xC1, 0xE7, 0x80, 0x81, 0x8D, 0xC5, 0xC8, 0x12, 0x5A, 0x1A, 0x08, 0xAD, 0xD9, 0x69, 0x21, 0x20,
+		0x40, 0xB0, 0x9C, 0xB7, 0xD0, 0xC0, 0xD3, 0xA6, 0x78, 0x10, 0x8B, 0xF3, 0xB6, 0xA8, 0x98, 0xAB,
+		0xB6, 0xF0, 0x0E, 0x6E, 0x0E, 0x00, 0xAB, 0x05, 0x55, 0x18, 0xE6, 0xAF, 0x97, 0xBB, 0xAB, 0xFF,
+		0xE2, 0x0E, 0x39, 0x0F, 0x30, 0xAB, 0xD3, 0x84, 0x8D, 0xCB, 0xC8, 0x9B, 0xB1, 0x7F, 0x5A, 0x1C,
+		0x08, 0xAA, 0x25, 0x01, 0x18, 0x9A, 0xA8, 0xD9, 0xC2, 0xFC, 0xF1, 0xCB, 0xE1, 0x1B, 0x20, 0xAC,
+		0x93, 0xC8, 0xC9, 0x9C, 0xBF, 0xC3, 0xF8, 0xF8, 0x21, 0x93, 0x08, 0xA2, 0xD9, 0x69, 0xA1, 0xC1,
+		0x40, 0x9B, 0xB3, 0xE6, 0xB7, 0xA2, 0xA2, 0xA4, 0x02, 0x10, 0xB0, 0x8F, 0xB5, 0xF8, 0xF7, 0xB9,
+		0xC7, 0xC5, 0x41, 0xB0, 0x00, 0xA3, 0x05, 0x57, 0x48, 0xDE, 0x87, 0x94, 0xB3, 0x9F, 0xD1, 0xBC,
+		0xA1, 0x65, 0x10, 0xAF, 0xA1, 0xFB, 0xC0, 0xE0, 0xBA, 0xC1, 0xFC, 0xC2, 0x61, 0x24, 0x00, 0xA4,
+		0x05, 0x1D, 0x64, 0xCF, 0xB8, 0xEE, 0xB1, 0x9D, 0xEB, 0xF1, 0xA6, 0x9C, 0x01, 0x10, 0x86, 0xC7,
+		0xC5, 0xB7, 0xB8, 0xBF, 0xA9, 0xE8, 0x21, 0x5A, 0x1A, 0x08, 0xA9, 0xD9, 0x69, 0x01, 0x56, 0x54,
+		0xC5, 0xD0, 0xB2, 0xA8, 0xF2, 0xA3, 0xA7, 0x5E, 0x10, 0x89, 0x87, 0x8D, 0xB3, 0x86, 0xAF, 0x9A,
+		0xF9, 0x5B, 0x5A, 0x1C, 0x08, 0xA8, 0x05, 0x90, 0x48, 0xA6, 0x81, 0x80, 0xA5, 0xC5, 0x9B, 0xAB,
+		0xA2, 0xEC, 0x01, 0x10, 0x9E, 0x8B, 0x90, 0xFA, 0x8A, 0xDB, 0xF1, 0xDC, 0x65, 0x7B, 0x00, 0xA7,
+		0x05, 0x57, 0xD0, 0xD7, 0x85, 0xD9, 0x88, 0x92, 0x99, 0xE2, 0xA0, 0xE4, 0x01, 0x10, 0x80, 0x81,
+		0x8C, 0xFB, 0x94, 0xC2, 0xA0, 0x9D, 0x53, 0x5A, 0x1A, 0x08, 0xA6, 0xD9, 0x69, 0x12, 0x14, 0x08,
+		0x89, 0xD9, 0xA1, 0xA9, 0x98, 0x8E, 0x89, 0xA1, 0x5C, 0x10, 0x80, 0xC7, 0xC5, 0xB8, 0xA4, 0x8C,
+		0xB3, 0xC7, 0x28, 0x5A, 0x1B, 0x08, 0xA5, 0xD9, 0x21, 0xAF, 0x48, 0xFE, 0x9C, 0xA2, 0xD3, 0xFE,
+		0x83, 0xC4, 0xA2, 0x76, 0x10, 0x89, 0x8D, 0xBE, 0x8A, 0xAE, 0x80, 0x87, 0xC7, 0xA3, 0x01, 0xAD,
+		0x00, 0xA1, 0x05, 0x56, 0x48, 0xDC, 0xDC, 0xDE, 0xDB, 0xB1, 0xAF, 0x94, 0xA4, 0x24, 0x10, 0xBD,
+		0xB9, 0xDF, 0xAA, 0xEF, 0xA3, 0x9B, 0x94, 0xE7, 0x41, 0x22, 0x00, 0x9E, 0x05, 0x91, 0x18, 0x9D,
+		0xB2, 0xAF, 0xD2, 0xBF, 0x98, 0xB0, 0x81, 0xD7, 0x20, 0x9E, 0xDB, 0xF7, 0xC2, 0xC7, 0xAE, 0xEE,
+		0x91, 0x9F, 0x01, 0x1E, 0x00, 0x9C, 0x05, 0x1E, 0x4C, 0xDC, 0xD6, 0x95, 0xA0, 0xBE, 0xDD, 0xF4,
+		0xA5, 0xE3, 0x01, 0x10, 0x92, 0xE3, 0xBC, 0xD5, 0xCE, 0x9E, 0xDF, 0xF2, 0x95, 0x21, 0x3F, 0x5C,
+		0x9D, 0xD9, 0x69, 0x12, 0x14, 0x08, 0xE3, 0xFE, 0x8C, 0x9C, 0xA0, 0xE3, 0x9D, 0xA5, 0x33, 0x10,
+		0x93, 0xD7, 0xE2, 0xA8, 0xBA, 0x85, 0xD6, 0xE2, 0x41, 0x41, 0x00, 0x84, 0x12, 0x02, 0x08, 0x48,
+		0xAD, 0xB1, 0xE9, 0xE8, 0xA8, 0xE5, 0xDC, 0xA5, 0x77, 0x10, 0xBC, 0xE9, 0xC6, 0xEF, 0x9F, 0xCB,
+		0xE1, 0x8E, 0xDD, 0x01, 0x92, 0x00, 0xEB, 0x05, 0x92, 0x18, 0xA8, 0xE5, 0x91, 0x8D, 0xE2, 0xD9,
+		0xAD, 0x81, 0x29, 0x30, 0x94, 0xCF, 0x9F, 0x90, 0x9F, 0x9A, 0xA0, 0x90, 0x54, 0x5A, 0x1B, 0x08,
+		0xD2, 0x05, 0x1D, 0x44, 0xA0, 0xA5, 0xE4, 0xB6, 0xF1, 0xAB, 0xA1, 0xA4, 0x57, 0x10, 0xA1, 0x8B,
+		0xAC, 0xF4, 0xAD, 0x91, 0xF0, 0xAA, 0x12, 0x45, 0x12, 0x00, 0xB9, 0x05, 0x91, 0x4C, 0xB7, 0xF2,
+		0xDC, 0xB6, 0xFD, 0xF0, 0xAE, 0xA0, 0xCE, 0x01, 0x10, 0x87, 0xA5, 0xC8, 0xD2, 0xEC, 0xC4, 0xE1,
+		0xAD, 0xBC, 0x01, 0xAF, 0x00, 0xA0, 0x05, 0x1E, 0x44, 0xB4, 0xA5, 0x90, 0xC1, 0xA5, 0xD6, 0xB7,
+		0xA7, 0xE4, 0x01, 0x10, 0xB9, 0x81, 0x81, 0x8E, 0xCF, 0xB4, 0xE0, 0x09, 0xAF, 0x00, 0x80, 0x12,
+		0x78, 0x08, 0x5C, 0xC1, 0xE4, 0xC5, 0xF4, 0x96, 0xB7, 0xCD, 0xA1, 0x5C, 0x10, 0xBE, 0xAD, 0x86,
+		0xD0, 0xDA, 0xFB, 0xA0, 0x9C, 0x0B, 0x5A, 0x1C, 0x08, 0x9D, 0xE0, 0xE1, 0x3C, 0x4C, 0xC0, 0x9B,
+		0xB1, 0xD4, 0xD3, 0x8C, 0x9B, 0xA9, 0xFA, 0x01, 0x10, 0x98, 0xB1, 0xDF, 0x86, 0x85, 0xB8, 0xC4,
+		0xCD, 0xCE, 0x01, 0xE9, 0x00, 0x82, 0x05, 0x3A, 0x44, 0x87, 0xDC, 0x96, 0xF5, 0xB8, 0xA5, 0x87,
+		0xA5, 0x7B, 0x10, 0xAB, 0xF5, 0xA2, 0xBF, 0xFE, 0xE2, 0xDF, 0x8C, 0x0E, 0xE2, 0x0C, 0x70, 0xFF,
+		0xD9, 0x69, 0x12, 0x14, 0x08, 0xDB, 0x8F, 0xDC, 0xFF, 0x8E, 0xD6, 0xA6, 0xA1, 0x1C, 0x10, 0x98,
+		0xA5, 0xE8, 0x82, 0xFB, 0xC7, 0xE9, 0xA5, 0x1B, 0x5A, 0x1C, 0x08, 0x9C, 0x05, 0x56, 0x4C, 0xA4,
+		0xC2, 0xD8, 0xC1, 0xB9, 0xEC, 0xB6, 0xAB, 0x89, 0x01, 0x10, 0x8F, 0xC5, 0xC2, 0xC7, 0xBD, 0x8B,
+		0xAC, 0xAC, 0xD1, 0x01, 0x56, 0x00, 0x81, 0x05, 0x56, 0x58, 0xDA, 0x80, 0xE8, 0xB8, 0x8A, 0xDF,
+		0xF6, 0xA4, 0x62, 0x10, 0xAC, 0xBF, 0xAA, 0x91, 0xC8, 0x95, 0xFF, 0xD2, 0x75, 0x5A, 0x1C, 0x08,
+		0xFE, 0x05, 0xCA, 0x20, 0xC6, 0x88, 0xFD, 0xA9, 0xEE, 0xFA, 0xA2, 0xA6, 0xA7, 0xC1, 0x35, 0x18,
+		0xBC, 0xF1, 0xCE, 0xA3, 0xE0, 0xDC, 0xF5, 0x01, 0x3A, 0x00, 0x9B, 0x12, 0xB3, 0x08, 0x44, 0xFC,
+		0x95, 0xD9, 0xA3, 0x9D, 0xED, 0x81, 0xAF, 0x4B, 0x10, 0x87, 0xB3, 0xD2, 0xDD, 0x82, 0x9B, 0x89,
+		0xDA, 0x0E, 0x69, 0x0B, 0x00, 0xFD, 0x25, 0x3F, 0x4C, 0x89, 0x86, 0x9F, 0xA5, 0xCF, 0xF0, 0xB0,
+		0xA4, 0x92, 0x01, 0x10, 0xB7, 0x93, 0xE5, 0x8D, 0x9F, 0x86, 0xFA, 0xA0, 0x35, 0x0E, 0x05, 0x0F,
+		0x05, 0x39, 0x58, 0x99, 0xB7, 0xB6, 0xA5, 0xF7, 0xB7, 0xB2, 0xAC, 0x2C, 0x10, 0x84, 0xE7, 0x8D,
+		0xC3, 0x89, 0xBD, 0xF0, 0xB5, 0x3D, 0x5A, 0x1C, 0x08, 0xFC, 0x05, 0x73, 0x4C, 0x92, 0x91, 0xD7,
+		0xC5, 0xFD, 0xF9, 0xD0, 0xA5, 0xE8, 0x01, 0x10, 0x94, 0x8B, 0xD4, 0xEE, 0xAF, 0x93, 0xBB, 0xB4,
+		0xB6, 0x21, 0xB3, 0x04, 0x99, 0xE0, 0x41, 0x62, 0x5C, 0xF9, 0xFF, 0x8E, 0xDF, 0xB9, 0xC6, 0xDA,
+		0xAB, 0xAC, 0x01, 0x10, 0xA0, 0x93, 0xF0, 0xD1, 0x96, 0xC3, 0xD5, 0xE0, 0x2D, 0x5A, 0x1B, 0x08,
+		0xFB, 0x05, 0x74, 0x5C, 0xD9, 0xFE, 0xAB, 0xC9, 0xCC, 0x97, 0x8C, 0xA6, 0x88, 0x01, 0x10, 0xAD,
+		0xCD, 0x8C, 0xBF, 0xB0, 0xE7, 0xD4, 0xF1, 0x5D, 0x5A, 0x1A, 0x08, 0x98, 0x05, 0x74, 0xC8, 0xE3,
+		0xD9, 0xA8, 0x90, 0x90, 0xF8, 0xE4, 0xAB, 0x6B, 0x10, 0xAD, 0xE7, 0xED, 0x9B, 0xCA, 0x8F, 0xBB,
+		0x83, 0x2C, 0x5A, 0x1A, 0x08, 0xFA, 0xD9, 0x69, 0x12, 0x14, 0x08, 0xDF, 0xD7, 0xAA, 0xBC, 0xE9,
+		0x82, 0xEA, 0xA4, 0x74, 0x10, 0xB6, 0xB5, 0x90, 0xEF, 0xCC, 0xB2, 0xD3, 0x88, 0x2F, 0x5A, 0x1A,
+		0x08, 0x97, 0x05, 0x38, 0x58, 0x97, 0x8A, 0xAE, 0xB5, 0xC9, 0x8B, 0xEF, 0xAF, 0x49, 0x10, 0xBD,
+		0xBF, 0xBE, 0x9E, 0xD7, 0x8F, 0x9B, 0x9C, 0x57, 0x5A, 0x1B, 0x08, 0xF9, 0x05, 0x71, 0x4C, 0xD3,
+		0xD5, 0xBA, 0xDE, 0x99, 0xBE, 0xE9, 0xA6, 0xA8, 0x01, 0x10, 0xBE, 0xA7, 0xF8, 0xD0, 0x86, 0x8F,
+		0xD8, 0x82, 0x11, 0x0E, 0x02, 0x0F, 0x09, 0x39, 0x54, 0x8B, 0xB6, 0x97, 0xE1, 0xB8, 0xBC, 0xAC,
+		0x0A, 0x10, 0x98, 0xB3, 0xE0, 0xA5, 0x97, 0x86, 0x8E, 0xF8, 0x42, 0x5A, 0x1B, 0x08, 0xF3, 0x12,
+		0x93, 0x10, 0x18, 0xD4, 0xEB, 0xA2, 0xBC, 0xD9, 0xD0, 0xE5, 0x0E, 0xE2, 0x0D, 0x30, 0xAD, 0xE7,
+		0x97, 0xD2, 0xF4, 0xC9, 0xF6, 0xA8, 0x79, 0x5A, 0x1B, 0x08, 0xAC, 0x05, 0x56, 0x5C, 0xDC, 0x97,
+		0x91, 0xB7, 0xA4, 0x91, 0xFA, 0xA3, 0xAF, 0x01, 0x10, 0x84, 0xDB, 0xE7, 0xBA, 0xD8, 0xD0, 0xF6,
+		0x91, 0x1D, 0x5A, 0x1C, 0x08, 0xB9, 0x12, 0x7F, 0x12, 0x4C, 0xD6, 0xE8, 0x89, 0x9A, 0xB7, 0x82,
+		0x8C, 0xA2, 0x88, 0x01, 0x10, 0xAF, 0xA5, 0xDA, 0xC3, 0x80, 0xA4, 0xD5, 0xEC, 0xDF, 0x21, 0x1F,
+		0x04, 0xFC, 0xDB, 0x21, 0x1F, 0x5C, 0xB7, 0xAD, 0xAD, 0x97, 0xBD, 0xA0, 0xF5, 0xA1, 0x83, 0x01,
+		0x10, 0xBF, 0xF1, 0xCF, 0x8A, 0xCE, 0xB9, 0xF8, 0xB2, 0x49, 0x5A, 0x1C, 0x08, 0xFB, 0x12, 0xC4,
+		0x1D, 0x4C, 0xC5, 0x92, 0xD0, 0xA5, 0xED, 0xD1, 0xA1, 0xA7, 0x92, 0x01, 0x10, 0x8D, 0xFB, 0xF1,
+		0xFA, 0xAE, 0xEB, 0x8D, 0x99, 0xE3, 0x41, 0xB5, 0x00, 0x83, 0x05, 0x59, 0x4C, 0xB5, 0xDD, 0x90,
+		0xB9, 0xF3, 0xE7, 0xF6, 0xA4, 0xB5, 0x01, 0x10, 0x84, 0xBD, 0xBE, 0xCC, 0xB6, 0xA0, 0xF3, 0x88,
+		0xDC, 0x01, 0x59, 0x00, 0x82, 0x12, 0xF1, 0x11, 0x5C, 0xA4, 0x98, 0xA0, 0xCE, 0xA5, 0xC8, 0xCB,
+		0xA4, 0xFE, 0x01, 0x10, 0x82, 0xA5, 0xEB, 0xB2, 0xAD, 0xCE, 0xB7, 0xCF, 0x78, 0x5A, 0x1A, 0x08,
+		0x81, 0x12, 0xF0, 0x10, 0x58, 0x8E, 0xE9, 0xB3, 0xAC, 0xFD, 0x94, 0x89, 0xA1, 0x06, 0x10, 0xA0,
+		0xA5, 0xF9, 0xF4, 0x9D, 0xE7, 0xFC, 0xD4, 0x26, 0x5A, 0x1B, 0x08, 0x80, 0x05, 0x39, 0x5C, 0xE4,
+		0xA7, 0xFD, 0xFC, 0xC0, 0x9E, 0x83, 0xA2, 0x86, 0x01, 0x10, 0xAE, 0xC3, 0x98, 0xF2, 0xDD, 0xD3,
+		0xAD, 0x85, 0x4A, 0x5A, 0x1B, 0x08, 0xFF, 0x05, 0xAF, 0x5C, 0xBC, 0x9A, 0xC3, 0x95, 0xC3, 0xF8,
+		0x91, 0xA1, 0xDB, 0x01, 0x10, 0xA8, 0xC9, 0xB5, 0xAE, 0xBB, 0x90, 0xCA, 0x89, 0x34, 0x5A, 0x1B,
+		0x08, 0xFE, 0x05, 0x1D, 0x48, 0xEC, 0xD3, 0xD0, 0xF5, 0xFE, 0x9C, 0xD7, 0xA0, 0x45, 0x10, 0x99,
+		0xC3, 0xEF, 0xB8, 0xC6, 0xD9, 0xCA, 0xDB, 0xB4, 0x41, 0x7B, 0x00, 0xA3, 0x05, 0x73, 0x44, 0x9F,
+		0xF5, 0xF9, 0x8E, 0xAA, 0x89, 0xBE, 0xA7, 0x3B, 0x10, 0x81, 0xF9, 0xBE, 0xFA, 0x93, 0xC1, 0xE6,
+		0xED, 0x0E, 0xA0, 0x16, 0x00, 0x8E, 0x05, 0x73, 0x48, 0xCB, 0xEA, 0xAC, 0xB8, 0xD2, 0xD3, 0x89,
+		0xA5, 0x06, 0x10, 0xB1, 0xCF, 0xE7, 0x8C, 0xFD, 0xD6, 0xD8, 0xE7, 0x87, 0x01, 0x39, 0x00, 0x8D,
+		0x05, 0x39, 0x44, 0xD6, 0xF1, 0x92, 0xE2, 0x83, 0xB5, 0x9C, 0xA0, 0x07, 0x10, 0x92, 0x89, 0x9E,
+		0xDD, 0xC2, 0xE8, 0xB1, 0xF8, 0x0E, 0xC1, 0x0C, 0x00, 0x8C, 0x25, 0x03, 0x4C, 0xB4, 0x9F, 0xC2,
+		0xA6, 0x80, 0xED, 0xE4, 0xA4, 0x90, 0x01, 0x10, 0x91, 0xFB, 0x8D, 0xAB, 0xF8, 0x9E, 0xD8, 0xD0,
+		0x99, 0x21, 0x03, 0x00, 0x8B, 0x05, 0x57, 0x5C, 0x8C, 0x8B, 0xD0, 0xE7, 0x8A, 0x85, 0xC2, 0xA2,
+		0xF6, 0x01, 0x10, 0xAD, 0x93, 0xDD, 0xF3, 0x9B, 0xA5, 0xF8, 0x9E, 0x6C, 0x5A, 0x1B, 0x08, 0x8A,
+		0x05, 0x1D, 0x48, 0x9C, 0xF3, 0xAD, 0xA9, 0x98, 0xF1, 0xC8, 0xA4, 0x7C, 0x10, 0xA8, 0xBB, 0x98,
+		0x94, 0x9B, 0x8C, 0x9D, 0xEA, 0xD9, 0x21, 0x5B, 0x00, 0x89, 0x05, 0x58, 0x4C, 0xCE, 0xA3, 0x8C,
+		0x8C, 0xEC, 0xD0, 0xB6, 0xA4, 0xFD, 0x01, 0x10, 0xB9, 0x91, 0xBB, 0xDD, 0xE7, 0xC5, 0x8E, 0xFB,
+		0x88, 0x01, 0x58, 0x00, 0x88, 0x05, 0x3B, 0x44, 0x8C, 0xA6, 0xEC, 0xC9, 0xEE, 0xFA, 0xA3, 0xA7,
+		0x02, 0x10, 0xB6, 0xDF, 0xA9, 0xB2, 0xCB, 0xF3, 0x95, 0xE6, 0x12, 0x46, 0x0A, 0x00, 0x95, 0x45,
+		0x0C, 0x5C, 0xF1, 0x96, 0xA9, 0xB2, 0xCD, 0xA8, 0xF2, 0xA5, 0xFC, 0x01, 0x10, 0x97, 0xC1, 0xD2,
+		0xC5, 0xF4, 0xE1, 0xC1, 0x90, 0x05, 0x5A, 0x1C, 0x08, 0xA2, 0x05, 0x58, 0x4C, 0xEF, 0xD3, 0xB6,
+		0xA8, 0xC7, 0xF4, 0xF1, 0xA6, 0xC1, 0x01, 0x10, 0x95, 0xA1, 0xC8, 0xDE, 0x99, 0xA9, 0xB1, 0xC2,
+		0xCD, 0x01, 0x58, 0x00, 0x94, 0x05, 0x3B, 0x18, 0xCA, 0x81, 0xF9, 0xD7, 0xE8, 0xD3, 0xE6, 0x21,
+		0x5D, 0x30, 0x95, 0xEF, 0xB4, 0xB5, 0xCD, 0xCD, 0x84, 0x95, 0x09, 0x5A, 0x1A, 0x08, 0xA1, 0x25,
+		0x07, 0x58, 0x80, 0x93, 0xD6, 0x81, 0x8E, 0xC3, 0xB3, 0xA6, 0x23, 0x10, 0x8E, 0xA7, 0xC5, 0xEE,
+		0x93, 0x9E, 0xCD, 0xCD, 0x24, 0x5A, 0x1B, 0x08, 0x93, 0x05, 0x39, 0x5C, 0xE3, 0xBD, 0xAB, 0x8A,
+		0xF1, 0x8C, 0xEB, 0xA5, 0xB9, 0x01, 0x10, 0xA6, 0xC5, 0xBC, 0xC7, 0xF3, 0xB5, 0x97, 0xBE, 0x10,
+		0x5A, 0x1B, 0x08, 0xA0, 0x05, 0xAE, 0x48, 0xF4, 0xDD, 0x84, 0xB6, 0xDE, 0x92, 0xD7, 0xA7, 0x1C,
+		0x10, 0x9A, 0xB5, 0x9E, 0x8C, 0xB7, 0xC4, 0xFC, 0xF8, 0xBC, 0x01, 0x73, 0x00, 0x92, 0x05, 0x3A,
+		0x48, 0xD1, 0xC5, 0x9F, 0xE3, 0xB5, 0xF5, 0xDD, 0xA6, 0x7C, 0x10, 0x93, 0xF9, 0xC5, 0x8F, 0x88,
+		0xF4, 0xF6, 0xC0, 0xBF, 0x01, 0x1D, 0x00, 0x9F, 0x05, 0x3A, 0x5C, 0xE8, 0xE6, 0xCE, 0x85, 0xB5,
+		0x8B, 0xA7, 0xA4, 0x97, 0x01, 0x10, 0xA7, 0xE5, 0xAC, 0x93, 0xA2, 0x83, 0xDD, 0xB7, 0x50, 0x5A,
+		0x1C, 0x08, 0x91, 0x65, 0xF6, 0x4C, 0xB6, 0x8E, 0xF3, 0xD3, 0xD5, 0xBD, 0xF4, 0xA3, 0xCC, 0x01,
+		0x10, 0x88, 0xA5, 0x8E, 0xFE, 0xDB, 0x85, 0xF3, 0xE8, 0xAD, 0x01, 0x3B, 0x00, 0x9E, 0x05, 0x3B,
+		0x44, 0x9A, 0xAA, 0xA2, 0x8A, 0x97, 0xF0, 0xBD, 0xA6, 0x6F, 0x10, 0xAC, 0x9F, 0xAC, 0xF9, 0xA5,
+		0x9C, 0xE5, 0xAB, 0x12, 0x07, 0x08, 0x00, 0x90, 0x05, 0x75, 0x48, 0x87, 0xC9, 0x8D, 0xC2, 0xF6,
+		0xEE, 0xBB, 0xA3, 0x2C, 0x10, 0xB9, 0xAB, 0x98, 0x9A, 0xFB, 0x94, 0xAE, 0xE4, 0xC7, 0x21, 0x7B,
+		0x00, 0x9D, 0x25, 0x23, 0x4C, 0xBA, 0x84, 0xF6, 0xAE, 0xFB, 0xCF, 0xFA, 0xA2, 0xE8, 0x01, 0x10,
+		0xAA, 0xE9, 0x98, 0xAA, 0xD4, 0xAB, 0x9E, 0xDB, 0xEF, 0x41, 0x0D, 0x5C, 0x8F, 0xD9, 0x69, 0x12,
+		0x14, 0x08, 0x86, 0xDB, 0xA6, 0xC8, 0xEF, 0xFB, 0xA1, 0xA7, 0x0A, 0x10, 0xA0, 0x93, 0xA9, 0x86,
+		0xD4, 0x98, 0x8A, 0xC7, 0x0E, 0x74, 0x0D, 0x00, 0x9C, 0x05, 0x3A, 0x4C, 0xEE, 0xAB, 0x8A, 0xAA,
+		0xA8, 0xBC, 0xC1, 0xA5, 0x96, 0x01, 0x10, 0xB1, 0xA3, 0xB1, 0xA5, 0xF9, 0x97, 0xAE, 0xEA, 0xB3,
+		0x01, 0x3A, 0x60, 0x8E, 0xD9, 0x69, 0x12, 0x14, 0x08, 0xDF, 0xE7, 0xA7, 0xC6, 0xDA, 0xB6, 0xEC,
+		0xA5, 0x5B, 0x10, 0x8B, 0xE9, 0xAD, 0xE6, 0x93, 0xAC, 0x9D, 0xFA, 0x2C, 0x0E, 0x35, 0x13, 0x05,
+		0x3A, 0x4C, 0xDE, 0xD1, 0x96, 0xEF, 0xDD, 0x9B, 0x86, 0xA7, 0xE7, 0x01, 0x10, 0x93, 0x99, 0xC3,
+		0xA5, 0xEB, 0xFA, 0xC9, 0xA5, 0xD0, 0x01, 0x92, 0x00, 0x8D, 0x05, 0xEA, 0x4C, 0xA0, 0xB9, 0xC9,
+		0xBA, 0xB5, 0xCB, 0xBC, 0xA2, 0xDA, 0x01, 0x10, 0x9D, 0xB1, 0xDC, 0x8D, 0xC0, 0xEE, 0x91, 0xA8,
+		0xBB, 0x01, 0x58, 0x00, 0x9A, 0x25, 0x98, 0xC8, 0xC0, 0xEE, 0xD8, 0xA5, 0xA5, 0xCD, 0x9C, 0xA1,
+		0x6F, 0x10, 0x83, 0x91, 0xB5, 0x96, 0xA3, 0xAE, 0xC8, 0xE5, 0x1A, 0x5A, 0x1A, 0x08, 0x8C, 0xD9,
+		0x69, 0x12, 0x14, 0x08, 0xCF, 0xD3, 0xC2, 0x94, 0x8E, 0x9C, 0xF5, 0x26, 0x10, 0xAD, 0xD9, 0x9E,
+		0xED, 0xDE, 0xF2, 0xDA, 0xE2, 0x90, 0x01, 0x5A, 0x1A, 0x08, 0x99, 0x05, 0x38, 0x58, 0x95, 0xFD,
+		0xA3, 0xF1, 0xB5, 0xD2, 0x8B, 0xA0, 0x51, 0x10, 0xB3, 0x85, 0x93, 0xD3, 0x84, 0xAA, 0xAC, 0xC8,
+		0x61, 0x5A, 0x1B, 0x08, 0x87, 0x25, 0x3E, 0x5C, 0x88, 0xA1, 0x97, 0xCF, 0x8D, 0xB1, 0x9A, 0xA7,
+		0xBC, 0x01, 0x10, 0x8C, 0xA9, 0x9B, 0x9F, 0xED, 0x95, 0xD3, 0xA7, 0x0E, 0x5A, 0x1C, 0x08, 0x8B,
+		0x05, 0x8F, 0x4C, 0x91, 0xA2, 0xB7, 0xFC, 0xD8, 0xB6, 0xCB, 0xA5, 0xEB, 0x01, 0x10, 0xA5, 0xDB,
+		0xBA, 0xF0, 0x84, 0xE1, 0xF0, 0x81, 0xEB, 0x01, 0x8F, 0x00, 0x98, 0x05, 0x57, 0x44, 0xDE, 0xB5,
+		0xA5, 0xB7, 0xB1, 0xC5, 0x97, 0xA6, 0x2B, 0x10, 0x92, 0x9B, 0xC2, 0xB9, 0xFC, 0x96, 0xC5, 0x8D,
+		0x0E, 0x24, 0x0F, 0x00, 0x8A, 0x25, 0x78, 0x5C, 0x8D, 0xE2, 0x9E, 0xDA, 0xE8, 0xBF, 0x98, 0xA2,
+		0xA8, 0x01, 0x10, 0xAD, 0xF9, 0xE5, 0xF1, 0xD4, 0xF0, 0xA9, 0xBD, 0x41, 0x5A, 0x1C, 0x08, 0x97,
+		0x25, 0x04, 0x4C, 0x96, 0xB3, 0xC4, 0xA4, 0xA5, 0xFB, 0x9B, 0xA0, 0xB5, 0x01, 0x10, 0x88, 0x85,
+		0xA5, 0x93, 0xE9, 0xC1, 0xD7, 0xE0, 0xD7, 0x21, 0xD0, 0x00, 0x89, 0x05, 0x3B, 0x5C, 0xCE, 0xA9,
+		0xF3, 0xCA, 0xC6, 0xBC, 0xFF, 0xA7, 0xB0, 0x01, 0x10, 0x83, 0xDB, 0xB0, 0xAB, 0xA3, 0xCD, 0x83,
+		0xEF, 0x3E, 0x5A, 0x1C, 0x08, 0x96, 0x05, 0x3B, 0x4C, 0xF6, 0x9F, 0xFD, 0xE7, 0x8F, 0xF9, 0x83,
+		0xA5, 0xE7, 0x01, 0x10, 0xA8, 0xEB, 0xAD, 0x8B, 0x98, 0xDE, 0xB8, 0xE2, 0xB3, 0x01, 0x3B, 0x00,
+		0x88, 0x05, 0x3B, 0x4C, 0xD6, 0xC2, 0xAE, 0xD3, 0xB6, 0xEE, 0xF3, 0xA2, 0x9F, 0x01, 0x10, 0xA2,
+		0xED, 0x8C, 0xE5, 0x97, 0xFA, 0xC1, 0xC1, 0x2B, 0x0E, 0xB7, 0x0F, 0x05, 0xEA, 0x48, 0xD1, 0xBF,
+		0xDB, 0xD4, 0xF6, 0xA5, 0xF1, 0xA1, 0x36, 0x10, 0xA4, 0xD9, 0xF4, 0xC8, 0xF6, 0xED, 0xA8, 0x97,
+		0x88, 0x01, 0xCC, 0x08, 0x87, 0xD9, 0x69, 0x0E, 0xD3, 0x1A, 0x54, 0xD5, 0xE4, 0xD2, 0xA8, 0xD4,
+		0xA3, 0xA0, 0x6E, 0x10, 0xBF, 0x87, 0xD4, 0xB1, 0xF8, 0x8B, 0xEC, 0xE8, 0x65, 0x5A, 0x1B, 0x08,
+		0x94, 0x05, 0x39, 0x20, 0xFB, 0x9F, 0xD0, 0xD7, 0x85, 0x93, 0xB1, 0xA6, 0xCE, 0x0E, 0x97, 0x16,
+		0x18, 0x8C, 0xEF, 0xD9, 0x93, 0xF3, 0xB4, 0x68, 0x0E, 0x76, 0x14, 0x00, 0xDC, 0x01, 0x39, 0x44,
+		0xAA, 0xC5, 0x8D, 0xC3, 0xE6, 0xE2, 0xCC, 0xA6, 0x51, 0x10, 0x90, 0xF7, 0x91, 0xE1, 0xD3, 0x97,
+		0xD3, 0xBE, 0xC1, 0xAE, 0x00, 0x92, 0x05, 0xAD, 0x4C, 0x81, 0xCD, 0xE8, 0xDB, 0x8A, 0x91, 0x88,
+		0xA5, 0x9C, 0x01, 0x10, 0x85, 0xB1, 0xE9, 0xFC, 0xA6, 0xFA, 0xB9, 0xA9, 0xDB, 0x01, 0xAD, 0x00,
+		0x91, 0x05, 0x57, 0x5C, 0xB2, 0xE3, 0xA2, 0x96, 0xEA, 0xB6, 0xC4, 0xA6, 0xE5, 0x01, 0x10, 0xA9,
+		0x8B, 0xD4, 0xBD, 0xA3, 0xBA, 0xE5, 0xBB, 0x03, 0x5A, 0x1C, 0x08, 0x90, 0x05, 0x3B, 0x4C, 0xFE,
+		0xDB, 0xF9, 0xFF, 0xC1, 0xFB, 0xDC, 0xA5, 0xFD, 0x01, 0x10, 0xB5, 0x83, 0xFF, 0xD3, 0xA1, 0xAE,
+		0xD2, 0x90, 0x97, 0x01, 0x3B, 0x00, 0x8F, 0x05, 0x3B, 0x5C, 0xF0, 0xD9, 0x99, 0xAE, 0xE9, 0x83,
+		0x8C, 0xA5, 0x93, 0x01, 0x10, 0xA6, 0xE3, 0xE8, 0xED, 0xE1, 0xF7, 0xBA, 0xD7, 0x1B, 0x5A, 0x1B,
+		0x08, 0x86, 0x05, 0x1D, 0x5C, 0xEA, 0xF3, 0xF4, 0xF8, 0x90, 0xB9, 0xA2, 0xA2, 0xCA, 0x01, 0x10,
+		0xBF, 0xE3, 0x98, 0xB8, 0x98, 0x92, 0xE2, 0x95, 0x75, 0x5A, 0x1B, 0x08, 0x85, 0x05, 0x1D, 0x48,
+		0x93, 0x8B, 0xB2, 0xEC, 0xAB, 0xC4, 0xC2, 0xA3, 0x82, 0x01, 0x10, 0x82, 0xA3, 0xD8, 0x8A, 0xBE,
+		0x8F, 0xC1, 0xB9, 0x0E, 0x1C, 0x0D, 0x00, 0xFA, 0xA5, 0x55, 0x48, 0x93, 0x84, 0xE3, 0xCD, 0xED,
+		0xE7, 0x93, 0xA0, 0x9D, 0x01, 0x10, 0xB3, 0xCF, 0xDD, 0xE7, 0x92, 0xC8, 0xC6, 0xEB, 0x0E, 0xD1,
+		0x14, 0x00, 0xF9, 0xC5, 0x21, 0x4C, 0xBB, 0xE2, 0xAC, 0xBE, 0xCD, 0x9F, 0x8B, 0xA6, 0xA9, 0x01,
+		0x10, 0x96, 0xDB, 0xBF, 0xF4, 0xFA, 0xF7, 0xE5, 0x8B, 0xC0, 0x41, 0xB9, 0x00, 0xFD, 0x05, 0x1E,
+		0x4C, 0xAF, 0xD9, 0xD8, 0xFD, 0xFE, 0xEF, 0xA9, 0xA3, 0xBA, 0x01, 0x10, 0x8C, 0xD3, 0xD3, 0x92,
+		0xE4, 0xF3, 0xAF, 0xE2, 0x87, 0x01, 0xB0, 0x00, 0xD0, 0x05, 0x59, 0x5C, 0xBC, 0xC8, 0x9D, 0x83,
+		0xC7, 0xEF, 0x9C, 0xA4, 0xEE, 0x01, 0x10, 0xA8, 0xF5, 0xC5, 0xCD, 0x82, 0xBA, 0xB7, 0xE6, 0x74,
+		0x5A, 0x1B, 0x08, 0xCF, 0x05, 0x1D, 0x48, 0xB7, 0x97, 0x81, 0xCB, 0xBB, 0xA0, 0xF7, 0xA0, 0xD8,
+		0x01, 0x10, 0xBE, 0xE7, 0xF5, 0x97, 0xF4, 0xFF, 0xD0, 0xBA, 0xA1, 0x3B, 0x00, 0xD7, 0x05, 0x1D,
+		0x60, 0x8B, 0xD3, 0xED, 0xE8, 0xD6, 0xB3, 0xDB, 0xA3, 0xEB, 0x01, 0x10, 0x97, 0xCF, 0xDE, 0xC4,
+		0xAA, 0xF0, 0x8E, 0xEF, 0x70, 0x5A, 0x1A, 0x08, 0xD6, 0xDB, 0x21, 0x7C, 0x44, 0xF4, 0xE6, 0xD2,
+		0x93, 0x81, 0x9E, 0xCE, 0xA3, 0xC5, 0x01, 0x10, 0xB6, 0xE7, 0x91, 0xE5, 0x94, 0xCC, 0xC6, 0x0E,
+		0xCC, 0x24, 0x00, 0xD5, 0x05, 0x1C, 0x44, 0xE4, 0xF5, 0xE0, 0xC3, 0xC1, 0x89, 0xD2, 0xA1, 0x4E,
+		0x10, 0x8F, 0x91, 0x82, 0xF8, 0xF1, 0xBC, 0x93, 0x91, 0xE1, 0x61, 0x00, 0xD4, 0x05, 0x55, 0x5C,
+		0xD8, 0xEC, 0xC4, 0xBA, 0xD6, 0x82, 0xE1, 0xA4, 0xA9, 0x01, 0x10, 0xB7, 0xE3, 0x99, 0x96, 0xBE,
+		0xDD, 0xCB, 0xBA, 0x2E, 0x5A, 0x1B, 0x08, 0xD3, 0x05, 0x1D, 0x4C, 0xDC, 0xAB, 0x93, 0xF6, 0xEE,
+		0x8D, 0xE7, 0xA0, 0xBF, 0x01, 0x10, 0xAE, 0xF3, 0xDB, 0x99, 0xCE, 0xFA, 0xA4, 0x8A, 0x5D, 0x0E,
+		0xF8, 0x09, 0x05, 0x1D, 0x48, 0xD2, 0x93, 0xE4, 0x81, 0xA7, 0xFA, 0xD9, 0xA2, 0x42, 0x10, 0x90,
+		0x85, 0xA2, 0x93, 0xB5, 0xA5, 0xE1, 0xBC, 0xFE, 0x01, 0xE6, 0x00, 0xF7, 0x05, 0x1D, 0x1C, 0xCC,
+		0xC0, 0xAF, 0xBA, 0xB7, 0x8B, 0xCB, 0xA6, 0x81, 0x15, 0x18, 0x8B, 0x93, 0xA4, 0xE7, 0xE1, 0xFE,
+		0xEC, 0xC1, 0xEB, 0x00, 0xE2, 0x05, 0x1D, 0x18, 0xE0, 0xA3, 0x9E, 0x98, 0xAC, 0xC8, 0x81, 0x0E,
+		0x6D, 0x19, 0x1C, 0xB5, 0xD1, 0x81, 0x9F, 0x8C, 0xCD, 0xCF, 0x96, 0x0E, 0x4A, 0x17, 0x00, 0xE1,
+		0x25, 0x3E, 0x4C, 0x88, 0xBC, 0x8F, 0xFC, 0x89, 0x91, 0xBC, 0xA1, 0xD1, 0x01, 0x10, 0xA2, 0xBF,
+		0xFE, 0xFD, 0xF0, 0xE7, 0xE9, 0xEE, 0xF8, 0x01, 0x58, 0x00, 0xE0, 0x05, 0x3B, 0x48, 0x81, 0xAE,
+		0xB9, 0xD8, 0xA1, 0xBF, 0x88, 0xA5, 0x07, 0x10, 0x91, 0xF7, 0x9E, 0x8E, 0xDB, 0xC2, 0xB4, 0xAD,
+		0xA7, 0x21, 0x79, 0x00, 0xDF, 0x05, 0x3B, 0x4C, 0x90, 0xC2, 0x8D, 0x9F, 0x91, 0xAF, 0xC2, 0xA7,
+		0xBB, 0x01, 0x10, 0xB5, 0xA7, 0x90, 0xD9, 0xC9, 0xC7, 0xF5, 0xDF, 0x85, 0x01, 0x3B, 0x00, 0xDE,
+		0x05, 0x3B, 0x5C, 0xE3, 0x8A, 0x91, 0x88, 0xE9, 0xCC, 0xBC, 0xA5, 0xE9, 0x01, 0x10, 0x8D, 0x8D,
+		0xD8, 0xCD, 0xDF, 0x8B, 0x9C, 0xD2, 0x5B, 0x5A, 0x1C, 0x08, 0xDD, 0x05, 0x3B, 0x48, 0xFC, 0xA3,
+		0xFC, 0xC7, 0xE4, 0xA6, 0xBA, 0xA3, 0xD7, 0x01, 0x10, 0x81, 0xA7, 0x84, 0xAA, 0xF3, 0xC6, 0xBE,
+		0xE2, 0xC5, 0x98, 0x00, 0xDC, 0x05, 0x1E, 0x4C, 0xBE, 0xD5, 0xEC, 0xAD, 0x95, 0xCC, 0xEC, 0xA7,
+		0xE2, 0x01, 0x10, 0xB8, 0x81, 0xC9, 0xDE, 0xF3, 0xBC, 0x8D, 0xDB, 0xF7, 0x01, 0x77, 0x00, 0xF6,
+		0x05, 0x1E, 0x48, 0xA7, 0xE9, 0xDF, 0xB9, 0xCA, 0xE1, 0xC8, 0xA7, 0xD8, 0x01, 0x10, 0x8B, 0xFB,
+		0xE2, 0xDE, 0xE1, 0xDA, 0x8B, 0xCC, 0x12, 0x88, 0x10, 0x00, 0xF5, 0x05, 0x77, 0x48, 0xA1, 0xA5,
+		0xE3, 0xE5, 0xE2, 0xA9, 0xEC, 0xA1, 0x06, 0x10, 0xA1, 0xA7, 0x92, 0xB6, 0xB4, 0xA4, 0xA9, 0x91,
+		0xD5, 0x01, 0x3B, 0x00, 0xF4, 0x05, 0x3B, 0x4C, 0x8F, 0xAB, 0xAE, 0x9F, 0x94, 0x92, 0xF8, 0xA0,
+		0xF8, 0x01, 0x10, 0x9F, 0xFD, 0xD8, 0xAE, 0xAF, 0xB3, 0x8A, 0xE7, 0x90, 0x01, 0x1E, 0x00, 0xF3,
+		0x05, 0x1E, 0x4C, 0x9F, 0x80, 0xEF, 0xAF, 0xD1, 0x8C, 0xD4, 0xA2, 0xE3, 0x01, 0x10, 0xA1, 0xF9,
+		0xE6, 0xA4, 0x8D, 0x97, 0xFD, 0xE0, 0x84, 0x61, 0xA7, 0x00, 0xED, 0x25, 0xD6, 0x58, 0xFE, 0xD8,
+		0xAC, 0xD7, 0x96, 0xE4, 0xD8, 0xA6, 0x78, 0x10, 0xA1, 0x95, 0xD8, 0x8C, 0xF2, 0xEF, 0x91, 0x9A,
+		0x13, 0x5A, 0x1C, 0x08, 0xDB, 0x05, 0x3A, 0x4C, 0x91, 0xE3, 0xC9, 0x8A, 0xAE, 0x9D, 0x8E, 0xA6,
+		0x86, 0x01, 0x10, 0xA8, 0xE5, 0xA2, 0xAA, 0xC2, 0xC7, 0xED, 0xB7, 0xDD, 0x21, 0x0A, 0x00, 0xDA,
+		0x05, 0x93, 0x48, 0xD0, 0x8A, 0xE8, 0xB1, 0xE6, 0xD6, 0x9A, 0xA3, 0x64, 0x10, 0x9A, 0xED, 0xCD,
+		0xA6, 0xE7, 0xE0, 0x82, 0x8B, 0x87, 0x01, 0x75, 0x00, 0xD9, 0x05, 0x3B, 0x48, 0x99, 0x9B, 0xC8,
+		0xBD, 0x97, 0xA6, 0xCD, 0xA5, 0xC0, 0x01, 0x10, 0xB3, 0xAB, 0xA6, 0x99, 0xCF, 0xAD, 0xF0, 0xE5,
+		0x45, 0xDC, 0x00, 0xCE, 0x05, 0x1E, 0x4C, 0xAC, 0xB6, 0xF3, 0x98, 0xCE, 0xB1, 0xE3, 0xA0, 0x82,
+		0x01, 0x10, 0xB4, 0x89, 0xEB, 0x98, 0xD9, 0xB4, 0x8D, 0x9A, 0xDA, 0x01, 0x59, 0x00, 0xCD, 0x05,
+		0x59, 0x4C, 0x9C, 0xE9, 0xD6, 0xFA, 0xBF, 0xE7, 0xD6, 0xA3, 0xF1, 0x01, 0x10, 0x89, 0xC5, 0x86,
+		0xE4, 0xC3, 0xDF, 0xC5, 0xD5, 0x36, 0x0E, 0xF9, 0x25, 0x05, 0x1D, 0x48, 0xD2, 0xD1, 0xC1, 0xBB,
+		0xF5, 0xDE, 0xF1, 0xA5, 0x84, 0x01, 0x10, 0x8D, 0xA7, 0xA7, 0x92, 0x90, 0xE3, 0xC9, 0xF0, 0x0E,
+		0xBB, 0x14, 0x00, 0xA4, 0x05, 0x1D, 0x4C, 0xB0, 0xCF, 0xEC, 0xE9, 0xB8, 0xD5, 0x93, 0xA7, 0xC2,
+		0x01, 0x10, 0xAF, 0x89, 0xB1, 0xAC, 0xC4, 0xAB, 0xB9, 0x9C, 0x25, 0x0E, 0xEF, 0x19, 0x05, 0x75,
+		0x18, 0xD3, 0xC8, 0xA2, 0xC1, 0xE3, 0xBD, 0xD8, 0x21, 0xBA, 0x20, 0x97, 0xEB, 0x95, 0x94, 0xAB,
+		0xEE, 0x8C, 0xC9, 0xBD, 0x01, 0x75, 0x00, 0xAB, 0x05, 0x3B, 0x18, 0x98, 0xE9, 0xF2, 0xA1, 0x8B,
+		0xC4, 0xF4, 0x0E, 0x2D, 0x1C, 0x30, 0xA1, 0xC3, 0xFB, 0xDB, 0xB5, 0xB2, 0xD8, 0xE9, 0x4A, 0x5A,
+		0x1B, 0x08, 0xAA, 0x05, 0x1D, 0x48, 0xD9, 0xAF, 0xE8, 0xA6, 0x83, 0x94, 0xF1, 0xA7, 0xA3, 0x01,
+		0x10, 0x8D, 0xDF, 0xCB, 0x99, 0xBF, 0xA0, 0x8D, 0x97, 0x0E, 0xBA, 0x0C, 0x00, 0xA9, 0x05, 0x1D,
+		0x48, 0xA0, 0xD2, 0xE8, 0x91, 0x9F, 0xF6, 0xF9, 0xA3, 0x73, 0x10, 0x8F, 0xB7, 0xBD, 0xC3, 0xE7,
+		0xB2, 0xFA, 0xAA, 0x9F, 0x21, 0x5F, 0x00, 0xA8, 0x25, 0x5F, 0x58, 0xD9, 0xE0, 0xB4, 0xDB, 0xD9,
+		0x9B, 0xC1, 0xA6, 0x53, 0x10, 0x96, 0xAB, 0xF1, 0xB4, 0xBB, 0xA3, 0xCB, 0xE2, 0x1A, 0x5A, 0x1B,
+		0x08, 0xA7, 0x05, 0x39, 0x5C, 0xFF, 0x9D, 0xEF, 0xF4, 0xC3, 0xFD, 0xEE, 0xA4, 0xC6, 0x01, 0x10,
+		0x86, 0xF9, 0xD7, 0x82, 0xFB, 0xA1, 0xDF, 0xDB, 0x25, 0x5A, 0x1B, 0x08, 0xA6, 0x05, 0x1D, 0x5C,
+		0x8A, 0xBD, 0x8D, 0xA3, 0xF9, 0xA9, 0xA7, 0xA3, 0xA8, 0x01, 0x10, 0x89, 0xF5, 0xA4, 0x81, 0xF7,
+		0xD5, 0xBD, 0x98, 0x18, 0x5A, 0x1C, 0x08, 0xCB, 0x05, 0xCB, 0x4C, 0x8B, 0x87, 0xEF, 0xB5, 0x9D,
+		0x8A, 0xCD, 0xA3, 0x92, 0x01, 0x10, 0x96, 0x87, 0xE1, 0x94, 0xB1, 0x8E, 0xB5, 0xD1, 0xD3, 0x01,
+		0xCB, 0x00, 0xB6, 0x05, 0x3B, 0x48, 0x94, 0x8E, 0xA8, 0xFA, 0xF3, 0xB2, 0xC8, 0xA6, 0x14, 0x10,
+		0xB5, 0x83, 0x94, 0xB8, 0xEA, 0xC3, 0xF4, 0xDB, 0xEC, 0x21, 0x99, 0x00, 0xB5, 0x05, 0x3B, 0x18,
+		0xD3, 0xDF, 0xFF, 0xC8, 0xFB, 0xF5, 0xE6, 0x0E, 0x21, 0x0A, 0x1C, 0xA6, 0xD7, 0x95, 0xB8, 0xAA,
+		0x96, 0xDF, 0xDB, 0x45, 0xDE, 0x00, 0xB4, 0x05, 0x3B, 0x48, 0xEF, 0xBA, 0xE2, 0x8D, 0x87, 0xB4,
+		0x92, 0xA0, 0x81, 0x01, 0x10, 0x9B, 0xB3, 0xFC, 0xDC, 0xE3, 0xE1, 0xAE, 0xC9, 0x0E, 0x56, 0x0F,
+		0x00, 0xB3, 0x05, 0x3B, 0x4C, 0xA4, 0x8B, 0x82, 0xD3, 0xE0, 0x88, 0xDC, 0xA0, 0xA1, 0x01, 0x10,
+		0x9E, 0x8D, 0xE1, 0xD3, 0xBB, 0xA1, 0x9C, 0xDE, 0xE1, 0x01, 0x59, 0x00, 0xB2, 0x05, 0x1E, 0x4C,
+		0x80, 0xF0, 0xDA, 0xD8, 0xE0, 0x81, 0xD5, 0xA1, 0xBB, 0x01, 0x10, 0xB3, 0xD5, 0xF1, 0xE2, 0x8A,
+		0x9A, 0x88, 0x8F, 0xE7, 0x21, 0x08, 0x00, 0xB1, 0x25, 0x08, 0x48, 0xB5, 0xEA, 0xFD, 0xDF, 0xE7,
+		0xF4, 0xF3, 0xA0, 0x05, 0x10, 0xB3, 0x9D, 0xBE, 0xB3, 0x89, 0xEF, 0x9B, 0xF6, 0x17, 0x0E, 0xB6,
+		0x18, 0x05, 0x1C, 0x58, 0xD2, 0xE0, 0x95, 0x94, 0xCC, 0xDD, 0xB7, 0xA1, 0x39, 0x10, 0x8E, 0xED,
+		0xFA, 0xF5, 0xA7, 0xEB, 0xE0, 0xC2, 0x72, 0x5A, 0x1C, 0x08, 0xCA, 0x05, 0x56, 0x48, 0x99, 0xCC,
+		0x9E, 0xA1, 0xF7, 0xDE, 0xFB, 0xA7, 0xC1, 0x01, 0x10, 0xA6, 0xBD, 0xDE, 0xB9, 0xAE, 0xF3, 0x95,
+		0xAF, 0x12, 0xA2, 0x0D, 0x00, 0xC9, 0x05, 0x3A, 0x58, 0xC6, 0x8C, 0xCF, 0xDC, 0x9D, 0xC2, 0x87,
+		0xA7, 0x1D, 0x10, 0xA6, 0xD1, 0x88, 0x84, 0x8D, 0x83, 0xD4, 0xB3, 0x5F, 0x5A, 0x1A, 0x08, 0xC8,
+		0x05, 0x1C, 0x44, 0x8B, 0xB9, 0xEC, 0xAF, 0xBB, 0x86, 0xDD, 0xA6, 0x35, 0x10, 0x84, 0x99, 0xBF,
+		0x81, 0xBB, 0xE1, 0x96, 0xC7, 0xA1, 0x7A, 0x00, 0xC7, 0x05, 0x56, 0x20, 0x93, 0x99, 0xF5, 0x83,
+		0x88, 0xA3, 0xB8, 0xA4, 0x9B, 0x0E, 0xA2, 0x0D, 0x18, 0xE4, 0xAE, 0x82, 0xDF, 0xBC, 0xF3, 0x82,
+		0x21, 0x40, 0x00, 0xC6, 0x25, 0x05, 0x48, 0x81, 0xF4, 0x87, 0x84, 0x89, 0xE2, 0xA3, 0xA4, 0x69,
+		0x10, 0xA5, 0xA3, 0xED, 0x84, 0xED, 0xC8, 0x8F, 0xAE, 0xAE, 0x01, 0xC9, 0x00, 0xC5, 0x05, 0x57,
+		0x58, 0x8D, 0xE8, 0xD6, 0xDB, 0x81, 0xFB, 0xE5, 0xA5, 0x43, 0x10, 0x91, 0xD7, 0xC6, 0xD6, 0x9D,
+		0xCC, 0xF9, 0xBE, 0x1A, 0x5A, 0x1C, 0x08, 0xC4, 0x05, 0x57, 0x18, 0xC6, 0xC7, 0x83, 0xE5, 0xD4,
+		0xE6, 0xAF, 0xA1, 0xEE, 0x1C, 0xA5, 0xD3, 0xCC, 0xDD, 0xF6, 0xC4, 0x92, 0xBA, 0x12, 0xE7, 0x0F,
+		0x00, 0xC3, 0x05, 0x57, 0x5C, 0xD8, 0xC0, 0xA5, 0xE7, 0x9F, 0xFD, 0x99, 0xA6, 0xDD, 0x01, 0x10,
+		0xA9, 0xFB, 0x94, 0xBD, 0xE3, 0xD1, 0xDD, 0xAE, 0x1F, 0x5A, 0x1B, 0x08, 0xC2, 0x05, 0x1D, 0x18,
+		0x85, 0x89, 0xE6, 0xB8, 0xC4, 0xE7, 0x87, 0x65, 0x30, 0x18, 0xE3, 0xC6, 0xDB, 0xC0, 0xD1, 0x9C,
+		0xB5, 0xE1, 0xA3, 0x00, 0xC1, 0x05, 0x58, 0x4C, 0xD0, 0xA1, 0xB2, 0x88, 0xB7, 0x8A, 0x98, 0xA4,
+		0xF9, 0x01, 0x10, 0x94, 0xCF, 0xED, 0x8D, 0x91, 0xB9, 0xD2, 0xFC, 0x8E, 0x01, 0xAF, 0x00, 0xAF,
+		0x05, 0x3B, 0x48, 0xA3, 0x96, 0xA0, 0xCB, 0xFC, 0xE7, 0xFB, 0xA2, 0xCB, 0x01, 0x10, 0xA4, 0xF5,
+		0xE3, 0xCA, 0x9E, 0xAD, 0xCF, 0xD7, 0x0E, 0x70, 0x1D, 0x00, 0xC0, 0x05, 0xAF, 0x58, 0xBE, 0xFB,
+		0xFE, 0xC4, 0xFC, 0xF3, 0xCC, 0xA4, 0x0F, 0x10, 0x99, 0xE1, 0xD5, 0x9E, 0x87, 0x92, 0xA0, 0x8C,
+		0x6A, 0x5A, 0x1B, 0x08, 0xBF, 0x05, 0x39, 0x48, 0xE5, 0xAF, 0xFF, 0x84, 0xAA, 0xC8, 0xE9, 0xA2,
+		0x5C, 0x10, 0x91, 0xA1, 0xC6, 0xEA, 0x97, 0xA0, 0xAC, 0xDC, 0xE8, 0x21, 0xCF, 0x00, 0xBE, 0x05,
+		0x74, 0x48, 0xB9, 0xA0, 0xE8, 0xB5, 0xCA, 0xE7, 0xB8, 0xA0, 0xCC, 0x01, 0x10, 0x99, 0xAB, 0xB7,
+		0xBB, 0xAC, 0x82, 0xFE, 0xF4, 0x65, 0x2E, 0x00, 0xBD, 0x05, 0x3B, 0x44, 0x98, 0xE8, 0x90, 0xCA,
+		0x85, 0x8F, 0x93, 0xA0, 0x27, 0x10, 0x97, 0xA3, 0xCD, 0xA8, 0xD7, 0xAF, 0xB2, 0xCC, 0x12, 0x12,
+		0x1A, 0x00, 0xBC, 0x05, 0x1D, 0x5C, 0xE6, 0xD4, 0xFC, 0x8F, 0xFC, 0xEA, 0xF3, 0xA6, 0x9A, 0x01,
+		0x10, 0x98, 0xF1, 0xFE, 0xE9, 0x9B, 0xEA, 0x82, 0xFA, 0x6E, 0x5A, 0x1C, 0x08, 0xBB, 0x05, 0x58,
+		0x60, 0x8E, 0xB2, 0xDE, 0xBD, 0xFE, 0xC7, 0xCD, 0xA5, 0x96, 0x01, 0x10, 0x93, 0xFF, 0xF1, 0xB1,
+		0xF9, 0x88, 0x8C, 0xD9, 0xE1, 0x01, 0x5A, 0x1B, 0x08, 0xBA, 0x05, 0x3B, 0x48, 0xCF, 0x8C, 0xF0,
+		0xAC, 0xF8, 0xAE, 0xB7, 0xA2, 0x9E, 0x01, 0x10, 0x81, 0xF7, 0xAB, 0x99, 0xE0, 0x9F, 0xF0, 0xD2,
+		0x0E, 0xEF, 0x10, 0x00, 0xB9, 0x05, 0x1D, 0x5C, 0xEC, 0xC8, 0xA5, 0xE1, 0x8A, 0x80, 0x82, 0xA2,
+		0x80, 0x01, 0x10, 0x8D, 0xB3, 0xEC, 0xCD, 0xE6, 0xBE, 0xD4, 0xAC, 0x2F, 0x5A, 0x1B, 0x08, 0xB8,
+		0x09, 0x1D, 0x44, 0x95, 0xFC, 0xEE, 0xAE, 0xC8, 0xB2, 0xA1, 0x3C, 0x10, 0xB2, 0x97, 0xED, 0x9E,
+		0xD7, 0x96, 0xB8, 0xA7, 0xBD, 0x01, 0xCD, 0x00, 0xB7, 0x05, 0x75, 0x4C, 0x88, 0x8B, 0x8F, 0xB0,
+		0x97, 0xF5, 0x87, 0xA6, 0xD9, 0x01, 0x10, 0x9E, 0x91, 0x82, 0x81, 0xE2, 0xEC, 0xEE, 0xE1, 0xFF,
+		0x01, 0x75, 0x00, 0xAE, 0x05, 0x3B, 0x20, 0xF5, 0x9E, 0xE6, 0xBA, 0xD0, 0xD2, 0xDD, 0xA1, 0x80,
+		0x0E, 0xDA, 0x21, 0x28, 0xD2, 0xE0, 0xA0, 0x8D, 0xD1, 0xF5, 0x32, 0x5A, 0x1B, 0x08, 0xAD, 0x05,
+		0x1D, 0x5C, 0xA1, 0xB2, 0xEB, 0x84, 0xDA, 0xA1, 0x9E, 0xA7, 0xF0, 0x01, 0x10, 0x8A, 0xA9, 0xD3,
+		0xB6, 0xD4, 0xEC, 0xD7, 0xE7, 0x4E, 0x5A, 0x1B, 0x08, 0xA2, 0x05, 0x1D, 0x44, 0xE2, 0xBD, 0x94,
+		0xF0, 0xF1, 0xC2, 0xFA, 0xA0, 0x7D, 0x10, 0xA8, 0x91, 0xA7, 0xAA, 0x90, 0x9F, 0x8D, 0xBD, 0x12,
+		0x57, 0x1C, 0x00, 0xA1, 0x05, 0x1D, 0x5C, 0xBA, 0x96, 0xE6, 0x96, 0xC3, 0x80, 0xF9, 0xA3, 0xBD,
+		0x01, 0x10, 0xB7, 0xB1, 0xBE, 0xCC, 0xAF, 0x86, 0xBB, 0xD5, 0x44, 0x5A, 0x1C, 0x08, 0xA5, 0x05,
+		0x92, 0x48, 0xCE, 0xEB, 0xEF, 0x8A, 0xD2, 0xDE, 0xE5, 0xA7, 0xD2, 0x01, 0x10, 0x84, 0xCF, 0xFD,
+		0xE2, 0xD9, 0xF1, 0x91, 0xBF, 0x12, 0x35, 0x14, 0x00, 0xEB, 0x12, 0xB6, 0x1E, 0x58, 0xBA, 0xD7,
+		0xEE, 0xD8, 0x95, 0xE9, 0xBB, 0xA0, 0x04, 0x10, 0x96, 0xF1, 0x89, 0x9B, 0x89, 0xF8, 0xDE, 0xB8,
+		0x09, 0x5A, 0x1B, 0x08, 0xF8, 0x12, 0x63, 0x11, 0x48, 0xD9, 0xAF, 0xF3, 0xF1, 0xBC, 0xC4, 0xD0,
+		0xA0, 0xEF, 0x01, 0x10, 0xBA, 0xB1, 0xCB, 0xCD, 0x9C, 0xCF, 0xE7, 0xD1, 0xA1, 0x01, 0x04, 0xEA,
+		0xD7, 0x0E, 0x91, 0x0E, 0x5C, 0xAF, 0xBD, 0xD8, 0xCC, 0xD6, 0x97, 0xEA, 0xA1, 0xB9, 0x01, 0x10,
+		0xB0, 0xF9, 0xC6, 0x96, 0xAA, 0xC3, 0x9E, 0xE1, 0x5F, 0x5A, 0x1C, 0x08, 0xF7, 0x12, 0x13, 0x1A,
+		0x48, 0xA1, 0xBF, 0xE1, 0xB6, 0xC6, 0xB2, 0xF5, 0xA5, 0xF5, 0x01, 0x10, 0x8A, 0xDF, 0x8C, 0xD9,
+		0xAF, 0x95, 0xB4, 0x8E, 0x12, 0x30, 0x0C, 0x00, 0xF2, 0x05, 0x3B, 0x48, 0xED, 0xEE, 0xC9, 0xCB,
+		0xC1, 0x94, 0xDB, 0xA5, 0x7A, 0x10, 0xB5, 0xD1, 0xB8, 0x9F, 0xA6, 0xBA, 0xC7, 0xDB, 0x84, 0x21,
+		0x23, 0x00, 0xFF, 0x05, 0x75, 0x48, 0xD1, 0xD5, 0xB7, 0xA9, 0xFE, 0xEC, 0x8D, 0xA1, 0x2B, 0x10,
+		0x88, 0x99, 0xB6, 0x96, 0xEC, 0xA3, 0xA5, 0x99, 0xA9, 0x61, 0x13, 0x00, 0xF1, 0x05, 0xAE, 0x5C,
+		0x95, 0xEC, 0xEF, 0xAC, 0xC8, 0xFD, 0xE7, 0xA7, 0x3C, 0x10, 0xA8, 0xB7, 0xFD, 0xD2, 0xB9, 0xDB,
+		0xC4, 0xD5, 0x69, 0x5A, 0x19, 0x08, 0xFE, 0xDA, 0x0E, 0x6D, 0x14, 0x44, 0xCC, 0x86, 0x98, 0x96,
+		0x8F, 0xAD, 0xFB, 0xA5, 0x6C, 0x10, 0xA8, 0xDD, 0xDB, 0xE8, 0xB1, 0x9A, 0xA5, 0x27, 0x0E, 0x62,
+		0x18, 0x05, 0x71, 0x5C, 0xB6, 0xBE, 0xA5, 0xA1, 0xC1, 0x84, 0xBC, 0xA7, 0x3C, 0x10, 0xA7, 0xEF,
+		0xA1, 0x8D, 0xBC, 0x9F, 0xD2, 0x82, 0x94, 0x01, 0x5A, 0x1B, 0x08, 0xFD, 0x05, 0x71, 0x48, 0x95,
+		0xCF, 0xF0, 0xC9, 0x85, 0xAA, 0x9F, 0xA6, 0xB1, 0x01, 0x10, 0x94, 0xB7, 0xEF, 0xC2, 0xC2, 0xE1,
+		0xAC, 0xFF, 0x0E, 0xBE, 0x0C, 0x00, 0xEF, 0x12, 0xB9, 0x1F, 0x4C, 0xCC, 0xAB, 0xA3, 0xAD, 0xED,
+		0x81, 0xB7, 0xA0, 0x96, 0x01, 0x10, 0xA7, 0xCF, 0x84, 0xE6, 0xD2, 0xF8, 0xD2, 0x86, 0xAD, 0x01,
+		0x8F, 0x04, 0xFC, 0xDA, 0x0E, 0xC4, 0x08, 0x44, 0x80, 0xB9, 0x8E, 0xBD, 0xE1, 0x93, 0xE4, 0xA1,
+		0x1A, 0x10, 0xAB, 0x95, 0xDF, 0xA1, 0xB7, 0xFA, 0xBB, 0xDB, 0x0E, 0x56, 0x16, 0x00, 0xEE, 0x05,
+		0xAB, 0x48, 0x80, 0x90, 0xD8, 0x9E, 0xC8, 0xA9, 0xC8, 0xA1, 0x38, 0x10, 0x90, 0xBF, 0xCE, 0xA3,
+		0xC6, 0xE1, 0xD8, 0x8D, 0x1D, 0x0E, 0xCF, 0x10, 0x05, 0x73, 0x48, 0xC0, 0xDD, 0x85, 0xB7, 0xA3,
+		0xC4, 0x9B, 0xA0, 0x63, 0x10, 0xBA, 0x9B, 0xAC, 0xA7, 0xF7, 0xE2, 0xC4, 0xB6, 0xAE, 0x01, 0x90,
+		0x00, 0xED, 0x05, 0xAD, 0x48, 0xC8, 0xA1, 0x99, 0xEA, 0xE8, 0xB8, 0xDE, 0xA3, 0xDB, 0x01, 0x10,
+		0x9B, 0xAF, 0xED, 0xF7, 0xBC, 0xB4, 0x9A, 0x98, 0x41, 0x24, 0x00, 0xFA, 0x05, 0x3A, 0x44, 0xFB,
+		0xDB, 0xC5, 0x84, 0xC6, 0x9E, 0xB3, 0xA6, 0x11, 0x10, 0x97, 0xD3, 0x90, 0xA1, 0x88, 0xE5, 0xD4,
+		0x8F, 0x12, 0x18, 0x0E, 0x00, 0x9F, 0x45, 0x07, 0x48, 0xE5, 0xDE, 0xCB, 0xD3, 0x94, 0x8E, 0xE8,
+		0xA4, 0xD9, 0x01, 0x10, 0xA2, 0xA7, 0x80, 0x85, 0xD4, 0xC9, 0xA3, 0xFD, 0x0E, 0x26, 0x18, 0x00,
+		0x8A, 0x05, 0x1D, 0x48, 0xCA, 0xD5, 0x94, 0x85, 0xF1, 0xD3, 0xC6, 0xA4, 0xF6, 0x01, 0x10, 0xA3,
+		0xB7, 0xD3, 0xCB, 0xF9, 0xBE, 0xF9, 0xE1, 0x0E, 0x92, 0x0F, 0x00, 0x89, 0x05, 0x1D, 0x48, 0xFF,
+		0xDB, 0xF1, 0xFD, 0xBE, 0x96, 0xFE, 0xA2, 0xCE, 0x01, 0x10, 0xBE, 0x81, 0xB3, 0xAD, 0x9F, 0xA6,
+		0xCC, 0x91, 0x61, 0xBD, 0x00, 0x88, 0x05, 0x1D, 0x44, 0xED, 0xB5, 0xE0, 0xB6, 0xFE, 0xB7, 0xF4,
+		0xA0, 0x7F, 0x10, 0x9C, 0x8F, 0xBF, 0x86, 0xB3, 0x80, 0x89, 0xD3, 0x12, 0x38, 0x09, 0x00, 0x87,
+		0x05, 0x1D, 0x48, 0x9C, 0xB2, 0x90, 0xFF, 0x87, 0x88, 0xEC, 0xA1, 0x48, 0x10, 0xBB, 0x9F, 0xF2,
+		0xC7, 0xFB, 0xB9, 0x81, 0xF8, 0xEF, 0x01, 0xCB, 0x00, 0x86, 0x05, 0x1D, 0x60, 0xA1, 0xD9, 0xE5,
+		0xA9, 0xDF, 0x8D, 0x8B, 0xA5, 0xC6, 0x01, 0x10, 0x9A, 0xC5, 0x83, 0x81, 0xFB, 0xC1, 0xAC, 0xA2,
+		0x48, 0x5A, 0x1B, 0x08, 0xDC, 0xED, 0x41, 0x41, 0x5C, 0x90, 0x98, 0x9A, 0x91, 0xA2, 0x9A, 0xB2,
+		0xA4, 0xC3, 0x01, 0x10, 0x81, 0xED, 0x8A, 0xA1, 0x83, 0xC0, 0xCD, 0xD6, 0x07, 0x5A, 0x1B, 0x08,
+		0x85, 0x05, 0x3A, 0x18, 0xB1, 0xAB, 0xB3, 0xE2, 0xDF, 0xA0, 0xCF, 0xE1, 0x42, 0x30, 0x80, 0xB1,
+		0xE0, 0xCB, 0xDB, 0xE2, 0x92, 0xAC, 0x0D, 0x5A, 0x1B, 0x08, 0x84, 0x05, 0x1D, 0x48, 0x8A, 0xF4,
+		0x99, 0x91, 0xF8, 0x8D, 0xA1, 0xA5, 0x65, 0x10, 0x98, 0xEF, 0xE9, 0xED, 0xE5, 0x86, 0x8C, 0x9D,
+		0x91, 0x01, 0x74, 0x00, 0x9E, 0x05, 0x1D, 0x44, 0xB1, 0xBD, 0xA4, 0xAC, 0xF3, 0x81, 0x95, 0xA2,
+		0x41, 0x10, 0x87, 0x91, 0xC9, 0x83, 0xB2, 0xD8, 0xFE, 0x94, 0x25, 0x5C, 0x00, 0x9D, 0x05, 0x1D,
+		0x4C, 0x9F, 0x8C, 0xAA, 0xE7, 0xD6, 0xEC, 0xCF, 0xA5, 0x30, 0x10, 0x98, 0x91, 0xF1, 0xD8, 0xA0,
+		0xD6, 0xEC, 0xC7, 0xCE, 0x01, 0x0E, 0x4D, 0x13, 0x65, 0x29, 0x48, 0xAA, 0xEE, 0xF2, 0xAC, 0x9A,
+		0xB5, 0xB5, 0xA0, 0xC8, 0x01, 0x10, 0xB1, 0x85, 0xB6, 0xAF, 0xFC, 0xA4, 0x96, 0xF8, 0x12, 0x49,
+		0x08, 0x00, 0x9B, 0x05, 0x1E, 0x4C, 0xE1, 0x90, 0x83, 0xD7, 0x99, 0xBD, 0xD7, 0xA7, 0xDA, 0x01,
+		0x10, 0x83, 0xCB, 0x8A, 0xC8, 0xFA, 0xE6, 0xA4, 0xBF, 0xEB, 0x01, 0x3C, 0x00, 0x9A, 0x05, 0x1E,
+		0x4C, 0xA1, 0x82, 0xD5, 0xA8, 0xEA, 0x8C, 0xE7, 0xA3, 0xEE, 0x01, 0x10, 0x87, 0xC1, 0x99, 0xAE,
+		0x9A, 0xBB, 0xB4, 0xBD, 0x8F, 0x41, 0x28, 0x04, 0x99, 0xDB, 0x41, 0x28, 0x58, 0xA6, 0xBB, 0x91,
+		0xA0, 0xA4, 0xBF, 0x9A, 0xA5, 0x33, 0x10, 0x9A, 0x87, 0xE2, 0xE5, 0xAC, 0xBA, 0xDA, 0x81, 0x56,
+		0x5A, 0x1B, 0x08, 0x98, 0x05, 0x93, 0x48, 0xCE, 0xB2, 0xBB, 0xB6, 0xA9, 0xE9, 0xC5, 0xA1, 0x09,
+		0x10, 0x89, 0x8B, 0x9E, 0xE2, 0x8F, 0xFB, 0xE0, 0xB0, 0xD8, 0x01, 0xCD, 0x00, 0x97, 0x05, 0x1D,
+		0x48, 0x85, 0xE4, 0xC0, 0xC0, 0xD8, 0xD6, 0xE3, 0xA0, 0x80, 0x01, 0x10, 0x9D, 0xD9, 0xE4, 0xD7,
+		0xD4, 0x87, 0xC9, 0xBB, 0x0E, 0xFE, 0x22, 0x00, 0x96, 0x05, 0x1D, 0x4C, 0xD4, 0xEA, 0xB3, 0xA6,
+		0xA5, 0x9E, 0xB6, 0xA5, 0x8F, 0x01, 0x10, 0x89, 0xB5, 0xE9, 0xB6, 0xDC, 0xC4, 0x85, 0xBE, 0x15,
+		0x0E, 0x31, 0x0D, 0x05, 0x1D, 0x48, 0xB0, 0x99, 0xC2, 0xAD, 0xA9, 0x8E, 0xCB, 0xA0, 0x10, 0x10,
+		0xBB, 0xE5, 0xE3, 0xA0, 0x8E, 0xAD, 0x91, 0x9E, 0xF2, 0x01, 0x90, 0x00, 0xF6, 0x45, 0x9C, 0x58,
+		0xEB, 0xFF, 0x8F, 0xD0, 0x9E, 0xB8, 0x8D, 0xA3, 0x7A, 0x10, 0xBD, 0xF3, 0x8A, 0xE4, 0xC0, 0xAC,
+		0xEA, 0xC6, 0x5F, 0x5A, 0x1B, 0x08, 0x83, 0x05, 0x39, 0x48, 0x85, 0x97, 0x86, 0x91, 0xF7, 0xE1,
+		0xCF, 0xA0, 0x33, 0x10, 0xB2, 0xC5, 0xF8, 0xD6, 0xD4, 0x94, 0xA4, 0xC6, 0xE8, 0x01, 0x39, 0x00,
+		0x94, 0x05, 0xC9, 0x58, 0xE1, 0xDC, 0xB9, 0xCF, 0xFB, 0x99, 0xDB, 0xA7, 0x17, 0x10, 0x99, 0xDF,
+		0xC8, 0xC2, 0x9E, 0xAA, 0xF4, 0x99, 0x08, 0x5A, 0x1C, 0x08, 0x93, 0x25, 0x03, 0x44, 0xF4, 0xD3,
+		0xEC, 0x88, 0xB2, 0xDA, 0xA2, 0xA4, 0xC2, 0x01, 0x10, 0xB5, 0x9B, 0xCA, 0xEC, 0xB7, 0xC3, 0x9D,
+		0x0E, 0x74, 0x0A, 0x08, 0x1B, 0x08, 0x92, 0x05, 0x57, 0x48, 0x8F, 0xD9, 0x9D, 0xEE, 0xDD, 0x8F,
+		0xDD, 0xA0, 0xED, 0x01, 0x10, 0xBF, 0xE7, 0xC6, 0xA8, 0xC2, 0xC3, 0xBF, 0xD8, 0x0E, 0x1A, 0x22,
+		0x00, 0x91, 0x05, 0x57, 0x44, 0xDD, 0xBC, 0xCD, 0x8E, 0xFC, 0xD4, 0xAC, 0x21, 0x10, 0x94, 0xA3,
+		0xAD, 0xBF, 0xCD, 0xFD, 0xB4, 0xB3, 0xC6, 0x21, 0x03, 0x00, 0x90, 0x05, 0x39, 0x5C, 0xE2, 0xDA,
+		0xCD, 0xD2, 0xA9, 0xDA, 0x9B, 0xA3, 0xA3, 0x01, 0x10, 0x9E, 0xF9, 0xEE, 0xD8, 0x91, 0xE0, 0xA8,
+		0xD6, 0x43, 0x5A, 0x1A, 0x08, 0x8F, 0x05, 0x39, 0x58, 0xDA, 0xA5, 0xCD, 0xCF, 0xD1, 0xAE, 0xD5,
+		0xA3, 0x19, 0x10, 0xA7, 0xA5, 0x9E, 0xA7, 0x9C, 0xCE, 0xD8, 0xB0, 0x46, 0x5A, 0x1B, 0x08, 0x8E,
+		0x05, 0x39, 0x48, 0xEE, 0x93, 0xE5, 0xB1, 0xFC, 0xB9, 0xE3, 0xA3, 0x2D, 0x10, 0x99, 0x97, 0xA4,
+		0xFB, 0x93, 0x96, 0xB0, 0xA3, 0xE2, 0x01, 0x56, 0x00, 0x8D, 0x05, 0x1D, 0x5C, 0xF6, 0xA6, 0xBC,
+		0x94, 0xF5, 0xC1, 0x90, 0xA1, 0x74, 0x10, 0x8B, 0x81, 0x9F, 0xD1, 0x93, 0xD0, 0xDF, 0xAA, 0x94,
+		0x01, 0x5A, 0x1B, 0x08, 0x8C, 0x05, 0x1D, 0x5C, 0xFA, 0x96, 0xFE, 0xAE, 0xBE, 0x94, 0xD6, 0xA7,
+		0xB3, 0x01, 0x10, 0x90, 0x95, 0x95, 0xAC, 0xDC, 0x84, 0xE7, 0x86, 0x15, 0x5A, 0x1A, 0x08, 0xE9,
+		0x25, 0x3C, 0x58, 0xF3, 0xF4, 0x96, 0xCA, 0xC6, 0x9B, 0xCA, 0xA5, 0x7D, 0x10, 0x9C, 0x8F, 0xE0,
+		0xFE, 0xBE, 0xEA, 0xAE, 0xBD, 0x03, 0x5A, 0x1B, 0x08, 0xF6, 0x65, 0x9E, 0x60, 0xB7, 0x8C, 0xEF,
+		0x93, 0xA1, 0xD2, 0x84, 0xA7, 0xC9, 0x01, 0x10, 0x8B, 0xF9, 0xF6, 0x9F, 0xAA, 0xEB, 0xA9, 0xD9,
+		0x1C, 0x5A, 0x1B, 0x08, 0xE8, 0xD7, 0x41, 0xF0, 0x48, 0xF0, 0xF7, 0xDA, 0xE4, 0x96, 0x92, 0xE4,
+		0xA2, 0x47, 0x10, 0xAF, 0xED, 0xFF, 0xD5, 0x94, 0xCE, 0x93, 0xB6, 0xAF, 0x41, 0x40, 0x00, 0xF5,
+		0xA5, 0x31, 0x18, 0xFD, 0x93, 0xC0, 0xA5, 0xD9, 0xAE, 0xF3, 0x0E, 0xE1, 0x14, 0x1C, 0x90, 0xB1,
+		0xAF, 0x83, 0xF8, 0xA0, 0xBE, 0xB3, 0x12, 0x2C, 0x12, 0x00, 0xEC, 0x05, 0x3B, 0x5C, 0x9E, 0xF1,
+		0xDB, 0x8E, 0xA3, 0xB1, 0xDB, 0xA3, 0x91, 0x01, 0x10, 0xBF, 0xBD, 0xB8, 0x94, 0xE2, 0xE5, 0x8F,
+		0x97, 0x65, 0x5A, 0x1A, 0x08, 0xF9, 0x85, 0x85, 0x58, 0x97, 0xF2, 0x93, 0xF7, 0xA4, 0xA7, 0xFA,
+		0xA6, 0x34, 0x10, 0xBB, 0xC3, 0xC6, 0x84, 0xEA, 0xB6, 0xD1, 0x85, 0x04, 0x5A, 0x1B, 0x08, 0xCC,
+		0x05, 0x91, 0x48, 0xA7, 0x9C, 0xDA, 0xEB, 0x93, 0x92, 0xDC, 0xA5, 0xD4, 0x01, 0x10, 0x88, 0xB1,
+		0xE4, 0xAD, 0xFB, 0xEE, 0xFE, 0x96, 0x0E, 0xA3, 0x1A, 0x00, 0xCB, 0x05, 0x1D, 0x18, 0xB8, 0xA9,
+		0xD9, 0xAD, 0x95, 0x86, 0xE9, 0x01, 0x56, 0x30, 0x99, 0xB7, 0xFB, 0x95, 0x96, 0xED, 0xCC, 0xE9,
+		0x19, 0x5A, 0x1A, 0x08, 0xD3, 0x05, 0x56, 0x58, 0xB5, 0xA2, 0xB8, 0xBF, 0xDA, 0x86, 0xF1, 0xA4,
+		0x4D, 0x10, 0xB3, 0xA3, 0x8D, 0xEF, 0xA9, 0xC4, 0xB6, 0x99, 0x18, 0x5A, 0x1A, 0x08, 0xD2, 0x05,
+		0x1C, 0x44, 0xC6, 0xFE, 0x82, 0xCF, 0xDC, 0xE6, 0xAA, 0xA3, 0x46, 0x10, 0xBE, 0xFB, 0xB2, 0x9D,
+		0xA9, 0x81, 0xA8, 0xFD, 0x0E, 0xA4, 0x0E, 0x00, 0xC4, 0x05, 0xAB, 0x18, 0xFE, 0xCE, 0x99, 0x8F,
+		0x96, 0xBC, 0xF6, 0x0E, 0xDD, 0x0A, 0x30, 0xB4, 0x93, 0xF3, 0xF0, 0xA8, 0xC6, 0x9D, 0xEE, 0x5E,
+		0x5A, 0x1A, 0x08, 0xD1, 0x05, 0x39, 0x58, 0xE9, 0x98, 0xE8, 0x84, 0xC7, 0xC2, 0xEE, 0xA2, 0x7B,
+		0x10, 0xBA, 0xD3, 0x8F, 0xFB, 0xC4, 0xAF, 0x9E, 0xAF, 0x06, 0x5A, 0x1B, 0x08, 0xC3, 0x05, 0x39,
+		0x48, 0x85, 0xB4, 0x93, 0x92, 0x9B, 0x83, 0xF4, 0xA3, 0x17, 0x10, 0xB9, 0xB1, 0xF4, 0xFB, 0xF2,
+		0xAD, 0xBA, 0xA7, 0xA2, 0x21, 0x1F, 0x00, 0xD0, 0x25, 0x1F, 0x4C, 0xDE, 0x96, 0xF9, 0x85, 0xA4,
+		0xC8, 0xB8, 0xA0, 0xB6, 0x01, 0x10, 0xA5, 0xEB, 0xD6, 0xA4, 0x88, 0xE4, 0xB3, 0xC9, 0xB3, 0x21,
+		0xB0, 0x00, 0xCF, 0x05, 0xC9, 0x48, 0x8E, 0xA6, 0x8B, 0x81, 0x9C, 0x95, 0x90, 0xA2, 0x66, 0x10,
+		0xA6, 0xAD, 0xD0, 0xA1, 0xFF, 0xB9, 0xEF, 0xFF, 0xA7, 0x41, 0xB3, 0x00, 0xCE, 0x05, 0x74, 0x58,
+		0xF4, 0xD3, 0xFC, 0xC7, 0xD4, 0xA1, 0xF0, 0xA4, 0x66, 0x10, 0xB4, 0xBF, 0xD7, 0xFC, 0xFD, 0xEB,
+		0xD3, 0xE7, 0x7A, 0x5A, 0x1B, 0x08, 0xE6, 0x05, 0x74, 0x4C, 0xEF, 0xCF, 0xBC, 0xF5, 0xF8, 0x9B,
+		0x88, 0xA6, 0xA4, 0x01, 0x10, 0x8C, 0x8D, 0xA6, 0xD5, 0xBD, 0xD4, 0xE2, 0xFA, 0x2F, 0x0E, 0xCA,
+		0x15, 0x05, 0x56, 0x44, 0x93, 0x87, 0xF8, 0xB4, 0x9C, 0xA1, 0x8C, 0xA6, 0x14, 0x10, 0x84, 0x9F,
+		0xDB, 0x9F, 0xAF, 0xB3, 0x86, 0xC7, 0x12, 0x79, 0x08, 0x00, 0xE1, 0x05, 0x1D, 0x48, 0xFA, 0xE1,
+		0xE3, 0xCF, 0xC1, 0xD3, 0xB2, 0xA3, 0x96, 0x01, 0x10, 0x9D, 0x89, 0xE7, 0xD5, 0xC4, 0xA4, 0xFC,
+		0xF9, 0x0E, 0x75, 0x16, 0x00, 0xD4, 0x45, 0x23, 0x58, 0xB9, 0xF0, 0xE0, 0xBC, 0xF7, 0xDF, 0x9C,
+		0xA2, 0x7A, 0x10, 0xA0, 0xC9, 0xB0, 0x9E, 0xE0, 0xC3, 0xC2, 0xCF, 0x4D, 0x5A, 0x1B, 0x08, 0xDE,
+		0x05, 0x39, 0x5C, 0xA0, 0xD6, 0xB7, 0xBD, 0xB5, 0xDE, 0xCA, 0xA6, 0xED, 0x01, 0x10, 0xB3, 0xD9,
+		0xA1, 0xCB, 0xB7, 0x87, 0x96, 0x8D, 0x1E, 0x5A, 0x1A, 0x08, 0xE0, 0x05, 0xAC, 0x58, 0x9F, 0xBD,
+		0x88, 0x89, 0xBE, 0xFC, 0xCA, 0xA6, 0x71, 0x10, 0xB2, 0x8D, 0x91, 0xB1, 0x89, 0xA7, 0xD9, 0xA6,
+		0x17, 0x5A, 0x1C, 0x08, 0xD3, 0xC5, 0x8A, 0x48, 0xBE, 0xFD, 0xD0, 0x8F, 0x9B, 0x93, 0xAC, 0xA5,
+		0x91, 0x01, 0x10, 0xAC, 0xDB, 0x8E, 0xF4, 0xFE, 0xD1, 0xEC, 0xE5, 0xA5, 0x6A, 0x00, 0xDD, 0x05,
+		0x57, 0x44, 0xF1, 0xD9, 0xC3, 0x8A, 0x87, 0xB5, 0xA9, 0xA3, 0x3B, 0x10, 0xAB, 0xC5, 0x8C, 0xEF,
+		0xFD, 0xBD, 0xEA, 0xE3, 0x12, 0xA6, 0x0B, 0x00, 0xDC, 0x05, 0x1D, 0x48, 0xBF, 0xA2, 0x88, 0xB9,
+		0xBD, 0xD0, 0xC3, 0xA4, 0x7D, 0x10, 0x82, 0xA3, 0xBC, 0x9A, 0xC7, 0x90, 0xD6, 0xAA, 0xD6, 0x21,
+		0x3D, 0x00, 0xDB, 0x05, 0x1D, 0x48, 0x99, 0xB1, 0xAE, 0xDB, 0xBE, 0x90, 0x9D, 0xA4, 0x3E, 0x10,
+		0x8E, 0x9F, 0xB0, 0xEA, 0xF2, 0xA7, 0xAE, 0xB9, 0xC1, 0x01, 0x1D, 0x00, 0xDA, 0x05, 0x1D, 0x18,
+		0xF0, 0xB9, 0xBF, 0xC9, 0x83, 0xE4, 0xD4, 0x0E, 0x3B, 0x16, 0x30, 0xA4, 0xF7, 0x8E, 0x8B, 0xE2,
+		0xB4, 0xA7, 0x80, 0x7C, 0x5A, 0x1C, 0x08, 0xD9, 0x25, 0x95, 0x48, 0xD3, 0xDA, 0xF9, 0xE6, 0xBC,
+		0xDD, 0xC8, 0xA6, 0xD0, 0x01, 0x10, 0xA4, 0xD3, 0x9B, 0xFF, 0xC5, 0xFC, 0x96, 0xFE, 0x12, 0x5B,
+		0x0D, 0x00, 0xE5, 0x25, 0x5C, 0x5C, 0xCC, 0xE1, 0xFF, 0xE1, 0xE2, 0x80, 0xF5, 0xA7, 0xAB, 0x01,
+		0x10, 0xAC, 0xBD, 0xFE, 0xDE, 0x8A, 0xD9, 0xEE, 0x95, 0x6F, 0x5A, 0x1C, 0x08, 0xF2, 0x05, 0x3B,
+		0x20, 0xE6, 0xA2, 0x9F, 0xB7, 0xC7, 0xBE, 0x8C, 0xA4, 0x9A, 0x0E, 0xB4, 0x0D, 0x18, 0xF3, 0xBE,
+		0xB5, 0x81, 0xA2, 0xD0, 0xE7, 0x01, 0x76, 0x00, 0xE4, 0x05, 0x3B, 0x48, 0xD6, 0x8E, 0x82, 0xCE,
+		0xA3, 0xF1, 0xFC, 0xA6, 0xF7, 0x01, 0x10, 0xA7, 0xFD, 0x88, 0xCA, 0xF8, 0xB3, 0xE6, 0xEA, 0x0E,
+		0xE4, 0x2A, 0x00, 0xF1, 0x05, 0x93, 0x48, 0xD9, 0xBF, 0x85, 0xA8, 0x95, 0xEF, 0xED, 0xA0, 0xBC,
+		0x01, 0x10, 0xA3, 0xCB, 0xC6, 0xDE, 0xC3, 0xC8, 0xBC, 0xAD, 0x0E, 0x21, 0x0D, 0x00, 0xE3, 0x05,
+		0x3A, 0x44, 0xB0, 0x99, 0x98, 0xD1, 0xC9, 0xD6, 0xC0, 0xA7, 0x12, 0x10, 0x93, 0xB1, 0xB2, 0x80,
+		0xD6, 0x83, 0x99, 0xEF, 0x12, 0xEA, 0x16, 0x00, 0xF0, 0x05, 0x3A, 0x48, 0xC4, 0xA0, 0xEC, 0xEB,
+		0xBD, 0xE2, 0x8F, 0xA2, 0x26, 0x10, 0x93, 0xAD, 0xD8, 0xB0, 0xBA, 0xA9, 0xD3, 0xAB, 0xA1, 0x41,
+		0x27, 0x00, 0xE2, 0x25, 0xB4, 0x44, 0x95, 0x89, 0xA4, 0xFF, 0xF5, 0x8E, 0xF2, 0xA5, 0x7A, 0x10,
+		0x8D, 0xE5, 0xDA, 0xF7, 0xEB, 0xDA, 0xF9, 0x86, 0x0E, 0x82, 0x19, 0x00, 0xEF, 0x25, 0x97, 0x44,
+		0x87, 0xD8, 0xEC, 0xD4, 0xF8, 0x90, 0x9B, 0xA6, 0x31, 0x10, 0x84, 0x83, 0xC2, 0xAE, 0xF2, 0x9A,
+		0xDC, 0x94, 0x0E, 0xB0, 0x0D, 0x00, 0xE1, 0x05, 0x72, 0x4C, 0xA7, 0x9D, 0xE1, 0x8D, 0xEE, 0xA8,
+		0xD2, 0xA4, 0x88, 0x01, 0x10, 0x8C, 0xB9, 0xC7, 0x8A, 0xDC, 0x84, 0x8D, 0xF7, 0x1A, 0x0E, 0x87,
+		0x21, 0x05, 0x72, 0x44, 0xD4, 0xBA, 0xA1, 0xAF, 0xCA, 0xF4, 0xB3, 0xA0, 0x15, 0x10, 0x99, 0x85,
+		0xC3, 0xF8, 0xF5, 0xBD, 0xE3, 0xA4, 0x12, 0xF7, 0x0A, 0x00, 0xE0, 0x25, 0xD1, 0x4C, 0xA1, 0xA6,
+		0x87, 0x94, 0xB0, 0xB9, 0xD6, 0xA2, 0x9E, 0x01, 0x10, 0x97, 0xFF, 0xA1, 0xDD, 0x99, 0xBE, 0xE4,
+		0xF7, 0xFD, 0x41, 0xF2, 0x00, 0xED, 0x25, 0x22, 0x48, 0xBA, 0xF4, 0xBA, 0xA1, 0x8B, 0x93, 0x84,
+		0xA4, 0x91, 0x01, 0x10, 0x9D, 0xC7, 0x97, 0xE7, 0x9E, 0xDB, 0x99, 0xDE, 0x12, 0x08, 0x09, 0x00,
+		0xDF, 0x05, 0xAE, 0x44, 0xF6, 0xBD, 0xDC, 0x95, 0xAD, 0xB0, 0xA4, 0xA5, 0x31, 0x10, 0x84, 0xA1,
+		0xB9, 0xF8, 0xD1, 0xEE, 0xA7, 0xFD, 0x0E, 0x2A, 0x0A, 0x00, 0xEC, 0x05, 0x75, 0x18, 0x98, 0xC9,
+		0x88, 0x81, 0xB4, 0xF2, 0xB5, 0x0E, 0x6B, 0x29, 0x1C, 0x9D, 0x8B, 0xC0, 0x94, 0xF7, 0xC1, 0xCD,
+		0x85, 0x0E, 0xD1, 0x17, 0x00, 0xDE, 0x05, 0x39, 0x44, 0x8F, 0x82, 0xF6, 0x83, 0xAB, 0xD2, 0x9E,
+		0xA3, 0x51, 0x10, 0x87, 0xA9, 0xDF, 0x99, 0xEA, 0xC9, 0xB4, 0xAF, 0x0E, 0xF6, 0x20, 0x00, 0xEB,
+		0x05, 0x73, 0x4C, 0xE6, 0xE9, 0xA6, 0xB0, 0xED, 0xFE, 0xCF, 0xA3, 0xFC, 0x01, 0x10, 0xA8, 0x9B,
+		0xA8, 0x99, 0xA7, 0xBF, 0xAE, 0xAD, 0xC2, 0x01, 0x91, 0x00, 0xDD, 0x05, 0xAF, 0x18, 0xAE, 0x9F,
+		0x80, 0x92, 0xBF, 0x84, 0xB8, 0x0E, 0x27, 0x09, 0x1C, 0x80, 0xA9, 0xAE, 0x80, 0x89, 0x98, 0xE1,
+		0xEE, 0x12, 0x93, 0x0D, 0x00, 0xEA, 0x05, 0x3C, 0x48, 0xAB, 0xCE, 0xDE, 0x8B, 0x8A, 0xC3, 0xA9,
+		0xA2, 0xEA, 0x01, 0x10, 0x8E, 0xED, 0xF2, 0xFE, 0xA4, 0xD4, 0xF1, 0xFA, 0xE5, 0x77, 0x00, 0xDC,
+		0x25, 0x25, 0x48, 0xE7, 0xB1, 0xAB, 0xEB, 0x85, 0xBA, 0xA8, 0xA4, 0x28, 0x10, 0x80, 0xE9, 0xA6,
+		0x91, 0xA2, 0xDD, 0xBA, 0x92, 0xC3, 0x01, 0x59, 0x00, 0xE9, 0x05, 0x3B, 0x4C, 0x9C, 0x80, 0xFB,
+		0xDA, 0xB4, 0xE1, 0x8C, 0xA3, 0xC3, 0x01, 0x10, 0xAA, 0xD5, 0xC9, 0xE3, 0xEF, 0x82, 0xB9, 0xF0,
+		0xD8, 0x41, 0x0C, 0x00, 0xDB, 0x05, 0x3B, 0x44, 0xB4, 0x9F, 0xFB, 0x96, 0x9C, 0xEE, 0xC2, 0xA6,
+		0x5E, 0x10, 0xA8, 0xAD, 0xD4, 0x88, 0xAD, 0x94, 0xB1, 0xC6, 0x12, 0x50, 0x21, 0x00, 0xE8, 0x05,
+		0xEB, 0x48, 0x9A, 0x8A, 0xF3, 0xAB, 0xCE, 0x9A, 0xC5, 0xA3, 0x05, 0x10, 0xB0, 0xC7, 0x9F, 0xEF,
+		0xBE, 0xEF, 0xE7, 0x84, 0xF4, 0x01, 0x3A, 0x00, 0xE7, 0x05, 0x1D, 0x48, 0x87, 0xE0, 0xE6, 0xBF,
+		0xAA, 0xCF, 0xC8, 0xA5, 0x78, 0x10, 0x93, 0x87, 0xC1, 0xED, 0xAE, 0xA5, 0xFA, 0xDE, 0xD0, 0x21,
+		0xEF, 0x00, 0xA7, 0x12, 0xFA, 0x13, 0x58, 0xC3, 0x9A, 0xBC, 0xF1, 0x92, 0xF0, 0xF7, 0xA7, 0x45,
+		0x10, 0x9F, 0xD3, 0xBF, 0xB8, 0xA1, 0x85, 0xF5, 0xE5, 0x45, 0x5A, 0x1C, 0x08, 0xE2, 0x05, 0x91,
+		0x4C, 0xC5, 0xEA, 0xFE, 0xEB, 0xD1, 0x99, 0xFD, 0xA6, 0xC9, 0x01, 0x10, 0xA3, 0xA3, 0xEA, 0xDB,
+		0x8B, 0x9C, 0xB1, 0x86, 0x8D, 0x01, 0xAF, 0x00, 0xA6, 0x12, 0xDD, 0x13, 0x4C, 0xFD, 0x96, 0x81,
+		0x81, 0xFD, 0xBD, 0xC0, 0xA4, 0x8B, 0x01, 0x10, 0xBA, 0x8F, 0xCE, 0xDD, 0xE8, 0xEF, 0xF8, 0xA0,
+		0x89, 0x01, 0x1E, 0x00, 0xA5, 0x05, 0x1E, 0x18, 0x8F, 0xDA, 0xCA, 0x8F, 0xBB, 0x8E, 0xF2, 0x0E,
+		0xF6, 0x2D, 0x20, 0xBD, 0xC3, 0xDF, 0xFA, 0xA0, 0xE9, 0xE6, 0xAB, 0xBA, 0x01, 0x93, 0x00, 0xDF,
+		0x05, 0x93, 0x48, 0xB5, 0xB6, 0xA6, 0x95, 0xE5, 0x95, 0x90, 0xA4, 0x76, 0x10, 0x86, 0xE7, 0x88,
+		0xEF, 0xEF, 0xE0, 0xBB, 0xE6, 0xE6, 0x01, 0x3B, 0x00, 0xD6, 0x05, 0x77, 0x48, 0xB5, 0xA8, 0xF1,
+		0x9B, 0xD7, 0x84, 0x9A, 0xA5, 0xF7, 0x01, 0x10, 0xB6, 0xF5, 0xAB, 0xEA, 0xD0, 0xFE, 0xB0, 0x86,
+		0xC5, 0xB1, 0x00, 0xD5, 0x05, 0x3B, 0x4C, 0xA4, 0xED, 0xDE, 0xF1, 0xC8, 0xA3, 0xF3, 0xA2, 0xB7,
+		0x01, 0x10, 0xB5, 0xCF, 0xEB, 0xE0, 0xE9, 0x81, 0xF7, 0xB1, 0x40, 0x0E, 0x7F, 0x2C, 0x05, 0x1D,
+		0x48, 0x88, 0xAA, 0x9B, 0xAC, 0xDF, 0xAF, 0x90, 0xA0, 0x64, 0x10, 0x9E, 0xDF, 0xEF, 0xBA, 0xE9,
+		0xE9, 0x92, 0xA5, 0xC9, 0x01, 0xEB, 0x00, 0xC9, 0x45, 0xBE, 0x58, 0x80, 0xE3, 0xB4, 0x89, 0xC9,
+		0xFE, 0xC5, 0xA7, 0x74, 0x10, 0xA9, 0xED, 0xD6, 0xD6, 0xF0, 0xE7, 0x97, 0xBD, 0x39, 0x5A, 0x1B,
+		0x08, 0xCD, 0x05, 0x39, 0x44, 0xCE, 0x94, 0xF4, 0xFA, 0xB3, 0xAB, 0x88, 0xA0, 0x4A, 0x10, 0x8A,
+		0xD1, 0x9A, 0x86, 0x89, 0xCC, 0xB8, 0xBB, 0x12, 0x8A, 0x19, 0x00, 0xF4, 0x45, 0x2C, 0x58, 0xAD,
+		0xBC, 0xC9, 0xCA, 0xB6, 0xFC, 0xA6, 0xA7, 0x40, 0x10, 0x81, 0xC9, 0xFE, 0xF0, 0xA9, 0xFB, 0xC3,
+		0x9F, 0x3A, 0x5A, 0x1C, 0x08, 0x81, 0xE5, 0xED, 0x18, 0xAD, 0xBA, 0xDB, 0xBA, 0xBA, 0xF6, 0xE3,
+		0xA1, 0xE7, 0x20, 0x9B, 0xC9, 0xD9, 0x8D, 0xED, 0xDC, 0xD0, 0xF5, 0xCB, 0x01, 0xCB, 0x00, 0xE5,
+		0x05, 0x1E, 0x18, 0xD7, 0xC9, 0x90, 0xFC, 0xAC, 0xF7, 0xC0, 0x21, 0x42, 0x20, 0xB6, 0x99, 0x99,
+		0xAC, 0x91, 0xF5, 0xB2, 0x97, 0xB0, 0x21, 0x06, 0x00, 0xA0, 0x05, 0x75, 0x44, 0x8B, 0xD1, 0xFD,
+		0xB3, 0xEA, 0xDC, 0xC7, 0xA6, 0xDE, 0x01, 0x10, 0x98, 0xFB, 0xC3, 0xE8, 0x8D, 0xF5, 0xA7, 0x12,
+		0x6B, 0x13, 0x00, 0xE4, 0xE5, 0x7C, 0x1C, 0xC7, 0x90, 0xD4, 0xC2, 0x90, 0xE3, 0xE5, 0xA0, 0x0E,
+		0x77, 0x15, 0x1C, 0xD7, 0xFC, 0xD1, 0xD2, 0xB4, 0xCE, 0xD2, 0x71, 0x0E, 0x15, 0x2E, 0x05, 0x3A,
+		0x48, 0xC2, 0xBD, 0xE7, 0x89, 0xBA, 0xA6, 0x8C, 0xA1, 0x9B, 0x01, 0x10, 0xAA, 0x93, 0xF5, 0xCD,
+		0xB9, 0x97, 0xA5, 0xBF, 0x0E, 0x0F, 0x09, 0x00, 0xEC, 0x05, 0x3A, 0x4C, 0xCC, 0xE5, 0x82, 0xBA,
+		0xA4, 0xA1, 0xA3, 0xA2, 0xC7, 0x01, 0x10, 0x94, 0xE9, 0xAB, 0xA9, 0x92, 0xA7, 0xE8, 0xA5, 0x48,
+		0x0E, 0x01, 0x11, 0x05, 0x3A, 0x5C, 0x88, 0xC1, 0xA6, 0xA5, 0xDE, 0xB3, 0x94, 0xA0, 0xDC, 0x01,
+		0x10, 0x8E, 0xD3, 0x9B, 0x98, 0xB2, 0x8A, 0xE0, 0xD3, 0x6D, 0x5A, 0x1B, 0x08, 0xEB, 0x05, 0x3A,
+		0x4C, 0xCE, 0xF7, 0xF0, 0xDA, 0xC1, 0xF8, 0x85, 0xA5, 0xE7, 0x01, 0x10, 0xA7, 0xB3, 0x95, 0xF2,
+		0xC7, 0xF7, 0xC9, 0xEA, 0x45, 0x0E, 0x01, 0x28, 0x45, 0x81, 0x48, 0x9E, 0x89, 0xED, 0xA2, 0xDC,
+		0xED, 0xFE, 0xA3, 0x1D, 0x10, 0xAF, 0xBD, 0x80, 0xB4, 0xA3, 0xB6, 0x96, 0xDA, 0x89, 0x01, 0xCB,
+		0x00, 0xA6, 0x05, 0x57, 0x48, 0xA3, 0xD7, 0xEB, 0xD9, 0xBF, 0xFB, 0x87, 0xA4, 0x0E, 0x10, 0xA2,
+		0xA1, 0xCA, 0xFC, 0x97, 0xD4, 0x98, 0xDE, 0xBF, 0x21, 0x79, 0x00, 0xEA, 0x12, 0x9D, 0x08, 0x58,
+		0xEA, 0xB1, 0x81, 0xC5, 0x90, 0xCC, 0x85, 0xA7, 0x7D, 0x10, 0x89, 0xBB, 0xA9, 0xCB, 0xEE, 0xF6,
+		0x97, 0x85, 0x20, 0x5A, 0x1B, 0x08, 0xA5, 0x05, 0x39, 0x18, 0xFF, 0x89, 0xB7, 0xA9, 0xEB, 0xCC,
+		0xE8, 0x0E, 0x5C, 0x23, 0x1C, 0x9E, 0xEF, 0x94, 0xAA, 0xEC, 0xA9, 0x95, 0xEE, 0x61, 0xC2, 0x00,
+		0xE9, 0x05, 0x90, 0x18, 0xA7, 0xE0, 0xDF, 0x89, 0xA2, 0x95, 0x96, 0x61, 0x89, 0x30, 0xBF, 0xE9,
+		0xB7, 0x93, 0xA0, 0x92, 0xED, 0xA3, 0x40, 0x5A, 0x1C, 0x08, 0xA4, 0x45, 0x27, 0x64, 0xA1, 0xF8,
+		0x8C, 0xEB, 0xC9, 0x95, 0x92, 0xA1, 0xFB, 0x01, 0x10, 0xA9, 0xCB, 0x80, 0xD6, 0xB7, 0xC0, 0xBD,
+		0xD7, 0xB4, 0x01, 0x5A, 0x19, 0x08, 0xE8, 0xDB, 0x0E, 0x05, 0x0D, 0x54, 0x91, 0xFB, 0x91, 0x93,
+		0x8A, 0x88, 0x89, 0x26, 0x10, 0xA7, 0xE7, 0xD5, 0xBE, 0x8C, 0xBA, 0xD2, 0xB5, 0x67, 0x5A, 0x1A,
+		0x08, 0xA3, 0x45, 0x08, 0x58, 0xC0, 0xE9, 0x85, 0xD0, 0xD4, 0xD5, 0x86, 0xA2, 0x29, 0x10, 0x85,
+		0x93, 0xFC, 0xA8, 0xC5, 0xC9, 0xDF, 0xF2, 0x6C, 0x5A, 0x1B, 0x08, 0xE7, 0x05, 0x72, 0x5C, 0xDA,
+		0xB8, 0xB0, 0xA1, 0xBA, 0xEE, 0xBB, 0xA5, 0xA6, 0x01, 0x10, 0x83, 0x9B, 0xFF, 0xA1, 0xAD, 0x95,
+		0xD7, 0xF2, 0x71, 0x5A, 0x1A, 0x08, 0xA2, 0x05, 0x39, 0x44, 0xFD, 0xBE, 0xEC, 0xE9, 0xB5, 0xF5,
+		0x89, 0xA0, 0x40, 0x10, 0x8D, 0x8B, 0x85, 0xB5, 0x92, 0xE1, 0x86, 0xA7, 0x0E, 0x2B, 0x18, 0x00,
+		0xC7, 0x05, 0xC8, 0x48, 0xA8, 0x9E, 0xE1, 0xB5, 0xBB, 0xCD, 0x95, 0xA3, 0x6F, 0x10, 0x99, 0xB1,
+		0xCB, 0x93, 0xED, 0xE1, 0x8B, 0xAA, 0xD1, 0x41, 0x07, 0x00, 0xB2, 0x05, 0xAB, 0x18, 0xCC, 0xEC,
+		0x82, 0x89, 0xC6, 0xB9, 0xC5, 0x0E, 0x01, 0x12, 0x1C, 0xA2, 0xFF, 0xC8, 0xAB, 0xC7, 0xA7, 0xC6,
+		0xBA, 0x65, 0x0D, 0x00, 0xB1, 0x05, 0x3B, 0x18, 0xA5, 0xBF, 0xAA, 0xCB, 0xBB, 0xAA, 0x96, 0xC1,
+		0x21, 0x30, 0xAA, 0xFD, 0xFE, 0x96, 0x8F, 0xF2, 0xCC, 0xE3, 0x50, 0x5A, 0x1B, 0x08, 0xB0, 0x05,
+		0x1D, 0x48, 0xB9, 0xB1, 0xE7, 0xF7, 0xDC, 0xFC, 0xA0, 0xA2, 0x72, 0x10, 0xA4, 0xD7, 0xF7, 0xFF,
+		0xA5, 0xE0, 0xB1, 0xC6, 0xAE, 0x01, 0x58, 0x00, 0xA2, 0x85, 0x8B, 0x4C, 0xD4, 0xB3, 0xED, 0xBD,
+		0xEE, 0xB0, 0xE3, 0xA3, 0xD1, 0x01, 0x10, 0xAD, 0xDB, 0x9D, 0xF2, 0xEE, 0x92, 0x8D, 0xC9, 0x9F,
+		0x01, 0x1E, 0x00, 0xAF, 0x05, 0x76, 0x18, 0x8A, 0xB9, 0xCC, 0x9D, 0xCA, 0x88, 0xC0, 0x0E, 0x87,
+		0x19, 0x20, 0xA6, 0xFF, 0xB8, 0xBD, 0xAC, 0xA0, 0xFA, 0xF4, 0xFA, 0x01, 0x1E, 0x00, 0xAE, 0x05,
+		0x1E, 0x4C, 0xB5, 0xFE, 0x8A, 0xD3, 0x9B, 0x8A, 0xD9, 0xA1, 0xA9, 0x01, 0x10, 0x93, 0x89, 0x9B,
+		0xC9, 0x9C, 0x87, 0xE8, 0xDF, 0xA9, 0x21, 0xD0, 0x00, 0xF2, 0x25, 0x08, 0x48, 0xAF, 0xC4, 0x8B,
+		0xD3, 0x98, 0xDC, 0xF0, 0xA5, 0x04, 0x10, 0x8C, 0xED, 0xFA, 0xCC, 0xE5, 0xDD, 0xDA, 0x82, 0xAC,
+		0x01, 0x1D, 0x00, 0xAD, 0x05, 0x94, 0x48, 0xF5, 0xBF, 0xF1, 0xAD, 0xB0, 0x8B, 0xEA, 0xA3, 0x73,
+		0x10, 0xA3, 0xF5, 0xFF, 0xC4, 0x80, 0xB9, 0xC5, 0xC6, 0xBF, 0x01, 0x58, 0x00, 0xF1, 0x45, 0xF3,
+		0x18, 0xB2, 0xC4, 0xFC, 0x98, 0xBA, 0xFB, 0xFF, 0x01, 0x58, 0x18, 0xA2, 0xF3, 0xED, 0xDE, 0xEF,
+		0xCC, 0xCE, 0x0E, 0x50, 0x2D, 0x08, 0x1B, 0x08, 0xAC, 0x05, 0x3B, 0x48, 0x86, 0xB8, 0xF6, 0x92,
+		0xA2, 0xF4, 0x8A, 0xA3, 0x57, 0x10, 0x92, 0xC9, 0xA2, 0xC2, 0xF9, 0xCE, 0xCE, 0x91, 0xDC, 0x41,
+		0x28, 0x00, 0xC6, 0x25, 0x60, 0x44, 0xBD, 0xFB, 0x88, 0xBE, 0xB3, 0xC0, 0xA0, 0xA6, 0x30, 0x10,
+		0x98, 0x8B, 0xDC, 0xAF, 0xB4, 0xA0, 0xD1, 0x8C, 0x0E, 0x87, 0x09, 0x00, 0xC5, 0x05, 0x1C, 0x58,
+		0xC7, 0xB4, 0xDF, 0x95, 0xD9, 0x99, 0xA6, 0xA4, 0x84, 0x01, 0x10, 0x8C, 0xC9, 0xD8, 0xF7, 0xE5,
+		0x82, 0xAC, 0x5A, 0x5A, 0x1B, 0x08, 0xB7, 0x45, 0x9A, 0x48, 0xAB, 0x9B, 0xE3, 0xB5, 0xAE, 0xC2,
+		0xCC, 0xA3, 0x30, 0x10, 0x89, 0x89, 0x80, 0x97, 0xB0, 0x9C, 0xE0, 0xCF, 0xD9, 0x01, 0xAD, 0x00,
+		0xC4, 0x05, 0x72, 0x5C, 0xAC, 0xB9, 0xDE, 0xF6, 0xB5, 0xC5, 0xE8, 0xA7, 0xD6, 0x01, 0x10, 0xB6,
+		0xC3, 0xAF, 0x83, 0xE8, 0x89, 0xC8, 0x8B, 0x1E, 0x5A, 0x1C, 0x08, 0xC3, 0x25, 0x05, 0x4C, 0xC8,
+		0xE2, 0xEB, 0xC6, 0x94, 0xA7, 0xC8, 0xA0, 0x98, 0x01, 0x10, 0x9C, 0x97, 0x97, 0xBD, 0x99, 0xD3,
+		0xB7, 0x84, 0xB9, 0x01, 0xCB, 0x00, 0xC2, 0x05, 0x1E, 0x48, 0xBE, 0xF7, 0xBA, 0x8A, 0xCE, 0x85,
+		0xF3, 0xA3, 0xDA, 0x01, 0x10, 0xA6, 0xCD, 0x9B, 0x8C, 0xDE, 0x8E, 0xBF, 0xE2, 0x12, 0xA0, 0x0F,
+		0x00, 0xC1, 0x05, 0x59, 0x48, 0xB1, 0xFA, 0x8C, 0xD3, 0xCB, 0xD3, 0x9A, 0xA3, 0x08, 0x10, 0xBF,
+		0x93, 0xF5, 0x99, 0xE5, 0xE9, 0xB7, 0xE4, 0xC3, 0x01, 0x76, 0x00, 0xBF, 0x05, 0x1D, 0x48, 0xE0,
+		0xEE, 0xF9, 0xCC, 0x92, 0x94, 0xB2, 0xA1, 0x36, 0x10, 0xBE, 0xB9, 0xCA, 0xC2, 0xA1, 0x99, 0xC6,
+		0xE1, 0xE9, 0x01, 0xE8, 0x00, 0xBE, 0x05, 0xCC, 0x58, 0xCB, 0xF7, 0x8B, 0xB4, 0xF9, 0x9D, 0x8F,
+		0xA5, 0x1B, 0x10, 0x9C, 0xFB, 0xD2, 0x9F, 0xD2, 0x88, 0x8C, 0x8D, 0x39, 0x5A, 0x1C, 0x08, 0xE5,
+		0x05, 0x74, 0x4C, 0x9D, 0xD7, 0xBF, 0xD5, 0xED, 0xB6, 0xEA, 0xA3, 0xD5, 0x01, 0x10, 0x91, 0xF9,
+		0x9E, 0xE6, 0x8B, 0xDD, 0xF1, 0xA5, 0x98, 0x01, 0x57, 0x00, 0xBC, 0x05, 0x57, 0x20, 0x82, 0xE8,
+		0xD8, 0xB7, 0xEB, 0xE5, 0x97, 0xA6, 0xD1, 0x0E, 0x91, 0x0B, 0x28, 0xC9, 0xED, 0xB6, 0xED, 0xBE,
+		0xD9, 0x3F, 0x5A, 0x1A, 0x08, 0xE4, 0x05, 0x57, 0x44, 0x85, 0xB4, 0xF9, 0x85, 0xDD, 0x9B, 0x80,
+		0xA1, 0x75, 0x10, 0xA0, 0xA1, 0xF7, 0x91, 0xBA, 0x84, 0xE9, 0xB8, 0x0E, 0x26, 0x31, 0x00, 0xBB,
+		0x05, 0x57, 0x18, 0x85, 0xFA, 0xDF, 0xF5, 0xF4, 0x82, 0xA0, 0x0E, 0xA6, 0x15, 0x20, 0xBC, 0xC7,
+		0xF6, 0x93, 0xB9, 0x9C, 0xF0, 0xE6, 0xE7, 0x01, 0x57, 0x00, 0xA8, 0x12, 0x50, 0x19, 0x48, 0xA1,
+		0xAC, 0xF2, 0x9E, 0xA2, 0xF6, 0xFF, 0xA2, 0x40, 0x10, 0x8C, 0x89, 0xDE, 0x80, 0xF5, 0x8B, 0xAC,
+		0xAC, 0xA0, 0x01, 0xAE, 0x00, 0xE3, 0x05, 0x57, 0x58, 0xD9, 0x9A, 0xD5, 0xA5, 0xDC, 0xAD, 0xDA,
+		0xA1, 0x5D, 0x10, 0x9E, 0xB1, 0x8D, 0xBA, 0xF6, 0xDF, 0x94, 0xCE, 0x13, 0x5A, 0x1A, 0x08, 0xBA,
+		0x05, 0x1C, 0x58, 0x85, 0xDC, 0xBE, 0xDB, 0xD2, 0xE7, 0xF5, 0xA3, 0x39, 0x10, 0xAA, 0xA3, 0xE6,
+		0xB7, 0x89, 0x97, 0xAE, 0xDE, 0x31, 0x5A, 0x1C, 0x08, 0xB9, 0x05, 0x73, 0x4C, 0xDE, 0xFE, 0xC2,
+		0xFF, 0xED, 0xE7, 0xD2, 0xA6, 0xB5, 0x01, 0x10, 0xB3, 0xB9, 0x83, 0xC9, 0x93, 0xD5, 0xF0, 0xA5,
+		0xB5, 0x01, 0x73, 0x00, 0xB6, 0x05, 0xCA, 0x48, 0x96, 0xB2, 0xE7, 0x83, 0xAE, 0xB2, 0xD8, 0xA7,
+		0x7D, 0x10, 0xA1, 0x91, 0xD5, 0x8B, 0xB5, 0xB2, 0xA2, 0x83, 0xB2, 0x01, 0x1D, 0x00, 0xB3, 0x05,
+		0x1D, 0x18, 0x92, 0xEB, 0xF5, 0xDF, 0x85, 0xB9, 0x98, 0x0E, 0xE3, 0x09, 0x30, 0x9D, 0xC3, 0xB8,
+		0xA6, 0xBC, 0xC7, 0x8A, 0xC4, 0x7C, 0x5A, 0x1A, 0x08, 0xB8, 0x05, 0x74, 0x44, 0x86, 0xA8, 0xB2,
+		0xFB, 0x87, 0x97, 0xA2, 0xA7, 0x45, 0x10, 0x81, 0xB5, 0xAF, 0xB6, 0xF9, 0x8B, 0xDC, 0xF3, 0x0E,
+		0xA2, 0x24, 0x00, 0xF5, 0x45, 0x0A, 0x48, 0xC3, 0xA7, 0xFB, 0x99, 0xED, 0xF7, 0xD8, 0xA5, 0x2B,
+		0x10, 0x8B, 0xBD, 0xF2, 0xFE, 0x8E, 0x84, 0xBD, 0xE4, 0xEC, 0x01, 0xC9, 0x00, 0x82, 0x85, 0x87,
+		0x58, 0xB1, 0x99, 0x9A, 0xCC, 0xE9, 0xD9, 0xF0, 0xA2, 0x04, 0x10, 0x97, 0x8D, 0x96, 0xE7, 0xBB,
+		0xE7, 0xCE, 0xD1, 0x66, 0x5A, 0x1C, 0x08, 0xE6, 0x45, 0xB6, 0x18, 0x8F, 0x9E, 0xF4, 0xCC, 0xFD,
+		0xC7, 0xC5, 0x0E, 0xAE, 0x20, 0x1C, 0xA3, 0xFF, 0xE6, 0xD8, 0x98, 0xBF, 0x8C, 0xC2, 0x12, 0xB3,
+		0x1C, 0x00, 0xA1, 0x05, 0x73, 0x58, 0x8F, 0xFC, 0xC9, 0xF4, 0x84, 0xD4, 0x81, 0xA3, 0x59, 0x10,
+		0xB8, 0x81, 0xED, 0xBE, 0x81, 0xC6, 0x8F, 0x84, 0x33, 0x5A, 0x1B, 0x08, 0xB4, 0x05, 0xAC, 0x44,
+		0xF3, 0x93, 0x90, 0xE6, 0x91, 0xBC, 0xE9, 0xA3, 0x4F, 0x10, 0x81, 0xAF, 0xCC, 0x8D, 0xD8, 0xE8,
+		0xF9, 0xDB, 0x12, 0x54, 0x0A, 0x00, 0xD8, 0x05, 0x1D, 0x5C, 0xCD, 0xBE, 0xFF, 0xEB, 0xCF, 0xC2,
+		0xB8, 0xA6, 0xA5, 0x01, 0x10, 0x92, 0xAF, 0xD0, 0x90, 0x9E, 0x8A, 0xEF, 0x83, 0x04, 0x5A, 0x1A,
+		0x08, 0x9D, 0x05, 0x56, 0x58, 0xE0, 0xF0, 0xCA, 0xAF, 0xB1, 0x81, 0xDD, 0xA3, 0x3C, 0x10, 0xB6,
+		0xE5, 0xB6, 0xCC, 0xDD, 0x95, 0xC7, 0x97, 0x5C, 0x5A, 0x1B, 0x08, 0xD7, 0x05, 0x39, 0x5C, 0xE2,
+		0x8A, 0xB6, 0xDF, 0xE7, 0xC8, 0xC1, 0xA3, 0xC4, 0x01, 0x10, 0x82, 0x8F, 0x97, 0xD5, 0xB0, 0xEF,
+		0xBC, 0xFA, 0x1F, 0x5A, 0x1A, 0x08, 0x8B, 0x05, 0xC9, 0x44, 0xDD, 0xBC, 0x8B, 0x96, 0xEE, 0xCD,
+		0xC6, 0xA4, 0x51, 0x10, 0x91, 0xA9, 0xC0, 0xD5, 0xBB, 0xEF, 0xAD, 0xDB, 0x0E, 0x16, 0x2D, 0x00,
+		0xEF, 0x65, 0xB9, 0x5C, 0x9E, 0xAB, 0x87, 0x95, 0x95, 0xD9, 0x9F, 0xA6, 0x8F, 0x01, 0x10, 0xAB,
+		0xBD, 0xBB, 0xD1, 0xF2, 0xDF, 0x9D, 0xB1, 0x05, 0x5A, 0x1A, 0x08, 0xAA, 0x05, 0x72, 0x44, 0xB6,
+		0xB0, 0xB0, 0xB9, 0x86, 0x91, 0x86, 0x25, 0x10, 0xBE, 0xF3, 0xAD, 0xF5, 0xD8, 0xB5, 0x97, 0xCB,
+		0xB1, 0x41, 0xED, 0x00, 0xB7, 0x25, 0xAF, 0x4C, 0xCA, 0x90, 0xB6, 0xEE, 0x95, 0x84, 0xEE, 0xA5,
+		0x89, 0x01, 0x10, 0xA1, 0x9F, 0x8F, 0xF4, 0xCF, 0xCC, 0xCD, 0xA1, 0xCA, 0x21, 0x92, 0x00, 0xC0,
+		0x05, 0x90, 0x4C, 0xA3, 0xA8, 0xCB, 0xFA, 0xDA, 0xFD, 0xA1, 0xA1, 0xE6, 0x01, 0x10, 0x98, 0x95,
+		0x91, 0xB7, 0xDD, 0xFA, 0xD6, 0xD5, 0x53, 0x0E, 0xDE, 0x09, 0x05, 0x74, 0x5C, 0xD8, 0xFE, 0xE5,
+		0xF9, 0xA2, 0x91, 0xD5, 0xA1, 0xC8, 0x01, 0x10, 0x87, 0xE1, 0xCF, 0xD7, 0xFF, 0xF9, 0x81, 0x89,
+		0x1C, 0x5A, 0x1B, 0x08, 0xA9, 0x05, 0x3A, 0x48, 0xB2, 0xE4, 0x8E, 0xD8, 0xEB, 0x86, 0x97, 0xA6,
+		0x12, 0x10, 0xB7, 0xD9, 0x96, 0xDD, 0xD2, 0xE7, 0xB6, 0xA8, 0x84, 0x01, 0x75, 0x00, 0xB5, 0x05,
+		0x75, 0x4C, 0x92, 0x9B, 0xD0, 0xCB, 0xFA, 0xE5, 0x90, 0xA4, 0x85, 0x01, 0x10, 0x9F, 0x9B, 0xF4,
+		0xFD, 0xDB, 0xE8, 0x80, 0xC9, 0xBC, 0x21, 0xB1, 0x00, 0xE3, 0x05, 0xE8, 0x44, 0xDB, 0x8D, 0xA8,
+		0xD4, 0xC1, 0xCF, 0x88, 0xA2, 0x59, 0x10, 0x91, 0xA9, 0xA8, 0xBE, 0x99, 0x87, 0xC7, 0xC9, 0xC1,
+		0x38, 0x00, 0x9E, 0x05, 0x57, 0x4C, 0x9F, 0xFF, 0xA8, 0x9E, 0xD1, 0xDB, 0xEF, 0xA3, 0xF4, 0x01,
+		0x10, 0xBA, 0xE7, 0xA1, 0xB1, 0xA2, 0xB7, 0x81, 0xFD, 0x74, 0x0E, 0xE7, 0x12, 0x05, 0x91, 0x18,
+		0x9A, 0xBA, 0xEE, 0xD4, 0x83, 0xEE, 0xF5, 0x0E, 0xBC, 0x33, 0x20, 0x8F, 0x8D, 0xB0, 0xBA, 0xE7,
+		0xCC, 0xE0, 0xF3, 0x4C, 0x0E, 0x38, 0x36, 0x25, 0x05, 0x58, 0xD3, 0xF8, 0xD6, 0x9C, 0xBE, 0xE7,
+		0x8E, 0xA7, 0x76, 0x10, 0x81, 0xE1, 0xF7, 0xF8, 0x93, 0xF5, 0xB0, 0xCA, 0x63, 0x5A, 0x1A, 0x08,
+		0xBD, 0x05, 0x1C, 0x48, 0x9E, 0xFF, 0xDD, 0xA7, 0x8F, 0xF7, 0x95, 0xA5, 0x6E, 0x10, 0xB6, 0xD1,
+		0xB3, 0xC3, 0xE1, 0xA1, 0xE6, 0xE8, 0x2D, 0x41, 0x23, 0x05, 0xAC, 0xF0, 0x61, 0xF8, 0xB6, 0xDA,
+		0xD5, 0xAD, 0xB0, 0xB4, 0xA7, 0xE1, 0x01, 0x10, 0x8F, 0xF9, 0xEE, 0xCC, 0xF3, 0xC9, 0xA1, 0xA2,
+		0x91, 0x01, 0x60, 0xC6, 0x06, 0x22, 0x62, 0x08, 0x09, 0x12, 0x14, 0x7B, 0xEC, 0xCB, 0x19, 0xD1,
+		0x58, 0x7E, 0xFF, 0xEC, 0x03, 0xC5, 0x50, 0xDF, 0x12, 0x55, 0x22, 0x12, 0x78, 0xDD, 0x41, 0x1A,
+		0x16, 0x74, 0x69, 0x6C, 0x65, 0x5F, 0x70, 0x61, 0x70, 0x65, 0x72, 0x5F, 0x6D, 0x65, 0x64, 0x67,
+		0x72, 0x61, 0x79, 0x2E, 0x6A, 0x70, 0x67, 0x22, 0x00, 0x2A, 0x23, 0x67, 0x69, 0x6E, 0x67, 0x65,
+		0x72, 0x2F, 0x30, 0x30, 0x62, 0x5F, 0x74, 0x68, 0x65, 0x6D, 0x65, 0x2F, 0x74, 0x69, 0x6C, 0x3A,
+		0x2B, 0x00, 0xF0, 0x46, 0x52, 0x09, 0xA2, 0x06, 0x06, 0x18, 0x01, 0x28, 0x00, 0x38, 0x00, 0x22,
+		0x52, 0x08, 0x17, 0x12, 0x14, 0xBC, 0x09, 0x54, 0x12, 0x34, 0x93, 0xF3, 0x84, 0x36, 0x27, 0x25,
+		0x4C, 0x48, 0xD2, 0x31, 0xDE, 0x44, 0x6A, 0x3E, 0x0E, 0x1A, 0x1C, 0x62, 0x75, 0x6C, 0x6C, 0x65,
+		0x74, 0x5F, 0x63, 0x69, 0x72, 0x63, 0x6C, 0x65, 0x2D, 0x62, 0x6C, 0x6B, 0x2D, 0x72, 0x65, 0x73,
+		0x69, 0x7A, 0x65, 0x2E, 0x70, 0x64, 0x66, 0x22, 0x00, 0x2A, 0x18, 0x5E, 0x20, 0x00, 0x6C, 0x22,
+		0x60, 0x08, 0x08, 0x12, 0x14, 0xB1, 0xD8, 0x45, 0x40, 0x36, 0x0B, 0xA8, 0x44, 0x12, 0x29, 0xEC,
+		0xC2, 0x6F, 0x53, 0x53, 0x9C, 0x7D, 0xCE, 0x04, 0xBD, 0x1A, 0x15, 0x1D, 0x8D, 0x0C, 0x6C, 0x74,
+		0x67, 0x72, 0x15, 0xB7, 0x08, 0x22, 0x67, 0x69, 0x66, 0xB7, 0x00, 0x09, 0x2A, 0x2E, 0xB6, 0x00,
+		0x90, 0x5E, 0x08, 0x0E, 0x12, 0x14, 0x16, 0x35, 0x71, 0x98, 0xC7, 0xF9, 0x91, 0x35, 0xDE, 0x48,
+		0xA3, 0x9B, 0x69, 0x61, 0xDF, 0x7F, 0xDA, 0x72, 0xC8, 0xF5, 0x1A, 0x1A, 0x68, 0x61, 0x72, 0x64,
+		0x63, 0x6F, 0x76, 0x65, 0x72, 0x5F, 0x0D, 0xA0, 0x30, 0x62, 0x6C, 0x61, 0x63, 0x6B, 0x2E, 0x70,
+		0x6E, 0x67, 0x22, 0x00, 0x2A, 0x26, 0x11, 0x67, 0x04, 0x31, 0x5F, 0x29, 0x1D, 0x56, 0x2E, 0x00,
+		0x00, 0x2A, 0x0E, 0x52, 0x39, 0x00, 0x32, 0x0E, 0x80, 0x39, 0x24, 0x3A, 0x03, 0x1A, 0x01, 0x00,
+		0x40, 0xC6, 0x06, 0x52, 0x04, 0x0E, 0x06, 0x5C, 0x00, 0x1E, 0x01, 0x05, 0x10, 0x12, 0x18, 0x08,
+		0x87, 0x56, 0x16, 0x2D, 0x5C, 0x80, 0x28, 0x2A, 0x0C, 0x96, 0xE6, 0x3D, 0xAF, 0xDB, 0x0B, 0x88,
+		0xCB, 0x66, 0xB0, 0xDB, 0x0B, 0x0A, 0x08, 0x08, 0x0E, 0x12, 0x04, 0x08, 0x96, 0xE6, 0x3D, 0x0A,
+		0x08, 0x08, 0x09, 0x12, 0x04, 0x08, 0xAF, 0x05, 0x14, 0x44, 0x17, 0x12, 0x04, 0x08, 0x88, 0xCB,
+		0x66, 0x0A, 0x08, 0x08, 0x08, 0x12, 0x04, 0x08, 0xB0, 0xDB, 0x0B, 0x10, 0x01, 0x23, 0x0C, 0x12,
+		0x0A, 0x08, 0x86, 0x0D, 0x47, 0x28, 0x1F, 0x0A, 0x1D, 0x08, 0x01, 0x1D, 0x88, 0x87, 0x07, 0x3F,
+		0x25, 0x01, 0x05, 0x00, 0x2D, 0x01, 0x05, 0x1C, 0x35, 0x00, 0x00, 0x80, 0x3F, 0x60, 0x01, 0x6D,
+		0x01, 0x07, 0x00, 0x10, 0x01, 0x49, 0x42, 0x30, 0x00, 0x10, 0xC1, 0xC0, 0xC0, 0x3E, 0x25, 0x01,
+		0x05, 0x00, 0x2D, 0x01, 0x05, 0x36, 0x30, 0x00, 0x08, 0x88, 0xCB, 0x66, 0x42, 0x30, 0x00, 0x10,
+		0x9E, 0x9D, 0x1D, 0x3F, 0x25, 0x01, 0x05, 0x00, 0x2D, 0x01, 0x05, 0x36, 0x30, 0x00, 0x04, 0xB0,
+		0xDB, 0x46, 0x60, 0x00, 0x10, 0x87, 0x86, 0x06, 0x3F, 0x25, 0x01, 0x05, 0x00, 0x2D, 0x01, 0x05,
+		0x2C, 0x35, 0x00, 0x00, 0x80, 0x3F, 0x60, 0x01, 0x6D, 0x00, 0x00, 0x80, 0x3F,
+	]
 }
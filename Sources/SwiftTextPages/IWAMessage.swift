@@ -0,0 +1,400 @@
+import SwiftTextIWA
+import Foundation
+
+/// Common interface for every generated iWork archive model.
+///
+/// A model is a thin typed view over ``IWASchema``-ordered storage: each
+/// generated property reads and writes one slot of `_values`, and a single
+/// table-driven codec (``IWACodec``) decodes and encodes every message from its
+/// schema. Fields the schema doesn't model — or that arrive in a wire type it
+/// doesn't expect — are kept in `unknownFields` and re-emitted verbatim.
+protocol IWAMessage: AnyObject {
+	/// The message's field table.
+	static var schema: IWASchema { get }
+	/// One value per schema field, in schema order. Underscored so it can't
+	/// collide with a generated property (those are camelCase).
+	var _values: [IWAValue] { get set }
+	/// Fields not modeled by the schema, preserved for lossless round-trip.
+	var unknownFields: [ProtobufField] { get set }
+	init()
+}
+
+extension IWAMessage {
+	init(_ message: ProtobufMessage) {
+		self.init()
+		IWACodec.decode(message, into: self)
+	}
+
+	func encoded() -> [UInt8] {
+		var writer = ProtobufWriter()
+		IWACodec.encode(self, into: &writer)
+		return writer.bytes
+	}
+
+	/// An optional scalar, string or bytes field.
+	subscript<T: IWAScalar>(slot: Int) -> T? {
+		get { T(iwaValue: _values[slot]) }
+		set { _values[slot] = newValue?.iwaValue ?? .absent }
+	}
+
+	/// A repeated scalar, string or bytes field.
+	subscript<T: IWAScalar>(all slot: Int) -> [T] {
+		get {
+			guard case .list(let items) = _values[slot] else { return [] }
+			return items.compactMap(T.init(iwaValue:))
+		}
+		set { _values[slot] = newValue.isEmpty ? .absent : .list(newValue.map(\.iwaValue)) }
+	}
+
+	/// An optional sub-message field.
+	subscript<T: IWAMessage>(message slot: Int) -> T? {
+		get {
+			guard case .message(let message) = _values[slot] else { return nil }
+			return message as? T
+		}
+		set { _values[slot] = newValue.map { .message($0) } ?? .absent }
+	}
+
+	/// A repeated sub-message field.
+	subscript<T: IWAMessage>(messages slot: Int) -> [T] {
+		get {
+			guard case .list(let items) = _values[slot] else { return [] }
+			return items.compactMap { item in
+				guard case .message(let message) = item else { return nil }
+				return message as? T
+			}
+		}
+		set { _values[slot] = newValue.isEmpty ? .absent : .list(newValue.map { .message($0) }) }
+	}
+
+	/// Appends to a repeated scalar, string or bytes field in place, where
+	/// `self[all:].append` would rebuild the whole list on every call.
+	func append<T: IWAScalar>(_ value: T, toAll slot: Int) {
+		appendItem(value.iwaValue, to: slot)
+	}
+
+	/// Appends to a repeated sub-message field in place.
+	func append<T: IWAMessage>(_ message: T, toMessages slot: Int) {
+		appendItem(.message(message), to: slot)
+	}
+
+	private func appendItem(_ item: IWAValue, to slot: Int) {
+		var items: [IWAValue]
+		if case .list(let existing) = _values[slot] { items = existing } else { items = [] }
+		// Release the stored list first so `items` is uniquely referenced.
+		_values[slot] = .absent
+		items.append(item)
+		_values[slot] = .list(items)
+	}
+}
+
+/// A stored field value. Numbers hold the value's bit pattern: integers
+/// sign- or zero-extended to 64 bits, floats and doubles as their IEEE bits,
+/// and `sint` fields already un-zigzagged.
+enum IWAValue {
+	case absent
+	case number(UInt64)
+	case string(String)
+	case bytes([UInt8])
+	case message(any IWAMessage)
+	/// A repeated field's elements, in wire order.
+	case list([IWAValue])
+}
+
+/// A Swift type a generated property can expose for a non-message field.
+protocol IWAScalar {
+	init?(iwaValue: IWAValue)
+	var iwaValue: IWAValue { get }
+}
+
+extension Bool: IWAScalar {
+	init?(iwaValue: IWAValue) {
+		guard case .number(let bits) = iwaValue else { return nil }
+		self = bits != 0
+	}
+
+	var iwaValue: IWAValue { .number(self ? 1 : 0) }
+}
+
+/// Integers share one conversion: truncate on read, extend on write.
+protocol IWAInteger: IWAScalar, FixedWidthInteger {}
+
+extension IWAInteger {
+	init?(iwaValue: IWAValue) {
+		guard case .number(let bits) = iwaValue else { return nil }
+		self.init(truncatingIfNeeded: bits)
+	}
+
+	var iwaValue: IWAValue { .number(UInt64(truncatingIfNeeded: self)) }
+}
+
+extension Int32: IWAInteger {}
+extension Int64: IWAInteger {}
+extension UInt32: IWAInteger {}
+extension UInt64: IWAInteger {}
+
+extension Float: IWAScalar {
+	init?(iwaValue: IWAValue) {
+		guard case .number(let bits) = iwaValue else { return nil }
+		self.init(bitPattern: UInt32(truncatingIfNeeded: bits))
+	}
+
+	var iwaValue: IWAValue { .number(UInt64(bitPattern)) }
+}
+
+extension Double: IWAScalar {
+	init?(iwaValue: IWAValue) {
+		guard case .number(let bits) = iwaValue else { return nil }
+		self.init(bitPattern: bits)
+	}
+
+	var iwaValue: IWAValue { .number(bitPattern) }
+}
+
+extension String: IWAScalar {
+	init?(iwaValue: IWAValue) {
+		guard case .string(let string) = iwaValue else { return nil }
+		self = string
+	}
+
+	var iwaValue: IWAValue { .string(self) }
+}
+
+extension Array: IWAScalar where Element == UInt8 {
+	init?(iwaValue: IWAValue) {
+		guard case .bytes(let bytes) = iwaValue else { return nil }
+		self = bytes
+	}
+
+	var iwaValue: IWAValue { .bytes(self) }
+}
+
+/// One field of a message schema: its number, proto type and label.
+struct IWAField {
+	/// The proto scalar type, or `message`. Enum fields are `int32`.
+	enum Kind: UInt8 {
+		case bool, int32, int64, uint32, uint64, sint32, sint64
+		case fixed32, sfixed32, float, fixed64, sfixed64, double
+		case string, bytes, message
+	}
+
+	let number: Int
+	let kind: Kind
+	let repeated: Bool
+	let packed: Bool
+	/// The sub-message type, for `message` fields.
+	let type: (any IWAMessage.Type)?
+
+	static func optional(_ number: Int, _ kind: Kind) -> IWAField {
+		IWAField(number: number, kind: kind, repeated: false, packed: false, type: nil)
+	}
+
+	static func repeated(_ number: Int, _ kind: Kind, packed: Bool = false) -> IWAField {
+		IWAField(number: number, kind: kind, repeated: true, packed: packed, type: nil)
+	}
+
+	static func optional(_ number: Int, _ type: any IWAMessage.Type) -> IWAField {
+		IWAField(number: number, kind: .message, repeated: false, packed: false, type: type)
+	}
+
+	static func repeated(_ number: Int, _ type: any IWAMessage.Type) -> IWAField {
+		IWAField(number: number, kind: .message, repeated: true, packed: false, type: type)
+	}
+
+	var isVarint: Bool { kind.rawValue <= Kind.sint64.rawValue }
+
+	/// Whether a field arriving in `value`'s wire type is this field. Repeated
+	/// varints also arrive packed, as one length-delimited run.
+	func accepts(_ value: ProtobufField.Value) -> Bool {
+		switch value {
+		case .varint: return isVarint
+		case .fixed32: return kind == .fixed32 || kind == .sfixed32 || kind == .float
+		case .fixed64: return kind == .fixed64 || kind == .sfixed64 || kind == .double
+		case .lengthDelimited: return kind.rawValue >= Kind.string.rawValue || (repeated && isVarint)
+		}
+	}
+}
+
+/// A message's field table: the proto full name and its fields in declaration
+/// order, with a field-number index for decoding.
+final class IWASchema: @unchecked Sendable {
+	let name: String
+	let fields: [IWAField]
+	/// Slot by field number; `-1` where the number isn't modeled.
+	private let slots: [Int16]
+
+	init(_ name: String, _ fields: [IWAField]) {
+		self.name = name
+		self.fields = fields
+		var slots = [Int16](repeating: -1, count: (fields.map(\.number).max() ?? 0) + 1)
+		for (slot, field) in fields.enumerated() { slots[field.number] = Int16(slot) }
+		self.slots = slots
+	}
+
+	/// The slot that claims `field`, or `nil` if its number isn't modeled or it
+	/// arrives in a wire type the schema doesn't expect.
+	func slot(for field: ProtobufField) -> Int? {
+		guard field.number >= 0, field.number < slots.count else { return nil }
+		let slot = Int(slots[field.number])
+		guard slot >= 0, fields[slot].accepts(field.value) else { return nil }
+		return slot
+	}
+
+	/// How many of `fields` this schema would model: its match against a
+	/// payload's wire-field signature, without decoding any values.
+	func claimedCount(of fields: [ProtobufField]) -> Int {
+		var claimed = 0
+		for field in fields where slot(for: field) != nil { claimed += 1 }
+		return claimed
+	}
+}
+
+/// The interpreter behind every generated model: decodes and encodes any
+/// message from its ``IWASchema``.
+enum IWACodec {
+	/// A fresh `type` decoded from `message`, for callers holding only a metatype.
+	static func decode(_ message: ProtobufMessage, as type: any IWAMessage.Type) -> any IWAMessage {
+		let target = type.init()
+		decode(message, into: target)
+		return target
+	}
+
+	static func decode(_ message: ProtobufMessage, into target: any IWAMessage) {
+		let schema = type(of: target).schema
+		var values = [IWAValue](repeating: .absent, count: schema.fields.count)
+		var unknown = [ProtobufField]()
+		for field in message.fields {
+			guard let slot = schema.slot(for: field) else {
+				unknown.append(field)
+				continue
+			}
+			let descriptor = schema.fields[slot]
+			if !descriptor.repeated {
+				values[slot] = value(field.value, as: descriptor)
+				continue
+			}
+			var items: [IWAValue]
+			if case .list(let existing) = values[slot] { items = existing } else { items = [] }
+			values[slot] = .absent
+			if descriptor.isVarint, case .lengthDelimited(let packed) = field.value {
+				unpackVarints(packed) { items.append(number(fromVarint: $0, kind: descriptor.kind)) }
+			} else {
+				items.append(value(field.value, as: descriptor))
+			}
+			values[slot] = items.isEmpty ? .absent : .list(items)
+		}
+		target._values = values
+		target.unknownFields = unknown
+	}
+
+	static func encode(_ source: any IWAMessage, into writer: inout ProtobufWriter) {
+		let schema = type(of: source).schema
+		let values = source._values
+		for (slot, field) in schema.fields.enumerated() {
+			switch values[slot] {
+			case .absent:
+				continue
+			case .list(let items):
+				if field.packed {
+					writer.packedVarintField(field.number, items.map { item in
+						guard case .number(let bits) = item else { return 0 }
+						return varint(fromBits: bits, kind: field.kind)
+					})
+				} else {
+					for item in items { write(item, as: field, into: &writer) }
+				}
+			case let single:
+				write(single, as: field, into: &writer)
+			}
+		}
+		for field in source.unknownFields { writer.append(field) }
+	}
+
+	// MARK: Values
+
+	/// A single wire value as `field` stores it. The wire type has already
+	/// been checked by ``IWASchema/slot(for:)``.
+	private static func value(_ wire: ProtobufField.Value, as field: IWAField) -> IWAValue {
+		switch wire {
+		case .varint(let raw):
+			return number(fromVarint: raw, kind: field.kind)
+		case .fixed32(let bytes):
+			let bits = UInt32(bytes[0]) | UInt32(bytes[1]) << 8 | UInt32(bytes[2]) << 16 | UInt32(bytes[3]) << 24
+			return .number(field.kind == .sfixed32 ? UInt64(bitPattern: Int64(Int32(bitPattern: bits))) : UInt64(bits))
+		case .fixed64(let bytes):
+			var bits: UInt64 = 0
+			for index in 0 ..< 8 { bits |= UInt64(bytes[index]) << (8 * index) }
+			return .number(bits)
+		case .lengthDelimited(let bytes):
+			switch field.kind {
+			case .string:
+				return .string(String(decoding: bytes, as: UTF8.self))
+			case .message:
+				guard let type = field.type else { return .bytes(bytes) }
+				return .message(decode(ProtobufMessage(bytes), as: type))
+			default:
+				return .bytes(bytes)
+			}
+		}
+	}
+
+	private static func number(fromVarint raw: UInt64, kind: IWAField.Kind) -> IWAValue {
+		switch kind {
+		case .sint32:
+			let bits = UInt32(truncatingIfNeeded: raw)
+			return .number(UInt64(bitPattern: Int64(Int32(bitPattern: (bits >> 1) ^ (~(bits & 1) &+ 1)))))
+		case .sint64:
+			return .number((raw >> 1) ^ (~(raw & 1) &+ 1))
+		default:
+			return .number(raw)
+		}
+	}
+
+	private static func varint(fromBits bits: UInt64, kind: IWAField.Kind) -> UInt64 {
+		switch kind {
+		case .sint32:
+			let value = Int32(truncatingIfNeeded: bits)
+			return UInt64(UInt32(bitPattern: (value << 1) ^ (value >> 31)))
+		case .sint64:
+			let value = Int64(bitPattern: bits)
+			return UInt64(bitPattern: (value << 1) ^ (value >> 63))
+		default:
+			return bits
+		}
+	}
+
+	private static func write(_ value: IWAValue, as field: IWAField, into writer: inout ProtobufWriter) {
+		switch value {
+		case .number(let bits):
+			switch field.kind {
+			case .fixed32, .sfixed32, .float: writer.fixed32Field(field.number, UInt32(truncatingIfNeeded: bits))
+			case .fixed64, .sfixed64, .double: writer.fixed64Field(field.number, bits)
+			default: writer.varintField(field.number, varint(fromBits: bits, kind: field.kind))
+			}
+		case .string(let string):
+			writer.stringField(field.number, string)
+		case .bytes(let bytes):
+			writer.bytesField(field.number, bytes)
+		case .message(let message):
+			writer.bytesField(field.number, message.encoded())
+		case .absent, .list:
+			break
+		}
+	}
+
+	private static func unpackVarints(_ bytes: [UInt8], _ body: (UInt64) -> Void) {
+		var position = 0
+		while position < bytes.count {
+			var shift: UInt64 = 0
+			var value: UInt64 = 0
+			while position < bytes.count {
+				let byte = bytes[position]
+				position += 1
+				if shift < 64 { value |= UInt64(byte & 0x7F) << shift }
+				if byte & 0x80 == 0 { break }
+				shift += 7
+			}
+			body(value)
+		}
+	}
+}
@@ -66,30 +66,21 @@ enum MarkdownPagesBuilder {
 
 	/// Pulls `[^id]: text` definition blocks out of the Markdown source (with 4-space- or
 	/// tab-indented continuation lines), returning the cleaned source and `id → text`.
+	/// Uses the single-pass scanner shared with the HTML and DOCX writers, so the rules
+	/// match theirs: blank lines followed by another indented line stay in the
+	/// definition, and of two definitions with the same id the first wins. A Pages
+	/// footnote is one plain-text run, so body lines are joined with spaces.
 	static func extractFootnoteDefinitions(_ markdown: String) -> (cleaned: String, definitions: [String: String]) {
-		var definitions = [String: String]()
-		var keptLines = [Substring]()
-		let lines = markdown.split(separator: "\n", omittingEmptySubsequences: false)
-		var index = 0
-		while index < lines.count {
-			let line = lines[index]
-			if line.first == "[", let colon = line.range(of: "]:"), line.hasPrefix("[^") {
-				let id = String(line[line.index(line.startIndex, offsetBy: 2)..<colon.lowerBound])
-				var text = String(line[colon.upperBound...]).trimmingCharacters(in: .whitespaces)
-				// Gather indented continuation lines.
-				var next = index + 1
-				while next < lines.count, lines[next].hasPrefix("    ") || lines[next].hasPrefix("\t") {
-					text += " " + lines[next].trimmingCharacters(in: .whitespaces)
-					next += 1
-				}
-				if !id.isEmpty { definitions[id] = text }
-				index = next
-				continue
-			}
-			keptLines.append(line)
-			index += 1
+		let (cleaned, extracted) = MarkdownFootnoteParser.extractDefinitions(from: markdown)
+		var definitions = [String: String](minimumCapacity: extracted.count)
+		for definition in extracted {
+			definitions[definition.id] = definition.body
+				.split(separator: "\n")
+				.map { $0.trimmingCharacters(in: .whitespaces) }
+				.filter { !$0.isEmpty }
+				.joined(separator: " ")
 		}
-		return (keptLines.joined(separator: "\n"), definitions)
+		return (cleaned, definitions)
 	}
 }
 
@@ -262,7 +253,7 @@ private struct BlockVisitor: MarkupVisitor {
 		collector.collect(from: heading)
 		var bodyParagraph = BodyParagraph(
 			text: collector.text,
-			paragraphStyle: Self.headingStyle(level: heading.level),
+			paragraphStyle: PagesStyleID.heading(level: heading.level),
 			runs: collector.runs,
 			links: collector.links
 		)
@@ -402,16 +393,4 @@ private struct BlockVisitor: MarkupVisitor {
 	mutating func visitHTMLBlock(_ htmlBlock: HTMLBlock) {
 		// Not representable; the DOCX writer drops these too.
 	}
-
-	/// Maps a Markdown heading level to a template paragraph style. The blank theme
-	/// ships Heading 1–4; deeper levels (rare) reuse Heading 4. The reader recovers the
-	/// level from each style's stable `style_identifier`, so `#`…`####` round-trip exactly.
-	private static func headingStyle(level: Int) -> UInt64 {
-		switch level {
-		case 1: return PagesStyleID.heading1
-		case 2: return PagesStyleID.heading2
-		case 3: return PagesStyleID.heading3
-		default: return PagesStyleID.heading4
-		}
-	}
 }
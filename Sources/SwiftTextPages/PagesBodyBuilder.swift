@@ -42,6 +42,18 @@ enum PagesStyleID {
 	/// The root stylesheet — the parent of every style; used when synthesizing new ones.
 	static let stylesheet: UInt64 = 1732613
 
+	/// Maps a Markdown heading level to a template paragraph style. The blank theme
+	/// ships Heading 1–4; deeper levels (rare) reuse Heading 4. The reader recovers the
+	/// level from each style's stable `style_identifier`, so `#`…`####` round-trip exactly.
+	static func heading(level: Int) -> UInt64 {
+		switch level {
+		case 1: return heading1
+		case 2: return heading2
+		case 3: return heading3
+		default: return heading4
+		}
+	}
+
 	/// First identifier handed out to objects we synthesize. Well above the
 	/// template's range (~1.73M) so new ids never collide with captured ones.
 	static let synthesizedBase: UInt64 = 6_000_000
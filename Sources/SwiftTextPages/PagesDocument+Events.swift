@@ -0,0 +1,196 @@
+import Foundation
+import SwiftTextCore
+
+extension PagesDocument {
+	/// Sends the document to `emit` as ``DocumentEvent``s, with the same structure
+	/// ``markdown()`` renders: anchored tables, fenced code runs, list items, and
+	/// headings inferred from typography; footnote definitions come last.
+	public func events(_ emit: DocumentEventHandler) rethrows {
+		try emitBodyEvents(emit)
+		for footnote in footnotes.sorted(by: { $0.number < $1.number }) {
+			try emit(.footnote(number: footnote.number, text: footnote.text))
+		}
+	}
+
+	/// The body paragraphs as events, without footnote definitions.
+	func emitBodyEvents(_ emit: DocumentEventHandler) rethrows {
+		let bodySize = dominantBodyFontSize()
+		var index = 0
+		while index < paragraphs.count {
+			let paragraph = paragraphs[index]
+			for table in paragraph.tables where !table.cells.isEmpty {
+				try Self.emitTable(table, emit)
+			}
+
+			if paragraph.isCodeBlock {
+				try emit(.beginCodeBlock(language: nil))
+				var first = true
+				while index < paragraphs.count, paragraphs[index].isCodeBlock {
+					if !first { try emit(.lineBreak) }
+					first = false
+					let code = paragraphs[index].codeText()
+					// Newlines from soft breaks are line breaks too; keep the event stream uniform.
+					for (offset, line) in code.split(separator: "\n", omittingEmptySubsequences: false).enumerated() {
+						if offset > 0 { try emit(.lineBreak) }
+						if !line.isEmpty { try emit(.text(String(line), .plain)) }
+					}
+					index += 1
+				}
+				try emit(.endCodeBlock)
+				continue
+			}
+
+			let inline = paragraph.inlineEvents(suppressingUniformEmphasis: false)
+			guard !inline.isEmpty else { index += 1; continue }
+
+			if let level = paragraph.listLevel {
+				try emit(.beginListItem(level: max(level, 0), ordered: paragraph.listOrdered))
+				for event in inline { try emit(event) }
+				try emit(.endListItem)
+			} else if let level = headingLevel(for: paragraph, text: paragraph.normalizedText(), bodySize: bodySize) {
+				try emit(.beginHeading(level: level))
+				for event in paragraph.inlineEvents(suppressingUniformEmphasis: true) { try emit(event) }
+				try emit(.endHeading)
+			} else {
+				try emit(.beginParagraph)
+				for event in inline { try emit(event) }
+				try emit(.endParagraph)
+			}
+			index += 1
+		}
+	}
+
+	private static func emitTable(_ table: Paragraph.Table, _ emit: DocumentEventHandler) rethrows {
+		let columns = table.cells.map(\.count).max() ?? 0
+		guard columns > 0 else { return }
+		let alignments: [DocumentColumnAlignment] = (0..<columns).map { column in
+			switch column < table.columnAlignments.count ? table.columnAlignments[column] : .left {
+			case .left: return .left
+			case .center: return .center
+			case .right: return .right
+			}
+		}
+		try emit(.beginTable(alignments: alignments))
+		for (rowIndex, row) in table.cells.enumerated() {
+			try emit(.beginTableRow(header: rowIndex == 0))
+			for column in 0..<columns {
+				try emit(.beginTableCell)
+				let value = column < row.count ? row[column].replacingOccurrences(of: "\n", with: " ") : ""
+				if !value.isEmpty { try emit(.text(value, .plain)) }
+				try emit(.endTableCell)
+			}
+			try emit(.endTableRow)
+		}
+		try emit(.endTable)
+	}
+}
+
+extension PagesDocument.Paragraph {
+	/// The paragraph's inline content as events — the event form of
+	/// `renderedText(inliningImages: true, applyingEmphasis: true, …)`: styled runs,
+	/// links, footnote references, soft breaks and image anchors, with tabs
+	/// expanded and the paragraph's outer whitespace trimmed.
+	func inlineEvents(suppressingUniformEmphasis: Bool) -> [DocumentEvent] {
+		var suppress = (bold: false, italic: false, strike: false, code: false)
+		if suppressingUniformEmphasis, let first = emphasis.first, first.start <= 0 {
+			suppress = (emphasis.allSatisfy(\.bold), emphasis.allSatisfy(\.italic),
+			            emphasis.allSatisfy(\.strike), emphasis.allSatisfy(\.code))
+		}
+		let sortedLinks = links.sorted { $0.start < $1.start }
+
+		var events = [DocumentEvent]()
+		var run = ""
+		var runStyle = DocumentTextStyle.plain
+		var active = DocumentTextStyle.plain
+		var activeLinkEnd: Int?
+		var spanIndex = 0
+		var linkIndex = 0
+		var footnoteIndex = 0
+		var anchorIndex = 0
+		var relativeOffset = 0
+
+		func flushRun() {
+			guard !run.isEmpty else { return }
+			events.append(.text(run.replacingOccurrences(of: "\t", with: "    "), runStyle))
+			run = ""
+		}
+
+		for scalar in text.unicodeScalars {
+			while spanIndex < emphasis.count, emphasis[spanIndex].start <= relativeOffset {
+				let span = emphasis[spanIndex]
+				active.bold = span.bold && !suppress.bold
+				active.italic = span.italic && !suppress.italic
+				active.underline = span.underline
+				active.strikethrough = span.strike && !suppress.strike
+				active.code = span.code && !suppress.code
+				spanIndex += 1
+			}
+			if let end = activeLinkEnd, relativeOffset >= end {
+				active.link = nil
+				activeLinkEnd = nil
+			}
+			while linkIndex < sortedLinks.count, sortedLinks[linkIndex].start <= relativeOffset {
+				let link = sortedLinks[linkIndex]
+				linkIndex += 1
+				if activeLinkEnd == nil, link.end > relativeOffset {
+					active.link = link.url
+					activeLinkEnd = link.end
+				}
+			}
+			while footnoteIndex < footnoteMarkers.count, footnoteMarkers[footnoteIndex].offset <= relativeOffset {
+				flushRun()
+				events.append(.footnoteReference(footnoteMarkers[footnoteIndex].number))
+				footnoteIndex += 1
+			}
+			switch scalar {
+			case "\u{2028}":
+				flushRun()
+				events.append(.lineBreak)
+			case "\u{000E}":
+				break
+			case "\u{FFFC}":
+				flushRun()
+				if anchorIndex < attachmentReferences.count, let reference = attachmentReferences[anchorIndex] {
+					events.append(.image(source: reference, alt: ""))
+				}
+				anchorIndex += 1
+			default:
+				if active != runStyle {
+					flushRun()
+					runStyle = active
+				}
+				run.unicodeScalars.append(scalar)
+			}
+			relativeOffset += scalar.value > 0xFFFF ? 2 : 1
+		}
+		while footnoteIndex < footnoteMarkers.count {
+			flushRun()
+			events.append(.footnoteReference(footnoteMarkers[footnoteIndex].number))
+			footnoteIndex += 1
+		}
+		flushRun()
+		return Self.trimmingEdges(events)
+	}
+
+	/// Drops whitespace (and line breaks) at the start and end of the paragraph.
+	private static func trimmingEdges(_ events: [DocumentEvent]) -> [DocumentEvent] {
+		var events = events
+		while let first = events.first {
+			if case .lineBreak = first { events.removeFirst(); continue }
+			guard case .text(let string, let style) = first else { break }
+			let trimmed = String(string.drop(while: \.isWhitespace))
+			if trimmed.isEmpty { events.removeFirst(); continue }
+			events[0] = .text(trimmed, style)
+			break
+		}
+		while let last = events.last {
+			if case .lineBreak = last { events.removeLast(); continue }
+			guard case .text(var string, let style) = last else { break }
+			while string.last?.isWhitespace == true { string.removeLast() }
+			if string.isEmpty { events.removeLast(); continue }
+			events[events.count - 1] = .text(string, style)
+			break
+		}
+		return events
+	}
+}
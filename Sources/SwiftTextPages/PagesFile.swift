@@ -1,3 +1,4 @@
+import SwiftTextCore
 import SwiftTextIWA
 import Foundation
 import Markdown
@@ -18,11 +19,32 @@ public final class PagesFile {
 	public let document: PagesDocument
 
 	/// Creates a `PagesFile` by reading and parsing the document at the given URL.
-	/// - Parameter url: The file URL pointing to the `.pages` archive.
-	/// - Throws: A ``PagesFileError`` describing the failure reason.
-	public init(url: URL) throws {
+	/// - Parameters:
+	///   - url: The file URL pointing to the `.pages` archive.
+	///   - limits: Bounds on decompressed size, object count, and time for
+	///     untrusted input. Unlimited by default.
+	/// - Throws: A ``PagesFileError`` describing the failure reason, or a
+	///   `ResourceLimitError` when the document exceeds `limits`.
+	public init(url: URL, limits: ResourceLimits = .unlimited) throws {
 		self.url = url
-		self.document = try PagesParser().readDocument(from: url)
+		self.document = try PagesParser().readDocument(from: url, limits: limits)
+	}
+
+	/// Reads the document on the calling task, for use from async code. Snappy
+	/// decoding and table extraction poll for cancellation as they go, so
+	/// cancelling the task abandons a large read promptly.
+	/// - Throws: Everything ``init(url:limits:)`` throws, or `CancellationError`.
+	public static func open(url: URL, limits: ResourceLimits = .unlimited) async throws -> PagesFile {
+		try Task.checkCancellation()
+		return try PagesFile(url: url, limits: limits)
+	}
+
+	/// Streams the document at `url` to `emit` one body storage at a time, without
+	/// building a ``PagesDocument``. Pair with a `DocumentEventConsumer` to convert
+	/// straight into another format.
+	/// - Throws: Everything ``init(url:limits:)`` throws, or whatever `emit` throws.
+	public static func events(url: URL, limits: ResourceLimits = .unlimited, _ emit: DocumentEventHandler) throws {
+		try PagesParser().readEvents(from: url, limits: limits, emit: emit)
 	}
 
 	/// Returns the normalized text of each non-empty paragraph.
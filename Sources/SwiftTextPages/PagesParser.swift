@@ -1,3 +1,4 @@
+import SwiftTextCore
 import SwiftTextIWA
 import Foundation
 
@@ -217,15 +218,19 @@ final class PagesParser {
 		return traits
 	}
 
-	func readDocument(from url: URL) throws -> PagesDocument {
+	func readDocument(from url: URL, limits: ResourceLimits = .unlimited) throws -> PagesDocument {
 		guard FileManager.default.fileExists(atPath: url.path) else {
 			throw PagesFileError.fileNotFound(url)
 		}
+		let budget = ResourceBudget(limits)
 
 		// Modern (iWork '13+) documents store content as Index/*.iwa objects.
-		let indexEntries = try IWAContainer.entries(at: url, prefix: "Index/", suffix: ".iwa")
+		let indexEntries = try IWAContainer.entries(at: url, prefix: "Index/", suffix: ".iwa", budget: budget)
 		if !indexEntries.isEmpty {
-			return buildDocument(from: loadObjectStore(from: indexEntries))
+			let document = buildDocument(from: try loadObjectStore(from: indexEntries, budget: budget))
+			// Table decoding bails out early on cancellation; don't hand back the partial result.
+			try Task.checkCancellation()
+			return document
 		}
 
 		// Legacy (iWork '09) documents store a single uncompressed index.xml.
@@ -241,14 +246,22 @@ final class PagesParser {
 	}
 
 	/// Decodes the given `Index/*.iwa` entries into a unified object store.
-	private func loadObjectStore(from entries: [IWAContainer.Entry]) -> IWAObjectStore {
+	private func loadObjectStore(from entries: [IWAContainer.Entry], budget: ResourceBudget) throws -> IWAObjectStore {
 		var store = IWAObjectStore()
 		for entry in entries {
 			// Skip any entry that isn't a standard Snappy/Protobuf IWA file. Some
 			// auxiliary index files (e.g. `OperationStorage`, a collaboration/undo
 			// log that begins with a `bvxn` magic) use other framing and carry no
-			// document text — they must not block extracting `Document.iwa`.
-			guard let objects = try? IWAArchive.objects(from: entry.data) else { continue }
+			// document text — they must not block extracting `Document.iwa`. A
+			// resource limit or cancellation, though, ends the whole read.
+			let objects: [IWAObject]
+			do {
+				objects = try IWAArchive.objects(from: entry.data, budget: budget)
+			} catch let error where error is ResourceLimitError || error is CancellationError {
+				throw error
+			} catch {
+				continue
+			}
 			for object in objects {
 				store.add(object)
 			}
@@ -258,6 +271,39 @@ final class PagesParser {
 
 	/// Selects the body storages and turns their text into structured paragraphs.
 	private func buildDocument(from store: IWAObjectStore) -> PagesDocument {
+		var paragraphs = [PagesDocument.Paragraph]()
+		let (imageAssets, footnotes) = forEachBodyStorage(in: store) { paragraphs.append(contentsOf: $0) }
+		return PagesDocument(paragraphs: paragraphs, imageAssets: imageAssets, footnotes: footnotes)
+	}
+
+	/// Streams the document as events, one body storage at a time, so only that
+	/// storage's paragraphs are held at once. Headings are inferred against each
+	/// storage's own dominant body size. Legacy documents go through their full model.
+	func readEvents(from url: URL, limits: ResourceLimits = .unlimited, emit: DocumentEventHandler) throws {
+		guard FileManager.default.fileExists(atPath: url.path) else {
+			throw PagesFileError.fileNotFound(url)
+		}
+		let budget = ResourceBudget(limits)
+		let indexEntries = try IWAContainer.entries(at: url, prefix: "Index/", suffix: ".iwa", budget: budget)
+		guard !indexEntries.isEmpty else {
+			try readDocument(from: url, limits: limits).events(emit)
+			return
+		}
+		let store = try loadObjectStore(from: indexEntries, budget: budget)
+		let (_, footnotes) = try forEachBodyStorage(in: store) { paragraphs in
+			try Task.checkCancellation()
+			try PagesDocument(paragraphs: paragraphs).emitBodyEvents(emit)
+		}
+		for footnote in footnotes {
+			try emit(.footnote(number: footnote.number, text: footnote.text))
+		}
+	}
+
+	/// Hands `body` the paragraphs of each body storage in document order and
+	/// returns what spans them: the placed image assets and the footnotes.
+	private func forEachBodyStorage(
+		in store: IWAObjectStore, _ body: ([PagesDocument.Paragraph]) throws -> Void
+	) rethrows -> (imageAssets: [PagesDocument.ImageAsset], footnotes: [PagesDocument.Footnote]) {
 		let storages = store.objects(ofType: IWork.storageArchiveType)
 
 		// Prefer the document body. If a document keeps all its text in boxes or
@@ -281,13 +327,12 @@ final class PagesParser {
 		}
 		let footnoteStorageIDs = Set(footnoteTexts.keys)
 
-		var paragraphs = [PagesDocument.Paragraph]()
 		var footnotes = [PagesDocument.Footnote]()
 		var footnoteCounter = 0
 		for storage in bodyStorages {
 			let text = storageText(storage)
 			guard !text.isEmpty else { continue }
-			paragraphs.append(contentsOf: makeParagraphs(
+			try body(makeParagraphs(
 				in: text, storage: storage, store: store, catalog: catalog,
 				footnoteStorageIDs: footnoteStorageIDs, footnoteTexts: footnoteTexts,
 				footnoteCounter: &footnoteCounter, footnotes: &footnotes
@@ -297,7 +342,7 @@ final class PagesParser {
 		let imageAssets = catalog.assets.map {
 			PagesDocument.ImageAsset(referenceName: $0.referenceName, dataFileName: $0.dataFileName)
 		}
-		return PagesDocument(paragraphs: paragraphs, imageAssets: imageAssets, footnotes: footnotes)
+		return (imageAssets, footnotes)
 	}
 
 	private func storageKind(_ object: IWAObject) -> UInt64 {
@@ -276,7 +276,7 @@ enum PagesTableBuilder {
 					var run = TST_StrokeLayerArchive_StrokeRunArchive()
 					run.origin = Int32(origin); run.length = 1
 					run.stroke = strokeArchive(border); run.order = order; order += 1
-					layer.strokeRuns.append(run)
+					layer.append(strokeRuns: run)
 				}
 				let id = nextLayer; nextLayer += 1
 				layers.append((id, layer.encoded()))
@@ -582,11 +582,10 @@ enum PagesTableBuilder {
 
 		let records = PagesTableTemplate.records
 		func record(_ id: UInt64) throws -> [UInt8] {
-			guard let entry = records.first(where: { $0.id == id }),
-			      let data = Data(base64Encoded: entry.base64) else {
+			guard let bytes = PagesTableTemplate.record(id) else {
 				throw BuildError.missingTemplateRecord(id)
 			}
-			return [UInt8](data)
+			return Array(bytes)
 		}
 
 		for (tableIndex, table) in tables.enumerated() {
@@ -2,28 +2,53 @@ import Foundation
 
 /// A captured Pages package as data — the "code version" of a template document.
 ///
-/// Each entry is a package-relative path plus its bytes (base64-encoded so the
-/// whole template can live in committed Swift source, with nothing bundled at
-/// runtime). The writer assembles a new document by taking a template's entries,
-/// replacing the body content, regenerating the `Metadata/` identity, and
-/// re-zipping. Built-in templates are produced by
-/// `Scripts/GeneratePagesTemplate.swift` (see `Generated/`).
+/// The package's files are stored back to back in one byte array compiled into
+/// the module, with each entry naming its package-relative path and byte range,
+/// so nothing is bundled or decoded at runtime. The writer assembles a new
+/// document by taking a template's entries, replacing the body content,
+/// regenerating the `Metadata/` identity, and re-zipping. Built-in templates are
+/// produced by `Scripts/GeneratePagesTemplate.swift` (see `Generated/`).
 struct PagesTemplate {
-	/// One package entry: an archive-relative path and its base64-encoded bytes.
+	/// One package entry: an archive-relative path and where its bytes sit.
 	struct Entry {
 		let path: String
-		let base64: String
+		let range: Range<Int>
 	}
 
 	/// Entries in archive order (preserved when re-zipping).
 	let entries: [Entry]
+	private let bytes: [UInt8]
+	private let rangesByPath: [String: Range<Int>]
 
-	/// The decoded bytes for an entry, or `nil` if the path isn't present.
+	init(entries: [Entry], bytes: [UInt8]) {
+		self.entries = entries
+		self.bytes = bytes
+		self.rangesByPath = Dictionary(entries.map { ($0.path, $0.range) }, uniquingKeysWith: { first, _ in first })
+	}
+
+	/// The bytes for an entry as a view into the template, or `nil` if the path
+	/// isn't present.
+	func bytes(for path: String) -> ArraySlice<UInt8>? {
+		rangesByPath[path].map { bytes[$0] }
+	}
+
+	/// A copy of the bytes for an entry, for callers that edit them.
 	func data(for path: String) -> [UInt8]? {
-		guard let entry = entries.first(where: { $0.path == path }),
-		      let data = Data(base64Encoded: entry.base64.replacingOccurrences(of: "\n", with: "")) else {
-			return nil
-		}
-		return [UInt8](data)
+		bytes(for: path).map(Array.init)
+	}
+}
+
+extension PagesTableTemplate {
+	private static let rangesByID: [UInt64: Range<Int>] = Dictionary(
+		records.map { ($0.id, $0.range) }, uniquingKeysWith: { first, _ in first })
+
+	/// The verbatim record bytes for object `id`, or `nil` if it wasn't captured.
+	static func record(_ id: UInt64) -> ArraySlice<UInt8>? {
+		rangesByID[id].map { bytes[$0] }
+	}
+
+	/// The table document's `Index/Metadata.iwa`.
+	static var metadata: ArraySlice<UInt8> {
+		bytes[metadataRange]
 	}
 }
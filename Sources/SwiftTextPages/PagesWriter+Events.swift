@@ -0,0 +1,302 @@
+import Foundation
+import SwiftTextCore
+
+/// Lets a reader feed ``PagesWriter`` directly, block by block, instead of going
+/// through Markdown. Events become the same body paragraphs `MarkdownToPages`
+/// produces; the package is written by ``write(to:baseURL:)`` once the stream
+/// has finished, because the body storage, tables and footnotes are serialized
+/// together.
+extension PagesWriter: DocumentEventConsumer {
+	public func consume(_ event: DocumentEvent) throws {
+		eventAssembly.consume(event)
+	}
+
+	public func finish() throws {
+		eventAssembly.finish()
+	}
+
+	/// Writes the document built from the consumed events.
+	/// - Parameter baseURL: the directory image sources are resolved against; when
+	///   `nil`, images fall back to alt-text placeholders.
+	public func write(to url: URL, baseURL: URL? = nil) throws {
+		try write(paragraphs: eventAssembly.paragraphs, baseURL: baseURL, to: url)
+	}
+}
+
+/// Turns a `DocumentEvent` stream into ``BodyParagraph``s, mirroring the Markdown
+/// `BlockVisitor`: text and style runs are tracked in UTF-16 offsets, code blocks
+/// join their lines with U+2028, and footnote references insert U+000E with the
+/// note text filled in once its definition arrives.
+struct PagesEventAssembly {
+	private(set) var paragraphs: [BodyParagraph] = []
+
+	private enum Container {
+		case paragraph
+		case heading(Int)
+		case listItem(level: Int, ordered: Bool)
+		case codeBlock
+		case tableCell
+	}
+
+	private struct TableState {
+		var alignments: [PagesColumnAlignment]
+		var rows: [[(text: String, runs: [BodyParagraph.StyledRun])]] = []
+		var row: [(text: String, runs: [BodyParagraph.StyledRun])] = []
+	}
+
+	private var container: Container?
+	private var implicitParagraph = false
+	private var text = ""
+	private var runs: [BodyParagraph.StyledRun] = []
+	private var links: [BodyParagraph.LinkSpan] = []
+	private var openLink: (start: Int, url: String)?
+	/// Footnote references of the open block: UTF-16 offset and footnote number.
+	private var references: [(offset: Int, number: Int)] = []
+	/// Where every footnote reference landed (paragraph and reference index) and its
+	/// number, resolved against the definitions in `finish()`.
+	private var pendingFootnotes: [(paragraph: Int, reference: Int, number: Int)] = []
+	private var footnoteTexts: [Int: String] = [:]
+	private var quoteDepth = 0
+	private var table: TableState?
+	/// Ordered-list instance per open list level, and whether that level is ordered.
+	private var listLevels: [(ordered: Bool, instance: Int?)] = []
+	private var nextListInstance = 1
+
+	mutating func consume(_ event: DocumentEvent) {
+		switch event {
+		case .beginParagraph:
+			beginBlock(.paragraph)
+		case .beginHeading(let level):
+			beginBlock(.heading(level))
+		case .beginListItem(let level, let ordered):
+			closeImplicitParagraph()
+			container = .listItem(level: max(level, 0), ordered: ordered)
+			resetInline()
+		case .beginCodeBlock:
+			beginBlock(.codeBlock)
+		case .endParagraph, .endHeading, .endListItem, .endCodeBlock:
+			endBlock()
+		case .beginBlockQuote:
+			closeImplicitParagraph()
+			quoteDepth += 1
+		case .endBlockQuote:
+			closeImplicitParagraph()
+			quoteDepth = max(quoteDepth - 1, 0)
+		case .beginTable(let alignments):
+			beginBlock(nil)
+			table = TableState(alignments: alignments.map {
+				switch $0 {
+				case .left: return .left
+				case .center: return .center
+				case .right: return .right
+				}
+			})
+		case .endTable:
+			if let table { appendTable(table) }
+			table = nil
+		case .beginTableRow:
+			table?.row = []
+		case .endTableRow:
+			if let row = table?.row { table?.rows.append(row) }
+		case .beginTableCell:
+			resetInline()
+			container = .tableCell
+		case .endTableCell:
+			closeLink()
+			table?.row.append((text, runs))
+			resetInline()
+			container = nil
+		case .text(let string, let style):
+			if case .codeBlock? = container {
+				text += string
+				return
+			}
+			openImplicitParagraph()
+			append(string, style: style)
+		case .lineBreak:
+			openImplicitParagraph()
+			text += "\u{2028}"
+		case .image(let source, let alt):
+			if container == nil {
+				beginBlock(nil)
+				paragraphs.append(BodyParagraph(
+					text: "\u{FFFC}",
+					paragraphStyle: PagesStyleID.body,
+					image: BodyParagraph.ImageRef(source: source, alt: alt)
+				))
+			} else {
+				// Inline images are italic alt text, as in the Markdown path.
+				append(alt.isEmpty ? "[image]" : alt, style: DocumentTextStyle(italic: true))
+			}
+		case .footnoteReference(let number):
+			openImplicitParagraph()
+			references.append((text.utf16.count, number))
+			text += "\u{0E}"
+		case .footnote(let number, let text):
+			footnoteTexts[number] = text
+		case .horizontalRule:
+			beginBlock(nil)
+			paragraphs.append(BodyParagraph(text: String(repeating: "\u{2500}", count: 40), paragraphStyle: PagesStyleID.body))
+		}
+	}
+
+	mutating func finish() {
+		closeImplicitParagraph()
+		if case .tableCell? = container {
+			consume(.endTableCell)
+		} else if container != nil {
+			endBlock()
+		}
+		if table != nil { consume(.endTable) }
+		quoteDepth = 0
+		// A note whose definition never arrived keeps an empty body.
+		for pending in pendingFootnotes {
+			paragraphs[pending.paragraph].footnoteRefs[pending.reference].text = footnoteTexts[pending.number] ?? ""
+		}
+		pendingFootnotes.removeAll()
+	}
+
+	// MARK: - Blocks
+
+	private mutating func beginBlock(_ kind: Container?) {
+		closeImplicitParagraph()
+		listLevels.removeAll()
+		container = kind
+		resetInline()
+	}
+
+	private mutating func endBlock() {
+		closeLink()
+		var paragraph: BodyParagraph
+		switch container {
+		case .paragraph?:
+			paragraph = BodyParagraph(text: text, paragraphStyle: PagesStyleID.body, blockQuote: quoteDepth > 0)
+		case .heading(let level)?:
+			paragraph = BodyParagraph(text: text, paragraphStyle: PagesStyleID.heading(level: level))
+		case .listItem(let level, let ordered)?:
+			paragraph = BodyParagraph(
+				text: text,
+				paragraphStyle: PagesStyleID.body,
+				listStyle: ordered ? PagesStyleID.numberedList : PagesStyleID.bulletList,
+				listLevel: level,
+				listInstance: listInstance(level: level, ordered: ordered)
+			)
+		case .codeBlock?:
+			paragraph = BodyParagraph(text: text.replacingOccurrences(of: "\n", with: "\u{2028}"), paragraphStyle: PagesStyleID.codeBlock)
+		case .tableCell?, nil:
+			return
+		}
+		paragraph.runs = runs
+		paragraph.links = links
+		if !references.isEmpty {
+			// Texts are filled in by `finish()`; definitions usually follow the body.
+			paragraph.footnoteRefs = references.map { BodyParagraph.FootnoteRef(offset: $0.offset, text: "") }
+			for (index, reference) in references.enumerated() {
+				pendingFootnotes.append((paragraphs.count, index, reference.number))
+			}
+		}
+		paragraphs.append(paragraph)
+		container = nil
+		resetInline()
+	}
+
+	/// Keeps one Pages list instance per ordered list: a new one starts when a level
+	/// is entered afresh (from a shallower item or another block) or changes kind.
+	private mutating func listInstance(level: Int, ordered: Bool) -> Int? {
+		if listLevels.count > level + 1 {
+			listLevels.removeLast(listLevels.count - level - 1)
+		}
+		if listLevels.count == level + 1, listLevels[level].ordered == ordered {
+			return listLevels[level].instance
+		}
+		if listLevels.count == level + 1 { listLevels.removeLast() }
+		while listLevels.count < level {
+			listLevels.append((false, nil))
+		}
+		var instance: Int?
+		if ordered {
+			instance = nextListInstance
+			nextListInstance += 1
+		}
+		listLevels.append((ordered, instance))
+		return instance
+	}
+
+	private mutating func appendTable(_ table: TableState) {
+		let columns = max(table.rows.map(\.count).max() ?? 0, table.alignments.count)
+		guard columns > 0, !table.rows.isEmpty else { return }
+		var cells = [String]()
+		var cellRuns = [[BodyParagraph.StyledRun]]()
+		for row in table.rows {
+			for column in 0..<columns {
+				if column < row.count {
+					cells.append(row[column].text)
+					cellRuns.append(row[column].runs)
+				} else {
+					cells.append("")
+					cellRuns.append([])
+				}
+			}
+		}
+		var pagesTable = PagesTable(rows: table.rows.count, columns: columns, cells: cells)
+		pagesTable.cellRuns = cellRuns
+		pagesTable.alignments = (0..<columns).map { $0 < table.alignments.count ? table.alignments[$0] : .left }
+		paragraphs.append(BodyParagraph(
+			text: "\u{FFFC}",
+			paragraphStyle: PagesStyleID.body,
+			attachment: PagesTableTemplate.attachmentID,
+			table: pagesTable
+		))
+	}
+
+	// MARK: - Inline
+
+	private mutating func openImplicitParagraph() {
+		guard container == nil else { return }
+		container = .paragraph
+		implicitParagraph = true
+		resetInline()
+	}
+
+	private mutating func closeImplicitParagraph() {
+		guard implicitParagraph else { return }
+		implicitParagraph = false
+		endBlock()
+	}
+
+	private mutating func resetInline() {
+		text = ""
+		runs = []
+		links = []
+		openLink = nil
+		references = []
+	}
+
+	private mutating func append(_ string: String, style: DocumentTextStyle) {
+		guard !string.isEmpty else { return }
+		if style.link != openLink?.url {
+			closeLink()
+			if let url = style.link, !url.isEmpty { openLink = (text.utf16.count, url) }
+		}
+		let inline = InlineStyle(
+			bold: style.bold,
+			italic: style.italic,
+			underline: style.underline,
+			strikethrough: style.strikethrough,
+			code: style.code,
+			link: style.link != nil
+		)
+		let start = text.utf16.count
+		text += string
+		if !inline.isPlain {
+			runs.append(.init(start: start, length: string.utf16.count, style: inline))
+		}
+	}
+
+	private mutating func closeLink() {
+		guard let link = openLink else { return }
+		let length = text.utf16.count - link.start
+		if length > 0 { links.append(.init(start: link.start, length: length, url: link.url)) }
+		openLink = nil
+	}
+}
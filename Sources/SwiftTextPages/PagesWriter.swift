@@ -9,6 +9,8 @@ import Foundation
 /// runtime beyond the template data compiled into the module.
 public final class PagesWriter {
 	private let template: PagesTemplate
+	/// Body paragraphs built from a consumed `DocumentEvent` stream; see ``write(to:baseURL:)``.
+	var eventAssembly = PagesEventAssembly()
 
 	init(template: PagesTemplate) {
 		self.template = template
@@ -58,7 +60,7 @@ public final class PagesWriter {
 		// Inline images: resolve each image paragraph's source against `baseURL`, embed
 		// the bytes (`Data/` + a PackageMetadata DataInfo), and point its #9 anchor at
 		// the image's drawable attachment. Unresolved images degrade to alt-text.
-		guard let documentTemplate = template.data(for: "Index/Document.iwa") else {
+		guard let documentTemplate = template.bytes(for: "Index/Document.iwa") else {
 			throw PagesWriteError.malformedTemplate("Index/Document.iwa")
 		}
 		let bodyID = try bodyStorageIdentifier(in: Data(documentTemplate))
@@ -183,9 +185,7 @@ public final class PagesWriter {
 	/// table's `Index/Tables/*` components are registered, and the cross-references
 	/// are cloned at the matching id offsets (see `PagesTableBuilder`).
 	private func tablePackageMetadata(highWaterMark: UInt64, tableCount: Int, styleComponentRefs: [UInt64: [UInt64]]) throws -> [UInt8] {
-		guard let data = Data(base64Encoded: PagesTableTemplate.metadataBase64) else {
-			throw PagesWriteError.malformedTemplate("Index/Metadata.iwa")
-		}
+		let data = Data(PagesTableTemplate.metadata)
 		guard let packageMetadata = try IWAArchive.objects(from: data).first(where: { $0.type == 11006 }) else {
 			return [UInt8](data)
 		}
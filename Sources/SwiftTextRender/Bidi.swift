@@ -33,7 +33,48 @@ public enum Bidi {
 
 	/// The resolved embedding level of each scalar.
 	public static func levels(for scalars: [Unicode.Scalar], baseDirection: BidiDirection) -> [UInt8] {
-		resolveLevels(scalars.map(bidiClass), baseLevel: baseDirection.baseLevel)
+		var runs = BidiRuns()
+		runs.append(scalars)
+		var levels: [UInt8] = []
+		levels.reserveCapacity(scalars.count)
+		for (level, length) in zip(runs.levels(baseLevel: baseDirection.baseLevel), runs.lengths) {
+			levels.append(contentsOf: repeatElement(level, count: length))
+		}
+		return levels
+	}
+
+	/// Whether `text` may hold a right-to-left or Arabic-number character — the
+	/// only classes that lift a left-to-right paragraph off level 0. `false` means
+	/// bidi resolution can be skipped. Scans the UTF-8 bytes eight at a time,
+	/// conservatively matching whole blocks (U+0580–U+08FF, U+FB00–U+FEFF).
+	public static func mayContainRightToLeft(_ text: String) -> Bool {
+		if let result = text.utf8.withContiguousStorageIfAvailable(mayContainRightToLeft) {
+			return result
+		}
+		return Array(text.utf8).withUnsafeBufferPointer(mayContainRightToLeft)
+	}
+
+	private static func mayContainRightToLeft(_ bytes: UnsafeBufferPointer<UInt8>) -> Bool {
+		guard let base = bytes.baseAddress else { return false }
+		let raw = UnsafeRawPointer(base)
+		let count = bytes.count
+		var index = 0
+		while index < count {
+			// An all-ASCII word of eight bytes can't start RTL text.
+			if index + 8 <= count, raw.loadUnaligned(fromByteOffset: index, as: UInt64.self) & 0x8080_8080_8080_8080 == 0 {
+				index += 8
+				continue
+			}
+			let byte = bytes[index]
+			let next = index + 1 < count ? bytes[index + 1] : 0
+			switch byte {
+			case 0xD6 ... 0xDF: return true                                  // U+0580–U+07FF
+			case 0xE0 where (0xA0 ... 0xA3).contains(next): return true      // U+0800–U+08FF
+			case 0xEF where (0xAC ... 0xBB).contains(next): return true      // U+FB00–U+FEFF
+			default: index += 1
+			}
+		}
+		return false
 	}
 
 	/// The visual (left-to-right display) order of scalar indices for a line,
@@ -89,7 +130,38 @@ public enum Bidi {
 
 // MARK: - Resolution (W, N, I rules)
 
-private func resolveLevels(_ classes: [BidiClass], baseLevel: UInt8) -> [UInt8] {
+/// Bidi classes run-length encoded: one entry per maximal run of a class. The
+/// W, N and I rules compare a character only with its neighbours' classes, so
+/// they resolve a whole run at once and no per-scalar array is needed.
+struct BidiRuns {
+	private(set) var classes: [BidiClass] = []
+	private(set) var lengths: [Int] = []
+
+	/// Appends `scalars`, returning the index of the run holding the first one.
+	@discardableResult
+	mutating func append<S: Sequence>(_ scalars: S) -> Int where S.Element == Unicode.Scalar {
+		var first: Int?
+		for scalar in scalars {
+			let bidi = bidiClass(scalar)
+			if classes.last == bidi {
+				lengths[lengths.count - 1] += 1
+			} else {
+				classes.append(bidi)
+				lengths.append(1)
+			}
+			if first == nil { first = classes.count - 1 }
+		}
+		return first ?? max(classes.count - 1, 0)
+	}
+
+	/// The resolved embedding level of each run.
+	func levels(baseLevel: UInt8) -> [UInt8] {
+		resolveLevels(classes, lengths: lengths, baseLevel: baseLevel)
+	}
+}
+
+/// Resolves run levels; `t[i]` is the class of run `i`, `lengths[i]` its scalar count.
+private func resolveLevels(_ classes: [BidiClass], lengths: [Int], baseLevel: UInt8) -> [UInt8] {
 	let n = classes.count
 	guard n > 0 else { return [] }
 	var t = classes
@@ -115,7 +187,7 @@ private func resolveLevels(_ classes: [BidiClass], baseLevel: UInt8) -> [UInt8]
 	for i in 0 ..< n where t[i] == .al { t[i] = .r }
 	// W4: a single ES between EN/EN, or CS between EN/EN or AN/AN, joins them.
 	if n >= 3 {
-		for i in 1 ..< (n - 1) {
+		for i in 1 ..< (n - 1) where lengths[i] == 1 {
 			if t[i] == .es, t[i - 1] == .en, t[i + 1] == .en {
 				t[i] = .en
 			} else if t[i] == .cs, t[i - 1] == .en, t[i + 1] == .en {
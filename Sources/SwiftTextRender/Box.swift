@@ -9,28 +9,58 @@ import Foundation
 import SwiftTextCSS
 
 /// Base class for all boxes. Geometry fields are filled during layout and refer
-/// to the border-box top-left corner in absolute page coordinates.
+/// to the border-box top-left corner in absolute page coordinates; they are
+/// stored in the tree's ``BoxArena``.
 public class Box {
+	enum Kind {
+		case block, inline, text
+	}
+
+	/// The tree's shared storage. Boxes keep it alive; it holds no boxes.
+	let arena: BoxArena
+	/// This box's geometry slot in `arena`.
+	let slot: Int
+	/// This box's style, as an index into `arena.styles`.
+	let styleIndex: Int
+	/// The concrete box class, for checks that would otherwise be casts.
+	let kind: Kind
+
 	/// The computed style governing this box.
-	public let style: ComputedStyle
+	public var style: ComputedStyle { arena.styles[styleIndex] }
 	/// The source element this box came from, if any (nil for anonymous/text).
 	/// A strong reference: the box tree keeps its styled elements alive (elements
 	/// do not reference boxes, so there is no cycle).
 	public internal(set) var element: StyledElement?
 
 	// Layout results (border-box geometry).
-	public var x: Double = 0
-	public var y: Double = 0
-	public var width: Double = 0
-	public var height: Double = 0
+	public var x: Double {
+		get { arena[.x, slot] }
+		set { arena[.x, slot] = newValue }
+	}
+	public var y: Double {
+		get { arena[.y, slot] }
+		set { arena[.y, slot] = newValue }
+	}
+	public var width: Double {
+		get { arena[.width, slot] }
+		set { arena[.width, slot] = newValue }
+	}
+	public var height: Double {
+		get { arena[.height, slot] }
+		set { arena[.height, slot] = newValue }
+	}
 
-	init(style: ComputedStyle) {
-		self.style = style
+	init(style: ComputedStyle, kind: Kind, arena: BoxArena) {
+		self.arena = arena
+		self.slot = arena.allocateSlot()
+		self.styleIndex = arena.intern(style)
+		self.kind = kind
 	}
 
 	/// Used (drawn) border widths, accounting for `border-style: none`.
 	public var usedBorder: Edges<Double> {
-		Edges(
+		let style = self.style
+		return Edges(
 			top: style.borderStyle.top.isVisible ? style.borderWidth.top : 0,
 			right: style.borderStyle.right.isVisible ? style.borderWidth.right : 0,
 			bottom: style.borderStyle.bottom.isVisible ? style.borderWidth.bottom : 0,
@@ -52,14 +82,14 @@ public final class BlockBox: Box {
 	/// For replaced `<img>` boxes, the decoded image to draw.
 	public var image: DecodedImage?
 
-	init(style: ComputedStyle, isAnonymous: Bool = false) {
+	init(style: ComputedStyle, isAnonymous: Bool = false, arena: BoxArena) {
 		self.isAnonymous = isAnonymous
-		super.init(style: style)
+		super.init(style: style, kind: .block, arena: arena)
 	}
 
 	/// Whether this block's children are all inline-level (an inline context).
 	public var establishesInlineContext: Bool {
-		!children.isEmpty && children.allSatisfy { $0 is InlineBox || $0 is TextBox }
+		!children.isEmpty && children.allSatisfy { $0.kind != .block }
 	}
 }
 
@@ -67,9 +97,9 @@ public final class BlockBox: Box {
 public final class InlineBox: Box {
 	public var children: [Box] = []
 
-	init(style: ComputedStyle, children: [Box] = []) {
+	init(style: ComputedStyle, children: [Box] = [], arena: BoxArena) {
 		self.children = children
-		super.init(style: style)
+		super.init(style: style, kind: .inline, arena: arena)
 	}
 }
 
@@ -77,9 +107,9 @@ public final class InlineBox: Box {
 public final class TextBox: Box {
 	public var text: String
 
-	init(style: ComputedStyle, text: String) {
+	init(style: ComputedStyle, text: String, arena: BoxArena) {
 		self.text = text
-		super.init(style: style)
+		super.init(style: style, kind: .text, arena: arena)
 	}
 }
 
@@ -100,7 +130,10 @@ public final class LineBox {
 /// A shaped run of text positioned on a line.
 public struct TextFragment {
 	public var text: String
-	public let style: ComputedStyle
+	/// The style this run is drawn in, shared through its tree's style table.
+	public var style: ComputedStyle { arena.styles[styleIndex] }
+	let arena: BoxArena
+	let styleIndex: Int
 	public var x: Double
 	public var y: Double
 	public var width: Double
@@ -113,10 +146,30 @@ public struct TextFragment {
 	/// The font this run is drawn with. When nil, the painter resolves it from
 	/// `style`; font fallback sets it so a fallback face survives to drawing.
 	public var font: Font?
+	/// For an embedded `font`, the glyph of each scalar of `text` as resolved
+	/// during layout, so painting needn't map them again.
+	var glyphs: [Int]?
 
+	/// A standalone fragment, whose style lives in a table shared by every
+	/// standalone fragment with an equal style.
+	@available(*, deprecated, message: "Use init(text:style:in:…), which shares the box tree's style table")
 	public init(text: String, style: ComputedStyle, x: Double, y: Double, width: Double, baseline: Double, href: String? = nil, bidiLevel: UInt8 = 0, font: Font? = nil) {
+		self.init(text: text, arena: .standalone(for: style), styleIndex: 0, x: x, y: y, width: width,
+		          baseline: baseline, href: href, bidiLevel: bidiLevel, font: font)
+	}
+
+	/// A fragment drawn in `style`, interned into `box`'s tree's style table, so
+	/// fragments built alongside a tree share its storage.
+	public init(text: String, style: ComputedStyle, in box: Box, x: Double, y: Double, width: Double, baseline: Double, href: String? = nil, bidiLevel: UInt8 = 0, font: Font? = nil) {
+		self.init(text: text, arena: box.arena, styleIndex: box.arena.intern(style), x: x, y: y, width: width,
+		          baseline: baseline, href: href, bidiLevel: bidiLevel, font: font)
+	}
+
+	/// A fragment whose style is `arena.styles[styleIndex]`.
+	init(text: String, arena: BoxArena, styleIndex: Int, x: Double, y: Double, width: Double, baseline: Double, href: String? = nil, bidiLevel: UInt8 = 0, font: Font? = nil) {
 		self.text = text
-		self.style = style
+		self.arena = arena
+		self.styleIndex = styleIndex
 		self.x = x
 		self.y = y
 		self.width = width
@@ -125,4 +178,10 @@ public struct TextFragment {
 		self.bidiLevel = bidiLevel
 		self.font = font
 	}
+
+	/// Whether `other` is drawn in the very same style slot, so its style needn't
+	/// be read again.
+	func sharesStyle(with other: TextFragment) -> Bool {
+		styleIndex == other.styleIndex && arena === other.arena
+	}
 }
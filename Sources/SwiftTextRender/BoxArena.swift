@@ -0,0 +1,90 @@
+//  BoxArena.swift
+//  SwiftTextRender
+//
+//  Backing storage for one box tree: border-box geometry as contiguous columns
+//  and an interned style table, addressed by integer index and released with
+//  the tree.
+
+import Foundation
+import SwiftTextCSS
+
+/// The storage shared by the boxes and text fragments of one box tree.
+///
+/// A box is a slot: its `x`, `y`, `width` and `height` live in four column
+/// arrays rather than in the object, so walking the geometry of many boxes
+/// touches contiguous memory. Styles are stored once in ``styles`` and
+/// referred to by index, which keeps per-fragment copies out of line boxes.
+///
+/// Slots and styles are allocated while the tree is built, on one thread.
+/// Layout then writes geometry in place; columns are kept in fixed-size
+/// chunks that never move, so parallel layout of distinct boxes is race-free.
+///
+/// Boxes themselves are still the public `Box` class instances; only their
+/// geometry and styles live here.
+final class BoxArena: @unchecked Sendable {
+	enum Column: Int {
+		case x, y, width, height
+	}
+
+	private static let chunkSize = 1024
+	/// Each chunk holds `chunkSize` slots: the four columns back to back.
+	private var chunks: [UnsafeMutablePointer<Double>] = []
+	private(set) var count = 0
+	private(set) var styles: [ComputedStyle] = []
+
+	deinit {
+		for chunk in chunks { chunk.deallocate() }
+	}
+
+	/// A new zeroed geometry slot.
+	func allocateSlot() -> Int {
+		if count == chunks.count * Self.chunkSize {
+			let chunk = UnsafeMutablePointer<Double>.allocate(capacity: 4 * Self.chunkSize)
+			chunk.initialize(repeating: 0, count: 4 * Self.chunkSize)
+			chunks.append(chunk)
+		}
+		count += 1
+		return count - 1
+	}
+
+	subscript(column: Column, slot: Int) -> Double {
+		get { chunks[slot / Self.chunkSize][column.rawValue * Self.chunkSize + slot % Self.chunkSize] }
+		set { chunks[slot / Self.chunkSize][column.rawValue * Self.chunkSize + slot % Self.chunkSize] = newValue }
+	}
+
+	/// The index of `style` in ``styles``. Boxes are built children first, so a
+	/// style usually repeats one of the last few entries (text and its parent,
+	/// sibling paragraphs); only those are compared.
+	func intern(_ style: ComputedStyle) -> Int {
+		for index in styles.indices.suffix(4).reversed() where styles[index] == style {
+			return index
+		}
+		styles.append(style)
+		return styles.count - 1
+	}
+}
+
+extension BoxArena {
+	/// A one-style table holding `style`, shared by every fragment made with an
+	/// equal style outside a box tree. Tables are never changed once created, so
+	/// fragments on any thread may read them.
+	static func standalone(for style: ComputedStyle) -> BoxArena {
+		StandaloneStyleTables.shared.table(for: style)
+	}
+}
+
+private final class StandaloneStyleTables: @unchecked Sendable {
+	static let shared = StandaloneStyleTables()
+	private let lock = NSLock()
+	private var tables: [ComputedStyle: BoxArena] = [:]
+
+	func table(for style: ComputedStyle) -> BoxArena {
+		lock.lock()
+		defer { lock.unlock() }
+		if let table = tables[style] { return table }
+		let table = BoxArena()
+		_ = table.intern(style)
+		tables[style] = table
+		return table
+	}
+}
@@ -11,7 +11,12 @@ import SwiftTextCSS
 public enum BoxTreeBuilder {
 
 	/// Build a box for a styled element, or `nil` if it is `display: none`.
+	/// The tree's geometry and styles live in one ``BoxArena``.
 	public static func build(from element: StyledElement) -> Box? {
+		build(from: element, in: BoxArena())
+	}
+
+	private static func build(from element: StyledElement, in arena: BoxArena) -> Box? {
 		let style = element.computedStyle
 		if style.display == .none { return nil }
 
@@ -20,21 +25,21 @@ public enum BoxTreeBuilder {
 		if element.localName == "img" {
 			guard let src = element.attributeValue("src"), src.hasPrefix("data:"),
 			      let image = ImageDecoder.decode(dataURI: src) else { return nil }
-			let box = BlockBox(style: style)
+			let box = BlockBox(style: style, arena: arena)
 			box.image = image
 			box.element = element
 			return box
 		}
 
-		let childBoxes = buildChildBoxes(of: element)
+		let childBoxes = buildChildBoxes(of: element, in: arena)
 
 		let box: Box
 		switch style.display {
 		case .inline, .inlineBlock:
-			box = InlineBox(style: style, children: childBoxes)
+			box = InlineBox(style: style, children: childBoxes, arena: arena)
 		default:
-			let block = BlockBox(style: style)
-			block.children = normalizeBlockChildren(childBoxes, parentStyle: style)
+			let block = BlockBox(style: style, arena: arena)
+			block.children = normalizeBlockChildren(childBoxes, parentStyle: style, in: arena)
 			if style.display == .listItem {
 				let marker = markerText(for: element)
 				if !marker.isEmpty { block.marker = marker }
@@ -124,17 +129,17 @@ public enum BoxTreeBuilder {
 		return result
 	}
 
-	private static func buildChildBoxes(of element: StyledElement) -> [Box] {
+	private static func buildChildBoxes(of element: StyledElement, in arena: BoxArena) -> [Box] {
 		var result: [Box] = []
 		for child in element.children {
 			switch child {
 			case .element(let childElement):
-				if let box = build(from: childElement) {
+				if let box = build(from: childElement, in: arena) {
 					result.append(box)
 				}
 			case .text(let text):
 				// Text inherits the containing element's style.
-				result.append(TextBox(style: element.computedStyle, text: text))
+				result.append(TextBox(style: element.computedStyle, text: text, arena: arena))
 			}
 		}
 		return result
@@ -142,8 +147,8 @@ public enum BoxTreeBuilder {
 
 	/// Ensure block containers don't mix block- and inline-level children: wrap
 	/// inline runs in anonymous block boxes when block siblings are present.
-	private static func normalizeBlockChildren(_ children: [Box], parentStyle: ComputedStyle) -> [Box] {
-		let hasBlock = children.contains { $0 is BlockBox }
+	private static func normalizeBlockChildren(_ children: [Box], parentStyle: ComputedStyle, in arena: BoxArena) -> [Box] {
+		let hasBlock = children.contains { $0.kind == .block }
 		if !hasBlock {
 			return trimWhitespace(children)
 		}
@@ -155,13 +160,13 @@ public enum BoxTreeBuilder {
 			let trimmed = trimWhitespace(inlineRun)
 			inlineRun = []
 			guard !trimmed.isEmpty else { return }
-			let anonymous = BlockBox(style: ComputedStyle.anonymousBlock(from: parentStyle), isAnonymous: true)
+			let anonymous = BlockBox(style: ComputedStyle.anonymousBlock(from: parentStyle), isAnonymous: true, arena: arena)
 			anonymous.children = trimmed
 			result.append(anonymous)
 		}
 
 		for child in children {
-			if child is BlockBox {
+			if child.kind == .block {
 				flushInlineRun()
 				result.append(child)
 			} else {
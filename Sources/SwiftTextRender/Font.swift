@@ -87,7 +87,7 @@ public struct StandardFont: Equatable {
 	/// Base-14 fonts use WinAnsiEncoding (CP1252); treat anything CP1252 can
 	/// encode as covered (ASCII, Latin-1, smart quotes, dashes, bullet…).
 	func covers(_ scalar: Unicode.Scalar) -> Bool {
-		String(scalar).data(using: .windowsCP1252) != nil
+		scalar.isASCII || String(scalar).data(using: .windowsCP1252) != nil
 	}
 }
 
@@ -115,6 +115,8 @@ public struct EmbeddedFont {
 	public func descent(size: Double) -> Double { -Double(otf.descent) * size / unitsPerEm }
 	public func glyphID(for scalar: Unicode.Scalar) -> Int { otf.glyphID(for: scalar) ?? 0 }
 	public func advanceWidth(glyph: Int) -> Int { otf.advanceWidth(glyph: glyph) }
+	/// `glyph`'s advance in 1000-unit glyph space, rounded as the CIDFont `/W` array records it.
+	func pdfWidth(glyph: Int) -> Int { Int((Double(advanceWidth(glyph: glyph)) * (1000.0 / unitsPerEm)).rounded()) }
 	/// Whether the font's cmap maps `scalar` to a real glyph (used by the Arabic
 	/// shaper to skip presentation forms the font doesn't carry).
 	public func hasGlyph(for scalar: Unicode.Scalar) -> Bool { otf.glyphID(for: scalar) != nil }
@@ -128,9 +130,16 @@ public final class FontBook {
 	private var registrationOrder: [EmbeddedFont] = []
 	/// Loaded system fallback faces, by file path (nil = tried and unusable).
 	private var systemFallbackCache: [String: EmbeddedFont?] = [:]
+	/// Serializes fallback loading; parallel layout resolves fonts from many threads.
+	private let fallbackLock = NSLock()
 	/// Whether to fall back to bundled system fonts for glyphs no registered or
 	/// base-14 font can render. Disable for hermetic/deterministic rendering.
-	public var systemFallbackEnabled = true
+	public var systemFallbackEnabled = true {
+		didSet { revision = UUID() }
+	}
+	/// Changes whenever font selection may change, so ``LayoutCache`` entries
+	/// laid out with an earlier set of fonts stop matching.
+	private(set) var revision = UUID()
 
 	public init() {}
 
@@ -142,6 +151,7 @@ public final class FontBook {
 		let font = EmbeddedFont(otf: otf, postScriptName: Self.postScriptName(from: family))
 		registered[family.lowercased()] = font
 		registrationOrder.append(font)
+		revision = UUID()
 		return font
 	}
 
@@ -165,8 +175,12 @@ public final class FontBook {
 	/// Split `text` into maximal runs that share one font, picking a fallback
 	/// face per character when the primary font lacks the glyph. Each run is a
 	/// `(text, font)` pair in logical order.
-	public func resolveRuns(_ text: String, style: ComputedStyle) -> [(text: String, font: Font)] {
+	public func resolveRuns<S: StringProtocol>(_ text: S, style: ComputedStyle) -> [(text: String, font: Font)] {
 		let primary = font(for: style)
+		// Usually the primary covers the whole word: one run, no per-scalar copy.
+		if text.unicodeScalars.allSatisfy(primary.covers) {
+			return text.isEmpty ? [] : [(String(text), primary)]
+		}
 		var runs: [(text: String, font: Font)] = []
 		var currentText = String.UnicodeScalarView()
 		var currentFont: Font?
@@ -211,6 +225,8 @@ public final class FontBook {
 
 	/// Lazily load and cache the first bundled system font that renders `scalar`.
 	private func systemFallback(for scalar: Unicode.Scalar) -> EmbeddedFont? {
+		fallbackLock.lock()
+		defer { fallbackLock.unlock() }
 		for path in Self.systemCandidates(for: scalar) {
 			if let cached = systemFallbackCache[path] {
 				if let face = cached, face.hasGlyph(for: scalar) { return face }
@@ -1,8 +1,9 @@
 //  FontResources.swift
 //  SwiftTextRender
 //
-//  Builds the PDF font objects shared by every page of a render. Base-14 fonts
-//  become inline Type1 dictionaries; registered OpenType fonts are embedded as
+//  Builds the PDF font objects shared by every page of a render, along with
+//  the image and form XObjects in the same resources. Base-14 fonts become
+//  inline Type1 dictionaries; registered OpenType fonts are embedded as
 //  CIDFontType2 (Type0 / Identity-H) with a FontFile2 program, a W width array
 //  for the glyphs actually used, and a ToUnicode CMap so text stays
 //  searchable/extractable.
@@ -24,6 +25,15 @@ public final class FontResourceBuilder {
 	private var embeddedFonts: [String: EmbeddedFont] = [:]
 	private var usedGlyphs: [String: [Int: Unicode.Scalar]] = [:] // key → glyph → a scalar
 	private var imageNames: [ObjectIdentifier: String] = [:]   // image stream → /Im#
+	private var forms: [RepeatedContent: Form] = [:]
+	private var formsBySignature: [Data: Form] = [:]
+
+	/// A Form XObject holding content repeated across pages, and the link
+	/// annotations each page showing it needs.
+	struct Form {
+		let name: String
+		let annotations: [PDFDictionary]
+	}
 
 	init(pdf: PDF, compress: Bool = true) {
 		self.pdf = pdf
@@ -43,6 +53,29 @@ public final class FontResourceBuilder {
 		return name
 	}
 
+	/// The form already drawn for `content`, if any page has needed it yet.
+	func form(for content: RepeatedContent) -> Form? {
+		forms[content]
+	}
+
+	/// Register `stream` as the Form XObject for `content`. Different content
+	/// can still draw the same thing — the margin boxes of first, left and
+	/// right pages when no `@page` selector tells them apart — and then shares
+	/// the form already embedded.
+	func addForm(_ stream: PDFStream, for content: RepeatedContent, annotations: [PDFDictionary]) -> Form {
+		let signature = annotations.reduce(stream.data) { $0 + $1.data }
+		if let same = formsBySignature[signature] {
+			forms[content] = same
+			return same
+		}
+		let form = Form(name: "Fm\(formsBySignature.count + 1)", annotations: annotations)
+		forms[content] = form
+		formsBySignature[signature] = form
+		pdf.addObject(stream)
+		xobjectSubdictionary[form.name] = stream.reference
+		return form
+	}
+
 	/// A reference to the shared `/Resources` dictionary.
 	var resourcesReference: Data { resourcesDict.reference }
 
@@ -123,9 +156,8 @@ public final class FontResourceBuilder {
 
 		let widths = PDFArray()
 		for glyph in glyphs.keys.sorted() {
-			let width = Int((Double(font.advanceWidth(glyph: glyph)) * scale).rounded())
 			widths.elements.append(glyph)
-			widths.elements.append(PDFArray([width]))
+			widths.elements.append(PDFArray([font.pdfWidth(glyph: glyph)]))
 		}
 
 		// CIDFontType0 (CFF) addresses glyphs by GID via Identity-H, so no
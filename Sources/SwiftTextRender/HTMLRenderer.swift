@@ -9,6 +9,7 @@
 //  paginated output is layered on next.
 
 import Foundation
+import SwiftTextCore
 import SwiftTextHTML
 import SwiftTextCSS
 import SwiftTextPDFWriter
@@ -38,13 +39,27 @@ public struct RenderOptions {
 	/// Disable it to get verbatim, greppable content streams (e.g. in tests that
 	/// assert on literal operator bytes).
 	public var compressStreams: Bool
-
-	public init(pageWidthPx: Double = 816, pageHeightPx: Double? = 1056, pageMarginPx: Double = 32, baseDirection: BaseDirection = .auto, compressStreams: Bool = true) {
+	/// Bounds on DOM nodes, layout boxes, pages, and wall-clock time, for
+	/// rendering untrusted HTML. Unlimited by default.
+	public var limits: ResourceLimits
+	/// Lay out runs of sibling blocks (a long document's paragraphs, a list's
+	/// items) on all cores. The output is the same as serial layout; off by
+	/// default since small documents don't repay the thread hand-offs.
+	public var parallelLayout: Bool
+	/// Reuse the layout of block subtrees from earlier renders that shared this
+	/// cache and the same ``FontBook`` — for a template rendered many times
+	/// with only some fields changing. `nil` (default) lays out everything.
+	public var layoutCache: LayoutCache?
+
+	public init(pageWidthPx: Double = 816, pageHeightPx: Double? = 1056, pageMarginPx: Double = 32, baseDirection: BaseDirection = .auto, compressStreams: Bool = true, limits: ResourceLimits = .unlimited, parallelLayout: Bool = false, layoutCache: LayoutCache? = nil) {
 		self.pageWidthPx = pageWidthPx
 		self.pageHeightPx = pageHeightPx
 		self.pageMarginPx = pageMarginPx
 		self.baseDirection = baseDirection
 		self.compressStreams = compressStreams
+		self.limits = limits
+		self.parallelLayout = parallelLayout
+		self.layoutCache = layoutCache
 	}
 }
 
@@ -65,55 +80,106 @@ public enum HTMLRenderer {
 	///     pass author CSS here).
 	///   - fonts: A font book; register OpenType fonts on it to embed them and
 	///     render arbitrary families/scripts. Defaults to base-14 only.
-	///   - options: Page geometry.
+	///   - options: Page geometry and resource limits.
+	/// - Throws: A `ResourceLimitError` when the document exceeds `options.limits`,
+	///   or `CancellationError` when the calling task is cancelled. Cancellation is
+	///   checked between stages, every few hundred nodes and boxes, and per page.
 	public static func renderPDF(html: String, css: [String] = [], fonts: FontBook = FontBook(), options: RenderOptions = RenderOptions()) async throws -> Data {
-		let builder = try await DomBuilder(html: Data(html.utf8), baseURL: nil)
+		let budget = ResourceBudget(options.limits)
+		let builder = try await DomBuilder(html: Data(html.utf8), baseURL: nil, budget: budget)
 		guard let root = builder.root else { throw RenderError.noDocument }
 
 		// Author stylesheets: the document's own <style> elements first, then any
 		// sheets supplied by the caller (which therefore win on equal specificity).
 		let documentSheets = root.styleSheets()
-		let resolver = StyleResolver(authorStyleSheets: documentSheets + css)
+		return try render(styleSheets: documentSheets + css, fonts: fonts, options: options, budget: budget,
+		                  contentDirection: { Bidi.firstStrongDirection(of: root.text().unicodeScalars) == .rightToLeft ? .rtl : .ltr }) { resolver, baseDirection in
+			StyledElement.build(domElement: root, resolver: resolver, baseDirection: baseDirection)
+		}
+	}
+
+	/// Render Markdown to PDF bytes without going through HTML.
+	///
+	/// The styled tree is built directly from the swift-markdown AST with the
+	/// elements and attributes `MarkdownToHTML` would emit, so `css` styles it
+	/// exactly as it would style that HTML, minus the serialize-and-reparse
+	/// step. Raw HTML in the source is treated as text, as the HTML output
+	/// escapes it.
+	///
+	/// - Parameters:
+	///   - markdown: The Markdown source, including `[^id]` footnotes.
+	///   - css: Author stylesheets; the document has none of its own.
+	///   - fonts: A font book, as for ``renderPDF(html:css:fonts:options:)``.
+	///   - options: Page geometry and resource limits. Markdown elements count
+	///     against the DOM-node limit.
+	/// - Throws: As ``renderPDF(html:css:fonts:options:)``.
+	public static func renderPDF(markdown: String, css: [String] = [], fonts: FontBook = FontBook(), options: RenderOptions = RenderOptions()) async throws -> Data {
+		let budget = ResourceBudget(options.limits)
+		let root = try MarkdownStyledTree.build(markdown: markdown, budget: budget)
+		try Task.checkCancellation()
+		return try render(styleSheets: css, fonts: fonts, options: options, budget: budget,
+		                  contentDirection: { firstStrongDirection(in: root) ?? .ltr }) { resolver, baseDirection in
+			root.resolveStyles(resolver: resolver, baseDirection: baseDirection)
+			return root
+		}
+	}
+
+	/// The shared pipeline once a document tree exists: resolve styles, build
+	/// and lay out boxes, paginate, and paint. `contentDirection` is only asked
+	/// for under `.auto`; `styledTree` builds the styled tree for the resolver
+	/// and base direction chosen here.
+	private static func render(styleSheets sheets: [String], fonts: FontBook, options: RenderOptions, budget: ResourceBudget,
+	                           contentDirection: () -> Direction,
+	                           styledTree: (StyleResolver, Direction) -> StyledElement) throws -> Data {
+		let resolver = StyleResolver(authorStyleSheets: sheets)
 
 		// @page rules in the document override the page geometry.
 		var options = options
-		applyAtPageRules(documentSheets + css, to: &options)
-		let pageRules = parsePageRules(documentSheets + css)
+		applyAtPageRules(sheets, to: &options)
+		let pageRules = parsePageRules(sheets)
 
 		// Resolve the base direction (auto-detect from content for Markdown etc.).
 		let baseDirection: Direction
 		switch options.baseDirection {
 		case .leftToRight: baseDirection = .ltr
 		case .rightToLeft: baseDirection = .rtl
-		case .auto: baseDirection = Bidi.firstStrongDirection(of: root.text().unicodeScalars) == .rightToLeft ? .rtl : .ltr
+		case .auto: baseDirection = contentDirection()
 		}
 
-		let styled = StyledElement.build(domElement: root, resolver: resolver, baseDirection: baseDirection)
+		let styled = styledTree(resolver, baseDirection)
+		try Task.checkCancellation()
 		guard let rootBox = BoxTreeBuilder.build(from: styled) as? BlockBox else { throw RenderError.noRootBox }
+		try Task.checkCancellation()
 
-		let engine = LayoutEngine(fonts: fonts)
+		let engine = LayoutEngine(fonts: fonts, budget: budget, parallel: options.parallelLayout, cache: options.layoutCache)
 		let margin = options.pageMarginPx
 		let contentWidth = max(0, options.pageWidthPx - 2 * margin)
 		// Lay the document out as a single tall column (origin at column y = 0).
-		let columnHeight = engine.layout(root: rootBox, contentWidth: contentWidth, originX: margin, originY: 0)
+		let columnHeight = try engine.layout(root: rootBox, contentWidth: contentWidth, originX: margin, originY: 0)
 
 		// Page height: fixed (paginated) or just enough for the whole column.
 		let pageHeightPx = options.pageHeightPx ?? (columnHeight + 2 * margin)
-		let slices = paginate(rootBox, columnHeight: columnHeight, pageHeightPx: pageHeightPx, margin: margin)
+		let slices = try paginate(rootBox, columnHeight: columnHeight, pageHeightPx: pageHeightPx, margin: margin,
+		                          repeatedHeaders: engine.repeatedTableHeaders, budget: budget)
 
 		let pdf = PDF()
 		let fontBuilder = FontResourceBuilder(pdf: pdf, compress: options.compressStreams)
 		var pageObjects: [PDFDictionary] = []
 		let totalPages = slices.count
+		let marginBoxes = MarginBoxTemplates(pageRules, rootStyle: rootBox.style, rootFontSize: rootBox.style.fontSize, fonts: fonts)
 		for (pageIndex, slice) in slices.enumerated() {
+			try budget.checkpoint()
 			let geometry = PageGeometry(pageWidthPx: options.pageWidthPx, pageHeightPx: pageHeightPx,
-			                            marginPx: margin, columnTop: slice.top, sliceHeightPx: slice.bottom - slice.top)
+			                            marginPx: margin, columnTop: slice.top, sliceHeightPx: slice.bottom - slice.top,
+			                            headerBandPx: slice.header?.height ?? 0)
 			let painter = Painter(geometry: geometry, fonts: fonts, builder: fontBuilder, compress: options.compressStreams)
 			painter.paint(rootBox)
-			if !pageRules.isEmpty {
-				let marginBoxes = resolveMarginBoxes(pageRules, pageIndex: pageIndex, totalPages: totalPages,
-				                                     rootStyle: rootBox.style, rootFontSize: rootBox.style.fontSize)
-				painter.paintMarginBoxes(marginBoxes)
+			if let header = slice.header { painter.paintRepeatedHeader(header) }
+			if !marginBoxes.isEmpty {
+				// With more than one page, running headers and footers are drawn
+				// once as shared forms instead of on every page.
+				painter.paintMarginBoxes(marginBoxes.resolve(pageIndex: pageIndex, totalPages: totalPages),
+				                         pageKind: totalPages > 1 ? MarginBoxTemplates.PageKind(pageIndex: pageIndex) : nil)
 			}
 			pdf.addObject(painter.stream)
 			let page = PDFDictionary([
@@ -138,7 +204,27 @@ public enum HTMLRenderer {
 		// Build the shared font objects now that every page's glyph use is known.
 		fontBuilder.finalize()
 		addOutline(to: pdf, root: rootBox, slices: slices, pages: pageObjects, pageHeightPx: pageHeightPx, margin: margin)
-		return pdf.write()
+		let data = pdf.write()
+		// Stream compression falls back to literals once the task is cancelled;
+		// that output is valid but nobody should receive it.
+		try Task.checkCancellation()
+		return data
+	}
+
+	/// The direction of the first strong character in the tree's text, or `nil`
+	/// if it has none.
+	private static func firstStrongDirection(in element: StyledElement) -> Direction? {
+		for child in element.children {
+			switch child {
+			case .text(let text):
+				if let direction = Bidi.firstStrongDirection(of: text.unicodeScalars) {
+					return direction == .rightToLeft ? .rtl : .ltr
+				}
+			case .element(let child):
+				if let direction = firstStrongDirection(in: child) { return direction }
+			}
+		}
+		return nil
 	}
 
 	// MARK: - @page rules
@@ -207,7 +293,7 @@ public enum HTMLRenderer {
 	// MARK: - Bookmarks / outline
 
 	/// Build a PDF outline (bookmarks) from the document's heading hierarchy.
-	private static func addOutline(to pdf: PDF, root: BlockBox, slices: [(top: Double, bottom: Double)],
+	private static func addOutline(to pdf: PDF, root: BlockBox, slices: [PageSlice],
 	                               pages: [PDFDictionary], pageHeightPx: Double, margin: Double) {
 		var headings: [(level: Int, title: String, y: Double)] = []
 		collectHeadings(root, into: &headings)
@@ -232,7 +318,7 @@ public enum HTMLRenderer {
 				pageIndex = index
 				break
 			}
-			let pageY = margin + (y - slices[pageIndex].top)
+			let pageY = margin + (slices[pageIndex].header?.height ?? 0) + (y - slices[pageIndex].top)
 			let topPt = (pageHeightPx - pageY) * pxToPt
 			return PDFArray([pages[pageIndex].reference, "/XYZ", margin * pxToPt, topPt, "null"])
 		}
@@ -290,34 +376,62 @@ public enum HTMLRenderer {
 		return words.joined(separator: " ").trimmingCharacters(in: .whitespacesAndNewlines)
 	}
 
+	/// One page's share of the laid-out column, and the table header repeated
+	/// above it when the page continues a table.
+	private struct PageSlice {
+		let top: Double
+		let bottom: Double
+		var header: BlockBox?
+	}
+
 	/// Split the laid-out column into page slices, breaking only at line and
-	/// block boundaries where possible.
-	private static func paginate(_ root: BlockBox, columnHeight: Double, pageHeightPx: Double, margin: Double) -> [(top: Double, bottom: Double)] {
+	/// block boundaries where possible. A page that starts inside a table body
+	/// repeats the table's `thead`, and holds that much less of the column.
+	private static func paginate(_ root: BlockBox, columnHeight: Double, pageHeightPx: Double, margin: Double,
+	                             repeatedHeaders: [RepeatedTableHeader], budget: ResourceBudget) throws -> [PageSlice] {
 		let contentHeight = max(1, pageHeightPx - 2 * margin)
 		guard columnHeight > contentHeight + 0.5 else {
-			return [(0, columnHeight)]
+			try budget.charge(.pages)
+			return [PageSlice(top: 0, bottom: columnHeight)]
 		}
 
 		var breaks: Set<Double> = []
 		collectBreaks(root, into: &breaks)
 		let sortedBreaks = breaks.sorted()
 
-		var slices: [(top: Double, bottom: Double)] = []
+		var slices: [PageSlice] = []
 		var top = 0.0
 		while top < columnHeight - 0.5 {
-			let target = top + contentHeight
+			// Charged before the slice is cut, so a runaway page count stops here.
+			try budget.charge(.pages)
+			let header = repeatedHeader(continuingAt: top, in: repeatedHeaders, contentHeight: contentHeight)
+			let target = top + contentHeight - (header?.height ?? 0)
 			if target >= columnHeight {
-				slices.append((top, columnHeight))
+				slices.append(PageSlice(top: top, bottom: columnHeight, header: header))
 				break
 			}
 			// The furthest break strictly inside (top, target]; force a hard break
 			// if a single line/block is taller than the page.
 			let candidate = sortedBreaks.last { $0 > top + 0.5 && $0 <= target + 0.5 }
 			let bottom = (candidate ?? target) > top ? (candidate ?? target) : target
-			slices.append((top, bottom))
+			slices.append(PageSlice(top: top, bottom: bottom, header: header))
 			top = bottom
 		}
-		return slices.isEmpty ? [(0, columnHeight)] : slices
+		return slices.isEmpty ? [PageSlice(top: 0, bottom: columnHeight)] : slices
+	}
+
+	/// The header to repeat on a page whose slice starts at column y `top`: that
+	/// of the outermost table whose body rows continue past `top`. Headers taller
+	/// than half a page are not repeated, so a continuation page always has room.
+	private static func repeatedHeader(continuingAt top: Double, in headers: [RepeatedTableHeader],
+	                                   contentHeight: Double) -> BlockBox? {
+		// Tables register after the tables nested in their cells, so search from the end.
+		headers.last { entry in
+			let header = entry.header
+			return top > header.y + header.height + 0.5
+				&& top < entry.table.y + entry.table.height - 0.5
+				&& header.height < contentHeight / 2
+		}?.header
 	}
 
 	/// Collect candidate page-break y-coordinates: line and block edges.
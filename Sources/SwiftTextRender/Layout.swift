@@ -6,33 +6,120 @@
 //  lines greedily using font metrics. Coordinates are CSS pixels with a
 //  y-down, top-left origin; the painter converts to PDF's y-up space.
 //
-//  Not yet modeled: margin collapsing, floats, absolute positioning, tables,
-//  flex/grid. These follow once the vertical slice is proven end to end.
+//  Adjacent sibling margins collapse, and `display: table` boxes lay out as an
+//  equal-width column grid with colspan and repeated `thead` rows. Not yet
+//  modeled: floats, absolute positioning, flex/grid.
 
 import Foundation
+import SwiftTextCore
 import SwiftTextCSS
 
 public final class LayoutEngine {
 	private let fonts: FontBook
-
-	public init(fonts: FontBook) {
+	private let budget: ResourceBudget
+	private let parallel: Bool
+	/// Guards `boxCount` and `tableHeaders`, which parallel layout
+	/// updates from several threads.
+	private let lock = NSLock()
+	private var boxCount = 0
+	private var tableHeaders: [RepeatedTableHeader] = []
+
+	/// Words already split into font runs, shaped and measured.
+	private let shapedRuns = ShapedRunCache()
+	/// Laid-out subtrees from earlier renders, when the caller opted in.
+	private let cache: LayoutCache?
+	/// Fingerprints of the tree being laid out, when `cache` is set.
+	private var fingerprints: SubtreeFingerprints?
+
+	/// Sibling runs shorter than this are laid out serially even in parallel mode.
+	private static let parallelSiblingThreshold = 8
+
+	/// - Parameters:
+	///   - budget: Meters laid-out block and line boxes (and the deadline)
+	///     against the caller's ``ResourceLimits``; `nil` lays out without bounds.
+	///     Task cancellation is honored either way.
+	///   - parallel: Lay out the children of blocks with many block children
+	///     (and the cells of wide row groups) concurrently.
+	///   - cache: Reuse the layout of block subtrees identical to ones laid out
+	///     earlier with this cache and `fonts`.
+	public init(fonts: FontBook, budget: ResourceBudget? = nil, parallel: Bool = false, cache: LayoutCache? = nil) {
 		self.fonts = fonts
+		self.budget = budget ?? ResourceBudget(.unlimited)
+		self.parallel = parallel
+		self.cache = cache
+	}
+
+	/// Tables laid out with a `thead`, for pagination to repeat the header rows
+	/// on each page the table continues onto. A table registers after any tables
+	/// nested in its cells.
+	var repeatedTableHeaders: [RepeatedTableHeader] {
+		lock.lock()
+		defer { lock.unlock() }
+		return tableHeaders
 	}
 
 	/// Lay out a root block in a column of the given content width starting at
 	/// `(originX, originY)`. Returns the total margin-box height consumed.
+	/// - Throws: A `ResourceLimitError` when the budget's box limit or deadline is hit,
+	///   or `CancellationError` when the calling task is cancelled mid-layout.
 	@discardableResult
-	public func layout(root: BlockBox, contentWidth: Double, originX: Double, originY: Double) -> Double {
+	public func layout(root: BlockBox, contentWidth: Double, originX: Double, originY: Double) throws -> Double {
 		let marginTop = root.style.margin.top.resolved(percentageBasis: contentWidth) ?? 0
 		let marginBottom = root.style.margin.bottom.resolved(percentageBasis: contentWidth) ?? 0
-		let height = layoutBlock(root, containingWidth: contentWidth, marginX: originX, borderBoxTop: originY + marginTop)
+		if cache != nil { fingerprints = SubtreeFingerprints(root: root) }
+		defer { fingerprints = nil }
+		let height = try layoutBlock(root, containingWidth: contentWidth, marginX: originX, borderBoxTop: originY + marginTop)
 		return marginTop + height + marginBottom
 	}
 
+	/// Count one laid-out box against the budget. Cancellation and the clock are
+	/// checked only every 256 boxes, which keeps them out of the per-line cost.
+	private func chargeBox() throws {
+		try chargeBoxes(1)
+	}
+
+	/// Count `count` boxes at once, as a cached subtree does.
+	private func chargeBoxes(_ count: Int) throws {
+		try budget.charge(.boxes, count)
+		lock.lock()
+		let due = (boxCount & 0xFF) + count > 0xFF
+		boxCount += count
+		lock.unlock()
+		if due { try budget.checkpoint() }
+	}
+
 	/// Lay out a block whose border box top is at `borderBoxTop`. The caller owns
 	/// this box's vertical margins (so adjacent siblings can collapse). Sets the
 	/// box's border-box geometry and returns its border-box height.
-	private func layoutBlock(_ box: BlockBox, containingWidth: Double, marginX: Double, borderBoxTop: Double) -> Double {
+	///
+	/// With a ``LayoutCache``, a subtree laid out identically before is placed
+	/// from the cache instead. Layout never depends on where the box sits, only
+	/// on its containing width, so the recorded geometry just translates.
+	private func layoutBlock(_ box: BlockBox, containingWidth: Double, marginX: Double, borderBoxTop: Double) throws -> Double {
+		guard let cache, let fingerprints, fingerprints.arena === box.arena,
+		      fingerprints.cacheable[box.slot] else {
+			return try layoutBlockContent(box, containingWidth: containingWidth, marginX: marginX, borderBoxTop: borderBoxTop)
+		}
+		let key = LayoutCache.Key(fingerprint: fingerprints.hashes[box.slot], boxCount: fingerprints.sizes[box.slot],
+		                          containingWidth: containingWidth, fontRevision: fonts.revision)
+		switch cache.lookup(key) {
+		case .hit(let snapshot) where snapshot.apply(to: box, originX: marginX, originY: borderBoxTop):
+			try chargeBoxes(snapshot.chargedBoxes)
+			return snapshot.height
+		case .hit:
+			cache.rejectHit()
+			return try layoutBlockContent(box, containingWidth: containingWidth, marginX: marginX, borderBoxTop: borderBoxTop)
+		case .miss(let store):
+			let height = try layoutBlockContent(box, containingWidth: containingWidth, marginX: marginX, borderBoxTop: borderBoxTop)
+			if store, let snapshot = LayoutSnapshot(capturing: box, originX: marginX, originY: borderBoxTop, height: height) {
+				cache.store(snapshot, for: key)
+			}
+			return height
+		}
+	}
+
+	private func layoutBlockContent(_ box: BlockBox, containingWidth: Double, marginX: Double, borderBoxTop: Double) throws -> Double {
+		try chargeBox()
 		let style = box.style
 		let basis = containingWidth
 
@@ -78,9 +165,11 @@ public final class LayoutEngine {
 
 		var contentHeight: Double
 		if box.style.display == .table {
-			contentHeight = layoutTable(box, contentWidth: contentWidth, contentX: contentX, contentTop: contentTop)
+			contentHeight = try layoutTable(box, contentWidth: contentWidth, contentX: contentX, contentTop: contentTop)
 		} else if box.establishesInlineContext {
-			contentHeight = layoutInline(box, contentWidth: contentWidth, contentX: contentX, contentTop: contentTop)
+			contentHeight = try layoutInline(box, contentWidth: contentWidth, contentX: contentX, contentTop: contentTop)
+		} else if parallel, box.children.count >= Self.parallelSiblingThreshold {
+			contentHeight = try layoutChildrenConcurrently(box, contentWidth: contentWidth, contentX: contentX, contentTop: contentTop)
 		} else {
 			// Stack block children, collapsing adjacent sibling vertical margins.
 			var cursorY = contentTop
@@ -91,7 +180,7 @@ public final class LayoutEngine {
 				let childMarginTop = childBlock.style.margin.top.resolved(percentageBasis: contentWidth) ?? 0
 				let childMarginBottom = childBlock.style.margin.bottom.resolved(percentageBasis: contentWidth) ?? 0
 				cursorY += started ? max(previousMarginBottom, childMarginTop) : childMarginTop
-				cursorY += layoutBlock(childBlock, containingWidth: contentWidth, marginX: contentX, borderBoxTop: cursorY)
+				cursorY += try layoutBlock(childBlock, containingWidth: contentWidth, marginX: contentX, borderBoxTop: cursorY)
 				previousMarginBottom = childMarginBottom
 				started = true
 			}
@@ -107,7 +196,7 @@ public final class LayoutEngine {
 			let markerX = box.style.direction == .rtl
 				? contentX + contentWidth + gap        // right of the content box
 				: contentX - markerWidth - gap          // left of the content box
-			let fragment = TextFragment(text: marker, style: box.style,
+			let fragment = TextFragment(text: marker, arena: box.arena, styleIndex: box.styleIndex,
 			                            x: markerX, y: line.y,
 			                            width: markerWidth, baseline: line.y + line.baseline)
 			line.fragments.insert(fragment, at: 0)
@@ -123,6 +212,58 @@ public final class LayoutEngine {
 		return box.height
 	}
 
+	/// Parallel mode's block stacking. A child's layout depends on its containing
+	/// width, never on its y, so every child is laid out concurrently with its
+	/// border box at y = 0; a serial pass then collapses the sibling margins and
+	/// translates each child into place with `shiftBoxContent`.
+	private func layoutChildrenConcurrently(_ box: BlockBox, contentWidth: Double, contentX: Double, contentTop: Double) throws -> Double {
+		let blocks = box.children.compactMap { $0 as? BlockBox }
+		let heights = try concurrentMap(blocks) { child in
+			try self.layoutBlock(child, containingWidth: contentWidth, marginX: contentX, borderBoxTop: 0)
+		}
+
+		var cursorY = contentTop
+		var previousMarginBottom = 0.0
+		for (index, child) in blocks.enumerated() {
+			let childMarginTop = child.style.margin.top.resolved(percentageBasis: contentWidth) ?? 0
+			let childMarginBottom = child.style.margin.bottom.resolved(percentageBasis: contentWidth) ?? 0
+			cursorY += index > 0 ? max(previousMarginBottom, childMarginTop) : childMarginTop
+			child.y += cursorY
+			shiftBoxContent(child, by: cursorY)
+			cursorY += heights[index]
+			previousMarginBottom = childMarginBottom
+		}
+		return (cursorY - contentTop) + previousMarginBottom
+	}
+
+	/// `transform` applied to every element on all cores, in order. The first
+	/// error stops the remaining work and is rethrown. Worker threads run outside
+	/// the calling task, so its cancellation is checked here first.
+	private func concurrentMap<T, R>(_ items: [T], _ transform: (T) throws -> R) throws -> [R] {
+		try budget.checkpoint()
+		var results = [R?](repeating: nil, count: items.count)
+		var firstError: Error?
+		let resultLock = NSLock()
+		DispatchQueue.concurrentPerform(iterations: items.count) { index in
+			resultLock.lock()
+			let failed = firstError != nil
+			resultLock.unlock()
+			guard !failed else { return }
+			do {
+				let result = try transform(items[index])
+				resultLock.lock()
+				results[index] = result
+				resultLock.unlock()
+			} catch {
+				resultLock.lock()
+				if firstError == nil { firstError = error }
+				resultLock.unlock()
+			}
+		}
+		if let firstError { throw firstError }
+		return results.map { $0! }
+	}
+
 	/// The first line box found in a subtree, if any.
 	private func firstLineBox(in box: Box) -> LineBox? {
 		guard let block = box as? BlockBox else { return nil }
@@ -143,90 +284,184 @@ public final class LayoutEngine {
 		let rowspan: Int
 	}
 
+	private struct TableRow {
+		let box: BlockBox
+		let cells: [BlockBox]
+		/// The nearest `thead`/`tbody`/`tfoot` box holding the row, if any.
+		let group: BlockBox?
+	}
+
+	/// Equal-width column geometry for one table.
+	private struct TableColumns {
+		let contentX: Double
+		let width: Double
+		let spacing: Double
+
+		func x(_ column: Int) -> Double { contentX + spacing + Double(column) * (width + spacing) }
+		func spanWidth(_ colspan: Int) -> Double { Double(colspan) * width + Double(colspan - 1) * spacing }
+	}
+
 	/// Lay out a `display: table` box as an equal-column grid, honoring colspan
 	/// and rowspan. Content-based column sizing is not modeled (columns are
-	/// equal width).
-	private func layoutTable(_ table: BlockBox, contentWidth: Double, contentX: Double, contentTop: Double) -> Double {
+	/// equal width), so the column count — found by a structure-only pass — is
+	/// all the width computation needs.
+	///
+	/// Rows are then laid out a row group at a time: a run of rows that no
+	/// rowspan crosses, usually a single row. Occupancy and row heights are
+	/// tracked for the current group only, so a long table costs memory for its
+	/// boxes and nothing more. Each cell is laid out once, at its group's top, and
+	/// translated down to its row afterwards.
+	private func layoutTable(_ table: BlockBox, contentWidth: Double, contentX: Double, contentTop: Double) throws -> Double {
 		let rows = collectTableRows(table)
 		guard !rows.isEmpty else { return 0 }
 		let spacing = 2.0 // border-spacing (UA default)
 
-		// Place cells into a grid, marking spanned slots as occupied.
+		let columnCount = tableColumnCount(rows)
+		guard columnCount > 0 else { return 0 }
+		let columns = TableColumns(
+			contentX: contentX,
+			width: max(0, (contentWidth - Double(columnCount + 1) * spacing) / Double(columnCount)),
+			spacing: spacing)
+
+		// Per column, how many more rows (counting the current one) a rowspan
+		// from this or an earlier row covers. All zeros closes a row group.
+		var spanning = [Int](repeating: 0, count: columnCount)
 		var placements: [CellPlacement] = []
-		var occupied = Set<Int>()
-		func slot(_ row: Int, _ column: Int) -> Int { row * 4096 + column }
+		var groupStart = 0
+		var y = contentTop + spacing
 		for (rowIndex, row) in rows.enumerated() {
 			var column = 0
 			for cell in row.cells {
-				while occupied.contains(slot(rowIndex, column)) { column += 1 }
+				while column < columnCount, spanning[column] > 0 { column += 1 }
 				let colspan = spanAttribute(cell, "colspan")
-				let rowspan = spanAttribute(cell, "rowspan")
+				let rowspan = min(spanAttribute(cell, "rowspan"), rows.count - rowIndex)
 				placements.append(CellPlacement(cell: cell, row: rowIndex, column: column, colspan: colspan, rowspan: rowspan))
-				for r in rowIndex ..< rowIndex + rowspan {
-					for c in column ..< column + colspan { occupied.insert(slot(r, c)) }
-				}
+				for c in column ..< column + colspan { spanning[c] = rowspan }
 				column += colspan
 			}
+			for c in spanning.indices where spanning[c] > 0 { spanning[c] -= 1 }
+			if rowIndex == rows.count - 1 || !spanning.contains(where: { $0 > 0 }) {
+				y = try layoutRowGroup(rows[groupStart ... rowIndex], firstRow: groupStart, placements: placements,
+				                       top: y, columns: columns, contentWidth: contentWidth)
+				placements.removeAll(keepingCapacity: true)
+				groupStart = rowIndex + 1
+			}
 		}
 
-		let columnCount = placements.map { $0.column + $0.colspan }.max() ?? 0
-		guard columnCount > 0 else { return 0 }
-		let columnWidth = max(0, (contentWidth - Double(columnCount + 1) * spacing) / Double(columnCount))
-		func columnX(_ column: Int) -> Double { contentX + spacing + Double(column) * (columnWidth + spacing) }
-		func spanWidth(_ colspan: Int) -> Double { Double(colspan) * columnWidth + Double(colspan - 1) * spacing }
-
-		// Pass 1: measure each cell's height at its column width.
-		var measured: [ObjectIdentifier: Double] = [:]
-		for placement in placements {
-			let height = layoutBlock(placement.cell, containingWidth: spanWidth(placement.colspan),
-			                         marginX: columnX(placement.column), borderBoxTop: contentTop)
-			measured[ObjectIdentifier(placement.cell)] = height
+		placeRowGroupBoxes(rows, contentX: contentX, contentWidth: contentWidth)
+		if let header = rows.first?.group, header.style.display == .tableHeaderGroup,
+		   rows.contains(where: { $0.group !== header }) {
+			lock.lock()
+			tableHeaders.append(RepeatedTableHeader(table: table, header: header))
+			lock.unlock()
 		}
+		return y - contentTop
+	}
 
-		// Row heights come from cells confined to a single row.
+	/// Lay out the rows of one row group, whose cells are `placements`, from
+	/// column y `top`. Returns the y below the group's last row and its spacing.
+	private func layoutRowGroup(_ rows: ArraySlice<TableRow>, firstRow: Int, placements: [CellPlacement], top: Double,
+	                            columns: TableColumns, contentWidth: Double) throws -> Double {
+		// Lay each cell out once, at the group's top; row heights come from cells
+		// confined to a single row.
+		func layoutCell(_ placement: CellPlacement) throws -> Double {
+			try layoutBlock(placement.cell, containingWidth: columns.spanWidth(placement.colspan),
+			                marginX: columns.x(placement.column), borderBoxTop: top)
+		}
+		let heights = parallel && placements.count >= Self.parallelSiblingThreshold
+			? try concurrentMap(placements, layoutCell)
+			: try placements.map(layoutCell)
 		var rowHeights = [Double](repeating: 0, count: rows.count)
-		for placement in placements where placement.rowspan == 1 {
-			rowHeights[placement.row] = max(rowHeights[placement.row], measured[ObjectIdentifier(placement.cell)] ?? 0)
+		for (placement, height) in zip(placements, heights) where placement.rowspan == 1 {
+			rowHeights[placement.row - firstRow] = max(rowHeights[placement.row - firstRow], height)
 		}
 		var rowTops = [Double](repeating: 0, count: rows.count)
-		var y = contentTop + spacing
-		for index in rows.indices {
+		var y = top
+		for index in rowHeights.indices {
 			rowTops[index] = y
-			y += rowHeights[index] + spacing
+			y += rowHeights[index] + columns.spacing
 		}
 
-		// Pass 2: re-lay out each cell at its final position, stretch to its row(s),
-		// and apply vertical-align by shifting the cell's content.
+		// Move each cell to its row (a no-op for the group's first row), stretch
+		// it to its row(s), and apply vertical-align by shifting its content.
 		for placement in placements {
-			_ = layoutBlock(placement.cell, containingWidth: spanWidth(placement.colspan),
-			                marginX: columnX(placement.column), borderBoxTop: rowTops[placement.row])
-			let naturalHeight = placement.cell.height
-			let lastRow = min(placement.row + placement.rowspan - 1, rows.count - 1)
+			let cell = placement.cell
+			let first = placement.row - firstRow
+			let dy = rowTops[first] - top
+			if dy != 0 {
+				cell.y += dy
+				shiftBoxContent(cell, by: dy)
+			}
+			let naturalHeight = cell.height
+			let last = first + placement.rowspan - 1
 			var stretched = 0.0
-			for r in placement.row ... lastRow { stretched += rowHeights[r] }
-			stretched += Double(lastRow - placement.row) * spacing
+			for r in first ... last { stretched += rowHeights[r] }
+			stretched += Double(last - first) * columns.spacing
 			stretched = max(stretched, naturalHeight)
-			placement.cell.height = stretched
+			cell.height = stretched
 
 			let extra = stretched - naturalHeight
 			if extra > 0.5 {
 				let factor: Double
-				switch placement.cell.style.verticalAlign {
+				switch cell.style.verticalAlign {
 				case .middle: factor = 0.5
 				case .bottom, .textBottom: factor = 1.0
 				default: factor = 0 // top / baseline
 				}
-				if factor > 0 { shiftBoxContent(placement.cell, by: extra * factor) }
+				if factor > 0 { shiftBoxContent(cell, by: extra * factor) }
 			}
 		}
 
-		for (rowIndex, row) in rows.enumerated() {
-			row.box.x = contentX
-			row.box.y = rowTops[rowIndex]
+		for (index, row) in rows.enumerated() {
+			row.box.x = columns.contentX
+			row.box.y = rowTops[index]
 			row.box.width = contentWidth
-			row.box.height = rowHeights[rowIndex]
+			row.box.height = rowHeights[index]
+		}
+		return y
+	}
+
+	/// The number of grid columns, from the same slot assignment layout uses but
+	/// without laying anything out.
+	private func tableColumnCount(_ rows: [TableRow]) -> Int {
+		var spanning: [Int] = []
+		var count = 0
+		for (rowIndex, row) in rows.enumerated() {
+			var column = 0
+			for cell in row.cells {
+				while column < spanning.count, spanning[column] > 0 { column += 1 }
+				let colspan = spanAttribute(cell, "colspan")
+				let rowspan = min(spanAttribute(cell, "rowspan"), rows.count - rowIndex)
+				if spanning.count < column + colspan {
+					spanning.append(contentsOf: repeatElement(0, count: column + colspan - spanning.count))
+				}
+				for c in column ..< column + colspan { spanning[c] = rowspan }
+				column += colspan
+			}
+			count = max(count, column)
+			for c in spanning.indices where spanning[c] > 0 { spanning[c] -= 1 }
+		}
+		return count
+	}
+
+	/// Give `thead`/`tbody`/`tfoot` boxes the extent of their rows, so painting
+	/// and pagination see them where their rows are.
+	private func placeRowGroupBoxes(_ rows: [TableRow], contentX: Double, contentWidth: Double) {
+		var index = 0
+		while index < rows.count {
+			guard let group = rows[index].group else { index += 1; continue }
+			let top = rows[index].box.y
+			var bottom = top + rows[index].box.height
+			index += 1
+			while index < rows.count, rows[index].group === group {
+				bottom = rows[index].box.y + rows[index].box.height
+				index += 1
+			}
+			group.x = contentX
+			group.y = top
+			group.width = contentWidth
+			group.height = bottom - top
 		}
-		return y - contentTop
 	}
 
 	/// Shift a box's laid-out content (lines and child boxes) down by `dy`.
@@ -247,16 +482,18 @@ public final class LayoutEngine {
 		}
 	}
 
+	/// A `colspan`/`rowspan` value, clamped to HTML's limits (1000 and 65534) so
+	/// a hostile attribute can't size the grid.
 	private func spanAttribute(_ cell: BlockBox, _ name: String) -> Int {
 		guard let value = cell.element?.attributeValue(name),
 		      let number = Int(value.trimmingCharacters(in: .whitespaces)) else { return 1 }
-		return max(1, number)
+		return min(max(1, number), name == "colspan" ? 1000 : 65534)
 	}
 
 	/// Collect table rows (and their cells), descending through row groups.
-	private func collectTableRows(_ table: BlockBox) -> [(box: BlockBox, cells: [BlockBox])] {
-		var rows: [(box: BlockBox, cells: [BlockBox])] = []
-		func walk(_ box: BlockBox) {
+	private func collectTableRows(_ table: BlockBox) -> [TableRow] {
+		var rows: [TableRow] = []
+		func walk(_ box: BlockBox, group: BlockBox?) {
 			for child in box.children {
 				guard let block = child as? BlockBox else { continue }
 				switch block.style.display {
@@ -265,53 +502,128 @@ public final class LayoutEngine {
 						guard let cell = child as? BlockBox, cell.style.display == .tableCell else { return nil }
 						return cell
 					}
-					rows.append((block, cells))
+					rows.append(TableRow(box: block, cells: cells, group: group))
 				case .tableRowGroup, .tableHeaderGroup, .tableFooterGroup:
-					walk(block)
+					walk(block, group: block)
 				default:
-					walk(block)
+					walk(block, group: group)
 				}
 			}
 		}
-		walk(table)
+		walk(table, group: nil)
 		return rows
 	}
 
 	// MARK: - Inline layout
 
+	/// A text box (or `<br>`) in an inline formatting context. Tokens refer to it
+	/// by index, so words are ranges into its text and share its style.
+	private struct InlineSource {
+		let text: String
+		let style: ComputedStyle
+		/// `style`'s index in the tree's ``BoxArena``, for the fragments.
+		let styleIndex: Int
+		let href: String?
+	}
+
 	private enum InlineToken {
-		case word(String, ComputedStyle, href: String?)
-		case space(ComputedStyle)
-		case forcedBreak(ComputedStyle)
+		/// A word, as a range of `sources[source].text`.
+		case word(source: Int, range: Range<String.Index>)
+		case space(source: Int)
+		case forcedBreak(source: Int)
 	}
 
-	/// Lay out the inline content of `box` into lines. Returns the content height.
-	private func layoutInline(_ box: BlockBox, contentWidth: Double, contentX: Double, contentTop: Double) -> Double {
+	private struct InlineContent {
+		var sources: [InlineSource] = []
 		var tokens: [InlineToken] = []
+
+		/// Splits `text` into word, space and break tokens on its UTF-8 bytes. All
+		/// whitespace is ASCII, so any other byte — including every byte of a
+		/// multi-byte scalar — just extends the current word, and whitespace
+		/// collapses in the same pass.
+		mutating func appendText(_ box: TextBox, href: String?) {
+			let text = box.text
+			let style = box.style
+			let source = sources.count
+			sources.append(InlineSource(text: text, style: style, styleIndex: box.styleIndex, href: href))
+			let preserveSpaces = style.whiteSpace == .pre
+			let collapses = style.whiteSpace.collapsesWhitespace
+			let utf8 = text.utf8
+			var wordStart: String.Index?
+			var previousWasSpace = false
+			var index = utf8.startIndex
+			while index != utf8.endIndex {
+				let byte = utf8[index]
+				let isSpace = byte == UInt8(ascii: " ") || byte == UInt8(ascii: "\t")
+				let isNewline = byte == UInt8(ascii: "\n")
+				if !(isSpace || isNewline || byte == UInt8(ascii: "\r")) || (isSpace && preserveSpaces) {
+					if wordStart == nil { wordStart = index }
+					previousWasSpace = false
+				} else {
+					if let start = wordStart {
+						tokens.append(.word(source: source, range: start ..< index))
+						wordStart = nil
+					}
+					if collapses {
+						if !previousWasSpace { tokens.append(.space(source: source)) }
+						previousWasSpace = true
+					} else if isNewline {
+						// Preserved newline (white-space: pre/pre-wrap/pre-line).
+						tokens.append(.forcedBreak(source: source))
+					} else if isSpace {
+						tokens.append(.space(source: source))
+					}
+					// A preserved carriage return is dropped.
+				}
+				utf8.formIndex(after: &index)
+			}
+			if let start = wordStart {
+				tokens.append(.word(source: source, range: start ..< utf8.endIndex))
+			}
+		}
+
+		mutating func appendBreak(_ box: InlineBox, href: String?) {
+			tokens.append(.forcedBreak(source: sources.count))
+			sources.append(InlineSource(text: "", style: box.style, styleIndex: box.styleIndex, href: href))
+		}
+	}
+
+	/// Lay out the inline content of `box` into lines. Returns the content height.
+	private func layoutInline(_ box: BlockBox, contentWidth: Double, contentX: Double, contentTop: Double) throws -> Double {
+		var content = InlineContent()
 		for child in box.children {
-			collectInline(child, into: &tokens, href: nil)
+			collectInline(child, into: &content, href: nil)
 		}
+		let sources = content.sources
+		let tokens = content.tokens
 
 		// Resolve bidi levels over the whole inline content (per paragraph) so each
-		// line can be reordered into visual order. Pure-LTR content skips this.
-		var bidiScalars: [Unicode.Scalar] = []
-		var tokenScalarStart: [Int] = []
-		for token in tokens {
-			tokenScalarStart.append(bidiScalars.count)
-			switch token {
-			case .word(let word, _, _): bidiScalars.append(contentsOf: word.unicodeScalars)
-			case .space: bidiScalars.append(" ")
-			case .forcedBreak: bidiScalars.append("\n")
+		// line can be reordered into visual order. An LTR paragraph without RTL or
+		// Arabic-number characters is level 0 throughout, so a byte scan of its
+		// text skips resolution; otherwise levels resolve per class run.
+		let baseDirection: BidiDirection = box.style.direction == .rtl ? .rightToLeft : .leftToRight
+		var tokenRun: [Int] = []
+		var runLevels: [UInt8] = []
+		let needsBidi = baseDirection == .rightToLeft || sources.contains { Bidi.mayContainRightToLeft($0.text) }
+		if needsBidi {
+			var runs = BidiRuns()
+			tokenRun.reserveCapacity(tokens.count)
+			for token in tokens {
+				switch token {
+				case .word(let source, let range): tokenRun.append(runs.append(sources[source].text[range].unicodeScalars))
+				case .space: tokenRun.append(runs.append(CollectionOfOne<Unicode.Scalar>(" ")))
+				case .forcedBreak: tokenRun.append(runs.append(CollectionOfOne<Unicode.Scalar>("\n")))
+				}
 			}
+			runLevels = runs.levels(baseLevel: baseDirection.baseLevel)
 		}
-		let baseDirection: BidiDirection = box.style.direction == .rtl ? .rightToLeft : .leftToRight
-		let bidiLevels = Bidi.levels(for: bidiScalars, baseDirection: baseDirection)
-		let hasRTL = baseDirection == .rightToLeft || bidiLevels.contains { $0 % 2 == 1 }
+		let hasRTL = baseDirection == .rightToLeft || runLevels.contains { $0 % 2 == 1 }
 		func wordLevel(_ tokenIndex: Int) -> UInt8 {
-			guard !bidiLevels.isEmpty else { return baseDirection.baseLevel }
-			return bidiLevels[min(tokenScalarStart[tokenIndex], bidiLevels.count - 1)]
+			guard !runLevels.isEmpty else { return baseDirection.baseLevel }
+			return runLevels[tokenRun[tokenIndex]]
 		}
 
+		let fontKeys = sources.map { fonts.font(for: $0.style).key }
 		var lines: [LineBox] = []
 		var fragments: [TextFragment] = []
 		var penX = box.style.textIndent // first line indentation (reset to 0 after)
@@ -333,6 +645,7 @@ public final class LayoutEngine {
 				var fragment = logical[index]
 				if levels[index] % 2 == 1 {
 					fragment.text = String(String.UnicodeScalarView(fragment.text.unicodeScalars.reversed()))
+					fragment.glyphs?.reverse()
 				}
 				ordered.append(fragment)
 			}
@@ -367,8 +680,9 @@ public final class LayoutEngine {
 			}
 		}
 
-		func finishLine(isLast: Bool) {
+		func finishLine(isLast: Bool) throws {
 			guard !fragments.isEmpty else { pendingSpace = nil; return }
+			try chargeBox()
 			let lineHeight = fragments.map { $0.style.resolvedLineHeight() }.max() ?? 0
 			let ascent = fragments.map { fonts.font(for: $0.style).ascent(size: $0.style.fontSize) }.max() ?? 0
 			let descent = fragments.map { fonts.font(for: $0.style).descent(size: $0.style.fontSize) }.max() ?? 0
@@ -414,14 +728,15 @@ public final class LayoutEngine {
 
 		for (tokenIndex, token) in tokens.enumerated() {
 			switch token {
-			case .space(let style):
-				if !fragments.isEmpty { pendingSpace = style }
-			case .forcedBreak(let style):
+			case .space(let source):
+				if !fragments.isEmpty { pendingSpace = sources[source].style }
+			case .forcedBreak(let source):
 				if !fragments.isEmpty {
-					finishLine(isLast: false)
+					try finishLine(isLast: false)
 				} else {
 					// A break with nothing on the line still consumes a line's height.
-					let height = style.resolvedLineHeight()
+					try chargeBox()
+					let height = sources[source].style.resolvedLineHeight()
 					let blank = LineBox()
 					blank.x = contentX
 					blank.y = lineTop
@@ -431,26 +746,12 @@ public final class LayoutEngine {
 					lineTop += height
 				}
 				pendingSpace = nil
-			case .word(let rawWord, let style, let href):
-				// Split the word into runs that share one font (font fallback), then
-				// shape each Arabic run into presentation forms. Shaping stays in
-				// logical order (one glyph per scalar) so the later bidi pass can
-				// reverse the run for visual order; only embedded fonts carry the
-				// presentation-form glyphs.
-				struct Piece { let text: String; let font: Font; let width: Double }
-				var pieces: [Piece] = []
+			case .word(let source, let range):
+				let style = sources[source].style
+				let href = sources[source].href
+				let pieces = shape(sources[source].text[range], style: style, fontKey: fontKeys[source])
 				var wordWidth = 0.0
-				for run in fonts.resolveRuns(rawWord, style: style) {
-					var text = run.text
-					if case .embedded(let embedded) = run.font, ArabicShaper.needsShaping(text) {
-						text = ArabicShaper.shape(text, hasForm: { embedded.hasGlyph(for: $0) })
-					}
-					// letter-spacing adds after every character of the run.
-					let width = run.font.width(of: text, size: style.fontSize)
-						+ style.letterSpacing * Double(text.unicodeScalars.count)
-					pieces.append(Piece(text: text, font: run.font, width: width))
-					wordWidth += width
-				}
+				for piece in pieces { wordWidth += piece.width }
 				func gap(_ spaceStyle: ComputedStyle) -> Double {
 					// word-spacing adds to each inter-word space.
 					fonts.font(for: spaceStyle).width(of: " ", size: spaceStyle.fontSize) + spaceStyle.wordSpacing
@@ -459,7 +760,7 @@ public final class LayoutEngine {
 
 				let wraps = style.whiteSpace.wraps
 				if wraps && !fragments.isEmpty && penX + spaceWidth + wordWidth > contentWidth {
-					finishLine(isLast: false)
+					try finishLine(isLast: false)
 				} else if !fragments.isEmpty, let space = pendingSpace {
 					penX += gap(space)
 					pendingSpace = nil
@@ -469,60 +770,57 @@ public final class LayoutEngine {
 				// reorder treats the word's runs as a unit.
 				let level = wordLevel(tokenIndex)
 				for piece in pieces {
-					let fragment = TextFragment(text: piece.text, style: style, x: penX, y: 0,
-					                            width: piece.width, baseline: 0, href: href,
+					var fragment = TextFragment(text: piece.text, arena: box.arena, styleIndex: sources[source].styleIndex,
+					                            x: penX, y: 0, width: piece.width, baseline: 0, href: href,
 					                            bidiLevel: level, font: piece.font)
+					fragment.glyphs = piece.glyphs
 					fragments.append(fragment)
 					penX += piece.width
 				}
 			}
 		}
-		finishLine(isLast: true)
+		try finishLine(isLast: true)
 
 		box.lines = lines
 		return lineTop - contentTop
 	}
 
-	private func collectInline(_ box: Box, into tokens: inout [InlineToken], href: String?) {
-		if let text = box as? TextBox {
-			let style = text.style
-			if style.whiteSpace == .pre {
-				// Preserve spaces verbatim; only newlines break the line. (pre does
-				// not wrap, so each segment between newlines is one fragment.)
-				var segment = ""
-				for character in text.text {
-					if character == "\n" {
-						if !segment.isEmpty { tokens.append(.word(segment, style, href: href)); segment = "" }
-						tokens.append(.forcedBreak(style))
-					} else if character != "\r" {
-						segment.append(character)
+	/// Split a word into runs that share one font (font fallback), then shape
+	/// each Arabic run into presentation forms and measure it. Shaping stays in
+	/// logical order (one glyph per scalar) so the later bidi pass can reverse
+	/// the run for visual order; only embedded fonts carry the presentation-form
+	/// glyphs. Results are cached per word and primary font.
+	private func shape(_ word: Substring, style: ComputedStyle, fontKey: String) -> [ShapedRun] {
+		let key = ShapedRunCache.Key(word: word, font: fontKey, bold: style.fontWeight >= 600,
+		                             italic: style.fontStyle != .normal, size: style.fontSize,
+		                             letterSpacing: style.letterSpacing)
+		return shapedRuns.runs(for: key) {
+			fonts.resolveRuns(word, style: style).map { run in
+				var text = run.text
+				var glyphs: [Int]?
+				if case .embedded(let embedded) = run.font {
+					if ArabicShaper.needsShaping(text) {
+						text = ArabicShaper.shape(text, hasForm: { embedded.hasGlyph(for: $0) })
 					}
+					glyphs = text.unicodeScalars.map { embedded.glyphID(for: $0) }
 				}
-				if !segment.isEmpty { tokens.append(.word(segment, style, href: href)) }
-				return
-			}
-			let content = style.whiteSpace.collapsesWhitespace ? collapseWhitespace(text.text) : text.text
-			var word = ""
-			func flushWord() {
-				if !word.isEmpty { tokens.append(.word(word, style, href: href)); word = "" }
-			}
-			for character in content {
-				if character == "\n" && !style.whiteSpace.collapsesWhitespace {
-					// Preserved newline (white-space: pre/pre-wrap/pre-line).
-					flushWord()
-					tokens.append(.forcedBreak(style))
-				} else if character == " " || character == "\t" || character == "\n" {
-					flushWord()
-					tokens.append(.space(style))
-				} else {
-					word.append(character)
-				}
+				// letter-spacing adds after every character of the run.
+				let width = run.font.width(of: text, size: style.fontSize)
+					+ style.letterSpacing * Double(text.unicodeScalars.count)
+				return ShapedRun(text: text, font: run.font, width: width, glyphs: glyphs)
 			}
-			flushWord()
-		} else if let inline = box as? InlineBox {
+		}
+	}
+
+	private func collectInline(_ box: Box, into content: inout InlineContent, href: String?) {
+		switch box.kind {
+		case .text:
+			content.appendText(unsafeDowncast(box, to: TextBox.self), href: href)
+		case .inline:
+			let inline = unsafeDowncast(box, to: InlineBox.self)
 			// A <br> forces a line break.
 			if inline.element?.localName == "br" {
-				tokens.append(.forcedBreak(inline.style))
+				content.appendBreak(inline, href: href)
 				return
 			}
 			// An <a href> establishes a link for its descendant text.
@@ -532,23 +830,17 @@ public final class LayoutEngine {
 			} else {
 				childHref = href
 			}
-			for child in inline.children { collectInline(child, into: &tokens, href: childHref) }
+			for child in inline.children { collectInline(child, into: &content, href: childHref) }
+		case .block:
+			break
 		}
 	}
+}
 
-	private func collapseWhitespace(_ text: String) -> String {
-		var result = ""
-		var previousWasSpace = false
-		for character in text {
-			let isSpace = character == " " || character == "\t" || character == "\n" || character == "\r"
-			if isSpace {
-				if !previousWasSpace { result.append(" ") }
-				previousWasSpace = true
-			} else {
-				result.append(character)
-				previousWasSpace = false
-			}
-		}
-		return result
-	}
+/// A table whose header row group is repeated at the top of each page its body
+/// continues onto.
+struct RepeatedTableHeader {
+	let table: BlockBox
+	/// The `thead` box, at its in-flow position above the first body row.
+	let header: BlockBox
 }
@@ -0,0 +1,364 @@
+//  LayoutCache.swift
+//  SwiftTextRender
+//
+//  Opt-in memoization of block subtree layout across renders. A templated
+//  document rendered many times over repeats the same boilerplate sections;
+//  a block whose content, styles and available width match an earlier layout
+//  takes that layout's geometry, line boxes and fragments, translated into
+//  place, instead of being laid out again.
+
+import Foundation
+
+/// A size-bounded store of laid-out block subtrees, shared across renders.
+///
+/// Pass one cache to every render (``RenderOptions/layoutCache``, or
+/// ``LayoutEngine/init(fonts:budget:parallel:cache:)``) along with the same
+/// ``FontBook``. Entries are keyed by a structural fingerprint of the subtree —
+/// box kinds, text, computed styles, link targets, markers and image sizes —
+/// plus the containing width and the font book's current registrations, so a
+/// hit reproduces exactly what layout would have computed.
+///
+/// A subtree is stored the second time it misses: a section whose content
+/// changes on every render (and each ancestor of one) is never seen twice, so
+/// it never displaces the boilerplate that is. When the stored size passes
+/// ``capacity`` the least recently used entries are evicted.
+public final class LayoutCache: @unchecked Sendable {
+	/// Hit and miss counts, and what the cache currently holds.
+	public struct Statistics: Equatable, Sendable {
+		/// Subtrees whose layout was reused.
+		public var hits = 0
+		/// Subtrees laid out because no entry matched.
+		public var misses = 0
+		/// Entries dropped to stay within ``LayoutCache/capacity``.
+		public var evictions = 0
+		/// Entries currently stored.
+		public var entries = 0
+		/// The stored size, in blocks, lines and fragments.
+		public var storedSize = 0
+	}
+
+	struct Key: Hashable {
+		let fingerprint: Int
+		let boxCount: Int
+		let containingWidth: Double
+		let fontRevision: UUID
+	}
+
+	enum Lookup {
+		case hit(LayoutSnapshot)
+		/// `store` says whether the caller should capture the subtree's layout.
+		case miss(store: Bool)
+	}
+
+	private struct Entry {
+		let snapshot: LayoutSnapshot
+		var lastUse: UInt64
+	}
+
+	/// The most blocks, lines and fragments held across all entries.
+	public let capacity: Int
+	private var entries: [Key: Entry] = [:]
+	/// Keys that have missed once; a second miss admits the subtree.
+	private var seen: Set<Key> = []
+	private var clock: UInt64 = 0
+	private var counts = Statistics()
+	private let lock = NSLock()
+
+	public init(capacity: Int = 200_000) {
+		self.capacity = max(1, capacity)
+	}
+
+	public var statistics: Statistics {
+		lock.lock()
+		defer { lock.unlock() }
+		return counts
+	}
+
+	/// Drop every entry. Statistics other than the stored size are kept.
+	public func removeAll() {
+		lock.lock()
+		entries.removeAll()
+		seen.removeAll()
+		counts.entries = 0
+		counts.storedSize = 0
+		lock.unlock()
+	}
+
+	func lookup(_ key: Key) -> Lookup {
+		lock.lock()
+		defer { lock.unlock() }
+		clock += 1
+		if var entry = entries[key] {
+			entry.lastUse = clock
+			entries[key] = entry
+			counts.hits += 1
+			return .hit(entry.snapshot)
+		}
+		counts.misses += 1
+		if seen.remove(key) != nil { return .miss(store: true) }
+		if seen.count >= capacity { seen.removeAll(keepingCapacity: true) }
+		seen.insert(key)
+		return .miss(store: false)
+	}
+
+	/// Count a hit whose snapshot didn't fit the subtree (a key collision) as a miss.
+	func rejectHit() {
+		lock.lock()
+		counts.hits -= 1
+		counts.misses += 1
+		lock.unlock()
+	}
+
+	func store(_ snapshot: LayoutSnapshot, for key: Key) {
+		guard snapshot.size <= capacity / 2 else { return }
+		lock.lock()
+		defer { lock.unlock() }
+		clock += 1
+		if let previous = entries.updateValue(Entry(snapshot: snapshot, lastUse: clock), forKey: key) {
+			counts.storedSize -= previous.snapshot.size
+		} else {
+			counts.entries += 1
+		}
+		counts.storedSize += snapshot.size
+		if counts.storedSize > capacity { evict() }
+	}
+
+	/// Evict least recently used entries down to three quarters of capacity, so
+	/// the sort is paid once per many stores rather than on each.
+	private func evict() {
+		let target = capacity - capacity / 4
+		for (key, entry) in entries.sorted(by: { $0.value.lastUse < $1.value.lastUse }) {
+			guard counts.storedSize > target else { break }
+			entries[key] = nil
+			counts.storedSize -= entry.snapshot.size
+			counts.entries -= 1
+			counts.evictions += 1
+		}
+	}
+}
+
+/// The laid-out state of one block subtree, relative to its margin-box origin.
+///
+/// Blocks are recorded in pre-order. A fragment's style is recorded as the
+/// pre-order position of a box in the subtree that has it, since style indices
+/// belong to one tree's ``BoxArena``.
+///
+/// The cache key is a 64-bit hash, so the snapshot also keeps each box's
+/// ``Shape`` and is only applied to a subtree whose shapes all match.
+struct LayoutSnapshot {
+	/// What a box contributes to the subtree's structure, cheap to compare.
+	struct Shape: Equatable {
+		let kind: Box.Kind
+		/// The pre-order position of the first box with this box's style.
+		let styleOwner: Int
+		/// A text box's UTF-8 length; any other box's child count.
+		let extent: Int
+	}
+
+	struct Fragment {
+		let text: String
+		let styleOwner: Int
+		let x: Double
+		let y: Double
+		let width: Double
+		let baseline: Double
+		let href: String?
+		let bidiLevel: UInt8
+		let font: Font?
+		let glyphs: [Int]?
+	}
+
+	struct Line {
+		let x: Double
+		let y: Double
+		let width: Double
+		let height: Double
+		let baseline: Double
+		let fragments: [Fragment]
+	}
+
+	struct Block {
+		let x: Double
+		let y: Double
+		let width: Double
+		let height: Double
+		let lines: [Line]
+	}
+
+	/// Every box in the subtree, in pre-order.
+	let shapes: [Shape]
+	let blocks: [Block]
+	/// The border-box height `layoutBlock` returned.
+	let height: Double
+	/// Blocks plus lines: what laying the subtree out charges to the budget.
+	let chargedBoxes: Int
+	/// Blocks, lines and fragments, as counted against ``LayoutCache/capacity``.
+	let size: Int
+
+	/// Record `root`'s laid-out subtree relative to `(originX, originY)`, or
+	/// `nil` if a fragment's style isn't found on any box in the subtree.
+	init?(capturing root: BlockBox, originX: Double, originY: Double, height: Double) {
+		let boxes = Self.preorder(root)
+		let (shapes, styleOwners) = Self.shapes(of: boxes)
+
+		var blocks: [Block] = []
+		var lineCount = 0
+		var fragmentCount = 0
+		for case let block as BlockBox in boxes {
+			var lines: [Line] = []
+			lines.reserveCapacity(block.lines.count)
+			for line in block.lines {
+				var fragments: [Fragment] = []
+				fragments.reserveCapacity(line.fragments.count)
+				for fragment in line.fragments {
+					guard let owner = styleOwners[fragment.styleIndex] else { return nil }
+					fragments.append(Fragment(text: fragment.text, styleOwner: owner,
+					                          x: fragment.x - originX, y: fragment.y - originY,
+					                          width: fragment.width, baseline: fragment.baseline - originY,
+					                          href: fragment.href, bidiLevel: fragment.bidiLevel,
+					                          font: fragment.font, glyphs: fragment.glyphs))
+				}
+				fragmentCount += fragments.count
+				lines.append(Line(x: line.x - originX, y: line.y - originY, width: line.width,
+				                  height: line.height, baseline: line.baseline, fragments: fragments))
+			}
+			lineCount += lines.count
+			blocks.append(Block(x: block.x - originX, y: block.y - originY, width: block.width,
+			                    height: block.height, lines: lines))
+		}
+		self.shapes = shapes
+		self.blocks = blocks
+		self.height = height
+		self.chargedBoxes = blocks.count + lineCount
+		self.size = blocks.count + lineCount + fragmentCount
+	}
+
+	/// Give `root`'s subtree this layout, translated to `(originX, originY)`.
+	/// Returns `false`, changing nothing, if the subtree's shape doesn't match.
+	func apply(to root: BlockBox, originX: Double, originY: Double) -> Bool {
+		let boxes = Self.preorder(root)
+		guard boxes.count == shapes.count, Self.shapes(of: boxes).shapes == shapes else { return false }
+		let targets = boxes.compactMap { $0 as? BlockBox }
+		guard targets.count == blocks.count else { return false }
+
+		for (target, block) in zip(targets, blocks) {
+			target.x = block.x + originX
+			target.y = block.y + originY
+			target.width = block.width
+			target.height = block.height
+			target.lines = block.lines.map { recorded in
+				let line = LineBox()
+				line.x = recorded.x + originX
+				line.y = recorded.y + originY
+				line.width = recorded.width
+				line.height = recorded.height
+				line.baseline = recorded.baseline
+				line.fragments = recorded.fragments.map { fragment in
+					var placed = TextFragment(text: fragment.text, arena: root.arena,
+					                          styleIndex: boxes[fragment.styleOwner].styleIndex,
+					                          x: fragment.x + originX, y: fragment.y + originY,
+					                          width: fragment.width, baseline: fragment.baseline + originY,
+					                          href: fragment.href, bidiLevel: fragment.bidiLevel, font: fragment.font)
+					placed.glyphs = fragment.glyphs
+					return placed
+				}
+				return line
+			}
+		}
+		return true
+	}
+
+	/// Each box's shape, and the pre-order position of each style's first box.
+	private static func shapes(of boxes: [Box]) -> (shapes: [Shape], styleOwners: [Int: Int]) {
+		var styleOwners: [Int: Int] = [:]
+		var shapes: [Shape] = []
+		shapes.reserveCapacity(boxes.count)
+		for (position, box) in boxes.enumerated() {
+			let owner = styleOwners[box.styleIndex] ?? position
+			styleOwners[box.styleIndex] = owner
+			let extent: Int
+			switch box.kind {
+			case .block: extent = unsafeDowncast(box, to: BlockBox.self).children.count
+			case .inline: extent = unsafeDowncast(box, to: InlineBox.self).children.count
+			case .text: extent = unsafeDowncast(box, to: TextBox.self).text.utf8.count
+			}
+			shapes.append(Shape(kind: box.kind, styleOwner: owner, extent: extent))
+		}
+		return (shapes, styleOwners)
+	}
+
+	private static func preorder(_ root: Box) -> [Box] {
+		var result: [Box] = []
+		func visit(_ box: Box) {
+			result.append(box)
+			switch box.kind {
+			case .block: for child in unsafeDowncast(box, to: BlockBox.self).children { visit(child) }
+			case .inline: for child in unsafeDowncast(box, to: InlineBox.self).children { visit(child) }
+			case .text: break
+			}
+		}
+		visit(root)
+		return result
+	}
+}
+
+/// Structural fingerprints of every subtree of one box tree, by arena slot,
+/// computed in a single bottom-up pass before layout consults the cache.
+struct SubtreeFingerprints {
+	let arena: BoxArena
+	private(set) var hashes: [Int]
+	private(set) var sizes: [Int]
+	/// Whether layout of the subtree can be replayed. Tables register their
+	/// header rows with the engine as a side effect, so they and their
+	/// ancestors are laid out every time.
+	private(set) var cacheable: [Bool]
+
+	init(root: BlockBox) {
+		arena = root.arena
+		hashes = Array(repeating: 0, count: arena.count)
+		sizes = Array(repeating: 0, count: arena.count)
+		cacheable = Array(repeating: false, count: arena.count)
+		let styleHashes = arena.styles.map(\.hashValue)
+		visit(root, styleHashes: styleHashes)
+	}
+
+	@discardableResult
+	private mutating func visit(_ box: Box, styleHashes: [Int]) -> (hash: Int, size: Int, cacheable: Bool) {
+		var hasher = Hasher()
+		hasher.combine(box.kind)
+		hasher.combine(styleHashes[box.styleIndex])
+		var size = 1
+		var replayable = true
+		let children: [Box]
+		switch box.kind {
+		case .text:
+			hasher.combine(unsafeDowncast(box, to: TextBox.self).text)
+			children = []
+		case .inline:
+			// Inline layout reads `<br>` and `<a href>` off the element.
+			hasher.combine(box.element?.localName)
+			hasher.combine(box.element?.attributeValue("href"))
+			children = unsafeDowncast(box, to: InlineBox.self).children
+		case .block:
+			let block = unsafeDowncast(box, to: BlockBox.self)
+			hasher.combine(block.isAnonymous)
+			hasher.combine(block.marker)
+			hasher.combine(block.image?.width)
+			hasher.combine(block.image?.height)
+			replayable = block.style.display != .table
+			children = block.children
+		}
+		hasher.combine(children.count)
+		for child in children {
+			let subtree = visit(child, styleHashes: styleHashes)
+			hasher.combine(subtree.hash)
+			size += subtree.size
+			replayable = replayable && subtree.cacheable
+		}
+		let hash = hasher.finalize()
+		hashes[box.slot] = hash
+		sizes[box.slot] = size
+		cacheable[box.slot] = replayable
+		return (hash, size, replayable)
+	}
+}
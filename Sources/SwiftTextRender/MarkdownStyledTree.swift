@@ -0,0 +1,332 @@
+//  MarkdownStyledTree.swift
+//  SwiftTextRender
+//
+//  Builds the unstyled element tree for a Markdown document straight from
+//  swift-markdown's AST, so Markdown reaches style resolution and the box
+//  tree without being serialized to HTML and parsed back. Elements and
+//  attributes mirror what `MarkdownToHTML` emits, so the same stylesheets
+//  match the same way.
+
+import Foundation
+import Markdown
+import SwiftTextCore
+import SwiftTextMarkdown
+
+enum MarkdownStyledTree {
+
+	/// The `document > html > body` tree for `markdown`, before styles are
+	/// resolved. Elements are metered against `budget` like parsed DOM nodes.
+	static func build(markdown: String, budget: ResourceBudget) throws -> StyledElement {
+		let (cleaned, definitions) = MarkdownFootnoteParser.extractDefinitions(from: markdown)
+		let document = Document(parsing: cleaned, options: [.disableSmartOpts])
+
+		let root = StyledElement(localName: "document", attributes: [:], parent: nil, elementIndex: 0)
+		let body = root.appendElement("html").appendElement("body")
+		let resolver = definitions.isEmpty ? nil : MarkdownFootnoteResolver(definitionIDs: definitions.map(\.id))
+		var builder = MarkdownTreeBuilder(body: body, resolver: resolver, budget: budget)
+		builder.visit(document)
+
+		// Definitions follow the body in footnote-number order, as in the HTML
+		// output's trailing `<div class="footnote-definition">` blocks.
+		resolver?.forEachReferencedDefinition(in: definitions) { number, definition in
+			builder.appendDefinition(number: number, body: Document(parsing: definition.body, options: [.disableSmartOpts]))
+		}
+		if let failure = builder.failure { throw failure }
+		return root
+	}
+}
+
+private struct MarkdownTreeBuilder: MarkupVisitor {
+	typealias Result = Void
+
+	/// The element new children are appended to.
+	private var current: StyledElement
+	private let resolver: MarkdownFootnoteResolver?
+	private let budget: ResourceBudget
+	/// The first budget error. Once set, tree edits are no-ops and every loop
+	/// over children stops, so the rest of the document is skipped.
+	private(set) var failure: Error?
+	private var alignmentStack: [[Table.ColumnAlignment?]] = []
+	/// References emitted so far per footnote number, for unique anchor ids.
+	private var referenceCounts: [Int: Int] = [:]
+
+	init(body: StyledElement, resolver: MarkdownFootnoteResolver?, budget: ResourceBudget) {
+		self.current = body
+		self.resolver = resolver
+		self.budget = budget
+	}
+
+	// MARK: - Tree edits
+
+	private mutating func open(_ localName: String, _ attributes: [String: String] = [:]) {
+		guard failure == nil else { return }
+		do {
+			try budget.charge(.domNodes)
+		} catch {
+			failure = error
+			return
+		}
+		current = current.appendElement(localName, attributes: attributes)
+	}
+
+	private mutating func close() {
+		guard failure == nil, let parent = current.parent else { return }
+		current = parent
+	}
+
+	private mutating func element(_ localName: String, _ attributes: [String: String] = [:], children markup: Markup) {
+		open(localName, attributes)
+		visitAll(markup.children)
+		close()
+	}
+
+	/// Visits `children` in order until the budget runs out.
+	private mutating func visitAll(_ children: some Sequence<Markup>) {
+		for child in children {
+			guard failure == nil else { return }
+			visit(child)
+		}
+	}
+
+	private func text(_ string: String) {
+		guard failure == nil else { return }
+		current.appendText(string)
+	}
+
+	// MARK: - Blocks
+
+	mutating func defaultVisit(_ markup: Markup) {
+		visitAll(markup.children)
+	}
+
+	mutating func visitDocument(_ document: Document) {
+		// The HTML output separates top-level blocks with a newline; keep it so
+		// adjacent escaped HTML blocks still read as separate words.
+		for (index, block) in document.children.enumerated() {
+			guard failure == nil else { return }
+			if index > 0 { text("\n") }
+			visit(block)
+		}
+	}
+
+	mutating func visitParagraph(_ paragraph: Paragraph) {
+		element("p", children: paragraph)
+	}
+
+	mutating func visitHeading(_ heading: Heading) {
+		element("h\(max(1, min(heading.level, 6)))", children: heading)
+	}
+
+	mutating func visitBlockQuote(_ blockQuote: BlockQuote) {
+		guard let alert = MarkdownAlertBlock(blockQuote) else {
+			element("blockquote", children: blockQuote)
+			return
+		}
+		open("aside", ["class": "markdown-alert markdown-alert-\(alert.kind)", "data-alert": alert.kind, "role": alert.role])
+		open("p", ["class": "markdown-alert-title"])
+		text(alert.title)
+		close()
+		if let lead = alert.leadingParagraph() {
+			open("p")
+			if let leadingText = lead.text { appendBodyText(leadingText) }
+			visitAll(lead.inlines)
+			close()
+		}
+		visitAll(alert.remainingBlocks)
+		close()
+	}
+
+	mutating func visitCodeBlock(_ codeBlock: CodeBlock) {
+		var code = codeBlock.code
+		if code.hasSuffix("\n") { code.removeLast() }
+		open("pre")
+		if let language = codeBlock.language, !language.isEmpty {
+			open("code", ["class": "language-\(language)"])
+		} else {
+			open("code")
+		}
+		text(code)
+		close()
+		close()
+	}
+
+	mutating func visitHTMLBlock(_ htmlBlock: HTMLBlock) {
+		// Raw HTML is escaped in the HTML output, so it reads as literal text.
+		var raw = htmlBlock.rawHTML
+		while raw.hasSuffix("\n") { raw.removeLast() }
+		text(raw)
+	}
+
+	mutating func visitThematicBreak(_ thematicBreak: ThematicBreak) {
+		open("hr")
+		close()
+	}
+
+	mutating func visitUnorderedList(_ unorderedList: UnorderedList) {
+		element("ul", children: unorderedList)
+	}
+
+	mutating func visitOrderedList(_ orderedList: OrderedList) {
+		element("ol", children: orderedList)
+	}
+
+	mutating func visitListItem(_ listItem: ListItem) {
+		if let checkbox = listItem.checkbox {
+			open("li", ["class": "task-list-item"])
+			var input = ["type": "checkbox", "disabled": ""]
+			if checkbox == .checked { input["checked"] = "" }
+			open("input", input)
+			close()
+			text(" ")
+		} else {
+			open("li")
+		}
+		// A lone paragraph is unwrapped, matching the HTML output's `<li>foo</li>`.
+		if listItem.childCount == 1, let only = listItem.child(at: 0) as? Paragraph {
+			visitAll(only.children)
+		} else {
+			visitAll(listItem.children)
+		}
+		close()
+	}
+
+	// MARK: - Tables
+
+	mutating func visitTable(_ table: Table) {
+		alignmentStack.append(table.columnAlignments)
+		defer { alignmentStack.removeLast() }
+		open("table")
+		open("thead")
+		open("tr")
+		appendCells(of: table.head, tag: "th")
+		close()
+		close()
+		open("tbody")
+		for case let row as Table.Row in table.body.children {
+			guard failure == nil else { break }
+			open("tr")
+			appendCells(of: row, tag: "td")
+			close()
+		}
+		close()
+		close()
+	}
+
+	private mutating func appendCells(of container: Markup, tag: String) {
+		let alignments = alignmentStack.last ?? []
+		var index = 0
+		for case let cell as Table.Cell in container.children {
+			guard failure == nil else { return }
+			var attributes: [String: String] = [:]
+			if index < alignments.count {
+				switch alignments[index] {
+				case .center?: attributes["style"] = "text-align: center;"
+				case .right?: attributes["style"] = "text-align: right;"
+				case .left?, nil: break
+				}
+			}
+			element(tag, attributes, children: cell)
+			index += 1
+		}
+	}
+
+	// MARK: - Inlines
+
+	mutating func visitText(_ text: Text) {
+		appendBodyText(text.string)
+	}
+
+	mutating func visitEmphasis(_ emphasis: Emphasis) {
+		element("em", children: emphasis)
+	}
+
+	mutating func visitStrong(_ strong: Strong) {
+		element("strong", children: strong)
+	}
+
+	mutating func visitStrikethrough(_ strikethrough: Strikethrough) {
+		element("del", children: strikethrough)
+	}
+
+	mutating func visitInlineCode(_ inlineCode: InlineCode) {
+		open("code")
+		text(inlineCode.code)
+		close()
+	}
+
+	mutating func visitInlineHTML(_ inlineHTML: InlineHTML) {
+		text(inlineHTML.rawHTML)
+	}
+
+	mutating func visitLink(_ link: Link) {
+		element("a", ["href": link.destination ?? ""], children: link)
+	}
+
+	mutating func visitImage(_ image: Image) {
+		open("img", ["src": image.source ?? "", "alt": swiftMarkdownPlainText(of: image)])
+		close()
+	}
+
+	mutating func visitSoftBreak(_ softBreak: SoftBreak) {
+		text("\n")
+	}
+
+	mutating func visitLineBreak(_ lineBreak: LineBreak) {
+		open("br")
+		close()
+	}
+
+	// MARK: - Footnotes
+
+	/// Body text, with `[^id]` references to known definitions turned into
+	/// `<sup><a href="#fn-N">[N]</a></sup>` the way the HTML output writes them.
+	private mutating func appendBodyText(_ string: String) {
+		guard let resolver, string.contains("[^") else {
+			text(string)
+			return
+		}
+		for segment in resolver.resolve(string) {
+			guard failure == nil else { return }
+			switch segment {
+			case .text(let literal):
+				text(literal)
+			case .reference(let number):
+				let occurrence = referenceCounts[number, default: 0] + 1
+				referenceCounts[number] = occurrence
+				open("sup")
+				open("a", ["href": "#fn-\(number)", "id": occurrence == 1 ? "ref-\(number)" : "ref-\(number)-\(occurrence)"])
+				text("[\(number)]")
+				close()
+				close()
+			}
+		}
+	}
+
+	/// A `<div class="footnote-definition">` for footnote `number`. A body that
+	/// is a single paragraph is inlined after the `[N]:` label.
+	mutating func appendDefinition(number: Int, body: Document) {
+		guard failure == nil else { return }
+		text("\n")
+		open("div", ["class": "footnote-definition", "id": "fn-\(number)"])
+		let blocks = Array(body.children)
+		if blocks.count == 1, let paragraph = blocks[0] as? Paragraph {
+			appendLabel(number)
+			text(" ")
+			visitAll(paragraph.children)
+		} else if blocks.isEmpty {
+			appendLabel(number)
+		} else {
+			open("p")
+			appendLabel(number)
+			close()
+			visitAll(blocks)
+		}
+		close()
+	}
+
+	private mutating func appendLabel(_ number: Int) {
+		open("strong")
+		text("[\(number)]:")
+		close()
+	}
+}
@@ -4,8 +4,9 @@
 //  CSS Paged Media margin boxes: `@page { @top-center { content: ... } }` and
 //  friends, for running headers/footers and `counter(page)`/`counter(pages)`
 //  page numbers. Parsing collects the six side (non-corner) margin boxes;
-//  resolution turns them into plain text + style, ready for `Painter` to draw
-//  directly in page space once the final page count is known.
+//  compiling cascades their styles and measures their literal text once per
+//  render; resolution then substitutes the counters for each page, ready for
+//  `Painter` to draw directly in page space once the final page count is known.
 
 import Foundation
 import SwiftTextCSS
@@ -57,19 +58,32 @@ struct PageSelector {
 	}
 }
 
-/// One `@page` rule's margin-box declarations, keyed by box name, plus the
-/// selector that decides which pages it applies to.
+/// One `@page` rule's margin boxes, keyed by box name, plus the selector that
+/// decides which pages it applies to.
 struct PageRule {
 	let selector: PageSelector
-	let marginBoxes: [MarginBoxArea: [Declaration]]
+	let marginBoxes: [MarginBoxArea: MarginBoxRule]
+}
+
+/// One rule's declarations for a margin box, with `content` parsed up front.
+struct MarginBoxRule {
+	/// Every declaration but `content`, in source order.
+	var declarations: [Declaration] = []
+	/// The rule's last `content` value, if it sets one; `[]` for `none`.
+	fileprivate var content: [ContentPart]?
 }
 
 /// A margin box resolved for a specific page: literal display text (counters
-/// already substituted) and the style to paint it with.
+/// already substituted), the style and font to paint it with, and its width.
 struct ResolvedMarginBox {
 	let area: MarginBoxArea
 	let text: String
 	let style: ComputedStyle
+	let font: Font
+	let width: Double
+	/// Whether the text includes `counter(page)`. Other boxes read the same on
+	/// every page of their ``MarginBoxTemplates/PageKind``.
+	let showsPageNumber: Bool
 }
 
 // MARK: - Parsing
@@ -82,12 +96,20 @@ func parsePageRules(_ sheets: [String]) -> [PageRule] {
 	for sheet in sheets {
 		for node in parseStylesheet(sheet, skipComments: true, skipWhitespace: true) {
 			guard case .atRule(let atRule) = node, atRule.lowerAtKeyword == "page", let content = atRule.content else { continue }
-			var marginBoxes: [MarginBoxArea: [Declaration]] = [:]
+			var marginBoxes: [MarginBoxArea: MarginBoxRule] = [:]
 			for child in parseBlocksContents(content, skipComments: true, skipWhitespace: true) {
 				guard case .atRule(let nested) = child,
 				      let area = MarginBoxArea(rawValue: nested.lowerAtKeyword),
 				      let nestedContent = nested.content else { continue }
-				marginBoxes[area, default: []].append(contentsOf: parseDeclarations(nestedContent))
+				var box = marginBoxes[area] ?? MarginBoxRule()
+				for declaration in parseDeclarations(nestedContent) {
+					if declaration.lowerName == "content" {
+						box.content = parseContentValue(declaration.value)
+					} else {
+						box.declarations.append(declaration)
+					}
+				}
+				marginBoxes[area] = box
 			}
 			guard !marginBoxes.isEmpty else { continue }
 			rules.append(PageRule(selector: parsePageSelector(atRule.prelude), marginBoxes: marginBoxes))
@@ -156,44 +178,105 @@ private func parseContentValue(_ value: [ComponentValue]) -> [ContentPart] {
 	return parts
 }
 
-private func renderedText(_ parts: [ContentPart], pageIndex: Int, totalPages: Int) -> String {
-	parts.map { part in
-		switch part {
-		case .literal(let string): return string
-		case .pageCounter(let style): return BoxTreeBuilder.formatOrdinal(pageIndex + 1, as: style)
-		case .pagesCounter(let style): return BoxTreeBuilder.formatOrdinal(totalPages, as: style)
+// MARK: - Compilation and resolution
+
+/// The margin boxes of every kind of page, cascaded and measured once per
+/// render. Page selectors only distinguish the first page and left/right
+/// pages, so there are three kinds; per page only counters are formatted.
+struct MarginBoxTemplates {
+	/// The kinds of page a `@page` selector can tell apart.
+	enum PageKind: Hashable {
+		case first, right, left
+
+		init(pageIndex: Int) {
+			self = pageIndex == 0 ? .first : pageIndex.isMultiple(of: 2) ? .right : .left
 		}
-	}.joined()
-}
+	}
+
+	/// One margin box whose style, font and literal text no longer vary.
+	private struct Template {
+		let area: MarginBoxArea
+		let parts: [ContentPart]
+		let style: ComputedStyle
+		let font: Font
+		/// The summed width of the literal parts.
+		let literalWidth: Double
+		let showsPageNumber: Bool
+	}
+
+	private let first: [Template]
+	private let right: [Template]
+	private let left: [Template]
+
+	var isEmpty: Bool { first.isEmpty && right.isEmpty && left.isEmpty }
 
-// MARK: - Resolution
-
-/// Resolve every margin box that applies to page `pageIndex` (0-based), given
-/// the final page count. Declarations from every matching rule are merged per
-/// box, in source order, so an unqualified base rule and a later `:first`
-/// override can each set only the properties they care about (e.g. `:first`
-/// clearing `content` while the base rule's `font-size` still applies).
-func resolveMarginBoxes(_ rules: [PageRule], pageIndex: Int, totalPages: Int, rootStyle: ComputedStyle, rootFontSize: Double) -> [ResolvedMarginBox] {
-	let matching = rules.filter { $0.selector.matches(pageIndex: pageIndex) }
-	guard !matching.isEmpty else { return [] }
-
-	var result: [ResolvedMarginBox] = []
-	for area in MarginBoxArea.allCases {
-		let declarations = matching.flatMap { $0.marginBoxes[area] ?? [] }
-		guard let contentDeclaration = declarations.last(where: { $0.lowerName == "content" }) else { continue }
-		let parts = parseContentValue(contentDeclaration.value)
-		guard !parts.isEmpty else { continue }
-		let text = renderedText(parts, pageIndex: pageIndex, totalPages: totalPages)
-		guard !text.isEmpty else { continue }
-
-		// The box's own parent for inheritance: the document root's style (per
-		// spec, margin boxes inherit from the page context, not the element
-		// under the cursor), with its position's implied alignment as the
-		// default `text-align` — an explicit `text-align` in the rule still wins.
-		var parent = rootStyle
-		parent.textAlign = area.impliedTextAlign
-		let style = applyDeclarations(declarations.filter { $0.lowerName != "content" }, inheriting: parent, rootFontSize: rootFontSize)
-		result.append(ResolvedMarginBox(area: area, text: text, style: style))
+	/// Declarations from every matching rule are merged per box, in source
+	/// order, so an unqualified base rule and a later `:first` override can each
+	/// set only the properties they care about (e.g. `:first` clearing `content`
+	/// while the base rule's `font-size` still applies).
+	init(_ rules: [PageRule], rootStyle: ComputedStyle, rootFontSize: Double, fonts: FontBook) {
+		func compile(pageIndex: Int) -> [Template] {
+			let matching = rules.filter { $0.selector.matches(pageIndex: pageIndex) }
+			var templates: [Template] = []
+			for area in MarginBoxArea.allCases {
+				let boxes = matching.compactMap { $0.marginBoxes[area] }
+				guard let parts = boxes.last(where: { $0.content != nil })?.content, !parts.isEmpty else { continue }
+
+				// The box's own parent for inheritance: the document root's style (per
+				// spec, margin boxes inherit from the page context, not the element
+				// under the cursor), with its position's implied alignment as the
+				// default `text-align` — an explicit `text-align` in the rule still wins.
+				var parent = rootStyle
+				parent.textAlign = area.impliedTextAlign
+				let style = applyDeclarations(boxes.flatMap(\.declarations), inheriting: parent, rootFontSize: rootFontSize)
+				let font = fonts.font(for: style)
+				var literalWidth = 0.0
+				for case .literal(let string) in parts {
+					literalWidth += font.width(of: string, size: style.fontSize)
+				}
+				let showsPageNumber = parts.contains { part in
+					if case .pageCounter = part { return true }
+					return false
+				}
+				templates.append(Template(area: area, parts: parts, style: style, font: font, literalWidth: literalWidth,
+				                          showsPageNumber: showsPageNumber))
+			}
+			return templates
+		}
+		first = compile(pageIndex: 0)
+		right = compile(pageIndex: 2)
+		left = compile(pageIndex: 1)
+	}
+
+	/// Resolve every margin box that applies to page `pageIndex` (0-based),
+	/// given the final page count.
+	func resolve(pageIndex: Int, totalPages: Int) -> [ResolvedMarginBox] {
+		let templates: [Template]
+		switch PageKind(pageIndex: pageIndex) {
+		case .first: templates = first
+		case .right: templates = right
+		case .left: templates = left
+		}
+		var result: [ResolvedMarginBox] = []
+		for template in templates {
+			var text = ""
+			var width = template.literalWidth
+			func appendCounter(_ number: Int, as style: ListStyleType) {
+				let counter = BoxTreeBuilder.formatOrdinal(number, as: style)
+				text += counter
+				width += template.font.width(of: counter, size: template.style.fontSize)
+			}
+			for part in template.parts {
+				switch part {
+				case .literal(let string): text += string
+				case .pageCounter(let style): appendCounter(pageIndex + 1, as: style)
+				case .pagesCounter(let style): appendCounter(totalPages, as: style)
+				}
+			}
+			guard !text.isEmpty else { continue }
+			result.append(ResolvedMarginBox(area: template.area, text: text, style: template.style,
+			                                font: template.font, width: width, showsPageNumber: template.showsPageNumber))
+		}
+		return result
 	}
-	return result
 }
@@ -23,24 +23,46 @@ public struct PageGeometry {
 	public let columnTop: Double
 	/// The height of the column slice shown on this page.
 	public let sliceHeightPx: Double
+	/// Space at the top of the content area taken by a repeated table header;
+	/// the slice is shown below it.
+	public let headerBandPx: Double
 
-	public init(pageWidthPx: Double, pageHeightPx: Double, marginPx: Double, columnTop: Double, sliceHeightPx: Double) {
+	public init(pageWidthPx: Double, pageHeightPx: Double, marginPx: Double, columnTop: Double, sliceHeightPx: Double,
+	            headerBandPx: Double = 0) {
 		self.pageWidthPx = pageWidthPx
 		self.pageHeightPx = pageHeightPx
 		self.marginPx = marginPx
 		self.columnTop = columnTop
 		self.sliceHeightPx = sliceHeightPx
+		self.headerBandPx = headerBandPx
 	}
 }
 
+/// Content drawn the same way on several pages. It is painted once into a
+/// Form XObject that each page then places with `Do`.
+enum RepeatedContent: Hashable {
+	/// A table's header rows, repeated atop each page the table continues onto.
+	case tableHeader(ObjectIdentifier)
+	/// One kind of page's margin boxes that don't show `counter(page)`.
+	case marginBoxes(MarginBoxTemplates.PageKind)
+}
+
 public final class Painter {
 	public let stream = PDFStream()
-	private let geometry: PageGeometry
+	private var geometry: PageGeometry
 	private let fonts: FontBook
 
 	private let builder: FontResourceBuilder
 	private var linkAnnotations: [PDFDictionary] = []
 
+	/// Fill color, font and character spacing last set in the page's base
+	/// graphics state, so text can skip repeating `rg`/`Tf`/`Tc`. Painting that
+	/// changes them inside `q`…`Q` leaves these valid; popping back to the state
+	/// saved in `init` must call `forgetTextState()`. `nil` means unknown.
+	private var currentFill: RGBA?
+	private var currentFont: (resource: String, size: Double)?
+	private var currentCharacterSpacing: Double? = 0
+
 	public init(geometry: PageGeometry, fonts: FontBook, builder: FontResourceBuilder, compress: Bool = true) {
 		self.geometry = geometry
 		self.fonts = fonts
@@ -55,9 +77,47 @@ public final class Painter {
 		// outside the content slice, in the page's margin area.
 		stream.pushState()
 		// Clip to this page's content slice so other pages don't bleed in.
+		clipToSlice()
+	}
+
+	/// A painter for the Form XObject of some ``RepeatedContent``. The form is
+	/// drawn under the page's px-to-pt matrix, so it works in CSS px like the
+	/// page and sets up no transform of its own; the text state it inherits
+	/// from the page is unknown.
+	private init(formOn geometry: PageGeometry, fonts: FontBook, builder: FontResourceBuilder, compress: Bool) {
+		self.geometry = geometry
+		self.fonts = fonts
+		self.builder = builder
+		stream.compressed = compress
+		stream.setExtra("Type", "/XObject")
+		stream.setExtra("Subtype", "/Form")
+		stream.setExtra("BBox", PDFArray([0, 0, geometry.pageWidthPx, geometry.pageHeightPx]))
+		stream.setExtra("Resources", builder.resourcesReference)
+		forgetTextState()
+	}
+
+	/// Place `content` on this page, painting its form with `paint` the first
+	/// time any page needs it. Links in the form get fresh annotations here,
+	/// as an annotation belongs to a single page.
+	private func drawRepeated(_ content: RepeatedContent, paint: (Painter) -> Void) {
+		let form: FontResourceBuilder.Form
+		if let existing = builder.form(for: content) {
+			form = existing
+		} else {
+			let painter = Painter(formOn: geometry, fonts: fonts, builder: builder, compress: stream.compressed)
+			paint(painter)
+			form = builder.addForm(painter.stream, for: content, annotations: painter.linkAnnotations)
+		}
+		stream.drawXObject(form.name)
+		for annotation in form.annotations {
+			linkAnnotations.append(PDFDictionary(annotation.keys.map { ($0, annotation[$0]!) }))
+		}
+	}
+
+	private func clipToSlice() {
 		let contentWidth = geometry.pageWidthPx - 2 * geometry.marginPx
 		stream.rectangle(geometry.marginPx,
-		                 geometry.pageHeightPx - geometry.marginPx - geometry.sliceHeightPx,
+		                 geometry.pageHeightPx - geometry.marginPx - geometry.headerBandPx - geometry.sliceHeightPx,
 		                 contentWidth, geometry.sliceHeightPx)
 		stream.clip()
 		stream.endPath()
@@ -87,7 +147,7 @@ public final class Painter {
 
 	/// Page y (from page top) for a column y-coordinate.
 	private func pageY(_ columnY: Double) -> Double {
-		geometry.marginPx + (columnY - geometry.columnTop)
+		geometry.marginPx + geometry.headerBandPx + (columnY - geometry.columnTop)
 	}
 
 	/// Lower-left y (PDF y-up) for a box whose column top and height are given.
@@ -97,7 +157,8 @@ public final class Painter {
 
 	/// Paint the box tree onto this page.
 	public func paint(_ box: Box) {
-		if let block = box as? BlockBox {
+		if box.kind == .block {
+			let block = unsafeDowncast(box, to: BlockBox.self)
 			// Skip boxes (and their subtrees) that lie entirely off this page. In
 			// normal flow a child's extent is contained by its parent's, so pruning
 			// a non-intersecting block can't drop visible descendants.
@@ -108,9 +169,7 @@ public final class Painter {
 				paintImage(block, image: image)
 			} else if block.establishesInlineContext {
 				for line in block.lines where lineOnThisPage(line.y) {
-					for fragment in line.fragments {
-						paintText(fragment)
-					}
+					paintLine(line)
 				}
 			} else {
 				for child in block.children {
@@ -121,6 +180,24 @@ public final class Painter {
 		// Inline and text boxes are painted through their block's line fragments.
 	}
 
+	/// Paint a table's header rows into the band this page reserves for them
+	/// (``PageGeometry/headerBandPx``), then restore the body slice. The band
+	/// is the same on every page the table continues onto, so it is one form.
+	func paintRepeatedHeader(_ header: BlockBox) {
+		// Drop the body clip; the form clips to the band itself.
+		stream.popState()
+		forgetTextState()
+		drawRepeated(.tableHeader(ObjectIdentifier(header))) { form in
+			let body = form.geometry
+			form.geometry = PageGeometry(pageWidthPx: body.pageWidthPx, pageHeightPx: body.pageHeightPx, marginPx: body.marginPx,
+			                             columnTop: header.y, sliceHeightPx: header.height)
+			form.clipToSlice()
+			form.paint(header)
+		}
+		stream.pushState()
+		clipToSlice()
+	}
+
 	// MARK: - Backgrounds and borders
 
 	private func paintBackground(_ box: Box) {
@@ -193,85 +270,200 @@ public final class Painter {
 	/// page-number counters) directly in page space, independent of the
 	/// column-to-slice mapping used for body content: margin boxes sit in the
 	/// fixed page-margin strip, not on the scrolling column.
-	func paintMarginBoxes(_ boxes: [ResolvedMarginBox]) {
+	///
+	/// With a `pageKind`, boxes that don't show `counter(page)` go into a form
+	/// shared by all pages of that kind, and only page numbers are drawn here.
+	func paintMarginBoxes(_ boxes: [ResolvedMarginBox], pageKind: MarginBoxTemplates.PageKind? = nil) {
 		guard !boxes.isEmpty else { return }
 		// Restore the state saved in `init`, before the content-slice clip.
 		stream.popState()
-		for box in boxes {
-			let font = fonts.font(for: box.style)
-			let resource = builder.resourceName(for: font)
-			let textWidth = font.width(of: box.text, size: box.style.fontSize)
-			let ascent = font.ascent(size: box.style.fontSize)
-			let descent = font.descent(size: box.style.fontSize)
-
-			let contentWidth = geometry.pageWidthPx - 2 * geometry.marginPx
-			let extra = max(0, contentWidth - textWidth)
-			let rtl = box.style.direction == .rtl
-			let x: Double
-			switch box.style.textAlign {
-			case .center: x = geometry.marginPx + extra / 2
-			case .right: x = geometry.marginPx + extra
-			case .left: x = geometry.marginPx
-			case .end: x = geometry.marginPx + (rtl ? 0 : extra)
-			case .start: x = geometry.marginPx + (rtl ? extra : 0)
-			case .justify: x = geometry.marginPx
-			}
-
-			// Center the text vertically within its margin strip (top strip is
-			// [0, marginPx]; bottom strip is [pageHeightPx - marginPx, pageHeightPx]).
-			let stripTop = box.area.isTop ? 0 : geometry.pageHeightPx - geometry.marginPx
-			let baselineY = stripTop + (geometry.marginPx + ascent - descent) / 2
-
-			stream.beginText()
-			stream.setColorRGB(box.style.color.red, box.style.color.green, box.style.color.blue)
-			stream.setFontSize(resource, box.style.fontSize)
-			stream.moveTextTo(x, geometry.pageHeightPx - baselineY)
-			switch font {
-			case .standard:
-				stream.showRawString(encodeWinAnsi(box.text))
-			case .embedded(let embedded):
-				stream.showHexString(encodeGlyphs(box.text, font: embedded, fontKey: font.key))
+		forgetTextState()
+		var pageBoxes = boxes
+		if let pageKind {
+			let shared = boxes.filter { !$0.showsPageNumber }
+			if !shared.isEmpty {
+				drawRepeated(.marginBoxes(pageKind)) { form in
+					for box in shared { form.paintMarginBox(box) }
+				}
+				pageBoxes = boxes.filter(\.showsPageNumber)
 			}
-			stream.endText()
 		}
+		for box in pageBoxes { paintMarginBox(box) }
 	}
 
-	// MARK: - Text
-
-	private func paintText(_ fragment: TextFragment) {
-		// Use the run's resolved font (set by fallback); else resolve from style.
-		let font = fragment.font ?? fonts.font(for: fragment.style)
+	private func paintMarginBox(_ box: ResolvedMarginBox) {
+		let font = box.font
 		let resource = builder.resourceName(for: font)
-		let color = fragment.style.color
+		let textWidth = box.width
+		let ascent = font.ascent(size: box.style.fontSize)
+		let descent = font.descent(size: box.style.fontSize)
+
+		let contentWidth = geometry.pageWidthPx - 2 * geometry.marginPx
+		let extra = max(0, contentWidth - textWidth)
+		let rtl = box.style.direction == .rtl
+		let x: Double
+		switch box.style.textAlign {
+		case .center: x = geometry.marginPx + extra / 2
+		case .right: x = geometry.marginPx + extra
+		case .left: x = geometry.marginPx
+		case .end: x = geometry.marginPx + (rtl ? 0 : extra)
+		case .start: x = geometry.marginPx + (rtl ? extra : 0)
+		case .justify: x = geometry.marginPx
+		}
+
+		// Center the text vertically within its margin strip (top strip is
+		// [0, marginPx]; bottom strip is [pageHeightPx - marginPx, pageHeightPx]).
+		let stripTop = box.area.isTop ? 0 : geometry.pageHeightPx - geometry.marginPx
+		let baselineY = stripTop + (geometry.marginPx + ascent - descent) / 2
 
-		let letterSpacing = fragment.style.letterSpacing
 		stream.beginText()
-		stream.setColorRGB(color.red, color.green, color.blue)
-		stream.setFontSize(resource, fragment.style.fontSize)
-		if letterSpacing != 0 { stream.setCharacterSpacing(letterSpacing) }
-		stream.moveTextTo(fragment.x, geometry.pageHeightPx - pageY(fragment.baseline))
+		setFill(box.style.color)
+		setFont(resource, size: box.style.fontSize)
+		stream.moveTextTo(x, geometry.pageHeightPx - baselineY)
 		switch font {
 		case .standard:
-			stream.showRawString(encodeWinAnsi(fragment.text))
+			stream.showRawString(encodeWinAnsi(box.text))
 		case .embedded(let embedded):
-			stream.showHexString(encodeGlyphs(fragment.text, font: embedded, fontKey: font.key))
+			stream.showHexString(encodeGlyphs(box.text, font: embedded, fontKey: font.key))
 		}
 		stream.endText()
-		if letterSpacing != 0 { stream.setCharacterSpacing(0) } // reset for following text
+	}
+
+	// MARK: - Text
 
-		if fragment.style.underline || fragment.style.lineThrough {
-			paintDecorations(fragment, font: font)
+	/// Paint a line's fragments. Consecutive fragments sharing a font, size,
+	/// color and letter-spacing go into one text object: the first is placed
+	/// with `Td` and the rest by `TJ` adjustments for the gaps between them.
+	///
+	/// A style is copied out of the arena once per run; fragments sharing the
+	/// run's style slot (most words of a paragraph) reuse that copy.
+	private func paintLine(_ line: LineBox) {
+		let fragments = line.fragments
+		var start = 0
+		while start < fragments.count {
+			let first = fragments[start]
+			let style = first.style
+			// Use the run's resolved font (set by fallback); else resolve from style.
+			let font = first.font ?? fonts.font(for: style)
+			var end = start + 1
+			while end < fragments.count {
+				let next = fragments[end]
+				guard next.baseline == first.baseline else { break }
+				if next.sharesStyle(with: first) {
+					let nextFont = next.font ?? (first.font == nil ? font : fonts.font(for: style))
+					guard nextFont.key == font.key else { break }
+				} else {
+					let nextStyle = next.style
+					guard (next.font ?? fonts.font(for: nextStyle)).key == font.key,
+					      nextStyle.fontSize == style.fontSize, nextStyle.color == style.color,
+					      nextStyle.letterSpacing == style.letterSpacing else { break }
+				}
+				end += 1
+			}
+			paintTextRun(fragments[start ..< end], font: font, style: style)
+			for fragment in fragments[start ..< end] {
+				let fragmentStyle = fragment.sharesStyle(with: first) ? style : fragment.style
+				if fragmentStyle.underline || fragmentStyle.lineThrough {
+					paintDecorations(fragment, style: fragmentStyle, font: font)
+				}
+				if let href = fragment.href {
+					addLinkAnnotation(for: fragment, fontSize: fragmentStyle.fontSize, font: font, href: href)
+				}
+			}
+			start = end
 		}
-		if let href = fragment.href {
-			addLinkAnnotation(for: fragment, font: font, href: href)
+	}
+
+	private func paintTextRun(_ run: ArraySlice<TextFragment>, font: Font, style: ComputedStyle) {
+		guard let first = run.first else { return }
+		let size = style.fontSize
+		stream.beginText()
+		setFill(style.color)
+		setFont(builder.resourceName(for: font), size: size)
+		setCharacterSpacing(style.letterSpacing)
+		stream.moveTextTo(first.x, geometry.pageHeightPx - pageY(first.baseline))
+		if run.count == 1 {
+			switch font {
+			case .standard:
+				stream.showRawString(encodeWinAnsi(first.text))
+			case .embedded(let embedded):
+				stream.showHexString(encodeGlyphs(first.text, font: embedded, fontKey: font.key, glyphs: first.glyphs))
+			}
+		} else {
+			var array = PDFTextArray()
+			var penX = first.x
+			for fragment in run {
+				// Close any gap between where the viewer left the pen and the
+				// fragment's laid-out position, so rounding never accumulates.
+				let gap = fragment.x - penX
+				if abs(gap) > 0.001, size > 0 {
+					array.appendAdjustment(-gap * 1000 / size)
+					penX = fragment.x
+				}
+				let codes: Data
+				switch font {
+				case .standard:
+					codes = encodeWinAnsi(fragment.text)
+					array.appendLiteral(codes)
+				case .embedded(let embedded):
+					codes = encodeGlyphs(fragment.text, font: embedded, fontKey: font.key, glyphs: fragment.glyphs)
+					array.appendHex(codes)
+				}
+				penX += shownAdvance(of: codes, text: fragment.text, font: font, size: size, spacing: style.letterSpacing)
+			}
+			stream.showText(array)
 		}
+		stream.endText()
+	}
+
+	/// How far a viewer moves the pen after showing `codes`: the widths the PDF
+	/// declares for them (an embedded font's `/W` entries are rounded to 1/1000
+	/// em, so they drift from the layout widths) plus `Tc` once per code.
+	private func shownAdvance(of codes: Data, text: String, font: Font, size: Double, spacing: Double) -> Double {
+		switch font {
+		case .standard(let standard):
+			let shown = String(data: codes, encoding: .windowsCP1252) ?? text
+			return standard.width(of: shown, size: size) + Double(codes.count) * spacing
+		case .embedded(let embedded):
+			var units = 0
+			var index = codes.startIndex
+			while index + 1 < codes.endIndex {
+				units += embedded.pdfWidth(glyph: Int(codes[index]) << 8 | Int(codes[index + 1]))
+				index += 2
+			}
+			return Double(units) * size / 1000 + Double(codes.count / 2) * spacing
+		}
+	}
+
+	private func setFill(_ color: RGBA) {
+		guard currentFill != color else { return }
+		stream.setColorRGB(color.red, color.green, color.blue)
+		currentFill = color
+	}
+
+	private func setFont(_ resource: String, size: Double) {
+		if let current = currentFont, current.resource == resource, current.size == size { return }
+		stream.setFontSize(resource, size)
+		currentFont = (resource, size)
+	}
+
+	private func setCharacterSpacing(_ spacing: Double) {
+		guard currentCharacterSpacing != spacing else { return }
+		stream.setCharacterSpacing(spacing)
+		currentCharacterSpacing = spacing
+	}
+
+	private func forgetTextState() {
+		currentFill = nil
+		currentFont = nil
+		currentCharacterSpacing = nil
 	}
 
 	/// Draw underline and/or line-through bars for a fragment.
-	private func paintDecorations(_ fragment: TextFragment, font: Font) {
-		let size = fragment.style.fontSize
+	private func paintDecorations(_ fragment: TextFragment, style: ComputedStyle, font: Font) {
+		let size = style.fontSize
 		let thickness = max(0.5, size / 16)
-		let color = fragment.style.color
+		let color = style.color
 		stream.pushState()
 		stream.setColorRGB(color.red, color.green, color.blue)
 		func bar(atColumnY columnY: Double) {
@@ -279,10 +471,10 @@ public final class Painter {
 			stream.rectangle(fragment.x, bottom, fragment.width, thickness)
 			stream.fill()
 		}
-		if fragment.style.underline {
+		if style.underline {
 			bar(atColumnY: fragment.baseline + size * 0.12)
 		}
-		if fragment.style.lineThrough {
+		if style.lineThrough {
 			bar(atColumnY: fragment.baseline - font.ascent(size: size) * 0.30)
 		}
 		stream.popState()
@@ -290,10 +482,13 @@ public final class Painter {
 
 	/// Encode text as 2-byte glyph identifiers (Identity-H) and record the glyphs
 	/// so the embedded font's width array and ToUnicode map can be built.
-	private func encodeGlyphs(_ text: String, font: EmbeddedFont, fontKey: String) -> Data {
+	/// `glyphs`, when layout already resolved them, are used as they are.
+	private func encodeGlyphs(_ text: String, font: EmbeddedFont, fontKey: String, glyphs: [Int]? = nil) -> Data {
 		var bytes = Data()
-		for scalar in text.unicodeScalars {
-			let glyph = font.glyphID(for: scalar)
+		bytes.reserveCapacity(text.utf8.count * 2)
+		let glyphs = glyphs?.count == text.unicodeScalars.count ? glyphs : nil
+		for (index, scalar) in text.unicodeScalars.enumerated() {
+			let glyph = glyphs?[index] ?? font.glyphID(for: scalar)
 			builder.recordGlyph(glyph, scalar: scalar, fontKey: fontKey)
 			bytes.append(UInt8((glyph >> 8) & 0xFF))
 			bytes.append(UInt8(glyph & 0xFF))
@@ -302,11 +497,11 @@ public final class Painter {
 	}
 
 	/// A `/Link` annotation covering a fragment, if it falls on this page slice.
-	private func addLinkAnnotation(for fragment: TextFragment, font: Font, href: String) {
+	private func addLinkAnnotation(for fragment: TextFragment, fontSize: Double, font: Font, href: String) {
 		guard fragment.baseline >= geometry.columnTop,
 		      fragment.baseline <= geometry.columnTop + geometry.sliceHeightPx else { return }
-		let ascent = font.ascent(size: fragment.style.fontSize)
-		let descent = font.descent(size: fragment.style.fontSize)
+		let ascent = font.ascent(size: fontSize)
+		let descent = font.descent(size: fontSize)
 		let topPageY = pageY(fragment.baseline) - ascent
 		let bottomPageY = pageY(fragment.baseline) + descent
 		// Annotation rectangles are in default (unscaled, y-up) user space.
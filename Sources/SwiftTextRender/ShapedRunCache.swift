@@ -0,0 +1,62 @@
+//  ShapedRunCache.swift
+//  SwiftTextRender
+//
+//  Memoizes the font-fallback, Arabic-shaping and measuring work done for
+//  each word during inline layout. Words recur constantly in running text, so
+//  a hit skips per-scalar cmap probes for the shaper and fallback search.
+
+import Foundation
+
+/// One font run of a laid-out word: its (shaped) text, the font drawing it,
+/// its advance, and — for embedded fonts — the glyph for each scalar.
+struct ShapedRun {
+	let text: String
+	let font: Font
+	let width: Double
+	let glyphs: [Int]?
+}
+
+/// A bounded, thread-safe map from a word in a given primary font to its
+/// shaped runs. When full it starts over rather than tracking recency: the
+/// words that matter come back within a page or two.
+final class ShapedRunCache: @unchecked Sendable {
+	/// Substrings hash and compare by content, so layout looks a word up as a
+	/// slice of its paragraph without allocating; ``runs(for:compute:)`` copies
+	/// the word out only when it stores a miss.
+	struct Key: Hashable {
+		let word: Substring
+		/// ``Font/key`` of the style's primary font; weight and slant also pick
+		/// the base-14 fallback face.
+		let font: String
+		let bold: Bool
+		let italic: Bool
+		let size: Double
+		let letterSpacing: Double
+	}
+
+	private let capacity: Int
+	private var entries: [Key: [ShapedRun]] = [:]
+	private let lock = NSLock()
+
+	init(capacity: Int = 8192) {
+		self.capacity = capacity
+	}
+
+	/// The cached runs for `key`, computing and storing them on a miss.
+	func runs(for key: Key, compute: () -> [ShapedRun]) -> [ShapedRun] {
+		lock.lock()
+		if let runs = entries[key] {
+			lock.unlock()
+			return runs
+		}
+		lock.unlock()
+		let runs = compute()
+		lock.lock()
+		if entries.count >= capacity { entries.removeAll(keepingCapacity: true) }
+		// Detach the word so the cache doesn't keep the whole paragraph alive.
+		entries[Key(word: Substring(String(key.word)), font: key.font, bold: key.bold, italic: key.italic,
+		            size: key.size, letterSpacing: key.letterSpacing)] = runs
+		lock.unlock()
+		return runs
+	}
+}
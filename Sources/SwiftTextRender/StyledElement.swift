@@ -1,19 +1,20 @@
 //  StyledElement.swift
 //  SwiftTextRender
 //
-//  Adapts SwiftTextHTML's DOM (`DOMElement`/`DOMNode`) to the CSS engine: it
-//  conforms to `SelectorElement` for selector matching and carries the
-//  element's computed style. Building the tree resolves styles top-down so each
-//  element inherits from its parent.
+//  Adapts a document tree to the CSS engine: it conforms to `SelectorElement`
+//  for selector matching and carries the element's computed style. Trees come
+//  from SwiftTextHTML's DOM (`DOMElement`/`DOMNode`) or straight from a
+//  Markdown AST (see MarkdownStyledTree.swift). Building the tree resolves
+//  styles top-down so each element inherits from its parent.
 
 import Foundation
 import SwiftTextHTML
 import SwiftTextCSS
 
-/// A DOM element paired with its computed style and tree links.
+/// A document element paired with its computed style and tree links.
 public final class StyledElement: SelectorElement {
-	/// The wrapped DOM element.
-	public let domElement: DOMElement
+	/// The wrapped DOM element, or `nil` for an element built from a Markdown AST.
+	public let domElement: DOMElement?
 	/// The element's resolved style (filled while building the tree).
 	public internal(set) var computedStyle: ComputedStyle = .initial
 
@@ -31,10 +32,12 @@ public final class StyledElement: SelectorElement {
 	/// Children in document order, interleaving elements and text.
 	public private(set) var children: [Child] = []
 
+	public let localName: String
 	private let attributes: [String: String]
 
 	init(domElement: DOMElement, parent: StyledElement?, elementIndex: Int) {
 		self.domElement = domElement
+		self.localName = domElement.name.lowercased()
 		self.parent = parent
 		self.elementIndex = elementIndex
 		var lowered: [String: String] = [:]
@@ -45,9 +48,17 @@ public final class StyledElement: SelectorElement {
 		self.attributes = lowered
 	}
 
-	// MARK: - SelectorElement
+	/// An element with no DOM behind it. `localName` and attribute names must
+	/// already be lowercase.
+	init(localName: String, attributes: [String: String], parent: StyledElement?, elementIndex: Int) {
+		self.domElement = nil
+		self.localName = localName
+		self.parent = parent
+		self.elementIndex = elementIndex
+		self.attributes = attributes
+	}
 
-	public var localName: String { domElement.name.lowercased() }
+	// MARK: - SelectorElement
 
 	public func attributeValue(_ name: String) -> String? {
 		attributes[name.lowercased()]
@@ -70,37 +81,62 @@ public final class StyledElement: SelectorElement {
 	/// Build a styled tree from a DOM root, resolving styles top-down.
 	public static func build(domElement: DOMElement, resolver: StyleResolver, baseDirection: Direction = .ltr) -> StyledElement {
 		let root = StyledElement(domElement: domElement, parent: nil, elementIndex: 0)
-		// The document inherits the base direction (overridable by dir/CSS).
-		var rootParent = ComputedStyle.initial
-		rootParent.direction = baseDirection
-		root.computedStyle = resolver.style(for: root, inheriting: rootParent, rootFontSize: ComputedStyle.initial.fontSize)
-		// The root element establishes the initial containing block and is always
-		// a block container. (SwiftTextHTML wraps documents in a synthetic
-		// "document" element with no UA rule, which would otherwise be inline.)
-		root.computedStyle.display = .block
-		let rootFontSize = root.computedStyle.fontSize
-		root.buildChildren(resolver: resolver, rootFontSize: rootFontSize)
+		root.appendChildren(of: domElement)
+		root.resolveStyles(resolver: resolver, baseDirection: baseDirection)
 		return root
 	}
 
-	private func buildChildren(resolver: StyleResolver, rootFontSize: Double) {
-		var elementIndex = 0
+	private func appendChildren(of domElement: DOMElement) {
 		for node in domElement.children {
 			if let childElement = node as? DOMElement {
-				let child = StyledElement(domElement: childElement, parent: self, elementIndex: elementIndex)
+				let child = StyledElement(domElement: childElement, parent: self, elementIndex: elementChildren.count)
 				elementChildren.append(child)
 				children.append(.element(child))
-				elementIndex += 1
+				child.appendChildren(of: childElement)
 			} else if node.name == "#text" {
 				children.append(.text(node.text()))
 			}
 		}
+	}
+
+	/// Append a new element child (see ``init(localName:attributes:parent:elementIndex:)``).
+	func appendElement(_ localName: String, attributes: [String: String] = [:]) -> StyledElement {
+		let child = StyledElement(localName: localName, attributes: attributes, parent: self, elementIndex: elementChildren.count)
+		elementChildren.append(child)
+		children.append(.element(child))
+		return child
+	}
+
+	/// Append text, joining it to a preceding text child the way a parser
+	/// delivers one text node for a contiguous run of character data.
+	func appendText(_ text: String) {
+		guard !text.isEmpty else { return }
+		if case .text(let previous)? = children.last {
+			children[children.count - 1] = .text(previous + text)
+		} else {
+			children.append(.text(text))
+		}
+	}
+
+	/// Resolve styles over a fully built tree, with `self` as the root.
+	func resolveStyles(resolver: StyleResolver, baseDirection: Direction) {
+		// The document inherits the base direction (overridable by dir/CSS).
+		var rootParent = ComputedStyle.initial
+		rootParent.direction = baseDirection
+		computedStyle = resolver.style(for: self, inheriting: rootParent, rootFontSize: ComputedStyle.initial.fontSize)
+		// The root element establishes the initial containing block and is always
+		// a block container. (SwiftTextHTML wraps documents in a synthetic
+		// "document" element with no UA rule, which would otherwise be inline.)
+		computedStyle.display = .block
+		resolveChildStyles(resolver: resolver, rootFontSize: computedStyle.fontSize)
+	}
 
-		// Sibling links are now complete, so styles (and :first-child etc.) resolve
+	private func resolveChildStyles(resolver: StyleResolver, rootFontSize: Double) {
+		// Sibling links are complete, so styles (and :first-child etc.) resolve
 		// correctly. Resolve children, then recurse.
 		for child in elementChildren {
 			child.computedStyle = resolver.style(for: child, inheriting: computedStyle, rootFontSize: rootFontSize)
-			child.buildChildren(resolver: resolver, rootFontSize: rootFontSize)
+			child.resolveChildStyles(resolver: resolver, rootFontSize: rootFontSize)
 		}
 	}
 }
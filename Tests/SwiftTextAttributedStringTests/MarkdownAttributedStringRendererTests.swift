@@ -336,6 +336,18 @@ struct MarkdownAttributedStringRendererTests {
 		let attributed = MarkdownAttributedStringRenderer.convert(document: document)
 		#expect(attributed.runs.allSatisfy { $0[SwiftTextMarkdownAttributes.FootnoteReference.self] == nil })
 	}
+
+	@Test func lazyBlocksJoinToTheEagerResult() {
+		let markdown = "# Title\n\nBody[^1] with *emphasis*.\n\n- one\n- two\n\n[^1]: The note."
+		let blocks = MarkdownAttributedStringRenderer.convertLazily(markdown)
+		// Heading, paragraph, list, and the footnote definition.
+		#expect(blocks.count == 4)
+		#expect(wholeString(blocks[0]) == "Title")
+
+		var joined = AttributedString()
+		for block in blocks { joined.append(block) }
+		#expect(joined == render(markdown))
+	}
 }
 
 #endif
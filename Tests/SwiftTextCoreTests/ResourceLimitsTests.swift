@@ -0,0 +1,34 @@
+import Foundation
+import SwiftTextCore
+import Testing
+
+struct ResourceLimitsTests {
+	@Test
+	func chargesUpToTheLimitThenThrows() throws {
+		let budget = ResourceBudget(ResourceLimits(maxObjects: 3))
+		try budget.charge(.objects, 2)
+		try budget.charge(.objects)
+		#expect(budget.remaining(.objects) == 0)
+		#expect(throws: ResourceLimitError.limitExceeded(.objects, limit: 3)) {
+			try budget.charge(.objects)
+		}
+	}
+
+	@Test
+	func unboundedResourcesAreNotTallied() throws {
+		let budget = ResourceBudget(.unlimited)
+		try budget.charge(.decompressedBytes, Int.max / 2)
+		try budget.charge(.decompressedBytes, Int.max / 2)
+		#expect(budget.usage(of: .decompressedBytes) == 0)
+		#expect(budget.remaining(.decompressedBytes) == .max)
+	}
+
+	@Test
+	func expiredDeadlineThrows() throws {
+		let budget = ResourceBudget(ResourceLimits(deadline: Date(timeIntervalSinceNow: -1)))
+		#expect(throws: ResourceLimitError.deadlineExceeded) {
+			try budget.checkDeadline()
+		}
+		try ResourceBudget(ResourceLimits(deadline: .distantFuture)).checkDeadline()
+	}
+}
@@ -50,4 +50,25 @@ struct UnicodeAbuseSanitizerTests {
 
 		#expect(result.text == "Alert: ⚠️")
 	}
+
+	@Test
+	func returnsPlainASCIIUnchanged() {
+		let source = String(repeating: "Plain ASCII paragraph, line one.\r\n", count: 8)
+		let result = UnicodeAbuseSanitizer.sanitize(source)
+
+		#expect(result.text == source)
+		#expect(result.report.maxClusterSize == 2)
+		#expect(!result.report.containsAbuse)
+	}
+
+	@Test
+	func normalizesOnlyTheSpansAroundNonASCII() {
+		let prefix = String(repeating: "x", count: 40)
+		let source = "\(prefix) Cafe\u{0301} na\u{00EF}ve \(prefix)\u{202E}!"
+		let result = UnicodeAbuseSanitizer.sanitize(source)
+
+		#expect(result.text == "\(prefix) Caf\u{00E9} na\u{00EF}ve \(prefix)!")
+		#expect(result.report.maxClusterSize == 2)
+		#expect(result.report.hasBidiOverrides)
+	}
 }
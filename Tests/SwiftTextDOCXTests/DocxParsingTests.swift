@@ -1,4 +1,5 @@
 import Foundation
+import SwiftTextCore
 import Testing
 
 @testable import SwiftTextDOCX
@@ -36,3 +37,53 @@ struct DocxParsingTests {
 		#expect(paragraphs == expected)
 	}
 }
+
+@Suite("DOCX Events")
+struct DocxEventTests {
+	@Test("Streams headings and list items while parsing")
+	func streamsStylesDocument() throws {
+		let url = try #require(
+			Bundle.module.url(
+				forResource: "Styles",
+				withExtension: "docx"
+			)
+		)
+
+		var blocks = [String]()
+		var text = ""
+		try DocxFile.events(url: url) { event in
+			switch event {
+			case .beginHeading(let level):
+				text = String(repeating: "#", count: level) + " "
+			case .beginListItem(_, let ordered):
+				text = ordered ? "ol " : "ul "
+			case .beginParagraph:
+				text = ""
+			case .text(let string, _):
+				text += string
+			case .endHeading, .endListItem, .endParagraph:
+				blocks.append(text)
+			default:
+				break
+			}
+		}
+
+		let expected = [
+			"# Title",
+			"## Subtitle",
+			"# Heading",
+			"## Heading 2",
+			"### Subheading",
+			"Normal body text",
+			"A bullet list",
+			"ul One",
+			"ul Two",
+			"ul Three",
+			"A numbered list",
+			"ol One",
+			"ol Two",
+			"ol Three"
+		]
+		#expect(blocks == expected)
+	}
+}
@@ -3,6 +3,7 @@
 
 import Foundation
 import Testing
+import SwiftTextCore
 @testable import SwiftTextEPUB
 
 @Suite("Markdown → EPUB")
@@ -206,4 +207,55 @@ struct EpubTests {
 		let b = try MarkdownToEpub.makeData(markdown, metadata: metadata, options: EpubOptions())
 		#expect(a == b)
 	}
+
+	@Test("an event stream builds the same package as its Markdown")
+	func eventStreamMatchesMarkdown() throws {
+		let markdown = """
+		Opening words.
+
+		# One
+
+		Some **bold** text.
+
+		> Quoted.
+
+		# Two
+
+		- First
+		- Second
+		"""
+		let events: [DocumentEvent] = [
+			.beginParagraph, .text("Opening words.", .plain), .endParagraph,
+			.beginHeading(level: 1), .text("One", .plain), .endHeading,
+			.beginParagraph,
+			.text("Some ", .plain), .text("bold", DocumentTextStyle(bold: true)), .text(" text.", .plain),
+			.endParagraph,
+			.beginBlockQuote, .beginParagraph, .text("Quoted.", .plain), .endParagraph, .endBlockQuote,
+			.beginHeading(level: 1), .text("Two", .plain), .endHeading,
+			.beginListItem(level: 0, ordered: false), .text("First", .plain), .endListItem,
+			.beginListItem(level: 0, ordered: false), .text("Second", .plain), .endListItem
+		]
+		let writer = EpubEventWriter(metadata: fixedMetadata())
+		for event in events { try writer.consume(event) }
+		try writer.finish()
+		let streamed = try #require(writer.files)
+		let built = MarkdownToEpub.makeFiles(markdown, metadata: fixedMetadata(), options: EpubOptions())
+
+		#expect(streamed.map(\.path) == built.map(\.path))
+		#expect(string(file(streamed, "OEBPS/nav.xhtml")) == string(file(built, "OEBPS/nav.xhtml")))
+		for chapter in built.map(\.path) where chapter.hasPrefix("OEBPS/text/") {
+			let xhtml = string(file(streamed, chapter))
+			expectWellFormedXML(xhtml, chapter)
+			#expect(Self.visibleText(xhtml) == Self.visibleText(string(file(built, chapter))))
+		}
+	}
+
+	/// A chapter's text with markup removed and whitespace collapsed, so the two
+	/// serializers can differ in layout but not in content.
+	private static func visibleText(_ xhtml: String) -> String {
+		xhtml
+			.replacingOccurrences(of: "<[^>]*>", with: " ", options: .regularExpression)
+			.split(whereSeparator: \.isWhitespace)
+			.joined(separator: " ")
+	}
 }
@@ -0,0 +1,30 @@
+import Foundation
+import SwiftTextHTML
+import Testing
+
+@Test
+func htmlRewritesBogusLegacyCharsetForUTF8Bytes() async throws {
+	let html = """
+	<html><head><meta http-equiv="Content-Type" content="text/html; charset=ISO-8859-1"></head>
+	<body><p>Grüße für dich</p></body></html>
+	"""
+	let document = try await HTMLDocument(data: Data(html.utf8), baseURL: nil)
+	#expect(document.text().contains("Grüße für dich"))
+}
+
+@Test
+func htmlDecodesLegacyBytesWithDeclaredCharset() async throws {
+	// "ü" is 0xFC and "€" is 0x80 in windows-1252; neither byte is valid UTF-8 on its own.
+	var bytes = Data("<html><head><meta charset='windows-1252'></head><body><p>f".utf8)
+	bytes.append(contentsOf: [0xFC, 0x72, 0x20, 0x80, 0x35])
+	bytes.append(contentsOf: "</p></body></html>".utf8)
+	let document = try await HTMLDocument(data: bytes, baseURL: nil)
+	#expect(document.text().contains("für €5"))
+}
+
+@Test
+func charsetLabelsNormalizeWithoutCaseOrPunctuation() {
+	#expect(stringEncoding(for: " Latin_1 ") == .isoLatin1)
+	#expect(stringEncoding(for: "\"UTF-8\"") == .utf8)
+	#expect(stringEncoding(for: "Windows-1252") == .windowsCP1252)
+}
@@ -0,0 +1,94 @@
+import Foundation
+import SwiftTextCore
+import SwiftTextHTML
+import Testing
+
+/// Compares `DomBuilder.events` with the DOM built from the same page: the event
+/// stream must carry the same text, in the same order, with the same headings.
+@Suite("HTML event stream")
+struct HTMLEventStreamTests {
+	static let page = """
+	<html>
+	<head><title>Ignored</title><style>p { color: red }</style></head>
+	<body>
+	<h1>Quarterly <em>Review</em></h1>
+	<p>Revenue is up <b>twelve</b> percent, see <a href="https://example.com/r">the report</a>.</p>
+	<h2>Plans</h2>
+	<ul>
+	<li>Hire two engineers</li>
+	<li>Ship the <code>v2</code> reader</li>
+	</ul>
+	<blockquote><p>Keep it simple.</p></blockquote>
+	<table>
+	<tr><th>Region</th> <th>Growth</th></tr>
+	<tr><td>North</td> <td>8%</td></tr>
+	</table>
+	<pre>let x = 1</pre>
+	<script>var ignored = true;</script>
+	</body>
+	</html>
+	"""
+
+	@Test("Events carry the DOM's text and headings", arguments: [HTMLParsingBackend.libxml2, .native])
+	func eventsMatchDOM(backend: HTMLParsingBackend) async throws {
+		let data = Data(Self.page.utf8)
+		var events = [DocumentEvent]()
+		try await DomBuilder.events(html: data, baseURL: nil, backend: backend) { events.append($0) }
+		let document = try await HTMLDocument(data: data, backend: backend)
+
+		#expect(Self.words(of: events) == Self.words(of: document.text()))
+		#expect(Self.headings(in: events) == ["1 Quarterly Review", "2 Plans"])
+		#expect(Self.headings(in: events) == Self.headings(in: document.root))
+	}
+
+	/// The text runs as words; every structural event separates words.
+	private static func words(of events: [DocumentEvent]) -> [String] {
+		var text = ""
+		for event in events {
+			if case .text(let string, _) = event {
+				text += string
+			} else {
+				text += " "
+			}
+		}
+		return words(of: text)
+	}
+
+	/// Whitespace-separated words, without the DOM's ` | ` table-cell separators.
+	private static func words(of text: String) -> [String] {
+		text.split(whereSeparator: \.isWhitespace).map(String.init).filter { $0 != "|" }
+	}
+
+	private static func headings(in events: [DocumentEvent]) -> [String] {
+		var headings = [String]()
+		var current: String?
+		for event in events {
+			switch event {
+			case .beginHeading(let level):
+				current = "\(level) "
+			case .text(let string, _) where current != nil:
+				current? += string
+			case .endHeading:
+				if let current { headings.append(current) }
+				current = nil
+			default:
+				break
+			}
+		}
+		return headings
+	}
+
+	private static func headings(in element: DOMElement) -> [String] {
+		var headings = [String]()
+		if element.name.count == 2, element.name.hasPrefix("h"), let level = Int(element.name.dropFirst()) {
+			let text = words(of: element.text()).joined(separator: " ")
+			headings.append("\(level) \(text)")
+		}
+		for child in element.children {
+			if let child = child as? DOMElement {
+				headings += Self.headings(in: child)
+			}
+		}
+		return headings
+	}
+}
@@ -0,0 +1,80 @@
+import Foundation
+@testable import SwiftTextHTML
+import Testing
+
+@Suite("Native HTML tokenizer")
+struct HTMLTokenizerTests {
+	@Test
+	func impliesDocumentStructureAndClosesParagraphs() {
+		let tokens = HTMLTokenizer(utf8: Data("<P class=lead>one<p>two &amp; three".utf8)).map(describe)
+		#expect(tokens == [
+			"<html>", "<body>", "<p class=lead>", "one", "</p>",
+			"<p>", "two & three", "</p>", "</body>", "</html>",
+		])
+	}
+
+	@Test
+	func keepsRawTextAndAttributeQueries() {
+		let html = """
+		<html><head><style>p > a { color: red }</style></head>
+		<body><a href="/x?a=1&copy=2&amp;b=3">&copy; 2025 &#x263A;</a><br/><li>a<li>b</body></html>
+		"""
+		let tokens = HTMLTokenizer(utf8: Data(html.utf8)).map(describe)
+		#expect(tokens.contains("raw:p > a { color: red }"))
+		#expect(tokens.contains("<a href=/x?a=1&copy=2&b=3>"))
+		#expect(tokens.contains("© 2025 ☺"))
+		#expect(tokens.contains(where: { $0 == "<br>" }))
+		let items = tokens.drop(while: { $0 != "<li>" })
+		#expect(Array(items.prefix(6)) == ["<li>", "a", "</li>", "<li>", "b", "</li>"])
+	}
+
+	@Test
+	func nativeBackendMatchesLibxmlMarkdown() async throws {
+		let html = """
+		<!DOCTYPE html>
+		<html><head><title>Report</title><meta charset="utf-8"></head>
+		<body>
+		<h1>Quarterly &ndash; summary</h1>
+		<p>Revenue grew <b>12%</b> in <a href="https://example.com/q3">Q3</a>.
+		<ul><li>North<li>South</ul>
+		<table><tr><th>Region<th>Total<tr><td>North<td>5</table>
+		<!-- generated -->
+		</body></html>
+		"""
+		let data = Data(html.utf8)
+		let libxml = try await HTMLDocument(data: data).markdown()
+		let native = try await HTMLDocument(data: data, backend: .native).markdown()
+		#expect(native == libxml)
+	}
+
+	@Test
+	func capsNestingDepthLikeLibxml() async throws {
+		let depth = 100_000
+		let html = String(repeating: "<div>", count: depth) + "deep" + String(repeating: "</div>", count: depth) + "<p>after"
+		let tokens = HTMLTokenizer(utf8: Data(html.utf8)).map(describe)
+		// `html` and `body` take two of the open slots.
+		#expect(tokens.filter { $0 == "<div>" }.count == HTMLTokenizer.maximumDepth - 2)
+		#expect(tokens.filter { $0 == "</div>" }.count == HTMLTokenizer.maximumDepth - 2)
+		#expect(tokens.suffix(5) == ["<p>", "after", "</p>", "</body>", "</html>"])
+
+		let markdown = try await HTMLDocument(data: Data(html.utf8), backend: .native).markdown()
+		#expect(markdown.contains("deep"))
+		#expect(markdown.contains("after"))
+	}
+
+	private func describe(_ token: HTMLToken) -> String {
+		switch token {
+		case let .startElement(name, attributes):
+			let pairs = attributes.sorted { $0.key < $1.key }.map { " \($0.key)=\($0.value)" }
+			return "<\(name)\(pairs.joined())>"
+		case let .endElement(name):
+			return "</\(name)>"
+		case let .characters(text):
+			return text
+		case let .rawText(text):
+			return "raw:\(text)"
+		case let .comment(text):
+			return "<!--\(text)-->"
+		}
+	}
+}
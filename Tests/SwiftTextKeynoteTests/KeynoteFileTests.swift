@@ -1,7 +1,9 @@
 import Foundation
 import Testing
 
-import SwiftTextKeynote
+import SwiftTextCore
+import SwiftTextIWA
+@testable import SwiftTextKeynote
 
 /// Exercises the Keynote reader against `Sample.key`, a clean two-slide deck authored
 /// in Keynote (titles + bulleted bodies). It pins deck-slide navigation (content slides
@@ -46,4 +48,66 @@ struct KeynoteFileTests {
 		#expect(decoded.slides.count == 2)
 		#expect(decoded.slides.first?.title == "Quarterly Review")
 	}
+
+	@Test("Titles-only reading skips body and notes")
+	func titlesOnlySkipsBodyAndNotes() throws {
+		let url = try #require(Bundle.module.url(forResource: "Sample", withExtension: "key"))
+		let slides = try KeynoteFile(url: url, titlesOnly: true).document.slides
+		#expect(slides.map(\.title) == ["Quarterly Review", "Next Steps"])
+		#expect(slides.allSatisfy { $0.body.isEmpty && $0.notes == nil })
+	}
+
+	@Test("Streaming events match the parsed deck's events")
+	func streamedEventsMatchDocument() throws {
+		let url = try #require(Bundle.module.url(forResource: "Sample", withExtension: "key"))
+		var streamed = [DocumentEvent]()
+		try KeynoteFile.events(url: url) { streamed.append($0) }
+		var parsed = [DocumentEvent]()
+		try KeynoteFile(url: url).document.events { parsed.append($0) }
+
+		#expect(streamed.filter { $0 == .beginHeading(level: 2) }.count == 2)
+		#expect(streamed == parsed)
+
+		var titles = [DocumentEvent]()
+		try KeynoteFile.events(url: url, titlesOnly: true) { titles.append($0) }
+		var parsedTitles = [DocumentEvent]()
+		try KeynoteFile(url: url, titlesOnly: true).document.events { parsedTitles.append($0) }
+		#expect(titles == parsedTitles)
+	}
+
+	@Test("On-demand slide loading matches reading every component")
+	func lazyLoadingMatchesWholeDocument() throws {
+		let url = try #require(Bundle.module.url(forResource: "Sample", withExtension: "key"))
+		let entries = try IWAContainer.entries(at: url, prefix: "Index/", suffix: ".iwa")
+		var store = IWAObjectStore()
+		for entry in entries {
+			for object in try IWAArchive.objects(from: entry.data) { store.add(object) }
+		}
+		let whole = KeynoteParser.buildDocument(from: store)
+
+		// What inflating just the index and the slides' own components costs, and
+		// what inflating every component (the theme's templates included) costs.
+		let lazyPaths = Set(entries.map(\.path).filter {
+			$0 == "Index/Document.iwa" || $0 == "Index/Metadata.iwa" || $0.hasPrefix("Index/Slide")
+		})
+		let lazyCost = try Self.decompressedBytes(of: url, paths: lazyPaths)
+		let wholeCost = try Self.decompressedBytes(of: url, paths: Set(entries.map(\.path)))
+		#expect(lazyCost < wholeCost)
+
+		// A budget that only covers the on-demand components still reads the deck.
+		let lazy = try KeynoteParser().readDocument(from: url, limits: ResourceLimits(maxDecompressedBytes: lazyCost))
+		#expect(lazy.slides.count == 2)
+		#expect(lazy.slides.map(\.title) == whole.slides.map(\.title))
+		#expect(lazy.slides.map(\.body) == whole.slides.map(\.body))
+		#expect(lazy.slides.map(\.notes) == whole.slides.map(\.notes))
+	}
+
+	/// Bytes charged to a budget for unzipping and Snappy-decoding `paths`.
+	private static func decompressedBytes(of url: URL, paths: Set<String>) throws -> Int {
+		let budget = ResourceBudget(ResourceLimits(maxDecompressedBytes: Int.max))
+		for entry in try IWAContainer.entries(at: url, paths: paths, budget: budget) {
+			_ = try IWAArchive.objects(from: entry.data, budget: budget)
+		}
+		return budget.usage(of: .decompressedBytes)
+	}
 }
@@ -0,0 +1,103 @@
+import Testing
+import SwiftTextCore
+@testable import SwiftTextMarkdown
+
+@Suite("DocumentEvent writers")
+struct DocumentEventWriterTests {
+
+	private func markdown(_ events: [DocumentEvent]) throws -> String {
+		var writer = MarkdownEventWriter()
+		for event in events { try writer.consume(event) }
+		try writer.finish()
+		return writer.output
+	}
+
+	private func html(_ events: [DocumentEvent]) throws -> String {
+		var writer = HTMLEventWriter()
+		for event in events { try writer.consume(event) }
+		try writer.finish()
+		return writer.output
+	}
+
+	@Test func markdownBlocksListsAndFootnotes() throws {
+		var bold = DocumentTextStyle.plain
+		bold.bold = true
+		let output = try markdown([
+			.beginHeading(level: 1), .text("Title", .plain), .endHeading,
+			.beginParagraph, .text("Some ", .plain), .text("bold", bold), .text(" text", .plain),
+			.footnoteReference(1), .endParagraph,
+			.beginListItem(level: 0, ordered: false), .text("a", .plain), .endListItem,
+			.beginListItem(level: 1, ordered: true), .text("b", .plain), .endListItem,
+			.beginListItem(level: 1, ordered: true), .text("c", .plain), .endListItem,
+			.footnote(number: 1, text: "Note"),
+		])
+		#expect(output == "# Title\n\nSome **bold** text[^1]\n\n- a\n  1. b\n  2. c\n\n[^1]: Note")
+	}
+
+	@Test func markdownBlockQuote() throws {
+		let output = try markdown([
+			.beginBlockQuote,
+			.beginParagraph, .text("quoted", .plain), .endParagraph,
+			.beginParagraph, .text("more", .plain), .endParagraph,
+			.endBlockQuote,
+		])
+		#expect(output == "> quoted\n>\n> more")
+	}
+
+	@Test func markdownTableEscapesPipes() throws {
+		let output = try markdown([
+			.beginTable(alignments: [.left, .right]),
+			.beginTableRow(header: true),
+			.beginTableCell, .text("A", .plain), .endTableCell,
+			.beginTableCell, .text("B", .plain), .endTableCell,
+			.endTableRow,
+			.beginTableRow(header: false),
+			.beginTableCell, .text("1", .plain), .endTableCell,
+			.beginTableCell, .text("2|3", .plain), .endTableCell,
+			.endTableRow,
+			.endTable,
+		])
+		#expect(output == "| A | B |\n| --- | --: |\n| 1 | 2\\|3 |")
+	}
+
+	@Test func htmlNestsFlatListItems() throws {
+		var link = DocumentTextStyle.plain
+		link.link = "https://e.com"
+		let output = try html([
+			.beginHeading(level: 2), .text("Hi", .plain), .endHeading,
+			.beginParagraph, .text("x ", .plain), .text("link", link), .endParagraph,
+			.beginListItem(level: 0, ordered: false), .text("one", .plain), .endListItem,
+			.beginListItem(level: 1, ordered: false), .text("two", .plain), .endListItem,
+			.beginListItem(level: 0, ordered: false), .text("three", .plain), .endListItem,
+		])
+		#expect(output == "<h2>Hi</h2>\n<p>x <a href=\"https://e.com\">link</a></p>\n"
+			+ "<ul><li>one<ul><li>two</li></ul></li><li>three</li></ul>")
+	}
+
+	@Test func htmlFootnotesMatchFootnoteRenderer() throws {
+		let output = try html([
+			.beginParagraph, .text("A", .plain), .footnoteReference(1), .footnoteReference(1), .endParagraph,
+			.footnote(number: 1, text: "N"),
+		])
+		#expect(output == "<p>A<sup><a href=\"#fn-1\" id=\"ref-1\">[1]</a></sup>"
+			+ "<sup><a href=\"#fn-1\" id=\"ref-1-2\">[1]</a></sup></p>\n"
+			+ "<div class=\"footnote-definition\" id=\"fn-1\"><strong>[1]:</strong> N</div>")
+	}
+
+	@Test func htmlTableSections() throws {
+		let output = try html([
+			.beginTable(alignments: [.left, .center]),
+			.beginTableRow(header: true),
+			.beginTableCell, .text("A", .plain), .endTableCell,
+			.beginTableCell, .text("B", .plain), .endTableCell,
+			.endTableRow,
+			.beginTableRow(header: false),
+			.beginTableCell, .text("1", .plain), .endTableCell,
+			.beginTableCell, .text("2", .plain), .endTableCell,
+			.endTableRow,
+			.endTable,
+		])
+		#expect(output == "<table>\n<thead><tr><th>A</th><th style=\"text-align: center;\">B</th></tr></thead>\n"
+			+ "<tbody>\n<tr><td>1</td><td style=\"text-align: center;\">2</td></tr>\n</tbody></table>")
+	}
+}
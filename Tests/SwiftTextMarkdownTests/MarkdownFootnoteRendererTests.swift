@@ -1,3 +1,4 @@
+import Foundation
 import Testing
 @testable import SwiftTextMarkdown
 
@@ -111,4 +112,40 @@ struct MarkdownFootnoteRendererTests {
 		#expect(html.contains("<div class=\"x\">raw</div>"))
 		#expect(html.contains("<div class=\"footnote-definition\" id=\"fn-1\"><strong>[1]:</strong> Note</div>"))
 	}
+
+	@Test func streamedOutputMatchesConvert() {
+		let input = "One[^a], two[^b] and one again[^a].\n\n[^b]: B cites[^a].\n[^a]: A note."
+		var streamed = ""
+		MarkdownFootnoteRenderer.write(input, to: &streamed)
+		#expect(streamed == MarkdownFootnoteRenderer.convert(input))
+		// Anchor ids follow output order: body references first, then the one
+		// inside definition 2.
+		#expect(streamed.contains("again<sup><a href=\"#fn-1\" id=\"ref-1-2\">[1]</a></sup>"))
+		#expect(streamed.contains("<strong>[2]:</strong> B cites<sup><a href=\"#fn-1\" id=\"ref-1-3\">[1]</a></sup>.</div>"))
+	}
+
+	@Test func longDefinitionChainDefinedInReverse() {
+		// Each note cites the next, and the source lists them last-first, so
+		// every definition is only reachable through the one before it.
+		let count = 300
+		var input = "Start[^n1].\n\n"
+		for index in stride(from: count, through: 1, by: -1) {
+			input += index < count ? "[^n\(index)]: Note \(index)[^n\(index + 1)].\n" : "[^n\(index)]: Last.\n"
+		}
+		let html = MarkdownFootnoteRenderer.convert(input)
+		let definitions = html.components(separatedBy: "<div class=\"footnote-definition\"").dropFirst()
+		#expect(definitions.count == count)
+		#expect(html.contains("id=\"fn-1\"><strong>[1]:</strong> Note 1<sup><a href=\"#fn-2\" id=\"ref-2\">[2]</a></sup>.</div>"))
+		#expect(html.hasSuffix("id=\"fn-\(count)\"><strong>[\(count)]:</strong> Last.</div>"))
+
+		let resolver = MarkdownFootnoteResolver(definitionIDs: (1...count).map { "n\($0)" })
+		_ = resolver.resolve("Start[^n1].")
+		var visited: [Int] = []
+		let parsed = MarkdownFootnoteParser.extractDefinitions(from: input).definitions
+		resolver.forEachReferencedDefinition(in: parsed) { number, definition in
+			visited.append(number)
+			_ = resolver.resolve(definition.body)
+		}
+		#expect(visited == Array(1...count))
+	}
 }
@@ -1,3 +1,4 @@
+import Markdown
 import Testing
 @testable import SwiftTextMarkdown
 
@@ -219,4 +220,21 @@ struct SwiftMarkdownHTMLRendererTests {
 		#expect(html.contains("class=\"language-xml&amp;&lt;&quot;bad\""))
 		#expect(!html.contains("language-xml&<"))
 	}
+
+	@Test func byteLevelEscaping() {
+		#expect(htmlEscaped("plain text", escapingQuotes: true) == "plain text")
+		#expect(htmlEscaped("a<b> & \"c\"", escapingQuotes: false) == "a&lt;b&gt; &amp; \"c\"")
+		#expect(htmlEscaped("a<b> & \"c\"", escapingQuotes: true) == "a&lt;b&gt; &amp; &quot;c&quot;")
+		// Multi-byte scalars, and a prepended scalar that joins the `&` into one
+		// grapheme cluster, survive around the escapes.
+		#expect(htmlEscaped("日本<語>é&\u{0600}&", escapingQuotes: false) == "日本&lt;語&gt;é&amp;\u{0600}&amp;")
+	}
+
+	@Test func streamingWriteMatchesConvert() {
+		let markdown = "# Title\n\nSome *text* & more.\n\n```swift\nlet a = 1 < 2\n\n```\n\n| a | b |\n|---|--:|\n| 1 | 2 |"
+		var streamed = ""
+		SwiftMarkdownHTMLRenderer.write(document: Document(parsing: markdown, options: [.disableSmartOpts]), to: &streamed)
+		#expect(streamed == SwiftMarkdownHTMLRenderer.convert(markdown))
+		#expect(!streamed.hasSuffix("\n"))
+	}
 }
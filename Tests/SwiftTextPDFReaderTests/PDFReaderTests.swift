@@ -0,0 +1,455 @@
+//  PDFReaderTests.swift
+//  SwiftTextPDFReaderTests
+
+import Testing
+import Foundation
+import SwiftTextCore
+import SwiftTextPDFWriter
+@testable import SwiftTextPDFReader
+
+@Suite("PDF Reader")
+struct PDFReaderTests {
+
+	// MARK: - Fixtures
+
+	/// Build a document with one page per content stream, all sharing a
+	/// Helvetica (`/F1`) font resource, the way SwiftTextPDFWriter callers do.
+	private func makePDF(pages contents: [PDFStream], pageExtras: [(String, PDFValue)] = []) -> Data {
+		let pdf = PDF()
+		let font = PDFDictionary([
+			("Type", "/Font"),
+			("Subtype", "/Type1"),
+			("BaseFont", "/Helvetica"),
+			("Encoding", "/WinAnsiEncoding")
+		])
+		pdf.addObject(font)
+		let resources = PDFDictionary([("Font", PDFDictionary([("F1", font.reference)]))])
+		pdf.addObject(resources)
+		for content in contents {
+			pdf.addObject(content)
+			let entries: [(String, PDFValue)] = [
+				("Type", "/Page"),
+				("Parent", pdf.pages.reference),
+				("MediaBox", PDFArray([0, 0, 612, 792])),
+				("Contents", content.reference),
+				("Resources", resources.reference)
+			]
+			pdf.addPage(PDFDictionary(entries + pageExtras))
+		}
+		return pdf.write()
+	}
+
+	private func textStream(_ lines: [(x: Double, y: Double, text: String)], size: Double = 12,
+	                        compressed: Bool = false) -> PDFStream {
+		let stream = PDFStream()
+		stream.compressed = compressed
+		for line in lines {
+			stream.beginText()
+			stream.setFontSize("F1", size)
+			stream.moveTextTo(line.x, line.y)
+			stream.showTextString(line.text)
+			stream.endText()
+		}
+		return stream
+	}
+
+	/// A PDF 1.5 file of `objects` (numbered from 1) indexed by a cross-reference
+	/// stream whose entries are laid out as `/W [1 4 2]`. Objects listed in `compressed` are given as
+	/// members of an object stream instead of by offset.
+	private func xrefStreamPDF(_ objects: [String], compressed: [Int: (stream: Int, index: Int)] = [:],
+	                           widths: String = "[1 4 2]", xrefExtras: String = "") -> Data {
+		var pdf = [UInt8]("%PDF-1.5\n".utf8)
+		var offsets = [Int: Int]()
+		for (index, object) in objects.enumerated() where compressed[index + 1] == nil {
+			offsets[index + 1] = pdf.count
+			pdf += Array("\(index + 1) 0 obj \(object) endobj\n".utf8)
+		}
+		var entries = [UInt8](repeating: 0, count: 7) // object 0: free
+		for number in 1 ... objects.count {
+			let (type, second, third) = compressed[number].map { (UInt8(2), $0.stream, $0.index) }
+				?? (UInt8(1), offsets[number] ?? 0, 0)
+			entries.append(type)
+			entries += (0 ..< 4).reversed().map { UInt8(truncatingIfNeeded: second >> ($0 * 8)) }
+			entries += [UInt8(truncatingIfNeeded: third >> 8), UInt8(truncatingIfNeeded: third)]
+		}
+		let xrefNumber = objects.count + 1
+		let xrefOffset = pdf.count
+		pdf += Array("\(xrefNumber) 0 obj << /Type /XRef /Size \(xrefNumber + 1) /W \(widths) /Root 1 0 R \(xrefExtras) /Length \(entries.count) >> stream\n".utf8)
+		pdf += entries
+		pdf += Array("\nendstream endobj\nstartxref\n\(xrefOffset)\n%%EOF\n".utf8)
+		return Data(pdf)
+	}
+
+	// MARK: - Inflate
+
+	@Test("Inflate decodes what Deflate encodes")
+	func inflateRoundTrips() throws {
+		var content = Data()
+		for index in 0 ..< 500 {
+			content.append(Data("BT /F1 12 Tf 72 \(720 - index) Td (Hello, world) Tj ET\n".utf8))
+		}
+		for round in 0 ..< 20 {
+			for byte in 0 ... 255 { content.append(UInt8((byte * 7 + round) & 0xFF)) }
+		}
+		let zlib = Deflate.zlib(content)
+		#expect(try Inflate.zlib([UInt8](zlib)) == [UInt8](content))
+		#expect(try Inflate.zlib([UInt8](Deflate.zlib(Data()))) == [])
+	}
+
+	@Test("Inflate reads stored blocks")
+	func inflateStored() throws {
+		// zlib header, then a final stored block holding "abc".
+		let stored: [UInt8] = [0x78, 0x01, 0x01, 0x03, 0x00, 0xFC, 0xFF, 0x61, 0x62, 0x63]
+		#expect(try Inflate.zlib(stored) == Array("abc".utf8))
+	}
+
+	@Test("Inflate stops a flate bomb at the output limit")
+	func inflateOutputLimit() throws {
+		// A megabyte of spaces deflates to about a kilobyte.
+		let bomb = [UInt8](Deflate.zlib(Data(repeating: 0x20, count: 1 << 20)))
+		#expect(throws: Inflate.Error.outputLimitExceeded) { try Inflate.zlib(bomb, limit: 4096) }
+		#expect(try Inflate.zlib(bomb).count == 1 << 20)
+
+		let page = textStream((0 ..< 200).map { (x: 72.0, y: 740 - Double($0 % 50) * 14, text: "Line \($0)") }, compressed: true)
+		let reader = try PDFTextReader(data: makePDF(pages: [page]), limits: ResourceLimits(maxDecompressedBytes: 1000))
+		#expect(throws: ResourceLimitError.limitExceeded(.decompressedBytes, limit: 1000)) {
+			try reader.textLines(page: 0)
+		}
+	}
+
+	@Test("LZW and RunLength stop at the output limit while decoding")
+	func lzwAndRunLengthOutputLimit() throws {
+		// Each pair repeats "A" 128 times.
+		let runs: [UInt8] = (0 ..< 200).map { $0 % 2 == 0 ? 0x81 : 0x41 }
+		#expect(try PDFFilters.runLength(runs).count == 100 * 128)
+		#expect(throws: PDFFilters.Error.self) { try PDFFilters.runLength(runs, limit: 1000) }
+
+		// 9-bit codes: 65 ("A"), then 258, 259, … — each repeats one more "A".
+		var codes = [65] + Array(258 ..< 500)
+		codes.append(257)
+		var lzw = [UInt8](), buffer = 0, bits = 0
+		for code in codes {
+			buffer = buffer << 9 | code
+			bits += 9
+			while bits >= 8 {
+				lzw.append(UInt8(truncatingIfNeeded: buffer >> (bits - 8)))
+				bits -= 8
+			}
+		}
+		if bits > 0 { lzw.append(UInt8(truncatingIfNeeded: buffer << (8 - bits))) }
+		#expect(try PDFFilters.lzw(lzw, earlyChange: false).allSatisfy { $0 == 0x41 })
+		#expect(throws: PDFFilters.Error.self) { try PDFFilters.lzw(lzw, earlyChange: false, limit: 1000) }
+	}
+
+	@Test("Nested forms drawn many times over are charged on every drawing")
+	func formFanOutIsBudgeted() throws {
+		// Eight levels of forms, each drawing the next ten times: 10⁸ drawings.
+		var objects = ["<< /Type /Catalog /Pages 2 0 R >>", "<< /Type /Pages /Kids [3 0 R] /Count 1 >>",
+		               "<< /Type /Page /MediaBox [0 0 612 792] /Contents 4 0 R /Resources << /XObject << /X 5 0 R >> >> >>"]
+		func stream(_ dictionary: String, _ content: String) -> String {
+			"<< \(dictionary) /Length \(content.utf8.count) >> stream\n\(content)\nendstream"
+		}
+		objects.append(stream("", "/X Do"))
+		for level in 5 ... 12 {
+			let content = level == 12 ? "BT ET" : Array(repeating: "/X Do", count: 10).joined(separator: " ")
+			objects.append(stream("/Type /XObject /Subtype /Form /BBox [0 0 1 1] /Resources << /XObject << /X \(level + 1) 0 R >> >>",
+			                      content))
+		}
+		var pdf = "%PDF-1.4\n"
+		for (index, object) in objects.enumerated() { pdf += "\(index + 1) 0 obj \(object) endobj\n" }
+		pdf += "trailer << /Root 1 0 R >>\n%%EOF\n"
+
+		let reader = try PDFTextReader(data: Data(pdf.utf8), limits: ResourceLimits(maxDecompressedBytes: 100_000))
+		#expect(throws: ResourceLimitError.limitExceeded(.decompressedBytes, limit: 100_000)) {
+			try reader.textLines(page: 0)
+		}
+	}
+
+	// MARK: - Text extraction
+
+	@Test("Extracts positioned text from a base-14 font")
+	func extractsHelveticaText() throws {
+		let data = makePDF(pages: [textStream([(72, 720, "Hello, PDF!")], size: 24)])
+		let reader = try PDFTextReader(data: data)
+		#expect(reader.pageCount == 1)
+		#expect(try reader.pageSize(at: 0) == CGSize(width: 612, height: 792))
+
+		let lines = try reader.textLines(page: 0)
+		let line = try #require(lines.first)
+		#expect(lines.count == 1)
+		#expect(line.combinedText == "Hello, PDF!")
+
+		// Top-left origin: the baseline at y = 720 sits 72 pt below the top edge,
+		// and the fragment spans the font's ascent above it.
+		let bounds = try #require(line.fragments.first?.bounds)
+		#expect(abs(bounds.minX - 72) < 0.01)
+		#expect(abs(bounds.maxY - (72 + 24 * 0.25)) < 0.5)
+		#expect(abs(bounds.minY - (72 - 24 * 0.75)) < 0.5)
+		// Helvetica advances from the built-in metrics: "Hello, PDF!" is 5.112 em.
+		#expect(abs(bounds.width - 24 * 5.112) < 0.5)
+	}
+
+	@Test("Lines come back top to bottom and columns stay separate fragments")
+	func linesAndColumns() throws {
+		let stream = textStream([
+			(72, 600, "Second line"),
+			(72, 700, "First line"),
+			(350, 700, "Right column")
+		])
+		let lines = try PDFTextReader(data: makePDF(pages: [stream])).textLines(page: 0)
+		#expect(lines.map(\.combinedText) == ["First line\tRight column", "Second line"])
+	}
+
+	@Test("TJ adjustments become spaces only when they are word-sized")
+	func positionedRuns() throws {
+		let stream = PDFStream()
+		stream.beginText()
+		stream.setFontSize("F1", 12)
+		stream.moveTextTo(72, 700)
+		stream.showText(Data("(Ke) 40 (rned) -320 (words)".utf8))
+		stream.endText()
+		let lines = try PDFTextReader(data: makePDF(pages: [stream])).textLines(page: 0)
+		#expect(lines.map(\.combinedText) == ["Kerned words"])
+	}
+
+	@Test("Compressed content streams decode through the in-house inflate")
+	func compressedPages() throws {
+		let pages = (1 ... 3).map { number in
+			textStream((0 ..< 40).map { (x: 72.0, y: 740 - Double($0) * 14, text: "Page \(number) line \($0)") }, compressed: true)
+		}
+		let data = makePDF(pages: pages)
+		#expect(String(decoding: data, as: UTF8.self).contains("/FlateDecode"))
+
+		let perPage = try PDFTextReader(data: data).pageTextLines()
+		#expect(perPage.count == 3)
+		for (index, lines) in perPage.enumerated() {
+			#expect(lines.count == 40)
+			#expect(lines.first?.combinedText == "Page \(index + 1) line 0")
+			#expect(lines.last?.combinedText == "Page \(index + 1) line 39")
+		}
+	}
+
+	@Test("Concurrent extraction keeps page order on a long document")
+	func manyPagesInOrder() throws {
+		let pages = (1 ... 500).map { textStream([(72, 720, "Page \($0)")], compressed: true) }
+		let reader = try PDFTextReader(data: makePDF(pages: pages))
+		#expect(reader.pageCount == 500)
+		let lines = try reader.textLines()
+		#expect(lines.map(\.combinedText) == (1 ... 500).map { "Page \($0)" })
+		#expect(try reader.extractText().hasPrefix("Page 1\n---\nPage 2"))
+	}
+
+	@Test("Identity-H fonts map glyph IDs back to text through ToUnicode")
+	func compositeFontToUnicode() throws {
+		let pdf = PDF()
+		let cmap = PDFStream(stream: [Data("""
+			/CIDInit /ProcSet findresource begin
+			12 dict begin
+			begincmap
+			1 begincodespacerange
+			<0000> <FFFF>
+			endcodespacerange
+			2 beginbfchar
+			<0001> <0048>
+			<0002> <00E9>
+			endbfchar
+			1 beginbfrange
+			<0010> <0012> <0061>
+			endbfrange
+			endcmap
+			CMapName currentdict /CMap defineresource pop
+			end
+			end
+			""".utf8)])
+		pdf.addObject(cmap)
+		let descendant = PDFDictionary([
+			("Type", "/Font"),
+			("Subtype", "/CIDFontType2"),
+			("BaseFont", "/ABCDEF+Example"),
+			("DW", 1000),
+			("W", PDFArray([1, PDFArray([600, 500])]))
+		])
+		pdf.addObject(descendant)
+		let font = PDFDictionary([
+			("Type", "/Font"),
+			("Subtype", "/Type0"),
+			("BaseFont", "/ABCDEF+Example"),
+			("Encoding", "/Identity-H"),
+			("DescendantFonts", PDFArray([descendant.reference])),
+			("ToUnicode", cmap.reference)
+		])
+		pdf.addObject(font)
+
+		let content = PDFStream()
+		content.beginText()
+		content.setFontSize("F2", 20)
+		content.moveTextTo(100, 500)
+		content.showHexString(Data([0x00, 0x01, 0x00, 0x02, 0x00, 0x10, 0x00, 0x11, 0x00, 0x12]))
+		content.endText()
+		pdf.addObject(content)
+		let page = PDFDictionary([
+			("Type", "/Page"),
+			("Parent", pdf.pages.reference),
+			("MediaBox", PDFArray([0, 0, 612, 792])),
+			("Contents", content.reference),
+			("Resources", PDFDictionary([("Font", PDFDictionary([("F2", font.reference)]))]))
+		])
+		pdf.addPage(page)
+
+		let lines = try PDFTextReader(data: pdf.write()).textLines(page: 0)
+		let line = try #require(lines.first)
+		#expect(line.combinedText == "Héabc")
+		// Widths come from /W for CIDs 1–2 and /DW for the rest: 0.6 + 0.5 + 3 × 1 em.
+		let bounds = try #require(line.fragments.first?.bounds)
+		#expect(abs(bounds.width - 20 * 4.1) < 0.5)
+	}
+
+	@Test("Rotated pages report display coordinates")
+	func rotatedPage() throws {
+		let data = makePDF(pages: [textStream([(72, 720, "Sideways")])], pageExtras: [("Rotate", 90)])
+		let reader = try PDFTextReader(data: data)
+		#expect(try reader.pageSize(at: 0) == CGSize(width: 792, height: 612))
+		let line = try #require(try reader.textLines(page: 0).first)
+		#expect(line.combinedText == "Sideways")
+		// Under /Rotate 90 the user-space y becomes the display x.
+		let bounds = try #require(line.fragments.first?.bounds)
+		#expect(bounds.minX > 700)
+	}
+
+	@Test("A damaged cross-reference offset is recovered by scanning")
+	func rebuildsCrossReferences() throws {
+		var data = makePDF(pages: [textStream([(72, 720, "Still readable")])])
+		let marker = Data("startxref\n".utf8)
+		let range = try #require(data.range(of: marker, options: .backwards))
+		data.replaceSubrange(range.upperBound ..< data.count, with: Data("12\n%%EOF\n".utf8))
+		let lines = try PDFTextReader(data: data).textLines(page: 0)
+		#expect(lines.map(\.combinedText) == ["Still readable"])
+	}
+
+	@Test("Self-referencing and deeply nested objects resolve without recursing")
+	func hostileStructure() throws {
+		// No xref, so the store rebuilds; the content stream's /Length is itself.
+		let pdf = """
+		%PDF-1.4
+		1 0 obj << /Type /Catalog /Pages 2 0 R >> endobj
+		2 0 obj << /Type /Pages /Kids [3 0 R] /Count 1 >> endobj
+		3 0 obj << /Type /Page /MediaBox [0 0 612 792] /Contents 4 0 R >> endobj
+		4 0 obj << /Length 4 0 R >> stream
+		BT ET
+		endstream endobj
+		trailer << /Root 1 0 R >>
+		%%EOF
+		"""
+		let reader = try PDFTextReader(data: Data(pdf.utf8))
+		#expect(try reader.textLines(page: 0).isEmpty)
+
+		var lexer = PDFLexer([UInt8](repeating: 0x5B, count: 300_000))
+		#expect(lexer.readObject()?.array != nil)
+	}
+
+	@Test("Integers too large for Int neither wrap nor overflow a /Length")
+	func hostileLengths() throws {
+		var lexer = PDFLexer(Array("99999999999999999999 -99999999999999999999 12.5".utf8))
+		for _ in 0 ..< 2 {
+			guard case .keyword = lexer.nextToken() else { Issue.record("an overflowing integer lexed as a number"); return }
+		}
+		guard case .value(.real(let real)) = lexer.nextToken() else { Issue.record("12.5 didn't lex as a real"); return }
+		#expect(real == 12.5)
+
+		for length in ["99999999999999999999", "\(Int.max)", "-5"] {
+			let pdf = """
+			%PDF-1.4
+			1 0 obj << /Type /Catalog /Pages 2 0 R >> endobj
+			2 0 obj << /Type /Pages /Kids [3 0 R] /Count 1 >> endobj
+			3 0 obj << /Type /Page /MediaBox [0 0 612 792] /Contents 4 0 R >> endobj
+			4 0 obj << /Length \(length) >> stream
+			BT ET
+			endstream endobj
+			trailer << /Root 1 0 R >>
+			%%EOF
+			"""
+			let reader = try PDFTextReader(data: Data(pdf.utf8))
+			#expect(try reader.textLines(page: 0).isEmpty)
+		}
+	}
+
+	@Test("Object streams with hostile /N, /First or offsets resolve to nothing")
+	func hostileObjectStreams() throws {
+		// The page's content stream (4) is the object stream's (5) only member.
+		let pages = ["<< /Type /Catalog /Pages 2 0 R >>", "<< /Type /Pages /Kids [3 0 R] /Count 1 >>",
+		             "<< /Type /Page /MediaBox [0 0 612 792] /Contents 4 0 R >>"]
+		for header in ["/N -1 /First 4", "/N 1 /First -3", "/N 1 /First 9999", "/N 1 /First 0"] {
+			let stream = "<< /Type /ObjStm \(header) /Length 9 >> stream\n4 -20 (x)\nendstream"
+			let data = xrefStreamPDF(pages + ["(x)", stream], compressed: [4: (5, 0)])
+			#expect(try PDFTextReader(data: data).textLines(page: 0).isEmpty)
+		}
+	}
+
+	@Test("Hostile xref widths and subsections are rejected, and the file rebuilt")
+	func hostileCrossReferences() throws {
+		let objects = ["<< /Type /Catalog /Pages 2 0 R >>", "<< /Type /Pages /Kids [3 0 R] /Count 1 >>",
+		               "<< /Type /Page /MediaBox [0 0 612 792] >>"]
+		#expect(try PDFTextReader(data: xrefStreamPDF(objects)).pageCount == 1)
+		for (widths, extras) in [("[1 -1 2]", ""), ("[1 9 2]", ""), ("[1 \(Int.max) 2]", ""),
+		                         ("[1 4 2]", "/Index [\(Int.max - 5) 100]"), ("[1 4 2]", "/Index [0 -4]")] {
+			let data = xrefStreamPDF(objects, widths: widths, xrefExtras: extras)
+			#expect(try PDFTextReader(data: data).pageCount == 1)
+		}
+
+		let table = """
+		%PDF-1.4
+		1 0 obj << /Type /Catalog /Pages 2 0 R >> endobj
+		2 0 obj << /Type /Pages /Kids [3 0 R] /Count 1 >> endobj
+		3 0 obj << /Type /Page /MediaBox [0 0 612 792] >> endobj
+		xref
+		\(Int.max - 5) 100
+		0000000000 65535 f
+		trailer << /Root 1 0 R >>
+		startxref
+		172
+		%%EOF
+		"""
+		#expect(try PDFTextReader(data: Data(table.utf8)).pageCount == 1)
+	}
+
+	@Test("Predictor and /W parameters that would overflow are ignored")
+	func hostileDecodeParameters() throws {
+		let up: [UInt8] = [2, 1, 2, 2, 1, 1]
+		let parameters = { (columns: Int, colors: Int) in
+			PDFDictionaryValue(["Predictor": .integer(12), "Columns": .integer(columns), "Colors": .integer(colors)])
+		}
+		#expect(PDFFilters.applyPredictor(up, parameters: parameters(2, 1)) == [1, 2, 2, 3])
+		#expect(PDFFilters.applyPredictor(up, parameters: parameters(Int.max, 3)) == up)
+		#expect(PDFFilters.applyPredictor(up, parameters: parameters(1 << 40, 1)).count <= up.count)
+
+		let pdf = """
+		%PDF-1.4
+		1 0 obj << /Type /Catalog /Pages 2 0 R >> endobj
+		2 0 obj << /Type /Pages /Kids [3 0 R] /Count 1 >> endobj
+		3 0 obj << /Type /Page /MediaBox [0 0 612 792] /Contents 4 0 R /Resources << /Font << /F1 5 0 R >> >> >> endobj
+		4 0 obj << /Length 35 >> stream
+		BT /F1 12 Tf 72 720 Td <0041> Tj ET
+		endstream endobj
+		5 0 obj << /Type /Font /Subtype /Type0 /BaseFont /X /Encoding /Identity-H /DescendantFonts [6 0 R] >> endobj
+		6 0 obj << /Type /Font /Subtype /CIDFontType2 /BaseFont /X /W [\(Int.max) [500 500] \(Int.min) \(Int.max) 500] >> endobj
+		trailer << /Root 1 0 R >>
+		%%EOF
+		"""
+		_ = try PDFTextReader(data: Data(pdf.utf8)).textLines(page: 0)
+	}
+
+	@Test("Non-PDF input and bad page indexes throw")
+	func errors() throws {
+		#expect(throws: PDFReaderError.self) { try PDFTextReader(data: Data("hello".utf8)) }
+		let reader = try PDFTextReader(data: makePDF(pages: [textStream([(72, 720, "x")])]))
+		#expect(throws: PDFReaderError.self) { try reader.textLines(page: 1) }
+	}
+
+	@Test("maxPages rejects documents with too many pages")
+	func pageLimit() throws {
+		let data = makePDF(pages: (1 ... 3).map { textStream([(72, 720, "Page \($0)")]) })
+		#expect(throws: ResourceLimitError.limitExceeded(.pages, limit: 2)) {
+			try PDFTextReader(data: data, limits: ResourceLimits(maxPages: 2))
+		}
+	}
+}
@@ -84,6 +84,19 @@ struct PDFWriterTests {
 		#expect(String(decoding: data, as: UTF8.self) == "<feff00e9>")
 	}
 
+	@Test("TJ arrays interleave strings and adjustments")
+	func textArray() {
+		var array = PDFTextArray()
+		array.appendLiteral(Data("a(b".utf8))
+		array.appendAdjustment(-250)
+		array.appendHex(Data([0x00, 0x2A, 0xFF]))
+		let stream = PDFStream()
+		stream.showText(array)
+		stream.showHexString(Data([0x01, 0xAB]))
+		let text = String(decoding: streamBody(of: stream), as: UTF8.self)
+		#expect(text == "[(a\\(b) -250 <002aff>] TJ\n<01ab> Tj")
+	}
+
 	@Test("Indirect objects wrap their body")
 	func indirectRepresentation() {
 		let dict = PDFDictionary([("Type", "/Catalog")])
@@ -159,6 +172,22 @@ struct PDFWriterTests {
 		#endif
 	}
 
+	@Test("Deflate under a cancelled task falls back to literals but stays valid")
+	func deflateUnderCancellation() async {
+		let content = Data(repeating: 0x41, count: 200_000)
+		let zlib = await Task {
+			withUnsafeCurrentTask { $0?.cancel() }
+			return Deflate.zlib(content)
+		}.value
+		// The first 64 KiB are matched before the first poll; the rest is literal.
+		#expect(zlib.count > 100_000)
+		#expect(zlib.count < content.count)
+		#expect(zlib.first == 0x78)
+		#if canImport(Compression)
+		#expect(inflateZlib(zlib, expectedSize: content.count) == content)
+		#endif
+	}
+
 	@Test("An opted-in stream is emitted with /FlateDecode and a correct length")
 	func streamCompresses() {
 		let stream = PDFStream()
@@ -317,6 +346,27 @@ struct PDFWriterTests {
 		#expect(String(decoding: slice, as: UTF8.self) == "xref")
 	}
 
+	@Test("Cross-reference entries point at each object header")
+	func xrefOffsetsPointAtObjects() throws {
+		let pdf = makeHelloPDF()
+		let bytes = pdf.write()
+		let text = String(decoding: bytes, as: UTF8.self)
+		let table = try #require(text.range(of: "xref\n0 \(pdf.objects.count)\n"))
+		let entries = text[table.upperBound...].split(separator: "\n").prefix(pdf.objects.count)
+		for (number, entry) in entries.enumerated() {
+			#expect(entry.count == 19)
+			guard number > 0 else {
+				#expect(entry == "0000000000 65535 f ")
+				continue
+			}
+			let offset = try #require(Int(entry.prefix(10)))
+			let header = Data("\(number) 0 obj\n".utf8)
+			#expect(bytes[offset ..< offset + header.count] == header)
+			// The shared-buffer body matches the object's standalone serialization.
+			#expect(bytes[(offset + header.count)...].starts(with: pdf.objects[number].data))
+		}
+	}
+
 	@Test("Page count is tracked")
 	func pageCount() {
 		let pdf = makeHelloPDF()
@@ -89,6 +89,43 @@ struct IWAGeneratedModelTests {
 		try assertLosslessRoundTrip(at: url, minObjects: 50)
 	}
 
+	@Test("The schema codec keeps typed fields and passes wire mismatches through")
+	func schemaCodecPreservesMismatchedWireTypes() {
+		var writer = ProtobufWriter()
+		writer.varintField(1, 1)                      // model
+		writer.fixed32Field(3, Float(0.5).bitPattern) // r
+		writer.varintField(4, 7)                      // g, but as a varint: not a float
+		writer.varintField(99, 42)                    // not modeled at all
+		let color = TSP_Color(ProtobufMessage(writer.bytes))
+		#expect(color.model == 1)
+		#expect(color.r == 0.5)
+		#expect(color.g == nil)
+		#expect(color.unknownFields.map(\.number) == [4, 99])
+		#expect(TSP_Color.schema.claimedCount(of: ProtobufMessage(writer.bytes).fields) == 2)
+		#expect(Self.canonical(color.encoded()) == Self.canonical(writer.bytes))
+	}
+
+	@Test("In-place appends encode like assigning the whole repeated field")
+	func repeatedAppendsMatchAssignment() {
+		var runs = [TST_StrokeLayerArchive_StrokeRunArchive]()
+		let appended = TST_StrokeLayerArchive()
+		for origin in 0 ..< 3 {
+			let run = TST_StrokeLayerArchive_StrokeRunArchive()
+			run.origin = Int32(origin); run.length = 1
+			runs.append(run)
+			appended.append(strokeRuns: run)
+		}
+		let assigned = TST_StrokeLayerArchive()
+		assigned.strokeRuns = runs
+		#expect(appended.strokeRuns.map(\.origin) == [0, 1, 2])
+		#expect(appended.encoded() == assigned.encoded())
+
+		let state = TST_SummaryModelGroupByChangeStateArchive()
+		state.append(labelRowHeightList: 12)
+		state.append(labelRowHeightList: 18)
+		#expect(state.labelRowHeightList == [12, 18])
+	}
+
 	@Test("Every modeled object in the committed Sample.pages round-trips losslessly")
 	func realDocumentRoundTrips() throws {
 		guard let url = Bundle.module.url(forResource: "Sample", withExtension: "pages") else {
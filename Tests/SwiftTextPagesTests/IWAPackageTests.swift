@@ -28,6 +28,24 @@ struct IWAPackageTests {
 		return c
 	}
 
+	@Test("embedded templates index contiguous byte ranges")
+	func embeddedTemplateRanges() throws {
+		let t = PagesTemplate.blank
+		var end = 0
+		for e in t.entries {
+			#expect(e.range.lowerBound == end)
+			#expect(t.bytes(for: e.path)?.count == e.range.count)
+			end = e.range.upperBound
+		}
+		#expect(t.bytes(for: "Index/Missing.iwa") == nil)
+		#expect(try IWAArchive.objects(from: Data(try #require(t.bytes(for: "Index/Document.iwa")))).isEmpty == false)
+
+		for record in PagesTableTemplate.records {
+			#expect(PagesTableTemplate.record(record.id)?.count == record.range.count)
+		}
+		#expect(try IWAArchive.objects(from: Data(PagesTableTemplate.metadata)).contains { $0.type == 11006 })
+	}
+
 	@Test("verbatim disassemble/reassemble preserves every object")
 	func verbatim() throws {
 		let entries = blankEntries()
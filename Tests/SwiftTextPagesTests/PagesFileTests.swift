@@ -2,6 +2,7 @@ import Foundation
 import Testing
 
 @testable import SwiftTextPages
+import SwiftTextCore
 import SwiftTextIWA
 
 @Suite("PagesFile integration")
@@ -19,6 +20,20 @@ struct PagesFileTests {
 		])
 	}
 
+	@Test("Streaming events match the parsed document's events")
+	func streamedEventsMatchDocument() throws {
+		let url = try #require(
+			Bundle.module.url(forResource: "Sample", withExtension: "pages")
+		)
+		var streamed = [DocumentEvent]()
+		try PagesFile.events(url: url) { streamed.append($0) }
+		var parsed = [DocumentEvent]()
+		try PagesFile(url: url).document.events { parsed.append($0) }
+
+		#expect(!streamed.isEmpty)
+		#expect(streamed == parsed)
+	}
+
 	@Test("Reports a clear error for a non-iWork archive")
 	func rejectsNonIWorkArchive() throws {
 		// A directory with no Index/ entries is not a modern Pages document.
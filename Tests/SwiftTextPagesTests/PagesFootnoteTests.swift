@@ -42,4 +42,21 @@ struct PagesFootnoteTests {
         #expect(defs["x"] == "First line. continued line.")
         #expect(!cleaned.contains("[^x]:"))
     }
+
+    @Test("A blank line inside an indented definition continues it")
+    func blankLineContinuesDefinition() {
+        let (cleaned, defs) = MarkdownPagesBuilder.extractFootnoteDefinitions(
+            "A ref.\n\n[^x]: First paragraph.\n\n    Second paragraph.\n\nAfter.\n")
+        #expect(defs["x"] == "First paragraph. Second paragraph.")
+        #expect(!cleaned.contains("Second paragraph."))
+        #expect(cleaned.contains("After."))
+    }
+
+    @Test("Of two definitions with the same id, the first wins")
+    func duplicateDefinitionFirstWins() {
+        let (cleaned, defs) = MarkdownPagesBuilder.extractFootnoteDefinitions(
+            "A ref.\n\n[^x]: First.\n[^x]: Second.\n")
+        #expect(defs == ["x": "First."])
+        #expect(!cleaned.contains("Second."))
+    }
 }
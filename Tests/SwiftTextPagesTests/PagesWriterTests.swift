@@ -2,6 +2,7 @@ import Foundation
 import Testing
 
 @testable import SwiftTextPages
+import SwiftTextCore
 
 @Suite("Pages writing")
 struct PagesWriterTests {
@@ -43,4 +44,70 @@ struct PagesWriterTests {
 		#expect(markdown.contains("italic"))
 		#expect(markdown.contains("First bullet"))
 	}
+
+	@Test("An event stream writes the same document as its Markdown")
+	func eventStreamMatchesMarkdown() throws {
+		let markdown = """
+		# Title
+
+		Plain **bold** and *italic* text.
+
+		- One
+		- Two
+
+		```
+		let x = 1
+		```
+		"""
+		let events: [DocumentEvent] = [
+			.beginHeading(level: 1), .text("Title", .plain), .endHeading,
+			.beginParagraph,
+			.text("Plain ", .plain), .text("bold", DocumentTextStyle(bold: true)),
+			.text(" and ", .plain), .text("italic", DocumentTextStyle(italic: true)),
+			.text(" text.", .plain),
+			.endParagraph,
+			.beginListItem(level: 0, ordered: false), .text("One", .plain), .endListItem,
+			.beginListItem(level: 0, ordered: false), .text("Two", .plain), .endListItem,
+			.beginCodeBlock(language: nil), .text("let x = 1", .plain), .endCodeBlock
+		]
+		let written = try writtenByEvents(events)
+		let converted = try writtenByMarkdown(markdown)
+		#expect(written == converted)
+	}
+
+	@Test("A read fixture re-written from events matches its Markdown round trip")
+	func fixtureEventsMatchMarkdown() throws {
+		let fixture = try #require(
+			Bundle.module.url(forResource: "Sample", withExtension: "pages")
+		)
+		let source = try PagesFile(url: fixture)
+		var events = [DocumentEvent]()
+		try source.document.events { events.append($0) }
+
+		let written = try writtenByEvents(events)
+		let converted = try writtenByMarkdown(source.markdown())
+		#expect(written == converted)
+		#expect(written.contains("This is the second body paragraph."))
+	}
+
+	/// Writes `events` through ``PagesWriter`` and reads the result back as Markdown.
+	private func writtenByEvents(_ events: [DocumentEvent]) throws -> String {
+		let url = FileManager.default.temporaryDirectory
+			.appendingPathComponent("swifttext-events-\(UUID().uuidString).pages")
+		defer { try? FileManager.default.removeItem(at: url) }
+		let writer = PagesWriter()
+		for event in events { try writer.consume(event) }
+		try writer.finish()
+		try writer.write(to: url)
+		return try PagesFile(url: url).markdown()
+	}
+
+	/// Writes `markdown` through ``MarkdownToPages`` and reads the result back as Markdown.
+	private func writtenByMarkdown(_ markdown: String) throws -> String {
+		let url = FileManager.default.temporaryDirectory
+			.appendingPathComponent("swifttext-markdown-\(UUID().uuidString).pages")
+		defer { try? FileManager.default.removeItem(at: url) }
+		try MarkdownToPages.convert(markdown, to: url)
+		return try PagesFile(url: url).markdown()
+	}
 }
@@ -2,6 +2,7 @@ import Foundation
 import Testing
 
 @testable import SwiftTextPages
+import SwiftTextCore
 import SwiftTextIWA
 
 @Suite("Snappy block decompression")
@@ -40,6 +41,34 @@ struct SnappyTests {
 		}
 	}
 
+	@Test("Rejects a length header larger than the limit before allocating")
+	func lengthHeaderOverLimit() {
+		// Header claims 2^28 bytes; the block itself is a 1-byte literal.
+		let bytes: [UInt8] = [0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x41]
+		#expect(throws: ResourceLimitError.limitExceeded(.decompressedBytes, limit: 1024)) {
+			_ = try Snappy.decompress(bytes, limit: 1024)
+		}
+	}
+
+	@Test("Rejects output that grows past the limit despite a small header")
+	func outputOverLimit() {
+		// Header claims 4 bytes, but the copy expands "ABC" by another 9.
+		let bytes: [UInt8] = [0x04, 0x08, 0x41, 0x42, 0x43, 0x15, 0x03]
+		#expect(throws: ResourceLimitError.limitExceeded(.decompressedBytes, limit: 8)) {
+			_ = try Snappy.decompress(bytes, limit: 8)
+		}
+	}
+
+	@Test("A multi-chunk stream over budget reports the configured limit")
+	func chunkedStreamReportsConfiguredLimit() {
+		// Two 64 KiB chunks: the second is cut off at what the first left over.
+		let data = IWAArchive.encode(stream: Array(repeating: 0x41, count: 100_000))
+		let budget = ResourceBudget(ResourceLimits(maxDecompressedBytes: 80_000))
+		#expect(throws: ResourceLimitError.limitExceeded(.decompressedBytes, limit: 80_000)) {
+			_ = try IWAArchive.decompress(data, budget: budget)
+		}
+	}
+
 	@Test("Compression round-trips through the decompressor")
 	func compressRoundTrip() throws {
 		// Deterministic pseudo-random (≈ incompressible) bytes.
@@ -70,4 +99,15 @@ struct SnappyTests {
 		let input = Array(repeating: UInt8(0x41), count: 5000)
 		#expect(Snappy.compress(input).count < input.count)
 	}
+
+	@Test("A cancelled task still gets a valid, literal-only block")
+	func compressionUnderCancellation() async throws {
+		let input = Array(repeating: UInt8(0x41), count: 5000)
+		let compressed = await Task {
+			withUnsafeCurrentTask { $0?.cancel() }
+			return Snappy.compress(input)
+		}.value
+		#expect(compressed.count > input.count) // no matches were searched for
+		#expect(try Snappy.decompress(compressed) == input)
+	}
 }
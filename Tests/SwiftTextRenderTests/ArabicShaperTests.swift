@@ -93,7 +93,7 @@ struct ArabicShaperTests {
 		let root = try #require(builder.root)
 		let styled = StyledElement.build(domElement: root, resolver: StyleResolver(), baseDirection: .rtl)
 		let rootBox = try #require(BoxTreeBuilder.build(from: styled) as? BlockBox)
-		LayoutEngine(fonts: fonts).layout(root: rootBox, contentWidth: 300, originX: 0, originY: 0)
+		try LayoutEngine(fonts: fonts).layout(root: rootBox, contentWidth: 300, originX: 0, originY: 0)
 
 		let paragraph = try #require(firstBlock(in: rootBox) { $0.element?.localName == "p" })
 		let fragment = try #require(paragraph.lines.first?.fragments.first)
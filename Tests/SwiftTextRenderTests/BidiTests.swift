@@ -56,4 +56,30 @@ struct BidiTests {
 		#expect(!Bidi.isRTLScalar("a"))
 		#expect(!Bidi.isRTLScalar("5"))
 	}
+
+	@Test("Byte pre-scan finds every RTL block and skips Latin")
+	func rightToLeftPrescan() {
+		#expect(!Bidi.mayContainRightToLeft("plain ASCII text, long enough for the wide scan"))
+		#expect(!Bidi.mayContainRightToLeft("caf\u{E9} na\u{EF}ve \u{4E2D}\u{6587} \u{1F600}"))
+		#expect(Bidi.mayContainRightToLeft("a long ASCII prefix then \u{05D0}"))
+		#expect(Bidi.mayContainRightToLeft("\u{0661}"))   // Arabic-Indic digit (AN)
+		#expect(Bidi.mayContainRightToLeft("\u{08A0}"))
+		#expect(Bidi.mayContainRightToLeft("x\u{FB1D}"))
+		#expect(Bidi.mayContainRightToLeft("\u{FEFC}"))
+	}
+
+	@Test("Run-level resolution matches the per-scalar rules")
+	func runLevels() {
+		// "12,5" joins across a single CS (W4); "1,,2" does not.
+		let joined = Array("\u{05D0} 12,5".unicodeScalars)
+		#expect(Bidi.levels(for: joined, baseDirection: .leftToRight) == [1, 1, 2, 2, 2, 2])
+		let split = Array("\u{0627} 1,,2".unicodeScalars)
+		#expect(Bidi.levels(for: split, baseDirection: .rightToLeft) == [1, 1, 2, 1, 1, 2])
+		var runs = BidiRuns()
+		#expect(runs.append("ab".unicodeScalars) == 0)
+		#expect(runs.append(" ".unicodeScalars) == 1)
+		#expect(runs.append("cd".unicodeScalars) == 2)
+		#expect(runs.append("e".unicodeScalars) == 2)
+		#expect(runs.lengths == [2, 1, 3])
+	}
 }
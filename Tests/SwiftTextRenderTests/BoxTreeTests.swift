@@ -4,6 +4,7 @@
 import Testing
 import Foundation
 @testable import SwiftTextRender
+import SwiftTextCore
 import SwiftTextHTML
 import SwiftTextCSS
 
@@ -60,6 +61,20 @@ struct BoxTreeTests {
 		#expect(span.element?.localName == "span")
 	}
 
+	@Test("A tree shares one arena: distinct geometry slots, interned styles")
+	func arena() async throws {
+		let tree = try await boxTree("<div><p>one</p><p>two</p></div>")
+		let div = try #require(find(tree, tag: "div") as? BlockBox)
+		let first = try #require(div.children[0] as? BlockBox)
+		let second = try #require(div.children[1] as? BlockBox)
+		#expect(first.arena === tree.arena && second.arena === tree.arena)
+		#expect(first.slot != second.slot)
+		#expect(first.styleIndex == second.styleIndex)
+		first.y = 10
+		second.y = 30
+		#expect(first.y == 10 && second.y == 30)
+	}
+
 	@Test("display:none produces no box")
 	func displayNone() async throws {
 		let tree = try await boxTree("<div style=\"display:none\">hidden</div><p>shown</p>")
@@ -80,4 +95,83 @@ struct BoxTreeTests {
 		let tree = try await boxTree("<div>x</div>", css: ["div { display: inline }"])
 		#expect(find(tree, tag: "div") is InlineBox)
 	}
+
+	@Test("A Markdown AST builds the same element tree as its HTML rendering")
+	func markdownTreeMatchesHTML() async throws {
+		let markdown = """
+		# Title
+
+		Some *emphasis*, **strong**, `code` and a [link](https://example.com).[^a]
+
+		- [x] done
+		- [ ] todo
+
+		> [!NOTE]
+		> Heads up.
+
+		```swift
+		let x = 1
+		```
+
+		| Left | Right |
+		|:-----|------:|
+		| a    | b     |
+
+		[^a]: The footnote.
+		"""
+		let builder = try await DomBuilder(html: Data(MarkdownToHTML.convert(markdown).utf8), baseURL: nil)
+		let dom = StyledElement.build(domElement: try #require(builder.root), resolver: StyleResolver())
+		let tree = try MarkdownStyledTree.build(markdown: markdown, budget: ResourceBudget(.unlimited))
+
+		func body(_ element: StyledElement) -> StyledElement? {
+			if element.localName == "body" { return element }
+			return element.elementChildren.lazy.compactMap(body).first
+		}
+		func signature(_ element: StyledElement) -> String {
+			let attributes = ["class", "href", "id", "src", "alt", "style", "type"].compactMap { name in
+				element.attributeValue(name).map { "\(name)=\($0)" }
+			}
+			let children = element.children.compactMap { child -> String? in
+				switch child {
+				case .element(let element): return signature(element)
+				case .text(let text):
+					let words = text.split(whereSeparator: \.isWhitespace).joined(separator: " ")
+					return words.isEmpty ? nil : "\"\(words)\""
+				}
+			}
+			return "<\(element.localName) \(attributes.joined(separator: " "))>\(children.joined())</\(element.localName)>"
+		}
+		let expected = try signature(#require(body(dom)))
+		#expect(try signature(#require(body(tree))) == expected)
+		#expect(expected.contains("markdown-alert-note"))
+		#expect(expected.contains("fn-1"))
+	}
+
+	@Test("A Markdown tree stops growing at the DOM-node limit")
+	func markdownTreeStopsAtNodeLimit() throws {
+		let list = (0 ..< 10_000).map { "- item \($0) with **bold** and a [^n] reference" }.joined(separator: "\n")
+		let table = "| a | b |\n|---|---|\n" + (0 ..< 10_000).map { "| \($0) | *x* |" }.joined(separator: "\n")
+		let quote = (0 ..< 10_000).map { "> line \($0) with `code`\n>" }.joined(separator: "\n")
+		for markdown in [list + "\n\n[^n]: Note.", table, quote] {
+			let budget = ResourceBudget(ResourceLimits(maxDOMNodes: 100))
+			#expect(throws: ResourceLimitError.limitExceeded(.domNodes, limit: 100)) {
+				try MarkdownStyledTree.build(markdown: markdown, budget: budget)
+			}
+			// Nothing is charged, or built, after the node that went over.
+			#expect(budget.usage(of: .domNodes) == 101)
+		}
+	}
+
+	@Test("Standalone fragments with equal styles share one style table")
+	@available(*, deprecated)
+	func standaloneFragmentsShareStyles() {
+		var bold = ComputedStyle.initial
+		bold.fontWeight = 700
+		let first = TextFragment(text: "a", style: bold, x: 0, y: 0, width: 1, baseline: 1)
+		let second = TextFragment(text: "b", style: bold, x: 1, y: 0, width: 1, baseline: 1)
+		let plain = TextFragment(text: "c", style: .initial, x: 2, y: 0, width: 1, baseline: 1)
+		#expect(first.sharesStyle(with: second))
+		#expect(!first.sharesStyle(with: plain))
+		#expect(second.style == bold)
+	}
 }
@@ -26,6 +26,27 @@ struct FontFallbackTests {
 		#expect(!helvetica.covers("\u{4E00}"))  // CJK
 	}
 
+	@Test("The shaped-run cache computes a word once and stays bounded")
+	func shapedRunCache() {
+		let cache = ShapedRunCache(capacity: 2)
+		let font = Font.standard(.helvetica(bold: false, italic: false))
+		var computed = 0
+		func runs(_ word: String) -> [ShapedRun] {
+			let key = ShapedRunCache.Key(word: word[...], font: font.key, bold: false, italic: false, size: 16, letterSpacing: 0)
+			return cache.runs(for: key) {
+				computed += 1
+				return [ShapedRun(text: word, font: font, width: font.width(of: word, size: 16), glyphs: nil)]
+			}
+		}
+		#expect(runs("alpha").first?.text == "alpha")
+		_ = runs("alpha")
+		#expect(computed == 1)
+		_ = runs("beta")
+		_ = runs("gamma") // full: starts over
+		_ = runs("alpha")
+		#expect(computed == 4)
+	}
+
 	#if os(macOS)
 	@Test("Digits missing from an Arabic font fall back to base-14")
 	func arabicDigitsFallBack() throws {
@@ -4,6 +4,7 @@
 import Testing
 import Foundation
 @testable import SwiftTextRender
+import SwiftTextCore
 import SwiftTextHTML
 import SwiftTextCSS
 
@@ -79,6 +80,48 @@ struct RenderPDFTests {
 		#endif
 	}
 
+	@Test("Resource limits stop oversized documents with a typed error")
+	func resourceLimitsStopRendering() async throws {
+		var html = "<body>"
+		for index in 0 ..< 120 {
+			html += "<p>Paragraph number \(index): a line of text to fill the page.</p>"
+		}
+		html += "</body>"
+
+		await #expect(throws: ResourceLimitError.limitExceeded(.pages, limit: 1)) {
+			_ = try await HTMLRenderer.renderPDF(html: html, options: RenderOptions(limits: ResourceLimits(maxPages: 1)))
+		}
+		await #expect(throws: ResourceLimitError.limitExceeded(.domNodes, limit: 50)) {
+			_ = try await HTMLRenderer.renderPDF(html: html, options: RenderOptions(limits: ResourceLimits(maxDOMNodes: 50)))
+		}
+		await #expect(throws: ResourceLimitError.limitExceeded(.boxes, limit: 50)) {
+			_ = try await HTMLRenderer.renderPDF(html: html, options: RenderOptions(limits: ResourceLimits(maxBoxes: 50)))
+		}
+		await #expect(throws: ResourceLimitError.deadlineExceeded) {
+			let expired = ResourceLimits(deadline: Date(timeIntervalSinceNow: -1))
+			_ = try await HTMLRenderer.renderPDF(html: html, options: RenderOptions(limits: expired))
+		}
+		// Generous limits leave rendering unchanged.
+		let data = try await HTMLRenderer.renderPDF(html: html, options: RenderOptions(limits: ResourceLimits(maxDOMNodes: 10_000, maxPages: 50)))
+		#expect(data.starts(with: Data("%PDF".utf8)))
+	}
+
+	@Test("Cancelling the rendering task throws CancellationError")
+	func cancellationStopsRendering() async throws {
+		var html = "<body>"
+		for index in 0 ..< 120 {
+			html += "<p>Paragraph number \(index): a line of text to fill the page.</p>"
+		}
+		html += "</body>"
+		let task = Task {
+			withUnsafeCurrentTask { $0?.cancel() }
+			return try await HTMLRenderer.renderPDF(html: html)
+		}
+		await #expect(throws: CancellationError.self) {
+			_ = try await task.value
+		}
+	}
+
 	@Test("Each page paints only its own slice, not the whole document (O(n²) guard)")
 	func pagesDoNotDuplicateWholeDocument() async throws {
 		// A word painted near the top of a long, multi-page document must appear
@@ -247,13 +290,14 @@ struct RenderPDFTests {
 
 	// MARK: - Layout geometry
 
-	private func layoutTree(_ html: String, css: [String] = [], contentWidth: Double) async throws -> BlockBox {
+	private func layoutTree(_ html: String, css: [String] = [], contentWidth: Double, parallel: Bool = false,
+	                        fonts: FontBook = FontBook(), cache: LayoutCache? = nil) async throws -> BlockBox {
 		let builder = try await DomBuilder(html: Data(html.utf8), baseURL: nil)
 		let root = try #require(builder.root)
 		let resolver = StyleResolver(authorStyleSheets: css)
 		let styled = StyledElement.build(domElement: root, resolver: resolver)
 		let rootBox = try #require(BoxTreeBuilder.build(from: styled) as? BlockBox)
-		LayoutEngine(fonts: FontBook()).layout(root: rootBox, contentWidth: contentWidth, originX: 0, originY: 0)
+		try LayoutEngine(fonts: fonts, parallel: parallel, cache: cache).layout(root: rootBox, contentWidth: contentWidth, originX: 0, originY: 0)
 		return rootBox
 	}
 
@@ -344,6 +388,131 @@ struct RenderPDFTests {
 		#expect(baseline > low.y + low.height / 2) // content sits in the lower half
 	}
 
+	@Test("Row groups span their rows and rowspans close a group")
+	func tableRowGroups() async throws {
+		let html = "<table><thead><tr><th>H</th><th>I</th></tr></thead>"
+			+ "<tbody><tr><td rowspan=2>Tall</td><td>A</td></tr><tr><td>B</td></tr><tr><td>C</td><td>D</td></tr></tbody></table>"
+		let root = try await layoutTree(html, contentWidth: 400)
+		let head = try #require(firstBlock(in: root) { $0.element?.localName == "thead" })
+		let body = try #require(firstBlock(in: root) { $0.element?.localName == "tbody" })
+		let rows = collectBlocks(in: root) { $0.element?.localName == "tr" }
+		#expect(rows.count == 4)
+		#expect(head.y == rows[0].y && head.height == rows[0].height)
+		#expect(body.y == rows[1].y)
+		#expect(abs(body.y + body.height - (rows[3].y + rows[3].height)) < 0.01)
+		// C starts back at column 0 once the rowspan has ended.
+		let cells = collectBlocks(in: root) { $0.element?.localName == "td" } // Tall, A, B, C, D
+		#expect(abs(cells[3].x - cells[0].x) < 0.01)
+		#expect(cells[3].y >= cells[0].y + cells[0].height)
+	}
+
+	private func occurrences(of marker: String, in data: Data) -> Int {
+		let needle = Array(marker.utf8)
+		let haystack = [UInt8](data)
+		guard haystack.count >= needle.count else { return 0 }
+		var count = 0
+		for start in 0 ... (haystack.count - needle.count) where Array(haystack[start ..< start + needle.count]) == needle {
+			count += 1
+		}
+		return count
+	}
+
+	@Test("A table's thead repeats on every page it continues onto")
+	func repeatsTableHeader() async throws {
+		var html = "<table><thead><tr><th>HEADERMARKER</th><th>Value</th></tr></thead><tbody>"
+		for index in 0 ..< 300 {
+			html += "<tr><td>Row \(index)</td><td>\(index * 7)</td></tr>"
+		}
+		html += "</tbody></table>"
+		let data = try await HTMLRenderer.renderPDF(html: html, options: RenderOptions(compressStreams: false))
+
+		// Drawn once in flow on the first page and once into the form that every
+		// continuation page places with `Do`.
+		#expect(occurrences(of: "HEADERMARKER", in: data) == 2)
+		#expect(occurrences(of: "/Subtype /Form", in: data) == 1)
+		#expect(occurrences(of: "/Fm1 Do", in: data) > 1)
+		#if canImport(PDFKit)
+		let document = try #require(PDFDocument(data: data))
+		for index in 0 ..< document.pageCount {
+			#expect(document.page(at: index)?.string?.contains("HEADERMARKER") == true)
+		}
+		#endif
+	}
+
+	@Test("Parallel layout places every box where serial layout does")
+	func parallelLayoutMatchesSerial() async throws {
+		var html = "<body><h1>Report</h1>"
+		for index in 0 ..< 40 {
+			html += "<p>Paragraph \(index) has enough words in it to wrap onto a second line at this width.</p>"
+		}
+		html += "<ul>" + (0 ..< 12).map { "<li>item \($0)</li>" }.joined() + "</ul>"
+		html += "<table><tr>" + (0 ..< 9).map { "<td>cell \($0)</td>" }.joined() + "</tr></table></body>"
+
+		let serial = try await layoutTree(html, contentWidth: 300)
+		let parallel = try await layoutTree(html, contentWidth: 300, parallel: true)
+		let serialBlocks = collectBlocks(in: serial) { _ in true }
+		let parallelBlocks = collectBlocks(in: parallel) { _ in true }
+		#expect(serialBlocks.count == parallelBlocks.count)
+		for (a, b) in zip(serialBlocks, parallelBlocks) {
+			#expect(abs(a.y - b.y) < 0.001 && abs(a.height - b.height) < 0.001 && a.x == b.x)
+			#expect(a.lines.map(\.y).elementsEqual(b.lines.map(\.y)) { abs($0 - $1) < 0.001 })
+			#expect(a.lines.flatMap { $0.fragments.map(\.baseline) }
+				.elementsEqual(b.lines.flatMap { $0.fragments.map(\.baseline) }) { abs($0 - $1) < 0.001 })
+		}
+	}
+
+	@Test("A layout cache replays unchanged sections exactly")
+	func layoutCacheReplaysUnchangedSections() async throws {
+		let terms = "<section><h2>Terms</h2>"
+			+ (0 ..< 6).map { "<p>Clause \($0) applies to every report and wraps onto a second line at this width.</p>" }.joined()
+			+ "</section>"
+		func report(_ customer: String) -> String { "<body><p>Prepared for \(customer)</p>\(terms)</body>" }
+
+		let fonts = FontBook()
+		let cache = LayoutCache()
+		// The terms are stored on their second sighting and reused on the third.
+		_ = try await layoutTree(report("Ada"), contentWidth: 300, fonts: fonts, cache: cache)
+		_ = try await layoutTree(report("Grace"), contentWidth: 300, fonts: fonts, cache: cache)
+		#expect(cache.statistics.hits == 0)
+		let cached = try await layoutTree(report("Linus"), contentWidth: 300, fonts: fonts, cache: cache)
+		#expect(cache.statistics.hits > 0)
+		#expect(cache.statistics.entries > 0)
+
+		let fresh = try await layoutTree(report("Linus"), contentWidth: 300)
+		let cachedBlocks = collectBlocks(in: cached) { _ in true }
+		let freshBlocks = collectBlocks(in: fresh) { _ in true }
+		#expect(cachedBlocks.count == freshBlocks.count)
+		for (a, b) in zip(cachedBlocks, freshBlocks) {
+			#expect(abs(a.x - b.x) < 0.001 && abs(a.y - b.y) < 0.001)
+			#expect(abs(a.width - b.width) < 0.001 && abs(a.height - b.height) < 0.001)
+			#expect(a.lines.flatMap { $0.fragments.map(\.text) } == b.lines.flatMap { $0.fragments.map(\.text) })
+			#expect(a.lines.flatMap { $0.fragments.flatMap { [$0.x, $0.baseline] } }
+				.elementsEqual(b.lines.flatMap { $0.fragments.flatMap { [$0.x, $0.baseline] } }) { abs($0 - $1) < 0.001 })
+		}
+
+		// A different width is a different layout.
+		let hits = cache.statistics.hits
+		_ = try await layoutTree(report("Linus"), contentWidth: 280, fonts: fonts, cache: cache)
+		#expect(cache.statistics.hits == hits)
+	}
+
+	@Test("A cached layout is only applied to a subtree of the same shape")
+	func layoutSnapshotChecksShapeOnHit() async throws {
+		let css = [".x { font-weight: bold }"]
+		let source = try await layoutTree("<body><p>ab</p><p>cd</p></body>", css: css, contentWidth: 300)
+		let snapshot = try #require(LayoutSnapshot(capturing: source, originX: 0, originY: 0, height: source.height))
+
+		// Same box count, as a colliding fingerprint would have: different text
+		// length, then a different style on the second paragraph.
+		let longer = try await layoutTree("<body><p>ab</p><p>cdef</p></body>", css: css, contentWidth: 300)
+		#expect(!snapshot.apply(to: longer, originX: 0, originY: 0))
+		let restyled = try await layoutTree("<body><p>ab</p><p class=x>cd</p></body>", css: css, contentWidth: 300)
+		#expect(!snapshot.apply(to: restyled, originX: 0, originY: 0))
+
+		let same = try await layoutTree("<body><p>ab</p><p>cd</p></body>", css: css, contentWidth: 300)
+		#expect(snapshot.apply(to: same, originX: 0, originY: 0))
+	}
+
 	@Test("Box model: padding and border widen the border box")
 	func boxModel() async throws {
 		let css = ["div { width: 100px; padding: 10px; border: 5px solid black }"]
@@ -411,6 +580,14 @@ struct RenderPDFTests {
 		#expect(fragment.width > (collapsed.lines.first?.fragments.first?.width ?? 0) * 1.5)
 	}
 
+	@Test("Collapsed whitespace splits words on bytes without breaking multi-byte text")
+	func collapsedWhitespaceWords() async throws {
+		let root = try await layoutTree("<p>  caf\u{E9}\t\n  na\u{EF}ve\r\n\u{201C}ok\u{201D}  </p>", contentWidth: 600)
+		let paragraph = try #require(firstBlock(in: root) { $0.element?.localName == "p" })
+		#expect(paragraph.lines.count == 1)
+		#expect(paragraph.lines.first?.fragments.map(\.text) == ["caf\u{E9}", "na\u{EF}ve", "\u{201C}ok\u{201D}"])
+	}
+
 	@Test("Links become PDF Link annotations")
 	func linkAnnotations() async throws {
 		let html = "<p>See <a href=\"https://example.com/\">our site</a> for more.</p>"
@@ -444,6 +621,18 @@ struct RenderPDFTests {
 		#expect(data.range(of: Data(" Tc".utf8)) != nil)
 	}
 
+	@Test("A line's same-style words share one text object and one Tf/rg")
+	func batchedLineText() async throws {
+		let data = try await HTMLRenderer.renderPDF(
+			html: "<p>one two three</p><p>four five</p>",
+			options: RenderOptions(compressStreams: false))
+		let content = String(decoding: data, as: UTF8.self)
+		#expect(content.components(separatedBy: "\nBT\n").count - 1 == 2)
+		#expect(content.components(separatedBy: " TJ").count - 1 == 2)
+		#expect(content.components(separatedBy: " Tf\n").count - 1 == 1)
+		#expect(content.components(separatedBy: " rg\n").count - 1 == 1)
+	}
+
 	@Test("list-style-type: alpha, roman, square and none")
 	func listStyleTypes() async throws {
 		let alpha = try await layoutTree("<ol style=\"list-style-type: lower-alpha\"><li>x</li><li>y</li><li>z</li></ol>", contentWidth: 400)
@@ -532,7 +721,7 @@ struct RenderPDFTests {
 		let root = try #require(builder.root)
 		let styled = StyledElement.build(domElement: root, resolver: StyleResolver(), baseDirection: .rtl)
 		let rootBox = try #require(BoxTreeBuilder.build(from: styled) as? BlockBox)
-		LayoutEngine(fonts: FontBook()).layout(root: rootBox, contentWidth: 300, originX: 0, originY: 0)
+		try LayoutEngine(fonts: FontBook()).layout(root: rootBox, contentWidth: 300, originX: 0, originY: 0)
 		let p = try #require(firstBlock(in: rootBox) { $0.element?.localName == "p" })
 		let fragments = try #require(p.lines.first?.fragments)
 		#expect(fragments[0].text == "\u{05D3}\u{05D2}") // reordered + reversed, despite no dir attr
@@ -728,6 +917,48 @@ struct RenderPDFTests {
 		#endif
 	}
 
+	@Test("Margin boxes without counter(page) are one shared form")
+	func marginBoxesShareForm() async throws {
+		var html = """
+		<style>@page { @top-center { content: "RUNNINGTITLE" } @bottom-center { content: "Page " counter(page) } }</style>
+		<body>
+		"""
+		for index in 0 ..< 120 {
+			html += "<p>Paragraph number \(index): a line of text to fill the page.</p>"
+		}
+		html += "</body>"
+		let data = try await HTMLRenderer.renderPDF(html: html, options: RenderOptions(compressStreams: false))
+
+		#expect(occurrences(of: "RUNNINGTITLE", in: data) == 1)
+		#expect(occurrences(of: "(Page 1)", in: data) == 1)
+		#expect(occurrences(of: "(Page 2)", in: data) == 1)
+		#if canImport(PDFKit)
+		let document = try #require(PDFDocument(data: data))
+		#expect(document.pageCount > 2)
+		#expect(document.page(at: 1)?.string?.contains("RUNNINGTITLE") == true)
+		#expect(document.page(at: 1)?.string?.contains("Page 2") == true)
+		#endif
+	}
+
+	@Test("Compiled margin-box templates substitute counters per page")
+	func marginBoxTemplates() throws {
+		let rules = parsePageRules(["""
+		@page { @bottom-right { content: "Page " counter(page) " of " counter(pages); font-size: 10px } }
+		@page :first { @bottom-right { content: none } }
+		@page :left { @top-left { content: "Left" } }
+		"""])
+		let fonts = FontBook()
+		let templates = MarginBoxTemplates(rules, rootStyle: .initial, rootFontSize: 16, fonts: fonts)
+		#expect(templates.resolve(pageIndex: 0, totalPages: 12).isEmpty)
+		let second = templates.resolve(pageIndex: 1, totalPages: 12)
+		#expect(second.map(\.area) == [.topLeft, .bottomRight])
+		let footer = try #require(second.last)
+		#expect(footer.text == "Page 2 of 12")
+		#expect(footer.style.fontSize == 10)
+		#expect(abs(footer.width - footer.font.width(of: footer.text, size: 10)) < 0.001)
+		#expect(templates.resolve(pageIndex: 2, totalPages: 12).map(\.text) == ["Page 3 of 12"])
+	}
+
 	// MARK: - Sample artifact
 
 	@Test("Generates a sample PDF artifact")